@@ -67,6 +67,55 @@ simde_vabdd_f64(simde_float64_t a, simde_float64_t b) {
   #define vabdd_f64(a, b) simde_vabdd_f64((a), (b))
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16
+simde_vabdh_f16(simde_float16 a, simde_float16 b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vabdh_f16(a, b);
+  #else
+    simde_float32
+      af = simde_float16_to_float32(a),
+      bf = simde_float16_to_float32(b);
+
+    return simde_float16_from_float32(simde_math_fabsf(af - bf));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vabdh_f16
+  #define vabdh_f16(a, b) simde_vabdh_f16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x4_t
+simde_vabd_f16(simde_float16x4_t a, simde_float16x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vabd_f16(a, b);
+  #else
+    simde_float16x4_private
+      r_,
+      a_ = simde_float16x4_to_private(a),
+      b_ = simde_float16x4_to_private(b);
+
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128
+        af = _mm_cvtph_ps(_mm_movpi64_epi64(a_.m64)),
+        bf = _mm_cvtph_ps(_mm_movpi64_epi64(b_.m64));
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtps_ph(_mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(af, bf)), _MM_FROUND_TO_NEAREST_INT));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vabdh_f16(a_.values[i], b_.values[i]);
+      }
+    #endif
+
+    return simde_float16x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vabd_f16
+  #define vabd_f16(a, b) simde_vabd_f16((a), (b))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_float32x2_t
 simde_vabd_f32(simde_float32x2_t a, simde_float32x2_t b) {
@@ -220,6 +269,37 @@ simde_vabd_u32(simde_uint32x2_t a, simde_uint32x2_t b) {
   #define vabd_u32(a, b) simde_vabd_u32((a), (b))
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x8_t
+simde_vabdq_f16(simde_float16x8_t a, simde_float16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vabdq_f16(a, b);
+  #else
+    simde_float16x8_private
+      r_,
+      a_ = simde_float16x8_to_private(a),
+      b_ = simde_float16x8_to_private(b);
+
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+      __m256
+        af = _mm256_cvtph_ps(_mm_castps_si128(a_.m128)),
+        bf = _mm256_cvtph_ps(_mm_castps_si128(b_.m128));
+      r_.m128 = _mm_castsi128_ps(_mm256_cvtps_ph(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_sub_ps(af, bf)), _MM_FROUND_TO_NEAREST_INT));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vabdh_f16(a_.values[i], b_.values[i]);
+      }
+    #endif
+
+    return simde_float16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vabdq_f16
+  #define vabdq_f16(a, b) simde_vabdq_f16((a), (b))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_float32x4_t
 simde_vabdq_f32(simde_float32x4_t a, simde_float32x4_t b) {
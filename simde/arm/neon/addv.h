@@ -64,6 +64,8 @@ simde_vaddv_s8(simde_int8x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddv_s8(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    r = HEDLEY_STATIC_CAST(int8_t, _mm_cvtsi64_si32(_mm_sad_pu8(simde_int8x8_to_m64(a), _mm_setzero_si64())));
   #else
     simde_int8x8_private a_ = simde_int8x8_to_private(a);
 
@@ -136,6 +138,8 @@ simde_vaddv_u8(simde_uint8x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddv_u8(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    r = HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi64_si32(_mm_sad_pu8(simde_uint8x8_to_m64(a), _mm_setzero_si64())));
   #else
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
 
@@ -256,6 +260,11 @@ simde_vaddvq_s8(simde_int8x16_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddvq_s8(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i a_ = simde_int8x16_to_m128i(a);
+    a_ = _mm_sad_epu8(a_, _mm_setzero_si128());
+    a_ = _mm_add_epi8(a_, _mm_shuffle_epi32(a_, 0xEE));
+    r = HEDLEY_STATIC_CAST(int8_t, _mm_cvtsi128_si32(a_));
   #else
     simde_int8x16_private a_ = simde_int8x16_to_private(a);
 
@@ -280,6 +289,11 @@ simde_vaddvq_s16(simde_int16x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddvq_s16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i a_ = _mm_madd_epi16(simde_int16x8_to_m128i(a), _mm_set1_epi16(1));
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0xEE));
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0x55));
+    r = HEDLEY_STATIC_CAST(int16_t, _mm_cvtsi128_si32(a_));
   #else
     simde_int16x8_private a_ = simde_int16x8_to_private(a);
 
@@ -304,6 +318,11 @@ simde_vaddvq_s32(simde_int32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddvq_s32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i a_ = simde_int32x4_to_m128i(a);
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0xEE));
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0x55));
+    r = HEDLEY_STATIC_CAST(int32_t, _mm_cvtsi128_si32(a_));
   #else
     simde_int32x4_private a_ = simde_int32x4_to_private(a);
 
@@ -328,6 +347,10 @@ simde_vaddvq_s64(simde_int64x2_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddvq_s64(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    __m128i a_ = simde_int64x2_to_m128i(a);
+    a_ = _mm_add_epi64(a_, _mm_unpackhi_epi64(a_, a_));
+    r = HEDLEY_STATIC_CAST(int64_t, _mm_cvtsi128_si64(a_));
   #else
     simde_int64x2_private a_ = simde_int64x2_to_private(a);
 
@@ -381,6 +404,11 @@ simde_vaddvq_u16(simde_uint16x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddvq_u16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i a_ = _mm_madd_epi16(simde_uint16x8_to_m128i(a), _mm_set1_epi16(1));
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0xEE));
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0x55));
+    r = HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint16x8_private a_ = simde_uint16x8_to_private(a);
 
@@ -405,6 +433,11 @@ simde_vaddvq_u32(simde_uint32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddvq_u32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i a_ = simde_uint32x4_to_m128i(a);
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0xEE));
+    a_ = _mm_add_epi32(a_, _mm_shuffle_epi32(a_, 0x55));
+    r = HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint32x4_private a_ = simde_uint32x4_to_private(a);
 
@@ -429,6 +462,10 @@ simde_vaddvq_u64(simde_uint64x2_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vaddvq_u64(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    __m128i a_ = simde_uint64x2_to_m128i(a);
+    a_ = _mm_add_epi64(a_, _mm_unpackhi_epi64(a_, a_));
+    r = HEDLEY_STATIC_CAST(uint64_t, _mm_cvtsi128_si64(a_));
   #else
     simde_uint64x2_private a_ = simde_uint64x2_to_private(a);
 
@@ -0,0 +1,236 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_AES_H)
+#define SIMDE_ARM_NEON_AES_H
+
+#include "types.h"
+#include "eor.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The portable versions compute the S-box as the multiplicative inverse
+ * in GF(2^8) followed by the affine transformation instead of using a
+ * lookup table, so there are no secret-dependent memory accesses or
+ * branches.  The byte order of the AES state is the same in NEON and
+ * AES-NI, only the order of the round steps differs. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint8_t
+simde_x_vaes_xtime(uint8_t x) {
+  return HEDLEY_STATIC_CAST(uint8_t, (x << 1) ^ (0x1b & -(x >> 7)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint8_t
+simde_x_vaes_gf_mul(uint8_t a, uint8_t b) {
+  uint8_t r = 0;
+
+  for (int i = 0 ; i < 8 ; i++) {
+    r = HEDLEY_STATIC_CAST(uint8_t, r ^ (a & -(b & 1)));
+    a = simde_x_vaes_xtime(a);
+    b = HEDLEY_STATIC_CAST(uint8_t, b >> 1);
+  }
+
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint8_t
+simde_x_vaes_gf_inv(uint8_t x) {
+  /* x^254 == x^-1, and 0 maps to 0 as required by the S-box. */
+  uint8_t x2   = simde_x_vaes_gf_mul(x, x);
+  uint8_t x3   = simde_x_vaes_gf_mul(x2, x);
+  uint8_t x12  = simde_x_vaes_gf_mul(x3, x3);
+          x12  = simde_x_vaes_gf_mul(x12, x12);
+  uint8_t x15  = simde_x_vaes_gf_mul(x12, x3);
+  uint8_t x240 = simde_x_vaes_gf_mul(x15, x15);
+          x240 = simde_x_vaes_gf_mul(x240, x240);
+          x240 = simde_x_vaes_gf_mul(x240, x240);
+          x240 = simde_x_vaes_gf_mul(x240, x240);
+
+  return simde_x_vaes_gf_mul(simde_x_vaes_gf_mul(x240, x12), x2);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint8_t
+simde_x_vaes_rotl8(uint8_t x, int n) {
+  return HEDLEY_STATIC_CAST(uint8_t, (x << n) | (x >> (8 - n)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint8_t
+simde_x_vaes_sub_byte(uint8_t x) {
+  uint8_t b = simde_x_vaes_gf_inv(x);
+  return HEDLEY_STATIC_CAST(uint8_t,
+    b ^ simde_x_vaes_rotl8(b, 1) ^ simde_x_vaes_rotl8(b, 2) ^
+    simde_x_vaes_rotl8(b, 3) ^ simde_x_vaes_rotl8(b, 4) ^ 0x63);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint8_t
+simde_x_vaes_inv_sub_byte(uint8_t x) {
+  return simde_x_vaes_gf_inv(HEDLEY_STATIC_CAST(uint8_t,
+    simde_x_vaes_rotl8(x, 1) ^ simde_x_vaes_rotl8(x, 3) ^
+    simde_x_vaes_rotl8(x, 6) ^ 0x05));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaeseq_u8(simde_uint8x16_t data, simde_uint8x16_t key) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaeseq_u8(data, key);
+  #else
+    simde_uint8x16_private
+      r_,
+      a_ = simde_uint8x16_to_private(simde_veorq_u8(data, key));
+
+    #if defined(SIMDE_X86_AES_NATIVE)
+      r_.m128i = _mm_aesenclast_si128(a_.m128i, _mm_setzero_si128());
+    #else
+      static const uint8_t shift_rows[16] = { 0,  5, 10, 15,  4,  9, 14,  3,  8, 13,  2,  7, 12,  1,  6, 11 };
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vaes_sub_byte(a_.values[shift_rows[i]]);
+      }
+    #endif
+
+    return simde_uint8x16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaeseq_u8
+  #define vaeseq_u8(data, key) simde_vaeseq_u8((data), (key))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaesdq_u8(simde_uint8x16_t data, simde_uint8x16_t key) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaesdq_u8(data, key);
+  #else
+    simde_uint8x16_private
+      r_,
+      a_ = simde_uint8x16_to_private(simde_veorq_u8(data, key));
+
+    #if defined(SIMDE_X86_AES_NATIVE)
+      r_.m128i = _mm_aesdeclast_si128(a_.m128i, _mm_setzero_si128());
+    #else
+      static const uint8_t inv_shift_rows[16] = { 0, 13, 10,  7,  4,  1, 14, 11,  8,  5,  2, 15, 12,  9,  6,  3 };
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vaes_inv_sub_byte(a_.values[inv_shift_rows[i]]);
+      }
+    #endif
+
+    return simde_uint8x16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaesdq_u8
+  #define vaesdq_u8(data, key) simde_vaesdq_u8((data), (key))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaesmcq_u8(simde_uint8x16_t data) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaesmcq_u8(data);
+  #else
+    simde_uint8x16_private
+      r_,
+      a_ = simde_uint8x16_to_private(data);
+
+    #if defined(SIMDE_X86_AES_NATIVE)
+      /* AES-NI has no bare MixColumns; undo the ShiftRows and SubBytes
+       * which AESENC applies before it. */
+      __m128i zero = _mm_setzero_si128();
+      r_.m128i = _mm_aesenc_si128(_mm_aesdeclast_si128(a_.m128i, zero), zero);
+    #else
+      for (size_t c = 0 ; c < (sizeof(r_.values) / sizeof(r_.values[0])) ; c += 4) {
+        uint8_t
+          a0 = a_.values[c    ],
+          a1 = a_.values[c + 1],
+          a2 = a_.values[c + 2],
+          a3 = a_.values[c + 3],
+          t  = HEDLEY_STATIC_CAST(uint8_t, a0 ^ a1 ^ a2 ^ a3);
+
+        r_.values[c    ] = HEDLEY_STATIC_CAST(uint8_t, a0 ^ t ^ simde_x_vaes_xtime(HEDLEY_STATIC_CAST(uint8_t, a0 ^ a1)));
+        r_.values[c + 1] = HEDLEY_STATIC_CAST(uint8_t, a1 ^ t ^ simde_x_vaes_xtime(HEDLEY_STATIC_CAST(uint8_t, a1 ^ a2)));
+        r_.values[c + 2] = HEDLEY_STATIC_CAST(uint8_t, a2 ^ t ^ simde_x_vaes_xtime(HEDLEY_STATIC_CAST(uint8_t, a2 ^ a3)));
+        r_.values[c + 3] = HEDLEY_STATIC_CAST(uint8_t, a3 ^ t ^ simde_x_vaes_xtime(HEDLEY_STATIC_CAST(uint8_t, a3 ^ a0)));
+      }
+    #endif
+
+    return simde_uint8x16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaesmcq_u8
+  #define vaesmcq_u8(data) simde_vaesmcq_u8((data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaesimcq_u8(simde_uint8x16_t data) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaesimcq_u8(data);
+  #elif defined(SIMDE_X86_AES_NATIVE)
+    simde_uint8x16_private
+      r_,
+      a_ = simde_uint8x16_to_private(data);
+
+    r_.m128i = _mm_aesimc_si128(a_.m128i);
+
+    return simde_uint8x16_from_private(r_);
+  #else
+    /* InvMixColumns is MixColumns applied to a pre-multiplied column. */
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(data);
+
+    for (size_t c = 0 ; c < (sizeof(a_.values) / sizeof(a_.values[0])) ; c += 4) {
+      uint8_t
+        u = simde_x_vaes_xtime(simde_x_vaes_xtime(HEDLEY_STATIC_CAST(uint8_t, a_.values[c    ] ^ a_.values[c + 2]))),
+        v = simde_x_vaes_xtime(simde_x_vaes_xtime(HEDLEY_STATIC_CAST(uint8_t, a_.values[c + 1] ^ a_.values[c + 3])));
+
+      a_.values[c    ] = HEDLEY_STATIC_CAST(uint8_t, a_.values[c    ] ^ u);
+      a_.values[c + 1] = HEDLEY_STATIC_CAST(uint8_t, a_.values[c + 1] ^ v);
+      a_.values[c + 2] = HEDLEY_STATIC_CAST(uint8_t, a_.values[c + 2] ^ u);
+      a_.values[c + 3] = HEDLEY_STATIC_CAST(uint8_t, a_.values[c + 3] ^ v);
+    }
+
+    return simde_vaesmcq_u8(simde_uint8x16_from_private(a_));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaesimcq_u8
+  #define vaesimcq_u8(data) simde_vaesimcq_u8((data))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_AES_H) */
@@ -28,11 +28,10 @@
 #define SIMDE_ARM_NEON_CLS_H
 
 #include "types.h"
-#include "bsl.h"
 #include "clz.h"
-#include "cltz.h"
 #include "dup_n.h"
-#include "mvn.h"
+#include "eor.h"
+#include "shr_n.h"
 #include "sub.h"
 #include "reinterpret.h"
 
@@ -46,7 +45,7 @@ simde_vcls_s8(simde_int8x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vcls_s8(a);
   #else
-    return simde_vsub_s8(simde_vclz_s8(simde_vbsl_s8(simde_vcltz_s8(a), simde_vmvn_s8(a), a)), simde_vdup_n_s8(INT8_C(1)));
+    return simde_vsub_s8(simde_vclz_s8(simde_veor_s8(a, simde_vshr_n_s8(a, 1))), simde_vdup_n_s8(INT8_C(1)));
   #endif
 }
 #define simde_vcls_u8(a) simde_vcls_s8(simde_vreinterpret_s8_u8(a))
@@ -63,7 +62,7 @@ simde_vcls_s16(simde_int16x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vcls_s16(a);
   #else
-    return simde_vsub_s16(simde_vclz_s16(simde_vbsl_s16(simde_vcltz_s16(a), simde_vmvn_s16(a), a)), simde_vdup_n_s16(INT16_C(1)));
+    return simde_vsub_s16(simde_vclz_s16(simde_veor_s16(a, simde_vshr_n_s16(a, 1))), simde_vdup_n_s16(INT16_C(1)));
   #endif
 }
 #define simde_vcls_u16(a) simde_vcls_s16(simde_vreinterpret_s16_u16(a))
@@ -80,7 +79,7 @@ simde_vcls_s32(simde_int32x2_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vcls_s32(a);
   #else
-    return simde_vsub_s32(simde_vclz_s32(simde_vbsl_s32(simde_vcltz_s32(a), simde_vmvn_s32(a), a)), simde_vdup_n_s32(INT32_C(1)));
+    return simde_vsub_s32(simde_vclz_s32(simde_veor_s32(a, simde_vshr_n_s32(a, 1))), simde_vdup_n_s32(INT32_C(1)));
   #endif
 }
 #define simde_vcls_u32(a) simde_vcls_s32(simde_vreinterpret_s32_u32(a))
@@ -97,7 +96,7 @@ simde_vclsq_s8(simde_int8x16_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vclsq_s8(a);
   #else
-    return simde_vsubq_s8(simde_vclzq_s8(simde_vbslq_s8(simde_vcltzq_s8(a), simde_vmvnq_s8(a), a)), simde_vdupq_n_s8(INT8_C(1)));
+    return simde_vsubq_s8(simde_vclzq_s8(simde_veorq_s8(a, simde_vshrq_n_s8(a, 1))), simde_vdupq_n_s8(INT8_C(1)));
   #endif
 }
 #define simde_vclsq_u8(a) simde_vclsq_s8(simde_vreinterpretq_s8_u8(a))
@@ -114,7 +113,7 @@ simde_vclsq_s16(simde_int16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vclsq_s16(a);
   #else
-    return simde_vsubq_s16(simde_vclzq_s16(simde_vbslq_s16(simde_vcltzq_s16(a), simde_vmvnq_s16(a), a)), simde_vdupq_n_s16(INT16_C(1)));
+    return simde_vsubq_s16(simde_vclzq_s16(simde_veorq_s16(a, simde_vshrq_n_s16(a, 1))), simde_vdupq_n_s16(INT16_C(1)));
   #endif
 }
 #define simde_vclsq_u16(a) simde_vclsq_s16(simde_vreinterpretq_s16_u16(a))
@@ -131,7 +130,7 @@ simde_vclsq_s32(simde_int32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vclsq_s32(a);
   #else
-    return simde_vsubq_s32(simde_vclzq_s32(simde_vbslq_s32(simde_vcltzq_s32(a), simde_vmvnq_s32(a), a)), simde_vdupq_n_s32(INT32_C(1)));
+    return simde_vsubq_s32(simde_vclzq_s32(simde_veorq_s32(a, simde_vshrq_n_s32(a, 1))), simde_vdupq_n_s32(INT32_C(1)));
   #endif
 }
 #define simde_vclsq_u32(a) simde_vclsq_s32(simde_vreinterpretq_s32_u32(a))
@@ -154,9 +154,20 @@ simde_vclz_s8(simde_int8x8_t a) {
       a_ = simde_int8x8_to_private(a),
       r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_x_vclzb_s8(a_.values[i]);
-    }
+    #if defined(SIMDE_X86_SSSE3_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      /* Look up the clz of each nibble; the low nibble only counts
+       * when the high one is zero. */
+      __m128i
+        v = _mm_movpi64_epi64(a_.m64),
+        lut = _mm_setr_epi8(4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0),
+        lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, _mm_set1_epi8(0x0f))),
+        hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f)));
+      r_.m64 = _mm_movepi64_pi64(_mm_add_epi8(hi, _mm_and_si128(_mm_cmpeq_epi8(hi, _mm_set1_epi8(4)), lo)));
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vclzb_s8(a_.values[i]);
+      }
+    #endif
 
     return simde_int8x8_from_private(r_);
   #endif
@@ -220,9 +231,18 @@ simde_vclz_u8(simde_uint8x8_t a) {
       a_ = simde_uint8x8_to_private(a),
       r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_x_vclzb_u8(a_.values[i]);
-    }
+    #if defined(SIMDE_X86_SSSE3_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i
+        v = _mm_movpi64_epi64(a_.m64),
+        lut = _mm_setr_epi8(4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0),
+        lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, _mm_set1_epi8(0x0f))),
+        hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f)));
+      r_.m64 = _mm_movepi64_pi64(_mm_add_epi8(hi, _mm_and_si128(_mm_cmpeq_epi8(hi, _mm_set1_epi8(4)), lo)));
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vclzb_u8(a_.values[i]);
+      }
+    #endif
 
     return simde_uint8x8_from_private(r_);
   #endif
@@ -291,6 +311,13 @@ simde_vclzq_s8(simde_int8x16_t a) {
       a_.m128i = _mm_gf2p8affine_epi64_epi8(a_.m128i, _mm_set_epi32(HEDLEY_STATIC_CAST(int32_t, 0x80402010), HEDLEY_STATIC_CAST(int32_t, 0x08040201), HEDLEY_STATIC_CAST(int32_t, 0x80402010), HEDLEY_STATIC_CAST(int32_t, 0x08040201)), 0);
       a_.m128i = _mm_andnot_si128(_mm_add_epi8(a_.m128i, _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, 0xff))), a_.m128i);
       r_.m128i = _mm_gf2p8affine_epi64_epi8(a_.m128i, _mm_set_epi32(HEDLEY_STATIC_CAST(int32_t, 0xaaccf0ff), 0, HEDLEY_STATIC_CAST(int32_t, 0xaaccf0ff), 0), 8);
+    #elif defined(SIMDE_X86_SSSE3_NATIVE)
+      __m128i
+        v = a_.m128i,
+        lut = _mm_setr_epi8(4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0),
+        lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, _mm_set1_epi8(0x0f))),
+        hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f)));
+      r_.m128i = _mm_add_epi8(hi, _mm_and_si128(_mm_cmpeq_epi8(hi, _mm_set1_epi8(4)), lo));
     #else
       for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
         r_.values[i] = simde_x_vclzb_s8(a_.values[i]);
@@ -315,9 +342,22 @@ simde_vclzq_s16(simde_int16x8_t a) {
       a_ = simde_int16x8_to_private(a),
       r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_x_vclzh_s16(a_.values[i]);
-    }
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      /* Each 16-bit half converts to binary32 exactly, so the exponent
+       * gives the position of the leading one; adding 0.5 makes zero
+       * come out as 16 too. */
+      __m128 half = _mm_set1_ps(SIMDE_FLOAT32_C(0.5));
+      __m128i
+        lo = _mm_and_si128(a_.m128i, _mm_set1_epi32(0xffff)),
+        hi = _mm_srli_epi32(a_.m128i, 16);
+      lo = _mm_srli_epi32(_mm_castps_si128(_mm_add_ps(_mm_cvtepi32_ps(lo), half)), 23);
+      hi = _mm_srli_epi32(_mm_castps_si128(_mm_add_ps(_mm_cvtepi32_ps(hi), half)), 23);
+      r_.m128i = _mm_sub_epi16(_mm_set1_epi32(142 | (142 << 16)), _mm_or_si128(lo, _mm_slli_epi32(hi, 16)));
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vclzh_s16(a_.values[i]);
+      }
+    #endif
 
     return simde_int16x8_from_private(r_);
   #endif
@@ -337,9 +377,23 @@ simde_vclzq_s32(simde_int32x4_t a) {
       a_ = simde_int32x4_to_private(a),
       r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_x_vclzs_s32(a_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
+      r_.m128i = _mm_lzcnt_epi32(a_.m128i);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      /* Convert the upper 16 bits, or the lower 16 if the upper ones
+       * are all zero, to binary32; that is exact, so the exponent
+       * locates the leading one. */
+      __m128i
+        hi = _mm_srli_epi32(a_.m128i, 16),
+        hz = _mm_cmpeq_epi32(hi, _mm_setzero_si128()),
+        t = _mm_or_si128(hi, _mm_and_si128(hz, _mm_and_si128(a_.m128i, _mm_set1_epi32(0xffff)))),
+        e = _mm_srli_epi32(_mm_castps_si128(_mm_add_ps(_mm_cvtepi32_ps(t), _mm_set1_ps(SIMDE_FLOAT32_C(0.5)))), 23);
+      r_.m128i = _mm_sub_epi32(_mm_add_epi32(_mm_and_si128(hz, _mm_set1_epi32(16)), _mm_set1_epi32(142)), e);
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vclzs_s32(a_.values[i]);
+      }
+    #endif
 
     return simde_int32x4_from_private(r_);
   #endif
@@ -363,6 +417,13 @@ simde_vclzq_u8(simde_uint8x16_t a) {
       a_.m128i = _mm_gf2p8affine_epi64_epi8(a_.m128i, _mm_set_epi32(HEDLEY_STATIC_CAST(int32_t, 0x80402010), HEDLEY_STATIC_CAST(int32_t, 0x08040201), HEDLEY_STATIC_CAST(int32_t, 0x80402010), HEDLEY_STATIC_CAST(int32_t, 0x08040201)), 0);
       a_.m128i = _mm_andnot_si128(_mm_add_epi8(a_.m128i, _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, 0xff))), a_.m128i);
       r_.m128i = _mm_gf2p8affine_epi64_epi8(a_.m128i, _mm_set_epi32(HEDLEY_STATIC_CAST(int32_t, 0xaaccf0ff), 0, HEDLEY_STATIC_CAST(int32_t, 0xaaccf0ff), 0), 8);
+    #elif defined(SIMDE_X86_SSSE3_NATIVE)
+      __m128i
+        v = a_.m128i,
+        lut = _mm_setr_epi8(4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0),
+        lo = _mm_shuffle_epi8(lut, _mm_and_si128(v, _mm_set1_epi8(0x0f))),
+        hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f)));
+      r_.m128i = _mm_add_epi8(hi, _mm_and_si128(_mm_cmpeq_epi8(hi, _mm_set1_epi8(4)), lo));
     #else
       for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
         r_.values[i] = simde_x_vclzb_u8(a_.values[i]);
@@ -387,9 +448,19 @@ simde_vclzq_u16(simde_uint16x8_t a) {
       a_ = simde_uint16x8_to_private(a),
       r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_x_vclzh_u16(a_.values[i]);
-    }
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      __m128 half = _mm_set1_ps(SIMDE_FLOAT32_C(0.5));
+      __m128i
+        lo = _mm_and_si128(a_.m128i, _mm_set1_epi32(0xffff)),
+        hi = _mm_srli_epi32(a_.m128i, 16);
+      lo = _mm_srli_epi32(_mm_castps_si128(_mm_add_ps(_mm_cvtepi32_ps(lo), half)), 23);
+      hi = _mm_srli_epi32(_mm_castps_si128(_mm_add_ps(_mm_cvtepi32_ps(hi), half)), 23);
+      r_.m128i = _mm_sub_epi16(_mm_set1_epi32(142 | (142 << 16)), _mm_or_si128(lo, _mm_slli_epi32(hi, 16)));
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vclzh_u16(a_.values[i]);
+      }
+    #endif
 
     return simde_uint16x8_from_private(r_);
   #endif
@@ -409,9 +480,20 @@ simde_vclzq_u32(simde_uint32x4_t a) {
       a_ = simde_uint32x4_to_private(a),
       r_;
 
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_x_vclzs_u32(a_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
+      r_.m128i = _mm_lzcnt_epi32(a_.m128i);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i
+        hi = _mm_srli_epi32(a_.m128i, 16),
+        hz = _mm_cmpeq_epi32(hi, _mm_setzero_si128()),
+        t = _mm_or_si128(hi, _mm_and_si128(hz, _mm_and_si128(a_.m128i, _mm_set1_epi32(0xffff)))),
+        e = _mm_srli_epi32(_mm_castps_si128(_mm_add_ps(_mm_cvtepi32_ps(t), _mm_set1_ps(SIMDE_FLOAT32_C(0.5)))), 23);
+      r_.m128i = _mm_sub_epi32(_mm_add_epi32(_mm_and_si128(hz, _mm_set1_epi32(16)), _mm_set1_epi32(142)), e);
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_x_vclzs_u32(a_.values[i]);
+      }
+    #endif
 
     return simde_uint32x4_from_private(r_);
   #endif
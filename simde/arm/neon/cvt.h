@@ -43,7 +43,9 @@ simde_vcvt_f16_f32(simde_float32x4_t a) {
     simde_float32x4_private a_ = simde_float32x4_to_private(a);
     simde_float16x4_private r_;
 
-    #if defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtps_ph(a_.m128, _MM_FROUND_TO_NEAREST_INT));
+    #elif defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
       SIMDE_CONVERT_VECTOR_(r_.values, a_.values);
     #else
       SIMDE_VECTORIZE
@@ -69,7 +71,9 @@ simde_vcvt_f32_f16(simde_float16x4_t a) {
     simde_float16x4_private a_ = simde_float16x4_to_private(a);
     simde_float32x4_private r_;
 
-    #if defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      r_.m128 = _mm_cvtph_ps(_mm_movpi64_epi64(a_.m64));
+    #elif defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
       SIMDE_CONVERT_VECTOR_(r_.values, a_.values);
     #else
       SIMDE_VECTORIZE
@@ -186,7 +190,7 @@ simde_vcvts_s32_f32(simde_float32 a) {
   #else
     if (HEDLEY_UNLIKELY(a < HEDLEY_STATIC_CAST(simde_float32, INT32_MIN))) {
       return INT32_MIN;
-    } else if (HEDLEY_UNLIKELY(a > HEDLEY_STATIC_CAST(simde_float32, INT32_MAX))) {
+    } else if (HEDLEY_UNLIKELY(a >= HEDLEY_STATIC_CAST(simde_float32, INT32_MAX))) {
       return INT32_MAX;
     } else if (HEDLEY_UNLIKELY(simde_math_isnanf(a))) {
       return 0;
@@ -210,7 +214,7 @@ simde_vcvts_u32_f32(simde_float32 a) {
   #else
     if (HEDLEY_UNLIKELY(a < SIMDE_FLOAT32_C(0.0))) {
       return 0;
-    } else if (HEDLEY_UNLIKELY(a > HEDLEY_STATIC_CAST(simde_float32, UINT32_MAX))) {
+    } else if (HEDLEY_UNLIKELY(a >= HEDLEY_STATIC_CAST(simde_float32, UINT32_MAX))) {
       return UINT32_MAX;
     } else if (simde_math_isnanf(a)) {
       return 0;
@@ -263,7 +267,7 @@ simde_vcvtd_s64_f64(simde_float64 a) {
   #else
     if (HEDLEY_UNLIKELY(a < HEDLEY_STATIC_CAST(simde_float64, INT64_MIN))) {
       return INT64_MIN;
-    } else if (HEDLEY_UNLIKELY(a > HEDLEY_STATIC_CAST(simde_float64, INT64_MAX))) {
+    } else if (HEDLEY_UNLIKELY(a >= HEDLEY_STATIC_CAST(simde_float64, INT64_MAX))) {
       return INT64_MAX;
     } else if (simde_math_isnanf(a)) {
       return 0;
@@ -287,7 +291,7 @@ simde_vcvtd_u64_f64(simde_float64 a) {
   #else
     if (HEDLEY_UNLIKELY(a < SIMDE_FLOAT64_C(0.0))) {
       return 0;
-    } else if (HEDLEY_UNLIKELY(a > HEDLEY_STATIC_CAST(simde_float64, UINT64_MAX))) {
+    } else if (HEDLEY_UNLIKELY(a >= HEDLEY_STATIC_CAST(simde_float64, UINT64_MAX))) {
       return UINT64_MAX;
     } else if (simde_math_isnan(a)) {
       return 0;
@@ -632,20 +636,16 @@ simde_vcvtq_u32_f32(simde_float32x4_t a) {
       #if defined(SIMDE_X86_AVX512VL_NATIVE)
         r_.m128i = _mm_cvttps_epu32(a_.m128);
       #else
-        __m128 first_oob_high = _mm_set1_ps(SIMDE_FLOAT32_C(4294967296.0));
-        __m128 neg_zero_if_too_high =
-          _mm_castsi128_ps(
-            _mm_slli_epi32(
-              _mm_castps_si128(_mm_cmple_ps(first_oob_high, a_.m128)),
-              31
-            )
-          );
+        /* cvttps2dq only covers the signed range, so inputs at or above
+         * 2^31 are biased down by 2^31 and get the top bit back after. */
+        __m128 first_oob_high = _mm_set1_ps(SIMDE_FLOAT32_C(2147483648.0));
+        __m128 too_high = _mm_cmple_ps(first_oob_high, a_.m128);
         r_.m128i =
           _mm_xor_si128(
             _mm_cvttps_epi32(
-              _mm_sub_ps(a_.m128, _mm_and_ps(neg_zero_if_too_high, first_oob_high))
+              _mm_sub_ps(a_.m128, _mm_and_ps(too_high, first_oob_high))
             ),
-            _mm_castps_si128(neg_zero_if_too_high)
+            _mm_slli_epi32(_mm_castps_si128(too_high), 31)
           );
       #endif
 
@@ -1010,7 +1010,9 @@ simde_vcvtq_f16_s16(simde_int16x8_t a) {
     simde_int16x8_private a_ = simde_int16x8_to_private(a);
     simde_float16x8_private r_;
 
-    #if defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_AVX2_NATIVE)
+      r_.m128 = _mm_castsi128_ps(_mm256_cvtps_ph(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(a_.m128i)), _MM_FROUND_TO_NEAREST_INT));
+    #elif defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
       SIMDE_CONVERT_VECTOR_(r_.values, a_.values);
     #else
       SIMDE_VECTORIZE
@@ -1066,7 +1068,9 @@ simde_vcvtq_f16_u16(simde_uint16x8_t a) {
     simde_uint16x8_private a_ = simde_uint16x8_to_private(a);
     simde_float16x8_private r_;
 
-    #if defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_AVX2_NATIVE)
+      r_.m128 = _mm_castsi128_ps(_mm256_cvtps_ph(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(a_.m128i)), _MM_FROUND_TO_NEAREST_INT));
+    #elif defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_FLOAT16_VECTOR)
       SIMDE_CONVERT_VECTOR_(r_.values, a_.values);
     #else
       SIMDE_VECTORIZE
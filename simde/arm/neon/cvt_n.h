@@ -0,0 +1,321 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_CVT_N_H)
+#define SIMDE_ARM_NEON_CVT_N_H
+
+#include "types.h"
+#include "cvt.h"
+#include "mul_n.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Fixed-point conversions.  Scaling by a power of two is exact (or
+ * overflows to infinity, which saturates anyway), so these are just the
+ * regular conversions with a multiply on the floating-point side. */
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_vcvts_n_s32_f32(simde_float32 a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvts_s32_f32(a * HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvts_n_s32_f32(a, n) vcvts_n_s32_f32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvts_n_s32_f32
+  #define vcvts_n_s32_f32(a, n) simde_vcvts_n_s32_f32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vcvts_n_u32_f32(simde_float32 a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvts_u32_f32(a * HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvts_n_u32_f32(a, n) vcvts_n_u32_f32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvts_n_u32_f32
+  #define vcvts_n_u32_f32(a, n) simde_vcvts_n_u32_f32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_vcvts_n_f32_s32(int32_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvts_f32_s32(a) * (SIMDE_FLOAT32_C(1.0) / HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvts_n_f32_s32(a, n) vcvts_n_f32_s32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvts_n_f32_s32
+  #define vcvts_n_f32_s32(a, n) simde_vcvts_n_f32_s32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_vcvts_n_f32_u32(uint32_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvts_f32_u32(a) * (SIMDE_FLOAT32_C(1.0) / HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvts_n_f32_u32(a, n) vcvts_n_f32_u32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvts_n_f32_u32
+  #define vcvts_n_f32_u32(a, n) simde_vcvts_n_f32_u32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_vcvtd_n_s64_f64(simde_float64 a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vcvtd_s64_f64(a * (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0)));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtd_n_s64_f64(a, n) vcvtd_n_s64_f64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtd_n_s64_f64
+  #define vcvtd_n_s64_f64(a, n) simde_vcvtd_n_s64_f64((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_vcvtd_n_u64_f64(simde_float64 a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vcvtd_u64_f64(a * (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0)));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtd_n_u64_f64(a, n) vcvtd_n_u64_f64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtd_n_u64_f64
+  #define vcvtd_n_u64_f64(a, n) simde_vcvtd_n_u64_f64((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_vcvtd_n_f64_s64(int64_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vcvtd_f64_s64(a) * (SIMDE_FLOAT64_C(1.0) / (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0)));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtd_n_f64_s64(a, n) vcvtd_n_f64_s64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtd_n_f64_s64
+  #define vcvtd_n_f64_s64(a, n) simde_vcvtd_n_f64_s64((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_vcvtd_n_f64_u64(uint64_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vcvtd_f64_u64(a) * (SIMDE_FLOAT64_C(1.0) / (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0)));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtd_n_f64_u64(a, n) vcvtd_n_f64_u64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtd_n_f64_u64
+  #define vcvtd_n_f64_u64(a, n) simde_vcvtd_n_f64_u64((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vcvt_n_s32_f32(simde_float32x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvt_s32_f32(simde_vmul_n_f32(a, HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n)));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvt_n_s32_f32(a, n) vcvt_n_s32_f32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_n_s32_f32
+  #define vcvt_n_s32_f32(a, n) simde_vcvt_n_s32_f32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vcvt_n_u32_f32(simde_float32x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvt_u32_f32(simde_vmul_n_f32(a, HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n)));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvt_n_u32_f32(a, n) vcvt_n_u32_f32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_n_u32_f32
+  #define vcvt_n_u32_f32(a, n) simde_vcvt_n_u32_f32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vcvt_n_f32_s32(simde_int32x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vmul_n_f32(simde_vcvt_f32_s32(a), SIMDE_FLOAT32_C(1.0) / HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvt_n_f32_s32(a, n) vcvt_n_f32_s32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_n_f32_s32
+  #define vcvt_n_f32_s32(a, n) simde_vcvt_n_f32_s32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vcvt_n_f32_u32(simde_uint32x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vmul_n_f32(simde_vcvt_f32_u32(a), SIMDE_FLOAT32_C(1.0) / HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvt_n_f32_u32(a, n) vcvt_n_f32_u32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvt_n_f32_u32
+  #define vcvt_n_f32_u32(a, n) simde_vcvt_n_f32_u32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vcvtq_n_s32_f32(simde_float32x4_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvtq_s32_f32(simde_vmulq_n_f32(a, HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n)));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvtq_n_s32_f32(a, n) vcvtq_n_s32_f32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_s32_f32
+  #define vcvtq_n_s32_f32(a, n) simde_vcvtq_n_s32_f32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vcvtq_n_u32_f32(simde_float32x4_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vcvtq_u32_f32(simde_vmulq_n_f32(a, HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n)));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvtq_n_u32_f32(a, n) vcvtq_n_u32_f32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_u32_f32
+  #define vcvtq_n_u32_f32(a, n) simde_vcvtq_n_u32_f32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vcvtq_n_f32_s32(simde_int32x4_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vmulq_n_f32(simde_vcvtq_f32_s32(a), SIMDE_FLOAT32_C(1.0) / HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvtq_n_f32_s32(a, n) vcvtq_n_f32_s32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_f32_s32
+  #define vcvtq_n_f32_s32(a, n) simde_vcvtq_n_f32_s32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vcvtq_n_f32_u32(simde_uint32x4_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 32) {
+  return simde_vmulq_n_f32(simde_vcvtq_f32_u32(a), SIMDE_FLOAT32_C(1.0) / HEDLEY_STATIC_CAST(simde_float32, UINT64_C(1) << n));
+}
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define simde_vcvtq_n_f32_u32(a, n) vcvtq_n_f32_u32((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_f32_u32
+  #define vcvtq_n_f32_u32(a, n) simde_vcvtq_n_f32_u32((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2_t
+simde_vcvtq_n_s64_f64(simde_float64x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vcvtq_s64_f64(simde_vmulq_n_f64(a, (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0))));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtq_n_s64_f64(a, n) vcvtq_n_s64_f64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_s64_f64
+  #define vcvtq_n_s64_f64(a, n) simde_vcvtq_n_s64_f64((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2_t
+simde_vcvtq_n_u64_f64(simde_float64x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vcvtq_u64_f64(simde_vmulq_n_f64(a, (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0))));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtq_n_u64_f64(a, n) vcvtq_n_u64_f64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_u64_f64
+  #define vcvtq_n_u64_f64(a, n) simde_vcvtq_n_u64_f64((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vcvtq_n_f64_s64(simde_int64x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vmulq_n_f64(simde_vcvtq_f64_s64(a), SIMDE_FLOAT64_C(1.0) / (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0)));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtq_n_f64_s64(a, n) vcvtq_n_f64_s64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_f64_s64
+  #define vcvtq_n_f64_s64(a, n) simde_vcvtq_n_f64_s64((a), (n))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vcvtq_n_f64_u64(simde_uint64x2_t a, const int n)
+    SIMDE_REQUIRE_CONSTANT_RANGE(n, 1, 64) {
+  return simde_vmulq_n_f64(simde_vcvtq_f64_u64(a), SIMDE_FLOAT64_C(1.0) / (HEDLEY_STATIC_CAST(simde_float64, UINT64_C(1) << (n - 1)) * SIMDE_FLOAT64_C(2.0)));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vcvtq_n_f64_u64(a, n) vcvtq_n_f64_u64((a), (n))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtq_n_f64_u64
+  #define vcvtq_n_f64_u64(a, n) simde_vcvtq_n_f64_u64((a), (n))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_CVT_N_H) */
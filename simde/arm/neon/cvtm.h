@@ -0,0 +1,211 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_CVTM_H)
+#define SIMDE_ARM_NEON_CVTM_H
+
+#include "types.h"
+#include "cvt.h"
+#include "rndm.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Conversions to integer which round toward minus infinity instead of
+ * truncating; out-of-range values saturate and NaN becomes 0, just
+ * like the vcvt family. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_vcvtms_s32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtms_s32_f32(a);
+  #else
+    return simde_vcvts_s32_f32(simde_math_floorf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtms_s32_f32
+  #define vcvtms_s32_f32(a) simde_vcvtms_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vcvtms_u32_f32(simde_float32 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtms_u32_f32(a);
+  #else
+    return simde_vcvts_u32_f32(simde_math_floorf(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtms_u32_f32
+  #define vcvtms_u32_f32(a) simde_vcvtms_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_vcvtmd_s64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtmd_s64_f64(a);
+  #else
+    return simde_vcvtd_s64_f64(simde_math_floor(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmd_s64_f64
+  #define vcvtmd_s64_f64(a) simde_vcvtmd_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_vcvtmd_u64_f64(simde_float64 a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtmd_u64_f64(a);
+  #else
+    return simde_vcvtd_u64_f64(simde_math_floor(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmd_u64_f64
+  #define vcvtmd_u64_f64(a) simde_vcvtmd_u64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vcvtm_s32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtm_s32_f32(a);
+  #else
+    return simde_vcvt_s32_f32(simde_vrndm_f32(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtm_s32_f32
+  #define vcvtm_s32_f32(a) simde_vcvtm_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vcvtm_u32_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtm_u32_f32(a);
+  #else
+    return simde_vcvt_u32_f32(simde_vrndm_f32(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtm_u32_f32
+  #define vcvtm_u32_f32(a) simde_vcvtm_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vcvtmq_s32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtmq_s32_f32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && !defined(SIMDE_X86_SSE4_1_NATIVE)
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+    simde_int32x4_private r_;
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      const __m128 clamped = _mm_max_ps(a_.m128, _mm_set1_ps(HEDLEY_STATIC_CAST(simde_float32, INT32_MIN)));
+    #else
+      const __m128 clamped = a_.m128;
+    #endif
+
+    r_.m128i = _mm_cvttps_epi32(clamped);
+
+    /* Truncation rounds negative non-integers up; step those back down. */
+    r_.m128i = _mm_add_epi32(r_.m128i, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(r_.m128i), clamped)));
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      const __m128i i32_max_mask = _mm_castps_si128(_mm_cmpge_ps(a_.m128, _mm_set1_ps(SIMDE_FLOAT32_C(2147483648.0))));
+      r_.m128i =
+        _mm_or_si128(
+          _mm_and_si128(i32_max_mask, _mm_set1_epi32(INT32_MAX)),
+          _mm_andnot_si128(i32_max_mask, r_.m128i)
+        );
+    #endif
+
+    #if !defined(SIMDE_FAST_NANS)
+      r_.m128i = _mm_and_si128(r_.m128i, _mm_castps_si128(_mm_cmpord_ps(a_.m128, a_.m128)));
+    #endif
+
+    return simde_int32x4_from_private(r_);
+  #else
+    return simde_vcvtq_s32_f32(simde_vrndmq_f32(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_s32_f32
+  #define vcvtmq_s32_f32(a) simde_vcvtmq_s32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vcvtmq_u32_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+    return vcvtmq_u32_f32(a);
+  #else
+    return simde_vcvtq_u32_f32(simde_vrndmq_f32(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_u32_f32
+  #define vcvtmq_u32_f32(a) simde_vcvtmq_u32_f32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2_t
+simde_vcvtmq_s64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtmq_s64_f64(a);
+  #else
+    return simde_vcvtq_s64_f64(simde_vrndmq_f64(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_s64_f64
+  #define vcvtmq_s64_f64(a) simde_vcvtmq_s64_f64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2_t
+simde_vcvtmq_u64_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vcvtmq_u64_f64(a);
+  #else
+    return simde_vcvtq_u64_f64(simde_vrndmq_f64(a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vcvtmq_u64_f64
+  #define vcvtmq_u64_f64(a) simde_vcvtmq_u64_f64(a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_CVTM_H) */
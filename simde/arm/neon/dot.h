@@ -50,6 +50,14 @@ simde_vdot_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b) {
     return vdot_s32(r, a, b);
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return simde_vadd_s32(r, simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(a, b)))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int32x2_private r_ = simde_int32x2_to_private(r);
+    __m128i a_ = _mm_movpi64_epi64(simde_int8x8_to_m64(a));
+    __m128i b_ = _mm_movpi64_epi64(simde_int8x8_to_m64(b));
+    __m128i even = _mm_madd_epi16(_mm_srai_epi16(_mm_slli_epi16(a_, 8), 8), _mm_srai_epi16(_mm_slli_epi16(b_, 8), 8));
+    __m128i odd = _mm_madd_epi16(_mm_srai_epi16(a_, 8), _mm_srai_epi16(b_, 8));
+    r_.m64 = _mm_movepi64_pi64(_mm_add_epi32(_mm_movpi64_epi64(r_.m64), _mm_add_epi32(even, odd)));
+    return simde_int32x2_from_private(r_);
   #else
     simde_int32x2_private r_;
     simde_int8x8_private
@@ -79,6 +87,15 @@ simde_vdot_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x8_t b) {
     return vdot_u32(r, a, b);
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return simde_vadd_u32(r, simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(a, b)))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
+    __m128i a_ = _mm_movpi64_epi64(simde_uint8x8_to_m64(a));
+    __m128i b_ = _mm_movpi64_epi64(simde_uint8x8_to_m64(b));
+    const __m128i mask = _mm_set1_epi16(0x00ff);
+    __m128i even = _mm_madd_epi16(_mm_and_si128(a_, mask), _mm_and_si128(b_, mask));
+    __m128i odd = _mm_madd_epi16(_mm_srli_epi16(a_, 8), _mm_srli_epi16(b_, 8));
+    r_.m64 = _mm_movepi64_pi64(_mm_add_epi32(_mm_movpi64_epi64(r_.m64), _mm_add_epi32(even, odd)));
+    return simde_uint32x2_from_private(r_);
   #else
     simde_uint32x2_private r_;
     simde_uint8x8_private
@@ -111,6 +128,24 @@ simde_vdotq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b) {
     return simde_vaddq_s32(r,
                            simde_vcombine_s32(simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(simde_vget_low_s8(a), simde_vget_low_s8(b))))),
                                                               simde_vmovn_s64(simde_vpaddlq_s32(simde_vpaddlq_s16(simde_vmull_s8(simde_vget_high_s8(a), simde_vget_high_s8(b)))))));
+  #elif defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    /* vpdpbusd multiplies unsigned by signed bytes; bias a into the
+     * unsigned range and subtract the 128 * sum(b) that adds. */
+    const __m128i bias = _mm_set1_epi8(HEDLEY_STATIC_CAST(char, 0x80));
+    __m128i a_ = _mm_xor_si128(simde_int8x16_to_m128i(a), bias);
+    __m128i b_ = simde_int8x16_to_m128i(b);
+    return simde_int32x4_from_m128i(
+      _mm_sub_epi32(_mm_dpbusd_epi32(simde_int32x4_to_m128i(r), a_, b_),
+                    _mm_dpbusd_epi32(_mm_setzero_si128(), bias, b_)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* pmaddubsw would need a sign fix-up which overflows for
+     * -128 * -128, so multiply the sign-extended even and odd bytes
+     * separately with pmaddwd instead. */
+    __m128i a_ = simde_int8x16_to_m128i(a);
+    __m128i b_ = simde_int8x16_to_m128i(b);
+    __m128i even = _mm_madd_epi16(_mm_srai_epi16(_mm_slli_epi16(a_, 8), 8), _mm_srai_epi16(_mm_slli_epi16(b_, 8), 8));
+    __m128i odd = _mm_madd_epi16(_mm_srai_epi16(a_, 8), _mm_srai_epi16(b_, 8));
+    return simde_int32x4_from_m128i(_mm_add_epi32(simde_int32x4_to_m128i(r), _mm_add_epi32(even, odd)));
   #else
     simde_int32x4_private r_;
     simde_int8x16_private
@@ -142,6 +177,21 @@ simde_vdotq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b) {
     return simde_vaddq_u32(r,
                            simde_vcombine_u32(simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(simde_vget_low_u8(a), simde_vget_low_u8(b))))),
                                               simde_vmovn_u64(simde_vpaddlq_u32(simde_vpaddlq_u16(simde_vmull_u8(simde_vget_high_u8(a), simde_vget_high_u8(b)))))));
+  #elif defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    /* Same trick as vdotq_s32, but biasing b into the signed range. */
+    const __m128i bias = _mm_set1_epi8(HEDLEY_STATIC_CAST(char, 0x80));
+    __m128i a_ = simde_uint8x16_to_m128i(a);
+    __m128i b_ = _mm_xor_si128(simde_uint8x16_to_m128i(b), bias);
+    return simde_uint32x4_from_m128i(
+      _mm_sub_epi32(_mm_dpbusd_epi32(simde_uint32x4_to_m128i(r), a_, b_),
+                    _mm_dpbusd_epi32(_mm_setzero_si128(), a_, bias)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i a_ = simde_uint8x16_to_m128i(a);
+    __m128i b_ = simde_uint8x16_to_m128i(b);
+    const __m128i mask = _mm_set1_epi16(0x00ff);
+    __m128i even = _mm_madd_epi16(_mm_and_si128(a_, mask), _mm_and_si128(b_, mask));
+    __m128i odd = _mm_madd_epi16(_mm_srli_epi16(a_, 8), _mm_srli_epi16(b_, 8));
+    return simde_uint32x4_from_m128i(_mm_add_epi32(simde_uint32x4_to_m128i(r), _mm_add_epi32(even, odd)));
   #else
     simde_uint32x4_private r_;
     simde_uint8x16_private
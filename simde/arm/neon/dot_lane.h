@@ -31,10 +31,13 @@
 #include "types.h"
 
 #include "add.h"
+#include "dot.h"
 #include "dup_lane.h"
+#include "dup_n.h"
 #include "paddl.h"
 #include "movn.h"
 #include "mull.h"
+#include "reinterpret.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -64,6 +67,9 @@ simde_vdot_lane_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x8_t b, const
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x2_private b_ = simde_int32x2_to_private(simde_vreinterpret_s32_s8(b));
+    result = simde_vdot_s32(r, a, simde_vreinterpret_s8_s32(simde_vdup_n_s32(b_.values[lane])));
   #else
     simde_int32x2_private r_ = simde_int32x2_to_private(r);
     simde_int8x8_private
@@ -115,6 +121,9 @@ simde_vdot_lane_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x8_t b, co
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x2_private b_ = simde_uint32x2_to_private(simde_vreinterpret_u32_u8(b));
+    result = simde_vdot_u32(r, a, simde_vreinterpret_u8_u32(simde_vdup_n_u32(b_.values[lane])));
   #else
     simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
     simde_uint8x8_private
@@ -165,6 +174,9 @@ simde_vdot_laneq_s32(simde_int32x2_t r, simde_int8x8_t a, simde_int8x16_t b, con
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private b_ = simde_int32x4_to_private(simde_vreinterpretq_s32_s8(b));
+    result = simde_vdot_s32(r, a, simde_vreinterpret_s8_s32(simde_vdup_n_s32(b_.values[lane])));
   #else
     simde_int32x2_private r_ = simde_int32x2_to_private(r);
     simde_int8x8_private a_ = simde_int8x8_to_private(a);
@@ -214,6 +226,9 @@ simde_vdot_laneq_u32(simde_uint32x2_t r, simde_uint8x8_t a, simde_uint8x16_t b,
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private b_ = simde_uint32x4_to_private(simde_vreinterpretq_u32_u8(b));
+    result = simde_vdot_u32(r, a, simde_vreinterpret_u8_u32(simde_vdup_n_u32(b_.values[lane])));
   #else
     simde_uint32x2_private r_ = simde_uint32x2_to_private(r);
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
@@ -275,6 +290,9 @@ simde_vdotq_laneq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x4_private b_ = simde_uint32x4_to_private(simde_vreinterpretq_u32_u8(b));
+    result = simde_vdotq_u32(r, a, simde_vreinterpretq_u8_u32(simde_vdupq_n_u32(b_.values[lane])));
   #else
     simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
     simde_uint8x16_private
@@ -337,6 +355,9 @@ simde_vdotq_laneq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b, c
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private b_ = simde_int32x4_to_private(simde_vreinterpretq_s32_s8(b));
+    result = simde_vdotq_s32(r, a, simde_vreinterpretq_s8_s32(simde_vdupq_n_s32(b_.values[lane])));
   #else
     simde_int32x4_private r_ = simde_int32x4_to_private(r);
     simde_int8x16_private
@@ -399,6 +420,9 @@ simde_vdotq_lane_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x8_t b,
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_uint32x2_private b_ = simde_uint32x2_to_private(simde_vreinterpret_u32_u8(b));
+    result = simde_vdotq_u32(r, a, simde_vreinterpretq_u8_u32(simde_vdupq_n_u32(b_.values[lane])));
   #else
     simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
     simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
@@ -460,6 +484,9 @@ simde_vdotq_lane_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x8_t b, con
           )
         )
       );
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x2_private b_ = simde_int32x2_to_private(simde_vreinterpret_s32_s8(b));
+    result = simde_vdotq_s32(r, a, simde_vreinterpretq_s8_s32(simde_vdupq_n_s32(b_.values[lane])));
   #else
     simde_int32x4_private r_ = simde_int32x4_to_private(r);
     simde_int8x16_private a_ = simde_int8x16_to_private(a);
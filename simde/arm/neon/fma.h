@@ -34,6 +34,102 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* The product of two binary16 values is exact in binary32, so only
+ * the addition rounds.  Rounding it to nearest and then narrowing to
+ * binary16 could round twice, so the error of the sum is recovered
+ * exactly (TwoSum) and the sum is rounded to odd instead, which is
+ * safe to narrow. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16
+simde_vfmah_f16(simde_float16 a, simde_float16 b, simde_float16 c) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vfmah_f16(a, b, c);
+  #else
+    simde_float32
+      af = simde_float16_to_float32(a),
+      p = simde_float16_to_float32(b) * simde_float16_to_float32(c),
+      s = af + p,
+      z = s - p,
+      e = (p - (s - z)) + (af - z);
+    uint32_t su = simde_float32_as_uint32(s);
+
+    if ((e != SIMDE_FLOAT32_C(0.0)) && !(su & 1) && ((su & UINT32_C(0x7f800000)) != UINT32_C(0x7f800000)))
+      su += ((su ^ simde_float32_as_uint32(e)) >> 31) ? UINT32_MAX : UINT32_C(1);
+
+    return simde_float16_from_float32(simde_uint32_as_float32(su));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfmah_f16
+  #define vfmah_f16(a, b, c) simde_vfmah_f16((a), (b), (c))
+#endif
+
+#if defined(SIMDE_X86_F16C_NATIVE)
+/* Four binary16 lanes of a + b * c, see simde_vfmah_f16. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vfma_f16_f16c_(__m128i a, __m128i b, __m128i c) {
+  __m128
+    af = _mm_cvtph_ps(a),
+    p = _mm_mul_ps(_mm_cvtph_ps(b), _mm_cvtph_ps(c)),
+    s = _mm_add_ps(af, p),
+    z = _mm_sub_ps(s, p),
+    e = _mm_add_ps(_mm_sub_ps(p, _mm_sub_ps(s, z)), _mm_sub_ps(af, z));
+  __m128i
+    si = _mm_castps_si128(s),
+    one = _mm_set1_epi32(1),
+    expmask = _mm_set1_epi32(0x7f800000),
+    keep =
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_castps_si128(_mm_cmpeq_ps(e, _mm_setzero_ps())),
+          _mm_cmpeq_epi32(_mm_and_si128(si, one), one)
+        ),
+        _mm_cmpeq_epi32(_mm_and_si128(si, expmask), expmask)
+      ),
+    step = _mm_or_si128(_mm_srai_epi32(_mm_xor_si128(si, _mm_castps_si128(e)), 31), one);
+
+  si = _mm_add_epi32(si, _mm_andnot_si128(keep, step));
+  return _mm_cvtps_ph(_mm_castsi128_ps(si), _MM_FROUND_TO_NEAREST_INT);
+}
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x4_t
+simde_vfma_f16(simde_float16x4_t a, simde_float16x4_t b, simde_float16x4_t c) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vfma_f16(a, b, c);
+  #else
+    simde_float16x4_private
+      r_,
+      a_ = simde_float16x4_to_private(a),
+      b_ = simde_float16x4_to_private(b),
+      c_ = simde_float16x4_to_private(c);
+
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      r_.m64 =
+        _mm_movepi64_pi64(
+          simde_x_vfma_f16_f16c_(
+            _mm_movpi64_epi64(a_.m64),
+            _mm_movpi64_epi64(b_.m64),
+            _mm_movpi64_epi64(c_.m64)
+          )
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vfmah_f16(a_.values[i], b_.values[i], c_.values[i]);
+      }
+    #endif
+
+    return simde_float16x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vfma_f16
+  #define vfma_f16(a, b, c) simde_vfma_f16((a), (b), (c))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_float32x2_t
 simde_vfma_f32(simde_float32x2_t a, simde_float32x2_t b, simde_float32x2_t c) {
@@ -62,6 +158,45 @@ simde_vfma_f64(simde_float64x1_t a, simde_float64x1_t b, simde_float64x1_t c) {
   #define vfma_f64(a, b, c) simde_vfma_f64(a, b, c)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x8_t
+simde_vfmaq_f16(simde_float16x8_t a, simde_float16x8_t b, simde_float16x8_t c) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vfmaq_f16(a, b, c);
+  #else
+    simde_float16x8_private
+      r_,
+      a_ = simde_float16x8_to_private(a),
+      b_ = simde_float16x8_to_private(b),
+      c_ = simde_float16x8_to_private(c);
+
+    #if defined(SIMDE_X86_F16C_NATIVE)
+      __m128i
+        ai = _mm_castps_si128(a_.m128),
+        bi = _mm_castps_si128(b_.m128),
+        ci = _mm_castps_si128(c_.m128);
+      r_.m128 =
+        _mm_castsi128_ps(
+          _mm_unpacklo_epi64(
+            simde_x_vfma_f16_f16c_(ai, bi, ci),
+            simde_x_vfma_f16_f16c_(_mm_unpackhi_epi64(ai, ai), _mm_unpackhi_epi64(bi, bi), _mm_unpackhi_epi64(ci, ci))
+          )
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vfmah_f16(a_.values[i], b_.values[i], c_.values[i]);
+      }
+    #endif
+
+    return simde_float16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vfmaq_f16
+  #define vfmaq_f16(a, b, c) simde_vfmaq_f16((a), (b), (c))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_float32x4_t
 simde_vfmaq_f32(simde_float32x4_t a, simde_float32x4_t b, simde_float32x4_t c) {
@@ -0,0 +1,165 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_FMLAL_H)
+#define SIMDE_ARM_NEON_FMLAL_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The product of two binary16 values is always exact in binary32, so
+ * multiplying and then adding only rounds once, just like FMLAL. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vfmlal_low_f16(simde_float32x2_t r, simde_float16x4_t a, simde_float16x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16) && defined(__ARM_FEATURE_FP16_FML)
+    return vfmlal_low_f16(r, a, b);
+  #else
+    simde_float32x2_private
+      ret_,
+      r_ = simde_float32x2_to_private(r);
+    simde_float16x4_private
+      a_ = simde_float16x4_to_private(a),
+      b_ = simde_float16x4_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(ret_.values) / sizeof(ret_.values[0])) ; i++) {
+      ret_.values[i] = r_.values[i] + simde_float16_to_float32(a_.values[i]) * simde_float16_to_float32(b_.values[i]);
+    }
+
+    return simde_float32x2_from_private(ret_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_FP16_FML))
+  #undef vfmlal_low_f16
+  #define vfmlal_low_f16(r, a, b) simde_vfmlal_low_f16((r), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vfmlal_high_f16(simde_float32x2_t r, simde_float16x4_t a, simde_float16x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16) && defined(__ARM_FEATURE_FP16_FML)
+    return vfmlal_high_f16(r, a, b);
+  #else
+    simde_float32x2_private
+      ret_,
+      r_ = simde_float32x2_to_private(r);
+    simde_float16x4_private
+      a_ = simde_float16x4_to_private(a),
+      b_ = simde_float16x4_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(ret_.values) / sizeof(ret_.values[0])) ; i++) {
+      ret_.values[i] = r_.values[i] + simde_float16_to_float32(a_.values[i + 2]) * simde_float16_to_float32(b_.values[i + 2]);
+    }
+
+    return simde_float32x2_from_private(ret_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_FP16_FML))
+  #undef vfmlal_high_f16
+  #define vfmlal_high_f16(r, a, b) simde_vfmlal_high_f16((r), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vfmlalq_low_f16(simde_float32x4_t r, simde_float16x8_t a, simde_float16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16) && defined(__ARM_FEATURE_FP16_FML)
+    return vfmlalq_low_f16(r, a, b);
+  #else
+    simde_float32x4_private
+      ret_,
+      r_ = simde_float32x4_to_private(r);
+    simde_float16x8_private
+      a_ = simde_float16x8_to_private(a),
+      b_ = simde_float16x8_to_private(b);
+
+    #if defined(SIMDE_X86_F16C_NATIVE)
+      ret_.m128 =
+        _mm_add_ps(
+          r_.m128,
+          _mm_mul_ps(
+            _mm_cvtph_ps(_mm_castps_si128(a_.m128)),
+            _mm_cvtph_ps(_mm_castps_si128(b_.m128))
+          )
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(ret_.values) / sizeof(ret_.values[0])) ; i++) {
+        ret_.values[i] = r_.values[i] + simde_float16_to_float32(a_.values[i]) * simde_float16_to_float32(b_.values[i]);
+      }
+    #endif
+
+    return simde_float32x4_from_private(ret_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_FP16_FML))
+  #undef vfmlalq_low_f16
+  #define vfmlalq_low_f16(r, a, b) simde_vfmlalq_low_f16((r), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vfmlalq_high_f16(simde_float32x4_t r, simde_float16x8_t a, simde_float16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16) && defined(__ARM_FEATURE_FP16_FML)
+    return vfmlalq_high_f16(r, a, b);
+  #else
+    simde_float32x4_private
+      ret_,
+      r_ = simde_float32x4_to_private(r);
+    simde_float16x8_private
+      a_ = simde_float16x8_to_private(a),
+      b_ = simde_float16x8_to_private(b);
+
+    #if defined(SIMDE_X86_F16C_NATIVE)
+      ret_.m128 =
+        _mm_add_ps(
+          r_.m128,
+          _mm_mul_ps(
+            _mm_cvtph_ps(_mm_unpackhi_epi64(_mm_castps_si128(a_.m128), _mm_castps_si128(a_.m128))),
+            _mm_cvtph_ps(_mm_unpackhi_epi64(_mm_castps_si128(b_.m128), _mm_castps_si128(b_.m128)))
+          )
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(ret_.values) / sizeof(ret_.values[0])) ; i++) {
+        ret_.values[i] = r_.values[i] + simde_float16_to_float32(a_.values[i + 4]) * simde_float16_to_float32(b_.values[i + 4]);
+      }
+    #endif
+
+    return simde_float32x4_from_private(ret_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_FP16_FML))
+  #undef vfmlalq_high_f16
+  #define vfmlalq_high_f16(r, a, b) simde_vfmlalq_high_f16((r), (a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_FMLAL_H) */
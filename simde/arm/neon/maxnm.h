@@ -35,6 +35,60 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16
+simde_vmaxnmh_f16(simde_float16 a, simde_float16 b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vmaxnmh_f16(a, b);
+  #else
+    simde_float32
+      af = simde_float16_to_float32(a),
+      bf = simde_float16_to_float32(b);
+
+    return (af >= bf || bf != bf) ? a : b;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vmaxnmh_f16
+  #define vmaxnmh_f16(a, b) simde_vmaxnmh_f16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x4_t
+simde_vmaxnm_f16(simde_float16x4_t a, simde_float16x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vmaxnm_f16(a, b);
+  #else
+    simde_float16x4_private
+      r_,
+      a_ = simde_float16x4_to_private(a),
+      b_ = simde_float16x4_to_private(b);
+
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_MMX_NATIVE) && defined(SIMDE_FAST_NANS)
+      __m128
+        af = _mm_cvtph_ps(_mm_movpi64_epi64(a_.m64)),
+        bf = _mm_cvtph_ps(_mm_movpi64_epi64(b_.m64));
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtps_ph(_mm_max_ps(af, bf), _MM_FROUND_TO_NEAREST_INT));
+    #elif defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128
+        af = _mm_cvtph_ps(_mm_movpi64_epi64(a_.m64)),
+        bf = _mm_cvtph_ps(_mm_movpi64_epi64(b_.m64));
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtps_ph(_mm_blendv_ps(bf, af, _mm_or_ps(_mm_cmp_ps(af, bf, _CMP_GE_OQ), _mm_cmp_ps(bf, bf, _CMP_UNORD_Q))), _MM_FROUND_TO_NEAREST_INT));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vmaxnmh_f16(a_.values[i], b_.values[i]);
+      }
+    #endif
+
+    return simde_float16x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vmaxnm_f16
+  #define vmaxnm_f16(a, b) simde_vmaxnm_f16((a), (b))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_float32x2_t
 simde_vmaxnm_f32(simde_float32x2_t a, simde_float32x2_t b) {
@@ -107,6 +161,42 @@ simde_vmaxnm_f64(simde_float64x1_t a, simde_float64x1_t b) {
   #define vmaxnm_f64(a, b) simde_vmaxnm_f64((a), (b))
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16x8_t
+simde_vmaxnmq_f16(simde_float16x8_t a, simde_float16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+    return vmaxnmq_f16(a, b);
+  #else
+    simde_float16x8_private
+      r_,
+      a_ = simde_float16x8_to_private(a),
+      b_ = simde_float16x8_to_private(b);
+
+    #if defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_AVX_NATIVE) && defined(SIMDE_FAST_NANS)
+      __m256
+        af = _mm256_cvtph_ps(_mm_castps_si128(a_.m128)),
+        bf = _mm256_cvtph_ps(_mm_castps_si128(b_.m128));
+      r_.m128 = _mm_castsi128_ps(_mm256_cvtps_ph(_mm256_max_ps(af, bf), _MM_FROUND_TO_NEAREST_INT));
+    #elif defined(SIMDE_X86_F16C_NATIVE) && defined(SIMDE_X86_AVX_NATIVE)
+      __m256
+        af = _mm256_cvtph_ps(_mm_castps_si128(a_.m128)),
+        bf = _mm256_cvtph_ps(_mm_castps_si128(b_.m128));
+      r_.m128 = _mm_castsi128_ps(_mm256_cvtps_ph(_mm256_blendv_ps(bf, af, _mm256_or_ps(_mm256_cmp_ps(af, bf, _CMP_GE_OQ), _mm256_cmp_ps(bf, bf, _CMP_UNORD_Q))), _MM_FROUND_TO_NEAREST_INT));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vmaxnmh_f16(a_.values[i], b_.values[i]);
+      }
+    #endif
+
+    return simde_float16x8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  #undef vmaxnmq_f16
+  #define vmaxnmq_f16(a, b) simde_vmaxnmq_f16((a), (b))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_float32x4_t
 simde_vmaxnmq_f32(simde_float32x4_t a, simde_float32x4_t b) {
@@ -0,0 +1,133 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_MAXNMV_H)
+#define SIMDE_ARM_NEON_MAXNMV_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Like vmaxnm, NaNs are only returned if every lane is a NaN. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32_t
+simde_vmaxnmv_f32(simde_float32x2_t a) {
+  simde_float32_t r;
+
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    r = vmaxnmv_f32(a);
+  #else
+    simde_float32x2_private a_ = simde_float32x2_to_private(a);
+
+    r = SIMDE_MATH_NANF;
+    for (size_t i = 0 ; i < (sizeof(a_.values) / sizeof(a_.values[0])) ; i++) {
+      r = ((a_.values[i] > r) || simde_math_isnanf(r)) ? a_.values[i] : r;
+    }
+  #endif
+
+  return r;
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vmaxnmv_f32
+  #define vmaxnmv_f32(v) simde_vmaxnmv_f32(v)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32_t
+simde_vmaxnmvq_f32(simde_float32x4_t a) {
+  simde_float32_t r;
+
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    r = vmaxnmvq_f32(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    __m128 a_ = simde_float32x4_to_m128(a);
+    __m128 b_ = _mm_movehl_ps(a_, a_);
+    #if !defined(SIMDE_FAST_NANS)
+      /* _mm_max_ps returns its second operand if either is a NaN, so only
+       * NaNs in b_ need to be replaced. */
+      __m128 bnan = _mm_cmpunord_ps(b_, b_);
+      a_ = _mm_or_ps(_mm_andnot_ps(bnan, _mm_max_ps(a_, b_)), _mm_and_ps(bnan, a_));
+      b_ = _mm_shuffle_ps(a_, a_, 1);
+      bnan = _mm_cmpunord_ps(b_, b_);
+      a_ = _mm_or_ps(_mm_andnot_ps(bnan, _mm_max_ps(a_, b_)), _mm_and_ps(bnan, a_));
+    #else
+      a_ = _mm_max_ps(a_, b_);
+      a_ = _mm_max_ss(a_, _mm_shuffle_ps(a_, a_, 1));
+    #endif
+    r = _mm_cvtss_f32(a_);
+  #else
+    simde_float32x4_private a_ = simde_float32x4_to_private(a);
+
+    r = SIMDE_MATH_NANF;
+    for (size_t i = 0 ; i < (sizeof(a_.values) / sizeof(a_.values[0])) ; i++) {
+      r = ((a_.values[i] > r) || simde_math_isnanf(r)) ? a_.values[i] : r;
+    }
+  #endif
+
+  return r;
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vmaxnmvq_f32
+  #define vmaxnmvq_f32(v) simde_vmaxnmvq_f32(v)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64_t
+simde_vmaxnmvq_f64(simde_float64x2_t a) {
+  simde_float64_t r;
+
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    r = vmaxnmvq_f64(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128d a_ = simde_float64x2_to_m128d(a);
+    __m128d b_ = _mm_unpackhi_pd(a_, a_);
+    #if !defined(SIMDE_FAST_NANS)
+      __m128d bnan = _mm_cmpunord_pd(b_, b_);
+      a_ = _mm_or_pd(_mm_andnot_pd(bnan, _mm_max_sd(a_, b_)), _mm_and_pd(bnan, a_));
+    #else
+      a_ = _mm_max_sd(a_, b_);
+    #endif
+    r = _mm_cvtsd_f64(a_);
+  #else
+    simde_float64x2_private a_ = simde_float64x2_to_private(a);
+
+    r = SIMDE_MATH_NAN;
+    for (size_t i = 0 ; i < (sizeof(a_.values) / sizeof(a_.values[0])) ; i++) {
+      r = ((a_.values[i] > r) || simde_math_isnan(r)) ? a_.values[i] : r;
+    }
+  #endif
+
+  return r;
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vmaxnmvq_f64
+  #define vmaxnmvq_f64(v) simde_vmaxnmvq_f64(v)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_MAXNMV_H) */
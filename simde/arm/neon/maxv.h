@@ -65,6 +65,13 @@ simde_vmaxv_s8(simde_int8x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxv_s8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_int8x8_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi8('\x7f'));
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int8_t, HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(a_)) ^ 0x7f);
   #else
     simde_int8x8_private a_ = simde_int8x8_to_private(a);
 
@@ -89,6 +96,12 @@ simde_vmaxv_s16(simde_int16x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxv_s16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_int16x4_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi16(INT16_MAX));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int16_t, HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(a_)) ^ INT16_MAX);
   #else
     simde_int16x4_private a_ = simde_int16x4_to_private(a);
 
@@ -137,6 +150,13 @@ simde_vmaxv_u8(simde_uint8x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxv_u8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_uint8x8_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi8('\xff'));
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint8_t, ~_mm_cvtsi128_si32(a_));
   #else
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
 
@@ -161,6 +181,12 @@ simde_vmaxv_u16(simde_uint16x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxv_u16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_uint16x4_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, UINT16_MAX)));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint16_t, ~_mm_cvtsi128_si32(a_));
   #else
     simde_uint16x4_private a_ = simde_uint16x4_to_private(a);
 
@@ -209,6 +235,11 @@ simde_vmaxvq_f32(simde_float32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxvq_f32(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE) && defined(SIMDE_FAST_NANS)
+    __m128 a_ = simde_float32x4_to_m128(a);
+    a_ = _mm_max_ps(a_, _mm_movehl_ps(a_, a_));
+    a_ = _mm_max_ss(a_, _mm_shuffle_ps(a_, a_, 1));
+    r = _mm_cvtss_f32(a_);
   #else
     simde_float32x4_private a_ = simde_float32x4_to_private(a);
 
@@ -257,6 +288,12 @@ simde_vmaxvq_s8(simde_int8x16_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxvq_s8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_int8x16_to_m128i(a);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi8('\x7f'));
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int8_t, HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(a_)) ^ 0x7f);
   #else
     simde_int8x16_private a_ = simde_int8x16_to_private(a);
 
@@ -281,6 +318,11 @@ simde_vmaxvq_s16(simde_int16x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxvq_s16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_int16x8_to_m128i(a);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi16(INT16_MAX));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int16_t, HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(a_)) ^ INT16_MAX);
   #else
     simde_int16x8_private a_ = simde_int16x8_to_private(a);
 
@@ -305,6 +347,11 @@ simde_vmaxvq_s32(simde_int32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxvq_s32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_int32x4_to_m128i(a);
+    a_ = _mm_max_epi32(a_, _mm_shuffle_epi32(a_, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+    a_ = _mm_max_epi32(a_, _mm_shuffle_epi32(a_, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+    r = HEDLEY_STATIC_CAST(int32_t, _mm_cvtsi128_si32(a_));
   #else
     simde_int32x4_private a_ = simde_int32x4_to_private(a);
 
@@ -329,6 +376,12 @@ simde_vmaxvq_u8(simde_uint8x16_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxvq_u8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_uint8x16_to_m128i(a);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi8('\xff'));
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint8_t, ~_mm_cvtsi128_si32(a_));
   #else
     simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
 
@@ -353,6 +406,11 @@ simde_vmaxvq_u16(simde_uint16x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxvq_u16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_uint16x8_to_m128i(a);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, UINT16_MAX)));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint16_t, ~_mm_cvtsi128_si32(a_));
   #else
     simde_uint16x8_private a_ = simde_uint16x8_to_private(a);
 
@@ -377,6 +435,11 @@ simde_vmaxvq_u32(simde_uint32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vmaxvq_u32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_uint32x4_to_m128i(a);
+    a_ = _mm_max_epu32(a_, _mm_shuffle_epi32(a_, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+    a_ = _mm_max_epu32(a_, _mm_shuffle_epi32(a_, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+    r = HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint32x4_private a_ = simde_uint32x4_to_private(a);
 
@@ -73,6 +73,13 @@ simde_vminv_s8(simde_int8x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminv_s8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_int8x8_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi8('\x80'));
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int8_t, HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(a_)) ^ 0x80);
   #else
     simde_int8x8_private a_ = simde_int8x8_to_private(a);
 
@@ -97,6 +104,12 @@ simde_vminv_s16(simde_int16x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminv_s16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_int16x4_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi16(INT16_MIN));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int16_t, HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(a_)) ^ INT16_MIN);
   #else
     simde_int16x4_private a_ = simde_int16x4_to_private(a);
 
@@ -145,6 +158,12 @@ simde_vminv_u8(simde_uint8x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminv_u8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_uint8x8_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint8x8_private a_ = simde_uint8x8_to_private(a);
 
@@ -169,6 +188,11 @@ simde_vminv_u16(simde_uint16x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminv_u16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    __m128i a_ = _mm_movpi64_epi64(simde_uint16x4_to_m64(a));
+    a_ = _mm_unpacklo_epi64(a_, a_);
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint16x4_private a_ = simde_uint16x4_to_private(a);
 
@@ -217,6 +241,11 @@ simde_vminvq_f32(simde_float32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminvq_f32(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE) && defined(SIMDE_FAST_NANS)
+    __m128 a_ = simde_float32x4_to_m128(a);
+    a_ = _mm_min_ps(a_, _mm_movehl_ps(a_, a_));
+    a_ = _mm_min_ss(a_, _mm_shuffle_ps(a_, a_, 1));
+    r = _mm_cvtss_f32(a_);
   #else
     simde_float32x4_private a_ = simde_float32x4_to_private(a);
 
@@ -281,6 +310,12 @@ simde_vminvq_s8(simde_int8x16_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminvq_s8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_int8x16_to_m128i(a);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi8('\x80'));
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int8_t, HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(a_)) ^ 0x80);
   #else
     simde_int8x16_private a_ = simde_int8x16_to_private(a);
 
@@ -305,6 +340,11 @@ simde_vminvq_s16(simde_int16x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminvq_s16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_int16x8_to_m128i(a);
+    a_ = _mm_xor_si128(a_, _mm_set1_epi16(INT16_MIN));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(int16_t, HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(a_)) ^ INT16_MIN);
   #else
     simde_int16x8_private a_ = simde_int16x8_to_private(a);
 
@@ -329,6 +369,11 @@ simde_vminvq_s32(simde_int32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminvq_s32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_int32x4_to_m128i(a);
+    a_ = _mm_min_epi32(a_, _mm_shuffle_epi32(a_, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+    a_ = _mm_min_epi32(a_, _mm_shuffle_epi32(a_, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+    r = HEDLEY_STATIC_CAST(int32_t, _mm_cvtsi128_si32(a_));
   #else
     simde_int32x4_private a_ = simde_int32x4_to_private(a);
 
@@ -353,6 +398,11 @@ simde_vminvq_u8(simde_uint8x16_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminvq_u8(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_uint8x16_to_m128i(a);
+    a_ = _mm_min_epu8(a_, _mm_srli_epi16(a_, 8));
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint8_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
 
@@ -377,6 +427,10 @@ simde_vminvq_u16(simde_uint16x8_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminvq_u16(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_uint16x8_to_m128i(a);
+    a_ = _mm_minpos_epu16(a_);
+    r = HEDLEY_STATIC_CAST(uint16_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint16x8_private a_ = simde_uint16x8_to_private(a);
 
@@ -401,6 +455,11 @@ simde_vminvq_u32(simde_uint32x4_t a) {
 
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r = vminvq_u32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    __m128i a_ = simde_uint32x4_to_m128i(a);
+    a_ = _mm_min_epu32(a_, _mm_shuffle_epi32(a_, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+    a_ = _mm_min_epu32(a_, _mm_shuffle_epi32(a_, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+    r = HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(a_));
   #else
     simde_uint32x4_private a_ = simde_uint32x4_to_private(a);
 
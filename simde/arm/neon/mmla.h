@@ -0,0 +1,163 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_MMLA_H)
+#define SIMDE_ARM_NEON_MMLA_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* r is a row-major 2x2 matrix, a is 2x8 and b holds the columns of an
+ * 8x2 matrix, so element (i, j) is the dot product of row i of a and
+ * row j of b.
+ *
+ * On x86 the rows are widened to 16 bits so that pmaddwd gives exact
+ * pair sums (pmaddubsw would saturate) and two levels of phaddd reduce
+ * each row product to one lane; with VNNI the u8 x s8 variant uses
+ * vpdpbusd on 32-bit lanes shuffled so each accumulator lane sees the
+ * matching halves of its row of a and b. */
+
+#if defined(SIMDE_X86_SSE4_1_NATIVE)
+  #define SIMDE_ARM_NEON_MMLA_X86_SUM_(a0, a1, b0, b1) \
+    _mm_hadd_epi32( \
+      _mm_hadd_epi32(_mm_madd_epi16(a0, b0), _mm_madd_epi16(a0, b1)), \
+      _mm_hadd_epi32(_mm_madd_epi16(a1, b0), _mm_madd_epi16(a1, b1)))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vmmlaq_s32(simde_int32x4_t r, simde_int8x16_t a, simde_int8x16_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+    return vmmlaq_s32(r, a, b);
+  #else
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_int8x16_private
+      a_ = simde_int8x16_to_private(a),
+      b_ = simde_int8x16_to_private(b);
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i = _mm_add_epi32(r_.m128i,
+        SIMDE_ARM_NEON_MMLA_X86_SUM_(
+          _mm_cvtepi8_epi16(a_.m128i), _mm_cvtepi8_epi16(_mm_srli_si128(a_.m128i, 8)),
+          _mm_cvtepi8_epi16(b_.m128i), _mm_cvtepi8_epi16(_mm_srli_si128(b_.m128i, 8))));
+    #else
+      for (size_t i = 0 ; i < 4 ; i++) {
+        const size_t row = (i >> 1) * 8, col = (i & 1) * 8;
+        int32_t acc = 0;
+        SIMDE_VECTORIZE_REDUCTION(+:acc)
+        for (size_t k = 0 ; k < 8 ; k++) {
+          acc += HEDLEY_STATIC_CAST(int32_t, a_.values[row + k]) * HEDLEY_STATIC_CAST(int32_t, b_.values[col + k]);
+        }
+        r_.values[i] += acc;
+      }
+    #endif
+
+    return simde_int32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_MATMUL_INT8))
+  #undef vmmlaq_s32
+  #define vmmlaq_s32(r, a, b) simde_vmmlaq_s32((r), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vmmlaq_u32(simde_uint32x4_t r, simde_uint8x16_t a, simde_uint8x16_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+    return vmmlaq_u32(r, a, b);
+  #else
+    simde_uint32x4_private r_ = simde_uint32x4_to_private(r);
+    simde_uint8x16_private
+      a_ = simde_uint8x16_to_private(a),
+      b_ = simde_uint8x16_to_private(b);
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i = _mm_add_epi32(r_.m128i,
+        SIMDE_ARM_NEON_MMLA_X86_SUM_(
+          _mm_cvtepu8_epi16(a_.m128i), _mm_cvtepu8_epi16(_mm_srli_si128(a_.m128i, 8)),
+          _mm_cvtepu8_epi16(b_.m128i), _mm_cvtepu8_epi16(_mm_srli_si128(b_.m128i, 8))));
+    #else
+      for (size_t i = 0 ; i < 4 ; i++) {
+        const size_t row = (i >> 1) * 8, col = (i & 1) * 8;
+        uint32_t acc = 0;
+        SIMDE_VECTORIZE_REDUCTION(+:acc)
+        for (size_t k = 0 ; k < 8 ; k++) {
+          acc += HEDLEY_STATIC_CAST(uint32_t, a_.values[row + k]) * HEDLEY_STATIC_CAST(uint32_t, b_.values[col + k]);
+        }
+        r_.values[i] += acc;
+      }
+    #endif
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_MATMUL_INT8))
+  #undef vmmlaq_u32
+  #define vmmlaq_u32(r, a, b) simde_vmmlaq_u32((r), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vusmmlaq_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x16_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+    return vusmmlaq_s32(r, a, b);
+  #else
+    simde_int32x4_private r_ = simde_int32x4_to_private(r);
+    simde_uint8x16_private a_ = simde_uint8x16_to_private(a);
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+
+    #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r_.m128i = _mm_dpbusd_epi32(r_.m128i, _mm_shuffle_epi32(a_.m128i, 0xa0), _mm_shuffle_epi32(b_.m128i, 0x88));
+      r_.m128i = _mm_dpbusd_epi32(r_.m128i, _mm_shuffle_epi32(a_.m128i, 0xf5), _mm_shuffle_epi32(b_.m128i, 0xdd));
+    #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i = _mm_add_epi32(r_.m128i,
+        SIMDE_ARM_NEON_MMLA_X86_SUM_(
+          _mm_cvtepu8_epi16(a_.m128i), _mm_cvtepu8_epi16(_mm_srli_si128(a_.m128i, 8)),
+          _mm_cvtepi8_epi16(b_.m128i), _mm_cvtepi8_epi16(_mm_srli_si128(b_.m128i, 8))));
+    #else
+      for (size_t i = 0 ; i < 4 ; i++) {
+        const size_t row = (i >> 1) * 8, col = (i & 1) * 8;
+        int32_t acc = 0;
+        SIMDE_VECTORIZE_REDUCTION(+:acc)
+        for (size_t k = 0 ; k < 8 ; k++) {
+          acc += HEDLEY_STATIC_CAST(int32_t, a_.values[row + k]) * HEDLEY_STATIC_CAST(int32_t, b_.values[col + k]);
+        }
+        r_.values[i] += acc;
+      }
+    #endif
+
+    return simde_int32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_MATMUL_INT8))
+  #undef vusmmlaq_s32
+  #define vusmmlaq_s32(r, a, b) simde_vusmmlaq_s32((r), (a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_MMLA_H) */
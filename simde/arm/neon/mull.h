@@ -230,6 +230,35 @@ simde_vmull_u32(simde_uint32x2_t a, simde_uint32x2_t b) {
   #define vmull_u32(a, b) simde_vmull_u32((a), (b))
 #endif
 
+#if defined(SIMDE_HAVE_INT128_)
+SIMDE_FUNCTION_ATTRIBUTES
+simde_poly128_t
+simde_vmull_p64(simde_poly64_t a, simde_poly64_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vmull_p64(a, b);
+  #elif defined(SIMDE_X86_PCLMUL_NATIVE)
+    __m128i r = _mm_clmulepi64_si128(
+      _mm_set_epi64x(0, HEDLEY_STATIC_CAST(int64_t, a)),
+      _mm_set_epi64x(0, HEDLEY_STATIC_CAST(int64_t, b)),
+      0x00);
+    simde_poly128_t r_;
+    simde_memcpy(&r_, &r, sizeof(r_));
+    return r_;
+  #else
+    /* Carry-less multiply without data-dependent branches. */
+    simde_poly128_t r_ = 0;
+    for (int i = 0 ; i < 64 ; i++) {
+      r_ ^= (HEDLEY_STATIC_CAST(simde_poly128_t, a) << i) & (0 - HEDLEY_STATIC_CAST(simde_poly128_t, (b >> i) & 1));
+    }
+    return r_;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vmull_p64
+  #define vmull_p64(a, b) simde_vmull_p64((a), (b))
+#endif
+#endif /* defined(SIMDE_HAVE_INT128_) */
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
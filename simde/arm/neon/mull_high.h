@@ -30,6 +30,8 @@
 #include "types.h"
 #include "mul.h"
 #include "movl_high.h"
+#include "mull.h"
+#include "reinterpret.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -119,6 +121,35 @@ simde_vmull_high_u32(simde_uint32x4_t a, simde_uint32x4_t b) {
   #define vmull_high_u32(a, b) simde_vmull_high_u32((a), (b))
 #endif
 
+#if defined(SIMDE_HAVE_INT128_)
+SIMDE_FUNCTION_ATTRIBUTES
+simde_poly128_t
+simde_vmull_high_p64(simde_poly64x2_t a, simde_poly64x2_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vmull_high_p64(a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return simde_vmull_p64(vgetq_lane_p64(a, 1), vgetq_lane_p64(b, 1));
+  #else
+    simde_uint64x2_private
+      a_ = simde_uint64x2_to_private(a),
+      b_ = simde_uint64x2_to_private(b);
+
+    #if defined(SIMDE_X86_PCLMUL_NATIVE)
+      __m128i r = _mm_clmulepi64_si128(a_.m128i, b_.m128i, 0x11);
+      simde_poly128_t r_;
+      simde_memcpy(&r_, &r, sizeof(r_));
+      return r_;
+    #else
+      return simde_vmull_p64(a_.values[1], b_.values[1]);
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vmull_high_p64
+  #define vmull_high_p64(a, b) simde_vmull_high_p64((a), (b))
+#endif
+#endif /* defined(SIMDE_HAVE_INT128_) */
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -63,12 +63,12 @@ simde_vqdmulls_s32(int32_t a, int32_t b) {
     return vqdmulls_s32(a, b);
   #else
     int64_t mul = (HEDLEY_STATIC_CAST(int64_t, a) * HEDLEY_STATIC_CAST(int64_t, b));
-    return ((a > 0 ? a : -a) & (HEDLEY_STATIC_CAST(int64_t, 1) << 62)) ? ((mul < 0) ? INT64_MIN : INT64_MAX) : mul << 1;
+    return (simde_math_llabs(mul) & (HEDLEY_STATIC_CAST(int64_t, 1) << 62)) ? ((mul < 0) ? INT64_MIN : INT64_MAX) : mul << 1;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
-  #undef vqdmulls_s16
-  #define vqdmulls_s16(a, b) simde_vqdmulls_s16((a), (b))
+  #undef vqdmulls_s32
+  #define vqdmulls_s32(a, b) simde_vqdmulls_s32((a), (b))
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -90,6 +90,21 @@ simde_vqdmull_s16(simde_int16x4_t a, simde_int16x4_t b) {
     r_.v128 = wasm_v128_bitselect(wasm_i32x4_splat(INT32_MIN), r_.v128, uflow);
     r_.v128 = wasm_v128_bitselect(wasm_i32x4_splat(INT32_MAX), r_.v128, oflow);
 
+    return simde_int32x4_from_private(r_);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    simde_int32x4_private r_;
+    simde_int16x8_private v_ = simde_int16x8_to_private(simde_vcombine_s16(a, b));
+
+    /* madd of the duplicated lanes yields 2 * a * b directly; the only
+     * product which doesn't fit is INT16_MIN * INT16_MIN, which wraps
+     * to INT32_MIN and is flipped to INT32_MAX. */
+    r_.m128i =
+      _mm_madd_epi16(
+        _mm_unpacklo_epi16(v_.m128i, v_.m128i),
+        _mm_unpackhi_epi16(v_.m128i, v_.m128i)
+      );
+    r_.m128i = _mm_xor_si128(r_.m128i, _mm_cmpeq_epi32(r_.m128i, _mm_set1_epi32(INT32_MIN)));
+
     return simde_int32x4_from_private(r_);
   #else
     simde_int32x4_private r_;
@@ -129,6 +144,17 @@ simde_vqdmull_s32(simde_int32x2_t a, simde_int32x2_t b) {
     r_.v128 = wasm_v128_bitselect(wasm_i64x2_splat(INT64_MIN), r_.v128, uflow);
     r_.v128 = wasm_v128_bitselect(wasm_i64x2_splat(INT64_MAX), r_.v128, oflow);
 
+    return simde_int64x2_from_private(r_);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+    simde_int64x2_private r_;
+    simde_int32x4_private v_ = simde_int32x4_to_private(simde_vcombine_s32(a, b));
+
+    const __m128i lo = _mm_unpacklo_epi32(v_.m128i, v_.m128i);
+    const __m128i hi = _mm_unpackhi_epi32(v_.m128i, v_.m128i);
+    const __m128i product = _mm_mul_epi32(lo, hi);
+    r_.m128i = _mm_add_epi64(product, product);
+    r_.m128i = _mm_xor_si128(r_.m128i, _mm_cmpeq_epi64(r_.m128i, _mm_set1_epi64x(INT64_MIN)));
+
     return simde_int64x2_from_private(r_);
   #else
     simde_int64x2_private r_;
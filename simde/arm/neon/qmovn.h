@@ -128,6 +128,13 @@ simde_int8x8_t
 simde_vqmovn_s16(simde_int16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_s16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int8x8_private r_;
+    simde_int16x8_private a_ = simde_int16x8_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(_mm_packs_epi16(a_.m128i, a_.m128i));
+
+    return simde_int8x8_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_s16(simde_vmaxq_s16(simde_vdupq_n_s16(INT8_MIN), simde_vminq_s16(simde_vdupq_n_s16(INT8_MAX), a)));
   #else
@@ -152,6 +159,13 @@ simde_int16x4_t
 simde_vqmovn_s32(simde_int32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_s32(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int16x4_private r_;
+    simde_int32x4_private a_ = simde_int32x4_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(_mm_packs_epi32(a_.m128i, a_.m128i));
+
+    return simde_int16x4_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_s32(simde_vmaxq_s32(simde_vdupq_n_s32(INT16_MIN), simde_vminq_s32(simde_vdupq_n_s32(INT16_MAX), a)));
   #else
@@ -176,6 +190,21 @@ simde_int32x2_t
 simde_vqmovn_s64(simde_int64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_s64(a);
+  #elif (defined(SIMDE_X86_AVX512VL_NATIVE) || defined(SIMDE_X86_SSE4_2_NATIVE)) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_int32x2_private r_;
+    simde_int64x2_private a_ = simde_int64x2_to_private(a);
+
+    #if defined(SIMDE_X86_AVX512VL_NATIVE)
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtsepi64_epi32(a_.m128i));
+    #else
+      const __m128i max = _mm_set1_epi64x(INT32_MAX);
+      const __m128i min = _mm_set1_epi64x(INT32_MIN);
+      __m128i r128 = _mm_blendv_epi8(a_.m128i, max, _mm_cmpgt_epi64(a_.m128i, max));
+      r128 = _mm_blendv_epi8(r128, min, _mm_cmpgt_epi64(min, r128));
+      r_.m64 = _mm_movepi64_pi64(_mm_shuffle_epi32(r128, (2 << 2) | 0));
+    #endif
+
+    return simde_int32x2_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_s64(simde_x_vmaxq_s64(simde_vdupq_n_s64(INT32_MIN), simde_x_vminq_s64(simde_vdupq_n_s64(INT32_MAX), a)));
   #else
@@ -200,6 +229,20 @@ simde_uint8x8_t
 simde_vqmovn_u16(simde_uint16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_u16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint8x8_private r_;
+    simde_uint16x8_private a_ = simde_uint16x8_to_private(a);
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      __m128i r128 = _mm_min_epu16(a_.m128i, _mm_set1_epi16(UINT8_MAX));
+    #else
+      /* Unsigned saturating add/sub clamps to UINT8_MAX without SSE4.1's min_epu16. */
+      const __m128i high = _mm_set1_epi16(~INT16_C(0x00ff));
+      __m128i r128 = _mm_subs_epu16(_mm_adds_epu16(a_.m128i, high), high);
+    #endif
+    r_.m64 = _mm_movepi64_pi64(_mm_packus_epi16(r128, r128));
+
+    return simde_uint8x8_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u16(simde_vminq_u16(a, simde_vdupq_n_u16(UINT8_MAX)));
   #else
@@ -224,6 +267,14 @@ simde_uint16x4_t
 simde_vqmovn_u32(simde_uint32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_u32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint16x4_private r_;
+    simde_uint32x4_private a_ = simde_uint32x4_to_private(a);
+
+    __m128i r128 = _mm_min_epu32(a_.m128i, _mm_set1_epi32(UINT16_MAX));
+    r_.m64 = _mm_movepi64_pi64(_mm_packus_epi32(r128, r128));
+
+    return simde_uint16x4_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u32(simde_vminq_u32(a, simde_vdupq_n_u32(UINT16_MAX)));
   #else
@@ -248,6 +299,19 @@ simde_uint32x2_t
 simde_vqmovn_u64(simde_uint64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovn_u64(a);
+  #elif (defined(SIMDE_X86_AVX512VL_NATIVE) || defined(SIMDE_X86_SSE4_2_NATIVE)) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint32x2_private r_;
+    simde_uint64x2_private a_ = simde_uint64x2_to_private(a);
+
+    #if defined(SIMDE_X86_AVX512VL_NATIVE)
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtusepi64_epi32(a_.m128i));
+    #else
+      const __m128i sign = _mm_set1_epi64x(INT64_MIN);
+      __m128i gt = _mm_cmpgt_epi64(_mm_xor_si128(a_.m128i, sign), _mm_xor_si128(_mm_set1_epi64x(UINT32_MAX), sign));
+      r_.m64 = _mm_movepi64_pi64(_mm_shuffle_epi32(_mm_or_si128(a_.m128i, gt), (2 << 2) | 0));
+    #endif
+
+    return simde_uint32x2_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u64(simde_x_vminq_u64(a, simde_vdupq_n_u64(UINT32_MAX)));
   #else
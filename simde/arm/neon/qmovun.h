@@ -85,6 +85,13 @@ simde_uint8x8_t
 simde_vqmovun_s16(simde_int16x8_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovun_s16(a);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint8x8_private r_;
+    simde_int16x8_private a_ = simde_int16x8_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(_mm_packus_epi16(a_.m128i, a_.m128i));
+
+    return simde_uint8x8_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u16(simde_vreinterpretq_u16_s16(simde_vmaxq_s16(simde_vdupq_n_s16(0), simde_vminq_s16(simde_vdupq_n_s16(UINT8_MAX), a))));
   #else
@@ -109,6 +116,13 @@ simde_uint16x4_t
 simde_vqmovun_s32(simde_int32x4_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovun_s32(a);
+  #elif defined(SIMDE_X86_SSE4_1_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint16x4_private r_;
+    simde_int32x4_private a_ = simde_int32x4_to_private(a);
+
+    r_.m64 = _mm_movepi64_pi64(_mm_packus_epi32(a_.m128i, a_.m128i));
+
+    return simde_uint16x4_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u32(simde_vreinterpretq_u32_s32(simde_vmaxq_s32(simde_vdupq_n_s32(0), simde_vminq_s32(simde_vdupq_n_s32(UINT16_MAX), a))));
   #else
@@ -133,6 +147,19 @@ simde_uint32x2_t
 simde_vqmovun_s64(simde_int64x2_t a) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vqmovun_s64(a);
+  #elif (defined(SIMDE_X86_AVX512VL_NATIVE) || defined(SIMDE_X86_SSE4_2_NATIVE)) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint32x2_private r_;
+    simde_int64x2_private a_ = simde_int64x2_to_private(a);
+
+    #if defined(SIMDE_X86_AVX512VL_NATIVE)
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtusepi64_epi32(_mm_max_epi64(a_.m128i, _mm_setzero_si128())));
+    #else
+      __m128i r128 = _mm_andnot_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), a_.m128i), a_.m128i);
+      r128 = _mm_or_si128(r128, _mm_cmpgt_epi64(r128, _mm_set1_epi64x(UINT32_MAX)));
+      r_.m64 = _mm_movepi64_pi64(_mm_shuffle_epi32(r128, (2 << 2) | 0));
+    #endif
+
+    return simde_uint32x2_from_private(r_);
   #elif SIMDE_NATURAL_VECTOR_SIZE > 0
     return simde_vmovn_u64(simde_vreinterpretq_u64_s64(simde_x_vmaxq_s64(simde_vdupq_n_s64(0), simde_x_vminq_s64(simde_vdupq_n_s64(UINT32_MAX), a))));
   #else
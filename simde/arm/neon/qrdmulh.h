@@ -40,7 +40,9 @@ simde_vqrdmulhh_s16(int16_t a, int16_t b) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vqrdmulhh_s16(a, b);
   #else
-    return HEDLEY_STATIC_CAST(int16_t, (((1 << 15) + ((HEDLEY_STATIC_CAST(int32_t, (HEDLEY_STATIC_CAST(int32_t, a) * HEDLEY_STATIC_CAST(int32_t, b)))) << 1)) >> 16) & 0xffff);
+    /* Only INT16_MIN * INT16_MIN can overflow once doubled. */
+    int32_t temp = HEDLEY_STATIC_CAST(int32_t, a) * HEDLEY_STATIC_CAST(int32_t, b);
+    return (temp == (INT32_C(1) << 30)) ? INT16_MAX : HEDLEY_STATIC_CAST(int16_t, ((temp * 2) + (1 << 15)) >> 16);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -54,7 +56,8 @@ simde_vqrdmulhs_s32(int32_t a, int32_t b) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vqrdmulhs_s32(a, b);
   #else
-    return HEDLEY_STATIC_CAST(int32_t, (((HEDLEY_STATIC_CAST(int64_t, 1) << 31) + ((HEDLEY_STATIC_CAST(int64_t, (HEDLEY_STATIC_CAST(int64_t, a) * HEDLEY_STATIC_CAST(int64_t, b)))) << 1)) >> 32) & 0xffffffff);
+    int64_t temp = HEDLEY_STATIC_CAST(int64_t, a) * HEDLEY_STATIC_CAST(int64_t, b);
+    return (temp == (INT64_C(1) << 62)) ? INT32_MAX : HEDLEY_STATIC_CAST(int32_t, ((temp * 2) + (INT64_C(1) << 31)) >> 32);
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -127,7 +130,7 @@ simde_vqrdmulhq_s16(simde_int16x8_t a, simde_int16x8_t b) {
       r_.neon_i16 = vqrdmulhq_s16(a_.neon_i16, b_.neon_i16);
     #elif defined(SIMDE_X86_SSSE3_NATIVE)
       __m128i y = _mm_mulhrs_epi16(a_.m128i, b_.m128i);
-      __m128i tmp = _mm_cmpeq_epi16(y, _mm_set1_epi16(INT16_MAX));
+      __m128i tmp = _mm_cmpeq_epi16(y, _mm_set1_epi16(INT16_MIN));
       r_.m128i = _mm_xor_si128(y, tmp);
     #elif defined(SIMDE_X86_SSE2_NATIVE)
       const __m128i prod_lo = _mm_mullo_epi16(a_.m128i, b_.m128i);
@@ -143,7 +146,7 @@ simde_vqrdmulhq_s16(simde_int16x8_t a, simde_int16x8_t b) {
       r_.m128i =
         _mm_xor_si128(
           tmp,
-          _mm_cmpeq_epi16(_mm_set1_epi16(INT16_MAX), tmp)
+          _mm_cmpeq_epi16(_mm_set1_epi16(INT16_MIN), tmp)
         );
     #else
       SIMDE_VECTORIZE
@@ -187,12 +187,12 @@ simde_vqshlb_u8(uint8_t a, int8_t b) {
   #else
     uint8_t r;
 
-    if (b < -7)
-      b = -7;
+    if (b < -8)
+      b = -8;
 
     if (b <= 0) {
       r = a >> -b;
-    } else if (b < 7) {
+    } else if (b < 8) {
       r = HEDLEY_STATIC_CAST(uint8_t, a << b);
       if ((r >> b) != a) {
         r = UINT8_MAX;
@@ -227,15 +227,16 @@ simde_vqshlh_u16(uint16_t a, int16_t b) {
     #endif
   #else
     uint16_t r;
+    int8_t b8 = HEDLEY_STATIC_CAST(int8_t, b);
 
-    if (b < -15)
-      b = -15;
+    if (b8 < -16)
+      b8 = -16;
 
-    if (b <= 0) {
-      r = a >> -b;
-    } else if (b < 15) {
-      r = HEDLEY_STATIC_CAST(uint16_t, a << b);
-      if ((r >> b) != a) {
+    if (b8 <= 0) {
+      r = a >> -b8;
+    } else if (b8 < 16) {
+      r = HEDLEY_STATIC_CAST(uint16_t, a << b8);
+      if ((r >> b8) != a) {
         r = UINT16_MAX;
       }
     } else if (a == 0) {
@@ -268,15 +269,15 @@ simde_vqshls_u32(uint32_t a, int32_t b) {
     #endif
   #else
     uint32_t r;
+    int8_t b8 = HEDLEY_STATIC_CAST(int8_t, b);
 
-    if (b < -31)
-      b = -31;
-
-    if (b <= 0) {
-      r = HEDLEY_STATIC_CAST(uint32_t, a >> -b);
-    } else if (b < 31) {
-      r = a << b;
-      if ((r >> b) != a) {
+    if (b8 <= -32) {
+      r = 0;
+    } else if (b8 <= 0) {
+      r = HEDLEY_STATIC_CAST(uint32_t, a >> -b8);
+    } else if (b8 < 32) {
+      r = a << b8;
+      if ((r >> b8) != a) {
         r = UINT32_MAX;
       }
     } else if (a == 0) {
@@ -309,15 +310,15 @@ simde_vqshld_u64(uint64_t a, int64_t b) {
     #endif
   #else
     uint64_t r;
+    int8_t b8 = HEDLEY_STATIC_CAST(int8_t, b);
 
-    if (b < -63)
-      b = -63;
-
-    if (b <= 0) {
-      r = a >> -b;
-    } else if (b < 63) {
-      r = HEDLEY_STATIC_CAST(uint64_t, a << b);
-      if ((r >> b) != a) {
+    if (b8 <= -64) {
+      r = 0;
+    } else if (b8 <= 0) {
+      r = a >> -b8;
+    } else if (b8 < 64) {
+      r = a << b8;
+      if ((r >> b8) != a) {
         r = UINT64_MAX;
       }
     } else if (a == 0) {
@@ -345,10 +346,19 @@ simde_vqshl_s8 (const simde_int8x8_t a, const simde_int8x8_t b) {
       a_ = simde_int8x8_to_private(a),
       b_ = simde_int8x8_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlb_s8(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i a128 = _mm_cvtepi8_epi16(_mm_movpi64_epi64(a_.m64));
+      __m128i b128 = _mm_cvtepi8_epi16(_mm_movpi64_epi64(b_.m64));
+      __m128i r128 = _mm_mask_blend_epi16(_mm_cmpgt_epi16_mask(_mm_setzero_si128(), b128),
+                                          _mm_sllv_epi16(a128, _mm_min_epi16(b128, _mm_set1_epi16(8))),
+                                          _mm_srav_epi16(a128, _mm_abs_epi16(b128)));
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtsepi16_epi8(r128));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlb_s8(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_int8x8_from_private(r_);
   #endif
@@ -369,10 +379,20 @@ simde_vqshl_s16 (const simde_int16x4_t a, const simde_int16x4_t b) {
       a_ = simde_int16x4_to_private(a),
       b_ = simde_int16x4_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlh_s16(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i a128 = _mm_cvtepi16_epi32(_mm_movpi64_epi64(a_.m64));
+      __m128i b128 = _mm_cvtepi16_epi32(_mm_movpi64_epi64(b_.m64));
+      b128 = _mm_srai_epi32(_mm_slli_epi32(b128, 24), 24);
+      __m128i r128 = _mm_blendv_epi8(_mm_sllv_epi32(a128, _mm_min_epi32(b128, _mm_set1_epi32(16))),
+                                    _mm_srav_epi32(a128, _mm_abs_epi32(b128)),
+                                    _mm_cmpgt_epi32(_mm_setzero_si128(), b128));
+      r_.m64 = _mm_movepi64_pi64(_mm_packs_epi32(r128, r128));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlh_s16(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_int16x4_from_private(r_);
   #endif
@@ -393,10 +413,21 @@ simde_vqshl_s32 (const simde_int32x2_t a, const simde_int32x2_t b) {
       a_ = simde_int32x2_to_private(a),
       b_ = simde_int32x2_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshls_s32(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i a128 = _mm_movpi64_epi64(a_.m64);
+      __m128i b128 = _mm_movpi64_epi64(b_.m64);
+      b128 = _mm_srai_epi32(_mm_slli_epi32(b128, 24), 24);
+      __m128i shl = _mm_sllv_epi32(a128, b128);
+      __m128i sat = _mm_xor_si128(_mm_set1_epi32(INT32_MAX), _mm_srai_epi32(a128, 31));
+      shl = _mm_blendv_epi8(sat, shl, _mm_cmpeq_epi32(_mm_srav_epi32(shl, b128), a128));
+      r_.m64 = _mm_movepi64_pi64(_mm_blendv_epi8(shl, _mm_srav_epi32(a128, _mm_abs_epi32(b128)),
+                                                 _mm_cmpgt_epi32(_mm_setzero_si128(), b128)));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshls_s32(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_int32x2_from_private(r_);
   #endif
@@ -442,10 +473,19 @@ simde_vqshl_u8 (const simde_uint8x8_t a, const simde_int8x8_t b) {
     simde_int8x8_private
       b_ = simde_int8x8_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlb_u8(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i a128 = _mm_cvtepu8_epi16(_mm_movpi64_epi64(a_.m64));
+      __m128i b128 = _mm_cvtepi8_epi16(_mm_movpi64_epi64(b_.m64));
+      __m128i r128 = _mm_mask_blend_epi16(_mm_cmpgt_epi16_mask(_mm_setzero_si128(), b128),
+                                          _mm_sllv_epi16(a128, _mm_min_epi16(b128, _mm_set1_epi16(8))),
+                                          _mm_srlv_epi16(a128, _mm_abs_epi16(b128)));
+      r_.m64 = _mm_movepi64_pi64(_mm_cvtusepi16_epi8(r128));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlb_u8(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_uint8x8_from_private(r_);
   #endif
@@ -467,10 +507,21 @@ simde_vqshl_u16 (const simde_uint16x4_t a, const simde_int16x4_t b) {
     simde_int16x4_private
       b_ = simde_int16x4_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlh_u16(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i a128 = _mm_cvtepu16_epi32(_mm_movpi64_epi64(a_.m64));
+      __m128i b128 = _mm_cvtepi16_epi32(_mm_movpi64_epi64(b_.m64));
+      b128 = _mm_srai_epi32(_mm_slli_epi32(b128, 24), 24);
+      __m128i r128 = _mm_blendv_epi8(_mm_sllv_epi32(a128, _mm_min_epi32(b128, _mm_set1_epi32(16))),
+                                    _mm_srlv_epi32(a128, _mm_abs_epi32(b128)),
+                                    _mm_cmpgt_epi32(_mm_setzero_si128(), b128));
+      r128 = _mm_min_epu32(r128, _mm_set1_epi32(UINT16_MAX));
+      r_.m64 = _mm_movepi64_pi64(_mm_packus_epi32(r128, r128));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlh_u16(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_uint16x4_from_private(r_);
   #endif
@@ -492,10 +543,20 @@ simde_vqshl_u32 (const simde_uint32x2_t a, const simde_int32x2_t b) {
     simde_int32x2_private
       b_ = simde_int32x2_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshls_u32(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i a128 = _mm_movpi64_epi64(a_.m64);
+      __m128i b128 = _mm_movpi64_epi64(b_.m64);
+      b128 = _mm_srai_epi32(_mm_slli_epi32(b128, 24), 24);
+      __m128i shl = _mm_sllv_epi32(a128, b128);
+      shl = _mm_blendv_epi8(_mm_set1_epi32(~INT32_C(0)), shl, _mm_cmpeq_epi32(_mm_srlv_epi32(shl, b128), a128));
+      r_.m64 = _mm_movepi64_pi64(_mm_blendv_epi8(shl, _mm_srlv_epi32(a128, _mm_abs_epi32(b128)),
+                                                 _mm_cmpgt_epi32(_mm_setzero_si128(), b128)));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshls_u32(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_uint32x2_from_private(r_);
   #endif
@@ -541,10 +602,19 @@ simde_vqshlq_s8 (const simde_int8x16_t a, const simde_int8x16_t b) {
       a_ = simde_int8x16_to_private(a),
       b_ = simde_int8x16_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlb_s8(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      __m256i a256 = _mm256_cvtepi8_epi16(a_.m128i);
+      __m256i b256 = _mm256_cvtepi8_epi16(b_.m128i);
+      __m256i r256 = _mm256_mask_blend_epi16(_mm256_cmpgt_epi16_mask(_mm256_setzero_si256(), b256),
+                                             _mm256_sllv_epi16(a256, _mm256_min_epi16(b256, _mm256_set1_epi16(8))),
+                                             _mm256_srav_epi16(a256, _mm256_abs_epi16(b256)));
+      r_.m128i = _mm256_cvtsepi16_epi8(r256);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlb_s8(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_int8x16_from_private(r_);
   #endif
@@ -565,10 +635,20 @@ simde_vqshlq_s16 (const simde_int16x8_t a, const simde_int16x8_t b) {
       a_ = simde_int16x8_to_private(a),
       b_ = simde_int16x8_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlh_s16(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i a256 = _mm256_cvtepi16_epi32(a_.m128i);
+      __m256i b256 = _mm256_cvtepi16_epi32(b_.m128i);
+      b256 = _mm256_srai_epi32(_mm256_slli_epi32(b256, 24), 24);
+      __m256i r256 = _mm256_blendv_epi8(_mm256_sllv_epi32(a256, _mm256_min_epi32(b256, _mm256_set1_epi32(16))),
+                                        _mm256_srav_epi32(a256, _mm256_abs_epi32(b256)),
+                                        _mm256_cmpgt_epi32(_mm256_setzero_si256(), b256));
+      r_.m128i = _mm_packs_epi32(_mm256_castsi256_si128(r256), _mm256_extracti128_si256(r256, 1));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlh_s16(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_int16x8_from_private(r_);
   #endif
@@ -589,10 +669,19 @@ simde_vqshlq_s32 (const simde_int32x4_t a, const simde_int32x4_t b) {
       a_ = simde_int32x4_to_private(a),
       b_ = simde_int32x4_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshls_s32(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      __m128i b128 = _mm_srai_epi32(_mm_slli_epi32(b_.m128i, 24), 24);
+      __m128i shl = _mm_sllv_epi32(a_.m128i, b128);
+      __m128i sat = _mm_xor_si128(_mm_set1_epi32(INT32_MAX), _mm_srai_epi32(a_.m128i, 31));
+      shl = _mm_blendv_epi8(sat, shl, _mm_cmpeq_epi32(_mm_srav_epi32(shl, b128), a_.m128i));
+      r_.m128i = _mm_blendv_epi8(shl, _mm_srav_epi32(a_.m128i, _mm_abs_epi32(b128)),
+                                 _mm_cmpgt_epi32(_mm_setzero_si128(), b128));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshls_s32(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_int32x4_from_private(r_);
   #endif
@@ -613,10 +702,19 @@ simde_vqshlq_s64 (const simde_int64x2_t a, const simde_int64x2_t b) {
       a_ = simde_int64x2_to_private(a),
       b_ = simde_int64x2_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshld_s64(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512VL_NATIVE)
+      __m128i b128 = _mm_srai_epi64(_mm_slli_epi64(b_.m128i, 56), 56);
+      __m128i shl = _mm_sllv_epi64(a_.m128i, b128);
+      __m128i sat = _mm_xor_si128(_mm_set1_epi64x(INT64_MAX), _mm_srai_epi64(a_.m128i, 63));
+      shl = _mm_mask_blend_epi64(_mm_cmpneq_epi64_mask(_mm_srav_epi64(shl, b128), a_.m128i), shl, sat);
+      r_.m128i = _mm_mask_blend_epi64(_mm_cmplt_epi64_mask(b128, _mm_setzero_si128()),
+                                      shl, _mm_srav_epi64(a_.m128i, _mm_abs_epi64(b128)));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshld_s64(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_int64x2_from_private(r_);
   #endif
@@ -638,10 +736,19 @@ simde_vqshlq_u8 (const simde_uint8x16_t a, const simde_int8x16_t b) {
     simde_int8x16_private
       b_ = simde_int8x16_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlb_u8(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      __m256i a256 = _mm256_cvtepu8_epi16(a_.m128i);
+      __m256i b256 = _mm256_cvtepi8_epi16(b_.m128i);
+      __m256i r256 = _mm256_mask_blend_epi16(_mm256_cmpgt_epi16_mask(_mm256_setzero_si256(), b256),
+                                             _mm256_sllv_epi16(a256, _mm256_min_epi16(b256, _mm256_set1_epi16(8))),
+                                             _mm256_srlv_epi16(a256, _mm256_abs_epi16(b256)));
+      r_.m128i = _mm256_cvtusepi16_epi8(r256);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlb_u8(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_uint8x16_from_private(r_);
   #endif
@@ -663,10 +770,21 @@ simde_vqshlq_u16 (const simde_uint16x8_t a, const simde_int16x8_t b) {
     simde_int16x8_private
       b_ = simde_int16x8_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshlh_u16(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      __m256i a256 = _mm256_cvtepu16_epi32(a_.m128i);
+      __m256i b256 = _mm256_cvtepi16_epi32(b_.m128i);
+      b256 = _mm256_srai_epi32(_mm256_slli_epi32(b256, 24), 24);
+      __m256i r256 = _mm256_blendv_epi8(_mm256_sllv_epi32(a256, _mm256_min_epi32(b256, _mm256_set1_epi32(16))),
+                                        _mm256_srlv_epi32(a256, _mm256_abs_epi32(b256)),
+                                        _mm256_cmpgt_epi32(_mm256_setzero_si256(), b256));
+      r256 = _mm256_min_epu32(r256, _mm256_set1_epi32(UINT16_MAX));
+      r_.m128i = _mm_packus_epi32(_mm256_castsi256_si128(r256), _mm256_extracti128_si256(r256, 1));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshlh_u16(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_uint16x8_from_private(r_);
   #endif
@@ -688,10 +806,18 @@ simde_vqshlq_u32 (const simde_uint32x4_t a, const simde_int32x4_t b) {
     simde_int32x4_private
       b_ = simde_int32x4_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshls_u32(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      __m128i b128 = _mm_srai_epi32(_mm_slli_epi32(b_.m128i, 24), 24);
+      __m128i shl = _mm_sllv_epi32(a_.m128i, b128);
+      shl = _mm_blendv_epi8(_mm_set1_epi32(~INT32_C(0)), shl, _mm_cmpeq_epi32(_mm_srlv_epi32(shl, b128), a_.m128i));
+      r_.m128i = _mm_blendv_epi8(shl, _mm_srlv_epi32(a_.m128i, _mm_abs_epi32(b128)),
+                                 _mm_cmpgt_epi32(_mm_setzero_si128(), b128));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshls_u32(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_uint32x4_from_private(r_);
   #endif
@@ -713,10 +839,18 @@ simde_vqshlq_u64 (const simde_uint64x2_t a, const simde_int64x2_t b) {
     simde_int64x2_private
       b_ = simde_int64x2_to_private(b);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
-      r_.values[i] = simde_vqshld_u64(a_.values[i], b_.values[i]);
-    }
+    #if defined(SIMDE_X86_AVX512VL_NATIVE)
+      __m128i b128 = _mm_srai_epi64(_mm_slli_epi64(b_.m128i, 56), 56);
+      __m128i shl = _mm_sllv_epi64(a_.m128i, b128);
+      shl = _mm_mask_blend_epi64(_mm_cmpneq_epi64_mask(_mm_srlv_epi64(shl, b128), a_.m128i), shl, _mm_set1_epi64x(~INT64_C(0)));
+      r_.m128i = _mm_mask_blend_epi64(_mm_cmplt_epi64_mask(b128, _mm_setzero_si128()),
+                                      shl, _mm_srlv_epi64(a_.m128i, _mm_abs_epi64(b128)));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = simde_vqshld_u64(a_.values[i], b_.values[i]);
+      }
+    #endif
 
     return simde_uint64x2_from_private(r_);
   #endif
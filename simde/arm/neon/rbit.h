@@ -53,6 +53,14 @@ simde_vrbit_u8(simde_uint8x8_t a) {
       __m128i tmp = _mm_movpi64_epi64(a_.m64);
       tmp = _mm_gf2p8affine_epi64_epi8(tmp, _mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, UINT64_C(0x8040201008040201))), 0);
       r_.m64 = _mm_movepi64_pi64(tmp);
+    #elif defined(SIMDE_X86_SSSE3_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+      __m128i
+        v = _mm_movpi64_epi64(a_.m64),
+        lo = _mm_and_si128(v, _mm_set1_epi8(0x0f)),
+        hi = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+      lo = _mm_shuffle_epi8(_mm_setr_epi8(0x00, -0x80, 0x40, -0x40, 0x20, -0x60, 0x60, -0x20, 0x10, -0x70, 0x50, -0x30, 0x30, -0x50, 0x70, -0x10), lo);
+      hi = _mm_shuffle_epi8(_mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf), hi);
+      r_.m64 = _mm_movepi64_pi64(_mm_or_si128(lo, hi));
     #elif defined(SIMDE_X86_MMX_NATIVE)
       __m64 mask;
       mask = _mm_set1_pi8(0x55);
@@ -114,6 +122,15 @@ simde_vrbitq_u8(simde_uint8x16_t a) {
 
     #if defined(SIMDE_X86_GFNI_NATIVE)
       r_.m128i = _mm_gf2p8affine_epi64_epi8(a_.m128i, _mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, UINT64_C(0x8040201008040201))), 0);
+    #elif defined(SIMDE_X86_SSSE3_NATIVE)
+      /* Reverse each nibble with a table lookup; the table for the low
+       * nibble also moves it into the high half and vice versa. */
+      __m128i
+        lo = _mm_and_si128(a_.m128i, _mm_set1_epi8(0x0f)),
+        hi = _mm_and_si128(_mm_srli_epi16(a_.m128i, 4), _mm_set1_epi8(0x0f));
+      lo = _mm_shuffle_epi8(_mm_setr_epi8(0x00, -0x80, 0x40, -0x40, 0x20, -0x60, 0x60, -0x20, 0x10, -0x70, 0x50, -0x30, 0x30, -0x50, 0x70, -0x10), lo);
+      hi = _mm_shuffle_epi8(_mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf), hi);
+      r_.m128i = _mm_or_si128(lo, hi);
     #elif defined(SIMDE_X86_SSE2_NATIVE)
       __m128i mask;
       mask = _mm_set1_epi8(0x55);
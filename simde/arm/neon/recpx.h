@@ -0,0 +1,80 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */#if !defined(SIMDE_ARM_NEON_RECPX_H)
+#define SIMDE_ARM_NEON_RECPX_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* FRECPX only keeps the sign and inverts the exponent; the fraction is
+ * cleared.  Zeros and subnormals get the largest finite exponent,
+ * infinities become zero and NaNs are quieted. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32_t
+simde_vrecpxs_f32(simde_float32_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpxs_f32(a);
+  #else
+    uint32_t a_ = simde_float32_as_uint32(a);
+    uint32_t exp_ = a_ & UINT32_C(0x7f800000);
+
+    if ((a_ & UINT32_C(0x7fffffff)) > UINT32_C(0x7f800000))
+      return simde_uint32_as_float32(a_ | UINT32_C(0x00400000));
+
+    exp_ = (exp_ == 0) ? UINT32_C(0x7f000000) : (~exp_ & UINT32_C(0x7f800000));
+    return simde_uint32_as_float32((a_ & UINT32_C(0x80000000)) | exp_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpxs_f32
+  #define vrecpxs_f32(a) simde_vrecpxs_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64_t
+simde_vrecpxd_f64(simde_float64_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpxd_f64(a);
+  #else
+    uint64_t a_ = simde_float64_as_uint64(a);
+    uint64_t exp_ = a_ & UINT64_C(0x7ff0000000000000);
+
+    if ((a_ & UINT64_C(0x7fffffffffffffff)) > UINT64_C(0x7ff0000000000000))
+      return simde_uint64_as_float64(a_ | UINT64_C(0x0008000000000000));
+
+    exp_ = (exp_ == 0) ? UINT64_C(0x7fe0000000000000) : (~exp_ & UINT64_C(0x7ff0000000000000));
+    return simde_uint64_as_float64((a_ & UINT64_C(0x8000000000000000)) | exp_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpxd_f64
+  #define vrecpxd_f64(a) simde_vrecpxd_f64((a))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RECPX_H) */
@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_RSUBHN_H)
+#define SIMDE_ARM_NEON_RSUBHN_H
+
+#include "types.h"
+#include "add.h"
+#include "sub.h"
+#include "dup_n.h"
+#include "shr_n.h"
+#include "movn.h"
+#include "reinterpret.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x8_t
+simde_vrsubhn_u16(simde_uint16x8_t a, simde_uint16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsubhn_u16(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint8x8_private r_;
+    simde_uint16x8_private
+      a_ = simde_uint16x8_to_private(a),
+      b_ = simde_uint16x8_to_private(b);
+
+    const __m128i d = _mm_srli_epi16(_mm_add_epi16(_mm_sub_epi16(a_.m128i, b_.m128i), _mm_set1_epi16(INT16_C(1) << 7)), 8);
+    r_.m64 = _mm_movepi64_pi64(_mm_packus_epi16(d, d));
+
+    return simde_uint8x8_from_private(r_);
+  #else
+    return
+      simde_vmovn_u16(
+        simde_vshrq_n_u16(
+          simde_vaddq_u16(
+            simde_vsubq_u16(a, b),
+            simde_vdupq_n_u16(UINT16_C(1) << 7)
+          ),
+          8
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsubhn_u16
+  #define vrsubhn_u16(a, b) simde_vrsubhn_u16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x4_t
+simde_vrsubhn_u32(simde_uint32x4_t a, simde_uint32x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsubhn_u32(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint16x4_private r_;
+    simde_uint32x4_private
+      a_ = simde_uint32x4_to_private(a),
+      b_ = simde_uint32x4_to_private(b);
+
+    /* The arithmetic shift keeps the high halves in range for the
+     * signed pack, which then just copies their bits. */
+    const __m128i d = _mm_srai_epi32(_mm_add_epi32(_mm_sub_epi32(a_.m128i, b_.m128i), _mm_set1_epi32(INT32_C(1) << 15)), 16);
+    r_.m64 = _mm_movepi64_pi64(_mm_packs_epi32(d, d));
+
+    return simde_uint16x4_from_private(r_);
+  #else
+    return
+      simde_vmovn_u32(
+        simde_vshrq_n_u32(
+          simde_vaddq_u32(
+            simde_vsubq_u32(a, b),
+            simde_vdupq_n_u32(UINT32_C(1) << 15)
+          ),
+          16
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsubhn_u32
+  #define vrsubhn_u32(a, b) simde_vrsubhn_u32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vrsubhn_u64(simde_uint64x2_t a, simde_uint64x2_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsubhn_u64(a, b);
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_X86_MMX_NATIVE)
+    simde_uint32x2_private r_;
+    simde_uint64x2_private
+      a_ = simde_uint64x2_to_private(a),
+      b_ = simde_uint64x2_to_private(b);
+
+    const __m128i d = _mm_add_epi64(_mm_sub_epi64(a_.m128i, b_.m128i), _mm_set1_epi64x(INT64_C(1) << 31));
+    r_.m64 = _mm_movepi64_pi64(_mm_shuffle_epi32(d, (3 << 2) | 1));
+
+    return simde_uint32x2_from_private(r_);
+  #else
+    return
+      simde_vmovn_u64(
+        simde_vshrq_n_u64(
+          simde_vaddq_u64(
+            simde_vsubq_u64(a, b),
+            simde_vdupq_n_u64(UINT64_C(1) << 31)
+          ),
+          32
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsubhn_u64
+  #define vrsubhn_u64(a, b) simde_vrsubhn_u64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x8_t
+simde_vrsubhn_s16(simde_int16x8_t a, simde_int16x8_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsubhn_s16(a, b);
+  #else
+    return
+      simde_vreinterpret_s8_u8(
+        simde_vrsubhn_u16(
+          simde_vreinterpretq_u16_s16(a),
+          simde_vreinterpretq_u16_s16(b)
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsubhn_s16
+  #define vrsubhn_s16(a, b) simde_vrsubhn_s16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x4_t
+simde_vrsubhn_s32(simde_int32x4_t a, simde_int32x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsubhn_s32(a, b);
+  #else
+    return
+      simde_vreinterpret_s16_u16(
+        simde_vrsubhn_u32(
+          simde_vreinterpretq_u32_s32(a),
+          simde_vreinterpretq_u32_s32(b)
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsubhn_s32
+  #define vrsubhn_s32(a, b) simde_vrsubhn_s32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vrsubhn_s64(simde_int64x2_t a, simde_int64x2_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsubhn_s64(a, b);
+  #else
+    return
+      simde_vreinterpret_s32_u32(
+        simde_vrsubhn_u64(
+          simde_vreinterpretq_u64_s64(a),
+          simde_vreinterpretq_u64_s64(b)
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsubhn_s64
+  #define vrsubhn_s64(a, b) simde_vrsubhn_s64((a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RSUBHN_H) */
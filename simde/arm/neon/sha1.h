@@ -0,0 +1,238 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_SHA1_H)
+#define SIMDE_ARM_NEON_SHA1_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* SHA-NI keeps the hash state with 'a' in the highest lane and adds
+ * the round constant itself, while the NEON instructions keep 'a' in
+ * lane 0 and expect the constant to be part of wk.  The x86 paths
+ * reverse the lanes and subtract the constant back out. */
+
+#define SIMDE_X_SHA1_K0 UINT32_C(0x5A827999)
+#define SIMDE_X_SHA1_K1 UINT32_C(0x6ED9EBA1)
+#define SIMDE_X_SHA1_K2 UINT32_C(0x8F1BBCDC)
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_vsha_rotl32(uint32_t x, int n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_x_vsha1q_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk, int f) {
+  simde_uint32x4_private
+    x_ = simde_uint32x4_to_private(hash_abcd),
+    w_ = simde_uint32x4_to_private(wk);
+  uint32_t y = hash_e;
+
+  for (size_t i = 0 ; i < (sizeof(w_.values) / sizeof(w_.values[0])) ; i++) {
+    uint32_t t;
+    switch (f) {
+      case 0:
+        t = ((x_.values[2] ^ x_.values[3]) & x_.values[1]) ^ x_.values[3];
+        break;
+      case 1:
+        t = x_.values[1] ^ x_.values[2] ^ x_.values[3];
+        break;
+      default:
+        t = (x_.values[1] & x_.values[2]) | ((x_.values[1] | x_.values[2]) & x_.values[3]);
+        break;
+    }
+
+    y += simde_x_vsha_rotl32(x_.values[0], 5) + t + w_.values[i];
+
+    uint32_t tmp = x_.values[3];
+    x_.values[3] = x_.values[2];
+    x_.values[2] = simde_x_vsha_rotl32(x_.values[1], 30);
+    x_.values[1] = x_.values[0];
+    x_.values[0] = y;
+    y = tmp;
+  }
+
+  return simde_uint32x4_from_private(x_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1cq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1cq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(hash_abcd),
+      w_ = simde_uint32x4_to_private(wk);
+
+    __m128i w = _mm_add_epi32(w_.m128i, _mm_cvtsi32_si128(HEDLEY_STATIC_CAST(int32_t, hash_e)));
+    w = _mm_sub_epi32(w, _mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, SIMDE_X_SHA1_K0)));
+    r_.m128i = _mm_shuffle_epi32(_mm_sha1rnds4_epu32(_mm_shuffle_epi32(a_.m128i, 0x1b), _mm_shuffle_epi32(w, 0x1b), 0), 0x1b);
+
+    return simde_uint32x4_from_private(r_);
+  #else
+    return simde_x_vsha1q_u32(hash_abcd, hash_e, wk, 0);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1cq_u32
+  #define vsha1cq_u32(hash_abcd, hash_e, wk) simde_vsha1cq_u32((hash_abcd), (hash_e), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1pq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1pq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(hash_abcd),
+      w_ = simde_uint32x4_to_private(wk);
+
+    __m128i w = _mm_add_epi32(w_.m128i, _mm_cvtsi32_si128(HEDLEY_STATIC_CAST(int32_t, hash_e)));
+    w = _mm_sub_epi32(w, _mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, SIMDE_X_SHA1_K1)));
+    r_.m128i = _mm_shuffle_epi32(_mm_sha1rnds4_epu32(_mm_shuffle_epi32(a_.m128i, 0x1b), _mm_shuffle_epi32(w, 0x1b), 1), 0x1b);
+
+    return simde_uint32x4_from_private(r_);
+  #else
+    return simde_x_vsha1q_u32(hash_abcd, hash_e, wk, 1);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1pq_u32
+  #define vsha1pq_u32(hash_abcd, hash_e, wk) simde_vsha1pq_u32((hash_abcd), (hash_e), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1mq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1mq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(hash_abcd),
+      w_ = simde_uint32x4_to_private(wk);
+
+    __m128i w = _mm_add_epi32(w_.m128i, _mm_cvtsi32_si128(HEDLEY_STATIC_CAST(int32_t, hash_e)));
+    w = _mm_sub_epi32(w, _mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, SIMDE_X_SHA1_K2)));
+    r_.m128i = _mm_shuffle_epi32(_mm_sha1rnds4_epu32(_mm_shuffle_epi32(a_.m128i, 0x1b), _mm_shuffle_epi32(w, 0x1b), 2), 0x1b);
+
+    return simde_uint32x4_from_private(r_);
+  #else
+    return simde_x_vsha1q_u32(hash_abcd, hash_e, wk, 2);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1mq_u32
+  #define vsha1mq_u32(hash_abcd, hash_e, wk) simde_vsha1mq_u32((hash_abcd), (hash_e), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vsha1h_u32(uint32_t hash_e) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1h_u32(hash_e);
+  #else
+    return simde_x_vsha_rotl32(hash_e, 30);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1h_u32
+  #define vsha1h_u32(hash_e) simde_vsha1h_u32((hash_e))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7, simde_uint32x4_t w8_11) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1su0q_u32(w0_3, w4_7, w8_11);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(w0_3),
+      b_ = simde_uint32x4_to_private(w4_7),
+      c_ = simde_uint32x4_to_private(w8_11);
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.m128i = _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(a_.m128i), _mm_castsi128_pd(b_.m128i), 1));
+      r_.m128i = _mm_xor_si128(_mm_xor_si128(r_.m128i, a_.m128i), c_.m128i);
+    #elif defined(SIMDE_SHUFFLE_VECTOR_) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_.values, b_.values, 2, 3, 4, 5);
+      r_.values ^= a_.values ^ c_.values;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = ((i < 2) ? a_.values[i + 2] : b_.values[i - 2]) ^ a_.values[i] ^ c_.values[i];
+      }
+    #endif
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1su0q_u32
+  #define vsha1su0q_u32(w0_3, w4_7, w8_11) simde_vsha1su0q_u32((w0_3), (w4_7), (w8_11))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t w12_15) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1su1q_u32(tw0_3, w12_15);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(tw0_3),
+      b_ = simde_uint32x4_to_private(w12_15);
+
+    #if defined(SIMDE_X86_SHA_NATIVE)
+      r_.m128i = _mm_shuffle_epi32(_mm_sha1msg2_epu32(_mm_shuffle_epi32(a_.m128i, 0x1b), _mm_shuffle_epi32(b_.m128i, 0x1b)), 0x1b);
+    #else
+      uint32_t t[4];
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        t[i] = a_.values[i] ^ ((i < 3) ? b_.values[i + 1] : 0);
+        r_.values[i] = simde_x_vsha_rotl32(t[i], 1);
+      }
+      r_.values[3] ^= simde_x_vsha_rotl32(t[0], 2);
+    #endif
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1su1q_u32
+  #define vsha1su1q_u32(tw0_3, w12_15) simde_vsha1su1q_u32((tw0_3), (w12_15))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_SHA1_H) */
@@ -0,0 +1,181 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_SHA256_H)
+#define SIMDE_ARM_NEON_SHA256_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_vsha_rotr32(uint32_t x, int n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+/* Four rounds of SHA-256, returning the new abcd if part1 is set and
+ * the new efgh otherwise.  SHA-NI does two rounds at a time on the
+ * state split into {a, b, e, f} and {c, d, g, h} (highest lane first),
+ * so the x86 path has to shuffle to and from that layout. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_x_vsha256hq_u32(simde_uint32x4_t hash_abcd, simde_uint32x4_t hash_efgh, simde_uint32x4_t wk, int part1) {
+  simde_uint32x4_private
+    x_ = simde_uint32x4_to_private(hash_abcd),
+    y_ = simde_uint32x4_to_private(hash_efgh),
+    w_ = simde_uint32x4_to_private(wk);
+
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    __m128i
+      badc = _mm_shuffle_epi32(x_.m128i, 0xb1),
+      fehg = _mm_shuffle_epi32(y_.m128i, 0xb1),
+      abef = _mm_unpacklo_epi64(fehg, badc),
+      cdgh = _mm_unpackhi_epi64(fehg, badc);
+
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, w_.m128i);
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(w_.m128i, 0x0e));
+
+    x_.m128i = _mm_shuffle_epi32(part1 ? _mm_unpackhi_epi64(abef, cdgh) : _mm_unpacklo_epi64(abef, cdgh), 0xb1);
+
+    return simde_uint32x4_from_private(x_);
+  #else
+    for (size_t i = 0 ; i < (sizeof(w_.values) / sizeof(w_.values[0])) ; i++) {
+      uint32_t
+        chs = ((y_.values[1] ^ y_.values[2]) & y_.values[0]) ^ y_.values[2],
+        maj = (x_.values[0] & x_.values[1]) | ((x_.values[0] | x_.values[1]) & x_.values[2]),
+        sigma0 = simde_x_vsha_rotr32(x_.values[0], 2) ^ simde_x_vsha_rotr32(x_.values[0], 13) ^ simde_x_vsha_rotr32(x_.values[0], 22),
+        sigma1 = simde_x_vsha_rotr32(y_.values[0], 6) ^ simde_x_vsha_rotr32(y_.values[0], 11) ^ simde_x_vsha_rotr32(y_.values[0], 25),
+        t = y_.values[3] + sigma1 + chs + w_.values[i],
+        d = x_.values[3] + t,
+        h = t + sigma0 + maj;
+
+      x_.values[3] = x_.values[2];
+      x_.values[2] = x_.values[1];
+      x_.values[1] = x_.values[0];
+      x_.values[0] = h;
+      y_.values[3] = y_.values[2];
+      y_.values[2] = y_.values[1];
+      y_.values[1] = y_.values[0];
+      y_.values[0] = d;
+    }
+
+    return simde_uint32x4_from_private(part1 ? x_ : y_);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256hq_u32(simde_uint32x4_t hash_abcd, simde_uint32x4_t hash_efgh, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256hq_u32(hash_abcd, hash_efgh, wk);
+  #else
+    return simde_x_vsha256hq_u32(hash_abcd, hash_efgh, wk, 1);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256hq_u32
+  #define vsha256hq_u32(hash_abcd, hash_efgh, wk) simde_vsha256hq_u32((hash_abcd), (hash_efgh), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256h2q_u32(simde_uint32x4_t hash_efgh, simde_uint32x4_t hash_abcd, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256h2q_u32(hash_efgh, hash_abcd, wk);
+  #else
+    return simde_x_vsha256hq_u32(hash_abcd, hash_efgh, wk, 0);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256h2q_u32
+  #define vsha256h2q_u32(hash_efgh, hash_abcd, wk) simde_vsha256h2q_u32((hash_efgh), (hash_abcd), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256su0q_u32(w0_3, w4_7);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(w0_3),
+      b_ = simde_uint32x4_to_private(w4_7);
+
+    #if defined(SIMDE_X86_SHA_NATIVE)
+      r_.m128i = _mm_sha256msg1_epu32(a_.m128i, b_.m128i);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        uint32_t t = (i < 3) ? a_.values[i + 1] : b_.values[0];
+        r_.values[i] = a_.values[i] + (simde_x_vsha_rotr32(t, 7) ^ simde_x_vsha_rotr32(t, 18) ^ (t >> 3));
+      }
+    #endif
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256su0q_u32
+  #define vsha256su0q_u32(w0_3, w4_7) simde_vsha256su0q_u32((w0_3), (w4_7))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t w8_11, simde_uint32x4_t w12_15) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256su1q_u32(tw0_3, w8_11, w12_15);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(tw0_3),
+      b_ = simde_uint32x4_to_private(w8_11),
+      c_ = simde_uint32x4_to_private(w12_15);
+
+    #if defined(SIMDE_X86_SHA_NATIVE)
+      __m128i w9_12 = _mm_or_si128(_mm_srli_si128(b_.m128i, 4), _mm_slli_si128(c_.m128i, 12));
+      r_.m128i = _mm_sha256msg2_epu32(_mm_add_epi32(a_.m128i, w9_12), c_.m128i);
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        uint32_t
+          t = (i < 2) ? c_.values[i + 2] : r_.values[i - 2],
+          w = (i < 3) ? b_.values[i + 1] : c_.values[0];
+        r_.values[i] = a_.values[i] + w + (simde_x_vsha_rotr32(t, 17) ^ simde_x_vsha_rotr32(t, 19) ^ (t >> 10));
+      }
+    #endif
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256su1q_u32
+  #define vsha256su1q_u32(tw0_3, w8_11, w12_15) simde_vsha256su1q_u32((tw0_3), (w8_11), (w12_15))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_SHA256_H) */
@@ -29,6 +29,7 @@
 
 #include "../../simde-common.h"
 #include "../../simde-f16.h"
+#include "../../simde-bf16.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -116,6 +117,14 @@ typedef union {
   #endif
 } simde_float16x4_private;
 
+typedef union {
+  simde_bfloat16 values[4];
+
+  #if defined(SIMDE_X86_MMX_NATIVE)
+    __m64 m64;
+  #endif
+} simde_bfloat16x4_private;
+
 typedef union {
   SIMDE_ARM_NEON_DECLARE_VECTOR(simde_float32, values, 8);
 
@@ -284,6 +293,14 @@ typedef union {
   #endif
 } simde_float16x8_private;
 
+typedef union {
+  simde_bfloat16 values[8];
+
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i m128i;
+  #endif
+} simde_bfloat16x8_private;
+
 typedef union {
   SIMDE_ARM_NEON_DECLARE_VECTOR(simde_float32, values, 16);
 
@@ -655,6 +672,34 @@ typedef union {
   typedef simde_float64 simde_float64_t;
 #endif
 
+/* bfloat16 vectors only ever hold the raw bits, see simde-bf16.h. */
+#if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_BF16)
+  typedef   bfloat16_t   simde_bfloat16_t;
+  typedef bfloat16x4_t simde_bfloat16x4_t;
+  typedef bfloat16x8_t simde_bfloat16x8_t;
+#else
+  typedef         simde_bfloat16   simde_bfloat16_t;
+  typedef simde_bfloat16x4_private simde_bfloat16x4_t;
+  typedef simde_bfloat16x8_private simde_bfloat16x8_t;
+#endif
+
+/* Only the 64-bit polynomial types used by vmull_p64 are provided.
+ * Outside of AArch64 they share the representation of the unsigned
+ * integer types; poly128_t requires a native 128-bit integer. */
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  typedef   poly64_t   simde_poly64_t;
+  typedef poly64x2_t simde_poly64x2_t;
+  #if defined(SIMDE_HAVE_INT128_)
+    typedef poly128_t simde_poly128_t;
+  #endif
+#else
+  typedef         uint64_t   simde_poly64_t;
+  typedef simde_uint64x2_t simde_poly64x2_t;
+  #if defined(SIMDE_HAVE_INT128_)
+    typedef simde_uint128 simde_poly128_t;
+  #endif
+#endif
+
 #if defined(SIMDE_ARM_NEON_NEED_PORTABLE_VXN) && !defined(SIMDE_BUG_INTEL_857088)
   typedef struct    simde_int8x8x2_t {
     simde_int8x8_t val[2];
@@ -939,6 +984,11 @@ typedef union {
   typedef simde_uint64x2x4_t  uint64x2x4_t;
   typedef simde_float32x4x4_t float32x4x4_t;
 #endif
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES)
+  typedef   simde_bfloat16_t   bfloat16_t;
+  typedef simde_bfloat16x4_t bfloat16x4_t;
+  typedef simde_bfloat16x8_t bfloat16x8_t;
+#endif
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
   typedef   simde_float64_t     float64_t;
   typedef simde_float16x4_t   float16x4_t;
@@ -951,6 +1001,11 @@ typedef union {
   typedef simde_float64x2x3_t float64x2x3_t;
   typedef simde_float64x1x4_t float64x1x4_t;
   typedef simde_float64x2x4_t float64x2x4_t;
+  typedef    simde_poly64_t      poly64_t;
+  typedef  simde_poly64x2_t    poly64x2_t;
+  #if defined(SIMDE_HAVE_INT128_)
+    typedef simde_poly128_t     poly128_t;
+  #endif
 #endif
 
 #if defined(SIMDE_X86_MMX_NATIVE)
@@ -1050,6 +1105,8 @@ SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(uint64x2)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float16x8)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float32x4)
 SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(float64x2)
+SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(bfloat16x4)
+SIMDE_ARM_NEON_TYPE_DEFINE_CONVERSIONS_(bfloat16x8)
 
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if !defined(SIMDE_ARM_NEON_USDOT_LANE_H)
+#define SIMDE_ARM_NEON_USDOT_LANE_H
+
+#include "types.h"
+#include "usdot.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vusdot_lane_s32(simde_int32x2_t r, simde_uint8x8_t a, simde_int8x8_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  simde_int32x2_t result;
+
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+    SIMDE_CONSTIFY_2_(vusdot_lane_s32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+    simde_int8x8_private b_lane_;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(b_lane_.values) / sizeof(b_lane_.values[0])) ; i++) {
+      b_lane_.values[i] = b_.values[(HEDLEY_STATIC_CAST(size_t, lane) << 2) + (i & 3)];
+    }
+
+    result = simde_vusdot_s32(r, a, simde_int8x8_from_private(b_lane_));
+  #endif
+
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_MATMUL_INT8))
+  #undef vusdot_lane_s32
+  #define vusdot_lane_s32(r, a, b, lane) simde_vusdot_lane_s32((r), (a), (b), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2_t
+simde_vusdot_laneq_s32(simde_int32x2_t r, simde_uint8x8_t a, simde_int8x16_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  simde_int32x2_t result;
+
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+    SIMDE_CONSTIFY_4_(vusdot_laneq_s32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    simde_int8x8_private b_lane_;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(b_lane_.values) / sizeof(b_lane_.values[0])) ; i++) {
+      b_lane_.values[i] = b_.values[(HEDLEY_STATIC_CAST(size_t, lane) << 2) + (i & 3)];
+    }
+
+    result = simde_vusdot_s32(r, a, simde_int8x8_from_private(b_lane_));
+  #endif
+
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_MATMUL_INT8))
+  #undef vusdot_laneq_s32
+  #define vusdot_laneq_s32(r, a, b, lane) simde_vusdot_laneq_s32((r), (a), (b), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vusdotq_lane_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x8_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  simde_int32x4_t result;
+
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+    SIMDE_CONSTIFY_2_(vusdotq_lane_s32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_int8x8_private b_ = simde_int8x8_to_private(b);
+    simde_int8x16_private b_lane_;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(b_lane_.values) / sizeof(b_lane_.values[0])) ; i++) {
+      b_lane_.values[i] = b_.values[(HEDLEY_STATIC_CAST(size_t, lane) << 2) + (i & 3)];
+    }
+
+    result = simde_vusdotq_s32(r, a, simde_int8x16_from_private(b_lane_));
+  #endif
+
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_MATMUL_INT8))
+  #undef vusdotq_lane_s32
+  #define vusdotq_lane_s32(r, a, b, lane) simde_vusdotq_lane_s32((r), (a), (b), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4_t
+simde_vusdotq_laneq_s32(simde_int32x4_t r, simde_uint8x16_t a, simde_int8x16_t b, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  simde_int32x4_t result;
+
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+    SIMDE_CONSTIFY_4_(vusdotq_laneq_s32, result, (HEDLEY_UNREACHABLE(), result), lane, r, a, b);
+  #else
+    simde_int8x16_private b_ = simde_int8x16_to_private(b);
+    simde_int8x16_private b_lane_;
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(b_lane_.values) / sizeof(b_lane_.values[0])) ; i++) {
+      b_lane_.values[i] = b_.values[(HEDLEY_STATIC_CAST(size_t, lane) << 2) + (i & 3)];
+    }
+
+    result = simde_vusdotq_s32(r, a, simde_int8x16_from_private(b_lane_));
+  #endif
+
+  return result;
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_MATMUL_INT8))
+  #undef vusdotq_laneq_s32
+  #define vusdotq_laneq_s32(r, a, b, lane) simde_vusdotq_laneq_s32((r), (a), (b), (lane))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_USDOT_LANE_H) */
@@ -36,9 +36,27 @@
 #include "msa/addvi.h"
 #include "msa/and.h"
 #include "msa/andi.h"
+#include "msa/bsel.h"
+#include "msa/ceq.h"
+#include "msa/clt.h"
+#include "msa/dotp.h"
+#include "msa/fadd.h"
+#include "msa/fdiv.h"
+#include "msa/fmul.h"
+#include "msa/ilvl.h"
+#include "msa/ilvr.h"
 #include "msa/ld.h"
 #include "msa/madd.h"
+#include "msa/maddv.h"
+#include "msa/mulv.h"
+#include "msa/pckev.h"
+#include "msa/pckod.h"
+#include "msa/sat.h"
+#include "msa/sll.h"
+#include "msa/sra.h"
+#include "msa/srl.h"
 #include "msa/st.h"
 #include "msa/subv.h"
+#include "msa/vshf.h"
 
 #endif /* SIMDE_MIPS_MSA_H */
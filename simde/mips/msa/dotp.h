@@ -0,0 +1,301 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2021      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_MIPS_MSA_DOTP_H)
+#define SIMDE_MIPS_MSA_DOTP_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v8i16
+simde_msa_dotp_s_h(simde_v16i8 a, simde_v16i8 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_dotp_s_h(a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vpaddq_s16(vmull_s8(vget_low_s8(a), vget_low_s8(b)), vmull_high_s8(a, b));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    int16x8_t l = vmull_s8(vget_low_s8(a), vget_low_s8(b));
+    int16x8_t h = vmull_s8(vget_high_s8(a), vget_high_s8(b));
+    return vcombine_s16(vpadd_s16(vget_low_s16(l), vget_high_s16(l)), vpadd_s16(vget_low_s16(h), vget_high_s16(h)));
+  #else
+    simde_v16i8_private a_ = simde_v16i8_to_private(a);
+    simde_v16i8_private b_ = simde_v16i8_to_private(b);
+    simde_v8i16_private r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.m128i =
+        _mm_add_epi16(
+          _mm_mullo_epi16(_mm_srai_epi16(_mm_slli_epi16(a_.m128i, 8), 8), _mm_srai_epi16(_mm_slli_epi16(b_.m128i, 8), 8)),
+          _mm_mullo_epi16(_mm_srai_epi16(a_.m128i, 8), _mm_srai_epi16(b_.m128i, 8))
+        );
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 =
+        wasm_i16x8_add(
+          wasm_i16x8_mul(wasm_i16x8_shr(wasm_i16x8_shl(a_.v128, 8), 8), wasm_i16x8_shr(wasm_i16x8_shl(b_.v128, 8), 8)),
+          wasm_i16x8_mul(wasm_i16x8_shr(a_.v128, 8), wasm_i16x8_shr(b_.v128, 8))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = HEDLEY_STATIC_CAST(int16_t,
+          (HEDLEY_STATIC_CAST(int16_t, a_.values[(i * 2)    ]) * HEDLEY_STATIC_CAST(int16_t, b_.values[(i * 2)    ])) +
+          (HEDLEY_STATIC_CAST(int16_t, a_.values[(i * 2) + 1]) * HEDLEY_STATIC_CAST(int16_t, b_.values[(i * 2) + 1])));
+      }
+    #endif
+
+    return simde_v8i16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_dotp_s_h
+  #define __msa_dotp_s_h(a, b) simde_msa_dotp_s_h((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v4i32
+simde_msa_dotp_s_w(simde_v8i16 a, simde_v8i16 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_dotp_s_w(a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vpaddq_s32(vmull_s16(vget_low_s16(a), vget_low_s16(b)), vmull_high_s16(a, b));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    int32x4_t l = vmull_s16(vget_low_s16(a), vget_low_s16(b));
+    int32x4_t h = vmull_s16(vget_high_s16(a), vget_high_s16(b));
+    return vcombine_s32(vpadd_s32(vget_low_s32(l), vget_high_s32(l)), vpadd_s32(vget_low_s32(h), vget_high_s32(h)));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_msum(a, b, vec_splats(0));
+  #else
+    simde_v8i16_private a_ = simde_v8i16_to_private(a);
+    simde_v8i16_private b_ = simde_v8i16_to_private(b);
+    simde_v4i32_private r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.m128i = _mm_madd_epi16(a_.m128i, b_.m128i);
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 = wasm_i32x4_dot_i16x8(a_.v128, b_.v128);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = HEDLEY_STATIC_CAST(int32_t,
+          HEDLEY_STATIC_CAST(uint32_t, HEDLEY_STATIC_CAST(int32_t, a_.values[(i * 2)    ]) * HEDLEY_STATIC_CAST(int32_t, b_.values[(i * 2)    ])) +
+          HEDLEY_STATIC_CAST(uint32_t, HEDLEY_STATIC_CAST(int32_t, a_.values[(i * 2) + 1]) * HEDLEY_STATIC_CAST(int32_t, b_.values[(i * 2) + 1])));
+      }
+    #endif
+
+    return simde_v4i32_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_dotp_s_w
+  #define __msa_dotp_s_w(a, b) simde_msa_dotp_s_w((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v2i64
+simde_msa_dotp_s_d(simde_v4i32 a, simde_v4i32 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_dotp_s_d(a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vpaddq_s64(vmull_s32(vget_low_s32(a), vget_low_s32(b)), vmull_high_s32(a, b));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    int64x2_t l = vmull_s32(vget_low_s32(a), vget_low_s32(b));
+    int64x2_t h = vmull_s32(vget_high_s32(a), vget_high_s32(b));
+    return vcombine_s64(vadd_s64(vget_low_s64(l), vget_high_s64(l)), vadd_s64(vget_low_s64(h), vget_high_s64(h)));
+  #else
+    simde_v4i32_private a_ = simde_v4i32_to_private(a);
+    simde_v4i32_private b_ = simde_v4i32_to_private(b);
+    simde_v2i64_private r_;
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i =
+        _mm_add_epi64(
+          _mm_mul_epi32(a_.m128i, b_.m128i),
+          _mm_mul_epi32(_mm_srli_epi64(a_.m128i, 32), _mm_srli_epi64(b_.m128i, 32))
+        );
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 =
+        wasm_i64x2_add(
+          wasm_i64x2_extmul_low_i32x4(wasm_i32x4_shuffle(a_.v128, a_.v128, 0, 2, 1, 3), wasm_i32x4_shuffle(b_.v128, b_.v128, 0, 2, 1, 3)),
+          wasm_i64x2_extmul_high_i32x4(wasm_i32x4_shuffle(a_.v128, a_.v128, 0, 2, 1, 3), wasm_i32x4_shuffle(b_.v128, b_.v128, 0, 2, 1, 3))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = HEDLEY_STATIC_CAST(int64_t,
+          HEDLEY_STATIC_CAST(uint64_t, HEDLEY_STATIC_CAST(int64_t, a_.values[(i * 2)    ]) * HEDLEY_STATIC_CAST(int64_t, b_.values[(i * 2)    ])) +
+          HEDLEY_STATIC_CAST(uint64_t, HEDLEY_STATIC_CAST(int64_t, a_.values[(i * 2) + 1]) * HEDLEY_STATIC_CAST(int64_t, b_.values[(i * 2) + 1])));
+      }
+    #endif
+
+    return simde_v2i64_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_dotp_s_d
+  #define __msa_dotp_s_d(a, b) simde_msa_dotp_s_d((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v8u16
+simde_msa_dotp_u_h(simde_v16u8 a, simde_v16u8 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_dotp_u_h(a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vpaddq_u16(vmull_u8(vget_low_u8(a), vget_low_u8(b)), vmull_high_u8(a, b));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    uint16x8_t l = vmull_u8(vget_low_u8(a), vget_low_u8(b));
+    uint16x8_t h = vmull_u8(vget_high_u8(a), vget_high_u8(b));
+    return vcombine_u16(vpadd_u16(vget_low_u16(l), vget_high_u16(l)), vpadd_u16(vget_low_u16(h), vget_high_u16(h)));
+  #else
+    simde_v16u8_private a_ = simde_v16u8_to_private(a);
+    simde_v16u8_private b_ = simde_v16u8_to_private(b);
+    simde_v8u16_private r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i lo = _mm_set1_epi16(0x00ff);
+      r_.m128i =
+        _mm_add_epi16(
+          _mm_mullo_epi16(_mm_and_si128(a_.m128i, lo), _mm_and_si128(b_.m128i, lo)),
+          _mm_mullo_epi16(_mm_srli_epi16(a_.m128i, 8), _mm_srli_epi16(b_.m128i, 8))
+        );
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 =
+        wasm_i16x8_add(
+          wasm_i16x8_mul(wasm_v128_and(a_.v128, wasm_i16x8_splat(0x00ff)), wasm_v128_and(b_.v128, wasm_i16x8_splat(0x00ff))),
+          wasm_i16x8_mul(wasm_u16x8_shr(a_.v128, 8), wasm_u16x8_shr(b_.v128, 8))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = HEDLEY_STATIC_CAST(uint16_t,
+          (HEDLEY_STATIC_CAST(uint16_t, a_.values[(i * 2)    ]) * HEDLEY_STATIC_CAST(uint16_t, b_.values[(i * 2)    ])) +
+          (HEDLEY_STATIC_CAST(uint16_t, a_.values[(i * 2) + 1]) * HEDLEY_STATIC_CAST(uint16_t, b_.values[(i * 2) + 1])));
+      }
+    #endif
+
+    return simde_v8u16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_dotp_u_h
+  #define __msa_dotp_u_h(a, b) simde_msa_dotp_u_h((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v4u32
+simde_msa_dotp_u_w(simde_v8u16 a, simde_v8u16 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_dotp_u_w(a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vpaddq_u32(vmull_u16(vget_low_u16(a), vget_low_u16(b)), vmull_high_u16(a, b));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    uint32x4_t l = vmull_u16(vget_low_u16(a), vget_low_u16(b));
+    uint32x4_t h = vmull_u16(vget_high_u16(a), vget_high_u16(b));
+    return vcombine_u32(vpadd_u32(vget_low_u32(l), vget_high_u32(l)), vpadd_u32(vget_low_u32(h), vget_high_u32(h)));
+  #else
+    simde_v8u16_private a_ = simde_v8u16_to_private(a);
+    simde_v8u16_private b_ = simde_v8u16_to_private(b);
+    simde_v4u32_private r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i pl = _mm_mullo_epi16(a_.m128i, b_.m128i);
+      __m128i ph = _mm_mulhi_epu16(a_.m128i, b_.m128i);
+      const __m128i lo = _mm_set1_epi32(0x0000ffff);
+      r_.m128i =
+        _mm_add_epi32(
+          _mm_or_si128(_mm_and_si128(pl, lo), _mm_slli_epi32(ph, 16)),
+          _mm_or_si128(_mm_srli_epi32(pl, 16), _mm_andnot_si128(lo, ph))
+        );
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 =
+        wasm_i32x4_add(
+          wasm_i32x4_mul(wasm_v128_and(a_.v128, wasm_i32x4_splat(0x0000ffff)), wasm_v128_and(b_.v128, wasm_i32x4_splat(0x0000ffff))),
+          wasm_i32x4_mul(wasm_u32x4_shr(a_.v128, 16), wasm_u32x4_shr(b_.v128, 16))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] =
+          (HEDLEY_STATIC_CAST(uint32_t, a_.values[(i * 2)    ]) * HEDLEY_STATIC_CAST(uint32_t, b_.values[(i * 2)    ])) +
+          (HEDLEY_STATIC_CAST(uint32_t, a_.values[(i * 2) + 1]) * HEDLEY_STATIC_CAST(uint32_t, b_.values[(i * 2) + 1]));
+      }
+    #endif
+
+    return simde_v4u32_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_dotp_u_w
+  #define __msa_dotp_u_w(a, b) simde_msa_dotp_u_w((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v2u64
+simde_msa_dotp_u_d(simde_v4u32 a, simde_v4u32 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_dotp_u_d(a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vpaddq_u64(vmull_u32(vget_low_u32(a), vget_low_u32(b)), vmull_high_u32(a, b));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    uint64x2_t l = vmull_u32(vget_low_u32(a), vget_low_u32(b));
+    uint64x2_t h = vmull_u32(vget_high_u32(a), vget_high_u32(b));
+    return vcombine_u64(vadd_u64(vget_low_u64(l), vget_high_u64(l)), vadd_u64(vget_low_u64(h), vget_high_u64(h)));
+  #else
+    simde_v4u32_private a_ = simde_v4u32_to_private(a);
+    simde_v4u32_private b_ = simde_v4u32_to_private(b);
+    simde_v2u64_private r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.m128i =
+        _mm_add_epi64(
+          _mm_mul_epu32(a_.m128i, b_.m128i),
+          _mm_mul_epu32(_mm_srli_epi64(a_.m128i, 32), _mm_srli_epi64(b_.m128i, 32))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] =
+          (HEDLEY_STATIC_CAST(uint64_t, a_.values[(i * 2)    ]) * HEDLEY_STATIC_CAST(uint64_t, b_.values[(i * 2)    ])) +
+          (HEDLEY_STATIC_CAST(uint64_t, a_.values[(i * 2) + 1]) * HEDLEY_STATIC_CAST(uint64_t, b_.values[(i * 2) + 1]));
+      }
+    #endif
+
+    return simde_v2u64_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_dotp_u_d
+  #define __msa_dotp_u_d(a, b) simde_msa_dotp_u_d((a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_MIPS_MSA_DOTP_H) */
@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2021      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_MIPS_MSA_MADDV_H)
+#define SIMDE_MIPS_MSA_MADDV_H
+
+#include "types.h"
+#include "addv.h"
+#include "mulv.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v16i8
+simde_msa_maddv_b(simde_v16i8 a, simde_v16i8 b, simde_v16i8 c) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_maddv_b(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vmlaq_s8(a, b, c);
+  #else
+    return simde_msa_addv_b(a, simde_msa_mulv_b(b, c));
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_maddv_b
+  #define __msa_maddv_b(a, b, c) simde_msa_maddv_b((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v8i16
+simde_msa_maddv_h(simde_v8i16 a, simde_v8i16 b, simde_v8i16 c) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_maddv_h(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vmlaq_s16(a, b, c);
+  #else
+    return simde_msa_addv_h(a, simde_msa_mulv_h(b, c));
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_maddv_h
+  #define __msa_maddv_h(a, b, c) simde_msa_maddv_h((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v4i32
+simde_msa_maddv_w(simde_v4i32 a, simde_v4i32 b, simde_v4i32 c) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_maddv_w(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vmlaq_s32(a, b, c);
+  #else
+    return simde_msa_addv_w(a, simde_msa_mulv_w(b, c));
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_maddv_w
+  #define __msa_maddv_w(a, b, c) simde_msa_maddv_w((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v2i64
+simde_msa_maddv_d(simde_v2i64 a, simde_v2i64 b, simde_v2i64 c) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_maddv_d(a, b, c);
+  #else
+    return simde_msa_addv_d(a, simde_msa_mulv_d(b, c));
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_maddv_d
+  #define __msa_maddv_d(a, b, c) simde_msa_maddv_d((a), (b), (c))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_MIPS_MSA_MADDV_H) */
@@ -0,0 +1,335 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2021      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_MIPS_MSA_SAT_H)
+#define SIMDE_MIPS_MSA_SAT_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v16i8
+simde_msa_sat_s_b(simde_v16i8 a, const int imm0_7)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_7, 0, 7) {
+  const int8_t max = HEDLEY_STATIC_CAST(int8_t, INT8_MAX >> (7 - imm0_7));
+  const int8_t min = HEDLEY_STATIC_CAST(int8_t, ~max);
+
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vminq_s8(vmaxq_s8(a, vdupq_n_s8(min)), vdupq_n_s8(max));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_min(vec_max(a, vec_splats(HEDLEY_STATIC_CAST(signed char, min))), vec_splats(HEDLEY_STATIC_CAST(signed char, max)));
+  #else
+    simde_v16i8_private
+      a_ = simde_v16i8_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i = _mm_min_epi8(_mm_max_epi8(a_.m128i, _mm_set1_epi8(min)), _mm_set1_epi8(max));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 = wasm_i8x16_min(wasm_i8x16_max(a_.v128, wasm_i8x16_splat(min)), wasm_i8x16_splat(max));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : ((a_.values[i] < min) ? min : a_.values[i]);
+      }
+    #endif
+
+    return simde_v16i8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_s_b(a, imm0_7) __msa_sat_s_b((a), (imm0_7))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_s_b
+  #define __msa_sat_s_b(a, imm0_7) simde_msa_sat_s_b((a), (imm0_7))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v8i16
+simde_msa_sat_s_h(simde_v8i16 a, const int imm0_15)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_15, 0, 15) {
+  const int16_t max = HEDLEY_STATIC_CAST(int16_t, INT16_MAX >> (15 - imm0_15));
+  const int16_t min = HEDLEY_STATIC_CAST(int16_t, ~max);
+
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vminq_s16(vmaxq_s16(a, vdupq_n_s16(min)), vdupq_n_s16(max));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_min(vec_max(a, vec_splats(HEDLEY_STATIC_CAST(signed short, min))), vec_splats(HEDLEY_STATIC_CAST(signed short, max)));
+  #else
+    simde_v8i16_private
+      a_ = simde_v8i16_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.m128i = _mm_min_epi16(_mm_max_epi16(a_.m128i, _mm_set1_epi16(min)), _mm_set1_epi16(max));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 = wasm_i16x8_min(wasm_i16x8_max(a_.v128, wasm_i16x8_splat(min)), wasm_i16x8_splat(max));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : ((a_.values[i] < min) ? min : a_.values[i]);
+      }
+    #endif
+
+    return simde_v8i16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_s_h(a, imm0_15) __msa_sat_s_h((a), (imm0_15))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_s_h
+  #define __msa_sat_s_h(a, imm0_15) simde_msa_sat_s_h((a), (imm0_15))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v4i32
+simde_msa_sat_s_w(simde_v4i32 a, const int imm0_31)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_31, 0, 31) {
+  const int32_t max = HEDLEY_STATIC_CAST(int32_t, INT32_MAX >> (31 - imm0_31));
+  const int32_t min = HEDLEY_STATIC_CAST(int32_t, ~max);
+
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vminq_s32(vmaxq_s32(a, vdupq_n_s32(min)), vdupq_n_s32(max));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_min(vec_max(a, vec_splats(HEDLEY_STATIC_CAST(signed int, min))), vec_splats(HEDLEY_STATIC_CAST(signed int, max)));
+  #else
+    simde_v4i32_private
+      a_ = simde_v4i32_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i = _mm_min_epi32(_mm_max_epi32(a_.m128i, _mm_set1_epi32(min)), _mm_set1_epi32(max));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 = wasm_i32x4_min(wasm_i32x4_max(a_.v128, wasm_i32x4_splat(min)), wasm_i32x4_splat(max));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : ((a_.values[i] < min) ? min : a_.values[i]);
+      }
+    #endif
+
+    return simde_v4i32_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_s_w(a, imm0_31) __msa_sat_s_w((a), (imm0_31))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_s_w
+  #define __msa_sat_s_w(a, imm0_31) simde_msa_sat_s_w((a), (imm0_31))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v2i64
+simde_msa_sat_s_d(simde_v2i64 a, const int imm0_63)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_63, 0, 63) {
+  const int64_t max = HEDLEY_STATIC_CAST(int64_t, INT64_MAX >> (63 - imm0_63));
+  const int64_t min = HEDLEY_STATIC_CAST(int64_t, ~max);
+
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vbslq_s64(vcgtq_s64(a, vdupq_n_s64(max)), vdupq_n_s64(max), vbslq_s64(vcltq_s64(a, vdupq_n_s64(min)), vdupq_n_s64(min), a));
+  #elif defined(SIMDE_POWER_ALTIVEC_P8_NATIVE)
+    return vec_min(vec_max(a, vec_splats(HEDLEY_STATIC_CAST(signed long long, min))), vec_splats(HEDLEY_STATIC_CAST(signed long long, max)));
+  #else
+    simde_v2i64_private
+      a_ = simde_v2i64_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_AVX512VL_NATIVE)
+      r_.m128i = _mm_min_epi64(_mm_max_epi64(a_.m128i, _mm_set1_epi64x(min)), _mm_set1_epi64x(max));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : ((a_.values[i] < min) ? min : a_.values[i]);
+      }
+    #endif
+
+    return simde_v2i64_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_s_d(a, imm0_63) __msa_sat_s_d((a), (imm0_63))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_s_d
+  #define __msa_sat_s_d(a, imm0_63) simde_msa_sat_s_d((a), (imm0_63))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v16u8
+simde_msa_sat_u_b(simde_v16u8 a, const int imm0_7)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_7, 0, 7) {
+  const uint8_t max = HEDLEY_STATIC_CAST(uint8_t, UINT8_MAX >> (7 - imm0_7));
+
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vminq_u8(a, vdupq_n_u8(max));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_min(a, vec_splats(HEDLEY_STATIC_CAST(unsigned char, max)));
+  #else
+    simde_v16u8_private
+      a_ = simde_v16u8_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.m128i = _mm_min_epu8(a_.m128i, _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, max)));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 = wasm_u8x16_min(a_.v128, wasm_u8x16_splat(max));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : a_.values[i];
+      }
+    #endif
+
+    return simde_v16u8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_u_b(a, imm0_7) __msa_sat_u_b((a), (imm0_7))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_u_b
+  #define __msa_sat_u_b(a, imm0_7) simde_msa_sat_u_b((a), (imm0_7))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v8u16
+simde_msa_sat_u_h(simde_v8u16 a, const int imm0_15)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_15, 0, 15) {
+  const uint16_t max = HEDLEY_STATIC_CAST(uint16_t, UINT16_MAX >> (15 - imm0_15));
+
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vminq_u16(a, vdupq_n_u16(max));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_min(a, vec_splats(HEDLEY_STATIC_CAST(unsigned short, max)));
+  #else
+    simde_v8u16_private
+      a_ = simde_v8u16_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i = _mm_min_epu16(a_.m128i, _mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, max)));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 = wasm_u16x8_min(a_.v128, wasm_u16x8_splat(max));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : a_.values[i];
+      }
+    #endif
+
+    return simde_v8u16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_u_h(a, imm0_15) __msa_sat_u_h((a), (imm0_15))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_u_h
+  #define __msa_sat_u_h(a, imm0_15) simde_msa_sat_u_h((a), (imm0_15))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v4u32
+simde_msa_sat_u_w(simde_v4u32 a, const int imm0_31)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_31, 0, 31) {
+  const uint32_t max = HEDLEY_STATIC_CAST(uint32_t, UINT32_MAX >> (31 - imm0_31));
+
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vminq_u32(a, vdupq_n_u32(max));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    return vec_min(a, vec_splats(HEDLEY_STATIC_CAST(unsigned int, max)));
+  #else
+    simde_v4u32_private
+      a_ = simde_v4u32_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.m128i = _mm_min_epu32(a_.m128i, _mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, max)));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.v128 = wasm_u32x4_min(a_.v128, wasm_u32x4_splat(max));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : a_.values[i];
+      }
+    #endif
+
+    return simde_v4u32_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_u_w(a, imm0_31) __msa_sat_u_w((a), (imm0_31))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_u_w
+  #define __msa_sat_u_w(a, imm0_31) simde_msa_sat_u_w((a), (imm0_31))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v2u64
+simde_msa_sat_u_d(simde_v2u64 a, const int imm0_63)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm0_63, 0, 63) {
+  const uint64_t max = HEDLEY_STATIC_CAST(uint64_t, UINT64_MAX >> (63 - imm0_63));
+
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vbslq_u64(vcgtq_u64(a, vdupq_n_u64(max)), vdupq_n_u64(max), a);
+  #elif defined(SIMDE_POWER_ALTIVEC_P8_NATIVE)
+    return vec_min(a, vec_splats(HEDLEY_STATIC_CAST(unsigned long long, max)));
+  #else
+    simde_v2u64_private
+      a_ = simde_v2u64_to_private(a),
+      r_;
+
+    #if defined(SIMDE_X86_AVX512VL_NATIVE)
+      r_.m128i = _mm_min_epu64(a_.m128i, _mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, max)));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        r_.values[i] = (a_.values[i] > max) ? max : a_.values[i];
+      }
+    #endif
+
+    return simde_v2u64_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_NATIVE)
+  #define simde_msa_sat_u_d(a, imm0_63) __msa_sat_u_d((a), (imm0_63))
+#endif
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_sat_u_d
+  #define __msa_sat_u_d(a, imm0_63) simde_msa_sat_u_d((a), (imm0_63))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_MIPS_MSA_SAT_H) */
@@ -0,0 +1,315 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2021      Evan Nemerson <evan@nemerson.com>
+ */
+
+#if !defined(SIMDE_MIPS_MSA_VSHF_H)
+#define SIMDE_MIPS_MSA_VSHF_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v16i8
+simde_msa_vshf_b(simde_v16i8 c, simde_v16i8 a, simde_v16i8 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_vshf_b(c, a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    int8x16x2_t tab = { { b, a } };
+    return vqtbl2q_s8(tab, vreinterpretq_u8_s8(vandq_s8(c, vdupq_n_s8(HEDLEY_STATIC_CAST(int8_t, 0xdf)))));
+  #else
+    simde_v16i8_private
+      c_ = simde_v16i8_to_private(c),
+      a_ = simde_v16i8_to_private(a),
+      b_ = simde_v16i8_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      /* pshufb only looks at bits 0-3 (and 7), so pick the source
+       * with bit 4 and clear lanes with bit 6 or 7 set afterwards. */
+      __m128i lo = _mm_shuffle_epi8(b_.m128i, c_.m128i);
+      __m128i hi = _mm_shuffle_epi8(a_.m128i, c_.m128i);
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        r_.m128i = _mm_blendv_epi8(lo, hi, _mm_slli_epi16(c_.m128i, 3));
+      #else
+        __m128i sel = _mm_cmpeq_epi8(_mm_and_si128(c_.m128i, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x10));
+        r_.m128i = _mm_or_si128(_mm_and_si128(sel, hi), _mm_andnot_si128(sel, lo));
+      #endif
+      r_.m128i = _mm_and_si128(r_.m128i, _mm_cmpeq_epi8(_mm_and_si128(c_.m128i, _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, 0xc0))), _mm_setzero_si128()));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      /* Out-of-range indices produce zero, which takes care of
+       * bits 6 and 7 as long as bit 5 is masked off. */
+      v128_t idx = wasm_v128_and(c_.v128, wasm_i8x16_splat(HEDLEY_STATIC_CAST(int8_t, 0xdf)));
+      r_.v128 =
+        wasm_v128_or(
+          wasm_i8x16_swizzle(b_.v128, idx),
+          wasm_i8x16_swizzle(a_.v128, wasm_i8x16_sub(idx, wasm_i8x16_splat(16)))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        const size_t idx = HEDLEY_STATIC_CAST(size_t, c_.values[i] & 31);
+        if (c_.values[i] & 0xc0) {
+          r_.values[i] = 0;
+        } else {
+          r_.values[i] = (idx < 16) ? b_.values[idx] : a_.values[idx - 16];
+        }
+      }
+    #endif
+
+    return simde_v16i8_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_vshf_b
+  #define __msa_vshf_b(c, a, b) simde_msa_vshf_b((c), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v8i16
+simde_msa_vshf_h(simde_v8i16 c, simde_v8i16 a, simde_v8i16 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_vshf_h(c, a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    /* Replicate the low byte of each control element across the
+     * element, turn it into byte indices into { b, a }, and push
+     * lanes with bit 6 or 7 set out of range so the lookup zeroes
+     * them. */
+    static const uint8_t bcast[16] = {  0,  0,  2,  2,  4,  4,  6,  6,  8,  8, 10, 10, 12, 12, 14, 14 };
+    static const uint8_t offs[16] = { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+    uint8x16_t cb = vqtbl1q_u8(vreinterpretq_u8_s16(c), vld1q_u8(bcast));
+    uint8x16_t idx = vorrq_u8(vandq_u8(vshlq_n_u8(cb, 1), vdupq_n_u8(0x1e)), vld1q_u8(offs));
+    idx = vorrq_u8(idx, vtstq_u8(cb, vdupq_n_u8(0xc0)));
+    int8x16x2_t tab = { { vreinterpretq_s8_s16(b), vreinterpretq_s8_s16(a) } };
+    return vreinterpretq_s16_s8(vqtbl2q_s8(tab, idx));
+  #else
+    simde_v8i16_private
+      c_ = simde_v8i16_to_private(c),
+      a_ = simde_v8i16_to_private(a),
+      b_ = simde_v8i16_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      /* Same byte index construction as the NEON version; the byte
+       * shift may carry bits across bytes, but only into bits the
+       * mask clears. */
+      __m128i cb = _mm_shuffle_epi8(c_.m128i, _mm_setr_epi8( 0,  0,  2,  2,  4,  4,  6,  6,  8,  8, 10, 10, 12, 12, 14, 14));
+      __m128i idx =
+        _mm_or_si128(
+          _mm_and_si128(_mm_slli_epi16(cb, 1), _mm_set1_epi8(0x1e)),
+          _mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1)
+        );
+      __m128i lo = _mm_shuffle_epi8(b_.m128i, idx);
+      __m128i hi = _mm_shuffle_epi8(a_.m128i, idx);
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        r_.m128i = _mm_blendv_epi8(lo, hi, _mm_slli_epi16(idx, 3));
+      #else
+        __m128i sel = _mm_cmpeq_epi8(_mm_and_si128(idx, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x10));
+        r_.m128i = _mm_or_si128(_mm_and_si128(sel, hi), _mm_andnot_si128(sel, lo));
+      #endif
+      r_.m128i = _mm_and_si128(r_.m128i, _mm_cmpeq_epi8(_mm_and_si128(cb, _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, 0xc0))), _mm_setzero_si128()));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      v128_t cb = wasm_i8x16_swizzle(c_.v128, wasm_i8x16_make( 0,  0,  2,  2,  4,  4,  6,  6,  8,  8, 10, 10, 12, 12, 14, 14));
+      v128_t idx =
+        wasm_v128_or(
+          wasm_v128_and(wasm_i8x16_shl(cb, 1), wasm_i8x16_splat(0x1e)),
+          wasm_i8x16_make(0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1)
+        );
+      r_.v128 =
+        wasm_v128_and(
+          wasm_v128_or(
+            wasm_i8x16_swizzle(b_.v128, idx),
+            wasm_i8x16_swizzle(a_.v128, wasm_i8x16_sub(idx, wasm_i8x16_splat(16)))
+          ),
+          wasm_i8x16_eq(wasm_v128_and(cb, wasm_i8x16_splat(HEDLEY_STATIC_CAST(int8_t, 0xc0))), wasm_i8x16_splat(0))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        const size_t idx = HEDLEY_STATIC_CAST(size_t, c_.values[i] & 15);
+        if (c_.values[i] & 0xc0) {
+          r_.values[i] = 0;
+        } else {
+          r_.values[i] = (idx < 8) ? b_.values[idx] : a_.values[idx - 8];
+        }
+      }
+    #endif
+
+    return simde_v8i16_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_vshf_h
+  #define __msa_vshf_h(c, a, b) simde_msa_vshf_h((c), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v4i32
+simde_msa_vshf_w(simde_v4i32 c, simde_v4i32 a, simde_v4i32 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_vshf_w(c, a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    static const uint8_t bcast[16] = {  0,  0,  0,  0,  4,  4,  4,  4,  8,  8,  8,  8, 12, 12, 12, 12 };
+    static const uint8_t offs[16] = { 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 };
+    uint8x16_t cb = vqtbl1q_u8(vreinterpretq_u8_s32(c), vld1q_u8(bcast));
+    uint8x16_t idx = vorrq_u8(vandq_u8(vshlq_n_u8(cb, 2), vdupq_n_u8(0x1c)), vld1q_u8(offs));
+    idx = vorrq_u8(idx, vtstq_u8(cb, vdupq_n_u8(0xc0)));
+    int8x16x2_t tab = { { vreinterpretq_s8_s32(b), vreinterpretq_s8_s32(a) } };
+    return vreinterpretq_s32_s8(vqtbl2q_s8(tab, idx));
+  #else
+    simde_v4i32_private
+      c_ = simde_v4i32_to_private(c),
+      a_ = simde_v4i32_to_private(a),
+      b_ = simde_v4i32_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      __m128i cb = _mm_shuffle_epi8(c_.m128i, _mm_setr_epi8( 0,  0,  0,  0,  4,  4,  4,  4,  8,  8,  8,  8, 12, 12, 12, 12));
+      __m128i idx =
+        _mm_or_si128(
+          _mm_and_si128(_mm_slli_epi16(cb, 2), _mm_set1_epi8(0x1c)),
+          _mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3)
+        );
+      __m128i lo = _mm_shuffle_epi8(b_.m128i, idx);
+      __m128i hi = _mm_shuffle_epi8(a_.m128i, idx);
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        r_.m128i = _mm_blendv_epi8(lo, hi, _mm_slli_epi16(idx, 3));
+      #else
+        __m128i sel = _mm_cmpeq_epi8(_mm_and_si128(idx, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x10));
+        r_.m128i = _mm_or_si128(_mm_and_si128(sel, hi), _mm_andnot_si128(sel, lo));
+      #endif
+      r_.m128i = _mm_and_si128(r_.m128i, _mm_cmpeq_epi8(_mm_and_si128(cb, _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, 0xc0))), _mm_setzero_si128()));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      v128_t cb = wasm_i8x16_swizzle(c_.v128, wasm_i8x16_make( 0,  0,  0,  0,  4,  4,  4,  4,  8,  8,  8,  8, 12, 12, 12, 12));
+      v128_t idx =
+        wasm_v128_or(
+          wasm_v128_and(wasm_i8x16_shl(cb, 2), wasm_i8x16_splat(0x1c)),
+          wasm_i8x16_make(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3)
+        );
+      r_.v128 =
+        wasm_v128_and(
+          wasm_v128_or(
+            wasm_i8x16_swizzle(b_.v128, idx),
+            wasm_i8x16_swizzle(a_.v128, wasm_i8x16_sub(idx, wasm_i8x16_splat(16)))
+          ),
+          wasm_i8x16_eq(wasm_v128_and(cb, wasm_i8x16_splat(HEDLEY_STATIC_CAST(int8_t, 0xc0))), wasm_i8x16_splat(0))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        const size_t idx = HEDLEY_STATIC_CAST(size_t, c_.values[i] & 7);
+        if (c_.values[i] & 0xc0) {
+          r_.values[i] = 0;
+        } else {
+          r_.values[i] = (idx < 4) ? b_.values[idx] : a_.values[idx - 4];
+        }
+      }
+    #endif
+
+    return simde_v4i32_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_vshf_w
+  #define __msa_vshf_w(c, a, b) simde_msa_vshf_w((c), (a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v2i64
+simde_msa_vshf_d(simde_v2i64 c, simde_v2i64 a, simde_v2i64 b) {
+  #if defined(SIMDE_MIPS_MSA_NATIVE)
+    return __msa_vshf_d(c, a, b);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    static const uint8_t bcast[16] = {  0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8 };
+    static const uint8_t offs[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+    uint8x16_t cb = vqtbl1q_u8(vreinterpretq_u8_s64(c), vld1q_u8(bcast));
+    uint8x16_t idx = vorrq_u8(vandq_u8(vshlq_n_u8(cb, 3), vdupq_n_u8(0x18)), vld1q_u8(offs));
+    idx = vorrq_u8(idx, vtstq_u8(cb, vdupq_n_u8(0xc0)));
+    int8x16x2_t tab = { { vreinterpretq_s8_s64(b), vreinterpretq_s8_s64(a) } };
+    return vreinterpretq_s64_s8(vqtbl2q_s8(tab, idx));
+  #else
+    simde_v2i64_private
+      c_ = simde_v2i64_to_private(c),
+      a_ = simde_v2i64_to_private(a),
+      b_ = simde_v2i64_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      __m128i cb = _mm_shuffle_epi8(c_.m128i, _mm_setr_epi8( 0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8));
+      __m128i idx =
+        _mm_or_si128(
+          _mm_and_si128(_mm_slli_epi16(cb, 3), _mm_set1_epi8(0x18)),
+          _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7)
+        );
+      __m128i lo = _mm_shuffle_epi8(b_.m128i, idx);
+      __m128i hi = _mm_shuffle_epi8(a_.m128i, idx);
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        r_.m128i = _mm_blendv_epi8(lo, hi, _mm_slli_epi16(idx, 3));
+      #else
+        __m128i sel = _mm_cmpeq_epi8(_mm_and_si128(idx, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x10));
+        r_.m128i = _mm_or_si128(_mm_and_si128(sel, hi), _mm_andnot_si128(sel, lo));
+      #endif
+      r_.m128i = _mm_and_si128(r_.m128i, _mm_cmpeq_epi8(_mm_and_si128(cb, _mm_set1_epi8(HEDLEY_STATIC_CAST(int8_t, 0xc0))), _mm_setzero_si128()));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      v128_t cb = wasm_i8x16_swizzle(c_.v128, wasm_i8x16_make( 0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8));
+      v128_t idx =
+        wasm_v128_or(
+          wasm_v128_and(wasm_i8x16_shl(cb, 3), wasm_i8x16_splat(0x18)),
+          wasm_i8x16_make(0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7)
+        );
+      r_.v128 =
+        wasm_v128_and(
+          wasm_v128_or(
+            wasm_i8x16_swizzle(b_.v128, idx),
+            wasm_i8x16_swizzle(a_.v128, wasm_i8x16_sub(idx, wasm_i8x16_splat(16)))
+          ),
+          wasm_i8x16_eq(wasm_v128_and(cb, wasm_i8x16_splat(HEDLEY_STATIC_CAST(int8_t, 0xc0))), wasm_i8x16_splat(0))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+        const size_t idx = HEDLEY_STATIC_CAST(size_t, c_.values[i] & 3);
+        if (c_.values[i] & 0xc0) {
+          r_.values[i] = 0;
+        } else {
+          r_.values[i] = (idx < 2) ? b_.values[idx] : a_.values[idx - 2];
+        }
+      }
+    #endif
+
+    return simde_v2i64_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_MIPS_MSA_ENABLE_NATIVE_ALIASES)
+  #undef __msa_vshf_d
+  #define __msa_vshf_d(c, a, b) simde_msa_vshf_d((c), (a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_MIPS_MSA_VSHF_H) */
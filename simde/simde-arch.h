@@ -298,6 +298,9 @@
 #  if defined(__AVX512VBMI2__)
 #    define SIMDE_ARCH_X86_AVX512VBMI2 1
 #  endif
+#  if defined(__AVX512IFMA__)
+#    define SIMDE_ARCH_X86_AVX512IFMA 1
+#  endif
 #  if defined(__AVX512VNNI__)
 #    define SIMDE_ARCH_X86_AVX512VNNI 1
 #  endif
@@ -313,6 +316,9 @@
 #  if defined(__AVX512CD__)
 #    define SIMDE_ARCH_X86_AVX512CD 1
 #  endif
+#  if defined(__AVX512FP16__)
+#    define SIMDE_ARCH_X86_AVX512FP16 1
+#  endif
 #  if defined(__AVX512DQ__)
 #    define SIMDE_ARCH_X86_AVX512DQ 1
 #  endif
@@ -328,6 +334,12 @@
 #  if defined(__PCLMUL__)
 #    define SIMDE_ARCH_X86_PCLMUL 1
 #  endif
+#  if defined(__AES__)
+#    define SIMDE_ARCH_X86_AES 1
+#  endif
+#  if defined(__SHA__)
+#    define SIMDE_ARCH_X86_SHA 1
+#  endif
 #  if defined(__VPCLMULQDQ__)
 #    define SIMDE_ARCH_X86_VPCLMULQDQ 1
 #  endif
@@ -560,6 +572,10 @@
 #  define SIMDE_ARCH_WASM_SIMD128
 #endif
 
+#if defined(SIMDE_ARCH_WASM) && defined(__wasm_relaxed_simd__)
+#  define SIMDE_ARCH_WASM_RELAXED_SIMD
+#endif
+
 /* Xtensa
    <https://en.wikipedia.org/wiki/> */
 #if defined(__xtensa__) || defined(__XTENSA__)
@@ -571,6 +587,11 @@
 #  define SIMDE_ARCH_ARM_NEON_FP16
 #endif
 
+/* Availability of bfloat16 NEON intrinsics (BFDOT, BFMMLA, ...) */
+#if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+#  define SIMDE_ARCH_ARM_NEON_BF16
+#endif
+
 /* LoongArch
    <https://en.wikipedia.org/wiki/Loongson#LoongArch> */
 #if defined(__loongarch32)
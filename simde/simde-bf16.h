@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "hedley.h"
+#include "simde-common.h"
+
+#if !defined(SIMDE_BFLOAT16_H)
+#define SIMDE_BFLOAT16_H
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* bfloat16 is simply the upper 16 bits of an IEEE 754 binary32.
+ * Compiler support for a scalar type (__bf16, __bfloat16, bfloat16_t)
+ * differs a lot between compilers, versions and targets, and some of
+ * them treat it as an arithmetic type while others use an integer
+ * typedef, so SIMDe only ever stores the raw bits.  Use the functions
+ * below to convert to and from single-precision floats. */
+typedef struct { uint16_t value; } simde_bfloat16;
+
+SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_bfloat16_as_uint16,       uint16_t, simde_bfloat16)
+SIMDE_DEFINE_CONVERSION_FUNCTION_(simde_uint16_as_bfloat16, simde_bfloat16,       uint16_t)
+
+#define SIMDE_NANBF simde_uint16_as_bfloat16(0x7FC0)
+#define SIMDE_INFINITYBF simde_uint16_as_bfloat16(0x7F80)
+
+/* Round to nearest, ties to even.  NaNs are quieted but otherwise
+ * keep their sign and the upper bits of their payload; subnormals are
+ * rounded like any other value. */
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+simde_bfloat16
+simde_bfloat16_from_float32 (simde_float32 value) {
+  uint32_t f32u = simde_float32_as_uint32(value);
+
+  if ((f32u & UINT32_C(0x7fffffff)) > UINT32_C(0x7f800000))
+    return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, (f32u >> 16) | UINT32_C(0x0040)));
+
+  f32u += UINT32_C(0x7fff) + ((f32u >> 16) & UINT32_C(1));
+  return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, f32u >> 16));
+}
+
+static HEDLEY_ALWAYS_INLINE HEDLEY_CONST
+simde_float32
+simde_bfloat16_to_float32 (simde_bfloat16 value) {
+  return simde_uint32_as_float32(HEDLEY_STATIC_CAST(uint32_t, simde_bfloat16_as_uint16(value)) << 16);
+}
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_BFLOAT16_H) */
@@ -88,6 +88,15 @@
   #define SIMDE_X86_AVX512F_NATIVE
 #endif
 
+#if !defined(SIMDE_X86_AVX512IFMA_NATIVE) && !defined(SIMDE_X86_AVX512IFMA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AVX512IFMA)
+    #define SIMDE_X86_AVX512IFMA_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_AVX512IFMA_NATIVE) && !defined(SIMDE_X86_AVX512F_NATIVE)
+  #define SIMDE_X86_AVX512F_NATIVE
+#endif
+
 #if !defined(SIMDE_X86_AVX512VNNI_NATIVE) && !defined(SIMDE_X86_AVX512VNNI_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_AVX512VNNI)
     #define SIMDE_X86_AVX512VNNI_NATIVE
@@ -151,6 +160,15 @@
   #define SIMDE_X86_AVX512F_NATIVE
 #endif
 
+#if !defined(SIMDE_X86_AVX512FP16_NATIVE) && !defined(SIMDE_X86_AVX512FP16_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AVX512FP16)
+    #define SIMDE_X86_AVX512FP16_NATIVE
+  #endif
+#endif
+#if defined(SIMDE_X86_AVX512FP16_NATIVE) && !defined(SIMDE_X86_AVX512F_NATIVE)
+  #define SIMDE_X86_AVX512F_NATIVE
+#endif
+
 #if !defined(SIMDE_X86_AVX512F_NATIVE) && !defined(SIMDE_X86_AVX512F_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_AVX512F)
     #define SIMDE_X86_AVX512F_NATIVE
@@ -265,6 +283,18 @@
   #endif
 #endif
 
+#if !defined(SIMDE_X86_AES_NATIVE) && !defined(SIMDE_X86_AES_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_AES)
+    #define SIMDE_X86_AES_NATIVE
+  #endif
+#endif
+
+#if !defined(SIMDE_X86_SHA_NATIVE) && !defined(SIMDE_X86_SHA_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_X86_SHA)
+    #define SIMDE_X86_SHA_NATIVE
+  #endif
+#endif
+
 #if !defined(SIMDE_X86_VPCLMULQDQ_NATIVE) && !defined(SIMDE_X86_VPCLMULQDQ_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_X86_VPCLMULQDQ)
     #define SIMDE_X86_VPCLMULQDQ_NATIVE
@@ -289,7 +319,9 @@
 #endif
 
 #if \
-    defined(SIMDE_X86_AVX_NATIVE) || defined(SIMDE_X86_GFNI_NATIVE)
+    defined(SIMDE_X86_AVX_NATIVE) || defined(SIMDE_X86_GFNI_NATIVE) || \
+    defined(SIMDE_X86_PCLMUL_NATIVE) || defined(SIMDE_X86_AES_NATIVE) || \
+    defined(SIMDE_X86_SHA_NATIVE)
   #include <immintrin.h>
 #elif defined(SIMDE_X86_SSE4_2_NATIVE)
   #include <nmmintrin.h>
@@ -365,6 +397,12 @@
   #include <wasm_simd128.h>
 #endif
 
+#if !defined(SIMDE_WASM_RELAXED_SIMD_NATIVE) && !defined(SIMDE_WASM_RELAXED_SIMD_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
+  #if defined(SIMDE_ARCH_WASM_RELAXED_SIMD)
+    #define SIMDE_WASM_RELAXED_SIMD_NATIVE
+  #endif
+#endif
+
 #if !defined(SIMDE_POWER_ALTIVEC_P9_NATIVE) && !defined(SIMDE_POWER_ALTIVEC_P9_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if SIMDE_ARCH_POWER_ALTIVEC_CHECK(900)
     #define SIMDE_POWER_ALTIVEC_P9_NATIVE
@@ -599,6 +637,9 @@
   #if !defined(SIMDE_X86_AVX512VBMI2_NATIVE)
     #define SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES
   #endif
+  #if !defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    #define SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES
+  #endif
   #if !defined(SIMDE_X86_AVX512BW_NATIVE)
     #define SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES
   #endif
@@ -611,6 +652,9 @@
   #if !defined(SIMDE_X86_AVX512BF16_NATIVE)
     #define SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES
   #endif
+  #if !defined(SIMDE_X86_AVX512FP16_NATIVE)
+    #define SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES
+  #endif
   #if !defined(SIMDE_X86_AVX512BITALG_NATIVE)
     #define SIMDE_X86_AVX512BITALG_ENABLE_NATIVE_ALIASES
   #endif
@@ -653,6 +697,10 @@
   #if !defined(SIMDE_WASM_SIMD128_NATIVE)
     #define SIMDE_WASM_SIMD128_ENABLE_NATIVE_ALIASES
   #endif
+
+  #if !defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    #define SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES
+  #endif
 #endif
 
 /* Are floating point values stored using IEEE 754?  Knowing
@@ -682,6 +730,10 @@
   #define SIMDE_ARM_NEON_FP16
 #endif
 
+#if defined(SIMDE_ARCH_ARM_NEON_BF16)
+  #define SIMDE_ARM_NEON_BF16
+#endif
+
 #if !defined(SIMDE_LOONGARCH_LASX_NATIVE) && !defined(SIMDE_LOONGARCH_LASX_NO_NATIVE) && !defined(SIMDE_NO_NATIVE)
   #if defined(SIMDE_ARCH_LOONGARCH_LASX)
     #define SIMDE_LOONGARCH_LASX_NATIVE
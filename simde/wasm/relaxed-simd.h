@@ -257,11 +257,66 @@ simde_wasm_u32x4_trunc_f64x2_zero (simde_v128_t a) {
   #define wasm_u32x4_trunc_f64x2_zero(a) simde_wasm_u32x4_trunc_f64x2_zero((a))
 #endif
 
+/* The trunc functions above predate the relaxed_ prefix; these are the
+ * names current wasm_simd128.h uses. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i32x4_relaxed_trunc_f32x4 (simde_v128_t a) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i32x4_relaxed_trunc_f32x4(a);
+  #else
+    return simde_wasm_i32x4_trunc_f32x4(a);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i32x4_relaxed_trunc_f32x4(a) simde_wasm_i32x4_relaxed_trunc_f32x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_u32x4_relaxed_trunc_f32x4 (simde_v128_t a) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_u32x4_relaxed_trunc_f32x4(a);
+  #else
+    return simde_wasm_u32x4_trunc_f32x4(a);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_u32x4_relaxed_trunc_f32x4(a) simde_wasm_u32x4_relaxed_trunc_f32x4((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i32x4_relaxed_trunc_f64x2_zero (simde_v128_t a) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i32x4_relaxed_trunc_f64x2_zero(a);
+  #else
+    return simde_wasm_i32x4_trunc_f64x2_zero(a);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i32x4_relaxed_trunc_f64x2_zero(a) simde_wasm_i32x4_relaxed_trunc_f64x2_zero((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_u32x4_relaxed_trunc_f64x2_zero (simde_v128_t a) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_u32x4_relaxed_trunc_f64x2_zero(a);
+  #else
+    return simde_wasm_u32x4_trunc_f64x2_zero(a);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_u32x4_relaxed_trunc_f64x2_zero(a) simde_wasm_u32x4_relaxed_trunc_f64x2_zero((a))
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_i8x16_blend(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_i8x16_blend(a, b, mask);
+    return wasm_i8x16_relaxed_laneselect(a, b, mask);
   #elif defined(SIMDE_X86_SSE4_1_NATIVE)
     simde_v128_private
       a_ = simde_v128_to_private(a),
@@ -284,7 +339,7 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_i16x8_blend(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_i16x8_blend(a, b, mask);
+    return wasm_i16x8_relaxed_laneselect(a, b, mask);
   #elif defined(SIMDE_X86_SSE4_1_NATIVE)
     simde_v128_private
       a_ = simde_v128_to_private(a),
@@ -307,7 +362,7 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_i32x4_blend(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_i32x4_blend(a, b, mask);
+    return wasm_i32x4_relaxed_laneselect(a, b, mask);
   #elif defined(SIMDE_X86_SSE4_1_NATIVE)
     simde_v128_private
       a_ = simde_v128_to_private(a),
@@ -330,7 +385,7 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_i64x2_blend(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_i64x2_blend(a, b, mask);
+    return wasm_i64x2_relaxed_laneselect(a, b, mask);
   #elif defined(SIMDE_X86_SSE4_1_NATIVE)
     simde_v128_private
       a_ = simde_v128_to_private(a),
@@ -355,7 +410,7 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_f32x4_fma (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_f32x4_fma(a, b, c);
+    return wasm_f32x4_relaxed_madd(b, c, a);
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     return wasm_f32x4_add(a, wasm_f32x4_mul(b, c));
   #else
@@ -386,14 +441,14 @@ simde_wasm_f32x4_fma (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #endif
 }
 #if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
-  #define wasm_f32x4_fma(a, b) simde_wasm_f32x4_fma((a), (b))
+  #define wasm_f32x4_fma(a, b, c) simde_wasm_f32x4_fma((a), (b), (c))
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_f64x2_fma (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_f64x2_fma(a, b, c);
+    return wasm_f64x2_relaxed_madd(b, c, a);
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     return wasm_f64x2_add(a, wasm_f64x2_mul(b, c));
   #else
@@ -422,7 +477,7 @@ simde_wasm_f64x2_fma (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #endif
 }
 #if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
-  #define wasm_f64x2_fma(a, b) simde_wasm_f64x2_fma((a), (b))
+  #define wasm_f64x2_fma(a, b, c) simde_wasm_f64x2_fma((a), (b), (c))
 #endif
 
 /* fms */
@@ -431,7 +486,7 @@ SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_f32x4_fms (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_f32x4_fms(a, b, c);
+    return wasm_f32x4_relaxed_nmadd(b, c, a);
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     return wasm_f32x4_sub(a, wasm_f32x4_mul(b, c));
   #else
@@ -462,14 +517,14 @@ simde_wasm_f32x4_fms (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #endif
 }
 #if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
-  #define wasm_f32x4_fms(a, b) simde_wasm_f32x4_fms((a), (b))
+  #define wasm_f32x4_fms(a, b, c) simde_wasm_f32x4_fms((a), (b), (c))
 #endif
 
 SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_f64x2_fms (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
-    return wasm_f64x2_fms(a, b, c);
+    return wasm_f64x2_relaxed_nmadd(b, c, a);
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     return wasm_f64x2_sub(a, wasm_f64x2_mul(b, c));
   #else
@@ -498,7 +553,392 @@ simde_wasm_f64x2_fms (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
   #endif
 }
 #if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
-  #define wasm_f64x2_fms(a, b) simde_wasm_f64x2_fms((a), (b))
+  #define wasm_f64x2_fms(a, b, c) simde_wasm_f64x2_fms((a), (b), (c))
+#endif
+
+/* relaxed_madd / relaxed_nmadd take the addend last: a * b + c and
+ * -(a * b) + c. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f32x4_relaxed_madd (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f32x4_relaxed_madd(a, b, c);
+  #else
+    return simde_wasm_f32x4_fma(c, a, b);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f32x4_relaxed_madd(a, b, c) simde_wasm_f32x4_relaxed_madd((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f64x2_relaxed_madd (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f64x2_relaxed_madd(a, b, c);
+  #else
+    return simde_wasm_f64x2_fma(c, a, b);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f64x2_relaxed_madd(a, b, c) simde_wasm_f64x2_relaxed_madd((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f32x4_relaxed_nmadd (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f32x4_relaxed_nmadd(a, b, c);
+  #else
+    return simde_wasm_f32x4_fms(c, a, b);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f32x4_relaxed_nmadd(a, b, c) simde_wasm_f32x4_relaxed_nmadd((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f64x2_relaxed_nmadd (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f64x2_relaxed_nmadd(a, b, c);
+  #else
+    return simde_wasm_f64x2_fms(c, a, b);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f64x2_relaxed_nmadd(a, b, c) simde_wasm_f64x2_relaxed_nmadd((a), (b), (c))
+#endif
+
+/* laneselect */
+
+/* Relaxed: on x86 (SSE4.1) only the most significant bit of each mask
+ * lane is used, everywhere else the selection is bitwise.  Both match
+ * the specification when every mask lane is all ones or all zeros. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i8x16_relaxed_laneselect(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i8x16_relaxed_laneselect(a, b, mask);
+  #else
+    return simde_wasm_i8x16_blend(a, b, mask);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i8x16_relaxed_laneselect(a, b, mask) simde_wasm_i8x16_relaxed_laneselect((a), (b), (mask))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i16x8_relaxed_laneselect(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i16x8_relaxed_laneselect(a, b, mask);
+  #else
+    return simde_wasm_i16x8_blend(a, b, mask);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i16x8_relaxed_laneselect(a, b, mask) simde_wasm_i16x8_relaxed_laneselect((a), (b), (mask))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i32x4_relaxed_laneselect(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i32x4_relaxed_laneselect(a, b, mask);
+  #else
+    return simde_wasm_i32x4_blend(a, b, mask);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i32x4_relaxed_laneselect(a, b, mask) simde_wasm_i32x4_relaxed_laneselect((a), (b), (mask))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i64x2_relaxed_laneselect(simde_v128_t a, simde_v128_t b, simde_v128_t mask) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i64x2_relaxed_laneselect(a, b, mask);
+  #else
+    return simde_wasm_i64x2_blend(a, b, mask);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i64x2_relaxed_laneselect(a, b, mask) simde_wasm_i64x2_relaxed_laneselect((a), (b), (mask))
+#endif
+
+/* min */
+
+/* Relaxed: the result is only specified when neither input is NaN and
+ * the inputs are not zeros of different signs.  On x86 (minps) the
+ * second operand is returned in those cases, NEON and POWER return a
+ * NaN / -0.0. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f32x4_relaxed_min (simde_v128_t a, simde_v128_t b) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f32x4_relaxed_min(a, b);
+  #else
+    simde_v128_private
+      a_ = simde_v128_to_private(a),
+      b_ = simde_v128_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSE_NATIVE)
+      r_.sse_m128 = _mm_min_ps(a_.sse_m128, b_.sse_m128);
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.neon_f32 = vminq_f32(a_.neon_f32, b_.neon_f32);
+    #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r_.altivec_f32 = vec_min(a_.altivec_f32, b_.altivec_f32);
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.wasm_v128 = wasm_f32x4_pmin(a_.wasm_v128, b_.wasm_v128);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = (a_.f32[i] < b_.f32[i]) ? a_.f32[i] : b_.f32[i];
+      }
+    #endif
+
+    return simde_v128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f32x4_relaxed_min(a, b) simde_wasm_f32x4_relaxed_min((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f64x2_relaxed_min (simde_v128_t a, simde_v128_t b) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f64x2_relaxed_min(a, b);
+  #else
+    simde_v128_private
+      a_ = simde_v128_to_private(a),
+      b_ = simde_v128_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.sse_m128d = _mm_min_pd(a_.sse_m128d, b_.sse_m128d);
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f64 = vminq_f64(a_.neon_f64, b_.neon_f64);
+    #elif defined(SIMDE_POWER_ALTIVEC_P7_NATIVE) || defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r_.altivec_f64 = vec_min(a_.altivec_f64, b_.altivec_f64);
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.wasm_v128 = wasm_f64x2_pmin(a_.wasm_v128, b_.wasm_v128);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = (a_.f64[i] < b_.f64[i]) ? a_.f64[i] : b_.f64[i];
+      }
+    #endif
+
+    return simde_v128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f64x2_relaxed_min(a, b) simde_wasm_f64x2_relaxed_min((a), (b))
+#endif
+
+/* max */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f32x4_relaxed_max (simde_v128_t a, simde_v128_t b) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f32x4_relaxed_max(a, b);
+  #else
+    simde_v128_private
+      a_ = simde_v128_to_private(a),
+      b_ = simde_v128_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSE_NATIVE)
+      r_.sse_m128 = _mm_max_ps(a_.sse_m128, b_.sse_m128);
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.neon_f32 = vmaxq_f32(a_.neon_f32, b_.neon_f32);
+    #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r_.altivec_f32 = vec_max(a_.altivec_f32, b_.altivec_f32);
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.wasm_v128 = wasm_f32x4_pmax(a_.wasm_v128, b_.wasm_v128);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = (a_.f32[i] > b_.f32[i]) ? a_.f32[i] : b_.f32[i];
+      }
+    #endif
+
+    return simde_v128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f32x4_relaxed_max(a, b) simde_wasm_f32x4_relaxed_max((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_f64x2_relaxed_max (simde_v128_t a, simde_v128_t b) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_f64x2_relaxed_max(a, b);
+  #else
+    simde_v128_private
+      a_ = simde_v128_to_private(a),
+      b_ = simde_v128_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      r_.sse_m128d = _mm_max_pd(a_.sse_m128d, b_.sse_m128d);
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f64 = vmaxq_f64(a_.neon_f64, b_.neon_f64);
+    #elif defined(SIMDE_POWER_ALTIVEC_P7_NATIVE) || defined(SIMDE_ZARCH_ZVECTOR_13_NATIVE)
+      r_.altivec_f64 = vec_max(a_.altivec_f64, b_.altivec_f64);
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      r_.wasm_v128 = wasm_f64x2_pmax(a_.wasm_v128, b_.wasm_v128);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = (a_.f64[i] > b_.f64[i]) ? a_.f64[i] : b_.f64[i];
+      }
+    #endif
+
+    return simde_v128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_f64x2_relaxed_max(a, b) simde_wasm_f64x2_relaxed_max((a), (b))
+#endif
+
+/* q15mulr */
+
+/* Relaxed: INT16_MIN * INT16_MIN is INT16_MIN on x86 (pmulhrsw) and
+ * INT16_MAX (saturated) everywhere else. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i16x8_relaxed_q15mulr (simde_v128_t a, simde_v128_t b) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i16x8_relaxed_q15mulr(a, b);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    simde_v128_private
+      a_ = simde_v128_to_private(a),
+      b_ = simde_v128_to_private(b),
+      r_;
+
+    r_.sse_m128i = _mm_mulhrs_epi16(a_.sse_m128i, b_.sse_m128i);
+
+    return simde_v128_from_private(r_);
+  #else
+    return simde_wasm_i16x8_q15mulr_sat(a, b);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i16x8_relaxed_q15mulr(a, b) simde_wasm_i16x8_relaxed_q15mulr((a), (b))
+#endif
+
+/* dot */
+
+/* Relaxed: the lanes of b are supposed to be 7-bit.  If the top bit is
+ * set they are treated as unsigned on x86 (pmaddubsw / vpdpbusd) and
+ * as signed everywhere else.  The i16x8 result saturates on x86 and
+ * wraps elsewhere, which is only observable for inputs outside of the
+ * i7 range. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i16x8_relaxed_dot_i8x16_i7x16 (simde_v128_t a, simde_v128_t b) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i16x8_relaxed_dot_i8x16_i7x16(a, b);
+  #else
+    simde_v128_private
+      a_ = simde_v128_to_private(a),
+      b_ = simde_v128_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      r_.sse_m128i = _mm_maddubs_epi16(b_.sse_m128i, a_.sse_m128i);
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_i16 =
+        vpaddq_s16(
+          vmull_s8(vget_low_s8(a_.neon_i8), vget_low_s8(b_.neon_i8)),
+          vmull_high_s8(a_.neon_i8, b_.neon_i8));
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      int16x8_t lo = vmull_s8(vget_low_s8(a_.neon_i8), vget_low_s8(b_.neon_i8));
+      int16x8_t hi = vmull_s8(vget_high_s8(a_.neon_i8), vget_high_s8(b_.neon_i8));
+      r_.neon_i16 =
+        vcombine_s16(
+          vpadd_s16(vget_low_s16(lo), vget_high_s16(lo)),
+          vpadd_s16(vget_low_s16(hi), vget_high_s16(hi)));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
+        r_.i16[i] = HEDLEY_STATIC_CAST(int16_t,
+          (HEDLEY_STATIC_CAST(int16_t, a_.i8[(i * 2)    ]) * HEDLEY_STATIC_CAST(int16_t, b_.i8[(i * 2)    ])) +
+          (HEDLEY_STATIC_CAST(int16_t, a_.i8[(i * 2) + 1]) * HEDLEY_STATIC_CAST(int16_t, b_.i8[(i * 2) + 1])));
+      }
+    #endif
+
+    return simde_v128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i16x8_relaxed_dot_i8x16_i7x16(a, b) simde_wasm_i16x8_relaxed_dot_i8x16_i7x16((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_v128_t
+simde_wasm_i32x4_relaxed_dot_i8x16_i7x16_add (simde_v128_t a, simde_v128_t b, simde_v128_t c) {
+  #if defined(SIMDE_WASM_RELAXED_SIMD_NATIVE)
+    return wasm_i32x4_relaxed_dot_i8x16_i7x16_add(a, b, c);
+  #else
+    simde_v128_private
+      a_ = simde_v128_to_private(a),
+      b_ = simde_v128_to_private(b),
+      c_ = simde_v128_to_private(c),
+      r_;
+
+    #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+      r_.sse_m128i = _mm_dpbusd_epi32(c_.sse_m128i, b_.sse_m128i, a_.sse_m128i);
+    #elif defined(SIMDE_X86_SSSE3_NATIVE)
+      r_.sse_m128i =
+        _mm_add_epi32(
+          _mm_madd_epi16(_mm_maddubs_epi16(b_.sse_m128i, a_.sse_m128i), _mm_set1_epi16(1)),
+          c_.sse_m128i);
+    #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_DOTPROD)
+      r_.neon_i32 = vdotq_s32(c_.neon_i32, a_.neon_i8, b_.neon_i8);
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_i32 =
+        vaddq_s32(
+          c_.neon_i32,
+          vpaddq_s32(
+            vpaddlq_s16(vmull_s8(vget_low_s8(a_.neon_i8), vget_low_s8(b_.neon_i8))),
+            vpaddlq_s16(vmull_high_s8(a_.neon_i8, b_.neon_i8))));
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      int32x4_t lo = vpaddlq_s16(vmull_s8(vget_low_s8(a_.neon_i8), vget_low_s8(b_.neon_i8)));
+      int32x4_t hi = vpaddlq_s16(vmull_s8(vget_high_s8(a_.neon_i8), vget_high_s8(b_.neon_i8)));
+      r_.neon_i32 =
+        vaddq_s32(
+          c_.neon_i32,
+          vcombine_s32(
+            vpadd_s32(vget_low_s32(lo), vget_high_s32(lo)),
+            vpadd_s32(vget_low_s32(hi), vget_high_s32(hi))));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        int32_t sum = c_.i32[i];
+        for (size_t j = 0 ; j < 4 ; j++) {
+          sum += HEDLEY_STATIC_CAST(int32_t, a_.i8[(i * 4) + j]) * HEDLEY_STATIC_CAST(int32_t, b_.i8[(i * 4) + j]);
+        }
+        r_.i32[i] = sum;
+      }
+    #endif
+
+    return simde_v128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_WASM_RELAXED_SIMD_ENABLE_NATIVE_ALIASES)
+  #define wasm_i32x4_relaxed_dot_i8x16_i7x16_add(a, b, c) simde_wasm_i32x4_relaxed_dot_i8x16_i7x16_add((a), (b), (c))
 #endif
 
 SIMDE_END_DECLS_
@@ -2794,6 +2794,14 @@ simde_wasm_i8x16_bitmask (simde_v128_t a) {
 
     #if defined(SIMDE_X86_SSE2_NATIVE)
       r = HEDLEY_STATIC_CAST(uint32_t, _mm_movemask_epi8(a_.sse_m128i));
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      /* Move each sign bit to its position within the half and add
+       * the halves horizontally. */
+      static const int8_t shift[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7 };
+      uint8x16_t bits = vshlq_u8(vshrq_n_u8(a_.neon_u8, 7), vld1q_s8(shift));
+      r =
+        HEDLEY_STATIC_CAST(uint32_t, vaddv_u8(vget_low_u8(bits))) |
+        (HEDLEY_STATIC_CAST(uint32_t, vaddv_u8(vget_high_u8(bits))) << 8);
     #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       /* https://github.com/WebAssembly/simd/pull/201#issue-380682845 */
       static const uint8_t md[16] = {
@@ -2810,14 +2818,10 @@ simde_wasm_i8x16_bitmask (simde_v128_t a) {
       /* Alternate bytes from low half and high half */
       uint8x8x2_t tmp = vzip_u8(vget_low_u8(masked), vget_high_u8(masked));
       uint16x8_t x = vreinterpretq_u16_u8(vcombine_u8(tmp.val[0], tmp.val[1]));
-      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
-        r = vaddvq_u16(x);
-      #else
-        uint64x2_t t64 = vpaddlq_u32(vpaddlq_u16(x));
-        r =
-          HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 0)) +
-          HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 1));
-      #endif
+      uint64x2_t t64 = vpaddlq_u32(vpaddlq_u16(x));
+      r =
+        HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 0)) +
+        HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 1));
     #elif defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(SIMDE_BUG_CLANG_50932)
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) idx = { 120, 112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0 };
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) res = HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned char), vec_bperm(HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned __int128), a_.altivec_u64), idx));
@@ -2851,6 +2855,9 @@ simde_wasm_i16x8_bitmask (simde_v128_t a) {
 
     #if defined(SIMDE_X86_SSE2_NATIVE)
       r = HEDLEY_STATIC_CAST(uint32_t, _mm_movemask_epi8(_mm_packs_epi16(a_.sse_m128i, _mm_setzero_si128())));
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      static const int16_t shift[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+      r = vaddvq_u16(vshlq_u16(vshrq_n_u16(a_.neon_u16, 15), vld1q_s16(shift)));
     #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       static const uint16_t md[8] = {
         1 << 0, 1 << 1, 1 << 2, 1 << 3,
@@ -2859,14 +2866,10 @@ simde_wasm_i16x8_bitmask (simde_v128_t a) {
 
       uint16x8_t extended = vreinterpretq_u16_s16(vshrq_n_s16(a_.neon_i16, 15));
       uint16x8_t masked = vandq_u16(vld1q_u16(md), extended);
-      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
-        r = vaddvq_u16(masked);
-      #else
-        uint64x2_t t64 = vpaddlq_u32(vpaddlq_u16(masked));
-        r =
-          HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 0)) +
-          HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 1));
-      #endif
+      uint64x2_t t64 = vpaddlq_u32(vpaddlq_u16(masked));
+      r =
+        HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 0)) +
+        HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 1));
     #elif defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(SIMDE_BUG_CLANG_50932)
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) idx = { 112, 96, 80, 64, 48, 32, 16, 0, 128, 128, 128, 128, 128, 128, 128, 128 };
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) res = HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned char), vec_bperm(HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned __int128), a_.altivec_u64), idx));
@@ -2900,6 +2903,9 @@ simde_wasm_i32x4_bitmask (simde_v128_t a) {
 
     #if defined(SIMDE_X86_SSE_NATIVE)
       r = HEDLEY_STATIC_CAST(uint32_t, _mm_movemask_ps(a_.sse_m128));
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      static const int32_t shift[4] = { 0, 1, 2, 3 };
+      r = vaddvq_u32(vshlq_u32(vshrq_n_u32(a_.neon_u32, 31), vld1q_s32(shift)));
     #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       static const uint32_t md[4] = {
         1 << 0, 1 << 1, 1 << 2, 1 << 3
@@ -2907,14 +2913,10 @@ simde_wasm_i32x4_bitmask (simde_v128_t a) {
 
       uint32x4_t extended = vreinterpretq_u32_s32(vshrq_n_s32(a_.neon_i32, 31));
       uint32x4_t masked = vandq_u32(vld1q_u32(md), extended);
-      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
-        r = HEDLEY_STATIC_CAST(uint32_t, vaddvq_u32(masked));
-      #else
-        uint64x2_t t64 = vpaddlq_u32(masked);
-        r =
-          HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 0)) +
-          HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 1));
-      #endif
+      uint64x2_t t64 = vpaddlq_u32(masked);
+      r =
+        HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 0)) +
+        HEDLEY_STATIC_CAST(uint32_t, vgetq_lane_u64(t64, 1));
     #elif defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(SIMDE_BUG_CLANG_50932)
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) idx = { 96, 64, 32, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128 };
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) res = HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned char), vec_bperm(HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned __int128), a_.altivec_u64), idx));
@@ -2978,6 +2980,44 @@ simde_wasm_i64x2_bitmask (simde_v128_t a) {
   #define wasm_i64x2_bitmask(a) simde_wasm_i64x2_bitmask((a))
 #endif
 
+/* Like i8x16_bitmask, but each lane is represented by four bits of the
+ * result (0xf if the high bit of the lane is set, 0 otherwise).  This
+ * is much cheaper than a full bitmask on NEON, and callers who only
+ * need the index of the first matching lane can use ctz(r) / 4. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_wasm_i8x16_bitmask_nibbles (simde_v128_t a) {
+  simde_v128_private a_ = simde_v128_to_private(a);
+  uint64_t r = 0;
+
+  #if defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t t = wasm_u16x8_shr(wasm_i8x16_shr(a_.wasm_v128, 7), 4);
+    t = wasm_u8x16_narrow_i16x8(wasm_v128_and(t, wasm_i16x8_splat(0x00ff)), t);
+    r = HEDLEY_STATIC_CAST(uint64_t, wasm_i64x2_extract_lane(t, 0));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    uint8x8_t t = vshrn_n_u16(vreinterpretq_u16_s8(vshrq_n_s8(a_.neon_i8, 7)), 4);
+    r = vget_lane_u64(vreinterpret_u64_u8(t), 0);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i t = _mm_srli_epi16(_mm_cmpgt_epi8(_mm_setzero_si128(), a_.sse_m128i), 4);
+    t = _mm_packus_epi16(_mm_and_si128(t, _mm_set1_epi16(0x00ff)), t);
+    _mm_storel_epi64(HEDLEY_REINTERPRET_CAST(__m128i*, &r), t);
+  #elif defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && (SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE)
+    SIMDE_POWER_ALTIVEC_VECTOR(unsigned short) t =
+      vec_sr(
+        HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned short), vec_sra(a_.altivec_i8, vec_splats(HEDLEY_STATIC_CAST(unsigned char, 7)))),
+        vec_splats(HEDLEY_STATIC_CAST(unsigned short, 4))
+      );
+    r = HEDLEY_STATIC_CAST(uint64_t, vec_extract(HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned long long), vec_pack(t, t)), 0));
+  #else
+    SIMDE_VECTORIZE_REDUCTION(|:r)
+    for (size_t i = 0 ; i < (sizeof(a_.i8) / sizeof(a_.i8[0])) ; i++) {
+      r |= HEDLEY_STATIC_CAST(uint64_t, (a_.i8[i] < 0) ? 0xf : 0) << (i * 4);
+    }
+  #endif
+
+  return r;
+}
+
 /* abs */
 
 SIMDE_FUNCTION_ATTRIBUTES
@@ -3377,13 +3417,13 @@ simde_wasm_v128_any_true (simde_v128_t a) {
     simde_bool r = 0;
 
     #if defined(SIMDE_X86_SSE4_1_NATIVE)
-      r = !_mm_test_all_zeros(a_.sse_m128i, _mm_set1_epi32(~INT32_C(0)));
+      r = !_mm_testz_si128(a_.sse_m128i, a_.sse_m128i);
     #elif defined(SIMDE_X86_SSE2_NATIVE)
       r = _mm_movemask_epi8(_mm_cmpeq_epi8(a_.sse_m128i, _mm_setzero_si128())) != 0xffff;
     #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
       r = !!vmaxvq_u32(a_.neon_u32);
     #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
-      uint32x2_t tmp = vpmax_u32(vget_low_u32(a_.u32), vget_high_u32(a_.u32));
+      uint32x2_t tmp = vpmax_u32(vget_low_u32(a_.neon_u32), vget_high_u32(a_.neon_u32));
       r  = vget_lane_u32(tmp, 0);
       r |= vget_lane_u32(tmp, 1);
       r = !!r;
@@ -3420,7 +3460,7 @@ simde_wasm_i8x16_all_true (simde_v128_t a) {
     #elif defined(SIMDE_X86_SSE2_NATIVE)
       return _mm_movemask_epi8(_mm_cmpeq_epi8(a_.sse_m128i, _mm_setzero_si128())) == 0;
     #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
-      return !vmaxvq_u8(vceqzq_u8(a_.neon_u8));
+      return !!vminvq_u8(a_.neon_u8);
     #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       uint8x16_t zeroes = vdupq_n_u8(0);
       uint8x16_t false_set = vceqq_u8(a_.neon_u8, vdupq_n_u8(0));
@@ -3461,7 +3501,7 @@ simde_wasm_i16x8_all_true (simde_v128_t a) {
     #elif defined(SIMDE_X86_SSE2_NATIVE)
       return _mm_movemask_epi8(_mm_cmpeq_epi16(a_.sse_m128i, _mm_setzero_si128())) == 0;
     #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
-      return !vmaxvq_u16(vceqzq_u16(a_.neon_u16));
+      return !!vminvq_u16(a_.neon_u16);
     #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       uint16x8_t zeroes = vdupq_n_u16(0);
       uint16x8_t false_set = vceqq_u16(a_.neon_u16, vdupq_n_u16(0));
@@ -3502,7 +3542,7 @@ simde_wasm_i32x4_all_true (simde_v128_t a) {
     #elif defined(SIMDE_X86_SSE2_NATIVE)
       return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a_.sse_m128i, _mm_setzero_si128()))) == 0;
     #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
-      return !vmaxvq_u32(vceqzq_u32(a_.neon_u32));
+      return !!vminvq_u32(a_.neon_u32);
     #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       uint32x4_t d_all_true = vmvnq_u32(vceqq_u32(a_.neon_u32, vdupq_n_u32(0)));
       uint32x2_t q_all_true = vpmin_u32(vget_low_u32(d_all_true), vget_high_u32(d_all_true));
@@ -3539,7 +3579,17 @@ simde_wasm_i64x2_all_true (simde_v128_t a) {
     #if defined(SIMDE_X86_SSE4_1_NATIVE)
       return _mm_test_all_zeros(_mm_cmpeq_epi64(a_.sse_m128i, _mm_setzero_si128()), _mm_set1_epi32(~INT32_C(0)));
     #elif defined(SIMDE_X86_SSE2_NATIVE)
-      return _mm_movemask_pd(_mm_cmpeq_pd(a_.sse_m128d, _mm_setzero_pd())) == 0;
+      /* A 64-bit lane is zero iff both of its 32-bit halves are. */
+      __m128i z = _mm_cmpeq_epi32(a_.sse_m128i, _mm_setzero_si128());
+      z = _mm_and_si128(z, _mm_shuffle_epi32(z, _MM_SHUFFLE(2, 3, 0, 1)));
+      return _mm_movemask_pd(_mm_castsi128_pd(z)) == 0;
+    #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return !vmaxvq_u32(vreinterpretq_u32_u64(vceqzq_u64(a_.neon_u64)));
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      uint32x4_t z = vceqq_u32(a_.neon_u32, vdupq_n_u32(0));
+      z = vandq_u32(z, vrev64q_u32(z));
+      uint32x2_t tmp = vpmax_u32(vget_low_u32(z), vget_high_u32(z));
+      return !(vget_lane_u32(tmp, 0) | vget_lane_u32(tmp, 1));
     #elif defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
       return HEDLEY_STATIC_CAST(simde_bool, vec_all_ne(a_.altivec_i64, HEDLEY_REINTERPRET_CAST(__typeof__(a_.altivec_i64), vec_splats(0))));
     #else
@@ -4472,6 +4522,12 @@ simde_wasm_i16x8_q15mulr_sat (simde_v128_t a, simde_v128_t b) {
     /* https://github.com/WebAssembly/simd/pull/365 */
     #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       r_.neon_i16 = vqrdmulhq_s16(a_.neon_i16, b_.neon_i16);
+    #elif defined(SIMDE_X86_SSSE3_NATIVE)
+      /* pmulhrsw only differs for INT16_MIN * INT16_MIN, where it returns
+       * INT16_MIN instead of saturating; no other inputs produce 0x8000. */
+      __m128i y = _mm_mulhrs_epi16(a_.sse_m128i, b_.sse_m128i);
+      __m128i tmp = _mm_cmpeq_epi16(y, _mm_set1_epi16(INT16_MIN));
+      r_.sse_m128i = _mm_xor_si128(y, tmp);
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.i16) / sizeof(r_.i16[0])) ; i++) {
@@ -5672,6 +5728,72 @@ simde_wasm_f64x2_div (simde_v128_t a, simde_v128_t b) {
 
 /* shuffle */
 
+/* The lane indices passed to the shuffle functions are required to be
+ * integer constant expressions, so once the functions are inlined all
+ * of the pattern tests below fold away and only the code for the
+ * matching pattern is left.  Patterns which need an immediate operand
+ * (pshufd, shufps, palignr, vext, etc.) can't be matched inside of the
+ * functions since the indices are not constant expressions there, so
+ * they are handled by the macros following each function instead. */
+
+#define SIMDE_WASM_I8X16_SHUFFLE_MATCH_( \
+    c0, c1,  c2,  c3,  c4,  c5,  c6,  c7,  c8,  c9, c10, c11, c12, c13, c14, c15, \
+    p0, p1,  p2,  p3,  p4,  p5,  p6,  p7,  p8,  p9, p10, p11, p12, p13, p14, p15) \
+  ( \
+    (( c0) == ( p0)) && (( c1) == ( p1)) && (( c2) == ( p2)) && (( c3) == ( p3)) && \
+    (( c4) == ( p4)) && (( c5) == ( p5)) && (( c6) == ( p6)) && (( c7) == ( p7)) && \
+    (( c8) == ( p8)) && (( c9) == ( p9)) && ((c10) == (p10)) && ((c11) == (p11)) && \
+    ((c12) == (p12)) && ((c13) == (p13)) && ((c14) == (p14)) && ((c15) == (p15)) \
+  )
+
+#define SIMDE_WASM_I16X8_SHUFFLE_MATCH_( \
+    c0, c1, c2, c3, c4, c5, c6, c7, \
+    p0, p1, p2, p3, p4, p5, p6, p7) \
+  ( \
+    ((c0) == (p0)) && ((c1) == (p1)) && ((c2) == (p2)) && ((c3) == (p3)) && \
+    ((c4) == (p4)) && ((c5) == (p5)) && ((c6) == (p6)) && ((c7) == (p7)) \
+  )
+
+#define SIMDE_WASM_I32X4_SHUFFLE_MATCH_( \
+    c0, c1, c2, c3, \
+    p0, p1, p2, p3) \
+  (((c0) == (p0)) && ((c1) == (p1)) && ((c2) == (p2)) && ((c3) == (p3)))
+
+/* Every lane is taken from the concatenation of a and b (or b and a)
+ * starting at lane c0, i.e., a palignr / vext. */
+#define SIMDE_WASM_I8X16_SHUFFLE_IS_ROTATE_( \
+    c0, c1,  c2,  c3,  c4,  c5,  c6,  c7, \
+    c8, c9, c10, c11, c12, c13, c14, c15) \
+  ( \
+    (((c0) & 15) != 0) && \
+    SIMDE_WASM_I8X16_SHUFFLE_MATCH_( \
+       (c0),  (c1),  (c2),  (c3),  (c4),  (c5),  (c6),  (c7), \
+       (c8),  (c9), (c10), (c11), (c12), (c13), (c14), (c15), \
+      ((c0)     ) & 31, ((c0) +  1) & 31, ((c0) +  2) & 31, ((c0) +  3) & 31, \
+      ((c0) +  4) & 31, ((c0) +  5) & 31, ((c0) +  6) & 31, ((c0) +  7) & 31, \
+      ((c0) +  8) & 31, ((c0) +  9) & 31, ((c0) + 10) & 31, ((c0) + 11) & 31, \
+      ((c0) + 12) & 31, ((c0) + 13) & 31, ((c0) + 14) & 31, ((c0) + 15) & 31) \
+  )
+
+/* Same, but rotating a single input. */
+#define SIMDE_WASM_I8X16_SHUFFLE_IS_ROTATE1_( \
+    c0, c1,  c2,  c3,  c4,  c5,  c6,  c7, \
+    c8, c9, c10, c11, c12, c13, c14, c15) \
+  ( \
+    (((c0) & 15) != 0) && \
+    SIMDE_WASM_I8X16_SHUFFLE_MATCH_( \
+       (c0),  (c1),  (c2),  (c3),  (c4),  (c5),  (c6),  (c7), \
+       (c8),  (c9), (c10), (c11), (c12), (c13), (c14), (c15), \
+      (((c0)     ) & 15) | ((c0) & 16), (((c0) +  1) & 15) | ((c0) & 16), \
+      (((c0) +  2) & 15) | ((c0) & 16), (((c0) +  3) & 15) | ((c0) & 16), \
+      (((c0) +  4) & 15) | ((c0) & 16), (((c0) +  5) & 15) | ((c0) & 16), \
+      (((c0) +  6) & 15) | ((c0) & 16), (((c0) +  7) & 15) | ((c0) & 16), \
+      (((c0) +  8) & 15) | ((c0) & 16), (((c0) +  9) & 15) | ((c0) & 16), \
+      (((c0) + 10) & 15) | ((c0) & 16), (((c0) + 11) & 15) | ((c0) & 16), \
+      (((c0) + 12) & 15) | ((c0) & 16), (((c0) + 13) & 15) | ((c0) & 16), \
+      (((c0) + 14) & 15) | ((c0) & 16), (((c0) + 15) & 15) | ((c0) & 16)) \
+  )
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde_v128_t
 simde_wasm_i8x16_shuffle (
@@ -5683,22 +5805,156 @@ simde_wasm_i8x16_shuffle (
     b_ = simde_v128_to_private(b),
     r_;
 
-  r_.i8[ 0] = ( c0 < 16) ? a_.i8[ c0] : b_.i8[ c0 & 15];
-  r_.i8[ 1] = ( c1 < 16) ? a_.i8[ c1] : b_.i8[ c1 & 15];
-  r_.i8[ 2] = ( c2 < 16) ? a_.i8[ c2] : b_.i8[ c2 & 15];
-  r_.i8[ 3] = ( c3 < 16) ? a_.i8[ c3] : b_.i8[ c3 & 15];
-  r_.i8[ 4] = ( c4 < 16) ? a_.i8[ c4] : b_.i8[ c4 & 15];
-  r_.i8[ 5] = ( c5 < 16) ? a_.i8[ c5] : b_.i8[ c5 & 15];
-  r_.i8[ 6] = ( c6 < 16) ? a_.i8[ c6] : b_.i8[ c6 & 15];
-  r_.i8[ 7] = ( c7 < 16) ? a_.i8[ c7] : b_.i8[ c7 & 15];
-  r_.i8[ 8] = ( c8 < 16) ? a_.i8[ c8] : b_.i8[ c8 & 15];
-  r_.i8[ 9] = ( c9 < 16) ? a_.i8[ c9] : b_.i8[ c9 & 15];
-  r_.i8[10] = (c10 < 16) ? a_.i8[c10] : b_.i8[c10 & 15];
-  r_.i8[11] = (c11 < 16) ? a_.i8[c11] : b_.i8[c11 & 15];
-  r_.i8[12] = (c12 < 16) ? a_.i8[c12] : b_.i8[c12 & 15];
-  r_.i8[13] = (c13 < 16) ? a_.i8[c13] : b_.i8[c13 & 15];
-  r_.i8[14] = (c14 < 16) ? a_.i8[c14] : b_.i8[c14 & 15];
-  r_.i8[15] = (c15 < 16) ? a_.i8[c15] : b_.i8[c15 & 15];
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                         0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,  11,  12,  13,  14,  15)) {
+      r_ = a_;
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                               16, 17, 18, 19, 20, 21, 22, 23, 24, 25,  26,  27,  28,  29,  30,  31)) {
+      r_ = b_;
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                0, 16,  1, 17,  2, 18,  3, 19,  4, 20,   5,  21,   6,  22,   7,  23)) {
+      r_.sse_m128i = _mm_unpacklo_epi8(a_.sse_m128i, b_.sse_m128i);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                               16,  0, 17,  1, 18,  2, 19,  3, 20,  4,  21,   5,  22,   6,  23,   7)) {
+      r_.sse_m128i = _mm_unpacklo_epi8(b_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                8, 24,  9, 25, 10, 26, 11, 27, 12, 28,  13,  29,  14,  30,  15,  31)) {
+      r_.sse_m128i = _mm_unpackhi_epi8(a_.sse_m128i, b_.sse_m128i);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                               24,  8, 25,  9, 26, 10, 27, 11, 28, 12,  29,  13,  30,  14,  31,  15)) {
+      r_.sse_m128i = _mm_unpackhi_epi8(b_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                0,  0,  1,  1,  2,  2,  3,  3,  4,  4,   5,   5,   6,   6,   7,   7)) {
+      r_.sse_m128i = _mm_unpacklo_epi8(a_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                8,  8,  9,  9, 10, 10, 11, 11, 12, 12,  13,  13,  14,  14,  15,  15)) {
+      r_.sse_m128i = _mm_unpackhi_epi8(a_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0 & 15, c1 & 15, c2 & 15, c3 & 15, c4 & 15, c5 & 15, c6 & 15, c7 & 15,
+                                               c8 & 15, c9 & 15, c10 & 15, c11 & 15, c12 & 15, c13 & 15, c14 & 15, c15 & 15,
+                                                0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,  11,  12,  13,  14,  15)) {
+      /* blend */
+      const __m128i mask = _mm_setr_epi8(
+        HEDLEY_STATIC_CAST(char, -(c0 >> 4)), HEDLEY_STATIC_CAST(char, -( c1 >> 4)), HEDLEY_STATIC_CAST(char, -( c2 >> 4)), HEDLEY_STATIC_CAST(char, -( c3 >> 4)),
+        HEDLEY_STATIC_CAST(char, -(c4 >> 4)), HEDLEY_STATIC_CAST(char, -( c5 >> 4)), HEDLEY_STATIC_CAST(char, -( c6 >> 4)), HEDLEY_STATIC_CAST(char, -( c7 >> 4)),
+        HEDLEY_STATIC_CAST(char, -(c8 >> 4)), HEDLEY_STATIC_CAST(char, -( c9 >> 4)), HEDLEY_STATIC_CAST(char, -(c10 >> 4)), HEDLEY_STATIC_CAST(char, -(c11 >> 4)),
+        HEDLEY_STATIC_CAST(char, -(c12 >> 4)), HEDLEY_STATIC_CAST(char, -(c13 >> 4)), HEDLEY_STATIC_CAST(char, -(c14 >> 4)), HEDLEY_STATIC_CAST(char, -(c15 >> 4)));
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        r_.sse_m128i = _mm_blendv_epi8(a_.sse_m128i, b_.sse_m128i, mask);
+      #else
+        r_.sse_m128i = _mm_or_si128(_mm_and_si128(mask, b_.sse_m128i), _mm_andnot_si128(mask, a_.sse_m128i));
+      #endif
+    } else {
+      #if defined(SIMDE_X86_SSSE3_NATIVE)
+        /* pshufb zeros lanes with the high bit set, so each input only
+         * contributes the lanes it owns. */
+        const __m128i idx = _mm_setr_epi8(
+          HEDLEY_STATIC_CAST(char,  c0), HEDLEY_STATIC_CAST(char,  c1), HEDLEY_STATIC_CAST(char,  c2), HEDLEY_STATIC_CAST(char,  c3),
+          HEDLEY_STATIC_CAST(char,  c4), HEDLEY_STATIC_CAST(char,  c5), HEDLEY_STATIC_CAST(char,  c6), HEDLEY_STATIC_CAST(char,  c7),
+          HEDLEY_STATIC_CAST(char,  c8), HEDLEY_STATIC_CAST(char,  c9), HEDLEY_STATIC_CAST(char, c10), HEDLEY_STATIC_CAST(char, c11),
+          HEDLEY_STATIC_CAST(char, c12), HEDLEY_STATIC_CAST(char, c13), HEDLEY_STATIC_CAST(char, c14), HEDLEY_STATIC_CAST(char, c15));
+
+        if ((c0 | c1 | c2 | c3 | c4 | c5 | c6 | c7 | c8 | c9 | c10 | c11 | c12 | c13 | c14 | c15) < 16) {
+          r_.sse_m128i = _mm_shuffle_epi8(a_.sse_m128i, idx);
+        } else if ((c0 & c1 & c2 & c3 & c4 & c5 & c6 & c7 & c8 & c9 & c10 & c11 & c12 & c13 & c14 & c15 & 16) != 0) {
+          r_.sse_m128i = _mm_shuffle_epi8(b_.sse_m128i, _mm_and_si128(idx, _mm_set1_epi8(15)));
+        } else {
+          /* idx + 0x70 has the high bit set for lanes from b, idx ^ 0x10
+           * has it set for lanes from a. */
+          r_.sse_m128i =
+            _mm_or_si128(
+              _mm_shuffle_epi8(a_.sse_m128i, _mm_add_epi8(idx, _mm_set1_epi8(0x70))),
+              _mm_shuffle_epi8(b_.sse_m128i, _mm_add_epi8(_mm_xor_si128(idx, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x70))));
+        }
+      #else
+        const int c[16] = { c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15 };
+
+        for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
+          r_.i8[i] = (c[i] < 16) ? a_.i8[c[i]] : b_.i8[c[i] & 15];
+        }
+      #endif
+    }
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                         0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,  11,  12,  13,  14,  15)) {
+      r_ = a_;
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                               16, 17, 18, 19, 20, 21, 22, 23, 24, 25,  26,  27,  28,  29,  30,  31)) {
+      r_ = b_;
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                0, 16,  1, 17,  2, 18,  3, 19,  4, 20,   5,  21,   6,  22,   7,  23)) {
+      r_.neon_i8 = vzip1q_s8(a_.neon_i8, b_.neon_i8);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                8, 24,  9, 25, 10, 26, 11, 27, 12, 28,  13,  29,  14,  30,  15,  31)) {
+      r_.neon_i8 = vzip2q_s8(a_.neon_i8, b_.neon_i8);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                0,  2,  4,  6,  8, 10, 12, 14, 16, 18,  20,  22,  24,  26,  28,  30)) {
+      r_.neon_i8 = vuzp1q_s8(a_.neon_i8, b_.neon_i8);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                1,  3,  5,  7,  9, 11, 13, 15, 17, 19,  21,  23,  25,  27,  29,  31)) {
+      r_.neon_i8 = vuzp2q_s8(a_.neon_i8, b_.neon_i8);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                0, 16,  2, 18,  4, 20,  6, 22,  8, 24,  10,  26,  12,  28,  14,  30)) {
+      r_.neon_i8 = vtrn1q_s8(a_.neon_i8, b_.neon_i8);
+    } else if (SIMDE_WASM_I8X16_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15,
+                                                1, 17,  3, 19,  5, 21,  7, 23,  9, 25,  11,  27,  13,  29,  15,  31)) {
+      r_.neon_i8 = vtrn2q_s8(a_.neon_i8, b_.neon_i8);
+    } else {
+      const uint8_t idx[16] = {
+        HEDLEY_STATIC_CAST(uint8_t,  c0), HEDLEY_STATIC_CAST(uint8_t,  c1), HEDLEY_STATIC_CAST(uint8_t,  c2), HEDLEY_STATIC_CAST(uint8_t,  c3),
+        HEDLEY_STATIC_CAST(uint8_t,  c4), HEDLEY_STATIC_CAST(uint8_t,  c5), HEDLEY_STATIC_CAST(uint8_t,  c6), HEDLEY_STATIC_CAST(uint8_t,  c7),
+        HEDLEY_STATIC_CAST(uint8_t,  c8), HEDLEY_STATIC_CAST(uint8_t,  c9), HEDLEY_STATIC_CAST(uint8_t, c10), HEDLEY_STATIC_CAST(uint8_t, c11),
+        HEDLEY_STATIC_CAST(uint8_t, c12), HEDLEY_STATIC_CAST(uint8_t, c13), HEDLEY_STATIC_CAST(uint8_t, c14), HEDLEY_STATIC_CAST(uint8_t, c15)
+      };
+
+      if ((c0 | c1 | c2 | c3 | c4 | c5 | c6 | c7 | c8 | c9 | c10 | c11 | c12 | c13 | c14 | c15) < 16) {
+        r_.neon_i8 = vqtbl1q_s8(a_.neon_i8, vld1q_u8(idx));
+      } else {
+        int8x16x2_t tab = { { a_.neon_i8, b_.neon_i8 } };
+        r_.neon_i8 = vqtbl2q_s8(tab, vld1q_u8(idx));
+      }
+    }
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    const uint8_t idx[16] = {
+      HEDLEY_STATIC_CAST(uint8_t,  c0), HEDLEY_STATIC_CAST(uint8_t,  c1), HEDLEY_STATIC_CAST(uint8_t,  c2), HEDLEY_STATIC_CAST(uint8_t,  c3),
+      HEDLEY_STATIC_CAST(uint8_t,  c4), HEDLEY_STATIC_CAST(uint8_t,  c5), HEDLEY_STATIC_CAST(uint8_t,  c6), HEDLEY_STATIC_CAST(uint8_t,  c7),
+      HEDLEY_STATIC_CAST(uint8_t,  c8), HEDLEY_STATIC_CAST(uint8_t,  c9), HEDLEY_STATIC_CAST(uint8_t, c10), HEDLEY_STATIC_CAST(uint8_t, c11),
+      HEDLEY_STATIC_CAST(uint8_t, c12), HEDLEY_STATIC_CAST(uint8_t, c13), HEDLEY_STATIC_CAST(uint8_t, c14), HEDLEY_STATIC_CAST(uint8_t, c15)
+    };
+    int8x8x4_t tab = { {
+      vget_low_s8(a_.neon_i8), vget_high_s8(a_.neon_i8),
+      vget_low_s8(b_.neon_i8), vget_high_s8(b_.neon_i8)
+    } };
+    uint8x16_t i = vld1q_u8(idx);
+    r_.neon_i8 = vcombine_s8(
+      vtbl4_s8(tab, vreinterpret_s8_u8(vget_low_u8(i))),
+      vtbl4_s8(tab, vreinterpret_s8_u8(vget_high_u8(i))));
+  #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    const SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) idx = {
+      HEDLEY_STATIC_CAST(unsigned char,  c0), HEDLEY_STATIC_CAST(unsigned char,  c1), HEDLEY_STATIC_CAST(unsigned char,  c2), HEDLEY_STATIC_CAST(unsigned char,  c3),
+      HEDLEY_STATIC_CAST(unsigned char,  c4), HEDLEY_STATIC_CAST(unsigned char,  c5), HEDLEY_STATIC_CAST(unsigned char,  c6), HEDLEY_STATIC_CAST(unsigned char,  c7),
+      HEDLEY_STATIC_CAST(unsigned char,  c8), HEDLEY_STATIC_CAST(unsigned char,  c9), HEDLEY_STATIC_CAST(unsigned char, c10), HEDLEY_STATIC_CAST(unsigned char, c11),
+      HEDLEY_STATIC_CAST(unsigned char, c12), HEDLEY_STATIC_CAST(unsigned char, c13), HEDLEY_STATIC_CAST(unsigned char, c14), HEDLEY_STATIC_CAST(unsigned char, c15)
+    };
+    r_.altivec_i8 = vec_perm(a_.altivec_i8, b_.altivec_i8, idx);
+  #else
+    r_.i8[ 0] = ( c0 < 16) ? a_.i8[ c0] : b_.i8[ c0 & 15];
+    r_.i8[ 1] = ( c1 < 16) ? a_.i8[ c1] : b_.i8[ c1 & 15];
+    r_.i8[ 2] = ( c2 < 16) ? a_.i8[ c2] : b_.i8[ c2 & 15];
+    r_.i8[ 3] = ( c3 < 16) ? a_.i8[ c3] : b_.i8[ c3 & 15];
+    r_.i8[ 4] = ( c4 < 16) ? a_.i8[ c4] : b_.i8[ c4 & 15];
+    r_.i8[ 5] = ( c5 < 16) ? a_.i8[ c5] : b_.i8[ c5 & 15];
+    r_.i8[ 6] = ( c6 < 16) ? a_.i8[ c6] : b_.i8[ c6 & 15];
+    r_.i8[ 7] = ( c7 < 16) ? a_.i8[ c7] : b_.i8[ c7 & 15];
+    r_.i8[ 8] = ( c8 < 16) ? a_.i8[ c8] : b_.i8[ c8 & 15];
+    r_.i8[ 9] = ( c9 < 16) ? a_.i8[ c9] : b_.i8[ c9 & 15];
+    r_.i8[10] = (c10 < 16) ? a_.i8[c10] : b_.i8[c10 & 15];
+    r_.i8[11] = (c11 < 16) ? a_.i8[c11] : b_.i8[c11 & 15];
+    r_.i8[12] = (c12 < 16) ? a_.i8[c12] : b_.i8[c12 & 15];
+    r_.i8[13] = (c13 < 16) ? a_.i8[c13] : b_.i8[c13 & 15];
+    r_.i8[14] = (c14 < 16) ? a_.i8[c14] : b_.i8[c14 & 15];
+    r_.i8[15] = (c15 < 16) ? a_.i8[c15] : b_.i8[c15 & 15];
+  #endif
 
   return simde_v128_from_private(r_);
 }
@@ -5725,6 +5981,81 @@ simde_wasm_i8x16_shuffle (
           c0, c1,  c2,  c3,  c4,  c5,  c6,  c7, \
           c8, c9, c10, c11, c12, c13, c14, c15)); \
     }))
+#elif defined(SIMDE_X86_SSE2_NATIVE)
+  #if defined(SIMDE_X86_SSSE3_NATIVE)
+    #define SIMDE_WASM_I8X16_SHUFFLE_ALIGNR_(hi, lo, n) \
+      _mm_alignr_epi8((hi), (lo), (n))
+    #define SIMDE_WASM_I8X16_SHUFFLE_SPLAT_(v, n) \
+      _mm_shuffle_epi8((v), _mm_set1_epi8(HEDLEY_STATIC_CAST(char, (n) & 15)))
+  #else
+    #define SIMDE_WASM_I8X16_SHUFFLE_ALIGNR_(hi, lo, n) \
+      _mm_or_si128(_mm_srli_si128((lo), (n)), _mm_slli_si128((hi), (16 - (n)) & 15))
+    /* Without pshufb a byte broadcast is an unpack to get the byte
+     * into both halves of a 16-bit lane, then a 16-bit broadcast. */
+    #define SIMDE_WASM_I8X16_SHUFFLE_SPLAT_(v, n) \
+      (((n) & 4) ? \
+        _mm_shuffle_epi32( \
+          _mm_shufflehi_epi16( \
+            ((n) & 8) ? _mm_unpackhi_epi8((v), (v)) : _mm_unpacklo_epi8((v), (v)), \
+            ((n) & 3) * 0x55), \
+          0xaa) : \
+        _mm_shuffle_epi32( \
+          _mm_shufflelo_epi16( \
+            ((n) & 8) ? _mm_unpackhi_epi8((v), (v)) : _mm_unpacklo_epi8((v), (v)), \
+            ((n) & 3) * 0x55), \
+          0x00))
+  #endif
+
+  #define \
+    simde_wasm_i8x16_shuffle( \
+        a, b, \
+        c0, c1,  c2,  c3,  c4,  c5,  c6,  c7, \
+        c8, c9, c10, c11, c12, c13, c14, c15) \
+    ( \
+      SIMDE_WASM_I8X16_SHUFFLE_IS_ROTATE_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15) ? \
+        (((c0) < 16) ? \
+          SIMDE_WASM_I8X16_SHUFFLE_ALIGNR_((b), (a), (c0) & 15) : \
+          SIMDE_WASM_I8X16_SHUFFLE_ALIGNR_((a), (b), (c0) & 15)) : \
+      SIMDE_WASM_I8X16_SHUFFLE_IS_ROTATE1_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15) ? \
+        (((c0) < 16) ? \
+          SIMDE_WASM_I8X16_SHUFFLE_ALIGNR_((a), (a), (c0) & 15) : \
+          SIMDE_WASM_I8X16_SHUFFLE_ALIGNR_((b), (b), (c0) & 15)) : \
+      SIMDE_WASM_I8X16_SHUFFLE_MATCH_( \
+         (c0), (c1), (c2), (c3), (c4), (c5), (c6), (c7), (c8), (c9), (c10), (c11), (c12), (c13), (c14), (c15), \
+         (c0), (c0), (c0), (c0), (c0), (c0), (c0), (c0), (c0), (c0),  (c0),  (c0),  (c0),  (c0),  (c0),  (c0)) ? \
+        (((c0) < 16) ? \
+          SIMDE_WASM_I8X16_SHUFFLE_SPLAT_((a), (c0)) : \
+          SIMDE_WASM_I8X16_SHUFFLE_SPLAT_((b), (c0))) : \
+      ((((c0) | (c2) | (c4) | (c6) | (c8) | (c10) | (c12) | (c14)) & 1) == 0 && \
+       SIMDE_WASM_I8X16_SHUFFLE_MATCH_( \
+         (c0), (c1), (c2), (c3), (c4), (c5), (c6), (c7), (c8), (c9), (c10), (c11), (c12), (c13), (c14), (c15), \
+         (c0), (c0) + 1, (c2), (c2) + 1, (c4), (c4) + 1, (c6), (c6) + 1, \
+         (c8), (c8) + 1, (c10), (c10) + 1, (c12), (c12) + 1, (c14), (c14) + 1)) ? \
+        simde_wasm_i16x8_shuffle((a), (b), \
+          (c0) >> 1, (c2) >> 1, (c4) >> 1, (c6) >> 1, (c8) >> 1, (c10) >> 1, (c12) >> 1, (c14) >> 1) : \
+        simde_wasm_i8x16_shuffle((a), (b), \
+          (c0), (c1),  (c2),  (c3),  (c4),  (c5),  (c6),  (c7), \
+          (c8), (c9), (c10), (c11), (c12), (c13), (c14), (c15)) \
+    )
+#elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define \
+    simde_wasm_i8x16_shuffle( \
+        a, b, \
+        c0, c1,  c2,  c3,  c4,  c5,  c6,  c7, \
+        c8, c9, c10, c11, c12, c13, c14, c15) \
+    ( \
+      SIMDE_WASM_I8X16_SHUFFLE_IS_ROTATE_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15) ? \
+        (((c0) < 16) ? \
+          vreinterpretq_s32_s8(vextq_s8(vreinterpretq_s8_s32(a), vreinterpretq_s8_s32(b), (c0) & 15)) : \
+          vreinterpretq_s32_s8(vextq_s8(vreinterpretq_s8_s32(b), vreinterpretq_s8_s32(a), (c0) & 15))) : \
+      SIMDE_WASM_I8X16_SHUFFLE_IS_ROTATE1_(c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15) ? \
+        (((c0) < 16) ? \
+          vreinterpretq_s32_s8(vextq_s8(vreinterpretq_s8_s32(a), vreinterpretq_s8_s32(a), (c0) & 15)) : \
+          vreinterpretq_s32_s8(vextq_s8(vreinterpretq_s8_s32(b), vreinterpretq_s8_s32(b), (c0) & 15))) : \
+        simde_wasm_i8x16_shuffle((a), (b), \
+          (c0), (c1),  (c2),  (c3),  (c4),  (c5),  (c6),  (c7), \
+          (c8), (c9), (c10), (c11), (c12), (c13), (c14), (c15)) \
+    )
 #endif
 #if defined(SIMDE_WASM_SIMD128_ENABLE_NATIVE_ALIASES)
   #define \
@@ -5746,14 +6077,77 @@ simde_wasm_i16x8_shuffle (
     b_ = simde_v128_to_private(b),
     r_;
 
-  r_.i16[ 0] = (c0 < 8) ? a_.i16[ c0] : b_.i16[ c0 & 7];
-  r_.i16[ 1] = (c1 < 8) ? a_.i16[ c1] : b_.i16[ c1 & 7];
-  r_.i16[ 2] = (c2 < 8) ? a_.i16[ c2] : b_.i16[ c2 & 7];
-  r_.i16[ 3] = (c3 < 8) ? a_.i16[ c3] : b_.i16[ c3 & 7];
-  r_.i16[ 4] = (c4 < 8) ? a_.i16[ c4] : b_.i16[ c4 & 7];
-  r_.i16[ 5] = (c5 < 8) ? a_.i16[ c5] : b_.i16[ c5 & 7];
-  r_.i16[ 6] = (c6 < 8) ? a_.i16[ c6] : b_.i16[ c6 & 7];
-  r_.i16[ 7] = (c7 < 8) ? a_.i16[ c7] : b_.i16[ c7 & 7];
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  0,  1,  2,  3,  4,  5,  6,  7)) {
+      r_ = a_;
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  8,  9, 10, 11, 12, 13, 14, 15)) {
+      r_ = b_;
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  0,  8,  1,  9,  2, 10,  3, 11)) {
+      r_.sse_m128i = _mm_unpacklo_epi16(a_.sse_m128i, b_.sse_m128i);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  8,  0,  9,  1, 10,  2, 11,  3)) {
+      r_.sse_m128i = _mm_unpacklo_epi16(b_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  4, 12,  5, 13,  6, 14,  7, 15)) {
+      r_.sse_m128i = _mm_unpackhi_epi16(a_.sse_m128i, b_.sse_m128i);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7, 12,  4, 13,  5, 14,  6, 15,  7)) {
+      r_.sse_m128i = _mm_unpackhi_epi16(b_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  0,  0,  1,  1,  2,  2,  3,  3)) {
+      r_.sse_m128i = _mm_unpacklo_epi16(a_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  4,  4,  5,  5,  6,  6,  7,  7)) {
+      r_.sse_m128i = _mm_unpackhi_epi16(a_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0 & 7, c1 & 7, c2 & 7, c3 & 7, c4 & 7, c5 & 7, c6 & 7, c7 & 7, 0, 1, 2, 3, 4, 5, 6, 7)) {
+      /* blend */
+      const __m128i mask = _mm_setr_epi16(
+        HEDLEY_STATIC_CAST(short, -(c0 >> 3)), HEDLEY_STATIC_CAST(short, -(c1 >> 3)), HEDLEY_STATIC_CAST(short, -(c2 >> 3)), HEDLEY_STATIC_CAST(short, -(c3 >> 3)),
+        HEDLEY_STATIC_CAST(short, -(c4 >> 3)), HEDLEY_STATIC_CAST(short, -(c5 >> 3)), HEDLEY_STATIC_CAST(short, -(c6 >> 3)), HEDLEY_STATIC_CAST(short, -(c7 >> 3)));
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        r_.sse_m128i = _mm_blendv_epi8(a_.sse_m128i, b_.sse_m128i, mask);
+      #else
+        r_.sse_m128i = _mm_or_si128(_mm_and_si128(mask, b_.sse_m128i), _mm_andnot_si128(mask, a_.sse_m128i));
+      #endif
+    } else {
+      r_ = simde_v128_to_private(
+        (simde_wasm_i8x16_shuffle)(simde_v128_from_private(a_), simde_v128_from_private(b_),
+          c0 * 2, c0 * 2 + 1, c1 * 2, c1 * 2 + 1, c2 * 2, c2 * 2 + 1, c3 * 2, c3 * 2 + 1,
+          c4 * 2, c4 * 2 + 1, c5 * 2, c5 * 2 + 1, c6 * 2, c6 * 2 + 1, c7 * 2, c7 * 2 + 1));
+    }
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  0,  1,  2,  3,  4,  5,  6,  7)) {
+      r_ = a_;
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  8,  9, 10, 11, 12, 13, 14, 15)) {
+      r_ = b_;
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  0,  8,  1,  9,  2, 10,  3, 11)) {
+      r_.neon_i16 = vzip1q_s16(a_.neon_i16, b_.neon_i16);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  4, 12,  5, 13,  6, 14,  7, 15)) {
+      r_.neon_i16 = vzip2q_s16(a_.neon_i16, b_.neon_i16);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  0,  2,  4,  6,  8, 10, 12, 14)) {
+      r_.neon_i16 = vuzp1q_s16(a_.neon_i16, b_.neon_i16);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  1,  3,  5,  7,  9, 11, 13, 15)) {
+      r_.neon_i16 = vuzp2q_s16(a_.neon_i16, b_.neon_i16);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  0,  8,  2, 10,  4, 12,  6, 14)) {
+      r_.neon_i16 = vtrn1q_s16(a_.neon_i16, b_.neon_i16);
+    } else if (SIMDE_WASM_I16X8_SHUFFLE_MATCH_(c0, c1, c2, c3, c4, c5, c6, c7,  1,  9,  3, 11,  5, 13,  7, 15)) {
+      r_.neon_i16 = vtrn2q_s16(a_.neon_i16, b_.neon_i16);
+    } else {
+      r_ = simde_v128_to_private(
+        (simde_wasm_i8x16_shuffle)(simde_v128_from_private(a_), simde_v128_from_private(b_),
+          c0 * 2, c0 * 2 + 1, c1 * 2, c1 * 2 + 1, c2 * 2, c2 * 2 + 1, c3 * 2, c3 * 2 + 1,
+          c4 * 2, c4 * 2 + 1, c5 * 2, c5 * 2 + 1, c6 * 2, c6 * 2 + 1, c7 * 2, c7 * 2 + 1));
+    }
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    r_ = simde_v128_to_private(
+      (simde_wasm_i8x16_shuffle)(simde_v128_from_private(a_), simde_v128_from_private(b_),
+        c0 * 2, c0 * 2 + 1, c1 * 2, c1 * 2 + 1, c2 * 2, c2 * 2 + 1, c3 * 2, c3 * 2 + 1,
+        c4 * 2, c4 * 2 + 1, c5 * 2, c5 * 2 + 1, c6 * 2, c6 * 2 + 1, c7 * 2, c7 * 2 + 1));
+  #else
+    r_.i16[ 0] = (c0 < 8) ? a_.i16[ c0] : b_.i16[ c0 & 7];
+    r_.i16[ 1] = (c1 < 8) ? a_.i16[ c1] : b_.i16[ c1 & 7];
+    r_.i16[ 2] = (c2 < 8) ? a_.i16[ c2] : b_.i16[ c2 & 7];
+    r_.i16[ 3] = (c3 < 8) ? a_.i16[ c3] : b_.i16[ c3 & 7];
+    r_.i16[ 4] = (c4 < 8) ? a_.i16[ c4] : b_.i16[ c4 & 7];
+    r_.i16[ 5] = (c5 < 8) ? a_.i16[ c5] : b_.i16[ c5 & 7];
+    r_.i16[ 6] = (c6 < 8) ? a_.i16[ c6] : b_.i16[ c6 & 7];
+    r_.i16[ 7] = (c7 < 8) ? a_.i16[ c7] : b_.i16[ c7 & 7];
+  #endif
 
   return simde_v128_from_private(r_);
 }
@@ -5776,6 +6170,47 @@ simde_wasm_i16x8_shuffle (
           HEDLEY_REINTERPRET_CAST(int16_t SIMDE_VECTOR(16), b), \
           c0, c1,  c2,  c3,  c4,  c5,  c6,  c7)); \
     }))
+#elif defined(SIMDE_X86_SSE2_NATIVE)
+  #define SIMDE_WASM_I16X8_SHUFFLE_IMM_(c0, c1, c2, c3) \
+    (((c0) & 3) | (((c1) & 3) << 2) | (((c2) & 3) << 4) | (((c3) & 3) << 6))
+
+  /* pshuflw + pshufhw, with each half only reading from itself */
+  #define SIMDE_WASM_I16X8_SHUFFLE_IS_PSHUFLHW_(c0, c1, c2, c3, c4, c5, c6, c7) \
+    ( \
+      (((c0) | (c1) | (c2) | (c3)) & 4) == 0 && \
+      ((c4) & (c5) & (c6) & (c7) & 4) != 0 && \
+      ((((c0) | (c1) | (c2) | (c3) | (c4) | (c5) | (c6) | (c7)) & 8) == 0 || \
+       ((c0) & (c1) & (c2) & (c3) & (c4) & (c5) & (c6) & (c7) & 8) != 0) \
+    )
+
+  #define SIMDE_WASM_I16X8_SHUFFLE_PSHUFLHW_(v, c0, c1, c2, c3, c4, c5, c6, c7) \
+    _mm_shufflehi_epi16( \
+      _mm_shufflelo_epi16((v), SIMDE_WASM_I16X8_SHUFFLE_IMM_(c0, c1, c2, c3)), \
+      SIMDE_WASM_I16X8_SHUFFLE_IMM_(c4, c5, c6, c7))
+
+  #define \
+    simde_wasm_i16x8_shuffle( \
+        a, b, \
+        c0, c1,  c2,  c3,  c4,  c5,  c6,  c7) \
+    ( \
+      ((((c0) | (c2) | (c4) | (c6)) & 1) == 0 && \
+       SIMDE_WASM_I16X8_SHUFFLE_MATCH_( \
+         (c0), (c1), (c2), (c3), (c4), (c5), (c6), (c7), \
+         (c0), (c0) + 1, (c2), (c2) + 1, (c4), (c4) + 1, (c6), (c6) + 1)) ? \
+        simde_wasm_i32x4_shuffle((a), (b), (c0) >> 1, (c2) >> 1, (c4) >> 1, (c6) >> 1) : \
+      SIMDE_WASM_I16X8_SHUFFLE_IS_PSHUFLHW_(c0, c1, c2, c3, c4, c5, c6, c7) ? \
+        (((c0) < 8) ? \
+          SIMDE_WASM_I16X8_SHUFFLE_PSHUFLHW_((a), c0, c1, c2, c3, c4, c5, c6, c7) : \
+          SIMDE_WASM_I16X8_SHUFFLE_PSHUFLHW_((b), c0, c1, c2, c3, c4, c5, c6, c7)) : \
+      SIMDE_WASM_I16X8_SHUFFLE_MATCH_( \
+        (c0), (c1), (c2), (c3), (c4), (c5), (c6), (c7), \
+        (c0), (c0), (c0), (c0), (c0), (c0), (c0), (c0)) ? \
+        (((c0) & 4) ? \
+          _mm_shuffle_epi32(_mm_shufflehi_epi16(((c0) < 8) ? (a) : (b), ((c0) & 3) * 0x55), 0xaa) : \
+          _mm_shuffle_epi32(_mm_shufflelo_epi16(((c0) < 8) ? (a) : (b), ((c0) & 3) * 0x55), 0x00)) : \
+        simde_wasm_i16x8_shuffle((a), (b), \
+          (c0), (c1),  (c2),  (c3),  (c4),  (c5),  (c6),  (c7)) \
+    )
 #endif
 #if defined(SIMDE_WASM_SIMD128_ENABLE_NATIVE_ALIASES)
   #define \
@@ -5795,10 +6230,73 @@ simde_wasm_i32x4_shuffle (
     b_ = simde_v128_to_private(b),
     r_;
 
-  r_.i32[ 0] = (c0 < 4) ? a_.i32[ c0] : b_.i32[ c0 & 3];
-  r_.i32[ 1] = (c1 < 4) ? a_.i32[ c1] : b_.i32[ c1 & 3];
-  r_.i32[ 2] = (c2 < 4) ? a_.i32[ c2] : b_.i32[ c2 & 3];
-  r_.i32[ 3] = (c3 < 4) ? a_.i32[ c3] : b_.i32[ c3 & 3];
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 0, 1, 2, 3)) {
+      r_ = a_;
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 4, 5, 6, 7)) {
+      r_ = b_;
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 0, 4, 1, 5)) {
+      r_.sse_m128i = _mm_unpacklo_epi32(a_.sse_m128i, b_.sse_m128i);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 4, 0, 5, 1)) {
+      r_.sse_m128i = _mm_unpacklo_epi32(b_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 2, 6, 3, 7)) {
+      r_.sse_m128i = _mm_unpackhi_epi32(a_.sse_m128i, b_.sse_m128i);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 6, 2, 7, 3)) {
+      r_.sse_m128i = _mm_unpackhi_epi32(b_.sse_m128i, a_.sse_m128i);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 4, 1, 2, 3)) {
+      r_.sse_m128 = _mm_move_ss(a_.sse_m128, b_.sse_m128);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 0, 5, 6, 7)) {
+      r_.sse_m128 = _mm_move_ss(b_.sse_m128, a_.sse_m128);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0 & 3, c1 & 3, c2 & 3, c3 & 3, 0, 1, 2, 3)) {
+      /* blend */
+      const __m128i mask = _mm_setr_epi32(-(c0 >> 2), -(c1 >> 2), -(c2 >> 2), -(c3 >> 2));
+      #if defined(SIMDE_X86_SSE4_1_NATIVE)
+        r_.sse_m128i = _mm_blendv_epi8(a_.sse_m128i, b_.sse_m128i, mask);
+      #else
+        r_.sse_m128i = _mm_or_si128(_mm_and_si128(mask, b_.sse_m128i), _mm_andnot_si128(mask, a_.sse_m128i));
+      #endif
+    } else {
+      r_ = simde_v128_to_private(
+        (simde_wasm_i8x16_shuffle)(simde_v128_from_private(a_), simde_v128_from_private(b_),
+          c0 * 4, c0 * 4 + 1, c0 * 4 + 2, c0 * 4 + 3, c1 * 4, c1 * 4 + 1, c1 * 4 + 2, c1 * 4 + 3,
+          c2 * 4, c2 * 4 + 1, c2 * 4 + 2, c2 * 4 + 3, c3 * 4, c3 * 4 + 1, c3 * 4 + 2, c3 * 4 + 3));
+    }
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 0, 1, 2, 3)) {
+      r_ = a_;
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 4, 5, 6, 7)) {
+      r_ = b_;
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 0, 4, 1, 5)) {
+      r_.neon_i32 = vzip1q_s32(a_.neon_i32, b_.neon_i32);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 2, 6, 3, 7)) {
+      r_.neon_i32 = vzip2q_s32(a_.neon_i32, b_.neon_i32);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 0, 2, 4, 6)) {
+      r_.neon_i32 = vuzp1q_s32(a_.neon_i32, b_.neon_i32);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 1, 3, 5, 7)) {
+      r_.neon_i32 = vuzp2q_s32(a_.neon_i32, b_.neon_i32);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 0, 4, 2, 6)) {
+      r_.neon_i32 = vtrn1q_s32(a_.neon_i32, b_.neon_i32);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, 1, 5, 3, 7)) {
+      r_.neon_i32 = vtrn2q_s32(a_.neon_i32, b_.neon_i32);
+    } else if (SIMDE_WASM_I32X4_SHUFFLE_MATCH_(c0, c1, c2, c3, c0, c0, c0, c0)) {
+      r_.neon_i32 = vdupq_n_s32((c0 < 4) ? a_.i32[c0] : b_.i32[c0 & 3]);
+    } else {
+      r_ = simde_v128_to_private(
+        (simde_wasm_i8x16_shuffle)(simde_v128_from_private(a_), simde_v128_from_private(b_),
+          c0 * 4, c0 * 4 + 1, c0 * 4 + 2, c0 * 4 + 3, c1 * 4, c1 * 4 + 1, c1 * 4 + 2, c1 * 4 + 3,
+          c2 * 4, c2 * 4 + 1, c2 * 4 + 2, c2 * 4 + 3, c3 * 4, c3 * 4 + 1, c3 * 4 + 2, c3 * 4 + 3));
+    }
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
+    r_ = simde_v128_to_private(
+      (simde_wasm_i8x16_shuffle)(simde_v128_from_private(a_), simde_v128_from_private(b_),
+        c0 * 4, c0 * 4 + 1, c0 * 4 + 2, c0 * 4 + 3, c1 * 4, c1 * 4 + 1, c1 * 4 + 2, c1 * 4 + 3,
+        c2 * 4, c2 * 4 + 1, c2 * 4 + 2, c2 * 4 + 3, c3 * 4, c3 * 4 + 1, c3 * 4 + 2, c3 * 4 + 3));
+  #else
+    r_.i32[ 0] = (c0 < 4) ? a_.i32[ c0] : b_.i32[ c0 & 3];
+    r_.i32[ 1] = (c1 < 4) ? a_.i32[ c1] : b_.i32[ c1 & 3];
+    r_.i32[ 2] = (c2 < 4) ? a_.i32[ c2] : b_.i32[ c2 & 3];
+    r_.i32[ 3] = (c3 < 4) ? a_.i32[ c3] : b_.i32[ c3 & 3];
+  #endif
 
   return simde_v128_from_private(r_);
 }
@@ -5821,6 +6319,34 @@ simde_wasm_i32x4_shuffle (
           HEDLEY_REINTERPRET_CAST(int32_t SIMDE_VECTOR(16), b), \
           c0, c1,  c2,  c3)); \
     }))
+#elif defined(SIMDE_X86_SSE2_NATIVE)
+  /* pshufd when every lane comes from one input, shufps when the low
+   * half comes from one input and the high half from the other. */
+  #define \
+    simde_wasm_i32x4_shuffle( \
+        a, b, \
+        c0, c1,  c2,  c3) \
+    ( \
+      (((c0) | (c1) | (c2) | (c3)) < 4) ? \
+        _mm_shuffle_epi32((a), SIMDE_WASM_I16X8_SHUFFLE_IMM_(c0, c1, c2, c3)) : \
+      (((c0) & (c1) & (c2) & (c3) & 4) != 0) ? \
+        _mm_shuffle_epi32((b), SIMDE_WASM_I16X8_SHUFFLE_IMM_(c0, c1, c2, c3)) : \
+      ((((c0) | (c1)) < 4) && (((c2) & (c3) & 4) != 0)) ? \
+        _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), SIMDE_WASM_I16X8_SHUFFLE_IMM_(c0, c1, c2, c3))) : \
+      ((((c0) & (c1) & 4) != 0) && (((c2) | (c3)) < 4)) ? \
+        _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(b), _mm_castsi128_ps(a), SIMDE_WASM_I16X8_SHUFFLE_IMM_(c0, c1, c2, c3))) : \
+        simde_wasm_i32x4_shuffle((a), (b), (c0), (c1), (c2), (c3)) \
+    )
+#elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define \
+    simde_wasm_i32x4_shuffle( \
+        a, b, \
+        c0, c1,  c2,  c3) \
+    ( \
+      ((((c0) & 3) != 0) && SIMDE_WASM_I32X4_SHUFFLE_MATCH_((c0), (c1), (c2), (c3), (c0), ((c0) + 1) & 7, ((c0) + 2) & 7, ((c0) + 3) & 7)) ? \
+        (((c0) < 4) ? vextq_s32((a), (b), (c0) & 3) : vextq_s32((b), (a), (c0) & 3)) : \
+        simde_wasm_i32x4_shuffle((a), (b), (c0), (c1), (c2), (c3)) \
+    )
 #endif
 #if defined(SIMDE_WASM_SIMD128_ENABLE_NATIVE_ALIASES)
   #define \
@@ -5840,8 +6366,45 @@ simde_wasm_i64x2_shuffle (
     b_ = simde_v128_to_private(b),
     r_;
 
-  r_.i64[ 0] = (c0 < 2) ? a_.i64[ c0] : b_.i64[ c0 & 1];
-  r_.i64[ 1] = (c1 < 2) ? a_.i64[ c1] : b_.i64[ c1 & 1];
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    /* Only 16 possible patterns, all of which are a single
+     * instruction. */
+    switch ((c0 << 2) | c1) {
+      case  1: r_ = a_; break;
+      case 11: r_ = b_; break;
+      case  0: r_.sse_m128i = _mm_unpacklo_epi64(a_.sse_m128i, a_.sse_m128i); break;
+      case  2: r_.sse_m128i = _mm_unpacklo_epi64(a_.sse_m128i, b_.sse_m128i); break;
+      case  8: r_.sse_m128i = _mm_unpacklo_epi64(b_.sse_m128i, a_.sse_m128i); break;
+      case 10: r_.sse_m128i = _mm_unpacklo_epi64(b_.sse_m128i, b_.sse_m128i); break;
+      case  5: r_.sse_m128i = _mm_unpackhi_epi64(a_.sse_m128i, a_.sse_m128i); break;
+      case  7: r_.sse_m128i = _mm_unpackhi_epi64(a_.sse_m128i, b_.sse_m128i); break;
+      case 13: r_.sse_m128i = _mm_unpackhi_epi64(b_.sse_m128i, a_.sse_m128i); break;
+      case 15: r_.sse_m128i = _mm_unpackhi_epi64(b_.sse_m128i, b_.sse_m128i); break;
+      case  3: r_.sse_m128d = _mm_move_sd(b_.sse_m128d, a_.sse_m128d); break;
+      case  9: r_.sse_m128d = _mm_move_sd(a_.sse_m128d, b_.sse_m128d); break;
+      case  4: r_.sse_m128i = _mm_shuffle_epi32(a_.sse_m128i, _MM_SHUFFLE(1, 0, 3, 2)); break;
+      case 14: r_.sse_m128i = _mm_shuffle_epi32(b_.sse_m128i, _MM_SHUFFLE(1, 0, 3, 2)); break;
+      case  6: r_.sse_m128d = _mm_shuffle_pd(a_.sse_m128d, b_.sse_m128d, 1); break;
+      default: r_.sse_m128d = _mm_shuffle_pd(b_.sse_m128d, a_.sse_m128d, 1); break;
+    }
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    if ((c0 == 0) && (c1 == 1)) {
+      r_ = a_;
+    } else if ((c0 == 2) && (c1 == 3)) {
+      r_ = b_;
+    } else if ((c0 == 1) && (c1 == 2)) {
+      r_.neon_i64 = vextq_s64(a_.neon_i64, b_.neon_i64, 1);
+    } else if ((c0 == 3) && (c1 == 0)) {
+      r_.neon_i64 = vextq_s64(b_.neon_i64, a_.neon_i64, 1);
+    } else {
+      r_.neon_i64 = vcombine_s64(
+        (c0 & 1) ? vget_high_s64((c0 < 2) ? a_.neon_i64 : b_.neon_i64) : vget_low_s64((c0 < 2) ? a_.neon_i64 : b_.neon_i64),
+        (c1 & 1) ? vget_high_s64((c1 < 2) ? a_.neon_i64 : b_.neon_i64) : vget_low_s64((c1 < 2) ? a_.neon_i64 : b_.neon_i64));
+    }
+  #else
+    r_.i64[ 0] = (c0 < 2) ? a_.i64[ c0] : b_.i64[ c0 & 1];
+    r_.i64[ 1] = (c1 < 2) ? a_.i64[ c1] : b_.i64[ c1 & 1];
+  #endif
 
   return simde_v128_from_private(r_);
 }
@@ -6726,6 +7289,12 @@ simde_wasm_i16x8_extmul_low_i8x16 (simde_v128_t a, simde_v128_t b) {
       #endif
 
       r_.altivec_i16 = vec_mule(ashuf, bshuf);
+    #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.sse_m128i =
+        _mm_mullo_epi16(
+          _mm_cvtepi8_epi16(a_.sse_m128i),
+          _mm_cvtepi8_epi16(b_.sse_m128i)
+        );
     #elif defined(SIMDE_X86_SSE2_NATIVE)
       r_.sse_m128i =
         _mm_mullo_epi16(
@@ -6856,6 +7425,17 @@ simde_wasm_i64x2_extmul_low_i32x4 (simde_v128_t a, simde_v128_t b) {
           _mm_shuffle_epi32(a_.sse_m128i, _MM_SHUFFLE(1, 1, 0, 0)),
           _mm_shuffle_epi32(b_.sse_m128i, _MM_SHUFFLE(1, 1, 0, 0))
         );
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      /* Unsigned product, then subtract (a < 0 ? b : 0) + (b < 0 ? a : 0)
+       * from the upper half to get the signed one. */
+      __m128i as = _mm_shuffle_epi32(a_.sse_m128i, _MM_SHUFFLE(1, 1, 0, 0));
+      __m128i bs = _mm_shuffle_epi32(b_.sse_m128i, _MM_SHUFFLE(1, 1, 0, 0));
+      __m128i fix =
+        _mm_add_epi32(
+          _mm_and_si128(_mm_srai_epi32(as, 31), bs),
+          _mm_and_si128(_mm_srai_epi32(bs, 31), as)
+        );
+      r_.sse_m128i = _mm_sub_epi64(_mm_mul_epu32(as, bs), _mm_slli_epi64(fix, 32));
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && HEDLEY_HAS_BUILTIN(__builtin_shufflevector)
       r_.i64 =
         __builtin_convertvector(
@@ -6910,6 +7490,18 @@ simde_wasm_u16x8_extmul_low_u8x16 (simde_v128_t a, simde_v128_t b) {
       #endif
 
       r_.altivec_u16 = vec_mule(ashuf, bshuf);
+    #elif defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.sse_m128i =
+        _mm_mullo_epi16(
+          _mm_cvtepu8_epi16(a_.sse_m128i),
+          _mm_cvtepu8_epi16(b_.sse_m128i)
+        );
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      r_.sse_m128i =
+        _mm_mullo_epi16(
+          _mm_unpacklo_epi8(a_.sse_m128i, _mm_setzero_si128()),
+          _mm_unpacklo_epi8(b_.sse_m128i, _mm_setzero_si128())
+        );
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && HEDLEY_HAS_BUILTIN(__builtin_shufflevector)
       r_.u16 =
         __builtin_convertvector(
@@ -7203,6 +7795,17 @@ simde_wasm_i64x2_extmul_high_i32x4 (simde_v128_t a, simde_v128_t b) {
           _mm_shuffle_epi32(a_.sse_m128i, _MM_SHUFFLE(3, 3, 2, 2)),
           _mm_shuffle_epi32(b_.sse_m128i, _MM_SHUFFLE(3, 3, 2, 2))
         );
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      /* Unsigned product, then subtract (a < 0 ? b : 0) + (b < 0 ? a : 0)
+       * from the upper half to get the signed one. */
+      __m128i as = _mm_shuffle_epi32(a_.sse_m128i, _MM_SHUFFLE(3, 3, 2, 2));
+      __m128i bs = _mm_shuffle_epi32(b_.sse_m128i, _MM_SHUFFLE(3, 3, 2, 2));
+      __m128i fix =
+        _mm_add_epi32(
+          _mm_and_si128(_mm_srai_epi32(as, 31), bs),
+          _mm_and_si128(_mm_srai_epi32(bs, 31), as)
+        );
+      r_.sse_m128i = _mm_sub_epi64(_mm_mul_epu32(as, bs), _mm_slli_epi64(fix, 32));
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && HEDLEY_HAS_BUILTIN(__builtin_shufflevector)
       r_.i64 =
         __builtin_convertvector(
@@ -7249,6 +7852,12 @@ simde_wasm_u16x8_extmul_high_u8x16 (simde_v128_t a, simde_v128_t b) {
           vec_mergel(a_.altivec_u8, a_.altivec_u8),
           vec_mergel(b_.altivec_u8, b_.altivec_u8)
         );
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      r_.sse_m128i =
+        _mm_mullo_epi16(
+          _mm_unpackhi_epi8(a_.sse_m128i, _mm_setzero_si128()),
+          _mm_unpackhi_epi8(b_.sse_m128i, _mm_setzero_si128())
+        );
     #elif defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && HEDLEY_HAS_BUILTIN(__builtin_shufflevector)
       r_.u16 =
         __builtin_convertvector(
@@ -7396,6 +8005,12 @@ simde_wasm_i16x8_extadd_pairwise_i8x16 (simde_v128_t a) {
       r_.sse_m128i = _mm_haddw_epi8(a_.sse_m128i);
     #elif defined(SIMDE_X86_SSSE3_NATIVE)
       r_.sse_m128i = _mm_maddubs_epi16(_mm_set1_epi8(INT8_C(1)), a_.sse_m128i);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      r_.sse_m128i =
+        _mm_add_epi16(
+          _mm_srai_epi16(_mm_slli_epi16(a_.sse_m128i, 8), 8),
+          _mm_srai_epi16(a_.sse_m128i, 8)
+        );
     #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
       SIMDE_POWER_ALTIVEC_VECTOR(signed char) one = vec_splat_s8(1);
       r_.altivec_i16 =
@@ -7478,6 +8093,12 @@ simde_wasm_u16x8_extadd_pairwise_u8x16 (simde_v128_t a) {
       r_.sse_m128i = _mm_haddw_epu8(a_.sse_m128i);
     #elif defined(SIMDE_X86_SSSE3_NATIVE)
       r_.sse_m128i = _mm_maddubs_epi16(a_.sse_m128i, _mm_set1_epi8(INT8_C(1)));
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      r_.sse_m128i =
+        _mm_add_epi16(
+          _mm_srli_epi16(a_.sse_m128i, 8),
+          _mm_and_si128(a_.sse_m128i, _mm_set1_epi16(INT16_C(0x00ff)))
+        );
     #elif defined(SIMDE_POWER_ALTIVEC_P6_NATIVE)
       SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) one = vec_splat_u8(1);
       r_.altivec_u16 =
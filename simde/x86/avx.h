@@ -5294,6 +5294,12 @@ void
 simde_mm256_stream_ps (simde_float32 mem_addr[8], simde__m256 a) {
   #if defined(SIMDE_X86_AVX_NATIVE)
     _mm256_stream_ps(mem_addr, a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m256_private a_ = simde__m256_to_private(a);
+    __builtin_nontemporal_store(a_.f32, SIMDE_ALIGN_CAST(__typeof__(a_.f32)*, mem_addr));
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    simde__m256_private a_ = simde__m256_to_private(a);
+    simde_x_arm_neon_stnp_u8x2_(mem_addr, vreinterpretq_u8_f32(a_.m128_private[0].neon_f32), vreinterpretq_u8_f32(a_.m128_private[1].neon_f32));
   #else
     simde_memcpy(SIMDE_ALIGN_ASSUME_LIKE(mem_addr, simde__m256), &a, sizeof(a));
   #endif
@@ -5308,6 +5314,12 @@ void
 simde_mm256_stream_pd (simde_float64 mem_addr[4], simde__m256d a) {
   #if defined(SIMDE_X86_AVX_NATIVE)
     _mm256_stream_pd(mem_addr, a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m256d_private a_ = simde__m256d_to_private(a);
+    __builtin_nontemporal_store(a_.f64, SIMDE_ALIGN_CAST(__typeof__(a_.f64)*, mem_addr));
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    simde__m256d_private a_ = simde__m256d_to_private(a);
+    simde_x_arm_neon_stnp_u8x2_(mem_addr, a_.m128d_private[0].neon_u8, a_.m128d_private[1].neon_u8);
   #else
     simde_memcpy(SIMDE_ALIGN_ASSUME_LIKE(mem_addr, simde__m256d), &a, sizeof(a));
   #endif
@@ -5322,8 +5334,14 @@ void
 simde_mm256_stream_si256 (simde__m256i* mem_addr, simde__m256i a) {
   #if defined(SIMDE_X86_AVX_NATIVE)
     _mm256_stream_si256(mem_addr, a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+    __builtin_nontemporal_store(a_.i64, SIMDE_ALIGN_CAST(__typeof__(a_.i64)*, mem_addr));
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    simde__m256i_private a_ = simde__m256i_to_private(a);
+    simde_x_arm_neon_stnp_u8x2_(mem_addr, a_.m128i_private[0].neon_u8, a_.m128i_private[1].neon_u8);
   #else
-  simde_memcpy(SIMDE_ALIGN_ASSUME_LIKE(mem_addr, simde__m256i), &a, sizeof(a));
+    simde_memcpy(SIMDE_ALIGN_ASSUME_LIKE(mem_addr, simde__m256i), &a, sizeof(a));
   #endif
 }
 #if defined(SIMDE_X86_AVX_ENABLE_NATIVE_ALIASES)
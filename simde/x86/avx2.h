@@ -3808,10 +3808,26 @@ simde_mm256_permute4x64_epi64 (simde__m256i a, const int imm8)
     r_,
     a_ = simde__m256i_to_private(a);
 
-  r_.i64[0] = (imm8 & 0x02) ? a_.i64[((imm8       ) & 1)+2] : a_.i64[(imm8       ) & 1];
-  r_.i64[1] = (imm8 & 0x08) ? a_.i64[((imm8 >> 2  ) & 1)+2] : a_.i64[(imm8 >> 2  ) & 1];
-  r_.i64[2] = (imm8 & 0x20) ? a_.i64[((imm8 >> 4  ) & 1)+2] : a_.i64[(imm8 >> 4  ) & 1];
-  r_.i64[3] = (imm8 & 0x80) ? a_.i64[((imm8 >> 6  ) & 1)+2] : a_.i64[(imm8 >> 6  ) & 1];
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    uint8x16x2_t table = { { a_.m128i_private[0].neon_u8,
+                             a_.m128i_private[1].neon_u8 } };
+    const uint64_t byte_index64 = UINT64_C(0x0706050403020100);
+    const uint64_t shift64 = UINT64_C(0x0808080808080808);
+
+    r_.m128i_private[0].neon_u8 =
+      vqtbl2q_u8(table, vreinterpretq_u8_u64(vcombine_u64(
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8     ) & 3))),
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8 >> 2) & 3))))));
+    r_.m128i_private[1].neon_u8 =
+      vqtbl2q_u8(table, vreinterpretq_u8_u64(vcombine_u64(
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8 >> 4) & 3))),
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8 >> 6) & 3))))));
+  #else
+    r_.i64[0] = (imm8 & 0x02) ? a_.i64[((imm8       ) & 1)+2] : a_.i64[(imm8       ) & 1];
+    r_.i64[1] = (imm8 & 0x08) ? a_.i64[((imm8 >> 2  ) & 1)+2] : a_.i64[(imm8 >> 2  ) & 1];
+    r_.i64[2] = (imm8 & 0x20) ? a_.i64[((imm8 >> 4  ) & 1)+2] : a_.i64[(imm8 >> 4  ) & 1];
+    r_.i64[3] = (imm8 & 0x80) ? a_.i64[((imm8 >> 6  ) & 1)+2] : a_.i64[(imm8 >> 6  ) & 1];
+  #endif
 
   return simde__m256i_from_private(r_);
 }
@@ -3831,10 +3847,26 @@ simde_mm256_permute4x64_pd (simde__m256d a, const int imm8)
     r_,
     a_ = simde__m256d_to_private(a);
 
-  r_.f64[0] = (imm8 & 0x02) ? a_.f64[((imm8       ) & 1)+2] : a_.f64[(imm8       ) & 1];
-  r_.f64[1] = (imm8 & 0x08) ? a_.f64[((imm8 >> 2  ) & 1)+2] : a_.f64[(imm8 >> 2  ) & 1];
-  r_.f64[2] = (imm8 & 0x20) ? a_.f64[((imm8 >> 4  ) & 1)+2] : a_.f64[(imm8 >> 4  ) & 1];
-  r_.f64[3] = (imm8 & 0x80) ? a_.f64[((imm8 >> 6  ) & 1)+2] : a_.f64[(imm8 >> 6  ) & 1];
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    uint8x16x2_t table = { { a_.m128d_private[0].neon_u8,
+                             a_.m128d_private[1].neon_u8 } };
+    const uint64_t byte_index64 = UINT64_C(0x0706050403020100);
+    const uint64_t shift64 = UINT64_C(0x0808080808080808);
+
+    r_.m128d_private[0].neon_u8 =
+      vqtbl2q_u8(table, vreinterpretq_u8_u64(vcombine_u64(
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8     ) & 3))),
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8 >> 2) & 3))))));
+    r_.m128d_private[1].neon_u8 =
+      vqtbl2q_u8(table, vreinterpretq_u8_u64(vcombine_u64(
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8 >> 4) & 3))),
+        vcreate_u64(byte_index64 + (shift64 * HEDLEY_STATIC_CAST(uint64_t, (imm8 >> 6) & 3))))));
+  #else
+    r_.f64[0] = (imm8 & 0x02) ? a_.f64[((imm8       ) & 1)+2] : a_.f64[(imm8       ) & 1];
+    r_.f64[1] = (imm8 & 0x08) ? a_.f64[((imm8 >> 2  ) & 1)+2] : a_.f64[(imm8 >> 2  ) & 1];
+    r_.f64[2] = (imm8 & 0x20) ? a_.f64[((imm8 >> 4  ) & 1)+2] : a_.f64[(imm8 >> 4  ) & 1];
+    r_.f64[3] = (imm8 & 0x80) ? a_.f64[((imm8 >> 6  ) & 1)+2] : a_.f64[(imm8 >> 6  ) & 1];
+  #endif
 
   return simde__m256d_from_private(r_);
 }
@@ -3857,10 +3889,25 @@ simde_mm256_permutevar8x32_epi32 (simde__m256i a, simde__m256i idx) {
       a_ = simde__m256i_to_private(a),
       idx_ = simde__m256i_to_private(idx);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
-      r_.i32[i] = a_.i32[idx_.i32[i] & 7];
-    }
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      uint8x16x2_t table = { { a_.m128i_private[0].neon_u8,
+                               a_.m128i_private[1].neon_u8 } };
+      uint32x4_t mask32 = vdupq_n_u32(0x00000007);
+      uint32x4_t byte_index32 = vdupq_n_u32(0x03020100);
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        uint32x4_t index32 = vandq_u32(idx_.m128i_private[i].neon_u32, mask32);
+        index32 = vmulq_n_u32(index32, 0x04040404);
+        index32 = vaddq_u32(index32, byte_index32);
+        r_.m128i_private[i].neon_u8 = vqtbl2q_u8(table, vreinterpretq_u8_u32(index32));
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        r_.i32[i] = a_.i32[idx_.i32[i] & 7];
+      }
+    #endif
 
     return simde__m256i_from_private(r_);
   #endif
@@ -3886,10 +3933,25 @@ simde_mm256_permutevar8x32_ps (simde__m256 a, simde__m256i idx) {
     simde__m256i_private
       idx_ = simde__m256i_to_private(idx);
 
-    SIMDE_VECTORIZE
-    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
-      r_.f32[i] = a_.f32[idx_.i32[i] & 7];
-    }
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      uint8x16x2_t table = { { a_.m128_private[0].neon_u8,
+                               a_.m128_private[1].neon_u8 } };
+      uint32x4_t mask32 = vdupq_n_u32(0x00000007);
+      uint32x4_t byte_index32 = vdupq_n_u32(0x03020100);
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128_private) / sizeof(r_.m128_private[0])) ; i++) {
+        uint32x4_t index32 = vandq_u32(idx_.m128i_private[i].neon_u32, mask32);
+        index32 = vmulq_n_u32(index32, 0x04040404);
+        index32 = vaddq_u32(index32, byte_index32);
+        r_.m128_private[i].neon_u8 = vqtbl2q_u8(table, vreinterpretq_u8_u32(index32));
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = a_.f32[idx_.i32[i] & 7];
+      }
+    #endif
 
     return simde__m256_from_private(r_);
   #endif
@@ -4425,6 +4487,22 @@ simde_mm_sllv_epi32 (simde__m128i a, simde__m128i b) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     r_.neon_u32 = vshlq_u32(a_.neon_u32, vreinterpretq_s32_u32(b_.neon_u32));
     r_.neon_u32 = vandq_u32(r_.neon_u32, vcltq_u32(b_.neon_u32, vdupq_n_u32(32)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    /* Multiply by 2^b; the power of two is built in the exponent field of
+     * a float.  2^31 converts to 0x80000000, which happens to be right. */
+    __m128i pow2 = _mm_cvttps_epi32(_mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(b_.n, 23), _mm_set1_epi32(0x3f800000))));
+    pow2 = _mm_and_si128(pow2, _mm_cmpeq_epi32(_mm_srli_epi32(b_.n, 5), _mm_setzero_si128()));
+    #if defined(SIMDE_X86_SSE4_1_NATIVE)
+      r_.n = _mm_mullo_epi32(a_.n, pow2);
+    #else
+      __m128i even = _mm_mul_epu32(a_.n, pow2);
+      __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a_.n, 32), _mm_srli_epi64(pow2, 32));
+      r_.n =
+        _mm_unpacklo_epi32(
+          _mm_shuffle_epi32(even, (0 << 6) | (0 << 4) | (2 << 2) | 0),
+          _mm_shuffle_epi32(odd,  (0 << 6) | (0 << 4) | (2 << 2) | 0)
+        );
+    #endif
   #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
     r_.u32 = HEDLEY_REINTERPRET_CAST(__typeof__(r_.u32), (b_.u32 < UINT32_C(32))) & (a_.u32 << b_.u32);
   #else
@@ -4485,6 +4563,18 @@ simde_mm_sllv_epi64 (simde__m128i a, simde__m128i b) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     r_.neon_u64 = vshlq_u64(a_.neon_u64, vreinterpretq_s64_u64(b_.neon_u64));
     r_.neon_u64 = vandq_u64(r_.neon_u64, vcltq_u64(b_.neon_u64, vdupq_n_u64(64)));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    /* Shifting by 64 or more yields zero, so saturating the count is enough. */
+    uint32x2_t count = vmin_u32(vqmovn_u64(b_.neon_u64), vdup_n_u32(64));
+    r_.neon_u64 = vshlq_u64(a_.neon_u64, vreinterpretq_s64_u64(vmovl_u32(count)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    r_.n =
+      _mm_castpd_si128(
+        _mm_move_sd(
+          _mm_castsi128_pd(_mm_sll_epi64(a_.n, _mm_unpackhi_epi64(b_.n, b_.n))),
+          _mm_castsi128_pd(_mm_sll_epi64(a_.n, b_.n))
+        )
+      );
   #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
     r_.u64 = HEDLEY_REINTERPRET_CAST(__typeof__(r_.u64), (b_.u64 < 64)) & (a_.u64 << b_.u64);
   #else
@@ -4695,6 +4785,13 @@ simde_mm_srav_epi32 (simde__m128i a, simde__m128i count) {
     #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
       int32x4_t cnt = vreinterpretq_s32_u32(vminq_u32(count_.neon_u32, vdupq_n_u32(31)));
       r_.neon_i32 = vshlq_s32(a_.neon_i32, vnegq_s32(cnt));
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      /* _mm_sra_epi32 already fills with the sign bit for counts > 31. */
+      __m128i count_lo = _mm_unpacklo_epi32(count_.n, _mm_setzero_si128());
+      __m128i count_hi = _mm_unpackhi_epi32(count_.n, _mm_setzero_si128());
+      __m128i r01 = _mm_unpacklo_epi64(_mm_sra_epi32(a_.n, count_lo), _mm_sra_epi32(a_.n, _mm_srli_si128(count_lo, 8)));
+      __m128i r23 = _mm_unpackhi_epi64(_mm_sra_epi32(a_.n, count_hi), _mm_sra_epi32(a_.n, _mm_srli_si128(count_hi, 8)));
+      r_.n = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(r01), _mm_castsi128_ps(r23), (3 << 6) | (0 << 4) | (3 << 2) | 0));
     #else
       SIMDE_VECTORIZE
       for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
@@ -5012,7 +5109,16 @@ simde_mm_srlv_epi32 (simde__m128i a, simde__m128i b) {
     b_ = simde__m128i_to_private(b),
     r_;
 
-  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    r_.neon_u32 = vshlq_u32(a_.neon_u32, vnegq_s32(vreinterpretq_s32_u32(b_.neon_u32)));
+    r_.neon_u32 = vandq_u32(r_.neon_u32, vcltq_u32(b_.neon_u32, vdupq_n_u32(32)));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i b_lo = _mm_unpacklo_epi32(b_.n, _mm_setzero_si128());
+    __m128i b_hi = _mm_unpackhi_epi32(b_.n, _mm_setzero_si128());
+    __m128i r01 = _mm_unpacklo_epi64(_mm_srl_epi32(a_.n, b_lo), _mm_srl_epi32(a_.n, _mm_srli_si128(b_lo, 8)));
+    __m128i r23 = _mm_unpackhi_epi64(_mm_srl_epi32(a_.n, b_hi), _mm_srl_epi32(a_.n, _mm_srli_si128(b_hi, 8)));
+    r_.n = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(r01), _mm_castsi128_ps(r23), (3 << 6) | (0 << 4) | (3 << 2) | 0));
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
     r_.u32 = HEDLEY_REINTERPRET_CAST(__typeof__(r_.u32), (b_.u32 < 32)) & (a_.u32 >> b_.u32);
   #else
     SIMDE_VECTORIZE
@@ -5039,7 +5145,10 @@ simde_mm256_srlv_epi32 (simde__m256i a, simde__m256i b) {
     b_ = simde__m256i_to_private(b),
     r_;
 
-  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  #if SIMDE_NATURAL_INT_VECTOR_SIZE_LE(128)
+    r_.m128i[0] = simde_mm_srlv_epi32(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_srlv_epi32(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
     r_.u32 = HEDLEY_REINTERPRET_CAST(__typeof__(r_.u32), (b_.u32 < 32)) & (a_.u32 >> b_.u32);
   #else
     SIMDE_VECTORIZE
@@ -5066,7 +5175,21 @@ simde_mm_srlv_epi64 (simde__m128i a, simde__m128i b) {
     b_ = simde__m128i_to_private(b),
     r_;
 
-  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    r_.neon_u64 = vshlq_u64(a_.neon_u64, vnegq_s64(vreinterpretq_s64_u64(b_.neon_u64)));
+    r_.neon_u64 = vandq_u64(r_.neon_u64, vcltq_u64(b_.neon_u64, vdupq_n_u64(64)));
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    uint32x2_t count = vmin_u32(vqmovn_u64(b_.neon_u64), vdup_n_u32(64));
+    r_.neon_u64 = vshlq_u64(a_.neon_u64, vmovl_s32(vneg_s32(vreinterpret_s32_u32(count))));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    r_.n =
+      _mm_castpd_si128(
+        _mm_move_sd(
+          _mm_castsi128_pd(_mm_srl_epi64(a_.n, _mm_unpackhi_epi64(b_.n, b_.n))),
+          _mm_castsi128_pd(_mm_srl_epi64(a_.n, b_.n))
+        )
+      );
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
     r_.u64 = HEDLEY_REINTERPRET_CAST(__typeof__(r_.u64), (b_.u64 < 64)) & (a_.u64 >> b_.u64);
   #else
     SIMDE_VECTORIZE
@@ -5093,7 +5216,10 @@ simde_mm256_srlv_epi64 (simde__m256i a, simde__m256i b) {
     b_ = simde__m256i_to_private(b),
     r_;
 
-  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+  #if SIMDE_NATURAL_INT_VECTOR_SIZE_LE(128)
+    r_.m128i[0] = simde_mm_srlv_epi64(a_.m128i[0], b_.m128i[0]);
+    r_.m128i[1] = simde_mm_srlv_epi64(a_.m128i[1], b_.m128i[1]);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
     r_.u64 = HEDLEY_REINTERPRET_CAST(__typeof__(r_.u64), (b_.u64 < 64)) & (a_.u64 >> b_.u64);
   #else
     SIMDE_VECTORIZE
@@ -5117,6 +5243,14 @@ simde__m256i
 simde_mm256_stream_load_si256 (const simde__m256i* mem_addr) {
   #if defined(SIMDE_X86_AVX2_NATIVE)
     return _mm256_stream_load_si256(HEDLEY_CONST_CAST(simde__m256i*, mem_addr));
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_load) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m256i_private r_;
+    r_.i64 = __builtin_nontemporal_load(SIMDE_ALIGN_CAST(const __typeof__(r_.i64)*, mem_addr));
+    return simde__m256i_from_private(r_);
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    simde__m256i_private r_;
+    simde_x_arm_neon_ldnp_u8x2_(mem_addr, &(r_.m128i_private[0].neon_u8), &(r_.m128i_private[1].neon_u8));
+    return simde__m256i_from_private(r_);
   #else
     simde__m256i r;
     simde_memcpy(&r, SIMDE_ALIGN_ASSUME_LIKE(mem_addr, simde__m256i), sizeof(r));
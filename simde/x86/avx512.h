@@ -53,6 +53,8 @@
 #include "avx512/conflict.h"
 #include "avx512/copysign.h"
 #include "avx512/cvt.h"
+#include "avx512/cvtmask.h"
+#include "avx512/cvtne.h"
 #include "avx512/cvtt.h"
 #include "avx512/cvts.h"
 #include "avx512/dbsad.h"
@@ -71,14 +73,25 @@
 #include "avx512/fmsub.h"
 #include "avx512/fnmadd.h"
 #include "avx512/fnmsub.h"
+#include "avx512/getexp.h"
+#include "avx512/getmant.h"
 #include "avx512/insert.h"
 #include "avx512/kshift.h"
 #include "avx512/knot.h"
 #include "avx512/kxor.h"
+#include "avx512/kadd.h"
+#include "avx512/kand.h"
+#include "avx512/kandn.h"
+#include "avx512/kor.h"
+#include "avx512/kortest.h"
+#include "avx512/ktest.h"
+#include "avx512/kunpack.h"
+#include "avx512/kxnor.h"
 #include "avx512/load.h"
 #include "avx512/loadu.h"
 #include "avx512/lzcnt.h"
 #include "avx512/madd.h"
+#include "avx512/madd52.h"
 #include "avx512/maddubs.h"
 #include "avx512/max.h"
 #include "avx512/min.h"
@@ -99,6 +112,8 @@
 #include "avx512/popcnt.h"
 #include "avx512/range.h"
 #include "avx512/range_round.h"
+#include "avx512/rcp14.h"
+#include "avx512/reduce.h"
 #include "avx512/rol.h"
 #include "avx512/rolv.h"
 #include "avx512/ror.h"
@@ -106,6 +121,7 @@
 #include "avx512/round.h"
 #include "avx512/roundscale.h"
 #include "avx512/roundscale_round.h"
+#include "avx512/rsqrt14.h"
 #include "avx512/sad.h"
 #include "avx512/scalef.h"
 #include "avx512/set.h"
@@ -31,6 +31,7 @@
 #include "types.h"
 #include "../avx2.h"
 #include "mov.h"
+#include "../f16c.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -635,6 +636,43 @@ simde_mm512_maskz_add_pd(simde__mmask8 k, simde__m512d a, simde__m512d b) {
   #define _mm512_maskz_add_pd(k, a, b) simde_mm512_maskz_add_pd(k, a, b)
 #endif
 
+/* Without native FP16 arithmetic we widen to single precision, add,
+ * and round back.  binary32 has more than 2p+2 bits of precision for
+ * p = 11, so the double rounding is innocuous and the result is the
+ * correctly rounded half; the same holds for sub, mul and div. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_add_ph (simde__m512h a, simde__m512h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_add_ph(a, b);
+  #else
+    simde__m512h_private
+      r_,
+      a_ = simde__m512h_to_private(a),
+      b_ = simde__m512h_to_private(b);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_f16 = vaddq_f16(a_.m128i_private[i].neon_f16, b_.m128i_private[i].neon_f16);
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] =
+          simde_mm256_cvtps_ph(
+            simde_mm256_add_ps(simde_mm256_cvtph_ps(a_.m128i[i]), simde_mm256_cvtph_ps(b_.m128i[i])),
+            SIMDE_MM_FROUND_TO_NEAREST_INT
+          );
+      }
+    #endif
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_add_ph
+  #define _mm512_add_ph(a, b) simde_mm512_add_ph(a, b)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
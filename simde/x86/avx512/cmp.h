@@ -33,6 +33,7 @@
 #include "mov_mask.h"
 #include "setzero.h"
 #include "setone.h"
+#include "cvt.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -643,6 +644,41 @@ simde_mm512_cmp_epu16_mask (simde__m512i a, simde__m512i b, const int imm8)
 #define _mm512_mask_cmp_epu16_mask(a, b, imm8) simde_mm512_mask_cmp_epu16_mask((a), (b), (imm8))
 #endif
 
+/* Widening to single precision is exact and preserves ordering, NaNs
+ * and signed zeros, so every predicate gives the same answer on the
+ * widened halves. */
+#if defined(SIMDE_X86_AVX512FP16_NATIVE)
+  #define simde_mm512_cmp_ph_mask(a, b, imm8) _mm512_cmp_ph_mask((a), (b), (imm8))
+#elif defined(SIMDE_STATEMENT_EXPR_)
+  #define simde_mm512_cmp_ph_mask(a, b, imm8) SIMDE_STATEMENT_EXPR_(({ \
+    simde__m512h_private \
+      simde_mm512_cmp_ph_mask_a_ = simde__m512h_to_private((a)), \
+      simde_mm512_cmp_ph_mask_b_ = simde__m512h_to_private((b)); \
+    \
+    HEDLEY_STATIC_CAST(simde__mmask32, \
+      HEDLEY_STATIC_CAST(uint32_t, simde_mm512_cmp_ps_mask(simde_mm512_cvtph_ps(simde_mm512_cmp_ph_mask_a_.m256i[0]), simde_mm512_cvtph_ps(simde_mm512_cmp_ph_mask_b_.m256i[0]), (imm8))) | \
+      (HEDLEY_STATIC_CAST(uint32_t, simde_mm512_cmp_ps_mask(simde_mm512_cvtph_ps(simde_mm512_cmp_ph_mask_a_.m256i[1]), simde_mm512_cvtph_ps(simde_mm512_cmp_ph_mask_b_.m256i[1]), (imm8))) << 16)); \
+  }))
+#else
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_cmp_ph_mask (simde__m512h a, simde__m512h b, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 31) {
+  simde__m512h_private
+    a_ = simde__m512h_to_private(a),
+    b_ = simde__m512h_to_private(b);
+
+  return
+    HEDLEY_STATIC_CAST(simde__mmask32,
+      HEDLEY_STATIC_CAST(uint32_t, simde_mm512_cmp_ps_mask(simde_mm512_cvtph_ps(a_.m256i[0]), simde_mm512_cvtph_ps(b_.m256i[0]), imm8)) |
+      (HEDLEY_STATIC_CAST(uint32_t, simde_mm512_cmp_ps_mask(simde_mm512_cvtph_ps(a_.m256i[1]), simde_mm512_cvtph_ps(b_.m256i[1]), imm8)) << 16));
+}
+#endif
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cmp_ph_mask
+  #define _mm512_cmp_ph_mask(a, b, imm8) simde_mm512_cmp_ph_mask((a), (b), (imm8))
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
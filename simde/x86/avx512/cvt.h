@@ -33,6 +33,7 @@
 #include "types.h"
 #include "mov.h"
 #include "../f16c.h"
+#include "../../simde-bf16.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -278,6 +279,122 @@ simde_mm512_cvtepu32_ps (simde__m512i a) {
   #define _mm512_cvtepu32_ps(a) simde_mm512_cvtepu32_ps(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtpbh_ps (simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtpbh_ps(a);
+  #else
+    simde__m128_private r_;
+    simde__m128bh_private a_ = simde__m128bh_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.neon_u32 = vshll_n_u16(vget_low_u16(a_.neon_u16), 16);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << 16;
+      }
+    #endif
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtpbh_ps
+  #define _mm_cvtpbh_ps(a) simde_mm_cvtpbh_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtpbh_ps (simde__m128bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtpbh_ps(a);
+  #else
+    simde__m256_private r_;
+    simde__m128bh_private a_ = simde__m128bh_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      r_.m128_private[0].neon_u32 = vshll_n_u16(vget_low_u16(a_.neon_u16), 16);
+      r_.m128_private[1].neon_u32 = vshll_n_u16(vget_high_u16(a_.neon_u16), 16);
+    #elif defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      SIMDE_CONVERT_VECTOR_(r_.u32, a_.u16);
+      r_.u32 <<= 16;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << 16;
+      }
+    #endif
+
+    return simde__m256_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtpbh_ps
+  #define _mm256_cvtpbh_ps(a) simde_mm256_cvtpbh_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_cvtpbh_ps (simde__m256bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_cvtpbh_ps(a);
+  #else
+    simde__m512_private r_;
+    simde__m256bh_private a_ = simde__m256bh_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      for (size_t i = 0 ; i < (sizeof(a_.m128_private) / sizeof(a_.m128_private[0])) ; i++) {
+        r_.m128_private[2 * i    ].neon_u32 = vshll_n_u16(vget_low_u16(a_.m128_private[i].neon_u16), 16);
+        r_.m128_private[2 * i + 1].neon_u32 = vshll_n_u16(vget_high_u16(a_.m128_private[i].neon_u16), 16);
+      }
+    #elif defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      SIMDE_CONVERT_VECTOR_(r_.u32, a_.u16);
+      r_.u32 <<= 16;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, a_.u16[i]) << 16;
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtpbh_ps
+  #define _mm512_cvtpbh_ps(a) simde_mm512_cvtpbh_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_cvtpbh_ps (simde__m512 src, simde__mmask16 k, simde__m256bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_mask_cvtpbh_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_cvtpbh_ps
+  #define _mm512_mask_cvtpbh_ps(src, k, a) simde_mm512_mask_cvtpbh_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_cvtpbh_ps (simde__mmask16 k, simde__m256bh a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_maskz_cvtpbh_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_cvtpbh_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_cvtpbh_ps
+  #define _mm512_maskz_cvtpbh_ps(k, a) simde_mm512_maskz_cvtpbh_ps(k, a)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m512
 simde_mm512_cvtph_ps(simde__m256i a) {
@@ -299,6 +416,77 @@ simde_mm512_cvtph_ps(simde__m256i a) {
   #define _mm512_cvtph_ps(a) simde_mm512_cvtph_ps(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_cvtxph_ps (simde__m256h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_cvtxph_ps(a);
+  #else
+    simde__m256h_private a_ = simde__m256h_to_private(a);
+    simde__m512_private r_;
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+      for (size_t i = 0 ; i < (sizeof(a_.m128i_private) / sizeof(a_.m128i_private[0])) ; i++) {
+        r_.m128_private[2 * i    ].neon_f32 = vcvt_f32_f16(vget_low_f16(a_.m128i_private[i].neon_f16));
+        r_.m128_private[2 * i + 1].neon_f32 = vcvt_f32_f16(vget_high_f16(a_.m128i_private[i].neon_f16));
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_cvtph_ps(a_.m128i[i]);
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtxph_ps
+  #define _mm512_cvtxph_ps(a) simde_mm512_cvtxph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256h
+simde_mm512_cvtxps_ph (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_cvtxps_ph(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m256h_private r_;
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_f16 =
+          vcombine_f16(
+            vcvt_f16_f32(a_.m128_private[2 * i    ].neon_f32),
+            vcvt_f16_f32(a_.m128_private[2 * i + 1].neon_f32)
+          );
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm256_cvtps_ph(a_.m256[i], SIMDE_MM_FROUND_TO_NEAREST_INT);
+      }
+    #endif
+
+    return simde__m256h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtxps_ph
+  #define _mm512_cvtxps_ph(a) simde_mm512_cvtxps_ph(a)
+#endif
+
+/* The native version takes a __bfloat16, which is an integer typedef
+ * on some compilers and an arithmetic type on others, so this one is
+ * always emulated; it is only a shift anyway. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm_cvtsbh_ss (simde_bfloat16 a) {
+  return simde_bfloat16_to_float32(a);
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtsbh_ss
+  #define _mm_cvtsbh_ss(a) simde_mm_cvtsbh_ss(a)
+#endif
 
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
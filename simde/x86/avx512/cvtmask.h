@@ -0,0 +1,169 @@
+#if !defined(SIMDE_X86_AVX512_CVTMASK_H)
+#define SIMDE_X86_AVX512_CVTMASK_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask8_u32 (simde__mmask8 a) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtmask8_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask8_u32
+  #define _cvtmask8_u32(a) simde_cvtmask8_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_cvtu32_mask8 (unsigned int a) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtu32_mask8(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu32_mask8
+  #define _cvtu32_mask8(a) simde_cvtu32_mask8(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask16_u32 (simde__mmask16 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtmask16_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask16_u32
+  #define _cvtmask16_u32(a) simde_cvtmask16_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_cvtu32_mask16 (unsigned int a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtu32_mask16(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu32_mask16
+  #define _cvtu32_mask16(a) simde_cvtu32_mask16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask32_u32 (simde__mmask32 a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtmask32_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask32_u32
+  #define _cvtmask32_u32(a) simde_cvtmask32_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_cvtu32_mask32 (unsigned int a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtu32_mask32(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu32_mask32
+  #define _cvtu32_mask32(a) simde_cvtu32_mask32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_cvtmask64_u64 (simde__mmask64 a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtmask64_u64(a);
+  #else
+    return HEDLEY_STATIC_CAST(uint64_t, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask64_u64
+  #define _cvtmask64_u64(a) simde_cvtmask64_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_cvtu64_mask64 (uint64_t a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _cvtu64_mask64(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu64_mask64
+  #define _cvtu64_mask64(a) simde_cvtu64_mask64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_int2mask (int mask) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_int2mask(mask);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, mask);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_int2mask
+  #define _mm512_int2mask(mask) simde_mm512_int2mask(mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm512_mask2int (simde__mmask16 k1) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask2int(k1);
+  #else
+    return HEDLEY_STATIC_CAST(int, k1);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask2int
+  #define _mm512_mask2int(k1) simde_mm512_mask2int(k1)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_CVTMASK_H) */
@@ -0,0 +1,210 @@
+#if !defined(SIMDE_X86_AVX512_CVTNE_H)
+#define SIMDE_X86_AVX512_CVTNE_H
+
+#include "types.h"
+#include "../../simde-bf16.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* vcvtne2ps2bf16 and vcvtneps2bf16 round to nearest-even, quiet NaNs
+ * and, regardless of MXCSR, treat denormal inputs as (signed) zero.
+ * The portable versions do the same.  BFCVTN on Arm honours FPCR.FZ
+ * instead, so denormals are only flushed there if flush-to-zero mode
+ * is enabled. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_bfloat16
+simde_mm_cvtness_sbh (simde_float32 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return simde_uint16_as_bfloat16(simde__m128bh_to_private(_mm_cvtneps_pbh(_mm_set_ss(a))).u16[0]);
+  #else
+    uint32_t f32u = simde_float32_as_uint32(a);
+
+    if ((f32u & UINT32_C(0x7f800000)) == 0)
+      return simde_uint16_as_bfloat16(HEDLEY_STATIC_CAST(uint16_t, (f32u >> 16) & UINT32_C(0x8000)));
+
+    return simde_bfloat16_from_float32(a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtness_sbh
+  #define _mm_cvtness_sbh(a) simde_mm_cvtness_sbh(a)
+#endif
+
+/* Converts each lane to bf16, sign-extended to 32 bits so the results
+ * can be narrowed with a saturating pack without changing them. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cvtneps_pbh_epi32 (simde__m128 a) {
+  simde__m128i_private r_;
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    __m128i u = _mm_castps_si128(a_.n);
+    __m128i rounded = _mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(0x7fff)), _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1)));
+    __m128i is_nan = _mm_cmpgt_epi32(_mm_and_si128(u, _mm_set1_epi32(INT32_MAX)), _mm_set1_epi32(0x7f800000));
+    __m128i is_denorm = _mm_cmpeq_epi32(_mm_and_si128(u, _mm_set1_epi32(0x7f800000)), _mm_setzero_si128());
+    rounded = _mm_or_si128(_mm_and_si128(is_nan, _mm_or_si128(u, _mm_set1_epi32(0x00400000))), _mm_andnot_si128(is_nan, rounded));
+    rounded = _mm_or_si128(_mm_and_si128(is_denorm, _mm_and_si128(u, _mm_set1_epi32(INT32_MIN))), _mm_andnot_si128(is_denorm, rounded));
+    r_.n = _mm_srai_epi32(rounded, 16);
+  #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    uint32x4_t u = a_.neon_u32;
+    uint32x4_t rounded = vaddq_u32(vaddq_u32(u, vdupq_n_u32(UINT32_C(0x7fff))), vandq_u32(vshrq_n_u32(u, 16), vdupq_n_u32(UINT32_C(1))));
+    uint32x4_t is_nan = vcgtq_u32(vandq_u32(u, vdupq_n_u32(UINT32_C(0x7fffffff))), vdupq_n_u32(UINT32_C(0x7f800000)));
+    uint32x4_t is_denorm = vceqq_u32(vandq_u32(u, vdupq_n_u32(UINT32_C(0x7f800000))), vdupq_n_u32(UINT32_C(0)));
+    rounded = vbslq_u32(is_nan, vorrq_u32(u, vdupq_n_u32(UINT32_C(0x00400000))), rounded);
+    rounded = vbslq_u32(is_denorm, vandq_u32(u, vdupq_n_u32(UINT32_C(0x80000000))), rounded);
+    r_.neon_i32 = vshrq_n_s32(vreinterpretq_s32_u32(rounded), 16);
+  #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    __typeof__(a_.u32) rounded = a_.u32 + UINT32_C(0x7fff) + ((a_.u32 >> 16) & UINT32_C(1));
+    __typeof__(a_.u32) is_nan = HEDLEY_REINTERPRET_CAST(__typeof__(is_nan), (a_.u32 & UINT32_C(0x7fffffff)) > UINT32_C(0x7f800000));
+    __typeof__(a_.u32) is_denorm = HEDLEY_REINTERPRET_CAST(__typeof__(is_denorm), (a_.u32 & UINT32_C(0x7f800000)) == UINT32_C(0));
+    rounded = (is_nan & (a_.u32 | UINT32_C(0x00400000))) | (~is_nan & rounded);
+    rounded = (is_denorm & (a_.u32 & UINT32_C(0x80000000))) | (~is_denorm & rounded);
+    r_.i32 = HEDLEY_REINTERPRET_CAST(__typeof__(r_.i32), rounded) >> 16;
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      r_.i32[i] = HEDLEY_STATIC_CAST(int16_t, simde_bfloat16_as_uint16(simde_mm_cvtness_sbh(a_.f32[i])));
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_cvtne2ps_pbh (simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtne2ps_pbh(a, b);
+  #else
+    simde__m128bh_private r_;
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+      simde__m128_private
+        a_ = simde__m128_to_private(a),
+        b_ = simde__m128_to_private(b);
+
+      r_.neon_u16 = vreinterpretq_u16_bf16(vcvtq_high_bf16_f32(vcvtq_low_bf16_f32(b_.neon_f32), a_.neon_f32));
+    #else
+      simde__m128i r = simde_mm_packs_epi32(simde_x_mm_cvtneps_pbh_epi32(b), simde_x_mm_cvtneps_pbh_epi32(a));
+      simde_memcpy(&r_, &r, sizeof(r_));
+    #endif
+
+    return simde__m128bh_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtne2ps_pbh
+  #define _mm_cvtne2ps_pbh(a, b) simde_mm_cvtne2ps_pbh(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm256_cvtne2ps_pbh (simde__m256 a, simde__m256 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtne2ps_pbh(a, b);
+  #else
+    simde__m256bh_private r_;
+    simde__m256_private
+      a_ = simde__m256_to_private(a),
+      b_ = simde__m256_to_private(b);
+    simde__m128bh
+      lo = simde_mm_cvtne2ps_pbh(b_.m128[1], b_.m128[0]),
+      hi = simde_mm_cvtne2ps_pbh(a_.m128[1], a_.m128[0]);
+
+    simde_memcpy(&r_.m128[0], &lo, sizeof(lo));
+    simde_memcpy(&r_.m128[1], &hi, sizeof(hi));
+
+    return simde__m256bh_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtne2ps_pbh
+  #define _mm256_cvtne2ps_pbh(a, b) simde_mm256_cvtne2ps_pbh(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512bh
+simde_mm512_cvtne2ps_pbh (simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_cvtne2ps_pbh(a, b);
+  #else
+    simde__m512bh_private r_;
+    simde__m512_private
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+    simde__m256bh
+      lo = simde_mm256_cvtne2ps_pbh(b_.m256[1], b_.m256[0]),
+      hi = simde_mm256_cvtne2ps_pbh(a_.m256[1], a_.m256[0]);
+
+    simde_memcpy(&r_.m256[0], &lo, sizeof(lo));
+    simde_memcpy(&r_.m256[1], &hi, sizeof(hi));
+
+    return simde__m512bh_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtne2ps_pbh
+  #define _mm512_cvtne2ps_pbh(a, b) simde_mm512_cvtne2ps_pbh(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm_cvtneps_pbh (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_cvtneps_pbh(a);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+    simde__m128bh_private r_;
+    simde__m128_private a_ = simde__m128_to_private(a);
+
+    r_.neon_u16 = vreinterpretq_u16_bf16(vcvtq_low_bf16_f32(a_.neon_f32));
+
+    return simde__m128bh_from_private(r_);
+  #else
+    return simde_mm_cvtne2ps_pbh(simde_mm_setzero_ps(), a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtneps_pbh
+  #define _mm_cvtneps_pbh(a) simde_mm_cvtneps_pbh(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128bh
+simde_mm256_cvtneps_pbh (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_cvtneps_pbh(a);
+  #else
+    simde__m256_private a_ = simde__m256_to_private(a);
+
+    return simde_mm_cvtne2ps_pbh(a_.m128[1], a_.m128[0]);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtneps_pbh
+  #define _mm256_cvtneps_pbh(a) simde_mm256_cvtneps_pbh(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256bh
+simde_mm512_cvtneps_pbh (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512BF16_NATIVE)
+    return _mm512_cvtneps_pbh(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+
+    return simde_mm256_cvtne2ps_pbh(a_.m256[1], a_.m256[0]);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BF16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_cvtneps_pbh
+  #define _mm512_cvtneps_pbh(a) simde_mm512_cvtneps_pbh(a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_CVTNE_H) */
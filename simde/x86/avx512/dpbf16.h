@@ -8,6 +8,10 @@ HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
 SIMDE_BEGIN_DECLS_
 
+/* BFDOT on Arm doesn't round the intermediate sum the same way
+ * vdpbf16ps does (and always flushes denormals), so results may differ
+ * in the last bit. */
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
 simde_mm_dpbf16_ps (simde__m128 src, simde__m128bh a, simde__m128bh b) {
@@ -20,7 +24,9 @@ simde_mm_dpbf16_ps (simde__m128 src, simde__m128bh a, simde__m128bh b) {
       a_ = simde__m128bh_to_private(a),
       b_ = simde__m128bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+      src_.neon_f32 = vbfdotq_f32(src_.neon_f32, vreinterpretq_bf16_u16(a_.neon_u16), vreinterpretq_bf16_u16(b_.neon_u16));
+    #elif ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
       uint32_t x1 SIMDE_VECTOR(32);
       uint32_t x2 SIMDE_VECTOR(32);
       simde__m128_private
@@ -109,7 +115,16 @@ simde_mm256_dpbf16_ps (simde__m256 src, simde__m256bh a, simde__m256bh b) {
       a_ = simde__m256bh_to_private(a),
       b_ = simde__m256bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+      for (size_t i = 0 ; i < (sizeof(src_.m128_private) / sizeof(src_.m128_private[0])) ; i++) {
+        src_.m128_private[i].neon_f32 =
+          vbfdotq_f32(
+            src_.m128_private[i].neon_f32,
+            vreinterpretq_bf16_u16(a_.m128_private[i].neon_u16),
+            vreinterpretq_bf16_u16(b_.m128_private[i].neon_u16)
+          );
+      }
+    #elif ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
       uint32_t x1 SIMDE_VECTOR(64);
       uint32_t x2 SIMDE_VECTOR(64);
       simde__m256_private
@@ -198,7 +213,16 @@ simde_mm512_dpbf16_ps (simde__m512 src, simde__m512bh a, simde__m512bh b) {
       a_ = simde__m512bh_to_private(a),
       b_ = simde__m512bh_to_private(b);
 
-    #if ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC)
+      for (size_t i = 0 ; i < (sizeof(src_.m128_private) / sizeof(src_.m128_private[0])) ; i++) {
+        src_.m128_private[i].neon_f32 =
+          vbfdotq_f32(
+            src_.m128_private[i].neon_f32,
+            vreinterpretq_bf16_u16(a_.m128_private[i].neon_u16),
+            vreinterpretq_bf16_u16(b_.m128_private[i].neon_u16)
+          );
+      }
+    #elif ! ( defined(SIMDE_ARCH_X86) && defined(HEDLEY_GCC_VERSION) ) && defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR) && defined(SIMDE_CONVERT_VECTOR_) && defined(SIMDE_SHUFFLE_VECTOR_)
       uint32_t x1 SIMDE_VECTOR(128);
       uint32_t x2 SIMDE_VECTOR(128);
       simde__m512_private
@@ -31,6 +31,7 @@
 #include "types.h"
 #include "mov.h"
 #include "../fma.h"
+#include "../f16c.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -130,6 +131,44 @@ simde_mm512_fmadd_pd (simde__m512d a, simde__m512d b, simde__m512d c) {
   #define _mm512_fmadd_pd(a, b, c) simde_mm512_fmadd_pd(a, b, c)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_fmadd_ph (simde__m512h a, simde__m512h b, simde__m512h c) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_fmadd_ph(a, b, c);
+  #else
+    simde__m512h_private
+      r_,
+      a_ = simde__m512h_to_private(a),
+      b_ = simde__m512h_to_private(b),
+      c_ = simde__m512h_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_f16 = vfmaq_f16(c_.m128i_private[i].neon_f16, a_.m128i_private[i].neon_f16, b_.m128i_private[i].neon_f16);
+      }
+    #else
+      /* The product of two halves is exact in single precision, but the
+       * sum is rounded once to binary32 and again to binary16, so in rare
+       * cases the result can differ from a fused operation in the last
+       * place. */
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] =
+          simde_mm256_cvtps_ph(
+            simde_mm256_fmadd_ps(simde_mm256_cvtph_ps(a_.m128i[i]), simde_mm256_cvtph_ps(b_.m128i[i]), simde_mm256_cvtph_ps(c_.m128i[i])),
+            SIMDE_MM_FROUND_TO_NEAREST_INT
+          );
+      }
+    #endif
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_fmadd_ph
+  #define _mm512_fmadd_ph(a, b, c) simde_mm512_fmadd_ph(a, b, c)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
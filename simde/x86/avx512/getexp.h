@@ -0,0 +1,414 @@
+#if !defined(SIMDE_X86_AVX512_GETEXP_H)
+#define SIMDE_X86_AVX512_GETEXP_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* getexp is floor(log2(|a|)), which is just the unbiased exponent
+ * field.  Subnormals are scaled into the normal range first (by 2^24
+ * or 2^54, which is exact) and the scale is folded into the bias.
+ * Zero maps to -inf, and inf/NaN pass through as |a|. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_getexp_f32 (simde_float32 a) {
+  a = simde_math_fabsf(a);
+  if (a == SIMDE_FLOAT32_C(0.0))
+    return -SIMDE_MATH_INFINITYF;
+  if (!(a <= SIMDE_MATH_FLT_MAX))
+    return a;
+
+  int32_t bias = 127;
+  if (a < SIMDE_MATH_FLT_MIN) {
+    a *= SIMDE_FLOAT32_C(16777216.0);
+    bias += 24;
+  }
+
+  uint32_t bits;
+  simde_memcpy(&bits, &a, sizeof(bits));
+  return HEDLEY_STATIC_CAST(simde_float32, HEDLEY_STATIC_CAST(int32_t, bits >> 23) - bias);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_x_getexp_f64 (simde_float64 a) {
+  a = simde_math_fabs(a);
+  if (a == SIMDE_FLOAT64_C(0.0))
+    return -SIMDE_MATH_INFINITY;
+  if (!(a <= SIMDE_MATH_DBL_MAX))
+    return a;
+
+  int32_t bias = 1023;
+  if (a < SIMDE_MATH_DBL_MIN) {
+    a *= SIMDE_FLOAT64_C(18014398509481984.0);
+    bias += 54;
+  }
+
+  uint64_t bits;
+  simde_memcpy(&bits, &a, sizeof(bits));
+  return HEDLEY_STATIC_CAST(simde_float64, HEDLEY_STATIC_CAST(int32_t, bits >> 52) - bias);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_getexp_ps (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_getexp_ps(a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE > 0
+    const simde__m128 aa = simde_mm_andnot_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0)), a);
+    const simde__m128 subnormal = simde_mm_cmplt_ps(aa, simde_mm_set1_ps(SIMDE_MATH_FLT_MIN));
+    const simde__m128 n = simde_x_mm_select_ps(aa, simde_mm_mul_ps(aa, simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0))), subnormal);
+    simde__m128 r = simde_mm_cvtepi32_ps(simde_mm_srli_epi32(simde_mm_castps_si128(n), 23));
+    r = simde_mm_sub_ps(r, simde_x_mm_select_ps(simde_mm_set1_ps(SIMDE_FLOAT32_C(127.0)), simde_mm_set1_ps(SIMDE_FLOAT32_C(151.0)), subnormal));
+    r = simde_x_mm_select_ps(r, simde_mm_set1_ps(-SIMDE_MATH_INFINITYF), simde_mm_cmpeq_ps(aa, simde_mm_setzero_ps()));
+    return simde_x_mm_select_ps(aa, r, simde_mm_cmple_ps(aa, simde_mm_set1_ps(SIMDE_MATH_FLT_MAX)));
+  #else
+    simde__m128_private
+      r_,
+      a_ = simde__m128_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = simde_x_getexp_f32(a_.f32[i]);
+    }
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getexp_ps
+  #define _mm_getexp_ps(a) simde_mm_getexp_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_getexp_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getexp_ps
+  #define _mm_mask_getexp_ps(src, k, a) simde_mm_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_getexp_ps (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getexp_ps
+  #define _mm_maskz_getexp_ps(k, a) simde_mm_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_getexp_pd (simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_getexp_pd(a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE > 0
+    const simde__m128d aa = simde_mm_andnot_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0)), a);
+    const simde__m128d subnormal = simde_mm_cmplt_pd(aa, simde_mm_set1_pd(SIMDE_MATH_DBL_MIN));
+    const simde__m128d n = simde_x_mm_select_pd(aa, simde_mm_mul_pd(aa, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), subnormal);
+    /* The biased exponent fits in the mantissa of 2^52, which avoids
+     * needing a 64-bit integer to double conversion. */
+    simde__m128d r = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(simde_mm_castpd_si128(n), 52), simde_mm_set1_epi64x(INT64_C(0x4330000000000000))));
+    r = simde_mm_sub_pd(r, simde_x_mm_select_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)), simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627371573.0)), subnormal));
+    r = simde_x_mm_select_pd(r, simde_mm_set1_pd(-SIMDE_MATH_INFINITY), simde_mm_cmpeq_pd(aa, simde_mm_setzero_pd()));
+    return simde_x_mm_select_pd(aa, r, simde_mm_cmple_pd(aa, simde_mm_set1_pd(SIMDE_MATH_DBL_MAX)));
+  #else
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_x_getexp_f64(a_.f64[i]);
+    }
+
+    return simde__m128d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getexp_pd
+  #define _mm_getexp_pd(a) simde_mm_getexp_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_getexp_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getexp_pd
+  #define _mm_mask_getexp_pd(src, k, a) simde_mm_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_getexp_pd (simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getexp_pd
+  #define _mm_maskz_getexp_pd(k, a) simde_mm_maskz_getexp_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_getexp_ps (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_getexp_ps(a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE > 0
+    const simde__m256 aa = simde_mm256_andnot_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0)), a);
+    const simde__m256 subnormal = simde_mm256_cmp_ps(aa, simde_mm256_set1_ps(SIMDE_MATH_FLT_MIN), SIMDE_CMP_LT_OQ);
+    const simde__m256 n = simde_x_mm256_select_ps(aa, simde_mm256_mul_ps(aa, simde_mm256_set1_ps(SIMDE_FLOAT32_C(16777216.0))), subnormal);
+    simde__m256 r = simde_mm256_cvtepi32_ps(simde_mm256_srli_epi32(simde_mm256_castps_si256(n), 23));
+    r = simde_mm256_sub_ps(r, simde_x_mm256_select_ps(simde_mm256_set1_ps(SIMDE_FLOAT32_C(127.0)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(151.0)), subnormal));
+    r = simde_x_mm256_select_ps(r, simde_mm256_set1_ps(-SIMDE_MATH_INFINITYF), simde_mm256_cmp_ps(aa, simde_mm256_setzero_ps(), SIMDE_CMP_EQ_OQ));
+    return simde_x_mm256_select_ps(aa, r, simde_mm256_cmp_ps(aa, simde_mm256_set1_ps(SIMDE_MATH_FLT_MAX), SIMDE_CMP_LE_OQ));
+  #else
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = simde_x_getexp_f32(a_.f32[i]);
+    }
+
+    return simde__m256_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getexp_ps
+  #define _mm256_getexp_ps(a) simde_mm256_getexp_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_getexp_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getexp_ps
+  #define _mm256_mask_getexp_ps(src, k, a) simde_mm256_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_getexp_ps (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getexp_ps
+  #define _mm256_maskz_getexp_ps(k, a) simde_mm256_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_getexp_pd (simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_getexp_pd(a);
+  #elif SIMDE_NATURAL_VECTOR_SIZE > 0
+    const simde__m256d aa = simde_mm256_andnot_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0)), a);
+    const simde__m256d subnormal = simde_mm256_cmp_pd(aa, simde_mm256_set1_pd(SIMDE_MATH_DBL_MIN), SIMDE_CMP_LT_OQ);
+    const simde__m256d n = simde_x_mm256_select_pd(aa, simde_mm256_mul_pd(aa, simde_mm256_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), subnormal);
+    /* The biased exponent fits in the mantissa of 2^52, which avoids
+     * needing a 64-bit integer to double conversion. */
+    simde__m256d r = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(simde_mm256_castpd_si256(n), 52), simde_mm256_set1_epi64x(INT64_C(0x4330000000000000))));
+    r = simde_mm256_sub_pd(r, simde_x_mm256_select_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627371519.0)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627371573.0)), subnormal));
+    r = simde_x_mm256_select_pd(r, simde_mm256_set1_pd(-SIMDE_MATH_INFINITY), simde_mm256_cmp_pd(aa, simde_mm256_setzero_pd(), SIMDE_CMP_EQ_OQ));
+    return simde_x_mm256_select_pd(aa, r, simde_mm256_cmp_pd(aa, simde_mm256_set1_pd(SIMDE_MATH_DBL_MAX), SIMDE_CMP_LE_OQ));
+  #else
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] = simde_x_getexp_f64(a_.f64[i]);
+    }
+
+    return simde__m256d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getexp_pd
+  #define _mm256_getexp_pd(a) simde_mm256_getexp_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_getexp_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getexp_pd
+  #define _mm256_mask_getexp_pd(src, k, a) simde_mm256_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_getexp_pd (simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getexp_pd
+  #define _mm256_maskz_getexp_pd(k, a) simde_mm256_maskz_getexp_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_getexp_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_getexp_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_getexp_ps(a_.m256[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_x_getexp_f32(a_.f32[i]);
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_ps
+  #define _mm512_getexp_ps(a) simde_mm512_getexp_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_getexp_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_ps
+  #define _mm512_mask_getexp_ps(src, k, a) simde_mm512_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_getexp_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_ps
+  #define _mm512_maskz_getexp_ps(k, a) simde_mm512_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_getexp_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_getexp_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_getexp_pd(a_.m256d[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_x_getexp_f64(a_.f64[i]);
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_pd
+  #define _mm512_getexp_pd(a) simde_mm512_getexp_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_getexp_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_pd
+  #define _mm512_mask_getexp_pd(src, k, a) simde_mm512_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_getexp_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_pd
+  #define _mm512_maskz_getexp_pd(k, a) simde_mm512_maskz_getexp_pd(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GETEXP_H) */
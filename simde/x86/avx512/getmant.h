@@ -0,0 +1,533 @@
+#if !defined(SIMDE_X86_AVX512_GETMANT_H)
+#define SIMDE_X86_AVX512_GETMANT_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* getmant keeps the mantissa bits and replaces the exponent so the
+ * result lands in the requested interval.  For [0.5, 2) the exponent
+ * parity picks between 2^-1 and 2^0, and for [0.75, 1.5) the top
+ * mantissa bit does.  Subnormals are normalized by an exact 2^24 (or
+ * 2^54) scale first; being even it doesn't change the parity.  Zero
+ * and infinity return 1.0. */
+
+#define SIMDE_MM_MANT_NORM_1_2     0
+#define SIMDE_MM_MANT_NORM_p5_2    1
+#define SIMDE_MM_MANT_NORM_p5_1    2
+#define SIMDE_MM_MANT_NORM_p75_1p5 3
+#define SIMDE_MM_MANT_SIGN_src     0
+#define SIMDE_MM_MANT_SIGN_zero    1
+#define SIMDE_MM_MANT_SIGN_nan     2
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && !defined(_MM_MANT_NORM_1_2)
+  #define _MM_MANT_NORM_1_2 SIMDE_MM_MANT_NORM_1_2
+  #define _MM_MANT_NORM_p5_2 SIMDE_MM_MANT_NORM_p5_2
+  #define _MM_MANT_NORM_p5_1 SIMDE_MM_MANT_NORM_p5_1
+  #define _MM_MANT_NORM_p75_1p5 SIMDE_MM_MANT_NORM_p75_1p5
+  #define _MM_MANT_SIGN_src SIMDE_MM_MANT_SIGN_src
+  #define _MM_MANT_SIGN_zero SIMDE_MM_MANT_SIGN_zero
+  #define _MM_MANT_SIGN_nan SIMDE_MM_MANT_SIGN_nan
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_getmant_f32 (simde_float32 a, int interv, int sc) {
+  if (simde_math_isnan(a))
+    return a;
+  if ((sc & SIMDE_MM_MANT_SIGN_nan) && (a < SIMDE_FLOAT32_C(0.0)))
+    return SIMDE_MATH_NANF;
+
+  uint32_t bits, sign;
+  simde_memcpy(&bits, &a, sizeof(bits));
+  sign = (sc & SIMDE_MM_MANT_SIGN_zero) ? 0 : (bits & UINT32_C(0x80000000));
+  bits &= UINT32_C(0x7fffffff);
+
+  if ((bits == 0) || (bits == UINT32_C(0x7f800000))) {
+    bits = UINT32_C(0x3f800000);
+  } else {
+    if (bits < UINT32_C(0x00800000)) {
+      simde_float32 n = simde_math_fabsf(a) * SIMDE_FLOAT32_C(16777216.0);
+      simde_memcpy(&bits, &n, sizeof(bits));
+    }
+
+    uint32_t e;
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_p5_2:
+        e = UINT32_C(0x3f000000) | (bits & UINT32_C(0x00800000));
+        break;
+      case SIMDE_MM_MANT_NORM_p5_1:
+        e = UINT32_C(0x3f000000);
+        break;
+      case SIMDE_MM_MANT_NORM_p75_1p5:
+        e = UINT32_C(0x3f800000) - ((bits & UINT32_C(0x00400000)) << 1);
+        break;
+      default:
+        e = UINT32_C(0x3f800000);
+        break;
+    }
+    bits = e | (bits & UINT32_C(0x007fffff));
+  }
+
+  bits |= sign;
+  simde_memcpy(&a, &bits, sizeof(a));
+  return a;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_x_getmant_f64 (simde_float64 a, int interv, int sc) {
+  if (simde_math_isnan(a))
+    return a;
+  if ((sc & SIMDE_MM_MANT_SIGN_nan) && (a < SIMDE_FLOAT64_C(0.0)))
+    return SIMDE_MATH_NAN;
+
+  uint64_t bits, sign;
+  simde_memcpy(&bits, &a, sizeof(bits));
+  sign = (sc & SIMDE_MM_MANT_SIGN_zero) ? 0 : (bits & UINT64_C(0x8000000000000000));
+  bits &= UINT64_C(0x7fffffffffffffff);
+
+  if ((bits == 0) || (bits == UINT64_C(0x7ff0000000000000))) {
+    bits = UINT64_C(0x3ff0000000000000);
+  } else {
+    if (bits < UINT64_C(0x0010000000000000)) {
+      simde_float64 n = simde_math_fabs(a) * SIMDE_FLOAT64_C(18014398509481984.0);
+      simde_memcpy(&bits, &n, sizeof(bits));
+    }
+
+    uint64_t e;
+    switch (interv) {
+      case SIMDE_MM_MANT_NORM_p5_2:
+        e = UINT64_C(0x3fe0000000000000) | (bits & UINT64_C(0x0010000000000000));
+        break;
+      case SIMDE_MM_MANT_NORM_p5_1:
+        e = UINT64_C(0x3fe0000000000000);
+        break;
+      case SIMDE_MM_MANT_NORM_p75_1p5:
+        e = UINT64_C(0x3ff0000000000000) - ((bits & UINT64_C(0x0008000000000000)) << 1);
+        break;
+      default:
+        e = UINT64_C(0x3ff0000000000000);
+        break;
+    }
+    bits = e | (bits & UINT64_C(0x000fffffffffffff));
+  }
+
+  bits |= sign;
+  simde_memcpy(&a, &bits, sizeof(a));
+  return a;
+}
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_getmant_ps(a, interv, sc) _mm_getmant_ps((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  SIMDE_FUNCTION_ATTRIBUTES
+  simde__m128
+  simde_mm_getmant_ps (simde__m128 a, int interv, int sc)
+      SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+      SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+    #if SIMDE_NATURAL_VECTOR_SIZE > 0
+      const simde__m128 sign_mask = simde_mm_set1_ps(SIMDE_FLOAT32_C(-0.0));
+      const simde__m128 aa = simde_mm_andnot_ps(sign_mask, a);
+      const simde__m128 subnormal = simde_mm_cmplt_ps(aa, simde_mm_set1_ps(SIMDE_MATH_FLT_MIN));
+      const simde__m128i n = simde_mm_castps_si128(simde_x_mm_select_ps(aa, simde_mm_mul_ps(aa, simde_mm_set1_ps(SIMDE_FLOAT32_C(16777216.0))), subnormal));
+      simde__m128i e;
+
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_p5_2:
+          e = simde_mm_or_si128(simde_mm_set1_epi32(INT32_C(0x3f000000)), simde_mm_and_si128(n, simde_mm_set1_epi32(INT32_C(0x00800000))));
+          break;
+        case SIMDE_MM_MANT_NORM_p5_1:
+          e = simde_mm_set1_epi32(INT32_C(0x3f000000));
+          break;
+        case SIMDE_MM_MANT_NORM_p75_1p5:
+          e = simde_mm_sub_epi32(simde_mm_set1_epi32(INT32_C(0x3f800000)), simde_mm_slli_epi32(simde_mm_and_si128(n, simde_mm_set1_epi32(INT32_C(0x00400000))), 1));
+          break;
+        default:
+          e = simde_mm_set1_epi32(INT32_C(0x3f800000));
+          break;
+      }
+
+      simde__m128 r = simde_mm_castsi128_ps(simde_mm_or_si128(e, simde_mm_and_si128(n, simde_mm_set1_epi32(INT32_C(0x007fffff)))));
+      r = simde_x_mm_select_ps(r, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), simde_mm_or_ps(simde_mm_cmpeq_ps(aa, simde_mm_setzero_ps()), simde_mm_cmpeq_ps(aa, simde_mm_set1_ps(SIMDE_MATH_INFINITYF))));
+      if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+        r = simde_mm_or_ps(r, simde_mm_and_ps(sign_mask, a));
+      if (sc & SIMDE_MM_MANT_SIGN_nan)
+        r = simde_x_mm_select_ps(r, simde_mm_set1_ps(SIMDE_MATH_NANF), simde_mm_cmplt_ps(a, simde_mm_setzero_ps()));
+      return simde_x_mm_select_ps(r, a, simde_mm_cmpunord_ps(a, a));
+    #else
+      simde__m128_private
+        r_,
+        a_ = simde__m128_to_private(a);
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_x_getmant_f32(a_.f32[i], interv, sc);
+      }
+
+      return simde__m128_from_private(r_);
+    #endif
+  }
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getmant_ps
+  #define _mm_getmant_ps(a, interv, sc) simde_mm_getmant_ps(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_getmant_ps(src, k, a, interv, sc) _mm_mask_getmant_ps((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_mask_getmant_ps(src, k, a, interv, sc) simde_mm_mask_mov_ps(src, k, simde_mm_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getmant_ps
+  #define _mm_mask_getmant_ps(src, k, a, interv, sc) simde_mm_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_getmant_ps(k, a, interv, sc) _mm_maskz_getmant_ps((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_maskz_getmant_ps(k, a, interv, sc) simde_mm_maskz_mov_ps(k, simde_mm_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getmant_ps
+  #define _mm_maskz_getmant_ps(k, a, interv, sc) simde_mm_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_getmant_pd(a, interv, sc) _mm_getmant_pd((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  SIMDE_FUNCTION_ATTRIBUTES
+  simde__m128d
+  simde_mm_getmant_pd (simde__m128d a, int interv, int sc)
+      SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+      SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+    #if SIMDE_NATURAL_VECTOR_SIZE > 0
+      const simde__m128d sign_mask = simde_mm_set1_pd(SIMDE_FLOAT64_C(-0.0));
+      const simde__m128d aa = simde_mm_andnot_pd(sign_mask, a);
+      const simde__m128d subnormal = simde_mm_cmplt_pd(aa, simde_mm_set1_pd(SIMDE_MATH_DBL_MIN));
+      const simde__m128i n = simde_mm_castpd_si128(simde_x_mm_select_pd(aa, simde_mm_mul_pd(aa, simde_mm_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), subnormal));
+      simde__m128i e;
+
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_p5_2:
+          e = simde_mm_or_si128(simde_mm_set1_epi64x(INT64_C(0x3fe0000000000000)), simde_mm_and_si128(n, simde_mm_set1_epi64x(INT64_C(0x0010000000000000))));
+          break;
+        case SIMDE_MM_MANT_NORM_p5_1:
+          e = simde_mm_set1_epi64x(INT64_C(0x3fe0000000000000));
+          break;
+        case SIMDE_MM_MANT_NORM_p75_1p5:
+          e = simde_mm_sub_epi64(simde_mm_set1_epi64x(INT64_C(0x3ff0000000000000)), simde_mm_slli_epi64(simde_mm_and_si128(n, simde_mm_set1_epi64x(INT64_C(0x0008000000000000))), 1));
+          break;
+        default:
+          e = simde_mm_set1_epi64x(INT64_C(0x3ff0000000000000));
+          break;
+      }
+
+      simde__m128d r = simde_mm_castsi128_pd(simde_mm_or_si128(e, simde_mm_and_si128(n, simde_mm_set1_epi64x(INT64_C(0x000fffffffffffff)))));
+      r = simde_x_mm_select_pd(r, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), simde_mm_or_pd(simde_mm_cmpeq_pd(aa, simde_mm_setzero_pd()), simde_mm_cmpeq_pd(aa, simde_mm_set1_pd(SIMDE_MATH_INFINITY))));
+      if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+        r = simde_mm_or_pd(r, simde_mm_and_pd(sign_mask, a));
+      if (sc & SIMDE_MM_MANT_SIGN_nan)
+        r = simde_x_mm_select_pd(r, simde_mm_set1_pd(SIMDE_MATH_NAN), simde_mm_cmplt_pd(a, simde_mm_setzero_pd()));
+      return simde_x_mm_select_pd(r, a, simde_mm_cmpunord_pd(a, a));
+    #else
+      simde__m128d_private
+        r_,
+        a_ = simde__m128d_to_private(a);
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_x_getmant_f64(a_.f64[i], interv, sc);
+      }
+
+      return simde__m128d_from_private(r_);
+    #endif
+  }
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_getmant_pd
+  #define _mm_getmant_pd(a, interv, sc) simde_mm_getmant_pd(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_getmant_pd(src, k, a, interv, sc) _mm_mask_getmant_pd((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_mask_getmant_pd(src, k, a, interv, sc) simde_mm_mask_mov_pd(src, k, simde_mm_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_getmant_pd
+  #define _mm_mask_getmant_pd(src, k, a, interv, sc) simde_mm_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_getmant_pd(k, a, interv, sc) _mm_maskz_getmant_pd((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm_maskz_getmant_pd(k, a, interv, sc) simde_mm_maskz_mov_pd(k, simde_mm_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_getmant_pd
+  #define _mm_maskz_getmant_pd(k, a, interv, sc) simde_mm_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_getmant_ps(a, interv, sc) _mm256_getmant_ps((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  SIMDE_FUNCTION_ATTRIBUTES
+  simde__m256
+  simde_mm256_getmant_ps (simde__m256 a, int interv, int sc)
+      SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+      SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+    #if SIMDE_NATURAL_VECTOR_SIZE > 0
+      const simde__m256 sign_mask = simde_mm256_set1_ps(SIMDE_FLOAT32_C(-0.0));
+      const simde__m256 aa = simde_mm256_andnot_ps(sign_mask, a);
+      const simde__m256 subnormal = simde_mm256_cmp_ps(aa, simde_mm256_set1_ps(SIMDE_MATH_FLT_MIN), SIMDE_CMP_LT_OQ);
+      const simde__m256i n = simde_mm256_castps_si256(simde_x_mm256_select_ps(aa, simde_mm256_mul_ps(aa, simde_mm256_set1_ps(SIMDE_FLOAT32_C(16777216.0))), subnormal));
+      simde__m256i e;
+
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_p5_2:
+          e = simde_mm256_or_si256(simde_mm256_set1_epi32(INT32_C(0x3f000000)), simde_mm256_and_si256(n, simde_mm256_set1_epi32(INT32_C(0x00800000))));
+          break;
+        case SIMDE_MM_MANT_NORM_p5_1:
+          e = simde_mm256_set1_epi32(INT32_C(0x3f000000));
+          break;
+        case SIMDE_MM_MANT_NORM_p75_1p5:
+          e = simde_mm256_sub_epi32(simde_mm256_set1_epi32(INT32_C(0x3f800000)), simde_mm256_slli_epi32(simde_mm256_and_si256(n, simde_mm256_set1_epi32(INT32_C(0x00400000))), 1));
+          break;
+        default:
+          e = simde_mm256_set1_epi32(INT32_C(0x3f800000));
+          break;
+      }
+
+      simde__m256 r = simde_mm256_castsi256_ps(simde_mm256_or_si256(e, simde_mm256_and_si256(n, simde_mm256_set1_epi32(INT32_C(0x007fffff)))));
+      r = simde_x_mm256_select_ps(r, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), simde_mm256_or_ps(simde_mm256_cmp_ps(aa, simde_mm256_setzero_ps(), SIMDE_CMP_EQ_OQ), simde_mm256_cmp_ps(aa, simde_mm256_set1_ps(SIMDE_MATH_INFINITYF), SIMDE_CMP_EQ_OQ)));
+      if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+        r = simde_mm256_or_ps(r, simde_mm256_and_ps(sign_mask, a));
+      if (sc & SIMDE_MM_MANT_SIGN_nan)
+        r = simde_x_mm256_select_ps(r, simde_mm256_set1_ps(SIMDE_MATH_NANF), simde_mm256_cmp_ps(a, simde_mm256_setzero_ps(), SIMDE_CMP_LT_OQ));
+      return simde_x_mm256_select_ps(r, a, simde_mm256_cmp_ps(a, a, SIMDE_CMP_UNORD_Q));
+    #else
+      simde__m256_private
+        r_,
+        a_ = simde__m256_to_private(a);
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_x_getmant_f32(a_.f32[i], interv, sc);
+      }
+
+      return simde__m256_from_private(r_);
+    #endif
+  }
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getmant_ps
+  #define _mm256_getmant_ps(a, interv, sc) simde_mm256_getmant_ps(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_getmant_ps(src, k, a, interv, sc) _mm256_mask_getmant_ps((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_mask_getmant_ps(src, k, a, interv, sc) simde_mm256_mask_mov_ps(src, k, simde_mm256_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getmant_ps
+  #define _mm256_mask_getmant_ps(src, k, a, interv, sc) simde_mm256_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_getmant_ps(k, a, interv, sc) _mm256_maskz_getmant_ps((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_maskz_getmant_ps(k, a, interv, sc) simde_mm256_maskz_mov_ps(k, simde_mm256_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getmant_ps
+  #define _mm256_maskz_getmant_ps(k, a, interv, sc) simde_mm256_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_getmant_pd(a, interv, sc) _mm256_getmant_pd((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  SIMDE_FUNCTION_ATTRIBUTES
+  simde__m256d
+  simde_mm256_getmant_pd (simde__m256d a, int interv, int sc)
+      SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+      SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+    #if SIMDE_NATURAL_VECTOR_SIZE > 0
+      const simde__m256d sign_mask = simde_mm256_set1_pd(SIMDE_FLOAT64_C(-0.0));
+      const simde__m256d aa = simde_mm256_andnot_pd(sign_mask, a);
+      const simde__m256d subnormal = simde_mm256_cmp_pd(aa, simde_mm256_set1_pd(SIMDE_MATH_DBL_MIN), SIMDE_CMP_LT_OQ);
+      const simde__m256i n = simde_mm256_castpd_si256(simde_x_mm256_select_pd(aa, simde_mm256_mul_pd(aa, simde_mm256_set1_pd(SIMDE_FLOAT64_C(18014398509481984.0))), subnormal));
+      simde__m256i e;
+
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_p5_2:
+          e = simde_mm256_or_si256(simde_mm256_set1_epi64x(INT64_C(0x3fe0000000000000)), simde_mm256_and_si256(n, simde_mm256_set1_epi64x(INT64_C(0x0010000000000000))));
+          break;
+        case SIMDE_MM_MANT_NORM_p5_1:
+          e = simde_mm256_set1_epi64x(INT64_C(0x3fe0000000000000));
+          break;
+        case SIMDE_MM_MANT_NORM_p75_1p5:
+          e = simde_mm256_sub_epi64(simde_mm256_set1_epi64x(INT64_C(0x3ff0000000000000)), simde_mm256_slli_epi64(simde_mm256_and_si256(n, simde_mm256_set1_epi64x(INT64_C(0x0008000000000000))), 1));
+          break;
+        default:
+          e = simde_mm256_set1_epi64x(INT64_C(0x3ff0000000000000));
+          break;
+      }
+
+      simde__m256d r = simde_mm256_castsi256_pd(simde_mm256_or_si256(e, simde_mm256_and_si256(n, simde_mm256_set1_epi64x(INT64_C(0x000fffffffffffff)))));
+      r = simde_x_mm256_select_pd(r, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)), simde_mm256_or_pd(simde_mm256_cmp_pd(aa, simde_mm256_setzero_pd(), SIMDE_CMP_EQ_OQ), simde_mm256_cmp_pd(aa, simde_mm256_set1_pd(SIMDE_MATH_INFINITY), SIMDE_CMP_EQ_OQ)));
+      if (!(sc & SIMDE_MM_MANT_SIGN_zero))
+        r = simde_mm256_or_pd(r, simde_mm256_and_pd(sign_mask, a));
+      if (sc & SIMDE_MM_MANT_SIGN_nan)
+        r = simde_x_mm256_select_pd(r, simde_mm256_set1_pd(SIMDE_MATH_NAN), simde_mm256_cmp_pd(a, simde_mm256_setzero_pd(), SIMDE_CMP_LT_OQ));
+      return simde_x_mm256_select_pd(r, a, simde_mm256_cmp_pd(a, a, SIMDE_CMP_UNORD_Q));
+    #else
+      simde__m256d_private
+        r_,
+        a_ = simde__m256d_to_private(a);
+
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_x_getmant_f64(a_.f64[i], interv, sc);
+      }
+
+      return simde__m256d_from_private(r_);
+    #endif
+  }
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_getmant_pd
+  #define _mm256_getmant_pd(a, interv, sc) simde_mm256_getmant_pd(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_getmant_pd(src, k, a, interv, sc) _mm256_mask_getmant_pd((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_mask_getmant_pd(src, k, a, interv, sc) simde_mm256_mask_mov_pd(src, k, simde_mm256_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_getmant_pd
+  #define _mm256_mask_getmant_pd(src, k, a, interv, sc) simde_mm256_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_getmant_pd(k, a, interv, sc) _mm256_maskz_getmant_pd((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm256_maskz_getmant_pd(k, a, interv, sc) simde_mm256_maskz_mov_pd(k, simde_mm256_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_getmant_pd
+  #define _mm256_maskz_getmant_pd(k, a, interv, sc) simde_mm256_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_ps(a, interv, sc) _mm512_getmant_ps((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  SIMDE_FUNCTION_ATTRIBUTES
+  simde__m512
+  simde_mm512_getmant_ps (simde__m512 a, int interv, int sc)
+      SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+      SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_getmant_ps(a_.m256[i], interv, sc);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = simde_x_getmant_f32(a_.f32[i], interv, sc);
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  }
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_ps
+  #define _mm512_getmant_ps(a, interv, sc) simde_mm512_getmant_ps(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) _mm512_mask_getmant_ps((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_mov_ps(src, k, simde_mm512_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_ps
+  #define _mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_ps(k, a, interv, sc) _mm512_maskz_getmant_ps((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_mov_ps(k, simde_mm512_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_ps
+  #define _mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_pd(a, interv, sc) _mm512_getmant_pd((a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  SIMDE_FUNCTION_ATTRIBUTES
+  simde__m512d
+  simde_mm512_getmant_pd (simde__m512d a, int interv, int sc)
+      SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+      SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 2) {
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_getmant_pd(a_.m256d[i], interv, sc);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = simde_x_getmant_f64(a_.f64[i], interv, sc);
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  }
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_pd
+  #define _mm512_getmant_pd(a, interv, sc) simde_mm512_getmant_pd(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) _mm512_mask_getmant_pd((src), (k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_mov_pd(src, k, simde_mm512_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_pd
+  #define _mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_pd(k, a, interv, sc) _mm512_maskz_getmant_pd((k), (a), HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_mov_pd(k, simde_mm512_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_pd
+  #define _mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GETMANT_H) */
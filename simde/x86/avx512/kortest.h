@@ -0,0 +1,240 @@
+#if !defined(SIMDE_X86_AVX512_KORTEST_H)
+#define SIMDE_X86_AVX512_KORTEST_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* kortestz reports whether a | b is all zeros and kortestc whether it
+ * is all ones, i.e. the ZF and CF the instruction would set. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestz_mask8_u8(a, b);
+  #else
+    return ((a | b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask8_u8
+  #define _kortestz_mask8_u8(a, b) simde_kortestz_mask8_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestc_mask8_u8(a, b);
+  #else
+    return (HEDLEY_STATIC_CAST(simde__mmask8, a | b) == UINT8_MAX) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask8_u8
+  #define _kortestc_mask8_u8(a, b) simde_kortestc_mask8_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask8_u8 (simde__mmask8 a, simde__mmask8 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortest_mask8_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask8_u8(a, b);
+    return simde_kortestz_mask8_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask8_u8
+  #define _kortest_mask8_u8(a, b, all_ones) simde_kortest_mask8_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestz_mask16_u8(a, b);
+  #else
+    return ((a | b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask16_u8
+  #define _kortestz_mask16_u8(a, b) simde_kortestz_mask16_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestc_mask16_u8(a, b);
+  #else
+    return (HEDLEY_STATIC_CAST(simde__mmask16, a | b) == UINT16_MAX) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask16_u8
+  #define _kortestc_mask16_u8(a, b) simde_kortestc_mask16_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask16_u8 (simde__mmask16 a, simde__mmask16 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortest_mask16_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask16_u8(a, b);
+    return simde_kortestz_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask16_u8
+  #define _kortest_mask16_u8(a, b, all_ones) simde_kortest_mask16_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestz_mask32_u8(a, b);
+  #else
+    return ((a | b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask32_u8
+  #define _kortestz_mask32_u8(a, b) simde_kortestz_mask32_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestc_mask32_u8(a, b);
+  #else
+    return ((a | b) == UINT32_MAX) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask32_u8
+  #define _kortestc_mask32_u8(a, b) simde_kortestc_mask32_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask32_u8 (simde__mmask32 a, simde__mmask32 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortest_mask32_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask32_u8(a, b);
+    return simde_kortestz_mask32_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask32_u8
+  #define _kortest_mask32_u8(a, b, all_ones) simde_kortest_mask32_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestz_mask64_u8(a, b);
+  #else
+    return ((a | b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask64_u8
+  #define _kortestz_mask64_u8(a, b) simde_kortestz_mask64_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortestc_mask64_u8(a, b);
+  #else
+    return ((a | b) == UINT64_MAX) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask64_u8
+  #define _kortestc_mask64_u8(a, b) simde_kortestc_mask64_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask64_u8 (simde__mmask64 a, simde__mmask64 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _kortest_mask64_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask64_u8(a, b);
+    return simde_kortestz_mask64_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask64_u8
+  #define _kortest_mask64_u8(a, b, all_ones) simde_kortest_mask64_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm512_kortestz (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_kortestz(a, b);
+  #else
+    return simde_kortestz_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kortestz
+  #define _mm512_kortestz(a, b) simde_mm512_kortestz(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm512_kortestc (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_kortestc(a, b);
+  #else
+    return simde_kortestc_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kortestc
+  #define _mm512_kortestc(a, b) simde_mm512_kortestc(a, b)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_KORTEST_H) */
@@ -0,0 +1,212 @@
+#if !defined(SIMDE_X86_AVX512_KTEST_H)
+#define SIMDE_X86_AVX512_KTEST_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* ktestz reports whether a & b is all zeros and ktestc whether ~a & b
+ * is all zeros, i.e. the ZF and CF the instruction would set. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestz_mask8_u8(a, b);
+  #else
+    return (HEDLEY_STATIC_CAST(simde__mmask8, a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _ktestz_mask8_u8
+  #define _ktestz_mask8_u8(a, b) simde_ktestz_mask8_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestc_mask8_u8(a, b);
+  #else
+    return (HEDLEY_STATIC_CAST(simde__mmask8, ~a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _ktestc_mask8_u8
+  #define _ktestc_mask8_u8(a, b) simde_ktestc_mask8_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask8_u8 (simde__mmask8 a, simde__mmask8 b, unsigned char* and_not) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktest_mask8_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask8_u8(a, b);
+    return simde_ktestz_mask8_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _ktest_mask8_u8
+  #define _ktest_mask8_u8(a, b, and_not) simde_ktest_mask8_u8(a, b, and_not)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestz_mask16_u8(a, b);
+  #else
+    return (HEDLEY_STATIC_CAST(simde__mmask16, a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _ktestz_mask16_u8
+  #define _ktestz_mask16_u8(a, b) simde_ktestz_mask16_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestc_mask16_u8(a, b);
+  #else
+    return (HEDLEY_STATIC_CAST(simde__mmask16, ~a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _ktestc_mask16_u8
+  #define _ktestc_mask16_u8(a, b) simde_ktestc_mask16_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask16_u8 (simde__mmask16 a, simde__mmask16 b, unsigned char* and_not) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktest_mask16_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask16_u8(a, b);
+    return simde_ktestz_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _ktest_mask16_u8
+  #define _ktest_mask16_u8(a, b, and_not) simde_ktest_mask16_u8(a, b, and_not)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestz_mask32_u8(a, b);
+  #else
+    return ((a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _ktestz_mask32_u8
+  #define _ktestz_mask32_u8(a, b) simde_ktestz_mask32_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestc_mask32_u8(a, b);
+  #else
+    return ((~a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _ktestc_mask32_u8
+  #define _ktestc_mask32_u8(a, b) simde_ktestc_mask32_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask32_u8 (simde__mmask32 a, simde__mmask32 b, unsigned char* and_not) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktest_mask32_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask32_u8(a, b);
+    return simde_ktestz_mask32_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _ktest_mask32_u8
+  #define _ktest_mask32_u8(a, b, and_not) simde_ktest_mask32_u8(a, b, and_not)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestz_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestz_mask64_u8(a, b);
+  #else
+    return ((a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _ktestz_mask64_u8
+  #define _ktestz_mask64_u8(a, b) simde_ktestz_mask64_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktestc_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktestc_mask64_u8(a, b);
+  #else
+    return ((~a & b) == 0) ? 1 : 0;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _ktestc_mask64_u8
+  #define _ktestc_mask64_u8(a, b) simde_ktestc_mask64_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_ktest_mask64_u8 (simde__mmask64 a, simde__mmask64 b, unsigned char* and_not) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) \
+      && (!defined(__clang__) || SIMDE_DETECT_CLANG_VERSION_CHECK(8,0,0)) \
+      && (!defined(HEDLEY_MSVC_VERSION) || HEDLEY_MSVC_VERSION_CHECK(19,20,0))
+    return _ktest_mask64_u8(a, b, and_not);
+  #else
+    *and_not = simde_ktestc_mask64_u8(a, b);
+    return simde_ktestz_mask64_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _ktest_mask64_u8
+  #define _ktest_mask64_u8(a, b, and_not) simde_ktest_mask64_u8(a, b, and_not)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_KTEST_H) */
@@ -0,0 +1,55 @@
+#if !defined(SIMDE_X86_AVX512_KUNPACK_H)
+#define SIMDE_X86_AVX512_KUNPACK_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kunpackb (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_kunpackb(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, ((a & UINT16_C(0xff)) << 8) | (b & UINT16_C(0xff)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kunpackb
+  #define _mm512_kunpackb(a, b) simde_mm512_kunpackb(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_mm512_kunpackw (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE)
+    return _mm512_kunpackw(a, b);
+  #else
+    return ((a & UINT32_C(0xffff)) << 16) | (b & UINT32_C(0xffff));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kunpackw
+  #define _mm512_kunpackw(a, b) simde_mm512_kunpackw(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_mm512_kunpackd (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE)
+    return _mm512_kunpackd(a, b);
+  #else
+    return (a << 32) | (b & UINT64_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kunpackd
+  #define _mm512_kunpackd(a, b) simde_mm512_kunpackd(a, b)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_KUNPACK_H) */
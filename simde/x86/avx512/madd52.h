@@ -0,0 +1,453 @@
+#if !defined(SIMDE_X86_AVX512_MADD52_H)
+#define SIMDE_X86_AVX512_MADD52_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The 52-bit inputs are split into 26-bit halves so every partial
+ * product fits in a 32x32->64-bit multiply:
+ *
+ *   b * c = (b1 * c1) << 52 + (b1 * c0 + b0 * c1) << 26 + b0 * c0
+ *
+ * The middle sum is at most 53 bits wide, so nothing overflows. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_madd52lo_u64 (uint64_t a, uint64_t b, uint64_t c) {
+  const uint64_t mask52 = (UINT64_C(1) << 52) - 1;
+  return a + (((b & mask52) * (c & mask52)) & mask52);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_madd52hi_u64 (uint64_t a, uint64_t b, uint64_t c) {
+  const uint64_t mask52 = (UINT64_C(1) << 52) - 1;
+  #if defined(SIMDE_HAVE_INT128_)
+    return a + HEDLEY_STATIC_CAST(uint64_t, (HEDLEY_STATIC_CAST(simde_uint128, b & mask52) * (c & mask52)) >> 52);
+  #else
+    const uint64_t mask26 = (UINT64_C(1) << 26) - 1;
+    const uint64_t b0 = b & mask26, b1 = (b >> 26) & mask26;
+    const uint64_t c0 = c & mask26, c1 = (c >> 26) & mask26;
+    const uint64_t mid = (b1 * c0) + (b0 * c1);
+    const uint64_t lo = (b0 * c0) + ((mid & mask26) << 26);
+    return a + (b1 * c1) + (mid >> 26) + (lo >> 52);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_madd52lo_epu64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_madd52lo_epu64(a, b, c);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i ones = _mm_cmpeq_epi32(a_.n, a_.n);
+      const __m128i mask26 = _mm_srli_epi64(ones, 38);
+      const __m128i mask52 = _mm_srli_epi64(ones, 12);
+      const __m128i b0 = _mm_and_si128(b_.n, mask26), b1 = _mm_and_si128(_mm_srli_epi64(b_.n, 26), mask26);
+      const __m128i c0 = _mm_and_si128(c_.n, mask26), c1 = _mm_and_si128(_mm_srli_epi64(c_.n, 26), mask26);
+      const __m128i mid = _mm_add_epi64(_mm_mul_epu32(b1, c0), _mm_mul_epu32(b0, c1));
+      const __m128i lo = _mm_add_epi64(_mm_mul_epu32(b0, c0), _mm_slli_epi64(mid, 26));
+      r_.n = _mm_add_epi64(a_.n, _mm_and_si128(lo, mask52));
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const uint32x2_t mask26 = vdup_n_u32((UINT32_C(1) << 26) - 1);
+      const uint32x2_t b0 = vand_u32(vmovn_u64(b_.neon_u64), mask26), b1 = vand_u32(vshrn_n_u64(b_.neon_u64, 26), mask26);
+      const uint32x2_t c0 = vand_u32(vmovn_u64(c_.neon_u64), mask26), c1 = vand_u32(vshrn_n_u64(c_.neon_u64, 26), mask26);
+      const uint64x2_t mid = vmlal_u32(vmull_u32(b1, c0), b0, c1);
+      const uint64x2_t lo = vaddq_u64(vmull_u32(b0, c0), vshlq_n_u64(mid, 26));
+      r_.neon_u64 = vaddq_u64(a_.neon_u64, vandq_u64(lo, vdupq_n_u64((UINT64_C(1) << 52) - 1)));
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const uint64_t mask52 = (UINT64_C(1) << 52) - 1;
+      r_.u64 = a_.u64 + (((b_.u64 & mask52) * (c_.u64 & mask52)) & mask52);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = simde_x_madd52lo_u64(a_.u64[i], b_.u64[i], c_.u64[i]);
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_madd52lo_epu64
+  #define _mm_madd52lo_epu64(a, b, c) simde_mm_madd52lo_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd52lo_epu64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_madd52lo_epu64(a, b, c);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      r_.m128i[0] = simde_mm_madd52lo_epu64(a_.m128i[0], b_.m128i[0], c_.m128i[0]);
+      r_.m128i[1] = simde_mm_madd52lo_epu64(a_.m128i[1], b_.m128i[1], c_.m128i[1]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i ones = _mm256_cmpeq_epi32(a_.n, a_.n);
+      const __m256i mask26 = _mm256_srli_epi64(ones, 38);
+      const __m256i mask52 = _mm256_srli_epi64(ones, 12);
+      const __m256i b0 = _mm256_and_si256(b_.n, mask26), b1 = _mm256_and_si256(_mm256_srli_epi64(b_.n, 26), mask26);
+      const __m256i c0 = _mm256_and_si256(c_.n, mask26), c1 = _mm256_and_si256(_mm256_srli_epi64(c_.n, 26), mask26);
+      const __m256i mid = _mm256_add_epi64(_mm256_mul_epu32(b1, c0), _mm256_mul_epu32(b0, c1));
+      const __m256i lo = _mm256_add_epi64(_mm256_mul_epu32(b0, c0), _mm256_slli_epi64(mid, 26));
+      r_.n = _mm256_add_epi64(a_.n, _mm256_and_si256(lo, mask52));
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const uint64_t mask52 = (UINT64_C(1) << 52) - 1;
+      r_.u64 = a_.u64 + (((b_.u64 & mask52) * (c_.u64 & mask52)) & mask52);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = simde_x_madd52lo_u64(a_.u64[i], b_.u64[i], c_.u64[i]);
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_madd52lo_epu64
+  #define _mm256_madd52lo_epu64(a, b, c) simde_mm256_madd52lo_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_madd52lo_epu64 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_madd52lo_epu64(a, b, c);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_madd52lo_epu64(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      const uint64_t mask52 = (UINT64_C(1) << 52) - 1;
+      r_.u64 = a_.u64 + (((b_.u64 & mask52) * (c_.u64 & mask52)) & mask52);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = simde_x_madd52lo_u64(a_.u64[i], b_.u64[i], c_.u64[i]);
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_madd52lo_epu64
+  #define _mm512_madd52lo_epu64(a, b, c) simde_mm512_madd52lo_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_madd52lo_epu64 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_madd52lo_epu64(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi64(a, k, simde_mm_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_madd52lo_epu64
+  #define _mm_mask_madd52lo_epu64(a, k, b, c) simde_mm_mask_madd52lo_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_madd52lo_epu64 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_madd52lo_epu64(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_madd52lo_epu64
+  #define _mm_maskz_madd52lo_epu64(k, a, b, c) simde_mm_maskz_madd52lo_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_madd52lo_epu64 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_madd52lo_epu64(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi64(a, k, simde_mm256_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_madd52lo_epu64
+  #define _mm256_mask_madd52lo_epu64(a, k, b, c) simde_mm256_mask_madd52lo_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_madd52lo_epu64 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_madd52lo_epu64(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_madd52lo_epu64
+  #define _mm256_maskz_madd52lo_epu64(k, a, b, c) simde_mm256_maskz_madd52lo_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_madd52lo_epu64 (simde__m512i a, simde__mmask8 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_mask_madd52lo_epu64(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi64(a, k, simde_mm512_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_madd52lo_epu64
+  #define _mm512_mask_madd52lo_epu64(a, k, b, c) simde_mm512_mask_madd52lo_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_madd52lo_epu64 (simde__mmask8 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_maskz_madd52lo_epu64(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_madd52lo_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_madd52lo_epu64
+  #define _mm512_maskz_madd52lo_epu64(k, a, b, c) simde_mm512_maskz_madd52lo_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_madd52hi_epu64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_madd52hi_epu64(a, b, c);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i ones = _mm_cmpeq_epi32(a_.n, a_.n);
+      const __m128i mask26 = _mm_srli_epi64(ones, 38);
+      const __m128i b0 = _mm_and_si128(b_.n, mask26), b1 = _mm_and_si128(_mm_srli_epi64(b_.n, 26), mask26);
+      const __m128i c0 = _mm_and_si128(c_.n, mask26), c1 = _mm_and_si128(_mm_srli_epi64(c_.n, 26), mask26);
+      const __m128i mid = _mm_add_epi64(_mm_mul_epu32(b1, c0), _mm_mul_epu32(b0, c1));
+      const __m128i lo = _mm_add_epi64(_mm_mul_epu32(b0, c0), _mm_slli_epi64(_mm_and_si128(mid, mask26), 26));
+      r_.n =
+        _mm_add_epi64(
+          _mm_add_epi64(a_.n, _mm_mul_epu32(b1, c1)),
+          _mm_add_epi64(_mm_srli_epi64(mid, 26), _mm_srli_epi64(lo, 52))
+        );
+    #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      const uint32x2_t mask26 = vdup_n_u32((UINT32_C(1) << 26) - 1);
+      const uint32x2_t b0 = vand_u32(vmovn_u64(b_.neon_u64), mask26), b1 = vand_u32(vshrn_n_u64(b_.neon_u64, 26), mask26);
+      const uint32x2_t c0 = vand_u32(vmovn_u64(c_.neon_u64), mask26), c1 = vand_u32(vshrn_n_u64(c_.neon_u64, 26), mask26);
+      const uint64x2_t mid = vmlal_u32(vmull_u32(b1, c0), b0, c1);
+      const uint64x2_t lo = vaddq_u64(vmull_u32(b0, c0), vshlq_n_u64(vandq_u64(mid, vdupq_n_u64((UINT64_C(1) << 26) - 1)), 26));
+      r_.neon_u64 = vmlal_u32(vaddq_u64(a_.neon_u64, vaddq_u64(vshrq_n_u64(mid, 26), vshrq_n_u64(lo, 52))), b1, c1);
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = simde_x_madd52hi_u64(a_.u64[i], b_.u64[i], c_.u64[i]);
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_madd52hi_epu64
+  #define _mm_madd52hi_epu64(a, b, c) simde_mm_madd52hi_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_madd52hi_epu64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_madd52hi_epu64(a, b, c);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      r_.m128i[0] = simde_mm_madd52hi_epu64(a_.m128i[0], b_.m128i[0], c_.m128i[0]);
+      r_.m128i[1] = simde_mm_madd52hi_epu64(a_.m128i[1], b_.m128i[1], c_.m128i[1]);
+    #elif defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i ones = _mm256_cmpeq_epi32(a_.n, a_.n);
+      const __m256i mask26 = _mm256_srli_epi64(ones, 38);
+      const __m256i b0 = _mm256_and_si256(b_.n, mask26), b1 = _mm256_and_si256(_mm256_srli_epi64(b_.n, 26), mask26);
+      const __m256i c0 = _mm256_and_si256(c_.n, mask26), c1 = _mm256_and_si256(_mm256_srli_epi64(c_.n, 26), mask26);
+      const __m256i mid = _mm256_add_epi64(_mm256_mul_epu32(b1, c0), _mm256_mul_epu32(b0, c1));
+      const __m256i lo = _mm256_add_epi64(_mm256_mul_epu32(b0, c0), _mm256_slli_epi64(_mm256_and_si256(mid, mask26), 26));
+      r_.n =
+        _mm256_add_epi64(
+          _mm256_add_epi64(a_.n, _mm256_mul_epu32(b1, c1)),
+          _mm256_add_epi64(_mm256_srli_epi64(mid, 26), _mm256_srli_epi64(lo, 52))
+        );
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = simde_x_madd52hi_u64(a_.u64[i], b_.u64[i], c_.u64[i]);
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_madd52hi_epu64
+  #define _mm256_madd52hi_epu64(a, b, c) simde_mm256_madd52hi_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_madd52hi_epu64 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_madd52hi_epu64(a, b, c);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_madd52hi_epu64(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        r_.u64[i] = simde_x_madd52hi_u64(a_.u64[i], b_.u64[i], c_.u64[i]);
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_madd52hi_epu64
+  #define _mm512_madd52hi_epu64(a, b, c) simde_mm512_madd52hi_epu64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_madd52hi_epu64 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_madd52hi_epu64(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi64(a, k, simde_mm_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_madd52hi_epu64
+  #define _mm_mask_madd52hi_epu64(a, k, b, c) simde_mm_mask_madd52hi_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_madd52hi_epu64 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_madd52hi_epu64(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_madd52hi_epu64
+  #define _mm_maskz_madd52hi_epu64(k, a, b, c) simde_mm_maskz_madd52hi_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_madd52hi_epu64 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_madd52hi_epu64(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi64(a, k, simde_mm256_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_madd52hi_epu64
+  #define _mm256_mask_madd52hi_epu64(a, k, b, c) simde_mm256_mask_madd52hi_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_madd52hi_epu64 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_madd52hi_epu64(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_madd52hi_epu64
+  #define _mm256_maskz_madd52hi_epu64(k, a, b, c) simde_mm256_maskz_madd52hi_epu64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_madd52hi_epu64 (simde__m512i a, simde__mmask8 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_mask_madd52hi_epu64(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi64(a, k, simde_mm512_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_madd52hi_epu64
+  #define _mm512_mask_madd52hi_epu64(a, k, b, c) simde_mm512_mask_madd52hi_epu64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_madd52hi_epu64 (simde__mmask8 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512IFMA_NATIVE)
+    return _mm512_maskz_madd52hi_epu64(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_madd52hi_epu64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512IFMA_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_madd52hi_epu64
+  #define _mm512_maskz_madd52hi_epu64(k, a, b, c) simde_mm512_maskz_madd52hi_epu64(k, a, b, c)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_MADD52_H) */
@@ -31,6 +31,7 @@
 #include "types.h"
 #include "../avx2.h"
 #include "mov.h"
+#include "../f16c.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -581,6 +582,40 @@ simde_mm512_maskz_max_pd(simde__mmask8 k, simde__m512d a, simde__m512d b) {
   #define _mm512_maskz_max_pd(k, a, b) simde_mm512_maskz_max_pd(k, a, b)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512h
+simde_mm512_max_ph (simde__m512h a, simde__m512h b) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    return _mm512_max_ph(a, b);
+  #else
+    simde__m512h_private
+      r_,
+      a_ = simde__m512h_to_private(a),
+      b_ = simde__m512h_to_private(b);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+      /* vmaxq_f16 propagates NaNs; x86 returns b unless a is strictly larger. */
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        r_.m128i_private[i].neon_f16 = vbslq_f16(vcgtq_f16(a_.m128i_private[i].neon_f16, b_.m128i_private[i].neon_f16), a_.m128i_private[i].neon_f16, b_.m128i_private[i].neon_f16);
+      }
+    #else
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] =
+          simde_mm256_cvtps_ph(
+            simde_mm256_max_ps(simde_mm256_cvtph_ps(a_.m128i[i]), simde_mm256_cvtph_ps(b_.m128i[i])),
+            SIMDE_MM_FROUND_TO_NEAREST_INT
+          );
+      }
+    #endif
+
+    return simde__m512h_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_max_ph
+  #define _mm512_max_ph(a, b) simde_mm512_max_ph(a, b)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
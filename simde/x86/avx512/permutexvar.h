@@ -389,12 +389,27 @@ simde_mm256_permutexvar_epi64 (simde__m256i idx, simde__m256i a) {
       a_ = simde__m256i_to_private(a),
       r_;
 
-    #if !defined(__INTEL_COMPILER)
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      uint8x16x2_t table = { { a_.m128i_private[0].neon_u8,
+                               a_.m128i_private[1].neon_u8 } };
+      uint64x2_t mask64 = vdupq_n_u64(3);
+      uint64x2_t byte_index64 = vdupq_n_u64(UINT64_C(0x0706050403020100));
+
       SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        uint32x4_t index32 = vreinterpretq_u32_u64(vandq_u64(idx_.m128i_private[i].neon_u64, mask64));
+        index32 = vmulq_n_u32(index32, 0x08080808);
+        index32 = vtrn1q_u32(index32, index32);
+        r_.m128i_private[i].neon_u8 = vqtbl2q_u8(table, vreinterpretq_u8_u64(vaddq_u64(vreinterpretq_u64_u32(index32), byte_index64)));
+      }
+    #else
+      #if !defined(__INTEL_COMPILER)
+        SIMDE_VECTORIZE
+      #endif
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = a_.i64[idx_.i64[i] & 3];
+      }
     #endif
-    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-      r_.i64[i] = a_.i64[idx_.i64[i] & 3];
-    }
 
     return simde__m256i_from_private(r_);
   #endif
@@ -905,12 +920,29 @@ simde_mm512_permutexvar_epi64 (simde__m512i idx, simde__m512i a) {
       a_ = simde__m512i_to_private(a),
       r_;
 
-    #if !defined(__INTEL_COMPILER)
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      uint8x16x4_t table = { { a_.m128i_private[0].neon_u8,
+                               a_.m128i_private[1].neon_u8,
+                               a_.m128i_private[2].neon_u8,
+                               a_.m128i_private[3].neon_u8 } };
+      uint64x2_t mask64 = vdupq_n_u64(7);
+      uint64x2_t byte_index64 = vdupq_n_u64(UINT64_C(0x0706050403020100));
+
       SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.m128i_private) / sizeof(r_.m128i_private[0])) ; i++) {
+        uint32x4_t index32 = vreinterpretq_u32_u64(vandq_u64(idx_.m128i_private[i].neon_u64, mask64));
+        index32 = vmulq_n_u32(index32, 0x08080808);
+        index32 = vtrn1q_u32(index32, index32);
+        r_.m128i_private[i].neon_u8 = vqtbl4q_u8(table, vreinterpretq_u8_u64(vaddq_u64(vreinterpretq_u64_u32(index32), byte_index64)));
+      }
+    #else
+      #if !defined(__INTEL_COMPILER)
+        SIMDE_VECTORIZE
+      #endif
+      for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+        r_.i64[i] = a_.i64[idx_.i64[i] & 7];
+      }
     #endif
-    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
-      r_.i64[i] = a_.i64[idx_.i64[i] & 7];
-    }
 
     return simde__m512i_from_private(r_);
   #endif
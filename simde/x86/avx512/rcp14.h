@@ -0,0 +1,421 @@
+#if !defined(SIMDE_X86_AVX512_RCP14_H)
+#define SIMDE_X86_AVX512_RCP14_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* rcp14 and rsqrt14 only promise a relative error below 2^-14, so
+ * there is no need to pay for a full division or square root.  The
+ * hardware estimates (vrecpe/vrsqrte on NEON, rcpps/rsqrtps on x86)
+ * are good to 8 and 12 bits respectively, and a single Newton-Raphson
+ * step brings either of them past 14 bits.
+ *
+ * On NEON the vrecps/vrsqrts step instructions return 2.0/1.5 for
+ * 0 * inf.  The estimate is only ever multiplied by the input inside
+ * them (rsqrt14 squares the estimate first), so zero and infinite
+ * inputs come out as the exact infinity or zero.  Subnormal inputs
+ * overflow the estimate or its square, so on AArch64 those lanes take
+ * an exact 1 / a or 1 / sqrt(a).  AArch32 NEON has no division and
+ * always flushes subnormals to zero, so there subnormal inputs give
+ * infinity, and rsqrt14 of inputs above 2^126, whose squared estimate
+ * underflows, comes out up to 1.5 times too large.
+ *
+ * The x86 step turns zero and infinite inputs into NaN, and
+ * rcpps/rsqrtps flush subnormal inputs and results, so the SSE paths
+ * take an exact 1 / a or 1 / sqrt(a) for every lane outside the range
+ * where the estimate is usable. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_rcp14_ps (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rcp14_ps(a);
+  #else
+    simde__m128_private
+      r_,
+      a_ = simde__m128_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      float32x4_t recip = vrecpeq_f32(a_.neon_f32);
+      r_.neon_f32 = vmulq_f32(recip, vrecpsq_f32(recip, a_.neon_f32));
+      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+        /* vrecpe returns infinity for subnormal inputs below 2^-128,
+         * which the step then turns into an infinity of the wrong
+         * sign, so subnormal lanes take an exact division. */
+        uint32x4_t tiny = vcaltq_f32(a_.neon_f32, vdupq_n_f32(SIMDE_MATH_FLT_MIN));
+        if (HEDLEY_UNLIKELY(vmaxvq_u32(tiny) != 0)) {
+          r_.neon_f32 = vbslq_f32(tiny, vdivq_f32(vdupq_n_f32(SIMDE_FLOAT32_C(1.0)), a_.neon_f32), r_.neon_f32);
+        }
+      #endif
+    #elif defined(SIMDE_X86_SSE_NATIVE)
+      /* rcpps flushes subnormal inputs and results to zero, while
+       * vrcp14ps does not, so lanes outside [FLT_MIN, 2^125) (and NaN)
+       * take an exact division instead of the Newton-Raphson step. */
+      __m128 recip = _mm_rcp_ps(a_.n);
+      __m128 abs_a = _mm_andnot_ps(_mm_set1_ps(-SIMDE_FLOAT32_C(0.0)), a_.n);
+      __m128 in_range = _mm_and_ps(_mm_cmpge_ps(abs_a, _mm_set1_ps(SIMDE_MATH_FLT_MIN)), _mm_cmplt_ps(abs_a, _mm_set1_ps(SIMDE_FLOAT32_C(4.2535295865117308e37))));
+      r_.n = _mm_mul_ps(recip, _mm_sub_ps(_mm_set1_ps(SIMDE_FLOAT32_C(2.0)), _mm_mul_ps(a_.n, recip)));
+      if (HEDLEY_UNLIKELY(_mm_movemask_ps(in_range) != 0xf)) {
+        __m128 exact = _mm_div_ps(_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), a_.n);
+        r_.n = _mm_or_ps(_mm_and_ps(in_range, r_.n), _mm_andnot_ps(in_range, exact));
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.f32 = SIMDE_FLOAT32_C(1.0) / a_.f32;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / a_.f32[i];
+      }
+    #endif
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rcp14_ps
+  #define _mm_rcp14_ps(a) simde_mm_rcp14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_rcp14_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_rcp14_ps(src, k, a);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rcp14_ps
+  #define _mm_mask_rcp14_ps(src, k, a) simde_mm_mask_rcp14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_rcp14_ps (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_rcp14_ps(k, a);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rcp14_ps
+  #define _mm_maskz_rcp14_ps(k, a) simde_mm_maskz_rcp14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_rcp14_pd (simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rcp14_pd(a);
+  #else
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      float64x2_t recip = vrecpeq_f64(a_.neon_f64);
+      r_.neon_f64 = vmulq_f64(recip, vrecpsq_f64(recip, a_.neon_f64));
+      uint64x2_t tiny = vcaltq_f64(a_.neon_f64, vdupq_n_f64(SIMDE_MATH_DBL_MIN));
+      if (HEDLEY_UNLIKELY(vmaxvq_u32(vreinterpretq_u32_u64(tiny)) != 0)) {
+        r_.neon_f64 = vbslq_f64(tiny, vdivq_f64(vdupq_n_f64(SIMDE_FLOAT64_C(1.0)), a_.neon_f64), r_.neon_f64);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.f64 = SIMDE_FLOAT64_C(1.0) / a_.f64;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / a_.f64[i];
+      }
+    #endif
+
+    return simde__m128d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rcp14_pd
+  #define _mm_rcp14_pd(a) simde_mm_rcp14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_rcp14_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_rcp14_pd(src, k, a);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rcp14_pd
+  #define _mm_mask_rcp14_pd(src, k, a) simde_mm_mask_rcp14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_rcp14_pd (simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_rcp14_pd(k, a);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rcp14_pd
+  #define _mm_maskz_rcp14_pd(k, a) simde_mm_maskz_rcp14_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_rcp14_ps (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_rcp14_ps(a);
+  #else
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    #if defined(SIMDE_X86_AVX_NATIVE)
+      __m256 recip = _mm256_rcp_ps(a_.n);
+      __m256 abs_a = _mm256_andnot_ps(_mm256_set1_ps(-SIMDE_FLOAT32_C(0.0)), a_.n);
+      __m256 in_range = _mm256_and_ps(_mm256_cmp_ps(abs_a, _mm256_set1_ps(SIMDE_MATH_FLT_MIN), _CMP_GE_OQ), _mm256_cmp_ps(abs_a, _mm256_set1_ps(SIMDE_FLOAT32_C(4.2535295865117308e37)), _CMP_LT_OQ));
+      r_.n = _mm256_mul_ps(recip, _mm256_sub_ps(_mm256_set1_ps(SIMDE_FLOAT32_C(2.0)), _mm256_mul_ps(a_.n, recip)));
+      if (HEDLEY_UNLIKELY(_mm256_movemask_ps(in_range) != 0xff)) {
+        r_.n = _mm256_blendv_ps(_mm256_div_ps(_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), a_.n), r_.n, in_range);
+      }
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+        r_.m128[i] = simde_mm_rcp14_ps(a_.m128[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.f32 = SIMDE_FLOAT32_C(1.0) / a_.f32;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / a_.f32[i];
+      }
+    #endif
+
+    return simde__m256_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_rcp14_ps
+  #define _mm256_rcp14_ps(a) simde_mm256_rcp14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_rcp14_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_rcp14_ps(src, k, a);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_rcp14_ps
+  #define _mm256_mask_rcp14_ps(src, k, a) simde_mm256_mask_rcp14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_rcp14_ps (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_rcp14_ps(k, a);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_rcp14_ps
+  #define _mm256_maskz_rcp14_ps(k, a) simde_mm256_maskz_rcp14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_rcp14_pd (simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_rcp14_pd(a);
+  #else
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+        r_.m128d[i] = simde_mm_rcp14_pd(a_.m128d[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.f64 = SIMDE_FLOAT64_C(1.0) / a_.f64;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / a_.f64[i];
+      }
+    #endif
+
+    return simde__m256d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_rcp14_pd
+  #define _mm256_rcp14_pd(a) simde_mm256_rcp14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_rcp14_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_rcp14_pd(src, k, a);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_rcp14_pd
+  #define _mm256_mask_rcp14_pd(src, k, a) simde_mm256_mask_rcp14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_rcp14_pd (simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_rcp14_pd(k, a);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_rcp14_pd
+  #define _mm256_maskz_rcp14_pd(k, a) simde_mm256_maskz_rcp14_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_rcp14_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_rcp14_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_rcp14_ps(a_.m256[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.f32 = SIMDE_FLOAT32_C(1.0) / a_.f32;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / a_.f32[i];
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rcp14_ps
+  #define _mm512_rcp14_ps(a) simde_mm512_rcp14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_rcp14_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_rcp14_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rcp14_ps
+  #define _mm512_mask_rcp14_ps(src, k, a) simde_mm512_mask_rcp14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_rcp14_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_rcp14_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_rcp14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rcp14_ps
+  #define _mm512_maskz_rcp14_ps(k, a) simde_mm512_maskz_rcp14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_rcp14_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_rcp14_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_rcp14_pd(a_.m256d[i]);
+      }
+    #elif defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+      r_.f64 = SIMDE_FLOAT64_C(1.0) / a_.f64;
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / a_.f64[i];
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rcp14_pd
+  #define _mm512_rcp14_pd(a) simde_mm512_rcp14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_rcp14_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_rcp14_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rcp14_pd
+  #define _mm512_mask_rcp14_pd(src, k, a) simde_mm512_mask_rcp14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_rcp14_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_rcp14_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_rcp14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rcp14_pd
+  #define _mm512_maskz_rcp14_pd(k, a) simde_mm512_maskz_rcp14_pd(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_RCP14_H) */
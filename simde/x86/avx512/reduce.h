@@ -0,0 +1,1104 @@
+#if !defined(SIMDE_X86_AVX512_REDUCE_H)
+#define SIMDE_X86_AVX512_REDUCE_H
+
+#include "types.h"
+#include "mov.h"
+#include "set1.h"
+#include "../sse4.1.h"
+#include "../f16c.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* GCC only ships the _mm512_reduce_* helpers from version 7 on. */
+#if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+  #define SIMDE_X86_AVX512_REDUCE_NATIVE_
+#endif
+
+/* All reductions fold the upper half of the vector onto the lower half
+ * (512 -> 256 -> 128 -> 64 -> 32 bits), which is the tree GCC's
+ * avx512fintrin.h uses.  For floating-point sums and products this
+ * fixes the association order: with a0..a15 as the lanes,
+ *
+ *   t[i] = a[i + 8] + a[i]       (i < 8)
+ *   u[i] = t[i + 4] + t[i]       (i < 4)
+ *   r    = (u[2] + u[0]) + (u[3] + u[1])
+ *
+ * and likewise for doubles with one level less.  min/max keep the
+ * operand order of _mm_min_ps(upper, lower) at every level, so NaN
+ * and signed zero inputs behave like the native versions. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_add_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_add_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_add_epi32(
+          simde_mm_add_epi32(a_.m128i[3], a_.m128i[1]),
+          simde_mm_add_epi32(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_s32(t_.neon_i32);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_add_epi32(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_add_epi32(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return _mm_cvtsi128_si32(t);
+    #else
+      uint32_t r = t_.u32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.u32) / sizeof(t_.u32[0])) ; i++) {
+        r = r + t_.u32[i];
+      }
+      return HEDLEY_STATIC_CAST(int32_t, r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_epi32
+  #define _mm512_reduce_add_epi32(a) simde_mm512_reduce_add_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_mul_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_mul_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_mullo_epi32(
+          simde_mm_mullo_epi32(a_.m128i[3], a_.m128i[1]),
+          simde_mm_mullo_epi32(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_mullo_epi32(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_mullo_epi32(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return _mm_cvtsi128_si32(t);
+    #else
+      uint32_t r = t_.u32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.u32) / sizeof(t_.u32[0])) ; i++) {
+        r = r * t_.u32[i];
+      }
+      return HEDLEY_STATIC_CAST(int32_t, r);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_epi32
+  #define _mm512_reduce_mul_epi32(a) simde_mm512_reduce_mul_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_max_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_max_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_max_epi32(
+          simde_mm_max_epi32(a_.m128i[3], a_.m128i[1]),
+          simde_mm_max_epi32(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_s32(t_.neon_i32);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_max_epi32(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_max_epi32(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return _mm_cvtsi128_si32(t);
+    #else
+      int32_t r = t_.i32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.i32) / sizeof(t_.i32[0])) ; i++) {
+        r = (r > t_.i32[i]) ? r : t_.i32[i];
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epi32
+  #define _mm512_reduce_max_epi32(a) simde_mm512_reduce_max_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_max_epu32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_max_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_max_epu32(
+          simde_mm_max_epu32(a_.m128i[3], a_.m128i[1]),
+          simde_mm_max_epu32(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_u32(t_.neon_u32);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_max_epu32(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_max_epu32(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(t));
+    #else
+      uint32_t r = t_.u32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.u32) / sizeof(t_.u32[0])) ; i++) {
+        r = (r > t_.u32[i]) ? r : t_.u32[i];
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epu32
+  #define _mm512_reduce_max_epu32(a) simde_mm512_reduce_max_epu32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_min_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_min_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_min_epi32(
+          simde_mm_min_epi32(a_.m128i[3], a_.m128i[1]),
+          simde_mm_min_epi32(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_s32(t_.neon_i32);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_min_epi32(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_min_epi32(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return _mm_cvtsi128_si32(t);
+    #else
+      int32_t r = t_.i32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.i32) / sizeof(t_.i32[0])) ; i++) {
+        r = (r < t_.i32[i]) ? r : t_.i32[i];
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epi32
+  #define _mm512_reduce_min_epi32(a) simde_mm512_reduce_min_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_min_epu32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_min_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_min_epu32(
+          simde_mm_min_epu32(a_.m128i[3], a_.m128i[1]),
+          simde_mm_min_epu32(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_u32(t_.neon_u32);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_min_epu32(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_min_epu32(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return HEDLEY_STATIC_CAST(uint32_t, _mm_cvtsi128_si32(t));
+    #else
+      uint32_t r = t_.u32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.u32) / sizeof(t_.u32[0])) ; i++) {
+        r = (r < t_.u32[i]) ? r : t_.u32[i];
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epu32
+  #define _mm512_reduce_min_epu32(a) simde_mm512_reduce_min_epu32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_and_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_and_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_and_si128(
+          simde_mm_and_si128(a_.m128i[3], a_.m128i[1]),
+          simde_mm_and_si128(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_and_si128(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_and_si128(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return _mm_cvtsi128_si32(t);
+    #else
+      int32_t r = t_.i32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.i32) / sizeof(t_.i32[0])) ; i++) {
+        r = r & t_.i32[i];
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_and_epi32
+  #define _mm512_reduce_and_epi32(a) simde_mm512_reduce_and_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_or_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_or_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_or_si128(
+          simde_mm_or_si128(a_.m128i[3], a_.m128i[1]),
+          simde_mm_or_si128(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      __m128i t = simde_mm_or_si128(t_.n, _mm_shuffle_epi32(t_.n, (1 << 6) | (0 << 4) | (3 << 2) | 2));
+      t = simde_mm_or_si128(t, _mm_shuffle_epi32(t, (2 << 6) | (3 << 4) | (0 << 2) | 1));
+      return _mm_cvtsi128_si32(t);
+    #else
+      int32_t r = t_.i32[0];
+      for (size_t i = 1 ; i < (sizeof(t_.i32) / sizeof(t_.i32[0])) ; i++) {
+        r = r | t_.i32[i];
+      }
+      return r;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_or_epi32
+  #define _mm512_reduce_or_epi32(a) simde_mm512_reduce_or_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_add_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_add_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_add_epi64(
+          simde_mm_add_epi64(a_.m128i[3], a_.m128i[1]),
+          simde_mm_add_epi64(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_s64(t_.neon_i64);
+    #else
+      return HEDLEY_STATIC_CAST(int64_t, t_.u64[0] + t_.u64[1]);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_epi64
+  #define _mm512_reduce_add_epi64(a) simde_mm512_reduce_add_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_mul_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_mul_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    for (size_t n = (sizeof(a_.u64) / sizeof(a_.u64[0])) / 2 ; n > 0 ; n /= 2) {
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < n ; i++) {
+        a_.u64[i] = a_.u64[i + n] * a_.u64[i];
+      }
+    }
+
+    return HEDLEY_STATIC_CAST(int64_t, a_.u64[0]);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_epi64
+  #define _mm512_reduce_mul_epi64(a) simde_mm512_reduce_mul_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_max_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_max_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    for (size_t n = (sizeof(a_.i64) / sizeof(a_.i64[0])) / 2 ; n > 0 ; n /= 2) {
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < n ; i++) {
+        a_.i64[i] = (a_.i64[i + n] > a_.i64[i]) ? a_.i64[i + n] : a_.i64[i];
+      }
+    }
+
+    return a_.i64[0];
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epi64
+  #define _mm512_reduce_max_epi64(a) simde_mm512_reduce_max_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_max_epu64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_max_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    for (size_t n = (sizeof(a_.u64) / sizeof(a_.u64[0])) / 2 ; n > 0 ; n /= 2) {
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < n ; i++) {
+        a_.u64[i] = (a_.u64[i + n] > a_.u64[i]) ? a_.u64[i + n] : a_.u64[i];
+      }
+    }
+
+    return a_.u64[0];
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epu64
+  #define _mm512_reduce_max_epu64(a) simde_mm512_reduce_max_epu64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_min_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_min_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    for (size_t n = (sizeof(a_.i64) / sizeof(a_.i64[0])) / 2 ; n > 0 ; n /= 2) {
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < n ; i++) {
+        a_.i64[i] = (a_.i64[i + n] < a_.i64[i]) ? a_.i64[i + n] : a_.i64[i];
+      }
+    }
+
+    return a_.i64[0];
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epi64
+  #define _mm512_reduce_min_epi64(a) simde_mm512_reduce_min_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_min_epu64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_min_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    for (size_t n = (sizeof(a_.u64) / sizeof(a_.u64[0])) / 2 ; n > 0 ; n /= 2) {
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < n ; i++) {
+        a_.u64[i] = (a_.u64[i + n] < a_.u64[i]) ? a_.u64[i + n] : a_.u64[i];
+      }
+    }
+
+    return a_.u64[0];
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epu64
+  #define _mm512_reduce_min_epu64(a) simde_mm512_reduce_min_epu64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_and_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_and_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_and_si128(
+          simde_mm_and_si128(a_.m128i[3], a_.m128i[1]),
+          simde_mm_and_si128(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    return t_.i64[0] & t_.i64[1];
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_and_epi64
+  #define _mm512_reduce_and_epi64(a) simde_mm512_reduce_and_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_or_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_or_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+    simde__m128i_private t_ =
+      simde__m128i_to_private(
+        simde_mm_or_si128(
+          simde_mm_or_si128(a_.m128i[3], a_.m128i[1]),
+          simde_mm_or_si128(a_.m128i[2], a_.m128i[0])
+        )
+      );
+
+    return t_.i64[0] | t_.i64[1];
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_or_epi64
+  #define _mm512_reduce_or_epi64(a) simde_mm512_reduce_or_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_add_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_add_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m128_private t_ =
+      simde__m128_to_private(
+        simde_mm_add_ps(
+          simde_mm_add_ps(a_.m128[3], a_.m128[1]),
+          simde_mm_add_ps(a_.m128[2], a_.m128[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vpadds_f32(vadd_f32(vget_high_f32(t_.neon_f32), vget_low_f32(t_.neon_f32)));
+    #elif defined(SIMDE_X86_SSE_NATIVE)
+      __m128 t = _mm_add_ps(t_.n, _mm_movehl_ps(t_.n, t_.n));
+      return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 1)));
+    #else
+      return (t_.f32[2] + t_.f32[0]) + (t_.f32[3] + t_.f32[1]);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_ps
+  #define _mm512_reduce_add_ps(a) simde_mm512_reduce_add_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_add_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_add_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m128d_private t_ =
+      simde__m128d_to_private(
+        simde_mm_add_pd(
+          simde_mm_add_pd(a_.m128d[3], a_.m128d[1]),
+          simde_mm_add_pd(a_.m128d[2], a_.m128d[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_f64(t_.neon_f64);
+    #else
+      return t_.f64[1] + t_.f64[0];
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_pd
+  #define _mm512_reduce_add_pd(a) simde_mm512_reduce_add_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_mul_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_mul_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m128_private t_ =
+      simde__m128_to_private(
+        simde_mm_mul_ps(
+          simde_mm_mul_ps(a_.m128[3], a_.m128[1]),
+          simde_mm_mul_ps(a_.m128[2], a_.m128[0])
+        )
+      );
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      float32x2_t t = vmul_f32(vget_high_f32(t_.neon_f32), vget_low_f32(t_.neon_f32));
+      return vget_lane_f32(t, 0) * vget_lane_f32(t, 1);
+    #elif defined(SIMDE_X86_SSE_NATIVE)
+      __m128 t = _mm_mul_ps(t_.n, _mm_movehl_ps(t_.n, t_.n));
+      return _mm_cvtss_f32(_mm_mul_ss(t, _mm_shuffle_ps(t, t, 1)));
+    #else
+      return (t_.f32[2] * t_.f32[0]) * (t_.f32[3] * t_.f32[1]);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_ps
+  #define _mm512_reduce_mul_ps(a) simde_mm512_reduce_mul_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_mul_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_mul_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m128d_private t_ =
+      simde__m128d_to_private(
+        simde_mm_mul_pd(
+          simde_mm_mul_pd(a_.m128d[3], a_.m128d[1]),
+          simde_mm_mul_pd(a_.m128d[2], a_.m128d[0])
+        )
+      );
+
+    return t_.f64[1] * t_.f64[0];
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_pd
+  #define _mm512_reduce_mul_pd(a) simde_mm512_reduce_mul_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_max_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_max_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m128_private t_ =
+      simde__m128_to_private(
+        simde_mm_max_ps(
+          simde_mm_max_ps(a_.m128[3], a_.m128[1]),
+          simde_mm_max_ps(a_.m128[2], a_.m128[0])
+        )
+      );
+
+    #if defined(SIMDE_FAST_NANS) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_f32(t_.neon_f32);
+    #elif defined(SIMDE_X86_SSE_NATIVE)
+      __m128 t = _mm_max_ps(t_.n, _mm_movehl_ps(t_.n, t_.n));
+      return _mm_cvtss_f32(_mm_max_ss(t, _mm_shuffle_ps(t, t, 1)));
+    #else
+      simde_float32 r0 = (t_.f32[0] > t_.f32[2]) ? t_.f32[0] : t_.f32[2];
+      simde_float32 r1 = (t_.f32[1] > t_.f32[3]) ? t_.f32[1] : t_.f32[3];
+      return (r0 > r1) ? r0 : r1;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_ps
+  #define _mm512_reduce_max_ps(a) simde_mm512_reduce_max_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_max_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_max_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m128d_private t_ =
+      simde__m128d_to_private(
+        simde_mm_max_pd(
+          simde_mm_max_pd(a_.m128d[3], a_.m128d[1]),
+          simde_mm_max_pd(a_.m128d[2], a_.m128d[0])
+        )
+      );
+
+    #if defined(SIMDE_FAST_NANS) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_f64(t_.neon_f64);
+    #else
+      return (t_.f64[0] > t_.f64[1]) ? t_.f64[0] : t_.f64[1];
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_pd
+  #define _mm512_reduce_max_pd(a) simde_mm512_reduce_max_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_min_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_min_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+    simde__m128_private t_ =
+      simde__m128_to_private(
+        simde_mm_min_ps(
+          simde_mm_min_ps(a_.m128[3], a_.m128[1]),
+          simde_mm_min_ps(a_.m128[2], a_.m128[0])
+        )
+      );
+
+    #if defined(SIMDE_FAST_NANS) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_f32(t_.neon_f32);
+    #elif defined(SIMDE_X86_SSE_NATIVE)
+      __m128 t = _mm_min_ps(t_.n, _mm_movehl_ps(t_.n, t_.n));
+      return _mm_cvtss_f32(_mm_min_ss(t, _mm_shuffle_ps(t, t, 1)));
+    #else
+      simde_float32 r0 = (t_.f32[0] < t_.f32[2]) ? t_.f32[0] : t_.f32[2];
+      simde_float32 r1 = (t_.f32[1] < t_.f32[3]) ? t_.f32[1] : t_.f32[3];
+      return (r0 < r1) ? r0 : r1;
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_ps
+  #define _mm512_reduce_min_ps(a) simde_mm512_reduce_min_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_min_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_reduce_min_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+    simde__m128d_private t_ =
+      simde__m128d_to_private(
+        simde_mm_min_pd(
+          simde_mm_min_pd(a_.m128d[3], a_.m128d[1]),
+          simde_mm_min_pd(a_.m128d[2], a_.m128d[0])
+        )
+      );
+
+    #if defined(SIMDE_FAST_NANS) && defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_f64(t_.neon_f64);
+    #else
+      return (t_.f64[0] < t_.f64[1]) ? t_.f64[0] : t_.f64[1];
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_pd
+  #define _mm512_reduce_min_pd(a) simde_mm512_reduce_min_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_add_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_add_epi32(k, a);
+  #else
+    return simde_mm512_reduce_add_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_epi32
+  #define _mm512_mask_reduce_add_epi32(k, a) simde_mm512_mask_reduce_add_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_add_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_add_epi64(k, a);
+  #else
+    return simde_mm512_reduce_add_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_epi64
+  #define _mm512_mask_reduce_add_epi64(k, a) simde_mm512_mask_reduce_add_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_add_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_add_ps(k, a);
+  #else
+    return simde_mm512_reduce_add_ps(simde_mm512_maskz_mov_ps(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_ps
+  #define _mm512_mask_reduce_add_ps(k, a) simde_mm512_mask_reduce_add_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_add_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_add_pd(k, a);
+  #else
+    return simde_mm512_reduce_add_pd(simde_mm512_maskz_mov_pd(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_pd
+  #define _mm512_mask_reduce_add_pd(k, a) simde_mm512_mask_reduce_add_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_mul_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_mul_epi32(k, a);
+  #else
+    return simde_mm512_reduce_mul_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(1), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_epi32
+  #define _mm512_mask_reduce_mul_epi32(k, a) simde_mm512_mask_reduce_mul_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_mul_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_mul_epi64(k, a);
+  #else
+    return simde_mm512_reduce_mul_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(1), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_epi64
+  #define _mm512_mask_reduce_mul_epi64(k, a) simde_mm512_mask_reduce_mul_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_mul_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_mul_ps(k, a);
+  #else
+    return simde_mm512_reduce_mul_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_ps
+  #define _mm512_mask_reduce_mul_ps(k, a) simde_mm512_mask_reduce_mul_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_mul_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_mul_pd(k, a);
+  #else
+    return simde_mm512_reduce_mul_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_pd
+  #define _mm512_mask_reduce_mul_pd(k, a) simde_mm512_mask_reduce_mul_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_max_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_max_epi32(k, a);
+  #else
+    return simde_mm512_reduce_max_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MIN), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epi32
+  #define _mm512_mask_reduce_max_epi32(k, a) simde_mm512_mask_reduce_max_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_max_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_max_epu32(k, a);
+  #else
+    return simde_mm512_reduce_max_epu32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epu32
+  #define _mm512_mask_reduce_max_epu32(k, a) simde_mm512_mask_reduce_max_epu32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_max_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_max_epi64(k, a);
+  #else
+    return simde_mm512_reduce_max_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(INT64_MIN), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epi64
+  #define _mm512_mask_reduce_max_epi64(k, a) simde_mm512_mask_reduce_max_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_max_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_max_epu64(k, a);
+  #else
+    return simde_mm512_reduce_max_epu64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epu64
+  #define _mm512_mask_reduce_max_epu64(k, a) simde_mm512_mask_reduce_max_epu64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_max_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_max_ps(k, a);
+  #else
+    return simde_mm512_reduce_max_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(-SIMDE_MATH_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_ps
+  #define _mm512_mask_reduce_max_ps(k, a) simde_mm512_mask_reduce_max_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_max_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_max_pd(k, a);
+  #else
+    return simde_mm512_reduce_max_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(-SIMDE_MATH_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_pd
+  #define _mm512_mask_reduce_max_pd(k, a) simde_mm512_mask_reduce_max_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_min_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_min_epi32(k, a);
+  #else
+    return simde_mm512_reduce_min_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MAX), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epi32
+  #define _mm512_mask_reduce_min_epi32(k, a) simde_mm512_mask_reduce_min_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_min_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_min_epu32(k, a);
+  #else
+    return simde_mm512_reduce_min_epu32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epu32
+  #define _mm512_mask_reduce_min_epu32(k, a) simde_mm512_mask_reduce_min_epu32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_min_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_min_epi64(k, a);
+  #else
+    return simde_mm512_reduce_min_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(INT64_MAX), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epi64
+  #define _mm512_mask_reduce_min_epi64(k, a) simde_mm512_mask_reduce_min_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_min_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_min_epu64(k, a);
+  #else
+    return simde_mm512_reduce_min_epu64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(~INT64_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epu64
+  #define _mm512_mask_reduce_min_epu64(k, a) simde_mm512_mask_reduce_min_epu64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_min_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_min_ps(k, a);
+  #else
+    return simde_mm512_reduce_min_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_ps
+  #define _mm512_mask_reduce_min_ps(k, a) simde_mm512_mask_reduce_min_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_min_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_min_pd(k, a);
+  #else
+    return simde_mm512_reduce_min_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_MATH_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_pd
+  #define _mm512_mask_reduce_min_pd(k, a) simde_mm512_mask_reduce_min_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_and_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_and_epi32(k, a);
+  #else
+    return simde_mm512_reduce_and_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_and_epi32
+  #define _mm512_mask_reduce_and_epi32(k, a) simde_mm512_mask_reduce_and_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_and_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_and_epi64(k, a);
+  #else
+    return simde_mm512_reduce_and_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(~INT64_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_and_epi64
+  #define _mm512_mask_reduce_and_epi64(k, a) simde_mm512_mask_reduce_and_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_or_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_or_epi32(k, a);
+  #else
+    return simde_mm512_reduce_or_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_or_epi32
+  #define _mm512_mask_reduce_or_epi32(k, a) simde_mm512_mask_reduce_or_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_or_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512_REDUCE_NATIVE_)
+    return _mm512_mask_reduce_or_epi64(k, a);
+  #else
+    return simde_mm512_reduce_or_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_or_epi64
+  #define _mm512_mask_reduce_or_epi64(k, a) simde_mm512_mask_reduce_or_epi64(k, a)
+#endif
+
+/* The sum is rounded to half precision after every step and the
+ * lanes are folded in the same order as the native sequence
+ * (i + 16, i + 8, i + 4, ...), so the result matches it exactly. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float16
+simde_mm512_reduce_add_ph (simde__m512h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    _Float16 v = _mm512_reduce_add_ph(a);
+    simde_float16 r;
+    simde_memcpy(&r, &v, sizeof(r));
+    return r;
+  #else
+    simde__m512h_private a_ = simde__m512h_to_private(a);
+    simde__m128i_private t_;
+    simde_float32 t[8];
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(SIMDE_ARM_NEON_FP16)
+      t_.neon_f16 =
+        vaddq_f16(
+          vaddq_f16(a_.m128i_private[0].neon_f16, a_.m128i_private[2].neon_f16),
+          vaddq_f16(a_.m128i_private[1].neon_f16, a_.m128i_private[3].neon_f16)
+        );
+    #else
+      simde__m128i
+        lo = simde_mm256_cvtps_ph(simde_mm256_add_ps(simde_mm256_cvtph_ps(a_.m128i[0]), simde_mm256_cvtph_ps(a_.m128i[2])), SIMDE_MM_FROUND_TO_NEAREST_INT),
+        hi = simde_mm256_cvtps_ph(simde_mm256_add_ps(simde_mm256_cvtph_ps(a_.m128i[1]), simde_mm256_cvtph_ps(a_.m128i[3])), SIMDE_MM_FROUND_TO_NEAREST_INT);
+      t_ = simde__m128i_to_private(simde_mm256_cvtps_ph(simde_mm256_add_ps(simde_mm256_cvtph_ps(lo), simde_mm256_cvtph_ps(hi)), SIMDE_MM_FROUND_TO_NEAREST_INT));
+    #endif
+
+    for (size_t i = 0 ; i < (sizeof(t) / sizeof(t[0])) ; i++) {
+      t[i] = simde_float16_to_float32(simde_uint16_as_float16(t_.u16[i]));
+    }
+
+    for (size_t n = (sizeof(t) / sizeof(t[0])) / 2 ; n > 0 ; n /= 2) {
+      for (size_t i = 0 ; i < n ; i++) {
+        t[i] = simde_float16_to_float32(simde_float16_from_float32(t[i] + t[i + n]));
+      }
+    }
+
+    return simde_float16_from_float32(t[0]);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_ph
+  #define _mm512_reduce_add_ph(a) simde_mm512_reduce_add_ph(a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_REDUCE_H) */
@@ -0,0 +1,392 @@
+#if !defined(SIMDE_X86_AVX512_RSQRT14_H)
+#define SIMDE_X86_AVX512_RSQRT14_H
+
+#include "types.h"
+#include "mov.h"
+#include "../avx.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* See rcp14.h for the precision rcp14/rsqrt14 need. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_rsqrt14_ps (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rsqrt14_ps(a);
+  #else
+    simde__m128_private
+      r_,
+      a_ = simde__m128_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      float32x4_t est = vrsqrteq_f32(a_.neon_f32);
+      r_.neon_f32 = vmulq_f32(est, vrsqrtsq_f32(vmulq_f32(est, est), a_.neon_f32));
+      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+        /* The squared estimate overflows for subnormal inputs, so
+         * those lanes (along with zero and negative ones, where the
+         * exact result is just as cheap) take 1 / sqrt(a) instead. */
+        uint32x4_t tiny = vcltq_f32(a_.neon_f32, vdupq_n_f32(SIMDE_MATH_FLT_MIN));
+        if (HEDLEY_UNLIKELY(vmaxvq_u32(tiny) != 0)) {
+          r_.neon_f32 = vbslq_f32(tiny, vdivq_f32(vdupq_n_f32(SIMDE_FLOAT32_C(1.0)), vsqrtq_f32(a_.neon_f32)), r_.neon_f32);
+        }
+      #endif
+    #elif defined(SIMDE_X86_SSE_NATIVE)
+      /* rsqrtps treats subnormal inputs as zero, and the step below
+       * turns 0 and infinity into NaN, so anything but a positive
+       * normal finite input takes an exact 1 / sqrt(a) instead. */
+      __m128 est = _mm_rsqrt_ps(a_.n);
+      __m128 in_range = _mm_and_ps(_mm_cmpge_ps(a_.n, _mm_set1_ps(SIMDE_MATH_FLT_MIN)), _mm_cmple_ps(a_.n, _mm_set1_ps(SIMDE_MATH_FLT_MAX)));
+      r_.n = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), est), _mm_sub_ps(_mm_set1_ps(SIMDE_FLOAT32_C(3.0)), _mm_mul_ps(_mm_mul_ps(a_.n, est), est)));
+      if (HEDLEY_UNLIKELY(_mm_movemask_ps(in_range) != 0xf)) {
+        __m128 exact = _mm_div_ps(_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), _mm_sqrt_ps(a_.n));
+        r_.n = _mm_or_ps(_mm_and_ps(in_range, r_.n), _mm_andnot_ps(in_range, exact));
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a_.f32[i]);
+      }
+    #endif
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rsqrt14_ps
+  #define _mm_rsqrt14_ps(a) simde_mm_rsqrt14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_rsqrt14_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_rsqrt14_ps(src, k, a);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rsqrt14_ps
+  #define _mm_mask_rsqrt14_ps(src, k, a) simde_mm_mask_rsqrt14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_rsqrt14_ps (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_rsqrt14_ps(k, a);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rsqrt14_ps
+  #define _mm_maskz_rsqrt14_ps(k, a) simde_mm_maskz_rsqrt14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_rsqrt14_pd (simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rsqrt14_pd(a);
+  #else
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      float64x2_t est = vrsqrteq_f64(a_.neon_f64);
+      r_.neon_f64 = vmulq_f64(est, vrsqrtsq_f64(vmulq_f64(est, est), a_.neon_f64));
+      uint64x2_t tiny = vcltq_f64(a_.neon_f64, vdupq_n_f64(SIMDE_MATH_DBL_MIN));
+      if (HEDLEY_UNLIKELY(vmaxvq_u32(vreinterpretq_u32_u64(tiny)) != 0)) {
+        r_.neon_f64 = vbslq_f64(tiny, vdivq_f64(vdupq_n_f64(SIMDE_FLOAT64_C(1.0)), vsqrtq_f64(a_.neon_f64)), r_.neon_f64);
+      }
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      r_.n = _mm_div_pd(_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), _mm_sqrt_pd(a_.n));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a_.f64[i]);
+      }
+    #endif
+
+    return simde__m128d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rsqrt14_pd
+  #define _mm_rsqrt14_pd(a) simde_mm_rsqrt14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_rsqrt14_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_rsqrt14_pd(src, k, a);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rsqrt14_pd
+  #define _mm_mask_rsqrt14_pd(src, k, a) simde_mm_mask_rsqrt14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_rsqrt14_pd (simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_rsqrt14_pd(k, a);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rsqrt14_pd
+  #define _mm_maskz_rsqrt14_pd(k, a) simde_mm_maskz_rsqrt14_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_rsqrt14_ps (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_rsqrt14_ps(a);
+  #else
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    #if defined(SIMDE_X86_AVX_NATIVE)
+      __m256 est = _mm256_rsqrt_ps(a_.n);
+      __m256 in_range = _mm256_and_ps(_mm256_cmp_ps(a_.n, _mm256_set1_ps(SIMDE_MATH_FLT_MIN), _CMP_GE_OQ), _mm256_cmp_ps(a_.n, _mm256_set1_ps(SIMDE_MATH_FLT_MAX), _CMP_LE_OQ));
+      r_.n = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), est), _mm256_sub_ps(_mm256_set1_ps(SIMDE_FLOAT32_C(3.0)), _mm256_mul_ps(_mm256_mul_ps(a_.n, est), est)));
+      if (HEDLEY_UNLIKELY(_mm256_movemask_ps(in_range) != 0xff)) {
+        r_.n = _mm256_blendv_ps(_mm256_div_ps(_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), _mm256_sqrt_ps(a_.n)), r_.n, in_range);
+      }
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+        r_.m128[i] = simde_mm_rsqrt14_ps(a_.m128[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a_.f32[i]);
+      }
+    #endif
+
+    return simde__m256_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_rsqrt14_ps
+  #define _mm256_rsqrt14_ps(a) simde_mm256_rsqrt14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_rsqrt14_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_rsqrt14_ps(src, k, a);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_rsqrt14_ps
+  #define _mm256_mask_rsqrt14_ps(src, k, a) simde_mm256_mask_rsqrt14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_rsqrt14_ps (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_rsqrt14_ps(k, a);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_rsqrt14_ps
+  #define _mm256_maskz_rsqrt14_ps(k, a) simde_mm256_maskz_rsqrt14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_rsqrt14_pd (simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_rsqrt14_pd(a);
+  #else
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    #if defined(SIMDE_X86_AVX_NATIVE)
+      r_.n = _mm256_div_pd(_mm256_set1_pd(SIMDE_FLOAT64_C(1.0)), _mm256_sqrt_pd(a_.n));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+        r_.m128d[i] = simde_mm_rsqrt14_pd(a_.m128d[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a_.f64[i]);
+      }
+    #endif
+
+    return simde__m256d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_rsqrt14_pd
+  #define _mm256_rsqrt14_pd(a) simde_mm256_rsqrt14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_rsqrt14_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_rsqrt14_pd(src, k, a);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_rsqrt14_pd
+  #define _mm256_mask_rsqrt14_pd(src, k, a) simde_mm256_mask_rsqrt14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_rsqrt14_pd (simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_rsqrt14_pd(k, a);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_rsqrt14_pd
+  #define _mm256_maskz_rsqrt14_pd(k, a) simde_mm256_maskz_rsqrt14_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_rsqrt14_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_rsqrt14_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_rsqrt14_ps(a_.m256[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a_.f32[i]);
+      }
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rsqrt14_ps
+  #define _mm512_rsqrt14_ps(a) simde_mm512_rsqrt14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_rsqrt14_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_rsqrt14_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rsqrt14_ps
+  #define _mm512_mask_rsqrt14_ps(src, k, a) simde_mm512_mask_rsqrt14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_rsqrt14_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_rsqrt14_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rsqrt14_ps
+  #define _mm512_maskz_rsqrt14_ps(k, a) simde_mm512_maskz_rsqrt14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_rsqrt14_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_rsqrt14_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
+        r_.m256d[i] = simde_mm256_rsqrt14_pd(a_.m256d[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a_.f64[i]);
+      }
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rsqrt14_pd
+  #define _mm512_rsqrt14_pd(a) simde_mm512_rsqrt14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_rsqrt14_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_rsqrt14_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rsqrt14_pd
+  #define _mm512_mask_rsqrt14_pd(src, k, a) simde_mm512_mask_rsqrt14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_rsqrt14_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_rsqrt14_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rsqrt14_pd
+  #define _mm512_maskz_rsqrt14_pd(k, a) simde_mm512_maskz_rsqrt14_pd(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_RSQRT14_H) */
@@ -61,6 +61,20 @@ simde_mm512_store_pd (void * mem_addr, simde__m512d a) {
   #define _mm512_store_pd(mem_addr, a) simde_mm512_store_pd(mem_addr, a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_store_ph (void * mem_addr, simde__m512h a) {
+  #if defined(SIMDE_X86_AVX512FP16_NATIVE)
+    _mm512_store_ph(mem_addr, a);
+  #else
+    simde_memcpy(SIMDE_ALIGN_ASSUME_LIKE(mem_addr, simde__m512h), &a, sizeof(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512FP16_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_store_ph
+  #define _mm512_store_ph(mem_addr, a) simde_mm512_store_ph(mem_addr, a)
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 void
 simde_mm512_store_si512 (void * mem_addr, simde__m512i a) {
@@ -3951,6 +3951,8 @@ simde_mm_sfence (void) {
   #if defined(SIMDE_X86_SSE_NATIVE)
     _mm_sfence();
   #elif defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+    /* On AArch64 this is a DMB ISH, which is also what orders the
+     * STNP-based emulation of the streaming stores. */
     __atomic_thread_fence(__ATOMIC_SEQ_CST);
   #elif !defined(__INTEL_COMPILER) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
     #if defined(__GNUC__) && (__GNUC__ == 4) && (__GNUC_MINOR__ < 9)
@@ -4666,6 +4668,47 @@ simde_mm_unpacklo_ps (simde__m128 a, simde__m128 b) {
 #  define _mm_unpacklo_ps(a, b) simde_mm_unpacklo_ps((a), (b))
 #endif
 
+/* AArch64 has non-temporal pair loads/stores (LDNP/STNP) which we use to
+ * emulate the streaming functions when the compiler doesn't provide
+ * __builtin_nontemporal_store / __builtin_nontemporal_load (i.e., GCC). */
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(HEDLEY_GNUC_VERSION)
+  #define SIMDE_X86_STREAM_ARM_NEON_NP_
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_arm_neon_stnp_u8_ (void* mem_addr, uint8x16_t a) {
+    __asm__ ("stnp %d[lo], %d[hi], %[mem]"
+      : [mem] "=Q" (*HEDLEY_REINTERPRET_CAST(uint8_t (*)[16], mem_addr))
+      : [lo] "w" (vget_low_u8(a)), [hi] "w" (vget_high_u8(a)));
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_arm_neon_stnp_u8x2_ (void* mem_addr, uint8x16_t a, uint8x16_t b) {
+    __asm__ ("stnp %q[a], %q[b], %[mem]"
+      : [mem] "=Q" (*HEDLEY_REINTERPRET_CAST(uint8_t (*)[32], mem_addr))
+      : [a] "w" (a), [b] "w" (b));
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  uint8x16_t
+  simde_x_arm_neon_ldnp_u8_ (const void* mem_addr) {
+    uint8x8_t lo, hi;
+    __asm__ ("ldnp %d[lo], %d[hi], %[mem]"
+      : [lo] "=w" (lo), [hi] "=w" (hi)
+      : [mem] "Q" (*HEDLEY_REINTERPRET_CAST(const uint8_t (*)[16], mem_addr)));
+    return vcombine_u8(lo, hi);
+  }
+
+  SIMDE_FUNCTION_ATTRIBUTES
+  void
+  simde_x_arm_neon_ldnp_u8x2_ (const void* mem_addr, uint8x16_t* a, uint8x16_t* b) {
+    __asm__ ("ldnp %q[a], %q[b], %[mem]"
+      : [a] "=w" (*a), [b] "=w" (*b)
+      : [mem] "Q" (*HEDLEY_REINTERPRET_CAST(const uint8_t (*)[32], mem_addr)));
+  }
+#endif
+
 SIMDE_FUNCTION_ATTRIBUTES
 void
 simde_mm_stream_pi (simde__m64* mem_addr, simde__m64 a) {
@@ -4695,6 +4738,8 @@ simde_mm_stream_ps (simde_float32 mem_addr[4], simde__m128 a) {
   #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
     simde__m128_private a_ = simde__m128_to_private(a);
     __builtin_nontemporal_store(a_.f32, SIMDE_ALIGN_CAST(__typeof__(a_.f32)*, mem_addr));
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    simde_x_arm_neon_stnp_u8_(mem_addr, vreinterpretq_u8_f32(simde__m128_to_neon_f32(a)));
   #else
     simde_mm_store_ps(mem_addr, a);
   #endif
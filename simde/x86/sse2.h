@@ -6417,6 +6417,11 @@ void
 simde_mm_stream_pd (simde_float64 mem_addr[HEDLEY_ARRAY_PARAM(2)], simde__m128d a) {
   #if defined(SIMDE_X86_SSE2_NATIVE)
     _mm_stream_pd(mem_addr, a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m128d_private a_ = simde__m128d_to_private(a);
+    __builtin_nontemporal_store(a_.f64, SIMDE_ALIGN_CAST(__typeof__(a_.f64)*, mem_addr));
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    simde_x_arm_neon_stnp_u8_(mem_addr, simde__m128d_to_private(a).neon_u8);
   #else
     simde_memcpy(mem_addr, &a, sizeof(a));
   #endif
@@ -6430,6 +6435,11 @@ void
 simde_mm_stream_si128 (simde__m128i* mem_addr, simde__m128i a) {
   #if defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_ARCH_AMD64)
     _mm_stream_si128(HEDLEY_STATIC_CAST(__m128i*, mem_addr), a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m128i_private a_ = simde__m128i_to_private(a);
+    __builtin_nontemporal_store(a_.i64, SIMDE_ALIGN_CAST(__typeof__(a_.i64)*, mem_addr));
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    simde_x_arm_neon_stnp_u8_(mem_addr, simde__m128i_to_neon_u8(a));
   #else
     simde_memcpy(mem_addr, &a, sizeof(a));
   #endif
@@ -6443,6 +6453,8 @@ void
 simde_mm_stream_si32 (int32_t* mem_addr, int32_t a) {
   #if defined(SIMDE_X86_SSE2_NATIVE)
     _mm_stream_si32(mem_addr, a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store)
+    __builtin_nontemporal_store(a, mem_addr);
   #else
     *mem_addr = a;
   #endif
@@ -6456,6 +6468,8 @@ void
 simde_mm_stream_si64 (int64_t* mem_addr, int64_t a) {
   #if defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_ARCH_AMD64) && !defined(HEDLEY_MSVC_VERSION)
     _mm_stream_si64(SIMDE_CHECKED_REINTERPRET_CAST(long long int*, int64_t*, mem_addr), a);
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_store)
+    __builtin_nontemporal_store(a, mem_addr);
   #else
     *mem_addr = a;
   #endif
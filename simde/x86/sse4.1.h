@@ -1772,13 +1772,44 @@ simde_mm_minpos_epu16 (simde__m128i a) {
       r_ = simde__m128i_to_private(simde_mm_setzero_si128()),
       a_ = simde__m128i_to_private(a);
 
-    r_.u16[0] = UINT16_MAX;
-    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
-      if (a_.u16[i] < r_.u16[0]) {
-        r_.u16[0] = a_.u16[i];
-        r_.u16[1] = HEDLEY_STATIC_CAST(uint16_t, i);
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      /* Find the minimum, then the lowest index holding it: lanes which
+       * don't match are forced to 0xffff before the second reduction. */
+      static const uint16_t idx[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+      #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+        const uint16_t min = vminvq_u16(a_.neon_u16);
+        const uint16x8_t pos = vornq_u16(vld1q_u16(idx), vceqq_u16(a_.neon_u16, vdupq_n_u16(min)));
+        r_.neon_u16 = vsetq_lane_u16(vminvq_u16(pos), vsetq_lane_u16(min, vdupq_n_u16(0), 0), 1);
+      #else
+        uint16x4_t min = vpmin_u16(vget_low_u16(a_.neon_u16), vget_high_u16(a_.neon_u16));
+        min = vpmin_u16(min, min);
+        min = vpmin_u16(min, min);
+        const uint16x8_t pos8 = vornq_u16(vld1q_u16(idx), vceqq_u16(a_.neon_u16, vcombine_u16(min, min)));
+        uint16x4_t pos = vpmin_u16(vget_low_u16(pos8), vget_high_u16(pos8));
+        pos = vpmin_u16(pos, pos);
+        pos = vpmin_u16(pos, pos);
+        r_.neon_u16 = vcombine_u16(vand_u16(vzip_u16(min, pos).val[0], vcreate_u16(UINT64_C(0xffffffff))), vdup_n_u16(0));
+      #endif
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      v128_t min = wasm_u16x8_min(a_.wasm_v128, wasm_i16x8_shuffle(a_.wasm_v128, a_.wasm_v128, 4, 5, 6, 7, 0, 1, 2, 3));
+      min = wasm_u16x8_min(min, wasm_i16x8_shuffle(min, min, 2, 3, 0, 1, 6, 7, 4, 5));
+      min = wasm_u16x8_min(min, wasm_i16x8_shuffle(min, min, 1, 0, 3, 2, 5, 4, 7, 6));
+
+      v128_t pos = wasm_v128_or(wasm_i16x8_make(0, 1, 2, 3, 4, 5, 6, 7), wasm_v128_not(wasm_i16x8_eq(a_.wasm_v128, min)));
+      pos = wasm_u16x8_min(pos, wasm_i16x8_shuffle(pos, pos, 4, 5, 6, 7, 0, 1, 2, 3));
+      pos = wasm_u16x8_min(pos, wasm_i16x8_shuffle(pos, pos, 2, 3, 0, 1, 6, 7, 4, 5));
+      pos = wasm_u16x8_min(pos, wasm_i16x8_shuffle(pos, pos, 1, 0, 3, 2, 5, 4, 7, 6));
+
+      r_.wasm_v128 = wasm_v128_and(wasm_i16x8_shuffle(min, pos, 0, 8, 0, 0, 0, 0, 0, 0), wasm_i32x4_make(~INT32_C(0), 0, 0, 0));
+    #else
+      r_.u16[0] = UINT16_MAX;
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        if (a_.u16[i] < r_.u16[0]) {
+          r_.u16[0] = a_.u16[i];
+          r_.u16[1] = HEDLEY_STATIC_CAST(uint16_t, i);
+        }
       }
-    }
+    #endif
 
     return simde__m128i_from_private(r_);
   #endif
@@ -1800,7 +1831,31 @@ simde_mm_mpsadbw_epu8 (simde__m128i a, simde__m128i b, const int imm8)
   const int a_offset = imm8 & 4;
   const int b_offset = (imm8 & 3) << 2;
 
-#if defined(simde_math_abs)
+#if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  /* Each of the four terms is an absolute difference between eight
+   * consecutive bytes of a (starting one byte later each time) and a
+   * single byte of b. */
+  uint16x8_t sum = vabdl_u8(vld1_u8(&(a_.u8[a_offset + 0])), vdup_n_u8(b_.u8[b_offset + 0]));
+  sum = vabal_u8(sum, vld1_u8(&(a_.u8[a_offset + 1])), vdup_n_u8(b_.u8[b_offset + 1]));
+  sum = vabal_u8(sum, vld1_u8(&(a_.u8[a_offset + 2])), vdup_n_u8(b_.u8[b_offset + 2]));
+  sum = vabal_u8(sum, vld1_u8(&(a_.u8[a_offset + 3])), vdup_n_u8(b_.u8[b_offset + 3]));
+  r_.neon_u16 = sum;
+#elif defined(SIMDE_WASM_SIMD128_NATIVE)
+  v128_t sum = wasm_i16x8_splat(0);
+  for (int i = 0 ; i < 4 ; i++) {
+    sum =
+      wasm_i16x8_add(
+        sum,
+        wasm_i16x8_abs(
+          wasm_i16x8_sub(
+            wasm_u16x8_load8x8(&(a_.u8[a_offset + i])),
+            wasm_i16x8_splat(HEDLEY_STATIC_CAST(int16_t, b_.u8[b_offset + i]))
+          )
+        )
+      );
+  }
+  r_.wasm_v128 = sum;
+#elif defined(simde_math_abs)
   for (int i = 0 ; i < HEDLEY_STATIC_CAST(int, (sizeof(r_.u16) / sizeof(r_.u16[0]))) ; i++) {
     r_.u16[i] =
       HEDLEY_STATIC_CAST(uint16_t, simde_math_abs(HEDLEY_STATIC_CAST(int, a_.u8[a_offset + i + 0] - b_.u8[b_offset + 0]))) +
@@ -2083,6 +2138,12 @@ simde__m128i
 simde_mm_stream_load_si128 (const simde__m128i* mem_addr) {
   #if defined(SIMDE_X86_SSE4_1_NATIVE)
     return _mm_stream_load_si128(HEDLEY_CONST_CAST(simde__m128i*, mem_addr));
+  #elif HEDLEY_HAS_BUILTIN(__builtin_nontemporal_load) && defined(SIMDE_VECTOR_SUBSCRIPT_OPS)
+    simde__m128i_private r_;
+    r_.i64 = __builtin_nontemporal_load(SIMDE_ALIGN_CAST(const __typeof__(r_.i64)*, mem_addr));
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_X86_STREAM_ARM_NEON_NP_)
+    return simde__m128i_from_neon_u8(simde_x_arm_neon_ldnp_u8_(mem_addr));
   #elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vreinterpretq_s64_s32(vld1q_s32(HEDLEY_REINTERPRET_CAST(int32_t const*, mem_addr)));
   #else
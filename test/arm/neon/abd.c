@@ -144,6 +144,92 @@ test_simde_vabdd_f64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vabdh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(   266.25),
+      SIMDE_FLOAT16_VALUE(  -732.00),
+      SIMDE_FLOAT16_VALUE(   998.00) },
+    { SIMDE_FLOAT16_VALUE(   946.50),
+      SIMDE_FLOAT16_VALUE(   818.50),
+      SIMDE_FLOAT16_VALUE(   128.00) },
+    { SIMDE_FLOAT16_VALUE(  -104.31),
+      SIMDE_FLOAT16_VALUE(  -480.75),
+      SIMDE_FLOAT16_VALUE(   376.50) },
+    { SIMDE_FLOAT16_VALUE(   474.50),
+      SIMDE_FLOAT16_VALUE(   154.50),
+      SIMDE_FLOAT16_VALUE(   320.00) },
+    { SIMDE_FLOAT16_VALUE(   346.00),
+      SIMDE_FLOAT16_VALUE(  -953.00),
+      SIMDE_FLOAT16_VALUE(  1299.00) },
+    { SIMDE_FLOAT16_VALUE(  -435.00),
+      SIMDE_FLOAT16_VALUE(  -314.00),
+      SIMDE_FLOAT16_VALUE(   121.00) },
+    { SIMDE_FLOAT16_VALUE(  -705.00),
+      SIMDE_FLOAT16_VALUE(   592.00),
+      SIMDE_FLOAT16_VALUE(  1297.00) },
+    { SIMDE_FLOAT16_VALUE(   770.00),
+      SIMDE_FLOAT16_VALUE(    91.94),
+      SIMDE_FLOAT16_VALUE(   678.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vabdh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vabd_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -503.75), SIMDE_FLOAT16_VALUE(  -221.88), SIMDE_FLOAT16_VALUE(   627.00), SIMDE_FLOAT16_VALUE(  -924.00) },
+      { SIMDE_FLOAT16_VALUE(  -351.25), SIMDE_FLOAT16_VALUE(   561.50), SIMDE_FLOAT16_VALUE(  -525.00), SIMDE_FLOAT16_VALUE(   186.62) },
+      { SIMDE_FLOAT16_VALUE(   152.50), SIMDE_FLOAT16_VALUE(   783.50), SIMDE_FLOAT16_VALUE(  1152.00), SIMDE_FLOAT16_VALUE(  1111.00) } },
+    { { SIMDE_FLOAT16_VALUE(   798.00), SIMDE_FLOAT16_VALUE(  -136.75), SIMDE_FLOAT16_VALUE(  -973.00), SIMDE_FLOAT16_VALUE(   631.50) },
+      { SIMDE_FLOAT16_VALUE(  -543.50), SIMDE_FLOAT16_VALUE(  -332.75), SIMDE_FLOAT16_VALUE(    10.24), SIMDE_FLOAT16_VALUE(   235.12) },
+      { SIMDE_FLOAT16_VALUE(  1342.00), SIMDE_FLOAT16_VALUE(   196.00), SIMDE_FLOAT16_VALUE(   983.00), SIMDE_FLOAT16_VALUE(   396.50) } },
+    { { SIMDE_FLOAT16_VALUE(    42.38), SIMDE_FLOAT16_VALUE(  -860.00), SIMDE_FLOAT16_VALUE(  -952.50), SIMDE_FLOAT16_VALUE(  -702.00) },
+      { SIMDE_FLOAT16_VALUE(   492.00), SIMDE_FLOAT16_VALUE(  -759.50), SIMDE_FLOAT16_VALUE(   680.50), SIMDE_FLOAT16_VALUE(   762.50) },
+      { SIMDE_FLOAT16_VALUE(   449.50), SIMDE_FLOAT16_VALUE(   100.50), SIMDE_FLOAT16_VALUE(  1633.00), SIMDE_FLOAT16_VALUE(  1464.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -342.00), SIMDE_FLOAT16_VALUE(   823.00), SIMDE_FLOAT16_VALUE(   512.00), SIMDE_FLOAT16_VALUE(   173.62) },
+      { SIMDE_FLOAT16_VALUE(   389.00), SIMDE_FLOAT16_VALUE(  -990.50), SIMDE_FLOAT16_VALUE(  -448.00), SIMDE_FLOAT16_VALUE(  -142.50) },
+      { SIMDE_FLOAT16_VALUE(   731.00), SIMDE_FLOAT16_VALUE(  1814.00), SIMDE_FLOAT16_VALUE(   960.00), SIMDE_FLOAT16_VALUE(   316.00) } },
+    { { SIMDE_FLOAT16_VALUE(    62.75), SIMDE_FLOAT16_VALUE(  -253.50), SIMDE_FLOAT16_VALUE(  -896.50), SIMDE_FLOAT16_VALUE(    48.59) },
+      { SIMDE_FLOAT16_VALUE(   805.50), SIMDE_FLOAT16_VALUE(   706.00), SIMDE_FLOAT16_VALUE(  -127.00), SIMDE_FLOAT16_VALUE(  -821.50) },
+      { SIMDE_FLOAT16_VALUE(   743.00), SIMDE_FLOAT16_VALUE(   959.50), SIMDE_FLOAT16_VALUE(   769.50), SIMDE_FLOAT16_VALUE(   870.00) } },
+    { { SIMDE_FLOAT16_VALUE(   529.50), SIMDE_FLOAT16_VALUE(  -188.75), SIMDE_FLOAT16_VALUE(   830.50), SIMDE_FLOAT16_VALUE(  -193.25) },
+      { SIMDE_FLOAT16_VALUE(  -370.50), SIMDE_FLOAT16_VALUE(   971.00), SIMDE_FLOAT16_VALUE(   -52.84), SIMDE_FLOAT16_VALUE(   590.00) },
+      { SIMDE_FLOAT16_VALUE(   900.00), SIMDE_FLOAT16_VALUE(  1160.00), SIMDE_FLOAT16_VALUE(   883.50), SIMDE_FLOAT16_VALUE(   783.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -925.00), SIMDE_FLOAT16_VALUE(   406.50), SIMDE_FLOAT16_VALUE(  -696.00), SIMDE_FLOAT16_VALUE(  -293.00) },
+      { SIMDE_FLOAT16_VALUE(    27.69), SIMDE_FLOAT16_VALUE(  -523.50), SIMDE_FLOAT16_VALUE(  -857.00), SIMDE_FLOAT16_VALUE(  -608.00) },
+      { SIMDE_FLOAT16_VALUE(   952.50), SIMDE_FLOAT16_VALUE(   930.00), SIMDE_FLOAT16_VALUE(   161.00), SIMDE_FLOAT16_VALUE(   315.00) } },
+    { { SIMDE_FLOAT16_VALUE(   987.00), SIMDE_FLOAT16_VALUE(   838.50), SIMDE_FLOAT16_VALUE(  -437.50), SIMDE_FLOAT16_VALUE(   547.50) },
+      { SIMDE_FLOAT16_VALUE(  -271.75), SIMDE_FLOAT16_VALUE(  -312.00), SIMDE_FLOAT16_VALUE(   593.50), SIMDE_FLOAT16_VALUE(  -688.00) },
+      { SIMDE_FLOAT16_VALUE(  1259.00), SIMDE_FLOAT16_VALUE(  1150.00), SIMDE_FLOAT16_VALUE(  1031.00), SIMDE_FLOAT16_VALUE(  1236.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vabd_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vabd_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -613,6 +699,74 @@ test_simde_vabd_u32 (SIMDE_MUNIT_TEST_ARGS) {
 }
 #endif
 
+static int
+test_simde_vabdq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -11.66), SIMDE_FLOAT16_VALUE(   744.00), SIMDE_FLOAT16_VALUE(  -841.00), SIMDE_FLOAT16_VALUE(  -754.50),
+          SIMDE_FLOAT16_VALUE(  -480.00), SIMDE_FLOAT16_VALUE(  -169.25), SIMDE_FLOAT16_VALUE(   494.25), SIMDE_FLOAT16_VALUE(   434.00) },
+      { SIMDE_FLOAT16_VALUE(    94.94), SIMDE_FLOAT16_VALUE(   383.00), SIMDE_FLOAT16_VALUE(   574.00), SIMDE_FLOAT16_VALUE(  -424.75),
+          SIMDE_FLOAT16_VALUE(   994.50), SIMDE_FLOAT16_VALUE(  -451.25), SIMDE_FLOAT16_VALUE(   780.50), SIMDE_FLOAT16_VALUE(  -908.00) },
+      { SIMDE_FLOAT16_VALUE(   106.62), SIMDE_FLOAT16_VALUE(   361.00), SIMDE_FLOAT16_VALUE(  1415.00), SIMDE_FLOAT16_VALUE(   329.75),
+          SIMDE_FLOAT16_VALUE(  1474.00), SIMDE_FLOAT16_VALUE(   282.00), SIMDE_FLOAT16_VALUE(   286.25), SIMDE_FLOAT16_VALUE(  1342.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -28.77), SIMDE_FLOAT16_VALUE(  -220.50), SIMDE_FLOAT16_VALUE(   -62.62), SIMDE_FLOAT16_VALUE(  -875.50),
+          SIMDE_FLOAT16_VALUE(  -891.00), SIMDE_FLOAT16_VALUE(   287.75), SIMDE_FLOAT16_VALUE(   652.00), SIMDE_FLOAT16_VALUE(  -619.50) },
+      { SIMDE_FLOAT16_VALUE(   654.00), SIMDE_FLOAT16_VALUE(  -872.50), SIMDE_FLOAT16_VALUE(   239.75), SIMDE_FLOAT16_VALUE(   212.50),
+          SIMDE_FLOAT16_VALUE(   311.50), SIMDE_FLOAT16_VALUE(  -578.00), SIMDE_FLOAT16_VALUE(   812.00), SIMDE_FLOAT16_VALUE(   -35.16) },
+      { SIMDE_FLOAT16_VALUE(   683.00), SIMDE_FLOAT16_VALUE(   652.00), SIMDE_FLOAT16_VALUE(   302.50), SIMDE_FLOAT16_VALUE(  1088.00),
+          SIMDE_FLOAT16_VALUE(  1202.00), SIMDE_FLOAT16_VALUE(   866.00), SIMDE_FLOAT16_VALUE(   160.00), SIMDE_FLOAT16_VALUE(   584.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -697.00), SIMDE_FLOAT16_VALUE(   838.00), SIMDE_FLOAT16_VALUE(   765.50), SIMDE_FLOAT16_VALUE(  -561.00),
+          SIMDE_FLOAT16_VALUE(   411.25), SIMDE_FLOAT16_VALUE(   969.50), SIMDE_FLOAT16_VALUE(   358.75), SIMDE_FLOAT16_VALUE(   753.00) },
+      { SIMDE_FLOAT16_VALUE(  -610.00), SIMDE_FLOAT16_VALUE(   530.50), SIMDE_FLOAT16_VALUE(    46.41), SIMDE_FLOAT16_VALUE(  -373.00),
+          SIMDE_FLOAT16_VALUE(   526.50), SIMDE_FLOAT16_VALUE(  -922.00), SIMDE_FLOAT16_VALUE(   567.50), SIMDE_FLOAT16_VALUE(   317.50) },
+      { SIMDE_FLOAT16_VALUE(    87.00), SIMDE_FLOAT16_VALUE(   307.50), SIMDE_FLOAT16_VALUE(   719.00), SIMDE_FLOAT16_VALUE(   188.00),
+          SIMDE_FLOAT16_VALUE(   115.25), SIMDE_FLOAT16_VALUE(  1892.00), SIMDE_FLOAT16_VALUE(   208.75), SIMDE_FLOAT16_VALUE(   435.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -500.75), SIMDE_FLOAT16_VALUE(  -548.00), SIMDE_FLOAT16_VALUE(   -22.81), SIMDE_FLOAT16_VALUE(  -122.19),
+          SIMDE_FLOAT16_VALUE(  -281.50), SIMDE_FLOAT16_VALUE(   556.00), SIMDE_FLOAT16_VALUE(   416.00), SIMDE_FLOAT16_VALUE(   599.00) },
+      { SIMDE_FLOAT16_VALUE(   712.00), SIMDE_FLOAT16_VALUE(  -164.75), SIMDE_FLOAT16_VALUE(   987.50), SIMDE_FLOAT16_VALUE(    91.69),
+          SIMDE_FLOAT16_VALUE(   840.00), SIMDE_FLOAT16_VALUE(   544.00), SIMDE_FLOAT16_VALUE(  -401.00), SIMDE_FLOAT16_VALUE(    47.31) },
+      { SIMDE_FLOAT16_VALUE(  1213.00), SIMDE_FLOAT16_VALUE(   383.25), SIMDE_FLOAT16_VALUE(  1010.50), SIMDE_FLOAT16_VALUE(   213.88),
+          SIMDE_FLOAT16_VALUE(  1122.00), SIMDE_FLOAT16_VALUE(    12.00), SIMDE_FLOAT16_VALUE(   817.00), SIMDE_FLOAT16_VALUE(   551.50) } },
+    { { SIMDE_FLOAT16_VALUE(    95.38), SIMDE_FLOAT16_VALUE(  -785.00), SIMDE_FLOAT16_VALUE(   880.00), SIMDE_FLOAT16_VALUE(   110.81),
+          SIMDE_FLOAT16_VALUE(  -389.75), SIMDE_FLOAT16_VALUE(   907.50), SIMDE_FLOAT16_VALUE(  -468.50), SIMDE_FLOAT16_VALUE(  -383.00) },
+      { SIMDE_FLOAT16_VALUE(   450.00), SIMDE_FLOAT16_VALUE(   132.38), SIMDE_FLOAT16_VALUE(  -986.00), SIMDE_FLOAT16_VALUE(   226.88),
+          SIMDE_FLOAT16_VALUE(   215.25), SIMDE_FLOAT16_VALUE(  -661.00), SIMDE_FLOAT16_VALUE(   546.50), SIMDE_FLOAT16_VALUE(  -122.81) },
+      { SIMDE_FLOAT16_VALUE(   354.50), SIMDE_FLOAT16_VALUE(   917.50), SIMDE_FLOAT16_VALUE(  1866.00), SIMDE_FLOAT16_VALUE(   116.06),
+          SIMDE_FLOAT16_VALUE(   605.00), SIMDE_FLOAT16_VALUE(  1568.00), SIMDE_FLOAT16_VALUE(  1015.00), SIMDE_FLOAT16_VALUE(   260.25) } },
+    { { SIMDE_FLOAT16_VALUE(    90.94), SIMDE_FLOAT16_VALUE(  -676.50), SIMDE_FLOAT16_VALUE(   437.25), SIMDE_FLOAT16_VALUE(   259.50),
+          SIMDE_FLOAT16_VALUE(  -268.25), SIMDE_FLOAT16_VALUE(   443.75), SIMDE_FLOAT16_VALUE(  -734.50), SIMDE_FLOAT16_VALUE(   938.00) },
+      { SIMDE_FLOAT16_VALUE(  -458.25), SIMDE_FLOAT16_VALUE(   958.50), SIMDE_FLOAT16_VALUE(  -755.00), SIMDE_FLOAT16_VALUE(  -770.50),
+          SIMDE_FLOAT16_VALUE(  -739.50), SIMDE_FLOAT16_VALUE(    77.12), SIMDE_FLOAT16_VALUE(   -37.56), SIMDE_FLOAT16_VALUE(   629.00) },
+      { SIMDE_FLOAT16_VALUE(   549.00), SIMDE_FLOAT16_VALUE(  1635.00), SIMDE_FLOAT16_VALUE(  1192.00), SIMDE_FLOAT16_VALUE(  1030.00),
+          SIMDE_FLOAT16_VALUE(   471.25), SIMDE_FLOAT16_VALUE(   366.50), SIMDE_FLOAT16_VALUE(   697.00), SIMDE_FLOAT16_VALUE(   309.00) } },
+    { { SIMDE_FLOAT16_VALUE(   981.50), SIMDE_FLOAT16_VALUE(   764.50), SIMDE_FLOAT16_VALUE(  -808.00), SIMDE_FLOAT16_VALUE(  -225.75),
+          SIMDE_FLOAT16_VALUE(   -34.69), SIMDE_FLOAT16_VALUE(   -49.28), SIMDE_FLOAT16_VALUE(  -478.75), SIMDE_FLOAT16_VALUE(   973.50) },
+      { SIMDE_FLOAT16_VALUE(  -822.50), SIMDE_FLOAT16_VALUE(   442.75), SIMDE_FLOAT16_VALUE(   725.00), SIMDE_FLOAT16_VALUE(  -309.75),
+          SIMDE_FLOAT16_VALUE(  -110.44), SIMDE_FLOAT16_VALUE(  -981.00), SIMDE_FLOAT16_VALUE(    49.38), SIMDE_FLOAT16_VALUE(  -932.50) },
+      { SIMDE_FLOAT16_VALUE(  1804.00), SIMDE_FLOAT16_VALUE(   321.75), SIMDE_FLOAT16_VALUE(  1533.00), SIMDE_FLOAT16_VALUE(    84.00),
+          SIMDE_FLOAT16_VALUE(    75.75), SIMDE_FLOAT16_VALUE(   931.50), SIMDE_FLOAT16_VALUE(   528.00), SIMDE_FLOAT16_VALUE(  1906.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -398.75), SIMDE_FLOAT16_VALUE(  -288.25), SIMDE_FLOAT16_VALUE(  -622.50), SIMDE_FLOAT16_VALUE(  -597.00),
+          SIMDE_FLOAT16_VALUE(   836.50), SIMDE_FLOAT16_VALUE(   144.50), SIMDE_FLOAT16_VALUE(  -702.00), SIMDE_FLOAT16_VALUE(   307.25) },
+      { SIMDE_FLOAT16_VALUE(   571.50), SIMDE_FLOAT16_VALUE(   465.25), SIMDE_FLOAT16_VALUE(  -730.50), SIMDE_FLOAT16_VALUE(    15.64),
+          SIMDE_FLOAT16_VALUE(   333.00), SIMDE_FLOAT16_VALUE(  -156.75), SIMDE_FLOAT16_VALUE(   887.50), SIMDE_FLOAT16_VALUE(   604.00) },
+      { SIMDE_FLOAT16_VALUE(   970.00), SIMDE_FLOAT16_VALUE(   753.50), SIMDE_FLOAT16_VALUE(   108.00), SIMDE_FLOAT16_VALUE(   612.50),
+          SIMDE_FLOAT16_VALUE(   503.50), SIMDE_FLOAT16_VALUE(   301.25), SIMDE_FLOAT16_VALUE(  1590.00), SIMDE_FLOAT16_VALUE(   296.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vabdq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vabdq_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -1130,6 +1284,8 @@ SIMDE_TEST_FUNC_LIST_BEGIN
 SIMDE_TEST_FUNC_LIST_ENTRY(vabds_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabdd_f64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vabdh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vabd_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabd_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabd_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabd_s8)
@@ -1137,6 +1293,7 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vabd_s16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabd_u8)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabd_u16)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vabdq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabdq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabdq_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabdq_s8)
@@ -48,6 +48,73 @@ test_simde_vabsd_s64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vabsh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(   -17.14),
+      SIMDE_FLOAT16_VALUE(    17.14) },
+    { SIMDE_FLOAT16_VALUE(   623.00),
+      SIMDE_FLOAT16_VALUE(   623.00) },
+    { SIMDE_FLOAT16_VALUE(   999.00),
+      SIMDE_FLOAT16_VALUE(   999.00) },
+    { SIMDE_FLOAT16_VALUE(  -955.00),
+      SIMDE_FLOAT16_VALUE(   955.00) },
+    { SIMDE_FLOAT16_VALUE(  -590.50),
+      SIMDE_FLOAT16_VALUE(   590.50) },
+    { SIMDE_FLOAT16_VALUE(   431.50),
+      SIMDE_FLOAT16_VALUE(   431.50) },
+    { SIMDE_FLOAT16_VALUE(   585.50),
+      SIMDE_FLOAT16_VALUE(   585.50) },
+    { SIMDE_FLOAT16_VALUE(  -322.25),
+      SIMDE_FLOAT16_VALUE(   322.25) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vabsh_f16(test_vec[i].a);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vabs_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   747.00), SIMDE_FLOAT16_VALUE(   124.38), SIMDE_FLOAT16_VALUE(  -591.00), SIMDE_FLOAT16_VALUE(   202.38) },
+      { SIMDE_FLOAT16_VALUE(   747.00), SIMDE_FLOAT16_VALUE(   124.38), SIMDE_FLOAT16_VALUE(   591.00), SIMDE_FLOAT16_VALUE(   202.38) } },
+    { { SIMDE_FLOAT16_VALUE(   609.50), SIMDE_FLOAT16_VALUE(  -128.50), SIMDE_FLOAT16_VALUE(   832.50), SIMDE_FLOAT16_VALUE(   877.50) },
+      { SIMDE_FLOAT16_VALUE(   609.50), SIMDE_FLOAT16_VALUE(   128.50), SIMDE_FLOAT16_VALUE(   832.50), SIMDE_FLOAT16_VALUE(   877.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -533.50), SIMDE_FLOAT16_VALUE(   806.50), SIMDE_FLOAT16_VALUE(  -681.00), SIMDE_FLOAT16_VALUE(   857.00) },
+      { SIMDE_FLOAT16_VALUE(   533.50), SIMDE_FLOAT16_VALUE(   806.50), SIMDE_FLOAT16_VALUE(   681.00), SIMDE_FLOAT16_VALUE(   857.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -413.00), SIMDE_FLOAT16_VALUE(   369.00), SIMDE_FLOAT16_VALUE(  -675.00), SIMDE_FLOAT16_VALUE(  -678.00) },
+      { SIMDE_FLOAT16_VALUE(   413.00), SIMDE_FLOAT16_VALUE(   369.00), SIMDE_FLOAT16_VALUE(   675.00), SIMDE_FLOAT16_VALUE(   678.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -148.88), SIMDE_FLOAT16_VALUE(   -15.97), SIMDE_FLOAT16_VALUE(   664.00), SIMDE_FLOAT16_VALUE(    86.19) },
+      { SIMDE_FLOAT16_VALUE(   148.88), SIMDE_FLOAT16_VALUE(    15.97), SIMDE_FLOAT16_VALUE(   664.00), SIMDE_FLOAT16_VALUE(    86.19) } },
+    { { SIMDE_FLOAT16_VALUE(  -952.00), SIMDE_FLOAT16_VALUE(  -275.25), SIMDE_FLOAT16_VALUE(  -611.00), SIMDE_FLOAT16_VALUE(    39.72) },
+      { SIMDE_FLOAT16_VALUE(   952.00), SIMDE_FLOAT16_VALUE(   275.25), SIMDE_FLOAT16_VALUE(   611.00), SIMDE_FLOAT16_VALUE(    39.72) } },
+    { { SIMDE_FLOAT16_VALUE(  -685.50), SIMDE_FLOAT16_VALUE(  -791.00), SIMDE_FLOAT16_VALUE(  -829.00), SIMDE_FLOAT16_VALUE(  -369.25) },
+      { SIMDE_FLOAT16_VALUE(   685.50), SIMDE_FLOAT16_VALUE(   791.00), SIMDE_FLOAT16_VALUE(   829.00), SIMDE_FLOAT16_VALUE(   369.25) } },
+    { { SIMDE_FLOAT16_VALUE(  -711.00), SIMDE_FLOAT16_VALUE(   126.88), SIMDE_FLOAT16_VALUE(   815.50), SIMDE_FLOAT16_VALUE(  -210.75) },
+      { SIMDE_FLOAT16_VALUE(   711.00), SIMDE_FLOAT16_VALUE(   126.88), SIMDE_FLOAT16_VALUE(   815.50), SIMDE_FLOAT16_VALUE(   210.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t r = simde_vabs_f16(a);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vabs_f32 (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -252,6 +319,56 @@ test_simde_vabs_s64 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_vabsq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   266.00), SIMDE_FLOAT16_VALUE(   723.00), SIMDE_FLOAT16_VALUE(   237.00), SIMDE_FLOAT16_VALUE(   471.75),
+          SIMDE_FLOAT16_VALUE(   352.25), SIMDE_FLOAT16_VALUE(   492.00), SIMDE_FLOAT16_VALUE(   727.50), SIMDE_FLOAT16_VALUE(  -306.00) },
+      { SIMDE_FLOAT16_VALUE(   266.00), SIMDE_FLOAT16_VALUE(   723.00), SIMDE_FLOAT16_VALUE(   237.00), SIMDE_FLOAT16_VALUE(   471.75),
+          SIMDE_FLOAT16_VALUE(   352.25), SIMDE_FLOAT16_VALUE(   492.00), SIMDE_FLOAT16_VALUE(   727.50), SIMDE_FLOAT16_VALUE(   306.00) } },
+    { { SIMDE_FLOAT16_VALUE(   772.00), SIMDE_FLOAT16_VALUE(  -317.00), SIMDE_FLOAT16_VALUE(    65.19), SIMDE_FLOAT16_VALUE(  -813.50),
+          SIMDE_FLOAT16_VALUE(  -600.50), SIMDE_FLOAT16_VALUE(  -447.00), SIMDE_FLOAT16_VALUE(  -468.50), SIMDE_FLOAT16_VALUE(   720.00) },
+      { SIMDE_FLOAT16_VALUE(   772.00), SIMDE_FLOAT16_VALUE(   317.00), SIMDE_FLOAT16_VALUE(    65.19), SIMDE_FLOAT16_VALUE(   813.50),
+          SIMDE_FLOAT16_VALUE(   600.50), SIMDE_FLOAT16_VALUE(   447.00), SIMDE_FLOAT16_VALUE(   468.50), SIMDE_FLOAT16_VALUE(   720.00) } },
+    { { SIMDE_FLOAT16_VALUE(   847.00), SIMDE_FLOAT16_VALUE(  -139.50), SIMDE_FLOAT16_VALUE(    -5.49), SIMDE_FLOAT16_VALUE(  -301.50),
+          SIMDE_FLOAT16_VALUE(   378.25), SIMDE_FLOAT16_VALUE(  -126.88), SIMDE_FLOAT16_VALUE(   -69.00), SIMDE_FLOAT16_VALUE(   827.50) },
+      { SIMDE_FLOAT16_VALUE(   847.00), SIMDE_FLOAT16_VALUE(   139.50), SIMDE_FLOAT16_VALUE(     5.49), SIMDE_FLOAT16_VALUE(   301.50),
+          SIMDE_FLOAT16_VALUE(   378.25), SIMDE_FLOAT16_VALUE(   126.88), SIMDE_FLOAT16_VALUE(    69.00), SIMDE_FLOAT16_VALUE(   827.50) } },
+    { { SIMDE_FLOAT16_VALUE(   972.00), SIMDE_FLOAT16_VALUE(  -650.50), SIMDE_FLOAT16_VALUE(  -965.00), SIMDE_FLOAT16_VALUE(   195.12),
+          SIMDE_FLOAT16_VALUE(  -512.50), SIMDE_FLOAT16_VALUE(   502.00), SIMDE_FLOAT16_VALUE(  -487.75), SIMDE_FLOAT16_VALUE(   405.75) },
+      { SIMDE_FLOAT16_VALUE(   972.00), SIMDE_FLOAT16_VALUE(   650.50), SIMDE_FLOAT16_VALUE(   965.00), SIMDE_FLOAT16_VALUE(   195.12),
+          SIMDE_FLOAT16_VALUE(   512.50), SIMDE_FLOAT16_VALUE(   502.00), SIMDE_FLOAT16_VALUE(   487.75), SIMDE_FLOAT16_VALUE(   405.75) } },
+    { { SIMDE_FLOAT16_VALUE(   -16.03), SIMDE_FLOAT16_VALUE(   936.50), SIMDE_FLOAT16_VALUE(    85.69), SIMDE_FLOAT16_VALUE(   425.50),
+          SIMDE_FLOAT16_VALUE(   517.00), SIMDE_FLOAT16_VALUE(   171.38), SIMDE_FLOAT16_VALUE(   -39.66), SIMDE_FLOAT16_VALUE(   773.00) },
+      { SIMDE_FLOAT16_VALUE(    16.03), SIMDE_FLOAT16_VALUE(   936.50), SIMDE_FLOAT16_VALUE(    85.69), SIMDE_FLOAT16_VALUE(   425.50),
+          SIMDE_FLOAT16_VALUE(   517.00), SIMDE_FLOAT16_VALUE(   171.38), SIMDE_FLOAT16_VALUE(    39.66), SIMDE_FLOAT16_VALUE(   773.00) } },
+    { { SIMDE_FLOAT16_VALUE(   401.00), SIMDE_FLOAT16_VALUE(   588.00), SIMDE_FLOAT16_VALUE(    76.06), SIMDE_FLOAT16_VALUE(  -453.25),
+          SIMDE_FLOAT16_VALUE(   271.50), SIMDE_FLOAT16_VALUE(  -925.00), SIMDE_FLOAT16_VALUE(   238.75), SIMDE_FLOAT16_VALUE(   496.50) },
+      { SIMDE_FLOAT16_VALUE(   401.00), SIMDE_FLOAT16_VALUE(   588.00), SIMDE_FLOAT16_VALUE(    76.06), SIMDE_FLOAT16_VALUE(   453.25),
+          SIMDE_FLOAT16_VALUE(   271.50), SIMDE_FLOAT16_VALUE(   925.00), SIMDE_FLOAT16_VALUE(   238.75), SIMDE_FLOAT16_VALUE(   496.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -832.50), SIMDE_FLOAT16_VALUE(  -645.50), SIMDE_FLOAT16_VALUE(  -786.50), SIMDE_FLOAT16_VALUE(  -418.00),
+          SIMDE_FLOAT16_VALUE(  -961.00), SIMDE_FLOAT16_VALUE(  -439.25), SIMDE_FLOAT16_VALUE(  -818.00), SIMDE_FLOAT16_VALUE(   301.75) },
+      { SIMDE_FLOAT16_VALUE(   832.50), SIMDE_FLOAT16_VALUE(   645.50), SIMDE_FLOAT16_VALUE(   786.50), SIMDE_FLOAT16_VALUE(   418.00),
+          SIMDE_FLOAT16_VALUE(   961.00), SIMDE_FLOAT16_VALUE(   439.25), SIMDE_FLOAT16_VALUE(   818.00), SIMDE_FLOAT16_VALUE(   301.75) } },
+    { { SIMDE_FLOAT16_VALUE(  -208.25), SIMDE_FLOAT16_VALUE(  -101.81), SIMDE_FLOAT16_VALUE(   355.00), SIMDE_FLOAT16_VALUE(   909.00),
+          SIMDE_FLOAT16_VALUE(   -46.28), SIMDE_FLOAT16_VALUE(   121.12), SIMDE_FLOAT16_VALUE(   388.75), SIMDE_FLOAT16_VALUE(   596.00) },
+      { SIMDE_FLOAT16_VALUE(   208.25), SIMDE_FLOAT16_VALUE(   101.81), SIMDE_FLOAT16_VALUE(   355.00), SIMDE_FLOAT16_VALUE(   909.00),
+          SIMDE_FLOAT16_VALUE(    46.28), SIMDE_FLOAT16_VALUE(   121.12), SIMDE_FLOAT16_VALUE(   388.75), SIMDE_FLOAT16_VALUE(   596.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t r = simde_vabsq_f16(a);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vabsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -472,6 +589,8 @@ test_simde_vabsq_s64 (SIMDE_MUNIT_TEST_ARGS) {
 SIMDE_TEST_FUNC_LIST_BEGIN
 SIMDE_TEST_FUNC_LIST_ENTRY(vabsd_s64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vabsh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vabs_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabs_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabs_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabs_s8)
@@ -479,6 +598,7 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vabs_s16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabs_s32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabs_s64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vabsq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabsq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabsq_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vabsq_s8)
@@ -71,7 +71,19 @@ test_simde_vaddv_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT8_C( 102),  INT8_C(  12), -INT8_C(  52), -INT8_C( 119),  INT8_C(  34), -INT8_C(  72), -INT8_C( 100),  INT8_C(  58) },
        INT8_C( 119) },
     { {  INT8_C(  48), -INT8_C(  20),  INT8_C(  31),  INT8_C( 105),  INT8_C(  47), -INT8_C( 101),  INT8_C( 125),  INT8_C(   1) },
-      -INT8_C(  20) }
+      -INT8_C(  20) },
+    { {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT8_C(   0) },
+    { {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      -INT8_C(   8) },
+    { {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      -INT8_C(   4) },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN },
+           INT8_MIN },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX },
+           INT8_MAX },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C( 127) },
+       INT8_C( 122) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -117,7 +129,19 @@ test_simde_vaddv_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT16_C( 22039),  INT16_C( 13492), -INT16_C(   268),  INT16_C( 11183) },
        INT16_C(  2368) },
     { { -INT16_C( 27545),  INT16_C( 27793), -INT16_C(  1802),  INT16_C( 19758) },
-       INT16_C( 18204) }
+       INT16_C( 18204) },
+    { {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+       INT16_C(    0) },
+    { {       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX },
+      -INT16_C(    4) },
+    { {       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX },
+      -INT16_C(    2) },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MIN },
+            INT16_MIN },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MAX },
+            INT16_MAX },
+    { { -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(32767) },
+       INT16_C(32766) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -163,7 +187,19 @@ test_simde_vaddv_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT32_C(  1001643638), -INT32_C(   563698122) },
       -INT32_C(  1565341760) },
     { {  INT32_C(  1971156114), -INT32_C(    33265231) },
-       INT32_C(  1937890883) }
+       INT32_C(  1937890883) },
+    { {            INT32_MIN,            INT32_MIN },
+       INT32_C(         0) },
+    { {            INT32_MAX,            INT32_MAX },
+      -INT32_C(         2) },
+    { {            INT32_MIN,            INT32_MAX },
+      -INT32_C(         1) },
+    { {  INT32_C(         0),            INT32_MIN },
+                 INT32_MIN },
+    { {  INT32_C(         0),            INT32_MAX },
+                 INT32_MAX },
+    { { -INT32_C(         1), -INT32_C(2147483647) },
+                 INT32_MIN }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -209,7 +245,19 @@ test_simde_vaddv_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C(  2), UINT8_C(229),    UINT8_MAX, UINT8_C(238), UINT8_C( 10), UINT8_C( 17), UINT8_C(108), UINT8_C(163) },
       UINT8_C(254) },
     { { UINT8_C(160), UINT8_C( 96), UINT8_C(238), UINT8_C(152), UINT8_C( 87), UINT8_C( 54), UINT8_C( 88), UINT8_C( 72) },
-      UINT8_C(179) }
+      UINT8_C(179) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      UINT8_C( 248) },
+    { { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX },
+      UINT8_C( 252) },
+    { { UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 128) },
+      UINT8_C( 249) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX, UINT8_C(   0) },
+      UINT8_C( 249) },
+    { { UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C( 254) },
+      UINT8_C(   5) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -255,7 +303,19 @@ test_simde_vaddv_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C(22847), UINT16_C(14561), UINT16_C(45692), UINT16_C(65489) },
       UINT16_C(17517) },
     { { UINT16_C(  881), UINT16_C(26586), UINT16_C(64910), UINT16_C(44496) },
-      UINT16_C( 5801) }
+      UINT16_C( 5801) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      UINT16_C(65532) },
+    { { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      UINT16_C(65534) },
+    { { UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32768) },
+      UINT16_C(65533) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      UINT16_C(65533) },
+    { { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(65534) },
+      UINT16_C(    1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -301,7 +361,19 @@ test_simde_vaddv_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(4252220829), UINT32_C(3822027214) },
       UINT32_C(3779280747) },
     { { UINT32_C(1334118506), UINT32_C(3034436882) },
-      UINT32_C(  73588092) }
+      UINT32_C(  73588092) },
+    { {           UINT32_MAX,           UINT32_MAX },
+      UINT32_C(4294967294) },
+    { { UINT32_C(         0), UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         0),           UINT32_MAX },
+                UINT32_MAX },
+    { { UINT32_C(2147483647), UINT32_C(2147483648) },
+                UINT32_MAX },
+    { {           UINT32_MAX, UINT32_C(         0) },
+                UINT32_MAX },
+    { { UINT32_C(         1), UINT32_C(4294967294) },
+                UINT32_MAX }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -447,7 +519,25 @@ test_simde_vaddvq_s8 (SIMDE_MUNIT_TEST_ARGS) {
       -INT8_C( 119) },
     { {  INT8_C(   0),  INT8_C(   8), -INT8_C(  33),  INT8_C(  53),  INT8_C(  40), -INT8_C( 107), -INT8_C(  56), -INT8_C(  53),
          INT8_C(  78),  INT8_C(  49), -INT8_C(  74), -INT8_C(  22), -INT8_C(   8), -INT8_C(   5), -INT8_C( 102), -INT8_C(  81) },
-      -INT8_C(  57) }
+      -INT8_C(  57) },
+    { {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT8_C(   0) },
+    { {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      -INT8_C(  16) },
+    { {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+             INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      -INT8_C(   8) },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN },
+           INT8_MIN },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX },
+           INT8_MAX },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C( 127) },
+       INT8_C( 114) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -493,7 +583,19 @@ test_simde_vaddvq_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT16_C(  6067), -INT16_C(  2695),  INT16_C( 32246),  INT16_C(   649), -INT16_C( 12459), -INT16_C( 26788), -INT16_C(  5030), -INT16_C(  7143) },
       -INT16_C( 27287) },
     { {  INT16_C( 24897), -INT16_C(  7232),  INT16_C(  4982), -INT16_C(  4799),  INT16_C( 29459), -INT16_C(  6571),  INT16_C( 11968),  INT16_C(  3525) },
-      -INT16_C(  9307) }
+      -INT16_C(  9307) },
+    { {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+       INT16_C(    0) },
+    { {       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX },
+      -INT16_C(    8) },
+    { {       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX },
+      -INT16_C(    4) },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MIN },
+            INT16_MIN },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MAX },
+            INT16_MAX },
+    { { -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(32767) },
+       INT16_C(32762) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -539,7 +641,19 @@ test_simde_vaddvq_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT32_C(  1856264835),  INT32_C(  1794381375), -INT32_C(  1212722151),  INT32_C(  2043998103) },
        INT32_C(   186954866) },
     { {  INT32_C(  1623861962), -INT32_C(  1630506533), -INT32_C(  1291889915),  INT32_C(  1460280788) },
-       INT32_C(   161746302) }
+       INT32_C(   161746302) },
+    { {            INT32_MIN,            INT32_MIN,            INT32_MIN,            INT32_MIN },
+       INT32_C(         0) },
+    { {            INT32_MAX,            INT32_MAX,            INT32_MAX,            INT32_MAX },
+      -INT32_C(         4) },
+    { {            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX },
+      -INT32_C(         2) },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),            INT32_MIN },
+                 INT32_MIN },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),            INT32_MAX },
+                 INT32_MAX },
+    { { -INT32_C(         1), -INT32_C(         1), -INT32_C(         1), -INT32_C(2147483647) },
+       INT32_C(2147483646) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -585,7 +699,19 @@ test_simde_vaddvq_s64 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT64_C( 1630249770841798095),  INT64_C(  740594489963636933) },
       -INT64_C(  889655280878161162) },
     { {  INT64_C( 3135157520517692338), -INT64_C( 7644798362971640413) },
-      -INT64_C( 4509640842453948075) }
+      -INT64_C( 4509640842453948075) },
+    { {                     INT64_MIN,                     INT64_MIN },
+       INT64_C(                  0) },
+    { {                     INT64_MAX,                     INT64_MAX },
+      -INT64_C(                  2) },
+    { {                     INT64_MIN,                     INT64_MAX },
+      -INT64_C(                  1) },
+    { {  INT64_C(                  0),                     INT64_MIN },
+                          INT64_MIN },
+    { {  INT64_C(                  0),                     INT64_MAX },
+                          INT64_MAX },
+    { { -INT64_C(                  1), -INT64_C(9223372036854775807) },
+                          INT64_MIN }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -639,7 +765,25 @@ test_simde_vaddvq_u8 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C(103) },
     { { UINT8_C( 86), UINT8_C(113), UINT8_C(232), UINT8_C(235), UINT8_C(142), UINT8_C(248), UINT8_C( 74), UINT8_C(101),
         UINT8_C( 82), UINT8_C(131), UINT8_C( 63), UINT8_C(158), UINT8_C(200), UINT8_C(129), UINT8_C( 39), UINT8_C(188) },
-      UINT8_C(173) }
+      UINT8_C(173) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      UINT8_C( 240) },
+    { { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0),
+        UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX,
+        UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX },
+      UINT8_C( 248) },
+    { { UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127),
+        UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 128) },
+      UINT8_C( 241) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX, UINT8_C(   0) },
+      UINT8_C( 241) },
+    { { UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1),
+        UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C( 254) },
+      UINT8_C(  13) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -685,7 +829,19 @@ test_simde_vaddvq_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C( 5451), UINT16_C(47164), UINT16_C( 1906), UINT16_C(60236), UINT16_C( 7736), UINT16_C(41839), UINT16_C(23967), UINT16_C(10757) },
       UINT16_C( 2448) },
     { { UINT16_C( 4774), UINT16_C(40291), UINT16_C(29394), UINT16_C(60374), UINT16_C(26184), UINT16_C(37162), UINT16_C(64771), UINT16_C(20189) },
-      UINT16_C(20995) }
+      UINT16_C(20995) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+      UINT16_C(65528) },
+    { { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      UINT16_C(65532) },
+    { { UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32768) },
+      UINT16_C(65529) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      UINT16_C(65529) },
+    { { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(65534) },
+      UINT16_C(    5) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -731,7 +887,19 @@ test_simde_vaddvq_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(2258372305), UINT32_C(2652590629), UINT32_C(3094466034), UINT32_C(2973938815) },
       UINT32_C(2389433191) },
     { { UINT32_C( 163159883), UINT32_C(3437712170), UINT32_C(2303582014), UINT32_C(3444150524) },
-      UINT32_C( 758669999) }
+      UINT32_C( 758669999) },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX },
+      UINT32_C(4294967292) },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(         0),           UINT32_MAX },
+      UINT32_C(4294967294) },
+    { { UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483648) },
+      UINT32_C(4294967293) },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX, UINT32_C(         0) },
+      UINT32_C(4294967293) },
+    { { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(4294967294) },
+      UINT32_C(         1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -777,7 +945,19 @@ test_simde_vaddvq_u64 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT64_C(18007214092850648434), UINT64_C( 2563546366726353735) },
       UINT64_C( 2124016385867450553) },
     { { UINT64_C(11499667444815211940), UINT64_C(  252455085538152398) },
-      UINT64_C(11752122530353364338) }
+      UINT64_C(11752122530353364338) },
+    { {                     UINT64_MAX,                     UINT64_MAX },
+      UINT64_C(18446744073709551614) },
+    { { UINT64_C(                  0), UINT64_C(                  0) },
+      UINT64_C(                  0) },
+    { { UINT64_C(                  0),                     UINT64_MAX },
+                          UINT64_MAX },
+    { { UINT64_C(9223372036854775807), UINT64_C(9223372036854775808) },
+                          UINT64_MAX },
+    { {                     UINT64_MAX, UINT64_C(                  0) },
+                          UINT64_MAX },
+    { { UINT64_C(                  1), UINT64_C(18446744073709551614) },
+                          UINT64_MAX }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
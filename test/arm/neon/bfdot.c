@@ -0,0 +1,120 @@
+#define SIMDE_TEST_ARM_NEON_INSN bfdot
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/bfdot.h"
+#include "../../../simde/arm/neon/reinterpret.h"
+
+static int
+test_simde_vbfdot_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 r_[2];
+    uint16_t a[4];
+    uint16_t b[4];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   182.5000), SIMDE_FLOAT32_C(   403.7500) },
+      { UINT16_C(16416), UINT16_C(16464), UINT16_C(49344), UINT16_C(49232) },
+      { UINT16_C(16192), UINT16_C(49384), UINT16_C(16432), UINT16_C(16512) },
+      { SIMDE_FLOAT32_C(   160.8125), SIMDE_FLOAT32_C(   374.2500) } },
+    { { SIMDE_FLOAT32_C(   283.0000), SIMDE_FLOAT32_C(    94.0000) },
+      { UINT16_C(49200), UINT16_C(16520), UINT16_C(49168), UINT16_C(49296) },
+      { UINT16_C(16352), UINT16_C(16384), UINT16_C(49376), UINT16_C(16128) },
+      { SIMDE_FLOAT32_C(   286.6875), SIMDE_FLOAT32_C(   107.5000) } },
+    { { SIMDE_FLOAT32_C(  -152.5000), SIMDE_FLOAT32_C(  -822.2500) },
+      { UINT16_C(16632), UINT16_C(48896), UINT16_C(16496), UINT16_C(16584) },
+      { UINT16_C(16320), UINT16_C(49056), UINT16_C(16320), UINT16_C(49184) },
+      { SIMDE_FLOAT32_C(  -140.2500), SIMDE_FLOAT32_C(  -832.2500) } },
+    { { SIMDE_FLOAT32_C(  -770.2500), SIMDE_FLOAT32_C(  -233.7500) },
+      { UINT16_C(49376), UINT16_C(49120), UINT16_C(49320), UINT16_C(16576) },
+      { UINT16_C(16640), UINT16_C(49384), UINT16_C(16616), UINT16_C(16640) },
+      { SIMDE_FLOAT32_C(  -813.5625), SIMDE_FLOAT32_C(  -223.8125) } },
+    { { SIMDE_FLOAT32_C(  -684.5000), SIMDE_FLOAT32_C(  -610.5000) },
+      { UINT16_C(16432), UINT16_C(16616), UINT16_C(16352), UINT16_C(16400) },
+      { UINT16_C(49248), UINT16_C(49312), UINT16_C(49280), UINT16_C(49088) },
+      { SIMDE_FLOAT32_C(  -730.3750), SIMDE_FLOAT32_C(  -620.8750) } },
+    { { SIMDE_FLOAT32_C(   483.7500), SIMDE_FLOAT32_C(  -925.2500) },
+      { UINT16_C(16592), UINT16_C(16520), UINT16_C(49296), UINT16_C(49408) },
+      { UINT16_C(16352), UINT16_C(49368), UINT16_C(49320), UINT16_C(16416) },
+      { SIMDE_FLOAT32_C(   466.4375), SIMDE_FLOAT32_C(  -921.6250) } },
+    { { SIMDE_FLOAT32_C(   -44.0000), SIMDE_FLOAT32_C(   821.0000) },
+      { UINT16_C(49368), UINT16_C(49304), UINT16_C(16352), UINT16_C(49392) },
+      { UINT16_C(16352), UINT16_C(49088), UINT16_C(16400), UINT16_C(49120) },
+      { SIMDE_FLOAT32_C(   -48.6875), SIMDE_FLOAT32_C(   838.0625) } },
+    { { SIMDE_FLOAT32_C(  -605.7500), SIMDE_FLOAT32_C(  -413.2500) },
+      { UINT16_C(16192), UINT16_C(16384), UINT16_C(16576), UINT16_C(49288) },
+      { UINT16_C(16128), UINT16_C(49232), UINT16_C(49216), UINT16_C(16192) },
+      { SIMDE_FLOAT32_C(  -611.8750), SIMDE_FLOAT32_C(  -434.4375) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t r_ = simde_vld1_f32(test_vec[i].r_);
+    simde_bfloat16x4_t a = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].a));
+    simde_bfloat16x4_t b = simde_vreinterpret_bf16_u16(simde_vld1_u16(test_vec[i].b));
+    simde_float32x2_t r = simde_vbfdot_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vbfdotq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -765.7500), SIMDE_FLOAT32_C(  -969.0000), SIMDE_FLOAT32_C(   962.5000), SIMDE_FLOAT32_C(   275.7500) },
+      { UINT16_C(49304), UINT16_C(49088), UINT16_C(16448), UINT16_C(16384), UINT16_C(16128), UINT16_C(49248), UINT16_C(16256), UINT16_C(48768) },
+      { UINT16_C(49200), UINT16_C(49336), UINT16_C(16352), UINT16_C(16432), UINT16_C(16576), UINT16_C(49360), UINT16_C(49280), UINT16_C(49384) },
+      { SIMDE_FLOAT32_C(  -744.0625), SIMDE_FLOAT32_C(  -958.2500), SIMDE_FLOAT32_C(   988.2500), SIMDE_FLOAT32_C(   273.5625) } },
+    { { SIMDE_FLOAT32_C(   -36.0000), SIMDE_FLOAT32_C(   849.7500), SIMDE_FLOAT32_C(   383.2500), SIMDE_FLOAT32_C(  -896.7500) },
+      { UINT16_C(49304), UINT16_C(16520), UINT16_C(49360), UINT16_C(49320), UINT16_C(16560), UINT16_C(16528), UINT16_C(49184), UINT16_C(16584) },
+      { UINT16_C(16464), UINT16_C(16352), UINT16_C(16416), UINT16_C(49120), UINT16_C(49328), UINT16_C(16600), UINT16_C(49280), UINT16_C(49320) },
+      { SIMDE_FLOAT32_C(   -44.0000), SIMDE_FLOAT32_C(   842.6875), SIMDE_FLOAT32_C(   383.3750), SIMDE_FLOAT32_C(  -919.5625) } },
+    { { SIMDE_FLOAT32_C(   664.5000), SIMDE_FLOAT32_C(   643.0000), SIMDE_FLOAT32_C(   883.5000), SIMDE_FLOAT32_C(   430.5000) },
+      { UINT16_C(16600), UINT16_C(49312), UINT16_C(16592), UINT16_C(16352), UINT16_C(16600), UINT16_C(16608), UINT16_C(48960), UINT16_C(49024) },
+      { UINT16_C(49248), UINT16_C(16000), UINT16_C(16480), UINT16_C(16528), UINT16_C(49168), UINT16_C(16416), UINT16_C(16400), UINT16_C(16592) },
+      { SIMDE_FLOAT32_C(   639.6250), SIMDE_FLOAT32_C(   673.6250), SIMDE_FLOAT32_C(   885.8125), SIMDE_FLOAT32_C(   422.3125) } },
+    { { SIMDE_FLOAT32_C(    -1.7500), SIMDE_FLOAT32_C(  -938.2500), SIMDE_FLOAT32_C(  -866.2500), SIMDE_FLOAT32_C(   -26.7500) },
+      { UINT16_C(49296), UINT16_C(16448), UINT16_C(16616), UINT16_C(16600), UINT16_C(49200), UINT16_C(16256), UINT16_C(16448), UINT16_C(49280) },
+      { UINT16_C(49304), UINT16_C(16536), UINT16_C(49304), UINT16_C(16400), UINT16_C(49336), UINT16_C(16320), UINT16_C(16600), UINT16_C(16536) },
+      { SIMDE_FLOAT32_C(    33.8750), SIMDE_FLOAT32_C(  -957.5000), SIMDE_FLOAT32_C(  -848.9375), SIMDE_FLOAT32_C(   -25.5000) } },
+    { { SIMDE_FLOAT32_C(   209.2500), SIMDE_FLOAT32_C(  -153.5000), SIMDE_FLOAT32_C(  -511.5000), SIMDE_FLOAT32_C(   271.5000) },
+      { UINT16_C(48768), UINT16_C(49216), UINT16_C(16616), UINT16_C(16520), UINT16_C(49344), UINT16_C(16432), UINT16_C(49088), UINT16_C(16568) },
+      { UINT16_C(16568), UINT16_C(16432), UINT16_C(48896), UINT16_C(49184), UINT16_C(49336), UINT16_C(16624), UINT16_C(49296), UINT16_C(16600) },
+      { SIMDE_FLOAT32_C(   199.5625), SIMDE_FLOAT32_C(  -167.7500), SIMDE_FLOAT32_C(  -456.3750), SIMDE_FLOAT32_C(   317.0625) } },
+    { { SIMDE_FLOAT32_C(  -333.7500), SIMDE_FLOAT32_C(   136.7500), SIMDE_FLOAT32_C(  -800.2500), SIMDE_FLOAT32_C(   683.5000) },
+      { UINT16_C(16576), UINT16_C(49184), UINT16_C(16352), UINT16_C(16536), UINT16_C(49344), UINT16_C(49304), UINT16_C(16512), UINT16_C(16400) },
+      { UINT16_C(16632), UINT16_C(49352), UINT16_C(49320), UINT16_C(49056), UINT16_C(49264), UINT16_C(49408), UINT16_C(49248), UINT16_C(49232) },
+      { SIMDE_FLOAT32_C(  -271.6250), SIMDE_FLOAT32_C(   121.6250), SIMDE_FLOAT32_C(  -739.7500), SIMDE_FLOAT32_C(   662.1875) } },
+    { { SIMDE_FLOAT32_C(   -72.5000), SIMDE_FLOAT32_C(    88.0000), SIMDE_FLOAT32_C(  -403.2500), SIMDE_FLOAT32_C(  -201.5000) },
+      { UINT16_C(16584), UINT16_C(49120), UINT16_C(49088), UINT16_C(16384), UINT16_C(16320), UINT16_C(16320), UINT16_C(16568), UINT16_C(16448) },
+      { UINT16_C(49320), UINT16_C(49400), UINT16_C(16536), UINT16_C(49280), UINT16_C(16288), UINT16_C(49352), UINT16_C(16496), UINT16_C(49360) },
+      { SIMDE_FLOAT32_C(   -91.7500), SIMDE_FLOAT32_C(    72.8750), SIMDE_FLOAT32_C(  -410.7500), SIMDE_FLOAT32_C(  -199.4375) } },
+    { { SIMDE_FLOAT32_C(  -998.5000), SIMDE_FLOAT32_C(   440.2500), SIMDE_FLOAT32_C(   146.7500), SIMDE_FLOAT32_C(   680.7500) },
+      { UINT16_C(16464), UINT16_C(49296), UINT16_C(16256), UINT16_C(49384), UINT16_C(48896), UINT16_C(16568), UINT16_C(16528), UINT16_C(16384) },
+      { UINT16_C(16512), UINT16_C(16536), UINT16_C(16512), UINT16_C(16568), UINT16_C(49056), UINT16_C(49184), UINT16_C(16608), UINT16_C(49264) },
+      { SIMDE_FLOAT32_C( -1006.8750), SIMDE_FLOAT32_C(   402.5625), SIMDE_FLOAT32_C(   133.0000), SIMDE_FLOAT32_C(   704.7500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r = simde_vbfdotq_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vbfdot_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vbfdotq_f32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,65 @@
+#define SIMDE_TEST_ARM_NEON_INSN bfmmla
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/bfmmla.h"
+#include "../../../simde/arm/neon/reinterpret.h"
+
+static int
+test_simde_vbfmmlaq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 r_[4];
+    uint16_t a[8];
+    uint16_t b[8];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -614.7500), SIMDE_FLOAT32_C(   137.5000), SIMDE_FLOAT32_C(  -212.5000), SIMDE_FLOAT32_C(   727.0000) },
+      { UINT16_C(16480), UINT16_C(16552), UINT16_C(49232), UINT16_C(16256), UINT16_C(49280), UINT16_C(49264), UINT16_C(49400), UINT16_C(49336) },
+      { UINT16_C(49392), UINT16_C(49248), UINT16_C(16624), UINT16_C(16568), UINT16_C(49264), UINT16_C(49328), UINT16_C(49264), UINT16_C(16552) },
+      { SIMDE_FLOAT32_C(  -678.0000), SIMDE_FLOAT32_C(   112.9375), SIMDE_FLOAT32_C(  -260.5625), SIMDE_FLOAT32_C(   761.5000) } },
+    { { SIMDE_FLOAT32_C(   761.5000), SIMDE_FLOAT32_C(   -66.2500), SIMDE_FLOAT32_C(   830.0000), SIMDE_FLOAT32_C(   615.5000) },
+      { UINT16_C(16560), UINT16_C(49168), UINT16_C(16592), UINT16_C(16560), UINT16_C(16584), UINT16_C(16520), UINT16_C(16464), UINT16_C(49024) },
+      { UINT16_C(49168), UINT16_C(16560), UINT16_C(49408), UINT16_C(16632), UINT16_C(48896), UINT16_C(16640), UINT16_C(16128), UINT16_C(16544) },
+      { SIMDE_FLOAT32_C(   727.3750), SIMDE_FLOAT32_C(   -56.2500), SIMDE_FLOAT32_C(   805.5625), SIMDE_FLOAT32_C(   643.0000) } },
+    { { SIMDE_FLOAT32_C(   897.5000), SIMDE_FLOAT32_C(   118.5000), SIMDE_FLOAT32_C(   180.2500), SIMDE_FLOAT32_C(  -248.5000) },
+      { UINT16_C(49376), UINT16_C(49376), UINT16_C(16616), UINT16_C(16496), UINT16_C(49296), UINT16_C(16616), UINT16_C(49328), UINT16_C(49248) },
+      { UINT16_C(16192), UINT16_C(16600), UINT16_C(49328), UINT16_C(49320), UINT16_C(48768), UINT16_C(16608), UINT16_C(49336), UINT16_C(16352) },
+      { SIMDE_FLOAT32_C(   785.4375), SIMDE_FLOAT32_C(    36.1250), SIMDE_FLOAT32_C(   274.4375), SIMDE_FLOAT32_C(  -171.1250) } },
+    { { SIMDE_FLOAT32_C(   255.5000), SIMDE_FLOAT32_C(  -892.0000), SIMDE_FLOAT32_C(   850.5000), SIMDE_FLOAT32_C(  -296.5000) },
+      { UINT16_C(49400), UINT16_C(16608), UINT16_C(16592), UINT16_C(16608), UINT16_C(16416), UINT16_C(16552), UINT16_C(16464), UINT16_C(16288) },
+      { UINT16_C(16288), UINT16_C(49200), UINT16_C(49376), UINT16_C(16320), UINT16_C(16000), UINT16_C(49352), UINT16_C(16608), UINT16_C(49200) },
+      { SIMDE_FLOAT32_C(   191.5625), SIMDE_FLOAT32_C(  -911.4375), SIMDE_FLOAT32_C(   818.3125), SIMDE_FLOAT32_C(  -309.3750) } },
+    { { SIMDE_FLOAT32_C(   173.0000), SIMDE_FLOAT32_C(  -894.5000), SIMDE_FLOAT32_C(   344.0000), SIMDE_FLOAT32_C(  -402.5000) },
+      { UINT16_C(49384), UINT16_C(16256), UINT16_C(16624), UINT16_C(49328), UINT16_C(49280), UINT16_C(16640), UINT16_C(49336), UINT16_C(16192) },
+      { UINT16_C(    0), UINT16_C(49280), UINT16_C(16192), UINT16_C(16192), UINT16_C(    0), UINT16_C(49400), UINT16_C(49296), UINT16_C(49184) },
+      { SIMDE_FLOAT32_C(   170.5000), SIMDE_FLOAT32_C(  -922.2500), SIMDE_FLOAT32_C(   308.2500), SIMDE_FLOAT32_C(  -440.5000) } },
+    { { SIMDE_FLOAT32_C(   863.7500), SIMDE_FLOAT32_C(   211.7500), SIMDE_FLOAT32_C(   513.2500), SIMDE_FLOAT32_C(  -690.5000) },
+      { UINT16_C(16584), UINT16_C(16496), UINT16_C(49184), UINT16_C(16000), UINT16_C(48896), UINT16_C(16624), UINT16_C(49168), UINT16_C(49376) },
+      { UINT16_C(16432), UINT16_C(49328), UINT16_C(49248), UINT16_C(49232), UINT16_C(16632), UINT16_C(16544), UINT16_C(16520), UINT16_C(48896) },
+      { SIMDE_FLOAT32_C(   868.2500), SIMDE_FLOAT32_C(   268.1875), SIMDE_FLOAT32_C(   501.2500), SIMDE_FLOAT32_C(  -662.9375) } },
+    { { SIMDE_FLOAT32_C(   353.0000), SIMDE_FLOAT32_C(   -98.7500), SIMDE_FLOAT32_C(   486.7500), SIMDE_FLOAT32_C(   305.7500) },
+      { UINT16_C(49200), UINT16_C(49088), UINT16_C(16448), UINT16_C(49360), UINT16_C(16000), UINT16_C(49296), UINT16_C(49360), UINT16_C(49200) },
+      { UINT16_C(16600), UINT16_C(16536), UINT16_C(16608), UINT16_C(16320), UINT16_C(16608), UINT16_C(48960), UINT16_C(16512), UINT16_C(16520) },
+      { SIMDE_FLOAT32_C(   338.5625), SIMDE_FLOAT32_C(  -132.5000), SIMDE_FLOAT32_C(   417.4375), SIMDE_FLOAT32_C(   273.1875) } },
+    { { SIMDE_FLOAT32_C(   -28.2500), SIMDE_FLOAT32_C(  -462.2500), SIMDE_FLOAT32_C(  -702.7500), SIMDE_FLOAT32_C(    86.2500) },
+      { UINT16_C(16568), UINT16_C(49400), UINT16_C(16256), UINT16_C(16584), UINT16_C(16512), UINT16_C(16384), UINT16_C(49368), UINT16_C(49312) },
+      { UINT16_C(16464), UINT16_C(16568), UINT16_C(16128), UINT16_C(16416), UINT16_C(16128), UINT16_C(16128), UINT16_C(49312), UINT16_C(    0) },
+      { SIMDE_FLOAT32_C(   -38.0000), SIMDE_FLOAT32_C(  -468.2500), SIMDE_FLOAT32_C(  -694.1250), SIMDE_FLOAT32_C(   123.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r_ = simde_vld1q_f32(test_vec[i].r_);
+    simde_bfloat16x8_t a = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].a));
+    simde_bfloat16x8_t b = simde_vreinterpretq_bf16_u16(simde_vld1q_u16(test_vec[i].b));
+    simde_float32x4_t r = simde_vbfmmlaq_f32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vbfmmlaq_f32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -30,7 +30,15 @@ test_simde_vcls_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT8_C(   4), -INT8_C(  27), -INT8_C(   1), -INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3), -INT8_C(   3) },
       {  INT8_C(   5),  INT8_C(   2),  INT8_C(   7),  INT8_C(   4),  INT8_C(   7),  INT8_C(   7),  INT8_C(   5),  INT8_C(   5) } },
     { {  INT8_C(   2), -INT8_C(   2), -INT8_C(  12), -INT8_C(   1),  INT8_C(   1),  INT8_C(   3), -INT8_C(   3),  INT8_C(   1) },
-      {  INT8_C(   5),  INT8_C(   6),  INT8_C(   3),  INT8_C(   7),  INT8_C(   6),  INT8_C(   5),  INT8_C(   5),  INT8_C(   6) } }
+      {  INT8_C(   5),  INT8_C(   6),  INT8_C(   3),  INT8_C(   7),  INT8_C(   6),  INT8_C(   5),  INT8_C(   5),  INT8_C(   6) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8) },
+      {  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3) } },
+    { {  INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1) } },
+    { { -INT8_C(   2), -INT8_C(   4), -INT8_C(   8), -INT8_C(  16), -INT8_C(  32), -INT8_C(  64), -INT8_C(   3), -INT8_C(   5) },
+      {  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   5),  INT8_C(   4) } },
+    { { -INT8_C(   9), -INT8_C(  17), -INT8_C(  33), -INT8_C(  65),  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX },
+      {  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -81,7 +89,37 @@ test_simde_vcls_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT16_C(    16), -INT16_C(     7),  INT16_C(     1),  INT16_C(    16) },
       {  INT16_C(    11),  INT16_C(    12),  INT16_C(    14),  INT16_C(    10) } },
     { { -INT16_C(     2), -INT16_C(     1), -INT16_C(     1), -INT16_C(    15) },
-      {  INT16_C(    14),  INT16_C(    15),  INT16_C(    15),  INT16_C(    11) } }
+      {  INT16_C(    14),  INT16_C(    15),  INT16_C(    15),  INT16_C(    11) } },
+    { {  INT16_C(     0), -INT16_C(     1),        INT16_MIN,        INT16_MAX },
+      {  INT16_C(    15),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C(     1),  INT16_C(     2),  INT16_C(     4),  INT16_C(     8) },
+      {  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11) } },
+    { {  INT16_C(    16),  INT16_C(    32),  INT16_C(    64),  INT16_C(   128) },
+      {  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7) } },
+    { {  INT16_C(   256),  INT16_C(   512),  INT16_C(  1024),  INT16_C(  2048) },
+      {  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3) } },
+    { {  INT16_C(  4096),  INT16_C(  8192),  INT16_C( 16384),  INT16_C(     3) },
+      {  INT16_C(     2),  INT16_C(     1),  INT16_C(     0),  INT16_C(    13) } },
+    { {  INT16_C(     7),  INT16_C(    15),  INT16_C(    31),  INT16_C(    63) },
+      {  INT16_C(    12),  INT16_C(    11),  INT16_C(    10),  INT16_C(     9) } },
+    { {  INT16_C(   127),  INT16_C(   255),  INT16_C(   511),  INT16_C(  1023) },
+      {  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5) } },
+    { {  INT16_C(  2047),  INT16_C(  4095),  INT16_C(  8191),  INT16_C( 16383) },
+      {  INT16_C(     4),  INT16_C(     3),  INT16_C(     2),  INT16_C(     1) } },
+    { { -INT16_C(     2), -INT16_C(     4), -INT16_C(     8), -INT16_C(    16) },
+      {  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11) } },
+    { { -INT16_C(    32), -INT16_C(    64), -INT16_C(   128), -INT16_C(   256) },
+      {  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7) } },
+    { { -INT16_C(   512), -INT16_C(  1024), -INT16_C(  2048), -INT16_C(  4096) },
+      {  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3) } },
+    { { -INT16_C(  8192), -INT16_C( 16384), -INT16_C(     3), -INT16_C(     5) },
+      {  INT16_C(     2),  INT16_C(     1),  INT16_C(    13),  INT16_C(    12) } },
+    { { -INT16_C(     9), -INT16_C(    17), -INT16_C(    33), -INT16_C(    65) },
+      {  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8) } },
+    { { -INT16_C(   129), -INT16_C(   257), -INT16_C(   513), -INT16_C(  1025) },
+      {  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4) } },
+    { { -INT16_C(  2049), -INT16_C(  4097), -INT16_C(  8193), -INT16_C( 16385) },
+      {  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(     0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -132,7 +170,133 @@ test_simde_vcls_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT32_C(   137743468), -INT32_C(     5881742) },
       {  INT32_C(           3),  INT32_C(           8) } },
     { { -INT32_C(     5524402), -INT32_C(       25465) },
-      {  INT32_C(           8),  INT32_C(          16) } }
+      {  INT32_C(           8),  INT32_C(          16) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(          31),  INT32_C(          31) } },
+    { {              INT32_MIN,              INT32_MAX },
+      {  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(           1),  INT32_C(           2) },
+      {  INT32_C(          30),  INT32_C(          29) } },
+    { {  INT32_C(           4),  INT32_C(           8) },
+      {  INT32_C(          28),  INT32_C(          27) } },
+    { {  INT32_C(          16),  INT32_C(          32) },
+      {  INT32_C(          26),  INT32_C(          25) } },
+    { {  INT32_C(          64),  INT32_C(         128) },
+      {  INT32_C(          24),  INT32_C(          23) } },
+    { {  INT32_C(         256),  INT32_C(         512) },
+      {  INT32_C(          22),  INT32_C(          21) } },
+    { {  INT32_C(        1024),  INT32_C(        2048) },
+      {  INT32_C(          20),  INT32_C(          19) } },
+    { {  INT32_C(        4096),  INT32_C(        8192) },
+      {  INT32_C(          18),  INT32_C(          17) } },
+    { {  INT32_C(       16384),  INT32_C(       32768) },
+      {  INT32_C(          16),  INT32_C(          15) } },
+    { {  INT32_C(       65536),  INT32_C(      131072) },
+      {  INT32_C(          14),  INT32_C(          13) } },
+    { {  INT32_C(      262144),  INT32_C(      524288) },
+      {  INT32_C(          12),  INT32_C(          11) } },
+    { {  INT32_C(     1048576),  INT32_C(     2097152) },
+      {  INT32_C(          10),  INT32_C(           9) } },
+    { {  INT32_C(     4194304),  INT32_C(     8388608) },
+      {  INT32_C(           8),  INT32_C(           7) } },
+    { {  INT32_C(    16777216),  INT32_C(    33554432) },
+      {  INT32_C(           6),  INT32_C(           5) } },
+    { {  INT32_C(    67108864),  INT32_C(   134217728) },
+      {  INT32_C(           4),  INT32_C(           3) } },
+    { {  INT32_C(   268435456),  INT32_C(   536870912) },
+      {  INT32_C(           2),  INT32_C(           1) } },
+    { {  INT32_C(  1073741824),  INT32_C(           3) },
+      {  INT32_C(           0),  INT32_C(          29) } },
+    { {  INT32_C(           7),  INT32_C(          15) },
+      {  INT32_C(          28),  INT32_C(          27) } },
+    { {  INT32_C(          31),  INT32_C(          63) },
+      {  INT32_C(          26),  INT32_C(          25) } },
+    { {  INT32_C(         127),  INT32_C(         255) },
+      {  INT32_C(          24),  INT32_C(          23) } },
+    { {  INT32_C(         511),  INT32_C(        1023) },
+      {  INT32_C(          22),  INT32_C(          21) } },
+    { {  INT32_C(        2047),  INT32_C(        4095) },
+      {  INT32_C(          20),  INT32_C(          19) } },
+    { {  INT32_C(        8191),  INT32_C(       16383) },
+      {  INT32_C(          18),  INT32_C(          17) } },
+    { {  INT32_C(       32767),  INT32_C(       65535) },
+      {  INT32_C(          16),  INT32_C(          15) } },
+    { {  INT32_C(      131071),  INT32_C(      262143) },
+      {  INT32_C(          14),  INT32_C(          13) } },
+    { {  INT32_C(      524287),  INT32_C(     1048575) },
+      {  INT32_C(          12),  INT32_C(          11) } },
+    { {  INT32_C(     2097151),  INT32_C(     4194303) },
+      {  INT32_C(          10),  INT32_C(           9) } },
+    { {  INT32_C(     8388607),  INT32_C(    16777215) },
+      {  INT32_C(           8),  INT32_C(           7) } },
+    { {  INT32_C(    33554431),  INT32_C(    67108863) },
+      {  INT32_C(           6),  INT32_C(           5) } },
+    { {  INT32_C(   134217727),  INT32_C(   268435455) },
+      {  INT32_C(           4),  INT32_C(           3) } },
+    { {  INT32_C(   536870911),  INT32_C(  1073741823) },
+      {  INT32_C(           2),  INT32_C(           1) } },
+    { { -INT32_C(           2), -INT32_C(           4) },
+      {  INT32_C(          30),  INT32_C(          29) } },
+    { { -INT32_C(           8), -INT32_C(          16) },
+      {  INT32_C(          28),  INT32_C(          27) } },
+    { { -INT32_C(          32), -INT32_C(          64) },
+      {  INT32_C(          26),  INT32_C(          25) } },
+    { { -INT32_C(         128), -INT32_C(         256) },
+      {  INT32_C(          24),  INT32_C(          23) } },
+    { { -INT32_C(         512), -INT32_C(        1024) },
+      {  INT32_C(          22),  INT32_C(          21) } },
+    { { -INT32_C(        2048), -INT32_C(        4096) },
+      {  INT32_C(          20),  INT32_C(          19) } },
+    { { -INT32_C(        8192), -INT32_C(       16384) },
+      {  INT32_C(          18),  INT32_C(          17) } },
+    { { -INT32_C(       32768), -INT32_C(       65536) },
+      {  INT32_C(          16),  INT32_C(          15) } },
+    { { -INT32_C(      131072), -INT32_C(      262144) },
+      {  INT32_C(          14),  INT32_C(          13) } },
+    { { -INT32_C(      524288), -INT32_C(     1048576) },
+      {  INT32_C(          12),  INT32_C(          11) } },
+    { { -INT32_C(     2097152), -INT32_C(     4194304) },
+      {  INT32_C(          10),  INT32_C(           9) } },
+    { { -INT32_C(     8388608), -INT32_C(    16777216) },
+      {  INT32_C(           8),  INT32_C(           7) } },
+    { { -INT32_C(    33554432), -INT32_C(    67108864) },
+      {  INT32_C(           6),  INT32_C(           5) } },
+    { { -INT32_C(   134217728), -INT32_C(   268435456) },
+      {  INT32_C(           4),  INT32_C(           3) } },
+    { { -INT32_C(   536870912), -INT32_C(  1073741824) },
+      {  INT32_C(           2),  INT32_C(           1) } },
+    { { -INT32_C(           3), -INT32_C(           5) },
+      {  INT32_C(          29),  INT32_C(          28) } },
+    { { -INT32_C(           9), -INT32_C(          17) },
+      {  INT32_C(          27),  INT32_C(          26) } },
+    { { -INT32_C(          33), -INT32_C(          65) },
+      {  INT32_C(          25),  INT32_C(          24) } },
+    { { -INT32_C(         129), -INT32_C(         257) },
+      {  INT32_C(          23),  INT32_C(          22) } },
+    { { -INT32_C(         513), -INT32_C(        1025) },
+      {  INT32_C(          21),  INT32_C(          20) } },
+    { { -INT32_C(        2049), -INT32_C(        4097) },
+      {  INT32_C(          19),  INT32_C(          18) } },
+    { { -INT32_C(        8193), -INT32_C(       16385) },
+      {  INT32_C(          17),  INT32_C(          16) } },
+    { { -INT32_C(       32769), -INT32_C(       65537) },
+      {  INT32_C(          15),  INT32_C(          14) } },
+    { { -INT32_C(      131073), -INT32_C(      262145) },
+      {  INT32_C(          13),  INT32_C(          12) } },
+    { { -INT32_C(      524289), -INT32_C(     1048577) },
+      {  INT32_C(          11),  INT32_C(          10) } },
+    { { -INT32_C(     2097153), -INT32_C(     4194305) },
+      {  INT32_C(           9),  INT32_C(           8) } },
+    { { -INT32_C(     8388609), -INT32_C(    16777217) },
+      {  INT32_C(           7),  INT32_C(           6) } },
+    { { -INT32_C(    33554433), -INT32_C(    67108865) },
+      {  INT32_C(           5),  INT32_C(           4) } },
+    { { -INT32_C(   134217729), -INT32_C(   268435457) },
+      {  INT32_C(           3),  INT32_C(           2) } },
+    { { -INT32_C(   536870913), -INT32_C(  1073741825) },
+      {  INT32_C(           1),  INT32_C(           0) } },
+    { { -INT32_C(  2147483647),  INT32_C(  2147483646) },
+      {  INT32_C(           0),  INT32_C(           0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -187,7 +351,15 @@ test_simde_vcls_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C(  1), UINT8_C( 27), UINT8_C(  4), UINT8_C(162), UINT8_C( 29), UINT8_C(  3), UINT8_C( 15), UINT8_C( 84) },
       {  INT8_C(   6),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   2),  INT8_C(   5),  INT8_C(   3),  INT8_C(   0) } },
     { { UINT8_C(  0), UINT8_C( 41), UINT8_C( 59), UINT8_C(  3), UINT8_C(  2), UINT8_C(181), UINT8_C( 45), UINT8_C(121) },
-      {  INT8_C(   7),  INT8_C(   1),  INT8_C(   1),  INT8_C(   5),  INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0) } }
+      {  INT8_C(   7),  INT8_C(   1),  INT8_C(   1),  INT8_C(   5),  INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8) },
+      {  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3) } },
+    { { UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      {  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1) } },
+    { { UINT8_C(254), UINT8_C(252), UINT8_C(248), UINT8_C(240), UINT8_C(224), UINT8_C(192), UINT8_C(253), UINT8_C(251) },
+      {  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   5),  INT8_C(   4) } },
+    { { UINT8_C(247), UINT8_C(239), UINT8_C(223), UINT8_C(191), UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127) },
+      {  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -238,7 +410,37 @@ test_simde_vcls_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C( 2122), UINT16_C(  480), UINT16_C(  402), UINT16_C(   27) },
       {  INT16_C(     3),  INT16_C(     6),  INT16_C(     6),  INT16_C(    10) } },
     { { UINT16_C(    2), UINT16_C(  239), UINT16_C( 7107), UINT16_C(   89) },
-      {  INT16_C(    13),  INT16_C(     7),  INT16_C(     2),  INT16_C(     8) } }
+      {  INT16_C(    13),  INT16_C(     7),  INT16_C(     2),  INT16_C(     8) } },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(32768), UINT16_C(32767) },
+      {  INT16_C(    15),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0) } },
+    { { UINT16_C(    1), UINT16_C(    2), UINT16_C(    4), UINT16_C(    8) },
+      {  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11) } },
+    { { UINT16_C(   16), UINT16_C(   32), UINT16_C(   64), UINT16_C(  128) },
+      {  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7) } },
+    { { UINT16_C(  256), UINT16_C(  512), UINT16_C( 1024), UINT16_C( 2048) },
+      {  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3) } },
+    { { UINT16_C( 4096), UINT16_C( 8192), UINT16_C(16384), UINT16_C(    3) },
+      {  INT16_C(     2),  INT16_C(     1),  INT16_C(     0),  INT16_C(    13) } },
+    { { UINT16_C(    7), UINT16_C(   15), UINT16_C(   31), UINT16_C(   63) },
+      {  INT16_C(    12),  INT16_C(    11),  INT16_C(    10),  INT16_C(     9) } },
+    { { UINT16_C(  127), UINT16_C(  255), UINT16_C(  511), UINT16_C( 1023) },
+      {  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5) } },
+    { { UINT16_C( 2047), UINT16_C( 4095), UINT16_C( 8191), UINT16_C(16383) },
+      {  INT16_C(     4),  INT16_C(     3),  INT16_C(     2),  INT16_C(     1) } },
+    { { UINT16_C(65534), UINT16_C(65532), UINT16_C(65528), UINT16_C(65520) },
+      {  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11) } },
+    { { UINT16_C(65504), UINT16_C(65472), UINT16_C(65408), UINT16_C(65280) },
+      {  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7) } },
+    { { UINT16_C(65024), UINT16_C(64512), UINT16_C(63488), UINT16_C(61440) },
+      {  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3) } },
+    { { UINT16_C(57344), UINT16_C(49152), UINT16_C(65533), UINT16_C(65531) },
+      {  INT16_C(     2),  INT16_C(     1),  INT16_C(    13),  INT16_C(    12) } },
+    { { UINT16_C(65527), UINT16_C(65519), UINT16_C(65503), UINT16_C(65471) },
+      {  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8) } },
+    { { UINT16_C(65407), UINT16_C(65279), UINT16_C(65023), UINT16_C(64511) },
+      {  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4) } },
+    { { UINT16_C(63487), UINT16_C(61439), UINT16_C(57343), UINT16_C(49151) },
+      {  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(     0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -289,7 +491,133 @@ test_simde_vcls_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(   7030603), UINT32_C( 245915039) },
       {  INT32_C(           8),  INT32_C(           3) } },
     { { UINT32_C(        25), UINT32_C(   2041698) },
-      {  INT32_C(          26),  INT32_C(          10) } }
+      {  INT32_C(          26),  INT32_C(          10) } },
+    { { UINT32_C(         0),           UINT32_MAX },
+      {  INT32_C(          31),  INT32_C(          31) } },
+    { { UINT32_C(2147483648), UINT32_C(2147483647) },
+      {  INT32_C(           0),  INT32_C(           0) } },
+    { { UINT32_C(         1), UINT32_C(         2) },
+      {  INT32_C(          30),  INT32_C(          29) } },
+    { { UINT32_C(         4), UINT32_C(         8) },
+      {  INT32_C(          28),  INT32_C(          27) } },
+    { { UINT32_C(        16), UINT32_C(        32) },
+      {  INT32_C(          26),  INT32_C(          25) } },
+    { { UINT32_C(        64), UINT32_C(       128) },
+      {  INT32_C(          24),  INT32_C(          23) } },
+    { { UINT32_C(       256), UINT32_C(       512) },
+      {  INT32_C(          22),  INT32_C(          21) } },
+    { { UINT32_C(      1024), UINT32_C(      2048) },
+      {  INT32_C(          20),  INT32_C(          19) } },
+    { { UINT32_C(      4096), UINT32_C(      8192) },
+      {  INT32_C(          18),  INT32_C(          17) } },
+    { { UINT32_C(     16384), UINT32_C(     32768) },
+      {  INT32_C(          16),  INT32_C(          15) } },
+    { { UINT32_C(     65536), UINT32_C(    131072) },
+      {  INT32_C(          14),  INT32_C(          13) } },
+    { { UINT32_C(    262144), UINT32_C(    524288) },
+      {  INT32_C(          12),  INT32_C(          11) } },
+    { { UINT32_C(   1048576), UINT32_C(   2097152) },
+      {  INT32_C(          10),  INT32_C(           9) } },
+    { { UINT32_C(   4194304), UINT32_C(   8388608) },
+      {  INT32_C(           8),  INT32_C(           7) } },
+    { { UINT32_C(  16777216), UINT32_C(  33554432) },
+      {  INT32_C(           6),  INT32_C(           5) } },
+    { { UINT32_C(  67108864), UINT32_C( 134217728) },
+      {  INT32_C(           4),  INT32_C(           3) } },
+    { { UINT32_C( 268435456), UINT32_C( 536870912) },
+      {  INT32_C(           2),  INT32_C(           1) } },
+    { { UINT32_C(1073741824), UINT32_C(         3) },
+      {  INT32_C(           0),  INT32_C(          29) } },
+    { { UINT32_C(         7), UINT32_C(        15) },
+      {  INT32_C(          28),  INT32_C(          27) } },
+    { { UINT32_C(        31), UINT32_C(        63) },
+      {  INT32_C(          26),  INT32_C(          25) } },
+    { { UINT32_C(       127), UINT32_C(       255) },
+      {  INT32_C(          24),  INT32_C(          23) } },
+    { { UINT32_C(       511), UINT32_C(      1023) },
+      {  INT32_C(          22),  INT32_C(          21) } },
+    { { UINT32_C(      2047), UINT32_C(      4095) },
+      {  INT32_C(          20),  INT32_C(          19) } },
+    { { UINT32_C(      8191), UINT32_C(     16383) },
+      {  INT32_C(          18),  INT32_C(          17) } },
+    { { UINT32_C(     32767), UINT32_C(     65535) },
+      {  INT32_C(          16),  INT32_C(          15) } },
+    { { UINT32_C(    131071), UINT32_C(    262143) },
+      {  INT32_C(          14),  INT32_C(          13) } },
+    { { UINT32_C(    524287), UINT32_C(   1048575) },
+      {  INT32_C(          12),  INT32_C(          11) } },
+    { { UINT32_C(   2097151), UINT32_C(   4194303) },
+      {  INT32_C(          10),  INT32_C(           9) } },
+    { { UINT32_C(   8388607), UINT32_C(  16777215) },
+      {  INT32_C(           8),  INT32_C(           7) } },
+    { { UINT32_C(  33554431), UINT32_C(  67108863) },
+      {  INT32_C(           6),  INT32_C(           5) } },
+    { { UINT32_C( 134217727), UINT32_C( 268435455) },
+      {  INT32_C(           4),  INT32_C(           3) } },
+    { { UINT32_C( 536870911), UINT32_C(1073741823) },
+      {  INT32_C(           2),  INT32_C(           1) } },
+    { { UINT32_C(4294967294), UINT32_C(4294967292) },
+      {  INT32_C(          30),  INT32_C(          29) } },
+    { { UINT32_C(4294967288), UINT32_C(4294967280) },
+      {  INT32_C(          28),  INT32_C(          27) } },
+    { { UINT32_C(4294967264), UINT32_C(4294967232) },
+      {  INT32_C(          26),  INT32_C(          25) } },
+    { { UINT32_C(4294967168), UINT32_C(4294967040) },
+      {  INT32_C(          24),  INT32_C(          23) } },
+    { { UINT32_C(4294966784), UINT32_C(4294966272) },
+      {  INT32_C(          22),  INT32_C(          21) } },
+    { { UINT32_C(4294965248), UINT32_C(4294963200) },
+      {  INT32_C(          20),  INT32_C(          19) } },
+    { { UINT32_C(4294959104), UINT32_C(4294950912) },
+      {  INT32_C(          18),  INT32_C(          17) } },
+    { { UINT32_C(4294934528), UINT32_C(4294901760) },
+      {  INT32_C(          16),  INT32_C(          15) } },
+    { { UINT32_C(4294836224), UINT32_C(4294705152) },
+      {  INT32_C(          14),  INT32_C(          13) } },
+    { { UINT32_C(4294443008), UINT32_C(4293918720) },
+      {  INT32_C(          12),  INT32_C(          11) } },
+    { { UINT32_C(4292870144), UINT32_C(4290772992) },
+      {  INT32_C(          10),  INT32_C(           9) } },
+    { { UINT32_C(4286578688), UINT32_C(4278190080) },
+      {  INT32_C(           8),  INT32_C(           7) } },
+    { { UINT32_C(4261412864), UINT32_C(4227858432) },
+      {  INT32_C(           6),  INT32_C(           5) } },
+    { { UINT32_C(4160749568), UINT32_C(4026531840) },
+      {  INT32_C(           4),  INT32_C(           3) } },
+    { { UINT32_C(3758096384), UINT32_C(3221225472) },
+      {  INT32_C(           2),  INT32_C(           1) } },
+    { { UINT32_C(4294967293), UINT32_C(4294967291) },
+      {  INT32_C(          29),  INT32_C(          28) } },
+    { { UINT32_C(4294967287), UINT32_C(4294967279) },
+      {  INT32_C(          27),  INT32_C(          26) } },
+    { { UINT32_C(4294967263), UINT32_C(4294967231) },
+      {  INT32_C(          25),  INT32_C(          24) } },
+    { { UINT32_C(4294967167), UINT32_C(4294967039) },
+      {  INT32_C(          23),  INT32_C(          22) } },
+    { { UINT32_C(4294966783), UINT32_C(4294966271) },
+      {  INT32_C(          21),  INT32_C(          20) } },
+    { { UINT32_C(4294965247), UINT32_C(4294963199) },
+      {  INT32_C(          19),  INT32_C(          18) } },
+    { { UINT32_C(4294959103), UINT32_C(4294950911) },
+      {  INT32_C(          17),  INT32_C(          16) } },
+    { { UINT32_C(4294934527), UINT32_C(4294901759) },
+      {  INT32_C(          15),  INT32_C(          14) } },
+    { { UINT32_C(4294836223), UINT32_C(4294705151) },
+      {  INT32_C(          13),  INT32_C(          12) } },
+    { { UINT32_C(4294443007), UINT32_C(4293918719) },
+      {  INT32_C(          11),  INT32_C(          10) } },
+    { { UINT32_C(4292870143), UINT32_C(4290772991) },
+      {  INT32_C(           9),  INT32_C(           8) } },
+    { { UINT32_C(4286578687), UINT32_C(4278190079) },
+      {  INT32_C(           7),  INT32_C(           6) } },
+    { { UINT32_C(4261412863), UINT32_C(4227858431) },
+      {  INT32_C(           5),  INT32_C(           4) } },
+    { { UINT32_C(4160749567), UINT32_C(4026531839) },
+      {  INT32_C(           3),  INT32_C(           2) } },
+    { { UINT32_C(3758096383), UINT32_C(3221225471) },
+      {  INT32_C(           1),  INT32_C(           0) } },
+    { { UINT32_C(2147483649), UINT32_C(2147483646) },
+      {  INT32_C(           0),  INT32_C(           0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -358,7 +686,15 @@ test_simde_vclsq_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT8_C( 104), -INT8_C(  17), -INT8_C(  28), -INT8_C(  11), -INT8_C(  14),  INT8_C(  11),  INT8_C(   0), -INT8_C(  18),
         -INT8_C(  93), -INT8_C(  15),  INT8_C(   0), -INT8_C(   2), -INT8_C(   9),  INT8_C(  12), -INT8_C(  13),  INT8_C(  15) },
       {  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   7),  INT8_C(   2),
-         INT8_C(   0),  INT8_C(   3),  INT8_C(   7),  INT8_C(   6),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3) } }
+         INT8_C(   0),  INT8_C(   3),  INT8_C(   7),  INT8_C(   6),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8),
+         INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1) } },
+    { { -INT8_C(   2), -INT8_C(   4), -INT8_C(   8), -INT8_C(  16), -INT8_C(  32), -INT8_C(  64), -INT8_C(   3), -INT8_C(   5),
+        -INT8_C(   9), -INT8_C(  17), -INT8_C(  33), -INT8_C(  65),  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX },
+      {  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -409,7 +745,23 @@ test_simde_vclsq_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT16_C(     0),  INT16_C(  4449),  INT16_C(    28), -INT16_C(  5416), -INT16_C(     8),  INT16_C(  2848),  INT16_C(  9525),  INT16_C(     6) },
       {  INT16_C(    15),  INT16_C(     2),  INT16_C(    10),  INT16_C(     2),  INT16_C(    12),  INT16_C(     3),  INT16_C(     1),  INT16_C(    12) } },
     { { -INT16_C(   793),  INT16_C(   107),  INT16_C(   776),  INT16_C(  7301), -INT16_C( 26590), -INT16_C(    15), -INT16_C(   804),  INT16_C(    19) },
-      {  INT16_C(     5),  INT16_C(     8),  INT16_C(     5),  INT16_C(     2),  INT16_C(     0),  INT16_C(    11),  INT16_C(     5),  INT16_C(    10) } }
+      {  INT16_C(     5),  INT16_C(     8),  INT16_C(     5),  INT16_C(     2),  INT16_C(     0),  INT16_C(    11),  INT16_C(     5),  INT16_C(    10) } },
+    { {  INT16_C(     0), -INT16_C(     1),        INT16_MIN,        INT16_MAX,  INT16_C(     1),  INT16_C(     2),  INT16_C(     4),  INT16_C(     8) },
+      {  INT16_C(    15),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0),  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11) } },
+    { {  INT16_C(    16),  INT16_C(    32),  INT16_C(    64),  INT16_C(   128),  INT16_C(   256),  INT16_C(   512),  INT16_C(  1024),  INT16_C(  2048) },
+      {  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3) } },
+    { {  INT16_C(  4096),  INT16_C(  8192),  INT16_C( 16384),  INT16_C(     3),  INT16_C(     7),  INT16_C(    15),  INT16_C(    31),  INT16_C(    63) },
+      {  INT16_C(     2),  INT16_C(     1),  INT16_C(     0),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11),  INT16_C(    10),  INT16_C(     9) } },
+    { {  INT16_C(   127),  INT16_C(   255),  INT16_C(   511),  INT16_C(  1023),  INT16_C(  2047),  INT16_C(  4095),  INT16_C(  8191),  INT16_C( 16383) },
+      {  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3),  INT16_C(     2),  INT16_C(     1) } },
+    { { -INT16_C(     2), -INT16_C(     4), -INT16_C(     8), -INT16_C(    16), -INT16_C(    32), -INT16_C(    64), -INT16_C(   128), -INT16_C(   256) },
+      {  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7) } },
+    { { -INT16_C(   512), -INT16_C(  1024), -INT16_C(  2048), -INT16_C(  4096), -INT16_C(  8192), -INT16_C( 16384), -INT16_C(     3), -INT16_C(     5) },
+      {  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(    13),  INT16_C(    12) } },
+    { { -INT16_C(     9), -INT16_C(    17), -INT16_C(    33), -INT16_C(    65), -INT16_C(   129), -INT16_C(   257), -INT16_C(   513), -INT16_C(  1025) },
+      {  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4) } },
+    { { -INT16_C(  2049), -INT16_C(  4097), -INT16_C(  8193), -INT16_C( 16385),  INT16_C(     0), -INT16_C(     1),        INT16_MIN,        INT16_MAX },
+      {  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(     0),  INT16_C(    15),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -460,7 +812,71 @@ test_simde_vclsq_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT32_C(           1),  INT32_C(       55140),  INT32_C(       58632), -INT32_C(   466226226) },
       {  INT32_C(          31),  INT32_C(          15),  INT32_C(          15),  INT32_C(           2) } },
     { { -INT32_C(     1373374),  INT32_C(   542555820),  INT32_C(        1355), -INT32_C(       11555) },
-      {  INT32_C(          10),  INT32_C(           1),  INT32_C(          20),  INT32_C(          17) } }
+      {  INT32_C(          10),  INT32_C(           1),  INT32_C(          20),  INT32_C(          17) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {  INT32_C(          31),  INT32_C(          31),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(           1),  INT32_C(           2),  INT32_C(           4),  INT32_C(           8) },
+      {  INT32_C(          30),  INT32_C(          29),  INT32_C(          28),  INT32_C(          27) } },
+    { {  INT32_C(          16),  INT32_C(          32),  INT32_C(          64),  INT32_C(         128) },
+      {  INT32_C(          26),  INT32_C(          25),  INT32_C(          24),  INT32_C(          23) } },
+    { {  INT32_C(         256),  INT32_C(         512),  INT32_C(        1024),  INT32_C(        2048) },
+      {  INT32_C(          22),  INT32_C(          21),  INT32_C(          20),  INT32_C(          19) } },
+    { {  INT32_C(        4096),  INT32_C(        8192),  INT32_C(       16384),  INT32_C(       32768) },
+      {  INT32_C(          18),  INT32_C(          17),  INT32_C(          16),  INT32_C(          15) } },
+    { {  INT32_C(       65536),  INT32_C(      131072),  INT32_C(      262144),  INT32_C(      524288) },
+      {  INT32_C(          14),  INT32_C(          13),  INT32_C(          12),  INT32_C(          11) } },
+    { {  INT32_C(     1048576),  INT32_C(     2097152),  INT32_C(     4194304),  INT32_C(     8388608) },
+      {  INT32_C(          10),  INT32_C(           9),  INT32_C(           8),  INT32_C(           7) } },
+    { {  INT32_C(    16777216),  INT32_C(    33554432),  INT32_C(    67108864),  INT32_C(   134217728) },
+      {  INT32_C(           6),  INT32_C(           5),  INT32_C(           4),  INT32_C(           3) } },
+    { {  INT32_C(   268435456),  INT32_C(   536870912),  INT32_C(  1073741824),  INT32_C(           3) },
+      {  INT32_C(           2),  INT32_C(           1),  INT32_C(           0),  INT32_C(          29) } },
+    { {  INT32_C(           7),  INT32_C(          15),  INT32_C(          31),  INT32_C(          63) },
+      {  INT32_C(          28),  INT32_C(          27),  INT32_C(          26),  INT32_C(          25) } },
+    { {  INT32_C(         127),  INT32_C(         255),  INT32_C(         511),  INT32_C(        1023) },
+      {  INT32_C(          24),  INT32_C(          23),  INT32_C(          22),  INT32_C(          21) } },
+    { {  INT32_C(        2047),  INT32_C(        4095),  INT32_C(        8191),  INT32_C(       16383) },
+      {  INT32_C(          20),  INT32_C(          19),  INT32_C(          18),  INT32_C(          17) } },
+    { {  INT32_C(       32767),  INT32_C(       65535),  INT32_C(      131071),  INT32_C(      262143) },
+      {  INT32_C(          16),  INT32_C(          15),  INT32_C(          14),  INT32_C(          13) } },
+    { {  INT32_C(      524287),  INT32_C(     1048575),  INT32_C(     2097151),  INT32_C(     4194303) },
+      {  INT32_C(          12),  INT32_C(          11),  INT32_C(          10),  INT32_C(           9) } },
+    { {  INT32_C(     8388607),  INT32_C(    16777215),  INT32_C(    33554431),  INT32_C(    67108863) },
+      {  INT32_C(           8),  INT32_C(           7),  INT32_C(           6),  INT32_C(           5) } },
+    { {  INT32_C(   134217727),  INT32_C(   268435455),  INT32_C(   536870911),  INT32_C(  1073741823) },
+      {  INT32_C(           4),  INT32_C(           3),  INT32_C(           2),  INT32_C(           1) } },
+    { { -INT32_C(           2), -INT32_C(           4), -INT32_C(           8), -INT32_C(          16) },
+      {  INT32_C(          30),  INT32_C(          29),  INT32_C(          28),  INT32_C(          27) } },
+    { { -INT32_C(          32), -INT32_C(          64), -INT32_C(         128), -INT32_C(         256) },
+      {  INT32_C(          26),  INT32_C(          25),  INT32_C(          24),  INT32_C(          23) } },
+    { { -INT32_C(         512), -INT32_C(        1024), -INT32_C(        2048), -INT32_C(        4096) },
+      {  INT32_C(          22),  INT32_C(          21),  INT32_C(          20),  INT32_C(          19) } },
+    { { -INT32_C(        8192), -INT32_C(       16384), -INT32_C(       32768), -INT32_C(       65536) },
+      {  INT32_C(          18),  INT32_C(          17),  INT32_C(          16),  INT32_C(          15) } },
+    { { -INT32_C(      131072), -INT32_C(      262144), -INT32_C(      524288), -INT32_C(     1048576) },
+      {  INT32_C(          14),  INT32_C(          13),  INT32_C(          12),  INT32_C(          11) } },
+    { { -INT32_C(     2097152), -INT32_C(     4194304), -INT32_C(     8388608), -INT32_C(    16777216) },
+      {  INT32_C(          10),  INT32_C(           9),  INT32_C(           8),  INT32_C(           7) } },
+    { { -INT32_C(    33554432), -INT32_C(    67108864), -INT32_C(   134217728), -INT32_C(   268435456) },
+      {  INT32_C(           6),  INT32_C(           5),  INT32_C(           4),  INT32_C(           3) } },
+    { { -INT32_C(   536870912), -INT32_C(  1073741824), -INT32_C(           3), -INT32_C(           5) },
+      {  INT32_C(           2),  INT32_C(           1),  INT32_C(          29),  INT32_C(          28) } },
+    { { -INT32_C(           9), -INT32_C(          17), -INT32_C(          33), -INT32_C(          65) },
+      {  INT32_C(          27),  INT32_C(          26),  INT32_C(          25),  INT32_C(          24) } },
+    { { -INT32_C(         129), -INT32_C(         257), -INT32_C(         513), -INT32_C(        1025) },
+      {  INT32_C(          23),  INT32_C(          22),  INT32_C(          21),  INT32_C(          20) } },
+    { { -INT32_C(        2049), -INT32_C(        4097), -INT32_C(        8193), -INT32_C(       16385) },
+      {  INT32_C(          19),  INT32_C(          18),  INT32_C(          17),  INT32_C(          16) } },
+    { { -INT32_C(       32769), -INT32_C(       65537), -INT32_C(      131073), -INT32_C(      262145) },
+      {  INT32_C(          15),  INT32_C(          14),  INT32_C(          13),  INT32_C(          12) } },
+    { { -INT32_C(      524289), -INT32_C(     1048577), -INT32_C(     2097153), -INT32_C(     4194305) },
+      {  INT32_C(          11),  INT32_C(          10),  INT32_C(           9),  INT32_C(           8) } },
+    { { -INT32_C(     8388609), -INT32_C(    16777217), -INT32_C(    33554433), -INT32_C(    67108865) },
+      {  INT32_C(           7),  INT32_C(           6),  INT32_C(           5),  INT32_C(           4) } },
+    { { -INT32_C(   134217729), -INT32_C(   268435457), -INT32_C(   536870913), -INT32_C(  1073741825) },
+      {  INT32_C(           3),  INT32_C(           2),  INT32_C(           1),  INT32_C(           0) } },
+    { { -INT32_C(  2147483647),  INT32_C(  2147483646),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          31),  INT32_C(          31) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -529,7 +945,15 @@ test_simde_vclsq_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C( 13), UINT8_C( 16), UINT8_C( 12), UINT8_C(  6), UINT8_C(  0), UINT8_C(  3), UINT8_C(  6), UINT8_C(158),
         UINT8_C( 30), UINT8_C(125), UINT8_C(  1), UINT8_C(  0), UINT8_C(  5), UINT8_C(  3), UINT8_C(124), UINT8_C(  3) },
       {  INT8_C(   3),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4),  INT8_C(   7),  INT8_C(   5),  INT8_C(   4),  INT8_C(   0),
-         INT8_C(   2),  INT8_C(   0),  INT8_C(   6),  INT8_C(   7),  INT8_C(   4),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5) } }
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   6),  INT8_C(   7),  INT8_C(   4),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8),
+        UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      {  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1) } },
+    { { UINT8_C(254), UINT8_C(252), UINT8_C(248), UINT8_C(240), UINT8_C(224), UINT8_C(192), UINT8_C(253), UINT8_C(251),
+        UINT8_C(247), UINT8_C(239), UINT8_C(223), UINT8_C(191), UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127) },
+      {  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   7),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -580,7 +1004,23 @@ test_simde_vclsq_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C(   72), UINT16_C(    2), UINT16_C(  135), UINT16_C(   25), UINT16_C(  248), UINT16_C( 1679), UINT16_C( 3838), UINT16_C(    0) },
       {  INT16_C(     8),  INT16_C(    13),  INT16_C(     7),  INT16_C(    10),  INT16_C(     7),  INT16_C(     4),  INT16_C(     3),  INT16_C(    15) } },
     { { UINT16_C( 2263), UINT16_C(    0), UINT16_C(   11), UINT16_C(   31), UINT16_C(    3), UINT16_C(35599), UINT16_C(  313), UINT16_C( 4514) },
-      {  INT16_C(     3),  INT16_C(    15),  INT16_C(    11),  INT16_C(    10),  INT16_C(    13),  INT16_C(     0),  INT16_C(     6),  INT16_C(     2) } }
+      {  INT16_C(     3),  INT16_C(    15),  INT16_C(    11),  INT16_C(    10),  INT16_C(    13),  INT16_C(     0),  INT16_C(     6),  INT16_C(     2) } },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(32768), UINT16_C(32767), UINT16_C(    1), UINT16_C(    2), UINT16_C(    4), UINT16_C(    8) },
+      {  INT16_C(    15),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0),  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11) } },
+    { { UINT16_C(   16), UINT16_C(   32), UINT16_C(   64), UINT16_C(  128), UINT16_C(  256), UINT16_C(  512), UINT16_C( 1024), UINT16_C( 2048) },
+      {  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3) } },
+    { { UINT16_C( 4096), UINT16_C( 8192), UINT16_C(16384), UINT16_C(    3), UINT16_C(    7), UINT16_C(   15), UINT16_C(   31), UINT16_C(   63) },
+      {  INT16_C(     2),  INT16_C(     1),  INT16_C(     0),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11),  INT16_C(    10),  INT16_C(     9) } },
+    { { UINT16_C(  127), UINT16_C(  255), UINT16_C(  511), UINT16_C( 1023), UINT16_C( 2047), UINT16_C( 4095), UINT16_C( 8191), UINT16_C(16383) },
+      {  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3),  INT16_C(     2),  INT16_C(     1) } },
+    { { UINT16_C(65534), UINT16_C(65532), UINT16_C(65528), UINT16_C(65520), UINT16_C(65504), UINT16_C(65472), UINT16_C(65408), UINT16_C(65280) },
+      {  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7) } },
+    { { UINT16_C(65024), UINT16_C(64512), UINT16_C(63488), UINT16_C(61440), UINT16_C(57344), UINT16_C(49152), UINT16_C(65533), UINT16_C(65531) },
+      {  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(    13),  INT16_C(    12) } },
+    { { UINT16_C(65527), UINT16_C(65519), UINT16_C(65503), UINT16_C(65471), UINT16_C(65407), UINT16_C(65279), UINT16_C(65023), UINT16_C(64511) },
+      {  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4) } },
+    { { UINT16_C(63487), UINT16_C(61439), UINT16_C(57343), UINT16_C(49151), UINT16_C(    0),      UINT16_MAX, UINT16_C(32768), UINT16_C(32767) },
+      {  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(     0),  INT16_C(    15),  INT16_C(    15),  INT16_C(     0),  INT16_C(     0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -631,7 +1071,71 @@ test_simde_vclsq_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(       960), UINT32_C(1498788316), UINT32_C(       807), UINT32_C(       212) },
       {  INT32_C(          21),  INT32_C(           0),  INT32_C(          21),  INT32_C(          23) } },
     { { UINT32_C(        52), UINT32_C(        31), UINT32_C(       508), UINT32_C(      1422) },
-      {  INT32_C(          25),  INT32_C(          26),  INT32_C(          22),  INT32_C(          20) } }
+      {  INT32_C(          25),  INT32_C(          26),  INT32_C(          22),  INT32_C(          20) } },
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(2147483648), UINT32_C(2147483647) },
+      {  INT32_C(          31),  INT32_C(          31),  INT32_C(           0),  INT32_C(           0) } },
+    { { UINT32_C(         1), UINT32_C(         2), UINT32_C(         4), UINT32_C(         8) },
+      {  INT32_C(          30),  INT32_C(          29),  INT32_C(          28),  INT32_C(          27) } },
+    { { UINT32_C(        16), UINT32_C(        32), UINT32_C(        64), UINT32_C(       128) },
+      {  INT32_C(          26),  INT32_C(          25),  INT32_C(          24),  INT32_C(          23) } },
+    { { UINT32_C(       256), UINT32_C(       512), UINT32_C(      1024), UINT32_C(      2048) },
+      {  INT32_C(          22),  INT32_C(          21),  INT32_C(          20),  INT32_C(          19) } },
+    { { UINT32_C(      4096), UINT32_C(      8192), UINT32_C(     16384), UINT32_C(     32768) },
+      {  INT32_C(          18),  INT32_C(          17),  INT32_C(          16),  INT32_C(          15) } },
+    { { UINT32_C(     65536), UINT32_C(    131072), UINT32_C(    262144), UINT32_C(    524288) },
+      {  INT32_C(          14),  INT32_C(          13),  INT32_C(          12),  INT32_C(          11) } },
+    { { UINT32_C(   1048576), UINT32_C(   2097152), UINT32_C(   4194304), UINT32_C(   8388608) },
+      {  INT32_C(          10),  INT32_C(           9),  INT32_C(           8),  INT32_C(           7) } },
+    { { UINT32_C(  16777216), UINT32_C(  33554432), UINT32_C(  67108864), UINT32_C( 134217728) },
+      {  INT32_C(           6),  INT32_C(           5),  INT32_C(           4),  INT32_C(           3) } },
+    { { UINT32_C( 268435456), UINT32_C( 536870912), UINT32_C(1073741824), UINT32_C(         3) },
+      {  INT32_C(           2),  INT32_C(           1),  INT32_C(           0),  INT32_C(          29) } },
+    { { UINT32_C(         7), UINT32_C(        15), UINT32_C(        31), UINT32_C(        63) },
+      {  INT32_C(          28),  INT32_C(          27),  INT32_C(          26),  INT32_C(          25) } },
+    { { UINT32_C(       127), UINT32_C(       255), UINT32_C(       511), UINT32_C(      1023) },
+      {  INT32_C(          24),  INT32_C(          23),  INT32_C(          22),  INT32_C(          21) } },
+    { { UINT32_C(      2047), UINT32_C(      4095), UINT32_C(      8191), UINT32_C(     16383) },
+      {  INT32_C(          20),  INT32_C(          19),  INT32_C(          18),  INT32_C(          17) } },
+    { { UINT32_C(     32767), UINT32_C(     65535), UINT32_C(    131071), UINT32_C(    262143) },
+      {  INT32_C(          16),  INT32_C(          15),  INT32_C(          14),  INT32_C(          13) } },
+    { { UINT32_C(    524287), UINT32_C(   1048575), UINT32_C(   2097151), UINT32_C(   4194303) },
+      {  INT32_C(          12),  INT32_C(          11),  INT32_C(          10),  INT32_C(           9) } },
+    { { UINT32_C(   8388607), UINT32_C(  16777215), UINT32_C(  33554431), UINT32_C(  67108863) },
+      {  INT32_C(           8),  INT32_C(           7),  INT32_C(           6),  INT32_C(           5) } },
+    { { UINT32_C( 134217727), UINT32_C( 268435455), UINT32_C( 536870911), UINT32_C(1073741823) },
+      {  INT32_C(           4),  INT32_C(           3),  INT32_C(           2),  INT32_C(           1) } },
+    { { UINT32_C(4294967294), UINT32_C(4294967292), UINT32_C(4294967288), UINT32_C(4294967280) },
+      {  INT32_C(          30),  INT32_C(          29),  INT32_C(          28),  INT32_C(          27) } },
+    { { UINT32_C(4294967264), UINT32_C(4294967232), UINT32_C(4294967168), UINT32_C(4294967040) },
+      {  INT32_C(          26),  INT32_C(          25),  INT32_C(          24),  INT32_C(          23) } },
+    { { UINT32_C(4294966784), UINT32_C(4294966272), UINT32_C(4294965248), UINT32_C(4294963200) },
+      {  INT32_C(          22),  INT32_C(          21),  INT32_C(          20),  INT32_C(          19) } },
+    { { UINT32_C(4294959104), UINT32_C(4294950912), UINT32_C(4294934528), UINT32_C(4294901760) },
+      {  INT32_C(          18),  INT32_C(          17),  INT32_C(          16),  INT32_C(          15) } },
+    { { UINT32_C(4294836224), UINT32_C(4294705152), UINT32_C(4294443008), UINT32_C(4293918720) },
+      {  INT32_C(          14),  INT32_C(          13),  INT32_C(          12),  INT32_C(          11) } },
+    { { UINT32_C(4292870144), UINT32_C(4290772992), UINT32_C(4286578688), UINT32_C(4278190080) },
+      {  INT32_C(          10),  INT32_C(           9),  INT32_C(           8),  INT32_C(           7) } },
+    { { UINT32_C(4261412864), UINT32_C(4227858432), UINT32_C(4160749568), UINT32_C(4026531840) },
+      {  INT32_C(           6),  INT32_C(           5),  INT32_C(           4),  INT32_C(           3) } },
+    { { UINT32_C(3758096384), UINT32_C(3221225472), UINT32_C(4294967293), UINT32_C(4294967291) },
+      {  INT32_C(           2),  INT32_C(           1),  INT32_C(          29),  INT32_C(          28) } },
+    { { UINT32_C(4294967287), UINT32_C(4294967279), UINT32_C(4294967263), UINT32_C(4294967231) },
+      {  INT32_C(          27),  INT32_C(          26),  INT32_C(          25),  INT32_C(          24) } },
+    { { UINT32_C(4294967167), UINT32_C(4294967039), UINT32_C(4294966783), UINT32_C(4294966271) },
+      {  INT32_C(          23),  INT32_C(          22),  INT32_C(          21),  INT32_C(          20) } },
+    { { UINT32_C(4294965247), UINT32_C(4294963199), UINT32_C(4294959103), UINT32_C(4294950911) },
+      {  INT32_C(          19),  INT32_C(          18),  INT32_C(          17),  INT32_C(          16) } },
+    { { UINT32_C(4294934527), UINT32_C(4294901759), UINT32_C(4294836223), UINT32_C(4294705151) },
+      {  INT32_C(          15),  INT32_C(          14),  INT32_C(          13),  INT32_C(          12) } },
+    { { UINT32_C(4294443007), UINT32_C(4293918719), UINT32_C(4292870143), UINT32_C(4290772991) },
+      {  INT32_C(          11),  INT32_C(          10),  INT32_C(           9),  INT32_C(           8) } },
+    { { UINT32_C(4286578687), UINT32_C(4278190079), UINT32_C(4261412863), UINT32_C(4227858431) },
+      {  INT32_C(           7),  INT32_C(           6),  INT32_C(           5),  INT32_C(           4) } },
+    { { UINT32_C(4160749567), UINT32_C(4026531839), UINT32_C(3758096383), UINT32_C(3221225471) },
+      {  INT32_C(           3),  INT32_C(           2),  INT32_C(           1),  INT32_C(           0) } },
+    { { UINT32_C(2147483649), UINT32_C(2147483646), UINT32_C(         0),           UINT32_MAX },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          31),  INT32_C(          31) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
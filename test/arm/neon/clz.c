@@ -30,7 +30,39 @@ test_simde_x_vclzb_s8 (SIMDE_MUNIT_TEST_ARGS) {
     {  INT8_C(  48),
        INT8_C(   2) },
     {  INT8_C(  79),
-       INT8_C(   1) }
+       INT8_C(   1) },
+    {  INT8_C(   0),
+       INT8_C(   8) },
+    { -INT8_C(   1),
+       INT8_C(   0) },
+    {      INT8_MIN,
+       INT8_C(   0) },
+    {      INT8_MAX,
+       INT8_C(   1) },
+    {  INT8_C(   1),
+       INT8_C(   7) },
+    {  INT8_C(   2),
+       INT8_C(   6) },
+    {  INT8_C(   4),
+       INT8_C(   5) },
+    {  INT8_C(   8),
+       INT8_C(   4) },
+    {  INT8_C(  16),
+       INT8_C(   3) },
+    {  INT8_C(  32),
+       INT8_C(   2) },
+    {  INT8_C(  64),
+       INT8_C(   1) },
+    {  INT8_C(   3),
+       INT8_C(   6) },
+    {  INT8_C(   7),
+       INT8_C(   5) },
+    {  INT8_C(  15),
+       INT8_C(   4) },
+    {  INT8_C(  31),
+       INT8_C(   3) },
+    {  INT8_C(  63),
+       INT8_C(   2) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -86,7 +118,73 @@ test_simde_x_vclzh_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { -INT16_C( 15362),
        INT16_C(     0) },
     {  INT16_C( 14920),
-       INT16_C(     2) }
+       INT16_C(     2) },
+    {  INT16_C(     0),
+       INT16_C(    16) },
+    { -INT16_C(     1),
+       INT16_C(     0) },
+    {        INT16_MIN,
+       INT16_C(     0) },
+    {        INT16_MAX,
+       INT16_C(     1) },
+    {  INT16_C(     1),
+       INT16_C(    15) },
+    {  INT16_C(     2),
+       INT16_C(    14) },
+    {  INT16_C(     4),
+       INT16_C(    13) },
+    {  INT16_C(     8),
+       INT16_C(    12) },
+    {  INT16_C(    16),
+       INT16_C(    11) },
+    {  INT16_C(    32),
+       INT16_C(    10) },
+    {  INT16_C(    64),
+       INT16_C(     9) },
+    {  INT16_C(   128),
+       INT16_C(     8) },
+    {  INT16_C(   256),
+       INT16_C(     7) },
+    {  INT16_C(   512),
+       INT16_C(     6) },
+    {  INT16_C(  1024),
+       INT16_C(     5) },
+    {  INT16_C(  2048),
+       INT16_C(     4) },
+    {  INT16_C(  4096),
+       INT16_C(     3) },
+    {  INT16_C(  8192),
+       INT16_C(     2) },
+    {  INT16_C( 16384),
+       INT16_C(     1) },
+    {  INT16_C(     3),
+       INT16_C(    14) },
+    {  INT16_C(     7),
+       INT16_C(    13) },
+    {  INT16_C(    15),
+       INT16_C(    12) },
+    {  INT16_C(    31),
+       INT16_C(    11) },
+    {  INT16_C(    63),
+       INT16_C(    10) },
+    {  INT16_C(   127),
+       INT16_C(     9) },
+    {  INT16_C(   255),
+       INT16_C(     8) },
+    {  INT16_C(   511),
+       INT16_C(     7) },
+    {  INT16_C(  1023),
+       INT16_C(     6) },
+    {  INT16_C(  2047),
+       INT16_C(     5) },
+    {  INT16_C(  4095),
+       INT16_C(     4) },
+    {  INT16_C(  8191),
+       INT16_C(     3) },
+    {  INT16_C( 16383),
+       INT16_C(     2) },
+    { -INT16_C(   256),
+       INT16_C(     0) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -142,6 +240,142 @@ test_simde_x_vclzs_s32 (SIMDE_MUNIT_TEST_ARGS) {
     {  INT32_C(  1239879933),
        INT32_C(           1) },
     {  INT32_C(  1794325369),
+       INT32_C(           1) },
+    {  INT32_C(           0),
+       INT32_C(          32) },
+    { -INT32_C(           1),
+       INT32_C(           0) },
+    {              INT32_MIN,
+       INT32_C(           0) },
+    {              INT32_MAX,
+       INT32_C(           1) },
+    {  INT32_C(           1),
+       INT32_C(          31) },
+    {  INT32_C(           2),
+       INT32_C(          30) },
+    {  INT32_C(           4),
+       INT32_C(          29) },
+    {  INT32_C(           8),
+       INT32_C(          28) },
+    {  INT32_C(          16),
+       INT32_C(          27) },
+    {  INT32_C(          32),
+       INT32_C(          26) },
+    {  INT32_C(          64),
+       INT32_C(          25) },
+    {  INT32_C(         128),
+       INT32_C(          24) },
+    {  INT32_C(         256),
+       INT32_C(          23) },
+    {  INT32_C(         512),
+       INT32_C(          22) },
+    {  INT32_C(        1024),
+       INT32_C(          21) },
+    {  INT32_C(        2048),
+       INT32_C(          20) },
+    {  INT32_C(        4096),
+       INT32_C(          19) },
+    {  INT32_C(        8192),
+       INT32_C(          18) },
+    {  INT32_C(       16384),
+       INT32_C(          17) },
+    {  INT32_C(       32768),
+       INT32_C(          16) },
+    {  INT32_C(       65536),
+       INT32_C(          15) },
+    {  INT32_C(      131072),
+       INT32_C(          14) },
+    {  INT32_C(      262144),
+       INT32_C(          13) },
+    {  INT32_C(      524288),
+       INT32_C(          12) },
+    {  INT32_C(     1048576),
+       INT32_C(          11) },
+    {  INT32_C(     2097152),
+       INT32_C(          10) },
+    {  INT32_C(     4194304),
+       INT32_C(           9) },
+    {  INT32_C(     8388608),
+       INT32_C(           8) },
+    {  INT32_C(    16777216),
+       INT32_C(           7) },
+    {  INT32_C(    33554432),
+       INT32_C(           6) },
+    {  INT32_C(    67108864),
+       INT32_C(           5) },
+    {  INT32_C(   134217728),
+       INT32_C(           4) },
+    {  INT32_C(   268435456),
+       INT32_C(           3) },
+    {  INT32_C(   536870912),
+       INT32_C(           2) },
+    {  INT32_C(  1073741824),
+       INT32_C(           1) },
+    {  INT32_C(           3),
+       INT32_C(          30) },
+    {  INT32_C(           7),
+       INT32_C(          29) },
+    {  INT32_C(          15),
+       INT32_C(          28) },
+    {  INT32_C(          31),
+       INT32_C(          27) },
+    {  INT32_C(          63),
+       INT32_C(          26) },
+    {  INT32_C(         127),
+       INT32_C(          25) },
+    {  INT32_C(         255),
+       INT32_C(          24) },
+    {  INT32_C(         511),
+       INT32_C(          23) },
+    {  INT32_C(        1023),
+       INT32_C(          22) },
+    {  INT32_C(        2047),
+       INT32_C(          21) },
+    {  INT32_C(        4095),
+       INT32_C(          20) },
+    {  INT32_C(        8191),
+       INT32_C(          19) },
+    {  INT32_C(       16383),
+       INT32_C(          18) },
+    {  INT32_C(       32767),
+       INT32_C(          17) },
+    {  INT32_C(       65535),
+       INT32_C(          16) },
+    {  INT32_C(      131071),
+       INT32_C(          15) },
+    {  INT32_C(      262143),
+       INT32_C(          14) },
+    {  INT32_C(      524287),
+       INT32_C(          13) },
+    {  INT32_C(     1048575),
+       INT32_C(          12) },
+    {  INT32_C(     2097151),
+       INT32_C(          11) },
+    {  INT32_C(     4194303),
+       INT32_C(          10) },
+    {  INT32_C(     8388607),
+       INT32_C(           9) },
+    {  INT32_C(    16777215),
+       INT32_C(           8) },
+    {  INT32_C(    33554431),
+       INT32_C(           7) },
+    {  INT32_C(    67108863),
+       INT32_C(           6) },
+    {  INT32_C(   134217727),
+       INT32_C(           5) },
+    {  INT32_C(   268435455),
+       INT32_C(           4) },
+    {  INT32_C(   536870911),
+       INT32_C(           3) },
+    {  INT32_C(  1073741823),
+       INT32_C(           2) },
+    { -INT32_C(       65536),
+       INT32_C(           0) },
+    { -INT32_C(    16777216),
+       INT32_C(           0) },
+    { -INT32_C(  2147483647),
+       INT32_C(           0) },
+    {  INT32_C(  2147483646),
        INT32_C(           1) }
   };
 
@@ -198,7 +432,39 @@ test_simde_x_vclzb_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { UINT8_C(119),
       UINT8_C(  1) },
     { UINT8_C(181),
-      UINT8_C(  0) }
+      UINT8_C(  0) },
+    { UINT8_C(  0),
+      UINT8_C(  8) },
+    {    UINT8_MAX,
+      UINT8_C(  0) },
+    { UINT8_C(128),
+      UINT8_C(  0) },
+    { UINT8_C(127),
+      UINT8_C(  1) },
+    { UINT8_C(  1),
+      UINT8_C(  7) },
+    { UINT8_C(  2),
+      UINT8_C(  6) },
+    { UINT8_C(  4),
+      UINT8_C(  5) },
+    { UINT8_C(  8),
+      UINT8_C(  4) },
+    { UINT8_C( 16),
+      UINT8_C(  3) },
+    { UINT8_C( 32),
+      UINT8_C(  2) },
+    { UINT8_C( 64),
+      UINT8_C(  1) },
+    { UINT8_C(  3),
+      UINT8_C(  6) },
+    { UINT8_C(  7),
+      UINT8_C(  5) },
+    { UINT8_C( 15),
+      UINT8_C(  4) },
+    { UINT8_C( 31),
+      UINT8_C(  3) },
+    { UINT8_C( 63),
+      UINT8_C(  2) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -253,7 +519,73 @@ test_simde_x_vclzh_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { UINT16_C(10652),
       UINT16_C(    2) },
     { UINT16_C(15587),
-      UINT16_C(    2) }
+      UINT16_C(    2) },
+    { UINT16_C(    0),
+      UINT16_C(   16) },
+    {      UINT16_MAX,
+      UINT16_C(    0) },
+    { UINT16_C(32768),
+      UINT16_C(    0) },
+    { UINT16_C(32767),
+      UINT16_C(    1) },
+    { UINT16_C(    1),
+      UINT16_C(   15) },
+    { UINT16_C(    2),
+      UINT16_C(   14) },
+    { UINT16_C(    4),
+      UINT16_C(   13) },
+    { UINT16_C(    8),
+      UINT16_C(   12) },
+    { UINT16_C(   16),
+      UINT16_C(   11) },
+    { UINT16_C(   32),
+      UINT16_C(   10) },
+    { UINT16_C(   64),
+      UINT16_C(    9) },
+    { UINT16_C(  128),
+      UINT16_C(    8) },
+    { UINT16_C(  256),
+      UINT16_C(    7) },
+    { UINT16_C(  512),
+      UINT16_C(    6) },
+    { UINT16_C( 1024),
+      UINT16_C(    5) },
+    { UINT16_C( 2048),
+      UINT16_C(    4) },
+    { UINT16_C( 4096),
+      UINT16_C(    3) },
+    { UINT16_C( 8192),
+      UINT16_C(    2) },
+    { UINT16_C(16384),
+      UINT16_C(    1) },
+    { UINT16_C(    3),
+      UINT16_C(   14) },
+    { UINT16_C(    7),
+      UINT16_C(   13) },
+    { UINT16_C(   15),
+      UINT16_C(   12) },
+    { UINT16_C(   31),
+      UINT16_C(   11) },
+    { UINT16_C(   63),
+      UINT16_C(   10) },
+    { UINT16_C(  127),
+      UINT16_C(    9) },
+    { UINT16_C(  255),
+      UINT16_C(    8) },
+    { UINT16_C(  511),
+      UINT16_C(    7) },
+    { UINT16_C( 1023),
+      UINT16_C(    6) },
+    { UINT16_C( 2047),
+      UINT16_C(    5) },
+    { UINT16_C( 4095),
+      UINT16_C(    4) },
+    { UINT16_C( 8191),
+      UINT16_C(    3) },
+    { UINT16_C(16383),
+      UINT16_C(    2) },
+    { UINT16_C(65280),
+      UINT16_C(    0) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -309,6 +641,142 @@ test_simde_x_vclzs_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { UINT32_C(2565242795),
       UINT32_C(         0) },
     { UINT32_C(2009844024),
+      UINT32_C(         1) },
+    { UINT32_C(         0),
+      UINT32_C(        32) },
+    {           UINT32_MAX,
+      UINT32_C(         0) },
+    { UINT32_C(2147483648),
+      UINT32_C(         0) },
+    { UINT32_C(2147483647),
+      UINT32_C(         1) },
+    { UINT32_C(         1),
+      UINT32_C(        31) },
+    { UINT32_C(         2),
+      UINT32_C(        30) },
+    { UINT32_C(         4),
+      UINT32_C(        29) },
+    { UINT32_C(         8),
+      UINT32_C(        28) },
+    { UINT32_C(        16),
+      UINT32_C(        27) },
+    { UINT32_C(        32),
+      UINT32_C(        26) },
+    { UINT32_C(        64),
+      UINT32_C(        25) },
+    { UINT32_C(       128),
+      UINT32_C(        24) },
+    { UINT32_C(       256),
+      UINT32_C(        23) },
+    { UINT32_C(       512),
+      UINT32_C(        22) },
+    { UINT32_C(      1024),
+      UINT32_C(        21) },
+    { UINT32_C(      2048),
+      UINT32_C(        20) },
+    { UINT32_C(      4096),
+      UINT32_C(        19) },
+    { UINT32_C(      8192),
+      UINT32_C(        18) },
+    { UINT32_C(     16384),
+      UINT32_C(        17) },
+    { UINT32_C(     32768),
+      UINT32_C(        16) },
+    { UINT32_C(     65536),
+      UINT32_C(        15) },
+    { UINT32_C(    131072),
+      UINT32_C(        14) },
+    { UINT32_C(    262144),
+      UINT32_C(        13) },
+    { UINT32_C(    524288),
+      UINT32_C(        12) },
+    { UINT32_C(   1048576),
+      UINT32_C(        11) },
+    { UINT32_C(   2097152),
+      UINT32_C(        10) },
+    { UINT32_C(   4194304),
+      UINT32_C(         9) },
+    { UINT32_C(   8388608),
+      UINT32_C(         8) },
+    { UINT32_C(  16777216),
+      UINT32_C(         7) },
+    { UINT32_C(  33554432),
+      UINT32_C(         6) },
+    { UINT32_C(  67108864),
+      UINT32_C(         5) },
+    { UINT32_C( 134217728),
+      UINT32_C(         4) },
+    { UINT32_C( 268435456),
+      UINT32_C(         3) },
+    { UINT32_C( 536870912),
+      UINT32_C(         2) },
+    { UINT32_C(1073741824),
+      UINT32_C(         1) },
+    { UINT32_C(         3),
+      UINT32_C(        30) },
+    { UINT32_C(         7),
+      UINT32_C(        29) },
+    { UINT32_C(        15),
+      UINT32_C(        28) },
+    { UINT32_C(        31),
+      UINT32_C(        27) },
+    { UINT32_C(        63),
+      UINT32_C(        26) },
+    { UINT32_C(       127),
+      UINT32_C(        25) },
+    { UINT32_C(       255),
+      UINT32_C(        24) },
+    { UINT32_C(       511),
+      UINT32_C(        23) },
+    { UINT32_C(      1023),
+      UINT32_C(        22) },
+    { UINT32_C(      2047),
+      UINT32_C(        21) },
+    { UINT32_C(      4095),
+      UINT32_C(        20) },
+    { UINT32_C(      8191),
+      UINT32_C(        19) },
+    { UINT32_C(     16383),
+      UINT32_C(        18) },
+    { UINT32_C(     32767),
+      UINT32_C(        17) },
+    { UINT32_C(     65535),
+      UINT32_C(        16) },
+    { UINT32_C(    131071),
+      UINT32_C(        15) },
+    { UINT32_C(    262143),
+      UINT32_C(        14) },
+    { UINT32_C(    524287),
+      UINT32_C(        13) },
+    { UINT32_C(   1048575),
+      UINT32_C(        12) },
+    { UINT32_C(   2097151),
+      UINT32_C(        11) },
+    { UINT32_C(   4194303),
+      UINT32_C(        10) },
+    { UINT32_C(   8388607),
+      UINT32_C(         9) },
+    { UINT32_C(  16777215),
+      UINT32_C(         8) },
+    { UINT32_C(  33554431),
+      UINT32_C(         7) },
+    { UINT32_C(  67108863),
+      UINT32_C(         6) },
+    { UINT32_C( 134217727),
+      UINT32_C(         5) },
+    { UINT32_C( 268435455),
+      UINT32_C(         4) },
+    { UINT32_C( 536870911),
+      UINT32_C(         3) },
+    { UINT32_C(1073741823),
+      UINT32_C(         2) },
+    { UINT32_C(4294901760),
+      UINT32_C(         0) },
+    { UINT32_C(4278190080),
+      UINT32_C(         0) },
+    { UINT32_C(2147483649),
+      UINT32_C(         0) },
+    { UINT32_C(2147483646),
       UINT32_C(         1) }
   };
 
@@ -365,7 +833,11 @@ test_simde_vclz_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT8_C(  12), -INT8_C(   6), -INT8_C(   2), -INT8_C(   1), -INT8_C(   2), -INT8_C(   1),  INT8_C(  58),  INT8_C(   0) },
       {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   8) } },
     { { -INT8_C(   2),  INT8_C(   0),  INT8_C( 117),  INT8_C(   0),  INT8_C(   2),  INT8_C(  12),  INT8_C(   1),  INT8_C(   0) },
-      {  INT8_C(   0),  INT8_C(   8),  INT8_C(   1),  INT8_C(   8),  INT8_C(   6),  INT8_C(   4),  INT8_C(   7),  INT8_C(   8) } }
+      {  INT8_C(   0),  INT8_C(   8),  INT8_C(   1),  INT8_C(   8),  INT8_C(   6),  INT8_C(   4),  INT8_C(   7),  INT8_C(   8) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   7),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4) } },
+    { {  INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -416,7 +888,25 @@ test_simde_vclz_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT16_C(     1),  INT16_C(     2), -INT16_C(     2), -INT16_C(    59) },
       {  INT16_C(     0),  INT16_C(    14),  INT16_C(     0),  INT16_C(     0) } },
     { { -INT16_C( 11275),  INT16_C(   397), -INT16_C(  1009),  INT16_C(  2750) },
-      {  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     4) } }
+      {  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     4) } },
+    { {  INT16_C(     0), -INT16_C(     1),        INT16_MIN,        INT16_MAX },
+      {  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1) } },
+    { {  INT16_C(     1),  INT16_C(     2),  INT16_C(     4),  INT16_C(     8) },
+      {  INT16_C(    15),  INT16_C(    14),  INT16_C(    13),  INT16_C(    12) } },
+    { {  INT16_C(    16),  INT16_C(    32),  INT16_C(    64),  INT16_C(   128) },
+      {  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8) } },
+    { {  INT16_C(   256),  INT16_C(   512),  INT16_C(  1024),  INT16_C(  2048) },
+      {  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4) } },
+    { {  INT16_C(  4096),  INT16_C(  8192),  INT16_C( 16384),  INT16_C(     3) },
+      {  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(    14) } },
+    { {  INT16_C(     7),  INT16_C(    15),  INT16_C(    31),  INT16_C(    63) },
+      {  INT16_C(    13),  INT16_C(    12),  INT16_C(    11),  INT16_C(    10) } },
+    { {  INT16_C(   127),  INT16_C(   255),  INT16_C(   511),  INT16_C(  1023) },
+      {  INT16_C(     9),  INT16_C(     8),  INT16_C(     7),  INT16_C(     6) } },
+    { {  INT16_C(  2047),  INT16_C(  4095),  INT16_C(  8191),  INT16_C( 16383) },
+      {  INT16_C(     5),  INT16_C(     4),  INT16_C(     3),  INT16_C(     2) } },
+    { { -INT16_C(   256),  INT16_C(     0), -INT16_C(     1),        INT16_MIN },
+      {  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -467,7 +957,75 @@ test_simde_vclz_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT32_C(           0),  INT32_C(     2017326) },
       {  INT32_C(          32),  INT32_C(          11) } },
     { {  INT32_C(      211567),  INT32_C(    17387595) },
-      {  INT32_C(          14),  INT32_C(           7) } }
+      {  INT32_C(          14),  INT32_C(           7) } },
+    { {  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(          32),  INT32_C(           0) } },
+    { {              INT32_MIN,              INT32_MAX },
+      {  INT32_C(           0),  INT32_C(           1) } },
+    { {  INT32_C(           1),  INT32_C(           2) },
+      {  INT32_C(          31),  INT32_C(          30) } },
+    { {  INT32_C(           4),  INT32_C(           8) },
+      {  INT32_C(          29),  INT32_C(          28) } },
+    { {  INT32_C(          16),  INT32_C(          32) },
+      {  INT32_C(          27),  INT32_C(          26) } },
+    { {  INT32_C(          64),  INT32_C(         128) },
+      {  INT32_C(          25),  INT32_C(          24) } },
+    { {  INT32_C(         256),  INT32_C(         512) },
+      {  INT32_C(          23),  INT32_C(          22) } },
+    { {  INT32_C(        1024),  INT32_C(        2048) },
+      {  INT32_C(          21),  INT32_C(          20) } },
+    { {  INT32_C(        4096),  INT32_C(        8192) },
+      {  INT32_C(          19),  INT32_C(          18) } },
+    { {  INT32_C(       16384),  INT32_C(       32768) },
+      {  INT32_C(          17),  INT32_C(          16) } },
+    { {  INT32_C(       65536),  INT32_C(      131072) },
+      {  INT32_C(          15),  INT32_C(          14) } },
+    { {  INT32_C(      262144),  INT32_C(      524288) },
+      {  INT32_C(          13),  INT32_C(          12) } },
+    { {  INT32_C(     1048576),  INT32_C(     2097152) },
+      {  INT32_C(          11),  INT32_C(          10) } },
+    { {  INT32_C(     4194304),  INT32_C(     8388608) },
+      {  INT32_C(           9),  INT32_C(           8) } },
+    { {  INT32_C(    16777216),  INT32_C(    33554432) },
+      {  INT32_C(           7),  INT32_C(           6) } },
+    { {  INT32_C(    67108864),  INT32_C(   134217728) },
+      {  INT32_C(           5),  INT32_C(           4) } },
+    { {  INT32_C(   268435456),  INT32_C(   536870912) },
+      {  INT32_C(           3),  INT32_C(           2) } },
+    { {  INT32_C(  1073741824),  INT32_C(           3) },
+      {  INT32_C(           1),  INT32_C(          30) } },
+    { {  INT32_C(           7),  INT32_C(          15) },
+      {  INT32_C(          29),  INT32_C(          28) } },
+    { {  INT32_C(          31),  INT32_C(          63) },
+      {  INT32_C(          27),  INT32_C(          26) } },
+    { {  INT32_C(         127),  INT32_C(         255) },
+      {  INT32_C(          25),  INT32_C(          24) } },
+    { {  INT32_C(         511),  INT32_C(        1023) },
+      {  INT32_C(          23),  INT32_C(          22) } },
+    { {  INT32_C(        2047),  INT32_C(        4095) },
+      {  INT32_C(          21),  INT32_C(          20) } },
+    { {  INT32_C(        8191),  INT32_C(       16383) },
+      {  INT32_C(          19),  INT32_C(          18) } },
+    { {  INT32_C(       32767),  INT32_C(       65535) },
+      {  INT32_C(          17),  INT32_C(          16) } },
+    { {  INT32_C(      131071),  INT32_C(      262143) },
+      {  INT32_C(          15),  INT32_C(          14) } },
+    { {  INT32_C(      524287),  INT32_C(     1048575) },
+      {  INT32_C(          13),  INT32_C(          12) } },
+    { {  INT32_C(     2097151),  INT32_C(     4194303) },
+      {  INT32_C(          11),  INT32_C(          10) } },
+    { {  INT32_C(     8388607),  INT32_C(    16777215) },
+      {  INT32_C(           9),  INT32_C(           8) } },
+    { {  INT32_C(    33554431),  INT32_C(    67108863) },
+      {  INT32_C(           7),  INT32_C(           6) } },
+    { {  INT32_C(   134217727),  INT32_C(   268435455) },
+      {  INT32_C(           5),  INT32_C(           4) } },
+    { {  INT32_C(   536870911),  INT32_C(  1073741823) },
+      {  INT32_C(           3),  INT32_C(           2) } },
+    { { -INT32_C(       65536), -INT32_C(    16777216) },
+      {  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  2147483647),  INT32_C(  2147483646) },
+      {  INT32_C(           0),  INT32_C(           1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -518,7 +1076,11 @@ test_simde_vclz_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C( 13), UINT8_C( 13), UINT8_C(  3), UINT8_C(  4), UINT8_C(  7), UINT8_C(  1), UINT8_C(  3), UINT8_C( 29) },
       { UINT8_C(  4), UINT8_C(  4), UINT8_C(  6), UINT8_C(  5), UINT8_C(  5), UINT8_C(  7), UINT8_C(  6), UINT8_C(  3) } },
     { { UINT8_C( 12), UINT8_C( 14), UINT8_C(  2), UINT8_C( 44), UINT8_C(  4), UINT8_C(113), UINT8_C(  1), UINT8_C(  2) },
-      { UINT8_C(  4), UINT8_C(  4), UINT8_C(  6), UINT8_C(  2), UINT8_C(  5), UINT8_C(  1), UINT8_C(  7), UINT8_C(  6) } }
+      { UINT8_C(  4), UINT8_C(  4), UINT8_C(  6), UINT8_C(  2), UINT8_C(  5), UINT8_C(  1), UINT8_C(  7), UINT8_C(  6) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8) },
+      { UINT8_C(  8), UINT8_C(  0), UINT8_C(  0), UINT8_C(  1), UINT8_C(  7), UINT8_C(  6), UINT8_C(  5), UINT8_C(  4) } },
+    { { UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      { UINT8_C(  3), UINT8_C(  2), UINT8_C(  1), UINT8_C(  6), UINT8_C(  5), UINT8_C(  4), UINT8_C(  3), UINT8_C(  2) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -569,7 +1131,25 @@ test_simde_vclz_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C(  128), UINT16_C(   94), UINT16_C(  204), UINT16_C(   51) },
       { UINT16_C(    8), UINT16_C(    9), UINT16_C(    8), UINT16_C(   10) } },
     { { UINT16_C( 1010), UINT16_C(    9), UINT16_C(    0), UINT16_C(    1) },
-      { UINT16_C(    6), UINT16_C(   12), UINT16_C(   16), UINT16_C(   15) } }
+      { UINT16_C(    6), UINT16_C(   12), UINT16_C(   16), UINT16_C(   15) } },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(32768), UINT16_C(32767) },
+      { UINT16_C(   16), UINT16_C(    0), UINT16_C(    0), UINT16_C(    1) } },
+    { { UINT16_C(    1), UINT16_C(    2), UINT16_C(    4), UINT16_C(    8) },
+      { UINT16_C(   15), UINT16_C(   14), UINT16_C(   13), UINT16_C(   12) } },
+    { { UINT16_C(   16), UINT16_C(   32), UINT16_C(   64), UINT16_C(  128) },
+      { UINT16_C(   11), UINT16_C(   10), UINT16_C(    9), UINT16_C(    8) } },
+    { { UINT16_C(  256), UINT16_C(  512), UINT16_C( 1024), UINT16_C( 2048) },
+      { UINT16_C(    7), UINT16_C(    6), UINT16_C(    5), UINT16_C(    4) } },
+    { { UINT16_C( 4096), UINT16_C( 8192), UINT16_C(16384), UINT16_C(    3) },
+      { UINT16_C(    3), UINT16_C(    2), UINT16_C(    1), UINT16_C(   14) } },
+    { { UINT16_C(    7), UINT16_C(   15), UINT16_C(   31), UINT16_C(   63) },
+      { UINT16_C(   13), UINT16_C(   12), UINT16_C(   11), UINT16_C(   10) } },
+    { { UINT16_C(  127), UINT16_C(  255), UINT16_C(  511), UINT16_C( 1023) },
+      { UINT16_C(    9), UINT16_C(    8), UINT16_C(    7), UINT16_C(    6) } },
+    { { UINT16_C( 2047), UINT16_C( 4095), UINT16_C( 8191), UINT16_C(16383) },
+      { UINT16_C(    5), UINT16_C(    4), UINT16_C(    3), UINT16_C(    2) } },
+    { { UINT16_C(65280), UINT16_C(    0),      UINT16_MAX, UINT16_C(32768) },
+      { UINT16_C(    0), UINT16_C(   16), UINT16_C(    0), UINT16_C(    0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -620,7 +1200,75 @@ test_simde_vclz_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(    519401), UINT32_C(   1505652) },
       { UINT32_C(        13), UINT32_C(        11) } },
     { { UINT32_C(      1945), UINT32_C(       266) },
-      { UINT32_C(        21), UINT32_C(        23) } }
+      { UINT32_C(        21), UINT32_C(        23) } },
+    { { UINT32_C(         0),           UINT32_MAX },
+      { UINT32_C(        32), UINT32_C(         0) } },
+    { { UINT32_C(2147483648), UINT32_C(2147483647) },
+      { UINT32_C(         0), UINT32_C(         1) } },
+    { { UINT32_C(         1), UINT32_C(         2) },
+      { UINT32_C(        31), UINT32_C(        30) } },
+    { { UINT32_C(         4), UINT32_C(         8) },
+      { UINT32_C(        29), UINT32_C(        28) } },
+    { { UINT32_C(        16), UINT32_C(        32) },
+      { UINT32_C(        27), UINT32_C(        26) } },
+    { { UINT32_C(        64), UINT32_C(       128) },
+      { UINT32_C(        25), UINT32_C(        24) } },
+    { { UINT32_C(       256), UINT32_C(       512) },
+      { UINT32_C(        23), UINT32_C(        22) } },
+    { { UINT32_C(      1024), UINT32_C(      2048) },
+      { UINT32_C(        21), UINT32_C(        20) } },
+    { { UINT32_C(      4096), UINT32_C(      8192) },
+      { UINT32_C(        19), UINT32_C(        18) } },
+    { { UINT32_C(     16384), UINT32_C(     32768) },
+      { UINT32_C(        17), UINT32_C(        16) } },
+    { { UINT32_C(     65536), UINT32_C(    131072) },
+      { UINT32_C(        15), UINT32_C(        14) } },
+    { { UINT32_C(    262144), UINT32_C(    524288) },
+      { UINT32_C(        13), UINT32_C(        12) } },
+    { { UINT32_C(   1048576), UINT32_C(   2097152) },
+      { UINT32_C(        11), UINT32_C(        10) } },
+    { { UINT32_C(   4194304), UINT32_C(   8388608) },
+      { UINT32_C(         9), UINT32_C(         8) } },
+    { { UINT32_C(  16777216), UINT32_C(  33554432) },
+      { UINT32_C(         7), UINT32_C(         6) } },
+    { { UINT32_C(  67108864), UINT32_C( 134217728) },
+      { UINT32_C(         5), UINT32_C(         4) } },
+    { { UINT32_C( 268435456), UINT32_C( 536870912) },
+      { UINT32_C(         3), UINT32_C(         2) } },
+    { { UINT32_C(1073741824), UINT32_C(         3) },
+      { UINT32_C(         1), UINT32_C(        30) } },
+    { { UINT32_C(         7), UINT32_C(        15) },
+      { UINT32_C(        29), UINT32_C(        28) } },
+    { { UINT32_C(        31), UINT32_C(        63) },
+      { UINT32_C(        27), UINT32_C(        26) } },
+    { { UINT32_C(       127), UINT32_C(       255) },
+      { UINT32_C(        25), UINT32_C(        24) } },
+    { { UINT32_C(       511), UINT32_C(      1023) },
+      { UINT32_C(        23), UINT32_C(        22) } },
+    { { UINT32_C(      2047), UINT32_C(      4095) },
+      { UINT32_C(        21), UINT32_C(        20) } },
+    { { UINT32_C(      8191), UINT32_C(     16383) },
+      { UINT32_C(        19), UINT32_C(        18) } },
+    { { UINT32_C(     32767), UINT32_C(     65535) },
+      { UINT32_C(        17), UINT32_C(        16) } },
+    { { UINT32_C(    131071), UINT32_C(    262143) },
+      { UINT32_C(        15), UINT32_C(        14) } },
+    { { UINT32_C(    524287), UINT32_C(   1048575) },
+      { UINT32_C(        13), UINT32_C(        12) } },
+    { { UINT32_C(   2097151), UINT32_C(   4194303) },
+      { UINT32_C(        11), UINT32_C(        10) } },
+    { { UINT32_C(   8388607), UINT32_C(  16777215) },
+      { UINT32_C(         9), UINT32_C(         8) } },
+    { { UINT32_C(  33554431), UINT32_C(  67108863) },
+      { UINT32_C(         7), UINT32_C(         6) } },
+    { { UINT32_C( 134217727), UINT32_C( 268435455) },
+      { UINT32_C(         5), UINT32_C(         4) } },
+    { { UINT32_C( 536870911), UINT32_C(1073741823) },
+      { UINT32_C(         3), UINT32_C(         2) } },
+    { { UINT32_C(4294901760), UINT32_C(4278190080) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { UINT32_C(2147483649), UINT32_C(2147483646) },
+      { UINT32_C(         0), UINT32_C(         1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -687,7 +1335,11 @@ test_simde_vclzq_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(  58),  INT8_C(  41),  INT8_C(   7),  INT8_C(   0),  INT8_C(   1),
         -INT8_C(   1),  INT8_C(  14),  INT8_C(  41), -INT8_C(  56),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0), -INT8_C(   4) },
       {  INT8_C(   0),  INT8_C(   7),  INT8_C(   7),  INT8_C(   2),  INT8_C(   2),  INT8_C(   5),  INT8_C(   8),  INT8_C(   7),
-         INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   8),  INT8_C(   7),  INT8_C(   8),  INT8_C(   0) } }
+         INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   8),  INT8_C(   7),  INT8_C(   8),  INT8_C(   0) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8),
+         INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   7),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -738,7 +1390,17 @@ test_simde_vclzq_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT16_C( 21944), -INT16_C( 12245), -INT16_C(   115), -INT16_C( 17817),  INT16_C(    73),  INT16_C(  1803),  INT16_C(     4), -INT16_C(  8055) },
       {  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     9),  INT16_C(     5),  INT16_C(    13),  INT16_C(     0) } },
     { { -INT16_C(    15), -INT16_C(     1),  INT16_C(    60), -INT16_C(    10), -INT16_C(  2776), -INT16_C(    32), -INT16_C(     1),  INT16_C(   648) },
-      {  INT16_C(     0),  INT16_C(     0),  INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     6) } }
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     6) } },
+    { {  INT16_C(     0), -INT16_C(     1),        INT16_MIN,        INT16_MAX,  INT16_C(     1),  INT16_C(     2),  INT16_C(     4),  INT16_C(     8) },
+      {  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(    15),  INT16_C(    14),  INT16_C(    13),  INT16_C(    12) } },
+    { {  INT16_C(    16),  INT16_C(    32),  INT16_C(    64),  INT16_C(   128),  INT16_C(   256),  INT16_C(   512),  INT16_C(  1024),  INT16_C(  2048) },
+      {  INT16_C(    11),  INT16_C(    10),  INT16_C(     9),  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4) } },
+    { {  INT16_C(  4096),  INT16_C(  8192),  INT16_C( 16384),  INT16_C(     3),  INT16_C(     7),  INT16_C(    15),  INT16_C(    31),  INT16_C(    63) },
+      {  INT16_C(     3),  INT16_C(     2),  INT16_C(     1),  INT16_C(    14),  INT16_C(    13),  INT16_C(    12),  INT16_C(    11),  INT16_C(    10) } },
+    { {  INT16_C(   127),  INT16_C(   255),  INT16_C(   511),  INT16_C(  1023),  INT16_C(  2047),  INT16_C(  4095),  INT16_C(  8191),  INT16_C( 16383) },
+      {  INT16_C(     9),  INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3),  INT16_C(     2) } },
+    { { -INT16_C(   256),  INT16_C(     0), -INT16_C(     1),        INT16_MIN,        INT16_MAX,  INT16_C(     1),  INT16_C(     2),  INT16_C(     4) },
+      {  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(    15),  INT16_C(    14),  INT16_C(    13) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -789,7 +1451,41 @@ test_simde_vclzq_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT32_C(    64880981),  INT32_C(     1021439),  INT32_C(          65), -INT32_C(           2) },
       {  INT32_C(           0),  INT32_C(          12),  INT32_C(          25),  INT32_C(           0) } },
     { { -INT32_C(          20), -INT32_C(        2791),  INT32_C(           2),  INT32_C(         115) },
-      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          30),  INT32_C(          25) } }
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          30),  INT32_C(          25) } },
+    { {  INT32_C(           0), -INT32_C(           1),              INT32_MIN,              INT32_MAX },
+      {  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } },
+    { {  INT32_C(           1),  INT32_C(           2),  INT32_C(           4),  INT32_C(           8) },
+      {  INT32_C(          31),  INT32_C(          30),  INT32_C(          29),  INT32_C(          28) } },
+    { {  INT32_C(          16),  INT32_C(          32),  INT32_C(          64),  INT32_C(         128) },
+      {  INT32_C(          27),  INT32_C(          26),  INT32_C(          25),  INT32_C(          24) } },
+    { {  INT32_C(         256),  INT32_C(         512),  INT32_C(        1024),  INT32_C(        2048) },
+      {  INT32_C(          23),  INT32_C(          22),  INT32_C(          21),  INT32_C(          20) } },
+    { {  INT32_C(        4096),  INT32_C(        8192),  INT32_C(       16384),  INT32_C(       32768) },
+      {  INT32_C(          19),  INT32_C(          18),  INT32_C(          17),  INT32_C(          16) } },
+    { {  INT32_C(       65536),  INT32_C(      131072),  INT32_C(      262144),  INT32_C(      524288) },
+      {  INT32_C(          15),  INT32_C(          14),  INT32_C(          13),  INT32_C(          12) } },
+    { {  INT32_C(     1048576),  INT32_C(     2097152),  INT32_C(     4194304),  INT32_C(     8388608) },
+      {  INT32_C(          11),  INT32_C(          10),  INT32_C(           9),  INT32_C(           8) } },
+    { {  INT32_C(    16777216),  INT32_C(    33554432),  INT32_C(    67108864),  INT32_C(   134217728) },
+      {  INT32_C(           7),  INT32_C(           6),  INT32_C(           5),  INT32_C(           4) } },
+    { {  INT32_C(   268435456),  INT32_C(   536870912),  INT32_C(  1073741824),  INT32_C(           3) },
+      {  INT32_C(           3),  INT32_C(           2),  INT32_C(           1),  INT32_C(          30) } },
+    { {  INT32_C(           7),  INT32_C(          15),  INT32_C(          31),  INT32_C(          63) },
+      {  INT32_C(          29),  INT32_C(          28),  INT32_C(          27),  INT32_C(          26) } },
+    { {  INT32_C(         127),  INT32_C(         255),  INT32_C(         511),  INT32_C(        1023) },
+      {  INT32_C(          25),  INT32_C(          24),  INT32_C(          23),  INT32_C(          22) } },
+    { {  INT32_C(        2047),  INT32_C(        4095),  INT32_C(        8191),  INT32_C(       16383) },
+      {  INT32_C(          21),  INT32_C(          20),  INT32_C(          19),  INT32_C(          18) } },
+    { {  INT32_C(       32767),  INT32_C(       65535),  INT32_C(      131071),  INT32_C(      262143) },
+      {  INT32_C(          17),  INT32_C(          16),  INT32_C(          15),  INT32_C(          14) } },
+    { {  INT32_C(      524287),  INT32_C(     1048575),  INT32_C(     2097151),  INT32_C(     4194303) },
+      {  INT32_C(          13),  INT32_C(          12),  INT32_C(          11),  INT32_C(          10) } },
+    { {  INT32_C(     8388607),  INT32_C(    16777215),  INT32_C(    33554431),  INT32_C(    67108863) },
+      {  INT32_C(           9),  INT32_C(           8),  INT32_C(           7),  INT32_C(           6) } },
+    { {  INT32_C(   134217727),  INT32_C(   268435455),  INT32_C(   536870911),  INT32_C(  1073741823) },
+      {  INT32_C(           5),  INT32_C(           4),  INT32_C(           3),  INT32_C(           2) } },
+    { { -INT32_C(       65536), -INT32_C(    16777216), -INT32_C(  2147483647),  INT32_C(  2147483646) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -856,7 +1552,11 @@ test_simde_vclzq_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C(  4), UINT8_C(163), UINT8_C(  5), UINT8_C(  7), UINT8_C(  1), UINT8_C(  1), UINT8_C( 44), UINT8_C(  0),
         UINT8_C( 28), UINT8_C( 84), UINT8_C(  0), UINT8_C(  8), UINT8_C(  3), UINT8_C(  3), UINT8_C( 21), UINT8_C(  0) },
       { UINT8_C(  5), UINT8_C(  0), UINT8_C(  5), UINT8_C(  5), UINT8_C(  7), UINT8_C(  7), UINT8_C(  2), UINT8_C(  8),
-        UINT8_C(  3), UINT8_C(  1), UINT8_C(  8), UINT8_C(  4), UINT8_C(  6), UINT8_C(  6), UINT8_C(  3), UINT8_C(  8) } }
+        UINT8_C(  3), UINT8_C(  1), UINT8_C(  8), UINT8_C(  4), UINT8_C(  6), UINT8_C(  6), UINT8_C(  3), UINT8_C(  8) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8),
+        UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      { UINT8_C(  8), UINT8_C(  0), UINT8_C(  0), UINT8_C(  1), UINT8_C(  7), UINT8_C(  6), UINT8_C(  5), UINT8_C(  4),
+        UINT8_C(  3), UINT8_C(  2), UINT8_C(  1), UINT8_C(  6), UINT8_C(  5), UINT8_C(  4), UINT8_C(  3), UINT8_C(  2) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -907,7 +1607,17 @@ test_simde_vclzq_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C( 3257), UINT16_C(    0), UINT16_C(   51), UINT16_C( 1557), UINT16_C(52698), UINT16_C(18497), UINT16_C(   12), UINT16_C(   34) },
       { UINT16_C(    4), UINT16_C(   16), UINT16_C(   10), UINT16_C(    5), UINT16_C(    0), UINT16_C(    1), UINT16_C(   12), UINT16_C(   10) } },
     { { UINT16_C( 3452), UINT16_C(   90), UINT16_C(   61), UINT16_C(16486), UINT16_C( 2618), UINT16_C( 1696), UINT16_C(   39), UINT16_C( 9222) },
-      { UINT16_C(    4), UINT16_C(    9), UINT16_C(   10), UINT16_C(    1), UINT16_C(    4), UINT16_C(    5), UINT16_C(   10), UINT16_C(    2) } }
+      { UINT16_C(    4), UINT16_C(    9), UINT16_C(   10), UINT16_C(    1), UINT16_C(    4), UINT16_C(    5), UINT16_C(   10), UINT16_C(    2) } },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(32768), UINT16_C(32767), UINT16_C(    1), UINT16_C(    2), UINT16_C(    4), UINT16_C(    8) },
+      { UINT16_C(   16), UINT16_C(    0), UINT16_C(    0), UINT16_C(    1), UINT16_C(   15), UINT16_C(   14), UINT16_C(   13), UINT16_C(   12) } },
+    { { UINT16_C(   16), UINT16_C(   32), UINT16_C(   64), UINT16_C(  128), UINT16_C(  256), UINT16_C(  512), UINT16_C( 1024), UINT16_C( 2048) },
+      { UINT16_C(   11), UINT16_C(   10), UINT16_C(    9), UINT16_C(    8), UINT16_C(    7), UINT16_C(    6), UINT16_C(    5), UINT16_C(    4) } },
+    { { UINT16_C( 4096), UINT16_C( 8192), UINT16_C(16384), UINT16_C(    3), UINT16_C(    7), UINT16_C(   15), UINT16_C(   31), UINT16_C(   63) },
+      { UINT16_C(    3), UINT16_C(    2), UINT16_C(    1), UINT16_C(   14), UINT16_C(   13), UINT16_C(   12), UINT16_C(   11), UINT16_C(   10) } },
+    { { UINT16_C(  127), UINT16_C(  255), UINT16_C(  511), UINT16_C( 1023), UINT16_C( 2047), UINT16_C( 4095), UINT16_C( 8191), UINT16_C(16383) },
+      { UINT16_C(    9), UINT16_C(    8), UINT16_C(    7), UINT16_C(    6), UINT16_C(    5), UINT16_C(    4), UINT16_C(    3), UINT16_C(    2) } },
+    { { UINT16_C(65280), UINT16_C(    0),      UINT16_MAX, UINT16_C(32768), UINT16_C(32767), UINT16_C(    1), UINT16_C(    2), UINT16_C(    4) },
+      { UINT16_C(    0), UINT16_C(   16), UINT16_C(    0), UINT16_C(    0), UINT16_C(    1), UINT16_C(   15), UINT16_C(   14), UINT16_C(   13) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -958,7 +1668,41 @@ test_simde_vclzq_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(      3291), UINT32_C(      1005), UINT32_C(  14643902), UINT32_C(         7) },
       { UINT32_C(        20), UINT32_C(        22), UINT32_C(         8), UINT32_C(        29) } },
     { { UINT32_C(         5), UINT32_C(       188), UINT32_C(      4073), UINT32_C(         4) },
-      { UINT32_C(        29), UINT32_C(        24), UINT32_C(        20), UINT32_C(        29) } }
+      { UINT32_C(        29), UINT32_C(        24), UINT32_C(        20), UINT32_C(        29) } },
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(2147483648), UINT32_C(2147483647) },
+      { UINT32_C(        32), UINT32_C(         0), UINT32_C(         0), UINT32_C(         1) } },
+    { { UINT32_C(         1), UINT32_C(         2), UINT32_C(         4), UINT32_C(         8) },
+      { UINT32_C(        31), UINT32_C(        30), UINT32_C(        29), UINT32_C(        28) } },
+    { { UINT32_C(        16), UINT32_C(        32), UINT32_C(        64), UINT32_C(       128) },
+      { UINT32_C(        27), UINT32_C(        26), UINT32_C(        25), UINT32_C(        24) } },
+    { { UINT32_C(       256), UINT32_C(       512), UINT32_C(      1024), UINT32_C(      2048) },
+      { UINT32_C(        23), UINT32_C(        22), UINT32_C(        21), UINT32_C(        20) } },
+    { { UINT32_C(      4096), UINT32_C(      8192), UINT32_C(     16384), UINT32_C(     32768) },
+      { UINT32_C(        19), UINT32_C(        18), UINT32_C(        17), UINT32_C(        16) } },
+    { { UINT32_C(     65536), UINT32_C(    131072), UINT32_C(    262144), UINT32_C(    524288) },
+      { UINT32_C(        15), UINT32_C(        14), UINT32_C(        13), UINT32_C(        12) } },
+    { { UINT32_C(   1048576), UINT32_C(   2097152), UINT32_C(   4194304), UINT32_C(   8388608) },
+      { UINT32_C(        11), UINT32_C(        10), UINT32_C(         9), UINT32_C(         8) } },
+    { { UINT32_C(  16777216), UINT32_C(  33554432), UINT32_C(  67108864), UINT32_C( 134217728) },
+      { UINT32_C(         7), UINT32_C(         6), UINT32_C(         5), UINT32_C(         4) } },
+    { { UINT32_C( 268435456), UINT32_C( 536870912), UINT32_C(1073741824), UINT32_C(         3) },
+      { UINT32_C(         3), UINT32_C(         2), UINT32_C(         1), UINT32_C(        30) } },
+    { { UINT32_C(         7), UINT32_C(        15), UINT32_C(        31), UINT32_C(        63) },
+      { UINT32_C(        29), UINT32_C(        28), UINT32_C(        27), UINT32_C(        26) } },
+    { { UINT32_C(       127), UINT32_C(       255), UINT32_C(       511), UINT32_C(      1023) },
+      { UINT32_C(        25), UINT32_C(        24), UINT32_C(        23), UINT32_C(        22) } },
+    { { UINT32_C(      2047), UINT32_C(      4095), UINT32_C(      8191), UINT32_C(     16383) },
+      { UINT32_C(        21), UINT32_C(        20), UINT32_C(        19), UINT32_C(        18) } },
+    { { UINT32_C(     32767), UINT32_C(     65535), UINT32_C(    131071), UINT32_C(    262143) },
+      { UINT32_C(        17), UINT32_C(        16), UINT32_C(        15), UINT32_C(        14) } },
+    { { UINT32_C(    524287), UINT32_C(   1048575), UINT32_C(   2097151), UINT32_C(   4194303) },
+      { UINT32_C(        13), UINT32_C(        12), UINT32_C(        11), UINT32_C(        10) } },
+    { { UINT32_C(   8388607), UINT32_C(  16777215), UINT32_C(  33554431), UINT32_C(  67108863) },
+      { UINT32_C(         9), UINT32_C(         8), UINT32_C(         7), UINT32_C(         6) } },
+    { { UINT32_C( 134217727), UINT32_C( 268435455), UINT32_C( 536870911), UINT32_C(1073741823) },
+      { UINT32_C(         5), UINT32_C(         4), UINT32_C(         3), UINT32_C(         2) } },
+    { { UINT32_C(4294901760), UINT32_C(4278190080), UINT32_C(2147483649), UINT32_C(2147483646) },
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
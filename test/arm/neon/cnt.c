@@ -25,7 +25,11 @@ test_simde_vcnt_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT8_C(  51),  INT8_C(  96),  INT8_C(  46), -INT8_C(  37),  INT8_C(  60), -INT8_C(  54),  INT8_C(  92),  INT8_C(  28) },
       {  INT8_C(   4),  INT8_C(   2),  INT8_C(   4),  INT8_C(   6),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   3) } },
     { {  INT8_C(  76), -INT8_C(  92), -INT8_C(  28), -INT8_C(  28), -INT8_C(  15),  INT8_C(  12), -INT8_C(  43), -INT8_C(  33) },
-      {  INT8_C(   3),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   5),  INT8_C(   2),  INT8_C(   5),  INT8_C(   7) } }
+      {  INT8_C(   3),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   5),  INT8_C(   2),  INT8_C(   5),  INT8_C(   7) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8) },
+      {  INT8_C(   0),  INT8_C(   8),  INT8_C(   1),  INT8_C(   7),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1) } },
+    { {  INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4),  INT8_C(   5),  INT8_C(   6) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -71,7 +75,11 @@ test_simde_vcnt_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C(199), UINT8_C(206), UINT8_C( 88), UINT8_C( 91), UINT8_C(124), UINT8_C(164), UINT8_C(130), UINT8_C(219) },
       { UINT8_C(  5), UINT8_C(  5), UINT8_C(  3), UINT8_C(  5), UINT8_C(  5), UINT8_C(  3), UINT8_C(  2), UINT8_C(  6) } },
     { { UINT8_C(131), UINT8_C(118), UINT8_C(143), UINT8_C(150), UINT8_C( 23), UINT8_C( 32), UINT8_C(124), UINT8_C(124) },
-      { UINT8_C(  3), UINT8_C(  5), UINT8_C(  5), UINT8_C(  4), UINT8_C(  4), UINT8_C(  1), UINT8_C(  5), UINT8_C(  5) } }
+      { UINT8_C(  3), UINT8_C(  5), UINT8_C(  5), UINT8_C(  4), UINT8_C(  4), UINT8_C(  1), UINT8_C(  5), UINT8_C(  5) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8) },
+      { UINT8_C(  0), UINT8_C(  8), UINT8_C(  1), UINT8_C(  7), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) } },
+    { { UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  2), UINT8_C(  3), UINT8_C(  4), UINT8_C(  5), UINT8_C(  6) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -133,7 +141,11 @@ test_simde_vcntq_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT8_C(  64),  INT8_C(  19),  INT8_C( 103),      INT8_MAX,  INT8_C(  64),  INT8_C(  22), -INT8_C(  18),  INT8_C( 116),
         -INT8_C(  18), -INT8_C(  13), -INT8_C(  28),  INT8_C(  28), -INT8_C(  32), -INT8_C( 108), -INT8_C(  20), -INT8_C(  35) },
       {  INT8_C(   2),  INT8_C(   3),  INT8_C(   5),  INT8_C(   7),  INT8_C(   1),  INT8_C(   3),  INT8_C(   6),  INT8_C(   4),
-         INT8_C(   6),  INT8_C(   6),  INT8_C(   4),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   5),  INT8_C(   6) } }
+         INT8_C(   6),  INT8_C(   6),  INT8_C(   4),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   5),  INT8_C(   6) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8),
+         INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   0),  INT8_C(   8),  INT8_C(   1),  INT8_C(   7),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4),  INT8_C(   5),  INT8_C(   6) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -195,7 +207,11 @@ test_simde_vcntq_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C(119), UINT8_C(215), UINT8_C(207), UINT8_C(127), UINT8_C( 47), UINT8_C( 26), UINT8_C(111), UINT8_C(229),
         UINT8_C(114), UINT8_C(253), UINT8_C(176), UINT8_C( 39), UINT8_C(  6), UINT8_C(161), UINT8_C( 96), UINT8_C( 98) },
       { UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  7), UINT8_C(  5), UINT8_C(  3), UINT8_C(  6), UINT8_C(  5),
-        UINT8_C(  4), UINT8_C(  7), UINT8_C(  3), UINT8_C(  4), UINT8_C(  2), UINT8_C(  3), UINT8_C(  2), UINT8_C(  3) } }
+        UINT8_C(  4), UINT8_C(  7), UINT8_C(  3), UINT8_C(  4), UINT8_C(  2), UINT8_C(  3), UINT8_C(  2), UINT8_C(  3) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8),
+        UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      { UINT8_C(  0), UINT8_C(  8), UINT8_C(  1), UINT8_C(  7), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  2), UINT8_C(  3), UINT8_C(  4), UINT8_C(  5), UINT8_C(  6) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
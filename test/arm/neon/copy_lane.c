@@ -0,0 +1,1889 @@
+#define SIMDE_TEST_ARM_NEON_INSN copy_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/copy_lane.h"
+
+static int
+test_simde_vcopy_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a[2];
+    simde_float32_t b[2];
+    simde_float32_t r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   444.39), SIMDE_FLOAT32_C(   783.50) },
+      { SIMDE_FLOAT32_C(   215.85), SIMDE_FLOAT32_C(  -896.84) },
+      { { SIMDE_FLOAT32_C(  -896.84), SIMDE_FLOAT32_C(   783.50) },
+        { SIMDE_FLOAT32_C(   444.39), SIMDE_FLOAT32_C(   215.85) },
+        { SIMDE_FLOAT32_C(   444.39), SIMDE_FLOAT32_C(  -896.84) } } },
+    { { SIMDE_FLOAT32_C(  -859.09), SIMDE_FLOAT32_C(   471.14) },
+      { SIMDE_FLOAT32_C(   243.35), SIMDE_FLOAT32_C(   200.04) },
+      { { SIMDE_FLOAT32_C(   200.04), SIMDE_FLOAT32_C(   471.14) },
+        { SIMDE_FLOAT32_C(  -859.09), SIMDE_FLOAT32_C(   243.35) },
+        { SIMDE_FLOAT32_C(  -859.09), SIMDE_FLOAT32_C(   200.04) } } },
+    { { SIMDE_FLOAT32_C(  -355.07), SIMDE_FLOAT32_C(    -5.46) },
+      { SIMDE_FLOAT32_C(   788.27), SIMDE_FLOAT32_C(   716.69) },
+      { { SIMDE_FLOAT32_C(   716.69), SIMDE_FLOAT32_C(    -5.46) },
+        { SIMDE_FLOAT32_C(  -355.07), SIMDE_FLOAT32_C(   788.27) },
+        { SIMDE_FLOAT32_C(  -355.07), SIMDE_FLOAT32_C(   716.69) } } },
+    { { SIMDE_FLOAT32_C(   692.70), SIMDE_FLOAT32_C(   431.31) },
+      { SIMDE_FLOAT32_C(  -248.95), SIMDE_FLOAT32_C(   291.60) },
+      { { SIMDE_FLOAT32_C(   291.60), SIMDE_FLOAT32_C(   431.31) },
+        { SIMDE_FLOAT32_C(   692.70), SIMDE_FLOAT32_C(  -248.95) },
+        { SIMDE_FLOAT32_C(   692.70), SIMDE_FLOAT32_C(   291.60) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r0 = simde_vcopy_lane_f32(a, 0, b, 1);
+    simde_float32x2_t r1 = simde_vcopy_lane_f32(a, 1, b, 0);
+    simde_float32x2_t r2 = simde_vcopy_lane_f32(a, 1, b, 1);
+
+    simde_test_arm_neon_assert_equal_f32x2(r0, simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r1, simde_vld1_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r2, simde_vld1_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a[1];
+    simde_float64_t b[1];
+    simde_float64_t r[3][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -485.80) },
+      { SIMDE_FLOAT64_C(   722.99) },
+      { { SIMDE_FLOAT64_C(   722.99) },
+        { SIMDE_FLOAT64_C(   722.99) },
+        { SIMDE_FLOAT64_C(   722.99) } } },
+    { { SIMDE_FLOAT64_C(  -852.20) },
+      { SIMDE_FLOAT64_C(  -825.53) },
+      { { SIMDE_FLOAT64_C(  -825.53) },
+        { SIMDE_FLOAT64_C(  -825.53) },
+        { SIMDE_FLOAT64_C(  -825.53) } } },
+    { { SIMDE_FLOAT64_C(   261.88) },
+      { SIMDE_FLOAT64_C(   -60.10) },
+      { { SIMDE_FLOAT64_C(   -60.10) },
+        { SIMDE_FLOAT64_C(   -60.10) },
+        { SIMDE_FLOAT64_C(   -60.10) } } },
+    { { SIMDE_FLOAT64_C(  -834.78) },
+      { SIMDE_FLOAT64_C(   544.17) },
+      { { SIMDE_FLOAT64_C(   544.17) },
+        { SIMDE_FLOAT64_C(   544.17) },
+        { SIMDE_FLOAT64_C(   544.17) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r0 = simde_vcopy_lane_f64(a, 0, b, 0);
+    simde_float64x1_t r1 = simde_vcopy_lane_f64(a, 0, b, 0);
+    simde_float64x1_t r2 = simde_vcopy_lane_f64(a, 0, b, 0);
+
+    simde_test_arm_neon_assert_equal_f64x1(r0, simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r1, simde_vld1_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r2, simde_vld1_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[8];
+    int8_t b[8];
+    int8_t r[3][8];
+  } test_vec[] = {
+    { { -INT8_C( 42), -INT8_C( 54),  INT8_C( 41),  INT8_C( 20),  INT8_C( 89),  INT8_C(114), -INT8_C( 88),  INT8_C( 32) },
+      {  INT8_C( 27),  INT8_C( 22),  INT8_C( 61), -INT8_C( 36),  INT8_C( 95),  INT8_C( 42), -INT8_C( 20),  INT8_C( 93) },
+      { {  INT8_C( 93), -INT8_C( 54),  INT8_C( 41),  INT8_C( 20),  INT8_C( 89),  INT8_C(114), -INT8_C( 88),  INT8_C( 32) },
+        { -INT8_C( 42), -INT8_C( 54),  INT8_C( 41),  INT8_C( 20),  INT8_C( 89),  INT8_C(114), -INT8_C( 88),  INT8_C( 27) },
+        { -INT8_C( 42), -INT8_C( 54),  INT8_C( 41),  INT8_C( 20),  INT8_C( 95),  INT8_C(114), -INT8_C( 88),  INT8_C( 32) } } },
+    { {  INT8_C( 46),  INT8_C( 65), -INT8_C(108), -INT8_C(100),  INT8_C( 93), -INT8_C( 64), -INT8_C( 84), -INT8_C(104) },
+      {  INT8_C( 13),  INT8_C( 43),  INT8_C( 59), -INT8_C( 14),  INT8_C( 66), -INT8_C( 67),  INT8_C( 26), -INT8_C(110) },
+      { { -INT8_C(110),  INT8_C( 65), -INT8_C(108), -INT8_C(100),  INT8_C( 93), -INT8_C( 64), -INT8_C( 84), -INT8_C(104) },
+        {  INT8_C( 46),  INT8_C( 65), -INT8_C(108), -INT8_C(100),  INT8_C( 93), -INT8_C( 64), -INT8_C( 84),  INT8_C( 13) },
+        {  INT8_C( 46),  INT8_C( 65), -INT8_C(108), -INT8_C(100),  INT8_C( 66), -INT8_C( 64), -INT8_C( 84), -INT8_C(104) } } },
+    { {  INT8_C( 95),  INT8_C(102),  INT8_C( 21), -INT8_C(  1), -INT8_C(115),  INT8_C( 59),  INT8_C( 15), -INT8_C( 26) },
+      { -INT8_C(103),  INT8_C(109), -INT8_C( 60),  INT8_C( 84), -INT8_C( 17), -INT8_C( 78),  INT8_C(108), -INT8_C( 50) },
+      { { -INT8_C( 50),  INT8_C(102),  INT8_C( 21), -INT8_C(  1), -INT8_C(115),  INT8_C( 59),  INT8_C( 15), -INT8_C( 26) },
+        {  INT8_C( 95),  INT8_C(102),  INT8_C( 21), -INT8_C(  1), -INT8_C(115),  INT8_C( 59),  INT8_C( 15), -INT8_C(103) },
+        {  INT8_C( 95),  INT8_C(102),  INT8_C( 21), -INT8_C(  1), -INT8_C( 17),  INT8_C( 59),  INT8_C( 15), -INT8_C( 26) } } },
+    { {  INT8_C(121), -INT8_C( 65),  INT8_C( 32), -INT8_C( 72),  INT8_C(100), -INT8_C(109), -INT8_C(127),  INT8_C(109) },
+      {  INT8_C( 19),  INT8_C( 98),  INT8_C( 35),  INT8_C( 65),  INT8_C(125), -INT8_C(109),  INT8_C( 86), -INT8_C(  7) },
+      { { -INT8_C(  7), -INT8_C( 65),  INT8_C( 32), -INT8_C( 72),  INT8_C(100), -INT8_C(109), -INT8_C(127),  INT8_C(109) },
+        {  INT8_C(121), -INT8_C( 65),  INT8_C( 32), -INT8_C( 72),  INT8_C(100), -INT8_C(109), -INT8_C(127),  INT8_C( 19) },
+        {  INT8_C(121), -INT8_C( 65),  INT8_C( 32), -INT8_C( 72),  INT8_C(125), -INT8_C(109), -INT8_C(127),  INT8_C(109) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+    simde_int8x8_t r0 = simde_vcopy_lane_s8(a, 0, b, 7);
+    simde_int8x8_t r1 = simde_vcopy_lane_s8(a, 7, b, 0);
+    simde_int8x8_t r2 = simde_vcopy_lane_s8(a, 4, b, 4);
+
+    simde_test_arm_neon_assert_equal_i8x8(r0, simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r1, simde_vld1_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x8(r2, simde_vld1_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[4];
+    int16_t b[4];
+    int16_t r[3][4];
+  } test_vec[] = {
+    { { -INT16_C(11325),  INT16_C( 8203), -INT16_C(21043),  INT16_C( 4158) },
+      { -INT16_C(15389), -INT16_C( 4716),  INT16_C(19621),  INT16_C( 5932) },
+      { {  INT16_C( 5932),  INT16_C( 8203), -INT16_C(21043),  INT16_C( 4158) },
+        { -INT16_C(11325),  INT16_C( 8203), -INT16_C(21043), -INT16_C(15389) },
+        { -INT16_C(11325),  INT16_C( 8203),  INT16_C(19621),  INT16_C( 4158) } } },
+    { { -INT16_C(32439),  INT16_C( 8503), -INT16_C(31075),  INT16_C(31513) },
+      { -INT16_C(32754),  INT16_C(28164),  INT16_C(13323), -INT16_C(11086) },
+      { { -INT16_C(11086),  INT16_C( 8503), -INT16_C(31075),  INT16_C(31513) },
+        { -INT16_C(32439),  INT16_C( 8503), -INT16_C(31075), -INT16_C(32754) },
+        { -INT16_C(32439),  INT16_C( 8503),  INT16_C(13323),  INT16_C(31513) } } },
+    { {  INT16_C( 3623), -INT16_C(  554), -INT16_C( 5585), -INT16_C(18845) },
+      {  INT16_C(  221),  INT16_C(30262),  INT16_C( 9697), -INT16_C(10409) },
+      { { -INT16_C(10409), -INT16_C(  554), -INT16_C( 5585), -INT16_C(18845) },
+        {  INT16_C( 3623), -INT16_C(  554), -INT16_C( 5585),  INT16_C(  221) },
+        {  INT16_C( 3623), -INT16_C(  554),  INT16_C( 9697), -INT16_C(18845) } } },
+    { { -INT16_C(12736),  INT16_C(18221), -INT16_C(21437),  INT16_C(13924) },
+      { -INT16_C( 7158), -INT16_C( 8785),  INT16_C( 6592),  INT16_C(10697) },
+      { {  INT16_C(10697),  INT16_C(18221), -INT16_C(21437),  INT16_C(13924) },
+        { -INT16_C(12736),  INT16_C(18221), -INT16_C(21437), -INT16_C( 7158) },
+        { -INT16_C(12736),  INT16_C(18221),  INT16_C( 6592),  INT16_C(13924) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_int16x4_t r0 = simde_vcopy_lane_s16(a, 0, b, 3);
+    simde_int16x4_t r1 = simde_vcopy_lane_s16(a, 3, b, 0);
+    simde_int16x4_t r2 = simde_vcopy_lane_s16(a, 2, b, 2);
+
+    simde_test_arm_neon_assert_equal_i16x4(r0, simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r1, simde_vld1_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x4(r2, simde_vld1_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t b[2];
+    int32_t r[3][2];
+  } test_vec[] = {
+    { { -INT32_C(1053194011), -INT32_C( 932486944) },
+      {  INT32_C(1953659103), -INT32_C(1115112681) },
+      { { -INT32_C(1115112681), -INT32_C( 932486944) },
+        { -INT32_C(1053194011),  INT32_C(1953659103) },
+        { -INT32_C(1053194011), -INT32_C(1115112681) } } },
+    { { -INT32_C(1372668890),  INT32_C(1609626563) },
+      { -INT32_C( 886350751), -INT32_C( 619355437) },
+      { { -INT32_C( 619355437),  INT32_C(1609626563) },
+        { -INT32_C(1372668890), -INT32_C( 886350751) },
+        { -INT32_C(1372668890), -INT32_C( 619355437) } } },
+    { {  INT32_C(  85410439), -INT32_C( 263386575) },
+      {  INT32_C( 506276453),  INT32_C( 120808880) },
+      { {  INT32_C( 120808880), -INT32_C( 263386575) },
+        {  INT32_C(  85410439),  INT32_C( 506276453) },
+        {  INT32_C(  85410439),  INT32_C( 120808880) } } },
+    { {  INT32_C( 916241227), -INT32_C(1773110737) },
+      {  INT32_C( 372224012), -INT32_C(2100742352) },
+      { { -INT32_C(2100742352), -INT32_C(1773110737) },
+        {  INT32_C( 916241227),  INT32_C( 372224012) },
+        {  INT32_C( 916241227), -INT32_C(2100742352) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_int32x2_t r0 = simde_vcopy_lane_s32(a, 0, b, 1);
+    simde_int32x2_t r1 = simde_vcopy_lane_s32(a, 1, b, 0);
+    simde_int32x2_t r2 = simde_vcopy_lane_s32(a, 1, b, 1);
+
+    simde_test_arm_neon_assert_equal_i32x2(r0, simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x2(r2, simde_vld1_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[1];
+    int64_t b[1];
+    int64_t r[3][1];
+  } test_vec[] = {
+    { { -INT64_C(1321341059359314319) },
+      {  INT64_C(6981818039569532468) },
+      { {  INT64_C(6981818039569532468) },
+        {  INT64_C(6981818039569532468) },
+        {  INT64_C(6981818039569532468) } } },
+    { { -INT64_C(1669051195670816945) },
+      {  INT64_C(2975132769249103287) },
+      { {  INT64_C(2975132769249103287) },
+        {  INT64_C(2975132769249103287) },
+        {  INT64_C(2975132769249103287) } } },
+    { { -INT64_C(7544722452290138337) },
+      { -INT64_C(2742506168093558204) },
+      { { -INT64_C(2742506168093558204) },
+        { -INT64_C(2742506168093558204) },
+        { -INT64_C(2742506168093558204) } } },
+    { {  INT64_C(1508744207815017798) },
+      {  INT64_C(8918567861162846047) },
+      { {  INT64_C(8918567861162846047) },
+        {  INT64_C(8918567861162846047) },
+        {  INT64_C(8918567861162846047) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t a = simde_vld1_s64(test_vec[i].a);
+    simde_int64x1_t b = simde_vld1_s64(test_vec[i].b);
+    simde_int64x1_t r0 = simde_vcopy_lane_s64(a, 0, b, 0);
+    simde_int64x1_t r1 = simde_vcopy_lane_s64(a, 0, b, 0);
+    simde_int64x1_t r2 = simde_vcopy_lane_s64(a, 0, b, 0);
+
+    simde_test_arm_neon_assert_equal_i64x1(r0, simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r1, simde_vld1_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x1(r2, simde_vld1_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[8];
+    uint8_t b[8];
+    uint8_t r[3][8];
+  } test_vec[] = {
+    { { UINT8_C( 84), UINT8_C(239), UINT8_C(248), UINT8_C(230), UINT8_C(152), UINT8_C( 58), UINT8_C(122), UINT8_C(238) },
+      { UINT8_C(225), UINT8_C(103), UINT8_C(233), UINT8_C( 46), UINT8_C( 72), UINT8_C( 77), UINT8_C(162), UINT8_C(178) },
+      { { UINT8_C(178), UINT8_C(239), UINT8_C(248), UINT8_C(230), UINT8_C(152), UINT8_C( 58), UINT8_C(122), UINT8_C(238) },
+        { UINT8_C( 84), UINT8_C(239), UINT8_C(248), UINT8_C(230), UINT8_C(152), UINT8_C( 58), UINT8_C(122), UINT8_C(225) },
+        { UINT8_C( 84), UINT8_C(239), UINT8_C(248), UINT8_C(230), UINT8_C( 72), UINT8_C( 58), UINT8_C(122), UINT8_C(238) } } },
+    { { UINT8_C(106), UINT8_C(133), UINT8_C(  2), UINT8_C(114), UINT8_C( 50), UINT8_C( 84), UINT8_C( 23), UINT8_C(169) },
+      { UINT8_C(165), UINT8_C(164), UINT8_C( 42), UINT8_C(107), UINT8_C(  4), UINT8_C( 68), UINT8_C(148), UINT8_C(191) },
+      { { UINT8_C(191), UINT8_C(133), UINT8_C(  2), UINT8_C(114), UINT8_C( 50), UINT8_C( 84), UINT8_C( 23), UINT8_C(169) },
+        { UINT8_C(106), UINT8_C(133), UINT8_C(  2), UINT8_C(114), UINT8_C( 50), UINT8_C( 84), UINT8_C( 23), UINT8_C(165) },
+        { UINT8_C(106), UINT8_C(133), UINT8_C(  2), UINT8_C(114), UINT8_C(  4), UINT8_C( 84), UINT8_C( 23), UINT8_C(169) } } },
+    { { UINT8_C( 64), UINT8_C(138), UINT8_C(159), UINT8_C(251), UINT8_C(100), UINT8_C(129), UINT8_C(201), UINT8_C(115) },
+      { UINT8_C(101), UINT8_C(175), UINT8_C(247), UINT8_C( 85), UINT8_C(106), UINT8_C(  4), UINT8_C(116), UINT8_C( 41) },
+      { { UINT8_C( 41), UINT8_C(138), UINT8_C(159), UINT8_C(251), UINT8_C(100), UINT8_C(129), UINT8_C(201), UINT8_C(115) },
+        { UINT8_C( 64), UINT8_C(138), UINT8_C(159), UINT8_C(251), UINT8_C(100), UINT8_C(129), UINT8_C(201), UINT8_C(101) },
+        { UINT8_C( 64), UINT8_C(138), UINT8_C(159), UINT8_C(251), UINT8_C(106), UINT8_C(129), UINT8_C(201), UINT8_C(115) } } },
+    { { UINT8_C( 79), UINT8_C(220), UINT8_C( 35), UINT8_C( 72), UINT8_C(117), UINT8_C(243), UINT8_C( 38), UINT8_C(153) },
+      { UINT8_C(103), UINT8_C(227), UINT8_C(148), UINT8_C(191), UINT8_C(119), UINT8_C(100), UINT8_C(146), UINT8_C(150) },
+      { { UINT8_C(150), UINT8_C(220), UINT8_C( 35), UINT8_C( 72), UINT8_C(117), UINT8_C(243), UINT8_C( 38), UINT8_C(153) },
+        { UINT8_C( 79), UINT8_C(220), UINT8_C( 35), UINT8_C( 72), UINT8_C(117), UINT8_C(243), UINT8_C( 38), UINT8_C(103) },
+        { UINT8_C( 79), UINT8_C(220), UINT8_C( 35), UINT8_C( 72), UINT8_C(119), UINT8_C(243), UINT8_C( 38), UINT8_C(153) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_uint8x8_t b = simde_vld1_u8(test_vec[i].b);
+    simde_uint8x8_t r0 = simde_vcopy_lane_u8(a, 0, b, 7);
+    simde_uint8x8_t r1 = simde_vcopy_lane_u8(a, 7, b, 0);
+    simde_uint8x8_t r2 = simde_vcopy_lane_u8(a, 4, b, 4);
+
+    simde_test_arm_neon_assert_equal_u8x8(r0, simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x8(r2, simde_vld1_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[4];
+    uint16_t b[4];
+    uint16_t r[3][4];
+  } test_vec[] = {
+    { { UINT16_C(48511), UINT16_C(50160), UINT16_C( 1004), UINT16_C(52494) },
+      { UINT16_C(55007), UINT16_C(63471), UINT16_C(52972), UINT16_C(57763) },
+      { { UINT16_C(57763), UINT16_C(50160), UINT16_C( 1004), UINT16_C(52494) },
+        { UINT16_C(48511), UINT16_C(50160), UINT16_C( 1004), UINT16_C(55007) },
+        { UINT16_C(48511), UINT16_C(50160), UINT16_C(52972), UINT16_C(52494) } } },
+    { { UINT16_C(10028), UINT16_C(36951), UINT16_C(34308), UINT16_C(20881) },
+      { UINT16_C(41095), UINT16_C(21664), UINT16_C(56670), UINT16_C(42599) },
+      { { UINT16_C(42599), UINT16_C(36951), UINT16_C(34308), UINT16_C(20881) },
+        { UINT16_C(10028), UINT16_C(36951), UINT16_C(34308), UINT16_C(41095) },
+        { UINT16_C(10028), UINT16_C(36951), UINT16_C(56670), UINT16_C(20881) } } },
+    { { UINT16_C(53575), UINT16_C(57394), UINT16_C( 1395), UINT16_C(51942) },
+      { UINT16_C( 1580), UINT16_C(61440), UINT16_C(58321), UINT16_C(22371) },
+      { { UINT16_C(22371), UINT16_C(57394), UINT16_C( 1395), UINT16_C(51942) },
+        { UINT16_C(53575), UINT16_C(57394), UINT16_C( 1395), UINT16_C( 1580) },
+        { UINT16_C(53575), UINT16_C(57394), UINT16_C(58321), UINT16_C(51942) } } },
+    { { UINT16_C(21677), UINT16_C(31154), UINT16_C( 6471), UINT16_C(38170) },
+      { UINT16_C(51461), UINT16_C(65515), UINT16_C(47124), UINT16_C( 9585) },
+      { { UINT16_C( 9585), UINT16_C(31154), UINT16_C( 6471), UINT16_C(38170) },
+        { UINT16_C(21677), UINT16_C(31154), UINT16_C( 6471), UINT16_C(51461) },
+        { UINT16_C(21677), UINT16_C(31154), UINT16_C(47124), UINT16_C(38170) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t a = simde_vld1_u16(test_vec[i].a);
+    simde_uint16x4_t b = simde_vld1_u16(test_vec[i].b);
+    simde_uint16x4_t r0 = simde_vcopy_lane_u16(a, 0, b, 3);
+    simde_uint16x4_t r1 = simde_vcopy_lane_u16(a, 3, b, 0);
+    simde_uint16x4_t r2 = simde_vcopy_lane_u16(a, 2, b, 2);
+
+    simde_test_arm_neon_assert_equal_u16x4(r0, simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x4(r2, simde_vld1_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    uint32_t b[2];
+    uint32_t r[3][2];
+  } test_vec[] = {
+    { { UINT32_C(4208227507), UINT32_C(1330849588) },
+      { UINT32_C( 770312793), UINT32_C(3989279029) },
+      { { UINT32_C(3989279029), UINT32_C(1330849588) },
+        { UINT32_C(4208227507), UINT32_C( 770312793) },
+        { UINT32_C(4208227507), UINT32_C(3989279029) } } },
+    { { UINT32_C(4197168109), UINT32_C( 239472133) },
+      { UINT32_C( 616829512), UINT32_C(1800334282) },
+      { { UINT32_C(1800334282), UINT32_C( 239472133) },
+        { UINT32_C(4197168109), UINT32_C( 616829512) },
+        { UINT32_C(4197168109), UINT32_C(1800334282) } } },
+    { { UINT32_C(4146058256), UINT32_C(2129422904) },
+      { UINT32_C(1730680905), UINT32_C( 859032105) },
+      { { UINT32_C( 859032105), UINT32_C(2129422904) },
+        { UINT32_C(4146058256), UINT32_C(1730680905) },
+        { UINT32_C(4146058256), UINT32_C( 859032105) } } },
+    { { UINT32_C(2745021363), UINT32_C(4065144897) },
+      { UINT32_C(1584596419), UINT32_C(1821003913) },
+      { { UINT32_C(1821003913), UINT32_C(4065144897) },
+        { UINT32_C(2745021363), UINT32_C(1584596419) },
+        { UINT32_C(2745021363), UINT32_C(1821003913) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t b = simde_vld1_u32(test_vec[i].b);
+    simde_uint32x2_t r0 = simde_vcopy_lane_u32(a, 0, b, 1);
+    simde_uint32x2_t r1 = simde_vcopy_lane_u32(a, 1, b, 0);
+    simde_uint32x2_t r2 = simde_vcopy_lane_u32(a, 1, b, 1);
+
+    simde_test_arm_neon_assert_equal_u32x2(r0, simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x2(r2, simde_vld1_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[1];
+    uint64_t b[1];
+    uint64_t r[3][1];
+  } test_vec[] = {
+    { { UINT64_C( 3843456790920333493) },
+      { UINT64_C( 3211259608557586304) },
+      { { UINT64_C( 3211259608557586304) },
+        { UINT64_C( 3211259608557586304) },
+        { UINT64_C( 3211259608557586304) } } },
+    { { UINT64_C(13380210655745152313) },
+      { UINT64_C( 9006130264447365251) },
+      { { UINT64_C( 9006130264447365251) },
+        { UINT64_C( 9006130264447365251) },
+        { UINT64_C( 9006130264447365251) } } },
+    { { UINT64_C(10962057341944200635) },
+      { UINT64_C(15703658442159003129) },
+      { { UINT64_C(15703658442159003129) },
+        { UINT64_C(15703658442159003129) },
+        { UINT64_C(15703658442159003129) } } },
+    { { UINT64_C( 5578407974907375287) },
+      { UINT64_C( 6089625806786513016) },
+      { { UINT64_C( 6089625806786513016) },
+        { UINT64_C( 6089625806786513016) },
+        { UINT64_C( 6089625806786513016) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t a = simde_vld1_u64(test_vec[i].a);
+    simde_uint64x1_t b = simde_vld1_u64(test_vec[i].b);
+    simde_uint64x1_t r0 = simde_vcopy_lane_u64(a, 0, b, 0);
+    simde_uint64x1_t r1 = simde_vcopy_lane_u64(a, 0, b, 0);
+    simde_uint64x1_t r2 = simde_vcopy_lane_u64(a, 0, b, 0);
+
+    simde_test_arm_neon_assert_equal_u64x1(r0, simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r1, simde_vld1_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x1(r2, simde_vld1_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a[2];
+    simde_float32_t b[4];
+    simde_float32_t r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   923.00), SIMDE_FLOAT32_C(  -240.08) },
+      { SIMDE_FLOAT32_C(  -837.24), SIMDE_FLOAT32_C(   385.98), SIMDE_FLOAT32_C(   751.16), SIMDE_FLOAT32_C(   613.08) },
+      { { SIMDE_FLOAT32_C(   613.08), SIMDE_FLOAT32_C(  -240.08) },
+        { SIMDE_FLOAT32_C(   923.00), SIMDE_FLOAT32_C(  -837.24) },
+        { SIMDE_FLOAT32_C(   923.00), SIMDE_FLOAT32_C(   751.16) } } },
+    { { SIMDE_FLOAT32_C(   356.49), SIMDE_FLOAT32_C(   -55.08) },
+      { SIMDE_FLOAT32_C(    -6.18), SIMDE_FLOAT32_C(  -408.68), SIMDE_FLOAT32_C(   564.23), SIMDE_FLOAT32_C(   680.04) },
+      { { SIMDE_FLOAT32_C(   680.04), SIMDE_FLOAT32_C(   -55.08) },
+        { SIMDE_FLOAT32_C(   356.49), SIMDE_FLOAT32_C(    -6.18) },
+        { SIMDE_FLOAT32_C(   356.49), SIMDE_FLOAT32_C(   564.23) } } },
+    { { SIMDE_FLOAT32_C(   206.08), SIMDE_FLOAT32_C(   541.70) },
+      { SIMDE_FLOAT32_C(   478.27), SIMDE_FLOAT32_C(  -956.38), SIMDE_FLOAT32_C(   223.52), SIMDE_FLOAT32_C(  -412.52) },
+      { { SIMDE_FLOAT32_C(  -412.52), SIMDE_FLOAT32_C(   541.70) },
+        { SIMDE_FLOAT32_C(   206.08), SIMDE_FLOAT32_C(   478.27) },
+        { SIMDE_FLOAT32_C(   206.08), SIMDE_FLOAT32_C(   223.52) } } },
+    { { SIMDE_FLOAT32_C(  -228.03), SIMDE_FLOAT32_C(   929.13) },
+      { SIMDE_FLOAT32_C(  -485.60), SIMDE_FLOAT32_C(  -199.89), SIMDE_FLOAT32_C(  -933.53), SIMDE_FLOAT32_C(   497.94) },
+      { { SIMDE_FLOAT32_C(   497.94), SIMDE_FLOAT32_C(   929.13) },
+        { SIMDE_FLOAT32_C(  -228.03), SIMDE_FLOAT32_C(  -485.60) },
+        { SIMDE_FLOAT32_C(  -228.03), SIMDE_FLOAT32_C(  -933.53) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x2_t r0 = simde_vcopy_laneq_f32(a, 0, b, 3);
+    simde_float32x2_t r1 = simde_vcopy_laneq_f32(a, 1, b, 0);
+    simde_float32x2_t r2 = simde_vcopy_laneq_f32(a, 1, b, 2);
+
+    simde_test_arm_neon_assert_equal_f32x2(r0, simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r1, simde_vld1_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r2, simde_vld1_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a[1];
+    simde_float64_t b[2];
+    simde_float64_t r[3][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -791.01) },
+      { SIMDE_FLOAT64_C(  -262.61), SIMDE_FLOAT64_C(  -472.00) },
+      { { SIMDE_FLOAT64_C(  -472.00) },
+        { SIMDE_FLOAT64_C(  -262.61) },
+        { SIMDE_FLOAT64_C(  -472.00) } } },
+    { { SIMDE_FLOAT64_C(   725.06) },
+      { SIMDE_FLOAT64_C(   176.75), SIMDE_FLOAT64_C(   679.17) },
+      { { SIMDE_FLOAT64_C(   679.17) },
+        { SIMDE_FLOAT64_C(   176.75) },
+        { SIMDE_FLOAT64_C(   679.17) } } },
+    { { SIMDE_FLOAT64_C(   276.63) },
+      { SIMDE_FLOAT64_C(  -726.21), SIMDE_FLOAT64_C(   207.50) },
+      { { SIMDE_FLOAT64_C(   207.50) },
+        { SIMDE_FLOAT64_C(  -726.21) },
+        { SIMDE_FLOAT64_C(   207.50) } } },
+    { { SIMDE_FLOAT64_C(  -224.82) },
+      { SIMDE_FLOAT64_C(  -559.46), SIMDE_FLOAT64_C(   625.13) },
+      { { SIMDE_FLOAT64_C(   625.13) },
+        { SIMDE_FLOAT64_C(  -559.46) },
+        { SIMDE_FLOAT64_C(   625.13) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x1_t r0 = simde_vcopy_laneq_f64(a, 0, b, 1);
+    simde_float64x1_t r1 = simde_vcopy_laneq_f64(a, 0, b, 0);
+    simde_float64x1_t r2 = simde_vcopy_laneq_f64(a, 0, b, 1);
+
+    simde_test_arm_neon_assert_equal_f64x1(r0, simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r1, simde_vld1_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r2, simde_vld1_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[8];
+    int8_t b[16];
+    int8_t r[3][8];
+  } test_vec[] = {
+    { { -INT8_C( 82),  INT8_C( 61), -INT8_C(111), -INT8_C( 41),  INT8_C( 46), -INT8_C(120), -INT8_C( 33),  INT8_C( 78) },
+      { -INT8_C( 41),  INT8_C( 99),  INT8_C(  1),  INT8_C( 36),  INT8_C(  8), -INT8_C( 33),  INT8_C( 99), -INT8_C( 71),
+          -INT8_C( 86), -INT8_C( 80), -INT8_C( 71), -INT8_C( 49),  INT8_C( 84),  INT8_C( 46),  INT8_C( 91),  INT8_C(  6) },
+      { {  INT8_C(  6),  INT8_C( 61), -INT8_C(111), -INT8_C( 41),  INT8_C( 46), -INT8_C(120), -INT8_C( 33),  INT8_C( 78) },
+        { -INT8_C( 82),  INT8_C( 61), -INT8_C(111), -INT8_C( 41),  INT8_C( 46), -INT8_C(120), -INT8_C( 33), -INT8_C( 41) },
+        { -INT8_C( 82),  INT8_C( 61), -INT8_C(111), -INT8_C( 41), -INT8_C( 86), -INT8_C(120), -INT8_C( 33),  INT8_C( 78) } } },
+    { {  INT8_C(  3),  INT8_C(120),  INT8_C( 87),  INT8_C( 11),  INT8_C( 38),  INT8_C( 77), -INT8_C( 70),  INT8_C( 50) },
+      { -INT8_C( 41),  INT8_C( 32),  INT8_C( 40), -INT8_C( 46),  INT8_C(112),  INT8_C(115),  INT8_C( 38), -INT8_C( 56),
+           INT8_C(108),  INT8_C( 13),  INT8_C(110),  INT8_C( 23),  INT8_C(105), -INT8_C(108),  INT8_C( 19),  INT8_C( 77) },
+      { {  INT8_C( 77),  INT8_C(120),  INT8_C( 87),  INT8_C( 11),  INT8_C( 38),  INT8_C( 77), -INT8_C( 70),  INT8_C( 50) },
+        {  INT8_C(  3),  INT8_C(120),  INT8_C( 87),  INT8_C( 11),  INT8_C( 38),  INT8_C( 77), -INT8_C( 70), -INT8_C( 41) },
+        {  INT8_C(  3),  INT8_C(120),  INT8_C( 87),  INT8_C( 11),  INT8_C(108),  INT8_C( 77), -INT8_C( 70),  INT8_C( 50) } } },
+    { { -INT8_C( 50),  INT8_C(107),  INT8_C( 88), -INT8_C(115),  INT8_C( 15),  INT8_C( 66), -INT8_C(124), -INT8_C( 53) },
+      { -INT8_C( 66),  INT8_C( 68), -INT8_C(111), -INT8_C( 63), -INT8_C(  7),  INT8_C(117), -INT8_C( 63), -INT8_C( 44),
+           INT8_C(105),  INT8_C( 58),  INT8_C( 18),  INT8_C( 80),  INT8_C( 20), -INT8_C(  3), -INT8_C( 96),  INT8_C(109) },
+      { {  INT8_C(109),  INT8_C(107),  INT8_C( 88), -INT8_C(115),  INT8_C( 15),  INT8_C( 66), -INT8_C(124), -INT8_C( 53) },
+        { -INT8_C( 50),  INT8_C(107),  INT8_C( 88), -INT8_C(115),  INT8_C( 15),  INT8_C( 66), -INT8_C(124), -INT8_C( 66) },
+        { -INT8_C( 50),  INT8_C(107),  INT8_C( 88), -INT8_C(115),  INT8_C(105),  INT8_C( 66), -INT8_C(124), -INT8_C( 53) } } },
+    { {  INT8_C( 55),  INT8_C( 51),     INT8_MAX,  INT8_C( 96), -INT8_C( 27),  INT8_C( 14), -INT8_C(113),  INT8_C(  8) },
+      {  INT8_C( 30), -INT8_C( 10), -INT8_C( 82), -INT8_C( 82),  INT8_C(  7),  INT8_C( 61),  INT8_C( 82),  INT8_C( 46),
+          -INT8_C( 64),  INT8_C( 67), -INT8_C( 34),  INT8_C( 80),  INT8_C( 18), -INT8_C( 99),  INT8_C( 67),  INT8_C( 55) },
+      { {  INT8_C( 55),  INT8_C( 51),     INT8_MAX,  INT8_C( 96), -INT8_C( 27),  INT8_C( 14), -INT8_C(113),  INT8_C(  8) },
+        {  INT8_C( 55),  INT8_C( 51),     INT8_MAX,  INT8_C( 96), -INT8_C( 27),  INT8_C( 14), -INT8_C(113),  INT8_C( 30) },
+        {  INT8_C( 55),  INT8_C( 51),     INT8_MAX,  INT8_C( 96), -INT8_C( 64),  INT8_C( 14), -INT8_C(113),  INT8_C(  8) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int8x8_t r0 = simde_vcopy_laneq_s8(a, 0, b, 15);
+    simde_int8x8_t r1 = simde_vcopy_laneq_s8(a, 7, b, 0);
+    simde_int8x8_t r2 = simde_vcopy_laneq_s8(a, 4, b, 8);
+
+    simde_test_arm_neon_assert_equal_i8x8(r0, simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r1, simde_vld1_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x8(r2, simde_vld1_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[4];
+    int16_t b[8];
+    int16_t r[3][4];
+  } test_vec[] = {
+    { {  INT16_C( 9077), -INT16_C(14299), -INT16_C( 7973),  INT16_C( 9983) },
+      {  INT16_C(11129), -INT16_C( 4563),  INT16_C(18233), -INT16_C( 4097),  INT16_C(19720), -INT16_C( 6875),  INT16_C(10017),  INT16_C(   76) },
+      { {  INT16_C(   76), -INT16_C(14299), -INT16_C( 7973),  INT16_C( 9983) },
+        {  INT16_C( 9077), -INT16_C(14299), -INT16_C( 7973),  INT16_C(11129) },
+        {  INT16_C( 9077), -INT16_C(14299),  INT16_C(19720),  INT16_C( 9983) } } },
+    { { -INT16_C(  657), -INT16_C(  629), -INT16_C(10308),  INT16_C(32384) },
+      { -INT16_C(25876), -INT16_C(27873), -INT16_C( 7308), -INT16_C( 5701), -INT16_C(32330),  INT16_C(22598),  INT16_C(16542),  INT16_C(  491) },
+      { {  INT16_C(  491), -INT16_C(  629), -INT16_C(10308),  INT16_C(32384) },
+        { -INT16_C(  657), -INT16_C(  629), -INT16_C(10308), -INT16_C(25876) },
+        { -INT16_C(  657), -INT16_C(  629), -INT16_C(32330),  INT16_C(32384) } } },
+    { {  INT16_C(28331), -INT16_C(19819),  INT16_C(28426),  INT16_C(29965) },
+      {  INT16_C( 2737),  INT16_C(25367),  INT16_C(12268),  INT16_C( 1297),  INT16_C(30671),  INT16_C(22083),  INT16_C(14686),  INT16_C( 8481) },
+      { {  INT16_C( 8481), -INT16_C(19819),  INT16_C(28426),  INT16_C(29965) },
+        {  INT16_C(28331), -INT16_C(19819),  INT16_C(28426),  INT16_C( 2737) },
+        {  INT16_C(28331), -INT16_C(19819),  INT16_C(30671),  INT16_C(29965) } } },
+    { { -INT16_C(  680), -INT16_C(20664), -INT16_C( 1516), -INT16_C(  762) },
+      {  INT16_C( 5064),  INT16_C(  113),  INT16_C(15159), -INT16_C(13072),  INT16_C( 9576), -INT16_C(25364),  INT16_C(30482), -INT16_C(23948) },
+      { { -INT16_C(23948), -INT16_C(20664), -INT16_C( 1516), -INT16_C(  762) },
+        { -INT16_C(  680), -INT16_C(20664), -INT16_C( 1516),  INT16_C( 5064) },
+        { -INT16_C(  680), -INT16_C(20664),  INT16_C( 9576), -INT16_C(  762) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_int16x4_t r0 = simde_vcopy_laneq_s16(a, 0, b, 7);
+    simde_int16x4_t r1 = simde_vcopy_laneq_s16(a, 3, b, 0);
+    simde_int16x4_t r2 = simde_vcopy_laneq_s16(a, 2, b, 4);
+
+    simde_test_arm_neon_assert_equal_i16x4(r0, simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r1, simde_vld1_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x4(r2, simde_vld1_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t b[4];
+    int32_t r[3][2];
+  } test_vec[] = {
+    { {  INT32_C(1236783798),  INT32_C(1701341597) },
+      {  INT32_C(1252088192),  INT32_C(2145777782), -INT32_C(1031206821), -INT32_C( 198696095) },
+      { { -INT32_C( 198696095),  INT32_C(1701341597) },
+        {  INT32_C(1236783798),  INT32_C(1252088192) },
+        {  INT32_C(1236783798), -INT32_C(1031206821) } } },
+    { { -INT32_C(1643107546), -INT32_C( 387124815) },
+      { -INT32_C( 125503181), -INT32_C(1571564807),  INT32_C( 457135810),  INT32_C( 614046904) },
+      { {  INT32_C( 614046904), -INT32_C( 387124815) },
+        { -INT32_C(1643107546), -INT32_C( 125503181) },
+        { -INT32_C(1643107546),  INT32_C( 457135810) } } },
+    { {  INT32_C(2032169755),  INT32_C( 111739331) },
+      {  INT32_C(1296185145),  INT32_C(1260433785), -INT32_C(1071620532), -INT32_C( 118331352) },
+      { { -INT32_C( 118331352),  INT32_C( 111739331) },
+        {  INT32_C(2032169755),  INT32_C(1296185145) },
+        {  INT32_C(2032169755), -INT32_C(1071620532) } } },
+    { {  INT32_C(1983202503),  INT32_C(1503138622) },
+      {  INT32_C(1999718519), -INT32_C( 545415257),  INT32_C( 881717535),  INT32_C(1271702133) },
+      { {  INT32_C(1271702133),  INT32_C(1503138622) },
+        {  INT32_C(1983202503),  INT32_C(1999718519) },
+        {  INT32_C(1983202503),  INT32_C( 881717535) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_int32x2_t r0 = simde_vcopy_laneq_s32(a, 0, b, 3);
+    simde_int32x2_t r1 = simde_vcopy_laneq_s32(a, 1, b, 0);
+    simde_int32x2_t r2 = simde_vcopy_laneq_s32(a, 1, b, 2);
+
+    simde_test_arm_neon_assert_equal_i32x2(r0, simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x2(r2, simde_vld1_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[1];
+    int64_t b[2];
+    int64_t r[3][1];
+  } test_vec[] = {
+    { { -INT64_C(7642662854194226421) },
+      {  INT64_C(2182288497184577070), -INT64_C(9097353159413800014) },
+      { { -INT64_C(9097353159413800014) },
+        {  INT64_C(2182288497184577070) },
+        { -INT64_C(9097353159413800014) } } },
+    { {  INT64_C(3578241454140160406) },
+      { -INT64_C(4636287035722882598), -INT64_C(7657779342603950184) },
+      { { -INT64_C(7657779342603950184) },
+        { -INT64_C(4636287035722882598) },
+        { -INT64_C(7657779342603950184) } } },
+    { {  INT64_C(3602649242851310277) },
+      { -INT64_C(1678948086778936873), -INT64_C(7095843487718823198) },
+      { { -INT64_C(7095843487718823198) },
+        { -INT64_C(1678948086778936873) },
+        { -INT64_C(7095843487718823198) } } },
+    { {  INT64_C(7338691425775667793) },
+      {  INT64_C(7880149256322092237),  INT64_C(6170047408605767504) },
+      { {  INT64_C(6170047408605767504) },
+        {  INT64_C(7880149256322092237) },
+        {  INT64_C(6170047408605767504) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t a = simde_vld1_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+    simde_int64x1_t r0 = simde_vcopy_laneq_s64(a, 0, b, 1);
+    simde_int64x1_t r1 = simde_vcopy_laneq_s64(a, 0, b, 0);
+    simde_int64x1_t r2 = simde_vcopy_laneq_s64(a, 0, b, 1);
+
+    simde_test_arm_neon_assert_equal_i64x1(r0, simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r1, simde_vld1_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x1(r2, simde_vld1_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[8];
+    uint8_t b[16];
+    uint8_t r[3][8];
+  } test_vec[] = {
+    { { UINT8_C(187), UINT8_C( 93), UINT8_C(196), UINT8_C(237), UINT8_C( 25), UINT8_C(119), UINT8_C(167), UINT8_C( 68) },
+      { UINT8_C(212), UINT8_C(154), UINT8_C(166), UINT8_C(110), UINT8_C( 28), UINT8_C(204), UINT8_C( 99), UINT8_C(189),
+          UINT8_C(152), UINT8_C( 92), UINT8_C(215), UINT8_C(204), UINT8_C(235), UINT8_C(182), UINT8_C(213), UINT8_C(107) },
+      { { UINT8_C(107), UINT8_C( 93), UINT8_C(196), UINT8_C(237), UINT8_C( 25), UINT8_C(119), UINT8_C(167), UINT8_C( 68) },
+        { UINT8_C(187), UINT8_C( 93), UINT8_C(196), UINT8_C(237), UINT8_C( 25), UINT8_C(119), UINT8_C(167), UINT8_C(212) },
+        { UINT8_C(187), UINT8_C( 93), UINT8_C(196), UINT8_C(237), UINT8_C(152), UINT8_C(119), UINT8_C(167), UINT8_C( 68) } } },
+    { { UINT8_C( 11), UINT8_C( 11), UINT8_C(193), UINT8_C(106), UINT8_C(155), UINT8_C( 22), UINT8_C(188), UINT8_C(161) },
+      { UINT8_C( 53), UINT8_C(102), UINT8_C( 44), UINT8_C(199), UINT8_C(146), UINT8_C(103), UINT8_C( 92), UINT8_C(142),
+          UINT8_C( 39), UINT8_C(109), UINT8_C( 12), UINT8_C( 77), UINT8_C(106), UINT8_C(100), UINT8_C(202), UINT8_C(128) },
+      { { UINT8_C(128), UINT8_C( 11), UINT8_C(193), UINT8_C(106), UINT8_C(155), UINT8_C( 22), UINT8_C(188), UINT8_C(161) },
+        { UINT8_C( 11), UINT8_C( 11), UINT8_C(193), UINT8_C(106), UINT8_C(155), UINT8_C( 22), UINT8_C(188), UINT8_C( 53) },
+        { UINT8_C( 11), UINT8_C( 11), UINT8_C(193), UINT8_C(106), UINT8_C( 39), UINT8_C( 22), UINT8_C(188), UINT8_C(161) } } },
+    { { UINT8_C(242), UINT8_C( 55), UINT8_C(168), UINT8_C(166), UINT8_C(169), UINT8_C( 94), UINT8_C( 53), UINT8_C(247) },
+      { UINT8_C(141), UINT8_C(186), UINT8_C( 42), UINT8_C(248), UINT8_C(203), UINT8_C( 79), UINT8_C(207), UINT8_C(185),
+          UINT8_C(170), UINT8_C(213), UINT8_C(110), UINT8_C( 80), UINT8_C( 37), UINT8_C(182), UINT8_C(224), UINT8_C( 37) },
+      { { UINT8_C( 37), UINT8_C( 55), UINT8_C(168), UINT8_C(166), UINT8_C(169), UINT8_C( 94), UINT8_C( 53), UINT8_C(247) },
+        { UINT8_C(242), UINT8_C( 55), UINT8_C(168), UINT8_C(166), UINT8_C(169), UINT8_C( 94), UINT8_C( 53), UINT8_C(141) },
+        { UINT8_C(242), UINT8_C( 55), UINT8_C(168), UINT8_C(166), UINT8_C(170), UINT8_C( 94), UINT8_C( 53), UINT8_C(247) } } },
+    { { UINT8_C(223), UINT8_C(160), UINT8_C( 24), UINT8_C(124), UINT8_C( 56), UINT8_C(208),    UINT8_MAX, UINT8_C( 70) },
+      { UINT8_C(209), UINT8_C(  9), UINT8_C( 79), UINT8_C(140), UINT8_C(  1), UINT8_C(111), UINT8_C(252), UINT8_C( 97),
+          UINT8_C(103), UINT8_C( 63), UINT8_C(207), UINT8_C(126), UINT8_C(123), UINT8_C( 86), UINT8_C(182), UINT8_C(211) },
+      { { UINT8_C(211), UINT8_C(160), UINT8_C( 24), UINT8_C(124), UINT8_C( 56), UINT8_C(208),    UINT8_MAX, UINT8_C( 70) },
+        { UINT8_C(223), UINT8_C(160), UINT8_C( 24), UINT8_C(124), UINT8_C( 56), UINT8_C(208),    UINT8_MAX, UINT8_C(209) },
+        { UINT8_C(223), UINT8_C(160), UINT8_C( 24), UINT8_C(124), UINT8_C(103), UINT8_C(208),    UINT8_MAX, UINT8_C( 70) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+    simde_uint8x8_t r0 = simde_vcopy_laneq_u8(a, 0, b, 15);
+    simde_uint8x8_t r1 = simde_vcopy_laneq_u8(a, 7, b, 0);
+    simde_uint8x8_t r2 = simde_vcopy_laneq_u8(a, 4, b, 8);
+
+    simde_test_arm_neon_assert_equal_u8x8(r0, simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r1, simde_vld1_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x8(r2, simde_vld1_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[4];
+    uint16_t b[8];
+    uint16_t r[3][4];
+  } test_vec[] = {
+    { { UINT16_C(17036), UINT16_C(37763), UINT16_C(29466), UINT16_C( 6957) },
+      { UINT16_C(24507), UINT16_C(35151), UINT16_C(35256), UINT16_C(49097), UINT16_C(26321), UINT16_C(41370), UINT16_C(64882), UINT16_C(13680) },
+      { { UINT16_C(13680), UINT16_C(37763), UINT16_C(29466), UINT16_C( 6957) },
+        { UINT16_C(17036), UINT16_C(37763), UINT16_C(29466), UINT16_C(24507) },
+        { UINT16_C(17036), UINT16_C(37763), UINT16_C(26321), UINT16_C( 6957) } } },
+    { { UINT16_C( 7663), UINT16_C(27341), UINT16_C(25599), UINT16_C(10540) },
+      { UINT16_C(46108), UINT16_C(16620), UINT16_C(27846), UINT16_C(49817), UINT16_C(11043), UINT16_C(52265), UINT16_C( 7752), UINT16_C(64330) },
+      { { UINT16_C(64330), UINT16_C(27341), UINT16_C(25599), UINT16_C(10540) },
+        { UINT16_C( 7663), UINT16_C(27341), UINT16_C(25599), UINT16_C(46108) },
+        { UINT16_C( 7663), UINT16_C(27341), UINT16_C(11043), UINT16_C(10540) } } },
+    { { UINT16_C(34989), UINT16_C(25824), UINT16_C(18750), UINT16_C(38834) },
+      { UINT16_C(51512), UINT16_C(58203), UINT16_C(35547), UINT16_C(19088), UINT16_C(47488), UINT16_C(63231), UINT16_C(16613), UINT16_C(63795) },
+      { { UINT16_C(63795), UINT16_C(25824), UINT16_C(18750), UINT16_C(38834) },
+        { UINT16_C(34989), UINT16_C(25824), UINT16_C(18750), UINT16_C(51512) },
+        { UINT16_C(34989), UINT16_C(25824), UINT16_C(47488), UINT16_C(38834) } } },
+    { { UINT16_C(44416), UINT16_C(34301), UINT16_C(48112), UINT16_C(58887) },
+      { UINT16_C(44324), UINT16_C(24248), UINT16_C( 7270), UINT16_C(30661), UINT16_C(59978), UINT16_C(29908), UINT16_C(29439), UINT16_C(31098) },
+      { { UINT16_C(31098), UINT16_C(34301), UINT16_C(48112), UINT16_C(58887) },
+        { UINT16_C(44416), UINT16_C(34301), UINT16_C(48112), UINT16_C(44324) },
+        { UINT16_C(44416), UINT16_C(34301), UINT16_C(59978), UINT16_C(58887) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t a = simde_vld1_u16(test_vec[i].a);
+    simde_uint16x8_t b = simde_vld1q_u16(test_vec[i].b);
+    simde_uint16x4_t r0 = simde_vcopy_laneq_u16(a, 0, b, 7);
+    simde_uint16x4_t r1 = simde_vcopy_laneq_u16(a, 3, b, 0);
+    simde_uint16x4_t r2 = simde_vcopy_laneq_u16(a, 2, b, 4);
+
+    simde_test_arm_neon_assert_equal_u16x4(r0, simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r1, simde_vld1_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x4(r2, simde_vld1_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    uint32_t b[4];
+    uint32_t r[3][2];
+  } test_vec[] = {
+    { { UINT32_C(3119857886), UINT32_C( 607072764) },
+      { UINT32_C(3004677705), UINT32_C(2554613409), UINT32_C(1349439205), UINT32_C(2288376828) },
+      { { UINT32_C(2288376828), UINT32_C( 607072764) },
+        { UINT32_C(3119857886), UINT32_C(3004677705) },
+        { UINT32_C(3119857886), UINT32_C(1349439205) } } },
+    { { UINT32_C( 621965290), UINT32_C(2744350850) },
+      { UINT32_C(1582192129), UINT32_C(2260032298), UINT32_C(4065674071), UINT32_C(3156264194) },
+      { { UINT32_C(3156264194), UINT32_C(2744350850) },
+        { UINT32_C( 621965290), UINT32_C(1582192129) },
+        { UINT32_C( 621965290), UINT32_C(4065674071) } } },
+    { { UINT32_C( 505419706), UINT32_C(2376877012) },
+      { UINT32_C(1477398441), UINT32_C(2456383876), UINT32_C(1809404148), UINT32_C(3792460454) },
+      { { UINT32_C(3792460454), UINT32_C(2376877012) },
+        { UINT32_C( 505419706), UINT32_C(1477398441) },
+        { UINT32_C( 505419706), UINT32_C(1809404148) } } },
+    { { UINT32_C(2405182374), UINT32_C(1748745629) },
+      { UINT32_C( 756044325), UINT32_C(2962148893), UINT32_C( 185196916), UINT32_C(2819933020) },
+      { { UINT32_C(2819933020), UINT32_C(1748745629) },
+        { UINT32_C(2405182374), UINT32_C( 756044325) },
+        { UINT32_C(2405182374), UINT32_C( 185196916) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x4_t b = simde_vld1q_u32(test_vec[i].b);
+    simde_uint32x2_t r0 = simde_vcopy_laneq_u32(a, 0, b, 3);
+    simde_uint32x2_t r1 = simde_vcopy_laneq_u32(a, 1, b, 0);
+    simde_uint32x2_t r2 = simde_vcopy_laneq_u32(a, 1, b, 2);
+
+    simde_test_arm_neon_assert_equal_u32x2(r0, simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x2(r2, simde_vld1_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopy_laneq_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[1];
+    uint64_t b[2];
+    uint64_t r[3][1];
+  } test_vec[] = {
+    { { UINT64_C(17522188220874999963) },
+      { UINT64_C(17940872329178565407), UINT64_C(17375142141712404210) },
+      { { UINT64_C(17375142141712404210) },
+        { UINT64_C(17940872329178565407) },
+        { UINT64_C(17375142141712404210) } } },
+    { { UINT64_C( 6263638771027789711) },
+      { UINT64_C(12432142648688942634), UINT64_C( 9037675411834009488) },
+      { { UINT64_C( 9037675411834009488) },
+        { UINT64_C(12432142648688942634) },
+        { UINT64_C( 9037675411834009488) } } },
+    { { UINT64_C(13340505702461524905) },
+      { UINT64_C(15386202921021908199), UINT64_C( 7556756268532597861) },
+      { { UINT64_C( 7556756268532597861) },
+        { UINT64_C(15386202921021908199) },
+        { UINT64_C( 7556756268532597861) } } },
+    { { UINT64_C( 4501047641555708643) },
+      { UINT64_C( 1058418686052742627), UINT64_C(11973877695946207075) },
+      { { UINT64_C(11973877695946207075) },
+        { UINT64_C( 1058418686052742627) },
+        { UINT64_C(11973877695946207075) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t a = simde_vld1_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+    simde_uint64x1_t r0 = simde_vcopy_laneq_u64(a, 0, b, 1);
+    simde_uint64x1_t r1 = simde_vcopy_laneq_u64(a, 0, b, 0);
+    simde_uint64x1_t r2 = simde_vcopy_laneq_u64(a, 0, b, 1);
+
+    simde_test_arm_neon_assert_equal_u64x1(r0, simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r1, simde_vld1_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x1(r2, simde_vld1_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a[4];
+    simde_float32_t b[2];
+    simde_float32_t r[3][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -411.04), SIMDE_FLOAT32_C(   276.89), SIMDE_FLOAT32_C(  -545.19), SIMDE_FLOAT32_C(   414.77) },
+      { SIMDE_FLOAT32_C(   529.32), SIMDE_FLOAT32_C(   388.02) },
+      { { SIMDE_FLOAT32_C(   388.02), SIMDE_FLOAT32_C(   276.89), SIMDE_FLOAT32_C(  -545.19), SIMDE_FLOAT32_C(   414.77) },
+        { SIMDE_FLOAT32_C(  -411.04), SIMDE_FLOAT32_C(   276.89), SIMDE_FLOAT32_C(  -545.19), SIMDE_FLOAT32_C(   529.32) },
+        { SIMDE_FLOAT32_C(  -411.04), SIMDE_FLOAT32_C(   276.89), SIMDE_FLOAT32_C(   388.02), SIMDE_FLOAT32_C(   414.77) } } },
+    { { SIMDE_FLOAT32_C(   519.59), SIMDE_FLOAT32_C(    94.31), SIMDE_FLOAT32_C(  -260.00), SIMDE_FLOAT32_C(  -765.83) },
+      { SIMDE_FLOAT32_C(  -195.89), SIMDE_FLOAT32_C(   594.22) },
+      { { SIMDE_FLOAT32_C(   594.22), SIMDE_FLOAT32_C(    94.31), SIMDE_FLOAT32_C(  -260.00), SIMDE_FLOAT32_C(  -765.83) },
+        { SIMDE_FLOAT32_C(   519.59), SIMDE_FLOAT32_C(    94.31), SIMDE_FLOAT32_C(  -260.00), SIMDE_FLOAT32_C(  -195.89) },
+        { SIMDE_FLOAT32_C(   519.59), SIMDE_FLOAT32_C(    94.31), SIMDE_FLOAT32_C(   594.22), SIMDE_FLOAT32_C(  -765.83) } } },
+    { { SIMDE_FLOAT32_C(   767.12), SIMDE_FLOAT32_C(  -132.11), SIMDE_FLOAT32_C(  -579.47), SIMDE_FLOAT32_C(   425.04) },
+      { SIMDE_FLOAT32_C(   687.40), SIMDE_FLOAT32_C(  -696.19) },
+      { { SIMDE_FLOAT32_C(  -696.19), SIMDE_FLOAT32_C(  -132.11), SIMDE_FLOAT32_C(  -579.47), SIMDE_FLOAT32_C(   425.04) },
+        { SIMDE_FLOAT32_C(   767.12), SIMDE_FLOAT32_C(  -132.11), SIMDE_FLOAT32_C(  -579.47), SIMDE_FLOAT32_C(   687.40) },
+        { SIMDE_FLOAT32_C(   767.12), SIMDE_FLOAT32_C(  -132.11), SIMDE_FLOAT32_C(  -696.19), SIMDE_FLOAT32_C(   425.04) } } },
+    { { SIMDE_FLOAT32_C(   517.55), SIMDE_FLOAT32_C(   944.43), SIMDE_FLOAT32_C(   458.84), SIMDE_FLOAT32_C(  -888.47) },
+      { SIMDE_FLOAT32_C(   -14.77), SIMDE_FLOAT32_C(   455.83) },
+      { { SIMDE_FLOAT32_C(   455.83), SIMDE_FLOAT32_C(   944.43), SIMDE_FLOAT32_C(   458.84), SIMDE_FLOAT32_C(  -888.47) },
+        { SIMDE_FLOAT32_C(   517.55), SIMDE_FLOAT32_C(   944.43), SIMDE_FLOAT32_C(   458.84), SIMDE_FLOAT32_C(   -14.77) },
+        { SIMDE_FLOAT32_C(   517.55), SIMDE_FLOAT32_C(   944.43), SIMDE_FLOAT32_C(   455.83), SIMDE_FLOAT32_C(  -888.47) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x4_t r0 = simde_vcopyq_lane_f32(a, 0, b, 1);
+    simde_float32x4_t r1 = simde_vcopyq_lane_f32(a, 3, b, 0);
+    simde_float32x4_t r2 = simde_vcopyq_lane_f32(a, 2, b, 1);
+
+    simde_test_arm_neon_assert_equal_f32x4(r0, simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r1, simde_vld1q_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r2, simde_vld1q_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a[2];
+    simde_float64_t b[1];
+    simde_float64_t r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   990.36), SIMDE_FLOAT64_C(    -2.42) },
+      { SIMDE_FLOAT64_C(  -389.41) },
+      { { SIMDE_FLOAT64_C(  -389.41), SIMDE_FLOAT64_C(    -2.42) },
+        { SIMDE_FLOAT64_C(   990.36), SIMDE_FLOAT64_C(  -389.41) },
+        { SIMDE_FLOAT64_C(   990.36), SIMDE_FLOAT64_C(  -389.41) } } },
+    { { SIMDE_FLOAT64_C(  -807.57), SIMDE_FLOAT64_C(   567.20) },
+      { SIMDE_FLOAT64_C(   326.88) },
+      { { SIMDE_FLOAT64_C(   326.88), SIMDE_FLOAT64_C(   567.20) },
+        { SIMDE_FLOAT64_C(  -807.57), SIMDE_FLOAT64_C(   326.88) },
+        { SIMDE_FLOAT64_C(  -807.57), SIMDE_FLOAT64_C(   326.88) } } },
+    { { SIMDE_FLOAT64_C(  -781.18), SIMDE_FLOAT64_C(  -691.99) },
+      { SIMDE_FLOAT64_C(  -729.57) },
+      { { SIMDE_FLOAT64_C(  -729.57), SIMDE_FLOAT64_C(  -691.99) },
+        { SIMDE_FLOAT64_C(  -781.18), SIMDE_FLOAT64_C(  -729.57) },
+        { SIMDE_FLOAT64_C(  -781.18), SIMDE_FLOAT64_C(  -729.57) } } },
+    { { SIMDE_FLOAT64_C(   646.43), SIMDE_FLOAT64_C(   411.82) },
+      { SIMDE_FLOAT64_C(  -300.31) },
+      { { SIMDE_FLOAT64_C(  -300.31), SIMDE_FLOAT64_C(   411.82) },
+        { SIMDE_FLOAT64_C(   646.43), SIMDE_FLOAT64_C(  -300.31) },
+        { SIMDE_FLOAT64_C(   646.43), SIMDE_FLOAT64_C(  -300.31) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x2_t r0 = simde_vcopyq_lane_f64(a, 0, b, 0);
+    simde_float64x2_t r1 = simde_vcopyq_lane_f64(a, 1, b, 0);
+    simde_float64x2_t r2 = simde_vcopyq_lane_f64(a, 1, b, 0);
+
+    simde_test_arm_neon_assert_equal_f64x2(r0, simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r1, simde_vld1q_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r2, simde_vld1q_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[8];
+    int8_t r[3][16];
+  } test_vec[] = {
+    { { -INT8_C( 42),  INT8_C(107), -INT8_C( 29),  INT8_C( 93),  INT8_C(  0),  INT8_C( 67), -INT8_C(107), -INT8_C( 44),
+          -INT8_C( 21), -INT8_C( 10), -INT8_C( 20),  INT8_C( 18),  INT8_C(100), -INT8_C( 71),  INT8_C(103),  INT8_C( 61) },
+      { -INT8_C( 57), -INT8_C( 68), -INT8_C( 57),  INT8_C( 70), -INT8_C( 79),  INT8_C( 86), -INT8_C( 94),  INT8_C( 88) },
+      { {  INT8_C( 88),  INT8_C(107), -INT8_C( 29),  INT8_C( 93),  INT8_C(  0),  INT8_C( 67), -INT8_C(107), -INT8_C( 44),
+          -INT8_C( 21), -INT8_C( 10), -INT8_C( 20),  INT8_C( 18),  INT8_C(100), -INT8_C( 71),  INT8_C(103),  INT8_C( 61) },
+        { -INT8_C( 42),  INT8_C(107), -INT8_C( 29),  INT8_C( 93),  INT8_C(  0),  INT8_C( 67), -INT8_C(107), -INT8_C( 44),
+          -INT8_C( 21), -INT8_C( 10), -INT8_C( 20),  INT8_C( 18),  INT8_C(100), -INT8_C( 71),  INT8_C(103), -INT8_C( 57) },
+        { -INT8_C( 42),  INT8_C(107), -INT8_C( 29),  INT8_C( 93),  INT8_C(  0),  INT8_C( 67), -INT8_C(107), -INT8_C( 44),
+          -INT8_C( 79), -INT8_C( 10), -INT8_C( 20),  INT8_C( 18),  INT8_C(100), -INT8_C( 71),  INT8_C(103),  INT8_C( 61) } } },
+    { { -INT8_C( 73),  INT8_C( 97), -INT8_C(120),  INT8_C( 79), -INT8_C( 45), -INT8_C( 52),  INT8_C( 28),  INT8_C( 75),
+           INT8_C( 96), -INT8_C( 62),  INT8_C(120),  INT8_C( 66),  INT8_C(106), -INT8_C( 23),  INT8_C(107), -INT8_C( 32) },
+      {  INT8_C( 28),  INT8_C( 11), -INT8_C( 22),  INT8_C(  3),  INT8_C( 25), -INT8_C( 47),  INT8_C( 38), -INT8_C( 90) },
+      { { -INT8_C( 90),  INT8_C( 97), -INT8_C(120),  INT8_C( 79), -INT8_C( 45), -INT8_C( 52),  INT8_C( 28),  INT8_C( 75),
+           INT8_C( 96), -INT8_C( 62),  INT8_C(120),  INT8_C( 66),  INT8_C(106), -INT8_C( 23),  INT8_C(107), -INT8_C( 32) },
+        { -INT8_C( 73),  INT8_C( 97), -INT8_C(120),  INT8_C( 79), -INT8_C( 45), -INT8_C( 52),  INT8_C( 28),  INT8_C( 75),
+           INT8_C( 96), -INT8_C( 62),  INT8_C(120),  INT8_C( 66),  INT8_C(106), -INT8_C( 23),  INT8_C(107),  INT8_C( 28) },
+        { -INT8_C( 73),  INT8_C( 97), -INT8_C(120),  INT8_C( 79), -INT8_C( 45), -INT8_C( 52),  INT8_C( 28),  INT8_C( 75),
+           INT8_C( 25), -INT8_C( 62),  INT8_C(120),  INT8_C( 66),  INT8_C(106), -INT8_C( 23),  INT8_C(107), -INT8_C( 32) } } },
+    { { -INT8_C( 77),  INT8_C(  8),  INT8_C( 95), -INT8_C(127),  INT8_C( 92), -INT8_C( 54),  INT8_C( 38), -INT8_C( 81),
+           INT8_C( 12),  INT8_C(104), -INT8_C(122),  INT8_C(102),  INT8_C(110), -INT8_C( 13), -INT8_C(116), -INT8_C(106) },
+      { -INT8_C(  4),  INT8_C(  2), -INT8_C(  2), -INT8_C(121), -INT8_C(101), -INT8_C(  9), -INT8_C(127),  INT8_C(110) },
+      { {  INT8_C(110),  INT8_C(  8),  INT8_C( 95), -INT8_C(127),  INT8_C( 92), -INT8_C( 54),  INT8_C( 38), -INT8_C( 81),
+           INT8_C( 12),  INT8_C(104), -INT8_C(122),  INT8_C(102),  INT8_C(110), -INT8_C( 13), -INT8_C(116), -INT8_C(106) },
+        { -INT8_C( 77),  INT8_C(  8),  INT8_C( 95), -INT8_C(127),  INT8_C( 92), -INT8_C( 54),  INT8_C( 38), -INT8_C( 81),
+           INT8_C( 12),  INT8_C(104), -INT8_C(122),  INT8_C(102),  INT8_C(110), -INT8_C( 13), -INT8_C(116), -INT8_C(  4) },
+        { -INT8_C( 77),  INT8_C(  8),  INT8_C( 95), -INT8_C(127),  INT8_C( 92), -INT8_C( 54),  INT8_C( 38), -INT8_C( 81),
+          -INT8_C(101),  INT8_C(104), -INT8_C(122),  INT8_C(102),  INT8_C(110), -INT8_C( 13), -INT8_C(116), -INT8_C(106) } } },
+    { { -INT8_C( 31), -INT8_C( 77), -INT8_C( 46),  INT8_C( 72), -INT8_C( 35),  INT8_C( 39),  INT8_C( 15), -INT8_C( 14),
+           INT8_C(  4),  INT8_C( 26),  INT8_C( 36), -INT8_C( 79),  INT8_C(101), -INT8_C( 31), -INT8_C( 36),  INT8_C( 22) },
+      {  INT8_C( 25), -INT8_C(114), -INT8_C(110), -INT8_C(125),  INT8_C( 97), -INT8_C( 97),  INT8_C(106),  INT8_C( 73) },
+      { {  INT8_C( 73), -INT8_C( 77), -INT8_C( 46),  INT8_C( 72), -INT8_C( 35),  INT8_C( 39),  INT8_C( 15), -INT8_C( 14),
+           INT8_C(  4),  INT8_C( 26),  INT8_C( 36), -INT8_C( 79),  INT8_C(101), -INT8_C( 31), -INT8_C( 36),  INT8_C( 22) },
+        { -INT8_C( 31), -INT8_C( 77), -INT8_C( 46),  INT8_C( 72), -INT8_C( 35),  INT8_C( 39),  INT8_C( 15), -INT8_C( 14),
+           INT8_C(  4),  INT8_C( 26),  INT8_C( 36), -INT8_C( 79),  INT8_C(101), -INT8_C( 31), -INT8_C( 36),  INT8_C( 25) },
+        { -INT8_C( 31), -INT8_C( 77), -INT8_C( 46),  INT8_C( 72), -INT8_C( 35),  INT8_C( 39),  INT8_C( 15), -INT8_C( 14),
+           INT8_C( 97),  INT8_C( 26),  INT8_C( 36), -INT8_C( 79),  INT8_C(101), -INT8_C( 31), -INT8_C( 36),  INT8_C( 22) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+    simde_int8x16_t r0 = simde_vcopyq_lane_s8(a, 0, b, 7);
+    simde_int8x16_t r1 = simde_vcopyq_lane_s8(a, 15, b, 0);
+    simde_int8x16_t r2 = simde_vcopyq_lane_s8(a, 8, b, 4);
+
+    simde_test_arm_neon_assert_equal_i8x16(r0, simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r1, simde_vld1q_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x16(r2, simde_vld1q_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[4];
+    int16_t r[3][8];
+  } test_vec[] = {
+    { { -INT16_C(23292), -INT16_C( 5101), -INT16_C(20287), -INT16_C( 7725), -INT16_C(32605),  INT16_C(18205), -INT16_C(  276),  INT16_C(11552) },
+      { -INT16_C(25530), -INT16_C(15952), -INT16_C(16918), -INT16_C(27772) },
+      { { -INT16_C(27772), -INT16_C( 5101), -INT16_C(20287), -INT16_C( 7725), -INT16_C(32605),  INT16_C(18205), -INT16_C(  276),  INT16_C(11552) },
+        { -INT16_C(23292), -INT16_C( 5101), -INT16_C(20287), -INT16_C( 7725), -INT16_C(32605),  INT16_C(18205), -INT16_C(  276), -INT16_C(25530) },
+        { -INT16_C(23292), -INT16_C( 5101), -INT16_C(20287), -INT16_C( 7725), -INT16_C(16918),  INT16_C(18205), -INT16_C(  276),  INT16_C(11552) } } },
+    { {  INT16_C(21045),  INT16_C(30632), -INT16_C(11240),  INT16_C( 8107), -INT16_C(14064),  INT16_C(21927),  INT16_C(14275),  INT16_C(15247) },
+      {  INT16_C(28585),  INT16_C(21577),  INT16_C(19525),  INT16_C( 2746) },
+      { {  INT16_C( 2746),  INT16_C(30632), -INT16_C(11240),  INT16_C( 8107), -INT16_C(14064),  INT16_C(21927),  INT16_C(14275),  INT16_C(15247) },
+        {  INT16_C(21045),  INT16_C(30632), -INT16_C(11240),  INT16_C( 8107), -INT16_C(14064),  INT16_C(21927),  INT16_C(14275),  INT16_C(28585) },
+        {  INT16_C(21045),  INT16_C(30632), -INT16_C(11240),  INT16_C( 8107),  INT16_C(19525),  INT16_C(21927),  INT16_C(14275),  INT16_C(15247) } } },
+    { {  INT16_C( 5309), -INT16_C(24977), -INT16_C( 1196),  INT16_C(30758),  INT16_C( 8331), -INT16_C(17142),  INT16_C(14425),  INT16_C(25849) },
+      { -INT16_C(23459),  INT16_C(28346),  INT16_C( 4508), -INT16_C( 3802) },
+      { { -INT16_C( 3802), -INT16_C(24977), -INT16_C( 1196),  INT16_C(30758),  INT16_C( 8331), -INT16_C(17142),  INT16_C(14425),  INT16_C(25849) },
+        {  INT16_C( 5309), -INT16_C(24977), -INT16_C( 1196),  INT16_C(30758),  INT16_C( 8331), -INT16_C(17142),  INT16_C(14425), -INT16_C(23459) },
+        {  INT16_C( 5309), -INT16_C(24977), -INT16_C( 1196),  INT16_C(30758),  INT16_C( 4508), -INT16_C(17142),  INT16_C(14425),  INT16_C(25849) } } },
+    { { -INT16_C(31575), -INT16_C( 8319), -INT16_C( 3091), -INT16_C(22704),  INT16_C(12933), -INT16_C( 9171), -INT16_C(10497),  INT16_C(11219) },
+      { -INT16_C(30749),  INT16_C(24757), -INT16_C( 5000),  INT16_C(11901) },
+      { {  INT16_C(11901), -INT16_C( 8319), -INT16_C( 3091), -INT16_C(22704),  INT16_C(12933), -INT16_C( 9171), -INT16_C(10497),  INT16_C(11219) },
+        { -INT16_C(31575), -INT16_C( 8319), -INT16_C( 3091), -INT16_C(22704),  INT16_C(12933), -INT16_C( 9171), -INT16_C(10497), -INT16_C(30749) },
+        { -INT16_C(31575), -INT16_C( 8319), -INT16_C( 3091), -INT16_C(22704), -INT16_C( 5000), -INT16_C( 9171), -INT16_C(10497),  INT16_C(11219) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_int16x8_t r0 = simde_vcopyq_lane_s16(a, 0, b, 3);
+    simde_int16x8_t r1 = simde_vcopyq_lane_s16(a, 7, b, 0);
+    simde_int16x8_t r2 = simde_vcopyq_lane_s16(a, 4, b, 2);
+
+    simde_test_arm_neon_assert_equal_i16x8(r0, simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r1, simde_vld1q_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x8(r2, simde_vld1q_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[2];
+    int32_t r[3][4];
+  } test_vec[] = {
+    { { -INT32_C(1533669849),  INT32_C( 350857630),  INT32_C( 607940847), -INT32_C(1110472840) },
+      { -INT32_C(1095192708),  INT32_C(1308910299) },
+      { {  INT32_C(1308910299),  INT32_C( 350857630),  INT32_C( 607940847), -INT32_C(1110472840) },
+        { -INT32_C(1533669849),  INT32_C( 350857630),  INT32_C( 607940847), -INT32_C(1095192708) },
+        { -INT32_C(1533669849),  INT32_C( 350857630),  INT32_C(1308910299), -INT32_C(1110472840) } } },
+    { {  INT32_C( 278237065),  INT32_C(1183533066),  INT32_C( 355913901), -INT32_C(1398746803) },
+      { -INT32_C(1857257430),  INT32_C( 112302544) },
+      { {  INT32_C( 112302544),  INT32_C(1183533066),  INT32_C( 355913901), -INT32_C(1398746803) },
+        {  INT32_C( 278237065),  INT32_C(1183533066),  INT32_C( 355913901), -INT32_C(1857257430) },
+        {  INT32_C( 278237065),  INT32_C(1183533066),  INT32_C( 112302544), -INT32_C(1398746803) } } },
+    { {  INT32_C(1820682930), -INT32_C( 355933820),  INT32_C( 103572803),  INT32_C(1348227717) },
+      { -INT32_C( 165861864), -INT32_C(1738961797) },
+      { { -INT32_C(1738961797), -INT32_C( 355933820),  INT32_C( 103572803),  INT32_C(1348227717) },
+        {  INT32_C(1820682930), -INT32_C( 355933820),  INT32_C( 103572803), -INT32_C( 165861864) },
+        {  INT32_C(1820682930), -INT32_C( 355933820), -INT32_C(1738961797),  INT32_C(1348227717) } } },
+    { {  INT32_C(1133057540),  INT32_C(1368486842),  INT32_C(1584002166), -INT32_C(1835047711) },
+      { -INT32_C( 682268834),  INT32_C( 685728855) },
+      { {  INT32_C( 685728855),  INT32_C(1368486842),  INT32_C(1584002166), -INT32_C(1835047711) },
+        {  INT32_C(1133057540),  INT32_C(1368486842),  INT32_C(1584002166), -INT32_C( 682268834) },
+        {  INT32_C(1133057540),  INT32_C(1368486842),  INT32_C( 685728855), -INT32_C(1835047711) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_int32x4_t r0 = simde_vcopyq_lane_s32(a, 0, b, 1);
+    simde_int32x4_t r1 = simde_vcopyq_lane_s32(a, 3, b, 0);
+    simde_int32x4_t r2 = simde_vcopyq_lane_s32(a, 2, b, 1);
+
+    simde_test_arm_neon_assert_equal_i32x4(r0, simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r1, simde_vld1q_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x4(r2, simde_vld1q_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t b[1];
+    int64_t r[3][2];
+  } test_vec[] = {
+    { {  INT64_C(3250176141517654827),  INT64_C(4502184102773746903) },
+      { -INT64_C( 411604326447061966) },
+      { { -INT64_C( 411604326447061966),  INT64_C(4502184102773746903) },
+        {  INT64_C(3250176141517654827), -INT64_C( 411604326447061966) },
+        {  INT64_C(3250176141517654827), -INT64_C( 411604326447061966) } } },
+    { {  INT64_C(9022378131408835567), -INT64_C(3176967327655923260) },
+      { -INT64_C(6875766711573255953) },
+      { { -INT64_C(6875766711573255953), -INT64_C(3176967327655923260) },
+        {  INT64_C(9022378131408835567), -INT64_C(6875766711573255953) },
+        {  INT64_C(9022378131408835567), -INT64_C(6875766711573255953) } } },
+    { { -INT64_C(5819299001125989826),  INT64_C(5578485356407753910) },
+      { -INT64_C(2438407964479789836) },
+      { { -INT64_C(2438407964479789836),  INT64_C(5578485356407753910) },
+        { -INT64_C(5819299001125989826), -INT64_C(2438407964479789836) },
+        { -INT64_C(5819299001125989826), -INT64_C(2438407964479789836) } } },
+    { { -INT64_C(8859740535213761159), -INT64_C(6232800446699681011) },
+      { -INT64_C(8033572476805368847) },
+      { { -INT64_C(8033572476805368847), -INT64_C(6232800446699681011) },
+        { -INT64_C(8859740535213761159), -INT64_C(8033572476805368847) },
+        { -INT64_C(8859740535213761159), -INT64_C(8033572476805368847) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x1_t b = simde_vld1_s64(test_vec[i].b);
+    simde_int64x2_t r0 = simde_vcopyq_lane_s64(a, 0, b, 0);
+    simde_int64x2_t r1 = simde_vcopyq_lane_s64(a, 1, b, 0);
+    simde_int64x2_t r2 = simde_vcopyq_lane_s64(a, 1, b, 0);
+
+    simde_test_arm_neon_assert_equal_i64x2(r0, simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r1, simde_vld1q_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x2(r2, simde_vld1q_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[8];
+    uint8_t r[3][16];
+  } test_vec[] = {
+    { { UINT8_C(173), UINT8_C(105), UINT8_C( 39), UINT8_C(178), UINT8_C( 42), UINT8_C( 66), UINT8_C(214), UINT8_C(131),
+          UINT8_C( 93), UINT8_C(118), UINT8_C( 73), UINT8_C(118), UINT8_C(190), UINT8_C(185), UINT8_C( 20), UINT8_C( 70) },
+      { UINT8_C(  1), UINT8_C(188), UINT8_C( 75), UINT8_C(218), UINT8_C( 85), UINT8_C(134), UINT8_C(198), UINT8_C( 50) },
+      { { UINT8_C( 50), UINT8_C(105), UINT8_C( 39), UINT8_C(178), UINT8_C( 42), UINT8_C( 66), UINT8_C(214), UINT8_C(131),
+          UINT8_C( 93), UINT8_C(118), UINT8_C( 73), UINT8_C(118), UINT8_C(190), UINT8_C(185), UINT8_C( 20), UINT8_C( 70) },
+        { UINT8_C(173), UINT8_C(105), UINT8_C( 39), UINT8_C(178), UINT8_C( 42), UINT8_C( 66), UINT8_C(214), UINT8_C(131),
+          UINT8_C( 93), UINT8_C(118), UINT8_C( 73), UINT8_C(118), UINT8_C(190), UINT8_C(185), UINT8_C( 20), UINT8_C(  1) },
+        { UINT8_C(173), UINT8_C(105), UINT8_C( 39), UINT8_C(178), UINT8_C( 42), UINT8_C( 66), UINT8_C(214), UINT8_C(131),
+          UINT8_C( 85), UINT8_C(118), UINT8_C( 73), UINT8_C(118), UINT8_C(190), UINT8_C(185), UINT8_C( 20), UINT8_C( 70) } } },
+    { { UINT8_C(219), UINT8_C( 86), UINT8_C( 89), UINT8_C(251), UINT8_C(124), UINT8_C( 71), UINT8_C(148), UINT8_C(163),
+          UINT8_C(186), UINT8_C(190), UINT8_C(112), UINT8_C(243), UINT8_C( 34), UINT8_C(178), UINT8_C(223), UINT8_C(241) },
+      { UINT8_C(127), UINT8_C( 96), UINT8_C( 81), UINT8_C(167), UINT8_C(114), UINT8_C(241), UINT8_C(106), UINT8_C( 18) },
+      { { UINT8_C( 18), UINT8_C( 86), UINT8_C( 89), UINT8_C(251), UINT8_C(124), UINT8_C( 71), UINT8_C(148), UINT8_C(163),
+          UINT8_C(186), UINT8_C(190), UINT8_C(112), UINT8_C(243), UINT8_C( 34), UINT8_C(178), UINT8_C(223), UINT8_C(241) },
+        { UINT8_C(219), UINT8_C( 86), UINT8_C( 89), UINT8_C(251), UINT8_C(124), UINT8_C( 71), UINT8_C(148), UINT8_C(163),
+          UINT8_C(186), UINT8_C(190), UINT8_C(112), UINT8_C(243), UINT8_C( 34), UINT8_C(178), UINT8_C(223), UINT8_C(127) },
+        { UINT8_C(219), UINT8_C( 86), UINT8_C( 89), UINT8_C(251), UINT8_C(124), UINT8_C( 71), UINT8_C(148), UINT8_C(163),
+          UINT8_C(114), UINT8_C(190), UINT8_C(112), UINT8_C(243), UINT8_C( 34), UINT8_C(178), UINT8_C(223), UINT8_C(241) } } },
+    { { UINT8_C(232), UINT8_C( 83), UINT8_C( 45), UINT8_C(165), UINT8_C( 92), UINT8_C(235), UINT8_C(137), UINT8_C( 27),
+          UINT8_C(225), UINT8_C( 37), UINT8_C( 69), UINT8_C(148), UINT8_C( 84), UINT8_C( 21), UINT8_C(246), UINT8_C( 34) },
+      { UINT8_C(203), UINT8_C( 84), UINT8_C(169), UINT8_C(109), UINT8_C(119), UINT8_C( 19), UINT8_C(175), UINT8_C(169) },
+      { { UINT8_C(169), UINT8_C( 83), UINT8_C( 45), UINT8_C(165), UINT8_C( 92), UINT8_C(235), UINT8_C(137), UINT8_C( 27),
+          UINT8_C(225), UINT8_C( 37), UINT8_C( 69), UINT8_C(148), UINT8_C( 84), UINT8_C( 21), UINT8_C(246), UINT8_C( 34) },
+        { UINT8_C(232), UINT8_C( 83), UINT8_C( 45), UINT8_C(165), UINT8_C( 92), UINT8_C(235), UINT8_C(137), UINT8_C( 27),
+          UINT8_C(225), UINT8_C( 37), UINT8_C( 69), UINT8_C(148), UINT8_C( 84), UINT8_C( 21), UINT8_C(246), UINT8_C(203) },
+        { UINT8_C(232), UINT8_C( 83), UINT8_C( 45), UINT8_C(165), UINT8_C( 92), UINT8_C(235), UINT8_C(137), UINT8_C( 27),
+          UINT8_C(119), UINT8_C( 37), UINT8_C( 69), UINT8_C(148), UINT8_C( 84), UINT8_C( 21), UINT8_C(246), UINT8_C( 34) } } },
+    { { UINT8_C(154), UINT8_C(192), UINT8_C(205), UINT8_C(243), UINT8_C( 29), UINT8_C(222), UINT8_C( 56), UINT8_C(143),
+          UINT8_C( 27), UINT8_C( 26), UINT8_C(105), UINT8_C( 39), UINT8_C( 82), UINT8_C( 51), UINT8_C(165), UINT8_C( 98) },
+      { UINT8_C(175), UINT8_C(103), UINT8_C(134), UINT8_C(120), UINT8_C(170), UINT8_C( 31), UINT8_C(229), UINT8_C(105) },
+      { { UINT8_C(105), UINT8_C(192), UINT8_C(205), UINT8_C(243), UINT8_C( 29), UINT8_C(222), UINT8_C( 56), UINT8_C(143),
+          UINT8_C( 27), UINT8_C( 26), UINT8_C(105), UINT8_C( 39), UINT8_C( 82), UINT8_C( 51), UINT8_C(165), UINT8_C( 98) },
+        { UINT8_C(154), UINT8_C(192), UINT8_C(205), UINT8_C(243), UINT8_C( 29), UINT8_C(222), UINT8_C( 56), UINT8_C(143),
+          UINT8_C( 27), UINT8_C( 26), UINT8_C(105), UINT8_C( 39), UINT8_C( 82), UINT8_C( 51), UINT8_C(165), UINT8_C(175) },
+        { UINT8_C(154), UINT8_C(192), UINT8_C(205), UINT8_C(243), UINT8_C( 29), UINT8_C(222), UINT8_C( 56), UINT8_C(143),
+          UINT8_C(170), UINT8_C( 26), UINT8_C(105), UINT8_C( 39), UINT8_C( 82), UINT8_C( 51), UINT8_C(165), UINT8_C( 98) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_uint8x8_t b = simde_vld1_u8(test_vec[i].b);
+    simde_uint8x16_t r0 = simde_vcopyq_lane_u8(a, 0, b, 7);
+    simde_uint8x16_t r1 = simde_vcopyq_lane_u8(a, 15, b, 0);
+    simde_uint8x16_t r2 = simde_vcopyq_lane_u8(a, 8, b, 4);
+
+    simde_test_arm_neon_assert_equal_u8x16(r0, simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r1, simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r2, simde_vld1q_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[4];
+    uint16_t r[3][8];
+  } test_vec[] = {
+    { { UINT16_C(65395), UINT16_C(36307), UINT16_C(41424), UINT16_C(62263), UINT16_C(51489), UINT16_C(16459), UINT16_C(11839), UINT16_C( 9726) },
+      { UINT16_C(25928), UINT16_C(42723), UINT16_C( 3332), UINT16_C(31455) },
+      { { UINT16_C(31455), UINT16_C(36307), UINT16_C(41424), UINT16_C(62263), UINT16_C(51489), UINT16_C(16459), UINT16_C(11839), UINT16_C( 9726) },
+        { UINT16_C(65395), UINT16_C(36307), UINT16_C(41424), UINT16_C(62263), UINT16_C(51489), UINT16_C(16459), UINT16_C(11839), UINT16_C(25928) },
+        { UINT16_C(65395), UINT16_C(36307), UINT16_C(41424), UINT16_C(62263), UINT16_C( 3332), UINT16_C(16459), UINT16_C(11839), UINT16_C( 9726) } } },
+    { { UINT16_C(59392), UINT16_C(21180), UINT16_C(13054), UINT16_C(16609), UINT16_C(63012), UINT16_C(50066), UINT16_C(63525), UINT16_C(62184) },
+      { UINT16_C(23468), UINT16_C( 3277), UINT16_C(27085), UINT16_C(30740) },
+      { { UINT16_C(30740), UINT16_C(21180), UINT16_C(13054), UINT16_C(16609), UINT16_C(63012), UINT16_C(50066), UINT16_C(63525), UINT16_C(62184) },
+        { UINT16_C(59392), UINT16_C(21180), UINT16_C(13054), UINT16_C(16609), UINT16_C(63012), UINT16_C(50066), UINT16_C(63525), UINT16_C(23468) },
+        { UINT16_C(59392), UINT16_C(21180), UINT16_C(13054), UINT16_C(16609), UINT16_C(27085), UINT16_C(50066), UINT16_C(63525), UINT16_C(62184) } } },
+    { { UINT16_C(32711), UINT16_C(38893), UINT16_C(54199), UINT16_C(50436), UINT16_C(51667), UINT16_C(42534), UINT16_C(30795), UINT16_C(48217) },
+      { UINT16_C(55988), UINT16_C( 7602), UINT16_C(43712), UINT16_C(21218) },
+      { { UINT16_C(21218), UINT16_C(38893), UINT16_C(54199), UINT16_C(50436), UINT16_C(51667), UINT16_C(42534), UINT16_C(30795), UINT16_C(48217) },
+        { UINT16_C(32711), UINT16_C(38893), UINT16_C(54199), UINT16_C(50436), UINT16_C(51667), UINT16_C(42534), UINT16_C(30795), UINT16_C(55988) },
+        { UINT16_C(32711), UINT16_C(38893), UINT16_C(54199), UINT16_C(50436), UINT16_C(43712), UINT16_C(42534), UINT16_C(30795), UINT16_C(48217) } } },
+    { { UINT16_C(58567), UINT16_C(12614), UINT16_C(13107), UINT16_C(41819), UINT16_C(35781), UINT16_C(53736), UINT16_C(33943), UINT16_C(11411) },
+      { UINT16_C( 2133), UINT16_C(39742), UINT16_C( 2829), UINT16_C(27622) },
+      { { UINT16_C(27622), UINT16_C(12614), UINT16_C(13107), UINT16_C(41819), UINT16_C(35781), UINT16_C(53736), UINT16_C(33943), UINT16_C(11411) },
+        { UINT16_C(58567), UINT16_C(12614), UINT16_C(13107), UINT16_C(41819), UINT16_C(35781), UINT16_C(53736), UINT16_C(33943), UINT16_C( 2133) },
+        { UINT16_C(58567), UINT16_C(12614), UINT16_C(13107), UINT16_C(41819), UINT16_C( 2829), UINT16_C(53736), UINT16_C(33943), UINT16_C(11411) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_uint16x4_t b = simde_vld1_u16(test_vec[i].b);
+    simde_uint16x8_t r0 = simde_vcopyq_lane_u16(a, 0, b, 3);
+    simde_uint16x8_t r1 = simde_vcopyq_lane_u16(a, 7, b, 0);
+    simde_uint16x8_t r2 = simde_vcopyq_lane_u16(a, 4, b, 2);
+
+    simde_test_arm_neon_assert_equal_u16x8(r0, simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r1, simde_vld1q_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x8(r2, simde_vld1q_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[2];
+    uint32_t r[3][4];
+  } test_vec[] = {
+    { { UINT32_C(2710809032), UINT32_C(1413117329), UINT32_C(2126649721), UINT32_C( 358462358) },
+      { UINT32_C(3375639354), UINT32_C(4096508004) },
+      { { UINT32_C(4096508004), UINT32_C(1413117329), UINT32_C(2126649721), UINT32_C( 358462358) },
+        { UINT32_C(2710809032), UINT32_C(1413117329), UINT32_C(2126649721), UINT32_C(3375639354) },
+        { UINT32_C(2710809032), UINT32_C(1413117329), UINT32_C(4096508004), UINT32_C( 358462358) } } },
+    { { UINT32_C(2176084171), UINT32_C( 681719069), UINT32_C(3071709170), UINT32_C(2491877332) },
+      { UINT32_C( 320639241), UINT32_C(3862777526) },
+      { { UINT32_C(3862777526), UINT32_C( 681719069), UINT32_C(3071709170), UINT32_C(2491877332) },
+        { UINT32_C(2176084171), UINT32_C( 681719069), UINT32_C(3071709170), UINT32_C( 320639241) },
+        { UINT32_C(2176084171), UINT32_C( 681719069), UINT32_C(3862777526), UINT32_C(2491877332) } } },
+    { { UINT32_C(1775859094), UINT32_C(1673648515), UINT32_C(3109570151), UINT32_C( 690109843) },
+      { UINT32_C(1493461823), UINT32_C(3811016566) },
+      { { UINT32_C(3811016566), UINT32_C(1673648515), UINT32_C(3109570151), UINT32_C( 690109843) },
+        { UINT32_C(1775859094), UINT32_C(1673648515), UINT32_C(3109570151), UINT32_C(1493461823) },
+        { UINT32_C(1775859094), UINT32_C(1673648515), UINT32_C(3811016566), UINT32_C( 690109843) } } },
+    { { UINT32_C(3516168792), UINT32_C(2174052269), UINT32_C(1126667328), UINT32_C(1316653140) },
+      { UINT32_C(3039955050), UINT32_C( 754955024) },
+      { { UINT32_C( 754955024), UINT32_C(2174052269), UINT32_C(1126667328), UINT32_C(1316653140) },
+        { UINT32_C(3516168792), UINT32_C(2174052269), UINT32_C(1126667328), UINT32_C(3039955050) },
+        { UINT32_C(3516168792), UINT32_C(2174052269), UINT32_C( 754955024), UINT32_C(1316653140) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x2_t b = simde_vld1_u32(test_vec[i].b);
+    simde_uint32x4_t r0 = simde_vcopyq_lane_u32(a, 0, b, 1);
+    simde_uint32x4_t r1 = simde_vcopyq_lane_u32(a, 3, b, 0);
+    simde_uint32x4_t r2 = simde_vcopyq_lane_u32(a, 2, b, 1);
+
+    simde_test_arm_neon_assert_equal_u32x4(r0, simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r1, simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r2, simde_vld1q_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[1];
+    uint64_t r[3][2];
+  } test_vec[] = {
+    { { UINT64_C(17361843252454361165), UINT64_C( 5361896841015903614) },
+      { UINT64_C( 1462370254685132656) },
+      { { UINT64_C( 1462370254685132656), UINT64_C( 5361896841015903614) },
+        { UINT64_C(17361843252454361165), UINT64_C( 1462370254685132656) },
+        { UINT64_C(17361843252454361165), UINT64_C( 1462370254685132656) } } },
+    { { UINT64_C( 7493340890531779107), UINT64_C( 7030692948783296741) },
+      { UINT64_C( 6725843265803427721) },
+      { { UINT64_C( 6725843265803427721), UINT64_C( 7030692948783296741) },
+        { UINT64_C( 7493340890531779107), UINT64_C( 6725843265803427721) },
+        { UINT64_C( 7493340890531779107), UINT64_C( 6725843265803427721) } } },
+    { { UINT64_C(  623807616609889872), UINT64_C(12908532954435057978) },
+      { UINT64_C(17428727326184157731) },
+      { { UINT64_C(17428727326184157731), UINT64_C(12908532954435057978) },
+        { UINT64_C(  623807616609889872), UINT64_C(17428727326184157731) },
+        { UINT64_C(  623807616609889872), UINT64_C(17428727326184157731) } } },
+    { { UINT64_C(17836488977511816298), UINT64_C(14134706212052111736) },
+      { UINT64_C( 7675838138560439820) },
+      { { UINT64_C( 7675838138560439820), UINT64_C(14134706212052111736) },
+        { UINT64_C(17836488977511816298), UINT64_C( 7675838138560439820) },
+        { UINT64_C(17836488977511816298), UINT64_C( 7675838138560439820) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x1_t b = simde_vld1_u64(test_vec[i].b);
+    simde_uint64x2_t r0 = simde_vcopyq_lane_u64(a, 0, b, 0);
+    simde_uint64x2_t r1 = simde_vcopyq_lane_u64(a, 1, b, 0);
+    simde_uint64x2_t r2 = simde_vcopyq_lane_u64(a, 1, b, 0);
+
+    simde_test_arm_neon_assert_equal_u64x2(r0, simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r1, simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r2, simde_vld1q_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a[4];
+    simde_float32_t b[4];
+    simde_float32_t r[3][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   697.07), SIMDE_FLOAT32_C(  -107.74), SIMDE_FLOAT32_C(   108.38), SIMDE_FLOAT32_C(   389.62) },
+      { SIMDE_FLOAT32_C(  -883.08), SIMDE_FLOAT32_C(  -605.05), SIMDE_FLOAT32_C(  -857.39), SIMDE_FLOAT32_C(   890.03) },
+      { { SIMDE_FLOAT32_C(   890.03), SIMDE_FLOAT32_C(  -107.74), SIMDE_FLOAT32_C(   108.38), SIMDE_FLOAT32_C(   389.62) },
+        { SIMDE_FLOAT32_C(   697.07), SIMDE_FLOAT32_C(  -107.74), SIMDE_FLOAT32_C(   108.38), SIMDE_FLOAT32_C(  -883.08) },
+        { SIMDE_FLOAT32_C(   697.07), SIMDE_FLOAT32_C(  -107.74), SIMDE_FLOAT32_C(  -857.39), SIMDE_FLOAT32_C(   389.62) } } },
+    { { SIMDE_FLOAT32_C(  -114.73), SIMDE_FLOAT32_C(  -899.81), SIMDE_FLOAT32_C(   103.20), SIMDE_FLOAT32_C(   116.39) },
+      { SIMDE_FLOAT32_C(    44.32), SIMDE_FLOAT32_C(   894.70), SIMDE_FLOAT32_C(   685.06), SIMDE_FLOAT32_C(   -80.01) },
+      { { SIMDE_FLOAT32_C(   -80.01), SIMDE_FLOAT32_C(  -899.81), SIMDE_FLOAT32_C(   103.20), SIMDE_FLOAT32_C(   116.39) },
+        { SIMDE_FLOAT32_C(  -114.73), SIMDE_FLOAT32_C(  -899.81), SIMDE_FLOAT32_C(   103.20), SIMDE_FLOAT32_C(    44.32) },
+        { SIMDE_FLOAT32_C(  -114.73), SIMDE_FLOAT32_C(  -899.81), SIMDE_FLOAT32_C(   685.06), SIMDE_FLOAT32_C(   116.39) } } },
+    { { SIMDE_FLOAT32_C(   622.32), SIMDE_FLOAT32_C(   -35.22), SIMDE_FLOAT32_C(  -684.51), SIMDE_FLOAT32_C(  -106.07) },
+      { SIMDE_FLOAT32_C(  -546.79), SIMDE_FLOAT32_C(  -819.81), SIMDE_FLOAT32_C(   598.97), SIMDE_FLOAT32_C(  -570.32) },
+      { { SIMDE_FLOAT32_C(  -570.32), SIMDE_FLOAT32_C(   -35.22), SIMDE_FLOAT32_C(  -684.51), SIMDE_FLOAT32_C(  -106.07) },
+        { SIMDE_FLOAT32_C(   622.32), SIMDE_FLOAT32_C(   -35.22), SIMDE_FLOAT32_C(  -684.51), SIMDE_FLOAT32_C(  -546.79) },
+        { SIMDE_FLOAT32_C(   622.32), SIMDE_FLOAT32_C(   -35.22), SIMDE_FLOAT32_C(   598.97), SIMDE_FLOAT32_C(  -106.07) } } },
+    { { SIMDE_FLOAT32_C(   725.86), SIMDE_FLOAT32_C(  -762.18), SIMDE_FLOAT32_C(  -377.22), SIMDE_FLOAT32_C(   149.06) },
+      { SIMDE_FLOAT32_C(   581.46), SIMDE_FLOAT32_C(  -488.31), SIMDE_FLOAT32_C(   522.45), SIMDE_FLOAT32_C(  -136.00) },
+      { { SIMDE_FLOAT32_C(  -136.00), SIMDE_FLOAT32_C(  -762.18), SIMDE_FLOAT32_C(  -377.22), SIMDE_FLOAT32_C(   149.06) },
+        { SIMDE_FLOAT32_C(   725.86), SIMDE_FLOAT32_C(  -762.18), SIMDE_FLOAT32_C(  -377.22), SIMDE_FLOAT32_C(   581.46) },
+        { SIMDE_FLOAT32_C(   725.86), SIMDE_FLOAT32_C(  -762.18), SIMDE_FLOAT32_C(   522.45), SIMDE_FLOAT32_C(   149.06) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r0 = simde_vcopyq_laneq_f32(a, 0, b, 3);
+    simde_float32x4_t r1 = simde_vcopyq_laneq_f32(a, 3, b, 0);
+    simde_float32x4_t r2 = simde_vcopyq_laneq_f32(a, 2, b, 2);
+
+    simde_test_arm_neon_assert_equal_f32x4(r0, simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r1, simde_vld1q_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r2, simde_vld1q_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a[2];
+    simde_float64_t b[2];
+    simde_float64_t r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   444.01), SIMDE_FLOAT64_C(  -146.03) },
+      { SIMDE_FLOAT64_C(   586.09), SIMDE_FLOAT64_C(  -570.56) },
+      { { SIMDE_FLOAT64_C(  -570.56), SIMDE_FLOAT64_C(  -146.03) },
+        { SIMDE_FLOAT64_C(   444.01), SIMDE_FLOAT64_C(   586.09) },
+        { SIMDE_FLOAT64_C(   444.01), SIMDE_FLOAT64_C(  -570.56) } } },
+    { { SIMDE_FLOAT64_C(   530.11), SIMDE_FLOAT64_C(  -721.72) },
+      { SIMDE_FLOAT64_C(   568.97), SIMDE_FLOAT64_C(   465.42) },
+      { { SIMDE_FLOAT64_C(   465.42), SIMDE_FLOAT64_C(  -721.72) },
+        { SIMDE_FLOAT64_C(   530.11), SIMDE_FLOAT64_C(   568.97) },
+        { SIMDE_FLOAT64_C(   530.11), SIMDE_FLOAT64_C(   465.42) } } },
+    { { SIMDE_FLOAT64_C(   737.14), SIMDE_FLOAT64_C(  -864.28) },
+      { SIMDE_FLOAT64_C(   861.27), SIMDE_FLOAT64_C(   527.38) },
+      { { SIMDE_FLOAT64_C(   527.38), SIMDE_FLOAT64_C(  -864.28) },
+        { SIMDE_FLOAT64_C(   737.14), SIMDE_FLOAT64_C(   861.27) },
+        { SIMDE_FLOAT64_C(   737.14), SIMDE_FLOAT64_C(   527.38) } } },
+    { { SIMDE_FLOAT64_C(  -663.04), SIMDE_FLOAT64_C(  -247.22) },
+      { SIMDE_FLOAT64_C(   653.33), SIMDE_FLOAT64_C(   617.11) },
+      { { SIMDE_FLOAT64_C(   617.11), SIMDE_FLOAT64_C(  -247.22) },
+        { SIMDE_FLOAT64_C(  -663.04), SIMDE_FLOAT64_C(   653.33) },
+        { SIMDE_FLOAT64_C(  -663.04), SIMDE_FLOAT64_C(   617.11) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r0 = simde_vcopyq_laneq_f64(a, 0, b, 1);
+    simde_float64x2_t r1 = simde_vcopyq_laneq_f64(a, 1, b, 0);
+    simde_float64x2_t r2 = simde_vcopyq_laneq_f64(a, 1, b, 1);
+
+    simde_test_arm_neon_assert_equal_f64x2(r0, simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r1, simde_vld1q_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r2, simde_vld1q_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[3][16];
+  } test_vec[] = {
+    { {  INT8_C( 61),  INT8_C( 68), -INT8_C( 63), -INT8_C( 66), -INT8_C(127),  INT8_C( 25), -INT8_C(113), -INT8_C(  4),
+          -INT8_C(121), -INT8_C( 88), -INT8_C( 71), -INT8_C( 77),  INT8_C( 75), -INT8_C( 89),  INT8_C(109),  INT8_C(110) },
+      {  INT8_C(111),  INT8_C( 27), -INT8_C( 77), -INT8_C( 40), -INT8_C( 96),  INT8_C(116), -INT8_C( 92), -INT8_C( 61),
+           INT8_C(115),  INT8_C(116),  INT8_C( 22),  INT8_C( 69),  INT8_C( 75), -INT8_C( 83),  INT8_C( 46), -INT8_C( 22) },
+      { { -INT8_C( 22),  INT8_C( 68), -INT8_C( 63), -INT8_C( 66), -INT8_C(127),  INT8_C( 25), -INT8_C(113), -INT8_C(  4),
+          -INT8_C(121), -INT8_C( 88), -INT8_C( 71), -INT8_C( 77),  INT8_C( 75), -INT8_C( 89),  INT8_C(109),  INT8_C(110) },
+        {  INT8_C( 61),  INT8_C( 68), -INT8_C( 63), -INT8_C( 66), -INT8_C(127),  INT8_C( 25), -INT8_C(113), -INT8_C(  4),
+          -INT8_C(121), -INT8_C( 88), -INT8_C( 71), -INT8_C( 77),  INT8_C( 75), -INT8_C( 89),  INT8_C(109),  INT8_C(111) },
+        {  INT8_C( 61),  INT8_C( 68), -INT8_C( 63), -INT8_C( 66), -INT8_C(127),  INT8_C( 25), -INT8_C(113), -INT8_C(  4),
+           INT8_C(115), -INT8_C( 88), -INT8_C( 71), -INT8_C( 77),  INT8_C( 75), -INT8_C( 89),  INT8_C(109),  INT8_C(110) } } },
+    { { -INT8_C( 83), -INT8_C(107), -INT8_C( 93), -INT8_C(103),  INT8_C( 13), -INT8_C( 32), -INT8_C( 50),  INT8_C(111),
+          -INT8_C( 58),  INT8_C( 96),     INT8_MAX, -INT8_C( 81), -INT8_C( 16),  INT8_C( 97),  INT8_C(105), -INT8_C( 86) },
+      {     INT8_MIN, -INT8_C( 65), -INT8_C( 50), -INT8_C(  7),  INT8_C( 15), -INT8_C(107),  INT8_C(115),  INT8_C( 35),
+          -INT8_C( 56), -INT8_C( 15), -INT8_C(114), -INT8_C( 17),  INT8_C( 97),  INT8_C( 12),  INT8_C( 30), -INT8_C(125) },
+      { { -INT8_C(125), -INT8_C(107), -INT8_C( 93), -INT8_C(103),  INT8_C( 13), -INT8_C( 32), -INT8_C( 50),  INT8_C(111),
+          -INT8_C( 58),  INT8_C( 96),     INT8_MAX, -INT8_C( 81), -INT8_C( 16),  INT8_C( 97),  INT8_C(105), -INT8_C( 86) },
+        { -INT8_C( 83), -INT8_C(107), -INT8_C( 93), -INT8_C(103),  INT8_C( 13), -INT8_C( 32), -INT8_C( 50),  INT8_C(111),
+          -INT8_C( 58),  INT8_C( 96),     INT8_MAX, -INT8_C( 81), -INT8_C( 16),  INT8_C( 97),  INT8_C(105),     INT8_MIN },
+        { -INT8_C( 83), -INT8_C(107), -INT8_C( 93), -INT8_C(103),  INT8_C( 13), -INT8_C( 32), -INT8_C( 50),  INT8_C(111),
+          -INT8_C( 56),  INT8_C( 96),     INT8_MAX, -INT8_C( 81), -INT8_C( 16),  INT8_C( 97),  INT8_C(105), -INT8_C( 86) } } },
+    { { -INT8_C( 29),  INT8_C( 90), -INT8_C( 51),  INT8_C( 84), -INT8_C( 91), -INT8_C( 28), -INT8_C( 90),  INT8_C(103),
+           INT8_C( 42), -INT8_C(  6), -INT8_C( 51), -INT8_C( 39), -INT8_C( 37),  INT8_C( 28), -INT8_C(109),  INT8_C( 90) },
+      {  INT8_C(124),  INT8_C( 88), -INT8_C( 72),  INT8_C( 35),  INT8_C( 95),  INT8_C(114), -INT8_C( 64),  INT8_C(  1),
+          -INT8_C( 48), -INT8_C(117),  INT8_C( 95),  INT8_C( 34),  INT8_C( 31),  INT8_C( 77), -INT8_C( 69),  INT8_C( 47) },
+      { {  INT8_C( 47),  INT8_C( 90), -INT8_C( 51),  INT8_C( 84), -INT8_C( 91), -INT8_C( 28), -INT8_C( 90),  INT8_C(103),
+           INT8_C( 42), -INT8_C(  6), -INT8_C( 51), -INT8_C( 39), -INT8_C( 37),  INT8_C( 28), -INT8_C(109),  INT8_C( 90) },
+        { -INT8_C( 29),  INT8_C( 90), -INT8_C( 51),  INT8_C( 84), -INT8_C( 91), -INT8_C( 28), -INT8_C( 90),  INT8_C(103),
+           INT8_C( 42), -INT8_C(  6), -INT8_C( 51), -INT8_C( 39), -INT8_C( 37),  INT8_C( 28), -INT8_C(109),  INT8_C(124) },
+        { -INT8_C( 29),  INT8_C( 90), -INT8_C( 51),  INT8_C( 84), -INT8_C( 91), -INT8_C( 28), -INT8_C( 90),  INT8_C(103),
+          -INT8_C( 48), -INT8_C(  6), -INT8_C( 51), -INT8_C( 39), -INT8_C( 37),  INT8_C( 28), -INT8_C(109),  INT8_C( 90) } } },
+    { {  INT8_C( 60), -INT8_C( 21),  INT8_C( 60),  INT8_C( 50),  INT8_C(  4),  INT8_C( 91),  INT8_C( 92),  INT8_C( 97),
+          -INT8_C( 36),  INT8_C( 75),  INT8_C( 54),  INT8_C( 34),  INT8_C( 43),     INT8_MIN, -INT8_C( 75),  INT8_C(  0) },
+      {  INT8_C( 42),  INT8_C( 24), -INT8_C( 14),  INT8_C(121),  INT8_C( 82),  INT8_C( 54), -INT8_C(122), -INT8_C(104),
+          -INT8_C( 68), -INT8_C(  4),  INT8_C( 99),  INT8_C(125),  INT8_C( 35),  INT8_C(  0), -INT8_C( 51),  INT8_C( 32) },
+      { {  INT8_C( 32), -INT8_C( 21),  INT8_C( 60),  INT8_C( 50),  INT8_C(  4),  INT8_C( 91),  INT8_C( 92),  INT8_C( 97),
+          -INT8_C( 36),  INT8_C( 75),  INT8_C( 54),  INT8_C( 34),  INT8_C( 43),     INT8_MIN, -INT8_C( 75),  INT8_C(  0) },
+        {  INT8_C( 60), -INT8_C( 21),  INT8_C( 60),  INT8_C( 50),  INT8_C(  4),  INT8_C( 91),  INT8_C( 92),  INT8_C( 97),
+          -INT8_C( 36),  INT8_C( 75),  INT8_C( 54),  INT8_C( 34),  INT8_C( 43),     INT8_MIN, -INT8_C( 75),  INT8_C( 42) },
+        {  INT8_C( 60), -INT8_C( 21),  INT8_C( 60),  INT8_C( 50),  INT8_C(  4),  INT8_C( 91),  INT8_C( 92),  INT8_C( 97),
+          -INT8_C( 68),  INT8_C( 75),  INT8_C( 54),  INT8_C( 34),  INT8_C( 43),     INT8_MIN, -INT8_C( 75),  INT8_C(  0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int8x16_t r0 = simde_vcopyq_laneq_s8(a, 0, b, 15);
+    simde_int8x16_t r1 = simde_vcopyq_laneq_s8(a, 15, b, 0);
+    simde_int8x16_t r2 = simde_vcopyq_laneq_s8(a, 8, b, 8);
+
+    simde_test_arm_neon_assert_equal_i8x16(r0, simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r1, simde_vld1q_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x16(r2, simde_vld1q_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[3][8];
+  } test_vec[] = {
+    { { -INT16_C(   43), -INT16_C(25547),  INT16_C(17884), -INT16_C( 1670), -INT16_C( 7301),  INT16_C( 4521), -INT16_C(29834),  INT16_C(28613) },
+      { -INT16_C(21384), -INT16_C(17602), -INT16_C(21847),  INT16_C(26458),  INT16_C(32566),  INT16_C(15457), -INT16_C(19346), -INT16_C(14377) },
+      { { -INT16_C(14377), -INT16_C(25547),  INT16_C(17884), -INT16_C( 1670), -INT16_C( 7301),  INT16_C( 4521), -INT16_C(29834),  INT16_C(28613) },
+        { -INT16_C(   43), -INT16_C(25547),  INT16_C(17884), -INT16_C( 1670), -INT16_C( 7301),  INT16_C( 4521), -INT16_C(29834), -INT16_C(21384) },
+        { -INT16_C(   43), -INT16_C(25547),  INT16_C(17884), -INT16_C( 1670),  INT16_C(32566),  INT16_C( 4521), -INT16_C(29834),  INT16_C(28613) } } },
+    { {  INT16_C( 8179), -INT16_C(22780),  INT16_C( 1443), -INT16_C(29679),  INT16_C(30993),  INT16_C(20909),  INT16_C( 7110),  INT16_C(  317) },
+      {  INT16_C(25730),  INT16_C(32364),  INT16_C(30281),  INT16_C(23953), -INT16_C(13661),  INT16_C(30754),  INT16_C(22254), -INT16_C( 9802) },
+      { { -INT16_C( 9802), -INT16_C(22780),  INT16_C( 1443), -INT16_C(29679),  INT16_C(30993),  INT16_C(20909),  INT16_C( 7110),  INT16_C(  317) },
+        {  INT16_C( 8179), -INT16_C(22780),  INT16_C( 1443), -INT16_C(29679),  INT16_C(30993),  INT16_C(20909),  INT16_C( 7110),  INT16_C(25730) },
+        {  INT16_C( 8179), -INT16_C(22780),  INT16_C( 1443), -INT16_C(29679), -INT16_C(13661),  INT16_C(20909),  INT16_C( 7110),  INT16_C(  317) } } },
+    { { -INT16_C(29486),  INT16_C(19124),  INT16_C(26516), -INT16_C(13957), -INT16_C(23042),  INT16_C( 2241),  INT16_C(16833), -INT16_C(12802) },
+      {  INT16_C(15298), -INT16_C(29632),  INT16_C( 9365), -INT16_C( 6177),  INT16_C( 8639), -INT16_C(23935), -INT16_C( 1454), -INT16_C( 7841) },
+      { { -INT16_C( 7841),  INT16_C(19124),  INT16_C(26516), -INT16_C(13957), -INT16_C(23042),  INT16_C( 2241),  INT16_C(16833), -INT16_C(12802) },
+        { -INT16_C(29486),  INT16_C(19124),  INT16_C(26516), -INT16_C(13957), -INT16_C(23042),  INT16_C( 2241),  INT16_C(16833),  INT16_C(15298) },
+        { -INT16_C(29486),  INT16_C(19124),  INT16_C(26516), -INT16_C(13957),  INT16_C( 8639),  INT16_C( 2241),  INT16_C(16833), -INT16_C(12802) } } },
+    { {  INT16_C(26363), -INT16_C(13500),  INT16_C(16008), -INT16_C(30122),  INT16_C( 4968),  INT16_C(22091),  INT16_C( 3489),  INT16_C(11318) },
+      { -INT16_C(26748),  INT16_C(26239), -INT16_C( 1388), -INT16_C(24974), -INT16_C(13443),  INT16_C(11648),  INT16_C(21870), -INT16_C( 5061) },
+      { { -INT16_C( 5061), -INT16_C(13500),  INT16_C(16008), -INT16_C(30122),  INT16_C( 4968),  INT16_C(22091),  INT16_C( 3489),  INT16_C(11318) },
+        {  INT16_C(26363), -INT16_C(13500),  INT16_C(16008), -INT16_C(30122),  INT16_C( 4968),  INT16_C(22091),  INT16_C( 3489), -INT16_C(26748) },
+        {  INT16_C(26363), -INT16_C(13500),  INT16_C(16008), -INT16_C(30122), -INT16_C(13443),  INT16_C(22091),  INT16_C( 3489),  INT16_C(11318) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_int16x8_t r0 = simde_vcopyq_laneq_s16(a, 0, b, 7);
+    simde_int16x8_t r1 = simde_vcopyq_laneq_s16(a, 7, b, 0);
+    simde_int16x8_t r2 = simde_vcopyq_laneq_s16(a, 4, b, 4);
+
+    simde_test_arm_neon_assert_equal_i16x8(r0, simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r1, simde_vld1q_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x8(r2, simde_vld1q_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[3][4];
+  } test_vec[] = {
+    { {  INT32_C(1497817297),  INT32_C(1563378692),  INT32_C( 310633360),  INT32_C(1782365169) },
+      { -INT32_C(1550336038),  INT32_C( 483438007),  INT32_C( 958875425),  INT32_C( 762845932) },
+      { {  INT32_C( 762845932),  INT32_C(1563378692),  INT32_C( 310633360),  INT32_C(1782365169) },
+        {  INT32_C(1497817297),  INT32_C(1563378692),  INT32_C( 310633360), -INT32_C(1550336038) },
+        {  INT32_C(1497817297),  INT32_C(1563378692),  INT32_C( 958875425),  INT32_C(1782365169) } } },
+    { {  INT32_C(1284308507),  INT32_C( 416689510),  INT32_C(2084568663), -INT32_C( 262435128) },
+      { -INT32_C(  87965017),  INT32_C(1007111209),  INT32_C( 133338853),  INT32_C( 545355682) },
+      { {  INT32_C( 545355682),  INT32_C( 416689510),  INT32_C(2084568663), -INT32_C( 262435128) },
+        {  INT32_C(1284308507),  INT32_C( 416689510),  INT32_C(2084568663), -INT32_C(  87965017) },
+        {  INT32_C(1284308507),  INT32_C( 416689510),  INT32_C( 133338853), -INT32_C( 262435128) } } },
+    { {  INT32_C( 429802754),  INT32_C( 298670913), -INT32_C( 993768235),  INT32_C( 381521140) },
+      {  INT32_C( 207352984), -INT32_C( 330280820), -INT32_C(1944722717), -INT32_C( 205425665) },
+      { { -INT32_C( 205425665),  INT32_C( 298670913), -INT32_C( 993768235),  INT32_C( 381521140) },
+        {  INT32_C( 429802754),  INT32_C( 298670913), -INT32_C( 993768235),  INT32_C( 207352984) },
+        {  INT32_C( 429802754),  INT32_C( 298670913), -INT32_C(1944722717),  INT32_C( 381521140) } } },
+    { {  INT32_C( 711332272),  INT32_C( 871037215),  INT32_C(1455297142), -INT32_C(1370363640) },
+      {  INT32_C( 855149144), -INT32_C(1445060248), -INT32_C(1029664523), -INT32_C( 817467794) },
+      { { -INT32_C( 817467794),  INT32_C( 871037215),  INT32_C(1455297142), -INT32_C(1370363640) },
+        {  INT32_C( 711332272),  INT32_C( 871037215),  INT32_C(1455297142),  INT32_C( 855149144) },
+        {  INT32_C( 711332272),  INT32_C( 871037215), -INT32_C(1029664523), -INT32_C(1370363640) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_int32x4_t r0 = simde_vcopyq_laneq_s32(a, 0, b, 3);
+    simde_int32x4_t r1 = simde_vcopyq_laneq_s32(a, 3, b, 0);
+    simde_int32x4_t r2 = simde_vcopyq_laneq_s32(a, 2, b, 2);
+
+    simde_test_arm_neon_assert_equal_i32x4(r0, simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r1, simde_vld1q_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x4(r2, simde_vld1q_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[3][2];
+  } test_vec[] = {
+    { { -INT64_C(5986602533226870492),  INT64_C(5712469730876252700) },
+      { -INT64_C(5016888374906135846),  INT64_C(2696776562095294034) },
+      { {  INT64_C(2696776562095294034),  INT64_C(5712469730876252700) },
+        { -INT64_C(5986602533226870492), -INT64_C(5016888374906135846) },
+        { -INT64_C(5986602533226870492),  INT64_C(2696776562095294034) } } },
+    { {  INT64_C(3985096927057184066),  INT64_C(1804771553313473654) },
+      { -INT64_C(4658002834918028956), -INT64_C(8813019984156644468) },
+      { { -INT64_C(8813019984156644468),  INT64_C(1804771553313473654) },
+        {  INT64_C(3985096927057184066), -INT64_C(4658002834918028956) },
+        {  INT64_C(3985096927057184066), -INT64_C(8813019984156644468) } } },
+    { { -INT64_C(6157560862423677938), -INT64_C(3216666991520052366) },
+      {  INT64_C(1076407507541876252), -INT64_C(4197406691503305833) },
+      { { -INT64_C(4197406691503305833), -INT64_C(3216666991520052366) },
+        { -INT64_C(6157560862423677938),  INT64_C(1076407507541876252) },
+        { -INT64_C(6157560862423677938), -INT64_C(4197406691503305833) } } },
+    { {  INT64_C(9142591483722819779), -INT64_C(1592338120727497290) },
+      {  INT64_C(1580838009551643350),  INT64_C(6269390297495153288) },
+      { {  INT64_C(6269390297495153288), -INT64_C(1592338120727497290) },
+        {  INT64_C(9142591483722819779),  INT64_C(1580838009551643350) },
+        {  INT64_C(9142591483722819779),  INT64_C(6269390297495153288) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+    simde_int64x2_t r0 = simde_vcopyq_laneq_s64(a, 0, b, 1);
+    simde_int64x2_t r1 = simde_vcopyq_laneq_s64(a, 1, b, 0);
+    simde_int64x2_t r2 = simde_vcopyq_laneq_s64(a, 1, b, 1);
+
+    simde_test_arm_neon_assert_equal_i64x2(r0, simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r1, simde_vld1q_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x2(r2, simde_vld1q_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[16];
+    uint8_t r[3][16];
+  } test_vec[] = {
+    { { UINT8_C( 47), UINT8_C( 60), UINT8_C( 83), UINT8_C( 69), UINT8_C(190), UINT8_C( 29), UINT8_C(177), UINT8_C( 13),
+          UINT8_C( 45), UINT8_C( 64), UINT8_C(251), UINT8_C(182), UINT8_C( 30), UINT8_C(203), UINT8_C( 50), UINT8_C(190) },
+      { UINT8_C( 20), UINT8_C(105), UINT8_C(127), UINT8_C( 41), UINT8_C( 57), UINT8_C(199), UINT8_C(182), UINT8_C( 84),
+          UINT8_C(231), UINT8_C( 94), UINT8_C(189), UINT8_C(118), UINT8_C(220), UINT8_C(142), UINT8_C(186), UINT8_C( 48) },
+      { { UINT8_C( 48), UINT8_C( 60), UINT8_C( 83), UINT8_C( 69), UINT8_C(190), UINT8_C( 29), UINT8_C(177), UINT8_C( 13),
+          UINT8_C( 45), UINT8_C( 64), UINT8_C(251), UINT8_C(182), UINT8_C( 30), UINT8_C(203), UINT8_C( 50), UINT8_C(190) },
+        { UINT8_C( 47), UINT8_C( 60), UINT8_C( 83), UINT8_C( 69), UINT8_C(190), UINT8_C( 29), UINT8_C(177), UINT8_C( 13),
+          UINT8_C( 45), UINT8_C( 64), UINT8_C(251), UINT8_C(182), UINT8_C( 30), UINT8_C(203), UINT8_C( 50), UINT8_C( 20) },
+        { UINT8_C( 47), UINT8_C( 60), UINT8_C( 83), UINT8_C( 69), UINT8_C(190), UINT8_C( 29), UINT8_C(177), UINT8_C( 13),
+          UINT8_C(231), UINT8_C( 64), UINT8_C(251), UINT8_C(182), UINT8_C( 30), UINT8_C(203), UINT8_C( 50), UINT8_C(190) } } },
+    { { UINT8_C( 64), UINT8_C( 85), UINT8_C(229), UINT8_C(204), UINT8_C(126), UINT8_C( 97), UINT8_C(  0), UINT8_C(224),
+          UINT8_C(104), UINT8_C(243), UINT8_C( 11), UINT8_C( 69), UINT8_C(203), UINT8_C(219), UINT8_C( 18), UINT8_C(180) },
+      { UINT8_C(241), UINT8_C(114), UINT8_C(164), UINT8_C(207), UINT8_C(142), UINT8_C(216), UINT8_C( 99), UINT8_C(156),
+          UINT8_C(242), UINT8_C(155),    UINT8_MAX, UINT8_C(153), UINT8_C( 72), UINT8_C(245), UINT8_C(207), UINT8_C(189) },
+      { { UINT8_C(189), UINT8_C( 85), UINT8_C(229), UINT8_C(204), UINT8_C(126), UINT8_C( 97), UINT8_C(  0), UINT8_C(224),
+          UINT8_C(104), UINT8_C(243), UINT8_C( 11), UINT8_C( 69), UINT8_C(203), UINT8_C(219), UINT8_C( 18), UINT8_C(180) },
+        { UINT8_C( 64), UINT8_C( 85), UINT8_C(229), UINT8_C(204), UINT8_C(126), UINT8_C( 97), UINT8_C(  0), UINT8_C(224),
+          UINT8_C(104), UINT8_C(243), UINT8_C( 11), UINT8_C( 69), UINT8_C(203), UINT8_C(219), UINT8_C( 18), UINT8_C(241) },
+        { UINT8_C( 64), UINT8_C( 85), UINT8_C(229), UINT8_C(204), UINT8_C(126), UINT8_C( 97), UINT8_C(  0), UINT8_C(224),
+          UINT8_C(242), UINT8_C(243), UINT8_C( 11), UINT8_C( 69), UINT8_C(203), UINT8_C(219), UINT8_C( 18), UINT8_C(180) } } },
+    { { UINT8_C( 15), UINT8_C( 49), UINT8_C( 69), UINT8_C(101), UINT8_C(228), UINT8_C( 61), UINT8_C(206), UINT8_C( 83),
+          UINT8_C(168), UINT8_C(  8), UINT8_C( 91), UINT8_C(225), UINT8_C(196), UINT8_C( 15), UINT8_C( 57), UINT8_C( 69) },
+      { UINT8_C( 99), UINT8_C(161), UINT8_C(201), UINT8_C(180), UINT8_C( 61), UINT8_C( 43), UINT8_C(180), UINT8_C( 10),
+          UINT8_C(  5), UINT8_C(220), UINT8_C( 90), UINT8_C(220), UINT8_C(122), UINT8_C(126), UINT8_C( 36), UINT8_C(174) },
+      { { UINT8_C(174), UINT8_C( 49), UINT8_C( 69), UINT8_C(101), UINT8_C(228), UINT8_C( 61), UINT8_C(206), UINT8_C( 83),
+          UINT8_C(168), UINT8_C(  8), UINT8_C( 91), UINT8_C(225), UINT8_C(196), UINT8_C( 15), UINT8_C( 57), UINT8_C( 69) },
+        { UINT8_C( 15), UINT8_C( 49), UINT8_C( 69), UINT8_C(101), UINT8_C(228), UINT8_C( 61), UINT8_C(206), UINT8_C( 83),
+          UINT8_C(168), UINT8_C(  8), UINT8_C( 91), UINT8_C(225), UINT8_C(196), UINT8_C( 15), UINT8_C( 57), UINT8_C( 99) },
+        { UINT8_C( 15), UINT8_C( 49), UINT8_C( 69), UINT8_C(101), UINT8_C(228), UINT8_C( 61), UINT8_C(206), UINT8_C( 83),
+          UINT8_C(  5), UINT8_C(  8), UINT8_C( 91), UINT8_C(225), UINT8_C(196), UINT8_C( 15), UINT8_C( 57), UINT8_C( 69) } } },
+    { { UINT8_C( 82), UINT8_C(171), UINT8_C( 42), UINT8_C( 64), UINT8_C( 76), UINT8_C( 83), UINT8_C(103), UINT8_C( 88),
+          UINT8_C( 20), UINT8_C( 19), UINT8_C(119), UINT8_C(157), UINT8_C(232), UINT8_C(133), UINT8_C(216), UINT8_C(251) },
+      { UINT8_C( 60), UINT8_C(  0), UINT8_C(191), UINT8_C(  6), UINT8_C( 28), UINT8_C(228), UINT8_C( 79), UINT8_C(133),
+          UINT8_C( 73), UINT8_C( 12), UINT8_C(147), UINT8_C( 87), UINT8_C(166), UINT8_C(131), UINT8_C( 58), UINT8_C( 81) },
+      { { UINT8_C( 81), UINT8_C(171), UINT8_C( 42), UINT8_C( 64), UINT8_C( 76), UINT8_C( 83), UINT8_C(103), UINT8_C( 88),
+          UINT8_C( 20), UINT8_C( 19), UINT8_C(119), UINT8_C(157), UINT8_C(232), UINT8_C(133), UINT8_C(216), UINT8_C(251) },
+        { UINT8_C( 82), UINT8_C(171), UINT8_C( 42), UINT8_C( 64), UINT8_C( 76), UINT8_C( 83), UINT8_C(103), UINT8_C( 88),
+          UINT8_C( 20), UINT8_C( 19), UINT8_C(119), UINT8_C(157), UINT8_C(232), UINT8_C(133), UINT8_C(216), UINT8_C( 60) },
+        { UINT8_C( 82), UINT8_C(171), UINT8_C( 42), UINT8_C( 64), UINT8_C( 76), UINT8_C( 83), UINT8_C(103), UINT8_C( 88),
+          UINT8_C( 73), UINT8_C( 19), UINT8_C(119), UINT8_C(157), UINT8_C(232), UINT8_C(133), UINT8_C(216), UINT8_C(251) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+    simde_uint8x16_t r0 = simde_vcopyq_laneq_u8(a, 0, b, 15);
+    simde_uint8x16_t r1 = simde_vcopyq_laneq_u8(a, 15, b, 0);
+    simde_uint8x16_t r2 = simde_vcopyq_laneq_u8(a, 8, b, 8);
+
+    simde_test_arm_neon_assert_equal_u8x16(r0, simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r1, simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r2, simde_vld1q_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    uint16_t r[3][8];
+  } test_vec[] = {
+    { { UINT16_C(61485), UINT16_C(57206), UINT16_C(12415), UINT16_C(41568), UINT16_C(18306), UINT16_C( 2640), UINT16_C(46026), UINT16_C(21519) },
+      { UINT16_C(60491), UINT16_C(33843), UINT16_C(13864), UINT16_C(60466), UINT16_C(46219), UINT16_C(55281), UINT16_C(36842), UINT16_C(54195) },
+      { { UINT16_C(54195), UINT16_C(57206), UINT16_C(12415), UINT16_C(41568), UINT16_C(18306), UINT16_C( 2640), UINT16_C(46026), UINT16_C(21519) },
+        { UINT16_C(61485), UINT16_C(57206), UINT16_C(12415), UINT16_C(41568), UINT16_C(18306), UINT16_C( 2640), UINT16_C(46026), UINT16_C(60491) },
+        { UINT16_C(61485), UINT16_C(57206), UINT16_C(12415), UINT16_C(41568), UINT16_C(46219), UINT16_C( 2640), UINT16_C(46026), UINT16_C(21519) } } },
+    { { UINT16_C(43323), UINT16_C(10936), UINT16_C(48700), UINT16_C(31826), UINT16_C(46244), UINT16_C(54831), UINT16_C(13696), UINT16_C(45355) },
+      { UINT16_C(12982), UINT16_C( 3071), UINT16_C(34170), UINT16_C(44289), UINT16_C(16379), UINT16_C(56621), UINT16_C(21402), UINT16_C(16497) },
+      { { UINT16_C(16497), UINT16_C(10936), UINT16_C(48700), UINT16_C(31826), UINT16_C(46244), UINT16_C(54831), UINT16_C(13696), UINT16_C(45355) },
+        { UINT16_C(43323), UINT16_C(10936), UINT16_C(48700), UINT16_C(31826), UINT16_C(46244), UINT16_C(54831), UINT16_C(13696), UINT16_C(12982) },
+        { UINT16_C(43323), UINT16_C(10936), UINT16_C(48700), UINT16_C(31826), UINT16_C(16379), UINT16_C(54831), UINT16_C(13696), UINT16_C(45355) } } },
+    { { UINT16_C(36792), UINT16_C(27691), UINT16_C(52392), UINT16_C(48141), UINT16_C(53745), UINT16_C( 1028), UINT16_C(38439), UINT16_C(11899) },
+      { UINT16_C(45072), UINT16_C( 9158), UINT16_C( 2684), UINT16_C(38929), UINT16_C( 7609), UINT16_C(27363), UINT16_C(40598), UINT16_C(29902) },
+      { { UINT16_C(29902), UINT16_C(27691), UINT16_C(52392), UINT16_C(48141), UINT16_C(53745), UINT16_C( 1028), UINT16_C(38439), UINT16_C(11899) },
+        { UINT16_C(36792), UINT16_C(27691), UINT16_C(52392), UINT16_C(48141), UINT16_C(53745), UINT16_C( 1028), UINT16_C(38439), UINT16_C(45072) },
+        { UINT16_C(36792), UINT16_C(27691), UINT16_C(52392), UINT16_C(48141), UINT16_C( 7609), UINT16_C( 1028), UINT16_C(38439), UINT16_C(11899) } } },
+    { { UINT16_C(37564), UINT16_C(40419), UINT16_C(13960), UINT16_C( 9752), UINT16_C( 6711), UINT16_C(14476), UINT16_C(33503), UINT16_C(57178) },
+      { UINT16_C(46632), UINT16_C( 8098), UINT16_C(60488), UINT16_C(30864), UINT16_C(46159), UINT16_C(38649), UINT16_C(43602), UINT16_C( 8532) },
+      { { UINT16_C( 8532), UINT16_C(40419), UINT16_C(13960), UINT16_C( 9752), UINT16_C( 6711), UINT16_C(14476), UINT16_C(33503), UINT16_C(57178) },
+        { UINT16_C(37564), UINT16_C(40419), UINT16_C(13960), UINT16_C( 9752), UINT16_C( 6711), UINT16_C(14476), UINT16_C(33503), UINT16_C(46632) },
+        { UINT16_C(37564), UINT16_C(40419), UINT16_C(13960), UINT16_C( 9752), UINT16_C(46159), UINT16_C(14476), UINT16_C(33503), UINT16_C(57178) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_uint16x8_t b = simde_vld1q_u16(test_vec[i].b);
+    simde_uint16x8_t r0 = simde_vcopyq_laneq_u16(a, 0, b, 7);
+    simde_uint16x8_t r1 = simde_vcopyq_laneq_u16(a, 7, b, 0);
+    simde_uint16x8_t r2 = simde_vcopyq_laneq_u16(a, 4, b, 4);
+
+    simde_test_arm_neon_assert_equal_u16x8(r0, simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r1, simde_vld1q_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x8(r2, simde_vld1q_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r[3][4];
+  } test_vec[] = {
+    { { UINT32_C(1964401880), UINT32_C(1892547813), UINT32_C(4283883445), UINT32_C(3401864351) },
+      { UINT32_C(3468304684), UINT32_C(4026046728), UINT32_C( 869976522), UINT32_C(3700771864) },
+      { { UINT32_C(3700771864), UINT32_C(1892547813), UINT32_C(4283883445), UINT32_C(3401864351) },
+        { UINT32_C(1964401880), UINT32_C(1892547813), UINT32_C(4283883445), UINT32_C(3468304684) },
+        { UINT32_C(1964401880), UINT32_C(1892547813), UINT32_C( 869976522), UINT32_C(3401864351) } } },
+    { { UINT32_C(3154469330), UINT32_C(4135253853), UINT32_C(2709403031), UINT32_C(1934031600) },
+      { UINT32_C(2803923954), UINT32_C(3206475097), UINT32_C(2676592555), UINT32_C(1879836872) },
+      { { UINT32_C(1879836872), UINT32_C(4135253853), UINT32_C(2709403031), UINT32_C(1934031600) },
+        { UINT32_C(3154469330), UINT32_C(4135253853), UINT32_C(2709403031), UINT32_C(2803923954) },
+        { UINT32_C(3154469330), UINT32_C(4135253853), UINT32_C(2676592555), UINT32_C(1934031600) } } },
+    { { UINT32_C(3469618682), UINT32_C(3165555158), UINT32_C(1345437889), UINT32_C(2774952406) },
+      { UINT32_C(2728791053), UINT32_C(2682450651), UINT32_C(1224025538), UINT32_C( 321134323) },
+      { { UINT32_C( 321134323), UINT32_C(3165555158), UINT32_C(1345437889), UINT32_C(2774952406) },
+        { UINT32_C(3469618682), UINT32_C(3165555158), UINT32_C(1345437889), UINT32_C(2728791053) },
+        { UINT32_C(3469618682), UINT32_C(3165555158), UINT32_C(1224025538), UINT32_C(2774952406) } } },
+    { { UINT32_C(1430561059), UINT32_C(1646942991), UINT32_C(3871934390), UINT32_C(4293182996) },
+      { UINT32_C(2687673602), UINT32_C(1266807602), UINT32_C(1396076708), UINT32_C( 896526903) },
+      { { UINT32_C( 896526903), UINT32_C(1646942991), UINT32_C(3871934390), UINT32_C(4293182996) },
+        { UINT32_C(1430561059), UINT32_C(1646942991), UINT32_C(3871934390), UINT32_C(2687673602) },
+        { UINT32_C(1430561059), UINT32_C(1646942991), UINT32_C(1396076708), UINT32_C(4293182996) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t b = simde_vld1q_u32(test_vec[i].b);
+    simde_uint32x4_t r0 = simde_vcopyq_laneq_u32(a, 0, b, 3);
+    simde_uint32x4_t r1 = simde_vcopyq_laneq_u32(a, 3, b, 0);
+    simde_uint32x4_t r2 = simde_vcopyq_laneq_u32(a, 2, b, 2);
+
+    simde_test_arm_neon_assert_equal_u32x4(r0, simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r1, simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r2, simde_vld1q_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcopyq_laneq_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint64_t r[3][2];
+  } test_vec[] = {
+    { { UINT64_C( 6661183958473685266), UINT64_C( 5959616304321677057) },
+      { UINT64_C(15406944488574091947), UINT64_C(10727063967291585992) },
+      { { UINT64_C(10727063967291585992), UINT64_C( 5959616304321677057) },
+        { UINT64_C( 6661183958473685266), UINT64_C(15406944488574091947) },
+        { UINT64_C( 6661183958473685266), UINT64_C(10727063967291585992) } } },
+    { { UINT64_C( 2403375364025721593), UINT64_C(17532816555901518342) },
+      { UINT64_C(16120096036216300619), UINT64_C( 9804690580517793966) },
+      { { UINT64_C( 9804690580517793966), UINT64_C(17532816555901518342) },
+        { UINT64_C( 2403375364025721593), UINT64_C(16120096036216300619) },
+        { UINT64_C( 2403375364025721593), UINT64_C( 9804690580517793966) } } },
+    { { UINT64_C( 8215150270873638755), UINT64_C(12841908601225360167) },
+      { UINT64_C(10466313764908657543), UINT64_C( 8536186300310111170) },
+      { { UINT64_C( 8536186300310111170), UINT64_C(12841908601225360167) },
+        { UINT64_C( 8215150270873638755), UINT64_C(10466313764908657543) },
+        { UINT64_C( 8215150270873638755), UINT64_C( 8536186300310111170) } } },
+    { { UINT64_C(12171889921990499106), UINT64_C(11425064547348425886) },
+      { UINT64_C( 7687378036169552794), UINT64_C( 6879856537550041711) },
+      { { UINT64_C( 6879856537550041711), UINT64_C(11425064547348425886) },
+        { UINT64_C(12171889921990499106), UINT64_C( 7687378036169552794) },
+        { UINT64_C(12171889921990499106), UINT64_C( 6879856537550041711) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+    simde_uint64x2_t r0 = simde_vcopyq_laneq_u64(a, 0, b, 1);
+    simde_uint64x2_t r1 = simde_vcopyq_laneq_u64(a, 1, b, 0);
+    simde_uint64x2_t r2 = simde_vcopyq_laneq_u64(a, 1, b, 1);
+
+    simde_test_arm_neon_assert_equal_u64x2(r0, simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r1, simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r2, simde_vld1q_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_lane_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopy_laneq_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_lane_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcopyq_laneq_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
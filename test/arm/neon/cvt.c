@@ -17,6 +17,22 @@ test_simde_vcvts_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
                     INT32_MAX },
       { HEDLEY_STATIC_CAST(simde_float32, INT32_MIN) - SIMDE_FLOAT32_C(1000.0),
                     INT32_MIN },
+      { SIMDE_FLOAT32_C(2147483648.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967296.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967040.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483520.0),
+         INT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+           INT32_MIN },
+      { SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+           INT32_MIN },
     #endif
     { SIMDE_FLOAT32_C(   550.19),
        INT32_C(         550) },
@@ -125,6 +141,22 @@ test_simde_vcvts_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
                   UINT32_MAX },
       { SIMDE_FLOAT32_C(-1000.0),
         UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(2147483648.0),
+        UINT32_C(2147483648) },
+      { SIMDE_FLOAT32_C(4294967296.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+        UINT32_C(3000000000) },
+      { SIMDE_FLOAT32_C(4294967040.0),
+        UINT32_C(4294967040) },
+      { SIMDE_FLOAT32_C(2147483520.0),
+        UINT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+        UINT32_C(         0) },
+      { SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+        UINT32_C(         0) },
     #endif
     { SIMDE_FLOAT32_C(   738.60),
       UINT32_C(       738) },
@@ -278,6 +310,14 @@ test_simde_vcvt_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
         {              INT32_MAX,              INT32_MIN } },
       { {        SIMDE_MATH_NANF,   SIMDE_MATH_INFINITYF },
         {  INT32_C(           0),              INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        {  INT32_C(2147483520),    INT32_MIN } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(         0),    INT32_MIN } },
     #endif
     { { SIMDE_FLOAT32_C(   396.15), SIMDE_FLOAT32_C(  -246.90) },
       {  INT32_C(         396), -INT32_C(         246) } },
@@ -438,6 +478,14 @@ test_simde_vcvt_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
         { INT32_C(0) } },
       { { SIMDE_MATH_NAN },
         { INT32_C(0) } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        { UINT32_C(2147483648),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        { UINT32_C(2147483520), UINT32_C(         0) } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(         0), UINT32_C(         0) } },
     #endif
     { { SIMDE_FLOAT32_C(   308.77), SIMDE_FLOAT32_C(   269.80) },
       { UINT32_C(       308), UINT32_C(       269) } },
@@ -596,6 +644,10 @@ test_simde_vcvtq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     #if !defined(SIMDE_FAST_CONVERSION_RANGE)
       { { HEDLEY_STATIC_CAST(simde_float32, INT32_MAX) + SIMDE_FLOAT32_C(10000.0), HEDLEY_STATIC_CAST(simde_float32, INT32_MIN) - SIMDE_FLOAT32_C(10000.0), SIMDE_MATH_NANF, SIMDE_MATH_INFINITYF },
         {              INT32_MAX,              INT32_MIN,  INT32_C(           0),              INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX,    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(2147483520),    INT32_MIN,  INT32_C(         0),    INT32_MIN } },
     #endif
     { { SIMDE_FLOAT32_C(   553.19), SIMDE_FLOAT32_C(   -89.37), SIMDE_FLOAT32_C(  -751.51), SIMDE_FLOAT32_C(    39.67) },
       {  INT32_C(         553), -INT32_C(          89), -INT32_C(         751),  INT32_C(          39) } },
@@ -755,6 +807,10 @@ test_simde_vcvtq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
     #if !defined(SIMDE_FAST_CONVERSION_RANGE)
       { { HEDLEY_STATIC_CAST(simde_float32, UINT32_MAX) + SIMDE_FLOAT32_C(10000.0), SIMDE_MATH_NANF, -SIMDE_MATH_NANF, SIMDE_MATH_INFINITYF },
         {           UINT32_MAX, UINT32_C(         0), UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(2147483648),           UINT32_MAX, UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(2147483520), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
     #endif
     { { SIMDE_FLOAT32_C(   169.27), SIMDE_FLOAT32_C(   616.25), SIMDE_FLOAT32_C(   454.93), SIMDE_FLOAT32_C(   561.26) },
       { UINT32_C(       169), UINT32_C(       616), UINT32_C(       454), UINT32_C(       561) } },
@@ -0,0 +1,1635 @@
+#define SIMDE_TEST_ARM_NEON_INSN cvt_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/cvt_n.h"
+
+static int
+test_simde_vcvts_n_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    int32_t r1;
+    int32_t r10;
+    int32_t r21;
+    int32_t r32;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { SIMDE_FLOAT32_C(0.5),
+         INT32_C(         1),
+         INT32_C(       512),
+         INT32_C(   1048576),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(0.75),
+         INT32_C(         1),
+         INT32_C(       768),
+         INT32_C(   1572864),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(1.0),
+         INT32_C(         2),
+         INT32_C(      1024),
+         INT32_C(   2097152),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+           INT32_MAX,
+           INT32_MAX,
+           INT32_MAX,
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(1500000000.0),
+           INT32_MAX,
+           INT32_MAX,
+           INT32_MAX,
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(-0.5),
+        -INT32_C(         1),
+        -INT32_C(       512),
+        -INT32_C(   1048576),
+           INT32_MIN },
+      { SIMDE_MATH_NANF,
+         INT32_C(         0),
+         INT32_C(         0),
+         INT32_C(         0),
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(0.9999999403953552),
+         INT32_C(         1),
+         INT32_C(      1023),
+         INT32_C(   2097151),
+           INT32_MAX },
+    #endif
+    { SIMDE_FLOAT32_C(   795.83),
+       INT32_C(      1591),
+       INT32_C(    814929),
+       INT32_C(1668976512),
+         INT32_MAX },
+    { SIMDE_FLOAT32_C(   591.07),
+       INT32_C(      1182),
+       INT32_C(    605255),
+       INT32_C(1239563648),
+         INT32_MAX },
+    { SIMDE_FLOAT32_C(  -430.40),
+      -INT32_C(       860),
+      -INT32_C(    440729),
+      -INT32_C( 902614208),
+         INT32_MIN },
+    { SIMDE_FLOAT32_C(   322.17),
+       INT32_C(       644),
+       INT32_C(    329902),
+       INT32_C( 675639488),
+         INT32_MAX },
+    { SIMDE_FLOAT32_C(   261.52),
+       INT32_C(       523),
+       INT32_C(    267796),
+       INT32_C( 548447168),
+         INT32_MAX },
+    { SIMDE_FLOAT32_C(   283.83),
+       INT32_C(       567),
+       INT32_C(    290641),
+       INT32_C( 595234624),
+         INT32_MAX },
+    { SIMDE_FLOAT32_C(   668.83),
+       INT32_C(      1337),
+       INT32_C(    684881),
+       INT32_C(1402638208),
+         INT32_MAX },
+    { SIMDE_FLOAT32_C(  -639.54),
+      -INT32_C(      1279),
+      -INT32_C(    654888),
+      -INT32_C(1341212544),
+         INT32_MIN }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r1 = simde_vcvts_n_s32_f32(test_vec[i].a, 1);
+    int32_t r10 = simde_vcvts_n_s32_f32(test_vec[i].a, 10);
+    int32_t r21 = simde_vcvts_n_s32_f32(test_vec[i].a, 21);
+
+    simde_assert_equal_i32(r1, test_vec[i].r1);
+    simde_assert_equal_i32(r10, test_vec[i].r10);
+    simde_assert_equal_i32(r21, test_vec[i].r21);
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      int32_t r32 = simde_vcvts_n_s32_f32(test_vec[i].a, 32);
+      simde_assert_equal_i32(r32, test_vec[i].r32);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvts_n_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    uint32_t r1;
+    uint32_t r10;
+    uint32_t r21;
+    uint32_t r32;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { SIMDE_FLOAT32_C(0.5),
+        UINT32_C(         1),
+        UINT32_C(       512),
+        UINT32_C(   1048576),
+        UINT32_C(2147483648) },
+      { SIMDE_FLOAT32_C(0.75),
+        UINT32_C(         1),
+        UINT32_C(       768),
+        UINT32_C(   1572864),
+        UINT32_C(3221225472) },
+      { SIMDE_FLOAT32_C(1.0),
+        UINT32_C(         2),
+        UINT32_C(      1024),
+        UINT32_C(   2097152),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+                  UINT32_MAX,
+                  UINT32_MAX,
+                  UINT32_MAX,
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(1500000000.0),
+        UINT32_C(3000000000),
+                  UINT32_MAX,
+                  UINT32_MAX,
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(-0.5),
+        UINT32_C(         0),
+        UINT32_C(         0),
+        UINT32_C(         0),
+        UINT32_C(         0) },
+      { SIMDE_MATH_NANF,
+        UINT32_C(         0),
+        UINT32_C(         0),
+        UINT32_C(         0),
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(0.9999999403953552),
+        UINT32_C(         1),
+        UINT32_C(      1023),
+        UINT32_C(   2097151),
+        UINT32_C(4294967040) },
+    #endif
+    { SIMDE_FLOAT32_C(   998.50),
+      UINT32_C(      1997),
+      UINT32_C(   1022464),
+      UINT32_C(2094006272),
+                UINT32_MAX },
+    { SIMDE_FLOAT32_C(   501.84),
+      UINT32_C(      1003),
+      UINT32_C(    513884),
+      UINT32_C(1052434752),
+                UINT32_MAX },
+    { SIMDE_FLOAT32_C(    68.52),
+      UINT32_C(       137),
+      UINT32_C(     70164),
+      UINT32_C( 143696848),
+                UINT32_MAX },
+    { SIMDE_FLOAT32_C(   534.68),
+      UINT32_C(      1069),
+      UINT32_C(    547512),
+      UINT32_C(1121305216),
+                UINT32_MAX },
+    { SIMDE_FLOAT32_C(   159.44),
+      UINT32_C(       318),
+      UINT32_C(    163266),
+      UINT32_C( 334369920),
+                UINT32_MAX },
+    { SIMDE_FLOAT32_C(    85.65),
+      UINT32_C(       171),
+      UINT32_C(     87705),
+      UINT32_C( 179621072),
+                UINT32_MAX },
+    { SIMDE_FLOAT32_C(   649.07),
+      UINT32_C(      1298),
+      UINT32_C(    664647),
+      UINT32_C(1361198464),
+                UINT32_MAX },
+    { SIMDE_FLOAT32_C(   797.29),
+      UINT32_C(      1594),
+      UINT32_C(    816424),
+      UINT32_C(1672038272),
+                UINT32_MAX }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r1 = simde_vcvts_n_u32_f32(test_vec[i].a, 1);
+    uint32_t r10 = simde_vcvts_n_u32_f32(test_vec[i].a, 10);
+    uint32_t r21 = simde_vcvts_n_u32_f32(test_vec[i].a, 21);
+
+    simde_assert_equal_u32(r1, test_vec[i].r1);
+    simde_assert_equal_u32(r10, test_vec[i].r10);
+    simde_assert_equal_u32(r21, test_vec[i].r21);
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      uint32_t r32 = simde_vcvts_n_u32_f32(test_vec[i].a, 32);
+      simde_assert_equal_u32(r32, test_vec[i].r32);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvts_n_f32_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a;
+    simde_float32 r1;
+    simde_float32 r10;
+    simde_float32 r21;
+    simde_float32 r32;
+  } test_vec[] = {
+    { -INT32_C(1320981128),
+      SIMDE_FLOAT32_C(-6.6049056e+08),
+      SIMDE_FLOAT32_C(-1290020.6),
+      SIMDE_FLOAT32_C(-629.8929),
+      SIMDE_FLOAT32_C(-0.30756488) },
+    { -INT32_C(1005362259),
+      SIMDE_FLOAT32_C(-5.0268112e+08),
+      SIMDE_FLOAT32_C(-981799.06),
+      SIMDE_FLOAT32_C(-479.39407),
+      SIMDE_FLOAT32_C(-0.23407914) },
+    {  INT32_C( 505453043),
+      SIMDE_FLOAT32_C(2.5272653e+08),
+      SIMDE_FLOAT32_C(493606.5),
+      SIMDE_FLOAT32_C(241.0188),
+      SIMDE_FLOAT32_C(0.11768496) },
+    {  INT32_C( 865420918),
+      SIMDE_FLOAT32_C(4.3271046e+08),
+      SIMDE_FLOAT32_C(845137.6),
+      SIMDE_FLOAT32_C(412.66486),
+      SIMDE_FLOAT32_C(0.20149651) },
+    {  INT32_C(  63807988),
+      SIMDE_FLOAT32_C(31903994.0),
+      SIMDE_FLOAT32_C(62312.49),
+      SIMDE_FLOAT32_C(30.42602),
+      SIMDE_FLOAT32_C(0.014856455) },
+    { -INT32_C(1283438520),
+      SIMDE_FLOAT32_C(-6.4171923e+08),
+      SIMDE_FLOAT32_C(-1253357.9),
+      SIMDE_FLOAT32_C(-611.99115),
+      SIMDE_FLOAT32_C(-0.2988238) },
+    { -INT32_C(1775422762),
+      SIMDE_FLOAT32_C(-8.8771136e+08),
+      SIMDE_FLOAT32_C(-1733811.2),
+      SIMDE_FLOAT32_C(-846.5875),
+      SIMDE_FLOAT32_C(-0.4133728) },
+    {  INT32_C( 124021071),
+      SIMDE_FLOAT32_C(62010536.0),
+      SIMDE_FLOAT32_C(121114.33),
+      SIMDE_FLOAT32_C(59.137856),
+      SIMDE_FLOAT32_C(0.028875906) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r1 = simde_vcvts_n_f32_s32(test_vec[i].a, 1);
+    simde_float32 r10 = simde_vcvts_n_f32_s32(test_vec[i].a, 10);
+    simde_float32 r21 = simde_vcvts_n_f32_s32(test_vec[i].a, 21);
+    simde_float32 r32 = simde_vcvts_n_f32_s32(test_vec[i].a, 32);
+
+    simde_assert_equal_f32(r1, test_vec[i].r1, 6);
+    simde_assert_equal_f32(r10, test_vec[i].r10, 6);
+    simde_assert_equal_f32(r21, test_vec[i].r21, 6);
+    simde_assert_equal_f32(r32, test_vec[i].r32, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvts_n_f32_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    simde_float32 r1;
+    simde_float32 r10;
+    simde_float32 r21;
+    simde_float32 r32;
+  } test_vec[] = {
+    { UINT32_C(1708056646),
+      SIMDE_FLOAT32_C(8.5402835e+08),
+      SIMDE_FLOAT32_C(1668024.1),
+      SIMDE_FLOAT32_C(814.4649),
+      SIMDE_FLOAT32_C(0.39768794) },
+    { UINT32_C(1918466101),
+      SIMDE_FLOAT32_C(9.59233e+08),
+      SIMDE_FLOAT32_C(1873502.0),
+      SIMDE_FLOAT32_C(914.7959),
+      SIMDE_FLOAT32_C(0.44667768) },
+    { UINT32_C(3776247215),
+      SIMDE_FLOAT32_C(1.8881236e+09),
+      SIMDE_FLOAT32_C(3687741.5),
+      SIMDE_FLOAT32_C(1800.655),
+      SIMDE_FLOAT32_C(0.8792261) },
+    { UINT32_C(2064215288),
+      SIMDE_FLOAT32_C(1.03210765e+09),
+      SIMDE_FLOAT32_C(2015835.2),
+      SIMDE_FLOAT32_C(984.29456),
+      SIMDE_FLOAT32_C(0.48061258) },
+    { UINT32_C(3386412102),
+      SIMDE_FLOAT32_C(1.693206e+09),
+      SIMDE_FLOAT32_C(3307043.0),
+      SIMDE_FLOAT32_C(1614.7671),
+      SIMDE_FLOAT32_C(0.7884605) },
+    { UINT32_C( 700347294),
+      SIMDE_FLOAT32_C(3.5017363e+08),
+      SIMDE_FLOAT32_C(683932.9),
+      SIMDE_FLOAT32_C(333.9516),
+      SIMDE_FLOAT32_C(0.1630623) },
+    { UINT32_C(3305116853),
+      SIMDE_FLOAT32_C(1.6525585e+09),
+      SIMDE_FLOAT32_C(3227653.2),
+      SIMDE_FLOAT32_C(1576.0026),
+      SIMDE_FLOAT32_C(0.7695325) },
+    { UINT32_C( 828718230),
+      SIMDE_FLOAT32_C(4.143591e+08),
+      SIMDE_FLOAT32_C(809295.1),
+      SIMDE_FLOAT32_C(395.16364),
+      SIMDE_FLOAT32_C(0.192951) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r1 = simde_vcvts_n_f32_u32(test_vec[i].a, 1);
+    simde_float32 r10 = simde_vcvts_n_f32_u32(test_vec[i].a, 10);
+    simde_float32 r21 = simde_vcvts_n_f32_u32(test_vec[i].a, 21);
+    simde_float32 r32 = simde_vcvts_n_f32_u32(test_vec[i].a, 32);
+
+    simde_assert_equal_f32(r1, test_vec[i].r1, 6);
+    simde_assert_equal_f32(r10, test_vec[i].r10, 6);
+    simde_assert_equal_f32(r21, test_vec[i].r21, 6);
+    simde_assert_equal_f32(r32, test_vec[i].r32, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtd_n_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    int64_t r1;
+    int64_t r20;
+    int64_t r45;
+    int64_t r64;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   999.63),
+       INT64_C(               1999),
+       INT64_C(         1048188026),
+       INT64_C(  35171353871159132),
+                 INT64_MAX },
+    { SIMDE_FLOAT64_C(   980.31),
+       INT64_C(               1960),
+       INT64_C(         1027929538),
+       INT64_C(  34491591802402896),
+                 INT64_MAX },
+    { SIMDE_FLOAT64_C(  -599.22),
+      -INT64_C(               1198),
+      -INT64_C(          628327710),
+      -INT64_C(  21083179443069912),
+                 INT64_MIN },
+    { SIMDE_FLOAT64_C(  -870.26),
+      -INT64_C(               1740),
+      -INT64_C(          912533749),
+      -INT64_C(  30619551654026936),
+                 INT64_MIN },
+    { SIMDE_FLOAT64_C(   611.41),
+       INT64_C(               1222),
+       INT64_C(          641109852),
+       INT64_C(  21512076938832772),
+                 INT64_MAX },
+    { SIMDE_FLOAT64_C(   875.16),
+       INT64_C(               1750),
+       INT64_C(          917671772),
+       INT64_C(  30791955077262212),
+                 INT64_MAX },
+    { SIMDE_FLOAT64_C(    -2.77),
+      -INT64_C(                  5),
+      -INT64_C(            2904555),
+      -INT64_C(     97460710686064),
+                 INT64_MIN },
+    { SIMDE_FLOAT64_C(  -826.54),
+      -INT64_C(               1653),
+      -INT64_C(          866690007),
+      -INT64_C(  29081290906303200),
+                 INT64_MIN }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r1 = simde_vcvtd_n_s64_f64(test_vec[i].a, 1);
+    int64_t r20 = simde_vcvtd_n_s64_f64(test_vec[i].a, 20);
+    int64_t r45 = simde_vcvtd_n_s64_f64(test_vec[i].a, 45);
+
+    simde_assert_equal_i64(r1, test_vec[i].r1);
+    simde_assert_equal_i64(r20, test_vec[i].r20);
+    simde_assert_equal_i64(r45, test_vec[i].r45);
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      int64_t r64 = simde_vcvtd_n_s64_f64(test_vec[i].a, 64);
+      simde_assert_equal_i64(r64, test_vec[i].r64);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtd_n_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    uint64_t r1;
+    uint64_t r20;
+    uint64_t r45;
+    uint64_t r64;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(   203.18),
+      UINT64_C(                 406),
+      UINT64_C(           213049671),
+      UINT64_C(    7148760721008886),
+                          UINT64_MAX },
+    { SIMDE_FLOAT64_C(   762.58),
+      UINT64_C(                1525),
+      UINT64_C(           799623086),
+      UINT64_C(   26830898467501508),
+                          UINT64_MAX },
+    { SIMDE_FLOAT64_C(   279.43),
+      UINT64_C(                 558),
+      UINT64_C(           293003591),
+      UINT64_C(    9831569092782326),
+                          UINT64_MAX },
+    { SIMDE_FLOAT64_C(   726.86),
+      UINT64_C(                1453),
+      UINT64_C(           762167951),
+      UINT64_C(   25574112696488428),
+                          UINT64_MAX },
+    { SIMDE_FLOAT64_C(   624.73),
+      UINT64_C(                1249),
+      UINT64_C(           655076884),
+      UINT64_C(   21980732775056016),
+                          UINT64_MAX },
+    { SIMDE_FLOAT64_C(   699.82),
+      UINT64_C(                1399),
+      UINT64_C(           733814456),
+      UINT64_C(   24622727275206412),
+                          UINT64_MAX },
+    { SIMDE_FLOAT64_C(   495.95),
+      UINT64_C(                 991),
+      UINT64_C(           520041267),
+      UINT64_C(   17449689337456230),
+                          UINT64_MAX },
+    { SIMDE_FLOAT64_C(    28.39),
+      UINT64_C(                  56),
+      UINT64_C(            29769072),
+      UINT64_C(     998884323601940),
+                          UINT64_MAX }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r1 = simde_vcvtd_n_u64_f64(test_vec[i].a, 1);
+    uint64_t r20 = simde_vcvtd_n_u64_f64(test_vec[i].a, 20);
+    uint64_t r45 = simde_vcvtd_n_u64_f64(test_vec[i].a, 45);
+
+    simde_assert_equal_u64(r1, test_vec[i].r1);
+    simde_assert_equal_u64(r20, test_vec[i].r20);
+    simde_assert_equal_u64(r45, test_vec[i].r45);
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      uint64_t r64 = simde_vcvtd_n_u64_f64(test_vec[i].a, 64);
+      simde_assert_equal_u64(r64, test_vec[i].r64);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtd_n_f64_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a;
+    simde_float64 r1;
+    simde_float64 r20;
+    simde_float64 r45;
+    simde_float64 r64;
+  } test_vec[] = {
+    { -INT64_C(3320368038606613003),
+      SIMDE_FLOAT64_C(-1.6601840193033065e+18),
+      SIMDE_FLOAT64_C(-3166549719435.3228),
+      SIMDE_FLOAT64_C(-94370.53559527763),
+      SIMDE_FLOAT64_C(-0.17999751204543615) },
+    {  INT64_C( 387422487414539785),
+      SIMDE_FLOAT64_C(1.937112437072699e+17),
+      SIMDE_FLOAT64_C(369474875845.4702),
+      SIMDE_FLOAT64_C(11011.209364100403),
+      SIMDE_FLOAT64_C(0.0210022151262291) },
+    {  INT64_C(3455225594858751652),
+      SIMDE_FLOAT64_C(1.7276127974293757e+18),
+      SIMDE_FLOAT64_C(3295159907206.2983),
+      SIMDE_FLOAT64_C(98203.41787357027),
+      SIMDE_FLOAT64_C(0.1873081548186689) },
+    { -INT64_C(7634615737437523465),
+      SIMDE_FLOAT64_C(-3.817307868718762e+18),
+      SIMDE_FLOAT64_C(-7280936944425.129),
+      SIMDE_FLOAT64_C(-216988.83010223892),
+      SIMDE_FLOAT64_C(-0.41387334843108925) },
+    { -INT64_C(6302786240888069945),
+      SIMDE_FLOAT64_C(-3.151393120444035e+18),
+      SIMDE_FLOAT64_C(-6010805359733.648),
+      SIMDE_FLOAT64_C(-179135.9591404691),
+      SIMDE_FLOAT64_C(-0.3416747267541296) },
+    {  INT64_C(7647943736752492200),
+      SIMDE_FLOAT64_C(3.8239718683762463e+18),
+      SIMDE_FLOAT64_C(7293647515060.895),
+      SIMDE_FLOAT64_C(217367.63462605758),
+      SIMDE_FLOAT64_C(0.41459586072169796) },
+    {  INT64_C(5782587612457873511),
+      SIMDE_FLOAT64_C(2.8912938062289367e+18),
+      SIMDE_FLOAT64_C(5514705288370.012),
+      SIMDE_FLOAT64_C(164351.02487713133),
+      SIMDE_FLOAT64_C(0.3134747026007296) },
+    {  INT64_C(5493008197638952807),
+      SIMDE_FLOAT64_C(2.7465040988194765e+18),
+      SIMDE_FLOAT64_C(5238540837897.256),
+      SIMDE_FLOAT64_C(156120.68289212155),
+      SIMDE_FLOAT64_C(0.2977765710680419) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r1 = simde_vcvtd_n_f64_s64(test_vec[i].a, 1);
+    simde_float64 r20 = simde_vcvtd_n_f64_s64(test_vec[i].a, 20);
+    simde_float64 r45 = simde_vcvtd_n_f64_s64(test_vec[i].a, 45);
+    simde_float64 r64 = simde_vcvtd_n_f64_s64(test_vec[i].a, 64);
+
+    simde_assert_equal_f64(r1, test_vec[i].r1, 6);
+    simde_assert_equal_f64(r20, test_vec[i].r20, 6);
+    simde_assert_equal_f64(r45, test_vec[i].r45, 6);
+    simde_assert_equal_f64(r64, test_vec[i].r64, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtd_n_f64_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    simde_float64 r1;
+    simde_float64 r20;
+    simde_float64 r45;
+    simde_float64 r64;
+  } test_vec[] = {
+    { UINT64_C( 9651787770992742137),
+      SIMDE_FLOAT64_C(4.825893885496371e+18),
+      SIMDE_FLOAT64_C(9204662104599.707),
+      SIMDE_FLOAT64_C(274320.3075110825),
+      SIMDE_FLOAT64_C(0.5232244634839678) },
+    { UINT64_C(15225300128090717853),
+      SIMDE_FLOAT64_C(7.612650064045359e+18),
+      SIMDE_FLOAT64_C(14519977691736.906),
+      SIMDE_FLOAT64_C(432729.0562312873),
+      SIMDE_FLOAT64_C(0.8253651737809893) },
+    { UINT64_C(11537617361261897436),
+      SIMDE_FLOAT64_C(5.768808680630949e+18),
+      SIMDE_FLOAT64_C(11003129349958.322),
+      SIMDE_FLOAT64_C(327918.8081609703),
+      SIMDE_FLOAT64_C(0.6254554904193311) },
+    { UINT64_C(11586769977700884547),
+      SIMDE_FLOAT64_C(5.793384988850442e+18),
+      SIMDE_FLOAT64_C(11050004937840.352),
+      SIMDE_FLOAT64_C(329315.80954314326),
+      SIMDE_FLOAT64_C(0.6281200590956559) },
+    { UINT64_C( 7707790807156344943),
+      SIMDE_FLOAT64_C(3.8538954035781724e+18),
+      SIMDE_FLOAT64_C(7350722129017.205),
+      SIMDE_FLOAT64_C(219068.5906713368),
+      SIMDE_FLOAT64_C(0.41784017690913544) },
+    { UINT64_C( 7684549277560098150),
+      SIMDE_FLOAT64_C(3.842274638780049e+18),
+      SIMDE_FLOAT64_C(7328557279167.269),
+      SIMDE_FLOAT64_C(218408.02667043413),
+      SIMDE_FLOAT64_C(0.4165802510651286) },
+    { UINT64_C(14049529929952404530),
+      SIMDE_FLOAT64_C(7.024764964976203e+18),
+      SIMDE_FLOAT64_C(13398675851776.51),
+      SIMDE_FLOAT64_C(399311.65730287164),
+      SIMDE_FLOAT64_C(0.7616265436227257) },
+    { UINT64_C(  954131989747972680),
+      SIMDE_FLOAT64_C(4.7706599487398637e+17),
+      SIMDE_FLOAT64_C(909931173084.233),
+      SIMDE_FLOAT64_C(27118.062170870096),
+      SIMDE_FLOAT64_C(0.051723598806133454) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r1 = simde_vcvtd_n_f64_u64(test_vec[i].a, 1);
+    simde_float64 r20 = simde_vcvtd_n_f64_u64(test_vec[i].a, 20);
+    simde_float64 r45 = simde_vcvtd_n_f64_u64(test_vec[i].a, 45);
+    simde_float64 r64 = simde_vcvtd_n_f64_u64(test_vec[i].a, 64);
+
+    simde_assert_equal_f64(r1, test_vec[i].r1, 6);
+    simde_assert_equal_f64(r20, test_vec[i].r20, 6);
+    simde_assert_equal_f64(r45, test_vec[i].r45, 6);
+    simde_assert_equal_f64(r64, test_vec[i].r64, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvt_n_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    int32_t r1[2];
+    int32_t r10[2];
+    int32_t r21[2];
+    int32_t r32[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { { SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(0.75) },
+        {  INT32_C(         1),  INT32_C(         1) },
+        {  INT32_C(       512),  INT32_C(       768) },
+        {  INT32_C(   1048576),  INT32_C(   1572864) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(1.0), SIMDE_FLOAT32_C(2147483648.0) },
+        {  INT32_C(         2),    INT32_MAX },
+        {  INT32_C(      1024),    INT32_MAX },
+        {  INT32_C(   2097152),    INT32_MAX },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(1500000000.0), SIMDE_FLOAT32_C(-0.5) },
+        {    INT32_MAX, -INT32_C(         1) },
+        {    INT32_MAX, -INT32_C(       512) },
+        {    INT32_MAX, -INT32_C(   1048576) },
+        {    INT32_MAX,    INT32_MIN } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(0.9999999403953552) },
+        {  INT32_C(         0),  INT32_C(         1) },
+        {  INT32_C(         0),  INT32_C(      1023) },
+        {  INT32_C(         0),  INT32_C(   2097151) },
+        {  INT32_C(         0),    INT32_MAX } },
+    #endif
+    { { SIMDE_FLOAT32_C(   447.16), SIMDE_FLOAT32_C(  -823.55) },
+      {  INT32_C(       894), -INT32_C(      1647) },
+      {  INT32_C(    457891), -INT32_C(    843315) },
+      {  INT32_C( 937762496), -INT32_C(1727109504) },
+      {    INT32_MAX,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(   196.60), SIMDE_FLOAT32_C(   303.79) },
+      {  INT32_C(       393),  INT32_C(       607) },
+      {  INT32_C(    201318),  INT32_C(    311080) },
+      {  INT32_C( 412300096),  INT32_C( 637093824) },
+      {    INT32_MAX,    INT32_MAX } },
+    { { SIMDE_FLOAT32_C(  -823.29), SIMDE_FLOAT32_C(  -692.04) },
+      { -INT32_C(      1646), -INT32_C(      1384) },
+      { -INT32_C(    843048), -INT32_C(    708648) },
+      { -INT32_C(1726564224), -INT32_C(1451313024) },
+      {    INT32_MIN,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(  -823.80), SIMDE_FLOAT32_C(  -885.45) },
+      { -INT32_C(      1647), -INT32_C(      1770) },
+      { -INT32_C(    843571), -INT32_C(    906700) },
+      { -INT32_C(1727633792), -INT32_C(1856923264) },
+      {    INT32_MIN,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(   653.19), SIMDE_FLOAT32_C(  -320.85) },
+      {  INT32_C(      1306), -INT32_C(       641) },
+      {  INT32_C(    668866), -INT32_C(    328550) },
+      {  INT32_C(1369838720), -INT32_C( 672871232) },
+      {    INT32_MAX,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(   365.91), SIMDE_FLOAT32_C(   837.01) },
+      {  INT32_C(       731),  INT32_C(      1674) },
+      {  INT32_C(    374691),  INT32_C(    857098) },
+      {  INT32_C( 767368896),  INT32_C(1755337216) },
+      {    INT32_MAX,    INT32_MAX } },
+    { { SIMDE_FLOAT32_C(  -860.72), SIMDE_FLOAT32_C(  -673.77) },
+      { -INT32_C(      1721), -INT32_C(      1347) },
+      { -INT32_C(    881377), -INT32_C(    689940) },
+      { -INT32_C(1805060608), -INT32_C(1412998144) },
+      {    INT32_MIN,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(   -45.37), SIMDE_FLOAT32_C(   194.94) },
+      { -INT32_C(        90),  INT32_C(       389) },
+      { -INT32_C(     46458),  INT32_C(    199618) },
+      { -INT32_C(  95147784),  INT32_C( 408818816) },
+      {    INT32_MIN,    INT32_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+
+    simde_int32x2_t r1 = simde_vcvt_n_s32_f32(a, 1);
+    simde_int32x2_t r10 = simde_vcvt_n_s32_f32(a, 10);
+    simde_int32x2_t r21 = simde_vcvt_n_s32_f32(a, 21);
+
+    simde_test_arm_neon_assert_equal_i32x2(r1, simde_vld1_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x2(r10, simde_vld1_s32(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i32x2(r21, simde_vld1_s32(test_vec[i].r21));
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      simde_int32x2_t r32 = simde_vcvt_n_s32_f32(a, 32);
+      simde_test_arm_neon_assert_equal_i32x2(r32, simde_vld1_s32(test_vec[i].r32));
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvt_n_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r1[2];
+    uint32_t r10[2];
+    uint32_t r21[2];
+    uint32_t r32[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { { SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(0.75) },
+        { UINT32_C(         1), UINT32_C(         1) },
+        { UINT32_C(       512), UINT32_C(       768) },
+        { UINT32_C(   1048576), UINT32_C(   1572864) },
+        { UINT32_C(2147483648), UINT32_C(3221225472) } },
+      { { SIMDE_FLOAT32_C(1.0), SIMDE_FLOAT32_C(2147483648.0) },
+        { UINT32_C(         2),           UINT32_MAX },
+        { UINT32_C(      1024),           UINT32_MAX },
+        { UINT32_C(   2097152),           UINT32_MAX },
+        {           UINT32_MAX,           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(1500000000.0), SIMDE_FLOAT32_C(-0.5) },
+        { UINT32_C(3000000000), UINT32_C(         0) },
+        {           UINT32_MAX, UINT32_C(         0) },
+        {           UINT32_MAX, UINT32_C(         0) },
+        {           UINT32_MAX, UINT32_C(         0) } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(0.9999999403953552) },
+        { UINT32_C(         0), UINT32_C(         1) },
+        { UINT32_C(         0), UINT32_C(      1023) },
+        { UINT32_C(         0), UINT32_C(   2097151) },
+        { UINT32_C(         0), UINT32_C(4294967040) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   269.53), SIMDE_FLOAT32_C(    76.00) },
+      { UINT32_C(       539), UINT32_C(       152) },
+      { UINT32_C(    275998), UINT32_C(     77824) },
+      { UINT32_C( 565245376), UINT32_C( 159383552) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   456.48), SIMDE_FLOAT32_C(   604.89) },
+      { UINT32_C(       912), UINT32_C(      1209) },
+      { UINT32_C(    467435), UINT32_C(    619407) },
+      { UINT32_C( 957307968), UINT32_C(1268546304) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   910.77), SIMDE_FLOAT32_C(   540.78) },
+      { UINT32_C(      1821), UINT32_C(      1081) },
+      { UINT32_C(    932628), UINT32_C(    553758) },
+      { UINT32_C(1910023168), UINT32_C(1134097920) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(    59.35), SIMDE_FLOAT32_C(   413.25) },
+      { UINT32_C(       118), UINT32_C(       826) },
+      { UINT32_C(     60774), UINT32_C(    423168) },
+      { UINT32_C( 124465968), UINT32_C( 866648064) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   923.22), SIMDE_FLOAT32_C(   808.56) },
+      { UINT32_C(      1846), UINT32_C(      1617) },
+      { UINT32_C(    945377), UINT32_C(    827965) },
+      { UINT32_C(1936132608), UINT32_C(1695673216) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   661.00), SIMDE_FLOAT32_C(   553.10) },
+      { UINT32_C(      1322), UINT32_C(      1106) },
+      { UINT32_C(    676864), UINT32_C(    566374) },
+      { UINT32_C(1386217472), UINT32_C(1159934720) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   352.99), SIMDE_FLOAT32_C(   955.66) },
+      { UINT32_C(       705), UINT32_C(      1911) },
+      { UINT32_C(    361461), UINT32_C(    978595) },
+      { UINT32_C( 740273664), UINT32_C(2004164224) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   687.53), SIMDE_FLOAT32_C(   577.64) },
+      { UINT32_C(      1375), UINT32_C(      1155) },
+      { UINT32_C(    704030), UINT32_C(    591503) },
+      { UINT32_C(1441854976), UINT32_C(1211398912) },
+      {           UINT32_MAX,           UINT32_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+
+    simde_uint32x2_t r1 = simde_vcvt_n_u32_f32(a, 1);
+    simde_uint32x2_t r10 = simde_vcvt_n_u32_f32(a, 10);
+    simde_uint32x2_t r21 = simde_vcvt_n_u32_f32(a, 21);
+
+    simde_test_arm_neon_assert_equal_u32x2(r1, simde_vld1_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x2(r10, simde_vld1_u32(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u32x2(r21, simde_vld1_u32(test_vec[i].r21));
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      simde_uint32x2_t r32 = simde_vcvt_n_u32_f32(a, 32);
+      simde_test_arm_neon_assert_equal_u32x2(r32, simde_vld1_u32(test_vec[i].r32));
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvt_n_f32_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    simde_float32 r1[2];
+    simde_float32 r10[2];
+    simde_float32 r21[2];
+    simde_float32 r32[2];
+  } test_vec[] = {
+    { { -INT32_C(1590125037),  INT32_C(1356559200) },
+      { SIMDE_FLOAT32_C(-7.950625e+08), SIMDE_FLOAT32_C(6.782796e+08) },
+      { SIMDE_FLOAT32_C(-1552856.5), SIMDE_FLOAT32_C(1324764.9) },
+      { SIMDE_FLOAT32_C(-758.2307), SIMDE_FLOAT32_C(646.85785) },
+      { SIMDE_FLOAT32_C(-0.37022984), SIMDE_FLOAT32_C(0.31584856) } },
+    { {  INT32_C( 779194656), -INT32_C(1197583381) },
+      { SIMDE_FLOAT32_C(3.895973e+08), SIMDE_FLOAT32_C(-5.987917e+08) },
+      { SIMDE_FLOAT32_C(760932.25), SIMDE_FLOAT32_C(-1169515.0) },
+      { SIMDE_FLOAT32_C(371.54895), SIMDE_FLOAT32_C(-571.05225) },
+      { SIMDE_FLOAT32_C(0.18142039), SIMDE_FLOAT32_C(-0.2788341) } },
+    { { -INT32_C( 118932832), -INT32_C(1515360463) },
+      { SIMDE_FLOAT32_C(-59466416.0), SIMDE_FLOAT32_C(-7.5768026e+08) },
+      { SIMDE_FLOAT32_C(-116145.34), SIMDE_FLOAT32_C(-1479844.2) },
+      { SIMDE_FLOAT32_C(-56.711594), SIMDE_FLOAT32_C(-722.5802) },
+      { SIMDE_FLOAT32_C(-0.027691208), SIMDE_FLOAT32_C(-0.35282236) } },
+    { {  INT32_C( 870121660), -INT32_C(1477780397) },
+      { SIMDE_FLOAT32_C(4.3506083e+08), SIMDE_FLOAT32_C(-7.388902e+08) },
+      { SIMDE_FLOAT32_C(849728.2), SIMDE_FLOAT32_C(-1443144.9) },
+      { SIMDE_FLOAT32_C(414.90634), SIMDE_FLOAT32_C(-704.6606) },
+      { SIMDE_FLOAT32_C(0.20259099), SIMDE_FLOAT32_C(-0.34407255) } },
+    { { -INT32_C( 448797581), -INT32_C(1992672690) },
+      { SIMDE_FLOAT32_C(-2.2439878e+08), SIMDE_FLOAT32_C(-9.963363e+08) },
+      { SIMDE_FLOAT32_C(-438278.88), SIMDE_FLOAT32_C(-1945969.4) },
+      { SIMDE_FLOAT32_C(-214.00336), SIMDE_FLOAT32_C(-950.18036) },
+      { SIMDE_FLOAT32_C(-0.10449383), SIMDE_FLOAT32_C(-0.46395525) } },
+    { {  INT32_C( 543451755),  INT32_C( 729565698) },
+      { SIMDE_FLOAT32_C(2.717259e+08), SIMDE_FLOAT32_C(3.6478285e+08) },
+      { SIMDE_FLOAT32_C(530714.6), SIMDE_FLOAT32_C(712466.5) },
+      { SIMDE_FLOAT32_C(259.138), SIMDE_FLOAT32_C(347.88403) },
+      { SIMDE_FLOAT32_C(0.12653223), SIMDE_FLOAT32_C(0.16986525) } },
+    { { -INT32_C(1248427105),  INT32_C( 201238372) },
+      { SIMDE_FLOAT32_C(-6.2421357e+08), SIMDE_FLOAT32_C(1.0061918e+08) },
+      { SIMDE_FLOAT32_C(-1219167.1), SIMDE_FLOAT32_C(196521.84) },
+      { SIMDE_FLOAT32_C(-595.29645), SIMDE_FLOAT32_C(95.95793) },
+      { SIMDE_FLOAT32_C(-0.2906721), SIMDE_FLOAT32_C(0.04685446) } },
+    { {  INT32_C( 851331947), -INT32_C( 800945102) },
+      { SIMDE_FLOAT32_C(4.25666e+08), SIMDE_FLOAT32_C(-4.0047254e+08) },
+      { SIMDE_FLOAT32_C(831378.9), SIMDE_FLOAT32_C(-782172.94) },
+      { SIMDE_FLOAT32_C(405.94672), SIMDE_FLOAT32_C(-381.92038) },
+      { SIMDE_FLOAT32_C(0.19821617), SIMDE_FLOAT32_C(-0.18648456) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+
+    simde_float32x2_t r1 = simde_vcvt_n_f32_s32(a, 1);
+    simde_float32x2_t r10 = simde_vcvt_n_f32_s32(a, 10);
+    simde_float32x2_t r21 = simde_vcvt_n_f32_s32(a, 21);
+    simde_float32x2_t r32 = simde_vcvt_n_f32_s32(a, 32);
+
+    simde_test_arm_neon_assert_equal_f32x2(r1, simde_vld1_f32(test_vec[i].r1), 6);
+    simde_test_arm_neon_assert_equal_f32x2(r10, simde_vld1_f32(test_vec[i].r10), 6);
+    simde_test_arm_neon_assert_equal_f32x2(r21, simde_vld1_f32(test_vec[i].r21), 6);
+    simde_test_arm_neon_assert_equal_f32x2(r32, simde_vld1_f32(test_vec[i].r32), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvt_n_f32_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    simde_float32 r1[2];
+    simde_float32 r10[2];
+    simde_float32 r21[2];
+    simde_float32 r32[2];
+  } test_vec[] = {
+    { { UINT32_C(2689324524), UINT32_C(3595698540) },
+      { SIMDE_FLOAT32_C(1.3446623e+09), SIMDE_FLOAT32_C(1.7978492e+09) },
+      { SIMDE_FLOAT32_C(2626293.5), SIMDE_FLOAT32_C(3511424.2) },
+      { SIMDE_FLOAT32_C(1282.3699), SIMDE_FLOAT32_C(1714.5626) },
+      { SIMDE_FLOAT32_C(0.62615716), SIMDE_FLOAT32_C(0.8371888) } },
+    { { UINT32_C( 704288295), UINT32_C(3512753669) },
+      { SIMDE_FLOAT32_C(3.5214416e+08), SIMDE_FLOAT32_C(1.7563768e+09) },
+      { SIMDE_FLOAT32_C(687781.56), SIMDE_FLOAT32_C(3430423.5) },
+      { SIMDE_FLOAT32_C(335.83084), SIMDE_FLOAT32_C(1675.0115) },
+      { SIMDE_FLOAT32_C(0.1639799), SIMDE_FLOAT32_C(0.8178767) } },
+    { { UINT32_C(1120610517), UINT32_C(1174231360) },
+      { SIMDE_FLOAT32_C(5.603053e+08), SIMDE_FLOAT32_C(5.8711565e+08) },
+      { SIMDE_FLOAT32_C(1094346.2), SIMDE_FLOAT32_C(1146710.2) },
+      { SIMDE_FLOAT32_C(534.34875), SIMDE_FLOAT32_C(559.9171) },
+      { SIMDE_FLOAT32_C(0.26091248), SIMDE_FLOAT32_C(0.27339703) } },
+    { { UINT32_C( 857470493), UINT32_C( 762505129) },
+      { SIMDE_FLOAT32_C(4.2873523e+08), SIMDE_FLOAT32_C(3.8125258e+08) },
+      { SIMDE_FLOAT32_C(837373.5), SIMDE_FLOAT32_C(744633.94) },
+      { SIMDE_FLOAT32_C(408.87378), SIMDE_FLOAT32_C(363.5908) },
+      { SIMDE_FLOAT32_C(0.1996454), SIMDE_FLOAT32_C(0.17753457) } },
+    { { UINT32_C(1192078808), UINT32_C(2755103314) },
+      { SIMDE_FLOAT32_C(5.960394e+08), SIMDE_FLOAT32_C(1.3775516e+09) },
+      { SIMDE_FLOAT32_C(1164139.5), SIMDE_FLOAT32_C(2690530.5) },
+      { SIMDE_FLOAT32_C(568.4275), SIMDE_FLOAT32_C(1313.7356) },
+      { SIMDE_FLOAT32_C(0.2775525), SIMDE_FLOAT32_C(0.64147246) } },
+    { { UINT32_C(1086565097), UINT32_C(3413006182) },
+      { SIMDE_FLOAT32_C(5.4328256e+08), SIMDE_FLOAT32_C(1.706503e+09) },
+      { SIMDE_FLOAT32_C(1061098.8), SIMDE_FLOAT32_C(3333013.8) },
+      { SIMDE_FLOAT32_C(518.1146), SIMDE_FLOAT32_C(1627.4481) },
+      { SIMDE_FLOAT32_C(0.25298566), SIMDE_FLOAT32_C(0.7946524) } },
+    { { UINT32_C(3094611194), UINT32_C( 411949591) },
+      { SIMDE_FLOAT32_C(1.5473056e+09), SIMDE_FLOAT32_C(2.059748e+08) },
+      { SIMDE_FLOAT32_C(3022081.2), SIMDE_FLOAT32_C(402294.53) },
+      { SIMDE_FLOAT32_C(1475.6256), SIMDE_FLOAT32_C(196.43288) },
+      { SIMDE_FLOAT32_C(0.7205203), SIMDE_FLOAT32_C(0.09591449) } },
+    { { UINT32_C(1668803527), UINT32_C( 144276454) },
+      { SIMDE_FLOAT32_C(8.344018e+08), SIMDE_FLOAT32_C(7.213822e+07) },
+      { SIMDE_FLOAT32_C(1629691.0), SIMDE_FLOAT32_C(140894.97) },
+      { SIMDE_FLOAT32_C(795.74756), SIMDE_FLOAT32_C(68.79637) },
+      { SIMDE_FLOAT32_C(0.3885486), SIMDE_FLOAT32_C(0.03359198) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+
+    simde_float32x2_t r1 = simde_vcvt_n_f32_u32(a, 1);
+    simde_float32x2_t r10 = simde_vcvt_n_f32_u32(a, 10);
+    simde_float32x2_t r21 = simde_vcvt_n_f32_u32(a, 21);
+    simde_float32x2_t r32 = simde_vcvt_n_f32_u32(a, 32);
+
+    simde_test_arm_neon_assert_equal_f32x2(r1, simde_vld1_f32(test_vec[i].r1), 6);
+    simde_test_arm_neon_assert_equal_f32x2(r10, simde_vld1_f32(test_vec[i].r10), 6);
+    simde_test_arm_neon_assert_equal_f32x2(r21, simde_vld1_f32(test_vec[i].r21), 6);
+    simde_test_arm_neon_assert_equal_f32x2(r32, simde_vld1_f32(test_vec[i].r32), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    int32_t r1[4];
+    int32_t r10[4];
+    int32_t r21[4];
+    int32_t r32[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { { SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(0.75), SIMDE_FLOAT32_C(1.0), SIMDE_FLOAT32_C(2147483648.0) },
+        {  INT32_C(         1),  INT32_C(         1),  INT32_C(         2),    INT32_MAX },
+        {  INT32_C(       512),  INT32_C(       768),  INT32_C(      1024),    INT32_MAX },
+        {  INT32_C(   1048576),  INT32_C(   1572864),  INT32_C(   2097152),    INT32_MAX },
+        {    INT32_MAX,    INT32_MAX,    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(1500000000.0), SIMDE_FLOAT32_C(-0.5), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(0.9999999403953552) },
+        {    INT32_MAX, -INT32_C(         1),  INT32_C(         0),  INT32_C(         1) },
+        {    INT32_MAX, -INT32_C(       512),  INT32_C(         0),  INT32_C(      1023) },
+        {    INT32_MAX, -INT32_C(   1048576),  INT32_C(         0),  INT32_C(   2097151) },
+        {    INT32_MAX,    INT32_MIN,  INT32_C(         0),    INT32_MAX } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -170.57), SIMDE_FLOAT32_C(   212.54), SIMDE_FLOAT32_C(  -183.46), SIMDE_FLOAT32_C(   199.21) },
+      { -INT32_C(       341),  INT32_C(       425), -INT32_C(       366),  INT32_C(       398) },
+      { -INT32_C(    174663),  INT32_C(    217640), -INT32_C(    187863),  INT32_C(    203991) },
+      { -INT32_C( 357711232),  INT32_C( 445728672), -INT32_C( 384743520),  INT32_C( 417773664) },
+      {    INT32_MIN,    INT32_MAX,    INT32_MIN,    INT32_MAX } },
+    { { SIMDE_FLOAT32_C(  -489.87), SIMDE_FLOAT32_C(  -831.19), SIMDE_FLOAT32_C(  -939.88), SIMDE_FLOAT32_C(    94.95) },
+      { -INT32_C(       979), -INT32_C(      1662), -INT32_C(      1879),  INT32_C(       189) },
+      { -INT32_C(    501626), -INT32_C(    851138), -INT32_C(    962437),  INT32_C(     97228) },
+      { -INT32_C(1027331840), -INT32_C(1743131776), -INT32_C(1971071232),  INT32_C( 199124576) },
+      {    INT32_MIN,    INT32_MIN,    INT32_MIN,    INT32_MAX } },
+    { { SIMDE_FLOAT32_C(  -950.32), SIMDE_FLOAT32_C(  -790.65), SIMDE_FLOAT32_C(   642.87), SIMDE_FLOAT32_C(  -910.76) },
+      { -INT32_C(      1900), -INT32_C(      1581),  INT32_C(      1285), -INT32_C(      1821) },
+      { -INT32_C(    973127), -INT32_C(    809625),  INT32_C(    658298), -INT32_C(    932618) },
+      { -INT32_C(1992965504), -INT32_C(1658113280),  INT32_C(1348196096), -INT32_C(1910002176) },
+      {    INT32_MIN,    INT32_MIN,    INT32_MAX,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(   139.73), SIMDE_FLOAT32_C(  -566.94), SIMDE_FLOAT32_C(   166.79), SIMDE_FLOAT32_C(  -593.46) },
+      {  INT32_C(       279), -INT32_C(      1133),  INT32_C(       333), -INT32_C(      1186) },
+      {  INT32_C(    143083), -INT32_C(    580546),  INT32_C(    170792), -INT32_C(    607703) },
+      {  INT32_C( 293035040), -INT32_C(1188959360),  INT32_C( 349783968), -INT32_C(1244575872) },
+      {    INT32_MAX,    INT32_MIN,    INT32_MAX,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(  -782.13), SIMDE_FLOAT32_C(   488.96), SIMDE_FLOAT32_C(  -343.48), SIMDE_FLOAT32_C(  -173.32) },
+      { -INT32_C(      1564),  INT32_C(       977), -INT32_C(       686), -INT32_C(       346) },
+      { -INT32_C(    800901),  INT32_C(    500695), -INT32_C(    351723), -INT32_C(    177479) },
+      { -INT32_C(1640245504),  INT32_C(1025423424), -INT32_C( 720329792), -INT32_C( 363478400) },
+      {    INT32_MIN,    INT32_MAX,    INT32_MIN,    INT32_MIN } },
+    { { SIMDE_FLOAT32_C(  -300.32), SIMDE_FLOAT32_C(   263.32), SIMDE_FLOAT32_C(  -371.46), SIMDE_FLOAT32_C(   600.75) },
+      { -INT32_C(       600),  INT32_C(       526), -INT32_C(       742),  INT32_C(      1201) },
+      { -INT32_C(    307527),  INT32_C(    269639), -INT32_C(    380375),  INT32_C(    615168) },
+      { -INT32_C( 629816704),  INT32_C( 552222080), -INT32_C( 779008064),  INT32_C(1259864064) },
+      {    INT32_MIN,    INT32_MAX,    INT32_MIN,    INT32_MAX } },
+    { { SIMDE_FLOAT32_C(   559.08), SIMDE_FLOAT32_C(  -184.86), SIMDE_FLOAT32_C(  -382.64), SIMDE_FLOAT32_C(   957.36) },
+      {  INT32_C(      1118), -INT32_C(       369), -INT32_C(       765),  INT32_C(      1914) },
+      {  INT32_C(    572497), -INT32_C(    189296), -INT32_C(    391823),  INT32_C(    980336) },
+      {  INT32_C(1172475776), -INT32_C( 387679520), -INT32_C( 802454272),  INT32_C(2007729408) },
+      {    INT32_MAX,    INT32_MIN,    INT32_MIN,    INT32_MAX } },
+    { { SIMDE_FLOAT32_C(  -297.65), SIMDE_FLOAT32_C(  -611.76), SIMDE_FLOAT32_C(    75.46), SIMDE_FLOAT32_C(  -430.00) },
+      { -INT32_C(       595), -INT32_C(      1223),  INT32_C(       150), -INT32_C(       860) },
+      { -INT32_C(    304793), -INT32_C(    626442),  INT32_C(     77271), -INT32_C(    440320) },
+      { -INT32_C( 624217280), -INT32_C(1282953728),  INT32_C( 158251088), -INT32_C( 901775360) },
+      {    INT32_MIN,    INT32_MIN,    INT32_MAX,    INT32_MIN } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+
+    simde_int32x4_t r1 = simde_vcvtq_n_s32_f32(a, 1);
+    simde_int32x4_t r10 = simde_vcvtq_n_s32_f32(a, 10);
+    simde_int32x4_t r21 = simde_vcvtq_n_s32_f32(a, 21);
+
+    simde_test_arm_neon_assert_equal_i32x4(r1, simde_vld1q_s32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i32x4(r10, simde_vld1q_s32(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i32x4(r21, simde_vld1q_s32(test_vec[i].r21));
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      simde_int32x4_t r32 = simde_vcvtq_n_s32_f32(a, 32);
+      simde_test_arm_neon_assert_equal_i32x4(r32, simde_vld1q_s32(test_vec[i].r32));
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r1[4];
+    uint32_t r10[4];
+    uint32_t r21[4];
+    uint32_t r32[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { { SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(0.75), SIMDE_FLOAT32_C(1.0), SIMDE_FLOAT32_C(2147483648.0) },
+        { UINT32_C(         1), UINT32_C(         1), UINT32_C(         2),           UINT32_MAX },
+        { UINT32_C(       512), UINT32_C(       768), UINT32_C(      1024),           UINT32_MAX },
+        { UINT32_C(   1048576), UINT32_C(   1572864), UINT32_C(   2097152),           UINT32_MAX },
+        { UINT32_C(2147483648), UINT32_C(3221225472),           UINT32_MAX,           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(1500000000.0), SIMDE_FLOAT32_C(-0.5), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(0.9999999403953552) },
+        { UINT32_C(3000000000), UINT32_C(         0), UINT32_C(         0), UINT32_C(         1) },
+        {           UINT32_MAX, UINT32_C(         0), UINT32_C(         0), UINT32_C(      1023) },
+        {           UINT32_MAX, UINT32_C(         0), UINT32_C(         0), UINT32_C(   2097151) },
+        {           UINT32_MAX, UINT32_C(         0), UINT32_C(         0), UINT32_C(4294967040) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   622.00), SIMDE_FLOAT32_C(   731.51), SIMDE_FLOAT32_C(   106.71), SIMDE_FLOAT32_C(   273.66) },
+      { UINT32_C(      1244), UINT32_C(      1463), UINT32_C(       213), UINT32_C(       547) },
+      { UINT32_C(    636928), UINT32_C(    749066), UINT32_C(    109271), UINT32_C(    280227) },
+      { UINT32_C(1304428544), UINT32_C(1534087680), UINT32_C( 223787088), UINT32_C( 573906624) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   628.95), SIMDE_FLOAT32_C(   467.20), SIMDE_FLOAT32_C(   877.18), SIMDE_FLOAT32_C(    81.08) },
+      { UINT32_C(      1257), UINT32_C(       934), UINT32_C(      1754), UINT32_C(       162) },
+      { UINT32_C(    644044), UINT32_C(    478412), UINT32_C(    898232), UINT32_C(     83025) },
+      { UINT32_C(1319003776), UINT32_C( 979789440), UINT32_C(1839579776), UINT32_C( 170037088) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   765.03), SIMDE_FLOAT32_C(   513.94), SIMDE_FLOAT32_C(     3.64), SIMDE_FLOAT32_C(   491.64) },
+      { UINT32_C(      1530), UINT32_C(      1027), UINT32_C(         7), UINT32_C(       983) },
+      { UINT32_C(    783390), UINT32_C(    526274), UINT32_C(      3727), UINT32_C(    503439) },
+      { UINT32_C(1604384256), UINT32_C(1077810304), UINT32_C(   7633633), UINT32_C(1031043840) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   666.67), SIMDE_FLOAT32_C(   226.67), SIMDE_FLOAT32_C(   496.91), SIMDE_FLOAT32_C(   257.92) },
+      { UINT32_C(      1333), UINT32_C(       453), UINT32_C(       993), UINT32_C(       515) },
+      { UINT32_C(    682670), UINT32_C(    232110), UINT32_C(    508835), UINT32_C(    264110) },
+      { UINT32_C(1398108288), UINT32_C( 475361440), UINT32_C(1042095808), UINT32_C( 540897472) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   659.06), SIMDE_FLOAT32_C(   521.58), SIMDE_FLOAT32_C(   203.40), SIMDE_FLOAT32_C(   191.60) },
+      { UINT32_C(      1318), UINT32_C(      1043), UINT32_C(       406), UINT32_C(       383) },
+      { UINT32_C(    674877), UINT32_C(    534097), UINT32_C(    208281), UINT32_C(    196198) },
+      { UINT32_C(1382148992), UINT32_C(1093832576), UINT32_C( 426560704), UINT32_C( 401814336) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   652.47), SIMDE_FLOAT32_C(   493.43), SIMDE_FLOAT32_C(   245.20), SIMDE_FLOAT32_C(   122.67) },
+      { UINT32_C(      1304), UINT32_C(       986), UINT32_C(       490), UINT32_C(       245) },
+      { UINT32_C(    668129), UINT32_C(    505272), UINT32_C(    251084), UINT32_C(    125614) },
+      { UINT32_C(1368328704), UINT32_C(1034797696), UINT32_C( 514221664), UINT32_C( 257257632) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   911.76), SIMDE_FLOAT32_C(   680.95), SIMDE_FLOAT32_C(   692.21), SIMDE_FLOAT32_C(   399.34) },
+      { UINT32_C(      1823), UINT32_C(      1361), UINT32_C(      1384), UINT32_C(       798) },
+      { UINT32_C(    933642), UINT32_C(    697292), UINT32_C(    708823), UINT32_C(    408924) },
+      { UINT32_C(1912099328), UINT32_C(1428055680), UINT32_C(1451669632), UINT32_C( 837476672) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } },
+    { { SIMDE_FLOAT32_C(   554.45), SIMDE_FLOAT32_C(   198.82), SIMDE_FLOAT32_C(   747.01), SIMDE_FLOAT32_C(   688.62) },
+      { UINT32_C(      1108), UINT32_C(       397), UINT32_C(      1494), UINT32_C(      1377) },
+      { UINT32_C(    567756), UINT32_C(    203591), UINT32_C(    764938), UINT32_C(    705146) },
+      { UINT32_C(1162765952), UINT32_C( 416955776), UINT32_C(1566593536), UINT32_C(1444140800) },
+      {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+
+    simde_uint32x4_t r1 = simde_vcvtq_n_u32_f32(a, 1);
+    simde_uint32x4_t r10 = simde_vcvtq_n_u32_f32(a, 10);
+    simde_uint32x4_t r21 = simde_vcvtq_n_u32_f32(a, 21);
+
+    simde_test_arm_neon_assert_equal_u32x4(r1, simde_vld1q_u32(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u32x4(r10, simde_vld1q_u32(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u32x4(r21, simde_vld1q_u32(test_vec[i].r21));
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      simde_uint32x4_t r32 = simde_vcvtq_n_u32_f32(a, 32);
+      simde_test_arm_neon_assert_equal_u32x4(r32, simde_vld1q_u32(test_vec[i].r32));
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_f32_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    simde_float32 r1[4];
+    simde_float32 r10[4];
+    simde_float32 r21[4];
+    simde_float32 r32[4];
+  } test_vec[] = {
+    { { -INT32_C( 995152956),  INT32_C( 890933478),
+        -INT32_C( 969446694), -INT32_C(1024348898) },
+      { SIMDE_FLOAT32_C(-4.9757648e+08), SIMDE_FLOAT32_C(4.4546675e+08),
+        SIMDE_FLOAT32_C(-4.8472336e+08), SIMDE_FLOAT32_C(-5.1217446e+08) },
+      { SIMDE_FLOAT32_C(-971829.06), SIMDE_FLOAT32_C(870052.25),
+        SIMDE_FLOAT32_C(-946725.3), SIMDE_FLOAT32_C(-1000340.75) },
+      { SIMDE_FLOAT32_C(-474.5259), SIMDE_FLOAT32_C(424.8302),
+        SIMDE_FLOAT32_C(-462.26822), SIMDE_FLOAT32_C(-488.44763) },
+      { SIMDE_FLOAT32_C(-0.2317021), SIMDE_FLOAT32_C(0.20743662),
+        SIMDE_FLOAT32_C(-0.2257169), SIMDE_FLOAT32_C(-0.23849982) } },
+    { {  INT32_C( 592377878), -INT32_C(1759063777),
+        -INT32_C(1199893424),  INT32_C(1363163340) },
+      { SIMDE_FLOAT32_C(2.9618893e+08), SIMDE_FLOAT32_C(-8.795319e+08),
+        SIMDE_FLOAT32_C(-5.999467e+08), SIMDE_FLOAT32_C(6.815817e+08) },
+      { SIMDE_FLOAT32_C(578494.0), SIMDE_FLOAT32_C(-1717835.8),
+        SIMDE_FLOAT32_C(-1171770.9), SIMDE_FLOAT32_C(1331214.2) },
+      { SIMDE_FLOAT32_C(282.46777), SIMDE_FLOAT32_C(-838.787),
+        SIMDE_FLOAT32_C(-572.15375), SIMDE_FLOAT32_C(650.00696) },
+      { SIMDE_FLOAT32_C(0.13792372), SIMDE_FLOAT32_C(-0.40956396),
+        SIMDE_FLOAT32_C(-0.27937195), SIMDE_FLOAT32_C(0.3173862) } },
+    { { -INT32_C( 922855768),  INT32_C(1334586835),
+         INT32_C( 598404829), -INT32_C( 543564638) },
+      { SIMDE_FLOAT32_C(-4.6142787e+08), SIMDE_FLOAT32_C(6.6729344e+08),
+        SIMDE_FLOAT32_C(2.992024e+08), SIMDE_FLOAT32_C(-2.717823e+08) },
+      { SIMDE_FLOAT32_C(-901226.3), SIMDE_FLOAT32_C(1303307.5),
+        SIMDE_FLOAT32_C(584379.7), SIMDE_FLOAT32_C(-530824.8) },
+      { SIMDE_FLOAT32_C(-440.0519), SIMDE_FLOAT32_C(636.3806),
+        SIMDE_FLOAT32_C(285.34164), SIMDE_FLOAT32_C(-259.1918) },
+      { SIMDE_FLOAT32_C(-0.2148691), SIMDE_FLOAT32_C(0.31073272),
+        SIMDE_FLOAT32_C(0.13932697), SIMDE_FLOAT32_C(-0.1265585) } },
+    { {  INT32_C(1718453345),  INT32_C(1761654664),
+         INT32_C(1877046287), -INT32_C(1090672830) },
+      { SIMDE_FLOAT32_C(8.592267e+08), SIMDE_FLOAT32_C(8.808273e+08),
+        SIMDE_FLOAT32_C(9.3852314e+08), SIMDE_FLOAT32_C(-5.453364e+08) },
+      { SIMDE_FLOAT32_C(1678177.1), SIMDE_FLOAT32_C(1720365.9),
+        SIMDE_FLOAT32_C(1833053.0), SIMDE_FLOAT32_C(-1065110.1) },
+      { SIMDE_FLOAT32_C(819.4224), SIMDE_FLOAT32_C(840.0224),
+        SIMDE_FLOAT32_C(895.0454), SIMDE_FLOAT32_C(-520.0733) },
+      { SIMDE_FLOAT32_C(0.4001086), SIMDE_FLOAT32_C(0.4101672),
+        SIMDE_FLOAT32_C(0.4370339), SIMDE_FLOAT32_C(-0.25394204) } },
+    { { -INT32_C( 950629079),  INT32_C( 519367783),
+         INT32_C(1317932533), -INT32_C(2032849560) },
+      { SIMDE_FLOAT32_C(-4.7531453e+08), SIMDE_FLOAT32_C(2.5968389e+08),
+        SIMDE_FLOAT32_C(6.589663e+08), SIMDE_FLOAT32_C(-1.01642477e+09) },
+      { SIMDE_FLOAT32_C(-928348.7), SIMDE_FLOAT32_C(507195.1),
+        SIMDE_FLOAT32_C(1287043.5), SIMDE_FLOAT32_C(-1985204.6) },
+      { SIMDE_FLOAT32_C(-453.29526), SIMDE_FLOAT32_C(247.65385),
+        SIMDE_FLOAT32_C(628.4392), SIMDE_FLOAT32_C(-969.3382) },
+      { SIMDE_FLOAT32_C(-0.22133557), SIMDE_FLOAT32_C(0.12092473),
+        SIMDE_FLOAT32_C(0.30685508), SIMDE_FLOAT32_C(-0.47330967) } },
+    { { -INT32_C( 341928117), -INT32_C(1060992244),
+         INT32_C(1354596965), -INT32_C( 891097806) },
+      { SIMDE_FLOAT32_C(-1.7096406e+08), SIMDE_FLOAT32_C(-5.3049613e+08),
+        SIMDE_FLOAT32_C(6.772985e+08), SIMDE_FLOAT32_C(-4.455489e+08) },
+      { SIMDE_FLOAT32_C(-333914.2), SIMDE_FLOAT32_C(-1036125.25),
+        SIMDE_FLOAT32_C(1322848.6), SIMDE_FLOAT32_C(-870212.7) },
+      { SIMDE_FLOAT32_C(-163.04404), SIMDE_FLOAT32_C(-505.92053),
+        SIMDE_FLOAT32_C(645.9222), SIMDE_FLOAT32_C(-424.90854) },
+      { SIMDE_FLOAT32_C(-0.079611346), SIMDE_FLOAT32_C(-0.24703151),
+        SIMDE_FLOAT32_C(0.3153917), SIMDE_FLOAT32_C(-0.20747487) } },
+    { { -INT32_C(   6641384), -INT32_C(1169281705),
+        -INT32_C(1263595369), -INT32_C( 470830048) },
+      { SIMDE_FLOAT32_C(-3320692.0), SIMDE_FLOAT32_C(-5.8464083e+08),
+        SIMDE_FLOAT32_C(-6.317977e+08), SIMDE_FLOAT32_C(-2.3541502e+08) },
+      { SIMDE_FLOAT32_C(-6485.7266), SIMDE_FLOAT32_C(-1141876.6),
+        SIMDE_FLOAT32_C(-1233979.9), SIMDE_FLOAT32_C(-459794.97) },
+      { SIMDE_FLOAT32_C(-3.1668587), SIMDE_FLOAT32_C(-557.55695),
+        SIMDE_FLOAT32_C(-602.52924), SIMDE_FLOAT32_C(-224.50926) },
+      { SIMDE_FLOAT32_C(-0.0015463177), SIMDE_FLOAT32_C(-0.2722446),
+        SIMDE_FLOAT32_C(-0.29420373), SIMDE_FLOAT32_C(-0.10962366) } },
+    { { -INT32_C(  34165634), -INT32_C(1209520458),
+         INT32_C( 888954357),  INT32_C( 916295616) },
+      { SIMDE_FLOAT32_C(-17082816.0), SIMDE_FLOAT32_C(-6.0476026e+08),
+        SIMDE_FLOAT32_C(4.444772e+08), SIMDE_FLOAT32_C(4.581478e+08) },
+      { SIMDE_FLOAT32_C(-33364.875), SIMDE_FLOAT32_C(-1181172.4),
+        SIMDE_FLOAT32_C(868119.5), SIMDE_FLOAT32_C(894819.94) },
+      { SIMDE_FLOAT32_C(-16.291443), SIMDE_FLOAT32_C(-576.7443),
+        SIMDE_FLOAT32_C(423.88647), SIMDE_FLOAT32_C(436.9238) },
+      { SIMDE_FLOAT32_C(-0.007954806), SIMDE_FLOAT32_C(-0.28161344),
+        SIMDE_FLOAT32_C(0.20697582), SIMDE_FLOAT32_C(0.2133417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+
+    simde_float32x4_t r1 = simde_vcvtq_n_f32_s32(a, 1);
+    simde_float32x4_t r10 = simde_vcvtq_n_f32_s32(a, 10);
+    simde_float32x4_t r21 = simde_vcvtq_n_f32_s32(a, 21);
+    simde_float32x4_t r32 = simde_vcvtq_n_f32_s32(a, 32);
+
+    simde_test_arm_neon_assert_equal_f32x4(r1, simde_vld1q_f32(test_vec[i].r1), 6);
+    simde_test_arm_neon_assert_equal_f32x4(r10, simde_vld1q_f32(test_vec[i].r10), 6);
+    simde_test_arm_neon_assert_equal_f32x4(r21, simde_vld1q_f32(test_vec[i].r21), 6);
+    simde_test_arm_neon_assert_equal_f32x4(r32, simde_vld1q_f32(test_vec[i].r32), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_f32_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    simde_float32 r1[4];
+    simde_float32 r10[4];
+    simde_float32 r21[4];
+    simde_float32 r32[4];
+  } test_vec[] = {
+    { { UINT32_C(1577846933), UINT32_C(3183884321),
+        UINT32_C(2764596462), UINT32_C(4253122219) },
+      { SIMDE_FLOAT32_C(7.8892346e+08), SIMDE_FLOAT32_C(1.5919421e+09),
+        SIMDE_FLOAT32_C(1.3822982e+09), SIMDE_FLOAT32_C(2.1265612e+09) },
+      { SIMDE_FLOAT32_C(1540866.1), SIMDE_FLOAT32_C(3109262.0),
+        SIMDE_FLOAT32_C(2699801.2), SIMDE_FLOAT32_C(4153439.8) },
+      { SIMDE_FLOAT32_C(752.37604), SIMDE_FLOAT32_C(1518.1943),
+        SIMDE_FLOAT32_C(1318.2623), SIMDE_FLOAT32_C(2028.0468) },
+      { SIMDE_FLOAT32_C(0.3673711), SIMDE_FLOAT32_C(0.7413058),
+        SIMDE_FLOAT32_C(0.6436828), SIMDE_FLOAT32_C(0.9902572) } },
+    { { UINT32_C( 384084313), UINT32_C(3017969396),
+        UINT32_C(1839235685), UINT32_C(1845920685) },
+      { SIMDE_FLOAT32_C(1.9204216e+08), SIMDE_FLOAT32_C(1.5089847e+09),
+        SIMDE_FLOAT32_C(9.1961786e+08), SIMDE_FLOAT32_C(9.229603e+08) },
+      { SIMDE_FLOAT32_C(375082.34), SIMDE_FLOAT32_C(2947235.8),
+        SIMDE_FLOAT32_C(1796128.6), SIMDE_FLOAT32_C(1802656.9) },
+      { SIMDE_FLOAT32_C(183.14568), SIMDE_FLOAT32_C(1439.08),
+        SIMDE_FLOAT32_C(877.0159), SIMDE_FLOAT32_C(880.20355) },
+      { SIMDE_FLOAT32_C(0.0894266), SIMDE_FLOAT32_C(0.70267576),
+        SIMDE_FLOAT32_C(0.42823043), SIMDE_FLOAT32_C(0.4297869) } },
+    { { UINT32_C(4237020667), UINT32_C(2531648774),
+        UINT32_C(3529930688), UINT32_C( 475991469) },
+      { SIMDE_FLOAT32_C(2.1185103e+09), SIMDE_FLOAT32_C(1.2658244e+09),
+        SIMDE_FLOAT32_C(1.7649654e+09), SIMDE_FLOAT32_C(2.3799573e+08) },
+      { SIMDE_FLOAT32_C(4137715.5), SIMDE_FLOAT32_C(2472313.2),
+        SIMDE_FLOAT32_C(3447198.0), SIMDE_FLOAT32_C(464835.4) },
+      { SIMDE_FLOAT32_C(2020.3689), SIMDE_FLOAT32_C(1207.1842),
+        SIMDE_FLOAT32_C(1683.2021), SIMDE_FLOAT32_C(226.97041) },
+      { SIMDE_FLOAT32_C(0.98650825), SIMDE_FLOAT32_C(0.5894454),
+        SIMDE_FLOAT32_C(0.82187605), SIMDE_FLOAT32_C(0.1108254) } },
+    { { UINT32_C(4191462020), UINT32_C(3416827059),
+        UINT32_C( 447679169), UINT32_C( 511067954) },
+      { SIMDE_FLOAT32_C(2.0957311e+09), SIMDE_FLOAT32_C(1.7084136e+09),
+        SIMDE_FLOAT32_C(2.2383958e+08), SIMDE_FLOAT32_C(2.5553398e+08) },
+      { SIMDE_FLOAT32_C(4093224.8), SIMDE_FLOAT32_C(3336745.2),
+        SIMDE_FLOAT32_C(437186.7), SIMDE_FLOAT32_C(499089.8) },
+      { SIMDE_FLOAT32_C(1998.6449), SIMDE_FLOAT32_C(1629.2701),
+        SIMDE_FLOAT32_C(213.47006), SIMDE_FLOAT32_C(243.6962) },
+      { SIMDE_FLOAT32_C(0.9759008), SIMDE_FLOAT32_C(0.79554206),
+        SIMDE_FLOAT32_C(0.10423343), SIMDE_FLOAT32_C(0.118992284) } },
+    { { UINT32_C(2876187500), UINT32_C(1019251564),
+        UINT32_C( 794921185), UINT32_C(2529199427) },
+      { SIMDE_FLOAT32_C(1.4380937e+09), SIMDE_FLOAT32_C(5.096258e+08),
+        SIMDE_FLOAT32_C(3.974606e+08), SIMDE_FLOAT32_C(1.2645997e+09) },
+      { SIMDE_FLOAT32_C(2808776.8), SIMDE_FLOAT32_C(995362.9),
+        SIMDE_FLOAT32_C(776290.25), SIMDE_FLOAT32_C(2469921.2) },
+      { SIMDE_FLOAT32_C(1371.473), SIMDE_FLOAT32_C(486.01703),
+        SIMDE_FLOAT32_C(379.04797), SIMDE_FLOAT32_C(1206.0162) },
+      { SIMDE_FLOAT32_C(0.66966456), SIMDE_FLOAT32_C(0.237313),
+        SIMDE_FLOAT32_C(0.18508202), SIMDE_FLOAT32_C(0.5888751) } },
+    { { UINT32_C(1530260469), UINT32_C(2458603499),
+        UINT32_C(3503457078), UINT32_C( 171507695) },
+      { SIMDE_FLOAT32_C(7.6513024e+08), SIMDE_FLOAT32_C(1.2293018e+09),
+        SIMDE_FLOAT32_C(1.7517285e+09), SIMDE_FLOAT32_C(8.575385e+07) },
+      { SIMDE_FLOAT32_C(1494395.0), SIMDE_FLOAT32_C(2.40098e+06),
+        SIMDE_FLOAT32_C(3421344.8), SIMDE_FLOAT32_C(167487.98) },
+      { SIMDE_FLOAT32_C(729.68506), SIMDE_FLOAT32_C(1172.3535),
+        SIMDE_FLOAT32_C(1670.5785), SIMDE_FLOAT32_C(81.78124) },
+      { SIMDE_FLOAT32_C(0.35629153), SIMDE_FLOAT32_C(0.57243824),
+        SIMDE_FLOAT32_C(0.81571215), SIMDE_FLOAT32_C(0.039932247) } },
+    { { UINT32_C(3141311662), UINT32_C(2694831063),
+        UINT32_C( 384880108), UINT32_C( 155876903) },
+      { SIMDE_FLOAT32_C(1.5706559e+09), SIMDE_FLOAT32_C(1.3474156e+09),
+        SIMDE_FLOAT32_C(1.9244005e+08), SIMDE_FLOAT32_C(7.793845e+07) },
+      { SIMDE_FLOAT32_C(3067687.2), SIMDE_FLOAT32_C(2631671.0),
+        SIMDE_FLOAT32_C(375859.47), SIMDE_FLOAT32_C(152223.53) },
+      { SIMDE_FLOAT32_C(1497.8942), SIMDE_FLOAT32_C(1284.9956),
+        SIMDE_FLOAT32_C(183.52513), SIMDE_FLOAT32_C(74.327896) },
+      { SIMDE_FLOAT32_C(0.73139364), SIMDE_FLOAT32_C(0.62743926),
+        SIMDE_FLOAT32_C(0.08961188), SIMDE_FLOAT32_C(0.036292918) } },
+    { { UINT32_C(1890961550), UINT32_C(2268703006),
+        UINT32_C(1800217239), UINT32_C(3158244524) },
+      { SIMDE_FLOAT32_C(9.4548077e+08), SIMDE_FLOAT32_C(1.1343515e+09),
+        SIMDE_FLOAT32_C(9.001086e+08), SIMDE_FLOAT32_C(1.5791223e+09) },
+      { SIMDE_FLOAT32_C(1846642.1), SIMDE_FLOAT32_C(2215530.2),
+        SIMDE_FLOAT32_C(1758024.6), SIMDE_FLOAT32_C(3084223.2) },
+      { SIMDE_FLOAT32_C(901.6807), SIMDE_FLOAT32_C(1081.8019),
+        SIMDE_FLOAT32_C(858.41046), SIMDE_FLOAT32_C(1505.9684) },
+      { SIMDE_FLOAT32_C(0.4402738), SIMDE_FLOAT32_C(0.5282236),
+        SIMDE_FLOAT32_C(0.41914573), SIMDE_FLOAT32_C(0.7353361) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+
+    simde_float32x4_t r1 = simde_vcvtq_n_f32_u32(a, 1);
+    simde_float32x4_t r10 = simde_vcvtq_n_f32_u32(a, 10);
+    simde_float32x4_t r21 = simde_vcvtq_n_f32_u32(a, 21);
+    simde_float32x4_t r32 = simde_vcvtq_n_f32_u32(a, 32);
+
+    simde_test_arm_neon_assert_equal_f32x4(r1, simde_vld1q_f32(test_vec[i].r1), 6);
+    simde_test_arm_neon_assert_equal_f32x4(r10, simde_vld1q_f32(test_vec[i].r10), 6);
+    simde_test_arm_neon_assert_equal_f32x4(r21, simde_vld1q_f32(test_vec[i].r21), 6);
+    simde_test_arm_neon_assert_equal_f32x4(r32, simde_vld1q_f32(test_vec[i].r32), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    int64_t r1[2];
+    int64_t r20[2];
+    int64_t r45[2];
+    int64_t r64[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   225.97), SIMDE_FLOAT64_C(   945.14) },
+      {  INT64_C(                451),  INT64_C(               1890) },
+      {  INT64_C(          236946718),  INT64_C(          991051120) },
+      {  INT64_C(   7950612560913367),  INT64_C(  33254157436038676) },
+      {            INT64_MAX,            INT64_MAX } },
+    { { SIMDE_FLOAT64_C(   176.77), SIMDE_FLOAT64_C(   -62.68) },
+      {  INT64_C(                353), -INT64_C(                125) },
+      {  INT64_C(          185356779), -INT64_C(           65724743) },
+      {  INT64_C(   6219541454142833), -INT64_C(   2205356442527989) },
+      {            INT64_MAX,            INT64_MIN } },
+    { { SIMDE_FLOAT64_C(  -239.87), SIMDE_FLOAT64_C(   458.95) },
+      { -INT64_C(                479),  INT64_C(                917) },
+      { -INT64_C(          251521925),  INT64_C(          481243955) },
+      { -INT64_C(   8439675332948132),  INT64_C(  16147867570169446) },
+      {            INT64_MIN,            INT64_MAX } },
+    { { SIMDE_FLOAT64_C(  -905.43), SIMDE_FLOAT64_C(  -359.03) },
+      { -INT64_C(               1810), -INT64_C(                718) },
+      { -INT64_C(          949412167), -INT64_C(          376470241) },
+      { -INT64_C(  31856986020391156), -INT64_C(  12632245111053352) },
+      {            INT64_MIN,            INT64_MIN } },
+    { { SIMDE_FLOAT64_C(  -557.24), SIMDE_FLOAT64_C(   645.33) },
+      { -INT64_C(               1114),  INT64_C(               1290) },
+      { -INT64_C(          584308490),  INT64_C(          676677550) },
+      { -INT64_C(  19606139502780744),  INT64_C(  22705530840085956) },
+      {            INT64_MIN,            INT64_MAX } },
+    { { SIMDE_FLOAT64_C(  -465.21), SIMDE_FLOAT64_C(   415.46) },
+      { -INT64_C(                930),  INT64_C(                830) },
+      { -INT64_C(          487808040),  INT64_C(          435641384) },
+      { -INT64_C(  16368121739445534),  INT64_C(  14617699228026142) },
+      {            INT64_MIN,            INT64_MAX } },
+    { { SIMDE_FLOAT64_C(  -662.51), SIMDE_FLOAT64_C(  -899.96) },
+      { -INT64_C(               1325), -INT64_C(               1799) },
+      { -INT64_C(          694692085), -INT64_C(          943676456) },
+      { -INT64_C(  23309998352572088), -INT64_C(  31664527505065248) },
+      {            INT64_MIN,            INT64_MIN } },
+    { { SIMDE_FLOAT64_C(   -63.94), SIMDE_FLOAT64_C(  -779.39) },
+      { -INT64_C(                127), -INT64_C(               1558) },
+      { -INT64_C(           67045949), -INT64_C(          817249648) },
+      { -INT64_C(   2249688751359918), -INT64_C(  27422347762314772) },
+      {            INT64_MIN,            INT64_MIN } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+
+    simde_int64x2_t r1 = simde_vcvtq_n_s64_f64(a, 1);
+    simde_int64x2_t r20 = simde_vcvtq_n_s64_f64(a, 20);
+    simde_int64x2_t r45 = simde_vcvtq_n_s64_f64(a, 45);
+
+    simde_test_arm_neon_assert_equal_i64x2(r1, simde_vld1q_s64(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_i64x2(r20, simde_vld1q_s64(test_vec[i].r20));
+    simde_test_arm_neon_assert_equal_i64x2(r45, simde_vld1q_s64(test_vec[i].r45));
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      simde_int64x2_t r64 = simde_vcvtq_n_s64_f64(a, 64);
+      simde_test_arm_neon_assert_equal_i64x2(r64, simde_vld1q_s64(test_vec[i].r64));
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r1[2];
+    uint64_t r20[2];
+    uint64_t r45[2];
+    uint64_t r64[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   328.79), SIMDE_FLOAT64_C(   697.37) },
+      { UINT64_C(                 657), UINT64_C(                1394) },
+      { UINT64_C(           344761303), UINT64_C(           731245445) },
+      { UINT64_C(   11568269699087074), UINT64_C(   24536525563588772) },
+      {                     UINT64_MAX,                     UINT64_MAX } },
+    { { SIMDE_FLOAT64_C(   101.56), SIMDE_FLOAT64_C(    88.83) },
+      { UINT64_C(                 203), UINT64_C(                 177) },
+      { UINT64_C(           106493378), UINT64_C(            93145006) },
+      { UINT64_C(    3573324829341778), UINT64_C(    3125427772650946) },
+      {                     UINT64_MAX,                     UINT64_MAX } },
+    { { SIMDE_FLOAT64_C(   827.40), SIMDE_FLOAT64_C(   492.98) },
+      { UINT64_C(                1654), UINT64_C(                 985) },
+      { UINT64_C(           867591782), UINT64_C(           516926996) },
+      { UINT64_C(   29111549466299596), UINT64_C(   17345191752352400) },
+      {                     UINT64_MAX,                     UINT64_MAX } },
+    { { SIMDE_FLOAT64_C(   213.32), SIMDE_FLOAT64_C(   190.39) },
+      { UINT64_C(                 426), UINT64_C(                 380) },
+      { UINT64_C(           223682232), UINT64_C(           199638384) },
+      { UINT64_C(    7505530253989642), UINT64_C(    6698752601992724) },
+      {                     UINT64_MAX,                     UINT64_MAX } },
+    { { SIMDE_FLOAT64_C(   571.13), SIMDE_FLOAT64_C(   255.33) },
+      { UINT64_C(                1142), UINT64_C(                 510) },
+      { UINT64_C(           598873210), UINT64_C(           267732910) },
+      { UINT64_C(   20094850431094620), UINT64_C(    8983625725441475) },
+      {                     UINT64_MAX,                     UINT64_MAX } },
+    { { SIMDE_FLOAT64_C(   497.53), SIMDE_FLOAT64_C(   378.75) },
+      { UINT64_C(                 995), UINT64_C(                 757) },
+      { UINT64_C(           521698017), UINT64_C(           397148160) },
+      { UINT64_C(   17505280645356584), UINT64_C(   13326080928645120) },
+      {                     UINT64_MAX,                     UINT64_MAX } },
+    { { SIMDE_FLOAT64_C(   832.20), SIMDE_FLOAT64_C(   512.05) },
+      { UINT64_C(                1664), UINT64_C(                1024) },
+      { UINT64_C(           872624947), UINT64_C(           536923340) },
+      { UINT64_C(   29280434452325992), UINT64_C(   18016157728086424) },
+      {                     UINT64_MAX,                     UINT64_MAX } },
+    { { SIMDE_FLOAT64_C(   427.96), SIMDE_FLOAT64_C(   148.26) },
+      { UINT64_C(                 855), UINT64_C(                 296) },
+      { UINT64_C(           448748584), UINT64_C(           155461877) },
+      { UINT64_C(   15057503879136542), UINT64_C(    5216435005890232) },
+      {                     UINT64_MAX,                     UINT64_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+
+    simde_uint64x2_t r1 = simde_vcvtq_n_u64_f64(a, 1);
+    simde_uint64x2_t r20 = simde_vcvtq_n_u64_f64(a, 20);
+    simde_uint64x2_t r45 = simde_vcvtq_n_u64_f64(a, 45);
+
+    simde_test_arm_neon_assert_equal_u64x2(r1, simde_vld1q_u64(test_vec[i].r1));
+    simde_test_arm_neon_assert_equal_u64x2(r20, simde_vld1q_u64(test_vec[i].r20));
+    simde_test_arm_neon_assert_equal_u64x2(r45, simde_vld1q_u64(test_vec[i].r45));
+
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      simde_uint64x2_t r64 = simde_vcvtq_n_u64_f64(a, 64);
+      simde_test_arm_neon_assert_equal_u64x2(r64, simde_vld1q_u64(test_vec[i].r64));
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_f64_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    simde_float64 r1[2];
+    simde_float64 r20[2];
+    simde_float64 r45[2];
+    simde_float64 r64[2];
+  } test_vec[] = {
+    { { -INT64_C(2305523157423989808),  INT64_C(9021639549397754797) },
+      { SIMDE_FLOAT64_C(-1.1527615787119949e+18), SIMDE_FLOAT64_C(4.5108197746988774e+18) },
+      { SIMDE_FLOAT64_C(-2198718221115.1025), SIMDE_FLOAT64_C(8603705930135.493) },
+      { SIMDE_FLOAT64_C(-65526.90926537223), SIMDE_FLOAT64_C(256410.41785882393) },
+      { SIMDE_FLOAT64_C(-0.12498266079973647), SIMDE_FLOAT64_C(0.48906405994190966) } },
+    { {  INT64_C(6065449116039460300), -INT64_C(4527029122116172699) },
+      { SIMDE_FLOAT64_C(3.03272455801973e+18), SIMDE_FLOAT64_C(-2.2635145610580864e+18) },
+      { SIMDE_FLOAT64_C(5784463039435.825), SIMDE_FLOAT64_C(-4317311403385.327) },
+      { SIMDE_FLOAT64_C(172390.43234097437), SIMDE_FLOAT64_C(-128665.9062917628) },
+      { SIMDE_FLOAT64_C(0.32880865543551324), SIMDE_FLOAT64_C(-0.24541074045517502) } },
+    { {  INT64_C(1581346060028820288),  INT64_C(8939603414307159909) },
+      { SIMDE_FLOAT64_C(7.906730300144101e+17), SIMDE_FLOAT64_C(4.46980170715358e+18) },
+      { SIMDE_FLOAT64_C(1508089122799.702), SIMDE_FLOAT64_C(8525470175082.359) },
+      { SIMDE_FLOAT64_C(44944.55822705334), SIMDE_FLOAT64_C(254078.81066448567) },
+      { SIMDE_FLOAT64_C(0.08572494168673199), SIMDE_FLOAT64_C(0.4846168721475328) } },
+    { {  INT64_C(2393091907678861517),  INT64_C(9153589371754827761) },
+      { SIMDE_FLOAT64_C(1.1965459538394307e+18), SIMDE_FLOAT64_C(4.576794685877414e+18) },
+      { SIMDE_FLOAT64_C(2282230289152.967), SIMDE_FLOAT64_C(8729543086771.801) },
+      { SIMDE_FLOAT64_C(68015.76284029981), SIMDE_FLOAT64_C(260160.65736925008) },
+      { SIMDE_FLOAT64_C(0.12972977226314508), SIMDE_FLOAT64_C(0.4962170741448404) } },
+    { {  INT64_C(3554873176899993178), -INT64_C(6274626166497687700) },
+      { SIMDE_FLOAT64_C(1.7774365884499965e+18), SIMDE_FLOAT64_C(-3.137313083248844e+18) },
+      { SIMDE_FLOAT64_C(3390191246891.015), SIMDE_FLOAT64_C(-5983949820039.451) },
+      { SIMDE_FLOAT64_C(101035.57249578879), SIMDE_FLOAT64_C(-178335.60168860707) },
+      { SIMDE_FLOAT64_C(0.19271006106527097), SIMDE_FLOAT64_C(-0.34014816606255927) } },
+    { {  INT64_C(3455690057560520072),  INT64_C( 772329104941970799) },
+      { SIMDE_FLOAT64_C(1.72784502878026e+18), SIMDE_FLOAT64_C(3.861645524709854e+17) },
+      { SIMDE_FLOAT64_C(3295602853355.904), SIMDE_FLOAT64_C(736550431196.1849) },
+      { SIMDE_FLOAT64_C(98216.6186975212), SIMDE_FLOAT64_C(21950.9134053047) },
+      { SIMDE_FLOAT64_C(0.1873333333921837), SIMDE_FLOAT64_C(0.041868044672593495) } },
+    { { -INT64_C(1367383661101893923), -INT64_C(3155116542684350832) },
+      { SIMDE_FLOAT64_C(-6.83691830550947e+17), SIMDE_FLOAT64_C(-1.5775582713421755e+18) },
+      { SIMDE_FLOAT64_C(-1304038678266.424), SIMDE_FLOAT64_C(-3008953612026.5493) },
+      { SIMDE_FLOAT64_C(-38863.381095720055), SIMDE_FLOAT64_C(-89673.8055952355) },
+      { SIMDE_FLOAT64_C(-0.0741260167993928), SIMDE_FLOAT64_C(-0.17103921050116636) } },
+    { {  INT64_C( 362933623547591374), -INT64_C(4468108275368723961) },
+      { SIMDE_FLOAT64_C(1.8146681177379568e+17), SIMDE_FLOAT64_C(-2.234054137684362e+18) },
+      { SIMDE_FLOAT64_C(346120475337.59247), SIMDE_FLOAT64_C(-4261120105141.3765) },
+      { SIMDE_FLOAT64_C(10315.193990993275), SIMDE_FLOAT64_C(-126991.27510611345) },
+      { SIMDE_FLOAT64_C(0.01967467115591674), SIMDE_FLOAT64_C(-0.24221663495276155) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+
+    simde_float64x2_t r1 = simde_vcvtq_n_f64_s64(a, 1);
+    simde_float64x2_t r20 = simde_vcvtq_n_f64_s64(a, 20);
+    simde_float64x2_t r45 = simde_vcvtq_n_f64_s64(a, 45);
+    simde_float64x2_t r64 = simde_vcvtq_n_f64_s64(a, 64);
+
+    simde_test_arm_neon_assert_equal_f64x2(r1, simde_vld1q_f64(test_vec[i].r1), 6);
+    simde_test_arm_neon_assert_equal_f64x2(r20, simde_vld1q_f64(test_vec[i].r20), 6);
+    simde_test_arm_neon_assert_equal_f64x2(r45, simde_vld1q_f64(test_vec[i].r45), 6);
+    simde_test_arm_neon_assert_equal_f64x2(r64, simde_vld1q_f64(test_vec[i].r64), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtq_n_f64_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    simde_float64 r1[2];
+    simde_float64 r20[2];
+    simde_float64 r45[2];
+    simde_float64 r64[2];
+  } test_vec[] = {
+    { { UINT64_C( 5503429050611770957), UINT64_C( 9854796849909984126) },
+      { SIMDE_FLOAT64_C(2.7517145253058857e+18), SIMDE_FLOAT64_C(4.927398424954992e+18) },
+      { SIMDE_FLOAT64_C(5248478937732.479), SIMDE_FLOAT64_C(9398266649160.37) },
+      { SIMDE_FLOAT64_C(156416.86134733196), SIMDE_FLOAT64_C(280090.1725638023) },
+      { SIMDE_FLOAT64_C(0.298341486639656), SIMDE_FLOAT64_C(0.5342296077037855) } },
+    { { UINT64_C(12708272416011057068), UINT64_C(15350810949133867355) },
+      { SIMDE_FLOAT64_C(6.354136208005529e+18), SIMDE_FLOAT64_C(7.675405474566934e+18) },
+      { SIMDE_FLOAT64_C(12119553009043.748), SIMDE_FLOAT64_C(14639674138196.818) },
+      { SIMDE_FLOAT64_C(361190.8259702846), SIMDE_FLOAT64_C(436296.2883173471) },
+      { SIMDE_FLOAT64_C(0.6889168280988399), SIMDE_FLOAT64_C(0.8321691290232603) } },
+    { { UINT64_C(16793470975503567221), UINT64_C( 7979628176378308591) },
+      { SIMDE_FLOAT64_C(8.396735487751783e+18), SIMDE_FLOAT64_C(3.9898140881891543e+18) },
+      { SIMDE_FLOAT64_C(16015501952651.564), SIMDE_FLOAT64_C(7609966446283.635) },
+      { SIMDE_FLOAT64_C(477299.1523936857), SIMDE_FLOAT64_C(226794.6733916889) },
+      { SIMDE_FLOAT64_C(0.9103758857606615), SIMDE_FLOAT64_C(0.4325765102227953) } },
+    { { UINT64_C( 3060454523549762208), UINT64_C( 6577225089958903577) },
+      { SIMDE_FLOAT64_C(1.530227261774881e+18), SIMDE_FLOAT64_C(3.288612544979452e+18) },
+      { SIMDE_FLOAT64_C(2918676875638.735), SIMDE_FLOAT64_C(6272530641516.594) },
+      { SIMDE_FLOAT64_C(86983.34919329688), SIMDE_FLOAT64_C(186935.98036517482) },
+      { SIMDE_FLOAT64_C(0.16590757216128707), SIMDE_FLOAT64_C(0.35655208657298054) } },
+    { { UINT64_C( 9671522445578610697), UINT64_C( 6711809717224821895) },
+      { SIMDE_FLOAT64_C(4.835761222789305e+18), SIMDE_FLOAT64_C(3.355904858612411e+18) },
+      { SIMDE_FLOAT64_C(9223482556894.885), SIMDE_FLOAT64_C(6400880543923.208) },
+      { SIMDE_FLOAT64_C(274881.2006978656), SIMDE_FLOAT64_C(190761.10553512597) },
+      { SIMDE_FLOAT64_C(0.5242942823369324), SIMDE_FLOAT64_C(0.36384793383622355) } },
+    { { UINT64_C(13027044301773173660), UINT64_C(11829021048750320411) },
+      { SIMDE_FLOAT64_C(6.513522150886586e+18), SIMDE_FLOAT64_C(5.91451052437516e+18) },
+      { SIMDE_FLOAT64_C(12423557569287.465), SIMDE_FLOAT64_C(11281033562422.104) },
+      { SIMDE_FLOAT64_C(370250.8678819974), SIMDE_FLOAT64_C(336200.99909371446) },
+      { SIMDE_FLOAT64_C(0.7061974866523693), SIMDE_FLOAT64_C(0.6412525159715928) } },
+    { { UINT64_C( 3135269143948446203), UINT64_C(13628838073527996674) },
+      { SIMDE_FLOAT64_C(1.567634571974223e+18), SIMDE_FLOAT64_C(6.814419036763998e+18) },
+      { SIMDE_FLOAT64_C(2990025657604.643), SIMDE_FLOAT64_C(12997472833183.285) },
+      { SIMDE_FLOAT64_C(89109.70859541425), SIMDE_FLOAT64_C(387354.87559983984) },
+      { SIMDE_FLOAT64_C(0.16996328085978366), SIMDE_FLOAT64_C(0.7388207923886105) } },
+    { { UINT64_C( 4332393187522463831), UINT64_C(12890420446002119543) },
+      { SIMDE_FLOAT64_C(2.166196593761232e+18), SIMDE_FLOAT64_C(6.445210223001059e+18) },
+      { SIMDE_FLOAT64_C(4131692111513.58), SIMDE_FLOAT64_C(12293262907030.219) },
+      { SIMDE_FLOAT64_C(123134.02031402529), SIMDE_FLOAT64_C(366367.78435201105) },
+      { SIMDE_FLOAT64_C(0.23485950529866273), SIMDE_FLOAT64_C(0.6987910925903531) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+
+    simde_float64x2_t r1 = simde_vcvtq_n_f64_u64(a, 1);
+    simde_float64x2_t r20 = simde_vcvtq_n_f64_u64(a, 20);
+    simde_float64x2_t r45 = simde_vcvtq_n_f64_u64(a, 45);
+    simde_float64x2_t r64 = simde_vcvtq_n_f64_u64(a, 64);
+
+    simde_test_arm_neon_assert_equal_f64x2(r1, simde_vld1q_f64(test_vec[i].r1), 6);
+    simde_test_arm_neon_assert_equal_f64x2(r20, simde_vld1q_f64(test_vec[i].r20), 6);
+    simde_test_arm_neon_assert_equal_f64x2(r45, simde_vld1q_f64(test_vec[i].r45), 6);
+    simde_test_arm_neon_assert_equal_f64x2(r64, simde_vld1q_f64(test_vec[i].r64), 6);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_n_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_n_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_n_f32_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvts_n_f32_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_n_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_n_u64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_n_f64_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtd_n_f64_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_n_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_n_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_n_f32_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvt_n_f32_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_f32_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_f32_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_u64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_f64_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtq_n_f64_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,473 @@
+#define SIMDE_TEST_ARM_NEON_INSN cvta
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/cvta.h"
+
+static int
+test_simde_vcvtas_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+           INT32_MIN },
+      {      SIMDE_MATH_INFINITYF,
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967296.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967040.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483520.0),
+         INT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+           INT32_MIN },
+      { SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+           INT32_MIN },
+    #endif
+    { SIMDE_FLOAT32_C(  -278.50),
+      -INT32_C(       279) },
+    { SIMDE_FLOAT32_C(   488.03),
+       INT32_C(       488) },
+    { SIMDE_FLOAT32_C(   303.19),
+       INT32_C(       303) },
+    { SIMDE_FLOAT32_C(   -74.50),
+      -INT32_C(        75) },
+    { SIMDE_FLOAT32_C(   -11.04),
+      -INT32_C(        11) },
+    { SIMDE_FLOAT32_C(  -807.66),
+      -INT32_C(       808) },
+    { SIMDE_FLOAT32_C(   875.50),
+       INT32_C(       876) },
+    { SIMDE_FLOAT32_C(   899.13),
+       INT32_C(       899) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r = simde_vcvtas_s32_f32(test_vec[i].a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtas_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+        UINT32_C(         0) },
+      {      SIMDE_MATH_INFINITYF,
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+        UINT32_C(2147483648) },
+      { SIMDE_FLOAT32_C(4294967296.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+        UINT32_C(3000000000) },
+      { SIMDE_FLOAT32_C(4294967040.0),
+        UINT32_C(4294967040) },
+      { SIMDE_FLOAT32_C(2147483520.0),
+        UINT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+        UINT32_C(         0) },
+      { SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+        UINT32_C(         0) },
+    #endif
+    { SIMDE_FLOAT32_C(   138.50),
+      UINT32_C(       139) },
+    { SIMDE_FLOAT32_C(   896.09),
+      UINT32_C(       896) },
+    { SIMDE_FLOAT32_C(   992.58),
+      UINT32_C(       993) },
+    { SIMDE_FLOAT32_C(   438.50),
+      UINT32_C(       439) },
+    { SIMDE_FLOAT32_C(   142.81),
+      UINT32_C(       143) },
+    { SIMDE_FLOAT32_C(   172.21),
+      UINT32_C(       172) },
+    { SIMDE_FLOAT32_C(   793.50),
+      UINT32_C(       794) },
+    { SIMDE_FLOAT32_C(   320.02),
+      UINT32_C(       320) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_vcvtas_u32_f32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtad_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+         INT64_C(                  0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                   INT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+                   INT64_MIN },
+      {       SIMDE_MATH_INFINITY,
+                   INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   -21.50),
+      -INT64_C(                 22) },
+    { SIMDE_FLOAT64_C(  -316.99),
+      -INT64_C(                317) },
+    { SIMDE_FLOAT64_C(  -699.18),
+      -INT64_C(                699) },
+    { SIMDE_FLOAT64_C(   607.50),
+       INT64_C(                608) },
+    { SIMDE_FLOAT64_C(  -492.68),
+      -INT64_C(                493) },
+    { SIMDE_FLOAT64_C(  -911.76),
+      -INT64_C(                912) },
+    { SIMDE_FLOAT64_C(   159.50),
+       INT64_C(                160) },
+    { SIMDE_FLOAT64_C(  -249.67),
+      -INT64_C(                250) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r = simde_vcvtad_s64_f64(test_vec[i].a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtad_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+        UINT64_C(                   0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                            UINT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+        UINT64_C(                   0) },
+      {       SIMDE_MATH_INFINITY,
+                            UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   300.50),
+      UINT64_C(                 301) },
+    { SIMDE_FLOAT64_C(   385.16),
+      UINT64_C(                 385) },
+    { SIMDE_FLOAT64_C(   584.36),
+      UINT64_C(                 584) },
+    { SIMDE_FLOAT64_C(   573.50),
+      UINT64_C(                 574) },
+    { SIMDE_FLOAT64_C(   882.52),
+      UINT64_C(                 883) },
+    { SIMDE_FLOAT64_C(    29.00),
+      UINT64_C(                  29) },
+    { SIMDE_FLOAT64_C(   674.50),
+      UINT64_C(                 675) },
+    { SIMDE_FLOAT64_C(   771.61),
+      UINT64_C(                 772) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_vcvtad_u64_f64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvta_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        {  INT32_C(         0),    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        {  INT32_C(2147483520),    INT32_MIN } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   172.50), SIMDE_FLOAT32_C(   -10.04) },
+      {  INT32_C(       173), -INT32_C(        10) } },
+    { { SIMDE_FLOAT32_C(    49.76), SIMDE_FLOAT32_C(    -2.95) },
+      {  INT32_C(        50), -INT32_C(         3) } },
+    { { SIMDE_FLOAT32_C(  -634.50), SIMDE_FLOAT32_C(   454.93) },
+      { -INT32_C(       635),  INT32_C(       455) } },
+    { { SIMDE_FLOAT32_C(   329.35), SIMDE_FLOAT32_C(   644.97) },
+      {  INT32_C(       329),  INT32_C(       645) } },
+    { { SIMDE_FLOAT32_C(   505.50), SIMDE_FLOAT32_C(   148.68) },
+      {  INT32_C(       506),  INT32_C(       149) } },
+    { { SIMDE_FLOAT32_C(  -597.61), SIMDE_FLOAT32_C(   844.31) },
+      { -INT32_C(       598),  INT32_C(       844) } },
+    { { SIMDE_FLOAT32_C(   179.50), SIMDE_FLOAT32_C(   785.08) },
+      {  INT32_C(       180),  INT32_C(       785) } },
+    { { SIMDE_FLOAT32_C(    64.67), SIMDE_FLOAT32_C(   978.02) },
+      {  INT32_C(        65),  INT32_C(       978) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvta_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvta_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        { UINT32_C(2147483648),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        { UINT32_C(2147483520), UINT32_C(         0) } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(    84.50), SIMDE_FLOAT32_C(   660.59) },
+      { UINT32_C(        85), UINT32_C(       661) } },
+    { { SIMDE_FLOAT32_C(   856.09), SIMDE_FLOAT32_C(   649.67) },
+      { UINT32_C(       856), UINT32_C(       650) } },
+    { { SIMDE_FLOAT32_C(   784.50), SIMDE_FLOAT32_C(   377.18) },
+      { UINT32_C(       785), UINT32_C(       377) } },
+    { { SIMDE_FLOAT32_C(   882.95), SIMDE_FLOAT32_C(   234.05) },
+      { UINT32_C(       883), UINT32_C(       234) } },
+    { { SIMDE_FLOAT32_C(   907.50), SIMDE_FLOAT32_C(   812.93) },
+      { UINT32_C(       908), UINT32_C(       813) } },
+    { { SIMDE_FLOAT32_C(   922.39), SIMDE_FLOAT32_C(     1.09) },
+      { UINT32_C(       922), UINT32_C(         1) } },
+    { { SIMDE_FLOAT32_C(    34.50), SIMDE_FLOAT32_C(   640.39) },
+      { UINT32_C(        35), UINT32_C(       640) } },
+    { { SIMDE_FLOAT32_C(   651.61), SIMDE_FLOAT32_C(    56.73) },
+      { UINT32_C(       652), UINT32_C(        57) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvta_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtaq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {  INT32_C(         0),    INT32_MAX,    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX,    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(2147483520),    INT32_MIN,  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   234.50), SIMDE_FLOAT32_C(    61.86), SIMDE_FLOAT32_C(  -636.50), SIMDE_FLOAT32_C(  -570.17) },
+      {  INT32_C(       235),  INT32_C(        62), -INT32_C(       637), -INT32_C(       570) } },
+    { { SIMDE_FLOAT32_C(  -813.44), SIMDE_FLOAT32_C(  -803.10), SIMDE_FLOAT32_C(  -593.69), SIMDE_FLOAT32_C(  -995.12) },
+      { -INT32_C(       813), -INT32_C(       803), -INT32_C(       594), -INT32_C(       995) } },
+    { { SIMDE_FLOAT32_C(  -761.50), SIMDE_FLOAT32_C(  -565.73), SIMDE_FLOAT32_C(  -251.50), SIMDE_FLOAT32_C(   -62.36) },
+      { -INT32_C(       762), -INT32_C(       566), -INT32_C(       252), -INT32_C(        62) } },
+    { { SIMDE_FLOAT32_C(  -953.63), SIMDE_FLOAT32_C(    81.73), SIMDE_FLOAT32_C(   388.71), SIMDE_FLOAT32_C(    -8.61) },
+      { -INT32_C(       954),  INT32_C(        82),  INT32_C(       389), -INT32_C(         9) } },
+    { { SIMDE_FLOAT32_C(   761.50), SIMDE_FLOAT32_C(  -670.26), SIMDE_FLOAT32_C(   622.50), SIMDE_FLOAT32_C(   845.38) },
+      {  INT32_C(       762), -INT32_C(       670),  INT32_C(       623),  INT32_C(       845) } },
+    { { SIMDE_FLOAT32_C(   626.26), SIMDE_FLOAT32_C(   984.83), SIMDE_FLOAT32_C(  -974.66), SIMDE_FLOAT32_C(   277.77) },
+      {  INT32_C(       626),  INT32_C(       985), -INT32_C(       975),  INT32_C(       278) } },
+    { { SIMDE_FLOAT32_C(  -638.50), SIMDE_FLOAT32_C(  -399.42), SIMDE_FLOAT32_C(   390.50), SIMDE_FLOAT32_C(    19.53) },
+      { -INT32_C(       639), -INT32_C(       399),  INT32_C(       391),  INT32_C(        20) } },
+    { { SIMDE_FLOAT32_C(    96.61), SIMDE_FLOAT32_C(   843.25), SIMDE_FLOAT32_C(  -613.96), SIMDE_FLOAT32_C(  -330.11) },
+      {  INT32_C(        97),  INT32_C(       843), -INT32_C(       614), -INT32_C(       330) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtaq_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtaq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX, UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(2147483648),           UINT32_MAX, UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(2147483520), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   278.50), SIMDE_FLOAT32_C(    11.76), SIMDE_FLOAT32_C(   369.50), SIMDE_FLOAT32_C(   236.08) },
+      { UINT32_C(       279), UINT32_C(        12), UINT32_C(       370), UINT32_C(       236) } },
+    { { SIMDE_FLOAT32_C(   659.53), SIMDE_FLOAT32_C(   766.06), SIMDE_FLOAT32_C(   465.78), SIMDE_FLOAT32_C(   347.85) },
+      { UINT32_C(       660), UINT32_C(       766), UINT32_C(       466), UINT32_C(       348) } },
+    { { SIMDE_FLOAT32_C(   344.50), SIMDE_FLOAT32_C(   931.82), SIMDE_FLOAT32_C(   774.50), SIMDE_FLOAT32_C(   523.43) },
+      { UINT32_C(       345), UINT32_C(       932), UINT32_C(       775), UINT32_C(       523) } },
+    { { SIMDE_FLOAT32_C(   694.80), SIMDE_FLOAT32_C(   394.53), SIMDE_FLOAT32_C(   623.68), SIMDE_FLOAT32_C(   102.29) },
+      { UINT32_C(       695), UINT32_C(       395), UINT32_C(       624), UINT32_C(       102) } },
+    { { SIMDE_FLOAT32_C(   927.50), SIMDE_FLOAT32_C(   499.59), SIMDE_FLOAT32_C(   355.50), SIMDE_FLOAT32_C(   342.20) },
+      { UINT32_C(       928), UINT32_C(       500), UINT32_C(       356), UINT32_C(       342) } },
+    { { SIMDE_FLOAT32_C(   948.54), SIMDE_FLOAT32_C(   545.18), SIMDE_FLOAT32_C(   809.19), SIMDE_FLOAT32_C(   964.08) },
+      { UINT32_C(       949), UINT32_C(       545), UINT32_C(       809), UINT32_C(       964) } },
+    { { SIMDE_FLOAT32_C(   621.50), SIMDE_FLOAT32_C(   580.56), SIMDE_FLOAT32_C(   100.50), SIMDE_FLOAT32_C(   162.06) },
+      { UINT32_C(       622), UINT32_C(       581), UINT32_C(       101), UINT32_C(       162) } },
+    { { SIMDE_FLOAT32_C(   375.21), SIMDE_FLOAT32_C(   916.30), SIMDE_FLOAT32_C(   101.61), SIMDE_FLOAT32_C(   849.43) },
+      { UINT32_C(       375), UINT32_C(       916), UINT32_C(       102), UINT32_C(       849) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtaq_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtaq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        {  INT64_C(                  0),            INT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        {            INT64_MIN,            INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   780.50), SIMDE_FLOAT64_C(  -938.46) },
+      {  INT64_C(                781), -INT64_C(                938) } },
+    { { SIMDE_FLOAT64_C(  -697.53), SIMDE_FLOAT64_C(  -617.30) },
+      { -INT64_C(                698), -INT64_C(                617) } },
+    { { SIMDE_FLOAT64_C(  -147.50), SIMDE_FLOAT64_C(    94.84) },
+      { -INT64_C(                148),  INT64_C(                 95) } },
+    { { SIMDE_FLOAT64_C(   267.19), SIMDE_FLOAT64_C(   297.44) },
+      {  INT64_C(                267),  INT64_C(                297) } },
+    { { SIMDE_FLOAT64_C(   769.50), SIMDE_FLOAT64_C(   888.69) },
+      {  INT64_C(                770),  INT64_C(                889) } },
+    { { SIMDE_FLOAT64_C(  -635.31), SIMDE_FLOAT64_C(   944.36) },
+      { -INT64_C(                635),  INT64_C(                944) } },
+    { { SIMDE_FLOAT64_C(    84.50), SIMDE_FLOAT64_C(  -434.58) },
+      {  INT64_C(                 85), -INT64_C(                435) } },
+    { { SIMDE_FLOAT64_C(   596.09), SIMDE_FLOAT64_C(  -931.69) },
+      {  INT64_C(                596), -INT64_C(                932) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtaq_s64_f64(a);
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtaq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   365.50), SIMDE_FLOAT64_C(   673.49) },
+      { UINT64_C(                 366), UINT64_C(                 673) } },
+    { { SIMDE_FLOAT64_C(   896.69), SIMDE_FLOAT64_C(   987.63) },
+      { UINT64_C(                 897), UINT64_C(                 988) } },
+    { { SIMDE_FLOAT64_C(   113.50), SIMDE_FLOAT64_C(   170.89) },
+      { UINT64_C(                 114), UINT64_C(                 171) } },
+    { { SIMDE_FLOAT64_C(   854.93), SIMDE_FLOAT64_C(   952.10) },
+      { UINT64_C(                 855), UINT64_C(                 952) } },
+    { { SIMDE_FLOAT64_C(   404.50), SIMDE_FLOAT64_C(   929.66) },
+      { UINT64_C(                 405), UINT64_C(                 930) } },
+    { { SIMDE_FLOAT64_C(   136.04), SIMDE_FLOAT64_C(   128.52) },
+      { UINT64_C(                 136), UINT64_C(                 129) } },
+    { { SIMDE_FLOAT64_C(   792.50), SIMDE_FLOAT64_C(   270.08) },
+      { UINT64_C(                 793), UINT64_C(                 270) } },
+    { { SIMDE_FLOAT64_C(   613.03), SIMDE_FLOAT64_C(   273.96) },
+      { UINT64_C(                 613), UINT64_C(                 274) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtaq_u64_f64(a);
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtas_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtas_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtad_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtad_u64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvta_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvta_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtaq_u64_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
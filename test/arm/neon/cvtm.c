@@ -0,0 +1,473 @@
+#define SIMDE_TEST_ARM_NEON_INSN cvtm
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/cvtm.h"
+
+static int
+test_simde_vcvtms_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+           INT32_MIN },
+      {      SIMDE_MATH_INFINITYF,
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967296.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967040.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483520.0),
+         INT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+           INT32_MIN },
+      { SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+           INT32_MIN },
+    #endif
+    { SIMDE_FLOAT32_C(  -801.50),
+      -INT32_C(       802) },
+    { SIMDE_FLOAT32_C(  -333.78),
+      -INT32_C(       334) },
+    { SIMDE_FLOAT32_C(   257.09),
+       INT32_C(       257) },
+    { SIMDE_FLOAT32_C(   441.50),
+       INT32_C(       441) },
+    { SIMDE_FLOAT32_C(   567.58),
+       INT32_C(       567) },
+    { SIMDE_FLOAT32_C(  -932.70),
+      -INT32_C(       933) },
+    { SIMDE_FLOAT32_C(  -257.50),
+      -INT32_C(       258) },
+    { SIMDE_FLOAT32_C(  -926.41),
+      -INT32_C(       927) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r = simde_vcvtms_s32_f32(test_vec[i].a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtms_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+        UINT32_C(         0) },
+      {      SIMDE_MATH_INFINITYF,
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+        UINT32_C(2147483648) },
+      { SIMDE_FLOAT32_C(4294967296.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+        UINT32_C(3000000000) },
+      { SIMDE_FLOAT32_C(4294967040.0),
+        UINT32_C(4294967040) },
+      { SIMDE_FLOAT32_C(2147483520.0),
+        UINT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+        UINT32_C(         0) },
+      { SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+        UINT32_C(         0) },
+    #endif
+    { SIMDE_FLOAT32_C(   854.50),
+      UINT32_C(       854) },
+    { SIMDE_FLOAT32_C(   172.76),
+      UINT32_C(       172) },
+    { SIMDE_FLOAT32_C(    28.50),
+      UINT32_C(        28) },
+    { SIMDE_FLOAT32_C(   679.50),
+      UINT32_C(       679) },
+    { SIMDE_FLOAT32_C(   786.57),
+      UINT32_C(       786) },
+    { SIMDE_FLOAT32_C(   510.99),
+      UINT32_C(       510) },
+    { SIMDE_FLOAT32_C(   929.50),
+      UINT32_C(       929) },
+    { SIMDE_FLOAT32_C(   213.09),
+      UINT32_C(       213) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_vcvtms_u32_f32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtmd_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+         INT64_C(                  0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                   INT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+                   INT64_MIN },
+      {       SIMDE_MATH_INFINITY,
+                   INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   468.50),
+       INT64_C(                468) },
+    { SIMDE_FLOAT64_C(  -685.66),
+      -INT64_C(                686) },
+    { SIMDE_FLOAT64_C(   539.85),
+       INT64_C(                539) },
+    { SIMDE_FLOAT64_C(   228.50),
+       INT64_C(                228) },
+    { SIMDE_FLOAT64_C(  -569.37),
+      -INT64_C(                570) },
+    { SIMDE_FLOAT64_C(   634.87),
+       INT64_C(                634) },
+    { SIMDE_FLOAT64_C(  -236.50),
+      -INT64_C(                237) },
+    { SIMDE_FLOAT64_C(  -609.07),
+      -INT64_C(                610) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r = simde_vcvtmd_s64_f64(test_vec[i].a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtmd_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+        UINT64_C(                   0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                            UINT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+        UINT64_C(                   0) },
+      {       SIMDE_MATH_INFINITY,
+                            UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   495.50),
+      UINT64_C(                 495) },
+    { SIMDE_FLOAT64_C(   973.88),
+      UINT64_C(                 973) },
+    { SIMDE_FLOAT64_C(   566.81),
+      UINT64_C(                 566) },
+    { SIMDE_FLOAT64_C(   981.50),
+      UINT64_C(                 981) },
+    { SIMDE_FLOAT64_C(   262.19),
+      UINT64_C(                 262) },
+    { SIMDE_FLOAT64_C(   876.98),
+      UINT64_C(                 876) },
+    { SIMDE_FLOAT64_C(   487.50),
+      UINT64_C(                 487) },
+    { SIMDE_FLOAT64_C(   887.26),
+      UINT64_C(                 887) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_vcvtmd_u64_f64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtm_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        {  INT32_C(         0),    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        {  INT32_C(2147483520),    INT32_MIN } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -648.50), SIMDE_FLOAT32_C(   419.65) },
+      { -INT32_C(       649),  INT32_C(       419) } },
+    { { SIMDE_FLOAT32_C(  -742.93), SIMDE_FLOAT32_C(  -817.59) },
+      { -INT32_C(       743), -INT32_C(       818) } },
+    { { SIMDE_FLOAT32_C(   903.50), SIMDE_FLOAT32_C(   970.06) },
+      {  INT32_C(       903),  INT32_C(       970) } },
+    { { SIMDE_FLOAT32_C(  -416.20), SIMDE_FLOAT32_C(   102.69) },
+      { -INT32_C(       417),  INT32_C(       102) } },
+    { { SIMDE_FLOAT32_C(   906.50), SIMDE_FLOAT32_C(  -250.57) },
+      {  INT32_C(       906), -INT32_C(       251) } },
+    { { SIMDE_FLOAT32_C(  -352.07), SIMDE_FLOAT32_C(  -752.49) },
+      { -INT32_C(       353), -INT32_C(       753) } },
+    { { SIMDE_FLOAT32_C(  -568.50), SIMDE_FLOAT32_C(   275.52) },
+      { -INT32_C(       569),  INT32_C(       275) } },
+    { { SIMDE_FLOAT32_C(  -140.88), SIMDE_FLOAT32_C(   768.72) },
+      { -INT32_C(       141),  INT32_C(       768) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvtm_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtm_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        { UINT32_C(2147483648),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        { UINT32_C(2147483520), UINT32_C(         0) } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   922.50), SIMDE_FLOAT32_C(   324.23) },
+      { UINT32_C(       922), UINT32_C(       324) } },
+    { { SIMDE_FLOAT32_C(   130.49), SIMDE_FLOAT32_C(   115.86) },
+      { UINT32_C(       130), UINT32_C(       115) } },
+    { { SIMDE_FLOAT32_C(   501.50), SIMDE_FLOAT32_C(   268.78) },
+      { UINT32_C(       501), UINT32_C(       268) } },
+    { { SIMDE_FLOAT32_C(   587.89), SIMDE_FLOAT32_C(     4.08) },
+      { UINT32_C(       587), UINT32_C(         4) } },
+    { { SIMDE_FLOAT32_C(   747.50), SIMDE_FLOAT32_C(    67.16) },
+      { UINT32_C(       747), UINT32_C(        67) } },
+    { { SIMDE_FLOAT32_C(   347.61), SIMDE_FLOAT32_C(   391.24) },
+      { UINT32_C(       347), UINT32_C(       391) } },
+    { { SIMDE_FLOAT32_C(    71.50), SIMDE_FLOAT32_C(   174.48) },
+      { UINT32_C(        71), UINT32_C(       174) } },
+    { { SIMDE_FLOAT32_C(   770.81), SIMDE_FLOAT32_C(   643.35) },
+      { UINT32_C(       770), UINT32_C(       643) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvtm_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtmq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {  INT32_C(         0),    INT32_MAX,    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX,    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(2147483520),    INT32_MIN,  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -814.50), SIMDE_FLOAT32_C(  -468.92), SIMDE_FLOAT32_C(   593.50), SIMDE_FLOAT32_C(  -337.78) },
+      { -INT32_C(       815), -INT32_C(       469),  INT32_C(       593), -INT32_C(       338) } },
+    { { SIMDE_FLOAT32_C(   635.14), SIMDE_FLOAT32_C(   560.86), SIMDE_FLOAT32_C(   497.57), SIMDE_FLOAT32_C(  -521.35) },
+      {  INT32_C(       635),  INT32_C(       560),  INT32_C(       497), -INT32_C(       522) } },
+    { { SIMDE_FLOAT32_C(  -236.50), SIMDE_FLOAT32_C(   957.73), SIMDE_FLOAT32_C(   770.50), SIMDE_FLOAT32_C(   634.13) },
+      { -INT32_C(       237),  INT32_C(       957),  INT32_C(       770),  INT32_C(       634) } },
+    { { SIMDE_FLOAT32_C(  -451.51), SIMDE_FLOAT32_C(   746.01), SIMDE_FLOAT32_C(  -283.54), SIMDE_FLOAT32_C(  -340.54) },
+      { -INT32_C(       452),  INT32_C(       746), -INT32_C(       284), -INT32_C(       341) } },
+    { { SIMDE_FLOAT32_C(  -608.50), SIMDE_FLOAT32_C(  -834.81), SIMDE_FLOAT32_C(   208.50), SIMDE_FLOAT32_C(  -890.95) },
+      { -INT32_C(       609), -INT32_C(       835),  INT32_C(       208), -INT32_C(       891) } },
+    { { SIMDE_FLOAT32_C(   854.63), SIMDE_FLOAT32_C(   900.06), SIMDE_FLOAT32_C(   340.79), SIMDE_FLOAT32_C(   977.76) },
+      {  INT32_C(       854),  INT32_C(       900),  INT32_C(       340),  INT32_C(       977) } },
+    { { SIMDE_FLOAT32_C(  -600.50), SIMDE_FLOAT32_C(   609.93), SIMDE_FLOAT32_C(   153.50), SIMDE_FLOAT32_C(  -125.54) },
+      { -INT32_C(       601),  INT32_C(       609),  INT32_C(       153), -INT32_C(       126) } },
+    { { SIMDE_FLOAT32_C(   411.80), SIMDE_FLOAT32_C(   861.81), SIMDE_FLOAT32_C(  -688.72), SIMDE_FLOAT32_C(   322.84) },
+      {  INT32_C(       411),  INT32_C(       861), -INT32_C(       689),  INT32_C(       322) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtmq_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtmq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX, UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(2147483648),           UINT32_MAX, UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(2147483520), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   183.50), SIMDE_FLOAT32_C(   668.79), SIMDE_FLOAT32_C(   675.50), SIMDE_FLOAT32_C(   178.92) },
+      { UINT32_C(       183), UINT32_C(       668), UINT32_C(       675), UINT32_C(       178) } },
+    { { SIMDE_FLOAT32_C(   936.12), SIMDE_FLOAT32_C(   552.20), SIMDE_FLOAT32_C(   486.54), SIMDE_FLOAT32_C(   161.70) },
+      { UINT32_C(       936), UINT32_C(       552), UINT32_C(       486), UINT32_C(       161) } },
+    { { SIMDE_FLOAT32_C(   549.50), SIMDE_FLOAT32_C(   496.21), SIMDE_FLOAT32_C(   452.50), SIMDE_FLOAT32_C(   149.91) },
+      { UINT32_C(       549), UINT32_C(       496), UINT32_C(       452), UINT32_C(       149) } },
+    { { SIMDE_FLOAT32_C(   448.55), SIMDE_FLOAT32_C(   728.08), SIMDE_FLOAT32_C(   139.35), SIMDE_FLOAT32_C(   119.47) },
+      { UINT32_C(       448), UINT32_C(       728), UINT32_C(       139), UINT32_C(       119) } },
+    { { SIMDE_FLOAT32_C(   415.50), SIMDE_FLOAT32_C(   603.38), SIMDE_FLOAT32_C(    64.50), SIMDE_FLOAT32_C(   945.74) },
+      { UINT32_C(       415), UINT32_C(       603), UINT32_C(        64), UINT32_C(       945) } },
+    { { SIMDE_FLOAT32_C(   923.95), SIMDE_FLOAT32_C(   503.93), SIMDE_FLOAT32_C(   227.68), SIMDE_FLOAT32_C(   293.47) },
+      { UINT32_C(       923), UINT32_C(       503), UINT32_C(       227), UINT32_C(       293) } },
+    { { SIMDE_FLOAT32_C(   280.50), SIMDE_FLOAT32_C(   169.55), SIMDE_FLOAT32_C(   539.50), SIMDE_FLOAT32_C(     1.13) },
+      { UINT32_C(       280), UINT32_C(       169), UINT32_C(       539), UINT32_C(         1) } },
+    { { SIMDE_FLOAT32_C(   155.11), SIMDE_FLOAT32_C(   504.52), SIMDE_FLOAT32_C(   925.65), SIMDE_FLOAT32_C(   878.83) },
+      { UINT32_C(       155), UINT32_C(       504), UINT32_C(       925), UINT32_C(       878) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtmq_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtmq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        {  INT64_C(                  0),            INT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        {            INT64_MIN,            INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(    69.50), SIMDE_FLOAT64_C(   254.34) },
+      {  INT64_C(                 69),  INT64_C(                254) } },
+    { { SIMDE_FLOAT64_C(  -201.83), SIMDE_FLOAT64_C(  -420.05) },
+      { -INT64_C(                202), -INT64_C(                421) } },
+    { { SIMDE_FLOAT64_C(   576.50), SIMDE_FLOAT64_C(   818.50) },
+      {  INT64_C(                576),  INT64_C(                818) } },
+    { { SIMDE_FLOAT64_C(  -867.14), SIMDE_FLOAT64_C(   335.50) },
+      { -INT64_C(                868),  INT64_C(                335) } },
+    { { SIMDE_FLOAT64_C(  -411.50), SIMDE_FLOAT64_C(  -583.48) },
+      { -INT64_C(                412), -INT64_C(                584) } },
+    { { SIMDE_FLOAT64_C(   165.27), SIMDE_FLOAT64_C(   161.15) },
+      {  INT64_C(                165),  INT64_C(                161) } },
+    { { SIMDE_FLOAT64_C(  -885.50), SIMDE_FLOAT64_C(   -83.55) },
+      { -INT64_C(                886), -INT64_C(                 84) } },
+    { { SIMDE_FLOAT64_C(   617.90), SIMDE_FLOAT64_C(   570.57) },
+      {  INT64_C(                617),  INT64_C(                570) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtmq_s64_f64(a);
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtmq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   200.50), SIMDE_FLOAT64_C(   812.13) },
+      { UINT64_C(                 200), UINT64_C(                 812) } },
+    { { SIMDE_FLOAT64_C(   194.02), SIMDE_FLOAT64_C(    43.79) },
+      { UINT64_C(                 194), UINT64_C(                  43) } },
+    { { SIMDE_FLOAT64_C(   156.50), SIMDE_FLOAT64_C(   982.74) },
+      { UINT64_C(                 156), UINT64_C(                 982) } },
+    { { SIMDE_FLOAT64_C(    13.91), SIMDE_FLOAT64_C(   948.33) },
+      { UINT64_C(                  13), UINT64_C(                 948) } },
+    { { SIMDE_FLOAT64_C(   246.50), SIMDE_FLOAT64_C(   410.21) },
+      { UINT64_C(                 246), UINT64_C(                 410) } },
+    { { SIMDE_FLOAT64_C(   825.94), SIMDE_FLOAT64_C(   270.77) },
+      { UINT64_C(                 825), UINT64_C(                 270) } },
+    { { SIMDE_FLOAT64_C(   307.50), SIMDE_FLOAT64_C(   616.66) },
+      { UINT64_C(                 307), UINT64_C(                 616) } },
+    { { SIMDE_FLOAT64_C(   964.48), SIMDE_FLOAT64_C(   705.64) },
+      { UINT64_C(                 964), UINT64_C(                 705) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtmq_u64_f64(a);
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtms_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtms_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmd_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmd_u64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtm_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtm_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtmq_u64_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
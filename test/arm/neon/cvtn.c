@@ -0,0 +1,473 @@
+#define SIMDE_TEST_ARM_NEON_INSN cvtn
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/cvtn.h"
+
+static int
+test_simde_vcvtns_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+           INT32_MIN },
+      {      SIMDE_MATH_INFINITYF,
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967296.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967040.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483520.0),
+         INT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+           INT32_MIN },
+      { SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+           INT32_MIN },
+    #endif
+    { SIMDE_FLOAT32_C(   530.50),
+       INT32_C(       530) },
+    { SIMDE_FLOAT32_C(  -520.94),
+      -INT32_C(       521) },
+    { SIMDE_FLOAT32_C(   337.72),
+       INT32_C(       338) },
+    { SIMDE_FLOAT32_C(   709.50),
+       INT32_C(       710) },
+    { SIMDE_FLOAT32_C(  -522.59),
+      -INT32_C(       523) },
+    { SIMDE_FLOAT32_C(  -280.94),
+      -INT32_C(       281) },
+    { SIMDE_FLOAT32_C(   674.50),
+       INT32_C(       674) },
+    { SIMDE_FLOAT32_C(   372.92),
+       INT32_C(       373) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r = simde_vcvtns_s32_f32(test_vec[i].a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtns_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+        UINT32_C(         0) },
+      {      SIMDE_MATH_INFINITYF,
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+        UINT32_C(2147483648) },
+      { SIMDE_FLOAT32_C(4294967296.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+        UINT32_C(3000000000) },
+      { SIMDE_FLOAT32_C(4294967040.0),
+        UINT32_C(4294967040) },
+      { SIMDE_FLOAT32_C(2147483520.0),
+        UINT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+        UINT32_C(         0) },
+      { SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+        UINT32_C(         0) },
+    #endif
+    { SIMDE_FLOAT32_C(   780.50),
+      UINT32_C(       780) },
+    { SIMDE_FLOAT32_C(   109.17),
+      UINT32_C(       109) },
+    { SIMDE_FLOAT32_C(   128.24),
+      UINT32_C(       128) },
+    { SIMDE_FLOAT32_C(    16.50),
+      UINT32_C(        16) },
+    { SIMDE_FLOAT32_C(   546.77),
+      UINT32_C(       547) },
+    { SIMDE_FLOAT32_C(   939.51),
+      UINT32_C(       940) },
+    { SIMDE_FLOAT32_C(   938.50),
+      UINT32_C(       938) },
+    { SIMDE_FLOAT32_C(   139.67),
+      UINT32_C(       140) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_vcvtns_u32_f32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtnd_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+         INT64_C(                  0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                   INT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+                   INT64_MIN },
+      {       SIMDE_MATH_INFINITY,
+                   INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   505.50),
+       INT64_C(                506) },
+    { SIMDE_FLOAT64_C(   140.92),
+       INT64_C(                141) },
+    { SIMDE_FLOAT64_C(   544.06),
+       INT64_C(                544) },
+    { SIMDE_FLOAT64_C(   479.50),
+       INT64_C(                480) },
+    { SIMDE_FLOAT64_C(  -861.86),
+      -INT64_C(                862) },
+    { SIMDE_FLOAT64_C(  -195.33),
+      -INT64_C(                195) },
+    { SIMDE_FLOAT64_C(   473.50),
+       INT64_C(                474) },
+    { SIMDE_FLOAT64_C(   897.60),
+       INT64_C(                898) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r = simde_vcvtnd_s64_f64(test_vec[i].a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtnd_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+        UINT64_C(                   0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                            UINT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+        UINT64_C(                   0) },
+      {       SIMDE_MATH_INFINITY,
+                            UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   803.50),
+      UINT64_C(                 804) },
+    { SIMDE_FLOAT64_C(   445.64),
+      UINT64_C(                 446) },
+    { SIMDE_FLOAT64_C(   533.89),
+      UINT64_C(                 534) },
+    { SIMDE_FLOAT64_C(   294.50),
+      UINT64_C(                 294) },
+    { SIMDE_FLOAT64_C(   491.45),
+      UINT64_C(                 491) },
+    { SIMDE_FLOAT64_C(   141.94),
+      UINT64_C(                 142) },
+    { SIMDE_FLOAT64_C(   886.50),
+      UINT64_C(                 886) },
+    { SIMDE_FLOAT64_C(   970.57),
+      UINT64_C(                 971) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_vcvtnd_u64_f64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtn_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        {  INT32_C(         0),    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        {  INT32_C(2147483520),    INT32_MIN } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   -82.50), SIMDE_FLOAT32_C(    54.20) },
+      { -INT32_C(        82),  INT32_C(        54) } },
+    { { SIMDE_FLOAT32_C(  -184.16), SIMDE_FLOAT32_C(   251.29) },
+      { -INT32_C(       184),  INT32_C(       251) } },
+    { { SIMDE_FLOAT32_C(   942.50), SIMDE_FLOAT32_C(   654.71) },
+      {  INT32_C(       942),  INT32_C(       655) } },
+    { { SIMDE_FLOAT32_C(   314.70), SIMDE_FLOAT32_C(  -792.95) },
+      {  INT32_C(       315), -INT32_C(       793) } },
+    { { SIMDE_FLOAT32_C(   550.50), SIMDE_FLOAT32_C(  -497.86) },
+      {  INT32_C(       550), -INT32_C(       498) } },
+    { { SIMDE_FLOAT32_C(   601.63), SIMDE_FLOAT32_C(   569.46) },
+      {  INT32_C(       602),  INT32_C(       569) } },
+    { { SIMDE_FLOAT32_C(  -846.50), SIMDE_FLOAT32_C(   662.61) },
+      { -INT32_C(       846),  INT32_C(       663) } },
+    { { SIMDE_FLOAT32_C(   277.00), SIMDE_FLOAT32_C(   236.09) },
+      {  INT32_C(       277),  INT32_C(       236) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvtn_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtn_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        { UINT32_C(2147483648),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        { UINT32_C(2147483520), UINT32_C(         0) } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   733.50), SIMDE_FLOAT32_C(   238.87) },
+      { UINT32_C(       734), UINT32_C(       239) } },
+    { { SIMDE_FLOAT32_C(   743.38), SIMDE_FLOAT32_C(    48.70) },
+      { UINT32_C(       743), UINT32_C(        49) } },
+    { { SIMDE_FLOAT32_C(   446.50), SIMDE_FLOAT32_C(   215.26) },
+      { UINT32_C(       446), UINT32_C(       215) } },
+    { { SIMDE_FLOAT32_C(   990.60), SIMDE_FLOAT32_C(    43.62) },
+      { UINT32_C(       991), UINT32_C(        44) } },
+    { { SIMDE_FLOAT32_C(   381.50), SIMDE_FLOAT32_C(   721.65) },
+      { UINT32_C(       382), UINT32_C(       722) } },
+    { { SIMDE_FLOAT32_C(   527.70), SIMDE_FLOAT32_C(   422.72) },
+      { UINT32_C(       528), UINT32_C(       423) } },
+    { { SIMDE_FLOAT32_C(   617.50), SIMDE_FLOAT32_C(    66.76) },
+      { UINT32_C(       618), UINT32_C(        67) } },
+    { { SIMDE_FLOAT32_C(   357.33), SIMDE_FLOAT32_C(    10.55) },
+      { UINT32_C(       357), UINT32_C(        11) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvtn_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtnq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {  INT32_C(         0),    INT32_MAX,    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX,    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(2147483520),    INT32_MIN,  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -193.50), SIMDE_FLOAT32_C(  -415.98), SIMDE_FLOAT32_C(   116.50), SIMDE_FLOAT32_C(   762.65) },
+      { -INT32_C(       194), -INT32_C(       416),  INT32_C(       116),  INT32_C(       763) } },
+    { { SIMDE_FLOAT32_C(   172.84), SIMDE_FLOAT32_C(   619.69), SIMDE_FLOAT32_C(   671.94), SIMDE_FLOAT32_C(  -634.87) },
+      {  INT32_C(       173),  INT32_C(       620),  INT32_C(       672), -INT32_C(       635) } },
+    { { SIMDE_FLOAT32_C(   973.50), SIMDE_FLOAT32_C(   768.59), SIMDE_FLOAT32_C(  -149.50), SIMDE_FLOAT32_C(  -964.14) },
+      {  INT32_C(       974),  INT32_C(       769), -INT32_C(       150), -INT32_C(       964) } },
+    { { SIMDE_FLOAT32_C(   594.91), SIMDE_FLOAT32_C(   175.43), SIMDE_FLOAT32_C(  -425.95), SIMDE_FLOAT32_C(  -690.44) },
+      {  INT32_C(       595),  INT32_C(       175), -INT32_C(       426), -INT32_C(       690) } },
+    { { SIMDE_FLOAT32_C(  -656.50), SIMDE_FLOAT32_C(   275.92), SIMDE_FLOAT32_C(  -859.50), SIMDE_FLOAT32_C(  -485.34) },
+      { -INT32_C(       656),  INT32_C(       276), -INT32_C(       860), -INT32_C(       485) } },
+    { { SIMDE_FLOAT32_C(    -3.05), SIMDE_FLOAT32_C(  -640.22), SIMDE_FLOAT32_C(   594.10), SIMDE_FLOAT32_C(  -895.26) },
+      { -INT32_C(         3), -INT32_C(       640),  INT32_C(       594), -INT32_C(       895) } },
+    { { SIMDE_FLOAT32_C(   543.50), SIMDE_FLOAT32_C(   333.83), SIMDE_FLOAT32_C(   178.50), SIMDE_FLOAT32_C(     9.97) },
+      {  INT32_C(       544),  INT32_C(       334),  INT32_C(       178),  INT32_C(        10) } },
+    { { SIMDE_FLOAT32_C(   288.86), SIMDE_FLOAT32_C(   476.95), SIMDE_FLOAT32_C(   729.88), SIMDE_FLOAT32_C(   179.13) },
+      {  INT32_C(       289),  INT32_C(       477),  INT32_C(       730),  INT32_C(       179) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtnq_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtnq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX, UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(2147483648),           UINT32_MAX, UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(2147483520), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   226.50), SIMDE_FLOAT32_C(   507.70), SIMDE_FLOAT32_C(   173.50), SIMDE_FLOAT32_C(   890.86) },
+      { UINT32_C(       226), UINT32_C(       508), UINT32_C(       174), UINT32_C(       891) } },
+    { { SIMDE_FLOAT32_C(   143.79), SIMDE_FLOAT32_C(    64.07), SIMDE_FLOAT32_C(    68.10), SIMDE_FLOAT32_C(   942.18) },
+      { UINT32_C(       144), UINT32_C(        64), UINT32_C(        68), UINT32_C(       942) } },
+    { { SIMDE_FLOAT32_C(   337.50), SIMDE_FLOAT32_C(    81.21), SIMDE_FLOAT32_C(   368.50), SIMDE_FLOAT32_C(   604.50) },
+      { UINT32_C(       338), UINT32_C(        81), UINT32_C(       368), UINT32_C(       604) } },
+    { { SIMDE_FLOAT32_C(   304.95), SIMDE_FLOAT32_C(   499.17), SIMDE_FLOAT32_C(   392.14), SIMDE_FLOAT32_C(   398.04) },
+      { UINT32_C(       305), UINT32_C(       499), UINT32_C(       392), UINT32_C(       398) } },
+    { { SIMDE_FLOAT32_C(   595.50), SIMDE_FLOAT32_C(    54.11), SIMDE_FLOAT32_C(   283.50), SIMDE_FLOAT32_C(   707.22) },
+      { UINT32_C(       596), UINT32_C(        54), UINT32_C(       284), UINT32_C(       707) } },
+    { { SIMDE_FLOAT32_C(   524.31), SIMDE_FLOAT32_C(   480.69), SIMDE_FLOAT32_C(   375.40), SIMDE_FLOAT32_C(   171.97) },
+      { UINT32_C(       524), UINT32_C(       481), UINT32_C(       375), UINT32_C(       172) } },
+    { { SIMDE_FLOAT32_C(   478.50), SIMDE_FLOAT32_C(   264.13), SIMDE_FLOAT32_C(   264.50), SIMDE_FLOAT32_C(    86.75) },
+      { UINT32_C(       478), UINT32_C(       264), UINT32_C(       264), UINT32_C(        87) } },
+    { { SIMDE_FLOAT32_C(   838.96), SIMDE_FLOAT32_C(   290.00), SIMDE_FLOAT32_C(   199.93), SIMDE_FLOAT32_C(   437.93) },
+      { UINT32_C(       839), UINT32_C(       290), UINT32_C(       200), UINT32_C(       438) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtnq_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtnq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        {  INT64_C(                  0),            INT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        {            INT64_MIN,            INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(  -469.50), SIMDE_FLOAT64_C(  -458.01) },
+      { -INT64_C(                470), -INT64_C(                458) } },
+    { { SIMDE_FLOAT64_C(   657.45), SIMDE_FLOAT64_C(  -566.90) },
+      {  INT64_C(                657), -INT64_C(                567) } },
+    { { SIMDE_FLOAT64_C(  -231.50), SIMDE_FLOAT64_C(  -413.20) },
+      { -INT64_C(                232), -INT64_C(                413) } },
+    { { SIMDE_FLOAT64_C(   -34.22), SIMDE_FLOAT64_C(   520.15) },
+      { -INT64_C(                 34),  INT64_C(                520) } },
+    { { SIMDE_FLOAT64_C(   650.50), SIMDE_FLOAT64_C(  -219.96) },
+      {  INT64_C(                650), -INT64_C(                220) } },
+    { { SIMDE_FLOAT64_C(  -322.54), SIMDE_FLOAT64_C(   -30.44) },
+      { -INT64_C(                323), -INT64_C(                 30) } },
+    { { SIMDE_FLOAT64_C(  -500.50), SIMDE_FLOAT64_C(   907.95) },
+      { -INT64_C(                500),  INT64_C(                908) } },
+    { { SIMDE_FLOAT64_C(   302.00), SIMDE_FLOAT64_C(    38.92) },
+      {  INT64_C(                302),  INT64_C(                 39) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtnq_s64_f64(a);
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtnq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(    25.50), SIMDE_FLOAT64_C(   233.77) },
+      { UINT64_C(                  26), UINT64_C(                 234) } },
+    { { SIMDE_FLOAT64_C(   498.73), SIMDE_FLOAT64_C(   176.04) },
+      { UINT64_C(                 499), UINT64_C(                 176) } },
+    { { SIMDE_FLOAT64_C(   356.50), SIMDE_FLOAT64_C(   520.73) },
+      { UINT64_C(                 356), UINT64_C(                 521) } },
+    { { SIMDE_FLOAT64_C(    79.20), SIMDE_FLOAT64_C(   481.43) },
+      { UINT64_C(                  79), UINT64_C(                 481) } },
+    { { SIMDE_FLOAT64_C(   675.50), SIMDE_FLOAT64_C(    70.00) },
+      { UINT64_C(                 676), UINT64_C(                  70) } },
+    { { SIMDE_FLOAT64_C(   109.97), SIMDE_FLOAT64_C(   973.21) },
+      { UINT64_C(                 110), UINT64_C(                 973) } },
+    { { SIMDE_FLOAT64_C(   919.50), SIMDE_FLOAT64_C(   180.74) },
+      { UINT64_C(                 920), UINT64_C(                 181) } },
+    { { SIMDE_FLOAT64_C(   833.78), SIMDE_FLOAT64_C(   539.22) },
+      { UINT64_C(                 834), UINT64_C(                 539) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtnq_u64_f64(a);
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtns_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtns_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnd_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnd_u64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtn_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtn_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtnq_u64_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
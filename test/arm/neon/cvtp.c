@@ -0,0 +1,473 @@
+#define SIMDE_TEST_ARM_NEON_INSN cvtp
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/cvtp.h"
+
+static int
+test_simde_vcvtps_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    int32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+           INT32_MIN },
+      {      SIMDE_MATH_INFINITYF,
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967296.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(4294967040.0),
+           INT32_MAX },
+      { SIMDE_FLOAT32_C(2147483520.0),
+         INT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+           INT32_MIN },
+      { SIMDE_MATH_NANF,
+         INT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+           INT32_MIN },
+    #endif
+    { SIMDE_FLOAT32_C(   895.50),
+       INT32_C(       896) },
+    { SIMDE_FLOAT32_C(   661.48),
+       INT32_C(       662) },
+    { SIMDE_FLOAT32_C(   218.95),
+       INT32_C(       219) },
+    { SIMDE_FLOAT32_C(   193.50),
+       INT32_C(       194) },
+    { SIMDE_FLOAT32_C(   397.81),
+       INT32_C(       398) },
+    { SIMDE_FLOAT32_C(  -216.63),
+      -INT32_C(       216) },
+    { SIMDE_FLOAT32_C(  -997.50),
+      -INT32_C(       997) },
+    { SIMDE_FLOAT32_C(   319.31),
+       INT32_C(       320) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r = simde_vcvtps_s32_f32(test_vec[i].a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtps_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    uint32_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {           SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(10000000000.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(-10000000000.0),
+        UINT32_C(         0) },
+      {      SIMDE_MATH_INFINITYF,
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(2147483648.0),
+        UINT32_C(2147483648) },
+      { SIMDE_FLOAT32_C(4294967296.0),
+                  UINT32_MAX },
+      { SIMDE_FLOAT32_C(3000000000.0),
+        UINT32_C(3000000000) },
+      { SIMDE_FLOAT32_C(4294967040.0),
+        UINT32_C(4294967040) },
+      { SIMDE_FLOAT32_C(2147483520.0),
+        UINT32_C(2147483520) },
+      { SIMDE_FLOAT32_C(-2147483648.0),
+        UINT32_C(         0) },
+      { SIMDE_MATH_NANF,
+        UINT32_C(         0) },
+      { SIMDE_FLOAT32_C(-4294967296.0),
+        UINT32_C(         0) },
+    #endif
+    { SIMDE_FLOAT32_C(   753.50),
+      UINT32_C(       754) },
+    { SIMDE_FLOAT32_C(   296.37),
+      UINT32_C(       297) },
+    { SIMDE_FLOAT32_C(   569.54),
+      UINT32_C(       570) },
+    { SIMDE_FLOAT32_C(   802.50),
+      UINT32_C(       803) },
+    { SIMDE_FLOAT32_C(   639.56),
+      UINT32_C(       640) },
+    { SIMDE_FLOAT32_C(   124.07),
+      UINT32_C(       125) },
+    { SIMDE_FLOAT32_C(   441.50),
+      UINT32_C(       442) },
+    { SIMDE_FLOAT32_C(    33.57),
+      UINT32_C(        34) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_vcvtps_u32_f32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtpd_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    int64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+         INT64_C(                  0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                   INT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+                   INT64_MIN },
+      {       SIMDE_MATH_INFINITY,
+                   INT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   414.50),
+       INT64_C(                415) },
+    { SIMDE_FLOAT64_C(   971.88),
+       INT64_C(                972) },
+    { SIMDE_FLOAT64_C(   254.61),
+       INT64_C(                255) },
+    { SIMDE_FLOAT64_C(   969.50),
+       INT64_C(                970) },
+    { SIMDE_FLOAT64_C(  -827.17),
+      -INT64_C(                827) },
+    { SIMDE_FLOAT64_C(   438.20),
+       INT64_C(                439) },
+    { SIMDE_FLOAT64_C(   242.50),
+       INT64_C(                243) },
+    { SIMDE_FLOAT64_C(   369.79),
+       INT64_C(                370) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r = simde_vcvtpd_s64_f64(test_vec[i].a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtpd_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    uint64_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      {            SIMDE_MATH_NAN,
+        UINT64_C(                   0) },
+      { SIMDE_FLOAT64_C(100000000000000000000.0),
+                            UINT64_MAX },
+      { SIMDE_FLOAT64_C(-100000000000000000000.0),
+        UINT64_C(                   0) },
+      {       SIMDE_MATH_INFINITY,
+                            UINT64_MAX },
+    #endif
+    { SIMDE_FLOAT64_C(   798.50),
+      UINT64_C(                 799) },
+    { SIMDE_FLOAT64_C(   799.21),
+      UINT64_C(                 800) },
+    { SIMDE_FLOAT64_C(    22.56),
+      UINT64_C(                  23) },
+    { SIMDE_FLOAT64_C(    40.50),
+      UINT64_C(                  41) },
+    { SIMDE_FLOAT64_C(   737.10),
+      UINT64_C(                 738) },
+    { SIMDE_FLOAT64_C(    68.92),
+      UINT64_C(                  69) },
+    { SIMDE_FLOAT64_C(    49.50),
+      UINT64_C(                  50) },
+    { SIMDE_FLOAT64_C(   271.04),
+      UINT64_C(                 272) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_vcvtpd_u64_f64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtp_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    int32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        {  INT32_C(         0),    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        {  INT32_C(2147483520),    INT32_MIN } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -467.50), SIMDE_FLOAT32_C(  -253.26) },
+      { -INT32_C(       467), -INT32_C(       253) } },
+    { { SIMDE_FLOAT32_C(  -885.66), SIMDE_FLOAT32_C(   238.84) },
+      { -INT32_C(       885),  INT32_C(       239) } },
+    { { SIMDE_FLOAT32_C(  -539.50), SIMDE_FLOAT32_C(  -108.45) },
+      { -INT32_C(       539), -INT32_C(       108) } },
+    { { SIMDE_FLOAT32_C(  -218.62), SIMDE_FLOAT32_C(    92.64) },
+      { -INT32_C(       218),  INT32_C(        93) } },
+    { { SIMDE_FLOAT32_C(   319.50), SIMDE_FLOAT32_C(  -539.67) },
+      {  INT32_C(       320), -INT32_C(       539) } },
+    { { SIMDE_FLOAT32_C(  -975.26), SIMDE_FLOAT32_C(   318.49) },
+      { -INT32_C(       975),  INT32_C(       319) } },
+    { { SIMDE_FLOAT32_C(  -566.50), SIMDE_FLOAT32_C(   768.02) },
+      { -INT32_C(       566),  INT32_C(       769) } },
+    { { SIMDE_FLOAT32_C(   693.11), SIMDE_FLOAT32_C(   480.49) },
+      {  INT32_C(       694),  INT32_C(       481) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_int32x2_t r = simde_vcvtp_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtp_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0) },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0) },
+        { UINT32_C(2147483648),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0) },
+        { UINT32_C(2147483520), UINT32_C(         0) } },
+      { { SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   169.50), SIMDE_FLOAT32_C(   929.97) },
+      { UINT32_C(       170), UINT32_C(       930) } },
+    { { SIMDE_FLOAT32_C(   111.18), SIMDE_FLOAT32_C(   972.53) },
+      { UINT32_C(       112), UINT32_C(       973) } },
+    { { SIMDE_FLOAT32_C(   128.50), SIMDE_FLOAT32_C(   990.83) },
+      { UINT32_C(       129), UINT32_C(       991) } },
+    { { SIMDE_FLOAT32_C(   372.60), SIMDE_FLOAT32_C(    46.22) },
+      { UINT32_C(       373), UINT32_C(        47) } },
+    { { SIMDE_FLOAT32_C(    37.50), SIMDE_FLOAT32_C(   819.22) },
+      { UINT32_C(        38), UINT32_C(       820) } },
+    { { SIMDE_FLOAT32_C(   866.50), SIMDE_FLOAT32_C(   747.68) },
+      { UINT32_C(       867), UINT32_C(       748) } },
+    { { SIMDE_FLOAT32_C(    27.50), SIMDE_FLOAT32_C(    38.13) },
+      { UINT32_C(        28), UINT32_C(        39) } },
+    { { SIMDE_FLOAT32_C(   485.94), SIMDE_FLOAT32_C(   436.04) },
+      { UINT32_C(       486), UINT32_C(       437) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vcvtp_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtpq_s32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    int32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        {  INT32_C(         0),    INT32_MAX,    INT32_MIN,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        {    INT32_MAX,    INT32_MAX,    INT32_MAX,    INT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        {  INT32_C(2147483520),    INT32_MIN,  INT32_C(         0),    INT32_MIN } },
+    #endif
+    { { SIMDE_FLOAT32_C(   317.50), SIMDE_FLOAT32_C(   165.57), SIMDE_FLOAT32_C(    -9.50), SIMDE_FLOAT32_C(   966.98) },
+      {  INT32_C(       318),  INT32_C(       166), -INT32_C(         9),  INT32_C(       967) } },
+    { { SIMDE_FLOAT32_C(   135.10), SIMDE_FLOAT32_C(   441.64), SIMDE_FLOAT32_C(   594.45), SIMDE_FLOAT32_C(    78.61) },
+      {  INT32_C(       136),  INT32_C(       442),  INT32_C(       595),  INT32_C(        79) } },
+    { { SIMDE_FLOAT32_C(   276.50), SIMDE_FLOAT32_C(   259.31), SIMDE_FLOAT32_C(  -399.50), SIMDE_FLOAT32_C(   127.26) },
+      {  INT32_C(       277),  INT32_C(       260), -INT32_C(       399),  INT32_C(       128) } },
+    { { SIMDE_FLOAT32_C(  -209.41), SIMDE_FLOAT32_C(  -526.41), SIMDE_FLOAT32_C(   389.40), SIMDE_FLOAT32_C(   931.66) },
+      { -INT32_C(       209), -INT32_C(       526),  INT32_C(       390),  INT32_C(       932) } },
+    { { SIMDE_FLOAT32_C(   403.50), SIMDE_FLOAT32_C(  -822.32), SIMDE_FLOAT32_C(  -596.50), SIMDE_FLOAT32_C(    93.05) },
+      {  INT32_C(       404), -INT32_C(       822), -INT32_C(       596),  INT32_C(        94) } },
+    { { SIMDE_FLOAT32_C(   761.56), SIMDE_FLOAT32_C(  -752.57), SIMDE_FLOAT32_C(  -931.85), SIMDE_FLOAT32_C(  -831.38) },
+      {  INT32_C(       762), -INT32_C(       752), -INT32_C(       931), -INT32_C(       831) } },
+    { { SIMDE_FLOAT32_C(  -100.50), SIMDE_FLOAT32_C(  -402.64), SIMDE_FLOAT32_C(  -783.50), SIMDE_FLOAT32_C(  -191.29) },
+      { -INT32_C(       100), -INT32_C(       402), -INT32_C(       783), -INT32_C(       191) } },
+    { { SIMDE_FLOAT32_C(   485.87), SIMDE_FLOAT32_C(   423.55), SIMDE_FLOAT32_C(   592.97), SIMDE_FLOAT32_C(   -36.58) },
+      {  INT32_C(       486),  INT32_C(       424),  INT32_C(       593), -INT32_C(        36) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_int32x4_t r = simde_vcvtpq_s32_f32(a);
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtpq_u32_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(10000000000.0), SIMDE_FLOAT32_C(-10000000000.0),      SIMDE_MATH_INFINITYF },
+        { UINT32_C(         0),           UINT32_MAX, UINT32_C(         0),           UINT32_MAX } },
+      { { SIMDE_FLOAT32_C(2147483648.0), SIMDE_FLOAT32_C(4294967296.0), SIMDE_FLOAT32_C(3000000000.0), SIMDE_FLOAT32_C(4294967040.0) },
+        { UINT32_C(2147483648),           UINT32_MAX, UINT32_C(3000000000), UINT32_C(4294967040) } },
+      { { SIMDE_FLOAT32_C(2147483520.0), SIMDE_FLOAT32_C(-2147483648.0), SIMDE_MATH_NANF, SIMDE_FLOAT32_C(-4294967296.0) },
+        { UINT32_C(2147483520), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   925.50), SIMDE_FLOAT32_C(   170.14), SIMDE_FLOAT32_C(    57.50), SIMDE_FLOAT32_C(   885.94) },
+      { UINT32_C(       926), UINT32_C(       171), UINT32_C(        58), UINT32_C(       886) } },
+    { { SIMDE_FLOAT32_C(   283.98), SIMDE_FLOAT32_C(    15.92), SIMDE_FLOAT32_C(   111.76), SIMDE_FLOAT32_C(   293.39) },
+      { UINT32_C(       284), UINT32_C(        16), UINT32_C(       112), UINT32_C(       294) } },
+    { { SIMDE_FLOAT32_C(   709.50), SIMDE_FLOAT32_C(   366.89), SIMDE_FLOAT32_C(   368.50), SIMDE_FLOAT32_C(   261.19) },
+      { UINT32_C(       710), UINT32_C(       367), UINT32_C(       369), UINT32_C(       262) } },
+    { { SIMDE_FLOAT32_C(   492.84), SIMDE_FLOAT32_C(   141.83), SIMDE_FLOAT32_C(   787.26), SIMDE_FLOAT32_C(   342.80) },
+      { UINT32_C(       493), UINT32_C(       142), UINT32_C(       788), UINT32_C(       343) } },
+    { { SIMDE_FLOAT32_C(    86.50), SIMDE_FLOAT32_C(    28.75), SIMDE_FLOAT32_C(   291.50), SIMDE_FLOAT32_C(   403.60) },
+      { UINT32_C(        87), UINT32_C(        29), UINT32_C(       292), UINT32_C(       404) } },
+    { { SIMDE_FLOAT32_C(   196.63), SIMDE_FLOAT32_C(    95.96), SIMDE_FLOAT32_C(   804.86), SIMDE_FLOAT32_C(    32.76) },
+      { UINT32_C(       197), UINT32_C(        96), UINT32_C(       805), UINT32_C(        33) } },
+    { { SIMDE_FLOAT32_C(   268.50), SIMDE_FLOAT32_C(   793.54), SIMDE_FLOAT32_C(   665.50), SIMDE_FLOAT32_C(   820.89) },
+      { UINT32_C(       269), UINT32_C(       794), UINT32_C(       666), UINT32_C(       821) } },
+    { { SIMDE_FLOAT32_C(   324.60), SIMDE_FLOAT32_C(    24.29), SIMDE_FLOAT32_C(    49.47), SIMDE_FLOAT32_C(   623.44) },
+      { UINT32_C(       325), UINT32_C(        25), UINT32_C(        50), UINT32_C(       624) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vcvtpq_u32_f32(a);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtpq_s64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    int64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        {  INT64_C(                  0),            INT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        {            INT64_MIN,            INT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(     6.50), SIMDE_FLOAT64_C(   306.92) },
+      {  INT64_C(                  7),  INT64_C(                307) } },
+    { { SIMDE_FLOAT64_C(   660.05), SIMDE_FLOAT64_C(   776.09) },
+      {  INT64_C(                661),  INT64_C(                777) } },
+    { { SIMDE_FLOAT64_C(  -491.50), SIMDE_FLOAT64_C(   667.70) },
+      { -INT64_C(                491),  INT64_C(                668) } },
+    { { SIMDE_FLOAT64_C(  -742.93), SIMDE_FLOAT64_C(  -728.19) },
+      { -INT64_C(                742), -INT64_C(                728) } },
+    { { SIMDE_FLOAT64_C(   780.50), SIMDE_FLOAT64_C(   528.33) },
+      {  INT64_C(                781),  INT64_C(                529) } },
+    { { SIMDE_FLOAT64_C(   481.70), SIMDE_FLOAT64_C(     8.55) },
+      {  INT64_C(                482),  INT64_C(                  9) } },
+    { { SIMDE_FLOAT64_C(   888.50), SIMDE_FLOAT64_C(  -671.36) },
+      {  INT64_C(                889), -INT64_C(                671) } },
+    { { SIMDE_FLOAT64_C(   467.02), SIMDE_FLOAT64_C(   302.21) },
+      {  INT64_C(                468),  INT64_C(                303) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_int64x2_t r = simde_vcvtpq_s64_f64(a);
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vcvtpq_u64_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_CONVERSION_RANGE)
+      { {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(100000000000000000000.0) },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+      { { SIMDE_FLOAT64_C(-100000000000000000000.0),       SIMDE_MATH_INFINITY },
+        { UINT64_C(                   0),                     UINT64_MAX } },
+    #endif
+    { { SIMDE_FLOAT64_C(   986.50), SIMDE_FLOAT64_C(   320.19) },
+      { UINT64_C(                 987), UINT64_C(                 321) } },
+    { { SIMDE_FLOAT64_C(   639.90), SIMDE_FLOAT64_C(   723.46) },
+      { UINT64_C(                 640), UINT64_C(                 724) } },
+    { { SIMDE_FLOAT64_C(   633.50), SIMDE_FLOAT64_C(   146.23) },
+      { UINT64_C(                 634), UINT64_C(                 147) } },
+    { { SIMDE_FLOAT64_C(    67.83), SIMDE_FLOAT64_C(   871.66) },
+      { UINT64_C(                  68), UINT64_C(                 872) } },
+    { { SIMDE_FLOAT64_C(   148.50), SIMDE_FLOAT64_C(   326.48) },
+      { UINT64_C(                 149), UINT64_C(                 327) } },
+    { { SIMDE_FLOAT64_C(   585.58), SIMDE_FLOAT64_C(   333.00) },
+      { UINT64_C(                 586), UINT64_C(                 333) } },
+    { { SIMDE_FLOAT64_C(   993.50), SIMDE_FLOAT64_C(   421.66) },
+      { UINT64_C(                 994), UINT64_C(                 422) } },
+    { { SIMDE_FLOAT64_C(   197.42), SIMDE_FLOAT64_C(   726.44) },
+      { UINT64_C(                 198), UINT64_C(                 727) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_uint64x2_t r = simde_vcvtpq_u64_f64(a);
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtps_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtps_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpd_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpd_u64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtp_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtp_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_s32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_u32_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_s64_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vcvtpq_u64_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,342 @@
+#define SIMDE_TEST_ARM_NEON_INSN div
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/div.h"
+
+static int
+test_simde_vdivh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(   376.50),
+      SIMDE_FLOAT16_VALUE(   -67.69),
+      SIMDE_FLOAT16_VALUE(   -5.562) },
+    { SIMDE_FLOAT16_VALUE(   641.50),
+      SIMDE_FLOAT16_VALUE(    -7.88),
+      SIMDE_FLOAT16_VALUE(   -81.44) },
+    { SIMDE_FLOAT16_VALUE(  -779.00),
+      SIMDE_FLOAT16_VALUE(   -89.88),
+      SIMDE_FLOAT16_VALUE(    8.664) },
+    { SIMDE_FLOAT16_VALUE(  -564.50),
+      SIMDE_FLOAT16_VALUE(    22.25),
+      SIMDE_FLOAT16_VALUE(   -25.38) },
+    { SIMDE_FLOAT16_VALUE(  -831.50),
+      SIMDE_FLOAT16_VALUE(   -86.12),
+      SIMDE_FLOAT16_VALUE(     9.66) },
+    { SIMDE_FLOAT16_VALUE(  -482.50),
+      SIMDE_FLOAT16_VALUE(   -92.69),
+      SIMDE_FLOAT16_VALUE(    5.207) },
+    { SIMDE_FLOAT16_VALUE(  -555.50),
+      SIMDE_FLOAT16_VALUE(   -63.94),
+      SIMDE_FLOAT16_VALUE(     8.69) },
+    { SIMDE_FLOAT16_VALUE(  -936.00),
+      SIMDE_FLOAT16_VALUE(   -86.50),
+      SIMDE_FLOAT16_VALUE(    10.82) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vdivh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vdiv_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -880.00), SIMDE_FLOAT16_VALUE(  -989.00), SIMDE_FLOAT16_VALUE(  -883.00), SIMDE_FLOAT16_VALUE(   950.50) },
+      { SIMDE_FLOAT16_VALUE(    49.59), SIMDE_FLOAT16_VALUE(    13.02), SIMDE_FLOAT16_VALUE(   -13.34), SIMDE_FLOAT16_VALUE(   -13.86) },
+      { SIMDE_FLOAT16_VALUE(   -17.75), SIMDE_FLOAT16_VALUE(   -75.94), SIMDE_FLOAT16_VALUE(    66.19), SIMDE_FLOAT16_VALUE(   -68.56) } },
+    { { SIMDE_FLOAT16_VALUE(  -735.00), SIMDE_FLOAT16_VALUE(  -331.25), SIMDE_FLOAT16_VALUE(  -574.00), SIMDE_FLOAT16_VALUE(   211.62) },
+      { SIMDE_FLOAT16_VALUE(   -62.97), SIMDE_FLOAT16_VALUE(    29.84), SIMDE_FLOAT16_VALUE(   -64.00), SIMDE_FLOAT16_VALUE(    25.17) },
+      { SIMDE_FLOAT16_VALUE(    11.67), SIMDE_FLOAT16_VALUE(   -11.10), SIMDE_FLOAT16_VALUE(     8.97), SIMDE_FLOAT16_VALUE(     8.41) } },
+    { { SIMDE_FLOAT16_VALUE(   576.50), SIMDE_FLOAT16_VALUE(  -131.25), SIMDE_FLOAT16_VALUE(   410.75), SIMDE_FLOAT16_VALUE(    92.88) },
+      { SIMDE_FLOAT16_VALUE(    27.12), SIMDE_FLOAT16_VALUE(     9.55), SIMDE_FLOAT16_VALUE(    32.91), SIMDE_FLOAT16_VALUE(    97.75) },
+      { SIMDE_FLOAT16_VALUE(    21.25), SIMDE_FLOAT16_VALUE(   -13.75), SIMDE_FLOAT16_VALUE(   12.484), SIMDE_FLOAT16_VALUE(     0.95) } },
+    { { SIMDE_FLOAT16_VALUE(  -514.50), SIMDE_FLOAT16_VALUE(   796.00), SIMDE_FLOAT16_VALUE(   738.50), SIMDE_FLOAT16_VALUE(   481.50) },
+      { SIMDE_FLOAT16_VALUE(    93.56), SIMDE_FLOAT16_VALUE(   -38.56), SIMDE_FLOAT16_VALUE(   -11.50), SIMDE_FLOAT16_VALUE(    33.50) },
+      { SIMDE_FLOAT16_VALUE(    -5.50), SIMDE_FLOAT16_VALUE(   -20.64), SIMDE_FLOAT16_VALUE(   -64.19), SIMDE_FLOAT16_VALUE(   14.375) } },
+    { { SIMDE_FLOAT16_VALUE(   531.00), SIMDE_FLOAT16_VALUE(  -263.50), SIMDE_FLOAT16_VALUE(   757.00), SIMDE_FLOAT16_VALUE(  -738.50) },
+      { SIMDE_FLOAT16_VALUE(    98.31), SIMDE_FLOAT16_VALUE(   -56.84), SIMDE_FLOAT16_VALUE(    87.12), SIMDE_FLOAT16_VALUE(   -86.88) },
+      { SIMDE_FLOAT16_VALUE(    5.402), SIMDE_FLOAT16_VALUE(    4.637), SIMDE_FLOAT16_VALUE(     8.69), SIMDE_FLOAT16_VALUE(     8.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -863.00), SIMDE_FLOAT16_VALUE(  -242.88), SIMDE_FLOAT16_VALUE(  -577.50), SIMDE_FLOAT16_VALUE(  -564.50) },
+      { SIMDE_FLOAT16_VALUE(    65.44), SIMDE_FLOAT16_VALUE(   -20.12), SIMDE_FLOAT16_VALUE(    68.19), SIMDE_FLOAT16_VALUE(   -66.56) },
+      { SIMDE_FLOAT16_VALUE(   -13.19), SIMDE_FLOAT16_VALUE(    12.07), SIMDE_FLOAT16_VALUE(    -8.47), SIMDE_FLOAT16_VALUE(    8.484) } },
+    { { SIMDE_FLOAT16_VALUE(  -840.50), SIMDE_FLOAT16_VALUE(    83.62), SIMDE_FLOAT16_VALUE(  -205.25), SIMDE_FLOAT16_VALUE(   119.69) },
+      { SIMDE_FLOAT16_VALUE(    10.78), SIMDE_FLOAT16_VALUE(    33.25), SIMDE_FLOAT16_VALUE(   -69.25), SIMDE_FLOAT16_VALUE(   -43.44) },
+      { SIMDE_FLOAT16_VALUE(   -77.94), SIMDE_FLOAT16_VALUE(    2.516), SIMDE_FLOAT16_VALUE(    2.965), SIMDE_FLOAT16_VALUE(   -2.756) } },
+    { { SIMDE_FLOAT16_VALUE(  -232.12), SIMDE_FLOAT16_VALUE(  -235.00), SIMDE_FLOAT16_VALUE(   805.50), SIMDE_FLOAT16_VALUE(  -404.25) },
+      { SIMDE_FLOAT16_VALUE(     7.21), SIMDE_FLOAT16_VALUE(   -42.94), SIMDE_FLOAT16_VALUE(   -11.91), SIMDE_FLOAT16_VALUE(   -31.47) },
+      { SIMDE_FLOAT16_VALUE(   -32.19), SIMDE_FLOAT16_VALUE(    5.473), SIMDE_FLOAT16_VALUE(   -67.62), SIMDE_FLOAT16_VALUE(    12.84) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vdiv_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vdiv_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    96.32), SIMDE_FLOAT32_C(  -736.22) },
+      { SIMDE_FLOAT32_C(   423.09), SIMDE_FLOAT32_C(  -395.50) },
+      { SIMDE_FLOAT32_C(     0.23), SIMDE_FLOAT32_C(     1.86) } },
+    { { SIMDE_FLOAT32_C(   876.65), SIMDE_FLOAT32_C(  -614.56) },
+      { SIMDE_FLOAT32_C(   523.97), SIMDE_FLOAT32_C(  -668.72) },
+      { SIMDE_FLOAT32_C(     1.67), SIMDE_FLOAT32_C(     0.92) } },
+    { { SIMDE_FLOAT32_C(   932.17), SIMDE_FLOAT32_C(   747.22) },
+      { SIMDE_FLOAT32_C(  -784.96), SIMDE_FLOAT32_C(   298.63) },
+      { SIMDE_FLOAT32_C(    -1.19), SIMDE_FLOAT32_C(     2.50) } },
+    { { SIMDE_FLOAT32_C(  -563.90), SIMDE_FLOAT32_C(    23.20) },
+      { SIMDE_FLOAT32_C(   700.62), SIMDE_FLOAT32_C(  -690.17) },
+      { SIMDE_FLOAT32_C(    -0.80), SIMDE_FLOAT32_C(    -0.03) } },
+    { { SIMDE_FLOAT32_C(  -565.79), SIMDE_FLOAT32_C(  -853.36) },
+      { SIMDE_FLOAT32_C(  -872.99), SIMDE_FLOAT32_C(    -2.23) },
+      { SIMDE_FLOAT32_C(     0.65), SIMDE_FLOAT32_C(   382.67) } },
+    { { SIMDE_FLOAT32_C(  -673.93), SIMDE_FLOAT32_C(  -742.32) },
+      { SIMDE_FLOAT32_C(   396.29), SIMDE_FLOAT32_C(  -416.49) },
+      { SIMDE_FLOAT32_C(    -1.70), SIMDE_FLOAT32_C(     1.78) } },
+    { { SIMDE_FLOAT32_C(  -321.82), SIMDE_FLOAT32_C(  -324.50) },
+      { SIMDE_FLOAT32_C(   683.24), SIMDE_FLOAT32_C(  -456.17) },
+      { SIMDE_FLOAT32_C(    -0.47), SIMDE_FLOAT32_C(     0.71) } },
+    { { SIMDE_FLOAT32_C(   296.11), SIMDE_FLOAT32_C(   871.56) },
+      { SIMDE_FLOAT32_C(   142.28), SIMDE_FLOAT32_C(  -434.18) },
+      { SIMDE_FLOAT32_C(     2.08), SIMDE_FLOAT32_C(    -2.01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vdiv_f32(a, b);
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vdiv_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -723.63) },
+      { SIMDE_FLOAT64_C(   305.58) },
+      { SIMDE_FLOAT64_C(    -2.37) } },
+    { { SIMDE_FLOAT64_C(  -648.77) },
+      { SIMDE_FLOAT64_C(  -196.50) },
+      { SIMDE_FLOAT64_C(     3.30) } },
+    { { SIMDE_FLOAT64_C(   630.36) },
+      { SIMDE_FLOAT64_C(   565.04) },
+      { SIMDE_FLOAT64_C(     1.12) } },
+    { { SIMDE_FLOAT64_C(  -445.49) },
+      { SIMDE_FLOAT64_C(  -267.30) },
+      { SIMDE_FLOAT64_C(     1.67) } },
+    { { SIMDE_FLOAT64_C(  -421.96) },
+      { SIMDE_FLOAT64_C(  -417.25) },
+      { SIMDE_FLOAT64_C(     1.01) } },
+    { { SIMDE_FLOAT64_C(    -6.10) },
+      { SIMDE_FLOAT64_C(  -767.11) },
+      { SIMDE_FLOAT64_C(     0.01) } },
+    { { SIMDE_FLOAT64_C(  -769.80) },
+      { SIMDE_FLOAT64_C(  -706.19) },
+      { SIMDE_FLOAT64_C(     1.09) } },
+    { { SIMDE_FLOAT64_C(  -340.07) },
+      { SIMDE_FLOAT64_C(    69.95) },
+      { SIMDE_FLOAT64_C(    -4.86) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vdiv_f64(a, b);
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vdivq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   743.50), SIMDE_FLOAT16_VALUE(   280.75), SIMDE_FLOAT16_VALUE(   595.50), SIMDE_FLOAT16_VALUE(  -789.00),
+          SIMDE_FLOAT16_VALUE(   723.50), SIMDE_FLOAT16_VALUE(   533.50), SIMDE_FLOAT16_VALUE(    35.94), SIMDE_FLOAT16_VALUE(   590.00) },
+      { SIMDE_FLOAT16_VALUE(    64.25), SIMDE_FLOAT16_VALUE(    19.77), SIMDE_FLOAT16_VALUE(    31.62), SIMDE_FLOAT16_VALUE(   -27.58),
+          SIMDE_FLOAT16_VALUE(    80.81), SIMDE_FLOAT16_VALUE(     5.79), SIMDE_FLOAT16_VALUE(    48.28), SIMDE_FLOAT16_VALUE(   -80.75) },
+      { SIMDE_FLOAT16_VALUE(    11.57), SIMDE_FLOAT16_VALUE(    14.20), SIMDE_FLOAT16_VALUE(    18.83), SIMDE_FLOAT16_VALUE(    28.61),
+          SIMDE_FLOAT16_VALUE(     8.95), SIMDE_FLOAT16_VALUE(    92.19), SIMDE_FLOAT16_VALUE(    0.744), SIMDE_FLOAT16_VALUE(   -7.305) } },
+    { { SIMDE_FLOAT16_VALUE(  -487.50), SIMDE_FLOAT16_VALUE(  -810.00), SIMDE_FLOAT16_VALUE(  -913.00), SIMDE_FLOAT16_VALUE(   637.50),
+          SIMDE_FLOAT16_VALUE(   216.50), SIMDE_FLOAT16_VALUE(   262.50), SIMDE_FLOAT16_VALUE(   294.00), SIMDE_FLOAT16_VALUE(    63.19) },
+      { SIMDE_FLOAT16_VALUE(    58.41), SIMDE_FLOAT16_VALUE(    -5.41), SIMDE_FLOAT16_VALUE(   -58.28), SIMDE_FLOAT16_VALUE(    44.09),
+          SIMDE_FLOAT16_VALUE(   -39.78), SIMDE_FLOAT16_VALUE(   -93.38), SIMDE_FLOAT16_VALUE(     6.41), SIMDE_FLOAT16_VALUE(    47.59) },
+      { SIMDE_FLOAT16_VALUE(    -8.34), SIMDE_FLOAT16_VALUE(   149.75), SIMDE_FLOAT16_VALUE(   15.664), SIMDE_FLOAT16_VALUE(    14.46),
+          SIMDE_FLOAT16_VALUE(    -5.44), SIMDE_FLOAT16_VALUE(    -2.81), SIMDE_FLOAT16_VALUE(    45.88), SIMDE_FLOAT16_VALUE(    1.328) } },
+    { { SIMDE_FLOAT16_VALUE(  -822.50), SIMDE_FLOAT16_VALUE(   378.75), SIMDE_FLOAT16_VALUE(  -486.75), SIMDE_FLOAT16_VALUE(   328.25),
+          SIMDE_FLOAT16_VALUE(   733.50), SIMDE_FLOAT16_VALUE(   596.00), SIMDE_FLOAT16_VALUE(  -713.00), SIMDE_FLOAT16_VALUE(  -548.00) },
+      { SIMDE_FLOAT16_VALUE(    82.88), SIMDE_FLOAT16_VALUE(   -33.31), SIMDE_FLOAT16_VALUE(   -61.28), SIMDE_FLOAT16_VALUE(   -84.75),
+          SIMDE_FLOAT16_VALUE(     6.69), SIMDE_FLOAT16_VALUE(    97.44), SIMDE_FLOAT16_VALUE(    92.38), SIMDE_FLOAT16_VALUE(     1.03) },
+      { SIMDE_FLOAT16_VALUE(    -9.92), SIMDE_FLOAT16_VALUE(   -11.37), SIMDE_FLOAT16_VALUE(     7.94), SIMDE_FLOAT16_VALUE(   -3.873),
+          SIMDE_FLOAT16_VALUE(   109.62), SIMDE_FLOAT16_VALUE(    6.117), SIMDE_FLOAT16_VALUE(    -7.72), SIMDE_FLOAT16_VALUE(  -532.00) } },
+    { { SIMDE_FLOAT16_VALUE(   181.00), SIMDE_FLOAT16_VALUE(  -421.75), SIMDE_FLOAT16_VALUE(   690.00), SIMDE_FLOAT16_VALUE(  -590.50),
+          SIMDE_FLOAT16_VALUE(   -48.16), SIMDE_FLOAT16_VALUE(    89.06), SIMDE_FLOAT16_VALUE(  -856.00), SIMDE_FLOAT16_VALUE(   574.00) },
+      { SIMDE_FLOAT16_VALUE(    -9.88), SIMDE_FLOAT16_VALUE(   -84.75), SIMDE_FLOAT16_VALUE(   -98.00), SIMDE_FLOAT16_VALUE(   -64.44),
+          SIMDE_FLOAT16_VALUE(    71.19), SIMDE_FLOAT16_VALUE(    62.50), SIMDE_FLOAT16_VALUE(    14.38), SIMDE_FLOAT16_VALUE(    86.00) },
+      { SIMDE_FLOAT16_VALUE(   -18.31), SIMDE_FLOAT16_VALUE(    4.977), SIMDE_FLOAT16_VALUE(    -7.04), SIMDE_FLOAT16_VALUE(    9.164),
+          SIMDE_FLOAT16_VALUE(  -0.6763), SIMDE_FLOAT16_VALUE(    1.425), SIMDE_FLOAT16_VALUE(   -59.50), SIMDE_FLOAT16_VALUE(    6.676) } },
+    { { SIMDE_FLOAT16_VALUE(    63.06), SIMDE_FLOAT16_VALUE(   630.00), SIMDE_FLOAT16_VALUE(   243.38), SIMDE_FLOAT16_VALUE(  -389.00),
+          SIMDE_FLOAT16_VALUE(  -910.50), SIMDE_FLOAT16_VALUE(  -224.12), SIMDE_FLOAT16_VALUE(  -188.62), SIMDE_FLOAT16_VALUE(  -210.38) },
+      { SIMDE_FLOAT16_VALUE(    85.56), SIMDE_FLOAT16_VALUE(   -63.94), SIMDE_FLOAT16_VALUE(    58.72), SIMDE_FLOAT16_VALUE(    91.75),
+          SIMDE_FLOAT16_VALUE(   -19.98), SIMDE_FLOAT16_VALUE(    81.19), SIMDE_FLOAT16_VALUE(    51.12), SIMDE_FLOAT16_VALUE(    33.28) },
+      { SIMDE_FLOAT16_VALUE(    0.737), SIMDE_FLOAT16_VALUE(    -9.85), SIMDE_FLOAT16_VALUE(    4.145), SIMDE_FLOAT16_VALUE(    -4.24),
+          SIMDE_FLOAT16_VALUE(    45.56), SIMDE_FLOAT16_VALUE(    -2.76), SIMDE_FLOAT16_VALUE(    -3.69), SIMDE_FLOAT16_VALUE(    -6.32) } },
+    { { SIMDE_FLOAT16_VALUE(   -91.31), SIMDE_FLOAT16_VALUE(   127.44), SIMDE_FLOAT16_VALUE(  -331.25), SIMDE_FLOAT16_VALUE(   424.25),
+          SIMDE_FLOAT16_VALUE(  -321.25), SIMDE_FLOAT16_VALUE(  -679.50), SIMDE_FLOAT16_VALUE(  -989.50), SIMDE_FLOAT16_VALUE(   432.50) },
+      { SIMDE_FLOAT16_VALUE(    94.25), SIMDE_FLOAT16_VALUE(     7.44), SIMDE_FLOAT16_VALUE(    95.62), SIMDE_FLOAT16_VALUE(   -80.50),
+          SIMDE_FLOAT16_VALUE(    11.28), SIMDE_FLOAT16_VALUE(    52.44), SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(   -79.69) },
+      { SIMDE_FLOAT16_VALUE(  -0.9688), SIMDE_FLOAT16_VALUE(    17.12), SIMDE_FLOAT16_VALUE(   -3.465), SIMDE_FLOAT16_VALUE(    -5.27),
+          SIMDE_FLOAT16_VALUE(   -28.47), SIMDE_FLOAT16_VALUE(   -12.96), SIMDE_FLOAT16_VALUE(   15.445), SIMDE_FLOAT16_VALUE(   -5.426) } },
+    { { SIMDE_FLOAT16_VALUE(    69.75), SIMDE_FLOAT16_VALUE(  -529.00), SIMDE_FLOAT16_VALUE(   -76.50), SIMDE_FLOAT16_VALUE(  -155.25),
+          SIMDE_FLOAT16_VALUE(  -131.12), SIMDE_FLOAT16_VALUE(   447.75), SIMDE_FLOAT16_VALUE(  -110.25), SIMDE_FLOAT16_VALUE(  -840.00) },
+      { SIMDE_FLOAT16_VALUE(    21.25), SIMDE_FLOAT16_VALUE(    63.59), SIMDE_FLOAT16_VALUE(   -68.62), SIMDE_FLOAT16_VALUE(    64.75),
+          SIMDE_FLOAT16_VALUE(   -94.88), SIMDE_FLOAT16_VALUE(    -6.69), SIMDE_FLOAT16_VALUE(    20.66), SIMDE_FLOAT16_VALUE(    11.11) },
+      { SIMDE_FLOAT16_VALUE(    3.283), SIMDE_FLOAT16_VALUE(    -8.32), SIMDE_FLOAT16_VALUE(    1.115), SIMDE_FLOAT16_VALUE(   -2.398),
+          SIMDE_FLOAT16_VALUE(    1.382), SIMDE_FLOAT16_VALUE(   -66.94), SIMDE_FLOAT16_VALUE(   -5.336), SIMDE_FLOAT16_VALUE(   -75.62) } },
+    { { SIMDE_FLOAT16_VALUE(  -725.00), SIMDE_FLOAT16_VALUE(  -899.00), SIMDE_FLOAT16_VALUE(  -256.75), SIMDE_FLOAT16_VALUE(  -593.50),
+          SIMDE_FLOAT16_VALUE(   225.75), SIMDE_FLOAT16_VALUE(  -100.75), SIMDE_FLOAT16_VALUE(   879.50), SIMDE_FLOAT16_VALUE(  -861.50) },
+      { SIMDE_FLOAT16_VALUE(    33.53), SIMDE_FLOAT16_VALUE(   -56.22), SIMDE_FLOAT16_VALUE(   -90.88), SIMDE_FLOAT16_VALUE(   -55.19),
+          SIMDE_FLOAT16_VALUE(   -23.75), SIMDE_FLOAT16_VALUE(    -4.56), SIMDE_FLOAT16_VALUE(   -32.06), SIMDE_FLOAT16_VALUE(   -79.88) },
+      { SIMDE_FLOAT16_VALUE(   -21.62), SIMDE_FLOAT16_VALUE(    15.99), SIMDE_FLOAT16_VALUE(    2.826), SIMDE_FLOAT16_VALUE(    10.76),
+          SIMDE_FLOAT16_VALUE(    -9.51), SIMDE_FLOAT16_VALUE(    22.09), SIMDE_FLOAT16_VALUE(   -27.44), SIMDE_FLOAT16_VALUE(    10.79) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vdivq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vdivq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -361.46), SIMDE_FLOAT32_C(  -139.23), SIMDE_FLOAT32_C(   547.61), SIMDE_FLOAT32_C(   563.16) },
+      { SIMDE_FLOAT32_C(  -155.39), SIMDE_FLOAT32_C(   772.87), SIMDE_FLOAT32_C(  -998.49), SIMDE_FLOAT32_C(   164.54) },
+      { SIMDE_FLOAT32_C(     2.33), SIMDE_FLOAT32_C(    -0.18), SIMDE_FLOAT32_C(    -0.55), SIMDE_FLOAT32_C(     3.42) } },
+    { { SIMDE_FLOAT32_C(   367.36), SIMDE_FLOAT32_C(  -189.06), SIMDE_FLOAT32_C(  -144.34), SIMDE_FLOAT32_C(  -482.50) },
+      { SIMDE_FLOAT32_C(   532.35), SIMDE_FLOAT32_C(  -614.46), SIMDE_FLOAT32_C(   128.54), SIMDE_FLOAT32_C(   430.88) },
+      { SIMDE_FLOAT32_C(     0.69), SIMDE_FLOAT32_C(     0.31), SIMDE_FLOAT32_C(    -1.12), SIMDE_FLOAT32_C(    -1.12) } },
+    { { SIMDE_FLOAT32_C(   657.66), SIMDE_FLOAT32_C(   856.00), SIMDE_FLOAT32_C(  -670.94), SIMDE_FLOAT32_C(  -689.69) },
+      { SIMDE_FLOAT32_C(  -445.81), SIMDE_FLOAT32_C(   653.47), SIMDE_FLOAT32_C(   161.76), SIMDE_FLOAT32_C(   466.09) },
+      { SIMDE_FLOAT32_C(    -1.48), SIMDE_FLOAT32_C(     1.31), SIMDE_FLOAT32_C(    -4.15), SIMDE_FLOAT32_C(    -1.48) } },
+    { { SIMDE_FLOAT32_C(  -130.47), SIMDE_FLOAT32_C(    55.53), SIMDE_FLOAT32_C(   958.35), SIMDE_FLOAT32_C(  -216.50) },
+      { SIMDE_FLOAT32_C(  -140.94), SIMDE_FLOAT32_C(   311.08), SIMDE_FLOAT32_C(   727.76), SIMDE_FLOAT32_C(   806.75) },
+      { SIMDE_FLOAT32_C(     0.93), SIMDE_FLOAT32_C(     0.18), SIMDE_FLOAT32_C(     1.32), SIMDE_FLOAT32_C(    -0.27) } },
+    { { SIMDE_FLOAT32_C(    58.98), SIMDE_FLOAT32_C(  -917.23), SIMDE_FLOAT32_C(  -810.84), SIMDE_FLOAT32_C(  -944.67) },
+      { SIMDE_FLOAT32_C(  -994.20), SIMDE_FLOAT32_C(   285.63), SIMDE_FLOAT32_C(  -264.54), SIMDE_FLOAT32_C(  -817.98) },
+      { SIMDE_FLOAT32_C(    -0.06), SIMDE_FLOAT32_C(    -3.21), SIMDE_FLOAT32_C(     3.07), SIMDE_FLOAT32_C(     1.15) } },
+    { { SIMDE_FLOAT32_C(   615.09), SIMDE_FLOAT32_C(   201.74), SIMDE_FLOAT32_C(    20.28), SIMDE_FLOAT32_C(   681.03) },
+      { SIMDE_FLOAT32_C(  -806.86), SIMDE_FLOAT32_C(   -99.08), SIMDE_FLOAT32_C(   169.26), SIMDE_FLOAT32_C(   -34.51) },
+      { SIMDE_FLOAT32_C(    -0.76), SIMDE_FLOAT32_C(    -2.04), SIMDE_FLOAT32_C(     0.12), SIMDE_FLOAT32_C(   -19.73) } },
+    { { SIMDE_FLOAT32_C(  -566.46), SIMDE_FLOAT32_C(   555.44), SIMDE_FLOAT32_C(   714.80), SIMDE_FLOAT32_C(   990.00) },
+      { SIMDE_FLOAT32_C(   207.06), SIMDE_FLOAT32_C(  -604.47), SIMDE_FLOAT32_C(  -514.60), SIMDE_FLOAT32_C(  -936.12) },
+      { SIMDE_FLOAT32_C(    -2.74), SIMDE_FLOAT32_C(    -0.92), SIMDE_FLOAT32_C(    -1.39), SIMDE_FLOAT32_C(    -1.06) } },
+    { { SIMDE_FLOAT32_C(   969.49), SIMDE_FLOAT32_C(  -148.85), SIMDE_FLOAT32_C(  -455.85), SIMDE_FLOAT32_C(  -960.09) },
+      { SIMDE_FLOAT32_C(  -371.50), SIMDE_FLOAT32_C(   946.78), SIMDE_FLOAT32_C(   332.20), SIMDE_FLOAT32_C(  -827.78) },
+      { SIMDE_FLOAT32_C(    -2.61), SIMDE_FLOAT32_C(    -0.16), SIMDE_FLOAT32_C(    -1.37), SIMDE_FLOAT32_C(     1.16) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vdivq_f32(a, b);
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vdivq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -538.58), SIMDE_FLOAT64_C(   878.22) },
+      { SIMDE_FLOAT64_C(  -363.33), SIMDE_FLOAT64_C(   537.05) },
+      { SIMDE_FLOAT64_C(     1.48), SIMDE_FLOAT64_C(     1.64) } },
+    { { SIMDE_FLOAT64_C(   303.31), SIMDE_FLOAT64_C(  -860.27) },
+      { SIMDE_FLOAT64_C(   745.97), SIMDE_FLOAT64_C(   682.66) },
+      { SIMDE_FLOAT64_C(     0.41), SIMDE_FLOAT64_C(    -1.26) } },
+    { { SIMDE_FLOAT64_C(   856.22), SIMDE_FLOAT64_C(  -788.16) },
+      { SIMDE_FLOAT64_C(  -524.75), SIMDE_FLOAT64_C(  -356.33) },
+      { SIMDE_FLOAT64_C(    -1.63), SIMDE_FLOAT64_C(     2.21) } },
+    { { SIMDE_FLOAT64_C(   640.06), SIMDE_FLOAT64_C(   130.47) },
+      { SIMDE_FLOAT64_C(   934.84), SIMDE_FLOAT64_C(   553.69) },
+      { SIMDE_FLOAT64_C(     0.68), SIMDE_FLOAT64_C(     0.24) } },
+    { { SIMDE_FLOAT64_C(  -854.73), SIMDE_FLOAT64_C(   181.58) },
+      { SIMDE_FLOAT64_C(  -826.22), SIMDE_FLOAT64_C(   642.36) },
+      { SIMDE_FLOAT64_C(     1.03), SIMDE_FLOAT64_C(     0.28) } },
+    { { SIMDE_FLOAT64_C(  -977.99), SIMDE_FLOAT64_C(  -443.61) },
+      { SIMDE_FLOAT64_C(   233.54), SIMDE_FLOAT64_C(   660.59) },
+      { SIMDE_FLOAT64_C(    -4.19), SIMDE_FLOAT64_C(    -0.67) } },
+    { { SIMDE_FLOAT64_C(  -754.85), SIMDE_FLOAT64_C(   650.85) },
+      { SIMDE_FLOAT64_C(  -808.02), SIMDE_FLOAT64_C(  -241.43) },
+      { SIMDE_FLOAT64_C(     0.93), SIMDE_FLOAT64_C(    -2.70) } },
+    { { SIMDE_FLOAT64_C(   545.26), SIMDE_FLOAT64_C(   -89.60) },
+      { SIMDE_FLOAT64_C(   355.33), SIMDE_FLOAT64_C(   -65.43) },
+      { SIMDE_FLOAT64_C(     1.53), SIMDE_FLOAT64_C(     1.37) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vdivq_f64(a, b);
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vdivh_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vdiv_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vdiv_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vdiv_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vdivq_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vdivq_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vdivq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
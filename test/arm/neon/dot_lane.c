@@ -53,7 +53,32 @@ test_simde_vdot_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(  15),  INT8_C( 102), -INT8_C(  87), -INT8_C(  82), -INT8_C(  25),  INT8_C(   2), -INT8_C(  83),  INT8_C(  44) },
       { -INT8_C( 126), -INT8_C(   8),  INT8_C( 102), -INT8_C( 110), -INT8_C(  38), -INT8_C( 110), -INT8_C(  37),  INT8_C(  63) },
        INT32_C(           1),
-      { -INT32_C(  1129356027), -INT32_C(   335885026) } }
+      { -INT32_C(  1129356027), -INT32_C(   335885026) } },
+    { {  INT32_C(         0),  INT32_C(         0) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           0),
+      {  INT32_C(     65536),  INT32_C(     65536) } },
+    { {            INT32_MAX,            INT32_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           1),
+      {  INT32_C(2147418623),  INT32_C(2147418623) } },
+    { {            INT32_MAX,            INT32_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           0),
+      { -INT32_C(2147419133), -INT32_C(2147419133) } },
+    { {            INT32_MIN,            INT32_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           1),
+      { -INT32_C(2147483392), -INT32_C(2147483392) } },
+    { { -INT32_C(         1), -INT32_C(         1) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+       INT32_C(           0),
+      {  INT32_C(         1),  INT32_C(         1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -136,7 +161,32 @@ test_simde_vdot_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT8_C( 74), UINT8_C( 41), UINT8_C( 45), UINT8_C( 32), UINT8_C( 51), UINT8_C(210), UINT8_C( 31), UINT8_C(121) },
       { UINT8_C( 43), UINT8_C(183), UINT8_C(118), UINT8_C(219), UINT8_C(214), UINT8_C(181), UINT8_C(  3), UINT8_C(179) },
        INT32_C(           1),
-      { UINT32_C(2567213761), UINT32_C(2808973981) } }
+      { UINT32_C(2567213761), UINT32_C(2808973981) } },
+    { { UINT32_C(         0), UINT32_C(         0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(    260100), UINT32_C(    260100) } },
+    { {           UINT32_MAX,           UINT32_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           1),
+      { UINT32_C(    260099), UINT32_C(    260099) } },
+    { { UINT32_C(2147483648), UINT32_C(2147483648) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+       INT32_C(           0),
+      { UINT32_C(2147549184), UINT32_C(2147549184) } },
+    { { UINT32_C(         1), UINT32_C(         1) },
+      { UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           1),
+      { UINT32_C(    130051), UINT32_C(    130051) } },
+    { { UINT32_C(         0), UINT32_C(         0) },
+      { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(         0), UINT32_C(         0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -227,7 +277,37 @@ test_simde_vdot_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(  77), -INT8_C(  36),  INT8_C(  13),  INT8_C(  72),  INT8_C(  70),  INT8_C(   1),  INT8_C(  62), -INT8_C( 126),
         -INT8_C(  31), -INT8_C( 122), -INT8_C(  36), -INT8_C(  20),  INT8_C(  72), -INT8_C(  60), -INT8_C(  63),  INT8_C(  78) },
        INT32_C(           3),
-      {  INT32_C(  1879968158), -INT32_C(  1538726071) } }
+      {  INT32_C(  1879968158), -INT32_C(  1538726071) } },
+    { {  INT32_C(         0),  INT32_C(         0) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           0),
+      {  INT32_C(     65536),  INT32_C(     65536) } },
+    { {            INT32_MAX,            INT32_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           1),
+      {  INT32_C(2147418623),  INT32_C(2147418623) } },
+    { {            INT32_MAX,            INT32_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           2),
+      { -INT32_C(2147419133), -INT32_C(2147419133) } },
+    { {            INT32_MIN,            INT32_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           3),
+      { -INT32_C(2147483392), -INT32_C(2147483392) } },
+    { { -INT32_C(         1), -INT32_C(         1) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+             INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+       INT32_C(           0),
+      {  INT32_C(         1),  INT32_C(         1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -318,7 +398,37 @@ test_simde_vdot_laneq_u32 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT8_C(162), UINT8_C(129), UINT8_C(126), UINT8_C(  4), UINT8_C( 80), UINT8_C(163), UINT8_C( 27), UINT8_C( 97),
         UINT8_C(165), UINT8_C( 98), UINT8_C(209), UINT8_C(107), UINT8_C(233), UINT8_C(166), UINT8_C(118), UINT8_C(125) },
        INT32_C(           3),
-      { UINT32_C(2373077493), UINT32_C( 438873164) } }
+      { UINT32_C(2373077493), UINT32_C( 438873164) } },
+    { { UINT32_C(         0), UINT32_C(         0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(    260100), UINT32_C(    260100) } },
+    { {           UINT32_MAX,           UINT32_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           1),
+      { UINT32_C(    260099), UINT32_C(    260099) } },
+    { { UINT32_C(2147483648), UINT32_C(2147483648) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128),
+        UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+       INT32_C(           2),
+      { UINT32_C(2147549184), UINT32_C(2147549184) } },
+    { { UINT32_C(         1), UINT32_C(         1) },
+      { UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           3),
+      { UINT32_C(    130051), UINT32_C(    130051) } },
+    { { UINT32_C(         0), UINT32_C(         0) },
+      { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(         0), UINT32_C(         0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -417,7 +527,42 @@ test_simde_vdotq_laneq_u32 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT8_C( 83), UINT8_C( 20), UINT8_C(240), UINT8_C( 10), UINT8_C(156), UINT8_C(135), UINT8_C(146), UINT8_C(183),
         UINT8_C( 86), UINT8_C(127), UINT8_C(159), UINT8_C( 54), UINT8_C(232), UINT8_C( 54), UINT8_C(113), UINT8_C( 50) },
        INT32_C(           3),
-      { UINT32_C( 838465420), UINT32_C(2291664916), UINT32_C(3907965454), UINT32_C( 999748105) } }
+      { UINT32_C( 838465420), UINT32_C(2291664916), UINT32_C(3907965454), UINT32_C( 999748105) } },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(    260100), UINT32_C(    260100), UINT32_C(    260100), UINT32_C(    260100) } },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           1),
+      { UINT32_C(    260099), UINT32_C(    260099), UINT32_C(    260099), UINT32_C(    260099) } },
+    { { UINT32_C(2147483648), UINT32_C(2147483648), UINT32_C(2147483648), UINT32_C(2147483648) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128),
+        UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128),
+        UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+       INT32_C(           2),
+      { UINT32_C(2147549184), UINT32_C(2147549184), UINT32_C(2147549184), UINT32_C(2147549184) } },
+    { { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127),
+        UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           3),
+      { UINT32_C(    130051), UINT32_C(    130051), UINT32_C(    130051), UINT32_C(    130051) } },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) },
+      { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0),
+        UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -516,7 +661,42 @@ test_simde_vdotq_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(   0), -INT8_C(   2),  INT8_C(  87), -INT8_C(  99),  INT8_C(  95), -INT8_C(  23), -INT8_C(  36), -INT8_C(  55),
         -INT8_C(  88), -INT8_C( 113),  INT8_C( 110),  INT8_C(  83), -INT8_C(  59), -INT8_C(  69), -INT8_C( 123), -INT8_C(  69) },
        INT32_C(           3),
-      {  INT32_C(   185529600),  INT32_C(  1066481720), -INT32_C(  1514938438),  INT32_C(   843910897) } }
+      {  INT32_C(   185529600),  INT32_C(  1066481720), -INT32_C(  1514938438),  INT32_C(   843910897) } },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),  INT32_C(         0) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           0),
+      {  INT32_C(     65536),  INT32_C(     65536),  INT32_C(     65536),  INT32_C(     65536) } },
+    { {            INT32_MAX,            INT32_MAX,            INT32_MAX,            INT32_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           1),
+      {  INT32_C(2147418623),  INT32_C(2147418623),  INT32_C(2147418623),  INT32_C(2147418623) } },
+    { {            INT32_MAX,            INT32_MAX,            INT32_MAX,            INT32_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           2),
+      { -INT32_C(2147419133), -INT32_C(2147419133), -INT32_C(2147419133), -INT32_C(2147419133) } },
+    { {            INT32_MIN,            INT32_MIN,            INT32_MIN,            INT32_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+             INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           3),
+      { -INT32_C(2147483392), -INT32_C(2147483392), -INT32_C(2147483392), -INT32_C(2147483392) } },
+    { { -INT32_C(         1), -INT32_C(         1), -INT32_C(         1), -INT32_C(         1) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+             INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+       INT32_C(           0),
+      {  INT32_C(         1),  INT32_C(         1),  INT32_C(         1),  INT32_C(         1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -607,7 +787,37 @@ test_simde_vdotq_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
         UINT8_C( 75), UINT8_C(219), UINT8_C(  5), UINT8_C( 18), UINT8_C(251), UINT8_C( 22), UINT8_C( 33), UINT8_C(  1) },
       { UINT8_C(222), UINT8_C( 94), UINT8_C(147), UINT8_C(172), UINT8_C(141), UINT8_C(221), UINT8_C(148), UINT8_C( 92) },
        INT32_C(           1),
-      { UINT32_C(2453574681), UINT32_C(3897260713), UINT32_C(3831956873), UINT32_C(1439653402) } }
+      { UINT32_C(2453574681), UINT32_C(3897260713), UINT32_C(3831956873), UINT32_C(1439653402) } },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(    260100), UINT32_C(    260100), UINT32_C(    260100), UINT32_C(    260100) } },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           1),
+      { UINT32_C(    260099), UINT32_C(    260099), UINT32_C(    260099), UINT32_C(    260099) } },
+    { { UINT32_C(2147483648), UINT32_C(2147483648), UINT32_C(2147483648), UINT32_C(2147483648) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128),
+        UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+      { UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128), UINT8_C( 128) },
+       INT32_C(           0),
+      { UINT32_C(2147549184), UINT32_C(2147549184), UINT32_C(2147549184), UINT32_C(2147549184) } },
+    { { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127),
+        UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127), UINT8_C( 128), UINT8_C( 127) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           1),
+      { UINT32_C(    130051), UINT32_C(    130051), UINT32_C(    130051), UINT32_C(    130051) } },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) },
+      { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0),
+        UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+       INT32_C(           0),
+      { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -698,7 +908,37 @@ test_simde_vdotq_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
          INT8_C(  94),  INT8_C( 115),  INT8_C(  98), -INT8_C(  49), -INT8_C( 116), -INT8_C(   3), -INT8_C(  64),  INT8_C(  21) },
       {  INT8_C( 102),  INT8_C( 112),  INT8_C( 110),  INT8_C(  55), -INT8_C( 125), -INT8_C(   2), -INT8_C( 126),  INT8_C(  13) },
        INT32_C(           1),
-      {  INT32_C(  1504732968),  INT32_C(  1250937139), -INT32_C(   253265659),  INT32_C(  1292092502) } }
+      {  INT32_C(  1504732968),  INT32_C(  1250937139), -INT32_C(   253265659),  INT32_C(  1292092502) } },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),  INT32_C(         0) },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           0),
+      {  INT32_C(     65536),  INT32_C(     65536),  INT32_C(     65536),  INT32_C(     65536) } },
+    { {            INT32_MAX,            INT32_MAX,            INT32_MAX,            INT32_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           1),
+      {  INT32_C(2147418623),  INT32_C(2147418623),  INT32_C(2147418623),  INT32_C(2147418623) } },
+    { {            INT32_MAX,            INT32_MAX,            INT32_MAX,            INT32_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+      {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+       INT32_C(           0),
+      { -INT32_C(2147419133), -INT32_C(2147419133), -INT32_C(2147419133), -INT32_C(2147419133) } },
+    { {            INT32_MIN,            INT32_MIN,            INT32_MIN,            INT32_MIN },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+             INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+      {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+       INT32_C(           1),
+      { -INT32_C(2147483392), -INT32_C(2147483392), -INT32_C(2147483392), -INT32_C(2147483392) } },
+    { { -INT32_C(         1), -INT32_C(         1), -INT32_C(         1), -INT32_C(         1) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+       INT32_C(           0),
+      {  INT32_C(         1),  INT32_C(         1),  INT32_C(         1),  INT32_C(         1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -0,0 +1,513 @@
+#define SIMDE_TEST_ARM_NEON_INSN eor3
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/eor3.h"
+
+static int
+test_simde_veor3q_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t c[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  71), -INT8_C( 116),  INT8_C(  12), -INT8_C(   3), -INT8_C(  14), -INT8_C(  57), -INT8_C(  76), -INT8_C(  84),
+         INT8_C(  88), -INT8_C( 112), -INT8_C( 113), -INT8_C(  81), -INT8_C(  17), -INT8_C(   9), -INT8_C( 115), -INT8_C(  27) },
+      {  INT8_C(  86), -INT8_C(  16),  INT8_C( 101),  INT8_C(  14), -INT8_C( 125), -INT8_C(  47),  INT8_C(  88),  INT8_C(  46),
+         INT8_C(  14), -INT8_C(  49), -INT8_C(  18),  INT8_C(  44), -INT8_C(  76), -INT8_C(  81),  INT8_C(  66), -INT8_C(  79) },
+      {  INT8_C(  55),  INT8_C(  48),  INT8_C(   7), -INT8_C( 106),  INT8_C( 107), -INT8_C(  65),  INT8_C(  65), -INT8_C(  88),
+         INT8_C(  22),  INT8_C(  57), -INT8_C(  30), -INT8_C(  93), -INT8_C( 105), -INT8_C(  12),  INT8_C(  20), -INT8_C(  88) },
+      { -INT8_C(  40),  INT8_C(  76),  INT8_C( 110),  INT8_C( 101),  INT8_C(  26), -INT8_C(  87), -INT8_C(  83),  INT8_C(  42),
+         INT8_C(  64),  INT8_C( 102), -INT8_C( 125),  INT8_C(  32), -INT8_C(  52), -INT8_C(  84), -INT8_C(  37), -INT8_C(   4) } },
+    { { -INT8_C(   9), -INT8_C(  77),  INT8_C(  66),  INT8_C(  14),  INT8_C( 104),  INT8_C(  58), -INT8_C(  45),  INT8_C(  61),
+         INT8_C(  53), -INT8_C(  21),  INT8_C(   8), -INT8_C(  92), -INT8_C(  41), -INT8_C(   3), -INT8_C(  45),  INT8_C( 108) },
+      {  INT8_C(  66),  INT8_C(  10), -INT8_C(  16),  INT8_C(  38), -INT8_C( 100), -INT8_C(  11), -INT8_C( 112),  INT8_C(  33),
+         INT8_C(  77),  INT8_C(   9), -INT8_C(  95), -INT8_C(  20),  INT8_C(  33), -INT8_C(  20),      INT8_MAX,  INT8_C(  74) },
+      {  INT8_C( 106), -INT8_C(  55),  INT8_C(   7), -INT8_C(  57), -INT8_C(   2),  INT8_C(   6),  INT8_C(  91),  INT8_C(  76),
+         INT8_C(  57), -INT8_C(  16), -INT8_C(  58),  INT8_C( 124), -INT8_C(  82), -INT8_C( 104), -INT8_C(  72), -INT8_C(  50) },
+      { -INT8_C(  33),  INT8_C( 112), -INT8_C(  75), -INT8_C(  17),  INT8_C(  10), -INT8_C(  55),  INT8_C(  24),  INT8_C(  80),
+         INT8_C(  65),  INT8_C(  18),  INT8_C( 111),  INT8_C(  52),  INT8_C(  88), -INT8_C( 119),  INT8_C(  20), -INT8_C(  24) } },
+    { { -INT8_C(  47),  INT8_C(  88), -INT8_C(  96),  INT8_C(  69),  INT8_C(  67),  INT8_C( 111),  INT8_C(   0), -INT8_C( 123),
+        -INT8_C(  70),  INT8_C(   8),  INT8_C(  46), -INT8_C(  71),  INT8_C(  22),  INT8_C(  94), -INT8_C(  48),  INT8_C( 104) },
+      { -INT8_C( 127),  INT8_C(   6), -INT8_C(  37), -INT8_C(  74),  INT8_C(  24), -INT8_C(  27), -INT8_C(  50),  INT8_C(  63),
+        -INT8_C(  46),      INT8_MIN,  INT8_C(  37),  INT8_C( 122), -INT8_C( 119), -INT8_C(  71),  INT8_C(  57),  INT8_C(  29) },
+      { -INT8_C(   6), -INT8_C(  99), -INT8_C(   5), -INT8_C(  88), -INT8_C(  85),  INT8_C( 120), -INT8_C(  93), -INT8_C(  64),
+        -INT8_C(  63),  INT8_C( 115), -INT8_C(  44),  INT8_C(   7),  INT8_C(  88), -INT8_C(  20), -INT8_C(  26),  INT8_C(  31) },
+      { -INT8_C(  86), -INT8_C(  61),      INT8_MIN,  INT8_C(  91), -INT8_C(  16), -INT8_C(  14),  INT8_C( 109),  INT8_C( 122),
+        -INT8_C(  87), -INT8_C(   5), -INT8_C(  33), -INT8_C(  60), -INT8_C(  57),  INT8_C(  11),  INT8_C(  15),  INT8_C( 106) } },
+    { {  INT8_C(  76),  INT8_C(  63),  INT8_C(  96),  INT8_C( 103), -INT8_C(  67), -INT8_C(   2), -INT8_C(  13), -INT8_C(  96),
+         INT8_C(  45), -INT8_C( 118), -INT8_C(  11), -INT8_C(  16), -INT8_C( 125), -INT8_C(  92), -INT8_C(  98), -INT8_C(  11) },
+      { -INT8_C(  94), -INT8_C( 112),  INT8_C(  41), -INT8_C(  92), -INT8_C(   7),  INT8_C(  14),  INT8_C( 120), -INT8_C(  19),
+        -INT8_C(  61),  INT8_C( 114), -INT8_C(   4),  INT8_C( 114),  INT8_C(  80), -INT8_C(  31), -INT8_C(  80), -INT8_C(  79) },
+      {  INT8_C(  92),  INT8_C(  53),  INT8_C(  88),  INT8_C(  82),  INT8_C( 111), -INT8_C( 101), -INT8_C(  78), -INT8_C(  97),
+         INT8_C(  78),  INT8_C(  45), -INT8_C(  73), -INT8_C(   1), -INT8_C(  30), -INT8_C(  31),  INT8_C( 101), -INT8_C(  57) },
+      { -INT8_C(  78), -INT8_C( 102),  INT8_C(  17), -INT8_C( 111),  INT8_C(  43),  INT8_C( 107),  INT8_C(  57), -INT8_C(  46),
+        -INT8_C(  96), -INT8_C(  43), -INT8_C(  66),  INT8_C( 125),  INT8_C(  49), -INT8_C(  92),  INT8_C(  75), -INT8_C( 125) } },
+    { {  INT8_C(  88), -INT8_C(  35),  INT8_C(  14),  INT8_C( 108), -INT8_C(   1), -INT8_C(  90),  INT8_C(  98), -INT8_C(  78),
+        -INT8_C( 103), -INT8_C( 121), -INT8_C(  81), -INT8_C(   7), -INT8_C(  43),  INT8_C(  80),  INT8_C( 120),  INT8_C( 118) },
+      { -INT8_C(  19),  INT8_C(  77), -INT8_C(  98), -INT8_C(  44),  INT8_C(  66), -INT8_C( 127),  INT8_C(  71),  INT8_C(   7),
+         INT8_C( 104),  INT8_C(  18),  INT8_C(  88),  INT8_C( 121), -INT8_C(  49), -INT8_C(  31),  INT8_C(  23), -INT8_C(  17) },
+      { -INT8_C(  99), -INT8_C(  97),  INT8_C(  32), -INT8_C(  99), -INT8_C( 103),  INT8_C( 116), -INT8_C(  48), -INT8_C(  99),
+        -INT8_C(  87), -INT8_C(  33), -INT8_C(  93), -INT8_C(  94), -INT8_C(   8),  INT8_C(  78), -INT8_C(  67), -INT8_C(   2) },
+      {  INT8_C(  40),  INT8_C(  15), -INT8_C(  80),  INT8_C(  37),  INT8_C(  36),  INT8_C(  83), -INT8_C(  11),  INT8_C(  40),
+         INT8_C(  88),  INT8_C(  74),  INT8_C(  84),  INT8_C(  34), -INT8_C(  30), -INT8_C(   1), -INT8_C(  46),  INT8_C( 103) } },
+    { { -INT8_C( 108), -INT8_C(  87),  INT8_C(  86),  INT8_C(  33),  INT8_C(   5), -INT8_C(  24),  INT8_C(  32), -INT8_C(   6),
+         INT8_C(   7),  INT8_C(  74), -INT8_C(  61),  INT8_C(  25),  INT8_C( 106),  INT8_C(  33), -INT8_C(  91), -INT8_C( 124) },
+      {  INT8_C( 106), -INT8_C(  77), -INT8_C(  91), -INT8_C(  19),  INT8_C(   7), -INT8_C(  61),  INT8_C(  50), -INT8_C(  93),
+        -INT8_C(   3),  INT8_C(  61),  INT8_C(  17), -INT8_C(  48),  INT8_C(  96),  INT8_C(  26), -INT8_C( 124),  INT8_C(  25) },
+      { -INT8_C(  75), -INT8_C(  60),  INT8_C(   7), -INT8_C(  69), -INT8_C(  74), -INT8_C(  49),  INT8_C(  11),  INT8_C(  16),
+        -INT8_C(  21),  INT8_C(  47), -INT8_C(  24),  INT8_C(   7),  INT8_C( 122),  INT8_C(   0), -INT8_C( 102), -INT8_C(  81) },
+      {  INT8_C(  75), -INT8_C(  34), -INT8_C(  12),  INT8_C( 119), -INT8_C(  76), -INT8_C(  28),  INT8_C(  25),  INT8_C(  73),
+         INT8_C(  17),  INT8_C(  88),  INT8_C(  58), -INT8_C(  50),  INT8_C( 112),  INT8_C(  59), -INT8_C(  69),  INT8_C(  50) } },
+    { {  INT8_C(  88),  INT8_C(  13), -INT8_C( 106), -INT8_C( 127),  INT8_C(  42), -INT8_C(  62),  INT8_C(   6), -INT8_C(  46),
+         INT8_C(  98),  INT8_C(  90), -INT8_C( 124), -INT8_C(  71), -INT8_C(  90), -INT8_C(  52), -INT8_C( 110),  INT8_C(  61) },
+      { -INT8_C(  53),  INT8_C(  92), -INT8_C(  63), -INT8_C( 107),  INT8_C(  29),  INT8_C(  58), -INT8_C( 108),  INT8_C(  55),
+        -INT8_C(  21), -INT8_C(   1), -INT8_C(  76),  INT8_C(  53),  INT8_C(  80), -INT8_C(  49), -INT8_C(   7), -INT8_C(  45) },
+      { -INT8_C(  38),  INT8_C(  83), -INT8_C( 116), -INT8_C(  37),  INT8_C(  42),  INT8_C(  82), -INT8_C(   1),  INT8_C(   8),
+        -INT8_C(  47), -INT8_C(  73),  INT8_C(  67), -INT8_C( 109),  INT8_C( 112), -INT8_C(  15), -INT8_C(  26),  INT8_C( 107) },
+      {  INT8_C(  73),  INT8_C(   2), -INT8_C(  37), -INT8_C(  49),  INT8_C(  29), -INT8_C(  86),  INT8_C( 109), -INT8_C(  19),
+         INT8_C(  88),  INT8_C(  18),  INT8_C( 115),  INT8_C(  31), -INT8_C( 122), -INT8_C(  14), -INT8_C( 115), -INT8_C( 123) } },
+    { {  INT8_C(  51),  INT8_C(  28), -INT8_C(  12), -INT8_C(  14), -INT8_C( 116), -INT8_C(  30),  INT8_C(  76),  INT8_C(  40),
+         INT8_C(  14), -INT8_C(  93),  INT8_C(  14),  INT8_C(  51),  INT8_C(  76),  INT8_C(  41), -INT8_C( 114), -INT8_C(  69) },
+      {  INT8_C(   5), -INT8_C(  37),  INT8_C(   7), -INT8_C( 109), -INT8_C(  73),  INT8_C(  94),  INT8_C(  48),  INT8_C(  32),
+         INT8_C(  95), -INT8_C(  69),  INT8_C(  69), -INT8_C(  31),  INT8_C(   2), -INT8_C( 106),  INT8_C(  95),      INT8_MIN },
+      { -INT8_C(  28),  INT8_C(  58),  INT8_C(  92), -INT8_C(  93),  INT8_C(  41),  INT8_C(  32), -INT8_C(  65),  INT8_C(  25),
+         INT8_C(  30),  INT8_C(  81),  INT8_C(  39),  INT8_C(  78),  INT8_C(  23), -INT8_C(  63), -INT8_C(  30),  INT8_C(  87) },
+      { -INT8_C(  46), -INT8_C(   3), -INT8_C(  81), -INT8_C(  62),  INT8_C(  18), -INT8_C( 100), -INT8_C(  61),  INT8_C(  17),
+         INT8_C(  79),  INT8_C(  73),  INT8_C( 108), -INT8_C( 100),  INT8_C(  89),  INT8_C( 126),  INT8_C(  51),  INT8_C( 108) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int8x16_t c = simde_vld1q_s8(test_vec[i].c);
+    simde_int8x16_t r = simde_veor3q_s8(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i8x16(r, simde_vld1q_s8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_veor3q_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t c[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 16927), -INT16_C(  9958),  INT16_C(  6678),  INT16_C( 20457), -INT16_C( 32715),  INT16_C(  7061),  INT16_C(  4838), -INT16_C(  5219) },
+      {  INT16_C( 23578),  INT16_C(  9469),  INT16_C( 28178),  INT16_C( 25137),  INT16_C( 25186), -INT16_C(  4758),  INT16_C( 29253), -INT16_C( 10527) },
+      { -INT16_C( 21654),  INT16_C(  4428),  INT16_C( 11165), -INT16_C( 20528), -INT16_C(  1984),  INT16_C(  7919), -INT16_C(  3324), -INT16_C(  6668) },
+      { -INT16_C( 19089), -INT16_C(  4949),  INT16_C( 24473), -INT16_C( 32248),  INT16_C(  6679), -INT16_C(  6128), -INT16_C( 27737), -INT16_C( 10104) } },
+    { { -INT16_C( 13455), -INT16_C( 29567), -INT16_C( 26711), -INT16_C(   676),  INT16_C( 29509), -INT16_C( 23223),  INT16_C( 26924),  INT16_C( 21553) },
+      { -INT16_C(  7283),  INT16_C( 17560),  INT16_C( 32031),  INT16_C( 19615), -INT16_C(   789), -INT16_C( 13426), -INT16_C( 32042), -INT16_C( 18798) },
+      {  INT16_C( 22956), -INT16_C(  4085), -INT16_C(  9715),  INT16_C( 28121), -INT16_C( 26186), -INT16_C(   106), -INT16_C( 16862),  INT16_C( 27061) },
+      {  INT16_C( 29008),  INT16_C( 14354),  INT16_C( 12475), -INT16_C(  9190),  INT16_C(  5656), -INT16_C( 28335),  INT16_C( 21976), -INT16_C( 29930) } },
+    { { -INT16_C( 15291),  INT16_C( 28133),  INT16_C(  8820),  INT16_C( 25240),  INT16_C( 23165),  INT16_C( 25678), -INT16_C( 11907),  INT16_C( 29448) },
+      {  INT16_C( 26223),  INT16_C(  1204), -INT16_C(   362),  INT16_C(  3579),  INT16_C( 30749), -INT16_C(  1410),  INT16_C(  3224),  INT16_C( 24886) },
+      { -INT16_C( 22613),  INT16_C(  4682), -INT16_C(  2033),  INT16_C(  2846),  INT16_C( 11252),  INT16_C(  9136), -INT16_C( 22207), -INT16_C( 14632) },
+      {  INT16_C(  1409),  INT16_C( 31515),  INT16_C(  9453),  INT16_C( 25725),  INT16_C(  2452), -INT16_C( 17024),  INT16_C( 29860), -INT16_C( 11034) } },
+    { { -INT16_C( 12999), -INT16_C(  2457),  INT16_C( 17437), -INT16_C( 12740), -INT16_C(  4725), -INT16_C( 24350),  INT16_C( 21609),  INT16_C( 20656) },
+      {  INT16_C( 10601),  INT16_C( 28301),  INT16_C( 21728), -INT16_C( 24607), -INT16_C(  5658),  INT16_C( 22301),  INT16_C( 18281), -INT16_C( 30208) },
+      {  INT16_C( 17089),  INT16_C( 29750), -INT16_C( 31996),  INT16_C( 13337),  INT16_C(  6371),  INT16_C( 18348),  INT16_C( 22153), -INT16_C(  3862) },
+      { -INT16_C( 22895), -INT16_C(  4900), -INT16_C( 27655),  INT16_C( 26052),  INT16_C(  7310), -INT16_C( 20397),  INT16_C( 17801),  INT16_C( 10842) } },
+    { {  INT16_C( 31225), -INT16_C(  4008),  INT16_C(  3006),  INT16_C( 24357),  INT16_C( 30886), -INT16_C( 28964),  INT16_C( 18200),  INT16_C( 11289) },
+      {  INT16_C( 20226), -INT16_C( 11136),  INT16_C( 28493), -INT16_C( 16040), -INT16_C( 29234),  INT16_C( 18877), -INT16_C( 29216), -INT16_C( 21765) },
+      {  INT16_C( 23411), -INT16_C( 14982),  INT16_C( 27747), -INT16_C(  8949), -INT16_C( 26178),  INT16_C(  1331),  INT16_C( 16921),  INT16_C( 10138) },
+      {  INT16_C( 28040), -INT16_C(  7774),  INT16_C(  2192),  INT16_C( 17270),  INT16_C( 27862), -INT16_C( 15790), -INT16_C( 30495), -INT16_C( 24200) } },
+    { { -INT16_C(  5026),  INT16_C( 26830),  INT16_C( 10072),  INT16_C( 11468),  INT16_C( 16924),  INT16_C(  3703),  INT16_C( 22487),  INT16_C(   297) },
+      { -INT16_C( 22033),  INT16_C( 28876), -INT16_C( 30228), -INT16_C( 25942),  INT16_C( 13102), -INT16_C(  3379), -INT16_C( 23775), -INT16_C( 27492) },
+      { -INT16_C( 28701), -INT16_C(   357), -INT16_C(  6638), -INT16_C( 30097), -INT16_C( 12795), -INT16_C(  1502), -INT16_C( 16224),  INT16_C( 29302) },
+      { -INT16_C( 13742), -INT16_C(  6503),  INT16_C( 18598),  INT16_C( 15369), -INT16_C( 16585),  INT16_C(  1688),  INT16_C( 13398), -INT16_C(  6205) } },
+    { { -INT16_C( 17775), -INT16_C(  4199),  INT16_C( 28184),  INT16_C(   818),  INT16_C( 15583), -INT16_C( 10776), -INT16_C( 17756), -INT16_C( 11303) },
+      {  INT16_C(  8000), -INT16_C( 18600), -INT16_C( 29403),  INT16_C(  8120),  INT16_C( 16424),  INT16_C( 19222), -INT16_C(  6773), -INT16_C( 22807) },
+      { -INT16_C(   938), -INT16_C( 19412),  INT16_C(  6761), -INT16_C( 16902), -INT16_C( 27385),  INT16_C( 12740),  INT16_C( 23380),  INT16_C( 15803) },
+      {  INT16_C( 22919), -INT16_C(  4883), -INT16_C(  1708), -INT16_C( 24208), -INT16_C(  5648), -INT16_C( 20678),  INT16_C(  1147),  INT16_C( 18571) } },
+    { { -INT16_C( 23730),  INT16_C( 11957), -INT16_C( 31110),  INT16_C( 22289),  INT16_C( 31483), -INT16_C( 18935),  INT16_C( 24054),  INT16_C( 14704) },
+      {  INT16_C( 27490), -INT16_C( 12716),  INT16_C( 24312), -INT16_C(  9682),  INT16_C(  2632),  INT16_C( 30604),  INT16_C( 28163),  INT16_C( 24323) },
+      {  INT16_C(  2411),  INT16_C(  9477), -INT16_C(   591), -INT16_C( 21409),  INT16_C(  3791),  INT16_C( 26319), -INT16_C(   805),  INT16_C( 28142) },
+      { -INT16_C( 16057), -INT16_C( 14876),  INT16_C(  9523),  INT16_C(  8544),  INT16_C( 32380), -INT16_C( 22710), -INT16_C( 12498),  INT16_C(  2973) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_int16x8_t c = simde_vld1q_s16(test_vec[i].c);
+    simde_int16x8_t r = simde_veor3q_s16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i16x8(r, simde_vld1q_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_veor3q_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t c[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   722363982), -INT32_C(   702671151), -INT32_C(   751558426), -INT32_C(    53472611) },
+      { -INT32_C(  1037868485),  INT32_C(  1632548621),  INT32_C(   239620643), -INT32_C(  1326902542) },
+      { -INT32_C(   401888157),  INT32_C(   909856195), -INT32_C(  2073424395), -INT32_C(   883751451) },
+      {  INT32_C(    19310614), -INT32_C(  2123633633),  INT32_C(  1494646576), -INT32_C(  2023094902) } },
+    { { -INT32_C(  1102495933), -INT32_C(   562552873), -INT32_C(   671056894),  INT32_C(   216416845) },
+      { -INT32_C(   198662570), -INT32_C(   830547929), -INT32_C(  1157330293),  INT32_C(   950408991) },
+      { -INT32_C(   792215546),  INT32_C(   816746248), -INT32_C(  1324821432),  INT32_C(  1024799176) },
+      { -INT32_C(  1700374253),  INT32_C(   547899640), -INT32_C(   770956607),  INT32_C(   156591258) } },
+    { {  INT32_C(   415713066),  INT32_C(  2063777467),  INT32_C(  1428627943), -INT32_C(   875114778) },
+      { -INT32_C(   597511262), -INT32_C(   849254211), -INT32_C(  1603813972),  INT32_C(  1907350373) },
+      {  INT32_C(  1085734114), -INT32_C(   926255535), -INT32_C(    91421782), -INT32_C(   684162787) },
+      { -INT32_C(  2079127446),  INT32_C(  2125045847),  INT32_C(   265134049),  INT32_C(  1833014430) } },
+    { {  INT32_C(  1999297179),  INT32_C(  1553588300), -INT32_C(  1866835741), -INT32_C(    35448239) },
+      {  INT32_C(   800801050), -INT32_C(  1495821101),  INT32_C(  1928979962), -INT32_C(  1081511614) },
+      {  INT32_C(   508602946), -INT32_C(   513772455),  INT32_C(  1754512957), -INT32_C(   305673529) },
+      {  INT32_C(  1187066307),  INT32_C(   455999686), -INT32_C(  1966079196), -INT32_C(  1347575340) } },
+    { {  INT32_C(  1128447275),  INT32_C(   539082954), -INT32_C(  1798786124), -INT32_C(  1117270551) },
+      {  INT32_C(   223304999), -INT32_C(  1475181158), -INT32_C(   392914035), -INT32_C(   129224919) },
+      { -INT32_C(  2007296517),  INT32_C(  1544499151), -INT32_C(  1297856590), -INT32_C(  1536583448) },
+      { -INT32_C(   967379465), -INT32_C(   734238049), -INT32_C(   822579317), -INT32_C(   515737048) } },
+    { { -INT32_C(  1891340209),  INT32_C(  1256830119),  INT32_C(  1809008150), -INT32_C(   261333930) },
+      {  INT32_C(   171719518), -INT32_C(   267323623),  INT32_C(   421064262),  INT32_C(  1672558588) },
+      {  INT32_C(  1007315549),  INT32_C(   445446716), -INT32_C(  2036394767),  INT32_C(  1380493735) },
+      { -INT32_C(  1183702708), -INT32_C(  1602897534), -INT32_C(   195773279), -INT32_C(  1047150067) } },
+    { {  INT32_C(   327478315), -INT32_C(  1395045189), -INT32_C(   952810247),  INT32_C(  1349671772) },
+      {  INT32_C(  2014576898), -INT32_C(   128804364), -INT32_C(   393641922), -INT32_C(  1456746154) },
+      { -INT32_C(    19460393), -INT32_C(  1989870657), -INT32_C(  1769269723), -INT32_C(  1063438846) },
+      { -INT32_C(  1790450690), -INT32_C(   571527440), -INT32_C(  1187523870),  INT32_C(   969194504) } },
+    { {  INT32_C(  1170584442), -INT32_C(   163310339), -INT32_C(  1914678874),  INT32_C(    79196603) },
+      { -INT32_C(  1925812740), -INT32_C(   910407873), -INT32_C(    65662323),  INT32_C(  1285542708) },
+      {  INT32_C(   901010378), -INT32_C(   395176967), -INT32_C(  1660171843),  INT32_C(  1920111286) },
+      { -INT32_C(    45642420), -INT32_C(   678805445), -INT32_C(   318928234),  INT32_C(   978661433) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_int32x4_t c = simde_vld1q_s32(test_vec[i].c);
+    simde_int32x4_t r = simde_veor3q_s32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_veor3q_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t c[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(6126960211339005267),  INT64_C(8858949836297541530) },
+      { -INT64_C(2147458934136946303),  INT64_C(6997334389404010301) },
+      { -INT64_C(7935603300065288567),  INT64_C( 142734973653735711) },
+      {  INT64_C(2804324697643668059),  INT64_C(1878513202504911288) } },
+    { { -INT64_C(9176051350678566960), -INT64_C(2856958942674826222) },
+      {  INT64_C(6817947734069215262),  INT64_C(3643203049516960707) },
+      { -INT64_C(2158806777064237923),  INT64_C(5082898424725219980) },
+      {  INT64_C(4340425582351143763), -INT64_C(6025994373520790179) } },
+    { { -INT64_C(2190898599872135569),  INT64_C(1663535318577539515) },
+      { -INT64_C(1101156046865137424),  INT64_C(7571312658253920996) },
+      {  INT64_C(4103364351110271480), -INT64_C(6375910080963995981) },
+      {  INT64_C(3016744480259780455), -INT64_C(2774054923895388692) } },
+    { {  INT64_C(6488924410338052980),  INT64_C(4785118854645755491) },
+      {  INT64_C( 756611943805255248), -INT64_C(7961231998044745011) },
+      {  INT64_C(9175888713615518619), -INT64_C(7556167584489663328) },
+      {  INT64_C(3448071735361560255),  INT64_C(4958238952748410894) } },
+    { { -INT64_C(1038947357200558162), -INT64_C(8374988426651822497) },
+      { -INT64_C(8188155026698400014), -INT64_C(2308774400163036943) },
+      { -INT64_C(5901908673371664794), -INT64_C(4780846467837204373) },
+      { -INT64_C(3327865644077525190), -INT64_C(1615524546728902971) } },
+    { {  INT64_C(1533978364307515805), -INT64_C( 745792684420716363) },
+      { -INT64_C(7860860456851663053),  INT64_C(6517888790621274529) },
+      { -INT64_C(4847699143808933634),  INT64_C(2918824950036780923) },
+      {  INT64_C(4258390331677187664), -INT64_C(8695352464192127377) } },
+    { {  INT64_C(8736430041264725502), -INT64_C(2724197507871839831) },
+      {  INT64_C(6241218264384177407),  INT64_C(2699507830085457977) },
+      {  INT64_C(5323923762164677024),  INT64_C(1467877589779125228) },
+      {  INT64_C(7368216990050689185), -INT64_C(1505941456422903172) } },
+    { { -INT64_C(6799252020370084349), -INT64_C(3779544982912934310) },
+      { -INT64_C(1558692831653337114),  INT64_C(8193819030371360538) },
+      {  INT64_C(5653714825975856020),  INT64_C(6832617939722470246) },
+      {  INT64_C( 399794260285026929), -INT64_C(1952234630063259098) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+    simde_int64x2_t c = simde_vld1q_s64(test_vec[i].c);
+    simde_int64x2_t r = simde_veor3q_s64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_veor3q_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[16];
+    uint8_t c[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C( 58), UINT8_C(239), UINT8_C( 38), UINT8_C( 72), UINT8_C(115), UINT8_C(203), UINT8_C(187), UINT8_C( 46),
+        UINT8_C(202), UINT8_C(  7), UINT8_C(135), UINT8_C( 63), UINT8_C(232), UINT8_C(188), UINT8_C(134), UINT8_C(195) },
+      { UINT8_C(190), UINT8_C( 55), UINT8_C(119), UINT8_C(241), UINT8_C( 12), UINT8_C(167), UINT8_C(113), UINT8_C( 32),
+        UINT8_C(237), UINT8_C(154), UINT8_C(209), UINT8_C( 59), UINT8_C( 71), UINT8_C( 23), UINT8_C( 19), UINT8_C(155) },
+      { UINT8_C(252), UINT8_C( 59), UINT8_C( 49), UINT8_C(120), UINT8_C( 69), UINT8_C(198), UINT8_C(232), UINT8_C(189),
+        UINT8_C(214), UINT8_C( 79), UINT8_C(212), UINT8_C( 50), UINT8_C(250), UINT8_C(208), UINT8_C(143), UINT8_C( 16) },
+      { UINT8_C(120), UINT8_C(227), UINT8_C( 96), UINT8_C(193), UINT8_C( 58), UINT8_C(170), UINT8_C( 34), UINT8_C(179),
+        UINT8_C(241), UINT8_C(210), UINT8_C(130), UINT8_C( 54), UINT8_C( 85), UINT8_C(123), UINT8_C( 26), UINT8_C( 72) } },
+    { { UINT8_C(189), UINT8_C(111), UINT8_C(227), UINT8_C(227), UINT8_C(120), UINT8_C(185), UINT8_C( 50), UINT8_C(188),
+        UINT8_C(183), UINT8_C( 31), UINT8_C(203), UINT8_C(141), UINT8_C( 97), UINT8_C( 62), UINT8_C(232), UINT8_C( 46) },
+      { UINT8_C(108), UINT8_C( 10), UINT8_C( 25), UINT8_C(170), UINT8_C(124), UINT8_C( 64), UINT8_C(105), UINT8_C( 35),
+        UINT8_C(106), UINT8_C(110), UINT8_C(119), UINT8_C(168), UINT8_C( 75), UINT8_C(  1), UINT8_C(141), UINT8_C( 74) },
+      { UINT8_C( 66), UINT8_C(128), UINT8_C( 89), UINT8_C( 56), UINT8_C( 13), UINT8_C( 67), UINT8_C(  7), UINT8_C(183),
+        UINT8_C(121), UINT8_C(165), UINT8_C(  8), UINT8_C( 89), UINT8_C(135), UINT8_C( 26), UINT8_C( 64), UINT8_C(215) },
+      { UINT8_C(147), UINT8_C(229), UINT8_C(163), UINT8_C(113), UINT8_C(  9), UINT8_C(186), UINT8_C( 92), UINT8_C( 40),
+        UINT8_C(164), UINT8_C(212), UINT8_C(180), UINT8_C(124), UINT8_C(173), UINT8_C( 37), UINT8_C( 37), UINT8_C(179) } },
+    { { UINT8_C( 58), UINT8_C( 32), UINT8_C(243), UINT8_C(229), UINT8_C(185), UINT8_C( 55), UINT8_C(231), UINT8_C(113),
+        UINT8_C( 22), UINT8_C(154), UINT8_C(234), UINT8_C( 15), UINT8_C( 31), UINT8_C(245), UINT8_C(205), UINT8_C(218) },
+      { UINT8_C( 55), UINT8_C(251), UINT8_C(227), UINT8_C( 37), UINT8_C( 41), UINT8_C(164), UINT8_C( 75), UINT8_C( 33),
+        UINT8_C( 64), UINT8_C(140), UINT8_C(166), UINT8_C(195), UINT8_C(150), UINT8_C(232), UINT8_C(220), UINT8_C( 50) },
+      { UINT8_C( 58), UINT8_C(110), UINT8_C(220), UINT8_C(231), UINT8_C(116), UINT8_C(211), UINT8_C(173), UINT8_C(232),
+        UINT8_C(204), UINT8_C(212), UINT8_C( 48), UINT8_C(160), UINT8_C(218), UINT8_C(160), UINT8_C(130), UINT8_C(191) },
+      { UINT8_C( 55), UINT8_C(181), UINT8_C(204), UINT8_C( 39), UINT8_C(228), UINT8_C( 64), UINT8_C(  1), UINT8_C(184),
+        UINT8_C(154), UINT8_C(194), UINT8_C(124), UINT8_C(108), UINT8_C( 83), UINT8_C(189), UINT8_C(147), UINT8_C( 87) } },
+    { { UINT8_C( 78), UINT8_C(242), UINT8_C( 34), UINT8_C( 46), UINT8_C( 43), UINT8_C( 47), UINT8_C(221), UINT8_C( 49),
+        UINT8_C(190), UINT8_C( 66), UINT8_C( 30), UINT8_C(168), UINT8_C( 62), UINT8_C(210), UINT8_C(181), UINT8_C(216) },
+      { UINT8_C( 26), UINT8_C(147), UINT8_C(159), UINT8_C(180), UINT8_C( 53), UINT8_C(108), UINT8_C( 79), UINT8_C(246),
+        UINT8_C(114), UINT8_C( 55), UINT8_C(179), UINT8_C(188), UINT8_C( 58), UINT8_C(142), UINT8_C(115), UINT8_C(219) },
+      { UINT8_C( 13), UINT8_C(136), UINT8_C( 14), UINT8_C( 92), UINT8_C(139), UINT8_C(158), UINT8_C(173), UINT8_C(179),
+        UINT8_C(  3), UINT8_C( 92), UINT8_C( 73), UINT8_C(205), UINT8_C( 35), UINT8_C( 72), UINT8_C( 15), UINT8_C( 46) },
+      { UINT8_C( 89), UINT8_C(233), UINT8_C(179), UINT8_C(198), UINT8_C(149), UINT8_C(221), UINT8_C( 63), UINT8_C(116),
+        UINT8_C(207), UINT8_C( 41), UINT8_C(228), UINT8_C(217), UINT8_C( 39), UINT8_C( 20), UINT8_C(201), UINT8_C( 45) } },
+    { { UINT8_C(110), UINT8_C(192), UINT8_C(214), UINT8_C(232), UINT8_C(174), UINT8_C( 80), UINT8_C(189), UINT8_C(159),
+        UINT8_C(166), UINT8_C( 43), UINT8_C( 26), UINT8_C( 79), UINT8_C( 80), UINT8_C( 25), UINT8_C( 41), UINT8_C(139) },
+      { UINT8_C(226), UINT8_C(217), UINT8_C(248), UINT8_C(226), UINT8_C(212), UINT8_C(139), UINT8_C(110), UINT8_C( 58),
+        UINT8_C(176), UINT8_C(220), UINT8_C( 56), UINT8_C(145), UINT8_C(249), UINT8_C(157), UINT8_C( 23), UINT8_C(112) },
+      { UINT8_C(202), UINT8_C( 28), UINT8_C(  3), UINT8_C(104), UINT8_C(154), UINT8_C(108), UINT8_C( 70), UINT8_C(130),
+        UINT8_C(148), UINT8_C(167), UINT8_C( 61), UINT8_C(  3), UINT8_C(254), UINT8_C(220), UINT8_C( 89), UINT8_C( 66) },
+      { UINT8_C( 70), UINT8_C(  5), UINT8_C( 45), UINT8_C( 98), UINT8_C(224), UINT8_C(183), UINT8_C(149), UINT8_C( 39),
+        UINT8_C(130), UINT8_C( 80), UINT8_C( 31), UINT8_C(221), UINT8_C( 87), UINT8_C( 88), UINT8_C(103), UINT8_C(185) } },
+    { { UINT8_C(194), UINT8_C(117), UINT8_C(181), UINT8_C( 36), UINT8_C(203), UINT8_C( 21), UINT8_C(223), UINT8_C(  9),
+        UINT8_C(235), UINT8_C( 39), UINT8_C(160), UINT8_C(219), UINT8_C(207), UINT8_C(213), UINT8_C(148), UINT8_C( 58) },
+      { UINT8_C(207), UINT8_C( 10), UINT8_C(166), UINT8_C( 87), UINT8_C(235), UINT8_C(185), UINT8_C( 45), UINT8_C(223),
+        UINT8_C( 54), UINT8_C(124), UINT8_C(223), UINT8_C(205), UINT8_C( 40), UINT8_C(202), UINT8_C(158), UINT8_C(173) },
+      { UINT8_C(113), UINT8_C(170), UINT8_C( 86), UINT8_C( 39), UINT8_C( 58), UINT8_C( 99), UINT8_C(178), UINT8_C(179),
+        UINT8_C( 75), UINT8_C(120), UINT8_C( 52), UINT8_C( 74), UINT8_C(131), UINT8_C(101), UINT8_C( 88), UINT8_C( 78) },
+      { UINT8_C(124), UINT8_C(213), UINT8_C( 69), UINT8_C( 84), UINT8_C( 26), UINT8_C(207), UINT8_C( 64), UINT8_C(101),
+        UINT8_C(150), UINT8_C( 35), UINT8_C( 75), UINT8_C( 92), UINT8_C(100), UINT8_C(122), UINT8_C( 82), UINT8_C(217) } },
+    { { UINT8_C( 38), UINT8_C( 90), UINT8_C(252), UINT8_C(237), UINT8_C(229), UINT8_C(165), UINT8_C(161), UINT8_C( 77),
+        UINT8_C(225), UINT8_C( 34), UINT8_C(240), UINT8_C(226), UINT8_C(155), UINT8_C(140), UINT8_C( 28), UINT8_C(180) },
+      { UINT8_C( 37), UINT8_C(158), UINT8_C(236), UINT8_C(231), UINT8_C( 19), UINT8_C( 29), UINT8_C(188), UINT8_C(146),
+        UINT8_C( 39), UINT8_C( 46), UINT8_C(196), UINT8_C(236), UINT8_C( 21), UINT8_C(230), UINT8_C( 96), UINT8_C(164) },
+      { UINT8_C(243), UINT8_C( 77), UINT8_C( 31), UINT8_C(230), UINT8_C( 52), UINT8_C(175), UINT8_C( 43), UINT8_C( 88),
+        UINT8_C( 20), UINT8_C(126), UINT8_C(224), UINT8_C(224), UINT8_C( 81), UINT8_C(186), UINT8_C(190), UINT8_C(144) },
+      { UINT8_C(240), UINT8_C(137), UINT8_C( 15), UINT8_C(236), UINT8_C(194), UINT8_C( 23), UINT8_C( 54), UINT8_C(135),
+        UINT8_C(210), UINT8_C(114), UINT8_C(212), UINT8_C(238), UINT8_C(223), UINT8_C(208), UINT8_C(194), UINT8_C(128) } },
+    { { UINT8_C(198), UINT8_C(209), UINT8_C(173), UINT8_C( 26), UINT8_C(171), UINT8_C( 33), UINT8_C(168), UINT8_C( 48),
+        UINT8_C(197), UINT8_C(145), UINT8_C(129), UINT8_C( 76), UINT8_C(170), UINT8_C( 41), UINT8_C( 72), UINT8_C(179) },
+      { UINT8_C(158), UINT8_C(200), UINT8_C( 66), UINT8_C( 43), UINT8_C(158), UINT8_C(192), UINT8_C(168), UINT8_C( 65),
+        UINT8_C( 47), UINT8_C(216), UINT8_C(185), UINT8_C(  9), UINT8_C(185), UINT8_C(158), UINT8_C( 92), UINT8_C(109) },
+      { UINT8_C(174), UINT8_C(248), UINT8_C( 98), UINT8_C(115), UINT8_C( 70), UINT8_C( 79), UINT8_C( 39), UINT8_C(151),
+        UINT8_C( 51), UINT8_C( 19), UINT8_C(172), UINT8_C( 67), UINT8_C(192), UINT8_C( 78), UINT8_C( 83), UINT8_C( 92) },
+      { UINT8_C(246), UINT8_C(225), UINT8_C(141), UINT8_C( 66), UINT8_C(115), UINT8_C(174), UINT8_C( 39), UINT8_C(230),
+        UINT8_C(217), UINT8_C( 90), UINT8_C(148), UINT8_C(  6), UINT8_C(211), UINT8_C(249), UINT8_C( 71), UINT8_C(130) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+    simde_uint8x16_t c = simde_vld1q_u8(test_vec[i].c);
+    simde_uint8x16_t r = simde_veor3q_u8(a, b, c);
+
+    simde_test_arm_neon_assert_equal_u8x16(r, simde_vld1q_u8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_veor3q_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    uint16_t c[8];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { UINT16_C(21697), UINT16_C(57366), UINT16_C( 5726), UINT16_C(53852), UINT16_C(47749), UINT16_C(31133), UINT16_C(58222), UINT16_C(37346) },
+      { UINT16_C(58841), UINT16_C(30671), UINT16_C(31348), UINT16_C(40562), UINT16_C(61474), UINT16_C(25430), UINT16_C(48213), UINT16_C(57749) },
+      { UINT16_C(60513), UINT16_C(36932), UINT16_C(50052), UINT16_C(54874), UINT16_C(21241), UINT16_C(26174), UINT16_C(18140), UINT16_C(32768) },
+      { UINT16_C(23929), UINT16_C( 1949), UINT16_C(44974), UINT16_C(39540), UINT16_C( 6238), UINT16_C(31989), UINT16_C( 6631), UINT16_C(61559) } },
+    { { UINT16_C( 6839), UINT16_C(62991), UINT16_C(48655), UINT16_C(13446), UINT16_C(16341), UINT16_C(37363), UINT16_C(10993), UINT16_C(21012) },
+      { UINT16_C(35755), UINT16_C(58893), UINT16_C(19313), UINT16_C(57340), UINT16_C(12021), UINT16_C(29102), UINT16_C(59130), UINT16_C(45820) },
+      { UINT16_C( 3495), UINT16_C(54381), UINT16_C( 6980), UINT16_C(51964), UINT16_C(49015), UINT16_C(30903), UINT16_C(50615), UINT16_C(10696) },
+      { UINT16_C(40123), UINT16_C(50287), UINT16_C(60986), UINT16_C( 8582), UINT16_C(44631), UINT16_C(39146), UINT16_C( 2492), UINT16_C(51488) } },
+    { { UINT16_C(49140), UINT16_C(29430), UINT16_C( 3694), UINT16_C(41770), UINT16_C(12987), UINT16_C(43947), UINT16_C(19142), UINT16_C(18035) },
+      { UINT16_C( 5020), UINT16_C(37601), UINT16_C(61925), UINT16_C(18191), UINT16_C(61487), UINT16_C(58799), UINT16_C(  688), UINT16_C(10384) },
+      { UINT16_C( 2490), UINT16_C(33544), UINT16_C(28266), UINT16_C(19597), UINT16_C(55476), UINT16_C(14573), UINT16_C(37762), UINT16_C(31147) },
+      { UINT16_C(42450), UINT16_C(25375), UINT16_C(37345), UINT16_C(43176), UINT16_C( 6688), UINT16_C(30441), UINT16_C(56308), UINT16_C( 5960) } },
+    { { UINT16_C(39472), UINT16_C(15970), UINT16_C( 6258), UINT16_C(31252), UINT16_C(55027), UINT16_C(59914), UINT16_C( 8232), UINT16_C(14530) },
+      { UINT16_C(65513), UINT16_C( 2154), UINT16_C(31711), UINT16_C(18818), UINT16_C(38177), UINT16_C(56261), UINT16_C(  205), UINT16_C(46244) },
+      { UINT16_C(31531), UINT16_C(54600), UINT16_C(24551), UINT16_C(11221), UINT16_C(47265), UINT16_C( 8870), UINT16_C( 2665), UINT16_C(51177) },
+      { UINT16_C( 7922), UINT16_C(58176), UINT16_C(15434), UINT16_C( 6211), UINT16_C(64371), UINT16_C( 4969), UINT16_C(10892), UINT16_C(19343) } },
+    { { UINT16_C(61621), UINT16_C( 5706), UINT16_C(50709), UINT16_C(48929), UINT16_C(33246), UINT16_C( 2128), UINT16_C(46805), UINT16_C( 8855) },
+      { UINT16_C(45193), UINT16_C(31604), UINT16_C(13587), UINT16_C(43583), UINT16_C(17486), UINT16_C( 5811), UINT16_C(46176), UINT16_C(44374) },
+      { UINT16_C(22949), UINT16_C(60899), UINT16_C(62722), UINT16_C(23891), UINT16_C(17675), UINT16_C( 8270), UINT16_C(59988), UINT16_C( 4847) },
+      { UINT16_C( 6553), UINT16_C(32989), UINT16_C( 1540), UINT16_C(18509), UINT16_C(32923), UINT16_C(16045), UINT16_C(59617), UINT16_C(40238) } },
+    { { UINT16_C(38462), UINT16_C(26422), UINT16_C( 5741), UINT16_C(26144), UINT16_C( 5492), UINT16_C(41365), UINT16_C(40642), UINT16_C(52196) },
+      { UINT16_C(62049), UINT16_C(33202), UINT16_C( 4799), UINT16_C(25048), UINT16_C(37501), UINT16_C(46789), UINT16_C( 6265), UINT16_C(43506) },
+      { UINT16_C(35811), UINT16_C(16315), UINT16_C(48237), UINT16_C(57272), UINT16_C(52431), UINT16_C(57637), UINT16_C(50678), UINT16_C(44438) },
+      { UINT16_C(61372), UINT16_C(55615), UINT16_C(47295), UINT16_C(55360), UINT16_C(19398), UINT16_C(63093), UINT16_C(17229), UINT16_C(53120) } },
+    { { UINT16_C(24486), UINT16_C(65038), UINT16_C(65211), UINT16_C(48148), UINT16_C(34959), UINT16_C(10828), UINT16_C(55640), UINT16_C(10345) },
+      { UINT16_C(56440), UINT16_C(23652), UINT16_C(38504), UINT16_C(42101), UINT16_C(13447), UINT16_C(10494), UINT16_C(42981), UINT16_C(38750) },
+      { UINT16_C(40173), UINT16_C(58447), UINT16_C(55851), UINT16_C(21842), UINT16_C(58183), UINT16_C(46077), UINT16_C(58606), UINT16_C( 5551) },
+      { UINT16_C( 7987), UINT16_C(17957), UINT16_C(45816), UINT16_C(19763), UINT16_C(24399), UINT16_C(45391), UINT16_C(39507), UINT16_C(43672) } },
+    { { UINT16_C(46210), UINT16_C(57008), UINT16_C(35986), UINT16_C( 7518), UINT16_C( 9835), UINT16_C(53242), UINT16_C(47619), UINT16_C(20969) },
+      { UINT16_C( 4081), UINT16_C(18714), UINT16_C(57432), UINT16_C( 4561), UINT16_C(16545), UINT16_C( 8812), UINT16_C(30932), UINT16_C(48015) },
+      { UINT16_C(47467), UINT16_C(50181), UINT16_C( 4244), UINT16_C(20111), UINT16_C(58972), UINT16_C(48623), UINT16_C(48760), UINT16_C(58188) },
+      { UINT16_C(  536), UINT16_C(21423), UINT16_C(31838), UINT16_C(16896), UINT16_C(32918), UINT16_C(20601), UINT16_C(31919), UINT16_C( 2346) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_uint16x8_t b = simde_vld1q_u16(test_vec[i].b);
+    simde_uint16x8_t c = simde_vld1q_u16(test_vec[i].c);
+    simde_uint16x8_t r = simde_veor3q_u16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_u16x8(r, simde_vld1q_u16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_veor3q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t c[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3277422858), UINT32_C(2464975279), UINT32_C(2274012889), UINT32_C(1709543220) },
+      { UINT32_C(2789842140), UINT32_C( 487258103), UINT32_C(3159699467), UINT32_C(2412365931) },
+      { UINT32_C(1916728422), UINT32_C(2109688769), UINT32_C( 526723719), UINT32_C(3662861038) },
+      { UINT32_C( 388950448), UINT32_C(4065932697), UINT32_C( 616215637), UINT32_C( 813602225) } },
+    { { UINT32_C(1941508568), UINT32_C(2328608265), UINT32_C(3828240439), UINT32_C(3656572173) },
+      { UINT32_C(2738900744), UINT32_C(3408900003), UINT32_C(2185089287), UINT32_C( 596471620) },
+      { UINT32_C(3394626443), UINT32_C( 112889043), UINT32_C(1584461407), UINT32_C(2369305560) },
+      { UINT32_C( 447528283), UINT32_C(1197383033), UINT32_C( 946042735), UINT32_C(2001144209) } },
+    { { UINT32_C( 370292681), UINT32_C(1328393535), UINT32_C(3087521674), UINT32_C(2257845661) },
+      { UINT32_C(3303536605), UINT32_C( 316756902), UINT32_C(4176339146), UINT32_C(2758823240) },
+      { UINT32_C(1932625737), UINT32_C(1479679716), UINT32_C(4150074940), UINT32_C( 657196424) },
+      { UINT32_C(2713995101), UINT32_C( 100589693), UINT32_C(3082234236), UINT32_C(  97498461) } },
+    { { UINT32_C( 707196784), UINT32_C(3046558332), UINT32_C(3843677566), UINT32_C(3633257620) },
+      { UINT32_C(1076341629), UINT32_C(2365845882), UINT32_C(2291270703), UINT32_C( 662259333) },
+      { UINT32_C(2599051823), UINT32_C(2420721027), UINT32_C( 121863227), UINT32_C(2477213586) },
+      { UINT32_C(4041948706), UINT32_C(2833022597), UINT32_C(1791534442), UINT32_C(1817255299) } },
+    { { UINT32_C(2796581976), UINT32_C(2744446292), UINT32_C(4108781210), UINT32_C(2074232200) },
+      { UINT32_C(2942013255), UINT32_C(1277468755), UINT32_C( 257324536), UINT32_C(1888091245) },
+      { UINT32_C(2079842771), UINT32_C( 876272170), UINT32_C(2605585995), UINT32_C(3085345100) },
+      { UINT32_C(1914444492), UINT32_C(3683292973), UINT32_C(1627350313), UINT32_C(3167557801) } },
+    { { UINT32_C(3697010641), UINT32_C(4189199982), UINT32_C(2412273600), UINT32_C(1370592316) },
+      { UINT32_C(2003484425), UINT32_C(1148782098), UINT32_C(1064803502), UINT32_C( 415802902) },
+      { UINT32_C(2643025991), UINT32_C(1343100352), UINT32_C(3277581356), UINT32_C(2210726347) },
+      { UINT32_C( 918042783), UINT32_C(3989114300), UINT32_C(1944334146), UINT32_C(3401331681) } },
+    { { UINT32_C(1325171272), UINT32_C(  99541460), UINT32_C(4059743975), UINT32_C(2170867436) },
+      { UINT32_C(4151887478), UINT32_C(1515672889), UINT32_C( 217069388), UINT32_C(2021155136) },
+      { UINT32_C(2305069227), UINT32_C(3638577630), UINT32_C(1850820685), UINT32_C(3790118526) },
+      { UINT32_C( 820040853), UINT32_C(2270821683), UINT32_C(2472262118), UINT32_C( 418656722) } },
+    { { UINT32_C(3124623359), UINT32_C(3280739820), UINT32_C(1571688961), UINT32_C(1720484983) },
+      { UINT32_C( 836038153), UINT32_C(2376074389), UINT32_C( 315816454), UINT32_C(2165761020) },
+      { UINT32_C( 510289448), UINT32_C(4187948804), UINT32_C(1691803583), UINT32_C(4032753406) },
+      { UINT32_C(2508423134), UINT32_C(3081969277), UINT32_C( 732575672), UINT32_C( 398756213) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t b = simde_vld1q_u32(test_vec[i].b);
+    simde_uint32x4_t c = simde_vld1q_u32(test_vec[i].c);
+    simde_uint32x4_t r = simde_veor3q_u32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_veor3q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint64_t c[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 2661263058122663367), UINT64_C( 9391652710685279001) },
+      { UINT64_C(  742572024828074768), UINT64_C(14830552396987508702) },
+      { UINT64_C( 8429951052479134991), UINT64_C( 5875841960248477785) },
+      { UINT64_C( 6511538919361905624), UINT64_C( 2165740576124382366) } },
+    { { UINT64_C(15543262158048725149), UINT64_C( 6795002230757020123) },
+      { UINT64_C(10767404002642649622), UINT64_C(11011038889871825171) },
+      { UINT64_C(10655473869954409692), UINT64_C(15516794748656195143) },
+      { UINT64_C(15061896940330454615), UINT64_C( 1284961391137824399) } },
+    { { UINT64_C(12922329976551609074), UINT64_C(  349332840876817911) },
+      { UINT64_C( 7725132985448408711), UINT64_C(12737481690003783930) },
+      { UINT64_C(16980614392360588148), UINT64_C( 9568016456845189028) },
+      { UINT64_C( 3731016727916078849), UINT64_C( 3518956197601977001) } },
+    { { UINT64_C(11253926571451170146), UINT64_C(17659758009795492213) },
+      { UINT64_C(10294881634405381772), UINT64_C(13003127190550490328) },
+      { UINT64_C(13004738054117888021), UINT64_C( 8850810911215686925) },
+      { UINT64_C(12000160622578916347), UINT64_C( 4302088489919152288) } },
+    { { UINT64_C(13312358189428092781), UINT64_C(10020103114712358302) },
+      { UINT64_C(18080770640114126498), UINT64_C(14842542457214176035) },
+      { UINT64_C(  775989699874069247), UINT64_C(13173581672157769884) },
+      { UINT64_C( 5229220820275182384), UINT64_C(17304014713803236897) } },
+    { { UINT64_C(17044969240587356024), UINT64_C( 3947359969701326930) },
+      { UINT64_C( 9935009097285149851), UINT64_C( 2532239124623588379) },
+      { UINT64_C( 4472561506067781374), UINT64_C(11768000265029262841) },
+      { UINT64_C( 6591688669610800413), UINT64_C(13165095998204776880) } },
+    { { UINT64_C( 1848326089293696676), UINT64_C(13232920516728069995) },
+      { UINT64_C( 5924498445049586712), UINT64_C( 3229375189286749215) },
+      { UINT64_C(15451083033684921962), UINT64_C(16964268070339448155) },
+      { UINT64_C(11381685997417931990), UINT64_C( 8077455981740430895) } },
+    { { UINT64_C(15425226343214130879), UINT64_C( 9138219997153708476) },
+      { UINT64_C(17082417290333286718), UINT64_C(  691129072837868950) },
+      { UINT64_C( 5249235938856751612), UINT64_C( 8633459440555922680) },
+      { UINT64_C( 8347582315451221629), UINT64_C(   42270791786684626) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+    simde_uint64x2_t c = simde_vld1q_u64(test_vec[i].c);
+    simde_uint64x2_t r = simde_veor3q_u64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(veor3q_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -3,6 +3,111 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/fma.h"
 
+static int
+test_simde_vfmah_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 c;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(  2050.00),
+      SIMDE_FLOAT16_VALUE(    1.001),
+      SIMDE_FLOAT16_VALUE(   -0.999),
+      SIMDE_FLOAT16_VALUE(  2050.00) },
+    { SIMDE_FLOAT16_VALUE(  -560.50),
+      SIMDE_FLOAT16_VALUE(   -10.77),
+      SIMDE_FLOAT16_VALUE(    22.59),
+      SIMDE_FLOAT16_VALUE(  -804.00) },
+    { SIMDE_FLOAT16_VALUE(   682.00),
+      SIMDE_FLOAT16_VALUE(    29.94),
+      SIMDE_FLOAT16_VALUE(   -17.02),
+      SIMDE_FLOAT16_VALUE(   172.62) },
+    { SIMDE_FLOAT16_VALUE(  -570.50),
+      SIMDE_FLOAT16_VALUE(    22.56),
+      SIMDE_FLOAT16_VALUE(   -24.52),
+      SIMDE_FLOAT16_VALUE( -1124.00) },
+    { SIMDE_FLOAT16_VALUE(   762.00),
+      SIMDE_FLOAT16_VALUE(     2.67),
+      SIMDE_FLOAT16_VALUE(   -17.59),
+      SIMDE_FLOAT16_VALUE(   715.00) },
+    { SIMDE_FLOAT16_VALUE(  -153.25),
+      SIMDE_FLOAT16_VALUE(    -1.04),
+      SIMDE_FLOAT16_VALUE(    -9.53),
+      SIMDE_FLOAT16_VALUE(  -143.38) },
+    { SIMDE_FLOAT16_VALUE(    56.53),
+      SIMDE_FLOAT16_VALUE(    21.45),
+      SIMDE_FLOAT16_VALUE(   -15.57),
+      SIMDE_FLOAT16_VALUE(  -277.50) },
+    { SIMDE_FLOAT16_VALUE(   489.25),
+      SIMDE_FLOAT16_VALUE(    24.73),
+      SIMDE_FLOAT16_VALUE(    -3.32),
+      SIMDE_FLOAT16_VALUE(   407.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vfmah_f16(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfma_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 c[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE(  -865.00), SIMDE_FLOAT16_VALUE(   672.00), SIMDE_FLOAT16_VALUE(   483.50) },
+      { SIMDE_FLOAT16_VALUE(    1.001), SIMDE_FLOAT16_VALUE(    25.20), SIMDE_FLOAT16_VALUE(     1.07), SIMDE_FLOAT16_VALUE(    23.41) },
+      { SIMDE_FLOAT16_VALUE(   -0.999), SIMDE_FLOAT16_VALUE(   -21.06), SIMDE_FLOAT16_VALUE(   -29.72), SIMDE_FLOAT16_VALUE(   -10.63) },
+      { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE( -1396.00), SIMDE_FLOAT16_VALUE(   640.00), SIMDE_FLOAT16_VALUE(   234.62) } },
+    { { SIMDE_FLOAT16_VALUE(  -238.50), SIMDE_FLOAT16_VALUE(  -738.00), SIMDE_FLOAT16_VALUE(  -848.50), SIMDE_FLOAT16_VALUE(  -413.00) },
+      { SIMDE_FLOAT16_VALUE(   -28.78), SIMDE_FLOAT16_VALUE(    22.59), SIMDE_FLOAT16_VALUE(   -19.53), SIMDE_FLOAT16_VALUE(    28.52) },
+      { SIMDE_FLOAT16_VALUE(    27.61), SIMDE_FLOAT16_VALUE(     9.29), SIMDE_FLOAT16_VALUE(    -5.49), SIMDE_FLOAT16_VALUE(     4.65) },
+      { SIMDE_FLOAT16_VALUE( -1033.00), SIMDE_FLOAT16_VALUE(  -528.00), SIMDE_FLOAT16_VALUE(  -741.50), SIMDE_FLOAT16_VALUE(  -280.50) } },
+    { { SIMDE_FLOAT16_VALUE(   501.00), SIMDE_FLOAT16_VALUE(  -199.62), SIMDE_FLOAT16_VALUE(   988.50), SIMDE_FLOAT16_VALUE(  -736.00) },
+      { SIMDE_FLOAT16_VALUE(   -14.41), SIMDE_FLOAT16_VALUE(    -2.04), SIMDE_FLOAT16_VALUE(   -14.90), SIMDE_FLOAT16_VALUE(    18.64) },
+      { SIMDE_FLOAT16_VALUE(   -24.23), SIMDE_FLOAT16_VALUE(   -19.75), SIMDE_FLOAT16_VALUE(     0.08), SIMDE_FLOAT16_VALUE(     3.27) },
+      { SIMDE_FLOAT16_VALUE(   850.00), SIMDE_FLOAT16_VALUE(  -159.38), SIMDE_FLOAT16_VALUE(   987.50), SIMDE_FLOAT16_VALUE(  -675.00) } },
+    { { SIMDE_FLOAT16_VALUE(   806.00), SIMDE_FLOAT16_VALUE(   661.00), SIMDE_FLOAT16_VALUE(   647.50), SIMDE_FLOAT16_VALUE(   864.00) },
+      { SIMDE_FLOAT16_VALUE(   -14.99), SIMDE_FLOAT16_VALUE(    12.34), SIMDE_FLOAT16_VALUE(    22.45), SIMDE_FLOAT16_VALUE(    -6.65) },
+      { SIMDE_FLOAT16_VALUE(    28.80), SIMDE_FLOAT16_VALUE(    21.19), SIMDE_FLOAT16_VALUE(    29.88), SIMDE_FLOAT16_VALUE(    24.77) },
+      { SIMDE_FLOAT16_VALUE(   374.25), SIMDE_FLOAT16_VALUE(   922.50), SIMDE_FLOAT16_VALUE(  1318.00), SIMDE_FLOAT16_VALUE(   699.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -66.06), SIMDE_FLOAT16_VALUE(   541.00), SIMDE_FLOAT16_VALUE(   987.00), SIMDE_FLOAT16_VALUE(  -999.00) },
+      { SIMDE_FLOAT16_VALUE(    17.81), SIMDE_FLOAT16_VALUE(     5.34), SIMDE_FLOAT16_VALUE(    -1.86), SIMDE_FLOAT16_VALUE(    -0.87) },
+      { SIMDE_FLOAT16_VALUE(   -25.67), SIMDE_FLOAT16_VALUE(   -21.61), SIMDE_FLOAT16_VALUE(    17.31), SIMDE_FLOAT16_VALUE(    22.77) },
+      { SIMDE_FLOAT16_VALUE(  -523.50), SIMDE_FLOAT16_VALUE(   425.50), SIMDE_FLOAT16_VALUE(   955.00), SIMDE_FLOAT16_VALUE( -1019.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -414.00), SIMDE_FLOAT16_VALUE(   424.00), SIMDE_FLOAT16_VALUE(  -187.88), SIMDE_FLOAT16_VALUE(   401.75) },
+      { SIMDE_FLOAT16_VALUE(    10.80), SIMDE_FLOAT16_VALUE(    20.84), SIMDE_FLOAT16_VALUE(    15.88), SIMDE_FLOAT16_VALUE(    24.45) },
+      { SIMDE_FLOAT16_VALUE(    14.96), SIMDE_FLOAT16_VALUE(   -14.14), SIMDE_FLOAT16_VALUE(    -5.23), SIMDE_FLOAT16_VALUE(     0.08) },
+      { SIMDE_FLOAT16_VALUE(  -252.50), SIMDE_FLOAT16_VALUE(   129.25), SIMDE_FLOAT16_VALUE(  -271.00), SIMDE_FLOAT16_VALUE(   403.75) } },
+    { { SIMDE_FLOAT16_VALUE(   252.75), SIMDE_FLOAT16_VALUE(   762.00), SIMDE_FLOAT16_VALUE(  -434.25), SIMDE_FLOAT16_VALUE(  -229.88) },
+      { SIMDE_FLOAT16_VALUE(     8.03), SIMDE_FLOAT16_VALUE(   -17.48), SIMDE_FLOAT16_VALUE(   -17.98), SIMDE_FLOAT16_VALUE(    13.52) },
+      { SIMDE_FLOAT16_VALUE(    21.06), SIMDE_FLOAT16_VALUE(    20.69), SIMDE_FLOAT16_VALUE(     7.53), SIMDE_FLOAT16_VALUE(     5.13) },
+      { SIMDE_FLOAT16_VALUE(   422.00), SIMDE_FLOAT16_VALUE(   400.25), SIMDE_FLOAT16_VALUE(  -569.50), SIMDE_FLOAT16_VALUE(  -160.50) } },
+    { { SIMDE_FLOAT16_VALUE(   959.00), SIMDE_FLOAT16_VALUE(   629.00), SIMDE_FLOAT16_VALUE(  -845.00), SIMDE_FLOAT16_VALUE(   518.00) },
+      { SIMDE_FLOAT16_VALUE(   -19.16), SIMDE_FLOAT16_VALUE(     0.88), SIMDE_FLOAT16_VALUE(   -27.95), SIMDE_FLOAT16_VALUE(   -15.22) },
+      { SIMDE_FLOAT16_VALUE(    17.48), SIMDE_FLOAT16_VALUE(    -9.43), SIMDE_FLOAT16_VALUE(    27.22), SIMDE_FLOAT16_VALUE(    27.44) },
+      { SIMDE_FLOAT16_VALUE(   624.00), SIMDE_FLOAT16_VALUE(   620.50), SIMDE_FLOAT16_VALUE( -1606.00), SIMDE_FLOAT16_VALUE(   100.44) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t c = simde_vld1_f16(test_vec[i].c);
+    simde_float16x4_t r = simde_vfma_f16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vfma_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -73,6 +178,92 @@ test_simde_vfma_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vfmaq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 c[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE(   536.00), SIMDE_FLOAT16_VALUE(   249.62), SIMDE_FLOAT16_VALUE(  -851.50),
+          SIMDE_FLOAT16_VALUE(  -888.50), SIMDE_FLOAT16_VALUE(  -125.06), SIMDE_FLOAT16_VALUE(   388.25), SIMDE_FLOAT16_VALUE(   521.00) },
+      { SIMDE_FLOAT16_VALUE(    1.001), SIMDE_FLOAT16_VALUE(     4.93), SIMDE_FLOAT16_VALUE(    -4.91), SIMDE_FLOAT16_VALUE(    14.51),
+          SIMDE_FLOAT16_VALUE(   -25.02), SIMDE_FLOAT16_VALUE(   -19.48), SIMDE_FLOAT16_VALUE(     1.61), SIMDE_FLOAT16_VALUE(    24.98) },
+      { SIMDE_FLOAT16_VALUE(   -0.999), SIMDE_FLOAT16_VALUE(     3.48), SIMDE_FLOAT16_VALUE(     4.03), SIMDE_FLOAT16_VALUE(    26.31),
+          SIMDE_FLOAT16_VALUE(    18.20), SIMDE_FLOAT16_VALUE(    -5.75), SIMDE_FLOAT16_VALUE(   -22.30), SIMDE_FLOAT16_VALUE(    17.20) },
+      { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE(   553.00), SIMDE_FLOAT16_VALUE(   229.88), SIMDE_FLOAT16_VALUE(  -469.75),
+          SIMDE_FLOAT16_VALUE( -1344.00), SIMDE_FLOAT16_VALUE(   -13.03), SIMDE_FLOAT16_VALUE(   352.25), SIMDE_FLOAT16_VALUE(   951.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -841.50), SIMDE_FLOAT16_VALUE(  -985.00), SIMDE_FLOAT16_VALUE(   632.50), SIMDE_FLOAT16_VALUE(  -905.00),
+          SIMDE_FLOAT16_VALUE(  -965.50), SIMDE_FLOAT16_VALUE(   448.50), SIMDE_FLOAT16_VALUE(  -257.75), SIMDE_FLOAT16_VALUE(   423.25) },
+      { SIMDE_FLOAT16_VALUE(   -10.49), SIMDE_FLOAT16_VALUE(     2.21), SIMDE_FLOAT16_VALUE(     6.34), SIMDE_FLOAT16_VALUE(    29.44),
+          SIMDE_FLOAT16_VALUE(    17.62), SIMDE_FLOAT16_VALUE(   -13.97), SIMDE_FLOAT16_VALUE(    19.84), SIMDE_FLOAT16_VALUE(   -21.28) },
+      { SIMDE_FLOAT16_VALUE(    24.89), SIMDE_FLOAT16_VALUE(   -11.53), SIMDE_FLOAT16_VALUE(     8.90), SIMDE_FLOAT16_VALUE(    -1.50),
+          SIMDE_FLOAT16_VALUE(   -26.64), SIMDE_FLOAT16_VALUE(   -21.47), SIMDE_FLOAT16_VALUE(    -1.44), SIMDE_FLOAT16_VALUE(     4.27) },
+      { SIMDE_FLOAT16_VALUE( -1103.00), SIMDE_FLOAT16_VALUE( -1010.50), SIMDE_FLOAT16_VALUE(   689.00), SIMDE_FLOAT16_VALUE(  -949.00),
+          SIMDE_FLOAT16_VALUE( -1435.00), SIMDE_FLOAT16_VALUE(   748.50), SIMDE_FLOAT16_VALUE(  -286.25), SIMDE_FLOAT16_VALUE(   332.50) } },
+    { { SIMDE_FLOAT16_VALUE(   201.75), SIMDE_FLOAT16_VALUE(    13.61), SIMDE_FLOAT16_VALUE(  -640.50), SIMDE_FLOAT16_VALUE(  -757.00),
+          SIMDE_FLOAT16_VALUE(  -244.12), SIMDE_FLOAT16_VALUE(  -760.50), SIMDE_FLOAT16_VALUE(   -31.30), SIMDE_FLOAT16_VALUE(    70.19) },
+      { SIMDE_FLOAT16_VALUE(    21.45), SIMDE_FLOAT16_VALUE(    25.17), SIMDE_FLOAT16_VALUE(    -3.83), SIMDE_FLOAT16_VALUE(   -28.12),
+          SIMDE_FLOAT16_VALUE(     4.55), SIMDE_FLOAT16_VALUE(   -17.05), SIMDE_FLOAT16_VALUE(    13.71), SIMDE_FLOAT16_VALUE(    22.20) },
+      { SIMDE_FLOAT16_VALUE(   -12.63), SIMDE_FLOAT16_VALUE(    -9.09), SIMDE_FLOAT16_VALUE(   -15.15), SIMDE_FLOAT16_VALUE(   -15.18),
+          SIMDE_FLOAT16_VALUE(   -17.52), SIMDE_FLOAT16_VALUE(   -17.22), SIMDE_FLOAT16_VALUE(    24.56), SIMDE_FLOAT16_VALUE(     9.68) },
+      { SIMDE_FLOAT16_VALUE(   -69.25), SIMDE_FLOAT16_VALUE(  -215.25), SIMDE_FLOAT16_VALUE(  -582.50), SIMDE_FLOAT16_VALUE(  -330.00),
+          SIMDE_FLOAT16_VALUE(  -323.75), SIMDE_FLOAT16_VALUE(  -467.00), SIMDE_FLOAT16_VALUE(   305.50), SIMDE_FLOAT16_VALUE(   285.00) } },
+    { { SIMDE_FLOAT16_VALUE(   912.00), SIMDE_FLOAT16_VALUE(  -717.00), SIMDE_FLOAT16_VALUE(  -755.50), SIMDE_FLOAT16_VALUE(  -154.88),
+          SIMDE_FLOAT16_VALUE(   983.00), SIMDE_FLOAT16_VALUE(  -379.25), SIMDE_FLOAT16_VALUE(   783.50), SIMDE_FLOAT16_VALUE(  -269.25) },
+      { SIMDE_FLOAT16_VALUE(   -10.49), SIMDE_FLOAT16_VALUE(   -12.94), SIMDE_FLOAT16_VALUE(   -18.69), SIMDE_FLOAT16_VALUE(   -21.44),
+          SIMDE_FLOAT16_VALUE(   -24.28), SIMDE_FLOAT16_VALUE(    18.73), SIMDE_FLOAT16_VALUE(   -11.04), SIMDE_FLOAT16_VALUE(   -23.05) },
+      { SIMDE_FLOAT16_VALUE(    22.11), SIMDE_FLOAT16_VALUE(   -21.30), SIMDE_FLOAT16_VALUE(     9.65), SIMDE_FLOAT16_VALUE(    20.38),
+          SIMDE_FLOAT16_VALUE(   -26.31), SIMDE_FLOAT16_VALUE(     2.29), SIMDE_FLOAT16_VALUE(   -15.81), SIMDE_FLOAT16_VALUE(   -19.73) },
+      { SIMDE_FLOAT16_VALUE(   680.00), SIMDE_FLOAT16_VALUE(  -441.50), SIMDE_FLOAT16_VALUE(  -936.00), SIMDE_FLOAT16_VALUE(  -591.50),
+          SIMDE_FLOAT16_VALUE(  1622.00), SIMDE_FLOAT16_VALUE(  -336.25), SIMDE_FLOAT16_VALUE(   958.00), SIMDE_FLOAT16_VALUE(   185.62) } },
+    { { SIMDE_FLOAT16_VALUE(   734.00), SIMDE_FLOAT16_VALUE(  -395.75), SIMDE_FLOAT16_VALUE(  -807.50), SIMDE_FLOAT16_VALUE(   176.12),
+          SIMDE_FLOAT16_VALUE(  -182.62), SIMDE_FLOAT16_VALUE(   209.00), SIMDE_FLOAT16_VALUE(   690.00), SIMDE_FLOAT16_VALUE(  -296.75) },
+      { SIMDE_FLOAT16_VALUE(    19.36), SIMDE_FLOAT16_VALUE(    19.64), SIMDE_FLOAT16_VALUE(     2.54), SIMDE_FLOAT16_VALUE(    12.75),
+          SIMDE_FLOAT16_VALUE(     1.44), SIMDE_FLOAT16_VALUE(    23.28), SIMDE_FLOAT16_VALUE(    -8.93), SIMDE_FLOAT16_VALUE(    21.50) },
+      { SIMDE_FLOAT16_VALUE(    26.25), SIMDE_FLOAT16_VALUE(   -18.11), SIMDE_FLOAT16_VALUE(    13.82), SIMDE_FLOAT16_VALUE(   -21.23),
+          SIMDE_FLOAT16_VALUE(    10.25), SIMDE_FLOAT16_VALUE(    -8.96), SIMDE_FLOAT16_VALUE(    25.94), SIMDE_FLOAT16_VALUE(    19.12) },
+      { SIMDE_FLOAT16_VALUE(  1242.00), SIMDE_FLOAT16_VALUE(  -751.50), SIMDE_FLOAT16_VALUE(  -772.50), SIMDE_FLOAT16_VALUE(   -94.62),
+          SIMDE_FLOAT16_VALUE(  -167.88), SIMDE_FLOAT16_VALUE(   0.3782), SIMDE_FLOAT16_VALUE(   458.50), SIMDE_FLOAT16_VALUE(   114.44) } },
+    { { SIMDE_FLOAT16_VALUE(    36.94), SIMDE_FLOAT16_VALUE(  -931.00), SIMDE_FLOAT16_VALUE(  -692.00), SIMDE_FLOAT16_VALUE(  -618.50),
+          SIMDE_FLOAT16_VALUE(   409.00), SIMDE_FLOAT16_VALUE(  -560.00), SIMDE_FLOAT16_VALUE(  -326.50), SIMDE_FLOAT16_VALUE(   106.38) },
+      { SIMDE_FLOAT16_VALUE(   -11.86), SIMDE_FLOAT16_VALUE(   -11.35), SIMDE_FLOAT16_VALUE(    -3.12), SIMDE_FLOAT16_VALUE(     8.75),
+          SIMDE_FLOAT16_VALUE(   -17.80), SIMDE_FLOAT16_VALUE(   -18.73), SIMDE_FLOAT16_VALUE(    24.00), SIMDE_FLOAT16_VALUE(   -23.27) },
+      { SIMDE_FLOAT16_VALUE(    10.20), SIMDE_FLOAT16_VALUE(    26.47), SIMDE_FLOAT16_VALUE(    -9.86), SIMDE_FLOAT16_VALUE(   -22.69),
+          SIMDE_FLOAT16_VALUE(    26.56), SIMDE_FLOAT16_VALUE(   -22.95), SIMDE_FLOAT16_VALUE(    -8.65), SIMDE_FLOAT16_VALUE(     2.78) },
+      { SIMDE_FLOAT16_VALUE(   -84.06), SIMDE_FLOAT16_VALUE( -1231.00), SIMDE_FLOAT16_VALUE(  -661.00), SIMDE_FLOAT16_VALUE(  -817.00),
+          SIMDE_FLOAT16_VALUE(   -63.72), SIMDE_FLOAT16_VALUE(  -130.00), SIMDE_FLOAT16_VALUE(  -534.00), SIMDE_FLOAT16_VALUE(    41.72) } },
+    { { SIMDE_FLOAT16_VALUE(   866.00), SIMDE_FLOAT16_VALUE(   942.50), SIMDE_FLOAT16_VALUE(  -889.00), SIMDE_FLOAT16_VALUE(   887.50),
+          SIMDE_FLOAT16_VALUE(    35.50), SIMDE_FLOAT16_VALUE(   645.00), SIMDE_FLOAT16_VALUE(   227.75), SIMDE_FLOAT16_VALUE(  -317.00) },
+      { SIMDE_FLOAT16_VALUE(   -21.48), SIMDE_FLOAT16_VALUE(   -21.52), SIMDE_FLOAT16_VALUE(    -7.21), SIMDE_FLOAT16_VALUE(   -19.20),
+          SIMDE_FLOAT16_VALUE(     3.23), SIMDE_FLOAT16_VALUE(    11.80), SIMDE_FLOAT16_VALUE(   -28.34), SIMDE_FLOAT16_VALUE(    17.17) },
+      { SIMDE_FLOAT16_VALUE(    -0.89), SIMDE_FLOAT16_VALUE(   -14.07), SIMDE_FLOAT16_VALUE(     6.06), SIMDE_FLOAT16_VALUE(    24.02),
+          SIMDE_FLOAT16_VALUE(   -19.64), SIMDE_FLOAT16_VALUE(   -17.94), SIMDE_FLOAT16_VALUE(   -26.59), SIMDE_FLOAT16_VALUE(   -21.88) },
+      { SIMDE_FLOAT16_VALUE(   885.00), SIMDE_FLOAT16_VALUE(  1245.00), SIMDE_FLOAT16_VALUE(  -932.50), SIMDE_FLOAT16_VALUE(   426.25),
+          SIMDE_FLOAT16_VALUE(   -27.95), SIMDE_FLOAT16_VALUE(   433.50), SIMDE_FLOAT16_VALUE(   981.50), SIMDE_FLOAT16_VALUE(  -692.50) } },
+    { { SIMDE_FLOAT16_VALUE(   627.00), SIMDE_FLOAT16_VALUE(   897.50), SIMDE_FLOAT16_VALUE(  -893.50), SIMDE_FLOAT16_VALUE(  -402.00),
+          SIMDE_FLOAT16_VALUE(  -632.00), SIMDE_FLOAT16_VALUE(   816.50), SIMDE_FLOAT16_VALUE(   793.00), SIMDE_FLOAT16_VALUE(   786.00) },
+      { SIMDE_FLOAT16_VALUE(    -7.01), SIMDE_FLOAT16_VALUE(   -24.14), SIMDE_FLOAT16_VALUE(     0.25), SIMDE_FLOAT16_VALUE(     1.75),
+          SIMDE_FLOAT16_VALUE(    -4.69), SIMDE_FLOAT16_VALUE(     1.99), SIMDE_FLOAT16_VALUE(    10.89), SIMDE_FLOAT16_VALUE(    13.22) },
+      { SIMDE_FLOAT16_VALUE(   -12.75), SIMDE_FLOAT16_VALUE(    25.14), SIMDE_FLOAT16_VALUE(   -27.00), SIMDE_FLOAT16_VALUE(    14.25),
+          SIMDE_FLOAT16_VALUE(     9.01), SIMDE_FLOAT16_VALUE(   -26.34), SIMDE_FLOAT16_VALUE(    12.18), SIMDE_FLOAT16_VALUE(    -4.25) },
+      { SIMDE_FLOAT16_VALUE(   716.50), SIMDE_FLOAT16_VALUE(   290.50), SIMDE_FLOAT16_VALUE(  -900.00), SIMDE_FLOAT16_VALUE(  -377.00),
+          SIMDE_FLOAT16_VALUE(  -674.50), SIMDE_FLOAT16_VALUE(   764.00), SIMDE_FLOAT16_VALUE(   925.50), SIMDE_FLOAT16_VALUE(   730.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t c = simde_vld1q_f16(test_vec[i].c);
+    simde_float16x8_t r = simde_vfmaq_f16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vfmaq_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -282,7 +473,10 @@ test_simde_vfmaq_f64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmah_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vfma_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vfma_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_f64)
@@ -0,0 +1,261 @@
+#define SIMDE_TEST_ARM_NEON_INSN fmlal
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fmlal.h"
+
+static int
+test_simde_vfmlal_low_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float32 r[2];
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float32 ret[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -876.59), SIMDE_FLOAT32_C(   537.73) },
+      { SIMDE_FLOAT16_VALUE(   -22.16), SIMDE_FLOAT16_VALUE(   -56.19), SIMDE_FLOAT16_VALUE(    82.50), SIMDE_FLOAT16_VALUE(    13.62) },
+      { SIMDE_FLOAT16_VALUE(    29.47), SIMDE_FLOAT16_VALUE(     0.25), SIMDE_FLOAT16_VALUE(    67.50), SIMDE_FLOAT16_VALUE(     3.65) },
+      { SIMDE_FLOAT32_C( -1529.51), SIMDE_FLOAT32_C(   523.68) } },
+    { { SIMDE_FLOAT32_C(  -227.51), SIMDE_FLOAT32_C(   452.86) },
+      { SIMDE_FLOAT16_VALUE(    77.69), SIMDE_FLOAT16_VALUE(     7.44), SIMDE_FLOAT16_VALUE(    76.50), SIMDE_FLOAT16_VALUE(   -57.03) },
+      { SIMDE_FLOAT16_VALUE(    55.44), SIMDE_FLOAT16_VALUE(   -86.62), SIMDE_FLOAT16_VALUE(    18.22), SIMDE_FLOAT16_VALUE(    79.56) },
+      { SIMDE_FLOAT32_C(  4079.29), SIMDE_FLOAT32_C(  -191.75) } },
+    { { SIMDE_FLOAT32_C(   349.52), SIMDE_FLOAT32_C(  -682.03) },
+      { SIMDE_FLOAT16_VALUE(   -95.44), SIMDE_FLOAT16_VALUE(   -44.59), SIMDE_FLOAT16_VALUE(   -87.62), SIMDE_FLOAT16_VALUE(    52.91) },
+      { SIMDE_FLOAT16_VALUE(   -88.38), SIMDE_FLOAT16_VALUE(    83.44), SIMDE_FLOAT16_VALUE(    -7.22), SIMDE_FLOAT16_VALUE(    10.84) },
+      { SIMDE_FLOAT32_C(  8783.81), SIMDE_FLOAT32_C( -4402.82) } },
+    { { SIMDE_FLOAT32_C(   402.27), SIMDE_FLOAT32_C(  -519.97) },
+      { SIMDE_FLOAT16_VALUE(    86.88), SIMDE_FLOAT16_VALUE(   -55.62), SIMDE_FLOAT16_VALUE(     5.78), SIMDE_FLOAT16_VALUE(    87.94) },
+      { SIMDE_FLOAT16_VALUE(    80.00), SIMDE_FLOAT16_VALUE(   100.00), SIMDE_FLOAT16_VALUE(    71.88), SIMDE_FLOAT16_VALUE(    35.62) },
+      { SIMDE_FLOAT32_C(  7352.27), SIMDE_FLOAT32_C( -6082.47) } },
+    { { SIMDE_FLOAT32_C(  -165.55), SIMDE_FLOAT32_C(   -80.58) },
+      { SIMDE_FLOAT16_VALUE(    -9.22), SIMDE_FLOAT16_VALUE(    64.50), SIMDE_FLOAT16_VALUE(   -86.44), SIMDE_FLOAT16_VALUE(    29.38) },
+      { SIMDE_FLOAT16_VALUE(    43.38), SIMDE_FLOAT16_VALUE(    -5.35), SIMDE_FLOAT16_VALUE(    -7.88), SIMDE_FLOAT16_VALUE(   -33.84) },
+      { SIMDE_FLOAT32_C(  -565.41), SIMDE_FLOAT32_C(  -425.76) } },
+    { { SIMDE_FLOAT32_C(   777.04), SIMDE_FLOAT32_C(   896.42) },
+      { SIMDE_FLOAT16_VALUE(   -95.31), SIMDE_FLOAT16_VALUE(    36.66), SIMDE_FLOAT16_VALUE(    91.69), SIMDE_FLOAT16_VALUE(    89.69) },
+      { SIMDE_FLOAT16_VALUE(    48.94), SIMDE_FLOAT16_VALUE(    30.86), SIMDE_FLOAT16_VALUE(     0.36), SIMDE_FLOAT16_VALUE(    39.28) },
+      { SIMDE_FLOAT32_C( -3887.32), SIMDE_FLOAT32_C(  2027.61) } },
+    { { SIMDE_FLOAT32_C(   195.47), SIMDE_FLOAT32_C(  -197.61) },
+      { SIMDE_FLOAT16_VALUE(    -4.04), SIMDE_FLOAT16_VALUE(   -95.38), SIMDE_FLOAT16_VALUE(   -32.69), SIMDE_FLOAT16_VALUE(    23.75) },
+      { SIMDE_FLOAT16_VALUE(    70.38), SIMDE_FLOAT16_VALUE(   -54.31), SIMDE_FLOAT16_VALUE(   -30.02), SIMDE_FLOAT16_VALUE(   -66.38) },
+      { SIMDE_FLOAT32_C(   -88.78), SIMDE_FLOAT32_C(  4982.44) } },
+    { { SIMDE_FLOAT32_C(  -194.72), SIMDE_FLOAT32_C(    91.01) },
+      { SIMDE_FLOAT16_VALUE(   -74.94), SIMDE_FLOAT16_VALUE(   -16.08), SIMDE_FLOAT16_VALUE(   -23.86), SIMDE_FLOAT16_VALUE(   -71.00) },
+      { SIMDE_FLOAT16_VALUE(   -70.50), SIMDE_FLOAT16_VALUE(    33.50), SIMDE_FLOAT16_VALUE(    34.50), SIMDE_FLOAT16_VALUE(    86.00) },
+      { SIMDE_FLOAT32_C(  5088.37), SIMDE_FLOAT32_C(  -447.61) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t r = simde_vld1_f32(test_vec[i].r);
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float32x2_t ret = simde_vfmlal_low_f16(r, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(ret, simde_vld1_f32(test_vec[i].ret), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmlal_high_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float32 r[2];
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float32 ret[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -992.79), SIMDE_FLOAT32_C(   586.45) },
+      { SIMDE_FLOAT16_VALUE(    60.81), SIMDE_FLOAT16_VALUE(   -81.19), SIMDE_FLOAT16_VALUE(   -87.12), SIMDE_FLOAT16_VALUE(   -18.77) },
+      { SIMDE_FLOAT16_VALUE(    38.44), SIMDE_FLOAT16_VALUE(     1.63), SIMDE_FLOAT16_VALUE(   -91.38), SIMDE_FLOAT16_VALUE(    31.69) },
+      { SIMDE_FLOAT32_C(  6968.26), SIMDE_FLOAT32_C(    -8.19) } },
+    { { SIMDE_FLOAT32_C(   850.46), SIMDE_FLOAT32_C(   463.87) },
+      { SIMDE_FLOAT16_VALUE(    55.31), SIMDE_FLOAT16_VALUE(   -19.53), SIMDE_FLOAT16_VALUE(    64.69), SIMDE_FLOAT16_VALUE(    71.62) },
+      { SIMDE_FLOAT16_VALUE(    74.25), SIMDE_FLOAT16_VALUE(   -83.69), SIMDE_FLOAT16_VALUE(    23.42), SIMDE_FLOAT16_VALUE(    91.12) },
+      { SIMDE_FLOAT32_C(  2365.56), SIMDE_FLOAT32_C(  6990.70) } },
+    { { SIMDE_FLOAT32_C(   418.89), SIMDE_FLOAT32_C(  -359.65) },
+      { SIMDE_FLOAT16_VALUE(   -28.91), SIMDE_FLOAT16_VALUE(    11.52), SIMDE_FLOAT16_VALUE(   -84.81), SIMDE_FLOAT16_VALUE(    54.22) },
+      { SIMDE_FLOAT16_VALUE(   -23.75), SIMDE_FLOAT16_VALUE(    18.52), SIMDE_FLOAT16_VALUE(    -7.55), SIMDE_FLOAT16_VALUE(   -72.44) },
+      { SIMDE_FLOAT32_C(  1059.29), SIMDE_FLOAT32_C( -4287.12) } },
+    { { SIMDE_FLOAT32_C(  -495.88), SIMDE_FLOAT32_C(   992.65) },
+      { SIMDE_FLOAT16_VALUE(   -89.31), SIMDE_FLOAT16_VALUE(   -45.25), SIMDE_FLOAT16_VALUE(   -21.56), SIMDE_FLOAT16_VALUE(     0.75) },
+      { SIMDE_FLOAT16_VALUE(    23.92), SIMDE_FLOAT16_VALUE(   -17.53), SIMDE_FLOAT16_VALUE(    70.50), SIMDE_FLOAT16_VALUE(    -2.81) },
+      { SIMDE_FLOAT32_C( -2016.04), SIMDE_FLOAT32_C(   990.54) } },
+    { { SIMDE_FLOAT32_C(   313.74), SIMDE_FLOAT32_C(   918.27) },
+      { SIMDE_FLOAT16_VALUE(    79.88), SIMDE_FLOAT16_VALUE(    36.72), SIMDE_FLOAT16_VALUE(   -44.88), SIMDE_FLOAT16_VALUE(   -82.75) },
+      { SIMDE_FLOAT16_VALUE(   -16.58), SIMDE_FLOAT16_VALUE(   -13.54), SIMDE_FLOAT16_VALUE(    26.45), SIMDE_FLOAT16_VALUE(    53.94) },
+      { SIMDE_FLOAT32_C(  -873.34), SIMDE_FLOAT32_C( -3545.06) } },
+    { { SIMDE_FLOAT32_C(   303.48), SIMDE_FLOAT32_C(    53.92) },
+      { SIMDE_FLOAT16_VALUE(    34.28), SIMDE_FLOAT16_VALUE(   -60.94), SIMDE_FLOAT16_VALUE(    83.69), SIMDE_FLOAT16_VALUE(    19.39) },
+      { SIMDE_FLOAT16_VALUE(   -51.59), SIMDE_FLOAT16_VALUE(   -84.56), SIMDE_FLOAT16_VALUE(    29.75), SIMDE_FLOAT16_VALUE(   -15.92) },
+      { SIMDE_FLOAT32_C(  2793.18), SIMDE_FLOAT32_C(  -254.82) } },
+    { { SIMDE_FLOAT32_C(  -466.49), SIMDE_FLOAT32_C(  -805.52) },
+      { SIMDE_FLOAT16_VALUE(   -69.81), SIMDE_FLOAT16_VALUE(   -46.97), SIMDE_FLOAT16_VALUE(    88.62), SIMDE_FLOAT16_VALUE(   -48.88) },
+      { SIMDE_FLOAT16_VALUE(   -96.00), SIMDE_FLOAT16_VALUE(   -23.02), SIMDE_FLOAT16_VALUE(    64.00), SIMDE_FLOAT16_VALUE(   -56.78) },
+      { SIMDE_FLOAT32_C(  5205.51), SIMDE_FLOAT32_C(  1969.66) } },
+    { { SIMDE_FLOAT32_C(   860.33), SIMDE_FLOAT32_C(  -276.37) },
+      { SIMDE_FLOAT16_VALUE(   -72.94), SIMDE_FLOAT16_VALUE(   -94.12), SIMDE_FLOAT16_VALUE(   -95.88), SIMDE_FLOAT16_VALUE(    24.78) },
+      { SIMDE_FLOAT16_VALUE(   -33.44), SIMDE_FLOAT16_VALUE(   -55.69), SIMDE_FLOAT16_VALUE(   -40.16), SIMDE_FLOAT16_VALUE(   -32.69) },
+      { SIMDE_FLOAT32_C(  4710.31), SIMDE_FLOAT32_C( -1086.41) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t r = simde_vld1_f32(test_vec[i].r);
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float32x2_t ret = simde_vfmlal_high_f16(r, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(ret, simde_vld1_f32(test_vec[i].ret), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmlalq_low_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float32 r[4];
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float32 ret[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -889.85), SIMDE_FLOAT32_C(   616.35), SIMDE_FLOAT32_C(   267.01), SIMDE_FLOAT32_C(  -430.37) },
+      { SIMDE_FLOAT16_VALUE(    56.84), SIMDE_FLOAT16_VALUE(    11.67), SIMDE_FLOAT16_VALUE(   -50.88), SIMDE_FLOAT16_VALUE(     4.58),
+          SIMDE_FLOAT16_VALUE(    -7.06), SIMDE_FLOAT16_VALUE(    54.59), SIMDE_FLOAT16_VALUE(   -72.88), SIMDE_FLOAT16_VALUE(   -32.09) },
+      { SIMDE_FLOAT16_VALUE(    66.81), SIMDE_FLOAT16_VALUE(   -91.12), SIMDE_FLOAT16_VALUE(    -6.57), SIMDE_FLOAT16_VALUE(    72.25),
+          SIMDE_FLOAT16_VALUE(     4.24), SIMDE_FLOAT16_VALUE(    71.19), SIMDE_FLOAT16_VALUE(   -82.06), SIMDE_FLOAT16_VALUE(   -72.38) },
+      { SIMDE_FLOAT32_C(  2908.02), SIMDE_FLOAT32_C(  -447.25), SIMDE_FLOAT32_C(   601.27), SIMDE_FLOAT32_C(   -99.60) } },
+    { { SIMDE_FLOAT32_C(  -147.98), SIMDE_FLOAT32_C(  -204.20), SIMDE_FLOAT32_C(   269.24), SIMDE_FLOAT32_C(  -213.11) },
+      { SIMDE_FLOAT16_VALUE(    82.69), SIMDE_FLOAT16_VALUE(    85.44), SIMDE_FLOAT16_VALUE(     6.15), SIMDE_FLOAT16_VALUE(   -43.28),
+          SIMDE_FLOAT16_VALUE(    70.62), SIMDE_FLOAT16_VALUE(    19.05), SIMDE_FLOAT16_VALUE(    78.31), SIMDE_FLOAT16_VALUE(   -32.16) },
+      { SIMDE_FLOAT16_VALUE(   -50.44), SIMDE_FLOAT16_VALUE(   -86.19), SIMDE_FLOAT16_VALUE(   -98.50), SIMDE_FLOAT16_VALUE(   -31.33),
+          SIMDE_FLOAT16_VALUE(   -60.41), SIMDE_FLOAT16_VALUE(    21.92), SIMDE_FLOAT16_VALUE(   -42.34), SIMDE_FLOAT16_VALUE(     8.92) },
+      { SIMDE_FLOAT32_C( -4318.53), SIMDE_FLOAT32_C( -7567.84), SIMDE_FLOAT32_C(  -336.38), SIMDE_FLOAT32_C(  1142.81) } },
+    { { SIMDE_FLOAT32_C(   225.15), SIMDE_FLOAT32_C(   857.19), SIMDE_FLOAT32_C(   705.06), SIMDE_FLOAT32_C(  -955.11) },
+      { SIMDE_FLOAT16_VALUE(    52.53), SIMDE_FLOAT16_VALUE(    19.48), SIMDE_FLOAT16_VALUE(   -61.31), SIMDE_FLOAT16_VALUE(   -73.44),
+          SIMDE_FLOAT16_VALUE(     9.23), SIMDE_FLOAT16_VALUE(   -85.88), SIMDE_FLOAT16_VALUE(    91.81), SIMDE_FLOAT16_VALUE(   -12.85) },
+      { SIMDE_FLOAT16_VALUE(    12.16), SIMDE_FLOAT16_VALUE(    34.75), SIMDE_FLOAT16_VALUE(    83.06), SIMDE_FLOAT16_VALUE(   -29.61),
+          SIMDE_FLOAT16_VALUE(     8.03), SIMDE_FLOAT16_VALUE(    70.38), SIMDE_FLOAT16_VALUE(    73.69), SIMDE_FLOAT16_VALUE(   -85.50) },
+      { SIMDE_FLOAT32_C(   863.73), SIMDE_FLOAT32_C(  1534.27), SIMDE_FLOAT32_C( -4387.71), SIMDE_FLOAT32_C(  1219.33) } },
+    { { SIMDE_FLOAT32_C(  -325.95), SIMDE_FLOAT32_C(  -459.48), SIMDE_FLOAT32_C(  -971.05), SIMDE_FLOAT32_C(  -620.68) },
+      { SIMDE_FLOAT16_VALUE(   -57.97), SIMDE_FLOAT16_VALUE(   -32.72), SIMDE_FLOAT16_VALUE(   -31.55), SIMDE_FLOAT16_VALUE(    14.19),
+          SIMDE_FLOAT16_VALUE(    20.66), SIMDE_FLOAT16_VALUE(    91.56), SIMDE_FLOAT16_VALUE(   -65.31), SIMDE_FLOAT16_VALUE(    40.72) },
+      { SIMDE_FLOAT16_VALUE(     9.52), SIMDE_FLOAT16_VALUE(    94.06), SIMDE_FLOAT16_VALUE(    -1.69), SIMDE_FLOAT16_VALUE(    50.59),
+          SIMDE_FLOAT16_VALUE(   -98.69), SIMDE_FLOAT16_VALUE(   -17.28), SIMDE_FLOAT16_VALUE(    -9.59), SIMDE_FLOAT16_VALUE(    43.91) },
+      { SIMDE_FLOAT32_C(  -878.01), SIMDE_FLOAT32_C( -3537.09), SIMDE_FLOAT32_C(  -917.72), SIMDE_FLOAT32_C(    97.12) } },
+    { { SIMDE_FLOAT32_C(  -727.96), SIMDE_FLOAT32_C(   -21.07), SIMDE_FLOAT32_C(  -310.57), SIMDE_FLOAT32_C(   799.21) },
+      { SIMDE_FLOAT16_VALUE(    39.28), SIMDE_FLOAT16_VALUE(   -17.75), SIMDE_FLOAT16_VALUE(    17.42), SIMDE_FLOAT16_VALUE(   -80.88),
+          SIMDE_FLOAT16_VALUE(    41.84), SIMDE_FLOAT16_VALUE(    -4.36), SIMDE_FLOAT16_VALUE(    77.81), SIMDE_FLOAT16_VALUE(    66.44) },
+      { SIMDE_FLOAT16_VALUE(    81.12), SIMDE_FLOAT16_VALUE(    85.56), SIMDE_FLOAT16_VALUE(   -92.38), SIMDE_FLOAT16_VALUE(   -83.25),
+          SIMDE_FLOAT16_VALUE(   -38.31), SIMDE_FLOAT16_VALUE(   -18.06), SIMDE_FLOAT16_VALUE(    14.78), SIMDE_FLOAT16_VALUE(    -5.39) },
+      { SIMDE_FLOAT32_C(  2458.73), SIMDE_FLOAT32_C( -1539.80), SIMDE_FLOAT32_C( -1919.92), SIMDE_FLOAT32_C(  7532.05) } },
+    { { SIMDE_FLOAT32_C(  -346.11), SIMDE_FLOAT32_C(  -262.92), SIMDE_FLOAT32_C(  -593.03), SIMDE_FLOAT32_C(  -285.40) },
+      { SIMDE_FLOAT16_VALUE(   -47.25), SIMDE_FLOAT16_VALUE(   -74.31), SIMDE_FLOAT16_VALUE(    -5.38), SIMDE_FLOAT16_VALUE(   -91.06),
+          SIMDE_FLOAT16_VALUE(    31.95), SIMDE_FLOAT16_VALUE(   -42.94), SIMDE_FLOAT16_VALUE(    75.62), SIMDE_FLOAT16_VALUE(     2.09) },
+      { SIMDE_FLOAT16_VALUE(    22.25), SIMDE_FLOAT16_VALUE(     9.91), SIMDE_FLOAT16_VALUE(     4.81), SIMDE_FLOAT16_VALUE(    18.66),
+          SIMDE_FLOAT16_VALUE(    16.48), SIMDE_FLOAT16_VALUE(    29.50), SIMDE_FLOAT16_VALUE(   -93.94), SIMDE_FLOAT16_VALUE(   -48.34) },
+      { SIMDE_FLOAT32_C( -1397.42), SIMDE_FLOAT32_C(  -999.08), SIMDE_FLOAT32_C(  -618.90), SIMDE_FLOAT32_C( -1984.28) } },
+    { { SIMDE_FLOAT32_C(   806.90), SIMDE_FLOAT32_C(  -714.82), SIMDE_FLOAT32_C(   530.37), SIMDE_FLOAT32_C(  -536.82) },
+      { SIMDE_FLOAT16_VALUE(   -90.50), SIMDE_FLOAT16_VALUE(    33.97), SIMDE_FLOAT16_VALUE(    67.81), SIMDE_FLOAT16_VALUE(    86.44),
+          SIMDE_FLOAT16_VALUE(   -75.31), SIMDE_FLOAT16_VALUE(   -91.19), SIMDE_FLOAT16_VALUE(    76.19), SIMDE_FLOAT16_VALUE(   -24.66) },
+      { SIMDE_FLOAT16_VALUE(    73.44), SIMDE_FLOAT16_VALUE(   -25.62), SIMDE_FLOAT16_VALUE(    -5.82), SIMDE_FLOAT16_VALUE(    76.44),
+          SIMDE_FLOAT16_VALUE(   -72.75), SIMDE_FLOAT16_VALUE(   -54.06), SIMDE_FLOAT16_VALUE(    -0.06), SIMDE_FLOAT16_VALUE(    19.94) },
+      { SIMDE_FLOAT32_C( -5839.19), SIMDE_FLOAT32_C( -1585.27), SIMDE_FLOAT32_C(   135.68), SIMDE_FLOAT32_C(  6070.25) } },
+    { { SIMDE_FLOAT32_C(   589.81), SIMDE_FLOAT32_C(  -821.12), SIMDE_FLOAT32_C(   928.64), SIMDE_FLOAT32_C(   848.37) },
+      { SIMDE_FLOAT16_VALUE(   -78.19), SIMDE_FLOAT16_VALUE(   -11.69), SIMDE_FLOAT16_VALUE(   -75.31), SIMDE_FLOAT16_VALUE(    47.84),
+          SIMDE_FLOAT16_VALUE(   -50.00), SIMDE_FLOAT16_VALUE(    18.66), SIMDE_FLOAT16_VALUE(   -93.44), SIMDE_FLOAT16_VALUE(    34.16) },
+      { SIMDE_FLOAT16_VALUE(    70.12), SIMDE_FLOAT16_VALUE(    25.17), SIMDE_FLOAT16_VALUE(    21.67), SIMDE_FLOAT16_VALUE(    -1.07),
+          SIMDE_FLOAT16_VALUE(    60.56), SIMDE_FLOAT16_VALUE(    76.25), SIMDE_FLOAT16_VALUE(    74.81), SIMDE_FLOAT16_VALUE(   -50.44) },
+      { SIMDE_FLOAT32_C( -4893.09), SIMDE_FLOAT32_C( -1115.32), SIMDE_FLOAT32_C(  -703.52), SIMDE_FLOAT32_C(   797.16) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r = simde_vld1q_f32(test_vec[i].r);
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float32x4_t ret = simde_vfmlalq_low_f16(r, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(ret, simde_vld1q_f32(test_vec[i].ret), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmlalq_high_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float32 r[4];
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float32 ret[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   659.40), SIMDE_FLOAT32_C(   811.61), SIMDE_FLOAT32_C(   -46.97), SIMDE_FLOAT32_C(   358.65) },
+      { SIMDE_FLOAT16_VALUE(     8.39), SIMDE_FLOAT16_VALUE(    17.56), SIMDE_FLOAT16_VALUE(     9.24), SIMDE_FLOAT16_VALUE(    87.38),
+          SIMDE_FLOAT16_VALUE(   -35.03), SIMDE_FLOAT16_VALUE(     3.32), SIMDE_FLOAT16_VALUE(    18.77), SIMDE_FLOAT16_VALUE(    31.94) },
+      { SIMDE_FLOAT16_VALUE(    14.88), SIMDE_FLOAT16_VALUE(   -55.59), SIMDE_FLOAT16_VALUE(    82.00), SIMDE_FLOAT16_VALUE(    81.19),
+          SIMDE_FLOAT16_VALUE(    33.41), SIMDE_FLOAT16_VALUE(    10.47), SIMDE_FLOAT16_VALUE(   -39.41), SIMDE_FLOAT16_VALUE(   -62.91) },
+      { SIMDE_FLOAT32_C(  -510.86), SIMDE_FLOAT32_C(   846.37), SIMDE_FLOAT32_C(  -786.45), SIMDE_FLOAT32_C( -1650.42) } },
+    { { SIMDE_FLOAT32_C(  -150.71), SIMDE_FLOAT32_C(   -86.32), SIMDE_FLOAT32_C(  -697.44), SIMDE_FLOAT32_C(  -966.92) },
+      { SIMDE_FLOAT16_VALUE(   -72.69), SIMDE_FLOAT16_VALUE(   -44.66), SIMDE_FLOAT16_VALUE(    18.72), SIMDE_FLOAT16_VALUE(    22.77),
+          SIMDE_FLOAT16_VALUE(    65.69), SIMDE_FLOAT16_VALUE(   -37.84), SIMDE_FLOAT16_VALUE(   -77.81), SIMDE_FLOAT16_VALUE(   -65.00) },
+      { SIMDE_FLOAT16_VALUE(    36.75), SIMDE_FLOAT16_VALUE(    47.25), SIMDE_FLOAT16_VALUE(    30.61), SIMDE_FLOAT16_VALUE(   -93.94),
+          SIMDE_FLOAT16_VALUE(    16.27), SIMDE_FLOAT16_VALUE(    -4.74), SIMDE_FLOAT16_VALUE(    77.38), SIMDE_FLOAT16_VALUE(   -74.19) },
+      { SIMDE_FLOAT32_C(   917.74), SIMDE_FLOAT32_C(    92.99), SIMDE_FLOAT32_C( -6718.18), SIMDE_FLOAT32_C(  3855.27) } },
+    { { SIMDE_FLOAT32_C(   107.52), SIMDE_FLOAT32_C(   327.89), SIMDE_FLOAT32_C(   594.30), SIMDE_FLOAT32_C(   204.28) },
+      { SIMDE_FLOAT16_VALUE(    57.97), SIMDE_FLOAT16_VALUE(    12.60), SIMDE_FLOAT16_VALUE(    77.12), SIMDE_FLOAT16_VALUE(   -81.12),
+          SIMDE_FLOAT16_VALUE(    42.81), SIMDE_FLOAT16_VALUE(   -84.88), SIMDE_FLOAT16_VALUE(    72.75), SIMDE_FLOAT16_VALUE(   -25.77) },
+      { SIMDE_FLOAT16_VALUE(   -72.25), SIMDE_FLOAT16_VALUE(    16.83), SIMDE_FLOAT16_VALUE(   -29.02), SIMDE_FLOAT16_VALUE(   -64.62),
+          SIMDE_FLOAT16_VALUE(    23.47), SIMDE_FLOAT16_VALUE(   -90.06), SIMDE_FLOAT16_VALUE(    12.29), SIMDE_FLOAT16_VALUE(   -44.34) },
+      { SIMDE_FLOAT32_C(  1112.28), SIMDE_FLOAT32_C(  7971.94), SIMDE_FLOAT32_C(  1488.33), SIMDE_FLOAT32_C(  1346.82) } },
+    { { SIMDE_FLOAT32_C(  -996.28), SIMDE_FLOAT32_C(  -760.26), SIMDE_FLOAT32_C(   -98.54), SIMDE_FLOAT32_C(  -353.83) },
+      { SIMDE_FLOAT16_VALUE(   -68.62), SIMDE_FLOAT16_VALUE(    10.07), SIMDE_FLOAT16_VALUE(    76.56), SIMDE_FLOAT16_VALUE(    50.91),
+          SIMDE_FLOAT16_VALUE(   -30.95), SIMDE_FLOAT16_VALUE(    38.53), SIMDE_FLOAT16_VALUE(    72.25), SIMDE_FLOAT16_VALUE(   -27.81) },
+      { SIMDE_FLOAT16_VALUE(    -5.66), SIMDE_FLOAT16_VALUE(     2.40), SIMDE_FLOAT16_VALUE(    88.94), SIMDE_FLOAT16_VALUE(   -10.59),
+          SIMDE_FLOAT16_VALUE(   -44.88), SIMDE_FLOAT16_VALUE(   -45.84), SIMDE_FLOAT16_VALUE(    29.66), SIMDE_FLOAT16_VALUE(    -4.20) },
+      { SIMDE_FLOAT32_C(   392.74), SIMDE_FLOAT32_C( -2526.68), SIMDE_FLOAT32_C(  2044.12), SIMDE_FLOAT32_C(  -237.04) } },
+    { { SIMDE_FLOAT32_C(  -347.87), SIMDE_FLOAT32_C(  -304.98), SIMDE_FLOAT32_C(  -620.68), SIMDE_FLOAT32_C(   863.38) },
+      { SIMDE_FLOAT16_VALUE(   -20.67), SIMDE_FLOAT16_VALUE(   -26.83), SIMDE_FLOAT16_VALUE(   -70.31), SIMDE_FLOAT16_VALUE(     8.84),
+          SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(    81.12), SIMDE_FLOAT16_VALUE(    57.84), SIMDE_FLOAT16_VALUE(     1.65) },
+      { SIMDE_FLOAT16_VALUE(    96.75), SIMDE_FLOAT16_VALUE(    45.53), SIMDE_FLOAT16_VALUE(   -40.72), SIMDE_FLOAT16_VALUE(   -34.19),
+          SIMDE_FLOAT16_VALUE(    28.53), SIMDE_FLOAT16_VALUE(    81.50), SIMDE_FLOAT16_VALUE(   -52.84), SIMDE_FLOAT16_VALUE(    73.81) },
+      { SIMDE_FLOAT32_C( -2880.02), SIMDE_FLOAT32_C(  6306.71), SIMDE_FLOAT32_C( -3677.36), SIMDE_FLOAT32_C(   985.20) } },
+    { { SIMDE_FLOAT32_C(    40.23), SIMDE_FLOAT32_C(  -132.91), SIMDE_FLOAT32_C(  -310.64), SIMDE_FLOAT32_C(  -651.04) },
+      { SIMDE_FLOAT16_VALUE(    11.54), SIMDE_FLOAT16_VALUE(    82.31), SIMDE_FLOAT16_VALUE(    -5.74), SIMDE_FLOAT16_VALUE(   -44.50),
+          SIMDE_FLOAT16_VALUE(    11.16), SIMDE_FLOAT16_VALUE(     1.57), SIMDE_FLOAT16_VALUE(    27.61), SIMDE_FLOAT16_VALUE(    69.19) },
+      { SIMDE_FLOAT16_VALUE(     5.58), SIMDE_FLOAT16_VALUE(   -62.00), SIMDE_FLOAT16_VALUE(   -62.44), SIMDE_FLOAT16_VALUE(    17.80),
+          SIMDE_FLOAT16_VALUE(     2.65), SIMDE_FLOAT16_VALUE(    93.62), SIMDE_FLOAT16_VALUE(    27.23), SIMDE_FLOAT16_VALUE(     3.63) },
+      { SIMDE_FLOAT32_C(    69.80), SIMDE_FLOAT32_C(    14.11), SIMDE_FLOAT32_C(   441.28), SIMDE_FLOAT32_C(  -399.83) } },
+    { { SIMDE_FLOAT32_C(   779.92), SIMDE_FLOAT32_C(    82.90), SIMDE_FLOAT32_C(   810.31), SIMDE_FLOAT32_C(  -129.13) },
+      { SIMDE_FLOAT16_VALUE(    -7.21), SIMDE_FLOAT16_VALUE(   -55.75), SIMDE_FLOAT16_VALUE(    11.48), SIMDE_FLOAT16_VALUE(    -8.47),
+          SIMDE_FLOAT16_VALUE(    35.84), SIMDE_FLOAT16_VALUE(    96.62), SIMDE_FLOAT16_VALUE(    80.00), SIMDE_FLOAT16_VALUE(    12.76) },
+      { SIMDE_FLOAT16_VALUE(     1.37), SIMDE_FLOAT16_VALUE(   -26.98), SIMDE_FLOAT16_VALUE(    -6.89), SIMDE_FLOAT16_VALUE(    13.68),
+          SIMDE_FLOAT16_VALUE(    91.50), SIMDE_FLOAT16_VALUE(    13.82), SIMDE_FLOAT16_VALUE(    28.94), SIMDE_FLOAT16_VALUE(    16.39) },
+      { SIMDE_FLOAT32_C(  4059.62), SIMDE_FLOAT32_C(  1418.29), SIMDE_FLOAT32_C(  3125.31), SIMDE_FLOAT32_C(    79.98) } },
+    { { SIMDE_FLOAT32_C(   840.03), SIMDE_FLOAT32_C(   431.55), SIMDE_FLOAT32_C(  -852.23), SIMDE_FLOAT32_C(   -11.22) },
+      { SIMDE_FLOAT16_VALUE(    33.88), SIMDE_FLOAT16_VALUE(    16.34), SIMDE_FLOAT16_VALUE(    74.81), SIMDE_FLOAT16_VALUE(   -56.50),
+          SIMDE_FLOAT16_VALUE(    28.73), SIMDE_FLOAT16_VALUE(    96.25), SIMDE_FLOAT16_VALUE(   -19.58), SIMDE_FLOAT16_VALUE(    16.97) },
+      { SIMDE_FLOAT16_VALUE(    22.27), SIMDE_FLOAT16_VALUE(     1.63), SIMDE_FLOAT16_VALUE(    -6.33), SIMDE_FLOAT16_VALUE(    44.94),
+          SIMDE_FLOAT16_VALUE(     7.80), SIMDE_FLOAT16_VALUE(   -55.72), SIMDE_FLOAT16_VALUE(    46.22), SIMDE_FLOAT16_VALUE(    80.19) },
+      { SIMDE_FLOAT32_C(  1064.18), SIMDE_FLOAT32_C( -4931.38), SIMDE_FLOAT32_C( -1757.11), SIMDE_FLOAT32_C(  1349.46) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t r = simde_vld1q_f32(test_vec[i].r);
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float32x4_t ret = simde_vfmlalq_high_f16(r, a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(ret, simde_vld1q_f32(test_vec[i].ret), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmlal_low_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmlal_high_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmlalq_low_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmlalq_high_f16)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
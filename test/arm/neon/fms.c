@@ -0,0 +1,423 @@
+#define SIMDE_TEST_ARM_NEON_INSN fms
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fms.h"
+
+static int
+test_simde_vfmsh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 c;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(  2050.00),
+      SIMDE_FLOAT16_VALUE(    1.001),
+      SIMDE_FLOAT16_VALUE(    0.999),
+      SIMDE_FLOAT16_VALUE(  2050.00) },
+    { SIMDE_FLOAT16_VALUE(  -617.00),
+      SIMDE_FLOAT16_VALUE(    26.50),
+      SIMDE_FLOAT16_VALUE(   -24.77),
+      SIMDE_FLOAT16_VALUE(    39.28) },
+    { SIMDE_FLOAT16_VALUE(   977.50),
+      SIMDE_FLOAT16_VALUE(   -28.81),
+      SIMDE_FLOAT16_VALUE(    25.09),
+      SIMDE_FLOAT16_VALUE(  1701.00) },
+    { SIMDE_FLOAT16_VALUE(  -698.50),
+      SIMDE_FLOAT16_VALUE(    29.55),
+      SIMDE_FLOAT16_VALUE(    -2.68),
+      SIMDE_FLOAT16_VALUE(  -619.50) },
+    { SIMDE_FLOAT16_VALUE(  -896.00),
+      SIMDE_FLOAT16_VALUE(    16.41),
+      SIMDE_FLOAT16_VALUE(    28.91),
+      SIMDE_FLOAT16_VALUE( -1370.00) },
+    { SIMDE_FLOAT16_VALUE(   875.50),
+      SIMDE_FLOAT16_VALUE(   -14.88),
+      SIMDE_FLOAT16_VALUE(    27.31),
+      SIMDE_FLOAT16_VALUE(  1282.00) },
+    { SIMDE_FLOAT16_VALUE(  -734.00),
+      SIMDE_FLOAT16_VALUE(    26.61),
+      SIMDE_FLOAT16_VALUE(   -16.62),
+      SIMDE_FLOAT16_VALUE(  -291.50) },
+    { SIMDE_FLOAT16_VALUE(  -326.50),
+      SIMDE_FLOAT16_VALUE(    11.61),
+      SIMDE_FLOAT16_VALUE(    20.05),
+      SIMDE_FLOAT16_VALUE(  -559.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vfmsh_f16(test_vec[i].a, test_vec[i].b, test_vec[i].c);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 c[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE(   111.50), SIMDE_FLOAT16_VALUE(  -155.62), SIMDE_FLOAT16_VALUE(   413.25) },
+      { SIMDE_FLOAT16_VALUE(    1.001), SIMDE_FLOAT16_VALUE(    -8.52), SIMDE_FLOAT16_VALUE(    -5.59), SIMDE_FLOAT16_VALUE(    14.91) },
+      { SIMDE_FLOAT16_VALUE(    0.999), SIMDE_FLOAT16_VALUE(    12.63), SIMDE_FLOAT16_VALUE(     9.53), SIMDE_FLOAT16_VALUE(    -5.13) },
+      { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE(   219.12), SIMDE_FLOAT16_VALUE(  -102.38), SIMDE_FLOAT16_VALUE(   489.75) } },
+    { { SIMDE_FLOAT16_VALUE(   771.50), SIMDE_FLOAT16_VALUE(   384.75), SIMDE_FLOAT16_VALUE(   523.50), SIMDE_FLOAT16_VALUE(  -671.00) },
+      { SIMDE_FLOAT16_VALUE(   -27.84), SIMDE_FLOAT16_VALUE(   -28.44), SIMDE_FLOAT16_VALUE(    -6.61), SIMDE_FLOAT16_VALUE(     6.11) },
+      { SIMDE_FLOAT16_VALUE(   -10.17), SIMDE_FLOAT16_VALUE(    13.08), SIMDE_FLOAT16_VALUE(     3.66), SIMDE_FLOAT16_VALUE(   -17.94) },
+      { SIMDE_FLOAT16_VALUE(   488.25), SIMDE_FLOAT16_VALUE(   756.50), SIMDE_FLOAT16_VALUE(   547.50), SIMDE_FLOAT16_VALUE(  -561.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -489.75), SIMDE_FLOAT16_VALUE(   921.50), SIMDE_FLOAT16_VALUE(  -735.50), SIMDE_FLOAT16_VALUE(    30.31) },
+      { SIMDE_FLOAT16_VALUE(    25.48), SIMDE_FLOAT16_VALUE(   -16.98), SIMDE_FLOAT16_VALUE(   -22.97), SIMDE_FLOAT16_VALUE(   -22.59) },
+      { SIMDE_FLOAT16_VALUE(    18.45), SIMDE_FLOAT16_VALUE(    14.06), SIMDE_FLOAT16_VALUE(    20.83), SIMDE_FLOAT16_VALUE(    26.22) },
+      { SIMDE_FLOAT16_VALUE(  -960.00), SIMDE_FLOAT16_VALUE(  1160.00), SIMDE_FLOAT16_VALUE(  -257.00), SIMDE_FLOAT16_VALUE(   622.50) } },
+    { { SIMDE_FLOAT16_VALUE(   177.38), SIMDE_FLOAT16_VALUE(  -574.00), SIMDE_FLOAT16_VALUE(   755.00), SIMDE_FLOAT16_VALUE(   975.50) },
+      { SIMDE_FLOAT16_VALUE(   -16.92), SIMDE_FLOAT16_VALUE(   -28.64), SIMDE_FLOAT16_VALUE(    13.41), SIMDE_FLOAT16_VALUE(    24.39) },
+      { SIMDE_FLOAT16_VALUE(    17.95), SIMDE_FLOAT16_VALUE(    19.45), SIMDE_FLOAT16_VALUE(   -16.44), SIMDE_FLOAT16_VALUE(     1.86) },
+      { SIMDE_FLOAT16_VALUE(   481.25), SIMDE_FLOAT16_VALUE(   -16.84), SIMDE_FLOAT16_VALUE(   975.50), SIMDE_FLOAT16_VALUE(   930.00) } },
+    { { SIMDE_FLOAT16_VALUE(     5.82), SIMDE_FLOAT16_VALUE(  -439.75), SIMDE_FLOAT16_VALUE(  -123.81), SIMDE_FLOAT16_VALUE(   -76.50) },
+      { SIMDE_FLOAT16_VALUE(    -5.69), SIMDE_FLOAT16_VALUE(     7.91), SIMDE_FLOAT16_VALUE(    25.80), SIMDE_FLOAT16_VALUE(     0.54) },
+      { SIMDE_FLOAT16_VALUE(   -15.20), SIMDE_FLOAT16_VALUE(   -11.64), SIMDE_FLOAT16_VALUE(    29.73), SIMDE_FLOAT16_VALUE(    20.22) },
+      { SIMDE_FLOAT16_VALUE(   -80.69), SIMDE_FLOAT16_VALUE(  -347.75), SIMDE_FLOAT16_VALUE(  -891.00), SIMDE_FLOAT16_VALUE(   -87.44) } },
+    { { SIMDE_FLOAT16_VALUE(   708.50), SIMDE_FLOAT16_VALUE(   969.00), SIMDE_FLOAT16_VALUE(   413.25), SIMDE_FLOAT16_VALUE(   865.50) },
+      { SIMDE_FLOAT16_VALUE(    -1.96), SIMDE_FLOAT16_VALUE(    23.38), SIMDE_FLOAT16_VALUE(   -24.25), SIMDE_FLOAT16_VALUE(   -25.55) },
+      { SIMDE_FLOAT16_VALUE(   -12.96), SIMDE_FLOAT16_VALUE(    25.59), SIMDE_FLOAT16_VALUE(    14.52), SIMDE_FLOAT16_VALUE(    -5.95) },
+      { SIMDE_FLOAT16_VALUE(   683.00), SIMDE_FLOAT16_VALUE(   370.75), SIMDE_FLOAT16_VALUE(   765.50), SIMDE_FLOAT16_VALUE(   713.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -996.50), SIMDE_FLOAT16_VALUE(   -11.37), SIMDE_FLOAT16_VALUE(  -845.50), SIMDE_FLOAT16_VALUE(  -714.00) },
+      { SIMDE_FLOAT16_VALUE(    -2.37), SIMDE_FLOAT16_VALUE(     6.78), SIMDE_FLOAT16_VALUE(    -0.28), SIMDE_FLOAT16_VALUE(   -11.97) },
+      { SIMDE_FLOAT16_VALUE(    25.69), SIMDE_FLOAT16_VALUE(    22.95), SIMDE_FLOAT16_VALUE(    21.06), SIMDE_FLOAT16_VALUE(   -23.84) },
+      { SIMDE_FLOAT16_VALUE(  -935.50), SIMDE_FLOAT16_VALUE(  -167.00), SIMDE_FLOAT16_VALUE(  -839.50), SIMDE_FLOAT16_VALUE(  -999.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -149.38), SIMDE_FLOAT16_VALUE(  -298.50), SIMDE_FLOAT16_VALUE(  -170.12), SIMDE_FLOAT16_VALUE(  -393.25) },
+      { SIMDE_FLOAT16_VALUE(     4.08), SIMDE_FLOAT16_VALUE(    -8.75), SIMDE_FLOAT16_VALUE(   -17.55), SIMDE_FLOAT16_VALUE(   -18.31) },
+      { SIMDE_FLOAT16_VALUE(     6.70), SIMDE_FLOAT16_VALUE(    15.20), SIMDE_FLOAT16_VALUE(    -7.16), SIMDE_FLOAT16_VALUE(     6.35) },
+      { SIMDE_FLOAT16_VALUE(  -176.75), SIMDE_FLOAT16_VALUE(  -165.50), SIMDE_FLOAT16_VALUE(  -295.75), SIMDE_FLOAT16_VALUE(  -277.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t c = simde_vld1_f16(test_vec[i].c);
+    simde_float16x4_t r = simde_vfms_f16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -402.57), SIMDE_FLOAT32_C(  -451.87) },
+      { SIMDE_FLOAT32_C(    49.03), SIMDE_FLOAT32_C(   -66.25) },
+      { SIMDE_FLOAT32_C(   -23.41), SIMDE_FLOAT32_C(   -87.51) },
+      { SIMDE_FLOAT32_C(   745.22), SIMDE_FLOAT32_C( -6249.41) } },
+    { { SIMDE_FLOAT32_C(   540.82), SIMDE_FLOAT32_C(  -449.91) },
+      { SIMDE_FLOAT32_C(    68.54), SIMDE_FLOAT32_C(    69.74) },
+      { SIMDE_FLOAT32_C(   -31.09), SIMDE_FLOAT32_C(   -24.98) },
+      { SIMDE_FLOAT32_C(  2671.73), SIMDE_FLOAT32_C(  1292.20) } },
+    { { SIMDE_FLOAT32_C(  -728.22), SIMDE_FLOAT32_C(  -726.04) },
+      { SIMDE_FLOAT32_C(   -33.41), SIMDE_FLOAT32_C(   -86.60) },
+      { SIMDE_FLOAT32_C(    -2.57), SIMDE_FLOAT32_C(   -48.87) },
+      { SIMDE_FLOAT32_C(  -814.08), SIMDE_FLOAT32_C( -4958.18) } },
+    { { SIMDE_FLOAT32_C(  -904.53), SIMDE_FLOAT32_C(  -716.85) },
+      { SIMDE_FLOAT32_C(   -90.38), SIMDE_FLOAT32_C(   -78.52) },
+      { SIMDE_FLOAT32_C(    96.06), SIMDE_FLOAT32_C(    12.27) },
+      { SIMDE_FLOAT32_C(  7777.37), SIMDE_FLOAT32_C(   246.59) } },
+    { { SIMDE_FLOAT32_C(   633.29), SIMDE_FLOAT32_C(   345.28) },
+      { SIMDE_FLOAT32_C(   -38.19), SIMDE_FLOAT32_C(    14.42) },
+      { SIMDE_FLOAT32_C(   -99.78), SIMDE_FLOAT32_C(    54.76) },
+      { SIMDE_FLOAT32_C( -3177.31), SIMDE_FLOAT32_C(  -444.36) } },
+    { { SIMDE_FLOAT32_C(   741.95), SIMDE_FLOAT32_C(    48.37) },
+      { SIMDE_FLOAT32_C(    51.17), SIMDE_FLOAT32_C(    -8.15) },
+      { SIMDE_FLOAT32_C(    29.55), SIMDE_FLOAT32_C(    84.12) },
+      { SIMDE_FLOAT32_C(  -770.12), SIMDE_FLOAT32_C(   733.95) } },
+    { { SIMDE_FLOAT32_C(  -449.61), SIMDE_FLOAT32_C(   807.40) },
+      { SIMDE_FLOAT32_C(   -84.76), SIMDE_FLOAT32_C(    12.33) },
+      { SIMDE_FLOAT32_C(    14.43), SIMDE_FLOAT32_C(    63.90) },
+      { SIMDE_FLOAT32_C(   773.48), SIMDE_FLOAT32_C(    19.51) } },
+    { { SIMDE_FLOAT32_C(  -711.62), SIMDE_FLOAT32_C(   682.18) },
+      { SIMDE_FLOAT32_C(    88.76), SIMDE_FLOAT32_C(    58.47) },
+      { SIMDE_FLOAT32_C(    74.94), SIMDE_FLOAT32_C(    38.61) },
+      { SIMDE_FLOAT32_C( -7363.29), SIMDE_FLOAT32_C( -1575.35) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+    simde_float32x2_t r = simde_vfms_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    47.73) },
+      { SIMDE_FLOAT64_C(    35.93) },
+      { SIMDE_FLOAT64_C(   -80.38) },
+      { SIMDE_FLOAT64_C(  2935.78) } },
+    { { SIMDE_FLOAT64_C(  -799.92) },
+      { SIMDE_FLOAT64_C(    67.39) },
+      { SIMDE_FLOAT64_C(   -52.13) },
+      { SIMDE_FLOAT64_C(  2713.12) } },
+    { { SIMDE_FLOAT64_C(  -116.12) },
+      { SIMDE_FLOAT64_C(    10.97) },
+      { SIMDE_FLOAT64_C(   -49.04) },
+      { SIMDE_FLOAT64_C(   421.85) } },
+    { { SIMDE_FLOAT64_C(  -142.71) },
+      { SIMDE_FLOAT64_C(    -8.17) },
+      { SIMDE_FLOAT64_C(    22.16) },
+      { SIMDE_FLOAT64_C(    38.34) } },
+    { { SIMDE_FLOAT64_C(  -379.19) },
+      { SIMDE_FLOAT64_C(    10.29) },
+      { SIMDE_FLOAT64_C(   -72.35) },
+      { SIMDE_FLOAT64_C(   365.29) } },
+    { { SIMDE_FLOAT64_C(   200.32) },
+      { SIMDE_FLOAT64_C(    86.45) },
+      { SIMDE_FLOAT64_C(   -37.87) },
+      { SIMDE_FLOAT64_C(  3474.18) } },
+    { { SIMDE_FLOAT64_C(   936.43) },
+      { SIMDE_FLOAT64_C(   -91.50) },
+      { SIMDE_FLOAT64_C(   -26.25) },
+      { SIMDE_FLOAT64_C( -1465.45) } },
+    { { SIMDE_FLOAT64_C(   672.52) },
+      { SIMDE_FLOAT64_C(    53.24) },
+      { SIMDE_FLOAT64_C(    72.84) },
+      { SIMDE_FLOAT64_C( -3205.48) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x1_t r = simde_vfms_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 c[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE(  -713.50), SIMDE_FLOAT16_VALUE(   823.50), SIMDE_FLOAT16_VALUE(  -117.06),
+          SIMDE_FLOAT16_VALUE(   425.00), SIMDE_FLOAT16_VALUE(  -233.25), SIMDE_FLOAT16_VALUE(   333.00), SIMDE_FLOAT16_VALUE(   865.50) },
+      { SIMDE_FLOAT16_VALUE(    1.001), SIMDE_FLOAT16_VALUE(   -26.88), SIMDE_FLOAT16_VALUE(   -19.16), SIMDE_FLOAT16_VALUE(    26.20),
+          SIMDE_FLOAT16_VALUE(   -21.81), SIMDE_FLOAT16_VALUE(     2.03), SIMDE_FLOAT16_VALUE(    18.48), SIMDE_FLOAT16_VALUE(   -25.94) },
+      { SIMDE_FLOAT16_VALUE(    0.999), SIMDE_FLOAT16_VALUE(    23.02), SIMDE_FLOAT16_VALUE(   -22.81), SIMDE_FLOAT16_VALUE(     9.99),
+          SIMDE_FLOAT16_VALUE(   -20.06), SIMDE_FLOAT16_VALUE(    20.91), SIMDE_FLOAT16_VALUE(   -15.51), SIMDE_FLOAT16_VALUE(    -5.93) },
+      { SIMDE_FLOAT16_VALUE(  2050.00), SIMDE_FLOAT16_VALUE(   -94.94), SIMDE_FLOAT16_VALUE(   386.50), SIMDE_FLOAT16_VALUE(  -379.00),
+          SIMDE_FLOAT16_VALUE(   -12.61), SIMDE_FLOAT16_VALUE(  -275.75), SIMDE_FLOAT16_VALUE(   619.50), SIMDE_FLOAT16_VALUE(   711.50) } },
+    { { SIMDE_FLOAT16_VALUE(   399.25), SIMDE_FLOAT16_VALUE(   661.00), SIMDE_FLOAT16_VALUE(  -389.50), SIMDE_FLOAT16_VALUE(  -105.50),
+          SIMDE_FLOAT16_VALUE(  -259.25), SIMDE_FLOAT16_VALUE(   661.00), SIMDE_FLOAT16_VALUE(  -945.50), SIMDE_FLOAT16_VALUE(  -100.50) },
+      { SIMDE_FLOAT16_VALUE(     2.65), SIMDE_FLOAT16_VALUE(    -1.95), SIMDE_FLOAT16_VALUE(    -2.32), SIMDE_FLOAT16_VALUE(   -12.41),
+          SIMDE_FLOAT16_VALUE(    28.62), SIMDE_FLOAT16_VALUE(   -27.27), SIMDE_FLOAT16_VALUE(    25.73), SIMDE_FLOAT16_VALUE(   -19.56) },
+      { SIMDE_FLOAT16_VALUE(    25.06), SIMDE_FLOAT16_VALUE(    23.94), SIMDE_FLOAT16_VALUE(    14.27), SIMDE_FLOAT16_VALUE(   -15.84),
+          SIMDE_FLOAT16_VALUE(    -0.96), SIMDE_FLOAT16_VALUE(    16.23), SIMDE_FLOAT16_VALUE(    -1.46), SIMDE_FLOAT16_VALUE(    18.83) },
+      { SIMDE_FLOAT16_VALUE(   332.75), SIMDE_FLOAT16_VALUE(   707.50), SIMDE_FLOAT16_VALUE(  -356.50), SIMDE_FLOAT16_VALUE(  -302.00),
+          SIMDE_FLOAT16_VALUE(  -231.75), SIMDE_FLOAT16_VALUE(  1104.00), SIMDE_FLOAT16_VALUE(  -908.00), SIMDE_FLOAT16_VALUE(   267.75) } },
+    { { SIMDE_FLOAT16_VALUE(  -416.00), SIMDE_FLOAT16_VALUE(  -986.50), SIMDE_FLOAT16_VALUE(   610.50), SIMDE_FLOAT16_VALUE(   659.50),
+          SIMDE_FLOAT16_VALUE(   778.00), SIMDE_FLOAT16_VALUE(  -418.50), SIMDE_FLOAT16_VALUE(  -930.00), SIMDE_FLOAT16_VALUE(   837.50) },
+      { SIMDE_FLOAT16_VALUE(     9.19), SIMDE_FLOAT16_VALUE(    25.27), SIMDE_FLOAT16_VALUE(   -29.66), SIMDE_FLOAT16_VALUE(    21.14),
+          SIMDE_FLOAT16_VALUE(   -18.52), SIMDE_FLOAT16_VALUE(    -9.40), SIMDE_FLOAT16_VALUE(    26.56), SIMDE_FLOAT16_VALUE(     1.70) },
+      { SIMDE_FLOAT16_VALUE(   -13.48), SIMDE_FLOAT16_VALUE(     1.55), SIMDE_FLOAT16_VALUE(    20.34), SIMDE_FLOAT16_VALUE(   -19.31),
+          SIMDE_FLOAT16_VALUE(    24.95), SIMDE_FLOAT16_VALUE(     9.51), SIMDE_FLOAT16_VALUE(    -7.38), SIMDE_FLOAT16_VALUE(   -20.61) },
+      { SIMDE_FLOAT16_VALUE(  -292.25), SIMDE_FLOAT16_VALUE( -1026.00), SIMDE_FLOAT16_VALUE(  1214.00), SIMDE_FLOAT16_VALUE(  1068.00),
+          SIMDE_FLOAT16_VALUE(  1240.00), SIMDE_FLOAT16_VALUE(  -329.25), SIMDE_FLOAT16_VALUE(  -734.00), SIMDE_FLOAT16_VALUE(   872.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -313.00), SIMDE_FLOAT16_VALUE(  -570.50), SIMDE_FLOAT16_VALUE(  -873.50), SIMDE_FLOAT16_VALUE(   963.00),
+          SIMDE_FLOAT16_VALUE(   585.50), SIMDE_FLOAT16_VALUE(   246.00), SIMDE_FLOAT16_VALUE(  -602.50), SIMDE_FLOAT16_VALUE(  -379.50) },
+      { SIMDE_FLOAT16_VALUE(   -26.66), SIMDE_FLOAT16_VALUE(    29.98), SIMDE_FLOAT16_VALUE(   -14.34), SIMDE_FLOAT16_VALUE(   -27.62),
+          SIMDE_FLOAT16_VALUE(    18.72), SIMDE_FLOAT16_VALUE(    -5.45), SIMDE_FLOAT16_VALUE(    -6.61), SIMDE_FLOAT16_VALUE(    -3.62) },
+      { SIMDE_FLOAT16_VALUE(    15.92), SIMDE_FLOAT16_VALUE(    22.69), SIMDE_FLOAT16_VALUE(    10.23), SIMDE_FLOAT16_VALUE(     6.03),
+          SIMDE_FLOAT16_VALUE(     3.01), SIMDE_FLOAT16_VALUE(   -23.22), SIMDE_FLOAT16_VALUE(     6.59), SIMDE_FLOAT16_VALUE(     3.93) },
+      { SIMDE_FLOAT16_VALUE(   111.44), SIMDE_FLOAT16_VALUE( -1251.00), SIMDE_FLOAT16_VALUE(  -727.00), SIMDE_FLOAT16_VALUE(  1130.00),
+          SIMDE_FLOAT16_VALUE(   529.00), SIMDE_FLOAT16_VALUE(   119.50), SIMDE_FLOAT16_VALUE(  -559.00), SIMDE_FLOAT16_VALUE(  -365.25) } },
+    { { SIMDE_FLOAT16_VALUE(   418.50), SIMDE_FLOAT16_VALUE(  -422.00), SIMDE_FLOAT16_VALUE(   156.75), SIMDE_FLOAT16_VALUE(  -427.50),
+          SIMDE_FLOAT16_VALUE(  -112.38), SIMDE_FLOAT16_VALUE(  -878.00), SIMDE_FLOAT16_VALUE(  -327.00), SIMDE_FLOAT16_VALUE(  -241.75) },
+      { SIMDE_FLOAT16_VALUE(     1.89), SIMDE_FLOAT16_VALUE(    29.12), SIMDE_FLOAT16_VALUE(    11.84), SIMDE_FLOAT16_VALUE(   -20.81),
+          SIMDE_FLOAT16_VALUE(   -21.77), SIMDE_FLOAT16_VALUE(    -1.84), SIMDE_FLOAT16_VALUE(   -27.56), SIMDE_FLOAT16_VALUE(     2.84) },
+      { SIMDE_FLOAT16_VALUE(     1.86), SIMDE_FLOAT16_VALUE(    -2.02), SIMDE_FLOAT16_VALUE(    17.61), SIMDE_FLOAT16_VALUE(    14.14),
+          SIMDE_FLOAT16_VALUE(     6.89), SIMDE_FLOAT16_VALUE(   -23.86), SIMDE_FLOAT16_VALUE(     1.49), SIMDE_FLOAT16_VALUE(    23.03) },
+      { SIMDE_FLOAT16_VALUE(   415.00), SIMDE_FLOAT16_VALUE(  -363.25), SIMDE_FLOAT16_VALUE(   -51.81), SIMDE_FLOAT16_VALUE(  -133.25),
+          SIMDE_FLOAT16_VALUE(    37.59), SIMDE_FLOAT16_VALUE(  -922.00), SIMDE_FLOAT16_VALUE(  -286.00), SIMDE_FLOAT16_VALUE(  -307.25) } },
+    { { SIMDE_FLOAT16_VALUE(   692.50), SIMDE_FLOAT16_VALUE(  -968.00), SIMDE_FLOAT16_VALUE(   765.00), SIMDE_FLOAT16_VALUE(  -862.50),
+          SIMDE_FLOAT16_VALUE(  -999.50), SIMDE_FLOAT16_VALUE(   703.50), SIMDE_FLOAT16_VALUE( -1000.00), SIMDE_FLOAT16_VALUE(  -954.50) },
+      { SIMDE_FLOAT16_VALUE(    27.44), SIMDE_FLOAT16_VALUE(    18.94), SIMDE_FLOAT16_VALUE(   -15.97), SIMDE_FLOAT16_VALUE(    19.34),
+          SIMDE_FLOAT16_VALUE(    15.81), SIMDE_FLOAT16_VALUE(    15.42), SIMDE_FLOAT16_VALUE(   -21.69), SIMDE_FLOAT16_VALUE(     9.97) },
+      { SIMDE_FLOAT16_VALUE(   -18.69), SIMDE_FLOAT16_VALUE(   -19.69), SIMDE_FLOAT16_VALUE(   -25.12), SIMDE_FLOAT16_VALUE(   -22.20),
+          SIMDE_FLOAT16_VALUE(   -14.62), SIMDE_FLOAT16_VALUE(   -15.67), SIMDE_FLOAT16_VALUE(   -11.27), SIMDE_FLOAT16_VALUE(    -9.63) },
+      { SIMDE_FLOAT16_VALUE(  1205.00), SIMDE_FLOAT16_VALUE(  -595.00), SIMDE_FLOAT16_VALUE(   363.75), SIMDE_FLOAT16_VALUE(  -433.00),
+          SIMDE_FLOAT16_VALUE(  -768.50), SIMDE_FLOAT16_VALUE(   945.00), SIMDE_FLOAT16_VALUE( -1244.00), SIMDE_FLOAT16_VALUE(  -858.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -190.38), SIMDE_FLOAT16_VALUE(   887.00), SIMDE_FLOAT16_VALUE(  -495.50), SIMDE_FLOAT16_VALUE(   685.00),
+          SIMDE_FLOAT16_VALUE(  -642.50), SIMDE_FLOAT16_VALUE(   165.62), SIMDE_FLOAT16_VALUE(  -624.00), SIMDE_FLOAT16_VALUE(     2.68) },
+      { SIMDE_FLOAT16_VALUE(    24.12), SIMDE_FLOAT16_VALUE(    26.52), SIMDE_FLOAT16_VALUE(    22.70), SIMDE_FLOAT16_VALUE(    19.00),
+          SIMDE_FLOAT16_VALUE(   -18.09), SIMDE_FLOAT16_VALUE(    27.33), SIMDE_FLOAT16_VALUE(   -10.61), SIMDE_FLOAT16_VALUE(    20.42) },
+      { SIMDE_FLOAT16_VALUE(   -20.39), SIMDE_FLOAT16_VALUE(   -27.31), SIMDE_FLOAT16_VALUE(    10.57), SIMDE_FLOAT16_VALUE(    -5.29),
+          SIMDE_FLOAT16_VALUE(    17.80), SIMDE_FLOAT16_VALUE(    18.25), SIMDE_FLOAT16_VALUE(    -2.26), SIMDE_FLOAT16_VALUE(     6.43) },
+      { SIMDE_FLOAT16_VALUE(   301.50), SIMDE_FLOAT16_VALUE(  1611.00), SIMDE_FLOAT16_VALUE(  -735.50), SIMDE_FLOAT16_VALUE(   785.50),
+          SIMDE_FLOAT16_VALUE(  -320.50), SIMDE_FLOAT16_VALUE(  -333.00), SIMDE_FLOAT16_VALUE(  -648.00), SIMDE_FLOAT16_VALUE(  -128.62) } },
+    { { SIMDE_FLOAT16_VALUE(  -661.00), SIMDE_FLOAT16_VALUE(   645.50), SIMDE_FLOAT16_VALUE(  -685.50), SIMDE_FLOAT16_VALUE(  -806.50),
+          SIMDE_FLOAT16_VALUE(    25.62), SIMDE_FLOAT16_VALUE(  -938.00), SIMDE_FLOAT16_VALUE(  -340.25), SIMDE_FLOAT16_VALUE(  -327.25) },
+      { SIMDE_FLOAT16_VALUE(    -1.43), SIMDE_FLOAT16_VALUE(    -1.02), SIMDE_FLOAT16_VALUE(     0.13), SIMDE_FLOAT16_VALUE(    13.71),
+          SIMDE_FLOAT16_VALUE(   -18.08), SIMDE_FLOAT16_VALUE(    27.58), SIMDE_FLOAT16_VALUE(    25.69), SIMDE_FLOAT16_VALUE(    28.80) },
+      { SIMDE_FLOAT16_VALUE(    20.45), SIMDE_FLOAT16_VALUE(   -15.54), SIMDE_FLOAT16_VALUE(    -1.52), SIMDE_FLOAT16_VALUE(    25.47),
+          SIMDE_FLOAT16_VALUE(   -14.76), SIMDE_FLOAT16_VALUE(     9.02), SIMDE_FLOAT16_VALUE(     0.72), SIMDE_FLOAT16_VALUE(   -10.02) },
+      { SIMDE_FLOAT16_VALUE(  -632.00), SIMDE_FLOAT16_VALUE(   629.50), SIMDE_FLOAT16_VALUE(  -685.50), SIMDE_FLOAT16_VALUE( -1156.00),
+          SIMDE_FLOAT16_VALUE(  -241.12), SIMDE_FLOAT16_VALUE( -1187.00), SIMDE_FLOAT16_VALUE(  -358.75), SIMDE_FLOAT16_VALUE(   -38.59) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t c = simde_vld1q_f16(test_vec[i].c);
+    simde_float16x8_t r = simde_vfmsq_f16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -140.15), SIMDE_FLOAT32_C(  -882.87), SIMDE_FLOAT32_C(  -504.66), SIMDE_FLOAT32_C(  -243.11) },
+      { SIMDE_FLOAT32_C(    35.87), SIMDE_FLOAT32_C(    43.80), SIMDE_FLOAT32_C(   -51.70), SIMDE_FLOAT32_C(    58.74) },
+      { SIMDE_FLOAT32_C(   -60.14), SIMDE_FLOAT32_C(    69.09), SIMDE_FLOAT32_C(    81.84), SIMDE_FLOAT32_C(    36.52) },
+      { SIMDE_FLOAT32_C(  2017.07), SIMDE_FLOAT32_C( -3909.01), SIMDE_FLOAT32_C(  3726.47), SIMDE_FLOAT32_C( -2388.29) } },
+    { { SIMDE_FLOAT32_C(     4.86), SIMDE_FLOAT32_C(   214.20), SIMDE_FLOAT32_C(  -955.43), SIMDE_FLOAT32_C(  -366.68) },
+      { SIMDE_FLOAT32_C(    43.77), SIMDE_FLOAT32_C(    46.59), SIMDE_FLOAT32_C(    27.19), SIMDE_FLOAT32_C(    34.18) },
+      { SIMDE_FLOAT32_C(   -27.47), SIMDE_FLOAT32_C(    -0.81), SIMDE_FLOAT32_C(     4.55), SIMDE_FLOAT32_C(    69.73) },
+      { SIMDE_FLOAT32_C(  1207.22), SIMDE_FLOAT32_C(   251.94), SIMDE_FLOAT32_C( -1079.14), SIMDE_FLOAT32_C( -2750.05) } },
+    { { SIMDE_FLOAT32_C(    82.96), SIMDE_FLOAT32_C(  -199.81), SIMDE_FLOAT32_C(   815.16), SIMDE_FLOAT32_C(   641.23) },
+      { SIMDE_FLOAT32_C(     5.46), SIMDE_FLOAT32_C(   -85.80), SIMDE_FLOAT32_C(    68.63), SIMDE_FLOAT32_C(     1.18) },
+      { SIMDE_FLOAT32_C(    72.06), SIMDE_FLOAT32_C(   -95.83), SIMDE_FLOAT32_C(   -84.23), SIMDE_FLOAT32_C(   -19.32) },
+      { SIMDE_FLOAT32_C(  -310.49), SIMDE_FLOAT32_C( -8422.02), SIMDE_FLOAT32_C(  6595.86), SIMDE_FLOAT32_C(   664.03) } },
+    { { SIMDE_FLOAT32_C(   841.89), SIMDE_FLOAT32_C(  -786.73), SIMDE_FLOAT32_C(   540.63), SIMDE_FLOAT32_C(   749.58) },
+      { SIMDE_FLOAT32_C(    50.09), SIMDE_FLOAT32_C(   -60.27), SIMDE_FLOAT32_C(    31.29), SIMDE_FLOAT32_C(   -32.36) },
+      { SIMDE_FLOAT32_C(    76.62), SIMDE_FLOAT32_C(    22.51), SIMDE_FLOAT32_C(     7.59), SIMDE_FLOAT32_C(    92.17) },
+      { SIMDE_FLOAT32_C( -2996.01), SIMDE_FLOAT32_C(   569.95), SIMDE_FLOAT32_C(   303.14), SIMDE_FLOAT32_C(  3732.20) } },
+    { { SIMDE_FLOAT32_C(   459.82), SIMDE_FLOAT32_C(  -536.88), SIMDE_FLOAT32_C(   944.11), SIMDE_FLOAT32_C(  -835.76) },
+      { SIMDE_FLOAT32_C(    27.00), SIMDE_FLOAT32_C(    -2.05), SIMDE_FLOAT32_C(     1.67), SIMDE_FLOAT32_C(    81.04) },
+      { SIMDE_FLOAT32_C(   -33.51), SIMDE_FLOAT32_C(   -93.27), SIMDE_FLOAT32_C(    -0.03), SIMDE_FLOAT32_C(   -40.04) },
+      { SIMDE_FLOAT32_C(  1364.59), SIMDE_FLOAT32_C(  -728.08), SIMDE_FLOAT32_C(   944.16), SIMDE_FLOAT32_C(  2409.08) } },
+    { { SIMDE_FLOAT32_C(  -907.77), SIMDE_FLOAT32_C(  -240.82), SIMDE_FLOAT32_C(   974.33), SIMDE_FLOAT32_C(  -936.26) },
+      { SIMDE_FLOAT32_C(   -10.35), SIMDE_FLOAT32_C(    81.86), SIMDE_FLOAT32_C(   -89.57), SIMDE_FLOAT32_C(   -51.89) },
+      { SIMDE_FLOAT32_C(   -60.37), SIMDE_FLOAT32_C(   -30.09), SIMDE_FLOAT32_C(    57.42), SIMDE_FLOAT32_C(    14.52) },
+      { SIMDE_FLOAT32_C( -1532.60), SIMDE_FLOAT32_C(  2222.35), SIMDE_FLOAT32_C(  6117.44), SIMDE_FLOAT32_C(  -182.82) } },
+    { { SIMDE_FLOAT32_C(  -147.49), SIMDE_FLOAT32_C(   684.04), SIMDE_FLOAT32_C(  -963.76), SIMDE_FLOAT32_C(   383.47) },
+      { SIMDE_FLOAT32_C(   -48.72), SIMDE_FLOAT32_C(   -27.12), SIMDE_FLOAT32_C(   -97.05), SIMDE_FLOAT32_C(    14.29) },
+      { SIMDE_FLOAT32_C(    38.83), SIMDE_FLOAT32_C(    36.36), SIMDE_FLOAT32_C(    90.05), SIMDE_FLOAT32_C(   -70.16) },
+      { SIMDE_FLOAT32_C(  1744.31), SIMDE_FLOAT32_C(  1670.12), SIMDE_FLOAT32_C(  7775.59), SIMDE_FLOAT32_C(  1386.06) } },
+    { { SIMDE_FLOAT32_C(   914.06), SIMDE_FLOAT32_C(  -151.47), SIMDE_FLOAT32_C(   268.03), SIMDE_FLOAT32_C(   293.13) },
+      { SIMDE_FLOAT32_C(   -97.48), SIMDE_FLOAT32_C(   -16.16), SIMDE_FLOAT32_C(    77.41), SIMDE_FLOAT32_C(    67.90) },
+      { SIMDE_FLOAT32_C(    17.00), SIMDE_FLOAT32_C(     4.86), SIMDE_FLOAT32_C(    35.97), SIMDE_FLOAT32_C(    15.59) },
+      { SIMDE_FLOAT32_C(  2571.22), SIMDE_FLOAT32_C(   -72.93), SIMDE_FLOAT32_C( -2516.41), SIMDE_FLOAT32_C(  -765.43) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+    simde_float32x4_t r = simde_vfmsq_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -237.61), SIMDE_FLOAT64_C(   621.35) },
+      { SIMDE_FLOAT64_C(   -35.04), SIMDE_FLOAT64_C(    44.63) },
+      { SIMDE_FLOAT64_C(    33.06), SIMDE_FLOAT64_C(    80.58) },
+      { SIMDE_FLOAT64_C(   920.81), SIMDE_FLOAT64_C( -2974.94) } },
+    { { SIMDE_FLOAT64_C(  -812.50), SIMDE_FLOAT64_C(   815.70) },
+      { SIMDE_FLOAT64_C(    52.13), SIMDE_FLOAT64_C(   -13.89) },
+      { SIMDE_FLOAT64_C(    90.40), SIMDE_FLOAT64_C(    -5.42) },
+      { SIMDE_FLOAT64_C( -5525.05), SIMDE_FLOAT64_C(   740.42) } },
+    { { SIMDE_FLOAT64_C(  -176.72), SIMDE_FLOAT64_C(   136.26) },
+      { SIMDE_FLOAT64_C(    22.63), SIMDE_FLOAT64_C(   -86.50) },
+      { SIMDE_FLOAT64_C(    -2.78), SIMDE_FLOAT64_C(    -1.84) },
+      { SIMDE_FLOAT64_C(  -113.81), SIMDE_FLOAT64_C(   -22.90) } },
+    { { SIMDE_FLOAT64_C(   -48.61), SIMDE_FLOAT64_C(   806.08) },
+      { SIMDE_FLOAT64_C(   -68.99), SIMDE_FLOAT64_C(    99.56) },
+      { SIMDE_FLOAT64_C(   -59.25), SIMDE_FLOAT64_C(     5.94) },
+      { SIMDE_FLOAT64_C( -4136.27), SIMDE_FLOAT64_C(   214.69) } },
+    { { SIMDE_FLOAT64_C(   584.20), SIMDE_FLOAT64_C(  -422.12) },
+      { SIMDE_FLOAT64_C(   -86.82), SIMDE_FLOAT64_C(   -24.30) },
+      { SIMDE_FLOAT64_C(   -96.64), SIMDE_FLOAT64_C(   -49.57) },
+      { SIMDE_FLOAT64_C( -7806.08), SIMDE_FLOAT64_C( -1626.67) } },
+    { { SIMDE_FLOAT64_C(   810.07), SIMDE_FLOAT64_C(  -708.90) },
+      { SIMDE_FLOAT64_C(    40.53), SIMDE_FLOAT64_C(    46.45) },
+      { SIMDE_FLOAT64_C(    -0.46), SIMDE_FLOAT64_C(   -49.95) },
+      { SIMDE_FLOAT64_C(   828.71), SIMDE_FLOAT64_C(  1611.28) } },
+    { { SIMDE_FLOAT64_C(   957.05), SIMDE_FLOAT64_C(   899.70) },
+      { SIMDE_FLOAT64_C(   -59.46), SIMDE_FLOAT64_C(    47.34) },
+      { SIMDE_FLOAT64_C(   -90.66), SIMDE_FLOAT64_C(    -9.71) },
+      { SIMDE_FLOAT64_C( -4433.59), SIMDE_FLOAT64_C(  1359.37) } },
+    { { SIMDE_FLOAT64_C(  -560.23), SIMDE_FLOAT64_C(   234.51) },
+      { SIMDE_FLOAT64_C(    11.58), SIMDE_FLOAT64_C(   -62.31) },
+      { SIMDE_FLOAT64_C(   -13.44), SIMDE_FLOAT64_C(   -18.31) },
+      { SIMDE_FLOAT64_C(  -404.59), SIMDE_FLOAT64_C(  -906.39) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+    simde_float64x2_t r = simde_vfmsq_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmsh_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfms_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfms_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfms_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,652 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld2_dup
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld2_dup.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vld2_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t buf[2];
+    simde_float32_t r[2][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   776.54), SIMDE_FLOAT32_C(  -200.01) },
+      { { SIMDE_FLOAT32_C(   776.54), SIMDE_FLOAT32_C(   776.54) },
+        { SIMDE_FLOAT32_C(  -200.01), SIMDE_FLOAT32_C(  -200.01) } } },
+    { { SIMDE_FLOAT32_C(   177.24), SIMDE_FLOAT32_C(   719.57) },
+      { { SIMDE_FLOAT32_C(   177.24), SIMDE_FLOAT32_C(   177.24) },
+        { SIMDE_FLOAT32_C(   719.57), SIMDE_FLOAT32_C(   719.57) } } },
+    { { SIMDE_FLOAT32_C(  -542.92), SIMDE_FLOAT32_C(    31.43) },
+      { { SIMDE_FLOAT32_C(  -542.92), SIMDE_FLOAT32_C(  -542.92) },
+        { SIMDE_FLOAT32_C(    31.43), SIMDE_FLOAT32_C(    31.43) } } },
+    { { SIMDE_FLOAT32_C(   167.46), SIMDE_FLOAT32_C(   894.40) },
+      { { SIMDE_FLOAT32_C(   167.46), SIMDE_FLOAT32_C(   167.46) },
+        { SIMDE_FLOAT32_C(   894.40), SIMDE_FLOAT32_C(   894.40) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t r = simde_vld2_dup_f32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t buf[2];
+    simde_float64_t r[2][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -935.64), SIMDE_FLOAT64_C(  -862.11) },
+      { { SIMDE_FLOAT64_C(  -935.64) },
+        { SIMDE_FLOAT64_C(  -862.11) } } },
+    { { SIMDE_FLOAT64_C(  -359.83), SIMDE_FLOAT64_C(   650.18) },
+      { { SIMDE_FLOAT64_C(  -359.83) },
+        { SIMDE_FLOAT64_C(   650.18) } } },
+    { { SIMDE_FLOAT64_C(   686.30), SIMDE_FLOAT64_C(  -729.22) },
+      { { SIMDE_FLOAT64_C(   686.30) },
+        { SIMDE_FLOAT64_C(  -729.22) } } },
+    { { SIMDE_FLOAT64_C(   839.08), SIMDE_FLOAT64_C(    55.54) },
+      { { SIMDE_FLOAT64_C(   839.08) },
+        { SIMDE_FLOAT64_C(    55.54) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t r = simde_vld2_dup_f64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t buf[2];
+    int8_t r[2][8];
+  } test_vec[] = {
+    { { -INT8_C( 81),  INT8_C( 75) },
+      { { -INT8_C( 81), -INT8_C( 81), -INT8_C( 81), -INT8_C( 81), -INT8_C( 81), -INT8_C( 81), -INT8_C( 81), -INT8_C( 81) },
+        {  INT8_C( 75),  INT8_C( 75),  INT8_C( 75),  INT8_C( 75),  INT8_C( 75),  INT8_C( 75),  INT8_C( 75),  INT8_C( 75) } } },
+    { {  INT8_C(117),  INT8_C( 56) },
+      { {  INT8_C(117),  INT8_C(117),  INT8_C(117),  INT8_C(117),  INT8_C(117),  INT8_C(117),  INT8_C(117),  INT8_C(117) },
+        {  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56) } } },
+    { { -INT8_C( 49),  INT8_C(113) },
+      { { -INT8_C( 49), -INT8_C( 49), -INT8_C( 49), -INT8_C( 49), -INT8_C( 49), -INT8_C( 49), -INT8_C( 49), -INT8_C( 49) },
+        {  INT8_C(113),  INT8_C(113),  INT8_C(113),  INT8_C(113),  INT8_C(113),  INT8_C(113),  INT8_C(113),  INT8_C(113) } } },
+    { {  INT8_C(110), -INT8_C( 90) },
+      { {  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110) },
+        { -INT8_C( 90), -INT8_C( 90), -INT8_C( 90), -INT8_C( 90), -INT8_C( 90), -INT8_C( 90), -INT8_C( 90), -INT8_C( 90) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t r = simde_vld2_dup_s8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t buf[2];
+    int16_t r[2][4];
+  } test_vec[] = {
+    { {  INT16_C(27470), -INT16_C(18432) },
+      { {  INT16_C(27470),  INT16_C(27470),  INT16_C(27470),  INT16_C(27470) },
+        { -INT16_C(18432), -INT16_C(18432), -INT16_C(18432), -INT16_C(18432) } } },
+    { {  INT16_C(23942), -INT16_C( 3099) },
+      { {  INT16_C(23942),  INT16_C(23942),  INT16_C(23942),  INT16_C(23942) },
+        { -INT16_C( 3099), -INT16_C( 3099), -INT16_C( 3099), -INT16_C( 3099) } } },
+    { {  INT16_C(11354),  INT16_C(25422) },
+      { {  INT16_C(11354),  INT16_C(11354),  INT16_C(11354),  INT16_C(11354) },
+        {  INT16_C(25422),  INT16_C(25422),  INT16_C(25422),  INT16_C(25422) } } },
+    { {  INT16_C( 3285), -INT16_C(12673) },
+      { {  INT16_C( 3285),  INT16_C( 3285),  INT16_C( 3285),  INT16_C( 3285) },
+        { -INT16_C(12673), -INT16_C(12673), -INT16_C(12673), -INT16_C(12673) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t r = simde_vld2_dup_s16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t buf[2];
+    int32_t r[2][2];
+  } test_vec[] = {
+    { { -INT32_C( 706159552),  INT32_C(1597057543) },
+      { { -INT32_C( 706159552), -INT32_C( 706159552) },
+        {  INT32_C(1597057543),  INT32_C(1597057543) } } },
+    { { -INT32_C(1358306664), -INT32_C( 851546173) },
+      { { -INT32_C(1358306664), -INT32_C(1358306664) },
+        { -INT32_C( 851546173), -INT32_C( 851546173) } } },
+    { {  INT32_C( 759063522), -INT32_C(1650172414) },
+      { {  INT32_C( 759063522),  INT32_C( 759063522) },
+        { -INT32_C(1650172414), -INT32_C(1650172414) } } },
+    { {  INT32_C( 258132872),  INT32_C( 183004927) },
+      { {  INT32_C( 258132872),  INT32_C( 258132872) },
+        {  INT32_C( 183004927),  INT32_C( 183004927) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t r = simde_vld2_dup_s32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t buf[2];
+    int64_t r[2][1];
+  } test_vec[] = {
+    { { -INT64_C(1949760722257219112),  INT64_C(6608695932778113232) },
+      { { -INT64_C(1949760722257219112) },
+        {  INT64_C(6608695932778113232) } } },
+    { {  INT64_C(1325804964200197724),  INT64_C(6774314559428404742) },
+      { {  INT64_C(1325804964200197724) },
+        {  INT64_C(6774314559428404742) } } },
+    { {  INT64_C(8438774128292571718), -INT64_C(7825805161725003705) },
+      { {  INT64_C(8438774128292571718) },
+        { -INT64_C(7825805161725003705) } } },
+    { {  INT64_C(2777617770975652889),  INT64_C(4802066049337997625) },
+      { {  INT64_C(2777617770975652889) },
+        {  INT64_C(4802066049337997625) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t r = simde_vld2_dup_s64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t buf[2];
+    uint8_t r[2][8];
+  } test_vec[] = {
+    { { UINT8_C(143), UINT8_C(241) },
+      { { UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143), UINT8_C(143) },
+        { UINT8_C(241), UINT8_C(241), UINT8_C(241), UINT8_C(241), UINT8_C(241), UINT8_C(241), UINT8_C(241), UINT8_C(241) } } },
+    { { UINT8_C(193), UINT8_C( 76) },
+      { { UINT8_C(193), UINT8_C(193), UINT8_C(193), UINT8_C(193), UINT8_C(193), UINT8_C(193), UINT8_C(193), UINT8_C(193) },
+        { UINT8_C( 76), UINT8_C( 76), UINT8_C( 76), UINT8_C( 76), UINT8_C( 76), UINT8_C( 76), UINT8_C( 76), UINT8_C( 76) } } },
+    { { UINT8_C(196), UINT8_C(159) },
+      { { UINT8_C(196), UINT8_C(196), UINT8_C(196), UINT8_C(196), UINT8_C(196), UINT8_C(196), UINT8_C(196), UINT8_C(196) },
+        { UINT8_C(159), UINT8_C(159), UINT8_C(159), UINT8_C(159), UINT8_C(159), UINT8_C(159), UINT8_C(159), UINT8_C(159) } } },
+    { { UINT8_C(194), UINT8_C( 67) },
+      { { UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194) },
+        { UINT8_C( 67), UINT8_C( 67), UINT8_C( 67), UINT8_C( 67), UINT8_C( 67), UINT8_C( 67), UINT8_C( 67), UINT8_C( 67) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t r = simde_vld2_dup_u8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t buf[2];
+    uint16_t r[2][4];
+  } test_vec[] = {
+    { { UINT16_C(49883), UINT16_C( 5374) },
+      { { UINT16_C(49883), UINT16_C(49883), UINT16_C(49883), UINT16_C(49883) },
+        { UINT16_C( 5374), UINT16_C( 5374), UINT16_C( 5374), UINT16_C( 5374) } } },
+    { { UINT16_C(14278), UINT16_C( 6926) },
+      { { UINT16_C(14278), UINT16_C(14278), UINT16_C(14278), UINT16_C(14278) },
+        { UINT16_C( 6926), UINT16_C( 6926), UINT16_C( 6926), UINT16_C( 6926) } } },
+    { { UINT16_C(26107), UINT16_C(15860) },
+      { { UINT16_C(26107), UINT16_C(26107), UINT16_C(26107), UINT16_C(26107) },
+        { UINT16_C(15860), UINT16_C(15860), UINT16_C(15860), UINT16_C(15860) } } },
+    { { UINT16_C(49496), UINT16_C(41856) },
+      { { UINT16_C(49496), UINT16_C(49496), UINT16_C(49496), UINT16_C(49496) },
+        { UINT16_C(41856), UINT16_C(41856), UINT16_C(41856), UINT16_C(41856) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t r = simde_vld2_dup_u16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t buf[2];
+    uint32_t r[2][2];
+  } test_vec[] = {
+    { { UINT32_C(1352774131), UINT32_C(1741113062) },
+      { { UINT32_C(1352774131), UINT32_C(1352774131) },
+        { UINT32_C(1741113062), UINT32_C(1741113062) } } },
+    { { UINT32_C(1169326825), UINT32_C(2128022032) },
+      { { UINT32_C(1169326825), UINT32_C(1169326825) },
+        { UINT32_C(2128022032), UINT32_C(2128022032) } } },
+    { { UINT32_C( 200941947), UINT32_C(2650308011) },
+      { { UINT32_C( 200941947), UINT32_C( 200941947) },
+        { UINT32_C(2650308011), UINT32_C(2650308011) } } },
+    { { UINT32_C(1678069753), UINT32_C(3219798519) },
+      { { UINT32_C(1678069753), UINT32_C(1678069753) },
+        { UINT32_C(3219798519), UINT32_C(3219798519) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t r = simde_vld2_dup_u32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t buf[2];
+    uint64_t r[2][1];
+  } test_vec[] = {
+    { { UINT64_C( 9685679361327298503), UINT64_C( 6121149980070533551) },
+      { { UINT64_C( 9685679361327298503) },
+        { UINT64_C( 6121149980070533551) } } },
+    { { UINT64_C( 3818426371050675455), UINT64_C(16835449676460729511) },
+      { { UINT64_C( 3818426371050675455) },
+        { UINT64_C(16835449676460729511) } } },
+    { { UINT64_C(12458405425709132451), UINT64_C(11168423465708986876) },
+      { { UINT64_C(12458405425709132451) },
+        { UINT64_C(11168423465708986876) } } },
+    { { UINT64_C(12104594693855709041), UINT64_C(12055313799594511212) },
+      { { UINT64_C(12104594693855709041) },
+        { UINT64_C(12055313799594511212) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t r = simde_vld2_dup_u64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t buf[2];
+    simde_float32_t r[2][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -572.10), SIMDE_FLOAT32_C(  -317.18) },
+      { { SIMDE_FLOAT32_C(  -572.10), SIMDE_FLOAT32_C(  -572.10), SIMDE_FLOAT32_C(  -572.10), SIMDE_FLOAT32_C(  -572.10) },
+        { SIMDE_FLOAT32_C(  -317.18), SIMDE_FLOAT32_C(  -317.18), SIMDE_FLOAT32_C(  -317.18), SIMDE_FLOAT32_C(  -317.18) } } },
+    { { SIMDE_FLOAT32_C(  -689.28), SIMDE_FLOAT32_C(    -7.37) },
+      { { SIMDE_FLOAT32_C(  -689.28), SIMDE_FLOAT32_C(  -689.28), SIMDE_FLOAT32_C(  -689.28), SIMDE_FLOAT32_C(  -689.28) },
+        { SIMDE_FLOAT32_C(    -7.37), SIMDE_FLOAT32_C(    -7.37), SIMDE_FLOAT32_C(    -7.37), SIMDE_FLOAT32_C(    -7.37) } } },
+    { { SIMDE_FLOAT32_C(  -489.69), SIMDE_FLOAT32_C(   252.55) },
+      { { SIMDE_FLOAT32_C(  -489.69), SIMDE_FLOAT32_C(  -489.69), SIMDE_FLOAT32_C(  -489.69), SIMDE_FLOAT32_C(  -489.69) },
+        { SIMDE_FLOAT32_C(   252.55), SIMDE_FLOAT32_C(   252.55), SIMDE_FLOAT32_C(   252.55), SIMDE_FLOAT32_C(   252.55) } } },
+    { { SIMDE_FLOAT32_C(  -428.96), SIMDE_FLOAT32_C(  -762.15) },
+      { { SIMDE_FLOAT32_C(  -428.96), SIMDE_FLOAT32_C(  -428.96), SIMDE_FLOAT32_C(  -428.96), SIMDE_FLOAT32_C(  -428.96) },
+        { SIMDE_FLOAT32_C(  -762.15), SIMDE_FLOAT32_C(  -762.15), SIMDE_FLOAT32_C(  -762.15), SIMDE_FLOAT32_C(  -762.15) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t r = simde_vld2q_dup_f32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t buf[2];
+    simde_float64_t r[2][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -342.03), SIMDE_FLOAT64_C(  -405.77) },
+      { { SIMDE_FLOAT64_C(  -342.03), SIMDE_FLOAT64_C(  -342.03) },
+        { SIMDE_FLOAT64_C(  -405.77), SIMDE_FLOAT64_C(  -405.77) } } },
+    { { SIMDE_FLOAT64_C(  -409.29), SIMDE_FLOAT64_C(   988.45) },
+      { { SIMDE_FLOAT64_C(  -409.29), SIMDE_FLOAT64_C(  -409.29) },
+        { SIMDE_FLOAT64_C(   988.45), SIMDE_FLOAT64_C(   988.45) } } },
+    { { SIMDE_FLOAT64_C(   182.39), SIMDE_FLOAT64_C(   728.85) },
+      { { SIMDE_FLOAT64_C(   182.39), SIMDE_FLOAT64_C(   182.39) },
+        { SIMDE_FLOAT64_C(   728.85), SIMDE_FLOAT64_C(   728.85) } } },
+    { { SIMDE_FLOAT64_C(   284.07), SIMDE_FLOAT64_C(   965.14) },
+      { { SIMDE_FLOAT64_C(   284.07), SIMDE_FLOAT64_C(   284.07) },
+        { SIMDE_FLOAT64_C(   965.14), SIMDE_FLOAT64_C(   965.14) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t r = simde_vld2q_dup_f64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t buf[2];
+    int8_t r[2][16];
+  } test_vec[] = {
+    { {  INT8_C(123),  INT8_C(115) },
+      { {  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),
+           INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123),  INT8_C(123) },
+        {  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),
+           INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115),  INT8_C(115) } } },
+    { {  INT8_C( 10), -INT8_C(  6) },
+      { {  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),
+           INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10),  INT8_C( 10) },
+        { -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6),
+          -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6) } } },
+    { {  INT8_C( 84),  INT8_C(118) },
+      { {  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),
+           INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84),  INT8_C( 84) },
+        {  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),
+           INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118) } } },
+    { {  INT8_C( 89),  INT8_C( 93) },
+      { {  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),
+           INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89),  INT8_C( 89) },
+        {  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),
+           INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t r = simde_vld2q_dup_s8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t buf[2];
+    int16_t r[2][8];
+  } test_vec[] = {
+    { { -INT16_C( 9182), -INT16_C(21022) },
+      { { -INT16_C( 9182), -INT16_C( 9182), -INT16_C( 9182), -INT16_C( 9182), -INT16_C( 9182), -INT16_C( 9182), -INT16_C( 9182), -INT16_C( 9182) },
+        { -INT16_C(21022), -INT16_C(21022), -INT16_C(21022), -INT16_C(21022), -INT16_C(21022), -INT16_C(21022), -INT16_C(21022), -INT16_C(21022) } } },
+    { { -INT16_C( 1745),  INT16_C(23868) },
+      { { -INT16_C( 1745), -INT16_C( 1745), -INT16_C( 1745), -INT16_C( 1745), -INT16_C( 1745), -INT16_C( 1745), -INT16_C( 1745), -INT16_C( 1745) },
+        {  INT16_C(23868),  INT16_C(23868),  INT16_C(23868),  INT16_C(23868),  INT16_C(23868),  INT16_C(23868),  INT16_C(23868),  INT16_C(23868) } } },
+    { { -INT16_C(12407), -INT16_C(16303) },
+      { { -INT16_C(12407), -INT16_C(12407), -INT16_C(12407), -INT16_C(12407), -INT16_C(12407), -INT16_C(12407), -INT16_C(12407), -INT16_C(12407) },
+        { -INT16_C(16303), -INT16_C(16303), -INT16_C(16303), -INT16_C(16303), -INT16_C(16303), -INT16_C(16303), -INT16_C(16303), -INT16_C(16303) } } },
+    { { -INT16_C(24442),  INT16_C(23015) },
+      { { -INT16_C(24442), -INT16_C(24442), -INT16_C(24442), -INT16_C(24442), -INT16_C(24442), -INT16_C(24442), -INT16_C(24442), -INT16_C(24442) },
+        {  INT16_C(23015),  INT16_C(23015),  INT16_C(23015),  INT16_C(23015),  INT16_C(23015),  INT16_C(23015),  INT16_C(23015),  INT16_C(23015) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t r = simde_vld2q_dup_s16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t buf[2];
+    int32_t r[2][4];
+  } test_vec[] = {
+    { { -INT32_C(1959102254), -INT32_C(1851106986) },
+      { { -INT32_C(1959102254), -INT32_C(1959102254), -INT32_C(1959102254), -INT32_C(1959102254) },
+        { -INT32_C(1851106986), -INT32_C(1851106986), -INT32_C(1851106986), -INT32_C(1851106986) } } },
+    { {  INT32_C( 508827518),  INT32_C(  79583687) },
+      { {  INT32_C( 508827518),  INT32_C( 508827518),  INT32_C( 508827518),  INT32_C( 508827518) },
+        {  INT32_C(  79583687),  INT32_C(  79583687),  INT32_C(  79583687),  INT32_C(  79583687) } } },
+    { {  INT32_C( 320299967), -INT32_C( 949719906) },
+      { {  INT32_C( 320299967),  INT32_C( 320299967),  INT32_C( 320299967),  INT32_C( 320299967) },
+        { -INT32_C( 949719906), -INT32_C( 949719906), -INT32_C( 949719906), -INT32_C( 949719906) } } },
+    { { -INT32_C(  50069185),  INT32_C( 521103620) },
+      { { -INT32_C(  50069185), -INT32_C(  50069185), -INT32_C(  50069185), -INT32_C(  50069185) },
+        {  INT32_C( 521103620),  INT32_C( 521103620),  INT32_C( 521103620),  INT32_C( 521103620) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t r = simde_vld2q_dup_s32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t buf[2];
+    int64_t r[2][2];
+  } test_vec[] = {
+    { {  INT64_C(8720277451109955213), -INT64_C(6487460930445774789) },
+      { {  INT64_C(8720277451109955213),  INT64_C(8720277451109955213) },
+        { -INT64_C(6487460930445774789), -INT64_C(6487460930445774789) } } },
+    { { -INT64_C(3688325746957428356), -INT64_C(2930326373615823145) },
+      { { -INT64_C(3688325746957428356), -INT64_C(3688325746957428356) },
+        { -INT64_C(2930326373615823145), -INT64_C(2930326373615823145) } } },
+    { {  INT64_C(8226097402577570893),  INT64_C(5776909673974424813) },
+      { {  INT64_C(8226097402577570893),  INT64_C(8226097402577570893) },
+        {  INT64_C(5776909673974424813),  INT64_C(5776909673974424813) } } },
+    { { -INT64_C(8336529860965289362), -INT64_C(6632493827608723170) },
+      { { -INT64_C(8336529860965289362), -INT64_C(8336529860965289362) },
+        { -INT64_C(6632493827608723170), -INT64_C(6632493827608723170) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t r = simde_vld2q_dup_s64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t buf[2];
+    uint8_t r[2][16];
+  } test_vec[] = {
+    { { UINT8_C( 47), UINT8_C(231) },
+      { { UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47),
+          UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47), UINT8_C( 47) },
+        { UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231),
+          UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231), UINT8_C(231) } } },
+    { { UINT8_C(120), UINT8_C( 11) },
+      { { UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120),
+          UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120), UINT8_C(120) },
+        { UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11),
+          UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11), UINT8_C( 11) } } },
+    { { UINT8_C( 79), UINT8_C(112) },
+      { { UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79),
+          UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79) },
+        { UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112),
+          UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112), UINT8_C(112) } } },
+    { { UINT8_C( 80), UINT8_C( 90) },
+      { { UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80),
+          UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80) },
+        { UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90),
+          UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90), UINT8_C( 90) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t r = simde_vld2q_dup_u8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t buf[2];
+    uint16_t r[2][8];
+  } test_vec[] = {
+    { { UINT16_C(27137), UINT16_C(47611) },
+      { { UINT16_C(27137), UINT16_C(27137), UINT16_C(27137), UINT16_C(27137), UINT16_C(27137), UINT16_C(27137), UINT16_C(27137), UINT16_C(27137) },
+        { UINT16_C(47611), UINT16_C(47611), UINT16_C(47611), UINT16_C(47611), UINT16_C(47611), UINT16_C(47611), UINT16_C(47611), UINT16_C(47611) } } },
+    { { UINT16_C(15713), UINT16_C(  311) },
+      { { UINT16_C(15713), UINT16_C(15713), UINT16_C(15713), UINT16_C(15713), UINT16_C(15713), UINT16_C(15713), UINT16_C(15713), UINT16_C(15713) },
+        { UINT16_C(  311), UINT16_C(  311), UINT16_C(  311), UINT16_C(  311), UINT16_C(  311), UINT16_C(  311), UINT16_C(  311), UINT16_C(  311) } } },
+    { { UINT16_C(31117), UINT16_C(43166) },
+      { { UINT16_C(31117), UINT16_C(31117), UINT16_C(31117), UINT16_C(31117), UINT16_C(31117), UINT16_C(31117), UINT16_C(31117), UINT16_C(31117) },
+        { UINT16_C(43166), UINT16_C(43166), UINT16_C(43166), UINT16_C(43166), UINT16_C(43166), UINT16_C(43166), UINT16_C(43166), UINT16_C(43166) } } },
+    { { UINT16_C(62238), UINT16_C(33116) },
+      { { UINT16_C(62238), UINT16_C(62238), UINT16_C(62238), UINT16_C(62238), UINT16_C(62238), UINT16_C(62238), UINT16_C(62238), UINT16_C(62238) },
+        { UINT16_C(33116), UINT16_C(33116), UINT16_C(33116), UINT16_C(33116), UINT16_C(33116), UINT16_C(33116), UINT16_C(33116), UINT16_C(33116) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t r = simde_vld2q_dup_u16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t buf[2];
+    uint32_t r[2][4];
+  } test_vec[] = {
+    { { UINT32_C(2762782818), UINT32_C(4168417076) },
+      { { UINT32_C(2762782818), UINT32_C(2762782818), UINT32_C(2762782818), UINT32_C(2762782818) },
+        { UINT32_C(4168417076), UINT32_C(4168417076), UINT32_C(4168417076), UINT32_C(4168417076) } } },
+    { { UINT32_C(3696343666), UINT32_C(3746453685) },
+      { { UINT32_C(3696343666), UINT32_C(3696343666), UINT32_C(3696343666), UINT32_C(3696343666) },
+        { UINT32_C(3746453685), UINT32_C(3746453685), UINT32_C(3746453685), UINT32_C(3746453685) } } },
+    { { UINT32_C(2722859049), UINT32_C( 315987006) },
+      { { UINT32_C(2722859049), UINT32_C(2722859049), UINT32_C(2722859049), UINT32_C(2722859049) },
+        { UINT32_C( 315987006), UINT32_C( 315987006), UINT32_C( 315987006), UINT32_C( 315987006) } } },
+    { { UINT32_C(4023827621), UINT32_C( 721821974) },
+      { { UINT32_C(4023827621), UINT32_C(4023827621), UINT32_C(4023827621), UINT32_C(4023827621) },
+        { UINT32_C( 721821974), UINT32_C( 721821974), UINT32_C( 721821974), UINT32_C( 721821974) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t r = simde_vld2q_dup_u32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t buf[2];
+    uint64_t r[2][2];
+  } test_vec[] = {
+    { { UINT64_C( 3379736963905211322), UINT64_C(17035504418244315711) },
+      { { UINT64_C( 3379736963905211322), UINT64_C( 3379736963905211322) },
+        { UINT64_C(17035504418244315711), UINT64_C(17035504418244315711) } } },
+    { { UINT64_C( 7179026059961135691), UINT64_C(16493538403968032694) },
+      { { UINT64_C( 7179026059961135691), UINT64_C( 7179026059961135691) },
+        { UINT64_C(16493538403968032694), UINT64_C(16493538403968032694) } } },
+    { { UINT64_C( 6221142614208571315), UINT64_C(  360635400334972072) },
+      { { UINT64_C( 6221142614208571315), UINT64_C( 6221142614208571315) },
+        { UINT64_C(  360635400334972072), UINT64_C(  360635400334972072) } } },
+    { { UINT64_C(12835568870270698610), UINT64_C( 9879306042681923503) },
+      { { UINT64_C(12835568870270698610), UINT64_C(12835568870270698610) },
+        { UINT64_C( 9879306042681923503), UINT64_C( 9879306042681923503) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t r = simde_vld2q_dup_u64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,992 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld2_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld2_lane.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vld2_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int8_t src[2][8];
+    int8_t buf[2];
+    int8_t r[2][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT8_C( 75),  INT8_C(  4),  INT8_C(113),  INT8_C( 96),  INT8_C( 36),  INT8_C( 21),  INT8_C( 12), -INT8_C(118) },
+        { -INT8_C( 84),  INT8_C(102),  INT8_C( 83),  INT8_C( 76), -INT8_C(  4), -INT8_C( 22), -INT8_C( 11), -INT8_C( 62) } },
+      { -INT8_C( 56), -INT8_C(  5) },
+      { { -INT8_C( 56),  INT8_C(  4),  INT8_C(113),  INT8_C( 96),  INT8_C( 36),  INT8_C( 21),  INT8_C( 12), -INT8_C(118) },
+        { -INT8_C(  5),  INT8_C(102),  INT8_C( 83),  INT8_C( 76), -INT8_C(  4), -INT8_C( 22), -INT8_C( 11), -INT8_C( 62) } } },
+    {  INT32_C( 5),
+      { {  INT8_C( 16), -INT8_C( 70), -INT8_C( 59), -INT8_C( 97), -INT8_C( 11), -INT8_C( 91), -INT8_C( 76),  INT8_C( 42) },
+        {  INT8_C( 74), -INT8_C( 97),  INT8_C( 36),  INT8_C(117), -INT8_C( 52), -INT8_C( 30), -INT8_C(100),  INT8_C( 19) } },
+      {  INT8_C( 70), -INT8_C( 65) },
+      { {  INT8_C( 16), -INT8_C( 70), -INT8_C( 59), -INT8_C( 97), -INT8_C( 11),  INT8_C( 70), -INT8_C( 76),  INT8_C( 42) },
+        {  INT8_C( 74), -INT8_C( 97),  INT8_C( 36),  INT8_C(117), -INT8_C( 52), -INT8_C( 65), -INT8_C(100),  INT8_C( 19) } } },
+    {  INT32_C( 2),
+      { { -INT8_C(106),  INT8_C(  0),  INT8_C(118), -INT8_C( 36), -INT8_C( 25), -INT8_C(115),  INT8_C(  3), -INT8_C( 65) },
+        { -INT8_C(116), -INT8_C( 58), -INT8_C(111),  INT8_C( 49),  INT8_C(109),  INT8_C(  8),  INT8_C( 68), -INT8_C( 46) } },
+      { -INT8_C(124), -INT8_C( 53) },
+      { { -INT8_C(106),  INT8_C(  0), -INT8_C(124), -INT8_C( 36), -INT8_C( 25), -INT8_C(115),  INT8_C(  3), -INT8_C( 65) },
+        { -INT8_C(116), -INT8_C( 58), -INT8_C( 53),  INT8_C( 49),  INT8_C(109),  INT8_C(  8),  INT8_C( 68), -INT8_C( 46) } } },
+    {  INT32_C( 7),
+      { { -INT8_C(117),  INT8_C(122),  INT8_C(  4),  INT8_C(114), -INT8_C( 90), -INT8_C( 10),  INT8_C(107),  INT8_C(  6) },
+        { -INT8_C( 70),  INT8_C( 19), -INT8_C( 73),  INT8_C( 13), -INT8_C( 12), -INT8_C( 96), -INT8_C( 14),     INT8_MAX } },
+      { -INT8_C( 66),  INT8_C( 26) },
+      { { -INT8_C(117),  INT8_C(122),  INT8_C(  4),  INT8_C(114), -INT8_C( 90), -INT8_C( 10),  INT8_C(107), -INT8_C( 66) },
+        { -INT8_C( 70),  INT8_C( 19), -INT8_C( 73),  INT8_C( 13), -INT8_C( 12), -INT8_C( 96), -INT8_C( 14),  INT8_C( 26) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t src = { {
+      simde_vld1_s8(test_vec[i].src[0]),
+      simde_vld1_s8(test_vec[i].src[1]) } };
+    simde_int8x8x2_t r;
+    SIMDE_CONSTIFY_8_(simde_vld2_lane_s8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int16_t src[2][4];
+    int16_t buf[2];
+    int16_t r[2][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT16_C(  415),  INT16_C(11093),  INT16_C(16965),  INT16_C( 3397) },
+        {  INT16_C(12967), -INT16_C(  653),  INT16_C(15508),  INT16_C(16868) } },
+      { -INT16_C( 2442),  INT16_C(31932) },
+      { { -INT16_C( 2442),  INT16_C(11093),  INT16_C(16965),  INT16_C( 3397) },
+        {  INT16_C(31932), -INT16_C(  653),  INT16_C(15508),  INT16_C(16868) } } },
+    {  INT32_C( 1),
+      { {  INT16_C( 4397), -INT16_C(12121), -INT16_C(12928),  INT16_C(30214) },
+        { -INT16_C(23963), -INT16_C(12979),  INT16_C(10343), -INT16_C(22980) } },
+      { -INT16_C( 5752), -INT16_C( 5754) },
+      { {  INT16_C( 4397), -INT16_C( 5752), -INT16_C(12928),  INT16_C(30214) },
+        { -INT16_C(23963), -INT16_C( 5754),  INT16_C(10343), -INT16_C(22980) } } },
+    {  INT32_C( 2),
+      { {  INT16_C(22253),  INT16_C(12462),  INT16_C( 7260), -INT16_C( 7532) },
+        { -INT16_C(26050),  INT16_C(15144),  INT16_C(17170), -INT16_C(28629) } },
+      {  INT16_C( 9202), -INT16_C(12271) },
+      { {  INT16_C(22253),  INT16_C(12462),  INT16_C( 9202), -INT16_C( 7532) },
+        { -INT16_C(26050),  INT16_C(15144), -INT16_C(12271), -INT16_C(28629) } } },
+    {  INT32_C( 3),
+      { { -INT16_C( 5214), -INT16_C(12720),  INT16_C(22086), -INT16_C(20101) },
+        { -INT16_C(21024), -INT16_C(25996),  INT16_C(10418),  INT16_C(20042) } },
+      {  INT16_C(14155), -INT16_C(30394) },
+      { { -INT16_C( 5214), -INT16_C(12720),  INT16_C(22086),  INT16_C(14155) },
+        { -INT16_C(21024), -INT16_C(25996),  INT16_C(10418), -INT16_C(30394) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t src = { {
+      simde_vld1_s16(test_vec[i].src[0]),
+      simde_vld1_s16(test_vec[i].src[1]) } };
+    simde_int16x4x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vld2_lane_s16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int32_t src[2][2];
+    int32_t buf[2];
+    int32_t r[2][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT32_C(1737705053),  INT32_C( 764558644) },
+        { -INT32_C( 661411763),  INT32_C( 518374006) } },
+      { -INT32_C(1462888839),  INT32_C(1988261744) },
+      { { -INT32_C(1462888839),  INT32_C( 764558644) },
+        {  INT32_C(1988261744),  INT32_C( 518374006) } } },
+    {  INT32_C( 1),
+      { { -INT32_C(1187175639),  INT32_C( 583889804) },
+        { -INT32_C(1527791973),  INT32_C(1840567360) } },
+      { -INT32_C( 175267229), -INT32_C(1943860420) },
+      { { -INT32_C(1187175639), -INT32_C( 175267229) },
+        { -INT32_C(1527791973), -INT32_C(1943860420) } } },
+    {  INT32_C( 0),
+      { { -INT32_C(1383431784),  INT32_C(1698186668) },
+        { -INT32_C( 321904321), -INT32_C(1953506231) } },
+      { -INT32_C(1634025679), -INT32_C( 664977864) },
+      { { -INT32_C(1634025679),  INT32_C(1698186668) },
+        { -INT32_C( 664977864), -INT32_C(1953506231) } } },
+    {  INT32_C( 1),
+      { { -INT32_C(1515823896),  INT32_C(1856541354) },
+        { -INT32_C( 187642489),  INT32_C( 106588020) } },
+      { -INT32_C(2116491345),  INT32_C(1804015012) },
+      { { -INT32_C(1515823896), -INT32_C(2116491345) },
+        { -INT32_C( 187642489),  INT32_C(1804015012) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t src = { {
+      simde_vld1_s32(test_vec[i].src[0]),
+      simde_vld1_s32(test_vec[i].src[1]) } };
+    simde_int32x2x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld2_lane_s32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int64_t src[2][1];
+    int64_t buf[2];
+    int64_t r[2][1];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT64_C(6729217553012441784) },
+        { -INT64_C(4943856570565400054) } },
+      { -INT64_C(6221647758838477718),  INT64_C(5338178198640594464) },
+      { { -INT64_C(6221647758838477718) },
+        {  INT64_C(5338178198640594464) } } },
+    {  INT32_C( 0),
+      { {  INT64_C(5201248041184069099) },
+        { -INT64_C(7347609223895795355) } },
+      {  INT64_C(4108248902038284054), -INT64_C( 191491131276375927) },
+      { {  INT64_C(4108248902038284054) },
+        { -INT64_C( 191491131276375927) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t src = { {
+      simde_vld1_s64(test_vec[i].src[0]),
+      simde_vld1_s64(test_vec[i].src[1]) } };
+    simde_int64x1x2_t r;
+    r = simde_vld2_lane_s64(test_vec[i].buf, src, 0);
+
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint8_t src[2][8];
+    uint8_t buf[2];
+    uint8_t r[2][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {    UINT8_MAX, UINT8_C( 82), UINT8_C(  5), UINT8_C( 57), UINT8_C( 94), UINT8_C( 58), UINT8_C(156), UINT8_C(170) },
+        { UINT8_C( 62), UINT8_C(133), UINT8_C(113), UINT8_C(  3), UINT8_C( 49), UINT8_C( 59), UINT8_C(157), UINT8_C(167) } },
+      { UINT8_C( 34), UINT8_C( 11) },
+      { { UINT8_C( 34), UINT8_C( 82), UINT8_C(  5), UINT8_C( 57), UINT8_C( 94), UINT8_C( 58), UINT8_C(156), UINT8_C(170) },
+        { UINT8_C( 11), UINT8_C(133), UINT8_C(113), UINT8_C(  3), UINT8_C( 49), UINT8_C( 59), UINT8_C(157), UINT8_C(167) } } },
+    {  INT32_C( 5),
+      { { UINT8_C( 51), UINT8_C( 44), UINT8_C(201), UINT8_C(160), UINT8_C( 38), UINT8_C(150), UINT8_C(194), UINT8_C(104) },
+        { UINT8_C(165), UINT8_C( 25), UINT8_C( 13), UINT8_C(196), UINT8_C(157), UINT8_C( 46), UINT8_C(  1), UINT8_C(182) } },
+      { UINT8_C(141), UINT8_C( 70) },
+      { { UINT8_C( 51), UINT8_C( 44), UINT8_C(201), UINT8_C(160), UINT8_C( 38), UINT8_C(141), UINT8_C(194), UINT8_C(104) },
+        { UINT8_C(165), UINT8_C( 25), UINT8_C( 13), UINT8_C(196), UINT8_C(157), UINT8_C( 70), UINT8_C(  1), UINT8_C(182) } } },
+    {  INT32_C( 2),
+      { { UINT8_C( 34), UINT8_C(180), UINT8_C(142), UINT8_C(161), UINT8_C( 35), UINT8_C(210), UINT8_C(129), UINT8_C(159) },
+        { UINT8_C(169), UINT8_C(148), UINT8_C(  9), UINT8_C(177), UINT8_C(181), UINT8_C( 22), UINT8_C( 59), UINT8_C(164) } },
+      { UINT8_C( 73), UINT8_C( 67) },
+      { { UINT8_C( 34), UINT8_C(180), UINT8_C( 73), UINT8_C(161), UINT8_C( 35), UINT8_C(210), UINT8_C(129), UINT8_C(159) },
+        { UINT8_C(169), UINT8_C(148), UINT8_C( 67), UINT8_C(177), UINT8_C(181), UINT8_C( 22), UINT8_C( 59), UINT8_C(164) } } },
+    {  INT32_C( 7),
+      { { UINT8_C( 17), UINT8_C(226), UINT8_C(161), UINT8_C(163), UINT8_C( 65), UINT8_C(131), UINT8_C(128), UINT8_C( 81) },
+        { UINT8_C( 75), UINT8_C(115), UINT8_C(241), UINT8_C( 91), UINT8_C( 86), UINT8_C( 35), UINT8_C(127), UINT8_C(179) } },
+      { UINT8_C(214), UINT8_C(197) },
+      { { UINT8_C( 17), UINT8_C(226), UINT8_C(161), UINT8_C(163), UINT8_C( 65), UINT8_C(131), UINT8_C(128), UINT8_C(214) },
+        { UINT8_C( 75), UINT8_C(115), UINT8_C(241), UINT8_C( 91), UINT8_C( 86), UINT8_C( 35), UINT8_C(127), UINT8_C(197) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t src = { {
+      simde_vld1_u8(test_vec[i].src[0]),
+      simde_vld1_u8(test_vec[i].src[1]) } };
+    simde_uint8x8x2_t r;
+    SIMDE_CONSTIFY_8_(simde_vld2_lane_u8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint16_t src[2][4];
+    uint16_t buf[2];
+    uint16_t r[2][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT16_C(39709), UINT16_C( 9038), UINT16_C(50572), UINT16_C(16239) },
+        { UINT16_C(35647), UINT16_C(35379), UINT16_C( 3427), UINT16_C( 3239) } },
+      { UINT16_C(53586), UINT16_C( 9305) },
+      { { UINT16_C(53586), UINT16_C( 9038), UINT16_C(50572), UINT16_C(16239) },
+        { UINT16_C( 9305), UINT16_C(35379), UINT16_C( 3427), UINT16_C( 3239) } } },
+    {  INT32_C( 1),
+      { { UINT16_C(57919), UINT16_C( 4711), UINT16_C( 5992), UINT16_C(36275) },
+        { UINT16_C(52187), UINT16_C( 4229), UINT16_C(58120), UINT16_C( 2673) } },
+      { UINT16_C(18052), UINT16_C(61924) },
+      { { UINT16_C(57919), UINT16_C(18052), UINT16_C( 5992), UINT16_C(36275) },
+        { UINT16_C(52187), UINT16_C(61924), UINT16_C(58120), UINT16_C( 2673) } } },
+    {  INT32_C( 2),
+      { { UINT16_C(19504), UINT16_C(31417), UINT16_C(21320), UINT16_C(60335) },
+        { UINT16_C(17205), UINT16_C(61016), UINT16_C(42137), UINT16_C(62151) } },
+      { UINT16_C(56995), UINT16_C(62409) },
+      { { UINT16_C(19504), UINT16_C(31417), UINT16_C(56995), UINT16_C(60335) },
+        { UINT16_C(17205), UINT16_C(61016), UINT16_C(62409), UINT16_C(62151) } } },
+    {  INT32_C( 3),
+      { { UINT16_C(26161), UINT16_C(43692), UINT16_C(50933), UINT16_C(12224) },
+        { UINT16_C(12784), UINT16_C(35197), UINT16_C(37079), UINT16_C(60386) } },
+      { UINT16_C(32500), UINT16_C(60476) },
+      { { UINT16_C(26161), UINT16_C(43692), UINT16_C(50933), UINT16_C(32500) },
+        { UINT16_C(12784), UINT16_C(35197), UINT16_C(37079), UINT16_C(60476) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t src = { {
+      simde_vld1_u16(test_vec[i].src[0]),
+      simde_vld1_u16(test_vec[i].src[1]) } };
+    simde_uint16x4x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vld2_lane_u16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint32_t src[2][2];
+    uint32_t buf[2];
+    uint32_t r[2][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT32_C(4073789303), UINT32_C(3864283811) },
+        { UINT32_C( 177335768), UINT32_C( 918900753) } },
+      { UINT32_C(3888748837), UINT32_C(1703153657) },
+      { { UINT32_C(3888748837), UINT32_C(3864283811) },
+        { UINT32_C(1703153657), UINT32_C( 918900753) } } },
+    {  INT32_C( 1),
+      { { UINT32_C(   6608282), UINT32_C(1535101280) },
+        { UINT32_C( 819259181), UINT32_C(1552880384) } },
+      { UINT32_C(3843247791), UINT32_C(3185100113) },
+      { { UINT32_C(   6608282), UINT32_C(3843247791) },
+        { UINT32_C( 819259181), UINT32_C(3185100113) } } },
+    {  INT32_C( 0),
+      { { UINT32_C(1795072369), UINT32_C(3288048869) },
+        { UINT32_C( 668086020), UINT32_C(3196033445) } },
+      { UINT32_C(  55659107), UINT32_C(2946269710) },
+      { { UINT32_C(  55659107), UINT32_C(3288048869) },
+        { UINT32_C(2946269710), UINT32_C(3196033445) } } },
+    {  INT32_C( 1),
+      { { UINT32_C(3595000971), UINT32_C( 488984434) },
+        { UINT32_C(3293187206), UINT32_C( 686413035) } },
+      { UINT32_C( 644286612), UINT32_C(1550843137) },
+      { { UINT32_C(3595000971), UINT32_C( 644286612) },
+        { UINT32_C(3293187206), UINT32_C(1550843137) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t src = { {
+      simde_vld1_u32(test_vec[i].src[0]),
+      simde_vld1_u32(test_vec[i].src[1]) } };
+    simde_uint32x2x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld2_lane_u32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint64_t src[2][1];
+    uint64_t buf[2];
+    uint64_t r[2][1];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT64_C(15170558544565034146) },
+        { UINT64_C( 9415470572397650770) } },
+      { UINT64_C( 2519283489528320239), UINT64_C( 7239849666258195777) },
+      { { UINT64_C( 2519283489528320239) },
+        { UINT64_C( 7239849666258195777) } } },
+    {  INT32_C( 0),
+      { { UINT64_C(15567188044736006906) },
+        { UINT64_C( 2203718438319013358) } },
+      { UINT64_C( 3766715349233528821), UINT64_C( 7712844834572997165) },
+      { { UINT64_C( 3766715349233528821) },
+        { UINT64_C( 7712844834572997165) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t src = { {
+      simde_vld1_u64(test_vec[i].src[0]),
+      simde_vld1_u64(test_vec[i].src[1]) } };
+    simde_uint64x1x2_t r;
+    r = simde_vld2_lane_u64(test_vec[i].buf, src, 0);
+
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float32_t src[2][2];
+    simde_float32_t buf[2];
+    simde_float32_t r[2][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT32_C(   499.95), SIMDE_FLOAT32_C(  -933.56) },
+        { SIMDE_FLOAT32_C(   565.13), SIMDE_FLOAT32_C(  -673.59) } },
+      { SIMDE_FLOAT32_C(  -947.66), SIMDE_FLOAT32_C(   822.43) },
+      { { SIMDE_FLOAT32_C(  -947.66), SIMDE_FLOAT32_C(  -933.56) },
+        { SIMDE_FLOAT32_C(   822.43), SIMDE_FLOAT32_C(  -673.59) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT32_C(   294.82), SIMDE_FLOAT32_C(  -818.53) },
+        { SIMDE_FLOAT32_C(  -425.03), SIMDE_FLOAT32_C(  -917.62) } },
+      { SIMDE_FLOAT32_C(  -569.99), SIMDE_FLOAT32_C(  -584.66) },
+      { { SIMDE_FLOAT32_C(   294.82), SIMDE_FLOAT32_C(  -569.99) },
+        { SIMDE_FLOAT32_C(  -425.03), SIMDE_FLOAT32_C(  -584.66) } } },
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT32_C(    29.67), SIMDE_FLOAT32_C(   101.75) },
+        { SIMDE_FLOAT32_C(   452.20), SIMDE_FLOAT32_C(   975.38) } },
+      { SIMDE_FLOAT32_C(  -566.58), SIMDE_FLOAT32_C(  -945.88) },
+      { { SIMDE_FLOAT32_C(  -566.58), SIMDE_FLOAT32_C(   101.75) },
+        { SIMDE_FLOAT32_C(  -945.88), SIMDE_FLOAT32_C(   975.38) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT32_C(   -46.59), SIMDE_FLOAT32_C(  -550.40) },
+        { SIMDE_FLOAT32_C(  -680.98), SIMDE_FLOAT32_C(  -349.47) } },
+      { SIMDE_FLOAT32_C(   -92.85), SIMDE_FLOAT32_C(   502.30) },
+      { { SIMDE_FLOAT32_C(   -46.59), SIMDE_FLOAT32_C(   -92.85) },
+        { SIMDE_FLOAT32_C(  -680.98), SIMDE_FLOAT32_C(   502.30) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t src = { {
+      simde_vld1_f32(test_vec[i].src[0]),
+      simde_vld1_f32(test_vec[i].src[1]) } };
+    simde_float32x2x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld2_lane_f32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float64_t src[2][1];
+    simde_float64_t buf[2];
+    simde_float64_t r[2][1];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(  -427.68) },
+        { SIMDE_FLOAT64_C(  -565.94) } },
+      { SIMDE_FLOAT64_C(   243.56), SIMDE_FLOAT64_C(  -558.50) },
+      { { SIMDE_FLOAT64_C(   243.56) },
+        { SIMDE_FLOAT64_C(  -558.50) } } },
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(  -338.75) },
+        { SIMDE_FLOAT64_C(   102.19) } },
+      { SIMDE_FLOAT64_C(  -914.13), SIMDE_FLOAT64_C(  -647.24) },
+      { { SIMDE_FLOAT64_C(  -914.13) },
+        { SIMDE_FLOAT64_C(  -647.24) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t src = { {
+      simde_vld1_f64(test_vec[i].src[0]),
+      simde_vld1_f64(test_vec[i].src[1]) } };
+    simde_float64x1x2_t r;
+    r = simde_vld2_lane_f64(test_vec[i].buf, src, 0);
+
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int8_t src[2][16];
+    int8_t buf[2];
+    int8_t r[2][16];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT8_C( 32),  INT8_C( 23), -INT8_C( 41), -INT8_C( 44), -INT8_C( 21), -INT8_C( 51),  INT8_C( 25), -INT8_C(  4),
+           INT8_C( 32),  INT8_C( 48), -INT8_C( 74),  INT8_C(118),  INT8_C( 32),  INT8_C( 31),  INT8_C(113),  INT8_C( 38) },
+        { -INT8_C( 78), -INT8_C( 29),  INT8_C( 88), -INT8_C( 16), -INT8_C( 58), -INT8_C( 76), -INT8_C( 31), -INT8_C(115),
+           INT8_C( 26), -INT8_C( 48),  INT8_C(118), -INT8_C( 52), -INT8_C( 43),  INT8_C( 60), -INT8_C( 19), -INT8_C( 30) } },
+      {  INT8_C(118), -INT8_C( 98) },
+      { {  INT8_C(118),  INT8_C( 23), -INT8_C( 41), -INT8_C( 44), -INT8_C( 21), -INT8_C( 51),  INT8_C( 25), -INT8_C(  4),
+           INT8_C( 32),  INT8_C( 48), -INT8_C( 74),  INT8_C(118),  INT8_C( 32),  INT8_C( 31),  INT8_C(113),  INT8_C( 38) },
+        { -INT8_C( 98), -INT8_C( 29),  INT8_C( 88), -INT8_C( 16), -INT8_C( 58), -INT8_C( 76), -INT8_C( 31), -INT8_C(115),
+           INT8_C( 26), -INT8_C( 48),  INT8_C(118), -INT8_C( 52), -INT8_C( 43),  INT8_C( 60), -INT8_C( 19), -INT8_C( 30) } } },
+    {  INT32_C( 5),
+      { {  INT8_C( 91),  INT8_C(124),  INT8_C( 72), -INT8_C( 33), -INT8_C(107),  INT8_C( 51),  INT8_C(118),  INT8_C( 76),
+           INT8_C( 74), -INT8_C( 36), -INT8_C( 71),  INT8_C(110),  INT8_C(121), -INT8_C( 83),  INT8_C( 26), -INT8_C( 67) },
+        { -INT8_C(112), -INT8_C(  8), -INT8_C( 54), -INT8_C(124),  INT8_C( 21),  INT8_C(  7), -INT8_C( 30),  INT8_C( 64),
+           INT8_C(122),  INT8_C( 48), -INT8_C(120), -INT8_C( 70),  INT8_C( 39),  INT8_C(118), -INT8_C(114),  INT8_C( 60) } },
+      {  INT8_C( 43), -INT8_C(107) },
+      { {  INT8_C( 91),  INT8_C(124),  INT8_C( 72), -INT8_C( 33), -INT8_C(107),  INT8_C( 43),  INT8_C(118),  INT8_C( 76),
+           INT8_C( 74), -INT8_C( 36), -INT8_C( 71),  INT8_C(110),  INT8_C(121), -INT8_C( 83),  INT8_C( 26), -INT8_C( 67) },
+        { -INT8_C(112), -INT8_C(  8), -INT8_C( 54), -INT8_C(124),  INT8_C( 21), -INT8_C(107), -INT8_C( 30),  INT8_C( 64),
+           INT8_C(122),  INT8_C( 48), -INT8_C(120), -INT8_C( 70),  INT8_C( 39),  INT8_C(118), -INT8_C(114),  INT8_C( 60) } } },
+    {  INT32_C(10),
+      { { -INT8_C( 44), -INT8_C( 61), -INT8_C( 62),  INT8_C( 14), -INT8_C( 52),  INT8_C( 83), -INT8_C( 17), -INT8_C( 48),
+           INT8_C(120),  INT8_C( 19), -INT8_C( 19), -INT8_C( 60),  INT8_C( 69), -INT8_C( 10), -INT8_C( 40),  INT8_C( 65) },
+        {  INT8_C(  1), -INT8_C(115), -INT8_C(104), -INT8_C( 17),  INT8_C(  5),  INT8_C(118), -INT8_C(126),  INT8_C( 92),
+           INT8_C(117),  INT8_C( 30), -INT8_C(  3),  INT8_C( 84), -INT8_C( 78),  INT8_C( 60),  INT8_C( 75),  INT8_C( 18) } },
+      {  INT8_C( 27), -INT8_C(120) },
+      { { -INT8_C( 44), -INT8_C( 61), -INT8_C( 62),  INT8_C( 14), -INT8_C( 52),  INT8_C( 83), -INT8_C( 17), -INT8_C( 48),
+           INT8_C(120),  INT8_C( 19),  INT8_C( 27), -INT8_C( 60),  INT8_C( 69), -INT8_C( 10), -INT8_C( 40),  INT8_C( 65) },
+        {  INT8_C(  1), -INT8_C(115), -INT8_C(104), -INT8_C( 17),  INT8_C(  5),  INT8_C(118), -INT8_C(126),  INT8_C( 92),
+           INT8_C(117),  INT8_C( 30), -INT8_C(120),  INT8_C( 84), -INT8_C( 78),  INT8_C( 60),  INT8_C( 75),  INT8_C( 18) } } },
+    {  INT32_C(15),
+      { { -INT8_C( 94),  INT8_C( 93), -INT8_C( 15), -INT8_C( 31), -INT8_C( 78),  INT8_C( 72),  INT8_C( 92), -INT8_C(109),
+          -INT8_C( 70), -INT8_C( 45), -INT8_C( 66),  INT8_C( 17), -INT8_C( 93), -INT8_C(  9), -INT8_C( 90),  INT8_C( 88) },
+        {  INT8_C(102), -INT8_C( 85),  INT8_C(125),  INT8_C( 79), -INT8_C( 89),  INT8_C( 11),  INT8_C( 15), -INT8_C( 13),
+          -INT8_C(108),  INT8_C(116),  INT8_C(  6), -INT8_C(118), -INT8_C( 49), -INT8_C(107),  INT8_C( 78),     INT8_MIN } },
+      {  INT8_C(103), -INT8_C( 59) },
+      { { -INT8_C( 94),  INT8_C( 93), -INT8_C( 15), -INT8_C( 31), -INT8_C( 78),  INT8_C( 72),  INT8_C( 92), -INT8_C(109),
+          -INT8_C( 70), -INT8_C( 45), -INT8_C( 66),  INT8_C( 17), -INT8_C( 93), -INT8_C(  9), -INT8_C( 90),  INT8_C(103) },
+        {  INT8_C(102), -INT8_C( 85),  INT8_C(125),  INT8_C( 79), -INT8_C( 89),  INT8_C( 11),  INT8_C( 15), -INT8_C( 13),
+          -INT8_C(108),  INT8_C(116),  INT8_C(  6), -INT8_C(118), -INT8_C( 49), -INT8_C(107),  INT8_C( 78), -INT8_C( 59) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t src = { {
+      simde_vld1q_s8(test_vec[i].src[0]),
+      simde_vld1q_s8(test_vec[i].src[1]) } };
+    simde_int8x16x2_t r;
+    SIMDE_CONSTIFY_16_(simde_vld2q_lane_s8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int16_t src[2][8];
+    int16_t buf[2];
+    int16_t r[2][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT16_C( 2146),  INT16_C(15499), -INT16_C(17376),  INT16_C( 1975),  INT16_C( 6435), -INT16_C(22507),  INT16_C(26270),  INT16_C(19866) },
+        {  INT16_C(18086),  INT16_C(32524), -INT16_C(19340), -INT16_C(13128),  INT16_C( 8745), -INT16_C(30262),  INT16_C(27496),  INT16_C(13799) } },
+      {  INT16_C(22872),  INT16_C( 4270) },
+      { {  INT16_C(22872),  INT16_C(15499), -INT16_C(17376),  INT16_C( 1975),  INT16_C( 6435), -INT16_C(22507),  INT16_C(26270),  INT16_C(19866) },
+        {  INT16_C( 4270),  INT16_C(32524), -INT16_C(19340), -INT16_C(13128),  INT16_C( 8745), -INT16_C(30262),  INT16_C(27496),  INT16_C(13799) } } },
+    {  INT32_C( 5),
+      { { -INT16_C(19750),  INT16_C( 2728), -INT16_C(  869),  INT16_C( 5890),  INT16_C(15981), -INT16_C(30531),  INT16_C(31697), -INT16_C(19586) },
+        { -INT16_C(20446),  INT16_C( 2040),  INT16_C(27583),  INT16_C(11804), -INT16_C(24588), -INT16_C( 9092), -INT16_C( 5223),  INT16_C( 6964) } },
+      { -INT16_C( 1598), -INT16_C(14115) },
+      { { -INT16_C(19750),  INT16_C( 2728), -INT16_C(  869),  INT16_C( 5890),  INT16_C(15981), -INT16_C( 1598),  INT16_C(31697), -INT16_C(19586) },
+        { -INT16_C(20446),  INT16_C( 2040),  INT16_C(27583),  INT16_C(11804), -INT16_C(24588), -INT16_C(14115), -INT16_C( 5223),  INT16_C( 6964) } } },
+    {  INT32_C( 2),
+      { {  INT16_C( 7314), -INT16_C(24331),  INT16_C(21883), -INT16_C(27868),  INT16_C(22132), -INT16_C( 6112),  INT16_C(26953), -INT16_C(13586) },
+        {  INT16_C(13296),  INT16_C(25652), -INT16_C(29719), -INT16_C(30957),  INT16_C(22504), -INT16_C(20676),  INT16_C( 3598), -INT16_C(16149) } },
+      {  INT16_C(19996), -INT16_C(11781) },
+      { {  INT16_C( 7314), -INT16_C(24331),  INT16_C(19996), -INT16_C(27868),  INT16_C(22132), -INT16_C( 6112),  INT16_C(26953), -INT16_C(13586) },
+        {  INT16_C(13296),  INT16_C(25652), -INT16_C(11781), -INT16_C(30957),  INT16_C(22504), -INT16_C(20676),  INT16_C( 3598), -INT16_C(16149) } } },
+    {  INT32_C( 7),
+      { { -INT16_C(23263),  INT16_C( 4768),  INT16_C(27979), -INT16_C( 8677), -INT16_C(29698),  INT16_C(16932), -INT16_C(28141), -INT16_C( 9570) },
+        {  INT16_C(20667), -INT16_C(16416), -INT16_C( 5435),  INT16_C(20079),  INT16_C( 2186),  INT16_C( 9845),  INT16_C(13365),  INT16_C(12063) } },
+      {  INT16_C(21905),  INT16_C(17867) },
+      { { -INT16_C(23263),  INT16_C( 4768),  INT16_C(27979), -INT16_C( 8677), -INT16_C(29698),  INT16_C(16932), -INT16_C(28141),  INT16_C(21905) },
+        {  INT16_C(20667), -INT16_C(16416), -INT16_C( 5435),  INT16_C(20079),  INT16_C( 2186),  INT16_C( 9845),  INT16_C(13365),  INT16_C(17867) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t src = { {
+      simde_vld1q_s16(test_vec[i].src[0]),
+      simde_vld1q_s16(test_vec[i].src[1]) } };
+    simde_int16x8x2_t r;
+    SIMDE_CONSTIFY_8_(simde_vld2q_lane_s16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int32_t src[2][4];
+    int32_t buf[2];
+    int32_t r[2][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT32_C( 574932395),  INT32_C( 618236182),  INT32_C(1274769712), -INT32_C(1609684327) },
+        { -INT32_C(1511308716),  INT32_C(  19312613),  INT32_C(  84058263),  INT32_C(1783507574) } },
+      {  INT32_C( 994981570),  INT32_C(1278617434) },
+      { {  INT32_C( 994981570),  INT32_C( 618236182),  INT32_C(1274769712), -INT32_C(1609684327) },
+        {  INT32_C(1278617434),  INT32_C(  19312613),  INT32_C(  84058263),  INT32_C(1783507574) } } },
+    {  INT32_C( 1),
+      { { -INT32_C( 310384582), -INT32_C(1751502997), -INT32_C(1700313571),  INT32_C(1093180079) },
+        {  INT32_C(1379991825),  INT32_C( 339937518),  INT32_C(1048379459), -INT32_C( 791388393) } },
+      { -INT32_C(1824470927), -INT32_C(1546558529) },
+      { { -INT32_C( 310384582), -INT32_C(1824470927), -INT32_C(1700313571),  INT32_C(1093180079) },
+        {  INT32_C(1379991825), -INT32_C(1546558529),  INT32_C(1048379459), -INT32_C( 791388393) } } },
+    {  INT32_C( 2),
+      { {  INT32_C( 561963621), -INT32_C(  96098164),  INT32_C(1187600436), -INT32_C( 513531430) },
+        {  INT32_C(1686269545),  INT32_C(2123058499), -INT32_C( 290665343),  INT32_C( 212666975) } },
+      { -INT32_C(2060295324), -INT32_C(1185991836) },
+      { {  INT32_C( 561963621), -INT32_C(  96098164), -INT32_C(2060295324), -INT32_C( 513531430) },
+        {  INT32_C(1686269545),  INT32_C(2123058499), -INT32_C(1185991836),  INT32_C( 212666975) } } },
+    {  INT32_C( 3),
+      { {  INT32_C(1342584489),  INT32_C(1214677771), -INT32_C(1895365701), -INT32_C( 897415142) },
+        { -INT32_C( 811867907), -INT32_C(2030485571),  INT32_C( 889434393), -INT32_C(1967604683) } },
+      {  INT32_C(1091765228), -INT32_C(2100454011) },
+      { {  INT32_C(1342584489),  INT32_C(1214677771), -INT32_C(1895365701),  INT32_C(1091765228) },
+        { -INT32_C( 811867907), -INT32_C(2030485571),  INT32_C( 889434393), -INT32_C(2100454011) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t src = { {
+      simde_vld1q_s32(test_vec[i].src[0]),
+      simde_vld1q_s32(test_vec[i].src[1]) } };
+    simde_int32x4x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vld2q_lane_s32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int64_t src[2][2];
+    int64_t buf[2];
+    int64_t r[2][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT64_C( 481600682070482376), -INT64_C(7518090513954305599) },
+        {  INT64_C(4067229754179640217),  INT64_C(2523920858956876029) } },
+      {  INT64_C(4238463597763070096), -INT64_C(6473507875898096491) },
+      { {  INT64_C(4238463597763070096), -INT64_C(7518090513954305599) },
+        { -INT64_C(6473507875898096491),  INT64_C(2523920858956876029) } } },
+    {  INT32_C( 1),
+      { {  INT64_C(9145697527659760380),  INT64_C( 208222171651445404) },
+        { -INT64_C(7466556423404003254), -INT64_C( 740504251362643867) } },
+      {  INT64_C( 870046615734067168), -INT64_C(3037949414467599646) },
+      { {  INT64_C(9145697527659760380),  INT64_C( 870046615734067168) },
+        { -INT64_C(7466556423404003254), -INT64_C(3037949414467599646) } } },
+    {  INT32_C( 0),
+      { { -INT64_C(7478140060278478643), -INT64_C(3744684319875403433) },
+        { -INT64_C(2753174194977229130),  INT64_C(3482987107506319089) } },
+      {  INT64_C(1199016902622635287),  INT64_C(7760434508071608449) },
+      { {  INT64_C(1199016902622635287), -INT64_C(3744684319875403433) },
+        {  INT64_C(7760434508071608449),  INT64_C(3482987107506319089) } } },
+    {  INT32_C( 1),
+      { { -INT64_C(8945222146264402215),  INT64_C(3711617563437561426) },
+        { -INT64_C( 316383520374736289), -INT64_C(6602529166239013139) } },
+      {  INT64_C(9061822912057345046), -INT64_C(7922536248323921362) },
+      { { -INT64_C(8945222146264402215),  INT64_C(9061822912057345046) },
+        { -INT64_C( 316383520374736289), -INT64_C(7922536248323921362) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t src = { {
+      simde_vld1q_s64(test_vec[i].src[0]),
+      simde_vld1q_s64(test_vec[i].src[1]) } };
+    simde_int64x2x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld2q_lane_s64, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint8_t src[2][16];
+    uint8_t buf[2];
+    uint8_t r[2][16];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT8_C( 91), UINT8_C(176), UINT8_C( 70), UINT8_C( 42), UINT8_C(170), UINT8_C(148), UINT8_C( 43), UINT8_C(  2),
+          UINT8_C(149), UINT8_C( 86), UINT8_C( 38), UINT8_C(108), UINT8_C( 23), UINT8_C(201), UINT8_C( 14), UINT8_C(219) },
+        { UINT8_C( 92), UINT8_C(157), UINT8_C(237), UINT8_C(172), UINT8_C( 60), UINT8_C(124), UINT8_C(171), UINT8_C( 75),
+          UINT8_C(132), UINT8_C(130), UINT8_C( 34), UINT8_C(212), UINT8_C( 78), UINT8_C(236), UINT8_C(129), UINT8_C(193) } },
+      { UINT8_C( 54), UINT8_C(231) },
+      { { UINT8_C( 54), UINT8_C(176), UINT8_C( 70), UINT8_C( 42), UINT8_C(170), UINT8_C(148), UINT8_C( 43), UINT8_C(  2),
+          UINT8_C(149), UINT8_C( 86), UINT8_C( 38), UINT8_C(108), UINT8_C( 23), UINT8_C(201), UINT8_C( 14), UINT8_C(219) },
+        { UINT8_C(231), UINT8_C(157), UINT8_C(237), UINT8_C(172), UINT8_C( 60), UINT8_C(124), UINT8_C(171), UINT8_C( 75),
+          UINT8_C(132), UINT8_C(130), UINT8_C( 34), UINT8_C(212), UINT8_C( 78), UINT8_C(236), UINT8_C(129), UINT8_C(193) } } },
+    {  INT32_C( 5),
+      { { UINT8_C(122), UINT8_C( 69), UINT8_C(221), UINT8_C(100), UINT8_C(180), UINT8_C(242), UINT8_C(107), UINT8_C( 42),
+          UINT8_C(  5), UINT8_C( 56), UINT8_C( 91), UINT8_C( 68), UINT8_C(193), UINT8_C(135), UINT8_C( 64), UINT8_C(125) },
+        { UINT8_C(162), UINT8_C( 72), UINT8_C(164), UINT8_C( 99), UINT8_C(111), UINT8_C(246), UINT8_C( 12), UINT8_C( 56),
+          UINT8_C(192), UINT8_C(132), UINT8_C(158), UINT8_C(159), UINT8_C(130), UINT8_C(138), UINT8_C(184), UINT8_C(102) } },
+      {    UINT8_MAX, UINT8_C(145) },
+      { { UINT8_C(122), UINT8_C( 69), UINT8_C(221), UINT8_C(100), UINT8_C(180),    UINT8_MAX, UINT8_C(107), UINT8_C( 42),
+          UINT8_C(  5), UINT8_C( 56), UINT8_C( 91), UINT8_C( 68), UINT8_C(193), UINT8_C(135), UINT8_C( 64), UINT8_C(125) },
+        { UINT8_C(162), UINT8_C( 72), UINT8_C(164), UINT8_C( 99), UINT8_C(111), UINT8_C(145), UINT8_C( 12), UINT8_C( 56),
+          UINT8_C(192), UINT8_C(132), UINT8_C(158), UINT8_C(159), UINT8_C(130), UINT8_C(138), UINT8_C(184), UINT8_C(102) } } },
+    {  INT32_C(10),
+      { { UINT8_C( 65), UINT8_C( 96), UINT8_C( 32), UINT8_C(198), UINT8_C(221), UINT8_C( 67), UINT8_C(200), UINT8_C(153),
+          UINT8_C( 36), UINT8_C(162), UINT8_C( 49), UINT8_C( 30), UINT8_C(129), UINT8_C(118), UINT8_C(129), UINT8_C(100) },
+        { UINT8_C(141), UINT8_C(166), UINT8_C(237), UINT8_C(137), UINT8_C( 24), UINT8_C(147), UINT8_C( 51), UINT8_C( 47),
+          UINT8_C(113), UINT8_C(108), UINT8_C(123), UINT8_C(223), UINT8_C( 15), UINT8_C(213), UINT8_C(107), UINT8_C(108) } },
+      { UINT8_C(141), UINT8_C(126) },
+      { { UINT8_C( 65), UINT8_C( 96), UINT8_C( 32), UINT8_C(198), UINT8_C(221), UINT8_C( 67), UINT8_C(200), UINT8_C(153),
+          UINT8_C( 36), UINT8_C(162), UINT8_C(141), UINT8_C( 30), UINT8_C(129), UINT8_C(118), UINT8_C(129), UINT8_C(100) },
+        { UINT8_C(141), UINT8_C(166), UINT8_C(237), UINT8_C(137), UINT8_C( 24), UINT8_C(147), UINT8_C( 51), UINT8_C( 47),
+          UINT8_C(113), UINT8_C(108), UINT8_C(126), UINT8_C(223), UINT8_C( 15), UINT8_C(213), UINT8_C(107), UINT8_C(108) } } },
+    {  INT32_C(15),
+      { { UINT8_C( 74), UINT8_C( 19), UINT8_C(103), UINT8_C( 15), UINT8_C(212), UINT8_C(167), UINT8_C(195), UINT8_C( 61),
+          UINT8_C( 60), UINT8_C( 76), UINT8_C( 36), UINT8_C(142), UINT8_C( 23), UINT8_C( 14), UINT8_C(170), UINT8_C(226) },
+        { UINT8_C( 60), UINT8_C(204), UINT8_C(158), UINT8_C(117), UINT8_C(112), UINT8_C(  5), UINT8_C(146), UINT8_C( 43),
+          UINT8_C( 47), UINT8_C(199), UINT8_C( 86), UINT8_C(120), UINT8_C(  9), UINT8_C(142), UINT8_C(189), UINT8_C(129) } },
+      { UINT8_C(168), UINT8_C(  6) },
+      { { UINT8_C( 74), UINT8_C( 19), UINT8_C(103), UINT8_C( 15), UINT8_C(212), UINT8_C(167), UINT8_C(195), UINT8_C( 61),
+          UINT8_C( 60), UINT8_C( 76), UINT8_C( 36), UINT8_C(142), UINT8_C( 23), UINT8_C( 14), UINT8_C(170), UINT8_C(168) },
+        { UINT8_C( 60), UINT8_C(204), UINT8_C(158), UINT8_C(117), UINT8_C(112), UINT8_C(  5), UINT8_C(146), UINT8_C( 43),
+          UINT8_C( 47), UINT8_C(199), UINT8_C( 86), UINT8_C(120), UINT8_C(  9), UINT8_C(142), UINT8_C(189), UINT8_C(  6) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t src = { {
+      simde_vld1q_u8(test_vec[i].src[0]),
+      simde_vld1q_u8(test_vec[i].src[1]) } };
+    simde_uint8x16x2_t r;
+    SIMDE_CONSTIFY_16_(simde_vld2q_lane_u8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint16_t src[2][8];
+    uint16_t buf[2];
+    uint16_t r[2][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT16_C( 1498), UINT16_C(25870), UINT16_C(14645), UINT16_C(35767), UINT16_C(33499), UINT16_C(40131), UINT16_C( 9535), UINT16_C(26549) },
+        { UINT16_C(13950), UINT16_C(47403), UINT16_C(23943), UINT16_C(22162), UINT16_C(50993), UINT16_C( 1523), UINT16_C( 2162), UINT16_C(  540) } },
+      { UINT16_C(18820), UINT16_C(10075) },
+      { { UINT16_C(18820), UINT16_C(25870), UINT16_C(14645), UINT16_C(35767), UINT16_C(33499), UINT16_C(40131), UINT16_C( 9535), UINT16_C(26549) },
+        { UINT16_C(10075), UINT16_C(47403), UINT16_C(23943), UINT16_C(22162), UINT16_C(50993), UINT16_C( 1523), UINT16_C( 2162), UINT16_C(  540) } } },
+    {  INT32_C( 5),
+      { { UINT16_C( 1011), UINT16_C(25102), UINT16_C(45160), UINT16_C(61927), UINT16_C(54460), UINT16_C(32503), UINT16_C(42793), UINT16_C(29181) },
+        { UINT16_C(59328), UINT16_C(46256), UINT16_C(35054), UINT16_C(18551), UINT16_C(52185), UINT16_C(44637), UINT16_C(12302), UINT16_C( 3844) } },
+      { UINT16_C( 1353), UINT16_C(52804) },
+      { { UINT16_C( 1011), UINT16_C(25102), UINT16_C(45160), UINT16_C(61927), UINT16_C(54460), UINT16_C( 1353), UINT16_C(42793), UINT16_C(29181) },
+        { UINT16_C(59328), UINT16_C(46256), UINT16_C(35054), UINT16_C(18551), UINT16_C(52185), UINT16_C(52804), UINT16_C(12302), UINT16_C( 3844) } } },
+    {  INT32_C( 2),
+      { { UINT16_C(39125), UINT16_C(15517), UINT16_C(17811), UINT16_C(55179), UINT16_C(14513), UINT16_C(40652), UINT16_C(  738), UINT16_C(17670) },
+        { UINT16_C(36781), UINT16_C(29067), UINT16_C(49271), UINT16_C(17498), UINT16_C(45853), UINT16_C(26955), UINT16_C(40532), UINT16_C(17445) } },
+      { UINT16_C(41247), UINT16_C(58965) },
+      { { UINT16_C(39125), UINT16_C(15517), UINT16_C(41247), UINT16_C(55179), UINT16_C(14513), UINT16_C(40652), UINT16_C(  738), UINT16_C(17670) },
+        { UINT16_C(36781), UINT16_C(29067), UINT16_C(58965), UINT16_C(17498), UINT16_C(45853), UINT16_C(26955), UINT16_C(40532), UINT16_C(17445) } } },
+    {  INT32_C( 7),
+      { { UINT16_C(27599), UINT16_C( 7125), UINT16_C(59781), UINT16_C(44363), UINT16_C(59700), UINT16_C( 7865), UINT16_C(28124), UINT16_C(11771) },
+        { UINT16_C( 4560), UINT16_C(17299), UINT16_C(29432), UINT16_C( 8544), UINT16_C(63426), UINT16_C(11684), UINT16_C(64836), UINT16_C(41177) } },
+      { UINT16_C(51098), UINT16_C(64569) },
+      { { UINT16_C(27599), UINT16_C( 7125), UINT16_C(59781), UINT16_C(44363), UINT16_C(59700), UINT16_C( 7865), UINT16_C(28124), UINT16_C(51098) },
+        { UINT16_C( 4560), UINT16_C(17299), UINT16_C(29432), UINT16_C( 8544), UINT16_C(63426), UINT16_C(11684), UINT16_C(64836), UINT16_C(64569) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t src = { {
+      simde_vld1q_u16(test_vec[i].src[0]),
+      simde_vld1q_u16(test_vec[i].src[1]) } };
+    simde_uint16x8x2_t r;
+    SIMDE_CONSTIFY_8_(simde_vld2q_lane_u16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint32_t src[2][4];
+    uint32_t buf[2];
+    uint32_t r[2][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT32_C(3580487914), UINT32_C(3046416771), UINT32_C(2120375134), UINT32_C(3755533261) },
+        { UINT32_C(4017968599), UINT32_C(1840442471), UINT32_C( 721511373), UINT32_C( 426798489) } },
+      { UINT32_C(3324234367), UINT32_C( 902571631) },
+      { { UINT32_C(3324234367), UINT32_C(3046416771), UINT32_C(2120375134), UINT32_C(3755533261) },
+        { UINT32_C( 902571631), UINT32_C(1840442471), UINT32_C( 721511373), UINT32_C( 426798489) } } },
+    {  INT32_C( 1),
+      { { UINT32_C( 293493892), UINT32_C(3886940735), UINT32_C(3465040938), UINT32_C(1756451097) },
+        { UINT32_C(2301532560), UINT32_C( 338817392), UINT32_C(1357906027), UINT32_C(2545805611) } },
+      { UINT32_C(1083703217), UINT32_C( 791971507) },
+      { { UINT32_C( 293493892), UINT32_C(1083703217), UINT32_C(3465040938), UINT32_C(1756451097) },
+        { UINT32_C(2301532560), UINT32_C( 791971507), UINT32_C(1357906027), UINT32_C(2545805611) } } },
+    {  INT32_C( 2),
+      { { UINT32_C(4214247935), UINT32_C(  15460707), UINT32_C(2772840118), UINT32_C(1878818145) },
+        { UINT32_C(1305064874), UINT32_C(2598541522), UINT32_C(3327391639), UINT32_C(1644462709) } },
+      { UINT32_C( 658509818), UINT32_C(2633952660) },
+      { { UINT32_C(4214247935), UINT32_C(  15460707), UINT32_C( 658509818), UINT32_C(1878818145) },
+        { UINT32_C(1305064874), UINT32_C(2598541522), UINT32_C(2633952660), UINT32_C(1644462709) } } },
+    {  INT32_C( 3),
+      { { UINT32_C(2425076350), UINT32_C(2626322130), UINT32_C( 681046513), UINT32_C(2083850967) },
+        { UINT32_C(3527481131), UINT32_C(3765077554), UINT32_C(2321226174), UINT32_C(3826158103) } },
+      { UINT32_C(3524492163), UINT32_C(1139485711) },
+      { { UINT32_C(2425076350), UINT32_C(2626322130), UINT32_C( 681046513), UINT32_C(3524492163) },
+        { UINT32_C(3527481131), UINT32_C(3765077554), UINT32_C(2321226174), UINT32_C(1139485711) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t src = { {
+      simde_vld1q_u32(test_vec[i].src[0]),
+      simde_vld1q_u32(test_vec[i].src[1]) } };
+    simde_uint32x4x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vld2q_lane_u32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint64_t src[2][2];
+    uint64_t buf[2];
+    uint64_t r[2][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT64_C(17035845155113094484), UINT64_C( 5325063692836499699) },
+        { UINT64_C(12398337592360973782), UINT64_C(14066043800019137458) } },
+      { UINT64_C(13895938959369418297), UINT64_C(11047347958700730050) },
+      { { UINT64_C(13895938959369418297), UINT64_C( 5325063692836499699) },
+        { UINT64_C(11047347958700730050), UINT64_C(14066043800019137458) } } },
+    {  INT32_C( 1),
+      { { UINT64_C( 2689039773769243808), UINT64_C(12192129274343228919) },
+        { UINT64_C( 4291243837979863394), UINT64_C(10778270795068558054) } },
+      { UINT64_C(17996600199350984287), UINT64_C(10254664369117700135) },
+      { { UINT64_C( 2689039773769243808), UINT64_C(17996600199350984287) },
+        { UINT64_C( 4291243837979863394), UINT64_C(10254664369117700135) } } },
+    {  INT32_C( 0),
+      { { UINT64_C(10922004442776153684), UINT64_C( 5761801707015074669) },
+        { UINT64_C(10121025385968722989), UINT64_C( 7353614142959774272) } },
+      { UINT64_C(12389620820440334410), UINT64_C( 7450599480592108413) },
+      { { UINT64_C(12389620820440334410), UINT64_C( 5761801707015074669) },
+        { UINT64_C( 7450599480592108413), UINT64_C( 7353614142959774272) } } },
+    {  INT32_C( 1),
+      { { UINT64_C(14675599758543476398), UINT64_C(11367880050536036536) },
+        { UINT64_C( 1068637198397169052), UINT64_C( 3802429112586891770) } },
+      { UINT64_C(12742667201240756793), UINT64_C( 6462778670104923149) },
+      { { UINT64_C(14675599758543476398), UINT64_C(12742667201240756793) },
+        { UINT64_C( 1068637198397169052), UINT64_C( 6462778670104923149) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t src = { {
+      simde_vld1q_u64(test_vec[i].src[0]),
+      simde_vld1q_u64(test_vec[i].src[1]) } };
+    simde_uint64x2x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld2q_lane_u64, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float32_t src[2][4];
+    simde_float32_t buf[2];
+    simde_float32_t r[2][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT32_C(   -37.99), SIMDE_FLOAT32_C(  -219.55), SIMDE_FLOAT32_C(   893.04), SIMDE_FLOAT32_C(   670.83) },
+        { SIMDE_FLOAT32_C(  -453.31), SIMDE_FLOAT32_C(  -931.14), SIMDE_FLOAT32_C(  -727.89), SIMDE_FLOAT32_C(   690.83) } },
+      { SIMDE_FLOAT32_C(   685.64), SIMDE_FLOAT32_C(   123.16) },
+      { { SIMDE_FLOAT32_C(   685.64), SIMDE_FLOAT32_C(  -219.55), SIMDE_FLOAT32_C(   893.04), SIMDE_FLOAT32_C(   670.83) },
+        { SIMDE_FLOAT32_C(   123.16), SIMDE_FLOAT32_C(  -931.14), SIMDE_FLOAT32_C(  -727.89), SIMDE_FLOAT32_C(   690.83) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT32_C(  -669.08), SIMDE_FLOAT32_C(  -376.25), SIMDE_FLOAT32_C(  -852.81), SIMDE_FLOAT32_C(   534.62) },
+        { SIMDE_FLOAT32_C(   558.58), SIMDE_FLOAT32_C(  -862.64), SIMDE_FLOAT32_C(  -131.18), SIMDE_FLOAT32_C(  -295.55) } },
+      { SIMDE_FLOAT32_C(   279.41), SIMDE_FLOAT32_C(  -146.26) },
+      { { SIMDE_FLOAT32_C(  -669.08), SIMDE_FLOAT32_C(   279.41), SIMDE_FLOAT32_C(  -852.81), SIMDE_FLOAT32_C(   534.62) },
+        { SIMDE_FLOAT32_C(   558.58), SIMDE_FLOAT32_C(  -146.26), SIMDE_FLOAT32_C(  -131.18), SIMDE_FLOAT32_C(  -295.55) } } },
+    {  INT32_C( 2),
+      { { SIMDE_FLOAT32_C(   208.34), SIMDE_FLOAT32_C(  -881.94), SIMDE_FLOAT32_C(   290.06), SIMDE_FLOAT32_C(   795.17) },
+        { SIMDE_FLOAT32_C(   692.71), SIMDE_FLOAT32_C(  -803.00), SIMDE_FLOAT32_C(  -553.03), SIMDE_FLOAT32_C(  -523.14) } },
+      { SIMDE_FLOAT32_C(   737.65), SIMDE_FLOAT32_C(   617.26) },
+      { { SIMDE_FLOAT32_C(   208.34), SIMDE_FLOAT32_C(  -881.94), SIMDE_FLOAT32_C(   737.65), SIMDE_FLOAT32_C(   795.17) },
+        { SIMDE_FLOAT32_C(   692.71), SIMDE_FLOAT32_C(  -803.00), SIMDE_FLOAT32_C(   617.26), SIMDE_FLOAT32_C(  -523.14) } } },
+    {  INT32_C( 3),
+      { { SIMDE_FLOAT32_C(   -65.37), SIMDE_FLOAT32_C(  -841.18), SIMDE_FLOAT32_C(   -37.67), SIMDE_FLOAT32_C(  -289.89) },
+        { SIMDE_FLOAT32_C(  -106.81), SIMDE_FLOAT32_C(   192.17), SIMDE_FLOAT32_C(   743.98), SIMDE_FLOAT32_C(   794.91) } },
+      { SIMDE_FLOAT32_C(   949.56), SIMDE_FLOAT32_C(   334.82) },
+      { { SIMDE_FLOAT32_C(   -65.37), SIMDE_FLOAT32_C(  -841.18), SIMDE_FLOAT32_C(   -37.67), SIMDE_FLOAT32_C(   949.56) },
+        { SIMDE_FLOAT32_C(  -106.81), SIMDE_FLOAT32_C(   192.17), SIMDE_FLOAT32_C(   743.98), SIMDE_FLOAT32_C(   334.82) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t src = { {
+      simde_vld1q_f32(test_vec[i].src[0]),
+      simde_vld1q_f32(test_vec[i].src[1]) } };
+    simde_float32x4x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vld2q_lane_f32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float64_t src[2][2];
+    simde_float64_t buf[2];
+    simde_float64_t r[2][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(   294.44), SIMDE_FLOAT64_C(   299.11) },
+        { SIMDE_FLOAT64_C(   746.38), SIMDE_FLOAT64_C(  -673.25) } },
+      { SIMDE_FLOAT64_C(   639.39), SIMDE_FLOAT64_C(  -442.13) },
+      { { SIMDE_FLOAT64_C(   639.39), SIMDE_FLOAT64_C(   299.11) },
+        { SIMDE_FLOAT64_C(  -442.13), SIMDE_FLOAT64_C(  -673.25) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT64_C(  -320.01), SIMDE_FLOAT64_C(   396.64) },
+        { SIMDE_FLOAT64_C(   439.27), SIMDE_FLOAT64_C(   410.38) } },
+      { SIMDE_FLOAT64_C(   366.34), SIMDE_FLOAT64_C(  -206.35) },
+      { { SIMDE_FLOAT64_C(  -320.01), SIMDE_FLOAT64_C(   366.34) },
+        { SIMDE_FLOAT64_C(   439.27), SIMDE_FLOAT64_C(  -206.35) } } },
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(   878.38), SIMDE_FLOAT64_C(  -156.67) },
+        { SIMDE_FLOAT64_C(   879.91), SIMDE_FLOAT64_C(   735.25) } },
+      { SIMDE_FLOAT64_C(   134.18), SIMDE_FLOAT64_C(   835.24) },
+      { { SIMDE_FLOAT64_C(   134.18), SIMDE_FLOAT64_C(  -156.67) },
+        { SIMDE_FLOAT64_C(   835.24), SIMDE_FLOAT64_C(   735.25) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT64_C(  -484.35), SIMDE_FLOAT64_C(   346.05) },
+        { SIMDE_FLOAT64_C(  -157.91), SIMDE_FLOAT64_C(   344.94) } },
+      { SIMDE_FLOAT64_C(   295.47), SIMDE_FLOAT64_C(  -317.63) },
+      { { SIMDE_FLOAT64_C(  -484.35), SIMDE_FLOAT64_C(   295.47) },
+        { SIMDE_FLOAT64_C(  -157.91), SIMDE_FLOAT64_C(  -317.63) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t src = { {
+      simde_vld1q_f64(test_vec[i].src[0]),
+      simde_vld1q_f64(test_vec[i].src[1]) } };
+    simde_float64x2x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vld2q_lane_f64, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_f64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
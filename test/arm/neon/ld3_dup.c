@@ -0,0 +1,760 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld3_dup
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld3_dup.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vld3_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t buf[3];
+    simde_float32_t r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -495.06), SIMDE_FLOAT32_C(  -247.28), SIMDE_FLOAT32_C(   403.36) },
+      { { SIMDE_FLOAT32_C(  -495.06), SIMDE_FLOAT32_C(  -495.06) },
+        { SIMDE_FLOAT32_C(  -247.28), SIMDE_FLOAT32_C(  -247.28) },
+        { SIMDE_FLOAT32_C(   403.36), SIMDE_FLOAT32_C(   403.36) } } },
+    { { SIMDE_FLOAT32_C(   757.08), SIMDE_FLOAT32_C(   658.31), SIMDE_FLOAT32_C(    24.69) },
+      { { SIMDE_FLOAT32_C(   757.08), SIMDE_FLOAT32_C(   757.08) },
+        { SIMDE_FLOAT32_C(   658.31), SIMDE_FLOAT32_C(   658.31) },
+        { SIMDE_FLOAT32_C(    24.69), SIMDE_FLOAT32_C(    24.69) } } },
+    { { SIMDE_FLOAT32_C(   683.40), SIMDE_FLOAT32_C(  -403.01), SIMDE_FLOAT32_C(   247.61) },
+      { { SIMDE_FLOAT32_C(   683.40), SIMDE_FLOAT32_C(   683.40) },
+        { SIMDE_FLOAT32_C(  -403.01), SIMDE_FLOAT32_C(  -403.01) },
+        { SIMDE_FLOAT32_C(   247.61), SIMDE_FLOAT32_C(   247.61) } } },
+    { { SIMDE_FLOAT32_C(  -428.75), SIMDE_FLOAT32_C(   787.95), SIMDE_FLOAT32_C(  -218.77) },
+      { { SIMDE_FLOAT32_C(  -428.75), SIMDE_FLOAT32_C(  -428.75) },
+        { SIMDE_FLOAT32_C(   787.95), SIMDE_FLOAT32_C(   787.95) },
+        { SIMDE_FLOAT32_C(  -218.77), SIMDE_FLOAT32_C(  -218.77) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x3_t r = simde_vld3_dup_f32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[2], simde_vld1_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t buf[3];
+    simde_float64_t r[3][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -925.31), SIMDE_FLOAT64_C(   545.73), SIMDE_FLOAT64_C(  -700.78) },
+      { { SIMDE_FLOAT64_C(  -925.31) },
+        { SIMDE_FLOAT64_C(   545.73) },
+        { SIMDE_FLOAT64_C(  -700.78) } } },
+    { { SIMDE_FLOAT64_C(   705.75), SIMDE_FLOAT64_C(   656.14), SIMDE_FLOAT64_C(   750.76) },
+      { { SIMDE_FLOAT64_C(   705.75) },
+        { SIMDE_FLOAT64_C(   656.14) },
+        { SIMDE_FLOAT64_C(   750.76) } } },
+    { { SIMDE_FLOAT64_C(  -887.81), SIMDE_FLOAT64_C(  -382.41), SIMDE_FLOAT64_C(  -908.04) },
+      { { SIMDE_FLOAT64_C(  -887.81) },
+        { SIMDE_FLOAT64_C(  -382.41) },
+        { SIMDE_FLOAT64_C(  -908.04) } } },
+    { { SIMDE_FLOAT64_C(  -930.96), SIMDE_FLOAT64_C(  -133.39), SIMDE_FLOAT64_C(   188.04) },
+      { { SIMDE_FLOAT64_C(  -930.96) },
+        { SIMDE_FLOAT64_C(  -133.39) },
+        { SIMDE_FLOAT64_C(   188.04) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x3_t r = simde_vld3_dup_f64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[2], simde_vld1_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t buf[3];
+    int8_t r[3][8];
+  } test_vec[] = {
+    { { -INT8_C(110),  INT8_C( 33),  INT8_C( 37) },
+      { { -INT8_C(110), -INT8_C(110), -INT8_C(110), -INT8_C(110), -INT8_C(110), -INT8_C(110), -INT8_C(110), -INT8_C(110) },
+        {  INT8_C( 33),  INT8_C( 33),  INT8_C( 33),  INT8_C( 33),  INT8_C( 33),  INT8_C( 33),  INT8_C( 33),  INT8_C( 33) },
+        {  INT8_C( 37),  INT8_C( 37),  INT8_C( 37),  INT8_C( 37),  INT8_C( 37),  INT8_C( 37),  INT8_C( 37),  INT8_C( 37) } } },
+    { {  INT8_C( 57), -INT8_C( 57),  INT8_C( 93) },
+      { {  INT8_C( 57),  INT8_C( 57),  INT8_C( 57),  INT8_C( 57),  INT8_C( 57),  INT8_C( 57),  INT8_C( 57),  INT8_C( 57) },
+        { -INT8_C( 57), -INT8_C( 57), -INT8_C( 57), -INT8_C( 57), -INT8_C( 57), -INT8_C( 57), -INT8_C( 57), -INT8_C( 57) },
+        {  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93),  INT8_C( 93) } } },
+    { {  INT8_C( 56),  INT8_C( 79), -INT8_C( 38) },
+      { {  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56),  INT8_C( 56) },
+        {  INT8_C( 79),  INT8_C( 79),  INT8_C( 79),  INT8_C( 79),  INT8_C( 79),  INT8_C( 79),  INT8_C( 79),  INT8_C( 79) },
+        { -INT8_C( 38), -INT8_C( 38), -INT8_C( 38), -INT8_C( 38), -INT8_C( 38), -INT8_C( 38), -INT8_C( 38), -INT8_C( 38) } } },
+    { {  INT8_C( 62), -INT8_C( 44), -INT8_C(  6) },
+      { {  INT8_C( 62),  INT8_C( 62),  INT8_C( 62),  INT8_C( 62),  INT8_C( 62),  INT8_C( 62),  INT8_C( 62),  INT8_C( 62) },
+        { -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44) },
+        { -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x3_t r = simde_vld3_dup_s8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[2], simde_vld1_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t buf[3];
+    int16_t r[3][4];
+  } test_vec[] = {
+    { { -INT16_C(18704),  INT16_C(10531),  INT16_C(11154) },
+      { { -INT16_C(18704), -INT16_C(18704), -INT16_C(18704), -INT16_C(18704) },
+        {  INT16_C(10531),  INT16_C(10531),  INT16_C(10531),  INT16_C(10531) },
+        {  INT16_C(11154),  INT16_C(11154),  INT16_C(11154),  INT16_C(11154) } } },
+    { { -INT16_C( 8272),  INT16_C( 9580),  INT16_C(20494) },
+      { { -INT16_C( 8272), -INT16_C( 8272), -INT16_C( 8272), -INT16_C( 8272) },
+        {  INT16_C( 9580),  INT16_C( 9580),  INT16_C( 9580),  INT16_C( 9580) },
+        {  INT16_C(20494),  INT16_C(20494),  INT16_C(20494),  INT16_C(20494) } } },
+    { { -INT16_C( 9730), -INT16_C(12793),  INT16_C( 9431) },
+      { { -INT16_C( 9730), -INT16_C( 9730), -INT16_C( 9730), -INT16_C( 9730) },
+        { -INT16_C(12793), -INT16_C(12793), -INT16_C(12793), -INT16_C(12793) },
+        {  INT16_C( 9431),  INT16_C( 9431),  INT16_C( 9431),  INT16_C( 9431) } } },
+    { { -INT16_C(12813),  INT16_C(13296),  INT16_C(13741) },
+      { { -INT16_C(12813), -INT16_C(12813), -INT16_C(12813), -INT16_C(12813) },
+        {  INT16_C(13296),  INT16_C(13296),  INT16_C(13296),  INT16_C(13296) },
+        {  INT16_C(13741),  INT16_C(13741),  INT16_C(13741),  INT16_C(13741) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x3_t r = simde_vld3_dup_s16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[2], simde_vld1_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t buf[3];
+    int32_t r[3][2];
+  } test_vec[] = {
+    { { -INT32_C( 365541999), -INT32_C(1540786772),  INT32_C( 329517268) },
+      { { -INT32_C( 365541999), -INT32_C( 365541999) },
+        { -INT32_C(1540786772), -INT32_C(1540786772) },
+        {  INT32_C( 329517268),  INT32_C( 329517268) } } },
+    { {  INT32_C( 940218011),  INT32_C(2144911132), -INT32_C(  95650249) },
+      { {  INT32_C( 940218011),  INT32_C( 940218011) },
+        {  INT32_C(2144911132),  INT32_C(2144911132) },
+        { -INT32_C(  95650249), -INT32_C(  95650249) } } },
+    { {  INT32_C( 383734118),  INT32_C(1236992086),  INT32_C(1675620208) },
+      { {  INT32_C( 383734118),  INT32_C( 383734118) },
+        {  INT32_C(1236992086),  INT32_C(1236992086) },
+        {  INT32_C(1675620208),  INT32_C(1675620208) } } },
+    { { -INT32_C( 298774918),  INT32_C(1380942838),  INT32_C(  95425447) },
+      { { -INT32_C( 298774918), -INT32_C( 298774918) },
+        {  INT32_C(1380942838),  INT32_C(1380942838) },
+        {  INT32_C(  95425447),  INT32_C(  95425447) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x3_t r = simde_vld3_dup_s32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[2], simde_vld1_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t buf[3];
+    int64_t r[3][1];
+  } test_vec[] = {
+    { {  INT64_C(5016721913703230734),  INT64_C(1339261088161225349),  INT64_C(3943697416293073720) },
+      { {  INT64_C(5016721913703230734) },
+        {  INT64_C(1339261088161225349) },
+        {  INT64_C(3943697416293073720) } } },
+    { {  INT64_C(4820476328327905977),  INT64_C(5126894305961593847), -INT64_C(3345531616062810896) },
+      { {  INT64_C(4820476328327905977) },
+        {  INT64_C(5126894305961593847) },
+        { -INT64_C(3345531616062810896) } } },
+    { { -INT64_C(1559896565266726087),  INT64_C(4864329550542322932),  INT64_C(4927491172004629201) },
+      { { -INT64_C(1559896565266726087) },
+        {  INT64_C(4864329550542322932) },
+        {  INT64_C(4927491172004629201) } } },
+    { {  INT64_C(1635678850067999814),  INT64_C(6289320103699950578),  INT64_C(5387665383252450985) },
+      { {  INT64_C(1635678850067999814) },
+        {  INT64_C(6289320103699950578) },
+        {  INT64_C(5387665383252450985) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x3_t r = simde_vld3_dup_s64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[2], simde_vld1_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t buf[3];
+    uint8_t r[3][8];
+  } test_vec[] = {
+    { { UINT8_C(214), UINT8_C(154), UINT8_C( 39) },
+      { { UINT8_C(214), UINT8_C(214), UINT8_C(214), UINT8_C(214), UINT8_C(214), UINT8_C(214), UINT8_C(214), UINT8_C(214) },
+        { UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154) },
+        { UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39), UINT8_C( 39) } } },
+    { { UINT8_C(154), UINT8_C(254), UINT8_C( 91) },
+      { { UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154), UINT8_C(154) },
+        { UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254) },
+        { UINT8_C( 91), UINT8_C( 91), UINT8_C( 91), UINT8_C( 91), UINT8_C( 91), UINT8_C( 91), UINT8_C( 91), UINT8_C( 91) } } },
+    { { UINT8_C( 99), UINT8_C( 13), UINT8_C(201) },
+      { { UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99) },
+        { UINT8_C( 13), UINT8_C( 13), UINT8_C( 13), UINT8_C( 13), UINT8_C( 13), UINT8_C( 13), UINT8_C( 13), UINT8_C( 13) },
+        { UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201) } } },
+    { { UINT8_C( 55), UINT8_C(222), UINT8_C( 49) },
+      { { UINT8_C( 55), UINT8_C( 55), UINT8_C( 55), UINT8_C( 55), UINT8_C( 55), UINT8_C( 55), UINT8_C( 55), UINT8_C( 55) },
+        { UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222) },
+        { UINT8_C( 49), UINT8_C( 49), UINT8_C( 49), UINT8_C( 49), UINT8_C( 49), UINT8_C( 49), UINT8_C( 49), UINT8_C( 49) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x3_t r = simde_vld3_dup_u8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[2], simde_vld1_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t buf[3];
+    uint16_t r[3][4];
+  } test_vec[] = {
+    { { UINT16_C(47426), UINT16_C(36209), UINT16_C(16011) },
+      { { UINT16_C(47426), UINT16_C(47426), UINT16_C(47426), UINT16_C(47426) },
+        { UINT16_C(36209), UINT16_C(36209), UINT16_C(36209), UINT16_C(36209) },
+        { UINT16_C(16011), UINT16_C(16011), UINT16_C(16011), UINT16_C(16011) } } },
+    { { UINT16_C(47940), UINT16_C(38087), UINT16_C(38851) },
+      { { UINT16_C(47940), UINT16_C(47940), UINT16_C(47940), UINT16_C(47940) },
+        { UINT16_C(38087), UINT16_C(38087), UINT16_C(38087), UINT16_C(38087) },
+        { UINT16_C(38851), UINT16_C(38851), UINT16_C(38851), UINT16_C(38851) } } },
+    { { UINT16_C(32924), UINT16_C(53889), UINT16_C( 7866) },
+      { { UINT16_C(32924), UINT16_C(32924), UINT16_C(32924), UINT16_C(32924) },
+        { UINT16_C(53889), UINT16_C(53889), UINT16_C(53889), UINT16_C(53889) },
+        { UINT16_C( 7866), UINT16_C( 7866), UINT16_C( 7866), UINT16_C( 7866) } } },
+    { { UINT16_C(17276), UINT16_C(64786), UINT16_C(60871) },
+      { { UINT16_C(17276), UINT16_C(17276), UINT16_C(17276), UINT16_C(17276) },
+        { UINT16_C(64786), UINT16_C(64786), UINT16_C(64786), UINT16_C(64786) },
+        { UINT16_C(60871), UINT16_C(60871), UINT16_C(60871), UINT16_C(60871) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x3_t r = simde_vld3_dup_u16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[2], simde_vld1_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t buf[3];
+    uint32_t r[3][2];
+  } test_vec[] = {
+    { { UINT32_C( 584589760), UINT32_C(2258685451), UINT32_C(3102137341) },
+      { { UINT32_C( 584589760), UINT32_C( 584589760) },
+        { UINT32_C(2258685451), UINT32_C(2258685451) },
+        { UINT32_C(3102137341), UINT32_C(3102137341) } } },
+    { { UINT32_C(1336062131), UINT32_C(4126735865), UINT32_C(1168442614) },
+      { { UINT32_C(1336062131), UINT32_C(1336062131) },
+        { UINT32_C(4126735865), UINT32_C(4126735865) },
+        { UINT32_C(1168442614), UINT32_C(1168442614) } } },
+    { { UINT32_C(2526301561), UINT32_C( 700060730), UINT32_C(2165129342) },
+      { { UINT32_C(2526301561), UINT32_C(2526301561) },
+        { UINT32_C( 700060730), UINT32_C( 700060730) },
+        { UINT32_C(2165129342), UINT32_C(2165129342) } } },
+    { { UINT32_C(1372217857), UINT32_C( 414408585), UINT32_C(  76622298) },
+      { { UINT32_C(1372217857), UINT32_C(1372217857) },
+        { UINT32_C( 414408585), UINT32_C( 414408585) },
+        { UINT32_C(  76622298), UINT32_C(  76622298) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x3_t r = simde_vld3_dup_u32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[2], simde_vld1_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t buf[3];
+    uint64_t r[3][1];
+  } test_vec[] = {
+    { { UINT64_C(14628912614440873952), UINT64_C(16580172031507294487), UINT64_C( 8781865340087390217) },
+      { { UINT64_C(14628912614440873952) },
+        { UINT64_C(16580172031507294487) },
+        { UINT64_C( 8781865340087390217) } } },
+    { { UINT64_C(13210217568829216118), UINT64_C( 3907820354247489844), UINT64_C(17334126478161510385) },
+      { { UINT64_C(13210217568829216118) },
+        { UINT64_C( 3907820354247489844) },
+        { UINT64_C(17334126478161510385) } } },
+    { { UINT64_C(13064797981739989923), UINT64_C( 2865858655132559772), UINT64_C(13824068331443359236) },
+      { { UINT64_C(13064797981739989923) },
+        { UINT64_C( 2865858655132559772) },
+        { UINT64_C(13824068331443359236) } } },
+    { { UINT64_C( 9282790986884452422), UINT64_C( 7705589637838625330), UINT64_C( 1461321212612484933) },
+      { { UINT64_C( 9282790986884452422) },
+        { UINT64_C( 7705589637838625330) },
+        { UINT64_C( 1461321212612484933) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x3_t r = simde_vld3_dup_u64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[2], simde_vld1_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t buf[3];
+    simde_float32_t r[3][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   336.03), SIMDE_FLOAT32_C(  -159.86), SIMDE_FLOAT32_C(   114.05) },
+      { { SIMDE_FLOAT32_C(   336.03), SIMDE_FLOAT32_C(   336.03), SIMDE_FLOAT32_C(   336.03), SIMDE_FLOAT32_C(   336.03) },
+        { SIMDE_FLOAT32_C(  -159.86), SIMDE_FLOAT32_C(  -159.86), SIMDE_FLOAT32_C(  -159.86), SIMDE_FLOAT32_C(  -159.86) },
+        { SIMDE_FLOAT32_C(   114.05), SIMDE_FLOAT32_C(   114.05), SIMDE_FLOAT32_C(   114.05), SIMDE_FLOAT32_C(   114.05) } } },
+    { { SIMDE_FLOAT32_C(  -894.90), SIMDE_FLOAT32_C(  -608.07), SIMDE_FLOAT32_C(  -993.64) },
+      { { SIMDE_FLOAT32_C(  -894.90), SIMDE_FLOAT32_C(  -894.90), SIMDE_FLOAT32_C(  -894.90), SIMDE_FLOAT32_C(  -894.90) },
+        { SIMDE_FLOAT32_C(  -608.07), SIMDE_FLOAT32_C(  -608.07), SIMDE_FLOAT32_C(  -608.07), SIMDE_FLOAT32_C(  -608.07) },
+        { SIMDE_FLOAT32_C(  -993.64), SIMDE_FLOAT32_C(  -993.64), SIMDE_FLOAT32_C(  -993.64), SIMDE_FLOAT32_C(  -993.64) } } },
+    { { SIMDE_FLOAT32_C(  -803.89), SIMDE_FLOAT32_C(   558.26), SIMDE_FLOAT32_C(  -348.54) },
+      { { SIMDE_FLOAT32_C(  -803.89), SIMDE_FLOAT32_C(  -803.89), SIMDE_FLOAT32_C(  -803.89), SIMDE_FLOAT32_C(  -803.89) },
+        { SIMDE_FLOAT32_C(   558.26), SIMDE_FLOAT32_C(   558.26), SIMDE_FLOAT32_C(   558.26), SIMDE_FLOAT32_C(   558.26) },
+        { SIMDE_FLOAT32_C(  -348.54), SIMDE_FLOAT32_C(  -348.54), SIMDE_FLOAT32_C(  -348.54), SIMDE_FLOAT32_C(  -348.54) } } },
+    { { SIMDE_FLOAT32_C(  -295.03), SIMDE_FLOAT32_C(   662.27), SIMDE_FLOAT32_C(  -585.37) },
+      { { SIMDE_FLOAT32_C(  -295.03), SIMDE_FLOAT32_C(  -295.03), SIMDE_FLOAT32_C(  -295.03), SIMDE_FLOAT32_C(  -295.03) },
+        { SIMDE_FLOAT32_C(   662.27), SIMDE_FLOAT32_C(   662.27), SIMDE_FLOAT32_C(   662.27), SIMDE_FLOAT32_C(   662.27) },
+        { SIMDE_FLOAT32_C(  -585.37), SIMDE_FLOAT32_C(  -585.37), SIMDE_FLOAT32_C(  -585.37), SIMDE_FLOAT32_C(  -585.37) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x3_t r = simde_vld3q_dup_f32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[2], simde_vld1q_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t buf[3];
+    simde_float64_t r[3][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   944.66), SIMDE_FLOAT64_C(  -882.03), SIMDE_FLOAT64_C(  -930.72) },
+      { { SIMDE_FLOAT64_C(   944.66), SIMDE_FLOAT64_C(   944.66) },
+        { SIMDE_FLOAT64_C(  -882.03), SIMDE_FLOAT64_C(  -882.03) },
+        { SIMDE_FLOAT64_C(  -930.72), SIMDE_FLOAT64_C(  -930.72) } } },
+    { { SIMDE_FLOAT64_C(   411.38), SIMDE_FLOAT64_C(   -55.04), SIMDE_FLOAT64_C(    19.52) },
+      { { SIMDE_FLOAT64_C(   411.38), SIMDE_FLOAT64_C(   411.38) },
+        { SIMDE_FLOAT64_C(   -55.04), SIMDE_FLOAT64_C(   -55.04) },
+        { SIMDE_FLOAT64_C(    19.52), SIMDE_FLOAT64_C(    19.52) } } },
+    { { SIMDE_FLOAT64_C(  -368.66), SIMDE_FLOAT64_C(   889.13), SIMDE_FLOAT64_C(   129.36) },
+      { { SIMDE_FLOAT64_C(  -368.66), SIMDE_FLOAT64_C(  -368.66) },
+        { SIMDE_FLOAT64_C(   889.13), SIMDE_FLOAT64_C(   889.13) },
+        { SIMDE_FLOAT64_C(   129.36), SIMDE_FLOAT64_C(   129.36) } } },
+    { { SIMDE_FLOAT64_C(  -903.01), SIMDE_FLOAT64_C(   301.76), SIMDE_FLOAT64_C(   683.54) },
+      { { SIMDE_FLOAT64_C(  -903.01), SIMDE_FLOAT64_C(  -903.01) },
+        { SIMDE_FLOAT64_C(   301.76), SIMDE_FLOAT64_C(   301.76) },
+        { SIMDE_FLOAT64_C(   683.54), SIMDE_FLOAT64_C(   683.54) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x3_t r = simde_vld3q_dup_f64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[2], simde_vld1q_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t buf[3];
+    int8_t r[3][16];
+  } test_vec[] = {
+    { {  INT8_C( 36),  INT8_C( 97),  INT8_C( 36) },
+      { {  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),
+           INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36) },
+        {  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),
+           INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97),  INT8_C( 97) },
+        {  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),
+           INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36) } } },
+    { { -INT8_C(114),  INT8_C( 68),  INT8_C( 43) },
+      { { -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114),
+          -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114), -INT8_C(114) },
+        {  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),
+           INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68),  INT8_C( 68) },
+        {  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),
+           INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43),  INT8_C( 43) } } },
+    { { -INT8_C( 73),     INT8_MAX,  INT8_C( 90) },
+      { { -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73),
+          -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73), -INT8_C( 73) },
+        {     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,
+              INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX,     INT8_MAX },
+        {  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),
+           INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90),  INT8_C( 90) } } },
+    { { -INT8_C( 41),  INT8_C( 34),  INT8_C(109) },
+      { { -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41),
+          -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41), -INT8_C( 41) },
+        {  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),
+           INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34),  INT8_C( 34) },
+        {  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),
+           INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109),  INT8_C(109) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x3_t r = simde_vld3q_dup_s8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[2], simde_vld1q_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t buf[3];
+    int16_t r[3][8];
+  } test_vec[] = {
+    { { -INT16_C(  362),  INT16_C(27138),  INT16_C(  987) },
+      { { -INT16_C(  362), -INT16_C(  362), -INT16_C(  362), -INT16_C(  362), -INT16_C(  362), -INT16_C(  362), -INT16_C(  362), -INT16_C(  362) },
+        {  INT16_C(27138),  INT16_C(27138),  INT16_C(27138),  INT16_C(27138),  INT16_C(27138),  INT16_C(27138),  INT16_C(27138),  INT16_C(27138) },
+        {  INT16_C(  987),  INT16_C(  987),  INT16_C(  987),  INT16_C(  987),  INT16_C(  987),  INT16_C(  987),  INT16_C(  987),  INT16_C(  987) } } },
+    { {  INT16_C(28731), -INT16_C(16188), -INT16_C( 6679) },
+      { {  INT16_C(28731),  INT16_C(28731),  INT16_C(28731),  INT16_C(28731),  INT16_C(28731),  INT16_C(28731),  INT16_C(28731),  INT16_C(28731) },
+        { -INT16_C(16188), -INT16_C(16188), -INT16_C(16188), -INT16_C(16188), -INT16_C(16188), -INT16_C(16188), -INT16_C(16188), -INT16_C(16188) },
+        { -INT16_C( 6679), -INT16_C( 6679), -INT16_C( 6679), -INT16_C( 6679), -INT16_C( 6679), -INT16_C( 6679), -INT16_C( 6679), -INT16_C( 6679) } } },
+    { {  INT16_C( 9632),  INT16_C(29870), -INT16_C(16459) },
+      { {  INT16_C( 9632),  INT16_C( 9632),  INT16_C( 9632),  INT16_C( 9632),  INT16_C( 9632),  INT16_C( 9632),  INT16_C( 9632),  INT16_C( 9632) },
+        {  INT16_C(29870),  INT16_C(29870),  INT16_C(29870),  INT16_C(29870),  INT16_C(29870),  INT16_C(29870),  INT16_C(29870),  INT16_C(29870) },
+        { -INT16_C(16459), -INT16_C(16459), -INT16_C(16459), -INT16_C(16459), -INT16_C(16459), -INT16_C(16459), -INT16_C(16459), -INT16_C(16459) } } },
+    { { -INT16_C(28172),  INT16_C(30970),  INT16_C( 7937) },
+      { { -INT16_C(28172), -INT16_C(28172), -INT16_C(28172), -INT16_C(28172), -INT16_C(28172), -INT16_C(28172), -INT16_C(28172), -INT16_C(28172) },
+        {  INT16_C(30970),  INT16_C(30970),  INT16_C(30970),  INT16_C(30970),  INT16_C(30970),  INT16_C(30970),  INT16_C(30970),  INT16_C(30970) },
+        {  INT16_C( 7937),  INT16_C( 7937),  INT16_C( 7937),  INT16_C( 7937),  INT16_C( 7937),  INT16_C( 7937),  INT16_C( 7937),  INT16_C( 7937) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x3_t r = simde_vld3q_dup_s16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[2], simde_vld1q_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t buf[3];
+    int32_t r[3][4];
+  } test_vec[] = {
+    { {  INT32_C(2093624588), -INT32_C(1597402799),  INT32_C(  25070853) },
+      { {  INT32_C(2093624588),  INT32_C(2093624588),  INT32_C(2093624588),  INT32_C(2093624588) },
+        { -INT32_C(1597402799), -INT32_C(1597402799), -INT32_C(1597402799), -INT32_C(1597402799) },
+        {  INT32_C(  25070853),  INT32_C(  25070853),  INT32_C(  25070853),  INT32_C(  25070853) } } },
+    { {  INT32_C( 635986254), -INT32_C( 654770432),  INT32_C( 517152463) },
+      { {  INT32_C( 635986254),  INT32_C( 635986254),  INT32_C( 635986254),  INT32_C( 635986254) },
+        { -INT32_C( 654770432), -INT32_C( 654770432), -INT32_C( 654770432), -INT32_C( 654770432) },
+        {  INT32_C( 517152463),  INT32_C( 517152463),  INT32_C( 517152463),  INT32_C( 517152463) } } },
+    { {  INT32_C(1168029571), -INT32_C( 621726612), -INT32_C( 475625122) },
+      { {  INT32_C(1168029571),  INT32_C(1168029571),  INT32_C(1168029571),  INT32_C(1168029571) },
+        { -INT32_C( 621726612), -INT32_C( 621726612), -INT32_C( 621726612), -INT32_C( 621726612) },
+        { -INT32_C( 475625122), -INT32_C( 475625122), -INT32_C( 475625122), -INT32_C( 475625122) } } },
+    { { -INT32_C( 739775309),  INT32_C(1930260273),  INT32_C(2130677275) },
+      { { -INT32_C( 739775309), -INT32_C( 739775309), -INT32_C( 739775309), -INT32_C( 739775309) },
+        {  INT32_C(1930260273),  INT32_C(1930260273),  INT32_C(1930260273),  INT32_C(1930260273) },
+        {  INT32_C(2130677275),  INT32_C(2130677275),  INT32_C(2130677275),  INT32_C(2130677275) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x3_t r = simde_vld3q_dup_s32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[2], simde_vld1q_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t buf[3];
+    int64_t r[3][2];
+  } test_vec[] = {
+    { { -INT64_C(9025403800906804242), -INT64_C(2248088614564264244), -INT64_C(8120177741055495164) },
+      { { -INT64_C(9025403800906804242), -INT64_C(9025403800906804242) },
+        { -INT64_C(2248088614564264244), -INT64_C(2248088614564264244) },
+        { -INT64_C(8120177741055495164), -INT64_C(8120177741055495164) } } },
+    { { -INT64_C(3290996680859309839),  INT64_C(6670527710756484856), -INT64_C(7394573664732155321) },
+      { { -INT64_C(3290996680859309839), -INT64_C(3290996680859309839) },
+        {  INT64_C(6670527710756484856),  INT64_C(6670527710756484856) },
+        { -INT64_C(7394573664732155321), -INT64_C(7394573664732155321) } } },
+    { {  INT64_C(5303713815757222369), -INT64_C(2490146175354655517), -INT64_C(6496413757550884721) },
+      { {  INT64_C(5303713815757222369),  INT64_C(5303713815757222369) },
+        { -INT64_C(2490146175354655517), -INT64_C(2490146175354655517) },
+        { -INT64_C(6496413757550884721), -INT64_C(6496413757550884721) } } },
+    { { -INT64_C(3201883335703954404),  INT64_C(2381792943910827145), -INT64_C(3920012067750153529) },
+      { { -INT64_C(3201883335703954404), -INT64_C(3201883335703954404) },
+        {  INT64_C(2381792943910827145),  INT64_C(2381792943910827145) },
+        { -INT64_C(3920012067750153529), -INT64_C(3920012067750153529) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x3_t r = simde_vld3q_dup_s64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[2], simde_vld1q_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t buf[3];
+    uint8_t r[3][16];
+  } test_vec[] = {
+    { { UINT8_C( 52), UINT8_C( 33), UINT8_C(201) },
+      { { UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52),
+          UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52), UINT8_C( 52) },
+        { UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33),
+          UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33), UINT8_C( 33) },
+        { UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201),
+          UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201), UINT8_C(201) } } },
+    { { UINT8_C( 14), UINT8_C( 70), UINT8_C(101) },
+      { { UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14),
+          UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14), UINT8_C( 14) },
+        { UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70),
+          UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70), UINT8_C( 70) },
+        { UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101),
+          UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101), UINT8_C(101) } } },
+    { { UINT8_C(192), UINT8_C(234), UINT8_C(171) },
+      { { UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192),
+          UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192) },
+        { UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234),
+          UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234), UINT8_C(234) },
+        { UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171),
+          UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171) } } },
+    { { UINT8_C(160), UINT8_C(135), UINT8_C(243) },
+      { { UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160),
+          UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160), UINT8_C(160) },
+        { UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135),
+          UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135), UINT8_C(135) },
+        { UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243),
+          UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243), UINT8_C(243) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x3_t r = simde_vld3q_dup_u8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[2], simde_vld1q_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t buf[3];
+    uint16_t r[3][8];
+  } test_vec[] = {
+    { { UINT16_C(19651), UINT16_C( 4197), UINT16_C(19008) },
+      { { UINT16_C(19651), UINT16_C(19651), UINT16_C(19651), UINT16_C(19651), UINT16_C(19651), UINT16_C(19651), UINT16_C(19651), UINT16_C(19651) },
+        { UINT16_C( 4197), UINT16_C( 4197), UINT16_C( 4197), UINT16_C( 4197), UINT16_C( 4197), UINT16_C( 4197), UINT16_C( 4197), UINT16_C( 4197) },
+        { UINT16_C(19008), UINT16_C(19008), UINT16_C(19008), UINT16_C(19008), UINT16_C(19008), UINT16_C(19008), UINT16_C(19008), UINT16_C(19008) } } },
+    { { UINT16_C(11707), UINT16_C(14266), UINT16_C(28526) },
+      { { UINT16_C(11707), UINT16_C(11707), UINT16_C(11707), UINT16_C(11707), UINT16_C(11707), UINT16_C(11707), UINT16_C(11707), UINT16_C(11707) },
+        { UINT16_C(14266), UINT16_C(14266), UINT16_C(14266), UINT16_C(14266), UINT16_C(14266), UINT16_C(14266), UINT16_C(14266), UINT16_C(14266) },
+        { UINT16_C(28526), UINT16_C(28526), UINT16_C(28526), UINT16_C(28526), UINT16_C(28526), UINT16_C(28526), UINT16_C(28526), UINT16_C(28526) } } },
+    { { UINT16_C(49595), UINT16_C(29937), UINT16_C(33603) },
+      { { UINT16_C(49595), UINT16_C(49595), UINT16_C(49595), UINT16_C(49595), UINT16_C(49595), UINT16_C(49595), UINT16_C(49595), UINT16_C(49595) },
+        { UINT16_C(29937), UINT16_C(29937), UINT16_C(29937), UINT16_C(29937), UINT16_C(29937), UINT16_C(29937), UINT16_C(29937), UINT16_C(29937) },
+        { UINT16_C(33603), UINT16_C(33603), UINT16_C(33603), UINT16_C(33603), UINT16_C(33603), UINT16_C(33603), UINT16_C(33603), UINT16_C(33603) } } },
+    { { UINT16_C(18005), UINT16_C( 2435), UINT16_C(41475) },
+      { { UINT16_C(18005), UINT16_C(18005), UINT16_C(18005), UINT16_C(18005), UINT16_C(18005), UINT16_C(18005), UINT16_C(18005), UINT16_C(18005) },
+        { UINT16_C( 2435), UINT16_C( 2435), UINT16_C( 2435), UINT16_C( 2435), UINT16_C( 2435), UINT16_C( 2435), UINT16_C( 2435), UINT16_C( 2435) },
+        { UINT16_C(41475), UINT16_C(41475), UINT16_C(41475), UINT16_C(41475), UINT16_C(41475), UINT16_C(41475), UINT16_C(41475), UINT16_C(41475) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x3_t r = simde_vld3q_dup_u16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[2], simde_vld1q_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t buf[3];
+    uint32_t r[3][4];
+  } test_vec[] = {
+    { { UINT32_C(2059777012), UINT32_C(2768642341), UINT32_C( 404761957) },
+      { { UINT32_C(2059777012), UINT32_C(2059777012), UINT32_C(2059777012), UINT32_C(2059777012) },
+        { UINT32_C(2768642341), UINT32_C(2768642341), UINT32_C(2768642341), UINT32_C(2768642341) },
+        { UINT32_C( 404761957), UINT32_C( 404761957), UINT32_C( 404761957), UINT32_C( 404761957) } } },
+    { { UINT32_C( 130609868), UINT32_C(3921147431), UINT32_C( 314870532) },
+      { { UINT32_C( 130609868), UINT32_C( 130609868), UINT32_C( 130609868), UINT32_C( 130609868) },
+        { UINT32_C(3921147431), UINT32_C(3921147431), UINT32_C(3921147431), UINT32_C(3921147431) },
+        { UINT32_C( 314870532), UINT32_C( 314870532), UINT32_C( 314870532), UINT32_C( 314870532) } } },
+    { { UINT32_C(  19918179), UINT32_C(2921204030), UINT32_C(2286260984) },
+      { { UINT32_C(  19918179), UINT32_C(  19918179), UINT32_C(  19918179), UINT32_C(  19918179) },
+        { UINT32_C(2921204030), UINT32_C(2921204030), UINT32_C(2921204030), UINT32_C(2921204030) },
+        { UINT32_C(2286260984), UINT32_C(2286260984), UINT32_C(2286260984), UINT32_C(2286260984) } } },
+    { { UINT32_C(1803135316), UINT32_C(2029654678), UINT32_C(4280967224) },
+      { { UINT32_C(1803135316), UINT32_C(1803135316), UINT32_C(1803135316), UINT32_C(1803135316) },
+        { UINT32_C(2029654678), UINT32_C(2029654678), UINT32_C(2029654678), UINT32_C(2029654678) },
+        { UINT32_C(4280967224), UINT32_C(4280967224), UINT32_C(4280967224), UINT32_C(4280967224) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x3_t r = simde_vld3q_dup_u32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[2], simde_vld1q_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t buf[3];
+    uint64_t r[3][2];
+  } test_vec[] = {
+    { { UINT64_C(18214066502215465639), UINT64_C( 1065046456648668279), UINT64_C( 8490713049861910357) },
+      { { UINT64_C(18214066502215465639), UINT64_C(18214066502215465639) },
+        { UINT64_C( 1065046456648668279), UINT64_C( 1065046456648668279) },
+        { UINT64_C( 8490713049861910357), UINT64_C( 8490713049861910357) } } },
+    { { UINT64_C(13736264845668355753), UINT64_C(10331117451160185842), UINT64_C( 7218527247807037242) },
+      { { UINT64_C(13736264845668355753), UINT64_C(13736264845668355753) },
+        { UINT64_C(10331117451160185842), UINT64_C(10331117451160185842) },
+        { UINT64_C( 7218527247807037242), UINT64_C( 7218527247807037242) } } },
+    { { UINT64_C(15850509047510576376), UINT64_C( 8679803546227293557), UINT64_C( 1767413462609392049) },
+      { { UINT64_C(15850509047510576376), UINT64_C(15850509047510576376) },
+        { UINT64_C( 8679803546227293557), UINT64_C( 8679803546227293557) },
+        { UINT64_C( 1767413462609392049), UINT64_C( 1767413462609392049) } } },
+    { { UINT64_C( 4945746427943718487), UINT64_C( 4891215152122820509), UINT64_C( 8732840260868862270) },
+      { { UINT64_C( 4945746427943718487), UINT64_C( 4945746427943718487) },
+        { UINT64_C( 4891215152122820509), UINT64_C( 4891215152122820509) },
+        { UINT64_C( 8732840260868862270), UINT64_C( 8732840260868862270) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x3_t r = simde_vld3q_dup_u64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[2], simde_vld1q_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_dup_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_dup_u64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
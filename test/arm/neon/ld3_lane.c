@@ -0,0 +1,1196 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld3_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld3_lane.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vld3_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int8_t src[3][8];
+    int8_t buf[3];
+    int8_t r[3][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT8_C( 53), -INT8_C( 99),  INT8_C( 61), -INT8_C( 50), -INT8_C(105),  INT8_C( 42), -INT8_C( 39),  INT8_C(  2) },
+        {  INT8_C( 52),  INT8_C( 47), -INT8_C( 44),     INT8_MIN,  INT8_C( 61),  INT8_C( 35), -INT8_C(112), -INT8_C( 66) },
+        { -INT8_C( 56), -INT8_C(  5), -INT8_C(  3), -INT8_C(126), -INT8_C( 74), -INT8_C( 53),  INT8_C(120),  INT8_C( 21) } },
+      { -INT8_C( 35), -INT8_C( 71),  INT8_C( 99) },
+      { { -INT8_C( 35), -INT8_C( 99),  INT8_C( 61), -INT8_C( 50), -INT8_C(105),  INT8_C( 42), -INT8_C( 39),  INT8_C(  2) },
+        { -INT8_C( 71),  INT8_C( 47), -INT8_C( 44),     INT8_MIN,  INT8_C( 61),  INT8_C( 35), -INT8_C(112), -INT8_C( 66) },
+        {  INT8_C( 99), -INT8_C(  5), -INT8_C(  3), -INT8_C(126), -INT8_C( 74), -INT8_C( 53),  INT8_C(120),  INT8_C( 21) } } },
+    {  INT32_C( 5),
+      { {  INT8_C( 74), -INT8_C( 96),  INT8_C( 19), -INT8_C( 95), -INT8_C( 73), -INT8_C( 37), -INT8_C(117),  INT8_C( 36) },
+        {  INT8_C(112),  INT8_C( 29), -INT8_C( 93),  INT8_C( 69),  INT8_C(115),  INT8_C( 89),  INT8_C( 90),  INT8_C( 47) },
+        { -INT8_C( 47), -INT8_C( 56),  INT8_C( 98), -INT8_C(110), -INT8_C( 83), -INT8_C( 41), -INT8_C( 65),  INT8_C( 50) } },
+      {  INT8_C(112),  INT8_C( 67),  INT8_C( 59) },
+      { {  INT8_C( 74), -INT8_C( 96),  INT8_C( 19), -INT8_C( 95), -INT8_C( 73),  INT8_C(112), -INT8_C(117),  INT8_C( 36) },
+        {  INT8_C(112),  INT8_C( 29), -INT8_C( 93),  INT8_C( 69),  INT8_C(115),  INT8_C( 67),  INT8_C( 90),  INT8_C( 47) },
+        { -INT8_C( 47), -INT8_C( 56),  INT8_C( 98), -INT8_C(110), -INT8_C( 83),  INT8_C( 59), -INT8_C( 65),  INT8_C( 50) } } },
+    {  INT32_C( 2),
+      { { -INT8_C(105), -INT8_C(  2),  INT8_C(122), -INT8_C( 69),  INT8_C(  4), -INT8_C( 68), -INT8_C( 67),  INT8_C(  5) },
+        { -INT8_C(104), -INT8_C( 90), -INT8_C( 41), -INT8_C(106), -INT8_C( 70), -INT8_C( 15),  INT8_C(124), -INT8_C( 63) },
+        {  INT8_C( 10), -INT8_C( 31), -INT8_C(  8),  INT8_C(101), -INT8_C( 20), -INT8_C( 15),  INT8_C( 37), -INT8_C( 61) } },
+      { -INT8_C( 36), -INT8_C( 17), -INT8_C( 52) },
+      { { -INT8_C(105), -INT8_C(  2), -INT8_C( 36), -INT8_C( 69),  INT8_C(  4), -INT8_C( 68), -INT8_C( 67),  INT8_C(  5) },
+        { -INT8_C(104), -INT8_C( 90), -INT8_C( 17), -INT8_C(106), -INT8_C( 70), -INT8_C( 15),  INT8_C(124), -INT8_C( 63) },
+        {  INT8_C( 10), -INT8_C( 31), -INT8_C( 52),  INT8_C(101), -INT8_C( 20), -INT8_C( 15),  INT8_C( 37), -INT8_C( 61) } } },
+    {  INT32_C( 7),
+      { { -INT8_C(110),  INT8_C( 40), -INT8_C( 63), -INT8_C( 21),  INT8_C( 47), -INT8_C( 52), -INT8_C( 10),  INT8_C(115) },
+        {  INT8_C( 67),  INT8_C( 53),  INT8_C( 64),  INT8_C( 34), -INT8_C(127), -INT8_C(127), -INT8_C(  7), -INT8_C( 20) },
+        { -INT8_C( 84),  INT8_C( 95),  INT8_C( 64),  INT8_C( 75), -INT8_C( 70),  INT8_C(112), -INT8_C( 54),  INT8_C( 41) } },
+      {  INT8_C( 45),  INT8_C( 96),  INT8_C( 62) },
+      { { -INT8_C(110),  INT8_C( 40), -INT8_C( 63), -INT8_C( 21),  INT8_C( 47), -INT8_C( 52), -INT8_C( 10),  INT8_C( 45) },
+        {  INT8_C( 67),  INT8_C( 53),  INT8_C( 64),  INT8_C( 34), -INT8_C(127), -INT8_C(127), -INT8_C(  7),  INT8_C( 96) },
+        { -INT8_C( 84),  INT8_C( 95),  INT8_C( 64),  INT8_C( 75), -INT8_C( 70),  INT8_C(112), -INT8_C( 54),  INT8_C( 62) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x3_t src = { {
+      simde_vld1_s8(test_vec[i].src[0]),
+      simde_vld1_s8(test_vec[i].src[1]),
+      simde_vld1_s8(test_vec[i].src[2]) } };
+    simde_int8x8x3_t r;
+    SIMDE_CONSTIFY_8_(simde_vld3_lane_s8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[2], simde_vld1_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int16_t src[3][4];
+    int16_t buf[3];
+    int16_t r[3][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT16_C( 9768),  INT16_C(16854),  INT16_C(31978), -INT16_C(21574) },
+        { -INT16_C(23391),  INT16_C( 9446),  INT16_C(23638), -INT16_C(27324) },
+        {  INT16_C( 7146), -INT16_C(24509),  INT16_C( 3221), -INT16_C(15756) } },
+      { -INT16_C(13933),  INT16_C(15882), -INT16_C( 8175) },
+      { { -INT16_C(13933),  INT16_C(16854),  INT16_C(31978), -INT16_C(21574) },
+        {  INT16_C(15882),  INT16_C( 9446),  INT16_C(23638), -INT16_C(27324) },
+        { -INT16_C( 8175), -INT16_C(24509),  INT16_C( 3221), -INT16_C(15756) } } },
+    {  INT32_C( 1),
+      { {  INT16_C(24757), -INT16_C( 5890), -INT16_C(11820), -INT16_C( 7018) },
+        { -INT16_C(14254), -INT16_C(19031), -INT16_C(20597),  INT16_C(  763) },
+        {  INT16_C(12988), -INT16_C(25448), -INT16_C(23203), -INT16_C( 3300) } },
+      {  INT16_C(10699), -INT16_C(11398), -INT16_C(14588) },
+      { {  INT16_C(24757),  INT16_C(10699), -INT16_C(11820), -INT16_C( 7018) },
+        { -INT16_C(14254), -INT16_C(11398), -INT16_C(20597),  INT16_C(  763) },
+        {  INT16_C(12988), -INT16_C(14588), -INT16_C(23203), -INT16_C( 3300) } } },
+    {  INT32_C( 2),
+      { { -INT16_C(10058),  INT16_C(27780),  INT16_C(19441), -INT16_C(21965) },
+        {  INT16_C(16962), -INT16_C(21032), -INT16_C(12214), -INT16_C( 7605) },
+        { -INT16_C(24855), -INT16_C( 2328), -INT16_C(28895),  INT16_C(20772) } },
+      {  INT16_C(21219), -INT16_C(23468),  INT16_C( 5361) },
+      { { -INT16_C(10058),  INT16_C(27780),  INT16_C(21219), -INT16_C(21965) },
+        {  INT16_C(16962), -INT16_C(21032), -INT16_C(23468), -INT16_C( 7605) },
+        { -INT16_C(24855), -INT16_C( 2328),  INT16_C( 5361),  INT16_C(20772) } } },
+    {  INT32_C( 3),
+      { {  INT16_C(13929), -INT16_C(21321), -INT16_C(17202), -INT16_C(18218) },
+        { -INT16_C(14879),  INT16_C(14867),  INT16_C( 5380),  INT16_C(31003) },
+        {  INT16_C( 2486),  INT16_C(22327),  INT16_C(24558), -INT16_C( 1899) } },
+      { -INT16_C(23046),  INT16_C(17558), -INT16_C(16256) },
+      { {  INT16_C(13929), -INT16_C(21321), -INT16_C(17202), -INT16_C(23046) },
+        { -INT16_C(14879),  INT16_C(14867),  INT16_C( 5380),  INT16_C(17558) },
+        {  INT16_C( 2486),  INT16_C(22327),  INT16_C(24558), -INT16_C(16256) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x3_t src = { {
+      simde_vld1_s16(test_vec[i].src[0]),
+      simde_vld1_s16(test_vec[i].src[1]),
+      simde_vld1_s16(test_vec[i].src[2]) } };
+    simde_int16x4x3_t r;
+    SIMDE_CONSTIFY_4_(simde_vld3_lane_s16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[2], simde_vld1_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int32_t src[3][2];
+    int32_t buf[3];
+    int32_t r[3][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT32_C(1660928770), -INT32_C( 598243775) },
+        {  INT32_C(1146766983),  INT32_C(  96665978) },
+        { -INT32_C(1753010215), -INT32_C(1942620649) } },
+      {  INT32_C(1428841535),  INT32_C(  28168700), -INT32_C( 781377580) },
+      { {  INT32_C(1428841535), -INT32_C( 598243775) },
+        {  INT32_C(  28168700),  INT32_C(  96665978) },
+        { -INT32_C( 781377580), -INT32_C(1942620649) } } },
+    {  INT32_C( 1),
+      { { -INT32_C(1960249891), -INT32_C( 548521880) },
+        { -INT32_C( 894716340),  INT32_C( 865804008) },
+        {  INT32_C(1465162529),  INT32_C( 986833069) } },
+      { -INT32_C( 823399763),  INT32_C( 471467976), -INT32_C(2079094771) },
+      { { -INT32_C(1960249891), -INT32_C( 823399763) },
+        { -INT32_C( 894716340),  INT32_C( 471467976) },
+        {  INT32_C(1465162529), -INT32_C(2079094771) } } },
+    {  INT32_C( 0),
+      { {  INT32_C(1899901823),  INT32_C(1276205777) },
+        { -INT32_C( 500945508),  INT32_C(1801174791) },
+        { -INT32_C(2040137880), -INT32_C(1881308626) } },
+      {  INT32_C( 586480751),  INT32_C(1840750085),  INT32_C(1491502906) },
+      { {  INT32_C( 586480751),  INT32_C(1276205777) },
+        {  INT32_C(1840750085),  INT32_C(1801174791) },
+        {  INT32_C(1491502906), -INT32_C(1881308626) } } },
+    {  INT32_C( 1),
+      { { -INT32_C(  51382674), -INT32_C(1271989231) },
+        { -INT32_C( 888699296), -INT32_C(1636468649) },
+        {  INT32_C( 642248156),  INT32_C( 707847196) } },
+      { -INT32_C( 582524338),  INT32_C(1706257357),  INT32_C( 923901430) },
+      { { -INT32_C(  51382674), -INT32_C( 582524338) },
+        { -INT32_C( 888699296),  INT32_C(1706257357) },
+        {  INT32_C( 642248156),  INT32_C( 923901430) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x3_t src = { {
+      simde_vld1_s32(test_vec[i].src[0]),
+      simde_vld1_s32(test_vec[i].src[1]),
+      simde_vld1_s32(test_vec[i].src[2]) } };
+    simde_int32x2x3_t r;
+    SIMDE_CONSTIFY_2_(simde_vld3_lane_s32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[2], simde_vld1_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int64_t src[3][1];
+    int64_t buf[3];
+    int64_t r[3][1];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT64_C(5891793093389503146) },
+        {  INT64_C(  34991282433585834) },
+        { -INT64_C(6135510107323727876) } },
+      { -INT64_C(1718347022164840011),  INT64_C(  29598186320126626), -INT64_C(7530161367661408361) },
+      { { -INT64_C(1718347022164840011) },
+        {  INT64_C(  29598186320126626) },
+        { -INT64_C(7530161367661408361) } } },
+    {  INT32_C( 0),
+      { { -INT64_C(  88547816490355916) },
+        { -INT64_C(2729644387923663160) },
+        { -INT64_C(4812655482869339277) } },
+      { -INT64_C(8659145846267447573), -INT64_C(3652080330481594208), -INT64_C(8013763007845982289) },
+      { { -INT64_C(8659145846267447573) },
+        { -INT64_C(3652080330481594208) },
+        { -INT64_C(8013763007845982289) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x3_t src = { {
+      simde_vld1_s64(test_vec[i].src[0]),
+      simde_vld1_s64(test_vec[i].src[1]),
+      simde_vld1_s64(test_vec[i].src[2]) } };
+    simde_int64x1x3_t r;
+    r = simde_vld3_lane_s64(test_vec[i].buf, src, 0);
+
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[2], simde_vld1_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint8_t src[3][8];
+    uint8_t buf[3];
+    uint8_t r[3][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT8_C(191), UINT8_C(  2), UINT8_C(217), UINT8_C(241), UINT8_C( 47), UINT8_C(110), UINT8_C(100), UINT8_C(169) },
+        { UINT8_C(153), UINT8_C( 70), UINT8_C( 95), UINT8_C(125), UINT8_C(138), UINT8_C(217), UINT8_C( 66), UINT8_C( 34) },
+        { UINT8_C( 36), UINT8_C( 31), UINT8_C( 49), UINT8_C(103), UINT8_C(210), UINT8_C(237), UINT8_C(210), UINT8_C( 18) } },
+      { UINT8_C( 35), UINT8_C( 95), UINT8_C(197) },
+      { { UINT8_C( 35), UINT8_C(  2), UINT8_C(217), UINT8_C(241), UINT8_C( 47), UINT8_C(110), UINT8_C(100), UINT8_C(169) },
+        { UINT8_C( 95), UINT8_C( 70), UINT8_C( 95), UINT8_C(125), UINT8_C(138), UINT8_C(217), UINT8_C( 66), UINT8_C( 34) },
+        { UINT8_C(197), UINT8_C( 31), UINT8_C( 49), UINT8_C(103), UINT8_C(210), UINT8_C(237), UINT8_C(210), UINT8_C( 18) } } },
+    {  INT32_C( 5),
+      { { UINT8_C( 80), UINT8_C(248), UINT8_C(119), UINT8_C(183), UINT8_C(  0), UINT8_C( 25), UINT8_C(218), UINT8_C( 56) },
+        { UINT8_C(205), UINT8_C( 77), UINT8_C(214), UINT8_C(248), UINT8_C(241), UINT8_C(242), UINT8_C( 20), UINT8_C(221) },
+        { UINT8_C(211), UINT8_C( 63), UINT8_C(247), UINT8_C(146), UINT8_C(148), UINT8_C(227), UINT8_C(194), UINT8_C( 87) } },
+      { UINT8_C( 20), UINT8_C(168), UINT8_C(249) },
+      { { UINT8_C( 80), UINT8_C(248), UINT8_C(119), UINT8_C(183), UINT8_C(  0), UINT8_C( 20), UINT8_C(218), UINT8_C( 56) },
+        { UINT8_C(205), UINT8_C( 77), UINT8_C(214), UINT8_C(248), UINT8_C(241), UINT8_C(168), UINT8_C( 20), UINT8_C(221) },
+        { UINT8_C(211), UINT8_C( 63), UINT8_C(247), UINT8_C(146), UINT8_C(148), UINT8_C(249), UINT8_C(194), UINT8_C( 87) } } },
+    {  INT32_C( 2),
+      { { UINT8_C(  5), UINT8_C( 52), UINT8_C(215), UINT8_C( 97), UINT8_C(156), UINT8_C(208), UINT8_C( 95), UINT8_C( 33) },
+        { UINT8_C(164), UINT8_C(183), UINT8_C(137), UINT8_C(233), UINT8_C(104), UINT8_C( 28), UINT8_C(186), UINT8_C(119) },
+        { UINT8_C(162), UINT8_C(253), UINT8_C( 89), UINT8_C( 52), UINT8_C( 18), UINT8_C( 11), UINT8_C(152), UINT8_C( 45) } },
+      { UINT8_C(215), UINT8_C( 58), UINT8_C(162) },
+      { { UINT8_C(  5), UINT8_C( 52), UINT8_C(215), UINT8_C( 97), UINT8_C(156), UINT8_C(208), UINT8_C( 95), UINT8_C( 33) },
+        { UINT8_C(164), UINT8_C(183), UINT8_C( 58), UINT8_C(233), UINT8_C(104), UINT8_C( 28), UINT8_C(186), UINT8_C(119) },
+        { UINT8_C(162), UINT8_C(253), UINT8_C(162), UINT8_C( 52), UINT8_C( 18), UINT8_C( 11), UINT8_C(152), UINT8_C( 45) } } },
+    {  INT32_C( 7),
+      { { UINT8_C( 63), UINT8_C(168), UINT8_C(183), UINT8_C( 33), UINT8_C(108), UINT8_C(114), UINT8_C(246), UINT8_C(253) },
+        { UINT8_C(248), UINT8_C(224),    UINT8_MAX, UINT8_C( 58), UINT8_C(230), UINT8_C( 45), UINT8_C( 82), UINT8_C(197) },
+        { UINT8_C(232), UINT8_C(121), UINT8_C(134), UINT8_C( 79), UINT8_C(248), UINT8_C( 83), UINT8_C( 40), UINT8_C(201) } },
+      { UINT8_C( 36), UINT8_C(213), UINT8_C(160) },
+      { { UINT8_C( 63), UINT8_C(168), UINT8_C(183), UINT8_C( 33), UINT8_C(108), UINT8_C(114), UINT8_C(246), UINT8_C( 36) },
+        { UINT8_C(248), UINT8_C(224),    UINT8_MAX, UINT8_C( 58), UINT8_C(230), UINT8_C( 45), UINT8_C( 82), UINT8_C(213) },
+        { UINT8_C(232), UINT8_C(121), UINT8_C(134), UINT8_C( 79), UINT8_C(248), UINT8_C( 83), UINT8_C( 40), UINT8_C(160) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x3_t src = { {
+      simde_vld1_u8(test_vec[i].src[0]),
+      simde_vld1_u8(test_vec[i].src[1]),
+      simde_vld1_u8(test_vec[i].src[2]) } };
+    simde_uint8x8x3_t r;
+    SIMDE_CONSTIFY_8_(simde_vld3_lane_u8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[2], simde_vld1_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint16_t src[3][4];
+    uint16_t buf[3];
+    uint16_t r[3][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT16_C( 5128), UINT16_C(25753), UINT16_C(11032), UINT16_C(56361) },
+        { UINT16_C(49345), UINT16_C( 9725), UINT16_C(22156), UINT16_C(15735) },
+        { UINT16_C(35792), UINT16_C(36196), UINT16_C(10014), UINT16_C(43119) } },
+      { UINT16_C(51165), UINT16_C(22305), UINT16_C(20751) },
+      { { UINT16_C(51165), UINT16_C(25753), UINT16_C(11032), UINT16_C(56361) },
+        { UINT16_C(22305), UINT16_C( 9725), UINT16_C(22156), UINT16_C(15735) },
+        { UINT16_C(20751), UINT16_C(36196), UINT16_C(10014), UINT16_C(43119) } } },
+    {  INT32_C( 1),
+      { { UINT16_C(19698), UINT16_C( 3238), UINT16_C(53950), UINT16_C(65269) },
+        { UINT16_C(35978), UINT16_C(50444), UINT16_C(57876), UINT16_C( 4017) },
+        { UINT16_C(36340), UINT16_C(58356), UINT16_C(49100), UINT16_C(24635) } },
+      { UINT16_C(13885), UINT16_C(43119), UINT16_C(38755) },
+      { { UINT16_C(19698), UINT16_C(13885), UINT16_C(53950), UINT16_C(65269) },
+        { UINT16_C(35978), UINT16_C(43119), UINT16_C(57876), UINT16_C( 4017) },
+        { UINT16_C(36340), UINT16_C(38755), UINT16_C(49100), UINT16_C(24635) } } },
+    {  INT32_C( 2),
+      { { UINT16_C(21255), UINT16_C(21628), UINT16_C(34314), UINT16_C(33514) },
+        { UINT16_C( 3343), UINT16_C(15293), UINT16_C(56980), UINT16_C(57517) },
+        { UINT16_C( 8930), UINT16_C(50478), UINT16_C(60065), UINT16_C(39707) } },
+      { UINT16_C(19762), UINT16_C( 9507), UINT16_C(36856) },
+      { { UINT16_C(21255), UINT16_C(21628), UINT16_C(19762), UINT16_C(33514) },
+        { UINT16_C( 3343), UINT16_C(15293), UINT16_C( 9507), UINT16_C(57517) },
+        { UINT16_C( 8930), UINT16_C(50478), UINT16_C(36856), UINT16_C(39707) } } },
+    {  INT32_C( 3),
+      { { UINT16_C( 4902), UINT16_C(11430), UINT16_C(60040), UINT16_C(45011) },
+        { UINT16_C( 6238), UINT16_C(27633), UINT16_C( 9745), UINT16_C(46652) },
+        { UINT16_C(48362), UINT16_C(64528), UINT16_C(24447), UINT16_C(30541) } },
+      { UINT16_C( 1391), UINT16_C( 4159), UINT16_C( 6488) },
+      { { UINT16_C( 4902), UINT16_C(11430), UINT16_C(60040), UINT16_C( 1391) },
+        { UINT16_C( 6238), UINT16_C(27633), UINT16_C( 9745), UINT16_C( 4159) },
+        { UINT16_C(48362), UINT16_C(64528), UINT16_C(24447), UINT16_C( 6488) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x3_t src = { {
+      simde_vld1_u16(test_vec[i].src[0]),
+      simde_vld1_u16(test_vec[i].src[1]),
+      simde_vld1_u16(test_vec[i].src[2]) } };
+    simde_uint16x4x3_t r;
+    SIMDE_CONSTIFY_4_(simde_vld3_lane_u16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[2], simde_vld1_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint32_t src[3][2];
+    uint32_t buf[3];
+    uint32_t r[3][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT32_C(1592097397), UINT32_C(1139870594) },
+        { UINT32_C( 509752919), UINT32_C( 779620822) },
+        { UINT32_C( 794090508), UINT32_C(1144200600) } },
+      { UINT32_C(1031082949), UINT32_C(2894457854), UINT32_C(3071388597) },
+      { { UINT32_C(1031082949), UINT32_C(1139870594) },
+        { UINT32_C(2894457854), UINT32_C( 779620822) },
+        { UINT32_C(3071388597), UINT32_C(1144200600) } } },
+    {  INT32_C( 1),
+      { { UINT32_C(1787235178), UINT32_C(2869002432) },
+        { UINT32_C(2746721733), UINT32_C(2360597157) },
+        { UINT32_C(1319362246), UINT32_C( 142428936) } },
+      { UINT32_C(4166475949), UINT32_C(2967764143), UINT32_C( 374638655) },
+      { { UINT32_C(1787235178), UINT32_C(4166475949) },
+        { UINT32_C(2746721733), UINT32_C(2967764143) },
+        { UINT32_C(1319362246), UINT32_C( 374638655) } } },
+    {  INT32_C( 0),
+      { { UINT32_C( 322285475), UINT32_C(3877946154) },
+        { UINT32_C(1034132639), UINT32_C(2009938743) },
+        { UINT32_C( 341077565), UINT32_C(2651145340) } },
+      { UINT32_C(1342787029), UINT32_C(3850152557), UINT32_C(3916933060) },
+      { { UINT32_C(1342787029), UINT32_C(3877946154) },
+        { UINT32_C(3850152557), UINT32_C(2009938743) },
+        { UINT32_C(3916933060), UINT32_C(2651145340) } } },
+    {  INT32_C( 1),
+      { { UINT32_C(3040429206), UINT32_C(3614683038) },
+        { UINT32_C(3929502764), UINT32_C(2301591704) },
+        { UINT32_C(2285705655), UINT32_C(1147023438) } },
+      { UINT32_C(1059106576), UINT32_C( 457019372), UINT32_C(1902664482) },
+      { { UINT32_C(3040429206), UINT32_C(1059106576) },
+        { UINT32_C(3929502764), UINT32_C( 457019372) },
+        { UINT32_C(2285705655), UINT32_C(1902664482) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x3_t src = { {
+      simde_vld1_u32(test_vec[i].src[0]),
+      simde_vld1_u32(test_vec[i].src[1]),
+      simde_vld1_u32(test_vec[i].src[2]) } };
+    simde_uint32x2x3_t r;
+    SIMDE_CONSTIFY_2_(simde_vld3_lane_u32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[2], simde_vld1_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint64_t src[3][1];
+    uint64_t buf[3];
+    uint64_t r[3][1];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT64_C(18004455248249779850) },
+        { UINT64_C(17995587033000155616) },
+        { UINT64_C(17578472696165136717) } },
+      { UINT64_C(17830324866530527798), UINT64_C( 2152176943385741373), UINT64_C( 8935919502322104571) },
+      { { UINT64_C(17830324866530527798) },
+        { UINT64_C( 2152176943385741373) },
+        { UINT64_C( 8935919502322104571) } } },
+    {  INT32_C( 0),
+      { { UINT64_C( 2172072571933532169) },
+        { UINT64_C(13076398917176852317) },
+        { UINT64_C( 4156613725811045113) } },
+      { UINT64_C(  396508952116890427), UINT64_C( 1470876288185571504), UINT64_C( 4429493765923511519) },
+      { { UINT64_C(  396508952116890427) },
+        { UINT64_C( 1470876288185571504) },
+        { UINT64_C( 4429493765923511519) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x3_t src = { {
+      simde_vld1_u64(test_vec[i].src[0]),
+      simde_vld1_u64(test_vec[i].src[1]),
+      simde_vld1_u64(test_vec[i].src[2]) } };
+    simde_uint64x1x3_t r;
+    r = simde_vld3_lane_u64(test_vec[i].buf, src, 0);
+
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[2], simde_vld1_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float32_t src[3][2];
+    simde_float32_t buf[3];
+    simde_float32_t r[3][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT32_C(   -30.49), SIMDE_FLOAT32_C(  -389.24) },
+        { SIMDE_FLOAT32_C(  -365.37), SIMDE_FLOAT32_C(   509.27) },
+        { SIMDE_FLOAT32_C(  -269.61), SIMDE_FLOAT32_C(     9.35) } },
+      { SIMDE_FLOAT32_C(  -169.39), SIMDE_FLOAT32_C(   954.60), SIMDE_FLOAT32_C(   119.26) },
+      { { SIMDE_FLOAT32_C(  -169.39), SIMDE_FLOAT32_C(  -389.24) },
+        { SIMDE_FLOAT32_C(   954.60), SIMDE_FLOAT32_C(   509.27) },
+        { SIMDE_FLOAT32_C(   119.26), SIMDE_FLOAT32_C(     9.35) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT32_C(  -916.09), SIMDE_FLOAT32_C(  -114.96) },
+        { SIMDE_FLOAT32_C(  -373.51), SIMDE_FLOAT32_C(  -691.51) },
+        { SIMDE_FLOAT32_C(  -731.40), SIMDE_FLOAT32_C(   336.79) } },
+      { SIMDE_FLOAT32_C(   907.50), SIMDE_FLOAT32_C(   434.40), SIMDE_FLOAT32_C(   -31.22) },
+      { { SIMDE_FLOAT32_C(  -916.09), SIMDE_FLOAT32_C(   907.50) },
+        { SIMDE_FLOAT32_C(  -373.51), SIMDE_FLOAT32_C(   434.40) },
+        { SIMDE_FLOAT32_C(  -731.40), SIMDE_FLOAT32_C(   -31.22) } } },
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT32_C(  -169.35), SIMDE_FLOAT32_C(  -413.58) },
+        { SIMDE_FLOAT32_C(    79.85), SIMDE_FLOAT32_C(   552.21) },
+        { SIMDE_FLOAT32_C(  -142.55), SIMDE_FLOAT32_C(  -411.00) } },
+      { SIMDE_FLOAT32_C(   119.02), SIMDE_FLOAT32_C(  -374.27), SIMDE_FLOAT32_C(   346.55) },
+      { { SIMDE_FLOAT32_C(   119.02), SIMDE_FLOAT32_C(  -413.58) },
+        { SIMDE_FLOAT32_C(  -374.27), SIMDE_FLOAT32_C(   552.21) },
+        { SIMDE_FLOAT32_C(   346.55), SIMDE_FLOAT32_C(  -411.00) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT32_C(     0.38), SIMDE_FLOAT32_C(   269.61) },
+        { SIMDE_FLOAT32_C(   950.92), SIMDE_FLOAT32_C(  -916.23) },
+        { SIMDE_FLOAT32_C(   147.62), SIMDE_FLOAT32_C(   430.79) } },
+      { SIMDE_FLOAT32_C(  -410.82), SIMDE_FLOAT32_C(     3.37), SIMDE_FLOAT32_C(  -103.03) },
+      { { SIMDE_FLOAT32_C(     0.38), SIMDE_FLOAT32_C(  -410.82) },
+        { SIMDE_FLOAT32_C(   950.92), SIMDE_FLOAT32_C(     3.37) },
+        { SIMDE_FLOAT32_C(   147.62), SIMDE_FLOAT32_C(  -103.03) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x3_t src = { {
+      simde_vld1_f32(test_vec[i].src[0]),
+      simde_vld1_f32(test_vec[i].src[1]),
+      simde_vld1_f32(test_vec[i].src[2]) } };
+    simde_float32x2x3_t r;
+    SIMDE_CONSTIFY_2_(simde_vld3_lane_f32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[2], simde_vld1_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float64_t src[3][1];
+    simde_float64_t buf[3];
+    simde_float64_t r[3][1];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(  -261.05) },
+        { SIMDE_FLOAT64_C(    52.20) },
+        { SIMDE_FLOAT64_C(    84.41) } },
+      { SIMDE_FLOAT64_C(  -475.14), SIMDE_FLOAT64_C(  -573.81), SIMDE_FLOAT64_C(  -556.10) },
+      { { SIMDE_FLOAT64_C(  -475.14) },
+        { SIMDE_FLOAT64_C(  -573.81) },
+        { SIMDE_FLOAT64_C(  -556.10) } } },
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(   143.51) },
+        { SIMDE_FLOAT64_C(  -721.86) },
+        { SIMDE_FLOAT64_C(  -142.78) } },
+      { SIMDE_FLOAT64_C(   903.49), SIMDE_FLOAT64_C(  -799.02), SIMDE_FLOAT64_C(  -304.00) },
+      { { SIMDE_FLOAT64_C(   903.49) },
+        { SIMDE_FLOAT64_C(  -799.02) },
+        { SIMDE_FLOAT64_C(  -304.00) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x3_t src = { {
+      simde_vld1_f64(test_vec[i].src[0]),
+      simde_vld1_f64(test_vec[i].src[1]),
+      simde_vld1_f64(test_vec[i].src[2]) } };
+    simde_float64x1x3_t r;
+    r = simde_vld3_lane_f64(test_vec[i].buf, src, 0);
+
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[2], simde_vld1_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int8_t src[3][16];
+    int8_t buf[3];
+    int8_t r[3][16];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT8_C( 47), -INT8_C( 17),  INT8_C(103), -INT8_C( 16), -INT8_C( 32),  INT8_C( 61), -INT8_C( 92), -INT8_C( 44),
+          -INT8_C( 91),  INT8_C( 15), -INT8_C(109), -INT8_C( 50),  INT8_C(121),  INT8_C(  0),  INT8_C( 81), -INT8_C( 23) },
+        { -INT8_C( 75), -INT8_C( 53),  INT8_C( 61),  INT8_C( 65), -INT8_C(102), -INT8_C( 85), -INT8_C( 77), -INT8_C( 39),
+           INT8_C( 73),  INT8_C(121),  INT8_C( 45), -INT8_C( 19),  INT8_C( 56),  INT8_C( 34), -INT8_C( 30),  INT8_C( 93) },
+        {  INT8_C( 57),  INT8_C( 95), -INT8_C( 87),  INT8_C( 36),  INT8_C( 96), -INT8_C(110), -INT8_C( 34), -INT8_C( 60),
+          -INT8_C( 18),  INT8_C( 58),  INT8_C(112),  INT8_C( 43),  INT8_C( 10),  INT8_C( 54), -INT8_C( 98), -INT8_C( 73) } },
+      { -INT8_C(113),  INT8_C( 37),  INT8_C( 95) },
+      { { -INT8_C(113), -INT8_C( 17),  INT8_C(103), -INT8_C( 16), -INT8_C( 32),  INT8_C( 61), -INT8_C( 92), -INT8_C( 44),
+          -INT8_C( 91),  INT8_C( 15), -INT8_C(109), -INT8_C( 50),  INT8_C(121),  INT8_C(  0),  INT8_C( 81), -INT8_C( 23) },
+        {  INT8_C( 37), -INT8_C( 53),  INT8_C( 61),  INT8_C( 65), -INT8_C(102), -INT8_C( 85), -INT8_C( 77), -INT8_C( 39),
+           INT8_C( 73),  INT8_C(121),  INT8_C( 45), -INT8_C( 19),  INT8_C( 56),  INT8_C( 34), -INT8_C( 30),  INT8_C( 93) },
+        {  INT8_C( 95),  INT8_C( 95), -INT8_C( 87),  INT8_C( 36),  INT8_C( 96), -INT8_C(110), -INT8_C( 34), -INT8_C( 60),
+          -INT8_C( 18),  INT8_C( 58),  INT8_C(112),  INT8_C( 43),  INT8_C( 10),  INT8_C( 54), -INT8_C( 98), -INT8_C( 73) } } },
+    {  INT32_C( 5),
+      { {  INT8_C( 52), -INT8_C( 53), -INT8_C( 27), -INT8_C( 62),  INT8_C(111), -INT8_C( 62), -INT8_C( 50), -INT8_C( 92),
+          -INT8_C( 41), -INT8_C( 70),  INT8_C( 87),  INT8_C( 47), -INT8_C(119), -INT8_C( 38), -INT8_C( 73),  INT8_C( 84) },
+        { -INT8_C( 55),  INT8_C(121), -INT8_C( 21), -INT8_C(124),  INT8_C(111), -INT8_C( 90), -INT8_C( 69),  INT8_C( 38),
+          -INT8_C(  2), -INT8_C(124), -INT8_C( 39), -INT8_C(111), -INT8_C( 94), -INT8_C( 10), -INT8_C( 71), -INT8_C( 75) },
+        {  INT8_C( 10), -INT8_C(  4), -INT8_C(  6), -INT8_C(118), -INT8_C(104), -INT8_C(112), -INT8_C( 99), -INT8_C( 78),
+          -INT8_C( 81), -INT8_C(120),  INT8_C( 74),  INT8_C( 12), -INT8_C( 68), -INT8_C( 25), -INT8_C( 74), -INT8_C( 63) } },
+      { -INT8_C( 41),  INT8_C( 72), -INT8_C( 22) },
+      { {  INT8_C( 52), -INT8_C( 53), -INT8_C( 27), -INT8_C( 62),  INT8_C(111), -INT8_C( 41), -INT8_C( 50), -INT8_C( 92),
+          -INT8_C( 41), -INT8_C( 70),  INT8_C( 87),  INT8_C( 47), -INT8_C(119), -INT8_C( 38), -INT8_C( 73),  INT8_C( 84) },
+        { -INT8_C( 55),  INT8_C(121), -INT8_C( 21), -INT8_C(124),  INT8_C(111),  INT8_C( 72), -INT8_C( 69),  INT8_C( 38),
+          -INT8_C(  2), -INT8_C(124), -INT8_C( 39), -INT8_C(111), -INT8_C( 94), -INT8_C( 10), -INT8_C( 71), -INT8_C( 75) },
+        {  INT8_C( 10), -INT8_C(  4), -INT8_C(  6), -INT8_C(118), -INT8_C(104), -INT8_C( 22), -INT8_C( 99), -INT8_C( 78),
+          -INT8_C( 81), -INT8_C(120),  INT8_C( 74),  INT8_C( 12), -INT8_C( 68), -INT8_C( 25), -INT8_C( 74), -INT8_C( 63) } } },
+    {  INT32_C(10),
+      { {  INT8_C(113), -INT8_C( 30), -INT8_C(127), -INT8_C( 15),  INT8_C( 17),  INT8_C( 18), -INT8_C( 52),  INT8_C( 66),
+          -INT8_C( 24),  INT8_C(111), -INT8_C( 36), -INT8_C(  2), -INT8_C( 89), -INT8_C( 47), -INT8_C( 14), -INT8_C( 86) },
+        {  INT8_C( 98), -INT8_C( 42),  INT8_C( 85), -INT8_C( 89), -INT8_C( 73), -INT8_C( 36),  INT8_C( 88),  INT8_C( 80),
+          -INT8_C(118), -INT8_C( 18),  INT8_C( 23), -INT8_C( 40),  INT8_C(106),  INT8_C(118),  INT8_C(102),  INT8_C( 24) },
+        {  INT8_C( 38),  INT8_C(122), -INT8_C(124),  INT8_C( 73),  INT8_C(113), -INT8_C( 48),  INT8_C( 38),  INT8_C( 93),
+           INT8_C( 36), -INT8_C( 91),  INT8_C( 77),  INT8_C(  9),  INT8_C( 62),  INT8_C( 79),  INT8_C( 56), -INT8_C( 87) } },
+      { -INT8_C( 38), -INT8_C( 14),  INT8_C( 64) },
+      { {  INT8_C(113), -INT8_C( 30), -INT8_C(127), -INT8_C( 15),  INT8_C( 17),  INT8_C( 18), -INT8_C( 52),  INT8_C( 66),
+          -INT8_C( 24),  INT8_C(111), -INT8_C( 38), -INT8_C(  2), -INT8_C( 89), -INT8_C( 47), -INT8_C( 14), -INT8_C( 86) },
+        {  INT8_C( 98), -INT8_C( 42),  INT8_C( 85), -INT8_C( 89), -INT8_C( 73), -INT8_C( 36),  INT8_C( 88),  INT8_C( 80),
+          -INT8_C(118), -INT8_C( 18), -INT8_C( 14), -INT8_C( 40),  INT8_C(106),  INT8_C(118),  INT8_C(102),  INT8_C( 24) },
+        {  INT8_C( 38),  INT8_C(122), -INT8_C(124),  INT8_C( 73),  INT8_C(113), -INT8_C( 48),  INT8_C( 38),  INT8_C( 93),
+           INT8_C( 36), -INT8_C( 91),  INT8_C( 64),  INT8_C(  9),  INT8_C( 62),  INT8_C( 79),  INT8_C( 56), -INT8_C( 87) } } },
+    {  INT32_C(15),
+      { { -INT8_C( 68),  INT8_C( 95),  INT8_C( 11), -INT8_C( 98),  INT8_C( 46),  INT8_C( 33),  INT8_C(  1),  INT8_C( 36),
+           INT8_C( 42),  INT8_C(108), -INT8_C( 20),  INT8_C( 40),  INT8_C(101),  INT8_C( 97), -INT8_C(112), -INT8_C( 83) },
+        {  INT8_C(107),  INT8_C( 49), -INT8_C( 33), -INT8_C( 18), -INT8_C( 97),  INT8_C(  7),  INT8_C( 45), -INT8_C( 51),
+           INT8_C(122), -INT8_C( 33), -INT8_C(103),  INT8_C(125),  INT8_C( 14), -INT8_C( 41),  INT8_C( 87), -INT8_C( 66) },
+        {  INT8_C( 17),  INT8_C(125),  INT8_C( 20), -INT8_C( 78),  INT8_C( 43), -INT8_C( 76), -INT8_C( 48),  INT8_C(119),
+          -INT8_C(115), -INT8_C( 56), -INT8_C(124),  INT8_C( 22),     INT8_MIN,  INT8_C( 13), -INT8_C( 46), -INT8_C( 15) } },
+      { -INT8_C( 27),  INT8_C( 39),  INT8_C( 80) },
+      { { -INT8_C( 68),  INT8_C( 95),  INT8_C( 11), -INT8_C( 98),  INT8_C( 46),  INT8_C( 33),  INT8_C(  1),  INT8_C( 36),
+           INT8_C( 42),  INT8_C(108), -INT8_C( 20),  INT8_C( 40),  INT8_C(101),  INT8_C( 97), -INT8_C(112), -INT8_C( 27) },
+        {  INT8_C(107),  INT8_C( 49), -INT8_C( 33), -INT8_C( 18), -INT8_C( 97),  INT8_C(  7),  INT8_C( 45), -INT8_C( 51),
+           INT8_C(122), -INT8_C( 33), -INT8_C(103),  INT8_C(125),  INT8_C( 14), -INT8_C( 41),  INT8_C( 87),  INT8_C( 39) },
+        {  INT8_C( 17),  INT8_C(125),  INT8_C( 20), -INT8_C( 78),  INT8_C( 43), -INT8_C( 76), -INT8_C( 48),  INT8_C(119),
+          -INT8_C(115), -INT8_C( 56), -INT8_C(124),  INT8_C( 22),     INT8_MIN,  INT8_C( 13), -INT8_C( 46),  INT8_C( 80) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x3_t src = { {
+      simde_vld1q_s8(test_vec[i].src[0]),
+      simde_vld1q_s8(test_vec[i].src[1]),
+      simde_vld1q_s8(test_vec[i].src[2]) } };
+    simde_int8x16x3_t r;
+    SIMDE_CONSTIFY_16_(simde_vld3q_lane_s8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[2], simde_vld1q_s8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int16_t src[3][8];
+    int16_t buf[3];
+    int16_t r[3][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT16_C(26753),  INT16_C(23905),  INT16_C(11861),  INT16_C(18594), -INT16_C(23873),  INT16_C(23080),  INT16_C( 6340), -INT16_C(12654) },
+        {  INT16_C( 7314), -INT16_C(14764), -INT16_C(31706), -INT16_C(19315),  INT16_C( 8077), -INT16_C(10402), -INT16_C( 5273), -INT16_C( 3447) },
+        { -INT16_C(20675), -INT16_C( 9973),  INT16_C(24360),  INT16_C(27822), -INT16_C(21993),  INT16_C( 5620), -INT16_C(20526), -INT16_C(16062) } },
+      {  INT16_C(22473),  INT16_C( 9626),  INT16_C(13881) },
+      { {  INT16_C(22473),  INT16_C(23905),  INT16_C(11861),  INT16_C(18594), -INT16_C(23873),  INT16_C(23080),  INT16_C( 6340), -INT16_C(12654) },
+        {  INT16_C( 9626), -INT16_C(14764), -INT16_C(31706), -INT16_C(19315),  INT16_C( 8077), -INT16_C(10402), -INT16_C( 5273), -INT16_C( 3447) },
+        {  INT16_C(13881), -INT16_C( 9973),  INT16_C(24360),  INT16_C(27822), -INT16_C(21993),  INT16_C( 5620), -INT16_C(20526), -INT16_C(16062) } } },
+    {  INT32_C( 5),
+      { {  INT16_C(28686), -INT16_C(13309), -INT16_C(10384), -INT16_C(16897),  INT16_C(13503), -INT16_C( 8139), -INT16_C(13027),  INT16_C( 5267) },
+        {  INT16_C(  386), -INT16_C(21087), -INT16_C(27379),  INT16_C(16064), -INT16_C(10065),  INT16_C(13558),  INT16_C( 8646), -INT16_C(26525) },
+        {  INT16_C(28887), -INT16_C(13756), -INT16_C( 9941), -INT16_C(15728),  INT16_C(26431), -INT16_C( 9327), -INT16_C( 6543),  INT16_C(18689) } },
+      {  INT16_C(24893), -INT16_C(22558), -INT16_C(11547) },
+      { {  INT16_C(28686), -INT16_C(13309), -INT16_C(10384), -INT16_C(16897),  INT16_C(13503),  INT16_C(24893), -INT16_C(13027),  INT16_C( 5267) },
+        {  INT16_C(  386), -INT16_C(21087), -INT16_C(27379),  INT16_C(16064), -INT16_C(10065), -INT16_C(22558),  INT16_C( 8646), -INT16_C(26525) },
+        {  INT16_C(28887), -INT16_C(13756), -INT16_C( 9941), -INT16_C(15728),  INT16_C(26431), -INT16_C(11547), -INT16_C( 6543),  INT16_C(18689) } } },
+    {  INT32_C( 2),
+      { {  INT16_C(21233),  INT16_C(19053),  INT16_C(18496), -INT16_C(  407),  INT16_C(26208), -INT16_C(22296), -INT16_C(23872),  INT16_C( 1396) },
+        { -INT16_C(20198),  INT16_C( 3114),  INT16_C(11809), -INT16_C( 1043), -INT16_C(17682),  INT16_C(25362), -INT16_C( 2545), -INT16_C( 7450) },
+        {  INT16_C(27602),  INT16_C(14866), -INT16_C(  751), -INT16_C(26132), -INT16_C(21708), -INT16_C( 7950), -INT16_C(17151), -INT16_C(23015) } },
+      {  INT16_C(10907), -INT16_C(30052), -INT16_C(13041) },
+      { {  INT16_C(21233),  INT16_C(19053),  INT16_C(10907), -INT16_C(  407),  INT16_C(26208), -INT16_C(22296), -INT16_C(23872),  INT16_C( 1396) },
+        { -INT16_C(20198),  INT16_C( 3114), -INT16_C(30052), -INT16_C( 1043), -INT16_C(17682),  INT16_C(25362), -INT16_C( 2545), -INT16_C( 7450) },
+        {  INT16_C(27602),  INT16_C(14866), -INT16_C(13041), -INT16_C(26132), -INT16_C(21708), -INT16_C( 7950), -INT16_C(17151), -INT16_C(23015) } } },
+    {  INT32_C( 7),
+      { { -INT16_C(28823), -INT16_C(21333), -INT16_C(14695),  INT16_C(30810), -INT16_C(22898), -INT16_C(28938),  INT16_C(26613), -INT16_C( 9359) },
+        { -INT16_C(12543),  INT16_C(31620),  INT16_C(28902), -INT16_C(18243), -INT16_C(13200),  INT16_C(21594),  INT16_C(29711),  INT16_C( 4814) },
+        { -INT16_C(27696),  INT16_C(27438), -INT16_C(28953), -INT16_C(  903), -INT16_C(10797),  INT16_C( 3839), -INT16_C(30863),  INT16_C( 6919) } },
+      { -INT16_C(32374),  INT16_C(30892),  INT16_C( 1334) },
+      { { -INT16_C(28823), -INT16_C(21333), -INT16_C(14695),  INT16_C(30810), -INT16_C(22898), -INT16_C(28938),  INT16_C(26613), -INT16_C(32374) },
+        { -INT16_C(12543),  INT16_C(31620),  INT16_C(28902), -INT16_C(18243), -INT16_C(13200),  INT16_C(21594),  INT16_C(29711),  INT16_C(30892) },
+        { -INT16_C(27696),  INT16_C(27438), -INT16_C(28953), -INT16_C(  903), -INT16_C(10797),  INT16_C( 3839), -INT16_C(30863),  INT16_C( 1334) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x3_t src = { {
+      simde_vld1q_s16(test_vec[i].src[0]),
+      simde_vld1q_s16(test_vec[i].src[1]),
+      simde_vld1q_s16(test_vec[i].src[2]) } };
+    simde_int16x8x3_t r;
+    SIMDE_CONSTIFY_8_(simde_vld3q_lane_s16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[2], simde_vld1q_s16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int32_t src[3][4];
+    int32_t buf[3];
+    int32_t r[3][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { {  INT32_C( 288421689), -INT32_C( 939764255), -INT32_C(1264049692),  INT32_C( 998479736) },
+        { -INT32_C(1339406155),  INT32_C( 408438613), -INT32_C(1706285258),  INT32_C(1639616441) },
+        {  INT32_C(1632916024),  INT32_C(1221231420), -INT32_C( 921053599),  INT32_C(1158042308) } },
+      { -INT32_C( 911602031), -INT32_C( 124658087), -INT32_C( 920441598) },
+      { { -INT32_C( 911602031), -INT32_C( 939764255), -INT32_C(1264049692),  INT32_C( 998479736) },
+        { -INT32_C( 124658087),  INT32_C( 408438613), -INT32_C(1706285258),  INT32_C(1639616441) },
+        { -INT32_C( 920441598),  INT32_C(1221231420), -INT32_C( 921053599),  INT32_C(1158042308) } } },
+    {  INT32_C( 1),
+      { { -INT32_C(1553069249),  INT32_C(1502992732),  INT32_C(  53678807),  INT32_C(1891250335) },
+        { -INT32_C(1501157548), -INT32_C( 201225393),  INT32_C(1261423823), -INT32_C( 414549097) },
+        {  INT32_C( 797560182),  INT32_C(1233318853),  INT32_C(1019200293), -INT32_C(1292244409) } },
+      { -INT32_C( 949585468), -INT32_C(1327240728),  INT32_C(1888084926) },
+      { { -INT32_C(1553069249), -INT32_C( 949585468),  INT32_C(  53678807),  INT32_C(1891250335) },
+        { -INT32_C(1501157548), -INT32_C(1327240728),  INT32_C(1261423823), -INT32_C( 414549097) },
+        {  INT32_C( 797560182),  INT32_C(1888084926),  INT32_C(1019200293), -INT32_C(1292244409) } } },
+    {  INT32_C( 2),
+      { { -INT32_C( 330260544), -INT32_C( 342859722), -INT32_C( 410641002), -INT32_C( 370687513) },
+        { -INT32_C(2002963350), -INT32_C(1777659608), -INT32_C( 539357815),  INT32_C( 559977746) },
+        { -INT32_C( 962337613),  INT32_C(1949438233),  INT32_C( 682665761),  INT32_C(1223347173) } },
+      {  INT32_C( 469632647), -INT32_C( 745138715), -INT32_C(1939863111) },
+      { { -INT32_C( 330260544), -INT32_C( 342859722),  INT32_C( 469632647), -INT32_C( 370687513) },
+        { -INT32_C(2002963350), -INT32_C(1777659608), -INT32_C( 745138715),  INT32_C( 559977746) },
+        { -INT32_C( 962337613),  INT32_C(1949438233), -INT32_C(1939863111),  INT32_C(1223347173) } } },
+    {  INT32_C( 3),
+      { { -INT32_C(  17771269),  INT32_C(1530554477),  INT32_C( 614607245),  INT32_C(2032514144) },
+        {  INT32_C(1985539478), -INT32_C( 789678327),  INT32_C( 965683361),  INT32_C(1591853857) },
+        { -INT32_C(1578792994), -INT32_C(  32402703), -INT32_C( 425867226),  INT32_C(1152446371) } },
+      { -INT32_C( 236777338), -INT32_C(1640074913),  INT32_C( 824261556) },
+      { { -INT32_C(  17771269),  INT32_C(1530554477),  INT32_C( 614607245), -INT32_C( 236777338) },
+        {  INT32_C(1985539478), -INT32_C( 789678327),  INT32_C( 965683361), -INT32_C(1640074913) },
+        { -INT32_C(1578792994), -INT32_C(  32402703), -INT32_C( 425867226),  INT32_C( 824261556) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x3_t src = { {
+      simde_vld1q_s32(test_vec[i].src[0]),
+      simde_vld1q_s32(test_vec[i].src[1]),
+      simde_vld1q_s32(test_vec[i].src[2]) } };
+    simde_int32x4x3_t r;
+    SIMDE_CONSTIFY_4_(simde_vld3q_lane_s32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[2], simde_vld1q_s32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    int64_t src[3][2];
+    int64_t buf[3];
+    int64_t r[3][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { -INT64_C(5981111771837349281),  INT64_C(8622813218222221766) },
+        {  INT64_C(7794692150271999182), -INT64_C(6545180753874889517) },
+        {  INT64_C(4988282249277923955), -INT64_C(8178564655675483219) } },
+      {  INT64_C(2815312799241289921),  INT64_C(3749411409298370693),  INT64_C(2441454330546611433) },
+      { {  INT64_C(2815312799241289921),  INT64_C(8622813218222221766) },
+        {  INT64_C(3749411409298370693), -INT64_C(6545180753874889517) },
+        {  INT64_C(2441454330546611433), -INT64_C(8178564655675483219) } } },
+    {  INT32_C( 1),
+      { { -INT64_C(7784941662398760070), -INT64_C(4539474808167581341) },
+        { -INT64_C(6202081572251567824), -INT64_C( 438744451367148901) },
+        { -INT64_C( 900717868407425110), -INT64_C(3856270463381157812) } },
+      {  INT64_C(8223819744790720325), -INT64_C(2863402624095249092), -INT64_C(7922665400764421573) },
+      { { -INT64_C(7784941662398760070),  INT64_C(8223819744790720325) },
+        { -INT64_C(6202081572251567824), -INT64_C(2863402624095249092) },
+        { -INT64_C( 900717868407425110), -INT64_C(7922665400764421573) } } },
+    {  INT32_C( 0),
+      { { -INT64_C(4507753659878163131),  INT64_C(3441534567436391712) },
+        { -INT64_C(7399441947553794954), -INT64_C(6415632971424629374) },
+        {  INT64_C(1119990135109727892), -INT64_C(2513123827622857907) } },
+      { -INT64_C(1199246310241377883), -INT64_C(5832966866990497936),  INT64_C(8522400712602806418) },
+      { { -INT64_C(1199246310241377883),  INT64_C(3441534567436391712) },
+        { -INT64_C(5832966866990497936), -INT64_C(6415632971424629374) },
+        {  INT64_C(8522400712602806418), -INT64_C(2513123827622857907) } } },
+    {  INT32_C( 1),
+      { {  INT64_C(6869228735698115979),  INT64_C( 847492550756221993) },
+        {  INT64_C(5167752620077746276),  INT64_C(6831071980497845008) },
+        {  INT64_C( 958057369687088440), -INT64_C(3578028906390140211) } },
+      {  INT64_C(2177685360864868631),  INT64_C(7739161580155119982), -INT64_C(2027122757907661823) },
+      { {  INT64_C(6869228735698115979),  INT64_C(2177685360864868631) },
+        {  INT64_C(5167752620077746276),  INT64_C(7739161580155119982) },
+        {  INT64_C( 958057369687088440), -INT64_C(2027122757907661823) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x3_t src = { {
+      simde_vld1q_s64(test_vec[i].src[0]),
+      simde_vld1q_s64(test_vec[i].src[1]),
+      simde_vld1q_s64(test_vec[i].src[2]) } };
+    simde_int64x2x3_t r;
+    SIMDE_CONSTIFY_2_(simde_vld3q_lane_s64, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[2], simde_vld1q_s64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint8_t src[3][16];
+    uint8_t buf[3];
+    uint8_t r[3][16];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT8_C(183), UINT8_C( 85), UINT8_C(167), UINT8_C(196), UINT8_C(218), UINT8_C(116), UINT8_C(246), UINT8_C(100),
+          UINT8_C(203), UINT8_C( 58), UINT8_C( 85), UINT8_C(135), UINT8_C(227), UINT8_C(129), UINT8_C(140), UINT8_C( 78) },
+        { UINT8_C(173), UINT8_C(145), UINT8_C(162), UINT8_C(123), UINT8_C( 41), UINT8_C(190), UINT8_C(155), UINT8_C(129),
+          UINT8_C(213), UINT8_C(162), UINT8_C(162), UINT8_C(214), UINT8_C(208), UINT8_C(229), UINT8_C(196), UINT8_C(232) },
+        { UINT8_C(143), UINT8_C(188), UINT8_C( 99), UINT8_C( 70), UINT8_C(127), UINT8_C(246), UINT8_C(217), UINT8_C( 17),
+          UINT8_C( 46), UINT8_C( 85), UINT8_C(195), UINT8_C(223), UINT8_C(123), UINT8_C( 23), UINT8_C( 60), UINT8_C(131) } },
+      { UINT8_C(205), UINT8_C(226), UINT8_C(243) },
+      { { UINT8_C(205), UINT8_C( 85), UINT8_C(167), UINT8_C(196), UINT8_C(218), UINT8_C(116), UINT8_C(246), UINT8_C(100),
+          UINT8_C(203), UINT8_C( 58), UINT8_C( 85), UINT8_C(135), UINT8_C(227), UINT8_C(129), UINT8_C(140), UINT8_C( 78) },
+        { UINT8_C(226), UINT8_C(145), UINT8_C(162), UINT8_C(123), UINT8_C( 41), UINT8_C(190), UINT8_C(155), UINT8_C(129),
+          UINT8_C(213), UINT8_C(162), UINT8_C(162), UINT8_C(214), UINT8_C(208), UINT8_C(229), UINT8_C(196), UINT8_C(232) },
+        { UINT8_C(243), UINT8_C(188), UINT8_C( 99), UINT8_C( 70), UINT8_C(127), UINT8_C(246), UINT8_C(217), UINT8_C( 17),
+          UINT8_C( 46), UINT8_C( 85), UINT8_C(195), UINT8_C(223), UINT8_C(123), UINT8_C( 23), UINT8_C( 60), UINT8_C(131) } } },
+    {  INT32_C( 5),
+      { { UINT8_C(105), UINT8_C(243), UINT8_C(  5), UINT8_C(141), UINT8_C( 46), UINT8_C( 28), UINT8_C(231), UINT8_C(  7),
+          UINT8_C( 10), UINT8_C(152), UINT8_C(175), UINT8_C(223), UINT8_C(107), UINT8_C(144), UINT8_C( 96), UINT8_C( 85) },
+        { UINT8_C(144), UINT8_C(109), UINT8_C(252), UINT8_C(152), UINT8_C(225), UINT8_C(173), UINT8_C(123), UINT8_C(103),
+          UINT8_C(147), UINT8_C(209), UINT8_C(108), UINT8_C(124), UINT8_C(130), UINT8_C(100), UINT8_C(153), UINT8_C( 81) },
+        { UINT8_C( 69), UINT8_C(178), UINT8_C(199), UINT8_C(161), UINT8_C(252), UINT8_C( 79), UINT8_C( 37), UINT8_C(160),
+          UINT8_C(142), UINT8_C(224), UINT8_C( 12), UINT8_C(115), UINT8_C(168), UINT8_C(175), UINT8_C(162), UINT8_C(221) } },
+      { UINT8_C(191), UINT8_C(117), UINT8_C( 19) },
+      { { UINT8_C(105), UINT8_C(243), UINT8_C(  5), UINT8_C(141), UINT8_C( 46), UINT8_C(191), UINT8_C(231), UINT8_C(  7),
+          UINT8_C( 10), UINT8_C(152), UINT8_C(175), UINT8_C(223), UINT8_C(107), UINT8_C(144), UINT8_C( 96), UINT8_C( 85) },
+        { UINT8_C(144), UINT8_C(109), UINT8_C(252), UINT8_C(152), UINT8_C(225), UINT8_C(117), UINT8_C(123), UINT8_C(103),
+          UINT8_C(147), UINT8_C(209), UINT8_C(108), UINT8_C(124), UINT8_C(130), UINT8_C(100), UINT8_C(153), UINT8_C( 81) },
+        { UINT8_C( 69), UINT8_C(178), UINT8_C(199), UINT8_C(161), UINT8_C(252), UINT8_C( 19), UINT8_C( 37), UINT8_C(160),
+          UINT8_C(142), UINT8_C(224), UINT8_C( 12), UINT8_C(115), UINT8_C(168), UINT8_C(175), UINT8_C(162), UINT8_C(221) } } },
+    {  INT32_C(10),
+      { { UINT8_C(132), UINT8_C(248), UINT8_C(215), UINT8_C(250), UINT8_C(187), UINT8_C(253), UINT8_C( 39), UINT8_C( 43),
+          UINT8_C(222), UINT8_C(237), UINT8_C( 19), UINT8_C( 80), UINT8_C(145), UINT8_C(195), UINT8_C(193), UINT8_C( 53) },
+        { UINT8_C(252), UINT8_C(119), UINT8_C( 67), UINT8_C(122), UINT8_C(105), UINT8_C(180), UINT8_C( 49), UINT8_C( 92),
+          UINT8_C(199), UINT8_C(100), UINT8_C( 10), UINT8_C( 14), UINT8_C( 44), UINT8_C(175), UINT8_C(115), UINT8_C(173) },
+        { UINT8_C( 94), UINT8_C( 55), UINT8_C( 26), UINT8_C(143), UINT8_C( 21), UINT8_C(135), UINT8_C(138), UINT8_C( 42),
+          UINT8_C(218), UINT8_C(192), UINT8_C(227), UINT8_C(231), UINT8_C(239), UINT8_C(222), UINT8_C(188), UINT8_C( 70) } },
+      { UINT8_C( 41), UINT8_C( 54), UINT8_C(171) },
+      { { UINT8_C(132), UINT8_C(248), UINT8_C(215), UINT8_C(250), UINT8_C(187), UINT8_C(253), UINT8_C( 39), UINT8_C( 43),
+          UINT8_C(222), UINT8_C(237), UINT8_C( 41), UINT8_C( 80), UINT8_C(145), UINT8_C(195), UINT8_C(193), UINT8_C( 53) },
+        { UINT8_C(252), UINT8_C(119), UINT8_C( 67), UINT8_C(122), UINT8_C(105), UINT8_C(180), UINT8_C( 49), UINT8_C( 92),
+          UINT8_C(199), UINT8_C(100), UINT8_C( 54), UINT8_C( 14), UINT8_C( 44), UINT8_C(175), UINT8_C(115), UINT8_C(173) },
+        { UINT8_C( 94), UINT8_C( 55), UINT8_C( 26), UINT8_C(143), UINT8_C( 21), UINT8_C(135), UINT8_C(138), UINT8_C( 42),
+          UINT8_C(218), UINT8_C(192), UINT8_C(171), UINT8_C(231), UINT8_C(239), UINT8_C(222), UINT8_C(188), UINT8_C( 70) } } },
+    {  INT32_C(15),
+      { { UINT8_C( 18), UINT8_C(111), UINT8_C(196), UINT8_C(193), UINT8_C( 19), UINT8_C(153), UINT8_C( 86), UINT8_C(154),
+          UINT8_C(188), UINT8_C( 47), UINT8_C( 97), UINT8_C( 22), UINT8_C(252), UINT8_C(179), UINT8_C(225), UINT8_C(183) },
+        { UINT8_C( 61), UINT8_C( 15), UINT8_C(232), UINT8_C(124), UINT8_C(  9), UINT8_C( 10), UINT8_C(203), UINT8_C(254),
+          UINT8_C( 65), UINT8_C( 58), UINT8_C( 98), UINT8_C(112), UINT8_C(191), UINT8_C(187), UINT8_C(242), UINT8_C(233) },
+        { UINT8_C( 15), UINT8_C( 71), UINT8_C(172), UINT8_C( 60), UINT8_C(134), UINT8_C( 35), UINT8_C(160), UINT8_C(184),
+          UINT8_C(137), UINT8_C( 20), UINT8_C( 58), UINT8_C(  3), UINT8_C(240), UINT8_C( 48), UINT8_C( 24), UINT8_C(218) } },
+      { UINT8_C(126), UINT8_C( 13), UINT8_C(172) },
+      { { UINT8_C( 18), UINT8_C(111), UINT8_C(196), UINT8_C(193), UINT8_C( 19), UINT8_C(153), UINT8_C( 86), UINT8_C(154),
+          UINT8_C(188), UINT8_C( 47), UINT8_C( 97), UINT8_C( 22), UINT8_C(252), UINT8_C(179), UINT8_C(225), UINT8_C(126) },
+        { UINT8_C( 61), UINT8_C( 15), UINT8_C(232), UINT8_C(124), UINT8_C(  9), UINT8_C( 10), UINT8_C(203), UINT8_C(254),
+          UINT8_C( 65), UINT8_C( 58), UINT8_C( 98), UINT8_C(112), UINT8_C(191), UINT8_C(187), UINT8_C(242), UINT8_C( 13) },
+        { UINT8_C( 15), UINT8_C( 71), UINT8_C(172), UINT8_C( 60), UINT8_C(134), UINT8_C( 35), UINT8_C(160), UINT8_C(184),
+          UINT8_C(137), UINT8_C( 20), UINT8_C( 58), UINT8_C(  3), UINT8_C(240), UINT8_C( 48), UINT8_C( 24), UINT8_C(172) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x3_t src = { {
+      simde_vld1q_u8(test_vec[i].src[0]),
+      simde_vld1q_u8(test_vec[i].src[1]),
+      simde_vld1q_u8(test_vec[i].src[2]) } };
+    simde_uint8x16x3_t r;
+    SIMDE_CONSTIFY_16_(simde_vld3q_lane_u8, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[2], simde_vld1q_u8(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint16_t src[3][8];
+    uint16_t buf[3];
+    uint16_t r[3][8];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT16_C(63330), UINT16_C(57681), UINT16_C(44535), UINT16_C(17502), UINT16_C(53385), UINT16_C(45560), UINT16_C(59506), UINT16_C(40909) },
+        { UINT16_C(27145), UINT16_C(51551), UINT16_C( 6726), UINT16_C(54707), UINT16_C( 3372), UINT16_C(22256), UINT16_C( 1721), UINT16_C(12944) },
+        { UINT16_C(41851), UINT16_C(21693), UINT16_C(55015), UINT16_C( 9579), UINT16_C(16600), UINT16_C(53176), UINT16_C(64564), UINT16_C(23018) } },
+      { UINT16_C(44683), UINT16_C( 4219), UINT16_C(13356) },
+      { { UINT16_C(44683), UINT16_C(57681), UINT16_C(44535), UINT16_C(17502), UINT16_C(53385), UINT16_C(45560), UINT16_C(59506), UINT16_C(40909) },
+        { UINT16_C( 4219), UINT16_C(51551), UINT16_C( 6726), UINT16_C(54707), UINT16_C( 3372), UINT16_C(22256), UINT16_C( 1721), UINT16_C(12944) },
+        { UINT16_C(13356), UINT16_C(21693), UINT16_C(55015), UINT16_C( 9579), UINT16_C(16600), UINT16_C(53176), UINT16_C(64564), UINT16_C(23018) } } },
+    {  INT32_C( 5),
+      { { UINT16_C(42371), UINT16_C(59105), UINT16_C(15414), UINT16_C(  347), UINT16_C(30217), UINT16_C(52109), UINT16_C(53886), UINT16_C(37821) },
+        { UINT16_C(32336), UINT16_C(41308), UINT16_C(24025), UINT16_C(51052), UINT16_C(  289), UINT16_C( 9040), UINT16_C( 7448), UINT16_C(15620) },
+        { UINT16_C(57963), UINT16_C(58990), UINT16_C( 4595), UINT16_C(64328), UINT16_C(16932), UINT16_C(44815), UINT16_C( 3913), UINT16_C(29840) } },
+      { UINT16_C( 7734), UINT16_C(48331), UINT16_C(14196) },
+      { { UINT16_C(42371), UINT16_C(59105), UINT16_C(15414), UINT16_C(  347), UINT16_C(30217), UINT16_C( 7734), UINT16_C(53886), UINT16_C(37821) },
+        { UINT16_C(32336), UINT16_C(41308), UINT16_C(24025), UINT16_C(51052), UINT16_C(  289), UINT16_C(48331), UINT16_C( 7448), UINT16_C(15620) },
+        { UINT16_C(57963), UINT16_C(58990), UINT16_C( 4595), UINT16_C(64328), UINT16_C(16932), UINT16_C(14196), UINT16_C( 3913), UINT16_C(29840) } } },
+    {  INT32_C( 2),
+      { { UINT16_C(19687), UINT16_C(51246), UINT16_C( 3481), UINT16_C(21004), UINT16_C(14808), UINT16_C(10502), UINT16_C( 8895), UINT16_C(14429) },
+        { UINT16_C(20557), UINT16_C(28311), UINT16_C(62861), UINT16_C(48176), UINT16_C(33611), UINT16_C(54834), UINT16_C(45841), UINT16_C(26031) },
+        { UINT16_C(53459), UINT16_C(14651), UINT16_C(31256), UINT16_C(27629), UINT16_C(19169), UINT16_C(29010), UINT16_C(55095), UINT16_C(60700) } },
+      { UINT16_C(18839), UINT16_C(49213), UINT16_C( 2097) },
+      { { UINT16_C(19687), UINT16_C(51246), UINT16_C(18839), UINT16_C(21004), UINT16_C(14808), UINT16_C(10502), UINT16_C( 8895), UINT16_C(14429) },
+        { UINT16_C(20557), UINT16_C(28311), UINT16_C(49213), UINT16_C(48176), UINT16_C(33611), UINT16_C(54834), UINT16_C(45841), UINT16_C(26031) },
+        { UINT16_C(53459), UINT16_C(14651), UINT16_C( 2097), UINT16_C(27629), UINT16_C(19169), UINT16_C(29010), UINT16_C(55095), UINT16_C(60700) } } },
+    {  INT32_C( 7),
+      { { UINT16_C(57131), UINT16_C(16573), UINT16_C(54989), UINT16_C(61625), UINT16_C(37902), UINT16_C(33114), UINT16_C(47162), UINT16_C(23888) },
+        { UINT16_C(12801), UINT16_C(56117), UINT16_C(33118), UINT16_C(60967), UINT16_C(18722), UINT16_C(30741), UINT16_C(60014), UINT16_C(40038) },
+        { UINT16_C(58295), UINT16_C(42507), UINT16_C(47432), UINT16_C(35798), UINT16_C(13955), UINT16_C(20578), UINT16_C(56907), UINT16_C(30548) } },
+      { UINT16_C(58059), UINT16_C(33782), UINT16_C(14616) },
+      { { UINT16_C(57131), UINT16_C(16573), UINT16_C(54989), UINT16_C(61625), UINT16_C(37902), UINT16_C(33114), UINT16_C(47162), UINT16_C(58059) },
+        { UINT16_C(12801), UINT16_C(56117), UINT16_C(33118), UINT16_C(60967), UINT16_C(18722), UINT16_C(30741), UINT16_C(60014), UINT16_C(33782) },
+        { UINT16_C(58295), UINT16_C(42507), UINT16_C(47432), UINT16_C(35798), UINT16_C(13955), UINT16_C(20578), UINT16_C(56907), UINT16_C(14616) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x3_t src = { {
+      simde_vld1q_u16(test_vec[i].src[0]),
+      simde_vld1q_u16(test_vec[i].src[1]),
+      simde_vld1q_u16(test_vec[i].src[2]) } };
+    simde_uint16x8x3_t r;
+    SIMDE_CONSTIFY_8_(simde_vld3q_lane_u16, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[2], simde_vld1q_u16(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint32_t src[3][4];
+    uint32_t buf[3];
+    uint32_t r[3][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT32_C(1308961387), UINT32_C(1560809380), UINT32_C(3225910356), UINT32_C(3269794204) },
+        { UINT32_C(3541635401), UINT32_C(3798450924), UINT32_C(4182708615), UINT32_C(2350929162) },
+        { UINT32_C(2425825834), UINT32_C(1714940506), UINT32_C(2974193323), UINT32_C(2861307844) } },
+      { UINT32_C(  14355097), UINT32_C(2893938135), UINT32_C( 706734914) },
+      { { UINT32_C(  14355097), UINT32_C(1560809380), UINT32_C(3225910356), UINT32_C(3269794204) },
+        { UINT32_C(2893938135), UINT32_C(3798450924), UINT32_C(4182708615), UINT32_C(2350929162) },
+        { UINT32_C( 706734914), UINT32_C(1714940506), UINT32_C(2974193323), UINT32_C(2861307844) } } },
+    {  INT32_C( 1),
+      { { UINT32_C(2675966591), UINT32_C(2806200787), UINT32_C(1951009950), UINT32_C(3284903135) },
+        { UINT32_C(4143670905), UINT32_C(1776931823), UINT32_C(1585860037), UINT32_C(1703497394) },
+        { UINT32_C( 162999103), UINT32_C( 791280251), UINT32_C( 134923618), UINT32_C(1893130975) } },
+      { UINT32_C(2547868449), UINT32_C(1893651603), UINT32_C(1703644541) },
+      { { UINT32_C(2675966591), UINT32_C(2547868449), UINT32_C(1951009950), UINT32_C(3284903135) },
+        { UINT32_C(4143670905), UINT32_C(1893651603), UINT32_C(1585860037), UINT32_C(1703497394) },
+        { UINT32_C( 162999103), UINT32_C(1703644541), UINT32_C( 134923618), UINT32_C(1893130975) } } },
+    {  INT32_C( 2),
+      { { UINT32_C(4122016326), UINT32_C( 394575030), UINT32_C(3811944988), UINT32_C(1869911264) },
+        { UINT32_C( 893245440), UINT32_C(4040230777), UINT32_C( 502240040), UINT32_C(2452780567) },
+        { UINT32_C(3005651259), UINT32_C(2206190996), UINT32_C(1305310935), UINT32_C( 651169754) } },
+      { UINT32_C(3876905960), UINT32_C(2414072565), UINT32_C( 920090955) },
+      { { UINT32_C(4122016326), UINT32_C( 394575030), UINT32_C(3876905960), UINT32_C(1869911264) },
+        { UINT32_C( 893245440), UINT32_C(4040230777), UINT32_C(2414072565), UINT32_C(2452780567) },
+        { UINT32_C(3005651259), UINT32_C(2206190996), UINT32_C( 920090955), UINT32_C( 651169754) } } },
+    {  INT32_C( 3),
+      { { UINT32_C( 519201798), UINT32_C( 381951049), UINT32_C(2758746317), UINT32_C( 241237316) },
+        { UINT32_C(1075624521), UINT32_C( 356982234), UINT32_C(2893619297), UINT32_C(3380574946) },
+        { UINT32_C(4142609785), UINT32_C( 206809687), UINT32_C(2540432560), UINT32_C(4184765128) } },
+      { UINT32_C(2542517141), UINT32_C(1805453610), UINT32_C(2446326490) },
+      { { UINT32_C( 519201798), UINT32_C( 381951049), UINT32_C(2758746317), UINT32_C(2542517141) },
+        { UINT32_C(1075624521), UINT32_C( 356982234), UINT32_C(2893619297), UINT32_C(1805453610) },
+        { UINT32_C(4142609785), UINT32_C( 206809687), UINT32_C(2540432560), UINT32_C(2446326490) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x3_t src = { {
+      simde_vld1q_u32(test_vec[i].src[0]),
+      simde_vld1q_u32(test_vec[i].src[1]),
+      simde_vld1q_u32(test_vec[i].src[2]) } };
+    simde_uint32x4x3_t r;
+    SIMDE_CONSTIFY_4_(simde_vld3q_lane_u32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[2], simde_vld1q_u32(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    uint64_t src[3][2];
+    uint64_t buf[3];
+    uint64_t r[3][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { UINT64_C( 3984320393446486349), UINT64_C(13049142899346980091) },
+        { UINT64_C( 3926865152281120771), UINT64_C( 8036006407842349649) },
+        { UINT64_C(18328241446272767552), UINT64_C(11287074109925660947) } },
+      { UINT64_C( 1354762790139937142), UINT64_C(  139645431433721390), UINT64_C(16914163232726256724) },
+      { { UINT64_C( 1354762790139937142), UINT64_C(13049142899346980091) },
+        { UINT64_C(  139645431433721390), UINT64_C( 8036006407842349649) },
+        { UINT64_C(16914163232726256724), UINT64_C(11287074109925660947) } } },
+    {  INT32_C( 1),
+      { { UINT64_C( 5233607816161698118), UINT64_C( 9900177195685575202) },
+        { UINT64_C(10656269306688588525), UINT64_C( 4127822821724772158) },
+        { UINT64_C( 9176275764817035483), UINT64_C( 4425705010287010593) } },
+      { UINT64_C( 6467354705778667948), UINT64_C( 3084763518596204482), UINT64_C( 4742404215450199682) },
+      { { UINT64_C( 5233607816161698118), UINT64_C( 6467354705778667948) },
+        { UINT64_C(10656269306688588525), UINT64_C( 3084763518596204482) },
+        { UINT64_C( 9176275764817035483), UINT64_C( 4742404215450199682) } } },
+    {  INT32_C( 0),
+      { { UINT64_C(17762909925572869622), UINT64_C( 5848204150096988404) },
+        { UINT64_C( 9156294659880278121), UINT64_C(13772999119393660235) },
+        { UINT64_C( 6031677215816713325), UINT64_C(17780256039291782951) } },
+      { UINT64_C(13259582383934526702), UINT64_C(17605823499522930486), UINT64_C(10890502149299138735) },
+      { { UINT64_C(13259582383934526702), UINT64_C( 5848204150096988404) },
+        { UINT64_C(17605823499522930486), UINT64_C(13772999119393660235) },
+        { UINT64_C(10890502149299138735), UINT64_C(17780256039291782951) } } },
+    {  INT32_C( 1),
+      { { UINT64_C(  216196181496352551), UINT64_C(13118546395555487679) },
+        { UINT64_C( 1008971310345848208), UINT64_C(10208323812186703273) },
+        { UINT64_C( 8151153329366983997), UINT64_C( 5277491253718409622) } },
+      { UINT64_C( 1606651843409033723), UINT64_C(18299253746445780052), UINT64_C(14867444223260887560) },
+      { { UINT64_C(  216196181496352551), UINT64_C( 1606651843409033723) },
+        { UINT64_C( 1008971310345848208), UINT64_C(18299253746445780052) },
+        { UINT64_C( 8151153329366983997), UINT64_C(14867444223260887560) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x3_t src = { {
+      simde_vld1q_u64(test_vec[i].src[0]),
+      simde_vld1q_u64(test_vec[i].src[1]),
+      simde_vld1q_u64(test_vec[i].src[2]) } };
+    simde_uint64x2x3_t r;
+    SIMDE_CONSTIFY_2_(simde_vld3q_lane_u64, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[2], simde_vld1q_u64(test_vec[i].r[2]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float32_t src[3][4];
+    simde_float32_t buf[3];
+    simde_float32_t r[3][4];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT32_C(   214.66), SIMDE_FLOAT32_C(  -670.63), SIMDE_FLOAT32_C(  -752.05), SIMDE_FLOAT32_C(   973.36) },
+        { SIMDE_FLOAT32_C(  -449.92), SIMDE_FLOAT32_C(  -927.21), SIMDE_FLOAT32_C(   162.90), SIMDE_FLOAT32_C(   455.68) },
+        { SIMDE_FLOAT32_C(    75.25), SIMDE_FLOAT32_C(  -492.16), SIMDE_FLOAT32_C(   554.43), SIMDE_FLOAT32_C(  -198.36) } },
+      { SIMDE_FLOAT32_C(   476.18), SIMDE_FLOAT32_C(  -466.52), SIMDE_FLOAT32_C(   970.84) },
+      { { SIMDE_FLOAT32_C(   476.18), SIMDE_FLOAT32_C(  -670.63), SIMDE_FLOAT32_C(  -752.05), SIMDE_FLOAT32_C(   973.36) },
+        { SIMDE_FLOAT32_C(  -466.52), SIMDE_FLOAT32_C(  -927.21), SIMDE_FLOAT32_C(   162.90), SIMDE_FLOAT32_C(   455.68) },
+        { SIMDE_FLOAT32_C(   970.84), SIMDE_FLOAT32_C(  -492.16), SIMDE_FLOAT32_C(   554.43), SIMDE_FLOAT32_C(  -198.36) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT32_C(  -432.73), SIMDE_FLOAT32_C(   809.13), SIMDE_FLOAT32_C(  -185.92), SIMDE_FLOAT32_C(   467.63) },
+        { SIMDE_FLOAT32_C(   502.67), SIMDE_FLOAT32_C(    50.12), SIMDE_FLOAT32_C(  -645.42), SIMDE_FLOAT32_C(  -231.04) },
+        { SIMDE_FLOAT32_C(   879.45), SIMDE_FLOAT32_C(  -368.53), SIMDE_FLOAT32_C(   326.47), SIMDE_FLOAT32_C(  -315.91) } },
+      { SIMDE_FLOAT32_C(   675.57), SIMDE_FLOAT32_C(   155.34), SIMDE_FLOAT32_C(  -632.28) },
+      { { SIMDE_FLOAT32_C(  -432.73), SIMDE_FLOAT32_C(   675.57), SIMDE_FLOAT32_C(  -185.92), SIMDE_FLOAT32_C(   467.63) },
+        { SIMDE_FLOAT32_C(   502.67), SIMDE_FLOAT32_C(   155.34), SIMDE_FLOAT32_C(  -645.42), SIMDE_FLOAT32_C(  -231.04) },
+        { SIMDE_FLOAT32_C(   879.45), SIMDE_FLOAT32_C(  -632.28), SIMDE_FLOAT32_C(   326.47), SIMDE_FLOAT32_C(  -315.91) } } },
+    {  INT32_C( 2),
+      { { SIMDE_FLOAT32_C(  -556.22), SIMDE_FLOAT32_C(   941.10), SIMDE_FLOAT32_C(  -467.61), SIMDE_FLOAT32_C(  -579.16) },
+        { SIMDE_FLOAT32_C(   279.37), SIMDE_FLOAT32_C(   457.07), SIMDE_FLOAT32_C(   218.70), SIMDE_FLOAT32_C(  -576.23) },
+        { SIMDE_FLOAT32_C(  -861.96), SIMDE_FLOAT32_C(   214.38), SIMDE_FLOAT32_C(  -397.42), SIMDE_FLOAT32_C(   397.20) } },
+      { SIMDE_FLOAT32_C(  -243.19), SIMDE_FLOAT32_C(  -745.50), SIMDE_FLOAT32_C(  -420.58) },
+      { { SIMDE_FLOAT32_C(  -556.22), SIMDE_FLOAT32_C(   941.10), SIMDE_FLOAT32_C(  -243.19), SIMDE_FLOAT32_C(  -579.16) },
+        { SIMDE_FLOAT32_C(   279.37), SIMDE_FLOAT32_C(   457.07), SIMDE_FLOAT32_C(  -745.50), SIMDE_FLOAT32_C(  -576.23) },
+        { SIMDE_FLOAT32_C(  -861.96), SIMDE_FLOAT32_C(   214.38), SIMDE_FLOAT32_C(  -420.58), SIMDE_FLOAT32_C(   397.20) } } },
+    {  INT32_C( 3),
+      { { SIMDE_FLOAT32_C(  -976.81), SIMDE_FLOAT32_C(  -733.28), SIMDE_FLOAT32_C(  -582.82), SIMDE_FLOAT32_C(  -158.21) },
+        { SIMDE_FLOAT32_C(   966.59), SIMDE_FLOAT32_C(  -957.16), SIMDE_FLOAT32_C(  -430.58), SIMDE_FLOAT32_C(    55.65) },
+        { SIMDE_FLOAT32_C(  -471.74), SIMDE_FLOAT32_C(  -727.22), SIMDE_FLOAT32_C(   961.18), SIMDE_FLOAT32_C(   580.79) } },
+      { SIMDE_FLOAT32_C(   672.99), SIMDE_FLOAT32_C(  -545.35), SIMDE_FLOAT32_C(   394.16) },
+      { { SIMDE_FLOAT32_C(  -976.81), SIMDE_FLOAT32_C(  -733.28), SIMDE_FLOAT32_C(  -582.82), SIMDE_FLOAT32_C(   672.99) },
+        { SIMDE_FLOAT32_C(   966.59), SIMDE_FLOAT32_C(  -957.16), SIMDE_FLOAT32_C(  -430.58), SIMDE_FLOAT32_C(  -545.35) },
+        { SIMDE_FLOAT32_C(  -471.74), SIMDE_FLOAT32_C(  -727.22), SIMDE_FLOAT32_C(   961.18), SIMDE_FLOAT32_C(   394.16) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x3_t src = { {
+      simde_vld1q_f32(test_vec[i].src[0]),
+      simde_vld1q_f32(test_vec[i].src[1]),
+      simde_vld1q_f32(test_vec[i].src[2]) } };
+    simde_float32x4x3_t r;
+    SIMDE_CONSTIFY_4_(simde_vld3q_lane_f32, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[2], simde_vld1q_f32(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld3q_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int lane;
+    simde_float64_t src[3][2];
+    simde_float64_t buf[3];
+    simde_float64_t r[3][2];
+  } test_vec[] = {
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(  -992.78), SIMDE_FLOAT64_C(   622.45) },
+        { SIMDE_FLOAT64_C(   488.46), SIMDE_FLOAT64_C(    22.13) },
+        { SIMDE_FLOAT64_C(  -153.92), SIMDE_FLOAT64_C(   425.74) } },
+      { SIMDE_FLOAT64_C(  -313.45), SIMDE_FLOAT64_C(  -586.27), SIMDE_FLOAT64_C(  -931.75) },
+      { { SIMDE_FLOAT64_C(  -313.45), SIMDE_FLOAT64_C(   622.45) },
+        { SIMDE_FLOAT64_C(  -586.27), SIMDE_FLOAT64_C(    22.13) },
+        { SIMDE_FLOAT64_C(  -931.75), SIMDE_FLOAT64_C(   425.74) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT64_C(   -63.26), SIMDE_FLOAT64_C(   774.50) },
+        { SIMDE_FLOAT64_C(  -417.71), SIMDE_FLOAT64_C(   178.57) },
+        { SIMDE_FLOAT64_C(   473.85), SIMDE_FLOAT64_C(  -768.25) } },
+      { SIMDE_FLOAT64_C(  -689.53), SIMDE_FLOAT64_C(   254.62), SIMDE_FLOAT64_C(   451.05) },
+      { { SIMDE_FLOAT64_C(   -63.26), SIMDE_FLOAT64_C(  -689.53) },
+        { SIMDE_FLOAT64_C(  -417.71), SIMDE_FLOAT64_C(   254.62) },
+        { SIMDE_FLOAT64_C(   473.85), SIMDE_FLOAT64_C(   451.05) } } },
+    {  INT32_C( 0),
+      { { SIMDE_FLOAT64_C(  -760.23), SIMDE_FLOAT64_C(   565.50) },
+        { SIMDE_FLOAT64_C(  -893.98), SIMDE_FLOAT64_C(  -560.93) },
+        { SIMDE_FLOAT64_C(   369.66), SIMDE_FLOAT64_C(   235.63) } },
+      { SIMDE_FLOAT64_C(  -206.19), SIMDE_FLOAT64_C(   806.60), SIMDE_FLOAT64_C(  -224.07) },
+      { { SIMDE_FLOAT64_C(  -206.19), SIMDE_FLOAT64_C(   565.50) },
+        { SIMDE_FLOAT64_C(   806.60), SIMDE_FLOAT64_C(  -560.93) },
+        { SIMDE_FLOAT64_C(  -224.07), SIMDE_FLOAT64_C(   235.63) } } },
+    {  INT32_C( 1),
+      { { SIMDE_FLOAT64_C(   599.08), SIMDE_FLOAT64_C(   512.27) },
+        { SIMDE_FLOAT64_C(   976.56), SIMDE_FLOAT64_C(   782.75) },
+        { SIMDE_FLOAT64_C(  -983.39), SIMDE_FLOAT64_C(   336.98) } },
+      { SIMDE_FLOAT64_C(  -540.28), SIMDE_FLOAT64_C(  -493.10), SIMDE_FLOAT64_C(   521.05) },
+      { { SIMDE_FLOAT64_C(   599.08), SIMDE_FLOAT64_C(  -540.28) },
+        { SIMDE_FLOAT64_C(   976.56), SIMDE_FLOAT64_C(  -493.10) },
+        { SIMDE_FLOAT64_C(  -983.39), SIMDE_FLOAT64_C(   521.05) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x3_t src = { {
+      simde_vld1q_f64(test_vec[i].src[0]),
+      simde_vld1q_f64(test_vec[i].src[1]),
+      simde_vld1q_f64(test_vec[i].src[2]) } };
+    simde_float64x2x3_t r;
+    SIMDE_CONSTIFY_2_(simde_vld3q_lane_f64, r, (HEDLEY_UNREACHABLE(), r), test_vec[i].lane, test_vec[i].buf, src);
+
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[2], simde_vld1q_f64(test_vec[i].r[2]), 1);
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3_lane_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld3q_lane_f64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
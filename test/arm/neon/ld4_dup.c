@@ -0,0 +1,868 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld4_dup
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld4_dup.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vld4_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t buf[4];
+    simde_float32_t r[4][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   262.23), SIMDE_FLOAT32_C(  -900.79), SIMDE_FLOAT32_C(   -43.28), SIMDE_FLOAT32_C(  -167.93) },
+      { { SIMDE_FLOAT32_C(   262.23), SIMDE_FLOAT32_C(   262.23) },
+        { SIMDE_FLOAT32_C(  -900.79), SIMDE_FLOAT32_C(  -900.79) },
+        { SIMDE_FLOAT32_C(   -43.28), SIMDE_FLOAT32_C(   -43.28) },
+        { SIMDE_FLOAT32_C(  -167.93), SIMDE_FLOAT32_C(  -167.93) } } },
+    { { SIMDE_FLOAT32_C(   492.10), SIMDE_FLOAT32_C(  -841.37), SIMDE_FLOAT32_C(  -537.62), SIMDE_FLOAT32_C(    41.04) },
+      { { SIMDE_FLOAT32_C(   492.10), SIMDE_FLOAT32_C(   492.10) },
+        { SIMDE_FLOAT32_C(  -841.37), SIMDE_FLOAT32_C(  -841.37) },
+        { SIMDE_FLOAT32_C(  -537.62), SIMDE_FLOAT32_C(  -537.62) },
+        { SIMDE_FLOAT32_C(    41.04), SIMDE_FLOAT32_C(    41.04) } } },
+    { { SIMDE_FLOAT32_C(  -471.89), SIMDE_FLOAT32_C(  -672.04), SIMDE_FLOAT32_C(  -270.84), SIMDE_FLOAT32_C(   493.86) },
+      { { SIMDE_FLOAT32_C(  -471.89), SIMDE_FLOAT32_C(  -471.89) },
+        { SIMDE_FLOAT32_C(  -672.04), SIMDE_FLOAT32_C(  -672.04) },
+        { SIMDE_FLOAT32_C(  -270.84), SIMDE_FLOAT32_C(  -270.84) },
+        { SIMDE_FLOAT32_C(   493.86), SIMDE_FLOAT32_C(   493.86) } } },
+    { { SIMDE_FLOAT32_C(  -856.14), SIMDE_FLOAT32_C(  -787.75), SIMDE_FLOAT32_C(  -182.82), SIMDE_FLOAT32_C(  -299.78) },
+      { { SIMDE_FLOAT32_C(  -856.14), SIMDE_FLOAT32_C(  -856.14) },
+        { SIMDE_FLOAT32_C(  -787.75), SIMDE_FLOAT32_C(  -787.75) },
+        { SIMDE_FLOAT32_C(  -182.82), SIMDE_FLOAT32_C(  -182.82) },
+        { SIMDE_FLOAT32_C(  -299.78), SIMDE_FLOAT32_C(  -299.78) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x4_t r = simde_vld4_dup_f32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[2], simde_vld1_f32(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[3], simde_vld1_f32(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t buf[4];
+    simde_float64_t r[4][1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -703.36), SIMDE_FLOAT64_C(   815.30), SIMDE_FLOAT64_C(   -81.23), SIMDE_FLOAT64_C(  -345.39) },
+      { { SIMDE_FLOAT64_C(  -703.36) },
+        { SIMDE_FLOAT64_C(   815.30) },
+        { SIMDE_FLOAT64_C(   -81.23) },
+        { SIMDE_FLOAT64_C(  -345.39) } } },
+    { { SIMDE_FLOAT64_C(   944.96), SIMDE_FLOAT64_C(   814.33), SIMDE_FLOAT64_C(  -426.45), SIMDE_FLOAT64_C(   288.54) },
+      { { SIMDE_FLOAT64_C(   944.96) },
+        { SIMDE_FLOAT64_C(   814.33) },
+        { SIMDE_FLOAT64_C(  -426.45) },
+        { SIMDE_FLOAT64_C(   288.54) } } },
+    { { SIMDE_FLOAT64_C(     2.05), SIMDE_FLOAT64_C(   691.18), SIMDE_FLOAT64_C(   776.23), SIMDE_FLOAT64_C(   741.95) },
+      { { SIMDE_FLOAT64_C(     2.05) },
+        { SIMDE_FLOAT64_C(   691.18) },
+        { SIMDE_FLOAT64_C(   776.23) },
+        { SIMDE_FLOAT64_C(   741.95) } } },
+    { { SIMDE_FLOAT64_C(   238.19), SIMDE_FLOAT64_C(   781.90), SIMDE_FLOAT64_C(   634.78), SIMDE_FLOAT64_C(   208.37) },
+      { { SIMDE_FLOAT64_C(   238.19) },
+        { SIMDE_FLOAT64_C(   781.90) },
+        { SIMDE_FLOAT64_C(   634.78) },
+        { SIMDE_FLOAT64_C(   208.37) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x4_t r = simde_vld4_dup_f64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[2], simde_vld1_f64(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[3], simde_vld1_f64(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t buf[4];
+    int8_t r[4][8];
+  } test_vec[] = {
+    { {  INT8_C(110),  INT8_C( 73), -INT8_C(124),  INT8_C(118) },
+      { {  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110),  INT8_C(110) },
+        {  INT8_C( 73),  INT8_C( 73),  INT8_C( 73),  INT8_C( 73),  INT8_C( 73),  INT8_C( 73),  INT8_C( 73),  INT8_C( 73) },
+        { -INT8_C(124), -INT8_C(124), -INT8_C(124), -INT8_C(124), -INT8_C(124), -INT8_C(124), -INT8_C(124), -INT8_C(124) },
+        {  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118),  INT8_C(118) } } },
+    { { -INT8_C( 46),  INT8_C( 85), -INT8_C( 40), -INT8_C( 44) },
+      { { -INT8_C( 46), -INT8_C( 46), -INT8_C( 46), -INT8_C( 46), -INT8_C( 46), -INT8_C( 46), -INT8_C( 46), -INT8_C( 46) },
+        {  INT8_C( 85),  INT8_C( 85),  INT8_C( 85),  INT8_C( 85),  INT8_C( 85),  INT8_C( 85),  INT8_C( 85),  INT8_C( 85) },
+        { -INT8_C( 40), -INT8_C( 40), -INT8_C( 40), -INT8_C( 40), -INT8_C( 40), -INT8_C( 40), -INT8_C( 40), -INT8_C( 40) },
+        { -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44), -INT8_C( 44) } } },
+    { {  INT8_C( 36), -INT8_C( 60), -INT8_C(  9),  INT8_C( 60) },
+      { {  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36),  INT8_C( 36) },
+        { -INT8_C( 60), -INT8_C( 60), -INT8_C( 60), -INT8_C( 60), -INT8_C( 60), -INT8_C( 60), -INT8_C( 60), -INT8_C( 60) },
+        { -INT8_C(  9), -INT8_C(  9), -INT8_C(  9), -INT8_C(  9), -INT8_C(  9), -INT8_C(  9), -INT8_C(  9), -INT8_C(  9) },
+        {  INT8_C( 60),  INT8_C( 60),  INT8_C( 60),  INT8_C( 60),  INT8_C( 60),  INT8_C( 60),  INT8_C( 60),  INT8_C( 60) } } },
+    { { -INT8_C( 74),  INT8_C( 71),  INT8_C( 82),  INT8_C(102) },
+      { { -INT8_C( 74), -INT8_C( 74), -INT8_C( 74), -INT8_C( 74), -INT8_C( 74), -INT8_C( 74), -INT8_C( 74), -INT8_C( 74) },
+        {  INT8_C( 71),  INT8_C( 71),  INT8_C( 71),  INT8_C( 71),  INT8_C( 71),  INT8_C( 71),  INT8_C( 71),  INT8_C( 71) },
+        {  INT8_C( 82),  INT8_C( 82),  INT8_C( 82),  INT8_C( 82),  INT8_C( 82),  INT8_C( 82),  INT8_C( 82),  INT8_C( 82) },
+        {  INT8_C(102),  INT8_C(102),  INT8_C(102),  INT8_C(102),  INT8_C(102),  INT8_C(102),  INT8_C(102),  INT8_C(102) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x4_t r = simde_vld4_dup_s8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[2], simde_vld1_s8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[3], simde_vld1_s8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t buf[4];
+    int16_t r[4][4];
+  } test_vec[] = {
+    { {  INT16_C(15562),  INT16_C(13280), -INT16_C( 8575),  INT16_C(16838) },
+      { {  INT16_C(15562),  INT16_C(15562),  INT16_C(15562),  INT16_C(15562) },
+        {  INT16_C(13280),  INT16_C(13280),  INT16_C(13280),  INT16_C(13280) },
+        { -INT16_C( 8575), -INT16_C( 8575), -INT16_C( 8575), -INT16_C( 8575) },
+        {  INT16_C(16838),  INT16_C(16838),  INT16_C(16838),  INT16_C(16838) } } },
+    { { -INT16_C( 5013), -INT16_C(18117), -INT16_C(32118),  INT16_C(21198) },
+      { { -INT16_C( 5013), -INT16_C( 5013), -INT16_C( 5013), -INT16_C( 5013) },
+        { -INT16_C(18117), -INT16_C(18117), -INT16_C(18117), -INT16_C(18117) },
+        { -INT16_C(32118), -INT16_C(32118), -INT16_C(32118), -INT16_C(32118) },
+        {  INT16_C(21198),  INT16_C(21198),  INT16_C(21198),  INT16_C(21198) } } },
+    { {  INT16_C(32389),  INT16_C( 5799), -INT16_C(12557), -INT16_C(15135) },
+      { {  INT16_C(32389),  INT16_C(32389),  INT16_C(32389),  INT16_C(32389) },
+        {  INT16_C( 5799),  INT16_C( 5799),  INT16_C( 5799),  INT16_C( 5799) },
+        { -INT16_C(12557), -INT16_C(12557), -INT16_C(12557), -INT16_C(12557) },
+        { -INT16_C(15135), -INT16_C(15135), -INT16_C(15135), -INT16_C(15135) } } },
+    { { -INT16_C(27743), -INT16_C(25004), -INT16_C( 8852), -INT16_C(27393) },
+      { { -INT16_C(27743), -INT16_C(27743), -INT16_C(27743), -INT16_C(27743) },
+        { -INT16_C(25004), -INT16_C(25004), -INT16_C(25004), -INT16_C(25004) },
+        { -INT16_C( 8852), -INT16_C( 8852), -INT16_C( 8852), -INT16_C( 8852) },
+        { -INT16_C(27393), -INT16_C(27393), -INT16_C(27393), -INT16_C(27393) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x4_t r = simde_vld4_dup_s16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[2], simde_vld1_s16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[3], simde_vld1_s16(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t buf[4];
+    int32_t r[4][2];
+  } test_vec[] = {
+    { { -INT32_C(1489274164), -INT32_C(1744796833),  INT32_C(1116704897),  INT32_C( 946231870) },
+      { { -INT32_C(1489274164), -INT32_C(1489274164) },
+        { -INT32_C(1744796833), -INT32_C(1744796833) },
+        {  INT32_C(1116704897),  INT32_C(1116704897) },
+        {  INT32_C( 946231870),  INT32_C( 946231870) } } },
+    { {  INT32_C( 429149545),  INT32_C(1728163120),  INT32_C( 431396302),  INT32_C( 681679429) },
+      { {  INT32_C( 429149545),  INT32_C( 429149545) },
+        {  INT32_C(1728163120),  INT32_C(1728163120) },
+        {  INT32_C( 431396302),  INT32_C( 431396302) },
+        {  INT32_C( 681679429),  INT32_C( 681679429) } } },
+    { { -INT32_C( 202125550),  INT32_C(1096061451), -INT32_C(1096793969), -INT32_C(1960003629) },
+      { { -INT32_C( 202125550), -INT32_C( 202125550) },
+        {  INT32_C(1096061451),  INT32_C(1096061451) },
+        { -INT32_C(1096793969), -INT32_C(1096793969) },
+        { -INT32_C(1960003629), -INT32_C(1960003629) } } },
+    { { -INT32_C(1525367956), -INT32_C(2023389960), -INT32_C(  54734722), -INT32_C(1155746516) },
+      { { -INT32_C(1525367956), -INT32_C(1525367956) },
+        { -INT32_C(2023389960), -INT32_C(2023389960) },
+        { -INT32_C(  54734722), -INT32_C(  54734722) },
+        { -INT32_C(1155746516), -INT32_C(1155746516) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x4_t r = simde_vld4_dup_s32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[2], simde_vld1_s32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[3], simde_vld1_s32(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t buf[4];
+    int64_t r[4][1];
+  } test_vec[] = {
+    { { -INT64_C(1862727746191769817), -INT64_C( 864491918171641811),  INT64_C(  35785484978250812), -INT64_C(6207099413827854522) },
+      { { -INT64_C(1862727746191769817) },
+        { -INT64_C( 864491918171641811) },
+        {  INT64_C(  35785484978250812) },
+        { -INT64_C(6207099413827854522) } } },
+    { { -INT64_C(5539503626509871074), -INT64_C(7603206181323628220),  INT64_C(5287882169532716366), -INT64_C(1009039946313977359) },
+      { { -INT64_C(5539503626509871074) },
+        { -INT64_C(7603206181323628220) },
+        {  INT64_C(5287882169532716366) },
+        { -INT64_C(1009039946313977359) } } },
+    { { -INT64_C(7748666617313588867), -INT64_C(7116940475667027295), -INT64_C(5315299642729373358),  INT64_C( 850245382998176064) },
+      { { -INT64_C(7748666617313588867) },
+        { -INT64_C(7116940475667027295) },
+        { -INT64_C(5315299642729373358) },
+        {  INT64_C( 850245382998176064) } } },
+    { { -INT64_C(3651049524817709866),  INT64_C( 935681240715840079),  INT64_C(3174433814517538803), -INT64_C(3886913761897932213) },
+      { { -INT64_C(3651049524817709866) },
+        {  INT64_C( 935681240715840079) },
+        {  INT64_C(3174433814517538803) },
+        { -INT64_C(3886913761897932213) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x4_t r = simde_vld4_dup_s64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[2], simde_vld1_s64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[3], simde_vld1_s64(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t buf[4];
+    uint8_t r[4][8];
+  } test_vec[] = {
+    { {    UINT8_MAX, UINT8_C(245), UINT8_C(203), UINT8_C( 63) },
+      { {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX },
+        { UINT8_C(245), UINT8_C(245), UINT8_C(245), UINT8_C(245), UINT8_C(245), UINT8_C(245), UINT8_C(245), UINT8_C(245) },
+        { UINT8_C(203), UINT8_C(203), UINT8_C(203), UINT8_C(203), UINT8_C(203), UINT8_C(203), UINT8_C(203), UINT8_C(203) },
+        { UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63) } } },
+    { { UINT8_C(248), UINT8_C(  7), UINT8_C(151), UINT8_C(162) },
+      { { UINT8_C(248), UINT8_C(248), UINT8_C(248), UINT8_C(248), UINT8_C(248), UINT8_C(248), UINT8_C(248), UINT8_C(248) },
+        { UINT8_C(  7), UINT8_C(  7), UINT8_C(  7), UINT8_C(  7), UINT8_C(  7), UINT8_C(  7), UINT8_C(  7), UINT8_C(  7) },
+        { UINT8_C(151), UINT8_C(151), UINT8_C(151), UINT8_C(151), UINT8_C(151), UINT8_C(151), UINT8_C(151), UINT8_C(151) },
+        { UINT8_C(162), UINT8_C(162), UINT8_C(162), UINT8_C(162), UINT8_C(162), UINT8_C(162), UINT8_C(162), UINT8_C(162) } } },
+    { { UINT8_C(152), UINT8_C(150), UINT8_C(138), UINT8_C( 84) },
+      { { UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(152), UINT8_C(152) },
+        { UINT8_C(150), UINT8_C(150), UINT8_C(150), UINT8_C(150), UINT8_C(150), UINT8_C(150), UINT8_C(150), UINT8_C(150) },
+        { UINT8_C(138), UINT8_C(138), UINT8_C(138), UINT8_C(138), UINT8_C(138), UINT8_C(138), UINT8_C(138), UINT8_C(138) },
+        { UINT8_C( 84), UINT8_C( 84), UINT8_C( 84), UINT8_C( 84), UINT8_C( 84), UINT8_C( 84), UINT8_C( 84), UINT8_C( 84) } } },
+    { { UINT8_C( 73), UINT8_C(235), UINT8_C(251), UINT8_C(174) },
+      { { UINT8_C( 73), UINT8_C( 73), UINT8_C( 73), UINT8_C( 73), UINT8_C( 73), UINT8_C( 73), UINT8_C( 73), UINT8_C( 73) },
+        { UINT8_C(235), UINT8_C(235), UINT8_C(235), UINT8_C(235), UINT8_C(235), UINT8_C(235), UINT8_C(235), UINT8_C(235) },
+        { UINT8_C(251), UINT8_C(251), UINT8_C(251), UINT8_C(251), UINT8_C(251), UINT8_C(251), UINT8_C(251), UINT8_C(251) },
+        { UINT8_C(174), UINT8_C(174), UINT8_C(174), UINT8_C(174), UINT8_C(174), UINT8_C(174), UINT8_C(174), UINT8_C(174) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x4_t r = simde_vld4_dup_u8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[2], simde_vld1_u8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[3], simde_vld1_u8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t buf[4];
+    uint16_t r[4][4];
+  } test_vec[] = {
+    { { UINT16_C(  996), UINT16_C(29420), UINT16_C(21955), UINT16_C(29491) },
+      { { UINT16_C(  996), UINT16_C(  996), UINT16_C(  996), UINT16_C(  996) },
+        { UINT16_C(29420), UINT16_C(29420), UINT16_C(29420), UINT16_C(29420) },
+        { UINT16_C(21955), UINT16_C(21955), UINT16_C(21955), UINT16_C(21955) },
+        { UINT16_C(29491), UINT16_C(29491), UINT16_C(29491), UINT16_C(29491) } } },
+    { { UINT16_C(17266), UINT16_C(49888), UINT16_C( 8059), UINT16_C( 2132) },
+      { { UINT16_C(17266), UINT16_C(17266), UINT16_C(17266), UINT16_C(17266) },
+        { UINT16_C(49888), UINT16_C(49888), UINT16_C(49888), UINT16_C(49888) },
+        { UINT16_C( 8059), UINT16_C( 8059), UINT16_C( 8059), UINT16_C( 8059) },
+        { UINT16_C( 2132), UINT16_C( 2132), UINT16_C( 2132), UINT16_C( 2132) } } },
+    { { UINT16_C(53930), UINT16_C(28057), UINT16_C(39200), UINT16_C(56770) },
+      { { UINT16_C(53930), UINT16_C(53930), UINT16_C(53930), UINT16_C(53930) },
+        { UINT16_C(28057), UINT16_C(28057), UINT16_C(28057), UINT16_C(28057) },
+        { UINT16_C(39200), UINT16_C(39200), UINT16_C(39200), UINT16_C(39200) },
+        { UINT16_C(56770), UINT16_C(56770), UINT16_C(56770), UINT16_C(56770) } } },
+    { { UINT16_C(41994), UINT16_C(60476), UINT16_C( 8833), UINT16_C(16931) },
+      { { UINT16_C(41994), UINT16_C(41994), UINT16_C(41994), UINT16_C(41994) },
+        { UINT16_C(60476), UINT16_C(60476), UINT16_C(60476), UINT16_C(60476) },
+        { UINT16_C( 8833), UINT16_C( 8833), UINT16_C( 8833), UINT16_C( 8833) },
+        { UINT16_C(16931), UINT16_C(16931), UINT16_C(16931), UINT16_C(16931) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x4_t r = simde_vld4_dup_u16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[2], simde_vld1_u16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[3], simde_vld1_u16(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t buf[4];
+    uint32_t r[4][2];
+  } test_vec[] = {
+    { { UINT32_C(4017901178), UINT32_C(4239142325), UINT32_C(  40929593), UINT32_C(3008962280) },
+      { { UINT32_C(4017901178), UINT32_C(4017901178) },
+        { UINT32_C(4239142325), UINT32_C(4239142325) },
+        { UINT32_C(  40929593), UINT32_C(  40929593) },
+        { UINT32_C(3008962280), UINT32_C(3008962280) } } },
+    { { UINT32_C(2188211872), UINT32_C(1371496723), UINT32_C(3088940427), UINT32_C(1246083835) },
+      { { UINT32_C(2188211872), UINT32_C(2188211872) },
+        { UINT32_C(1371496723), UINT32_C(1371496723) },
+        { UINT32_C(3088940427), UINT32_C(3088940427) },
+        { UINT32_C(1246083835), UINT32_C(1246083835) } } },
+    { { UINT32_C(2979871896), UINT32_C( 846563826), UINT32_C( 583544358), UINT32_C(2400382789) },
+      { { UINT32_C(2979871896), UINT32_C(2979871896) },
+        { UINT32_C( 846563826), UINT32_C( 846563826) },
+        { UINT32_C( 583544358), UINT32_C( 583544358) },
+        { UINT32_C(2400382789), UINT32_C(2400382789) } } },
+    { { UINT32_C(2874580904), UINT32_C(1633824475), UINT32_C(3821116142), UINT32_C( 929977948) },
+      { { UINT32_C(2874580904), UINT32_C(2874580904) },
+        { UINT32_C(1633824475), UINT32_C(1633824475) },
+        { UINT32_C(3821116142), UINT32_C(3821116142) },
+        { UINT32_C( 929977948), UINT32_C( 929977948) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x4_t r = simde_vld4_dup_u32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[2], simde_vld1_u32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[3], simde_vld1_u32(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t buf[4];
+    uint64_t r[4][1];
+  } test_vec[] = {
+    { { UINT64_C(10581129520207363496), UINT64_C(  659921761868863411), UINT64_C(16458321349655341833), UINT64_C(15432062375860899799) },
+      { { UINT64_C(10581129520207363496) },
+        { UINT64_C(  659921761868863411) },
+        { UINT64_C(16458321349655341833) },
+        { UINT64_C(15432062375860899799) } } },
+    { { UINT64_C(14842120194415837874), UINT64_C( 1058628478510142996), UINT64_C(17086543526997886580), UINT64_C(12114585497829747560) },
+      { { UINT64_C(14842120194415837874) },
+        { UINT64_C( 1058628478510142996) },
+        { UINT64_C(17086543526997886580) },
+        { UINT64_C(12114585497829747560) } } },
+    { { UINT64_C(  100553450339000924), UINT64_C( 3336200381687850178), UINT64_C( 4405191455678749161), UINT64_C(17015249084863004060) },
+      { { UINT64_C(  100553450339000924) },
+        { UINT64_C( 3336200381687850178) },
+        { UINT64_C( 4405191455678749161) },
+        { UINT64_C(17015249084863004060) } } },
+    { { UINT64_C( 3453214770991576877), UINT64_C(13186646763603886607), UINT64_C(14561058637478505821), UINT64_C(12834737436504155281) },
+      { { UINT64_C( 3453214770991576877) },
+        { UINT64_C(13186646763603886607) },
+        { UINT64_C(14561058637478505821) },
+        { UINT64_C(12834737436504155281) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x4_t r = simde_vld4_dup_u64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[2], simde_vld1_u64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[3], simde_vld1_u64(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t buf[4];
+    simde_float32_t r[4][4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -243.45), SIMDE_FLOAT32_C(    57.00), SIMDE_FLOAT32_C(  -397.76), SIMDE_FLOAT32_C(   551.69) },
+      { { SIMDE_FLOAT32_C(  -243.45), SIMDE_FLOAT32_C(  -243.45), SIMDE_FLOAT32_C(  -243.45), SIMDE_FLOAT32_C(  -243.45) },
+        { SIMDE_FLOAT32_C(    57.00), SIMDE_FLOAT32_C(    57.00), SIMDE_FLOAT32_C(    57.00), SIMDE_FLOAT32_C(    57.00) },
+        { SIMDE_FLOAT32_C(  -397.76), SIMDE_FLOAT32_C(  -397.76), SIMDE_FLOAT32_C(  -397.76), SIMDE_FLOAT32_C(  -397.76) },
+        { SIMDE_FLOAT32_C(   551.69), SIMDE_FLOAT32_C(   551.69), SIMDE_FLOAT32_C(   551.69), SIMDE_FLOAT32_C(   551.69) } } },
+    { { SIMDE_FLOAT32_C(   929.03), SIMDE_FLOAT32_C(   630.48), SIMDE_FLOAT32_C(   447.47), SIMDE_FLOAT32_C(   643.70) },
+      { { SIMDE_FLOAT32_C(   929.03), SIMDE_FLOAT32_C(   929.03), SIMDE_FLOAT32_C(   929.03), SIMDE_FLOAT32_C(   929.03) },
+        { SIMDE_FLOAT32_C(   630.48), SIMDE_FLOAT32_C(   630.48), SIMDE_FLOAT32_C(   630.48), SIMDE_FLOAT32_C(   630.48) },
+        { SIMDE_FLOAT32_C(   447.47), SIMDE_FLOAT32_C(   447.47), SIMDE_FLOAT32_C(   447.47), SIMDE_FLOAT32_C(   447.47) },
+        { SIMDE_FLOAT32_C(   643.70), SIMDE_FLOAT32_C(   643.70), SIMDE_FLOAT32_C(   643.70), SIMDE_FLOAT32_C(   643.70) } } },
+    { { SIMDE_FLOAT32_C(    15.96), SIMDE_FLOAT32_C(   383.15), SIMDE_FLOAT32_C(   596.99), SIMDE_FLOAT32_C(  -243.48) },
+      { { SIMDE_FLOAT32_C(    15.96), SIMDE_FLOAT32_C(    15.96), SIMDE_FLOAT32_C(    15.96), SIMDE_FLOAT32_C(    15.96) },
+        { SIMDE_FLOAT32_C(   383.15), SIMDE_FLOAT32_C(   383.15), SIMDE_FLOAT32_C(   383.15), SIMDE_FLOAT32_C(   383.15) },
+        { SIMDE_FLOAT32_C(   596.99), SIMDE_FLOAT32_C(   596.99), SIMDE_FLOAT32_C(   596.99), SIMDE_FLOAT32_C(   596.99) },
+        { SIMDE_FLOAT32_C(  -243.48), SIMDE_FLOAT32_C(  -243.48), SIMDE_FLOAT32_C(  -243.48), SIMDE_FLOAT32_C(  -243.48) } } },
+    { { SIMDE_FLOAT32_C(   555.84), SIMDE_FLOAT32_C(    -5.21), SIMDE_FLOAT32_C(   467.71), SIMDE_FLOAT32_C(  -610.13) },
+      { { SIMDE_FLOAT32_C(   555.84), SIMDE_FLOAT32_C(   555.84), SIMDE_FLOAT32_C(   555.84), SIMDE_FLOAT32_C(   555.84) },
+        { SIMDE_FLOAT32_C(    -5.21), SIMDE_FLOAT32_C(    -5.21), SIMDE_FLOAT32_C(    -5.21), SIMDE_FLOAT32_C(    -5.21) },
+        { SIMDE_FLOAT32_C(   467.71), SIMDE_FLOAT32_C(   467.71), SIMDE_FLOAT32_C(   467.71), SIMDE_FLOAT32_C(   467.71) },
+        { SIMDE_FLOAT32_C(  -610.13), SIMDE_FLOAT32_C(  -610.13), SIMDE_FLOAT32_C(  -610.13), SIMDE_FLOAT32_C(  -610.13) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x4_t r = simde_vld4q_dup_f32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[2], simde_vld1q_f32(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[3], simde_vld1q_f32(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t buf[4];
+    simde_float64_t r[4][2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   474.75), SIMDE_FLOAT64_C(  -678.80), SIMDE_FLOAT64_C(  -581.66), SIMDE_FLOAT64_C(  -769.47) },
+      { { SIMDE_FLOAT64_C(   474.75), SIMDE_FLOAT64_C(   474.75) },
+        { SIMDE_FLOAT64_C(  -678.80), SIMDE_FLOAT64_C(  -678.80) },
+        { SIMDE_FLOAT64_C(  -581.66), SIMDE_FLOAT64_C(  -581.66) },
+        { SIMDE_FLOAT64_C(  -769.47), SIMDE_FLOAT64_C(  -769.47) } } },
+    { { SIMDE_FLOAT64_C(   286.33), SIMDE_FLOAT64_C(   600.90), SIMDE_FLOAT64_C(   346.79), SIMDE_FLOAT64_C(  -359.77) },
+      { { SIMDE_FLOAT64_C(   286.33), SIMDE_FLOAT64_C(   286.33) },
+        { SIMDE_FLOAT64_C(   600.90), SIMDE_FLOAT64_C(   600.90) },
+        { SIMDE_FLOAT64_C(   346.79), SIMDE_FLOAT64_C(   346.79) },
+        { SIMDE_FLOAT64_C(  -359.77), SIMDE_FLOAT64_C(  -359.77) } } },
+    { { SIMDE_FLOAT64_C(  -730.96), SIMDE_FLOAT64_C(  -287.56), SIMDE_FLOAT64_C(   515.28), SIMDE_FLOAT64_C(   738.56) },
+      { { SIMDE_FLOAT64_C(  -730.96), SIMDE_FLOAT64_C(  -730.96) },
+        { SIMDE_FLOAT64_C(  -287.56), SIMDE_FLOAT64_C(  -287.56) },
+        { SIMDE_FLOAT64_C(   515.28), SIMDE_FLOAT64_C(   515.28) },
+        { SIMDE_FLOAT64_C(   738.56), SIMDE_FLOAT64_C(   738.56) } } },
+    { { SIMDE_FLOAT64_C(  -815.93), SIMDE_FLOAT64_C(  -622.62), SIMDE_FLOAT64_C(    55.29), SIMDE_FLOAT64_C(   898.66) },
+      { { SIMDE_FLOAT64_C(  -815.93), SIMDE_FLOAT64_C(  -815.93) },
+        { SIMDE_FLOAT64_C(  -622.62), SIMDE_FLOAT64_C(  -622.62) },
+        { SIMDE_FLOAT64_C(    55.29), SIMDE_FLOAT64_C(    55.29) },
+        { SIMDE_FLOAT64_C(   898.66), SIMDE_FLOAT64_C(   898.66) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x4_t r = simde_vld4q_dup_f64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r[0]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r[1]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[2], simde_vld1q_f64(test_vec[i].r[2]), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[3], simde_vld1q_f64(test_vec[i].r[3]), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t buf[4];
+    int8_t r[4][16];
+  } test_vec[] = {
+    { {  INT8_C( 21), -INT8_C(  5), -INT8_C( 59),  INT8_C( 67) },
+      { {  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),
+           INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21),  INT8_C( 21) },
+        { -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5),
+          -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5), -INT8_C(  5) },
+        { -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59),
+          -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59), -INT8_C( 59) },
+        {  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),
+           INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67),  INT8_C( 67) } } },
+    { { -INT8_C( 23),  INT8_C( 17), -INT8_C(121), -INT8_C(  6) },
+      { { -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23),
+          -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23), -INT8_C( 23) },
+        {  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),
+           INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17),  INT8_C( 17) },
+        { -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121),
+          -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121), -INT8_C(121) },
+        { -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6),
+          -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6), -INT8_C(  6) } } },
+    { {  INT8_C(114),  INT8_C( 20), -INT8_C(  2), -INT8_C( 50) },
+      { {  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),
+           INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114),  INT8_C(114) },
+        {  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),
+           INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20),  INT8_C( 20) },
+        { -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2),
+          -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2), -INT8_C(  2) },
+        { -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50),
+          -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50), -INT8_C( 50) } } },
+    { {  INT8_C( 13),  INT8_C( 66), -INT8_C( 58),  INT8_C( 39) },
+      { {  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),
+           INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13),  INT8_C( 13) },
+        {  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),
+           INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66),  INT8_C( 66) },
+        { -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58),
+          -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58), -INT8_C( 58) },
+        {  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),
+           INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39),  INT8_C( 39) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x4_t r = simde_vld4q_dup_s8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[2], simde_vld1q_s8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[3], simde_vld1q_s8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t buf[4];
+    int16_t r[4][8];
+  } test_vec[] = {
+    { {  INT16_C( 8836),  INT16_C(28588), -INT16_C( 2490), -INT16_C( 9696) },
+      { {  INT16_C( 8836),  INT16_C( 8836),  INT16_C( 8836),  INT16_C( 8836),  INT16_C( 8836),  INT16_C( 8836),  INT16_C( 8836),  INT16_C( 8836) },
+        {  INT16_C(28588),  INT16_C(28588),  INT16_C(28588),  INT16_C(28588),  INT16_C(28588),  INT16_C(28588),  INT16_C(28588),  INT16_C(28588) },
+        { -INT16_C( 2490), -INT16_C( 2490), -INT16_C( 2490), -INT16_C( 2490), -INT16_C( 2490), -INT16_C( 2490), -INT16_C( 2490), -INT16_C( 2490) },
+        { -INT16_C( 9696), -INT16_C( 9696), -INT16_C( 9696), -INT16_C( 9696), -INT16_C( 9696), -INT16_C( 9696), -INT16_C( 9696), -INT16_C( 9696) } } },
+    { { -INT16_C(10453), -INT16_C( 9100),  INT16_C(11023),  INT16_C(24005) },
+      { { -INT16_C(10453), -INT16_C(10453), -INT16_C(10453), -INT16_C(10453), -INT16_C(10453), -INT16_C(10453), -INT16_C(10453), -INT16_C(10453) },
+        { -INT16_C( 9100), -INT16_C( 9100), -INT16_C( 9100), -INT16_C( 9100), -INT16_C( 9100), -INT16_C( 9100), -INT16_C( 9100), -INT16_C( 9100) },
+        {  INT16_C(11023),  INT16_C(11023),  INT16_C(11023),  INT16_C(11023),  INT16_C(11023),  INT16_C(11023),  INT16_C(11023),  INT16_C(11023) },
+        {  INT16_C(24005),  INT16_C(24005),  INT16_C(24005),  INT16_C(24005),  INT16_C(24005),  INT16_C(24005),  INT16_C(24005),  INT16_C(24005) } } },
+    { {  INT16_C(12382), -INT16_C(30483), -INT16_C( 7631), -INT16_C(21760) },
+      { {  INT16_C(12382),  INT16_C(12382),  INT16_C(12382),  INT16_C(12382),  INT16_C(12382),  INT16_C(12382),  INT16_C(12382),  INT16_C(12382) },
+        { -INT16_C(30483), -INT16_C(30483), -INT16_C(30483), -INT16_C(30483), -INT16_C(30483), -INT16_C(30483), -INT16_C(30483), -INT16_C(30483) },
+        { -INT16_C( 7631), -INT16_C( 7631), -INT16_C( 7631), -INT16_C( 7631), -INT16_C( 7631), -INT16_C( 7631), -INT16_C( 7631), -INT16_C( 7631) },
+        { -INT16_C(21760), -INT16_C(21760), -INT16_C(21760), -INT16_C(21760), -INT16_C(21760), -INT16_C(21760), -INT16_C(21760), -INT16_C(21760) } } },
+    { { -INT16_C(31262), -INT16_C( 2120), -INT16_C(32284),  INT16_C(19267) },
+      { { -INT16_C(31262), -INT16_C(31262), -INT16_C(31262), -INT16_C(31262), -INT16_C(31262), -INT16_C(31262), -INT16_C(31262), -INT16_C(31262) },
+        { -INT16_C( 2120), -INT16_C( 2120), -INT16_C( 2120), -INT16_C( 2120), -INT16_C( 2120), -INT16_C( 2120), -INT16_C( 2120), -INT16_C( 2120) },
+        { -INT16_C(32284), -INT16_C(32284), -INT16_C(32284), -INT16_C(32284), -INT16_C(32284), -INT16_C(32284), -INT16_C(32284), -INT16_C(32284) },
+        {  INT16_C(19267),  INT16_C(19267),  INT16_C(19267),  INT16_C(19267),  INT16_C(19267),  INT16_C(19267),  INT16_C(19267),  INT16_C(19267) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x4_t r = simde_vld4q_dup_s16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[2], simde_vld1q_s16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[3], simde_vld1q_s16(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t buf[4];
+    int32_t r[4][4];
+  } test_vec[] = {
+    { { -INT32_C( 352451762),  INT32_C( 119061765),  INT32_C( 669900779), -INT32_C(1913598120) },
+      { { -INT32_C( 352451762), -INT32_C( 352451762), -INT32_C( 352451762), -INT32_C( 352451762) },
+        {  INT32_C( 119061765),  INT32_C( 119061765),  INT32_C( 119061765),  INT32_C( 119061765) },
+        {  INT32_C( 669900779),  INT32_C( 669900779),  INT32_C( 669900779),  INT32_C( 669900779) },
+        { -INT32_C(1913598120), -INT32_C(1913598120), -INT32_C(1913598120), -INT32_C(1913598120) } } },
+    { { -INT32_C(1169927764), -INT32_C(1139064210),  INT32_C( 920580049), -INT32_C(1043828863) },
+      { { -INT32_C(1169927764), -INT32_C(1169927764), -INT32_C(1169927764), -INT32_C(1169927764) },
+        { -INT32_C(1139064210), -INT32_C(1139064210), -INT32_C(1139064210), -INT32_C(1139064210) },
+        {  INT32_C( 920580049),  INT32_C( 920580049),  INT32_C( 920580049),  INT32_C( 920580049) },
+        { -INT32_C(1043828863), -INT32_C(1043828863), -INT32_C(1043828863), -INT32_C(1043828863) } } },
+    { {  INT32_C( 386599041),  INT32_C(1424081029),  INT32_C(  95613922), -INT32_C(1199562103) },
+      { {  INT32_C( 386599041),  INT32_C( 386599041),  INT32_C( 386599041),  INT32_C( 386599041) },
+        {  INT32_C(1424081029),  INT32_C(1424081029),  INT32_C(1424081029),  INT32_C(1424081029) },
+        {  INT32_C(  95613922),  INT32_C(  95613922),  INT32_C(  95613922),  INT32_C(  95613922) },
+        { -INT32_C(1199562103), -INT32_C(1199562103), -INT32_C(1199562103), -INT32_C(1199562103) } } },
+    { {  INT32_C(1044511287),  INT32_C(1992014079), -INT32_C(  27760781), -INT32_C( 975634415) },
+      { {  INT32_C(1044511287),  INT32_C(1044511287),  INT32_C(1044511287),  INT32_C(1044511287) },
+        {  INT32_C(1992014079),  INT32_C(1992014079),  INT32_C(1992014079),  INT32_C(1992014079) },
+        { -INT32_C(  27760781), -INT32_C(  27760781), -INT32_C(  27760781), -INT32_C(  27760781) },
+        { -INT32_C( 975634415), -INT32_C( 975634415), -INT32_C( 975634415), -INT32_C( 975634415) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x4_t r = simde_vld4q_dup_s32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[2], simde_vld1q_s32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[3], simde_vld1q_s32(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t buf[4];
+    int64_t r[4][2];
+  } test_vec[] = {
+    { { -INT64_C(5949572136380279104),  INT64_C(6950641500608925367), -INT64_C(9088236148897745003),  INT64_C(7912137367516896307) },
+      { { -INT64_C(5949572136380279104), -INT64_C(5949572136380279104) },
+        {  INT64_C(6950641500608925367),  INT64_C(6950641500608925367) },
+        { -INT64_C(9088236148897745003), -INT64_C(9088236148897745003) },
+        {  INT64_C(7912137367516896307),  INT64_C(7912137367516896307) } } },
+    { {  INT64_C(8138578436586169358),  INT64_C( 515420737028045013),  INT64_C(1963551463117670098),  INT64_C(2931425102959711894) },
+      { {  INT64_C(8138578436586169358),  INT64_C(8138578436586169358) },
+        {  INT64_C( 515420737028045013),  INT64_C( 515420737028045013) },
+        {  INT64_C(1963551463117670098),  INT64_C(1963551463117670098) },
+        {  INT64_C(2931425102959711894),  INT64_C(2931425102959711894) } } },
+    { {  INT64_C(4660213500874736294),  INT64_C(3530998732139289753),  INT64_C(8685734040734562993),  INT64_C(2491988876186912354) },
+      { {  INT64_C(4660213500874736294),  INT64_C(4660213500874736294) },
+        {  INT64_C(3530998732139289753),  INT64_C(3530998732139289753) },
+        {  INT64_C(8685734040734562993),  INT64_C(8685734040734562993) },
+        {  INT64_C(2491988876186912354),  INT64_C(2491988876186912354) } } },
+    { {  INT64_C(8246982405827887329), -INT64_C(7519497347548167148),  INT64_C(3230038816327024479), -INT64_C( 297343382407893113) },
+      { {  INT64_C(8246982405827887329),  INT64_C(8246982405827887329) },
+        { -INT64_C(7519497347548167148), -INT64_C(7519497347548167148) },
+        {  INT64_C(3230038816327024479),  INT64_C(3230038816327024479) },
+        { -INT64_C( 297343382407893113), -INT64_C( 297343382407893113) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x4_t r = simde_vld4q_dup_s64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[2], simde_vld1q_s64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[3], simde_vld1q_s64(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t buf[4];
+    uint8_t r[4][16];
+  } test_vec[] = {
+    { { UINT8_C( 80), UINT8_C(178), UINT8_C(191), UINT8_C(136) },
+      { { UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80),
+          UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80), UINT8_C( 80) },
+        { UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178),
+          UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178), UINT8_C(178) },
+        { UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191),
+          UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191), UINT8_C(191) },
+        { UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136),
+          UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136) } } },
+    { { UINT8_C(  8), UINT8_C(197), UINT8_C( 41), UINT8_C(  8) },
+      { { UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8),
+          UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8) },
+        { UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197),
+          UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197), UINT8_C(197) },
+        { UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41),
+          UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41), UINT8_C( 41) },
+        { UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8),
+          UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8), UINT8_C(  8) } } },
+    { { UINT8_C(125), UINT8_C( 81), UINT8_C(194), UINT8_C(118) },
+      { { UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125),
+          UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125), UINT8_C(125) },
+        { UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81),
+          UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81), UINT8_C( 81) },
+        { UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194),
+          UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194) },
+        { UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118),
+          UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118), UINT8_C(118) } } },
+    { { UINT8_C(222), UINT8_C(237), UINT8_C( 64), UINT8_C( 72) },
+      { { UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222),
+          UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222), UINT8_C(222) },
+        { UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237),
+          UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237), UINT8_C(237) },
+        { UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64),
+          UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64), UINT8_C( 64) },
+        { UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72),
+          UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72), UINT8_C( 72) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x4_t r = simde_vld4q_dup_u8(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[2], simde_vld1q_u8(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[3], simde_vld1q_u8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t buf[4];
+    uint16_t r[4][8];
+  } test_vec[] = {
+    { { UINT16_C(45497), UINT16_C(49535), UINT16_C(11829), UINT16_C(31349) },
+      { { UINT16_C(45497), UINT16_C(45497), UINT16_C(45497), UINT16_C(45497), UINT16_C(45497), UINT16_C(45497), UINT16_C(45497), UINT16_C(45497) },
+        { UINT16_C(49535), UINT16_C(49535), UINT16_C(49535), UINT16_C(49535), UINT16_C(49535), UINT16_C(49535), UINT16_C(49535), UINT16_C(49535) },
+        { UINT16_C(11829), UINT16_C(11829), UINT16_C(11829), UINT16_C(11829), UINT16_C(11829), UINT16_C(11829), UINT16_C(11829), UINT16_C(11829) },
+        { UINT16_C(31349), UINT16_C(31349), UINT16_C(31349), UINT16_C(31349), UINT16_C(31349), UINT16_C(31349), UINT16_C(31349), UINT16_C(31349) } } },
+    { { UINT16_C(63499), UINT16_C(56602), UINT16_C( 4116), UINT16_C(18860) },
+      { { UINT16_C(63499), UINT16_C(63499), UINT16_C(63499), UINT16_C(63499), UINT16_C(63499), UINT16_C(63499), UINT16_C(63499), UINT16_C(63499) },
+        { UINT16_C(56602), UINT16_C(56602), UINT16_C(56602), UINT16_C(56602), UINT16_C(56602), UINT16_C(56602), UINT16_C(56602), UINT16_C(56602) },
+        { UINT16_C( 4116), UINT16_C( 4116), UINT16_C( 4116), UINT16_C( 4116), UINT16_C( 4116), UINT16_C( 4116), UINT16_C( 4116), UINT16_C( 4116) },
+        { UINT16_C(18860), UINT16_C(18860), UINT16_C(18860), UINT16_C(18860), UINT16_C(18860), UINT16_C(18860), UINT16_C(18860), UINT16_C(18860) } } },
+    { { UINT16_C(62918), UINT16_C(56880), UINT16_C(53602), UINT16_C( 2732) },
+      { { UINT16_C(62918), UINT16_C(62918), UINT16_C(62918), UINT16_C(62918), UINT16_C(62918), UINT16_C(62918), UINT16_C(62918), UINT16_C(62918) },
+        { UINT16_C(56880), UINT16_C(56880), UINT16_C(56880), UINT16_C(56880), UINT16_C(56880), UINT16_C(56880), UINT16_C(56880), UINT16_C(56880) },
+        { UINT16_C(53602), UINT16_C(53602), UINT16_C(53602), UINT16_C(53602), UINT16_C(53602), UINT16_C(53602), UINT16_C(53602), UINT16_C(53602) },
+        { UINT16_C( 2732), UINT16_C( 2732), UINT16_C( 2732), UINT16_C( 2732), UINT16_C( 2732), UINT16_C( 2732), UINT16_C( 2732), UINT16_C( 2732) } } },
+    { { UINT16_C(16126), UINT16_C(24211), UINT16_C(42023), UINT16_C(44647) },
+      { { UINT16_C(16126), UINT16_C(16126), UINT16_C(16126), UINT16_C(16126), UINT16_C(16126), UINT16_C(16126), UINT16_C(16126), UINT16_C(16126) },
+        { UINT16_C(24211), UINT16_C(24211), UINT16_C(24211), UINT16_C(24211), UINT16_C(24211), UINT16_C(24211), UINT16_C(24211), UINT16_C(24211) },
+        { UINT16_C(42023), UINT16_C(42023), UINT16_C(42023), UINT16_C(42023), UINT16_C(42023), UINT16_C(42023), UINT16_C(42023), UINT16_C(42023) },
+        { UINT16_C(44647), UINT16_C(44647), UINT16_C(44647), UINT16_C(44647), UINT16_C(44647), UINT16_C(44647), UINT16_C(44647), UINT16_C(44647) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x4_t r = simde_vld4q_dup_u16(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[2], simde_vld1q_u16(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[3], simde_vld1q_u16(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t buf[4];
+    uint32_t r[4][4];
+  } test_vec[] = {
+    { { UINT32_C( 315583497), UINT32_C(3338863974), UINT32_C(3313162503), UINT32_C(3394431544) },
+      { { UINT32_C( 315583497), UINT32_C( 315583497), UINT32_C( 315583497), UINT32_C( 315583497) },
+        { UINT32_C(3338863974), UINT32_C(3338863974), UINT32_C(3338863974), UINT32_C(3338863974) },
+        { UINT32_C(3313162503), UINT32_C(3313162503), UINT32_C(3313162503), UINT32_C(3313162503) },
+        { UINT32_C(3394431544), UINT32_C(3394431544), UINT32_C(3394431544), UINT32_C(3394431544) } } },
+    { { UINT32_C(2930039485), UINT32_C(   4734743), UINT32_C(2799150044), UINT32_C(1704341069) },
+      { { UINT32_C(2930039485), UINT32_C(2930039485), UINT32_C(2930039485), UINT32_C(2930039485) },
+        { UINT32_C(   4734743), UINT32_C(   4734743), UINT32_C(   4734743), UINT32_C(   4734743) },
+        { UINT32_C(2799150044), UINT32_C(2799150044), UINT32_C(2799150044), UINT32_C(2799150044) },
+        { UINT32_C(1704341069), UINT32_C(1704341069), UINT32_C(1704341069), UINT32_C(1704341069) } } },
+    { { UINT32_C(1384126268), UINT32_C( 923500552), UINT32_C( 705633259), UINT32_C(4027064837) },
+      { { UINT32_C(1384126268), UINT32_C(1384126268), UINT32_C(1384126268), UINT32_C(1384126268) },
+        { UINT32_C( 923500552), UINT32_C( 923500552), UINT32_C( 923500552), UINT32_C( 923500552) },
+        { UINT32_C( 705633259), UINT32_C( 705633259), UINT32_C( 705633259), UINT32_C( 705633259) },
+        { UINT32_C(4027064837), UINT32_C(4027064837), UINT32_C(4027064837), UINT32_C(4027064837) } } },
+    { { UINT32_C(2247153421), UINT32_C( 730221602), UINT32_C(1345279587), UINT32_C( 465182626) },
+      { { UINT32_C(2247153421), UINT32_C(2247153421), UINT32_C(2247153421), UINT32_C(2247153421) },
+        { UINT32_C( 730221602), UINT32_C( 730221602), UINT32_C( 730221602), UINT32_C( 730221602) },
+        { UINT32_C(1345279587), UINT32_C(1345279587), UINT32_C(1345279587), UINT32_C(1345279587) },
+        { UINT32_C( 465182626), UINT32_C( 465182626), UINT32_C( 465182626), UINT32_C( 465182626) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x4_t r = simde_vld4q_dup_u32(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[2], simde_vld1q_u32(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[3], simde_vld1q_u32(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld4q_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t buf[4];
+    uint64_t r[4][2];
+  } test_vec[] = {
+    { { UINT64_C( 1862588618999110499), UINT64_C( 8672274322810537792), UINT64_C( 2493368189757576404), UINT64_C(   30499311626905813) },
+      { { UINT64_C( 1862588618999110499), UINT64_C( 1862588618999110499) },
+        { UINT64_C( 8672274322810537792), UINT64_C( 8672274322810537792) },
+        { UINT64_C( 2493368189757576404), UINT64_C( 2493368189757576404) },
+        { UINT64_C(   30499311626905813), UINT64_C(   30499311626905813) } } },
+    { { UINT64_C( 1028396504590390232), UINT64_C( 6944948567710330541), UINT64_C( 4736877867490464656), UINT64_C( 9697339963903167273) },
+      { { UINT64_C( 1028396504590390232), UINT64_C( 1028396504590390232) },
+        { UINT64_C( 6944948567710330541), UINT64_C( 6944948567710330541) },
+        { UINT64_C( 4736877867490464656), UINT64_C( 4736877867490464656) },
+        { UINT64_C( 9697339963903167273), UINT64_C( 9697339963903167273) } } },
+    { { UINT64_C(14614952003226382842), UINT64_C( 6236003713391244928), UINT64_C(10324364301982103978), UINT64_C( 6306806043847387428) },
+      { { UINT64_C(14614952003226382842), UINT64_C(14614952003226382842) },
+        { UINT64_C( 6236003713391244928), UINT64_C( 6236003713391244928) },
+        { UINT64_C(10324364301982103978), UINT64_C(10324364301982103978) },
+        { UINT64_C( 6306806043847387428), UINT64_C( 6306806043847387428) } } },
+    { { UINT64_C(  489713739810293335), UINT64_C( 4509294685247594671), UINT64_C( 6348514630834110115), UINT64_C( 2742650427314142392) },
+      { { UINT64_C(  489713739810293335), UINT64_C(  489713739810293335) },
+        { UINT64_C( 4509294685247594671), UINT64_C( 4509294685247594671) },
+        { UINT64_C( 6348514630834110115), UINT64_C( 6348514630834110115) },
+        { UINT64_C( 2742650427314142392), UINT64_C( 2742650427314142392) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x4_t r = simde_vld4q_dup_u64(test_vec[i].buf);
+
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r[0]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r[1]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[2], simde_vld1q_u64(test_vec[i].r[2]));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[3], simde_vld1q_u64(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4_dup_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vld4q_dup_u64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
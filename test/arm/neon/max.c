@@ -3,6 +3,108 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/max.h"
 
+static int
+test_simde_vmaxh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {                SIMDE_NANHF,
+      SIMDE_FLOAT16_VALUE(     1.00),
+                     SIMDE_NANHF },
+    { SIMDE_FLOAT16_VALUE(    -2.50),
+                     SIMDE_NANHF,
+                     SIMDE_NANHF },
+    #endif
+    { SIMDE_FLOAT16_VALUE(  -264.00),
+      SIMDE_FLOAT16_VALUE(  -846.50),
+      SIMDE_FLOAT16_VALUE(  -264.00) },
+    { SIMDE_FLOAT16_VALUE(   182.88),
+      SIMDE_FLOAT16_VALUE(   288.00),
+      SIMDE_FLOAT16_VALUE(   288.00) },
+    { SIMDE_FLOAT16_VALUE(  -555.00),
+      SIMDE_FLOAT16_VALUE(   819.00),
+      SIMDE_FLOAT16_VALUE(   819.00) },
+    { SIMDE_FLOAT16_VALUE(  -257.50),
+      SIMDE_FLOAT16_VALUE(   448.75),
+      SIMDE_FLOAT16_VALUE(   448.75) },
+    { SIMDE_FLOAT16_VALUE(   435.00),
+      SIMDE_FLOAT16_VALUE(  -217.50),
+      SIMDE_FLOAT16_VALUE(   435.00) },
+    { SIMDE_FLOAT16_VALUE(   912.50),
+      SIMDE_FLOAT16_VALUE(   739.50),
+      SIMDE_FLOAT16_VALUE(   912.50) },
+    { SIMDE_FLOAT16_VALUE(  -343.75),
+      SIMDE_FLOAT16_VALUE(  -712.00),
+      SIMDE_FLOAT16_VALUE(  -343.75) },
+    { SIMDE_FLOAT16_VALUE(  -840.00),
+      SIMDE_FLOAT16_VALUE(   842.50),
+      SIMDE_FLOAT16_VALUE(   842.50) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vmaxh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vmax_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   812.00), SIMDE_FLOAT16_VALUE(  -805.00), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(  -384.50), SIMDE_FLOAT16_VALUE(  -792.00),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   812.00), SIMDE_FLOAT16_VALUE(  -792.00),                SIMDE_NANHF } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(   -74.12), SIMDE_FLOAT16_VALUE(  -749.00),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -702.50), SIMDE_FLOAT16_VALUE(   252.50), SIMDE_FLOAT16_VALUE(    -2.50) },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -74.12), SIMDE_FLOAT16_VALUE(   252.50),                SIMDE_NANHF } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(  -892.50), SIMDE_FLOAT16_VALUE(  -946.50), SIMDE_FLOAT16_VALUE(   576.00), SIMDE_FLOAT16_VALUE(   554.50) },
+      { SIMDE_FLOAT16_VALUE(  -535.00), SIMDE_FLOAT16_VALUE(   247.75), SIMDE_FLOAT16_VALUE(   -64.25), SIMDE_FLOAT16_VALUE(   544.00) },
+      { SIMDE_FLOAT16_VALUE(  -535.00), SIMDE_FLOAT16_VALUE(   247.75), SIMDE_FLOAT16_VALUE(   576.00), SIMDE_FLOAT16_VALUE(   554.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -843.50), SIMDE_FLOAT16_VALUE(   -35.12), SIMDE_FLOAT16_VALUE(   184.12), SIMDE_FLOAT16_VALUE(  -800.50) },
+      { SIMDE_FLOAT16_VALUE(  -580.00), SIMDE_FLOAT16_VALUE(    55.22), SIMDE_FLOAT16_VALUE(  -741.00), SIMDE_FLOAT16_VALUE(  -754.50) },
+      { SIMDE_FLOAT16_VALUE(  -580.00), SIMDE_FLOAT16_VALUE(    55.22), SIMDE_FLOAT16_VALUE(   184.12), SIMDE_FLOAT16_VALUE(  -754.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -787.00), SIMDE_FLOAT16_VALUE(  -666.00), SIMDE_FLOAT16_VALUE(  -369.00), SIMDE_FLOAT16_VALUE(   518.00) },
+      { SIMDE_FLOAT16_VALUE(  -963.00), SIMDE_FLOAT16_VALUE(  -735.50), SIMDE_FLOAT16_VALUE(  -351.25), SIMDE_FLOAT16_VALUE(   633.00) },
+      { SIMDE_FLOAT16_VALUE(  -787.00), SIMDE_FLOAT16_VALUE(  -666.00), SIMDE_FLOAT16_VALUE(  -351.25), SIMDE_FLOAT16_VALUE(   633.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -14.03), SIMDE_FLOAT16_VALUE(   552.00), SIMDE_FLOAT16_VALUE(  -177.38), SIMDE_FLOAT16_VALUE(   809.50) },
+      { SIMDE_FLOAT16_VALUE(  -846.00), SIMDE_FLOAT16_VALUE(  -119.38), SIMDE_FLOAT16_VALUE(  -946.50), SIMDE_FLOAT16_VALUE(   547.00) },
+      { SIMDE_FLOAT16_VALUE(   -14.03), SIMDE_FLOAT16_VALUE(   552.00), SIMDE_FLOAT16_VALUE(  -177.38), SIMDE_FLOAT16_VALUE(   809.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -67.38), SIMDE_FLOAT16_VALUE(  -327.00), SIMDE_FLOAT16_VALUE(  -398.25), SIMDE_FLOAT16_VALUE(  -966.50) },
+      { SIMDE_FLOAT16_VALUE(   986.50), SIMDE_FLOAT16_VALUE(   364.75), SIMDE_FLOAT16_VALUE(   504.25), SIMDE_FLOAT16_VALUE(   130.50) },
+      { SIMDE_FLOAT16_VALUE(   986.50), SIMDE_FLOAT16_VALUE(   364.75), SIMDE_FLOAT16_VALUE(   504.25), SIMDE_FLOAT16_VALUE(   130.50) } },
+    { { SIMDE_FLOAT16_VALUE(   682.00), SIMDE_FLOAT16_VALUE(  -869.00), SIMDE_FLOAT16_VALUE(  -352.00), SIMDE_FLOAT16_VALUE(   100.44) },
+      { SIMDE_FLOAT16_VALUE(  -895.50), SIMDE_FLOAT16_VALUE(  -136.12), SIMDE_FLOAT16_VALUE(   174.50), SIMDE_FLOAT16_VALUE(  -673.50) },
+      { SIMDE_FLOAT16_VALUE(   682.00), SIMDE_FLOAT16_VALUE(  -136.12), SIMDE_FLOAT16_VALUE(   174.50), SIMDE_FLOAT16_VALUE(   100.44) } },
+    { { SIMDE_FLOAT16_VALUE(   264.75), SIMDE_FLOAT16_VALUE(    86.31), SIMDE_FLOAT16_VALUE(   367.00), SIMDE_FLOAT16_VALUE(  -651.00) },
+      { SIMDE_FLOAT16_VALUE(  -322.75), SIMDE_FLOAT16_VALUE(  -214.88), SIMDE_FLOAT16_VALUE(   869.50), SIMDE_FLOAT16_VALUE(  -180.38) },
+      { SIMDE_FLOAT16_VALUE(   264.75), SIMDE_FLOAT16_VALUE(    86.31), SIMDE_FLOAT16_VALUE(   869.50), SIMDE_FLOAT16_VALUE(  -180.38) } },
+    { { SIMDE_FLOAT16_VALUE(   996.00), SIMDE_FLOAT16_VALUE(  -225.00), SIMDE_FLOAT16_VALUE(  -276.25), SIMDE_FLOAT16_VALUE(   893.00) },
+      { SIMDE_FLOAT16_VALUE(  -797.50), SIMDE_FLOAT16_VALUE(  -704.50), SIMDE_FLOAT16_VALUE(  -483.75), SIMDE_FLOAT16_VALUE(  -853.00) },
+      { SIMDE_FLOAT16_VALUE(   996.00), SIMDE_FLOAT16_VALUE(  -225.00), SIMDE_FLOAT16_VALUE(  -276.25), SIMDE_FLOAT16_VALUE(   893.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vmax_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vmax_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -506,6 +608,88 @@ test_simde_x_vmax_u64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vmaxq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   264.25), SIMDE_FLOAT16_VALUE(   -25.31), SIMDE_FLOAT16_VALUE(   -90.69),
+          SIMDE_FLOAT16_VALUE(  -215.38), SIMDE_FLOAT16_VALUE(   352.00), SIMDE_FLOAT16_VALUE(  -533.50), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(  -647.50), SIMDE_FLOAT16_VALUE(    85.31), SIMDE_FLOAT16_VALUE(  -958.50),
+          SIMDE_FLOAT16_VALUE(   -31.03), SIMDE_FLOAT16_VALUE(   370.50), SIMDE_FLOAT16_VALUE(   258.50),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   264.25), SIMDE_FLOAT16_VALUE(    85.31), SIMDE_FLOAT16_VALUE(   -90.69),
+          SIMDE_FLOAT16_VALUE(   -31.03), SIMDE_FLOAT16_VALUE(   370.50), SIMDE_FLOAT16_VALUE(   258.50),                SIMDE_NANHF } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(  -694.50), SIMDE_FLOAT16_VALUE(  -478.75), SIMDE_FLOAT16_VALUE(  -989.00),
+          SIMDE_FLOAT16_VALUE(  -659.50), SIMDE_FLOAT16_VALUE(  -962.00), SIMDE_FLOAT16_VALUE(   583.00),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -844.00), SIMDE_FLOAT16_VALUE(     0.20), SIMDE_FLOAT16_VALUE(  -586.00),
+          SIMDE_FLOAT16_VALUE(   997.50), SIMDE_FLOAT16_VALUE(   900.00), SIMDE_FLOAT16_VALUE(   390.00), SIMDE_FLOAT16_VALUE(    -2.50) },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -694.50), SIMDE_FLOAT16_VALUE(     0.20), SIMDE_FLOAT16_VALUE(  -586.00),
+          SIMDE_FLOAT16_VALUE(   997.50), SIMDE_FLOAT16_VALUE(   900.00), SIMDE_FLOAT16_VALUE(   583.00),                SIMDE_NANHF } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(   801.00), SIMDE_FLOAT16_VALUE(   372.00), SIMDE_FLOAT16_VALUE(   323.75), SIMDE_FLOAT16_VALUE(  -714.00),
+          SIMDE_FLOAT16_VALUE(  -702.50), SIMDE_FLOAT16_VALUE(  -737.00), SIMDE_FLOAT16_VALUE(  -277.75), SIMDE_FLOAT16_VALUE(   743.50) },
+      { SIMDE_FLOAT16_VALUE(    -0.51), SIMDE_FLOAT16_VALUE(  -666.00), SIMDE_FLOAT16_VALUE(   422.50), SIMDE_FLOAT16_VALUE(   609.00),
+          SIMDE_FLOAT16_VALUE(  -440.25), SIMDE_FLOAT16_VALUE(   793.50), SIMDE_FLOAT16_VALUE(   722.00), SIMDE_FLOAT16_VALUE(  -398.50) },
+      { SIMDE_FLOAT16_VALUE(   801.00), SIMDE_FLOAT16_VALUE(   372.00), SIMDE_FLOAT16_VALUE(   422.50), SIMDE_FLOAT16_VALUE(   609.00),
+          SIMDE_FLOAT16_VALUE(  -440.25), SIMDE_FLOAT16_VALUE(   793.50), SIMDE_FLOAT16_VALUE(   722.00), SIMDE_FLOAT16_VALUE(   743.50) } },
+    { { SIMDE_FLOAT16_VALUE(    -8.06), SIMDE_FLOAT16_VALUE(   -81.94), SIMDE_FLOAT16_VALUE(   831.50), SIMDE_FLOAT16_VALUE(  -721.00),
+          SIMDE_FLOAT16_VALUE(   -75.88), SIMDE_FLOAT16_VALUE(   384.00), SIMDE_FLOAT16_VALUE(  -385.00), SIMDE_FLOAT16_VALUE(   443.75) },
+      { SIMDE_FLOAT16_VALUE(  -846.50), SIMDE_FLOAT16_VALUE(   351.25), SIMDE_FLOAT16_VALUE(  -332.50), SIMDE_FLOAT16_VALUE(  -903.00),
+          SIMDE_FLOAT16_VALUE(   924.50), SIMDE_FLOAT16_VALUE(  -556.00), SIMDE_FLOAT16_VALUE(  -759.00), SIMDE_FLOAT16_VALUE(   861.50) },
+      { SIMDE_FLOAT16_VALUE(    -8.06), SIMDE_FLOAT16_VALUE(   351.25), SIMDE_FLOAT16_VALUE(   831.50), SIMDE_FLOAT16_VALUE(  -721.00),
+          SIMDE_FLOAT16_VALUE(   924.50), SIMDE_FLOAT16_VALUE(   384.00), SIMDE_FLOAT16_VALUE(  -385.00), SIMDE_FLOAT16_VALUE(   861.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -777.00), SIMDE_FLOAT16_VALUE(  -640.00), SIMDE_FLOAT16_VALUE(  -935.50), SIMDE_FLOAT16_VALUE(   280.50),
+          SIMDE_FLOAT16_VALUE(  -648.00), SIMDE_FLOAT16_VALUE(   915.50), SIMDE_FLOAT16_VALUE(   100.75), SIMDE_FLOAT16_VALUE(   524.00) },
+      { SIMDE_FLOAT16_VALUE(  -169.62), SIMDE_FLOAT16_VALUE(  -752.50), SIMDE_FLOAT16_VALUE(   -40.94), SIMDE_FLOAT16_VALUE(  -474.75),
+          SIMDE_FLOAT16_VALUE(   869.00), SIMDE_FLOAT16_VALUE(   238.62), SIMDE_FLOAT16_VALUE(   861.50), SIMDE_FLOAT16_VALUE(  -255.62) },
+      { SIMDE_FLOAT16_VALUE(  -169.62), SIMDE_FLOAT16_VALUE(  -640.00), SIMDE_FLOAT16_VALUE(   -40.94), SIMDE_FLOAT16_VALUE(   280.50),
+          SIMDE_FLOAT16_VALUE(   869.00), SIMDE_FLOAT16_VALUE(   915.50), SIMDE_FLOAT16_VALUE(   861.50), SIMDE_FLOAT16_VALUE(   524.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -228.88), SIMDE_FLOAT16_VALUE(   -46.47), SIMDE_FLOAT16_VALUE(   125.94), SIMDE_FLOAT16_VALUE(  -598.00),
+          SIMDE_FLOAT16_VALUE(   296.50), SIMDE_FLOAT16_VALUE(   354.00), SIMDE_FLOAT16_VALUE(   785.50), SIMDE_FLOAT16_VALUE(   282.25) },
+      { SIMDE_FLOAT16_VALUE(   757.50), SIMDE_FLOAT16_VALUE(   239.12), SIMDE_FLOAT16_VALUE(   122.31), SIMDE_FLOAT16_VALUE(    -6.45),
+          SIMDE_FLOAT16_VALUE(    29.92), SIMDE_FLOAT16_VALUE(  -299.00), SIMDE_FLOAT16_VALUE(   223.75), SIMDE_FLOAT16_VALUE(  -123.50) },
+      { SIMDE_FLOAT16_VALUE(   757.50), SIMDE_FLOAT16_VALUE(   239.12), SIMDE_FLOAT16_VALUE(   125.94), SIMDE_FLOAT16_VALUE(    -6.45),
+          SIMDE_FLOAT16_VALUE(   296.50), SIMDE_FLOAT16_VALUE(   354.00), SIMDE_FLOAT16_VALUE(   785.50), SIMDE_FLOAT16_VALUE(   282.25) } },
+    { { SIMDE_FLOAT16_VALUE(   265.75), SIMDE_FLOAT16_VALUE(  -415.00), SIMDE_FLOAT16_VALUE(   449.25), SIMDE_FLOAT16_VALUE(  -821.00),
+          SIMDE_FLOAT16_VALUE(   -35.97), SIMDE_FLOAT16_VALUE(  -744.50), SIMDE_FLOAT16_VALUE(  -849.50), SIMDE_FLOAT16_VALUE(   702.50) },
+      { SIMDE_FLOAT16_VALUE(   737.00), SIMDE_FLOAT16_VALUE(  -382.50), SIMDE_FLOAT16_VALUE(  -351.50), SIMDE_FLOAT16_VALUE(  -241.88),
+          SIMDE_FLOAT16_VALUE(   873.00), SIMDE_FLOAT16_VALUE(   212.25), SIMDE_FLOAT16_VALUE(    31.31), SIMDE_FLOAT16_VALUE(   827.00) },
+      { SIMDE_FLOAT16_VALUE(   737.00), SIMDE_FLOAT16_VALUE(  -382.50), SIMDE_FLOAT16_VALUE(   449.25), SIMDE_FLOAT16_VALUE(  -241.88),
+          SIMDE_FLOAT16_VALUE(   873.00), SIMDE_FLOAT16_VALUE(   212.25), SIMDE_FLOAT16_VALUE(    31.31), SIMDE_FLOAT16_VALUE(   827.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -62.84), SIMDE_FLOAT16_VALUE(   706.50), SIMDE_FLOAT16_VALUE(  -144.00), SIMDE_FLOAT16_VALUE(   923.00),
+          SIMDE_FLOAT16_VALUE(  -235.88), SIMDE_FLOAT16_VALUE(  -977.00), SIMDE_FLOAT16_VALUE(   600.00), SIMDE_FLOAT16_VALUE(   719.50) },
+      { SIMDE_FLOAT16_VALUE(  -775.00), SIMDE_FLOAT16_VALUE(   476.75), SIMDE_FLOAT16_VALUE(   900.50), SIMDE_FLOAT16_VALUE(   211.12),
+          SIMDE_FLOAT16_VALUE(  -846.00), SIMDE_FLOAT16_VALUE(   813.50), SIMDE_FLOAT16_VALUE(  -934.00), SIMDE_FLOAT16_VALUE(   557.50) },
+      { SIMDE_FLOAT16_VALUE(   -62.84), SIMDE_FLOAT16_VALUE(   706.50), SIMDE_FLOAT16_VALUE(   900.50), SIMDE_FLOAT16_VALUE(   923.00),
+          SIMDE_FLOAT16_VALUE(  -235.88), SIMDE_FLOAT16_VALUE(   813.50), SIMDE_FLOAT16_VALUE(   600.00), SIMDE_FLOAT16_VALUE(   719.50) } },
+    { { SIMDE_FLOAT16_VALUE(   476.00), SIMDE_FLOAT16_VALUE(   595.00), SIMDE_FLOAT16_VALUE(  -595.00), SIMDE_FLOAT16_VALUE(  -595.50),
+          SIMDE_FLOAT16_VALUE(  -774.50), SIMDE_FLOAT16_VALUE(   671.00), SIMDE_FLOAT16_VALUE(  -218.00), SIMDE_FLOAT16_VALUE(   981.50) },
+      { SIMDE_FLOAT16_VALUE(   -42.50), SIMDE_FLOAT16_VALUE(    93.31), SIMDE_FLOAT16_VALUE(   486.50), SIMDE_FLOAT16_VALUE(   577.00),
+          SIMDE_FLOAT16_VALUE(  -458.25), SIMDE_FLOAT16_VALUE(     9.09), SIMDE_FLOAT16_VALUE(   178.62), SIMDE_FLOAT16_VALUE(  -322.25) },
+      { SIMDE_FLOAT16_VALUE(   476.00), SIMDE_FLOAT16_VALUE(   595.00), SIMDE_FLOAT16_VALUE(   486.50), SIMDE_FLOAT16_VALUE(   577.00),
+          SIMDE_FLOAT16_VALUE(  -458.25), SIMDE_FLOAT16_VALUE(   671.00), SIMDE_FLOAT16_VALUE(   178.62), SIMDE_FLOAT16_VALUE(   981.50) } },
+    { { SIMDE_FLOAT16_VALUE(   566.50), SIMDE_FLOAT16_VALUE(   463.25), SIMDE_FLOAT16_VALUE(   464.50), SIMDE_FLOAT16_VALUE(   917.00),
+          SIMDE_FLOAT16_VALUE(  -396.75), SIMDE_FLOAT16_VALUE(   102.12), SIMDE_FLOAT16_VALUE(  -866.50), SIMDE_FLOAT16_VALUE(    13.92) },
+      { SIMDE_FLOAT16_VALUE(   391.25), SIMDE_FLOAT16_VALUE(     2.44), SIMDE_FLOAT16_VALUE(   570.00), SIMDE_FLOAT16_VALUE(   -12.87),
+          SIMDE_FLOAT16_VALUE(   889.00), SIMDE_FLOAT16_VALUE(   836.50), SIMDE_FLOAT16_VALUE(  -121.25), SIMDE_FLOAT16_VALUE(   -33.62) },
+      { SIMDE_FLOAT16_VALUE(   566.50), SIMDE_FLOAT16_VALUE(   463.25), SIMDE_FLOAT16_VALUE(   570.00), SIMDE_FLOAT16_VALUE(   917.00),
+          SIMDE_FLOAT16_VALUE(   889.00), SIMDE_FLOAT16_VALUE(   836.50), SIMDE_FLOAT16_VALUE(  -121.25), SIMDE_FLOAT16_VALUE(    13.92) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vmaxq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vmaxq_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -1057,6 +1241,8 @@ test_simde_x_vmaxq_u64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vmaxh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vmax_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmax_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmax_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmax_s8)
@@ -1068,6 +1254,7 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vmax_u16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmax_u32)
 SIMDE_TEST_FUNC_LIST_ENTRY(x_vmax_u64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vmaxq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmaxq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmaxq_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmaxq_s8)
@@ -3,6 +3,108 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/maxnm.h"
 
+static int
+test_simde_vmaxnmh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {                SIMDE_NANHF,
+      SIMDE_FLOAT16_VALUE(     1.00),
+      SIMDE_FLOAT16_VALUE(     1.00) },
+    { SIMDE_FLOAT16_VALUE(    -2.50),
+                     SIMDE_NANHF,
+      SIMDE_FLOAT16_VALUE(    -2.50) },
+    #endif
+    { SIMDE_FLOAT16_VALUE(  -659.50),
+      SIMDE_FLOAT16_VALUE(   110.94),
+      SIMDE_FLOAT16_VALUE(   110.94) },
+    { SIMDE_FLOAT16_VALUE(   -42.56),
+      SIMDE_FLOAT16_VALUE(  -981.50),
+      SIMDE_FLOAT16_VALUE(   -42.56) },
+    { SIMDE_FLOAT16_VALUE(  -230.38),
+      SIMDE_FLOAT16_VALUE(   523.00),
+      SIMDE_FLOAT16_VALUE(   523.00) },
+    { SIMDE_FLOAT16_VALUE(   -42.28),
+      SIMDE_FLOAT16_VALUE(  -409.50),
+      SIMDE_FLOAT16_VALUE(   -42.28) },
+    { SIMDE_FLOAT16_VALUE(  -888.00),
+      SIMDE_FLOAT16_VALUE(  -103.94),
+      SIMDE_FLOAT16_VALUE(  -103.94) },
+    { SIMDE_FLOAT16_VALUE(   937.50),
+      SIMDE_FLOAT16_VALUE(  -241.50),
+      SIMDE_FLOAT16_VALUE(   937.50) },
+    { SIMDE_FLOAT16_VALUE(   286.75),
+      SIMDE_FLOAT16_VALUE(  -495.50),
+      SIMDE_FLOAT16_VALUE(   286.75) },
+    { SIMDE_FLOAT16_VALUE(   890.00),
+      SIMDE_FLOAT16_VALUE(  -521.00),
+      SIMDE_FLOAT16_VALUE(   890.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vmaxnmh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vmaxnm_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   992.00), SIMDE_FLOAT16_VALUE(   631.00), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(  -140.12), SIMDE_FLOAT16_VALUE(  -689.50),                SIMDE_NANHF },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(   992.00), SIMDE_FLOAT16_VALUE(   631.00), SIMDE_FLOAT16_VALUE(     1.00) } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(   146.88), SIMDE_FLOAT16_VALUE(  -393.00),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   612.00), SIMDE_FLOAT16_VALUE(  -689.00), SIMDE_FLOAT16_VALUE(    -2.50) },
+      { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(   612.00), SIMDE_FLOAT16_VALUE(  -393.00), SIMDE_FLOAT16_VALUE(    -2.50) } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(   480.00), SIMDE_FLOAT16_VALUE(   -78.62), SIMDE_FLOAT16_VALUE(   860.00), SIMDE_FLOAT16_VALUE(   214.00) },
+      { SIMDE_FLOAT16_VALUE(  -803.50), SIMDE_FLOAT16_VALUE(  -925.00), SIMDE_FLOAT16_VALUE(   290.75), SIMDE_FLOAT16_VALUE(  -592.50) },
+      { SIMDE_FLOAT16_VALUE(   480.00), SIMDE_FLOAT16_VALUE(   -78.62), SIMDE_FLOAT16_VALUE(   860.00), SIMDE_FLOAT16_VALUE(   214.00) } },
+    { { SIMDE_FLOAT16_VALUE(   344.00), SIMDE_FLOAT16_VALUE(  -543.00), SIMDE_FLOAT16_VALUE(  -780.00), SIMDE_FLOAT16_VALUE(  -140.50) },
+      { SIMDE_FLOAT16_VALUE(   857.50), SIMDE_FLOAT16_VALUE(   557.00), SIMDE_FLOAT16_VALUE(   229.00), SIMDE_FLOAT16_VALUE(   779.00) },
+      { SIMDE_FLOAT16_VALUE(   857.50), SIMDE_FLOAT16_VALUE(   557.00), SIMDE_FLOAT16_VALUE(   229.00), SIMDE_FLOAT16_VALUE(   779.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -103.25), SIMDE_FLOAT16_VALUE(   835.00), SIMDE_FLOAT16_VALUE(   520.50), SIMDE_FLOAT16_VALUE(  -119.94) },
+      { SIMDE_FLOAT16_VALUE(  -371.50), SIMDE_FLOAT16_VALUE(   388.75), SIMDE_FLOAT16_VALUE(   900.50), SIMDE_FLOAT16_VALUE(  -520.50) },
+      { SIMDE_FLOAT16_VALUE(  -103.25), SIMDE_FLOAT16_VALUE(   835.00), SIMDE_FLOAT16_VALUE(   900.50), SIMDE_FLOAT16_VALUE(  -119.94) } },
+    { { SIMDE_FLOAT16_VALUE(   681.00), SIMDE_FLOAT16_VALUE(   -11.91), SIMDE_FLOAT16_VALUE(   884.50), SIMDE_FLOAT16_VALUE(  -626.00) },
+      { SIMDE_FLOAT16_VALUE(  -848.00), SIMDE_FLOAT16_VALUE(   524.00), SIMDE_FLOAT16_VALUE(  -668.50), SIMDE_FLOAT16_VALUE(   111.94) },
+      { SIMDE_FLOAT16_VALUE(   681.00), SIMDE_FLOAT16_VALUE(   524.00), SIMDE_FLOAT16_VALUE(   884.50), SIMDE_FLOAT16_VALUE(   111.94) } },
+    { { SIMDE_FLOAT16_VALUE(  -270.75), SIMDE_FLOAT16_VALUE(   106.75), SIMDE_FLOAT16_VALUE(  -887.50), SIMDE_FLOAT16_VALUE(  -801.00) },
+      { SIMDE_FLOAT16_VALUE(  -751.50), SIMDE_FLOAT16_VALUE(   925.00), SIMDE_FLOAT16_VALUE(   320.50), SIMDE_FLOAT16_VALUE(  -282.00) },
+      { SIMDE_FLOAT16_VALUE(  -270.75), SIMDE_FLOAT16_VALUE(   925.00), SIMDE_FLOAT16_VALUE(   320.50), SIMDE_FLOAT16_VALUE(  -282.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -770.00), SIMDE_FLOAT16_VALUE(  -884.50), SIMDE_FLOAT16_VALUE(  -587.00), SIMDE_FLOAT16_VALUE(  -455.50) },
+      { SIMDE_FLOAT16_VALUE(  -990.50), SIMDE_FLOAT16_VALUE(   625.50), SIMDE_FLOAT16_VALUE(  -363.00), SIMDE_FLOAT16_VALUE(   735.50) },
+      { SIMDE_FLOAT16_VALUE(  -770.00), SIMDE_FLOAT16_VALUE(   625.50), SIMDE_FLOAT16_VALUE(  -363.00), SIMDE_FLOAT16_VALUE(   735.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -305.50), SIMDE_FLOAT16_VALUE(   -61.19), SIMDE_FLOAT16_VALUE(  -199.12), SIMDE_FLOAT16_VALUE(  -624.00) },
+      { SIMDE_FLOAT16_VALUE(   120.38), SIMDE_FLOAT16_VALUE(  -200.88), SIMDE_FLOAT16_VALUE(   307.75), SIMDE_FLOAT16_VALUE(  -501.50) },
+      { SIMDE_FLOAT16_VALUE(   120.38), SIMDE_FLOAT16_VALUE(   -61.19), SIMDE_FLOAT16_VALUE(   307.75), SIMDE_FLOAT16_VALUE(  -501.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -447.00), SIMDE_FLOAT16_VALUE(  -396.25), SIMDE_FLOAT16_VALUE(  -446.25), SIMDE_FLOAT16_VALUE(  -109.50) },
+      { SIMDE_FLOAT16_VALUE(   873.00), SIMDE_FLOAT16_VALUE(  -586.50), SIMDE_FLOAT16_VALUE(   773.00), SIMDE_FLOAT16_VALUE(  -983.00) },
+      { SIMDE_FLOAT16_VALUE(   873.00), SIMDE_FLOAT16_VALUE(  -396.25), SIMDE_FLOAT16_VALUE(   773.00), SIMDE_FLOAT16_VALUE(  -109.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vmaxnm_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vmaxnm_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -129,6 +231,88 @@ test_simde_vmaxnm_f64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vmaxnmq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   834.50), SIMDE_FLOAT16_VALUE(   905.00), SIMDE_FLOAT16_VALUE(   150.12),
+          SIMDE_FLOAT16_VALUE(  -788.00), SIMDE_FLOAT16_VALUE(    72.00), SIMDE_FLOAT16_VALUE(  -392.50), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(  -794.00), SIMDE_FLOAT16_VALUE(   598.00), SIMDE_FLOAT16_VALUE(  -673.50),
+          SIMDE_FLOAT16_VALUE(  -250.25), SIMDE_FLOAT16_VALUE(   608.50), SIMDE_FLOAT16_VALUE(   372.00),                SIMDE_NANHF },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(   834.50), SIMDE_FLOAT16_VALUE(   905.00), SIMDE_FLOAT16_VALUE(   150.12),
+          SIMDE_FLOAT16_VALUE(  -250.25), SIMDE_FLOAT16_VALUE(   608.50), SIMDE_FLOAT16_VALUE(   372.00), SIMDE_FLOAT16_VALUE(     1.00) } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(  -200.62), SIMDE_FLOAT16_VALUE(  -223.50), SIMDE_FLOAT16_VALUE(  -357.75),
+          SIMDE_FLOAT16_VALUE(  -272.50), SIMDE_FLOAT16_VALUE(  -495.75), SIMDE_FLOAT16_VALUE(   148.12),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -425.75), SIMDE_FLOAT16_VALUE(   822.50), SIMDE_FLOAT16_VALUE(  -301.00),
+          SIMDE_FLOAT16_VALUE(   625.00), SIMDE_FLOAT16_VALUE(   614.00), SIMDE_FLOAT16_VALUE(   134.12), SIMDE_FLOAT16_VALUE(    -2.50) },
+      { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(  -200.62), SIMDE_FLOAT16_VALUE(   822.50), SIMDE_FLOAT16_VALUE(  -301.00),
+          SIMDE_FLOAT16_VALUE(   625.00), SIMDE_FLOAT16_VALUE(   614.00), SIMDE_FLOAT16_VALUE(   148.12), SIMDE_FLOAT16_VALUE(    -2.50) } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(   362.00), SIMDE_FLOAT16_VALUE(  -385.00), SIMDE_FLOAT16_VALUE(   558.00), SIMDE_FLOAT16_VALUE(   324.00),
+          SIMDE_FLOAT16_VALUE(   458.50), SIMDE_FLOAT16_VALUE(  -665.50), SIMDE_FLOAT16_VALUE(   555.00), SIMDE_FLOAT16_VALUE(   847.50) },
+      { SIMDE_FLOAT16_VALUE(  -344.50), SIMDE_FLOAT16_VALUE(   728.50), SIMDE_FLOAT16_VALUE(   894.50), SIMDE_FLOAT16_VALUE(   464.50),
+          SIMDE_FLOAT16_VALUE(   727.00), SIMDE_FLOAT16_VALUE(   997.50), SIMDE_FLOAT16_VALUE(   849.50), SIMDE_FLOAT16_VALUE(   691.00) },
+      { SIMDE_FLOAT16_VALUE(   362.00), SIMDE_FLOAT16_VALUE(   728.50), SIMDE_FLOAT16_VALUE(   894.50), SIMDE_FLOAT16_VALUE(   464.50),
+          SIMDE_FLOAT16_VALUE(   727.00), SIMDE_FLOAT16_VALUE(   997.50), SIMDE_FLOAT16_VALUE(   849.50), SIMDE_FLOAT16_VALUE(   847.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -72.19), SIMDE_FLOAT16_VALUE(  -437.50), SIMDE_FLOAT16_VALUE(   944.00), SIMDE_FLOAT16_VALUE(   787.50),
+          SIMDE_FLOAT16_VALUE(  -682.00), SIMDE_FLOAT16_VALUE(    81.19), SIMDE_FLOAT16_VALUE(   347.75), SIMDE_FLOAT16_VALUE(  -376.75) },
+      { SIMDE_FLOAT16_VALUE(   397.00), SIMDE_FLOAT16_VALUE(   463.25), SIMDE_FLOAT16_VALUE(  -612.00), SIMDE_FLOAT16_VALUE(   117.00),
+          SIMDE_FLOAT16_VALUE(   553.00), SIMDE_FLOAT16_VALUE(  -946.00), SIMDE_FLOAT16_VALUE(   125.38), SIMDE_FLOAT16_VALUE(   590.50) },
+      { SIMDE_FLOAT16_VALUE(   397.00), SIMDE_FLOAT16_VALUE(   463.25), SIMDE_FLOAT16_VALUE(   944.00), SIMDE_FLOAT16_VALUE(   787.50),
+          SIMDE_FLOAT16_VALUE(   553.00), SIMDE_FLOAT16_VALUE(    81.19), SIMDE_FLOAT16_VALUE(   347.75), SIMDE_FLOAT16_VALUE(   590.50) } },
+    { { SIMDE_FLOAT16_VALUE(    18.05), SIMDE_FLOAT16_VALUE(   664.00), SIMDE_FLOAT16_VALUE(   936.00), SIMDE_FLOAT16_VALUE(   485.75),
+          SIMDE_FLOAT16_VALUE(  -192.00), SIMDE_FLOAT16_VALUE(  -244.75), SIMDE_FLOAT16_VALUE(  -700.50), SIMDE_FLOAT16_VALUE(   -98.56) },
+      { SIMDE_FLOAT16_VALUE(   613.00), SIMDE_FLOAT16_VALUE(   504.25), SIMDE_FLOAT16_VALUE(  -676.50), SIMDE_FLOAT16_VALUE(  -700.00),
+          SIMDE_FLOAT16_VALUE(   147.00), SIMDE_FLOAT16_VALUE(  -189.50), SIMDE_FLOAT16_VALUE(   181.88), SIMDE_FLOAT16_VALUE(  -866.50) },
+      { SIMDE_FLOAT16_VALUE(   613.00), SIMDE_FLOAT16_VALUE(   664.00), SIMDE_FLOAT16_VALUE(   936.00), SIMDE_FLOAT16_VALUE(   485.75),
+          SIMDE_FLOAT16_VALUE(   147.00), SIMDE_FLOAT16_VALUE(  -189.50), SIMDE_FLOAT16_VALUE(   181.88), SIMDE_FLOAT16_VALUE(   -98.56) } },
+    { { SIMDE_FLOAT16_VALUE(   445.50), SIMDE_FLOAT16_VALUE(  -484.00), SIMDE_FLOAT16_VALUE(   605.00), SIMDE_FLOAT16_VALUE(  -707.50),
+          SIMDE_FLOAT16_VALUE(  -240.25), SIMDE_FLOAT16_VALUE(  -839.00), SIMDE_FLOAT16_VALUE(  -780.00), SIMDE_FLOAT16_VALUE(   250.62) },
+      { SIMDE_FLOAT16_VALUE(  -464.75), SIMDE_FLOAT16_VALUE(   607.50), SIMDE_FLOAT16_VALUE(  -598.50), SIMDE_FLOAT16_VALUE(   327.00),
+          SIMDE_FLOAT16_VALUE(  -497.25), SIMDE_FLOAT16_VALUE(   393.00), SIMDE_FLOAT16_VALUE(  -612.50), SIMDE_FLOAT16_VALUE(   149.38) },
+      { SIMDE_FLOAT16_VALUE(   445.50), SIMDE_FLOAT16_VALUE(   607.50), SIMDE_FLOAT16_VALUE(   605.00), SIMDE_FLOAT16_VALUE(   327.00),
+          SIMDE_FLOAT16_VALUE(  -240.25), SIMDE_FLOAT16_VALUE(   393.00), SIMDE_FLOAT16_VALUE(  -612.50), SIMDE_FLOAT16_VALUE(   250.62) } },
+    { { SIMDE_FLOAT16_VALUE(   411.75), SIMDE_FLOAT16_VALUE(   -47.00), SIMDE_FLOAT16_VALUE(   887.00), SIMDE_FLOAT16_VALUE(   943.00),
+          SIMDE_FLOAT16_VALUE(   303.50), SIMDE_FLOAT16_VALUE(   238.88), SIMDE_FLOAT16_VALUE(  -956.50), SIMDE_FLOAT16_VALUE(   201.38) },
+      { SIMDE_FLOAT16_VALUE(   404.00), SIMDE_FLOAT16_VALUE(   673.50), SIMDE_FLOAT16_VALUE(   661.00), SIMDE_FLOAT16_VALUE(  -514.50),
+          SIMDE_FLOAT16_VALUE(  -846.00), SIMDE_FLOAT16_VALUE(   103.69), SIMDE_FLOAT16_VALUE(  -931.50), SIMDE_FLOAT16_VALUE(  -811.50) },
+      { SIMDE_FLOAT16_VALUE(   411.75), SIMDE_FLOAT16_VALUE(   673.50), SIMDE_FLOAT16_VALUE(   887.00), SIMDE_FLOAT16_VALUE(   943.00),
+          SIMDE_FLOAT16_VALUE(   303.50), SIMDE_FLOAT16_VALUE(   238.88), SIMDE_FLOAT16_VALUE(  -931.50), SIMDE_FLOAT16_VALUE(   201.38) } },
+    { { SIMDE_FLOAT16_VALUE(  -379.50), SIMDE_FLOAT16_VALUE(  -111.50), SIMDE_FLOAT16_VALUE(   -35.91), SIMDE_FLOAT16_VALUE(   -30.81),
+          SIMDE_FLOAT16_VALUE(  -598.50), SIMDE_FLOAT16_VALUE(  -751.00), SIMDE_FLOAT16_VALUE(   367.50), SIMDE_FLOAT16_VALUE(  -257.00) },
+      { SIMDE_FLOAT16_VALUE(  -589.50), SIMDE_FLOAT16_VALUE(  -725.50), SIMDE_FLOAT16_VALUE(  -235.00), SIMDE_FLOAT16_VALUE(  -653.50),
+          SIMDE_FLOAT16_VALUE(    62.91), SIMDE_FLOAT16_VALUE(   -41.59), SIMDE_FLOAT16_VALUE(   130.50), SIMDE_FLOAT16_VALUE(   266.00) },
+      { SIMDE_FLOAT16_VALUE(  -379.50), SIMDE_FLOAT16_VALUE(  -111.50), SIMDE_FLOAT16_VALUE(   -35.91), SIMDE_FLOAT16_VALUE(   -30.81),
+          SIMDE_FLOAT16_VALUE(    62.91), SIMDE_FLOAT16_VALUE(   -41.59), SIMDE_FLOAT16_VALUE(   367.50), SIMDE_FLOAT16_VALUE(   266.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -571.50), SIMDE_FLOAT16_VALUE(  -294.25), SIMDE_FLOAT16_VALUE(  -735.00), SIMDE_FLOAT16_VALUE(   293.00),
+          SIMDE_FLOAT16_VALUE(  -184.62), SIMDE_FLOAT16_VALUE(  -558.50), SIMDE_FLOAT16_VALUE(   363.00), SIMDE_FLOAT16_VALUE(   179.50) },
+      { SIMDE_FLOAT16_VALUE(  -471.00), SIMDE_FLOAT16_VALUE(  -278.00), SIMDE_FLOAT16_VALUE(  -225.25), SIMDE_FLOAT16_VALUE(    90.62),
+          SIMDE_FLOAT16_VALUE(   526.50), SIMDE_FLOAT16_VALUE(  -699.00), SIMDE_FLOAT16_VALUE(  -767.00), SIMDE_FLOAT16_VALUE(  -936.50) },
+      { SIMDE_FLOAT16_VALUE(  -471.00), SIMDE_FLOAT16_VALUE(  -278.00), SIMDE_FLOAT16_VALUE(  -225.25), SIMDE_FLOAT16_VALUE(   293.00),
+          SIMDE_FLOAT16_VALUE(   526.50), SIMDE_FLOAT16_VALUE(  -558.50), SIMDE_FLOAT16_VALUE(   363.00), SIMDE_FLOAT16_VALUE(   179.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -863.00), SIMDE_FLOAT16_VALUE(   255.00), SIMDE_FLOAT16_VALUE(  -419.25), SIMDE_FLOAT16_VALUE(  -801.00),
+          SIMDE_FLOAT16_VALUE(   917.00), SIMDE_FLOAT16_VALUE(   229.50), SIMDE_FLOAT16_VALUE(   185.12), SIMDE_FLOAT16_VALUE(  -351.50) },
+      { SIMDE_FLOAT16_VALUE(   480.75), SIMDE_FLOAT16_VALUE(  -213.62), SIMDE_FLOAT16_VALUE(     6.70), SIMDE_FLOAT16_VALUE(   -37.44),
+          SIMDE_FLOAT16_VALUE(   133.38), SIMDE_FLOAT16_VALUE(  -724.50), SIMDE_FLOAT16_VALUE(  -258.75), SIMDE_FLOAT16_VALUE(  -409.50) },
+      { SIMDE_FLOAT16_VALUE(   480.75), SIMDE_FLOAT16_VALUE(   255.00), SIMDE_FLOAT16_VALUE(     6.70), SIMDE_FLOAT16_VALUE(   -37.44),
+          SIMDE_FLOAT16_VALUE(   917.00), SIMDE_FLOAT16_VALUE(   229.50), SIMDE_FLOAT16_VALUE(   185.12), SIMDE_FLOAT16_VALUE(  -351.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vmaxnmq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vmaxnmq_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -256,8 +440,11 @@ test_simde_vmaxnmq_f64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnmh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnm_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnm_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnm_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnmq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnmq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnmq_f64)
 SIMDE_TEST_FUNC_LIST_END
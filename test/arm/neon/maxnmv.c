@@ -0,0 +1,132 @@
+#define SIMDE_TEST_ARM_NEON_INSN maxnmv
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/maxnmv.h"
+
+static int
+test_simde_vmaxnmv_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT32_C(   773.73),            SIMDE_MATH_NANF },
+      SIMDE_FLOAT32_C(   773.73) },
+    { {            SIMDE_MATH_NANF,            SIMDE_MATH_NANF },
+                 SIMDE_MATH_NANF },
+    #endif
+    { { SIMDE_FLOAT32_C(   414.55), SIMDE_FLOAT32_C(   618.22) },
+      SIMDE_FLOAT32_C(   618.22) },
+    { { SIMDE_FLOAT32_C(   606.84), SIMDE_FLOAT32_C(  -487.99) },
+      SIMDE_FLOAT32_C(   606.84) },
+    { { SIMDE_FLOAT32_C(  -839.39), SIMDE_FLOAT32_C(  -188.38) },
+      SIMDE_FLOAT32_C(  -188.38) },
+    { { SIMDE_FLOAT32_C(  -394.33), SIMDE_FLOAT32_C(   977.64) },
+      SIMDE_FLOAT32_C(   977.64) },
+    { { SIMDE_FLOAT32_C(  -875.22), SIMDE_FLOAT32_C(   681.23) },
+      SIMDE_FLOAT32_C(   681.23) },
+    { { SIMDE_FLOAT32_C(   437.98), SIMDE_FLOAT32_C(   612.52) },
+      SIMDE_FLOAT32_C(   612.52) },
+    { { SIMDE_FLOAT32_C(  -645.50), SIMDE_FLOAT32_C(   656.18) },
+      SIMDE_FLOAT32_C(   656.18) },
+    { { SIMDE_FLOAT32_C(   797.93), SIMDE_FLOAT32_C(   716.05) },
+      SIMDE_FLOAT32_C(   797.93) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32 r = simde_vmaxnmv_f32(a);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vmaxnmvq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT32_C(   359.51),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   577.30), SIMDE_FLOAT32_C(   760.00) },
+      SIMDE_FLOAT32_C(   760.00) },
+    { {            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF },
+                 SIMDE_MATH_NANF },
+    #endif
+    { { SIMDE_FLOAT32_C(   691.45), SIMDE_FLOAT32_C(  -859.17), SIMDE_FLOAT32_C(  -880.94), SIMDE_FLOAT32_C(    93.70) },
+      SIMDE_FLOAT32_C(   691.45) },
+    { { SIMDE_FLOAT32_C(  -995.39), SIMDE_FLOAT32_C(   449.29), SIMDE_FLOAT32_C(   640.63), SIMDE_FLOAT32_C(  -170.35) },
+      SIMDE_FLOAT32_C(   640.63) },
+    { { SIMDE_FLOAT32_C(    17.89), SIMDE_FLOAT32_C(  -530.13), SIMDE_FLOAT32_C(  -384.81), SIMDE_FLOAT32_C(  -170.65) },
+      SIMDE_FLOAT32_C(    17.89) },
+    { { SIMDE_FLOAT32_C(  -426.00), SIMDE_FLOAT32_C(   534.92), SIMDE_FLOAT32_C(  -374.06), SIMDE_FLOAT32_C(   -48.77) },
+      SIMDE_FLOAT32_C(   534.92) },
+    { { SIMDE_FLOAT32_C(  -128.54), SIMDE_FLOAT32_C(   195.79), SIMDE_FLOAT32_C(    80.17), SIMDE_FLOAT32_C(  -981.27) },
+      SIMDE_FLOAT32_C(   195.79) },
+    { { SIMDE_FLOAT32_C(   827.18), SIMDE_FLOAT32_C(    85.79), SIMDE_FLOAT32_C(   201.62), SIMDE_FLOAT32_C(   903.66) },
+      SIMDE_FLOAT32_C(   903.66) },
+    { { SIMDE_FLOAT32_C(   234.01), SIMDE_FLOAT32_C(   402.58), SIMDE_FLOAT32_C(   464.25), SIMDE_FLOAT32_C(  -256.16) },
+      SIMDE_FLOAT32_C(   464.25) },
+    { { SIMDE_FLOAT32_C(    79.40), SIMDE_FLOAT32_C(   -87.95), SIMDE_FLOAT32_C(   641.30), SIMDE_FLOAT32_C(   343.34) },
+      SIMDE_FLOAT32_C(   641.30) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32 r = simde_vmaxnmvq_f32(a);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vmaxnmvq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT64_C(   773.88),             SIMDE_MATH_NAN },
+      SIMDE_FLOAT64_C(   773.88) },
+    { {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+                  SIMDE_MATH_NAN },
+    #endif
+    { { SIMDE_FLOAT64_C(   -67.34), SIMDE_FLOAT64_C(  -735.90) },
+      SIMDE_FLOAT64_C(   -67.34) },
+    { { SIMDE_FLOAT64_C(   599.93), SIMDE_FLOAT64_C(  -553.00) },
+      SIMDE_FLOAT64_C(   599.93) },
+    { { SIMDE_FLOAT64_C(  -949.45), SIMDE_FLOAT64_C(  -434.41) },
+      SIMDE_FLOAT64_C(  -434.41) },
+    { { SIMDE_FLOAT64_C(  -171.21), SIMDE_FLOAT64_C(   611.62) },
+      SIMDE_FLOAT64_C(   611.62) },
+    { { SIMDE_FLOAT64_C(   198.27), SIMDE_FLOAT64_C(   422.98) },
+      SIMDE_FLOAT64_C(   422.98) },
+    { { SIMDE_FLOAT64_C(   740.05), SIMDE_FLOAT64_C(  -258.45) },
+      SIMDE_FLOAT64_C(   740.05) },
+    { { SIMDE_FLOAT64_C(  -833.34), SIMDE_FLOAT64_C(  -662.75) },
+      SIMDE_FLOAT64_C(  -662.75) },
+    { { SIMDE_FLOAT64_C(   513.24), SIMDE_FLOAT64_C(  -799.69) },
+      SIMDE_FLOAT64_C(   513.24) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64 r = simde_vmaxnmvq_f64(a);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnmv_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnmvq_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vmaxnmvq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -71,7 +71,19 @@ test_simde_vmaxv_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT8_C( 125),  INT8_C(  96),  INT8_C(  71), -INT8_C(  24),  INT8_C(  42),  INT8_C(  90), -INT8_C( 105),  INT8_C( 101) },
        INT8_C( 125) },
     { { -INT8_C(   8), -INT8_C( 117), -INT8_C(  65), -INT8_C( 113),  INT8_C(  31),      INT8_MAX, -INT8_C(  80), -INT8_C(  63) },
-           INT8_MAX }
+           INT8_MAX },
+    { {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+           INT8_MIN },
+    { {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+           INT8_MAX },
+    { {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+           INT8_MAX },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN },
+       INT8_C(   0) },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX },
+           INT8_MAX },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C( 127) },
+      -INT8_C(   1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -117,7 +129,19 @@ test_simde_vmaxv_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT16_C(  6203), -INT16_C( 25586),  INT16_C( 12011),  INT16_C( 31594) },
        INT16_C( 31594) },
     { { -INT16_C( 14324),  INT16_C( 27177), -INT16_C( 26154), -INT16_C( 18058) },
-       INT16_C( 27177) }
+       INT16_C( 27177) },
+    { {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+            INT16_MIN },
+    { {       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX },
+            INT16_MAX },
+    { {       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX },
+            INT16_MAX },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MIN },
+       INT16_C(    0) },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MAX },
+            INT16_MAX },
+    { { -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(32767) },
+      -INT16_C(    1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -163,7 +187,19 @@ test_simde_vmaxv_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT32_C(   452942228),  INT32_C(   229452879) },
        INT32_C(   452942228) },
     { {  INT32_C(  1939974787),  INT32_C(  1777790750) },
-       INT32_C(  1939974787) }
+       INT32_C(  1939974787) },
+    { {            INT32_MIN,            INT32_MIN },
+                 INT32_MIN },
+    { {            INT32_MAX,            INT32_MAX },
+                 INT32_MAX },
+    { {            INT32_MIN,            INT32_MAX },
+                 INT32_MAX },
+    { {  INT32_C(         0),            INT32_MIN },
+       INT32_C(         0) },
+    { {  INT32_C(         0),            INT32_MAX },
+                 INT32_MAX },
+    { { -INT32_C(         1), -INT32_C(2147483647) },
+      -INT32_C(         1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -209,7 +245,19 @@ test_simde_vmaxv_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C(224), UINT8_C(135), UINT8_C(143), UINT8_C(250), UINT8_C(237), UINT8_C(128), UINT8_C(152), UINT8_C(254) },
       UINT8_C(254) },
     { { UINT8_C( 19), UINT8_C(169), UINT8_C( 44), UINT8_C(148), UINT8_C(176), UINT8_C(196), UINT8_C( 46), UINT8_C(185) },
-      UINT8_C(196) }
+      UINT8_C(196) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+          UINT8_MAX },
+    { { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX },
+          UINT8_MAX },
+    { { UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 128) },
+      UINT8_C( 128) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX, UINT8_C(   0) },
+          UINT8_MAX },
+    { { UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C( 254) },
+      UINT8_C( 254) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -255,7 +303,19 @@ test_simde_vmaxv_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C(51473), UINT16_C(50740), UINT16_C(53615), UINT16_C(48782) },
       UINT16_C(53615) },
     { { UINT16_C(60058), UINT16_C(10173), UINT16_C(30325), UINT16_C(43591) },
-      UINT16_C(60058) }
+      UINT16_C(60058) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+           UINT16_MAX },
+    { { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+           UINT16_MAX },
+    { { UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32768) },
+      UINT16_C(32768) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+           UINT16_MAX },
+    { { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(65534) },
+      UINT16_C(65534) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -301,7 +361,19 @@ test_simde_vmaxv_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(2476256020), UINT32_C(1303173767) },
       UINT32_C(2476256020) },
     { { UINT32_C(1317596377), UINT32_C( 982347379) },
-      UINT32_C(1317596377) }
+      UINT32_C(1317596377) },
+    { {           UINT32_MAX,           UINT32_MAX },
+                UINT32_MAX },
+    { { UINT32_C(         0), UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         0),           UINT32_MAX },
+                UINT32_MAX },
+    { { UINT32_C(2147483647), UINT32_C(2147483648) },
+      UINT32_C(2147483648) },
+    { {           UINT32_MAX, UINT32_C(         0) },
+                UINT32_MAX },
+    { { UINT32_C(         1), UINT32_C(4294967294) },
+      UINT32_C(4294967294) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -447,7 +519,25 @@ test_simde_vmaxvq_s8 (SIMDE_MUNIT_TEST_ARGS) {
        INT8_C( 100) },
     { { -INT8_C(  96), -INT8_C( 127), -INT8_C(  10),  INT8_C(  61), -INT8_C(  53), -INT8_C(  36), -INT8_C(   5),  INT8_C(  23),
         -INT8_C(  13),  INT8_C(  79),  INT8_C(  31),  INT8_C(  37),  INT8_C(  82), -INT8_C(  16),  INT8_C(  85), -INT8_C( 111) },
-       INT8_C(  85) }
+       INT8_C(  85) },
+    { {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+           INT8_MIN },
+    { {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+           INT8_MAX },
+    { {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+             INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+           INT8_MAX },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN },
+       INT8_C(   0) },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX },
+           INT8_MAX },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C( 127) },
+      -INT8_C(   1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -493,7 +583,19 @@ test_simde_vmaxvq_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT16_C( 31442),  INT16_C(  3015), -INT16_C( 26224), -INT16_C(  4018),  INT16_C( 32097), -INT16_C( 24183), -INT16_C( 16447),  INT16_C( 32724) },
        INT16_C( 32724) },
     { {  INT16_C( 20420), -INT16_C(  8170),  INT16_C( 13915),  INT16_C( 25721), -INT16_C(  5664), -INT16_C( 22481), -INT16_C( 21914), -INT16_C( 27166) },
-       INT16_C( 25721) }
+       INT16_C( 25721) },
+    { {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+            INT16_MIN },
+    { {       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX },
+            INT16_MAX },
+    { {       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX },
+            INT16_MAX },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MIN },
+       INT16_C(    0) },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MAX },
+            INT16_MAX },
+    { { -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(32767) },
+      -INT16_C(    1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -539,7 +641,19 @@ test_simde_vmaxvq_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT32_C(   822303083), -INT32_C(  1043217936),  INT32_C(  1441022627),  INT32_C(  1872413763) },
        INT32_C(  1872413763) },
     { {  INT32_C(   819882277), -INT32_C(  1254256739), -INT32_C(   468300056),  INT32_C(     2083732) },
-       INT32_C(   819882277) }
+       INT32_C(   819882277) },
+    { {            INT32_MIN,            INT32_MIN,            INT32_MIN,            INT32_MIN },
+                 INT32_MIN },
+    { {            INT32_MAX,            INT32_MAX,            INT32_MAX,            INT32_MAX },
+                 INT32_MAX },
+    { {            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX },
+                 INT32_MAX },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),            INT32_MIN },
+       INT32_C(         0) },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),            INT32_MAX },
+                 INT32_MAX },
+    { { -INT32_C(         1), -INT32_C(         1), -INT32_C(         1), -INT32_C(2147483647) },
+      -INT32_C(         1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -593,7 +707,25 @@ test_simde_vmaxvq_u8 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C(253) },
     { { UINT8_C(106), UINT8_C( 29), UINT8_C(198), UINT8_C( 89), UINT8_C( 80), UINT8_C(183), UINT8_C( 80), UINT8_C( 45),
         UINT8_C(226), UINT8_C(100), UINT8_C(  5), UINT8_C( 60), UINT8_C(204), UINT8_C( 76), UINT8_C(235), UINT8_C(212) },
-      UINT8_C(235) }
+      UINT8_C(235) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+          UINT8_MAX },
+    { { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0),
+        UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX,
+        UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX },
+          UINT8_MAX },
+    { { UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127),
+        UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 128) },
+      UINT8_C( 128) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX, UINT8_C(   0) },
+          UINT8_MAX },
+    { { UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1),
+        UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C( 254) },
+      UINT8_C( 254) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -639,7 +771,19 @@ test_simde_vmaxvq_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C(31846), UINT16_C(11794), UINT16_C(31420), UINT16_C(52583), UINT16_C(65442), UINT16_C(22798), UINT16_C(64079), UINT16_C( 1843) },
       UINT16_C(65442) },
     { { UINT16_C(32094), UINT16_C(13099), UINT16_C( 8291), UINT16_C(20344), UINT16_C(30745), UINT16_C( 8086), UINT16_C(42710), UINT16_C(15830) },
-      UINT16_C(42710) }
+      UINT16_C(42710) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+           UINT16_MAX },
+    { { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+           UINT16_MAX },
+    { { UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32768) },
+      UINT16_C(32768) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+           UINT16_MAX },
+    { { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(65534) },
+      UINT16_C(65534) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -685,7 +829,19 @@ test_simde_vmaxvq_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(3599021244), UINT32_C(1314251497), UINT32_C(1081404862), UINT32_C(3904661681) },
       UINT32_C(3904661681) },
     { { UINT32_C(3461392283), UINT32_C( 509026702), UINT32_C(1943548265), UINT32_C( 972368253) },
-      UINT32_C(3461392283) }
+      UINT32_C(3461392283) },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX },
+                UINT32_MAX },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(         0),           UINT32_MAX },
+                UINT32_MAX },
+    { { UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483648) },
+      UINT32_C(2147483648) },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX, UINT32_C(         0) },
+                UINT32_MAX },
+    { { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(4294967294) },
+      UINT32_C(4294967294) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
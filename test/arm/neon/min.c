@@ -3,6 +3,108 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/min.h"
 
+static int
+test_simde_vminh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {                SIMDE_NANHF,
+      SIMDE_FLOAT16_VALUE(     1.00),
+                     SIMDE_NANHF },
+    { SIMDE_FLOAT16_VALUE(    -2.50),
+                     SIMDE_NANHF,
+                     SIMDE_NANHF },
+    #endif
+    { SIMDE_FLOAT16_VALUE(    20.78),
+      SIMDE_FLOAT16_VALUE(   478.00),
+      SIMDE_FLOAT16_VALUE(    20.78) },
+    { SIMDE_FLOAT16_VALUE(  -492.50),
+      SIMDE_FLOAT16_VALUE(    13.48),
+      SIMDE_FLOAT16_VALUE(  -492.50) },
+    { SIMDE_FLOAT16_VALUE(  -400.25),
+      SIMDE_FLOAT16_VALUE(  -428.75),
+      SIMDE_FLOAT16_VALUE(  -428.75) },
+    { SIMDE_FLOAT16_VALUE(  -140.62),
+      SIMDE_FLOAT16_VALUE(   741.00),
+      SIMDE_FLOAT16_VALUE(  -140.62) },
+    { SIMDE_FLOAT16_VALUE(   640.50),
+      SIMDE_FLOAT16_VALUE(   834.00),
+      SIMDE_FLOAT16_VALUE(   640.50) },
+    { SIMDE_FLOAT16_VALUE(  -288.00),
+      SIMDE_FLOAT16_VALUE(  -837.00),
+      SIMDE_FLOAT16_VALUE(  -837.00) },
+    { SIMDE_FLOAT16_VALUE(   -42.12),
+      SIMDE_FLOAT16_VALUE(   220.50),
+      SIMDE_FLOAT16_VALUE(   -42.12) },
+    { SIMDE_FLOAT16_VALUE(   816.50),
+      SIMDE_FLOAT16_VALUE(   720.00),
+      SIMDE_FLOAT16_VALUE(   720.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vminh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vmin_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -83.75), SIMDE_FLOAT16_VALUE(   736.50), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(   636.00), SIMDE_FLOAT16_VALUE(  -633.50),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -83.75), SIMDE_FLOAT16_VALUE(  -633.50),                SIMDE_NANHF } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(  -116.94), SIMDE_FLOAT16_VALUE(  -820.00),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   102.44), SIMDE_FLOAT16_VALUE(  -397.50), SIMDE_FLOAT16_VALUE(    -2.50) },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -116.94), SIMDE_FLOAT16_VALUE(  -820.00),                SIMDE_NANHF } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(   348.00), SIMDE_FLOAT16_VALUE(   188.38), SIMDE_FLOAT16_VALUE(   808.50), SIMDE_FLOAT16_VALUE(  -635.50) },
+      { SIMDE_FLOAT16_VALUE(  -294.75), SIMDE_FLOAT16_VALUE(   335.00), SIMDE_FLOAT16_VALUE(   986.50), SIMDE_FLOAT16_VALUE(  -354.50) },
+      { SIMDE_FLOAT16_VALUE(  -294.75), SIMDE_FLOAT16_VALUE(   188.38), SIMDE_FLOAT16_VALUE(   808.50), SIMDE_FLOAT16_VALUE(  -635.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -17.89), SIMDE_FLOAT16_VALUE(   564.50), SIMDE_FLOAT16_VALUE(  -974.50), SIMDE_FLOAT16_VALUE(   647.00) },
+      { SIMDE_FLOAT16_VALUE(  -158.75), SIMDE_FLOAT16_VALUE(  -961.50), SIMDE_FLOAT16_VALUE(  -662.50), SIMDE_FLOAT16_VALUE(   998.50) },
+      { SIMDE_FLOAT16_VALUE(  -158.75), SIMDE_FLOAT16_VALUE(  -961.50), SIMDE_FLOAT16_VALUE(  -974.50), SIMDE_FLOAT16_VALUE(   647.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -280.00), SIMDE_FLOAT16_VALUE(  -519.00), SIMDE_FLOAT16_VALUE(   346.25), SIMDE_FLOAT16_VALUE(   853.50) },
+      { SIMDE_FLOAT16_VALUE(  -551.00), SIMDE_FLOAT16_VALUE(   -10.19), SIMDE_FLOAT16_VALUE(   913.50), SIMDE_FLOAT16_VALUE(   -73.31) },
+      { SIMDE_FLOAT16_VALUE(  -551.00), SIMDE_FLOAT16_VALUE(  -519.00), SIMDE_FLOAT16_VALUE(   346.25), SIMDE_FLOAT16_VALUE(   -73.31) } },
+    { { SIMDE_FLOAT16_VALUE(  -304.00), SIMDE_FLOAT16_VALUE(  -405.25), SIMDE_FLOAT16_VALUE(  -934.50), SIMDE_FLOAT16_VALUE(   789.50) },
+      { SIMDE_FLOAT16_VALUE(   180.12), SIMDE_FLOAT16_VALUE(  -489.50), SIMDE_FLOAT16_VALUE(  -966.50), SIMDE_FLOAT16_VALUE(  -914.50) },
+      { SIMDE_FLOAT16_VALUE(  -304.00), SIMDE_FLOAT16_VALUE(  -489.50), SIMDE_FLOAT16_VALUE(  -966.50), SIMDE_FLOAT16_VALUE(  -914.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -20.70), SIMDE_FLOAT16_VALUE(  -741.50), SIMDE_FLOAT16_VALUE(   829.00), SIMDE_FLOAT16_VALUE(  -739.50) },
+      { SIMDE_FLOAT16_VALUE(   532.50), SIMDE_FLOAT16_VALUE(   600.50), SIMDE_FLOAT16_VALUE(  -578.50), SIMDE_FLOAT16_VALUE(  -178.00) },
+      { SIMDE_FLOAT16_VALUE(   -20.70), SIMDE_FLOAT16_VALUE(  -741.50), SIMDE_FLOAT16_VALUE(  -578.50), SIMDE_FLOAT16_VALUE(  -739.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -137.25), SIMDE_FLOAT16_VALUE(  -724.00), SIMDE_FLOAT16_VALUE(   488.75), SIMDE_FLOAT16_VALUE(  -357.75) },
+      { SIMDE_FLOAT16_VALUE(   709.50), SIMDE_FLOAT16_VALUE(   252.25), SIMDE_FLOAT16_VALUE(   979.00), SIMDE_FLOAT16_VALUE(  -268.25) },
+      { SIMDE_FLOAT16_VALUE(  -137.25), SIMDE_FLOAT16_VALUE(  -724.00), SIMDE_FLOAT16_VALUE(   488.75), SIMDE_FLOAT16_VALUE(  -357.75) } },
+    { { SIMDE_FLOAT16_VALUE(  -877.00), SIMDE_FLOAT16_VALUE(  -695.00), SIMDE_FLOAT16_VALUE(    79.31), SIMDE_FLOAT16_VALUE(   145.75) },
+      { SIMDE_FLOAT16_VALUE(    75.94), SIMDE_FLOAT16_VALUE(   686.50), SIMDE_FLOAT16_VALUE(   988.00), SIMDE_FLOAT16_VALUE(  -860.00) },
+      { SIMDE_FLOAT16_VALUE(  -877.00), SIMDE_FLOAT16_VALUE(  -695.00), SIMDE_FLOAT16_VALUE(    79.31), SIMDE_FLOAT16_VALUE(  -860.00) } },
+    { { SIMDE_FLOAT16_VALUE(   959.50), SIMDE_FLOAT16_VALUE(   363.50), SIMDE_FLOAT16_VALUE(   368.25), SIMDE_FLOAT16_VALUE(   962.00) },
+      { SIMDE_FLOAT16_VALUE(  -149.12), SIMDE_FLOAT16_VALUE(   316.75), SIMDE_FLOAT16_VALUE(   458.25), SIMDE_FLOAT16_VALUE(  -459.25) },
+      { SIMDE_FLOAT16_VALUE(  -149.12), SIMDE_FLOAT16_VALUE(   316.75), SIMDE_FLOAT16_VALUE(   368.25), SIMDE_FLOAT16_VALUE(  -459.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vmin_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vmin_f32 (SIMDE_MUNIT_TEST_ARGS) {
   struct {
@@ -489,6 +591,88 @@ test_simde_x_vmin_u64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vminq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    25.70), SIMDE_FLOAT16_VALUE(  -572.50), SIMDE_FLOAT16_VALUE(  -993.50),
+          SIMDE_FLOAT16_VALUE(   962.00), SIMDE_FLOAT16_VALUE(   205.25), SIMDE_FLOAT16_VALUE(   671.00), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(   375.00), SIMDE_FLOAT16_VALUE(   715.50), SIMDE_FLOAT16_VALUE(  -995.50),
+          SIMDE_FLOAT16_VALUE(  -600.00), SIMDE_FLOAT16_VALUE(   901.50), SIMDE_FLOAT16_VALUE(  -241.12),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    25.70), SIMDE_FLOAT16_VALUE(  -572.50), SIMDE_FLOAT16_VALUE(  -995.50),
+          SIMDE_FLOAT16_VALUE(  -600.00), SIMDE_FLOAT16_VALUE(   205.25), SIMDE_FLOAT16_VALUE(  -241.12),                SIMDE_NANHF } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(   860.00), SIMDE_FLOAT16_VALUE(  -514.50), SIMDE_FLOAT16_VALUE(   316.50),
+          SIMDE_FLOAT16_VALUE(   906.50), SIMDE_FLOAT16_VALUE(  -751.00), SIMDE_FLOAT16_VALUE(   275.00),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   937.00), SIMDE_FLOAT16_VALUE(  -759.00), SIMDE_FLOAT16_VALUE(    27.45),
+          SIMDE_FLOAT16_VALUE(  -930.50), SIMDE_FLOAT16_VALUE(    25.50), SIMDE_FLOAT16_VALUE(  -146.75), SIMDE_FLOAT16_VALUE(    -2.50) },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   860.00), SIMDE_FLOAT16_VALUE(  -759.00), SIMDE_FLOAT16_VALUE(    27.45),
+          SIMDE_FLOAT16_VALUE(  -930.50), SIMDE_FLOAT16_VALUE(  -751.00), SIMDE_FLOAT16_VALUE(  -146.75),                SIMDE_NANHF } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(   214.00), SIMDE_FLOAT16_VALUE(  -922.50), SIMDE_FLOAT16_VALUE(  -609.50), SIMDE_FLOAT16_VALUE(  -191.25),
+          SIMDE_FLOAT16_VALUE(  -195.25), SIMDE_FLOAT16_VALUE(  -827.50), SIMDE_FLOAT16_VALUE(   414.25), SIMDE_FLOAT16_VALUE(    69.75) },
+      { SIMDE_FLOAT16_VALUE(   631.00), SIMDE_FLOAT16_VALUE(  -936.50), SIMDE_FLOAT16_VALUE(  -667.00), SIMDE_FLOAT16_VALUE(  -408.00),
+          SIMDE_FLOAT16_VALUE(   878.00), SIMDE_FLOAT16_VALUE(  -443.50), SIMDE_FLOAT16_VALUE(   178.00), SIMDE_FLOAT16_VALUE(  -400.25) },
+      { SIMDE_FLOAT16_VALUE(   214.00), SIMDE_FLOAT16_VALUE(  -936.50), SIMDE_FLOAT16_VALUE(  -667.00), SIMDE_FLOAT16_VALUE(  -408.00),
+          SIMDE_FLOAT16_VALUE(  -195.25), SIMDE_FLOAT16_VALUE(  -827.50), SIMDE_FLOAT16_VALUE(   178.00), SIMDE_FLOAT16_VALUE(  -400.25) } },
+    { { SIMDE_FLOAT16_VALUE(   276.50), SIMDE_FLOAT16_VALUE(  -828.50), SIMDE_FLOAT16_VALUE(  -293.75), SIMDE_FLOAT16_VALUE(   430.75),
+          SIMDE_FLOAT16_VALUE(   830.00), SIMDE_FLOAT16_VALUE(   119.62), SIMDE_FLOAT16_VALUE(   789.00), SIMDE_FLOAT16_VALUE(    -6.91) },
+      { SIMDE_FLOAT16_VALUE(  -935.00), SIMDE_FLOAT16_VALUE(  -813.00), SIMDE_FLOAT16_VALUE(  -819.50), SIMDE_FLOAT16_VALUE(   245.50),
+          SIMDE_FLOAT16_VALUE(   932.50), SIMDE_FLOAT16_VALUE(  -378.00), SIMDE_FLOAT16_VALUE(   626.50), SIMDE_FLOAT16_VALUE(  -972.50) },
+      { SIMDE_FLOAT16_VALUE(  -935.00), SIMDE_FLOAT16_VALUE(  -828.50), SIMDE_FLOAT16_VALUE(  -819.50), SIMDE_FLOAT16_VALUE(   245.50),
+          SIMDE_FLOAT16_VALUE(   830.00), SIMDE_FLOAT16_VALUE(  -378.00), SIMDE_FLOAT16_VALUE(   626.50), SIMDE_FLOAT16_VALUE(  -972.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -962.50), SIMDE_FLOAT16_VALUE(   242.88), SIMDE_FLOAT16_VALUE(  -346.00), SIMDE_FLOAT16_VALUE(   441.75),
+          SIMDE_FLOAT16_VALUE(  -633.00), SIMDE_FLOAT16_VALUE(  -744.50), SIMDE_FLOAT16_VALUE(  -415.00), SIMDE_FLOAT16_VALUE(  -443.50) },
+      { SIMDE_FLOAT16_VALUE(  -658.50), SIMDE_FLOAT16_VALUE(  -942.50), SIMDE_FLOAT16_VALUE(  -556.00), SIMDE_FLOAT16_VALUE(   891.00),
+          SIMDE_FLOAT16_VALUE(   -44.47), SIMDE_FLOAT16_VALUE(  -185.38), SIMDE_FLOAT16_VALUE(   906.50), SIMDE_FLOAT16_VALUE(  -196.88) },
+      { SIMDE_FLOAT16_VALUE(  -962.50), SIMDE_FLOAT16_VALUE(  -942.50), SIMDE_FLOAT16_VALUE(  -556.00), SIMDE_FLOAT16_VALUE(   441.75),
+          SIMDE_FLOAT16_VALUE(  -633.00), SIMDE_FLOAT16_VALUE(  -744.50), SIMDE_FLOAT16_VALUE(  -415.00), SIMDE_FLOAT16_VALUE(  -443.50) } },
+    { { SIMDE_FLOAT16_VALUE(   293.25), SIMDE_FLOAT16_VALUE(   -97.06), SIMDE_FLOAT16_VALUE(   503.75), SIMDE_FLOAT16_VALUE(   463.25),
+          SIMDE_FLOAT16_VALUE(   760.00), SIMDE_FLOAT16_VALUE(  -851.50), SIMDE_FLOAT16_VALUE(   -75.38), SIMDE_FLOAT16_VALUE(   331.25) },
+      { SIMDE_FLOAT16_VALUE(   770.00), SIMDE_FLOAT16_VALUE(   518.00), SIMDE_FLOAT16_VALUE(   178.62), SIMDE_FLOAT16_VALUE(  -229.50),
+          SIMDE_FLOAT16_VALUE(   321.50), SIMDE_FLOAT16_VALUE(    18.92), SIMDE_FLOAT16_VALUE(  -850.00), SIMDE_FLOAT16_VALUE(  -522.50) },
+      { SIMDE_FLOAT16_VALUE(   293.25), SIMDE_FLOAT16_VALUE(   -97.06), SIMDE_FLOAT16_VALUE(   178.62), SIMDE_FLOAT16_VALUE(  -229.50),
+          SIMDE_FLOAT16_VALUE(   321.50), SIMDE_FLOAT16_VALUE(  -851.50), SIMDE_FLOAT16_VALUE(  -850.00), SIMDE_FLOAT16_VALUE(  -522.50) } },
+    { { SIMDE_FLOAT16_VALUE(   268.50), SIMDE_FLOAT16_VALUE(   868.50), SIMDE_FLOAT16_VALUE(   486.75), SIMDE_FLOAT16_VALUE(  -729.00),
+          SIMDE_FLOAT16_VALUE(   185.88), SIMDE_FLOAT16_VALUE(   123.75), SIMDE_FLOAT16_VALUE(   386.50), SIMDE_FLOAT16_VALUE(   250.00) },
+      { SIMDE_FLOAT16_VALUE(   666.50), SIMDE_FLOAT16_VALUE(  -395.25), SIMDE_FLOAT16_VALUE(  -118.00), SIMDE_FLOAT16_VALUE(    10.49),
+          SIMDE_FLOAT16_VALUE(  -782.00), SIMDE_FLOAT16_VALUE(  -791.00), SIMDE_FLOAT16_VALUE(   387.25), SIMDE_FLOAT16_VALUE(   -46.25) },
+      { SIMDE_FLOAT16_VALUE(   268.50), SIMDE_FLOAT16_VALUE(  -395.25), SIMDE_FLOAT16_VALUE(  -118.00), SIMDE_FLOAT16_VALUE(  -729.00),
+          SIMDE_FLOAT16_VALUE(  -782.00), SIMDE_FLOAT16_VALUE(  -791.00), SIMDE_FLOAT16_VALUE(   386.50), SIMDE_FLOAT16_VALUE(   -46.25) } },
+    { { SIMDE_FLOAT16_VALUE(  -814.00), SIMDE_FLOAT16_VALUE(  -629.00), SIMDE_FLOAT16_VALUE(  -909.00), SIMDE_FLOAT16_VALUE(  -570.00),
+          SIMDE_FLOAT16_VALUE(   913.50), SIMDE_FLOAT16_VALUE(   159.50), SIMDE_FLOAT16_VALUE(   374.25), SIMDE_FLOAT16_VALUE(   321.75) },
+      { SIMDE_FLOAT16_VALUE(   270.75), SIMDE_FLOAT16_VALUE(   156.50), SIMDE_FLOAT16_VALUE(  -300.50), SIMDE_FLOAT16_VALUE(  -712.50),
+          SIMDE_FLOAT16_VALUE(   130.88), SIMDE_FLOAT16_VALUE(  -391.00), SIMDE_FLOAT16_VALUE(  -948.00), SIMDE_FLOAT16_VALUE(   361.75) },
+      { SIMDE_FLOAT16_VALUE(  -814.00), SIMDE_FLOAT16_VALUE(  -629.00), SIMDE_FLOAT16_VALUE(  -909.00), SIMDE_FLOAT16_VALUE(  -712.50),
+          SIMDE_FLOAT16_VALUE(   130.88), SIMDE_FLOAT16_VALUE(  -391.00), SIMDE_FLOAT16_VALUE(  -948.00), SIMDE_FLOAT16_VALUE(   321.75) } },
+    { { SIMDE_FLOAT16_VALUE(   993.50), SIMDE_FLOAT16_VALUE(  -934.50), SIMDE_FLOAT16_VALUE(  -573.00), SIMDE_FLOAT16_VALUE(   440.50),
+          SIMDE_FLOAT16_VALUE(  -680.00), SIMDE_FLOAT16_VALUE(  -335.50), SIMDE_FLOAT16_VALUE(  -652.00), SIMDE_FLOAT16_VALUE(   826.00) },
+      { SIMDE_FLOAT16_VALUE(   526.50), SIMDE_FLOAT16_VALUE(  -527.00), SIMDE_FLOAT16_VALUE(    11.86), SIMDE_FLOAT16_VALUE(   358.50),
+          SIMDE_FLOAT16_VALUE(   868.50), SIMDE_FLOAT16_VALUE(   922.50), SIMDE_FLOAT16_VALUE(   623.00), SIMDE_FLOAT16_VALUE(  -668.00) },
+      { SIMDE_FLOAT16_VALUE(   526.50), SIMDE_FLOAT16_VALUE(  -934.50), SIMDE_FLOAT16_VALUE(  -573.00), SIMDE_FLOAT16_VALUE(   358.50),
+          SIMDE_FLOAT16_VALUE(  -680.00), SIMDE_FLOAT16_VALUE(  -335.50), SIMDE_FLOAT16_VALUE(  -652.00), SIMDE_FLOAT16_VALUE(  -668.00) } },
+    { { SIMDE_FLOAT16_VALUE(   432.50), SIMDE_FLOAT16_VALUE(   159.25), SIMDE_FLOAT16_VALUE(   708.00), SIMDE_FLOAT16_VALUE(   144.75),
+          SIMDE_FLOAT16_VALUE(    11.55), SIMDE_FLOAT16_VALUE(  -292.00), SIMDE_FLOAT16_VALUE(  -303.50), SIMDE_FLOAT16_VALUE(  -574.50) },
+      { SIMDE_FLOAT16_VALUE(   451.50), SIMDE_FLOAT16_VALUE(  -582.50), SIMDE_FLOAT16_VALUE(  -664.50), SIMDE_FLOAT16_VALUE(   728.50),
+          SIMDE_FLOAT16_VALUE(  -965.00), SIMDE_FLOAT16_VALUE(   744.50), SIMDE_FLOAT16_VALUE(  -550.50), SIMDE_FLOAT16_VALUE(     9.90) },
+      { SIMDE_FLOAT16_VALUE(   432.50), SIMDE_FLOAT16_VALUE(  -582.50), SIMDE_FLOAT16_VALUE(  -664.50), SIMDE_FLOAT16_VALUE(   144.75),
+          SIMDE_FLOAT16_VALUE(  -965.00), SIMDE_FLOAT16_VALUE(  -292.00), SIMDE_FLOAT16_VALUE(  -550.50), SIMDE_FLOAT16_VALUE(  -574.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vminq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vminq_f32 (SIMDE_MUNIT_TEST_ARGS) {
   struct {
@@ -1013,6 +1197,8 @@ test_simde_x_vminq_u64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vminh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vmin_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmin_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmin_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmin_s8)
@@ -1024,6 +1210,7 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vmin_u16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmin_u32)
 SIMDE_TEST_FUNC_LIST_ENTRY(x_vmin_u64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vminq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vminq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vminq_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vminq_s8)
@@ -3,6 +3,108 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/minnm.h"
 
+static int
+test_simde_vminnmh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    {                SIMDE_NANHF,
+      SIMDE_FLOAT16_VALUE(     1.00),
+      SIMDE_FLOAT16_VALUE(     1.00) },
+    { SIMDE_FLOAT16_VALUE(    -2.50),
+                     SIMDE_NANHF,
+      SIMDE_FLOAT16_VALUE(    -2.50) },
+    #endif
+    { SIMDE_FLOAT16_VALUE(  -254.00),
+      SIMDE_FLOAT16_VALUE(   208.88),
+      SIMDE_FLOAT16_VALUE(  -254.00) },
+    { SIMDE_FLOAT16_VALUE(   758.00),
+      SIMDE_FLOAT16_VALUE(  -761.50),
+      SIMDE_FLOAT16_VALUE(  -761.50) },
+    { SIMDE_FLOAT16_VALUE(  -678.00),
+      SIMDE_FLOAT16_VALUE(  -529.50),
+      SIMDE_FLOAT16_VALUE(  -678.00) },
+    { SIMDE_FLOAT16_VALUE(   403.00),
+      SIMDE_FLOAT16_VALUE(  -205.00),
+      SIMDE_FLOAT16_VALUE(  -205.00) },
+    { SIMDE_FLOAT16_VALUE(  -585.00),
+      SIMDE_FLOAT16_VALUE(  -457.75),
+      SIMDE_FLOAT16_VALUE(  -585.00) },
+    { SIMDE_FLOAT16_VALUE(  -567.00),
+      SIMDE_FLOAT16_VALUE(   504.75),
+      SIMDE_FLOAT16_VALUE(  -567.00) },
+    { SIMDE_FLOAT16_VALUE(   460.25),
+      SIMDE_FLOAT16_VALUE(   931.50),
+      SIMDE_FLOAT16_VALUE(   460.25) },
+    { SIMDE_FLOAT16_VALUE(   454.75),
+      SIMDE_FLOAT16_VALUE(  -323.00),
+      SIMDE_FLOAT16_VALUE(  -323.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vminnmh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vminnm_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -238.62), SIMDE_FLOAT16_VALUE(   629.00), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(   910.00), SIMDE_FLOAT16_VALUE(   238.62),                SIMDE_NANHF },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(  -238.62), SIMDE_FLOAT16_VALUE(   238.62), SIMDE_FLOAT16_VALUE(     1.00) } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(   -51.06), SIMDE_FLOAT16_VALUE(    76.56),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -239.00), SIMDE_FLOAT16_VALUE(  -434.75), SIMDE_FLOAT16_VALUE(    -2.50) },
+      { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(  -239.00), SIMDE_FLOAT16_VALUE(  -434.75), SIMDE_FLOAT16_VALUE(    -2.50) } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(   426.75), SIMDE_FLOAT16_VALUE(  -140.50), SIMDE_FLOAT16_VALUE(  -407.00), SIMDE_FLOAT16_VALUE(   970.50) },
+      { SIMDE_FLOAT16_VALUE(  -184.50), SIMDE_FLOAT16_VALUE(   379.25), SIMDE_FLOAT16_VALUE(  -711.50), SIMDE_FLOAT16_VALUE(   316.50) },
+      { SIMDE_FLOAT16_VALUE(  -184.50), SIMDE_FLOAT16_VALUE(  -140.50), SIMDE_FLOAT16_VALUE(  -711.50), SIMDE_FLOAT16_VALUE(   316.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -136.75), SIMDE_FLOAT16_VALUE(  -183.12), SIMDE_FLOAT16_VALUE(  -726.50), SIMDE_FLOAT16_VALUE(   441.50) },
+      { SIMDE_FLOAT16_VALUE(   362.50), SIMDE_FLOAT16_VALUE(   168.88), SIMDE_FLOAT16_VALUE(   884.50), SIMDE_FLOAT16_VALUE(   664.00) },
+      { SIMDE_FLOAT16_VALUE(  -136.75), SIMDE_FLOAT16_VALUE(  -183.12), SIMDE_FLOAT16_VALUE(  -726.50), SIMDE_FLOAT16_VALUE(   441.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -200.00), SIMDE_FLOAT16_VALUE(  -929.00), SIMDE_FLOAT16_VALUE(   749.00), SIMDE_FLOAT16_VALUE(   236.00) },
+      { SIMDE_FLOAT16_VALUE(   454.00), SIMDE_FLOAT16_VALUE(   971.50), SIMDE_FLOAT16_VALUE(   683.50), SIMDE_FLOAT16_VALUE(  -454.75) },
+      { SIMDE_FLOAT16_VALUE(  -200.00), SIMDE_FLOAT16_VALUE(  -929.00), SIMDE_FLOAT16_VALUE(   683.50), SIMDE_FLOAT16_VALUE(  -454.75) } },
+    { { SIMDE_FLOAT16_VALUE(  -469.00), SIMDE_FLOAT16_VALUE(  -297.75), SIMDE_FLOAT16_VALUE(  -589.50), SIMDE_FLOAT16_VALUE(   682.50) },
+      { SIMDE_FLOAT16_VALUE(  -406.50), SIMDE_FLOAT16_VALUE(  -950.00), SIMDE_FLOAT16_VALUE(  -459.00), SIMDE_FLOAT16_VALUE(  -644.50) },
+      { SIMDE_FLOAT16_VALUE(  -469.00), SIMDE_FLOAT16_VALUE(  -950.00), SIMDE_FLOAT16_VALUE(  -589.50), SIMDE_FLOAT16_VALUE(  -644.50) } },
+    { { SIMDE_FLOAT16_VALUE(   458.75), SIMDE_FLOAT16_VALUE(   944.50), SIMDE_FLOAT16_VALUE(  -878.50), SIMDE_FLOAT16_VALUE(   824.50) },
+      { SIMDE_FLOAT16_VALUE(   871.00), SIMDE_FLOAT16_VALUE(  -756.50), SIMDE_FLOAT16_VALUE(   117.88), SIMDE_FLOAT16_VALUE(  -120.75) },
+      { SIMDE_FLOAT16_VALUE(   458.75), SIMDE_FLOAT16_VALUE(  -756.50), SIMDE_FLOAT16_VALUE(  -878.50), SIMDE_FLOAT16_VALUE(  -120.75) } },
+    { { SIMDE_FLOAT16_VALUE(  -427.00), SIMDE_FLOAT16_VALUE(  -522.00), SIMDE_FLOAT16_VALUE(  -457.00), SIMDE_FLOAT16_VALUE(  -493.00) },
+      { SIMDE_FLOAT16_VALUE(  -955.50), SIMDE_FLOAT16_VALUE(  -739.50), SIMDE_FLOAT16_VALUE(   801.00), SIMDE_FLOAT16_VALUE(  -206.38) },
+      { SIMDE_FLOAT16_VALUE(  -955.50), SIMDE_FLOAT16_VALUE(  -739.50), SIMDE_FLOAT16_VALUE(  -457.00), SIMDE_FLOAT16_VALUE(  -493.00) } },
+    { { SIMDE_FLOAT16_VALUE(     0.61), SIMDE_FLOAT16_VALUE(   427.75), SIMDE_FLOAT16_VALUE(  -720.50), SIMDE_FLOAT16_VALUE(  -396.25) },
+      { SIMDE_FLOAT16_VALUE(  -877.50), SIMDE_FLOAT16_VALUE(   994.50), SIMDE_FLOAT16_VALUE(  -953.50), SIMDE_FLOAT16_VALUE(  -508.75) },
+      { SIMDE_FLOAT16_VALUE(  -877.50), SIMDE_FLOAT16_VALUE(   427.75), SIMDE_FLOAT16_VALUE(  -953.50), SIMDE_FLOAT16_VALUE(  -508.75) } },
+    { { SIMDE_FLOAT16_VALUE(   683.50), SIMDE_FLOAT16_VALUE(   663.50), SIMDE_FLOAT16_VALUE(   983.50), SIMDE_FLOAT16_VALUE(  -826.00) },
+      { SIMDE_FLOAT16_VALUE(  -682.00), SIMDE_FLOAT16_VALUE(    90.56), SIMDE_FLOAT16_VALUE(  -274.50), SIMDE_FLOAT16_VALUE(   -81.19) },
+      { SIMDE_FLOAT16_VALUE(  -682.00), SIMDE_FLOAT16_VALUE(    90.56), SIMDE_FLOAT16_VALUE(  -274.50), SIMDE_FLOAT16_VALUE(  -826.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vminnm_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vminnm_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -129,6 +231,88 @@ test_simde_vminnm_f64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vminnmq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -652.00), SIMDE_FLOAT16_VALUE(  -378.25), SIMDE_FLOAT16_VALUE(   917.50),
+          SIMDE_FLOAT16_VALUE(   914.00), SIMDE_FLOAT16_VALUE(  -109.75), SIMDE_FLOAT16_VALUE(  -979.50), SIMDE_FLOAT16_VALUE(     1.00) },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(   382.50), SIMDE_FLOAT16_VALUE(   771.00), SIMDE_FLOAT16_VALUE(  -129.25),
+          SIMDE_FLOAT16_VALUE(  -333.00), SIMDE_FLOAT16_VALUE(  -263.75), SIMDE_FLOAT16_VALUE(   137.88),                SIMDE_NANHF },
+      { SIMDE_FLOAT16_VALUE(     1.00), SIMDE_FLOAT16_VALUE(  -652.00), SIMDE_FLOAT16_VALUE(  -378.25), SIMDE_FLOAT16_VALUE(  -129.25),
+          SIMDE_FLOAT16_VALUE(  -333.00), SIMDE_FLOAT16_VALUE(  -263.75), SIMDE_FLOAT16_VALUE(  -979.50), SIMDE_FLOAT16_VALUE(     1.00) } },
+    { { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(   565.00), SIMDE_FLOAT16_VALUE(    41.38), SIMDE_FLOAT16_VALUE(  -533.50),
+          SIMDE_FLOAT16_VALUE(     2.13), SIMDE_FLOAT16_VALUE(  -663.50), SIMDE_FLOAT16_VALUE(   732.50),                SIMDE_NANHF },
+      {                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(  -364.00), SIMDE_FLOAT16_VALUE(  -462.75), SIMDE_FLOAT16_VALUE(   702.50),
+          SIMDE_FLOAT16_VALUE(  -871.00), SIMDE_FLOAT16_VALUE(   318.50), SIMDE_FLOAT16_VALUE(   190.38), SIMDE_FLOAT16_VALUE(    -2.50) },
+      { SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(  -364.00), SIMDE_FLOAT16_VALUE(  -462.75), SIMDE_FLOAT16_VALUE(  -533.50),
+          SIMDE_FLOAT16_VALUE(  -871.00), SIMDE_FLOAT16_VALUE(  -663.50), SIMDE_FLOAT16_VALUE(   190.38), SIMDE_FLOAT16_VALUE(    -2.50) } },
+    #endif
+    { { SIMDE_FLOAT16_VALUE(   855.00), SIMDE_FLOAT16_VALUE(   284.50), SIMDE_FLOAT16_VALUE(  -877.50), SIMDE_FLOAT16_VALUE(   843.50),
+          SIMDE_FLOAT16_VALUE(   993.50), SIMDE_FLOAT16_VALUE(   857.00), SIMDE_FLOAT16_VALUE(  -737.00), SIMDE_FLOAT16_VALUE(  -999.00) },
+      { SIMDE_FLOAT16_VALUE(  -946.00), SIMDE_FLOAT16_VALUE(  -699.00), SIMDE_FLOAT16_VALUE(   833.50), SIMDE_FLOAT16_VALUE(   524.50),
+          SIMDE_FLOAT16_VALUE(  -559.00), SIMDE_FLOAT16_VALUE(  -368.00), SIMDE_FLOAT16_VALUE(  -263.00), SIMDE_FLOAT16_VALUE(   178.88) },
+      { SIMDE_FLOAT16_VALUE(  -946.00), SIMDE_FLOAT16_VALUE(  -699.00), SIMDE_FLOAT16_VALUE(  -877.50), SIMDE_FLOAT16_VALUE(   524.50),
+          SIMDE_FLOAT16_VALUE(  -559.00), SIMDE_FLOAT16_VALUE(  -368.00), SIMDE_FLOAT16_VALUE(  -737.00), SIMDE_FLOAT16_VALUE(  -999.00) } },
+    { { SIMDE_FLOAT16_VALUE(   213.62), SIMDE_FLOAT16_VALUE(   820.00), SIMDE_FLOAT16_VALUE(   169.88), SIMDE_FLOAT16_VALUE(  -751.00),
+          SIMDE_FLOAT16_VALUE(  -127.00), SIMDE_FLOAT16_VALUE(   103.62), SIMDE_FLOAT16_VALUE(   398.00), SIMDE_FLOAT16_VALUE(  -340.25) },
+      { SIMDE_FLOAT16_VALUE(   178.38), SIMDE_FLOAT16_VALUE(   420.50), SIMDE_FLOAT16_VALUE(   347.00), SIMDE_FLOAT16_VALUE(  -894.50),
+          SIMDE_FLOAT16_VALUE(   651.00), SIMDE_FLOAT16_VALUE(   310.75), SIMDE_FLOAT16_VALUE(   516.50), SIMDE_FLOAT16_VALUE(  -356.00) },
+      { SIMDE_FLOAT16_VALUE(   178.38), SIMDE_FLOAT16_VALUE(   420.50), SIMDE_FLOAT16_VALUE(   169.88), SIMDE_FLOAT16_VALUE(  -894.50),
+          SIMDE_FLOAT16_VALUE(  -127.00), SIMDE_FLOAT16_VALUE(   103.62), SIMDE_FLOAT16_VALUE(   398.00), SIMDE_FLOAT16_VALUE(  -356.00) } },
+    { { SIMDE_FLOAT16_VALUE(   387.00), SIMDE_FLOAT16_VALUE(  -653.50), SIMDE_FLOAT16_VALUE(  -733.50), SIMDE_FLOAT16_VALUE(  -196.25),
+          SIMDE_FLOAT16_VALUE(  -280.50), SIMDE_FLOAT16_VALUE(  -575.00), SIMDE_FLOAT16_VALUE(  -351.25), SIMDE_FLOAT16_VALUE(   271.00) },
+      { SIMDE_FLOAT16_VALUE(  -438.00), SIMDE_FLOAT16_VALUE(  -337.00), SIMDE_FLOAT16_VALUE(  -329.00), SIMDE_FLOAT16_VALUE(  -469.75),
+          SIMDE_FLOAT16_VALUE(  -999.00), SIMDE_FLOAT16_VALUE(   227.88), SIMDE_FLOAT16_VALUE(   357.75), SIMDE_FLOAT16_VALUE(   593.00) },
+      { SIMDE_FLOAT16_VALUE(  -438.00), SIMDE_FLOAT16_VALUE(  -653.50), SIMDE_FLOAT16_VALUE(  -733.50), SIMDE_FLOAT16_VALUE(  -469.75),
+          SIMDE_FLOAT16_VALUE(  -999.00), SIMDE_FLOAT16_VALUE(  -575.00), SIMDE_FLOAT16_VALUE(  -351.25), SIMDE_FLOAT16_VALUE(   271.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -635.50), SIMDE_FLOAT16_VALUE(    95.00), SIMDE_FLOAT16_VALUE(   968.50), SIMDE_FLOAT16_VALUE(   881.50),
+          SIMDE_FLOAT16_VALUE(  -255.50), SIMDE_FLOAT16_VALUE(  -687.50), SIMDE_FLOAT16_VALUE(  -738.00), SIMDE_FLOAT16_VALUE(  -683.50) },
+      { SIMDE_FLOAT16_VALUE(   590.50), SIMDE_FLOAT16_VALUE(  -262.50), SIMDE_FLOAT16_VALUE(    17.27), SIMDE_FLOAT16_VALUE(   802.50),
+          SIMDE_FLOAT16_VALUE(  -821.50), SIMDE_FLOAT16_VALUE(  -783.50), SIMDE_FLOAT16_VALUE(   535.00), SIMDE_FLOAT16_VALUE(   117.75) },
+      { SIMDE_FLOAT16_VALUE(  -635.50), SIMDE_FLOAT16_VALUE(  -262.50), SIMDE_FLOAT16_VALUE(    17.27), SIMDE_FLOAT16_VALUE(   802.50),
+          SIMDE_FLOAT16_VALUE(  -821.50), SIMDE_FLOAT16_VALUE(  -783.50), SIMDE_FLOAT16_VALUE(  -738.00), SIMDE_FLOAT16_VALUE(  -683.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -121.12), SIMDE_FLOAT16_VALUE(  -767.00), SIMDE_FLOAT16_VALUE(  -676.00), SIMDE_FLOAT16_VALUE(   732.50),
+          SIMDE_FLOAT16_VALUE(   -60.59), SIMDE_FLOAT16_VALUE(  -533.00), SIMDE_FLOAT16_VALUE(   987.50), SIMDE_FLOAT16_VALUE(    62.53) },
+      { SIMDE_FLOAT16_VALUE(  -780.50), SIMDE_FLOAT16_VALUE(   846.50), SIMDE_FLOAT16_VALUE(  -200.12), SIMDE_FLOAT16_VALUE(  -737.50),
+          SIMDE_FLOAT16_VALUE(  -383.75), SIMDE_FLOAT16_VALUE(  -763.50), SIMDE_FLOAT16_VALUE(  -872.00), SIMDE_FLOAT16_VALUE(  -716.00) },
+      { SIMDE_FLOAT16_VALUE(  -780.50), SIMDE_FLOAT16_VALUE(  -767.00), SIMDE_FLOAT16_VALUE(  -676.00), SIMDE_FLOAT16_VALUE(  -737.50),
+          SIMDE_FLOAT16_VALUE(  -383.75), SIMDE_FLOAT16_VALUE(  -763.50), SIMDE_FLOAT16_VALUE(  -872.00), SIMDE_FLOAT16_VALUE(  -716.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -552.50), SIMDE_FLOAT16_VALUE(  -281.00), SIMDE_FLOAT16_VALUE(   637.50), SIMDE_FLOAT16_VALUE(   905.50),
+          SIMDE_FLOAT16_VALUE(    14.00), SIMDE_FLOAT16_VALUE(    -2.15), SIMDE_FLOAT16_VALUE(  -205.88), SIMDE_FLOAT16_VALUE(  -283.50) },
+      { SIMDE_FLOAT16_VALUE(  -340.25), SIMDE_FLOAT16_VALUE(   593.00), SIMDE_FLOAT16_VALUE(  -881.00), SIMDE_FLOAT16_VALUE(   574.50),
+          SIMDE_FLOAT16_VALUE(   923.00), SIMDE_FLOAT16_VALUE(   222.00), SIMDE_FLOAT16_VALUE(  -217.25), SIMDE_FLOAT16_VALUE(  -288.75) },
+      { SIMDE_FLOAT16_VALUE(  -552.50), SIMDE_FLOAT16_VALUE(  -281.00), SIMDE_FLOAT16_VALUE(  -881.00), SIMDE_FLOAT16_VALUE(   574.50),
+          SIMDE_FLOAT16_VALUE(    14.00), SIMDE_FLOAT16_VALUE(    -2.15), SIMDE_FLOAT16_VALUE(  -217.25), SIMDE_FLOAT16_VALUE(  -288.75) } },
+    { { SIMDE_FLOAT16_VALUE(   137.00), SIMDE_FLOAT16_VALUE(  -401.25), SIMDE_FLOAT16_VALUE(   968.00), SIMDE_FLOAT16_VALUE(   508.25),
+          SIMDE_FLOAT16_VALUE(   543.00), SIMDE_FLOAT16_VALUE(   183.50), SIMDE_FLOAT16_VALUE(   791.00), SIMDE_FLOAT16_VALUE(   335.75) },
+      { SIMDE_FLOAT16_VALUE(  -500.75), SIMDE_FLOAT16_VALUE(   937.50), SIMDE_FLOAT16_VALUE(  -524.00), SIMDE_FLOAT16_VALUE(   370.50),
+          SIMDE_FLOAT16_VALUE(  -999.00), SIMDE_FLOAT16_VALUE(   618.50), SIMDE_FLOAT16_VALUE(  -611.00), SIMDE_FLOAT16_VALUE(   789.50) },
+      { SIMDE_FLOAT16_VALUE(  -500.75), SIMDE_FLOAT16_VALUE(  -401.25), SIMDE_FLOAT16_VALUE(  -524.00), SIMDE_FLOAT16_VALUE(   370.50),
+          SIMDE_FLOAT16_VALUE(  -999.00), SIMDE_FLOAT16_VALUE(   183.50), SIMDE_FLOAT16_VALUE(  -611.00), SIMDE_FLOAT16_VALUE(   335.75) } },
+    { { SIMDE_FLOAT16_VALUE(   373.25), SIMDE_FLOAT16_VALUE(  -156.12), SIMDE_FLOAT16_VALUE(  -807.00), SIMDE_FLOAT16_VALUE(  -997.50),
+          SIMDE_FLOAT16_VALUE(  -178.00), SIMDE_FLOAT16_VALUE(  -266.50), SIMDE_FLOAT16_VALUE(  -712.50), SIMDE_FLOAT16_VALUE(   169.00) },
+      { SIMDE_FLOAT16_VALUE(   347.00), SIMDE_FLOAT16_VALUE(  -297.75), SIMDE_FLOAT16_VALUE(   484.75), SIMDE_FLOAT16_VALUE(  -764.50),
+          SIMDE_FLOAT16_VALUE(  -397.75), SIMDE_FLOAT16_VALUE(  -274.00), SIMDE_FLOAT16_VALUE(  -478.50), SIMDE_FLOAT16_VALUE(   -74.81) },
+      { SIMDE_FLOAT16_VALUE(   347.00), SIMDE_FLOAT16_VALUE(  -297.75), SIMDE_FLOAT16_VALUE(  -807.00), SIMDE_FLOAT16_VALUE(  -997.50),
+          SIMDE_FLOAT16_VALUE(  -397.75), SIMDE_FLOAT16_VALUE(  -274.00), SIMDE_FLOAT16_VALUE(  -712.50), SIMDE_FLOAT16_VALUE(   -74.81) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vminnmq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vminnmq_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -256,8 +440,11 @@ test_simde_vminnmq_f64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vminnmh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vminnm_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vminnm_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vminnm_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vminnmq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vminnmq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vminnmq_f64)
 SIMDE_TEST_FUNC_LIST_END
@@ -0,0 +1,132 @@
+#define SIMDE_TEST_ARM_NEON_INSN minnmv
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/minnmv.h"
+
+static int
+test_simde_vminnmv_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT32_C(   185.37),            SIMDE_MATH_NANF },
+      SIMDE_FLOAT32_C(   185.37) },
+    { {            SIMDE_MATH_NANF,            SIMDE_MATH_NANF },
+                 SIMDE_MATH_NANF },
+    #endif
+    { { SIMDE_FLOAT32_C(  -783.78), SIMDE_FLOAT32_C(  -539.70) },
+      SIMDE_FLOAT32_C(  -783.78) },
+    { { SIMDE_FLOAT32_C(   922.55), SIMDE_FLOAT32_C(   518.32) },
+      SIMDE_FLOAT32_C(   518.32) },
+    { { SIMDE_FLOAT32_C(   -55.95), SIMDE_FLOAT32_C(  -863.29) },
+      SIMDE_FLOAT32_C(  -863.29) },
+    { { SIMDE_FLOAT32_C(   584.36), SIMDE_FLOAT32_C(    14.46) },
+      SIMDE_FLOAT32_C(    14.46) },
+    { { SIMDE_FLOAT32_C(   843.63), SIMDE_FLOAT32_C(    46.14) },
+      SIMDE_FLOAT32_C(    46.14) },
+    { { SIMDE_FLOAT32_C(  -800.18), SIMDE_FLOAT32_C(   823.54) },
+      SIMDE_FLOAT32_C(  -800.18) },
+    { { SIMDE_FLOAT32_C(   756.00), SIMDE_FLOAT32_C(  -182.99) },
+      SIMDE_FLOAT32_C(  -182.99) },
+    { { SIMDE_FLOAT32_C(   220.91), SIMDE_FLOAT32_C(   926.50) },
+      SIMDE_FLOAT32_C(   220.91) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32 r = simde_vminnmv_f32(a);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vminnmvq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT32_C(  -711.07),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -690.75), SIMDE_FLOAT32_C(   566.14) },
+      SIMDE_FLOAT32_C(  -711.07) },
+    { {            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,            SIMDE_MATH_NANF },
+                 SIMDE_MATH_NANF },
+    #endif
+    { { SIMDE_FLOAT32_C(   905.63), SIMDE_FLOAT32_C(  -985.65), SIMDE_FLOAT32_C(  -110.33), SIMDE_FLOAT32_C(   502.13) },
+      SIMDE_FLOAT32_C(  -985.65) },
+    { { SIMDE_FLOAT32_C(   303.96), SIMDE_FLOAT32_C(   945.15), SIMDE_FLOAT32_C(   991.25), SIMDE_FLOAT32_C(  -759.75) },
+      SIMDE_FLOAT32_C(  -759.75) },
+    { { SIMDE_FLOAT32_C(   282.05), SIMDE_FLOAT32_C(   -80.79), SIMDE_FLOAT32_C(  -838.24), SIMDE_FLOAT32_C(   205.60) },
+      SIMDE_FLOAT32_C(  -838.24) },
+    { { SIMDE_FLOAT32_C(   -58.15), SIMDE_FLOAT32_C(   760.43), SIMDE_FLOAT32_C(  -514.47), SIMDE_FLOAT32_C(  -454.58) },
+      SIMDE_FLOAT32_C(  -514.47) },
+    { { SIMDE_FLOAT32_C(   863.09), SIMDE_FLOAT32_C(   910.28), SIMDE_FLOAT32_C(    84.56), SIMDE_FLOAT32_C(   973.54) },
+      SIMDE_FLOAT32_C(    84.56) },
+    { { SIMDE_FLOAT32_C(  -741.60), SIMDE_FLOAT32_C(  -120.87), SIMDE_FLOAT32_C(  -949.99), SIMDE_FLOAT32_C(   757.48) },
+      SIMDE_FLOAT32_C(  -949.99) },
+    { { SIMDE_FLOAT32_C(  -763.76), SIMDE_FLOAT32_C(   768.76), SIMDE_FLOAT32_C(   701.33), SIMDE_FLOAT32_C(   612.61) },
+      SIMDE_FLOAT32_C(  -763.76) },
+    { { SIMDE_FLOAT32_C(   244.31), SIMDE_FLOAT32_C(  -104.64), SIMDE_FLOAT32_C(    32.19), SIMDE_FLOAT32_C(  -582.02) },
+      SIMDE_FLOAT32_C(  -582.02) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32 r = simde_vminnmvq_f32(a);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vminnmvq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT64_C(   987.57),             SIMDE_MATH_NAN },
+      SIMDE_FLOAT64_C(   987.57) },
+    { {             SIMDE_MATH_NAN,             SIMDE_MATH_NAN },
+                  SIMDE_MATH_NAN },
+    #endif
+    { { SIMDE_FLOAT64_C(   828.64), SIMDE_FLOAT64_C(   452.88) },
+      SIMDE_FLOAT64_C(   452.88) },
+    { { SIMDE_FLOAT64_C(   978.45), SIMDE_FLOAT64_C(   875.02) },
+      SIMDE_FLOAT64_C(   875.02) },
+    { { SIMDE_FLOAT64_C(  -140.61), SIMDE_FLOAT64_C(   715.25) },
+      SIMDE_FLOAT64_C(  -140.61) },
+    { { SIMDE_FLOAT64_C(   837.32), SIMDE_FLOAT64_C(   489.56) },
+      SIMDE_FLOAT64_C(   489.56) },
+    { { SIMDE_FLOAT64_C(  -904.25), SIMDE_FLOAT64_C(   160.56) },
+      SIMDE_FLOAT64_C(  -904.25) },
+    { { SIMDE_FLOAT64_C(   775.24), SIMDE_FLOAT64_C(   457.19) },
+      SIMDE_FLOAT64_C(   457.19) },
+    { { SIMDE_FLOAT64_C(  -568.49), SIMDE_FLOAT64_C(   -32.35) },
+      SIMDE_FLOAT64_C(  -568.49) },
+    { { SIMDE_FLOAT64_C(  -596.58), SIMDE_FLOAT64_C(  -952.79) },
+      SIMDE_FLOAT64_C(  -952.79) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64 r = simde_vminnmvq_f64(a);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vminnmv_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vminnmvq_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vminnmvq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -76,7 +76,19 @@ test_simde_vminv_s8 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT8_C(  12),  INT8_C( 119),  INT8_C( 101),  INT8_C( 103),  INT8_C( 125),  INT8_C(  95),  INT8_C(  49), -INT8_C(  10) },
       -INT8_C(  12) },
     { { -INT8_C(  40), -INT8_C(  70), -INT8_C(  69), -INT8_C(  84),  INT8_C(  81), -INT8_C( 125),  INT8_C(  67),  INT8_C( 112) },
-      -INT8_C( 125) }
+      -INT8_C( 125) },
+    { {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+           INT8_MIN },
+    { {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+           INT8_MAX },
+    { {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+           INT8_MIN },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN },
+           INT8_MIN },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX },
+       INT8_C(   0) },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C( 127) },
+      -INT8_C( 127) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -122,7 +134,19 @@ test_simde_vminv_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT16_C( 28507), -INT16_C( 32536),  INT16_C( 21483),  INT16_C(  8574) },
       -INT16_C( 32536) },
     { {  INT16_C( 10106),  INT16_C(  9641), -INT16_C( 24044), -INT16_C( 21850) },
-      -INT16_C( 24044) }
+      -INT16_C( 24044) },
+    { {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+            INT16_MIN },
+    { {       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX },
+            INT16_MAX },
+    { {       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX },
+            INT16_MIN },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MIN },
+            INT16_MIN },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MAX },
+       INT16_C(    0) },
+    { { -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(32767) },
+      -INT16_C(32767) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -168,7 +192,19 @@ test_simde_vminv_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT32_C(  1916821563), -INT32_C(  1362144109) },
       -INT32_C(  1916821563) },
     { {  INT32_C(  1927165586), -INT32_C(   405817533) },
-      -INT32_C(   405817533) }
+      -INT32_C(   405817533) },
+    { {            INT32_MIN,            INT32_MIN },
+                 INT32_MIN },
+    { {            INT32_MAX,            INT32_MAX },
+                 INT32_MAX },
+    { {            INT32_MIN,            INT32_MAX },
+                 INT32_MIN },
+    { {  INT32_C(         0),            INT32_MIN },
+                 INT32_MIN },
+    { {  INT32_C(         0),            INT32_MAX },
+       INT32_C(         0) },
+    { { -INT32_C(         1), -INT32_C(2147483647) },
+      -INT32_C(2147483647) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -214,7 +250,19 @@ test_simde_vminv_u8 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT8_C( 64), UINT8_C( 49), UINT8_C( 66), UINT8_C( 55), UINT8_C(181), UINT8_C(101), UINT8_C( 22), UINT8_C(148) },
       UINT8_C( 22) },
     { { UINT8_C(138), UINT8_C( 79), UINT8_C(130), UINT8_C(123), UINT8_C(143), UINT8_C(133), UINT8_C(242), UINT8_C( 36) },
-      UINT8_C( 36) }
+      UINT8_C( 36) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+          UINT8_MAX },
+    { { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX },
+      UINT8_C(   0) },
+    { { UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 128) },
+      UINT8_C( 127) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX, UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C( 254) },
+      UINT8_C(   1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -260,7 +308,19 @@ test_simde_vminv_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C(56348), UINT16_C(64227), UINT16_C(14437), UINT16_C(15970) },
       UINT16_C(14437) },
     { { UINT16_C(17679), UINT16_C(27814), UINT16_C(12826), UINT16_C( 3994) },
-      UINT16_C( 3994) }
+      UINT16_C( 3994) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+           UINT16_MAX },
+    { { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      UINT16_C(    0) },
+    { { UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32768) },
+      UINT16_C(32767) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(65534) },
+      UINT16_C(    1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -306,7 +366,19 @@ test_simde_vminv_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(1351933226), UINT32_C( 780521955) },
       UINT32_C( 780521955) },
     { { UINT32_C(3398641332), UINT32_C( 887687009) },
-      UINT32_C( 887687009) }
+      UINT32_C( 887687009) },
+    { {           UINT32_MAX,           UINT32_MAX },
+                UINT32_MAX },
+    { { UINT32_C(         0), UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         0),           UINT32_MAX },
+      UINT32_C(         0) },
+    { { UINT32_C(2147483647), UINT32_C(2147483648) },
+      UINT32_C(2147483647) },
+    { {           UINT32_MAX, UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         1), UINT32_C(4294967294) },
+      UINT32_C(         1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -462,7 +534,25 @@ test_simde_vminvq_s8 (SIMDE_MUNIT_TEST_ARGS) {
       -INT8_C( 126) },
     { { -INT8_C(  68), -INT8_C(  89), -INT8_C( 113),  INT8_C(  19),  INT8_C( 126),  INT8_C(  92), -INT8_C(  40), -INT8_C(  80),
         -INT8_C(   7), -INT8_C(  89),  INT8_C( 105), -INT8_C(  95),  INT8_C(  36), -INT8_C(   8), -INT8_C(  65),  INT8_C(  31) },
-      -INT8_C( 113) }
+      -INT8_C( 113) },
+    { {      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,
+             INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN,      INT8_MIN },
+           INT8_MIN },
+    { {      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,
+             INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX,      INT8_MAX },
+           INT8_MAX },
+    { {      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+             INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX },
+           INT8_MIN },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MIN },
+           INT8_MIN },
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),      INT8_MAX },
+       INT8_C(   0) },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C( 127) },
+      -INT8_C( 127) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -508,7 +598,19 @@ test_simde_vminvq_s16 (SIMDE_MUNIT_TEST_ARGS) {
     { {  INT16_C( 25266),  INT16_C( 11339),  INT16_C( 22460), -INT16_C( 24010),  INT16_C( 30965),  INT16_C( 11888),  INT16_C( 10071),  INT16_C( 19352) },
       -INT16_C( 24010) },
     { {  INT16_C( 10314),  INT16_C(  2469),  INT16_C( 23499),  INT16_C(  3839), -INT16_C( 15989),  INT16_C( 28222), -INT16_C(  3876), -INT16_C( 29026) },
-      -INT16_C( 29026) }
+      -INT16_C( 29026) },
+    { {       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN,       INT16_MIN },
+            INT16_MIN },
+    { {       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX },
+            INT16_MAX },
+    { {       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX },
+            INT16_MIN },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MIN },
+            INT16_MIN },
+    { {  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),       INT16_MAX },
+       INT16_C(    0) },
+    { { -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(    1), -INT16_C(32767) },
+      -INT16_C(32767) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -554,7 +656,19 @@ test_simde_vminvq_s32 (SIMDE_MUNIT_TEST_ARGS) {
     { { -INT32_C(  1748917665),  INT32_C(   657745840), -INT32_C(  1744404821),  INT32_C(  1910534409) },
       -INT32_C(  1748917665) },
     { { -INT32_C(  1135374247), -INT32_C(   153613248),  INT32_C(  1918425812), -INT32_C(  1570115005) },
-      -INT32_C(  1570115005) }
+      -INT32_C(  1570115005) },
+    { {            INT32_MIN,            INT32_MIN,            INT32_MIN,            INT32_MIN },
+                 INT32_MIN },
+    { {            INT32_MAX,            INT32_MAX,            INT32_MAX,            INT32_MAX },
+                 INT32_MAX },
+    { {            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX },
+                 INT32_MIN },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),            INT32_MIN },
+                 INT32_MIN },
+    { {  INT32_C(         0),  INT32_C(         0),  INT32_C(         0),            INT32_MAX },
+       INT32_C(         0) },
+    { { -INT32_C(         1), -INT32_C(         1), -INT32_C(         1), -INT32_C(2147483647) },
+      -INT32_C(2147483647) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -608,7 +722,25 @@ test_simde_vminvq_u8 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C( 30) },
     { { UINT8_C( 84), UINT8_C( 29), UINT8_C(185), UINT8_C( 61), UINT8_C(134), UINT8_C( 87), UINT8_C( 55), UINT8_C(205),
         UINT8_C(139), UINT8_C(203), UINT8_C(134), UINT8_C(191), UINT8_C(  1), UINT8_C(131), UINT8_C( 11), UINT8_C( 44) },
-      UINT8_C(  1) }
+      UINT8_C(  1) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX },
+          UINT8_MAX },
+    { { UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0),
+        UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0), UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX,
+        UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX },
+      UINT8_C(   0) },
+    { { UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127),
+        UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 127), UINT8_C( 128) },
+      UINT8_C( 127) },
+    { {     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,
+            UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX,     UINT8_MAX, UINT8_C(   0) },
+      UINT8_C(   0) },
+    { { UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1),
+        UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C(   1), UINT8_C( 254) },
+      UINT8_C(   1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -654,7 +786,19 @@ test_simde_vminvq_u16 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT16_C(46084), UINT16_C( 6465), UINT16_C(61567), UINT16_C( 9967), UINT16_C(56850), UINT16_C(49553), UINT16_C(37742), UINT16_C( 6962) },
       UINT16_C( 6465) },
     { { UINT16_C(10758), UINT16_C(34593), UINT16_C( 5735), UINT16_C(44622), UINT16_C(47802), UINT16_C(36649), UINT16_C(27077), UINT16_C(51525) },
-      UINT16_C( 5735) }
+      UINT16_C( 5735) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX },
+           UINT16_MAX },
+    { { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX },
+      UINT16_C(    0) },
+    { { UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32767), UINT16_C(32768) },
+      UINT16_C(32767) },
+    { {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) },
+      UINT16_C(    0) },
+    { { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(65534) },
+      UINT16_C(    1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -700,7 +844,19 @@ test_simde_vminvq_u32 (SIMDE_MUNIT_TEST_ARGS) {
     { { UINT32_C(3444499354), UINT32_C(2955113826), UINT32_C(2924053037), UINT32_C(2706626010) },
       UINT32_C(2706626010) },
     { { UINT32_C(2828700768), UINT32_C(4170204805), UINT32_C(2363713767), UINT32_C( 908446876) },
-      UINT32_C( 908446876) }
+      UINT32_C( 908446876) },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX,           UINT32_MAX },
+                UINT32_MAX },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(         0), UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         0),           UINT32_MAX, UINT32_C(         0),           UINT32_MAX },
+      UINT32_C(         0) },
+    { { UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483647), UINT32_C(2147483648) },
+      UINT32_C(2147483647) },
+    { {           UINT32_MAX,           UINT32_MAX,           UINT32_MAX, UINT32_C(         0) },
+      UINT32_C(         0) },
+    { { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(4294967294) },
+      UINT32_C(         1) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
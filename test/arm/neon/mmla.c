@@ -0,0 +1,222 @@
+#define SIMDE_TEST_ARM_NEON_INSN mmla
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/mmla.h"
+
+static int
+test_simde_vmmlaq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[4];
+    int8_t a[16];
+    int8_t b[16];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   614432136), -INT32_C(   526790272), -INT32_C(   117294631), -INT32_C(  1058824154) },
+      { -INT8_C( 117),  INT8_C(  24),  INT8_C( 109),  INT8_C(  89),  INT8_C(  66), -INT8_C(  11), -INT8_C(   2),  INT8_C( 107),
+         INT8_C(  49), -INT8_C(  49),  INT8_C(  13), -INT8_C(  32), -INT8_C(  71), -INT8_C( 112),  INT8_C(  86), -INT8_C( 120) },
+      { -INT8_C(   5), -INT8_C(  23), -INT8_C(  94), -INT8_C(  77), -INT8_C( 111),  INT8_C( 100), -INT8_C( 104), -INT8_C(   3),
+        -INT8_C( 106),  INT8_C(  77),  INT8_C(  96), -INT8_C(   9), -INT8_C(  17), -INT8_C( 100), -INT8_C(  57),  INT8_C(  20) },
+      {  INT32_C(   614406531), -INT32_C(   526764127), -INT32_C(   117304410), -INT32_C(  1058826480) } },
+    { { -INT32_C(    68025761),  INT32_C(   295939110),  INT32_C(   303504371), -INT32_C(    56246743) },
+      {  INT8_C(  26), -INT8_C(  55), -INT8_C(  15),  INT8_C(  83),  INT8_C(  25),  INT8_C(  12), -INT8_C(  97), -INT8_C(  39),
+         INT8_C(  90),  INT8_C( 125), -INT8_C( 104),  INT8_C(  48),  INT8_C(  67),  INT8_C(  35),  INT8_C(  85),  INT8_C(  81) },
+      { -INT8_C(  52),  INT8_C(  25),  INT8_C(  64), -INT8_C(  34),  INT8_C( 114), -INT8_C(   5), -INT8_C(  13),  INT8_C(  25),
+        -INT8_C(  55),  INT8_C( 109), -INT8_C(  99),  INT8_C(  83),  INT8_C(  85), -INT8_C(  60),  INT8_C(  70), -INT8_C(   4) },
+      { -INT32_C(    68029194),  INT32_C(   295934830),  INT32_C(   303502911), -INT32_C(    56214567) } },
+    { {  INT32_C(    21456134), -INT32_C(   200417207),  INT32_C(   344726916), -INT32_C(   734136909) },
+      {  INT8_C( 102),  INT8_C(  61), -INT8_C(  81), -INT8_C(  31), -INT8_C( 102),  INT8_C(   9),  INT8_C(  65), -INT8_C( 108),
+        -INT8_C(  91), -INT8_C(  32), -INT8_C(  17),  INT8_C( 117), -INT8_C(  22),  INT8_C(  42),  INT8_C(  27), -INT8_C( 121) },
+      { -INT8_C(  20), -INT8_C(  31), -INT8_C(  68),  INT8_C( 117), -INT8_C(   4), -INT8_C(  24),  INT8_C(  75), -INT8_C(   6),
+         INT8_C(  36),  INT8_C(  16),  INT8_C(  66),  INT8_C( 110),  INT8_C(  55),  INT8_C(  29),  INT8_C(   5),  INT8_C(  56) },
+      {  INT32_C(    21459799), -INT32_C(   200432387),  INT32_C(   344746404), -INT32_C(   734135582) } },
+    { {  INT32_C(  1062047884),  INT32_C(   927730426), -INT32_C(   650222707),  INT32_C(   942704177) },
+      {  INT8_C(  35), -INT8_C(  24),  INT8_C(  61),  INT8_C(  32),  INT8_C(  83), -INT8_C( 105), -INT8_C(  15), -INT8_C(  54),
+        -INT8_C( 120),  INT8_C(   5),  INT8_C(  85),  INT8_C(  23), -INT8_C(  50), -INT8_C(  28),  INT8_C(  40), -INT8_C(  11) },
+      {  INT8_C(  66), -INT8_C(   3),      INT8_MAX,  INT8_C(  44),  INT8_C(   3),  INT8_C( 122),  INT8_C( 123),  INT8_C( 107),
+        -INT8_C(  42),  INT8_C(  52), -INT8_C(  42), -INT8_C(  57),  INT8_C( 122), -INT8_C(  34), -INT8_C(  98), -INT8_C( 111) },
+      {  INT32_C(  1062039237),  INT32_C(   927744482), -INT32_C(   650218658),  INT32_C(   942696749) } },
+    { { -INT32_C(   754495145), -INT32_C(   865374092), -INT32_C(  1046323503),  INT32_C(   697469294) },
+      { -INT8_C(  58), -INT8_C(  10), -INT8_C(  94), -INT8_C(  51), -INT8_C( 124), -INT8_C(  17),  INT8_C( 105),  INT8_C(  63),
+        -INT8_C(  98),  INT8_C( 119),  INT8_C( 121), -INT8_C( 120), -INT8_C( 125),  INT8_C(  82), -INT8_C( 122), -INT8_C( 120) },
+      {  INT8_C(  12),  INT8_C(  18), -INT8_C( 120),  INT8_C(  92), -INT8_C(  37), -INT8_C(  74), -INT8_C(  79), -INT8_C(  52),
+        -INT8_C(   5), -INT8_C(  30),  INT8_C(   1),  INT8_C(  53),  INT8_C(   8),  INT8_C(  75), -INT8_C(  88),  INT8_C(  63) },
+      { -INT32_C(   754495158), -INT32_C(   865383837), -INT32_C(  1046333662),  INT32_C(   697468301) } },
+    { {  INT32_C(   670132620),  INT32_C(   897638480), -INT32_C(    29171877), -INT32_C(   103692289) },
+      {  INT8_C(  25), -INT8_C(  87), -INT8_C( 112), -INT8_C(  81),  INT8_C(  79),  INT8_C(  66),  INT8_C(  65),  INT8_C( 115),
+        -INT8_C( 100), -INT8_C( 124), -INT8_C(  41), -INT8_C(  86),      INT8_MAX,  INT8_C(  94),  INT8_C(  41), -INT8_C(  80) },
+      { -INT8_C( 107), -INT8_C(  11), -INT8_C(  20),  INT8_C( 115),  INT8_C(  10), -INT8_C( 105), -INT8_C(  90),  INT8_C(  15),
+        -INT8_C( 112), -INT8_C(  37),  INT8_C(  33), -INT8_C( 120), -INT8_C(  22), -INT8_C(  55),  INT8_C(  75), -INT8_C(  89) },
+      {  INT32_C(   670113562),  INT32_C(   897634195), -INT32_C(    29182373), -INT32_C(   103665303) } },
+    { {  INT32_C(   211642631), -INT32_C(   376023326), -INT32_C(    40921612),  INT32_C(   597673073) },
+      {  INT8_C(  41),  INT8_C(  68), -INT8_C(  57), -INT8_C(  88),  INT8_C(  49), -INT8_C( 101), -INT8_C(  78),  INT8_C(  95),
+        -INT8_C(  10), -INT8_C(  90),  INT8_C(  46),  INT8_C(  75),  INT8_C(  39), -INT8_C( 113),  INT8_C(  11),  INT8_C( 102) },
+      {  INT8_C( 123), -INT8_C(  12),  INT8_C(  54),  INT8_C(  64),  INT8_C(  93), -INT8_C(  33),  INT8_C(  66), -INT8_C(  85),
+         INT8_C(  23), -INT8_C(   2), -INT8_C(  91), -INT8_C(  86),  INT8_C(   9), -INT8_C(  50),  INT8_C(  66), -INT8_C(  50) },
+      {  INT32_C(   211632815), -INT32_C(   376014171), -INT32_C(    40915066),  INT32_C(   597664014) } },
+    { {  INT32_C(   599671837),  INT32_C(   286380829),  INT32_C(   475453884), -INT32_C(   616109092) },
+      { -INT8_C(  82), -INT8_C( 126),  INT8_C(  29),  INT8_C(  99),  INT8_C(  56),  INT8_C(  10), -INT8_C(  76), -INT8_C(  61),
+        -INT8_C(  84), -INT8_C(  33),  INT8_C(  92),  INT8_C( 101),  INT8_C(  80), -INT8_C(  76), -INT8_C( 115), -INT8_C(  83) },
+      {  INT8_C(  53), -INT8_C(  81),  INT8_C(  38),  INT8_C(  69), -INT8_C( 122),  INT8_C(  21),  INT8_C(  83),  INT8_C(  70),
+        -INT8_C(  85), -INT8_C(   4), -INT8_C(  42),  INT8_C(  66), -INT8_C(  42), -INT8_C(  57),  INT8_C(   9),  INT8_C(  26) },
+      {  INT32_C(   599668430),  INT32_C(   286388427),  INT32_C(   475435859), -INT32_C(   616101239) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r_ = simde_vld1q_s32(test_vec[i].r_);
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int32x4_t r = simde_vmmlaq_s32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vmmlaq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t r_[4];
+    uint8_t a[16];
+    uint8_t b[16];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1152798401), UINT32_C( 626785308), UINT32_C( 718150313), UINT32_C(1185247208) },
+      { UINT8_C(153), UINT8_C(247), UINT8_C( 39), UINT8_C(184), UINT8_C(128), UINT8_C(126), UINT8_C(253), UINT8_C(100),
+        UINT8_C(234), UINT8_C( 54), UINT8_C( 69), UINT8_C(155), UINT8_C(  3), UINT8_C(202), UINT8_C(170), UINT8_C(194) },
+      { UINT8_C(168), UINT8_C(225), UINT8_C(171), UINT8_C(220), UINT8_C( 69), UINT8_C(153), UINT8_C(164), UINT8_C(102),
+        UINT8_C(245), UINT8_C(160), UINT8_C( 90), UINT8_C(203), UINT8_C(163), UINT8_C(149), UINT8_C(251), UINT8_C(124) },
+      { UINT32_C(1153006631), UINT32_C( 627018716), UINT32_C( 718326455), UINT32_C(1185448166) } },
+    { { UINT32_C(1399670743), UINT32_C(3375271059), UINT32_C(1567729816), UINT32_C(3123357626) },
+      { UINT8_C(107), UINT8_C(224), UINT8_C(149), UINT8_C( 35), UINT8_C(209), UINT8_C(255), UINT8_C( 71), UINT8_C(155),
+        UINT8_C(123), UINT8_C(129), UINT8_C( 78), UINT8_C(216), UINT8_C(193), UINT8_C( 37), UINT8_C(229), UINT8_C(245) },
+      { UINT8_C(205), UINT8_C(214), UINT8_C( 18), UINT8_C(184), UINT8_C( 43), UINT8_C( 55), UINT8_C(127), UINT8_C(181),
+        UINT8_C( 85), UINT8_C( 22), UINT8_C(204), UINT8_C(169), UINT8_C(220), UINT8_C( 54), UINT8_C(  5), UINT8_C( 50) },
+      { UINT32_C(1399809820), UINT32_C(3375389248), UINT32_C(1567907547), UINT32_C(3123481188) } },
+    { { UINT32_C(1111272861), UINT32_C(2470617247), UINT32_C(1914604319), UINT32_C(1679908454) },
+      { UINT8_C( 77), UINT8_C(176), UINT8_C( 12), UINT8_C(247), UINT8_C( 53), UINT8_C(151), UINT8_C(212), UINT8_C( 43),
+        UINT8_C( 59), UINT8_C( 72), UINT8_C(178), UINT8_C(159), UINT8_C(175), UINT8_C(233), UINT8_C(105), UINT8_C(247) },
+      { UINT8_C(178), UINT8_C(243), UINT8_C( 49), UINT8_C(224), UINT8_C(231), UINT8_C(163), UINT8_C( 34), UINT8_C(153),
+        UINT8_C( 22), UINT8_C( 58), UINT8_C( 11), UINT8_C(175), UINT8_C( 55), UINT8_C( 84), UINT8_C(124), UINT8_C( 89) },
+      { UINT32_C(1111435894), UINT32_C(2470718220), UINT32_C(1914796420), UINT32_C(1680007911) } },
+    { { UINT32_C(2370436671), UINT32_C(1984507492), UINT32_C(3426335013), UINT32_C(2704799972) },
+      { UINT8_C( 95), UINT8_C(221), UINT8_C(202), UINT8_C( 14), UINT8_C(101), UINT8_C(230), UINT8_C(219), UINT8_C(199),
+        UINT8_C(  2), UINT8_C(109), UINT8_C(105), UINT8_C(142), UINT8_C( 32), UINT8_C( 52), UINT8_C( 95), UINT8_C(187) },
+      { UINT8_C(166), UINT8_C(100), UINT8_C(234), UINT8_C( 58), UINT8_C(134), UINT8_C(250), UINT8_C(160), UINT8_C(198),
+        UINT8_C(200), UINT8_C( 58), UINT8_C(178), UINT8_C(180), UINT8_C(234), UINT8_C( 88), UINT8_C(152), UINT8_C( 43) },
+      { UINT32_C(2370668097), UINT32_C(1984663505), UINT32_C(3426448565), UINT32_C(2704885489) } },
+    { { UINT32_C(2886690817), UINT32_C(1345122542), UINT32_C(1024662077), UINT32_C( 502291736) },
+      { UINT8_C(191), UINT8_C( 72), UINT8_C(198), UINT8_C(214), UINT8_C( 70), UINT8_C(196), UINT8_C(216), UINT8_C( 95),
+        UINT8_C(249), UINT8_C( 88), UINT8_C( 85), UINT8_C(250), UINT8_C(147), UINT8_C( 71), UINT8_C( 95), UINT8_C(161) },
+      { UINT8_C(230), UINT8_C( 27), UINT8_C(183), UINT8_C(  4), UINT8_C(248), UINT8_C( 69), UINT8_C( 99), UINT8_C(196),
+        UINT8_C(253), UINT8_C(209), UINT8_C(251), UINT8_C(212), UINT8_C(227), UINT8_C(250), UINT8_C( 85), UINT8_C( 42) },
+      { UINT32_C(2886844669), UINT32_C(1345368219), UINT32_C(1024820594), UINT32_C( 502513416) } },
+    { { UINT32_C(2428365056), UINT32_C( 947167036), UINT32_C( 140424329), UINT32_C(1239829538) },
+      { UINT8_C(234), UINT8_C(253), UINT8_C( 57), UINT8_C( 58), UINT8_C(137), UINT8_C(187), UINT8_C( 21), UINT8_C(225),
+        UINT8_C(111), UINT8_C(217), UINT8_C( 52), UINT8_C(126), UINT8_C(152), UINT8_C( 16), UINT8_C(230), UINT8_C(134) },
+      { UINT8_C(178), UINT8_C( 44), UINT8_C(224), UINT8_C( 60), UINT8_C(121), UINT8_C(107), UINT8_C(179), UINT8_C(219),
+        UINT8_C( 84), UINT8_C( 71), UINT8_C(105), UINT8_C(105), UINT8_C( 30), UINT8_C(179), UINT8_C(143), UINT8_C( 86) },
+      { UINT32_C(2428523708), UINT32_C( 947276666), UINT32_C( 140563463), UINT32_C(1239924797) } },
+    { { UINT32_C(3023887882), UINT32_C( 408988968), UINT32_C(3374517348), UINT32_C(3946081594) },
+      { UINT8_C(141), UINT8_C( 64), UINT8_C( 67), UINT8_C(127), UINT8_C( 74), UINT8_C(164), UINT8_C(126), UINT8_C(201),
+        UINT8_C(250), UINT8_C( 72), UINT8_C(137), UINT8_C(212), UINT8_C(192), UINT8_C(231), UINT8_C( 38), UINT8_C( 47) },
+      { UINT8_C(206), UINT8_C(142), UINT8_C(188), UINT8_C(232), UINT8_C(249), UINT8_C(167), UINT8_C(  1), UINT8_C( 47),
+        UINT8_C(234), UINT8_C(183), UINT8_C( 32), UINT8_C(203), UINT8_C(111), UINT8_C(219), UINT8_C(108), UINT8_C(253) },
+      { UINT32_C(3024023463), UINT32_C( 409170190), UINT32_C(3374742644), UINT32_C(3946288586) } },
+    { { UINT32_C(1153356934), UINT32_C(3557708750), UINT32_C(2482206102), UINT32_C( 207916194) },
+      { UINT8_C( 50), UINT8_C(235), UINT8_C(  8), UINT8_C( 63), UINT8_C( 80), UINT8_C(225), UINT8_C(233), UINT8_C(  0),
+        UINT8_C(219), UINT8_C(103), UINT8_C( 67), UINT8_C(154), UINT8_C( 81), UINT8_C(140), UINT8_C( 47), UINT8_C(184) },
+      { UINT8_C(128), UINT8_C( 42), UINT8_C(190), UINT8_C( 84), UINT8_C( 26), UINT8_C(202), UINT8_C(156), UINT8_C(119),
+        UINT8_C(219), UINT8_C( 46), UINT8_C( 48), UINT8_C(  0), UINT8_C(109), UINT8_C(244), UINT8_C( 39), UINT8_C( 67) },
+      { UINT32_C(1153463894), UINT32_C(3557803601), UINT32_C(2482323740), UINT32_C( 208029259) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t r_ = simde_vld1q_u32(test_vec[i].r_);
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+    simde_uint32x4_t r = simde_vmmlaq_u32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vusmmlaq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[4];
+    uint8_t a[16];
+    int8_t b[16];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   102259471),  INT32_C(   837805866), -INT32_C(  1033854685), -INT32_C(  1039113359) },
+      { UINT8_C(175), UINT8_C( 61), UINT8_C(216), UINT8_C( 67), UINT8_C(244), UINT8_C( 36), UINT8_C(117), UINT8_C(196),
+        UINT8_C( 45), UINT8_C( 52), UINT8_C( 52), UINT8_C(160), UINT8_C(188), UINT8_C(153), UINT8_C( 70), UINT8_C(195) },
+      { -INT8_C(  60), -INT8_C(  55), -INT8_C(  93), -INT8_C( 124), -INT8_C(  44),  INT8_C(  97),  INT8_C(  51), -INT8_C(  19),
+        -INT8_C(  51),  INT8_C(  82),  INT8_C(  98), -INT8_C(  17), -INT8_C(  84), -INT8_C(  77), -INT8_C(  57), -INT8_C(  65) },
+      { -INT32_C(   102306723),  INT32_C(   837779295), -INT32_C(  1033878487), -INT32_C(  1039153252) } },
+    { {  INT32_C(   575662667),  INT32_C(   436092243),  INT32_C(   770468797),  INT32_C(   277041135) },
+      { UINT8_C( 71), UINT8_C(126), UINT8_C(141), UINT8_C( 43), UINT8_C(127), UINT8_C(145), UINT8_C( 13), UINT8_C(154),
+        UINT8_C(105), UINT8_C( 96), UINT8_C(200), UINT8_C(151), UINT8_C( 27), UINT8_C(122), UINT8_C(253), UINT8_C(197) },
+      { -INT8_C(  71), -INT8_C(   5),      INT8_MAX, -INT8_C(  92), -INT8_C( 122),  INT8_C(  56),  INT8_C(  34), -INT8_C(  61),
+         INT8_C(  70),  INT8_C(  87),  INT8_C(  59), -INT8_C(  40),  INT8_C( 113), -INT8_C(  91), -INT8_C( 120), -INT8_C(  94) },
+      {  INT32_C(   575654621),  INT32_C(   436099894),  INT32_C(   770472493),  INT32_C(   277005668) } },
+    { { -INT32_C(  1014499507),  INT32_C(    52335375), -INT32_C(   147132936), -INT32_C(   902686766) },
+      { UINT8_C( 30), UINT8_C(203), UINT8_C(146), UINT8_C(212), UINT8_C(216), UINT8_C(205), UINT8_C( 42), UINT8_C( 78),
+        UINT8_C(142), UINT8_C( 42), UINT8_C(158), UINT8_C( 40), UINT8_C(104), UINT8_C( 79), UINT8_C(167), UINT8_C(200) },
+      { -INT8_C(  95),  INT8_C(  30),  INT8_C(  95), -INT8_C(   6), -INT8_C(  99), -INT8_C(   3), -INT8_C(  84),  INT8_C(  94),
+        -INT8_C(  69),  INT8_C( 104), -INT8_C( 100),  INT8_C(  30), -INT8_C(  39), -INT8_C(  67), -INT8_C( 122), -INT8_C(  58) },
+      { -INT32_C(  1014501864),  INT32_C(    52314370), -INT32_C(   147136157), -INT32_C(   902748119) } },
+    { { -INT32_C(  1024991351), -INT32_C(   370086020),  INT32_C(  1058335482),  INT32_C(   415345366) },
+      { UINT8_C(132), UINT8_C( 85), UINT8_C(190), UINT8_C( 64), UINT8_C(137), UINT8_C( 60), UINT8_C( 15), UINT8_C(171),
+        UINT8_C(219), UINT8_C(139), UINT8_C( 32), UINT8_C(134), UINT8_C( 39), UINT8_C(254), UINT8_C(233), UINT8_C(184) },
+      { -INT8_C( 100),      INT8_MAX, -INT8_C(  43),  INT8_C(  60), -INT8_C(  48),  INT8_C(   2), -INT8_C(  76), -INT8_C(  69),
+        -INT8_C(  12), -INT8_C( 127), -INT8_C( 106), -INT8_C( 122), -INT8_C(   3), -INT8_C( 105),  INT8_C( 113),  INT8_C(  58) },
+      { -INT32_C(  1025017481), -INT32_C(   370121445),  INT32_C(  1058306131),  INT32_C(   415315559) } },
+    { {  INT32_C(   571142488), -INT32_C(   429133078), -INT32_C(   305110482), -INT32_C(   921856427) },
+      { UINT8_C(214), UINT8_C(114), UINT8_C(164), UINT8_C(127), UINT8_C(213), UINT8_C(163), UINT8_C(138), UINT8_C( 39),
+        UINT8_C(190), UINT8_C( 61), UINT8_C( 26), UINT8_C( 91), UINT8_C(114), UINT8_C( 23), UINT8_C(205), UINT8_C( 35) },
+      {  INT8_C( 110),  INT8_C(  16),  INT8_C(  31),  INT8_C(  39), -INT8_C(  84),  INT8_C( 105), -INT8_C( 124),  INT8_C(  60),
+        -INT8_C(  26),  INT8_C(  21),  INT8_C(  27), -INT8_C(   4),  INT8_C( 109),  INT8_C(  60),  INT8_C( 124), -INT8_C(  28) },
+      {  INT32_C(   571162340), -INT32_C(   429083311), -INT32_C(   305114732), -INT32_C(   921821502) } },
+    { { -INT32_C(    20929915), -INT32_C(   427064138), -INT32_C(  1046349041),  INT32_C(   687349859) },
+      { UINT8_C( 12), UINT8_C(119), UINT8_C(177), UINT8_C(  4), UINT8_C(171), UINT8_C(  0), UINT8_C(192), UINT8_C(157),
+        UINT8_C( 53), UINT8_C(105), UINT8_C(121), UINT8_C(214), UINT8_C(251), UINT8_C( 30), UINT8_C( 72), UINT8_C(143) },
+      { -INT8_C(  81), -INT8_C( 106), -INT8_C(  10),  INT8_C(  83),  INT8_C(  62),  INT8_C( 106), -INT8_C(  85), -INT8_C(  80),
+        -INT8_C(  60),  INT8_C(  73), -INT8_C(  90), -INT8_C(  97),  INT8_C(  94), -INT8_C(  62), -INT8_C(   7),  INT8_C(  21) },
+      { -INT32_C(    20963217), -INT32_C(   427054462), -INT32_C(  1046346730),  INT32_C(   687346929) } },
+    { {  INT32_C(    47205717),  INT32_C(   279211141),  INT32_C(   613977054),  INT32_C(   327498008) },
+      { UINT8_C(162), UINT8_C(231), UINT8_C(139), UINT8_C(119), UINT8_C( 38), UINT8_C(103), UINT8_C( 69), UINT8_C( 55),
+        UINT8_C( 79), UINT8_C( 54), UINT8_C( 84), UINT8_C(230), UINT8_C(238), UINT8_C(160), UINT8_C(208), UINT8_C( 61) },
+      {  INT8_C(  55), -INT8_C(  22),  INT8_C( 103),  INT8_C(  29),  INT8_C( 109),  INT8_C(   7), -INT8_C(  67), -INT8_C(  82),
+        -INT8_C(  48),  INT8_C(  27), -INT8_C( 108), -INT8_C(  18),  INT8_C(  39), -INT8_C(  53), -INT8_C(  82), -INT8_C(   1) },
+      {  INT32_C(    47223043),  INT32_C(   279182758),  INT32_C(   614003657),  INT32_C(   327466147) } },
+    { {  INT32_C(   454161695),  INT32_C(   628115178), -INT32_C(   863500524),  INT32_C(   209769274) },
+      { UINT8_C(133), UINT8_C( 89), UINT8_C( 15), UINT8_C(207), UINT8_C(231), UINT8_C(127), UINT8_C( 48), UINT8_C(236),
+        UINT8_C( 52), UINT8_C( 71), UINT8_C( 62), UINT8_C(  6), UINT8_C( 31), UINT8_C(113), UINT8_C( 66), UINT8_C(101) },
+      {  INT8_C(  77),  INT8_C(  62), -INT8_C(  85),  INT8_C(   4), -INT8_C(  90), -INT8_C( 117), -INT8_C(  95), -INT8_C(  27),
+         INT8_C(  99), -INT8_C(  63), -INT8_C(  81),  INT8_C(  41), -INT8_C(  66), -INT8_C( 107),  INT8_C( 108), -INT8_C( 103) },
+      {  INT32_C(   454130426),  INT32_C(   628082051), -INT32_C(   863522372),  INT32_C(   209747761) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r_ = simde_vld1q_s32(test_vec[i].r_);
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int32x4_t r = simde_vusmmlaq_s32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vmmlaq_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vmmlaq_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vusmmlaq_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
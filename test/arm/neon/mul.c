@@ -3,6 +3,92 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/mul.h"
 
+static int
+test_simde_vmulh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(   -61.25),
+      SIMDE_FLOAT16_VALUE(    -5.49),
+      SIMDE_FLOAT16_VALUE(   336.25) },
+    { SIMDE_FLOAT16_VALUE(    79.12),
+      SIMDE_FLOAT16_VALUE(    -3.14),
+      SIMDE_FLOAT16_VALUE(  -248.50) },
+    { SIMDE_FLOAT16_VALUE(    78.69),
+      SIMDE_FLOAT16_VALUE(    -1.19),
+      SIMDE_FLOAT16_VALUE(   -93.69) },
+    { SIMDE_FLOAT16_VALUE(   -79.12),
+      SIMDE_FLOAT16_VALUE(    93.56),
+      SIMDE_FLOAT16_VALUE( -7404.00) },
+    { SIMDE_FLOAT16_VALUE(   -90.19),
+      SIMDE_FLOAT16_VALUE(    81.25),
+      SIMDE_FLOAT16_VALUE( -7328.00) },
+    { SIMDE_FLOAT16_VALUE(   -17.16),
+      SIMDE_FLOAT16_VALUE(    59.44),
+      SIMDE_FLOAT16_VALUE( -1019.50) },
+    { SIMDE_FLOAT16_VALUE(    96.56),
+      SIMDE_FLOAT16_VALUE(   -63.88),
+      SIMDE_FLOAT16_VALUE( -6168.00) },
+    { SIMDE_FLOAT16_VALUE(    88.81),
+      SIMDE_FLOAT16_VALUE(   -95.38),
+      SIMDE_FLOAT16_VALUE( -8472.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vmulh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vmul_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -93.44), SIMDE_FLOAT16_VALUE(   -85.75), SIMDE_FLOAT16_VALUE(   -33.59), SIMDE_FLOAT16_VALUE(     4.46) },
+      { SIMDE_FLOAT16_VALUE(   -57.41), SIMDE_FLOAT16_VALUE(    45.28), SIMDE_FLOAT16_VALUE(     2.88), SIMDE_FLOAT16_VALUE(    -0.75) },
+      { SIMDE_FLOAT16_VALUE(  5364.00), SIMDE_FLOAT16_VALUE( -3882.00), SIMDE_FLOAT16_VALUE(   -96.75), SIMDE_FLOAT16_VALUE(   -3.346) } },
+    { { SIMDE_FLOAT16_VALUE(   -93.44), SIMDE_FLOAT16_VALUE(   -81.88), SIMDE_FLOAT16_VALUE(    41.09), SIMDE_FLOAT16_VALUE(    63.91) },
+      { SIMDE_FLOAT16_VALUE(    93.88), SIMDE_FLOAT16_VALUE(    -1.17), SIMDE_FLOAT16_VALUE(   -91.06), SIMDE_FLOAT16_VALUE(    -5.28) },
+      { SIMDE_FLOAT16_VALUE( -8768.00), SIMDE_FLOAT16_VALUE(    95.81), SIMDE_FLOAT16_VALUE( -3742.00), SIMDE_FLOAT16_VALUE(  -337.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -13.24), SIMDE_FLOAT16_VALUE(     3.64), SIMDE_FLOAT16_VALUE(     4.65), SIMDE_FLOAT16_VALUE(   -26.95) },
+      { SIMDE_FLOAT16_VALUE(   -49.75), SIMDE_FLOAT16_VALUE(     8.96), SIMDE_FLOAT16_VALUE(   -56.22), SIMDE_FLOAT16_VALUE(   -47.00) },
+      { SIMDE_FLOAT16_VALUE(   659.00), SIMDE_FLOAT16_VALUE(    32.62), SIMDE_FLOAT16_VALUE(  -261.25), SIMDE_FLOAT16_VALUE(  1267.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -43.34), SIMDE_FLOAT16_VALUE(    38.34), SIMDE_FLOAT16_VALUE(    19.42), SIMDE_FLOAT16_VALUE(    13.09) },
+      { SIMDE_FLOAT16_VALUE(   -97.19), SIMDE_FLOAT16_VALUE(     2.49), SIMDE_FLOAT16_VALUE(     6.59), SIMDE_FLOAT16_VALUE(    43.78) },
+      { SIMDE_FLOAT16_VALUE(  4212.00), SIMDE_FLOAT16_VALUE(    95.50), SIMDE_FLOAT16_VALUE(   128.00), SIMDE_FLOAT16_VALUE(   573.50) } },
+    { { SIMDE_FLOAT16_VALUE(    35.56), SIMDE_FLOAT16_VALUE(     5.64), SIMDE_FLOAT16_VALUE(   -61.84), SIMDE_FLOAT16_VALUE(   -57.16) },
+      { SIMDE_FLOAT16_VALUE(   -33.78), SIMDE_FLOAT16_VALUE(    46.91), SIMDE_FLOAT16_VALUE(   -63.22), SIMDE_FLOAT16_VALUE(   -29.42) },
+      { SIMDE_FLOAT16_VALUE( -1201.00), SIMDE_FLOAT16_VALUE(   264.50), SIMDE_FLOAT16_VALUE(  3910.00), SIMDE_FLOAT16_VALUE(  1682.00) } },
+    { { SIMDE_FLOAT16_VALUE(    46.00), SIMDE_FLOAT16_VALUE(    18.41), SIMDE_FLOAT16_VALUE(    -2.29), SIMDE_FLOAT16_VALUE(    -9.64) },
+      { SIMDE_FLOAT16_VALUE(     5.19), SIMDE_FLOAT16_VALUE(     1.66), SIMDE_FLOAT16_VALUE(    54.84), SIMDE_FLOAT16_VALUE(    69.88) },
+      { SIMDE_FLOAT16_VALUE(   238.75), SIMDE_FLOAT16_VALUE(    30.56), SIMDE_FLOAT16_VALUE(  -125.56), SIMDE_FLOAT16_VALUE(  -673.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -58.12), SIMDE_FLOAT16_VALUE(   -56.38), SIMDE_FLOAT16_VALUE(    20.55), SIMDE_FLOAT16_VALUE(    10.79) },
+      { SIMDE_FLOAT16_VALUE(    31.38), SIMDE_FLOAT16_VALUE(   -47.59), SIMDE_FLOAT16_VALUE(   -44.16), SIMDE_FLOAT16_VALUE(   -80.06) },
+      { SIMDE_FLOAT16_VALUE( -1824.00), SIMDE_FLOAT16_VALUE(  2684.00), SIMDE_FLOAT16_VALUE(  -907.50), SIMDE_FLOAT16_VALUE(  -864.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -42.62), SIMDE_FLOAT16_VALUE(    12.79), SIMDE_FLOAT16_VALUE(   -73.62), SIMDE_FLOAT16_VALUE(    98.62) },
+      { SIMDE_FLOAT16_VALUE(   -57.50), SIMDE_FLOAT16_VALUE(    52.56), SIMDE_FLOAT16_VALUE(   -28.34), SIMDE_FLOAT16_VALUE(   -42.03) },
+      { SIMDE_FLOAT16_VALUE(  2450.00), SIMDE_FLOAT16_VALUE(   672.00), SIMDE_FLOAT16_VALUE(  2086.00), SIMDE_FLOAT16_VALUE( -4144.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vmul_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vmul_f32 (SIMDE_MUNIT_TEST_ARGS) {
   struct {
@@ -471,6 +557,74 @@ test_simde_x_vmul_u64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vmulq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -18.97), SIMDE_FLOAT16_VALUE(   -46.06), SIMDE_FLOAT16_VALUE(    41.78), SIMDE_FLOAT16_VALUE(   -24.47),
+          SIMDE_FLOAT16_VALUE(    48.59), SIMDE_FLOAT16_VALUE(    72.56), SIMDE_FLOAT16_VALUE(    78.06), SIMDE_FLOAT16_VALUE(    93.19) },
+      { SIMDE_FLOAT16_VALUE(    88.81), SIMDE_FLOAT16_VALUE(    21.84), SIMDE_FLOAT16_VALUE(    26.81), SIMDE_FLOAT16_VALUE(   -42.62),
+          SIMDE_FLOAT16_VALUE(    38.34), SIMDE_FLOAT16_VALUE(    -9.94), SIMDE_FLOAT16_VALUE(   -95.81), SIMDE_FLOAT16_VALUE(    23.05) },
+      { SIMDE_FLOAT16_VALUE( -1685.00), SIMDE_FLOAT16_VALUE( -1006.00), SIMDE_FLOAT16_VALUE(  1120.00), SIMDE_FLOAT16_VALUE(  1043.00),
+          SIMDE_FLOAT16_VALUE(  1863.00), SIMDE_FLOAT16_VALUE(  -721.00), SIMDE_FLOAT16_VALUE( -7480.00), SIMDE_FLOAT16_VALUE(  2148.00) } },
+    { { SIMDE_FLOAT16_VALUE(    19.34), SIMDE_FLOAT16_VALUE(   -39.72), SIMDE_FLOAT16_VALUE(    18.55), SIMDE_FLOAT16_VALUE(    65.31),
+          SIMDE_FLOAT16_VALUE(   -41.56), SIMDE_FLOAT16_VALUE(    28.25), SIMDE_FLOAT16_VALUE(   -32.59), SIMDE_FLOAT16_VALUE(   -18.02) },
+      { SIMDE_FLOAT16_VALUE(   -85.56), SIMDE_FLOAT16_VALUE(   -33.28), SIMDE_FLOAT16_VALUE(   -12.19), SIMDE_FLOAT16_VALUE(     5.92),
+          SIMDE_FLOAT16_VALUE(   -16.42), SIMDE_FLOAT16_VALUE(   -93.31), SIMDE_FLOAT16_VALUE(   -24.70), SIMDE_FLOAT16_VALUE(   -13.37) },
+      { SIMDE_FLOAT16_VALUE( -1655.00), SIMDE_FLOAT16_VALUE(  1322.00), SIMDE_FLOAT16_VALUE(  -226.00), SIMDE_FLOAT16_VALUE(   386.75),
+          SIMDE_FLOAT16_VALUE(   682.50), SIMDE_FLOAT16_VALUE( -2636.00), SIMDE_FLOAT16_VALUE(   805.00), SIMDE_FLOAT16_VALUE(   240.88) } },
+    { { SIMDE_FLOAT16_VALUE(   -25.80), SIMDE_FLOAT16_VALUE(   -87.06), SIMDE_FLOAT16_VALUE(   -49.50), SIMDE_FLOAT16_VALUE(    -1.22),
+          SIMDE_FLOAT16_VALUE(   -80.50), SIMDE_FLOAT16_VALUE(     8.29), SIMDE_FLOAT16_VALUE(    24.05), SIMDE_FLOAT16_VALUE(   -36.94) },
+      { SIMDE_FLOAT16_VALUE(   -46.19), SIMDE_FLOAT16_VALUE(    52.94), SIMDE_FLOAT16_VALUE(    67.44), SIMDE_FLOAT16_VALUE(    92.19),
+          SIMDE_FLOAT16_VALUE(    23.20), SIMDE_FLOAT16_VALUE(    46.44), SIMDE_FLOAT16_VALUE(     9.47), SIMDE_FLOAT16_VALUE(    52.16) },
+      { SIMDE_FLOAT16_VALUE(  1191.00), SIMDE_FLOAT16_VALUE( -4608.00), SIMDE_FLOAT16_VALUE( -3338.00), SIMDE_FLOAT16_VALUE(  -112.44),
+          SIMDE_FLOAT16_VALUE( -1868.00), SIMDE_FLOAT16_VALUE(   385.00), SIMDE_FLOAT16_VALUE(   227.75), SIMDE_FLOAT16_VALUE( -1927.00) } },
+    { { SIMDE_FLOAT16_VALUE(    67.50), SIMDE_FLOAT16_VALUE(   -58.53), SIMDE_FLOAT16_VALUE(    79.56), SIMDE_FLOAT16_VALUE(   -13.96),
+          SIMDE_FLOAT16_VALUE(    51.41), SIMDE_FLOAT16_VALUE(   -13.77), SIMDE_FLOAT16_VALUE(    90.50), SIMDE_FLOAT16_VALUE(   -69.69) },
+      { SIMDE_FLOAT16_VALUE(   -57.44), SIMDE_FLOAT16_VALUE(   -95.69), SIMDE_FLOAT16_VALUE(    56.62), SIMDE_FLOAT16_VALUE(   -73.69),
+          SIMDE_FLOAT16_VALUE(   -71.75), SIMDE_FLOAT16_VALUE(   -16.89), SIMDE_FLOAT16_VALUE(   -19.47), SIMDE_FLOAT16_VALUE(   -75.06) },
+      { SIMDE_FLOAT16_VALUE( -3878.00), SIMDE_FLOAT16_VALUE(  5600.00), SIMDE_FLOAT16_VALUE(  4504.00), SIMDE_FLOAT16_VALUE(  1029.00),
+          SIMDE_FLOAT16_VALUE( -3688.00), SIMDE_FLOAT16_VALUE(   232.62), SIMDE_FLOAT16_VALUE( -1762.00), SIMDE_FLOAT16_VALUE(  5232.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -90.69), SIMDE_FLOAT16_VALUE(    22.72), SIMDE_FLOAT16_VALUE(    35.69), SIMDE_FLOAT16_VALUE(     4.20),
+          SIMDE_FLOAT16_VALUE(    61.69), SIMDE_FLOAT16_VALUE(   -36.66), SIMDE_FLOAT16_VALUE(   -71.31), SIMDE_FLOAT16_VALUE(    63.34) },
+      { SIMDE_FLOAT16_VALUE(    -4.82), SIMDE_FLOAT16_VALUE(    61.88), SIMDE_FLOAT16_VALUE(    65.75), SIMDE_FLOAT16_VALUE(   -92.56),
+          SIMDE_FLOAT16_VALUE(     6.76), SIMDE_FLOAT16_VALUE(    10.39), SIMDE_FLOAT16_VALUE(    83.81), SIMDE_FLOAT16_VALUE(    47.28) },
+      { SIMDE_FLOAT16_VALUE(   437.25), SIMDE_FLOAT16_VALUE(  1406.00), SIMDE_FLOAT16_VALUE(  2346.00), SIMDE_FLOAT16_VALUE(  -388.75),
+          SIMDE_FLOAT16_VALUE(   417.00), SIMDE_FLOAT16_VALUE(  -381.00), SIMDE_FLOAT16_VALUE( -5976.00), SIMDE_FLOAT16_VALUE(  2994.00) } },
+    { { SIMDE_FLOAT16_VALUE(    76.00), SIMDE_FLOAT16_VALUE(    32.75), SIMDE_FLOAT16_VALUE(   -90.50), SIMDE_FLOAT16_VALUE(    91.81),
+          SIMDE_FLOAT16_VALUE(   -59.69), SIMDE_FLOAT16_VALUE(   -41.44), SIMDE_FLOAT16_VALUE(   -71.88), SIMDE_FLOAT16_VALUE(   -12.93) },
+      { SIMDE_FLOAT16_VALUE(    65.69), SIMDE_FLOAT16_VALUE(    34.94), SIMDE_FLOAT16_VALUE(     4.57), SIMDE_FLOAT16_VALUE(   -74.94),
+          SIMDE_FLOAT16_VALUE(   -73.06), SIMDE_FLOAT16_VALUE(   -46.31), SIMDE_FLOAT16_VALUE(    24.81), SIMDE_FLOAT16_VALUE(    54.47) },
+      { SIMDE_FLOAT16_VALUE(  4992.00), SIMDE_FLOAT16_VALUE(  1144.00), SIMDE_FLOAT16_VALUE(  -413.50), SIMDE_FLOAT16_VALUE( -6880.00),
+          SIMDE_FLOAT16_VALUE(  4360.00), SIMDE_FLOAT16_VALUE(  1919.00), SIMDE_FLOAT16_VALUE( -1783.00), SIMDE_FLOAT16_VALUE(  -704.50) } },
+    { { SIMDE_FLOAT16_VALUE(    49.69), SIMDE_FLOAT16_VALUE(    92.12), SIMDE_FLOAT16_VALUE(     4.39), SIMDE_FLOAT16_VALUE(    17.72),
+          SIMDE_FLOAT16_VALUE(   -73.62), SIMDE_FLOAT16_VALUE(   -54.31), SIMDE_FLOAT16_VALUE(    72.50), SIMDE_FLOAT16_VALUE(    -3.84) },
+      { SIMDE_FLOAT16_VALUE(   -99.12), SIMDE_FLOAT16_VALUE(    16.06), SIMDE_FLOAT16_VALUE(   -58.72), SIMDE_FLOAT16_VALUE(    68.94),
+          SIMDE_FLOAT16_VALUE(   -85.94), SIMDE_FLOAT16_VALUE(    15.14), SIMDE_FLOAT16_VALUE(   -33.62), SIMDE_FLOAT16_VALUE(    52.81) },
+      { SIMDE_FLOAT16_VALUE( -4924.00), SIMDE_FLOAT16_VALUE(  1480.00), SIMDE_FLOAT16_VALUE(  -257.75), SIMDE_FLOAT16_VALUE(  1221.00),
+          SIMDE_FLOAT16_VALUE(  6328.00), SIMDE_FLOAT16_VALUE(  -822.50), SIMDE_FLOAT16_VALUE( -2438.00), SIMDE_FLOAT16_VALUE(  -202.75) } },
+    { { SIMDE_FLOAT16_VALUE(    88.00), SIMDE_FLOAT16_VALUE(   -27.67), SIMDE_FLOAT16_VALUE(    47.06), SIMDE_FLOAT16_VALUE(    71.31),
+          SIMDE_FLOAT16_VALUE(    16.36), SIMDE_FLOAT16_VALUE(   -40.53), SIMDE_FLOAT16_VALUE(    30.80), SIMDE_FLOAT16_VALUE(   -22.09) },
+      { SIMDE_FLOAT16_VALUE(    58.78), SIMDE_FLOAT16_VALUE(   -63.69), SIMDE_FLOAT16_VALUE(     1.92), SIMDE_FLOAT16_VALUE(   -23.55),
+          SIMDE_FLOAT16_VALUE(   -90.62), SIMDE_FLOAT16_VALUE(    12.82), SIMDE_FLOAT16_VALUE(   -82.00), SIMDE_FLOAT16_VALUE(   -21.19) },
+      { SIMDE_FLOAT16_VALUE(  5172.00), SIMDE_FLOAT16_VALUE(  1762.00), SIMDE_FLOAT16_VALUE(    90.38), SIMDE_FLOAT16_VALUE( -1679.00),
+          SIMDE_FLOAT16_VALUE( -1483.00), SIMDE_FLOAT16_VALUE(  -519.50), SIMDE_FLOAT16_VALUE( -2526.00), SIMDE_FLOAT16_VALUE(   468.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vmulq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vmulq_f32 (SIMDE_MUNIT_TEST_ARGS) {
   struct {
@@ -985,6 +1139,8 @@ test_simde_x_vmulq_u64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vmulh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vmul_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmul_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmul_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmul_s8)
@@ -996,6 +1152,7 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vmul_u16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmul_u32)
 SIMDE_TEST_FUNC_LIST_ENTRY(x_vmul_u64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vmulq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmulq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmulq_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmulq_s8)
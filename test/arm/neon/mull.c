@@ -265,6 +265,42 @@ test_simde_vmull_u32 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+#if defined(SIMDE_HAVE_INT128_)
+static int
+test_simde_vmull_p64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r[2];
+  } test_vec[] = {
+    { UINT64_C(13881863943914174270), UINT64_C(14359690638073801109),
+      { UINT64_C( 7237800114726996262), UINT64_C( 5912090762893853899) } },
+    { UINT64_C( 4941442884886851468), UINT64_C(12562203490864097477),
+      { UINT64_C(17356233737885619388), UINT64_C( 2985959979141253115) } },
+    { UINT64_C(16497570225032277965), UINT64_C( 7511364316932363706),
+      { UINT64_C(13766100866166336258), UINT64_C( 2491567208409243388) } },
+    { UINT64_C(15954620006559743631), UINT64_C(13030640760838457608),
+      { UINT64_C( 4763810315284939640), UINT64_C( 8929996681748750407) } },
+    { UINT64_C(17196142770217049409), UINT64_C( 2275577289127368877),
+      { UINT64_C(17051729392332100333), UINT64_C(  823097863356128245) } },
+    { UINT64_C(13898848613702566051), UINT64_C( 7908499229381521861),
+      { UINT64_C( 3309173380391782511), UINT64_C( 3292326275601644394) } },
+    { UINT64_C(12157502334964912527), UINT64_C( 4684332822242548952),
+      { UINT64_C(18394622563835593928), UINT64_C( 3064672231136899178) } },
+    { UINT64_C( 9739378429866099114), UINT64_C(14870932717174729945),
+      { UINT64_C( 2263409050260820442), UINT64_C( 7297053414501256958) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_poly128_t r = simde_vmull_p64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u64(HEDLEY_STATIC_CAST(uint64_t, r), test_vec[i].r[0]);
+    simde_assert_equal_u64(HEDLEY_STATIC_CAST(uint64_t, r >> 64), test_vec[i].r[1]);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_s8)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_s16)
@@ -272,6 +308,9 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vmull_s32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_u8)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_u16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_u32)
+#if defined(SIMDE_HAVE_INT128_)
+SIMDE_TEST_FUNC_LIST_ENTRY(vmull_p64)
+#endif
 
 SIMDE_TEST_FUNC_LIST_END
 
@@ -383,6 +383,50 @@ test_simde_vmull_high_u32 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+#if defined(SIMDE_HAVE_INT128_)
+static int
+test_simde_vmull_high_p64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 6008122467852929870), UINT64_C(10632568482670090897) },
+      { UINT64_C( 3495650644386502616), UINT64_C(11517158005912768593) },
+      { UINT64_C( 1513944082744641473), UINT64_C( 5188099843628556835) } },
+    { { UINT64_C( 5581626142692564974), UINT64_C(13591325099852299433) },
+      { UINT64_C(13264045803930979954), UINT64_C( 8632726575392486070) },
+      { UINT64_C( 9509810258266104518), UINT64_C( 3475916318068829392) } },
+    { { UINT64_C( 2075055320744988071), UINT64_C( 6108806163427407386) },
+      { UINT64_C( 7210754848751995447), UINT64_C(11024608466173247459) },
+      { UINT64_C( 2608400022866355438), UINT64_C( 3295133300691428620) } },
+    { { UINT64_C( 4026284096415397693), UINT64_C( 5408258576159504323) },
+      { UINT64_C( 5718624311920651731), UINT64_C( 4408213243504260075) },
+      { UINT64_C( 9740762505617283709), UINT64_C( 1073101703227480262) } },
+    { { UINT64_C( 5001335457615094891), UINT64_C(12127958445289720845) },
+      { UINT64_C( 5370819752579802084), UINT64_C( 1535835999854378640) },
+      { UINT64_C( 2136189172694282320), UINT64_C(  625200085936288439) } },
+    { { UINT64_C( 5269935881475484013), UINT64_C( 6090899119345311816) },
+      { UINT64_C(10480210576716596948), UINT64_C(11012999857695458625) },
+      { UINT64_C( 6962222743730543176), UINT64_C( 3284256332566565536) } },
+    { { UINT64_C( 9885801502408278509), UINT64_C( 3070010891871413536) },
+      { UINT64_C( 2621040925997397560), UINT64_C( 5165291848058103282) },
+      { UINT64_C( 9792197239822238784), UINT64_C(  748398141577051474) } },
+    { { UINT64_C(12188576898168918776), UINT64_C(17497039236527455424) },
+      { UINT64_C( 3323856576629754897), UINT64_C( 5576701472261617838) },
+      { UINT64_C( 2882586143032677504), UINT64_C( 4051661164964928325) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_poly128_t r = simde_vmull_high_p64(simde_vreinterpretq_p64_u64(simde_vld1q_u64(test_vec[i].a)), simde_vreinterpretq_p64_u64(simde_vld1q_u64(test_vec[i].b)));
+    simde_assert_equal_u64(HEDLEY_STATIC_CAST(uint64_t, r), test_vec[i].r[0]);
+    simde_assert_equal_u64(HEDLEY_STATIC_CAST(uint64_t, r >> 64), test_vec[i].r[1]);
+  }
+
+  return 0;
+}
+#endif
+
 SIMDE_TEST_FUNC_LIST_BEGIN
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_high_s8)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_high_s16)
@@ -390,6 +434,9 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vmull_high_s32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_high_u8)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_high_u16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vmull_high_u32)
+#if defined(SIMDE_HAVE_INT128_)
+SIMDE_TEST_FUNC_LIST_ENTRY(vmull_high_p64)
+#endif
 
 SIMDE_TEST_FUNC_LIST_END
 
@@ -3,6 +3,73 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/neg.h"
 
+static int
+test_simde_vnegh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(  -746.50),
+      SIMDE_FLOAT16_VALUE(   746.50) },
+    { SIMDE_FLOAT16_VALUE(   977.00),
+      SIMDE_FLOAT16_VALUE(  -977.00) },
+    { SIMDE_FLOAT16_VALUE(  -411.75),
+      SIMDE_FLOAT16_VALUE(   411.75) },
+    { SIMDE_FLOAT16_VALUE(  -175.38),
+      SIMDE_FLOAT16_VALUE(   175.38) },
+    { SIMDE_FLOAT16_VALUE(  -268.50),
+      SIMDE_FLOAT16_VALUE(   268.50) },
+    { SIMDE_FLOAT16_VALUE(   139.62),
+      SIMDE_FLOAT16_VALUE(  -139.62) },
+    { SIMDE_FLOAT16_VALUE(   816.50),
+      SIMDE_FLOAT16_VALUE(  -816.50) },
+    { SIMDE_FLOAT16_VALUE(  -654.50),
+      SIMDE_FLOAT16_VALUE(   654.50) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vnegh_f16(test_vec[i].a);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vneg_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -304.75), SIMDE_FLOAT16_VALUE(   874.50), SIMDE_FLOAT16_VALUE(   524.00), SIMDE_FLOAT16_VALUE(    40.19) },
+      { SIMDE_FLOAT16_VALUE(   304.75), SIMDE_FLOAT16_VALUE(  -874.50), SIMDE_FLOAT16_VALUE(  -524.00), SIMDE_FLOAT16_VALUE(   -40.19) } },
+    { { SIMDE_FLOAT16_VALUE(   608.50), SIMDE_FLOAT16_VALUE(   892.50), SIMDE_FLOAT16_VALUE(  -978.00), SIMDE_FLOAT16_VALUE(  -730.50) },
+      { SIMDE_FLOAT16_VALUE(  -608.50), SIMDE_FLOAT16_VALUE(  -892.50), SIMDE_FLOAT16_VALUE(   978.00), SIMDE_FLOAT16_VALUE(   730.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -655.50), SIMDE_FLOAT16_VALUE(   801.00), SIMDE_FLOAT16_VALUE(   177.62), SIMDE_FLOAT16_VALUE(   507.50) },
+      { SIMDE_FLOAT16_VALUE(   655.50), SIMDE_FLOAT16_VALUE(  -801.00), SIMDE_FLOAT16_VALUE(  -177.62), SIMDE_FLOAT16_VALUE(  -507.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -699.00), SIMDE_FLOAT16_VALUE(   101.56), SIMDE_FLOAT16_VALUE(  -477.75), SIMDE_FLOAT16_VALUE(   761.50) },
+      { SIMDE_FLOAT16_VALUE(   699.00), SIMDE_FLOAT16_VALUE(  -101.56), SIMDE_FLOAT16_VALUE(   477.75), SIMDE_FLOAT16_VALUE(  -761.50) } },
+    { { SIMDE_FLOAT16_VALUE(   577.00), SIMDE_FLOAT16_VALUE(  -803.00), SIMDE_FLOAT16_VALUE(    15.39), SIMDE_FLOAT16_VALUE(   396.00) },
+      { SIMDE_FLOAT16_VALUE(  -577.00), SIMDE_FLOAT16_VALUE(   803.00), SIMDE_FLOAT16_VALUE(   -15.39), SIMDE_FLOAT16_VALUE(  -396.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -837.50), SIMDE_FLOAT16_VALUE(  -860.00), SIMDE_FLOAT16_VALUE(   679.00), SIMDE_FLOAT16_VALUE(   206.25) },
+      { SIMDE_FLOAT16_VALUE(   837.50), SIMDE_FLOAT16_VALUE(   860.00), SIMDE_FLOAT16_VALUE(  -679.00), SIMDE_FLOAT16_VALUE(  -206.25) } },
+    { { SIMDE_FLOAT16_VALUE(   732.50), SIMDE_FLOAT16_VALUE(   976.50), SIMDE_FLOAT16_VALUE(  -359.25), SIMDE_FLOAT16_VALUE(  -152.25) },
+      { SIMDE_FLOAT16_VALUE(  -732.50), SIMDE_FLOAT16_VALUE(  -976.50), SIMDE_FLOAT16_VALUE(   359.25), SIMDE_FLOAT16_VALUE(   152.25) } },
+    { { SIMDE_FLOAT16_VALUE(  -402.25), SIMDE_FLOAT16_VALUE(  -884.50), SIMDE_FLOAT16_VALUE(   200.12), SIMDE_FLOAT16_VALUE(    38.56) },
+      { SIMDE_FLOAT16_VALUE(   402.25), SIMDE_FLOAT16_VALUE(   884.50), SIMDE_FLOAT16_VALUE(  -200.12), SIMDE_FLOAT16_VALUE(   -38.56) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t r = simde_vneg_f16(a);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vneg_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -279,6 +346,56 @@ test_simde_vneg_s64 (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_vnegq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -982.00), SIMDE_FLOAT16_VALUE(    19.20), SIMDE_FLOAT16_VALUE(  -308.75), SIMDE_FLOAT16_VALUE(   717.00),
+          SIMDE_FLOAT16_VALUE(   813.50), SIMDE_FLOAT16_VALUE(   498.75), SIMDE_FLOAT16_VALUE(   542.00), SIMDE_FLOAT16_VALUE(   373.50) },
+      { SIMDE_FLOAT16_VALUE(   982.00), SIMDE_FLOAT16_VALUE(   -19.20), SIMDE_FLOAT16_VALUE(   308.75), SIMDE_FLOAT16_VALUE(  -717.00),
+          SIMDE_FLOAT16_VALUE(  -813.50), SIMDE_FLOAT16_VALUE(  -498.75), SIMDE_FLOAT16_VALUE(  -542.00), SIMDE_FLOAT16_VALUE(  -373.50) } },
+    { { SIMDE_FLOAT16_VALUE(   192.25), SIMDE_FLOAT16_VALUE(  -470.25), SIMDE_FLOAT16_VALUE(  -898.50), SIMDE_FLOAT16_VALUE(   691.50),
+          SIMDE_FLOAT16_VALUE(  -606.50), SIMDE_FLOAT16_VALUE(   903.50), SIMDE_FLOAT16_VALUE(   360.50), SIMDE_FLOAT16_VALUE(    67.12) },
+      { SIMDE_FLOAT16_VALUE(  -192.25), SIMDE_FLOAT16_VALUE(   470.25), SIMDE_FLOAT16_VALUE(   898.50), SIMDE_FLOAT16_VALUE(  -691.50),
+          SIMDE_FLOAT16_VALUE(   606.50), SIMDE_FLOAT16_VALUE(  -903.50), SIMDE_FLOAT16_VALUE(  -360.50), SIMDE_FLOAT16_VALUE(   -67.12) } },
+    { { SIMDE_FLOAT16_VALUE(   372.50), SIMDE_FLOAT16_VALUE(   901.50), SIMDE_FLOAT16_VALUE(  -867.00), SIMDE_FLOAT16_VALUE(   633.00),
+          SIMDE_FLOAT16_VALUE(   526.00), SIMDE_FLOAT16_VALUE(   250.38), SIMDE_FLOAT16_VALUE(   600.00), SIMDE_FLOAT16_VALUE(   185.75) },
+      { SIMDE_FLOAT16_VALUE(  -372.50), SIMDE_FLOAT16_VALUE(  -901.50), SIMDE_FLOAT16_VALUE(   867.00), SIMDE_FLOAT16_VALUE(  -633.00),
+          SIMDE_FLOAT16_VALUE(  -526.00), SIMDE_FLOAT16_VALUE(  -250.38), SIMDE_FLOAT16_VALUE(  -600.00), SIMDE_FLOAT16_VALUE(  -185.75) } },
+    { { SIMDE_FLOAT16_VALUE(   924.50), SIMDE_FLOAT16_VALUE(   965.00), SIMDE_FLOAT16_VALUE(  -579.00), SIMDE_FLOAT16_VALUE(  -144.00),
+          SIMDE_FLOAT16_VALUE(  -209.62), SIMDE_FLOAT16_VALUE(  -399.00), SIMDE_FLOAT16_VALUE(   366.75), SIMDE_FLOAT16_VALUE(    16.44) },
+      { SIMDE_FLOAT16_VALUE(  -924.50), SIMDE_FLOAT16_VALUE(  -965.00), SIMDE_FLOAT16_VALUE(   579.00), SIMDE_FLOAT16_VALUE(   144.00),
+          SIMDE_FLOAT16_VALUE(   209.62), SIMDE_FLOAT16_VALUE(   399.00), SIMDE_FLOAT16_VALUE(  -366.75), SIMDE_FLOAT16_VALUE(   -16.44) } },
+    { { SIMDE_FLOAT16_VALUE(  -990.00), SIMDE_FLOAT16_VALUE(   100.75), SIMDE_FLOAT16_VALUE(  -779.00), SIMDE_FLOAT16_VALUE(  -131.50),
+          SIMDE_FLOAT16_VALUE(   589.00), SIMDE_FLOAT16_VALUE(  -318.75), SIMDE_FLOAT16_VALUE(   272.75), SIMDE_FLOAT16_VALUE(   496.25) },
+      { SIMDE_FLOAT16_VALUE(   990.00), SIMDE_FLOAT16_VALUE(  -100.75), SIMDE_FLOAT16_VALUE(   779.00), SIMDE_FLOAT16_VALUE(   131.50),
+          SIMDE_FLOAT16_VALUE(  -589.00), SIMDE_FLOAT16_VALUE(   318.75), SIMDE_FLOAT16_VALUE(  -272.75), SIMDE_FLOAT16_VALUE(  -496.25) } },
+    { { SIMDE_FLOAT16_VALUE(    72.94), SIMDE_FLOAT16_VALUE(   946.50), SIMDE_FLOAT16_VALUE(  -820.00), SIMDE_FLOAT16_VALUE(   -74.00),
+          SIMDE_FLOAT16_VALUE(  -551.00), SIMDE_FLOAT16_VALUE(   749.50), SIMDE_FLOAT16_VALUE(   819.50), SIMDE_FLOAT16_VALUE(  -868.50) },
+      { SIMDE_FLOAT16_VALUE(   -72.94), SIMDE_FLOAT16_VALUE(  -946.50), SIMDE_FLOAT16_VALUE(   820.00), SIMDE_FLOAT16_VALUE(    74.00),
+          SIMDE_FLOAT16_VALUE(   551.00), SIMDE_FLOAT16_VALUE(  -749.50), SIMDE_FLOAT16_VALUE(  -819.50), SIMDE_FLOAT16_VALUE(   868.50) } },
+    { { SIMDE_FLOAT16_VALUE(   877.00), SIMDE_FLOAT16_VALUE(  -694.50), SIMDE_FLOAT16_VALUE(    13.00), SIMDE_FLOAT16_VALUE(   535.50),
+          SIMDE_FLOAT16_VALUE(  -547.00), SIMDE_FLOAT16_VALUE(   494.75), SIMDE_FLOAT16_VALUE(  -695.50), SIMDE_FLOAT16_VALUE(  -541.50) },
+      { SIMDE_FLOAT16_VALUE(  -877.00), SIMDE_FLOAT16_VALUE(   694.50), SIMDE_FLOAT16_VALUE(   -13.00), SIMDE_FLOAT16_VALUE(  -535.50),
+          SIMDE_FLOAT16_VALUE(   547.00), SIMDE_FLOAT16_VALUE(  -494.75), SIMDE_FLOAT16_VALUE(   695.50), SIMDE_FLOAT16_VALUE(   541.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -563.00), SIMDE_FLOAT16_VALUE(    -9.71), SIMDE_FLOAT16_VALUE(    85.62), SIMDE_FLOAT16_VALUE(   191.62),
+          SIMDE_FLOAT16_VALUE(  -526.50), SIMDE_FLOAT16_VALUE(    15.76), SIMDE_FLOAT16_VALUE(   698.50), SIMDE_FLOAT16_VALUE(   934.50) },
+      { SIMDE_FLOAT16_VALUE(   563.00), SIMDE_FLOAT16_VALUE(     9.71), SIMDE_FLOAT16_VALUE(   -85.62), SIMDE_FLOAT16_VALUE(  -191.62),
+          SIMDE_FLOAT16_VALUE(   526.50), SIMDE_FLOAT16_VALUE(   -15.76), SIMDE_FLOAT16_VALUE(  -698.50), SIMDE_FLOAT16_VALUE(  -934.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t r = simde_vnegq_f16(a);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vnegq_f32 (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -569,6 +686,8 @@ test_simde_vnegq_s64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vnegh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vneg_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vneg_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vneg_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vneg_s8)
@@ -576,6 +695,7 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vneg_s16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vneg_s32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vneg_s64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vnegq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vnegq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vnegq_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vnegq_s8)
@@ -0,0 +1,187 @@
+#define SIMDE_TEST_ARM_NEON_INSN qdmlal
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qdmlal.h"
+
+static int
+test_simde_vqdmlalh_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a;
+    int16_t b;
+    int16_t c;
+    int32_t r;
+  } test_vec[] = {
+    { -INT32_C( 672292332),
+           INT16_MIN,
+           INT16_MIN,
+       INT32_C(1475191315) },
+    {  INT32_C(1964373499),
+           INT16_MIN,
+       INT16_C(30350),
+      -INT32_C(  24644101) },
+    { -INT32_C( 310528597),
+           INT16_MAX,
+       INT16_C(25194),
+       INT32_C(1340534999) },
+    {  INT32_C( 805741695),
+      -INT16_C( 7081),
+           INT16_MAX,
+       INT32_C( 341695441) },
+    { -INT32_C(1995961798),
+       INT16_C(14789),
+       INT16_C(  371),
+      -INT32_C(1984988360) },
+    {           INT32_MIN,
+      -INT16_C( 3021),
+       INT16_C(11122),
+                INT32_MIN }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i32(simde_vqdmlalh_s16(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqdmlals_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a;
+    int32_t b;
+    int32_t c;
+    int64_t r;
+  } test_vec[] = {
+    {                    INT64_MAX,
+                INT32_MIN,
+                INT32_MIN,
+                         INT64_MAX },
+    { -INT64_C( 296143363596049712),
+      -INT32_C( 448919084),
+       INT32_C(1466441717),
+      -INT64_C(1612770708266104168) },
+    { -INT64_C(1035113845276664108),
+      -INT32_C(1791963883),
+       INT32_C( 201281681),
+      -INT64_C(1756492850599718754) },
+    {  INT64_C(7553842939543321913),
+       INT32_C(1940341669),
+       INT32_C( 330372340),
+       INT64_C(8835913374717392833) },
+    {                    INT64_MAX,
+      -INT32_C(1357140911),
+      -INT32_C(1294174761),
+                         INT64_MAX },
+    {                    INT64_MIN,
+       INT32_C( 299020964),
+      -INT32_C(1683261457),
+                         INT64_MIN }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i64(simde_vqdmlals_s32(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqdmlal_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int16_t b[4];
+    int16_t c[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C( 655520986), -INT32_C( 561573115), -INT32_C(1544305220),  INT32_C(1441269860) },
+      {      INT16_MIN,  INT16_C(32072), -INT16_C(31459), -INT16_C( 9815) },
+      {      INT16_MIN, -INT16_C(26649), -INT16_C( 2032),  INT16_C(16872) },
+      {           INT32_MAX,           INT32_MIN, -INT32_C(1416455844),  INT32_C(1110072500) } },
+    { {           INT32_MIN,           INT32_MIN,           INT32_MIN,  INT32_C( 149839934) },
+      {  INT16_C( 3035), -INT16_C(22191),  INT16_C(12152), -INT16_C(17748) },
+      {  INT16_C(13597),  INT16_C(31359), -INT16_C(24441), -INT16_C(17424) },
+      { -INT32_C(2064949858),           INT32_MIN,           INT32_MIN,  INT32_C( 768322238) } },
+    { { -INT32_C(2070699251),  INT32_C(2002822930),  INT32_C( 879422219),  INT32_C(1095010667) },
+      {  INT16_C(10631),      INT16_MAX,      INT16_MIN,      INT16_MIN },
+      {  INT16_C(27594), -INT16_C(29651), -INT16_C( 7958),  INT16_C( 4856) },
+      { -INT32_C(1483995623),  INT32_C(  59674296),  INT32_C(1400957707),  INT32_C( 776767851) } },
+    { {           INT32_MIN, -INT32_C(  74375799),           INT32_MIN,  INT32_C( 424845756) },
+      {  INT16_C(14675),  INT16_C(21246), -INT16_C( 5916), -INT16_C(20783) },
+      { -INT16_C(19310),  INT16_C( 7208),  INT16_C(10846),  INT16_C(14433) },
+      {           INT32_MIN,  INT32_C( 231906537),           INT32_MIN, -INT32_C( 175076322) } },
+    { { -INT32_C( 317283473),           INT32_MIN,  INT32_C(1318994703), -INT32_C( 903120925) },
+      {  INT16_C( 6489),  INT16_C(24962), -INT16_C(25590),      INT16_MAX },
+      { -INT16_C(29161),  INT16_C(27184),  INT16_C( 1012),  INT16_C( 6956) },
+      { -INT32_C( 695734931), -INT32_C( 790349632),  INT32_C(1267200543), -INT32_C( 447266421) } },
+    { {           INT32_MIN,           INT32_MAX, -INT32_C(1017472264),  INT32_C(1793114596) },
+      { -INT16_C( 9241),  INT16_C(16648), -INT16_C( 8961), -INT16_C( 8984) },
+      {  INT16_C(30795), -INT16_C( 3353),  INT16_C(19384),      INT16_MIN },
+      {           INT32_MIN,  INT32_C(2035842159), -INT32_C(1364872312),           INT32_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_int16x4_t c = simde_vld1_s16(test_vec[i].c);
+    simde_int32x4_t r = simde_vqdmlal_s16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqdmlal_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int32_t b[2];
+    int32_t c[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {                    INT64_MIN,                    INT64_MIN },
+      {           INT32_MIN,  INT32_C( 557384143) },
+      {           INT32_MIN,           INT32_MIN },
+      { -INT64_C(                  1),                    INT64_MIN } },
+    { { -INT64_C(  26458511810152032), -INT64_C(7494453242011413791) },
+      { -INT32_C( 741323715), -INT32_C(1302907069) },
+      { -INT32_C(1827122344),  INT32_C(2025732425) },
+      {  INT64_C(2682519735817023888),                    INT64_MIN } },
+    { { -INT64_C(7289358748987375650), -INT64_C(7513183967425088677) },
+      {  INT32_C(2130767072),  INT32_C(2015548403) },
+      {  INT32_C( 266955959), -INT32_C(1386124921) },
+      { -INT64_C(6151716814764611554),                    INT64_MIN } },
+    { {  INT64_C(2040625834074869386),                    INT64_MIN },
+      {  INT32_C( 468381030),  INT32_C( 233564451) },
+      { -INT32_C(1689146530),           INT32_MIN },
+      {  INT64_C( 458297450990217586),                    INT64_MIN } },
+    { { -INT64_C(7748152607861375327), -INT64_C(6172100032578054299) },
+      {           INT32_MIN,  INT32_C(1555925721) },
+      {           INT32_MIN,  INT32_C(1794523373) },
+      {  INT64_C(1475219428993400480), -INT64_C( 587809886605300433) } },
+    { { -INT64_C(3428232799739159262),                    INT64_MIN },
+      {  INT32_C(2028376279), -INT32_C( 261469085) },
+      {  INT32_C( 978273860),           INT32_MIN },
+      {  INT64_C( 540382184240374618), -INT64_C(8100370867864731648) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_int32x2_t c = simde_vld1_s32(test_vec[i].c);
+    simde_int64x2_t r = simde_vqdmlal_s32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlalh_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlals_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlal_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlal_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
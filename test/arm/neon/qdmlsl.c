@@ -0,0 +1,187 @@
+#define SIMDE_TEST_ARM_NEON_INSN qdmlsl
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qdmlsl.h"
+
+static int
+test_simde_vqdmlslh_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a;
+    int16_t b;
+    int16_t c;
+    int32_t r;
+  } test_vec[] = {
+    {  INT32_C(1882783347),
+           INT16_MIN,
+           INT16_MIN,
+      -INT32_C( 264700300) },
+    {           INT32_MIN,
+      -INT16_C(25034),
+      -INT16_C( 8196),
+                INT32_MIN },
+    {  INT32_C( 725340155),
+       INT16_C(29489),
+      -INT16_C(17103),
+       INT32_C(1734040889) },
+    { -INT32_C(1162048704),
+       INT16_C(31925),
+      -INT16_C(14155),
+      -INT32_C( 258251954) },
+    {  INT32_C(1177259233),
+           INT16_MIN,
+       INT16_C( 6383),
+       INT32_C(1595575521) },
+    {           INT32_MIN,
+      -INT16_C(31942),
+      -INT16_C( 7573),
+                INT32_MIN }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i32(simde_vqdmlslh_s16(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqdmlsls_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a;
+    int32_t b;
+    int32_t c;
+    int64_t r;
+  } test_vec[] = {
+    {  INT64_C(7416786975586213434),
+                INT32_MIN,
+                INT32_MIN,
+      -INT64_C(1806585061268562373) },
+    {  INT64_C(9034816490655388183),
+      -INT32_C( 860775288),
+                INT32_MIN,
+       INT64_C(5337814779490406935) },
+    {  INT64_C(4736873145388368271),
+      -INT32_C(  39540015),
+      -INT32_C(2044399506),
+       INT64_C(4575201971121903091) },
+    {                    INT64_MAX,
+       INT32_C(  86765186),
+       INT32_C( 548008300),
+       INT64_C(9128275952696688207) },
+    { -INT64_C(4301674692854333301),
+      -INT32_C(1268189871),
+      -INT32_C(1299431033),
+      -INT64_C(7597525241081666787) },
+    {                    INT64_MIN,
+       INT32_C(1351037907),
+      -INT32_C( 546877898),
+      -INT64_C(7745666495457816836) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i64(simde_vqdmlsls_s32(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqdmlsl_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int16_t b[4];
+    int16_t c[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(1227250856), -INT32_C( 366273409), -INT32_C(2115349558),           INT32_MIN },
+      {      INT16_MIN, -INT16_C(32328),      INT16_MIN, -INT16_C(26312) },
+      {      INT16_MIN,      INT16_MAX,  INT16_C(19061), -INT16_C(27813) },
+      {           INT32_MIN,  INT32_C(1752309743), -INT32_C( 866167862),           INT32_MIN } },
+    { {  INT32_C( 920470718),           INT32_MIN, -INT32_C( 157149556), -INT32_C(1761229920) },
+      {  INT16_C(22337), -INT16_C(19894),  INT16_C(16707),      INT16_MAX },
+      {      INT16_MIN, -INT16_C( 7683),      INT16_MIN,      INT16_MAX },
+      {           INT32_MAX,           INT32_MIN,  INT32_C( 937760396),           INT32_MIN } },
+    { {           INT32_MIN,  INT32_C( 889435503), -INT32_C(1599529685),  INT32_C(2127340458) },
+      { -INT16_C(13427),      INT16_MIN, -INT16_C(15956),      INT16_MIN },
+      {      INT16_MIN,      INT16_MIN,  INT16_C( 5520),  INT16_C(22061) },
+      {           INT32_MIN, -INT32_C(1258048144), -INT32_C(1423375445),           INT32_MAX } },
+    { {  INT32_C(1991343828), -INT32_C(2046723872), -INT32_C(1643756111), -INT32_C(  42725854) },
+      {  INT16_C( 7761),  INT16_C(26176), -INT16_C(31092),  INT16_C(31110) },
+      {  INT16_C(20714),  INT16_C( 6801),  INT16_C( 7510),  INT16_C(16576) },
+      {  INT32_C(1669821120),           INT32_MIN, -INT32_C(1176754271), -INT32_C(1074084574) } },
+    { {           INT32_MIN, -INT32_C( 993321044),  INT32_C( 685082509),  INT32_C(1678880072) },
+      { -INT16_C(13436),      INT16_MIN, -INT16_C(27555),  INT16_C(21275) },
+      {  INT16_C( 9631),      INT16_MIN,  INT16_C(10586), -INT16_C(18149) },
+      { -INT32_C(1888679416),           INT32_MIN,  INT32_C(1268476969),           INT32_MAX } },
+    { {           INT32_MAX,  INT32_C(1628719318), -INT32_C(1092224572),  INT32_C( 119229468) },
+      {  INT16_C(14542),      INT16_MIN,      INT16_MIN,      INT16_MAX },
+      {  INT16_C( 9226), -INT16_C( 5775), -INT16_C(  109),  INT16_C(15137) },
+      {  INT32_C(1879154663),  INT32_C(1250248918), -INT32_C(1099367996), -INT32_C( 872758690) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_int16x4_t c = simde_vld1_s16(test_vec[i].c);
+    simde_int32x4_t r = simde_vqdmlsl_s16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqdmlsl_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int32_t b[2];
+    int32_t c[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(4687634208148581294), -INT64_C(5657553019889461692) },
+      {           INT32_MIN,  INT32_C( 169646238) },
+      {           INT32_MIN,  INT32_C(1587738473) },
+      { -INT64_C(4535737828706194513), -INT64_C(6196260737634090840) } },
+    { { -INT64_C(7016708144616014963), -INT64_C(5073118748161467470) },
+      { -INT32_C(1256459326), -INT32_C(1656919545) },
+      {  INT32_C(1758001213), -INT32_C(1740866794) },
+      { -INT64_C(2598994106229690087),                    INT64_MIN } },
+    { {                    INT64_MAX, -INT64_C(5219350285162378038) },
+      { -INT32_C(  20608589),  INT32_C( 398694011) },
+      {           INT32_MIN,  INT32_C(1823330094) },
+      {  INT64_C(9134858821083070463), -INT64_C(6673251862270112106) } },
+    { { -INT64_C(5722353472636433751),                    INT64_MAX },
+      {  INT32_C( 706547609), -INT32_C( 346680103) },
+      {  INT32_C(1768803343),           INT32_MIN },
+      { -INT64_C(8221841018212147525),  INT64_C(7734392332295864319) } },
+    { {  INT64_C(4971903573538132329),  INT64_C(3031093027363580970) },
+      { -INT32_C(1892513972), -INT32_C( 519728264) },
+      { -INT32_C(1892512874),  INT32_C(  17462457) },
+      { -INT64_C(2191310538931618727),  INT64_C(3049244492287150266) } },
+    { { -INT64_C(3995695802386256386),  INT64_C(6997104784300942526) },
+      { -INT32_C(1385261035),           INT32_MAX },
+      {           INT32_MIN,  INT32_C( 468418860) },
+      {                    INT64_MIN,  INT64_C(4985261100708177686) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_int32x2_t c = simde_vld1_s32(test_vec[i].c);
+    simde_int64x2_t r = simde_vqdmlsl_s32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlslh_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlsls_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlsl_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqdmlsl_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -26,6 +26,8 @@ test_simde_vqmovun_s16 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX } },
     { { -INT16_C(  4246), -INT16_C( 25278), -INT16_C( 16308), -INT16_C( 27529), -INT16_C( 22783), -INT16_C( 28406), -INT16_C( 22218),  INT16_C( 18401) },
       { UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX } },
+    { {  INT16_C(  255),  INT16_C(  256),  INT16_C(    0), -INT16_C(    1),       INT16_MAX,       INT16_MIN,  INT16_C(  127),  INT16_C(    1) },
+      {     UINT8_MAX,     UINT8_MAX, UINT8_C(   0), UINT8_C(   0),     UINT8_MAX, UINT8_C(   0), UINT8_C( 127), UINT8_C(   1) } },
 
   };
 
@@ -73,6 +75,10 @@ test_simde_vqmovun_s32 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT16_C(    0),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX } },
     { {  INT32_C(    23578472),  INT32_C(    63158421),  INT32_C(  1727162417), -INT32_C(  1511577560) },
       {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(    0) } },
+    { {  INT32_C(     65535),  INT32_C(     65536),  INT32_C(         0), -INT32_C(         1) },
+      {      UINT16_MAX,      UINT16_MAX, UINT16_C(    0), UINT16_C(    0) } },
+    { {            INT32_MAX,            INT32_MIN,  INT32_C(     32767),  INT32_C(         1) },
+      {      UINT16_MAX, UINT16_C(    0), UINT16_C(32767), UINT16_C(    1) } },
 
   };
 
@@ -120,6 +126,14 @@ test_simde_vqmovun_s64 (SIMDE_MUNIT_TEST_ARGS) {
       {           UINT32_MAX, UINT32_C(         0) } },
     { {  INT64_C( 6204411644969261404), -INT64_C( 2791938161888713282) },
       {           UINT32_MAX, UINT32_C(         0) } },
+    { {  INT64_C(         4294967295),  INT64_C(         4294967296) },
+      {           UINT32_MAX,           UINT32_MAX } },
+    { {  INT64_C(                  0), -INT64_C(                  1) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { {                     INT64_MAX,                     INT64_MIN },
+      {           UINT32_MAX, UINT32_C(         0) } },
+    { {  INT64_C(         2147483647),  INT64_C(                  1) },
+      { UINT32_C(2147483647), UINT32_C(         1) } },
 
   };
 
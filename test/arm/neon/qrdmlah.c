@@ -0,0 +1,281 @@
+#define SIMDE_TEST_ARM_NEON_INSN qrdmlah
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qrdmlah.h"
+
+static int
+test_simde_vqrdmlahh_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a;
+    int16_t b;
+    int16_t c;
+    int16_t r;
+  } test_vec[] = {
+    { -INT16_C(    1),
+           INT16_MIN,
+           INT16_MIN,
+           INT16_MAX },
+    { -INT16_C(12165),
+       INT16_C(31907),
+           INT16_MIN,
+           INT16_MIN },
+    {  INT16_C(28077),
+       INT16_C(26221),
+      -INT16_C(20455),
+       INT16_C(11709) },
+    {  INT16_C(31761),
+       INT16_C( 2684),
+      -INT16_C( 4327),
+       INT16_C(31407) },
+    {  INT16_C(23263),
+           INT16_MIN,
+       INT16_C( 9641),
+       INT16_C(13622) },
+    { -INT16_C(11656),
+           INT16_MAX,
+       INT16_C( 7731),
+      -INT16_C( 3925) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i16(simde_vqrdmlahh_s16(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlahs_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    int32_t r;
+  } test_vec[] = {
+    { -INT32_C(         1),
+                INT32_MIN,
+                INT32_MIN,
+                INT32_MAX },
+    { -INT32_C(1133577805),
+       INT32_C(2127212204),
+      -INT32_C(1082851541),
+                INT32_MIN },
+    {  INT32_C( 102524216),
+       INT32_C( 381938737),
+      -INT32_C(1123639590),
+      -INT32_C(  97319674) },
+    {  INT32_C(1512266557),
+       INT32_C(1041855850),
+       INT32_C(2035121213),
+                INT32_MAX },
+    { -INT32_C(1176846524),
+       INT32_C(1869016162),
+      -INT32_C(1783394201),
+                INT32_MIN },
+    {  INT32_C(1941905347),
+      -INT32_C(1472851155),
+      -INT32_C(1440413091),
+                INT32_MAX }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i32(simde_vqrdmlahs_s32(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlah_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[4];
+    int16_t b[4];
+    int16_t c[4];
+    int16_t r[4];
+  } test_vec[] = {
+    { { -INT16_C(    1), -INT16_C( 9234), -INT16_C(19311),  INT16_C( 9248) },
+      {      INT16_MIN,      INT16_MIN,  INT16_C(32104), -INT16_C(13895) },
+      {      INT16_MIN,      INT16_MIN, -INT16_C( 1249),  INT16_C(  897) },
+      {      INT16_MAX,  INT16_C(23534), -INT16_C(20535),  INT16_C( 8868) } },
+    { {  INT16_C(26786),  INT16_C( 7741), -INT16_C(29435),  INT16_C( 2452) },
+      {  INT16_C(31052),      INT16_MAX,      INT16_MIN,  INT16_C(19848) },
+      { -INT16_C( 9651),      INT16_MAX,      INT16_MIN,  INT16_C(20000) },
+      {  INT16_C(17640),      INT16_MAX,  INT16_C( 3333),  INT16_C(14566) } },
+    { {  INT16_C( 2311),  INT16_C( 6916),      INT16_MAX,      INT16_MIN },
+      {  INT16_C( 7345),      INT16_MAX, -INT16_C( 9290),      INT16_MAX },
+      {  INT16_C(27545), -INT16_C(25981), -INT16_C(27796), -INT16_C(23780) },
+      {  INT16_C( 8485), -INT16_C(19064),      INT16_MAX,      INT16_MIN } },
+    { {  INT16_C(19619),  INT16_C(22935),      INT16_MIN, -INT16_C( 3383) },
+      {  INT16_C(21438), -INT16_C( 8861),  INT16_C( 9217), -INT16_C(16431) },
+      { -INT16_C(14346),      INT16_MIN, -INT16_C( 1878),      INT16_MIN },
+      {  INT16_C(10233),  INT16_C(31796),      INT16_MIN,  INT16_C(13048) } },
+    { { -INT16_C(29441),  INT16_C(19217),  INT16_C( 6930), -INT16_C( 6814) },
+      { -INT16_C(23899), -INT16_C(  930),      INT16_MAX, -INT16_C(21811) },
+      {  INT16_C( 1428),  INT16_C(15467),      INT16_MAX,      INT16_MIN },
+      { -INT16_C(30482),  INT16_C(18778),      INT16_MAX,  INT16_C(14997) } },
+    { {  INT16_C(31096),      INT16_MAX,      INT16_MIN, -INT16_C( 8575) },
+      { -INT16_C( 6342), -INT16_C(11739),      INT16_MAX,      INT16_MAX },
+      {  INT16_C( 4678), -INT16_C(12976), -INT16_C( 4018),      INT16_MAX },
+      {  INT16_C(30191),      INT16_MAX,      INT16_MIN,  INT16_C(24191) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_int16x4_t c = simde_vld1_s16(test_vec[i].c);
+    simde_int16x4_t r = simde_vqrdmlah_s16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i16x4(r, simde_vld1_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlah_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t b[2];
+    int32_t c[2];
+    int32_t r[2];
+  } test_vec[] = {
+    { { -INT32_C(         1),  INT32_C(  72287306) },
+      {           INT32_MIN,           INT32_MIN },
+      {           INT32_MIN,           INT32_MIN },
+      {           INT32_MAX,           INT32_MAX } },
+    { { -INT32_C( 343714918),           INT32_MIN },
+      {  INT32_C(2084842928),  INT32_C(1294008979) },
+      {  INT32_C( 567537146),  INT32_C(1034701582) },
+      {  INT32_C( 207267534), -INT32_C(1524003633) } },
+    { {           INT32_MIN, -INT32_C( 799973504) },
+      {  INT32_C(1478237828),           INT32_MAX },
+      {  INT32_C(2134216034),           INT32_MAX },
+      { -INT32_C( 678378690),  INT32_C(1347510142) } },
+    { {  INT32_C(2046366889),           INT32_MIN },
+      {  INT32_C(1855185612),  INT32_C(1141002641) },
+      { -INT32_C(1864271912),           INT32_MAX },
+      {  INT32_C( 435844531), -INT32_C(1006481008) } },
+    { {           INT32_MAX,           INT32_MIN },
+      { -INT32_C( 877964881),  INT32_C(  20807146) },
+      {  INT32_C( 748107522),           INT32_MAX },
+      {  INT32_C(1841631664), -INT32_C(2126676502) } },
+    { {  INT32_C( 377579770), -INT32_C( 420284063) },
+      {  INT32_C( 103785401),  INT32_C( 470999192) },
+      {  INT32_C(1579906298),  INT32_C(1657741812) },
+      {  INT32_C( 453934814), -INT32_C(  56698033) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_int32x2_t c = simde_vld1_s32(test_vec[i].c);
+    simde_int32x2_t r = simde_vqrdmlah_s32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlahq_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t c[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(    1),  INT16_C( 1120),      INT16_MAX,  INT16_C(16201),      INT16_MAX, -INT16_C(15297),      INT16_MAX,  INT16_C(14346) },
+      {      INT16_MIN,      INT16_MIN,  INT16_C( 2696), -INT16_C(12587), -INT16_C( 1196),  INT16_C(26801),  INT16_C( 1660),      INT16_MIN },
+      {      INT16_MIN,      INT16_MIN,  INT16_C(28171),  INT16_C(28440),  INT16_C(14875),      INT16_MIN, -INT16_C(30185),      INT16_MIN },
+      {      INT16_MAX,      INT16_MAX,      INT16_MAX,  INT16_C( 5276),  INT16_C(32224),      INT16_MIN,  INT16_C(31238),      INT16_MAX } },
+    { { -INT16_C( 5764), -INT16_C(12082),  INT16_C(15429),      INT16_MIN, -INT16_C( 1525),  INT16_C(30074),  INT16_C(32390), -INT16_C( 2060) },
+      {  INT16_C( 9785),  INT16_C(18133), -INT16_C(14979), -INT16_C(10249),  INT16_C(10816),      INT16_MIN, -INT16_C( 6555),  INT16_C(25929) },
+      {      INT16_MAX,  INT16_C(24182),  INT16_C(24386), -INT16_C(29955),      INT16_MAX, -INT16_C(28538), -INT16_C(24827), -INT16_C(19419) },
+      {  INT16_C( 4021),  INT16_C( 1300),  INT16_C( 4282), -INT16_C(23399),  INT16_C( 9291),      INT16_MAX,      INT16_MAX, -INT16_C(17426) } },
+    { {      INT16_MAX,      INT16_MAX, -INT16_C(28567), -INT16_C(17019),      INT16_MIN,  INT16_C( 3702),      INT16_MIN, -INT16_C(17433) },
+      { -INT16_C(31582),  INT16_C(27540),  INT16_C(25691),      INT16_MAX,  INT16_C( 1143), -INT16_C(25703), -INT16_C(28473), -INT16_C(22032) },
+      { -INT16_C( 5238), -INT16_C( 2561), -INT16_C(13998),      INT16_MAX, -INT16_C(18788), -INT16_C(19735),  INT16_C(31458),      INT16_MAX },
+      {      INT16_MAX,  INT16_C(30615),      INT16_MIN,  INT16_C(15747),      INT16_MIN,  INT16_C(19182),      INT16_MIN,      INT16_MIN } },
+    { {      INT16_MAX,  INT16_C( 1112),      INT16_MIN,  INT16_C(10840),  INT16_C(15768), -INT16_C(13975),  INT16_C(20543),  INT16_C( 8862) },
+      {  INT16_C(16396),      INT16_MIN,      INT16_MIN, -INT16_C(24247),      INT16_MIN,      INT16_MIN,      INT16_MIN, -INT16_C(29012) },
+      {  INT16_C(17919),      INT16_MIN,  INT16_C(30346), -INT16_C(30481),      INT16_MIN, -INT16_C(15611),  INT16_C( 3765),      INT16_MAX },
+      {      INT16_MAX,      INT16_MAX,      INT16_MIN,      INT16_MAX,      INT16_MAX,  INT16_C( 1636),  INT16_C(16778), -INT16_C(20149) } },
+    { {      INT16_MIN,      INT16_MAX, -INT16_C(28942),      INT16_MIN,  INT16_C(23154), -INT16_C(24471),  INT16_C(13651),      INT16_MAX },
+      { -INT16_C( 8086),      INT16_MIN, -INT16_C( 9535),  INT16_C( 8031),  INT16_C(11828), -INT16_C(26595),  INT16_C(  215), -INT16_C( 8775) },
+      { -INT16_C(11334),      INT16_MAX,      INT16_MIN,  INT16_C(28267),      INT16_MAX,  INT16_C(30170),      INT16_MIN,  INT16_C(11946) },
+      { -INT16_C(29971),  INT16_C(    0), -INT16_C(19407), -INT16_C(25840),      INT16_MAX,      INT16_MIN,  INT16_C(13436),  INT16_C(29568) } },
+    { { -INT16_C(20605),      INT16_MIN,  INT16_C( 1271), -INT16_C(16947),  INT16_C(26297),  INT16_C(16857), -INT16_C( 6263),  INT16_C( 3192) },
+      { -INT16_C(    5),  INT16_C(20879), -INT16_C(28155), -INT16_C(26940), -INT16_C( 1934),      INT16_MIN,  INT16_C(30424), -INT16_C(14443) },
+      { -INT16_C(31685),  INT16_C( 4410), -INT16_C(27520),  INT16_C(16292),  INT16_C(15081),      INT16_MAX, -INT16_C(21242), -INT16_C(20994) },
+      { -INT16_C(20600), -INT16_C(29958),  INT16_C(24917), -INT16_C(30341),  INT16_C(25407), -INT16_C(15910), -INT16_C(25985),  INT16_C(12445) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_int16x8_t c = simde_vld1q_s16(test_vec[i].c);
+    simde_int16x8_t r = simde_vqrdmlahq_s16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i16x8(r, simde_vld1q_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlahq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t c[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(         1), -INT32_C(1629220368),  INT32_C( 755221976),           INT32_MAX },
+      {           INT32_MIN,           INT32_MIN,           INT32_MIN, -INT32_C( 345857592) },
+      {           INT32_MIN,           INT32_MIN,           INT32_MIN,  INT32_C( 350278591) },
+      {           INT32_MAX,  INT32_C( 518263280),           INT32_MAX,  INT32_C(2091070407) } },
+    { { -INT32_C( 766235264),           INT32_MIN,           INT32_MIN,           INT32_MAX },
+      { -INT32_C(1669427982),  INT32_C(2132835819),  INT32_C( 317601815), -INT32_C( 538650410) },
+      {           INT32_MAX,           INT32_MAX, -INT32_C( 700615917), -INT32_C(1238625001) },
+      {           INT32_MIN, -INT32_C(  14647830),           INT32_MIN,           INT32_MAX } },
+    { { -INT32_C(2022982374),           INT32_MIN, -INT32_C( 448141729),           INT32_MIN },
+      {  INT32_C(1531542308), -INT32_C(1424415661),           INT32_MIN,  INT32_C( 750328214) },
+      {  INT32_C( 247145478),           INT32_MAX,           INT32_MIN, -INT32_C( 512824482) },
+      { -INT32_C(1846723171),           INT32_MIN,  INT32_C(1699341919),           INT32_MIN } },
+    { {           INT32_MIN,  INT32_C(1902923227),           INT32_MAX,           INT32_MAX },
+      {  INT32_C( 382616449),  INT32_C(2001270441), -INT32_C(  70067523),           INT32_MAX },
+      {           INT32_MAX,  INT32_C(1617674471),  INT32_C( 830575068),  INT32_C(1416490420) },
+      { -INT32_C(1764867199),           INT32_MAX,  INT32_C(2120383865),           INT32_MAX } },
+    { {  INT32_C( 574377687),           INT32_MAX,           INT32_MIN,  INT32_C(1607006117) },
+      {  INT32_C( 991931942), -INT32_C( 850649157),  INT32_C(1399544669),  INT32_C( 961005309) },
+      {           INT32_MAX,  INT32_C(2005893488),           INT32_MIN,  INT32_C(1341055514) },
+      {  INT32_C(1566309629),  INT32_C(1352920389),           INT32_MIN,           INT32_MAX } },
+    { { -INT32_C( 557485214),           INT32_MIN, -INT32_C(1426655167),  INT32_C(1162215441) },
+      { -INT32_C( 363442188),  INT32_C(1741233011),  INT32_C(1150855757), -INT32_C( 182495804) },
+      {  INT32_C( 657006915),           INT32_MIN, -INT32_C(1736292540),           INT32_MIN },
+      { -INT32_C( 668677693),           INT32_MIN,           INT32_MIN,  INT32_C(1344711245) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_int32x4_t c = simde_vld1q_s32(test_vec[i].c);
+    simde_int32x4_t r = simde_vqrdmlahq_s32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlahh_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlahs_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlah_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlah_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlahq_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlahq_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,281 @@
+#define SIMDE_TEST_ARM_NEON_INSN qrdmlsh
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qrdmlsh.h"
+
+static int
+test_simde_vqrdmlshh_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a;
+    int16_t b;
+    int16_t c;
+    int16_t r;
+  } test_vec[] = {
+    { -INT16_C(    1),
+           INT16_MIN,
+           INT16_MIN,
+           INT16_MIN },
+    {  INT16_C(15401),
+       INT16_C(12624),
+           INT16_MAX,
+       INT16_C( 2777) },
+    {      INT16_MAX,
+      -INT16_C( 2016),
+      -INT16_C(24913),
+       INT16_C(31234) },
+    { -INT16_C(15834),
+       INT16_C(22170),
+       INT16_C(26039),
+           INT16_MIN },
+    {  INT16_C(32247),
+      -INT16_C(28003),
+       INT16_C(28132),
+           INT16_MAX },
+    {  INT16_C(24011),
+           INT16_MAX,
+      -INT16_C( 2715),
+       INT16_C(26726) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i16(simde_vqrdmlshh_s16(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlshs_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    int32_t r;
+  } test_vec[] = {
+    { -INT32_C(         1),
+                INT32_MIN,
+                INT32_MIN,
+                INT32_MIN },
+    { -INT32_C(1214948283),
+                INT32_MIN,
+      -INT32_C(1315831986),
+                INT32_MIN },
+    {  INT32_C(1502787235),
+                INT32_MIN,
+       INT32_C( 355898319),
+       INT32_C(1858685554) },
+    {  INT32_C(  46779574),
+       INT32_C( 409959956),
+      -INT32_C(1258426227),
+       INT32_C( 287016263) },
+    {  INT32_C( 329690069),
+       INT32_C( 802833973),
+      -INT32_C( 354619791),
+       INT32_C( 462264217) },
+    { -INT32_C(1519699346),
+       INT32_C( 571658616),
+      -INT32_C( 818357813),
+      -INT32_C(1301853080) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i32(simde_vqrdmlshs_s32(test_vec[i].a, test_vec[i].b, test_vec[i].c), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlsh_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[4];
+    int16_t b[4];
+    int16_t c[4];
+    int16_t r[4];
+  } test_vec[] = {
+    { { -INT16_C(    1),  INT16_C(14992),  INT16_C(18055),  INT16_C(24909) },
+      {      INT16_MIN,      INT16_MIN,  INT16_C(17688),      INT16_MAX },
+      {      INT16_MIN,      INT16_MIN,      INT16_MIN, -INT16_C(20129) },
+      {      INT16_MIN, -INT16_C(17776),      INT16_MAX,      INT16_MAX } },
+    { {  INT16_C( 6617), -INT16_C(  549), -INT16_C(21607), -INT16_C(28603) },
+      {      INT16_MIN,  INT16_C( 8643), -INT16_C( 4463),  INT16_C( 4776) },
+      {      INT16_MAX,      INT16_MIN,      INT16_MAX,  INT16_C(30516) },
+      {      INT16_MAX,  INT16_C( 8094), -INT16_C(17144),      INT16_MIN } },
+    { { -INT16_C( 8690),      INT16_MIN,      INT16_MIN,  INT16_C(14603) },
+      {      INT16_MIN, -INT16_C(24450), -INT16_C( 5011),      INT16_MAX },
+      {      INT16_MAX, -INT16_C( 5114),      INT16_MAX, -INT16_C( 4550) },
+      {  INT16_C(24077),      INT16_MIN, -INT16_C(27757),  INT16_C(19153) } },
+    { {  INT16_C(28765), -INT16_C(10529),      INT16_MAX, -INT16_C(25773) },
+      { -INT16_C(20627),  INT16_C(27811),  INT16_C(20526),      INT16_MAX },
+      {      INT16_MAX, -INT16_C(10415),  INT16_C(18031), -INT16_C(10024) },
+      {      INT16_MAX, -INT16_C( 1690),  INT16_C(21472), -INT16_C(15749) } },
+    { { -INT16_C(11765), -INT16_C(27238), -INT16_C( 7772),      INT16_MAX },
+      {      INT16_MIN, -INT16_C( 3889), -INT16_C(12707),      INT16_MAX },
+      { -INT16_C(21143), -INT16_C(25914), -INT16_C(10764),  INT16_C(17411) },
+      {      INT16_MIN, -INT16_C(30314), -INT16_C(11946),  INT16_C(15357) } },
+    { {  INT16_C( 6579),  INT16_C(32291),      INT16_MIN,  INT16_C( 7753) },
+      { -INT16_C(17106),  INT16_C( 9157),  INT16_C(10312), -INT16_C( 6458) },
+      {      INT16_MIN,      INT16_MIN,  INT16_C(28060),  INT16_C( 5114) },
+      { -INT16_C(10527),      INT16_MAX,      INT16_MIN,  INT16_C( 8761) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_int16x4_t c = simde_vld1_s16(test_vec[i].c);
+    simde_int16x4_t r = simde_vqrdmlsh_s16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i16x4(r, simde_vld1_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlsh_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t b[2];
+    int32_t c[2];
+    int32_t r[2];
+  } test_vec[] = {
+    { { -INT32_C(         1),  INT32_C(1933746417) },
+      {           INT32_MIN,           INT32_MIN },
+      {           INT32_MIN,           INT32_MIN },
+      {           INT32_MIN, -INT32_C( 213737231) } },
+    { {           INT32_MAX,           INT32_MAX },
+      {  INT32_C(1835118503), -INT32_C(  84294853) },
+      {  INT32_C(1522486770),           INT32_MIN },
+      {  INT32_C( 846452254),  INT32_C(2063188794) } },
+    { {           INT32_MIN, -INT32_C(2117292815) },
+      {           INT32_MAX,           INT32_MAX },
+      { -INT32_C(  73059670),           INT32_MIN },
+      { -INT32_C(2074423978),  INT32_C(  30190832) } },
+    { { -INT32_C(2060646526),           INT32_MIN },
+      { -INT32_C(1293748579), -INT32_C(1557146130) },
+      {  INT32_C(1197458980),           INT32_MAX },
+      { -INT32_C(1339239006), -INT32_C( 590337519) } },
+    { { -INT32_C( 815855295), -INT32_C( 422560442) },
+      { -INT32_C(1381472111), -INT32_C( 555702691) },
+      {           INT32_MIN,           INT32_MIN },
+      {           INT32_MIN, -INT32_C( 978263133) } },
+    { {  INT32_C(1613459141),           INT32_MAX },
+      {  INT32_C( 568119394), -INT32_C( 273509702) },
+      {           INT32_MAX, -INT32_C(1976219983) },
+      {  INT32_C(1045339747),  INT32_C(1895786579) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_int32x2_t c = simde_vld1_s32(test_vec[i].c);
+    simde_int32x2_t r = simde_vqrdmlsh_s32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlshq_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t c[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(    1),  INT16_C(20648),  INT16_C(20955),  INT16_C(21513), -INT16_C( 2608),  INT16_C( 2557),      INT16_MAX, -INT16_C(18098) },
+      {      INT16_MIN,      INT16_MIN, -INT16_C( 3474), -INT16_C(27309),      INT16_MIN, -INT16_C( 9165),  INT16_C(15619),  INT16_C(23660) },
+      {      INT16_MIN,      INT16_MIN, -INT16_C(27999),      INT16_MIN,      INT16_MIN,      INT16_MIN,      INT16_MIN, -INT16_C(  824) },
+      {      INT16_MIN, -INT16_C(12120),  INT16_C(17987), -INT16_C( 5796),      INT16_MIN, -INT16_C( 6608),      INT16_MAX, -INT16_C(17503) } },
+    { {      INT16_MIN,  INT16_C( 6769),  INT16_C(30029),      INT16_MIN,  INT16_C( 2033),  INT16_C(29421),      INT16_MAX, -INT16_C( 4137) },
+      {  INT16_C(10889), -INT16_C(21676),  INT16_C(32520),      INT16_MIN,  INT16_C(25537),      INT16_MIN, -INT16_C( 5633), -INT16_C(17407) },
+      {  INT16_C( 9672), -INT16_C(11907),  INT16_C(21527),  INT16_C(30557),  INT16_C( 6029),  INT16_C(11128),  INT16_C( 8162),  INT16_C(10407) },
+      {      INT16_MIN, -INT16_C( 1107),  INT16_C( 8665), -INT16_C( 2211), -INT16_C( 2666),      INT16_MAX,      INT16_MAX,  INT16_C( 1391) } },
+    { { -INT16_C(32364),      INT16_MIN,      INT16_MAX, -INT16_C( 3657),  INT16_C( 7359),  INT16_C(30606),  INT16_C( 9844),      INT16_MIN },
+      {      INT16_MAX, -INT16_C(  408),      INT16_MIN, -INT16_C(28538),      INT16_MIN,      INT16_MIN,  INT16_C( 6515),      INT16_MIN },
+      {  INT16_C(22125),      INT16_MIN,  INT16_C(27995),  INT16_C( 3651),  INT16_C( 4711),      INT16_MIN,  INT16_C( 4868),      INT16_MAX },
+      {      INT16_MIN,      INT16_MIN,      INT16_MAX, -INT16_C(  477),  INT16_C(12070), -INT16_C( 2162),  INT16_C( 8876), -INT16_C(    1) } },
+    { {  INT16_C(11787),      INT16_MIN,  INT16_C( 3496), -INT16_C( 9676), -INT16_C(32026),  INT16_C(16184), -INT16_C( 6442), -INT16_C(12495) },
+      {      INT16_MAX,  INT16_C(29937),  INT16_C(19499),  INT16_C( 5005), -INT16_C( 9069),      INT16_MAX,  INT16_C(14041),  INT16_C(  804) },
+      {  INT16_C(14244),  INT16_C(17043), -INT16_C(10774), -INT16_C(25680), -INT16_C(26948),  INT16_C(25005),  INT16_C( 3351),  INT16_C(17503) },
+      { -INT16_C( 2457),      INT16_MIN,  INT16_C( 9907), -INT16_C( 5754),      INT16_MIN, -INT16_C( 8820), -INT16_C( 7878), -INT16_C(12924) } },
+    { {  INT16_C(18029),      INT16_MAX,      INT16_MIN, -INT16_C(17709),  INT16_C(21368),  INT16_C(19236),  INT16_C(17280),  INT16_C(12254) },
+      {  INT16_C(23262),      INT16_MAX,  INT16_C(22028), -INT16_C(29174),  INT16_C( 1093), -INT16_C(25078),  INT16_C(30905),      INT16_MAX },
+      { -INT16_C(19479), -INT16_C(23374),  INT16_C(17031), -INT16_C( 7380),  INT16_C(27653),  INT16_C(17027), -INT16_C(  309),  INT16_C(19224) },
+      {  INT16_C(31857),      INT16_MAX,      INT16_MIN, -INT16_C(24280),  INT16_C(20446),  INT16_C(32267),  INT16_C(17571), -INT16_C( 6969) } },
+    { {  INT16_C(15626),      INT16_MIN,      INT16_MIN, -INT16_C(17722),  INT16_C(28092),  INT16_C(23563), -INT16_C(31770),  INT16_C( 4083) },
+      {  INT16_C(18391), -INT16_C(12192),  INT16_C(14793),  INT16_C(16040),  INT16_C(13276),      INT16_MAX,  INT16_C( 1120), -INT16_C( 7672) },
+      { -INT16_C(24890), -INT16_C(10207),  INT16_C( 2699), -INT16_C(25533), -INT16_C(13070), -INT16_C(10318),  INT16_C(17749), -INT16_C(21689) },
+      {  INT16_C(29595),      INT16_MIN,      INT16_MIN, -INT16_C( 5224),      INT16_MAX,      INT16_MAX, -INT16_C(32377), -INT16_C(  995) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_int16x8_t c = simde_vld1q_s16(test_vec[i].c);
+    simde_int16x8_t r = simde_vqrdmlshq_s16(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i16x8(r, simde_vld1q_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrdmlshq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t c[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(         1), -INT32_C( 795201127), -INT32_C(1188003877),  INT32_C(1865484641) },
+      {           INT32_MIN,           INT32_MIN,  INT32_C( 741104009),  INT32_C(1976570372) },
+      {           INT32_MIN,           INT32_MIN,           INT32_MIN, -INT32_C(1837521738) },
+      {           INT32_MIN,           INT32_MIN, -INT32_C( 446899868),           INT32_MAX } },
+    { { -INT32_C(1410341398), -INT32_C( 248213653),           INT32_MAX, -INT32_C( 493597863) },
+      { -INT32_C( 933666275), -INT32_C(   2774306),           INT32_MIN,           INT32_MAX },
+      {  INT32_C( 667982082), -INT32_C( 780887171),  INT32_C( 218402034),  INT32_C(1090563480) },
+      { -INT32_C(1119921332), -INT32_C( 249222471),           INT32_MAX, -INT32_C(1584161342) } },
+    { { -INT32_C( 428701421),  INT32_C(   8406777),  INT32_C( 443301613),  INT32_C(1981905897) },
+      { -INT32_C( 224743090),           INT32_MIN,  INT32_C(1631110580), -INT32_C( 989354634) },
+      {  INT32_C( 782821114),  INT32_C(1409146408),  INT32_C(1934194899),  INT32_C( 581152015) },
+      { -INT32_C( 346775938),  INT32_C(1417553185), -INT32_C(1025806553),           INT32_MAX } },
+    { {           INT32_MAX, -INT32_C( 246059206),  INT32_C(1731435368), -INT32_C( 221907875) },
+      {           INT32_MAX, -INT32_C( 879817647), -INT32_C(1351135748),  INT32_C( 817279045) },
+      {  INT32_C( 903198039),  INT32_C(1132324152),  INT32_C( 666461467), -INT32_C(1107968387) },
+      {  INT32_C(1244285608),  INT32_C( 217850623),           INT32_MAX,  INT32_C( 199757429) } },
+    { { -INT32_C( 755014537),           INT32_MIN, -INT32_C( 204051369),  INT32_C(2103133494) },
+      {           INT32_MIN,           INT32_MIN,           INT32_MIN,           INT32_MIN },
+      { -INT32_C(1587390765),           INT32_MAX,  INT32_C(1981644381), -INT32_C( 411879170) },
+      {           INT32_MIN, -INT32_C(         1),  INT32_C(1777593012),  INT32_C(1691254324) } },
+    { {           INT32_MAX, -INT32_C(1546382733), -INT32_C(  56172702), -INT32_C(1400247042) },
+      { -INT32_C(2056911844), -INT32_C(1337451067),  INT32_C(1024650197), -INT32_C( 432594078) },
+      { -INT32_C(1665263949), -INT32_C(1765233674),  INT32_C( 992446499),  INT32_C(1062952607) },
+      {  INT32_C( 552453509),           INT32_MIN, -INT32_C( 529708555), -INT32_C(1186123408) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_int32x4_t c = simde_vld1q_s32(test_vec[i].c);
+    simde_int32x4_t r = simde_vqrdmlshq_s32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlshh_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlshs_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlsh_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlsh_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlshq_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrdmlshq_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1009 @@
+#define SIMDE_TEST_ARM_NEON_INSN qrshl
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/qrshl.h"
+
+static int
+test_simde_vqrshlb_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a;
+    int8_t b;
+    int8_t r;
+  } test_vec[] = {
+    {  INT8_C( 10),
+      -INT8_C(  8),
+       INT8_C(  0) },
+    {  INT8_C(  0),
+      -INT8_C(  9),
+       INT8_C(  0) },
+    {  INT8_C( 40),
+       INT8_C(  5),
+          INT8_MAX },
+    {  INT8_C(  2),
+      -INT8_C(  5),
+       INT8_C(  0) },
+    { -INT8_C( 43),
+      -INT8_C(  8),
+       INT8_C(  0) },
+    {  INT8_C( 15),
+       INT8_C(115),
+          INT8_MAX },
+    { -INT8_C(  2),
+       INT8_C(  9),
+          INT8_MIN },
+    {  INT8_C(  3),
+      -INT8_C( 10),
+       INT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i8(simde_vqrshlb_s8(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlh_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a;
+    int16_t b;
+    int16_t r;
+  } test_vec[] = {
+    {  INT16_C(    2),
+      -INT16_C(   16),
+       INT16_C(    0) },
+    { -INT16_C(  531),
+      -INT16_C(   17),
+       INT16_C(    0) },
+    {  INT16_C(    5),
+       INT16_C(   39),
+           INT16_MAX },
+    {  INT16_C(  415),
+      -INT16_C(    2),
+       INT16_C(  104) },
+    { -INT16_C(22905),
+       INT16_C(10256),
+           INT16_MIN },
+    {  INT16_C(  245),
+       INT16_C(   11),
+           INT16_MAX },
+    { -INT16_C(    7),
+       INT16_C(    7),
+      -INT16_C(  896) },
+    {  INT16_C(  155),
+      -INT16_C(    9),
+       INT16_C(    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i16(simde_vqrshlh_s16(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshls_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a;
+    int32_t b;
+    int32_t r;
+  } test_vec[] = {
+    {  INT32_C(  28895604),
+      -INT32_C(        32),
+       INT32_C(         0) },
+    { -INT32_C(  24350969),
+      -INT32_C(        33),
+       INT32_C(         0) },
+    {           INT32_MAX,
+       INT32_C(         0),
+                INT32_MAX },
+    {  INT32_C(    175656),
+      -INT32_C(         4),
+       INT32_C(     10979) },
+    { -INT32_C(  47982989),
+      -INT32_C(         2),
+      -INT32_C(  11995747) },
+    {  INT32_C(        38),
+       INT32_C(        32),
+                INT32_MAX },
+    {  INT32_C(       155),
+       INT32_C(         7),
+       INT32_C(     19840) },
+    { -INT32_C(   2789428),
+      -INT32_C(        26),
+       INT32_C(         0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i32(simde_vqrshls_s32(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshld_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a;
+    int64_t b;
+    int64_t r;
+  } test_vec[] = {
+    { -INT64_C(    116190387037560),
+      -INT64_C(                 64),
+       INT64_C(                  0) },
+    { -INT64_C( 240958816188844109),
+      -INT64_C(                 65),
+       INT64_C(                  0) },
+    { -INT64_C(                  1),
+      -INT64_C(                 20),
+       INT64_C(                  0) },
+    {  INT64_C(         1861268311),
+       INT64_C(                 45),
+                         INT64_MAX },
+    {                    INT64_MIN,
+       INT64_C(                 61),
+                         INT64_MIN },
+    {  INT64_C(           17086968),
+       INT64_C(                  6),
+       INT64_C(         1093565952) },
+    {  INT64_C(2218168876412150466),
+       INT64_C(                 51),
+                         INT64_MAX },
+    {  INT64_C(          687236144),
+      -INT64_C(                 62),
+       INT64_C(                  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i64(simde_vqrshld_s64(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlb_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a;
+    int8_t b;
+    uint8_t r;
+  } test_vec[] = {
+    { UINT8_C(  1),
+      -INT8_C(  8),
+      UINT8_C(  0) },
+    { UINT8_C( 24),
+      -INT8_C(  9),
+      UINT8_C(  0) },
+    { UINT8_C( 16),
+       INT8_C(  1),
+      UINT8_C( 32) },
+    { UINT8_C(  4),
+       INT8_C(  2),
+      UINT8_C( 16) },
+    { UINT8_C(  1),
+       INT8_C(  7),
+      UINT8_C(128) },
+    { UINT8_C(  4),
+      -INT8_C(  6),
+      UINT8_C(  0) },
+    { UINT8_C( 90),
+       INT8_C(124),
+         UINT8_MAX },
+    { UINT8_C(  1),
+      -INT8_C(  9),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_u8(simde_vqrshlb_u8(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlh_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a;
+    int16_t b;
+    uint16_t r;
+  } test_vec[] = {
+    { UINT16_C( 3215),
+      -INT16_C(   16),
+      UINT16_C(    0) },
+    { UINT16_C(    6),
+      -INT16_C(   17),
+      UINT16_C(    0) },
+    { UINT16_C(   22),
+       INT16_C(   11),
+      UINT16_C(45056) },
+    { UINT16_C( 2751),
+       INT16_C(    3),
+      UINT16_C(22008) },
+    { UINT16_C(27673),
+       INT16_C(    1),
+      UINT16_C(55346) },
+    { UINT16_C( 1462),
+      -INT16_C(21248),
+      UINT16_C( 1462) },
+    { UINT16_C(    3),
+       INT16_C(    4),
+      UINT16_C(   48) },
+    { UINT16_C(   10),
+      -INT16_C(   10),
+      UINT16_C(    0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_u16(simde_vqrshlh_u16(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshls_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    int32_t b;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(  57315992),
+      -INT32_C(        32),
+      UINT32_C(         0) },
+    { UINT32_C(        14),
+      -INT32_C(        33),
+      UINT32_C(         0) },
+    { UINT32_C(   3401439),
+       INT32_C(1745918727),
+      UINT32_C( 435384192) },
+    { UINT32_C( 170787426),
+      -INT32_C(        30),
+      UINT32_C(         0) },
+    { UINT32_C( 555980064),
+      -INT32_C(        28),
+      UINT32_C(         2) },
+    { UINT32_C(       300),
+      -INT32_C(        34),
+      UINT32_C(         0) },
+    { UINT32_C(1030530889),
+       INT32_C(        15),
+               UINT32_MAX },
+    { UINT32_C(         3),
+       INT32_C(        23),
+      UINT32_C(  25165824) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_u32(simde_vqrshls_u32(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshld_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    int64_t b;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                2399),
+      -INT64_C(                 64),
+      UINT64_C(                   0) },
+    { UINT64_C(     345441302131688),
+      -INT64_C(                 65),
+      UINT64_C(                   0) },
+    { UINT64_C(         43665231206),
+       INT64_C(                 38),
+                         UINT64_MAX },
+    { UINT64_C(                  21),
+       INT64_C(                 46),
+      UINT64_C(    1477743627730944) },
+    { UINT64_C(     140441920113713),
+      -INT64_C(2254474830719894164),
+                         UINT64_MAX },
+    { UINT64_C(  617868365546818173),
+      -INT64_C(3861891839393470675),
+                         UINT64_MAX },
+    { UINT64_C(                   8),
+      -INT64_C(4850586921417897986),
+      UINT64_C(                   2) },
+    { UINT64_C(         22258662548),
+      -INT64_C(                 45),
+      UINT64_C(                   0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_u64(simde_vqrshld_u64(test_vec[i].a, test_vec[i].b), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[8];
+    int8_t b[8];
+    int8_t r[8];
+  } test_vec[] = {
+    { {  INT8_C( 69),  INT8_C( 64),  INT8_C(124), -INT8_C(  1), -INT8_C(  4),  INT8_C(  0),  INT8_C( 15),  INT8_C( 27) },
+      {  INT8_C( 89), -INT8_C( 10), -INT8_C(  1), -INT8_C(  5), -INT8_C(  1),  INT8_C( 20),  INT8_C( 10),  INT8_C(  5) },
+      {     INT8_MAX,  INT8_C(  0),  INT8_C( 62),  INT8_C(  0), -INT8_C(  2),  INT8_C(  0),     INT8_MAX,     INT8_MAX } },
+    { { -INT8_C( 26), -INT8_C( 40),  INT8_C(  3),     INT8_MAX,  INT8_C(  3),  INT8_C(  0),  INT8_C(  1),  INT8_C(  4) },
+      { -INT8_C(  3),  INT8_C(  6), -INT8_C(  2), -INT8_C(  4),  INT8_C(  1), -INT8_C(  9), -INT8_C(  1), -INT8_C(  8) },
+      { -INT8_C(  3),     INT8_MIN,  INT8_C(  1),  INT8_C(  8),  INT8_C(  6),  INT8_C(  0),  INT8_C(  1),  INT8_C(  0) } },
+    { {  INT8_C(  3),  INT8_C( 10),  INT8_C(  7),  INT8_C(  1),  INT8_C(  0), -INT8_C( 22), -INT8_C( 35),  INT8_C(  0) },
+      {  INT8_C(  3), -INT8_C(  5), -INT8_C(105),  INT8_C(  5),  INT8_C( 10),  INT8_C(  9), -INT8_C(103), -INT8_C(  1) },
+      {  INT8_C( 24),  INT8_C(  0),  INT8_C(  0),  INT8_C( 32),  INT8_C(  0),     INT8_MIN,  INT8_C(  0),  INT8_C(  0) } },
+    { { -INT8_C( 30),  INT8_C(  0), -INT8_C(  3),  INT8_C( 92), -INT8_C(  6),  INT8_C(  3),  INT8_C(  4),  INT8_C( 18) },
+      {  INT8_C(  6),  INT8_C(  2), -INT8_C( 66),  INT8_C(  8),  INT8_C(  1),  INT8_C(  0), -INT8_C(  9),  INT8_C(  6) },
+      {     INT8_MIN,  INT8_C(  0),  INT8_C(  0),     INT8_MAX, -INT8_C( 12),  INT8_C(  3),  INT8_C(  0),     INT8_MAX } },
+    { { -INT8_C(  1), -INT8_C( 21), -INT8_C( 93),  INT8_C(  2), -INT8_C(  5),  INT8_C(  2), -INT8_C(  6), -INT8_C(  1) },
+      { -INT8_C(  7),  INT8_C( 10), -INT8_C(  8), -INT8_C(  6),  INT8_C(  8),  INT8_C(  1), -INT8_C( 10), -INT8_C(  5) },
+      {  INT8_C(  0),     INT8_MIN,  INT8_C(  0),  INT8_C(  0),     INT8_MIN,  INT8_C(  4),  INT8_C(  0),  INT8_C(  0) } },
+    { { -INT8_C(  3),  INT8_C(  1), -INT8_C( 94),  INT8_C( 16),  INT8_C(  6), -INT8_C( 93),     INT8_MIN,  INT8_C(  0) },
+      { -INT8_C(  1), -INT8_C( 10), -INT8_C(  3),  INT8_C(  6), -INT8_C(  4), -INT8_C(  8), -INT8_C(  8), -INT8_C(  1) },
+      { -INT8_C(  1),  INT8_C(  0), -INT8_C( 12),     INT8_MAX,  INT8_C(  0),  INT8_C(  0),  INT8_C(  0),  INT8_C(  0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+    simde_int8x8_t r = simde_vqrshl_s8(a, b);
+
+    simde_test_arm_neon_assert_equal_i8x8(r, simde_vld1_s8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[4];
+    int16_t b[4];
+    int16_t r[4];
+  } test_vec[] = {
+    { {  INT16_C(   81), -INT16_C( 3622),  INT16_C(31478), -INT16_C(   16) },
+      {  INT16_C(    8), -INT16_C(   15),  INT16_C(    6), -INT16_C(   18) },
+      {  INT16_C(20736),  INT16_C(    0),      INT16_MAX,  INT16_C(    0) } },
+    { {  INT16_C(   34),  INT16_C(22391), -INT16_C(  773),  INT16_C( 7272) },
+      {  INT16_C(    3), -INT16_C(    6), -INT16_C(   78),  INT16_C( 1262) },
+      {  INT16_C(  272),  INT16_C(  350),  INT16_C(    0),  INT16_C(    0) } },
+    { { -INT16_C(    6), -INT16_C( 2112), -INT16_C(  907),  INT16_C(  429) },
+      {  INT16_C(    9),  INT16_C(   17), -INT16_C(   12), -INT16_C(   15) },
+      { -INT16_C( 3072),      INT16_MIN,  INT16_C(    0),  INT16_C(    0) } },
+    { {  INT16_C(   12),  INT16_C(    4), -INT16_C(  346), -INT16_C(    2) },
+      { -INT16_C(25526),  INT16_C(    8),  INT16_C(    1),  INT16_C( 6403) },
+      {      INT16_MAX,  INT16_C( 1024), -INT16_C(  692), -INT16_C(   16) } },
+    { { -INT16_C(   24), -INT16_C(   15),  INT16_C(   35), -INT16_C(  318) },
+      { -INT16_C(15368),  INT16_C(    5),  INT16_C(   18),  INT16_C(   15) },
+      {  INT16_C(    0), -INT16_C(  480),      INT16_MAX,      INT16_MIN } },
+    { {  INT16_C(   81),  INT16_C(12980), -INT16_C(    8), -INT16_C(24548) },
+      {  INT16_C(   17), -INT16_C( 1287),  INT16_C(    0), -INT16_C(    3) },
+      {      INT16_MAX,  INT16_C(  101), -INT16_C(    8), -INT16_C( 3068) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_int16x4_t r = simde_vqrshl_s16(a, b);
+
+    simde_test_arm_neon_assert_equal_i16x4(r, simde_vld1_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t b[2];
+    int32_t r[2];
+  } test_vec[] = {
+    { { -INT32_C(         2),  INT32_C(        38) },
+      { -INT32_C(1227110933),  INT32_C(        10) },
+      {  INT32_C(         0),  INT32_C(     38912) } },
+    { { -INT32_C( 472645522), -INT32_C(     11168) },
+      {  INT32_C(        22),  INT32_C(        31) },
+      {           INT32_MIN,           INT32_MIN } },
+    { { -INT32_C(   7501911), -INT32_C( 568640473) },
+      { -INT32_C(        12), -INT32_C( 970612760) },
+      { -INT32_C(      1832), -INT32_C(        34) } },
+    { { -INT32_C(      2139),  INT32_C(      3258) },
+      { -INT32_C(        34),  INT32_C(        19) },
+      {  INT32_C(         0),  INT32_C(1708130304) } },
+    { { -INT32_C(         1),  INT32_C( 714543143) },
+      { -INT32_C(        32),  INT32_C(         2) },
+      {  INT32_C(         0),           INT32_MAX } },
+    { { -INT32_C(     26019),  INT32_C(     19876) },
+      {  INT32_C( 720975840), -INT32_C(        55) },
+      {  INT32_C(         0),  INT32_C(         0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_int32x2_t r = simde_vqrshl_s32(a, b);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[1];
+    int64_t b[1];
+    int64_t r[1];
+  } test_vec[] = {
+    { {  INT64_C(      6694791502670) },
+      { -INT64_C(                 12) },
+      {  INT64_C(         1634470582) } },
+    { {  INT64_C(               1697) },
+      {  INT64_C(9208504880910183998) },
+      {                    INT64_MAX } },
+    { { -INT64_C(   1111456630599713) },
+      {  INT64_C(3583279693703827422) },
+      { -INT64_C(              64695) } },
+    { {  INT64_C(             511402) },
+      { -INT64_C(                 18) },
+      {  INT64_C(                  2) } },
+    { { -INT64_C(              32388) },
+      { -INT64_C(4309009602734660142) },
+      {  INT64_C(                  0) } },
+    { { -INT64_C(3138863655802701117) },
+      {  INT64_C(7484822002328270834) },
+      { -INT64_C(    191581033679364) } },
+    { {  INT64_C(               8139) },
+      { -INT64_C(                 46) },
+      {  INT64_C(                  0) } },
+    { { -INT64_C(2968949853750295532) },
+      {  INT64_C(                 64) },
+      {                    INT64_MIN } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t a = simde_vld1_s64(test_vec[i].a);
+    simde_int64x1_t b = simde_vld1_s64(test_vec[i].b);
+    simde_int64x1_t r = simde_vqrshl_s64(a, b);
+
+    simde_test_arm_neon_assert_equal_i64x1(r, simde_vld1_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[8];
+    int8_t b[8];
+    uint8_t r[8];
+  } test_vec[] = {
+    { { UINT8_C(  3), UINT8_C( 58), UINT8_C( 21), UINT8_C( 89), UINT8_C(170), UINT8_C( 21), UINT8_C(  3), UINT8_C(  0) },
+      { -INT8_C( 10), -INT8_C(  9), -INT8_C(  1),  INT8_C(  2),  INT8_C(  8),  INT8_C(  7),  INT8_C(  0),  INT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  0), UINT8_C( 11),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  3), UINT8_C(  0) } },
+    { { UINT8_C(  0), UINT8_C(  5), UINT8_C( 43), UINT8_C(  2), UINT8_C( 26), UINT8_C(  1), UINT8_C(  0), UINT8_C(  1) },
+      { -INT8_C( 96), -INT8_C(  7),  INT8_C(  5), -INT8_C( 10), -INT8_C(  3), -INT8_C(  2), -INT8_C( 10),  INT8_C(  6) },
+      { UINT8_C(  0), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0), UINT8_C(  3), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64) } },
+    { { UINT8_C( 32), UINT8_C(149), UINT8_C(114), UINT8_C(  1), UINT8_C(  0), UINT8_C( 60), UINT8_C( 63), UINT8_C( 70) },
+      { -INT8_C(  9),  INT8_C(  0), -INT8_C(  5),  INT8_C(  8), -INT8_C(  3),  INT8_C(  4),  INT8_C(  2),  INT8_C(  7) },
+      { UINT8_C(  0), UINT8_C(149), UINT8_C(  4),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(252),    UINT8_MAX } },
+    { { UINT8_C(  3), UINT8_C(  2), UINT8_C( 10), UINT8_C(  4), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) },
+      { -INT8_C( 92),  INT8_C(  0),  INT8_C(  8), -INT8_C(  9), -INT8_C(  6), -INT8_C(  2), -INT8_C(  1),  INT8_C(  0) },
+      { UINT8_C(  0), UINT8_C(  2),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0) } },
+    { { UINT8_C(  2), UINT8_C(  1), UINT8_C( 88), UINT8_C(  5), UINT8_C(  2), UINT8_C(  3), UINT8_C(  3), UINT8_C( 31) },
+      { -INT8_C(  9),  INT8_C(  6),  INT8_C(  1),  INT8_C( 31), -INT8_C(  4),  INT8_C(  8),  INT8_C(  5),  INT8_C(  6) },
+      { UINT8_C(  0), UINT8_C( 64), UINT8_C(176),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C( 96),    UINT8_MAX } },
+    { { UINT8_C(  3), UINT8_C(  2),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  1), UINT8_C(  1), UINT8_C( 93) },
+      {  INT8_C(  9),  INT8_C( 10), -INT8_C(  9),  INT8_C(  3),  INT8_C(  9), -INT8_C( 10), -INT8_C(  2),  INT8_C( 10) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+    simde_uint8x8_t r = simde_vqrshl_u8(a, b);
+
+    simde_test_arm_neon_assert_equal_u8x8(r, simde_vld1_u8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[4];
+    int16_t b[4];
+    uint16_t r[4];
+  } test_vec[] = {
+    { { UINT16_C(   14), UINT16_C(    1), UINT16_C(    0), UINT16_C( 1251) },
+      { -INT16_C(   16), -INT16_C(    5),  INT16_C( 6149), -INT16_C(21513) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    2) } },
+    { { UINT16_C( 8478), UINT16_C(  287), UINT16_C(   85), UINT16_C( 2377) },
+      { -INT16_C(   11),  INT16_C(29966),  INT16_C(    1),  INT16_C(   17) },
+      { UINT16_C(    4),     UINT16_MAX, UINT16_C(  170),     UINT16_MAX } },
+    { { UINT16_C(  682), UINT16_C(13103), UINT16_C(   51), UINT16_C(   57) },
+      {  INT16_C(   74),  INT16_C(    0),  INT16_C(    5),  INT16_C(   34) },
+      {     UINT16_MAX, UINT16_C(13103), UINT16_C( 1632),     UINT16_MAX } },
+    { { UINT16_C(    1), UINT16_C( 3294), UINT16_C(    0), UINT16_C(30749) },
+      { -INT16_C(   12),  INT16_C( 1040),  INT16_C(27643), -INT16_C(    3) },
+      { UINT16_C(    0),     UINT16_MAX, UINT16_C(    0), UINT16_C( 3844) } },
+    { { UINT16_C( 3120), UINT16_C(   54), UINT16_C(  408), UINT16_C(26070) },
+      { -INT16_C(15620), -INT16_C(   13), -INT16_C(    7),  INT16_C(23052) },
+      { UINT16_C(  195), UINT16_C(    0), UINT16_C(    3),     UINT16_MAX } },
+    { { UINT16_C(   23), UINT16_C(   18), UINT16_C(  229), UINT16_C(19440) },
+      { -INT16_C(    6),  INT16_C(    1), -INT16_C(   54),  INT16_C(23543) },
+      { UINT16_C(    0), UINT16_C(   36), UINT16_C(    0), UINT16_C(   38) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t a = simde_vld1_u16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+    simde_uint16x4_t r = simde_vqrshl_u16(a, b);
+
+    simde_test_arm_neon_assert_equal_u16x4(r, simde_vld1_u16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    int32_t b[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    { { UINT32_C(  67955131), UINT32_C(  11299653) },
+      {  INT32_C( 667419678),  INT32_C(        33) },
+      {          UINT32_MAX,          UINT32_MAX } },
+    { { UINT32_C(         1), UINT32_C(     65146) },
+      {  INT32_C(        33), -INT32_C(       102) },
+      {          UINT32_MAX, UINT32_C(         0) } },
+    { { UINT32_C(      1637), UINT32_C( 348109307) },
+      {  INT32_C(        11), -INT32_C(         7) },
+      { UINT32_C(   3352576), UINT32_C(   2719604) } },
+    { { UINT32_C( 256693005), UINT32_C(    127204) },
+      { -INT32_C( 972850445), -INT32_C(         2) },
+      { UINT32_C(     31335), UINT32_C(     31801) } },
+    { { UINT32_C(         3), UINT32_C(       437) },
+      { -INT32_C(         9),  INT32_C( 701529825) },
+      { UINT32_C(         0), UINT32_C(         0) } },
+    { { UINT32_C(   1426401), UINT32_C(     19969) },
+      { -INT32_C(         7),  INT32_C(        22) },
+      { UINT32_C(     11144),          UINT32_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+    simde_uint32x2_t r = simde_vqrshl_u32(a, b);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshl_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[1];
+    int64_t b[1];
+    uint64_t r[1];
+  } test_vec[] = {
+    { { UINT64_C(             2067562) },
+      { -INT64_C(                 10) },
+      { UINT64_C(                2019) } },
+    { { UINT64_C(                  31) },
+      {  INT64_C(                 54) },
+      { UINT64_C(  558446353793941504) } },
+    { { UINT64_C(        322163060335) },
+      {  INT64_C(                 42) },
+      {                    UINT64_MAX } },
+    { { UINT64_C(                  84) },
+      {  INT64_C(5569512141854159091) },
+      { UINT64_C(                   0) } },
+    { { UINT64_C(                   0) },
+      { -INT64_C(                  7) },
+      { UINT64_C(                   0) } },
+    { { UINT64_C(   31499357867920306) },
+      {  INT64_C(                  3) },
+      { UINT64_C(  251994862943362448) } },
+    { { UINT64_C(        127970180735) },
+      { -INT64_C(                 47) },
+      { UINT64_C(                   0) } },
+    { { UINT64_C(  713803741488430646) },
+      {  INT64_C(                  0) },
+      { UINT64_C(  713803741488430646) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t a = simde_vld1_u64(test_vec[i].a);
+    simde_int64x1_t b = simde_vld1_s64(test_vec[i].b);
+    simde_uint64x1_t r = simde_vqrshl_u64(a, b);
+
+    simde_test_arm_neon_assert_equal_u64x1(r, simde_vld1_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C( 89),  INT8_C(  4),  INT8_C(  0),  INT8_C(  2),  INT8_C( 29), -INT8_C(  2),  INT8_C(  8),  INT8_C(  0),
+          -INT8_C(  3), -INT8_C( 15),  INT8_C(101),  INT8_C(  0),  INT8_C( 12),  INT8_C(  4),  INT8_C(  9),  INT8_C(  0) },
+      {  INT8_C(  4), -INT8_C( 27), -INT8_C(  1),  INT8_C(  9),  INT8_C(  4),  INT8_C(  7),  INT8_C( 10), -INT8_C(  9),
+          -INT8_C(  7), -INT8_C( 10),  INT8_C(  6), -INT8_C(  2), -INT8_C(  4), -INT8_C( 10), -INT8_C(  1),  INT8_C(  1) },
+      {     INT8_MIN,  INT8_C(  0),  INT8_C(  0),     INT8_MAX,     INT8_MAX,     INT8_MIN,     INT8_MAX,  INT8_C(  0),
+           INT8_C(  0),  INT8_C(  0),     INT8_MAX,  INT8_C(  0),  INT8_C(  1),  INT8_C(  0),  INT8_C(  5),  INT8_C(  0) } },
+    { { -INT8_C(  7),  INT8_C(  0),  INT8_C(  0),  INT8_C( 34),  INT8_C(  6),  INT8_C( 75),  INT8_C( 37), -INT8_C(  5),
+          -INT8_C(  1), -INT8_C(  7), -INT8_C( 61), -INT8_C( 12), -INT8_C(  7),  INT8_C( 10), -INT8_C( 30), -INT8_C(  1) },
+      {  INT8_C(  6), -INT8_C(  7), -INT8_C(  3),  INT8_C(  9),  INT8_C(  8), -INT8_C(  4), -INT8_C(  1), -INT8_C(  7),
+           INT8_C(  3),  INT8_C(  0), -INT8_C( 10), -INT8_C(  3),  INT8_C(  2), -INT8_C(  5),  INT8_C( 58),  INT8_C(  8) },
+      {     INT8_MIN,  INT8_C(  0),  INT8_C(  0),     INT8_MAX,     INT8_MAX,  INT8_C(  5),  INT8_C( 19),  INT8_C(  0),
+          -INT8_C(  8), -INT8_C(  7),  INT8_C(  0), -INT8_C(  1), -INT8_C( 28),  INT8_C(  0),     INT8_MIN,     INT8_MIN } },
+    { {  INT8_C( 47),  INT8_C(  1), -INT8_C(  1),  INT8_C(  0),     INT8_MIN,  INT8_C(  6),  INT8_C(  1),     INT8_MAX,
+          -INT8_C( 11),  INT8_C( 10), -INT8_C(  3), -INT8_C( 15),  INT8_C(  7), -INT8_C( 24), -INT8_C( 14), -INT8_C(  3) },
+      { -INT8_C(  1), -INT8_C(  1), -INT8_C(  4),  INT8_C(  9), -INT8_C(  7),  INT8_C(  3),  INT8_C(  8),  INT8_C(  0),
+           INT8_C(  4),  INT8_C(  6), -INT8_C(  7),  INT8_C(  5), -INT8_C(  8), -INT8_C( 77),  INT8_C(  4),  INT8_C(  1) },
+      {  INT8_C( 24),  INT8_C(  1),  INT8_C(  0),  INT8_C(  0), -INT8_C(  1),  INT8_C( 48),     INT8_MAX,     INT8_MAX,
+              INT8_MIN,     INT8_MAX,  INT8_C(  0),     INT8_MIN,  INT8_C(  0),  INT8_C(  0),     INT8_MIN, -INT8_C(  6) } },
+    { { -INT8_C(  1),  INT8_C(  7),     INT8_MIN,  INT8_C(  0), -INT8_C( 18), -INT8_C( 36),  INT8_C(  4),  INT8_C(  1),
+          -INT8_C(  4), -INT8_C(  7),  INT8_C(  7),  INT8_C(  0), -INT8_C(  1),  INT8_C( 69),  INT8_C( 30),  INT8_C(  1) },
+      {  INT8_C(  2),  INT8_C(  1),  INT8_C(  2), -INT8_C(  1),  INT8_C( 10), -INT8_C(  6),  INT8_C( 10),  INT8_C(  0),
+           INT8_C(  2), -INT8_C(  8),  INT8_C(  7),  INT8_C(  2),  INT8_C( 10), -INT8_C(  9), -INT8_C(  7), -INT8_C(  4) },
+      { -INT8_C(  4),  INT8_C( 14),     INT8_MIN,  INT8_C(  0),     INT8_MIN, -INT8_C(  1),     INT8_MAX,  INT8_C(  1),
+          -INT8_C( 16),  INT8_C(  0),     INT8_MAX,  INT8_C(  0),     INT8_MIN,  INT8_C(  0),  INT8_C(  0),  INT8_C(  0) } },
+    { {  INT8_C( 62), -INT8_C(  1), -INT8_C(  7),  INT8_C(  0), -INT8_C(  1), -INT8_C( 62),  INT8_C(  0), -INT8_C(  7),
+           INT8_C(  5),  INT8_C(  5), -INT8_C(  2), -INT8_C(107), -INT8_C(  1), -INT8_C( 12),  INT8_C( 90),  INT8_C(  1) },
+      {  INT8_C(  0),  INT8_C(  5), -INT8_C(  2), -INT8_C(  8),  INT8_C(  1), -INT8_C(100),  INT8_C(  4), -INT8_C(  3),
+          -INT8_C(  3),  INT8_C(  4), -INT8_C(  1), -INT8_C(  7),  INT8_C(  5), -INT8_C(  8), -INT8_C(  5),  INT8_C(  1) },
+      {  INT8_C( 62), -INT8_C( 32), -INT8_C(  2),  INT8_C(  0), -INT8_C(  2),  INT8_C(  0),  INT8_C(  0), -INT8_C(  1),
+           INT8_C(  1),  INT8_C( 80), -INT8_C(  1), -INT8_C(  1), -INT8_C( 32),  INT8_C(  0),  INT8_C(  3),  INT8_C(  2) } },
+    { {  INT8_C(  0),  INT8_C(  0),  INT8_C(  6), -INT8_C(127),  INT8_C( 20),     INT8_MAX,  INT8_C( 45),  INT8_C(  1),
+           INT8_C( 45), -INT8_C( 29), -INT8_C(102),     INT8_MAX,  INT8_C( 39),  INT8_C(  0),  INT8_C(123), -INT8_C( 17) },
+      { -INT8_C(  9),  INT8_C(  3), -INT8_C(  7), -INT8_C(  3), -INT8_C( 10), -INT8_C(  2), -INT8_C(  2), -INT8_C(  9),
+           INT8_C(  8),  INT8_C(  4),  INT8_C(  5), -INT8_C(  4), -INT8_C(  5),  INT8_C(  1), -INT8_C(  5), -INT8_C(  5) },
+      {  INT8_C(  0),  INT8_C(  0),  INT8_C(  0), -INT8_C( 16),  INT8_C(  0),  INT8_C( 32),  INT8_C( 11),  INT8_C(  0),
+              INT8_MAX,     INT8_MIN,     INT8_MIN,  INT8_C(  8),  INT8_C(  1),  INT8_C(  0),  INT8_C(  4), -INT8_C(  1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int8x16_t r = simde_vqrshlq_s8(a, b);
+
+    simde_test_arm_neon_assert_equal_i8x16(r, simde_vld1q_s8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { {      INT16_MAX,  INT16_C(    6), -INT16_C(16375),  INT16_C(   69), -INT16_C( 1762), -INT16_C(  493),  INT16_C(  188), -INT16_C(    1) },
+      { -INT16_C(   14), -INT16_C( 8951), -INT16_C(    8),  INT16_C(  106),  INT16_C(   93), -INT16_C(   44),  INT16_C(    3),  INT16_C(   11) },
+      {  INT16_C(    2),  INT16_C( 3072), -INT16_C(   64),      INT16_MAX,      INT16_MIN,  INT16_C(    0),  INT16_C( 1504), -INT16_C( 2048) } },
+    { {  INT16_C(   31), -INT16_C( 2309),  INT16_C(   24),  INT16_C(    6), -INT16_C(   47),  INT16_C(  832), -INT16_C(   22),  INT16_C(    3) },
+      {  INT16_C( 8719), -INT16_C(   11), -INT16_C(   17), -INT16_C(   12), -INT16_C(   96), -INT16_C(17393), -INT16_C(   11),  INT16_C(    9) },
+      {      INT16_MAX, -INT16_C(    1),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0),      INT16_MAX,  INT16_C(    0),  INT16_C( 1536) } },
+    { { -INT16_C(  155), -INT16_C(21194), -INT16_C(   10),  INT16_C(   52),  INT16_C(   24),  INT16_C( 6364),  INT16_C(32635),  INT16_C(    6) },
+      {  INT16_C(   12),  INT16_C(    6),  INT16_C(11016), -INT16_C(   17), -INT16_C(24335),  INT16_C(   16), -INT16_C( 4336),  INT16_C(    0) },
+      {      INT16_MIN,      INT16_MIN, -INT16_C( 2560),  INT16_C(    0),  INT16_C(    0),      INT16_MAX,      INT16_MAX,  INT16_C(    6) } },
+    { {  INT16_C( 7236),  INT16_C(   10), -INT16_C(   81), -INT16_C(    6),  INT16_C( 7061), -INT16_C(    1), -INT16_C( 1582),  INT16_C(    4) },
+      { -INT16_C(   10), -INT16_C(   13),  INT16_C(    0), -INT16_C(    8), -INT16_C(    7), -INT16_C(23297), -INT16_C(   22), -INT16_C(  128) },
+      {  INT16_C(    7),  INT16_C(    0), -INT16_C(   81),  INT16_C(    0),  INT16_C(   55),  INT16_C(    0),  INT16_C(    0),  INT16_C(    0) } },
+    { {  INT16_C(  571), -INT16_C(    3),  INT16_C(   15),  INT16_C(  427),  INT16_C(  141), -INT16_C(   15),      INT16_MAX,  INT16_C(   12) },
+      {  INT16_C(    8),  INT16_C(   69), -INT16_C(   10), -INT16_C(    1),  INT16_C(14805),  INT16_C(    3), -INT16_C(   14),  INT16_C(   17) },
+      {      INT16_MAX,      INT16_MIN,  INT16_C(    0),  INT16_C(  214),  INT16_C(    0), -INT16_C(  120),  INT16_C(    2),      INT16_MAX } },
+    { {      INT16_MIN,  INT16_C( 4932),  INT16_C(    0), -INT16_C( 2263), -INT16_C( 6349),  INT16_C(    3), -INT16_C( 2734),  INT16_C(  780) },
+      { -INT16_C(26876), -INT16_C(13295), -INT16_C(   10),  INT16_C(    3), -INT16_C(   22),  INT16_C(    6), -INT16_C(    6), -INT16_C(28144) },
+      {      INT16_MIN,      INT16_MAX,  INT16_C(    0), -INT16_C(18104),  INT16_C(    0),  INT16_C(  192), -INT16_C(   43),      INT16_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_int16x8_t r = simde_vqrshlq_s16(a, b);
+
+    simde_test_arm_neon_assert_equal_i16x8(r, simde_vld1q_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(     34330),  INT32_C(  37500479),  INT32_C(  11694256), -INT32_C(  12346687) },
+      {  INT32_C(        24), -INT32_C(        26),  INT32_C(        31), -INT32_C(         7) },
+      {           INT32_MAX,  INT32_C(         1),           INT32_MAX, -INT32_C(     96458) } },
+    { {  INT32_C(     84648),  INT32_C(    154594),  INT32_C(       110),  INT32_C(         0) },
+      { -INT32_C(         4), -INT32_C(1077874157), -INT32_C(        14), -INT32_C(        19) },
+      {  INT32_C(      5291),           INT32_MAX,  INT32_C(         0),  INT32_C(         0) } },
+    { {  INT32_C(1168412761), -INT32_C(1673212708),           INT32_MIN,  INT32_C(   1865532) },
+      {  INT32_C(        20),  INT32_C(         6),  INT32_C(        29),  INT32_C(        29) },
+      {           INT32_MAX,           INT32_MIN,           INT32_MIN,           INT32_MAX } },
+    { {  INT32_C(      3269),           INT32_MIN, -INT32_C(   9317206),  INT32_C(      1734) },
+      { -INT32_C(1181912584), -INT32_C(        26), -INT32_C(        14), -INT32_C(        19) },
+      {  INT32_C(        13), -INT32_C(        32), -INT32_C(       569),  INT32_C(         0) } },
+    { {  INT32_C(        13),  INT32_C(    151484), -INT32_C( 345552711),  INT32_C(         0) },
+      {  INT32_C(        14), -INT32_C(        85), -INT32_C(         9),  INT32_C(        18) },
+      {  INT32_C(    212992),  INT32_C(         0), -INT32_C(    674908),  INT32_C(         0) } },
+    { {  INT32_C(    735109),  INT32_C(    854680),  INT32_C(    332261),  INT32_C(       206) },
+      { -INT32_C(         5),  INT32_C(        29),  INT32_C(         0),  INT32_C(         4) },
+      {  INT32_C(     22972),           INT32_MAX,  INT32_C(    332261),  INT32_C(      3296) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_int32x4_t r = simde_vqrshlq_s32(a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(  32832213993946977),  INT64_C(              13172) },
+      { -INT64_C(1371753490808642000), -INT64_C(                 18) },
+      {                    INT64_MAX,  INT64_C(                  0) } },
+    { {  INT64_C(            1595527), -INT64_C(                 61) },
+      { -INT64_C(                 59), -INT64_C(6992457155081655007) },
+      {  INT64_C(                  0), -INT64_C(       523986010112) } },
+    { {  INT64_C(              77681), -INT64_C(         1800542019) },
+      {  INT64_C(                 35), -INT64_C(                 13) },
+      {  INT64_C(   2669098836164608), -INT64_C(             219793) } },
+    { { -INT64_C(           10170568),  INT64_C(     26972747671473) },
+      { -INT64_C(                 23), -INT64_C(1704149588558515494) },
+      { -INT64_C(                  1),  INT64_C(                 98) } },
+    { { -INT64_C(          720709905),  INT64_C(        11011254366) },
+      {  INT64_C(                 44),  INT64_C(                 33) },
+      {                    INT64_MIN,                    INT64_MAX } },
+    { {  INT64_C(           56063451),  INT64_C(                  1) },
+      {  INT64_C(2724416212343547158), -INT64_C(                 12) },
+      {  INT64_C(    235147156783104),  INT64_C(                  0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+    simde_int64x2_t r = simde_vqrshlq_s64(a, b);
+
+    simde_test_arm_neon_assert_equal_i64x2(r, simde_vld1q_s64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    int8_t b[16];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C(202), UINT8_C(  4), UINT8_C(  6), UINT8_C( 54), UINT8_C(  0), UINT8_C(  1), UINT8_C( 25), UINT8_C(  3),
+          UINT8_C(  0), UINT8_C(  0), UINT8_C(  2), UINT8_C(  5), UINT8_C(  2), UINT8_C( 18), UINT8_C(109), UINT8_C(  1) },
+      { -INT8_C(  7), -INT8_C( 16), -INT8_C(  2),  INT8_C(  4), -INT8_C(  9),  INT8_C(  5), -INT8_C( 10),  INT8_C( 10),
+          -INT8_C( 66), -INT8_C(  7),  INT8_C(  0), -INT8_C(  5),  INT8_C(  0), -INT8_C(120), -INT8_C(  6), -INT8_C(  6) },
+      { UINT8_C(  2), UINT8_C(  0), UINT8_C(  2),    UINT8_MAX, UINT8_C(  0), UINT8_C( 32), UINT8_C(  0),    UINT8_MAX,
+          UINT8_C(  0), UINT8_C(  0), UINT8_C(  2), UINT8_C(  0), UINT8_C(  2), UINT8_C(  0), UINT8_C(  2), UINT8_C(  0) } },
+    { { UINT8_C(  2), UINT8_C(  1), UINT8_C(  3), UINT8_C( 63), UINT8_C(  3), UINT8_C( 37), UINT8_C(  5), UINT8_C(235),
+          UINT8_C( 45), UINT8_C(  0), UINT8_C(  4), UINT8_C( 17), UINT8_C( 65), UINT8_C( 11), UINT8_C( 41), UINT8_C( 54) },
+      {  INT8_C(109),  INT8_C(  9), -INT8_C(  7),  INT8_C(  2), -INT8_C(  1), -INT8_C(  9),  INT8_C( 72), -INT8_C(  7),
+          -INT8_C(  3),  INT8_C(  5),  INT8_C(  7), -INT8_C(  6),  INT8_C(  2),  INT8_C(  6), -INT8_C(  9), -INT8_C( 66) },
+      {    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(252), UINT8_C(  2), UINT8_C(  0),    UINT8_MAX, UINT8_C(  2),
+          UINT8_C(  6), UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0), UINT8_C(  0) } },
+    { { UINT8_C(  4), UINT8_C(  7), UINT8_C(  3), UINT8_C(  0), UINT8_C(  4), UINT8_C(  1), UINT8_C( 31), UINT8_C(  4),
+          UINT8_C(  7), UINT8_C(  0), UINT8_C(  2), UINT8_C( 14), UINT8_C( 26), UINT8_C( 17), UINT8_C(  1), UINT8_C( 10) },
+      {  INT8_C(  0),  INT8_C(  7), -INT8_C(  6),  INT8_C(  7), -INT8_C( 12), -INT8_C(  5),  INT8_C(  1),  INT8_C(  3),
+          -INT8_C(  1),  INT8_C(  6), -INT8_C(  4), -INT8_C(  3), -INT8_C(  9),  INT8_C(  7),  INT8_C(  6),  INT8_C(  6) },
+      { UINT8_C(  4),    UINT8_MAX, UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 62), UINT8_C( 32),
+          UINT8_C(  4), UINT8_C(  0), UINT8_C(  0), UINT8_C(  2), UINT8_C(  0),    UINT8_MAX, UINT8_C( 64),    UINT8_MAX } },
+    { { UINT8_C(  4), UINT8_C( 16), UINT8_C(  1), UINT8_C(  0), UINT8_C( 17), UINT8_C(  0), UINT8_C(  3), UINT8_C(  1),
+          UINT8_C(  5), UINT8_C(  0), UINT8_C( 16), UINT8_C(115), UINT8_C(  1), UINT8_C( 61), UINT8_C(138), UINT8_C( 13) },
+      {  INT8_C(  2),  INT8_C(  2), -INT8_C(  9),  INT8_C(  7), -INT8_C( 71), -INT8_C( 64), -INT8_C(  1),  INT8_C(  5),
+          -INT8_C( 65),  INT8_C(  6), -INT8_C(  2), -INT8_C(  5),  INT8_C(  0), -INT8_C(  1),  INT8_C(  1),  INT8_C(  0) },
+      { UINT8_C( 16), UINT8_C( 64), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  2), UINT8_C( 32),
+          UINT8_C(  0), UINT8_C(  0), UINT8_C(  4), UINT8_C(  4), UINT8_C(  1), UINT8_C( 31),    UINT8_MAX, UINT8_C( 13) } },
+    { { UINT8_C(  3), UINT8_C(  0), UINT8_C( 22), UINT8_C(  0), UINT8_C( 10), UINT8_C(  6), UINT8_C( 59), UINT8_C( 11),
+          UINT8_C(  1), UINT8_C(  5), UINT8_C(114), UINT8_C(  3), UINT8_C(  1), UINT8_C(  1), UINT8_C(  3), UINT8_C(  0) },
+      {  INT8_C(  9), -INT8_C( 44),  INT8_C( 10), -INT8_C(  3),  INT8_C(  6),  INT8_C( 10),  INT8_C(  7), -INT8_C(  4),
+           INT8_C(  7),  INT8_C( 83), -INT8_C(  4), -INT8_C(  9), -INT8_C( 22),  INT8_C(  8),  INT8_C(  8),  INT8_C(  1) },
+      {    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  1),
+          UINT8_C(128),    UINT8_MAX, UINT8_C(  7), UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0) } },
+    { { UINT8_C(206), UINT8_C( 44), UINT8_C(  8), UINT8_C( 23), UINT8_C( 46), UINT8_C(  7), UINT8_C(  4), UINT8_C(  2),
+          UINT8_C(  0), UINT8_C(  0), UINT8_C( 65), UINT8_C( 10), UINT8_C(  2), UINT8_C( 81), UINT8_C(  1), UINT8_C(  1) },
+      {  INT8_C(  1), -INT8_C( 38), -INT8_C( 10),  INT8_C(  7),  INT8_C(126),  INT8_C(  3), -INT8_C(  8),  INT8_C(  4),
+           INT8_C(  0),  INT8_C(  8), -INT8_C(  2),  INT8_C(  0), -INT8_C( 10), -INT8_C( 57), -INT8_C(  9),  INT8_C(  6) },
+      {    UINT8_MAX, UINT8_C(  0), UINT8_C(  0),    UINT8_MAX,    UINT8_MAX, UINT8_C( 56), UINT8_C(  0), UINT8_C( 32),
+          UINT8_C(  0), UINT8_C(  0), UINT8_C( 16), UINT8_C( 10), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C( 64) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_uint8x16_t r = simde_vqrshlq_u8(a, b);
+
+    simde_test_arm_neon_assert_equal_u8x16(r, simde_vld1q_u8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    int16_t b[8];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { UINT16_C(    3), UINT16_C( 8986), UINT16_C( 6641), UINT16_C( 2585), UINT16_C(    4), UINT16_C(    2), UINT16_C(    9), UINT16_C(    1) },
+      {  INT16_C(   11), -INT16_C(15376),  INT16_C(    4), -INT16_C(32015), -INT16_C(  128),  INT16_C(   10),  INT16_C(   72),  INT16_C(    2) },
+      { UINT16_C( 6144), UINT16_C(    0),     UINT16_MAX, UINT16_C(    0), UINT16_C(    0), UINT16_C( 2048),     UINT16_MAX, UINT16_C(    4) } },
+    { { UINT16_C(   70), UINT16_C(    0), UINT16_C(    1), UINT16_C(  255), UINT16_C(   57), UINT16_C(19476), UINT16_C(    0), UINT16_C(   48) },
+      { -INT16_C(    6),  INT16_C(   18), -INT16_C(   14),  INT16_C(18178),  INT16_C(    1),  INT16_C(    0),  INT16_C(   17), -INT16_C(    9) },
+      { UINT16_C(    1), UINT16_C(    0), UINT16_C(    0), UINT16_C( 1020), UINT16_C(  114), UINT16_C(19476), UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(  281), UINT16_C(    0), UINT16_C(  380), UINT16_C( 2030), UINT16_C(  384), UINT16_C( 1189), UINT16_C(    7), UINT16_C(14900) },
+      {  INT16_C(26867),  INT16_C(   80), -INT16_C(   12),  INT16_C(    4),  INT16_C(27919),  INT16_C(22287), -INT16_C( 4879), -INT16_C(   17) },
+      { UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(32480),     UINT16_MAX,     UINT16_MAX, UINT16_C(    0), UINT16_C(    0) } },
+    { { UINT16_C(17877), UINT16_C(    8), UINT16_C(  302), UINT16_C(60604), UINT16_C(    3), UINT16_C(    8), UINT16_C(  766), UINT16_C(    7) },
+      {  INT16_C(  112),  INT16_C(16394),  INT16_C(   14), -INT16_C(    7), -INT16_C(19705),  INT16_C(    0),  INT16_C(   13),  INT16_C( 5124) },
+      {     UINT16_MAX, UINT16_C( 8192),     UINT16_MAX, UINT16_C(  473), UINT16_C(  384), UINT16_C(    8),     UINT16_MAX, UINT16_C(  112) } },
+    { { UINT16_C(   12), UINT16_C(15070), UINT16_C(    9), UINT16_C(   13), UINT16_C(  331), UINT16_C(58152), UINT16_C(  182), UINT16_C(38895) },
+      { -INT16_C(30201),  INT16_C(   18),  INT16_C(    7),  INT16_C(   13),  INT16_C(   11), -INT16_C(   17),  INT16_C(   14),  INT16_C(   66) },
+      { UINT16_C( 1536),     UINT16_MAX, UINT16_C( 1152),     UINT16_MAX,     UINT16_MAX, UINT16_C(    0),     UINT16_MAX,     UINT16_MAX } },
+    { { UINT16_C(  287), UINT16_C(31952), UINT16_C( 1743), UINT16_C( 1912), UINT16_C(   18), UINT16_C(  798), UINT16_C( 3034), UINT16_C(29933) },
+      {  INT16_C(22271),  INT16_C(   17),  INT16_C(    8),  INT16_C(25803), -INT16_C(    3),  INT16_C(   12),  INT16_C(   40),  INT16_C(   12) },
+      { UINT16_C(  144),     UINT16_MAX,     UINT16_MAX, UINT16_C(    0), UINT16_C(    2),     UINT16_MAX,     UINT16_MAX,     UINT16_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_uint16x8_t r = simde_vqrshlq_u16(a, b);
+
+    simde_test_arm_neon_assert_equal_u16x8(r, simde_vld1q_u16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    int32_t b[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(      1011), UINT32_C(  47954527), UINT32_C(   3356330), UINT32_C(      2736) },
+      {  INT32_C(1087596561), -INT32_C(        26), -INT32_C(        15), -INT32_C(         9) },
+      { UINT32_C( 132513792), UINT32_C(         1), UINT32_C(       102), UINT32_C(         5) } },
+    { { UINT32_C(        58), UINT32_C( 187586613), UINT32_C(   1006826), UINT32_C(    139992) },
+      {  INT32_C(        17),  INT32_C(         3), -INT32_C(         5), -INT32_C(        32) },
+      { UINT32_C(   7602176), UINT32_C(1500692904), UINT32_C(     31463), UINT32_C(         0) } },
+    { { UINT32_C( 574869976), UINT32_C(      8141), UINT32_C(      1560), UINT32_C(        24) },
+      {  INT32_C(1683895520),  INT32_C(1284509185), -INT32_C(        26), -INT32_C(        21) },
+      { UINT32_C(         0), UINT32_C(     16282), UINT32_C(         0), UINT32_C(         0) } },
+    { { UINT32_C(      2688), UINT32_C(     39200), UINT32_C(        77), UINT32_C(        16) },
+      {  INT32_C(        30), -INT32_C(         5),  INT32_C(        21),  INT32_C( 342884850) },
+      {          UINT32_MAX, UINT32_C(      1225), UINT32_C( 161480704), UINT32_C(         0) } },
+    { { UINT32_C(   2665719), UINT32_C(        10), UINT32_C(         0), UINT32_C(       197) },
+      {  INT32_C(        10),  INT32_C(        13),  INT32_C(1457410638),  INT32_C(        24) },
+      { UINT32_C(2729696256), UINT32_C(     81920), UINT32_C(         0), UINT32_C(3305111552) } },
+    { { UINT32_C(    202070), UINT32_C(    961364), UINT32_C(        20),          UINT32_MAX },
+      { -INT32_C(         4),  INT32_C(        30), -INT32_C(        10),  INT32_C(        23) },
+      { UINT32_C(     12629),          UINT32_MAX, UINT32_C(         0),          UINT32_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_uint32x4_t r = simde_vqrshlq_u32(a, b);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vqrshlq_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    int64_t b[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(                  15), UINT64_C(  219787152937650981) },
+      { -INT64_C(                 45),  INT64_C(                 74) },
+      { UINT64_C(                   0),                    UINT64_MAX } },
+    { { UINT64_C(                 751), UINT64_C( 2478141738843732771) },
+      { -INT64_C(                 57), -INT64_C(                 50) },
+      { UINT64_C(                   0), UINT64_C(                2201) } },
+    { { UINT64_C(  157707115733780614), UINT64_C(            23404924) },
+      { -INT64_C(                 31),  INT64_C(1851563877173297653) },
+      { UINT64_C(            73438099), UINT64_C(               11428) } },
+    { { UINT64_C(           136999210), UINT64_C(            21630367) },
+      {  INT64_C( 650094790798607158),  INT64_C(                 16) },
+      {                    UINT64_MAX, UINT64_C(       1417567731712) } },
+    { {                    UINT64_MAX, UINT64_C(       3157822055622) },
+      { -INT64_C(                  4),  INT64_C(                 54) },
+      { UINT64_C( 1152921504606846976),                    UINT64_MAX } },
+    { { UINT64_C(    7362874224804623), UINT64_C(  955520151985250193) },
+      { -INT64_C(8051966188607726327),  INT64_C(                 18) },
+      { UINT64_C( 3769791603099966976),                    UINT64_MAX } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+    simde_uint64x2_t r = simde_vqrshlq_u64(a, b);
+
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlb_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlh_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshls_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshld_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlb_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlh_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshls_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshld_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshl_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vqrshlq_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -272,7 +272,55 @@ test_simde_vqshlb_u8 (SIMDE_MUNIT_TEST_ARGS) {
       UINT8_C(  3) },
     { UINT8_C(  3),
       -INT8_C(  13),
-      UINT8_C(  0) }
+      UINT8_C(  0) },
+    {     UINT8_MAX,
+      -INT8_C(   8),
+      UINT8_C(   0) },
+    {     UINT8_MAX,
+      -INT8_C(   7),
+      UINT8_C(   1) },
+    { UINT8_C(   1),
+       INT8_C(   7),
+      UINT8_C( 128) },
+    { UINT8_C(   2),
+       INT8_C(   7),
+          UINT8_MAX },
+    { UINT8_C(   0),
+       INT8_C(   8),
+      UINT8_C(   0) },
+    { UINT8_C( 128),
+       INT8_C(   1),
+          UINT8_MAX },
+    { UINT8_C( 127),
+       INT8_C(   1),
+      UINT8_C( 254) },
+    {     UINT8_MAX,
+       INT8_C(   0),
+          UINT8_MAX },
+    { UINT8_C(   1),
+       INT8_C(   8),
+          UINT8_MAX },
+    { UINT8_C(   3),
+      -INT8_C(   1),
+      UINT8_C(   1) },
+    { UINT8_C( 254),
+           INT8_MIN,
+      UINT8_C(   0) },
+    { UINT8_C(   2),
+           INT8_MAX,
+          UINT8_MAX },
+    { UINT8_C( 128),
+      -INT8_C(   7),
+      UINT8_C(   1) },
+    { UINT8_C(   0),
+      -INT8_C(   8),
+      UINT8_C(   0) },
+    { UINT8_C(   5),
+       INT8_C(   2),
+      UINT8_C(  20) },
+    {     UINT8_MAX,
+       INT8_C(   1),
+          UINT8_MAX }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -328,7 +376,55 @@ test_simde_vqshlh_u16 (SIMDE_MUNIT_TEST_ARGS) {
            UINT16_MAX },
     { UINT16_C(61653),
       -INT16_C(     4),
-      UINT16_C( 3853) }
+      UINT16_C( 3853) },
+    {      UINT16_MAX,
+      -INT16_C(   16),
+      UINT16_C(    0) },
+    {      UINT16_MAX,
+      -INT16_C(   15),
+      UINT16_C(    1) },
+    { UINT16_C(    1),
+       INT16_C(   15),
+      UINT16_C(32768) },
+    { UINT16_C(    2),
+       INT16_C(   15),
+           UINT16_MAX },
+    { UINT16_C(    0),
+       INT16_C(   16),
+      UINT16_C(    0) },
+    { UINT16_C(32768),
+       INT16_C(    1),
+           UINT16_MAX },
+    { UINT16_C(32767),
+       INT16_C(    1),
+      UINT16_C(65534) },
+    {      UINT16_MAX,
+       INT16_C(    0),
+           UINT16_MAX },
+    { UINT16_C(    1),
+       INT16_C(   16),
+           UINT16_MAX },
+    { UINT16_C(    3),
+      -INT16_C(    1),
+      UINT16_C(    1) },
+    { UINT16_C(65534),
+      -INT16_C(  128),
+      UINT16_C(    0) },
+    { UINT16_C(    2),
+       INT16_C(  127),
+           UINT16_MAX },
+    { UINT16_C(32768),
+      -INT16_C(   15),
+      UINT16_C(    1) },
+    { UINT16_C(    0),
+      -INT16_C(   16),
+      UINT16_C(    0) },
+    { UINT16_C(32768),
+       INT16_C(  256),
+      UINT16_C(32768) },
+    { UINT16_C(    1),
+       INT16_C(  271),
+      UINT16_C(32768) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -384,7 +480,55 @@ test_simde_vqshls_u32 (SIMDE_MUNIT_TEST_ARGS) {
       UINT32_C(  13500416) },
     { UINT32_C(  43944177),
        INT32_C(          29),
-                UINT32_MAX }
+                UINT32_MAX },
+    {           UINT32_MAX,
+      -INT32_C(        32),
+      UINT32_C(         0) },
+    {           UINT32_MAX,
+      -INT32_C(        31),
+      UINT32_C(         1) },
+    { UINT32_C(         1),
+       INT32_C(        31),
+      UINT32_C(2147483648) },
+    { UINT32_C(         2),
+       INT32_C(        31),
+                UINT32_MAX },
+    { UINT32_C(         0),
+       INT32_C(        32),
+      UINT32_C(         0) },
+    { UINT32_C(2147483648),
+       INT32_C(         1),
+                UINT32_MAX },
+    { UINT32_C(2147483647),
+       INT32_C(         1),
+      UINT32_C(4294967294) },
+    {           UINT32_MAX,
+       INT32_C(         0),
+                UINT32_MAX },
+    { UINT32_C(         1),
+       INT32_C(        32),
+                UINT32_MAX },
+    { UINT32_C(         3),
+      -INT32_C(         1),
+      UINT32_C(         1) },
+    { UINT32_C(4294967294),
+      -INT32_C(       128),
+      UINT32_C(         0) },
+    { UINT32_C(         2),
+       INT32_C(       127),
+                UINT32_MAX },
+    { UINT32_C(2147483648),
+      -INT32_C(        31),
+      UINT32_C(         1) },
+    { UINT32_C(         0),
+      -INT32_C(        32),
+      UINT32_C(         0) },
+    { UINT32_C(2147483648),
+       INT32_C(       256),
+      UINT32_C(2147483648) },
+    { UINT32_C(         1),
+       INT32_C(       287),
+      UINT32_C(2147483648) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -440,7 +584,55 @@ test_simde_vqshld_u64 (SIMDE_MUNIT_TEST_ARGS) {
                          UINT64_MAX },
     { UINT64_C(15004996209508217752),
        INT64_C(                  38),
-                         UINT64_MAX }
+                         UINT64_MAX },
+    {                     UINT64_MAX,
+      -INT64_C(                 64),
+      UINT64_C(                  0) },
+    {                     UINT64_MAX,
+      -INT64_C(                 63),
+      UINT64_C(                  1) },
+    { UINT64_C(                  1),
+       INT64_C(                 63),
+      UINT64_C(9223372036854775808) },
+    { UINT64_C(                  2),
+       INT64_C(                 63),
+                          UINT64_MAX },
+    { UINT64_C(                  0),
+       INT64_C(                 64),
+      UINT64_C(                  0) },
+    { UINT64_C(9223372036854775808),
+       INT64_C(                  1),
+                          UINT64_MAX },
+    { UINT64_C(9223372036854775807),
+       INT64_C(                  1),
+      UINT64_C(18446744073709551614) },
+    {                     UINT64_MAX,
+       INT64_C(                  0),
+                          UINT64_MAX },
+    { UINT64_C(                  1),
+       INT64_C(                 64),
+                          UINT64_MAX },
+    { UINT64_C(                  3),
+      -INT64_C(                  1),
+      UINT64_C(                  1) },
+    { UINT64_C(18446744073709551614),
+      -INT64_C(                128),
+      UINT64_C(                  0) },
+    { UINT64_C(                  2),
+       INT64_C(                127),
+                          UINT64_MAX },
+    { UINT64_C(9223372036854775808),
+      -INT64_C(                 63),
+      UINT64_C(                  1) },
+    { UINT64_C(                  0),
+      -INT64_C(                 64),
+      UINT64_C(                  0) },
+    { UINT64_C(9223372036854775808),
+       INT64_C(                256),
+      UINT64_C(9223372036854775808) },
+    { UINT64_C(                  1),
+       INT64_C(                319),
+      UINT64_C(9223372036854775808) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -496,7 +688,13 @@ test_simde_vqshl_s8 (SIMDE_MUNIT_TEST_ARGS) {
       {      INT8_MIN, -INT8_C(   4), -INT8_C(   6),      INT8_MAX,      INT8_MAX,  INT8_C(  32), -INT8_C(   1),      INT8_MAX } },
     { {  INT8_C(  10),  INT8_C(   0), -INT8_C(   1),  INT8_C( 117), -INT8_C(   3), -INT8_C(   1), -INT8_C(   1), -INT8_C( 121) },
       {  INT8_C(   7),  INT8_C(  11),  INT8_C(  13),  INT8_C(   4),  INT8_C(   4),  INT8_C(  14),  INT8_C(   6),  INT8_C(   4) },
-      {      INT8_MAX,  INT8_C(   0),      INT8_MIN,      INT8_MAX, -INT8_C(  48),      INT8_MIN, -INT8_C(  64),      INT8_MIN } }
+      {      INT8_MAX,  INT8_C(   0),      INT8_MIN,      INT8_MAX, -INT8_C(  48),      INT8_MIN, -INT8_C(  64),      INT8_MIN } },
+    { {      INT8_MAX,      INT8_MIN,      INT8_MIN,  INT8_C(   1), -INT8_C(   1),  INT8_C(   1),      INT8_MIN,      INT8_MAX },
+      { -INT8_C(   8), -INT8_C(   8), -INT8_C(   7),  INT8_C(   6),  INT8_C(   7),  INT8_C(   7),  INT8_C(   1),  INT8_C(   1) },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(  64),      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX } },
+    { {  INT8_C(   0), -INT8_C(   1),  INT8_C(  32), -INT8_C(  32),  INT8_C(   3), -INT8_C(   3),  INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   8), -INT8_C(   8),  INT8_C(   2),  INT8_C(   2), -INT8_C(   1), -INT8_C(   1),      INT8_MAX,      INT8_MIN },
+      {  INT8_C(   0), -INT8_C(   1),      INT8_MAX,      INT8_MIN,  INT8_C(   1), -INT8_C(   2),      INT8_MAX, -INT8_C(   1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -558,7 +756,19 @@ test_simde_vqshl_s16 (SIMDE_MUNIT_TEST_ARGS) {
       {       INT16_MAX,  INT16_C(   504),       INT16_MIN,       INT16_MAX } },
     { { -INT16_C(    97),  INT16_C(     7),  INT16_C(   935), -INT16_C(     2) },
       {  INT16_C(    13),  INT16_C(     9),  INT16_C(    30),  INT16_C(    25) },
-      {       INT16_MIN,  INT16_C(  3584),       INT16_MAX,       INT16_MIN } }
+      {       INT16_MIN,  INT16_C(  3584),       INT16_MAX,       INT16_MIN } },
+    { {       INT16_MAX,       INT16_MIN,       INT16_MIN,  INT16_C(    1) },
+      { -INT16_C(   16), -INT16_C(   16), -INT16_C(   15),  INT16_C(   14) },
+      {  INT16_C(    0), -INT16_C(    1), -INT16_C(    1),  INT16_C(16384) } },
+    { { -INT16_C(    1),  INT16_C(    1),       INT16_MIN,       INT16_MAX },
+      {  INT16_C(   15),  INT16_C(   15),  INT16_C(    1),  INT16_C(    1) },
+      {       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX } },
+    { {  INT16_C(    0), -INT16_C(    1),  INT16_C( 8192), -INT16_C( 8192) },
+      {  INT16_C(   16), -INT16_C(   16),  INT16_C(    2),  INT16_C(    2) },
+      {  INT16_C(    0), -INT16_C(    1),       INT16_MAX,       INT16_MIN } },
+    { {  INT16_C(    3), -INT16_C(    3),  INT16_C(16384),  INT16_C(    1) },
+      { -INT16_C(    1), -INT16_C(    1),  INT16_C(  256),  INT16_C(  270) },
+      {  INT16_C(    1), -INT16_C(    2),  INT16_C(16384),  INT16_C(16384) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -620,7 +830,31 @@ test_simde_vqshl_s32 (SIMDE_MUNIT_TEST_ARGS) {
       {            INT32_MIN,            INT32_MAX } },
     { {  INT32_C(          41), -INT32_C(          14) },
       {  INT32_C(          55),  INT32_C(          15) },
-      {            INT32_MAX, -INT32_C(      458752) } }
+      {            INT32_MAX, -INT32_C(      458752) } },
+    { {            INT32_MAX,            INT32_MIN },
+      { -INT32_C(        32), -INT32_C(        32) },
+      {  INT32_C(         0), -INT32_C(         1) } },
+    { {            INT32_MIN,  INT32_C(         1) },
+      { -INT32_C(        31),  INT32_C(        30) },
+      { -INT32_C(         1),  INT32_C(1073741824) } },
+    { { -INT32_C(         1),  INT32_C(         1) },
+      {  INT32_C(        31),  INT32_C(        31) },
+      {            INT32_MIN,            INT32_MAX } },
+    { {            INT32_MIN,            INT32_MAX },
+      {  INT32_C(         1),  INT32_C(         1) },
+      {            INT32_MIN,            INT32_MAX } },
+    { {  INT32_C(         0), -INT32_C(         1) },
+      {  INT32_C(        32), -INT32_C(        32) },
+      {  INT32_C(         0), -INT32_C(         1) } },
+    { {  INT32_C( 536870912), -INT32_C( 536870912) },
+      {  INT32_C(         2),  INT32_C(         2) },
+      {            INT32_MAX,            INT32_MIN } },
+    { {  INT32_C(         3), -INT32_C(         3) },
+      { -INT32_C(         1), -INT32_C(         1) },
+      {  INT32_C(         1), -INT32_C(         2) } },
+    { {  INT32_C(1073741824),  INT32_C(         1) },
+      {  INT32_C(       256),  INT32_C(       286) },
+      {  INT32_C(1073741824),  INT32_C(1073741824) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -682,7 +916,55 @@ test_simde_vqshl_s64 (SIMDE_MUNIT_TEST_ARGS) {
       {                     INT64_MIN } },
     { {  INT64_C(    1096678395763767) },
       {  INT64_C(                  60) },
-      {                     INT64_MAX } }
+      {                     INT64_MAX } },
+    { {                     INT64_MAX },
+      { -INT64_C(                 64) },
+      {  INT64_C(                  0) } },
+    { {                     INT64_MIN },
+      { -INT64_C(                 64) },
+      { -INT64_C(                  1) } },
+    { {                     INT64_MIN },
+      { -INT64_C(                 63) },
+      { -INT64_C(                  1) } },
+    { {  INT64_C(                  1) },
+      {  INT64_C(                 62) },
+      {  INT64_C(4611686018427387904) } },
+    { { -INT64_C(                  1) },
+      {  INT64_C(                 63) },
+      {                     INT64_MIN } },
+    { {  INT64_C(                  1) },
+      {  INT64_C(                 63) },
+      {                     INT64_MAX } },
+    { {                     INT64_MIN },
+      {  INT64_C(                  1) },
+      {                     INT64_MIN } },
+    { {                     INT64_MAX },
+      {  INT64_C(                  1) },
+      {                     INT64_MAX } },
+    { {  INT64_C(                  0) },
+      {  INT64_C(                 64) },
+      {  INT64_C(                  0) } },
+    { { -INT64_C(                  1) },
+      { -INT64_C(                 64) },
+      { -INT64_C(                  1) } },
+    { {  INT64_C(2305843009213693952) },
+      {  INT64_C(                  2) },
+      {                     INT64_MAX } },
+    { { -INT64_C(2305843009213693952) },
+      {  INT64_C(                  2) },
+      {                     INT64_MIN } },
+    { {  INT64_C(                  3) },
+      { -INT64_C(                  1) },
+      {  INT64_C(                  1) } },
+    { { -INT64_C(                  3) },
+      { -INT64_C(                  1) },
+      { -INT64_C(                  2) } },
+    { {  INT64_C(4611686018427387904) },
+      {  INT64_C(                256) },
+      {  INT64_C(4611686018427387904) } },
+    { {  INT64_C(                  1) },
+      {  INT64_C(                318) },
+      {  INT64_C(4611686018427387904) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -744,7 +1026,13 @@ test_simde_vqshl_u8 (SIMDE_MUNIT_TEST_ARGS) {
       {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C( 48), UINT8_C(128) } },
     { { UINT8_C(141), UINT8_C(  0), UINT8_C(  2), UINT8_C(  1), UINT8_C( 43), UINT8_C(193), UINT8_C(  1), UINT8_C( 17) },
       {  INT8_C(   0),  INT8_C(  10),  INT8_C(   9),  INT8_C(   3),  INT8_C(   3),  INT8_C(  10),  INT8_C(  14),  INT8_C(  11) },
-      { UINT8_C(141), UINT8_C(  0),    UINT8_MAX, UINT8_C(  8),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX } }
+      { UINT8_C(141), UINT8_C(  0),    UINT8_MAX, UINT8_C(  8),    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX } },
+    { {     UINT8_MAX,     UINT8_MAX, UINT8_C(   1), UINT8_C(   2), UINT8_C(   0), UINT8_C( 128), UINT8_C( 127),     UINT8_MAX },
+      { -INT8_C(   8), -INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   8),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0) },
+      { UINT8_C(   0), UINT8_C(   1), UINT8_C( 128),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C( 254),     UINT8_MAX } },
+    { { UINT8_C(   1), UINT8_C(   3), UINT8_C( 254), UINT8_C(   2), UINT8_C( 128), UINT8_C(   0), UINT8_C(   5),     UINT8_MAX },
+      {  INT8_C(   8), -INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C(   7), -INT8_C(   8),  INT8_C(   2),  INT8_C(   1) },
+      {     UINT8_MAX, UINT8_C(   1), UINT8_C(   0),     UINT8_MAX, UINT8_C(   1), UINT8_C(   0), UINT8_C(  20),     UINT8_MAX } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -806,7 +1094,19 @@ test_simde_vqshl_u16 (SIMDE_MUNIT_TEST_ARGS) {
       {      UINT16_MAX,      UINT16_MAX, UINT16_C(  536),      UINT16_MAX } },
     { { UINT16_C(    1), UINT16_C( 1767), UINT16_C( 4978), UINT16_C( 3035) },
       {  INT16_C(    23),  INT16_C(    26),  INT16_C(    25),  INT16_C(     1) },
-      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C( 6070) } }
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C( 6070) } },
+    { {      UINT16_MAX,      UINT16_MAX, UINT16_C(    1), UINT16_C(    2) },
+      { -INT16_C(   16), -INT16_C(   15),  INT16_C(   15),  INT16_C(   15) },
+      { UINT16_C(    0), UINT16_C(    1), UINT16_C(32768),      UINT16_MAX } },
+    { { UINT16_C(    0), UINT16_C(32768), UINT16_C(32767),      UINT16_MAX },
+      {  INT16_C(   16),  INT16_C(    1),  INT16_C(    1),  INT16_C(    0) },
+      { UINT16_C(    0),      UINT16_MAX, UINT16_C(65534),      UINT16_MAX } },
+    { { UINT16_C(    1), UINT16_C(    3), UINT16_C(65534), UINT16_C(    2) },
+      {  INT16_C(   16), -INT16_C(    1), -INT16_C(  128),  INT16_C(  127) },
+      {      UINT16_MAX, UINT16_C(    1), UINT16_C(    0),      UINT16_MAX } },
+    { { UINT16_C(32768), UINT16_C(    0), UINT16_C(32768), UINT16_C(    1) },
+      { -INT16_C(   15), -INT16_C(   16),  INT16_C(  256),  INT16_C(  271) },
+      { UINT16_C(    1), UINT16_C(    0), UINT16_C(32768), UINT16_C(32768) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -868,7 +1168,31 @@ test_simde_vqshl_u32 (SIMDE_MUNIT_TEST_ARGS) {
       {           UINT32_MAX,           UINT32_MAX } },
     { { UINT32_C(     11315), UINT32_C(   2830620) },
       {  INT32_C(          20),  INT32_C(          31) },
-      {           UINT32_MAX,           UINT32_MAX } }
+      {           UINT32_MAX,           UINT32_MAX } },
+    { {           UINT32_MAX,           UINT32_MAX },
+      { -INT32_C(        32), -INT32_C(        31) },
+      { UINT32_C(         0), UINT32_C(         1) } },
+    { { UINT32_C(         1), UINT32_C(         2) },
+      {  INT32_C(        31),  INT32_C(        31) },
+      { UINT32_C(2147483648),           UINT32_MAX } },
+    { { UINT32_C(         0), UINT32_C(2147483648) },
+      {  INT32_C(        32),  INT32_C(         1) },
+      { UINT32_C(         0),           UINT32_MAX } },
+    { { UINT32_C(2147483647),           UINT32_MAX },
+      {  INT32_C(         1),  INT32_C(         0) },
+      { UINT32_C(4294967294),           UINT32_MAX } },
+    { { UINT32_C(         1), UINT32_C(         3) },
+      {  INT32_C(        32), -INT32_C(         1) },
+      {           UINT32_MAX, UINT32_C(         1) } },
+    { { UINT32_C(4294967294), UINT32_C(         2) },
+      { -INT32_C(       128),  INT32_C(       127) },
+      { UINT32_C(         0),           UINT32_MAX } },
+    { { UINT32_C(2147483648), UINT32_C(         0) },
+      { -INT32_C(        31), -INT32_C(        32) },
+      { UINT32_C(         1), UINT32_C(         0) } },
+    { { UINT32_C(2147483648), UINT32_C(         1) },
+      {  INT32_C(       256),  INT32_C(       287) },
+      { UINT32_C(2147483648), UINT32_C(2147483648) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -930,7 +1254,55 @@ test_simde_vqshl_u64 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT64_C( 2846274964498153472) } },
     { { UINT64_C(              415649) },
       {  INT64_C(                  33) },
-      { UINT64_C(    3570397723230208) } }
+      { UINT64_C(    3570397723230208) } },
+    { {                     UINT64_MAX },
+      { -INT64_C(                 64) },
+      { UINT64_C(                  0) } },
+    { {                     UINT64_MAX },
+      { -INT64_C(                 63) },
+      { UINT64_C(                  1) } },
+    { { UINT64_C(                  1) },
+      {  INT64_C(                 63) },
+      { UINT64_C(9223372036854775808) } },
+    { { UINT64_C(                  2) },
+      {  INT64_C(                 63) },
+      {                     UINT64_MAX } },
+    { { UINT64_C(                  0) },
+      {  INT64_C(                 64) },
+      { UINT64_C(                  0) } },
+    { { UINT64_C(9223372036854775808) },
+      {  INT64_C(                  1) },
+      {                     UINT64_MAX } },
+    { { UINT64_C(9223372036854775807) },
+      {  INT64_C(                  1) },
+      { UINT64_C(18446744073709551614) } },
+    { {                     UINT64_MAX },
+      {  INT64_C(                  0) },
+      {                     UINT64_MAX } },
+    { { UINT64_C(                  1) },
+      {  INT64_C(                 64) },
+      {                     UINT64_MAX } },
+    { { UINT64_C(                  3) },
+      { -INT64_C(                  1) },
+      { UINT64_C(                  1) } },
+    { { UINT64_C(18446744073709551614) },
+      { -INT64_C(                128) },
+      { UINT64_C(                  0) } },
+    { { UINT64_C(                  2) },
+      {  INT64_C(                127) },
+      {                     UINT64_MAX } },
+    { { UINT64_C(9223372036854775808) },
+      { -INT64_C(                 63) },
+      { UINT64_C(                  1) } },
+    { { UINT64_C(                  0) },
+      { -INT64_C(                 64) },
+      { UINT64_C(                  0) } },
+    { { UINT64_C(9223372036854775808) },
+      {  INT64_C(                256) },
+      { UINT64_C(9223372036854775808) } },
+    { { UINT64_C(                  1) },
+      {  INT64_C(                319) },
+      { UINT64_C(9223372036854775808) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1016,7 +1388,13 @@ test_simde_vqshlq_s8 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(  12),  INT8_C(   3),  INT8_C(  15),  INT8_C(  12),  INT8_C(  13),  INT8_C(   8),  INT8_C(   1),  INT8_C(   2),
          INT8_C(  12),  INT8_C(  12),  INT8_C(   4),  INT8_C(   2),  INT8_C(   5),  INT8_C(  15),  INT8_C(   8),  INT8_C(   3) },
       {      INT8_MIN,  INT8_C(   0),      INT8_MAX,      INT8_MAX,      INT8_MAX,  INT8_C(   0), -INT8_C(   8), -INT8_C( 100),
-             INT8_MIN,  INT8_C(   0),      INT8_MIN, -INT8_C(  56), -INT8_C(  32),      INT8_MIN,      INT8_MIN,  INT8_C(  16) } }
+             INT8_MIN,  INT8_C(   0),      INT8_MIN, -INT8_C(  56), -INT8_C(  32),      INT8_MIN,      INT8_MIN,  INT8_C(  16) } },
+    { {      INT8_MAX,      INT8_MIN,      INT8_MIN,  INT8_C(   1), -INT8_C(   1),  INT8_C(   1),      INT8_MIN,      INT8_MAX,
+         INT8_C(   0), -INT8_C(   1),  INT8_C(  32), -INT8_C(  32),  INT8_C(   3), -INT8_C(   3),  INT8_C(   1), -INT8_C(   1) },
+      { -INT8_C(   8), -INT8_C(   8), -INT8_C(   7),  INT8_C(   6),  INT8_C(   7),  INT8_C(   7),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   8), -INT8_C(   8),  INT8_C(   2),  INT8_C(   2), -INT8_C(   1), -INT8_C(   1),      INT8_MAX,      INT8_MIN },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(  64),      INT8_MIN,      INT8_MAX,      INT8_MIN,      INT8_MAX,
+         INT8_C(   0), -INT8_C(   1),      INT8_MAX,      INT8_MIN,  INT8_C(   1), -INT8_C(   2),      INT8_MAX, -INT8_C(   1) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1078,7 +1456,13 @@ test_simde_vqshlq_s16 (SIMDE_MUNIT_TEST_ARGS) {
       {       INT16_MAX,       INT16_MIN,       INT16_MIN, -INT16_C( 10960),  INT16_C(     0),       INT16_MAX,       INT16_MIN,  INT16_C(     0) } },
     { {  INT16_C( 23495),  INT16_C(     0),  INT16_C(    25),  INT16_C( 27714),  INT16_C(     1),  INT16_C(   877),  INT16_C(  3402), -INT16_C( 16431) },
       {  INT16_C(    24),  INT16_C(    14),  INT16_C(     4),  INT16_C(     3),  INT16_C(    25),  INT16_C(    22),  INT16_C(    17),  INT16_C(    20) },
-      {       INT16_MAX,  INT16_C(     0),  INT16_C(   400),       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MIN } }
+      {       INT16_MAX,  INT16_C(     0),  INT16_C(   400),       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MAX,       INT16_MIN } },
+    { {       INT16_MAX,       INT16_MIN,       INT16_MIN,  INT16_C(    1), -INT16_C(    1),  INT16_C(    1),       INT16_MIN,       INT16_MAX },
+      { -INT16_C(   16), -INT16_C(   16), -INT16_C(   15),  INT16_C(   14),  INT16_C(   15),  INT16_C(   15),  INT16_C(    1),  INT16_C(    1) },
+      {  INT16_C(    0), -INT16_C(    1), -INT16_C(    1),  INT16_C(16384),       INT16_MIN,       INT16_MAX,       INT16_MIN,       INT16_MAX } },
+    { {  INT16_C(    0), -INT16_C(    1),  INT16_C( 8192), -INT16_C( 8192),  INT16_C(    3), -INT16_C(    3),  INT16_C(16384),  INT16_C(    1) },
+      {  INT16_C(   16), -INT16_C(   16),  INT16_C(    2),  INT16_C(    2), -INT16_C(    1), -INT16_C(    1),  INT16_C(  256),  INT16_C(  270) },
+      {  INT16_C(    0), -INT16_C(    1),       INT16_MAX,       INT16_MIN,  INT16_C(    1), -INT16_C(    2),  INT16_C(16384),  INT16_C(16384) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1140,7 +1524,19 @@ test_simde_vqshlq_s32 (SIMDE_MUNIT_TEST_ARGS) {
       { -INT32_C(    97173336), -INT32_C(      824616),            INT32_MAX,            INT32_MAX } },
     { { -INT32_C(       49114), -INT32_C(   310905264),  INT32_C(           0), -INT32_C(          19) },
       {  INT32_C(          30),  INT32_C(          26),  INT32_C(          63),  INT32_C(          25) },
-      {            INT32_MIN,            INT32_MIN,  INT32_C(           0), -INT32_C(   637534208) } }
+      {            INT32_MIN,            INT32_MIN,  INT32_C(           0), -INT32_C(   637534208) } },
+    { {            INT32_MAX,            INT32_MIN,            INT32_MIN,  INT32_C(         1) },
+      { -INT32_C(        32), -INT32_C(        32), -INT32_C(        31),  INT32_C(        30) },
+      {  INT32_C(         0), -INT32_C(         1), -INT32_C(         1),  INT32_C(1073741824) } },
+    { { -INT32_C(         1),  INT32_C(         1),            INT32_MIN,            INT32_MAX },
+      {  INT32_C(        31),  INT32_C(        31),  INT32_C(         1),  INT32_C(         1) },
+      {            INT32_MIN,            INT32_MAX,            INT32_MIN,            INT32_MAX } },
+    { {  INT32_C(         0), -INT32_C(         1),  INT32_C( 536870912), -INT32_C( 536870912) },
+      {  INT32_C(        32), -INT32_C(        32),  INT32_C(         2),  INT32_C(         2) },
+      {  INT32_C(         0), -INT32_C(         1),            INT32_MAX,            INT32_MIN } },
+    { {  INT32_C(         3), -INT32_C(         3),  INT32_C(1073741824),  INT32_C(         1) },
+      { -INT32_C(         1), -INT32_C(         1),  INT32_C(       256),  INT32_C(       286) },
+      {  INT32_C(         1), -INT32_C(         2),  INT32_C(1073741824),  INT32_C(1073741824) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1202,7 +1598,31 @@ test_simde_vqshlq_s64 (SIMDE_MUNIT_TEST_ARGS) {
       {                     INT64_MAX,  INT64_C( 2401500909178748928) } },
     { { -INT64_C(        909897764488),  INT64_C(                6277) },
       {  INT64_C(                  58),  INT64_C(                  53) },
-      {                     INT64_MIN,                     INT64_MAX } }
+      {                     INT64_MIN,                     INT64_MAX } },
+    { {                     INT64_MAX,                     INT64_MIN },
+      { -INT64_C(                 64), -INT64_C(                 64) },
+      {  INT64_C(                  0), -INT64_C(                  1) } },
+    { {                     INT64_MIN,  INT64_C(                  1) },
+      { -INT64_C(                 63),  INT64_C(                 62) },
+      { -INT64_C(                  1),  INT64_C(4611686018427387904) } },
+    { { -INT64_C(                  1),  INT64_C(                  1) },
+      {  INT64_C(                 63),  INT64_C(                 63) },
+      {                     INT64_MIN,                     INT64_MAX } },
+    { {                     INT64_MIN,                     INT64_MAX },
+      {  INT64_C(                  1),  INT64_C(                  1) },
+      {                     INT64_MIN,                     INT64_MAX } },
+    { {  INT64_C(                  0), -INT64_C(                  1) },
+      {  INT64_C(                 64), -INT64_C(                 64) },
+      {  INT64_C(                  0), -INT64_C(                  1) } },
+    { {  INT64_C(2305843009213693952), -INT64_C(2305843009213693952) },
+      {  INT64_C(                  2),  INT64_C(                  2) },
+      {                     INT64_MAX,                     INT64_MIN } },
+    { {  INT64_C(                  3), -INT64_C(                  3) },
+      { -INT64_C(                  1), -INT64_C(                  1) },
+      {  INT64_C(                  1), -INT64_C(                  2) } },
+    { {  INT64_C(4611686018427387904),  INT64_C(                  1) },
+      {  INT64_C(                256),  INT64_C(                318) },
+      {  INT64_C(4611686018427387904),  INT64_C(4611686018427387904) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1288,7 +1708,13 @@ test_simde_vqshlq_u8 (SIMDE_MUNIT_TEST_ARGS) {
       {  INT8_C(   5),  INT8_C(  15),  INT8_C(  11),  INT8_C(  10),  INT8_C(   8),  INT8_C(  12),  INT8_C(   0),  INT8_C(  11),
          INT8_C(   0),  INT8_C(   4),  INT8_C(   3),  INT8_C(  12),  INT8_C(  13),  INT8_C(  10),  INT8_C(  12),  INT8_C(   5) },
       {    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX,    UINT8_MAX, UINT8_C(  3),    UINT8_MAX,
-        UINT8_C(106),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) } }
+        UINT8_C(106),    UINT8_MAX,    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0),    UINT8_MAX, UINT8_C(  0) } },
+    { {     UINT8_MAX,     UINT8_MAX, UINT8_C(   1), UINT8_C(   2), UINT8_C(   0), UINT8_C( 128), UINT8_C( 127),     UINT8_MAX,
+        UINT8_C(   1), UINT8_C(   3), UINT8_C( 254), UINT8_C(   2), UINT8_C( 128), UINT8_C(   0), UINT8_C(   5),     UINT8_MAX },
+      { -INT8_C(   8), -INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   8),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   8), -INT8_C(   1),      INT8_MIN,      INT8_MAX, -INT8_C(   7), -INT8_C(   8),  INT8_C(   2),  INT8_C(   1) },
+      { UINT8_C(   0), UINT8_C(   1), UINT8_C( 128),     UINT8_MAX, UINT8_C(   0),     UINT8_MAX, UINT8_C( 254),     UINT8_MAX,
+            UINT8_MAX, UINT8_C(   1), UINT8_C(   0),     UINT8_MAX, UINT8_C(   1), UINT8_C(   0), UINT8_C(  20),     UINT8_MAX } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1350,7 +1776,13 @@ test_simde_vqshlq_u16 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT16_C( 3972), UINT16_C(   96), UINT16_C(  480),      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX } },
     { { UINT16_C( 2321), UINT16_C(  466), UINT16_C(   29), UINT16_C( 1146), UINT16_C(  930), UINT16_C(    1), UINT16_C(    2), UINT16_C(   39) },
       {  INT16_C(    25),  INT16_C(    15),  INT16_C(    18),  INT16_C(     9),  INT16_C(    17),  INT16_C(    23),  INT16_C(     5),  INT16_C(    27) },
-      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(   64),      UINT16_MAX } }
+      {      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX,      UINT16_MAX, UINT16_C(   64),      UINT16_MAX } },
+    { {      UINT16_MAX,      UINT16_MAX, UINT16_C(    1), UINT16_C(    2), UINT16_C(    0), UINT16_C(32768), UINT16_C(32767),      UINT16_MAX },
+      { -INT16_C(   16), -INT16_C(   15),  INT16_C(   15),  INT16_C(   15),  INT16_C(   16),  INT16_C(    1),  INT16_C(    1),  INT16_C(    0) },
+      { UINT16_C(    0), UINT16_C(    1), UINT16_C(32768),      UINT16_MAX, UINT16_C(    0),      UINT16_MAX, UINT16_C(65534),      UINT16_MAX } },
+    { { UINT16_C(    1), UINT16_C(    3), UINT16_C(65534), UINT16_C(    2), UINT16_C(32768), UINT16_C(    0), UINT16_C(32768), UINT16_C(    1) },
+      {  INT16_C(   16), -INT16_C(    1), -INT16_C(  128),  INT16_C(  127), -INT16_C(   15), -INT16_C(   16),  INT16_C(  256),  INT16_C(  271) },
+      {      UINT16_MAX, UINT16_C(    1), UINT16_C(    0),      UINT16_MAX, UINT16_C(    1), UINT16_C(    0), UINT16_C(32768), UINT16_C(32768) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1412,7 +1844,19 @@ test_simde_vqshlq_u32 (SIMDE_MUNIT_TEST_ARGS) {
       {           UINT32_MAX,           UINT32_MAX, UINT32_C(         0),           UINT32_MAX } },
     { { UINT32_C( 198186158), UINT32_C(        23), UINT32_C(         2), UINT32_C(   5784654) },
       {  INT32_C(          15),  INT32_C(           2),  INT32_C(          13),  INT32_C(           0) },
-      {           UINT32_MAX, UINT32_C(        92), UINT32_C(     16384), UINT32_C(   5784654) } }
+      {           UINT32_MAX, UINT32_C(        92), UINT32_C(     16384), UINT32_C(   5784654) } },
+    { {           UINT32_MAX,           UINT32_MAX, UINT32_C(         1), UINT32_C(         2) },
+      { -INT32_C(        32), -INT32_C(        31),  INT32_C(        31),  INT32_C(        31) },
+      { UINT32_C(         0), UINT32_C(         1), UINT32_C(2147483648),           UINT32_MAX } },
+    { { UINT32_C(         0), UINT32_C(2147483648), UINT32_C(2147483647),           UINT32_MAX },
+      {  INT32_C(        32),  INT32_C(         1),  INT32_C(         1),  INT32_C(         0) },
+      { UINT32_C(         0),           UINT32_MAX, UINT32_C(4294967294),           UINT32_MAX } },
+    { { UINT32_C(         1), UINT32_C(         3), UINT32_C(4294967294), UINT32_C(         2) },
+      {  INT32_C(        32), -INT32_C(         1), -INT32_C(       128),  INT32_C(       127) },
+      {           UINT32_MAX, UINT32_C(         1), UINT32_C(         0),           UINT32_MAX } },
+    { { UINT32_C(2147483648), UINT32_C(         0), UINT32_C(2147483648), UINT32_C(         1) },
+      { -INT32_C(        31), -INT32_C(        32),  INT32_C(       256),  INT32_C(       287) },
+      { UINT32_C(         1), UINT32_C(         0), UINT32_C(2147483648), UINT32_C(2147483648) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -1474,7 +1918,31 @@ test_simde_vqshlq_u64 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT64_C(      71264244858880),                    UINT64_MAX } },
     { { UINT64_C(          4061564034), UINT64_C(   70125565431909990) },
       {  INT64_C(                  56),  INT64_C(                  24) },
-      {                    UINT64_MAX,                    UINT64_MAX } }
+      {                    UINT64_MAX,                    UINT64_MAX } },
+    { {                     UINT64_MAX,                     UINT64_MAX },
+      { -INT64_C(                 64), -INT64_C(                 63) },
+      { UINT64_C(                  0), UINT64_C(                  1) } },
+    { { UINT64_C(                  1), UINT64_C(                  2) },
+      {  INT64_C(                 63),  INT64_C(                 63) },
+      { UINT64_C(9223372036854775808),                     UINT64_MAX } },
+    { { UINT64_C(                  0), UINT64_C(9223372036854775808) },
+      {  INT64_C(                 64),  INT64_C(                  1) },
+      { UINT64_C(                  0),                     UINT64_MAX } },
+    { { UINT64_C(9223372036854775807),                     UINT64_MAX },
+      {  INT64_C(                  1),  INT64_C(                  0) },
+      { UINT64_C(18446744073709551614),                     UINT64_MAX } },
+    { { UINT64_C(                  1), UINT64_C(                  3) },
+      {  INT64_C(                 64), -INT64_C(                  1) },
+      {                     UINT64_MAX, UINT64_C(                  1) } },
+    { { UINT64_C(18446744073709551614), UINT64_C(                  2) },
+      { -INT64_C(                128),  INT64_C(                127) },
+      { UINT64_C(                  0),                     UINT64_MAX } },
+    { { UINT64_C(9223372036854775808), UINT64_C(                  0) },
+      { -INT64_C(                 63), -INT64_C(                 64) },
+      { UINT64_C(                  1), UINT64_C(                  0) } },
+    { { UINT64_C(9223372036854775808), UINT64_C(                  1) },
+      {  INT64_C(                256),  INT64_C(                319) },
+      { UINT64_C(9223372036854775808), UINT64_C(9223372036854775808) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
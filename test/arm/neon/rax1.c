@@ -0,0 +1,54 @@
+#define SIMDE_TEST_ARM_NEON_INSN rax1
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/rax1.h"
+
+static int
+test_simde_vrax1q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(14919982647804171898), UINT64_C(11958753786714614569) },
+      { UINT64_C( 3434766623363697887), UINT64_C( 3563196908868290634) },
+      { UINT64_C(10401926715326599108), UINT64_C(14343980614204652477) } },
+    { { UINT64_C( 9505250484630189520), UINT64_C( 8807473612404499411) },
+      { UINT64_C( 4575661095193297078), UINT64_C( 7075698668384473835) },
+      { UINT64_C(18224213914061206716), UINT64_C(13716190337032685061) } },
+    { { UINT64_C(13904356053146747481), UINT64_C( 6080513603092062290) },
+      { UINT64_C(12779324888964635408), UINT64_C(12318479638470287689) },
+      { UINT64_C(11692649374097765496), UINT64_C(  111003438018814657) } },
+    { { UINT64_C( 5659578098423963713), UINT64_C(14201060843258138703) },
+      { UINT64_C(17351664602714703198), UINT64_C(11337838348683664230) },
+      { UINT64_C(12614620217258748668), UINT64_C(18420956437366892162) } },
+    { { UINT64_C(17660184878120488915), UINT64_C( 2825774924439363847) },
+      { UINT64_C(16838130643049816553), UINT64_C(15229696722977560528) },
+      { UINT64_C( 2760576430330711040), UINT64_C( 9332210112391941798) } },
+    { { UINT64_C( 2069886965912525964), UINT64_C( 2764288615262621550) },
+      { UINT64_C( 8364349668468860402), UINT64_C( 7663230795194316259) },
+      { UINT64_C(17623131045615441768), UINT64_C(17504997265824736424) } },
+    { { UINT64_C(13342162657619489614), UINT64_C(13757664501262819120) },
+      { UINT64_C( 1347157026480600323), UINT64_C(  585405126804088970) },
+      { UINT64_C(11262590504627099976), UINT64_C(12597279825002417700) } },
+    { { UINT64_C( 7754309177823622235), UINT64_C(16442202963128867207) },
+      { UINT64_C( 6963578588551571222), UINT64_C( 2188395738428830361) },
+      { UINT64_C(12311685473041496695), UINT64_C(15605831231129074869) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+    simde_uint64x2_t r = simde_vrax1q_u64(a, b);
+
+    simde_test_arm_neon_assert_equal_u64x2(r, simde_vld1q_u64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrax1q_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -32,6 +32,10 @@ test_simde_vrbit_s8 (SIMDE_MUNIT_TEST_ARGS) {
       { -INT8_C(  95),  INT8_C(  64),  INT8_C(  80), -INT8_C(  29),  INT8_C(  60), -INT8_C(  99),  INT8_C(  89), -INT8_C(  72) } },
     { {  INT8_C( 118),  INT8_C(  30),  INT8_C(  21), -INT8_C(  45), -INT8_C(  37),  INT8_C(  10), -INT8_C(  17), -INT8_C(  37) },
       {  INT8_C( 110),  INT8_C( 120), -INT8_C(  88), -INT8_C(  53), -INT8_C(  37),  INT8_C(  80), -INT8_C(   9), -INT8_C(  37) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C(   1), -INT8_C(   2),      INT8_MIN,  INT8_C(  64),  INT8_C(  32),  INT8_C(  16) } },
+    { {  INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   8),  INT8_C(   4),  INT8_C(   2), -INT8_C(  64), -INT8_C(  32), -INT8_C(  16), -INT8_C(   8), -INT8_C(   4) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -78,6 +82,10 @@ test_simde_vrbit_u8 (SIMDE_MUNIT_TEST_ARGS) {
       { UINT8_C( 92), UINT8_C( 94), UINT8_C( 86), UINT8_C(100), UINT8_C(  9), UINT8_C(196), UINT8_C( 90), UINT8_C(159) } },
     { { UINT8_C(  5), UINT8_C(151), UINT8_C( 13), UINT8_C(  9), UINT8_C(237), UINT8_C( 56), UINT8_C(134), UINT8_C(  8) },
       { UINT8_C(160), UINT8_C(233), UINT8_C(176), UINT8_C(144), UINT8_C(183), UINT8_C( 28), UINT8_C( 97), UINT8_C( 16) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(254), UINT8_C(128), UINT8_C( 64), UINT8_C( 32), UINT8_C( 16) } },
+    { { UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      { UINT8_C(  8), UINT8_C(  4), UINT8_C(  2), UINT8_C(192), UINT8_C(224), UINT8_C(240), UINT8_C(248), UINT8_C(252) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -140,6 +148,10 @@ test_simde_vrbitq_s8 (SIMDE_MUNIT_TEST_ARGS) {
         -INT8_C(  15),  INT8_C(  23),  INT8_C(  25), -INT8_C(  37),  INT8_C(  52), -INT8_C(   7), -INT8_C(  59), -INT8_C( 102) },
       {  INT8_C(  18), -INT8_C(  46), -INT8_C(  23),  INT8_C(  44),  INT8_C(  81), -INT8_C(  15),  INT8_C(  37), -INT8_C( 124),
         -INT8_C( 113), -INT8_C(  24), -INT8_C( 104), -INT8_C(  37),  INT8_C(  44), -INT8_C(  97), -INT8_C(  93),  INT8_C(  89) } },
+    { {  INT8_C(   0), -INT8_C(   1),      INT8_MIN,      INT8_MAX,  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),  INT8_C(   8),
+         INT8_C(  16),  INT8_C(  32),  INT8_C(  64),  INT8_C(   3),  INT8_C(   7),  INT8_C(  15),  INT8_C(  31),  INT8_C(  63) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C(   1), -INT8_C(   2),      INT8_MIN,  INT8_C(  64),  INT8_C(  32),  INT8_C(  16),
+         INT8_C(   8),  INT8_C(   4),  INT8_C(   2), -INT8_C(  64), -INT8_C(  32), -INT8_C(  16), -INT8_C(   8), -INT8_C(   4) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -202,6 +214,10 @@ test_simde_vrbitq_u8 (SIMDE_MUNIT_TEST_ARGS) {
         UINT8_C(165), UINT8_C(181), UINT8_C(231), UINT8_C(219), UINT8_C(205), UINT8_C( 21), UINT8_C( 86), UINT8_C(191) },
       { UINT8_C(222), UINT8_C( 31), UINT8_C(131), UINT8_C(101), UINT8_C(146), UINT8_C(117), UINT8_C( 56), UINT8_C(151),
         UINT8_C(165), UINT8_C(173), UINT8_C(231), UINT8_C(219), UINT8_C(179), UINT8_C(168), UINT8_C(106), UINT8_C(253) } },
+    { { UINT8_C(  0),    UINT8_MAX, UINT8_C(128), UINT8_C(127), UINT8_C(  1), UINT8_C(  2), UINT8_C(  4), UINT8_C(  8),
+        UINT8_C( 16), UINT8_C( 32), UINT8_C( 64), UINT8_C(  3), UINT8_C(  7), UINT8_C( 15), UINT8_C( 31), UINT8_C( 63) },
+      { UINT8_C(  0),    UINT8_MAX, UINT8_C(  1), UINT8_C(254), UINT8_C(128), UINT8_C( 64), UINT8_C( 32), UINT8_C( 16),
+        UINT8_C(  8), UINT8_C(  4), UINT8_C(  2), UINT8_C(192), UINT8_C(224), UINT8_C(240), UINT8_C(248), UINT8_C(252) } },
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -0,0 +1,85 @@
+#define SIMDE_TEST_ARM_NEON_INSN recpx
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/recpx.h"
+
+static int
+test_simde_vrecpxs_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a;
+    simde_float32 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(     0.00),
+      SIMDE_FLOAT32_C(1.70141183e+38) },
+    { SIMDE_FLOAT32_C(    -0.00),
+      SIMDE_FLOAT32_C(-1.70141183e+38) },
+    { SIMDE_FLOAT32_C(     1.00),
+      SIMDE_FLOAT32_C(2.0) },
+    { SIMDE_FLOAT32_C(    -3.00),
+      SIMDE_FLOAT32_C(-1.0) },
+    {  SIMDE_MATH_INFINITYF,
+      SIMDE_FLOAT32_C(0.0) },
+    { SIMDE_FLOAT32_C(   214.68),
+      SIMDE_FLOAT32_C(0.015625) },
+    { SIMDE_FLOAT32_C(  -396.15),
+      SIMDE_FLOAT32_C(-0.0078125) },
+    { SIMDE_FLOAT32_C(   107.52),
+      SIMDE_FLOAT32_C(0.03125) },
+    { SIMDE_FLOAT32_C(   515.89),
+      SIMDE_FLOAT32_C(0.00390625) },
+    { SIMDE_FLOAT32_C(   256.09),
+      SIMDE_FLOAT32_C(0.0078125) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r = simde_vrecpxs_f32(test_vec[i].a);
+
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpxd_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a;
+    simde_float64 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(     0.00),
+      SIMDE_FLOAT64_C(8.9884656743115795e+307) },
+    { SIMDE_FLOAT64_C(    -0.00),
+      SIMDE_FLOAT64_C(-8.9884656743115795e+307) },
+    { SIMDE_FLOAT64_C(     1.00),
+      SIMDE_FLOAT64_C(2.0) },
+    { SIMDE_FLOAT64_C(    -3.00),
+      SIMDE_FLOAT64_C(-1.0) },
+    {  SIMDE_MATH_INFINITY,
+      SIMDE_FLOAT64_C(0.0) },
+    { SIMDE_FLOAT64_C(    80.80),
+      SIMDE_FLOAT64_C(0.03125) },
+    { SIMDE_FLOAT64_C(  -181.30),
+      SIMDE_FLOAT64_C(-0.015625) },
+    { SIMDE_FLOAT64_C(   500.47),
+      SIMDE_FLOAT64_C(0.0078125) },
+    { SIMDE_FLOAT64_C(  -515.07),
+      SIMDE_FLOAT64_C(-0.00390625) },
+    { SIMDE_FLOAT64_C(    54.35),
+      SIMDE_FLOAT64_C(0.0625) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64 r = simde_vrecpxd_f64(test_vec[i].a);
+
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrecpxs_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrecpxd_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
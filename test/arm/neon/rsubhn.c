@@ -0,0 +1,243 @@
+#define SIMDE_TEST_ARM_NEON_INSN rsubhn
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/rsubhn.h"
+
+static int
+test_simde_vrsubhn_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int8_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 8051),  INT16_C(25932),      INT16_MIN, -INT16_C(18032), -INT16_C(15327), -INT16_C(  357), -INT16_C(16242),  INT16_C(26221) },
+      {      INT16_MIN, -INT16_C(13352),  INT16_C( 5398), -INT16_C(27639),      INT16_MAX,      INT16_MIN,  INT16_C( 8145), -INT16_C( 8819) },
+      {  INT8_C( 97), -INT8_C(103),  INT8_C(107),  INT8_C( 38),  INT8_C( 68),     INT8_MAX, -INT8_C( 95), -INT8_C(119) } },
+    { {  INT16_C(12909),  INT16_C( 4187),  INT16_C(25563),  INT16_C( 8997), -INT16_C( 6120), -INT16_C(22082),  INT16_C(24415),  INT16_C(24578) },
+      {  INT16_C( 8814), -INT16_C( 6162), -INT16_C( 7982), -INT16_C( 9596),      INT16_MAX,  INT16_C(17944),      INT16_MAX,      INT16_MIN },
+      {  INT8_C( 16),  INT8_C( 40), -INT8_C(125),  INT8_C( 73),  INT8_C(104),  INT8_C(100), -INT8_C( 33), -INT8_C( 32) } },
+    { { -INT16_C(20107), -INT16_C(23021), -INT16_C(30538), -INT16_C(29905), -INT16_C(24858), -INT16_C(26304),      INT16_MIN,  INT16_C(20978) },
+      { -INT16_C(10520), -INT16_C(19178),  INT16_C(29417),  INT16_C(29374),      INT16_MIN,  INT16_C( 7577),      INT16_MIN,  INT16_C(  973) },
+      { -INT8_C( 37), -INT8_C( 15),  INT8_C( 22),  INT8_C( 24),  INT8_C( 31),  INT8_C(124),  INT8_C(  0),  INT8_C( 78) } },
+    { { -INT16_C(14015), -INT16_C(23842),  INT16_C(25579),  INT16_C(21030), -INT16_C(24199),  INT16_C( 7981),      INT16_MAX,  INT16_C( 1013) },
+      { -INT16_C(16178),  INT16_C(25560),      INT16_MAX,  INT16_C( 3055), -INT16_C(27882),      INT16_MIN,      INT16_MIN, -INT16_C( 5120) },
+      {  INT8_C(  8),  INT8_C( 63), -INT8_C( 28),  INT8_C( 70),  INT8_C( 14), -INT8_C( 97),  INT8_C(  0),  INT8_C( 24) } },
+    { {      INT16_MAX, -INT16_C( 7520),      INT16_MAX, -INT16_C(27613),      INT16_MIN, -INT16_C(15590), -INT16_C(32572), -INT16_C(29455) },
+      {      INT16_MIN,      INT16_MIN, -INT16_C(16447), -INT16_C( 4236), -INT16_C(32621),  INT16_C(21669), -INT16_C(17006), -INT16_C(20654) },
+      {  INT8_C(  0),  INT8_C( 99), -INT8_C( 64), -INT8_C( 91), -INT8_C(  1),  INT8_C(110), -INT8_C( 61), -INT8_C( 34) } },
+    { {      INT16_MIN, -INT16_C(11185),  INT16_C(29714), -INT16_C(21584),  INT16_C(13114),  INT16_C(17716), -INT16_C(26229), -INT16_C(14602) },
+      {  INT16_C(30087),      INT16_MIN, -INT16_C(17015),      INT16_MIN,  INT16_C(27824), -INT16_C( 7578), -INT16_C(28192), -INT16_C(17774) },
+      {  INT8_C( 10),  INT8_C( 84), -INT8_C( 73),  INT8_C( 44), -INT8_C( 57),  INT8_C( 99),  INT8_C(  8),  INT8_C( 12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+    simde_int8x8_t r = simde_vrsubhn_s16(a, b);
+
+    simde_test_arm_neon_assert_equal_i8x8(r, simde_vld1_s8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsubhn_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int16_t r[4];
+  } test_vec[] = {
+    { {  INT32_C( 904525149),  INT32_C( 151390694),  INT32_C( 263960196),  INT32_C(2036394953) },
+      { -INT32_C( 902879150),           INT32_MIN,           INT32_MAX,  INT32_C(2111614498) },
+      {  INT16_C(27579), -INT16_C(30458), -INT16_C(28740), -INT16_C( 1148) } },
+    { { -INT32_C(1670949518),  INT32_C(1596226110),           INT32_MIN,           INT32_MIN },
+      {  INT32_C(1804003458),           INT32_MAX,  INT32_C(1416264722), -INT32_C(1712730163) },
+      {  INT16_C(12512), -INT16_C( 8412),  INT16_C(11158), -INT16_C( 6634) } },
+    { { -INT32_C(1523587306), -INT32_C(1935748465),  INT32_C(1486986857),  INT32_C( 642753829) },
+      {  INT32_C( 148245452), -INT32_C(1086913445), -INT32_C(1374666610),           INT32_MIN },
+      { -INT16_C(25510), -INT16_C(12952), -INT16_C(21871), -INT16_C(22960) } },
+    { {  INT32_C(1691871617), -INT32_C(1715932046),           INT32_MIN,           INT32_MIN },
+      { -INT32_C(  44024237), -INT32_C( 530778974),  INT32_C(1071903685),  INT32_C(1056355615) },
+      {  INT16_C(26488), -INT16_C(18084),  INT16_C(16412),  INT16_C(16649) } },
+    { {           INT32_MIN,  INT32_C(2134948464),           INT32_MAX,           INT32_MAX },
+      { -INT32_C(2091957947), -INT32_C(1269987969),  INT32_C(1754173569),  INT32_C( 623951098) },
+      { -INT16_C(  847), -INT16_C(13581),  INT16_C( 6001),  INT16_C(23247) } },
+    { { -INT32_C( 718424056), -INT32_C(  94473584),  INT32_C( 852379090),           INT32_MIN },
+      {  INT32_C(1103338855),  INT32_C( 563102318), -INT32_C(2107712274), -INT32_C( 597962744) },
+      { -INT16_C(27798), -INT16_C(10034), -INT16_C(20369), -INT16_C(23644) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+    simde_int16x4_t r = simde_vrsubhn_s32(a, b);
+
+    simde_test_arm_neon_assert_equal_i16x4(r, simde_vld1_s16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsubhn_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int32_t r[2];
+  } test_vec[] = {
+    { { -INT64_C(8158975388363992632),  INT64_C(5517314831937677927) },
+      { -INT64_C(8019258659313204225),  INT64_C(7483472641393956216) },
+      { -INT32_C(  32530336), -INT32_C( 457781788) } },
+    { { -INT64_C(2597838107760281084), -INT64_C(5906514651669383359) },
+      {  INT64_C( 696099704994736305),  INT64_C(1165546355439515132) },
+      { -INT32_C( 766929661), -INT32_C(1646592516) } },
+    { { -INT64_C(2287829191526687221),                    INT64_MAX },
+      { -INT64_C(3158332060755417376),  INT64_C(4124516670786917395) },
+      {  INT32_C( 202679743),  INT32_C(1187169777) } },
+    { {                    INT64_MIN, -INT64_C(8135384486656676737) },
+      { -INT64_C(4094651135675462607), -INT64_C( 985936329354353669) },
+      { -INT32_C(1194123389), -INT32_C(1664610616) } },
+    { { -INT64_C(3385848891078807729),  INT64_C(1414510751157344251) },
+      { -INT64_C(3903572652002260963), -INT64_C(6943689518821313188) },
+      {  INT32_C( 120541956),  INT32_C(1946045149) } },
+    { { -INT64_C(8897507929432446828),                    INT64_MIN },
+      { -INT64_C(8382897927749963758),  INT64_C(8516007130358101829) },
+      { -INT32_C( 119816978),  INT32_C( 164696226) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+    simde_int32x2_t r = simde_vrsubhn_s64(a, b);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsubhn_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    uint8_t r[8];
+  } test_vec[] = {
+    { { UINT16_C(57193), UINT16_C(59917), UINT16_C( 4430),     UINT16_MAX, UINT16_C(24435), UINT16_C(  616),     UINT16_MAX, UINT16_C(14332) },
+      { UINT16_C(    0), UINT16_C(15132), UINT16_C(    0), UINT16_C(32540), UINT16_C(12390), UINT16_C(21558), UINT16_C( 9538), UINT16_C(14314) },
+      { UINT8_C(223), UINT8_C(175), UINT8_C( 17), UINT8_C(129), UINT8_C( 47), UINT8_C(174), UINT8_C(219), UINT8_C(  0) } },
+    { { UINT16_C(36723),     UINT16_MAX, UINT16_C(50546), UINT16_C( 7537), UINT16_C(32489),     UINT16_MAX, UINT16_C(39287), UINT16_C(13746) },
+      { UINT16_C(    0), UINT16_C(55339), UINT16_C(11093),     UINT16_MAX, UINT16_C(22717), UINT16_C(14941), UINT16_C(56506),     UINT16_MAX },
+      { UINT8_C(143), UINT8_C( 40), UINT8_C(154), UINT8_C( 29), UINT8_C( 38), UINT8_C(198), UINT8_C(189), UINT8_C( 54) } },
+    { {     UINT16_MAX, UINT16_C(51700), UINT16_C(41582), UINT16_C(62468), UINT16_C(40332), UINT16_C(60229), UINT16_C(24889), UINT16_C(43606) },
+      { UINT16_C(    0),     UINT16_MAX, UINT16_C(41028),     UINT16_MAX, UINT16_C( 2638),     UINT16_MAX, UINT16_C(38607),     UINT16_MAX },
+      { UINT8_C(  0), UINT8_C(202), UINT8_C(  2), UINT8_C(244), UINT8_C(147), UINT8_C(235), UINT8_C(202), UINT8_C(170) } },
+    { { UINT16_C( 2762), UINT16_C(57704), UINT16_C( 7695),     UINT16_MAX, UINT16_C( 9247), UINT16_C(10202), UINT16_C(33727), UINT16_C(10252) },
+      { UINT16_C(54881), UINT16_C(25282), UINT16_C(16802), UINT16_C(26145), UINT16_C(27881), UINT16_C(49861), UINT16_C(63705), UINT16_C(33285) },
+      { UINT8_C( 52), UINT8_C(127), UINT8_C(220), UINT8_C(154), UINT8_C(183), UINT8_C(101), UINT8_C(139), UINT8_C(166) } },
+    { {     UINT16_MAX,     UINT16_MAX, UINT16_C( 8614), UINT16_C( 2798),     UINT16_MAX, UINT16_C(23035),     UINT16_MAX, UINT16_C(62478) },
+      { UINT16_C(40111), UINT16_C(19449), UINT16_C(    0), UINT16_C(40474), UINT16_C(61838), UINT16_C(25732), UINT16_C(29345), UINT16_C(60773) },
+      { UINT8_C( 99), UINT8_C(180), UINT8_C( 34), UINT8_C(109), UINT8_C( 14), UINT8_C(245), UINT8_C(141), UINT8_C(  7) } },
+    { { UINT16_C(26654),     UINT16_MAX, UINT16_C(64952), UINT16_C(    0), UINT16_C(21496), UINT16_C(16681), UINT16_C(42496), UINT16_C(25764) },
+      {     UINT16_MAX,     UINT16_MAX, UINT16_C(56131), UINT16_C(14273), UINT16_C(42270),     UINT16_MAX, UINT16_C(17882), UINT16_C( 7552) },
+      { UINT8_C(104), UINT8_C(  0), UINT8_C( 34), UINT8_C(200), UINT8_C(175), UINT8_C( 65), UINT8_C( 96), UINT8_C( 71) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_uint16x8_t b = simde_vld1q_u16(test_vec[i].b);
+    simde_uint8x8_t r = simde_vrsubhn_u16(a, b);
+
+    simde_test_arm_neon_assert_equal_u8x8(r, simde_vld1_u8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsubhn_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint16_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3562737131), UINT32_C(4103729851), UINT32_C(1378624212), UINT32_C(1856039912) },
+      { UINT32_C(2657624825), UINT32_C(1138892553), UINT32_C( 396693800), UINT32_C(4279732078) },
+      { UINT16_C(13811), UINT16_C(45240), UINT16_C(14983), UINT16_C(28553) } },
+    { {          UINT32_MAX, UINT32_C(2019276361), UINT32_C(1615894563), UINT32_C(2318526742) },
+      {          UINT32_MAX, UINT32_C(3561084641), UINT32_C(         0), UINT32_C(         0) },
+      { UINT16_C(    0), UINT16_C(42010), UINT16_C(24657), UINT16_C(35378) } },
+    { { UINT32_C(1253173717), UINT32_C(2786862750), UINT32_C(3014432247), UINT32_C(1641904336) },
+      { UINT32_C(2863821120), UINT32_C(1901550662), UINT32_C(4075051518), UINT32_C(4221654888) },
+      { UINT16_C(40959), UINT16_C(13509), UINT16_C(49352), UINT16_C(26172) } },
+    { { UINT32_C(         0), UINT32_C(         0), UINT32_C(3236968903), UINT32_C(4081448481) },
+      { UINT32_C(2087719675),          UINT32_MAX, UINT32_C(4256285937), UINT32_C(2879196979) },
+      { UINT16_C(33680), UINT16_C(    0), UINT16_C(49982), UINT16_C(18345) } },
+    { { UINT32_C(3830359883), UINT32_C(2947319065), UINT32_C(2350208916), UINT32_C(4257466635) },
+      { UINT32_C( 170852462),          UINT32_MAX, UINT32_C(2844252794), UINT32_C(4261022357) },
+      { UINT16_C(55840), UINT16_C(44973), UINT16_C(57997), UINT16_C(65482) } },
+    { {          UINT32_MAX, UINT32_C(2295127307), UINT32_C( 811369785),          UINT32_MAX },
+      { UINT32_C(1325043207), UINT32_C(3193744157), UINT32_C(         0), UINT32_C(1050555696) },
+      { UINT16_C(45317), UINT16_C(51824), UINT16_C(12381), UINT16_C(49506) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t b = simde_vld1q_u32(test_vec[i].b);
+    simde_uint16x4_t r = simde_vrsubhn_u32(a, b);
+
+    simde_test_arm_neon_assert_equal_u16x4(r, simde_vld1_u16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsubhn_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(  810101921297875028),                    UINT64_MAX },
+      { UINT64_C(11176647357804248584), UINT64_C(10617231951258794989) },
+      { UINT32_C(1881317850), UINT32_C(1822950347) } },
+    { {                    UINT64_MAX, UINT64_C(10968927414846228305) },
+      { UINT64_C( 2934954892316539014), UINT64_C(13777028231617845889) },
+      { UINT32_C(3611619859), UINT32_C(3641155375) } },
+    { { UINT64_C( 1598911720363203667),                    UINT64_MAX },
+      { UINT64_C(13126606356095052948), UINT64_C( 1519874892700015348) },
+      { UINT32_C(1610966734), UINT32_C(3941093846) } },
+    { { UINT64_C( 5679623738712699276), UINT64_C(11825496258222086747) },
+      { UINT64_C(                   0), UINT64_C( 4452625435504778134) },
+      { UINT32_C(1322390451), UINT32_C(1716630259) } },
+    { { UINT64_C(                   0), UINT64_C(13068148207268047313) },
+      { UINT64_C( 5068869481954049767), UINT64_C(15034307079895857368) },
+      { UINT32_C(3114779152), UINT32_C(3837185260) } },
+    { { UINT64_C(14709617610591697747), UINT64_C( 9307371004864312406) },
+      { UINT64_C( 2230521340331572871), UINT64_C(11729527990602894307) },
+      { UINT32_C(2905516017), UINT32_C(3731014926) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+    simde_uint32x2_t r = simde_vrsubhn_u64(a, b);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrsubhn_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrsubhn_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrsubhn_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrsubhn_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrsubhn_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vrsubhn_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
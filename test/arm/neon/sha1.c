@@ -0,0 +1,290 @@
+#define SIMDE_TEST_ARM_NEON_INSN sha1
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sha1.h"
+
+static int
+test_simde_vsha1cq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_e;
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3242207440), UINT32_C( 439251165), UINT32_C(2761221704), UINT32_C(1114161790) },
+      UINT32_C(1232060124),
+      { UINT32_C(2923099838), UINT32_C(2242315397), UINT32_C( 948923807), UINT32_C(3583938358) },
+      { UINT32_C(3404796525), UINT32_C(1423603427), UINT32_C(2328802857), UINT32_C( 402467975) } },
+    { { UINT32_C(4078217248), UINT32_C( 134393172), UINT32_C(1995054103), UINT32_C(2691685279) },
+      UINT32_C( 740090208),
+      { UINT32_C(3230202443), UINT32_C(3601969583), UINT32_C(4151198869), UINT32_C(2766914379) },
+      { UINT32_C(2452168714), UINT32_C(  89906199), UINT32_C(2631206304), UINT32_C(1005227930) } },
+    { { UINT32_C(1427447564), UINT32_C(2592641972), UINT32_C(2736987396), UINT32_C(1906940461) },
+      UINT32_C(3461053471),
+      { UINT32_C(4205572816), UINT32_C(1301832612), UINT32_C(4003007523), UINT32_C(3329623179) },
+      { UINT32_C(2077621251), UINT32_C(1407763417), UINT32_C(2403093673), UINT32_C(2477726305) } },
+    { { UINT32_C(3378458943), UINT32_C(3220362101), UINT32_C(2572524351), UINT32_C(4086763209) },
+      UINT32_C(3748790868),
+      { UINT32_C(1780101575), UINT32_C( 218233050), UINT32_C( 468945618), UINT32_C(1827880759) },
+      { UINT32_C(2645681032), UINT32_C(2003857284), UINT32_C(1287474938), UINT32_C(1404174068) } },
+    { { UINT32_C(2218540153), UINT32_C( 964239380), UINT32_C(2911669806), UINT32_C(3404101580) },
+      UINT32_C(3924918449),
+      { UINT32_C(2915399951), UINT32_C(3248290667), UINT32_C(4221609538), UINT32_C(2349986616) },
+      { UINT32_C(2531124304), UINT32_C( 617469039), UINT32_C(3303998767), UINT32_C(  45299759) } },
+    { { UINT32_C(3096809928), UINT32_C(3674958181), UINT32_C(4133866865), UINT32_C(3653262976) },
+      UINT32_C(4162397229),
+      { UINT32_C(2628908062), UINT32_C(2929678892), UINT32_C(1167038660), UINT32_C(3337147089) },
+      { UINT32_C(1644428421), UINT32_C(1303479063), UINT32_C( 298168165), UINT32_C(3733957712) } },
+    { { UINT32_C(  41669794), UINT32_C(3872831764), UINT32_C(2517683271), UINT32_C(2496035582) },
+      UINT32_C(  57201909),
+      { UINT32_C(2322277768), UINT32_C(1507942775), UINT32_C(  77860542), UINT32_C(4249892155) },
+      { UINT32_C(2228735095), UINT32_C(2080872334), UINT32_C(1001465738), UINT32_C(3705132650) } },
+    { { UINT32_C(3710367627), UINT32_C(1109534061), UINT32_C(1993116607), UINT32_C(2959311621) },
+      UINT32_C(1439267708),
+      { UINT32_C(3155894544), UINT32_C(2209461628), UINT32_C(1390159538), UINT32_C( 816847945) },
+      { UINT32_C( 644398636), UINT32_C( 187647637), UINT32_C(1923086869), UINT32_C( 709313613) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha1cq_u32(hash_abcd, test_vec[i].hash_e, wk);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1pq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_e;
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2584124670), UINT32_C(3416553334), UINT32_C(3803937815), UINT32_C( 812622046) },
+      UINT32_C(3112055630),
+      { UINT32_C(4275394969), UINT32_C(1438377149), UINT32_C( 348116764), UINT32_C(4271932158) },
+      { UINT32_C(2961695224), UINT32_C(1844245506), UINT32_C(1759437948), UINT32_C(1151727134) } },
+    { { UINT32_C(1523832350), UINT32_C(2881078926), UINT32_C(4284634172), UINT32_C(1031692763) },
+      UINT32_C( 824065628),
+      { UINT32_C(3470633753), UINT32_C( 244009720), UINT32_C(3366074358), UINT32_C(3282161302) },
+      { UINT32_C(2819290030), UINT32_C(2684445274), UINT32_C( 935292259), UINT32_C(1896294442) } },
+    { { UINT32_C(3768399483), UINT32_C( 551523506), UINT32_C(3592676262), UINT32_C(2422079930) },
+      UINT32_C(3421787131),
+      { UINT32_C( 808725987), UINT32_C(1679221826), UINT32_C(3492016853), UINT32_C(3246915198) },
+      { UINT32_C( 533913803), UINT32_C(3549181605), UINT32_C(3763193342), UINT32_C( 496792066) } },
+    { { UINT32_C(2880082916), UINT32_C(3284105495), UINT32_C(1143964715), UINT32_C(3531906564) },
+      UINT32_C(1383490987),
+      { UINT32_C( 923922729), UINT32_C(1565520165), UINT32_C(4236626394), UINT32_C(4233175118) },
+      { UINT32_C(2367618956), UINT32_C(1868903899), UINT32_C(1934199607), UINT32_C(1425788328) } },
+    { { UINT32_C(2472146339), UINT32_C( 726911211), UINT32_C(3902884375), UINT32_C(1706883997) },
+      UINT32_C(2220487481),
+      { UINT32_C(3656748268), UINT32_C(3352411146), UINT32_C(4061598095), UINT32_C(2594575144) },
+      { UINT32_C(1624075554), UINT32_C(1722746539), UINT32_C(3063165200), UINT32_C( 469183358) } },
+    { { UINT32_C( 359764853), UINT32_C(1249653663), UINT32_C(1904652294), UINT32_C(2106790445) },
+      UINT32_C(2237304669),
+      { UINT32_C(3528701791), UINT32_C(3122011180), UINT32_C(1199071662), UINT32_C(  75851047) },
+      { UINT32_C(1916935308), UINT32_C(2144356266), UINT32_C(2648084493), UINT32_C(2467467716) } },
+    { { UINT32_C(3971570720), UINT32_C(1619777437), UINT32_C(3142726879), UINT32_C( 197348313) },
+      UINT32_C(3384450221),
+      { UINT32_C(1589799954), UINT32_C(2264912718), UINT32_C( 472216543), UINT32_C(3043193284) },
+      { UINT32_C(2789811764), UINT32_C( 582264425), UINT32_C( 649910988), UINT32_C(3824209245) } },
+    { { UINT32_C(1893066371), UINT32_C(2729154638), UINT32_C(3063102522), UINT32_C(1783835023) },
+      UINT32_C(2277739092),
+      { UINT32_C(   8225832), UINT32_C(2557063621), UINT32_C(2407977544), UINT32_C(3524984158) },
+      { UINT32_C(1651654426), UINT32_C(1994888747), UINT32_C(2813701416), UINT32_C(1213881145) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha1pq_u32(hash_abcd, test_vec[i].hash_e, wk);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1mq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_e;
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2964943437), UINT32_C( 348418299), UINT32_C(2382576502), UINT32_C(3939422988) },
+      UINT32_C(1720535028),
+      { UINT32_C(4214150970), UINT32_C(2351344369), UINT32_C( 209925688), UINT32_C( 449651988) },
+      { UINT32_C(3243852205), UINT32_C( 134178142), UINT32_C(4233138478), UINT32_C(2179741464) } },
+    { { UINT32_C(2799366989), UINT32_C(2766623864), UINT32_C(1259999905), UINT32_C( 283635105) },
+      UINT32_C(2712529338),
+      { UINT32_C( 566221264), UINT32_C(4292364263), UINT32_C( 341472037), UINT32_C(1074484622) },
+      { UINT32_C( 524920057), UINT32_C(3532696747), UINT32_C( 210948386), UINT32_C(3891060855) } },
+    { { UINT32_C(4091429707), UINT32_C( 827807354), UINT32_C(3902010866), UINT32_C(2745163934) },
+      UINT32_C(2689874308),
+      { UINT32_C( 937334532), UINT32_C(4027080325), UINT32_C(3922913982), UINT32_C( 899721777) },
+      { UINT32_C(2122286742), UINT32_C(2885491111), UINT32_C(3417931078), UINT32_C(1030015936) } },
+    { { UINT32_C(1853575791), UINT32_C(2843541957), UINT32_C(3034784595), UINT32_C(2034933391) },
+      UINT32_C(1916671323),
+      { UINT32_C( 462607765), UINT32_C(1129144595), UINT32_C(2479820069), UINT32_C(3864652421) },
+      { UINT32_C(  96405156), UINT32_C(2662029352), UINT32_C(4294358437), UINT32_C(  94998313) } },
+    { { UINT32_C( 474099355), UINT32_C(3919763926), UINT32_C(1204385138), UINT32_C( 977749710) },
+      UINT32_C( 612504274),
+      { UINT32_C(3904110665), UINT32_C(1054796983), UINT32_C(1798160774), UINT32_C(3851204611) },
+      { UINT32_C(1159450128), UINT32_C( 552502403), UINT32_C( 802520350), UINT32_C(   5230357) } },
+    { { UINT32_C(1502420181), UINT32_C(2119656648), UINT32_C( 810192503), UINT32_C(2360020695) },
+      UINT32_C(1629488207),
+      { UINT32_C( 620307640), UINT32_C(2292756403), UINT32_C( 653542479), UINT32_C(3021246642) },
+      { UINT32_C(1785990064), UINT32_C(2830904812), UINT32_C(3958827791), UINT32_C(2097280162) } },
+    { { UINT32_C( 452693142), UINT32_C(3683539600), UINT32_C(3012268400), UINT32_C(4069455918) },
+      UINT32_C(2484923019),
+      { UINT32_C(4044067376), UINT32_C(3186124043), UINT32_C( 939365996), UINT32_C(2517836299) },
+      { UINT32_C(3109466186), UINT32_C(2452687005), UINT32_C( 975174130), UINT32_C(3054123499) } },
+    { { UINT32_C(3056960532), UINT32_C(1078317484), UINT32_C( 292060066), UINT32_C(1711692999) },
+      UINT32_C(3942983045),
+      { UINT32_C(1575443590), UINT32_C(3252871712), UINT32_C(3980283322), UINT32_C( 122067616) },
+      { UINT32_C(3961257934), UINT32_C(2499263465), UINT32_C(2366742268), UINT32_C(3556267921) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha1mq_u32(hash_abcd, test_vec[i].hash_e, wk);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1h_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_e;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(3019025737), UINT32_C(1828498258) },
+    { UINT32_C(1681924772), UINT32_C( 420481193) },
+    { UINT32_C(3575304602), UINT32_C(3041309798) },
+    { UINT32_C( 919202411), UINT32_C(3451026074) },
+    { UINT32_C(2825007917), UINT32_C(1779993803) },
+    { UINT32_C(3566769749), UINT32_C(1965434261) },
+    { UINT32_C(4133756827), UINT32_C(4254664678) },
+    { UINT32_C(1578792589), UINT32_C(1468439971) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_u32(simde_vsha1h_u32(test_vec[i].hash_e), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1su0q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t w0_3[4];
+    uint32_t w4_7[4];
+    uint32_t w8_11[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3283887446), UINT32_C( 383791416), UINT32_C(   1415778), UINT32_C(2770270043) },
+      { UINT32_C( 344715475), UINT32_C(2772944031), UINT32_C( 166241845), UINT32_C(2527634673) },
+      { UINT32_C(3837597436), UINT32_C(1788524117), UINT32_C( 902038106), UINT32_C(3482123540) },
+      { UINT32_C( 655665608), UINT32_C(3647238198), UINT32_C( 559573227), UINT32_C(3486895824) } },
+    { { UINT32_C(1986938713), UINT32_C(1480840059), UINT32_C(2510580823), UINT32_C(2813767714) },
+      { UINT32_C( 962361246), UINT32_C(3861386808), UINT32_C(1185408136), UINT32_C(2400981544) },
+      { UINT32_C(3793297874), UINT32_C(4174963990), UINT32_C( 785579070), UINT32_C(3438313636) },
+      { UINT32_C(  30608092), UINT32_C( 120424015), UINT32_C(2183849975), UINT32_C(2372806334) } },
+    { { UINT32_C(3572293202), UINT32_C(3728522046), UINT32_C(2013460776), UINT32_C(3682770261) },
+      { UINT32_C(2960390932), UINT32_C(2421183576), UINT32_C(1685284253), UINT32_C(4246518917) },
+      { UINT32_C(2914116473), UINT32_C(1630470030), UINT32_C(3025671686), UINT32_C( 832405383) },
+      { UINT32_C(  23053315), UINT32_C(1687214565), UINT32_C(2083066938), UINT32_C(2052044426) } },
+    { { UINT32_C(1815590306), UINT32_C( 393762201), UINT32_C(1285744652), UINT32_C(2684678394) },
+      { UINT32_C(1844832969), UINT32_C(1166970604), UINT32_C(3201993720), UINT32_C(3811896231) },
+      { UINT32_C(  46675401), UINT32_C( 965370811), UINT32_C( 890315580), UINT32_C(1858116175) },
+      { UINT32_C( 576546919), UINT32_C(2398537432), UINT32_C( 340140537), UINT32_C(2336941145) } },
+    { { UINT32_C(1506418253), UINT32_C(1644661316), UINT32_C(2994113589), UINT32_C( 409840293) },
+      { UINT32_C(2184636419), UINT32_C(1612862290), UINT32_C( 965977553), UINT32_C(1894006944) },
+      { UINT32_C(3773912130), UINT32_C( 989224930), UINT32_C(2468730766), UINT32_C(3727417869) },
+      { UINT32_C( 189646394), UINT32_C(1083997955), UINT32_C(2741351352), UINT32_C(2791578618) } },
+    { { UINT32_C(3821810955), UINT32_C( 250377800), UINT32_C(1631547502), UINT32_C(1976204118) },
+      { UINT32_C(4082166272), UINT32_C(2210616694), UINT32_C(2495253516), UINT32_C(2670263944) },
+      { UINT32_C(1485992456), UINT32_C( 333861410), UINT32_C( 660500506), UINT32_C(3626390812) },
+      { UINT32_C(3663804269), UINT32_C(1757437756), UINT32_C(3039947380), UINT32_C( 774863676) } },
+    { { UINT32_C(3438006138), UINT32_C(3459716892), UINT32_C( 748697035), UINT32_C(2601550949) },
+      { UINT32_C(3529179059), UINT32_C(2542024786), UINT32_C(3486714064), UINT32_C(3986109465) },
+      { UINT32_C( 568119856), UINT32_C(3195375301), UINT32_C(3126047843), UINT32_C(3635651475) },
+      { UINT32_C(3247908993), UINT32_C(3948027324), UINT32_C(1151958555), UINT32_C(3559333796) } },
+    { { UINT32_C(3011296766), UINT32_C(3921558778), UINT32_C( 400559571), UINT32_C(3016723327) },
+      { UINT32_C(3260941338), UINT32_C(1019356521), UINT32_C(4078953563), UINT32_C(1400178238) },
+      { UINT32_C(1441525369), UINT32_C(1886940872), UINT32_C(2276396580), UINT32_C(2306865401) },
+      { UINT32_C(4051131988), UINT32_C( 705288525), UINT32_C(1376847853), UINT32_C( 108156655) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t w0_3 = simde_vld1q_u32(test_vec[i].w0_3);
+    simde_uint32x4_t w4_7 = simde_vld1q_u32(test_vec[i].w4_7);
+    simde_uint32x4_t w8_11 = simde_vld1q_u32(test_vec[i].w8_11);
+    simde_uint32x4_t r = simde_vsha1su0q_u32(w0_3, w4_7, w8_11);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1su1q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t tw0_3[4];
+    uint32_t w12_15[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1763107803), UINT32_C(4230407525), UINT32_C(1024822071), UINT32_C(1517889844) },
+      { UINT32_C( 692211062), UINT32_C(3573529082), UINT32_C(2852981795), UINT32_C(2662589814) },
+      { UINT32_C(2077406275), UINT32_C(2891436684), UINT32_C(1196219523), UINT32_C(1129790190) } },
+    { { UINT32_C(4155480448), UINT32_C(4257143899), UINT32_C( 545008119), UINT32_C(1942369253) },
+      { UINT32_C(  92945964), UINT32_C(1798310770), UINT32_C(2322306490), UINT32_C(2304567208) },
+      { UINT32_C( 960439781), UINT32_C(4020933570), UINT32_C(1380031679), UINT32_C(2515676160) } },
+    { { UINT32_C(1139604035), UINT32_C( 929110882), UINT32_C(3729095632), UINT32_C(2852813733) },
+      { UINT32_C(1260665692), UINT32_C(1618554802), UINT32_C(  98093427), UINT32_C(3046392723) },
+      { UINT32_C(1194044386), UINT32_C(1702077474), UINT32_C(3617747078), UINT32_C(3661865103) } },
+    { { UINT32_C(1332680299), UINT32_C(3409506914), UINT32_C(1762776911), UINT32_C(1002668213) },
+      { UINT32_C(1858911299), UINT32_C(4096403989), UINT32_C(1761450401), UINT32_C(3073431674) },
+      { UINT32_C(1988786429), UINT32_C(1200281479), UINT32_C(3158449771), UINT32_C(2593386640) } },
+    { { UINT32_C(1223569898), UINT32_C(2874842491), UINT32_C(4137065212), UINT32_C(3079327726) },
+      { UINT32_C(  59264834), UINT32_C(3141254760), UINT32_C( 960243293), UINT32_C( 338727585) },
+      { UINT32_C(3886751493), UINT32_C( 617444941), UINT32_C(3310096571), UINT32_C(2688786902) } },
+    { { UINT32_C(3521275881), UINT32_C(3764098774), UINT32_C( 865151596), UINT32_C( 557174441) },
+      { UINT32_C( 901177404), UINT32_C(3396561817), UINT32_C(1678307432), UINT32_C(4225337200) },
+      { UINT32_C( 924981472), UINT32_C( 145149309), UINT32_C(2425444921), UINT32_C( 741321874) } },
+    { { UINT32_C(2715215480), UINT32_C(4270351273), UINT32_C(3540628465), UINT32_C(2698028979) },
+      { UINT32_C(3380478018), UINT32_C(1749896297), UINT32_C( 760563064), UINT32_C(2753326697) },
+      { UINT32_C(2469876771), UINT32_C(2814004643), UINT32_C(3995843376), UINT32_C(1741678368) } },
+    { { UINT32_C(4002906541), UINT32_C(1881480068), UINT32_C( 751650304), UINT32_C(1301951374) },
+      { UINT32_C(3466666531), UINT32_C(3691564671), UINT32_C(3690397869), UINT32_C( 735211455) },
+      { UINT32_C(1698602916), UINT32_C(1470379603), UINT32_C( 238965630), UINT32_C(1363761236) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t tw0_3 = simde_vld1q_u32(test_vec[i].tw0_3);
+    simde_uint32x4_t w12_15 = simde_vld1q_u32(test_vec[i].w12_15);
+    simde_uint32x4_t r = simde_vsha1su1q_u32(tw0_3, w12_15);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1cq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1pq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1mq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1h_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1su0q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1su1q_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,215 @@
+#define SIMDE_TEST_ARM_NEON_INSN sha256
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sha256.h"
+
+static int
+test_simde_vsha256hq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_efgh[4];
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 495626530), UINT32_C(1603219752), UINT32_C(1625883749), UINT32_C(2253391591) },
+      { UINT32_C( 913556165), UINT32_C(2034545211), UINT32_C(1979314302), UINT32_C(2574655834) },
+      { UINT32_C(3359860059), UINT32_C( 605150277), UINT32_C(3448239168), UINT32_C(2484552265) },
+      { UINT32_C(  29662742), UINT32_C(2584415635), UINT32_C(2892918025), UINT32_C(2340588643) } },
+    { { UINT32_C(3253558078), UINT32_C(  35479131), UINT32_C( 128207788), UINT32_C( 414451121) },
+      { UINT32_C(1244092903), UINT32_C(1424327247), UINT32_C(3964582955), UINT32_C(3923913038) },
+      { UINT32_C(3166910870), UINT32_C(1386461647), UINT32_C(3276920191), UINT32_C(2901249715) },
+      { UINT32_C(1816768122), UINT32_C( 939276871), UINT32_C(2511258430), UINT32_C( 504311612) } },
+    { { UINT32_C( 747373711), UINT32_C(3914819663), UINT32_C( 669532104), UINT32_C(2669327456) },
+      { UINT32_C(2101017638), UINT32_C(1645764186), UINT32_C(2619082780), UINT32_C(2985247161) },
+      { UINT32_C( 535188527), UINT32_C( 957216314), UINT32_C(3756610142), UINT32_C(1913468688) },
+      { UINT32_C(2552153759), UINT32_C(3485803863), UINT32_C(1878753605), UINT32_C(1061935187) } },
+    { { UINT32_C(2459858827), UINT32_C(1626919326), UINT32_C(3985442878), UINT32_C(3859934378) },
+      { UINT32_C(3892818802), UINT32_C(2005338494), UINT32_C(1717391070), UINT32_C( 249592356) },
+      { UINT32_C(1183939231), UINT32_C(2674144791), UINT32_C(3592066318), UINT32_C(2590077851) },
+      { UINT32_C(1234482445), UINT32_C(1906435067), UINT32_C(3266623345), UINT32_C(1672962825) } },
+    { { UINT32_C(2136604501), UINT32_C(1410411371), UINT32_C(2578650499), UINT32_C( 511595851) },
+      { UINT32_C(3095026337), UINT32_C( 708422138), UINT32_C(4200072232), UINT32_C(2153964696) },
+      { UINT32_C(2211085000), UINT32_C(3911142416), UINT32_C(1969835058), UINT32_C(1938302033) },
+      { UINT32_C(3024304602), UINT32_C(3952652667), UINT32_C(1246745126), UINT32_C(2113090351) } },
+    { { UINT32_C(3681190777), UINT32_C( 350252996), UINT32_C( 328721581), UINT32_C(3052750354) },
+      { UINT32_C(1882870491), UINT32_C(1973583698), UINT32_C( 942414914), UINT32_C( 894064176) },
+      { UINT32_C(2623723451), UINT32_C( 446119995), UINT32_C(3531565728), UINT32_C(3367521356) },
+      { UINT32_C(4226995758), UINT32_C(3503444297), UINT32_C(3446660533), UINT32_C(1347917002) } },
+    { { UINT32_C(1829405592), UINT32_C(4051889111), UINT32_C( 891475889), UINT32_C(  52378097) },
+      { UINT32_C( 520172083), UINT32_C(3873655821), UINT32_C(3870284173), UINT32_C(  19335821) },
+      { UINT32_C(2514398991), UINT32_C(1753221186), UINT32_C(4017473391), UINT32_C(2026918336) },
+      { UINT32_C(4095856671), UINT32_C(3825830985), UINT32_C(1290528134), UINT32_C( 718204193) } },
+    { { UINT32_C(1153772251), UINT32_C( 400559430), UINT32_C(1226684819), UINT32_C( 497160775) },
+      { UINT32_C( 772061670), UINT32_C(1050092565), UINT32_C(2738812740), UINT32_C(2920133015) },
+      { UINT32_C(2410692923), UINT32_C(3383909559), UINT32_C(3678696284), UINT32_C( 234906266) },
+      { UINT32_C( 460176730), UINT32_C(2419370855), UINT32_C(2061930443), UINT32_C(1814209948) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t hash_efgh = simde_vld1q_u32(test_vec[i].hash_efgh);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha256hq_u32(hash_abcd, hash_efgh, wk);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha256h2q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_efgh[4];
+    uint32_t hash_abcd[4];
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2530279197), UINT32_C( 382187388), UINT32_C(1435718537), UINT32_C(2942271428) },
+      { UINT32_C( 440593816), UINT32_C( 707697644), UINT32_C(3375594342), UINT32_C(4009341680) },
+      { UINT32_C(4072957645), UINT32_C( 581737511), UINT32_C(1409184928), UINT32_C(2368512996) },
+      { UINT32_C(1063073827), UINT32_C( 514652370), UINT32_C(4241857554), UINT32_C(3866585157) } },
+    { { UINT32_C(1341003648), UINT32_C(3899112017), UINT32_C(2256739295), UINT32_C( 780042172) },
+      { UINT32_C(1612041753), UINT32_C( 989728341), UINT32_C(3197889468), UINT32_C(1233139421) },
+      { UINT32_C(2063406204), UINT32_C(3872093059), UINT32_C(2073097281), UINT32_C(1216319943) },
+      { UINT32_C(1304220842), UINT32_C(1422333130), UINT32_C(2694656175), UINT32_C(3248515887) } },
+    { { UINT32_C(1621813544), UINT32_C(1575680764), UINT32_C(1076867337), UINT32_C(2795487711) },
+      { UINT32_C(3964874776), UINT32_C(1236956939), UINT32_C(4052626377), UINT32_C(3300532302) },
+      { UINT32_C( 901036209), UINT32_C(2886679096), UINT32_C(1614415100), UINT32_C(3339725242) },
+      { UINT32_C( 850353267), UINT32_C( 185015882), UINT32_C(1866366959), UINT32_C(3015228880) } },
+    { { UINT32_C(3087932150), UINT32_C(2597627379), UINT32_C(1519210309), UINT32_C(2766620100) },
+      { UINT32_C(1896500528), UINT32_C(2118568648), UINT32_C(2423247643), UINT32_C(3112565855) },
+      { UINT32_C(1161487948), UINT32_C( 340550307), UINT32_C(1663846711), UINT32_C(  92185522) },
+      { UINT32_C( 603941107), UINT32_C(3410472895), UINT32_C(1526510381), UINT32_C(  23572822) } },
+    { { UINT32_C(3084935952), UINT32_C(2000975483), UINT32_C(4033606409), UINT32_C(2970509947) },
+      { UINT32_C( 278104394), UINT32_C(3418090627), UINT32_C(3762679943), UINT32_C(1100816634) },
+      { UINT32_C( 373943787), UINT32_C(  77802677), UINT32_C(2826568276), UINT32_C(   7089493) },
+      { UINT32_C(3306737928), UINT32_C(3891445202), UINT32_C(4087077766), UINT32_C(1362778452) } },
+    { { UINT32_C( 225873328), UINT32_C(2875768363), UINT32_C(2341971019), UINT32_C( 220233762) },
+      { UINT32_C( 982501400), UINT32_C( 538641230), UINT32_C(3473804450), UINT32_C(4223128878) },
+      { UINT32_C(  88408529), UINT32_C(1065500093), UINT32_C(2199634773), UINT32_C( 205526497) },
+      { UINT32_C( 854929329), UINT32_C(3665942713), UINT32_C( 680106768), UINT32_C(1735503981) } },
+    { { UINT32_C(4126949878), UINT32_C(2249958824), UINT32_C(2282877566), UINT32_C(1126313258) },
+      { UINT32_C(1898745204), UINT32_C(3413185894), UINT32_C(2786835187), UINT32_C( 523362171) },
+      { UINT32_C(3410518878), UINT32_C(2686980307), UINT32_C(2944406641), UINT32_C(1630305168) },
+      { UINT32_C(  90792477), UINT32_C(1346420585), UINT32_C(2111264995), UINT32_C(3571440032) } },
+    { { UINT32_C(1786923745), UINT32_C(1552782354), UINT32_C( 882101876), UINT32_C( 502898009) },
+      { UINT32_C(3361405524), UINT32_C(3787794914), UINT32_C(2162364683), UINT32_C( 480129897) },
+      { UINT32_C(4108315739), UINT32_C( 758139306), UINT32_C(1458528474), UINT32_C(2541348118) },
+      { UINT32_C(1195659905), UINT32_C(3394769878), UINT32_C(1867629582), UINT32_C( 615213832) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_efgh = simde_vld1q_u32(test_vec[i].hash_efgh);
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha256h2q_u32(hash_efgh, hash_abcd, wk);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha256su0q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t w0_3[4];
+    uint32_t w4_7[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1317291076), UINT32_C(1453343504), UINT32_C(2001494314), UINT32_C(1223225640) },
+      { UINT32_C(4243532194), UINT32_C( 111192741), UINT32_C(3345634712), UINT32_C( 803516291) },
+      { UINT32_C(2302779792), UINT32_C(2565721156), UINT32_C(3709026087), UINT32_C(3639965060) } },
+    { { UINT32_C(1264658227), UINT32_C(3469578403), UINT32_C(2973907541), UINT32_C(1841429780) },
+      { UINT32_C(3534947691), UINT32_C(3839009502), UINT32_C( 245460984), UINT32_C(3026100566) },
+      { UINT32_C(2244870585), UINT32_C(  44908561), UINT32_C( 191422845), UINT32_C(2053893919) } },
+    { { UINT32_C(3206116595), UINT32_C( 218564318), UINT32_C(2038961332), UINT32_C(1605390793) },
+      { UINT32_C(3787284060), UINT32_C(1396342281), UINT32_C(3224083097), UINT32_C(3149288015) },
+      { UINT32_C( 992404106), UINT32_C(1878397883), UINT32_C( 113463850), UINT32_C(1377057505) } },
+    { { UINT32_C(1572085651), UINT32_C(2682547062), UINT32_C( 348682575), UINT32_C( 436628425) },
+      { UINT32_C(1740905998), UINT32_C(1239531419), UINT32_C(1633199278), UINT32_C(3818073032) },
+      { UINT32_C(1104347604), UINT32_C( 583517791), UINT32_C( 542048382), UINT32_C( 834338261) } },
+    { { UINT32_C( 875266989), UINT32_C( 151920080), UINT32_C(2954417241), UINT32_C(2922405072) },
+      { UINT32_C(3709708331), UINT32_C( 246018734), UINT32_C(1905496072), UINT32_C(1527283573) },
+      { UINT32_C(1517511023), UINT32_C(2575525109), UINT32_C(1405555976), UINT32_C(3561215458) } },
+    { { UINT32_C( 497509170), UINT32_C(2756864301), UINT32_C(2402592508), UINT32_C( 794466633) },
+      { UINT32_C(1460924183), UINT32_C(1304642736), UINT32_C( 188440739), UINT32_C(1491108980) },
+      { UINT32_C(4080067605), UINT32_C(1704609676), UINT32_C(3239859401), UINT32_C( 249833793) } },
+    { { UINT32_C( 417297984), UINT32_C(1791839744), UINT32_C(1669942028), UINT32_C(2757473787) },
+      { UINT32_C( 148464273), UINT32_C(3803939113), UINT32_C( 563548868), UINT32_C( 347241186) },
+      { UINT32_C(1995153455), UINT32_C(2973921557), UINT32_C(1917219790), UINT32_C( 537563804) } },
+    { { UINT32_C(4062233309), UINT32_C(3664250066), UINT32_C(2292587390), UINT32_C(1094354720) },
+      { UINT32_C( 792335655), UINT32_C( 462319013), UINT32_C( 178628231), UINT32_C(3881219994) },
+      { UINT32_C(2985175270), UINT32_C(1161966146), UINT32_C(1913868578), UINT32_C( 271287392) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t w0_3 = simde_vld1q_u32(test_vec[i].w0_3);
+    simde_uint32x4_t w4_7 = simde_vld1q_u32(test_vec[i].w4_7);
+    simde_uint32x4_t r = simde_vsha256su0q_u32(w0_3, w4_7);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha256su1q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t tw0_3[4];
+    uint32_t w8_11[4];
+    uint32_t w12_15[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1230260408), UINT32_C(4220298396), UINT32_C(1389258362), UINT32_C(2270252205) },
+      { UINT32_C(4046971806), UINT32_C(2390204607), UINT32_C( 792268713), UINT32_C( 179145775) },
+      { UINT32_C(3952421319), UINT32_C( 233093734), UINT32_C(2158623225), UINT32_C( 761592878) },
+      { UINT32_C(2611987382), UINT32_C( 207568486), UINT32_C(1996974075), UINT32_C(3957540575) } },
+    { { UINT32_C(3460800827), UINT32_C(3608670874), UINT32_C(2397642978), UINT32_C( 336464856) },
+      { UINT32_C(4121081323), UINT32_C(3372768605), UINT32_C(4123056822), UINT32_C(2945928468) },
+      { UINT32_C(2666503793), UINT32_C( 333169078), UINT32_C(1451759756), UINT32_C( 243907387) },
+      { UINT32_C(2794586667), UINT32_C(3083997771), UINT32_C(2147053841), UINT32_C(4265542624) } },
+    { { UINT32_C(1276760452), UINT32_C(3543859135), UINT32_C( 702589485), UINT32_C(1459595931) },
+      { UINT32_C( 985738008), UINT32_C(3246936656), UINT32_C(2628968427), UINT32_C( 473132958) },
+      { UINT32_C(1790367108), UINT32_C( 733695935), UINT32_C(2319626746), UINT32_C(2627809703) },
+      { UINT32_C( 478324889), UINT32_C( 783152434), UINT32_C(1198303046), UINT32_C(  99318301) } },
+    { { UINT32_C(4089337760), UINT32_C(2252013968), UINT32_C(3141462260), UINT32_C(3434033888) },
+      { UINT32_C(4010738554), UINT32_C(1420429506), UINT32_C(3286129877), UINT32_C( 716392497) },
+      { UINT32_C(1059082045), UINT32_C(1800284564), UINT32_C( 181083692), UINT32_C( 179926255) },
+      { UINT32_C( 892966749), UINT32_C(3741460667), UINT32_C(3745162115), UINT32_C(1565316872) } },
+    { { UINT32_C(3006514742), UINT32_C(4273911822), UINT32_C( 630240551), UINT32_C(2961961368) },
+      { UINT32_C(2816163861), UINT32_C(2601181746), UINT32_C( 369536590), UINT32_C(2318498201) },
+      { UINT32_C(2488224418), UINT32_C(4294195765), UINT32_C(2266952650), UINT32_C(3199869512) },
+      { UINT32_C(4126965048), UINT32_C(1778928734), UINT32_C(1623738910), UINT32_C(1956230800) } },
+    { { UINT32_C(1971018161), UINT32_C(1865902191), UINT32_C(3475093836), UINT32_C(2869991025) },
+      { UINT32_C(3004926664), UINT32_C(1631413947), UINT32_C( 948827778), UINT32_C(2824549300) },
+      { UINT32_C(2114667979), UINT32_C(2335790269), UINT32_C(1783852003), UINT32_C(2138658544) },
+      { UINT32_C(2941259045), UINT32_C( 696208631), UINT32_C(2124063553), UINT32_C(2030766719) } },
+    { { UINT32_C(1662434900), UINT32_C( 182783220), UINT32_C( 974997707), UINT32_C(3424947170) },
+      { UINT32_C( 951915644), UINT32_C(3788176487), UINT32_C(2648185831), UINT32_C(2332436953) },
+      { UINT32_C( 267089308), UINT32_C( 833615067), UINT32_C(1842849560), UINT32_C( 778831227) },
+      { UINT32_C(1817577843), UINT32_C( 718705365), UINT32_C(2326806727), UINT32_C(2001372947) } },
+    { { UINT32_C(2135530920), UINT32_C(1934446994), UINT32_C(1979292049), UINT32_C(1609641792) },
+      { UINT32_C(2969984386), UINT32_C(3280879099), UINT32_C(3457248113), UINT32_C(1093366962) },
+      { UINT32_C(2309882674), UINT32_C( 363193597), UINT32_C( 697465516), UINT32_C( 689881500) },
+      { UINT32_C(3034697992), UINT32_C(4199977759), UINT32_C(2309849819), UINT32_C(2238827063) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t tw0_3 = simde_vld1q_u32(test_vec[i].tw0_3);
+    simde_uint32x4_t w8_11 = simde_vld1q_u32(test_vec[i].w8_11);
+    simde_uint32x4_t w12_15 = simde_vld1q_u32(test_vec[i].w12_15);
+    simde_uint32x4_t r = simde_vsha256su1q_u32(tw0_3, w8_11, w12_15);
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256hq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256h2q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256su0q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256su1q_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1281 @@
+#define SIMDE_TEST_ARM_NEON_INSN sli_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sli_n.h"
+
+static int
+test_simde_vsli_n_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[8];
+    int8_t b[8];
+    int8_t r0[8];
+    int8_t r3[8];
+    int8_t r5[8];
+    int8_t r7[8];
+  } test_vec[] = {
+    { { -INT8_C( 59),  INT8_C(112),  INT8_C(  2), -INT8_C( 38),  INT8_C( 20), -INT8_C( 14), -INT8_C( 10),  INT8_C( 28) },
+      { -INT8_C( 86), -INT8_C( 93),  INT8_C( 44), -INT8_C(112),  INT8_C(113), -INT8_C( 32), -INT8_C( 26), -INT8_C( 30) },
+      { -INT8_C( 86), -INT8_C( 93),  INT8_C( 44), -INT8_C(112),  INT8_C(113), -INT8_C( 32), -INT8_C( 26), -INT8_C( 30) },
+      {  INT8_C( 85),  INT8_C( 24),  INT8_C( 98), -INT8_C(126), -INT8_C(116),  INT8_C(  2),  INT8_C( 54),  INT8_C( 20) },
+      {  INT8_C( 69),  INT8_C(112), -INT8_C(126),  INT8_C( 26),  INT8_C( 52),  INT8_C( 18), -INT8_C( 42),  INT8_C( 92) },
+      {  INT8_C( 69), -INT8_C( 16),  INT8_C(  2),  INT8_C( 90), -INT8_C(108),  INT8_C(114),  INT8_C(118),  INT8_C( 28) } },
+    { { -INT8_C(  1),  INT8_C(112), -INT8_C( 99),  INT8_C( 72),  INT8_C( 45), -INT8_C( 90), -INT8_C( 79), -INT8_C(  4) },
+      { -INT8_C(  2),  INT8_C( 84),  INT8_C( 36),  INT8_C( 39),  INT8_C( 98),  INT8_C( 79),  INT8_C( 42),  INT8_C( 66) },
+      { -INT8_C(  2),  INT8_C( 84),  INT8_C( 36),  INT8_C( 39),  INT8_C( 98),  INT8_C( 79),  INT8_C( 42),  INT8_C( 66) },
+      { -INT8_C(  9), -INT8_C( 96),  INT8_C( 37),  INT8_C( 56),  INT8_C( 21),  INT8_C(126),  INT8_C( 81),  INT8_C( 20) },
+      { -INT8_C( 33), -INT8_C(112), -INT8_C( 99), -INT8_C( 24),  INT8_C( 77), -INT8_C( 26),  INT8_C( 81),  INT8_C( 92) },
+      {     INT8_MAX,  INT8_C(112),  INT8_C( 29), -INT8_C( 56),  INT8_C( 45), -INT8_C( 90),  INT8_C( 49),  INT8_C(124) } },
+    { { -INT8_C( 99),  INT8_C( 81), -INT8_C(  9), -INT8_C( 13),  INT8_C(126),  INT8_C( 51),  INT8_C( 28),  INT8_C(121) },
+      {  INT8_C( 63),  INT8_C( 29),  INT8_C(  9), -INT8_C(  5),  INT8_C( 25),  INT8_C( 75), -INT8_C(106),  INT8_C(105) },
+      {  INT8_C( 63),  INT8_C( 29),  INT8_C(  9), -INT8_C(  5),  INT8_C( 25),  INT8_C( 75), -INT8_C(106),  INT8_C(105) },
+      { -INT8_C(  3), -INT8_C( 23),  INT8_C( 79), -INT8_C( 37), -INT8_C( 50),  INT8_C( 91), -INT8_C( 76),  INT8_C( 73) },
+      { -INT8_C(  3), -INT8_C( 79),  INT8_C( 55),  INT8_C(115),  INT8_C( 62),  INT8_C(115), -INT8_C( 36),  INT8_C( 57) },
+      { -INT8_C( 99), -INT8_C( 47), -INT8_C(  9), -INT8_C( 13), -INT8_C(  2), -INT8_C( 77),  INT8_C( 28), -INT8_C(  7) } },
+    { {  INT8_C(124), -INT8_C( 12),  INT8_C( 90), -INT8_C( 26), -INT8_C( 46), -INT8_C( 70),  INT8_C( 90), -INT8_C( 80) },
+      {  INT8_C( 83),  INT8_C(105), -INT8_C(115), -INT8_C( 46), -INT8_C( 86),  INT8_C(114),  INT8_C(122), -INT8_C( 70) },
+      {  INT8_C( 83),  INT8_C(105), -INT8_C(115), -INT8_C( 46), -INT8_C( 86),  INT8_C(114),  INT8_C(122), -INT8_C( 70) },
+      { -INT8_C(100),  INT8_C( 76),  INT8_C(106), -INT8_C(106),  INT8_C( 82), -INT8_C(110), -INT8_C( 46), -INT8_C( 48) },
+      {  INT8_C(124),  INT8_C( 52), -INT8_C( 70),  INT8_C( 70),  INT8_C( 82),  INT8_C( 90),  INT8_C( 90),  INT8_C( 80) },
+      { -INT8_C(  4), -INT8_C( 12), -INT8_C( 38),  INT8_C(102),  INT8_C( 82),  INT8_C( 58),  INT8_C( 90),  INT8_C( 48) } },
+    { { -INT8_C( 33), -INT8_C(  7), -INT8_C( 53),  INT8_C( 14),  INT8_C( 33),  INT8_C( 13),  INT8_C(  9),  INT8_C( 40) },
+      { -INT8_C( 93),  INT8_C( 49), -INT8_C(  9), -INT8_C(  2), -INT8_C(121),  INT8_C(126),  INT8_C( 82), -INT8_C(127) },
+      { -INT8_C( 93),  INT8_C( 49), -INT8_C(  9), -INT8_C(  2), -INT8_C(121),  INT8_C(126),  INT8_C( 82), -INT8_C(127) },
+      {  INT8_C( 31), -INT8_C(119), -INT8_C( 69), -INT8_C( 10),  INT8_C( 57), -INT8_C( 11), -INT8_C(111),  INT8_C(  8) },
+      {     INT8_MAX,  INT8_C( 57), -INT8_C( 21), -INT8_C( 50), -INT8_C( 31), -INT8_C( 51),  INT8_C( 73),  INT8_C( 40) },
+      { -INT8_C( 33), -INT8_C(  7), -INT8_C( 53),  INT8_C( 14), -INT8_C( 95),  INT8_C( 13),  INT8_C(  9), -INT8_C( 88) } },
+    { { -INT8_C( 10), -INT8_C(  1),  INT8_C( 23),  INT8_C( 47), -INT8_C( 57),  INT8_C(117),  INT8_C( 89),  INT8_C( 99) },
+      {  INT8_C(125), -INT8_C( 25), -INT8_C(  3),  INT8_C( 70), -INT8_C( 24),  INT8_C( 56), -INT8_C( 18),  INT8_C( 71) },
+      {  INT8_C(125), -INT8_C( 25), -INT8_C(  3),  INT8_C( 70), -INT8_C( 24),  INT8_C( 56), -INT8_C( 18),  INT8_C( 71) },
+      { -INT8_C( 18),  INT8_C( 63), -INT8_C( 17),  INT8_C( 55),  INT8_C( 71), -INT8_C( 59),  INT8_C(113),  INT8_C( 59) },
+      { -INT8_C( 74), -INT8_C(  1), -INT8_C( 73), -INT8_C( 49),  INT8_C(  7),  INT8_C( 21), -INT8_C( 39), -INT8_C( 29) },
+      { -INT8_C( 10), -INT8_C(  1), -INT8_C(105),  INT8_C( 47),  INT8_C( 71),  INT8_C(117),  INT8_C( 89), -INT8_C( 29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+
+    simde_int8x8_t r0 = simde_vsli_n_s8(a, b, 0);
+    simde_int8x8_t r3 = simde_vsli_n_s8(a, b, 3);
+    simde_int8x8_t r5 = simde_vsli_n_s8(a, b, 5);
+    simde_int8x8_t r7 = simde_vsli_n_s8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_i8x8(r0, simde_vld1_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x8(r3, simde_vld1_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x8(r5, simde_vld1_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x8(r7, simde_vld1_s8(test_vec[i].r7));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsli_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[4];
+    int16_t b[4];
+    int16_t r0[4];
+    int16_t r5[4];
+    int16_t r10[4];
+    int16_t r15[4];
+  } test_vec[] = {
+    { { -INT16_C(31964), -INT16_C(26831), -INT16_C(29216), -INT16_C(27706) },
+      { -INT16_C( 2169),  INT16_C(13726), -INT16_C(20732),  INT16_C( 6989) },
+      { -INT16_C( 2169),  INT16_C(13726), -INT16_C(20732),  INT16_C( 6989) },
+      { -INT16_C( 3868), -INT16_C(19503), -INT16_C( 8064),  INT16_C(27046) },
+      {  INT16_C( 7972),  INT16_C(31537),  INT16_C( 4576),  INT16_C(14278) },
+      { -INT16_C(31964),  INT16_C( 5937),  INT16_C( 3552), -INT16_C(27706) } },
+    { {  INT16_C(23143), -INT16_C(19487),  INT16_C(12782),  INT16_C(30838) },
+      {  INT16_C( 7304), -INT16_C(21504),  INT16_C(17612),  INT16_C( 5938) },
+      {  INT16_C( 7304), -INT16_C(21504),  INT16_C(17612),  INT16_C( 5938) },
+      { -INT16_C(28409), -INT16_C(32767), -INT16_C(26226), -INT16_C( 6570) },
+      {  INT16_C( 8807),  INT16_C(  993),  INT16_C(12782), -INT16_C(14218) },
+      {  INT16_C(23143),  INT16_C(13281),  INT16_C(12782),  INT16_C(30838) } },
+    { {  INT16_C( 4186), -INT16_C(12775), -INT16_C( 3168), -INT16_C(32627) },
+      {  INT16_C(29399),  INT16_C(19912),  INT16_C(15422), -INT16_C( 5657) },
+      {  INT16_C(29399),  INT16_C(19912),  INT16_C(15422), -INT16_C( 5657) },
+      {  INT16_C(23290), -INT16_C(18151), -INT16_C(30784),  INT16_C(15597) },
+      {  INT16_C(23642),  INT16_C( 8729), -INT16_C( 1120), -INT16_C(25459) },
+      { -INT16_C(28582),  INT16_C(19993),  INT16_C(29600), -INT16_C(32627) } },
+    { { -INT16_C(12491), -INT16_C( 4807),  INT16_C(18086), -INT16_C(30639) },
+      { -INT16_C( 4432), -INT16_C(27366), -INT16_C( 9795), -INT16_C( 2963) },
+      { -INT16_C( 4432), -INT16_C(27366), -INT16_C( 9795), -INT16_C( 2963) },
+      { -INT16_C(10731), -INT16_C(23719),  INT16_C(14246), -INT16_C(29263) },
+      { -INT16_C(15563),  INT16_C(26937), -INT16_C( 2394), -INT16_C(19375) },
+      {  INT16_C(20277),  INT16_C(27961), -INT16_C(14682), -INT16_C(30639) } },
+    { {  INT16_C(10193),  INT16_C( 7831), -INT16_C(23171),  INT16_C(21725) },
+      {  INT16_C(31230), -INT16_C( 5597),  INT16_C(19016),  INT16_C(29270) },
+      {  INT16_C(31230), -INT16_C( 5597),  INT16_C(19016),  INT16_C(29270) },
+      {  INT16_C(16337),  INT16_C(17527),  INT16_C(18717),  INT16_C(19165) },
+      { -INT16_C( 1071), -INT16_C(29033),  INT16_C( 8573),  INT16_C(22749) },
+      {  INT16_C(10193), -INT16_C(24937),  INT16_C( 9597),  INT16_C(21725) } },
+    { {  INT16_C(27927),  INT16_C( 6447), -INT16_C( 2910),  INT16_C(12186) },
+      {  INT16_C(11086),  INT16_C(27898),  INT16_C(24193),  INT16_C(12824) },
+      {  INT16_C(11086),  INT16_C(27898),  INT16_C(24193),  INT16_C(12824) },
+      {  INT16_C(27095), -INT16_C(24753), -INT16_C(12254),  INT16_C(17178) },
+      {  INT16_C(14615), -INT16_C( 5841),  INT16_C( 1186),  INT16_C(25498) },
+      {  INT16_C(27927),  INT16_C( 6447), -INT16_C( 2910),  INT16_C(12186) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4_t a = simde_vld1_s16(test_vec[i].a);
+    simde_int16x4_t b = simde_vld1_s16(test_vec[i].b);
+
+    simde_int16x4_t r0 = simde_vsli_n_s16(a, b, 0);
+    simde_int16x4_t r5 = simde_vsli_n_s16(a, b, 5);
+    simde_int16x4_t r10 = simde_vsli_n_s16(a, b, 10);
+    simde_int16x4_t r15 = simde_vsli_n_s16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_i16x4(r0, simde_vld1_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x4(r5, simde_vld1_s16(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i16x4(r10, simde_vld1_s16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i16x4(r15, simde_vld1_s16(test_vec[i].r15));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsli_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t b[2];
+    int32_t r0[2];
+    int32_t r11[2];
+    int32_t r22[2];
+    int32_t r31[2];
+  } test_vec[] = {
+    { {  INT32_C( 929966458), -INT32_C(2009194768) },
+      { -INT32_C( 640651998),  INT32_C(1402769446) },
+      { -INT32_C( 640651998),  INT32_C(1402769446) },
+      { -INT32_C(2090266246), -INT32_C( 461293840) },
+      {  INT32_C(1219373434),  INT32_C( 163454704) },
+      {  INT32_C( 929966458),  INT32_C( 138288880) } },
+    { { -INT32_C(1019778435),  INT32_C(1240352352) },
+      {  INT32_C( 409754165), -INT32_C(1495350529) },
+      {  INT32_C( 409754165), -INT32_C(1495350529) },
+      {  INT32_C(1657907837), -INT32_C( 166199712) },
+      { -INT32_C(1921553795), -INT32_C(1074903456) },
+      { -INT32_C(1019778435), -INT32_C( 907131296) } },
+    { {  INT32_C( 600135940), -INT32_C( 789871388) },
+      {  INT32_C(1919744786),  INT32_C(1435033740) },
+      {  INT32_C(1919744786),  INT32_C(1435033740) },
+      {  INT32_C(1742246148),  INT32_C(1191470308) },
+      { -INT32_C( 997893884),  INT32_C( 590054628) },
+      {  INT32_C( 600135940),  INT32_C(1357612260) } },
+    { {  INT32_C( 612726540),  INT32_C(1381758027) },
+      {  INT32_C( 349500098), -INT32_C(1770890629) },
+      {  INT32_C( 349500098), -INT32_C(1770890629) },
+      { -INT32_C(1483335924), -INT32_C(1831609269) },
+      { -INT32_C(1333430516), -INT32_C(1629752245) },
+      {  INT32_C( 612726540), -INT32_C( 765725621) } },
+    { {  INT32_C(1856658867),  INT32_C(1466461258) },
+      {  INT32_C(1255312997), -INT32_C(1935226867) },
+      {  INT32_C(1255312997), -INT32_C(1935226867) },
+      { -INT32_C(1804390989),  INT32_C( 910191690) },
+      { -INT32_C(1721082445),  INT32_C(  57175114) },
+      { -INT32_C( 290824781), -INT32_C( 681022390) } },
+    { {  INT32_C( 525610608), -INT32_C( 575441637) },
+      {  INT32_C( 389534723),  INT32_C( 363624859) },
+      {  INT32_C( 389534723),  INT32_C( 363624859) },
+      { -INT32_C(1096802704),  INT32_C(1674370331) },
+      {  INT32_C(  13905520),  INT32_C(1727231259) },
+      { -INT32_C(1621873040), -INT32_C( 575441637) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t a = simde_vld1_s32(test_vec[i].a);
+    simde_int32x2_t b = simde_vld1_s32(test_vec[i].b);
+
+    simde_int32x2_t r0 = simde_vsli_n_s32(a, b, 0);
+    simde_int32x2_t r11 = simde_vsli_n_s32(a, b, 11);
+    simde_int32x2_t r22 = simde_vsli_n_s32(a, b, 22);
+    simde_int32x2_t r31 = simde_vsli_n_s32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_i32x2(r0, simde_vld1_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x2(r11, simde_vld1_s32(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_i32x2(r22, simde_vld1_s32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_i32x2(r31, simde_vld1_s32(test_vec[i].r31));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsli_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[1];
+    int64_t b[1];
+    int64_t r0[1];
+    int64_t r21[1];
+    int64_t r42[1];
+    int64_t r63[1];
+  } test_vec[] = {
+    { {  INT64_C(5797009834867406470) },
+      {  INT64_C(3041112481264417542) },
+      {  INT64_C(3041112481264417542) },
+      {  INT64_C(8506728737660188294) },
+      {  INT64_C(1651723454803064454) },
+      {  INT64_C(5797009834867406470) } },
+    { { -INT64_C(3593395720925181624) },
+      { -INT64_C(6989916784494706486) },
+      { -INT64_C(6989916784494706486) },
+      {  INT64_C(8574665537011353928) },
+      { -INT64_C(7204869205704275640) },
+      {  INT64_C(5629976315929594184) } },
+    { {  INT64_C(4029107439891286864) },
+      { -INT64_C( 423577221541560248) },
+      { -INT64_C( 423577221541560248) },
+      { -INT64_C(2856440842697405616) },
+      {  INT64_C(5044352496514534224) },
+      {  INT64_C(4029107439891286864) } },
+    { { -INT64_C(3319650478347807926) },
+      {  INT64_C(7080478919726693747) },
+      {  INT64_C(7080478919726693747) },
+      {  INT64_C(4758121655706817354) },
+      { -INT64_C(3605747801941634230) },
+      { -INT64_C(3319650478347807926) } },
+    { {  INT64_C(4704615837255775324) },
+      {  INT64_C(4605771104745027560) },
+      {  INT64_C(4605771104745027560) },
+      { -INT64_C(8261041256540490660) },
+      {  INT64_C(6331959017061921884) },
+      {  INT64_C(4704615837255775324) } },
+    { { -INT64_C( 259026528295897547) },
+      { -INT64_C(7712407818175125255) },
+      { -INT64_C(7712407818175125255) },
+      { -INT64_C(4723617139131075019) },
+      { -INT64_C(1755307922071144907) },
+      { -INT64_C( 259026528295897547) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1_t a = simde_vld1_s64(test_vec[i].a);
+    simde_int64x1_t b = simde_vld1_s64(test_vec[i].b);
+
+    simde_int64x1_t r0 = simde_vsli_n_s64(a, b, 0);
+    simde_int64x1_t r21 = simde_vsli_n_s64(a, b, 21);
+    simde_int64x1_t r42 = simde_vsli_n_s64(a, b, 42);
+    simde_int64x1_t r63 = simde_vsli_n_s64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_i64x1(r0, simde_vld1_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x1(r21, simde_vld1_s64(test_vec[i].r21));
+    simde_test_arm_neon_assert_equal_i64x1(r42, simde_vld1_s64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_i64x1(r63, simde_vld1_s64(test_vec[i].r63));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsli_n_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[8];
+    uint8_t b[8];
+    uint8_t r0[8];
+    uint8_t r3[8];
+    uint8_t r5[8];
+    uint8_t r7[8];
+  } test_vec[] = {
+    { { UINT8_C(132), UINT8_C(222), UINT8_C(242), UINT8_C(157), UINT8_C( 23), UINT8_C( 59), UINT8_C(  3), UINT8_C( 37) },
+      { UINT8_C(201), UINT8_C( 91), UINT8_C( 58), UINT8_C(168), UINT8_C(253), UINT8_C(212), UINT8_C( 56), UINT8_C(  7) },
+      { UINT8_C(201), UINT8_C( 91), UINT8_C( 58), UINT8_C(168), UINT8_C(253), UINT8_C(212), UINT8_C( 56), UINT8_C(  7) },
+      { UINT8_C( 76), UINT8_C(222), UINT8_C(210), UINT8_C( 69), UINT8_C(239), UINT8_C(163), UINT8_C(195), UINT8_C( 61) },
+      { UINT8_C( 36), UINT8_C(126), UINT8_C( 82), UINT8_C( 29), UINT8_C(183), UINT8_C(155), UINT8_C(  3), UINT8_C(229) },
+      { UINT8_C(132), UINT8_C(222), UINT8_C(114), UINT8_C( 29), UINT8_C(151), UINT8_C( 59), UINT8_C(  3), UINT8_C(165) } },
+    { { UINT8_C(250), UINT8_C( 20), UINT8_C(170), UINT8_C( 31), UINT8_C( 69), UINT8_C(176), UINT8_C(206), UINT8_C( 28) },
+      { UINT8_C(168), UINT8_C(171), UINT8_C(220), UINT8_C(191), UINT8_C(123), UINT8_C(240), UINT8_C(119), UINT8_C(125) },
+      { UINT8_C(168), UINT8_C(171), UINT8_C(220), UINT8_C(191), UINT8_C(123), UINT8_C(240), UINT8_C(119), UINT8_C(125) },
+      { UINT8_C( 66), UINT8_C( 92), UINT8_C(226),    UINT8_MAX, UINT8_C(221), UINT8_C(128), UINT8_C(190), UINT8_C(236) },
+      { UINT8_C( 26), UINT8_C(116), UINT8_C(138),    UINT8_MAX, UINT8_C(101), UINT8_C( 16), UINT8_C(238), UINT8_C(188) },
+      { UINT8_C(122), UINT8_C(148), UINT8_C( 42), UINT8_C(159), UINT8_C(197), UINT8_C( 48), UINT8_C(206), UINT8_C(156) } },
+    { { UINT8_C(104), UINT8_C(  1), UINT8_C(103), UINT8_C(150), UINT8_C(  9), UINT8_C(241), UINT8_C(152), UINT8_C( 44) },
+      { UINT8_C(195), UINT8_C(250), UINT8_C( 98), UINT8_C(197), UINT8_C(171), UINT8_C(185), UINT8_C( 13), UINT8_C( 74) },
+      { UINT8_C(195), UINT8_C(250), UINT8_C( 98), UINT8_C(197), UINT8_C(171), UINT8_C(185), UINT8_C( 13), UINT8_C( 74) },
+      { UINT8_C( 24), UINT8_C(209), UINT8_C( 23), UINT8_C( 46), UINT8_C( 89), UINT8_C(201), UINT8_C(104), UINT8_C( 84) },
+      { UINT8_C(104), UINT8_C( 65), UINT8_C( 71), UINT8_C(182), UINT8_C(105), UINT8_C( 49), UINT8_C(184), UINT8_C( 76) },
+      { UINT8_C(232), UINT8_C(  1), UINT8_C(103), UINT8_C(150), UINT8_C(137), UINT8_C(241), UINT8_C(152), UINT8_C( 44) } },
+    { { UINT8_C( 14), UINT8_C( 10), UINT8_C(227), UINT8_C(207), UINT8_C(189), UINT8_C(171), UINT8_C( 99), UINT8_C( 18) },
+      { UINT8_C(104), UINT8_C(207), UINT8_C(143), UINT8_C( 16), UINT8_C( 84), UINT8_C(216), UINT8_C(130), UINT8_C( 25) },
+      { UINT8_C(104), UINT8_C(207), UINT8_C(143), UINT8_C( 16), UINT8_C( 84), UINT8_C(216), UINT8_C(130), UINT8_C( 25) },
+      { UINT8_C( 70), UINT8_C(122), UINT8_C(123), UINT8_C(135), UINT8_C(165), UINT8_C(195), UINT8_C( 19), UINT8_C(202) },
+      { UINT8_C( 14), UINT8_C(234), UINT8_C(227), UINT8_C( 15), UINT8_C(157), UINT8_C( 11), UINT8_C( 67), UINT8_C( 50) },
+      { UINT8_C( 14), UINT8_C(138), UINT8_C(227), UINT8_C( 79), UINT8_C( 61), UINT8_C( 43), UINT8_C( 99), UINT8_C(146) } },
+    { { UINT8_C(141), UINT8_C(136), UINT8_C( 37), UINT8_C(118), UINT8_C(136), UINT8_C(128), UINT8_C(  7), UINT8_C(  7) },
+      { UINT8_C( 55), UINT8_C( 29), UINT8_C(189), UINT8_C( 40), UINT8_C(141), UINT8_C( 52), UINT8_C(230), UINT8_C( 57) },
+      { UINT8_C( 55), UINT8_C( 29), UINT8_C(189), UINT8_C( 40), UINT8_C(141), UINT8_C( 52), UINT8_C(230), UINT8_C( 57) },
+      { UINT8_C(189), UINT8_C(232), UINT8_C(237), UINT8_C( 70), UINT8_C(104), UINT8_C(160), UINT8_C( 55), UINT8_C(207) },
+      { UINT8_C(237), UINT8_C(168), UINT8_C(165), UINT8_C( 22), UINT8_C(168), UINT8_C(128), UINT8_C(199), UINT8_C( 39) },
+      { UINT8_C(141), UINT8_C(136), UINT8_C(165), UINT8_C(118), UINT8_C(136), UINT8_C(  0), UINT8_C(  7), UINT8_C(135) } },
+    { { UINT8_C( 29), UINT8_C(219), UINT8_C(245), UINT8_C(233), UINT8_C( 10), UINT8_C( 92), UINT8_C(131), UINT8_C(215) },
+      { UINT8_C(141), UINT8_C(242), UINT8_C( 40), UINT8_C( 83), UINT8_C(211), UINT8_C(145), UINT8_C(176), UINT8_C(238) },
+      { UINT8_C(141), UINT8_C(242), UINT8_C( 40), UINT8_C( 83), UINT8_C(211), UINT8_C(145), UINT8_C(176), UINT8_C(238) },
+      { UINT8_C(109), UINT8_C(147), UINT8_C( 69), UINT8_C(153), UINT8_C(154), UINT8_C(140), UINT8_C(131), UINT8_C(119) },
+      { UINT8_C(189), UINT8_C( 91), UINT8_C( 21), UINT8_C(105), UINT8_C(106), UINT8_C( 60), UINT8_C(  3), UINT8_C(215) },
+      { UINT8_C(157), UINT8_C( 91), UINT8_C(117), UINT8_C(233), UINT8_C(138), UINT8_C(220), UINT8_C(  3), UINT8_C( 87) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_uint8x8_t b = simde_vld1_u8(test_vec[i].b);
+
+    simde_uint8x8_t r0 = simde_vsli_n_u8(a, b, 0);
+    simde_uint8x8_t r3 = simde_vsli_n_u8(a, b, 3);
+    simde_uint8x8_t r5 = simde_vsli_n_u8(a, b, 5);
+    simde_uint8x8_t r7 = simde_vsli_n_u8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_u8x8(r0, simde_vld1_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x8(r3, simde_vld1_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x8(r5, simde_vld1_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x8(r7, simde_vld1_u8(test_vec[i].r7));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsli_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[4];
+    uint16_t b[4];
+    uint16_t r0[4];
+    uint16_t r5[4];
+    uint16_t r10[4];
+    uint16_t r15[4];
+  } test_vec[] = {
+    { { UINT16_C(23538), UINT16_C(33969), UINT16_C(65306), UINT16_C(42248) },
+      { UINT16_C(56230), UINT16_C(21088), UINT16_C(64764), UINT16_C(11064) },
+      { UINT16_C(56230), UINT16_C(21088), UINT16_C(64764), UINT16_C(11064) },
+      { UINT16_C(29906), UINT16_C(19473), UINT16_C(40858), UINT16_C(26376) },
+      { UINT16_C(39922), UINT16_C(32945), UINT16_C(62234), UINT16_C(57608) },
+      { UINT16_C(23538), UINT16_C( 1201), UINT16_C(32538), UINT16_C( 9480) } },
+    { { UINT16_C(28347), UINT16_C(26466), UINT16_C(51147), UINT16_C(57175) },
+      { UINT16_C(37916), UINT16_C(19526), UINT16_C(43670), UINT16_C(10584) },
+      { UINT16_C(37916), UINT16_C(19526), UINT16_C(43670), UINT16_C(10584) },
+      { UINT16_C(33691), UINT16_C(35010), UINT16_C(21195), UINT16_C(11031) },
+      { UINT16_C(29371), UINT16_C( 7010), UINT16_C(23499), UINT16_C(25431) },
+      { UINT16_C(28347), UINT16_C(26466), UINT16_C(18379), UINT16_C(24407) } },
+    { { UINT16_C(49405), UINT16_C(60011), UINT16_C(40754), UINT16_C(19599) },
+      { UINT16_C(62434), UINT16_C(11561), UINT16_C(61783), UINT16_C(48336) },
+      { UINT16_C(62434), UINT16_C(11561), UINT16_C(61783), UINT16_C(48336) },
+      { UINT16_C(31837), UINT16_C(42283), UINT16_C(10994), UINT16_C(39439) },
+      { UINT16_C(35069), UINT16_C(42603), UINT16_C(24370), UINT16_C(16527) },
+      { UINT16_C(16637), UINT16_C(60011), UINT16_C(40754), UINT16_C(19599) } },
+    { { UINT16_C( 2848), UINT16_C(60824), UINT16_C(35569), UINT16_C(11321) },
+      { UINT16_C(42172), UINT16_C(14403), UINT16_C(41955), UINT16_C(51259) },
+      { UINT16_C(42172), UINT16_C(14403), UINT16_C(41955), UINT16_C(51259) },
+      { UINT16_C(38784), UINT16_C( 2168), UINT16_C(31857), UINT16_C( 1913) },
+      { UINT16_C(62240), UINT16_C( 3480), UINT16_C(36593), UINT16_C(60473) },
+      { UINT16_C( 2848), UINT16_C(60824), UINT16_C(35569), UINT16_C(44089) } },
+    { { UINT16_C(10865), UINT16_C(28617), UINT16_C(22619), UINT16_C(54427) },
+      { UINT16_C(63183), UINT16_C(25711), UINT16_C(41756), UINT16_C(53222) },
+      { UINT16_C(63183), UINT16_C(25711), UINT16_C(41756), UINT16_C(53222) },
+      { UINT16_C(55793), UINT16_C(36329), UINT16_C(25499), UINT16_C(64731) },
+      { UINT16_C(15985), UINT16_C(49097), UINT16_C(28763), UINT16_C(39067) },
+      { UINT16_C(43633), UINT16_C(61385), UINT16_C(22619), UINT16_C(21659) } },
+    { { UINT16_C(49423), UINT16_C( 8157), UINT16_C(14034), UINT16_C(35907) },
+      { UINT16_C( 1765), UINT16_C(45554), UINT16_C(54076), UINT16_C(35729) },
+      { UINT16_C( 1765), UINT16_C(45554), UINT16_C(54076), UINT16_C(35729) },
+      { UINT16_C(56495), UINT16_C(15965), UINT16_C(26514), UINT16_C(29219) },
+      { UINT16_C(38159), UINT16_C(52189), UINT16_C(62162), UINT16_C(17475) },
+      { UINT16_C(49423), UINT16_C( 8157), UINT16_C(14034), UINT16_C(35907) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4_t a = simde_vld1_u16(test_vec[i].a);
+    simde_uint16x4_t b = simde_vld1_u16(test_vec[i].b);
+
+    simde_uint16x4_t r0 = simde_vsli_n_u16(a, b, 0);
+    simde_uint16x4_t r5 = simde_vsli_n_u16(a, b, 5);
+    simde_uint16x4_t r10 = simde_vsli_n_u16(a, b, 10);
+    simde_uint16x4_t r15 = simde_vsli_n_u16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_u16x4(r0, simde_vld1_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x4(r5, simde_vld1_u16(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u16x4(r10, simde_vld1_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x4(r15, simde_vld1_u16(test_vec[i].r15));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsli_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    uint32_t b[2];
+    uint32_t r0[2];
+    uint32_t r11[2];
+    uint32_t r22[2];
+    uint32_t r31[2];
+  } test_vec[] = {
+    { { UINT32_C( 487811835), UINT32_C(1610436237) },
+      { UINT32_C(3875906442), UINT32_C( 979631831) },
+      { UINT32_C(3875906442), UINT32_C( 979631831) },
+      { UINT32_C( 756830971), UINT32_C( 536264333) },
+      { UINT32_C(3801311995), UINT32_C(3053276813) },
+      { UINT32_C( 487811835), UINT32_C(3757919885) } },
+    { { UINT32_C( 926765305), UINT32_C(2375414536) },
+      { UINT32_C( 530858424), UINT32_C( 386586255) },
+      { UINT32_C( 530858424), UINT32_C( 386586255) },
+      { UINT32_C( 571326713), UINT32_C(1454668552) },
+      { UINT32_C(1849512185), UINT32_C(2748707592) },
+      { UINT32_C( 926765305), UINT32_C(2375414536) } },
+    { { UINT32_C(3739437560), UINT32_C(3632163112) },
+      { UINT32_C(2681969139), UINT32_C( 431641345) },
+      { UINT32_C(2681969139), UINT32_C( 431641345) },
+      { UINT32_C(3704592888), UINT32_C(3533179176) },
+      { UINT32_C(2095270392), UINT32_C(3229509928) },
+      { UINT32_C(3739437560), UINT32_C(3632163112) } },
+    { { UINT32_C(3073692156), UINT32_C( 977382875) },
+      { UINT32_C(1462240879), UINT32_C(2094546675) },
+      { UINT32_C(1462240879), UINT32_C(2094546675) },
+      { UINT32_C(1077115388), UINT32_C(3254230491) },
+      { UINT32_C(2616513020), UINT32_C(3166809563) },
+      { UINT32_C(3073692156), UINT32_C(3124866523) } },
+    { { UINT32_C(1819536247), UINT32_C(1513025129) },
+      { UINT32_C(2611290359), UINT32_C(2504468079) },
+      { UINT32_C(2611290359), UINT32_C(2504468079) },
+      { UINT32_C( 688372599), UINT32_C( 959676009) },
+      { UINT32_C(1039395703), UINT32_C(2616127081) },
+      { UINT32_C(3967019895), UINT32_C(3660508777) } },
+    { { UINT32_C(1774840428), UINT32_C( 232066391) },
+      { UINT32_C(2450679444), UINT32_C(1940467521) },
+      { UINT32_C(2450679444), UINT32_C(1940467521) },
+      { UINT32_C(2469700204), UINT32_C(1232735575) },
+      { UINT32_C(2768890476), UINT32_C(3495234903) },
+      { UINT32_C(1774840428), UINT32_C(2379550039) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t b = simde_vld1_u32(test_vec[i].b);
+
+    simde_uint32x2_t r0 = simde_vsli_n_u32(a, b, 0);
+    simde_uint32x2_t r11 = simde_vsli_n_u32(a, b, 11);
+    simde_uint32x2_t r22 = simde_vsli_n_u32(a, b, 22);
+    simde_uint32x2_t r31 = simde_vsli_n_u32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_u32x2(r0, simde_vld1_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x2(r11, simde_vld1_u32(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_u32x2(r22, simde_vld1_u32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_u32x2(r31, simde_vld1_u32(test_vec[i].r31));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsli_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[1];
+    uint64_t b[1];
+    uint64_t r0[1];
+    uint64_t r21[1];
+    uint64_t r42[1];
+    uint64_t r63[1];
+  } test_vec[] = {
+    { { UINT64_C( 1160948304118448861) },
+      { UINT64_C(11570656793829070505) },
+      { UINT64_C(11570656793829070505) },
+      { UINT64_C( 7032868393677128413) },
+      { UINT64_C(10473864567939302109) },
+      { UINT64_C(10384320340973224669) } },
+    { { UINT64_C( 8682481709413120783) },
+      { UINT64_C(15037353169230852643) },
+      { UINT64_C(15037353169230852643) },
+      { UINT64_C( 2389092730826734351) },
+      { UINT64_C( 7334269347527211791) },
+      { UINT64_C(17905853746267896591) } },
+    { { UINT64_C( 4446360107220662791) },
+      { UINT64_C(13361200320263509547) },
+      { UINT64_C(13361200320263509547) },
+      { UINT64_C(11300029040346987015) },
+      { UINT64_C(10473311104642251271) },
+      { UINT64_C(13669732144075438599) } },
+    { { UINT64_C( 1992366581540035674) },
+      { UINT64_C( 5886463894071065132) },
+      { UINT64_C( 5886463894071065132) },
+      { UINT64_C( 8586579532218997850) },
+      { UINT64_C( 1362535534824365146) },
+      { UINT64_C( 1992366581540035674) } },
+    { { UINT64_C( 6906363195816960268) },
+      { UINT64_C(10701732318566369517) },
+      { UINT64_C(10701732318566369517) },
+      { UINT64_C( 1945043667829940492) },
+      { UINT64_C(15934778626927517964) },
+      { UINT64_C(16129735232671736076) } },
+    { { UINT64_C(15134978903294559166) },
+      { UINT64_C( 3688855337382503607) },
+      { UINT64_C( 3688855337382503607) },
+      { UINT64_C( 5499334522705494974) },
+      { UINT64_C(17551336025239274430) },
+      { UINT64_C(15134978903294559166) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1_t a = simde_vld1_u64(test_vec[i].a);
+    simde_uint64x1_t b = simde_vld1_u64(test_vec[i].b);
+
+    simde_uint64x1_t r0 = simde_vsli_n_u64(a, b, 0);
+    simde_uint64x1_t r21 = simde_vsli_n_u64(a, b, 21);
+    simde_uint64x1_t r42 = simde_vsli_n_u64(a, b, 42);
+    simde_uint64x1_t r63 = simde_vsli_n_u64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_u64x1(r0, simde_vld1_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x1(r21, simde_vld1_u64(test_vec[i].r21));
+    simde_test_arm_neon_assert_equal_u64x1(r42, simde_vld1_u64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_u64x1(r63, simde_vld1_u64(test_vec[i].r63));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r0[16];
+    int8_t r3[16];
+    int8_t r5[16];
+    int8_t r7[16];
+  } test_vec[] = {
+    { {  INT8_C(102), -INT8_C( 55),  INT8_C( 10),  INT8_C( 32), -INT8_C( 46),  INT8_C( 91),  INT8_C(112),  INT8_C( 95),
+           INT8_C(107), -INT8_C( 23),  INT8_C( 19), -INT8_C(117), -INT8_C( 72),  INT8_C( 93),  INT8_C( 82), -INT8_C( 83) },
+      { -INT8_C( 51),  INT8_C( 18),  INT8_C( 84),  INT8_C( 24), -INT8_C( 44),  INT8_C(105),  INT8_C( 25),  INT8_C(117),
+           INT8_C( 56), -INT8_C( 84),  INT8_C( 19), -INT8_C( 13), -INT8_C( 75), -INT8_C( 22),  INT8_C( 24),  INT8_C( 92) },
+      { -INT8_C( 51),  INT8_C( 18),  INT8_C( 84),  INT8_C( 24), -INT8_C( 44),  INT8_C(105),  INT8_C( 25),  INT8_C(117),
+           INT8_C( 56), -INT8_C( 84),  INT8_C( 19), -INT8_C( 13), -INT8_C( 75), -INT8_C( 22),  INT8_C( 24),  INT8_C( 92) },
+      {  INT8_C(110), -INT8_C(111), -INT8_C( 94), -INT8_C( 64), -INT8_C( 94),  INT8_C( 75), -INT8_C( 56), -INT8_C( 81),
+          -INT8_C( 61),  INT8_C( 97), -INT8_C(101), -INT8_C(101), -INT8_C( 88),  INT8_C( 85), -INT8_C( 62), -INT8_C( 27) },
+      { -INT8_C( 90),  INT8_C( 73), -INT8_C(118),  INT8_C(  0), -INT8_C(110),  INT8_C( 59),  INT8_C( 48), -INT8_C( 65),
+           INT8_C( 11), -INT8_C(119),  INT8_C(115),  INT8_C(107), -INT8_C( 72),  INT8_C( 93),  INT8_C( 18), -INT8_C(115) },
+      { -INT8_C( 26),  INT8_C( 73),  INT8_C( 10),  INT8_C( 32),  INT8_C( 82), -INT8_C( 37), -INT8_C( 16), -INT8_C( 33),
+           INT8_C(107),  INT8_C(105), -INT8_C(109), -INT8_C(117), -INT8_C( 72),  INT8_C( 93),  INT8_C( 82),  INT8_C( 45) } },
+    { { -INT8_C(  1), -INT8_C(100),  INT8_C( 55), -INT8_C(122),  INT8_C( 77),  INT8_C( 57),  INT8_C( 92),  INT8_C( 25),
+           INT8_C( 13),  INT8_C( 76),  INT8_C(  8), -INT8_C( 60), -INT8_C( 94), -INT8_C( 58), -INT8_C( 83), -INT8_C(113) },
+      { -INT8_C(109), -INT8_C(124), -INT8_C( 21), -INT8_C( 72),  INT8_C( 32), -INT8_C(  4), -INT8_C( 65), -INT8_C(121),
+           INT8_C( 73), -INT8_C( 91), -INT8_C( 27),  INT8_C(111),  INT8_C(119),  INT8_C(  2), -INT8_C( 25),  INT8_C(  7) },
+      { -INT8_C(109), -INT8_C(124), -INT8_C( 21), -INT8_C( 72),  INT8_C( 32), -INT8_C(  4), -INT8_C( 65), -INT8_C(121),
+           INT8_C( 73), -INT8_C( 91), -INT8_C( 27),  INT8_C(111),  INT8_C(119),  INT8_C(  2), -INT8_C( 25),  INT8_C(  7) },
+      { -INT8_C( 97),  INT8_C( 36),  INT8_C( 95), -INT8_C( 58),  INT8_C(  5), -INT8_C( 31), -INT8_C(  4),  INT8_C( 57),
+           INT8_C( 77),  INT8_C( 44),  INT8_C( 40),  INT8_C(124), -INT8_C( 70),  INT8_C( 22),  INT8_C( 61),  INT8_C( 63) },
+      {     INT8_MAX, -INT8_C(100),  INT8_C(119),  INT8_C(  6),  INT8_C( 13), -INT8_C(103), -INT8_C(  4), -INT8_C(  7),
+           INT8_C( 45), -INT8_C( 84), -INT8_C( 88), -INT8_C( 28), -INT8_C( 30),  INT8_C( 70), -INT8_C( 19), -INT8_C( 17) },
+      { -INT8_C(  1),  INT8_C( 28), -INT8_C( 73),  INT8_C(  6),  INT8_C( 77),  INT8_C( 57), -INT8_C( 36), -INT8_C(103),
+          -INT8_C(115), -INT8_C( 52), -INT8_C(120), -INT8_C( 60), -INT8_C( 94),  INT8_C( 70), -INT8_C( 83), -INT8_C(113) } },
+    { {  INT8_C( 12),  INT8_C( 32), -INT8_C( 83),  INT8_C( 44), -INT8_C( 25), -INT8_C( 25),  INT8_C(111), -INT8_C( 31),
+           INT8_C( 11), -INT8_C( 91),  INT8_C(106),  INT8_C( 28), -INT8_C( 79), -INT8_C( 13), -INT8_C( 58), -INT8_C( 86) },
+      {  INT8_C( 39),  INT8_C( 67), -INT8_C( 43), -INT8_C( 18), -INT8_C(  4), -INT8_C(  6),  INT8_C( 75), -INT8_C( 84),
+           INT8_C( 82),  INT8_C(111), -INT8_C(121),  INT8_C(  3), -INT8_C( 67), -INT8_C( 61), -INT8_C(126),  INT8_C(113) },
+      {  INT8_C( 39),  INT8_C( 67), -INT8_C( 43), -INT8_C( 18), -INT8_C(  4), -INT8_C(  6),  INT8_C( 75), -INT8_C( 84),
+           INT8_C( 82),  INT8_C(111), -INT8_C(121),  INT8_C(  3), -INT8_C( 67), -INT8_C( 61), -INT8_C(126),  INT8_C(113) },
+      {  INT8_C( 60),  INT8_C( 24), -INT8_C( 83),  INT8_C(116), -INT8_C( 25), -INT8_C( 41),  INT8_C( 95),  INT8_C( 97),
+          -INT8_C(109),  INT8_C(125),  INT8_C( 58),  INT8_C( 28), -INT8_C( 23),  INT8_C( 27),  INT8_C( 22), -INT8_C(118) },
+      { -INT8_C( 20),  INT8_C( 96), -INT8_C( 83), -INT8_C( 52), -INT8_C(121),  INT8_C( 71),  INT8_C(111), -INT8_C(127),
+           INT8_C( 75), -INT8_C( 27), -INT8_C( 22),  INT8_C(124), -INT8_C( 79),  INT8_C(115),  INT8_C( 70),  INT8_C( 42) },
+      { -INT8_C(116), -INT8_C( 96), -INT8_C( 83),  INT8_C( 44),  INT8_C(103),  INT8_C(103), -INT8_C( 17),  INT8_C( 97),
+           INT8_C( 11), -INT8_C( 91), -INT8_C( 22), -INT8_C(100), -INT8_C( 79), -INT8_C( 13),  INT8_C( 70), -INT8_C( 86) } },
+    { { -INT8_C( 58),  INT8_C( 29),  INT8_C( 97),  INT8_C( 78),  INT8_C(114), -INT8_C( 69), -INT8_C( 93),  INT8_C( 85),
+           INT8_C(116),  INT8_C( 18),  INT8_C(120), -INT8_C( 29), -INT8_C( 84),  INT8_C( 11),  INT8_C( 83),  INT8_C(101) },
+      { -INT8_C(114),  INT8_C(105), -INT8_C(116),  INT8_C( 67),  INT8_C( 52),  INT8_C(125),  INT8_C( 24), -INT8_C( 79),
+           INT8_C( 90),  INT8_C( 64),  INT8_C(101),  INT8_C( 77), -INT8_C(127),  INT8_C( 38), -INT8_C( 87),  INT8_C( 95) },
+      { -INT8_C(114),  INT8_C(105), -INT8_C(116),  INT8_C( 67),  INT8_C( 52),  INT8_C(125),  INT8_C( 24), -INT8_C( 79),
+           INT8_C( 90),  INT8_C( 64),  INT8_C(101),  INT8_C( 77), -INT8_C(127),  INT8_C( 38), -INT8_C( 87),  INT8_C( 95) },
+      {  INT8_C(118),  INT8_C( 77),  INT8_C( 97),  INT8_C( 30), -INT8_C( 94), -INT8_C( 21), -INT8_C( 61), -INT8_C(115),
+          -INT8_C( 44),  INT8_C(  2),  INT8_C( 40),  INT8_C(107),  INT8_C( 12),  INT8_C( 51),  INT8_C( 75), -INT8_C(  3) },
+      { -INT8_C( 58),  INT8_C( 61), -INT8_C(127),  INT8_C(110), -INT8_C(110), -INT8_C( 69),  INT8_C(  3),  INT8_C( 53),
+           INT8_C( 84),  INT8_C( 18), -INT8_C( 72), -INT8_C( 93),  INT8_C( 44), -INT8_C( 53),  INT8_C( 51), -INT8_C( 27) },
+      {  INT8_C( 70), -INT8_C( 99),  INT8_C( 97), -INT8_C( 50),  INT8_C(114), -INT8_C( 69),  INT8_C( 35), -INT8_C( 43),
+           INT8_C(116),  INT8_C( 18), -INT8_C(  8), -INT8_C( 29), -INT8_C( 84),  INT8_C( 11), -INT8_C( 45), -INT8_C( 27) } },
+    { {  INT8_C(104),  INT8_C( 32), -INT8_C(  2),  INT8_C( 93),  INT8_C( 44),  INT8_C(118), -INT8_C(108),  INT8_C( 92),
+           INT8_C( 33), -INT8_C( 16),  INT8_C(106), -INT8_C( 26), -INT8_C(119), -INT8_C( 87),  INT8_C(118), -INT8_C( 17) },
+      { -INT8_C( 24),  INT8_C(118),  INT8_C( 23), -INT8_C( 67),  INT8_C( 65), -INT8_C(  4),  INT8_C(115),  INT8_C(108),
+           INT8_C( 76),  INT8_C(108), -INT8_C( 27),  INT8_C(100), -INT8_C( 19),  INT8_C( 53),  INT8_C( 89), -INT8_C( 92) },
+      { -INT8_C( 24),  INT8_C(118),  INT8_C( 23), -INT8_C( 67),  INT8_C( 65), -INT8_C(  4),  INT8_C(115),  INT8_C(108),
+           INT8_C( 76),  INT8_C(108), -INT8_C( 27),  INT8_C(100), -INT8_C( 19),  INT8_C( 53),  INT8_C( 89), -INT8_C( 92) },
+      {  INT8_C( 64), -INT8_C( 80), -INT8_C( 66), -INT8_C( 19),  INT8_C( 12), -INT8_C( 26), -INT8_C(100),  INT8_C(100),
+           INT8_C( 97),  INT8_C( 96),  INT8_C( 42),  INT8_C( 38),  INT8_C(105), -INT8_C( 87), -INT8_C( 50),  INT8_C( 39) },
+      {  INT8_C(  8), -INT8_C( 64), -INT8_C(  2), -INT8_C( 67),  INT8_C( 44), -INT8_C(106),  INT8_C(116), -INT8_C(100),
+          -INT8_C(127), -INT8_C(112), -INT8_C( 86), -INT8_C(122), -INT8_C( 87), -INT8_C( 87),  INT8_C( 54), -INT8_C(113) },
+      {  INT8_C(104),  INT8_C( 32), -INT8_C(  2), -INT8_C( 35), -INT8_C( 84),  INT8_C(118), -INT8_C(108),  INT8_C( 92),
+           INT8_C( 33),  INT8_C(112), -INT8_C( 22),  INT8_C(102), -INT8_C(119), -INT8_C( 87), -INT8_C( 10),  INT8_C(111) } },
+    { {  INT8_C( 88), -INT8_C( 65), -INT8_C( 12), -INT8_C(103),  INT8_C(126),  INT8_C( 23),  INT8_C( 69),  INT8_C( 63),
+           INT8_C( 78),  INT8_C(124), -INT8_C( 57),  INT8_C( 81),  INT8_C( 34),  INT8_C(  9),  INT8_C( 30),  INT8_C(110) },
+      {  INT8_C(108), -INT8_C( 78), -INT8_C(111),  INT8_C( 92),  INT8_C( 93),  INT8_C( 19),  INT8_C( 24),  INT8_C(  1),
+           INT8_C(125), -INT8_C( 85),  INT8_C( 21), -INT8_C(122), -INT8_C( 41), -INT8_C( 59), -INT8_C( 10), -INT8_C( 62) },
+      {  INT8_C(108), -INT8_C( 78), -INT8_C(111),  INT8_C( 92),  INT8_C( 93),  INT8_C( 19),  INT8_C( 24),  INT8_C(  1),
+           INT8_C(125), -INT8_C( 85),  INT8_C( 21), -INT8_C(122), -INT8_C( 41), -INT8_C( 59), -INT8_C( 10), -INT8_C( 62) },
+      {  INT8_C( 96), -INT8_C(105), -INT8_C(116), -INT8_C( 31), -INT8_C( 18), -INT8_C( 97), -INT8_C( 59),  INT8_C( 15),
+          -INT8_C( 18),  INT8_C( 92), -INT8_C( 81),  INT8_C( 49), -INT8_C( 70),  INT8_C( 41), -INT8_C( 74),  INT8_C( 22) },
+      { -INT8_C(104),  INT8_C( 95),  INT8_C( 52), -INT8_C(103), -INT8_C( 66),  INT8_C(119),  INT8_C(  5),  INT8_C( 63),
+          -INT8_C( 82),  INT8_C(124), -INT8_C( 89), -INT8_C( 47), -INT8_C( 30), -INT8_C( 87), -INT8_C( 34),  INT8_C( 78) },
+      {  INT8_C( 88),  INT8_C( 63), -INT8_C( 12),  INT8_C( 25), -INT8_C(  2), -INT8_C(105),  INT8_C( 69), -INT8_C( 65),
+          -INT8_C( 50), -INT8_C(  4), -INT8_C( 57),  INT8_C( 81), -INT8_C( 94), -INT8_C(119),  INT8_C( 30),  INT8_C(110) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+
+    simde_int8x16_t r0 = simde_vsliq_n_s8(a, b, 0);
+    simde_int8x16_t r3 = simde_vsliq_n_s8(a, b, 3);
+    simde_int8x16_t r5 = simde_vsliq_n_s8(a, b, 5);
+    simde_int8x16_t r7 = simde_vsliq_n_s8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_i8x16(r0, simde_vld1q_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x16(r3, simde_vld1q_s8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_i8x16(r5, simde_vld1q_s8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i8x16(r7, simde_vld1q_s8(test_vec[i].r7));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r0[8];
+    int16_t r5[8];
+    int16_t r10[8];
+    int16_t r15[8];
+  } test_vec[] = {
+    { {  INT16_C(28202),  INT16_C( 7603),  INT16_C(16539), -INT16_C(22472),  INT16_C(  244), -INT16_C( 6241), -INT16_C(22366),  INT16_C(11064) },
+      {  INT16_C(12094), -INT16_C(24911),  INT16_C( 5956), -INT16_C(16310),  INT16_C(17104), -INT16_C(23590),  INT16_C( 3498),  INT16_C( 6198) },
+      {  INT16_C(12094), -INT16_C(24911),  INT16_C( 5956), -INT16_C(16310),  INT16_C(17104), -INT16_C(23590),  INT16_C( 3498),  INT16_C( 6198) },
+      { -INT16_C( 6198), -INT16_C(10701), -INT16_C( 5989),  INT16_C( 2392),  INT16_C(23060),  INT16_C(31583), -INT16_C(19134),  INT16_C( 1752) },
+      { -INT16_C( 1494), -INT16_C(14925),  INT16_C( 4251),  INT16_C(10296),  INT16_C(16628),  INT16_C(27551), -INT16_C(22366), -INT16_C( 9416) },
+      {  INT16_C(28202), -INT16_C(25165),  INT16_C(16539),  INT16_C(10296),  INT16_C(  244),  INT16_C(26527),  INT16_C(10402),  INT16_C(11064) } },
+    { { -INT16_C(31225),  INT16_C(17142), -INT16_C(26241),  INT16_C(20313), -INT16_C( 8859),  INT16_C( 8324),  INT16_C(15614),  INT16_C(23623) },
+      {  INT16_C(23463),  INT16_C( 1358), -INT16_C( 5337),  INT16_C(21562), -INT16_C( 2570),  INT16_C(28626),  INT16_C( 7838), -INT16_C(26414) },
+      {  INT16_C(23463),  INT16_C( 1358), -INT16_C( 5337),  INT16_C(21562), -INT16_C( 2570),  INT16_C(28626),  INT16_C( 7838), -INT16_C(26414) },
+      {  INT16_C(29927), -INT16_C(22058),  INT16_C(25855), -INT16_C(30887), -INT16_C(16699), -INT16_C( 1468), -INT16_C(11298),  INT16_C( 6727) },
+      { -INT16_C(25081),  INT16_C(15094), -INT16_C(25217), -INT16_C( 5287), -INT16_C( 9883),  INT16_C(18564),  INT16_C(30974),  INT16_C(18503) },
+      { -INT16_C(31225),  INT16_C(17142), -INT16_C(26241),  INT16_C(20313),  INT16_C(23909),  INT16_C( 8324),  INT16_C(15614),  INT16_C(23623) } },
+    { { -INT16_C(21658), -INT16_C(18651), -INT16_C( 6808),  INT16_C(30396),  INT16_C(11179),  INT16_C(17257),  INT16_C(18642),  INT16_C(10735) },
+      {  INT16_C( 7429),  INT16_C( 1779),  INT16_C( 8493),  INT16_C(32438),  INT16_C( 4871),  INT16_C(27512),  INT16_C(30201),  INT16_C(20034) },
+      {  INT16_C( 7429),  INT16_C( 1779),  INT16_C( 8493),  INT16_C(32438),  INT16_C( 4871),  INT16_C(27512),  INT16_C(30201),  INT16_C(20034) },
+      { -INT16_C(24410), -INT16_C( 8603),  INT16_C( 9640), -INT16_C(10532),  INT16_C(24811),  INT16_C(28425), -INT16_C(16590), -INT16_C(14257) },
+      {  INT16_C( 5990), -INT16_C(12507), -INT16_C(19096), -INT16_C( 9540),  INT16_C( 8107), -INT16_C( 7319), -INT16_C( 6958),  INT16_C( 2543) },
+      { -INT16_C(21658), -INT16_C(18651), -INT16_C( 6808),  INT16_C(30396), -INT16_C(21589),  INT16_C(17257), -INT16_C(14126),  INT16_C(10735) } },
+    { {  INT16_C( 4818),  INT16_C(32123),  INT16_C( 8028),  INT16_C(30926),  INT16_C(24490),  INT16_C( 7719),  INT16_C(  503),  INT16_C( 7081) },
+      { -INT16_C(16119),  INT16_C(27137),  INT16_C( 2499),  INT16_C(  580), -INT16_C( 8688), -INT16_C(22460), -INT16_C(10857), -INT16_C(28229) },
+      { -INT16_C(16119),  INT16_C(27137),  INT16_C( 2499),  INT16_C(  580), -INT16_C( 8688), -INT16_C(22460), -INT16_C(10857), -INT16_C(28229) },
+      {  INT16_C( 8498),  INT16_C(16443),  INT16_C(14460),  INT16_C(18574), -INT16_C(15862),  INT16_C( 2183), -INT16_C(19721),  INT16_C(14185) },
+      {  INT16_C( 9938),  INT16_C( 1403),  INT16_C( 3932),  INT16_C( 4302),  INT16_C(17322),  INT16_C( 4647),  INT16_C(24055), -INT16_C( 4183) },
+      { -INT16_C(27950), -INT16_C(  645), -INT16_C(24740),  INT16_C(30926),  INT16_C(24490),  INT16_C( 7719), -INT16_C(32265), -INT16_C(25687) } },
+    { {  INT16_C(27189),  INT16_C( 1815),  INT16_C(14968), -INT16_C(14458),  INT16_C(22282),  INT16_C(15114),  INT16_C(30999), -INT16_C(11079) },
+      { -INT16_C( 6115), -INT16_C(16995), -INT16_C(21617),  INT16_C(25412),  INT16_C(15172),  INT16_C(16116), -INT16_C(14849), -INT16_C(11940) },
+      { -INT16_C( 6115), -INT16_C(16995), -INT16_C(21617),  INT16_C(25412),  INT16_C(15172),  INT16_C(16116), -INT16_C(14849), -INT16_C(11940) },
+      {  INT16_C(  949), -INT16_C(19529),  INT16_C(29176),  INT16_C(26758),  INT16_C(26762), -INT16_C( 8566), -INT16_C(16393),  INT16_C(11161) },
+      {  INT16_C(30261),  INT16_C(30487),  INT16_C(15992),  INT16_C( 4998),  INT16_C( 4874), -INT16_C(11510), -INT16_C(  745),  INT16_C(28857) },
+      { -INT16_C( 5579), -INT16_C(30953), -INT16_C(17800),  INT16_C(18310),  INT16_C(22282),  INT16_C(15114), -INT16_C( 1769),  INT16_C(21689) } },
+    { {  INT16_C(24048), -INT16_C(18684), -INT16_C( 8786),  INT16_C( 3994), -INT16_C(11595), -INT16_C( 9671), -INT16_C(28705),  INT16_C(24351) },
+      { -INT16_C( 5383), -INT16_C(  358),  INT16_C(27186),  INT16_C(  440),  INT16_C(30244),  INT16_C( 8905),  INT16_C(16366),  INT16_C(30435) },
+      { -INT16_C( 5383), -INT16_C(  358),  INT16_C(27186),  INT16_C(  440),  INT16_C(30244),  INT16_C( 8905),  INT16_C(16366),  INT16_C(30435) },
+      {  INT16_C(24368), -INT16_C(11452),  INT16_C(17998),  INT16_C(14106), -INT16_C(15211),  INT16_C(22841), -INT16_C(  545), -INT16_C( 9089) },
+      { -INT16_C( 6672),  INT16_C(27396), -INT16_C(13906), -INT16_C( 7270), -INT16_C(27979),  INT16_C( 9785), -INT16_C(17441), -INT16_C(28897) },
+      { -INT16_C( 8720),  INT16_C(14084),  INT16_C(23982),  INT16_C( 3994),  INT16_C(21173), -INT16_C( 9671),  INT16_C( 4063), -INT16_C( 8417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8_t a = simde_vld1q_s16(test_vec[i].a);
+    simde_int16x8_t b = simde_vld1q_s16(test_vec[i].b);
+
+    simde_int16x8_t r0 = simde_vsliq_n_s16(a, b, 0);
+    simde_int16x8_t r5 = simde_vsliq_n_s16(a, b, 5);
+    simde_int16x8_t r10 = simde_vsliq_n_s16(a, b, 10);
+    simde_int16x8_t r15 = simde_vsliq_n_s16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_i16x8(r0, simde_vld1q_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x8(r5, simde_vld1q_s16(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_i16x8(r10, simde_vld1q_s16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_i16x8(r15, simde_vld1q_s16(test_vec[i].r15));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r0[4];
+    int32_t r11[4];
+    int32_t r22[4];
+    int32_t r31[4];
+  } test_vec[] = {
+    { { -INT32_C( 443192777), -INT32_C( 752710520),  INT32_C(1953123101),  INT32_C(1039412560) },
+      { -INT32_C(1212880253),  INT32_C(1795958493), -INT32_C(1656711775),  INT32_C( 969584072) },
+      { -INT32_C(1212880253),  INT32_C(1795958493), -INT32_C(1656711775),  INT32_C( 969584072) },
+      { -INT32_C(1487660489),  INT32_C(1630989448),  INT32_C(  78449437),  INT32_C(1433290064) },
+      { -INT32_C(1596626377), -INT32_C(1218278264),  INT32_C(1751796509),  INT32_C(1916022096) },
+      { -INT32_C( 443192777), -INT32_C( 752710520), -INT32_C( 194360547),  INT32_C(1039412560) } },
+    { { -INT32_C( 544106049), -INT32_C( 340830141), -INT32_C(1684088665), -INT32_C( 700110183) },
+      { -INT32_C( 681153461), -INT32_C( 507765551), -INT32_C( 775773172),  INT32_C( 119266019) },
+      { -INT32_C( 681153461), -INT32_C( 507765551), -INT32_C( 775773172),  INT32_C( 119266019) },
+      {  INT32_C( 862083519), -INT32_C( 521762749),  INT32_C( 354443431), -INT32_C( 556328295) },
+      {  INT32_C( 315726271),  INT32_C( 879712323),  INT32_C(  52353191), -INT32_C(1195038055) },
+      { -INT32_C( 544106049), -INT32_C( 340830141),  INT32_C( 463394983), -INT32_C( 700110183) } },
+    { {  INT32_C(1552014885), -INT32_C( 447477305), -INT32_C(1860832176),  INT32_C(1340455633) },
+      {  INT32_C( 354077047),  INT32_C(1606736949), -INT32_C(1916537346), -INT32_C( 590636110) },
+      {  INT32_C( 354077047),  INT32_C(1606736949), -INT32_C(1916537346), -INT32_C( 590636110) },
+      { -INT32_C( 699679195),  INT32_C( 652323271),  INT32_C( 531625040),  INT32_C(1558024913) },
+      {  INT32_C(1572986405),  INT32_C( 223611335),  INT32_C(2140533840), -INT32_C( 324683055) },
+      { -INT32_C( 595468763), -INT32_C( 447477305),  INT32_C( 286651472),  INT32_C(1340455633) } },
+    { {  INT32_C(1510650674), -INT32_C( 213001094), -INT32_C(1406065907), -INT32_C(  24052382) },
+      { -INT32_C( 965791107), -INT32_C( 971368672), -INT32_C(1845079857),  INT32_C(  10920115) },
+      { -INT32_C( 965791107), -INT32_C( 971368672), -INT32_C(1845079857),  INT32_C(  10920115) },
+      {  INT32_C(2039737138), -INT32_C( 793181062),  INT32_C( 847674125),  INT32_C( 889560418) },
+      { -INT32_C(1622494414), -INT32_C( 938615686),  INT32_C( 871441165),  INT32_C( 751893858) },
+      { -INT32_C( 636832974),  INT32_C(1934482554), -INT32_C(1406065907), -INT32_C(  24052382) } },
+    { {  INT32_C(2007456727), -INT32_C(1160770900), -INT32_C( 128639553), -INT32_C(1018862494) },
+      {  INT32_C( 340454045),  INT32_C( 769787873), -INT32_C(1364207768), -INT32_C( 553368503) },
+      {  INT32_C( 340454045),  INT32_C( 769787873), -INT32_C(1364207768), -INT32_C( 553368503) },
+      {  INT32_C(1465183191),  INT32_C( 272566956),  INT32_C(2126202303),  INT32_C( 572673122) },
+      { -INT32_C(1486398505), -INT32_C( 128972116), -INT32_C( 636150337),  INT32_C( 306537570) },
+      { -INT32_C( 140026921), -INT32_C(1160770900),  INT32_C(2018844095), -INT32_C(1018862494) } },
+    { {  INT32_C( 496062351),  INT32_C( 626255874),  INT32_C( 266340930), -INT32_C(1119148822) },
+      { -INT32_C( 387036556),  INT32_C(1297679235),  INT32_C( 575889323),  INT32_C( 418813848) },
+      { -INT32_C( 387036556),  INT32_C(1297679235),  INT32_C( 575889323),  INT32_C( 418813848) },
+      {  INT32_C(1918085007), -INT32_C( 937682942), -INT32_C(1694672318), -INT32_C(1262697238) },
+      { -INT32_C(1659809905), -INT32_C( 522983422), -INT32_C( 354416062), -INT32_C( 435477270) },
+      {  INT32_C( 496062351), -INT32_C(1521227774), -INT32_C(1881142718),  INT32_C(1028334826) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t a = simde_vld1q_s32(test_vec[i].a);
+    simde_int32x4_t b = simde_vld1q_s32(test_vec[i].b);
+
+    simde_int32x4_t r0 = simde_vsliq_n_s32(a, b, 0);
+    simde_int32x4_t r11 = simde_vsliq_n_s32(a, b, 11);
+    simde_int32x4_t r22 = simde_vsliq_n_s32(a, b, 22);
+    simde_int32x4_t r31 = simde_vsliq_n_s32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_i32x4(r0, simde_vld1q_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x4(r11, simde_vld1q_s32(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_i32x4(r22, simde_vld1q_s32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_i32x4(r31, simde_vld1q_s32(test_vec[i].r31));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r0[2];
+    int64_t r21[2];
+    int64_t r42[2];
+    int64_t r63[2];
+  } test_vec[] = {
+    { { -INT64_C(1989975160337176725), -INT64_C(3012983393767325108) },
+      {  INT64_C(4047042288005951719),  INT64_C(2592760355778563016) },
+      {  INT64_C(4047042288005951719),  INT64_C(2592760355778563016) },
+      {  INT64_C(8113782861508667243), -INT64_C(5057757123575217588) },
+      {  INT64_C(5819666815755773803), -INT64_C(7624836537962134964) },
+      { -INT64_C(1989975160337176725),  INT64_C(6210388643087450700) } },
+    { {  INT64_C(2512213142907369875),  INT64_C(3871344109347612238) },
+      {  INT64_C( 300208694263247066), -INT64_C(2493914074603988722) },
+      {  INT64_C( 300208694263247066), -INT64_C(2493914074603988722) },
+      { -INT64_C(4111644149884667501), -INT64_C(3775885403532876210) },
+      {  INT64_C(3297594298627766675), -INT64_C(8690756557900143026) },
+      {  INT64_C(2512213142907369875),  INT64_C(3871344109347612238) } },
+    { { -INT64_C(5010502962319493117), -INT64_C(6520934667330837532) },
+      { -INT64_C(6405945722639911584), -INT64_C( 392360546708953997) },
+      { -INT64_C(6405945722639911584), -INT64_C( 392360546708953997) },
+      {  INT64_C(5315922866716768259), -INT64_C(4239099888031816732) },
+      {  INT64_C(8490835721746610179),  INT64_C(2563054479494030308) },
+      {  INT64_C(4212869074535282691), -INT64_C(6520934667330837532) } },
+    { { -INT64_C(8897221612107863718),  INT64_C(4315374132803075280) },
+      { -INT64_C(2575606085684941249), -INT64_C(3261425592515347357) },
+      { -INT64_C(2575606085684941249), -INT64_C(3261425592515347357) },
+      {  INT64_C(9018648769027238234), -INT64_C(2989800644482499376) },
+      { -INT64_C(6288999711116236454),  INT64_C( 356221877181676752) },
+      { -INT64_C(8897221612107863718), -INT64_C(4907997904051700528) } },
+    { {  INT64_C(7726038565151598749), -INT64_C(2733660623860234443) },
+      {  INT64_C(4123477824281951021),  INT64_C(5586669542255554458) },
+      {  INT64_C(4123477824281951021),  INT64_C(5586669542255554458) },
+      {  INT64_C(2845554609994623133), -INT64_C(3806398900683241675) },
+      {  INT64_C(1940126904817576093), -INT64_C(8377141547932154059) },
+      { -INT64_C(1497333471703177059),  INT64_C(6489711412994541365) } },
+    { {  INT64_C(5601040937883152660),  INT64_C(3330256212595084617) },
+      {  INT64_C(7395242010550962465),  INT64_C(6253159608491589085) },
+      {  INT64_C(7395242010550962465),  INT64_C(6253159608491589085) },
+      { -INT64_C(5933107743808147180), -INT64_C(1076220914629833399) },
+      { -INT64_C(4745521809163407084), -INT64_C(2812649281091760823) },
+      { -INT64_C(3622331098971623148), -INT64_C(5893115824259691191) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2_t a = simde_vld1q_s64(test_vec[i].a);
+    simde_int64x2_t b = simde_vld1q_s64(test_vec[i].b);
+
+    simde_int64x2_t r0 = simde_vsliq_n_s64(a, b, 0);
+    simde_int64x2_t r21 = simde_vsliq_n_s64(a, b, 21);
+    simde_int64x2_t r42 = simde_vsliq_n_s64(a, b, 42);
+    simde_int64x2_t r63 = simde_vsliq_n_s64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_i64x2(r0, simde_vld1q_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x2(r21, simde_vld1q_s64(test_vec[i].r21));
+    simde_test_arm_neon_assert_equal_i64x2(r42, simde_vld1q_s64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_i64x2(r63, simde_vld1q_s64(test_vec[i].r63));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[16];
+    uint8_t r0[16];
+    uint8_t r3[16];
+    uint8_t r5[16];
+    uint8_t r7[16];
+  } test_vec[] = {
+    { { UINT8_C(229), UINT8_C(218), UINT8_C(100), UINT8_C( 67), UINT8_C(110), UINT8_C(209), UINT8_C(139), UINT8_C( 49),
+          UINT8_C( 75), UINT8_C(188), UINT8_C(187), UINT8_C( 48), UINT8_C(145), UINT8_C( 35), UINT8_C(212), UINT8_C(172) },
+      { UINT8_C(237), UINT8_C(177), UINT8_C(242), UINT8_C(111), UINT8_C(125), UINT8_C(240), UINT8_C( 66), UINT8_C( 93),
+          UINT8_C( 52), UINT8_C(  9), UINT8_C( 67), UINT8_C(  1), UINT8_C( 44), UINT8_C(179), UINT8_C(187), UINT8_C(114) },
+      { UINT8_C(237), UINT8_C(177), UINT8_C(242), UINT8_C(111), UINT8_C(125), UINT8_C(240), UINT8_C( 66), UINT8_C( 93),
+          UINT8_C( 52), UINT8_C(  9), UINT8_C( 67), UINT8_C(  1), UINT8_C( 44), UINT8_C(179), UINT8_C(187), UINT8_C(114) },
+      { UINT8_C(109), UINT8_C(138), UINT8_C(148), UINT8_C(123), UINT8_C(238), UINT8_C(129), UINT8_C( 19), UINT8_C(233),
+          UINT8_C(163), UINT8_C( 76), UINT8_C( 27), UINT8_C(  8), UINT8_C( 97), UINT8_C(155), UINT8_C(220), UINT8_C(148) },
+      { UINT8_C(165), UINT8_C( 58), UINT8_C( 68), UINT8_C(227), UINT8_C(174), UINT8_C( 17), UINT8_C( 75), UINT8_C(177),
+          UINT8_C(139), UINT8_C( 60), UINT8_C(123), UINT8_C( 48), UINT8_C(145), UINT8_C( 99), UINT8_C(116), UINT8_C( 76) },
+      { UINT8_C(229), UINT8_C(218), UINT8_C(100), UINT8_C(195), UINT8_C(238), UINT8_C( 81), UINT8_C( 11), UINT8_C(177),
+          UINT8_C( 75), UINT8_C(188), UINT8_C(187), UINT8_C(176), UINT8_C( 17), UINT8_C(163), UINT8_C(212), UINT8_C( 44) } },
+    { { UINT8_C( 15), UINT8_C(212), UINT8_C(100), UINT8_C( 54), UINT8_C(108), UINT8_C(152), UINT8_C(199), UINT8_C(169),
+          UINT8_C(144), UINT8_C(230), UINT8_C(142), UINT8_C(222), UINT8_C(155), UINT8_C(148), UINT8_C(217), UINT8_C(166) },
+      { UINT8_C(228), UINT8_C( 88), UINT8_C(127), UINT8_C(152), UINT8_C( 82), UINT8_C(171), UINT8_C( 83), UINT8_C(154),
+          UINT8_C(202), UINT8_C(153), UINT8_C( 99), UINT8_C(122), UINT8_C(179), UINT8_C(192), UINT8_C(189), UINT8_C(213) },
+      { UINT8_C(228), UINT8_C( 88), UINT8_C(127), UINT8_C(152), UINT8_C( 82), UINT8_C(171), UINT8_C( 83), UINT8_C(154),
+          UINT8_C(202), UINT8_C(153), UINT8_C( 99), UINT8_C(122), UINT8_C(179), UINT8_C(192), UINT8_C(189), UINT8_C(213) },
+      { UINT8_C( 39), UINT8_C(196), UINT8_C(252), UINT8_C(198), UINT8_C(148), UINT8_C( 88), UINT8_C(159), UINT8_C(209),
+          UINT8_C( 80), UINT8_C(206), UINT8_C( 30), UINT8_C(214), UINT8_C(155), UINT8_C(  4), UINT8_C(233), UINT8_C(174) },
+      { UINT8_C(143), UINT8_C( 20), UINT8_C(228), UINT8_C( 22), UINT8_C( 76), UINT8_C(120), UINT8_C(103), UINT8_C( 73),
+          UINT8_C( 80), UINT8_C( 38), UINT8_C(110), UINT8_C( 94), UINT8_C(123), UINT8_C( 20), UINT8_C(185), UINT8_C(166) },
+      { UINT8_C( 15), UINT8_C( 84), UINT8_C(228), UINT8_C( 54), UINT8_C(108), UINT8_C(152), UINT8_C(199), UINT8_C( 41),
+          UINT8_C( 16), UINT8_C(230), UINT8_C(142), UINT8_C( 94), UINT8_C(155), UINT8_C( 20), UINT8_C(217), UINT8_C(166) } },
+    { { UINT8_C(121), UINT8_C(114), UINT8_C( 98), UINT8_C( 30), UINT8_C( 55), UINT8_C( 11), UINT8_C( 56), UINT8_C( 46),
+          UINT8_C(  7), UINT8_C(143), UINT8_C( 47), UINT8_C( 26), UINT8_C(220), UINT8_C(138), UINT8_C(122), UINT8_C(245) },
+      { UINT8_C( 91), UINT8_C(224), UINT8_C( 79), UINT8_C( 12), UINT8_C(157), UINT8_C( 85), UINT8_C(200), UINT8_C(147),
+             UINT8_MAX, UINT8_C( 91), UINT8_C( 39), UINT8_C(220), UINT8_C( 43), UINT8_C( 72), UINT8_C( 30), UINT8_C( 61) },
+      { UINT8_C( 91), UINT8_C(224), UINT8_C( 79), UINT8_C( 12), UINT8_C(157), UINT8_C( 85), UINT8_C(200), UINT8_C(147),
+             UINT8_MAX, UINT8_C( 91), UINT8_C( 39), UINT8_C(220), UINT8_C( 43), UINT8_C( 72), UINT8_C( 30), UINT8_C( 61) },
+      { UINT8_C(217), UINT8_C(  2), UINT8_C(122), UINT8_C(102), UINT8_C(239), UINT8_C(171), UINT8_C( 64), UINT8_C(158),
+             UINT8_MAX, UINT8_C(223), UINT8_C( 63), UINT8_C(226), UINT8_C( 92), UINT8_C( 66), UINT8_C(242), UINT8_C(237) },
+      { UINT8_C(121), UINT8_C( 18), UINT8_C(226), UINT8_C(158), UINT8_C(183), UINT8_C(171), UINT8_C( 24), UINT8_C(110),
+          UINT8_C(231), UINT8_C(111), UINT8_C(239), UINT8_C(154), UINT8_C(124), UINT8_C( 10), UINT8_C(218), UINT8_C(181) },
+      { UINT8_C(249), UINT8_C(114), UINT8_C(226), UINT8_C( 30), UINT8_C(183), UINT8_C(139), UINT8_C( 56), UINT8_C(174),
+          UINT8_C(135), UINT8_C(143), UINT8_C(175), UINT8_C( 26), UINT8_C(220), UINT8_C( 10), UINT8_C(122), UINT8_C(245) } },
+    { { UINT8_C(180), UINT8_C(252), UINT8_C(120), UINT8_C( 93), UINT8_C( 59), UINT8_C(176), UINT8_C(229), UINT8_C( 62),
+          UINT8_C(161), UINT8_C(  2), UINT8_C(  2), UINT8_C(254), UINT8_C(100), UINT8_C(224), UINT8_C( 32), UINT8_C(226) },
+      { UINT8_C( 25), UINT8_C(202), UINT8_C( 21), UINT8_C(100), UINT8_C( 42), UINT8_C( 17), UINT8_C(139), UINT8_C( 79),
+          UINT8_C(242), UINT8_C( 82), UINT8_C(157), UINT8_C(239), UINT8_C(122), UINT8_C(  4), UINT8_C(114), UINT8_C( 19) },
+      { UINT8_C( 25), UINT8_C(202), UINT8_C( 21), UINT8_C(100), UINT8_C( 42), UINT8_C( 17), UINT8_C(139), UINT8_C( 79),
+          UINT8_C(242), UINT8_C( 82), UINT8_C(157), UINT8_C(239), UINT8_C(122), UINT8_C(  4), UINT8_C(114), UINT8_C( 19) },
+      { UINT8_C(204), UINT8_C( 84), UINT8_C(168), UINT8_C( 37), UINT8_C( 83), UINT8_C(136), UINT8_C( 93), UINT8_C(126),
+          UINT8_C(145), UINT8_C(146), UINT8_C(234), UINT8_C(126), UINT8_C(212), UINT8_C( 32), UINT8_C(144), UINT8_C(154) },
+      { UINT8_C( 52), UINT8_C( 92), UINT8_C(184), UINT8_C(157), UINT8_C( 91), UINT8_C( 48), UINT8_C(101), UINT8_C(254),
+          UINT8_C( 65), UINT8_C( 66), UINT8_C(162), UINT8_C(254), UINT8_C( 68), UINT8_C(128), UINT8_C( 64), UINT8_C( 98) },
+      { UINT8_C(180), UINT8_C(124), UINT8_C(248), UINT8_C( 93), UINT8_C( 59), UINT8_C(176), UINT8_C(229), UINT8_C(190),
+          UINT8_C( 33), UINT8_C(  2), UINT8_C(130), UINT8_C(254), UINT8_C(100), UINT8_C( 96), UINT8_C( 32), UINT8_C(226) } },
+    { { UINT8_C(248), UINT8_C(241), UINT8_C(234), UINT8_C(253), UINT8_C( 44), UINT8_C(  7), UINT8_C(141), UINT8_C( 15),
+          UINT8_C(  6), UINT8_C(  0), UINT8_C(167), UINT8_C(227), UINT8_C( 64), UINT8_C(164), UINT8_C( 97), UINT8_C(184) },
+      { UINT8_C(104), UINT8_C(209), UINT8_C(  1), UINT8_C(242), UINT8_C( 73), UINT8_C(  3), UINT8_C(136), UINT8_C(219),
+          UINT8_C(213), UINT8_C(186), UINT8_C(188), UINT8_C(203), UINT8_C(192), UINT8_C(201), UINT8_C( 65), UINT8_C( 55) },
+      { UINT8_C(104), UINT8_C(209), UINT8_C(  1), UINT8_C(242), UINT8_C( 73), UINT8_C(  3), UINT8_C(136), UINT8_C(219),
+          UINT8_C(213), UINT8_C(186), UINT8_C(188), UINT8_C(203), UINT8_C(192), UINT8_C(201), UINT8_C( 65), UINT8_C( 55) },
+      { UINT8_C( 64), UINT8_C(137), UINT8_C( 10), UINT8_C(149), UINT8_C( 76), UINT8_C( 31), UINT8_C( 69), UINT8_C(223),
+          UINT8_C(174), UINT8_C(208), UINT8_C(231), UINT8_C( 91), UINT8_C(  0), UINT8_C( 76), UINT8_C(  9), UINT8_C(184) },
+      { UINT8_C( 24), UINT8_C( 49), UINT8_C( 42), UINT8_C( 93), UINT8_C( 44), UINT8_C(103), UINT8_C( 13), UINT8_C(111),
+          UINT8_C(166), UINT8_C( 64), UINT8_C(135), UINT8_C( 99), UINT8_C(  0), UINT8_C( 36), UINT8_C( 33), UINT8_C(248) },
+      { UINT8_C(120), UINT8_C(241), UINT8_C(234), UINT8_C(125), UINT8_C(172), UINT8_C(135), UINT8_C( 13), UINT8_C(143),
+          UINT8_C(134), UINT8_C(  0), UINT8_C( 39), UINT8_C(227), UINT8_C( 64), UINT8_C(164), UINT8_C(225), UINT8_C(184) } },
+    { { UINT8_C(194), UINT8_C(165), UINT8_C( 46), UINT8_C(160), UINT8_C( 92), UINT8_C(176), UINT8_C(212), UINT8_C( 21),
+          UINT8_C( 46), UINT8_C(234), UINT8_C(129), UINT8_C( 76), UINT8_C(210), UINT8_C(117), UINT8_C( 24), UINT8_C( 93) },
+      { UINT8_C(202), UINT8_C(161), UINT8_C(171), UINT8_C( 37), UINT8_C( 13), UINT8_C(157), UINT8_C(192), UINT8_C(245),
+          UINT8_C(161), UINT8_C( 41), UINT8_C( 23), UINT8_C(155), UINT8_C( 70), UINT8_C( 78), UINT8_C( 66), UINT8_C(119) },
+      { UINT8_C(202), UINT8_C(161), UINT8_C(171), UINT8_C( 37), UINT8_C( 13), UINT8_C(157), UINT8_C(192), UINT8_C(245),
+          UINT8_C(161), UINT8_C( 41), UINT8_C( 23), UINT8_C(155), UINT8_C( 70), UINT8_C( 78), UINT8_C( 66), UINT8_C(119) },
+      { UINT8_C( 82), UINT8_C( 13), UINT8_C( 94), UINT8_C( 40), UINT8_C(108), UINT8_C(232), UINT8_C(  4), UINT8_C(173),
+          UINT8_C( 14), UINT8_C( 74), UINT8_C(185), UINT8_C(220), UINT8_C( 50), UINT8_C(117), UINT8_C( 16), UINT8_C(189) },
+      { UINT8_C( 66), UINT8_C( 37), UINT8_C(110), UINT8_C(160), UINT8_C(188), UINT8_C(176), UINT8_C( 20), UINT8_C(181),
+          UINT8_C( 46), UINT8_C( 42), UINT8_C(225), UINT8_C(108), UINT8_C(210), UINT8_C(213), UINT8_C( 88), UINT8_C(253) },
+      { UINT8_C( 66), UINT8_C(165), UINT8_C(174), UINT8_C(160), UINT8_C(220), UINT8_C(176), UINT8_C( 84), UINT8_C(149),
+          UINT8_C(174), UINT8_C(234), UINT8_C(129), UINT8_C(204), UINT8_C( 82), UINT8_C(117), UINT8_C( 24), UINT8_C(221) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+
+    simde_uint8x16_t r0 = simde_vsliq_n_u8(a, b, 0);
+    simde_uint8x16_t r3 = simde_vsliq_n_u8(a, b, 3);
+    simde_uint8x16_t r5 = simde_vsliq_n_u8(a, b, 5);
+    simde_uint8x16_t r7 = simde_vsliq_n_u8(a, b, 7);
+
+    simde_test_arm_neon_assert_equal_u8x16(r0, simde_vld1q_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x16(r3, simde_vld1q_u8(test_vec[i].r3));
+    simde_test_arm_neon_assert_equal_u8x16(r5, simde_vld1q_u8(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u8x16(r7, simde_vld1q_u8(test_vec[i].r7));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    uint16_t r0[8];
+    uint16_t r5[8];
+    uint16_t r10[8];
+    uint16_t r15[8];
+  } test_vec[] = {
+    { { UINT16_C( 5080), UINT16_C(53283), UINT16_C(24392), UINT16_C(51415), UINT16_C(57242), UINT16_C(19599), UINT16_C(20766), UINT16_C( 6406) },
+      { UINT16_C(17846), UINT16_C(10912), UINT16_C(10620), UINT16_C(27341), UINT16_C(65245), UINT16_C(29750), UINT16_C(15600), UINT16_C( 2851) },
+      { UINT16_C(17846), UINT16_C(10912), UINT16_C(10620), UINT16_C(27341), UINT16_C(65245), UINT16_C(29750), UINT16_C(15600), UINT16_C( 2851) },
+      { UINT16_C(46808), UINT16_C(21507), UINT16_C(12168), UINT16_C(22967), UINT16_C(56250), UINT16_C(34511), UINT16_C(40478), UINT16_C(25702) },
+      { UINT16_C(56280), UINT16_C(32803), UINT16_C(62280), UINT16_C(13527), UINT16_C(30618), UINT16_C(55439), UINT16_C(49438), UINT16_C(36102) },
+      { UINT16_C( 5080), UINT16_C(20515), UINT16_C(24392), UINT16_C(51415), UINT16_C(57242), UINT16_C(19599), UINT16_C(20766), UINT16_C(39174) } },
+    { { UINT16_C(35683), UINT16_C( 4676), UINT16_C(62427), UINT16_C(15944), UINT16_C(39522), UINT16_C(39181), UINT16_C(14499), UINT16_C(24626) },
+      { UINT16_C(35129), UINT16_C(39837), UINT16_C(59516), UINT16_C(31854), UINT16_C(19270), UINT16_C(31070), UINT16_C(27908), UINT16_C(62147) },
+      { UINT16_C(35129), UINT16_C(39837), UINT16_C(59516), UINT16_C(31854), UINT16_C(19270), UINT16_C(31070), UINT16_C(27908), UINT16_C(62147) },
+      { UINT16_C(10019), UINT16_C(29604), UINT16_C( 3995), UINT16_C(36296), UINT16_C(26818), UINT16_C(11213), UINT16_C(41091), UINT16_C(22642) },
+      { UINT16_C(59235), UINT16_C(30276), UINT16_C(62427), UINT16_C(47688), UINT16_C( 6754), UINT16_C(30989), UINT16_C( 4259), UINT16_C( 3122) },
+      { UINT16_C(35683), UINT16_C(37444), UINT16_C(29659), UINT16_C(15944), UINT16_C( 6754), UINT16_C( 6413), UINT16_C(14499), UINT16_C(57394) } },
+    { { UINT16_C(41203), UINT16_C( 1300), UINT16_C(42196), UINT16_C(27664), UINT16_C( 5885), UINT16_C(38546), UINT16_C(12400), UINT16_C(20584) },
+      { UINT16_C(49797), UINT16_C(28914), UINT16_C(46389), UINT16_C( 2911), UINT16_C(41880), UINT16_C( 8844), UINT16_C( 9186), UINT16_C(13603) },
+      { UINT16_C(49797), UINT16_C(28914), UINT16_C(46389), UINT16_C( 2911), UINT16_C(41880), UINT16_C( 8844), UINT16_C( 9186), UINT16_C(13603) },
+      { UINT16_C(20659), UINT16_C( 7764), UINT16_C(42676), UINT16_C(27632), UINT16_C(29469), UINT16_C(20882), UINT16_C(31824), UINT16_C(42088) },
+      { UINT16_C( 5363), UINT16_C(51476), UINT16_C(54484), UINT16_C(31760), UINT16_C(25341), UINT16_C(12946), UINT16_C(34928), UINT16_C(35944) },
+      { UINT16_C(41203), UINT16_C( 1300), UINT16_C(42196), UINT16_C(60432), UINT16_C( 5885), UINT16_C( 5778), UINT16_C(12400), UINT16_C(53352) } },
+    { { UINT16_C(42590), UINT16_C(38549), UINT16_C(53844), UINT16_C(55628), UINT16_C(43984), UINT16_C(28435), UINT16_C(42163), UINT16_C(36726) },
+      { UINT16_C(40990), UINT16_C(16498), UINT16_C(17255), UINT16_C(20474), UINT16_C( 2845), UINT16_C(32833), UINT16_C(56351), UINT16_C( 6186) },
+      { UINT16_C(40990), UINT16_C(16498), UINT16_C(17255), UINT16_C(20474), UINT16_C( 2845), UINT16_C(32833), UINT16_C(56351), UINT16_C( 6186) },
+      { UINT16_C(  990), UINT16_C( 3669), UINT16_C(27892), UINT16_C(65356), UINT16_C(25520), UINT16_C( 2099), UINT16_C(33779), UINT16_C( 1366) },
+      { UINT16_C(31326), UINT16_C(51861), UINT16_C(40532), UINT16_C(59724), UINT16_C(30672), UINT16_C( 1811), UINT16_C(31923), UINT16_C(43894) },
+      { UINT16_C( 9822), UINT16_C( 5781), UINT16_C(53844), UINT16_C(22860), UINT16_C(43984), UINT16_C(61203), UINT16_C(42163), UINT16_C( 3958) } },
+    { { UINT16_C(24929), UINT16_C(64054), UINT16_C(46331), UINT16_C( 4833), UINT16_C(16050), UINT16_C(49437), UINT16_C(34825), UINT16_C(12938) },
+      { UINT16_C( 6936), UINT16_C(24670), UINT16_C(12987), UINT16_C(21158), UINT16_C(19418), UINT16_C( 3765), UINT16_C( 8881), UINT16_C(22515) },
+      { UINT16_C( 6936), UINT16_C(24670), UINT16_C(12987), UINT16_C(21158), UINT16_C(19418), UINT16_C( 3765), UINT16_C( 8881), UINT16_C(22515) },
+      { UINT16_C(25345), UINT16_C( 3030), UINT16_C(22395), UINT16_C(21697), UINT16_C(31570), UINT16_C(54973), UINT16_C(22057), UINT16_C(65130) },
+      { UINT16_C(24929), UINT16_C(31286), UINT16_C(60667), UINT16_C(39649), UINT16_C(27314), UINT16_C(54557), UINT16_C(50185), UINT16_C(52874) },
+      { UINT16_C(24929), UINT16_C(31286), UINT16_C(46331), UINT16_C( 4833), UINT16_C(16050), UINT16_C(49437), UINT16_C(34825), UINT16_C(45706) } },
+    { { UINT16_C(11649), UINT16_C(54793), UINT16_C(33827), UINT16_C( 6725), UINT16_C(35950), UINT16_C(24058), UINT16_C(15137), UINT16_C(45537) },
+      { UINT16_C(14246), UINT16_C(59699), UINT16_C(51577), UINT16_C(11066), UINT16_C(40270), UINT16_C(38495), UINT16_C(38841), UINT16_C(61132) },
+      { UINT16_C(14246), UINT16_C(59699), UINT16_C(51577), UINT16_C(11066), UINT16_C(40270), UINT16_C(38495), UINT16_C(38841), UINT16_C(61132) },
+      { UINT16_C(62657), UINT16_C( 9833), UINT16_C(12067), UINT16_C(26437), UINT16_C(43470), UINT16_C(52218), UINT16_C(63265), UINT16_C(55681) },
+      { UINT16_C(39297), UINT16_C(52745), UINT16_C(58403), UINT16_C(59973), UINT16_C(14446), UINT16_C(32250), UINT16_C(59169), UINT16_C(12769) },
+      { UINT16_C(11649), UINT16_C(54793), UINT16_C(33827), UINT16_C( 6725), UINT16_C( 3182), UINT16_C(56826), UINT16_C(47905), UINT16_C(12769) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8_t a = simde_vld1q_u16(test_vec[i].a);
+    simde_uint16x8_t b = simde_vld1q_u16(test_vec[i].b);
+
+    simde_uint16x8_t r0 = simde_vsliq_n_u16(a, b, 0);
+    simde_uint16x8_t r5 = simde_vsliq_n_u16(a, b, 5);
+    simde_uint16x8_t r10 = simde_vsliq_n_u16(a, b, 10);
+    simde_uint16x8_t r15 = simde_vsliq_n_u16(a, b, 15);
+
+    simde_test_arm_neon_assert_equal_u16x8(r0, simde_vld1q_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x8(r5, simde_vld1q_u16(test_vec[i].r5));
+    simde_test_arm_neon_assert_equal_u16x8(r10, simde_vld1q_u16(test_vec[i].r10));
+    simde_test_arm_neon_assert_equal_u16x8(r15, simde_vld1q_u16(test_vec[i].r15));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint32_t r0[4];
+    uint32_t r11[4];
+    uint32_t r22[4];
+    uint32_t r31[4];
+  } test_vec[] = {
+    { { UINT32_C( 326234716), UINT32_C( 961010944), UINT32_C(3156169989), UINT32_C(2956195352) },
+      { UINT32_C(4046030283), UINT32_C(1261385637), UINT32_C(3739273626), UINT32_C(2631500875) },
+      { UINT32_C(4046030283), UINT32_C(1261385637), UINT32_C(3739273626), UINT32_C(2631500875) },
+      { UINT32_C(1278106204), UINT32_C(2042440960), UINT32_C( 105698565), UINT32_C(3424804376) },
+      { UINT32_C(1928458844), UINT32_C(3913800960), UINT32_C(1721718021), UINT32_C( 317978136) },
+      { UINT32_C(2473718364), UINT32_C(3108494592), UINT32_C(1008686341), UINT32_C(2956195352) } },
+    { { UINT32_C(1576868101), UINT32_C(2116454108), UINT32_C(1788376930), UINT32_C( 588970013) },
+      { UINT32_C( 855526396), UINT32_C(3036003625), UINT32_C( 661613623), UINT32_C( 747747313) },
+      { UINT32_C( 855526396), UINT32_C(3036003625), UINT32_C( 661613623), UINT32_C( 747747313) },
+      { UINT32_C(4066369797), UINT32_C(2917748444), UINT32_C(2070003554), UINT32_C(2378139677) },
+      { UINT32_C(4282194181), UINT32_C(1248233180), UINT32_C( 232290146), UINT32_C(4233820189) },
+      { UINT32_C(1576868101), UINT32_C(4263937756), UINT32_C(3935860578), UINT32_C(2736453661) } },
+    { { UINT32_C(2158591985), UINT32_C(2520769317), UINT32_C(1630204023), UINT32_C(2618778517) },
+      { UINT32_C(3614926880), UINT32_C( 221833970), UINT32_C(1345419860), UINT32_C(1351288878) },
+      { UINT32_C(3614926880), UINT32_C( 221833970), UINT32_C(1345419860), UINT32_C(1351288878) },
+      { UINT32_C(3141601265), UINT32_C(3344405285), UINT32_C(2345836663), UINT32_C(1480684437) },
+      { UINT32_C( 136937457), UINT32_C(3166692133), UINT32_C(2502619255), UINT32_C( 194470805) },
+      { UINT32_C(  11108337), UINT32_C( 373285669), UINT32_C(1630204023), UINT32_C( 471294869) } },
+    { { UINT32_C(4247054539), UINT32_C(2570848303), UINT32_C(1230536327), UINT32_C(1691380744) },
+      { UINT32_C(1636504998), UINT32_C(3317748938), UINT32_C(2597298846), UINT32_C(3086367799) },
+      { UINT32_C(1636504998), UINT32_C(3317748938), UINT32_C(2597298846), UINT32_C(3086367799) },
+      { UINT32_C(1487745227), UINT32_C( 111562799), UINT32_C(2098525831), UINT32_C(2984360968) },
+      { UINT32_C(1772415179), UINT32_C( 851183663), UINT32_C(2811788935), UINT32_C( 231762952) },
+      { UINT32_C(2099570891), UINT32_C( 423364655), UINT32_C(1230536327), UINT32_C(3838864392) } },
+    { { UINT32_C(1414250306), UINT32_C( 633202105), UINT32_C( 233572649), UINT32_C(4096931192) },
+      { UINT32_C(4033506377), UINT32_C(2823097062), UINT32_C(2384900694), UINT32_C(1533025183) },
+      { UINT32_C(4033506377), UINT32_C(2823097062), UINT32_C(2384900694), UINT32_C(1533025183) },
+      { UINT32_C(1398951746), UINT32_C( 676804025), UINT32_C( 898806057), UINT32_C(  14482808) },
+      { UINT32_C( 306954050), UINT32_C(3116230073), UINT32_C(2511079721), UINT32_C(3891410296) },
+      { UINT32_C(3561733954), UINT32_C( 633202105), UINT32_C( 233572649), UINT32_C(4096931192) } },
+    { { UINT32_C(1242020101), UINT32_C(1735080917), UINT32_C(3154766528), UINT32_C(1227387771) },
+      { UINT32_C( 947236317), UINT32_C(3838474007), UINT32_C( 672356031), UINT32_C( 656677835) },
+      { UINT32_C( 947236317), UINT32_C(3838474007), UINT32_C( 672356031), UINT32_C( 656677835) },
+      { UINT32_C(2909726981), UINT32_C(1404615637), UINT32_C(2595617472), UINT32_C( 551443323) },
+      { UINT32_C(2001189125), UINT32_C(3320527829), UINT32_C(2949245632), UINT32_C(4075320187) },
+      { UINT32_C(3389503749), UINT32_C(3882564565), UINT32_C(3154766528), UINT32_C(3374871419) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t b = simde_vld1q_u32(test_vec[i].b);
+
+    simde_uint32x4_t r0 = simde_vsliq_n_u32(a, b, 0);
+    simde_uint32x4_t r11 = simde_vsliq_n_u32(a, b, 11);
+    simde_uint32x4_t r22 = simde_vsliq_n_u32(a, b, 22);
+    simde_uint32x4_t r31 = simde_vsliq_n_u32(a, b, 31);
+
+    simde_test_arm_neon_assert_equal_u32x4(r0, simde_vld1q_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x4(r11, simde_vld1q_u32(test_vec[i].r11));
+    simde_test_arm_neon_assert_equal_u32x4(r22, simde_vld1q_u32(test_vec[i].r22));
+    simde_test_arm_neon_assert_equal_u32x4(r31, simde_vld1q_u32(test_vec[i].r31));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsliq_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    uint64_t r0[2];
+    uint64_t r21[2];
+    uint64_t r42[2];
+    uint64_t r63[2];
+  } test_vec[] = {
+    { { UINT64_C(16890866231393091949), UINT64_C(12787157750797185903) },
+      { UINT64_C(14627755472582834966), UINT64_C(12905413836867589764) },
+      { UINT64_C(14627755472582834966), UINT64_C(12905413836867589764) },
+      { UINT64_C( 4844908306240864621), UINT64_C(12702469728216953711) },
+      { UINT64_C( 5614961072178168173), UINT64_C(11338392851527906159) },
+      { UINT64_C( 7667494194538316141), UINT64_C( 3563785713942410095) } },
+    { { UINT64_C(16078080582561551302), UINT64_C( 6680868579071700525) },
+      { UINT64_C(10021009192870604257), UINT64_C( 7961625172433027362) },
+      { UINT64_C(10021009192870604257), UINT64_C( 7961625172433027362) },
+      { UINT64_C(15604408924523975622), UINT64_C(18243437468034739757) },
+      { UINT64_C(16696960493464572870), UINT64_C(13187817974668668461) },
+      { UINT64_C(16078080582561551302), UINT64_C( 6680868579071700525) } },
+    { { UINT64_C(17736877508672672449), UINT64_C( 1395878269649831383) },
+      { UINT64_C(17967787140487722178), UINT64_C( 4155004327502658459) },
+      { UINT64_C(17967787140487722178), UINT64_C( 4155004327502658459) },
+      { UINT64_C(16617881606455874241), UINT64_C( 5584076748005983703) },
+      { UINT64_C( 7553389928211337921), UINT64_C(  499459633663591895) },
+      { UINT64_C( 8513505471817896641), UINT64_C(10619250306504607191) } },
+    { { UINT64_C(10127931276930954625), UINT64_C( 5303788940130666708) },
+      { UINT64_C(13016324269247364169), UINT64_C(10657283289895372607) },
+      { UINT64_C(13016324269247364169), UINT64_C(10657283289895372607) },
+      { UINT64_C(13741530433133852033), UINT64_C(15420216757392132308) },
+      { UINT64_C( 2589895061177742721), UINT64_C(12546184071360956628) },
+      { UINT64_C(10127931276930954625), UINT64_C(14527160976985442516) } },
+    { { UINT64_C(11712239022846347084), UINT64_C(13048773818633088171) },
+      { UINT64_C(12970794804793366427), UINT64_C( 8597310343590140073) },
+      { UINT64_C(12970794804793366427), UINT64_C( 8597310343590140073) },
+      { UINT64_C(11881417323501422412), UINT64_C(  477292959976058027) },
+      { UINT64_C(14077811901727344460), UINT64_C(17105417571266129067) },
+      { UINT64_C(11712239022846347084), UINT64_C(13048773818633088171) } },
+    { { UINT64_C( 1665620045732208175), UINT64_C( 4426267187193601899) },
+      { UINT64_C(10026876052093445945), UINT64_C( 7095097436324732994) },
+      { UINT64_C(10026876052093445945), UINT64_C( 7095097436324732994) },
+      { UINT64_C(15321664661143903791), UINT64_C( 3520791761633173355) },
+      { UINT64_C(11141030933998820911), UINT64_C(12574343240362516331) },
+      { UINT64_C(10888992082586983983), UINT64_C( 4426267187193601899) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2_t a = simde_vld1q_u64(test_vec[i].a);
+    simde_uint64x2_t b = simde_vld1q_u64(test_vec[i].b);
+
+    simde_uint64x2_t r0 = simde_vsliq_n_u64(a, b, 0);
+    simde_uint64x2_t r21 = simde_vsliq_n_u64(a, b, 21);
+    simde_uint64x2_t r42 = simde_vsliq_n_u64(a, b, 42);
+    simde_uint64x2_t r63 = simde_vsliq_n_u64(a, b, 63);
+
+    simde_test_arm_neon_assert_equal_u64x2(r0, simde_vld1q_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x2(r21, simde_vld1q_u64(test_vec[i].r21));
+    simde_test_arm_neon_assert_equal_u64x2(r42, simde_vld1q_u64(test_vec[i].r42));
+    simde_test_arm_neon_assert_equal_u64x2(r63, simde_vld1q_u64(test_vec[i].r63));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vslid_n_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a;
+    int64_t b;
+    int64_t r0;
+    int64_t r21;
+    int64_t r42;
+    int64_t r63;
+  } test_vec[] = {
+    {  INT64_C(1997041265286933234),
+       INT64_C(1114067386921075723),
+       INT64_C(1114067386921075723),
+      -INT64_C(3722039375463617806),
+       INT64_C(2094224899042798322),
+      -INT64_C(7226330771567842574) },
+    {  INT64_C(1122740738743659024),
+      -INT64_C(6110105400635273182),
+      -INT64_C(6110105400635273182),
+       INT64_C(8095464464801655312),
+      -INT64_C(4521461464956081648),
+       INT64_C(1122740738743659024) },
+    { -INT64_C(8516279145033799823),
+      -INT64_C(6909681262546848336),
+      -INT64_C(6909681262546848336),
+       INT64_C(3460549153096034161),
+      -INT64_C(2029222113806555279),
+       INT64_C( 707092891820975985) },
+    {  INT64_C(3668549437419796712),
+      -INT64_C(8579001453674980918),
+      -INT64_C(8579001453674980918),
+       INT64_C(8373393006301919464),
+      -INT64_C(7897296938039658264),
+       INT64_C(3668549437419796712) },
+    {  INT64_C( 642765174622315990),
+       INT64_C(3072990257351997768),
+       INT64_C(3072990257351997768),
+      -INT64_C(8398660838418094634),
+      -INT64_C(3538382876693568042),
+       INT64_C( 642765174622315990) },
+    { -INT64_C(7280543506937955017),
+      -INT64_C(7061865774932707022),
+      -INT64_C(7061865774932707022),
+      -INT64_C(3474750626266628809),
+      -INT64_C(7573708491275125449),
+       INT64_C(1942828529916820791) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r0 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 0);
+    int64_t r21 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 21);
+    int64_t r42 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 42);
+    int64_t r63 = simde_vslid_n_s64(test_vec[i].a, test_vec[i].b, 63);
+
+    simde_assert_equal_i64(r0, test_vec[i].r0);
+    simde_assert_equal_i64(r21, test_vec[i].r21);
+    simde_assert_equal_i64(r42, test_vec[i].r42);
+    simde_assert_equal_i64(r63, test_vec[i].r63);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vslid_n_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r0;
+    uint64_t r21;
+    uint64_t r42;
+    uint64_t r63;
+  } test_vec[] = {
+    { UINT64_C(11301371998288000694),
+      UINT64_C(10822554300028844083),
+      UINT64_C(10822554300028844083),
+      UINT64_C(17975259258599552694),
+      UINT64_C( 7052863466608047798),
+      UINT64_C(11301371998288000694) },
+    { UINT64_C(10560369359406993220),
+      UINT64_C( 5681817697479991404),
+      UINT64_C( 5681817697479991404),
+      UINT64_C(16353725095197249348),
+      UINT64_C( 5368770122164965188),
+      UINT64_C( 1336997322552217412) },
+    { UINT64_C(17651162416906514997),
+      UINT64_C(15063217006821210811),
+      UINT64_C(15063217006821210811),
+      UINT64_C( 9360246319558439477),
+      UINT64_C(14837934373892796981),
+      UINT64_C(17651162416906514997) },
+    { UINT64_C(  672864345235657861),
+      UINT64_C( 4678259059155917754),
+      UINT64_C( 4678259059155917754),
+      UINT64_C( 8826360083946148997),
+      UINT64_C(17829445872959362181),
+      UINT64_C(  672864345235657861) },
+    { UINT64_C(10710518059423302676),
+      UINT64_C(12272211208124159549),
+      UINT64_C(12272211208124159549),
+      UINT64_C(16308829315547857940),
+      UINT64_C( 4276439896468816916),
+      UINT64_C(10710518059423302676) },
+    { UINT64_C(13645496206884126046),
+      UINT64_C( 5225625971971034845),
+      UINT64_C( 5225625971971034845),
+      UINT64_C(16452085334405332318),
+      UINT64_C(10248915672684084574),
+      UINT64_C(13645496206884126046) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r0 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 0);
+    uint64_t r21 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 21);
+    uint64_t r42 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 42);
+    uint64_t r63 = simde_vslid_n_u64(test_vec[i].a, test_vec[i].b, 63);
+
+    simde_assert_equal_u64(r0, test_vec[i].r0);
+    simde_assert_equal_u64(r21, test_vec[i].r21);
+    simde_assert_equal_u64(r42, test_vec[i].r42);
+    simde_assert_equal_u64(r63, test_vec[i].r63);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsli_n_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsliq_n_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vslid_n_s64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vslid_n_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,265 @@
+#define SIMDE_TEST_ARM_NEON_INSN sqrt
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sqrt.h"
+
+static int
+test_simde_vsqrth_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(   831.00),
+      SIMDE_FLOAT16_VALUE(    28.83) },
+    { SIMDE_FLOAT16_VALUE(   666.50),
+      SIMDE_FLOAT16_VALUE(    25.81) },
+    { SIMDE_FLOAT16_VALUE(   429.25),
+      SIMDE_FLOAT16_VALUE(    20.72) },
+    { SIMDE_FLOAT16_VALUE(   107.56),
+      SIMDE_FLOAT16_VALUE(   10.375) },
+    { SIMDE_FLOAT16_VALUE(   969.50),
+      SIMDE_FLOAT16_VALUE(    31.14) },
+    { SIMDE_FLOAT16_VALUE(   176.62),
+      SIMDE_FLOAT16_VALUE(    13.29) },
+    { SIMDE_FLOAT16_VALUE(    62.06),
+      SIMDE_FLOAT16_VALUE(     7.88) },
+    { SIMDE_FLOAT16_VALUE(   481.75),
+      SIMDE_FLOAT16_VALUE(    21.95) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vsqrth_f16(test_vec[i].a);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsqrt_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   831.00), SIMDE_FLOAT16_VALUE(   123.69), SIMDE_FLOAT16_VALUE(   665.00), SIMDE_FLOAT16_VALUE(    20.98) },
+      { SIMDE_FLOAT16_VALUE(    28.83), SIMDE_FLOAT16_VALUE(   11.125), SIMDE_FLOAT16_VALUE(    25.78), SIMDE_FLOAT16_VALUE(    4.582) } },
+    { { SIMDE_FLOAT16_VALUE(   518.00), SIMDE_FLOAT16_VALUE(   112.50), SIMDE_FLOAT16_VALUE(   294.25), SIMDE_FLOAT16_VALUE(   505.25) },
+      { SIMDE_FLOAT16_VALUE(    22.77), SIMDE_FLOAT16_VALUE(    10.61), SIMDE_FLOAT16_VALUE(    17.16), SIMDE_FLOAT16_VALUE(    22.48) } },
+    { { SIMDE_FLOAT16_VALUE(   309.25), SIMDE_FLOAT16_VALUE(   910.50), SIMDE_FLOAT16_VALUE(   314.25), SIMDE_FLOAT16_VALUE(   775.50) },
+      { SIMDE_FLOAT16_VALUE(    17.58), SIMDE_FLOAT16_VALUE(    30.17), SIMDE_FLOAT16_VALUE(    17.73), SIMDE_FLOAT16_VALUE(    27.84) } },
+    { { SIMDE_FLOAT16_VALUE(   572.50), SIMDE_FLOAT16_VALUE(   102.56), SIMDE_FLOAT16_VALUE(   220.75), SIMDE_FLOAT16_VALUE(    26.59) },
+      { SIMDE_FLOAT16_VALUE(    23.92), SIMDE_FLOAT16_VALUE(   10.125), SIMDE_FLOAT16_VALUE(    14.86), SIMDE_FLOAT16_VALUE(    5.156) } },
+    { { SIMDE_FLOAT16_VALUE(   361.50), SIMDE_FLOAT16_VALUE(    11.88), SIMDE_FLOAT16_VALUE(   189.12), SIMDE_FLOAT16_VALUE(   214.00) },
+      { SIMDE_FLOAT16_VALUE(    19.02), SIMDE_FLOAT16_VALUE(    3.447), SIMDE_FLOAT16_VALUE(    13.75), SIMDE_FLOAT16_VALUE(   14.625) } },
+    { { SIMDE_FLOAT16_VALUE(   595.50), SIMDE_FLOAT16_VALUE(   461.50), SIMDE_FLOAT16_VALUE(   264.00), SIMDE_FLOAT16_VALUE(   927.50) },
+      { SIMDE_FLOAT16_VALUE(    24.41), SIMDE_FLOAT16_VALUE(    21.48), SIMDE_FLOAT16_VALUE(    16.25), SIMDE_FLOAT16_VALUE(    30.45) } },
+    { { SIMDE_FLOAT16_VALUE(   270.00), SIMDE_FLOAT16_VALUE(   889.50), SIMDE_FLOAT16_VALUE(   532.50), SIMDE_FLOAT16_VALUE(   351.50) },
+      { SIMDE_FLOAT16_VALUE(    16.44), SIMDE_FLOAT16_VALUE(    29.83), SIMDE_FLOAT16_VALUE(    23.08), SIMDE_FLOAT16_VALUE(    18.75) } },
+    { { SIMDE_FLOAT16_VALUE(   482.25), SIMDE_FLOAT16_VALUE(   462.00), SIMDE_FLOAT16_VALUE(   216.00), SIMDE_FLOAT16_VALUE(   391.75) },
+      { SIMDE_FLOAT16_VALUE(    21.95), SIMDE_FLOAT16_VALUE(    21.50), SIMDE_FLOAT16_VALUE(   14.695), SIMDE_FLOAT16_VALUE(    19.80) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t r = simde_vsqrt_f16(a);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsqrt_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   320.78), SIMDE_FLOAT32_C(   581.94) },
+      { SIMDE_FLOAT32_C(    17.91), SIMDE_FLOAT32_C(    24.12) } },
+    { { SIMDE_FLOAT32_C(    39.87), SIMDE_FLOAT32_C(   621.96) },
+      { SIMDE_FLOAT32_C(     6.31), SIMDE_FLOAT32_C(    24.94) } },
+    { { SIMDE_FLOAT32_C(   970.08), SIMDE_FLOAT32_C(    85.60) },
+      { SIMDE_FLOAT32_C(    31.15), SIMDE_FLOAT32_C(     9.25) } },
+    { { SIMDE_FLOAT32_C(   559.31), SIMDE_FLOAT32_C(   379.65) },
+      { SIMDE_FLOAT32_C(    23.65), SIMDE_FLOAT32_C(    19.48) } },
+    { { SIMDE_FLOAT32_C(   602.52), SIMDE_FLOAT32_C(   630.96) },
+      { SIMDE_FLOAT32_C(    24.55), SIMDE_FLOAT32_C(    25.12) } },
+    { { SIMDE_FLOAT32_C(   962.41), SIMDE_FLOAT32_C(   328.30) },
+      { SIMDE_FLOAT32_C(    31.02), SIMDE_FLOAT32_C(    18.12) } },
+    { { SIMDE_FLOAT32_C(   830.09), SIMDE_FLOAT32_C(   925.01) },
+      { SIMDE_FLOAT32_C(    28.81), SIMDE_FLOAT32_C(    30.41) } },
+    { { SIMDE_FLOAT32_C(    69.05), SIMDE_FLOAT32_C(   778.38) },
+      { SIMDE_FLOAT32_C(     8.31), SIMDE_FLOAT32_C(    27.90) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t r = simde_vsqrt_f32(a);
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsqrt_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   232.26) },
+      { SIMDE_FLOAT64_C(    15.24) } },
+    { { SIMDE_FLOAT64_C(   568.78) },
+      { SIMDE_FLOAT64_C(    23.85) } },
+    { { SIMDE_FLOAT64_C(   335.27) },
+      { SIMDE_FLOAT64_C(    18.31) } },
+    { { SIMDE_FLOAT64_C(    98.59) },
+      { SIMDE_FLOAT64_C(     9.93) } },
+    { { SIMDE_FLOAT64_C(    50.59) },
+      { SIMDE_FLOAT64_C(     7.11) } },
+    { { SIMDE_FLOAT64_C(   111.45) },
+      { SIMDE_FLOAT64_C(    10.56) } },
+    { { SIMDE_FLOAT64_C(   368.22) },
+      { SIMDE_FLOAT64_C(    19.19) } },
+    { { SIMDE_FLOAT64_C(   578.46) },
+      { SIMDE_FLOAT64_C(    24.05) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t r = simde_vsqrt_f64(a);
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsqrtq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   817.50), SIMDE_FLOAT16_VALUE(    45.06), SIMDE_FLOAT16_VALUE(   235.88), SIMDE_FLOAT16_VALUE(   846.00),
+          SIMDE_FLOAT16_VALUE(   187.38), SIMDE_FLOAT16_VALUE(   847.50), SIMDE_FLOAT16_VALUE(   934.00), SIMDE_FLOAT16_VALUE(   339.00) },
+      { SIMDE_FLOAT16_VALUE(    28.59), SIMDE_FLOAT16_VALUE(     6.71), SIMDE_FLOAT16_VALUE(    15.36), SIMDE_FLOAT16_VALUE(    29.09),
+          SIMDE_FLOAT16_VALUE(    13.69), SIMDE_FLOAT16_VALUE(    29.11), SIMDE_FLOAT16_VALUE(    30.56), SIMDE_FLOAT16_VALUE(    18.41) } },
+    { { SIMDE_FLOAT16_VALUE(   190.88), SIMDE_FLOAT16_VALUE(   674.00), SIMDE_FLOAT16_VALUE(   439.75), SIMDE_FLOAT16_VALUE(   416.75),
+          SIMDE_FLOAT16_VALUE(   176.38), SIMDE_FLOAT16_VALUE(   415.25), SIMDE_FLOAT16_VALUE(   486.25), SIMDE_FLOAT16_VALUE(   250.62) },
+      { SIMDE_FLOAT16_VALUE(    13.81), SIMDE_FLOAT16_VALUE(    25.97), SIMDE_FLOAT16_VALUE(    20.97), SIMDE_FLOAT16_VALUE(    20.42),
+          SIMDE_FLOAT16_VALUE(    13.28), SIMDE_FLOAT16_VALUE(    20.38), SIMDE_FLOAT16_VALUE(    22.05), SIMDE_FLOAT16_VALUE(    15.83) } },
+    { { SIMDE_FLOAT16_VALUE(    64.06), SIMDE_FLOAT16_VALUE(   633.00), SIMDE_FLOAT16_VALUE(   688.00), SIMDE_FLOAT16_VALUE(   779.00),
+          SIMDE_FLOAT16_VALUE(   814.00), SIMDE_FLOAT16_VALUE(   282.50), SIMDE_FLOAT16_VALUE(   756.50), SIMDE_FLOAT16_VALUE(   836.00) },
+      { SIMDE_FLOAT16_VALUE(     8.00), SIMDE_FLOAT16_VALUE(    25.16), SIMDE_FLOAT16_VALUE(    26.23), SIMDE_FLOAT16_VALUE(    27.91),
+          SIMDE_FLOAT16_VALUE(    28.53), SIMDE_FLOAT16_VALUE(    16.81), SIMDE_FLOAT16_VALUE(    27.50), SIMDE_FLOAT16_VALUE(    28.91) } },
+    { { SIMDE_FLOAT16_VALUE(   518.50), SIMDE_FLOAT16_VALUE(   189.12), SIMDE_FLOAT16_VALUE(   294.00), SIMDE_FLOAT16_VALUE(   937.00),
+          SIMDE_FLOAT16_VALUE(   814.50), SIMDE_FLOAT16_VALUE(   914.00), SIMDE_FLOAT16_VALUE(   872.00), SIMDE_FLOAT16_VALUE(   400.50) },
+      { SIMDE_FLOAT16_VALUE(    22.77), SIMDE_FLOAT16_VALUE(    13.75), SIMDE_FLOAT16_VALUE(    17.14), SIMDE_FLOAT16_VALUE(    30.61),
+          SIMDE_FLOAT16_VALUE(    28.55), SIMDE_FLOAT16_VALUE(    30.23), SIMDE_FLOAT16_VALUE(    29.53), SIMDE_FLOAT16_VALUE(    20.02) } },
+    { { SIMDE_FLOAT16_VALUE(   559.00), SIMDE_FLOAT16_VALUE(     9.25), SIMDE_FLOAT16_VALUE(   429.75), SIMDE_FLOAT16_VALUE(   515.00),
+          SIMDE_FLOAT16_VALUE(   687.50), SIMDE_FLOAT16_VALUE(   128.62), SIMDE_FLOAT16_VALUE(   354.25), SIMDE_FLOAT16_VALUE(   345.50) },
+      { SIMDE_FLOAT16_VALUE(    23.64), SIMDE_FLOAT16_VALUE(    3.041), SIMDE_FLOAT16_VALUE(    20.73), SIMDE_FLOAT16_VALUE(    22.69),
+          SIMDE_FLOAT16_VALUE(    26.22), SIMDE_FLOAT16_VALUE(    11.34), SIMDE_FLOAT16_VALUE(    18.83), SIMDE_FLOAT16_VALUE(    18.59) } },
+    { { SIMDE_FLOAT16_VALUE(   568.00), SIMDE_FLOAT16_VALUE(   794.50), SIMDE_FLOAT16_VALUE(   833.00), SIMDE_FLOAT16_VALUE(   447.00),
+          SIMDE_FLOAT16_VALUE(   183.25), SIMDE_FLOAT16_VALUE(   221.12), SIMDE_FLOAT16_VALUE(   437.25), SIMDE_FLOAT16_VALUE(   571.00) },
+      { SIMDE_FLOAT16_VALUE(    23.83), SIMDE_FLOAT16_VALUE(    28.19), SIMDE_FLOAT16_VALUE(    28.86), SIMDE_FLOAT16_VALUE(    21.14),
+          SIMDE_FLOAT16_VALUE(    13.54), SIMDE_FLOAT16_VALUE(    14.87), SIMDE_FLOAT16_VALUE(    20.91), SIMDE_FLOAT16_VALUE(    23.89) } },
+    { { SIMDE_FLOAT16_VALUE(   882.00), SIMDE_FLOAT16_VALUE(    68.62), SIMDE_FLOAT16_VALUE(   225.12), SIMDE_FLOAT16_VALUE(   650.00),
+          SIMDE_FLOAT16_VALUE(   577.00), SIMDE_FLOAT16_VALUE(   457.75), SIMDE_FLOAT16_VALUE(   998.00), SIMDE_FLOAT16_VALUE(   542.50) },
+      { SIMDE_FLOAT16_VALUE(    29.70), SIMDE_FLOAT16_VALUE(     8.28), SIMDE_FLOAT16_VALUE(    15.01), SIMDE_FLOAT16_VALUE(    25.50),
+          SIMDE_FLOAT16_VALUE(    24.02), SIMDE_FLOAT16_VALUE(    21.39), SIMDE_FLOAT16_VALUE(    31.59), SIMDE_FLOAT16_VALUE(    23.30) } },
+    { { SIMDE_FLOAT16_VALUE(   750.00), SIMDE_FLOAT16_VALUE(   387.00), SIMDE_FLOAT16_VALUE(   805.50), SIMDE_FLOAT16_VALUE(    22.28),
+          SIMDE_FLOAT16_VALUE(    65.00), SIMDE_FLOAT16_VALUE(   379.50), SIMDE_FLOAT16_VALUE(   761.50), SIMDE_FLOAT16_VALUE(   694.50) },
+      { SIMDE_FLOAT16_VALUE(    27.39), SIMDE_FLOAT16_VALUE(    19.67), SIMDE_FLOAT16_VALUE(    28.38), SIMDE_FLOAT16_VALUE(     4.72),
+          SIMDE_FLOAT16_VALUE(     8.06), SIMDE_FLOAT16_VALUE(    19.48), SIMDE_FLOAT16_VALUE(    27.59), SIMDE_FLOAT16_VALUE(    26.36) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t r = simde_vsqrtq_f16(a);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsqrtq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   905.03), SIMDE_FLOAT32_C(   941.50), SIMDE_FLOAT32_C(   237.49), SIMDE_FLOAT32_C(   252.14) },
+      { SIMDE_FLOAT32_C(    30.08), SIMDE_FLOAT32_C(    30.68), SIMDE_FLOAT32_C(    15.41), SIMDE_FLOAT32_C(    15.88) } },
+    { { SIMDE_FLOAT32_C(   789.57), SIMDE_FLOAT32_C(   547.93), SIMDE_FLOAT32_C(   869.94), SIMDE_FLOAT32_C(   549.62) },
+      { SIMDE_FLOAT32_C(    28.10), SIMDE_FLOAT32_C(    23.41), SIMDE_FLOAT32_C(    29.49), SIMDE_FLOAT32_C(    23.44) } },
+    { { SIMDE_FLOAT32_C(   560.43), SIMDE_FLOAT32_C(   804.24), SIMDE_FLOAT32_C(   103.82), SIMDE_FLOAT32_C(   435.73) },
+      { SIMDE_FLOAT32_C(    23.67), SIMDE_FLOAT32_C(    28.36), SIMDE_FLOAT32_C(    10.19), SIMDE_FLOAT32_C(    20.87) } },
+    { { SIMDE_FLOAT32_C(   664.62), SIMDE_FLOAT32_C(   671.54), SIMDE_FLOAT32_C(   932.65), SIMDE_FLOAT32_C(   348.51) },
+      { SIMDE_FLOAT32_C(    25.78), SIMDE_FLOAT32_C(    25.91), SIMDE_FLOAT32_C(    30.54), SIMDE_FLOAT32_C(    18.67) } },
+    { { SIMDE_FLOAT32_C(   845.72), SIMDE_FLOAT32_C(   527.57), SIMDE_FLOAT32_C(   736.38), SIMDE_FLOAT32_C(   161.79) },
+      { SIMDE_FLOAT32_C(    29.08), SIMDE_FLOAT32_C(    22.97), SIMDE_FLOAT32_C(    27.14), SIMDE_FLOAT32_C(    12.72) } },
+    { { SIMDE_FLOAT32_C(   756.79), SIMDE_FLOAT32_C(   308.78), SIMDE_FLOAT32_C(   854.57), SIMDE_FLOAT32_C(   681.06) },
+      { SIMDE_FLOAT32_C(    27.51), SIMDE_FLOAT32_C(    17.57), SIMDE_FLOAT32_C(    29.23), SIMDE_FLOAT32_C(    26.10) } },
+    { { SIMDE_FLOAT32_C(   486.01), SIMDE_FLOAT32_C(   773.99), SIMDE_FLOAT32_C(   425.92), SIMDE_FLOAT32_C(   170.45) },
+      { SIMDE_FLOAT32_C(    22.05), SIMDE_FLOAT32_C(    27.82), SIMDE_FLOAT32_C(    20.64), SIMDE_FLOAT32_C(    13.06) } },
+    { { SIMDE_FLOAT32_C(   185.73), SIMDE_FLOAT32_C(    79.08), SIMDE_FLOAT32_C(   329.31), SIMDE_FLOAT32_C(   596.20) },
+      { SIMDE_FLOAT32_C(    13.63), SIMDE_FLOAT32_C(     8.89), SIMDE_FLOAT32_C(    18.15), SIMDE_FLOAT32_C(    24.42) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t r = simde_vsqrtq_f32(a);
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsqrtq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   667.15), SIMDE_FLOAT64_C(   584.27) },
+      { SIMDE_FLOAT64_C(    25.83), SIMDE_FLOAT64_C(    24.17) } },
+    { { SIMDE_FLOAT64_C(   231.04), SIMDE_FLOAT64_C(   534.96) },
+      { SIMDE_FLOAT64_C(    15.20), SIMDE_FLOAT64_C(    23.13) } },
+    { { SIMDE_FLOAT64_C(     1.61), SIMDE_FLOAT64_C(   596.41) },
+      { SIMDE_FLOAT64_C(     1.27), SIMDE_FLOAT64_C(    24.42) } },
+    { { SIMDE_FLOAT64_C(   886.12), SIMDE_FLOAT64_C(   496.82) },
+      { SIMDE_FLOAT64_C(    29.77), SIMDE_FLOAT64_C(    22.29) } },
+    { { SIMDE_FLOAT64_C(   648.49), SIMDE_FLOAT64_C(   908.09) },
+      { SIMDE_FLOAT64_C(    25.47), SIMDE_FLOAT64_C(    30.13) } },
+    { { SIMDE_FLOAT64_C(   782.80), SIMDE_FLOAT64_C(   381.83) },
+      { SIMDE_FLOAT64_C(    27.98), SIMDE_FLOAT64_C(    19.54) } },
+    { { SIMDE_FLOAT64_C(   632.51), SIMDE_FLOAT64_C(   847.46) },
+      { SIMDE_FLOAT64_C(    25.15), SIMDE_FLOAT64_C(    29.11) } },
+    { { SIMDE_FLOAT64_C(   570.65), SIMDE_FLOAT64_C(   125.84) },
+      { SIMDE_FLOAT64_C(    23.89), SIMDE_FLOAT64_C(    11.22) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t r = simde_vsqrtq_f64(a);
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsqrth_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsqrt_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsqrt_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsqrt_f64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsqrtq_f16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsqrtq_f32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsqrtq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,374 @@
+#define SIMDE_TEST_ARM_NEON_INSN st1_x2
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st1_x2.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst1_f32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t val[2][2];
+    simde_float32_t r[4];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT32_C(  -466.84), SIMDE_FLOAT32_C(  -603.82) },
+        { SIMDE_FLOAT32_C(   572.45), SIMDE_FLOAT32_C(   108.35) } },
+      { SIMDE_FLOAT32_C(  -466.84), SIMDE_FLOAT32_C(  -603.82), SIMDE_FLOAT32_C(   572.45), SIMDE_FLOAT32_C(   108.35) } },
+    { { { SIMDE_FLOAT32_C(   881.17), SIMDE_FLOAT32_C(   999.30) },
+        { SIMDE_FLOAT32_C(   758.48), SIMDE_FLOAT32_C(  -889.08) } },
+      { SIMDE_FLOAT32_C(   881.17), SIMDE_FLOAT32_C(   999.30), SIMDE_FLOAT32_C(   758.48), SIMDE_FLOAT32_C(  -889.08) } },
+    { { { SIMDE_FLOAT32_C(  -620.92), SIMDE_FLOAT32_C(   952.77) },
+        { SIMDE_FLOAT32_C(  -355.65), SIMDE_FLOAT32_C(  -306.79) } },
+      { SIMDE_FLOAT32_C(  -620.92), SIMDE_FLOAT32_C(   952.77), SIMDE_FLOAT32_C(  -355.65), SIMDE_FLOAT32_C(  -306.79) } },
+    { { { SIMDE_FLOAT32_C(  -731.91), SIMDE_FLOAT32_C(   341.03) },
+        { SIMDE_FLOAT32_C(   559.84), SIMDE_FLOAT32_C(   709.52) } },
+      { SIMDE_FLOAT32_C(  -731.91), SIMDE_FLOAT32_C(   341.03), SIMDE_FLOAT32_C(   559.84), SIMDE_FLOAT32_C(   709.52) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t val = { {
+      simde_vld1_f32(test_vec[i].val[0]),
+      simde_vld1_f32(test_vec[i].val[1]) } };
+    simde_float32_t r[4];
+
+    simde_vst1_f32_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_f64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t val[2][1];
+    simde_float64_t r[2];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT64_C(  -245.01) },
+        { SIMDE_FLOAT64_C(  -676.54) } },
+      { SIMDE_FLOAT64_C(  -245.01), SIMDE_FLOAT64_C(  -676.54) } },
+    { { { SIMDE_FLOAT64_C(  -459.99) },
+        { SIMDE_FLOAT64_C(  -988.84) } },
+      { SIMDE_FLOAT64_C(  -459.99), SIMDE_FLOAT64_C(  -988.84) } },
+    { { { SIMDE_FLOAT64_C(  -713.65) },
+        { SIMDE_FLOAT64_C(   706.96) } },
+      { SIMDE_FLOAT64_C(  -713.65), SIMDE_FLOAT64_C(   706.96) } },
+    { { { SIMDE_FLOAT64_C(   101.47) },
+        { SIMDE_FLOAT64_C(  -952.89) } },
+      { SIMDE_FLOAT64_C(   101.47), SIMDE_FLOAT64_C(  -952.89) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t val = { {
+      simde_vld1_f64(test_vec[i].val[0]),
+      simde_vld1_f64(test_vec[i].val[1]) } };
+    simde_float64_t r[2];
+
+    simde_vst1_f64_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t val[2][8];
+    int8_t r[16];
+  } test_vec[] = {
+    { { {  INT8_C( 92), -INT8_C( 88), -INT8_C(127),  INT8_C(118), -INT8_C( 28),  INT8_C( 75),  INT8_C(116), -INT8_C(126) },
+        {  INT8_C(103),  INT8_C( 69),  INT8_C( 24), -INT8_C( 83), -INT8_C( 78),  INT8_C(  6),  INT8_C( 55),  INT8_C( 50) } },
+      {  INT8_C( 92), -INT8_C( 88), -INT8_C(127),  INT8_C(118), -INT8_C( 28),  INT8_C( 75),  INT8_C(116), -INT8_C(126),
+         INT8_C(103),  INT8_C( 69),  INT8_C( 24), -INT8_C( 83), -INT8_C( 78),  INT8_C(  6),  INT8_C( 55),  INT8_C( 50) } },
+    { { { -INT8_C( 35),     INT8_MIN,  INT8_C( 19),  INT8_C( 96), -INT8_C(122), -INT8_C( 87),  INT8_C( 97),  INT8_C( 84) },
+        { -INT8_C( 21),  INT8_C( 21),  INT8_C( 38),  INT8_C( 86),  INT8_C(122),  INT8_C( 74),  INT8_C( 13),  INT8_C( 62) } },
+      { -INT8_C( 35),     INT8_MIN,  INT8_C( 19),  INT8_C( 96), -INT8_C(122), -INT8_C( 87),  INT8_C( 97),  INT8_C( 84),
+        -INT8_C( 21),  INT8_C( 21),  INT8_C( 38),  INT8_C( 86),  INT8_C(122),  INT8_C( 74),  INT8_C( 13),  INT8_C( 62) } },
+    { { { -INT8_C( 83),  INT8_C(  2), -INT8_C(  6), -INT8_C( 15), -INT8_C( 52), -INT8_C( 18), -INT8_C( 38),  INT8_C(115) },
+        {  INT8_C( 32), -INT8_C( 25), -INT8_C( 34), -INT8_C( 37),  INT8_C( 78),  INT8_C(115),  INT8_C(102),  INT8_C( 91) } },
+      { -INT8_C( 83),  INT8_C(  2), -INT8_C(  6), -INT8_C( 15), -INT8_C( 52), -INT8_C( 18), -INT8_C( 38),  INT8_C(115),
+         INT8_C( 32), -INT8_C( 25), -INT8_C( 34), -INT8_C( 37),  INT8_C( 78),  INT8_C(115),  INT8_C(102),  INT8_C( 91) } },
+    { { { -INT8_C( 17),  INT8_C(121),  INT8_C( 28), -INT8_C(  3),  INT8_C( 31),  INT8_C( 84),  INT8_C( 55),  INT8_C( 22) },
+        { -INT8_C( 30),  INT8_C( 75),  INT8_C(116), -INT8_C( 77),  INT8_C( 72), -INT8_C( 67),  INT8_C( 71), -INT8_C( 68) } },
+      { -INT8_C( 17),  INT8_C(121),  INT8_C( 28), -INT8_C(  3),  INT8_C( 31),  INT8_C( 84),  INT8_C( 55),  INT8_C( 22),
+        -INT8_C( 30),  INT8_C( 75),  INT8_C(116), -INT8_C( 77),  INT8_C( 72), -INT8_C( 67),  INT8_C( 71), -INT8_C( 68) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t val = { {
+      simde_vld1_s8(test_vec[i].val[0]),
+      simde_vld1_s8(test_vec[i].val[1]) } };
+    int8_t r[16];
+
+    simde_vst1_s8_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t val[2][4];
+    int16_t r[8];
+  } test_vec[] = {
+    { { {  INT16_C(22458),  INT16_C(29943),  INT16_C(11342),  INT16_C(15824) },
+        { -INT16_C( 5231),  INT16_C(13186), -INT16_C(12549),  INT16_C(23557) } },
+      {  INT16_C(22458),  INT16_C(29943),  INT16_C(11342),  INT16_C(15824), -INT16_C( 5231),  INT16_C(13186), -INT16_C(12549),  INT16_C(23557) } },
+    { { { -INT16_C( 2729),  INT16_C(13800),  INT16_C(10792),  INT16_C( 9689) },
+        {  INT16_C(23831),  INT16_C( 6745),  INT16_C(12914),  INT16_C(10501) } },
+      { -INT16_C( 2729),  INT16_C(13800),  INT16_C(10792),  INT16_C( 9689),  INT16_C(23831),  INT16_C( 6745),  INT16_C(12914),  INT16_C(10501) } },
+    { { { -INT16_C(18403),  INT16_C( 9088), -INT16_C( 9409), -INT16_C(22719) },
+        {  INT16_C(   93),  INT16_C(15401),  INT16_C(18433),  INT16_C( 3562) } },
+      { -INT16_C(18403),  INT16_C( 9088), -INT16_C( 9409), -INT16_C(22719),  INT16_C(   93),  INT16_C(15401),  INT16_C(18433),  INT16_C( 3562) } },
+    { { { -INT16_C( 8672),  INT16_C(14010),  INT16_C(12139),  INT16_C(14160) },
+        {  INT16_C( 8657), -INT16_C(20725),  INT16_C(13655), -INT16_C(30938) } },
+      { -INT16_C( 8672),  INT16_C(14010),  INT16_C(12139),  INT16_C(14160),  INT16_C( 8657), -INT16_C(20725),  INT16_C(13655), -INT16_C(30938) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t val = { {
+      simde_vld1_s16(test_vec[i].val[0]),
+      simde_vld1_s16(test_vec[i].val[1]) } };
+    int16_t r[8];
+
+    simde_vst1_s16_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t val[2][2];
+    int32_t r[4];
+  } test_vec[] = {
+    { { { -INT32_C( 346481715), -INT32_C(2030079771) },
+        { -INT32_C(1392740002),  INT32_C(1578443387) } },
+      { -INT32_C( 346481715), -INT32_C(2030079771), -INT32_C(1392740002),  INT32_C(1578443387) } },
+    { { {  INT32_C( 353353897), -INT32_C(1395945593) },
+        {  INT32_C(1657912013), -INT32_C(1470690245) } },
+      {  INT32_C( 353353897), -INT32_C(1395945593),  INT32_C(1657912013), -INT32_C(1470690245) } },
+    { { { -INT32_C(1941145253),  INT32_C( 815580498) },
+        {  INT32_C( 506195617),  INT32_C(1314653048) } },
+      { -INT32_C(1941145253),  INT32_C( 815580498),  INT32_C( 506195617),  INT32_C(1314653048) } },
+    { { { -INT32_C( 244581879), -INT32_C( 797980575) },
+        {  INT32_C(1317326889), -INT32_C( 704226721) } },
+      { -INT32_C( 244581879), -INT32_C( 797980575),  INT32_C(1317326889), -INT32_C( 704226721) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t val = { {
+      simde_vld1_s32(test_vec[i].val[0]),
+      simde_vld1_s32(test_vec[i].val[1]) } };
+    int32_t r[4];
+
+    simde_vst1_s32_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t val[2][1];
+    int64_t r[2];
+  } test_vec[] = {
+    { { { -INT64_C(3932197070352830461) },
+        {  INT64_C( 241384037440168913) } },
+      { -INT64_C(3932197070352830461),  INT64_C( 241384037440168913) } },
+    { { { -INT64_C(4427310687954216864) },
+        {  INT64_C(7197725725490379520) } },
+      { -INT64_C(4427310687954216864),  INT64_C(7197725725490379520) } },
+    { { { -INT64_C( 443570497355239905) },
+        {  INT64_C(9116984905080430192) } },
+      { -INT64_C( 443570497355239905),  INT64_C(9116984905080430192) } },
+    { { { -INT64_C(8150870536731065765) },
+        { -INT64_C(6119320046462273933) } },
+      { -INT64_C(8150870536731065765), -INT64_C(6119320046462273933) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t val = { {
+      simde_vld1_s64(test_vec[i].val[0]),
+      simde_vld1_s64(test_vec[i].val[1]) } };
+    int64_t r[2];
+
+    simde_vst1_s64_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t val[2][8];
+    uint8_t r[16];
+  } test_vec[] = {
+    { { { UINT8_C( 34), UINT8_C(104), UINT8_C(223), UINT8_C(185), UINT8_C(202), UINT8_C(154), UINT8_C(150), UINT8_C(152) },
+        { UINT8_C(183), UINT8_C( 88), UINT8_C( 48), UINT8_C(174), UINT8_C(233), UINT8_C(210), UINT8_C(139), UINT8_C(187) } },
+      { UINT8_C( 34), UINT8_C(104), UINT8_C(223), UINT8_C(185), UINT8_C(202), UINT8_C(154), UINT8_C(150), UINT8_C(152),
+        UINT8_C(183), UINT8_C( 88), UINT8_C( 48), UINT8_C(174), UINT8_C(233), UINT8_C(210), UINT8_C(139), UINT8_C(187) } },
+    { { { UINT8_C( 72), UINT8_C( 90), UINT8_C(239), UINT8_C(112), UINT8_C( 98), UINT8_C( 90), UINT8_C(112), UINT8_C( 56) },
+        { UINT8_C(  8), UINT8_C( 76), UINT8_C( 31), UINT8_C(209), UINT8_C( 87), UINT8_C( 18), UINT8_C( 28), UINT8_C( 56) } },
+      { UINT8_C( 72), UINT8_C( 90), UINT8_C(239), UINT8_C(112), UINT8_C( 98), UINT8_C( 90), UINT8_C(112), UINT8_C( 56),
+        UINT8_C(  8), UINT8_C( 76), UINT8_C( 31), UINT8_C(209), UINT8_C( 87), UINT8_C( 18), UINT8_C( 28), UINT8_C( 56) } },
+    { { { UINT8_C(107), UINT8_C(248), UINT8_C( 18), UINT8_C(191), UINT8_C(184), UINT8_C(167), UINT8_C( 28), UINT8_C( 38) },
+        { UINT8_C(124), UINT8_C(  9), UINT8_C(213),    UINT8_MAX, UINT8_C(218), UINT8_C(179), UINT8_C( 29), UINT8_C(252) } },
+      { UINT8_C(107), UINT8_C(248), UINT8_C( 18), UINT8_C(191), UINT8_C(184), UINT8_C(167), UINT8_C( 28), UINT8_C( 38),
+        UINT8_C(124), UINT8_C(  9), UINT8_C(213),    UINT8_MAX, UINT8_C(218), UINT8_C(179), UINT8_C( 29), UINT8_C(252) } },
+    { { { UINT8_C(126), UINT8_C( 13), UINT8_C(226), UINT8_C(252), UINT8_C( 59), UINT8_C(243), UINT8_C( 79), UINT8_C(102) },
+        { UINT8_C(170), UINT8_C(172), UINT8_C(121), UINT8_C(137), UINT8_C(200), UINT8_C(254), UINT8_C( 48), UINT8_C(241) } },
+      { UINT8_C(126), UINT8_C( 13), UINT8_C(226), UINT8_C(252), UINT8_C( 59), UINT8_C(243), UINT8_C( 79), UINT8_C(102),
+        UINT8_C(170), UINT8_C(172), UINT8_C(121), UINT8_C(137), UINT8_C(200), UINT8_C(254), UINT8_C( 48), UINT8_C(241) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t val = { {
+      simde_vld1_u8(test_vec[i].val[0]),
+      simde_vld1_u8(test_vec[i].val[1]) } };
+    uint8_t r[16];
+
+    simde_vst1_u8_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t val[2][4];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { { UINT16_C( 6042), UINT16_C( 8823), UINT16_C(18402), UINT16_C(62650) },
+        { UINT16_C(24923), UINT16_C(25880), UINT16_C(58630), UINT16_C(17248) } },
+      { UINT16_C( 6042), UINT16_C( 8823), UINT16_C(18402), UINT16_C(62650), UINT16_C(24923), UINT16_C(25880), UINT16_C(58630), UINT16_C(17248) } },
+    { { { UINT16_C(64069), UINT16_C(35843), UINT16_C(37536), UINT16_C( 6344) },
+        { UINT16_C(14460), UINT16_C(56683), UINT16_C(31673), UINT16_C(13257) } },
+      { UINT16_C(64069), UINT16_C(35843), UINT16_C(37536), UINT16_C( 6344), UINT16_C(14460), UINT16_C(56683), UINT16_C(31673), UINT16_C(13257) } },
+    { { { UINT16_C(40352), UINT16_C(44094), UINT16_C(15497), UINT16_C(55777) },
+        { UINT16_C( 2268), UINT16_C(37519), UINT16_C(40822), UINT16_C(11942) } },
+      { UINT16_C(40352), UINT16_C(44094), UINT16_C(15497), UINT16_C(55777), UINT16_C( 2268), UINT16_C(37519), UINT16_C(40822), UINT16_C(11942) } },
+    { { { UINT16_C(17552), UINT16_C( 9917), UINT16_C(31681), UINT16_C(57233) },
+        { UINT16_C(58532), UINT16_C(37586), UINT16_C(12947), UINT16_C(50172) } },
+      { UINT16_C(17552), UINT16_C( 9917), UINT16_C(31681), UINT16_C(57233), UINT16_C(58532), UINT16_C(37586), UINT16_C(12947), UINT16_C(50172) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t val = { {
+      simde_vld1_u16(test_vec[i].val[0]),
+      simde_vld1_u16(test_vec[i].val[1]) } };
+    uint16_t r[8];
+
+    simde_vst1_u16_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t val[2][2];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { { UINT32_C(1188462863), UINT32_C(4001732700) },
+        { UINT32_C(1657379333), UINT32_C(2567310251) } },
+      { UINT32_C(1188462863), UINT32_C(4001732700), UINT32_C(1657379333), UINT32_C(2567310251) } },
+    { { { UINT32_C(2038245697), UINT32_C(1559184274) },
+        { UINT32_C(2868593501), UINT32_C(1611664193) } },
+      { UINT32_C(2038245697), UINT32_C(1559184274), UINT32_C(2868593501), UINT32_C(1611664193) } },
+    { { { UINT32_C(2092502583), UINT32_C(  90916652) },
+        { UINT32_C(2870676080), UINT32_C(3702237902) } },
+      { UINT32_C(2092502583), UINT32_C(  90916652), UINT32_C(2870676080), UINT32_C(3702237902) } },
+    { { { UINT32_C( 145021307), UINT32_C( 732243208) },
+        { UINT32_C(1456466711), UINT32_C( 284784593) } },
+      { UINT32_C( 145021307), UINT32_C( 732243208), UINT32_C(1456466711), UINT32_C( 284784593) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t val = { {
+      simde_vld1_u32(test_vec[i].val[0]),
+      simde_vld1_u32(test_vec[i].val[1]) } };
+    uint32_t r[4];
+
+    simde_vst1_u32_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t val[2][1];
+    uint64_t r[2];
+  } test_vec[] = {
+    { { { UINT64_C(15147814325937669237) },
+        { UINT64_C(18135980393701802400) } },
+      { UINT64_C(15147814325937669237), UINT64_C(18135980393701802400) } },
+    { { { UINT64_C( 2709493246305408091) },
+        { UINT64_C( 5565835314708919573) } },
+      { UINT64_C( 2709493246305408091), UINT64_C( 5565835314708919573) } },
+    { { { UINT64_C( 6642262988685481245) },
+        { UINT64_C( 1942010073135830905) } },
+      { UINT64_C( 6642262988685481245), UINT64_C( 1942010073135830905) } },
+    { { { UINT64_C(14703759162678668267) },
+        { UINT64_C(12820268981329235616) } },
+      { UINT64_C(14703759162678668267), UINT64_C(12820268981329235616) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t val = { {
+      simde_vld1_u64(test_vec[i].val[0]),
+      simde_vld1_u64(test_vec[i].val[1]) } };
+    uint64_t r[2];
+
+    simde_vst1_u64_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_f32_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_f64_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s8_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s16_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s32_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s64_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u8_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u16_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u32_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u64_x2)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,444 @@
+#define SIMDE_TEST_ARM_NEON_INSN st1_x3
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st1_x3.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst1_f32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t val[3][2];
+    simde_float32_t r[6];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT32_C(  -500.95), SIMDE_FLOAT32_C(   133.15) },
+        { SIMDE_FLOAT32_C(   831.35), SIMDE_FLOAT32_C(   641.88) },
+        { SIMDE_FLOAT32_C(   426.99), SIMDE_FLOAT32_C(  -927.04) } },
+      { SIMDE_FLOAT32_C(  -500.95), SIMDE_FLOAT32_C(   133.15), SIMDE_FLOAT32_C(   831.35), SIMDE_FLOAT32_C(   641.88),
+        SIMDE_FLOAT32_C(   426.99), SIMDE_FLOAT32_C(  -927.04) } },
+    { { { SIMDE_FLOAT32_C(   308.19), SIMDE_FLOAT32_C(  -418.74) },
+        { SIMDE_FLOAT32_C(   275.46), SIMDE_FLOAT32_C(   122.03) },
+        { SIMDE_FLOAT32_C(    74.97), SIMDE_FLOAT32_C(  -585.95) } },
+      { SIMDE_FLOAT32_C(   308.19), SIMDE_FLOAT32_C(  -418.74), SIMDE_FLOAT32_C(   275.46), SIMDE_FLOAT32_C(   122.03),
+        SIMDE_FLOAT32_C(    74.97), SIMDE_FLOAT32_C(  -585.95) } },
+    { { { SIMDE_FLOAT32_C(  -714.56), SIMDE_FLOAT32_C(   608.22) },
+        { SIMDE_FLOAT32_C(  -244.33), SIMDE_FLOAT32_C(  -299.39) },
+        { SIMDE_FLOAT32_C(  -455.55), SIMDE_FLOAT32_C(  -594.56) } },
+      { SIMDE_FLOAT32_C(  -714.56), SIMDE_FLOAT32_C(   608.22), SIMDE_FLOAT32_C(  -244.33), SIMDE_FLOAT32_C(  -299.39),
+        SIMDE_FLOAT32_C(  -455.55), SIMDE_FLOAT32_C(  -594.56) } },
+    { { { SIMDE_FLOAT32_C(  -700.98), SIMDE_FLOAT32_C(   151.03) },
+        { SIMDE_FLOAT32_C(   529.74), SIMDE_FLOAT32_C(   999.50) },
+        { SIMDE_FLOAT32_C(   760.54), SIMDE_FLOAT32_C(   565.05) } },
+      { SIMDE_FLOAT32_C(  -700.98), SIMDE_FLOAT32_C(   151.03), SIMDE_FLOAT32_C(   529.74), SIMDE_FLOAT32_C(   999.50),
+        SIMDE_FLOAT32_C(   760.54), SIMDE_FLOAT32_C(   565.05) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x3_t val = { {
+      simde_vld1_f32(test_vec[i].val[0]),
+      simde_vld1_f32(test_vec[i].val[1]),
+      simde_vld1_f32(test_vec[i].val[2]) } };
+    simde_float32_t r[6];
+
+    simde_vst1_f32_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_f64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t val[3][1];
+    simde_float64_t r[3];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT64_C(  -616.09) },
+        { SIMDE_FLOAT64_C(   566.20) },
+        { SIMDE_FLOAT64_C(  -638.94) } },
+      { SIMDE_FLOAT64_C(  -616.09), SIMDE_FLOAT64_C(   566.20), SIMDE_FLOAT64_C(  -638.94) } },
+    { { { SIMDE_FLOAT64_C(   293.96) },
+        { SIMDE_FLOAT64_C(   602.72) },
+        { SIMDE_FLOAT64_C(   572.68) } },
+      { SIMDE_FLOAT64_C(   293.96), SIMDE_FLOAT64_C(   602.72), SIMDE_FLOAT64_C(   572.68) } },
+    { { { SIMDE_FLOAT64_C(   799.83) },
+        { SIMDE_FLOAT64_C(  -309.12) },
+        { SIMDE_FLOAT64_C(   106.98) } },
+      { SIMDE_FLOAT64_C(   799.83), SIMDE_FLOAT64_C(  -309.12), SIMDE_FLOAT64_C(   106.98) } },
+    { { { SIMDE_FLOAT64_C(    87.04) },
+        { SIMDE_FLOAT64_C(   933.47) },
+        { SIMDE_FLOAT64_C(  -795.48) } },
+      { SIMDE_FLOAT64_C(    87.04), SIMDE_FLOAT64_C(   933.47), SIMDE_FLOAT64_C(  -795.48) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x3_t val = { {
+      simde_vld1_f64(test_vec[i].val[0]),
+      simde_vld1_f64(test_vec[i].val[1]),
+      simde_vld1_f64(test_vec[i].val[2]) } };
+    simde_float64_t r[3];
+
+    simde_vst1_f64_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t val[3][8];
+    int8_t r[24];
+  } test_vec[] = {
+    { { { -INT8_C( 67), -INT8_C( 74),  INT8_C( 59),  INT8_C(105),  INT8_C( 65), -INT8_C( 85),  INT8_C(  5), -INT8_C( 56) },
+        { -INT8_C(124), -INT8_C( 65),  INT8_C(121),  INT8_C( 29), -INT8_C( 24), -INT8_C( 29),  INT8_C(  4), -INT8_C( 13) },
+        { -INT8_C( 24), -INT8_C(109),  INT8_C( 55), -INT8_C( 45), -INT8_C( 33),  INT8_C( 96), -INT8_C( 49),  INT8_C( 56) } },
+      { -INT8_C( 67), -INT8_C( 74),  INT8_C( 59),  INT8_C(105),  INT8_C( 65), -INT8_C( 85),  INT8_C(  5), -INT8_C( 56),
+        -INT8_C(124), -INT8_C( 65),  INT8_C(121),  INT8_C( 29), -INT8_C( 24), -INT8_C( 29),  INT8_C(  4), -INT8_C( 13),
+        -INT8_C( 24), -INT8_C(109),  INT8_C( 55), -INT8_C( 45), -INT8_C( 33),  INT8_C( 96), -INT8_C( 49),  INT8_C( 56) } },
+    { { {  INT8_C(114), -INT8_C( 44),  INT8_C(106), -INT8_C( 47), -INT8_C(  5), -INT8_C( 34),  INT8_C( 98),  INT8_C( 48) },
+        { -INT8_C(106),  INT8_C( 87),  INT8_C(  6), -INT8_C( 17),  INT8_C( 84), -INT8_C( 82),  INT8_C(117),  INT8_C(104) },
+        {  INT8_C(111),  INT8_C( 42), -INT8_C( 52), -INT8_C( 22), -INT8_C( 20), -INT8_C( 85),  INT8_C(121), -INT8_C( 90) } },
+      {  INT8_C(114), -INT8_C( 44),  INT8_C(106), -INT8_C( 47), -INT8_C(  5), -INT8_C( 34),  INT8_C( 98),  INT8_C( 48),
+        -INT8_C(106),  INT8_C( 87),  INT8_C(  6), -INT8_C( 17),  INT8_C( 84), -INT8_C( 82),  INT8_C(117),  INT8_C(104),
+         INT8_C(111),  INT8_C( 42), -INT8_C( 52), -INT8_C( 22), -INT8_C( 20), -INT8_C( 85),  INT8_C(121), -INT8_C( 90) } },
+    { { { -INT8_C( 82),  INT8_C( 49), -INT8_C(106), -INT8_C( 71), -INT8_C( 47),  INT8_C(123),  INT8_C( 56), -INT8_C( 13) },
+        { -INT8_C( 80),  INT8_C( 79), -INT8_C( 26), -INT8_C( 88), -INT8_C(118), -INT8_C( 18), -INT8_C( 97),  INT8_C(  2) },
+        {  INT8_C(125), -INT8_C( 95), -INT8_C( 42), -INT8_C( 60),  INT8_C( 81),  INT8_C(108),  INT8_C( 97),  INT8_C( 80) } },
+      { -INT8_C( 82),  INT8_C( 49), -INT8_C(106), -INT8_C( 71), -INT8_C( 47),  INT8_C(123),  INT8_C( 56), -INT8_C( 13),
+        -INT8_C( 80),  INT8_C( 79), -INT8_C( 26), -INT8_C( 88), -INT8_C(118), -INT8_C( 18), -INT8_C( 97),  INT8_C(  2),
+         INT8_C(125), -INT8_C( 95), -INT8_C( 42), -INT8_C( 60),  INT8_C( 81),  INT8_C(108),  INT8_C( 97),  INT8_C( 80) } },
+    { { {  INT8_C( 82), -INT8_C( 65),  INT8_C( 79), -INT8_C( 84), -INT8_C( 82),  INT8_C( 83),  INT8_C( 96),  INT8_C(119) },
+        { -INT8_C( 44), -INT8_C(  1),  INT8_C( 72), -INT8_C( 78),  INT8_C( 73), -INT8_C(  6),  INT8_C(117),  INT8_C( 43) },
+        {  INT8_C( 77),  INT8_C( 48),  INT8_C(100),  INT8_C( 76),  INT8_C( 73), -INT8_C(108), -INT8_C( 19),  INT8_C(  7) } },
+      {  INT8_C( 82), -INT8_C( 65),  INT8_C( 79), -INT8_C( 84), -INT8_C( 82),  INT8_C( 83),  INT8_C( 96),  INT8_C(119),
+        -INT8_C( 44), -INT8_C(  1),  INT8_C( 72), -INT8_C( 78),  INT8_C( 73), -INT8_C(  6),  INT8_C(117),  INT8_C( 43),
+         INT8_C( 77),  INT8_C( 48),  INT8_C(100),  INT8_C( 76),  INT8_C( 73), -INT8_C(108), -INT8_C( 19),  INT8_C(  7) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x3_t val = { {
+      simde_vld1_s8(test_vec[i].val[0]),
+      simde_vld1_s8(test_vec[i].val[1]),
+      simde_vld1_s8(test_vec[i].val[2]) } };
+    int8_t r[24];
+
+    simde_vst1_s8_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t val[3][4];
+    int16_t r[12];
+  } test_vec[] = {
+    { { {  INT16_C(24739), -INT16_C( 9023), -INT16_C(27075),  INT16_C(15507) },
+        { -INT16_C(21519), -INT16_C(28475), -INT16_C(23331), -INT16_C(  517) },
+        { -INT16_C(15289), -INT16_C(28570),  INT16_C(32139), -INT16_C( 6518) } },
+      {  INT16_C(24739), -INT16_C( 9023), -INT16_C(27075),  INT16_C(15507), -INT16_C(21519), -INT16_C(28475), -INT16_C(23331), -INT16_C(  517),
+        -INT16_C(15289), -INT16_C(28570),  INT16_C(32139), -INT16_C( 6518) } },
+    { { { -INT16_C(11269), -INT16_C(28749), -INT16_C(28022), -INT16_C( 8359) },
+        { -INT16_C(31828),  INT16_C(26416),  INT16_C( 4716), -INT16_C(31473) },
+        { -INT16_C(16448),  INT16_C( 3637), -INT16_C(28696), -INT16_C(30791) } },
+      { -INT16_C(11269), -INT16_C(28749), -INT16_C(28022), -INT16_C( 8359), -INT16_C(31828),  INT16_C(26416),  INT16_C( 4716), -INT16_C(31473),
+        -INT16_C(16448),  INT16_C( 3637), -INT16_C(28696), -INT16_C(30791) } },
+    { { {  INT16_C( 8107), -INT16_C(11336), -INT16_C(17447),  INT16_C(25720) },
+        { -INT16_C( 8664),  INT16_C( 8935),  INT16_C(28883),  INT16_C(29701) },
+        {  INT16_C(29323), -INT16_C( 4208),  INT16_C(15244),  INT16_C( 4758) } },
+      {  INT16_C( 8107), -INT16_C(11336), -INT16_C(17447),  INT16_C(25720), -INT16_C( 8664),  INT16_C( 8935),  INT16_C(28883),  INT16_C(29701),
+         INT16_C(29323), -INT16_C( 4208),  INT16_C(15244),  INT16_C( 4758) } },
+    { { { -INT16_C(10245), -INT16_C(22317),  INT16_C(21359), -INT16_C(19627) },
+        {  INT16_C( 4620),  INT16_C(23305),  INT16_C( 6384), -INT16_C(18935) },
+        { -INT16_C(15203),  INT16_C(31187), -INT16_C(23295),  INT16_C(30426) } },
+      { -INT16_C(10245), -INT16_C(22317),  INT16_C(21359), -INT16_C(19627),  INT16_C( 4620),  INT16_C(23305),  INT16_C( 6384), -INT16_C(18935),
+        -INT16_C(15203),  INT16_C(31187), -INT16_C(23295),  INT16_C(30426) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x3_t val = { {
+      simde_vld1_s16(test_vec[i].val[0]),
+      simde_vld1_s16(test_vec[i].val[1]),
+      simde_vld1_s16(test_vec[i].val[2]) } };
+    int16_t r[12];
+
+    simde_vst1_s16_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t val[3][2];
+    int32_t r[6];
+  } test_vec[] = {
+    { { {  INT32_C( 984305410), -INT32_C(2087288377) },
+        { -INT32_C(1978310197), -INT32_C(1305104195) },
+        {  INT32_C( 785347886),  INT32_C(  81980037) } },
+      {  INT32_C( 984305410), -INT32_C(2087288377), -INT32_C(1978310197), -INT32_C(1305104195),  INT32_C( 785347886),  INT32_C(  81980037) } },
+    { { { -INT32_C(1906146933),  INT32_C(1008008870) },
+        { -INT32_C( 811230560), -INT32_C(1749852276) },
+        {  INT32_C( 205907224), -INT32_C(1422996794) } },
+      { -INT32_C(1906146933),  INT32_C(1008008870), -INT32_C( 811230560), -INT32_C(1749852276),  INT32_C( 205907224), -INT32_C(1422996794) } },
+    { { {  INT32_C(1823645626), -INT32_C(1818323680) },
+        {  INT32_C( 953672097),  INT32_C( 609818202) },
+        { -INT32_C(1397593252), -INT32_C( 322797467) } },
+      {  INT32_C(1823645626), -INT32_C(1818323680),  INT32_C( 953672097),  INT32_C( 609818202), -INT32_C(1397593252), -INT32_C( 322797467) } },
+    { { { -INT32_C( 729843176),  INT32_C( 211281368) },
+        {  INT32_C( 524178037),  INT32_C(1424611631) },
+        {  INT32_C( 517146483), -INT32_C(1586058545) } },
+      { -INT32_C( 729843176),  INT32_C( 211281368),  INT32_C( 524178037),  INT32_C(1424611631),  INT32_C( 517146483), -INT32_C(1586058545) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x3_t val = { {
+      simde_vld1_s32(test_vec[i].val[0]),
+      simde_vld1_s32(test_vec[i].val[1]),
+      simde_vld1_s32(test_vec[i].val[2]) } };
+    int32_t r[6];
+
+    simde_vst1_s32_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t val[3][1];
+    int64_t r[3];
+  } test_vec[] = {
+    { { { -INT64_C(4013747620567159641) },
+        {  INT64_C(8293261867853479462) },
+        { -INT64_C(4359338250087191399) } },
+      { -INT64_C(4013747620567159641),  INT64_C(8293261867853479462), -INT64_C(4359338250087191399) } },
+    { { { -INT64_C(3225639159648313954) },
+        { -INT64_C( 932639535556149919) },
+        {  INT64_C(3981989594689133254) } },
+      { -INT64_C(3225639159648313954), -INT64_C( 932639535556149919),  INT64_C(3981989594689133254) } },
+    { { { -INT64_C(6464879430504852581) },
+        {  INT64_C(6671834798828432293) },
+        { -INT64_C(1938277964371117399) } },
+      { -INT64_C(6464879430504852581),  INT64_C(6671834798828432293), -INT64_C(1938277964371117399) } },
+    { { { -INT64_C(1264817116763913668) },
+        {  INT64_C(2136698420564609790) },
+        {  INT64_C(4427673529542894942) } },
+      { -INT64_C(1264817116763913668),  INT64_C(2136698420564609790),  INT64_C(4427673529542894942) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x3_t val = { {
+      simde_vld1_s64(test_vec[i].val[0]),
+      simde_vld1_s64(test_vec[i].val[1]),
+      simde_vld1_s64(test_vec[i].val[2]) } };
+    int64_t r[3];
+
+    simde_vst1_s64_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t val[3][8];
+    uint8_t r[24];
+  } test_vec[] = {
+    { { { UINT8_C( 31), UINT8_C( 89), UINT8_C(129), UINT8_C( 31), UINT8_C( 85), UINT8_C(167), UINT8_C( 66), UINT8_C(141) },
+        { UINT8_C(  3), UINT8_C(212), UINT8_C( 13), UINT8_C(188), UINT8_C(193), UINT8_C(160), UINT8_C(136), UINT8_C( 99) },
+        { UINT8_C(115), UINT8_C(119), UINT8_C(182), UINT8_C(  4), UINT8_C( 66), UINT8_C( 26), UINT8_C(166), UINT8_C(147) } },
+      { UINT8_C( 31), UINT8_C( 89), UINT8_C(129), UINT8_C( 31), UINT8_C( 85), UINT8_C(167), UINT8_C( 66), UINT8_C(141),
+        UINT8_C(  3), UINT8_C(212), UINT8_C( 13), UINT8_C(188), UINT8_C(193), UINT8_C(160), UINT8_C(136), UINT8_C( 99),
+        UINT8_C(115), UINT8_C(119), UINT8_C(182), UINT8_C(  4), UINT8_C( 66), UINT8_C( 26), UINT8_C(166), UINT8_C(147) } },
+    { { { UINT8_C(198), UINT8_C(232), UINT8_C( 43), UINT8_C(127), UINT8_C(106), UINT8_C(225), UINT8_C(178), UINT8_C( 72) },
+        { UINT8_C(249), UINT8_C(238), UINT8_C( 57), UINT8_C(205), UINT8_C(181), UINT8_C( 23), UINT8_C(133), UINT8_C(247) },
+        { UINT8_C(172), UINT8_C(196), UINT8_C(107), UINT8_C(  5), UINT8_C(157), UINT8_C( 81), UINT8_C(213), UINT8_C(158) } },
+      { UINT8_C(198), UINT8_C(232), UINT8_C( 43), UINT8_C(127), UINT8_C(106), UINT8_C(225), UINT8_C(178), UINT8_C( 72),
+        UINT8_C(249), UINT8_C(238), UINT8_C( 57), UINT8_C(205), UINT8_C(181), UINT8_C( 23), UINT8_C(133), UINT8_C(247),
+        UINT8_C(172), UINT8_C(196), UINT8_C(107), UINT8_C(  5), UINT8_C(157), UINT8_C( 81), UINT8_C(213), UINT8_C(158) } },
+    { { { UINT8_C( 37), UINT8_C(137), UINT8_C( 85), UINT8_C(105), UINT8_C(121), UINT8_C(146), UINT8_C(171), UINT8_C( 20) },
+        { UINT8_C(226), UINT8_C(191), UINT8_C(127), UINT8_C( 13), UINT8_C(  8), UINT8_C( 50), UINT8_C( 48), UINT8_C( 83) },
+        { UINT8_C(117), UINT8_C(229), UINT8_C( 17), UINT8_C(150), UINT8_C( 85), UINT8_C(  0), UINT8_C(229), UINT8_C(224) } },
+      { UINT8_C( 37), UINT8_C(137), UINT8_C( 85), UINT8_C(105), UINT8_C(121), UINT8_C(146), UINT8_C(171), UINT8_C( 20),
+        UINT8_C(226), UINT8_C(191), UINT8_C(127), UINT8_C( 13), UINT8_C(  8), UINT8_C( 50), UINT8_C( 48), UINT8_C( 83),
+        UINT8_C(117), UINT8_C(229), UINT8_C( 17), UINT8_C(150), UINT8_C( 85), UINT8_C(  0), UINT8_C(229), UINT8_C(224) } },
+    { { { UINT8_C(193), UINT8_C( 67), UINT8_C(216), UINT8_C(202), UINT8_C( 66), UINT8_C( 98), UINT8_C(248), UINT8_C(153) },
+        { UINT8_C(114), UINT8_C(219), UINT8_C(105), UINT8_C(112), UINT8_C(144), UINT8_C(214), UINT8_C( 63), UINT8_C(182) },
+        { UINT8_C(234), UINT8_C( 85), UINT8_C( 55), UINT8_C( 94), UINT8_C(154), UINT8_C( 57), UINT8_C(136), UINT8_C(205) } },
+      { UINT8_C(193), UINT8_C( 67), UINT8_C(216), UINT8_C(202), UINT8_C( 66), UINT8_C( 98), UINT8_C(248), UINT8_C(153),
+        UINT8_C(114), UINT8_C(219), UINT8_C(105), UINT8_C(112), UINT8_C(144), UINT8_C(214), UINT8_C( 63), UINT8_C(182),
+        UINT8_C(234), UINT8_C( 85), UINT8_C( 55), UINT8_C( 94), UINT8_C(154), UINT8_C( 57), UINT8_C(136), UINT8_C(205) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x3_t val = { {
+      simde_vld1_u8(test_vec[i].val[0]),
+      simde_vld1_u8(test_vec[i].val[1]),
+      simde_vld1_u8(test_vec[i].val[2]) } };
+    uint8_t r[24];
+
+    simde_vst1_u8_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t val[3][4];
+    uint16_t r[12];
+  } test_vec[] = {
+    { { { UINT16_C(45062), UINT16_C( 9114), UINT16_C(26477), UINT16_C(53927) },
+        { UINT16_C( 1064), UINT16_C( 2494), UINT16_C(62710), UINT16_C(16470) },
+        { UINT16_C(40186), UINT16_C( 4490), UINT16_C(60709), UINT16_C(48116) } },
+      { UINT16_C(45062), UINT16_C( 9114), UINT16_C(26477), UINT16_C(53927), UINT16_C( 1064), UINT16_C( 2494), UINT16_C(62710), UINT16_C(16470),
+        UINT16_C(40186), UINT16_C( 4490), UINT16_C(60709), UINT16_C(48116) } },
+    { { { UINT16_C(48646), UINT16_C(10390), UINT16_C( 9866), UINT16_C(24639) },
+        { UINT16_C( 9145), UINT16_C(23895), UINT16_C(46594), UINT16_C(51944) },
+        { UINT16_C( 1350), UINT16_C( 3782), UINT16_C( 7482), UINT16_C( 6887) } },
+      { UINT16_C(48646), UINT16_C(10390), UINT16_C( 9866), UINT16_C(24639), UINT16_C( 9145), UINT16_C(23895), UINT16_C(46594), UINT16_C(51944),
+        UINT16_C( 1350), UINT16_C( 3782), UINT16_C( 7482), UINT16_C( 6887) } },
+    { { { UINT16_C(15496), UINT16_C(43757), UINT16_C(15560), UINT16_C( 2501) },
+        { UINT16_C(26015), UINT16_C(14395), UINT16_C(19038), UINT16_C(41567) },
+        { UINT16_C(24226), UINT16_C(19285), UINT16_C(51566), UINT16_C(12462) } },
+      { UINT16_C(15496), UINT16_C(43757), UINT16_C(15560), UINT16_C( 2501), UINT16_C(26015), UINT16_C(14395), UINT16_C(19038), UINT16_C(41567),
+        UINT16_C(24226), UINT16_C(19285), UINT16_C(51566), UINT16_C(12462) } },
+    { { { UINT16_C(25035), UINT16_C(15930), UINT16_C(18563), UINT16_C(34252) },
+        { UINT16_C( 9811), UINT16_C(11774), UINT16_C(45352), UINT16_C( 6332) },
+        { UINT16_C(46489), UINT16_C(11932), UINT16_C(64185), UINT16_C(30845) } },
+      { UINT16_C(25035), UINT16_C(15930), UINT16_C(18563), UINT16_C(34252), UINT16_C( 9811), UINT16_C(11774), UINT16_C(45352), UINT16_C( 6332),
+        UINT16_C(46489), UINT16_C(11932), UINT16_C(64185), UINT16_C(30845) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x3_t val = { {
+      simde_vld1_u16(test_vec[i].val[0]),
+      simde_vld1_u16(test_vec[i].val[1]),
+      simde_vld1_u16(test_vec[i].val[2]) } };
+    uint16_t r[12];
+
+    simde_vst1_u16_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t val[3][2];
+    uint32_t r[6];
+  } test_vec[] = {
+    { { { UINT32_C(2068030987), UINT32_C( 252070813) },
+        { UINT32_C(1269442319), UINT32_C(3340896202) },
+        { UINT32_C(3156736509), UINT32_C(3770605128) } },
+      { UINT32_C(2068030987), UINT32_C( 252070813), UINT32_C(1269442319), UINT32_C(3340896202), UINT32_C(3156736509), UINT32_C(3770605128) } },
+    { { { UINT32_C( 149510673), UINT32_C(3700992666) },
+        { UINT32_C( 418268203), UINT32_C(4180742790) },
+        { UINT32_C(2593099419), UINT32_C(  12894501) } },
+      { UINT32_C( 149510673), UINT32_C(3700992666), UINT32_C( 418268203), UINT32_C(4180742790), UINT32_C(2593099419), UINT32_C(  12894501) } },
+    { { { UINT32_C(  97192420), UINT32_C(1043354079) },
+        { UINT32_C(4186677730), UINT32_C(1523977463) },
+        { UINT32_C(1006828309), UINT32_C( 412526401) } },
+      { UINT32_C(  97192420), UINT32_C(1043354079), UINT32_C(4186677730), UINT32_C(1523977463), UINT32_C(1006828309), UINT32_C( 412526401) } },
+    { { { UINT32_C(1557756331), UINT32_C(2529800553) },
+        { UINT32_C(2879567898), UINT32_C(1275342295) },
+        { UINT32_C(2617880730), UINT32_C(1688418096) } },
+      { UINT32_C(1557756331), UINT32_C(2529800553), UINT32_C(2879567898), UINT32_C(1275342295), UINT32_C(2617880730), UINT32_C(1688418096) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x3_t val = { {
+      simde_vld1_u32(test_vec[i].val[0]),
+      simde_vld1_u32(test_vec[i].val[1]),
+      simde_vld1_u32(test_vec[i].val[2]) } };
+    uint32_t r[6];
+
+    simde_vst1_u32_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t val[3][1];
+    uint64_t r[3];
+  } test_vec[] = {
+    { { { UINT64_C( 9531107620121935427) },
+        { UINT64_C(14570524797626055095) },
+        { UINT64_C(11457396173622973965) } },
+      { UINT64_C( 9531107620121935427), UINT64_C(14570524797626055095), UINT64_C(11457396173622973965) } },
+    { { { UINT64_C(14622415920294443372) },
+        { UINT64_C( 6607005069164120333) },
+        { UINT64_C( 5819624716736403117) } },
+      { UINT64_C(14622415920294443372), UINT64_C( 6607005069164120333), UINT64_C( 5819624716736403117) } },
+    { { { UINT64_C( 1661784795534160021) },
+        { UINT64_C(11997970469127211888) },
+        { UINT64_C(16345658895768775672) } },
+      { UINT64_C( 1661784795534160021), UINT64_C(11997970469127211888), UINT64_C(16345658895768775672) } },
+    { { { UINT64_C( 6452613365349506984) },
+        { UINT64_C( 8971658720699765176) },
+        { UINT64_C( 9494158854634262285) } },
+      { UINT64_C( 6452613365349506984), UINT64_C( 8971658720699765176), UINT64_C( 9494158854634262285) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x3_t val = { {
+      simde_vld1_u64(test_vec[i].val[0]),
+      simde_vld1_u64(test_vec[i].val[1]),
+      simde_vld1_u64(test_vec[i].val[2]) } };
+    uint64_t r[3];
+
+    simde_vst1_u64_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_f32_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_f64_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s8_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s16_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s32_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s64_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u8_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u16_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u32_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u64_x3)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
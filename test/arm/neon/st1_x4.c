@@ -0,0 +1,502 @@
+#define SIMDE_TEST_ARM_NEON_INSN st1_x4
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st1_x4.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst1_f32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t val[4][2];
+    simde_float32_t r[8];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT32_C(   190.89), SIMDE_FLOAT32_C(  -180.31) },
+        { SIMDE_FLOAT32_C(  -975.64), SIMDE_FLOAT32_C(   316.11) },
+        { SIMDE_FLOAT32_C(  -499.72), SIMDE_FLOAT32_C(    24.06) },
+        { SIMDE_FLOAT32_C(  -528.75), SIMDE_FLOAT32_C(  -454.71) } },
+      { SIMDE_FLOAT32_C(   190.89), SIMDE_FLOAT32_C(  -180.31), SIMDE_FLOAT32_C(  -975.64), SIMDE_FLOAT32_C(   316.11),
+        SIMDE_FLOAT32_C(  -499.72), SIMDE_FLOAT32_C(    24.06), SIMDE_FLOAT32_C(  -528.75), SIMDE_FLOAT32_C(  -454.71) } },
+    { { { SIMDE_FLOAT32_C(   376.87), SIMDE_FLOAT32_C(  -520.85) },
+        { SIMDE_FLOAT32_C(  -913.66), SIMDE_FLOAT32_C(  -364.01) },
+        { SIMDE_FLOAT32_C(  -189.30), SIMDE_FLOAT32_C(  -651.90) },
+        { SIMDE_FLOAT32_C(  -529.06), SIMDE_FLOAT32_C(   871.81) } },
+      { SIMDE_FLOAT32_C(   376.87), SIMDE_FLOAT32_C(  -520.85), SIMDE_FLOAT32_C(  -913.66), SIMDE_FLOAT32_C(  -364.01),
+        SIMDE_FLOAT32_C(  -189.30), SIMDE_FLOAT32_C(  -651.90), SIMDE_FLOAT32_C(  -529.06), SIMDE_FLOAT32_C(   871.81) } },
+    { { { SIMDE_FLOAT32_C(  -973.32), SIMDE_FLOAT32_C(  -428.30) },
+        { SIMDE_FLOAT32_C(  -151.67), SIMDE_FLOAT32_C(  -653.27) },
+        { SIMDE_FLOAT32_C(   782.99), SIMDE_FLOAT32_C(   905.61) },
+        { SIMDE_FLOAT32_C(  -717.94), SIMDE_FLOAT32_C(  -451.30) } },
+      { SIMDE_FLOAT32_C(  -973.32), SIMDE_FLOAT32_C(  -428.30), SIMDE_FLOAT32_C(  -151.67), SIMDE_FLOAT32_C(  -653.27),
+        SIMDE_FLOAT32_C(   782.99), SIMDE_FLOAT32_C(   905.61), SIMDE_FLOAT32_C(  -717.94), SIMDE_FLOAT32_C(  -451.30) } },
+    { { { SIMDE_FLOAT32_C(   974.90), SIMDE_FLOAT32_C(   439.46) },
+        { SIMDE_FLOAT32_C(   713.16), SIMDE_FLOAT32_C(  -165.72) },
+        { SIMDE_FLOAT32_C(   515.19), SIMDE_FLOAT32_C(   399.86) },
+        { SIMDE_FLOAT32_C(   510.53), SIMDE_FLOAT32_C(   443.12) } },
+      { SIMDE_FLOAT32_C(   974.90), SIMDE_FLOAT32_C(   439.46), SIMDE_FLOAT32_C(   713.16), SIMDE_FLOAT32_C(  -165.72),
+        SIMDE_FLOAT32_C(   515.19), SIMDE_FLOAT32_C(   399.86), SIMDE_FLOAT32_C(   510.53), SIMDE_FLOAT32_C(   443.12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x4_t val = { {
+      simde_vld1_f32(test_vec[i].val[0]),
+      simde_vld1_f32(test_vec[i].val[1]),
+      simde_vld1_f32(test_vec[i].val[2]),
+      simde_vld1_f32(test_vec[i].val[3]) } };
+    simde_float32_t r[8];
+
+    simde_vst1_f32_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_f64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t val[4][1];
+    simde_float64_t r[4];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT64_C(   196.93) },
+        { SIMDE_FLOAT64_C(  -843.75) },
+        { SIMDE_FLOAT64_C(  -774.24) },
+        { SIMDE_FLOAT64_C(   342.96) } },
+      { SIMDE_FLOAT64_C(   196.93), SIMDE_FLOAT64_C(  -843.75), SIMDE_FLOAT64_C(  -774.24), SIMDE_FLOAT64_C(   342.96) } },
+    { { { SIMDE_FLOAT64_C(  -110.82) },
+        { SIMDE_FLOAT64_C(   704.50) },
+        { SIMDE_FLOAT64_C(   107.96) },
+        { SIMDE_FLOAT64_C(  -961.41) } },
+      { SIMDE_FLOAT64_C(  -110.82), SIMDE_FLOAT64_C(   704.50), SIMDE_FLOAT64_C(   107.96), SIMDE_FLOAT64_C(  -961.41) } },
+    { { { SIMDE_FLOAT64_C(   836.41) },
+        { SIMDE_FLOAT64_C(  -171.21) },
+        { SIMDE_FLOAT64_C(   773.26) },
+        { SIMDE_FLOAT64_C(   741.11) } },
+      { SIMDE_FLOAT64_C(   836.41), SIMDE_FLOAT64_C(  -171.21), SIMDE_FLOAT64_C(   773.26), SIMDE_FLOAT64_C(   741.11) } },
+    { { { SIMDE_FLOAT64_C(  -822.94) },
+        { SIMDE_FLOAT64_C(  -114.19) },
+        { SIMDE_FLOAT64_C(  -633.43) },
+        { SIMDE_FLOAT64_C(   870.65) } },
+      { SIMDE_FLOAT64_C(  -822.94), SIMDE_FLOAT64_C(  -114.19), SIMDE_FLOAT64_C(  -633.43), SIMDE_FLOAT64_C(   870.65) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x4_t val = { {
+      simde_vld1_f64(test_vec[i].val[0]),
+      simde_vld1_f64(test_vec[i].val[1]),
+      simde_vld1_f64(test_vec[i].val[2]),
+      simde_vld1_f64(test_vec[i].val[3]) } };
+    simde_float64_t r[4];
+
+    simde_vst1_f64_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t val[4][8];
+    int8_t r[32];
+  } test_vec[] = {
+    { { {  INT8_C( 51),  INT8_C( 40),  INT8_C( 99), -INT8_C( 54), -INT8_C( 71), -INT8_C( 41),  INT8_C( 50), -INT8_C( 34) },
+        { -INT8_C( 20),  INT8_C( 10),  INT8_C( 99),  INT8_C( 58),  INT8_C( 61), -INT8_C( 32),  INT8_C( 13), -INT8_C(100) },
+        {  INT8_C( 29),  INT8_C( 26),  INT8_C( 33), -INT8_C( 78), -INT8_C( 47),  INT8_C( 92), -INT8_C(115),  INT8_C( 50) },
+        {  INT8_C(  4), -INT8_C( 45),  INT8_C( 75),  INT8_C( 80),  INT8_C(105),  INT8_C( 98),  INT8_C( 56),  INT8_C( 24) } },
+      {  INT8_C( 51),  INT8_C( 40),  INT8_C( 99), -INT8_C( 54), -INT8_C( 71), -INT8_C( 41),  INT8_C( 50), -INT8_C( 34),
+        -INT8_C( 20),  INT8_C( 10),  INT8_C( 99),  INT8_C( 58),  INT8_C( 61), -INT8_C( 32),  INT8_C( 13), -INT8_C(100),
+         INT8_C( 29),  INT8_C( 26),  INT8_C( 33), -INT8_C( 78), -INT8_C( 47),  INT8_C( 92), -INT8_C(115),  INT8_C( 50),
+         INT8_C(  4), -INT8_C( 45),  INT8_C( 75),  INT8_C( 80),  INT8_C(105),  INT8_C( 98),  INT8_C( 56),  INT8_C( 24) } },
+    { { {  INT8_C(125),  INT8_C( 99), -INT8_C( 81), -INT8_C( 78),  INT8_C( 18),  INT8_C(120),  INT8_C( 64),  INT8_C(123) },
+        { -INT8_C( 95),  INT8_C( 92), -INT8_C( 59), -INT8_C( 36), -INT8_C( 22),  INT8_C(124), -INT8_C( 61),  INT8_C(122) },
+        {  INT8_C( 90),  INT8_C( 20),  INT8_C( 56), -INT8_C( 64),  INT8_C(124), -INT8_C(105),  INT8_C( 38), -INT8_C( 37) },
+        { -INT8_C(100),  INT8_C(100), -INT8_C( 21),  INT8_C( 53),  INT8_C( 97), -INT8_C( 60),  INT8_C( 34), -INT8_C( 77) } },
+      {  INT8_C(125),  INT8_C( 99), -INT8_C( 81), -INT8_C( 78),  INT8_C( 18),  INT8_C(120),  INT8_C( 64),  INT8_C(123),
+        -INT8_C( 95),  INT8_C( 92), -INT8_C( 59), -INT8_C( 36), -INT8_C( 22),  INT8_C(124), -INT8_C( 61),  INT8_C(122),
+         INT8_C( 90),  INT8_C( 20),  INT8_C( 56), -INT8_C( 64),  INT8_C(124), -INT8_C(105),  INT8_C( 38), -INT8_C( 37),
+        -INT8_C(100),  INT8_C(100), -INT8_C( 21),  INT8_C( 53),  INT8_C( 97), -INT8_C( 60),  INT8_C( 34), -INT8_C( 77) } },
+    { { {  INT8_C(  3),  INT8_C(124),  INT8_C(112),  INT8_C(100), -INT8_C(113), -INT8_C( 56), -INT8_C(119),  INT8_C( 12) },
+        { -INT8_C(  9), -INT8_C( 20), -INT8_C( 43), -INT8_C( 30), -INT8_C(112),  INT8_C( 29),  INT8_C( 91),  INT8_C(111) },
+        {  INT8_C( 70), -INT8_C( 44), -INT8_C( 90), -INT8_C(117), -INT8_C( 24), -INT8_C( 58), -INT8_C( 38), -INT8_C( 70) },
+        {  INT8_C( 62),  INT8_C( 52),  INT8_C( 67), -INT8_C(112),  INT8_C( 23), -INT8_C(121), -INT8_C(109), -INT8_C( 49) } },
+      {  INT8_C(  3),  INT8_C(124),  INT8_C(112),  INT8_C(100), -INT8_C(113), -INT8_C( 56), -INT8_C(119),  INT8_C( 12),
+        -INT8_C(  9), -INT8_C( 20), -INT8_C( 43), -INT8_C( 30), -INT8_C(112),  INT8_C( 29),  INT8_C( 91),  INT8_C(111),
+         INT8_C( 70), -INT8_C( 44), -INT8_C( 90), -INT8_C(117), -INT8_C( 24), -INT8_C( 58), -INT8_C( 38), -INT8_C( 70),
+         INT8_C( 62),  INT8_C( 52),  INT8_C( 67), -INT8_C(112),  INT8_C( 23), -INT8_C(121), -INT8_C(109), -INT8_C( 49) } },
+    { { { -INT8_C( 85), -INT8_C( 65),  INT8_C( 49),  INT8_C( 49),  INT8_C( 99), -INT8_C( 10),  INT8_C( 29),  INT8_C( 60) },
+        { -INT8_C( 57),  INT8_C( 33),  INT8_C( 56),  INT8_C( 90),  INT8_C(118), -INT8_C( 70),  INT8_C(  8),  INT8_C( 96) },
+        { -INT8_C(  8),  INT8_C( 35),  INT8_C( 24),  INT8_C( 39), -INT8_C(112), -INT8_C( 48),  INT8_C( 66),  INT8_C( 88) },
+        {  INT8_C( 95),  INT8_C( 32), -INT8_C( 24), -INT8_C(110), -INT8_C( 82), -INT8_C(109),  INT8_C( 25), -INT8_C( 71) } },
+      { -INT8_C( 85), -INT8_C( 65),  INT8_C( 49),  INT8_C( 49),  INT8_C( 99), -INT8_C( 10),  INT8_C( 29),  INT8_C( 60),
+        -INT8_C( 57),  INT8_C( 33),  INT8_C( 56),  INT8_C( 90),  INT8_C(118), -INT8_C( 70),  INT8_C(  8),  INT8_C( 96),
+        -INT8_C(  8),  INT8_C( 35),  INT8_C( 24),  INT8_C( 39), -INT8_C(112), -INT8_C( 48),  INT8_C( 66),  INT8_C( 88),
+         INT8_C( 95),  INT8_C( 32), -INT8_C( 24), -INT8_C(110), -INT8_C( 82), -INT8_C(109),  INT8_C( 25), -INT8_C( 71) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x4_t val = { {
+      simde_vld1_s8(test_vec[i].val[0]),
+      simde_vld1_s8(test_vec[i].val[1]),
+      simde_vld1_s8(test_vec[i].val[2]),
+      simde_vld1_s8(test_vec[i].val[3]) } };
+    int8_t r[32];
+
+    simde_vst1_s8_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t val[4][4];
+    int16_t r[16];
+  } test_vec[] = {
+    { { {  INT16_C(10866), -INT16_C(  874),  INT16_C( 5581),  INT16_C( 2959) },
+        { -INT16_C(30007),  INT16_C(31397), -INT16_C(30471), -INT16_C(10474) },
+        {  INT16_C(16345), -INT16_C(15837), -INT16_C( 4349),  INT16_C( 2040) },
+        {  INT16_C(16854), -INT16_C(13945),  INT16_C(25388),  INT16_C(15032) } },
+      {  INT16_C(10866), -INT16_C(  874),  INT16_C( 5581),  INT16_C( 2959), -INT16_C(30007),  INT16_C(31397), -INT16_C(30471), -INT16_C(10474),
+         INT16_C(16345), -INT16_C(15837), -INT16_C( 4349),  INT16_C( 2040),  INT16_C(16854), -INT16_C(13945),  INT16_C(25388),  INT16_C(15032) } },
+    { { {  INT16_C( 6273), -INT16_C(11562), -INT16_C(14610), -INT16_C(20114) },
+        { -INT16_C(28561), -INT16_C(12361), -INT16_C( 9665),  INT16_C(18422) },
+        { -INT16_C(11618), -INT16_C(10174),  INT16_C(20676), -INT16_C(30918) },
+        {  INT16_C( 3043),  INT16_C(23250),  INT16_C(10023), -INT16_C( 6140) } },
+      {  INT16_C( 6273), -INT16_C(11562), -INT16_C(14610), -INT16_C(20114), -INT16_C(28561), -INT16_C(12361), -INT16_C( 9665),  INT16_C(18422),
+        -INT16_C(11618), -INT16_C(10174),  INT16_C(20676), -INT16_C(30918),  INT16_C( 3043),  INT16_C(23250),  INT16_C(10023), -INT16_C( 6140) } },
+    { { {  INT16_C(22369),  INT16_C(18916),  INT16_C( 4350), -INT16_C(27039) },
+        { -INT16_C(21201), -INT16_C(18611),  INT16_C(28796),  INT16_C(22511) },
+        { -INT16_C(23969), -INT16_C( 5431),  INT16_C( 3633),  INT16_C(17885) },
+        {  INT16_C( 4101),  INT16_C( 7547),  INT16_C( 9532), -INT16_C(12075) } },
+      {  INT16_C(22369),  INT16_C(18916),  INT16_C( 4350), -INT16_C(27039), -INT16_C(21201), -INT16_C(18611),  INT16_C(28796),  INT16_C(22511),
+        -INT16_C(23969), -INT16_C( 5431),  INT16_C( 3633),  INT16_C(17885),  INT16_C( 4101),  INT16_C( 7547),  INT16_C( 9532), -INT16_C(12075) } },
+    { { { -INT16_C( 3114), -INT16_C( 6576),  INT16_C( 2466), -INT16_C(20840) },
+        { -INT16_C(23105), -INT16_C(18172), -INT16_C(26467),  INT16_C(22593) },
+        { -INT16_C(  575), -INT16_C(23706),  INT16_C(24920),  INT16_C(32035) },
+        {  INT16_C(24884),  INT16_C(15126), -INT16_C( 8898), -INT16_C(10790) } },
+      { -INT16_C( 3114), -INT16_C( 6576),  INT16_C( 2466), -INT16_C(20840), -INT16_C(23105), -INT16_C(18172), -INT16_C(26467),  INT16_C(22593),
+        -INT16_C(  575), -INT16_C(23706),  INT16_C(24920),  INT16_C(32035),  INT16_C(24884),  INT16_C(15126), -INT16_C( 8898), -INT16_C(10790) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x4_t val = { {
+      simde_vld1_s16(test_vec[i].val[0]),
+      simde_vld1_s16(test_vec[i].val[1]),
+      simde_vld1_s16(test_vec[i].val[2]),
+      simde_vld1_s16(test_vec[i].val[3]) } };
+    int16_t r[16];
+
+    simde_vst1_s16_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t val[4][2];
+    int32_t r[8];
+  } test_vec[] = {
+    { { { -INT32_C(1962733302), -INT32_C(2135072319) },
+        {  INT32_C(1434681318), -INT32_C(1344277629) },
+        {  INT32_C( 164210772),  INT32_C(  44089321) },
+        { -INT32_C( 772374003),  INT32_C( 958782721) } },
+      { -INT32_C(1962733302), -INT32_C(2135072319),  INT32_C(1434681318), -INT32_C(1344277629),  INT32_C( 164210772),  INT32_C(  44089321), -INT32_C( 772374003),  INT32_C( 958782721) } },
+    { { { -INT32_C( 386500816), -INT32_C(1393084804) },
+        {  INT32_C(1513903187),  INT32_C(1462341558) },
+        { -INT32_C( 326062097), -INT32_C( 861254966) },
+        { -INT32_C( 669117035), -INT32_C( 690296369) } },
+      { -INT32_C( 386500816), -INT32_C(1393084804),  INT32_C(1513903187),  INT32_C(1462341558), -INT32_C( 326062097), -INT32_C( 861254966), -INT32_C( 669117035), -INT32_C( 690296369) } },
+    { { { -INT32_C( 618233798), -INT32_C( 999150867) },
+        { -INT32_C(1204529613),  INT32_C(1318924286) },
+        { -INT32_C(1586423956), -INT32_C(1625030983) },
+        {  INT32_C(1169018700),  INT32_C( 413416002) } },
+      { -INT32_C( 618233798), -INT32_C( 999150867), -INT32_C(1204529613),  INT32_C(1318924286), -INT32_C(1586423956), -INT32_C(1625030983),  INT32_C(1169018700),  INT32_C( 413416002) } },
+    { { { -INT32_C( 894364962), -INT32_C( 889557870) },
+        {  INT32_C( 119437820),  INT32_C(1803457313) },
+        { -INT32_C(1730124381), -INT32_C( 186355113) },
+        { -INT32_C(2111372028),  INT32_C( 525844487) } },
+      { -INT32_C( 894364962), -INT32_C( 889557870),  INT32_C( 119437820),  INT32_C(1803457313), -INT32_C(1730124381), -INT32_C( 186355113), -INT32_C(2111372028),  INT32_C( 525844487) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x4_t val = { {
+      simde_vld1_s32(test_vec[i].val[0]),
+      simde_vld1_s32(test_vec[i].val[1]),
+      simde_vld1_s32(test_vec[i].val[2]),
+      simde_vld1_s32(test_vec[i].val[3]) } };
+    int32_t r[8];
+
+    simde_vst1_s32_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_s64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t val[4][1];
+    int64_t r[4];
+  } test_vec[] = {
+    { { { -INT64_C(8058333599883045462) },
+        { -INT64_C(8178367739798547010) },
+        { -INT64_C(2409885462293576292) },
+        {  INT64_C( 505686258979872792) } },
+      { -INT64_C(8058333599883045462), -INT64_C(8178367739798547010), -INT64_C(2409885462293576292),  INT64_C( 505686258979872792) } },
+    { { { -INT64_C(  85144992438313291) },
+        {  INT64_C(6986918385406877594) },
+        { -INT64_C(5024667208742479700) },
+        { -INT64_C(3177465523281706825) } },
+      { -INT64_C(  85144992438313291),  INT64_C(6986918385406877594), -INT64_C(5024667208742479700), -INT64_C(3177465523281706825) } },
+    { { {  INT64_C(7515832727165843262) },
+        { -INT64_C(2136433308298498805) },
+        { -INT64_C(2309144322694824866) },
+        { -INT64_C(1537576658289293739) } },
+      {  INT64_C(7515832727165843262), -INT64_C(2136433308298498805), -INT64_C(2309144322694824866), -INT64_C(1537576658289293739) } },
+    { { { -INT64_C(4464400912997456475) },
+        {  INT64_C(8018986719738788033) },
+        { -INT64_C(1681711663237967206) },
+        { -INT64_C(4476154516422255826) } },
+      { -INT64_C(4464400912997456475),  INT64_C(8018986719738788033), -INT64_C(1681711663237967206), -INT64_C(4476154516422255826) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x4_t val = { {
+      simde_vld1_s64(test_vec[i].val[0]),
+      simde_vld1_s64(test_vec[i].val[1]),
+      simde_vld1_s64(test_vec[i].val[2]),
+      simde_vld1_s64(test_vec[i].val[3]) } };
+    int64_t r[4];
+
+    simde_vst1_s64_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t val[4][8];
+    uint8_t r[32];
+  } test_vec[] = {
+    { { { UINT8_C(169), UINT8_C(140), UINT8_C(230), UINT8_C(191), UINT8_C( 93), UINT8_C( 51), UINT8_C(161), UINT8_C(185) },
+        { UINT8_C( 23), UINT8_C(154), UINT8_C(166), UINT8_C(224), UINT8_C( 62), UINT8_C(220), UINT8_C(183), UINT8_C(103) },
+        { UINT8_C(208), UINT8_C(114), UINT8_C(226), UINT8_C(103), UINT8_C( 86), UINT8_C(185), UINT8_C(  8), UINT8_C(210) },
+        { UINT8_C( 51), UINT8_C( 94), UINT8_C(163), UINT8_C(161), UINT8_C(207), UINT8_C( 66), UINT8_C(128), UINT8_C(190) } },
+      { UINT8_C(169), UINT8_C(140), UINT8_C(230), UINT8_C(191), UINT8_C( 93), UINT8_C( 51), UINT8_C(161), UINT8_C(185),
+        UINT8_C( 23), UINT8_C(154), UINT8_C(166), UINT8_C(224), UINT8_C( 62), UINT8_C(220), UINT8_C(183), UINT8_C(103),
+        UINT8_C(208), UINT8_C(114), UINT8_C(226), UINT8_C(103), UINT8_C( 86), UINT8_C(185), UINT8_C(  8), UINT8_C(210),
+        UINT8_C( 51), UINT8_C( 94), UINT8_C(163), UINT8_C(161), UINT8_C(207), UINT8_C( 66), UINT8_C(128), UINT8_C(190) } },
+    { { { UINT8_C( 38), UINT8_C( 57), UINT8_C(124), UINT8_C( 41), UINT8_C(175), UINT8_C(213), UINT8_C(226), UINT8_C( 45) },
+        { UINT8_C( 92), UINT8_C(116), UINT8_C(249), UINT8_C( 82), UINT8_C(174), UINT8_C(148), UINT8_C(165), UINT8_C( 60) },
+        { UINT8_C( 72), UINT8_C(188), UINT8_C(214), UINT8_C(118), UINT8_C( 78), UINT8_C(235), UINT8_C(163), UINT8_C(146) },
+        { UINT8_C( 44), UINT8_C(183), UINT8_C(113), UINT8_C(200), UINT8_C(161), UINT8_C(166), UINT8_C( 26),    UINT8_MAX } },
+      { UINT8_C( 38), UINT8_C( 57), UINT8_C(124), UINT8_C( 41), UINT8_C(175), UINT8_C(213), UINT8_C(226), UINT8_C( 45),
+        UINT8_C( 92), UINT8_C(116), UINT8_C(249), UINT8_C( 82), UINT8_C(174), UINT8_C(148), UINT8_C(165), UINT8_C( 60),
+        UINT8_C( 72), UINT8_C(188), UINT8_C(214), UINT8_C(118), UINT8_C( 78), UINT8_C(235), UINT8_C(163), UINT8_C(146),
+        UINT8_C( 44), UINT8_C(183), UINT8_C(113), UINT8_C(200), UINT8_C(161), UINT8_C(166), UINT8_C( 26),    UINT8_MAX } },
+    { { {    UINT8_MAX, UINT8_C(  0), UINT8_C( 88), UINT8_C(143), UINT8_C( 17), UINT8_C(210), UINT8_C(101), UINT8_C( 79) },
+        { UINT8_C( 90), UINT8_C(147), UINT8_C(248), UINT8_C(217), UINT8_C(104), UINT8_C(116), UINT8_C( 65), UINT8_C(196) },
+        { UINT8_C(236), UINT8_C( 82), UINT8_C( 73), UINT8_C( 64), UINT8_C( 95), UINT8_C(167), UINT8_C( 42), UINT8_C( 13) },
+        { UINT8_C(181), UINT8_C(160), UINT8_C(118), UINT8_C( 30), UINT8_C( 35), UINT8_C(  6), UINT8_C(171), UINT8_C(112) } },
+      {    UINT8_MAX, UINT8_C(  0), UINT8_C( 88), UINT8_C(143), UINT8_C( 17), UINT8_C(210), UINT8_C(101), UINT8_C( 79),
+        UINT8_C( 90), UINT8_C(147), UINT8_C(248), UINT8_C(217), UINT8_C(104), UINT8_C(116), UINT8_C( 65), UINT8_C(196),
+        UINT8_C(236), UINT8_C( 82), UINT8_C( 73), UINT8_C( 64), UINT8_C( 95), UINT8_C(167), UINT8_C( 42), UINT8_C( 13),
+        UINT8_C(181), UINT8_C(160), UINT8_C(118), UINT8_C( 30), UINT8_C( 35), UINT8_C(  6), UINT8_C(171), UINT8_C(112) } },
+    { { { UINT8_C(  1), UINT8_C(117), UINT8_C( 14), UINT8_C(159), UINT8_C(166), UINT8_C( 59), UINT8_C( 90), UINT8_C(145) },
+        { UINT8_C( 75), UINT8_C( 64), UINT8_C( 93), UINT8_C( 58), UINT8_C( 63), UINT8_C(239), UINT8_C( 25), UINT8_C(  7) },
+        { UINT8_C(129), UINT8_C(243), UINT8_C(137), UINT8_C(236), UINT8_C( 51), UINT8_C( 32), UINT8_C(115), UINT8_C(131) },
+        { UINT8_C( 80), UINT8_C( 45), UINT8_C(172), UINT8_C( 87), UINT8_C(  3), UINT8_C(178), UINT8_C(105), UINT8_C( 50) } },
+      { UINT8_C(  1), UINT8_C(117), UINT8_C( 14), UINT8_C(159), UINT8_C(166), UINT8_C( 59), UINT8_C( 90), UINT8_C(145),
+        UINT8_C( 75), UINT8_C( 64), UINT8_C( 93), UINT8_C( 58), UINT8_C( 63), UINT8_C(239), UINT8_C( 25), UINT8_C(  7),
+        UINT8_C(129), UINT8_C(243), UINT8_C(137), UINT8_C(236), UINT8_C( 51), UINT8_C( 32), UINT8_C(115), UINT8_C(131),
+        UINT8_C( 80), UINT8_C( 45), UINT8_C(172), UINT8_C( 87), UINT8_C(  3), UINT8_C(178), UINT8_C(105), UINT8_C( 50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x4_t val = { {
+      simde_vld1_u8(test_vec[i].val[0]),
+      simde_vld1_u8(test_vec[i].val[1]),
+      simde_vld1_u8(test_vec[i].val[2]),
+      simde_vld1_u8(test_vec[i].val[3]) } };
+    uint8_t r[32];
+
+    simde_vst1_u8_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t val[4][4];
+    uint16_t r[16];
+  } test_vec[] = {
+    { { { UINT16_C(11880), UINT16_C(27040), UINT16_C(35925), UINT16_C(19478) },
+        { UINT16_C(53299), UINT16_C(12827), UINT16_C(37869), UINT16_C(58701) },
+        { UINT16_C(64984), UINT16_C(32630), UINT16_C(40185), UINT16_C(12359) },
+        { UINT16_C(46627), UINT16_C( 3541), UINT16_C(32831), UINT16_C(52222) } },
+      { UINT16_C(11880), UINT16_C(27040), UINT16_C(35925), UINT16_C(19478), UINT16_C(53299), UINT16_C(12827), UINT16_C(37869), UINT16_C(58701),
+        UINT16_C(64984), UINT16_C(32630), UINT16_C(40185), UINT16_C(12359), UINT16_C(46627), UINT16_C( 3541), UINT16_C(32831), UINT16_C(52222) } },
+    { { { UINT16_C(24759), UINT16_C(14650), UINT16_C(32110), UINT16_C(44106) },
+        { UINT16_C(28455), UINT16_C(23774), UINT16_C(50256), UINT16_C(57216) },
+        { UINT16_C(12259), UINT16_C(17193), UINT16_C(24968), UINT16_C(24090) },
+        { UINT16_C(51866), UINT16_C(42124), UINT16_C(13909), UINT16_C(36728) } },
+      { UINT16_C(24759), UINT16_C(14650), UINT16_C(32110), UINT16_C(44106), UINT16_C(28455), UINT16_C(23774), UINT16_C(50256), UINT16_C(57216),
+        UINT16_C(12259), UINT16_C(17193), UINT16_C(24968), UINT16_C(24090), UINT16_C(51866), UINT16_C(42124), UINT16_C(13909), UINT16_C(36728) } },
+    { { { UINT16_C(18871), UINT16_C(37262), UINT16_C(58102), UINT16_C(16256) },
+        { UINT16_C( 4483), UINT16_C(27087), UINT16_C( 5823), UINT16_C(49184) },
+        { UINT16_C(28064), UINT16_C(13968), UINT16_C(54383), UINT16_C(57302) },
+        { UINT16_C(51095), UINT16_C(57698), UINT16_C(64004), UINT16_C(25874) } },
+      { UINT16_C(18871), UINT16_C(37262), UINT16_C(58102), UINT16_C(16256), UINT16_C( 4483), UINT16_C(27087), UINT16_C( 5823), UINT16_C(49184),
+        UINT16_C(28064), UINT16_C(13968), UINT16_C(54383), UINT16_C(57302), UINT16_C(51095), UINT16_C(57698), UINT16_C(64004), UINT16_C(25874) } },
+    { { { UINT16_C(28511), UINT16_C(46982), UINT16_C(55055), UINT16_C(15700) },
+        { UINT16_C( 9884), UINT16_C(46216), UINT16_C( 7431), UINT16_C(35750) },
+        { UINT16_C(55788), UINT16_C(61835), UINT16_C(39588), UINT16_C(29913) },
+        { UINT16_C( 2737), UINT16_C(11062), UINT16_C(38952), UINT16_C(36679) } },
+      { UINT16_C(28511), UINT16_C(46982), UINT16_C(55055), UINT16_C(15700), UINT16_C( 9884), UINT16_C(46216), UINT16_C( 7431), UINT16_C(35750),
+        UINT16_C(55788), UINT16_C(61835), UINT16_C(39588), UINT16_C(29913), UINT16_C( 2737), UINT16_C(11062), UINT16_C(38952), UINT16_C(36679) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x4_t val = { {
+      simde_vld1_u16(test_vec[i].val[0]),
+      simde_vld1_u16(test_vec[i].val[1]),
+      simde_vld1_u16(test_vec[i].val[2]),
+      simde_vld1_u16(test_vec[i].val[3]) } };
+    uint16_t r[16];
+
+    simde_vst1_u16_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t val[4][2];
+    uint32_t r[8];
+  } test_vec[] = {
+    { { { UINT32_C(2913689984), UINT32_C(1042817405) },
+        { UINT32_C(3677417492), UINT32_C(4075572932) },
+        { UINT32_C(1655609672), UINT32_C(2707181433) },
+        { UINT32_C(2975900383), UINT32_C(1327341878) } },
+      { UINT32_C(2913689984), UINT32_C(1042817405), UINT32_C(3677417492), UINT32_C(4075572932), UINT32_C(1655609672), UINT32_C(2707181433), UINT32_C(2975900383), UINT32_C(1327341878) } },
+    { { { UINT32_C(2061681433), UINT32_C(2112701662) },
+        { UINT32_C(4294537507), UINT32_C(2127555075) },
+        { UINT32_C(1076926536), UINT32_C( 789794426) },
+        { UINT32_C( 117449816), UINT32_C( 773017952) } },
+      { UINT32_C(2061681433), UINT32_C(2112701662), UINT32_C(4294537507), UINT32_C(2127555075), UINT32_C(1076926536), UINT32_C( 789794426), UINT32_C( 117449816), UINT32_C( 773017952) } },
+    { { { UINT32_C(1738018915), UINT32_C(4294053745) },
+        { UINT32_C( 194678689), UINT32_C(2841692170) },
+        { UINT32_C(3016118775), UINT32_C(3224758478) },
+        { UINT32_C(3404453312), UINT32_C(2527998070) } },
+      { UINT32_C(1738018915), UINT32_C(4294053745), UINT32_C( 194678689), UINT32_C(2841692170), UINT32_C(3016118775), UINT32_C(3224758478), UINT32_C(3404453312), UINT32_C(2527998070) } },
+    { { { UINT32_C(2343514457), UINT32_C(4138276989) },
+        { UINT32_C( 445034363), UINT32_C(4202259154) },
+        { UINT32_C(1236778108), UINT32_C(  30850555) },
+        { UINT32_C(2534658648), UINT32_C(4162237042) } },
+      { UINT32_C(2343514457), UINT32_C(4138276989), UINT32_C( 445034363), UINT32_C(4202259154), UINT32_C(1236778108), UINT32_C(  30850555), UINT32_C(2534658648), UINT32_C(4162237042) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x4_t val = { {
+      simde_vld1_u32(test_vec[i].val[0]),
+      simde_vld1_u32(test_vec[i].val[1]),
+      simde_vld1_u32(test_vec[i].val[2]),
+      simde_vld1_u32(test_vec[i].val[3]) } };
+    uint32_t r[8];
+
+    simde_vst1_u32_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1_u64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t val[4][1];
+    uint64_t r[4];
+  } test_vec[] = {
+    { { { UINT64_C( 8693674937951996614) },
+        { UINT64_C( 9154940838204690031) },
+        { UINT64_C(11751800648457767535) },
+        { UINT64_C( 9828087230893576825) } },
+      { UINT64_C( 8693674937951996614), UINT64_C( 9154940838204690031), UINT64_C(11751800648457767535), UINT64_C( 9828087230893576825) } },
+    { { { UINT64_C(  919488831233899683) },
+        { UINT64_C(11729402556632142200) },
+        { UINT64_C( 4485969461058672377) },
+        { UINT64_C(11980322133241937572) } },
+      { UINT64_C(  919488831233899683), UINT64_C(11729402556632142200), UINT64_C( 4485969461058672377), UINT64_C(11980322133241937572) } },
+    { { { UINT64_C(17602447297108226793) },
+        { UINT64_C(12302266646360886765) },
+        { UINT64_C(16511086931489809451) },
+        { UINT64_C(15544592912068814896) } },
+      { UINT64_C(17602447297108226793), UINT64_C(12302266646360886765), UINT64_C(16511086931489809451), UINT64_C(15544592912068814896) } },
+    { { { UINT64_C(15074743634563763945) },
+        { UINT64_C(12327359213814803534) },
+        { UINT64_C( 3435812801611021872) },
+        { UINT64_C(17259285183567071576) } },
+      { UINT64_C(15074743634563763945), UINT64_C(12327359213814803534), UINT64_C( 3435812801611021872), UINT64_C(17259285183567071576) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x4_t val = { {
+      simde_vld1_u64(test_vec[i].val[0]),
+      simde_vld1_u64(test_vec[i].val[1]),
+      simde_vld1_u64(test_vec[i].val[2]),
+      simde_vld1_u64(test_vec[i].val[3]) } };
+    uint64_t r[4];
+
+    simde_vst1_u64_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_f32_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_f64_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s8_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s16_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s32_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_s64_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u8_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u16_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u32_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1_u64_x4)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
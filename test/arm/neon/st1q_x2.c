@@ -0,0 +1,418 @@
+#define SIMDE_TEST_ARM_NEON_INSN st1q_x2
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st1q_x2.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst1q_f32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t val[2][4];
+    simde_float32_t r[8];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT32_C(    10.96), SIMDE_FLOAT32_C(   486.78), SIMDE_FLOAT32_C(  -222.52), SIMDE_FLOAT32_C(   302.38) },
+        { SIMDE_FLOAT32_C(  -850.13), SIMDE_FLOAT32_C(   752.46), SIMDE_FLOAT32_C(  -179.79), SIMDE_FLOAT32_C(  -672.71) } },
+      { SIMDE_FLOAT32_C(    10.96), SIMDE_FLOAT32_C(   486.78), SIMDE_FLOAT32_C(  -222.52), SIMDE_FLOAT32_C(   302.38),
+        SIMDE_FLOAT32_C(  -850.13), SIMDE_FLOAT32_C(   752.46), SIMDE_FLOAT32_C(  -179.79), SIMDE_FLOAT32_C(  -672.71) } },
+    { { { SIMDE_FLOAT32_C(   711.76), SIMDE_FLOAT32_C(  -492.54), SIMDE_FLOAT32_C(  -849.74), SIMDE_FLOAT32_C(   927.58) },
+        { SIMDE_FLOAT32_C(   949.26), SIMDE_FLOAT32_C(   793.70), SIMDE_FLOAT32_C(   539.35), SIMDE_FLOAT32_C(  -662.65) } },
+      { SIMDE_FLOAT32_C(   711.76), SIMDE_FLOAT32_C(  -492.54), SIMDE_FLOAT32_C(  -849.74), SIMDE_FLOAT32_C(   927.58),
+        SIMDE_FLOAT32_C(   949.26), SIMDE_FLOAT32_C(   793.70), SIMDE_FLOAT32_C(   539.35), SIMDE_FLOAT32_C(  -662.65) } },
+    { { { SIMDE_FLOAT32_C(   754.62), SIMDE_FLOAT32_C(  -942.94), SIMDE_FLOAT32_C(  -831.86), SIMDE_FLOAT32_C(  -767.02) },
+        { SIMDE_FLOAT32_C(  -478.68), SIMDE_FLOAT32_C(   708.21), SIMDE_FLOAT32_C(   327.39), SIMDE_FLOAT32_C(  -414.73) } },
+      { SIMDE_FLOAT32_C(   754.62), SIMDE_FLOAT32_C(  -942.94), SIMDE_FLOAT32_C(  -831.86), SIMDE_FLOAT32_C(  -767.02),
+        SIMDE_FLOAT32_C(  -478.68), SIMDE_FLOAT32_C(   708.21), SIMDE_FLOAT32_C(   327.39), SIMDE_FLOAT32_C(  -414.73) } },
+    { { { SIMDE_FLOAT32_C(   351.92), SIMDE_FLOAT32_C(   367.93), SIMDE_FLOAT32_C(  -918.14), SIMDE_FLOAT32_C(  -950.18) },
+        { SIMDE_FLOAT32_C(   188.64), SIMDE_FLOAT32_C(   185.36), SIMDE_FLOAT32_C(  -482.90), SIMDE_FLOAT32_C(   427.98) } },
+      { SIMDE_FLOAT32_C(   351.92), SIMDE_FLOAT32_C(   367.93), SIMDE_FLOAT32_C(  -918.14), SIMDE_FLOAT32_C(  -950.18),
+        SIMDE_FLOAT32_C(   188.64), SIMDE_FLOAT32_C(   185.36), SIMDE_FLOAT32_C(  -482.90), SIMDE_FLOAT32_C(   427.98) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t val = { {
+      simde_vld1q_f32(test_vec[i].val[0]),
+      simde_vld1q_f32(test_vec[i].val[1]) } };
+    simde_float32_t r[8];
+
+    simde_vst1q_f32_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_f64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t val[2][2];
+    simde_float64_t r[4];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT64_C(   959.38), SIMDE_FLOAT64_C(   314.00) },
+        { SIMDE_FLOAT64_C(   760.28), SIMDE_FLOAT64_C(   203.33) } },
+      { SIMDE_FLOAT64_C(   959.38), SIMDE_FLOAT64_C(   314.00), SIMDE_FLOAT64_C(   760.28), SIMDE_FLOAT64_C(   203.33) } },
+    { { { SIMDE_FLOAT64_C(   147.46), SIMDE_FLOAT64_C(   829.67) },
+        { SIMDE_FLOAT64_C(  -394.78), SIMDE_FLOAT64_C(   -54.88) } },
+      { SIMDE_FLOAT64_C(   147.46), SIMDE_FLOAT64_C(   829.67), SIMDE_FLOAT64_C(  -394.78), SIMDE_FLOAT64_C(   -54.88) } },
+    { { { SIMDE_FLOAT64_C(   820.95), SIMDE_FLOAT64_C(   256.29) },
+        { SIMDE_FLOAT64_C(   523.89), SIMDE_FLOAT64_C(   342.02) } },
+      { SIMDE_FLOAT64_C(   820.95), SIMDE_FLOAT64_C(   256.29), SIMDE_FLOAT64_C(   523.89), SIMDE_FLOAT64_C(   342.02) } },
+    { { { SIMDE_FLOAT64_C(   354.52), SIMDE_FLOAT64_C(  -871.89) },
+        { SIMDE_FLOAT64_C(   258.43), SIMDE_FLOAT64_C(   913.86) } },
+      { SIMDE_FLOAT64_C(   354.52), SIMDE_FLOAT64_C(  -871.89), SIMDE_FLOAT64_C(   258.43), SIMDE_FLOAT64_C(   913.86) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t val = { {
+      simde_vld1q_f64(test_vec[i].val[0]),
+      simde_vld1q_f64(test_vec[i].val[1]) } };
+    simde_float64_t r[4];
+
+    simde_vst1q_f64_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t val[2][16];
+    int8_t r[32];
+  } test_vec[] = {
+    { { { -INT8_C( 16),  INT8_C( 50),  INT8_C( 25), -INT8_C(  9), -INT8_C( 53), -INT8_C( 50),  INT8_C( 65), -INT8_C(  9),
+          -INT8_C( 11),  INT8_C( 97),  INT8_C( 84), -INT8_C( 66),  INT8_C( 43),  INT8_C(126), -INT8_C( 57), -INT8_C( 13) },
+        { -INT8_C( 92),  INT8_C( 29),  INT8_C(  1), -INT8_C( 36), -INT8_C( 42),  INT8_C( 90),  INT8_C(123),  INT8_C(125),
+           INT8_C( 81),  INT8_C( 30), -INT8_C(122), -INT8_C( 42),  INT8_C( 72), -INT8_C( 40),  INT8_C( 14), -INT8_C( 92) } },
+      { -INT8_C( 16),  INT8_C( 50),  INT8_C( 25), -INT8_C(  9), -INT8_C( 53), -INT8_C( 50),  INT8_C( 65), -INT8_C(  9),
+        -INT8_C( 11),  INT8_C( 97),  INT8_C( 84), -INT8_C( 66),  INT8_C( 43),  INT8_C(126), -INT8_C( 57), -INT8_C( 13),
+        -INT8_C( 92),  INT8_C( 29),  INT8_C(  1), -INT8_C( 36), -INT8_C( 42),  INT8_C( 90),  INT8_C(123),  INT8_C(125),
+         INT8_C( 81),  INT8_C( 30), -INT8_C(122), -INT8_C( 42),  INT8_C( 72), -INT8_C( 40),  INT8_C( 14), -INT8_C( 92) } },
+    { { { -INT8_C(120),  INT8_C( 17), -INT8_C(  3),  INT8_C(107),  INT8_C( 64),  INT8_C( 71), -INT8_C(127), -INT8_C(100),
+           INT8_C( 45),  INT8_C(  1), -INT8_C( 77),  INT8_C( 90), -INT8_C( 94),  INT8_C(122),  INT8_C( 90), -INT8_C(  7) },
+        { -INT8_C( 90),  INT8_C( 41),  INT8_C( 53),  INT8_C( 55),  INT8_C( 36),  INT8_C(121),  INT8_C(105),  INT8_C(  8),
+          -INT8_C( 82), -INT8_C( 81),  INT8_C( 67),  INT8_C( 18), -INT8_C(  3),  INT8_C(123),  INT8_C( 61), -INT8_C(110) } },
+      { -INT8_C(120),  INT8_C( 17), -INT8_C(  3),  INT8_C(107),  INT8_C( 64),  INT8_C( 71), -INT8_C(127), -INT8_C(100),
+         INT8_C( 45),  INT8_C(  1), -INT8_C( 77),  INT8_C( 90), -INT8_C( 94),  INT8_C(122),  INT8_C( 90), -INT8_C(  7),
+        -INT8_C( 90),  INT8_C( 41),  INT8_C( 53),  INT8_C( 55),  INT8_C( 36),  INT8_C(121),  INT8_C(105),  INT8_C(  8),
+        -INT8_C( 82), -INT8_C( 81),  INT8_C( 67),  INT8_C( 18), -INT8_C(  3),  INT8_C(123),  INT8_C( 61), -INT8_C(110) } },
+    { { { -INT8_C(116), -INT8_C( 30), -INT8_C( 55), -INT8_C( 77), -INT8_C( 36), -INT8_C(110),  INT8_C( 42),  INT8_C( 76),
+          -INT8_C( 26),  INT8_C( 76),  INT8_C( 75),  INT8_C( 38),  INT8_C(  8), -INT8_C( 82),  INT8_C( 48), -INT8_C( 28) },
+        {  INT8_C( 64), -INT8_C(119), -INT8_C( 99), -INT8_C( 76), -INT8_C( 71), -INT8_C( 62), -INT8_C( 26),  INT8_C( 43),
+           INT8_C( 13),  INT8_C(113), -INT8_C( 53),     INT8_MAX, -INT8_C(112), -INT8_C( 56),  INT8_C( 46), -INT8_C( 17) } },
+      { -INT8_C(116), -INT8_C( 30), -INT8_C( 55), -INT8_C( 77), -INT8_C( 36), -INT8_C(110),  INT8_C( 42),  INT8_C( 76),
+        -INT8_C( 26),  INT8_C( 76),  INT8_C( 75),  INT8_C( 38),  INT8_C(  8), -INT8_C( 82),  INT8_C( 48), -INT8_C( 28),
+         INT8_C( 64), -INT8_C(119), -INT8_C( 99), -INT8_C( 76), -INT8_C( 71), -INT8_C( 62), -INT8_C( 26),  INT8_C( 43),
+         INT8_C( 13),  INT8_C(113), -INT8_C( 53),     INT8_MAX, -INT8_C(112), -INT8_C( 56),  INT8_C( 46), -INT8_C( 17) } },
+    { { {  INT8_C( 21), -INT8_C( 73),  INT8_C( 92),  INT8_C(118), -INT8_C( 73), -INT8_C(  2),  INT8_C( 53), -INT8_C( 13),
+          -INT8_C( 10),  INT8_C( 63),  INT8_C( 79),  INT8_C( 98),  INT8_C( 22), -INT8_C(117),  INT8_C( 29),  INT8_C( 82) },
+        {  INT8_C( 98),  INT8_C( 72),  INT8_C(108),  INT8_C( 14), -INT8_C( 98),  INT8_C(123),  INT8_C(  6), -INT8_C( 48),
+           INT8_C( 55), -INT8_C( 42),  INT8_C( 54),  INT8_C(  9),  INT8_C( 39),  INT8_C( 87),  INT8_C(119),  INT8_C(101) } },
+      {  INT8_C( 21), -INT8_C( 73),  INT8_C( 92),  INT8_C(118), -INT8_C( 73), -INT8_C(  2),  INT8_C( 53), -INT8_C( 13),
+        -INT8_C( 10),  INT8_C( 63),  INT8_C( 79),  INT8_C( 98),  INT8_C( 22), -INT8_C(117),  INT8_C( 29),  INT8_C( 82),
+         INT8_C( 98),  INT8_C( 72),  INT8_C(108),  INT8_C( 14), -INT8_C( 98),  INT8_C(123),  INT8_C(  6), -INT8_C( 48),
+         INT8_C( 55), -INT8_C( 42),  INT8_C( 54),  INT8_C(  9),  INT8_C( 39),  INT8_C( 87),  INT8_C(119),  INT8_C(101) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t val = { {
+      simde_vld1q_s8(test_vec[i].val[0]),
+      simde_vld1q_s8(test_vec[i].val[1]) } };
+    int8_t r[32];
+
+    simde_vst1q_s8_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t val[2][8];
+    int16_t r[16];
+  } test_vec[] = {
+    { { { -INT16_C(13272),  INT16_C( 1883),  INT16_C(  659),  INT16_C(32587), -INT16_C(13061),  INT16_C(20590),  INT16_C(13889), -INT16_C(25869) },
+        { -INT16_C(11657), -INT16_C(12439), -INT16_C(20370),  INT16_C( 5329), -INT16_C(13980),  INT16_C(28244), -INT16_C(31134),  INT16_C(17634) } },
+      { -INT16_C(13272),  INT16_C( 1883),  INT16_C(  659),  INT16_C(32587), -INT16_C(13061),  INT16_C(20590),  INT16_C(13889), -INT16_C(25869),
+        -INT16_C(11657), -INT16_C(12439), -INT16_C(20370),  INT16_C( 5329), -INT16_C(13980),  INT16_C(28244), -INT16_C(31134),  INT16_C(17634) } },
+    { { { -INT16_C(19427),  INT16_C( 7978), -INT16_C(23674), -INT16_C( 6881),  INT16_C( 8478),  INT16_C(24095),  INT16_C(31441),  INT16_C( 7218) },
+        {  INT16_C( 3500), -INT16_C(12635), -INT16_C(11948),  INT16_C(29412), -INT16_C(14235),  INT16_C(11045),  INT16_C( 4483), -INT16_C( 6092) } },
+      { -INT16_C(19427),  INT16_C( 7978), -INT16_C(23674), -INT16_C( 6881),  INT16_C( 8478),  INT16_C(24095),  INT16_C(31441),  INT16_C( 7218),
+         INT16_C( 3500), -INT16_C(12635), -INT16_C(11948),  INT16_C(29412), -INT16_C(14235),  INT16_C(11045),  INT16_C( 4483), -INT16_C( 6092) } },
+    { { { -INT16_C( 2826), -INT16_C(19412), -INT16_C(11279),  INT16_C(27906),  INT16_C(28376),  INT16_C(21448),  INT16_C(21186),  INT16_C(21646) },
+        { -INT16_C(27204),  INT16_C(27822), -INT16_C(26874),  INT16_C( 7346), -INT16_C( 9082), -INT16_C( 5045), -INT16_C( 8052), -INT16_C(13410) } },
+      { -INT16_C( 2826), -INT16_C(19412), -INT16_C(11279),  INT16_C(27906),  INT16_C(28376),  INT16_C(21448),  INT16_C(21186),  INT16_C(21646),
+        -INT16_C(27204),  INT16_C(27822), -INT16_C(26874),  INT16_C( 7346), -INT16_C( 9082), -INT16_C( 5045), -INT16_C( 8052), -INT16_C(13410) } },
+    { { { -INT16_C(19744),  INT16_C( 8279),  INT16_C( 5857), -INT16_C(22102),  INT16_C( 1073), -INT16_C(11024),  INT16_C(13810), -INT16_C(16582) },
+        {  INT16_C( 3884),  INT16_C(11227),  INT16_C(14440), -INT16_C( 3503), -INT16_C( 4537), -INT16_C( 5066),  INT16_C(11408),  INT16_C( 7890) } },
+      { -INT16_C(19744),  INT16_C( 8279),  INT16_C( 5857), -INT16_C(22102),  INT16_C( 1073), -INT16_C(11024),  INT16_C(13810), -INT16_C(16582),
+         INT16_C( 3884),  INT16_C(11227),  INT16_C(14440), -INT16_C( 3503), -INT16_C( 4537), -INT16_C( 5066),  INT16_C(11408),  INT16_C( 7890) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t val = { {
+      simde_vld1q_s16(test_vec[i].val[0]),
+      simde_vld1q_s16(test_vec[i].val[1]) } };
+    int16_t r[16];
+
+    simde_vst1q_s16_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t val[2][4];
+    int32_t r[8];
+  } test_vec[] = {
+    { { {  INT32_C(1069243974), -INT32_C( 259471287),  INT32_C( 549832109), -INT32_C(1720939369) },
+        {  INT32_C( 531427721), -INT32_C( 669287677),  INT32_C( 896519302),  INT32_C(1053001488) } },
+      {  INT32_C(1069243974), -INT32_C( 259471287),  INT32_C( 549832109), -INT32_C(1720939369),  INT32_C( 531427721), -INT32_C( 669287677),  INT32_C( 896519302),  INT32_C(1053001488) } },
+    { { { -INT32_C(1658605711), -INT32_C(1111929715), -INT32_C(1188698901), -INT32_C( 651577607) },
+        {  INT32_C( 192265607), -INT32_C(1138032180), -INT32_C( 752315929),  INT32_C( 172492029) } },
+      { -INT32_C(1658605711), -INT32_C(1111929715), -INT32_C(1188698901), -INT32_C( 651577607),  INT32_C( 192265607), -INT32_C(1138032180), -INT32_C( 752315929),  INT32_C( 172492029) } },
+    { { {  INT32_C( 104531606), -INT32_C(2114850600), -INT32_C( 360807503),  INT32_C(1533165386) },
+        {  INT32_C(1913036109), -INT32_C(   6509951), -INT32_C(1555681380), -INT32_C(1646751429) } },
+      {  INT32_C( 104531606), -INT32_C(2114850600), -INT32_C( 360807503),  INT32_C(1533165386),  INT32_C(1913036109), -INT32_C(   6509951), -INT32_C(1555681380), -INT32_C(1646751429) } },
+    { { { -INT32_C(1670606040), -INT32_C(1153222076),  INT32_C( 522406910),  INT32_C( 876889056) },
+        { -INT32_C(1735291629), -INT32_C(1839739711),  INT32_C(1891803376), -INT32_C(2100121307) } },
+      { -INT32_C(1670606040), -INT32_C(1153222076),  INT32_C( 522406910),  INT32_C( 876889056), -INT32_C(1735291629), -INT32_C(1839739711),  INT32_C(1891803376), -INT32_C(2100121307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t val = { {
+      simde_vld1q_s32(test_vec[i].val[0]),
+      simde_vld1q_s32(test_vec[i].val[1]) } };
+    int32_t r[8];
+
+    simde_vst1q_s32_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t val[2][2];
+    int64_t r[4];
+  } test_vec[] = {
+    { { { -INT64_C(7746221708031374561),  INT64_C(5691645655019329826) },
+        { -INT64_C(6707570723829405505),  INT64_C( 428471655270653500) } },
+      { -INT64_C(7746221708031374561),  INT64_C(5691645655019329826), -INT64_C(6707570723829405505),  INT64_C( 428471655270653500) } },
+    { { { -INT64_C(2923817822276111517),  INT64_C(4242607591331611838) },
+        { -INT64_C(8965325222122036083),  INT64_C(6574848061011925542) } },
+      { -INT64_C(2923817822276111517),  INT64_C(4242607591331611838), -INT64_C(8965325222122036083),  INT64_C(6574848061011925542) } },
+    { { { -INT64_C(8807777005764920917),  INT64_C(9044841513833688620) },
+        {  INT64_C(4216753571206268419), -INT64_C(3411119912811347848) } },
+      { -INT64_C(8807777005764920917),  INT64_C(9044841513833688620),  INT64_C(4216753571206268419), -INT64_C(3411119912811347848) } },
+    { { {  INT64_C(  26252045143253039),  INT64_C(2165282556082973390) },
+        {  INT64_C(2042424397530483368),  INT64_C(8857593157293007792) } },
+      {  INT64_C(  26252045143253039),  INT64_C(2165282556082973390),  INT64_C(2042424397530483368),  INT64_C(8857593157293007792) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t val = { {
+      simde_vld1q_s64(test_vec[i].val[0]),
+      simde_vld1q_s64(test_vec[i].val[1]) } };
+    int64_t r[4];
+
+    simde_vst1q_s64_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u8_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t val[2][16];
+    uint8_t r[32];
+  } test_vec[] = {
+    { { { UINT8_C( 40), UINT8_C( 47), UINT8_C(240), UINT8_C(253), UINT8_C(119), UINT8_C(201), UINT8_C( 44), UINT8_C(166),
+          UINT8_C(175), UINT8_C(171), UINT8_C(222), UINT8_C(128), UINT8_C(199), UINT8_C(119), UINT8_C(221), UINT8_C(206) },
+        { UINT8_C(166), UINT8_C(171), UINT8_C(184), UINT8_C( 65), UINT8_C(174), UINT8_C(175), UINT8_C( 59), UINT8_C( 69),
+          UINT8_C( 72), UINT8_C(191), UINT8_C(221), UINT8_C(120), UINT8_C(  0), UINT8_C(187), UINT8_C(197), UINT8_C(179) } },
+      { UINT8_C( 40), UINT8_C( 47), UINT8_C(240), UINT8_C(253), UINT8_C(119), UINT8_C(201), UINT8_C( 44), UINT8_C(166),
+        UINT8_C(175), UINT8_C(171), UINT8_C(222), UINT8_C(128), UINT8_C(199), UINT8_C(119), UINT8_C(221), UINT8_C(206),
+        UINT8_C(166), UINT8_C(171), UINT8_C(184), UINT8_C( 65), UINT8_C(174), UINT8_C(175), UINT8_C( 59), UINT8_C( 69),
+        UINT8_C( 72), UINT8_C(191), UINT8_C(221), UINT8_C(120), UINT8_C(  0), UINT8_C(187), UINT8_C(197), UINT8_C(179) } },
+    { { { UINT8_C(242), UINT8_C( 33), UINT8_C( 15), UINT8_C(204), UINT8_C( 96), UINT8_C( 47), UINT8_C(166),    UINT8_MAX,
+          UINT8_C(101), UINT8_C( 35), UINT8_C(149), UINT8_C(253), UINT8_C(159), UINT8_C(205), UINT8_C(211), UINT8_C(246) },
+        { UINT8_C(214), UINT8_C( 11), UINT8_C( 79), UINT8_C(159), UINT8_C( 57), UINT8_C(177), UINT8_C(124), UINT8_C( 41),
+          UINT8_C(161), UINT8_C(101), UINT8_C(130), UINT8_C( 78), UINT8_C(105), UINT8_C(245), UINT8_C(185), UINT8_C( 49) } },
+      { UINT8_C(242), UINT8_C( 33), UINT8_C( 15), UINT8_C(204), UINT8_C( 96), UINT8_C( 47), UINT8_C(166),    UINT8_MAX,
+        UINT8_C(101), UINT8_C( 35), UINT8_C(149), UINT8_C(253), UINT8_C(159), UINT8_C(205), UINT8_C(211), UINT8_C(246),
+        UINT8_C(214), UINT8_C( 11), UINT8_C( 79), UINT8_C(159), UINT8_C( 57), UINT8_C(177), UINT8_C(124), UINT8_C( 41),
+        UINT8_C(161), UINT8_C(101), UINT8_C(130), UINT8_C( 78), UINT8_C(105), UINT8_C(245), UINT8_C(185), UINT8_C( 49) } },
+    { { { UINT8_C(169), UINT8_C(197), UINT8_C( 59), UINT8_C( 93), UINT8_C( 38), UINT8_C(174), UINT8_C( 68), UINT8_C(  3),
+          UINT8_C(252), UINT8_C( 37), UINT8_C( 28), UINT8_C(119), UINT8_C(140), UINT8_C(150), UINT8_C( 77), UINT8_C(207) },
+        { UINT8_C(  0), UINT8_C( 84), UINT8_C( 11), UINT8_C(238), UINT8_C( 73), UINT8_C( 81), UINT8_C(234), UINT8_C( 38),
+          UINT8_C(126), UINT8_C( 85), UINT8_C( 11), UINT8_C(133), UINT8_C( 39), UINT8_C(162), UINT8_C(122), UINT8_C(205) } },
+      { UINT8_C(169), UINT8_C(197), UINT8_C( 59), UINT8_C( 93), UINT8_C( 38), UINT8_C(174), UINT8_C( 68), UINT8_C(  3),
+        UINT8_C(252), UINT8_C( 37), UINT8_C( 28), UINT8_C(119), UINT8_C(140), UINT8_C(150), UINT8_C( 77), UINT8_C(207),
+        UINT8_C(  0), UINT8_C( 84), UINT8_C( 11), UINT8_C(238), UINT8_C( 73), UINT8_C( 81), UINT8_C(234), UINT8_C( 38),
+        UINT8_C(126), UINT8_C( 85), UINT8_C( 11), UINT8_C(133), UINT8_C( 39), UINT8_C(162), UINT8_C(122), UINT8_C(205) } },
+    { { { UINT8_C( 39), UINT8_C(174), UINT8_C(185), UINT8_C( 48), UINT8_C(202), UINT8_C(147), UINT8_C( 35), UINT8_C(190),
+          UINT8_C(113), UINT8_C(196), UINT8_C(215), UINT8_C(  7), UINT8_C(230), UINT8_C( 37), UINT8_C( 83), UINT8_C(118) },
+        { UINT8_C( 21), UINT8_C(155), UINT8_C(181), UINT8_C(154), UINT8_C(168), UINT8_C(231), UINT8_C(229), UINT8_C(244),
+          UINT8_C(223), UINT8_C( 28), UINT8_C(180), UINT8_C( 11), UINT8_C( 61), UINT8_C(  0), UINT8_C(100), UINT8_C( 53) } },
+      { UINT8_C( 39), UINT8_C(174), UINT8_C(185), UINT8_C( 48), UINT8_C(202), UINT8_C(147), UINT8_C( 35), UINT8_C(190),
+        UINT8_C(113), UINT8_C(196), UINT8_C(215), UINT8_C(  7), UINT8_C(230), UINT8_C( 37), UINT8_C( 83), UINT8_C(118),
+        UINT8_C( 21), UINT8_C(155), UINT8_C(181), UINT8_C(154), UINT8_C(168), UINT8_C(231), UINT8_C(229), UINT8_C(244),
+        UINT8_C(223), UINT8_C( 28), UINT8_C(180), UINT8_C( 11), UINT8_C( 61), UINT8_C(  0), UINT8_C(100), UINT8_C( 53) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t val = { {
+      simde_vld1q_u8(test_vec[i].val[0]),
+      simde_vld1q_u8(test_vec[i].val[1]) } };
+    uint8_t r[32];
+
+    simde_vst1q_u8_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u16_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t val[2][8];
+    uint16_t r[16];
+  } test_vec[] = {
+    { { { UINT16_C(31328), UINT16_C(60002), UINT16_C( 9227), UINT16_C(51055), UINT16_C( 2601), UINT16_C(14152), UINT16_C(55946), UINT16_C(43335) },
+        { UINT16_C(25657), UINT16_C(37383), UINT16_C(27901), UINT16_C(40854), UINT16_C(41804), UINT16_C(38193), UINT16_C(16135), UINT16_C(58244) } },
+      { UINT16_C(31328), UINT16_C(60002), UINT16_C( 9227), UINT16_C(51055), UINT16_C( 2601), UINT16_C(14152), UINT16_C(55946), UINT16_C(43335),
+        UINT16_C(25657), UINT16_C(37383), UINT16_C(27901), UINT16_C(40854), UINT16_C(41804), UINT16_C(38193), UINT16_C(16135), UINT16_C(58244) } },
+    { { { UINT16_C(63408), UINT16_C(61413), UINT16_C( 4263), UINT16_C(14100), UINT16_C(59247), UINT16_C( 8584), UINT16_C(55177), UINT16_C(30964) },
+        { UINT16_C(62934), UINT16_C( 4122), UINT16_C(45064), UINT16_C(57697), UINT16_C(11488), UINT16_C(16024), UINT16_C( 1366), UINT16_C(65353) } },
+      { UINT16_C(63408), UINT16_C(61413), UINT16_C( 4263), UINT16_C(14100), UINT16_C(59247), UINT16_C( 8584), UINT16_C(55177), UINT16_C(30964),
+        UINT16_C(62934), UINT16_C( 4122), UINT16_C(45064), UINT16_C(57697), UINT16_C(11488), UINT16_C(16024), UINT16_C( 1366), UINT16_C(65353) } },
+    { { { UINT16_C(29952), UINT16_C(38604), UINT16_C(28949), UINT16_C(64462), UINT16_C(49421), UINT16_C( 9517), UINT16_C(43809), UINT16_C(54092) },
+        { UINT16_C(55563), UINT16_C(61743), UINT16_C(28016), UINT16_C(24658), UINT16_C( 4674), UINT16_C(37855), UINT16_C( 4639), UINT16_C(57173) } },
+      { UINT16_C(29952), UINT16_C(38604), UINT16_C(28949), UINT16_C(64462), UINT16_C(49421), UINT16_C( 9517), UINT16_C(43809), UINT16_C(54092),
+        UINT16_C(55563), UINT16_C(61743), UINT16_C(28016), UINT16_C(24658), UINT16_C( 4674), UINT16_C(37855), UINT16_C( 4639), UINT16_C(57173) } },
+    { { { UINT16_C( 9573), UINT16_C(47993), UINT16_C(50810), UINT16_C(59556), UINT16_C(25659), UINT16_C(38616), UINT16_C( 4402), UINT16_C(62248) },
+        { UINT16_C( 5260), UINT16_C(22888), UINT16_C(45978), UINT16_C(15664), UINT16_C( 9643), UINT16_C(54999), UINT16_C(44580), UINT16_C( 4802) } },
+      { UINT16_C( 9573), UINT16_C(47993), UINT16_C(50810), UINT16_C(59556), UINT16_C(25659), UINT16_C(38616), UINT16_C( 4402), UINT16_C(62248),
+        UINT16_C( 5260), UINT16_C(22888), UINT16_C(45978), UINT16_C(15664), UINT16_C( 9643), UINT16_C(54999), UINT16_C(44580), UINT16_C( 4802) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t val = { {
+      simde_vld1q_u16(test_vec[i].val[0]),
+      simde_vld1q_u16(test_vec[i].val[1]) } };
+    uint16_t r[16];
+
+    simde_vst1q_u16_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u32_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t val[2][4];
+    uint32_t r[8];
+  } test_vec[] = {
+    { { { UINT32_C( 119869743), UINT32_C( 136668228), UINT32_C( 913741021), UINT32_C(1012512685) },
+        { UINT32_C(3143769353), UINT32_C(3452936414), UINT32_C(3158376724), UINT32_C(2166664317) } },
+      { UINT32_C( 119869743), UINT32_C( 136668228), UINT32_C( 913741021), UINT32_C(1012512685), UINT32_C(3143769353), UINT32_C(3452936414), UINT32_C(3158376724), UINT32_C(2166664317) } },
+    { { { UINT32_C( 278501785), UINT32_C(1756310172), UINT32_C(2985050335), UINT32_C(3412973719) },
+        { UINT32_C(2223669315), UINT32_C(2608874723), UINT32_C(1516893973), UINT32_C(1686926660) } },
+      { UINT32_C( 278501785), UINT32_C(1756310172), UINT32_C(2985050335), UINT32_C(3412973719), UINT32_C(2223669315), UINT32_C(2608874723), UINT32_C(1516893973), UINT32_C(1686926660) } },
+    { { { UINT32_C(4011506198), UINT32_C(3623472086), UINT32_C(1671950986), UINT32_C(1515209832) },
+        { UINT32_C(3674679750), UINT32_C(2664091407), UINT32_C(1000773602), UINT32_C(3612125576) } },
+      { UINT32_C(4011506198), UINT32_C(3623472086), UINT32_C(1671950986), UINT32_C(1515209832), UINT32_C(3674679750), UINT32_C(2664091407), UINT32_C(1000773602), UINT32_C(3612125576) } },
+    { { { UINT32_C(3212463256), UINT32_C(2006190743), UINT32_C(2096608367), UINT32_C(2005128811) },
+        { UINT32_C( 109773017), UINT32_C(2626609969), UINT32_C(3459954552), UINT32_C(1481386353) } },
+      { UINT32_C(3212463256), UINT32_C(2006190743), UINT32_C(2096608367), UINT32_C(2005128811), UINT32_C( 109773017), UINT32_C(2626609969), UINT32_C(3459954552), UINT32_C(1481386353) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t val = { {
+      simde_vld1q_u32(test_vec[i].val[0]),
+      simde_vld1q_u32(test_vec[i].val[1]) } };
+    uint32_t r[8];
+
+    simde_vst1q_u32_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u64_x2 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t val[2][2];
+    uint64_t r[4];
+  } test_vec[] = {
+    { { { UINT64_C(13038373612979549832), UINT64_C( 2016483534236365425) },
+        { UINT64_C( 8879064061856952085), UINT64_C(  870045546414504451) } },
+      { UINT64_C(13038373612979549832), UINT64_C( 2016483534236365425), UINT64_C( 8879064061856952085), UINT64_C(  870045546414504451) } },
+    { { { UINT64_C(10578376949938983077), UINT64_C( 2267185921459943553) },
+        { UINT64_C( 4131673353745860733), UINT64_C(15148523594156261849) } },
+      { UINT64_C(10578376949938983077), UINT64_C( 2267185921459943553), UINT64_C( 4131673353745860733), UINT64_C(15148523594156261849) } },
+    { { { UINT64_C(12167332369484018806), UINT64_C(13108586654784092595) },
+        { UINT64_C( 6649490905973321090), UINT64_C( 6070507224331946853) } },
+      { UINT64_C(12167332369484018806), UINT64_C(13108586654784092595), UINT64_C( 6649490905973321090), UINT64_C( 6070507224331946853) } },
+    { { { UINT64_C( 9918893959458643803), UINT64_C(10346818270248238282) },
+        { UINT64_C( 7140955945253553016), UINT64_C( 9687645112937791012) } },
+      { UINT64_C( 9918893959458643803), UINT64_C(10346818270248238282), UINT64_C( 7140955945253553016), UINT64_C( 9687645112937791012) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t val = { {
+      simde_vld1q_u64(test_vec[i].val[0]),
+      simde_vld1q_u64(test_vec[i].val[1]) } };
+    uint64_t r[4];
+
+    simde_vst1q_u64_x2(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_f32_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_f64_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s8_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s16_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s32_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s64_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u8_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u16_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u32_x2)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u64_x2)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,524 @@
+#define SIMDE_TEST_ARM_NEON_INSN st1q_x3
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st1q_x3.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst1q_f32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t val[3][4];
+    simde_float32_t r[12];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT32_C(   343.14), SIMDE_FLOAT32_C(  -580.49), SIMDE_FLOAT32_C(  -610.63), SIMDE_FLOAT32_C(  -258.39) },
+        { SIMDE_FLOAT32_C(   738.54), SIMDE_FLOAT32_C(   435.06), SIMDE_FLOAT32_C(  -379.98), SIMDE_FLOAT32_C(  -687.20) },
+        { SIMDE_FLOAT32_C(   162.57), SIMDE_FLOAT32_C(   229.83), SIMDE_FLOAT32_C(   563.09), SIMDE_FLOAT32_C(  -277.05) } },
+      { SIMDE_FLOAT32_C(   343.14), SIMDE_FLOAT32_C(  -580.49), SIMDE_FLOAT32_C(  -610.63), SIMDE_FLOAT32_C(  -258.39),
+        SIMDE_FLOAT32_C(   738.54), SIMDE_FLOAT32_C(   435.06), SIMDE_FLOAT32_C(  -379.98), SIMDE_FLOAT32_C(  -687.20),
+        SIMDE_FLOAT32_C(   162.57), SIMDE_FLOAT32_C(   229.83), SIMDE_FLOAT32_C(   563.09), SIMDE_FLOAT32_C(  -277.05) } },
+    { { { SIMDE_FLOAT32_C(   444.89), SIMDE_FLOAT32_C(  -133.22), SIMDE_FLOAT32_C(  -363.42), SIMDE_FLOAT32_C(   871.27) },
+        { SIMDE_FLOAT32_C(  -576.32), SIMDE_FLOAT32_C(  -263.48), SIMDE_FLOAT32_C(   981.50), SIMDE_FLOAT32_C(  -993.22) },
+        { SIMDE_FLOAT32_C(  -681.83), SIMDE_FLOAT32_C(   264.74), SIMDE_FLOAT32_C(   780.45), SIMDE_FLOAT32_C(  -480.68) } },
+      { SIMDE_FLOAT32_C(   444.89), SIMDE_FLOAT32_C(  -133.22), SIMDE_FLOAT32_C(  -363.42), SIMDE_FLOAT32_C(   871.27),
+        SIMDE_FLOAT32_C(  -576.32), SIMDE_FLOAT32_C(  -263.48), SIMDE_FLOAT32_C(   981.50), SIMDE_FLOAT32_C(  -993.22),
+        SIMDE_FLOAT32_C(  -681.83), SIMDE_FLOAT32_C(   264.74), SIMDE_FLOAT32_C(   780.45), SIMDE_FLOAT32_C(  -480.68) } },
+    { { { SIMDE_FLOAT32_C(  -985.10), SIMDE_FLOAT32_C(  -964.35), SIMDE_FLOAT32_C(  -513.05), SIMDE_FLOAT32_C(   458.15) },
+        { SIMDE_FLOAT32_C(   322.75), SIMDE_FLOAT32_C(   401.11), SIMDE_FLOAT32_C(   823.51), SIMDE_FLOAT32_C(  -920.98) },
+        { SIMDE_FLOAT32_C(  -216.67), SIMDE_FLOAT32_C(   143.21), SIMDE_FLOAT32_C(  -462.70), SIMDE_FLOAT32_C(  -185.17) } },
+      { SIMDE_FLOAT32_C(  -985.10), SIMDE_FLOAT32_C(  -964.35), SIMDE_FLOAT32_C(  -513.05), SIMDE_FLOAT32_C(   458.15),
+        SIMDE_FLOAT32_C(   322.75), SIMDE_FLOAT32_C(   401.11), SIMDE_FLOAT32_C(   823.51), SIMDE_FLOAT32_C(  -920.98),
+        SIMDE_FLOAT32_C(  -216.67), SIMDE_FLOAT32_C(   143.21), SIMDE_FLOAT32_C(  -462.70), SIMDE_FLOAT32_C(  -185.17) } },
+    { { { SIMDE_FLOAT32_C(  -284.42), SIMDE_FLOAT32_C(   -39.67), SIMDE_FLOAT32_C(  -903.33), SIMDE_FLOAT32_C(  -655.78) },
+        { SIMDE_FLOAT32_C(   -60.76), SIMDE_FLOAT32_C(  -154.02), SIMDE_FLOAT32_C(   796.63), SIMDE_FLOAT32_C(   544.74) },
+        { SIMDE_FLOAT32_C(    72.61), SIMDE_FLOAT32_C(   -65.50), SIMDE_FLOAT32_C(  -498.25), SIMDE_FLOAT32_C(   666.43) } },
+      { SIMDE_FLOAT32_C(  -284.42), SIMDE_FLOAT32_C(   -39.67), SIMDE_FLOAT32_C(  -903.33), SIMDE_FLOAT32_C(  -655.78),
+        SIMDE_FLOAT32_C(   -60.76), SIMDE_FLOAT32_C(  -154.02), SIMDE_FLOAT32_C(   796.63), SIMDE_FLOAT32_C(   544.74),
+        SIMDE_FLOAT32_C(    72.61), SIMDE_FLOAT32_C(   -65.50), SIMDE_FLOAT32_C(  -498.25), SIMDE_FLOAT32_C(   666.43) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x3_t val = { {
+      simde_vld1q_f32(test_vec[i].val[0]),
+      simde_vld1q_f32(test_vec[i].val[1]),
+      simde_vld1q_f32(test_vec[i].val[2]) } };
+    simde_float32_t r[12];
+
+    simde_vst1q_f32_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_f64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t val[3][2];
+    simde_float64_t r[6];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT64_C(   520.65), SIMDE_FLOAT64_C(   709.36) },
+        { SIMDE_FLOAT64_C(  -264.36), SIMDE_FLOAT64_C(  -176.21) },
+        { SIMDE_FLOAT64_C(   308.42), SIMDE_FLOAT64_C(  -308.08) } },
+      { SIMDE_FLOAT64_C(   520.65), SIMDE_FLOAT64_C(   709.36), SIMDE_FLOAT64_C(  -264.36), SIMDE_FLOAT64_C(  -176.21),
+        SIMDE_FLOAT64_C(   308.42), SIMDE_FLOAT64_C(  -308.08) } },
+    { { { SIMDE_FLOAT64_C(  -869.30), SIMDE_FLOAT64_C(   397.71) },
+        { SIMDE_FLOAT64_C(  -336.05), SIMDE_FLOAT64_C(  -675.69) },
+        { SIMDE_FLOAT64_C(   101.52), SIMDE_FLOAT64_C(  -465.57) } },
+      { SIMDE_FLOAT64_C(  -869.30), SIMDE_FLOAT64_C(   397.71), SIMDE_FLOAT64_C(  -336.05), SIMDE_FLOAT64_C(  -675.69),
+        SIMDE_FLOAT64_C(   101.52), SIMDE_FLOAT64_C(  -465.57) } },
+    { { { SIMDE_FLOAT64_C(  -796.27), SIMDE_FLOAT64_C(    30.88) },
+        { SIMDE_FLOAT64_C(  -304.93), SIMDE_FLOAT64_C(  -820.84) },
+        { SIMDE_FLOAT64_C(   250.27), SIMDE_FLOAT64_C(   723.74) } },
+      { SIMDE_FLOAT64_C(  -796.27), SIMDE_FLOAT64_C(    30.88), SIMDE_FLOAT64_C(  -304.93), SIMDE_FLOAT64_C(  -820.84),
+        SIMDE_FLOAT64_C(   250.27), SIMDE_FLOAT64_C(   723.74) } },
+    { { { SIMDE_FLOAT64_C(   885.35), SIMDE_FLOAT64_C(  -364.72) },
+        { SIMDE_FLOAT64_C(  -829.72), SIMDE_FLOAT64_C(   137.02) },
+        { SIMDE_FLOAT64_C(  -616.99), SIMDE_FLOAT64_C(   340.52) } },
+      { SIMDE_FLOAT64_C(   885.35), SIMDE_FLOAT64_C(  -364.72), SIMDE_FLOAT64_C(  -829.72), SIMDE_FLOAT64_C(   137.02),
+        SIMDE_FLOAT64_C(  -616.99), SIMDE_FLOAT64_C(   340.52) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x3_t val = { {
+      simde_vld1q_f64(test_vec[i].val[0]),
+      simde_vld1q_f64(test_vec[i].val[1]),
+      simde_vld1q_f64(test_vec[i].val[2]) } };
+    simde_float64_t r[6];
+
+    simde_vst1q_f64_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t val[3][16];
+    int8_t r[48];
+  } test_vec[] = {
+    { { { -INT8_C(  4), -INT8_C( 43),  INT8_C( 39), -INT8_C(  7), -INT8_C( 23),  INT8_C( 90), -INT8_C( 15), -INT8_C( 83),
+          -INT8_C(103), -INT8_C( 26), -INT8_C( 61), -INT8_C( 42),  INT8_C( 29), -INT8_C(125), -INT8_C( 51),  INT8_C( 82) },
+        { -INT8_C( 80),  INT8_C( 20),  INT8_C( 10), -INT8_C( 42),  INT8_C( 72),  INT8_C( 62), -INT8_C(106), -INT8_C(106),
+          -INT8_C( 74), -INT8_C( 32),  INT8_C(109),  INT8_C(117), -INT8_C( 88), -INT8_C( 98),  INT8_C(111),  INT8_C(120) },
+        { -INT8_C(101), -INT8_C( 53), -INT8_C( 67), -INT8_C( 38), -INT8_C(109), -INT8_C( 77), -INT8_C( 84), -INT8_C(  4),
+          -INT8_C( 37), -INT8_C( 27), -INT8_C(  4),  INT8_C( 80), -INT8_C( 98), -INT8_C(  4), -INT8_C(100),     INT8_MAX } },
+      { -INT8_C(  4), -INT8_C( 43),  INT8_C( 39), -INT8_C(  7), -INT8_C( 23),  INT8_C( 90), -INT8_C( 15), -INT8_C( 83),
+        -INT8_C(103), -INT8_C( 26), -INT8_C( 61), -INT8_C( 42),  INT8_C( 29), -INT8_C(125), -INT8_C( 51),  INT8_C( 82),
+        -INT8_C( 80),  INT8_C( 20),  INT8_C( 10), -INT8_C( 42),  INT8_C( 72),  INT8_C( 62), -INT8_C(106), -INT8_C(106),
+        -INT8_C( 74), -INT8_C( 32),  INT8_C(109),  INT8_C(117), -INT8_C( 88), -INT8_C( 98),  INT8_C(111),  INT8_C(120),
+        -INT8_C(101), -INT8_C( 53), -INT8_C( 67), -INT8_C( 38), -INT8_C(109), -INT8_C( 77), -INT8_C( 84), -INT8_C(  4),
+        -INT8_C( 37), -INT8_C( 27), -INT8_C(  4),  INT8_C( 80), -INT8_C( 98), -INT8_C(  4), -INT8_C(100),     INT8_MAX } },
+    { { { -INT8_C( 97),  INT8_C( 47), -INT8_C( 61), -INT8_C( 65), -INT8_C( 70),  INT8_C( 93), -INT8_C( 71), -INT8_C(121),
+           INT8_C(  1),  INT8_C( 11),  INT8_C(103), -INT8_C( 75), -INT8_C( 73),  INT8_C( 94), -INT8_C( 86), -INT8_C( 77) },
+        { -INT8_C( 89),  INT8_C(  1), -INT8_C( 13), -INT8_C( 77), -INT8_C( 90),  INT8_C(105), -INT8_C(102), -INT8_C( 45),
+          -INT8_C( 90),  INT8_C( 57), -INT8_C( 58),  INT8_C( 59),  INT8_C( 62),  INT8_C(  3), -INT8_C( 12),  INT8_C( 42) },
+        {  INT8_C(126),  INT8_C(104),  INT8_C( 33),  INT8_C( 19), -INT8_C( 17),  INT8_C(110), -INT8_C( 17),  INT8_C( 33),
+          -INT8_C(109),  INT8_C( 50),  INT8_C(  9),  INT8_C( 85), -INT8_C(  6), -INT8_C(125),  INT8_C( 98), -INT8_C(108) } },
+      { -INT8_C( 97),  INT8_C( 47), -INT8_C( 61), -INT8_C( 65), -INT8_C( 70),  INT8_C( 93), -INT8_C( 71), -INT8_C(121),
+         INT8_C(  1),  INT8_C( 11),  INT8_C(103), -INT8_C( 75), -INT8_C( 73),  INT8_C( 94), -INT8_C( 86), -INT8_C( 77),
+        -INT8_C( 89),  INT8_C(  1), -INT8_C( 13), -INT8_C( 77), -INT8_C( 90),  INT8_C(105), -INT8_C(102), -INT8_C( 45),
+        -INT8_C( 90),  INT8_C( 57), -INT8_C( 58),  INT8_C( 59),  INT8_C( 62),  INT8_C(  3), -INT8_C( 12),  INT8_C( 42),
+         INT8_C(126),  INT8_C(104),  INT8_C( 33),  INT8_C( 19), -INT8_C( 17),  INT8_C(110), -INT8_C( 17),  INT8_C( 33),
+        -INT8_C(109),  INT8_C( 50),  INT8_C(  9),  INT8_C( 85), -INT8_C(  6), -INT8_C(125),  INT8_C( 98), -INT8_C(108) } },
+    { { {  INT8_C( 25), -INT8_C( 37),  INT8_C( 66), -INT8_C(100), -INT8_C( 69),  INT8_C( 27), -INT8_C(106), -INT8_C(127),
+           INT8_C( 61),  INT8_C( 32), -INT8_C(115), -INT8_C( 51), -INT8_C( 17),  INT8_C( 54),  INT8_C( 67),  INT8_C( 94) },
+        {  INT8_C( 95),  INT8_C( 79),  INT8_C( 21), -INT8_C(120),  INT8_C(111),  INT8_C(101),  INT8_C(106), -INT8_C(108),
+           INT8_C( 56),  INT8_C( 72), -INT8_C(101),  INT8_C(123),  INT8_C( 54),  INT8_C( 73), -INT8_C(113),  INT8_C( 55) },
+        { -INT8_C( 49), -INT8_C(115),  INT8_C(  2), -INT8_C( 59),  INT8_C(  3),  INT8_C( 13),  INT8_C(  7), -INT8_C(112),
+          -INT8_C( 63),  INT8_C(112),  INT8_C( 66), -INT8_C( 93), -INT8_C(  9), -INT8_C(  2),  INT8_C( 71), -INT8_C(  2) } },
+      {  INT8_C( 25), -INT8_C( 37),  INT8_C( 66), -INT8_C(100), -INT8_C( 69),  INT8_C( 27), -INT8_C(106), -INT8_C(127),
+         INT8_C( 61),  INT8_C( 32), -INT8_C(115), -INT8_C( 51), -INT8_C( 17),  INT8_C( 54),  INT8_C( 67),  INT8_C( 94),
+         INT8_C( 95),  INT8_C( 79),  INT8_C( 21), -INT8_C(120),  INT8_C(111),  INT8_C(101),  INT8_C(106), -INT8_C(108),
+         INT8_C( 56),  INT8_C( 72), -INT8_C(101),  INT8_C(123),  INT8_C( 54),  INT8_C( 73), -INT8_C(113),  INT8_C( 55),
+        -INT8_C( 49), -INT8_C(115),  INT8_C(  2), -INT8_C( 59),  INT8_C(  3),  INT8_C( 13),  INT8_C(  7), -INT8_C(112),
+        -INT8_C( 63),  INT8_C(112),  INT8_C( 66), -INT8_C( 93), -INT8_C(  9), -INT8_C(  2),  INT8_C( 71), -INT8_C(  2) } },
+    { { {  INT8_C( 15),  INT8_C( 17),  INT8_C(103),  INT8_C( 42), -INT8_C( 60),  INT8_C( 53), -INT8_C( 52), -INT8_C(  9),
+          -INT8_C( 34), -INT8_C( 10),  INT8_C( 47), -INT8_C(  9),  INT8_C(100),  INT8_C( 60), -INT8_C( 12),  INT8_C( 15) },
+        {  INT8_C( 93), -INT8_C( 13),  INT8_C( 69), -INT8_C(105), -INT8_C( 12),  INT8_C(114), -INT8_C( 23),  INT8_C( 34),
+           INT8_C(120), -INT8_C( 18), -INT8_C( 40),  INT8_C(  0),  INT8_C( 90), -INT8_C( 26),  INT8_C(125), -INT8_C( 25) },
+        { -INT8_C(104),  INT8_C(120),  INT8_C(113), -INT8_C( 63),  INT8_C( 30), -INT8_C( 42), -INT8_C(122), -INT8_C( 46),
+           INT8_C( 22), -INT8_C( 55), -INT8_C(105),  INT8_C( 65), -INT8_C(  8), -INT8_C( 16),  INT8_C( 30), -INT8_C( 68) } },
+      {  INT8_C( 15),  INT8_C( 17),  INT8_C(103),  INT8_C( 42), -INT8_C( 60),  INT8_C( 53), -INT8_C( 52), -INT8_C(  9),
+        -INT8_C( 34), -INT8_C( 10),  INT8_C( 47), -INT8_C(  9),  INT8_C(100),  INT8_C( 60), -INT8_C( 12),  INT8_C( 15),
+         INT8_C( 93), -INT8_C( 13),  INT8_C( 69), -INT8_C(105), -INT8_C( 12),  INT8_C(114), -INT8_C( 23),  INT8_C( 34),
+         INT8_C(120), -INT8_C( 18), -INT8_C( 40),  INT8_C(  0),  INT8_C( 90), -INT8_C( 26),  INT8_C(125), -INT8_C( 25),
+        -INT8_C(104),  INT8_C(120),  INT8_C(113), -INT8_C( 63),  INT8_C( 30), -INT8_C( 42), -INT8_C(122), -INT8_C( 46),
+         INT8_C( 22), -INT8_C( 55), -INT8_C(105),  INT8_C( 65), -INT8_C(  8), -INT8_C( 16),  INT8_C( 30), -INT8_C( 68) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x3_t val = { {
+      simde_vld1q_s8(test_vec[i].val[0]),
+      simde_vld1q_s8(test_vec[i].val[1]),
+      simde_vld1q_s8(test_vec[i].val[2]) } };
+    int8_t r[48];
+
+    simde_vst1q_s8_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t val[3][8];
+    int16_t r[24];
+  } test_vec[] = {
+    { { {  INT16_C( 4356),  INT16_C(25702),  INT16_C(23283), -INT16_C(  976), -INT16_C(16064),  INT16_C( 5577),  INT16_C(17599),  INT16_C(29222) },
+        { -INT16_C(13468), -INT16_C(19896),  INT16_C( 6500),  INT16_C(32203), -INT16_C(  577), -INT16_C( 1950),  INT16_C(11095),  INT16_C( 9790) },
+        { -INT16_C(26821),  INT16_C(31336), -INT16_C(10004),  INT16_C(26597),  INT16_C( 9225),  INT16_C( 3584),  INT16_C( 9262),  INT16_C(  955) } },
+      {  INT16_C( 4356),  INT16_C(25702),  INT16_C(23283), -INT16_C(  976), -INT16_C(16064),  INT16_C( 5577),  INT16_C(17599),  INT16_C(29222),
+        -INT16_C(13468), -INT16_C(19896),  INT16_C( 6500),  INT16_C(32203), -INT16_C(  577), -INT16_C( 1950),  INT16_C(11095),  INT16_C( 9790),
+        -INT16_C(26821),  INT16_C(31336), -INT16_C(10004),  INT16_C(26597),  INT16_C( 9225),  INT16_C( 3584),  INT16_C( 9262),  INT16_C(  955) } },
+    { { { -INT16_C(15585),  INT16_C(17102), -INT16_C(28571),  INT16_C(10581), -INT16_C(25764), -INT16_C(25104), -INT16_C(17103), -INT16_C(29474) },
+        {  INT16_C(28993),  INT16_C(  337), -INT16_C(17506),  INT16_C( 8068), -INT16_C(22598), -INT16_C( 5547),  INT16_C( 8056),  INT16_C( 5790) },
+        {  INT16_C(15260), -INT16_C(19640), -INT16_C( 9808), -INT16_C( 7229), -INT16_C( 7190), -INT16_C( 2882),  INT16_C(22028), -INT16_C( 2845) } },
+      { -INT16_C(15585),  INT16_C(17102), -INT16_C(28571),  INT16_C(10581), -INT16_C(25764), -INT16_C(25104), -INT16_C(17103), -INT16_C(29474),
+         INT16_C(28993),  INT16_C(  337), -INT16_C(17506),  INT16_C( 8068), -INT16_C(22598), -INT16_C( 5547),  INT16_C( 8056),  INT16_C( 5790),
+         INT16_C(15260), -INT16_C(19640), -INT16_C( 9808), -INT16_C( 7229), -INT16_C( 7190), -INT16_C( 2882),  INT16_C(22028), -INT16_C( 2845) } },
+    { { {  INT16_C(12942),  INT16_C(15898), -INT16_C(26798), -INT16_C( 3469), -INT16_C(25001),  INT16_C(30330), -INT16_C(24497),  INT16_C(31287) },
+        { -INT16_C(24874), -INT16_C(  362), -INT16_C(31199),  INT16_C(29653), -INT16_C(11324),  INT16_C( 4265), -INT16_C(20332), -INT16_C(22163) },
+        {  INT16_C(24007), -INT16_C( 9163),  INT16_C( 7092), -INT16_C(11366), -INT16_C( 6928), -INT16_C(31267), -INT16_C(23239),  INT16_C(23558) } },
+      {  INT16_C(12942),  INT16_C(15898), -INT16_C(26798), -INT16_C( 3469), -INT16_C(25001),  INT16_C(30330), -INT16_C(24497),  INT16_C(31287),
+        -INT16_C(24874), -INT16_C(  362), -INT16_C(31199),  INT16_C(29653), -INT16_C(11324),  INT16_C( 4265), -INT16_C(20332), -INT16_C(22163),
+         INT16_C(24007), -INT16_C( 9163),  INT16_C( 7092), -INT16_C(11366), -INT16_C( 6928), -INT16_C(31267), -INT16_C(23239),  INT16_C(23558) } },
+    { { { -INT16_C( 2115), -INT16_C( 4516),  INT16_C(28394), -INT16_C(20416), -INT16_C(19049), -INT16_C(15713), -INT16_C(31667),  INT16_C(23472) },
+        { -INT16_C(13337), -INT16_C(11889), -INT16_C( 8825),  INT16_C( 5173),  INT16_C(  720), -INT16_C(19290), -INT16_C(20041),  INT16_C(   15) },
+        { -INT16_C(  388),  INT16_C( 5673),  INT16_C(  503),  INT16_C( 8608),  INT16_C( 4606), -INT16_C(27727),  INT16_C(16246),  INT16_C(29363) } },
+      { -INT16_C( 2115), -INT16_C( 4516),  INT16_C(28394), -INT16_C(20416), -INT16_C(19049), -INT16_C(15713), -INT16_C(31667),  INT16_C(23472),
+        -INT16_C(13337), -INT16_C(11889), -INT16_C( 8825),  INT16_C( 5173),  INT16_C(  720), -INT16_C(19290), -INT16_C(20041),  INT16_C(   15),
+        -INT16_C(  388),  INT16_C( 5673),  INT16_C(  503),  INT16_C( 8608),  INT16_C( 4606), -INT16_C(27727),  INT16_C(16246),  INT16_C(29363) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x3_t val = { {
+      simde_vld1q_s16(test_vec[i].val[0]),
+      simde_vld1q_s16(test_vec[i].val[1]),
+      simde_vld1q_s16(test_vec[i].val[2]) } };
+    int16_t r[24];
+
+    simde_vst1q_s16_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t val[3][4];
+    int32_t r[12];
+  } test_vec[] = {
+    { { { -INT32_C( 552092022),  INT32_C( 857827323), -INT32_C( 187557945),  INT32_C(1079381835) },
+        { -INT32_C(1579504388),  INT32_C(1536518300),  INT32_C(1571827195),  INT32_C( 912708639) },
+        {  INT32_C(1285290837),  INT32_C(1348812462), -INT32_C( 773426709),  INT32_C(1894204042) } },
+      { -INT32_C( 552092022),  INT32_C( 857827323), -INT32_C( 187557945),  INT32_C(1079381835), -INT32_C(1579504388),  INT32_C(1536518300),  INT32_C(1571827195),  INT32_C( 912708639),
+         INT32_C(1285290837),  INT32_C(1348812462), -INT32_C( 773426709),  INT32_C(1894204042) } },
+    { { {  INT32_C(  78143940),  INT32_C( 268066310),  INT32_C(2051854781),  INT32_C( 340216244) },
+        {  INT32_C( 496426022), -INT32_C(1075079774), -INT32_C(1064356389), -INT32_C(2019979646) },
+        { -INT32_C(1514571240),  INT32_C(1315361553), -INT32_C(1134627011),  INT32_C(2028342414) } },
+      {  INT32_C(  78143940),  INT32_C( 268066310),  INT32_C(2051854781),  INT32_C( 340216244),  INT32_C( 496426022), -INT32_C(1075079774), -INT32_C(1064356389), -INT32_C(2019979646),
+        -INT32_C(1514571240),  INT32_C(1315361553), -INT32_C(1134627011),  INT32_C(2028342414) } },
+    { { {  INT32_C( 888563529),  INT32_C(1231160103), -INT32_C( 445153673), -INT32_C(2061226247) },
+        { -INT32_C(1016645843),  INT32_C( 196065238),  INT32_C( 893705478), -INT32_C(1644704581) },
+        { -INT32_C(1380176233),  INT32_C( 280015357),  INT32_C(2069932148), -INT32_C(2139073925) } },
+      {  INT32_C( 888563529),  INT32_C(1231160103), -INT32_C( 445153673), -INT32_C(2061226247), -INT32_C(1016645843),  INT32_C( 196065238),  INT32_C( 893705478), -INT32_C(1644704581),
+        -INT32_C(1380176233),  INT32_C( 280015357),  INT32_C(2069932148), -INT32_C(2139073925) } },
+    { { { -INT32_C(1164471672), -INT32_C( 992074584), -INT32_C(1904430645), -INT32_C( 592206044) },
+        {  INT32_C( 417828187), -INT32_C(1740955170),  INT32_C(1158773720),  INT32_C( 401955943) },
+        {  INT32_C(1139170931), -INT32_C( 148062398),  INT32_C(2087693280), -INT32_C(1260644160) } },
+      { -INT32_C(1164471672), -INT32_C( 992074584), -INT32_C(1904430645), -INT32_C( 592206044),  INT32_C( 417828187), -INT32_C(1740955170),  INT32_C(1158773720),  INT32_C( 401955943),
+         INT32_C(1139170931), -INT32_C( 148062398),  INT32_C(2087693280), -INT32_C(1260644160) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x3_t val = { {
+      simde_vld1q_s32(test_vec[i].val[0]),
+      simde_vld1q_s32(test_vec[i].val[1]),
+      simde_vld1q_s32(test_vec[i].val[2]) } };
+    int32_t r[12];
+
+    simde_vst1q_s32_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t val[3][2];
+    int64_t r[6];
+  } test_vec[] = {
+    { { { -INT64_C(4957348294947190747), -INT64_C(9079277672582327245) },
+        {  INT64_C(3965603462399556472), -INT64_C(6497663943729252172) },
+        {  INT64_C(7285107866260669950), -INT64_C(6662625652522832404) } },
+      { -INT64_C(4957348294947190747), -INT64_C(9079277672582327245),  INT64_C(3965603462399556472), -INT64_C(6497663943729252172),
+         INT64_C(7285107866260669950), -INT64_C(6662625652522832404) } },
+    { { { -INT64_C(8839453381890295983), -INT64_C(4879725209014095180) },
+        { -INT64_C( 537831640520412599), -INT64_C(2417572169131425580) },
+        {  INT64_C(4490525779575889049),  INT64_C(8714025577763488501) } },
+      { -INT64_C(8839453381890295983), -INT64_C(4879725209014095180), -INT64_C( 537831640520412599), -INT64_C(2417572169131425580),
+         INT64_C(4490525779575889049),  INT64_C(8714025577763488501) } },
+    { { { -INT64_C(1377572792406047954), -INT64_C(8983034472673950178) },
+        { -INT64_C(4169496188914085419), -INT64_C(3606285892877573541) },
+        { -INT64_C(5478956888516126072),  INT64_C(1252925800172206409) } },
+      { -INT64_C(1377572792406047954), -INT64_C(8983034472673950178), -INT64_C(4169496188914085419), -INT64_C(3606285892877573541),
+        -INT64_C(5478956888516126072),  INT64_C(1252925800172206409) } },
+    { { {  INT64_C(2476348255246204274), -INT64_C(8790759472170907581) },
+        { -INT64_C(3991686846870019051),  INT64_C(3560006679808368506) },
+        { -INT64_C(  98485274234201199),  INT64_C(7402084038525823760) } },
+      {  INT64_C(2476348255246204274), -INT64_C(8790759472170907581), -INT64_C(3991686846870019051),  INT64_C(3560006679808368506),
+        -INT64_C(  98485274234201199),  INT64_C(7402084038525823760) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x3_t val = { {
+      simde_vld1q_s64(test_vec[i].val[0]),
+      simde_vld1q_s64(test_vec[i].val[1]),
+      simde_vld1q_s64(test_vec[i].val[2]) } };
+    int64_t r[6];
+
+    simde_vst1q_s64_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u8_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t val[3][16];
+    uint8_t r[48];
+  } test_vec[] = {
+    { { { UINT8_C(189), UINT8_C(188), UINT8_C(214), UINT8_C( 77), UINT8_C( 90), UINT8_C( 35), UINT8_C(163), UINT8_C(138),
+          UINT8_C(131), UINT8_C( 28), UINT8_C(241), UINT8_C(147), UINT8_C( 15), UINT8_C( 26), UINT8_C(161), UINT8_C(166) },
+        { UINT8_C(103), UINT8_C(219), UINT8_C(253), UINT8_C( 37), UINT8_C(204), UINT8_C(139), UINT8_C( 45), UINT8_C(175),
+          UINT8_C(227), UINT8_C( 57), UINT8_C( 75), UINT8_C(241), UINT8_C(251), UINT8_C( 73), UINT8_C(174), UINT8_C( 34) },
+        { UINT8_C( 33), UINT8_C( 58), UINT8_C( 29), UINT8_C(108), UINT8_C( 36), UINT8_C(199), UINT8_C( 15), UINT8_C(160),
+          UINT8_C( 69), UINT8_C(239), UINT8_C(  3), UINT8_C( 74), UINT8_C( 87), UINT8_C(198), UINT8_C( 72), UINT8_C(151) } },
+      { UINT8_C(189), UINT8_C(188), UINT8_C(214), UINT8_C( 77), UINT8_C( 90), UINT8_C( 35), UINT8_C(163), UINT8_C(138),
+        UINT8_C(131), UINT8_C( 28), UINT8_C(241), UINT8_C(147), UINT8_C( 15), UINT8_C( 26), UINT8_C(161), UINT8_C(166),
+        UINT8_C(103), UINT8_C(219), UINT8_C(253), UINT8_C( 37), UINT8_C(204), UINT8_C(139), UINT8_C( 45), UINT8_C(175),
+        UINT8_C(227), UINT8_C( 57), UINT8_C( 75), UINT8_C(241), UINT8_C(251), UINT8_C( 73), UINT8_C(174), UINT8_C( 34),
+        UINT8_C( 33), UINT8_C( 58), UINT8_C( 29), UINT8_C(108), UINT8_C( 36), UINT8_C(199), UINT8_C( 15), UINT8_C(160),
+        UINT8_C( 69), UINT8_C(239), UINT8_C(  3), UINT8_C( 74), UINT8_C( 87), UINT8_C(198), UINT8_C( 72), UINT8_C(151) } },
+    { { { UINT8_C(100), UINT8_C(104), UINT8_C( 17), UINT8_C(142), UINT8_C( 96), UINT8_C(147), UINT8_C( 54), UINT8_C(236),
+          UINT8_C(  3), UINT8_C(190), UINT8_C(224), UINT8_C(129), UINT8_C( 40), UINT8_C(107), UINT8_C(229), UINT8_C(202) },
+        { UINT8_C(160), UINT8_C(104), UINT8_C(128), UINT8_C(119), UINT8_C(103), UINT8_C(135), UINT8_C(203), UINT8_C( 11),
+          UINT8_C(100), UINT8_C(218), UINT8_C( 14), UINT8_C( 88), UINT8_C(210), UINT8_C(117), UINT8_C(236), UINT8_C(201) },
+        { UINT8_C(194), UINT8_C( 25), UINT8_C( 58), UINT8_C( 99), UINT8_C(173), UINT8_C( 48), UINT8_C(243), UINT8_C(232),
+          UINT8_C(145), UINT8_C( 53), UINT8_C(100), UINT8_C(238), UINT8_C(199), UINT8_C( 84), UINT8_C( 42), UINT8_C( 29) } },
+      { UINT8_C(100), UINT8_C(104), UINT8_C( 17), UINT8_C(142), UINT8_C( 96), UINT8_C(147), UINT8_C( 54), UINT8_C(236),
+        UINT8_C(  3), UINT8_C(190), UINT8_C(224), UINT8_C(129), UINT8_C( 40), UINT8_C(107), UINT8_C(229), UINT8_C(202),
+        UINT8_C(160), UINT8_C(104), UINT8_C(128), UINT8_C(119), UINT8_C(103), UINT8_C(135), UINT8_C(203), UINT8_C( 11),
+        UINT8_C(100), UINT8_C(218), UINT8_C( 14), UINT8_C( 88), UINT8_C(210), UINT8_C(117), UINT8_C(236), UINT8_C(201),
+        UINT8_C(194), UINT8_C( 25), UINT8_C( 58), UINT8_C( 99), UINT8_C(173), UINT8_C( 48), UINT8_C(243), UINT8_C(232),
+        UINT8_C(145), UINT8_C( 53), UINT8_C(100), UINT8_C(238), UINT8_C(199), UINT8_C( 84), UINT8_C( 42), UINT8_C( 29) } },
+    { { { UINT8_C(212), UINT8_C(  6), UINT8_C( 33), UINT8_C(193), UINT8_C(223), UINT8_C( 77), UINT8_C(251), UINT8_C(135),
+          UINT8_C( 16), UINT8_C(109), UINT8_C( 91), UINT8_C( 89), UINT8_C(101), UINT8_C(135), UINT8_C( 31), UINT8_C(210) },
+        { UINT8_C(242), UINT8_C(141), UINT8_C(173), UINT8_C(116), UINT8_C(253), UINT8_C( 26), UINT8_C(212), UINT8_C( 47),
+          UINT8_C(180), UINT8_C( 19), UINT8_C( 29), UINT8_C(107), UINT8_C(243), UINT8_C(120), UINT8_C( 41), UINT8_C( 20) },
+        { UINT8_C(223), UINT8_C(200), UINT8_C(172), UINT8_C( 37), UINT8_C(157), UINT8_C( 96), UINT8_C( 52), UINT8_C( 79),
+          UINT8_C(136), UINT8_C(179), UINT8_C(182), UINT8_C(236), UINT8_C( 25), UINT8_C(249), UINT8_C(132), UINT8_C(152) } },
+      { UINT8_C(212), UINT8_C(  6), UINT8_C( 33), UINT8_C(193), UINT8_C(223), UINT8_C( 77), UINT8_C(251), UINT8_C(135),
+        UINT8_C( 16), UINT8_C(109), UINT8_C( 91), UINT8_C( 89), UINT8_C(101), UINT8_C(135), UINT8_C( 31), UINT8_C(210),
+        UINT8_C(242), UINT8_C(141), UINT8_C(173), UINT8_C(116), UINT8_C(253), UINT8_C( 26), UINT8_C(212), UINT8_C( 47),
+        UINT8_C(180), UINT8_C( 19), UINT8_C( 29), UINT8_C(107), UINT8_C(243), UINT8_C(120), UINT8_C( 41), UINT8_C( 20),
+        UINT8_C(223), UINT8_C(200), UINT8_C(172), UINT8_C( 37), UINT8_C(157), UINT8_C( 96), UINT8_C( 52), UINT8_C( 79),
+        UINT8_C(136), UINT8_C(179), UINT8_C(182), UINT8_C(236), UINT8_C( 25), UINT8_C(249), UINT8_C(132), UINT8_C(152) } },
+    { { { UINT8_C( 69), UINT8_C(152), UINT8_C(247), UINT8_C( 85), UINT8_C( 17), UINT8_C(237), UINT8_C( 76), UINT8_C(206),
+          UINT8_C(254), UINT8_C( 57), UINT8_C(148), UINT8_C(212), UINT8_C(205), UINT8_C(248), UINT8_C( 74), UINT8_C(163) },
+        { UINT8_C(233), UINT8_C(204), UINT8_C( 28), UINT8_C( 49), UINT8_C( 40), UINT8_C(251), UINT8_C(245), UINT8_C( 99),
+          UINT8_C(244), UINT8_C(212), UINT8_C(105), UINT8_C(226), UINT8_C(229), UINT8_C(249), UINT8_C( 31), UINT8_C( 75) },
+        { UINT8_C( 37), UINT8_C(205), UINT8_C(224), UINT8_C(251), UINT8_C(183), UINT8_C( 45), UINT8_C(160), UINT8_C(112),
+          UINT8_C( 54), UINT8_C( 61), UINT8_C( 23), UINT8_C(  6), UINT8_C(122), UINT8_C(180), UINT8_C(159), UINT8_C(204) } },
+      { UINT8_C( 69), UINT8_C(152), UINT8_C(247), UINT8_C( 85), UINT8_C( 17), UINT8_C(237), UINT8_C( 76), UINT8_C(206),
+        UINT8_C(254), UINT8_C( 57), UINT8_C(148), UINT8_C(212), UINT8_C(205), UINT8_C(248), UINT8_C( 74), UINT8_C(163),
+        UINT8_C(233), UINT8_C(204), UINT8_C( 28), UINT8_C( 49), UINT8_C( 40), UINT8_C(251), UINT8_C(245), UINT8_C( 99),
+        UINT8_C(244), UINT8_C(212), UINT8_C(105), UINT8_C(226), UINT8_C(229), UINT8_C(249), UINT8_C( 31), UINT8_C( 75),
+        UINT8_C( 37), UINT8_C(205), UINT8_C(224), UINT8_C(251), UINT8_C(183), UINT8_C( 45), UINT8_C(160), UINT8_C(112),
+        UINT8_C( 54), UINT8_C( 61), UINT8_C( 23), UINT8_C(  6), UINT8_C(122), UINT8_C(180), UINT8_C(159), UINT8_C(204) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x3_t val = { {
+      simde_vld1q_u8(test_vec[i].val[0]),
+      simde_vld1q_u8(test_vec[i].val[1]),
+      simde_vld1q_u8(test_vec[i].val[2]) } };
+    uint8_t r[48];
+
+    simde_vst1q_u8_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u16_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t val[3][8];
+    uint16_t r[24];
+  } test_vec[] = {
+    { { { UINT16_C(13709), UINT16_C(45816), UINT16_C(44862), UINT16_C( 8338), UINT16_C(22167), UINT16_C(50682), UINT16_C(56144), UINT16_C(32814) },
+        { UINT16_C(38957), UINT16_C(52944), UINT16_C(  336), UINT16_C( 9095), UINT16_C(25686), UINT16_C(49979), UINT16_C(53084), UINT16_C(42865) },
+        { UINT16_C(61223), UINT16_C(36331), UINT16_C(19940), UINT16_C(27672), UINT16_C(56660), UINT16_C(38031), UINT16_C(37458), UINT16_C(11100) } },
+      { UINT16_C(13709), UINT16_C(45816), UINT16_C(44862), UINT16_C( 8338), UINT16_C(22167), UINT16_C(50682), UINT16_C(56144), UINT16_C(32814),
+        UINT16_C(38957), UINT16_C(52944), UINT16_C(  336), UINT16_C( 9095), UINT16_C(25686), UINT16_C(49979), UINT16_C(53084), UINT16_C(42865),
+        UINT16_C(61223), UINT16_C(36331), UINT16_C(19940), UINT16_C(27672), UINT16_C(56660), UINT16_C(38031), UINT16_C(37458), UINT16_C(11100) } },
+    { { { UINT16_C(56068), UINT16_C( 7365), UINT16_C(50995), UINT16_C(26691), UINT16_C(38266), UINT16_C(51043), UINT16_C(23081), UINT16_C( 4389) },
+        { UINT16_C(20800), UINT16_C(58340), UINT16_C(38422), UINT16_C(53918), UINT16_C(54793), UINT16_C(  769), UINT16_C(31537), UINT16_C(38491) },
+        { UINT16_C(45038), UINT16_C(17801), UINT16_C(27208), UINT16_C(25531), UINT16_C(35519), UINT16_C(  805), UINT16_C(18181), UINT16_C(64003) } },
+      { UINT16_C(56068), UINT16_C( 7365), UINT16_C(50995), UINT16_C(26691), UINT16_C(38266), UINT16_C(51043), UINT16_C(23081), UINT16_C( 4389),
+        UINT16_C(20800), UINT16_C(58340), UINT16_C(38422), UINT16_C(53918), UINT16_C(54793), UINT16_C(  769), UINT16_C(31537), UINT16_C(38491),
+        UINT16_C(45038), UINT16_C(17801), UINT16_C(27208), UINT16_C(25531), UINT16_C(35519), UINT16_C(  805), UINT16_C(18181), UINT16_C(64003) } },
+    { { { UINT16_C(35126), UINT16_C(23403), UINT16_C(49894), UINT16_C(51476), UINT16_C(63555), UINT16_C(55601), UINT16_C(26144), UINT16_C(   98) },
+        { UINT16_C(12893), UINT16_C(63328), UINT16_C(54006), UINT16_C(19560), UINT16_C(63056), UINT16_C(16128), UINT16_C(11009), UINT16_C( 7775) },
+        { UINT16_C(53859), UINT16_C( 3334), UINT16_C(51731), UINT16_C( 8037), UINT16_C(41528), UINT16_C(50385), UINT16_C(43729), UINT16_C(20743) } },
+      { UINT16_C(35126), UINT16_C(23403), UINT16_C(49894), UINT16_C(51476), UINT16_C(63555), UINT16_C(55601), UINT16_C(26144), UINT16_C(   98),
+        UINT16_C(12893), UINT16_C(63328), UINT16_C(54006), UINT16_C(19560), UINT16_C(63056), UINT16_C(16128), UINT16_C(11009), UINT16_C( 7775),
+        UINT16_C(53859), UINT16_C( 3334), UINT16_C(51731), UINT16_C( 8037), UINT16_C(41528), UINT16_C(50385), UINT16_C(43729), UINT16_C(20743) } },
+    { { { UINT16_C(43080), UINT16_C( 3741), UINT16_C(50123), UINT16_C( 1876), UINT16_C(18720), UINT16_C(54863), UINT16_C(24080), UINT16_C(45699) },
+        { UINT16_C( 3589), UINT16_C(31501), UINT16_C(59878), UINT16_C(35134), UINT16_C(31195), UINT16_C(46599), UINT16_C(45251), UINT16_C(21805) },
+        { UINT16_C(48381), UINT16_C(64910), UINT16_C( 8599), UINT16_C(39261), UINT16_C(32781), UINT16_C(34404), UINT16_C(64824), UINT16_C( 3022) } },
+      { UINT16_C(43080), UINT16_C( 3741), UINT16_C(50123), UINT16_C( 1876), UINT16_C(18720), UINT16_C(54863), UINT16_C(24080), UINT16_C(45699),
+        UINT16_C( 3589), UINT16_C(31501), UINT16_C(59878), UINT16_C(35134), UINT16_C(31195), UINT16_C(46599), UINT16_C(45251), UINT16_C(21805),
+        UINT16_C(48381), UINT16_C(64910), UINT16_C( 8599), UINT16_C(39261), UINT16_C(32781), UINT16_C(34404), UINT16_C(64824), UINT16_C( 3022) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x3_t val = { {
+      simde_vld1q_u16(test_vec[i].val[0]),
+      simde_vld1q_u16(test_vec[i].val[1]),
+      simde_vld1q_u16(test_vec[i].val[2]) } };
+    uint16_t r[24];
+
+    simde_vst1q_u16_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u32_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t val[3][4];
+    uint32_t r[12];
+  } test_vec[] = {
+    { { { UINT32_C(3698134070), UINT32_C(2198303950), UINT32_C( 138798987), UINT32_C(1725616574) },
+        { UINT32_C(1916035214), UINT32_C(4274187798), UINT32_C( 821561788), UINT32_C(1659240415) },
+        { UINT32_C(3917793587), UINT32_C(3560854892), UINT32_C( 779967685), UINT32_C(1436411168) } },
+      { UINT32_C(3698134070), UINT32_C(2198303950), UINT32_C( 138798987), UINT32_C(1725616574), UINT32_C(1916035214), UINT32_C(4274187798), UINT32_C( 821561788), UINT32_C(1659240415),
+        UINT32_C(3917793587), UINT32_C(3560854892), UINT32_C( 779967685), UINT32_C(1436411168) } },
+    { { { UINT32_C(2230079443), UINT32_C(1496527233), UINT32_C(3321782607), UINT32_C( 715577848) },
+        { UINT32_C( 352928039), UINT32_C(4170800398), UINT32_C( 262221114), UINT32_C(1474227388) },
+        { UINT32_C( 856371243), UINT32_C(1484762486), UINT32_C( 238171600), UINT32_C(3582523944) } },
+      { UINT32_C(2230079443), UINT32_C(1496527233), UINT32_C(3321782607), UINT32_C( 715577848), UINT32_C( 352928039), UINT32_C(4170800398), UINT32_C( 262221114), UINT32_C(1474227388),
+        UINT32_C( 856371243), UINT32_C(1484762486), UINT32_C( 238171600), UINT32_C(3582523944) } },
+    { { { UINT32_C(1500302271), UINT32_C(2109707361), UINT32_C(2416943948), UINT32_C(2356707012) },
+        { UINT32_C(1309114401), UINT32_C(1316122341), UINT32_C(3251973930), UINT32_C(3001641148) },
+        { UINT32_C( 508292994), UINT32_C(4273878266), UINT32_C(2814541873), UINT32_C(1232355307) } },
+      { UINT32_C(1500302271), UINT32_C(2109707361), UINT32_C(2416943948), UINT32_C(2356707012), UINT32_C(1309114401), UINT32_C(1316122341), UINT32_C(3251973930), UINT32_C(3001641148),
+        UINT32_C( 508292994), UINT32_C(4273878266), UINT32_C(2814541873), UINT32_C(1232355307) } },
+    { { { UINT32_C( 587934665), UINT32_C( 628103041), UINT32_C(2526437465), UINT32_C(3145476137) },
+        { UINT32_C(3595363344), UINT32_C(2577206302), UINT32_C(2103535494), UINT32_C(1691617838) },
+        { UINT32_C( 948286880), UINT32_C(2453303733), UINT32_C(3676543236), UINT32_C(2503724409) } },
+      { UINT32_C( 587934665), UINT32_C( 628103041), UINT32_C(2526437465), UINT32_C(3145476137), UINT32_C(3595363344), UINT32_C(2577206302), UINT32_C(2103535494), UINT32_C(1691617838),
+        UINT32_C( 948286880), UINT32_C(2453303733), UINT32_C(3676543236), UINT32_C(2503724409) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x3_t val = { {
+      simde_vld1q_u32(test_vec[i].val[0]),
+      simde_vld1q_u32(test_vec[i].val[1]),
+      simde_vld1q_u32(test_vec[i].val[2]) } };
+    uint32_t r[12];
+
+    simde_vst1q_u32_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u64_x3 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t val[3][2];
+    uint64_t r[6];
+  } test_vec[] = {
+    { { { UINT64_C(17894921404437821570), UINT64_C(18310187027336110086) },
+        { UINT64_C(12948590436132021147), UINT64_C( 1320015529246188444) },
+        { UINT64_C(17960677480674672736), UINT64_C( 8677894431573503141) } },
+      { UINT64_C(17894921404437821570), UINT64_C(18310187027336110086), UINT64_C(12948590436132021147), UINT64_C( 1320015529246188444),
+        UINT64_C(17960677480674672736), UINT64_C( 8677894431573503141) } },
+    { { { UINT64_C( 3416873249712688739), UINT64_C( 2053290487289942496) },
+        { UINT64_C(18251851201551001640), UINT64_C( 4149794894437936397) },
+        { UINT64_C( 9974584281119783727), UINT64_C(15965699654655455839) } },
+      { UINT64_C( 3416873249712688739), UINT64_C( 2053290487289942496), UINT64_C(18251851201551001640), UINT64_C( 4149794894437936397),
+        UINT64_C( 9974584281119783727), UINT64_C(15965699654655455839) } },
+    { { { UINT64_C( 3299437155769962622), UINT64_C( 3841082238383965383) },
+        { UINT64_C( 7011458395449101332), UINT64_C( 7913118780798418784) },
+        { UINT64_C(14515434759015974165), UINT64_C(12059318708003283390) } },
+      { UINT64_C( 3299437155769962622), UINT64_C( 3841082238383965383), UINT64_C( 7011458395449101332), UINT64_C( 7913118780798418784),
+        UINT64_C(14515434759015974165), UINT64_C(12059318708003283390) } },
+    { { { UINT64_C( 2802865339741663818), UINT64_C( 3641267550587383782) },
+        { UINT64_C( 2905089053230584036), UINT64_C( 2540068708330648125) },
+        { UINT64_C(14031353555448239923), UINT64_C(10430156686553684969) } },
+      { UINT64_C( 2802865339741663818), UINT64_C( 3641267550587383782), UINT64_C( 2905089053230584036), UINT64_C( 2540068708330648125),
+        UINT64_C(14031353555448239923), UINT64_C(10430156686553684969) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x3_t val = { {
+      simde_vld1q_u64(test_vec[i].val[0]),
+      simde_vld1q_u64(test_vec[i].val[1]),
+      simde_vld1q_u64(test_vec[i].val[2]) } };
+    uint64_t r[6];
+
+    simde_vst1q_u64_x3(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_f32_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_f64_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s8_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s16_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s32_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s64_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u8_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u16_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u32_x3)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u64_x3)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
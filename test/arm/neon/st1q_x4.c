@@ -0,0 +1,610 @@
+#define SIMDE_TEST_ARM_NEON_INSN st1q_x4
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st1q_x4.h"
+#include "../../../simde/arm/neon/ld1.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst1q_f32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t val[4][4];
+    simde_float32_t r[16];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT32_C(   956.04), SIMDE_FLOAT32_C(  -873.06), SIMDE_FLOAT32_C(   -72.22), SIMDE_FLOAT32_C(   722.55) },
+        { SIMDE_FLOAT32_C(   558.47), SIMDE_FLOAT32_C(  -974.21), SIMDE_FLOAT32_C(   403.00), SIMDE_FLOAT32_C(   456.37) },
+        { SIMDE_FLOAT32_C(  -805.64), SIMDE_FLOAT32_C(   582.73), SIMDE_FLOAT32_C(  -190.98), SIMDE_FLOAT32_C(  -301.97) },
+        { SIMDE_FLOAT32_C(   141.60), SIMDE_FLOAT32_C(  -761.24), SIMDE_FLOAT32_C(   245.69), SIMDE_FLOAT32_C(  -931.52) } },
+      { SIMDE_FLOAT32_C(   956.04), SIMDE_FLOAT32_C(  -873.06), SIMDE_FLOAT32_C(   -72.22), SIMDE_FLOAT32_C(   722.55),
+        SIMDE_FLOAT32_C(   558.47), SIMDE_FLOAT32_C(  -974.21), SIMDE_FLOAT32_C(   403.00), SIMDE_FLOAT32_C(   456.37),
+        SIMDE_FLOAT32_C(  -805.64), SIMDE_FLOAT32_C(   582.73), SIMDE_FLOAT32_C(  -190.98), SIMDE_FLOAT32_C(  -301.97),
+        SIMDE_FLOAT32_C(   141.60), SIMDE_FLOAT32_C(  -761.24), SIMDE_FLOAT32_C(   245.69), SIMDE_FLOAT32_C(  -931.52) } },
+    { { { SIMDE_FLOAT32_C(   419.91), SIMDE_FLOAT32_C(  -131.16), SIMDE_FLOAT32_C(  -839.83), SIMDE_FLOAT32_C(  -962.40) },
+        { SIMDE_FLOAT32_C(   572.93), SIMDE_FLOAT32_C(  -616.60), SIMDE_FLOAT32_C(  -221.40), SIMDE_FLOAT32_C(  -228.26) },
+        { SIMDE_FLOAT32_C(  -110.04), SIMDE_FLOAT32_C(   212.95), SIMDE_FLOAT32_C(  -389.47), SIMDE_FLOAT32_C(  -126.60) },
+        { SIMDE_FLOAT32_C(   489.58), SIMDE_FLOAT32_C(  -906.55), SIMDE_FLOAT32_C(  -251.80), SIMDE_FLOAT32_C(   -62.81) } },
+      { SIMDE_FLOAT32_C(   419.91), SIMDE_FLOAT32_C(  -131.16), SIMDE_FLOAT32_C(  -839.83), SIMDE_FLOAT32_C(  -962.40),
+        SIMDE_FLOAT32_C(   572.93), SIMDE_FLOAT32_C(  -616.60), SIMDE_FLOAT32_C(  -221.40), SIMDE_FLOAT32_C(  -228.26),
+        SIMDE_FLOAT32_C(  -110.04), SIMDE_FLOAT32_C(   212.95), SIMDE_FLOAT32_C(  -389.47), SIMDE_FLOAT32_C(  -126.60),
+        SIMDE_FLOAT32_C(   489.58), SIMDE_FLOAT32_C(  -906.55), SIMDE_FLOAT32_C(  -251.80), SIMDE_FLOAT32_C(   -62.81) } },
+    { { { SIMDE_FLOAT32_C(  -930.66), SIMDE_FLOAT32_C(  -944.02), SIMDE_FLOAT32_C(   619.35), SIMDE_FLOAT32_C(  -119.30) },
+        { SIMDE_FLOAT32_C(  -778.41), SIMDE_FLOAT32_C(   555.30), SIMDE_FLOAT32_C(   402.44), SIMDE_FLOAT32_C(  -635.81) },
+        { SIMDE_FLOAT32_C(   219.39), SIMDE_FLOAT32_C(   440.02), SIMDE_FLOAT32_C(  -528.02), SIMDE_FLOAT32_C(  -274.45) },
+        { SIMDE_FLOAT32_C(  -550.35), SIMDE_FLOAT32_C(  -622.15), SIMDE_FLOAT32_C(   970.28), SIMDE_FLOAT32_C(   851.67) } },
+      { SIMDE_FLOAT32_C(  -930.66), SIMDE_FLOAT32_C(  -944.02), SIMDE_FLOAT32_C(   619.35), SIMDE_FLOAT32_C(  -119.30),
+        SIMDE_FLOAT32_C(  -778.41), SIMDE_FLOAT32_C(   555.30), SIMDE_FLOAT32_C(   402.44), SIMDE_FLOAT32_C(  -635.81),
+        SIMDE_FLOAT32_C(   219.39), SIMDE_FLOAT32_C(   440.02), SIMDE_FLOAT32_C(  -528.02), SIMDE_FLOAT32_C(  -274.45),
+        SIMDE_FLOAT32_C(  -550.35), SIMDE_FLOAT32_C(  -622.15), SIMDE_FLOAT32_C(   970.28), SIMDE_FLOAT32_C(   851.67) } },
+    { { { SIMDE_FLOAT32_C(   331.43), SIMDE_FLOAT32_C(   863.78), SIMDE_FLOAT32_C(   513.44), SIMDE_FLOAT32_C(   781.04) },
+        { SIMDE_FLOAT32_C(   918.67), SIMDE_FLOAT32_C(  -178.06), SIMDE_FLOAT32_C(  -696.96), SIMDE_FLOAT32_C(    27.43) },
+        { SIMDE_FLOAT32_C(  -648.48), SIMDE_FLOAT32_C(   514.49), SIMDE_FLOAT32_C(  -786.88), SIMDE_FLOAT32_C(   618.20) },
+        { SIMDE_FLOAT32_C(   280.02), SIMDE_FLOAT32_C(   153.62), SIMDE_FLOAT32_C(   338.53), SIMDE_FLOAT32_C(   180.88) } },
+      { SIMDE_FLOAT32_C(   331.43), SIMDE_FLOAT32_C(   863.78), SIMDE_FLOAT32_C(   513.44), SIMDE_FLOAT32_C(   781.04),
+        SIMDE_FLOAT32_C(   918.67), SIMDE_FLOAT32_C(  -178.06), SIMDE_FLOAT32_C(  -696.96), SIMDE_FLOAT32_C(    27.43),
+        SIMDE_FLOAT32_C(  -648.48), SIMDE_FLOAT32_C(   514.49), SIMDE_FLOAT32_C(  -786.88), SIMDE_FLOAT32_C(   618.20),
+        SIMDE_FLOAT32_C(   280.02), SIMDE_FLOAT32_C(   153.62), SIMDE_FLOAT32_C(   338.53), SIMDE_FLOAT32_C(   180.88) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x4_t val = { {
+      simde_vld1q_f32(test_vec[i].val[0]),
+      simde_vld1q_f32(test_vec[i].val[1]),
+      simde_vld1q_f32(test_vec[i].val[2]),
+      simde_vld1q_f32(test_vec[i].val[3]) } };
+    simde_float32_t r[16];
+
+    simde_vst1q_f32_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_f64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t val[4][2];
+    simde_float64_t r[8];
+  } test_vec[] = {
+    { { { SIMDE_FLOAT64_C(   954.95), SIMDE_FLOAT64_C(   865.46) },
+        { SIMDE_FLOAT64_C(  -687.54), SIMDE_FLOAT64_C(   904.39) },
+        { SIMDE_FLOAT64_C(   776.06), SIMDE_FLOAT64_C(   974.76) },
+        { SIMDE_FLOAT64_C(  -201.18), SIMDE_FLOAT64_C(   475.87) } },
+      { SIMDE_FLOAT64_C(   954.95), SIMDE_FLOAT64_C(   865.46), SIMDE_FLOAT64_C(  -687.54), SIMDE_FLOAT64_C(   904.39),
+        SIMDE_FLOAT64_C(   776.06), SIMDE_FLOAT64_C(   974.76), SIMDE_FLOAT64_C(  -201.18), SIMDE_FLOAT64_C(   475.87) } },
+    { { { SIMDE_FLOAT64_C(   192.29), SIMDE_FLOAT64_C(  -736.04) },
+        { SIMDE_FLOAT64_C(   887.77), SIMDE_FLOAT64_C(  -425.64) },
+        { SIMDE_FLOAT64_C(   584.19), SIMDE_FLOAT64_C(  -511.74) },
+        { SIMDE_FLOAT64_C(   779.59), SIMDE_FLOAT64_C(   -41.89) } },
+      { SIMDE_FLOAT64_C(   192.29), SIMDE_FLOAT64_C(  -736.04), SIMDE_FLOAT64_C(   887.77), SIMDE_FLOAT64_C(  -425.64),
+        SIMDE_FLOAT64_C(   584.19), SIMDE_FLOAT64_C(  -511.74), SIMDE_FLOAT64_C(   779.59), SIMDE_FLOAT64_C(   -41.89) } },
+    { { { SIMDE_FLOAT64_C(   788.89), SIMDE_FLOAT64_C(   956.32) },
+        { SIMDE_FLOAT64_C(   749.74), SIMDE_FLOAT64_C(   865.01) },
+        { SIMDE_FLOAT64_C(  -410.38), SIMDE_FLOAT64_C(   819.35) },
+        { SIMDE_FLOAT64_C(  -941.35), SIMDE_FLOAT64_C(   -17.15) } },
+      { SIMDE_FLOAT64_C(   788.89), SIMDE_FLOAT64_C(   956.32), SIMDE_FLOAT64_C(   749.74), SIMDE_FLOAT64_C(   865.01),
+        SIMDE_FLOAT64_C(  -410.38), SIMDE_FLOAT64_C(   819.35), SIMDE_FLOAT64_C(  -941.35), SIMDE_FLOAT64_C(   -17.15) } },
+    { { { SIMDE_FLOAT64_C(   992.55), SIMDE_FLOAT64_C(   128.77) },
+        { SIMDE_FLOAT64_C(  -111.56), SIMDE_FLOAT64_C(   112.73) },
+        { SIMDE_FLOAT64_C(  -647.51), SIMDE_FLOAT64_C(  -199.94) },
+        { SIMDE_FLOAT64_C(   134.85), SIMDE_FLOAT64_C(   197.29) } },
+      { SIMDE_FLOAT64_C(   992.55), SIMDE_FLOAT64_C(   128.77), SIMDE_FLOAT64_C(  -111.56), SIMDE_FLOAT64_C(   112.73),
+        SIMDE_FLOAT64_C(  -647.51), SIMDE_FLOAT64_C(  -199.94), SIMDE_FLOAT64_C(   134.85), SIMDE_FLOAT64_C(   197.29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x4_t val = { {
+      simde_vld1q_f64(test_vec[i].val[0]),
+      simde_vld1q_f64(test_vec[i].val[1]),
+      simde_vld1q_f64(test_vec[i].val[2]),
+      simde_vld1q_f64(test_vec[i].val[3]) } };
+    simde_float64_t r[8];
+
+    simde_vst1q_f64_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t val[4][16];
+    int8_t r[64];
+  } test_vec[] = {
+    { { { -INT8_C( 27), -INT8_C(124),  INT8_C( 21), -INT8_C(127), -INT8_C( 41),  INT8_C(103), -INT8_C( 34), -INT8_C( 23),
+          -INT8_C( 80), -INT8_C(114),  INT8_C( 74), -INT8_C(126),  INT8_C(111), -INT8_C(124),  INT8_C(117), -INT8_C( 34) },
+        { -INT8_C(  7), -INT8_C(126), -INT8_C(114), -INT8_C(108),  INT8_C( 83), -INT8_C( 54),  INT8_C( 22),  INT8_C( 27),
+          -INT8_C( 24),  INT8_C( 93), -INT8_C( 68), -INT8_C( 26),  INT8_C( 77), -INT8_C( 98), -INT8_C( 12), -INT8_C(113) },
+        { -INT8_C( 65),  INT8_C( 38),  INT8_C( 14), -INT8_C( 43), -INT8_C(  5),  INT8_C( 23), -INT8_C( 15),  INT8_C( 20),
+           INT8_C( 85), -INT8_C( 11),  INT8_C( 90), -INT8_C( 42),  INT8_C( 65), -INT8_C( 88), -INT8_C( 57), -INT8_C( 99) },
+        { -INT8_C( 61),  INT8_C( 20),  INT8_C( 71),  INT8_C(  0),  INT8_C(  4),  INT8_C( 32), -INT8_C( 75), -INT8_C( 93),
+          -INT8_C( 21),  INT8_C( 44), -INT8_C( 35),  INT8_C( 11), -INT8_C( 19), -INT8_C( 87),  INT8_C(110),  INT8_C(114) } },
+      { -INT8_C( 27), -INT8_C(124),  INT8_C( 21), -INT8_C(127), -INT8_C( 41),  INT8_C(103), -INT8_C( 34), -INT8_C( 23),
+        -INT8_C( 80), -INT8_C(114),  INT8_C( 74), -INT8_C(126),  INT8_C(111), -INT8_C(124),  INT8_C(117), -INT8_C( 34),
+        -INT8_C(  7), -INT8_C(126), -INT8_C(114), -INT8_C(108),  INT8_C( 83), -INT8_C( 54),  INT8_C( 22),  INT8_C( 27),
+        -INT8_C( 24),  INT8_C( 93), -INT8_C( 68), -INT8_C( 26),  INT8_C( 77), -INT8_C( 98), -INT8_C( 12), -INT8_C(113),
+        -INT8_C( 65),  INT8_C( 38),  INT8_C( 14), -INT8_C( 43), -INT8_C(  5),  INT8_C( 23), -INT8_C( 15),  INT8_C( 20),
+         INT8_C( 85), -INT8_C( 11),  INT8_C( 90), -INT8_C( 42),  INT8_C( 65), -INT8_C( 88), -INT8_C( 57), -INT8_C( 99),
+        -INT8_C( 61),  INT8_C( 20),  INT8_C( 71),  INT8_C(  0),  INT8_C(  4),  INT8_C( 32), -INT8_C( 75), -INT8_C( 93),
+        -INT8_C( 21),  INT8_C( 44), -INT8_C( 35),  INT8_C( 11), -INT8_C( 19), -INT8_C( 87),  INT8_C(110),  INT8_C(114) } },
+    { { {  INT8_C(102), -INT8_C( 32), -INT8_C( 84), -INT8_C(116),  INT8_C(114), -INT8_C(112), -INT8_C( 60), -INT8_C( 37),
+          -INT8_C(107), -INT8_C(105),  INT8_C(119),  INT8_C(  8),  INT8_C(126), -INT8_C(125), -INT8_C( 75),  INT8_C( 72) },
+        {  INT8_C( 75),  INT8_C( 40), -INT8_C( 99), -INT8_C( 72),  INT8_C( 91), -INT8_C(104),  INT8_C( 93),  INT8_C( 20),
+           INT8_C( 51), -INT8_C( 14),  INT8_C( 22),  INT8_C( 97), -INT8_C( 93),  INT8_C( 16),  INT8_C( 10), -INT8_C( 39) },
+        {  INT8_C(113), -INT8_C(  1),  INT8_C(  9), -INT8_C( 76),  INT8_C(125), -INT8_C( 92),  INT8_C( 69),  INT8_C(108),
+          -INT8_C( 10),  INT8_C( 30), -INT8_C( 66), -INT8_C(  6),  INT8_C(115),  INT8_C( 98),     INT8_MIN,  INT8_C( 29) },
+        {  INT8_C(  5),  INT8_C( 89), -INT8_C( 71), -INT8_C( 26),  INT8_C( 61),  INT8_C( 26), -INT8_C( 14),  INT8_C( 11),
+           INT8_C(101), -INT8_C( 28),  INT8_C( 33), -INT8_C( 60), -INT8_C( 57),  INT8_C(105),  INT8_C( 71), -INT8_C(117) } },
+      {  INT8_C(102), -INT8_C( 32), -INT8_C( 84), -INT8_C(116),  INT8_C(114), -INT8_C(112), -INT8_C( 60), -INT8_C( 37),
+        -INT8_C(107), -INT8_C(105),  INT8_C(119),  INT8_C(  8),  INT8_C(126), -INT8_C(125), -INT8_C( 75),  INT8_C( 72),
+         INT8_C( 75),  INT8_C( 40), -INT8_C( 99), -INT8_C( 72),  INT8_C( 91), -INT8_C(104),  INT8_C( 93),  INT8_C( 20),
+         INT8_C( 51), -INT8_C( 14),  INT8_C( 22),  INT8_C( 97), -INT8_C( 93),  INT8_C( 16),  INT8_C( 10), -INT8_C( 39),
+         INT8_C(113), -INT8_C(  1),  INT8_C(  9), -INT8_C( 76),  INT8_C(125), -INT8_C( 92),  INT8_C( 69),  INT8_C(108),
+        -INT8_C( 10),  INT8_C( 30), -INT8_C( 66), -INT8_C(  6),  INT8_C(115),  INT8_C( 98),     INT8_MIN,  INT8_C( 29),
+         INT8_C(  5),  INT8_C( 89), -INT8_C( 71), -INT8_C( 26),  INT8_C( 61),  INT8_C( 26), -INT8_C( 14),  INT8_C( 11),
+         INT8_C(101), -INT8_C( 28),  INT8_C( 33), -INT8_C( 60), -INT8_C( 57),  INT8_C(105),  INT8_C( 71), -INT8_C(117) } },
+    { { {  INT8_C(110),  INT8_C( 34), -INT8_C( 92),  INT8_C(113), -INT8_C( 95),  INT8_C( 43),  INT8_C(  5), -INT8_C( 58),
+          -INT8_C( 52), -INT8_C( 21),  INT8_C(113), -INT8_C(117),  INT8_C( 17), -INT8_C( 55),  INT8_C( 44), -INT8_C( 52) },
+        { -INT8_C(105),  INT8_C( 18),  INT8_C(  2), -INT8_C(  9),  INT8_C( 62), -INT8_C( 54), -INT8_C( 70), -INT8_C(126),
+          -INT8_C( 59), -INT8_C(108),  INT8_C(112),  INT8_C( 25),  INT8_C( 79),  INT8_C( 12),  INT8_C( 32),  INT8_C( 62) },
+        { -INT8_C( 26),  INT8_C( 63),  INT8_C( 27), -INT8_C( 11),  INT8_C( 40), -INT8_C( 33),  INT8_C( 77),  INT8_C(108),
+          -INT8_C( 69),  INT8_C( 12),  INT8_C( 17),  INT8_C( 67), -INT8_C( 80), -INT8_C(115), -INT8_C( 81), -INT8_C( 25) },
+        { -INT8_C( 86), -INT8_C( 59),  INT8_C(105),  INT8_C( 97), -INT8_C( 28), -INT8_C( 81), -INT8_C( 85),  INT8_C( 15),
+          -INT8_C(110),  INT8_C(116), -INT8_C(110), -INT8_C(114),  INT8_C( 26), -INT8_C( 70), -INT8_C( 85), -INT8_C( 60) } },
+      {  INT8_C(110),  INT8_C( 34), -INT8_C( 92),  INT8_C(113), -INT8_C( 95),  INT8_C( 43),  INT8_C(  5), -INT8_C( 58),
+        -INT8_C( 52), -INT8_C( 21),  INT8_C(113), -INT8_C(117),  INT8_C( 17), -INT8_C( 55),  INT8_C( 44), -INT8_C( 52),
+        -INT8_C(105),  INT8_C( 18),  INT8_C(  2), -INT8_C(  9),  INT8_C( 62), -INT8_C( 54), -INT8_C( 70), -INT8_C(126),
+        -INT8_C( 59), -INT8_C(108),  INT8_C(112),  INT8_C( 25),  INT8_C( 79),  INT8_C( 12),  INT8_C( 32),  INT8_C( 62),
+        -INT8_C( 26),  INT8_C( 63),  INT8_C( 27), -INT8_C( 11),  INT8_C( 40), -INT8_C( 33),  INT8_C( 77),  INT8_C(108),
+        -INT8_C( 69),  INT8_C( 12),  INT8_C( 17),  INT8_C( 67), -INT8_C( 80), -INT8_C(115), -INT8_C( 81), -INT8_C( 25),
+        -INT8_C( 86), -INT8_C( 59),  INT8_C(105),  INT8_C( 97), -INT8_C( 28), -INT8_C( 81), -INT8_C( 85),  INT8_C( 15),
+        -INT8_C(110),  INT8_C(116), -INT8_C(110), -INT8_C(114),  INT8_C( 26), -INT8_C( 70), -INT8_C( 85), -INT8_C( 60) } },
+    { { { -INT8_C( 12), -INT8_C(104),  INT8_C( 50),  INT8_C( 74),  INT8_C( 91),  INT8_C( 42), -INT8_C( 72), -INT8_C(113),
+           INT8_C( 58),  INT8_C( 92),  INT8_C( 34),  INT8_C( 33), -INT8_C(  3),  INT8_C( 55), -INT8_C( 46),  INT8_C(108) },
+        {  INT8_C( 46), -INT8_C( 19),  INT8_C( 59), -INT8_C( 28), -INT8_C(103), -INT8_C( 24), -INT8_C( 31), -INT8_C( 49),
+           INT8_C( 22), -INT8_C( 40),     INT8_MIN, -INT8_C( 89), -INT8_C(124),  INT8_C( 78), -INT8_C( 87),  INT8_C( 96) },
+        { -INT8_C( 12), -INT8_C( 18), -INT8_C(100),  INT8_C( 49), -INT8_C( 13),  INT8_C( 48), -INT8_C(  2),  INT8_C( 70),
+          -INT8_C( 27), -INT8_C( 36),  INT8_C( 58), -INT8_C(  3),  INT8_C( 57),  INT8_C( 52), -INT8_C( 69), -INT8_C( 77) },
+        { -INT8_C(  3),  INT8_C(121), -INT8_C( 61),  INT8_C( 98), -INT8_C(103), -INT8_C( 18),  INT8_C( 82),  INT8_C(120),
+          -INT8_C( 12), -INT8_C( 71),  INT8_C(102),  INT8_C(  0),  INT8_C(  7),  INT8_C( 53), -INT8_C(102), -INT8_C( 46) } },
+      { -INT8_C( 12), -INT8_C(104),  INT8_C( 50),  INT8_C( 74),  INT8_C( 91),  INT8_C( 42), -INT8_C( 72), -INT8_C(113),
+         INT8_C( 58),  INT8_C( 92),  INT8_C( 34),  INT8_C( 33), -INT8_C(  3),  INT8_C( 55), -INT8_C( 46),  INT8_C(108),
+         INT8_C( 46), -INT8_C( 19),  INT8_C( 59), -INT8_C( 28), -INT8_C(103), -INT8_C( 24), -INT8_C( 31), -INT8_C( 49),
+         INT8_C( 22), -INT8_C( 40),     INT8_MIN, -INT8_C( 89), -INT8_C(124),  INT8_C( 78), -INT8_C( 87),  INT8_C( 96),
+        -INT8_C( 12), -INT8_C( 18), -INT8_C(100),  INT8_C( 49), -INT8_C( 13),  INT8_C( 48), -INT8_C(  2),  INT8_C( 70),
+        -INT8_C( 27), -INT8_C( 36),  INT8_C( 58), -INT8_C(  3),  INT8_C( 57),  INT8_C( 52), -INT8_C( 69), -INT8_C( 77),
+        -INT8_C(  3),  INT8_C(121), -INT8_C( 61),  INT8_C( 98), -INT8_C(103), -INT8_C( 18),  INT8_C( 82),  INT8_C(120),
+        -INT8_C( 12), -INT8_C( 71),  INT8_C(102),  INT8_C(  0),  INT8_C(  7),  INT8_C( 53), -INT8_C(102), -INT8_C( 46) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x4_t val = { {
+      simde_vld1q_s8(test_vec[i].val[0]),
+      simde_vld1q_s8(test_vec[i].val[1]),
+      simde_vld1q_s8(test_vec[i].val[2]),
+      simde_vld1q_s8(test_vec[i].val[3]) } };
+    int8_t r[64];
+
+    simde_vst1q_s8_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t val[4][8];
+    int16_t r[32];
+  } test_vec[] = {
+    { { { -INT16_C(24361),  INT16_C(11257),  INT16_C( 1884),  INT16_C(20039),  INT16_C(26248), -INT16_C( 7114),  INT16_C(16994),  INT16_C(29434) },
+        { -INT16_C(18145), -INT16_C(29945), -INT16_C(13330),  INT16_C(15436),  INT16_C(28824), -INT16_C(28053),  INT16_C(32148), -INT16_C( 7692) },
+        {  INT16_C(  237),  INT16_C( 2528), -INT16_C( 6126), -INT16_C(25195), -INT16_C( 7235),  INT16_C(17811), -INT16_C(21100),  INT16_C(31082) },
+        {  INT16_C(24578), -INT16_C( 1408), -INT16_C(26383),  INT16_C(23396), -INT16_C(25245), -INT16_C(16323), -INT16_C( 4644),  INT16_C( 1438) } },
+      { -INT16_C(24361),  INT16_C(11257),  INT16_C( 1884),  INT16_C(20039),  INT16_C(26248), -INT16_C( 7114),  INT16_C(16994),  INT16_C(29434),
+        -INT16_C(18145), -INT16_C(29945), -INT16_C(13330),  INT16_C(15436),  INT16_C(28824), -INT16_C(28053),  INT16_C(32148), -INT16_C( 7692),
+         INT16_C(  237),  INT16_C( 2528), -INT16_C( 6126), -INT16_C(25195), -INT16_C( 7235),  INT16_C(17811), -INT16_C(21100),  INT16_C(31082),
+         INT16_C(24578), -INT16_C( 1408), -INT16_C(26383),  INT16_C(23396), -INT16_C(25245), -INT16_C(16323), -INT16_C( 4644),  INT16_C( 1438) } },
+    { { {  INT16_C(21694), -INT16_C(12229), -INT16_C(17351), -INT16_C(14917),  INT16_C(26371),  INT16_C(10943), -INT16_C(30647), -INT16_C( 4212) },
+        { -INT16_C( 7489),  INT16_C(13813),  INT16_C( 2728), -INT16_C(12995),  INT16_C(14885), -INT16_C(13223), -INT16_C(15390), -INT16_C(27966) },
+        { -INT16_C(25842),  INT16_C(29594), -INT16_C( 9353), -INT16_C(20304),  INT16_C(14086),  INT16_C(23109),  INT16_C(20990), -INT16_C( 9578) },
+        {  INT16_C(28339),  INT16_C(17363), -INT16_C(29096), -INT16_C(15461), -INT16_C( 4851), -INT16_C( 9456),  INT16_C(10179),  INT16_C( 1995) } },
+      {  INT16_C(21694), -INT16_C(12229), -INT16_C(17351), -INT16_C(14917),  INT16_C(26371),  INT16_C(10943), -INT16_C(30647), -INT16_C( 4212),
+        -INT16_C( 7489),  INT16_C(13813),  INT16_C( 2728), -INT16_C(12995),  INT16_C(14885), -INT16_C(13223), -INT16_C(15390), -INT16_C(27966),
+        -INT16_C(25842),  INT16_C(29594), -INT16_C( 9353), -INT16_C(20304),  INT16_C(14086),  INT16_C(23109),  INT16_C(20990), -INT16_C( 9578),
+         INT16_C(28339),  INT16_C(17363), -INT16_C(29096), -INT16_C(15461), -INT16_C( 4851), -INT16_C( 9456),  INT16_C(10179),  INT16_C( 1995) } },
+    { { {  INT16_C( 9571),  INT16_C(31573), -INT16_C( 4434),  INT16_C(29898), -INT16_C( 2284), -INT16_C(26734), -INT16_C(19252), -INT16_C(19831) },
+        { -INT16_C( 4683),  INT16_C( 1561), -INT16_C(30140),  INT16_C(14327), -INT16_C(11736), -INT16_C( 8819), -INT16_C(21454),  INT16_C( 6770) },
+        { -INT16_C( 7805), -INT16_C(10010),  INT16_C(19064),  INT16_C(14245),  INT16_C(31402), -INT16_C(27851), -INT16_C( 4647), -INT16_C(27986) },
+        { -INT16_C( 5803), -INT16_C( 2139),  INT16_C(12421), -INT16_C(27539),  INT16_C(23416), -INT16_C(10345), -INT16_C( 5386),  INT16_C(13472) } },
+      {  INT16_C( 9571),  INT16_C(31573), -INT16_C( 4434),  INT16_C(29898), -INT16_C( 2284), -INT16_C(26734), -INT16_C(19252), -INT16_C(19831),
+        -INT16_C( 4683),  INT16_C( 1561), -INT16_C(30140),  INT16_C(14327), -INT16_C(11736), -INT16_C( 8819), -INT16_C(21454),  INT16_C( 6770),
+        -INT16_C( 7805), -INT16_C(10010),  INT16_C(19064),  INT16_C(14245),  INT16_C(31402), -INT16_C(27851), -INT16_C( 4647), -INT16_C(27986),
+        -INT16_C( 5803), -INT16_C( 2139),  INT16_C(12421), -INT16_C(27539),  INT16_C(23416), -INT16_C(10345), -INT16_C( 5386),  INT16_C(13472) } },
+    { { { -INT16_C( 5189),  INT16_C(30247), -INT16_C(22895), -INT16_C(18763), -INT16_C(26426),  INT16_C( 2845), -INT16_C(23202),  INT16_C(21894) },
+        { -INT16_C(21674),  INT16_C(  753), -INT16_C(24922), -INT16_C( 6407),  INT16_C( 5173), -INT16_C(14667),  INT16_C(28831),  INT16_C(11795) },
+        { -INT16_C(13640), -INT16_C(24613), -INT16_C(22128),  INT16_C( 7106),  INT16_C( 8907), -INT16_C(22336), -INT16_C( 8957), -INT16_C( 7046) },
+        { -INT16_C( 9123), -INT16_C(31514), -INT16_C( 6849), -INT16_C(32005), -INT16_C( 7260),  INT16_C(10171),  INT16_C( 7701),  INT16_C(28301) } },
+      { -INT16_C( 5189),  INT16_C(30247), -INT16_C(22895), -INT16_C(18763), -INT16_C(26426),  INT16_C( 2845), -INT16_C(23202),  INT16_C(21894),
+        -INT16_C(21674),  INT16_C(  753), -INT16_C(24922), -INT16_C( 6407),  INT16_C( 5173), -INT16_C(14667),  INT16_C(28831),  INT16_C(11795),
+        -INT16_C(13640), -INT16_C(24613), -INT16_C(22128),  INT16_C( 7106),  INT16_C( 8907), -INT16_C(22336), -INT16_C( 8957), -INT16_C( 7046),
+        -INT16_C( 9123), -INT16_C(31514), -INT16_C( 6849), -INT16_C(32005), -INT16_C( 7260),  INT16_C(10171),  INT16_C( 7701),  INT16_C(28301) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x4_t val = { {
+      simde_vld1q_s16(test_vec[i].val[0]),
+      simde_vld1q_s16(test_vec[i].val[1]),
+      simde_vld1q_s16(test_vec[i].val[2]),
+      simde_vld1q_s16(test_vec[i].val[3]) } };
+    int16_t r[32];
+
+    simde_vst1q_s16_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t val[4][4];
+    int32_t r[16];
+  } test_vec[] = {
+    { { { -INT32_C( 353114348), -INT32_C(2104559620),  INT32_C(  18062739),  INT32_C(1193031152) },
+        {  INT32_C(1590240638), -INT32_C( 663932891),  INT32_C( 564264398),  INT32_C(1340660547) },
+        {  INT32_C( 684444879),  INT32_C(1374791883),  INT32_C(1820107806), -INT32_C(1299023068) },
+        { -INT32_C(1103094497), -INT32_C( 335735090),  INT32_C(1645647477), -INT32_C(1976778844) } },
+      { -INT32_C( 353114348), -INT32_C(2104559620),  INT32_C(  18062739),  INT32_C(1193031152),  INT32_C(1590240638), -INT32_C( 663932891),  INT32_C( 564264398),  INT32_C(1340660547),
+         INT32_C( 684444879),  INT32_C(1374791883),  INT32_C(1820107806), -INT32_C(1299023068), -INT32_C(1103094497), -INT32_C( 335735090),  INT32_C(1645647477), -INT32_C(1976778844) } },
+    { { {  INT32_C( 794111822),  INT32_C(1014336929),  INT32_C(2034977741), -INT32_C( 635247599) },
+        { -INT32_C(  47930380),  INT32_C( 785435507),  INT32_C(2130592891),  INT32_C(1380926993) },
+        {  INT32_C(1827636616), -INT32_C(1703909175), -INT32_C(1078795716),  INT32_C(1659206650) },
+        { -INT32_C( 682759179), -INT32_C(1168438020),  INT32_C(1781399717), -INT32_C(1212808941) } },
+      {  INT32_C( 794111822),  INT32_C(1014336929),  INT32_C(2034977741), -INT32_C( 635247599), -INT32_C(  47930380),  INT32_C( 785435507),  INT32_C(2130592891),  INT32_C(1380926993),
+         INT32_C(1827636616), -INT32_C(1703909175), -INT32_C(1078795716),  INT32_C(1659206650), -INT32_C( 682759179), -INT32_C(1168438020),  INT32_C(1781399717), -INT32_C(1212808941) } },
+    { { { -INT32_C( 725132756),  INT32_C( 486688731), -INT32_C(1708034207),  INT32_C(1207812489) },
+        {  INT32_C(1874302657), -INT32_C( 769238423), -INT32_C(1898687304), -INT32_C( 338747756) },
+        {  INT32_C(1037817640), -INT32_C( 159826427), -INT32_C( 600468816), -INT32_C( 519841094) },
+        {  INT32_C( 903295727),  INT32_C( 261291796),  INT32_C(1133163543), -INT32_C(2019268135) } },
+      { -INT32_C( 725132756),  INT32_C( 486688731), -INT32_C(1708034207),  INT32_C(1207812489),  INT32_C(1874302657), -INT32_C( 769238423), -INT32_C(1898687304), -INT32_C( 338747756),
+         INT32_C(1037817640), -INT32_C( 159826427), -INT32_C( 600468816), -INT32_C( 519841094),  INT32_C( 903295727),  INT32_C( 261291796),  INT32_C(1133163543), -INT32_C(2019268135) } },
+    { { { -INT32_C( 394337878), -INT32_C( 720873571), -INT32_C( 438948856), -INT32_C(1244319410) },
+        { -INT32_C(1454162953),  INT32_C(1134332612),  INT32_C(1857636976), -INT32_C( 576366119) },
+        { -INT32_C( 462398077),  INT32_C(1324629462), -INT32_C(1475491759),  INT32_C( 159488502) },
+        { -INT32_C(1482533806),  INT32_C(1067596682),  INT32_C( 793688723), -INT32_C(1022640781) } },
+      { -INT32_C( 394337878), -INT32_C( 720873571), -INT32_C( 438948856), -INT32_C(1244319410), -INT32_C(1454162953),  INT32_C(1134332612),  INT32_C(1857636976), -INT32_C( 576366119),
+        -INT32_C( 462398077),  INT32_C(1324629462), -INT32_C(1475491759),  INT32_C( 159488502), -INT32_C(1482533806),  INT32_C(1067596682),  INT32_C( 793688723), -INT32_C(1022640781) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x4_t val = { {
+      simde_vld1q_s32(test_vec[i].val[0]),
+      simde_vld1q_s32(test_vec[i].val[1]),
+      simde_vld1q_s32(test_vec[i].val[2]),
+      simde_vld1q_s32(test_vec[i].val[3]) } };
+    int32_t r[16];
+
+    simde_vst1q_s32_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_s64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t val[4][2];
+    int64_t r[8];
+  } test_vec[] = {
+    { { { -INT64_C(2008227207282039786),  INT64_C(2920846280672012578) },
+        { -INT64_C(1226829131271016927),  INT64_C(5839332384729499697) },
+        {  INT64_C(3214657035555345862),  INT64_C( 803562366045175847) },
+        {  INT64_C(7620627679417043099), -INT64_C(2519224128537518081) } },
+      { -INT64_C(2008227207282039786),  INT64_C(2920846280672012578), -INT64_C(1226829131271016927),  INT64_C(5839332384729499697),
+         INT64_C(3214657035555345862),  INT64_C( 803562366045175847),  INT64_C(7620627679417043099), -INT64_C(2519224128537518081) } },
+    { { {  INT64_C(1607493955636443648),  INT64_C(7647893615327404266) },
+        {  INT64_C(7577183015666417749), -INT64_C(5405816020740080574) },
+        { -INT64_C(2543573065142070771),  INT64_C(3168649868519904403) },
+        { -INT64_C(3462292829454663417), -INT64_C(6230160932002967234) } },
+      {  INT64_C(1607493955636443648),  INT64_C(7647893615327404266),  INT64_C(7577183015666417749), -INT64_C(5405816020740080574),
+        -INT64_C(2543573065142070771),  INT64_C(3168649868519904403), -INT64_C(3462292829454663417), -INT64_C(6230160932002967234) } },
+    { { { -INT64_C(5537517245481765867), -INT64_C(2364759554230110076) },
+        { -INT64_C(3825682285942283226), -INT64_C(7247393595314374342) },
+        {  INT64_C(7127634666611658719), -INT64_C(5213595010318123737) },
+        { -INT64_C(4060993755220892112),  INT64_C(6330924017143420448) } },
+      { -INT64_C(5537517245481765867), -INT64_C(2364759554230110076), -INT64_C(3825682285942283226), -INT64_C(7247393595314374342),
+         INT64_C(7127634666611658719), -INT64_C(5213595010318123737), -INT64_C(4060993755220892112),  INT64_C(6330924017143420448) } },
+    { { {  INT64_C(1179873927878116972), -INT64_C(6675887162571424249) },
+        { -INT64_C(3551431269561740407),  INT64_C(1197216547521702687) },
+        {  INT64_C(1426928193542713136),  INT64_C(  20570392072151198) },
+        { -INT64_C(7156682246599197219),  INT64_C(4364949992332927260) } },
+      {  INT64_C(1179873927878116972), -INT64_C(6675887162571424249), -INT64_C(3551431269561740407),  INT64_C(1197216547521702687),
+         INT64_C(1426928193542713136),  INT64_C(  20570392072151198), -INT64_C(7156682246599197219),  INT64_C(4364949992332927260) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x4_t val = { {
+      simde_vld1q_s64(test_vec[i].val[0]),
+      simde_vld1q_s64(test_vec[i].val[1]),
+      simde_vld1q_s64(test_vec[i].val[2]),
+      simde_vld1q_s64(test_vec[i].val[3]) } };
+    int64_t r[8];
+
+    simde_vst1q_s64_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u8_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t val[4][16];
+    uint8_t r[64];
+  } test_vec[] = {
+    { { { UINT8_C(  3), UINT8_C(146), UINT8_C(155), UINT8_C(185), UINT8_C(105), UINT8_C(243), UINT8_C( 12), UINT8_C( 52),
+          UINT8_C(187), UINT8_C( 84), UINT8_C( 49), UINT8_C(107), UINT8_C(121), UINT8_C(214), UINT8_C( 90), UINT8_C(136) },
+        { UINT8_C(118), UINT8_C( 22), UINT8_C( 93), UINT8_C( 28), UINT8_C( 53), UINT8_C(221), UINT8_C(172), UINT8_C(188),
+          UINT8_C( 40), UINT8_C(235), UINT8_C(211), UINT8_C(180), UINT8_C(205), UINT8_C(  5), UINT8_C(185), UINT8_C( 88) },
+        { UINT8_C(165), UINT8_C( 29), UINT8_C( 71), UINT8_C(111), UINT8_C(225), UINT8_C(106), UINT8_C(226), UINT8_C(174),
+          UINT8_C(111), UINT8_C( 57), UINT8_C( 59), UINT8_C( 26), UINT8_C(236), UINT8_C(184), UINT8_C(251), UINT8_C(175) },
+        { UINT8_C( 54), UINT8_C( 23), UINT8_C(109), UINT8_C(171), UINT8_C(249), UINT8_C(111), UINT8_C(227), UINT8_C(234),
+          UINT8_C( 28), UINT8_C(169), UINT8_C(  8), UINT8_C( 49), UINT8_C(205), UINT8_C( 52), UINT8_C(141), UINT8_C(115) } },
+      { UINT8_C(  3), UINT8_C(146), UINT8_C(155), UINT8_C(185), UINT8_C(105), UINT8_C(243), UINT8_C( 12), UINT8_C( 52),
+        UINT8_C(187), UINT8_C( 84), UINT8_C( 49), UINT8_C(107), UINT8_C(121), UINT8_C(214), UINT8_C( 90), UINT8_C(136),
+        UINT8_C(118), UINT8_C( 22), UINT8_C( 93), UINT8_C( 28), UINT8_C( 53), UINT8_C(221), UINT8_C(172), UINT8_C(188),
+        UINT8_C( 40), UINT8_C(235), UINT8_C(211), UINT8_C(180), UINT8_C(205), UINT8_C(  5), UINT8_C(185), UINT8_C( 88),
+        UINT8_C(165), UINT8_C( 29), UINT8_C( 71), UINT8_C(111), UINT8_C(225), UINT8_C(106), UINT8_C(226), UINT8_C(174),
+        UINT8_C(111), UINT8_C( 57), UINT8_C( 59), UINT8_C( 26), UINT8_C(236), UINT8_C(184), UINT8_C(251), UINT8_C(175),
+        UINT8_C( 54), UINT8_C( 23), UINT8_C(109), UINT8_C(171), UINT8_C(249), UINT8_C(111), UINT8_C(227), UINT8_C(234),
+        UINT8_C( 28), UINT8_C(169), UINT8_C(  8), UINT8_C( 49), UINT8_C(205), UINT8_C( 52), UINT8_C(141), UINT8_C(115) } },
+    { { { UINT8_C(146), UINT8_C(  9), UINT8_C(250), UINT8_C( 29), UINT8_C(155), UINT8_C( 15), UINT8_C(250), UINT8_C( 92),
+          UINT8_C(203), UINT8_C( 66), UINT8_C(170), UINT8_C(126), UINT8_C(214), UINT8_C(136),    UINT8_MAX, UINT8_C(145) },
+        { UINT8_C(101), UINT8_C(182), UINT8_C(125), UINT8_C( 18), UINT8_C(142), UINT8_C( 43), UINT8_C(191), UINT8_C( 81),
+          UINT8_C( 64), UINT8_C( 63), UINT8_C( 85), UINT8_C( 95), UINT8_C(198), UINT8_C(178), UINT8_C(108), UINT8_C(177) },
+        { UINT8_C( 56), UINT8_C(114), UINT8_C(120), UINT8_C(163), UINT8_C(158), UINT8_C( 54), UINT8_C( 89), UINT8_C( 25),
+          UINT8_C(238), UINT8_C( 53), UINT8_C(113), UINT8_C(124), UINT8_C(189), UINT8_C(220), UINT8_C( 22), UINT8_C(136) },
+        { UINT8_C(212), UINT8_C( 52), UINT8_C(219), UINT8_C(  2), UINT8_C(208), UINT8_C( 89), UINT8_C( 34), UINT8_C(119),
+          UINT8_C( 87), UINT8_C(171), UINT8_C(193), UINT8_C( 10), UINT8_C( 51),    UINT8_MAX, UINT8_C(102), UINT8_C( 85) } },
+      { UINT8_C(146), UINT8_C(  9), UINT8_C(250), UINT8_C( 29), UINT8_C(155), UINT8_C( 15), UINT8_C(250), UINT8_C( 92),
+        UINT8_C(203), UINT8_C( 66), UINT8_C(170), UINT8_C(126), UINT8_C(214), UINT8_C(136),    UINT8_MAX, UINT8_C(145),
+        UINT8_C(101), UINT8_C(182), UINT8_C(125), UINT8_C( 18), UINT8_C(142), UINT8_C( 43), UINT8_C(191), UINT8_C( 81),
+        UINT8_C( 64), UINT8_C( 63), UINT8_C( 85), UINT8_C( 95), UINT8_C(198), UINT8_C(178), UINT8_C(108), UINT8_C(177),
+        UINT8_C( 56), UINT8_C(114), UINT8_C(120), UINT8_C(163), UINT8_C(158), UINT8_C( 54), UINT8_C( 89), UINT8_C( 25),
+        UINT8_C(238), UINT8_C( 53), UINT8_C(113), UINT8_C(124), UINT8_C(189), UINT8_C(220), UINT8_C( 22), UINT8_C(136),
+        UINT8_C(212), UINT8_C( 52), UINT8_C(219), UINT8_C(  2), UINT8_C(208), UINT8_C( 89), UINT8_C( 34), UINT8_C(119),
+        UINT8_C( 87), UINT8_C(171), UINT8_C(193), UINT8_C( 10), UINT8_C( 51),    UINT8_MAX, UINT8_C(102), UINT8_C( 85) } },
+    { { { UINT8_C( 41), UINT8_C(125), UINT8_C( 26), UINT8_C(136), UINT8_C(223), UINT8_C(121), UINT8_C( 52), UINT8_C(105),
+          UINT8_C( 85), UINT8_C(131), UINT8_C( 15), UINT8_C(223), UINT8_C(172), UINT8_C(215), UINT8_C( 29), UINT8_C( 67) },
+        { UINT8_C( 71), UINT8_C(149), UINT8_C( 88), UINT8_C( 86), UINT8_C(126), UINT8_C( 97), UINT8_C( 82), UINT8_C(212),
+          UINT8_C(176), UINT8_C( 69), UINT8_C(  1), UINT8_C(169), UINT8_C(238), UINT8_C(235), UINT8_C(172), UINT8_C(  1) },
+        { UINT8_C( 86), UINT8_C( 53), UINT8_C(  5), UINT8_C(231), UINT8_C(198), UINT8_C(215), UINT8_C(219), UINT8_C(151),
+          UINT8_C(  7), UINT8_C( 71), UINT8_C(243), UINT8_C(121), UINT8_C(144), UINT8_C(187), UINT8_C(109), UINT8_C(160) },
+        { UINT8_C( 85), UINT8_C(  3), UINT8_C(201), UINT8_C(203), UINT8_C(122), UINT8_C(131), UINT8_C( 96), UINT8_C(126),
+          UINT8_C(164), UINT8_C(228), UINT8_C(  6), UINT8_C(244), UINT8_C(249), UINT8_C(211), UINT8_C( 76), UINT8_C(156) } },
+      { UINT8_C( 41), UINT8_C(125), UINT8_C( 26), UINT8_C(136), UINT8_C(223), UINT8_C(121), UINT8_C( 52), UINT8_C(105),
+        UINT8_C( 85), UINT8_C(131), UINT8_C( 15), UINT8_C(223), UINT8_C(172), UINT8_C(215), UINT8_C( 29), UINT8_C( 67),
+        UINT8_C( 71), UINT8_C(149), UINT8_C( 88), UINT8_C( 86), UINT8_C(126), UINT8_C( 97), UINT8_C( 82), UINT8_C(212),
+        UINT8_C(176), UINT8_C( 69), UINT8_C(  1), UINT8_C(169), UINT8_C(238), UINT8_C(235), UINT8_C(172), UINT8_C(  1),
+        UINT8_C( 86), UINT8_C( 53), UINT8_C(  5), UINT8_C(231), UINT8_C(198), UINT8_C(215), UINT8_C(219), UINT8_C(151),
+        UINT8_C(  7), UINT8_C( 71), UINT8_C(243), UINT8_C(121), UINT8_C(144), UINT8_C(187), UINT8_C(109), UINT8_C(160),
+        UINT8_C( 85), UINT8_C(  3), UINT8_C(201), UINT8_C(203), UINT8_C(122), UINT8_C(131), UINT8_C( 96), UINT8_C(126),
+        UINT8_C(164), UINT8_C(228), UINT8_C(  6), UINT8_C(244), UINT8_C(249), UINT8_C(211), UINT8_C( 76), UINT8_C(156) } },
+    { { { UINT8_C( 51), UINT8_C( 48), UINT8_C(232), UINT8_C(161), UINT8_C(100), UINT8_C(246), UINT8_C(240), UINT8_C( 86),
+          UINT8_C(  4), UINT8_C(181), UINT8_C( 53), UINT8_C( 14), UINT8_C(169), UINT8_C( 67), UINT8_C( 19), UINT8_C( 75) },
+        { UINT8_C(197), UINT8_C( 38), UINT8_C(164), UINT8_C(131), UINT8_C( 52), UINT8_C(116), UINT8_C(135), UINT8_C(225),
+          UINT8_C(147), UINT8_C( 39), UINT8_C(184), UINT8_C(245), UINT8_C(174), UINT8_C(  1), UINT8_C(156), UINT8_C( 62) },
+        { UINT8_C( 15), UINT8_C(158), UINT8_C(140), UINT8_C(230), UINT8_C( 76), UINT8_C(134), UINT8_C(110), UINT8_C(247),
+          UINT8_C(194), UINT8_C( 45), UINT8_C( 99), UINT8_C( 69), UINT8_C( 46), UINT8_C(146), UINT8_C(  4), UINT8_C(205) },
+        { UINT8_C( 39), UINT8_C( 82), UINT8_C(201), UINT8_C(224), UINT8_C(137), UINT8_C( 87), UINT8_C(  0), UINT8_C(192),
+          UINT8_C(132), UINT8_C( 16), UINT8_C(107), UINT8_C(  1), UINT8_C( 40), UINT8_C(118), UINT8_C( 88), UINT8_C( 91) } },
+      { UINT8_C( 51), UINT8_C( 48), UINT8_C(232), UINT8_C(161), UINT8_C(100), UINT8_C(246), UINT8_C(240), UINT8_C( 86),
+        UINT8_C(  4), UINT8_C(181), UINT8_C( 53), UINT8_C( 14), UINT8_C(169), UINT8_C( 67), UINT8_C( 19), UINT8_C( 75),
+        UINT8_C(197), UINT8_C( 38), UINT8_C(164), UINT8_C(131), UINT8_C( 52), UINT8_C(116), UINT8_C(135), UINT8_C(225),
+        UINT8_C(147), UINT8_C( 39), UINT8_C(184), UINT8_C(245), UINT8_C(174), UINT8_C(  1), UINT8_C(156), UINT8_C( 62),
+        UINT8_C( 15), UINT8_C(158), UINT8_C(140), UINT8_C(230), UINT8_C( 76), UINT8_C(134), UINT8_C(110), UINT8_C(247),
+        UINT8_C(194), UINT8_C( 45), UINT8_C( 99), UINT8_C( 69), UINT8_C( 46), UINT8_C(146), UINT8_C(  4), UINT8_C(205),
+        UINT8_C( 39), UINT8_C( 82), UINT8_C(201), UINT8_C(224), UINT8_C(137), UINT8_C( 87), UINT8_C(  0), UINT8_C(192),
+        UINT8_C(132), UINT8_C( 16), UINT8_C(107), UINT8_C(  1), UINT8_C( 40), UINT8_C(118), UINT8_C( 88), UINT8_C( 91) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x4_t val = { {
+      simde_vld1q_u8(test_vec[i].val[0]),
+      simde_vld1q_u8(test_vec[i].val[1]),
+      simde_vld1q_u8(test_vec[i].val[2]),
+      simde_vld1q_u8(test_vec[i].val[3]) } };
+    uint8_t r[64];
+
+    simde_vst1q_u8_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u16_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t val[4][8];
+    uint16_t r[32];
+  } test_vec[] = {
+    { { { UINT16_C(27646), UINT16_C(38334), UINT16_C(32525), UINT16_C(54615), UINT16_C(45229), UINT16_C(42262), UINT16_C(36488), UINT16_C(46594) },
+        { UINT16_C(54518), UINT16_C(32483), UINT16_C(32815), UINT16_C( 1215), UINT16_C(20778), UINT16_C(35638), UINT16_C( 7333), UINT16_C(27986) },
+        { UINT16_C(49856), UINT16_C(45496), UINT16_C(59454), UINT16_C(42239), UINT16_C(64879), UINT16_C(37105), UINT16_C(47283), UINT16_C(39203) },
+        { UINT16_C( 7612), UINT16_C(56415), UINT16_C(11629), UINT16_C(59216), UINT16_C(30935), UINT16_C( 2237), UINT16_C(58705), UINT16_C(44323) } },
+      { UINT16_C(27646), UINT16_C(38334), UINT16_C(32525), UINT16_C(54615), UINT16_C(45229), UINT16_C(42262), UINT16_C(36488), UINT16_C(46594),
+        UINT16_C(54518), UINT16_C(32483), UINT16_C(32815), UINT16_C( 1215), UINT16_C(20778), UINT16_C(35638), UINT16_C( 7333), UINT16_C(27986),
+        UINT16_C(49856), UINT16_C(45496), UINT16_C(59454), UINT16_C(42239), UINT16_C(64879), UINT16_C(37105), UINT16_C(47283), UINT16_C(39203),
+        UINT16_C( 7612), UINT16_C(56415), UINT16_C(11629), UINT16_C(59216), UINT16_C(30935), UINT16_C( 2237), UINT16_C(58705), UINT16_C(44323) } },
+    { { { UINT16_C(21092), UINT16_C(35874), UINT16_C(56397), UINT16_C( 3093), UINT16_C(49534), UINT16_C(  187), UINT16_C(50510), UINT16_C( 6612) },
+        { UINT16_C(17395), UINT16_C(10245), UINT16_C(36609), UINT16_C(22930), UINT16_C( 1861), UINT16_C(58947), UINT16_C( 1275), UINT16_C(30238) },
+        { UINT16_C(16424), UINT16_C(21277), UINT16_C(14470), UINT16_C(36259), UINT16_C(31787), UINT16_C(16333), UINT16_C(28898), UINT16_C(37796) },
+        { UINT16_C(46120), UINT16_C(60272), UINT16_C(31284), UINT16_C(45006), UINT16_C(41671), UINT16_C( 6413), UINT16_C(48989), UINT16_C(13171) } },
+      { UINT16_C(21092), UINT16_C(35874), UINT16_C(56397), UINT16_C( 3093), UINT16_C(49534), UINT16_C(  187), UINT16_C(50510), UINT16_C( 6612),
+        UINT16_C(17395), UINT16_C(10245), UINT16_C(36609), UINT16_C(22930), UINT16_C( 1861), UINT16_C(58947), UINT16_C( 1275), UINT16_C(30238),
+        UINT16_C(16424), UINT16_C(21277), UINT16_C(14470), UINT16_C(36259), UINT16_C(31787), UINT16_C(16333), UINT16_C(28898), UINT16_C(37796),
+        UINT16_C(46120), UINT16_C(60272), UINT16_C(31284), UINT16_C(45006), UINT16_C(41671), UINT16_C( 6413), UINT16_C(48989), UINT16_C(13171) } },
+    { { { UINT16_C(46572), UINT16_C(32533), UINT16_C(45324), UINT16_C(36237), UINT16_C(22286), UINT16_C( 7391), UINT16_C(48116), UINT16_C(25885) },
+        { UINT16_C(62626), UINT16_C(65077), UINT16_C(48597), UINT16_C( 6166), UINT16_C(26727), UINT16_C(64051), UINT16_C(35600), UINT16_C(63642) },
+        { UINT16_C(17818), UINT16_C(57054), UINT16_C(23591), UINT16_C(19237), UINT16_C(35570), UINT16_C(50141), UINT16_C(51714), UINT16_C(20992) },
+        { UINT16_C(59053), UINT16_C( 3809), UINT16_C( 5281), UINT16_C(16210), UINT16_C(13304), UINT16_C(28610), UINT16_C(44477), UINT16_C(51330) } },
+      { UINT16_C(46572), UINT16_C(32533), UINT16_C(45324), UINT16_C(36237), UINT16_C(22286), UINT16_C( 7391), UINT16_C(48116), UINT16_C(25885),
+        UINT16_C(62626), UINT16_C(65077), UINT16_C(48597), UINT16_C( 6166), UINT16_C(26727), UINT16_C(64051), UINT16_C(35600), UINT16_C(63642),
+        UINT16_C(17818), UINT16_C(57054), UINT16_C(23591), UINT16_C(19237), UINT16_C(35570), UINT16_C(50141), UINT16_C(51714), UINT16_C(20992),
+        UINT16_C(59053), UINT16_C( 3809), UINT16_C( 5281), UINT16_C(16210), UINT16_C(13304), UINT16_C(28610), UINT16_C(44477), UINT16_C(51330) } },
+    { { { UINT16_C(14397), UINT16_C(41703), UINT16_C(64555), UINT16_C(56600), UINT16_C( 6971), UINT16_C(42053), UINT16_C(63096), UINT16_C(10063) },
+        { UINT16_C(26371), UINT16_C(44344), UINT16_C(43278), UINT16_C( 3498), UINT16_C(17913), UINT16_C(41487), UINT16_C(45884), UINT16_C( 3767) },
+        { UINT16_C(39763), UINT16_C(30234), UINT16_C(55288), UINT16_C(25757), UINT16_C(36450), UINT16_C(10015), UINT16_C(61959), UINT16_C(49570) },
+        { UINT16_C(22048), UINT16_C(35650), UINT16_C( 3328), UINT16_C(18827), UINT16_C(11944), UINT16_C(11522), UINT16_C(48459), UINT16_C(12512) } },
+      { UINT16_C(14397), UINT16_C(41703), UINT16_C(64555), UINT16_C(56600), UINT16_C( 6971), UINT16_C(42053), UINT16_C(63096), UINT16_C(10063),
+        UINT16_C(26371), UINT16_C(44344), UINT16_C(43278), UINT16_C( 3498), UINT16_C(17913), UINT16_C(41487), UINT16_C(45884), UINT16_C( 3767),
+        UINT16_C(39763), UINT16_C(30234), UINT16_C(55288), UINT16_C(25757), UINT16_C(36450), UINT16_C(10015), UINT16_C(61959), UINT16_C(49570),
+        UINT16_C(22048), UINT16_C(35650), UINT16_C( 3328), UINT16_C(18827), UINT16_C(11944), UINT16_C(11522), UINT16_C(48459), UINT16_C(12512) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x4_t val = { {
+      simde_vld1q_u16(test_vec[i].val[0]),
+      simde_vld1q_u16(test_vec[i].val[1]),
+      simde_vld1q_u16(test_vec[i].val[2]),
+      simde_vld1q_u16(test_vec[i].val[3]) } };
+    uint16_t r[32];
+
+    simde_vst1q_u16_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u32_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t val[4][4];
+    uint32_t r[16];
+  } test_vec[] = {
+    { { { UINT32_C(4211572332), UINT32_C(2273358339), UINT32_C(2905698457), UINT32_C( 397079932) },
+        { UINT32_C( 572787493), UINT32_C( 860719634), UINT32_C(3656186973), UINT32_C(  86584014) },
+        { UINT32_C(1028314820), UINT32_C( 893241057), UINT32_C( 748972250), UINT32_C( 735794914) },
+        { UINT32_C(3870869389), UINT32_C(2945365554), UINT32_C( 917507031), UINT32_C( 519825219) } },
+      { UINT32_C(4211572332), UINT32_C(2273358339), UINT32_C(2905698457), UINT32_C( 397079932), UINT32_C( 572787493), UINT32_C( 860719634), UINT32_C(3656186973), UINT32_C(  86584014),
+        UINT32_C(1028314820), UINT32_C( 893241057), UINT32_C( 748972250), UINT32_C( 735794914), UINT32_C(3870869389), UINT32_C(2945365554), UINT32_C( 917507031), UINT32_C( 519825219) } },
+    { { { UINT32_C(2808092982), UINT32_C(2170399709), UINT32_C( 808814888), UINT32_C(1667258503) },
+        { UINT32_C( 863118380), UINT32_C(2509989321), UINT32_C(3363342092), UINT32_C(1501485934) },
+        { UINT32_C(2535588915), UINT32_C( 577453283), UINT32_C(2164546996), UINT32_C(2303990495) },
+        { UINT32_C( 288505440), UINT32_C(3565782049), UINT32_C( 313692326), UINT32_C(3543070466) } },
+      { UINT32_C(2808092982), UINT32_C(2170399709), UINT32_C( 808814888), UINT32_C(1667258503), UINT32_C( 863118380), UINT32_C(2509989321), UINT32_C(3363342092), UINT32_C(1501485934),
+        UINT32_C(2535588915), UINT32_C( 577453283), UINT32_C(2164546996), UINT32_C(2303990495), UINT32_C( 288505440), UINT32_C(3565782049), UINT32_C( 313692326), UINT32_C(3543070466) } },
+    { { { UINT32_C(1538583035), UINT32_C(1423123464), UINT32_C(3306240736), UINT32_C( 949511310) },
+        { UINT32_C(4080238904), UINT32_C( 599360015), UINT32_C( 138699644), UINT32_C(1871209140) },
+        { UINT32_C(3941052220), UINT32_C(2139495596), UINT32_C(2869631839), UINT32_C( 432057371) },
+        { UINT32_C(1013843152), UINT32_C(1631892288), UINT32_C(2342899220), UINT32_C( 762520238) } },
+      { UINT32_C(1538583035), UINT32_C(1423123464), UINT32_C(3306240736), UINT32_C( 949511310), UINT32_C(4080238904), UINT32_C( 599360015), UINT32_C( 138699644), UINT32_C(1871209140),
+        UINT32_C(3941052220), UINT32_C(2139495596), UINT32_C(2869631839), UINT32_C( 432057371), UINT32_C(1013843152), UINT32_C(1631892288), UINT32_C(2342899220), UINT32_C( 762520238) } },
+    { { { UINT32_C(1703793279), UINT32_C(3937702971), UINT32_C( 226631807), UINT32_C( 794467495) },
+        { UINT32_C(3125848960), UINT32_C(4225940066), UINT32_C(1305038016), UINT32_C( 169656075) },
+        { UINT32_C(3117766220), UINT32_C(1578948254), UINT32_C(1524887935), UINT32_C(1564708401) },
+        { UINT32_C(2366280025), UINT32_C(1053117015), UINT32_C(2294654648), UINT32_C(2435448929) } },
+      { UINT32_C(1703793279), UINT32_C(3937702971), UINT32_C( 226631807), UINT32_C( 794467495), UINT32_C(3125848960), UINT32_C(4225940066), UINT32_C(1305038016), UINT32_C( 169656075),
+        UINT32_C(3117766220), UINT32_C(1578948254), UINT32_C(1524887935), UINT32_C(1564708401), UINT32_C(2366280025), UINT32_C(1053117015), UINT32_C(2294654648), UINT32_C(2435448929) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x4_t val = { {
+      simde_vld1q_u32(test_vec[i].val[0]),
+      simde_vld1q_u32(test_vec[i].val[1]),
+      simde_vld1q_u32(test_vec[i].val[2]),
+      simde_vld1q_u32(test_vec[i].val[3]) } };
+    uint32_t r[16];
+
+    simde_vst1q_u32_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst1q_u64_x4 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t val[4][2];
+    uint64_t r[8];
+  } test_vec[] = {
+    { { { UINT64_C( 3551115287533431317), UINT64_C( 2247633063398275818) },
+        { UINT64_C(12462723341109499444), UINT64_C(10345807727862201054) },
+        { UINT64_C(  927570210249217572), UINT64_C(12884866184157922937) },
+        { UINT64_C( 8222283350473897302), UINT64_C(15017750298380885222) } },
+      { UINT64_C( 3551115287533431317), UINT64_C( 2247633063398275818), UINT64_C(12462723341109499444), UINT64_C(10345807727862201054),
+        UINT64_C(  927570210249217572), UINT64_C(12884866184157922937), UINT64_C( 8222283350473897302), UINT64_C(15017750298380885222) } },
+    { { { UINT64_C(16616395192092977578), UINT64_C( 5453893154984830999) },
+        { UINT64_C(18194497479553118410), UINT64_C( 9085849886831339009) },
+        { UINT64_C( 8371284970829012521), UINT64_C( 5336417837536852321) },
+        { UINT64_C(15141197310252816973), UINT64_C(12844483873129165117) } },
+      { UINT64_C(16616395192092977578), UINT64_C( 5453893154984830999), UINT64_C(18194497479553118410), UINT64_C( 9085849886831339009),
+        UINT64_C( 8371284970829012521), UINT64_C( 5336417837536852321), UINT64_C(15141197310252816973), UINT64_C(12844483873129165117) } },
+    { { { UINT64_C(11975223872959099243), UINT64_C( 8781479998594588066) },
+        { UINT64_C( 8266604388039747716), UINT64_C(11608456271008278639) },
+        { UINT64_C(15785807294116936007), UINT64_C(10958371337950904979) },
+        { UINT64_C( 8202410594949430564), UINT64_C(15707990065157657289) } },
+      { UINT64_C(11975223872959099243), UINT64_C( 8781479998594588066), UINT64_C( 8266604388039747716), UINT64_C(11608456271008278639),
+        UINT64_C(15785807294116936007), UINT64_C(10958371337950904979), UINT64_C( 8202410594949430564), UINT64_C(15707990065157657289) } },
+    { { { UINT64_C(10037938451826426886), UINT64_C(10227104649005373863) },
+        { UINT64_C(11886556422236333290), UINT64_C( 5676734304808269905) },
+        { UINT64_C( 2266014506690081830), UINT64_C(15122545205953724379) },
+        { UINT64_C( 1892072986692892351), UINT64_C(11791019648479213523) } },
+      { UINT64_C(10037938451826426886), UINT64_C(10227104649005373863), UINT64_C(11886556422236333290), UINT64_C( 5676734304808269905),
+        UINT64_C( 2266014506690081830), UINT64_C(15122545205953724379), UINT64_C( 1892072986692892351), UINT64_C(11791019648479213523) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x4_t val = { {
+      simde_vld1q_u64(test_vec[i].val[0]),
+      simde_vld1q_u64(test_vec[i].val[1]),
+      simde_vld1q_u64(test_vec[i].val[2]),
+      simde_vld1q_u64(test_vec[i].val[3]) } };
+    uint64_t r[8];
+
+    simde_vst1q_u64_x4(r, val);
+
+    simde_assert_equal_i(0, simde_memcmp(r, test_vec[i].r, sizeof(r)));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_f32_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_f64_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s8_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s16_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s32_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_s64_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u8_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u16_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u32_x4)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vst1q_u64_x4)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -3,6 +3,92 @@
 #include "test-neon.h"
 #include "../../../simde/arm/neon/sub.h"
 
+static int
+test_simde_vsubh_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a;
+    simde_float16 b;
+    simde_float16 r;
+  } test_vec[] = {
+    { SIMDE_FLOAT16_VALUE(  -866.00),
+      SIMDE_FLOAT16_VALUE(  -173.50),
+      SIMDE_FLOAT16_VALUE(  -692.50) },
+    { SIMDE_FLOAT16_VALUE(  -779.00),
+      SIMDE_FLOAT16_VALUE(   504.25),
+      SIMDE_FLOAT16_VALUE( -1283.00) },
+    { SIMDE_FLOAT16_VALUE(    22.56),
+      SIMDE_FLOAT16_VALUE(  -900.50),
+      SIMDE_FLOAT16_VALUE(   923.00) },
+    { SIMDE_FLOAT16_VALUE(  -910.50),
+      SIMDE_FLOAT16_VALUE(   471.75),
+      SIMDE_FLOAT16_VALUE( -1382.00) },
+    { SIMDE_FLOAT16_VALUE(  -691.50),
+      SIMDE_FLOAT16_VALUE(   467.50),
+      SIMDE_FLOAT16_VALUE( -1159.00) },
+    { SIMDE_FLOAT16_VALUE(   261.00),
+      SIMDE_FLOAT16_VALUE(     8.56),
+      SIMDE_FLOAT16_VALUE(   252.50) },
+    { SIMDE_FLOAT16_VALUE(   711.50),
+      SIMDE_FLOAT16_VALUE(   205.12),
+      SIMDE_FLOAT16_VALUE(   506.50) },
+    { SIMDE_FLOAT16_VALUE(   146.75),
+      SIMDE_FLOAT16_VALUE(  -199.88),
+      SIMDE_FLOAT16_VALUE(   346.50) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16 r = simde_vsubh_f16(test_vec[i].a, test_vec[i].b);
+
+    simde_assert_equal_f16(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsub_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[4];
+    simde_float16 b[4];
+    simde_float16 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -502.50), SIMDE_FLOAT16_VALUE(  -724.00), SIMDE_FLOAT16_VALUE(  -153.50), SIMDE_FLOAT16_VALUE(  -247.88) },
+      { SIMDE_FLOAT16_VALUE(   545.00), SIMDE_FLOAT16_VALUE(  -463.25), SIMDE_FLOAT16_VALUE(  -202.88), SIMDE_FLOAT16_VALUE(   892.00) },
+      { SIMDE_FLOAT16_VALUE( -1048.00), SIMDE_FLOAT16_VALUE(  -260.75), SIMDE_FLOAT16_VALUE(    49.38), SIMDE_FLOAT16_VALUE( -1140.00) } },
+    { { SIMDE_FLOAT16_VALUE(   240.62), SIMDE_FLOAT16_VALUE(   322.50), SIMDE_FLOAT16_VALUE(   375.75), SIMDE_FLOAT16_VALUE(   820.00) },
+      { SIMDE_FLOAT16_VALUE(  -587.50), SIMDE_FLOAT16_VALUE(   540.50), SIMDE_FLOAT16_VALUE(  -869.00), SIMDE_FLOAT16_VALUE(  -490.00) },
+      { SIMDE_FLOAT16_VALUE(   828.00), SIMDE_FLOAT16_VALUE(  -218.00), SIMDE_FLOAT16_VALUE(  1245.00), SIMDE_FLOAT16_VALUE(  1310.00) } },
+    { { SIMDE_FLOAT16_VALUE(   191.50), SIMDE_FLOAT16_VALUE(  -363.00), SIMDE_FLOAT16_VALUE(   -24.89), SIMDE_FLOAT16_VALUE(  -555.50) },
+      { SIMDE_FLOAT16_VALUE(  -489.75), SIMDE_FLOAT16_VALUE(  -125.69), SIMDE_FLOAT16_VALUE(   224.12), SIMDE_FLOAT16_VALUE(   386.00) },
+      { SIMDE_FLOAT16_VALUE(   681.00), SIMDE_FLOAT16_VALUE(  -237.25), SIMDE_FLOAT16_VALUE(  -249.00), SIMDE_FLOAT16_VALUE(  -941.50) } },
+    { { SIMDE_FLOAT16_VALUE(    -0.23), SIMDE_FLOAT16_VALUE(  -241.88), SIMDE_FLOAT16_VALUE(   932.00), SIMDE_FLOAT16_VALUE(   553.50) },
+      { SIMDE_FLOAT16_VALUE(    96.00), SIMDE_FLOAT16_VALUE(    84.56), SIMDE_FLOAT16_VALUE(  -702.50), SIMDE_FLOAT16_VALUE(  -601.50) },
+      { SIMDE_FLOAT16_VALUE(   -96.25), SIMDE_FLOAT16_VALUE(  -326.50), SIMDE_FLOAT16_VALUE(  1634.00), SIMDE_FLOAT16_VALUE(  1155.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -830.50), SIMDE_FLOAT16_VALUE(   884.00), SIMDE_FLOAT16_VALUE(   657.00), SIMDE_FLOAT16_VALUE(  -874.00) },
+      { SIMDE_FLOAT16_VALUE(   386.00), SIMDE_FLOAT16_VALUE(  -251.50), SIMDE_FLOAT16_VALUE(   328.00), SIMDE_FLOAT16_VALUE(  -125.69) },
+      { SIMDE_FLOAT16_VALUE( -1216.00), SIMDE_FLOAT16_VALUE(  1136.00), SIMDE_FLOAT16_VALUE(   329.00), SIMDE_FLOAT16_VALUE(  -748.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -344.25), SIMDE_FLOAT16_VALUE(  -852.00), SIMDE_FLOAT16_VALUE(  -614.00), SIMDE_FLOAT16_VALUE(  -147.12) },
+      { SIMDE_FLOAT16_VALUE(   434.25), SIMDE_FLOAT16_VALUE(  -683.00), SIMDE_FLOAT16_VALUE(  -120.50), SIMDE_FLOAT16_VALUE(   933.00) },
+      { SIMDE_FLOAT16_VALUE(  -778.50), SIMDE_FLOAT16_VALUE(  -169.00), SIMDE_FLOAT16_VALUE(  -493.50), SIMDE_FLOAT16_VALUE( -1080.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -794.50), SIMDE_FLOAT16_VALUE(  -185.50), SIMDE_FLOAT16_VALUE(   710.00), SIMDE_FLOAT16_VALUE(   302.00) },
+      { SIMDE_FLOAT16_VALUE(   899.50), SIMDE_FLOAT16_VALUE(   208.25), SIMDE_FLOAT16_VALUE(   293.75), SIMDE_FLOAT16_VALUE(  -537.00) },
+      { SIMDE_FLOAT16_VALUE( -1694.00), SIMDE_FLOAT16_VALUE(  -393.75), SIMDE_FLOAT16_VALUE(   416.25), SIMDE_FLOAT16_VALUE(   839.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -185.88), SIMDE_FLOAT16_VALUE(    49.59), SIMDE_FLOAT16_VALUE(   742.50), SIMDE_FLOAT16_VALUE(   337.25) },
+      { SIMDE_FLOAT16_VALUE(  -256.00), SIMDE_FLOAT16_VALUE(   761.00), SIMDE_FLOAT16_VALUE(   228.12), SIMDE_FLOAT16_VALUE(   447.25) },
+      { SIMDE_FLOAT16_VALUE(    70.12), SIMDE_FLOAT16_VALUE(  -711.50), SIMDE_FLOAT16_VALUE(   514.50), SIMDE_FLOAT16_VALUE(  -110.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x4_t a = simde_vld1_f16(test_vec[i].a);
+    simde_float16x4_t b = simde_vld1_f16(test_vec[i].b);
+    simde_float16x4_t r = simde_vsub_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x4(r, simde_vld1_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vsub_f32 (SIMDE_MUNIT_TEST_ARGS) {
   struct {
@@ -440,6 +526,74 @@ test_simde_vsub_u64 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_vsubq_f16 (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[8];
+    simde_float16 b[8];
+    simde_float16 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(  -651.50), SIMDE_FLOAT16_VALUE(  -474.50), SIMDE_FLOAT16_VALUE(   193.50), SIMDE_FLOAT16_VALUE(  -142.62),
+          SIMDE_FLOAT16_VALUE(  -488.00), SIMDE_FLOAT16_VALUE(   838.50), SIMDE_FLOAT16_VALUE(   922.00), SIMDE_FLOAT16_VALUE(   352.75) },
+      { SIMDE_FLOAT16_VALUE(   950.00), SIMDE_FLOAT16_VALUE(   443.25), SIMDE_FLOAT16_VALUE(   -88.44), SIMDE_FLOAT16_VALUE(  -755.50),
+          SIMDE_FLOAT16_VALUE(   131.50), SIMDE_FLOAT16_VALUE(   814.00), SIMDE_FLOAT16_VALUE(   142.75), SIMDE_FLOAT16_VALUE(   479.75) },
+      { SIMDE_FLOAT16_VALUE( -1602.00), SIMDE_FLOAT16_VALUE(  -918.00), SIMDE_FLOAT16_VALUE(   282.00), SIMDE_FLOAT16_VALUE(   613.00),
+          SIMDE_FLOAT16_VALUE(  -619.50), SIMDE_FLOAT16_VALUE(    24.50), SIMDE_FLOAT16_VALUE(   779.00), SIMDE_FLOAT16_VALUE(  -127.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -246.25), SIMDE_FLOAT16_VALUE(  -946.50), SIMDE_FLOAT16_VALUE(    22.86), SIMDE_FLOAT16_VALUE(  -312.50),
+          SIMDE_FLOAT16_VALUE(   131.75), SIMDE_FLOAT16_VALUE(   946.00), SIMDE_FLOAT16_VALUE(   899.50), SIMDE_FLOAT16_VALUE(   829.00) },
+      { SIMDE_FLOAT16_VALUE(   297.50), SIMDE_FLOAT16_VALUE(    53.91), SIMDE_FLOAT16_VALUE(    77.62), SIMDE_FLOAT16_VALUE(   837.00),
+          SIMDE_FLOAT16_VALUE(  -983.00), SIMDE_FLOAT16_VALUE(  -933.00), SIMDE_FLOAT16_VALUE(  -844.50), SIMDE_FLOAT16_VALUE(   -99.25) },
+      { SIMDE_FLOAT16_VALUE(  -544.00), SIMDE_FLOAT16_VALUE( -1000.50), SIMDE_FLOAT16_VALUE(   -54.75), SIMDE_FLOAT16_VALUE( -1150.00),
+          SIMDE_FLOAT16_VALUE(  1115.00), SIMDE_FLOAT16_VALUE(  1879.00), SIMDE_FLOAT16_VALUE(  1744.00), SIMDE_FLOAT16_VALUE(   928.00) } },
+    { { SIMDE_FLOAT16_VALUE(   975.00), SIMDE_FLOAT16_VALUE(   802.50), SIMDE_FLOAT16_VALUE(   119.19), SIMDE_FLOAT16_VALUE(   904.50),
+          SIMDE_FLOAT16_VALUE(   446.50), SIMDE_FLOAT16_VALUE(   633.50), SIMDE_FLOAT16_VALUE(  -483.00), SIMDE_FLOAT16_VALUE(  -766.50) },
+      { SIMDE_FLOAT16_VALUE(  -561.50), SIMDE_FLOAT16_VALUE(   711.50), SIMDE_FLOAT16_VALUE(   763.00), SIMDE_FLOAT16_VALUE(   184.50),
+          SIMDE_FLOAT16_VALUE(  -694.00), SIMDE_FLOAT16_VALUE(  -199.12), SIMDE_FLOAT16_VALUE(  -459.50), SIMDE_FLOAT16_VALUE(   165.38) },
+      { SIMDE_FLOAT16_VALUE(  1536.00), SIMDE_FLOAT16_VALUE(    91.00), SIMDE_FLOAT16_VALUE(  -644.00), SIMDE_FLOAT16_VALUE(   720.00),
+          SIMDE_FLOAT16_VALUE(  1140.00), SIMDE_FLOAT16_VALUE(   832.50), SIMDE_FLOAT16_VALUE(   -23.50), SIMDE_FLOAT16_VALUE(  -932.00) } },
+    { { SIMDE_FLOAT16_VALUE(   523.50), SIMDE_FLOAT16_VALUE(   717.00), SIMDE_FLOAT16_VALUE(   209.38), SIMDE_FLOAT16_VALUE(  -375.75),
+          SIMDE_FLOAT16_VALUE(  -286.75), SIMDE_FLOAT16_VALUE(  -571.50), SIMDE_FLOAT16_VALUE(  -769.50), SIMDE_FLOAT16_VALUE(  -919.00) },
+      { SIMDE_FLOAT16_VALUE(  -752.00), SIMDE_FLOAT16_VALUE(   834.00), SIMDE_FLOAT16_VALUE(    14.77), SIMDE_FLOAT16_VALUE(   932.00),
+          SIMDE_FLOAT16_VALUE(    19.78), SIMDE_FLOAT16_VALUE(  -445.00), SIMDE_FLOAT16_VALUE(  -445.50), SIMDE_FLOAT16_VALUE(   -61.19) },
+      { SIMDE_FLOAT16_VALUE(  1276.00), SIMDE_FLOAT16_VALUE(  -117.00), SIMDE_FLOAT16_VALUE(   194.62), SIMDE_FLOAT16_VALUE( -1308.00),
+          SIMDE_FLOAT16_VALUE(  -306.50), SIMDE_FLOAT16_VALUE(  -126.50), SIMDE_FLOAT16_VALUE(  -324.00), SIMDE_FLOAT16_VALUE(  -858.00) } },
+    { { SIMDE_FLOAT16_VALUE(   281.75), SIMDE_FLOAT16_VALUE(  -411.75), SIMDE_FLOAT16_VALUE(   445.50), SIMDE_FLOAT16_VALUE(  -974.50),
+          SIMDE_FLOAT16_VALUE(   344.25), SIMDE_FLOAT16_VALUE(  -599.00), SIMDE_FLOAT16_VALUE(  -748.50), SIMDE_FLOAT16_VALUE(   649.50) },
+      { SIMDE_FLOAT16_VALUE(   510.75), SIMDE_FLOAT16_VALUE(  -543.50), SIMDE_FLOAT16_VALUE(  -928.00), SIMDE_FLOAT16_VALUE(   453.50),
+          SIMDE_FLOAT16_VALUE(   831.50), SIMDE_FLOAT16_VALUE(  -807.00), SIMDE_FLOAT16_VALUE(   906.00), SIMDE_FLOAT16_VALUE(   541.00) },
+      { SIMDE_FLOAT16_VALUE(  -229.00), SIMDE_FLOAT16_VALUE(   131.75), SIMDE_FLOAT16_VALUE(  1374.00), SIMDE_FLOAT16_VALUE( -1428.00),
+          SIMDE_FLOAT16_VALUE(  -487.25), SIMDE_FLOAT16_VALUE(   208.00), SIMDE_FLOAT16_VALUE( -1654.00), SIMDE_FLOAT16_VALUE(   108.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -529.50), SIMDE_FLOAT16_VALUE(  -902.50), SIMDE_FLOAT16_VALUE(   399.25), SIMDE_FLOAT16_VALUE(  -286.00),
+          SIMDE_FLOAT16_VALUE(  -449.75), SIMDE_FLOAT16_VALUE(   949.50), SIMDE_FLOAT16_VALUE(  -737.00), SIMDE_FLOAT16_VALUE(  -325.25) },
+      { SIMDE_FLOAT16_VALUE(   116.31), SIMDE_FLOAT16_VALUE(   875.50), SIMDE_FLOAT16_VALUE(  -874.00), SIMDE_FLOAT16_VALUE(  -862.50),
+          SIMDE_FLOAT16_VALUE(  -831.00), SIMDE_FLOAT16_VALUE(  -510.50), SIMDE_FLOAT16_VALUE(  -335.50), SIMDE_FLOAT16_VALUE(   -65.50) },
+      { SIMDE_FLOAT16_VALUE(  -646.00), SIMDE_FLOAT16_VALUE( -1778.00), SIMDE_FLOAT16_VALUE(  1273.00), SIMDE_FLOAT16_VALUE(   576.50),
+          SIMDE_FLOAT16_VALUE(   381.25), SIMDE_FLOAT16_VALUE(  1460.00), SIMDE_FLOAT16_VALUE(  -401.50), SIMDE_FLOAT16_VALUE(  -259.75) } },
+    { { SIMDE_FLOAT16_VALUE(  -281.75), SIMDE_FLOAT16_VALUE(  -605.00), SIMDE_FLOAT16_VALUE(   110.12), SIMDE_FLOAT16_VALUE(  -642.50),
+          SIMDE_FLOAT16_VALUE(  -414.25), SIMDE_FLOAT16_VALUE(  -825.00), SIMDE_FLOAT16_VALUE(  -872.50), SIMDE_FLOAT16_VALUE(   -89.56) },
+      { SIMDE_FLOAT16_VALUE(  -161.25), SIMDE_FLOAT16_VALUE(   284.75), SIMDE_FLOAT16_VALUE(   831.00), SIMDE_FLOAT16_VALUE(   491.50),
+          SIMDE_FLOAT16_VALUE(  -730.50), SIMDE_FLOAT16_VALUE(   435.50), SIMDE_FLOAT16_VALUE(   252.50), SIMDE_FLOAT16_VALUE(   545.50) },
+      { SIMDE_FLOAT16_VALUE(  -120.50), SIMDE_FLOAT16_VALUE(  -890.00), SIMDE_FLOAT16_VALUE(  -721.00), SIMDE_FLOAT16_VALUE( -1134.00),
+          SIMDE_FLOAT16_VALUE(   316.25), SIMDE_FLOAT16_VALUE( -1260.00), SIMDE_FLOAT16_VALUE( -1125.00), SIMDE_FLOAT16_VALUE(  -635.00) } },
+    { { SIMDE_FLOAT16_VALUE(  -977.00), SIMDE_FLOAT16_VALUE(  -434.00), SIMDE_FLOAT16_VALUE(   847.50), SIMDE_FLOAT16_VALUE(   803.50),
+          SIMDE_FLOAT16_VALUE(  -752.00), SIMDE_FLOAT16_VALUE(  -628.50), SIMDE_FLOAT16_VALUE(  -656.00), SIMDE_FLOAT16_VALUE(  -337.50) },
+      { SIMDE_FLOAT16_VALUE(   856.00), SIMDE_FLOAT16_VALUE(  -250.88), SIMDE_FLOAT16_VALUE(   -30.03), SIMDE_FLOAT16_VALUE(   817.00),
+          SIMDE_FLOAT16_VALUE(   573.00), SIMDE_FLOAT16_VALUE(  -542.00), SIMDE_FLOAT16_VALUE(   273.75), SIMDE_FLOAT16_VALUE(  -397.75) },
+      { SIMDE_FLOAT16_VALUE( -1833.00), SIMDE_FLOAT16_VALUE(  -183.12), SIMDE_FLOAT16_VALUE(   877.50), SIMDE_FLOAT16_VALUE(   -13.50),
+          SIMDE_FLOAT16_VALUE( -1325.00), SIMDE_FLOAT16_VALUE(   -86.50), SIMDE_FLOAT16_VALUE(  -930.00), SIMDE_FLOAT16_VALUE(    60.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float16x8_t a = simde_vld1q_f16(test_vec[i].a);
+    simde_float16x8_t b = simde_vld1q_f16(test_vec[i].b);
+    simde_float16x8_t r = simde_vsubq_f16(a, b);
+
+    simde_test_arm_neon_assert_equal_f16x8(r, simde_vld1q_f16(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_vsubq_f32 (SIMDE_MUNIT_TEST_ARGS) {
   struct {
@@ -924,6 +1078,8 @@ test_simde_vsubq_u64 (SIMDE_MUNIT_TEST_ARGS) {
 }
 
 SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vsubh_f16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsub_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsub_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsub_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsub_s8)
@@ -935,6 +1091,7 @@ SIMDE_TEST_FUNC_LIST_ENTRY(vsub_u16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsub_u32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsub_u64)
 
+SIMDE_TEST_FUNC_LIST_ENTRY(vsubq_f16)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsubq_f32)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsubq_f64)
 SIMDE_TEST_FUNC_LIST_ENTRY(vsubq_s8)
@@ -0,0 +1,306 @@
+#define SIMDE_TEST_ARM_NEON_INSN sudot_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sudot_lane.h"
+#include "../../../simde/arm/neon/dup_n.h"
+
+static int
+test_simde_vsudot_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[2];
+    int8_t a[8];
+    uint8_t b[8];
+    const int lane;
+    int32_t r[2];
+  } test_vec[] = {
+    { { -INT32_C(   119860595), -INT32_C(   522929640) },
+      { -INT8_C( 101),  INT8_C(  88),  INT8_C( 116), -INT8_C( 112),  INT8_C(  49),  INT8_C(  73), -INT8_C(  39),  INT8_C( 106) },
+      { UINT8_C( 61), UINT8_C(235), UINT8_C(161), UINT8_C(  4), UINT8_C(  6), UINT8_C(107), UINT8_C(194), UINT8_C( 51) },
+       INT32_C(           0),
+      { -INT32_C(   119827848), -INT32_C(   522915351) } },
+    { {  INT32_C(   323996013),  INT32_C(   479328325) },
+      {  INT8_C(   4), -INT8_C(  33),  INT8_C(   6), -INT8_C(   7),  INT8_C(   9),  INT8_C( 113),  INT8_C(  47),  INT8_C(  59) },
+      { UINT8_C( 94), UINT8_C(255), UINT8_C(217), UINT8_C(107), UINT8_C(214), UINT8_C(190), UINT8_C(186), UINT8_C(205) },
+       INT32_C(           1),
+      {  INT32_C(   323990280),  INT32_C(   479372558) } },
+    { {  INT32_C(   127257885),  INT32_C(   862124471) },
+      { -INT8_C(  36), -INT8_C(  61), -INT8_C(  11), -INT8_C(  77),  INT8_C(  10), -INT8_C(   8),  INT8_C(  93),  INT8_C(  67) },
+      { UINT8_C(100), UINT8_C( 74), UINT8_C( 76), UINT8_C(242), UINT8_C(  4), UINT8_C( 90), UINT8_C(215), UINT8_C(255) },
+       INT32_C(           0),
+      {  INT32_C(   127230301),  INT32_C(   862148161) } },
+    { { -INT32_C(   496190358),  INT32_C(   282296365) },
+      {  INT8_C( 121),  INT8_C(  25),  INT8_C(   0), -INT8_C( 104),  INT8_C(  75), -INT8_C(  78), -INT8_C(  45), -INT8_C(  98) },
+      { UINT8_C(110), UINT8_C(130), UINT8_C(243), UINT8_C( 49), UINT8_C(230), UINT8_C(171), UINT8_C(133), UINT8_C(184) },
+       INT32_C(           1),
+      { -INT32_C(   496177389),  INT32_C(   282276260) } },
+    { {  INT32_C(   473763167),  INT32_C(    33134922) },
+      {  INT8_C(  48), -INT8_C( 118),  INT8_C(  82), -INT8_C(  66),  INT8_C(  51), -INT8_C(  27), -INT8_C(  39),  INT8_C(  17) },
+      { UINT8_C(181), UINT8_C(166), UINT8_C(249), UINT8_C(228), UINT8_C( 40), UINT8_C(195), UINT8_C(146), UINT8_C(237) },
+       INT32_C(           0),
+      {  INT32_C(   473757637),  INT32_C(    33133836) } },
+    { { -INT32_C(   451622962), -INT32_C(   354010378) },
+      {  INT8_C(  44),  INT8_C(  87),  INT8_C(  79), -INT8_C(  92), -INT8_C(  88), -INT8_C(  46),  INT8_C(  47), -INT8_C(  12) },
+      { UINT8_C(160), UINT8_C(162), UINT8_C(149), UINT8_C(136), UINT8_C(202), UINT8_C(138), UINT8_C(227), UINT8_C(185) },
+       INT32_C(           1),
+      { -INT32_C(   451601155), -INT32_C(   354026053) } },
+    { {  INT32_C(   860233223),  INT32_C(   704327654) },
+      { -INT8_C(  43), -INT8_C(  34), -INT8_C( 117), -INT8_C(  64), -INT8_C(   8),  INT8_C(   0), -INT8_C(  88), -INT8_C(  21) },
+      { UINT8_C( 85), UINT8_C(203), UINT8_C( 52), UINT8_C( 48), UINT8_C( 32), UINT8_C(242), UINT8_C( 27), UINT8_C( 13) },
+       INT32_C(           0),
+      {  INT32_C(   860213510),  INT32_C(   704321390) } },
+    { {  INT32_C(   631413960), -INT32_C(   716180611) },
+      { -INT8_C(  75),  INT8_C(   6), -INT8_C(  49), -INT8_C(  85),  INT8_C(  71),  INT8_C(  30), -INT8_C(  11), -INT8_C(   2) },
+      { UINT8_C(145), UINT8_C(226), UINT8_C( 64), UINT8_C( 67), UINT8_C( 87), UINT8_C( 14), UINT8_C( 17), UINT8_C(182) },
+       INT32_C(           1),
+      {  INT32_C(   631391216), -INT32_C(   716174565) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t r_ = simde_vld1_s32(test_vec[i].r_);
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_uint8x8_t b = simde_vld1_u8(test_vec[i].b);
+    simde_int32x2_t r;
+
+    SIMDE_CONSTIFY_2_(simde_vsudot_lane_s32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsudot_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[2];
+    int8_t a[8];
+    uint8_t b[16];
+    const int lane;
+    int32_t r[2];
+  } test_vec[] = {
+    { {  INT32_C(   322987184),  INT32_C(   971327207) },
+      {  INT8_C( 111),  INT8_C(  11),  INT8_C(  99), -INT8_C(  59), -INT8_C(  38),  INT8_C( 105),  INT8_C(  94),  INT8_C(  30) },
+      { UINT8_C(177), UINT8_C(246), UINT8_C(116), UINT8_C( 45), UINT8_C(226), UINT8_C(157), UINT8_C(187), UINT8_C(211),
+        UINT8_C(133), UINT8_C( 79), UINT8_C(155), UINT8_C(  5), UINT8_C(  0), UINT8_C( 69), UINT8_C(176), UINT8_C(146) },
+       INT32_C(           0),
+      {  INT32_C(   323018366),  INT32_C(   971358565) } },
+    { {  INT32_C(   941448044), -INT32_C(  1038020123) },
+      {  INT8_C( 123),  INT8_C( 116),  INT8_C(  25), -INT8_C( 124),  INT8_C(  92),  INT8_C(  21), -INT8_C(  10), -INT8_C( 125) },
+      { UINT8_C(191), UINT8_C( 96), UINT8_C(210), UINT8_C(223), UINT8_C(202), UINT8_C(127), UINT8_C( 83), UINT8_C(199),
+        UINT8_C(193), UINT8_C(112), UINT8_C(134), UINT8_C( 40), UINT8_C(216), UINT8_C(122), UINT8_C(139), UINT8_C(145) },
+       INT32_C(           1),
+      {  INT32_C(   941465021), -INT32_C(  1038024577) } },
+    { {  INT32_C(    80839972),  INT32_C(   699666836) },
+      { -INT8_C(  32), -INT8_C(  93), -INT8_C(  35), -INT8_C(  59),  INT8_C(  20), -INT8_C(  72),  INT8_C( 105),  INT8_C( 103) },
+      { UINT8_C(139), UINT8_C(251), UINT8_C( 96), UINT8_C(164), UINT8_C(  9), UINT8_C( 77), UINT8_C( 25), UINT8_C( 11),
+        UINT8_C( 95), UINT8_C( 52), UINT8_C(144), UINT8_C(137), UINT8_C( 64), UINT8_C(224), UINT8_C(  4), UINT8_C(119) },
+       INT32_C(           2),
+      {  INT32_C(    80818973),  INT32_C(   699694223) } },
+    { { -INT32_C(   686348716), -INT32_C(   426560273) },
+      { -INT8_C( 121),  INT8_C( 124), -INT8_C(  17),  INT8_C(  47),  INT8_C(  87),  INT8_C(  31),      INT8_MAX,  INT8_C(  62) },
+      { UINT8_C(237), UINT8_C( 16), UINT8_C(169), UINT8_C( 41), UINT8_C( 74), UINT8_C( 28), UINT8_C(136), UINT8_C(200),
+        UINT8_C( 36), UINT8_C(240), UINT8_C( 92), UINT8_C( 98), UINT8_C(128), UINT8_C(195), UINT8_C(  6), UINT8_C( 62) },
+       INT32_C(           3),
+      { -INT32_C(   686337212), -INT32_C(   426538486) } },
+    { { -INT32_C(     4456617),  INT32_C(   578952545) },
+      {  INT8_C(  98), -INT8_C(   2), -INT8_C( 111), -INT8_C(  27),  INT8_C( 107), -INT8_C(  80), -INT8_C(  22),  INT8_C( 114) },
+      { UINT8_C(199), UINT8_C(159), UINT8_C(165), UINT8_C( 81), UINT8_C( 21), UINT8_C( 62), UINT8_C(129), UINT8_C(246),
+        UINT8_C(152), UINT8_C(101), UINT8_C(184), UINT8_C( 26), UINT8_C(111), UINT8_C( 57), UINT8_C(120), UINT8_C(222) },
+       INT32_C(           0),
+      { -INT32_C(     4457935),  INT32_C(   578966722) } },
+    { {  INT32_C(   320032992), -INT32_C(  1009026514) },
+      { -INT8_C(  43),  INT8_C(  13), -INT8_C(  67),  INT8_C(  74), -INT8_C(   4), -INT8_C( 124), -INT8_C( 107),  INT8_C( 115) },
+      { UINT8_C( 79), UINT8_C(190), UINT8_C( 45), UINT8_C(127), UINT8_C( 80), UINT8_C(255), UINT8_C( 46), UINT8_C(173),
+        UINT8_C( 30), UINT8_C( 30), UINT8_C(182), UINT8_C( 78), UINT8_C( 54), UINT8_C( 64), UINT8_C(249), UINT8_C(119) },
+       INT32_C(           1),
+      {  INT32_C(   320042587), -INT32_C(  1009043481) } },
+    { {  INT32_C(   286644206),  INT32_C(   417976490) },
+      {  INT8_C(  96), -INT8_C(  30), -INT8_C( 118),  INT8_C(  65),  INT8_C(  55), -INT8_C(  60),  INT8_C(   0), -INT8_C( 108) },
+      { UINT8_C(248), UINT8_C(224), UINT8_C(150), UINT8_C(250), UINT8_C( 97), UINT8_C( 95), UINT8_C(178), UINT8_C(165),
+        UINT8_C(239), UINT8_C(140), UINT8_C( 82), UINT8_C( 35), UINT8_C( 79), UINT8_C(230), UINT8_C(151), UINT8_C(134) },
+       INT32_C(           2),
+      {  INT32_C(   286655549),  INT32_C(   417977455) } },
+    { {  INT32_C(   502995234),  INT32_C(   876512561) },
+      {      INT8_MIN,  INT8_C(  66), -INT8_C(  34), -INT8_C( 119),  INT8_C(  58), -INT8_C(   6),  INT8_C(  36), -INT8_C(  96) },
+      { UINT8_C(198), UINT8_C( 97), UINT8_C(254), UINT8_C( 78), UINT8_C(144), UINT8_C(165), UINT8_C(209), UINT8_C(164),
+        UINT8_C( 56), UINT8_C( 49), UINT8_C( 34), UINT8_C( 22), UINT8_C( 66), UINT8_C( 91), UINT8_C( 16), UINT8_C(103) },
+       INT32_C(           3),
+      {  INT32_C(   502979991),  INT32_C(   876506531) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t r_ = simde_vld1_s32(test_vec[i].r_);
+    simde_int8x8_t a = simde_vld1_s8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+    simde_int32x2_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vsudot_laneq_s32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsudotq_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[4];
+    int8_t a[16];
+    uint8_t b[8];
+    const int lane;
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   613943365),  INT32_C(  1010907690), -INT32_C(   250754607), -INT32_C(   649598398) },
+      { -INT8_C( 112),  INT8_C(  70),  INT8_C( 122),  INT8_C(   3), -INT8_C( 103),  INT8_C(  59), -INT8_C(  15), -INT8_C(  92),
+        -INT8_C( 122), -INT8_C(  22),  INT8_C( 123), -INT8_C(  88),  INT8_C( 111), -INT8_C(  97),  INT8_C(  56),  INT8_C(  84) },
+      { UINT8_C(188), UINT8_C( 29), UINT8_C(136), UINT8_C( 20), UINT8_C( 36), UINT8_C(155), UINT8_C( 39), UINT8_C(110) },
+       INT32_C(           0),
+      { -INT32_C(   613945739),  INT32_C(  1010886157), -INT32_C(   250763213), -INT32_C(   649571047) } },
+    { { -INT32_C(   656617802), -INT32_C(   638983260), -INT32_C(    81527059),  INT32_C(   581242604) },
+      { -INT8_C(  31), -INT8_C(  30), -INT8_C(   1), -INT8_C(  37),  INT8_C(  84), -INT8_C(  74),  INT8_C(  55),  INT8_C( 106),
+         INT8_C(  90), -INT8_C(  75), -INT8_C(  43), -INT8_C(  36),  INT8_C(  77),  INT8_C(  44), -INT8_C(  48),  INT8_C(  98) },
+      { UINT8_C(180), UINT8_C(161), UINT8_C(166), UINT8_C(190), UINT8_C(211), UINT8_C(220), UINT8_C(165), UINT8_C(123) },
+       INT32_C(           1),
+      { -INT32_C(   656635659), -INT32_C(   638959703), -INT32_C(    81536092),  INT32_C(   581272665) } },
+    { { -INT32_C(   154927483),  INT32_C(   537141809),  INT32_C(    17562665),  INT32_C(   472483083) },
+      {  INT8_C( 103),  INT8_C( 101),  INT8_C(  75),      INT8_MIN, -INT8_C( 111),  INT8_C(  17), -INT8_C( 120), -INT8_C(  59),
+         INT8_C(  26), -INT8_C( 125),  INT8_C(  25), -INT8_C(  15), -INT8_C(  19),  INT8_C(  33), -INT8_C( 117),  INT8_C(  13) },
+      { UINT8_C( 79), UINT8_C( 48), UINT8_C( 19), UINT8_C(235), UINT8_C(182), UINT8_C( 79), UINT8_C( 70), UINT8_C(135) },
+       INT32_C(           0),
+      { -INT32_C(   154943153),  INT32_C(   537117711),  INT32_C(    17555669),  INT32_C(   472483998) } },
+    { {  INT32_C(   502867195), -INT32_C(      614591), -INT32_C(    73039578),  INT32_C(    26817070) },
+      {  INT8_C(  25), -INT8_C(  81),  INT8_C(  76), -INT8_C(  17), -INT8_C(  89),  INT8_C(  38),  INT8_C( 119), -INT8_C(  40),
+         INT8_C( 121), -INT8_C(  80),  INT8_C(  25), -INT8_C( 109),  INT8_C(  67), -INT8_C(  88), -INT8_C( 100),  INT8_C(  43) },
+      { UINT8_C(178), UINT8_C(222), UINT8_C(213), UINT8_C( 61), UINT8_C(116), UINT8_C(  5), UINT8_C(195), UINT8_C( 27) },
+       INT32_C(           1),
+      {  INT32_C(   502884051), -INT32_C(      602600), -INT32_C(    73024010),  INT32_C(    26806063) } },
+    { {  INT32_C(   235292880), -INT32_C(   896865388),  INT32_C(   297712270), -INT32_C(   431300529) },
+      {  INT8_C(  39), -INT8_C(  15), -INT8_C(  50), -INT8_C( 103),  INT8_C(  73),  INT8_C( 100), -INT8_C(  82), -INT8_C(  15),
+         INT8_C(  93),  INT8_C(  20),  INT8_C(  73), -INT8_C(  53), -INT8_C(  61),  INT8_C(  44), -INT8_C(  86),  INT8_C( 115) },
+      { UINT8_C( 25), UINT8_C(204), UINT8_C(134), UINT8_C( 43), UINT8_C(204), UINT8_C(222), UINT8_C( 66), UINT8_C( 69) },
+       INT32_C(           0),
+      {  INT32_C(   235279666), -INT32_C(   896854796),  INT32_C(   297726178), -INT32_C(   431299657) } },
+    { {  INT32_C(   991804579), -INT32_C(   222872192),  INT32_C(  1021605646),  INT32_C(   624139504) },
+      { -INT8_C(  28), -INT8_C(   2), -INT8_C(   4), -INT8_C(  92),  INT8_C(   8),  INT8_C(  92),  INT8_C(  37), -INT8_C(  83),
+        -INT8_C(  71),  INT8_C(  83),  INT8_C(  88),  INT8_C(  59),  INT8_C(  50), -INT8_C(  31),  INT8_C(  36),  INT8_C(  48) },
+      { UINT8_C( 12), UINT8_C(156), UINT8_C( 86), UINT8_C(179), UINT8_C(226), UINT8_C( 74), UINT8_C(225), UINT8_C( 22) },
+       INT32_C(           1),
+      {  INT32_C(   991795179), -INT32_C(   222857077),  INT32_C(  1021616840),  INT32_C(   624157666) } },
+    { { -INT32_C(    70911617), -INT32_C(   216100366),  INT32_C(   531806264), -INT32_C(   403764661) },
+      { -INT8_C(  85), -INT8_C(  71), -INT8_C( 101), -INT8_C(   4), -INT8_C(  53),  INT8_C(  19), -INT8_C( 121),  INT8_C(  47),
+        -INT8_C(  72),  INT8_C(  28),  INT8_C( 102),  INT8_C( 113), -INT8_C( 117),  INT8_C(  41), -INT8_C(  21), -INT8_C(  20) },
+      { UINT8_C(104), UINT8_C(132), UINT8_C(247), UINT8_C( 72), UINT8_C(  9), UINT8_C(192), UINT8_C( 22), UINT8_C(130) },
+       INT32_C(           0),
+      { -INT32_C(    70955064), -INT32_C(   216129873),  INT32_C(   531835802), -INT32_C(   403778044) } },
+    { { -INT32_C(   342224498), -INT32_C(   815571126),  INT32_C(   146087048), -INT32_C(   211758827) },
+      {  INT8_C(  10), -INT8_C( 101),  INT8_C( 110), -INT8_C( 124), -INT8_C(  94),  INT8_C(  70),  INT8_C(  10),  INT8_C(  56),
+        -INT8_C(  73), -INT8_C( 119),  INT8_C(  21),  INT8_C(  69), -INT8_C(  10),  INT8_C(  66), -INT8_C(  78),  INT8_C(  33) },
+      { UINT8_C(248), UINT8_C( 45), UINT8_C( 95), UINT8_C(101), UINT8_C(234), UINT8_C( 11), UINT8_C( 20), UINT8_C(126) },
+       INT32_C(           1),
+      { -INT32_C(   342236693), -INT32_C(   815585096),  INT32_C(   146077771), -INT32_C(   211757843) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r_ = simde_vld1q_s32(test_vec[i].r_);
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_uint8x8_t b = simde_vld1_u8(test_vec[i].b);
+    simde_int32x4_t r;
+
+    SIMDE_CONSTIFY_2_(simde_vsudotq_lane_s32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsudotq_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[4];
+    int8_t a[16];
+    uint8_t b[16];
+    const int lane;
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   235911905),  INT32_C(   358928851),  INT32_C(  1030503722),  INT32_C(   615897509) },
+      { -INT8_C(  48), -INT8_C( 119),  INT8_C(  49),  INT8_C(  52),  INT8_C(  53),  INT8_C(  26), -INT8_C(   8),  INT8_C(  13),
+        -INT8_C(  97),  INT8_C(   3),  INT8_C(  70), -INT8_C( 113),  INT8_C(  15), -INT8_C(  13), -INT8_C(  51),  INT8_C(  46) },
+      { UINT8_C(201), UINT8_C( 70), UINT8_C( 44), UINT8_C(195), UINT8_C(116), UINT8_C(213), UINT8_C(123), UINT8_C( 78),
+        UINT8_C(218), UINT8_C(159), UINT8_C(168), UINT8_C(229), UINT8_C( 67), UINT8_C(105), UINT8_C( 70), UINT8_C(103) },
+       INT32_C(           0),
+      {  INT32_C(   235906223),  INT32_C(   358943507),  INT32_C(  1030465480),  INT32_C(   615906340) } },
+    { { -INT32_C(   480565413),  INT32_C(   253396171), -INT32_C(   492836773),  INT32_C(   773370244) },
+      { -INT8_C(  54), -INT8_C(  48),  INT8_C(  34), -INT8_C(  94), -INT8_C(  68), -INT8_C(  34),  INT8_C(  34), -INT8_C(  54),
+        -INT8_C( 113),  INT8_C(  35),  INT8_C(  83),  INT8_C(  82),  INT8_C(  27),  INT8_C(  98),  INT8_C(  12), -INT8_C(  51) },
+      { UINT8_C( 96), UINT8_C( 54), UINT8_C( 67), UINT8_C( 94), UINT8_C( 13), UINT8_C(136), UINT8_C(118), UINT8_C(118),
+        UINT8_C(118), UINT8_C( 13), UINT8_C(183), UINT8_C( 40), UINT8_C(244), UINT8_C( 68), UINT8_C(240), UINT8_C(191) },
+       INT32_C(           1),
+      { -INT32_C(   480579723),  INT32_C(   253388303), -INT32_C(   492814012),  INT32_C(   773379321) } },
+    { { -INT32_C(   283568874),  INT32_C(   590387437),  INT32_C(  1037000957),  INT32_C(   961415224) },
+      { -INT8_C(  58), -INT8_C(  45), -INT8_C(  30), -INT8_C(  13), -INT8_C( 112),  INT8_C(  81), -INT8_C( 121),  INT8_C(  10),
+         INT8_C(  83), -INT8_C(  15), -INT8_C(  25), -INT8_C(  24), -INT8_C(  95), -INT8_C(  38),  INT8_C(  96),  INT8_C( 122) },
+      { UINT8_C(166), UINT8_C(234), UINT8_C(126), UINT8_C(218), UINT8_C(207), UINT8_C( 21), UINT8_C(194), UINT8_C(160),
+        UINT8_C(201), UINT8_C( 19), UINT8_C( 55), UINT8_C(231), UINT8_C(233), UINT8_C( 21), UINT8_C(125), UINT8_C(202) },
+       INT32_C(           2),
+      { -INT32_C(   283586040),  INT32_C(   590362119),  INT32_C(  1037010436),  INT32_C(   961428869) } },
+    { { -INT32_C(   905157403),  INT32_C(   590119294), -INT32_C(   862019488), -INT32_C(   258340806) },
+      {  INT8_C(  21),  INT8_C(  97),  INT8_C(  75),  INT8_C(  27),  INT8_C(  18),  INT8_C( 108), -INT8_C(  43),  INT8_C(  88),
+         INT8_C(  22), -INT8_C( 101), -INT8_C(  56),  INT8_C( 109),  INT8_C( 103), -INT8_C(  82), -INT8_C(  71), -INT8_C(  36) },
+      { UINT8_C( 69), UINT8_C(201), UINT8_C(211), UINT8_C(165), UINT8_C(230), UINT8_C( 12), UINT8_C( 91), UINT8_C(232),
+        UINT8_C(103), UINT8_C(232), UINT8_C( 46), UINT8_C(128), UINT8_C(165), UINT8_C( 83), UINT8_C( 63), UINT8_C( 46) },
+       INT32_C(           3),
+      { -INT32_C(   905139920),  INT32_C(   590132567), -INT32_C(   862022755), -INT32_C(   258336746) } },
+    { { -INT32_C(   583407166),  INT32_C(   856409687),  INT32_C(   485088188), -INT32_C(   707353000) },
+      {  INT8_C(  68), -INT8_C(  47),  INT8_C(  65),  INT8_C(  66), -INT8_C( 106), -INT8_C(  41),  INT8_C(  43), -INT8_C(  52),
+        -INT8_C(  45), -INT8_C(  54), -INT8_C(  37), -INT8_C( 102),  INT8_C(  86),  INT8_C(  29),  INT8_C(  30),  INT8_C( 100) },
+      { UINT8_C(147), UINT8_C( 92), UINT8_C( 60), UINT8_C( 67), UINT8_C(103), UINT8_C(  1), UINT8_C(129), UINT8_C(  6),
+        UINT8_C(234), UINT8_C(254), UINT8_C(255), UINT8_C(  2), UINT8_C(252), UINT8_C(121), UINT8_C(111), UINT8_C(243) },
+       INT32_C(           0),
+      { -INT32_C(   583393172),  INT32_C(   856389429),  INT32_C(   485067551), -INT32_C(   707329190) } },
+    { {  INT32_C(   875050129),  INT32_C(   687844887),  INT32_C(   824098415), -INT32_C(   732700290) },
+      { -INT8_C( 125), -INT8_C(   3),  INT8_C(  14), -INT8_C(  22), -INT8_C( 103), -INT8_C(  34), -INT8_C(  53), -INT8_C( 100),
+         INT8_C(  50), -INT8_C( 110), -INT8_C(  54), -INT8_C( 112),  INT8_C(  24),  INT8_C(  41), -INT8_C(  84), -INT8_C( 103) },
+      { UINT8_C( 55), UINT8_C(213), UINT8_C( 91), UINT8_C( 82), UINT8_C(145), UINT8_C( 90), UINT8_C(233), UINT8_C(184),
+        UINT8_C( 18), UINT8_C( 47), UINT8_C(153), UINT8_C(165), UINT8_C(188), UINT8_C(194), UINT8_C( 34), UINT8_C(218) },
+       INT32_C(           1),
+      {  INT32_C(   875030948),  INT32_C(   687796143),  INT32_C(   824062575), -INT32_C(   732731644) } },
+    { { -INT32_C(   794887360),  INT32_C(   183965111),  INT32_C(   948401133), -INT32_C(   495872054) },
+      { -INT8_C(  66),  INT8_C(  12),  INT8_C(  40),  INT8_C(  83), -INT8_C(  21), -INT8_C(  21), -INT8_C(  99), -INT8_C(  73),
+        -INT8_C(  84),  INT8_C( 119),  INT8_C(  19),  INT8_C(  90),  INT8_C(  34),  INT8_C(   4),  INT8_C(  53), -INT8_C(  62) },
+      { UINT8_C(254), UINT8_C(254), UINT8_C(252), UINT8_C( 92), UINT8_C(119), UINT8_C(148), UINT8_C( 99), UINT8_C(  0),
+        UINT8_C( 60), UINT8_C( 12), UINT8_C(238), UINT8_C( 60), UINT8_C(106), UINT8_C(212), UINT8_C(211), UINT8_C( 23) },
+       INT32_C(           2),
+      { -INT32_C(   794876676),  INT32_C(   183935657),  INT32_C(   948407443), -INT32_C(   495861072) } },
+    { {  INT32_C(   359885007),  INT32_C(   427993668), -INT32_C(   161757341), -INT32_C(  1025220438) },
+      { -INT8_C(  25),  INT8_C(  16),  INT8_C(   2), -INT8_C(  94),  INT8_C(  29),  INT8_C(  25),  INT8_C(  37), -INT8_C( 125),
+        -INT8_C(  70),  INT8_C(  42),  INT8_C(  46),  INT8_C(  74), -INT8_C( 114), -INT8_C(  39), -INT8_C(  29),  INT8_C(  41) },
+      { UINT8_C(173), UINT8_C(245), UINT8_C(242), UINT8_C( 18), UINT8_C( 69), UINT8_C(246), UINT8_C( 79), UINT8_C(235),
+        UINT8_C(171), UINT8_C(236), UINT8_C(211), UINT8_C( 28), UINT8_C(153), UINT8_C(161), UINT8_C(  9), UINT8_C(106) },
+       INT32_C(           3),
+      {  INT32_C(   359873812),  INT32_C(   427989213), -INT32_C(   161753031), -INT32_C(  1025240074) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r_ = simde_vld1q_s32(test_vec[i].r_);
+    simde_int8x16_t a = simde_vld1q_s8(test_vec[i].a);
+    simde_uint8x16_t b = simde_vld1q_u8(test_vec[i].b);
+    simde_int32x4_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vsudotq_laneq_s32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsudot_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsudot_laneq_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsudotq_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vsudotq_laneq_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
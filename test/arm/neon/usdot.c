@@ -0,0 +1,135 @@
+#define SIMDE_TEST_ARM_NEON_INSN usdot
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/usdot.h"
+
+static int
+test_simde_vusdot_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[2];
+    uint8_t a[8];
+    int8_t b[8];
+    int32_t r[2];
+  } test_vec[] = {
+    { { -INT32_C(   352233693),  INT32_C(   786650631) },
+      { UINT8_C(202), UINT8_C(254), UINT8_C( 15), UINT8_C(195), UINT8_C(218), UINT8_C( 88), UINT8_C(181), UINT8_C(109) },
+      { -INT8_C(  33),  INT8_C(  12),  INT8_C(  15),  INT8_C( 100), -INT8_C(  52), -INT8_C( 111), -INT8_C(   3),  INT8_C(  23) },
+      { -INT32_C(   352217586),  INT32_C(   786631491) } },
+    { {  INT32_C(  1068981335),  INT32_C(   695751201) },
+      { UINT8_C(245), UINT8_C( 31), UINT8_C( 44), UINT8_C(143), UINT8_C(196), UINT8_C( 70), UINT8_C(214), UINT8_C(102) },
+      { -INT8_C(   1), -INT8_C( 119),  INT8_C(  67),  INT8_C(  55),  INT8_C( 117),  INT8_C( 120),  INT8_C(  48),  INT8_C(  36) },
+      {  INT32_C(  1068988214),  INT32_C(   695796477) } },
+    { {  INT32_C(   594343065),  INT32_C(    87770622) },
+      { UINT8_C( 92), UINT8_C( 13), UINT8_C(163), UINT8_C(112), UINT8_C( 15), UINT8_C(143), UINT8_C( 29), UINT8_C(241) },
+      {  INT8_C(  55), -INT8_C(   9), -INT8_C(  47), -INT8_C(  77), -INT8_C(   2), -INT8_C(   5),  INT8_C(   8), -INT8_C( 100) },
+      {  INT32_C(   594331723),  INT32_C(    87746009) } },
+    { { -INT32_C(   131376250),  INT32_C(   594520208) },
+      { UINT8_C(181), UINT8_C( 88), UINT8_C( 90), UINT8_C(121), UINT8_C(162), UINT8_C(183), UINT8_C( 14), UINT8_C(180) },
+      { -INT8_C(  56), -INT8_C(  32),  INT8_C( 124),  INT8_C(  30), -INT8_C(  39),  INT8_C( 123), -INT8_C( 109), -INT8_C(  82) },
+      { -INT32_C(   131374412),  INT32_C(   594520113) } },
+    { { -INT32_C(   832502177), -INT32_C(    74632121) },
+      { UINT8_C(112), UINT8_C( 10), UINT8_C(244), UINT8_C(  0), UINT8_C(169), UINT8_C(103), UINT8_C( 66), UINT8_C(174) },
+      { -INT8_C(  38),  INT8_C(  37), -INT8_C(  98), -INT8_C( 117), -INT8_C(  53), -INT8_C(  56), -INT8_C(  72),  INT8_C(  58) },
+      { -INT32_C(   832529975), -INT32_C(    74641506) } },
+    { { -INT32_C(   762220960),  INT32_C(   530818353) },
+      { UINT8_C(202), UINT8_C( 51), UINT8_C(172), UINT8_C(154), UINT8_C(165), UINT8_C( 69), UINT8_C( 80), UINT8_C(223) },
+      {  INT8_C( 121),  INT8_C(  34), -INT8_C(  39),  INT8_C(  54), -INT8_C(  14), -INT8_C(  39),  INT8_C(  65),  INT8_C(  29) },
+      { -INT32_C(   762193176),  INT32_C(   530825019) } },
+    { {  INT32_C(   191200204), -INT32_C(   526784737) },
+      { UINT8_C( 90), UINT8_C(  0), UINT8_C(200), UINT8_C( 16), UINT8_C( 93), UINT8_C(162), UINT8_C(113), UINT8_C( 53) },
+      {  INT8_C( 126), -INT8_C(  56),  INT8_C(  41), -INT8_C(  89), -INT8_C(   7),  INT8_C(  49),  INT8_C(  35), -INT8_C(  43) },
+      {  INT32_C(   191218320), -INT32_C(   526775774) } },
+    { { -INT32_C(   692666527),  INT32_C(   368291152) },
+      { UINT8_C(228), UINT8_C(  5), UINT8_C(135), UINT8_C(107), UINT8_C(127), UINT8_C( 34), UINT8_C(179), UINT8_C(131) },
+      { -INT8_C(  73),      INT8_MIN, -INT8_C( 104),  INT8_C(  69),  INT8_C(  96),  INT8_C(  86), -INT8_C(  43),  INT8_C(  83) },
+      { -INT32_C(   692690468),  INT32_C(   368309444) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t r_ = simde_vld1_s32(test_vec[i].r_);
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+    simde_int32x2_t r = simde_vusdot_s32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vusdotq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[4];
+    uint8_t a[16];
+    int8_t b[16];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  1044029191),  INT32_C(   552816316),  INT32_C(   434784566),  INT32_C(   538363715) },
+      { UINT8_C( 51), UINT8_C(245), UINT8_C(115), UINT8_C( 83), UINT8_C(231), UINT8_C( 37), UINT8_C( 17), UINT8_C(150),
+        UINT8_C( 10), UINT8_C(163), UINT8_C(133), UINT8_C( 53), UINT8_C( 37), UINT8_C(175), UINT8_C( 87), UINT8_C(192) },
+      { -INT8_C(  46), -INT8_C(  90), -INT8_C(  81),  INT8_C(  45),  INT8_C( 119), -INT8_C( 113),  INT8_C(  92), -INT8_C(  44),
+         INT8_C(  94), -INT8_C(  48), -INT8_C( 101), -INT8_C(  77),  INT8_C(  41), -INT8_C(  23), -INT8_C(  31),  INT8_C(  81) },
+      {  INT32_C(  1043999215),  INT32_C(   552834588),  INT32_C(   434760168),  INT32_C(   538374062) } },
+    { {  INT32_C(    65561675),  INT32_C(   135390562),  INT32_C(   203584243), -INT32_C(    53479701) },
+      { UINT8_C( 49), UINT8_C( 25), UINT8_C(201), UINT8_C(251), UINT8_C( 78), UINT8_C( 27), UINT8_C(184), UINT8_C(  1),
+        UINT8_C(218), UINT8_C( 44), UINT8_C(150), UINT8_C(245), UINT8_C(102), UINT8_C( 49), UINT8_C( 13), UINT8_C(105) },
+      { -INT8_C(  41),  INT8_C(  21), -INT8_C(  87),  INT8_C( 114), -INT8_C(  69),  INT8_C(  29),  INT8_C(  75),  INT8_C( 113),
+         INT8_C( 122),  INT8_C(   7), -INT8_C(  82),  INT8_C(  70), -INT8_C(  34),  INT8_C(  61),  INT8_C(  67),  INT8_C(  61) },
+      {  INT32_C(    65571318),  INT32_C(   135399876),  INT32_C(   203615997), -INT32_C(    53472904) } },
+    { { -INT32_C(   272374199),  INT32_C(   840848409), -INT32_C(   882113592),  INT32_C(    57105752) },
+      { UINT8_C(225), UINT8_C(238), UINT8_C(134), UINT8_C(115), UINT8_C(137), UINT8_C( 31), UINT8_C( 77), UINT8_C( 49),
+        UINT8_C( 43), UINT8_C(176), UINT8_C(211), UINT8_C(116), UINT8_C( 31), UINT8_C(198), UINT8_C(214), UINT8_C(243) },
+      { -INT8_C(   8),  INT8_C( 115),  INT8_C(  25), -INT8_C(  88),  INT8_C(  74), -INT8_C( 111), -INT8_C(  53), -INT8_C(  67),
+         INT8_C( 101), -INT8_C(  40), -INT8_C(  43), -INT8_C(  20), -INT8_C(  30), -INT8_C(  64), -INT8_C( 107),  INT8_C(  88) },
+      { -INT32_C(   272355399),  INT32_C(   840847742), -INT32_C(   882127682),  INT32_C(    57090636) } },
+    { { -INT32_C(   737151607),  INT32_C(   796257930), -INT32_C(   206505133), -INT32_C(   438609594) },
+      { UINT8_C(132), UINT8_C(163), UINT8_C( 34), UINT8_C( 44), UINT8_C(198), UINT8_C(203), UINT8_C(166), UINT8_C(141),
+        UINT8_C(234), UINT8_C(  6), UINT8_C(214), UINT8_C( 57), UINT8_C(212), UINT8_C( 76), UINT8_C( 75), UINT8_C( 51) },
+      { -INT8_C(  74), -INT8_C(  77),  INT8_C(  18),  INT8_C(  48),  INT8_C(  82),  INT8_C(   7),  INT8_C(  68),  INT8_C( 120),
+         INT8_C( 114), -INT8_C( 109), -INT8_C(  40),  INT8_C(  13),  INT8_C(  78), -INT8_C(  55),  INT8_C(  77), -INT8_C( 109) },
+      { -INT32_C(   737171202),  INT32_C(   796303795), -INT32_C(   206486930), -INT32_C(   438597022) } },
+    { {  INT32_C(   626175059),  INT32_C(   350014373), -INT32_C(    53346497), -INT32_C(   862038704) },
+      { UINT8_C(243), UINT8_C(137), UINT8_C(190), UINT8_C( 10), UINT8_C(172), UINT8_C(155), UINT8_C(159), UINT8_C(143),
+        UINT8_C(251), UINT8_C( 50), UINT8_C(116), UINT8_C( 68), UINT8_C(153), UINT8_C(226), UINT8_C(164), UINT8_C(137) },
+      {  INT8_C(  85), -INT8_C(  83), -INT8_C(  32),  INT8_C(  98), -INT8_C(  20),  INT8_C(  80),  INT8_C( 120),  INT8_C(  63),
+        -INT8_C( 100), -INT8_C(  47), -INT8_C(  95),  INT8_C(  31),  INT8_C(  78), -INT8_C(  59), -INT8_C( 114), -INT8_C(  40) },
+      {  INT32_C(   626179243),  INT32_C(   350051422), -INT32_C(    53382859), -INT32_C(   862064280) } },
+    { { -INT32_C(   245829125), -INT32_C(   211626890), -INT32_C(   826233525), -INT32_C(     2189292) },
+      { UINT8_C( 16), UINT8_C(233), UINT8_C( 25), UINT8_C(184), UINT8_C(101), UINT8_C(140), UINT8_C(188), UINT8_C(237),
+        UINT8_C(203), UINT8_C( 63), UINT8_C( 15), UINT8_C(123), UINT8_C(190), UINT8_C(250), UINT8_C(228), UINT8_C( 90) },
+      {  INT8_C( 114),  INT8_C(  51),  INT8_C(  48), -INT8_C(  45),  INT8_C(   4), -INT8_C(  82),  INT8_C(  17), -INT8_C( 114),
+         INT8_C(  69), -INT8_C( 103), -INT8_C(  45), -INT8_C(  19), -INT8_C(  15), -INT8_C(  13), -INT8_C(  23),  INT8_C(   9) },
+      { -INT32_C(   245822498), -INT32_C(   211661788), -INT32_C(   826229019), -INT32_C(     2199826) } },
+    { {  INT32_C(   685078200), -INT32_C(   987617607), -INT32_C(  1035525280),  INT32_C(   962490155) },
+      { UINT8_C( 67), UINT8_C( 88), UINT8_C(  4), UINT8_C(114), UINT8_C(129), UINT8_C(156), UINT8_C(140), UINT8_C(216),
+        UINT8_C(192), UINT8_C(178), UINT8_C(235), UINT8_C(129), UINT8_C(111), UINT8_C(238), UINT8_C(154), UINT8_C(203) },
+      { -INT8_C(  76), -INT8_C( 125),  INT8_C(  63),  INT8_C(  16),  INT8_C(  24), -INT8_C(  73),  INT8_C( 118), -INT8_C(  96),
+         INT8_C(  44),  INT8_C(  13),  INT8_C(  38),  INT8_C(  13),  INT8_C(   5),  INT8_C(  24), -INT8_C(  32), -INT8_C(  52) },
+      {  INT32_C(   685064184), -INT32_C(   987630115), -INT32_C(  1035503911),  INT32_C(   962480938) } },
+    { { -INT32_C(    41652279), -INT32_C(   829896468),  INT32_C(   661847711),  INT32_C(   298868467) },
+      { UINT8_C( 71), UINT8_C( 13), UINT8_C(254), UINT8_C(151), UINT8_C(132), UINT8_C(214), UINT8_C(207), UINT8_C(198),
+        UINT8_C( 18), UINT8_C( 97), UINT8_C(175), UINT8_C(113), UINT8_C(243), UINT8_C(183), UINT8_C(153), UINT8_C( 87) },
+      { -INT8_C(  36),  INT8_C(  22), -INT8_C(  79),  INT8_C( 113), -INT8_C(  63),  INT8_C(   4), -INT8_C(  35),  INT8_C(  43),
+        -INT8_C(  83), -INT8_C(  15),  INT8_C(  53), -INT8_C(  14),  INT8_C(  29),  INT8_C(  87),  INT8_C(  41),  INT8_C(  62) },
+      { -INT32_C(    41657552), -INT32_C(   829902659),  INT32_C(   661852455),  INT32_C(   298903102) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r_ = simde_vld1q_s32(test_vec[i].r_);
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int32x4_t r = simde_vusdotq_s32(r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vusdot_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vusdotq_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,306 @@
+#define SIMDE_TEST_ARM_NEON_INSN usdot_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/usdot_lane.h"
+#include "../../../simde/arm/neon/dup_n.h"
+
+static int
+test_simde_vusdot_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[2];
+    uint8_t a[8];
+    int8_t b[8];
+    const int lane;
+    int32_t r[2];
+  } test_vec[] = {
+    { {  INT32_C(    45351553),  INT32_C(   189198131) },
+      { UINT8_C(237), UINT8_C( 60), UINT8_C(240), UINT8_C( 27), UINT8_C( 36), UINT8_C(241), UINT8_C( 99), UINT8_C( 61) },
+      {  INT8_C(  67),  INT8_C(  24),  INT8_C(  83), -INT8_C( 101), -INT8_C(  51), -INT8_C(  58), -INT8_C(  26),  INT8_C(  47) },
+       INT32_C(           0),
+      {  INT32_C(    45386065),  INT32_C(   189208383) } },
+    { {  INT32_C(   683723759),  INT32_C(   891512526) },
+      { UINT8_C( 73), UINT8_C(161), UINT8_C( 92), UINT8_C( 41), UINT8_C(249), UINT8_C(170), UINT8_C( 90), UINT8_C(160) },
+      { -INT8_C(  99), -INT8_C( 126),  INT8_C( 103),  INT8_C(  12), -INT8_C(  21), -INT8_C(  42), -INT8_C(  47),  INT8_C( 122) },
+       INT32_C(           1),
+      {  INT32_C(   683716142),  INT32_C(   891515447) } },
+    { { -INT32_C(   695607112), -INT32_C(   517947462) },
+      { UINT8_C(222), UINT8_C(219), UINT8_C(206), UINT8_C(219), UINT8_C(244), UINT8_C(196), UINT8_C(  2), UINT8_C( 19) },
+      { -INT8_C(  26),  INT8_C(  63), -INT8_C( 121),  INT8_C(  36), -INT8_C(  31), -INT8_C( 119), -INT8_C( 126), -INT8_C(   1) },
+       INT32_C(           0),
+      { -INT32_C(   695616129), -INT32_C(   517941016) } },
+    { { -INT32_C(   101938015),  INT32_C(   405229184) },
+      { UINT8_C(159), UINT8_C( 66), UINT8_C( 52), UINT8_C(196), UINT8_C(156), UINT8_C( 85), UINT8_C( 33), UINT8_C( 23) },
+      {  INT8_C(  24),  INT8_C(  20),  INT8_C( 105),  INT8_C(  44),  INT8_C(  94), -INT8_C(  60),  INT8_C(  47),  INT8_C( 122) },
+       INT32_C(           1),
+      { -INT32_C(   101900673),  INT32_C(   405243105) } },
+    { {  INT32_C(   469228961), -INT32_C(   264458165) },
+      { UINT8_C( 84), UINT8_C(206), UINT8_C(  9), UINT8_C(116), UINT8_C(114), UINT8_C( 67), UINT8_C(108), UINT8_C( 11) },
+      { -INT8_C(  42), -INT8_C(  65),  INT8_C(  59), -INT8_C( 109),  INT8_C(  64),  INT8_C(   2), -INT8_C( 104), -INT8_C( 104) },
+       INT32_C(           0),
+      {  INT32_C(   469199930), -INT32_C(   264462135) } },
+    { { -INT32_C(   609398104), -INT32_C(   988951554) },
+      { UINT8_C( 24), UINT8_C( 59), UINT8_C(213), UINT8_C(227), UINT8_C(194), UINT8_C( 63), UINT8_C(129), UINT8_C(242) },
+      { -INT8_C(  50), -INT8_C(  23), -INT8_C( 124),  INT8_C(  26),  INT8_C(  87), -INT8_C(  77),  INT8_C(  10), -INT8_C(  58) },
+       INT32_C(           1),
+      { -INT32_C(   609411595), -INT32_C(   988952273) } },
+    { {  INT32_C(   725101066), -INT32_C(   623138609) },
+      { UINT8_C( 60), UINT8_C(144), UINT8_C( 58), UINT8_C( 54), UINT8_C(254), UINT8_C(101), UINT8_C(102), UINT8_C(134) },
+      { -INT8_C(  25),  INT8_C(  55),  INT8_C(  81),  INT8_C(  23), -INT8_C(  46), -INT8_C( 108),  INT8_C( 126), -INT8_C(  22) },
+       INT32_C(           0),
+      {  INT32_C(   725113426), -INT32_C(   623128060) } },
+    { {  INT32_C(   990694105),  INT32_C(   346189905) },
+      { UINT8_C(120), UINT8_C(  1), UINT8_C(  6), UINT8_C( 45), UINT8_C( 56), UINT8_C(252), UINT8_C( 76), UINT8_C( 46) },
+      { -INT8_C(  90), -INT8_C(  77),  INT8_C(   3), -INT8_C(  10),  INT8_C( 105),  INT8_C(  23),  INT8_C(   7),  INT8_C( 109) },
+       INT32_C(           1),
+      {  INT32_C(   990711675),  INT32_C(   346207127) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t r_ = simde_vld1_s32(test_vec[i].r_);
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+    simde_int32x2_t r;
+
+    SIMDE_CONSTIFY_2_(simde_vusdot_lane_s32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vusdot_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[2];
+    uint8_t a[8];
+    int8_t b[16];
+    const int lane;
+    int32_t r[2];
+  } test_vec[] = {
+    { { -INT32_C(   858649021), -INT32_C(   645065820) },
+      { UINT8_C( 89), UINT8_C( 20), UINT8_C(148), UINT8_C(184), UINT8_C(160), UINT8_C(218), UINT8_C( 59), UINT8_C( 48) },
+      { -INT8_C( 105), -INT8_C( 124), -INT8_C(  58), -INT8_C(  41),  INT8_C(  40),  INT8_C(  55),  INT8_C(  96),  INT8_C(   9),
+        -INT8_C(  81),  INT8_C(  62),  INT8_C(  47), -INT8_C(  35), -INT8_C(  70),  INT8_C(  77),  INT8_C(  76),  INT8_C( 105) },
+       INT32_C(           0),
+      { -INT32_C(   858676974), -INT32_C(   645115042) } },
+    { {  INT32_C(    93772405),  INT32_C(   582893577) },
+      { UINT8_C(244), UINT8_C(215), UINT8_C( 85), UINT8_C( 57), UINT8_C( 67), UINT8_C( 30), UINT8_C( 81), UINT8_C( 53) },
+      {  INT8_C(  85),  INT8_C( 119),  INT8_C(  96), -INT8_C(  36),  INT8_C(  66),  INT8_C(  55), -INT8_C( 114), -INT8_C(  62),
+         INT8_C( 119),  INT8_C( 121), -INT8_C(  71),  INT8_C(  82),  INT8_C(  97), -INT8_C( 105), -INT8_C(  96),  INT8_C(   5) },
+       INT32_C(           1),
+      {  INT32_C(    93787110),  INT32_C(   582887129) } },
+    { {  INT32_C(   275899888), -INT32_C(  1020655136) },
+      { UINT8_C(114), UINT8_C(173), UINT8_C( 48), UINT8_C(221), UINT8_C(127), UINT8_C(246), UINT8_C(177), UINT8_C(197) },
+      { -INT8_C(  52), -INT8_C( 101), -INT8_C( 123), -INT8_C(  48),  INT8_C( 112),  INT8_C( 125), -INT8_C(  44), -INT8_C(  90),
+         INT8_C( 123),  INT8_C(  36), -INT8_C(   5),  INT8_C(  41),  INT8_C(  14), -INT8_C( 103), -INT8_C(  14),  INT8_C(  65) },
+       INT32_C(           2),
+      {  INT32_C(   275928959), -INT32_C(  1020623467) } },
+    { {  INT32_C(   658319648), -INT32_C(    64424484) },
+      { UINT8_C( 40), UINT8_C(235), UINT8_C(227), UINT8_C(229), UINT8_C( 45), UINT8_C(255), UINT8_C(228), UINT8_C(161) },
+      { -INT8_C(  68),  INT8_C( 126), -INT8_C( 119), -INT8_C(  76),  INT8_C(  78),  INT8_C(  83), -INT8_C( 110),      INT8_MIN,
+        -INT8_C(  82),  INT8_C(  27), -INT8_C(  23),  INT8_C( 105),  INT8_C(  46),  INT8_C(  58), -INT8_C( 101), -INT8_C(  14) },
+       INT32_C(           3),
+      {  INT32_C(   658308985), -INT32_C(    64432906) } },
+    { {  INT32_C(   878148935),  INT32_C(   352069743) },
+      { UINT8_C(242), UINT8_C(186), UINT8_C(231), UINT8_C( 58), UINT8_C( 49), UINT8_C(113), UINT8_C(  1), UINT8_C(174) },
+      {  INT8_C(  53),  INT8_C(  21),  INT8_C(  63), -INT8_C(  74), -INT8_C( 105), -INT8_C(  44),  INT8_C( 124), -INT8_C(  57),
+         INT8_C(  81), -INT8_C(  74),  INT8_C(   2), -INT8_C(  28), -INT8_C(  32), -INT8_C(  67),  INT8_C(  73), -INT8_C(  18) },
+       INT32_C(           0),
+      {  INT32_C(   878175928),  INT32_C(   352061900) } },
+    { {  INT32_C(   889255813), -INT32_C(   255212257) },
+      { UINT8_C(173), UINT8_C( 55), UINT8_C(212), UINT8_C( 23), UINT8_C( 63), UINT8_C(230), UINT8_C(234), UINT8_C( 68) },
+      {      INT8_MAX, -INT8_C( 126), -INT8_C( 104),  INT8_C(  93),  INT8_C( 119), -INT8_C(  38), -INT8_C(  40), -INT8_C(  63),
+        -INT8_C(  75),  INT8_C(  70),  INT8_C(  36),  INT8_C(  68),  INT8_C(  86), -INT8_C(   1),  INT8_C(  12),  INT8_C(  75) },
+       INT32_C(           1),
+      {  INT32_C(   889264381), -INT32_C(   255227144) } },
+    { {  INT32_C(   398825516),  INT32_C(   189723907) },
+      { UINT8_C(231), UINT8_C( 68), UINT8_C( 70), UINT8_C(211), UINT8_C(153), UINT8_C(160), UINT8_C(111), UINT8_C(102) },
+      { -INT8_C(  21),  INT8_C(  20),  INT8_C(  48), -INT8_C(  61), -INT8_C(  37),  INT8_C(  37), -INT8_C(  69),  INT8_C(  52),
+         INT8_C( 117),  INT8_C(  85),  INT8_C(  18),  INT8_C(  88), -INT8_C( 122), -INT8_C(  74), -INT8_C( 116),  INT8_C(  67) },
+       INT32_C(           2),
+      {  INT32_C(   398878151),  INT32_C(   189766382) } },
+    { { -INT32_C(   449568324), -INT32_C(   845829387) },
+      { UINT8_C( 28), UINT8_C(102), UINT8_C(136), UINT8_C( 82), UINT8_C(146), UINT8_C(128), UINT8_C( 74), UINT8_C( 31) },
+      {  INT8_C(  23), -INT8_C(  24), -INT8_C( 112),  INT8_C(  55),  INT8_C( 103), -INT8_C(  76), -INT8_C(  14),  INT8_C(  71),
+        -INT8_C(   7),  INT8_C(  19), -INT8_C( 104),  INT8_C(  67),  INT8_C(  70),  INT8_C(  85),  INT8_C(  32), -INT8_C( 101) },
+       INT32_C(           3),
+      { -INT32_C(   449561624), -INT32_C(   845809050) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2_t r_ = simde_vld1_s32(test_vec[i].r_);
+    simde_uint8x8_t a = simde_vld1_u8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int32x2_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vusdot_laneq_s32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x2(r, simde_vld1_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vusdotq_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[4];
+    uint8_t a[16];
+    int8_t b[8];
+    const int lane;
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1018056547),  INT32_C(     5760112), -INT32_C(   201488851),  INT32_C(   829202930) },
+      { UINT8_C(115), UINT8_C(188), UINT8_C(100), UINT8_C( 99), UINT8_C(150), UINT8_C(229), UINT8_C( 90), UINT8_C( 38),
+        UINT8_C( 95), UINT8_C( 88), UINT8_C( 61), UINT8_C(193), UINT8_C( 20), UINT8_C(219), UINT8_C(142), UINT8_C(135) },
+      { -INT8_C(  62), -INT8_C(  46),  INT8_C(   2), -INT8_C( 126),  INT8_C(  41),  INT8_C( 110), -INT8_C(  49), -INT8_C( 108) },
+       INT32_C(           0),
+      { -INT32_C(  1018084599),  INT32_C(     5735670), -INT32_C(   201522985),  INT32_C(   829174890) } },
+    { { -INT32_C(   413590828),  INT32_C(   311943597), -INT32_C(   855319370),  INT32_C(   219708277) },
+      { UINT8_C(251), UINT8_C(183), UINT8_C( 37), UINT8_C(162), UINT8_C(112), UINT8_C( 94), UINT8_C( 34), UINT8_C( 81),
+        UINT8_C(212), UINT8_C(206), UINT8_C( 47), UINT8_C(178), UINT8_C(113), UINT8_C(109), UINT8_C(169), UINT8_C(169) },
+      {  INT8_C(  56),  INT8_C(  22), -INT8_C(  17),  INT8_C( 115), -INT8_C( 124), -INT8_C(  70),  INT8_C(  49),  INT8_C( 100) },
+       INT32_C(           1),
+      { -INT32_C(   413616749),  INT32_C(   311932895), -INT32_C(   855339975),  INT32_C(   219711816) } },
+    { { -INT32_C(    41455564), -INT32_C(    26512131), -INT32_C(   902470340),  INT32_C(   304672141) },
+      { UINT8_C(195), UINT8_C( 58), UINT8_C(197), UINT8_C(131), UINT8_C(144), UINT8_C( 12), UINT8_C(191), UINT8_C(228),
+        UINT8_C(249), UINT8_C( 22), UINT8_C(151), UINT8_C( 98), UINT8_C(164), UINT8_C( 42), UINT8_C( 49), UINT8_C( 85) },
+      { -INT8_C( 125), -INT8_C(  95), -INT8_C(  21), -INT8_C(  19),  INT8_C(  89), -INT8_C(  75), -INT8_C(  23),  INT8_C(  94) },
+       INT32_C(           0),
+      { -INT32_C(    41492075), -INT32_C(    26539614), -INT32_C(   902508588),  INT32_C(   304645007) } },
+    { { -INT32_C(   763986669), -INT32_C(   413370916), -INT32_C(   971723711),  INT32_C(   898615546) },
+      { UINT8_C(169), UINT8_C( 19), UINT8_C( 44), UINT8_C( 37), UINT8_C( 27), UINT8_C( 91), UINT8_C(128), UINT8_C( 36),
+        UINT8_C(116), UINT8_C(132), UINT8_C(208), UINT8_C(198), UINT8_C(230), UINT8_C(207), UINT8_C(221), UINT8_C(161) },
+      { -INT8_C( 120),  INT8_C(  71), -INT8_C(  68), -INT8_C( 125), -INT8_C(  96), -INT8_C( 105), -INT8_C(  91),  INT8_C(  55) },
+       INT32_C(           1),
+      { -INT32_C(   764006857), -INT32_C(   413392731), -INT32_C(   971756745),  INT32_C(   898560475) } },
+    { { -INT32_C(   617893140),  INT32_C(   171096866),  INT32_C(   220549611), -INT32_C(   702204726) },
+      { UINT8_C(144), UINT8_C(224), UINT8_C(195), UINT8_C(202), UINT8_C( 15), UINT8_C(242), UINT8_C( 80), UINT8_C(112),
+        UINT8_C( 69), UINT8_C(200), UINT8_C(151), UINT8_C( 73), UINT8_C(152), UINT8_C(191), UINT8_C(  5), UINT8_C( 72) },
+      { -INT8_C(  65), -INT8_C( 107), -INT8_C( 126),  INT8_C(  73), -INT8_C(  85),  INT8_C(  28), -INT8_C(  21),  INT8_C(  48) },
+       INT32_C(           0),
+      { -INT32_C(   617936292),  INT32_C(   171068093),  INT32_C(   220510029), -INT32_C(   702230417) } },
+    { { -INT32_C(   164338580),  INT32_C(   698595729), -INT32_C(   461901753), -INT32_C(   382448107) },
+      { UINT8_C( 94), UINT8_C(113), UINT8_C(129), UINT8_C( 99), UINT8_C( 58), UINT8_C( 92), UINT8_C( 27), UINT8_C(236),
+        UINT8_C( 37), UINT8_C(148), UINT8_C( 34), UINT8_C(128), UINT8_C( 50), UINT8_C(101), UINT8_C(249), UINT8_C(169) },
+      {  INT8_C(  54), -INT8_C(  63), -INT8_C(   8), -INT8_C(  77),  INT8_C(  17), -INT8_C(  93), -INT8_C(  29),  INT8_C(  34) },
+       INT32_C(           1),
+      { -INT32_C(   164347866),  INT32_C(   698595400), -INT32_C(   461911522), -INT32_C(   382458125) } },
+    { {  INT32_C(  1013016287),  INT32_C(   861767923),  INT32_C(   336493825),  INT32_C(   239124410) },
+      { UINT8_C( 78), UINT8_C(186), UINT8_C(161), UINT8_C(219), UINT8_C( 86), UINT8_C(  2), UINT8_C(160), UINT8_C(126),
+        UINT8_C(113), UINT8_C(223), UINT8_C(141), UINT8_C(184), UINT8_C( 68), UINT8_C(169), UINT8_C(245), UINT8_C(236) },
+      {  INT8_C( 100),  INT8_C(  55),  INT8_C(  28),  INT8_C( 121), -INT8_C(  73), -INT8_C(  39), -INT8_C(  87),  INT8_C(  15) },
+       INT32_C(           0),
+      {  INT32_C(  1013065324),  INT32_C(   861796359),  INT32_C(   336543602),  INT32_C(   239175921) } },
+    { { -INT32_C(   472439235), -INT32_C(   230073089),  INT32_C(    56842396), -INT32_C(   745338415) },
+      { UINT8_C( 38), UINT8_C(  9), UINT8_C( 15), UINT8_C(207), UINT8_C(108), UINT8_C( 18), UINT8_C(133), UINT8_C(241),
+        UINT8_C( 76), UINT8_C(187), UINT8_C(200), UINT8_C(114), UINT8_C(148), UINT8_C( 68), UINT8_C(237), UINT8_C( 46) },
+      {  INT8_C(  75),  INT8_C(  58), -INT8_C( 123), -INT8_C(   6), -INT8_C(  44), -INT8_C(  57),  INT8_C( 100), -INT8_C(  47) },
+       INT32_C(           1),
+      { -INT32_C(   472449649), -INT32_C(   230076894),  INT32_C(    56843035), -INT32_C(   745327265) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r_ = simde_vld1q_s32(test_vec[i].r_);
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_int8x8_t b = simde_vld1_s8(test_vec[i].b);
+    simde_int32x4_t r;
+
+    SIMDE_CONSTIFY_2_(simde_vusdotq_lane_s32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vusdotq_laneq_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r_[4];
+    uint8_t a[16];
+    int8_t b[16];
+    const int lane;
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   304319125), -INT32_C(   445821679),  INT32_C(  1002889505),  INT32_C(   467273301) },
+      { UINT8_C( 20), UINT8_C(112), UINT8_C(249), UINT8_C(118), UINT8_C( 32), UINT8_C(135), UINT8_C(189), UINT8_C(119),
+        UINT8_C( 21), UINT8_C(105), UINT8_C(184), UINT8_C(198), UINT8_C(240), UINT8_C(232), UINT8_C( 23), UINT8_C( 20) },
+      {  INT8_C(  37), -INT8_C(  76),  INT8_C(  12),  INT8_C(   6), -INT8_C(  39),  INT8_C(  64),  INT8_C(  65),  INT8_C(  59),
+        -INT8_C(  89),  INT8_C(   0),  INT8_C(  64), -INT8_C(  14),  INT8_C(  79),  INT8_C(  52),  INT8_C(  48),  INT8_C( 121) },
+       INT32_C(           0),
+      { -INT32_C(   304323201), -INT32_C(   445827773),  INT32_C(  1002885698),  INT32_C(   467264945) } },
+    { {  INT32_C(   996905246), -INT32_C(  1045404991), -INT32_C(   476877499),  INT32_C(   815608715) },
+      { UINT8_C( 84), UINT8_C(117), UINT8_C( 39), UINT8_C(143), UINT8_C(108), UINT8_C( 76), UINT8_C( 95), UINT8_C( 80),
+        UINT8_C(185), UINT8_C( 60), UINT8_C(117), UINT8_C(212), UINT8_C(169), UINT8_C( 58), UINT8_C(246), UINT8_C(245) },
+      {  INT8_C( 117), -INT8_C(  21), -INT8_C(  46),  INT8_C(  82), -INT8_C( 117), -INT8_C(   4), -INT8_C( 106), -INT8_C(  63),
+        -INT8_C(  46), -INT8_C(  60), -INT8_C( 108), -INT8_C(  53), -INT8_C( 100), -INT8_C(  43),  INT8_C(   4), -INT8_C(  36) },
+       INT32_C(           1),
+      {  INT32_C(   996881807), -INT32_C(  1045433041), -INT32_C(   476925142),  INT32_C(   815547199) } },
+    { {  INT32_C(   667679801), -INT32_C(   993769389),  INT32_C(   143686509), -INT32_C(   705454791) },
+      { UINT8_C(110), UINT8_C(229), UINT8_C(241), UINT8_C(246), UINT8_C( 87), UINT8_C(112), UINT8_C(210), UINT8_C( 73),
+        UINT8_C( 93), UINT8_C(135), UINT8_C( 85), UINT8_C(175), UINT8_C(232), UINT8_C( 35), UINT8_C(117), UINT8_C(193) },
+      {  INT8_C(  69), -INT8_C(  61), -INT8_C(  73), -INT8_C( 120), -INT8_C(  25),  INT8_C(  86), -INT8_C(  52), -INT8_C(  79),
+        -INT8_C(  38),  INT8_C( 115), -INT8_C( 109), -INT8_C(  68), -INT8_C(  81),  INT8_C( 118), -INT8_C(  62),      INT8_MIN },
+       INT32_C(           2),
+      {  INT32_C(   667658959), -INT32_C(   993787669),  INT32_C(   143677335), -INT32_C(   705485459) } },
+    { {  INT32_C(   779522922),  INT32_C(   733082300),  INT32_C(   517017215), -INT32_C(   887175816) },
+      { UINT8_C(219), UINT8_C(117), UINT8_C(246), UINT8_C(195), UINT8_C(179), UINT8_C( 50), UINT8_C(217), UINT8_C( 68),
+        UINT8_C(130), UINT8_C(244), UINT8_C(119), UINT8_C( 42), UINT8_C(145), UINT8_C(209), UINT8_C(131), UINT8_C( 96) },
+      { -INT8_C( 126), -INT8_C( 125), -INT8_C(  68), -INT8_C( 125),  INT8_C(  64), -INT8_C(  23),  INT8_C(  33),  INT8_C(  81),
+         INT8_C(  57), -INT8_C(  74), -INT8_C(  49),  INT8_C(  90),  INT8_C(   1),  INT8_C(   5),  INT8_C(  88),  INT8_C(  59) },
+       INT32_C(           3),
+      {  INT32_C(   779556879),  INT32_C(   733105837),  INT32_C(   517031515), -INT32_C(   887157434) } },
+    { {  INT32_C(   109781679),  INT32_C(   633310724), -INT32_C(   198884196),  INT32_C(   701059599) },
+      { UINT8_C(247), UINT8_C( 91), UINT8_C(189), UINT8_C(247), UINT8_C(129), UINT8_C(157), UINT8_C(176), UINT8_C(203),
+        UINT8_C( 70), UINT8_C( 60), UINT8_C(117), UINT8_C(228), UINT8_C( 82), UINT8_C( 51), UINT8_C(109), UINT8_C(205) },
+      {  INT8_C(  45), -INT8_C( 102), -INT8_C(  46),  INT8_C(  71), -INT8_C( 126), -INT8_C(  82), -INT8_C(  54),  INT8_C( 113),
+         INT8_C(  94), -INT8_C(  83), -INT8_C(  96),  INT8_C(   6), -INT8_C(  15),  INT8_C(  61), -INT8_C(  88), -INT8_C( 109) },
+       INT32_C(           0),
+      {  INT32_C(   109792355),  INT32_C(   633306832), -INT32_C(   198876360),  INT32_C(   701067628) } },
+    { {  INT32_C(   576925820),  INT32_C(   647014737),  INT32_C(   156634166), -INT32_C(   826939993) },
+      { UINT8_C( 89), UINT8_C(253), UINT8_C(224), UINT8_C(  5), UINT8_C(103), UINT8_C(146), UINT8_C( 99), UINT8_C( 17),
+        UINT8_C(118), UINT8_C( 86), UINT8_C( 18), UINT8_C(184), UINT8_C(122), UINT8_C(  0), UINT8_C( 80), UINT8_C( 44) },
+      {  INT8_C(  13),  INT8_C(  76),  INT8_C(  52),  INT8_C(  74),  INT8_C(  79), -INT8_C(  26), -INT8_C( 121), -INT8_C(  93),
+        -INT8_C(  82),  INT8_C(  17),  INT8_C(  50),  INT8_C(  49),  INT8_C(  13), -INT8_C(  13), -INT8_C(  29),  INT8_C( 104) },
+       INT32_C(           1),
+      {  INT32_C(   576898704),  INT32_C(   647005518),  INT32_C(   156621962), -INT32_C(   826944127) } },
+    { {  INT32_C(   661238001), -INT32_C(  1053763989),  INT32_C(    47706386), -INT32_C(   321973134) },
+      { UINT8_C(208), UINT8_C( 54), UINT8_C( 37), UINT8_C(150), UINT8_C(174), UINT8_C( 59), UINT8_C(131), UINT8_C(128),
+        UINT8_C(226), UINT8_C(193), UINT8_C(247), UINT8_C(124), UINT8_C(173), UINT8_C(234), UINT8_C(235), UINT8_C( 14) },
+      {  INT8_C( 118), -INT8_C(  69),  INT8_C(   4), -INT8_C(  94),  INT8_C(  67), -INT8_C(  16), -INT8_C(  11),  INT8_C(  33),
+         INT8_C(  83),  INT8_C(  52), -INT8_C( 124),  INT8_C(   6), -INT8_C(   1),  INT8_C(  19), -INT8_C(  81),  INT8_C(  76) },
+       INT32_C(           2),
+      {  INT32_C(   661254385), -INT32_C(  1053761955),  INT32_C(    47705296), -INT32_C(   321975663) } },
+    { {  INT32_C(   395106421), -INT32_C(   747200519), -INT32_C(   307151381),  INT32_C(   973048281) },
+      { UINT8_C(160), UINT8_C(181), UINT8_C(111), UINT8_C(137), UINT8_C( 93), UINT8_C( 97), UINT8_C(255), UINT8_C(102),
+        UINT8_C(120), UINT8_C(123), UINT8_C(135), UINT8_C(105), UINT8_C(117), UINT8_C(103), UINT8_C(127), UINT8_C(182) },
+      { -INT8_C(  49), -INT8_C(  74), -INT8_C(  67), -INT8_C(  88),  INT8_C( 124), -INT8_C( 125), -INT8_C( 107),  INT8_C( 118),
+         INT8_C(  62),  INT8_C(  33),  INT8_C( 124),  INT8_C(  12),  INT8_C( 123), -INT8_C(  35),  INT8_C(  15),  INT8_C(  75) },
+       INT32_C(           3),
+      {  INT32_C(   395131706), -INT32_C(   747181000), -INT32_C(   307131026),  INT32_C(   973074622) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4_t r_ = simde_vld1q_s32(test_vec[i].r_);
+    simde_uint8x16_t a = simde_vld1q_u8(test_vec[i].a);
+    simde_int8x16_t b = simde_vld1q_s8(test_vec[i].b);
+    simde_int32x4_t r;
+
+    SIMDE_CONSTIFY_4_(simde_vusdotq_laneq_s32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_s32(INT32_C(0))), test_vec[i].lane, r_, a, b);
+
+    simde_test_arm_neon_assert_equal_i32x4(r, simde_vld1q_s32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(vusdot_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vusdot_laneq_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vusdotq_lane_s32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(vusdotq_laneq_s32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN ceq
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/ceq.h"
+
+static int
+test_simde_ceq_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  37),  INT8_C(  83), -INT8_C(  42), -INT8_C( 115),  INT8_C(  34), -INT8_C( 106),  INT8_C(  43),  INT8_C(  38),
+         INT8_C(  60), -INT8_C(  77), -INT8_C(  98),  INT8_C(  42),  INT8_C( 110), -INT8_C(   6),  INT8_C(  77), -INT8_C(  49) },
+      {  INT8_C(  88),  INT8_C( 107), -INT8_C(  33),  INT8_C(  94), -INT8_C(  82),  INT8_C(  69), -INT8_C( 106), -INT8_C(   5),
+         INT8_C(  97), -INT8_C(  35), -INT8_C(  55), -INT8_C(   3),  INT8_C(  84),  INT8_C( 105),  INT8_C(   1), -INT8_C(   7) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  29),  INT8_C(  13), -INT8_C(  86),  INT8_C( 111),  INT8_C(  34),  INT8_C(  98), -INT8_C( 103), -INT8_C(  30),
+        -INT8_C(  83), -INT8_C(  40),  INT8_C(  41),  INT8_C(  90), -INT8_C( 123), -INT8_C( 114), -INT8_C(  37),  INT8_C(  19) },
+      {  INT8_C(  78),  INT8_C(  79), -INT8_C(  84), -INT8_C( 125),      INT8_MIN, -INT8_C(  15), -INT8_C(  59),  INT8_C( 100),
+        -INT8_C(  57), -INT8_C(  21), -INT8_C( 118), -INT8_C(  60),  INT8_C(  96),  INT8_C(  78), -INT8_C(  89), -INT8_C( 105) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  41), -INT8_C( 105), -INT8_C(  94), -INT8_C(  76), -INT8_C(  46), -INT8_C(  44), -INT8_C(  54), -INT8_C( 108),
+         INT8_C(  25),  INT8_C( 113),  INT8_C( 122),  INT8_C(  34), -INT8_C(  81),  INT8_C(  37),  INT8_C(  39), -INT8_C(  33) },
+      { -INT8_C( 122),  INT8_C(  15),  INT8_C(  25),  INT8_C( 114),  INT8_C( 105),  INT8_C(  48),  INT8_C(  63),  INT8_C(  14),
+        -INT8_C(  77),  INT8_C( 117),  INT8_C( 115), -INT8_C(  79), -INT8_C(  68),  INT8_C(  24),  INT8_C(  35),  INT8_C(  21) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(  27),  INT8_C(  77),  INT8_C(  13), -INT8_C( 101), -INT8_C(  72),  INT8_C(   9), -INT8_C( 126), -INT8_C(  84),
+        -INT8_C(  47),  INT8_C(  89), -INT8_C( 100), -INT8_C(   6),  INT8_C(  24), -INT8_C(  46),  INT8_C(   4), -INT8_C(  45) },
+      {  INT8_C(  96), -INT8_C(  96),  INT8_C( 123),  INT8_C(  64),  INT8_C(  90), -INT8_C(  42), -INT8_C(  33),  INT8_C( 103),
+        -INT8_C( 114),      INT8_MAX,  INT8_C(  48),  INT8_C(  98), -INT8_C(  88), -INT8_C(   3),  INT8_C( 101), -INT8_C( 115) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  37),  INT8_C( 108), -INT8_C(  23), -INT8_C( 103),  INT8_C(  94),  INT8_C(   9), -INT8_C( 100),  INT8_C(  67),
+         INT8_C( 117), -INT8_C( 116),  INT8_C(  78), -INT8_C(  59),  INT8_C(  90), -INT8_C(  70),  INT8_C( 106), -INT8_C(  94) },
+      { -INT8_C(  10),  INT8_C(   3), -INT8_C( 117),  INT8_C(  38),  INT8_C(  10), -INT8_C(  25),  INT8_C(  84),  INT8_C(  27),
+        -INT8_C( 126), -INT8_C( 105), -INT8_C(  37),  INT8_C(  17), -INT8_C(  61), -INT8_C(   7),  INT8_C(  86),  INT8_C(   5) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  58),  INT8_C( 126), -INT8_C(  96), -INT8_C( 125), -INT8_C( 105),  INT8_C( 104),  INT8_C(  51),  INT8_C( 103),
+         INT8_C(  25),  INT8_C(  48),      INT8_MIN,  INT8_C( 116), -INT8_C(  23), -INT8_C(  89), -INT8_C(  69), -INT8_C(  92) },
+      {  INT8_C(  20),  INT8_C(   2), -INT8_C(  12),  INT8_C(  13), -INT8_C(  24), -INT8_C( 118),  INT8_C(  59), -INT8_C( 123),
+         INT8_C( 121), -INT8_C(  53), -INT8_C(  61), -INT8_C(   4), -INT8_C(  64), -INT8_C(  33), -INT8_C( 111), -INT8_C(  46) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  57), -INT8_C(  15),  INT8_C( 126), -INT8_C(  16), -INT8_C(  69), -INT8_C(   8), -INT8_C( 124), -INT8_C(  66),
+         INT8_C(  24),  INT8_C(  92),  INT8_C(  65),  INT8_C(  93), -INT8_C(   1),  INT8_C(  89), -INT8_C(  50), -INT8_C(  91) },
+      { -INT8_C(  65), -INT8_C(  15), -INT8_C(  42), -INT8_C(   6),  INT8_C( 115), -INT8_C(  76), -INT8_C(  64),  INT8_C( 105),
+        -INT8_C(  49),  INT8_C(   5),  INT8_C(  81), -INT8_C(  16), -INT8_C( 102),  INT8_C(  78), -INT8_C(  89), -INT8_C(  85) },
+      {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(  10),  INT8_C(   7), -INT8_C(  41),  INT8_C(  49), -INT8_C(  52), -INT8_C( 123),  INT8_C(  18), -INT8_C(  47),
+        -INT8_C( 125), -INT8_C(  29), -INT8_C(  35),  INT8_C(   2), -INT8_C(  56),  INT8_C(  64),  INT8_C(  86), -INT8_C(  53) },
+      {  INT8_C(  18), -INT8_C(  27),  INT8_C(  57),  INT8_C(   6),  INT8_C(  81),  INT8_C(  66),  INT8_C(  85),  INT8_C(  78),
+         INT8_C(  34),  INT8_C(  30), -INT8_C(  51),  INT8_C(  31),  INT8_C( 103),  INT8_C(  59),  INT8_C(  43),  INT8_C(  55) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_ceq_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_ceq_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ceq_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 26171),  INT16_C( 32176),  INT16_C( 32337), -INT16_C( 13838),  INT16_C( 13043),  INT16_C( 12140),  INT16_C(  4308), -INT16_C( 15726) },
+      {  INT16_C(  9607), -INT16_C( 11806),  INT16_C(  5835), -INT16_C( 16525),  INT16_C(  1851),  INT16_C( 11210), -INT16_C( 24912), -INT16_C( 20017) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C( 22918),  INT16_C( 27682), -INT16_C( 15753),  INT16_C( 14450), -INT16_C( 14099),  INT16_C(  3474), -INT16_C(  6169),  INT16_C( 25267) },
+      { -INT16_C( 25203),  INT16_C(  8099),  INT16_C(  1976),  INT16_C(  7574), -INT16_C( 15320),  INT16_C( 32251),  INT16_C( 25627), -INT16_C( 10477) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C( 17366), -INT16_C( 12373),  INT16_C(  1779),  INT16_C( 16865),  INT16_C( 20669), -INT16_C( 27806),  INT16_C( 25883), -INT16_C( 28715) },
+      {  INT16_C( 10850),  INT16_C( 15815),  INT16_C( 31848),  INT16_C( 17124), -INT16_C( 29573),  INT16_C( 25102), -INT16_C( 20123),  INT16_C( 11438) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C(  7197),  INT16_C( 17635), -INT16_C( 22919), -INT16_C( 26699),  INT16_C(  3813),  INT16_C(  7314),  INT16_C( 22115), -INT16_C( 22561) },
+      {  INT16_C( 26927), -INT16_C( 30688),  INT16_C( 26922),  INT16_C( 32470), -INT16_C(  5035), -INT16_C( 13240),  INT16_C(  9169), -INT16_C(  5170) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C( 27218), -INT16_C( 19463),  INT16_C( 26844),  INT16_C( 23488), -INT16_C( 20669), -INT16_C( 13699),  INT16_C( 11215), -INT16_C( 13420) },
+      {  INT16_C( 32664), -INT16_C(  6599), -INT16_C(  7993), -INT16_C( 24195), -INT16_C( 22031),  INT16_C( 15300), -INT16_C( 29130),  INT16_C( 31613) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C( 11631), -INT16_C( 12962), -INT16_C( 28528),  INT16_C(  1794), -INT16_C(  5393), -INT16_C( 30616), -INT16_C( 31927), -INT16_C( 16884) },
+      { -INT16_C(  4634),  INT16_C( 26326), -INT16_C( 15549), -INT16_C( 22633), -INT16_C(  6202), -INT16_C(  8166),  INT16_C( 30552), -INT16_C( 20034) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C( 23727), -INT16_C(  5996),  INT16_C(  4166),  INT16_C( 19781), -INT16_C( 26097),  INT16_C( 17804),  INT16_C(  6001),  INT16_C( 29370) },
+      {  INT16_C( 27205),  INT16_C( 14745), -INT16_C(   565),  INT16_C( 15058), -INT16_C( 21628), -INT16_C(  3498),  INT16_C( 22825), -INT16_C( 25237) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C( 29307), -INT16_C(  6326),  INT16_C( 19361),  INT16_C( 10729),  INT16_C(  1063), -INT16_C( 12084), -INT16_C( 15690), -INT16_C( 25896) },
+      {  INT16_C( 11172),  INT16_C( 28794),  INT16_C( 14933),  INT16_C( 32706),  INT16_C( 27051), -INT16_C( 17591), -INT16_C( 16581),  INT16_C(  1960) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_ceq_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_ceq_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ceq_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   162025490), -INT32_C(  1304386967), -INT32_C(  1896832982),  INT32_C(  1864015403) },
+      { -INT32_C(  1656332331), -INT32_C(  1820007289), -INT32_C(   252730088), -INT32_C(   468804706) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1395929337), -INT32_C(  1349885966),  INT32_C(  1136866523), -INT32_C(  1194629406) },
+      {  INT32_C(  1077602210),  INT32_C(  1042769636),  INT32_C(   207998026),  INT32_C(  1052533280) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(   347321544), -INT32_C(  1260288699), -INT32_C(   709612905),  INT32_C(  1915963739) },
+      { -INT32_C(   234625190), -INT32_C(   820931513), -INT32_C(  1468469732), -INT32_C(   736426524) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1840946188),  INT32_C(  1970383321), -INT32_C(   727221244),  INT32_C(   115277147) },
+      {  INT32_C(  1728928878), -INT32_C(  1525476808),  INT32_C(  1494043655),  INT32_C(  1350399934) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1805000691),  INT32_C(   100012578),  INT32_C(  1038461096),  INT32_C(  2094271654) },
+      { -INT32_C(  1078657423), -INT32_C(  1111251096), -INT32_C(   687755184),  INT32_C(   359779504) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1459416742),  INT32_C(    56197525), -INT32_C(  1038781425), -INT32_C(  1271643198) },
+      { -INT32_C(  1603652909), -INT32_C(  1245842885), -INT32_C(  2113432561), -INT32_C(  1274673496) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1511389288),  INT32_C(  1117703349), -INT32_C(  1817324887),  INT32_C(  2125986087) },
+      { -INT32_C(  1588145860), -INT32_C(   403628692),  INT32_C(   578439373), -INT32_C(   980453929) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  2123687731), -INT32_C(  1265806843),  INT32_C(   980366251),  INT32_C(  2008144855) },
+      { -INT32_C(   209733661), -INT32_C(    34875756),  INT32_C(   884997253),  INT32_C(   399698937) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_ceq_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_ceq_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ceq_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 8099322100377360552), -INT64_C( 8459858754876434804) },
+      { -INT64_C( 8071859269732271347), -INT64_C( 5440587875114856894) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C( 2273002078412335617),  INT64_C( 1007093930693581764) },
+      { -INT64_C( 2871806005442336260), -INT64_C(   20233084938358707) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 8869010652411800320),  INT64_C( 3303762287754134149) },
+      {  INT64_C( 6460311593617468960), -INT64_C( 7182967221816891044) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C(  676765899069761780), -INT64_C( 8155396155837391075) },
+      { -INT64_C( 7686092528914108581),  INT64_C( 8799901589652285802) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 3386857099260292729), -INT64_C( 3082445434761258584) },
+      { -INT64_C( 2249470501927648989), -INT64_C( 7662183882657718904) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C( 4363026551304786876), -INT64_C( 5767573525632281396) },
+      {  INT64_C(  642431666455801670), -INT64_C( 1509390232260390659) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 1337532864499440887), -INT64_C( 3925870497441169503) },
+      { -INT64_C( 6449504050049716271),  INT64_C( 1365683047548557896) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 1421018059582567211), -INT64_C( 7788408712042124925) },
+      { -INT64_C( 7293439669148038217),  INT64_C(  681279745187103385) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_ceq_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_ceq_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(ceq_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(ceq_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(ceq_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(ceq_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,529 @@
+#define SIMDE_TEST_MIPS_MSA_INSN clt
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/clt.h"
+
+static int
+test_simde_clt_s_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(   7),  INT8_C(  15), -INT8_C(  46),  INT8_C( 115),  INT8_C(  88), -INT8_C( 113),  INT8_C(   7),  INT8_C( 120),
+         INT8_C(  66), -INT8_C(  93), -INT8_C(  49), -INT8_C(  40),  INT8_C( 112),  INT8_C(   3), -INT8_C(  80), -INT8_C(  65) },
+      {  INT8_C(  85),  INT8_C(  65), -INT8_C(   3),  INT8_C( 106),  INT8_C(  82),  INT8_C(  55),  INT8_C(  58), -INT8_C(   5),
+        -INT8_C(  35),  INT8_C(  76),  INT8_C( 112), -INT8_C(  93),  INT8_C(  81),  INT8_C( 116), -INT8_C(  93), -INT8_C(  30) },
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) } },
+    { {  INT8_C(  35),  INT8_C(  77), -INT8_C( 106),  INT8_C( 106), -INT8_C( 101),  INT8_C(  37),  INT8_C(  40),  INT8_C( 120),
+         INT8_C(  81),  INT8_C(  35),  INT8_C(  92), -INT8_C(   7),  INT8_C(  82),  INT8_C(  42),  INT8_C( 118),  INT8_C(  13) },
+      { -INT8_C(  17), -INT8_C(  74), -INT8_C(  48),  INT8_C(  39),  INT8_C(  40),  INT8_C(  97),  INT8_C(   1),  INT8_C(  22),
+         INT8_C(  31),  INT8_C(  57),  INT8_C(   1), -INT8_C(  40), -INT8_C(  46),  INT8_C( 100), -INT8_C(   8),  INT8_C( 107) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) } },
+    { {  INT8_C(  56),  INT8_C( 122), -INT8_C(  65),  INT8_C(  63), -INT8_C(  13), -INT8_C(  72), -INT8_C(  90), -INT8_C(  11),
+        -INT8_C(  97), -INT8_C(  21),  INT8_C(  53), -INT8_C(  84), -INT8_C( 121),  INT8_C(  44), -INT8_C(  25), -INT8_C(  29) },
+      {  INT8_C(  44), -INT8_C(  50),  INT8_C(   4), -INT8_C( 125),  INT8_C(  60), -INT8_C(  77), -INT8_C(  66), -INT8_C(  76),
+        -INT8_C(  17),  INT8_C(  99),  INT8_C(  99), -INT8_C(  61),  INT8_C(  87),  INT8_C(  22),  INT8_C( 104), -INT8_C(  55) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) } },
+    { { -INT8_C(   8),  INT8_C(  37), -INT8_C( 113),  INT8_C(  67),  INT8_C(  74), -INT8_C( 106),  INT8_C(  22), -INT8_C(  91),
+        -INT8_C(  71), -INT8_C(  25), -INT8_C(  68), -INT8_C(  90),  INT8_C(  78), -INT8_C(  87),  INT8_C(  14), -INT8_C(  97) },
+      { -INT8_C(  25), -INT8_C(  30),  INT8_C(  93),  INT8_C( 114),  INT8_C( 124),  INT8_C(  52),  INT8_C(  52), -INT8_C(  60),
+         INT8_C(  23), -INT8_C(   2),  INT8_C(  71), -INT8_C(  45),  INT8_C( 101),  INT8_C(  78),  INT8_C(  44), -INT8_C( 101) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0) } },
+    { {  INT8_C( 122), -INT8_C(  43),  INT8_C(  61), -INT8_C(  55), -INT8_C(  95),  INT8_C(  65), -INT8_C( 110),  INT8_C(   8),
+        -INT8_C(  87),  INT8_C( 115), -INT8_C(  92), -INT8_C(  76), -INT8_C(  62), -INT8_C(  32),  INT8_C(  93), -INT8_C(  85) },
+      { -INT8_C(   4), -INT8_C(  19),  INT8_C( 101), -INT8_C(  97), -INT8_C(  47), -INT8_C(  22), -INT8_C( 125), -INT8_C(  29),
+        -INT8_C( 103),  INT8_C(  75),  INT8_C(   2),  INT8_C( 101),  INT8_C(  21),  INT8_C(  17),  INT8_C(  90),  INT8_C(  30) },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) } },
+    { { -INT8_C(  22),  INT8_C(  58),  INT8_C( 125),  INT8_C(  52), -INT8_C(  82), -INT8_C(  26),  INT8_C(  67),  INT8_C(  36),
+         INT8_C( 105),  INT8_C(  59),  INT8_C( 116),  INT8_C(  62),  INT8_C(  33),  INT8_C(  24),  INT8_C(  82),  INT8_C( 104) },
+      { -INT8_C(  95),  INT8_C(   4),  INT8_C(  87),  INT8_C(  15),  INT8_C( 114), -INT8_C(  50),  INT8_C(  34), -INT8_C(  92),
+         INT8_C( 120), -INT8_C(  87),  INT8_C(  71),  INT8_C(  32), -INT8_C(  45), -INT8_C(  79),  INT8_C(  69), -INT8_C( 104) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C( 117),  INT8_C(  80), -INT8_C( 114), -INT8_C(  21),  INT8_C(  77),  INT8_C(  49), -INT8_C( 114), -INT8_C(  56),
+        -INT8_C(  61), -INT8_C(  56), -INT8_C(   1), -INT8_C(  15), -INT8_C(  34), -INT8_C(  19), -INT8_C( 112), -INT8_C(  82) },
+      {  INT8_C( 105), -INT8_C(   8), -INT8_C(  51), -INT8_C( 119), -INT8_C( 109), -INT8_C(   8),  INT8_C(  64),  INT8_C(  75),
+        -INT8_C(  74), -INT8_C(   2),  INT8_C(  70),  INT8_C(  84),  INT8_C(  12), -INT8_C(  19), -INT8_C(  21),  INT8_C( 107) },
+      { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1) } },
+    { { -INT8_C( 115),  INT8_C(  36),  INT8_C(  18), -INT8_C(   1), -INT8_C( 114), -INT8_C( 117),  INT8_C( 107), -INT8_C(  26),
+         INT8_C(  32),  INT8_C(  30),  INT8_C(  26), -INT8_C( 120), -INT8_C( 122),  INT8_C(  89),  INT8_C(  47), -INT8_C(  74) },
+      {  INT8_C(  55), -INT8_C(   4), -INT8_C( 119),  INT8_C(  36), -INT8_C(  77),  INT8_C( 114), -INT8_C(  92),  INT8_C(  97),
+        -INT8_C(  45),  INT8_C( 120),  INT8_C( 114),  INT8_C(  20), -INT8_C(  70), -INT8_C(  92), -INT8_C(  36), -INT8_C(   5) },
+      { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_clt_s_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_clt_s_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_clt_s_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 26217),  INT16_C( 27389),  INT16_C(  2299),  INT16_C( 21951), -INT16_C( 11651),  INT16_C(   425),  INT16_C( 24050), -INT16_C( 10889) },
+      { -INT16_C(  5349), -INT16_C(  5233),  INT16_C( 17553),  INT16_C(  1865), -INT16_C( 24536), -INT16_C( 22172), -INT16_C( 16954), -INT16_C( 23273) },
+      { -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C( 11346),  INT16_C( 27887), -INT16_C(  4128), -INT16_C( 30673),  INT16_C(  2409),  INT16_C( 30524),  INT16_C( 31376),  INT16_C(  8780) },
+      { -INT16_C(  8050), -INT16_C( 27244), -INT16_C(  9101),  INT16_C( 19339),  INT16_C( 32437),  INT16_C( 16848), -INT16_C( 15674), -INT16_C( 20859) },
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C(  8401), -INT16_C(  1886), -INT16_C( 22745),  INT16_C( 27231),  INT16_C( 24377), -INT16_C( 20760),  INT16_C(  2335),  INT16_C( 29365) },
+      { -INT16_C( 26957), -INT16_C( 16110),  INT16_C(  4380), -INT16_C(  2091),  INT16_C( 12640), -INT16_C( 18585),  INT16_C( 28864), -INT16_C(  8041) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) } },
+    { {  INT16_C(  4266),  INT16_C( 17451),  INT16_C(   729),  INT16_C(  8483), -INT16_C( 30725),  INT16_C( 15504),  INT16_C( 19129),  INT16_C( 18553) },
+      { -INT16_C(  1935),  INT16_C(  9028),  INT16_C( 23881), -INT16_C( 16414),  INT16_C( 24886),  INT16_C( 31750), -INT16_C(  6812),  INT16_C(   885) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C( 12862), -INT16_C( 24688),  INT16_C(  7253),  INT16_C( 13634),  INT16_C( 26143), -INT16_C( 28343),  INT16_C( 26520),  INT16_C( 13807) },
+      { -INT16_C( 26070),  INT16_C( 14688),  INT16_C(  4663),  INT16_C( 21712),  INT16_C( 12830), -INT16_C( 21392), -INT16_C(   591),  INT16_C( 14778) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1) } },
+    { { -INT16_C(  1002),  INT16_C(  2392), -INT16_C( 14377), -INT16_C( 17612),  INT16_C( 21563),  INT16_C( 14463),  INT16_C( 15174),  INT16_C( 19182) },
+      { -INT16_C( 11522), -INT16_C( 23622),  INT16_C( 10569),  INT16_C( 13852),  INT16_C( 16929), -INT16_C( 25988),  INT16_C( 31002),  INT16_C( 22978) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1) } },
+    { {  INT16_C( 14112),  INT16_C( 13947), -INT16_C( 19944), -INT16_C( 11993),  INT16_C( 29495), -INT16_C( 19669),  INT16_C( 22165), -INT16_C( 27918) },
+      { -INT16_C( 16964),  INT16_C(   326),  INT16_C( 22266),  INT16_C(  3328),  INT16_C(   835),  INT16_C( 12845), -INT16_C( 26548),  INT16_C( 17748) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1) } },
+    { { -INT16_C( 27539), -INT16_C( 28364),  INT16_C(  7524),  INT16_C( 22164),  INT16_C( 26692), -INT16_C( 15720), -INT16_C( 10305), -INT16_C( 20355) },
+      { -INT16_C( 20140),  INT16_C(  4761),  INT16_C( 16395), -INT16_C( 17072),  INT16_C(  7022), -INT16_C(  4961),  INT16_C( 26839), -INT16_C( 25954) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_clt_s_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_clt_s_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_clt_s_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1774846222),  INT32_C(   929179491), -INT32_C(   143347477),  INT32_C(   874964700) },
+      { -INT32_C(   498823078), -INT32_C(   601289088), -INT32_C(  2064507824),  INT32_C(   437592458) },
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1605835578),  INT32_C(   591771037),  INT32_C(  1438820988),  INT32_C(   138136176) },
+      {  INT32_C(  1359847149), -INT32_C(  1652517651),  INT32_C(  1167217421),  INT32_C(   686793627) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1) } },
+    { {  INT32_C(   277728419), -INT32_C(  1056576980), -INT32_C(   271638722),  INT32_C(   656194088) },
+      { -INT32_C(  2008596194),  INT32_C(   735253170), -INT32_C(  1308844640), -INT32_C(    44639925) },
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(   352279851),  INT32_C(  1506510228),  INT32_C(  1333874108), -INT32_C(  1699415713) },
+      {  INT32_C(  1139816032),  INT32_C(   216026560),  INT32_C(   137436705), -INT32_C(  2033931173) },
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(   415615528),  INT32_C(    16078345), -INT32_C(  2049662616),  INT32_C(   303783221) },
+      { -INT32_C(  1009222509),  INT32_C(  2004246195),  INT32_C(   553076403), -INT32_C(   295277159) },
+      {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) } },
+    { {  INT32_C(   663413151),  INT32_C(   676405614),  INT32_C(   889344537),  INT32_C(  1427179665) },
+      { -INT32_C(  1284941074),  INT32_C(   427799876),  INT32_C(   698529164),  INT32_C(   148671466) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   325815723),  INT32_C(   542735746), -INT32_C(  1196905923),  INT32_C(  1734934422) },
+      {  INT32_C(   257666174),  INT32_C(  1330127757),  INT32_C(  1465242830),  INT32_C(   910197591) },
+      {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) } },
+    { {  INT32_C(   746420115), -INT32_C(     1641665), -INT32_C(   100049515),  INT32_C(  1540296236) },
+      {  INT32_C(  1792138388),  INT32_C(  1622083950), -INT32_C(    61264950),  INT32_C(   193293987) },
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_clt_s_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_clt_s_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_clt_s_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(  135322660272817185), -INT64_C( 2327876243784014686) },
+      { -INT64_C( 1819110400495800749),  INT64_C( 6255439465706477372) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+    { {  INT64_C( 2724919168017029610), -INT64_C( 5001032610128712086) },
+      {  INT64_C( 2547674231814238696), -INT64_C( 4386508076901597926) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+    { {  INT64_C(  519965300684901777),  INT64_C( 6027617674461699022) },
+      {  INT64_C( 6648049805120120494), -INT64_C( 5250240125144293412) },
+      { -INT64_C(                   1),  INT64_C(                   0) } },
+    { {  INT64_C(  643629557051699731), -INT64_C( 3614402734421924041) },
+      { -INT64_C( 6936303187171931795), -INT64_C( 6346963682009213741) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 5619028874485289566), -INT64_C( 3335980509057590522) },
+      { -INT64_C( 8795060716576869286),  INT64_C( 2974333902445068821) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+    { {  INT64_C(  167497766105924350), -INT64_C( 6976236828493571315) },
+      {  INT64_C( 4512857559638072774), -INT64_C( 2170276781997411995) },
+      { -INT64_C(                   1), -INT64_C(                   1) } },
+    { { -INT64_C( 6607348484238147883),  INT64_C( 4650782139539044990) },
+      { -INT64_C( 5924587162786333367),  INT64_C( 8224388545409100740) },
+      { -INT64_C(                   1), -INT64_C(                   1) } },
+    { {  INT64_C( 1391816630098559875), -INT64_C( 4487565120916084161) },
+      { -INT64_C( 5445870999638424922),  INT64_C( 6475148179062293677) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_clt_s_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_clt_s_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_clt_u_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { UINT8_C( 36), UINT8_C(196), UINT8_C( 95), UINT8_C(135), UINT8_C(140), UINT8_C(174), UINT8_C(  1), UINT8_C(231),
+        UINT8_C(211), UINT8_C(196), UINT8_C(206), UINT8_C(222), UINT8_C(223), UINT8_C(239), UINT8_C( 92), UINT8_C(146) },
+      { UINT8_C(201), UINT8_C(142), UINT8_C(232), UINT8_C( 84), UINT8_C(249), UINT8_C(131), UINT8_C(205), UINT8_C( 67),
+        UINT8_C( 90), UINT8_C(146), UINT8_C(140), UINT8_C(145), UINT8_C(113), UINT8_C( 91), UINT8_C( 80), UINT8_C(135) },
+      { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { UINT8_C( 94), UINT8_C(243), UINT8_C( 44), UINT8_C(107), UINT8_C( 37), UINT8_C(214), UINT8_C(130), UINT8_C(236),
+        UINT8_C( 30), UINT8_C( 11), UINT8_C( 45), UINT8_C(154), UINT8_C( 88), UINT8_C(158), UINT8_C(233), UINT8_C(245) },
+      { UINT8_C( 44), UINT8_C(123), UINT8_C(247), UINT8_C(  8), UINT8_C(170), UINT8_C( 91), UINT8_C( 98), UINT8_C(250),
+        UINT8_C( 97), UINT8_C(127), UINT8_C( 33), UINT8_C(137), UINT8_C(105), UINT8_C(179), UINT8_C( 87), UINT8_C(108) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0) } },
+    { { UINT8_C( 46), UINT8_C(164), UINT8_C(144), UINT8_C(230), UINT8_C(182), UINT8_C(153), UINT8_C(187), UINT8_C(199),
+        UINT8_C(188), UINT8_C( 87), UINT8_C( 36), UINT8_C(183), UINT8_C(109), UINT8_C( 86), UINT8_C(195), UINT8_C(143) },
+      { UINT8_C(241), UINT8_C( 69), UINT8_C( 53), UINT8_C(175), UINT8_C(168), UINT8_C(184), UINT8_C(211), UINT8_C(211),
+        UINT8_C( 22), UINT8_C(215), UINT8_C(123), UINT8_C(215), UINT8_C(246), UINT8_C( 60), UINT8_C(217), UINT8_C( 28) },
+      { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) } },
+    { { UINT8_C(121), UINT8_C( 36), UINT8_C(174), UINT8_C(170), UINT8_C(126), UINT8_C(190), UINT8_C( 29), UINT8_C(183),
+        UINT8_C( 76), UINT8_C(196), UINT8_C(226), UINT8_C(233), UINT8_C( 68), UINT8_C(186), UINT8_C(  6), UINT8_C( 79) },
+      { UINT8_C(238), UINT8_C( 13), UINT8_C(191), UINT8_C(175), UINT8_C( 40), UINT8_C( 89), UINT8_C(140), UINT8_C(  4),
+        UINT8_C( 78), UINT8_C( 16), UINT8_C( 17), UINT8_C( 44), UINT8_C( 98), UINT8_C(146), UINT8_C(200), UINT8_C(211) },
+      { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1) } },
+    { { UINT8_C(150), UINT8_C( 39), UINT8_C( 50), UINT8_C(246), UINT8_C(166), UINT8_C(185), UINT8_C( 33), UINT8_C(246),
+        UINT8_C( 40), UINT8_C( 30), UINT8_C(185), UINT8_C(218), UINT8_C(235), UINT8_C( 16), UINT8_C(176), UINT8_C(242) },
+      { UINT8_C( 82), UINT8_C( 77), UINT8_C(118), UINT8_C(170), UINT8_C(155), UINT8_C( 40), UINT8_C(148), UINT8_C(118),
+        UINT8_C( 66), UINT8_C(212), UINT8_C(  7), UINT8_C( 46), UINT8_C( 18), UINT8_C( 89), UINT8_C(151), UINT8_C(112) },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0) } },
+    { { UINT8_C(102), UINT8_C(118), UINT8_C( 70), UINT8_C( 92), UINT8_C( 87), UINT8_C(212), UINT8_C( 55), UINT8_C(218),
+        UINT8_C(245), UINT8_C(181), UINT8_C(216), UINT8_C(182), UINT8_C( 54), UINT8_C( 38), UINT8_C( 82), UINT8_C(101) },
+      { UINT8_C(173), UINT8_C( 75), UINT8_C( 74), UINT8_C(197), UINT8_C(104), UINT8_C( 77), UINT8_C(179), UINT8_C(250),
+        UINT8_C(  5), UINT8_C(138), UINT8_C(105), UINT8_C( 24), UINT8_C(125), UINT8_C(123), UINT8_C(  0), UINT8_C(183) },
+      { -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) } },
+    { { UINT8_C(134), UINT8_C( 56), UINT8_C( 62), UINT8_C(253), UINT8_C(214), UINT8_C( 55), UINT8_C(166), UINT8_C(156),
+        UINT8_C( 47), UINT8_C(225), UINT8_C( 72), UINT8_C(231), UINT8_C(222), UINT8_C( 25), UINT8_C(103), UINT8_C( 12) },
+      { UINT8_C(  8), UINT8_C(136), UINT8_C(136), UINT8_C(237), UINT8_C(250), UINT8_C(248), UINT8_C(124), UINT8_C( 94),
+        UINT8_C( 44), UINT8_C(179), UINT8_C(239), UINT8_C(145), UINT8_C( 77), UINT8_C( 41), UINT8_C( 94), UINT8_C(109) },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) } },
+    { { UINT8_C(250), UINT8_C(236), UINT8_C(159), UINT8_C(165), UINT8_C( 90), UINT8_C( 20), UINT8_C(124), UINT8_C(174),
+        UINT8_C(  5), UINT8_C( 16), UINT8_C(104), UINT8_C(195), UINT8_C( 66), UINT8_C(152), UINT8_C(227), UINT8_C(154) },
+      { UINT8_C(142), UINT8_C(179), UINT8_C( 68), UINT8_C(142), UINT8_C(131), UINT8_C( 11), UINT8_C(139), UINT8_C(203),
+        UINT8_C( 40), UINT8_C( 42), UINT8_C( 81), UINT8_C(133), UINT8_C(180), UINT8_C(118), UINT8_C(102), UINT8_C(179) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16u8 a = simde_x_msa_ld_u_b(test_vec[i].a, 0);
+    simde_v16u8 b = simde_x_msa_ld_u_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_clt_u_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16u8 a = simde_test_msa_v16u8_random();
+    simde_v16u8 b = simde_test_msa_v16u8_random();
+    simde_v16i8 r = simde_msa_clt_u_b(a, b);
+
+    simde_test_msa_v16u8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16u8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_clt_u_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { UINT16_C(35622), UINT16_C(62492), UINT16_C(23591), UINT16_C(35504), UINT16_C( 8463), UINT16_C(49477), UINT16_C( 9495), UINT16_C( 7104) },
+      { UINT16_C( 4632), UINT16_C(27645), UINT16_C(35702), UINT16_C(64878), UINT16_C(54156), UINT16_C( 6156), UINT16_C(  562), UINT16_C(13205) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1) } },
+    { { UINT16_C(63691), UINT16_C(15619), UINT16_C(48480), UINT16_C(14670), UINT16_C(56319), UINT16_C(13761), UINT16_C(18074), UINT16_C(15654) },
+      { UINT16_C( 8530), UINT16_C(46873), UINT16_C(46603), UINT16_C(13062), UINT16_C(26870), UINT16_C(10389), UINT16_C(44227), UINT16_C(19826) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1) } },
+    { { UINT16_C(13865), UINT16_C(46861), UINT16_C(50626), UINT16_C(33977), UINT16_C(31634), UINT16_C( 9545), UINT16_C(28960), UINT16_C(39163) },
+      { UINT16_C(24684), UINT16_C(17694), UINT16_C(45311), UINT16_C(61894), UINT16_C( 5686), UINT16_C(65362), UINT16_C(41401), UINT16_C(32224) },
+      { -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) } },
+    { { UINT16_C(19185), UINT16_C(48058), UINT16_C(53331), UINT16_C(50113), UINT16_C(59041), UINT16_C(54713), UINT16_C( 1033), UINT16_C(38855) },
+      { UINT16_C(30013), UINT16_C(46715), UINT16_C(61261), UINT16_C(19919), UINT16_C(34851), UINT16_C(  436), UINT16_C(64221), UINT16_C(26470) },
+      { -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) } },
+    { { UINT16_C(46099), UINT16_C(58330), UINT16_C(30314), UINT16_C(34384), UINT16_C(11600), UINT16_C(48107), UINT16_C(12797), UINT16_C(58651) },
+      { UINT16_C( 8827), UINT16_C(61145), UINT16_C(25583), UINT16_C(62220), UINT16_C(56975), UINT16_C(32555), UINT16_C(47345), UINT16_C(11285) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) } },
+    { { UINT16_C(61693), UINT16_C(34205), UINT16_C(34102), UINT16_C(46371), UINT16_C(55127), UINT16_C(32696), UINT16_C( 7091), UINT16_C(41464) },
+      { UINT16_C(61427), UINT16_C( 2819), UINT16_C(13711), UINT16_C( 2164), UINT16_C(34357), UINT16_C(18335), UINT16_C(59654), UINT16_C(20801) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) } },
+    { { UINT16_C(27205), UINT16_C(59483), UINT16_C(52457), UINT16_C(56692), UINT16_C(61510), UINT16_C(59551), UINT16_C(52460), UINT16_C(62379) },
+      { UINT16_C(32757), UINT16_C(62116), UINT16_C(55444), UINT16_C(47783), UINT16_C(13683), UINT16_C(27125), UINT16_C(36462), UINT16_C(20784) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { UINT16_C(63337), UINT16_C(21209), UINT16_C(15478), UINT16_C(13586), UINT16_C(56471), UINT16_C(22578), UINT16_C(63954), UINT16_C(34017) },
+      { UINT16_C(23398), UINT16_C(29888), UINT16_C(56577), UINT16_C(55892), UINT16_C(20995), UINT16_C(23590), UINT16_C(21858), UINT16_C(52253) },
+      {  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8u16 a = simde_x_msa_ld_u_h(test_vec[i].a, 0);
+    simde_v8u16 b = simde_x_msa_ld_u_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_clt_u_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8u16 a = simde_test_msa_v8u16_random();
+    simde_v8u16 b = simde_test_msa_v8u16_random();
+    simde_v8i16 r = simde_msa_clt_u_h(a, b);
+
+    simde_test_msa_v8u16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8u16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_clt_u_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1220872595), UINT32_C( 515056598), UINT32_C( 311223525), UINT32_C(2238627658) },
+      { UINT32_C(4141986050), UINT32_C( 868593605), UINT32_C( 559334942), UINT32_C(   6836027) },
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) } },
+    { { UINT32_C( 471653411), UINT32_C(1355573886), UINT32_C( 916181344), UINT32_C(3841636819) },
+      { UINT32_C( 238179819), UINT32_C(3470838567), UINT32_C(2496360468), UINT32_C( 695624492) },
+      {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) } },
+    { { UINT32_C(2335625736), UINT32_C( 566310029), UINT32_C(3258420298), UINT32_C(4048782802) },
+      { UINT32_C( 924092101), UINT32_C(3822873738), UINT32_C(1325268742), UINT32_C(1919535269) },
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { { UINT32_C(2682704942), UINT32_C(3230700167), UINT32_C(1373813075), UINT32_C(1869369490) },
+      { UINT32_C( 761415037), UINT32_C(1123804396), UINT32_C(2210713032), UINT32_C(1190913468) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) } },
+    { { UINT32_C(3529850956), UINT32_C(1899491221), UINT32_C(4240393178), UINT32_C(2479913154) },
+      { UINT32_C(1724345293), UINT32_C(2992851515), UINT32_C(3059626974), UINT32_C(3149855462) },
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) } },
+    { { UINT32_C( 988636776), UINT32_C(1131647067), UINT32_C(4021952017), UINT32_C( 553742156) },
+      { UINT32_C(2914848515), UINT32_C( 754185457), UINT32_C(1786534106), UINT32_C(1739622190) },
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1) } },
+    { { UINT32_C(2217262019), UINT32_C(1670881849), UINT32_C(1506496850), UINT32_C( 987479914) },
+      { UINT32_C( 384532984), UINT32_C(2920853413), UINT32_C(  96856477), UINT32_C(4153337661) },
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) } },
+    { { UINT32_C(4014241217), UINT32_C(3222454823), UINT32_C(2677427403), UINT32_C(1993653554) },
+      { UINT32_C(1169686342), UINT32_C(1087113038), UINT32_C(3545415224), UINT32_C(3257214872) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4u32 a = simde_x_msa_ld_u_w(test_vec[i].a, 0);
+    simde_v4u32 b = simde_x_msa_ld_u_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_clt_u_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4u32 a = simde_test_msa_v4u32_random();
+    simde_v4u32 b = simde_test_msa_v4u32_random();
+    simde_v4i32 r = simde_msa_clt_u_w(a, b);
+
+    simde_test_msa_v4u32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4u32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_clt_u_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t a[2];
+    uint64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(17106205477509089908), UINT64_C( 2211741969334666201) },
+      { UINT64_C(14426832785543456838), UINT64_C(16584082933531663139) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+    { { UINT64_C(11014260829456692692), UINT64_C( 8045751003888698612) },
+      { UINT64_C( 5670047849303259479), UINT64_C(16151553823531642359) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+    { { UINT64_C( 8722229049072027397), UINT64_C(10420049491839800425) },
+      { UINT64_C( 6513003466688157900), UINT64_C(12057242500866323118) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+    { { UINT64_C( 5209786775995364450), UINT64_C( 6691328416373147092) },
+      { UINT64_C(12269417515167361559), UINT64_C(  272944866403533356) },
+      { -INT64_C(                   1),  INT64_C(                   0) } },
+    { { UINT64_C( 2142653526782690749), UINT64_C(10160046472879203874) },
+      { UINT64_C( 7327362093219974753), UINT64_C( 1156075718347716656) },
+      { -INT64_C(                   1),  INT64_C(                   0) } },
+    { { UINT64_C(13462405659563769717), UINT64_C(13352941305257514746) },
+      { UINT64_C( 8991489912921650971), UINT64_C( 5792908735713562901) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { UINT64_C( 2441049970974741768), UINT64_C(12188701051888890876) },
+      { UINT64_C( 4363098447204007102), UINT64_C( 9346251767737122154) },
+      { -INT64_C(                   1),  INT64_C(                   0) } },
+    { { UINT64_C(10982787070215307953), UINT64_C( 1073256129680005297) },
+      { UINT64_C( 2763367398639696186), UINT64_C( 3878412779787725422) },
+      {  INT64_C(                   0), -INT64_C(                   1) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2u64 a = simde_x_msa_ld_u_d(test_vec[i].a, 0);
+    simde_v2u64 b = simde_x_msa_ld_u_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_clt_u_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2u64 a = simde_test_msa_v2u64_random();
+    simde_v2u64 b = simde_test_msa_v2u64_random();
+    simde_v2i64 r = simde_msa_clt_u_d(a, b);
+
+    simde_test_msa_v2u64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2u64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_s_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_s_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_s_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_s_d)
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_u_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_u_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_u_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(clt_u_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,395 @@
+#define SIMDE_TEST_MIPS_MSA_INSN dotp
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/dotp.h"
+
+static int
+test_simde_dotp_s_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT8_C(  87),  INT8_C(   4), -INT8_C(  86), -INT8_C( 105),  INT8_C( 125), -INT8_C(   5), -INT8_C(  16), -INT8_C(  15),
+         INT8_C( 122),  INT8_C(  94),  INT8_C(  84), -INT8_C( 115),  INT8_C(  27), -INT8_C( 102),  INT8_C(  36),  INT8_C(  45) },
+      {  INT8_C(  90), -INT8_C(  94), -INT8_C(  40), -INT8_C(  37),  INT8_C( 102),  INT8_C(  29),  INT8_C(  31),  INT8_C(  30),
+         INT8_C(  82),  INT8_C(  84),  INT8_C(  47),  INT8_C(  40), -INT8_C( 125), -INT8_C(  98),  INT8_C(  59), -INT8_C( 102) },
+      {  INT16_C(  7454),  INT16_C(  7325),  INT16_C( 12605), -INT16_C(   946),  INT16_C( 17900), -INT16_C(   652),  INT16_C(  6621), -INT16_C(  2466) } },
+    { { -INT8_C(  15), -INT8_C( 104),  INT8_C(  61), -INT8_C(  20),  INT8_C( 117), -INT8_C(  10),  INT8_C(  22), -INT8_C(  20),
+         INT8_C(  61), -INT8_C( 123),  INT8_C( 103),  INT8_C(  62), -INT8_C(  47), -INT8_C(  79),  INT8_C(  87), -INT8_C(  91) },
+      { -INT8_C(  19), -INT8_C(  16), -INT8_C(  57),  INT8_C(  23),  INT8_C(  46), -INT8_C(   8),  INT8_C(  20),  INT8_C(  77),
+        -INT8_C(  67),  INT8_C(  75), -INT8_C(  17), -INT8_C(  64), -INT8_C(  33),  INT8_C( 102), -INT8_C(  25), -INT8_C(   9) },
+      {  INT16_C(  1949), -INT16_C(  3937),  INT16_C(  5462), -INT16_C(  1100), -INT16_C( 13312), -INT16_C(  5719), -INT16_C(  6507), -INT16_C(  1356) } },
+    { { -INT8_C(  30),  INT8_C(  83),  INT8_C(  81),  INT8_C(  84), -INT8_C( 116),  INT8_C(  25),  INT8_C(  71), -INT8_C(  98),
+        -INT8_C(  61),  INT8_C( 109), -INT8_C(  67),  INT8_C( 104),  INT8_C(  92),  INT8_C(  84),  INT8_C(  40),  INT8_C( 126) },
+      {  INT8_C(  57),  INT8_C(  13), -INT8_C(   3),  INT8_C(  55), -INT8_C(  45), -INT8_C(  91), -INT8_C(   8),  INT8_C(  61),
+        -INT8_C(  53), -INT8_C(  89), -INT8_C(  48), -INT8_C(  22), -INT8_C(  81),  INT8_C(  74), -INT8_C(  25),  INT8_C(  69) },
+      { -INT16_C(   631),  INT16_C(  4377),  INT16_C(  2945), -INT16_C(  6546), -INT16_C(  6468),  INT16_C(   928), -INT16_C(  1236),  INT16_C(  7694) } },
+    { { -INT8_C(  81), -INT8_C(  23),  INT8_C(  63), -INT8_C(  28), -INT8_C(  49), -INT8_C(  63), -INT8_C(   7), -INT8_C(  33),
+         INT8_C(  98), -INT8_C( 117), -INT8_C(  54),  INT8_C(  42), -INT8_C(  69),  INT8_C(  56),  INT8_C(  78), -INT8_C( 126) },
+      {  INT8_C(  35),  INT8_C( 106), -INT8_C(  31), -INT8_C(  27),  INT8_C(  57), -INT8_C(  31), -INT8_C(  48), -INT8_C( 107),
+         INT8_C(  13), -INT8_C(  25),  INT8_C(  73), -INT8_C(  60),  INT8_C( 121),  INT8_C(  21), -INT8_C(  45), -INT8_C(   8) },
+      { -INT16_C(  5273), -INT16_C(  1197), -INT16_C(   840),  INT16_C(  3867),  INT16_C(  4199), -INT16_C(  6462), -INT16_C(  7173), -INT16_C(  2502) } },
+    { { -INT8_C(  39),  INT8_C(  26), -INT8_C(  14),  INT8_C(   3), -INT8_C(  33), -INT8_C(  50), -INT8_C(  84),  INT8_C(  28),
+         INT8_C(  49),  INT8_C(  19),  INT8_C(   5), -INT8_C(  36),  INT8_C(  75), -INT8_C(  31),  INT8_C(  91), -INT8_C( 111) },
+      {  INT8_C( 118),  INT8_C(  19), -INT8_C(  80),  INT8_C(  34),  INT8_C(  91),  INT8_C(  75),  INT8_C(  78), -INT8_C(  55),
+        -INT8_C(  63),  INT8_C( 100),  INT8_C(  73), -INT8_C( 114),  INT8_C(  88), -INT8_C( 114),  INT8_C(  68),  INT8_C(  43) },
+      { -INT16_C(  4108),  INT16_C(  1222), -INT16_C(  6753), -INT16_C(  8092), -INT16_C(  1187),  INT16_C(  4469),  INT16_C( 10134),  INT16_C(  1415) } },
+    { { -INT8_C( 100),  INT8_C( 101),  INT8_C(   8), -INT8_C(  89),  INT8_C(  55),  INT8_C(  49),  INT8_C(  41),  INT8_C(  70),
+         INT8_C(   4), -INT8_C( 104), -INT8_C(  66),  INT8_C(  76), -INT8_C( 104), -INT8_C(  51),  INT8_C(  39),  INT8_C( 105) },
+      {  INT8_C(  62),  INT8_C( 113),  INT8_C(  70), -INT8_C(  33),  INT8_C(  46), -INT8_C( 118),  INT8_C( 116), -INT8_C(  97),
+         INT8_C(  67), -INT8_C(  71),  INT8_C(  22),  INT8_C(  74), -INT8_C(  82), -INT8_C( 116),  INT8_C(  45),  INT8_C(  16) },
+      {  INT16_C(  5213),  INT16_C(  3497), -INT16_C(  3252), -INT16_C(  2034),  INT16_C(  7652),  INT16_C(  4172),  INT16_C( 14444),  INT16_C(  3435) } },
+    { {  INT8_C(  72),  INT8_C( 121), -INT8_C(  79),  INT8_C(  18), -INT8_C(  81), -INT8_C(  85),  INT8_C(  32),  INT8_C(   6),
+         INT8_C(  35), -INT8_C(  16),  INT8_C(  71),  INT8_C(  51), -INT8_C( 102),  INT8_C(   2), -INT8_C(  36),  INT8_C( 121) },
+      {  INT8_C( 103), -INT8_C( 100),  INT8_C(  40), -INT8_C(  23), -INT8_C(  27),  INT8_C(  92), -INT8_C( 105), -INT8_C( 113),
+         INT8_C( 100),  INT8_C(  83), -INT8_C(  89), -INT8_C(  13),  INT8_C(  54),  INT8_C(  79), -INT8_C(  78), -INT8_C(  88) },
+      { -INT16_C(  4684), -INT16_C(  3574), -INT16_C(  5633), -INT16_C(  4038),  INT16_C(  2172), -INT16_C(  6982), -INT16_C(  5350), -INT16_C(  7840) } },
+    { { -INT8_C(  41), -INT8_C(  68),  INT8_C( 118),  INT8_C(  35), -INT8_C(  39), -INT8_C(  59), -INT8_C(   6), -INT8_C(  49),
+        -INT8_C(  56), -INT8_C(  64), -INT8_C(  46),  INT8_C(   6),  INT8_C(  58),  INT8_C( 116), -INT8_C(  38), -INT8_C( 111) },
+      {  INT8_C(  60),  INT8_C(  34), -INT8_C(  10),  INT8_C(  94),  INT8_C(  19), -INT8_C(   4),  INT8_C(  25),  INT8_C(  55),
+        -INT8_C(  49), -INT8_C(  68),  INT8_C(  79), -INT8_C(  44), -INT8_C(  26),  INT8_C( 112),  INT8_C(  90), -INT8_C(   9) },
+      { -INT16_C(  4772),  INT16_C(  2110), -INT16_C(   505), -INT16_C(  2845),  INT16_C(  7096), -INT16_C(  3898),  INT16_C( 11484), -INT16_C(  2421) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_dotp_s_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v8i16 r = simde_msa_dotp_s_h(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_dotp_s_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT16_C(  8288), -INT16_C( 23367), -INT16_C( 19765), -INT16_C( 13812), -INT16_C(  5622),  INT16_C( 26061),  INT16_C( 10235), -INT16_C( 15524) },
+      { -INT16_C(  1930),  INT16_C( 14831), -INT16_C( 19299), -INT16_C( 18090), -INT16_C( 30176),  INT16_C(  4484), -INT16_C( 23302), -INT16_C( 26197) },
+      { -INT32_C(   362551817),  INT32_C(   631303815),  INT32_C(   286506996),  INT32_C(   168186258) } },
+    { { -INT16_C( 15771),  INT16_C( 32626),  INT16_C( 25811),  INT16_C( 31141), -INT16_C( 26038),  INT16_C( 10763),  INT16_C(  8236),  INT16_C( 24450) },
+      { -INT16_C( 32533),  INT16_C( 16748), -INT16_C( 25478),  INT16_C( 22168), -INT16_C( 13967), -INT16_C(  3685),  INT16_C( 11930), -INT16_C(  2467) },
+      {  INT32_C(  1059498191),  INT32_C(    32721030),  INT32_C(   324011091),  INT32_C(    37937330) } },
+    { {  INT16_C( 19272),  INT16_C( 27757), -INT16_C( 29854),  INT16_C( 31909), -INT16_C( 19562),  INT16_C( 26240), -INT16_C(  3159), -INT16_C( 29010) },
+      { -INT16_C( 11406), -INT16_C(  2142),  INT16_C(   163), -INT16_C( 24417),  INT16_C(  9132),  INT16_C( 29152), -INT16_C(  2290),  INT16_C( 22351) },
+      { -INT32_C(   279271926), -INT32_C(   783988255),  INT32_C(   586308296), -INT32_C(   641168400) } },
+    { {  INT16_C(  1113), -INT16_C( 22130), -INT16_C( 13411),  INT16_C( 17769),  INT16_C( 20771), -INT16_C( 19648),  INT16_C( 16726), -INT16_C( 31878) },
+      { -INT16_C( 16941), -INT16_C( 13747), -INT16_C( 30820),  INT16_C(  1737),  INT16_C( 30875),  INT16_C( 19813), -INT16_C(  7610),  INT16_C( 10268) },
+      {  INT32_C(   285365777),  INT32_C(   444191773),  INT32_C(   252018801), -INT32_C(   454608164) } },
+    { { -INT16_C( 18235), -INT16_C( 29737), -INT16_C( 11659), -INT16_C( 29792),  INT16_C( 19486), -INT16_C( 31737), -INT16_C( 26140),  INT16_C( 29790) },
+      { -INT16_C( 16303),  INT16_C( 10121), -INT16_C( 25946), -INT16_C( 16163), -INT16_C(   492), -INT16_C(   413), -INT16_C(  5393), -INT16_C( 24100) },
+      { -INT32_C(     3682972),  INT32_C(   784032510),  INT32_C(     3520269), -INT32_C(   576965980) } },
+    { {  INT16_C( 14167), -INT16_C( 13436), -INT16_C( 22816),  INT16_C( 28599),  INT16_C(  1951),  INT16_C( 27145), -INT16_C(  8880),  INT16_C(   972) },
+      { -INT16_C(  3899),  INT16_C(   204),  INT16_C( 25930), -INT16_C( 10131), -INT16_C( 16665),  INT16_C( 17225),  INT16_C( 16282),  INT16_C( 11231) },
+      { -INT32_C(    57978077), -INT32_C(   881355349),  INT32_C(   435059210), -INT32_C(   133667628) } },
+    { {  INT16_C(  7085), -INT16_C(  6868), -INT16_C( 15270),  INT16_C(  3929), -INT16_C( 25893),  INT16_C( 14447),  INT16_C(  8349), -INT16_C(  9962) },
+      {  INT16_C( 16527), -INT16_C( 13591),  INT16_C(  5430),  INT16_C( 17048),  INT16_C( 23953), -INT16_C( 29013),  INT16_C(  4060),  INT16_C( 26199) },
+      {  INT32_C(   210436783), -INT32_C(    15934508), -INT32_C(  1039365840), -INT32_C(   227097498) } },
+    { {  INT16_C( 24066),  INT16_C( 12683), -INT16_C( 29385), -INT16_C(  9381),  INT16_C( 25788), -INT16_C(  7771), -INT16_C(  3237), -INT16_C( 11222) },
+      {  INT16_C(   131),  INT16_C( 29358),  INT16_C( 22332), -INT16_C(  8830), -INT16_C( 29656),  INT16_C( 28906),  INT16_C( 30207), -INT16_C(  5270) },
+      {  INT32_C(   375500160), -INT32_C(   573391590), -INT32_C(   989397454), -INT32_C(    38640119) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_dotp_s_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v4i32 r = simde_msa_dotp_s_w(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_dotp_s_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT32_C(   614192091), -INT32_C(  1166492500), -INT32_C(   677929572), -INT32_C(   800680845) },
+      {  INT32_C(  1029910031),  INT32_C(   598154151),  INT32_C(   916448634), -INT32_C(  1595257107) },
+      { -INT64_C(   65179735503602679),  INT64_C(  656004178217410767) } },
+    { { -INT32_C(   105860782), -INT32_C(  1192428719),  INT32_C(  2060299080), -INT32_C(   349160772) },
+      {  INT32_C(   385189089), -INT32_C(  1348558614), -INT32_C(   358001668),  INT32_C(   515810328) },
+      {  INT64_C( 1567283602409027868), -INT64_C(  917691239548918656) } },
+    { { -INT32_C(  2089065581), -INT32_C(  2092198423), -INT32_C(   934497000),  INT32_C(  1643249205) },
+      { -INT32_C(  1927974642),  INT32_C(     4692061),  INT32_C(  1900796676),  INT32_C(  1554358853) },
+      {  INT64_C( 4017848743018177199),  INT64_C(  777910158144989865) } },
+    { { -INT32_C(  1299209050), -INT32_C(  1937833763),  INT32_C(  2134269539),  INT32_C(   641804872) },
+      {  INT32_C(   635243036), -INT32_C(  1848812683),  INT32_C(  1077374789), -INT32_C(  1857898150) },
+      {  INT64_C( 2757378137259340329),  INT64_C( 1107000109899465471) } },
+    { { -INT32_C(   668387283), -INT32_C(   225139213), -INT32_C(   379317628),  INT32_C(  1576340711) },
+      { -INT32_C(   869582936),  INT32_C(  1993656263), -INT32_C(  1091633489), -INT32_C(  1959130019) },
+      {  INT64_C(  132367973891861869), -INT64_C( 2674180581399059417) } },
+    { {  INT32_C(   957528877),  INT32_C(  1153270929),  INT32_C(  2013132358), -INT32_C(  1735728132) },
+      { -INT32_C(  1227401792),  INT32_C(   790362707), -INT32_C(   697581036),  INT32_C(  1222423127) },
+      { -INT64_C(  263770326172702781), -INT64_C( 3526117166640071652) } },
+    { {  INT32_C(   574530675),  INT32_C(  1947019348),  INT32_C(  1755027946), -INT32_C(   211100388) },
+      {  INT32_C(   136032803), -INT32_C(  1213379197), -INT32_C(  1829137618),  INT32_C(  1711725367) },
+      { -INT64_C( 2284317754889971531), -INT64_C( 3571533525793015024) } },
+    { {  INT32_C(  2014480696),  INT32_C(   333463500),  INT32_C(  1497223816), -INT32_C(  1625798957) },
+      {  INT32_C(   270104694),  INT32_C(   683730096),  INT32_C(  1565176887), -INT32_C(   722666230) },
+      {  INT64_C(  772119722829483024),  INT64_C( 3518330114462262902) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_dotp_s_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v2i64 r = simde_msa_dotp_s_d(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_dotp_u_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t a[16];
+    uint8_t b[16];
+    uint16_t r[8];
+  } test_vec[] = {
+    { { UINT8_C(242), UINT8_C(246), UINT8_C(169), UINT8_C(215), UINT8_C(208), UINT8_C(193), UINT8_C(227), UINT8_C(215),
+        UINT8_C( 25), UINT8_C(127), UINT8_C(102), UINT8_C( 58), UINT8_C(  0), UINT8_C( 54), UINT8_C(158), UINT8_C( 42) },
+      { UINT8_C(119), UINT8_C(173), UINT8_C(101), UINT8_C( 11), UINT8_C( 74), UINT8_C(125), UINT8_C( 37), UINT8_C(158),
+        UINT8_C(116), UINT8_C(175), UINT8_C( 88), UINT8_C( 93), UINT8_C(203), UINT8_C(196), UINT8_C(169), UINT8_C(226) },
+      { UINT16_C( 5820), UINT16_C(19434), UINT16_C(39517), UINT16_C(42369), UINT16_C(25125), UINT16_C(14370), UINT16_C(10584), UINT16_C(36194) } },
+    { { UINT8_C( 87), UINT8_C(204), UINT8_C(229), UINT8_C( 80), UINT8_C( 69), UINT8_C( 20), UINT8_C( 33), UINT8_C( 43),
+        UINT8_C(221), UINT8_C(106), UINT8_C( 43), UINT8_C( 50), UINT8_C(140), UINT8_C(247), UINT8_C(130), UINT8_C(138) },
+      { UINT8_C( 44), UINT8_C(143), UINT8_C(124), UINT8_C(219), UINT8_C(221), UINT8_C(150), UINT8_C(219), UINT8_C(160),
+        UINT8_C( 94), UINT8_C(176), UINT8_C(232), UINT8_C(112), UINT8_C(125), UINT8_C(106), UINT8_C(191), UINT8_C( 66) },
+      { UINT16_C(33000), UINT16_C(45916), UINT16_C(18249), UINT16_C(14107), UINT16_C(39430), UINT16_C(15576), UINT16_C(43682), UINT16_C(33938) } },
+    { { UINT8_C(253), UINT8_C( 71), UINT8_C(141), UINT8_C(221), UINT8_C(194), UINT8_C( 26), UINT8_C(206), UINT8_C(253),
+        UINT8_C(148), UINT8_C(164), UINT8_C(156), UINT8_C(  4), UINT8_C(156), UINT8_C(206), UINT8_C(212), UINT8_C( 72) },
+      { UINT8_C(140), UINT8_C(210), UINT8_C(148), UINT8_C(110), UINT8_C(  1), UINT8_C(164), UINT8_C(212), UINT8_C( 17),
+        UINT8_C(131), UINT8_C(142), UINT8_C( 66), UINT8_C(103), UINT8_C( 62), UINT8_C( 54), UINT8_C(154), UINT8_C(236) },
+      { UINT16_C(50330), UINT16_C(45178), UINT16_C( 4458), UINT16_C(47973), UINT16_C(42676), UINT16_C(10708), UINT16_C(20796), UINT16_C(49640) } },
+    { { UINT8_C(  5), UINT8_C( 33), UINT8_C(247), UINT8_C(217), UINT8_C( 85), UINT8_C(134), UINT8_C(212), UINT8_C(225),
+        UINT8_C( 43), UINT8_C( 36), UINT8_C(245), UINT8_C( 88), UINT8_C(225), UINT8_C(214), UINT8_C(165), UINT8_C(215) },
+      { UINT8_C(244), UINT8_C(130), UINT8_C(  2), UINT8_C(111), UINT8_C(123), UINT8_C( 10), UINT8_C(178), UINT8_C( 63),
+        UINT8_C(199), UINT8_C(150), UINT8_C( 92), UINT8_C(125), UINT8_C( 45), UINT8_C(196), UINT8_C( 64), UINT8_C(198) },
+      { UINT16_C( 5510), UINT16_C(24581), UINT16_C(11795), UINT16_C(51911), UINT16_C(13957), UINT16_C(33540), UINT16_C(52069), UINT16_C(53130) } },
+    { { UINT8_C(171), UINT8_C(203), UINT8_C( 78), UINT8_C(163), UINT8_C(123), UINT8_C(250), UINT8_C( 94), UINT8_C( 42),
+        UINT8_C(254), UINT8_C(234), UINT8_C(170), UINT8_C( 21), UINT8_C(107), UINT8_C(119), UINT8_C(198), UINT8_C( 89) },
+      { UINT8_C(194), UINT8_C(107), UINT8_C( 29), UINT8_C(214), UINT8_C( 15), UINT8_C(  9), UINT8_C(162), UINT8_C(241),
+        UINT8_C(206), UINT8_C(181), UINT8_C( 62), UINT8_C( 63), UINT8_C( 34), UINT8_C(230), UINT8_C( 28), UINT8_C( 49) },
+      { UINT16_C(54895), UINT16_C(37144), UINT16_C( 4095), UINT16_C(25350), UINT16_C(29142), UINT16_C(11863), UINT16_C(31008), UINT16_C( 9905) } },
+    { { UINT8_C( 98), UINT8_C(111), UINT8_C( 27), UINT8_C(166), UINT8_C(146), UINT8_C( 91), UINT8_C(  8), UINT8_C(124),
+        UINT8_C(142), UINT8_C( 82), UINT8_C( 96), UINT8_C( 82), UINT8_C( 50), UINT8_C(  8), UINT8_C(252), UINT8_C(102) },
+      { UINT8_C(  8), UINT8_C(240), UINT8_C( 31), UINT8_C(181), UINT8_C( 95), UINT8_C(111), UINT8_C(  6), UINT8_C(122),
+        UINT8_C( 16), UINT8_C(117), UINT8_C(226), UINT8_C(155), UINT8_C(133), UINT8_C( 76), UINT8_C( 87), UINT8_C(162) },
+      { UINT16_C(27424), UINT16_C(30883), UINT16_C(23971), UINT16_C(15176), UINT16_C(11866), UINT16_C(34406), UINT16_C( 7258), UINT16_C(38448) } },
+    { { UINT8_C(192), UINT8_C( 11), UINT8_C(199), UINT8_C( 39), UINT8_C(236), UINT8_C(128), UINT8_C(134), UINT8_C( 13),
+        UINT8_C(232), UINT8_C(119), UINT8_C( 94), UINT8_C( 58), UINT8_C( 39), UINT8_C(180), UINT8_C(123), UINT8_C(132) },
+      { UINT8_C( 80), UINT8_C(  4), UINT8_C(210), UINT8_C(220), UINT8_C(147), UINT8_C(164), UINT8_C(133), UINT8_C(228),
+        UINT8_C( 71), UINT8_C(206), UINT8_C(114), UINT8_C( 63), UINT8_C(100), UINT8_C(  6), UINT8_C( 71), UINT8_C(220) },
+      { UINT16_C(15404), UINT16_C(50370), UINT16_C(55684), UINT16_C(20786), UINT16_C(40986), UINT16_C(14370), UINT16_C( 4980), UINT16_C(37773) } },
+    { { UINT8_C(218), UINT8_C( 34), UINT8_C(111), UINT8_C(211), UINT8_C(  1), UINT8_C(234), UINT8_C(249), UINT8_C(176),
+        UINT8_C(195), UINT8_C( 10), UINT8_C(247), UINT8_C(244), UINT8_C(242), UINT8_C( 67), UINT8_C( 70), UINT8_C( 40) },
+      { UINT8_C(101), UINT8_C(122), UINT8_C(179), UINT8_C(124), UINT8_C(145), UINT8_C(167), UINT8_C( 36), UINT8_C(134),
+        UINT8_C(109), UINT8_C( 46), UINT8_C( 67), UINT8_C(239), UINT8_C(198),    UINT8_MAX, UINT8_C(249), UINT8_C(131) },
+      { UINT16_C(26166), UINT16_C(46033), UINT16_C(39223), UINT16_C(32548), UINT16_C(21715), UINT16_C( 9329), UINT16_C(65001), UINT16_C(22670) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16u8 a = simde_x_msa_ld_u_b(test_vec[i].a, 0);
+    simde_v16u8 b = simde_x_msa_ld_u_b(test_vec[i].b, 0);
+    simde_v8u16 r = simde_msa_dotp_u_h(a, b);
+
+    simde_test_msa_v8u16_assert_equal(r, simde_x_msa_ld_u_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16u8 a = simde_test_msa_v16u8_random();
+    simde_v16u8 b = simde_test_msa_v16u8_random();
+    simde_v8u16 r = simde_msa_dotp_u_h(a, b);
+
+    simde_test_msa_v16u8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16u8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8u16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_dotp_u_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t a[8];
+    uint16_t b[8];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT16_C(51199), UINT16_C(59413), UINT16_C(43661), UINT16_C(23360), UINT16_C(48384), UINT16_C(51960), UINT16_C(24430), UINT16_C(57554) },
+      { UINT16_C(29631), UINT16_C(20880), UINT16_C( 9357), UINT16_C(58701), UINT16_C(30992), UINT16_C(19911), UINT16_C(16786), UINT16_C(40155) },
+      { UINT32_C(2757621009), UINT32_C(1779791337), UINT32_C(2534092488), UINT32_C(2721162850) } },
+    { { UINT16_C(43999), UINT16_C(25576), UINT16_C(62010), UINT16_C(54967), UINT16_C( 2077), UINT16_C(44182), UINT16_C(51621), UINT16_C( 4359) },
+      { UINT16_C(18829), UINT16_C(  955), UINT16_C(38004), UINT16_C(39336), UINT16_C(22065), UINT16_C(35473), UINT16_C(48134), UINT16_C(60985) },
+      { UINT32_C( 852882251), UINT32_C( 223842656), UINT32_C(1613097091), UINT32_C(2750558829) } },
+    { { UINT16_C(13344), UINT16_C(54766), UINT16_C( 3809), UINT16_C(14264), UINT16_C(49084), UINT16_C(52769), UINT16_C(54519), UINT16_C(26620) },
+      { UINT16_C(63615), UINT16_C(50894), UINT16_C( 9906), UINT16_C(39121), UINT16_C(46193), UINT16_C(29913), UINT16_C(25319), UINT16_C(57594) },
+      { UINT32_C(3636139364), UINT32_C( 595753898), UINT32_C(3845816309), UINT32_C(2913518841) } },
+    { { UINT16_C(57327), UINT16_C(10514), UINT16_C(54680), UINT16_C( 3792), UINT16_C(60884), UINT16_C(10342), UINT16_C(63729), UINT16_C(60119) },
+      { UINT16_C( 2843), UINT16_C(32858), UINT16_C(55557), UINT16_C(23443), UINT16_C(44870), UINT16_C(18052), UINT16_C( 4855), UINT16_C(62262) },
+      { UINT32_C( 508449673), UINT32_C(3126752616), UINT32_C(2918558864), UINT32_C(4052533473) } },
+    { { UINT16_C(39123), UINT16_C(14171), UINT16_C( 3950), UINT16_C(37740), UINT16_C(55543), UINT16_C(21712), UINT16_C(29436), UINT16_C(46420) },
+      { UINT16_C(50191), UINT16_C(34814), UINT16_C(10938), UINT16_C(36234), UINT16_C(28448), UINT16_C(27149), UINT16_C(56797), UINT16_C(30291) },
+      { UINT32_C(2456971687), UINT32_C(1410676260), UINT32_C(2169546352), UINT32_C(3077984712) } },
+    { { UINT16_C(23002), UINT16_C(35571), UINT16_C( 5155), UINT16_C(37656), UINT16_C(31586), UINT16_C(28846), UINT16_C(41571), UINT16_C(59859) },
+      { UINT16_C(36059), UINT16_C(13367), UINT16_C(47109), UINT16_C(58904), UINT16_C(21868), UINT16_C(22918), UINT16_C(13514), UINT16_C(40135) },
+      { UINT32_C(1304906675), UINT32_C(2460935919), UINT32_C(1351815276), UINT32_C(2964231459) } },
+    { { UINT16_C(18275), UINT16_C(24462), UINT16_C(54834), UINT16_C(62052), UINT16_C(33729), UINT16_C( 7469), UINT16_C(10404), UINT16_C(45997) },
+      { UINT16_C(59416), UINT16_C(32791), UINT16_C( 6248), UINT16_C(45745), UINT16_C(35946), UINT16_C(56560), UINT16_C(15807), UINT16_C(21413) },
+      { UINT32_C(1887960842), UINT32_C(3181171572), UINT32_C(1634869274), UINT32_C(1149389789) } },
+    { { UINT16_C(24038), UINT16_C(35813), UINT16_C(48669), UINT16_C(12514), UINT16_C(13419), UINT16_C(41941), UINT16_C(65163), UINT16_C(26267) },
+      { UINT16_C(14035), UINT16_C(44052), UINT16_C(35363), UINT16_C(39385), UINT16_C(20470), UINT16_C(17744), UINT16_C(51869), UINT16_C(39022) },
+      { UINT32_C(1915007606), UINT32_C(2213945737), UINT32_C(1018888034), UINT32_C( 109963225) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8u16 a = simde_x_msa_ld_u_h(test_vec[i].a, 0);
+    simde_v8u16 b = simde_x_msa_ld_u_h(test_vec[i].b, 0);
+    simde_v4u32 r = simde_msa_dotp_u_w(a, b);
+
+    simde_test_msa_v4u32_assert_equal(r, simde_x_msa_ld_u_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8u16 a = simde_test_msa_v8u16_random();
+    simde_v8u16 b = simde_test_msa_v8u16_random();
+    simde_v4u32 r = simde_msa_dotp_u_w(a, b);
+
+    simde_test_msa_v8u16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8u16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4u32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_dotp_u_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t a[4];
+    uint32_t b[4];
+    uint64_t r[2];
+  } test_vec[] = {
+    { { UINT32_C(2068907172), UINT32_C(3010255931), UINT32_C(3772856086), UINT32_C(1791670278) },
+      { UINT32_C(1314358001), UINT32_C(2095412326), UINT32_C(2018289003), UINT32_C( 534484445) },
+      { UINT64_C( 9027012077076488678), UINT64_C( 8572333842435247968) } },
+    { { UINT32_C(1149413022), UINT32_C(3691864117), UINT32_C(3692527935), UINT32_C(3101671091) },
+      { UINT32_C(3522517301), UINT32_C(3173464199), UINT32_C(3807509115), UINT32_C(2061813321) },
+      { UINT64_C(15764825858861940905), UINT64_C( 2007656468979479120) } },
+    { { UINT32_C(1920556026), UINT32_C(3224996016), UINT32_C( 623070699), UINT32_C( 413007135) },
+      { UINT32_C(  26170800), UINT32_C(1001732258), UINT32_C(1097858927), UINT32_C(1414919934) },
+      { UINT64_C( 3280845028793924928), UINT64_C( 1268415757245009063) } },
+    { { UINT32_C( 294196478), UINT32_C(2480062600), UINT32_C(2859830880), UINT32_C( 723401261) },
+      { UINT32_C(4286635204), UINT32_C(3043841567), UINT32_C(2229873051), UINT32_C(3438909454) },
+      { UINT64_C( 8810030610129705712), UINT64_C( 8864771245218036374) } },
+    { { UINT32_C(1729445952), UINT32_C(1886667659), UINT32_C(1286797335), UINT32_C( 751551935) },
+      { UINT32_C(4224393543), UINT32_C(3629637713), UINT32_C(2763685760), UINT32_C(1930776732) },
+      { UINT64_C(14153780399600111803), UINT64_C( 5007382459733026020) } },
+    { { UINT32_C(3762431687), UINT32_C(1420897427), UINT32_C(2779874126), UINT32_C( 532775222) },
+      { UINT32_C( 348498162), UINT32_C(1801670398), UINT32_C(1843137521), UINT32_C(2642596820) },
+      { UINT64_C( 3871189360390325240), UINT64_C( 6531600412719675686) } },
+    { { UINT32_C(4127189290), UINT32_C(2623993693), UINT32_C(3838339288), UINT32_C(2031022982) },
+      { UINT32_C(4019668933), UINT32_C(3924615396), UINT32_C(3364072443), UINT32_C(1059453720) },
+      { UINT64_C( 8441356542468473382), UINT64_C(15064226279330433624) } },
+    { { UINT32_C(3027860808), UINT32_C( 697418572), UINT32_C(1036493299), UINT32_C( 394639526) },
+      { UINT32_C(3650811547), UINT32_C(3492589084), UINT32_C(4014396302), UINT32_C( 172066165) },
+      { UINT64_C(13489945692101218024), UINT64_C( 4228798976349618088) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4u32 a = simde_x_msa_ld_u_w(test_vec[i].a, 0);
+    simde_v4u32 b = simde_x_msa_ld_u_w(test_vec[i].b, 0);
+    simde_v2u64 r = simde_msa_dotp_u_d(a, b);
+
+    simde_test_msa_v2u64_assert_equal(r, simde_x_msa_ld_u_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4u32 a = simde_test_msa_v4u32_random();
+    simde_v4u32 b = simde_test_msa_v4u32_random();
+    simde_v2u64 r = simde_msa_dotp_u_d(a, b);
+
+    simde_test_msa_v4u32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4u32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2u64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(dotp_s_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(dotp_s_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(dotp_s_d)
+SIMDE_TEST_FUNC_LIST_ENTRY(dotp_u_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(dotp_u_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(dotp_u_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,127 @@
+#define SIMDE_TEST_MIPS_MSA_INSN fadd
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/fadd.h"
+
+static int
+test_simde_fadd_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   472.48), SIMDE_FLOAT32_C(  -336.46), SIMDE_FLOAT32_C(  -863.31), SIMDE_FLOAT32_C(   146.18) },
+      { SIMDE_FLOAT32_C(  -817.51), SIMDE_FLOAT32_C(  -606.10), SIMDE_FLOAT32_C(  -986.11), SIMDE_FLOAT32_C(  -471.62) },
+      { SIMDE_FLOAT32_C(  -345.03), SIMDE_FLOAT32_C(  -942.56), SIMDE_FLOAT32_C( -1849.42), SIMDE_FLOAT32_C(  -325.44) } },
+    { { SIMDE_FLOAT32_C(   675.57), SIMDE_FLOAT32_C(  -365.20), SIMDE_FLOAT32_C(    13.30), SIMDE_FLOAT32_C(   133.12) },
+      { SIMDE_FLOAT32_C(    -6.63), SIMDE_FLOAT32_C(  -123.76), SIMDE_FLOAT32_C(   583.60), SIMDE_FLOAT32_C(   907.65) },
+      { SIMDE_FLOAT32_C(   668.94), SIMDE_FLOAT32_C(  -488.96), SIMDE_FLOAT32_C(   596.90), SIMDE_FLOAT32_C(  1040.77) } },
+    { { SIMDE_FLOAT32_C(  -562.35), SIMDE_FLOAT32_C(  -723.82), SIMDE_FLOAT32_C(  -377.51), SIMDE_FLOAT32_C(  -650.75) },
+      { SIMDE_FLOAT32_C(   968.59), SIMDE_FLOAT32_C(   517.80), SIMDE_FLOAT32_C(   519.48), SIMDE_FLOAT32_C(    86.64) },
+      { SIMDE_FLOAT32_C(   406.24), SIMDE_FLOAT32_C(  -206.02), SIMDE_FLOAT32_C(   141.97), SIMDE_FLOAT32_C(  -564.11) } },
+    { { SIMDE_FLOAT32_C(  -880.36), SIMDE_FLOAT32_C(   835.97), SIMDE_FLOAT32_C(    14.08), SIMDE_FLOAT32_C(   113.92) },
+      { SIMDE_FLOAT32_C(  -984.01), SIMDE_FLOAT32_C(  -204.23), SIMDE_FLOAT32_C(  -448.81), SIMDE_FLOAT32_C(    92.13) },
+      { SIMDE_FLOAT32_C( -1864.37), SIMDE_FLOAT32_C(   631.74), SIMDE_FLOAT32_C(  -434.73), SIMDE_FLOAT32_C(   206.05) } },
+    { { SIMDE_FLOAT32_C(   228.13), SIMDE_FLOAT32_C(  -587.65), SIMDE_FLOAT32_C(   626.54), SIMDE_FLOAT32_C(   121.88) },
+      { SIMDE_FLOAT32_C(   814.78), SIMDE_FLOAT32_C(  -404.82), SIMDE_FLOAT32_C(   335.66), SIMDE_FLOAT32_C(    28.57) },
+      { SIMDE_FLOAT32_C(  1042.91), SIMDE_FLOAT32_C(  -992.47), SIMDE_FLOAT32_C(   962.20), SIMDE_FLOAT32_C(   150.45) } },
+    { { SIMDE_FLOAT32_C(  -722.48), SIMDE_FLOAT32_C(  -662.57), SIMDE_FLOAT32_C(  -530.21), SIMDE_FLOAT32_C(   267.57) },
+      { SIMDE_FLOAT32_C(  -223.82), SIMDE_FLOAT32_C(   778.56), SIMDE_FLOAT32_C(  -199.85), SIMDE_FLOAT32_C(  -303.57) },
+      { SIMDE_FLOAT32_C(  -946.30), SIMDE_FLOAT32_C(   115.99), SIMDE_FLOAT32_C(  -730.06), SIMDE_FLOAT32_C(   -36.00) } },
+    { { SIMDE_FLOAT32_C(   338.77), SIMDE_FLOAT32_C(   419.50), SIMDE_FLOAT32_C(   196.78), SIMDE_FLOAT32_C(   -64.19) },
+      { SIMDE_FLOAT32_C(   857.96), SIMDE_FLOAT32_C(  -590.30), SIMDE_FLOAT32_C(   259.12), SIMDE_FLOAT32_C(  -908.86) },
+      { SIMDE_FLOAT32_C(  1196.73), SIMDE_FLOAT32_C(  -170.80), SIMDE_FLOAT32_C(   455.90), SIMDE_FLOAT32_C(  -973.05) } },
+    { { SIMDE_FLOAT32_C(   802.09), SIMDE_FLOAT32_C(  -133.97), SIMDE_FLOAT32_C(  -320.01), SIMDE_FLOAT32_C(   335.13) },
+      { SIMDE_FLOAT32_C(   709.62), SIMDE_FLOAT32_C(   -28.14), SIMDE_FLOAT32_C(  -305.06), SIMDE_FLOAT32_C(  -868.10) },
+      { SIMDE_FLOAT32_C(  1511.71), SIMDE_FLOAT32_C(  -162.11), SIMDE_FLOAT32_C(  -625.07), SIMDE_FLOAT32_C(  -532.97) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4f32 a = simde_x_msa_fld_w(test_vec[i].a, 0);
+    simde_v4f32 b = simde_x_msa_fld_w(test_vec[i].b, 0);
+    simde_v4f32 r = simde_msa_fadd_w(a, b);
+
+    simde_test_msa_v4f32_assert_equal(r, simde_x_msa_fld_w(test_vec[i].r, 0), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4f32 a = simde_test_msa_v4f32_random(-SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_v4f32 b = simde_test_msa_v4f32_random(-SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_v4f32 r = simde_msa_fadd_w(a, b);
+
+    simde_test_msa_v4f32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4f32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4f32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_fadd_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -126.87), SIMDE_FLOAT64_C(  -972.16) },
+      { SIMDE_FLOAT64_C(   630.59), SIMDE_FLOAT64_C(   662.74) },
+      { SIMDE_FLOAT64_C(   503.72), SIMDE_FLOAT64_C(  -309.42) } },
+    { { SIMDE_FLOAT64_C(   822.52), SIMDE_FLOAT64_C(   719.50) },
+      { SIMDE_FLOAT64_C(   334.74), SIMDE_FLOAT64_C(   293.90) },
+      { SIMDE_FLOAT64_C(  1157.26), SIMDE_FLOAT64_C(  1013.40) } },
+    { { SIMDE_FLOAT64_C(   -85.22), SIMDE_FLOAT64_C(   304.83) },
+      { SIMDE_FLOAT64_C(  -893.94), SIMDE_FLOAT64_C(   710.11) },
+      { SIMDE_FLOAT64_C(  -979.16), SIMDE_FLOAT64_C(  1014.94) } },
+    { { SIMDE_FLOAT64_C(  -865.92), SIMDE_FLOAT64_C(  -393.24) },
+      { SIMDE_FLOAT64_C(  -123.49), SIMDE_FLOAT64_C(   132.95) },
+      { SIMDE_FLOAT64_C(  -989.41), SIMDE_FLOAT64_C(  -260.29) } },
+    { { SIMDE_FLOAT64_C(  -646.65), SIMDE_FLOAT64_C(  -333.75) },
+      { SIMDE_FLOAT64_C(   262.04), SIMDE_FLOAT64_C(  -699.20) },
+      { SIMDE_FLOAT64_C(  -384.61), SIMDE_FLOAT64_C( -1032.95) } },
+    { { SIMDE_FLOAT64_C(   622.95), SIMDE_FLOAT64_C(    32.02) },
+      { SIMDE_FLOAT64_C(   332.96), SIMDE_FLOAT64_C(   -68.88) },
+      { SIMDE_FLOAT64_C(   955.91), SIMDE_FLOAT64_C(   -36.86) } },
+    { { SIMDE_FLOAT64_C(  -561.65), SIMDE_FLOAT64_C(   105.31) },
+      { SIMDE_FLOAT64_C(  -837.35), SIMDE_FLOAT64_C(   863.87) },
+      { SIMDE_FLOAT64_C( -1399.00), SIMDE_FLOAT64_C(   969.18) } },
+    { { SIMDE_FLOAT64_C(   757.94), SIMDE_FLOAT64_C(   847.72) },
+      { SIMDE_FLOAT64_C(   435.37), SIMDE_FLOAT64_C(  -602.58) },
+      { SIMDE_FLOAT64_C(  1193.31), SIMDE_FLOAT64_C(   245.14) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2f64 a = simde_x_msa_fld_d(test_vec[i].a, 0);
+    simde_v2f64 b = simde_x_msa_fld_d(test_vec[i].b, 0);
+    simde_v2f64 r = simde_msa_fadd_d(a, b);
+
+    simde_test_msa_v2f64_assert_equal(r, simde_x_msa_fld_d(test_vec[i].r, 0), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2f64 a = simde_test_msa_v2f64_random(-SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_v2f64 b = simde_test_msa_v2f64_random(-SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_v2f64 r = simde_msa_fadd_d(a, b);
+
+    simde_test_msa_v2f64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2f64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2f64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(fadd_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(fadd_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
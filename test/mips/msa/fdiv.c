@@ -0,0 +1,127 @@
+#define SIMDE_TEST_MIPS_MSA_INSN fdiv
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/fdiv.h"
+
+static int
+test_simde_fdiv_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   699.15), SIMDE_FLOAT32_C(   616.02), SIMDE_FLOAT32_C(   -85.53), SIMDE_FLOAT32_C(   396.97) },
+      { SIMDE_FLOAT32_C(   500.23), SIMDE_FLOAT32_C(  -197.37), SIMDE_FLOAT32_C(   532.92), SIMDE_FLOAT32_C(   511.58) },
+      { SIMDE_FLOAT32_C(     1.40), SIMDE_FLOAT32_C(    -3.12), SIMDE_FLOAT32_C(    -0.16), SIMDE_FLOAT32_C(     0.78) } },
+    { { SIMDE_FLOAT32_C(    92.22), SIMDE_FLOAT32_C(   -21.38), SIMDE_FLOAT32_C(   583.65), SIMDE_FLOAT32_C(  -730.26) },
+      { SIMDE_FLOAT32_C(  -396.37), SIMDE_FLOAT32_C(  -139.42), SIMDE_FLOAT32_C(   977.33), SIMDE_FLOAT32_C(  -683.45) },
+      { SIMDE_FLOAT32_C(    -0.23), SIMDE_FLOAT32_C(     0.15), SIMDE_FLOAT32_C(     0.60), SIMDE_FLOAT32_C(     1.07) } },
+    { { SIMDE_FLOAT32_C(   -31.72), SIMDE_FLOAT32_C(  -817.16), SIMDE_FLOAT32_C(   715.96), SIMDE_FLOAT32_C(   289.85) },
+      { SIMDE_FLOAT32_C(   681.75), SIMDE_FLOAT32_C(   198.79), SIMDE_FLOAT32_C(   -33.91), SIMDE_FLOAT32_C(   384.01) },
+      { SIMDE_FLOAT32_C(    -0.05), SIMDE_FLOAT32_C(    -4.11), SIMDE_FLOAT32_C(   -21.11), SIMDE_FLOAT32_C(     0.75) } },
+    { { SIMDE_FLOAT32_C(   710.02), SIMDE_FLOAT32_C(  -691.72), SIMDE_FLOAT32_C(   548.33), SIMDE_FLOAT32_C(  -561.42) },
+      { SIMDE_FLOAT32_C(  -368.41), SIMDE_FLOAT32_C(  -942.35), SIMDE_FLOAT32_C(    37.43), SIMDE_FLOAT32_C(  -878.36) },
+      { SIMDE_FLOAT32_C(    -1.93), SIMDE_FLOAT32_C(     0.73), SIMDE_FLOAT32_C(    14.65), SIMDE_FLOAT32_C(     0.64) } },
+    { { SIMDE_FLOAT32_C(   100.83), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(   996.02), SIMDE_FLOAT32_C(   961.28) },
+      { SIMDE_FLOAT32_C(  -579.85), SIMDE_FLOAT32_C(   420.33), SIMDE_FLOAT32_C(   732.41), SIMDE_FLOAT32_C(   411.26) },
+      { SIMDE_FLOAT32_C(    -0.17), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.36), SIMDE_FLOAT32_C(     2.34) } },
+    { { SIMDE_FLOAT32_C(   614.46), SIMDE_FLOAT32_C(  -344.75), SIMDE_FLOAT32_C(  -378.27), SIMDE_FLOAT32_C(   490.29) },
+      { SIMDE_FLOAT32_C(   495.34), SIMDE_FLOAT32_C(  -620.56), SIMDE_FLOAT32_C(   892.78), SIMDE_FLOAT32_C(  -563.41) },
+      { SIMDE_FLOAT32_C(     1.24), SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(    -0.42), SIMDE_FLOAT32_C(    -0.87) } },
+    { { SIMDE_FLOAT32_C(  -425.01), SIMDE_FLOAT32_C(   -21.19), SIMDE_FLOAT32_C(  -278.69), SIMDE_FLOAT32_C(  -901.37) },
+      { SIMDE_FLOAT32_C(  -942.24), SIMDE_FLOAT32_C(  -539.31), SIMDE_FLOAT32_C(   -97.22), SIMDE_FLOAT32_C(   900.52) },
+      { SIMDE_FLOAT32_C(     0.45), SIMDE_FLOAT32_C(     0.04), SIMDE_FLOAT32_C(     2.87), SIMDE_FLOAT32_C(    -1.00) } },
+    { { SIMDE_FLOAT32_C(  -263.88), SIMDE_FLOAT32_C(    -7.70), SIMDE_FLOAT32_C(   991.93), SIMDE_FLOAT32_C(   484.15) },
+      { SIMDE_FLOAT32_C(   625.23), SIMDE_FLOAT32_C(  -937.04), SIMDE_FLOAT32_C(  -155.89), SIMDE_FLOAT32_C(  -540.88) },
+      { SIMDE_FLOAT32_C(    -0.42), SIMDE_FLOAT32_C(     0.01), SIMDE_FLOAT32_C(    -6.36), SIMDE_FLOAT32_C(    -0.90) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4f32 a = simde_x_msa_fld_w(test_vec[i].a, 0);
+    simde_v4f32 b = simde_x_msa_fld_w(test_vec[i].b, 0);
+    simde_v4f32 r = simde_msa_fdiv_w(a, b);
+
+    simde_test_msa_v4f32_assert_equal(r, simde_x_msa_fld_w(test_vec[i].r, 0), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4f32 a = simde_test_msa_v4f32_random(-SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_v4f32 b = simde_test_msa_v4f32_random(-SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_v4f32 r = simde_msa_fdiv_w(a, b);
+
+    simde_test_msa_v4f32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4f32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4f32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_fdiv_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   960.94), SIMDE_FLOAT64_C(   769.43) },
+      { SIMDE_FLOAT64_C(    26.31), SIMDE_FLOAT64_C(  -522.90) },
+      { SIMDE_FLOAT64_C(    36.52), SIMDE_FLOAT64_C(    -1.47) } },
+    { { SIMDE_FLOAT64_C(   460.23), SIMDE_FLOAT64_C(    14.75) },
+      { SIMDE_FLOAT64_C(    72.43), SIMDE_FLOAT64_C(  -117.93) },
+      { SIMDE_FLOAT64_C(     6.35), SIMDE_FLOAT64_C(    -0.13) } },
+    { { SIMDE_FLOAT64_C(   829.96), SIMDE_FLOAT64_C(  -195.19) },
+      { SIMDE_FLOAT64_C(   170.79), SIMDE_FLOAT64_C(   930.26) },
+      { SIMDE_FLOAT64_C(     4.86), SIMDE_FLOAT64_C(    -0.21) } },
+    { { SIMDE_FLOAT64_C(   128.98), SIMDE_FLOAT64_C(  -379.70) },
+      { SIMDE_FLOAT64_C(   552.02), SIMDE_FLOAT64_C(   792.95) },
+      { SIMDE_FLOAT64_C(     0.23), SIMDE_FLOAT64_C(    -0.48) } },
+    { { SIMDE_FLOAT64_C(   639.84), SIMDE_FLOAT64_C(   984.50) },
+      { SIMDE_FLOAT64_C(   662.88), SIMDE_FLOAT64_C(   627.10) },
+      { SIMDE_FLOAT64_C(     0.97), SIMDE_FLOAT64_C(     1.57) } },
+    { { SIMDE_FLOAT64_C(   598.59), SIMDE_FLOAT64_C(   628.46) },
+      { SIMDE_FLOAT64_C(  -180.13), SIMDE_FLOAT64_C(   811.95) },
+      { SIMDE_FLOAT64_C(    -3.32), SIMDE_FLOAT64_C(     0.77) } },
+    { { SIMDE_FLOAT64_C(  -198.74), SIMDE_FLOAT64_C(  -393.98) },
+      { SIMDE_FLOAT64_C(   938.70), SIMDE_FLOAT64_C(  -683.82) },
+      { SIMDE_FLOAT64_C(    -0.21), SIMDE_FLOAT64_C(     0.58) } },
+    { { SIMDE_FLOAT64_C(   839.78), SIMDE_FLOAT64_C(  -449.77) },
+      { SIMDE_FLOAT64_C(   597.62), SIMDE_FLOAT64_C(   417.96) },
+      { SIMDE_FLOAT64_C(     1.41), SIMDE_FLOAT64_C(    -1.08) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2f64 a = simde_x_msa_fld_d(test_vec[i].a, 0);
+    simde_v2f64 b = simde_x_msa_fld_d(test_vec[i].b, 0);
+    simde_v2f64 r = simde_msa_fdiv_d(a, b);
+
+    simde_test_msa_v2f64_assert_equal(r, simde_x_msa_fld_d(test_vec[i].r, 0), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2f64 a = simde_test_msa_v2f64_random(-SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_v2f64 b = simde_test_msa_v2f64_random(-SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_v2f64 r = simde_msa_fdiv_d(a, b);
+
+    simde_test_msa_v2f64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2f64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2f64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(fdiv_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(fdiv_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
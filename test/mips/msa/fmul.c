@@ -0,0 +1,127 @@
+#define SIMDE_TEST_MIPS_MSA_INSN fmul
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/fmul.h"
+
+static int
+test_simde_fmul_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -390.42), SIMDE_FLOAT32_C(   240.85), SIMDE_FLOAT32_C(  -904.97), SIMDE_FLOAT32_C(  -973.94) },
+      { SIMDE_FLOAT32_C(   -77.09), SIMDE_FLOAT32_C(  -536.00), SIMDE_FLOAT32_C(  -552.93), SIMDE_FLOAT32_C(   548.75) },
+      { SIMDE_FLOAT32_C( 30097.48), SIMDE_FLOAT32_C(-129095.60), SIMDE_FLOAT32_C(500385.03), SIMDE_FLOAT32_C(-534449.56) } },
+    { { SIMDE_FLOAT32_C(  -345.05), SIMDE_FLOAT32_C(   992.87), SIMDE_FLOAT32_C(  -313.79), SIMDE_FLOAT32_C(  -155.32) },
+      { SIMDE_FLOAT32_C(  -368.44), SIMDE_FLOAT32_C(  -568.84), SIMDE_FLOAT32_C(  -950.87), SIMDE_FLOAT32_C(     3.54) },
+      { SIMDE_FLOAT32_C(127130.22), SIMDE_FLOAT32_C(-564784.19), SIMDE_FLOAT32_C(298373.50), SIMDE_FLOAT32_C(  -549.83) } },
+    { { SIMDE_FLOAT32_C(   169.16), SIMDE_FLOAT32_C(   410.83), SIMDE_FLOAT32_C(   -94.24), SIMDE_FLOAT32_C(  -944.00) },
+      { SIMDE_FLOAT32_C(   591.15), SIMDE_FLOAT32_C(  -161.83), SIMDE_FLOAT32_C(   -84.83), SIMDE_FLOAT32_C(   580.43) },
+      { SIMDE_FLOAT32_C( 99998.94), SIMDE_FLOAT32_C(-66484.62), SIMDE_FLOAT32_C(  7994.38), SIMDE_FLOAT32_C(-547925.94) } },
+    { { SIMDE_FLOAT32_C(   824.65), SIMDE_FLOAT32_C(  -695.08), SIMDE_FLOAT32_C(  -487.85), SIMDE_FLOAT32_C(   853.80) },
+      { SIMDE_FLOAT32_C(   829.65), SIMDE_FLOAT32_C(   -67.29), SIMDE_FLOAT32_C(   591.47), SIMDE_FLOAT32_C(   986.85) },
+      { SIMDE_FLOAT32_C(684170.94), SIMDE_FLOAT32_C( 46771.93), SIMDE_FLOAT32_C(-288548.62), SIMDE_FLOAT32_C(842572.50) } },
+    { { SIMDE_FLOAT32_C(   807.41), SIMDE_FLOAT32_C(    52.06), SIMDE_FLOAT32_C(  -857.78), SIMDE_FLOAT32_C(   -25.89) },
+      { SIMDE_FLOAT32_C(  -998.63), SIMDE_FLOAT32_C(   -24.19), SIMDE_FLOAT32_C(    37.51), SIMDE_FLOAT32_C(  -913.15) },
+      { SIMDE_FLOAT32_C(-806303.81), SIMDE_FLOAT32_C( -1259.33), SIMDE_FLOAT32_C(-32175.33), SIMDE_FLOAT32_C( 23641.45) } },
+    { { SIMDE_FLOAT32_C(   184.96), SIMDE_FLOAT32_C(   990.53), SIMDE_FLOAT32_C(  -178.11), SIMDE_FLOAT32_C(  -257.72) },
+      { SIMDE_FLOAT32_C(   644.50), SIMDE_FLOAT32_C(  -204.06), SIMDE_FLOAT32_C(   238.49), SIMDE_FLOAT32_C(   -26.51) },
+      { SIMDE_FLOAT32_C(119206.73), SIMDE_FLOAT32_C(-202127.56), SIMDE_FLOAT32_C(-42477.45), SIMDE_FLOAT32_C(  6832.16) } },
+    { { SIMDE_FLOAT32_C(  -881.95), SIMDE_FLOAT32_C(   332.43), SIMDE_FLOAT32_C(  -678.85), SIMDE_FLOAT32_C(   122.94) },
+      { SIMDE_FLOAT32_C(   329.23), SIMDE_FLOAT32_C(  -501.75), SIMDE_FLOAT32_C(  -217.70), SIMDE_FLOAT32_C(   530.46) },
+      { SIMDE_FLOAT32_C(-290364.41), SIMDE_FLOAT32_C(-166796.75), SIMDE_FLOAT32_C(147785.64), SIMDE_FLOAT32_C( 65214.76) } },
+    { { SIMDE_FLOAT32_C(   293.46), SIMDE_FLOAT32_C(  -223.77), SIMDE_FLOAT32_C(   120.21), SIMDE_FLOAT32_C(   507.08) },
+      { SIMDE_FLOAT32_C(  -742.31), SIMDE_FLOAT32_C(  -655.52), SIMDE_FLOAT32_C(    95.74), SIMDE_FLOAT32_C(   420.71) },
+      { SIMDE_FLOAT32_C(-217838.28), SIMDE_FLOAT32_C(146685.72), SIMDE_FLOAT32_C( 11508.91), SIMDE_FLOAT32_C(213333.61) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4f32 a = simde_x_msa_fld_w(test_vec[i].a, 0);
+    simde_v4f32 b = simde_x_msa_fld_w(test_vec[i].b, 0);
+    simde_v4f32 r = simde_msa_fmul_w(a, b);
+
+    simde_test_msa_v4f32_assert_equal(r, simde_x_msa_fld_w(test_vec[i].r, 0), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4f32 a = simde_test_msa_v4f32_random(-SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_v4f32 b = simde_test_msa_v4f32_random(-SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0));
+    simde_v4f32 r = simde_msa_fmul_w(a, b);
+
+    simde_test_msa_v4f32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4f32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4f32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_fmul_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -824.92), SIMDE_FLOAT64_C(  -203.63) },
+      { SIMDE_FLOAT64_C(  -678.77), SIMDE_FLOAT64_C(  -298.59) },
+      { SIMDE_FLOAT64_C(559930.95), SIMDE_FLOAT64_C( 60801.88) } },
+    { { SIMDE_FLOAT64_C(  -551.85), SIMDE_FLOAT64_C(   377.22) },
+      { SIMDE_FLOAT64_C(  -723.73), SIMDE_FLOAT64_C(  -164.20) },
+      { SIMDE_FLOAT64_C(399390.40), SIMDE_FLOAT64_C(-61939.52) } },
+    { { SIMDE_FLOAT64_C(  -927.46), SIMDE_FLOAT64_C(   916.73) },
+      { SIMDE_FLOAT64_C(   614.55), SIMDE_FLOAT64_C(   548.09) },
+      { SIMDE_FLOAT64_C(-569970.54), SIMDE_FLOAT64_C(502450.55) } },
+    { { SIMDE_FLOAT64_C(   557.81), SIMDE_FLOAT64_C(   248.24) },
+      { SIMDE_FLOAT64_C(  -881.80), SIMDE_FLOAT64_C(   222.19) },
+      { SIMDE_FLOAT64_C(-491876.86), SIMDE_FLOAT64_C( 55156.45) } },
+    { { SIMDE_FLOAT64_C(   595.10), SIMDE_FLOAT64_C(   -21.93) },
+      { SIMDE_FLOAT64_C(  -726.41), SIMDE_FLOAT64_C(  -685.50) },
+      { SIMDE_FLOAT64_C(-432286.59), SIMDE_FLOAT64_C( 15033.01) } },
+    { { SIMDE_FLOAT64_C(   358.85), SIMDE_FLOAT64_C(  -958.71) },
+      { SIMDE_FLOAT64_C(   149.02), SIMDE_FLOAT64_C(   819.95) },
+      { SIMDE_FLOAT64_C( 53475.83), SIMDE_FLOAT64_C(-786094.26) } },
+    { { SIMDE_FLOAT64_C(   398.23), SIMDE_FLOAT64_C(  -844.70) },
+      { SIMDE_FLOAT64_C(   423.19), SIMDE_FLOAT64_C(   355.42) },
+      { SIMDE_FLOAT64_C(168526.95), SIMDE_FLOAT64_C(-300223.27) } },
+    { { SIMDE_FLOAT64_C(   849.88), SIMDE_FLOAT64_C(   980.22) },
+      { SIMDE_FLOAT64_C(   -92.69), SIMDE_FLOAT64_C(  -432.61) },
+      { SIMDE_FLOAT64_C(-78775.38), SIMDE_FLOAT64_C(-424052.97) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2f64 a = simde_x_msa_fld_d(test_vec[i].a, 0);
+    simde_v2f64 b = simde_x_msa_fld_d(test_vec[i].b, 0);
+    simde_v2f64 r = simde_msa_fmul_d(a, b);
+
+    simde_test_msa_v2f64_assert_equal(r, simde_x_msa_fld_d(test_vec[i].r, 0), 1);
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2f64 a = simde_test_msa_v2f64_random(-SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_v2f64 b = simde_test_msa_v2f64_random(-SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0));
+    simde_v2f64 r = simde_msa_fmul_d(a, b);
+
+    simde_test_msa_v2f64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2f64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2f64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(fmul_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(fmul_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN ilvl
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/ilvl.h"
+
+static int
+test_simde_ilvl_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(   4),  INT8_C(  45),  INT8_C(  22), -INT8_C( 112),  INT8_C( 123), -INT8_C(   8), -INT8_C(  95),  INT8_C(  15),
+        -INT8_C(  18), -INT8_C(  95), -INT8_C(  89),  INT8_C(  80), -INT8_C( 127), -INT8_C(  51),      INT8_MAX, -INT8_C(  52) },
+      { -INT8_C(  12),  INT8_C(  10),  INT8_C( 118), -INT8_C(  85),  INT8_C(  68), -INT8_C(  49),  INT8_C(  88),  INT8_C(  33),
+         INT8_C(  62),  INT8_C(  30),  INT8_C(   8), -INT8_C(  91),  INT8_C(  81), -INT8_C(  23),  INT8_C(   1), -INT8_C(  46) },
+      {  INT8_C(  62), -INT8_C(  18),  INT8_C(  30), -INT8_C(  95),  INT8_C(   8), -INT8_C(  89), -INT8_C(  91),  INT8_C(  80),
+         INT8_C(  81), -INT8_C( 127), -INT8_C(  23), -INT8_C(  51),  INT8_C(   1),      INT8_MAX, -INT8_C(  46), -INT8_C(  52) } },
+    { {  INT8_C( 116),  INT8_C(  22), -INT8_C(  79), -INT8_C(  41),  INT8_C( 108), -INT8_C( 116),  INT8_C( 116),  INT8_C( 112),
+        -INT8_C(  94),  INT8_C(  25), -INT8_C(  87), -INT8_C(  19), -INT8_C(  91), -INT8_C(  68),  INT8_C(  37),  INT8_C(  69) },
+      {  INT8_C(   0), -INT8_C(  12),  INT8_C(  42),  INT8_C(  20),  INT8_C(  23), -INT8_C( 113),  INT8_C(  24),  INT8_C(  43),
+         INT8_C( 110),  INT8_C(  11),  INT8_C( 100),  INT8_C(  72), -INT8_C( 119), -INT8_C(  16),  INT8_C(   3), -INT8_C(  82) },
+      {  INT8_C( 110), -INT8_C(  94),  INT8_C(  11),  INT8_C(  25),  INT8_C( 100), -INT8_C(  87),  INT8_C(  72), -INT8_C(  19),
+        -INT8_C( 119), -INT8_C(  91), -INT8_C(  16), -INT8_C(  68),  INT8_C(   3),  INT8_C(  37), -INT8_C(  82),  INT8_C(  69) } },
+    { { -INT8_C(  35), -INT8_C( 105),  INT8_C(  72),  INT8_C( 108), -INT8_C(  73),  INT8_C(  65), -INT8_C(  70), -INT8_C( 104),
+         INT8_C(  51),  INT8_C(  37), -INT8_C(  27), -INT8_C(  39), -INT8_C(  71), -INT8_C(  40),  INT8_C(  97), -INT8_C(  44) },
+      { -INT8_C( 113), -INT8_C( 117),  INT8_C(  63),  INT8_C(  39), -INT8_C(  89),  INT8_C(  28), -INT8_C(   3), -INT8_C(  31),
+         INT8_C(  82),  INT8_C(   1),  INT8_C( 121),  INT8_C(  31), -INT8_C(  14), -INT8_C(  23), -INT8_C(  46),  INT8_C( 114) },
+      {  INT8_C(  82),  INT8_C(  51),  INT8_C(   1),  INT8_C(  37),  INT8_C( 121), -INT8_C(  27),  INT8_C(  31), -INT8_C(  39),
+        -INT8_C(  14), -INT8_C(  71), -INT8_C(  23), -INT8_C(  40), -INT8_C(  46),  INT8_C(  97),  INT8_C( 114), -INT8_C(  44) } },
+    { { -INT8_C(  46),  INT8_C( 106), -INT8_C( 102), -INT8_C(  23),  INT8_C( 109), -INT8_C( 110), -INT8_C(  10), -INT8_C(  70),
+         INT8_C( 113), -INT8_C(  23),  INT8_C(  85),  INT8_C(  31), -INT8_C(  31),  INT8_C(  71), -INT8_C(  14), -INT8_C(  40) },
+      { -INT8_C(   2),  INT8_C(  45), -INT8_C(  86),  INT8_C(  79),  INT8_C(  83), -INT8_C(  43),  INT8_C(  76), -INT8_C(  11),
+         INT8_C(  18), -INT8_C(  85), -INT8_C(  38),  INT8_C(  32),  INT8_C(  13), -INT8_C(  29),  INT8_C( 125), -INT8_C( 114) },
+      {  INT8_C(  18),  INT8_C( 113), -INT8_C(  85), -INT8_C(  23), -INT8_C(  38),  INT8_C(  85),  INT8_C(  32),  INT8_C(  31),
+         INT8_C(  13), -INT8_C(  31), -INT8_C(  29),  INT8_C(  71),  INT8_C( 125), -INT8_C(  14), -INT8_C( 114), -INT8_C(  40) } },
+    { { -INT8_C(  81),  INT8_C(  92), -INT8_C( 114), -INT8_C(  24),  INT8_C(  62), -INT8_C(   3), -INT8_C(  15), -INT8_C(  66),
+        -INT8_C(  53), -INT8_C(  16),  INT8_C(  78),  INT8_C(  42), -INT8_C(  74),  INT8_C(  85), -INT8_C( 117), -INT8_C(  64) },
+      { -INT8_C(  61),  INT8_C(  72), -INT8_C(  33),  INT8_C(  46),  INT8_C(  78), -INT8_C(  75),  INT8_C(  84),  INT8_C(  51),
+         INT8_C(  43),      INT8_MAX,  INT8_C(  84), -INT8_C( 101), -INT8_C(  59),  INT8_C(  92), -INT8_C(  91), -INT8_C(   2) },
+      {  INT8_C(  43), -INT8_C(  53),      INT8_MAX, -INT8_C(  16),  INT8_C(  84),  INT8_C(  78), -INT8_C( 101),  INT8_C(  42),
+        -INT8_C(  59), -INT8_C(  74),  INT8_C(  92),  INT8_C(  85), -INT8_C(  91), -INT8_C( 117), -INT8_C(   2), -INT8_C(  64) } },
+    { { -INT8_C(  74), -INT8_C(  78), -INT8_C(  17), -INT8_C(   5),  INT8_C( 107), -INT8_C( 121),  INT8_C(  46), -INT8_C( 126),
+         INT8_C(  93), -INT8_C( 107),  INT8_C( 109),  INT8_C(  88),  INT8_C(  44), -INT8_C(  54),  INT8_C( 119),  INT8_C(  11) },
+      { -INT8_C(  57),      INT8_MIN, -INT8_C(  45),  INT8_C(  94), -INT8_C(  94), -INT8_C(  12), -INT8_C(  41), -INT8_C(  63),
+        -INT8_C(  51),  INT8_C( 118), -INT8_C( 112), -INT8_C(  26), -INT8_C(  84), -INT8_C(  95),  INT8_C(  84), -INT8_C(  68) },
+      { -INT8_C(  51),  INT8_C(  93),  INT8_C( 118), -INT8_C( 107), -INT8_C( 112),  INT8_C( 109), -INT8_C(  26),  INT8_C(  88),
+        -INT8_C(  84),  INT8_C(  44), -INT8_C(  95), -INT8_C(  54),  INT8_C(  84),  INT8_C( 119), -INT8_C(  68),  INT8_C(  11) } },
+    { { -INT8_C( 118), -INT8_C(  79), -INT8_C( 106),  INT8_C( 110),  INT8_C( 110), -INT8_C(  17),  INT8_C(  73),  INT8_C(  67),
+         INT8_C(  10),  INT8_C(  62), -INT8_C(  99),  INT8_C(  79), -INT8_C(  69), -INT8_C(  84), -INT8_C( 105),  INT8_C(  22) },
+      {  INT8_C(  55), -INT8_C(  79), -INT8_C(  98), -INT8_C( 115),  INT8_C(  16),  INT8_C(  52), -INT8_C(  62), -INT8_C( 125),
+         INT8_C( 100),  INT8_C(  78),  INT8_C(  27), -INT8_C( 104), -INT8_C(  46),  INT8_C(  76),  INT8_C(  75),  INT8_C( 109) },
+      {  INT8_C( 100),  INT8_C(  10),  INT8_C(  78),  INT8_C(  62),  INT8_C(  27), -INT8_C(  99), -INT8_C( 104),  INT8_C(  79),
+        -INT8_C(  46), -INT8_C(  69),  INT8_C(  76), -INT8_C(  84),  INT8_C(  75), -INT8_C( 105),  INT8_C( 109),  INT8_C(  22) } },
+    { { -INT8_C(  85), -INT8_C( 126), -INT8_C(  52), -INT8_C(  55), -INT8_C(  65),  INT8_C( 121), -INT8_C(  41), -INT8_C(  96),
+        -INT8_C(  78), -INT8_C( 118), -INT8_C( 107),  INT8_C( 116), -INT8_C(  10), -INT8_C(  92),  INT8_C(  23),  INT8_C(  26) },
+      { -INT8_C( 109), -INT8_C(  65), -INT8_C(  94),  INT8_C( 102),  INT8_C(  25),  INT8_C( 104), -INT8_C( 121),  INT8_C( 119),
+        -INT8_C(  27),  INT8_C(  23),  INT8_C(  23),  INT8_C(  53),  INT8_C( 117),  INT8_C(  33), -INT8_C(  42), -INT8_C(  66) },
+      { -INT8_C(  27), -INT8_C(  78),  INT8_C(  23), -INT8_C( 118),  INT8_C(  23), -INT8_C( 107),  INT8_C(  53),  INT8_C( 116),
+         INT8_C( 117), -INT8_C(  10),  INT8_C(  33), -INT8_C(  92), -INT8_C(  42),  INT8_C(  23), -INT8_C(  66),  INT8_C(  26) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_ilvl_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_ilvl_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ilvl_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 29768), -INT16_C(  8020),  INT16_C(  9682), -INT16_C( 19145), -INT16_C(  9770), -INT16_C(  4706),  INT16_C(  6190), -INT16_C( 22661) },
+      {  INT16_C( 15806), -INT16_C(  8823), -INT16_C( 25026),  INT16_C( 20083),  INT16_C(  9526), -INT16_C( 19196), -INT16_C(  1567),  INT16_C( 26839) },
+      {  INT16_C(  9526), -INT16_C(  9770), -INT16_C( 19196), -INT16_C(  4706), -INT16_C(  1567),  INT16_C(  6190),  INT16_C( 26839), -INT16_C( 22661) } },
+    { { -INT16_C( 28492),  INT16_C(  4666),  INT16_C( 31874), -INT16_C( 27698),  INT16_C( 29730),  INT16_C(  6158), -INT16_C(  2124),  INT16_C(  8620) },
+      {  INT16_C( 18187), -INT16_C(  2473), -INT16_C(  8584), -INT16_C( 11346),  INT16_C(  3030),  INT16_C( 13437), -INT16_C( 31673),  INT16_C( 24012) },
+      {  INT16_C(  3030),  INT16_C( 29730),  INT16_C( 13437),  INT16_C(  6158), -INT16_C( 31673), -INT16_C(  2124),  INT16_C( 24012),  INT16_C(  8620) } },
+    { { -INT16_C( 19628), -INT16_C( 15454), -INT16_C(  1321),  INT16_C( 24928),  INT16_C(  2288), -INT16_C(  3348), -INT16_C(  9085), -INT16_C(   748) },
+      {  INT16_C( 26346), -INT16_C( 29127),  INT16_C( 28555), -INT16_C(   601),  INT16_C( 22061),  INT16_C( 20446),  INT16_C( 15720),  INT16_C(  7466) },
+      {  INT16_C( 22061),  INT16_C(  2288),  INT16_C( 20446), -INT16_C(  3348),  INT16_C( 15720), -INT16_C(  9085),  INT16_C(  7466), -INT16_C(   748) } },
+    { {  INT16_C( 16009),  INT16_C( 18277), -INT16_C( 29126), -INT16_C( 11870),  INT16_C( 18507), -INT16_C( 13703), -INT16_C( 11389),  INT16_C(  7018) },
+      { -INT16_C( 15311), -INT16_C( 13215), -INT16_C( 18982),  INT16_C( 20983),  INT16_C(  2319), -INT16_C(  3567),  INT16_C( 11761), -INT16_C( 12092) },
+      {  INT16_C(  2319),  INT16_C( 18507), -INT16_C(  3567), -INT16_C( 13703),  INT16_C( 11761), -INT16_C( 11389), -INT16_C( 12092),  INT16_C(  7018) } },
+    { {  INT16_C( 26697), -INT16_C(  8886), -INT16_C( 27998),  INT16_C( 15430),  INT16_C(  7437), -INT16_C( 18416),  INT16_C( 14833),  INT16_C( 14530) },
+      { -INT16_C( 12321),  INT16_C( 15552),  INT16_C(  1087),  INT16_C( 12984), -INT16_C(  1120),  INT16_C( 14212),  INT16_C(   201), -INT16_C( 29534) },
+      { -INT16_C(  1120),  INT16_C(  7437),  INT16_C( 14212), -INT16_C( 18416),  INT16_C(   201),  INT16_C( 14833), -INT16_C( 29534),  INT16_C( 14530) } },
+    { { -INT16_C( 11791), -INT16_C( 28779), -INT16_C( 13771),  INT16_C( 20571), -INT16_C( 28018),  INT16_C( 25307), -INT16_C( 13462), -INT16_C(  3666) },
+      { -INT16_C( 21289), -INT16_C( 30556), -INT16_C( 26745), -INT16_C( 20424),  INT16_C( 24905),  INT16_C( 32679),  INT16_C(  2038), -INT16_C( 18756) },
+      {  INT16_C( 24905), -INT16_C( 28018),  INT16_C( 32679),  INT16_C( 25307),  INT16_C(  2038), -INT16_C( 13462), -INT16_C( 18756), -INT16_C(  3666) } },
+    { { -INT16_C( 17168),  INT16_C( 23191), -INT16_C(  2606), -INT16_C( 15616), -INT16_C(  5890), -INT16_C( 12124),  INT16_C( 14473),  INT16_C( 16735) },
+      { -INT16_C( 17451), -INT16_C( 14626), -INT16_C( 15984),  INT16_C(  4245),  INT16_C( 15890), -INT16_C(  6352), -INT16_C(  7008),  INT16_C( 32502) },
+      {  INT16_C( 15890), -INT16_C(  5890), -INT16_C(  6352), -INT16_C( 12124), -INT16_C(  7008),  INT16_C( 14473),  INT16_C( 32502),  INT16_C( 16735) } },
+    { { -INT16_C( 23714),  INT16_C( 16886),  INT16_C( 18004), -INT16_C( 30541), -INT16_C(  8036),  INT16_C( 15155), -INT16_C( 29409), -INT16_C(  5047) },
+      {  INT16_C( 13567), -INT16_C( 19405), -INT16_C(  8700), -INT16_C(  3263),  INT16_C( 12954),  INT16_C( 14183),  INT16_C(  6759), -INT16_C( 19794) },
+      {  INT16_C( 12954), -INT16_C(  8036),  INT16_C( 14183),  INT16_C( 15155),  INT16_C(  6759), -INT16_C( 29409), -INT16_C( 19794), -INT16_C(  5047) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_ilvl_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_ilvl_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ilvl_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  1040966479),  INT32_C(  1478909779), -INT32_C(  1538321801), -INT32_C(  1007292820) },
+      { -INT32_C(  1931377198),  INT32_C(   725039134),  INT32_C(    11561097), -INT32_C(   593423710) },
+      {  INT32_C(    11561097), -INT32_C(  1538321801), -INT32_C(   593423710), -INT32_C(  1007292820) } },
+    { {  INT32_C(   580859298), -INT32_C(  1796960481), -INT32_C(  1422326787),  INT32_C(  1936508175) },
+      { -INT32_C(   792367732),  INT32_C(  1369495359),  INT32_C(   108021621),  INT32_C(  1281484968) },
+      {  INT32_C(   108021621), -INT32_C(  1422326787),  INT32_C(  1281484968),  INT32_C(  1936508175) } },
+    { {  INT32_C(   824653664),  INT32_C(  1345929284), -INT32_C(  2000808292), -INT32_C(  2141789213) },
+      { -INT32_C(    14606061), -INT32_C(  1349014231),  INT32_C(  1774469514),  INT32_C(    97127364) },
+      {  INT32_C(  1774469514), -INT32_C(  2000808292),  INT32_C(    97127364), -INT32_C(  2141789213) } },
+    { { -INT32_C(  1772018745),  INT32_C(   300685486),  INT32_C(   774386439), -INT32_C(  1365098156) },
+      {  INT32_C(   113901034),  INT32_C(  2134204289),  INT32_C(   754610559), -INT32_C(   916411828) },
+      {  INT32_C(   754610559),  INT32_C(   774386439), -INT32_C(   916411828), -INT32_C(  1365098156) } },
+    { { -INT32_C(  1076173801),  INT32_C(  1759111369),  INT32_C(  1256380337),  INT32_C(   618144636) },
+      { -INT32_C(   641816977), -INT32_C(   525368257),  INT32_C(  1520090770), -INT32_C(   722188895) },
+      {  INT32_C(  1520090770),  INT32_C(  1256380337), -INT32_C(   722188895),  INT32_C(   618144636) } },
+    { {  INT32_C(   804308170),  INT32_C(  1973727290), -INT32_C(  1138476024), -INT32_C(   664540050) },
+      {  INT32_C(  1065983422),  INT32_C(  1237896043), -INT32_C(   614743436),  INT32_C(   648609693) },
+      { -INT32_C(   614743436), -INT32_C(  1138476024),  INT32_C(   648609693), -INT32_C(   664540050) } },
+    { {  INT32_C(  1300002622), -INT32_C(   442137249), -INT32_C(  1253361073), -INT32_C(   564107574) },
+      { -INT32_C(  1661476638),  INT32_C(   168997125),  INT32_C(  1902855870), -INT32_C(  1825031930) },
+      {  INT32_C(  1902855870), -INT32_C(  1253361073), -INT32_C(  1825031930), -INT32_C(   564107574) } },
+    { {  INT32_C(  1041125712), -INT32_C(   617729598),  INT32_C(    34608615), -INT32_C(  1665043866) },
+      { -INT32_C(  1172089661),  INT32_C(   710995325), -INT32_C(  1247843113),  INT32_C(  1336422780) },
+      { -INT32_C(  1247843113),  INT32_C(    34608615),  INT32_C(  1336422780), -INT32_C(  1665043866) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_ilvl_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_ilvl_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ilvl_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 1842370532978091451), -INT64_C( 4898612469801971517) },
+      { -INT64_C( 3280853588665400039),  INT64_C( 7461645240600122138) },
+      {  INT64_C( 7461645240600122138), -INT64_C( 4898612469801971517) } },
+    { { -INT64_C( 3812149062483605278),  INT64_C( 1466887977847265722) },
+      { -INT64_C( 8139738808475636765),  INT64_C( 1960409165561950839) },
+      {  INT64_C( 1960409165561950839),  INT64_C( 1466887977847265722) } },
+    { {  INT64_C( 9015022718724850558), -INT64_C( 4393668935953361064) },
+      { -INT64_C( 2219429050161823455), -INT64_C( 7818069427773834139) },
+      { -INT64_C( 7818069427773834139), -INT64_C( 4393668935953361064) } },
+    { { -INT64_C( 4071534540571425492), -INT64_C( 2240967233520178505) },
+      { -INT64_C( 8532870986668179485),  INT64_C( 5423731379666759037) },
+      {  INT64_C( 5423731379666759037), -INT64_C( 2240967233520178505) } },
+    { { -INT64_C( 8961729052999224861), -INT64_C(  193912360684208351) },
+      { -INT64_C(  756401818550009625),  INT64_C( 7850269929844707058) },
+      {  INT64_C( 7850269929844707058), -INT64_C(  193912360684208351) } },
+    { { -INT64_C( 4634875878512808316), -INT64_C(  603049774225685437) },
+      {  INT64_C( 9120890527709534186),  INT64_C( 8517615068699246446) },
+      {  INT64_C( 8517615068699246446), -INT64_C(  603049774225685437) } },
+    { { -INT64_C( 1182761717369798997), -INT64_C( 2784942360895679344) },
+      { -INT64_C( 6933363106006019146),  INT64_C( 1480284778416390649) },
+      {  INT64_C( 1480284778416390649), -INT64_C( 2784942360895679344) } },
+    { {  INT64_C( 5791162311106437999),  INT64_C( 5643828048017693928) },
+      { -INT64_C( 9033049187785435763),  INT64_C( 1846434524289353155) },
+      {  INT64_C( 1846434524289353155),  INT64_C( 5643828048017693928) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_ilvl_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_ilvl_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvl_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvl_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvl_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvl_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
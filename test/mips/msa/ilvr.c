@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN ilvr
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/ilvr.h"
+
+static int
+test_simde_ilvr_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  73), -INT8_C(  74),  INT8_C(  87), -INT8_C(  65), -INT8_C(  26),  INT8_C(  97),  INT8_C(  37),  INT8_C(  12),
+        -INT8_C(  78),  INT8_C( 117), -INT8_C( 108),  INT8_C( 101),  INT8_C(  52),  INT8_C(  38), -INT8_C(  69), -INT8_C(  58) },
+      {  INT8_C(  62),  INT8_C( 113), -INT8_C(  21), -INT8_C(  36), -INT8_C(  38),  INT8_C( 108),  INT8_C(  42),  INT8_C(   4),
+        -INT8_C( 106), -INT8_C( 108), -INT8_C(  46),  INT8_C(  44), -INT8_C(  76),  INT8_C(  15),  INT8_C(  75),  INT8_C(  47) },
+      {  INT8_C(  62), -INT8_C(  73),  INT8_C( 113), -INT8_C(  74), -INT8_C(  21),  INT8_C(  87), -INT8_C(  36), -INT8_C(  65),
+        -INT8_C(  38), -INT8_C(  26),  INT8_C( 108),  INT8_C(  97),  INT8_C(  42),  INT8_C(  37),  INT8_C(   4),  INT8_C(  12) } },
+    { {  INT8_C(  13),  INT8_C( 125), -INT8_C( 100), -INT8_C( 105),  INT8_C(   6), -INT8_C(  31), -INT8_C(  91),  INT8_C(  99),
+        -INT8_C(  58), -INT8_C(  91), -INT8_C(  22), -INT8_C(  37), -INT8_C(  98),  INT8_C( 124),  INT8_C(  26), -INT8_C(   2) },
+      {  INT8_C(  20), -INT8_C(  26),  INT8_C( 115), -INT8_C(  98),  INT8_C(  80), -INT8_C(  72), -INT8_C(  33), -INT8_C(   8),
+         INT8_C(  15), -INT8_C(   1),  INT8_C(  69),  INT8_C(  72),  INT8_C(  23),  INT8_C(  18),  INT8_C(  53), -INT8_C(  98) },
+      {  INT8_C(  20),  INT8_C(  13), -INT8_C(  26),  INT8_C( 125),  INT8_C( 115), -INT8_C( 100), -INT8_C(  98), -INT8_C( 105),
+         INT8_C(  80),  INT8_C(   6), -INT8_C(  72), -INT8_C(  31), -INT8_C(  33), -INT8_C(  91), -INT8_C(   8),  INT8_C(  99) } },
+    { {  INT8_C(  78), -INT8_C( 123), -INT8_C(  97),  INT8_C(  95),  INT8_C(  35), -INT8_C(  90), -INT8_C(  29), -INT8_C(  89),
+         INT8_C(  39), -INT8_C(  37),  INT8_C(   0), -INT8_C(  36),  INT8_C(  27),  INT8_C(  51), -INT8_C( 120), -INT8_C(  28) },
+      {  INT8_C(  86), -INT8_C(  10),  INT8_C(   8),  INT8_C( 114),  INT8_C(   2),  INT8_C( 102),  INT8_C( 115),  INT8_C( 119),
+        -INT8_C(  52), -INT8_C(  50), -INT8_C( 106),  INT8_C( 122),  INT8_C(  38),  INT8_C(  68),  INT8_C(  93),  INT8_C(  68) },
+      {  INT8_C(  86),  INT8_C(  78), -INT8_C(  10), -INT8_C( 123),  INT8_C(   8), -INT8_C(  97),  INT8_C( 114),  INT8_C(  95),
+         INT8_C(   2),  INT8_C(  35),  INT8_C( 102), -INT8_C(  90),  INT8_C( 115), -INT8_C(  29),  INT8_C( 119), -INT8_C(  89) } },
+    { { -INT8_C(  30), -INT8_C( 112), -INT8_C(  10), -INT8_C(  46), -INT8_C(  14),  INT8_C(  63),  INT8_C(  33), -INT8_C(  36),
+         INT8_C(  74),  INT8_C(  34),  INT8_C(  33),      INT8_MIN, -INT8_C(  35),  INT8_C(  86),  INT8_C(  48),  INT8_C(  29) },
+      {  INT8_C(  47), -INT8_C(   4), -INT8_C(  55),  INT8_C(  25),  INT8_C(  35), -INT8_C( 110), -INT8_C(  22),  INT8_C( 119),
+        -INT8_C(  76), -INT8_C(  82), -INT8_C(  98), -INT8_C(  64),  INT8_C(  93),  INT8_C(  61),  INT8_C( 119), -INT8_C(  28) },
+      {  INT8_C(  47), -INT8_C(  30), -INT8_C(   4), -INT8_C( 112), -INT8_C(  55), -INT8_C(  10),  INT8_C(  25), -INT8_C(  46),
+         INT8_C(  35), -INT8_C(  14), -INT8_C( 110),  INT8_C(  63), -INT8_C(  22),  INT8_C(  33),  INT8_C( 119), -INT8_C(  36) } },
+    { { -INT8_C(  47), -INT8_C(  17), -INT8_C(  52), -INT8_C(  73), -INT8_C( 111),  INT8_C(  75),  INT8_C( 123), -INT8_C(  92),
+        -INT8_C( 102),  INT8_C(   6), -INT8_C( 115),  INT8_C(  81), -INT8_C(  94),  INT8_C(  75), -INT8_C(  43), -INT8_C(  51) },
+      { -INT8_C(  26),  INT8_C(  67), -INT8_C(  58),  INT8_C( 112), -INT8_C( 126), -INT8_C(  39), -INT8_C(   6),  INT8_C(  62),
+        -INT8_C( 108),  INT8_C( 105),  INT8_C( 116),  INT8_C(  43),  INT8_C(  13),  INT8_C(  78), -INT8_C( 100), -INT8_C(  18) },
+      { -INT8_C(  26), -INT8_C(  47),  INT8_C(  67), -INT8_C(  17), -INT8_C(  58), -INT8_C(  52),  INT8_C( 112), -INT8_C(  73),
+        -INT8_C( 126), -INT8_C( 111), -INT8_C(  39),  INT8_C(  75), -INT8_C(   6),  INT8_C( 123),  INT8_C(  62), -INT8_C(  92) } },
+    { {  INT8_C( 110),  INT8_C(   1), -INT8_C(  43),      INT8_MIN,  INT8_C(  68), -INT8_C(  84),  INT8_C(  74),  INT8_C(   1),
+         INT8_C(  38), -INT8_C( 124),  INT8_C(  45), -INT8_C(   8),  INT8_C(  13),  INT8_C(  65), -INT8_C(  32),  INT8_C(  33) },
+      {  INT8_C(   4), -INT8_C( 109), -INT8_C(   9), -INT8_C(  94), -INT8_C(  76), -INT8_C(  27),  INT8_C( 113), -INT8_C(  10),
+        -INT8_C(  30),  INT8_C(  94), -INT8_C(  40),  INT8_C( 101),  INT8_C(  45),  INT8_C( 103), -INT8_C(   3), -INT8_C( 116) },
+      {  INT8_C(   4),  INT8_C( 110), -INT8_C( 109),  INT8_C(   1), -INT8_C(   9), -INT8_C(  43), -INT8_C(  94),      INT8_MIN,
+        -INT8_C(  76),  INT8_C(  68), -INT8_C(  27), -INT8_C(  84),  INT8_C( 113),  INT8_C(  74), -INT8_C(  10),  INT8_C(   1) } },
+    { { -INT8_C(  59),  INT8_C(  36),  INT8_C(  36),  INT8_C(  64),  INT8_C(  14), -INT8_C(  39), -INT8_C( 126),  INT8_C(   2),
+        -INT8_C(   4), -INT8_C(  52),  INT8_C( 117),  INT8_C(  49), -INT8_C(  54), -INT8_C(  76), -INT8_C(  42),  INT8_C(  47) },
+      {  INT8_C(   7), -INT8_C(  95), -INT8_C(  51),  INT8_C(  38),  INT8_C(  20),  INT8_C(  68),  INT8_C(  71), -INT8_C(  40),
+         INT8_C( 104), -INT8_C(  12),  INT8_C(   1), -INT8_C(  22), -INT8_C(  40),  INT8_C(  92), -INT8_C( 109), -INT8_C(  19) },
+      {  INT8_C(   7), -INT8_C(  59), -INT8_C(  95),  INT8_C(  36), -INT8_C(  51),  INT8_C(  36),  INT8_C(  38),  INT8_C(  64),
+         INT8_C(  20),  INT8_C(  14),  INT8_C(  68), -INT8_C(  39),  INT8_C(  71), -INT8_C( 126), -INT8_C(  40),  INT8_C(   2) } },
+    { { -INT8_C(  17),  INT8_C(  82), -INT8_C(  54),  INT8_C(  89),  INT8_C(  23), -INT8_C(  89), -INT8_C(  90),  INT8_C(  74),
+        -INT8_C(   9),  INT8_C(   6),  INT8_C(  91),  INT8_C(  34),  INT8_C(  23),  INT8_C( 115),  INT8_C(  94), -INT8_C(  49) },
+      {  INT8_C(  45), -INT8_C(  10),  INT8_C(  24), -INT8_C(  23),  INT8_C(  67),  INT8_C(  85), -INT8_C(  18),  INT8_C(  49),
+         INT8_C( 114), -INT8_C(  36),  INT8_C(  35),  INT8_C(  99), -INT8_C(  60), -INT8_C( 120),  INT8_C(   2),  INT8_C(  16) },
+      {  INT8_C(  45), -INT8_C(  17), -INT8_C(  10),  INT8_C(  82),  INT8_C(  24), -INT8_C(  54), -INT8_C(  23),  INT8_C(  89),
+         INT8_C(  67),  INT8_C(  23),  INT8_C(  85), -INT8_C(  89), -INT8_C(  18), -INT8_C(  90),  INT8_C(  49),  INT8_C(  74) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_ilvr_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_ilvr_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ilvr_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 31824), -INT16_C(   799), -INT16_C( 19922), -INT16_C( 24716),  INT16_C( 12783),  INT16_C( 11134),  INT16_C( 30198), -INT16_C( 19795) },
+      {  INT16_C( 32662),  INT16_C( 24848),  INT16_C( 24355), -INT16_C(  3900),  INT16_C( 31401),  INT16_C( 27853),  INT16_C( 26557),  INT16_C( 20024) },
+      {  INT16_C( 32662), -INT16_C( 31824),  INT16_C( 24848), -INT16_C(   799),  INT16_C( 24355), -INT16_C( 19922), -INT16_C(  3900), -INT16_C( 24716) } },
+    { { -INT16_C(  4338), -INT16_C( 31418),  INT16_C( 24468), -INT16_C( 10746),  INT16_C(  2742), -INT16_C(  5644),  INT16_C(   990), -INT16_C( 28245) },
+      { -INT16_C( 22105), -INT16_C( 17525), -INT16_C(  3608), -INT16_C( 19941),  INT16_C( 16359),  INT16_C( 16731), -INT16_C(  5286),  INT16_C(  5253) },
+      { -INT16_C( 22105), -INT16_C(  4338), -INT16_C( 17525), -INT16_C( 31418), -INT16_C(  3608),  INT16_C( 24468), -INT16_C( 19941), -INT16_C( 10746) } },
+    { {  INT16_C( 23042),  INT16_C( 30472), -INT16_C( 17186), -INT16_C( 14398),  INT16_C( 19008), -INT16_C( 20420),  INT16_C(  9371), -INT16_C( 13954) },
+      { -INT16_C(  3492),  INT16_C( 11780), -INT16_C(  4516), -INT16_C( 19554), -INT16_C(  9953),  INT16_C(  9993),  INT16_C( 16265),  INT16_C(  5080) },
+      { -INT16_C(  3492),  INT16_C( 23042),  INT16_C( 11780),  INT16_C( 30472), -INT16_C(  4516), -INT16_C( 17186), -INT16_C( 19554), -INT16_C( 14398) } },
+    { { -INT16_C(  8266),  INT16_C( 10077), -INT16_C( 11397), -INT16_C( 32667),  INT16_C( 21515), -INT16_C( 17079),  INT16_C( 15412), -INT16_C( 17728) },
+      {  INT16_C( 10389), -INT16_C(  5024),  INT16_C( 27166), -INT16_C( 17894), -INT16_C( 18512),  INT16_C( 19712),  INT16_C( 21685), -INT16_C( 30180) },
+      {  INT16_C( 10389), -INT16_C(  8266), -INT16_C(  5024),  INT16_C( 10077),  INT16_C( 27166), -INT16_C( 11397), -INT16_C( 17894), -INT16_C( 32667) } },
+    { {  INT16_C( 11968), -INT16_C(  3599),  INT16_C( 29979),  INT16_C( 14126), -INT16_C( 26249), -INT16_C( 16139), -INT16_C(  3257),  INT16_C( 15929) },
+      { -INT16_C( 13645),  INT16_C( 27309), -INT16_C( 22442),  INT16_C( 23593), -INT16_C( 25693),  INT16_C(  1554), -INT16_C( 21438), -INT16_C( 30645) },
+      { -INT16_C( 13645),  INT16_C( 11968),  INT16_C( 27309), -INT16_C(  3599), -INT16_C( 22442),  INT16_C( 29979),  INT16_C( 23593),  INT16_C( 14126) } },
+    { { -INT16_C( 12436), -INT16_C( 15532), -INT16_C( 20900),  INT16_C( 23253), -INT16_C( 13945), -INT16_C( 26536),  INT16_C( 24536),  INT16_C( 11284) },
+      {  INT16_C( 27616),  INT16_C(  6783), -INT16_C(  4718),  INT16_C(  8715),  INT16_C(  3359), -INT16_C(    37),  INT16_C(  4473), -INT16_C( 15587) },
+      {  INT16_C( 27616), -INT16_C( 12436),  INT16_C(  6783), -INT16_C( 15532), -INT16_C(  4718), -INT16_C( 20900),  INT16_C(  8715),  INT16_C( 23253) } },
+    { {  INT16_C( 20176), -INT16_C( 20030),  INT16_C( 25021),  INT16_C(  5749), -INT16_C(  5068),  INT16_C( 12182),  INT16_C( 12807),  INT16_C( 25566) },
+      {  INT16_C(  8435), -INT16_C( 26163),  INT16_C( 18274),  INT16_C(  7815),  INT16_C( 29484),  INT16_C( 19899), -INT16_C( 29333), -INT16_C( 23822) },
+      {  INT16_C(  8435),  INT16_C( 20176), -INT16_C( 26163), -INT16_C( 20030),  INT16_C( 18274),  INT16_C( 25021),  INT16_C(  7815),  INT16_C(  5749) } },
+    { {  INT16_C( 24731),  INT16_C(  6590),  INT16_C(  7730),  INT16_C(  2595),  INT16_C( 17658), -INT16_C( 10220), -INT16_C( 14446), -INT16_C( 12329) },
+      {  INT16_C( 19514), -INT16_C(  9201), -INT16_C(   806),  INT16_C( 22870),  INT16_C( 13606),  INT16_C(  5675), -INT16_C( 16775), -INT16_C( 15271) },
+      {  INT16_C( 19514),  INT16_C( 24731), -INT16_C(  9201),  INT16_C(  6590), -INT16_C(   806),  INT16_C(  7730),  INT16_C( 22870),  INT16_C(  2595) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_ilvr_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_ilvr_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ilvr_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1503464329), -INT32_C(  2081964655), -INT32_C(  2120485266),  INT32_C(   368113447) },
+      { -INT32_C(  1498097899),  INT32_C(   675772593), -INT32_C(  1928705384),  INT32_C(   521610509) },
+      { -INT32_C(  1498097899), -INT32_C(  1503464329),  INT32_C(   675772593), -INT32_C(  2081964655) } },
+    { { -INT32_C(   479346424), -INT32_C(  1812028172),  INT32_C(  1275109396), -INT32_C(   934969292) },
+      { -INT32_C(  1673151000), -INT32_C(  1784656563),  INT32_C(  2126843334),  INT32_C(  1393585368) },
+      { -INT32_C(  1673151000), -INT32_C(   479346424), -INT32_C(  1784656563), -INT32_C(  1812028172) } },
+    { { -INT32_C(  1071867353), -INT32_C(   491487149),  INT32_C(   673334917), -INT32_C(  1603739616) },
+      { -INT32_C(   979874614),  INT32_C(   756740929),  INT32_C(  1876402598),  INT32_C(   159466623) },
+      { -INT32_C(   979874614), -INT32_C(  1071867353),  INT32_C(   756740929), -INT32_C(   491487149) } },
+    { {  INT32_C(   969713539), -INT32_C(  1501698638), -INT32_C(   241294263),  INT32_C(   127074037) },
+      {  INT32_C(  1035218168),  INT32_C(   253035994),  INT32_C(  1378789580),  INT32_C(  1072528674) },
+      {  INT32_C(  1035218168),  INT32_C(   969713539),  INT32_C(   253035994), -INT32_C(  1501698638) } },
+    { { -INT32_C(   237925864), -INT32_C(  1155230767), -INT32_C(   101426978), -INT32_C(   718542953) },
+      {  INT32_C(  1120523692),  INT32_C(    14037130), -INT32_C(  1134588993),  INT32_C(  1475158867) },
+      {  INT32_C(  1120523692), -INT32_C(   237925864),  INT32_C(    14037130), -INT32_C(  1155230767) } },
+    { { -INT32_C(   252984024),  INT32_C(  1901926999),  INT32_C(  1729200963), -INT32_C(   450007950) },
+      { -INT32_C(   791817142), -INT32_C(  1788411442),  INT32_C(  1685370477), -INT32_C(  1801284123) },
+      { -INT32_C(   791817142), -INT32_C(   252984024), -INT32_C(  1788411442),  INT32_C(  1901926999) } },
+    { { -INT32_C(   516538429), -INT32_C(  1543874467),  INT32_C(   638540697),  INT32_C(    25196541) },
+      {  INT32_C(  2134135460), -INT32_C(    86223746), -INT32_C(  1562570568),  INT32_C(  1565404403) },
+      {  INT32_C(  2134135460), -INT32_C(   516538429), -INT32_C(    86223746), -INT32_C(  1543874467) } },
+    { {  INT32_C(   516323172),  INT32_C(  2065339845),  INT32_C(  1165696929),  INT32_C(  1607546983) },
+      { -INT32_C(  1578729869),  INT32_C(  1858476703),  INT32_C(  2044941037), -INT32_C(   454682590) },
+      { -INT32_C(  1578729869),  INT32_C(   516323172),  INT32_C(  1858476703),  INT32_C(  2065339845) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_ilvr_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_ilvr_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_ilvr_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 7171668698428138827), -INT64_C( 2871182727433516390) },
+      { -INT64_C( 9129875468181194013), -INT64_C( 3310595415116656966) },
+      { -INT64_C( 9129875468181194013),  INT64_C( 7171668698428138827) } },
+    { {  INT64_C( 2118264188663894692), -INT64_C( 3802240900583819937) },
+      { -INT64_C( 8835512223769287814),  INT64_C( 9137821889275942683) },
+      { -INT64_C( 8835512223769287814),  INT64_C( 2118264188663894692) } },
+    { { -INT64_C( 1604096092480569476), -INT64_C( 3960449572544522383) },
+      { -INT64_C( 5315929494264740901),  INT64_C(  397744901241734196) },
+      { -INT64_C( 5315929494264740901), -INT64_C( 1604096092480569476) } },
+    { {  INT64_C( 4685513256170129729),  INT64_C(   38747870203742221) },
+      {  INT64_C( 6871720805582087265),  INT64_C( 2031028322908875340) },
+      {  INT64_C( 6871720805582087265),  INT64_C( 4685513256170129729) } },
+    { {  INT64_C( 5330246570803527387),  INT64_C( 2039450916302516312) },
+      {  INT64_C( 7772822652736968877),  INT64_C( 1633003954282362821) },
+      {  INT64_C( 7772822652736968877),  INT64_C( 5330246570803527387) } },
+    { { -INT64_C( 6442042953154116489), -INT64_C( 6460422199932413644) },
+      {  INT64_C( 2241908897639951483),  INT64_C(  669751267276077324) },
+      {  INT64_C( 2241908897639951483), -INT64_C( 6442042953154116489) } },
+    { { -INT64_C( 7953421526414655292),  INT64_C( 4030247159041617872) },
+      { -INT64_C( 1103912633338364400), -INT64_C(  576953556588719438) },
+      { -INT64_C( 1103912633338364400), -INT64_C( 7953421526414655292) } },
+    { { -INT64_C( 7243324937741064640),  INT64_C( 5243857041923137845) },
+      {  INT64_C( 8392823658358295407),  INT64_C( 4750920610478369006) },
+      {  INT64_C( 8392823658358295407), -INT64_C( 7243324937741064640) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_ilvr_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_ilvr_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvr_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvr_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvr_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(ilvr_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,325 @@
+#define SIMDE_TEST_MIPS_MSA_INSN maddv
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/maddv.h"
+
+static int
+test_simde_maddv_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t c[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  96), -INT8_C(  82),  INT8_C(  40), -INT8_C( 102),  INT8_C(  17), -INT8_C(  79),  INT8_C(  61),  INT8_C(  30),
+        -INT8_C(  53),  INT8_C(  89), -INT8_C(  90),  INT8_C( 125),  INT8_C(  66),  INT8_C( 118),  INT8_C(   6), -INT8_C(  56) },
+      {  INT8_C(   3),  INT8_C(  83),  INT8_C( 119),  INT8_C(  26),  INT8_C(  52), -INT8_C(  27), -INT8_C( 113), -INT8_C(  25),
+         INT8_C(  15),  INT8_C(  37),  INT8_C( 107),  INT8_C(  40), -INT8_C(  33),  INT8_C( 124),  INT8_C( 108),  INT8_C(  36) },
+      { -INT8_C(  47),  INT8_C(  35),  INT8_C(  48),  INT8_C(  84), -INT8_C(  47), -INT8_C(  48),  INT8_C(  95), -INT8_C( 118),
+        -INT8_C(  49),  INT8_C(  33), -INT8_C(  24),  INT8_C(  92),  INT8_C(  16),      INT8_MAX,  INT8_C(  76), -INT8_C(  78) },
+      { -INT8_C(  45),  INT8_C(   7),  INT8_C( 120),  INT8_C(  34), -INT8_C( 123), -INT8_C(  63),  INT8_C(  78), -INT8_C(  92),
+        -INT8_C(  20),  INT8_C(  30), -INT8_C(  98), -INT8_C(  35),  INT8_C(  50), -INT8_C(   6),  INT8_C(  22), -INT8_C(  48) } },
+    { { -INT8_C(  78),  INT8_C(   6),  INT8_C(  75),  INT8_C(  90),  INT8_C(  57), -INT8_C(  33), -INT8_C(  34), -INT8_C( 100),
+         INT8_C(   5), -INT8_C( 110), -INT8_C(  52),  INT8_C(  11),  INT8_C(  71),  INT8_C(  18),  INT8_C(  53),  INT8_C(  28) },
+      { -INT8_C(   4), -INT8_C(  15),  INT8_C( 108), -INT8_C(  38),      INT8_MIN,  INT8_C(  71),  INT8_C( 104),  INT8_C(  61),
+        -INT8_C(  77), -INT8_C( 120),  INT8_C(  59), -INT8_C(  44),  INT8_C( 108),  INT8_C(  23),  INT8_C( 123), -INT8_C(  75) },
+      {  INT8_C(   5), -INT8_C(  54), -INT8_C(  96),  INT8_C(  40),  INT8_C(  91),  INT8_C(  18), -INT8_C(  38),  INT8_C( 115),
+         INT8_C(  74), -INT8_C(  91), -INT8_C(   4), -INT8_C(  62), -INT8_C(  70), -INT8_C(  36), -INT8_C(  33),  INT8_C(   9) },
+      { -INT8_C(  98),  INT8_C(  48), -INT8_C(  53),  INT8_C( 106), -INT8_C(  71), -INT8_C(  35),  INT8_C( 110),  INT8_C(   3),
+        -INT8_C(  61),  INT8_C(  58), -INT8_C(  32), -INT8_C(  77), -INT8_C(  65), -INT8_C(  42),  INT8_C(  90),  INT8_C( 121) } },
+    { { -INT8_C(  38), -INT8_C(  34), -INT8_C(   3),  INT8_C(  68),  INT8_C(  49), -INT8_C(  92),  INT8_C(  60),  INT8_C( 118),
+         INT8_C(  47), -INT8_C(  95),  INT8_C(  65), -INT8_C( 102), -INT8_C(  30), -INT8_C(  99), -INT8_C( 127), -INT8_C(  96) },
+      { -INT8_C(  68), -INT8_C(  82),  INT8_C(  44), -INT8_C(  96),  INT8_C(  15),  INT8_C(  99), -INT8_C( 116), -INT8_C(  78),
+         INT8_C(  82), -INT8_C(  57), -INT8_C(  29),  INT8_C(  85),  INT8_C(  68),  INT8_C(  26),  INT8_C(  65), -INT8_C( 107) },
+      { -INT8_C(  52), -INT8_C(  57), -INT8_C(  30), -INT8_C(  65),  INT8_C(  80), -INT8_C( 116), -INT8_C(  33), -INT8_C(  20),
+        -INT8_C(   5),  INT8_C( 106), -INT8_C( 122),  INT8_C(  43),  INT8_C(  93), -INT8_C( 125), -INT8_C(  83), -INT8_C(  28) },
+      { -INT8_C(  86),  INT8_C(  32), -INT8_C(  43), -INT8_C(  92), -INT8_C(  31), -INT8_C(  56),  INT8_C(  48), -INT8_C( 114),
+        -INT8_C( 107),  INT8_C(   7),  INT8_C(  19), -INT8_C(  31), -INT8_C( 106), -INT8_C(  21),  INT8_C( 110),  INT8_C(  84) } },
+    { { -INT8_C( 101),  INT8_C(  37),  INT8_C(  76), -INT8_C(  61), -INT8_C(  65),  INT8_C(  87),  INT8_C(  90), -INT8_C(  79),
+        -INT8_C( 126),  INT8_C(   8), -INT8_C(  88),  INT8_C( 107),  INT8_C(  86), -INT8_C(  90),  INT8_C(  46), -INT8_C(  10) },
+      {  INT8_C(  15),  INT8_C(   6), -INT8_C( 121), -INT8_C(   1),  INT8_C(  74), -INT8_C(  30), -INT8_C(  53),  INT8_C(  22),
+         INT8_C(  27), -INT8_C(  25), -INT8_C(  90),      INT8_MIN, -INT8_C(   5),  INT8_C(  52), -INT8_C(  94), -INT8_C(  85) },
+      { -INT8_C( 102), -INT8_C( 120),  INT8_C(  71), -INT8_C(  36), -INT8_C(  77),  INT8_C( 116), -INT8_C( 108), -INT8_C(  28),
+         INT8_C(  85), -INT8_C(  32),  INT8_C(  80), -INT8_C( 120),  INT8_C(   9), -INT8_C(  85),  INT8_C( 108),  INT8_C(   6) },
+      { -INT8_C(  95),  INT8_C(  85), -INT8_C(  67), -INT8_C(  25),  INT8_C( 125), -INT8_C(  65), -INT8_C(  74),  INT8_C(  73),
+         INT8_C( 121),  INT8_C(  40), -INT8_C( 120),  INT8_C( 107),  INT8_C(  41),  INT8_C(  98), -INT8_C( 122), -INT8_C(   8) } },
+    { { -INT8_C(  56), -INT8_C(  66), -INT8_C(  14),  INT8_C(  89),  INT8_C(  25), -INT8_C(   6),  INT8_C(  53), -INT8_C(  70),
+        -INT8_C( 108),  INT8_C(  45),  INT8_C(  25), -INT8_C(  98), -INT8_C( 118), -INT8_C( 119), -INT8_C( 124), -INT8_C(  21) },
+      {  INT8_C(   8),  INT8_C( 126), -INT8_C(  19), -INT8_C(  53),  INT8_C(  52), -INT8_C(  76),  INT8_C( 114), -INT8_C(   9),
+        -INT8_C(  95),  INT8_C( 104), -INT8_C( 103),  INT8_C(  29),  INT8_C(  97), -INT8_C(  52),  INT8_C( 110),  INT8_C(  80) },
+      {  INT8_C(  11),  INT8_C(  18), -INT8_C(  97), -INT8_C(  28), -INT8_C(  53), -INT8_C( 122), -INT8_C(  15),  INT8_C( 103),
+         INT8_C( 102), -INT8_C(  25), -INT8_C(  50), -INT8_C(  85), -INT8_C( 112),  INT8_C(  12), -INT8_C( 115), -INT8_C( 117) },
+      {  INT8_C(  32), -INT8_C( 102),  INT8_C(  37),  INT8_C(  37),  INT8_C(  85),  INT8_C(  50), -INT8_C( 121),  INT8_C(  27),
+        -INT8_C(  70),  INT8_C(   5),  INT8_C(  55), -INT8_C(   3),  INT8_C(  26),  INT8_C(  25),  INT8_C(  26),  INT8_C(  91) } },
+    { {  INT8_C( 122), -INT8_C(  29), -INT8_C( 120), -INT8_C(  78),  INT8_C(  27),  INT8_C(  20), -INT8_C( 127),  INT8_C(  30),
+         INT8_C(  99),  INT8_C(  73), -INT8_C(  79),  INT8_C(  42),  INT8_C( 124), -INT8_C(  74),  INT8_C(   2),  INT8_C(  21) },
+      { -INT8_C(   7),  INT8_C(  86),  INT8_C(  80),  INT8_C(  47), -INT8_C( 122), -INT8_C(  94), -INT8_C(  86), -INT8_C(  43),
+         INT8_C(  32), -INT8_C( 102), -INT8_C(  84), -INT8_C( 112),  INT8_C( 122),  INT8_C(  38),  INT8_C(  93),  INT8_C(  81) },
+      { -INT8_C(  48),  INT8_C(  14),  INT8_C(   3), -INT8_C(  34),  INT8_C(  83),  INT8_C(  90),  INT8_C(  40), -INT8_C(  18),
+        -INT8_C(  51), -INT8_C(  29),  INT8_C(  33),  INT8_C(  33), -INT8_C(  82), -INT8_C(  21), -INT8_C(  12), -INT8_C(  82) },
+      { -INT8_C(  54), -INT8_C( 105),  INT8_C( 120),  INT8_C( 116), -INT8_C( 115),  INT8_C(   8),  INT8_C(  17),  INT8_C(  36),
+         INT8_C(   3), -INT8_C(  41), -INT8_C(  35), -INT8_C(  70),  INT8_C( 104), -INT8_C( 104), -INT8_C(  90),  INT8_C(  35) } },
+    { { -INT8_C( 106),  INT8_C( 120),  INT8_C( 117),  INT8_C(  97),      INT8_MIN,  INT8_C( 126), -INT8_C( 107), -INT8_C(  47),
+         INT8_C( 105), -INT8_C(  43),  INT8_C(  90),  INT8_C( 112), -INT8_C( 125),  INT8_C(  40), -INT8_C(  18), -INT8_C(  47) },
+      { -INT8_C(  85), -INT8_C(  68), -INT8_C(   4), -INT8_C(  36),  INT8_C(  69),  INT8_C(  66),  INT8_C(  37),  INT8_C( 102),
+        -INT8_C(  66),  INT8_C(  39), -INT8_C(  73),  INT8_C(  26),  INT8_C(  10), -INT8_C(   2),  INT8_C(  27),  INT8_C(  67) },
+      {  INT8_C(  64),  INT8_C( 114), -INT8_C(  73), -INT8_C( 109),  INT8_C(  32), -INT8_C(  50), -INT8_C(  98), -INT8_C(  40),
+        -INT8_C(  35), -INT8_C(   9),  INT8_C(  74), -INT8_C(  32), -INT8_C(  90),  INT8_C(  73),  INT8_C(   0), -INT8_C(  80) },
+      {  INT8_C(  86),  INT8_C(  48), -INT8_C( 103), -INT8_C(  75),  INT8_C(  32), -INT8_C( 102),  INT8_C( 107), -INT8_C(  31),
+         INT8_C( 111),  INT8_C( 118),  INT8_C(  64),  INT8_C(  48), -INT8_C(   1), -INT8_C( 106), -INT8_C(  18), -INT8_C(  31) } },
+    { { -INT8_C(  82),  INT8_C( 117),  INT8_C( 119),  INT8_C(  98), -INT8_C(  30), -INT8_C( 109), -INT8_C(  78), -INT8_C( 110),
+         INT8_C(  66), -INT8_C(  73),  INT8_C( 122), -INT8_C(  64),  INT8_C(  35), -INT8_C(  15),  INT8_C(  62),  INT8_C( 100) },
+      {  INT8_C( 123), -INT8_C( 110),  INT8_C( 101),  INT8_C(  43),  INT8_C( 108),  INT8_C(  90), -INT8_C(  14),  INT8_C(  19),
+         INT8_C(  48), -INT8_C(  95),  INT8_C(  74), -INT8_C(   2),  INT8_C(  10), -INT8_C(  17), -INT8_C( 111), -INT8_C(  18) },
+      {  INT8_C(  48), -INT8_C(  55),  INT8_C(  69), -INT8_C( 111), -INT8_C(  97),  INT8_C(   6), -INT8_C(  17), -INT8_C( 107),
+        -INT8_C( 101),  INT8_C(  41), -INT8_C( 105),  INT8_C(  59), -INT8_C(  24),  INT8_C(  61),  INT8_C( 121), -INT8_C(  68) },
+      { -INT8_C(  66),  INT8_C(  23), -INT8_C(  80), -INT8_C(  67), -INT8_C(  10), -INT8_C(  81), -INT8_C(  96), -INT8_C(  95),
+         INT8_C(  82),      INT8_MIN,  INT8_C(  32),  INT8_C(  74),  INT8_C(  51), -INT8_C(  28), -INT8_C(  57),  INT8_C(  44) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 c = simde_msa_ld_b(test_vec[i].c, 0);
+    simde_v16i8 r = simde_msa_maddv_b(a, b, c);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 c = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_maddv_b(a, b, c);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_maddv_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t c[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 31147), -INT16_C( 14971),  INT16_C(   232),  INT16_C( 14253),  INT16_C(  4696),  INT16_C(  8649),  INT16_C( 11377), -INT16_C( 29991) },
+      {  INT16_C(    85),  INT16_C(  2084), -INT16_C( 19813),  INT16_C(  1678), -INT16_C( 11082), -INT16_C( 16156), -INT16_C( 22897),  INT16_C(  8992) },
+      {  INT16_C(  6256),  INT16_C( 16591),  INT16_C(  5268), -INT16_C( 31224), -INT16_C( 23670), -INT16_C( 20962), -INT16_C(   709),  INT16_C( 29557) },
+      { -INT16_C( 26917),  INT16_C( 23201),  INT16_C( 24196), -INT16_C( 16355), -INT16_C( 24972), -INT16_C( 19327), -INT16_C(  7578), -INT16_C(  1927) } },
+    { { -INT16_C( 23767),  INT16_C( 27256),  INT16_C( 24476), -INT16_C( 15006),  INT16_C( 15136),  INT16_C( 14516), -INT16_C( 17402), -INT16_C(  3414) },
+      { -INT16_C( 27894), -INT16_C(  3468), -INT16_C( 32145),  INT16_C(  2455), -INT16_C( 13326), -INT16_C( 13000),  INT16_C( 23371), -INT16_C( 30257) },
+      {  INT16_C( 14676),  INT16_C(  6138),  INT16_C(  8244), -INT16_C(  3318), -INT16_C( 27082),  INT16_C( 21218),  INT16_C( 18214),  INT16_C(  6058) },
+      {  INT16_C(  7281), -INT16_C( 25664), -INT16_C( 16856),  INT16_C( 31304),  INT16_C(  3116),  INT16_C( 21540),  INT16_C(  5672),  INT16_C(  3872) } },
+    { { -INT16_C(  2522), -INT16_C( 26859), -INT16_C( 15634),  INT16_C( 32227),  INT16_C( 17184),  INT16_C( 13418), -INT16_C( 14685), -INT16_C( 18820) },
+      { -INT16_C( 21610),  INT16_C( 14431),  INT16_C( 24867),  INT16_C( 17523), -INT16_C( 13142),  INT16_C(  1708), -INT16_C( 25306),  INT16_C( 20606) },
+      {  INT16_C( 23410),  INT16_C( 19296), -INT16_C( 20256),  INT16_C( 28320), -INT16_C( 26102),  INT16_C(  6787), -INT16_C(  7870),  INT16_C(  9467) },
+      { -INT16_C( 20238), -INT16_C( 28747), -INT16_C( 11890), -INT16_C( 20541), -INT16_C( 31292),  INT16_C(  5742), -INT16_C( 20369),  INT16_C( 23046) } },
+    { { -INT16_C( 20646),  INT16_C( 31611),  INT16_C( 15791), -INT16_C( 23967), -INT16_C( 30895),  INT16_C(  1405), -INT16_C( 17102), -INT16_C(  8117) },
+      {  INT16_C( 20241), -INT16_C(  9703),  INT16_C(  7773), -INT16_C( 21311),  INT16_C( 19353),  INT16_C( 19945), -INT16_C( 16536), -INT16_C( 24043) },
+      {  INT16_C( 13630), -INT16_C( 28640), -INT16_C(  7773), -INT16_C( 23218),  INT16_C( 28634), -INT16_C( 30555), -INT16_C( 23280), -INT16_C(   742) },
+      {  INT16_C( 23160), -INT16_C( 12645),  INT16_C( 20454), -INT16_C( 21969),  INT16_C( 16027),  INT16_C(  1194), -INT16_C( 17486),  INT16_C(  5997) } },
+    { {  INT16_C( 22461),  INT16_C( 18388), -INT16_C( 32376),  INT16_C( 24813), -INT16_C( 27554),  INT16_C( 32386), -INT16_C( 29494),  INT16_C( 19613) },
+      {  INT16_C( 13675),  INT16_C(  6990),  INT16_C( 28309), -INT16_C( 15394),  INT16_C(  2552), -INT16_C(  7928), -INT16_C( 29566), -INT16_C( 18558) },
+      { -INT16_C( 30244), -INT16_C( 21724), -INT16_C( 30842),  INT16_C( 15261), -INT16_C( 27825), -INT16_C( 29061), -INT16_C(  7276), -INT16_C( 12441) },
+      { -INT16_C( 32079),  INT16_C( 14540), -INT16_C(  2426), -INT16_C( 21997),  INT16_C(  4070),  INT16_C(  3418),  INT16_C(  3570),  INT16_C( 16363) } },
+    { { -INT16_C(  2548), -INT16_C( 28801), -INT16_C(  6578), -INT16_C( 22448), -INT16_C( 18001),  INT16_C( 18861), -INT16_C(  6814), -INT16_C( 31715) },
+      { -INT16_C( 27787),  INT16_C( 28262), -INT16_C( 22420),  INT16_C( 23823), -INT16_C( 13470),  INT16_C(  8644), -INT16_C( 29629), -INT16_C( 12608) },
+      {  INT16_C(  7903), -INT16_C( 15542),  INT16_C(  4457),  INT16_C( 30335), -INT16_C( 15007), -INT16_C( 19061),  INT16_C(  3214), -INT16_C(  1898) },
+      {  INT16_C(  7927),  INT16_C( 11003),  INT16_C(  9882), -INT16_C( 17215),  INT16_C( 13265),  INT16_C( 13081), -INT16_C( 10612), -INT16_C( 22371) } },
+    { { -INT16_C(  1410),  INT16_C(  1908), -INT16_C( 12548), -INT16_C( 18862),  INT16_C( 11813), -INT16_C(  8441), -INT16_C( 10900),  INT16_C( 16842) },
+      {  INT16_C( 23612),  INT16_C( 17954), -INT16_C( 22741), -INT16_C(  3673),  INT16_C( 21953),  INT16_C( 12781), -INT16_C(  5108),  INT16_C( 31617) },
+      {  INT16_C(  3222), -INT16_C( 20342), -INT16_C(  4315),  INT16_C(  7931),  INT16_C( 12847),  INT16_C( 25211),  INT16_C( 32153),  INT16_C(  6120) },
+      { -INT16_C( 10842),  INT16_C( 13768),  INT16_C(  7475),  INT16_C( 14095), -INT16_C( 24940), -INT16_C( 27162), -INT16_C( 15208), -INT16_C( 14926) } },
+    { { -INT16_C( 11722),  INT16_C( 28807), -INT16_C(  8290), -INT16_C(  1805), -INT16_C( 26312),  INT16_C( 17972),  INT16_C( 31109), -INT16_C( 28011) },
+      { -INT16_C( 16832),  INT16_C( 31439),  INT16_C(  1292),  INT16_C( 24668), -INT16_C(  5561), -INT16_C(  5235), -INT16_C( 27186),  INT16_C( 25490) },
+      { -INT16_C( 11723),  INT16_C( 27213), -INT16_C(  8458),  INT16_C( 24839),  INT16_C( 14916),  INT16_C(  8177),  INT16_C( 11104), -INT16_C(  3733) },
+      { -INT16_C( 19082),  INT16_C(  5834),  INT16_C(  8486),  INT16_C( 30583), -INT16_C(  5612),  INT16_C(  6385),  INT16_C( 16581), -INT16_C( 23909) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 c = simde_msa_ld_h(test_vec[i].c, 0);
+    simde_v8i16 r = simde_msa_maddv_h(a, b, c);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 c = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_maddv_h(a, b, c);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_maddv_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t c[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   554658151),  INT32_C(  1968151754),  INT32_C(   959911127),  INT32_C(   798326090) },
+      {  INT32_C(  1997776246),  INT32_C(  2028909454), -INT32_C(  1511961009), -INT32_C(  1924572610) },
+      { -INT32_C(   145372975), -INT32_C(   168779137), -INT32_C(  1612856821), -INT32_C(    75388147) },
+      {  INT32_C(   963435503), -INT32_C(  1132819396), -INT32_C(  1032826820), -INT32_C(  1630241680) } },
+    { {  INT32_C(  1024770875), -INT32_C(  1744922846),  INT32_C(  1277694372),  INT32_C(   461521045) },
+      {  INT32_C(  1083239197),  INT32_C(   357587777), -INT32_C(  1571355156), -INT32_C(    39837912) },
+      {  INT32_C(  1909504735), -INT32_C(   607320571),  INT32_C(  1722675801), -INT32_C(  1036421240) },
+      { -INT32_C(  1699437698), -INT32_C(  1832852121),  INT32_C(   142489776), -INT32_C(  2030672427) } },
+    { {  INT32_C(   268248808),  INT32_C(   343167652), -INT32_C(  1046845940),  INT32_C(   453588294) },
+      {  INT32_C(  1743209959),  INT32_C(  1759350885), -INT32_C(  1472557995),  INT32_C(  1900460547) },
+      { -INT32_C(  1769692729),  INT32_C(   508507152), -INT32_C(  2024414080),  INT32_C(   627579283) },
+      { -INT32_C(  1395211143),  INT32_C(   147643636),  INT32_C(  1863664780),  INT32_C(   252203007) } },
+    { { -INT32_C(   229787289), -INT32_C(  1015407091),  INT32_C(   488237337),  INT32_C(   455233973) },
+      { -INT32_C(    71441948), -INT32_C(  2028292279),  INT32_C(  1204319573),  INT32_C(  1779966234) },
+      {  INT32_C(   844681755), -INT32_C(  1416013569), -INT32_C(   264771257), -INT32_C(  1674732591) },
+      {  INT32_C(  1895928947), -INT32_C(   742864956),  INT32_C(  1572851884), -INT32_C(    26077713) } },
+    { {  INT32_C(  1721733268), -INT32_C(  1489459163), -INT32_C(   512020359), -INT32_C(  1361998333) },
+      {  INT32_C(  1222215191),  INT32_C(  1881254092),  INT32_C(   880933490),  INT32_C(  2065418836) },
+      {  INT32_C(   555604802), -INT32_C(  1971738293),  INT32_C(   214821436), -INT32_C(  1575948118) },
+      {  INT32_C(  1812254594),  INT32_C(  2045757417), -INT32_C(   467134671),  INT32_C(  1244965323) } },
+    { { -INT32_C(   632117581), -INT32_C(  1139207344), -INT32_C(   891539882),  INT32_C(  1274645221) },
+      {  INT32_C(   944795912), -INT32_C(   562433040),  INT32_C(   400218036),  INT32_C(  1651996011) },
+      { -INT32_C(  1362763878), -INT32_C(  1733959631), -INT32_C(   176065227),  INT32_C(  1094207996) },
+      {  INT32_C(   945069443), -INT32_C(  1064123328), -INT32_C(  1250682214),  INT32_C(   611623737) } },
+    { { -INT32_C(   307719173),  INT32_C(  1830581842),  INT32_C(  1773175338),  INT32_C(   965182792) },
+      {  INT32_C(   525850094),  INT32_C(  1271832711), -INT32_C(  1350630401), -INT32_C(    17963762) },
+      {  INT32_C(   923336124), -INT32_C(    41216040), -INT32_C(   363794271),  INT32_C(   641051037) },
+      { -INT32_C(  1845107517), -INT32_C(  2010314438),  INT32_C(   838931849),  INT32_C(   495533278) } },
+    { {  INT32_C(   164354141), -INT32_C(  1259173544), -INT32_C(   292821574), -INT32_C(   437096287) },
+      { -INT32_C(  1441698956),  INT32_C(  2005981408),  INT32_C(   995073954),  INT32_C(  1153872831) },
+      {  INT32_C(  1008065123), -INT32_C(  1593428944), -INT32_C(  2077534189),  INT32_C(  1028578558) },
+      { -INT32_C(  1534251463), -INT32_C(  2123844776),  INT32_C(   210398912),  INT32_C(   750971939) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 c = simde_msa_ld_w(test_vec[i].c, 0);
+    simde_v4i32 r = simde_msa_maddv_w(a, b, c);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 c = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_maddv_w(a, b, c);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_maddv_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t c[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 2697504585412558799),  INT64_C(  928824378103510648) },
+      { -INT64_C(  266569780466816566), -INT64_C( 4073082870052872932) },
+      { -INT64_C( 7201195323697265495), -INT64_C( 1509124962601606156) },
+      {  INT64_C(  219282046094753321), -INT64_C( 7467459041695577816) } },
+    { {  INT64_C( 5094869045624398630), -INT64_C( 1280151515893130901) },
+      {  INT64_C( 6503612283239498937), -INT64_C( 2686866132726147305) },
+      { -INT64_C( 3274234876572904298), -INT64_C( 3791059425736620239) },
+      {  INT64_C( 2626382793315507084), -INT64_C( 8481671673408444974) } },
+    { {  INT64_C( 3022924767951531750), -INT64_C( 7906240922705432570) },
+      {  INT64_C( 1197980853351858708), -INT64_C( 8768505625892684174) },
+      {  INT64_C( 3941618786651343508),  INT64_C( 4207862616829899725) },
+      { -INT64_C( 2973606559801398666),  INT64_C( 5006970295967541072) } },
+    { {  INT64_C( 6624715875861752993), -INT64_C( 4623899260820252691) },
+      { -INT64_C(  938444512545607117),  INT64_C( 6114656068308161580) },
+      {  INT64_C( 7906312209320183219), -INT64_C( 7752918256899532652) },
+      { -INT64_C( 1453605402676312758),  INT64_C( 2696112896584311133) } },
+    { { -INT64_C( 4331485118923185050),  INT64_C( 1715689894957903054) },
+      { -INT64_C( 3577327354082561968),  INT64_C( 7477331936193588938) },
+      { -INT64_C(  950594780068279020),  INT64_C( 1770262350399509969) },
+      { -INT64_C( 2477622260715210074),  INT64_C( 3574213227117130168) } },
+    { { -INT64_C( 7697968423568590170),  INT64_C( 5810082580544000474) },
+      { -INT64_C( 6026177478728529775), -INT64_C( 6345541952149147871) },
+      { -INT64_C( 6618832377729531533), -INT64_C( 7524396487633528503) },
+      {  INT64_C( 4446575487603778761),  INT64_C( 8718947914329471811) } },
+    { { -INT64_C( 2190103832783242538), -INT64_C( 1721620527472660822) },
+      { -INT64_C( 7165916225165979600),  INT64_C(  399611030927809161) },
+      { -INT64_C( 2499009006709231479), -INT64_C( 4649911171470536034) },
+      { -INT64_C( 5584200862449572730), -INT64_C( 8346039469277810376) } },
+    { { -INT64_C( 8211972881149662081),  INT64_C( 4731323249985164466) },
+      { -INT64_C( 2835439888516894536), -INT64_C( 2493815085827699285) },
+      { -INT64_C( 3739634157195484862),  INT64_C( 3360512789695078532) },
+      { -INT64_C( 3040761697185352721), -INT64_C( 2034458840350555938) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 c = simde_msa_ld_d(test_vec[i].c, 0);
+    simde_v2i64 r = simde_msa_maddv_d(a, b, c);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 c = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_maddv_d(a, b, c);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, c, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(maddv_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(maddv_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(maddv_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(maddv_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN mulv
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/mulv.h"
+
+static int
+test_simde_mulv_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  90),  INT8_C(  49),  INT8_C(  19), -INT8_C(  84),  INT8_C(  48),  INT8_C(  73),  INT8_C(  84), -INT8_C( 119),
+        -INT8_C( 112), -INT8_C(  75),  INT8_C(  99), -INT8_C(  13),  INT8_C(  50), -INT8_C(  85),  INT8_C( 126),  INT8_C(  40) },
+      {  INT8_C(  86), -INT8_C(  26),  INT8_C( 100), -INT8_C(  41), -INT8_C(  16),  INT8_C(  94),  INT8_C(  80), -INT8_C(  28),
+         INT8_C(  88),  INT8_C(  24),  INT8_C(  14), -INT8_C(  16),  INT8_C(  82),  INT8_C( 113), -INT8_C(  55),  INT8_C(  29) },
+      { -INT8_C(  60),  INT8_C(   6),  INT8_C( 108),  INT8_C( 116),  INT8_C(   0), -INT8_C(  50),  INT8_C(  64),  INT8_C(   4),
+             INT8_MIN, -INT8_C(   8),  INT8_C( 106), -INT8_C(  48),  INT8_C(   4),  INT8_C( 123), -INT8_C(  18), -INT8_C( 120) } },
+    { {  INT8_C(  25),  INT8_C( 113),  INT8_C(  75), -INT8_C(  78),  INT8_C(  60), -INT8_C(  57),  INT8_C(   7), -INT8_C(  52),
+         INT8_C(  46), -INT8_C(  93),  INT8_C(  75), -INT8_C(  45),  INT8_C(  84),  INT8_C(  90),  INT8_C( 110),  INT8_C(  16) },
+      { -INT8_C(  49),  INT8_C(  36), -INT8_C(  23),  INT8_C(  14), -INT8_C( 121), -INT8_C( 117),  INT8_C(  76),  INT8_C(  84),
+        -INT8_C(  59),  INT8_C(  95), -INT8_C(  51),  INT8_C(  20), -INT8_C( 124), -INT8_C( 104), -INT8_C( 108),  INT8_C(  29) },
+      {  INT8_C(  55), -INT8_C(  28),  INT8_C(  67), -INT8_C(  68), -INT8_C(  92),  INT8_C(  13),  INT8_C(  20), -INT8_C(  16),
+         INT8_C( 102),  INT8_C( 125),  INT8_C(  15),  INT8_C( 124),  INT8_C(  80),  INT8_C( 112), -INT8_C( 104), -INT8_C(  48) } },
+    { { -INT8_C(  67), -INT8_C( 125), -INT8_C(  99), -INT8_C( 109), -INT8_C( 124), -INT8_C(  51), -INT8_C(  39),  INT8_C( 101),
+         INT8_C(  61), -INT8_C(  10), -INT8_C(  95), -INT8_C( 114), -INT8_C(  30),  INT8_C(   3),      INT8_MAX, -INT8_C( 117) },
+      { -INT8_C(  64), -INT8_C(  29), -INT8_C(  71), -INT8_C(  44), -INT8_C( 111),  INT8_C(  65), -INT8_C(  14), -INT8_C(  25),
+        -INT8_C(  24), -INT8_C(   4),  INT8_C(  42), -INT8_C(  12),      INT8_MIN, -INT8_C(  69),  INT8_C(   1),  INT8_C(  33) },
+      { -INT8_C(  64),  INT8_C(  41),  INT8_C( 117), -INT8_C(  68), -INT8_C(  60),  INT8_C(  13),  INT8_C(  34),  INT8_C(  35),
+         INT8_C(  72),  INT8_C(  40),  INT8_C( 106),  INT8_C(  88),  INT8_C(   0),  INT8_C(  49),      INT8_MAX, -INT8_C(  21) } },
+    { { -INT8_C(  10),  INT8_C(  84), -INT8_C( 100),  INT8_C(  36),  INT8_C(  82),  INT8_C(  22), -INT8_C(  45),  INT8_C(  19),
+         INT8_C(  80), -INT8_C(  69),  INT8_C(  94), -INT8_C( 102),  INT8_C(  65),  INT8_C(  82),      INT8_MAX, -INT8_C( 115) },
+      {  INT8_C(  38),  INT8_C(  71), -INT8_C(  58), -INT8_C(  51), -INT8_C(  41),  INT8_C(  48),  INT8_C( 113),  INT8_C(  78),
+        -INT8_C(  84),  INT8_C(  38), -INT8_C(  27),  INT8_C( 115), -INT8_C( 106),  INT8_C(  98), -INT8_C(  15), -INT8_C(   9) },
+      { -INT8_C( 124),  INT8_C(  76), -INT8_C(  88), -INT8_C(  44), -INT8_C(  34),  INT8_C(  32),  INT8_C(  35), -INT8_C(  54),
+        -INT8_C(  64), -INT8_C(  62),  INT8_C(  22),  INT8_C(  46),  INT8_C(  22),  INT8_C( 100), -INT8_C( 113),  INT8_C(  11) } },
+    { {  INT8_C( 100), -INT8_C(  40),  INT8_C(  45), -INT8_C(  43), -INT8_C(  38), -INT8_C( 112),  INT8_C( 105), -INT8_C( 101),
+         INT8_C( 109),  INT8_C(  31), -INT8_C( 101), -INT8_C(  74),  INT8_C(  26), -INT8_C(  10),  INT8_C(  35), -INT8_C(  16) },
+      { -INT8_C(  69), -INT8_C(  31), -INT8_C(  44), -INT8_C(  25), -INT8_C(  74),  INT8_C(   0),  INT8_C(  34),  INT8_C(  56),
+        -INT8_C( 124), -INT8_C(  52),  INT8_C(  61), -INT8_C(  32), -INT8_C(  11),  INT8_C(  93), -INT8_C(  16),  INT8_C(   0) },
+      {  INT8_C(  12), -INT8_C(  40),  INT8_C(  68),  INT8_C(  51), -INT8_C(   4),  INT8_C(   0), -INT8_C(  14), -INT8_C(  24),
+         INT8_C(  52), -INT8_C(  76), -INT8_C(  17),  INT8_C(  64), -INT8_C(  30),  INT8_C(  94), -INT8_C(  48),  INT8_C(   0) } },
+    { {  INT8_C(   0),  INT8_C(  44),  INT8_C(  35),  INT8_C(  72),  INT8_C( 108),  INT8_C(  24), -INT8_C(  21), -INT8_C(  70),
+        -INT8_C(  45), -INT8_C(  91),  INT8_C(   3), -INT8_C(  91), -INT8_C(  76), -INT8_C(  15), -INT8_C(  24), -INT8_C(  63) },
+      { -INT8_C( 108),  INT8_C(  12),  INT8_C(  59),  INT8_C(  35), -INT8_C(  94),  INT8_C(  18), -INT8_C(  74),  INT8_C(  45),
+         INT8_C(  87),  INT8_C(  59), -INT8_C(  65),  INT8_C(  59),  INT8_C(  19), -INT8_C(  65),  INT8_C(  49), -INT8_C(  61) },
+      {  INT8_C(   0),  INT8_C(  16),  INT8_C(  17), -INT8_C(  40),  INT8_C(  88), -INT8_C(  80),  INT8_C(  18), -INT8_C(  78),
+        -INT8_C(  75),  INT8_C(   7),  INT8_C(  61),  INT8_C(   7),  INT8_C(  92), -INT8_C(  49),  INT8_C( 104),  INT8_C(   3) } },
+    { { -INT8_C(  39), -INT8_C( 120),  INT8_C(  98), -INT8_C(   9),  INT8_C(  34), -INT8_C(  20),  INT8_C(  95), -INT8_C(  21),
+        -INT8_C(  20),  INT8_C(  77),  INT8_C(  99),  INT8_C(  65), -INT8_C(  98), -INT8_C(  25), -INT8_C(   3),  INT8_C( 104) },
+      {  INT8_C(  54),  INT8_C(  34),  INT8_C(  23), -INT8_C(  17),  INT8_C(   2), -INT8_C(  10), -INT8_C(  11), -INT8_C(  21),
+        -INT8_C(   4), -INT8_C(   2), -INT8_C(  23),  INT8_C( 114),  INT8_C(  27), -INT8_C( 107), -INT8_C(  74),  INT8_C(  89) },
+      { -INT8_C(  58),  INT8_C(  16), -INT8_C(  50), -INT8_C( 103),  INT8_C(  68), -INT8_C(  56), -INT8_C(  21), -INT8_C(  71),
+         INT8_C(  80),  INT8_C( 102),  INT8_C(  27), -INT8_C(  14), -INT8_C(  86),  INT8_C( 115), -INT8_C(  34),  INT8_C(  40) } },
+    { { -INT8_C(  55), -INT8_C( 123),  INT8_C(  10),  INT8_C(  45),  INT8_C(  75),  INT8_C(  29), -INT8_C(  93), -INT8_C(   1),
+        -INT8_C(  82), -INT8_C( 108), -INT8_C(  72),  INT8_C(  25), -INT8_C(  37), -INT8_C(  41),  INT8_C(  67),  INT8_C(  34) },
+      { -INT8_C(  51),  INT8_C( 108), -INT8_C(  46), -INT8_C(  71),  INT8_C(  59), -INT8_C(  49), -INT8_C( 116), -INT8_C( 107),
+         INT8_C(  78), -INT8_C(  45),  INT8_C(  82), -INT8_C( 127), -INT8_C(  83),  INT8_C(  75),  INT8_C(  90), -INT8_C(  32) },
+      { -INT8_C(  11),  INT8_C(  28),  INT8_C(  52), -INT8_C( 123),  INT8_C(  73),  INT8_C( 115),  INT8_C(  36),  INT8_C( 107),
+         INT8_C(   4), -INT8_C(   4), -INT8_C(  16), -INT8_C( 103), -INT8_C(   1), -INT8_C(   3), -INT8_C( 114), -INT8_C(  64) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_mulv_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_mulv_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mulv_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C(  8610), -INT16_C(  6924), -INT16_C( 19258),  INT16_C(    32),  INT16_C(  3154), -INT16_C( 30610), -INT16_C( 21700),  INT16_C( 11516) },
+      {  INT16_C(  3912), -INT16_C( 21510), -INT16_C( 31596),  INT16_C(  1883), -INT16_C( 15628),  INT16_C( 26397), -INT16_C(  5534),  INT16_C( 11193) },
+      { -INT16_C(  3184), -INT16_C( 28088), -INT16_C( 25992), -INT16_C(  5280), -INT16_C(  7640), -INT16_C( 18826),  INT16_C( 25848), -INT16_C( 10724) } },
+    { {  INT16_C( 14428), -INT16_C(  1733), -INT16_C(  5379),  INT16_C(  9533), -INT16_C(  5683),  INT16_C(  4033), -INT16_C(  1088), -INT16_C(  4522) },
+      { -INT16_C( 32364),  INT16_C( 17570), -INT16_C(  9289),  INT16_C( 14690),  INT16_C(  1108), -INT16_C( 17099),  INT16_C(   811), -INT16_C( 29753) },
+      { -INT16_C(  3792),  INT16_C( 25430),  INT16_C( 27099), -INT16_C( 10662), -INT16_C(  5308), -INT16_C( 16395), -INT16_C( 30400), -INT16_C(  2342) } },
+    { { -INT16_C(  1731),  INT16_C( 25797),  INT16_C( 30742), -INT16_C(  9172), -INT16_C( 18115),  INT16_C( 13089), -INT16_C(  3282), -INT16_C( 17231) },
+      { -INT16_C(  6743),  INT16_C(  4460), -INT16_C( 29859),  INT16_C(  8124),  INT16_C( 20653), -INT16_C( 28103),  INT16_C( 22891), -INT16_C( 20719) },
+      {  INT16_C(  6725), -INT16_C( 26596), -INT16_C( 28162),  INT16_C(  1104),  INT16_C( 15929),  INT16_C( 13401), -INT16_C( 24006), -INT16_C( 31039) } },
+    { { -INT16_C(  3585),  INT16_C(  9073), -INT16_C( 13964), -INT16_C( 15548), -INT16_C( 28890),  INT16_C( 13652),  INT16_C( 24661), -INT16_C(    33) },
+      { -INT16_C( 32512), -INT16_C( 27612), -INT16_C(  4661),  INT16_C(  1059), -INT16_C( 13411), -INT16_C(  3976), -INT16_C( 24540), -INT16_C( 16837) },
+      {  INT16_C( 32512),  INT16_C( 20452),  INT16_C(  8956), -INT16_C( 15796), -INT16_C(  5042), -INT16_C( 16544), -INT16_C( 21516),  INT16_C( 31333) } },
+    { {  INT16_C(  1165),  INT16_C(  8020), -INT16_C(   264), -INT16_C( 30574), -INT16_C( 21441),  INT16_C( 12161),  INT16_C(  9848), -INT16_C(  6481) },
+      {  INT16_C( 10851), -INT16_C( 22903),  INT16_C( 12724), -INT16_C(  1201),  INT16_C( 31133), -INT16_C(    17), -INT16_C(  6471), -INT16_C( 12732) },
+      { -INT16_C(  7033),  INT16_C( 15348), -INT16_C( 16800),  INT16_C( 19214),  INT16_C( 27043), -INT16_C( 10129), -INT16_C( 25416),  INT16_C(  6268) } },
+    { {  INT16_C( 17317), -INT16_C( 11289), -INT16_C( 29544),  INT16_C(  4814),  INT16_C(  2741),  INT16_C( 14614),  INT16_C( 25822),  INT16_C( 32345) },
+      {  INT16_C(  2949),  INT16_C(  2452),  INT16_C(  9666),  INT16_C( 12928), -INT16_C( 21914),  INT16_C( 11778), -INT16_C( 12765), -INT16_C( 29070) },
+      {  INT16_C( 15289), -INT16_C( 24436), -INT16_C( 31952), -INT16_C( 23808),  INT16_C( 30238),  INT16_C( 26156),  INT16_C( 28250), -INT16_C( 24158) } },
+    { { -INT16_C(  3066), -INT16_C(  2810),  INT16_C( 31108), -INT16_C( 29299), -INT16_C( 11215),  INT16_C( 15478), -INT16_C(  1811), -INT16_C( 28915) },
+      { -INT16_C( 32764),  INT16_C( 21909),  INT16_C( 14800), -INT16_C( 29202), -INT16_C(  2695), -INT16_C( 12207), -INT16_C(  9084), -INT16_C( 26426) },
+      { -INT16_C( 12264), -INT16_C( 25986),  INT16_C(  8000),  INT16_C( 16918),  INT16_C( 12329),  INT16_C(   342),  INT16_C(  1588),  INT16_C( 23566) } },
+    { {  INT16_C( 22122),  INT16_C( 11883),  INT16_C( 20926),  INT16_C(  6708), -INT16_C( 27850), -INT16_C( 15525),  INT16_C(  7006),  INT16_C( 14120) },
+      {  INT16_C( 31121),  INT16_C( 29987),  INT16_C(  3552),  INT16_C( 17388),  INT16_C( 15285),  INT16_C( 25334),  INT16_C( 10887),  INT16_C( 16431) },
+      {  INT16_C(  3082),  INT16_C( 16289),  INT16_C( 11328), -INT16_C( 15376), -INT16_C( 30930), -INT16_C( 28814), -INT16_C(  9582),  INT16_C(  8280) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_mulv_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_mulv_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mulv_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1888439949),  INT32_C(   227433105),  INT32_C(  1039985107), -INT32_C(  2028594520) },
+      {  INT32_C(  1393359240), -INT32_C(  2061861063), -INT32_C(   690544501),  INT32_C(  1813882436) },
+      {  INT32_C(  1792745496),  INT32_C(   727325001),  INT32_C(   130176401),  INT32_C(   472908960) } },
+    { {  INT32_C(  1815702639), -INT32_C(  1082790899),  INT32_C(    91431850), -INT32_C(   828934262) },
+      {  INT32_C(  2118506195), -INT32_C(  1243448027),  INT32_C(  1507952647),  INT32_C(  1842426796) },
+      {  INT32_C(   266611069), -INT32_C(   725125407), -INT32_C(  1014871642),  INT32_C(  1413402296) } },
+    { { -INT32_C(  1120346390),  INT32_C(  1808690601),  INT32_C(   714985575),  INT32_C(   602372530) },
+      { -INT32_C(  1883647257), -INT32_C(    28707338),  INT32_C(   174633288), -INT32_C(   766472012) },
+      {  INT32_C(   843520294),  INT32_C(   444669286), -INT32_C(   917384200),  INT32_C(  2127933736) } },
+    { {  INT32_C(  1658471767), -INT32_C(  1093838508),  INT32_C(  1331707892), -INT32_C(   820745671) },
+      {  INT32_C(  2078868546), -INT32_C(   159398252), -INT32_C(   877006758),  INT32_C(  1155299506) },
+      { -INT32_C(   829801362),  INT32_C(   712678544), -INT32_C(   685818936), -INT32_C(    84372574) } },
+    { { -INT32_C(   564145025),  INT32_C(   197475263), -INT32_C(  2130754705), -INT32_C(   867948279) },
+      {  INT32_C(  1209752049),  INT32_C(   751694366),  INT32_C(  1240195757), -INT32_C(   471204862) },
+      { -INT32_C(   897830257),  INT32_C(  2139786850),  INT32_C(   334336003),  INT32_C(    85863954) } },
+    { {  INT32_C(  1101933000), -INT32_C(  2003888913),  INT32_C(   267769128),  INT32_C(  1216132617) },
+      { -INT32_C(   709092454),  INT32_C(  1928502270),  INT32_C(  2004151387), -INT32_C(  1138953510) },
+      { -INT32_C(   133350832),  INT32_C(  1469151778),  INT32_C(  2063836472),  INT32_C(   591627690) } },
+    { {  INT32_C(  2052425156),  INT32_C(   187438099),  INT32_C(   356698198), -INT32_C(     8840273) },
+      {  INT32_C(   466896289),  INT32_C(  1201792798),  INT32_C(  1056213358), -INT32_C(  1705585983) },
+      {  INT32_C(  1864823876), -INT32_C(    96829638), -INT32_C(  1512039692), -INT32_C(  2050134801) } },
+    { {  INT32_C(  1942144065),  INT32_C(   382694626),  INT32_C(  1601602806),  INT32_C(  1110513401) },
+      { -INT32_C(  2117621083), -INT32_C(   582860757), -INT32_C(   202245165), -INT32_C(  1202752146) },
+      {  INT32_C(  1113761765), -INT32_C(   296410634), -INT32_C(  1868379966), -INT32_C(   277959682) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_mulv_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_mulv_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_mulv_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 2358392656914079706), -INT64_C( 3230423204242336321) },
+      { -INT64_C( 6141745407620242524),  INT64_C( 2989267607591112068) },
+      { -INT64_C(  310569253085956696),  INT64_C( 5649054784475113852) } },
+    { { -INT64_C( 3856600034141704251), -INT64_C( 1857004051969506086) },
+      { -INT64_C( 6678592547374809763),  INT64_C( 3355256401655889091) },
+      { -INT64_C(  805272738179413103),  INT64_C(  584228118779972110) } },
+    { {  INT64_C( 5087847778275997215), -INT64_C( 3950151546055804022) },
+      {  INT64_C( 7782624755412795192),  INT64_C( 3698721378161467594) },
+      {  INT64_C( 2726441667724261320),  INT64_C( 2831407769897548516) } },
+    { { -INT64_C( 2271103193125693117), -INT64_C( 7936047761311382135) },
+      { -INT64_C( 1630737194477903668), -INT64_C( 2859004675621675696) },
+      {  INT64_C( 8795193113055789412),  INT64_C( 4921986093973618640) } },
+    { { -INT64_C(  625653552650743033), -INT64_C( 5234758995978982262) },
+      { -INT64_C( 2022346211580091365),  INT64_C( 1838724789937676740) },
+      { -INT64_C( 5535526079035654723),  INT64_C( 1130168209279148968) } },
+    { { -INT64_C( 3800116543265530181), -INT64_C( 3372714679703829468) },
+      { -INT64_C( 4552279415250850516), -INT64_C( 1689101810971938208) },
+      {  INT64_C( 6468914115703924516), -INT64_C( 8595658868740483712) } },
+    { { -INT64_C( 1189322865717653971), -INT64_C( 6320796046976257068) },
+      {  INT64_C( 5294558554951246118),  INT64_C( 6352034092344335194) },
+      {  INT64_C( 1665549107996403630), -INT64_C( 6814926178492541816) } },
+    { { -INT64_C( 4673993395765060565),  INT64_C( 2378209213541683884) },
+      { -INT64_C( 1499762205517083416), -INT64_C( 2819440352242424767) },
+      { -INT64_C( 1239826898343916808), -INT64_C( 1130700906426569300) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_mulv_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_mulv_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(mulv_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(mulv_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(mulv_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(mulv_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
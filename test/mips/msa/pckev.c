@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN pckev
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/pckev.h"
+
+static int
+test_simde_pckev_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  32),  INT8_C(  42), -INT8_C( 111),  INT8_C(  57), -INT8_C(  49), -INT8_C( 106), -INT8_C(  75),  INT8_C( 100),
+         INT8_C(  60),  INT8_C(  91),  INT8_C(   7),  INT8_C( 125), -INT8_C(  52), -INT8_C(  97),  INT8_C(  87),  INT8_C(  45) },
+      { -INT8_C(  82),  INT8_C(  76), -INT8_C( 110),  INT8_C(  50), -INT8_C(  52),  INT8_C(  84), -INT8_C( 102), -INT8_C(  84),
+         INT8_C(  46), -INT8_C(  72), -INT8_C(  62),  INT8_C(  46), -INT8_C(  95),  INT8_C(  37),  INT8_C( 123),  INT8_C(  12) },
+      { -INT8_C(  82), -INT8_C( 110), -INT8_C(  52), -INT8_C( 102),  INT8_C(  46), -INT8_C(  62), -INT8_C(  95),  INT8_C( 123),
+         INT8_C(  32), -INT8_C( 111), -INT8_C(  49), -INT8_C(  75),  INT8_C(  60),  INT8_C(   7), -INT8_C(  52),  INT8_C(  87) } },
+    { { -INT8_C( 107), -INT8_C(  15), -INT8_C(  45),  INT8_C(   2),  INT8_C( 107),  INT8_C(  91),  INT8_C(  87), -INT8_C(  58),
+         INT8_C(  33),  INT8_C(  62), -INT8_C(   5),  INT8_C(  32),  INT8_C(  97),  INT8_C(  30),  INT8_C(  45), -INT8_C( 102) },
+      { -INT8_C(  67), -INT8_C(   4),      INT8_MIN, -INT8_C(  27), -INT8_C( 100),  INT8_C(  28),  INT8_C( 118), -INT8_C(  76),
+         INT8_C(  93),  INT8_C( 112),  INT8_C(  69), -INT8_C(  22),  INT8_C(  99), -INT8_C(  16),  INT8_C(  86), -INT8_C(  78) },
+      { -INT8_C(  67),      INT8_MIN, -INT8_C( 100),  INT8_C( 118),  INT8_C(  93),  INT8_C(  69),  INT8_C(  99),  INT8_C(  86),
+        -INT8_C( 107), -INT8_C(  45),  INT8_C( 107),  INT8_C(  87),  INT8_C(  33), -INT8_C(   5),  INT8_C(  97),  INT8_C(  45) } },
+    { { -INT8_C(  32), -INT8_C(   3),      INT8_MAX,  INT8_C(   9),  INT8_C(  39),  INT8_C( 104), -INT8_C(  64), -INT8_C(  34),
+         INT8_C(  79), -INT8_C( 124), -INT8_C(  19),  INT8_C(  78), -INT8_C(  10), -INT8_C(  87), -INT8_C(  86), -INT8_C(  62) },
+      {  INT8_C( 118), -INT8_C(  85),  INT8_C( 110),  INT8_C(  45),  INT8_C(  32),  INT8_C(  89),  INT8_C(  61),  INT8_C(  71),
+        -INT8_C( 121), -INT8_C(  15),  INT8_C(  78), -INT8_C( 126), -INT8_C(  94),  INT8_C(   7), -INT8_C(  93),  INT8_C(  85) },
+      {  INT8_C( 118),  INT8_C( 110),  INT8_C(  32),  INT8_C(  61), -INT8_C( 121),  INT8_C(  78), -INT8_C(  94), -INT8_C(  93),
+        -INT8_C(  32),      INT8_MAX,  INT8_C(  39), -INT8_C(  64),  INT8_C(  79), -INT8_C(  19), -INT8_C(  10), -INT8_C(  86) } },
+    { {  INT8_C(  31),  INT8_C(   3), -INT8_C(  40), -INT8_C(   6), -INT8_C(  58), -INT8_C(  39), -INT8_C( 104),  INT8_C( 120),
+         INT8_C(  86),  INT8_C(  33),  INT8_C(  12), -INT8_C(  57), -INT8_C(  34),  INT8_C(  80), -INT8_C(  60), -INT8_C(  91) },
+      {  INT8_C(  34), -INT8_C( 113), -INT8_C(  11), -INT8_C(  50), -INT8_C(  14), -INT8_C(  61),  INT8_C(  70), -INT8_C(  12),
+         INT8_C(  30), -INT8_C(   5), -INT8_C( 127), -INT8_C(   5),  INT8_C( 114), -INT8_C(  55),  INT8_C(  32),  INT8_C(  65) },
+      {  INT8_C(  34), -INT8_C(  11), -INT8_C(  14),  INT8_C(  70),  INT8_C(  30), -INT8_C( 127),  INT8_C( 114),  INT8_C(  32),
+         INT8_C(  31), -INT8_C(  40), -INT8_C(  58), -INT8_C( 104),  INT8_C(  86),  INT8_C(  12), -INT8_C(  34), -INT8_C(  60) } },
+    { {  INT8_C(  64),  INT8_C(  60), -INT8_C(  42), -INT8_C(  96),  INT8_C(  62), -INT8_C(  46),  INT8_C(  41), -INT8_C(  95),
+         INT8_C(  83), -INT8_C(  31),  INT8_C(  72),  INT8_C(  47),  INT8_C(  87), -INT8_C(  13), -INT8_C(  65),  INT8_C(  32) },
+      { -INT8_C(  24), -INT8_C(  27), -INT8_C(   6), -INT8_C( 102),  INT8_C(  66), -INT8_C(  50),  INT8_C(  53),  INT8_C(  30),
+         INT8_C(  24),  INT8_C(  22),  INT8_C(  92),  INT8_C( 120), -INT8_C(  28), -INT8_C( 126),  INT8_C( 107),  INT8_C(  99) },
+      { -INT8_C(  24), -INT8_C(   6),  INT8_C(  66),  INT8_C(  53),  INT8_C(  24),  INT8_C(  92), -INT8_C(  28),  INT8_C( 107),
+         INT8_C(  64), -INT8_C(  42),  INT8_C(  62),  INT8_C(  41),  INT8_C(  83),  INT8_C(  72),  INT8_C(  87), -INT8_C(  65) } },
+    { {  INT8_C(  40),  INT8_C(  76),  INT8_C(  87),  INT8_C(  30),  INT8_C(  89), -INT8_C(  13),  INT8_C(  27), -INT8_C(  53),
+        -INT8_C(  45), -INT8_C(  63),  INT8_C(   7),  INT8_C(  39), -INT8_C( 123),  INT8_C( 102), -INT8_C(  84),  INT8_C(  96) },
+      {  INT8_C(  29),  INT8_C(  55), -INT8_C(  90),  INT8_C( 117),  INT8_C(  71), -INT8_C(  68), -INT8_C(  83), -INT8_C(  67),
+         INT8_C( 102), -INT8_C(  70), -INT8_C(  48),  INT8_C(  91), -INT8_C(  23),  INT8_C(  81),  INT8_C(  53),  INT8_C(  36) },
+      {  INT8_C(  29), -INT8_C(  90),  INT8_C(  71), -INT8_C(  83),  INT8_C( 102), -INT8_C(  48), -INT8_C(  23),  INT8_C(  53),
+         INT8_C(  40),  INT8_C(  87),  INT8_C(  89),  INT8_C(  27), -INT8_C(  45),  INT8_C(   7), -INT8_C( 123), -INT8_C(  84) } },
+    { {  INT8_C(  88),  INT8_C(   5), -INT8_C(  81), -INT8_C(  21), -INT8_C(  41), -INT8_C(  56),  INT8_C(  66), -INT8_C( 122),
+        -INT8_C(  70),  INT8_C(  88), -INT8_C(  17),  INT8_C(   5),  INT8_C(  97), -INT8_C(  57), -INT8_C(  73), -INT8_C( 120) },
+      { -INT8_C(  32),  INT8_C(  68),  INT8_C(  29),  INT8_C(  84), -INT8_C(  19),  INT8_C( 105),  INT8_C( 109), -INT8_C(   7),
+        -INT8_C(   8), -INT8_C(  84), -INT8_C( 105),  INT8_C(  61),  INT8_C(  39), -INT8_C( 111), -INT8_C(  28),  INT8_C(  27) },
+      { -INT8_C(  32),  INT8_C(  29), -INT8_C(  19),  INT8_C( 109), -INT8_C(   8), -INT8_C( 105),  INT8_C(  39), -INT8_C(  28),
+         INT8_C(  88), -INT8_C(  81), -INT8_C(  41),  INT8_C(  66), -INT8_C(  70), -INT8_C(  17),  INT8_C(  97), -INT8_C(  73) } },
+    { { -INT8_C(  72),  INT8_C( 125),  INT8_C(  87), -INT8_C(  39), -INT8_C( 110),  INT8_C(  13),  INT8_C(  17), -INT8_C( 122),
+        -INT8_C(  42),  INT8_C(  67), -INT8_C(  60), -INT8_C(  46),  INT8_C(  53),      INT8_MAX, -INT8_C(  73), -INT8_C(  28) },
+      { -INT8_C(   8),  INT8_C(  50),  INT8_C(  78),  INT8_C(  94), -INT8_C(  98),  INT8_C(  18),  INT8_C(  47), -INT8_C(  25),
+        -INT8_C(  63), -INT8_C(  86),  INT8_C(  80),  INT8_C(  52), -INT8_C(  56),  INT8_C(  27), -INT8_C(  63),  INT8_C(  17) },
+      { -INT8_C(   8),  INT8_C(  78), -INT8_C(  98),  INT8_C(  47), -INT8_C(  63),  INT8_C(  80), -INT8_C(  56), -INT8_C(  63),
+        -INT8_C(  72),  INT8_C(  87), -INT8_C( 110),  INT8_C(  17), -INT8_C(  42), -INT8_C(  60),  INT8_C(  53), -INT8_C(  73) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_pckev_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_pckev_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pckev_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(  3840), -INT16_C( 29832), -INT16_C( 17270),  INT16_C( 13044), -INT16_C( 16857),  INT16_C(  7262), -INT16_C( 11787),  INT16_C(   645) },
+      {  INT16_C( 25405), -INT16_C(  4124), -INT16_C(  7049), -INT16_C( 17824), -INT16_C(  7958), -INT16_C( 23340), -INT16_C(  1913), -INT16_C( 18503) },
+      {  INT16_C( 25405), -INT16_C(  7049), -INT16_C(  7958), -INT16_C(  1913), -INT16_C(  3840), -INT16_C( 17270), -INT16_C( 16857), -INT16_C( 11787) } },
+    { {  INT16_C( 15581),  INT16_C(  7817),  INT16_C(  9903),  INT16_C( 11224), -INT16_C(  4302), -INT16_C( 25075),  INT16_C(  5640), -INT16_C(  4406) },
+      {  INT16_C(  3883),  INT16_C( 28558), -INT16_C(  7280),  INT16_C( 17927),  INT16_C( 10109), -INT16_C(  5227),  INT16_C( 30532), -INT16_C( 15999) },
+      {  INT16_C(  3883), -INT16_C(  7280),  INT16_C( 10109),  INT16_C( 30532),  INT16_C( 15581),  INT16_C(  9903), -INT16_C(  4302),  INT16_C(  5640) } },
+    { {  INT16_C(   701),  INT16_C( 25514),  INT16_C(  8542),  INT16_C( 15581), -INT16_C( 31013),  INT16_C( 15036),  INT16_C(  4961),  INT16_C( 17733) },
+      {  INT16_C( 19199),  INT16_C( 25246),  INT16_C( 11798),  INT16_C( 16172),  INT16_C( 31993),  INT16_C(  6170), -INT16_C( 24653),  INT16_C(  4781) },
+      {  INT16_C( 19199),  INT16_C( 11798),  INT16_C( 31993), -INT16_C( 24653),  INT16_C(   701),  INT16_C(  8542), -INT16_C( 31013),  INT16_C(  4961) } },
+    { { -INT16_C(   789),  INT16_C( 20956),  INT16_C( 26748), -INT16_C(  1241),  INT16_C( 13432), -INT16_C( 22222), -INT16_C( 14784),  INT16_C( 28450) },
+      { -INT16_C( 15835),  INT16_C( 12861),  INT16_C(  9164), -INT16_C(  1289),  INT16_C( 26889), -INT16_C( 25757),  INT16_C( 30381), -INT16_C(  5190) },
+      { -INT16_C( 15835),  INT16_C(  9164),  INT16_C( 26889),  INT16_C( 30381), -INT16_C(   789),  INT16_C( 26748),  INT16_C( 13432), -INT16_C( 14784) } },
+    { {  INT16_C( 24187), -INT16_C( 23713),  INT16_C(  1359), -INT16_C( 15069),  INT16_C(  7060),  INT16_C(  2995), -INT16_C( 14714), -INT16_C( 28307) },
+      {  INT16_C( 32424), -INT16_C(  1395), -INT16_C( 14344), -INT16_C(   515),  INT16_C(   394), -INT16_C(  9074),  INT16_C( 32161),  INT16_C( 20626) },
+      {  INT16_C( 32424), -INT16_C( 14344),  INT16_C(   394),  INT16_C( 32161),  INT16_C( 24187),  INT16_C(  1359),  INT16_C(  7060), -INT16_C( 14714) } },
+    { { -INT16_C( 17616),  INT16_C( 27102), -INT16_C( 26860),  INT16_C( 20182), -INT16_C( 16340), -INT16_C( 27331), -INT16_C( 15657), -INT16_C( 20593) },
+      { -INT16_C( 29260), -INT16_C( 18759),  INT16_C( 28025),  INT16_C( 20009),  INT16_C( 28580),  INT16_C(  5094), -INT16_C( 16984),  INT16_C(   383) },
+      { -INT16_C( 29260),  INT16_C( 28025),  INT16_C( 28580), -INT16_C( 16984), -INT16_C( 17616), -INT16_C( 26860), -INT16_C( 16340), -INT16_C( 15657) } },
+    { {  INT16_C( 28962), -INT16_C( 18768), -INT16_C( 21254), -INT16_C(   225), -INT16_C( 10417),  INT16_C( 32687),  INT16_C( 16214), -INT16_C( 26987) },
+      {  INT16_C( 19315), -INT16_C( 25660),  INT16_C(    67),  INT16_C( 19281), -INT16_C(  1831),  INT16_C(  7349),  INT16_C( 16995),  INT16_C(   177) },
+      {  INT16_C( 19315),  INT16_C(    67), -INT16_C(  1831),  INT16_C( 16995),  INT16_C( 28962), -INT16_C( 21254), -INT16_C( 10417),  INT16_C( 16214) } },
+    { { -INT16_C( 17175),  INT16_C( 12881),  INT16_C( 25215),  INT16_C( 15272), -INT16_C( 26741), -INT16_C( 11622), -INT16_C( 19521), -INT16_C(  5403) },
+      { -INT16_C(  5911), -INT16_C( 21912), -INT16_C( 20505), -INT16_C( 21367), -INT16_C(  9094), -INT16_C(   791), -INT16_C( 30148),  INT16_C( 25062) },
+      { -INT16_C(  5911), -INT16_C( 20505), -INT16_C(  9094), -INT16_C( 30148), -INT16_C( 17175),  INT16_C( 25215), -INT16_C( 26741), -INT16_C( 19521) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_pckev_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_pckev_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pckev_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  2109772071),  INT32_C(   969928080),  INT32_C(   277535694), -INT32_C(  1169845610) },
+      {  INT32_C(   150374076),  INT32_C(  1854889556), -INT32_C(  1797891219), -INT32_C(  1232430700) },
+      {  INT32_C(   150374076), -INT32_C(  1797891219), -INT32_C(  2109772071),  INT32_C(   277535694) } },
+    { {  INT32_C(   703126033),  INT32_C(    30567154),  INT32_C(  2055366390), -INT32_C(   978566254) },
+      { -INT32_C(  1052400001), -INT32_C(   927905549),  INT32_C(  1627491279), -INT32_C(   215531412) },
+      { -INT32_C(  1052400001),  INT32_C(  1627491279),  INT32_C(   703126033),  INT32_C(  2055366390) } },
+    { {  INT32_C(   102150079),  INT32_C(  1955143666),  INT32_C(   284552847), -INT32_C(  1787898387) },
+      {  INT32_C(  1509525383), -INT32_C(  1764422581),  INT32_C(  1655702898),  INT32_C(    94810124) },
+      {  INT32_C(  1509525383),  INT32_C(  1655702898),  INT32_C(   102150079),  INT32_C(   284552847) } },
+    { {  INT32_C(   473894948),  INT32_C(  1612783921), -INT32_C(  1315466159),  INT32_C(  1826774790) },
+      { -INT32_C(  1851815309), -INT32_C(  1832825221),  INT32_C(  2103753255), -INT32_C(   457288715) },
+      { -INT32_C(  1851815309),  INT32_C(  2103753255),  INT32_C(   473894948), -INT32_C(  1315466159) } },
+    { {  INT32_C(  1892948200), -INT32_C(  2054682339), -INT32_C(  1320940052),  INT32_C(    40241755) },
+      {  INT32_C(   746191437), -INT32_C(   507115146),  INT32_C(  1156971276), -INT32_C(  1659986516) },
+      {  INT32_C(   746191437),  INT32_C(  1156971276),  INT32_C(  1892948200), -INT32_C(  1320940052) } },
+    { { -INT32_C(  1232186945), -INT32_C(  2007970170), -INT32_C(  1838437635), -INT32_C(   174664933) },
+      { -INT32_C(  1266171583), -INT32_C(   865086069), -INT32_C(  1690547485),  INT32_C(  2120531101) },
+      { -INT32_C(  1266171583), -INT32_C(  1690547485), -INT32_C(  1232186945), -INT32_C(  1838437635) } },
+    { {  INT32_C(   657354992),  INT32_C(  1314067667), -INT32_C(  1290434934), -INT32_C(  1466816428) },
+      {  INT32_C(  1763252285), -INT32_C(  1057920658), -INT32_C(  1552253358), -INT32_C(   733313669) },
+      {  INT32_C(  1763252285), -INT32_C(  1552253358),  INT32_C(   657354992), -INT32_C(  1290434934) } },
+    { {  INT32_C(  2106883528), -INT32_C(   114498242), -INT32_C(  1245491907),  INT32_C(  1202938100) },
+      {  INT32_C(  1610525892),  INT32_C(   125359266), -INT32_C(  1907811142), -INT32_C(  1465337040) },
+      {  INT32_C(  1610525892), -INT32_C(  1907811142),  INT32_C(  2106883528), -INT32_C(  1245491907) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_pckev_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_pckev_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pckev_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 3950673511173414768),  INT64_C( 1508985431803579017) },
+      { -INT64_C( 7018878051969668175), -INT64_C( 3815460153308930276) },
+      { -INT64_C( 7018878051969668175),  INT64_C( 3950673511173414768) } },
+    { { -INT64_C( 2685255388748153080), -INT64_C( 2667400183256863989) },
+      {  INT64_C( 7490614681124747338), -INT64_C( 5398671833822851767) },
+      {  INT64_C( 7490614681124747338), -INT64_C( 2685255388748153080) } },
+    { { -INT64_C( 6774208043133513716),  INT64_C( 1887623974237060412) },
+      {  INT64_C( 6919883396883808488),  INT64_C( 7384294544392731751) },
+      {  INT64_C( 6919883396883808488), -INT64_C( 6774208043133513716) } },
+    { { -INT64_C(  536746402836360923), -INT64_C( 2071148383557310469) },
+      {  INT64_C( 4357135666519377145),  INT64_C( 3697812131312404750) },
+      {  INT64_C( 4357135666519377145), -INT64_C(  536746402836360923) } },
+    { { -INT64_C( 2519542556578768334), -INT64_C( 8353395300489292206) },
+      {  INT64_C( 5285141409766377932), -INT64_C( 4335361493646818710) },
+      {  INT64_C( 5285141409766377932), -INT64_C( 2519542556578768334) } },
+    { { -INT64_C( 3104663084455991606), -INT64_C( 6668435644993194779) },
+      { -INT64_C(  800280686484690120), -INT64_C( 1575909206281877325) },
+      { -INT64_C(  800280686484690120), -INT64_C( 3104663084455991606) } },
+    { { -INT64_C( 5924845142530420649),  INT64_C( 2533912649275026390) },
+      {  INT64_C(  113797106327692169),  INT64_C( 5961366477181129038) },
+      {  INT64_C(  113797106327692169), -INT64_C( 5924845142530420649) } },
+    { {  INT64_C( 7584313351791317309),  INT64_C( 2376024373484857230) },
+      { -INT64_C( 5366533132005032226), -INT64_C( 7627711720373596223) },
+      { -INT64_C( 5366533132005032226),  INT64_C( 7584313351791317309) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_pckev_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_pckev_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(pckev_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(pckev_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(pckev_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(pckev_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
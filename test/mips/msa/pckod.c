@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN pckod
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/pckod.h"
+
+static int
+test_simde_pckod_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  80), -INT8_C( 112),  INT8_C(  55), -INT8_C(  94), -INT8_C(  19),  INT8_C( 100), -INT8_C(  96),  INT8_C(  25),
+        -INT8_C(   5),  INT8_C(  24),  INT8_C(  92), -INT8_C(  35),  INT8_C(  17),  INT8_C(  16),  INT8_C(  13),  INT8_C(  15) },
+      {  INT8_C( 124), -INT8_C(  34),  INT8_C(  69),  INT8_C(  84), -INT8_C(  17),  INT8_C(  23), -INT8_C(  37),  INT8_C(   6),
+         INT8_C(  61),  INT8_C(  75),  INT8_C( 120), -INT8_C(  65),  INT8_C(  40),  INT8_C(  20), -INT8_C(  74), -INT8_C( 112) },
+      { -INT8_C(  34),  INT8_C(  84),  INT8_C(  23),  INT8_C(   6),  INT8_C(  75), -INT8_C(  65),  INT8_C(  20), -INT8_C( 112),
+        -INT8_C( 112), -INT8_C(  94),  INT8_C( 100),  INT8_C(  25),  INT8_C(  24), -INT8_C(  35),  INT8_C(  16),  INT8_C(  15) } },
+    { {  INT8_C(  45),  INT8_C(  58), -INT8_C(  70),  INT8_C(   3),  INT8_C( 126),  INT8_C(  73), -INT8_C(  49), -INT8_C(  38),
+         INT8_C( 104), -INT8_C(  55), -INT8_C(  17), -INT8_C(  24),  INT8_C(  68), -INT8_C( 102), -INT8_C( 116), -INT8_C(  38) },
+      {  INT8_C(  53), -INT8_C(  14),  INT8_C(  10),  INT8_C(  23),  INT8_C( 125), -INT8_C( 109), -INT8_C( 116),  INT8_C(  53),
+         INT8_C(  33),  INT8_C(  27), -INT8_C(  65), -INT8_C(  70),  INT8_C(  63),  INT8_C(  96),  INT8_C(   1),  INT8_C( 114) },
+      { -INT8_C(  14),  INT8_C(  23), -INT8_C( 109),  INT8_C(  53),  INT8_C(  27), -INT8_C(  70),  INT8_C(  96),  INT8_C( 114),
+         INT8_C(  58),  INT8_C(   3),  INT8_C(  73), -INT8_C(  38), -INT8_C(  55), -INT8_C(  24), -INT8_C( 102), -INT8_C(  38) } },
+    { {  INT8_C(  85), -INT8_C(  80),  INT8_C(  38),  INT8_C(  33),  INT8_C(   1), -INT8_C( 118),      INT8_MAX, -INT8_C(  79),
+         INT8_C(  45), -INT8_C(  62),  INT8_C( 110),  INT8_C(  94),  INT8_C(  18), -INT8_C( 120), -INT8_C( 122), -INT8_C( 106) },
+      {  INT8_C( 103), -INT8_C(  25),  INT8_C(  58),  INT8_C(  28),  INT8_C(  86), -INT8_C(  53), -INT8_C(  71),  INT8_C( 113),
+        -INT8_C(  48),  INT8_C(  78),  INT8_C(  38),  INT8_C( 114),      INT8_MAX, -INT8_C( 101),  INT8_C( 100),  INT8_C(  67) },
+      { -INT8_C(  25),  INT8_C(  28), -INT8_C(  53),  INT8_C( 113),  INT8_C(  78),  INT8_C( 114), -INT8_C( 101),  INT8_C(  67),
+        -INT8_C(  80),  INT8_C(  33), -INT8_C( 118), -INT8_C(  79), -INT8_C(  62),  INT8_C(  94), -INT8_C( 120), -INT8_C( 106) } },
+    { {  INT8_C( 113), -INT8_C(  66),  INT8_C(  44), -INT8_C(  38), -INT8_C( 120), -INT8_C(  58),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 118),  INT8_C(  45), -INT8_C(  56),  INT8_C(  52),  INT8_C( 120), -INT8_C(   4), -INT8_C(  39), -INT8_C(  25) },
+      {  INT8_C(   2),  INT8_C(  70),  INT8_C(  78),  INT8_C(  93), -INT8_C(  90),  INT8_C(  37), -INT8_C(  32), -INT8_C(  43),
+         INT8_C( 126),  INT8_C(  90),  INT8_C(  66), -INT8_C(  27),  INT8_C(  77),      INT8_MAX, -INT8_C(  12), -INT8_C(  64) },
+      {  INT8_C(  70),  INT8_C(  93),  INT8_C(  37), -INT8_C(  43),  INT8_C(  90), -INT8_C(  27),      INT8_MAX, -INT8_C(  64),
+        -INT8_C(  66), -INT8_C(  38), -INT8_C(  58),  INT8_C(   0),  INT8_C(  45),  INT8_C(  52), -INT8_C(   4), -INT8_C(  25) } },
+    { {  INT8_C(  10),  INT8_C( 120), -INT8_C( 122), -INT8_C(  41), -INT8_C( 109), -INT8_C( 115),  INT8_C(  97),  INT8_C( 118),
+        -INT8_C(  14),  INT8_C(  74),  INT8_C( 108),  INT8_C(  77),  INT8_C( 109),  INT8_C(  22),  INT8_C(  31),  INT8_C( 108) },
+      {  INT8_C(  50), -INT8_C(  48),  INT8_C(  46),  INT8_C(  14), -INT8_C(  96), -INT8_C(  90), -INT8_C(  98),  INT8_C(  84),
+         INT8_C( 123),  INT8_C(  86),  INT8_C(  65), -INT8_C(  91), -INT8_C(  54), -INT8_C(  31), -INT8_C(  15),  INT8_C(  68) },
+      { -INT8_C(  48),  INT8_C(  14), -INT8_C(  90),  INT8_C(  84),  INT8_C(  86), -INT8_C(  91), -INT8_C(  31),  INT8_C(  68),
+         INT8_C( 120), -INT8_C(  41), -INT8_C( 115),  INT8_C( 118),  INT8_C(  74),  INT8_C(  77),  INT8_C(  22),  INT8_C( 108) } },
+    { { -INT8_C(  50),  INT8_C( 102), -INT8_C(  87),  INT8_C(  40), -INT8_C(  14),  INT8_C( 117), -INT8_C(  27),  INT8_C(  77),
+        -INT8_C(  61), -INT8_C(  32), -INT8_C(  92), -INT8_C(  37), -INT8_C( 104),  INT8_C(  44), -INT8_C(  24), -INT8_C(  95) },
+      {  INT8_C(  89), -INT8_C( 112), -INT8_C(  74),  INT8_C( 102), -INT8_C(  33),  INT8_C(  20),  INT8_C(  26),  INT8_C( 100),
+        -INT8_C( 118), -INT8_C(  76),  INT8_C(  40), -INT8_C( 126), -INT8_C( 101), -INT8_C(  18),  INT8_C(  37), -INT8_C(  80) },
+      { -INT8_C( 112),  INT8_C( 102),  INT8_C(  20),  INT8_C( 100), -INT8_C(  76), -INT8_C( 126), -INT8_C(  18), -INT8_C(  80),
+         INT8_C( 102),  INT8_C(  40),  INT8_C( 117),  INT8_C(  77), -INT8_C(  32), -INT8_C(  37),  INT8_C(  44), -INT8_C(  95) } },
+    { {  INT8_C(  65),  INT8_C(  16), -INT8_C(  47),  INT8_C(  45),  INT8_C(  55), -INT8_C(  97),  INT8_C( 114),  INT8_C( 114),
+         INT8_C( 109),  INT8_C(  14),  INT8_C(  93), -INT8_C( 123),  INT8_C( 101),  INT8_C(  66),  INT8_C(  24),  INT8_C(  44) },
+      { -INT8_C(  75),  INT8_C( 100), -INT8_C(  81), -INT8_C(  60),  INT8_C(  39), -INT8_C(  50), -INT8_C(  92), -INT8_C(  46),
+        -INT8_C( 126), -INT8_C(  48), -INT8_C( 120), -INT8_C(  26), -INT8_C(  69), -INT8_C( 115), -INT8_C(  31),      INT8_MAX },
+      {  INT8_C( 100), -INT8_C(  60), -INT8_C(  50), -INT8_C(  46), -INT8_C(  48), -INT8_C(  26), -INT8_C( 115),      INT8_MAX,
+         INT8_C(  16),  INT8_C(  45), -INT8_C(  97),  INT8_C( 114),  INT8_C(  14), -INT8_C( 123),  INT8_C(  66),  INT8_C(  44) } },
+    { { -INT8_C(  84), -INT8_C( 118), -INT8_C( 102), -INT8_C(  96),  INT8_C(  88), -INT8_C(  24),  INT8_C( 121), -INT8_C(  38),
+        -INT8_C( 107), -INT8_C(  71), -INT8_C(  20),  INT8_C(  54),  INT8_C(  73),  INT8_C(  89), -INT8_C(  71),  INT8_C(  88) },
+      { -INT8_C(  14), -INT8_C(  27), -INT8_C(  35),      INT8_MAX, -INT8_C(  78),  INT8_C( 111),  INT8_C(  49),  INT8_C(  99),
+         INT8_C(  17),  INT8_C(   6), -INT8_C(  86), -INT8_C(  65), -INT8_C(  59), -INT8_C(  77), -INT8_C(  74), -INT8_C(  66) },
+      { -INT8_C(  27),      INT8_MAX,  INT8_C( 111),  INT8_C(  99),  INT8_C(   6), -INT8_C(  65), -INT8_C(  77), -INT8_C(  66),
+        -INT8_C( 118), -INT8_C(  96), -INT8_C(  24), -INT8_C(  38), -INT8_C(  71),  INT8_C(  54),  INT8_C(  89),  INT8_C(  88) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_pckod_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_pckod_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pckod_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 32658), -INT16_C(  5829), -INT16_C( 21612),  INT16_C( 17548),  INT16_C(  6076), -INT16_C(  4786), -INT16_C( 15372), -INT16_C(  1654) },
+      { -INT16_C(  6458), -INT16_C(  5431), -INT16_C( 25915),  INT16_C( 27574),  INT16_C(  5085),  INT16_C(  2754), -INT16_C( 31077), -INT16_C(   217) },
+      { -INT16_C(  5431),  INT16_C( 27574),  INT16_C(  2754), -INT16_C(   217), -INT16_C(  5829),  INT16_C( 17548), -INT16_C(  4786), -INT16_C(  1654) } },
+    { { -INT16_C( 21571), -INT16_C(  5254), -INT16_C( 11776),  INT16_C( 28330), -INT16_C( 19000),  INT16_C(  4082),  INT16_C( 21976), -INT16_C(  8292) },
+      {  INT16_C( 16896), -INT16_C( 29201),  INT16_C( 31349),  INT16_C( 17191), -INT16_C( 29868), -INT16_C( 15912),  INT16_C( 10908),  INT16_C( 31249) },
+      { -INT16_C( 29201),  INT16_C( 17191), -INT16_C( 15912),  INT16_C( 31249), -INT16_C(  5254),  INT16_C( 28330),  INT16_C(  4082), -INT16_C(  8292) } },
+    { {  INT16_C( 14734),  INT16_C( 32464),  INT16_C(  1406),  INT16_C(  2126), -INT16_C( 25731), -INT16_C( 11577),  INT16_C(  5063), -INT16_C(  5193) },
+      {  INT16_C(  4018), -INT16_C( 31763), -INT16_C( 28054),  INT16_C(  6789),  INT16_C( 32275), -INT16_C( 10014), -INT16_C( 18342), -INT16_C( 18291) },
+      { -INT16_C( 31763),  INT16_C(  6789), -INT16_C( 10014), -INT16_C( 18291),  INT16_C( 32464),  INT16_C(  2126), -INT16_C( 11577), -INT16_C(  5193) } },
+    { { -INT16_C(  4991),  INT16_C(   415),  INT16_C( 19847),  INT16_C( 22947),  INT16_C(  2327), -INT16_C( 23547),  INT16_C( 25326), -INT16_C(  8219) },
+      { -INT16_C(  9801),  INT16_C( 26055), -INT16_C( 27200),  INT16_C( 22062), -INT16_C( 26992),  INT16_C(  7113), -INT16_C(  4145), -INT16_C( 26680) },
+      {  INT16_C( 26055),  INT16_C( 22062),  INT16_C(  7113), -INT16_C( 26680),  INT16_C(   415),  INT16_C( 22947), -INT16_C( 23547), -INT16_C(  8219) } },
+    { { -INT16_C(  7682),  INT16_C( 25702),  INT16_C( 16649), -INT16_C( 22512),  INT16_C(  3459),  INT16_C( 11084), -INT16_C(   579), -INT16_C( 24283) },
+      { -INT16_C( 26723),  INT16_C(  5049), -INT16_C( 29674),  INT16_C(  8427),  INT16_C( 18957), -INT16_C(   610), -INT16_C( 24747),  INT16_C(  8907) },
+      {  INT16_C(  5049),  INT16_C(  8427), -INT16_C(   610),  INT16_C(  8907),  INT16_C( 25702), -INT16_C( 22512),  INT16_C( 11084), -INT16_C( 24283) } },
+    { { -INT16_C( 13111), -INT16_C( 30686), -INT16_C( 29818),  INT16_C( 14049), -INT16_C( 16981), -INT16_C(  2651), -INT16_C( 10051),  INT16_C( 16610) },
+      {  INT16_C(  5196),  INT16_C( 31470), -INT16_C(  5915),  INT16_C( 17975), -INT16_C( 15232),  INT16_C( 31291),  INT16_C( 14485),  INT16_C( 31419) },
+      {  INT16_C( 31470),  INT16_C( 17975),  INT16_C( 31291),  INT16_C( 31419), -INT16_C( 30686),  INT16_C( 14049), -INT16_C(  2651),  INT16_C( 16610) } },
+    { { -INT16_C( 19952),  INT16_C(  3629),  INT16_C(  7313),  INT16_C(   593), -INT16_C( 29726), -INT16_C( 20987),  INT16_C( 14280), -INT16_C(  5043) },
+      { -INT16_C(  1147), -INT16_C(  3590), -INT16_C( 11723), -INT16_C( 18748),  INT16_C( 10222), -INT16_C( 16889), -INT16_C( 32216), -INT16_C(  9997) },
+      { -INT16_C(  3590), -INT16_C( 18748), -INT16_C( 16889), -INT16_C(  9997),  INT16_C(  3629),  INT16_C(   593), -INT16_C( 20987), -INT16_C(  5043) } },
+    { { -INT16_C( 17197),  INT16_C(  3950), -INT16_C(  4889),  INT16_C( 28660),  INT16_C( 23228),  INT16_C( 22084),  INT16_C( 20052), -INT16_C( 29705) },
+      { -INT16_C( 10152),  INT16_C(   390),  INT16_C(  6953), -INT16_C(  8516), -INT16_C( 26496),  INT16_C( 19847), -INT16_C( 28141),  INT16_C(  3991) },
+      {  INT16_C(   390), -INT16_C(  8516),  INT16_C( 19847),  INT16_C(  3991),  INT16_C(  3950),  INT16_C( 28660),  INT16_C( 22084), -INT16_C( 29705) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_pckod_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_pckod_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pckod_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   368364097),  INT32_C(  1242578578),  INT32_C(    45044747),  INT32_C(   281260102) },
+      {  INT32_C(  1476161132),  INT32_C(   451637848), -INT32_C(   421236210),  INT32_C(    35965851) },
+      {  INT32_C(   451637848),  INT32_C(    35965851),  INT32_C(  1242578578),  INT32_C(   281260102) } },
+    { {  INT32_C(  1670829623), -INT32_C(   126016350),  INT32_C(  1791975514),  INT32_C(    76041920) },
+      {  INT32_C(   492109201),  INT32_C(  1663873967), -INT32_C(  1617878958),  INT32_C(  1194488172) },
+      {  INT32_C(  1663873967),  INT32_C(  1194488172), -INT32_C(   126016350),  INT32_C(    76041920) } },
+    { {  INT32_C(   735444996), -INT32_C(  1505370956), -INT32_C(   987629361),  INT32_C(  1426416254) },
+      {  INT32_C(   791065642),  INT32_C(    86525415), -INT32_C(  1128261794),  INT32_C(   507761164) },
+      {  INT32_C(    86525415),  INT32_C(   507761164), -INT32_C(  1505370956),  INT32_C(  1426416254) } },
+    { {  INT32_C(   462399817), -INT32_C(  2084412749), -INT32_C(  1435645704), -INT32_C(   933258836) },
+      {  INT32_C(   859468766),  INT32_C(  1154884556), -INT32_C(   757222636), -INT32_C(  1404226497) },
+      {  INT32_C(  1154884556), -INT32_C(  1404226497), -INT32_C(  2084412749), -INT32_C(   933258836) } },
+    { {  INT32_C(  1277311140),  INT32_C(  2085113855),  INT32_C(   487521270),  INT32_C(  1491792339) },
+      {  INT32_C(   599329392), -INT32_C(   268587462),  INT32_C(  1886528331), -INT32_C(   642633848) },
+      { -INT32_C(   268587462), -INT32_C(   642633848),  INT32_C(  2085113855),  INT32_C(  1491792339) } },
+    { {  INT32_C(  1707808432), -INT32_C(  2051758556), -INT32_C(   682515432),  INT32_C(  1534977704) },
+      {  INT32_C(  2046406296), -INT32_C(  1671214935),  INT32_C(  1606892336), -INT32_C(   915207164) },
+      { -INT32_C(  1671214935), -INT32_C(   915207164), -INT32_C(  2051758556),  INT32_C(  1534977704) } },
+    { {  INT32_C(  1962352403), -INT32_C(   652411248),  INT32_C(   770316564), -INT32_C(  1553500315) },
+      {  INT32_C(   289693549), -INT32_C(   942928100), -INT32_C(  1172881389), -INT32_C(  1416893537) },
+      { -INT32_C(   942928100), -INT32_C(  1416893537), -INT32_C(   652411248), -INT32_C(  1553500315) } },
+    { {  INT32_C(   320508106), -INT32_C(  1075599049), -INT32_C(   247504411),  INT32_C(   731819888) },
+      {  INT32_C(   940188818), -INT32_C(   669475515),  INT32_C(  1727548081), -INT32_C(  1562678900) },
+      { -INT32_C(   669475515), -INT32_C(  1562678900), -INT32_C(  1075599049),  INT32_C(   731819888) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_pckod_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_pckod_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_pckod_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 4309612644054785795),  INT64_C( 8228363673509267250) },
+      { -INT64_C( 3636364360330106289),  INT64_C( 8379665934938278584) },
+      {  INT64_C( 8379665934938278584),  INT64_C( 8228363673509267250) } },
+    { { -INT64_C( 6584279110693741452), -INT64_C( 4822421392760154841) },
+      {  INT64_C( 5423164665387028782),  INT64_C( 7307383096020393588) },
+      {  INT64_C( 7307383096020393588), -INT64_C( 4822421392760154841) } },
+    { { -INT64_C( 1481423435277481298),  INT64_C( 7613222478754747701) },
+      { -INT64_C( 1806507764010413520),  INT64_C( 5176069757137096674) },
+      {  INT64_C( 5176069757137096674),  INT64_C( 7613222478754747701) } },
+    { {  INT64_C( 7017287024221149234),  INT64_C( 2311711892832718749) },
+      {  INT64_C( 6369807413663556522), -INT64_C(  463263369262652488) },
+      { -INT64_C(  463263369262652488),  INT64_C( 2311711892832718749) } },
+    { { -INT64_C(  843471530452314981),  INT64_C( 2652034008356974514) },
+      { -INT64_C( 7671746614667677773), -INT64_C( 5703547950789036385) },
+      { -INT64_C( 5703547950789036385),  INT64_C( 2652034008356974514) } },
+    { {  INT64_C( 2903279784764309029), -INT64_C( 8704968328397115063) },
+      {  INT64_C( 9095750035733322618),  INT64_C( 4109784040957399408) },
+      {  INT64_C( 4109784040957399408), -INT64_C( 8704968328397115063) } },
+    { {  INT64_C( 6478891489337885203), -INT64_C( 4559729367379203679) },
+      {  INT64_C( 4103781679206124746),  INT64_C( 7433341814949833855) },
+      {  INT64_C( 7433341814949833855), -INT64_C( 4559729367379203679) } },
+    { { -INT64_C( 2445013270940225186),  INT64_C( 2757957577616932588) },
+      {  INT64_C( 6943419439408053587), -INT64_C( 3909033881563954181) },
+      { -INT64_C( 3909033881563954181),  INT64_C( 2757957577616932588) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_pckod_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_pckod_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(pckod_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(pckod_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(pckod_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(pckod_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,657 @@
+#define SIMDE_TEST_MIPS_MSA_INSN sat
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/sat.h"
+
+static int
+test_simde_sat_s_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t  a[16];
+    int8_t r0[16];
+    int8_t r1[16];
+    int8_t r4[16];
+  } test_vec[] = {
+    { {  INT8_C(  81),  INT8_C(  56), -INT8_C( 108),  INT8_C( 122),  INT8_C(  71), -INT8_C(  96),  INT8_C(  99),  INT8_C( 126),
+         INT8_C(  79),  INT8_C( 104),  INT8_C(  66), -INT8_C(  88), -INT8_C(   9),  INT8_C(   1),  INT8_C(  55),  INT8_C(  64) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1) },
+      {  INT8_C(  15),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15),
+         INT8_C(  15),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16), -INT8_C(   9),  INT8_C(   1),  INT8_C(  15),  INT8_C(  15) } },
+    { {  INT8_C(  65),  INT8_C(  40), -INT8_C(  56),  INT8_C( 126), -INT8_C( 118),  INT8_C(  11),  INT8_C(  94),  INT8_C(   2),
+         INT8_C( 122),  INT8_C(   8), -INT8_C(  38), -INT8_C( 126), -INT8_C(  20),  INT8_C(  71),  INT8_C(  49), -INT8_C(  84) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) },
+      {  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2) },
+      {  INT8_C(  15),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15), -INT8_C(  16),  INT8_C(  11),  INT8_C(  15),  INT8_C(   2),
+         INT8_C(  15),  INT8_C(   8), -INT8_C(  16), -INT8_C(  16), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16) } },
+    { { -INT8_C(  99),  INT8_C(  74),  INT8_C(   6), -INT8_C( 104),  INT8_C(  23),  INT8_C( 111),  INT8_C(  16),  INT8_C( 113),
+        -INT8_C(  49), -INT8_C(  84),  INT8_C(  57),  INT8_C(  55), -INT8_C(  56), -INT8_C(  86),  INT8_C(   3), -INT8_C(  47) },
+      { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) },
+      { -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),
+        -INT8_C(   2), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1), -INT8_C(   2) },
+      { -INT8_C(  16),  INT8_C(  15),  INT8_C(   6), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15),  INT8_C(  15),  INT8_C(  15),
+        -INT8_C(  16), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16), -INT8_C(  16),  INT8_C(   3), -INT8_C(  16) } },
+    { {  INT8_C( 124), -INT8_C( 119), -INT8_C(  19),  INT8_C(  30),  INT8_C(  92), -INT8_C(   3),  INT8_C(  67),  INT8_C(  81),
+         INT8_C(  17),  INT8_C( 119),  INT8_C(  39), -INT8_C(  89),  INT8_C(  35),  INT8_C(  89), -INT8_C( 109), -INT8_C(  55) },
+      {  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   1), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2) },
+      {  INT8_C(  15), -INT8_C(  16), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(   3),  INT8_C(  15),  INT8_C(  15),
+         INT8_C(  15),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16), -INT8_C(  16) } },
+    { {  INT8_C(  65),  INT8_C(  37),  INT8_C(   4), -INT8_C( 120), -INT8_C(   4),  INT8_C(  41),  INT8_C(   2), -INT8_C(  75),
+         INT8_C(  22), -INT8_C( 103), -INT8_C(  63), -INT8_C(  75),  INT8_C(  57), -INT8_C(  42),  INT8_C(  91),  INT8_C(   3) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),
+         INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   1),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),
+         INT8_C(   1), -INT8_C(   2), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1) },
+      {  INT8_C(  15),  INT8_C(  15),  INT8_C(   4), -INT8_C(  16), -INT8_C(   4),  INT8_C(  15),  INT8_C(   2), -INT8_C(  16),
+         INT8_C(  15), -INT8_C(  16), -INT8_C(  16), -INT8_C(  16),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15),  INT8_C(   3) } },
+    { {  INT8_C(  20),  INT8_C(  73),  INT8_C(   1), -INT8_C(  44),  INT8_C(  99),  INT8_C(   4),  INT8_C(  43),  INT8_C( 113),
+        -INT8_C( 121),  INT8_C(   4),  INT8_C(  59), -INT8_C(  73),  INT8_C(  43),  INT8_C(  95), -INT8_C(  25),  INT8_C(  19) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) },
+      {  INT8_C(   1),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),
+        -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1) },
+      {  INT8_C(  15),  INT8_C(  15),  INT8_C(   1), -INT8_C(  16),  INT8_C(  15),  INT8_C(   4),  INT8_C(  15),  INT8_C(  15),
+        -INT8_C(  16),  INT8_C(   4),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15) } },
+    { {  INT8_C(  62),  INT8_C(  11), -INT8_C(  89), -INT8_C(  29),  INT8_C(  81), -INT8_C(  59), -INT8_C(  35), -INT8_C(  60),
+        -INT8_C(  91), -INT8_C( 124), -INT8_C(   1), -INT8_C(  88), -INT8_C(  32),  INT8_C( 106), -INT8_C(  50),  INT8_C(  38) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) },
+      {  INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2), -INT8_C(   2),
+        -INT8_C(   2), -INT8_C(   2), -INT8_C(   1), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1) },
+      {  INT8_C(  15),  INT8_C(  11), -INT8_C(  16), -INT8_C(  16),  INT8_C(  15), -INT8_C(  16), -INT8_C(  16), -INT8_C(  16),
+        -INT8_C(  16), -INT8_C(  16), -INT8_C(   1), -INT8_C(  16), -INT8_C(  16),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15) } },
+    { { -INT8_C(  44),  INT8_C(  70),  INT8_C(  23), -INT8_C(   4), -INT8_C( 100), -INT8_C( 104),  INT8_C(  85),  INT8_C(  87),
+         INT8_C( 113),  INT8_C( 106), -INT8_C(  25),  INT8_C( 101), -INT8_C(  77),  INT8_C( 114),  INT8_C(  34), -INT8_C(  49) },
+      { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1) },
+      { -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2), -INT8_C(   2), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1), -INT8_C(   2),  INT8_C(   1),  INT8_C(   1), -INT8_C(   2) },
+      { -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(   4), -INT8_C(  16), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15),
+         INT8_C(  15),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15), -INT8_C(  16),  INT8_C(  15),  INT8_C(  15), -INT8_C(  16) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8  a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 r0 = simde_msa_sat_s_b(a, 0);
+    simde_v16i8 r1 = simde_msa_sat_s_b(a, 1);
+    simde_v16i8 r4 = simde_msa_sat_s_b(a, 4);
+
+    simde_test_msa_v16i8_assert_equal(r0, simde_msa_ld_b(test_vec[i].r0, 0));
+    simde_test_msa_v16i8_assert_equal(r1, simde_msa_ld_b(test_vec[i].r1, 0));
+    simde_test_msa_v16i8_assert_equal(r4, simde_msa_ld_b(test_vec[i].r4, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8  a = simde_test_msa_v16i8_random();
+    simde_v16i8 r0 = simde_msa_sat_s_b(a, 0);
+    simde_v16i8 r1 = simde_msa_sat_s_b(a, 1);
+    simde_v16i8 r4 = simde_msa_sat_s_b(a, 4);
+
+    simde_test_msa_v16i8_write(2,  a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r1, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r4, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sat_s_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t   a[8];
+    int16_t  r0[8];
+    int16_t  r8[8];
+    int16_t r14[8];
+  } test_vec[] = {
+    { {  INT16_C( 10205),  INT16_C( 12212),  INT16_C( 16722), -INT16_C( 11058),  INT16_C( 21794), -INT16_C( 12083), -INT16_C( 20975), -INT16_C( 30109) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(   255),  INT16_C(   255),  INT16_C(   255), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256), -INT16_C(   256), -INT16_C(   256) },
+      {  INT16_C( 10205),  INT16_C( 12212),  INT16_C( 16383), -INT16_C( 11058),  INT16_C( 16383), -INT16_C( 12083), -INT16_C( 16384), -INT16_C( 16384) } },
+    { {  INT16_C( 15090), -INT16_C(  4747),  INT16_C( 17922), -INT16_C(  9540),  INT16_C(  7382), -INT16_C(  5264), -INT16_C( 31347),  INT16_C( 13578) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0) },
+      {  INT16_C(   255), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256), -INT16_C(   256),  INT16_C(   255) },
+      {  INT16_C( 15090), -INT16_C(  4747),  INT16_C( 16383), -INT16_C(  9540),  INT16_C(  7382), -INT16_C(  5264), -INT16_C( 16384),  INT16_C( 13578) } },
+    { {  INT16_C( 13965), -INT16_C( 17803), -INT16_C( 22653), -INT16_C( 30067), -INT16_C( 22935),  INT16_C( 12810), -INT16_C( 17619), -INT16_C(  1665) },
+      {  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(   255), -INT16_C(   256), -INT16_C(   256), -INT16_C(   256), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256), -INT16_C(   256) },
+      {  INT16_C( 13965), -INT16_C( 16384), -INT16_C( 16384), -INT16_C( 16384), -INT16_C( 16384),  INT16_C( 12810), -INT16_C( 16384), -INT16_C(  1665) } },
+    { { -INT16_C( 17145), -INT16_C( 30478),  INT16_C( 15647),  INT16_C( 20106),  INT16_C(  8624),  INT16_C(  9279), -INT16_C( 27311),  INT16_C( 13533) },
+      { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) },
+      { -INT16_C(   256), -INT16_C(   256),  INT16_C(   255),  INT16_C(   255),  INT16_C(   255),  INT16_C(   255), -INT16_C(   256),  INT16_C(   255) },
+      { -INT16_C( 16384), -INT16_C( 16384),  INT16_C( 15647),  INT16_C( 16383),  INT16_C(  8624),  INT16_C(  9279), -INT16_C( 16384),  INT16_C( 13533) } },
+    { { -INT16_C(  1727), -INT16_C( 25512), -INT16_C(  3199), -INT16_C( 11130), -INT16_C(  3481),  INT16_C( 11213), -INT16_C( 18363), -INT16_C( 16315) },
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1) },
+      { -INT16_C(   256), -INT16_C(   256), -INT16_C(   256), -INT16_C(   256), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256), -INT16_C(   256) },
+      { -INT16_C(  1727), -INT16_C( 16384), -INT16_C(  3199), -INT16_C( 11130), -INT16_C(  3481),  INT16_C( 11213), -INT16_C( 16384), -INT16_C( 16315) } },
+    { {  INT16_C(  9256), -INT16_C( 17761),  INT16_C( 18645), -INT16_C( 11743),  INT16_C( 26435),  INT16_C(  6556), -INT16_C( 23414),  INT16_C( 10722) },
+      {  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0) },
+      {  INT16_C(   255), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256),  INT16_C(   255),  INT16_C(   255), -INT16_C(   256),  INT16_C(   255) },
+      {  INT16_C(  9256), -INT16_C( 16384),  INT16_C( 16383), -INT16_C( 11743),  INT16_C( 16383),  INT16_C(  6556), -INT16_C( 16384),  INT16_C( 10722) } },
+    { { -INT16_C(  4255), -INT16_C(  1144),  INT16_C(  8040), -INT16_C( 10322),  INT16_C( 30823), -INT16_C(  6180), -INT16_C( 21134), -INT16_C(  6111) },
+      { -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      { -INT16_C(   256), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256), -INT16_C(   256), -INT16_C(   256) },
+      { -INT16_C(  4255), -INT16_C(  1144),  INT16_C(  8040), -INT16_C( 10322),  INT16_C( 16383), -INT16_C(  6180), -INT16_C( 16384), -INT16_C(  6111) } },
+    { { -INT16_C(  8547),  INT16_C( 18977), -INT16_C(  8203), -INT16_C( 15428), -INT16_C( 30631),  INT16_C(   893), -INT16_C( 16262), -INT16_C( 19403) },
+      { -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),  INT16_C(     0), -INT16_C(     1), -INT16_C(     1) },
+      { -INT16_C(   256),  INT16_C(   255), -INT16_C(   256), -INT16_C(   256), -INT16_C(   256),  INT16_C(   255), -INT16_C(   256), -INT16_C(   256) },
+      { -INT16_C(  8547),  INT16_C( 16383), -INT16_C(  8203), -INT16_C( 15428), -INT16_C( 16384),  INT16_C(   893), -INT16_C( 16262), -INT16_C( 16384) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16   a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16  r0 = simde_msa_sat_s_h(a, 0);
+    simde_v8i16  r8 = simde_msa_sat_s_h(a, 8);
+    simde_v8i16 r14 = simde_msa_sat_s_h(a, 14);
+
+    simde_test_msa_v8i16_assert_equal( r0, simde_msa_ld_h(test_vec[i].r0 , 0));
+    simde_test_msa_v8i16_assert_equal( r8, simde_msa_ld_h(test_vec[i].r8 , 0));
+    simde_test_msa_v8i16_assert_equal(r14, simde_msa_ld_h(test_vec[i].r14, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16   a = simde_test_msa_v8i16_random();
+    simde_v8i16  r0 = simde_msa_sat_s_h(a, 0);
+    simde_v8i16  r8 = simde_msa_sat_s_h(a, 8);
+    simde_v8i16 r14 = simde_msa_sat_s_h(a, 14);
+
+    simde_test_msa_v8i16_write(2,   a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2,  r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2,  r8, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r14, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sat_s_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t   a[4];
+    int32_t  r0[4];
+    int32_t r12[4];
+    int32_t r14[4];
+  } test_vec[] = {
+    { {  INT32_C(  1959501691), -INT32_C(   587177537),  INT32_C(  2026911683), -INT32_C(   541689107) },
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(        4095), -INT32_C(        4096),  INT32_C(        4095), -INT32_C(        4096) },
+      {  INT32_C(       16383), -INT32_C(       16384),  INT32_C(       16383), -INT32_C(       16384) } },
+    { { -INT32_C(  1712937368),  INT32_C(  1314348783), -INT32_C(  1557231656),  INT32_C(   940398494) },
+      { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0) },
+      { -INT32_C(        4096),  INT32_C(        4095), -INT32_C(        4096),  INT32_C(        4095) },
+      { -INT32_C(       16384),  INT32_C(       16383), -INT32_C(       16384),  INT32_C(       16383) } },
+    { { -INT32_C(  2117109841),  INT32_C(  1291603787),  INT32_C(  1824570056),  INT32_C(   366158908) },
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      { -INT32_C(        4096),  INT32_C(        4095),  INT32_C(        4095),  INT32_C(        4095) },
+      { -INT32_C(       16384),  INT32_C(       16383),  INT32_C(       16383),  INT32_C(       16383) } },
+    { {  INT32_C(   226962433),  INT32_C(  2014019112),  INT32_C(   676644630), -INT32_C(  1280523475) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(        4095),  INT32_C(        4095),  INT32_C(        4095), -INT32_C(        4096) },
+      {  INT32_C(       16383),  INT32_C(       16383),  INT32_C(       16383), -INT32_C(       16384) } },
+    { { -INT32_C(  1598625362),  INT32_C(   634772309), -INT32_C(  1575762442), -INT32_C(    84857314) },
+      { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) },
+      { -INT32_C(        4096),  INT32_C(        4095), -INT32_C(        4096), -INT32_C(        4096) },
+      { -INT32_C(       16384),  INT32_C(       16383), -INT32_C(       16384), -INT32_C(       16384) } },
+    { {  INT32_C(   678516734), -INT32_C(   276495620),  INT32_C(  1029476809), -INT32_C(  1437679972) },
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(        4095), -INT32_C(        4096),  INT32_C(        4095), -INT32_C(        4096) },
+      {  INT32_C(       16383), -INT32_C(       16384),  INT32_C(       16383), -INT32_C(       16384) } },
+    { {  INT32_C(   480915734), -INT32_C(  1912732103), -INT32_C(    97751647),  INT32_C(   241611964) },
+      {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) },
+      {  INT32_C(        4095), -INT32_C(        4096), -INT32_C(        4096),  INT32_C(        4095) },
+      {  INT32_C(       16383), -INT32_C(       16384), -INT32_C(       16384),  INT32_C(       16383) } },
+    { { -INT32_C(   245889932), -INT32_C(   965157110),  INT32_C(  2080621783), -INT32_C(  1829740967) },
+      { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) },
+      { -INT32_C(        4096), -INT32_C(        4096),  INT32_C(        4095), -INT32_C(        4096) },
+      { -INT32_C(       16384), -INT32_C(       16384),  INT32_C(       16383), -INT32_C(       16384) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32   a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32  r0 = simde_msa_sat_s_w(a, 0);
+    simde_v4i32 r12 = simde_msa_sat_s_w(a, 12);
+    simde_v4i32 r14 = simde_msa_sat_s_w(a, 14);
+
+    simde_test_msa_v4i32_assert_equal( r0, simde_msa_ld_w(test_vec[i].r0 , 0));
+    simde_test_msa_v4i32_assert_equal(r12, simde_msa_ld_w(test_vec[i].r12, 0));
+    simde_test_msa_v4i32_assert_equal(r14, simde_msa_ld_w(test_vec[i].r14, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32   a = simde_test_msa_v4i32_random();
+    simde_v4i32  r0 = simde_msa_sat_s_w(a, 0);
+    simde_v4i32 r12 = simde_msa_sat_s_w(a, 12);
+    simde_v4i32 r14 = simde_msa_sat_s_w(a, 14);
+
+    simde_test_msa_v4i32_write(2,   a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2,  r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r12, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r14, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sat_s_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t   a[2];
+    int64_t  r0[2];
+    int64_t r28[2];
+    int64_t r55[2];
+  } test_vec[] = {
+    { {  INT64_C( 2798961075830093990), -INT64_C( 1102822335075731994) },
+      {  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(           268435455), -INT64_C(           268435456) },
+      {  INT64_C(   36028797018963967), -INT64_C(   36028797018963968) } },
+    { {  INT64_C( 6481708575224055072), -INT64_C( 6054494950254940343) },
+      {  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(           268435455), -INT64_C(           268435456) },
+      {  INT64_C(   36028797018963967), -INT64_C(   36028797018963968) } },
+    { { -INT64_C( 5678358876576680106), -INT64_C( 2219168020472489781) },
+      { -INT64_C(                   1), -INT64_C(                   1) },
+      { -INT64_C(           268435456), -INT64_C(           268435456) },
+      { -INT64_C(   36028797018963968), -INT64_C(   36028797018963968) } },
+    { { -INT64_C(  835308009231447730), -INT64_C( 1802495389575202029) },
+      { -INT64_C(                   1), -INT64_C(                   1) },
+      { -INT64_C(           268435456), -INT64_C(           268435456) },
+      { -INT64_C(   36028797018963968), -INT64_C(   36028797018963968) } },
+    { {  INT64_C( 1006216663207997262),  INT64_C( 3460720943356652393) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(           268435455),  INT64_C(           268435455) },
+      {  INT64_C(   36028797018963967),  INT64_C(   36028797018963967) } },
+    { { -INT64_C( 8613078969883124435), -INT64_C( 6944067566580641138) },
+      { -INT64_C(                   1), -INT64_C(                   1) },
+      { -INT64_C(           268435456), -INT64_C(           268435456) },
+      { -INT64_C(   36028797018963968), -INT64_C(   36028797018963968) } },
+    { { -INT64_C( 6470195060327187746),  INT64_C(  191766574864255468) },
+      { -INT64_C(                   1),  INT64_C(                   0) },
+      { -INT64_C(           268435456),  INT64_C(           268435455) },
+      { -INT64_C(   36028797018963968),  INT64_C(   36028797018963967) } },
+    { { -INT64_C( 7946180379229796049), -INT64_C( 6420116419778722800) },
+      { -INT64_C(                   1), -INT64_C(                   1) },
+      { -INT64_C(           268435456), -INT64_C(           268435456) },
+      { -INT64_C(   36028797018963968), -INT64_C(   36028797018963968) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64   a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64  r0 = simde_msa_sat_s_d(a, 0);
+    simde_v2i64 r28 = simde_msa_sat_s_d(a, 28);
+    simde_v2i64 r55 = simde_msa_sat_s_d(a, 55);
+
+    simde_test_msa_v2i64_assert_equal( r0, simde_msa_ld_d(test_vec[i].r0 , 0));
+    simde_test_msa_v2i64_assert_equal(r28, simde_msa_ld_d(test_vec[i].r28, 0));
+    simde_test_msa_v2i64_assert_equal(r55, simde_msa_ld_d(test_vec[i].r55, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64   a = simde_test_msa_v2i64_random();
+    simde_v2i64  r0 = simde_msa_sat_s_d(a, 0);
+    simde_v2i64 r28 = simde_msa_sat_s_d(a, 28);
+    simde_v2i64 r55 = simde_msa_sat_s_d(a, 55);
+
+    simde_test_msa_v2i64_write(2,   a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2,  r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r28, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r55, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sat_u_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint8_t  a[16];
+    uint8_t r0[16];
+    uint8_t r5[16];
+    uint8_t r7[16];
+  } test_vec[] = {
+    { { UINT8_C(248), UINT8_C(177), UINT8_C( 92), UINT8_C(175), UINT8_C(217), UINT8_C( 97), UINT8_C(126),    UINT8_MAX,
+        UINT8_C(128), UINT8_C(107), UINT8_C(242), UINT8_C(236), UINT8_C(108), UINT8_C(108), UINT8_C( 96), UINT8_C( 49) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) },
+      { UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63),
+        UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 49) },
+      { UINT8_C(248), UINT8_C(177), UINT8_C( 92), UINT8_C(175), UINT8_C(217), UINT8_C( 97), UINT8_C(126),    UINT8_MAX,
+        UINT8_C(128), UINT8_C(107), UINT8_C(242), UINT8_C(236), UINT8_C(108), UINT8_C(108), UINT8_C( 96), UINT8_C( 49) } },
+    { { UINT8_C( 26), UINT8_C(221), UINT8_C(233), UINT8_C( 95), UINT8_C(100), UINT8_C(193), UINT8_C(193), UINT8_C( 43),
+        UINT8_C(184),    UINT8_MAX, UINT8_C( 32), UINT8_C( 93), UINT8_C(211), UINT8_C( 44), UINT8_C( 34), UINT8_C( 79) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) },
+      { UINT8_C( 26), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 43),
+        UINT8_C( 63), UINT8_C( 63), UINT8_C( 32), UINT8_C( 63), UINT8_C( 63), UINT8_C( 44), UINT8_C( 34), UINT8_C( 63) },
+      { UINT8_C( 26), UINT8_C(221), UINT8_C(233), UINT8_C( 95), UINT8_C(100), UINT8_C(193), UINT8_C(193), UINT8_C( 43),
+        UINT8_C(184),    UINT8_MAX, UINT8_C( 32), UINT8_C( 93), UINT8_C(211), UINT8_C( 44), UINT8_C( 34), UINT8_C( 79) } },
+    { { UINT8_C(183), UINT8_C(154), UINT8_C(116), UINT8_C(235), UINT8_C(139), UINT8_C( 69), UINT8_C(188), UINT8_C(  2),
+        UINT8_C( 25), UINT8_C( 30), UINT8_C( 33), UINT8_C(184), UINT8_C(200), UINT8_C(194), UINT8_C(192), UINT8_C(155) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) },
+      { UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C(  2),
+        UINT8_C( 25), UINT8_C( 30), UINT8_C( 33), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63) },
+      { UINT8_C(183), UINT8_C(154), UINT8_C(116), UINT8_C(235), UINT8_C(139), UINT8_C( 69), UINT8_C(188), UINT8_C(  2),
+        UINT8_C( 25), UINT8_C( 30), UINT8_C( 33), UINT8_C(184), UINT8_C(200), UINT8_C(194), UINT8_C(192), UINT8_C(155) } },
+    { { UINT8_C(182), UINT8_C(132), UINT8_C(231), UINT8_C(  2), UINT8_C( 66), UINT8_C(222), UINT8_C(232), UINT8_C(103),
+        UINT8_C( 23), UINT8_C(117), UINT8_C( 78), UINT8_C(127), UINT8_C( 55), UINT8_C(115), UINT8_C( 75), UINT8_C( 86) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) },
+      { UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C(  2), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63),
+        UINT8_C( 23), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 55), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63) },
+      { UINT8_C(182), UINT8_C(132), UINT8_C(231), UINT8_C(  2), UINT8_C( 66), UINT8_C(222), UINT8_C(232), UINT8_C(103),
+        UINT8_C( 23), UINT8_C(117), UINT8_C( 78), UINT8_C(127), UINT8_C( 55), UINT8_C(115), UINT8_C( 75), UINT8_C( 86) } },
+    { { UINT8_C(135), UINT8_C(221), UINT8_C( 37), UINT8_C( 61), UINT8_C(245), UINT8_C(254), UINT8_C(164), UINT8_C(196),
+        UINT8_C( 80), UINT8_C(  9), UINT8_C( 79), UINT8_C( 36), UINT8_C(138), UINT8_C( 27), UINT8_C(254), UINT8_C(  0) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  0) },
+      { UINT8_C( 63), UINT8_C( 63), UINT8_C( 37), UINT8_C( 61), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63),
+        UINT8_C( 63), UINT8_C(  9), UINT8_C( 63), UINT8_C( 36), UINT8_C( 63), UINT8_C( 27), UINT8_C( 63), UINT8_C(  0) },
+      { UINT8_C(135), UINT8_C(221), UINT8_C( 37), UINT8_C( 61), UINT8_C(245), UINT8_C(254), UINT8_C(164), UINT8_C(196),
+        UINT8_C( 80), UINT8_C(  9), UINT8_C( 79), UINT8_C( 36), UINT8_C(138), UINT8_C( 27), UINT8_C(254), UINT8_C(  0) } },
+    { { UINT8_C(120), UINT8_C( 37), UINT8_C(172), UINT8_C( 95), UINT8_C( 19), UINT8_C(252), UINT8_C( 42), UINT8_C(141),
+        UINT8_C(  1), UINT8_C( 68), UINT8_C(224), UINT8_C( 44), UINT8_C(186), UINT8_C( 55), UINT8_C(124), UINT8_C( 38) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) },
+      { UINT8_C( 63), UINT8_C( 37), UINT8_C( 63), UINT8_C( 63), UINT8_C( 19), UINT8_C( 63), UINT8_C( 42), UINT8_C( 63),
+        UINT8_C(  1), UINT8_C( 63), UINT8_C( 63), UINT8_C( 44), UINT8_C( 63), UINT8_C( 55), UINT8_C( 63), UINT8_C( 38) },
+      { UINT8_C(120), UINT8_C( 37), UINT8_C(172), UINT8_C( 95), UINT8_C( 19), UINT8_C(252), UINT8_C( 42), UINT8_C(141),
+        UINT8_C(  1), UINT8_C( 68), UINT8_C(224), UINT8_C( 44), UINT8_C(186), UINT8_C( 55), UINT8_C(124), UINT8_C( 38) } },
+    { { UINT8_C( 33), UINT8_C(202), UINT8_C( 28), UINT8_C(124), UINT8_C(157), UINT8_C(229), UINT8_C( 12), UINT8_C( 27),
+        UINT8_C( 64), UINT8_C(112), UINT8_C(173), UINT8_C(209), UINT8_C(146), UINT8_C(  7), UINT8_C(209), UINT8_C(113) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) },
+      { UINT8_C( 33), UINT8_C( 63), UINT8_C( 28), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 12), UINT8_C( 27),
+        UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C(  7), UINT8_C( 63), UINT8_C( 63) },
+      { UINT8_C( 33), UINT8_C(202), UINT8_C( 28), UINT8_C(124), UINT8_C(157), UINT8_C(229), UINT8_C( 12), UINT8_C( 27),
+        UINT8_C( 64), UINT8_C(112), UINT8_C(173), UINT8_C(209), UINT8_C(146), UINT8_C(  7), UINT8_C(209), UINT8_C(113) } },
+    { { UINT8_C(145), UINT8_C(161), UINT8_C(235), UINT8_C( 62), UINT8_C(148), UINT8_C(220), UINT8_C(  3), UINT8_C( 50),
+           UINT8_MAX, UINT8_C(214), UINT8_C(114), UINT8_C(153), UINT8_C( 45), UINT8_C(  3), UINT8_C( 17), UINT8_C( 87) },
+      { UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1),
+        UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1), UINT8_C(  1) },
+      { UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 62), UINT8_C( 63), UINT8_C( 63), UINT8_C(  3), UINT8_C( 50),
+        UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 63), UINT8_C( 45), UINT8_C(  3), UINT8_C( 17), UINT8_C( 63) },
+      { UINT8_C(145), UINT8_C(161), UINT8_C(235), UINT8_C( 62), UINT8_C(148), UINT8_C(220), UINT8_C(  3), UINT8_C( 50),
+           UINT8_MAX, UINT8_C(214), UINT8_C(114), UINT8_C(153), UINT8_C( 45), UINT8_C(  3), UINT8_C( 17), UINT8_C( 87) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16u8  a = simde_x_msa_ld_u_b(test_vec[i].a, 0);
+    simde_v16u8 r0 = simde_msa_sat_u_b(a, 0);
+    simde_v16u8 r5 = simde_msa_sat_u_b(a, 5);
+    simde_v16u8 r7 = simde_msa_sat_u_b(a, 7);
+
+    simde_test_msa_v16u8_assert_equal(r0, simde_x_msa_ld_u_b(test_vec[i].r0, 0));
+    simde_test_msa_v16u8_assert_equal(r5, simde_x_msa_ld_u_b(test_vec[i].r5, 0));
+    simde_test_msa_v16u8_assert_equal(r7, simde_x_msa_ld_u_b(test_vec[i].r7, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16u8  a = simde_test_msa_v16u8_random();
+    simde_v16u8 r0 = simde_msa_sat_u_b(a, 0);
+    simde_v16u8 r5 = simde_msa_sat_u_b(a, 5);
+    simde_v16u8 r7 = simde_msa_sat_u_b(a, 7);
+
+    simde_test_msa_v16u8_write(2,  a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16u8_write(2, r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16u8_write(2, r5, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16u8_write(2, r7, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sat_u_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint16_t   a[8];
+    uint16_t  r0[8];
+    uint16_t r10[8];
+    uint16_t r15[8];
+  } test_vec[] = {
+    { { UINT16_C(30430), UINT16_C(25803), UINT16_C(39507), UINT16_C(53462), UINT16_C(45211), UINT16_C( 3049), UINT16_C(48372), UINT16_C(32994) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047) },
+      { UINT16_C(30430), UINT16_C(25803), UINT16_C(39507), UINT16_C(53462), UINT16_C(45211), UINT16_C( 3049), UINT16_C(48372), UINT16_C(32994) } },
+    { { UINT16_C(43169), UINT16_C(48726), UINT16_C(38217), UINT16_C(34509), UINT16_C(60593), UINT16_C(11034), UINT16_C(27500), UINT16_C(63028) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047) },
+      { UINT16_C(43169), UINT16_C(48726), UINT16_C(38217), UINT16_C(34509), UINT16_C(60593), UINT16_C(11034), UINT16_C(27500), UINT16_C(63028) } },
+    { { UINT16_C(25821), UINT16_C(55793), UINT16_C(21329), UINT16_C( 4861), UINT16_C(60996), UINT16_C(28151), UINT16_C(12697), UINT16_C(38018) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047) },
+      { UINT16_C(25821), UINT16_C(55793), UINT16_C(21329), UINT16_C( 4861), UINT16_C(60996), UINT16_C(28151), UINT16_C(12697), UINT16_C(38018) } },
+    { { UINT16_C(11468), UINT16_C(52648), UINT16_C(44216), UINT16_C(39154), UINT16_C(62715), UINT16_C(40903), UINT16_C(24837), UINT16_C(  891) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C(  891) },
+      { UINT16_C(11468), UINT16_C(52648), UINT16_C(44216), UINT16_C(39154), UINT16_C(62715), UINT16_C(40903), UINT16_C(24837), UINT16_C(  891) } },
+    { { UINT16_C(65227), UINT16_C(42707), UINT16_C(40394), UINT16_C(10548), UINT16_C(15447), UINT16_C(48888), UINT16_C(63634), UINT16_C(34418) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047) },
+      { UINT16_C(65227), UINT16_C(42707), UINT16_C(40394), UINT16_C(10548), UINT16_C(15447), UINT16_C(48888), UINT16_C(63634), UINT16_C(34418) } },
+    { { UINT16_C(24870), UINT16_C(10764), UINT16_C( 8490), UINT16_C(21982), UINT16_C(55837), UINT16_C(25424), UINT16_C(30796), UINT16_C( 6193) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047) },
+      { UINT16_C(24870), UINT16_C(10764), UINT16_C( 8490), UINT16_C(21982), UINT16_C(55837), UINT16_C(25424), UINT16_C(30796), UINT16_C( 6193) } },
+    { { UINT16_C(24348), UINT16_C(62078), UINT16_C(29636), UINT16_C(56362), UINT16_C(52271), UINT16_C( 6976), UINT16_C(41591), UINT16_C(40308) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047) },
+      { UINT16_C(24348), UINT16_C(62078), UINT16_C(29636), UINT16_C(56362), UINT16_C(52271), UINT16_C( 6976), UINT16_C(41591), UINT16_C(40308) } },
+    { { UINT16_C(27812), UINT16_C(58313), UINT16_C(56191), UINT16_C( 5877), UINT16_C(45617), UINT16_C(46461), UINT16_C( 8017), UINT16_C(36069) },
+      { UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1), UINT16_C(    1) },
+      { UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047), UINT16_C( 2047) },
+      { UINT16_C(27812), UINT16_C(58313), UINT16_C(56191), UINT16_C( 5877), UINT16_C(45617), UINT16_C(46461), UINT16_C( 8017), UINT16_C(36069) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8u16   a = simde_x_msa_ld_u_h(test_vec[i].a, 0);
+    simde_v8u16  r0 = simde_msa_sat_u_h(a, 0);
+    simde_v8u16 r10 = simde_msa_sat_u_h(a, 10);
+    simde_v8u16 r15 = simde_msa_sat_u_h(a, 15);
+
+    simde_test_msa_v8u16_assert_equal( r0, simde_x_msa_ld_u_h(test_vec[i].r0 , 0));
+    simde_test_msa_v8u16_assert_equal(r10, simde_x_msa_ld_u_h(test_vec[i].r10, 0));
+    simde_test_msa_v8u16_assert_equal(r15, simde_x_msa_ld_u_h(test_vec[i].r15, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8u16   a = simde_test_msa_v8u16_random();
+    simde_v8u16  r0 = simde_msa_sat_u_h(a, 0);
+    simde_v8u16 r10 = simde_msa_sat_u_h(a, 10);
+    simde_v8u16 r15 = simde_msa_sat_u_h(a, 15);
+
+    simde_test_msa_v8u16_write(2,   a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8u16_write(2,  r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8u16_write(2, r10, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8u16_write(2, r15, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sat_u_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint32_t   a[4];
+    uint32_t  r0[4];
+    uint32_t r24[4];
+    uint32_t r31[4];
+  } test_vec[] = {
+    { { UINT32_C(2219741708), UINT32_C(2357048333), UINT32_C(2035396532), UINT32_C(1031738761) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(2219741708), UINT32_C(2357048333), UINT32_C(2035396532), UINT32_C(1031738761) } },
+    { { UINT32_C(2446157596), UINT32_C( 184000116), UINT32_C(1913294855), UINT32_C(2615052304) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(2446157596), UINT32_C( 184000116), UINT32_C(1913294855), UINT32_C(2615052304) } },
+    { { UINT32_C(1923911214), UINT32_C(3800304884), UINT32_C(2754503119), UINT32_C(3740172678) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(1923911214), UINT32_C(3800304884), UINT32_C(2754503119), UINT32_C(3740172678) } },
+    { { UINT32_C(2603918447), UINT32_C(3188590425), UINT32_C(2062441405), UINT32_C(2361625112) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(2603918447), UINT32_C(3188590425), UINT32_C(2062441405), UINT32_C(2361625112) } },
+    { { UINT32_C(1631859888), UINT32_C(2312081519), UINT32_C(3192035630), UINT32_C(2122133428) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(1631859888), UINT32_C(2312081519), UINT32_C(3192035630), UINT32_C(2122133428) } },
+    { { UINT32_C(3189696932), UINT32_C(1739073277), UINT32_C(2179819948), UINT32_C(3281416565) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(3189696932), UINT32_C(1739073277), UINT32_C(2179819948), UINT32_C(3281416565) } },
+    { { UINT32_C(1834662476), UINT32_C(2965433477), UINT32_C(1272772128), UINT32_C(2967117536) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(1834662476), UINT32_C(2965433477), UINT32_C(1272772128), UINT32_C(2967117536) } },
+    { { UINT32_C(3799578560), UINT32_C(4213024130), UINT32_C(1911282332), UINT32_C(3297043731) },
+      { UINT32_C(         1), UINT32_C(         1), UINT32_C(         1), UINT32_C(         1) },
+      { UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431), UINT32_C(  33554431) },
+      { UINT32_C(3799578560), UINT32_C(4213024130), UINT32_C(1911282332), UINT32_C(3297043731) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4u32   a = simde_x_msa_ld_u_w(test_vec[i].a, 0);
+    simde_v4u32  r0 = simde_msa_sat_u_w(a, 0);
+    simde_v4u32 r24 = simde_msa_sat_u_w(a, 24);
+    simde_v4u32 r31 = simde_msa_sat_u_w(a, 31);
+
+    simde_test_msa_v4u32_assert_equal( r0, simde_x_msa_ld_u_w(test_vec[i].r0 , 0));
+    simde_test_msa_v4u32_assert_equal(r24, simde_x_msa_ld_u_w(test_vec[i].r24, 0));
+    simde_test_msa_v4u32_assert_equal(r31, simde_x_msa_ld_u_w(test_vec[i].r31, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4u32   a = simde_test_msa_v4u32_random();
+    simde_v4u32  r0 = simde_msa_sat_u_w(a, 0);
+    simde_v4u32 r24 = simde_msa_sat_u_w(a, 24);
+    simde_v4u32 r31 = simde_msa_sat_u_w(a, 31);
+
+    simde_test_msa_v4u32_write(2,   a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4u32_write(2,  r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4u32_write(2, r24, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4u32_write(2, r31, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sat_u_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    uint64_t   a[2];
+    uint64_t  r0[2];
+    uint64_t r56[2];
+    uint64_t r63[2];
+  } test_vec[] = {
+    { { UINT64_C( 4068097720973821949), UINT64_C(10037145904516509817) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C( 4068097720973821949), UINT64_C(10037145904516509817) } },
+    { { UINT64_C( 2848628527188794977), UINT64_C( 4339940412625831991) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C( 2848628527188794977), UINT64_C( 4339940412625831991) } },
+    { { UINT64_C(13948901950727172586), UINT64_C( 3200600977115040611) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C(13948901950727172586), UINT64_C( 3200600977115040611) } },
+    { { UINT64_C(14161860460596166695), UINT64_C( 2883915793228117589) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C(14161860460596166695), UINT64_C( 2883915793228117589) } },
+    { { UINT64_C(15064312447799891156), UINT64_C( 9604280679778620294) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C(15064312447799891156), UINT64_C( 9604280679778620294) } },
+    { { UINT64_C(16185869245662691652), UINT64_C(12499910121098099150) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C(16185869245662691652), UINT64_C(12499910121098099150) } },
+    { { UINT64_C( 2187766472399773662), UINT64_C(13144492820954868106) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C( 2187766472399773662), UINT64_C(13144492820954868106) } },
+    { { UINT64_C( 8650801094063733993), UINT64_C(12968630796812310511) },
+      { UINT64_C(                   1), UINT64_C(                   1) },
+      { UINT64_C(  144115188075855871), UINT64_C(  144115188075855871) },
+      { UINT64_C( 8650801094063733993), UINT64_C(12968630796812310511) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2u64   a = simde_x_msa_ld_u_d(test_vec[i].a, 0);
+    simde_v2u64  r0 = simde_msa_sat_u_d(a, 0);
+    simde_v2u64 r56 = simde_msa_sat_u_d(a, 56);
+    simde_v2u64 r63 = simde_msa_sat_u_d(a, 63);
+
+    simde_test_msa_v2u64_assert_equal( r0, simde_x_msa_ld_u_d(test_vec[i].r0 , 0));
+    simde_test_msa_v2u64_assert_equal(r56, simde_x_msa_ld_u_d(test_vec[i].r56, 0));
+    simde_test_msa_v2u64_assert_equal(r63, simde_x_msa_ld_u_d(test_vec[i].r63, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2u64   a = simde_test_msa_v2u64_random();
+    simde_v2u64  r0 = simde_msa_sat_u_d(a, 0);
+    simde_v2u64 r56 = simde_msa_sat_u_d(a, 56);
+    simde_v2u64 r63 = simde_msa_sat_u_d(a, 63);
+
+    simde_test_msa_v2u64_write(2,   a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2u64_write(2,  r0, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2u64_write(2, r56, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2u64_write(2, r63, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_s_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_s_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_s_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_s_d)
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_u_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_u_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_u_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(sat_u_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN sll
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/sll.h"
+
+static int
+test_simde_sll_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  74), -INT8_C(  50), -INT8_C(  12), -INT8_C(  34),  INT8_C(  23),  INT8_C(  72),  INT8_C(  32),  INT8_C(  72),
+         INT8_C(  75), -INT8_C(  91), -INT8_C( 108), -INT8_C(   7), -INT8_C(  20),  INT8_C( 115),  INT8_C(  37),  INT8_C(  94) },
+      {  INT8_C(  20), -INT8_C(  16),  INT8_C(  11),  INT8_C(  74),  INT8_C(  67), -INT8_C(  60),  INT8_C( 102),  INT8_C(  80),
+         INT8_C(  84), -INT8_C(  35),  INT8_C(  91),  INT8_C(  40), -INT8_C(  92), -INT8_C(  77),  INT8_C(  21),  INT8_C(  18) },
+      { -INT8_C(  96), -INT8_C(  50), -INT8_C(  96),  INT8_C( 120), -INT8_C(  72),      INT8_MIN,  INT8_C(   0),  INT8_C(  72),
+        -INT8_C(  80), -INT8_C(  96), -INT8_C(  96), -INT8_C(   7), -INT8_C(  64), -INT8_C( 104), -INT8_C(  96),  INT8_C( 120) } },
+    { { -INT8_C(  51),  INT8_C( 123),  INT8_C( 125),  INT8_C(  34), -INT8_C(  67), -INT8_C(   5),  INT8_C(  33),  INT8_C(  12),
+        -INT8_C(  25), -INT8_C(  19), -INT8_C(  46), -INT8_C(  24), -INT8_C(  37), -INT8_C(   9), -INT8_C(  75), -INT8_C(   4) },
+      {  INT8_C(  76),  INT8_C(  38), -INT8_C(  98), -INT8_C(  71), -INT8_C( 107),  INT8_C(  52),  INT8_C(  20),  INT8_C(  93),
+        -INT8_C( 122),  INT8_C(  68),  INT8_C(  50),  INT8_C( 104), -INT8_C( 117),  INT8_C(  96), -INT8_C(  70),  INT8_C(  73) },
+      { -INT8_C(  48), -INT8_C(  64),  INT8_C(  64),  INT8_C(  68), -INT8_C(  96), -INT8_C(  80),  INT8_C(  16),      INT8_MIN,
+        -INT8_C(  64), -INT8_C(  48),  INT8_C(  72), -INT8_C(  24), -INT8_C(  40), -INT8_C(   9), -INT8_C(  44), -INT8_C(   8) } },
+    { { -INT8_C(  47),  INT8_C( 122), -INT8_C(  69),  INT8_C(  42), -INT8_C(   6), -INT8_C(  55), -INT8_C(   7),  INT8_C(   4),
+         INT8_C(  58),  INT8_C(  37), -INT8_C(  86), -INT8_C(  23), -INT8_C(  59), -INT8_C(  95),      INT8_MAX, -INT8_C(  38) },
+      {  INT8_C(  68),  INT8_C(  29), -INT8_C(  55),  INT8_C(  45), -INT8_C(  65), -INT8_C(  92), -INT8_C( 120), -INT8_C(  85),
+        -INT8_C(  86), -INT8_C( 124),  INT8_C(  47), -INT8_C(  26),  INT8_C(  57), -INT8_C(  57),  INT8_C( 115),  INT8_C(  11) },
+      {  INT8_C(  16),  INT8_C(  64),  INT8_C( 118),  INT8_C(  64),  INT8_C(   0), -INT8_C( 112), -INT8_C(   7),  INT8_C(  32),
+        -INT8_C(  24),  INT8_C(  80),  INT8_C(   0),  INT8_C(  64), -INT8_C( 118),      INT8_MIN, -INT8_C(   8), -INT8_C(  48) } },
+    { {  INT8_C(  30), -INT8_C( 118),  INT8_C(  97), -INT8_C(  77),  INT8_C( 104), -INT8_C(  27), -INT8_C(  97), -INT8_C(   1),
+        -INT8_C(  66), -INT8_C(  51), -INT8_C(  36), -INT8_C(   3), -INT8_C( 125), -INT8_C(  89),  INT8_C(  81), -INT8_C(  31) },
+      { -INT8_C( 109), -INT8_C( 110),  INT8_C(   0), -INT8_C(  63),  INT8_C( 122),  INT8_C(  67),  INT8_C(   8), -INT8_C(  25),
+         INT8_C(   8),  INT8_C( 124), -INT8_C(  49),  INT8_C(  52), -INT8_C(  58),  INT8_C( 105),  INT8_C( 116), -INT8_C(   6) },
+      { -INT8_C(  16),  INT8_C(  40),  INT8_C(  97),  INT8_C( 102), -INT8_C(  96),  INT8_C(  40), -INT8_C(  97),      INT8_MIN,
+        -INT8_C(  66), -INT8_C(  48),  INT8_C(   0), -INT8_C(  48), -INT8_C(  64),  INT8_C(  78),  INT8_C(  16), -INT8_C( 124) } },
+    { { -INT8_C(  34), -INT8_C(  65), -INT8_C(  73), -INT8_C(  97),  INT8_C(  35),  INT8_C(  24),  INT8_C(  61),  INT8_C(  73),
+         INT8_C(  94),  INT8_C(  27),  INT8_C(  39),  INT8_C(  10), -INT8_C(  87),  INT8_C( 107), -INT8_C( 114),  INT8_C(  92) },
+      {  INT8_C(  59), -INT8_C(  57),  INT8_C(  59),  INT8_C(   5),  INT8_C(  50), -INT8_C(  80), -INT8_C(  20), -INT8_C(  67),
+         INT8_C(  57), -INT8_C(   9),  INT8_C(  62),  INT8_C(  64),  INT8_C(  70),  INT8_C( 115), -INT8_C(  97), -INT8_C(  74) },
+      { -INT8_C(  16),      INT8_MIN, -INT8_C(  72), -INT8_C(  32), -INT8_C( 116),  INT8_C(  24), -INT8_C(  48),  INT8_C(  32),
+        -INT8_C(  68),      INT8_MIN, -INT8_C(  64),  INT8_C(  10),  INT8_C(  64),  INT8_C(  88),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C( 103), -INT8_C(  66), -INT8_C(  81), -INT8_C( 112),  INT8_C(  66), -INT8_C( 108),  INT8_C(  38), -INT8_C(  94),
+        -INT8_C(  54), -INT8_C(  10), -INT8_C(  11), -INT8_C(  73), -INT8_C(  73), -INT8_C( 126),      INT8_MIN, -INT8_C(  15) },
+      {  INT8_C(  96),  INT8_C(  11),      INT8_MAX,  INT8_C(  96),  INT8_C(  14),  INT8_C( 113),  INT8_C(   4),  INT8_C( 110),
+        -INT8_C(  48), -INT8_C(  67), -INT8_C(  59),  INT8_C(  92), -INT8_C( 123),  INT8_C( 102), -INT8_C(   7),  INT8_C(  24) },
+      { -INT8_C( 103), -INT8_C(  16),      INT8_MIN, -INT8_C( 112),      INT8_MIN,  INT8_C(  40),  INT8_C(  96),      INT8_MIN,
+        -INT8_C(  54), -INT8_C(  64), -INT8_C(  96),  INT8_C( 112), -INT8_C(  32),      INT8_MIN,  INT8_C(   0), -INT8_C(  15) } },
+    { { -INT8_C(  81), -INT8_C(  83),  INT8_C(  44),  INT8_C(  39),  INT8_C(  87),  INT8_C(  89),  INT8_C(  23),  INT8_C( 104),
+        -INT8_C(  73), -INT8_C(  88), -INT8_C(  62),  INT8_C( 108),  INT8_C( 109), -INT8_C(  51),  INT8_C(  98), -INT8_C(  79) },
+      { -INT8_C(  60), -INT8_C(  98), -INT8_C(  26),  INT8_C(  31), -INT8_C(  96),  INT8_C(  70),  INT8_C(   1), -INT8_C(  28),
+        -INT8_C(  26),  INT8_C(  41),  INT8_C(  68),  INT8_C(  17), -INT8_C( 114),  INT8_C(  81), -INT8_C( 117), -INT8_C(  86) },
+      { -INT8_C(  16),  INT8_C(  64),  INT8_C(   0),      INT8_MIN,  INT8_C(  87),  INT8_C(  64),  INT8_C(  46),      INT8_MIN,
+        -INT8_C(  64),  INT8_C(  80),  INT8_C(  32), -INT8_C(  40),  INT8_C(  64), -INT8_C( 102),  INT8_C(  16), -INT8_C(  60) } },
+    { {  INT8_C(  34),  INT8_C(  22),  INT8_C( 111),  INT8_C(  99),  INT8_C( 118), -INT8_C( 112),  INT8_C(  50), -INT8_C(   6),
+         INT8_C( 108),  INT8_C(  84), -INT8_C(  36),  INT8_C(  96),  INT8_C(  14), -INT8_C(  34), -INT8_C( 115),  INT8_C(   7) },
+      {  INT8_C(  44),  INT8_C(   1), -INT8_C( 108), -INT8_C( 121),  INT8_C( 121), -INT8_C( 124), -INT8_C(  72),  INT8_C(  20),
+         INT8_C(   7), -INT8_C( 122), -INT8_C(  31),  INT8_C(  28),  INT8_C(  42), -INT8_C(   4), -INT8_C(  70), -INT8_C(  44) },
+      {  INT8_C(  32),  INT8_C(  44), -INT8_C(  16),      INT8_MIN, -INT8_C(  20),  INT8_C(   0),  INT8_C(  50), -INT8_C(  96),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0),  INT8_C(  56), -INT8_C(  32),  INT8_C(  52),  INT8_C( 112) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_sll_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_sll_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sll_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C( 10114),  INT16_C(   222),  INT16_C( 13252),  INT16_C(  8830),  INT16_C( 28036), -INT16_C(  8167),  INT16_C( 19930), -INT16_C( 22852) },
+      { -INT16_C(  2560),  INT16_C( 19621), -INT16_C( 19299), -INT16_C(  6641),  INT16_C( 25564), -INT16_C( 13222), -INT16_C( 30392),  INT16_C(  7118) },
+      {  INT16_C( 10114),  INT16_C(  7104),        INT16_MIN,  INT16_C(     0),  INT16_C( 16384),  INT16_C( 25600), -INT16_C(  9728),  INT16_C(     0) } },
+    { {  INT16_C(  7357), -INT16_C(  2868), -INT16_C( 29918), -INT16_C( 16101),  INT16_C(  7910), -INT16_C(  9675),  INT16_C( 30635),  INT16_C( 23293) },
+      {  INT16_C(  4799),  INT16_C( 13042), -INT16_C( 25598),  INT16_C( 13256), -INT16_C( 21189), -INT16_C(  5525), -INT16_C( 24813), -INT16_C(  2120) },
+      {        INT16_MIN, -INT16_C( 11472),  INT16_C( 11400),  INT16_C(  6912),  INT16_C( 12288), -INT16_C( 22528), -INT16_C( 17064), -INT16_C(   768) } },
+    { { -INT16_C( 13425),  INT16_C( 27077), -INT16_C(  2770),  INT16_C( 25481), -INT16_C(  6498),  INT16_C( 15509), -INT16_C( 13030), -INT16_C(  1614) },
+      { -INT16_C( 12978), -INT16_C(  1964),  INT16_C(  7897),  INT16_C(  4226), -INT16_C( 28067), -INT16_C(  2330), -INT16_C( 21542), -INT16_C(  7502) },
+      { -INT16_C( 16384), -INT16_C( 25520),  INT16_C( 23552), -INT16_C( 29148), -INT16_C( 16384),  INT16_C(  9536),  INT16_C( 26624), -INT16_C(  6456) } },
+    { { -INT16_C( 22210), -INT16_C( 16241), -INT16_C( 30340),  INT16_C(  3878),  INT16_C( 30122),  INT16_C( 22968), -INT16_C( 16032), -INT16_C( 12363) },
+      { -INT16_C( 14998),  INT16_C( 30456),  INT16_C( 24881),  INT16_C( 25885),  INT16_C( 10301),  INT16_C( 16192),  INT16_C( 25668),  INT16_C( 17906) },
+      { -INT16_C(  2048), -INT16_C( 28928),  INT16_C(  4856), -INT16_C( 16384),  INT16_C( 16384),  INT16_C( 22968),  INT16_C(  5632),  INT16_C( 16084) } },
+    { {  INT16_C( 12594), -INT16_C( 12809), -INT16_C( 18979),  INT16_C( 14711),  INT16_C(  5631),  INT16_C( 13257), -INT16_C( 26742),  INT16_C(  5485) },
+      {  INT16_C( 30918), -INT16_C( 13502), -INT16_C( 11822), -INT16_C( 17491),  INT16_C( 26582),  INT16_C( 20899), -INT16_C( 26873), -INT16_C(  5261) },
+      {  INT16_C( 19584),  INT16_C( 14300), -INT16_C( 10380), -INT16_C(  8192),  INT16_C( 32704), -INT16_C( 25016), -INT16_C( 15104), -INT16_C( 21656) } },
+    { {  INT16_C( 31483),  INT16_C( 29871), -INT16_C( 19467),  INT16_C( 29538), -INT16_C( 27423), -INT16_C( 17367), -INT16_C( 28317),  INT16_C( 21729) },
+      { -INT16_C( 19707), -INT16_C(  2051),  INT16_C( 15509),  INT16_C( 26185), -INT16_C( 27635),  INT16_C( 31554), -INT16_C( 11327),  INT16_C( 12745) },
+      {  INT16_C( 24416), -INT16_C(  8192),  INT16_C( 32416), -INT16_C( 15360),  INT16_C(  8192), -INT16_C(  3932),  INT16_C(  8902), -INT16_C( 15872) } },
+    { {  INT16_C( 14659), -INT16_C(  8308),  INT16_C(  2379),  INT16_C(  7918), -INT16_C( 11636), -INT16_C(  9122),  INT16_C( 18435),  INT16_C(  9274) },
+      {  INT16_C( 10346),  INT16_C( 29330), -INT16_C(  5046), -INT16_C( 19401),  INT16_C( 13867),  INT16_C( 23671),  INT16_C( 12567),  INT16_C( 24347) },
+      {  INT16_C(  3072),  INT16_C( 32304),  INT16_C( 11264),  INT16_C( 30464),  INT16_C( 24576),  INT16_C( 12032),  INT16_C(   384), -INT16_C( 12288) } },
+    { {  INT16_C( 22219), -INT16_C(  9949), -INT16_C(  4009),  INT16_C(  9646), -INT16_C( 10752), -INT16_C( 22973), -INT16_C( 11736), -INT16_C(    95) },
+      { -INT16_C(  6916), -INT16_C(  6123), -INT16_C( 11515), -INT16_C( 14470),  INT16_C( 15292),  INT16_C( 21364),  INT16_C( 32283), -INT16_C( 26512) },
+      { -INT16_C( 20480),  INT16_C(  9312),  INT16_C(  2784), -INT16_C( 18432),  INT16_C(     0),  INT16_C( 25648),  INT16_C( 16384), -INT16_C(    95) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_sll_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_sll_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sll_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   251402933), -INT32_C(  1241815784), -INT32_C(  1252311699),  INT32_C(   600341555) },
+      {  INT32_C(   834210070), -INT32_C(   759909464),  INT32_C(  1306451300),  INT32_C(   172990421) },
+      {  INT32_C(  1388314624), -INT32_C(    77260800),  INT32_C(  1437849296), -INT32_C(  2040528896) } },
+    { {  INT32_C(  1653765698), -INT32_C(  1807065134), -INT32_C(  2072440278),  INT32_C(   139203344) },
+      { -INT32_C(   200222615),  INT32_C(  1275697804),  INT32_C(  1466959437), -INT32_C(   644919663) },
+      {  INT32_C(   619480064), -INT32_C(  1510137856),  INT32_C(   574963712),  INT32_C(   639631360) } },
+    { {  INT32_C(  1508846780),  INT32_C(   923206230),  INT32_C(   898092146),  INT32_C(   784812540) },
+      { -INT32_C(   225445167),  INT32_C(  1137127307), -INT32_C(  1306679765),  INT32_C(    30780028) },
+      {  INT32_C(  1501036544),  INT32_C(   940748800),  INT32_C(  1046712320), -INT32_C(  1073741824) } },
+    { {  INT32_C(   946356284),  INT32_C(  1460211440),  INT32_C(   311609385), -INT32_C(   324377375) },
+      {  INT32_C(  1499708256),  INT32_C(   159778786),  INT32_C(   879510014),  INT32_C(  1087435911) },
+      {  INT32_C(   946356284),  INT32_C(  1545878464),  INT32_C(  1073741824),  INT32_C(  1429368960) } },
+    { {  INT32_C(  1153874920), -INT32_C(   863392746), -INT32_C(   126650949), -INT32_C(  1871000474) },
+      { -INT32_C(   847023341), -INT32_C(  1833191794),  INT32_C(  1174319187), -INT32_C(   201629329) },
+      { -INT32_C(   549453824),  INT32_C(  1795522560), -INT32_C(  1378353152),  INT32_C(  1714618368) } },
+    { { -INT32_C(   241994576),  INT32_C(  1034611327),  INT32_C(  1724351091), -INT32_C(   320716312) },
+      { -INT32_C(  1177351814),  INT32_C(  2108510222),  INT32_C(  1652149473), -INT32_C(   883536244) },
+      { -INT32_C(  1073741824), -INT32_C(  1163935744), -INT32_C(   846265114),  INT32_C(   605978624) } },
+    { {  INT32_C(  1363669656),  INT32_C(  1557059840), -INT32_C(   384664636), -INT32_C(  1227401895) },
+      {  INT32_C(  1876219791),  INT32_C(   764507494),  INT32_C(  1625237274),  INT32_C(  1295101868) },
+      { -INT32_C(   112459776),  INT32_C(   867581952),  INT32_C(   268435456),  INT32_C(  1968541696) } },
+    { { -INT32_C(  1507008077), -INT32_C(  1499881987),  INT32_C(  1638348723),  INT32_C(    11252708) },
+      {  INT32_C(  1025998684),  INT32_C(   285759747),  INT32_C(  1584286316), -INT32_C(  1336161328) },
+      {  INT32_C(   805306368),  INT32_C(   885845992),  INT32_C(  1937453056), -INT32_C(  1276903424) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_sll_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_sll_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sll_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 3468246588588522889),  INT64_C(  738630276505520290) },
+      { -INT64_C( 8912362885658260353), -INT64_C( 8055565877278432514) },
+      {                      INT64_MIN,                      INT64_MIN } },
+    { { -INT64_C(  182169008351475504), -INT64_C( 8848027874415274229) },
+      {  INT64_C( 8963255700935253330), -INT64_C( 6205943983489434902) },
+      {  INT64_C( 4107881544834613248), -INT64_C( 1991668556692979712) } },
+    { {  INT64_C( 8766986472403085216), -INT64_C( 2744742084358119910) },
+      { -INT64_C( 4909756564347437442),  INT64_C( 7746060718588934591) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 5494920219567071077), -INT64_C( 1239440699242649612) },
+      { -INT64_C( 5126510267235036171), -INT64_C( 2649992615194447935) },
+      {  INT64_C( 1396115884484853760), -INT64_C( 2478881398485299224) } },
+    { { -INT64_C( 3732830933511297632), -INT64_C( 2367964516231087256) },
+      { -INT64_C( 4907294915799818341),  INT64_C( 8211032780571095182) },
+      {  INT64_C( 6398420094627610624), -INT64_C( 3227846918946553856) } },
+    { { -INT64_C( 1149936683830896227), -INT64_C( 2991311512466222887) },
+      { -INT64_C( 1908389189522469326), -INT64_C( 1326848958488000651) },
+      {  INT64_C( 7382525689167085568),  INT64_C( 1954562238278795264) } },
+    { {  INT64_C( 7675987736012106294),  INT64_C( 8240654489827013109) },
+      { -INT64_C( 5807274574418268147), -INT64_C( 5474031232842858590) },
+      { -INT64_C( 3259013864686698496), -INT64_C(  326572734614077440) } },
+    { { -INT64_C( 1854290649333160236),  INT64_C( 1610593915767012433) },
+      { -INT64_C( 7739263287010093906),  INT64_C( 6662609707466192146) },
+      { -INT64_C( 3912220701301407744), -INT64_C( 1546904236510150656) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_sll_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_sll_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(sll_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(sll_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(sll_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(sll_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN sra
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/sra.h"
+
+static int
+test_simde_sra_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C( 102), -INT8_C( 101), -INT8_C( 112),  INT8_C(  79), -INT8_C(  47), -INT8_C(  95),  INT8_C(   0), -INT8_C(  35),
+         INT8_C(  98),  INT8_C(   7),  INT8_C(  88), -INT8_C(   5), -INT8_C(  53), -INT8_C(  85),  INT8_C(  29), -INT8_C(  31) },
+      {  INT8_C(  28),  INT8_C( 117),  INT8_C(   7),  INT8_C(  51),  INT8_C( 105), -INT8_C(   4),  INT8_C( 123), -INT8_C(  11),
+         INT8_C(  82),  INT8_C(  94),  INT8_C(  85),  INT8_C(  87),  INT8_C( 118), -INT8_C(   5), -INT8_C(  57), -INT8_C(  88) },
+      { -INT8_C(   7), -INT8_C(   4), -INT8_C(   1),  INT8_C(   9), -INT8_C(  24), -INT8_C(   6),  INT8_C(   0), -INT8_C(   2),
+         INT8_C(  24),  INT8_C(   0),  INT8_C(   2), -INT8_C(   1), -INT8_C(   1), -INT8_C(  11),  INT8_C(   0), -INT8_C(  31) } },
+    { { -INT8_C(   7),  INT8_C(  10), -INT8_C(  81),  INT8_C(  74),  INT8_C( 101), -INT8_C(  80),  INT8_C(  30),  INT8_C(  61),
+         INT8_C(  61), -INT8_C( 113), -INT8_C( 103),  INT8_C(  38), -INT8_C(  16), -INT8_C(  85),  INT8_C(  98), -INT8_C(  78) },
+      {  INT8_C(  48),  INT8_C( 112), -INT8_C(  69), -INT8_C(  17), -INT8_C( 118),  INT8_C( 101),  INT8_C( 124), -INT8_C(  60),
+         INT8_C(  16),  INT8_C(  84), -INT8_C(  29),  INT8_C(  52),  INT8_C(  49),  INT8_C(   4),  INT8_C( 104), -INT8_C(  41) },
+      { -INT8_C(   7),  INT8_C(  10), -INT8_C(  11),  INT8_C(   0),  INT8_C(  25), -INT8_C(   3),  INT8_C(   1),  INT8_C(   3),
+         INT8_C(  61), -INT8_C(   8), -INT8_C(  13),  INT8_C(   2), -INT8_C(   8), -INT8_C(   6),  INT8_C(  98), -INT8_C(   1) } },
+    { {  INT8_C(  69), -INT8_C(  67),  INT8_C( 106),  INT8_C(  11), -INT8_C(   5),  INT8_C(  50), -INT8_C(  17), -INT8_C(  41),
+        -INT8_C(   7), -INT8_C(  23), -INT8_C(  16), -INT8_C( 109), -INT8_C(  27), -INT8_C(  94), -INT8_C( 100), -INT8_C(  12) },
+      { -INT8_C(  11), -INT8_C(  39), -INT8_C(  78), -INT8_C(  22), -INT8_C(  22),  INT8_C(  16),  INT8_C( 122), -INT8_C( 100),
+         INT8_C( 113), -INT8_C(  88),  INT8_C(  63),  INT8_C(  63), -INT8_C( 124), -INT8_C(  11), -INT8_C(  79),  INT8_C( 103) },
+      {  INT8_C(   2), -INT8_C(  34),  INT8_C(  26),  INT8_C(   2), -INT8_C(   2),  INT8_C(  50), -INT8_C(   5), -INT8_C(   3),
+        -INT8_C(   4), -INT8_C(  23), -INT8_C(   1), -INT8_C(   1), -INT8_C(   2), -INT8_C(   3), -INT8_C(  50), -INT8_C(   1) } },
+    { {  INT8_C(  81),  INT8_C( 122),  INT8_C(  40),  INT8_C(  49), -INT8_C( 111), -INT8_C(  75), -INT8_C(  46), -INT8_C(  53),
+         INT8_C(  57), -INT8_C( 121), -INT8_C(  96),  INT8_C(  41), -INT8_C(  39), -INT8_C(  87), -INT8_C(  15),  INT8_C(  58) },
+      {  INT8_C(  43), -INT8_C( 105),  INT8_C(  70),  INT8_C(  49),  INT8_C(  18),  INT8_C(  62), -INT8_C(  84), -INT8_C( 102),
+         INT8_C(  85),  INT8_C( 102), -INT8_C(  28), -INT8_C(  17), -INT8_C(  84),  INT8_C(  68),  INT8_C(  77),  INT8_C(  36) },
+      {  INT8_C(  10),  INT8_C(   0),  INT8_C(   0),  INT8_C(  24), -INT8_C(  28), -INT8_C(   2), -INT8_C(   3), -INT8_C(  14),
+         INT8_C(   1), -INT8_C(   2), -INT8_C(   6),  INT8_C(   0), -INT8_C(   3), -INT8_C(   6), -INT8_C(   1),  INT8_C(   3) } },
+    { {  INT8_C(  33), -INT8_C(  38), -INT8_C(  42),  INT8_C( 102), -INT8_C(  95),  INT8_C(  55),  INT8_C(  33),  INT8_C(  69),
+        -INT8_C(   2),  INT8_C( 109), -INT8_C(  81), -INT8_C( 108),  INT8_C(  54), -INT8_C(  39),  INT8_C(   3), -INT8_C(  29) },
+      { -INT8_C(  80), -INT8_C(  82),  INT8_C(  89), -INT8_C(   3), -INT8_C(  31),  INT8_C( 115), -INT8_C(  52), -INT8_C(  37),
+         INT8_C( 119),  INT8_C(  81),  INT8_C(  73),  INT8_C(  23),  INT8_C(  24),  INT8_C(  63), -INT8_C(  59), -INT8_C( 123) },
+      {  INT8_C(  33), -INT8_C(   1), -INT8_C(  21),  INT8_C(   3), -INT8_C(  48),  INT8_C(   6),  INT8_C(   2),  INT8_C(   8),
+        -INT8_C(   1),  INT8_C(  54), -INT8_C(  41), -INT8_C(   1),  INT8_C(  54), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1) } },
+    { { -INT8_C( 101), -INT8_C(  92), -INT8_C(  44), -INT8_C( 107), -INT8_C( 127), -INT8_C(  72),  INT8_C(  49),  INT8_C(  71),
+        -INT8_C(  46), -INT8_C(  43), -INT8_C(  34), -INT8_C(  15),  INT8_C( 104), -INT8_C(  25), -INT8_C(  73), -INT8_C( 111) },
+      { -INT8_C(  60),  INT8_C(  62), -INT8_C(  84), -INT8_C(  16),  INT8_C( 117), -INT8_C(  75), -INT8_C(  82),  INT8_C(  57),
+         INT8_C(  56), -INT8_C(  57),  INT8_C(  96),  INT8_C(  25), -INT8_C(   9),  INT8_C(  82), -INT8_C(  35),  INT8_C( 124) },
+      { -INT8_C(   7), -INT8_C(   2), -INT8_C(   3), -INT8_C( 107), -INT8_C(   4), -INT8_C(   3),  INT8_C(   0),  INT8_C(  35),
+        -INT8_C(  46), -INT8_C(   1), -INT8_C(  34), -INT8_C(   8),  INT8_C(   0), -INT8_C(   7), -INT8_C(   3), -INT8_C(   7) } },
+    { { -INT8_C(  25),  INT8_C(  59),  INT8_C(  93),  INT8_C(  27),  INT8_C(  78), -INT8_C(  85), -INT8_C(  65),  INT8_C( 110),
+        -INT8_C(  14), -INT8_C(  63),  INT8_C(  36), -INT8_C( 102),  INT8_C( 118),      INT8_MAX, -INT8_C(  66),  INT8_C(  24) },
+      { -INT8_C(  26),  INT8_C(  73), -INT8_C(  76), -INT8_C(  74), -INT8_C(  40),  INT8_C(  34), -INT8_C( 106), -INT8_C(  65),
+         INT8_C(  28), -INT8_C(  47), -INT8_C(  47), -INT8_C(  55),  INT8_C( 104),  INT8_C(  77),  INT8_C(  18), -INT8_C(  77) },
+      { -INT8_C(   1),  INT8_C(  29),  INT8_C(   5),  INT8_C(   0),  INT8_C(  78), -INT8_C(  22), -INT8_C(   2),  INT8_C(   0),
+        -INT8_C(   1), -INT8_C(  32),  INT8_C(  18), -INT8_C(  51),  INT8_C( 118),  INT8_C(   3), -INT8_C(  17),  INT8_C(   3) } },
+    { {  INT8_C(  82), -INT8_C(   5),  INT8_C(  79), -INT8_C(   1), -INT8_C(   6), -INT8_C(  30), -INT8_C(  24), -INT8_C(  40),
+         INT8_C(  50),  INT8_C( 116),  INT8_C(  15),  INT8_C(  88),  INT8_C(  61),  INT8_C(  97), -INT8_C(  61),  INT8_C(  75) },
+      { -INT8_C( 111), -INT8_C(  71),  INT8_C(   8), -INT8_C(  90),  INT8_C(   3), -INT8_C(  58), -INT8_C(  10),  INT8_C(  27),
+        -INT8_C( 105), -INT8_C( 102), -INT8_C( 119),  INT8_C(  41), -INT8_C( 115),  INT8_C(  74), -INT8_C(  92),  INT8_C( 104) },
+      {  INT8_C(  41), -INT8_C(   3),  INT8_C(  79), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   5),
+         INT8_C(   0),  INT8_C(  29),  INT8_C(   7),  INT8_C(  44),  INT8_C(   1),  INT8_C(  24), -INT8_C(   4),  INT8_C(  75) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_sra_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_sra_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sra_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(  1505),  INT16_C( 26529), -INT16_C( 16340),  INT16_C( 22411), -INT16_C(  8468),  INT16_C(  9372), -INT16_C(   901),  INT16_C( 17860) },
+      {  INT16_C( 24640), -INT16_C( 21401), -INT16_C(  7751), -INT16_C(  1838), -INT16_C( 10419),  INT16_C( 20493), -INT16_C( 28818), -INT16_C(  7742) },
+      { -INT16_C(  1505),  INT16_C(   207), -INT16_C(    32),  INT16_C(  5602), -INT16_C(     2),  INT16_C(     1), -INT16_C(     1),  INT16_C(  4465) } },
+    { { -INT16_C( 29417),  INT16_C(  4223),  INT16_C( 10909), -INT16_C( 26939),  INT16_C( 22512), -INT16_C( 12195),  INT16_C( 29041), -INT16_C( 18735) },
+      {  INT16_C( 29539),  INT16_C(   661), -INT16_C( 12073),  INT16_C( 21580), -INT16_C( 23034), -INT16_C(   653),  INT16_C(  1911),  INT16_C(  1232) },
+      { -INT16_C(  3678),  INT16_C(   131),  INT16_C(    85), -INT16_C(     7),  INT16_C(   351), -INT16_C(  1525),  INT16_C(   226), -INT16_C( 18735) } },
+    { { -INT16_C( 10532),  INT16_C(  9952),  INT16_C( 12102), -INT16_C( 24976),  INT16_C(   991),  INT16_C( 18362),  INT16_C(  8124), -INT16_C( 19828) },
+      {  INT16_C(  3656), -INT16_C( 27173), -INT16_C( 29984), -INT16_C( 14243), -INT16_C( 32297), -INT16_C( 13303),  INT16_C( 14981), -INT16_C( 22209) },
+      { -INT16_C(    42),  INT16_C(     4),  INT16_C( 12102), -INT16_C(     4),  INT16_C(     7),  INT16_C(    35),  INT16_C(   253), -INT16_C(     1) } },
+    { { -INT16_C( 10491),  INT16_C(  2595), -INT16_C( 15041), -INT16_C( 17817),  INT16_C( 10849), -INT16_C( 26444),  INT16_C(    14), -INT16_C(  3882) },
+      {  INT16_C( 28127), -INT16_C( 20652),  INT16_C( 17585),  INT16_C( 16229), -INT16_C( 17823), -INT16_C( 23004), -INT16_C( 12508),  INT16_C( 21065) },
+      { -INT16_C(     1),  INT16_C(   162), -INT16_C(  7521), -INT16_C(   557),  INT16_C(  5424), -INT16_C(  1653),  INT16_C(     0), -INT16_C(     8) } },
+    { { -INT16_C( 15851),  INT16_C( 24999),  INT16_C( 29677), -INT16_C(  9691),  INT16_C( 26273),  INT16_C( 28646), -INT16_C( 14645),  INT16_C(  1018) },
+      {  INT16_C(  2704),  INT16_C( 32653), -INT16_C( 24062), -INT16_C( 30464), -INT16_C( 22294),  INT16_C( 16507),  INT16_C( 22914),  INT16_C(  7972) },
+      { -INT16_C( 15851),  INT16_C(     3),  INT16_C(  7419), -INT16_C(  9691),  INT16_C(    25),  INT16_C(    13), -INT16_C(  3662),  INT16_C(    63) } },
+    { { -INT16_C(  4429),  INT16_C( 20793), -INT16_C( 14827), -INT16_C( 24955), -INT16_C( 16607), -INT16_C( 28496),  INT16_C(  7354),  INT16_C(  7815) },
+      {  INT16_C(  4392),  INT16_C( 16166), -INT16_C( 25729), -INT16_C( 12493),  INT16_C( 23275),  INT16_C( 22685), -INT16_C(  5804), -INT16_C( 10645) },
+      { -INT16_C(    18),  INT16_C(   324), -INT16_C(     1), -INT16_C(  3120), -INT16_C(     9), -INT16_C(     4),  INT16_C(   459),  INT16_C(     3) } },
+    { {  INT16_C( 15808),  INT16_C(  5819),  INT16_C(  1123), -INT16_C( 25314),  INT16_C(  6746), -INT16_C( 20757), -INT16_C( 32336), -INT16_C( 30349) },
+      { -INT16_C( 29524),  INT16_C( 28799), -INT16_C( 23041),  INT16_C( 15808),  INT16_C( 21025), -INT16_C( 14063), -INT16_C(  8618), -INT16_C( 31309) },
+      {  INT16_C(     3),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25314),  INT16_C(  3373), -INT16_C( 10379), -INT16_C(   506), -INT16_C(  3794) } },
+    { {  INT16_C(  2066),  INT16_C( 19942),  INT16_C(  7113),  INT16_C( 12204),  INT16_C( 21733),  INT16_C(  3406),  INT16_C( 27028), -INT16_C( 28703) },
+      {  INT16_C( 31836),  INT16_C( 17443),  INT16_C( 20768), -INT16_C(  6658),  INT16_C( 30696), -INT16_C( 29428),  INT16_C(  2629), -INT16_C(   348) },
+      {  INT16_C(     0),  INT16_C(  2492),  INT16_C(  7113),  INT16_C(     0),  INT16_C(    84),  INT16_C(     0),  INT16_C(   844), -INT16_C(  1794) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_sra_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_sra_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sra_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(    59488587), -INT32_C(  1411531108),  INT32_C(   493993201),  INT32_C(  1493913835) },
+      {  INT32_C(  1050745590),  INT32_C(  2075367760),  INT32_C(   266128951), -INT32_C(  1301554786) },
+      { -INT32_C(          15), -INT32_C(       21539),  INT32_C(          58),  INT32_C(           1) } },
+    { {  INT32_C(   840591789),  INT32_C(  1527351959), -INT32_C(  1816096830),  INT32_C(  1592935846) },
+      { -INT32_C(   531794372), -INT32_C(  1646621905), -INT32_C(  1882583271),  INT32_C(   341224401) },
+      {  INT32_C(           3),  INT32_C(       46611), -INT32_C(          55),  INT32_C(       12153) } },
+    { { -INT32_C(  1135331909), -INT32_C(   268989189),  INT32_C(  1005852481), -INT32_C(  2059023665) },
+      { -INT32_C(  1326011998), -INT32_C(   375146035),  INT32_C(   469351594), -INT32_C(    20829102) },
+      { -INT32_C(   283832978), -INT32_C(       32836),  INT32_C(      982277), -INT32_C(        7855) } },
+    { {  INT32_C(   699854474),  INT32_C(  1964037499), -INT32_C(  2049224157), -INT32_C(  1502004723) },
+      { -INT32_C(  1116106341), -INT32_C(   357929923), -INT32_C(   395607666), -INT32_C(  1702194244) },
+      {  INT32_C(           5),  INT32_C(           3), -INT32_C(      125075), -INT32_C(           6) } },
+    { {  INT32_C(  1336464359),  INT32_C(  1978361418),  INT32_C(  1393535301),  INT32_C(  1163399590) },
+      { -INT32_C(   718586319),  INT32_C(  1073310524), -INT32_C(   743563579), -INT32_C(  1170809370) },
+      {  INT32_C(       10196),  INT32_C(           7),  INT32_C(    43547978),  INT32_C(    18178118) } },
+    { {  INT32_C(    34863617),  INT32_C(  1578936551),  INT32_C(  1719174370),  INT32_C(  2073828931) },
+      {  INT32_C(  2014512749), -INT32_C(  2146988691), -INT32_C(  1172268648),  INT32_C(   590224155) },
+      {  INT32_C(        4255),  INT32_C(      192741),  INT32_C(         102),  INT32_C(          15) } },
+    { { -INT32_C(  1076040655),  INT32_C(  1991195491),  INT32_C(   390739706),  INT32_C(  1918907941) },
+      { -INT32_C(  1425765952), -INT32_C(     9349723),  INT32_C(   280410843), -INT32_C(  1769873466) },
+      { -INT32_C(  1076040655),  INT32_C(    62224859),  INT32_C(           2),  INT32_C(    29982936) } },
+    { {  INT32_C(  1552359223),  INT32_C(   988442468), -INT32_C(  1923818091),  INT32_C(  1155174904) },
+      {  INT32_C(  1717739118), -INT32_C(  1867244083),  INT32_C(   278029919),  INT32_C(   719542446) },
+      {  INT32_C(       94748),  INT32_C(      120659), -INT32_C(           1),  INT32_C(       70506) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_sra_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_sra_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_sra_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 8310841667624945009),  INT64_C( 8256963205825136345) },
+      { -INT64_C( 1548051431823675326), -INT64_C( 2465479613138172546) },
+      { -INT64_C( 2077710416906236253),  INT64_C(                   1) } },
+    { { -INT64_C( 4882243793787903819),  INT64_C( 6053468505637820988) },
+      {  INT64_C( 7007087589697182218), -INT64_C( 2578239575252330277) },
+      { -INT64_C(    4767816204871000),  INT64_C(         45101854992) } },
+    { { -INT64_C( 2510248707563504426),  INT64_C( 3281436951468174203) },
+      {  INT64_C( 7287044265777057120), -INT64_C( 8882391716007234029) },
+      { -INT64_C(           584462823),  INT64_C(       6258844283043) } },
+    { { -INT64_C( 5926794209043639281), -INT64_C( 6710531802906472756) },
+      { -INT64_C(  683897295851269569), -INT64_C( 5295354872827053517) },
+      { -INT64_C(                   1), -INT64_C(                2981) } },
+    { { -INT64_C( 6845206796157661775), -INT64_C( 8280681257917963967) },
+      { -INT64_C( 4482880984119572842),  INT64_C( 4340092010391761959) },
+      { -INT64_C(       1632024477997), -INT64_C(            15062472) } },
+    { {  INT64_C(  803212363039910090), -INT64_C( 8891826852415499805) },
+      { -INT64_C( 6003883938143798232), -INT64_C( 7805074725863660042) },
+      {  INT64_C(              730517), -INT64_C(                 494) } },
+    { {  INT64_C( 4373483971444829843),  INT64_C( 7348199118714234305) },
+      {  INT64_C( 3198687443114471339), -INT64_C( 7068945144664923548) },
+      {  INT64_C(              497207),  INT64_C(           106930370) } },
+    { { -INT64_C( 2506097676752096768),  INT64_C(  697723054431378681) },
+      { -INT64_C( 7350414917434049329),  INT64_C( 6510444041406993032) },
+      { -INT64_C(      76480031639164),  INT64_C(    2725480681372572) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_sra_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_sra_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(sra_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(sra_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(sra_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(sra_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,269 @@
+#define SIMDE_TEST_MIPS_MSA_INSN srl
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/srl.h"
+
+static int
+test_simde_srl_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  28), -INT8_C(  94), -INT8_C(  55),  INT8_C(  70),  INT8_C(  53),  INT8_C(  46),  INT8_C(  63), -INT8_C(  59),
+        -INT8_C(  86),      INT8_MAX,  INT8_C(  39),  INT8_C( 106), -INT8_C( 125), -INT8_C(  72),  INT8_C(  48), -INT8_C( 119) },
+      {  INT8_C(  75), -INT8_C(  52),  INT8_C(  39),  INT8_C(  37), -INT8_C( 119), -INT8_C(  39), -INT8_C(  50), -INT8_C(  43),
+         INT8_C(  82),  INT8_C(  34),  INT8_C(  67),  INT8_C(  78), -INT8_C(  48), -INT8_C(  86),  INT8_C(  20),  INT8_C(  75) },
+      {  INT8_C(  28),  INT8_C(  10),  INT8_C(   1),  INT8_C(   2),  INT8_C(  26),  INT8_C(  23),  INT8_C(   0),  INT8_C(   6),
+         INT8_C(  42),  INT8_C(  31),  INT8_C(   4),  INT8_C(   1), -INT8_C( 125),  INT8_C(  46),  INT8_C(   3),  INT8_C(  17) } },
+    { { -INT8_C(  20),  INT8_C(  25),  INT8_C(  14), -INT8_C( 127), -INT8_C( 120), -INT8_C( 105), -INT8_C(  17), -INT8_C(  66),
+        -INT8_C(  48), -INT8_C(  70),  INT8_C(  30), -INT8_C(  10), -INT8_C( 118),  INT8_C(  80),  INT8_C(  99),  INT8_C(  20) },
+      {  INT8_C(  10),  INT8_C(  43), -INT8_C(  52), -INT8_C(  88), -INT8_C(  66), -INT8_C(  41),  INT8_C( 110),  INT8_C(  63),
+        -INT8_C( 116),  INT8_C( 113), -INT8_C(  32), -INT8_C(   7),  INT8_C(  11),  INT8_C( 125),  INT8_C(  95),  INT8_C(  68) },
+      {  INT8_C(  59),  INT8_C(   3),  INT8_C(   0), -INT8_C( 127),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(  13),  INT8_C(  93),  INT8_C(  30),  INT8_C( 123),  INT8_C(  17),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1) } },
+    { {  INT8_C(  38), -INT8_C(  63), -INT8_C(   7),  INT8_C(  23), -INT8_C(  73),  INT8_C(  55), -INT8_C(  37),  INT8_C(  97),
+        -INT8_C(  15), -INT8_C( 114),  INT8_C( 107), -INT8_C(  39), -INT8_C( 122),  INT8_C(   4), -INT8_C(  30),  INT8_C(  28) },
+      { -INT8_C(  98),  INT8_C(  43),  INT8_C( 112),  INT8_C(  79),  INT8_C( 110),  INT8_C(  26), -INT8_C(  28),  INT8_C(  73),
+         INT8_C(  93),  INT8_C(  31),  INT8_C(  15), -INT8_C(  58),  INT8_C( 126), -INT8_C(  89),  INT8_C(  74), -INT8_C(  35) },
+      {  INT8_C(   0),  INT8_C(  24), -INT8_C(   7),  INT8_C(   0),  INT8_C(   2),  INT8_C(  13),  INT8_C(  13),  INT8_C(  48),
+         INT8_C(   7),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(  56),  INT8_C(   0) } },
+    { { -INT8_C( 126),  INT8_C(  68),  INT8_C(  12),  INT8_C(  32), -INT8_C( 124), -INT8_C(   5), -INT8_C(  14),  INT8_C(  34),
+        -INT8_C(   4),  INT8_C( 102), -INT8_C(  96), -INT8_C( 101), -INT8_C(  80), -INT8_C( 105), -INT8_C(  76), -INT8_C(  31) },
+      { -INT8_C( 101), -INT8_C(  58),  INT8_C(  51), -INT8_C(  26), -INT8_C(  87), -INT8_C(  74),  INT8_C(  10), -INT8_C(  74),
+        -INT8_C(  12), -INT8_C(  28),  INT8_C(  29), -INT8_C(  59), -INT8_C(  94),  INT8_C(  78),  INT8_C(  84),  INT8_C(  49) },
+      {  INT8_C(  16),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),  INT8_C(  66),  INT8_C(   3),  INT8_C(  60),  INT8_C(   0),
+         INT8_C(  15),  INT8_C(   6),  INT8_C(   5),  INT8_C(   4),  INT8_C(  44),  INT8_C(   2),  INT8_C(  11),  INT8_C( 112) } },
+    { { -INT8_C(  29), -INT8_C(  90), -INT8_C( 100), -INT8_C(  74), -INT8_C(  67),  INT8_C(  87),  INT8_C(  41), -INT8_C(  17),
+        -INT8_C(  67), -INT8_C(  19),  INT8_C(  22), -INT8_C(  50),  INT8_C( 113), -INT8_C(   7), -INT8_C(  62),  INT8_C( 100) },
+      {  INT8_C(  13),  INT8_C(  25), -INT8_C(  39), -INT8_C(  11), -INT8_C(  77), -INT8_C(  71),  INT8_C( 104), -INT8_C(  94),
+        -INT8_C( 109),  INT8_C(  40), -INT8_C( 127), -INT8_C(  96),  INT8_C(   2), -INT8_C(  29), -INT8_C( 119),  INT8_C(  12) },
+      {  INT8_C(   7),  INT8_C(  83),  INT8_C(  78),  INT8_C(   5),  INT8_C(  23),  INT8_C(  43),  INT8_C(  41),  INT8_C(  59),
+         INT8_C(  23), -INT8_C(  19),  INT8_C(  11), -INT8_C(  50),  INT8_C(  28),  INT8_C(  31),  INT8_C(  97),  INT8_C(   6) } },
+    { {  INT8_C(   1), -INT8_C(  73),  INT8_C(  38),  INT8_C(  15), -INT8_C(  71),  INT8_C(  55),  INT8_C(  22), -INT8_C(  85),
+        -INT8_C(  22), -INT8_C(  62),  INT8_C(  55),  INT8_C(  34), -INT8_C(  23),  INT8_C(  19),  INT8_C(  14), -INT8_C(  36) },
+      { -INT8_C(  24), -INT8_C(  10), -INT8_C(  44), -INT8_C(  79),  INT8_C(   1), -INT8_C( 114),  INT8_C(  62), -INT8_C(  33),
+         INT8_C(  75),  INT8_C(  86),  INT8_C( 126),  INT8_C(  72),  INT8_C(  19), -INT8_C(  59), -INT8_C(  87), -INT8_C(   1) },
+      {  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   7),  INT8_C(  92),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(  29),  INT8_C(   3),  INT8_C(   0),  INT8_C(  34),  INT8_C(  29),  INT8_C(   0),  INT8_C(   7),  INT8_C(   1) } },
+    { { -INT8_C(  32),  INT8_C( 107),  INT8_C(  80),  INT8_C(  87),  INT8_C(  76),  INT8_C(  30),  INT8_C(  31), -INT8_C(  52),
+        -INT8_C(  29),  INT8_C( 108), -INT8_C(  74),  INT8_C(  35),  INT8_C(  67), -INT8_C(   1), -INT8_C(   8), -INT8_C(   4) },
+      {  INT8_C( 111), -INT8_C(  40), -INT8_C(  96), -INT8_C( 117), -INT8_C( 120), -INT8_C( 125), -INT8_C(  28),  INT8_C(  52),
+        -INT8_C( 126),  INT8_C(  58),  INT8_C(  58),  INT8_C(  10),  INT8_C(   0),  INT8_C( 111), -INT8_C( 112), -INT8_C( 100) },
+      {  INT8_C(   1),  INT8_C( 107),  INT8_C(  80),  INT8_C(  10),  INT8_C(  76),  INT8_C(   3),  INT8_C(   1),  INT8_C(  12),
+         INT8_C(  56),  INT8_C(  27),  INT8_C(  45),  INT8_C(   8),  INT8_C(  67),  INT8_C(   1), -INT8_C(   8),  INT8_C(  15) } },
+    { {  INT8_C(  20), -INT8_C( 115),  INT8_C(  95), -INT8_C(  41),  INT8_C(  70), -INT8_C(  38), -INT8_C(  66), -INT8_C(  53),
+         INT8_C(  28),  INT8_C(  13), -INT8_C(  82),  INT8_C(  93),  INT8_C(  18), -INT8_C(  60),  INT8_C(  65),  INT8_C( 104) },
+      {  INT8_C(  24), -INT8_C(   9),  INT8_C(  69), -INT8_C(  62),  INT8_C(  28),  INT8_C( 105),  INT8_C(  96),  INT8_C(  36),
+         INT8_C(  87), -INT8_C(  48),  INT8_C(  73),  INT8_C(  81),  INT8_C(  49), -INT8_C( 110), -INT8_C(  79),  INT8_C( 112) },
+      {  INT8_C(  20),  INT8_C(   1),  INT8_C(   2),  INT8_C(  53),  INT8_C(   4),  INT8_C( 109), -INT8_C(  66),  INT8_C(  12),
+         INT8_C(   0),  INT8_C(  13),  INT8_C(  87),  INT8_C(  46),  INT8_C(   9),  INT8_C(  49),  INT8_C(  32),  INT8_C( 104) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_srl_b(a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_srl_b(a, b);
+
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_srl_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(  9905), -INT16_C( 31190), -INT16_C(  8139), -INT16_C( 18334),  INT16_C(  3023),  INT16_C( 20060), -INT16_C( 28462),  INT16_C( 19541) },
+      { -INT16_C( 20329),  INT16_C( 24297),  INT16_C( 30587), -INT16_C(  1237), -INT16_C( 24222),  INT16_C( 29445), -INT16_C( 13085),  INT16_C(  3554) },
+      {  INT16_C(   434),  INT16_C(    67),  INT16_C(    28),  INT16_C(    23),  INT16_C(   755),  INT16_C(   626),  INT16_C(  4634),  INT16_C(  4885) } },
+    { {  INT16_C( 16237),  INT16_C(  8587),  INT16_C(  6746), -INT16_C( 18724), -INT16_C( 22911),  INT16_C( 22242), -INT16_C(  3647),  INT16_C( 21769) },
+      {  INT16_C(  6365), -INT16_C( 23748), -INT16_C( 14991),  INT16_C(  8043), -INT16_C( 18449), -INT16_C(   563), -INT16_C( 31389),  INT16_C( 11448) },
+      {  INT16_C(     1),  INT16_C(     2),  INT16_C(  3373),  INT16_C(    22),  INT16_C(     1),  INT16_C(     2),  INT16_C(  7736),  INT16_C(    85) } },
+    { {  INT16_C(  6908),  INT16_C( 12536), -INT16_C( 31248), -INT16_C( 10895), -INT16_C( 12477), -INT16_C( 22503),  INT16_C( 18459),  INT16_C( 26272) },
+      { -INT16_C( 23716), -INT16_C( 32005), -INT16_C(  4890), -INT16_C(  7019),  INT16_C(  9039),  INT16_C( 10763), -INT16_C( 21730),  INT16_C( 10896) },
+      {  INT16_C(     1),  INT16_C(     6),  INT16_C(   535),  INT16_C(  1707),  INT16_C(     1),  INT16_C(    21),  INT16_C(     1),  INT16_C( 26272) } },
+    { { -INT16_C( 24466), -INT16_C( 10857),  INT16_C( 29776),  INT16_C(  8459),  INT16_C(  8324),  INT16_C( 21514),  INT16_C( 30917), -INT16_C( 22623) },
+      { -INT16_C(  6831), -INT16_C(  2732),  INT16_C( 13411),  INT16_C( 27839), -INT16_C( 18625),  INT16_C( 12768), -INT16_C( 11588),  INT16_C( 27761) },
+      {  INT16_C( 20535),  INT16_C(  3417),  INT16_C(  3722),  INT16_C(     0),  INT16_C(     0),  INT16_C( 21514),  INT16_C(     7),  INT16_C( 21456) } },
+    { { -INT16_C(  7724),  INT16_C( 10326),  INT16_C(  8061), -INT16_C( 25201), -INT16_C(  2619),  INT16_C(  3458),  INT16_C( 31873),  INT16_C(   604) },
+      { -INT16_C(  6940),  INT16_C( 10969),  INT16_C( 16235), -INT16_C( 15389),  INT16_C( 30537), -INT16_C( 12219),  INT16_C( 30272),  INT16_C( 10361) },
+      {  INT16_C(  3613),  INT16_C(    20),  INT16_C(     3),  INT16_C(  5041),  INT16_C(   122),  INT16_C(   108),  INT16_C( 31873),  INT16_C(     1) } },
+    { {  INT16_C( 17078),  INT16_C(  1809),  INT16_C(   807),  INT16_C( 15820),  INT16_C( 10153), -INT16_C( 29499), -INT16_C( 12968), -INT16_C( 23489) },
+      {  INT16_C( 14185), -INT16_C( 19613), -INT16_C( 22417), -INT16_C(  9857), -INT16_C( 19499), -INT16_C(   695), -INT16_C(  7679),  INT16_C(   664) },
+      {  INT16_C(    33),  INT16_C(   226),  INT16_C(     0),  INT16_C(     0),  INT16_C(   317),  INT16_C(    70),  INT16_C( 26284),  INT16_C(   164) } },
+    { { -INT16_C( 23924),  INT16_C( 28750), -INT16_C(  6471),  INT16_C( 14952), -INT16_C( 27627),  INT16_C( 29125), -INT16_C(  3260),  INT16_C( 11835) },
+      {  INT16_C( 23530), -INT16_C(   142),  INT16_C( 21831),  INT16_C( 27535),  INT16_C( 25096),  INT16_C( 29516),  INT16_C(  1491), -INT16_C(  7277) },
+      {  INT16_C(    40),  INT16_C(  7187),  INT16_C(   461),  INT16_C(     0),  INT16_C(   148),  INT16_C(     7),  INT16_C(  7784),  INT16_C(  1479) } },
+    { { -INT16_C(  3242), -INT16_C(  7532), -INT16_C(  5904), -INT16_C(  2121), -INT16_C( 31490),  INT16_C( 31019), -INT16_C(  9781),  INT16_C(  7984) },
+      { -INT16_C( 14485),  INT16_C(  2885), -INT16_C( 20293), -INT16_C( 18638),  INT16_C(  3726), -INT16_C( 23840), -INT16_C( 18906),  INT16_C(  3552) },
+      {  INT16_C(    30),  INT16_C(  1812),  INT16_C(    29),  INT16_C( 15853),  INT16_C(     2),  INT16_C( 31019),  INT16_C(   871),  INT16_C(  7984) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_srl_h(a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_srl_h(a, b);
+
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_srl_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   886994230),  INT32_C(  1188049095),  INT32_C(   578386377), -INT32_C(  1660396003) },
+      {  INT32_C(  1779704809), -INT32_C(    42134623),  INT32_C(  1579268873), -INT32_C(   624411783) },
+      {  INT32_C(     1732410),  INT32_C(   594024547),  INT32_C(     1129660),  INT32_C(          78) } },
+    { {  INT32_C(  1002997419),  INT32_C(   441404860), -INT32_C(  2032238643),  INT32_C(  1011993696) },
+      {  INT32_C(  1023070853), -INT32_C(  1338138835), -INT32_C(   685385434),  INT32_C(   233461739) },
+      {  INT32_C(    31343669),  INT32_C(       53882),  INT32_C(    35355135),  INT32_C(      494137) } },
+    { { -INT32_C(   332282159), -INT32_C(  1086195493),  INT32_C(  1112460492), -INT32_C(  1841601142) },
+      {  INT32_C(    93628360), -INT32_C(  1128443408),  INT32_C(   529177477),  INT32_C(  1750250706) },
+      {  INT32_C(    15479238),  INT32_C(       48961),  INT32_C(    34764390),  INT32_C(        9358) } },
+    { {  INT32_C(  1982474338),  INT32_C(   592169549), -INT32_C(   808617728),  INT32_C(  1780593274) },
+      {  INT32_C(   298109684), -INT32_C(   754389106),  INT32_C(  2043397018), -INT32_C(   523418377) },
+      {  INT32_C(        1890),  INT32_C(       36143),  INT32_C(          51),  INT32_C(         212) } },
+    { {  INT32_C(   525177133), -INT32_C(  1864827027), -INT32_C(  2063288451),  INT32_C(  1701829195) },
+      {  INT32_C(  1722901348),  INT32_C(   814973183),  INT32_C(  1706200961),  INT32_C(   756607339) },
+      {  INT32_C(    32823570),  INT32_C(           1),  INT32_C(  1115839422),  INT32_C(      830971) } },
+    { { -INT32_C(  1597361501), -INT32_C(  1235530186),  INT32_C(  1927982048), -INT32_C(  2046491602) },
+      {  INT32_C(  1369144510),  INT32_C(  1801027750), -INT32_C(  1139353279), -INT32_C(  1917868934) },
+      {  INT32_C(           2),  INT32_C(    47803704),  INT32_C(   963991024),  INT32_C(          33) } },
+    { { -INT32_C(   984166238), -INT32_C(  2023045297),  INT32_C(   146499649), -INT32_C(  1103664491) },
+      { -INT32_C(   967823432), -INT32_C(  1308376933),  INT32_C(   797849453),  INT32_C(   282680315) },
+      {  INT32_C(         197),  INT32_C(          16),  INT32_C(       17883),  INT32_C(          23) } },
+    { { -INT32_C(  2141966892), -INT32_C(   136265335),  INT32_C(   829614546),  INT32_C(   672769592) },
+      {  INT32_C(   751324220),  INT32_C(  1476383528),  INT32_C(  1324038749), -INT32_C(  1377965641) },
+      {  INT32_C(           8),  INT32_C(    16244929),  INT32_C(           1),  INT32_C(          80) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_srl_w(a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_srl_w(a, b);
+
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_srl_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 8802466449101021009),  INT64_C( 3504482826187649545) },
+      {  INT64_C( 5844056494375386957), -INT64_C( 4741327252673900072) },
+      {  INT64_C(    1074519830212526),  INT64_C(        208883453976) } },
+    { {  INT64_C(  918247408114501295),  INT64_C( 4114480825170151557) },
+      {  INT64_C( 8235228619437855010),  INT64_C( 1298751854103662271) },
+      {  INT64_C(            53449033),  INT64_C(                   0) } },
+    { { -INT64_C( 8825433183724585724),  INT64_C(  346171443894351960) },
+      { -INT64_C( 8305926222535513513), -INT64_C( 5733475965414277292) },
+      {  INT64_C(       1146949635742),  INT64_C(        330134815115) } },
+    { {  INT64_C( 7781180483248357373),  INT64_C( 2018313606966632994) },
+      {  INT64_C( 7568132393317730167),  INT64_C(  381710201586372840) },
+      {  INT64_C(                 215),  INT64_C(             1835645) } },
+    { {  INT64_C( 6473034328539961305),  INT64_C( 1351610267016059368) },
+      {  INT64_C( 3635430620090204959), -INT64_C( 1338084338302768435) },
+      {  INT64_C(          3014241498),  INT64_C(     164991487672858) } },
+    { { -INT64_C( 6399388679310459729),  INT64_C( 4321267126034940831) },
+      {  INT64_C( 5772317745809326957), -INT64_C( 8174946733152776628) },
+      {  INT64_C(              342406),  INT64_C(    1054996856942124) } },
+    { { -INT64_C( 8587043774143473230), -INT64_C( 6850783787776188874) },
+      { -INT64_C( 4810806027766719967),  INT64_C( 2825676723573714509) },
+      {  INT64_C(          1147820183),  INT64_C(    1415522495841474) } },
+    { { -INT64_C( 6706747174711737887), -INT64_C( 4792992799739620213) },
+      { -INT64_C( 7229589082948422881),  INT64_C( 2549372231273754136) },
+      {  INT64_C(          5466862068),  INT64_C(        813826994536) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_srl_d(a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_srl_d(a, b);
+
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(srl_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(srl_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(srl_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(srl_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
@@ -0,0 +1,325 @@
+#define SIMDE_TEST_MIPS_MSA_INSN vshf
+
+#include "test-msa.h"
+#include "../../../simde/mips/msa/vshf.h"
+
+static int
+test_simde_vshf_b (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int8_t c[16];
+    int8_t a[16];
+    int8_t b[16];
+    int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  31),  INT8_C(  11),  INT8_C(  26), -INT8_C( 120),  INT8_C(   1),  INT8_C(  28),  INT8_C(  36),  INT8_C(  27),
+         INT8_C(  84),  INT8_C(  17),  INT8_C(  47),  INT8_C(  60),  INT8_C(  16),  INT8_C(  24),  INT8_C(  72),  INT8_C(  24) },
+      { -INT8_C(  12), -INT8_C(  33),  INT8_C( 114),  INT8_C(  11),  INT8_C(  44),  INT8_C( 113), -INT8_C(  13),  INT8_C(  56),
+        -INT8_C(  67),  INT8_C(  34), -INT8_C( 118),  INT8_C(  96), -INT8_C(  74), -INT8_C(  74), -INT8_C(  25), -INT8_C(  24) },
+      {  INT8_C(  72),  INT8_C(  71), -INT8_C(  34), -INT8_C(  20),  INT8_C(  28),  INT8_C(  41),  INT8_C(   4),  INT8_C(  93),
+        -INT8_C( 112), -INT8_C(  32),  INT8_C(  28),  INT8_C(  46), -INT8_C(  24), -INT8_C(  51), -INT8_C(  75),  INT8_C(   3) },
+      { -INT8_C(  24),  INT8_C(  46), -INT8_C( 118),  INT8_C(   0),  INT8_C(  71), -INT8_C(  74),  INT8_C(  28),  INT8_C(  96),
+         INT8_C(   0), -INT8_C(  33),  INT8_C(   3), -INT8_C(  74), -INT8_C(  12), -INT8_C(  67),  INT8_C(   0), -INT8_C(  67) } },
+    { {  INT8_C(  11),  INT8_C(   4),  INT8_C(  19),  INT8_C(  29),  INT8_C(  60),  INT8_C(  66),  INT8_C(  18),  INT8_C(  17),
+         INT8_C(  89),  INT8_C(  86),  INT8_C(  23),  INT8_C(  18),  INT8_C(  21),  INT8_C(   5),  INT8_C(  49),  INT8_C(  27) },
+      {  INT8_C(  39),  INT8_C( 125),  INT8_C(  40),  INT8_C( 113), -INT8_C(  72),  INT8_C(  87), -INT8_C(  44), -INT8_C(  43),
+        -INT8_C(  86),  INT8_C(  91), -INT8_C(  99),  INT8_C(  14), -INT8_C(  10), -INT8_C(  31),  INT8_C(  93), -INT8_C( 104) },
+      { -INT8_C(  43),  INT8_C(  60),  INT8_C( 106),  INT8_C(  38),  INT8_C(  89), -INT8_C( 126), -INT8_C(  20),  INT8_C(  43),
+         INT8_C(  41),  INT8_C(  68), -INT8_C(  86), -INT8_C(  88), -INT8_C(  99),  INT8_C( 113),      INT8_MAX, -INT8_C(   3) },
+      { -INT8_C(  88),  INT8_C(  89),  INT8_C( 113), -INT8_C(  31), -INT8_C(  10),  INT8_C(   0),  INT8_C(  40),  INT8_C( 125),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  43),  INT8_C(  40),  INT8_C(  87), -INT8_C( 126),  INT8_C( 125),  INT8_C(  14) } },
+    { {  INT8_C(   0),  INT8_C(  19),  INT8_C(   9),  INT8_C(  67),  INT8_C(  67),  INT8_C(  57),  INT8_C(  30),  INT8_C(  24),
+         INT8_C(  31),  INT8_C(   2),  INT8_C(  46),  INT8_C(  25),  INT8_C(  14),  INT8_C(  71),  INT8_C(   5),  INT8_C(  85) },
+      {  INT8_C(   8),  INT8_C(  23),  INT8_C( 105), -INT8_C(  25),  INT8_C(  84),  INT8_C(  74), -INT8_C(  24),  INT8_C(  66),
+         INT8_C(  57),  INT8_C( 116),  INT8_C(  17),  INT8_C(  36),  INT8_C(  35),  INT8_C(  33), -INT8_C(  24),  INT8_C(  45) },
+      { -INT8_C(  46),  INT8_C(  24), -INT8_C(   6), -INT8_C(  49), -INT8_C( 122), -INT8_C(  68),  INT8_C(  66),  INT8_C( 107),
+        -INT8_C( 125),  INT8_C(  74),  INT8_C( 104), -INT8_C(  85),  INT8_C(  16),  INT8_C(  74), -INT8_C(  39),  INT8_C(  76) },
+      { -INT8_C(  46), -INT8_C(  25),  INT8_C(  74),  INT8_C(   0),  INT8_C(   0),  INT8_C( 116), -INT8_C(  24),  INT8_C(  57),
+         INT8_C(  45), -INT8_C(   6), -INT8_C(  39),  INT8_C( 116), -INT8_C(  39),  INT8_C(   0), -INT8_C(  68),  INT8_C(   0) } },
+    { {  INT8_C(  29),  INT8_C(  63),  INT8_C(   1),  INT8_C(  58),  INT8_C(  77), -INT8_C( 121), -INT8_C( 124),  INT8_C(  29),
+        -INT8_C( 111),  INT8_C(   8),  INT8_C(  23),  INT8_C(  30), -INT8_C( 111),  INT8_C(  30),  INT8_C(  91),  INT8_C(  31) },
+      { -INT8_C(  91),  INT8_C( 101), -INT8_C(  73), -INT8_C(  81),  INT8_C( 120), -INT8_C(  35), -INT8_C(   9),  INT8_C(  41),
+        -INT8_C( 110),  INT8_C(  13),  INT8_C(  78), -INT8_C( 118), -INT8_C(  50), -INT8_C(  29),  INT8_C(  18),  INT8_C(  15) },
+      { -INT8_C( 103),  INT8_C(  94), -INT8_C(  21),  INT8_C(  92),  INT8_C( 100), -INT8_C(  19), -INT8_C(  55),  INT8_C(  44),
+         INT8_C(  78),  INT8_C(  50),  INT8_C( 119), -INT8_C(  11), -INT8_C(  69),  INT8_C(  73), -INT8_C( 114),  INT8_C( 119) },
+      { -INT8_C(  29),  INT8_C(  15),  INT8_C(  94),  INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  29),
+         INT8_C(   0),  INT8_C(  78),  INT8_C(  41),  INT8_C(  18),  INT8_C(   0),  INT8_C(  18),  INT8_C(   0),  INT8_C(  15) } },
+    { {  INT8_C(   2),  INT8_C(   4),  INT8_C(  92),  INT8_C(  26),  INT8_C(  83),  INT8_C(   1),  INT8_C(  16),  INT8_C(   9),
+         INT8_C(  26),  INT8_C(   5),  INT8_C(  29),  INT8_C(  29),  INT8_C(   0),  INT8_C(  19),  INT8_C(   9),  INT8_C(  50) },
+      { -INT8_C( 105), -INT8_C(  73), -INT8_C(  64),  INT8_C(  67),  INT8_C(   7), -INT8_C(  22), -INT8_C(  59), -INT8_C(  24),
+        -INT8_C(  30), -INT8_C( 101),  INT8_C(  78),  INT8_C( 116), -INT8_C(  87),  INT8_C( 107), -INT8_C(  15),  INT8_C(  67) },
+      {  INT8_C(  87),  INT8_C(  51), -INT8_C(  24),  INT8_C(   1), -INT8_C( 102),  INT8_C( 118),  INT8_C( 119), -INT8_C(  82),
+        -INT8_C( 114),  INT8_C(  85), -INT8_C( 113), -INT8_C(  89), -INT8_C(  25), -INT8_C(  24),  INT8_C(  86),  INT8_C(  25) },
+      { -INT8_C(  24), -INT8_C( 102),  INT8_C(   0),  INT8_C(  78),  INT8_C(   0),  INT8_C(  51), -INT8_C( 105),  INT8_C(  85),
+         INT8_C(  78),  INT8_C( 118),  INT8_C( 107),  INT8_C( 107),  INT8_C(  87),  INT8_C(  67),  INT8_C(  85), -INT8_C(  64) } },
+    { {  INT8_C(  18),  INT8_C(  26),  INT8_C(  95),  INT8_C(  21),  INT8_C(  27),  INT8_C(   7),  INT8_C(  23),  INT8_C(  55),
+         INT8_C(   5), -INT8_C( 103),  INT8_C(  84),  INT8_C(  21),  INT8_C(  36),  INT8_C(  26),  INT8_C(  24),  INT8_C(   4) },
+      { -INT8_C( 125),  INT8_C(  99), -INT8_C(  32),  INT8_C(  22), -INT8_C(  50),  INT8_C(  62), -INT8_C(  45), -INT8_C(  44),
+         INT8_C(  29),  INT8_C(  44),  INT8_C(  55), -INT8_C(  46), -INT8_C( 104), -INT8_C(  14),  INT8_C(  97), -INT8_C(  22) },
+      { -INT8_C(  70), -INT8_C(  63), -INT8_C(  83), -INT8_C(  74), -INT8_C( 106),  INT8_C(  12),  INT8_C(  10),  INT8_C(  75),
+        -INT8_C( 100), -INT8_C(  26),  INT8_C(  89),  INT8_C(   2),  INT8_C(  39), -INT8_C(   7), -INT8_C(  68), -INT8_C(  10) },
+      { -INT8_C(  32),  INT8_C(  55),  INT8_C(   0),  INT8_C(  62), -INT8_C(  46),  INT8_C(  75), -INT8_C(  44), -INT8_C(  44),
+         INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(  62), -INT8_C( 106),  INT8_C(  55),  INT8_C(  29), -INT8_C( 106) } },
+    { {  INT8_C(  37),  INT8_C(   8),  INT8_C(   7),  INT8_C(  92), -INT8_C( 113),  INT8_C(  20),  INT8_C(   9), -INT8_C( 103),
+         INT8_C(  94),  INT8_C(  12),  INT8_C(  15),  INT8_C(  28),  INT8_C(   9),  INT8_C(   6),  INT8_C(   2),  INT8_C(  21) },
+      {  INT8_C(   1),  INT8_C(   2),  INT8_C(  70),  INT8_C( 123),  INT8_C(  31),  INT8_C( 115), -INT8_C( 115),  INT8_C( 118),
+         INT8_C(  90), -INT8_C(  35),  INT8_C(  38), -INT8_C(  24),  INT8_C(  79),  INT8_C(  43), -INT8_C(  68),  INT8_C(  51) },
+      { -INT8_C(  51), -INT8_C(  74),  INT8_C(  14), -INT8_C(  32),  INT8_C( 110),  INT8_C( 102), -INT8_C(  32),  INT8_C( 101),
+         INT8_C(  96),  INT8_C(  16), -INT8_C(   5),  INT8_C(  74),  INT8_C( 109),  INT8_C(  71), -INT8_C(  57),  INT8_C(  95) },
+      {  INT8_C( 102),  INT8_C(  96),  INT8_C( 101),  INT8_C(   0),  INT8_C(   0),  INT8_C(  31),  INT8_C(  16),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 109),  INT8_C(  95),  INT8_C(  79),  INT8_C(  16), -INT8_C(  32),  INT8_C(  14),  INT8_C( 115) } },
+    { {  INT8_C(  19),  INT8_C(  60),  INT8_C(  29), -INT8_C(  99),  INT8_C(  24),  INT8_C(  33),  INT8_C(  55),  INT8_C(  19),
+         INT8_C(  26),  INT8_C(   2),  INT8_C(  17),  INT8_C(  47),  INT8_C(  24),  INT8_C(  13),  INT8_C(  19),  INT8_C(   4) },
+      { -INT8_C(  47), -INT8_C(  39),  INT8_C(  91), -INT8_C(   3), -INT8_C( 106), -INT8_C(  66),  INT8_C(  99), -INT8_C(  25),
+         INT8_C(  86), -INT8_C( 127), -INT8_C(  72), -INT8_C(  35),  INT8_C(  33), -INT8_C(  68),  INT8_C(  84),  INT8_C(  77) },
+      {  INT8_C(  63), -INT8_C(  46), -INT8_C(  40), -INT8_C(  65), -INT8_C(  11),  INT8_C(  32), -INT8_C(  99),  INT8_C(  13),
+        -INT8_C(  74),  INT8_C(  85), -INT8_C(  32),  INT8_C( 103),  INT8_C(  88), -INT8_C(  21), -INT8_C(  51),  INT8_C( 104) },
+      { -INT8_C(   3),  INT8_C(  33), -INT8_C(  68),  INT8_C(   0),  INT8_C(  86), -INT8_C(  46), -INT8_C(  25), -INT8_C(   3),
+        -INT8_C(  72), -INT8_C(  40), -INT8_C(  39),  INT8_C( 104),  INT8_C(  86), -INT8_C(  21), -INT8_C(   3), -INT8_C(  11) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v16i8 c = simde_msa_ld_b(test_vec[i].c, 0);
+    simde_v16i8 a = simde_msa_ld_b(test_vec[i].a, 0);
+    simde_v16i8 b = simde_msa_ld_b(test_vec[i].b, 0);
+    simde_v16i8 r = simde_msa_vshf_b(c, a, b);
+
+    simde_test_msa_v16i8_assert_equal(r, simde_msa_ld_b(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v16i8 c = simde_test_msa_v16i8_random();
+    simde_v16i8 a = simde_test_msa_v16i8_random();
+    simde_v16i8 b = simde_test_msa_v16i8_random();
+    simde_v16i8 r = simde_msa_vshf_b(c, a, b);
+
+    simde_test_msa_v16i8_write(2, c, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v16i8_write(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v16i8_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshf_h (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int16_t c[8];
+    int16_t a[8];
+    int16_t b[8];
+    int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C(   138),  INT16_C(    13),  INT16_C(    16),  INT16_C(     7),  INT16_C(     4),  INT16_C(     8),  INT16_C(     6),  INT16_C(    11) },
+      { -INT16_C( 28198),  INT16_C( 23618), -INT16_C( 24379),  INT16_C(  5754), -INT16_C(  4773),  INT16_C(  9638), -INT16_C( 11809),  INT16_C(  8207) },
+      { -INT16_C(  5072), -INT16_C( 10156),  INT16_C( 20538), -INT16_C(  6062), -INT16_C(  9862),  INT16_C( 23918),  INT16_C( 31444),  INT16_C( 19817) },
+      {  INT16_C(     0),  INT16_C(  9638), -INT16_C(  5072),  INT16_C( 19817), -INT16_C(  9862), -INT16_C( 28198),  INT16_C( 31444),  INT16_C(  5754) } },
+    { {  INT16_C(    66),  INT16_C(    74),  INT16_C(    13),  INT16_C(    11),  INT16_C(     0),  INT16_C(     6),  INT16_C(     6),  INT16_C(     5) },
+      { -INT16_C( 20912), -INT16_C(  7302), -INT16_C( 22086),  INT16_C(  6040),  INT16_C( 18312), -INT16_C(  1461),  INT16_C( 20693),  INT16_C( 14352) },
+      { -INT16_C( 23661), -INT16_C( 29268), -INT16_C( 11324), -INT16_C( 21394),  INT16_C( 31656), -INT16_C(  3210), -INT16_C(  6973), -INT16_C(  9452) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C(  1461),  INT16_C(  6040), -INT16_C( 23661), -INT16_C(  6973), -INT16_C(  6973), -INT16_C(  3210) } },
+    { {  INT16_C(     2),  INT16_C(     7),  INT16_C(    69),  INT16_C(     8),  INT16_C(     3),  INT16_C(    15),  INT16_C(    13),  INT16_C(    40) },
+      { -INT16_C( 25629),  INT16_C( 28256),  INT16_C( 16843),  INT16_C( 26247), -INT16_C(   351),  INT16_C( 20924), -INT16_C( 30327),  INT16_C( 21317) },
+      { -INT16_C(  8444),  INT16_C(  7984), -INT16_C( 26789),  INT16_C(  3491), -INT16_C(  3498),  INT16_C(  4553), -INT16_C( 26577), -INT16_C(  7574) },
+      { -INT16_C( 26789), -INT16_C(  7574),  INT16_C(     0), -INT16_C( 25629),  INT16_C(  3491),  INT16_C( 21317),  INT16_C( 20924), -INT16_C( 25629) } },
+    { {  INT16_C(    77),  INT16_C(     6),  INT16_C(   132),  INT16_C(     2),  INT16_C(    37),  INT16_C(     6),  INT16_C(     3),  INT16_C(    13) },
+      { -INT16_C(  2937),  INT16_C(   833),  INT16_C( 10339), -INT16_C( 15043), -INT16_C( 26447),  INT16_C( 24782),  INT16_C(  2587), -INT16_C(   928) },
+      {  INT16_C( 23412), -INT16_C(  7447), -INT16_C( 26227), -INT16_C( 16291),  INT16_C(  6864),  INT16_C( 21858), -INT16_C( 32584), -INT16_C( 25002) },
+      {  INT16_C(     0), -INT16_C( 32584),  INT16_C(     0), -INT16_C( 26227),  INT16_C( 21858), -INT16_C( 32584), -INT16_C( 16291),  INT16_C( 24782) } },
+    { {  INT16_C(     6),  INT16_C(    10),  INT16_C(   138),  INT16_C(     1),  INT16_C(     4),  INT16_C(    38),  INT16_C(     2),  INT16_C(    15) },
+      {  INT16_C( 32689), -INT16_C( 12971), -INT16_C( 22795),  INT16_C(  1594), -INT16_C(  1398), -INT16_C( 18790), -INT16_C( 19476),  INT16_C( 29878) },
+      { -INT16_C(  1235), -INT16_C(  6019),  INT16_C(  1404), -INT16_C( 32576),  INT16_C( 11976), -INT16_C( 11043),  INT16_C( 22404), -INT16_C(  7327) },
+      {  INT16_C( 22404), -INT16_C( 22795),  INT16_C(     0), -INT16_C(  6019),  INT16_C( 11976),  INT16_C( 22404),  INT16_C(  1404),  INT16_C( 29878) } },
+    { {  INT16_C(     0),  INT16_C(     0),  INT16_C(   141),  INT16_C(   134),  INT16_C(    13),  INT16_C(     8),  INT16_C(    11),  INT16_C(     0) },
+      {  INT16_C( 13883),  INT16_C( 25596),  INT16_C( 19817), -INT16_C( 11515), -INT16_C( 21595), -INT16_C(  3969),  INT16_C( 16133), -INT16_C( 16042) },
+      {  INT16_C( 32425),  INT16_C( 17908), -INT16_C( 21432), -INT16_C( 24324),  INT16_C(  1537),  INT16_C( 25755),  INT16_C( 17265),  INT16_C(  1723) },
+      {  INT16_C( 32425),  INT16_C( 32425),  INT16_C(     0),  INT16_C(     0), -INT16_C(  3969),  INT16_C( 13883), -INT16_C( 11515),  INT16_C( 32425) } },
+    { {  INT16_C(     5),  INT16_C(   143),  INT16_C(    74),  INT16_C(     1),  INT16_C(     6),  INT16_C(   137),  INT16_C(     8),  INT16_C(     7) },
+      {  INT16_C( 24241), -INT16_C(  9820), -INT16_C( 10526),  INT16_C(  1641),  INT16_C(  3480),  INT16_C( 18520),  INT16_C( 25427), -INT16_C(  8276) },
+      { -INT16_C( 11941), -INT16_C( 24758),  INT16_C( 16566),  INT16_C( 19686), -INT16_C(  9299),  INT16_C( 26778),  INT16_C( 21166),  INT16_C( 19277) },
+      {  INT16_C( 26778),  INT16_C(     0),  INT16_C(     0), -INT16_C( 24758),  INT16_C( 21166),  INT16_C(     0),  INT16_C( 24241),  INT16_C( 19277) } },
+    { {  INT16_C(    67),  INT16_C(    13),  INT16_C(     8),  INT16_C(     8),  INT16_C(     6),  INT16_C(     2),  INT16_C(    43),  INT16_C(    13) },
+      {  INT16_C( 22492),  INT16_C( 16420), -INT16_C(  8303), -INT16_C(  3825), -INT16_C( 15511), -INT16_C(  8615),  INT16_C(  8089),  INT16_C( 27032) },
+      { -INT16_C(  1058),  INT16_C( 15721),  INT16_C( 30719), -INT16_C(   601),  INT16_C( 15132),  INT16_C( 23047),  INT16_C(   845), -INT16_C( 31733) },
+      {  INT16_C(     0), -INT16_C(  8615),  INT16_C( 22492),  INT16_C( 22492),  INT16_C(   845),  INT16_C( 30719), -INT16_C(  3825), -INT16_C(  8615) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v8i16 c = simde_msa_ld_h(test_vec[i].c, 0);
+    simde_v8i16 a = simde_msa_ld_h(test_vec[i].a, 0);
+    simde_v8i16 b = simde_msa_ld_h(test_vec[i].b, 0);
+    simde_v8i16 r = simde_msa_vshf_h(c, a, b);
+
+    simde_test_msa_v8i16_assert_equal(r, simde_msa_ld_h(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v8i16 c = simde_test_msa_v8i16_random();
+    simde_v8i16 a = simde_test_msa_v8i16_random();
+    simde_v8i16 b = simde_test_msa_v8i16_random();
+    simde_v8i16 r = simde_msa_vshf_h(c, a, b);
+
+    simde_test_msa_v8i16_write(2, c, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v8i16_write(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v8i16_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshf_w (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int32_t c[4];
+    int32_t a[4];
+    int32_t b[4];
+    int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(           9),  INT32_C(           6),  INT32_C(          23),  INT32_C(           1) },
+      {  INT32_C(   452899336),  INT32_C(   187737632),  INT32_C(  1588511316), -INT32_C(   534774219) },
+      {  INT32_C(   378458680),  INT32_C(  1848480506),  INT32_C(  1753817307), -INT32_C(      770087) },
+      {  INT32_C(  1848480506),  INT32_C(  1588511316), -INT32_C(   534774219),  INT32_C(  1848480506) } },
+    { {  INT32_C(           1),  INT32_C(           4),  INT32_C(           4),  INT32_C(           3) },
+      {  INT32_C(  1138341887),  INT32_C(    43432426),  INT32_C(   990911954), -INT32_C(  1876859531) },
+      {  INT32_C(   235382207),  INT32_C(  2066698591),  INT32_C(  1373966816),  INT32_C(  1093900104) },
+      {  INT32_C(  2066698591),  INT32_C(  1138341887),  INT32_C(  1138341887),  INT32_C(  1093900104) } },
+    { {  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(          70) },
+      { -INT32_C(   472025958), -INT32_C(  1574333222),  INT32_C(   105865734), -INT32_C(   721187621) },
+      { -INT32_C(  1030272742),  INT32_C(   200671952),  INT32_C(  1659516762), -INT32_C(  1395992378) },
+      { -INT32_C(  1030272742),  INT32_C(   200671952),  INT32_C(  1659516762),  INT32_C(           0) } },
+    { {  INT32_C(         130),  INT32_C(           2),  INT32_C(           1),  INT32_C(           4) },
+      {  INT32_C(  1956386961), -INT32_C(  1797729644),  INT32_C(  1216996759),  INT32_C(  1973454962) },
+      {  INT32_C(   614790176), -INT32_C(   617597084),  INT32_C(  1415905553),  INT32_C(  1369598167) },
+      {  INT32_C(           0),  INT32_C(  1415905553), -INT32_C(   617597084),  INT32_C(  1956386961) } },
+    { {  INT32_C(         135),  INT32_C(         130),  INT32_C(          69),  INT32_C(           6) },
+      { -INT32_C(  1999676396),  INT32_C(   544381276),  INT32_C(   875201381), -INT32_C(   319175134) },
+      { -INT32_C(  1635043556),  INT32_C(  1002948925), -INT32_C(   361297593),  INT32_C(  1529162933) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   875201381) } },
+    { {  INT32_C(         133),  INT32_C(           2),  INT32_C(           7),  INT32_C(           3) },
+      { -INT32_C(   877793111), -INT32_C(   644006716),  INT32_C(   636650932),  INT32_C(  2069924844) },
+      { -INT32_C(   158499690),  INT32_C(   857765227),  INT32_C(  2005023244), -INT32_C(  1245272002) },
+      {  INT32_C(           0),  INT32_C(  2005023244),  INT32_C(  2069924844), -INT32_C(  1245272002) } },
+    { {  INT32_C(          12),  INT32_C(           6),  INT32_C(           1),  INT32_C(           2) },
+      {  INT32_C(  1312601206), -INT32_C(   681935754), -INT32_C(  1602869459),  INT32_C(   811499200) },
+      { -INT32_C(   166559316), -INT32_C(  1147391302), -INT32_C(   873689966), -INT32_C(  1147987925) },
+      {  INT32_C(  1312601206), -INT32_C(  1602869459), -INT32_C(  1147391302), -INT32_C(   873689966) } },
+    { {  INT32_C(           6),  INT32_C(         133),  INT32_C(           1),  INT32_C(           6) },
+      {  INT32_C(   703854359),  INT32_C(  1058552281),  INT32_C(   252657490),  INT32_C(  1361508046) },
+      {  INT32_C(  1361307464), -INT32_C(  2077757261),  INT32_C(    34038487),  INT32_C(  1313317855) },
+      {  INT32_C(   252657490),  INT32_C(           0), -INT32_C(  2077757261),  INT32_C(   252657490) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v4i32 c = simde_msa_ld_w(test_vec[i].c, 0);
+    simde_v4i32 a = simde_msa_ld_w(test_vec[i].a, 0);
+    simde_v4i32 b = simde_msa_ld_w(test_vec[i].b, 0);
+    simde_v4i32 r = simde_msa_vshf_w(c, a, b);
+
+    simde_test_msa_v4i32_assert_equal(r, simde_msa_ld_w(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v4i32 c = simde_test_msa_v4i32_random();
+    simde_v4i32 a = simde_test_msa_v4i32_random();
+    simde_v4i32 b = simde_test_msa_v4i32_random();
+    simde_v4i32 r = simde_msa_vshf_w(c, a, b);
+
+    simde_test_msa_v4i32_write(2, c, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v4i32_write(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v4i32_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+static int
+test_simde_vshf_d (SIMDE_MUNIT_TEST_ARGS) {
+#if 1
+  static const struct {
+    int64_t c[2];
+    int64_t a[2];
+    int64_t b[2];
+    int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   2),  INT64_C(                  18) },
+      {  INT64_C( 2832945911164503913),  INT64_C( 3554845339979353194) },
+      {  INT64_C( 6622114943942967139), -INT64_C( 7370424285334071053) },
+      {  INT64_C( 2832945911164503913),  INT64_C( 2832945911164503913) } },
+    { {  INT64_C(                   2),  INT64_C(                  67) },
+      {  INT64_C( 1583231208562518836),  INT64_C( 2839482345457256284) },
+      {  INT64_C( 2480738808188931878),  INT64_C( 4792555172395325222) },
+      {  INT64_C( 1583231208562518836),  INT64_C(                   0) } },
+    { {  INT64_C(                   0),  INT64_C(                   2) },
+      {  INT64_C( 7876741160574569255), -INT64_C( 7104305595118135620) },
+      { -INT64_C( 3573115305400671245),  INT64_C( 5772719461787700492) },
+      { -INT64_C( 3573115305400671245),  INT64_C( 7876741160574569255) } },
+    { {  INT64_C(                   1),  INT64_C(                   0) },
+      {  INT64_C( 2262954853218320275),  INT64_C( 1349539895192549589) },
+      {  INT64_C( 3809724824036758867), -INT64_C( 3031950268653636803) },
+      { -INT64_C( 3031950268653636803),  INT64_C( 3809724824036758867) } },
+    { {  INT64_C(                 129),  INT64_C(                 130) },
+      { -INT64_C( 9107765107088262857),  INT64_C( 8772444331928330859) },
+      {  INT64_C(  141440348916223534), -INT64_C(  925021045996053739) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C(                  17),  INT64_C(                   3) },
+      {  INT64_C( 1867195010018395777), -INT64_C(  771658662816369608) },
+      {  INT64_C( 4417500854561443922), -INT64_C( 1383226262026342664) },
+      { -INT64_C( 1383226262026342664), -INT64_C(  771658662816369608) } },
+    { {  INT64_C(                   2),  INT64_C(                  10) },
+      { -INT64_C(  307266429537268226), -INT64_C( 8171693769695100780) },
+      { -INT64_C( 6271256129835319679), -INT64_C( 6006927099424281299) },
+      { -INT64_C(  307266429537268226), -INT64_C(  307266429537268226) } },
+    { {  INT64_C(                   1),  INT64_C(                  34) },
+      { -INT64_C( 8879945616743390963), -INT64_C( 2467170682676137794) },
+      {  INT64_C( 8065993496138279212),  INT64_C( 6733482200007143491) },
+      {  INT64_C( 6733482200007143491), -INT64_C( 8879945616743390963) } },
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v2i64 c = simde_msa_ld_d(test_vec[i].c, 0);
+    simde_v2i64 a = simde_msa_ld_d(test_vec[i].a, 0);
+    simde_v2i64 b = simde_msa_ld_d(test_vec[i].b, 0);
+    simde_v2i64 r = simde_msa_vshf_d(c, a, b);
+
+    simde_test_msa_v2i64_assert_equal(r, simde_msa_ld_d(test_vec[i].r, 0));
+  }
+
+  return 0;
+#else
+  fputc('\n', stdout);
+  for (int i = 0 ; i < 8 ; i++) {
+    simde_v2i64 c = simde_test_msa_v2i64_random();
+    simde_v2i64 a = simde_test_msa_v2i64_random();
+    simde_v2i64 b = simde_test_msa_v2i64_random();
+    simde_v2i64 r = simde_msa_vshf_d(c, a, b);
+
+    simde_test_msa_v2i64_write(2, c, SIMDE_TEST_VEC_POS_FIRST);
+    simde_test_msa_v2i64_write(2, a, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, b, SIMDE_TEST_VEC_POS_MIDDLE);
+    simde_test_msa_v2i64_write(2, r, SIMDE_TEST_VEC_POS_LAST);
+  }
+  return 1;
+#endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vshf_b)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshf_h)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshf_w)
+SIMDE_TEST_FUNC_LIST_ENTRY(vshf_d)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-msa-footer.h"
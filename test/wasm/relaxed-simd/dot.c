@@ -0,0 +1,195 @@
+/* Copyright (c) 2021 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_WASM_RELAXED_SIMD_INSN dot
+#include "../../../simde/wasm/relaxed-simd.h"
+#include "test-relaxed-simd.h"
+
+static int
+test_simde_wasm_i16x8_relaxed_dot_i8x16_i7x16(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      int8_t a[sizeof(simde_v128_t) / sizeof(int8_t)];
+      int8_t b[sizeof(simde_v128_t) / sizeof(int8_t)];
+      int16_t r[sizeof(simde_v128_t) / sizeof(int16_t)];
+    } test_vec[] = {
+      { {      INT8_MIN,      INT8_MIN,  INT8_C( 126), -INT8_C( 110), -INT8_C( 112),  INT8_C( 124), -INT8_C( 125),  INT8_C( 121),
+          -INT8_C(  88),  INT8_C(   1), -INT8_C(  35), -INT8_C(  42),  INT8_C(  15),  INT8_C( 126),  INT8_C( 102),  INT8_C( 124) },
+        {      INT8_MAX,      INT8_MAX,  INT8_C(  24),  INT8_C( 116),  INT8_C(  63),  INT8_C( 121),  INT8_C(   4),  INT8_C( 107),
+           INT8_C(  55),  INT8_C(  11),  INT8_C(  96),  INT8_C(  83),  INT8_C(  22),  INT8_C(  67),  INT8_C(  72),  INT8_C( 125) },
+        { -INT16_C( 32512), -INT16_C(  9736),  INT16_C(  7948),  INT16_C( 12447), -INT16_C(  4829), -INT16_C(  6846),  INT16_C(  8772),  INT16_C( 22844) } },
+      { { -INT8_C( 121),  INT8_C( 110),  INT8_C(  19), -INT8_C(  28), -INT8_C(  10),  INT8_C(  36), -INT8_C(  70),  INT8_C( 123),
+          -INT8_C(  75),  INT8_C(  42), -INT8_C(  92), -INT8_C(  68),  INT8_C(  87),  INT8_C( 109),  INT8_C( 104), -INT8_C(  29) },
+        {  INT8_C(  43),  INT8_C(  34),  INT8_C(  16),  INT8_C(  57),  INT8_C(   0),  INT8_C(  35),  INT8_C(  56),  INT8_C(  70),
+           INT8_C(  38),  INT8_C(  49),  INT8_C(  87),  INT8_C(  21),  INT8_C(  24),  INT8_C(  16),  INT8_C(  65),  INT8_C(  36) },
+        { -INT16_C(  1463), -INT16_C(  1292),  INT16_C(  1260),  INT16_C(  4690), -INT16_C(   792), -INT16_C(  9432),  INT16_C(  3832),  INT16_C(  5716) } },
+      { {  INT8_C(   7), -INT8_C(   5), -INT8_C(  61), -INT8_C(  34), -INT8_C(  69),  INT8_C( 123), -INT8_C(  35), -INT8_C(  95),
+           INT8_C(  54),  INT8_C(  40), -INT8_C( 123),  INT8_C(  99),  INT8_C(  15), -INT8_C(  96),  INT8_C( 102), -INT8_C(  22) },
+        {  INT8_C( 112),  INT8_C(  61),  INT8_C(  79),  INT8_C(  62),  INT8_C( 114),  INT8_C(  63),  INT8_C(  62),  INT8_C(  35),
+           INT8_C(  58),  INT8_C( 118),  INT8_C(  41),  INT8_C(  33),  INT8_C(  30),  INT8_C( 111),  INT8_C(  63),  INT8_C( 110) },
+        {  INT16_C(   479), -INT16_C(  6927), -INT16_C(   117), -INT16_C(  5495),  INT16_C(  7852), -INT16_C(  1776), -INT16_C( 10206),  INT16_C(  4006) } },
+      { { -INT8_C( 126), -INT8_C( 111), -INT8_C(  51),  INT8_C(  95), -INT8_C(  24),  INT8_C(  33), -INT8_C(  10), -INT8_C(  14),
+          -INT8_C(  22), -INT8_C(  44), -INT8_C(  38), -INT8_C(  79), -INT8_C(  14), -INT8_C(  94), -INT8_C( 112),  INT8_C(  44) },
+        {  INT8_C( 123),  INT8_C(  30),  INT8_C( 122),  INT8_C( 118),  INT8_C(  73),  INT8_C(  61),  INT8_C(  38),  INT8_C(  38),
+           INT8_C(  11),  INT8_C( 105),  INT8_C( 104),  INT8_C( 108),  INT8_C(  53),  INT8_C(  63),  INT8_C(  52),  INT8_C(  32) },
+        { -INT16_C( 18828),  INT16_C(  4988),  INT16_C(   261), -INT16_C(   912), -INT16_C(  4862), -INT16_C( 12484), -INT16_C(  6664), -INT16_C(  4416) } },
+      { { -INT8_C(  54),  INT8_C( 103),  INT8_C(  29),  INT8_C(  23),  INT8_C(  81),  INT8_C(  86),      INT8_MIN, -INT8_C(  85),
+           INT8_C(  20),  INT8_C(  49), -INT8_C(  65), -INT8_C(   9), -INT8_C(  97),  INT8_C(  60), -INT8_C(  59),  INT8_C(  21) },
+        {  INT8_C(   1),  INT8_C( 116),  INT8_C( 120),  INT8_C( 120),  INT8_C(  17),  INT8_C(   8),  INT8_C(  41),  INT8_C( 104),
+           INT8_C(  32),  INT8_C( 116),  INT8_C(  55),  INT8_C(  17),  INT8_C(  57),  INT8_C(   8),  INT8_C(  11),  INT8_C(   6) },
+        {  INT16_C( 11894),  INT16_C(  6240),  INT16_C(  2065), -INT16_C( 14088),  INT16_C(  6324), -INT16_C(  3728), -INT16_C(  5049), -INT16_C(   523) } },
+      { {  INT8_C(  28), -INT8_C(  82), -INT8_C(  10), -INT8_C(  67), -INT8_C(  95), -INT8_C(  75), -INT8_C(  18), -INT8_C(  58),
+           INT8_C(  39), -INT8_C( 121), -INT8_C(  34), -INT8_C(  15),  INT8_C(  21),  INT8_C(  27),  INT8_C( 124), -INT8_C(  44) },
+        {  INT8_C(  33),  INT8_C(  29),  INT8_C(  25),  INT8_C( 100),  INT8_C(  81),  INT8_C( 118),  INT8_C(   1),  INT8_C(  59),
+           INT8_C(  20),  INT8_C(  85),  INT8_C(  92),  INT8_C(  32),  INT8_C(  36),  INT8_C(  11),  INT8_C(   3),  INT8_C( 126) },
+        { -INT16_C(  1454), -INT16_C(  6950), -INT16_C( 16545), -INT16_C(  3440), -INT16_C(  9505), -INT16_C(  3608),  INT16_C(  1053), -INT16_C(  5172) } },
+      { {  INT8_C(  11), -INT8_C(  24),  INT8_C(  76),  INT8_C(  30),      INT8_MAX, -INT8_C(  91),  INT8_C( 110),  INT8_C(  30),
+          -INT8_C(  85),  INT8_C( 114), -INT8_C( 117), -INT8_C(  89),  INT8_C(  47),  INT8_C(  49),  INT8_C(  62), -INT8_C(  12) },
+        {  INT8_C(  85),  INT8_C(  61),  INT8_C(  89),  INT8_C(  14),  INT8_C(  17),  INT8_C( 113),  INT8_C(  11),  INT8_C(  75),
+           INT8_C(  37),  INT8_C(   0),  INT8_C(  18),  INT8_C(   2),  INT8_C(  33),  INT8_C(  52),  INT8_C(  63),  INT8_C( 106) },
+        { -INT16_C(   529),  INT16_C(  7184), -INT16_C(  8124),  INT16_C(  3460), -INT16_C(  3145), -INT16_C(  2284),  INT16_C(  4099),  INT16_C(  2634) } },
+      { { -INT8_C(  80),  INT8_C( 100),  INT8_C(  61),  INT8_C(  44), -INT8_C(  34), -INT8_C(  89),  INT8_C( 110), -INT8_C( 101),
+           INT8_C( 102),  INT8_C(  82), -INT8_C(  45), -INT8_C(  47),  INT8_C(  46), -INT8_C(  57),  INT8_C(  69), -INT8_C(  34) },
+        {  INT8_C(  47),  INT8_C(  34),  INT8_C(  60),  INT8_C(  28),  INT8_C(  88),  INT8_C(   1),  INT8_C( 118),  INT8_C(  75),
+           INT8_C( 103),  INT8_C(  77),  INT8_C(  24),  INT8_C(  54),  INT8_C(  32),  INT8_C(  13),  INT8_C(  37),  INT8_C( 115) },
+        { -INT16_C(   360),  INT16_C(  4892), -INT16_C(  3081),  INT16_C(  5405),  INT16_C( 16820), -INT16_C(  3618),  INT16_C(   731), -INT16_C(  1357) } }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+      simde_v128_t r = simde_wasm_i16x8_relaxed_dot_i8x16_i7x16(a, b);
+      simde_test_wasm_i16x8_assert_equal(r, simde_wasm_v128_load(test_vec[i].r));
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    for (int i = 0 ; i < 8 ; i++) {
+      simde_v128_t
+        a = simde_test_wasm_i8x16_random(),
+        b = simde_wasm_v128_and(simde_test_wasm_i8x16_random(), simde_wasm_i8x16_splat(INT8_MAX)),
+        r;
+
+      r = simde_wasm_i16x8_relaxed_dot_i8x16_i7x16(a, b);
+
+      simde_test_wasm_i8x16_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_wasm_i8x16_write(3, b, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_i16x8_write(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
+static int
+test_simde_wasm_i32x4_relaxed_dot_i8x16_i7x16_add(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      int8_t a[sizeof(simde_v128_t) / sizeof(int8_t)];
+      int8_t b[sizeof(simde_v128_t) / sizeof(int8_t)];
+      int32_t c[sizeof(simde_v128_t) / sizeof(int32_t)];
+      int32_t r[sizeof(simde_v128_t) / sizeof(int32_t)];
+    } test_vec[] = {
+      { {  INT8_C(  59), -INT8_C(   4),  INT8_C(  84), -INT8_C(  78),  INT8_C(  52), -INT8_C(  21), -INT8_C(  17),  INT8_C(  65),
+          -INT8_C(  47), -INT8_C(  95),  INT8_C( 118), -INT8_C( 102), -INT8_C(   9), -INT8_C(  99),  INT8_C(  41),  INT8_C( 123) },
+        {  INT8_C(  15),  INT8_C(  14),  INT8_C( 113),  INT8_C(  36),  INT8_C(  30),  INT8_C( 125),  INT8_C( 108),  INT8_C(   8),
+           INT8_C(  28),  INT8_C(  62),  INT8_C( 108),  INT8_C(  88),  INT8_C(  98),  INT8_C( 121),  INT8_C( 113),  INT8_C(   0) },
+        {  INT32_C(  629502146), -INT32_C(  566117951),  INT32_C(  200188996),  INT32_C(  601051629) },
+        {  INT32_C(  629509659), -INT32_C(  566120332),  INT32_C(  200185558),  INT32_C(  601043401) } },
+      { { -INT8_C(  89), -INT8_C(  80), -INT8_C(  33), -INT8_C(  33), -INT8_C(  23),  INT8_C(  24), -INT8_C( 102),  INT8_C(  46),
+          -INT8_C(  89), -INT8_C(  46), -INT8_C(  75), -INT8_C( 120), -INT8_C(  33), -INT8_C(  12), -INT8_C( 109),  INT8_C(  17) },
+        {  INT8_C(   7),  INT8_C(  28),  INT8_C(  12),  INT8_C(  82),  INT8_C(  74),  INT8_C(  97),  INT8_C(  98),  INT8_C(  36),
+           INT8_C( 122),  INT8_C(  93),  INT8_C( 107),  INT8_C( 103),  INT8_C(  68),  INT8_C( 103),  INT8_C(  99),  INT8_C(  60) },
+        {  INT32_C(  670940750), -INT32_C(  827966565), -INT32_C( 1032115307),  INT32_C(  820448957) },
+        {  INT32_C(  670934785), -INT32_C(  827974279), -INT32_C( 1032150828),  INT32_C(  820435706) } },
+      { { -INT8_C(  47),  INT8_C(  61),  INT8_C( 122), -INT8_C(  53), -INT8_C( 123), -INT8_C( 122), -INT8_C( 114),  INT8_C(  28),
+          -INT8_C(  90), -INT8_C(  48),  INT8_C( 121),  INT8_C(  70), -INT8_C(  30),  INT8_C(  23), -INT8_C(  32),  INT8_C(  28) },
+        {  INT8_C(  77),  INT8_C(  65),  INT8_C(  28),  INT8_C( 100),  INT8_C(  80),  INT8_C(  52),  INT8_C( 118),  INT8_C( 116),
+           INT8_C(  24),  INT8_C(  42),  INT8_C(  97),  INT8_C(  60),  INT8_C( 117),  INT8_C(   0),  INT8_C(  11),  INT8_C(  42) },
+        {  INT32_C(  996159921),  INT32_C(  644463030),  INT32_C(  653689326), -INT32_C(  999380159) },
+        {  INT32_C(  996158383),  INT32_C(  644436642),  INT32_C(  653701087), -INT32_C(  999382845) } },
+      { {      INT8_MAX, -INT8_C(  12), -INT8_C(  91),  INT8_C(  57), -INT8_C(  23),  INT8_C(  24),  INT8_C(  90), -INT8_C(  91),
+          -INT8_C(  24),  INT8_C( 117), -INT8_C(  88),  INT8_C(  69),  INT8_C(  91),  INT8_C(  34), -INT8_C(  65),  INT8_C( 125) },
+        {  INT8_C( 110),  INT8_C(  42),  INT8_C(  97),  INT8_C(  50),  INT8_C(  55),  INT8_C(  62),  INT8_C(  80),  INT8_C(  65),
+           INT8_C(  63),  INT8_C(  90),  INT8_C( 125),  INT8_C(  41),  INT8_C(  15),  INT8_C(  89),  INT8_C(  44),  INT8_C(  86) },
+        {  INT32_C(  679988726), -INT32_C(  577331010),  INT32_C(  830114967), -INT32_C(  836218225) },
+        {  INT32_C(  679996215), -INT32_C(  577329502),  INT32_C(  830115814), -INT32_C(  836205944) } },
+      { { -INT8_C(  13),  INT8_C(  91), -INT8_C(   1),  INT8_C(   3), -INT8_C( 122), -INT8_C(  11), -INT8_C(  68),  INT8_C(  88),
+          -INT8_C( 121), -INT8_C(  71),  INT8_C(  12), -INT8_C(  11),  INT8_C(   5),  INT8_C(  98), -INT8_C(  14),  INT8_C( 126) },
+        {  INT8_C(  36),  INT8_C(  63),  INT8_C(  42),  INT8_C( 122),  INT8_C(  21),  INT8_C(  88),      INT8_MAX,  INT8_C(   1),
+           INT8_C(  85),  INT8_C(   0),  INT8_C(  60),  INT8_C(  96),  INT8_C(  54),  INT8_C(  92),  INT8_C(  66),  INT8_C(  14) },
+        { -INT32_C(  365321796),  INT32_C(  514895866), -INT32_C(  530112784), -INT32_C(  164349990) },
+        { -INT32_C(  365316207),  INT32_C(  514883788), -INT32_C(  530123405), -INT32_C(  164339864) } },
+      { { -INT8_C(   8), -INT8_C(  93), -INT8_C(  94), -INT8_C(  77), -INT8_C( 109), -INT8_C(  86), -INT8_C(  67),  INT8_C(  12),
+           INT8_C(  31),  INT8_C(  72), -INT8_C(  40), -INT8_C(  34),  INT8_C(  69),  INT8_C(  65), -INT8_C(  44),  INT8_C(  60) },
+        {  INT8_C(  14),  INT8_C( 124),  INT8_C( 110),  INT8_C(  41),  INT8_C(  66),  INT8_C(  92),  INT8_C( 113),  INT8_C(  33),
+           INT8_C( 119),  INT8_C( 114),  INT8_C(  54),  INT8_C(  62),  INT8_C( 112),  INT8_C( 122),  INT8_C(  51),  INT8_C( 106) },
+        { -INT32_C(  401938810),  INT32_C(  310024168),  INT32_C(  737435715),  INT32_C(  460605181) },
+        { -INT32_C(  401963951),  INT32_C(  310001887),  INT32_C(  737443344),  INT32_C(  460624955) } },
+      { {  INT8_C(  30),  INT8_C(  61), -INT8_C(  97), -INT8_C(  30),  INT8_C(  96), -INT8_C(  59),  INT8_C(  51),  INT8_C(   1),
+               INT8_MIN,  INT8_C(  39),  INT8_C(  86), -INT8_C(  41), -INT8_C(  91), -INT8_C( 100),  INT8_C(  88),  INT8_C(  74) },
+        {  INT8_C( 117),  INT8_C(  99),  INT8_C( 117),  INT8_C(  49),  INT8_C(  41),  INT8_C( 113),  INT8_C(  37),  INT8_C( 114),
+           INT8_C(  57),  INT8_C(  17),  INT8_C(  44),  INT8_C( 108),      INT8_MAX,  INT8_C(  34),  INT8_C(  68),  INT8_C(  22) },
+        {  INT32_C(  891569192), -INT32_C(  454932226),  INT32_C(  887249777),  INT32_C(  184709006) },
+        {  INT32_C(  891565922), -INT32_C(  454932956),  INT32_C(  887242500),  INT32_C(  184701661) } },
+      { {  INT8_C(  94), -INT8_C(  17), -INT8_C(  58), -INT8_C(  71), -INT8_C( 101), -INT8_C(  44),  INT8_C(  56),  INT8_C(  50),
+           INT8_C(  49), -INT8_C(  87), -INT8_C(  28),  INT8_C(  71),  INT8_C( 112), -INT8_C(  37),  INT8_C(  22),  INT8_C( 100) },
+        {  INT8_C(  36),  INT8_C( 119),  INT8_C(  27),  INT8_C(  12),  INT8_C(  91),  INT8_C(  13),  INT8_C(  60),  INT8_C( 117),
+           INT8_C(  94),  INT8_C(  52),  INT8_C(  38),  INT8_C(  64),  INT8_C(  45),  INT8_C(  23),  INT8_C( 118),  INT8_C(  81) },
+        {  INT32_C(  712764229),  INT32_C(  850269020),  INT32_C(  701486208),  INT32_C(  370349561) },
+        {  INT32_C(  712763172),  INT32_C(  850268467),  INT32_C(  701489770),  INT32_C(  370364446) } }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+      simde_v128_t c = simde_wasm_v128_load(test_vec[i].c);
+      simde_v128_t r = simde_wasm_i32x4_relaxed_dot_i8x16_i7x16_add(a, b, c);
+      simde_test_wasm_i32x4_assert_equal(r, simde_wasm_v128_load(test_vec[i].r));
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    for (int i = 0 ; i < 8 ; i++) {
+      simde_v128_t
+        a = simde_test_wasm_i8x16_random(),
+        b = simde_wasm_v128_and(simde_test_wasm_i8x16_random(), simde_wasm_i8x16_splat(INT8_MAX)),
+        c = simde_wasm_i32x4_shr(simde_test_wasm_i32x4_random(), 1),
+        r;
+
+      r = simde_wasm_i32x4_relaxed_dot_i8x16_i7x16_add(a, b, c);
+
+      simde_test_wasm_i8x16_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_wasm_i8x16_write(3, b, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_i32x4_write(3, c, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_i32x4_write(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_i16x8_relaxed_dot_i8x16_i7x16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_i32x4_relaxed_dot_i8x16_i7x16_add)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-relaxed-simd-footer.h"
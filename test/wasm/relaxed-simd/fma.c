@@ -175,9 +175,85 @@ test_simde_wasm_f64x2_fma(SIMDE_MUNIT_TEST_ARGS) {
   #endif
 }
 
+static int
+test_simde_wasm_f32x4_relaxed_madd(SIMDE_MUNIT_TEST_ARGS) {
+  SIMDE_TEST_STRUCT_MODIFIERS struct {
+    simde_float32 a[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    simde_float32 b[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    simde_float32 c[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    simde_float32 r[sizeof(simde_v128_t) / sizeof(simde_float32)];
+  } test_vec[] = {
+      { { SIMDE_FLOAT32_C(   -4.875), SIMDE_FLOAT32_C(  170.625), SIMDE_FLOAT32_C( -136.000), SIMDE_FLOAT32_C( -152.625) },
+        { SIMDE_FLOAT32_C(  193.250), SIMDE_FLOAT32_C( -321.000), SIMDE_FLOAT32_C( -118.375), SIMDE_FLOAT32_C(   39.375) },
+        { SIMDE_FLOAT32_C(   66.125), SIMDE_FLOAT32_C(  435.250), SIMDE_FLOAT32_C(  184.625), SIMDE_FLOAT32_C(   -9.000) },
+        { SIMDE_FLOAT32_C( -875.969), SIMDE_FLOAT32_C(-54335.375), SIMDE_FLOAT32_C(16283.625), SIMDE_FLOAT32_C(-6018.609) } },
+      { { SIMDE_FLOAT32_C(  354.000), SIMDE_FLOAT32_C( -396.375), SIMDE_FLOAT32_C( -420.250), SIMDE_FLOAT32_C(  175.875) },
+        { SIMDE_FLOAT32_C(  328.625), SIMDE_FLOAT32_C(  -77.375), SIMDE_FLOAT32_C( -389.250), SIMDE_FLOAT32_C(  338.375) },
+        { SIMDE_FLOAT32_C(  -69.375), SIMDE_FLOAT32_C(  153.125), SIMDE_FLOAT32_C(  262.625), SIMDE_FLOAT32_C(  475.750) },
+        { SIMDE_FLOAT32_C(116263.875), SIMDE_FLOAT32_C(30822.641), SIMDE_FLOAT32_C(163844.938), SIMDE_FLOAT32_C(59987.453) } },
+      { { SIMDE_FLOAT32_C( -385.500), SIMDE_FLOAT32_C(  332.000), SIMDE_FLOAT32_C(  387.000), SIMDE_FLOAT32_C(  309.500) },
+        { SIMDE_FLOAT32_C( -137.625), SIMDE_FLOAT32_C(  299.125), SIMDE_FLOAT32_C(  -56.500), SIMDE_FLOAT32_C( -408.625) },
+        { SIMDE_FLOAT32_C( -172.875), SIMDE_FLOAT32_C( -195.375), SIMDE_FLOAT32_C( -353.875), SIMDE_FLOAT32_C(  127.625) },
+        { SIMDE_FLOAT32_C(52881.562), SIMDE_FLOAT32_C(99114.125), SIMDE_FLOAT32_C(-22219.375), SIMDE_FLOAT32_C(-126341.812) } },
+      { { SIMDE_FLOAT32_C(  241.000), SIMDE_FLOAT32_C(  -17.250), SIMDE_FLOAT32_C( -438.875), SIMDE_FLOAT32_C(  353.750) },
+        { SIMDE_FLOAT32_C(  357.375), SIMDE_FLOAT32_C(  -11.875), SIMDE_FLOAT32_C( -216.000), SIMDE_FLOAT32_C(  433.125) },
+        { SIMDE_FLOAT32_C( -457.125), SIMDE_FLOAT32_C(  317.375), SIMDE_FLOAT32_C(   65.375), SIMDE_FLOAT32_C( -349.625) },
+        { SIMDE_FLOAT32_C(85670.250), SIMDE_FLOAT32_C(  522.219), SIMDE_FLOAT32_C(94862.375), SIMDE_FLOAT32_C(152868.344) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+    simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+    simde_v128_t c = simde_wasm_v128_load(test_vec[i].c);
+    simde_v128_t r = simde_wasm_f32x4_relaxed_madd(a, b, c);
+    simde_test_wasm_f32x4_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_wasm_f64x2_relaxed_madd(SIMDE_MUNIT_TEST_ARGS) {
+  SIMDE_TEST_STRUCT_MODIFIERS struct {
+    simde_float64 a[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    simde_float64 b[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    simde_float64 c[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    simde_float64 r[sizeof(simde_v128_t) / sizeof(simde_float64)];
+  } test_vec[] = {
+      { { SIMDE_FLOAT64_C(  -96.625), SIMDE_FLOAT64_C( -419.125) },
+        { SIMDE_FLOAT64_C( -406.250), SIMDE_FLOAT64_C(  445.750) },
+        { SIMDE_FLOAT64_C(  221.375), SIMDE_FLOAT64_C( -344.500) },
+        { SIMDE_FLOAT64_C(39475.281), SIMDE_FLOAT64_C(-187169.469) } },
+      { { SIMDE_FLOAT64_C( -364.250), SIMDE_FLOAT64_C(  339.000) },
+        { SIMDE_FLOAT64_C(  247.250), SIMDE_FLOAT64_C(  426.000) },
+        { SIMDE_FLOAT64_C(  -26.125), SIMDE_FLOAT64_C( -280.375) },
+        { SIMDE_FLOAT64_C(-90086.938), SIMDE_FLOAT64_C(144133.625) } },
+      { { SIMDE_FLOAT64_C(  155.375), SIMDE_FLOAT64_C(   56.375) },
+        { SIMDE_FLOAT64_C( -304.000), SIMDE_FLOAT64_C( -227.000) },
+        { SIMDE_FLOAT64_C(  285.750), SIMDE_FLOAT64_C( -230.000) },
+        { SIMDE_FLOAT64_C(-46948.250), SIMDE_FLOAT64_C(-13027.125) } },
+      { { SIMDE_FLOAT64_C(  159.875), SIMDE_FLOAT64_C(  321.125) },
+        { SIMDE_FLOAT64_C(  436.250), SIMDE_FLOAT64_C( -398.000) },
+        { SIMDE_FLOAT64_C(  151.250), SIMDE_FLOAT64_C( -484.250) },
+        { SIMDE_FLOAT64_C(69896.719), SIMDE_FLOAT64_C(-128292.000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+    simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+    simde_v128_t c = simde_wasm_v128_load(test_vec[i].c);
+    simde_v128_t r = simde_wasm_f64x2_relaxed_madd(a, b, c);
+    simde_test_wasm_f64x2_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f32x4_fma)
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f64x2_fma)
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f32x4_relaxed_madd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f64x2_relaxed_madd)
 SIMDE_TEST_FUNC_LIST_END
 
 #include "test-relaxed-simd-footer.h"
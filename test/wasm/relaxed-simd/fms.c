@@ -175,9 +175,85 @@ test_simde_wasm_f64x2_fms(SIMDE_MUNIT_TEST_ARGS) {
   #endif
 }
 
+static int
+test_simde_wasm_f32x4_relaxed_nmadd(SIMDE_MUNIT_TEST_ARGS) {
+  SIMDE_TEST_STRUCT_MODIFIERS struct {
+    simde_float32 a[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    simde_float32 b[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    simde_float32 c[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    simde_float32 r[sizeof(simde_v128_t) / sizeof(simde_float32)];
+  } test_vec[] = {
+      { { SIMDE_FLOAT32_C(  391.875), SIMDE_FLOAT32_C(   95.375), SIMDE_FLOAT32_C( -288.250), SIMDE_FLOAT32_C(   48.000) },
+        { SIMDE_FLOAT32_C(  332.125), SIMDE_FLOAT32_C( -219.500), SIMDE_FLOAT32_C(  406.375), SIMDE_FLOAT32_C(  439.625) },
+        { SIMDE_FLOAT32_C( -358.000), SIMDE_FLOAT32_C(  -69.625), SIMDE_FLOAT32_C( -195.125), SIMDE_FLOAT32_C(  121.125) },
+        { SIMDE_FLOAT32_C(-130509.484), SIMDE_FLOAT32_C(20865.188), SIMDE_FLOAT32_C(116942.469), SIMDE_FLOAT32_C(-20980.875) } },
+      { { SIMDE_FLOAT32_C(  173.250), SIMDE_FLOAT32_C(  174.250), SIMDE_FLOAT32_C(  479.625), SIMDE_FLOAT32_C( -422.875) },
+        { SIMDE_FLOAT32_C( -387.375), SIMDE_FLOAT32_C(  490.625), SIMDE_FLOAT32_C(  375.875), SIMDE_FLOAT32_C(  352.750) },
+        { SIMDE_FLOAT32_C(  180.750), SIMDE_FLOAT32_C( -345.500), SIMDE_FLOAT32_C(  211.375), SIMDE_FLOAT32_C( -240.125) },
+        { SIMDE_FLOAT32_C(67293.469), SIMDE_FLOAT32_C(-85836.906), SIMDE_FLOAT32_C(-180067.672), SIMDE_FLOAT32_C(148929.031) } },
+      { { SIMDE_FLOAT32_C(  -12.250), SIMDE_FLOAT32_C( -255.125), SIMDE_FLOAT32_C(  -50.375), SIMDE_FLOAT32_C(  -12.875) },
+        { SIMDE_FLOAT32_C(  -98.250), SIMDE_FLOAT32_C( -349.625), SIMDE_FLOAT32_C(  127.375), SIMDE_FLOAT32_C( -354.875) },
+        { SIMDE_FLOAT32_C( -104.750), SIMDE_FLOAT32_C( -443.875), SIMDE_FLOAT32_C( -433.875), SIMDE_FLOAT32_C(  258.000) },
+        { SIMDE_FLOAT32_C(-1308.312), SIMDE_FLOAT32_C(-89641.953), SIMDE_FLOAT32_C( 5982.641), SIMDE_FLOAT32_C(-4311.016) } },
+      { { SIMDE_FLOAT32_C(  494.250), SIMDE_FLOAT32_C(  210.625), SIMDE_FLOAT32_C(   90.000), SIMDE_FLOAT32_C(   31.125) },
+        { SIMDE_FLOAT32_C(  469.875), SIMDE_FLOAT32_C(  402.000), SIMDE_FLOAT32_C( -138.500), SIMDE_FLOAT32_C(  320.375) },
+        { SIMDE_FLOAT32_C(  -82.750), SIMDE_FLOAT32_C(  443.125), SIMDE_FLOAT32_C(  303.250), SIMDE_FLOAT32_C( -200.375) },
+        { SIMDE_FLOAT32_C(-232318.469), SIMDE_FLOAT32_C(-84228.125), SIMDE_FLOAT32_C(12768.250), SIMDE_FLOAT32_C(-10172.047) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+    simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+    simde_v128_t c = simde_wasm_v128_load(test_vec[i].c);
+    simde_v128_t r = simde_wasm_f32x4_relaxed_nmadd(a, b, c);
+    simde_test_wasm_f32x4_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_wasm_f64x2_relaxed_nmadd(SIMDE_MUNIT_TEST_ARGS) {
+  SIMDE_TEST_STRUCT_MODIFIERS struct {
+    simde_float64 a[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    simde_float64 b[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    simde_float64 c[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    simde_float64 r[sizeof(simde_v128_t) / sizeof(simde_float64)];
+  } test_vec[] = {
+      { { SIMDE_FLOAT64_C( -433.375), SIMDE_FLOAT64_C( -127.375) },
+        { SIMDE_FLOAT64_C(   39.750), SIMDE_FLOAT64_C(  427.500) },
+        { SIMDE_FLOAT64_C( -279.000), SIMDE_FLOAT64_C(  466.625) },
+        { SIMDE_FLOAT64_C(16947.656), SIMDE_FLOAT64_C(54919.438) } },
+      { { SIMDE_FLOAT64_C(  -58.125), SIMDE_FLOAT64_C(   48.500) },
+        { SIMDE_FLOAT64_C(  113.875), SIMDE_FLOAT64_C(  -65.375) },
+        { SIMDE_FLOAT64_C(  -71.000), SIMDE_FLOAT64_C(  456.250) },
+        { SIMDE_FLOAT64_C( 6547.984), SIMDE_FLOAT64_C( 3626.938) } },
+      { { SIMDE_FLOAT64_C(  243.125), SIMDE_FLOAT64_C( -407.375) },
+        { SIMDE_FLOAT64_C(  245.625), SIMDE_FLOAT64_C(  -33.125) },
+        { SIMDE_FLOAT64_C(  104.750), SIMDE_FLOAT64_C(  173.250) },
+        { SIMDE_FLOAT64_C(-59612.828), SIMDE_FLOAT64_C(-13321.047) } },
+      { { SIMDE_FLOAT64_C( -421.500), SIMDE_FLOAT64_C(  168.750) },
+        { SIMDE_FLOAT64_C( -242.000), SIMDE_FLOAT64_C( -445.500) },
+        { SIMDE_FLOAT64_C( -317.875), SIMDE_FLOAT64_C(  342.000) },
+        { SIMDE_FLOAT64_C(-102320.875), SIMDE_FLOAT64_C(75520.125) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+    simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+    simde_v128_t c = simde_wasm_v128_load(test_vec[i].c);
+    simde_v128_t r = simde_wasm_f64x2_relaxed_nmadd(a, b, c);
+    simde_test_wasm_f64x2_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f32x4_fms)
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f64x2_fms)
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f32x4_relaxed_nmadd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f64x2_relaxed_nmadd)
 SIMDE_TEST_FUNC_LIST_END
 
 #include "test-relaxed-simd-footer.h"
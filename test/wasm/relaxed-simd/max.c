@@ -0,0 +1,155 @@
+/* Copyright (c) 2021 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_WASM_RELAXED_SIMD_INSN max
+#include "../../../simde/wasm/relaxed-simd.h"
+#include "test-relaxed-simd.h"
+
+static int
+test_simde_wasm_f32x4_relaxed_max(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      simde_float32 a[sizeof(simde_v128_t) / sizeof(simde_float32)];
+      simde_float32 b[sizeof(simde_v128_t) / sizeof(simde_float32)];
+      simde_float32 r[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    } test_vec[] = {
+      { { SIMDE_FLOAT32_C(   991.23), SIMDE_FLOAT32_C(   383.52), SIMDE_FLOAT32_C(   802.33), SIMDE_FLOAT32_C(  -750.01) },
+        { SIMDE_FLOAT32_C(   216.17), SIMDE_FLOAT32_C(   991.23), SIMDE_FLOAT32_C(  -841.45), SIMDE_FLOAT32_C(  -132.55) },
+        { SIMDE_FLOAT32_C(   991.23), SIMDE_FLOAT32_C(   991.23), SIMDE_FLOAT32_C(   802.33), SIMDE_FLOAT32_C(  -132.55) } },
+      { { SIMDE_FLOAT32_C(  -793.05), SIMDE_FLOAT32_C(   778.65), SIMDE_FLOAT32_C(  -251.19), SIMDE_FLOAT32_C(  -591.79) },
+        { SIMDE_FLOAT32_C(  -793.05), SIMDE_FLOAT32_C(   473.43), SIMDE_FLOAT32_C(   912.91), SIMDE_FLOAT32_C(  -625.20) },
+        { SIMDE_FLOAT32_C(  -793.05), SIMDE_FLOAT32_C(   778.65), SIMDE_FLOAT32_C(   912.91), SIMDE_FLOAT32_C(  -591.79) } },
+      { { SIMDE_FLOAT32_C(   160.50), SIMDE_FLOAT32_C(    42.13), SIMDE_FLOAT32_C(   701.28), SIMDE_FLOAT32_C(   203.76) },
+        { SIMDE_FLOAT32_C(  -556.25), SIMDE_FLOAT32_C(   860.09), SIMDE_FLOAT32_C(  -594.66), SIMDE_FLOAT32_C(   116.85) },
+        { SIMDE_FLOAT32_C(   160.50), SIMDE_FLOAT32_C(   860.09), SIMDE_FLOAT32_C(   701.28), SIMDE_FLOAT32_C(   203.76) } },
+      { { SIMDE_FLOAT32_C(   532.37), SIMDE_FLOAT32_C(  -268.70), SIMDE_FLOAT32_C(   269.72), SIMDE_FLOAT32_C(  -583.02) },
+        { SIMDE_FLOAT32_C(   391.75), SIMDE_FLOAT32_C(  -676.41), SIMDE_FLOAT32_C(  -300.77), SIMDE_FLOAT32_C(    42.25) },
+        { SIMDE_FLOAT32_C(   532.37), SIMDE_FLOAT32_C(  -268.70), SIMDE_FLOAT32_C(   269.72), SIMDE_FLOAT32_C(    42.25) } },
+      { { SIMDE_FLOAT32_C(   816.85), SIMDE_FLOAT32_C(   925.87), SIMDE_FLOAT32_C(   -59.00), SIMDE_FLOAT32_C(  -867.64) },
+        { SIMDE_FLOAT32_C(   189.90), SIMDE_FLOAT32_C(   164.27), SIMDE_FLOAT32_C(   466.25), SIMDE_FLOAT32_C(  -904.07) },
+        { SIMDE_FLOAT32_C(   816.85), SIMDE_FLOAT32_C(   925.87), SIMDE_FLOAT32_C(   466.25), SIMDE_FLOAT32_C(  -867.64) } },
+      { { SIMDE_FLOAT32_C(  -739.77), SIMDE_FLOAT32_C(   663.85), SIMDE_FLOAT32_C(   961.20), SIMDE_FLOAT32_C(    88.99) },
+        { SIMDE_FLOAT32_C(  -104.47), SIMDE_FLOAT32_C(   317.41), SIMDE_FLOAT32_C(  -731.45), SIMDE_FLOAT32_C(   316.20) },
+        { SIMDE_FLOAT32_C(  -104.47), SIMDE_FLOAT32_C(   663.85), SIMDE_FLOAT32_C(   961.20), SIMDE_FLOAT32_C(   316.20) } },
+      { { SIMDE_FLOAT32_C(   869.26), SIMDE_FLOAT32_C(   403.44), SIMDE_FLOAT32_C(   436.35), SIMDE_FLOAT32_C(   927.74) },
+        { SIMDE_FLOAT32_C(  -235.29), SIMDE_FLOAT32_C(  -327.90), SIMDE_FLOAT32_C(   983.13), SIMDE_FLOAT32_C(   869.26) },
+        { SIMDE_FLOAT32_C(   869.26), SIMDE_FLOAT32_C(   403.44), SIMDE_FLOAT32_C(   983.13), SIMDE_FLOAT32_C(   927.74) } },
+      { { SIMDE_FLOAT32_C(   884.84), SIMDE_FLOAT32_C(   596.31), SIMDE_FLOAT32_C(  -623.81), SIMDE_FLOAT32_C(   595.80) },
+        { SIMDE_FLOAT32_C(  -557.41), SIMDE_FLOAT32_C(    56.54), SIMDE_FLOAT32_C(   884.84), SIMDE_FLOAT32_C(   967.56) },
+        { SIMDE_FLOAT32_C(   884.84), SIMDE_FLOAT32_C(   596.31), SIMDE_FLOAT32_C(   884.84), SIMDE_FLOAT32_C(   967.56) } }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+      simde_v128_t r = simde_wasm_f32x4_relaxed_max(a, b);
+      simde_test_wasm_f32x4_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    simde_float32 inputs[8 * 2 * (sizeof(simde_v128_t) / sizeof(simde_float32))];
+    simde_test_wasm_f32x4_random_full(8, 2, inputs, -SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0), HEDLEY_STATIC_CAST(SimdeTestVecFloatType, SIMDE_TEST_VEC_FLOAT_EQUAL));
+    for (size_t i = 0 ; i < 8 ; i++) {
+      simde_v128_t
+        a = simde_test_wasm_f32x4_random_full_extract(2, inputs, i, 0),
+        b = simde_test_wasm_f32x4_random_full_extract(2, inputs, i, 1),
+        r;
+
+      r = simde_wasm_f32x4_relaxed_max(a, b);
+
+      simde_test_wasm_f32x4_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_wasm_f32x4_write(3, b, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_f32x4_write(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
+static int
+test_simde_wasm_f64x2_relaxed_max(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      simde_float64 a[sizeof(simde_v128_t) / sizeof(simde_float64)];
+      simde_float64 b[sizeof(simde_v128_t) / sizeof(simde_float64)];
+      simde_float64 r[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    } test_vec[] = {
+      { { SIMDE_FLOAT64_C(  -783.86), SIMDE_FLOAT64_C(   383.53) },
+        { SIMDE_FLOAT64_C(   285.07), SIMDE_FLOAT64_C(  -783.86) },
+        { SIMDE_FLOAT64_C(   285.07), SIMDE_FLOAT64_C(   383.53) } },
+      { { SIMDE_FLOAT64_C(  -476.30), SIMDE_FLOAT64_C(   666.04) },
+        { SIMDE_FLOAT64_C(  -476.30), SIMDE_FLOAT64_C(   -76.79) },
+        { SIMDE_FLOAT64_C(  -476.30), SIMDE_FLOAT64_C(   666.04) } },
+      { { SIMDE_FLOAT64_C(  -107.31), SIMDE_FLOAT64_C(  -517.55) },
+        { SIMDE_FLOAT64_C(  -107.31), SIMDE_FLOAT64_C(  -802.13) },
+        { SIMDE_FLOAT64_C(  -107.31), SIMDE_FLOAT64_C(  -517.55) } },
+      { { SIMDE_FLOAT64_C(  -404.37), SIMDE_FLOAT64_C(   578.84) },
+        { SIMDE_FLOAT64_C(   132.82), SIMDE_FLOAT64_C(  -133.80) },
+        { SIMDE_FLOAT64_C(   132.82), SIMDE_FLOAT64_C(   578.84) } },
+      { { SIMDE_FLOAT64_C(  -482.46), SIMDE_FLOAT64_C(    69.89) },
+        { SIMDE_FLOAT64_C(   683.76), SIMDE_FLOAT64_C(   289.28) },
+        { SIMDE_FLOAT64_C(   683.76), SIMDE_FLOAT64_C(   289.28) } },
+      { { SIMDE_FLOAT64_C(   931.97), SIMDE_FLOAT64_C(  -752.61) },
+        { SIMDE_FLOAT64_C(   548.17), SIMDE_FLOAT64_C(   919.48) },
+        { SIMDE_FLOAT64_C(   931.97), SIMDE_FLOAT64_C(   919.48) } },
+      { { SIMDE_FLOAT64_C(  -327.04), SIMDE_FLOAT64_C(   276.52) },
+        { SIMDE_FLOAT64_C(  -779.41), SIMDE_FLOAT64_C(   515.02) },
+        { SIMDE_FLOAT64_C(  -327.04), SIMDE_FLOAT64_C(   515.02) } },
+      { { SIMDE_FLOAT64_C(  -951.00), SIMDE_FLOAT64_C(    65.20) },
+        { SIMDE_FLOAT64_C(  -951.00), SIMDE_FLOAT64_C(   463.21) },
+        { SIMDE_FLOAT64_C(  -951.00), SIMDE_FLOAT64_C(   463.21) } }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+      simde_v128_t r = simde_wasm_f64x2_relaxed_max(a, b);
+      simde_test_wasm_f64x2_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    simde_float64 inputs[8 * 2 * (sizeof(simde_v128_t) / sizeof(simde_float64))];
+    simde_test_wasm_f64x2_random_full(8, 2, inputs, -SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0), HEDLEY_STATIC_CAST(SimdeTestVecFloatType, SIMDE_TEST_VEC_FLOAT_EQUAL));
+    for (size_t i = 0 ; i < 8 ; i++) {
+      simde_v128_t
+        a = simde_test_wasm_f64x2_random_full_extract(2, inputs, i, 0),
+        b = simde_test_wasm_f64x2_random_full_extract(2, inputs, i, 1),
+        r;
+
+      r = simde_wasm_f64x2_relaxed_max(a, b);
+
+      simde_test_wasm_f64x2_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_wasm_f64x2_write(3, b, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_f64x2_write(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f32x4_relaxed_max)
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f64x2_relaxed_max)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-relaxed-simd-footer.h"
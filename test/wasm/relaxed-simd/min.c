@@ -0,0 +1,155 @@
+/* Copyright (c) 2021 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_WASM_RELAXED_SIMD_INSN min
+#include "../../../simde/wasm/relaxed-simd.h"
+#include "test-relaxed-simd.h"
+
+static int
+test_simde_wasm_f32x4_relaxed_min(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      simde_float32 a[sizeof(simde_v128_t) / sizeof(simde_float32)];
+      simde_float32 b[sizeof(simde_v128_t) / sizeof(simde_float32)];
+      simde_float32 r[sizeof(simde_v128_t) / sizeof(simde_float32)];
+    } test_vec[] = {
+      { { SIMDE_FLOAT32_C(   296.99), SIMDE_FLOAT32_C(   402.74), SIMDE_FLOAT32_C(   914.09), SIMDE_FLOAT32_C(  -607.19) },
+        { SIMDE_FLOAT32_C(  -869.26), SIMDE_FLOAT32_C(   648.51), SIMDE_FLOAT32_C(  -333.87), SIMDE_FLOAT32_C(  -255.25) },
+        { SIMDE_FLOAT32_C(  -869.26), SIMDE_FLOAT32_C(   402.74), SIMDE_FLOAT32_C(  -333.87), SIMDE_FLOAT32_C(  -607.19) } },
+      { { SIMDE_FLOAT32_C(  -633.33), SIMDE_FLOAT32_C(   819.36), SIMDE_FLOAT32_C(   -17.66), SIMDE_FLOAT32_C(  -857.33) },
+        { SIMDE_FLOAT32_C(   835.62), SIMDE_FLOAT32_C(   146.00), SIMDE_FLOAT32_C(  -842.54), SIMDE_FLOAT32_C(   677.16) },
+        { SIMDE_FLOAT32_C(  -633.33), SIMDE_FLOAT32_C(   146.00), SIMDE_FLOAT32_C(  -842.54), SIMDE_FLOAT32_C(  -857.33) } },
+      { { SIMDE_FLOAT32_C(   480.34), SIMDE_FLOAT32_C(   315.06), SIMDE_FLOAT32_C(   985.41), SIMDE_FLOAT32_C(  -975.79) },
+        { SIMDE_FLOAT32_C(   948.86), SIMDE_FLOAT32_C(   480.34), SIMDE_FLOAT32_C(  -494.12), SIMDE_FLOAT32_C(   224.89) },
+        { SIMDE_FLOAT32_C(   480.34), SIMDE_FLOAT32_C(   315.06), SIMDE_FLOAT32_C(  -494.12), SIMDE_FLOAT32_C(  -975.79) } },
+      { { SIMDE_FLOAT32_C(   408.49), SIMDE_FLOAT32_C(    48.47), SIMDE_FLOAT32_C(  -802.52), SIMDE_FLOAT32_C(  -216.12) },
+        { SIMDE_FLOAT32_C(  -395.93), SIMDE_FLOAT32_C(   498.82), SIMDE_FLOAT32_C(   862.45), SIMDE_FLOAT32_C(   551.31) },
+        { SIMDE_FLOAT32_C(  -395.93), SIMDE_FLOAT32_C(    48.47), SIMDE_FLOAT32_C(  -802.52), SIMDE_FLOAT32_C(  -216.12) } },
+      { { SIMDE_FLOAT32_C(  -659.64), SIMDE_FLOAT32_C(   415.08), SIMDE_FLOAT32_C(  -469.89), SIMDE_FLOAT32_C(   994.59) },
+        { SIMDE_FLOAT32_C(  -654.18), SIMDE_FLOAT32_C(   936.48), SIMDE_FLOAT32_C(  -969.90), SIMDE_FLOAT32_C(  -659.64) },
+        { SIMDE_FLOAT32_C(  -659.64), SIMDE_FLOAT32_C(   415.08), SIMDE_FLOAT32_C(  -969.90), SIMDE_FLOAT32_C(  -659.64) } },
+      { { SIMDE_FLOAT32_C(  -870.03), SIMDE_FLOAT32_C(   993.24), SIMDE_FLOAT32_C(   744.86), SIMDE_FLOAT32_C(   -64.77) },
+        { SIMDE_FLOAT32_C(  -974.63), SIMDE_FLOAT32_C(  -686.04), SIMDE_FLOAT32_C(  -469.19), SIMDE_FLOAT32_C(   -33.98) },
+        { SIMDE_FLOAT32_C(  -974.63), SIMDE_FLOAT32_C(  -686.04), SIMDE_FLOAT32_C(  -469.19), SIMDE_FLOAT32_C(   -64.77) } },
+      { { SIMDE_FLOAT32_C(  -877.04), SIMDE_FLOAT32_C(  -501.51), SIMDE_FLOAT32_C(  -584.09), SIMDE_FLOAT32_C(   470.22) },
+        { SIMDE_FLOAT32_C(   111.43), SIMDE_FLOAT32_C(  -330.82), SIMDE_FLOAT32_C(   527.48), SIMDE_FLOAT32_C(  -213.84) },
+        { SIMDE_FLOAT32_C(  -877.04), SIMDE_FLOAT32_C(  -501.51), SIMDE_FLOAT32_C(  -584.09), SIMDE_FLOAT32_C(  -213.84) } },
+      { { SIMDE_FLOAT32_C(  -396.07), SIMDE_FLOAT32_C(   592.61), SIMDE_FLOAT32_C(   390.68), SIMDE_FLOAT32_C(  -835.20) },
+        { SIMDE_FLOAT32_C(   -86.84), SIMDE_FLOAT32_C(  -430.47), SIMDE_FLOAT32_C(  -765.29), SIMDE_FLOAT32_C(  -396.07) },
+        { SIMDE_FLOAT32_C(  -396.07), SIMDE_FLOAT32_C(  -430.47), SIMDE_FLOAT32_C(  -765.29), SIMDE_FLOAT32_C(  -835.20) } }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+      simde_v128_t r = simde_wasm_f32x4_relaxed_min(a, b);
+      simde_test_wasm_f32x4_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    simde_float32 inputs[8 * 2 * (sizeof(simde_v128_t) / sizeof(simde_float32))];
+    simde_test_wasm_f32x4_random_full(8, 2, inputs, -SIMDE_FLOAT32_C(1000.0), SIMDE_FLOAT32_C(1000.0), HEDLEY_STATIC_CAST(SimdeTestVecFloatType, SIMDE_TEST_VEC_FLOAT_EQUAL));
+    for (size_t i = 0 ; i < 8 ; i++) {
+      simde_v128_t
+        a = simde_test_wasm_f32x4_random_full_extract(2, inputs, i, 0),
+        b = simde_test_wasm_f32x4_random_full_extract(2, inputs, i, 1),
+        r;
+
+      r = simde_wasm_f32x4_relaxed_min(a, b);
+
+      simde_test_wasm_f32x4_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_wasm_f32x4_write(3, b, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_f32x4_write(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
+static int
+test_simde_wasm_f64x2_relaxed_min(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      simde_float64 a[sizeof(simde_v128_t) / sizeof(simde_float64)];
+      simde_float64 b[sizeof(simde_v128_t) / sizeof(simde_float64)];
+      simde_float64 r[sizeof(simde_v128_t) / sizeof(simde_float64)];
+    } test_vec[] = {
+      { { SIMDE_FLOAT64_C(   108.54), SIMDE_FLOAT64_C(   789.06) },
+        { SIMDE_FLOAT64_C(   108.54), SIMDE_FLOAT64_C(  -992.22) },
+        { SIMDE_FLOAT64_C(   108.54), SIMDE_FLOAT64_C(  -992.22) } },
+      { { SIMDE_FLOAT64_C(  -407.68), SIMDE_FLOAT64_C(   228.40) },
+        { SIMDE_FLOAT64_C(  -805.81), SIMDE_FLOAT64_C(  -407.68) },
+        { SIMDE_FLOAT64_C(  -805.81), SIMDE_FLOAT64_C(  -407.68) } },
+      { { SIMDE_FLOAT64_C(   473.12), SIMDE_FLOAT64_C(  -638.59) },
+        { SIMDE_FLOAT64_C(   473.12), SIMDE_FLOAT64_C(  -296.55) },
+        { SIMDE_FLOAT64_C(   473.12), SIMDE_FLOAT64_C(  -638.59) } },
+      { { SIMDE_FLOAT64_C(  -546.28), SIMDE_FLOAT64_C(  -616.37) },
+        { SIMDE_FLOAT64_C(  -546.28), SIMDE_FLOAT64_C(  -341.29) },
+        { SIMDE_FLOAT64_C(  -546.28), SIMDE_FLOAT64_C(  -616.37) } },
+      { { SIMDE_FLOAT64_C(  -310.27), SIMDE_FLOAT64_C(   986.17) },
+        { SIMDE_FLOAT64_C(  -310.27), SIMDE_FLOAT64_C(   703.16) },
+        { SIMDE_FLOAT64_C(  -310.27), SIMDE_FLOAT64_C(   703.16) } },
+      { { SIMDE_FLOAT64_C(   899.85), SIMDE_FLOAT64_C(   209.70) },
+        { SIMDE_FLOAT64_C(   -44.92), SIMDE_FLOAT64_C(   899.85) },
+        { SIMDE_FLOAT64_C(   -44.92), SIMDE_FLOAT64_C(   209.70) } },
+      { { SIMDE_FLOAT64_C(  -939.26), SIMDE_FLOAT64_C(   -18.12) },
+        { SIMDE_FLOAT64_C(  -375.42), SIMDE_FLOAT64_C(   -65.12) },
+        { SIMDE_FLOAT64_C(  -939.26), SIMDE_FLOAT64_C(   -65.12) } },
+      { { SIMDE_FLOAT64_C(  -125.67), SIMDE_FLOAT64_C(  -392.03) },
+        { SIMDE_FLOAT64_C(  -593.07), SIMDE_FLOAT64_C(  -125.67) },
+        { SIMDE_FLOAT64_C(  -593.07), SIMDE_FLOAT64_C(  -392.03) } }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+      simde_v128_t r = simde_wasm_f64x2_relaxed_min(a, b);
+      simde_test_wasm_f64x2_assert_equal(r, simde_wasm_v128_load(test_vec[i].r), 1);
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    simde_float64 inputs[8 * 2 * (sizeof(simde_v128_t) / sizeof(simde_float64))];
+    simde_test_wasm_f64x2_random_full(8, 2, inputs, -SIMDE_FLOAT64_C(1000.0), SIMDE_FLOAT64_C(1000.0), HEDLEY_STATIC_CAST(SimdeTestVecFloatType, SIMDE_TEST_VEC_FLOAT_EQUAL));
+    for (size_t i = 0 ; i < 8 ; i++) {
+      simde_v128_t
+        a = simde_test_wasm_f64x2_random_full_extract(2, inputs, i, 0),
+        b = simde_test_wasm_f64x2_random_full_extract(2, inputs, i, 1),
+        r;
+
+      r = simde_wasm_f64x2_relaxed_min(a, b);
+
+      simde_test_wasm_f64x2_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_wasm_f64x2_write(3, b, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_f64x2_write(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f32x4_relaxed_min)
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_f64x2_relaxed_min)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-relaxed-simd-footer.h"
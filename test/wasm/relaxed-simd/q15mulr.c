@@ -0,0 +1,91 @@
+/* Copyright (c) 2021 Evan Nemerson <evan@nemerson.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TEST_WASM_RELAXED_SIMD_INSN q15mulr
+#include "../../../simde/wasm/relaxed-simd.h"
+#include "test-relaxed-simd.h"
+
+static int
+test_simde_wasm_i16x8_relaxed_q15mulr(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      int16_t a[sizeof(simde_v128_t) / sizeof(int16_t)];
+      int16_t b[sizeof(simde_v128_t) / sizeof(int16_t)];
+      int16_t r[sizeof(simde_v128_t) / sizeof(int16_t)];
+    } test_vec[] = {
+      { { -INT16_C( 29867),        INT16_MIN,        INT16_MAX,        INT16_MIN, -INT16_C( 16501), -INT16_C(  9377), -INT16_C( 13063), -INT16_C(  9643) },
+        { -INT16_C( 30264),        INT16_MAX,        INT16_MAX,  INT16_C(     0),  INT16_C( 16036), -INT16_C( 16589),  INT16_C( 31773), -INT16_C( 12944) },
+        {  INT16_C( 27585), -INT16_C( 32767),  INT16_C( 32766),  INT16_C(     0), -INT16_C(  8075),  INT16_C(  4747), -INT16_C( 12666),  INT16_C(  3809) } },
+      { {  INT16_C( 10297),  INT16_C( 28189),  INT16_C( 11480),  INT16_C(  4027), -INT16_C(  6538),  INT16_C( 10935),  INT16_C(  1167), -INT16_C(  7504) },
+        {  INT16_C( 21014),  INT16_C( 27629), -INT16_C( 15003), -INT16_C( 24228),  INT16_C( 23718),  INT16_C( 24251),  INT16_C( 18645),  INT16_C( 17698) },
+        {  INT16_C(  6603),  INT16_C( 23768), -INT16_C(  5256), -INT16_C(  2977), -INT16_C(  4732),  INT16_C(  8093),  INT16_C(   664), -INT16_C(  4053) } },
+      { {  INT16_C( 11942),  INT16_C( 24236),  INT16_C( 24343), -INT16_C( 11772), -INT16_C( 23580), -INT16_C( 16621), -INT16_C( 14458),  INT16_C( 23583) },
+        { -INT16_C(  8106), -INT16_C( 14148),  INT16_C(  4302),  INT16_C( 31585),  INT16_C( 18278),  INT16_C( 10730), -INT16_C(  9288),  INT16_C(  2365) },
+        { -INT16_C(  2954), -INT16_C( 10464),  INT16_C(  3196), -INT16_C( 11347), -INT16_C( 13153), -INT16_C(  5443),  INT16_C(  4098),  INT16_C(  1702) } },
+      { {  INT16_C( 11056), -INT16_C( 20485), -INT16_C( 19497), -INT16_C( 23473),  INT16_C( 32003), -INT16_C( 11095),  INT16_C( 22137), -INT16_C( 29065) },
+        { -INT16_C( 30830), -INT16_C( 31401), -INT16_C(  8654),  INT16_C(   575),  INT16_C( 31123), -INT16_C( 29979),  INT16_C(  7463),  INT16_C( 30632) },
+        { -INT16_C( 10402),  INT16_C( 19630),  INT16_C(  5149), -INT16_C(   412),  INT16_C( 30396),  INT16_C( 10151),  INT16_C(  5042), -INT16_C( 27170) } },
+      { { -INT16_C( 16682),  INT16_C( 32141),  INT16_C( 20611),  INT16_C( 18658),  INT16_C( 18193),  INT16_C(  9671),  INT16_C( 10048), -INT16_C(   759) },
+        { -INT16_C( 32552),  INT16_C(   262), -INT16_C( 31228),  INT16_C( 25912), -INT16_C( 29957),  INT16_C( 22572), -INT16_C( 11146),  INT16_C( 16601) },
+        {  INT16_C( 16572),  INT16_C(   257), -INT16_C( 19642),  INT16_C( 14754), -INT16_C( 16632),  INT16_C(  6662), -INT16_C(  3418), -INT16_C(   385) } },
+      { { -INT16_C( 25251), -INT16_C(  3867),  INT16_C( 22394), -INT16_C( 27091),  INT16_C(  3281), -INT16_C(  8151), -INT16_C( 16008), -INT16_C( 15791) },
+        {  INT16_C( 31200), -INT16_C(  7466), -INT16_C( 31505),  INT16_C( 32562),  INT16_C( 24651),  INT16_C( 31546), -INT16_C(  7552), -INT16_C( 22097) },
+        { -INT16_C( 24043),  INT16_C(   881), -INT16_C( 21531), -INT16_C( 26921),  INT16_C(  2468), -INT16_C(  7847),  INT16_C(  3689),  INT16_C( 10649) } },
+      { {  INT16_C( 17498), -INT16_C( 11840), -INT16_C(  5437),  INT16_C( 30719),  INT16_C(  2554), -INT16_C(  2032),  INT16_C(  7379),  INT16_C( 28554) },
+        {  INT16_C( 21979), -INT16_C( 26290),  INT16_C( 31088),  INT16_C( 17043),  INT16_C( 25103), -INT16_C(  5705), -INT16_C( 20235),  INT16_C(  6395) },
+        {  INT16_C( 11737),  INT16_C(  9499), -INT16_C(  5158),  INT16_C( 15977),  INT16_C(  1957),  INT16_C(   354), -INT16_C(  4557),  INT16_C(  5573) } },
+      { {  INT16_C(  4042), -INT16_C( 13774), -INT16_C( 26042), -INT16_C( 18176), -INT16_C( 18160),  INT16_C( 15232),  INT16_C( 27334),  INT16_C( 20879) },
+        {  INT16_C( 29705),  INT16_C( 19885), -INT16_C(  3917),  INT16_C( 21051), -INT16_C( 13726),  INT16_C(  7689), -INT16_C( 23861),  INT16_C( 27875) },
+        {  INT16_C(  3664), -INT16_C(  8359),  INT16_C(  3113), -INT16_C( 11677),  INT16_C(  7607),  INT16_C(  3574), -INT16_C( 19904),  INT16_C( 17761) } }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      simde_v128_t b = simde_wasm_v128_load(test_vec[i].b);
+      simde_v128_t r = simde_wasm_i16x8_relaxed_q15mulr(a, b);
+      simde_test_wasm_i16x8_assert_equal(r, simde_wasm_v128_load(test_vec[i].r));
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    for (int i = 0 ; i < 8 ; i++) {
+      simde_v128_t
+        a = simde_test_wasm_i16x8_random(),
+        b = simde_test_wasm_i16x8_random(),
+        r;
+
+      r = simde_wasm_i16x8_relaxed_q15mulr(a, b);
+
+      simde_test_wasm_i16x8_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_wasm_i16x8_write(3, b, SIMDE_TEST_VEC_POS_MIDDLE);
+      simde_test_wasm_i16x8_write(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(wasm_i16x8_relaxed_q15mulr)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-relaxed-simd-footer.h"
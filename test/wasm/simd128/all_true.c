@@ -200,7 +200,7 @@ test_simde_wasm_i64x2_all_true(SIMDE_MUNIT_TEST_ARGS) {
     SIMDE_TEST_STRUCT_MODIFIERS struct {
       int64_t a[sizeof(simde_v128_t) / sizeof(int64_t)];
       simde_bool r;
-    } test_vec[8] = {
+    } test_vec[] = {
       { {  INT64_C( 4627191103769018368), -INT64_C( 6533839992563695616) },
          INT8_C(   1) },
       { { -INT64_C( 2356159122894565910), -INT64_C( 7636474394341444928) },
@@ -216,6 +216,8 @@ test_simde_wasm_i64x2_all_true(SIMDE_MUNIT_TEST_ARGS) {
       { {  INT64_C(                   0), -INT64_C( 1209425168241270568) },
          INT8_C(   0) },
       { { -INT64_C( 7853513116650955838), -INT64_C( 4468347172671650195) },
+         INT8_C(   1) },
+      { {                      INT64_MIN, -INT64_C( 2257984121953607472) },
          INT8_C(   1) }
     };
 
@@ -217,11 +217,66 @@ test_simde_wasm_i64x2_bitmask(SIMDE_MUNIT_TEST_ARGS) {
   #endif
 }
 
+static int
+test_simde_x_wasm_i8x16_bitmask_nibbles(SIMDE_MUNIT_TEST_ARGS) {
+  #if 1
+    SIMDE_TEST_STRUCT_MODIFIERS struct {
+      int8_t a[sizeof(simde_v128_t) / sizeof(int8_t)];
+      uint64_t r;
+    } test_vec[] = {
+      { {  INT8_C(  89),  INT8_C(  17),  INT8_C( 102),  INT8_C(   6),  INT8_C(  63),  INT8_C(  71),  INT8_C( 109),  INT8_C(  24),
+           INT8_C(  71),  INT8_C(  28),  INT8_C( 126),  INT8_C(  79),  INT8_C(  33),  INT8_C(  79),  INT8_C(  79),  INT8_C(  64) },
+        UINT64_C(                   0) },
+      { { -INT8_C(  87), -INT8_C(  58), -INT8_C(   4),  INT8_C(  33), -INT8_C(  68), -INT8_C( 114),  INT8_C(  81),  INT8_C(  26),
+          -INT8_C(  37), -INT8_C(  33),  INT8_C( 113),  INT8_C(  41),  INT8_C( 103),  INT8_C(  42),  INT8_C(  44), -INT8_C(  94) },
+        UINT64_C(17293823664336080895) },
+      { { -INT8_C( 118), -INT8_C(  76),  INT8_C( 114),  INT8_C( 120),  INT8_C(   5),  INT8_C( 117),  INT8_C(   1),  INT8_C(   2),
+          -INT8_C(  41), -INT8_C(  34), -INT8_C(  33),  INT8_C(  17),  INT8_C(  87), -INT8_C(  13), -INT8_C(  19),  INT8_C( 116) },
+        UINT64_C( 1148435492870553855) },
+      { {  INT8_C(  61),  INT8_C(  93),  INT8_C(  25),  INT8_C(  66),  INT8_C(  67),  INT8_C(  26),  INT8_C( 113),  INT8_C(  63),
+           INT8_C(  30), -INT8_C(  58), -INT8_C(  47),  INT8_C(  23),  INT8_C(  36), -INT8_C( 118), -INT8_C(  32), -INT8_C(  67) },
+        UINT64_C(18442257997548748800) },
+      { {  INT8_C(  43), -INT8_C( 112),  INT8_C(   1),  INT8_C(  72), -INT8_C( 110),  INT8_C(  98), -INT8_C( 125), -INT8_C(  55),
+           INT8_C( 126),  INT8_C(  62),  INT8_C(   7),  INT8_C(  96), -INT8_C(  58), -INT8_C(  60),  INT8_C(  71), -INT8_C(  91) },
+        UINT64_C(17365598692443095280) },
+      { {  INT8_C(  42), -INT8_C( 115), -INT8_C(  29),  INT8_C(  80),  INT8_C( 115), -INT8_C( 127), -INT8_C(  55),  INT8_C(  89),
+          -INT8_C(  96),  INT8_C(  66), -INT8_C(   1),  INT8_C(  21),  INT8_C(  25), -INT8_C( 121),  INT8_C(  33),  INT8_C(  47) },
+        UINT64_C(   67570551776874480) },
+      { { -INT8_C( 127),  INT8_C( 117),  INT8_C( 101), -INT8_C(  77),  INT8_C(  54),  INT8_C( 122),  INT8_C( 116), -INT8_C(  38),
+          -INT8_C(  68), -INT8_C(   4),  INT8_C(  42),  INT8_C( 119),  INT8_C(  71), -INT8_C(  74), -INT8_C(  29), -INT8_C(  26) },
+        UINT64_C(18442241573325434895) },
+      { {  INT8_C( 116), -INT8_C(  80), -INT8_C(  74),  INT8_C(  74), -INT8_C(  70), -INT8_C(  40), -INT8_C(  47),  INT8_C(  48),
+          -INT8_C( 118), -INT8_C(  44),  INT8_C(  62),  INT8_C(  27), -INT8_C(  31),  INT8_C(  51), -INT8_C(  52), -INT8_C(  12) },
+        UINT64_C(18378909699807318000) }
+    };
+
+    for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+      simde_v128_t a = simde_wasm_v128_load(test_vec[i].a);
+      uint64_t r = simde_x_wasm_i8x16_bitmask_nibbles(a);
+      simde_assert_equal_u64(r, test_vec[i].r);
+    }
+    return 0;
+  #else
+    fputc('\n', stdout);
+    for (int i = 0 ; i < 8 ; i++) {
+      simde_v128_t a = simde_test_wasm_i8x16_random();
+      uint64_t r;
+
+      r = simde_x_wasm_i8x16_bitmask_nibbles(a);
+
+      simde_test_wasm_i8x16_write(3, a, SIMDE_TEST_VEC_POS_FIRST);
+      simde_test_codegen_write_u64(3, r, SIMDE_TEST_VEC_POS_LAST);
+    }
+    return 1;
+  #endif
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_i8x16_bitmask)
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_i16x8_bitmask)
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_i32x4_bitmask)
   SIMDE_TEST_FUNC_LIST_ENTRY(wasm_i64x2_bitmask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_wasm_i8x16_bitmask_nibbles)
 SIMDE_TEST_FUNC_LIST_END
 
 #include "test-simd128-footer.h"
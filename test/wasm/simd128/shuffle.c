@@ -80,6 +80,42 @@ test_simde_wasm_i8x16_shuffle(SIMDE_MUNIT_TEST_ARGS) {
     e = simde_wasm_i8x16_const(  68,  -22,   18,  -75,   68,   12,  122,   89,  106,   12,  106,   37,  -22,   73,   -8,   12);
     simde_test_wasm_i8x16_assert_equal(r, e);
 
+    a = simde_wasm_i8x16_const( -25,  -23,   93,  -99,  -63,  116, -107,  -41,   91,   -4,   81,  -25, -114,  -15,  -55,  -62);
+    b = simde_wasm_i8x16_const( -18,  119,   71,   58,   -4, -113, -113,   22,  -65, -106, -125,  109,   32,   35,   88,   93);
+    r = simde_wasm_i8x16_shuffle(a, b,  8, 24,  9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+    e = simde_wasm_i8x16_const(  91,  -65,   -4, -106,   81, -125,  -25,  109, -114,   32,  -15,   35,  -55,   88,  -62,   93);
+    simde_test_wasm_i8x16_assert_equal(r, e);
+
+    a = simde_wasm_i8x16_const( -26, -100,    0,  -27,   68,   91,  -49,  -98,  -78,  -90,  -64, -106, -104,   80,  -17,   61);
+    b = simde_wasm_i8x16_const( -82,   39,  -75,   80, -105,   87,  106,  -90, -108,   52,  -79,   -6,  -87,  -60,   13,   50);
+    r = simde_wasm_i8x16_shuffle(a, b,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20);
+    e = simde_wasm_i8x16_const(  91,  -49,  -98,  -78,  -90,  -64, -106, -104,   80,  -17,   61,  -82,   39,  -75,   80, -105);
+    simde_test_wasm_i8x16_assert_equal(r, e);
+
+    a = simde_wasm_i8x16_const(  95,   49,  112,   71, -112, -106,  -51, -124,  -71,  115, -111,  -35, -111, -119,   91, -104);
+    b = simde_wasm_i8x16_const(  21,   91,  -45,  -96,   21,  -42,  -78,  -94, -112, -118,   88, -117,   13,  123,   36,   74);
+    r = simde_wasm_i8x16_shuffle(a, b, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 16, 17, 18);
+    e = simde_wasm_i8x16_const( -96,   21,  -42,  -78,  -94, -112, -118,   88, -117,   13,  123,   36,   74,   21,   91,  -45);
+    simde_test_wasm_i8x16_assert_equal(r, e);
+
+    a = simde_wasm_i8x16_const(-114,  -77,  -72,  -23,   97,   -7,   28,   -9,  -54,   69,   77,   33,  -87,  -95,  -49, -106);
+    b = simde_wasm_i8x16_const(-116,  -55,   75,   -4,   37,  -94,  -26,   15,   37,   94,  112,  -17,  127,   -6, -125,  -77);
+    r = simde_wasm_i8x16_shuffle(a, b, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13);
+    e = simde_wasm_i8x16_const( -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95,  -95);
+    simde_test_wasm_i8x16_assert_equal(r, e);
+
+    a = simde_wasm_i8x16_const( -75, -117,  -19,  -20,  -78,  -55,  -60, -109,  -44,  -44, -100, -101,   70,  120,  -69,   85);
+    b = simde_wasm_i8x16_const( -23,   47,  -43,  -10,  -98, -121,   27,    5,   85,  -29,   96,  124,   38,    3,   12,   21);
+    r = simde_wasm_i8x16_shuffle(a, b,  0, 17,  2,  3, 20, 21,  6, 23,  8,  9, 26, 11, 28, 13, 14, 31);
+    e = simde_wasm_i8x16_const( -75,   47,  -19,  -20,  -98, -121,  -60,    5,  -44,  -44,   96, -101,   38,  120,  -69,   21);
+    simde_test_wasm_i8x16_assert_equal(r, e);
+
+    a = simde_wasm_i8x16_const( 114, -103,    6,   79,  -99, -101,   29,  -33,   23,  -10,  -16,    0,   86, -114,   35,  -21);
+    b = simde_wasm_i8x16_const( 111,   23,  -80, -122,  -78, -128,  -98,  -92,  -60,   66,  -86,   53,  -68,  119,   74,  125);
+    r = simde_wasm_i8x16_shuffle(a, b,  8,  9, 10, 11,  0,  1,  2,  3, 28, 29, 30, 31, 20, 21, 22, 23);
+    e = simde_wasm_i8x16_const(  23,  -10,  -16,    0,  114, -103,    6,   79,  -68,  119,   74,  125,  -78, -128,  -98,  -92);
+    simde_test_wasm_i8x16_assert_equal(r, e);
+
     return 0;
   #else
     fputc('\n', stdout);
@@ -178,6 +214,36 @@ test_simde_wasm_i16x8_shuffle(SIMDE_MUNIT_TEST_ARGS) {
     e = simde_wasm_i16x8_const( -19957,  -26699,  -15727,  -13640,  -26699,  -19957,  -19957,   32173);
     simde_test_wasm_i16x8_assert_equal(r, e);
 
+    a = simde_wasm_i16x8_const(  -7854,   21957,     242,    1472,  -19583,   31725,  -23755,   15599);
+    b = simde_wasm_i16x8_const(  28445,   -3708,    2158,  -14128,  -18459,    6669,   -3911,   13289);
+    r = simde_wasm_i16x8_shuffle(a, b,  2,  1,  3,  0,  7,  7,  4,  5);
+    e = simde_wasm_i16x8_const(    242,   21957,    1472,   -7854,   15599,   15599,  -19583,   31725);
+    simde_test_wasm_i16x8_assert_equal(r, e);
+
+    a = simde_wasm_i16x8_const( -14907,   32429,  -26398,   28475,  -18687,   25818,   30467,    6308);
+    b = simde_wasm_i16x8_const(  -3533,   25553,   25170,   30370,   -5703,  -11464,  -22425,    3464);
+    r = simde_wasm_i16x8_shuffle(a, b, 13, 13, 13, 13, 13, 13, 13, 13);
+    e = simde_wasm_i16x8_const( -11464,  -11464,  -11464,  -11464,  -11464,  -11464,  -11464,  -11464);
+    simde_test_wasm_i16x8_assert_equal(r, e);
+
+    a = simde_wasm_i16x8_const( -22740,   -2248,   -7235,  -28544,  -18862,    2579,    -533,   27495);
+    b = simde_wasm_i16x8_const( -17216,   -9514,   13436,   21306,   24961,   22674,   -6974,    3343);
+    r = simde_wasm_i16x8_shuffle(a, b,  8,  0,  9,  1, 10,  2, 11,  3);
+    e = simde_wasm_i16x8_const( -17216,  -22740,   -9514,   -2248,   13436,   -7235,   21306,  -28544);
+    simde_test_wasm_i16x8_assert_equal(r, e);
+
+    a = simde_wasm_i16x8_const(  -4370,  -19593,  -15552,   19322,    6297,   31210,  -23994,   26275);
+    b = simde_wasm_i16x8_const( -28456,    6905,  -13614,   15114,   32323,   14386,   13703,  -30649);
+    r = simde_wasm_i16x8_shuffle(a, b,  3,  4,  5,  6,  7,  8,  9, 10);
+    e = simde_wasm_i16x8_const(  19322,    6297,   31210,  -23994,   26275,  -28456,    6905,  -13614);
+    simde_test_wasm_i16x8_assert_equal(r, e);
+
+    a = simde_wasm_i16x8_const(  11561,   21655,  -29207,  -31280,   14792,  -11778,   12880,   15317);
+    b = simde_wasm_i16x8_const(  -1180,  -14491,  -25038,   13620,   21104,  -22527,  -14013,  -30831);
+    r = simde_wasm_i16x8_shuffle(a, b,  0,  9,  2, 11, 12,  5,  6, 15);
+    e = simde_wasm_i16x8_const(  11561,  -14491,  -29207,   13620,   21104,  -11778,   12880,  -30831);
+    simde_test_wasm_i16x8_assert_equal(r, e);
+
     return 0;
   #else
     fputc('\n', stdout);
@@ -266,6 +332,36 @@ test_simde_wasm_i32x4_shuffle(SIMDE_MUNIT_TEST_ARGS) {
     e = simde_wasm_i32x4_const(-1025522971,  -197182180, -2063095571,   589692128);
     simde_test_wasm_i32x4_assert_equal(r, e);
 
+    a = simde_wasm_i32x4_const(  472687813,   -28300732,  1216631440,  -532666637);
+    b = simde_wasm_i32x4_const(-1043937903,   835412351,  -885191941,   345395251);
+    r = simde_wasm_i32x4_shuffle(a, b,  3,  2,  1,  0);
+    e = simde_wasm_i32x4_const( -532666637,  1216631440,   -28300732,   472687813);
+    simde_test_wasm_i32x4_assert_equal(r, e);
+
+    a = simde_wasm_i32x4_const(  382620417, -1904716132,  -971010139, -1092478637);
+    b = simde_wasm_i32x4_const( 1227427123,   278886869,  1714221492,   157666851);
+    r = simde_wasm_i32x4_shuffle(a, b,  1,  0,  7,  6);
+    e = simde_wasm_i32x4_const(-1904716132,   382620417,   157666851,  1714221492);
+    simde_test_wasm_i32x4_assert_equal(r, e);
+
+    a = simde_wasm_i32x4_const(  521055934, -1454155435,  1479759791,   615252250);
+    b = simde_wasm_i32x4_const(  -66755761,  -334669909,    -1216537,  -477209204);
+    r = simde_wasm_i32x4_shuffle(a, b,  4,  1,  6,  3);
+    e = simde_wasm_i32x4_const(  -66755761, -1454155435,    -1216537,   615252250);
+    simde_test_wasm_i32x4_assert_equal(r, e);
+
+    a = simde_wasm_i32x4_const( 1806769478,   -51933715,   816308707,   387120511);
+    b = simde_wasm_i32x4_const( 1780696901,   333805888,   677634089,   410630953);
+    r = simde_wasm_i32x4_shuffle(a, b,  2,  6,  3,  7);
+    e = simde_wasm_i32x4_const(  816308707,   677634089,   387120511,   410630953);
+    simde_test_wasm_i32x4_assert_equal(r, e);
+
+    a = simde_wasm_i32x4_const(-1278933422, -1313785111,   -32118166,  -839754380);
+    b = simde_wasm_i32x4_const( 1044533331,  1691521300,  -514759249,  1960277192);
+    r = simde_wasm_i32x4_shuffle(a, b,  5,  6,  7,  0);
+    e = simde_wasm_i32x4_const( 1691521300,  -514759249,  1960277192, -1278933422);
+    simde_test_wasm_i32x4_assert_equal(r, e);
+
     return 0;
   #else
     fputc('\n', stdout);
@@ -350,6 +446,24 @@ test_simde_wasm_i64x2_shuffle(SIMDE_MUNIT_TEST_ARGS) {
     e = simde_wasm_i64x2_const(INT64_C(  8893207348925896126), INT64_C( -6565612563093738293));
     simde_test_wasm_i64x2_assert_equal(r, e);
 
+    a = simde_wasm_i64x2_const(INT64_C(   823339556215611862), INT64_C(  3859836345490014973));
+    b = simde_wasm_i64x2_const(INT64_C( -5746248477707843527), INT64_C(  7520163591228139972));
+    r = simde_wasm_i64x2_shuffle(a, b,  1,  2);
+    e = simde_wasm_i64x2_const(INT64_C(  3859836345490014973), INT64_C( -5746248477707843527));
+    simde_test_wasm_i64x2_assert_equal(r, e);
+
+    a = simde_wasm_i64x2_const(INT64_C(  5258874233037129906), INT64_C(   207032243300108026));
+    b = simde_wasm_i64x2_const(INT64_C( -4375449512946918919), INT64_C( -2566671556430963417));
+    r = simde_wasm_i64x2_shuffle(a, b,  3,  0);
+    e = simde_wasm_i64x2_const(INT64_C( -2566671556430963417), INT64_C(  5258874233037129906));
+    simde_test_wasm_i64x2_assert_equal(r, e);
+
+    a = simde_wasm_i64x2_const(INT64_C( -3662599700288872837), INT64_C( -6318134285337147175));
+    b = simde_wasm_i64x2_const(INT64_C(  1746378518383373284), INT64_C( -2777406909288072739));
+    r = simde_wasm_i64x2_shuffle(a, b,  1,  0);
+    e = simde_wasm_i64x2_const(INT64_C( -6318134285337147175), INT64_C( -3662599700288872837));
+    simde_test_wasm_i64x2_assert_equal(r, e);
+
     return 0;
   #else
     fputc('\n', stdout);
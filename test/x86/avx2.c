@@ -13857,6 +13857,31 @@ test_simde_mm256_stream_load_si256 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_x_mm256_stream_roundtrip(SIMDE_MUNIT_TEST_ARGS) {
+  SIMDE_ALIGN_TO_32 int32_t src[12 * 8];
+  SIMDE_ALIGN_TO_32 int32_t dst[12 * 8];
+
+  for (size_t i = 0 ; i < (sizeof(src) / sizeof(src[0])) ; i++) {
+    src[i] = HEDLEY_STATIC_CAST(int32_t, (HEDLEY_STATIC_CAST(uint32_t, i) * UINT32_C(0x9e3779b9)) & UINT32_C(0x3fffffff));
+    dst[i] = 0;
+  }
+
+  for (size_t i = 0 ; i < 12 ; i += 3) {
+    simde_mm256_stream_si256(SIMDE_ALIGN_CAST(simde__m256i*, &(dst[(i + 0) * 8])), simde_mm256_load_si256(SIMDE_ALIGN_CAST(simde__m256i const*, &(src[(i + 0) * 8]))));
+    simde_mm256_stream_ps(SIMDE_ALIGN_CAST(simde_float32*, &(dst[(i + 1) * 8])), simde_mm256_castsi256_ps(simde_mm256_load_si256(SIMDE_ALIGN_CAST(simde__m256i const*, &(src[(i + 1) * 8])))));
+    simde_mm256_stream_pd(SIMDE_ALIGN_CAST(simde_float64*, &(dst[(i + 2) * 8])), simde_mm256_castsi256_pd(simde_mm256_load_si256(SIMDE_ALIGN_CAST(simde__m256i const*, &(src[(i + 2) * 8])))));
+  }
+  simde_mm_sfence();
+
+  for (size_t i = 0 ; i < 12 ; i++) {
+    simde__m256i r = simde_mm256_stream_load_si256(SIMDE_ALIGN_CAST(simde__m256i const*, &(dst[i * 8])));
+    simde_test_x86_assert_equal_i32x8(r, simde_mm256_load_si256(SIMDE_ALIGN_CAST(simde__m256i const*, &(src[i * 8]))));
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm256_sub_epi8(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -16822,6 +16847,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_srlv_epi64)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_stream_load_si256)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm256_stream_roundtrip)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sub_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sub_epi16)
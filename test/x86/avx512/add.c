@@ -3316,6 +3316,122 @@ test_simde_mm512_maskz_add_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_add_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   -58.03), SIMDE_FLOAT16_VALUE(   -22.92), SIMDE_FLOAT16_VALUE(   -61.00), SIMDE_FLOAT16_VALUE(   -20.88),
+        SIMDE_FLOAT16_VALUE(    12.54), SIMDE_FLOAT16_VALUE(    29.16), SIMDE_FLOAT16_VALUE(   -49.06), SIMDE_FLOAT16_VALUE(   -28.78),
+        SIMDE_FLOAT16_VALUE(   -64.31), SIMDE_FLOAT16_VALUE(    62.94), SIMDE_FLOAT16_VALUE(   -41.19), SIMDE_FLOAT16_VALUE(    76.56),
+        SIMDE_FLOAT16_VALUE(   -85.25), SIMDE_FLOAT16_VALUE(   -98.25), SIMDE_FLOAT16_VALUE(   -15.23), SIMDE_FLOAT16_VALUE(   -15.56),
+        SIMDE_FLOAT16_VALUE(    50.47), SIMDE_FLOAT16_VALUE(    73.44), SIMDE_FLOAT16_VALUE(     2.67), SIMDE_FLOAT16_VALUE(   -40.03),
+        SIMDE_FLOAT16_VALUE(    43.25), SIMDE_FLOAT16_VALUE(    -7.97), SIMDE_FLOAT16_VALUE(   -48.50), SIMDE_FLOAT16_VALUE(   -35.88),
+        SIMDE_FLOAT16_VALUE(   -99.88), SIMDE_FLOAT16_VALUE(    41.78), SIMDE_FLOAT16_VALUE(   -90.88), SIMDE_FLOAT16_VALUE(   -62.38),
+        SIMDE_FLOAT16_VALUE(    23.94), SIMDE_FLOAT16_VALUE(    23.98), SIMDE_FLOAT16_VALUE(    23.77), SIMDE_FLOAT16_VALUE(    26.70) },
+      { SIMDE_FLOAT16_VALUE(    60.19), SIMDE_FLOAT16_VALUE(    88.94), SIMDE_FLOAT16_VALUE(    93.56), SIMDE_FLOAT16_VALUE(   -22.52),
+        SIMDE_FLOAT16_VALUE(   -29.80), SIMDE_FLOAT16_VALUE(   -72.81), SIMDE_FLOAT16_VALUE(   -13.66), SIMDE_FLOAT16_VALUE(   -65.50),
+        SIMDE_FLOAT16_VALUE(    86.75), SIMDE_FLOAT16_VALUE(    50.72), SIMDE_FLOAT16_VALUE(   -52.91), SIMDE_FLOAT16_VALUE(    38.34),
+        SIMDE_FLOAT16_VALUE(    39.66), SIMDE_FLOAT16_VALUE(   -80.19), SIMDE_FLOAT16_VALUE(    61.81), SIMDE_FLOAT16_VALUE(    46.66),
+        SIMDE_FLOAT16_VALUE(    -5.49), SIMDE_FLOAT16_VALUE(    88.75), SIMDE_FLOAT16_VALUE(   -82.38), SIMDE_FLOAT16_VALUE(   -93.25),
+        SIMDE_FLOAT16_VALUE(    44.66), SIMDE_FLOAT16_VALUE(    33.12), SIMDE_FLOAT16_VALUE(   -99.19), SIMDE_FLOAT16_VALUE(    21.12),
+        SIMDE_FLOAT16_VALUE(    18.11), SIMDE_FLOAT16_VALUE(   -24.30), SIMDE_FLOAT16_VALUE(   -74.69), SIMDE_FLOAT16_VALUE(    63.66),
+        SIMDE_FLOAT16_VALUE(    78.38), SIMDE_FLOAT16_VALUE(    11.11), SIMDE_FLOAT16_VALUE(   -55.78), SIMDE_FLOAT16_VALUE(     8.34) },
+      { SIMDE_FLOAT16_VALUE(    2.156), SIMDE_FLOAT16_VALUE(    66.00), SIMDE_FLOAT16_VALUE(    32.56), SIMDE_FLOAT16_VALUE(   -43.38),
+        SIMDE_FLOAT16_VALUE(   -17.25), SIMDE_FLOAT16_VALUE(   -43.66), SIMDE_FLOAT16_VALUE(   -62.72), SIMDE_FLOAT16_VALUE(   -94.25),
+        SIMDE_FLOAT16_VALUE(    22.44), SIMDE_FLOAT16_VALUE(   113.62), SIMDE_FLOAT16_VALUE(   -94.12), SIMDE_FLOAT16_VALUE(   114.88),
+        SIMDE_FLOAT16_VALUE(   -45.59), SIMDE_FLOAT16_VALUE(  -178.50), SIMDE_FLOAT16_VALUE(    46.59), SIMDE_FLOAT16_VALUE(    31.09),
+        SIMDE_FLOAT16_VALUE(    44.97), SIMDE_FLOAT16_VALUE(   162.25), SIMDE_FLOAT16_VALUE(   -79.69), SIMDE_FLOAT16_VALUE(  -133.25),
+        SIMDE_FLOAT16_VALUE(    87.88), SIMDE_FLOAT16_VALUE(    25.16), SIMDE_FLOAT16_VALUE(  -147.75), SIMDE_FLOAT16_VALUE(   -14.75),
+        SIMDE_FLOAT16_VALUE(   -81.75), SIMDE_FLOAT16_VALUE(    17.48), SIMDE_FLOAT16_VALUE(  -165.50), SIMDE_FLOAT16_VALUE(    1.281),
+        SIMDE_FLOAT16_VALUE(   102.31), SIMDE_FLOAT16_VALUE(    35.09), SIMDE_FLOAT16_VALUE(   -32.00), SIMDE_FLOAT16_VALUE(    35.06) } },
+    { { SIMDE_FLOAT16_VALUE(    29.25), SIMDE_FLOAT16_VALUE(     3.33), SIMDE_FLOAT16_VALUE(    60.56), SIMDE_FLOAT16_VALUE(   -54.62),
+        SIMDE_FLOAT16_VALUE(    76.69), SIMDE_FLOAT16_VALUE(    43.59), SIMDE_FLOAT16_VALUE(   -73.81), SIMDE_FLOAT16_VALUE(   -82.12),
+        SIMDE_FLOAT16_VALUE(    55.62), SIMDE_FLOAT16_VALUE(   -33.81), SIMDE_FLOAT16_VALUE(    80.00), SIMDE_FLOAT16_VALUE(    86.25),
+        SIMDE_FLOAT16_VALUE(   -43.78), SIMDE_FLOAT16_VALUE(    48.03), SIMDE_FLOAT16_VALUE(   -56.47), SIMDE_FLOAT16_VALUE(     0.22),
+        SIMDE_FLOAT16_VALUE(   -62.12), SIMDE_FLOAT16_VALUE(    59.72), SIMDE_FLOAT16_VALUE(   -71.50), SIMDE_FLOAT16_VALUE(    83.75),
+        SIMDE_FLOAT16_VALUE(   -27.66), SIMDE_FLOAT16_VALUE(   -42.88), SIMDE_FLOAT16_VALUE(   -92.06), SIMDE_FLOAT16_VALUE(   -57.81),
+        SIMDE_FLOAT16_VALUE(   -87.38), SIMDE_FLOAT16_VALUE(   -55.56), SIMDE_FLOAT16_VALUE(    95.94), SIMDE_FLOAT16_VALUE(    31.06),
+        SIMDE_FLOAT16_VALUE(   -76.81), SIMDE_FLOAT16_VALUE(   -78.69), SIMDE_FLOAT16_VALUE(    -8.20), SIMDE_FLOAT16_VALUE(    75.25) },
+      { SIMDE_FLOAT16_VALUE(    -9.26), SIMDE_FLOAT16_VALUE(   -28.75), SIMDE_FLOAT16_VALUE(    33.12), SIMDE_FLOAT16_VALUE(   -74.94),
+        SIMDE_FLOAT16_VALUE(   -63.09), SIMDE_FLOAT16_VALUE(     6.28), SIMDE_FLOAT16_VALUE(    66.81), SIMDE_FLOAT16_VALUE(    -7.49),
+        SIMDE_FLOAT16_VALUE(   -42.16), SIMDE_FLOAT16_VALUE(     7.33), SIMDE_FLOAT16_VALUE(    60.25), SIMDE_FLOAT16_VALUE(   -58.56),
+        SIMDE_FLOAT16_VALUE(   -70.06), SIMDE_FLOAT16_VALUE(    -0.27), SIMDE_FLOAT16_VALUE(   -31.84), SIMDE_FLOAT16_VALUE(   -70.88),
+        SIMDE_FLOAT16_VALUE(   -57.59), SIMDE_FLOAT16_VALUE(    72.81), SIMDE_FLOAT16_VALUE(   -59.59), SIMDE_FLOAT16_VALUE(   -32.12),
+        SIMDE_FLOAT16_VALUE(    89.12), SIMDE_FLOAT16_VALUE(   -25.48), SIMDE_FLOAT16_VALUE(    88.25), SIMDE_FLOAT16_VALUE(    67.44),
+        SIMDE_FLOAT16_VALUE(    -4.19), SIMDE_FLOAT16_VALUE(    -7.69), SIMDE_FLOAT16_VALUE(   -96.44), SIMDE_FLOAT16_VALUE(   -22.47),
+        SIMDE_FLOAT16_VALUE(     4.89), SIMDE_FLOAT16_VALUE(    97.44), SIMDE_FLOAT16_VALUE(   -84.69), SIMDE_FLOAT16_VALUE(    64.88) },
+      { SIMDE_FLOAT16_VALUE(    20.00), SIMDE_FLOAT16_VALUE(   -25.42), SIMDE_FLOAT16_VALUE(    93.69), SIMDE_FLOAT16_VALUE(  -129.50),
+        SIMDE_FLOAT16_VALUE(    13.59), SIMDE_FLOAT16_VALUE(    49.88), SIMDE_FLOAT16_VALUE(    -7.00), SIMDE_FLOAT16_VALUE(   -89.62),
+        SIMDE_FLOAT16_VALUE(    13.47), SIMDE_FLOAT16_VALUE(   -26.48), SIMDE_FLOAT16_VALUE(   140.25), SIMDE_FLOAT16_VALUE(    27.69),
+        SIMDE_FLOAT16_VALUE(  -113.88), SIMDE_FLOAT16_VALUE(    47.75), SIMDE_FLOAT16_VALUE(   -88.31), SIMDE_FLOAT16_VALUE(   -70.62),
+        SIMDE_FLOAT16_VALUE(  -119.75), SIMDE_FLOAT16_VALUE(   132.50), SIMDE_FLOAT16_VALUE(  -131.12), SIMDE_FLOAT16_VALUE(    51.62),
+        SIMDE_FLOAT16_VALUE(    61.47), SIMDE_FLOAT16_VALUE(   -68.38), SIMDE_FLOAT16_VALUE(   -3.812), SIMDE_FLOAT16_VALUE(    9.625),
+        SIMDE_FLOAT16_VALUE(   -91.56), SIMDE_FLOAT16_VALUE(   -63.25), SIMDE_FLOAT16_VALUE(    -0.50), SIMDE_FLOAT16_VALUE(     8.59),
+        SIMDE_FLOAT16_VALUE(   -71.94), SIMDE_FLOAT16_VALUE(    18.75), SIMDE_FLOAT16_VALUE(   -92.88), SIMDE_FLOAT16_VALUE(   140.12) } },
+    { { SIMDE_FLOAT16_VALUE(    91.56), SIMDE_FLOAT16_VALUE(    77.06), SIMDE_FLOAT16_VALUE(     3.96), SIMDE_FLOAT16_VALUE(    36.00),
+        SIMDE_FLOAT16_VALUE(   -29.20), SIMDE_FLOAT16_VALUE(   -94.19), SIMDE_FLOAT16_VALUE(   -17.44), SIMDE_FLOAT16_VALUE(    49.06),
+        SIMDE_FLOAT16_VALUE(   -82.38), SIMDE_FLOAT16_VALUE(    -4.22), SIMDE_FLOAT16_VALUE(   -88.06), SIMDE_FLOAT16_VALUE(   -73.19),
+        SIMDE_FLOAT16_VALUE(    68.25), SIMDE_FLOAT16_VALUE(   -92.00), SIMDE_FLOAT16_VALUE(    25.14), SIMDE_FLOAT16_VALUE(   -45.84),
+        SIMDE_FLOAT16_VALUE(   -43.78), SIMDE_FLOAT16_VALUE(    87.69), SIMDE_FLOAT16_VALUE(   -11.42), SIMDE_FLOAT16_VALUE(    12.81),
+        SIMDE_FLOAT16_VALUE(    78.81), SIMDE_FLOAT16_VALUE(    31.31), SIMDE_FLOAT16_VALUE(   -73.94), SIMDE_FLOAT16_VALUE(   -35.84),
+        SIMDE_FLOAT16_VALUE(    65.38), SIMDE_FLOAT16_VALUE(   -38.62), SIMDE_FLOAT16_VALUE(   -78.75), SIMDE_FLOAT16_VALUE(   -39.91),
+        SIMDE_FLOAT16_VALUE(   -43.69), SIMDE_FLOAT16_VALUE(    -3.63), SIMDE_FLOAT16_VALUE(   -70.44), SIMDE_FLOAT16_VALUE(    68.38) },
+      { SIMDE_FLOAT16_VALUE(    96.12), SIMDE_FLOAT16_VALUE(   -59.56), SIMDE_FLOAT16_VALUE(     6.36), SIMDE_FLOAT16_VALUE(   -54.03),
+        SIMDE_FLOAT16_VALUE(    28.00), SIMDE_FLOAT16_VALUE(   -45.78), SIMDE_FLOAT16_VALUE(   -99.75), SIMDE_FLOAT16_VALUE(   -96.75),
+        SIMDE_FLOAT16_VALUE(   -96.25), SIMDE_FLOAT16_VALUE(   -41.47), SIMDE_FLOAT16_VALUE(    43.88), SIMDE_FLOAT16_VALUE(    -3.58),
+        SIMDE_FLOAT16_VALUE(   -25.70), SIMDE_FLOAT16_VALUE(   -67.81), SIMDE_FLOAT16_VALUE(    72.31), SIMDE_FLOAT16_VALUE(    86.81),
+        SIMDE_FLOAT16_VALUE(   -72.50), SIMDE_FLOAT16_VALUE(   -28.59), SIMDE_FLOAT16_VALUE(   -10.92), SIMDE_FLOAT16_VALUE(   -31.19),
+        SIMDE_FLOAT16_VALUE(   -84.81), SIMDE_FLOAT16_VALUE(    49.50), SIMDE_FLOAT16_VALUE(    14.06), SIMDE_FLOAT16_VALUE(   -96.69),
+        SIMDE_FLOAT16_VALUE(   -97.94), SIMDE_FLOAT16_VALUE(    36.34), SIMDE_FLOAT16_VALUE(   -13.19), SIMDE_FLOAT16_VALUE(   -25.59),
+        SIMDE_FLOAT16_VALUE(    69.69), SIMDE_FLOAT16_VALUE(   -94.44), SIMDE_FLOAT16_VALUE(    94.81), SIMDE_FLOAT16_VALUE(    80.19) },
+      { SIMDE_FLOAT16_VALUE(   187.75), SIMDE_FLOAT16_VALUE(    17.50), SIMDE_FLOAT16_VALUE(    10.32), SIMDE_FLOAT16_VALUE(   -18.03),
+        SIMDE_FLOAT16_VALUE(   -1.203), SIMDE_FLOAT16_VALUE(  -140.00), SIMDE_FLOAT16_VALUE(  -117.19), SIMDE_FLOAT16_VALUE(   -47.69),
+        SIMDE_FLOAT16_VALUE(  -178.62), SIMDE_FLOAT16_VALUE(   -45.69), SIMDE_FLOAT16_VALUE(   -44.19), SIMDE_FLOAT16_VALUE(   -76.75),
+        SIMDE_FLOAT16_VALUE(    42.56), SIMDE_FLOAT16_VALUE(  -159.75), SIMDE_FLOAT16_VALUE(    97.44), SIMDE_FLOAT16_VALUE(    40.97),
+        SIMDE_FLOAT16_VALUE(  -116.25), SIMDE_FLOAT16_VALUE(    59.09), SIMDE_FLOAT16_VALUE(   -22.34), SIMDE_FLOAT16_VALUE(   -18.38),
+        SIMDE_FLOAT16_VALUE(    -6.00), SIMDE_FLOAT16_VALUE(    80.81), SIMDE_FLOAT16_VALUE(   -59.88), SIMDE_FLOAT16_VALUE(  -132.50),
+        SIMDE_FLOAT16_VALUE(   -32.56), SIMDE_FLOAT16_VALUE(   -2.281), SIMDE_FLOAT16_VALUE(   -91.94), SIMDE_FLOAT16_VALUE(   -65.50),
+        SIMDE_FLOAT16_VALUE(    26.00), SIMDE_FLOAT16_VALUE(   -98.06), SIMDE_FLOAT16_VALUE(    24.38), SIMDE_FLOAT16_VALUE(   148.50) } },
+    { { SIMDE_FLOAT16_VALUE(    -2.24), SIMDE_FLOAT16_VALUE(   -15.32), SIMDE_FLOAT16_VALUE(   -71.38), SIMDE_FLOAT16_VALUE(    32.75),
+        SIMDE_FLOAT16_VALUE(    11.57), SIMDE_FLOAT16_VALUE(   -29.73), SIMDE_FLOAT16_VALUE(    33.62), SIMDE_FLOAT16_VALUE(   -81.81),
+        SIMDE_FLOAT16_VALUE(   -25.83), SIMDE_FLOAT16_VALUE(    90.19), SIMDE_FLOAT16_VALUE(   -61.81), SIMDE_FLOAT16_VALUE(    98.31),
+        SIMDE_FLOAT16_VALUE(   -29.19), SIMDE_FLOAT16_VALUE(    52.22), SIMDE_FLOAT16_VALUE(    70.06), SIMDE_FLOAT16_VALUE(   -76.12),
+        SIMDE_FLOAT16_VALUE(    83.62), SIMDE_FLOAT16_VALUE(   -66.00), SIMDE_FLOAT16_VALUE(   -45.62), SIMDE_FLOAT16_VALUE(    -5.48),
+        SIMDE_FLOAT16_VALUE(    -6.29), SIMDE_FLOAT16_VALUE(    91.25), SIMDE_FLOAT16_VALUE(   -71.12), SIMDE_FLOAT16_VALUE(    22.48),
+        SIMDE_FLOAT16_VALUE(   -82.81), SIMDE_FLOAT16_VALUE(   -83.81), SIMDE_FLOAT16_VALUE(   -61.28), SIMDE_FLOAT16_VALUE(    28.75),
+        SIMDE_FLOAT16_VALUE(   -32.12), SIMDE_FLOAT16_VALUE(    79.81), SIMDE_FLOAT16_VALUE(    -3.83), SIMDE_FLOAT16_VALUE(    66.31) },
+      { SIMDE_FLOAT16_VALUE(   -76.75), SIMDE_FLOAT16_VALUE(   -24.45), SIMDE_FLOAT16_VALUE(    51.31), SIMDE_FLOAT16_VALUE(    98.62),
+        SIMDE_FLOAT16_VALUE(   -80.12), SIMDE_FLOAT16_VALUE(     6.03), SIMDE_FLOAT16_VALUE(    42.47), SIMDE_FLOAT16_VALUE(    68.44),
+        SIMDE_FLOAT16_VALUE(    52.28), SIMDE_FLOAT16_VALUE(   -19.39), SIMDE_FLOAT16_VALUE(    61.12), SIMDE_FLOAT16_VALUE(    32.69),
+        SIMDE_FLOAT16_VALUE(   -31.23), SIMDE_FLOAT16_VALUE(   -36.72), SIMDE_FLOAT16_VALUE(   -86.94), SIMDE_FLOAT16_VALUE(   -40.25),
+        SIMDE_FLOAT16_VALUE(   -65.38), SIMDE_FLOAT16_VALUE(    78.62), SIMDE_FLOAT16_VALUE(     6.83), SIMDE_FLOAT16_VALUE(    56.19),
+        SIMDE_FLOAT16_VALUE(    71.62), SIMDE_FLOAT16_VALUE(    47.19), SIMDE_FLOAT16_VALUE(   -92.00), SIMDE_FLOAT16_VALUE(    34.75),
+        SIMDE_FLOAT16_VALUE(   -32.06), SIMDE_FLOAT16_VALUE(   -48.44), SIMDE_FLOAT16_VALUE(   -40.12), SIMDE_FLOAT16_VALUE(   -88.31),
+        SIMDE_FLOAT16_VALUE(    83.12), SIMDE_FLOAT16_VALUE(   -77.50), SIMDE_FLOAT16_VALUE(   -53.84), SIMDE_FLOAT16_VALUE(    90.25) },
+      { SIMDE_FLOAT16_VALUE(   -79.00), SIMDE_FLOAT16_VALUE(   -39.78), SIMDE_FLOAT16_VALUE(   -20.06), SIMDE_FLOAT16_VALUE(   131.38),
+        SIMDE_FLOAT16_VALUE(   -68.56), SIMDE_FLOAT16_VALUE(   -23.70), SIMDE_FLOAT16_VALUE(    76.12), SIMDE_FLOAT16_VALUE(  -13.375),
+        SIMDE_FLOAT16_VALUE(    26.45), SIMDE_FLOAT16_VALUE(    70.81), SIMDE_FLOAT16_VALUE(  -0.6875), SIMDE_FLOAT16_VALUE(   131.00),
+        SIMDE_FLOAT16_VALUE(   -60.44), SIMDE_FLOAT16_VALUE(    15.50), SIMDE_FLOAT16_VALUE(   -16.88), SIMDE_FLOAT16_VALUE(  -116.38),
+        SIMDE_FLOAT16_VALUE(    18.25), SIMDE_FLOAT16_VALUE(   12.625), SIMDE_FLOAT16_VALUE(   -38.81), SIMDE_FLOAT16_VALUE(    50.72),
+        SIMDE_FLOAT16_VALUE(    65.31), SIMDE_FLOAT16_VALUE(   138.50), SIMDE_FLOAT16_VALUE(  -163.12), SIMDE_FLOAT16_VALUE(    57.25),
+        SIMDE_FLOAT16_VALUE(  -114.88), SIMDE_FLOAT16_VALUE(  -132.25), SIMDE_FLOAT16_VALUE(  -101.38), SIMDE_FLOAT16_VALUE(   -59.56),
+        SIMDE_FLOAT16_VALUE(    51.00), SIMDE_FLOAT16_VALUE(    2.312), SIMDE_FLOAT16_VALUE(   -57.69), SIMDE_FLOAT16_VALUE(   156.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde_float16 r[32];
+    simde_mm512_storeu_ph(r, simde_mm512_add_ph(a, b));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_add_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_add_epi8)
@@ -3351,6 +3467,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_add_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_add_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_add_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_add_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -2855,6 +2855,197 @@ test_simde_mm_cmp_pd_mask (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_mm512_cmp_ph_mask (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde__mmask32 r;
+  } test_vec[] = {
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    64.25), SIMDE_FLOAT16_VALUE(   -45.25),
+        SIMDE_FLOAT16_VALUE(    68.25), SIMDE_FLOAT16_VALUE(   -69.38), SIMDE_FLOAT16_VALUE(    43.31), SIMDE_FLOAT16_VALUE(   -65.38),
+        SIMDE_FLOAT16_VALUE(    80.94), SIMDE_FLOAT16_VALUE(   -81.75), SIMDE_FLOAT16_VALUE(    19.19), SIMDE_FLOAT16_VALUE(   -69.50),
+        SIMDE_FLOAT16_VALUE(    -9.50), SIMDE_FLOAT16_VALUE(    66.25), SIMDE_FLOAT16_VALUE(    18.56), SIMDE_FLOAT16_VALUE(    42.94),
+        SIMDE_FLOAT16_VALUE(   -48.72), SIMDE_FLOAT16_VALUE(    43.84), SIMDE_FLOAT16_VALUE(    41.06), SIMDE_FLOAT16_VALUE(    10.09),
+        SIMDE_FLOAT16_VALUE(    -6.94), SIMDE_FLOAT16_VALUE(   -14.65), SIMDE_FLOAT16_VALUE(   -66.75), SIMDE_FLOAT16_VALUE(    27.52),
+        SIMDE_FLOAT16_VALUE(    73.94), SIMDE_FLOAT16_VALUE(   -87.75), SIMDE_FLOAT16_VALUE(   -69.62), SIMDE_FLOAT16_VALUE(    88.19),
+        SIMDE_FLOAT16_VALUE(   -82.56), SIMDE_FLOAT16_VALUE(    24.55), SIMDE_FLOAT16_VALUE(    90.00), SIMDE_FLOAT16_VALUE(    18.27) },
+      { SIMDE_FLOAT16_VALUE(    54.22),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -45.25),
+        SIMDE_FLOAT16_VALUE(   -60.75), SIMDE_FLOAT16_VALUE(   -66.31), SIMDE_FLOAT16_VALUE(    43.31), SIMDE_FLOAT16_VALUE(    52.22),
+        SIMDE_FLOAT16_VALUE(   -50.25), SIMDE_FLOAT16_VALUE(   -81.75), SIMDE_FLOAT16_VALUE(   -21.94), SIMDE_FLOAT16_VALUE(   -90.50),
+        SIMDE_FLOAT16_VALUE(    -9.50), SIMDE_FLOAT16_VALUE(   -12.12), SIMDE_FLOAT16_VALUE(    34.34), SIMDE_FLOAT16_VALUE(    42.94),
+        SIMDE_FLOAT16_VALUE(     5.71), SIMDE_FLOAT16_VALUE(   -46.38), SIMDE_FLOAT16_VALUE(    41.06), SIMDE_FLOAT16_VALUE(    28.12),
+        SIMDE_FLOAT16_VALUE(   -88.50), SIMDE_FLOAT16_VALUE(   -14.65), SIMDE_FLOAT16_VALUE(   -78.25), SIMDE_FLOAT16_VALUE(    55.59),
+        SIMDE_FLOAT16_VALUE(    73.94), SIMDE_FLOAT16_VALUE(    77.75), SIMDE_FLOAT16_VALUE(    49.84), SIMDE_FLOAT16_VALUE(    88.19),
+        SIMDE_FLOAT16_VALUE(    45.41), SIMDE_FLOAT16_VALUE(    -5.84), SIMDE_FLOAT16_VALUE(    90.00), SIMDE_FLOAT16_VALUE(   -18.81) },
+      UINT32_C(1227133512) },
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    50.75), SIMDE_FLOAT16_VALUE(   -83.25),
+        SIMDE_FLOAT16_VALUE(   -92.88), SIMDE_FLOAT16_VALUE(    38.31), SIMDE_FLOAT16_VALUE(   -36.22), SIMDE_FLOAT16_VALUE(   -32.75),
+        SIMDE_FLOAT16_VALUE(   -76.88), SIMDE_FLOAT16_VALUE(    34.91), SIMDE_FLOAT16_VALUE(     1.55), SIMDE_FLOAT16_VALUE(   -15.75),
+        SIMDE_FLOAT16_VALUE(   -68.81), SIMDE_FLOAT16_VALUE(   -27.03), SIMDE_FLOAT16_VALUE(   -40.50), SIMDE_FLOAT16_VALUE(    95.31),
+        SIMDE_FLOAT16_VALUE(   -40.97), SIMDE_FLOAT16_VALUE(   -76.25), SIMDE_FLOAT16_VALUE(     3.31), SIMDE_FLOAT16_VALUE(     4.75),
+        SIMDE_FLOAT16_VALUE(   -20.62), SIMDE_FLOAT16_VALUE(    70.00), SIMDE_FLOAT16_VALUE(    12.24), SIMDE_FLOAT16_VALUE(    82.62),
+        SIMDE_FLOAT16_VALUE(    48.53), SIMDE_FLOAT16_VALUE(   -92.12), SIMDE_FLOAT16_VALUE(    92.50), SIMDE_FLOAT16_VALUE(    82.12),
+        SIMDE_FLOAT16_VALUE(   -78.19), SIMDE_FLOAT16_VALUE(   -54.88), SIMDE_FLOAT16_VALUE(    92.75), SIMDE_FLOAT16_VALUE(    13.59) },
+      { SIMDE_FLOAT16_VALUE(   -82.62),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -83.25),
+        SIMDE_FLOAT16_VALUE(   -74.94), SIMDE_FLOAT16_VALUE(    15.86), SIMDE_FLOAT16_VALUE(   -36.22), SIMDE_FLOAT16_VALUE(   -92.75),
+        SIMDE_FLOAT16_VALUE(    52.25), SIMDE_FLOAT16_VALUE(    34.91), SIMDE_FLOAT16_VALUE(   -89.81), SIMDE_FLOAT16_VALUE(    11.33),
+        SIMDE_FLOAT16_VALUE(   -68.81), SIMDE_FLOAT16_VALUE(   -28.08), SIMDE_FLOAT16_VALUE(     1.94), SIMDE_FLOAT16_VALUE(    95.31),
+        SIMDE_FLOAT16_VALUE(    78.75), SIMDE_FLOAT16_VALUE(    53.16), SIMDE_FLOAT16_VALUE(     3.31), SIMDE_FLOAT16_VALUE(    97.06),
+        SIMDE_FLOAT16_VALUE(    76.25), SIMDE_FLOAT16_VALUE(    70.00), SIMDE_FLOAT16_VALUE(    30.03), SIMDE_FLOAT16_VALUE(   -22.70),
+        SIMDE_FLOAT16_VALUE(    48.53), SIMDE_FLOAT16_VALUE(    52.19), SIMDE_FLOAT16_VALUE(    -6.92), SIMDE_FLOAT16_VALUE(    82.12),
+        SIMDE_FLOAT16_VALUE(    29.58), SIMDE_FLOAT16_VALUE(   -99.88), SIMDE_FLOAT16_VALUE(    92.75), SIMDE_FLOAT16_VALUE(    21.58) },
+      UINT32_C(2455456016) },
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -17.59), SIMDE_FLOAT16_VALUE(    79.69),
+        SIMDE_FLOAT16_VALUE(   -73.94), SIMDE_FLOAT16_VALUE(   -11.42), SIMDE_FLOAT16_VALUE(   -31.17), SIMDE_FLOAT16_VALUE(   -23.14),
+        SIMDE_FLOAT16_VALUE(   -28.16), SIMDE_FLOAT16_VALUE(   -12.11), SIMDE_FLOAT16_VALUE(    59.16), SIMDE_FLOAT16_VALUE(    61.50),
+        SIMDE_FLOAT16_VALUE(    29.78), SIMDE_FLOAT16_VALUE(    92.62), SIMDE_FLOAT16_VALUE(    -2.66), SIMDE_FLOAT16_VALUE(    77.75),
+        SIMDE_FLOAT16_VALUE(   -13.52), SIMDE_FLOAT16_VALUE(     2.96), SIMDE_FLOAT16_VALUE(    -6.11), SIMDE_FLOAT16_VALUE(   -66.44),
+        SIMDE_FLOAT16_VALUE(   -16.80), SIMDE_FLOAT16_VALUE(    55.59), SIMDE_FLOAT16_VALUE(    13.35), SIMDE_FLOAT16_VALUE(     1.29),
+        SIMDE_FLOAT16_VALUE(   -72.69), SIMDE_FLOAT16_VALUE(   -31.45), SIMDE_FLOAT16_VALUE(    52.75), SIMDE_FLOAT16_VALUE(    30.72),
+        SIMDE_FLOAT16_VALUE(    67.62), SIMDE_FLOAT16_VALUE(   -60.78), SIMDE_FLOAT16_VALUE(   -71.06), SIMDE_FLOAT16_VALUE(   -96.88) },
+      { SIMDE_FLOAT16_VALUE(   -62.78),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    79.69),
+        SIMDE_FLOAT16_VALUE(    56.84), SIMDE_FLOAT16_VALUE(   -17.92), SIMDE_FLOAT16_VALUE(   -31.17), SIMDE_FLOAT16_VALUE(    71.62),
+        SIMDE_FLOAT16_VALUE(   -56.34), SIMDE_FLOAT16_VALUE(   -12.11), SIMDE_FLOAT16_VALUE(    11.04), SIMDE_FLOAT16_VALUE(   -98.44),
+        SIMDE_FLOAT16_VALUE(    29.78), SIMDE_FLOAT16_VALUE(   -92.81), SIMDE_FLOAT16_VALUE(    30.84), SIMDE_FLOAT16_VALUE(    77.75),
+        SIMDE_FLOAT16_VALUE(   -40.22), SIMDE_FLOAT16_VALUE(   -14.29), SIMDE_FLOAT16_VALUE(    -6.11), SIMDE_FLOAT16_VALUE(   -55.84),
+        SIMDE_FLOAT16_VALUE(   -45.19), SIMDE_FLOAT16_VALUE(    55.59), SIMDE_FLOAT16_VALUE(   -69.81), SIMDE_FLOAT16_VALUE(   -76.12),
+        SIMDE_FLOAT16_VALUE(   -72.69), SIMDE_FLOAT16_VALUE(   -89.19), SIMDE_FLOAT16_VALUE(   -53.47), SIMDE_FLOAT16_VALUE(    30.72),
+        SIMDE_FLOAT16_VALUE(    37.84), SIMDE_FLOAT16_VALUE(    -7.16), SIMDE_FLOAT16_VALUE(   -71.06), SIMDE_FLOAT16_VALUE(    31.30) },
+      UINT32_C(3912028888) },
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -84.88), SIMDE_FLOAT16_VALUE(    44.97),
+        SIMDE_FLOAT16_VALUE(   -64.62), SIMDE_FLOAT16_VALUE(   -16.23), SIMDE_FLOAT16_VALUE(    30.64), SIMDE_FLOAT16_VALUE(    63.34),
+        SIMDE_FLOAT16_VALUE(    48.22), SIMDE_FLOAT16_VALUE(   -38.84), SIMDE_FLOAT16_VALUE(    55.00), SIMDE_FLOAT16_VALUE(     9.01),
+        SIMDE_FLOAT16_VALUE(   -53.53), SIMDE_FLOAT16_VALUE(   -29.59), SIMDE_FLOAT16_VALUE(   -47.62), SIMDE_FLOAT16_VALUE(   -88.44),
+        SIMDE_FLOAT16_VALUE(    59.38), SIMDE_FLOAT16_VALUE(    78.56), SIMDE_FLOAT16_VALUE(    75.75), SIMDE_FLOAT16_VALUE(    59.50),
+        SIMDE_FLOAT16_VALUE(   -41.75), SIMDE_FLOAT16_VALUE(     1.10), SIMDE_FLOAT16_VALUE(   -95.25), SIMDE_FLOAT16_VALUE(   -60.16),
+        SIMDE_FLOAT16_VALUE(    81.94), SIMDE_FLOAT16_VALUE(   -37.41), SIMDE_FLOAT16_VALUE(    30.47), SIMDE_FLOAT16_VALUE(   -64.62),
+        SIMDE_FLOAT16_VALUE(    47.06), SIMDE_FLOAT16_VALUE(   -19.06), SIMDE_FLOAT16_VALUE(    58.72), SIMDE_FLOAT16_VALUE(    48.72) },
+      { SIMDE_FLOAT16_VALUE(    35.84),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    44.97),
+        SIMDE_FLOAT16_VALUE(   -67.44), SIMDE_FLOAT16_VALUE(   -71.38), SIMDE_FLOAT16_VALUE(    30.64), SIMDE_FLOAT16_VALUE(    73.62),
+        SIMDE_FLOAT16_VALUE(   -60.09), SIMDE_FLOAT16_VALUE(   -38.84), SIMDE_FLOAT16_VALUE(   -58.69), SIMDE_FLOAT16_VALUE(   -22.83),
+        SIMDE_FLOAT16_VALUE(   -53.53), SIMDE_FLOAT16_VALUE(    70.62), SIMDE_FLOAT16_VALUE(   -69.06), SIMDE_FLOAT16_VALUE(   -88.44),
+        SIMDE_FLOAT16_VALUE(   -24.88), SIMDE_FLOAT16_VALUE(    60.91), SIMDE_FLOAT16_VALUE(    75.75), SIMDE_FLOAT16_VALUE(    74.38),
+        SIMDE_FLOAT16_VALUE(   -35.06), SIMDE_FLOAT16_VALUE(     1.10), SIMDE_FLOAT16_VALUE(     3.94), SIMDE_FLOAT16_VALUE(   -32.75),
+        SIMDE_FLOAT16_VALUE(    81.94), SIMDE_FLOAT16_VALUE(    58.88), SIMDE_FLOAT16_VALUE(     1.51), SIMDE_FLOAT16_VALUE(   -64.62),
+        SIMDE_FLOAT16_VALUE(    89.50), SIMDE_FLOAT16_VALUE(   -55.97), SIMDE_FLOAT16_VALUE(    58.72), SIMDE_FLOAT16_VALUE(    65.12) },
+      UINT32_C(         7) },
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -27.20), SIMDE_FLOAT16_VALUE(   -32.31),
+        SIMDE_FLOAT16_VALUE(    69.62), SIMDE_FLOAT16_VALUE(    71.19), SIMDE_FLOAT16_VALUE(   -25.44), SIMDE_FLOAT16_VALUE(    51.50),
+        SIMDE_FLOAT16_VALUE(    96.44), SIMDE_FLOAT16_VALUE(     9.55), SIMDE_FLOAT16_VALUE(    -3.15), SIMDE_FLOAT16_VALUE(    45.81),
+        SIMDE_FLOAT16_VALUE(   -85.25), SIMDE_FLOAT16_VALUE(   -72.94), SIMDE_FLOAT16_VALUE(     2.41), SIMDE_FLOAT16_VALUE(    97.31),
+        SIMDE_FLOAT16_VALUE(    -5.65), SIMDE_FLOAT16_VALUE(    72.56), SIMDE_FLOAT16_VALUE(    14.89), SIMDE_FLOAT16_VALUE(    15.17),
+        SIMDE_FLOAT16_VALUE(     2.76), SIMDE_FLOAT16_VALUE(    90.25), SIMDE_FLOAT16_VALUE(    -0.95), SIMDE_FLOAT16_VALUE(    -2.11),
+        SIMDE_FLOAT16_VALUE(   -90.81), SIMDE_FLOAT16_VALUE(    77.81), SIMDE_FLOAT16_VALUE(    19.62), SIMDE_FLOAT16_VALUE(     0.17),
+        SIMDE_FLOAT16_VALUE(    54.72), SIMDE_FLOAT16_VALUE(    14.23), SIMDE_FLOAT16_VALUE(   -28.56), SIMDE_FLOAT16_VALUE(    64.38) },
+      { SIMDE_FLOAT16_VALUE(   -30.36),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(   -32.31),
+        SIMDE_FLOAT16_VALUE(   -28.62), SIMDE_FLOAT16_VALUE(    47.69), SIMDE_FLOAT16_VALUE(   -25.44), SIMDE_FLOAT16_VALUE(   -26.06),
+        SIMDE_FLOAT16_VALUE(    54.16), SIMDE_FLOAT16_VALUE(     9.55), SIMDE_FLOAT16_VALUE(   -80.94), SIMDE_FLOAT16_VALUE(   -16.95),
+        SIMDE_FLOAT16_VALUE(   -85.25), SIMDE_FLOAT16_VALUE(    99.25), SIMDE_FLOAT16_VALUE(   -97.81), SIMDE_FLOAT16_VALUE(    97.31),
+        SIMDE_FLOAT16_VALUE(   -56.59), SIMDE_FLOAT16_VALUE(    69.12), SIMDE_FLOAT16_VALUE(    14.89), SIMDE_FLOAT16_VALUE(   -27.56),
+        SIMDE_FLOAT16_VALUE(    81.06), SIMDE_FLOAT16_VALUE(    90.25), SIMDE_FLOAT16_VALUE(    50.09), SIMDE_FLOAT16_VALUE(    68.38),
+        SIMDE_FLOAT16_VALUE(   -90.81), SIMDE_FLOAT16_VALUE(    -7.21), SIMDE_FLOAT16_VALUE(     5.14), SIMDE_FLOAT16_VALUE(     0.17),
+        SIMDE_FLOAT16_VALUE(   -12.38), SIMDE_FLOAT16_VALUE(    33.22), SIMDE_FLOAT16_VALUE(   -28.56), SIMDE_FLOAT16_VALUE(    -7.86) },
+      UINT32_C(3067833783) },
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    83.62), SIMDE_FLOAT16_VALUE(    25.30),
+        SIMDE_FLOAT16_VALUE(   -36.09), SIMDE_FLOAT16_VALUE(    57.09), SIMDE_FLOAT16_VALUE(   -47.91), SIMDE_FLOAT16_VALUE(    11.35),
+        SIMDE_FLOAT16_VALUE(    73.38), SIMDE_FLOAT16_VALUE(    22.80), SIMDE_FLOAT16_VALUE(    31.70), SIMDE_FLOAT16_VALUE(   -43.97),
+        SIMDE_FLOAT16_VALUE(    98.25), SIMDE_FLOAT16_VALUE(   -75.81), SIMDE_FLOAT16_VALUE(   -29.98), SIMDE_FLOAT16_VALUE(    92.88),
+        SIMDE_FLOAT16_VALUE(   -56.69), SIMDE_FLOAT16_VALUE(   -34.25), SIMDE_FLOAT16_VALUE(    81.12), SIMDE_FLOAT16_VALUE(   -46.16),
+        SIMDE_FLOAT16_VALUE(   -36.88), SIMDE_FLOAT16_VALUE(    45.69), SIMDE_FLOAT16_VALUE(    32.41), SIMDE_FLOAT16_VALUE(    15.02),
+        SIMDE_FLOAT16_VALUE(    12.78), SIMDE_FLOAT16_VALUE(   -41.09), SIMDE_FLOAT16_VALUE(   -84.25), SIMDE_FLOAT16_VALUE(   -89.19),
+        SIMDE_FLOAT16_VALUE(    40.81), SIMDE_FLOAT16_VALUE(    90.25), SIMDE_FLOAT16_VALUE(    63.75), SIMDE_FLOAT16_VALUE(   -27.66) },
+      { SIMDE_FLOAT16_VALUE(    94.75),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    25.30),
+        SIMDE_FLOAT16_VALUE(    58.28), SIMDE_FLOAT16_VALUE(   -84.19), SIMDE_FLOAT16_VALUE(   -47.91), SIMDE_FLOAT16_VALUE(   -65.06),
+        SIMDE_FLOAT16_VALUE(   -75.12), SIMDE_FLOAT16_VALUE(    22.80), SIMDE_FLOAT16_VALUE(    84.50), SIMDE_FLOAT16_VALUE(   -59.12),
+        SIMDE_FLOAT16_VALUE(    98.25), SIMDE_FLOAT16_VALUE(    19.20), SIMDE_FLOAT16_VALUE(   -77.44), SIMDE_FLOAT16_VALUE(    92.88),
+        SIMDE_FLOAT16_VALUE(    21.47), SIMDE_FLOAT16_VALUE(     4.55), SIMDE_FLOAT16_VALUE(    81.12), SIMDE_FLOAT16_VALUE(     7.34),
+        SIMDE_FLOAT16_VALUE(    92.12), SIMDE_FLOAT16_VALUE(    45.69), SIMDE_FLOAT16_VALUE(     8.77), SIMDE_FLOAT16_VALUE(   -31.50),
+        SIMDE_FLOAT16_VALUE(    12.78), SIMDE_FLOAT16_VALUE(   -28.81), SIMDE_FLOAT16_VALUE(   -72.38), SIMDE_FLOAT16_VALUE(   -89.19),
+        SIMDE_FLOAT16_VALUE(    70.06), SIMDE_FLOAT16_VALUE(    68.69), SIMDE_FLOAT16_VALUE(    63.75), SIMDE_FLOAT16_VALUE(   -14.44) },
+      UINT32_C(1776606191) },
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    60.44), SIMDE_FLOAT16_VALUE(    45.09),
+        SIMDE_FLOAT16_VALUE(   -34.62), SIMDE_FLOAT16_VALUE(     3.18), SIMDE_FLOAT16_VALUE(   -10.69), SIMDE_FLOAT16_VALUE(    43.12),
+        SIMDE_FLOAT16_VALUE(   -71.25), SIMDE_FLOAT16_VALUE(   -92.06), SIMDE_FLOAT16_VALUE(   -77.06), SIMDE_FLOAT16_VALUE(    75.62),
+        SIMDE_FLOAT16_VALUE(    39.56), SIMDE_FLOAT16_VALUE(    16.31), SIMDE_FLOAT16_VALUE(    26.45), SIMDE_FLOAT16_VALUE(    12.81),
+        SIMDE_FLOAT16_VALUE(     9.58), SIMDE_FLOAT16_VALUE(    35.84), SIMDE_FLOAT16_VALUE(    99.25), SIMDE_FLOAT16_VALUE(    47.81),
+        SIMDE_FLOAT16_VALUE(   -99.25), SIMDE_FLOAT16_VALUE(    -4.27), SIMDE_FLOAT16_VALUE(    48.00), SIMDE_FLOAT16_VALUE(   -14.85),
+        SIMDE_FLOAT16_VALUE(    30.94), SIMDE_FLOAT16_VALUE(    78.12), SIMDE_FLOAT16_VALUE(   -86.69), SIMDE_FLOAT16_VALUE(   -33.84),
+        SIMDE_FLOAT16_VALUE(    85.75), SIMDE_FLOAT16_VALUE(   -83.94), SIMDE_FLOAT16_VALUE(   -70.44), SIMDE_FLOAT16_VALUE(    35.16) },
+      { SIMDE_FLOAT16_VALUE(   -27.95),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    45.09),
+        SIMDE_FLOAT16_VALUE(    81.00), SIMDE_FLOAT16_VALUE(    99.75), SIMDE_FLOAT16_VALUE(   -10.69), SIMDE_FLOAT16_VALUE(   -18.33),
+        SIMDE_FLOAT16_VALUE(    45.91), SIMDE_FLOAT16_VALUE(   -92.06), SIMDE_FLOAT16_VALUE(   -57.16), SIMDE_FLOAT16_VALUE(    93.75),
+        SIMDE_FLOAT16_VALUE(    39.56), SIMDE_FLOAT16_VALUE(   -58.53), SIMDE_FLOAT16_VALUE(    30.34), SIMDE_FLOAT16_VALUE(    12.81),
+        SIMDE_FLOAT16_VALUE(    43.78), SIMDE_FLOAT16_VALUE(    11.43), SIMDE_FLOAT16_VALUE(    99.25), SIMDE_FLOAT16_VALUE(   -25.16),
+        SIMDE_FLOAT16_VALUE(    90.50), SIMDE_FLOAT16_VALUE(    -4.27), SIMDE_FLOAT16_VALUE(   -36.53), SIMDE_FLOAT16_VALUE(   -55.38),
+        SIMDE_FLOAT16_VALUE(    30.94), SIMDE_FLOAT16_VALUE(    89.31), SIMDE_FLOAT16_VALUE(    71.00), SIMDE_FLOAT16_VALUE(   -33.84),
+        SIMDE_FLOAT16_VALUE(   -97.38), SIMDE_FLOAT16_VALUE(    -7.52), SIMDE_FLOAT16_VALUE(   -70.44), SIMDE_FLOAT16_VALUE(    27.70) },
+      UINT32_C(2429165703) },
+    { {                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(    52.59), SIMDE_FLOAT16_VALUE(     7.99),
+        SIMDE_FLOAT16_VALUE(    13.95), SIMDE_FLOAT16_VALUE(    52.03), SIMDE_FLOAT16_VALUE(   -57.00), SIMDE_FLOAT16_VALUE(    19.89),
+        SIMDE_FLOAT16_VALUE(   -75.25), SIMDE_FLOAT16_VALUE(    29.27), SIMDE_FLOAT16_VALUE(   -16.84), SIMDE_FLOAT16_VALUE(   -33.41),
+        SIMDE_FLOAT16_VALUE(     3.14), SIMDE_FLOAT16_VALUE(     7.08), SIMDE_FLOAT16_VALUE(   -10.29), SIMDE_FLOAT16_VALUE(    32.16),
+        SIMDE_FLOAT16_VALUE(     6.02), SIMDE_FLOAT16_VALUE(    58.34), SIMDE_FLOAT16_VALUE(   -92.44), SIMDE_FLOAT16_VALUE(   -42.41),
+        SIMDE_FLOAT16_VALUE(    70.00), SIMDE_FLOAT16_VALUE(   -11.28), SIMDE_FLOAT16_VALUE(   -48.84), SIMDE_FLOAT16_VALUE(   -42.00),
+        SIMDE_FLOAT16_VALUE(    63.41), SIMDE_FLOAT16_VALUE(    72.56), SIMDE_FLOAT16_VALUE(    49.03), SIMDE_FLOAT16_VALUE(   -25.89),
+        SIMDE_FLOAT16_VALUE(   -55.56), SIMDE_FLOAT16_VALUE(    58.25), SIMDE_FLOAT16_VALUE(   -54.00), SIMDE_FLOAT16_VALUE(    -7.62) },
+      { SIMDE_FLOAT16_VALUE(   -39.59),                SIMDE_NANHF,                SIMDE_NANHF, SIMDE_FLOAT16_VALUE(     7.99),
+        SIMDE_FLOAT16_VALUE(    -9.43), SIMDE_FLOAT16_VALUE(    82.81), SIMDE_FLOAT16_VALUE(   -57.00), SIMDE_FLOAT16_VALUE(   -76.69),
+        SIMDE_FLOAT16_VALUE(    15.42), SIMDE_FLOAT16_VALUE(    29.27), SIMDE_FLOAT16_VALUE(   -37.88), SIMDE_FLOAT16_VALUE(    47.56),
+        SIMDE_FLOAT16_VALUE(     3.14), SIMDE_FLOAT16_VALUE(    46.16), SIMDE_FLOAT16_VALUE(    63.12), SIMDE_FLOAT16_VALUE(    32.16),
+        SIMDE_FLOAT16_VALUE(   -81.56), SIMDE_FLOAT16_VALUE(    60.00), SIMDE_FLOAT16_VALUE(   -92.44), SIMDE_FLOAT16_VALUE(   -77.44),
+        SIMDE_FLOAT16_VALUE(    81.25), SIMDE_FLOAT16_VALUE(   -11.28), SIMDE_FLOAT16_VALUE(   -28.17), SIMDE_FLOAT16_VALUE(    99.69),
+        SIMDE_FLOAT16_VALUE(    63.41), SIMDE_FLOAT16_VALUE(    76.31), SIMDE_FLOAT16_VALUE(    52.31), SIMDE_FLOAT16_VALUE(   -25.89),
+        SIMDE_FLOAT16_VALUE(    70.88), SIMDE_FLOAT16_VALUE(    52.03), SIMDE_FLOAT16_VALUE(   -54.00), SIMDE_FLOAT16_VALUE(    62.91) },
+      UINT32_C(4294967288) }
+  };
+
+  simde__m512h a, b;
+  simde__mmask32 r;
+
+  a = simde_mm512_loadu_ph(test_vec[0].a);
+  b = simde_mm512_loadu_ph(test_vec[0].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_EQ_OQ);
+  simde_assert_equal_mmask32(r, test_vec[0].r);
+
+  a = simde_mm512_loadu_ph(test_vec[1].a);
+  b = simde_mm512_loadu_ph(test_vec[1].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_LT_OS);
+  simde_assert_equal_mmask32(r, test_vec[1].r);
+
+  a = simde_mm512_loadu_ph(test_vec[2].a);
+  b = simde_mm512_loadu_ph(test_vec[2].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_LE_OS);
+  simde_assert_equal_mmask32(r, test_vec[2].r);
+
+  a = simde_mm512_loadu_ph(test_vec[3].a);
+  b = simde_mm512_loadu_ph(test_vec[3].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_UNORD_Q);
+  simde_assert_equal_mmask32(r, test_vec[3].r);
+
+  a = simde_mm512_loadu_ph(test_vec[4].a);
+  b = simde_mm512_loadu_ph(test_vec[4].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_NEQ_UQ);
+  simde_assert_equal_mmask32(r, test_vec[4].r);
+
+  a = simde_mm512_loadu_ph(test_vec[5].a);
+  b = simde_mm512_loadu_ph(test_vec[5].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_NLT_US);
+  simde_assert_equal_mmask32(r, test_vec[5].r);
+
+  a = simde_mm512_loadu_ph(test_vec[6].a);
+  b = simde_mm512_loadu_ph(test_vec[6].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_NLE_US);
+  simde_assert_equal_mmask32(r, test_vec[6].r);
+
+  a = simde_mm512_loadu_ph(test_vec[7].a);
+  b = simde_mm512_loadu_ph(test_vec[7].b);
+  r = simde_mm512_cmp_ph_mask(a, b, SIMDE_CMP_ORD_Q);
+  simde_assert_equal_mmask32(r, test_vec[7].r);
+
+  return 0;
+}
+
 #endif /* !defined(SIMDE_NATIVE_ALIASES_TESTING */
 
 #else
@@ -2880,6 +3071,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
       SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cmp_pd_mask)
       SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cmp_pd_mask)
       SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmp_pd_mask)
+      SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cmp_ph_mask)
     #endif
   #else
     SIMDE_TEST_FUNC_LIST_ENTRY(dummy)
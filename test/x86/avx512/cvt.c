@@ -1067,6 +1067,352 @@ test_simde_mm512_cvtepu32_ps (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_mm_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256) },
+      {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00) } },
+    #endif
+    { { UINT16_C(17361), UINT16_C(50199), UINT16_C(17506), UINT16_C(50269), UINT16_C(50233), UINT16_C(50257), UINT16_C(50219), UINT16_C(50192) },
+      { SIMDE_FLOAT32_C(   418.00), SIMDE_FLOAT32_C(  -604.00), SIMDE_FLOAT32_C(   904.00), SIMDE_FLOAT32_C(  -884.00) } },
+    { { UINT16_C(50232), UINT16_C(17107), UINT16_C(50197), UINT16_C(50184), UINT16_C(50254), UINT16_C(17516), UINT16_C(17509), UINT16_C(17493) },
+      { SIMDE_FLOAT32_C(  -736.00), SIMDE_FLOAT32_C(   105.50), SIMDE_FLOAT32_C(  -596.00), SIMDE_FLOAT32_C(  -544.00) } },
+    { { UINT16_C(17421), UINT16_C(17513), UINT16_C(50008), UINT16_C(49855), UINT16_C(50133), UINT16_C(49772), UINT16_C(49945), UINT16_C(17523) },
+      { SIMDE_FLOAT32_C(   564.00), SIMDE_FLOAT32_C(   932.00), SIMDE_FLOAT32_C(  -216.00), SIMDE_FLOAT32_C(   -95.50) } },
+    { { UINT16_C(50219), UINT16_C(17466), UINT16_C(17226), UINT16_C(49798), UINT16_C(17271), UINT16_C(50296), UINT16_C(50195), UINT16_C(50255) },
+      { SIMDE_FLOAT32_C(  -684.00), SIMDE_FLOAT32_C(   744.00), SIMDE_FLOAT32_C(   202.00), SIMDE_FLOAT32_C(   -67.00) } },
+    { { UINT16_C(50081), UINT16_C(17435), UINT16_C(17513), UINT16_C(17361), UINT16_C(50195), UINT16_C(17512), UINT16_C(50280), UINT16_C(16861) },
+      { SIMDE_FLOAT32_C(  -322.00), SIMDE_FLOAT32_C(   620.00), SIMDE_FLOAT32_C(   932.00), SIMDE_FLOAT32_C(   418.00) } },
+    { { UINT16_C(50053), UINT16_C(17432), UINT16_C(50049), UINT16_C(17285), UINT16_C(17509), UINT16_C(50193), UINT16_C(17414), UINT16_C(49847) },
+      { SIMDE_FLOAT32_C(  -266.00), SIMDE_FLOAT32_C(   608.00), SIMDE_FLOAT32_C(  -258.00), SIMDE_FLOAT32_C(   266.00) } },
+    { { UINT16_C(17497), UINT16_C(17351), UINT16_C(49546), UINT16_C(50228), UINT16_C(17492), UINT16_C(17499), UINT16_C(17218), UINT16_C(50020) },
+      { SIMDE_FLOAT32_C(   868.00), SIMDE_FLOAT32_C(   398.00), SIMDE_FLOAT32_C(   -17.25), SIMDE_FLOAT32_C(  -720.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i tmp = simde_mm_loadu_epi16(test_vec[i].a);
+    simde__m128bh a;
+    simde_memcpy(&a, &tmp, sizeof(a));
+
+    simde__m128 r = simde_mm_cvtpbh_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256) },
+      {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0078125),           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.00) } },
+    #endif
+    { { UINT16_C(50115), UINT16_C(50117), UINT16_C(17498), UINT16_C(49618), UINT16_C(17512), UINT16_C(49926), UINT16_C(49777), UINT16_C(50218) },
+      { SIMDE_FLOAT32_C(  -390.00), SIMDE_FLOAT32_C(  -394.00), SIMDE_FLOAT32_C(   872.00), SIMDE_FLOAT32_C(   -26.25),
+        SIMDE_FLOAT32_C(   928.00), SIMDE_FLOAT32_C(  -134.00), SIMDE_FLOAT32_C(   -60.25), SIMDE_FLOAT32_C(  -680.00) } },
+    { { UINT16_C(17217), UINT16_C(17181), UINT16_C(17277), UINT16_C(17383), UINT16_C(17275), UINT16_C(17443), UINT16_C(17160), UINT16_C(17430) },
+      { SIMDE_FLOAT32_C(   193.00), SIMDE_FLOAT32_C(   157.00), SIMDE_FLOAT32_C(   253.00), SIMDE_FLOAT32_C(   462.00),
+        SIMDE_FLOAT32_C(   251.00), SIMDE_FLOAT32_C(   652.00), SIMDE_FLOAT32_C(   136.00), SIMDE_FLOAT32_C(   600.00) } },
+    { { UINT16_C(50100), UINT16_C(16845), UINT16_C(17414), UINT16_C(17081), UINT16_C(50234), UINT16_C(50235), UINT16_C(49963), UINT16_C(17442) },
+      { SIMDE_FLOAT32_C(  -360.00), SIMDE_FLOAT32_C(   25.625), SIMDE_FLOAT32_C(   536.00), SIMDE_FLOAT32_C(    92.50),
+        SIMDE_FLOAT32_C(  -744.00), SIMDE_FLOAT32_C(  -748.00), SIMDE_FLOAT32_C(  -171.00), SIMDE_FLOAT32_C(   648.00) } },
+    { { UINT16_C(50038), UINT16_C(50040), UINT16_C(16928), UINT16_C(50128), UINT16_C(50170), UINT16_C(50163), UINT16_C(50173), UINT16_C(50175) },
+      { SIMDE_FLOAT32_C(  -246.00), SIMDE_FLOAT32_C(  -248.00), SIMDE_FLOAT32_C(    40.00), SIMDE_FLOAT32_C(  -416.00),
+        SIMDE_FLOAT32_C(  -500.00), SIMDE_FLOAT32_C(  -486.00), SIMDE_FLOAT32_C(  -506.00), SIMDE_FLOAT32_C(  -510.00) } },
+    { { UINT16_C(17483), UINT16_C(50295), UINT16_C(50281), UINT16_C(17414), UINT16_C(16902), UINT16_C(50171), UINT16_C(50289), UINT16_C(17413) },
+      { SIMDE_FLOAT32_C(   812.00), SIMDE_FLOAT32_C(  -988.00), SIMDE_FLOAT32_C(  -932.00), SIMDE_FLOAT32_C(   536.00),
+        SIMDE_FLOAT32_C(    33.50), SIMDE_FLOAT32_C(  -502.00), SIMDE_FLOAT32_C(  -964.00), SIMDE_FLOAT32_C(   532.00) } },
+    { { UINT16_C(50113), UINT16_C(49990), UINT16_C(17437), UINT16_C(17514), UINT16_C(50056), UINT16_C(50181), UINT16_C(50069), UINT16_C(50188) },
+      { SIMDE_FLOAT32_C(  -386.00), SIMDE_FLOAT32_C(  -198.00), SIMDE_FLOAT32_C(   628.00), SIMDE_FLOAT32_C(   936.00),
+        SIMDE_FLOAT32_C(  -272.00), SIMDE_FLOAT32_C(  -532.00), SIMDE_FLOAT32_C(  -298.00), SIMDE_FLOAT32_C(  -560.00) } },
+    { { UINT16_C(17433), UINT16_C(17352), UINT16_C(49343), UINT16_C(17112), UINT16_C(50112), UINT16_C(17393), UINT16_C(17388), UINT16_C(17429) },
+      { SIMDE_FLOAT32_C(   612.00), SIMDE_FLOAT32_C(   400.00), SIMDE_FLOAT32_C( -5.96875), SIMDE_FLOAT32_C(   108.00),
+        SIMDE_FLOAT32_C(  -384.00), SIMDE_FLOAT32_C(   482.00), SIMDE_FLOAT32_C(   472.00), SIMDE_FLOAT32_C(   596.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i tmp = simde_mm_loadu_epi16(test_vec[i].a);
+    simde__m128bh a;
+    simde_memcpy(&a, &tmp, sizeof(a));
+
+    simde__m256 r = simde_mm256_cvtpbh_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint16_t a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256),
+        UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256) },
+      {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0078125),           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.00),
+                   SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0078125),           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.00) } },
+    #endif
+    { { UINT16_C(17334), UINT16_C(50111), UINT16_C(49828), UINT16_C(50220), UINT16_C(16941), UINT16_C(49837), UINT16_C(17489), UINT16_C(17382),
+        UINT16_C(50248), UINT16_C(50184), UINT16_C(17487), UINT16_C(50047), UINT16_C(49999), UINT16_C(17411), UINT16_C(17062), UINT16_C(17524) },
+      { SIMDE_FLOAT32_C(   364.00), SIMDE_FLOAT32_C(  -382.00), SIMDE_FLOAT32_C(   -82.00), SIMDE_FLOAT32_C(  -688.00),
+        SIMDE_FLOAT32_C(    43.25), SIMDE_FLOAT32_C(   -86.50), SIMDE_FLOAT32_C(   836.00), SIMDE_FLOAT32_C(   460.00),
+        SIMDE_FLOAT32_C(  -800.00), SIMDE_FLOAT32_C(  -544.00), SIMDE_FLOAT32_C(   828.00), SIMDE_FLOAT32_C(  -255.00),
+        SIMDE_FLOAT32_C(  -207.00), SIMDE_FLOAT32_C(   524.00), SIMDE_FLOAT32_C(    83.00), SIMDE_FLOAT32_C(   976.00) } },
+    { { UINT16_C(50267), UINT16_C(50085), UINT16_C(17467), UINT16_C(50269), UINT16_C(50293), UINT16_C(17282), UINT16_C(50198), UINT16_C(17249),
+        UINT16_C(50061), UINT16_C(50281), UINT16_C(17504), UINT16_C(49939), UINT16_C(16966), UINT16_C(50062), UINT16_C(49972), UINT16_C(50222) },
+      { SIMDE_FLOAT32_C(  -876.00), SIMDE_FLOAT32_C(  -330.00), SIMDE_FLOAT32_C(   748.00), SIMDE_FLOAT32_C(  -884.00),
+        SIMDE_FLOAT32_C(  -980.00), SIMDE_FLOAT32_C(   260.00), SIMDE_FLOAT32_C(  -600.00), SIMDE_FLOAT32_C(   225.00),
+        SIMDE_FLOAT32_C(  -282.00), SIMDE_FLOAT32_C(  -932.00), SIMDE_FLOAT32_C(   896.00), SIMDE_FLOAT32_C(  -147.00),
+        SIMDE_FLOAT32_C(    49.50), SIMDE_FLOAT32_C(  -284.00), SIMDE_FLOAT32_C(  -180.00), SIMDE_FLOAT32_C(  -696.00) } },
+    { { UINT16_C(50211), UINT16_C(17253), UINT16_C(16986), UINT16_C(50048), UINT16_C(17488), UINT16_C(17416), UINT16_C(50261), UINT16_C(50021),
+        UINT16_C(17423), UINT16_C(17341), UINT16_C(17482), UINT16_C(17418), UINT16_C(17479), UINT16_C(17449), UINT16_C(50178), UINT16_C(17245) },
+      { SIMDE_FLOAT32_C(  -652.00), SIMDE_FLOAT32_C(   229.00), SIMDE_FLOAT32_C(    54.50), SIMDE_FLOAT32_C(  -256.00),
+        SIMDE_FLOAT32_C(   832.00), SIMDE_FLOAT32_C(   544.00), SIMDE_FLOAT32_C(  -852.00), SIMDE_FLOAT32_C(  -229.00),
+        SIMDE_FLOAT32_C(   572.00), SIMDE_FLOAT32_C(   378.00), SIMDE_FLOAT32_C(   808.00), SIMDE_FLOAT32_C(   552.00),
+        SIMDE_FLOAT32_C(   796.00), SIMDE_FLOAT32_C(   676.00), SIMDE_FLOAT32_C(  -520.00), SIMDE_FLOAT32_C(   221.00) } },
+    { { UINT16_C(50264), UINT16_C(17198), UINT16_C(17289), UINT16_C(50237), UINT16_C(17402), UINT16_C(49957), UINT16_C(50102), UINT16_C(17473),
+        UINT16_C(17367), UINT16_C(17325), UINT16_C(17461), UINT16_C(17487), UINT16_C(17421), UINT16_C(50267), UINT16_C(17251), UINT16_C(17172) },
+      { SIMDE_FLOAT32_C(  -864.00), SIMDE_FLOAT32_C(   174.00), SIMDE_FLOAT32_C(   274.00), SIMDE_FLOAT32_C(  -756.00),
+        SIMDE_FLOAT32_C(   500.00), SIMDE_FLOAT32_C(  -165.00), SIMDE_FLOAT32_C(  -364.00), SIMDE_FLOAT32_C(   772.00),
+        SIMDE_FLOAT32_C(   430.00), SIMDE_FLOAT32_C(   346.00), SIMDE_FLOAT32_C(   724.00), SIMDE_FLOAT32_C(   828.00),
+        SIMDE_FLOAT32_C(   564.00), SIMDE_FLOAT32_C(  -876.00), SIMDE_FLOAT32_C(   227.00), SIMDE_FLOAT32_C(   148.00) } },
+    { { UINT16_C(50090), UINT16_C(17518), UINT16_C(50237), UINT16_C(17489), UINT16_C(50164), UINT16_C(50253), UINT16_C(17121), UINT16_C(17312),
+        UINT16_C(49966), UINT16_C(17482), UINT16_C(50291), UINT16_C(50236), UINT16_C(17528), UINT16_C(17437), UINT16_C(50132), UINT16_C(50286) },
+      { SIMDE_FLOAT32_C(  -340.00), SIMDE_FLOAT32_C(   952.00), SIMDE_FLOAT32_C(  -756.00), SIMDE_FLOAT32_C(   836.00),
+        SIMDE_FLOAT32_C(  -488.00), SIMDE_FLOAT32_C(  -820.00), SIMDE_FLOAT32_C(   112.50), SIMDE_FLOAT32_C(   320.00),
+        SIMDE_FLOAT32_C(  -174.00), SIMDE_FLOAT32_C(   808.00), SIMDE_FLOAT32_C(  -972.00), SIMDE_FLOAT32_C(  -752.00),
+        SIMDE_FLOAT32_C(   992.00), SIMDE_FLOAT32_C(   628.00), SIMDE_FLOAT32_C(  -424.00), SIMDE_FLOAT32_C(  -952.00) } },
+    { { UINT16_C(17009), UINT16_C(50172), UINT16_C(50130), UINT16_C(49103), UINT16_C(17436), UINT16_C(17491), UINT16_C(50138), UINT16_C(17461),
+        UINT16_C(49961), UINT16_C(17522), UINT16_C(50216), UINT16_C(50188), UINT16_C(49887), UINT16_C(49887), UINT16_C(49966), UINT16_C(50247) },
+      { SIMDE_FLOAT32_C(    60.25), SIMDE_FLOAT32_C(  -504.00), SIMDE_FLOAT32_C(  -420.00), SIMDE_FLOAT32_C(-1.6171875),
+        SIMDE_FLOAT32_C(   624.00), SIMDE_FLOAT32_C(   844.00), SIMDE_FLOAT32_C(  -436.00), SIMDE_FLOAT32_C(   724.00),
+        SIMDE_FLOAT32_C(  -169.00), SIMDE_FLOAT32_C(   968.00), SIMDE_FLOAT32_C(  -672.00), SIMDE_FLOAT32_C(  -560.00),
+        SIMDE_FLOAT32_C(  -111.50), SIMDE_FLOAT32_C(  -111.50), SIMDE_FLOAT32_C(  -174.00), SIMDE_FLOAT32_C(  -796.00) } },
+    { { UINT16_C(17476), UINT16_C(50254), UINT16_C(50240), UINT16_C(16889), UINT16_C(17446), UINT16_C(17419), UINT16_C(17038), UINT16_C(50167),
+        UINT16_C(17469), UINT16_C(17486), UINT16_C(49713), UINT16_C(17438), UINT16_C(50123), UINT16_C(49855), UINT16_C(49947), UINT16_C(17171) },
+      { SIMDE_FLOAT32_C(   784.00), SIMDE_FLOAT32_C(  -824.00), SIMDE_FLOAT32_C(  -768.00), SIMDE_FLOAT32_C(   31.125),
+        SIMDE_FLOAT32_C(   664.00), SIMDE_FLOAT32_C(   556.00), SIMDE_FLOAT32_C(    71.00), SIMDE_FLOAT32_C(  -494.00),
+        SIMDE_FLOAT32_C(   756.00), SIMDE_FLOAT32_C(   824.00), SIMDE_FLOAT32_C(   -44.25), SIMDE_FLOAT32_C(   632.00),
+        SIMDE_FLOAT32_C(  -406.00), SIMDE_FLOAT32_C(   -95.50), SIMDE_FLOAT32_C(  -155.00), SIMDE_FLOAT32_C(   147.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i tmp = simde_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256bh a;
+    simde_memcpy(&a, &tmp, sizeof(a));
+
+    simde__m512 r = simde_mm512_cvtpbh_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const uint16_t a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(    49.36), SIMDE_FLOAT32_C(   903.32), SIMDE_FLOAT32_C(  -980.96), SIMDE_FLOAT32_C(  -803.13),
+        SIMDE_FLOAT32_C(    41.76), SIMDE_FLOAT32_C(    12.83), SIMDE_FLOAT32_C(  -583.82), SIMDE_FLOAT32_C(   -38.93),
+        SIMDE_FLOAT32_C(  -740.30), SIMDE_FLOAT32_C(  -811.17), SIMDE_FLOAT32_C(   153.17), SIMDE_FLOAT32_C(   429.64),
+        SIMDE_FLOAT32_C(  -775.17), SIMDE_FLOAT32_C(  -331.85), SIMDE_FLOAT32_C(  -815.49), SIMDE_FLOAT32_C(   593.25) },
+      UINT16_C(50429),
+      { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256),
+        UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   903.32),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0078125),           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.00),
+        SIMDE_FLOAT32_C(  -740.30), SIMDE_FLOAT32_C(  -811.17),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   429.64),
+        SIMDE_FLOAT32_C(  -775.17), SIMDE_FLOAT32_C(  -331.85),           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     1.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   351.61), SIMDE_FLOAT32_C(  -934.40), SIMDE_FLOAT32_C(   260.52), SIMDE_FLOAT32_C(  -693.06),
+        SIMDE_FLOAT32_C(   248.06), SIMDE_FLOAT32_C(   495.33), SIMDE_FLOAT32_C(  -810.40), SIMDE_FLOAT32_C(  -223.95),
+        SIMDE_FLOAT32_C(  -145.66), SIMDE_FLOAT32_C(  -297.62), SIMDE_FLOAT32_C(  -761.50), SIMDE_FLOAT32_C(   310.49),
+        SIMDE_FLOAT32_C(   325.40), SIMDE_FLOAT32_C(  -474.62), SIMDE_FLOAT32_C(   312.16), SIMDE_FLOAT32_C(   838.74) },
+      UINT16_C( 9676),
+      { UINT16_C(50212), UINT16_C(17429), UINT16_C(50231), UINT16_C(49903), UINT16_C(17296), UINT16_C(17334), UINT16_C(17134), UINT16_C(17522),
+        UINT16_C(16656), UINT16_C(16990), UINT16_C(50011), UINT16_C(49404), UINT16_C(17338), UINT16_C(50257), UINT16_C(49993), UINT16_C(50144) },
+      { SIMDE_FLOAT32_C(   351.61), SIMDE_FLOAT32_C(  -934.40), SIMDE_FLOAT32_C(  -732.00), SIMDE_FLOAT32_C(  -119.50),
+        SIMDE_FLOAT32_C(   248.06), SIMDE_FLOAT32_C(   495.33), SIMDE_FLOAT32_C(   119.00), SIMDE_FLOAT32_C(   968.00),
+        SIMDE_FLOAT32_C(     9.00), SIMDE_FLOAT32_C(  -297.62), SIMDE_FLOAT32_C(  -219.00), SIMDE_FLOAT32_C(   310.49),
+        SIMDE_FLOAT32_C(   325.40), SIMDE_FLOAT32_C(  -836.00), SIMDE_FLOAT32_C(   312.16), SIMDE_FLOAT32_C(   838.74) } },
+    { { SIMDE_FLOAT32_C(   -41.19), SIMDE_FLOAT32_C(   721.79), SIMDE_FLOAT32_C(    83.37), SIMDE_FLOAT32_C(  -910.81),
+        SIMDE_FLOAT32_C(  -325.13), SIMDE_FLOAT32_C(   125.99), SIMDE_FLOAT32_C(   534.31), SIMDE_FLOAT32_C(   755.32),
+        SIMDE_FLOAT32_C(   263.95), SIMDE_FLOAT32_C(   325.45), SIMDE_FLOAT32_C(    47.28), SIMDE_FLOAT32_C(  -930.64),
+        SIMDE_FLOAT32_C(  -970.10), SIMDE_FLOAT32_C(   584.25), SIMDE_FLOAT32_C(   614.53), SIMDE_FLOAT32_C(   756.30) },
+      UINT16_C(15225),
+      { UINT16_C(50246), UINT16_C(17520), UINT16_C(17342), UINT16_C(17360), UINT16_C(50237), UINT16_C(50224), UINT16_C(16163), UINT16_C(50004),
+        UINT16_C(50052), UINT16_C(17250), UINT16_C(50183), UINT16_C(17409), UINT16_C(50238), UINT16_C(49458), UINT16_C(17469), UINT16_C(50252) },
+      { SIMDE_FLOAT32_C(  -792.00), SIMDE_FLOAT32_C(   721.79), SIMDE_FLOAT32_C(    83.37), SIMDE_FLOAT32_C(   416.00),
+        SIMDE_FLOAT32_C(  -756.00), SIMDE_FLOAT32_C(  -704.00), SIMDE_FLOAT32_C(0.63671875), SIMDE_FLOAT32_C(   755.32),
+        SIMDE_FLOAT32_C(  -264.00), SIMDE_FLOAT32_C(   226.00), SIMDE_FLOAT32_C(    47.28), SIMDE_FLOAT32_C(   516.00),
+        SIMDE_FLOAT32_C(  -760.00), SIMDE_FLOAT32_C(  -11.125), SIMDE_FLOAT32_C(   614.53), SIMDE_FLOAT32_C(   756.30) } },
+    { { SIMDE_FLOAT32_C(   596.35), SIMDE_FLOAT32_C(   145.62), SIMDE_FLOAT32_C(   809.29), SIMDE_FLOAT32_C(  -111.57),
+        SIMDE_FLOAT32_C(   546.17), SIMDE_FLOAT32_C(  -330.35), SIMDE_FLOAT32_C(    87.54), SIMDE_FLOAT32_C(   457.15),
+        SIMDE_FLOAT32_C(   780.27), SIMDE_FLOAT32_C(   843.37), SIMDE_FLOAT32_C(  -739.09), SIMDE_FLOAT32_C(  -783.46),
+        SIMDE_FLOAT32_C(   523.56), SIMDE_FLOAT32_C(  -782.78), SIMDE_FLOAT32_C(   419.85), SIMDE_FLOAT32_C(  -334.47) },
+      UINT16_C(35628),
+      { UINT16_C(50127), UINT16_C(50243), UINT16_C(17513), UINT16_C(17476), UINT16_C(17444), UINT16_C(17417), UINT16_C(17423), UINT16_C(49949),
+        UINT16_C(17472), UINT16_C(17275), UINT16_C(50293), UINT16_C(17519), UINT16_C(50109), UINT16_C(50067), UINT16_C(50141), UINT16_C(50207) },
+      { SIMDE_FLOAT32_C(   596.35), SIMDE_FLOAT32_C(   145.62), SIMDE_FLOAT32_C(   932.00), SIMDE_FLOAT32_C(   784.00),
+        SIMDE_FLOAT32_C(   546.17), SIMDE_FLOAT32_C(   548.00), SIMDE_FLOAT32_C(    87.54), SIMDE_FLOAT32_C(   457.15),
+        SIMDE_FLOAT32_C(   768.00), SIMDE_FLOAT32_C(   251.00), SIMDE_FLOAT32_C(  -739.09), SIMDE_FLOAT32_C(   956.00),
+        SIMDE_FLOAT32_C(   523.56), SIMDE_FLOAT32_C(  -782.78), SIMDE_FLOAT32_C(   419.85), SIMDE_FLOAT32_C(  -636.00) } },
+    { { SIMDE_FLOAT32_C(   304.33), SIMDE_FLOAT32_C(   788.47), SIMDE_FLOAT32_C(   969.79), SIMDE_FLOAT32_C(  -764.61),
+        SIMDE_FLOAT32_C(   649.62), SIMDE_FLOAT32_C(   275.50), SIMDE_FLOAT32_C(  -290.80), SIMDE_FLOAT32_C(   591.58),
+        SIMDE_FLOAT32_C(  -733.28), SIMDE_FLOAT32_C(  -428.47), SIMDE_FLOAT32_C(   985.93), SIMDE_FLOAT32_C(   322.45),
+        SIMDE_FLOAT32_C(   848.84), SIMDE_FLOAT32_C(   645.56), SIMDE_FLOAT32_C(  -759.38), SIMDE_FLOAT32_C(   289.05) },
+      UINT16_C(41788),
+      { UINT16_C(17380), UINT16_C(50231), UINT16_C(16784), UINT16_C(50252), UINT16_C(17142), UINT16_C(50100), UINT16_C(16683), UINT16_C(50163),
+        UINT16_C(17330), UINT16_C(17387), UINT16_C(50210), UINT16_C(50117), UINT16_C(17512), UINT16_C(50026), UINT16_C(50115), UINT16_C(50156) },
+      { SIMDE_FLOAT32_C(   304.33), SIMDE_FLOAT32_C(   788.47), SIMDE_FLOAT32_C(    18.00), SIMDE_FLOAT32_C(  -816.00),
+        SIMDE_FLOAT32_C(   123.00), SIMDE_FLOAT32_C(  -360.00), SIMDE_FLOAT32_C(  -290.80), SIMDE_FLOAT32_C(   591.58),
+        SIMDE_FLOAT32_C(   356.00), SIMDE_FLOAT32_C(   470.00), SIMDE_FLOAT32_C(   985.93), SIMDE_FLOAT32_C(   322.45),
+        SIMDE_FLOAT32_C(   848.84), SIMDE_FLOAT32_C(  -234.00), SIMDE_FLOAT32_C(  -759.38), SIMDE_FLOAT32_C(  -472.00) } },
+    { { SIMDE_FLOAT32_C(   439.52), SIMDE_FLOAT32_C(   330.97), SIMDE_FLOAT32_C(   988.60), SIMDE_FLOAT32_C(  -940.22),
+        SIMDE_FLOAT32_C(   107.57), SIMDE_FLOAT32_C(   810.25), SIMDE_FLOAT32_C(  -278.92), SIMDE_FLOAT32_C(   568.98),
+        SIMDE_FLOAT32_C(   794.00), SIMDE_FLOAT32_C(   101.63), SIMDE_FLOAT32_C(   136.81), SIMDE_FLOAT32_C(   257.71),
+        SIMDE_FLOAT32_C(   140.04), SIMDE_FLOAT32_C(     6.89), SIMDE_FLOAT32_C(  -722.83), SIMDE_FLOAT32_C(   -48.36) },
+      UINT16_C( 2071),
+      { UINT16_C(50182), UINT16_C(17485), UINT16_C(50293), UINT16_C(50293), UINT16_C(50091), UINT16_C(50051), UINT16_C(17359), UINT16_C(49457),
+        UINT16_C(17479), UINT16_C(17184), UINT16_C(17129), UINT16_C(17393), UINT16_C(50014), UINT16_C(17266), UINT16_C(50206), UINT16_C(50195) },
+      { SIMDE_FLOAT32_C(  -536.00), SIMDE_FLOAT32_C(   820.00), SIMDE_FLOAT32_C(  -980.00), SIMDE_FLOAT32_C(  -940.22),
+        SIMDE_FLOAT32_C(  -342.00), SIMDE_FLOAT32_C(   810.25), SIMDE_FLOAT32_C(  -278.92), SIMDE_FLOAT32_C(   568.98),
+        SIMDE_FLOAT32_C(   794.00), SIMDE_FLOAT32_C(   101.63), SIMDE_FLOAT32_C(   136.81), SIMDE_FLOAT32_C(   482.00),
+        SIMDE_FLOAT32_C(   140.04), SIMDE_FLOAT32_C(     6.89), SIMDE_FLOAT32_C(  -722.83), SIMDE_FLOAT32_C(   -48.36) } },
+    { { SIMDE_FLOAT32_C(  -777.17), SIMDE_FLOAT32_C(    74.49), SIMDE_FLOAT32_C(  -602.92), SIMDE_FLOAT32_C(   671.94),
+        SIMDE_FLOAT32_C(  -860.84), SIMDE_FLOAT32_C(   951.27), SIMDE_FLOAT32_C(   505.52), SIMDE_FLOAT32_C(   769.30),
+        SIMDE_FLOAT32_C(   172.33), SIMDE_FLOAT32_C(   205.50), SIMDE_FLOAT32_C(   614.08), SIMDE_FLOAT32_C(  -413.61),
+        SIMDE_FLOAT32_C(  -538.58), SIMDE_FLOAT32_C(   649.42), SIMDE_FLOAT32_C(  -727.64), SIMDE_FLOAT32_C(   632.83) },
+      UINT16_C(41800),
+      { UINT16_C(50237), UINT16_C(17504), UINT16_C(17495), UINT16_C(49733), UINT16_C(50188), UINT16_C(49625), UINT16_C(17387), UINT16_C(50261),
+        UINT16_C(17291), UINT16_C(17430), UINT16_C(17380), UINT16_C(50234), UINT16_C(50074), UINT16_C(17235), UINT16_C(17389), UINT16_C(17124) },
+      { SIMDE_FLOAT32_C(  -777.17), SIMDE_FLOAT32_C(    74.49), SIMDE_FLOAT32_C(  -602.92), SIMDE_FLOAT32_C(   -49.25),
+        SIMDE_FLOAT32_C(  -860.84), SIMDE_FLOAT32_C(   951.27), SIMDE_FLOAT32_C(   470.00), SIMDE_FLOAT32_C(   769.30),
+        SIMDE_FLOAT32_C(   278.00), SIMDE_FLOAT32_C(   600.00), SIMDE_FLOAT32_C(   614.08), SIMDE_FLOAT32_C(  -413.61),
+        SIMDE_FLOAT32_C(  -538.58), SIMDE_FLOAT32_C(   211.00), SIMDE_FLOAT32_C(  -727.64), SIMDE_FLOAT32_C(   114.00) } },
+    { { SIMDE_FLOAT32_C(   -26.05), SIMDE_FLOAT32_C(  -481.57), SIMDE_FLOAT32_C(   224.34), SIMDE_FLOAT32_C(  -446.21),
+        SIMDE_FLOAT32_C(   964.31), SIMDE_FLOAT32_C(   -39.32), SIMDE_FLOAT32_C(  -152.81), SIMDE_FLOAT32_C(  -198.11),
+        SIMDE_FLOAT32_C(   676.40), SIMDE_FLOAT32_C(   234.28), SIMDE_FLOAT32_C(  -882.20), SIMDE_FLOAT32_C(   846.80),
+        SIMDE_FLOAT32_C(   699.92), SIMDE_FLOAT32_C(  -807.27), SIMDE_FLOAT32_C(  -397.21), SIMDE_FLOAT32_C(   411.31) },
+      UINT16_C( 3066),
+      { UINT16_C(17283), UINT16_C(50239), UINT16_C(50101), UINT16_C(50285), UINT16_C(17365), UINT16_C(50191), UINT16_C(50254), UINT16_C(49979),
+        UINT16_C(17234), UINT16_C(17471), UINT16_C(17423), UINT16_C(16705), UINT16_C(16702), UINT16_C(17038), UINT16_C(50264), UINT16_C(17151) },
+      { SIMDE_FLOAT32_C(   -26.05), SIMDE_FLOAT32_C(  -764.00), SIMDE_FLOAT32_C(   224.34), SIMDE_FLOAT32_C(  -948.00),
+        SIMDE_FLOAT32_C(   426.00), SIMDE_FLOAT32_C(  -572.00), SIMDE_FLOAT32_C(  -824.00), SIMDE_FLOAT32_C(  -187.00),
+        SIMDE_FLOAT32_C(   210.00), SIMDE_FLOAT32_C(   764.00), SIMDE_FLOAT32_C(  -882.20), SIMDE_FLOAT32_C(  12.0625),
+        SIMDE_FLOAT32_C(   699.92), SIMDE_FLOAT32_C(  -807.27), SIMDE_FLOAT32_C(  -397.21), SIMDE_FLOAT32_C(   411.31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m256i tmp = simde_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256bh a;
+    simde_memcpy(&a, &tmp, sizeof(a));
+
+    simde__m512 r = simde_mm512_mask_cvtpbh_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_cvtpbh_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const uint16_t a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(33172),
+      { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256),
+        UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16257), UINT16_C(65472), UINT16_C(16256) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     1.00) } },
+    #endif
+    { UINT16_C(30835),
+      { UINT16_C(17262), UINT16_C(50258), UINT16_C(17363), UINT16_C(17516), UINT16_C(17507), UINT16_C(50193), UINT16_C(50215), UINT16_C(17394),
+        UINT16_C(50199), UINT16_C(17513), UINT16_C(50231), UINT16_C(17471), UINT16_C(50286), UINT16_C(17493), UINT16_C(17514), UINT16_C(50198) },
+      { SIMDE_FLOAT32_C(   238.00), SIMDE_FLOAT32_C(  -840.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   908.00), SIMDE_FLOAT32_C(  -580.00), SIMDE_FLOAT32_C(  -668.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   764.00),
+        SIMDE_FLOAT32_C(  -952.00), SIMDE_FLOAT32_C(   852.00), SIMDE_FLOAT32_C(   936.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(54045),
+      { UINT16_C(17431), UINT16_C(49769), UINT16_C(17334), UINT16_C(17519), UINT16_C(17440), UINT16_C(50289), UINT16_C(17320), UINT16_C(17100),
+        UINT16_C(17315), UINT16_C(49671), UINT16_C(16950), UINT16_C(49891), UINT16_C(17460), UINT16_C(17186), UINT16_C(50238), UINT16_C(50265) },
+      { SIMDE_FLOAT32_C(   604.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   364.00), SIMDE_FLOAT32_C(   956.00),
+        SIMDE_FLOAT32_C(   640.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   326.00), SIMDE_FLOAT32_C(   -33.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   720.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -760.00), SIMDE_FLOAT32_C(  -868.00) } },
+    { UINT16_C(63805),
+      { UINT16_C(17361), UINT16_C(16878), UINT16_C(17431), UINT16_C(50278), UINT16_C(17400), UINT16_C(50270), UINT16_C(50063), UINT16_C(49463),
+        UINT16_C(16967), UINT16_C(50016), UINT16_C(50202), UINT16_C(50104), UINT16_C(17525), UINT16_C(17488), UINT16_C(50248), UINT16_C(50108) },
+      { SIMDE_FLOAT32_C(   418.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   604.00), SIMDE_FLOAT32_C(  -920.00),
+        SIMDE_FLOAT32_C(   496.00), SIMDE_FLOAT32_C(  -888.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    49.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -368.00),
+        SIMDE_FLOAT32_C(   980.00), SIMDE_FLOAT32_C(   832.00), SIMDE_FLOAT32_C(  -800.00), SIMDE_FLOAT32_C(  -376.00) } },
+    { UINT16_C(19077),
+      { UINT16_C(50264), UINT16_C(50231), UINT16_C(17427), UINT16_C(17163), UINT16_C(50293), UINT16_C(17491), UINT16_C(17401), UINT16_C(50057),
+        UINT16_C(17499), UINT16_C(17378), UINT16_C(17437), UINT16_C(17512), UINT16_C(17185), UINT16_C(50295), UINT16_C(17517), UINT16_C(49848) },
+      { SIMDE_FLOAT32_C(  -864.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   588.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -274.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   452.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   928.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   948.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(29671),
+      { UINT16_C(17503), UINT16_C(49735), UINT16_C(17403), UINT16_C(17464), UINT16_C(50224), UINT16_C(50158), UINT16_C(49931), UINT16_C(17471),
+        UINT16_C(50189), UINT16_C(17323), UINT16_C(49728), UINT16_C(17220), UINT16_C(17452), UINT16_C(17382), UINT16_C(49933), UINT16_C(50064) },
+      { SIMDE_FLOAT32_C(   892.00), SIMDE_FLOAT32_C(   -49.75), SIMDE_FLOAT32_C(   502.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -476.00), SIMDE_FLOAT32_C(  -139.00), SIMDE_FLOAT32_C(   764.00),
+        SIMDE_FLOAT32_C(  -564.00), SIMDE_FLOAT32_C(   342.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   688.00), SIMDE_FLOAT32_C(   460.00), SIMDE_FLOAT32_C(  -141.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(17376),
+      { UINT16_C(17499), UINT16_C(50230), UINT16_C(49938), UINT16_C(50209), UINT16_C(50263), UINT16_C(17499), UINT16_C(50061), UINT16_C(50162),
+        UINT16_C(17405), UINT16_C(17460), UINT16_C(50122), UINT16_C(50244), UINT16_C(50273), UINT16_C(50202), UINT16_C(17457), UINT16_C(50119) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   876.00), SIMDE_FLOAT32_C(  -282.00), SIMDE_FLOAT32_C(  -484.00),
+        SIMDE_FLOAT32_C(   506.00), SIMDE_FLOAT32_C(   720.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   708.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(57801),
+      { UINT16_C(17081), UINT16_C(50252), UINT16_C(17396), UINT16_C(49596), UINT16_C(17505), UINT16_C(50076), UINT16_C(17290), UINT16_C(17457),
+        UINT16_C(50186), UINT16_C(17347), UINT16_C(50289), UINT16_C(50196), UINT16_C(17219), UINT16_C(17329), UINT16_C(17518), UINT16_C(50009) },
+      { SIMDE_FLOAT32_C(    92.50), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -23.50),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   276.00), SIMDE_FLOAT32_C(   708.00),
+        SIMDE_FLOAT32_C(  -552.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   354.00), SIMDE_FLOAT32_C(   952.00), SIMDE_FLOAT32_C(  -217.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i tmp = simde_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256bh a;
+    simde_memcpy(&a, &tmp, sizeof(a));
+
+    simde__m512 r = simde_mm512_maskz_cvtpbh_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm512_cvtph_ps (SIMDE_MUNIT_TEST_ARGS) {
 #if 1
@@ -1146,6 +1492,131 @@ test_simde_mm512_cvtph_ps (SIMDE_MUNIT_TEST_ARGS) {
 #endif
 }
 
+static int
+test_simde_mm_cvtsbh_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint16_t a;
+    const simde_float32 r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(32640),       SIMDE_MATH_INFINITYF },
+    #endif
+    { UINT16_C(32768), SIMDE_FLOAT32_C(    -0.00) },
+    { UINT16_C(50135), SIMDE_FLOAT32_C(  -430.00) },
+    { UINT16_C(17514), SIMDE_FLOAT32_C(   936.00) },
+    { UINT16_C(17476), SIMDE_FLOAT32_C(   784.00) },
+    { UINT16_C(17330), SIMDE_FLOAT32_C(   356.00) },
+    { UINT16_C(50097), SIMDE_FLOAT32_C(  -354.00) },
+    { UINT16_C(17480), SIMDE_FLOAT32_C(   800.00) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32 r = simde_mm_cvtsbh_ss(simde_uint16_as_bfloat16(test_vec[i].a));
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_cvtxph_ps (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[16];
+    simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(   361.50), SIMDE_FLOAT16_VALUE(   645.00), SIMDE_FLOAT16_VALUE(  -628.00), SIMDE_FLOAT16_VALUE(   825.50),
+        SIMDE_FLOAT16_VALUE(  -715.50), SIMDE_FLOAT16_VALUE(   -97.12), SIMDE_FLOAT16_VALUE(  -491.25), SIMDE_FLOAT16_VALUE(   815.00),
+        SIMDE_FLOAT16_VALUE(  -480.00), SIMDE_FLOAT16_VALUE(   213.38), SIMDE_FLOAT16_VALUE(   -51.91), SIMDE_FLOAT16_VALUE(  -732.50),
+        SIMDE_FLOAT16_VALUE(   335.00), SIMDE_FLOAT16_VALUE(   966.00), SIMDE_FLOAT16_VALUE(  -336.25), SIMDE_FLOAT16_VALUE(  -898.00) },
+      { SIMDE_FLOAT32_C(   361.50), SIMDE_FLOAT32_C(   645.00), SIMDE_FLOAT32_C(  -628.00), SIMDE_FLOAT32_C(   825.50),
+        SIMDE_FLOAT32_C(  -715.50), SIMDE_FLOAT32_C(  -97.125), SIMDE_FLOAT32_C(  -491.25), SIMDE_FLOAT32_C(   815.00),
+        SIMDE_FLOAT32_C(  -480.00), SIMDE_FLOAT32_C(  213.375), SIMDE_FLOAT32_C(-51.90625), SIMDE_FLOAT32_C(  -732.50),
+        SIMDE_FLOAT32_C(   335.00), SIMDE_FLOAT32_C(   966.00), SIMDE_FLOAT32_C(  -336.25), SIMDE_FLOAT32_C(  -898.00) } },
+    { { SIMDE_FLOAT16_VALUE(   574.00), SIMDE_FLOAT16_VALUE(   859.00), SIMDE_FLOAT16_VALUE(    50.34), SIMDE_FLOAT16_VALUE(  -614.00),
+        SIMDE_FLOAT16_VALUE(  -756.00), SIMDE_FLOAT16_VALUE(   980.00), SIMDE_FLOAT16_VALUE(   269.25), SIMDE_FLOAT16_VALUE(   111.69),
+        SIMDE_FLOAT16_VALUE(   364.75), SIMDE_FLOAT16_VALUE(   325.75), SIMDE_FLOAT16_VALUE(   352.25), SIMDE_FLOAT16_VALUE(   648.00),
+        SIMDE_FLOAT16_VALUE(   958.00), SIMDE_FLOAT16_VALUE(  -854.00), SIMDE_FLOAT16_VALUE(   651.00), SIMDE_FLOAT16_VALUE(   539.50) },
+      { SIMDE_FLOAT32_C(   574.00), SIMDE_FLOAT32_C(   859.00), SIMDE_FLOAT32_C( 50.34375), SIMDE_FLOAT32_C(  -614.00),
+        SIMDE_FLOAT32_C(  -756.00), SIMDE_FLOAT32_C(   980.00), SIMDE_FLOAT32_C(   269.25), SIMDE_FLOAT32_C( 111.6875),
+        SIMDE_FLOAT32_C(   364.75), SIMDE_FLOAT32_C(   325.75), SIMDE_FLOAT32_C(   352.25), SIMDE_FLOAT32_C(   648.00),
+        SIMDE_FLOAT32_C(   958.00), SIMDE_FLOAT32_C(  -854.00), SIMDE_FLOAT32_C(   651.00), SIMDE_FLOAT32_C(   539.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -34.62), SIMDE_FLOAT16_VALUE(  -921.50), SIMDE_FLOAT16_VALUE(  -607.00), SIMDE_FLOAT16_VALUE(  -947.50),
+        SIMDE_FLOAT16_VALUE(   508.50), SIMDE_FLOAT16_VALUE(   839.00), SIMDE_FLOAT16_VALUE(   423.25), SIMDE_FLOAT16_VALUE(   430.75),
+        SIMDE_FLOAT16_VALUE(   883.00), SIMDE_FLOAT16_VALUE(   657.00), SIMDE_FLOAT16_VALUE(   808.50), SIMDE_FLOAT16_VALUE(   954.00),
+        SIMDE_FLOAT16_VALUE(   542.00), SIMDE_FLOAT16_VALUE(  -128.75), SIMDE_FLOAT16_VALUE(   248.00), SIMDE_FLOAT16_VALUE(  -631.50) },
+      { SIMDE_FLOAT32_C(  -34.625), SIMDE_FLOAT32_C(  -921.50), SIMDE_FLOAT32_C(  -607.00), SIMDE_FLOAT32_C(  -947.50),
+        SIMDE_FLOAT32_C(   508.50), SIMDE_FLOAT32_C(   839.00), SIMDE_FLOAT32_C(   423.25), SIMDE_FLOAT32_C(   430.75),
+        SIMDE_FLOAT32_C(   883.00), SIMDE_FLOAT32_C(   657.00), SIMDE_FLOAT32_C(   808.50), SIMDE_FLOAT32_C(   954.00),
+        SIMDE_FLOAT32_C(   542.00), SIMDE_FLOAT32_C(  -128.75), SIMDE_FLOAT32_C(   248.00), SIMDE_FLOAT32_C(  -631.50) } },
+    { { SIMDE_FLOAT16_VALUE(  -933.00), SIMDE_FLOAT16_VALUE(   163.75), SIMDE_FLOAT16_VALUE(  -826.50), SIMDE_FLOAT16_VALUE(   338.25),
+        SIMDE_FLOAT16_VALUE(   523.00), SIMDE_FLOAT16_VALUE(  -627.50), SIMDE_FLOAT16_VALUE(  -185.00), SIMDE_FLOAT16_VALUE(  -666.00),
+        SIMDE_FLOAT16_VALUE(   154.88), SIMDE_FLOAT16_VALUE(   850.50), SIMDE_FLOAT16_VALUE(   199.25), SIMDE_FLOAT16_VALUE(  -380.50),
+        SIMDE_FLOAT16_VALUE(   133.75), SIMDE_FLOAT16_VALUE(  -613.50), SIMDE_FLOAT16_VALUE(  -475.00), SIMDE_FLOAT16_VALUE(  -662.50) },
+      { SIMDE_FLOAT32_C(  -933.00), SIMDE_FLOAT32_C(   163.75), SIMDE_FLOAT32_C(  -826.50), SIMDE_FLOAT32_C(   338.25),
+        SIMDE_FLOAT32_C(   523.00), SIMDE_FLOAT32_C(  -627.50), SIMDE_FLOAT32_C(  -185.00), SIMDE_FLOAT32_C(  -666.00),
+        SIMDE_FLOAT32_C(  154.875), SIMDE_FLOAT32_C(   850.50), SIMDE_FLOAT32_C(   199.25), SIMDE_FLOAT32_C(  -380.50),
+        SIMDE_FLOAT32_C(   133.75), SIMDE_FLOAT32_C(  -613.50), SIMDE_FLOAT32_C(  -475.00), SIMDE_FLOAT32_C(  -662.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256h a = simde_mm256_castsi256_ph(simde_mm256_loadu_si256(test_vec[i].a));
+    simde__m512 r = simde_mm512_cvtxph_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_cvtxps_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float32 a[16];
+    simde_float16 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -396.22), SIMDE_FLOAT32_C(  -308.66), SIMDE_FLOAT32_C(   401.59), SIMDE_FLOAT32_C(   982.49),
+        SIMDE_FLOAT32_C(  -723.21), SIMDE_FLOAT32_C(  -113.46), SIMDE_FLOAT32_C(    40.65), SIMDE_FLOAT32_C(   724.83),
+        SIMDE_FLOAT32_C(   761.30), SIMDE_FLOAT32_C(  -686.16), SIMDE_FLOAT32_C(  -610.13), SIMDE_FLOAT32_C(   133.41),
+        SIMDE_FLOAT32_C(   921.62), SIMDE_FLOAT32_C(  -558.66), SIMDE_FLOAT32_C(  -452.23), SIMDE_FLOAT32_C(   196.33) },
+      { SIMDE_FLOAT16_VALUE(  -396.25), SIMDE_FLOAT16_VALUE(  -308.75), SIMDE_FLOAT16_VALUE(   401.50), SIMDE_FLOAT16_VALUE(   982.50),
+        SIMDE_FLOAT16_VALUE(  -723.00), SIMDE_FLOAT16_VALUE(  -113.44), SIMDE_FLOAT16_VALUE(    40.66), SIMDE_FLOAT16_VALUE(   725.00),
+        SIMDE_FLOAT16_VALUE(   761.50), SIMDE_FLOAT16_VALUE(  -686.00), SIMDE_FLOAT16_VALUE(  -610.00), SIMDE_FLOAT16_VALUE(   133.38),
+        SIMDE_FLOAT16_VALUE(   921.50), SIMDE_FLOAT16_VALUE(  -558.50), SIMDE_FLOAT16_VALUE(  -452.25), SIMDE_FLOAT16_VALUE(   196.38) } },
+    { { SIMDE_FLOAT32_C(    38.72), SIMDE_FLOAT32_C(   797.73), SIMDE_FLOAT32_C(  -566.58), SIMDE_FLOAT32_C(   441.35),
+        SIMDE_FLOAT32_C(  -150.13), SIMDE_FLOAT32_C(   173.57), SIMDE_FLOAT32_C(  -717.90), SIMDE_FLOAT32_C(    84.37),
+        SIMDE_FLOAT32_C(  -301.77), SIMDE_FLOAT32_C(   617.09), SIMDE_FLOAT32_C(  -117.96), SIMDE_FLOAT32_C(   795.85),
+        SIMDE_FLOAT32_C(   -62.66), SIMDE_FLOAT32_C(   260.58), SIMDE_FLOAT32_C(   839.07), SIMDE_FLOAT32_C(   881.48) },
+      { SIMDE_FLOAT16_VALUE(    38.72), SIMDE_FLOAT16_VALUE(   797.50), SIMDE_FLOAT16_VALUE(  -566.50), SIMDE_FLOAT16_VALUE(   441.25),
+        SIMDE_FLOAT16_VALUE(  -150.12), SIMDE_FLOAT16_VALUE(   173.62), SIMDE_FLOAT16_VALUE(  -718.00), SIMDE_FLOAT16_VALUE(    84.38),
+        SIMDE_FLOAT16_VALUE(  -301.75), SIMDE_FLOAT16_VALUE(   617.00), SIMDE_FLOAT16_VALUE(  -117.94), SIMDE_FLOAT16_VALUE(   796.00),
+        SIMDE_FLOAT16_VALUE(   -62.66), SIMDE_FLOAT16_VALUE(   260.50), SIMDE_FLOAT16_VALUE(   839.00), SIMDE_FLOAT16_VALUE(   881.50) } },
+    { { SIMDE_FLOAT32_C(    94.98), SIMDE_FLOAT32_C(  -248.07), SIMDE_FLOAT32_C(  -444.65), SIMDE_FLOAT32_C(   150.62),
+        SIMDE_FLOAT32_C(   120.25), SIMDE_FLOAT32_C(  -475.98), SIMDE_FLOAT32_C(    56.14), SIMDE_FLOAT32_C(  -719.64),
+        SIMDE_FLOAT32_C(   867.69), SIMDE_FLOAT32_C(   112.65), SIMDE_FLOAT32_C(  -967.68), SIMDE_FLOAT32_C(  -483.68),
+        SIMDE_FLOAT32_C(  -763.88), SIMDE_FLOAT32_C(   -26.93), SIMDE_FLOAT32_C(  -749.78), SIMDE_FLOAT32_C(   867.91) },
+      { SIMDE_FLOAT16_VALUE(    95.00), SIMDE_FLOAT16_VALUE(  -248.12), SIMDE_FLOAT16_VALUE(  -444.75), SIMDE_FLOAT16_VALUE(   150.62),
+        SIMDE_FLOAT16_VALUE(   120.25), SIMDE_FLOAT16_VALUE(  -476.00), SIMDE_FLOAT16_VALUE(    56.12), SIMDE_FLOAT16_VALUE(  -719.50),
+        SIMDE_FLOAT16_VALUE(   867.50), SIMDE_FLOAT16_VALUE(   112.62), SIMDE_FLOAT16_VALUE(  -967.50), SIMDE_FLOAT16_VALUE(  -483.75),
+        SIMDE_FLOAT16_VALUE(  -764.00), SIMDE_FLOAT16_VALUE(   -26.94), SIMDE_FLOAT16_VALUE(  -750.00), SIMDE_FLOAT16_VALUE(   868.00) } },
+    { { SIMDE_FLOAT32_C(  -898.20), SIMDE_FLOAT32_C(  -615.25), SIMDE_FLOAT32_C(  -108.97), SIMDE_FLOAT32_C(   230.46),
+        SIMDE_FLOAT32_C(  -909.35), SIMDE_FLOAT32_C(   274.45), SIMDE_FLOAT32_C(   -50.40), SIMDE_FLOAT32_C(  -973.39),
+        SIMDE_FLOAT32_C(  -541.44), SIMDE_FLOAT32_C(   849.75), SIMDE_FLOAT32_C(  -315.54), SIMDE_FLOAT32_C(  -721.63),
+        SIMDE_FLOAT32_C(  -741.99), SIMDE_FLOAT32_C(  -962.99), SIMDE_FLOAT32_C(  -277.60), SIMDE_FLOAT32_C(   615.88) },
+      { SIMDE_FLOAT16_VALUE(  -898.00), SIMDE_FLOAT16_VALUE(  -615.00), SIMDE_FLOAT16_VALUE(  -109.00), SIMDE_FLOAT16_VALUE(   230.50),
+        SIMDE_FLOAT16_VALUE(  -909.50), SIMDE_FLOAT16_VALUE(   274.50), SIMDE_FLOAT16_VALUE(   -50.41), SIMDE_FLOAT16_VALUE(  -973.50),
+        SIMDE_FLOAT16_VALUE(  -541.50), SIMDE_FLOAT16_VALUE(   850.00), SIMDE_FLOAT16_VALUE(  -315.50), SIMDE_FLOAT16_VALUE(  -721.50),
+        SIMDE_FLOAT16_VALUE(  -742.00), SIMDE_FLOAT16_VALUE(  -963.00), SIMDE_FLOAT16_VALUE(  -277.50), SIMDE_FLOAT16_VALUE(   616.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float16 r[16];
+    simde_mm256_storeu_si256(r, simde_mm256_castph_si256(simde_mm512_cvtxps_ph(a)));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtepi64_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_cvtepi64_pd)
@@ -1157,7 +1628,15 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepi32_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepi64_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtepu32_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cvtpbh_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_cvtpbh_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtsbh_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtxph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtxps_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,144 @@
+#define SIMDE_TEST_X86_AVX512_INSN cvtmask
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/cvtmask.h>
+
+static int
+test_simde_cvtmask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const unsigned int a;
+    const simde__mmask8 k;
+    const unsigned int r;
+  } test_vec[] = {
+    { UINT32_C(3079455738), UINT8_C(250), UINT32_C(       250) },
+    { UINT32_C(  43807209), UINT8_C(233), UINT32_C(       233) },
+    { UINT32_C( 283241774), UINT8_C( 46), UINT32_C(        46) },
+    { UINT32_C(1562953275), UINT8_C( 59), UINT32_C(        59) },
+    { UINT32_C(2972573204), UINT8_C( 20), UINT32_C(        20) },
+    { UINT32_C(2429814269), UINT8_C(253), UINT32_C(       253) },
+    { UINT32_C( 760937509), UINT8_C( 37), UINT32_C(        37) },
+    { UINT32_C(2477300447), UINT8_C(223), UINT32_C(       223) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 k = simde_cvtu32_mask8(test_vec[i].a);
+    simde_assert_equal_mmask8(k, test_vec[i].k);
+    simde_assert_equal_u32(simde_cvtmask8_u32(k), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtmask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const unsigned int a;
+    const simde__mmask16 k;
+    const unsigned int r;
+  } test_vec[] = {
+    { UINT32_C( 434622323), UINT16_C(53107), UINT32_C(     53107) },
+    { UINT32_C(4045480264), UINT16_C( 8520), UINT32_C(      8520) },
+    { UINT32_C(2524000895), UINT16_C(12927), UINT32_C(     12927) },
+    { UINT32_C(4138306746), UINT16_C(36026), UINT32_C(     36026) },
+    { UINT32_C( 433128629), UINT16_C( 1205), UINT32_C(      1205) },
+    { UINT32_C(1873167079), UINT16_C(17127), UINT32_C(     17127) },
+    { UINT32_C(2370828040), UINT16_C(63240), UINT32_C(     63240) },
+    { UINT32_C(3438997186), UINT16_C(61122), UINT32_C(     61122) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 k = simde_cvtu32_mask16(test_vec[i].a);
+    simde_assert_equal_mmask16(k, test_vec[i].k);
+    simde_assert_equal_u32(simde_cvtmask16_u32(k), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtmask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const unsigned int a;
+    const simde__mmask32 k;
+    const unsigned int r;
+  } test_vec[] = {
+    { UINT32_C(1992835848), UINT32_C(1992835848), UINT32_C(1992835848) },
+    { UINT32_C(3533320672), UINT32_C(3533320672), UINT32_C(3533320672) },
+    { UINT32_C(3616925421), UINT32_C(3616925421), UINT32_C(3616925421) },
+    { UINT32_C(1605510838), UINT32_C(1605510838), UINT32_C(1605510838) },
+    { UINT32_C(3723670822), UINT32_C(3723670822), UINT32_C(3723670822) },
+    { UINT32_C(2711947198), UINT32_C(2711947198), UINT32_C(2711947198) },
+    { UINT32_C(1285092368), UINT32_C(1285092368), UINT32_C(1285092368) },
+    { UINT32_C(3362519458), UINT32_C(3362519458), UINT32_C(3362519458) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 k = simde_cvtu32_mask32(test_vec[i].a);
+    simde_assert_equal_mmask32(k, test_vec[i].k);
+    simde_assert_equal_u32(simde_cvtmask32_u32(k), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtmask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a;
+    const simde__mmask64 k;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(13247512890841483770), UINT64_C(13247512890841483770), UINT64_C(13247512890841483770) },
+    { UINT64_C(17247358051276093724), UINT64_C(17247358051276093724), UINT64_C(17247358051276093724) },
+    { UINT64_C(17874928254363366059), UINT64_C(17874928254363366059), UINT64_C(17874928254363366059) },
+    { UINT64_C( 7373176074156923591), UINT64_C( 7373176074156923591), UINT64_C( 7373176074156923591) },
+    { UINT64_C( 7231559618733959413), UINT64_C( 7231559618733959413), UINT64_C( 7231559618733959413) },
+    { UINT64_C(15259338039439978853), UINT64_C(15259338039439978853), UINT64_C(15259338039439978853) },
+    { UINT64_C(14428537052824976975), UINT64_C(14428537052824976975), UINT64_C(14428537052824976975) },
+    { UINT64_C( 3294814366997139621), UINT64_C( 3294814366997139621), UINT64_C( 3294814366997139621) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 k = simde_cvtu64_mask64(test_vec[i].a);
+    simde_assert_equal_mmask64(k, test_vec[i].k);
+    simde_assert_equal_u64(simde_cvtmask64_u64(k), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_int2mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a;
+    const simde__mmask16 k;
+    const int32_t r;
+  } test_vec[] = {
+    { INT32_C(-1006651629), UINT16_C(46867), INT32_C( 46867) },
+    { INT32_C( 1685082306), UINT16_C(20674), INT32_C( 20674) },
+    { INT32_C( 1938148817), UINT16_C(52689), INT32_C( 52689) },
+    { INT32_C( 1199279154), UINT16_C(35890), INT32_C( 35890) },
+    { INT32_C( 2042959529), UINT16_C( 5801), INT32_C(  5801) },
+    { INT32_C(  830587929), UINT16_C(50201), INT32_C( 50201) },
+    { INT32_C(  -43558704), UINT16_C(22736), INT32_C( 22736) },
+    { INT32_C(-2051925862), UINT16_C( 6298), INT32_C(  6298) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 k = simde_mm512_int2mask(test_vec[i].a);
+    simde_assert_equal_mmask16(k, test_vec[i].k);
+    simde_assert_equal_i32(simde_mm512_mask2int(k), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_int2mask)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,436 @@
+#define SIMDE_TEST_X86_AVX512_INSN cvtne
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/cvtne.h>
+
+static int
+test_simde_mm_cvtness_sbh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a;
+    const uint16_t r;
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    {            SIMDE_MATH_NANF, UINT16_C(32704) },
+    {      -SIMDE_MATH_INFINITYF, UINT16_C(65408) },
+    #endif
+    { SIMDE_FLOAT32_C(  -250.14), UINT16_C(50042) },
+    { SIMDE_FLOAT32_C(  -659.82), UINT16_C(50213) },
+    { SIMDE_FLOAT32_C(  -466.07), UINT16_C(50153) },
+    { SIMDE_FLOAT32_C(   453.19), UINT16_C(17379) },
+    { SIMDE_FLOAT32_C(   925.58), UINT16_C(17511) },
+    { SIMDE_FLOAT32_C(  -553.41), UINT16_C(50186) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_bfloat16 r = simde_mm_cvtness_sbh(test_vec[i].a);
+    simde_assert_equal_u16(simde_bfloat16_as_uint16(r), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00) },
+      { SIMDE_FLOAT32_C(     0.00),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF },
+      { UINT16_C(    0), UINT16_C(32640), UINT16_C(65408), UINT16_C(32704), UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(    56.10), SIMDE_FLOAT32_C(-0.07788086), SIMDE_FLOAT32_C(    72.77), SIMDE_FLOAT32_C(   918.83) },
+      { SIMDE_FLOAT32_C(  -950.84), SIMDE_FLOAT32_C(  -499.60), SIMDE_FLOAT32_C(   787.26), SIMDE_FLOAT32_C(1.3945312) },
+      { UINT16_C(50286), UINT16_C(50170), UINT16_C(17477), UINT16_C(16306), UINT16_C(16992), UINT16_C(48544), UINT16_C(17042), UINT16_C(17510) } },
+    { { SIMDE_FLOAT32_C(   820.20), SIMDE_FLOAT32_C(   273.82), SIMDE_FLOAT32_C(-0.3154297), SIMDE_FLOAT32_C(1.2460938) },
+      { SIMDE_FLOAT32_C(-0.7128906), SIMDE_FLOAT32_C(  -939.68), SIMDE_FLOAT32_C(    50.74), SIMDE_FLOAT32_C(   133.37) },
+      { UINT16_C(48950), UINT16_C(50283), UINT16_C(16971), UINT16_C(17157), UINT16_C(17485), UINT16_C(17289), UINT16_C(48802), UINT16_C(16288) } },
+    { { SIMDE_FLOAT32_C(   808.55), SIMDE_FLOAT32_C(  -558.17), SIMDE_FLOAT32_C(    92.25), SIMDE_FLOAT32_C( -16.6875) },
+      { SIMDE_FLOAT32_C(  -709.29), SIMDE_FLOAT32_C(0.6308594), SIMDE_FLOAT32_C(  -495.59), SIMDE_FLOAT32_C(   545.13) },
+      { UINT16_C(50225), UINT16_C(16162), UINT16_C(50168), UINT16_C(17416), UINT16_C(17482), UINT16_C(50188), UINT16_C(17080), UINT16_C(49542) } },
+    { { SIMDE_FLOAT32_C(    93.22), SIMDE_FLOAT32_C(  -434.37), SIMDE_FLOAT32_C(-0.07397461), SIMDE_FLOAT32_C(  -245.33) },
+      { SIMDE_FLOAT32_C( -17.1875), SIMDE_FLOAT32_C(  -429.55), SIMDE_FLOAT32_C(   546.37), SIMDE_FLOAT32_C(  -181.46) },
+      { UINT16_C(49546), UINT16_C(50135), UINT16_C(17417), UINT16_C(49973), UINT16_C(17082), UINT16_C(50137), UINT16_C(48536), UINT16_C(50037) } },
+    { { SIMDE_FLOAT32_C(  -119.69), SIMDE_FLOAT32_C(   44.875), SIMDE_FLOAT32_C(  -352.04), SIMDE_FLOAT32_C(  -661.86) },
+      { SIMDE_FLOAT32_C(   557.46), SIMDE_FLOAT32_C(0.16357422), SIMDE_FLOAT32_C(  -762.94), SIMDE_FLOAT32_C(-0.09106445) },
+      { UINT16_C(17419), UINT16_C(15912), UINT16_C(50239), UINT16_C(48570), UINT16_C(49903), UINT16_C(16948), UINT16_C(50096), UINT16_C(50213) } },
+    { { SIMDE_FLOAT32_C(  -541.64), SIMDE_FLOAT32_C(  -550.87), SIMDE_FLOAT32_C(  -786.61), SIMDE_FLOAT32_C(   116.35) },
+      { SIMDE_FLOAT32_C(  -313.77), SIMDE_FLOAT32_C(   336.02), SIMDE_FLOAT32_C(-2.7734375), SIMDE_FLOAT32_C(  -444.90) },
+      { UINT16_C(50077), UINT16_C(17320), UINT16_C(49202), UINT16_C(50142), UINT16_C(50183), UINT16_C(50186), UINT16_C(50245), UINT16_C(17129) } },
+    { { SIMDE_FLOAT32_C(  -126.38), SIMDE_FLOAT32_C(  -113.20), SIMDE_FLOAT32_C(   170.85), SIMDE_FLOAT32_C(  21.8125) },
+      { SIMDE_FLOAT32_C(   -83.91), SIMDE_FLOAT32_C(  -499.32), SIMDE_FLOAT32_C(0.17626953), SIMDE_FLOAT32_C(   722.31) },
+      { UINT16_C(49832), UINT16_C(50170), UINT16_C(15924), UINT16_C(17461), UINT16_C(49917), UINT16_C(49890), UINT16_C(17195), UINT16_C(16814) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128bh r = simde_mm_cvtne2ps_pbh(a, b);
+
+    simde__m128i tmp;
+    simde_memcpy(&tmp, &r, sizeof(tmp));
+    simde_test_x86_assert_equal_u16x8(tmp, simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 b[8];
+    const uint16_t r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(1.0117188),           -SIMDE_MATH_NANF },
+      {           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(1.0117188), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(    -0.00),
+        SIMDE_FLOAT32_C(     0.00),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF },
+      { UINT16_C(65472), UINT16_C(16258), UINT16_C(16256), UINT16_C(32768), UINT16_C(    0), UINT16_C(32640), UINT16_C(65408), UINT16_C(32704),
+        UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16256), UINT16_C(16258), UINT16_C(65472) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -389.56), SIMDE_FLOAT32_C(  -684.29), SIMDE_FLOAT32_C(  -924.47), SIMDE_FLOAT32_C(1.3320312),
+        SIMDE_FLOAT32_C(1.0429688), SIMDE_FLOAT32_C(  -865.39), SIMDE_FLOAT32_C(   374.69), SIMDE_FLOAT32_C(   308.65) },
+      { SIMDE_FLOAT32_C(   791.29), SIMDE_FLOAT32_C(  -648.96), SIMDE_FLOAT32_C(   -87.75), SIMDE_FLOAT32_C(   510.87),
+        SIMDE_FLOAT32_C(-0.08959961), SIMDE_FLOAT32_C(  -927.98), SIMDE_FLOAT32_C(   399.85), SIMDE_FLOAT32_C( 10.21875) },
+      { UINT16_C(17478), UINT16_C(50210), UINT16_C(49840), UINT16_C(17407), UINT16_C(48568), UINT16_C(50280), UINT16_C(17352), UINT16_C(16676),
+        UINT16_C(50115), UINT16_C(50219), UINT16_C(50279), UINT16_C(16298), UINT16_C(16262), UINT16_C(50264), UINT16_C(17339), UINT16_C(17306) } },
+    { { SIMDE_FLOAT32_C(   163.35), SIMDE_FLOAT32_C(    54.59), SIMDE_FLOAT32_C(   915.73), SIMDE_FLOAT32_C(  -893.78),
+        SIMDE_FLOAT32_C(   553.40), SIMDE_FLOAT32_C( 5.703125), SIMDE_FLOAT32_C(  -762.12), SIMDE_FLOAT32_C(  -595.96) },
+      { SIMDE_FLOAT32_C(  20.5625), SIMDE_FLOAT32_C(   302.25), SIMDE_FLOAT32_C(  -825.55), SIMDE_FLOAT32_C(  -856.60),
+        SIMDE_FLOAT32_C(  -314.62), SIMDE_FLOAT32_C(   760.18), SIMDE_FLOAT32_C( -20.6875), SIMDE_FLOAT32_C(    24.48) },
+      { UINT16_C(16804), UINT16_C(17303), UINT16_C(50254), UINT16_C(50262), UINT16_C(50077), UINT16_C(17470), UINT16_C(49574), UINT16_C(16836),
+        UINT16_C(17187), UINT16_C(16986), UINT16_C(17509), UINT16_C(50271), UINT16_C(17418), UINT16_C(16566), UINT16_C(50239), UINT16_C(50197) } },
+    { { SIMDE_FLOAT32_C(2.5546875), SIMDE_FLOAT32_C(2.0390625), SIMDE_FLOAT32_C(-2.1171875), SIMDE_FLOAT32_C(    73.75),
+        SIMDE_FLOAT32_C(   518.13), SIMDE_FLOAT32_C(   785.32), SIMDE_FLOAT32_C(  -486.15), SIMDE_FLOAT32_C( -8.34375) },
+      { SIMDE_FLOAT32_C(   711.73), SIMDE_FLOAT32_C(   695.47), SIMDE_FLOAT32_C( 10.28125), SIMDE_FLOAT32_C(  -772.53),
+        SIMDE_FLOAT32_C(   533.04), SIMDE_FLOAT32_C(0.083740234), SIMDE_FLOAT32_C(  -921.10), SIMDE_FLOAT32_C(  -970.34) },
+      { UINT16_C(17458), UINT16_C(17454), UINT16_C(16676), UINT16_C(50241), UINT16_C(17413), UINT16_C(15788), UINT16_C(50278), UINT16_C(50291),
+        UINT16_C(16420), UINT16_C(16386), UINT16_C(49160), UINT16_C(17044), UINT16_C(17410), UINT16_C(17476), UINT16_C(50163), UINT16_C(49414) } },
+    { { SIMDE_FLOAT32_C(   238.33), SIMDE_FLOAT32_C(  -366.52), SIMDE_FLOAT32_C(   -54.30), SIMDE_FLOAT32_C(   358.45),
+        SIMDE_FLOAT32_C(   842.94), SIMDE_FLOAT32_C(    90.75), SIMDE_FLOAT32_C(  -508.36), SIMDE_FLOAT32_C(   501.63) },
+      { SIMDE_FLOAT32_C(    19.67), SIMDE_FLOAT32_C(  -915.01), SIMDE_FLOAT32_C(   582.39), SIMDE_FLOAT32_C(  -888.81),
+        SIMDE_FLOAT32_C(  -741.58), SIMDE_FLOAT32_C(2.7265625), SIMDE_FLOAT32_C(   952.56), SIMDE_FLOAT32_C(   902.52) },
+      { UINT16_C(16797), UINT16_C(50277), UINT16_C(17426), UINT16_C(50270), UINT16_C(50233), UINT16_C(16430), UINT16_C(17518), UINT16_C(17506),
+        UINT16_C(17262), UINT16_C(50103), UINT16_C(49753), UINT16_C(17331), UINT16_C(17491), UINT16_C(17078), UINT16_C(50174), UINT16_C(17403) } },
+    { { SIMDE_FLOAT32_C(   950.87), SIMDE_FLOAT32_C(  -956.04), SIMDE_FLOAT32_C(   710.29), SIMDE_FLOAT32_C(  -995.98),
+        SIMDE_FLOAT32_C(   330.64), SIMDE_FLOAT32_C(2.7890625), SIMDE_FLOAT32_C(-0.7011719), SIMDE_FLOAT32_C(   738.46) },
+      { SIMDE_FLOAT32_C(   860.29), SIMDE_FLOAT32_C(  -721.25), SIMDE_FLOAT32_C(  18.6875), SIMDE_FLOAT32_C(  -539.92),
+        SIMDE_FLOAT32_C(   863.49), SIMDE_FLOAT32_C(  -529.47), SIMDE_FLOAT32_C(  -858.88), SIMDE_FLOAT32_C(   692.80) },
+      { UINT16_C(17495), UINT16_C(50228), UINT16_C(16790), UINT16_C(50183), UINT16_C(17496), UINT16_C(50180), UINT16_C(50263), UINT16_C(17453),
+        UINT16_C(17518), UINT16_C(50287), UINT16_C(17458), UINT16_C(50297), UINT16_C(17317), UINT16_C(16434), UINT16_C(48948), UINT16_C(17465) } },
+    { { SIMDE_FLOAT32_C(0.35058594), SIMDE_FLOAT32_C(   975.43), SIMDE_FLOAT32_C(-4.171875), SIMDE_FLOAT32_C(   -86.25),
+        SIMDE_FLOAT32_C(   355.72), SIMDE_FLOAT32_C(  23.0625), SIMDE_FLOAT32_C(  -198.22), SIMDE_FLOAT32_C(    21.71) },
+      { SIMDE_FLOAT32_C(  -629.93), SIMDE_FLOAT32_C(   478.30), SIMDE_FLOAT32_C(  -270.17), SIMDE_FLOAT32_C( 4.140625),
+        SIMDE_FLOAT32_C(  -496.34), SIMDE_FLOAT32_C(  -964.55), SIMDE_FLOAT32_C(  -128.09), SIMDE_FLOAT32_C(  -756.79) },
+      { UINT16_C(50205), UINT16_C(17391), UINT16_C(50055), UINT16_C(16516), UINT16_C(50168), UINT16_C(50289), UINT16_C(49920), UINT16_C(50237),
+        UINT16_C(16052), UINT16_C(17524), UINT16_C(49286), UINT16_C(49836), UINT16_C(17330), UINT16_C(16824), UINT16_C(49990), UINT16_C(16814) } },
+    { { SIMDE_FLOAT32_C(   674.38), SIMDE_FLOAT32_C(   390.88), SIMDE_FLOAT32_C(   -80.52), SIMDE_FLOAT32_C(   591.17),
+        SIMDE_FLOAT32_C(   273.53), SIMDE_FLOAT32_C(1.0351562), SIMDE_FLOAT32_C(   798.19), SIMDE_FLOAT32_C(  -473.46) },
+      { SIMDE_FLOAT32_C(   38.375), SIMDE_FLOAT32_C(   -37.48), SIMDE_FLOAT32_C(  -613.07), SIMDE_FLOAT32_C(    -7.91),
+        SIMDE_FLOAT32_C(  -426.31), SIMDE_FLOAT32_C(-0.16259766), SIMDE_FLOAT32_C(    60.44), SIMDE_FLOAT32_C(   755.25) },
+      { UINT16_C(16922), UINT16_C(49686), UINT16_C(50201), UINT16_C(49405), UINT16_C(50133), UINT16_C(48678), UINT16_C(17010), UINT16_C(17469),
+        UINT16_C(17449), UINT16_C(17347), UINT16_C(49825), UINT16_C(17428), UINT16_C(17289), UINT16_C(16260), UINT16_C(17480), UINT16_C(50157) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 b = simde_mm256_loadu_ps(test_vec[i].b);
+    simde__m256bh r = simde_mm256_cvtne2ps_pbh(a, b);
+
+    simde__m256i tmp;
+    simde_memcpy(&tmp, &r, sizeof(tmp));
+    simde_test_x86_assert_equal_u16x16(tmp, simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_cvtne2ps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const uint16_t r[32];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(1.0117188),           -SIMDE_MATH_NANF,
+                   SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(1.0117188),           -SIMDE_MATH_NANF },
+      {           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(1.0117188), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(    -0.00),
+        SIMDE_FLOAT32_C(     0.00),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF,
+                  -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(1.0117188), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(    -0.00),
+        SIMDE_FLOAT32_C(     0.00),       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF },
+      { UINT16_C(65472), UINT16_C(16258), UINT16_C(16256), UINT16_C(32768), UINT16_C(    0), UINT16_C(32640), UINT16_C(65408), UINT16_C(32704),
+        UINT16_C(65472), UINT16_C(16258), UINT16_C(16256), UINT16_C(32768), UINT16_C(    0), UINT16_C(32640), UINT16_C(65408), UINT16_C(32704),
+        UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16256), UINT16_C(16258), UINT16_C(65472),
+        UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16256), UINT16_C(16258), UINT16_C(65472) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   334.14), SIMDE_FLOAT32_C(  -209.03), SIMDE_FLOAT32_C(   549.15), SIMDE_FLOAT32_C(   683.34),
+        SIMDE_FLOAT32_C(-0.25878906), SIMDE_FLOAT32_C(  -296.23), SIMDE_FLOAT32_C(   493.50), SIMDE_FLOAT32_C(   736.28),
+        SIMDE_FLOAT32_C(-0.06567383), SIMDE_FLOAT32_C(  -943.02), SIMDE_FLOAT32_C(-0.068603516), SIMDE_FLOAT32_C(-0.5644531),
+        SIMDE_FLOAT32_C(   512.01), SIMDE_FLOAT32_C(   280.10), SIMDE_FLOAT32_C(-5.703125), SIMDE_FLOAT32_C(  -919.63) },
+      { SIMDE_FLOAT32_C(  -198.74), SIMDE_FLOAT32_C(  -774.03), SIMDE_FLOAT32_C(  -933.18), SIMDE_FLOAT32_C(  -741.60),
+        SIMDE_FLOAT32_C(  -572.78), SIMDE_FLOAT32_C( 4.984375), SIMDE_FLOAT32_C(   120.30), SIMDE_FLOAT32_C(  -982.04),
+        SIMDE_FLOAT32_C(  -607.95), SIMDE_FLOAT32_C(  -879.97), SIMDE_FLOAT32_C(  -215.22), SIMDE_FLOAT32_C(0.6582031),
+        SIMDE_FLOAT32_C(  -432.42), SIMDE_FLOAT32_C(   459.45), SIMDE_FLOAT32_C(  -163.30), SIMDE_FLOAT32_C(   508.24) },
+      { UINT16_C(49991), UINT16_C(50242), UINT16_C(50281), UINT16_C(50233), UINT16_C(50191), UINT16_C(16544), UINT16_C(17137), UINT16_C(50294),
+        UINT16_C(50200), UINT16_C(50268), UINT16_C(50007), UINT16_C(16168), UINT16_C(50136), UINT16_C(17382), UINT16_C(49955), UINT16_C(17406),
+        UINT16_C(17319), UINT16_C(50001), UINT16_C(17417), UINT16_C(17451), UINT16_C(48772), UINT16_C(50068), UINT16_C(17399), UINT16_C(17464),
+        UINT16_C(48518), UINT16_C(50284), UINT16_C(48524), UINT16_C(48912), UINT16_C(17408), UINT16_C(17292), UINT16_C(49334), UINT16_C(50278) } },
+    { { SIMDE_FLOAT32_C(   972.18), SIMDE_FLOAT32_C(1.1914062), SIMDE_FLOAT32_C(-0.08959961), SIMDE_FLOAT32_C(    96.10),
+        SIMDE_FLOAT32_C(   583.95), SIMDE_FLOAT32_C(  -653.07), SIMDE_FLOAT32_C(  -289.23), SIMDE_FLOAT32_C(   314.16),
+        SIMDE_FLOAT32_C(   436.08), SIMDE_FLOAT32_C(-0.06665039), SIMDE_FLOAT32_C(  -482.94), SIMDE_FLOAT32_C(  -529.46),
+        SIMDE_FLOAT32_C(  -734.25), SIMDE_FLOAT32_C(   657.13), SIMDE_FLOAT32_C(   417.00), SIMDE_FLOAT32_C(  -803.40) },
+      { SIMDE_FLOAT32_C(  -836.27), SIMDE_FLOAT32_C(0.1274414), SIMDE_FLOAT32_C(-0.17236328), SIMDE_FLOAT32_C(0.17041016),
+        SIMDE_FLOAT32_C(  -118.69), SIMDE_FLOAT32_C(  -713.96), SIMDE_FLOAT32_C(   860.65), SIMDE_FLOAT32_C(  -655.95),
+        SIMDE_FLOAT32_C(   417.67), SIMDE_FLOAT32_C(   845.50), SIMDE_FLOAT32_C(   361.40), SIMDE_FLOAT32_C(  -231.96),
+        SIMDE_FLOAT32_C(-2.6015625), SIMDE_FLOAT32_C(-0.13916016), SIMDE_FLOAT32_C(    15.57), SIMDE_FLOAT32_C(   281.77) },
+      { UINT16_C(50257), UINT16_C(15874), UINT16_C(48688), UINT16_C(15918), UINT16_C(49901), UINT16_C(50226), UINT16_C(17495), UINT16_C(50212),
+        UINT16_C(17361), UINT16_C(17491), UINT16_C(17333), UINT16_C(50024), UINT16_C(49190), UINT16_C(48654), UINT16_C(16761), UINT16_C(17293),
+        UINT16_C(17523), UINT16_C(16280), UINT16_C(48568), UINT16_C(17088), UINT16_C(17426), UINT16_C(50211), UINT16_C(50065), UINT16_C(17309),
+        UINT16_C(17370), UINT16_C(48520), UINT16_C(50161), UINT16_C(50180), UINT16_C(50232), UINT16_C(17444), UINT16_C(17360), UINT16_C(50249) } },
+    { { SIMDE_FLOAT32_C(   428.82), SIMDE_FLOAT32_C(   721.64), SIMDE_FLOAT32_C(   601.13), SIMDE_FLOAT32_C(   697.36),
+        SIMDE_FLOAT32_C(   -53.16), SIMDE_FLOAT32_C(  -509.73), SIMDE_FLOAT32_C(   259.99), SIMDE_FLOAT32_C(   997.58),
+        SIMDE_FLOAT32_C(   307.23), SIMDE_FLOAT32_C(   603.61), SIMDE_FLOAT32_C(   356.39), SIMDE_FLOAT32_C(-0.2529297),
+        SIMDE_FLOAT32_C(   645.45), SIMDE_FLOAT32_C(  -454.60), SIMDE_FLOAT32_C(   249.97), SIMDE_FLOAT32_C(  -599.93) },
+      { SIMDE_FLOAT32_C(   483.18), SIMDE_FLOAT32_C(  -583.91), SIMDE_FLOAT32_C(-0.3330078), SIMDE_FLOAT32_C(  -868.52),
+        SIMDE_FLOAT32_C(   -42.74), SIMDE_FLOAT32_C(  -395.16), SIMDE_FLOAT32_C(   231.11), SIMDE_FLOAT32_C(   -52.88),
+        SIMDE_FLOAT32_C(  -834.81), SIMDE_FLOAT32_C(   947.35), SIMDE_FLOAT32_C(  -336.06), SIMDE_FLOAT32_C(-2.9921875),
+        SIMDE_FLOAT32_C(  -152.66), SIMDE_FLOAT32_C(   971.37), SIMDE_FLOAT32_C(   -74.83), SIMDE_FLOAT32_C(   801.44) },
+      { UINT16_C(17394), UINT16_C(50194), UINT16_C(48810), UINT16_C(50265), UINT16_C(49707), UINT16_C(50118), UINT16_C(17255), UINT16_C(49748),
+        UINT16_C(50257), UINT16_C(17517), UINT16_C(50088), UINT16_C(49216), UINT16_C(49945), UINT16_C(17523), UINT16_C(49814), UINT16_C(17480),
+        UINT16_C(17366), UINT16_C(17460), UINT16_C(17430), UINT16_C(17454), UINT16_C(49749), UINT16_C(50175), UINT16_C(17282), UINT16_C(17529),
+        UINT16_C(17306), UINT16_C(17431), UINT16_C(17330), UINT16_C(48770), UINT16_C(17441), UINT16_C(50147), UINT16_C(17274), UINT16_C(50198) } },
+    { { SIMDE_FLOAT32_C( 5.390625), SIMDE_FLOAT32_C(    13.24), SIMDE_FLOAT32_C(   227.26), SIMDE_FLOAT32_C(    98.77),
+        SIMDE_FLOAT32_C(  -619.05), SIMDE_FLOAT32_C(  -604.18), SIMDE_FLOAT32_C(   380.96), SIMDE_FLOAT32_C(   362.52),
+        SIMDE_FLOAT32_C(   737.24), SIMDE_FLOAT32_C(-0.08325195), SIMDE_FLOAT32_C(-0.5761719), SIMDE_FLOAT32_C(-0.7480469),
+        SIMDE_FLOAT32_C(   759.38), SIMDE_FLOAT32_C(  -949.53), SIMDE_FLOAT32_C(   429.28), SIMDE_FLOAT32_C(  -372.76) },
+      { SIMDE_FLOAT32_C(    95.65), SIMDE_FLOAT32_C(  -442.57), SIMDE_FLOAT32_C( -23.0625), SIMDE_FLOAT32_C(   118.23),
+        SIMDE_FLOAT32_C(-0.06323242), SIMDE_FLOAT32_C(  -41.375), SIMDE_FLOAT32_C( -8.40625), SIMDE_FLOAT32_C(  -162.89),
+        SIMDE_FLOAT32_C(  -377.20), SIMDE_FLOAT32_C( -9.34375), SIMDE_FLOAT32_C(-1.0898438), SIMDE_FLOAT32_C( -9.53125),
+        SIMDE_FLOAT32_C(  -434.94), SIMDE_FLOAT32_C(   481.31), SIMDE_FLOAT32_C(-0.07348633), SIMDE_FLOAT32_C(    61.89) },
+      { UINT16_C(17087), UINT16_C(50141), UINT16_C(49592), UINT16_C(17132), UINT16_C(48514), UINT16_C(49702), UINT16_C(49414), UINT16_C(49955),
+        UINT16_C(50109), UINT16_C(49430), UINT16_C(49036), UINT16_C(49432), UINT16_C(50137), UINT16_C(17393), UINT16_C(48534), UINT16_C(17016),
+        UINT16_C(16556), UINT16_C(16724), UINT16_C(17251), UINT16_C(17094), UINT16_C(50203), UINT16_C(50199), UINT16_C(17342), UINT16_C(17333),
+        UINT16_C(17464), UINT16_C(48554), UINT16_C(48916), UINT16_C(48960), UINT16_C(17470), UINT16_C(50285), UINT16_C(17367), UINT16_C(50106) } },
+    { { SIMDE_FLOAT32_C(  -643.49), SIMDE_FLOAT32_C(   -78.25), SIMDE_FLOAT32_C(-1.1289062), SIMDE_FLOAT32_C(   -40.75),
+        SIMDE_FLOAT32_C(  9.09375), SIMDE_FLOAT32_C(    89.62), SIMDE_FLOAT32_C( 11.59375), SIMDE_FLOAT32_C(  -988.76),
+        SIMDE_FLOAT32_C(   477.13), SIMDE_FLOAT32_C(  -388.00), SIMDE_FLOAT32_C(   854.35), SIMDE_FLOAT32_C(   967.76),
+        SIMDE_FLOAT32_C(  -797.82), SIMDE_FLOAT32_C(   626.57), SIMDE_FLOAT32_C(  -399.91), SIMDE_FLOAT32_C(-0.17138672) },
+      { SIMDE_FLOAT32_C(   -66.58), SIMDE_FLOAT32_C(   980.36), SIMDE_FLOAT32_C(   321.52), SIMDE_FLOAT32_C(   926.70),
+        SIMDE_FLOAT32_C(  -904.19), SIMDE_FLOAT32_C(  -203.36), SIMDE_FLOAT32_C(  -716.49), SIMDE_FLOAT32_C(   844.43),
+        SIMDE_FLOAT32_C(  -463.77), SIMDE_FLOAT32_C(  -314.73), SIMDE_FLOAT32_C(     3.30), SIMDE_FLOAT32_C(   41.125),
+        SIMDE_FLOAT32_C(   469.05), SIMDE_FLOAT32_C(   138.11), SIMDE_FLOAT32_C(   282.35), SIMDE_FLOAT32_C(    61.42) },
+      { UINT16_C(49797), UINT16_C(17525), UINT16_C(17313), UINT16_C(17512), UINT16_C(50274), UINT16_C(49995), UINT16_C(50227), UINT16_C(17491),
+        UINT16_C(50152), UINT16_C(50077), UINT16_C(16467), UINT16_C(16932), UINT16_C(17387), UINT16_C(17162), UINT16_C(17293), UINT16_C(17014),
+        UINT16_C(50209), UINT16_C(49820), UINT16_C(49040), UINT16_C(49699), UINT16_C(16658), UINT16_C(17075), UINT16_C(16698), UINT16_C(50295),
+        UINT16_C(17391), UINT16_C(50114), UINT16_C(17494), UINT16_C(17522), UINT16_C(50247), UINT16_C(17437), UINT16_C(50120), UINT16_C(48688) } },
+    { { SIMDE_FLOAT32_C(   368.35), SIMDE_FLOAT32_C(   966.03), SIMDE_FLOAT32_C(  -321.71), SIMDE_FLOAT32_C(   275.86),
+        SIMDE_FLOAT32_C(   828.44), SIMDE_FLOAT32_C(   143.48), SIMDE_FLOAT32_C(   297.58), SIMDE_FLOAT32_C(   285.64),
+        SIMDE_FLOAT32_C(0.3642578), SIMDE_FLOAT32_C(   710.10), SIMDE_FLOAT32_C(   446.38), SIMDE_FLOAT32_C(  -169.93),
+        SIMDE_FLOAT32_C(   969.20), SIMDE_FLOAT32_C(    -6.76), SIMDE_FLOAT32_C(   837.45), SIMDE_FLOAT32_C(  -592.89) },
+      { SIMDE_FLOAT32_C(  -464.78), SIMDE_FLOAT32_C(   -85.05), SIMDE_FLOAT32_C(-0.1430664), SIMDE_FLOAT32_C(  -650.25),
+        SIMDE_FLOAT32_C(    87.75), SIMDE_FLOAT32_C(  -220.38), SIMDE_FLOAT32_C(-11.34375), SIMDE_FLOAT32_C(  -727.82),
+        SIMDE_FLOAT32_C(   436.31), SIMDE_FLOAT32_C(  -101.12), SIMDE_FLOAT32_C(   380.75), SIMDE_FLOAT32_C(  -158.81),
+        SIMDE_FLOAT32_C(  -42.875), SIMDE_FLOAT32_C(1.3085938), SIMDE_FLOAT32_C(   355.16), SIMDE_FLOAT32_C(   178.22) },
+      { UINT16_C(50152), UINT16_C(49834), UINT16_C(48658), UINT16_C(50211), UINT16_C(17072), UINT16_C(50012), UINT16_C(49462), UINT16_C(50230),
+        UINT16_C(17370), UINT16_C(49866), UINT16_C(17342), UINT16_C(49951), UINT16_C(49708), UINT16_C(16296), UINT16_C(17330), UINT16_C(17202),
+        UINT16_C(17336), UINT16_C(17522), UINT16_C(50081), UINT16_C(17290), UINT16_C(17487), UINT16_C(17167), UINT16_C(17301), UINT16_C(17295),
+        UINT16_C(16058), UINT16_C(17458), UINT16_C(17375), UINT16_C(49962), UINT16_C(17522), UINT16_C(49368), UINT16_C(17489), UINT16_C(50196) } },
+    { { SIMDE_FLOAT32_C(1.0976562), SIMDE_FLOAT32_C(   -83.62), SIMDE_FLOAT32_C(   -45.17), SIMDE_FLOAT32_C(  -922.97),
+        SIMDE_FLOAT32_C(  -666.95), SIMDE_FLOAT32_C(   121.18), SIMDE_FLOAT32_C(  -374.85), SIMDE_FLOAT32_C(  -102.85),
+        SIMDE_FLOAT32_C(   398.51), SIMDE_FLOAT32_C(  -307.85), SIMDE_FLOAT32_C(  -306.50), SIMDE_FLOAT32_C(   656.93),
+        SIMDE_FLOAT32_C(   43.875), SIMDE_FLOAT32_C(  -826.79), SIMDE_FLOAT32_C(  -633.54), SIMDE_FLOAT32_C(  -270.96) },
+      { SIMDE_FLOAT32_C(   744.17), SIMDE_FLOAT32_C(  -585.17), SIMDE_FLOAT32_C(0.27246094), SIMDE_FLOAT32_C(  -325.60),
+        SIMDE_FLOAT32_C(  -997.58), SIMDE_FLOAT32_C(  -458.50), SIMDE_FLOAT32_C(  -217.89), SIMDE_FLOAT32_C(   162.91),
+        SIMDE_FLOAT32_C(   577.73), SIMDE_FLOAT32_C(   -65.75), SIMDE_FLOAT32_C(-5.953125), SIMDE_FLOAT32_C(   599.55),
+        SIMDE_FLOAT32_C(   685.59), SIMDE_FLOAT32_C(  -799.36), SIMDE_FLOAT32_C(  -39.625), SIMDE_FLOAT32_C(    -6.82) },
+      { UINT16_C(17466), UINT16_C(50194), UINT16_C(16012), UINT16_C(50083), UINT16_C(50297), UINT16_C(50149), UINT16_C(50010), UINT16_C(17187),
+        UINT16_C(17424), UINT16_C(49796), UINT16_C(49342), UINT16_C(17430), UINT16_C(17451), UINT16_C(50248), UINT16_C(49694), UINT16_C(49370),
+        UINT16_C(16268), UINT16_C(49831), UINT16_C(49717), UINT16_C(50279), UINT16_C(50215), UINT16_C(17138), UINT16_C(50107), UINT16_C(49870),
+        UINT16_C(17351), UINT16_C(50074), UINT16_C(50073), UINT16_C(17444), UINT16_C(16944), UINT16_C(50255), UINT16_C(50206), UINT16_C(50055) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512bh r = simde_mm512_cvtne2ps_pbh(a, b);
+
+    simde__m512i tmp;
+    simde_memcpy(&tmp, &r, sizeof(tmp));
+    simde_test_x86_assert_equal_u16x32(tmp, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00) },
+      { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    #endif
+    { { SIMDE_FLOAT32_C(1.0351562), SIMDE_FLOAT32_C(   772.30), SIMDE_FLOAT32_C(  -673.44), SIMDE_FLOAT32_C(   -79.25) },
+      { UINT16_C(16260), UINT16_C(17473), UINT16_C(50216), UINT16_C(49822), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -658.24), SIMDE_FLOAT32_C(   -47.42), SIMDE_FLOAT32_C(-1.0507812), SIMDE_FLOAT32_C(  -741.80) },
+      { UINT16_C(50213), UINT16_C(49726), UINT16_C(49030), UINT16_C(50233), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(-11.59375), SIMDE_FLOAT32_C(   770.96), SIMDE_FLOAT32_C(   450.05), SIMDE_FLOAT32_C(-0.079833984) },
+      { UINT16_C(49466), UINT16_C(17473), UINT16_C(17377), UINT16_C(48548), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   -32.94), SIMDE_FLOAT32_C(  -611.24), SIMDE_FLOAT32_C(    96.07), SIMDE_FLOAT32_C(  -745.85) },
+      { UINT16_C(49668), UINT16_C(50201), UINT16_C(17088), UINT16_C(50234), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   -53.86), SIMDE_FLOAT32_C(   739.67), SIMDE_FLOAT32_C(0.07446289), SIMDE_FLOAT32_C(-4.890625) },
+      { UINT16_C(49751), UINT16_C(17465), UINT16_C(15768), UINT16_C(49308), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -704.19), SIMDE_FLOAT32_C(  -566.98), SIMDE_FLOAT32_C(0.5332031), SIMDE_FLOAT32_C(   302.71) },
+      { UINT16_C(50224), UINT16_C(50190), UINT16_C(16136), UINT16_C(17303), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   42.875), SIMDE_FLOAT32_C(   373.51), SIMDE_FLOAT32_C(  -634.08), SIMDE_FLOAT32_C(   312.46) },
+      { UINT16_C(16940), UINT16_C(17339), UINT16_C(50207), UINT16_C(17308), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128bh r = simde_mm_cvtneps_pbh(a);
+
+    simde__m128i tmp;
+    simde_memcpy(&tmp, &r, sizeof(tmp));
+    simde_test_x86_assert_equal_u16x8(tmp, simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const uint16_t r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(1.0117188),           -SIMDE_MATH_NANF },
+      { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16256), UINT16_C(16258), UINT16_C(65472) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  -499.93), SIMDE_FLOAT32_C(   203.93), SIMDE_FLOAT32_C(   883.95), SIMDE_FLOAT32_C(  -427.06),
+        SIMDE_FLOAT32_C(   363.01), SIMDE_FLOAT32_C(  -936.71), SIMDE_FLOAT32_C(  -914.79), SIMDE_FLOAT32_C(  -572.08) },
+      { UINT16_C(50170), UINT16_C(17228), UINT16_C(17501), UINT16_C(50134), UINT16_C(17334), UINT16_C(50282), UINT16_C(50277), UINT16_C(50191) } },
+    { { SIMDE_FLOAT32_C(   169.51), SIMDE_FLOAT32_C(   861.05), SIMDE_FLOAT32_C(  -646.44), SIMDE_FLOAT32_C(  -899.09),
+        SIMDE_FLOAT32_C(   922.47), SIMDE_FLOAT32_C(  -682.93), SIMDE_FLOAT32_C(  -37.875), SIMDE_FLOAT32_C(   766.22) },
+      { UINT16_C(17194), UINT16_C(17495), UINT16_C(50210), UINT16_C(50273), UINT16_C(17511), UINT16_C(50219), UINT16_C(49688), UINT16_C(17472) } },
+    { { SIMDE_FLOAT32_C(   36.125), SIMDE_FLOAT32_C(   825.74), SIMDE_FLOAT32_C(     1.93), SIMDE_FLOAT32_C(-0.08227539),
+        SIMDE_FLOAT32_C(   562.76), SIMDE_FLOAT32_C(  -785.89), SIMDE_FLOAT32_C(   764.57), SIMDE_FLOAT32_C(   812.94) },
+      { UINT16_C(16912), UINT16_C(17486), UINT16_C(16375), UINT16_C(48552), UINT16_C(17421), UINT16_C(50244), UINT16_C(17471), UINT16_C(17483) } },
+    { { SIMDE_FLOAT32_C(  -937.34), SIMDE_FLOAT32_C(  -753.66), SIMDE_FLOAT32_C(-10.96875), SIMDE_FLOAT32_C(  -159.82),
+        SIMDE_FLOAT32_C(   969.67), SIMDE_FLOAT32_C(   526.81), SIMDE_FLOAT32_C(  -425.85), SIMDE_FLOAT32_C(   608.25) },
+      { UINT16_C(50282), UINT16_C(50236), UINT16_C(49456), UINT16_C(49952), UINT16_C(17522), UINT16_C(17412), UINT16_C(50133), UINT16_C(17432) } },
+    { { SIMDE_FLOAT32_C(-0.16552734), SIMDE_FLOAT32_C(-0.3701172), SIMDE_FLOAT32_C(-0.075927734), SIMDE_FLOAT32_C(  -786.92),
+        SIMDE_FLOAT32_C(  -298.30), SIMDE_FLOAT32_C(   358.98), SIMDE_FLOAT32_C(   240.15), SIMDE_FLOAT32_C(   256.57) },
+      { UINT16_C(48682), UINT16_C(48830), UINT16_C(48540), UINT16_C(50245), UINT16_C(50069), UINT16_C(17331), UINT16_C(17264), UINT16_C(17280) } },
+    { { SIMDE_FLOAT32_C(   984.28), SIMDE_FLOAT32_C(   306.50), SIMDE_FLOAT32_C( -19.8125), SIMDE_FLOAT32_C(  -635.09),
+        SIMDE_FLOAT32_C( -19.1875), SIMDE_FLOAT32_C(  -751.85), SIMDE_FLOAT32_C(   858.82), SIMDE_FLOAT32_C(  -586.24) },
+      { UINT16_C(17526), UINT16_C(17305), UINT16_C(49566), UINT16_C(50207), UINT16_C(49562), UINT16_C(50236), UINT16_C(17495), UINT16_C(50195) } },
+    { { SIMDE_FLOAT32_C(   885.06), SIMDE_FLOAT32_C(    94.47), SIMDE_FLOAT32_C(  19.5625), SIMDE_FLOAT32_C(0.16357422),
+        SIMDE_FLOAT32_C(  -777.91), SIMDE_FLOAT32_C(  -143.02), SIMDE_FLOAT32_C(  -134.25), SIMDE_FLOAT32_C(  -532.88) },
+      { UINT16_C(17501), UINT16_C(17085), UINT16_C(16796), UINT16_C(15912), UINT16_C(50242), UINT16_C(49935), UINT16_C(49926), UINT16_C(50181) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m128bh r = simde_mm256_cvtneps_pbh(a);
+
+    simde__m128i tmp;
+    simde_memcpy(&tmp, &r, sizeof(tmp));
+    simde_test_x86_assert_equal_u16x8(tmp, simde_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_cvtneps_pbh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const uint16_t r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { {            SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(1.0117188),           -SIMDE_MATH_NANF,
+                   SIMDE_MATH_NANF,      -SIMDE_MATH_INFINITYF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(    -0.00), SIMDE_FLOAT32_C(1.0039062), SIMDE_FLOAT32_C(1.0117188),           -SIMDE_MATH_NANF },
+      { UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16256), UINT16_C(16258), UINT16_C(65472),
+        UINT16_C(32704), UINT16_C(65408), UINT16_C(32640), UINT16_C(    0), UINT16_C(32768), UINT16_C(16256), UINT16_C(16258), UINT16_C(65472) } },
+    #endif
+    { { SIMDE_FLOAT32_C(-0.07739258), SIMDE_FLOAT32_C(   762.81), SIMDE_FLOAT32_C(   381.07), SIMDE_FLOAT32_C(   992.17),
+        SIMDE_FLOAT32_C( 11.03125), SIMDE_FLOAT32_C(   161.18), SIMDE_FLOAT32_C(   -72.25), SIMDE_FLOAT32_C(  -945.08),
+        SIMDE_FLOAT32_C(  -608.22), SIMDE_FLOAT32_C(  -789.80), SIMDE_FLOAT32_C(   626.29), SIMDE_FLOAT32_C(  -414.71),
+        SIMDE_FLOAT32_C(     3.73), SIMDE_FLOAT32_C(  -862.56), SIMDE_FLOAT32_C(  -153.06), SIMDE_FLOAT32_C(  -465.49) },
+      { UINT16_C(48542), UINT16_C(17471), UINT16_C(17343), UINT16_C(17528), UINT16_C(16688), UINT16_C(17185), UINT16_C(49808), UINT16_C(50284),
+        UINT16_C(50200), UINT16_C(50245), UINT16_C(17437), UINT16_C(50127), UINT16_C(16495), UINT16_C(50264), UINT16_C(49945), UINT16_C(50153) } },
+    { { SIMDE_FLOAT32_C(  -831.95), SIMDE_FLOAT32_C(  -859.64), SIMDE_FLOAT32_C(   250.92), SIMDE_FLOAT32_C(    47.52),
+        SIMDE_FLOAT32_C(  -527.55), SIMDE_FLOAT32_C(   612.43), SIMDE_FLOAT32_C(   -82.81), SIMDE_FLOAT32_C(  -973.14),
+        SIMDE_FLOAT32_C(   410.17), SIMDE_FLOAT32_C( -9.71875), SIMDE_FLOAT32_C(   316.11), SIMDE_FLOAT32_C(  -41.625),
+        SIMDE_FLOAT32_C(   -70.91), SIMDE_FLOAT32_C(   336.73), SIMDE_FLOAT32_C(   396.93), SIMDE_FLOAT32_C(   -93.54) },
+      { UINT16_C(50256), UINT16_C(50263), UINT16_C(17275), UINT16_C(16958), UINT16_C(50180), UINT16_C(17433), UINT16_C(49830), UINT16_C(50291),
+        UINT16_C(17357), UINT16_C(49436), UINT16_C(17310), UINT16_C(49702), UINT16_C(49806), UINT16_C(17320), UINT16_C(17350), UINT16_C(49851) } },
+    { { SIMDE_FLOAT32_C(  -239.97), SIMDE_FLOAT32_C(   282.77), SIMDE_FLOAT32_C(   932.41), SIMDE_FLOAT32_C(-1.0820312),
+        SIMDE_FLOAT32_C(   122.93), SIMDE_FLOAT32_C(   102.41), SIMDE_FLOAT32_C(-2.6796875), SIMDE_FLOAT32_C(   375.43),
+        SIMDE_FLOAT32_C(   824.39), SIMDE_FLOAT32_C(    97.37), SIMDE_FLOAT32_C(  -791.82), SIMDE_FLOAT32_C(  -146.06),
+        SIMDE_FLOAT32_C(   911.93), SIMDE_FLOAT32_C(  -109.36), SIMDE_FLOAT32_C(0.07788086), SIMDE_FLOAT32_C(-0.6425781) },
+      { UINT16_C(50032), UINT16_C(17293), UINT16_C(17513), UINT16_C(49034), UINT16_C(17142), UINT16_C(17101), UINT16_C(49196), UINT16_C(17340),
+        UINT16_C(17486), UINT16_C(17091), UINT16_C(50246), UINT16_C(49938), UINT16_C(17508), UINT16_C(49883), UINT16_C(15776), UINT16_C(48932) } },
+    { { SIMDE_FLOAT32_C(   922.84), SIMDE_FLOAT32_C(-4.390625), SIMDE_FLOAT32_C(  -232.82), SIMDE_FLOAT32_C(   119.15),
+        SIMDE_FLOAT32_C(-0.07055664), SIMDE_FLOAT32_C(   199.18), SIMDE_FLOAT32_C(   897.51), SIMDE_FLOAT32_C(   -69.75),
+        SIMDE_FLOAT32_C(  -108.85), SIMDE_FLOAT32_C(   949.65), SIMDE_FLOAT32_C(  -156.58), SIMDE_FLOAT32_C(   422.61),
+        SIMDE_FLOAT32_C(   555.43), SIMDE_FLOAT32_C(   898.73), SIMDE_FLOAT32_C(0.7480469), SIMDE_FLOAT32_C(   511.56) },
+      { UINT16_C(17511), UINT16_C(49292), UINT16_C(50025), UINT16_C(17134), UINT16_C(48528), UINT16_C(17223), UINT16_C(17504), UINT16_C(49804),
+        UINT16_C(49882), UINT16_C(17517), UINT16_C(49949), UINT16_C(17363), UINT16_C(17419), UINT16_C(17505), UINT16_C(16192), UINT16_C(17408) } },
+    { { SIMDE_FLOAT32_C( -23.5625), SIMDE_FLOAT32_C(  -471.34), SIMDE_FLOAT32_C(  -327.46), SIMDE_FLOAT32_C(   185.73),
+        SIMDE_FLOAT32_C(  -537.64), SIMDE_FLOAT32_C(   924.21), SIMDE_FLOAT32_C( -21.0625), SIMDE_FLOAT32_C(   -99.90),
+        SIMDE_FLOAT32_C(   459.12), SIMDE_FLOAT32_C(-0.6113281), SIMDE_FLOAT32_C(   425.66), SIMDE_FLOAT32_C(   279.72),
+        SIMDE_FLOAT32_C(  -153.04), SIMDE_FLOAT32_C(   723.04), SIMDE_FLOAT32_C(  -966.30), SIMDE_FLOAT32_C(   741.97) },
+      { UINT16_C(49596), UINT16_C(50156), UINT16_C(50084), UINT16_C(17210), UINT16_C(50182), UINT16_C(17511), UINT16_C(49576), UINT16_C(49864),
+        UINT16_C(17382), UINT16_C(48924), UINT16_C(17365), UINT16_C(17292), UINT16_C(49945), UINT16_C(17461), UINT16_C(50290), UINT16_C(17465) } },
+    { { SIMDE_FLOAT32_C(   -22.38), SIMDE_FLOAT32_C(   605.41), SIMDE_FLOAT32_C(-1.4335938), SIMDE_FLOAT32_C(  -480.41),
+        SIMDE_FLOAT32_C(   181.61), SIMDE_FLOAT32_C(-2.2890625), SIMDE_FLOAT32_C(  -890.70), SIMDE_FLOAT32_C(  -368.62),
+        SIMDE_FLOAT32_C(   805.09), SIMDE_FLOAT32_C(   819.27), SIMDE_FLOAT32_C(  -448.76), SIMDE_FLOAT32_C(   270.32),
+        SIMDE_FLOAT32_C(  -954.01), SIMDE_FLOAT32_C(   418.70), SIMDE_FLOAT32_C(   224.16), SIMDE_FLOAT32_C(  -383.51) },
+      { UINT16_C(49587), UINT16_C(17431), UINT16_C(49080), UINT16_C(50160), UINT16_C(17206), UINT16_C(49170), UINT16_C(50271), UINT16_C(50104),
+        UINT16_C(17481), UINT16_C(17485), UINT16_C(50144), UINT16_C(17287), UINT16_C(50287), UINT16_C(17361), UINT16_C(17248), UINT16_C(50112) } },
+    { { SIMDE_FLOAT32_C(   843.90), SIMDE_FLOAT32_C(  -618.81), SIMDE_FLOAT32_C(-0.18310547), SIMDE_FLOAT32_C(   368.64),
+        SIMDE_FLOAT32_C(  -480.98), SIMDE_FLOAT32_C(  -727.25), SIMDE_FLOAT32_C(  -410.08), SIMDE_FLOAT32_C(    25.00),
+        SIMDE_FLOAT32_C(   114.79), SIMDE_FLOAT32_C(   509.54), SIMDE_FLOAT32_C(0.33691406), SIMDE_FLOAT32_C( -16.5625),
+        SIMDE_FLOAT32_C(  -975.32), SIMDE_FLOAT32_C(0.2685547), SIMDE_FLOAT32_C(    78.16), SIMDE_FLOAT32_C(   951.95) },
+      { UINT16_C(17491), UINT16_C(50203), UINT16_C(48700), UINT16_C(17336), UINT16_C(50160), UINT16_C(50230), UINT16_C(50125), UINT16_C(16840),
+        UINT16_C(17126), UINT16_C(17407), UINT16_C(16044), UINT16_C(49540), UINT16_C(50292), UINT16_C(16010), UINT16_C(17052), UINT16_C(17518) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m256bh r = simde_mm512_cvtneps_pbh(a);
+
+    simde__m256i tmp;
+    simde_memcpy(&tmp, &r, sizeof(tmp));
+    simde_test_x86_assert_equal_u16x16(tmp, simde_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtness_sbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtne2ps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtneps_pbh)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cvtneps_pbh)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -812,6 +812,122 @@ test_simde_mm512_maskz_div_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_div_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    15.52), SIMDE_FLOAT16_VALUE(    47.50), SIMDE_FLOAT16_VALUE(    19.11), SIMDE_FLOAT16_VALUE(    18.05),
+        SIMDE_FLOAT16_VALUE(   -81.94), SIMDE_FLOAT16_VALUE(    28.80), SIMDE_FLOAT16_VALUE(    74.50), SIMDE_FLOAT16_VALUE(   -40.00),
+        SIMDE_FLOAT16_VALUE(    14.63), SIMDE_FLOAT16_VALUE(     6.81), SIMDE_FLOAT16_VALUE(    98.75), SIMDE_FLOAT16_VALUE(   -59.59),
+        SIMDE_FLOAT16_VALUE(   -57.50), SIMDE_FLOAT16_VALUE(     1.02), SIMDE_FLOAT16_VALUE(    37.31), SIMDE_FLOAT16_VALUE(   -62.31),
+        SIMDE_FLOAT16_VALUE(   -93.81), SIMDE_FLOAT16_VALUE(   -10.95), SIMDE_FLOAT16_VALUE(    73.94), SIMDE_FLOAT16_VALUE(   -67.50),
+        SIMDE_FLOAT16_VALUE(    55.00), SIMDE_FLOAT16_VALUE(   -41.09), SIMDE_FLOAT16_VALUE(   -76.00), SIMDE_FLOAT16_VALUE(    -1.39),
+        SIMDE_FLOAT16_VALUE(   -69.44), SIMDE_FLOAT16_VALUE(   -42.72), SIMDE_FLOAT16_VALUE(   -23.05), SIMDE_FLOAT16_VALUE(    62.09),
+        SIMDE_FLOAT16_VALUE(    -5.90), SIMDE_FLOAT16_VALUE(   -74.75), SIMDE_FLOAT16_VALUE(    67.88), SIMDE_FLOAT16_VALUE(   -36.72) },
+      { SIMDE_FLOAT16_VALUE(    62.88), SIMDE_FLOAT16_VALUE(    94.50), SIMDE_FLOAT16_VALUE(   -47.19), SIMDE_FLOAT16_VALUE(    56.84),
+        SIMDE_FLOAT16_VALUE(    98.62), SIMDE_FLOAT16_VALUE(     2.94), SIMDE_FLOAT16_VALUE(    57.50), SIMDE_FLOAT16_VALUE(    83.69),
+        SIMDE_FLOAT16_VALUE(   -99.81), SIMDE_FLOAT16_VALUE(   -12.58), SIMDE_FLOAT16_VALUE(     8.10), SIMDE_FLOAT16_VALUE(   -29.59),
+        SIMDE_FLOAT16_VALUE(    93.38), SIMDE_FLOAT16_VALUE(   -23.16), SIMDE_FLOAT16_VALUE(    70.44), SIMDE_FLOAT16_VALUE(   -89.00),
+        SIMDE_FLOAT16_VALUE(    70.25), SIMDE_FLOAT16_VALUE(   -94.00), SIMDE_FLOAT16_VALUE(    11.76), SIMDE_FLOAT16_VALUE(    26.56),
+        SIMDE_FLOAT16_VALUE(    56.97), SIMDE_FLOAT16_VALUE(    28.20), SIMDE_FLOAT16_VALUE(    59.16), SIMDE_FLOAT16_VALUE(    -2.77),
+        SIMDE_FLOAT16_VALUE(    79.00), SIMDE_FLOAT16_VALUE(    67.56), SIMDE_FLOAT16_VALUE(   -51.72), SIMDE_FLOAT16_VALUE(   -44.31),
+        SIMDE_FLOAT16_VALUE(   -54.06), SIMDE_FLOAT16_VALUE(     6.59), SIMDE_FLOAT16_VALUE(    51.28), SIMDE_FLOAT16_VALUE(     3.24) },
+      { SIMDE_FLOAT16_VALUE(    0.247), SIMDE_FLOAT16_VALUE(   0.5024), SIMDE_FLOAT16_VALUE(   -0.405), SIMDE_FLOAT16_VALUE(   0.3174),
+        SIMDE_FLOAT16_VALUE(  -0.8306), SIMDE_FLOAT16_VALUE(     9.80), SIMDE_FLOAT16_VALUE(    1.296), SIMDE_FLOAT16_VALUE(   -0.478),
+        SIMDE_FLOAT16_VALUE(  -0.1466), SIMDE_FLOAT16_VALUE(  -0.5415), SIMDE_FLOAT16_VALUE(    12.19), SIMDE_FLOAT16_VALUE(    2.014),
+        SIMDE_FLOAT16_VALUE(  -0.6157), SIMDE_FLOAT16_VALUE( -0.04404), SIMDE_FLOAT16_VALUE(     0.53), SIMDE_FLOAT16_VALUE(     0.70),
+        SIMDE_FLOAT16_VALUE(   -1.335), SIMDE_FLOAT16_VALUE(   0.1165), SIMDE_FLOAT16_VALUE(     6.29), SIMDE_FLOAT16_VALUE(   -2.541),
+        SIMDE_FLOAT16_VALUE(   0.9653), SIMDE_FLOAT16_VALUE(   -1.457), SIMDE_FLOAT16_VALUE(   -1.285), SIMDE_FLOAT16_VALUE(    0.502),
+        SIMDE_FLOAT16_VALUE(   -0.879), SIMDE_FLOAT16_VALUE(  -0.6323), SIMDE_FLOAT16_VALUE(   0.4456), SIMDE_FLOAT16_VALUE(   -1.401),
+        SIMDE_FLOAT16_VALUE(  0.10913), SIMDE_FLOAT16_VALUE(   -11.34), SIMDE_FLOAT16_VALUE(    1.323), SIMDE_FLOAT16_VALUE(  -11.336) } },
+    { { SIMDE_FLOAT16_VALUE(    53.62), SIMDE_FLOAT16_VALUE(   -25.09), SIMDE_FLOAT16_VALUE(    65.06), SIMDE_FLOAT16_VALUE(    -2.79),
+        SIMDE_FLOAT16_VALUE(   -29.89), SIMDE_FLOAT16_VALUE(   -70.44), SIMDE_FLOAT16_VALUE(    -4.07), SIMDE_FLOAT16_VALUE(   -73.50),
+        SIMDE_FLOAT16_VALUE(   -28.64), SIMDE_FLOAT16_VALUE(   -27.98), SIMDE_FLOAT16_VALUE(   -62.41), SIMDE_FLOAT16_VALUE(    14.83),
+        SIMDE_FLOAT16_VALUE(    46.91), SIMDE_FLOAT16_VALUE(    24.48), SIMDE_FLOAT16_VALUE(   -75.38), SIMDE_FLOAT16_VALUE(    -9.27),
+        SIMDE_FLOAT16_VALUE(   -26.08), SIMDE_FLOAT16_VALUE(   -25.92), SIMDE_FLOAT16_VALUE(    59.53), SIMDE_FLOAT16_VALUE(   -28.53),
+        SIMDE_FLOAT16_VALUE(   -89.69), SIMDE_FLOAT16_VALUE(   -43.69), SIMDE_FLOAT16_VALUE(    15.60), SIMDE_FLOAT16_VALUE(    45.69),
+        SIMDE_FLOAT16_VALUE(   -29.41), SIMDE_FLOAT16_VALUE(    79.62), SIMDE_FLOAT16_VALUE(    99.06), SIMDE_FLOAT16_VALUE(   -14.20),
+        SIMDE_FLOAT16_VALUE(   -87.50), SIMDE_FLOAT16_VALUE(    -1.46), SIMDE_FLOAT16_VALUE(   -24.80), SIMDE_FLOAT16_VALUE(   -27.02) },
+      { SIMDE_FLOAT16_VALUE(    95.06), SIMDE_FLOAT16_VALUE(    12.12), SIMDE_FLOAT16_VALUE(    77.00), SIMDE_FLOAT16_VALUE(    13.18),
+        SIMDE_FLOAT16_VALUE(    61.84), SIMDE_FLOAT16_VALUE(    12.95), SIMDE_FLOAT16_VALUE(    40.78), SIMDE_FLOAT16_VALUE(   -95.81),
+        SIMDE_FLOAT16_VALUE(    24.20), SIMDE_FLOAT16_VALUE(   -13.46), SIMDE_FLOAT16_VALUE(    -4.83), SIMDE_FLOAT16_VALUE(    19.12),
+        SIMDE_FLOAT16_VALUE(    85.31), SIMDE_FLOAT16_VALUE(    45.50), SIMDE_FLOAT16_VALUE(   -74.75), SIMDE_FLOAT16_VALUE(   -52.28),
+        SIMDE_FLOAT16_VALUE(   -94.75), SIMDE_FLOAT16_VALUE(    -1.57), SIMDE_FLOAT16_VALUE(    79.12), SIMDE_FLOAT16_VALUE(    33.84),
+        SIMDE_FLOAT16_VALUE(     9.83), SIMDE_FLOAT16_VALUE(    44.38), SIMDE_FLOAT16_VALUE(   -86.62), SIMDE_FLOAT16_VALUE(    57.72),
+        SIMDE_FLOAT16_VALUE(   -37.75), SIMDE_FLOAT16_VALUE(    66.81), SIMDE_FLOAT16_VALUE(   -52.97), SIMDE_FLOAT16_VALUE(     2.57),
+        SIMDE_FLOAT16_VALUE(   -27.83), SIMDE_FLOAT16_VALUE(   -83.81), SIMDE_FLOAT16_VALUE(   -49.75), SIMDE_FLOAT16_VALUE(   -84.12) },
+      { SIMDE_FLOAT16_VALUE(    0.564), SIMDE_FLOAT16_VALUE(    -2.07), SIMDE_FLOAT16_VALUE(   0.8447), SIMDE_FLOAT16_VALUE(  -0.2117),
+        SIMDE_FLOAT16_VALUE(  -0.4834), SIMDE_FLOAT16_VALUE(   -5.438), SIMDE_FLOAT16_VALUE(  -0.0998), SIMDE_FLOAT16_VALUE(    0.767),
+        SIMDE_FLOAT16_VALUE(   -1.184), SIMDE_FLOAT16_VALUE(    2.078), SIMDE_FLOAT16_VALUE(    12.92), SIMDE_FLOAT16_VALUE(   0.7754),
+        SIMDE_FLOAT16_VALUE(     0.55), SIMDE_FLOAT16_VALUE(    0.538), SIMDE_FLOAT16_VALUE(    1.009), SIMDE_FLOAT16_VALUE(   0.1774),
+        SIMDE_FLOAT16_VALUE(   0.2751), SIMDE_FLOAT16_VALUE(    16.50), SIMDE_FLOAT16_VALUE(   0.7524), SIMDE_FLOAT16_VALUE(  -0.8433),
+        SIMDE_FLOAT16_VALUE(   -9.125), SIMDE_FLOAT16_VALUE(  -0.9844), SIMDE_FLOAT16_VALUE(    -0.18), SIMDE_FLOAT16_VALUE(   0.7915),
+        SIMDE_FLOAT16_VALUE(    0.779), SIMDE_FLOAT16_VALUE(    1.191), SIMDE_FLOAT16_VALUE(    -1.87), SIMDE_FLOAT16_VALUE(   -5.527),
+        SIMDE_FLOAT16_VALUE(    3.145), SIMDE_FLOAT16_VALUE(  0.01743), SIMDE_FLOAT16_VALUE(   0.4985), SIMDE_FLOAT16_VALUE(    0.321) } },
+    { { SIMDE_FLOAT16_VALUE(    82.81), SIMDE_FLOAT16_VALUE(   -98.19), SIMDE_FLOAT16_VALUE(   -94.19), SIMDE_FLOAT16_VALUE(    70.00),
+        SIMDE_FLOAT16_VALUE(     4.11), SIMDE_FLOAT16_VALUE(     4.93), SIMDE_FLOAT16_VALUE(    76.50), SIMDE_FLOAT16_VALUE(    24.45),
+        SIMDE_FLOAT16_VALUE(    75.31), SIMDE_FLOAT16_VALUE(   -20.47), SIMDE_FLOAT16_VALUE(   -16.48), SIMDE_FLOAT16_VALUE(   -28.30),
+        SIMDE_FLOAT16_VALUE(    79.94), SIMDE_FLOAT16_VALUE(    31.30), SIMDE_FLOAT16_VALUE(     9.23), SIMDE_FLOAT16_VALUE(   -13.27),
+        SIMDE_FLOAT16_VALUE(    87.50), SIMDE_FLOAT16_VALUE(    76.75), SIMDE_FLOAT16_VALUE(   -40.47), SIMDE_FLOAT16_VALUE(    93.44),
+        SIMDE_FLOAT16_VALUE(   -66.75), SIMDE_FLOAT16_VALUE(   -29.45), SIMDE_FLOAT16_VALUE(    90.44), SIMDE_FLOAT16_VALUE(    78.19),
+        SIMDE_FLOAT16_VALUE(    39.53), SIMDE_FLOAT16_VALUE(    84.62), SIMDE_FLOAT16_VALUE(   -87.56), SIMDE_FLOAT16_VALUE(    34.31),
+        SIMDE_FLOAT16_VALUE(    49.50), SIMDE_FLOAT16_VALUE(   -31.52), SIMDE_FLOAT16_VALUE(   -22.03), SIMDE_FLOAT16_VALUE(   -70.44) },
+      { SIMDE_FLOAT16_VALUE(   -10.19), SIMDE_FLOAT16_VALUE(    55.00), SIMDE_FLOAT16_VALUE(   -80.06), SIMDE_FLOAT16_VALUE(   -59.66),
+        SIMDE_FLOAT16_VALUE(   -64.50), SIMDE_FLOAT16_VALUE(   -81.31), SIMDE_FLOAT16_VALUE(   -69.62), SIMDE_FLOAT16_VALUE(   -49.06),
+        SIMDE_FLOAT16_VALUE(    90.25), SIMDE_FLOAT16_VALUE(    30.11), SIMDE_FLOAT16_VALUE(   -26.19), SIMDE_FLOAT16_VALUE(   -78.38),
+        SIMDE_FLOAT16_VALUE(    20.12), SIMDE_FLOAT16_VALUE(   -16.59), SIMDE_FLOAT16_VALUE(     1.37), SIMDE_FLOAT16_VALUE(    48.12),
+        SIMDE_FLOAT16_VALUE(   -73.56), SIMDE_FLOAT16_VALUE(   -88.19), SIMDE_FLOAT16_VALUE(   -94.69), SIMDE_FLOAT16_VALUE(    93.94),
+        SIMDE_FLOAT16_VALUE(   -56.09), SIMDE_FLOAT16_VALUE(    30.84), SIMDE_FLOAT16_VALUE(    98.31), SIMDE_FLOAT16_VALUE(    49.09),
+        SIMDE_FLOAT16_VALUE(    37.88), SIMDE_FLOAT16_VALUE(    59.84), SIMDE_FLOAT16_VALUE(   -34.81), SIMDE_FLOAT16_VALUE(    11.18),
+        SIMDE_FLOAT16_VALUE(   -85.12), SIMDE_FLOAT16_VALUE(   -67.00), SIMDE_FLOAT16_VALUE(   -65.69), SIMDE_FLOAT16_VALUE(    78.00) },
+      { SIMDE_FLOAT16_VALUE(   -8.125), SIMDE_FLOAT16_VALUE(   -1.785), SIMDE_FLOAT16_VALUE(    1.177), SIMDE_FLOAT16_VALUE(   -1.174),
+        SIMDE_FLOAT16_VALUE(  -0.0637), SIMDE_FLOAT16_VALUE( -0.06064), SIMDE_FLOAT16_VALUE(   -1.099), SIMDE_FLOAT16_VALUE(  -0.4983),
+        SIMDE_FLOAT16_VALUE(   0.8345), SIMDE_FLOAT16_VALUE(  -0.6797), SIMDE_FLOAT16_VALUE(   0.6294), SIMDE_FLOAT16_VALUE(    0.361),
+        SIMDE_FLOAT16_VALUE(    3.973), SIMDE_FLOAT16_VALUE(   -1.886), SIMDE_FLOAT16_VALUE(    6.734), SIMDE_FLOAT16_VALUE(   -0.276),
+        SIMDE_FLOAT16_VALUE(   -1.189), SIMDE_FLOAT16_VALUE(    -0.87), SIMDE_FLOAT16_VALUE(   0.4275), SIMDE_FLOAT16_VALUE(   0.9946),
+        SIMDE_FLOAT16_VALUE(     1.19), SIMDE_FLOAT16_VALUE(   -0.955), SIMDE_FLOAT16_VALUE(     0.92), SIMDE_FLOAT16_VALUE(    1.593),
+        SIMDE_FLOAT16_VALUE(    1.044), SIMDE_FLOAT16_VALUE(    1.414), SIMDE_FLOAT16_VALUE(    2.516), SIMDE_FLOAT16_VALUE(    3.068),
+        SIMDE_FLOAT16_VALUE(  -0.5815), SIMDE_FLOAT16_VALUE(   0.4705), SIMDE_FLOAT16_VALUE(   0.3354), SIMDE_FLOAT16_VALUE(   -0.903) } },
+    { { SIMDE_FLOAT16_VALUE(   -32.81), SIMDE_FLOAT16_VALUE(   -59.38), SIMDE_FLOAT16_VALUE(    68.75), SIMDE_FLOAT16_VALUE(    92.38),
+        SIMDE_FLOAT16_VALUE(    65.00), SIMDE_FLOAT16_VALUE(     0.44), SIMDE_FLOAT16_VALUE(   -38.12), SIMDE_FLOAT16_VALUE(    74.81),
+        SIMDE_FLOAT16_VALUE(   -16.94), SIMDE_FLOAT16_VALUE(   -70.75), SIMDE_FLOAT16_VALUE(     2.64), SIMDE_FLOAT16_VALUE(   -65.00),
+        SIMDE_FLOAT16_VALUE(    72.81), SIMDE_FLOAT16_VALUE(    28.20), SIMDE_FLOAT16_VALUE(   -47.97), SIMDE_FLOAT16_VALUE(   -35.78),
+        SIMDE_FLOAT16_VALUE(   -33.41), SIMDE_FLOAT16_VALUE(    26.47), SIMDE_FLOAT16_VALUE(     0.82), SIMDE_FLOAT16_VALUE(    97.56),
+        SIMDE_FLOAT16_VALUE(    78.19), SIMDE_FLOAT16_VALUE(   -79.81), SIMDE_FLOAT16_VALUE(     3.38), SIMDE_FLOAT16_VALUE(   -62.12),
+        SIMDE_FLOAT16_VALUE(    -3.93), SIMDE_FLOAT16_VALUE(   -99.31), SIMDE_FLOAT16_VALUE(    39.00), SIMDE_FLOAT16_VALUE(    43.34),
+        SIMDE_FLOAT16_VALUE(    68.12), SIMDE_FLOAT16_VALUE(   -35.62), SIMDE_FLOAT16_VALUE(    93.62), SIMDE_FLOAT16_VALUE(     3.00) },
+      { SIMDE_FLOAT16_VALUE(    87.00), SIMDE_FLOAT16_VALUE(     7.72), SIMDE_FLOAT16_VALUE(    86.38), SIMDE_FLOAT16_VALUE(    80.81),
+        SIMDE_FLOAT16_VALUE(   -18.22), SIMDE_FLOAT16_VALUE(     0.53), SIMDE_FLOAT16_VALUE(   -64.25), SIMDE_FLOAT16_VALUE(   -30.70),
+        SIMDE_FLOAT16_VALUE(   -77.50), SIMDE_FLOAT16_VALUE(    45.91), SIMDE_FLOAT16_VALUE(   -53.62), SIMDE_FLOAT16_VALUE(    48.53),
+        SIMDE_FLOAT16_VALUE(   -64.88), SIMDE_FLOAT16_VALUE(   -21.91), SIMDE_FLOAT16_VALUE(    21.02), SIMDE_FLOAT16_VALUE(    -9.31),
+        SIMDE_FLOAT16_VALUE(   -79.19), SIMDE_FLOAT16_VALUE(    13.51), SIMDE_FLOAT16_VALUE(    10.47), SIMDE_FLOAT16_VALUE(     6.65),
+        SIMDE_FLOAT16_VALUE(   -51.78), SIMDE_FLOAT16_VALUE(    21.55), SIMDE_FLOAT16_VALUE(   -73.44), SIMDE_FLOAT16_VALUE(    30.20),
+        SIMDE_FLOAT16_VALUE(    72.56), SIMDE_FLOAT16_VALUE(   -49.06), SIMDE_FLOAT16_VALUE(    92.25), SIMDE_FLOAT16_VALUE(   -18.52),
+        SIMDE_FLOAT16_VALUE(   -95.25), SIMDE_FLOAT16_VALUE(   -46.47), SIMDE_FLOAT16_VALUE(   -21.09), SIMDE_FLOAT16_VALUE(   -95.62) },
+      { SIMDE_FLOAT16_VALUE(  -0.3772), SIMDE_FLOAT16_VALUE(    -7.69), SIMDE_FLOAT16_VALUE(    0.796), SIMDE_FLOAT16_VALUE(    1.144),
+        SIMDE_FLOAT16_VALUE(   -3.568), SIMDE_FLOAT16_VALUE(   0.8306), SIMDE_FLOAT16_VALUE(   0.5933), SIMDE_FLOAT16_VALUE(   -2.438),
+        SIMDE_FLOAT16_VALUE(   0.2185), SIMDE_FLOAT16_VALUE(   -1.541), SIMDE_FLOAT16_VALUE( -0.04926), SIMDE_FLOAT16_VALUE(   -1.339),
+        SIMDE_FLOAT16_VALUE(   -1.122), SIMDE_FLOAT16_VALUE(   -1.287), SIMDE_FLOAT16_VALUE(   -2.283), SIMDE_FLOAT16_VALUE(    3.842),
+        SIMDE_FLOAT16_VALUE(   0.4219), SIMDE_FLOAT16_VALUE(     1.96), SIMDE_FLOAT16_VALUE(   0.0783), SIMDE_FLOAT16_VALUE(    14.67),
+        SIMDE_FLOAT16_VALUE(    -1.51), SIMDE_FLOAT16_VALUE(   -3.705), SIMDE_FLOAT16_VALUE( -0.04605), SIMDE_FLOAT16_VALUE(   -2.057),
+        SIMDE_FLOAT16_VALUE( -0.05417), SIMDE_FLOAT16_VALUE(    2.023), SIMDE_FLOAT16_VALUE(   0.4229), SIMDE_FLOAT16_VALUE(   -2.342),
+        SIMDE_FLOAT16_VALUE(  -0.7153), SIMDE_FLOAT16_VALUE(   0.7666), SIMDE_FLOAT16_VALUE(   -4.438), SIMDE_FLOAT16_VALUE( -0.03137) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde_float16 r[32];
+    simde_mm512_storeu_ph(r, simde_mm512_div_ph(a, b));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_div_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_div_ps)
@@ -819,6 +935,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_div_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_div_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_div_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_div_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
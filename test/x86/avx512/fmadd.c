@@ -581,11 +581,162 @@ test_simde_mm512_fmadd_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_fmadd_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde_float16 c[32];
+    simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(     6.22), SIMDE_FLOAT16_VALUE(   -14.47), SIMDE_FLOAT16_VALUE(    10.71), SIMDE_FLOAT16_VALUE(    41.31),
+        SIMDE_FLOAT16_VALUE(   -39.12), SIMDE_FLOAT16_VALUE(   -58.12), SIMDE_FLOAT16_VALUE(   -21.80), SIMDE_FLOAT16_VALUE(   -67.75),
+        SIMDE_FLOAT16_VALUE(   -88.00), SIMDE_FLOAT16_VALUE(   -31.25), SIMDE_FLOAT16_VALUE(    27.16), SIMDE_FLOAT16_VALUE(    -8.85),
+        SIMDE_FLOAT16_VALUE(    51.03), SIMDE_FLOAT16_VALUE(   -10.27), SIMDE_FLOAT16_VALUE(   -54.94), SIMDE_FLOAT16_VALUE(   -21.70),
+        SIMDE_FLOAT16_VALUE(   -29.41), SIMDE_FLOAT16_VALUE(   -84.19), SIMDE_FLOAT16_VALUE(    10.20), SIMDE_FLOAT16_VALUE(   -89.56),
+        SIMDE_FLOAT16_VALUE(   -76.06), SIMDE_FLOAT16_VALUE(   -61.19), SIMDE_FLOAT16_VALUE(    36.16), SIMDE_FLOAT16_VALUE(   -56.78),
+        SIMDE_FLOAT16_VALUE(    84.75), SIMDE_FLOAT16_VALUE(   -98.56), SIMDE_FLOAT16_VALUE(   -74.81), SIMDE_FLOAT16_VALUE(   -64.62),
+        SIMDE_FLOAT16_VALUE(   -20.56), SIMDE_FLOAT16_VALUE(     7.14), SIMDE_FLOAT16_VALUE(   -80.62), SIMDE_FLOAT16_VALUE(    64.31) },
+      { SIMDE_FLOAT16_VALUE(    52.41), SIMDE_FLOAT16_VALUE(    67.69), SIMDE_FLOAT16_VALUE(    70.75), SIMDE_FLOAT16_VALUE(   -86.25),
+        SIMDE_FLOAT16_VALUE(    71.69), SIMDE_FLOAT16_VALUE(   -78.81), SIMDE_FLOAT16_VALUE(   -32.62), SIMDE_FLOAT16_VALUE(    16.81),
+        SIMDE_FLOAT16_VALUE(   -54.91), SIMDE_FLOAT16_VALUE(   -45.69), SIMDE_FLOAT16_VALUE(   -50.94), SIMDE_FLOAT16_VALUE(    97.44),
+        SIMDE_FLOAT16_VALUE(   -90.12), SIMDE_FLOAT16_VALUE(   -36.81), SIMDE_FLOAT16_VALUE(    68.00), SIMDE_FLOAT16_VALUE(   -98.56),
+        SIMDE_FLOAT16_VALUE(    94.00), SIMDE_FLOAT16_VALUE(   -81.94), SIMDE_FLOAT16_VALUE(    26.56), SIMDE_FLOAT16_VALUE(    70.12),
+        SIMDE_FLOAT16_VALUE(   -80.00), SIMDE_FLOAT16_VALUE(   -82.50), SIMDE_FLOAT16_VALUE(    69.31), SIMDE_FLOAT16_VALUE(   -80.75),
+        SIMDE_FLOAT16_VALUE(   -44.69), SIMDE_FLOAT16_VALUE(    42.97), SIMDE_FLOAT16_VALUE(   -48.28), SIMDE_FLOAT16_VALUE(   -31.59),
+        SIMDE_FLOAT16_VALUE(    36.25), SIMDE_FLOAT16_VALUE(   -17.27), SIMDE_FLOAT16_VALUE(   -91.75), SIMDE_FLOAT16_VALUE(   -35.28) },
+      { SIMDE_FLOAT16_VALUE(   -90.69), SIMDE_FLOAT16_VALUE(   -72.12), SIMDE_FLOAT16_VALUE(    56.53), SIMDE_FLOAT16_VALUE(    57.62),
+        SIMDE_FLOAT16_VALUE(   -86.31), SIMDE_FLOAT16_VALUE(    23.36), SIMDE_FLOAT16_VALUE(    54.28), SIMDE_FLOAT16_VALUE(    55.38),
+        SIMDE_FLOAT16_VALUE(   -31.88), SIMDE_FLOAT16_VALUE(    38.84), SIMDE_FLOAT16_VALUE(   -19.33), SIMDE_FLOAT16_VALUE(   -48.88),
+        SIMDE_FLOAT16_VALUE(   -15.00), SIMDE_FLOAT16_VALUE(   -76.94), SIMDE_FLOAT16_VALUE(    33.38), SIMDE_FLOAT16_VALUE(    75.19),
+        SIMDE_FLOAT16_VALUE(   -30.12), SIMDE_FLOAT16_VALUE(    87.06), SIMDE_FLOAT16_VALUE(   -82.06), SIMDE_FLOAT16_VALUE(   -54.97),
+        SIMDE_FLOAT16_VALUE(   -99.31), SIMDE_FLOAT16_VALUE(    -9.54), SIMDE_FLOAT16_VALUE(    33.78), SIMDE_FLOAT16_VALUE(   -76.44),
+        SIMDE_FLOAT16_VALUE(   -86.12), SIMDE_FLOAT16_VALUE(   -36.94), SIMDE_FLOAT16_VALUE(   -51.59), SIMDE_FLOAT16_VALUE(   -47.22),
+        SIMDE_FLOAT16_VALUE(    39.88), SIMDE_FLOAT16_VALUE(   -83.56), SIMDE_FLOAT16_VALUE(    55.94), SIMDE_FLOAT16_VALUE(   -66.56) },
+      { SIMDE_FLOAT16_VALUE(   235.25), SIMDE_FLOAT16_VALUE( -1051.00), SIMDE_FLOAT16_VALUE(   814.50), SIMDE_FLOAT16_VALUE( -3506.00),
+        SIMDE_FLOAT16_VALUE( -2892.00), SIMDE_FLOAT16_VALUE(  4604.00), SIMDE_FLOAT16_VALUE(   765.50), SIMDE_FLOAT16_VALUE( -1084.00),
+        SIMDE_FLOAT16_VALUE(  4800.00), SIMDE_FLOAT16_VALUE(  1467.00), SIMDE_FLOAT16_VALUE( -1403.00), SIMDE_FLOAT16_VALUE(  -911.50),
+        SIMDE_FLOAT16_VALUE( -4616.00), SIMDE_FLOAT16_VALUE(   301.25), SIMDE_FLOAT16_VALUE( -3702.00), SIMDE_FLOAT16_VALUE(  2214.00),
+        SIMDE_FLOAT16_VALUE( -2794.00), SIMDE_FLOAT16_VALUE(  6984.00), SIMDE_FLOAT16_VALUE(   189.00), SIMDE_FLOAT16_VALUE( -6336.00),
+        SIMDE_FLOAT16_VALUE(  5984.00), SIMDE_FLOAT16_VALUE(  5040.00), SIMDE_FLOAT16_VALUE(  2540.00), SIMDE_FLOAT16_VALUE(  4508.00),
+        SIMDE_FLOAT16_VALUE( -3874.00), SIMDE_FLOAT16_VALUE( -4272.00), SIMDE_FLOAT16_VALUE(  3560.00), SIMDE_FLOAT16_VALUE(  1995.00),
+        SIMDE_FLOAT16_VALUE(  -705.50), SIMDE_FLOAT16_VALUE(  -206.88), SIMDE_FLOAT16_VALUE(  7452.00), SIMDE_FLOAT16_VALUE( -2336.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -67.19), SIMDE_FLOAT16_VALUE(    93.00), SIMDE_FLOAT16_VALUE(    -6.76), SIMDE_FLOAT16_VALUE(    -5.58),
+        SIMDE_FLOAT16_VALUE(    -9.38), SIMDE_FLOAT16_VALUE(   -40.16), SIMDE_FLOAT16_VALUE(   -98.31), SIMDE_FLOAT16_VALUE(     5.28),
+        SIMDE_FLOAT16_VALUE(   -44.75), SIMDE_FLOAT16_VALUE(    81.62), SIMDE_FLOAT16_VALUE(   -72.31), SIMDE_FLOAT16_VALUE(    68.81),
+        SIMDE_FLOAT16_VALUE(   -72.31), SIMDE_FLOAT16_VALUE(   -26.67), SIMDE_FLOAT16_VALUE(   -49.53), SIMDE_FLOAT16_VALUE(   -88.88),
+        SIMDE_FLOAT16_VALUE(   -51.75), SIMDE_FLOAT16_VALUE(   -28.84), SIMDE_FLOAT16_VALUE(   -43.34), SIMDE_FLOAT16_VALUE(    46.72),
+        SIMDE_FLOAT16_VALUE(    67.56), SIMDE_FLOAT16_VALUE(    -2.43), SIMDE_FLOAT16_VALUE(     0.20), SIMDE_FLOAT16_VALUE(    52.75),
+        SIMDE_FLOAT16_VALUE(    78.06), SIMDE_FLOAT16_VALUE(   -78.00), SIMDE_FLOAT16_VALUE(   -60.84), SIMDE_FLOAT16_VALUE(    46.16),
+        SIMDE_FLOAT16_VALUE(    11.49), SIMDE_FLOAT16_VALUE(   -62.31), SIMDE_FLOAT16_VALUE(    19.67), SIMDE_FLOAT16_VALUE(    42.72) },
+      { SIMDE_FLOAT16_VALUE(    -9.61), SIMDE_FLOAT16_VALUE(   -85.50), SIMDE_FLOAT16_VALUE(    93.50), SIMDE_FLOAT16_VALUE(   -33.06),
+        SIMDE_FLOAT16_VALUE(    27.28), SIMDE_FLOAT16_VALUE(    19.08), SIMDE_FLOAT16_VALUE(    48.41), SIMDE_FLOAT16_VALUE(    85.25),
+        SIMDE_FLOAT16_VALUE(    -2.55), SIMDE_FLOAT16_VALUE(   -11.70), SIMDE_FLOAT16_VALUE(   -42.56), SIMDE_FLOAT16_VALUE(   -71.94),
+        SIMDE_FLOAT16_VALUE(    87.19), SIMDE_FLOAT16_VALUE(    98.94), SIMDE_FLOAT16_VALUE(   -36.31), SIMDE_FLOAT16_VALUE(    60.94),
+        SIMDE_FLOAT16_VALUE(    96.62), SIMDE_FLOAT16_VALUE(   -48.47), SIMDE_FLOAT16_VALUE(    17.08), SIMDE_FLOAT16_VALUE(    86.38),
+        SIMDE_FLOAT16_VALUE(    23.42), SIMDE_FLOAT16_VALUE(   -46.84), SIMDE_FLOAT16_VALUE(    71.00), SIMDE_FLOAT16_VALUE(   -96.75),
+        SIMDE_FLOAT16_VALUE(    -0.67), SIMDE_FLOAT16_VALUE(    77.56), SIMDE_FLOAT16_VALUE(    36.12), SIMDE_FLOAT16_VALUE(    44.34),
+        SIMDE_FLOAT16_VALUE(    23.12), SIMDE_FLOAT16_VALUE(   -25.86), SIMDE_FLOAT16_VALUE(   -24.38), SIMDE_FLOAT16_VALUE(   -71.75) },
+      { SIMDE_FLOAT16_VALUE(   -67.12), SIMDE_FLOAT16_VALUE(   -16.19), SIMDE_FLOAT16_VALUE(     5.59), SIMDE_FLOAT16_VALUE(    -3.96),
+        SIMDE_FLOAT16_VALUE(    85.25), SIMDE_FLOAT16_VALUE(   -59.16), SIMDE_FLOAT16_VALUE(    17.05), SIMDE_FLOAT16_VALUE(   -48.09),
+        SIMDE_FLOAT16_VALUE(     7.15), SIMDE_FLOAT16_VALUE(    20.98), SIMDE_FLOAT16_VALUE(    -7.27), SIMDE_FLOAT16_VALUE(   -79.25),
+        SIMDE_FLOAT16_VALUE(   -58.91), SIMDE_FLOAT16_VALUE(    87.00), SIMDE_FLOAT16_VALUE(    -6.97), SIMDE_FLOAT16_VALUE(   -77.19),
+        SIMDE_FLOAT16_VALUE(    85.81), SIMDE_FLOAT16_VALUE(    -0.24), SIMDE_FLOAT16_VALUE(   -99.31), SIMDE_FLOAT16_VALUE(   -21.03),
+        SIMDE_FLOAT16_VALUE(   -88.25), SIMDE_FLOAT16_VALUE(    49.50), SIMDE_FLOAT16_VALUE(   -89.00), SIMDE_FLOAT16_VALUE(    20.27),
+        SIMDE_FLOAT16_VALUE(   -52.72), SIMDE_FLOAT16_VALUE(   -17.34), SIMDE_FLOAT16_VALUE(     9.60), SIMDE_FLOAT16_VALUE(     6.85),
+        SIMDE_FLOAT16_VALUE(   -51.88), SIMDE_FLOAT16_VALUE(    58.31), SIMDE_FLOAT16_VALUE(    97.44), SIMDE_FLOAT16_VALUE(    73.75) },
+      { SIMDE_FLOAT16_VALUE(   578.50), SIMDE_FLOAT16_VALUE( -7968.00), SIMDE_FLOAT16_VALUE(  -626.50), SIMDE_FLOAT16_VALUE(   180.50),
+        SIMDE_FLOAT16_VALUE(  -170.75), SIMDE_FLOAT16_VALUE(  -825.50), SIMDE_FLOAT16_VALUE( -4740.00), SIMDE_FLOAT16_VALUE(   402.25),
+        SIMDE_FLOAT16_VALUE(   121.31), SIMDE_FLOAT16_VALUE(  -934.50), SIMDE_FLOAT16_VALUE(  3070.00), SIMDE_FLOAT16_VALUE( -5028.00),
+        SIMDE_FLOAT16_VALUE( -6364.00), SIMDE_FLOAT16_VALUE( -2552.00), SIMDE_FLOAT16_VALUE(  1792.00), SIMDE_FLOAT16_VALUE( -5492.00),
+        SIMDE_FLOAT16_VALUE( -4916.00), SIMDE_FLOAT16_VALUE(  1398.00), SIMDE_FLOAT16_VALUE(  -839.50), SIMDE_FLOAT16_VALUE(  4014.00),
+        SIMDE_FLOAT16_VALUE(  1494.00), SIMDE_FLOAT16_VALUE(   163.38), SIMDE_FLOAT16_VALUE(   -74.81), SIMDE_FLOAT16_VALUE( -5084.00),
+        SIMDE_FLOAT16_VALUE(  -105.00), SIMDE_FLOAT16_VALUE( -6068.00), SIMDE_FLOAT16_VALUE( -2188.00), SIMDE_FLOAT16_VALUE(  2054.00),
+        SIMDE_FLOAT16_VALUE(   213.88), SIMDE_FLOAT16_VALUE(  1670.00), SIMDE_FLOAT16_VALUE(  -382.00), SIMDE_FLOAT16_VALUE( -2992.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -81.00), SIMDE_FLOAT16_VALUE(    22.98), SIMDE_FLOAT16_VALUE(   -14.48), SIMDE_FLOAT16_VALUE(    76.00),
+        SIMDE_FLOAT16_VALUE(     5.64), SIMDE_FLOAT16_VALUE(   -65.31), SIMDE_FLOAT16_VALUE(   -29.45), SIMDE_FLOAT16_VALUE(   -86.38),
+        SIMDE_FLOAT16_VALUE(   -66.19), SIMDE_FLOAT16_VALUE(    98.50), SIMDE_FLOAT16_VALUE(    92.19), SIMDE_FLOAT16_VALUE(     5.39),
+        SIMDE_FLOAT16_VALUE(    -0.81), SIMDE_FLOAT16_VALUE(   -89.69), SIMDE_FLOAT16_VALUE(    98.69), SIMDE_FLOAT16_VALUE(    43.19),
+        SIMDE_FLOAT16_VALUE(   -64.75), SIMDE_FLOAT16_VALUE(    10.50), SIMDE_FLOAT16_VALUE(    18.88), SIMDE_FLOAT16_VALUE(   -58.50),
+        SIMDE_FLOAT16_VALUE(   -25.03), SIMDE_FLOAT16_VALUE(    20.27), SIMDE_FLOAT16_VALUE(    56.78), SIMDE_FLOAT16_VALUE(   -79.38),
+        SIMDE_FLOAT16_VALUE(    91.00), SIMDE_FLOAT16_VALUE(    49.59), SIMDE_FLOAT16_VALUE(   -25.47), SIMDE_FLOAT16_VALUE(   -92.38),
+        SIMDE_FLOAT16_VALUE(   -28.12), SIMDE_FLOAT16_VALUE(    55.12), SIMDE_FLOAT16_VALUE(    81.19), SIMDE_FLOAT16_VALUE(   -11.18) },
+      { SIMDE_FLOAT16_VALUE(   -78.56), SIMDE_FLOAT16_VALUE(     7.70), SIMDE_FLOAT16_VALUE(   -96.62), SIMDE_FLOAT16_VALUE(    79.31),
+        SIMDE_FLOAT16_VALUE(   -95.25), SIMDE_FLOAT16_VALUE(   -55.81), SIMDE_FLOAT16_VALUE(    19.62), SIMDE_FLOAT16_VALUE(   -68.81),
+        SIMDE_FLOAT16_VALUE(   -46.12), SIMDE_FLOAT16_VALUE(    68.75), SIMDE_FLOAT16_VALUE(    39.31), SIMDE_FLOAT16_VALUE(   -34.47),
+        SIMDE_FLOAT16_VALUE(   -28.61), SIMDE_FLOAT16_VALUE(    71.12), SIMDE_FLOAT16_VALUE(   -11.11), SIMDE_FLOAT16_VALUE(   -86.25),
+        SIMDE_FLOAT16_VALUE(   -42.62), SIMDE_FLOAT16_VALUE(     2.67), SIMDE_FLOAT16_VALUE(   -79.44), SIMDE_FLOAT16_VALUE(   -29.78),
+        SIMDE_FLOAT16_VALUE(    83.88), SIMDE_FLOAT16_VALUE(    -9.35), SIMDE_FLOAT16_VALUE(    59.16), SIMDE_FLOAT16_VALUE(    62.88),
+        SIMDE_FLOAT16_VALUE(    76.31), SIMDE_FLOAT16_VALUE(   -12.18), SIMDE_FLOAT16_VALUE(   -83.88), SIMDE_FLOAT16_VALUE(    47.66),
+        SIMDE_FLOAT16_VALUE(   -20.11), SIMDE_FLOAT16_VALUE(    96.88), SIMDE_FLOAT16_VALUE(     6.59), SIMDE_FLOAT16_VALUE(    -5.31) },
+      { SIMDE_FLOAT16_VALUE(    36.50), SIMDE_FLOAT16_VALUE(    -1.99), SIMDE_FLOAT16_VALUE(    19.27), SIMDE_FLOAT16_VALUE(     7.80),
+        SIMDE_FLOAT16_VALUE(   -42.62), SIMDE_FLOAT16_VALUE(   -67.94), SIMDE_FLOAT16_VALUE(    95.69), SIMDE_FLOAT16_VALUE(   -30.30),
+        SIMDE_FLOAT16_VALUE(    57.69), SIMDE_FLOAT16_VALUE(   -91.56), SIMDE_FLOAT16_VALUE(    71.88), SIMDE_FLOAT16_VALUE(   -29.95),
+        SIMDE_FLOAT16_VALUE(    73.69), SIMDE_FLOAT16_VALUE(    77.62), SIMDE_FLOAT16_VALUE(    21.58), SIMDE_FLOAT16_VALUE(   -96.81),
+        SIMDE_FLOAT16_VALUE(   -87.94), SIMDE_FLOAT16_VALUE(    16.39), SIMDE_FLOAT16_VALUE(   -84.25), SIMDE_FLOAT16_VALUE(   -12.60),
+        SIMDE_FLOAT16_VALUE(   -79.50), SIMDE_FLOAT16_VALUE(   -47.72), SIMDE_FLOAT16_VALUE(   -82.94), SIMDE_FLOAT16_VALUE(   -92.12),
+        SIMDE_FLOAT16_VALUE(   -56.34), SIMDE_FLOAT16_VALUE(   -16.97), SIMDE_FLOAT16_VALUE(   -54.81), SIMDE_FLOAT16_VALUE(    42.12),
+        SIMDE_FLOAT16_VALUE(   -16.28), SIMDE_FLOAT16_VALUE(    43.44), SIMDE_FLOAT16_VALUE(   -98.31), SIMDE_FLOAT16_VALUE(   -18.34) },
+      { SIMDE_FLOAT16_VALUE(  6400.00), SIMDE_FLOAT16_VALUE(   175.00), SIMDE_FLOAT16_VALUE(  1418.00), SIMDE_FLOAT16_VALUE(  6036.00),
+        SIMDE_FLOAT16_VALUE(  -580.00), SIMDE_FLOAT16_VALUE(  3578.00), SIMDE_FLOAT16_VALUE(  -482.25), SIMDE_FLOAT16_VALUE(  5912.00),
+        SIMDE_FLOAT16_VALUE(  3110.00), SIMDE_FLOAT16_VALUE(  6680.00), SIMDE_FLOAT16_VALUE(  3696.00), SIMDE_FLOAT16_VALUE(  -215.75),
+        SIMDE_FLOAT16_VALUE(    96.88), SIMDE_FLOAT16_VALUE( -6300.00), SIMDE_FLOAT16_VALUE( -1075.00), SIMDE_FLOAT16_VALUE( -3822.00),
+        SIMDE_FLOAT16_VALUE(  2672.00), SIMDE_FLOAT16_VALUE(    44.44), SIMDE_FLOAT16_VALUE( -1584.00), SIMDE_FLOAT16_VALUE(  1730.00),
+        SIMDE_FLOAT16_VALUE( -2178.00), SIMDE_FLOAT16_VALUE(  -237.25), SIMDE_FLOAT16_VALUE(  3276.00), SIMDE_FLOAT16_VALUE( -5084.00),
+        SIMDE_FLOAT16_VALUE(  6888.00), SIMDE_FLOAT16_VALUE(  -621.00), SIMDE_FLOAT16_VALUE(  2082.00), SIMDE_FLOAT16_VALUE( -4360.00),
+        SIMDE_FLOAT16_VALUE(   549.50), SIMDE_FLOAT16_VALUE(  5384.00), SIMDE_FLOAT16_VALUE(   436.75), SIMDE_FLOAT16_VALUE(    41.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -69.69), SIMDE_FLOAT16_VALUE(   -84.06), SIMDE_FLOAT16_VALUE(   -55.12), SIMDE_FLOAT16_VALUE(    23.91),
+        SIMDE_FLOAT16_VALUE(    12.62), SIMDE_FLOAT16_VALUE(   -51.69), SIMDE_FLOAT16_VALUE(   -10.08), SIMDE_FLOAT16_VALUE(   -50.66),
+        SIMDE_FLOAT16_VALUE(   -67.75), SIMDE_FLOAT16_VALUE(   -37.88), SIMDE_FLOAT16_VALUE(    20.28), SIMDE_FLOAT16_VALUE(    92.31),
+        SIMDE_FLOAT16_VALUE(   -66.88), SIMDE_FLOAT16_VALUE(    40.41), SIMDE_FLOAT16_VALUE(   -98.94), SIMDE_FLOAT16_VALUE(    33.59),
+        SIMDE_FLOAT16_VALUE(    20.70), SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(   -67.69), SIMDE_FLOAT16_VALUE(   -20.31),
+        SIMDE_FLOAT16_VALUE(    93.31), SIMDE_FLOAT16_VALUE(   -33.53), SIMDE_FLOAT16_VALUE(    34.56), SIMDE_FLOAT16_VALUE(   -71.06),
+        SIMDE_FLOAT16_VALUE(   -60.84), SIMDE_FLOAT16_VALUE(    99.38), SIMDE_FLOAT16_VALUE(   -27.12), SIMDE_FLOAT16_VALUE(    50.19),
+        SIMDE_FLOAT16_VALUE(    84.56), SIMDE_FLOAT16_VALUE(    99.25), SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(   -42.72) },
+      { SIMDE_FLOAT16_VALUE(   -33.06), SIMDE_FLOAT16_VALUE(   -30.30), SIMDE_FLOAT16_VALUE(    68.88), SIMDE_FLOAT16_VALUE(   -13.02),
+        SIMDE_FLOAT16_VALUE(    67.50), SIMDE_FLOAT16_VALUE(   -87.56), SIMDE_FLOAT16_VALUE(    40.50), SIMDE_FLOAT16_VALUE(    76.25),
+        SIMDE_FLOAT16_VALUE(   -91.06), SIMDE_FLOAT16_VALUE(    -5.75), SIMDE_FLOAT16_VALUE(     6.15), SIMDE_FLOAT16_VALUE(   -76.00),
+        SIMDE_FLOAT16_VALUE(    91.81), SIMDE_FLOAT16_VALUE(   -92.00), SIMDE_FLOAT16_VALUE(    31.06), SIMDE_FLOAT16_VALUE(    21.45),
+        SIMDE_FLOAT16_VALUE(    92.56), SIMDE_FLOAT16_VALUE(    21.23), SIMDE_FLOAT16_VALUE(    59.44), SIMDE_FLOAT16_VALUE(   -79.69),
+        SIMDE_FLOAT16_VALUE(    28.81), SIMDE_FLOAT16_VALUE(   -27.53), SIMDE_FLOAT16_VALUE(    73.62), SIMDE_FLOAT16_VALUE(    18.23),
+        SIMDE_FLOAT16_VALUE(    17.80), SIMDE_FLOAT16_VALUE(    72.69), SIMDE_FLOAT16_VALUE(   -38.78), SIMDE_FLOAT16_VALUE(   -26.91),
+        SIMDE_FLOAT16_VALUE(    86.38), SIMDE_FLOAT16_VALUE(    30.55), SIMDE_FLOAT16_VALUE(    37.91), SIMDE_FLOAT16_VALUE(   -18.02) },
+      { SIMDE_FLOAT16_VALUE(    80.69), SIMDE_FLOAT16_VALUE(    10.68), SIMDE_FLOAT16_VALUE(    -0.61), SIMDE_FLOAT16_VALUE(   -91.19),
+        SIMDE_FLOAT16_VALUE(    28.39), SIMDE_FLOAT16_VALUE(    63.69), SIMDE_FLOAT16_VALUE(   -27.02), SIMDE_FLOAT16_VALUE(    60.44),
+        SIMDE_FLOAT16_VALUE(   -99.56), SIMDE_FLOAT16_VALUE(   -59.59), SIMDE_FLOAT16_VALUE(   -49.50), SIMDE_FLOAT16_VALUE(    25.81),
+        SIMDE_FLOAT16_VALUE(   -75.00), SIMDE_FLOAT16_VALUE(    79.69), SIMDE_FLOAT16_VALUE(   -60.97), SIMDE_FLOAT16_VALUE(    90.44),
+        SIMDE_FLOAT16_VALUE(   -23.59), SIMDE_FLOAT16_VALUE(    68.25), SIMDE_FLOAT16_VALUE(   -75.00), SIMDE_FLOAT16_VALUE(    26.20),
+        SIMDE_FLOAT16_VALUE(    64.19), SIMDE_FLOAT16_VALUE(    -9.46), SIMDE_FLOAT16_VALUE(     0.74), SIMDE_FLOAT16_VALUE(    94.50),
+        SIMDE_FLOAT16_VALUE(   -58.97), SIMDE_FLOAT16_VALUE(   -10.36), SIMDE_FLOAT16_VALUE(   -27.39), SIMDE_FLOAT16_VALUE(    89.19),
+        SIMDE_FLOAT16_VALUE(    59.66), SIMDE_FLOAT16_VALUE(   -18.38), SIMDE_FLOAT16_VALUE(    76.12), SIMDE_FLOAT16_VALUE(   -27.64) },
+      { SIMDE_FLOAT16_VALUE(  2384.00), SIMDE_FLOAT16_VALUE(  2558.00), SIMDE_FLOAT16_VALUE( -3798.00), SIMDE_FLOAT16_VALUE(  -402.50),
+        SIMDE_FLOAT16_VALUE(   880.00), SIMDE_FLOAT16_VALUE(  4588.00), SIMDE_FLOAT16_VALUE(  -435.25), SIMDE_FLOAT16_VALUE( -3802.00),
+        SIMDE_FLOAT16_VALUE(  6068.00), SIMDE_FLOAT16_VALUE(   158.25), SIMDE_FLOAT16_VALUE(    75.19), SIMDE_FLOAT16_VALUE( -6988.00),
+        SIMDE_FLOAT16_VALUE( -6216.00), SIMDE_FLOAT16_VALUE( -3638.00), SIMDE_FLOAT16_VALUE( -3134.00), SIMDE_FLOAT16_VALUE(   811.00),
+        SIMDE_FLOAT16_VALUE(  1893.00), SIMDE_FLOAT16_VALUE( -1816.00), SIMDE_FLOAT16_VALUE( -4100.00), SIMDE_FLOAT16_VALUE(  1645.00),
+        SIMDE_FLOAT16_VALUE(  2752.00), SIMDE_FLOAT16_VALUE(   913.50), SIMDE_FLOAT16_VALUE(  2546.00), SIMDE_FLOAT16_VALUE( -1201.00),
+        SIMDE_FLOAT16_VALUE( -1142.00), SIMDE_FLOAT16_VALUE(  7212.00), SIMDE_FLOAT16_VALUE(  1025.00), SIMDE_FLOAT16_VALUE( -1261.00),
+        SIMDE_FLOAT16_VALUE(  7364.00), SIMDE_FLOAT16_VALUE(  3014.00), SIMDE_FLOAT16_VALUE( -2352.00), SIMDE_FLOAT16_VALUE(   742.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde__m512h c = simde_mm512_loadu_ph(test_vec[i].c);
+    simde_float16 r[32];
+    simde_mm512_storeu_ph(r, simde_mm512_fmadd_ph(a, b, c));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fmadd_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_fmadd_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_fmadd_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fmadd_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fmadd_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,1105 @@
+#define SIMDE_TEST_X86_AVX512_INSN getexp
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/getexp.h>
+
+static int
+test_simde_mm_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF },
+      {  -SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF } },
+    #endif
+    { { SIMDE_FLOAT32_C( -36.41), SIMDE_FLOAT32_C(-108.75), SIMDE_FLOAT32_C(-973.09), SIMDE_FLOAT32_C(   0.15) },
+      { SIMDE_FLOAT32_C(   5.00), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -3.00) } },
+    { { SIMDE_FLOAT32_C(   0.83), SIMDE_FLOAT32_C(  -0.51), SIMDE_FLOAT32_C(  -0.08), SIMDE_FLOAT32_C(   0.36) },
+      { SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(  -2.00) } },
+    { { SIMDE_FLOAT32_C(  -0.65), SIMDE_FLOAT32_C(   0.28), SIMDE_FLOAT32_C(-635.05), SIMDE_FLOAT32_C( 649.08) },
+      { SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00) } },
+    { { SIMDE_FLOAT32_C(  -0.16), SIMDE_FLOAT32_C( 576.96), SIMDE_FLOAT32_C( 694.85), SIMDE_FLOAT32_C(   0.36) },
+      { SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00) } },
+    { { SIMDE_FLOAT32_C(  -0.32), SIMDE_FLOAT32_C(-701.54), SIMDE_FLOAT32_C(  -0.92), SIMDE_FLOAT32_C(  -0.64) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C( 205.83), SIMDE_FLOAT32_C(  -0.85), SIMDE_FLOAT32_C(   0.61), SIMDE_FLOAT32_C( 319.10) },
+      { SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   8.00) } },
+    { { SIMDE_FLOAT32_C(   0.10), SIMDE_FLOAT32_C(   0.71), SIMDE_FLOAT32_C(   0.17), SIMDE_FLOAT32_C(  -0.95) },
+      { SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(  -1.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_getexp_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C( 895.31), SIMDE_FLOAT32_C(-687.28), SIMDE_FLOAT32_C( 751.53), SIMDE_FLOAT32_C( -44.78) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C( 895.31), SIMDE_FLOAT32_C(-687.28), SIMDE_FLOAT32_C( 751.53),   SIMDE_MATH_INFINITYF } },
+    #endif
+    { { SIMDE_FLOAT32_C(-695.23), SIMDE_FLOAT32_C( -10.90), SIMDE_FLOAT32_C(-100.10), SIMDE_FLOAT32_C(-508.80) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT32_C( 546.84), SIMDE_FLOAT32_C(  -0.40), SIMDE_FLOAT32_C(   0.82), SIMDE_FLOAT32_C(   0.47) },
+      { SIMDE_FLOAT32_C(-695.23), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(-100.10), SIMDE_FLOAT32_C(-508.80) } },
+    { { SIMDE_FLOAT32_C(  49.55), SIMDE_FLOAT32_C(-502.21), SIMDE_FLOAT32_C(-492.42), SIMDE_FLOAT32_C( 837.40) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT32_C(  -0.12), SIMDE_FLOAT32_C(   0.70), SIMDE_FLOAT32_C( 923.02), SIMDE_FLOAT32_C(   0.09) },
+      { SIMDE_FLOAT32_C(  49.55), SIMDE_FLOAT32_C(-502.21), SIMDE_FLOAT32_C(-492.42), SIMDE_FLOAT32_C(  -4.00) } },
+    { { SIMDE_FLOAT32_C(  60.84), SIMDE_FLOAT32_C(-861.34), SIMDE_FLOAT32_C(  -7.21), SIMDE_FLOAT32_C(-134.26) },
+      UINT8_C(   10),
+      { SIMDE_FLOAT32_C(-230.08), SIMDE_FLOAT32_C(-398.19), SIMDE_FLOAT32_C(   0.61), SIMDE_FLOAT32_C( 869.29) },
+      { SIMDE_FLOAT32_C(  60.84), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -7.21), SIMDE_FLOAT32_C(   9.00) } },
+    { { SIMDE_FLOAT32_C(-920.70), SIMDE_FLOAT32_C(-449.87), SIMDE_FLOAT32_C( 656.13), SIMDE_FLOAT32_C(-918.39) },
+      UINT8_C(    7),
+      { SIMDE_FLOAT32_C( 289.85), SIMDE_FLOAT32_C( 848.10), SIMDE_FLOAT32_C(   0.30), SIMDE_FLOAT32_C(  90.24) },
+      { SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(-918.39) } },
+    { { SIMDE_FLOAT32_C( 577.22), SIMDE_FLOAT32_C( 674.96), SIMDE_FLOAT32_C(-158.16), SIMDE_FLOAT32_C( 792.33) },
+      UINT8_C(    5),
+      { SIMDE_FLOAT32_C(-874.76), SIMDE_FLOAT32_C(   0.07), SIMDE_FLOAT32_C( 803.13), SIMDE_FLOAT32_C( 928.79) },
+      { SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C( 674.96), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C( 792.33) } },
+    { { SIMDE_FLOAT32_C( 829.94), SIMDE_FLOAT32_C(-591.31), SIMDE_FLOAT32_C( 122.27), SIMDE_FLOAT32_C(-427.22) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT32_C( 519.48), SIMDE_FLOAT32_C(-142.05), SIMDE_FLOAT32_C(   0.80), SIMDE_FLOAT32_C(   0.59) },
+      { SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C(-242.81), SIMDE_FLOAT32_C(-773.15), SIMDE_FLOAT32_C(-523.00), SIMDE_FLOAT32_C( 934.56) },
+      UINT8_C(   11),
+      { SIMDE_FLOAT32_C(   0.46), SIMDE_FLOAT32_C(-518.20), SIMDE_FLOAT32_C(  -0.17), SIMDE_FLOAT32_C(  -0.50) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(-523.00), SIMDE_FLOAT32_C(  -1.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_getexp_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    1),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF },
+      {  -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    #endif
+    { UINT8_C(    9),
+      { SIMDE_FLOAT32_C( 222.42), SIMDE_FLOAT32_C( 599.55), SIMDE_FLOAT32_C(  -0.52), SIMDE_FLOAT32_C(   0.10) },
+      { SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -4.00) } },
+    { UINT8_C(    4),
+      { SIMDE_FLOAT32_C(-289.36), SIMDE_FLOAT32_C(-992.96), SIMDE_FLOAT32_C(-970.72), SIMDE_FLOAT32_C( 973.72) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT32_C(  -0.19), SIMDE_FLOAT32_C( -24.47), SIMDE_FLOAT32_C(   0.93), SIMDE_FLOAT32_C(  -0.84) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT32_C(  -0.56), SIMDE_FLOAT32_C(-146.67), SIMDE_FLOAT32_C(-285.61), SIMDE_FLOAT32_C( 794.71) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00) } },
+    { UINT8_C(    9),
+      { SIMDE_FLOAT32_C(   0.46), SIMDE_FLOAT32_C( 396.19), SIMDE_FLOAT32_C(-334.65), SIMDE_FLOAT32_C( 244.45) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   7.00) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT32_C(  -0.40), SIMDE_FLOAT32_C(-631.56), SIMDE_FLOAT32_C( 871.26), SIMDE_FLOAT32_C(  -0.30) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -2.00) } },
+    { UINT8_C(    6),
+      { SIMDE_FLOAT32_C( 180.14), SIMDE_FLOAT32_C(-871.82), SIMDE_FLOAT32_C(   0.26), SIMDE_FLOAT32_C(-588.45) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_getexp_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00) },
+      {   -SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY } },
+    #endif
+    { { SIMDE_FLOAT64_C(  84.39), SIMDE_FLOAT64_C(   0.55) },
+      { SIMDE_FLOAT64_C(   6.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C(-476.51), SIMDE_FLOAT64_C(-339.28) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   8.00) } },
+    { { SIMDE_FLOAT64_C( 336.98), SIMDE_FLOAT64_C(-223.06) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   7.00) } },
+    { { SIMDE_FLOAT64_C(   0.90), SIMDE_FLOAT64_C(  -0.36) },
+      { SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -2.00) } },
+    { { SIMDE_FLOAT64_C( 272.09), SIMDE_FLOAT64_C( 169.52) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   7.00) } },
+    { { SIMDE_FLOAT64_C(  -0.25), SIMDE_FLOAT64_C(   0.90) },
+      { SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C( 444.05), SIMDE_FLOAT64_C(   0.21) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -3.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_getexp_pd(a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 731.83), SIMDE_FLOAT64_C( 362.82) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00) },
+      {   -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( 362.82) } },
+    #endif
+    { { SIMDE_FLOAT64_C(-298.99), SIMDE_FLOAT64_C(-562.29) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C(-953.82), SIMDE_FLOAT64_C(   0.12) },
+      { SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(-562.29) } },
+    { { SIMDE_FLOAT64_C(  75.45), SIMDE_FLOAT64_C(-269.42) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 651.03), SIMDE_FLOAT64_C(   0.16) },
+      { SIMDE_FLOAT64_C(  75.45), SIMDE_FLOAT64_C(  -3.00) } },
+    { { SIMDE_FLOAT64_C( 108.72), SIMDE_FLOAT64_C( 900.54) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C(   0.42), SIMDE_FLOAT64_C(  -0.20) },
+      { SIMDE_FLOAT64_C( 108.72), SIMDE_FLOAT64_C( 900.54) } },
+    { { SIMDE_FLOAT64_C( 376.23), SIMDE_FLOAT64_C( 178.41) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C(  -0.63), SIMDE_FLOAT64_C(   0.95) },
+      { SIMDE_FLOAT64_C( 376.23), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C(-482.82), SIMDE_FLOAT64_C( 874.44) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C(   0.72), SIMDE_FLOAT64_C(-985.87) },
+      { SIMDE_FLOAT64_C(-482.82), SIMDE_FLOAT64_C( 874.44) } },
+    { { SIMDE_FLOAT64_C(-187.22), SIMDE_FLOAT64_C(-402.79) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C(   0.35), SIMDE_FLOAT64_C(  -0.75) },
+      { SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(-402.79) } },
+    { { SIMDE_FLOAT64_C( -58.32), SIMDE_FLOAT64_C( 587.64) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C(  -0.30), SIMDE_FLOAT64_C(-952.78) },
+      { SIMDE_FLOAT64_C( -58.32), SIMDE_FLOAT64_C(   9.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_getexp_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    0),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    #endif
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C(  51.45), SIMDE_FLOAT64_C(  -0.21) },
+      { SIMDE_FLOAT64_C(   5.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(  14.98), SIMDE_FLOAT64_C(  -0.59) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C( 492.73), SIMDE_FLOAT64_C( 564.29) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(-197.49), SIMDE_FLOAT64_C( 169.37) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   7.00) } },
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C( 393.40), SIMDE_FLOAT64_C(-612.68) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(   0.45), SIMDE_FLOAT64_C(  -0.12) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -4.00) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(-885.70), SIMDE_FLOAT64_C(-815.31) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   9.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_getexp_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75) },
+      {  -SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -1.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(-480.00), SIMDE_FLOAT32_C( 348.35), SIMDE_FLOAT32_C( 163.65), SIMDE_FLOAT32_C( 104.30),
+        SIMDE_FLOAT32_C(   0.60), SIMDE_FLOAT32_C( 161.09), SIMDE_FLOAT32_C(  -0.18), SIMDE_FLOAT32_C(   0.35) },
+      { SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   6.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(  -2.00) } },
+    { { SIMDE_FLOAT32_C(   0.62), SIMDE_FLOAT32_C(   0.02), SIMDE_FLOAT32_C(   0.16), SIMDE_FLOAT32_C(  -0.89),
+        SIMDE_FLOAT32_C(   0.59), SIMDE_FLOAT32_C(  -0.24), SIMDE_FLOAT32_C( 900.75), SIMDE_FLOAT32_C( 991.25) },
+      { SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -6.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00) } },
+    { { SIMDE_FLOAT32_C(  -0.28), SIMDE_FLOAT32_C(   0.54), SIMDE_FLOAT32_C(   0.18), SIMDE_FLOAT32_C( 525.19),
+        SIMDE_FLOAT32_C(-214.50), SIMDE_FLOAT32_C(  -0.82), SIMDE_FLOAT32_C(-212.17), SIMDE_FLOAT32_C(  -0.17) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -3.00) } },
+    { { SIMDE_FLOAT32_C( 949.59), SIMDE_FLOAT32_C(  -0.75), SIMDE_FLOAT32_C( 530.73), SIMDE_FLOAT32_C(-461.62),
+        SIMDE_FLOAT32_C(-299.24), SIMDE_FLOAT32_C(  97.74), SIMDE_FLOAT32_C(  -0.60), SIMDE_FLOAT32_C(   0.30) },
+      { SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00) } },
+    { { SIMDE_FLOAT32_C(  -0.27), SIMDE_FLOAT32_C(-885.92), SIMDE_FLOAT32_C( -16.25), SIMDE_FLOAT32_C(-452.13),
+        SIMDE_FLOAT32_C(  -0.58), SIMDE_FLOAT32_C(  -0.22), SIMDE_FLOAT32_C( 239.84), SIMDE_FLOAT32_C(   0.57) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C(-155.15), SIMDE_FLOAT32_C( 839.74), SIMDE_FLOAT32_C(-948.65), SIMDE_FLOAT32_C( 185.19),
+        SIMDE_FLOAT32_C(  -0.88), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(   0.36), SIMDE_FLOAT32_C(-412.21) },
+      { SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   7.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   8.00) } },
+    { { SIMDE_FLOAT32_C(   0.79), SIMDE_FLOAT32_C(-916.24), SIMDE_FLOAT32_C(   0.76), SIMDE_FLOAT32_C( 451.11),
+        SIMDE_FLOAT32_C( 437.75), SIMDE_FLOAT32_C(  38.20), SIMDE_FLOAT32_C(   0.86), SIMDE_FLOAT32_C(-509.34) },
+      { SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   5.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   8.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_getexp_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C( 856.69), SIMDE_FLOAT32_C( 641.35), SIMDE_FLOAT32_C( 889.95), SIMDE_FLOAT32_C( 553.00),
+        SIMDE_FLOAT32_C(-849.31), SIMDE_FLOAT32_C( 312.35), SIMDE_FLOAT32_C(  67.69), SIMDE_FLOAT32_C(-550.15) },
+      UINT8_C(   39),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75) },
+      {  -SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 553.00),
+        SIMDE_FLOAT32_C(-849.31), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  67.69), SIMDE_FLOAT32_C(-550.15) } },
+    #endif
+    { { SIMDE_FLOAT32_C(-802.01), SIMDE_FLOAT32_C( 338.09), SIMDE_FLOAT32_C(-339.43), SIMDE_FLOAT32_C( 282.89),
+        SIMDE_FLOAT32_C(-819.07), SIMDE_FLOAT32_C( 116.11), SIMDE_FLOAT32_C( 263.30), SIMDE_FLOAT32_C(-401.63) },
+      UINT8_C(  156),
+      { SIMDE_FLOAT32_C(   0.62), SIMDE_FLOAT32_C(  -0.66), SIMDE_FLOAT32_C( 958.45), SIMDE_FLOAT32_C(  -0.99),
+        SIMDE_FLOAT32_C( 916.77), SIMDE_FLOAT32_C(-237.74), SIMDE_FLOAT32_C(  -0.41), SIMDE_FLOAT32_C(  -0.56) },
+      { SIMDE_FLOAT32_C(-802.01), SIMDE_FLOAT32_C( 338.09), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C( 116.11), SIMDE_FLOAT32_C( 263.30), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C( 991.86), SIMDE_FLOAT32_C(-929.26), SIMDE_FLOAT32_C(  68.20), SIMDE_FLOAT32_C( 601.75),
+        SIMDE_FLOAT32_C(-594.42), SIMDE_FLOAT32_C(-934.79), SIMDE_FLOAT32_C(-183.13), SIMDE_FLOAT32_C(-658.24) },
+      UINT8_C(  204),
+      { SIMDE_FLOAT32_C(  -0.52), SIMDE_FLOAT32_C( 494.72), SIMDE_FLOAT32_C( 553.91), SIMDE_FLOAT32_C(   0.93),
+        SIMDE_FLOAT32_C( 448.17), SIMDE_FLOAT32_C(  -0.27), SIMDE_FLOAT32_C(-650.46), SIMDE_FLOAT32_C(-960.63) },
+      { SIMDE_FLOAT32_C( 991.86), SIMDE_FLOAT32_C(-929.26), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(-594.42), SIMDE_FLOAT32_C(-934.79), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00) } },
+    { { SIMDE_FLOAT32_C( 302.08), SIMDE_FLOAT32_C(-613.17), SIMDE_FLOAT32_C(-412.60), SIMDE_FLOAT32_C( 520.94),
+        SIMDE_FLOAT32_C( 333.99), SIMDE_FLOAT32_C(-504.57), SIMDE_FLOAT32_C(-720.13), SIMDE_FLOAT32_C(-569.95) },
+      UINT8_C(  179),
+      { SIMDE_FLOAT32_C(   0.49), SIMDE_FLOAT32_C( 192.37), SIMDE_FLOAT32_C( 663.69), SIMDE_FLOAT32_C( 769.55),
+        SIMDE_FLOAT32_C(-568.94), SIMDE_FLOAT32_C( 830.68), SIMDE_FLOAT32_C( 162.77), SIMDE_FLOAT32_C(   0.08) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(-412.60), SIMDE_FLOAT32_C( 520.94),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(-720.13), SIMDE_FLOAT32_C(  -4.00) } },
+    { { SIMDE_FLOAT32_C(-490.67), SIMDE_FLOAT32_C( 284.53), SIMDE_FLOAT32_C(-925.04), SIMDE_FLOAT32_C(-956.81),
+        SIMDE_FLOAT32_C(-995.52), SIMDE_FLOAT32_C(-578.02), SIMDE_FLOAT32_C(-967.70), SIMDE_FLOAT32_C(-434.20) },
+      UINT8_C(   81),
+      { SIMDE_FLOAT32_C(  -0.29), SIMDE_FLOAT32_C(  -0.99), SIMDE_FLOAT32_C(  80.51), SIMDE_FLOAT32_C(   0.13),
+        SIMDE_FLOAT32_C(   0.65), SIMDE_FLOAT32_C(   0.20), SIMDE_FLOAT32_C(  -0.83), SIMDE_FLOAT32_C(  -0.38) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C( 284.53), SIMDE_FLOAT32_C(-925.04), SIMDE_FLOAT32_C(-956.81),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(-578.02), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(-434.20) } },
+    { { SIMDE_FLOAT32_C(-397.51), SIMDE_FLOAT32_C( 894.51), SIMDE_FLOAT32_C( 657.71), SIMDE_FLOAT32_C( 421.18),
+        SIMDE_FLOAT32_C( -73.19), SIMDE_FLOAT32_C(-751.64), SIMDE_FLOAT32_C( 137.49), SIMDE_FLOAT32_C(-727.72) },
+      UINT8_C(  135),
+      { SIMDE_FLOAT32_C(  -0.37), SIMDE_FLOAT32_C(   0.16), SIMDE_FLOAT32_C(   0.42), SIMDE_FLOAT32_C(   0.48),
+        SIMDE_FLOAT32_C( 290.35), SIMDE_FLOAT32_C(-732.25), SIMDE_FLOAT32_C( 912.01), SIMDE_FLOAT32_C(   0.74) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C( 421.18),
+        SIMDE_FLOAT32_C( -73.19), SIMDE_FLOAT32_C(-751.64), SIMDE_FLOAT32_C( 137.49), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C(-247.24), SIMDE_FLOAT32_C( 968.95), SIMDE_FLOAT32_C(-827.49), SIMDE_FLOAT32_C( 465.41),
+        SIMDE_FLOAT32_C(  13.03), SIMDE_FLOAT32_C(-412.64), SIMDE_FLOAT32_C(-979.07), SIMDE_FLOAT32_C(-887.02) },
+      UINT8_C(  151),
+      { SIMDE_FLOAT32_C( 171.81), SIMDE_FLOAT32_C(   0.27), SIMDE_FLOAT32_C(   0.23), SIMDE_FLOAT32_C(   0.05),
+        SIMDE_FLOAT32_C(   0.66), SIMDE_FLOAT32_C(  -0.84), SIMDE_FLOAT32_C(  -0.08), SIMDE_FLOAT32_C(   0.44) },
+      { SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C( 465.41),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(-412.64), SIMDE_FLOAT32_C(-979.07), SIMDE_FLOAT32_C(  -2.00) } },
+    { { SIMDE_FLOAT32_C( 263.82), SIMDE_FLOAT32_C(-640.70), SIMDE_FLOAT32_C( 262.64), SIMDE_FLOAT32_C(  -5.68),
+        SIMDE_FLOAT32_C( 531.72), SIMDE_FLOAT32_C( 421.94), SIMDE_FLOAT32_C( 676.73), SIMDE_FLOAT32_C( 961.40) },
+      UINT8_C(  252),
+      { SIMDE_FLOAT32_C(  -0.13), SIMDE_FLOAT32_C(   0.05), SIMDE_FLOAT32_C( 704.39), SIMDE_FLOAT32_C(   0.89),
+        SIMDE_FLOAT32_C(-596.48), SIMDE_FLOAT32_C(-676.77), SIMDE_FLOAT32_C(-490.89), SIMDE_FLOAT32_C( 700.13) },
+      { SIMDE_FLOAT32_C( 263.82), SIMDE_FLOAT32_C(-640.70), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   9.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_getexp_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(   90),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75) },
+      { SIMDE_FLOAT32_C(   0.00),  -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(   0.00) } },
+    #endif
+    { UINT8_C(  189),
+      { SIMDE_FLOAT32_C(-109.03), SIMDE_FLOAT32_C( 817.02), SIMDE_FLOAT32_C(  -0.67), SIMDE_FLOAT32_C( 673.32),
+        SIMDE_FLOAT32_C(-181.74), SIMDE_FLOAT32_C( 559.15), SIMDE_FLOAT32_C( 502.68), SIMDE_FLOAT32_C(  -0.79) },
+      { SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { UINT8_C(  209),
+      { SIMDE_FLOAT32_C(  -0.23), SIMDE_FLOAT32_C(-132.46), SIMDE_FLOAT32_C( -56.23), SIMDE_FLOAT32_C(  -0.13),
+        SIMDE_FLOAT32_C( 428.08), SIMDE_FLOAT32_C( 258.53), SIMDE_FLOAT32_C( 299.18), SIMDE_FLOAT32_C(   0.30) },
+      { SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -2.00) } },
+    { UINT8_C(  107),
+      { SIMDE_FLOAT32_C(   0.41), SIMDE_FLOAT32_C( 949.18), SIMDE_FLOAT32_C(   0.10), SIMDE_FLOAT32_C(  -0.36),
+        SIMDE_FLOAT32_C(  -0.49), SIMDE_FLOAT32_C(  -0.71), SIMDE_FLOAT32_C(   0.99), SIMDE_FLOAT32_C(-568.74) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -2.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(   23),
+      { SIMDE_FLOAT32_C(   0.66), SIMDE_FLOAT32_C(   0.51), SIMDE_FLOAT32_C(-808.26), SIMDE_FLOAT32_C( 476.04),
+        SIMDE_FLOAT32_C(  -0.87), SIMDE_FLOAT32_C(   0.51), SIMDE_FLOAT32_C(-269.99), SIMDE_FLOAT32_C( 741.01) },
+      { SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(   65),
+      { SIMDE_FLOAT32_C(   0.13), SIMDE_FLOAT32_C(-276.32), SIMDE_FLOAT32_C(   0.74), SIMDE_FLOAT32_C( 813.45),
+        SIMDE_FLOAT32_C(   0.71), SIMDE_FLOAT32_C(-336.27), SIMDE_FLOAT32_C(   0.06), SIMDE_FLOAT32_C(  -0.99) },
+      { SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -5.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(  198),
+      { SIMDE_FLOAT32_C(-286.21), SIMDE_FLOAT32_C(  -0.73), SIMDE_FLOAT32_C(   0.40), SIMDE_FLOAT32_C(-219.29),
+        SIMDE_FLOAT32_C(-848.70), SIMDE_FLOAT32_C(-378.69), SIMDE_FLOAT32_C(-774.31), SIMDE_FLOAT32_C( 780.18) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00) } },
+    { UINT8_C(  196),
+      { SIMDE_FLOAT32_C( 739.12), SIMDE_FLOAT32_C(  -0.35), SIMDE_FLOAT32_C(   0.60), SIMDE_FLOAT32_C(  -0.57),
+        SIMDE_FLOAT32_C( 791.64), SIMDE_FLOAT32_C( 660.89), SIMDE_FLOAT32_C(-515.84), SIMDE_FLOAT32_C( 645.57) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_getexp_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY },
+      {   -SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY } },
+    #endif
+    { { SIMDE_FLOAT64_C( -87.69), SIMDE_FLOAT64_C( 787.29), SIMDE_FLOAT64_C(  -0.09), SIMDE_FLOAT64_C(  -0.25) },
+      { SIMDE_FLOAT64_C(   6.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -4.00), SIMDE_FLOAT64_C(  -2.00) } },
+    { { SIMDE_FLOAT64_C( 682.21), SIMDE_FLOAT64_C(-872.08), SIMDE_FLOAT64_C(   0.52), SIMDE_FLOAT64_C(   0.89) },
+      { SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C(  -0.13), SIMDE_FLOAT64_C( 828.58), SIMDE_FLOAT64_C(-231.22), SIMDE_FLOAT64_C(   0.53) },
+      { SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C(  -0.33), SIMDE_FLOAT64_C(   0.74), SIMDE_FLOAT64_C(  -0.35), SIMDE_FLOAT64_C( 475.58) },
+      { SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   8.00) } },
+    { { SIMDE_FLOAT64_C(  -0.73), SIMDE_FLOAT64_C(   0.66), SIMDE_FLOAT64_C(  -0.56), SIMDE_FLOAT64_C(-254.48) },
+      { SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   7.00) } },
+    { { SIMDE_FLOAT64_C( 892.26), SIMDE_FLOAT64_C(   0.62), SIMDE_FLOAT64_C(  85.40), SIMDE_FLOAT64_C(  -0.58) },
+      { SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   6.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C(  -0.08), SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C(  -0.49), SIMDE_FLOAT64_C(   0.04) },
+      { SIMDE_FLOAT64_C(  -4.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -5.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_getexp_pd(a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 178.52), SIMDE_FLOAT64_C( 633.65), SIMDE_FLOAT64_C( 867.66), SIMDE_FLOAT64_C( 943.59) },
+      UINT8_C(   14),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C( 178.52),   -SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY } },
+    #endif
+    { { SIMDE_FLOAT64_C( 187.47), SIMDE_FLOAT64_C( 133.90), SIMDE_FLOAT64_C( 283.86), SIMDE_FLOAT64_C(-167.47) },
+      UINT8_C(    4),
+      { SIMDE_FLOAT64_C(-155.84), SIMDE_FLOAT64_C(  -0.78), SIMDE_FLOAT64_C(  -0.35), SIMDE_FLOAT64_C(   0.34) },
+      { SIMDE_FLOAT64_C( 187.47), SIMDE_FLOAT64_C( 133.90), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(-167.47) } },
+    { { SIMDE_FLOAT64_C( 372.86), SIMDE_FLOAT64_C( 845.35), SIMDE_FLOAT64_C( 571.37), SIMDE_FLOAT64_C(-960.09) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT64_C(   0.57), SIMDE_FLOAT64_C(   0.19), SIMDE_FLOAT64_C(  -0.42), SIMDE_FLOAT64_C(-374.56) },
+      { SIMDE_FLOAT64_C( 372.86), SIMDE_FLOAT64_C( 845.35), SIMDE_FLOAT64_C( 571.37), SIMDE_FLOAT64_C(   8.00) } },
+    { { SIMDE_FLOAT64_C( 568.43), SIMDE_FLOAT64_C( 551.29), SIMDE_FLOAT64_C( 413.13), SIMDE_FLOAT64_C(-838.83) },
+      UINT8_C(    4),
+      { SIMDE_FLOAT64_C(-276.19), SIMDE_FLOAT64_C(   0.30), SIMDE_FLOAT64_C( 448.81), SIMDE_FLOAT64_C( 656.35) },
+      { SIMDE_FLOAT64_C( 568.43), SIMDE_FLOAT64_C( 551.29), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(-838.83) } },
+    { { SIMDE_FLOAT64_C(-793.53), SIMDE_FLOAT64_C(-227.18), SIMDE_FLOAT64_C( 453.91), SIMDE_FLOAT64_C(  15.92) },
+      UINT8_C(    5),
+      { SIMDE_FLOAT64_C(   0.82), SIMDE_FLOAT64_C(  -0.83), SIMDE_FLOAT64_C( 688.17), SIMDE_FLOAT64_C( 122.85) },
+      { SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(-227.18), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  15.92) } },
+    { { SIMDE_FLOAT64_C(  83.79), SIMDE_FLOAT64_C(-139.29), SIMDE_FLOAT64_C( 542.20), SIMDE_FLOAT64_C(-349.94) },
+      UINT8_C(    4),
+      { SIMDE_FLOAT64_C( 488.21), SIMDE_FLOAT64_C(  -0.98), SIMDE_FLOAT64_C(  -0.08), SIMDE_FLOAT64_C(-378.60) },
+      { SIMDE_FLOAT64_C(  83.79), SIMDE_FLOAT64_C(-139.29), SIMDE_FLOAT64_C(  -4.00), SIMDE_FLOAT64_C(-349.94) } },
+    { { SIMDE_FLOAT64_C( 715.85), SIMDE_FLOAT64_C( 600.72), SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C( -21.68) },
+      UINT8_C(    6),
+      { SIMDE_FLOAT64_C( 478.79), SIMDE_FLOAT64_C(-588.20), SIMDE_FLOAT64_C(   0.15), SIMDE_FLOAT64_C(   0.19) },
+      { SIMDE_FLOAT64_C( 715.85), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C( -21.68) } },
+    { { SIMDE_FLOAT64_C( 902.76), SIMDE_FLOAT64_C(-485.34), SIMDE_FLOAT64_C(-307.64), SIMDE_FLOAT64_C(-737.12) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C(-355.89), SIMDE_FLOAT64_C(   0.85), SIMDE_FLOAT64_C(  -0.42), SIMDE_FLOAT64_C(-661.78) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(-485.34), SIMDE_FLOAT64_C(-307.64), SIMDE_FLOAT64_C(-737.12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_getexp_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(   12),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY } },
+    #endif
+    { UINT8_C(   11),
+      { SIMDE_FLOAT64_C(-186.89), SIMDE_FLOAT64_C(-524.91), SIMDE_FLOAT64_C( 434.04), SIMDE_FLOAT64_C(  -0.53) },
+      { SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C(-593.02), SIMDE_FLOAT64_C(-223.95), SIMDE_FLOAT64_C(  -0.07), SIMDE_FLOAT64_C( 126.84) },
+      { SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    0),
+      { SIMDE_FLOAT64_C( 875.02), SIMDE_FLOAT64_C(  -0.69), SIMDE_FLOAT64_C(-525.52), SIMDE_FLOAT64_C( 649.92) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    9),
+      { SIMDE_FLOAT64_C( 325.39), SIMDE_FLOAT64_C(   0.67), SIMDE_FLOAT64_C(-994.77), SIMDE_FLOAT64_C(-797.54) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   9.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C(   0.20), SIMDE_FLOAT64_C(   0.01), SIMDE_FLOAT64_C(   0.12), SIMDE_FLOAT64_C(   0.68) },
+      { SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C(  -7.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(   14),
+      { SIMDE_FLOAT64_C(   0.48), SIMDE_FLOAT64_C( 772.00), SIMDE_FLOAT64_C(-138.45), SIMDE_FLOAT64_C(  -0.17) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(  -3.00) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(-409.44), SIMDE_FLOAT64_C(   0.72), SIMDE_FLOAT64_C(-550.57), SIMDE_FLOAT64_C(   0.39) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_getexp_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75) },
+      {  -SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -1.00),
+         -SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -1.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C(   0.45), SIMDE_FLOAT32_C(  47.77), SIMDE_FLOAT32_C(   0.59), SIMDE_FLOAT32_C(  -0.81),
+        SIMDE_FLOAT32_C( 502.25), SIMDE_FLOAT32_C(  -0.37), SIMDE_FLOAT32_C(-581.74), SIMDE_FLOAT32_C( 822.72),
+        SIMDE_FLOAT32_C(-542.21), SIMDE_FLOAT32_C(  -0.26), SIMDE_FLOAT32_C( 182.52), SIMDE_FLOAT32_C(  -0.02),
+        SIMDE_FLOAT32_C(   0.34), SIMDE_FLOAT32_C(-675.18), SIMDE_FLOAT32_C(   0.94), SIMDE_FLOAT32_C(  -0.57) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   5.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -6.00),
+        SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C(   0.46), SIMDE_FLOAT32_C(-779.34), SIMDE_FLOAT32_C(   0.28), SIMDE_FLOAT32_C(  -0.58),
+        SIMDE_FLOAT32_C(-866.75), SIMDE_FLOAT32_C(   0.63), SIMDE_FLOAT32_C(  -0.99), SIMDE_FLOAT32_C(-895.40),
+        SIMDE_FLOAT32_C( 399.83), SIMDE_FLOAT32_C( 995.05), SIMDE_FLOAT32_C(-976.24), SIMDE_FLOAT32_C(   0.32),
+        SIMDE_FLOAT32_C(   0.74), SIMDE_FLOAT32_C(   0.76), SIMDE_FLOAT32_C(   0.36), SIMDE_FLOAT32_C(   0.61) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C(-437.95), SIMDE_FLOAT32_C(-796.88), SIMDE_FLOAT32_C(  -0.71), SIMDE_FLOAT32_C( 372.23),
+        SIMDE_FLOAT32_C( 812.13), SIMDE_FLOAT32_C( 133.93), SIMDE_FLOAT32_C(-843.72), SIMDE_FLOAT32_C(-264.08),
+        SIMDE_FLOAT32_C(  -0.14), SIMDE_FLOAT32_C(   0.61), SIMDE_FLOAT32_C(  -0.16), SIMDE_FLOAT32_C(-308.28),
+        SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(  -0.86), SIMDE_FLOAT32_C(   0.11), SIMDE_FLOAT32_C( 798.51) },
+      { SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(   9.00) } },
+    { { SIMDE_FLOAT32_C(  -0.86), SIMDE_FLOAT32_C(-208.29), SIMDE_FLOAT32_C( 368.64), SIMDE_FLOAT32_C( 457.47),
+        SIMDE_FLOAT32_C( 744.39), SIMDE_FLOAT32_C(  -0.37), SIMDE_FLOAT32_C(  -0.46), SIMDE_FLOAT32_C(-678.15),
+        SIMDE_FLOAT32_C( -35.19), SIMDE_FLOAT32_C( 816.65), SIMDE_FLOAT32_C(-402.20), SIMDE_FLOAT32_C(   0.33),
+        SIMDE_FLOAT32_C(-884.10), SIMDE_FLOAT32_C(  -0.12), SIMDE_FLOAT32_C(-106.68), SIMDE_FLOAT32_C( 639.57) },
+      { SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(   5.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -2.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(   9.00) } },
+    { { SIMDE_FLOAT32_C( 201.32), SIMDE_FLOAT32_C(   0.61), SIMDE_FLOAT32_C(  -0.09), SIMDE_FLOAT32_C(-730.67),
+        SIMDE_FLOAT32_C(-348.05), SIMDE_FLOAT32_C(   0.58), SIMDE_FLOAT32_C(-738.36), SIMDE_FLOAT32_C(  -0.63),
+        SIMDE_FLOAT32_C(  28.72), SIMDE_FLOAT32_C(  -0.31), SIMDE_FLOAT32_C(   0.36), SIMDE_FLOAT32_C(  -0.41),
+        SIMDE_FLOAT32_C( 875.85), SIMDE_FLOAT32_C(-776.38), SIMDE_FLOAT32_C(   0.48), SIMDE_FLOAT32_C(  -0.14) },
+      { SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -2.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -3.00) } },
+    { { SIMDE_FLOAT32_C(  -0.24), SIMDE_FLOAT32_C(  -0.79), SIMDE_FLOAT32_C(-452.65), SIMDE_FLOAT32_C(   0.92),
+        SIMDE_FLOAT32_C(   0.64), SIMDE_FLOAT32_C(   0.37), SIMDE_FLOAT32_C( 938.38), SIMDE_FLOAT32_C(-589.79),
+        SIMDE_FLOAT32_C( 816.23), SIMDE_FLOAT32_C(  -0.96), SIMDE_FLOAT32_C(   0.35), SIMDE_FLOAT32_C(  -0.22),
+        SIMDE_FLOAT32_C(  -0.95), SIMDE_FLOAT32_C(-730.36), SIMDE_FLOAT32_C(  -0.08), SIMDE_FLOAT32_C(   0.86) },
+      { SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -3.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C(-258.39), SIMDE_FLOAT32_C( 837.70), SIMDE_FLOAT32_C(  -0.06), SIMDE_FLOAT32_C(  -0.96),
+        SIMDE_FLOAT32_C( 560.70), SIMDE_FLOAT32_C(-199.22), SIMDE_FLOAT32_C(-272.65), SIMDE_FLOAT32_C(  -0.88),
+        SIMDE_FLOAT32_C( 814.25), SIMDE_FLOAT32_C(   0.48), SIMDE_FLOAT32_C(   0.92), SIMDE_FLOAT32_C(   0.08),
+        SIMDE_FLOAT32_C(   0.71), SIMDE_FLOAT32_C( 993.00), SIMDE_FLOAT32_C( 487.74), SIMDE_FLOAT32_C(   0.83) },
+      { SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -5.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -4.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -1.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_getexp_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C( 683.43), SIMDE_FLOAT32_C( 236.85), SIMDE_FLOAT32_C(-215.19), SIMDE_FLOAT32_C(-204.31),
+        SIMDE_FLOAT32_C(-303.11), SIMDE_FLOAT32_C(  26.43), SIMDE_FLOAT32_C(-560.14), SIMDE_FLOAT32_C( 954.85),
+        SIMDE_FLOAT32_C( 219.05), SIMDE_FLOAT32_C(-871.42), SIMDE_FLOAT32_C( 257.81), SIMDE_FLOAT32_C(-596.21),
+        SIMDE_FLOAT32_C( 555.15), SIMDE_FLOAT32_C(-298.92), SIMDE_FLOAT32_C( 231.65), SIMDE_FLOAT32_C(-581.93) },
+      UINT16_C(42612),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75) },
+      { SIMDE_FLOAT32_C( 683.43), SIMDE_FLOAT32_C( 236.85),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-204.31),
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C( 954.85),
+        SIMDE_FLOAT32_C( 219.05),  -SIMDE_MATH_INFINITYF,   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-596.21),
+        SIMDE_FLOAT32_C( 555.15), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C( 231.65), SIMDE_FLOAT32_C(  -1.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C( 728.31), SIMDE_FLOAT32_C(-128.41), SIMDE_FLOAT32_C( 257.14), SIMDE_FLOAT32_C(-541.92),
+        SIMDE_FLOAT32_C( 264.04), SIMDE_FLOAT32_C( 684.38), SIMDE_FLOAT32_C(-594.90), SIMDE_FLOAT32_C( 250.06),
+        SIMDE_FLOAT32_C(  37.82), SIMDE_FLOAT32_C( 318.24), SIMDE_FLOAT32_C( 372.77), SIMDE_FLOAT32_C( 545.07),
+        SIMDE_FLOAT32_C( 805.71), SIMDE_FLOAT32_C(-501.92), SIMDE_FLOAT32_C( -55.84), SIMDE_FLOAT32_C( -33.70) },
+      UINT16_C(16130),
+      { SIMDE_FLOAT32_C(   0.68), SIMDE_FLOAT32_C(  -0.49), SIMDE_FLOAT32_C(-281.98), SIMDE_FLOAT32_C(   0.16),
+        SIMDE_FLOAT32_C(  -0.15), SIMDE_FLOAT32_C(  -0.90), SIMDE_FLOAT32_C(   0.45), SIMDE_FLOAT32_C(   0.24),
+        SIMDE_FLOAT32_C(-161.25), SIMDE_FLOAT32_C(  -0.21), SIMDE_FLOAT32_C( 245.59), SIMDE_FLOAT32_C(  -0.96),
+        SIMDE_FLOAT32_C(   0.39), SIMDE_FLOAT32_C(   0.40), SIMDE_FLOAT32_C(   0.28), SIMDE_FLOAT32_C(  -0.54) },
+      { SIMDE_FLOAT32_C( 728.31), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C( 257.14), SIMDE_FLOAT32_C(-541.92),
+        SIMDE_FLOAT32_C( 264.04), SIMDE_FLOAT32_C( 684.38), SIMDE_FLOAT32_C(-594.90), SIMDE_FLOAT32_C( 250.06),
+        SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C( -55.84), SIMDE_FLOAT32_C( -33.70) } },
+    { { SIMDE_FLOAT32_C( -79.84), SIMDE_FLOAT32_C(-851.90), SIMDE_FLOAT32_C( 701.28), SIMDE_FLOAT32_C( 798.81),
+        SIMDE_FLOAT32_C(-394.71), SIMDE_FLOAT32_C( 741.38), SIMDE_FLOAT32_C( 572.87), SIMDE_FLOAT32_C( 849.55),
+        SIMDE_FLOAT32_C( 341.39), SIMDE_FLOAT32_C( 523.24), SIMDE_FLOAT32_C( 183.37), SIMDE_FLOAT32_C(-777.55),
+        SIMDE_FLOAT32_C(-879.31), SIMDE_FLOAT32_C( 796.63), SIMDE_FLOAT32_C(-172.75), SIMDE_FLOAT32_C( -54.15) },
+      UINT16_C(45903),
+      { SIMDE_FLOAT32_C(-110.35), SIMDE_FLOAT32_C( 282.70), SIMDE_FLOAT32_C(  -0.71), SIMDE_FLOAT32_C(   0.53),
+        SIMDE_FLOAT32_C( 758.15), SIMDE_FLOAT32_C( 232.21), SIMDE_FLOAT32_C(  -0.65), SIMDE_FLOAT32_C(-652.97),
+        SIMDE_FLOAT32_C(  -0.62), SIMDE_FLOAT32_C(   0.47), SIMDE_FLOAT32_C(   0.90), SIMDE_FLOAT32_C(-887.76),
+        SIMDE_FLOAT32_C(  -0.98), SIMDE_FLOAT32_C(   0.26), SIMDE_FLOAT32_C(  -0.98), SIMDE_FLOAT32_C(  -0.42) },
+      { SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(-394.71), SIMDE_FLOAT32_C( 741.38), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C( 849.55),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C( 183.37), SIMDE_FLOAT32_C(-777.55),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(-172.75), SIMDE_FLOAT32_C(  -2.00) } },
+    { { SIMDE_FLOAT32_C(-849.47), SIMDE_FLOAT32_C(-624.08), SIMDE_FLOAT32_C( 955.32), SIMDE_FLOAT32_C( 587.30),
+        SIMDE_FLOAT32_C(-344.08), SIMDE_FLOAT32_C( 819.17), SIMDE_FLOAT32_C( 808.50), SIMDE_FLOAT32_C( 754.35),
+        SIMDE_FLOAT32_C( 457.95), SIMDE_FLOAT32_C(-276.76), SIMDE_FLOAT32_C( 702.99), SIMDE_FLOAT32_C( 964.16),
+        SIMDE_FLOAT32_C(-652.30), SIMDE_FLOAT32_C(-141.09), SIMDE_FLOAT32_C(-732.83), SIMDE_FLOAT32_C( 242.62) },
+      UINT16_C( 1560),
+      { SIMDE_FLOAT32_C(   0.17), SIMDE_FLOAT32_C( -96.56), SIMDE_FLOAT32_C(-560.45), SIMDE_FLOAT32_C(   0.15),
+        SIMDE_FLOAT32_C(  -0.70), SIMDE_FLOAT32_C(-540.75), SIMDE_FLOAT32_C(   0.79), SIMDE_FLOAT32_C(   0.24),
+        SIMDE_FLOAT32_C( -79.58), SIMDE_FLOAT32_C(  75.20), SIMDE_FLOAT32_C(  -0.02), SIMDE_FLOAT32_C(  -0.52),
+        SIMDE_FLOAT32_C(  -0.34), SIMDE_FLOAT32_C(-240.11), SIMDE_FLOAT32_C(   0.07), SIMDE_FLOAT32_C(   0.21) },
+      { SIMDE_FLOAT32_C(-849.47), SIMDE_FLOAT32_C(-624.08), SIMDE_FLOAT32_C( 955.32), SIMDE_FLOAT32_C(  -3.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C( 819.17), SIMDE_FLOAT32_C( 808.50), SIMDE_FLOAT32_C( 754.35),
+        SIMDE_FLOAT32_C( 457.95), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(  -6.00), SIMDE_FLOAT32_C( 964.16),
+        SIMDE_FLOAT32_C(-652.30), SIMDE_FLOAT32_C(-141.09), SIMDE_FLOAT32_C(-732.83), SIMDE_FLOAT32_C( 242.62) } },
+    { { SIMDE_FLOAT32_C( 814.72), SIMDE_FLOAT32_C(-556.16), SIMDE_FLOAT32_C( 451.14), SIMDE_FLOAT32_C( 958.46),
+        SIMDE_FLOAT32_C( 782.58), SIMDE_FLOAT32_C( 844.23), SIMDE_FLOAT32_C( 877.03), SIMDE_FLOAT32_C(-501.39),
+        SIMDE_FLOAT32_C(-396.81), SIMDE_FLOAT32_C(-885.13), SIMDE_FLOAT32_C( 390.23), SIMDE_FLOAT32_C( 283.93),
+        SIMDE_FLOAT32_C( 882.47), SIMDE_FLOAT32_C( 986.03), SIMDE_FLOAT32_C( 960.76), SIMDE_FLOAT32_C( 572.84) },
+      UINT16_C(44934),
+      { SIMDE_FLOAT32_C( 539.39), SIMDE_FLOAT32_C( 133.72), SIMDE_FLOAT32_C( 893.98), SIMDE_FLOAT32_C( 774.15),
+        SIMDE_FLOAT32_C(  -0.99), SIMDE_FLOAT32_C(-777.31), SIMDE_FLOAT32_C(  -0.99), SIMDE_FLOAT32_C( 486.51),
+        SIMDE_FLOAT32_C(   0.98), SIMDE_FLOAT32_C(   0.12), SIMDE_FLOAT32_C(   0.98), SIMDE_FLOAT32_C( 530.82),
+        SIMDE_FLOAT32_C(  -0.99), SIMDE_FLOAT32_C(  -0.71), SIMDE_FLOAT32_C(-822.68), SIMDE_FLOAT32_C(-915.60) },
+      { SIMDE_FLOAT32_C( 814.72), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C( 958.46),
+        SIMDE_FLOAT32_C( 782.58), SIMDE_FLOAT32_C( 844.23), SIMDE_FLOAT32_C( 877.03), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C( 882.47), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C( 960.76), SIMDE_FLOAT32_C(   9.00) } },
+    { { SIMDE_FLOAT32_C( 908.42), SIMDE_FLOAT32_C( 600.20), SIMDE_FLOAT32_C( 206.54), SIMDE_FLOAT32_C( -63.19),
+        SIMDE_FLOAT32_C( 808.90), SIMDE_FLOAT32_C( 762.01), SIMDE_FLOAT32_C(-617.42), SIMDE_FLOAT32_C(-794.52),
+        SIMDE_FLOAT32_C( 799.74), SIMDE_FLOAT32_C(-591.11), SIMDE_FLOAT32_C(  -7.25), SIMDE_FLOAT32_C(  89.05),
+        SIMDE_FLOAT32_C(-147.94), SIMDE_FLOAT32_C(-223.53), SIMDE_FLOAT32_C( 410.58), SIMDE_FLOAT32_C(-941.03) },
+      UINT16_C(62164),
+      { SIMDE_FLOAT32_C(-649.54), SIMDE_FLOAT32_C(  -0.12), SIMDE_FLOAT32_C( 327.87), SIMDE_FLOAT32_C(  -0.37),
+        SIMDE_FLOAT32_C(  -0.56), SIMDE_FLOAT32_C( 160.90), SIMDE_FLOAT32_C(  -0.59), SIMDE_FLOAT32_C(  -0.49),
+        SIMDE_FLOAT32_C(  -0.55), SIMDE_FLOAT32_C( 202.82), SIMDE_FLOAT32_C(-121.75), SIMDE_FLOAT32_C(   0.33),
+        SIMDE_FLOAT32_C( 352.70), SIMDE_FLOAT32_C(   0.15), SIMDE_FLOAT32_C( 137.62), SIMDE_FLOAT32_C(   0.64) },
+      { SIMDE_FLOAT32_C( 908.42), SIMDE_FLOAT32_C( 600.20), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C( -63.19),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C( 762.01), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -2.00),
+        SIMDE_FLOAT32_C( 799.74), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -7.25), SIMDE_FLOAT32_C(  89.05),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(  -1.00) } },
+    { { SIMDE_FLOAT32_C(-630.76), SIMDE_FLOAT32_C( 151.45), SIMDE_FLOAT32_C(-644.35), SIMDE_FLOAT32_C(-938.75),
+        SIMDE_FLOAT32_C(-433.82), SIMDE_FLOAT32_C( -96.12), SIMDE_FLOAT32_C(-507.42), SIMDE_FLOAT32_C(-197.20),
+        SIMDE_FLOAT32_C(-153.52), SIMDE_FLOAT32_C( 552.45), SIMDE_FLOAT32_C( 775.53), SIMDE_FLOAT32_C( -75.51),
+        SIMDE_FLOAT32_C( 253.71), SIMDE_FLOAT32_C(-729.13), SIMDE_FLOAT32_C( 608.37), SIMDE_FLOAT32_C(-741.96) },
+      UINT16_C(13667),
+      { SIMDE_FLOAT32_C(   0.35), SIMDE_FLOAT32_C(   0.42), SIMDE_FLOAT32_C( 523.99), SIMDE_FLOAT32_C(  -0.44),
+        SIMDE_FLOAT32_C(   0.77), SIMDE_FLOAT32_C(  -0.73), SIMDE_FLOAT32_C(   0.09), SIMDE_FLOAT32_C(-340.20),
+        SIMDE_FLOAT32_C(-877.32), SIMDE_FLOAT32_C(-343.76), SIMDE_FLOAT32_C(   0.06), SIMDE_FLOAT32_C(-857.31),
+        SIMDE_FLOAT32_C(-391.46), SIMDE_FLOAT32_C(-488.36), SIMDE_FLOAT32_C(   0.47), SIMDE_FLOAT32_C(-144.81) },
+      { SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(-644.35), SIMDE_FLOAT32_C(-938.75),
+        SIMDE_FLOAT32_C(-433.82), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(-197.20),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C( 552.45), SIMDE_FLOAT32_C(  -5.00), SIMDE_FLOAT32_C( -75.51),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C( 608.37), SIMDE_FLOAT32_C(-741.96) } },
+    { { SIMDE_FLOAT32_C(  75.99), SIMDE_FLOAT32_C(-293.35), SIMDE_FLOAT32_C(-985.30), SIMDE_FLOAT32_C(-981.13),
+        SIMDE_FLOAT32_C( 685.05), SIMDE_FLOAT32_C( 148.84), SIMDE_FLOAT32_C(-940.84), SIMDE_FLOAT32_C(-242.44),
+        SIMDE_FLOAT32_C(-274.51), SIMDE_FLOAT32_C(-930.41), SIMDE_FLOAT32_C(-819.49), SIMDE_FLOAT32_C( 250.75),
+        SIMDE_FLOAT32_C(  87.93), SIMDE_FLOAT32_C(-137.85), SIMDE_FLOAT32_C(-142.23), SIMDE_FLOAT32_C( 867.66) },
+      UINT16_C(36315),
+      { SIMDE_FLOAT32_C(-584.41), SIMDE_FLOAT32_C(-150.23), SIMDE_FLOAT32_C(-868.19), SIMDE_FLOAT32_C(   0.18),
+        SIMDE_FLOAT32_C( -23.34), SIMDE_FLOAT32_C(  -0.56), SIMDE_FLOAT32_C( 416.54), SIMDE_FLOAT32_C(   0.87),
+        SIMDE_FLOAT32_C(-882.31), SIMDE_FLOAT32_C( 591.53), SIMDE_FLOAT32_C(   0.30), SIMDE_FLOAT32_C(-559.61),
+        SIMDE_FLOAT32_C(   0.85), SIMDE_FLOAT32_C( 906.25), SIMDE_FLOAT32_C(-336.53), SIMDE_FLOAT32_C(   0.40) },
+      { SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(-985.30), SIMDE_FLOAT32_C(  -3.00),
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C( 148.84), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(-930.41), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(  87.93), SIMDE_FLOAT32_C(-137.85), SIMDE_FLOAT32_C(-142.23), SIMDE_FLOAT32_C(  -2.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_getexp_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(25467),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.75) },
+      {  -SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(   0.00),
+         -SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00), SIMDE_FLOAT32_C(   0.00) } },
+    #endif
+    { UINT16_C(59795),
+      { SIMDE_FLOAT32_C( 994.12), SIMDE_FLOAT32_C( -12.19), SIMDE_FLOAT32_C(   0.70), SIMDE_FLOAT32_C(-857.85),
+        SIMDE_FLOAT32_C(   0.89), SIMDE_FLOAT32_C(   0.99), SIMDE_FLOAT32_C(-107.31), SIMDE_FLOAT32_C(  -0.76),
+        SIMDE_FLOAT32_C(-170.56), SIMDE_FLOAT32_C(  -0.99), SIMDE_FLOAT32_C(  -0.65), SIMDE_FLOAT32_C(  -0.79),
+        SIMDE_FLOAT32_C( -78.97), SIMDE_FLOAT32_C(   0.97), SIMDE_FLOAT32_C( 664.03), SIMDE_FLOAT32_C(  -0.03) },
+      { SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   3.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -6.00) } },
+    { UINT16_C(23939),
+      { SIMDE_FLOAT32_C(  -0.17), SIMDE_FLOAT32_C(-222.11), SIMDE_FLOAT32_C(   0.89), SIMDE_FLOAT32_C(  -0.78),
+        SIMDE_FLOAT32_C(-702.07), SIMDE_FLOAT32_C(   0.89), SIMDE_FLOAT32_C(   0.28), SIMDE_FLOAT32_C( 308.86),
+        SIMDE_FLOAT32_C(   0.15), SIMDE_FLOAT32_C(-926.51), SIMDE_FLOAT32_C( 990.36), SIMDE_FLOAT32_C(  -0.24),
+        SIMDE_FLOAT32_C(-604.37), SIMDE_FLOAT32_C( 702.30), SIMDE_FLOAT32_C(  -0.98), SIMDE_FLOAT32_C( 367.92) },
+      { SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -3.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(38507),
+      { SIMDE_FLOAT32_C( 998.17), SIMDE_FLOAT32_C(-651.55), SIMDE_FLOAT32_C( 416.12), SIMDE_FLOAT32_C(   0.17),
+        SIMDE_FLOAT32_C(  -0.65), SIMDE_FLOAT32_C(  -0.23), SIMDE_FLOAT32_C(  -0.76), SIMDE_FLOAT32_C(  -0.12),
+        SIMDE_FLOAT32_C(-275.71), SIMDE_FLOAT32_C( 860.63), SIMDE_FLOAT32_C(  -0.29), SIMDE_FLOAT32_C(   0.09),
+        SIMDE_FLOAT32_C(-258.04), SIMDE_FLOAT32_C(-822.84), SIMDE_FLOAT32_C(   0.65), SIMDE_FLOAT32_C( 605.94) },
+      { SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -3.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00) } },
+    { UINT16_C(57205),
+      { SIMDE_FLOAT32_C(-429.98), SIMDE_FLOAT32_C(-349.62), SIMDE_FLOAT32_C(  -0.27), SIMDE_FLOAT32_C(   0.67),
+        SIMDE_FLOAT32_C( 879.16), SIMDE_FLOAT32_C(  -0.89), SIMDE_FLOAT32_C( -67.61), SIMDE_FLOAT32_C(  -0.15),
+        SIMDE_FLOAT32_C(   0.28), SIMDE_FLOAT32_C(-473.18), SIMDE_FLOAT32_C(  36.42), SIMDE_FLOAT32_C(   0.60),
+        SIMDE_FLOAT32_C(-807.42), SIMDE_FLOAT32_C(  -0.67), SIMDE_FLOAT32_C( 242.49), SIMDE_FLOAT32_C(-769.21) },
+      { SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   5.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   9.00) } },
+    { UINT16_C(22658),
+      { SIMDE_FLOAT32_C( 130.50), SIMDE_FLOAT32_C( -81.27), SIMDE_FLOAT32_C( -50.84), SIMDE_FLOAT32_C(  -0.40),
+        SIMDE_FLOAT32_C(-670.04), SIMDE_FLOAT32_C( 655.48), SIMDE_FLOAT32_C( 565.90), SIMDE_FLOAT32_C( 280.27),
+        SIMDE_FLOAT32_C(   0.93), SIMDE_FLOAT32_C(   0.35), SIMDE_FLOAT32_C(  -0.23), SIMDE_FLOAT32_C(   0.74),
+        SIMDE_FLOAT32_C( 425.10), SIMDE_FLOAT32_C( 843.49), SIMDE_FLOAT32_C( 696.18), SIMDE_FLOAT32_C(   0.44) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   8.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.00),
+        SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(54223),
+      { SIMDE_FLOAT32_C( 561.86), SIMDE_FLOAT32_C(-727.63), SIMDE_FLOAT32_C( 397.72), SIMDE_FLOAT32_C(-166.55),
+        SIMDE_FLOAT32_C(   0.50), SIMDE_FLOAT32_C(  -0.80), SIMDE_FLOAT32_C( 447.80), SIMDE_FLOAT32_C( 823.78),
+        SIMDE_FLOAT32_C(   0.18), SIMDE_FLOAT32_C(  68.61), SIMDE_FLOAT32_C( 525.13), SIMDE_FLOAT32_C(   0.05),
+        SIMDE_FLOAT32_C( 777.98), SIMDE_FLOAT32_C(  -0.94), SIMDE_FLOAT32_C( 856.60), SIMDE_FLOAT32_C(   0.20) },
+      { SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   7.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(  -3.00), SIMDE_FLOAT32_C(   6.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(  -3.00) } },
+    { UINT16_C(18322),
+      { SIMDE_FLOAT32_C(-332.00), SIMDE_FLOAT32_C( 406.42), SIMDE_FLOAT32_C(-939.57), SIMDE_FLOAT32_C(  -0.83),
+        SIMDE_FLOAT32_C(-939.72), SIMDE_FLOAT32_C(  -0.76), SIMDE_FLOAT32_C(  -0.24), SIMDE_FLOAT32_C( 869.28),
+        SIMDE_FLOAT32_C(  -0.87), SIMDE_FLOAT32_C(-226.06), SIMDE_FLOAT32_C(-727.29), SIMDE_FLOAT32_C(-314.23),
+        SIMDE_FLOAT32_C(-121.24), SIMDE_FLOAT32_C( 819.12), SIMDE_FLOAT32_C(  -0.05), SIMDE_FLOAT32_C(   0.58) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   8.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   9.00),
+        SIMDE_FLOAT32_C(  -1.00), SIMDE_FLOAT32_C(   7.00), SIMDE_FLOAT32_C(   9.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -5.00), SIMDE_FLOAT32_C(   0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_getexp_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,
+                SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C(   0.75) },
+      {   -SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY,
+                SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C(  -1.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(-362.27), SIMDE_FLOAT64_C( -87.17), SIMDE_FLOAT64_C( 243.44), SIMDE_FLOAT64_C(   0.65),
+        SIMDE_FLOAT64_C(-285.06), SIMDE_FLOAT64_C(   0.72), SIMDE_FLOAT64_C(-487.24), SIMDE_FLOAT64_C(  -0.80) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   6.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(  -1.00),
+        SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C(  -0.65), SIMDE_FLOAT64_C(   0.65), SIMDE_FLOAT64_C(   0.65), SIMDE_FLOAT64_C(   0.46),
+        SIMDE_FLOAT64_C(-702.82), SIMDE_FLOAT64_C( 998.85), SIMDE_FLOAT64_C( 263.28), SIMDE_FLOAT64_C(  -0.59) },
+      { SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -2.00),
+        SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C( 198.81), SIMDE_FLOAT64_C(  -0.46), SIMDE_FLOAT64_C(   0.27), SIMDE_FLOAT64_C(  -0.68),
+        SIMDE_FLOAT64_C(-616.53), SIMDE_FLOAT64_C(  -0.12), SIMDE_FLOAT64_C(   0.27), SIMDE_FLOAT64_C( -69.56) },
+      { SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -1.00),
+        SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -4.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   6.00) } },
+    { { SIMDE_FLOAT64_C( 410.01), SIMDE_FLOAT64_C( 445.75), SIMDE_FLOAT64_C(   0.33), SIMDE_FLOAT64_C(-119.09),
+        SIMDE_FLOAT64_C( 337.52), SIMDE_FLOAT64_C( 295.52), SIMDE_FLOAT64_C(   0.43), SIMDE_FLOAT64_C(  -0.92) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   6.00),
+        SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -1.00) } },
+    { { SIMDE_FLOAT64_C(   0.46), SIMDE_FLOAT64_C(   0.28), SIMDE_FLOAT64_C(  -0.89), SIMDE_FLOAT64_C(-750.94),
+        SIMDE_FLOAT64_C(-786.57), SIMDE_FLOAT64_C(  -0.81), SIMDE_FLOAT64_C(  -0.40), SIMDE_FLOAT64_C(-745.78) },
+      { SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   9.00),
+        SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   9.00) } },
+    { { SIMDE_FLOAT64_C(-383.60), SIMDE_FLOAT64_C(-607.80), SIMDE_FLOAT64_C(-710.87), SIMDE_FLOAT64_C(-756.07),
+        SIMDE_FLOAT64_C(  -0.48), SIMDE_FLOAT64_C( 161.69), SIMDE_FLOAT64_C( 471.69), SIMDE_FLOAT64_C(-722.44) },
+      { SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   9.00),
+        SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   9.00) } },
+    { { SIMDE_FLOAT64_C(   0.81), SIMDE_FLOAT64_C( 829.11), SIMDE_FLOAT64_C( 454.16), SIMDE_FLOAT64_C(  -0.07),
+        SIMDE_FLOAT64_C(   0.50), SIMDE_FLOAT64_C(  -0.39), SIMDE_FLOAT64_C(  -0.99), SIMDE_FLOAT64_C(-149.50) },
+      { SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -4.00),
+        SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   7.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_getexp_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 607.49), SIMDE_FLOAT64_C(-551.43), SIMDE_FLOAT64_C( 585.39), SIMDE_FLOAT64_C(-268.78),
+        SIMDE_FLOAT64_C(-917.19), SIMDE_FLOAT64_C( 105.45), SIMDE_FLOAT64_C(-898.64), SIMDE_FLOAT64_C(-922.80) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,
+                SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C(   0.75) },
+      {   -SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY,    SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(-917.19), SIMDE_FLOAT64_C( 105.45), SIMDE_FLOAT64_C(-898.64), SIMDE_FLOAT64_C(-922.80) } },
+    #endif
+    { { SIMDE_FLOAT64_C(-250.88), SIMDE_FLOAT64_C( 610.32), SIMDE_FLOAT64_C(-738.41), SIMDE_FLOAT64_C(-504.62),
+        SIMDE_FLOAT64_C(-143.07), SIMDE_FLOAT64_C( -62.13), SIMDE_FLOAT64_C(  71.48), SIMDE_FLOAT64_C( -35.19) },
+      UINT8_C(  122),
+      { SIMDE_FLOAT64_C( 652.22), SIMDE_FLOAT64_C( 350.41), SIMDE_FLOAT64_C(  -0.08), SIMDE_FLOAT64_C(   0.26),
+        SIMDE_FLOAT64_C( 437.12), SIMDE_FLOAT64_C(-154.36), SIMDE_FLOAT64_C( 710.77), SIMDE_FLOAT64_C(-666.50) },
+      { SIMDE_FLOAT64_C(-250.88), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(-738.41), SIMDE_FLOAT64_C(  -2.00),
+        SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C( -35.19) } },
+    { { SIMDE_FLOAT64_C(-659.71), SIMDE_FLOAT64_C(  -6.72), SIMDE_FLOAT64_C(-600.83), SIMDE_FLOAT64_C(-710.51),
+        SIMDE_FLOAT64_C(-279.45), SIMDE_FLOAT64_C(-351.78), SIMDE_FLOAT64_C( 372.53), SIMDE_FLOAT64_C(-853.95) },
+      UINT8_C(   53),
+      { SIMDE_FLOAT64_C(  -0.19), SIMDE_FLOAT64_C(-575.34), SIMDE_FLOAT64_C( 547.91), SIMDE_FLOAT64_C( 614.14),
+        SIMDE_FLOAT64_C(   3.70), SIMDE_FLOAT64_C( 578.80), SIMDE_FLOAT64_C(   0.69), SIMDE_FLOAT64_C( 941.62) },
+      { SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C(  -6.72), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(-710.51),
+        SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C( 372.53), SIMDE_FLOAT64_C(-853.95) } },
+    { { SIMDE_FLOAT64_C( 883.19), SIMDE_FLOAT64_C( 840.58), SIMDE_FLOAT64_C(  46.68), SIMDE_FLOAT64_C( 810.06),
+        SIMDE_FLOAT64_C( 883.13), SIMDE_FLOAT64_C( -88.35), SIMDE_FLOAT64_C( 730.44), SIMDE_FLOAT64_C(-627.89) },
+      UINT8_C(    7),
+      { SIMDE_FLOAT64_C(  -0.11), SIMDE_FLOAT64_C( 791.67), SIMDE_FLOAT64_C(-548.76), SIMDE_FLOAT64_C( 318.07),
+        SIMDE_FLOAT64_C(-950.62), SIMDE_FLOAT64_C( 515.32), SIMDE_FLOAT64_C(-227.00), SIMDE_FLOAT64_C(-918.52) },
+      { SIMDE_FLOAT64_C(  -4.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C( 810.06),
+        SIMDE_FLOAT64_C( 883.13), SIMDE_FLOAT64_C( -88.35), SIMDE_FLOAT64_C( 730.44), SIMDE_FLOAT64_C(-627.89) } },
+    { { SIMDE_FLOAT64_C( 182.68), SIMDE_FLOAT64_C( 897.93), SIMDE_FLOAT64_C(  85.60), SIMDE_FLOAT64_C( 757.10),
+        SIMDE_FLOAT64_C(-862.07), SIMDE_FLOAT64_C( 764.46), SIMDE_FLOAT64_C(-171.16), SIMDE_FLOAT64_C( 936.85) },
+      UINT8_C(   90),
+      { SIMDE_FLOAT64_C(  -0.81), SIMDE_FLOAT64_C(  -0.56), SIMDE_FLOAT64_C(   0.24), SIMDE_FLOAT64_C(-601.37),
+        SIMDE_FLOAT64_C( 149.69), SIMDE_FLOAT64_C(  -0.67), SIMDE_FLOAT64_C(-441.18), SIMDE_FLOAT64_C(  -0.89) },
+      { SIMDE_FLOAT64_C( 182.68), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  85.60), SIMDE_FLOAT64_C(   9.00),
+        SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C( 764.46), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C( 936.85) } },
+    { { SIMDE_FLOAT64_C(-836.64), SIMDE_FLOAT64_C( 517.98), SIMDE_FLOAT64_C( 654.99), SIMDE_FLOAT64_C(-149.26),
+        SIMDE_FLOAT64_C( 601.09), SIMDE_FLOAT64_C(-446.99), SIMDE_FLOAT64_C(-380.07), SIMDE_FLOAT64_C(-893.68) },
+      UINT8_C(  125),
+      { SIMDE_FLOAT64_C( -87.22), SIMDE_FLOAT64_C( 524.44), SIMDE_FLOAT64_C( 575.37), SIMDE_FLOAT64_C(   0.97),
+        SIMDE_FLOAT64_C( 316.49), SIMDE_FLOAT64_C( 412.16), SIMDE_FLOAT64_C(   0.50), SIMDE_FLOAT64_C( 720.73) },
+      { SIMDE_FLOAT64_C(   6.00), SIMDE_FLOAT64_C( 517.98), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -1.00),
+        SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(-893.68) } },
+    { { SIMDE_FLOAT64_C( 965.71), SIMDE_FLOAT64_C( 353.92), SIMDE_FLOAT64_C(-594.39), SIMDE_FLOAT64_C(-617.32),
+        SIMDE_FLOAT64_C( 851.52), SIMDE_FLOAT64_C( 338.96), SIMDE_FLOAT64_C( 549.90), SIMDE_FLOAT64_C( 264.78) },
+      UINT8_C(   96),
+      { SIMDE_FLOAT64_C(  -0.30), SIMDE_FLOAT64_C(   0.22), SIMDE_FLOAT64_C( -41.74), SIMDE_FLOAT64_C(-479.60),
+        SIMDE_FLOAT64_C(   0.87), SIMDE_FLOAT64_C(   0.85), SIMDE_FLOAT64_C(   0.07), SIMDE_FLOAT64_C(-619.62) },
+      { SIMDE_FLOAT64_C( 965.71), SIMDE_FLOAT64_C( 353.92), SIMDE_FLOAT64_C(-594.39), SIMDE_FLOAT64_C(-617.32),
+        SIMDE_FLOAT64_C( 851.52), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(  -4.00), SIMDE_FLOAT64_C( 264.78) } },
+    { { SIMDE_FLOAT64_C(-460.85), SIMDE_FLOAT64_C( 618.66), SIMDE_FLOAT64_C(-960.35), SIMDE_FLOAT64_C( 255.69),
+        SIMDE_FLOAT64_C( 923.91), SIMDE_FLOAT64_C(-590.03), SIMDE_FLOAT64_C(  22.18), SIMDE_FLOAT64_C( 574.12) },
+      UINT8_C(    9),
+      { SIMDE_FLOAT64_C(  -0.40), SIMDE_FLOAT64_C(-529.74), SIMDE_FLOAT64_C(   0.61), SIMDE_FLOAT64_C(  47.42),
+        SIMDE_FLOAT64_C( 488.32), SIMDE_FLOAT64_C( 685.69), SIMDE_FLOAT64_C(-476.21), SIMDE_FLOAT64_C(  -0.71) },
+      { SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C( 618.66), SIMDE_FLOAT64_C(-960.35), SIMDE_FLOAT64_C(   5.00),
+        SIMDE_FLOAT64_C( 923.91), SIMDE_FLOAT64_C(-590.03), SIMDE_FLOAT64_C(  22.18), SIMDE_FLOAT64_C( 574.12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_getexp_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(  100),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,
+                SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C(   0.75) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   1.00), SIMDE_FLOAT64_C(   0.00) } },
+    #endif
+    { UINT8_C(  135),
+      { SIMDE_FLOAT64_C(  -0.83), SIMDE_FLOAT64_C( 161.93), SIMDE_FLOAT64_C(   0.52), SIMDE_FLOAT64_C(  -0.61),
+        SIMDE_FLOAT64_C(  -0.47), SIMDE_FLOAT64_C(-358.05), SIMDE_FLOAT64_C( 268.78), SIMDE_FLOAT64_C(-447.60) },
+      { SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   8.00) } },
+    { UINT8_C(  150),
+      { SIMDE_FLOAT64_C( 154.52), SIMDE_FLOAT64_C(-367.86), SIMDE_FLOAT64_C(  -0.52), SIMDE_FLOAT64_C( 684.13),
+        SIMDE_FLOAT64_C(   0.32), SIMDE_FLOAT64_C( 792.91), SIMDE_FLOAT64_C(   0.27), SIMDE_FLOAT64_C( 484.35) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   8.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   8.00) } },
+    { UINT8_C(  110),
+      { SIMDE_FLOAT64_C(  -0.89), SIMDE_FLOAT64_C(-128.55), SIMDE_FLOAT64_C(-174.40), SIMDE_FLOAT64_C(   0.28),
+        SIMDE_FLOAT64_C(  -0.75), SIMDE_FLOAT64_C(  -0.91), SIMDE_FLOAT64_C( 156.31), SIMDE_FLOAT64_C(  -0.52) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(  -2.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   7.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  189),
+      { SIMDE_FLOAT64_C(   0.97), SIMDE_FLOAT64_C( 409.87), SIMDE_FLOAT64_C(  -0.99), SIMDE_FLOAT64_C( 452.12),
+        SIMDE_FLOAT64_C(   0.18), SIMDE_FLOAT64_C(   0.09), SIMDE_FLOAT64_C(-977.40), SIMDE_FLOAT64_C(-825.50) },
+      { SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   8.00),
+        SIMDE_FLOAT64_C(  -3.00), SIMDE_FLOAT64_C(  -4.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   9.00) } },
+    { UINT8_C(  186),
+      { SIMDE_FLOAT64_C(   0.24), SIMDE_FLOAT64_C(   0.90), SIMDE_FLOAT64_C(-324.13), SIMDE_FLOAT64_C(   0.79),
+        SIMDE_FLOAT64_C(  -0.78), SIMDE_FLOAT64_C(-875.15), SIMDE_FLOAT64_C(  -0.71), SIMDE_FLOAT64_C(  -0.36) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.00),
+        SIMDE_FLOAT64_C(  -1.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -2.00) } },
+    { UINT8_C(  201),
+      { SIMDE_FLOAT64_C(-671.62), SIMDE_FLOAT64_C(   0.99), SIMDE_FLOAT64_C(   0.48), SIMDE_FLOAT64_C( -12.99),
+        SIMDE_FLOAT64_C(  -0.82), SIMDE_FLOAT64_C(-139.81), SIMDE_FLOAT64_C( 559.95), SIMDE_FLOAT64_C(   0.10) },
+      { SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   3.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   9.00), SIMDE_FLOAT64_C(  -4.00) } },
+    { UINT8_C(  137),
+      { SIMDE_FLOAT64_C(  88.94), SIMDE_FLOAT64_C( 255.85), SIMDE_FLOAT64_C(  -0.98), SIMDE_FLOAT64_C(  40.14),
+        SIMDE_FLOAT64_C(   0.17), SIMDE_FLOAT64_C(-966.07), SIMDE_FLOAT64_C(   0.89), SIMDE_FLOAT64_C( 731.24) },
+      { SIMDE_FLOAT64_C(   6.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   5.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   9.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_getexp_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getexp_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,1615 @@
+#define SIMDE_TEST_X86_AVX512_INSN getmant
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/getmant.h>
+
+static int
+test_simde_mm_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(-506.03), SIMDE_FLOAT32_C(-346.51), SIMDE_FLOAT32_C( 564.23), SIMDE_FLOAT32_C(-672.05) },
+      { SIMDE_FLOAT32_C(  -1.976680), SIMDE_FLOAT32_C(  -1.353555), SIMDE_FLOAT32_C(   1.102012), SIMDE_FLOAT32_C(  -1.312598) } },
+    { { SIMDE_FLOAT32_C(-634.70), SIMDE_FLOAT32_C(-778.43), SIMDE_FLOAT32_C( 449.73), SIMDE_FLOAT32_C( 628.68) },
+      { SIMDE_FLOAT32_C(  -0.619824), SIMDE_FLOAT32_C(  -0.760186), SIMDE_FLOAT32_C(   1.756758), SIMDE_FLOAT32_C(   0.613945) } },
+    { { SIMDE_FLOAT32_C(-940.81), SIMDE_FLOAT32_C( 232.26), SIMDE_FLOAT32_C( 888.06), SIMDE_FLOAT32_C(-140.27) },
+      { SIMDE_FLOAT32_C(   0.918760), SIMDE_FLOAT32_C(   0.907266), SIMDE_FLOAT32_C(   0.867246), SIMDE_FLOAT32_C(   0.547930) } },
+    { { SIMDE_FLOAT32_C( 343.73), SIMDE_FLOAT32_C( 734.70), SIMDE_FLOAT32_C( 917.28), SIMDE_FLOAT32_C(-807.04) },
+      { SIMDE_FLOAT32_C(   1.342695), SIMDE_FLOAT32_C(   1.434961), SIMDE_FLOAT32_C(   0.895781), SIMDE_FLOAT32_C(  -0.788125) } },
+    { { SIMDE_FLOAT32_C( 307.62), SIMDE_FLOAT32_C( 537.95), SIMDE_FLOAT32_C( 536.73), SIMDE_FLOAT32_C(  46.71) },
+      { SIMDE_FLOAT32_C(   1.201641), SIMDE_FLOAT32_C(   1.050684), SIMDE_FLOAT32_C(   1.048301), SIMDE_FLOAT32_C(   1.459687) } },
+    { { SIMDE_FLOAT32_C( 931.54), SIMDE_FLOAT32_C(-740.31), SIMDE_FLOAT32_C( 554.77), SIMDE_FLOAT32_C( 889.65) },
+      { SIMDE_FLOAT32_C(   0.909707), SIMDE_FLOAT32_C(   0.722959), SIMDE_FLOAT32_C(   0.541768), SIMDE_FLOAT32_C(   0.868799) } },
+    { { SIMDE_FLOAT32_C( 957.12), SIMDE_FLOAT32_C(-315.38), SIMDE_FLOAT32_C(-115.35), SIMDE_FLOAT32_C(-838.43) },
+      { SIMDE_FLOAT32_C(   0.934687), SIMDE_FLOAT32_C(  -0.615977), SIMDE_FLOAT32_C(  -0.901172), SIMDE_FLOAT32_C(  -0.818779) } },
+    { { SIMDE_FLOAT32_C( 112.63), SIMDE_FLOAT32_C( 572.71), SIMDE_FLOAT32_C( 219.61), SIMDE_FLOAT32_C( 417.18) },
+      { SIMDE_FLOAT32_C(   0.879922), SIMDE_FLOAT32_C(   1.118574), SIMDE_FLOAT32_C(   0.857852), SIMDE_FLOAT32_C(   0.814805) } }
+  };
+
+  simde__m128 a, r;
+
+  a = simde_mm_loadu_ps(test_vec[0].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[0].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[1].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[1].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[2].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[2].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[3].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[3].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[4].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[4].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[5].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[5].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[6].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[6].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[7].a);
+  r = simde_mm_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 793.43), SIMDE_FLOAT32_C(-451.05), SIMDE_FLOAT32_C( 652.31), SIMDE_FLOAT32_C( 859.19) },
+      UINT8_C(   10),
+      { SIMDE_FLOAT32_C( -46.39), SIMDE_FLOAT32_C(-607.53), SIMDE_FLOAT32_C(-800.92), SIMDE_FLOAT32_C( 587.60) },
+      { SIMDE_FLOAT32_C( 793.43), SIMDE_FLOAT32_C(  -1.186582), SIMDE_FLOAT32_C( 652.31), SIMDE_FLOAT32_C(   1.147656) } },
+    { { SIMDE_FLOAT32_C( 199.09), SIMDE_FLOAT32_C(-895.66), SIMDE_FLOAT32_C(-404.48), SIMDE_FLOAT32_C(-284.75) },
+      UINT8_C(    9),
+      { SIMDE_FLOAT32_C( 493.09), SIMDE_FLOAT32_C(-906.02), SIMDE_FLOAT32_C(  25.86), SIMDE_FLOAT32_C(-749.52) },
+      { SIMDE_FLOAT32_C(   1.926133), SIMDE_FLOAT32_C(-895.66), SIMDE_FLOAT32_C(-404.48), SIMDE_FLOAT32_C(  -0.731953) } },
+    { { SIMDE_FLOAT32_C( 169.55), SIMDE_FLOAT32_C(-989.04), SIMDE_FLOAT32_C( 948.58), SIMDE_FLOAT32_C(-224.21) },
+      UINT8_C(    5),
+      { SIMDE_FLOAT32_C( 221.80), SIMDE_FLOAT32_C( 635.15), SIMDE_FLOAT32_C( 674.64), SIMDE_FLOAT32_C( 952.78) },
+      { SIMDE_FLOAT32_C(   0.866406), SIMDE_FLOAT32_C(-989.04), SIMDE_FLOAT32_C(   0.658828), SIMDE_FLOAT32_C(-224.21) } },
+    { { SIMDE_FLOAT32_C( 898.85), SIMDE_FLOAT32_C( 644.81), SIMDE_FLOAT32_C( 939.67), SIMDE_FLOAT32_C(-413.24) },
+      UINT8_C(    4),
+      { SIMDE_FLOAT32_C( -65.74), SIMDE_FLOAT32_C( 293.17), SIMDE_FLOAT32_C(-257.23), SIMDE_FLOAT32_C(-513.93) },
+      { SIMDE_FLOAT32_C( 898.85), SIMDE_FLOAT32_C( 644.81), SIMDE_FLOAT32_C(  -1.004805), SIMDE_FLOAT32_C(-413.24) } },
+    { { SIMDE_FLOAT32_C(-371.87), SIMDE_FLOAT32_C(-817.44), SIMDE_FLOAT32_C( 819.55), SIMDE_FLOAT32_C( 244.73) },
+      UINT8_C(    9),
+      { SIMDE_FLOAT32_C( 346.72), SIMDE_FLOAT32_C( 412.36), SIMDE_FLOAT32_C( 383.07), SIMDE_FLOAT32_C( 338.24) },
+      { SIMDE_FLOAT32_C(   1.354375), SIMDE_FLOAT32_C(-817.44), SIMDE_FLOAT32_C( 819.55), SIMDE_FLOAT32_C(   1.32125) } },
+    { { SIMDE_FLOAT32_C( 595.41), SIMDE_FLOAT32_C( 844.62), SIMDE_FLOAT32_C( 668.43), SIMDE_FLOAT32_C(-804.27) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT32_C(-950.86), SIMDE_FLOAT32_C(-808.09), SIMDE_FLOAT32_C(-419.15), SIMDE_FLOAT32_C(-911.33) },
+      { SIMDE_FLOAT32_C( 595.41), SIMDE_FLOAT32_C(   0.789150), SIMDE_FLOAT32_C( 668.43), SIMDE_FLOAT32_C(-804.27) } },
+    { { SIMDE_FLOAT32_C( 965.29), SIMDE_FLOAT32_C(-361.45), SIMDE_FLOAT32_C(-304.78), SIMDE_FLOAT32_C(-866.43) },
+      UINT8_C(   12),
+      { SIMDE_FLOAT32_C(-475.76), SIMDE_FLOAT32_C(-512.16), SIMDE_FLOAT32_C( 752.81), SIMDE_FLOAT32_C(-166.73) },
+      { SIMDE_FLOAT32_C( 965.29), SIMDE_FLOAT32_C(-361.45), SIMDE_FLOAT32_C(   0.735166), SIMDE_FLOAT32_C(  -0.651289) } },
+    { { SIMDE_FLOAT32_C( -88.26), SIMDE_FLOAT32_C( 958.56), SIMDE_FLOAT32_C(-983.06), SIMDE_FLOAT32_C(-283.94) },
+      UINT8_C(   13),
+      { SIMDE_FLOAT32_C( 102.54), SIMDE_FLOAT32_C( 245.10), SIMDE_FLOAT32_C( 872.53), SIMDE_FLOAT32_C( 353.11) },
+      { SIMDE_FLOAT32_C(   0.801094), SIMDE_FLOAT32_C( 958.56), SIMDE_FLOAT32_C(   0.852080), SIMDE_FLOAT32_C(   1.379336) } }
+  };
+
+  simde__m128 src, a, r;
+
+  src = simde_mm_loadu_ps(test_vec[0].src);
+  a = simde_mm_loadu_ps(test_vec[0].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[0].r), 4);
+
+  src = simde_mm_loadu_ps(test_vec[1].src);
+  a = simde_mm_loadu_ps(test_vec[1].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[1].r), 4);
+
+  src = simde_mm_loadu_ps(test_vec[2].src);
+  a = simde_mm_loadu_ps(test_vec[2].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[2].r), 4);
+
+  src = simde_mm_loadu_ps(test_vec[3].src);
+  a = simde_mm_loadu_ps(test_vec[3].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[3].r), 4);
+
+  src = simde_mm_loadu_ps(test_vec[4].src);
+  a = simde_mm_loadu_ps(test_vec[4].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[4].r), 4);
+
+  src = simde_mm_loadu_ps(test_vec[5].src);
+  a = simde_mm_loadu_ps(test_vec[5].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[5].r), 4);
+
+  src = simde_mm_loadu_ps(test_vec[6].src);
+  a = simde_mm_loadu_ps(test_vec[6].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[6].r), 4);
+
+  src = simde_mm_loadu_ps(test_vec[7].src);
+  a = simde_mm_loadu_ps(test_vec[7].a);
+  r = simde_mm_mask_getmant_ps(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(    2),
+      { SIMDE_FLOAT32_C( 396.78), SIMDE_FLOAT32_C( 261.28), SIMDE_FLOAT32_C(-216.10), SIMDE_FLOAT32_C(-466.83) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.020625), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    9),
+      { SIMDE_FLOAT32_C(-224.64), SIMDE_FLOAT32_C(-135.69), SIMDE_FLOAT32_C( 957.45), SIMDE_FLOAT32_C(-594.85) },
+      { SIMDE_FLOAT32_C(  -0.8775), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.580908) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT32_C(-804.89), SIMDE_FLOAT32_C(-935.67), SIMDE_FLOAT32_C( 202.40), SIMDE_FLOAT32_C( 114.37) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.913740), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(   14),
+      { SIMDE_FLOAT32_C( -44.28), SIMDE_FLOAT32_C( 232.34), SIMDE_FLOAT32_C( -58.11), SIMDE_FLOAT32_C(-163.58) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.907578), SIMDE_FLOAT32_C(  -0.907969), SIMDE_FLOAT32_C(  -1.277969) } },
+    { UINT8_C(   13),
+      { SIMDE_FLOAT32_C( 499.38), SIMDE_FLOAT32_C( 271.85), SIMDE_FLOAT32_C( 852.73), SIMDE_FLOAT32_C( 915.53) },
+      { SIMDE_FLOAT32_C(   1.950703), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.665488), SIMDE_FLOAT32_C(   1.788145) } },
+    { UINT8_C(    4),
+      { SIMDE_FLOAT32_C( 418.83), SIMDE_FLOAT32_C( 331.80), SIMDE_FLOAT32_C( 981.36), SIMDE_FLOAT32_C(-978.39) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.958359), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    5),
+      { SIMDE_FLOAT32_C( 641.19), SIMDE_FLOAT32_C( -37.80), SIMDE_FLOAT32_C( 177.57), SIMDE_FLOAT32_C( 614.46) },
+      { SIMDE_FLOAT32_C(   0.626162), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.693633), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    7),
+      { SIMDE_FLOAT32_C( 123.51), SIMDE_FLOAT32_C(  13.52), SIMDE_FLOAT32_C( 482.80), SIMDE_FLOAT32_C( 800.23) },
+      { SIMDE_FLOAT32_C(   0.964922), SIMDE_FLOAT32_C(   0.845), SIMDE_FLOAT32_C(   0.942969), SIMDE_FLOAT32_C(   0.00) } }
+  };
+
+  simde__m128 a, r;
+
+  a = simde_mm_loadu_ps(test_vec[0].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[0].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[1].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[1].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[2].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[2].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[3].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[3].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[4].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[4].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[5].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[5].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[6].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[6].r), 4);
+
+  a = simde_mm_loadu_ps(test_vec[7].a);
+  r = simde_mm_maskz_getmant_ps(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(-164.43), SIMDE_FLOAT64_C( -13.48) },
+      { SIMDE_FLOAT64_C(  -1.284609), SIMDE_FLOAT64_C(  -1.685) } },
+    { { SIMDE_FLOAT64_C( 634.37), SIMDE_FLOAT64_C(-425.75) },
+      { SIMDE_FLOAT64_C(   0.619502), SIMDE_FLOAT64_C(  -1.663086) } },
+    { { SIMDE_FLOAT64_C(  78.11), SIMDE_FLOAT64_C( 991.45) },
+      { SIMDE_FLOAT64_C(   0.610234), SIMDE_FLOAT64_C(   0.968213) } },
+    { { SIMDE_FLOAT64_C( 201.00), SIMDE_FLOAT64_C(  49.95) },
+      { SIMDE_FLOAT64_C(   0.785156), SIMDE_FLOAT64_C(   0.780469) } },
+    { { SIMDE_FLOAT64_C( 205.17), SIMDE_FLOAT64_C( 819.53) },
+      { SIMDE_FLOAT64_C(   1.602891), SIMDE_FLOAT64_C(   1.600645) } },
+    { { SIMDE_FLOAT64_C(-228.68), SIMDE_FLOAT64_C(-305.54) },
+      { SIMDE_FLOAT64_C(   0.893281), SIMDE_FLOAT64_C(   1.193516) } },
+    { { SIMDE_FLOAT64_C(-491.60), SIMDE_FLOAT64_C( 856.43) },
+      { SIMDE_FLOAT64_C(  -0.960156), SIMDE_FLOAT64_C(   0.836357) } },
+    { { SIMDE_FLOAT64_C( 609.91), SIMDE_FLOAT64_C( 993.13) },
+      { SIMDE_FLOAT64_C(   1.191230), SIMDE_FLOAT64_C(   0.969854) } }
+  };
+
+  simde__m128d a, r;
+
+  a = simde_mm_loadu_pd(test_vec[0].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[0].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[1].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[1].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[2].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[2].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[3].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[3].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[4].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[4].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[5].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[5].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[6].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[6].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[7].a);
+  r = simde_mm_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( 796.55), SIMDE_FLOAT64_C( 330.76) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C( 241.24), SIMDE_FLOAT64_C( 923.63) },
+      { SIMDE_FLOAT64_C(   1.884688), SIMDE_FLOAT64_C( 330.76) } },
+    { { SIMDE_FLOAT64_C(-162.81), SIMDE_FLOAT64_C( 640.52) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 151.70), SIMDE_FLOAT64_C( 266.84) },
+      { SIMDE_FLOAT64_C(-162.81), SIMDE_FLOAT64_C(   1.042344) } },
+    { { SIMDE_FLOAT64_C( 874.73), SIMDE_FLOAT64_C( 275.33) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C(-261.01), SIMDE_FLOAT64_C(-406.54) },
+      { SIMDE_FLOAT64_C(   0.509785), SIMDE_FLOAT64_C(   0.794023) } },
+    { { SIMDE_FLOAT64_C(-379.34), SIMDE_FLOAT64_C( 146.14) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C(  19.74), SIMDE_FLOAT64_C(-471.66) },
+      { SIMDE_FLOAT64_C(-379.34), SIMDE_FLOAT64_C( 146.14) } },
+    { { SIMDE_FLOAT64_C( 320.49), SIMDE_FLOAT64_C( 803.10) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 303.98), SIMDE_FLOAT64_C( 469.78) },
+      { SIMDE_FLOAT64_C(   1.187422), SIMDE_FLOAT64_C(   1.835078) } },
+    { { SIMDE_FLOAT64_C( 703.67), SIMDE_FLOAT64_C( 403.10) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 135.42), SIMDE_FLOAT64_C(-855.18) },
+      { SIMDE_FLOAT64_C( 703.67), SIMDE_FLOAT64_C(   0.835137) } },
+    { { SIMDE_FLOAT64_C(  -7.29), SIMDE_FLOAT64_C(-232.15) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C(-827.57), SIMDE_FLOAT64_C( 977.95) },
+      { SIMDE_FLOAT64_C(  -0.808174), SIMDE_FLOAT64_C(   0.955029) } },
+    { { SIMDE_FLOAT64_C( 493.93), SIMDE_FLOAT64_C(-740.10) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C( 406.23), SIMDE_FLOAT64_C( 834.75) },
+      { SIMDE_FLOAT64_C(   0.793418), SIMDE_FLOAT64_C(-740.10) } }
+  };
+
+  simde__m128d src, a, r;
+
+  src = simde_mm_loadu_pd(test_vec[0].src);
+  a = simde_mm_loadu_pd(test_vec[0].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[0].r), 4);
+
+  src = simde_mm_loadu_pd(test_vec[1].src);
+  a = simde_mm_loadu_pd(test_vec[1].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[1].r), 4);
+
+  src = simde_mm_loadu_pd(test_vec[2].src);
+  a = simde_mm_loadu_pd(test_vec[2].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[2].r), 4);
+
+  src = simde_mm_loadu_pd(test_vec[3].src);
+  a = simde_mm_loadu_pd(test_vec[3].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[3].r), 4);
+
+  src = simde_mm_loadu_pd(test_vec[4].src);
+  a = simde_mm_loadu_pd(test_vec[4].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[4].r), 4);
+
+  src = simde_mm_loadu_pd(test_vec[5].src);
+  a = simde_mm_loadu_pd(test_vec[5].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[5].r), 4);
+
+  src = simde_mm_loadu_pd(test_vec[6].src);
+  a = simde_mm_loadu_pd(test_vec[6].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[6].r), 4);
+
+  src = simde_mm_loadu_pd(test_vec[7].src);
+  a = simde_mm_loadu_pd(test_vec[7].a);
+  r = simde_mm_mask_getmant_pd(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 467.99), SIMDE_FLOAT64_C(-268.08) },
+      { SIMDE_FLOAT64_C(   1.828086), SIMDE_FLOAT64_C(  -1.047187) } },
+    { UINT8_C(    0),
+      { SIMDE_FLOAT64_C( -40.79), SIMDE_FLOAT64_C( 869.66) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    0),
+      { SIMDE_FLOAT64_C(-753.35), SIMDE_FLOAT64_C(-126.36) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    0),
+      { SIMDE_FLOAT64_C(-985.37), SIMDE_FLOAT64_C( 185.12) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 281.26), SIMDE_FLOAT64_C( 628.23) },
+      { SIMDE_FLOAT64_C(   1.098672), SIMDE_FLOAT64_C(   1.227012) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 247.04), SIMDE_FLOAT64_C(-894.01) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.873057) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 869.80), SIMDE_FLOAT64_C(-113.37) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.885703) } },
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C( 746.44), SIMDE_FLOAT64_C(  52.32) },
+      { SIMDE_FLOAT64_C(   1.457891), SIMDE_FLOAT64_C(   0.00) } }
+  };
+
+  simde__m128d a, r;
+
+  a = simde_mm_loadu_pd(test_vec[0].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[0].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[1].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[1].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[2].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[2].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[3].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[3].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[4].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[4].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[5].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[5].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[6].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[6].r), 4);
+
+  a = simde_mm_loadu_pd(test_vec[7].a);
+  r = simde_mm_maskz_getmant_pd(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm256_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 117.95), SIMDE_FLOAT32_C(-845.12), SIMDE_FLOAT32_C( -57.76), SIMDE_FLOAT32_C(-934.62),
+        SIMDE_FLOAT32_C(-599.06), SIMDE_FLOAT32_C(-854.55), SIMDE_FLOAT32_C(-191.24), SIMDE_FLOAT32_C( 749.21) },
+      { SIMDE_FLOAT32_C(   1.842969), SIMDE_FLOAT32_C(  -1.650625), SIMDE_FLOAT32_C(  -1.805), SIMDE_FLOAT32_C(  -1.825430),
+        SIMDE_FLOAT32_C(  -1.170039), SIMDE_FLOAT32_C(  -1.669043), SIMDE_FLOAT32_C(  -1.494063), SIMDE_FLOAT32_C(   1.463301) } },
+    { { SIMDE_FLOAT32_C(-733.96), SIMDE_FLOAT32_C( 941.66), SIMDE_FLOAT32_C(-153.06), SIMDE_FLOAT32_C(-984.83),
+        SIMDE_FLOAT32_C(  19.82), SIMDE_FLOAT32_C( 272.26), SIMDE_FLOAT32_C( 326.93), SIMDE_FLOAT32_C( 688.79) },
+      { SIMDE_FLOAT32_C(  -0.716758), SIMDE_FLOAT32_C(   0.919590), SIMDE_FLOAT32_C(  -0.597891), SIMDE_FLOAT32_C(  -0.961748),
+        SIMDE_FLOAT32_C(   1.23875), SIMDE_FLOAT32_C(   1.063516), SIMDE_FLOAT32_C(   1.277070), SIMDE_FLOAT32_C(   0.672646) } },
+    { { SIMDE_FLOAT32_C( 200.50), SIMDE_FLOAT32_C( 166.29), SIMDE_FLOAT32_C(  84.41), SIMDE_FLOAT32_C( -88.07),
+        SIMDE_FLOAT32_C( 819.43), SIMDE_FLOAT32_C(  78.05), SIMDE_FLOAT32_C( 776.03), SIMDE_FLOAT32_C( 196.29) },
+      { SIMDE_FLOAT32_C(   0.783203), SIMDE_FLOAT32_C(   0.649570), SIMDE_FLOAT32_C(   0.659453), SIMDE_FLOAT32_C(   0.688047),
+        SIMDE_FLOAT32_C(   0.800225), SIMDE_FLOAT32_C(   0.609766), SIMDE_FLOAT32_C(   0.757842), SIMDE_FLOAT32_C(   0.766758) } },
+    { { SIMDE_FLOAT32_C( -31.96), SIMDE_FLOAT32_C(-848.11), SIMDE_FLOAT32_C( 376.59), SIMDE_FLOAT32_C( 618.41),
+        SIMDE_FLOAT32_C(-238.73), SIMDE_FLOAT32_C(  34.89), SIMDE_FLOAT32_C(-393.06), SIMDE_FLOAT32_C(-656.87) },
+      { SIMDE_FLOAT32_C(  -0.99875), SIMDE_FLOAT32_C(  -0.828232), SIMDE_FLOAT32_C(   1.471055), SIMDE_FLOAT32_C(   1.207832),
+        SIMDE_FLOAT32_C(  -0.932539), SIMDE_FLOAT32_C(   1.090312), SIMDE_FLOAT32_C(  -0.767695), SIMDE_FLOAT32_C(  -1.282949) } },
+    { { SIMDE_FLOAT32_C(  95.10), SIMDE_FLOAT32_C( 135.84), SIMDE_FLOAT32_C( 509.76), SIMDE_FLOAT32_C( 744.51),
+        SIMDE_FLOAT32_C( 493.82), SIMDE_FLOAT32_C( 332.63), SIMDE_FLOAT32_C( 925.05), SIMDE_FLOAT32_C( 536.55) },
+      { SIMDE_FLOAT32_C(   1.485937), SIMDE_FLOAT32_C(   1.06125), SIMDE_FLOAT32_C(   1.99125), SIMDE_FLOAT32_C(   1.454121),
+        SIMDE_FLOAT32_C(   1.928984), SIMDE_FLOAT32_C(   1.299336), SIMDE_FLOAT32_C(   1.806738), SIMDE_FLOAT32_C(   1.047949) } },
+    { { SIMDE_FLOAT32_C(  92.74), SIMDE_FLOAT32_C( 115.87), SIMDE_FLOAT32_C( 181.24), SIMDE_FLOAT32_C( -76.07),
+        SIMDE_FLOAT32_C( 666.45), SIMDE_FLOAT32_C(-432.23), SIMDE_FLOAT32_C( 467.10), SIMDE_FLOAT32_C( 665.56) },
+      { SIMDE_FLOAT32_C(   1.449062), SIMDE_FLOAT32_C(   1.810469), SIMDE_FLOAT32_C(   0.707969), SIMDE_FLOAT32_C(   1.188594),
+        SIMDE_FLOAT32_C(   0.650830), SIMDE_FLOAT32_C(   1.688398), SIMDE_FLOAT32_C(   1.824609), SIMDE_FLOAT32_C(   0.649961) } },
+    { { SIMDE_FLOAT32_C(-116.92), SIMDE_FLOAT32_C( 917.42), SIMDE_FLOAT32_C( -99.33), SIMDE_FLOAT32_C(-466.33),
+        SIMDE_FLOAT32_C(-921.16), SIMDE_FLOAT32_C( 536.17), SIMDE_FLOAT32_C( 922.82), SIMDE_FLOAT32_C( 530.70) },
+      { SIMDE_FLOAT32_C(  -0.913437), SIMDE_FLOAT32_C(   0.895918), SIMDE_FLOAT32_C(  -0.776016), SIMDE_FLOAT32_C(  -0.910801),
+        SIMDE_FLOAT32_C(  -0.899570), SIMDE_FLOAT32_C(   0.523603), SIMDE_FLOAT32_C(   0.901191), SIMDE_FLOAT32_C(   0.518262) } },
+    { { SIMDE_FLOAT32_C( 620.72), SIMDE_FLOAT32_C(  60.39), SIMDE_FLOAT32_C( 214.90), SIMDE_FLOAT32_C( 382.69),
+        SIMDE_FLOAT32_C( 122.92), SIMDE_FLOAT32_C( 676.01), SIMDE_FLOAT32_C( 660.69), SIMDE_FLOAT32_C( 310.50) },
+      { SIMDE_FLOAT32_C(   1.212344), SIMDE_FLOAT32_C(   0.943594), SIMDE_FLOAT32_C(   0.839453), SIMDE_FLOAT32_C(   1.494883),
+        SIMDE_FLOAT32_C(   0.960312), SIMDE_FLOAT32_C(   1.320332), SIMDE_FLOAT32_C(   1.290410), SIMDE_FLOAT32_C(   1.212891) } }
+  };
+
+  simde__m256 a, r;
+
+  a = simde_mm256_loadu_ps(test_vec[0].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[0].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[1].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[1].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[2].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[2].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[3].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[3].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[4].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[4].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[5].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[5].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[6].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[6].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[7].a);
+  r = simde_mm256_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(-222.03), SIMDE_FLOAT32_C( 716.85), SIMDE_FLOAT32_C( 611.43), SIMDE_FLOAT32_C( 518.80),
+        SIMDE_FLOAT32_C(  -0.30), SIMDE_FLOAT32_C(-632.59), SIMDE_FLOAT32_C(-484.85), SIMDE_FLOAT32_C(-844.98) },
+      UINT8_C(   24),
+      { SIMDE_FLOAT32_C( 138.80), SIMDE_FLOAT32_C( 121.35), SIMDE_FLOAT32_C(-384.12), SIMDE_FLOAT32_C(-758.28),
+        SIMDE_FLOAT32_C(-537.32), SIMDE_FLOAT32_C( -68.68), SIMDE_FLOAT32_C(-893.79), SIMDE_FLOAT32_C(-975.59) },
+      { SIMDE_FLOAT32_C(-222.03), SIMDE_FLOAT32_C( 716.85), SIMDE_FLOAT32_C( 611.43), SIMDE_FLOAT32_C(  -1.481016),
+        SIMDE_FLOAT32_C(  -1.049453), SIMDE_FLOAT32_C(-632.59), SIMDE_FLOAT32_C(-484.85), SIMDE_FLOAT32_C(-844.98) } },
+    { { SIMDE_FLOAT32_C( 575.62), SIMDE_FLOAT32_C( -64.77), SIMDE_FLOAT32_C( 729.99), SIMDE_FLOAT32_C(-498.73),
+        SIMDE_FLOAT32_C( 546.82), SIMDE_FLOAT32_C(  97.65), SIMDE_FLOAT32_C(-575.60), SIMDE_FLOAT32_C(-484.77) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT32_C(-880.44), SIMDE_FLOAT32_C(  78.08), SIMDE_FLOAT32_C( 666.40), SIMDE_FLOAT32_C( 689.25),
+        SIMDE_FLOAT32_C(  -5.81), SIMDE_FLOAT32_C( -50.63), SIMDE_FLOAT32_C( 306.87), SIMDE_FLOAT32_C( 695.57) },
+      { SIMDE_FLOAT32_C(  -0.859805), SIMDE_FLOAT32_C(   1.22), SIMDE_FLOAT32_C(   0.650781), SIMDE_FLOAT32_C(   0.673096),
+        SIMDE_FLOAT32_C( 546.82), SIMDE_FLOAT32_C(  97.65), SIMDE_FLOAT32_C(-575.60), SIMDE_FLOAT32_C(-484.77) } },
+    { { SIMDE_FLOAT32_C(  36.94), SIMDE_FLOAT32_C( 541.05), SIMDE_FLOAT32_C( 359.30), SIMDE_FLOAT32_C( 819.76),
+        SIMDE_FLOAT32_C( 508.55), SIMDE_FLOAT32_C(-125.55), SIMDE_FLOAT32_C(-630.11), SIMDE_FLOAT32_C(-930.38) },
+      UINT8_C(  143),
+      { SIMDE_FLOAT32_C( 105.86), SIMDE_FLOAT32_C( -37.91), SIMDE_FLOAT32_C(-930.76), SIMDE_FLOAT32_C(-692.48),
+        SIMDE_FLOAT32_C( 528.21), SIMDE_FLOAT32_C( 345.52), SIMDE_FLOAT32_C( 561.01), SIMDE_FLOAT32_C( 152.81) },
+      { SIMDE_FLOAT32_C(   0.827031), SIMDE_FLOAT32_C(   0.592344), SIMDE_FLOAT32_C(   0.908945), SIMDE_FLOAT32_C(   0.67625),
+        SIMDE_FLOAT32_C( 508.55), SIMDE_FLOAT32_C(-125.55), SIMDE_FLOAT32_C(-630.11), SIMDE_FLOAT32_C(   0.596914) } },
+    { { SIMDE_FLOAT32_C( 148.73), SIMDE_FLOAT32_C(-982.03), SIMDE_FLOAT32_C(-654.92), SIMDE_FLOAT32_C( 673.67),
+        SIMDE_FLOAT32_C( 807.92), SIMDE_FLOAT32_C( 662.65), SIMDE_FLOAT32_C( -79.77), SIMDE_FLOAT32_C( 963.26) },
+      UINT8_C(   36),
+      { SIMDE_FLOAT32_C( 644.18), SIMDE_FLOAT32_C( 493.47), SIMDE_FLOAT32_C( 566.58), SIMDE_FLOAT32_C( -42.25),
+        SIMDE_FLOAT32_C(-171.62), SIMDE_FLOAT32_C( 948.42), SIMDE_FLOAT32_C(-979.44), SIMDE_FLOAT32_C( 400.17) },
+      { SIMDE_FLOAT32_C( 148.73), SIMDE_FLOAT32_C(-982.03), SIMDE_FLOAT32_C(   1.106602), SIMDE_FLOAT32_C( 673.67),
+        SIMDE_FLOAT32_C( 807.92), SIMDE_FLOAT32_C(   0.926191), SIMDE_FLOAT32_C( -79.77), SIMDE_FLOAT32_C( 963.26) } },
+    { { SIMDE_FLOAT32_C( 595.75), SIMDE_FLOAT32_C(-728.77), SIMDE_FLOAT32_C( 359.37), SIMDE_FLOAT32_C( 277.47),
+        SIMDE_FLOAT32_C( 210.75), SIMDE_FLOAT32_C(-422.84), SIMDE_FLOAT32_C( 317.78), SIMDE_FLOAT32_C( 188.93) },
+      UINT8_C(  156),
+      { SIMDE_FLOAT32_C( 461.94), SIMDE_FLOAT32_C( 989.20), SIMDE_FLOAT32_C( 401.52), SIMDE_FLOAT32_C( 224.74),
+        SIMDE_FLOAT32_C( 406.87), SIMDE_FLOAT32_C( 524.85), SIMDE_FLOAT32_C( 248.48), SIMDE_FLOAT32_C( 312.88) },
+      { SIMDE_FLOAT32_C( 595.75), SIMDE_FLOAT32_C(-728.77), SIMDE_FLOAT32_C(   1.568437), SIMDE_FLOAT32_C(   1.755781),
+        SIMDE_FLOAT32_C(   1.589336), SIMDE_FLOAT32_C(-422.84), SIMDE_FLOAT32_C( 317.78), SIMDE_FLOAT32_C(   1.222188) } },
+    { { SIMDE_FLOAT32_C( 281.00), SIMDE_FLOAT32_C( 443.82), SIMDE_FLOAT32_C(-687.68), SIMDE_FLOAT32_C(-806.00),
+        SIMDE_FLOAT32_C( 177.19), SIMDE_FLOAT32_C(-602.70), SIMDE_FLOAT32_C(-337.01), SIMDE_FLOAT32_C( 463.34) },
+      UINT8_C(  219),
+      { SIMDE_FLOAT32_C( -56.39), SIMDE_FLOAT32_C(-796.93), SIMDE_FLOAT32_C(-704.02), SIMDE_FLOAT32_C(-353.57),
+        SIMDE_FLOAT32_C(  11.10), SIMDE_FLOAT32_C(-625.47), SIMDE_FLOAT32_C(  57.11), SIMDE_FLOAT32_C(-830.11) },
+      { SIMDE_FLOAT32_C(   0.881094), SIMDE_FLOAT32_C(   0.778252), SIMDE_FLOAT32_C(-687.68), SIMDE_FLOAT32_C(   1.381133),
+        SIMDE_FLOAT32_C(   0.69375), SIMDE_FLOAT32_C(-602.70), SIMDE_FLOAT32_C(   0.892344), SIMDE_FLOAT32_C(   0.810654) } },
+    { { SIMDE_FLOAT32_C(-661.01), SIMDE_FLOAT32_C( 930.98), SIMDE_FLOAT32_C(-779.62), SIMDE_FLOAT32_C(-613.82),
+        SIMDE_FLOAT32_C(-247.44), SIMDE_FLOAT32_C(-716.55), SIMDE_FLOAT32_C( 662.53), SIMDE_FLOAT32_C( 756.97) },
+      UINT8_C(   23),
+      { SIMDE_FLOAT32_C(-420.44), SIMDE_FLOAT32_C(-491.37), SIMDE_FLOAT32_C(-520.31), SIMDE_FLOAT32_C( 273.75),
+        SIMDE_FLOAT32_C( 219.94), SIMDE_FLOAT32_C( 641.10), SIMDE_FLOAT32_C( 350.91), SIMDE_FLOAT32_C( 839.66) },
+      { SIMDE_FLOAT32_C(  -0.821172), SIMDE_FLOAT32_C(  -0.959707), SIMDE_FLOAT32_C(  -0.508115), SIMDE_FLOAT32_C(-613.82),
+        SIMDE_FLOAT32_C(   0.859141), SIMDE_FLOAT32_C(-716.55), SIMDE_FLOAT32_C( 662.53), SIMDE_FLOAT32_C( 756.97) } },
+    { { SIMDE_FLOAT32_C(-250.88), SIMDE_FLOAT32_C( 491.08), SIMDE_FLOAT32_C(-521.09), SIMDE_FLOAT32_C(-580.62),
+        SIMDE_FLOAT32_C(-582.03), SIMDE_FLOAT32_C( 698.16), SIMDE_FLOAT32_C(-828.97), SIMDE_FLOAT32_C(-960.16) },
+      UINT8_C(  243),
+      { SIMDE_FLOAT32_C( 584.70), SIMDE_FLOAT32_C(  99.47), SIMDE_FLOAT32_C( 858.52), SIMDE_FLOAT32_C( 396.36),
+        SIMDE_FLOAT32_C( 111.80), SIMDE_FLOAT32_C( 699.24), SIMDE_FLOAT32_C( 770.83), SIMDE_FLOAT32_C( 296.60) },
+      { SIMDE_FLOAT32_C(   1.141992), SIMDE_FLOAT32_C(   0.777109), SIMDE_FLOAT32_C(-521.09), SIMDE_FLOAT32_C(-580.62),
+        SIMDE_FLOAT32_C(   0.873438), SIMDE_FLOAT32_C(   1.365703), SIMDE_FLOAT32_C(   0.752764), SIMDE_FLOAT32_C(   1.158594) } }
+  };
+
+  simde__m256 src, a, r;
+
+  src = simde_mm256_loadu_ps(test_vec[0].src);
+  a = simde_mm256_loadu_ps(test_vec[0].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[0].r), 4);
+
+  src = simde_mm256_loadu_ps(test_vec[1].src);
+  a = simde_mm256_loadu_ps(test_vec[1].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[1].r), 4);
+
+  src = simde_mm256_loadu_ps(test_vec[2].src);
+  a = simde_mm256_loadu_ps(test_vec[2].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[2].r), 4);
+
+  src = simde_mm256_loadu_ps(test_vec[3].src);
+  a = simde_mm256_loadu_ps(test_vec[3].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[3].r), 4);
+
+  src = simde_mm256_loadu_ps(test_vec[4].src);
+  a = simde_mm256_loadu_ps(test_vec[4].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[4].r), 4);
+
+  src = simde_mm256_loadu_ps(test_vec[5].src);
+  a = simde_mm256_loadu_ps(test_vec[5].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[5].r), 4);
+
+  src = simde_mm256_loadu_ps(test_vec[6].src);
+  a = simde_mm256_loadu_ps(test_vec[6].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[6].r), 4);
+
+  src = simde_mm256_loadu_ps(test_vec[7].src);
+  a = simde_mm256_loadu_ps(test_vec[7].a);
+  r = simde_mm256_mask_getmant_ps(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(  112),
+      { SIMDE_FLOAT32_C(-757.87), SIMDE_FLOAT32_C( 565.39), SIMDE_FLOAT32_C(-534.30), SIMDE_FLOAT32_C( 731.08),
+        SIMDE_FLOAT32_C( 856.99), SIMDE_FLOAT32_C( 995.62), SIMDE_FLOAT32_C( 143.28), SIMDE_FLOAT32_C( 312.48) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   1.673809), SIMDE_FLOAT32_C(   1.944570), SIMDE_FLOAT32_C(   1.119375), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(  138),
+      { SIMDE_FLOAT32_C(-376.53), SIMDE_FLOAT32_C(-388.83), SIMDE_FLOAT32_C(-871.83), SIMDE_FLOAT32_C(-432.48),
+        SIMDE_FLOAT32_C(-200.54), SIMDE_FLOAT32_C( 753.21), SIMDE_FLOAT32_C(  38.30), SIMDE_FLOAT32_C( 731.05) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.518867), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.689375),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.713916) } },
+    { UINT8_C(  145),
+      { SIMDE_FLOAT32_C( 154.12), SIMDE_FLOAT32_C( 289.28), SIMDE_FLOAT32_C( 652.83), SIMDE_FLOAT32_C( 809.60),
+        SIMDE_FLOAT32_C( 275.09), SIMDE_FLOAT32_C( -30.89), SIMDE_FLOAT32_C( -28.89), SIMDE_FLOAT32_C( 263.54) },
+      { SIMDE_FLOAT32_C(   0.602031), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.537285), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.514727) } },
+    { UINT8_C(   15),
+      { SIMDE_FLOAT32_C( 666.23), SIMDE_FLOAT32_C(   9.24), SIMDE_FLOAT32_C( 108.81), SIMDE_FLOAT32_C(-125.46),
+        SIMDE_FLOAT32_C( 472.04), SIMDE_FLOAT32_C(-451.36), SIMDE_FLOAT32_C(-703.83), SIMDE_FLOAT32_C( 419.91) },
+      { SIMDE_FLOAT32_C(   1.301230), SIMDE_FLOAT32_C(   1.155), SIMDE_FLOAT32_C(   0.850078), SIMDE_FLOAT32_C(  -0.980156),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(  180),
+      { SIMDE_FLOAT32_C( 350.32), SIMDE_FLOAT32_C( 327.67), SIMDE_FLOAT32_C( 895.31), SIMDE_FLOAT32_C( 108.81),
+        SIMDE_FLOAT32_C( 254.57), SIMDE_FLOAT32_C( 900.16), SIMDE_FLOAT32_C(  98.83), SIMDE_FLOAT32_C(  79.83) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.748652), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   1.988828), SIMDE_FLOAT32_C(   1.758125), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.247344) } },
+    { UINT8_C(  148),
+      { SIMDE_FLOAT32_C(-407.98), SIMDE_FLOAT32_C(-788.69), SIMDE_FLOAT32_C( 851.12), SIMDE_FLOAT32_C( 618.06),
+        SIMDE_FLOAT32_C(-797.67), SIMDE_FLOAT32_C(-469.87), SIMDE_FLOAT32_C(-758.72), SIMDE_FLOAT32_C(-493.33) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.831172), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.778975), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.927070) } },
+    { UINT8_C(  149),
+      { SIMDE_FLOAT32_C( 922.76), SIMDE_FLOAT32_C(-164.88), SIMDE_FLOAT32_C( 746.66), SIMDE_FLOAT32_C( -84.04),
+        SIMDE_FLOAT32_C(-301.72), SIMDE_FLOAT32_C(-890.94), SIMDE_FLOAT32_C(-962.30), SIMDE_FLOAT32_C(-671.91) },
+      { SIMDE_FLOAT32_C(   0.901133), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.729160), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -0.589297), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.656162) } },
+    { UINT8_C(   78),
+      { SIMDE_FLOAT32_C( 982.12), SIMDE_FLOAT32_C( 347.09), SIMDE_FLOAT32_C( 284.37), SIMDE_FLOAT32_C(  49.12),
+        SIMDE_FLOAT32_C( 106.75), SIMDE_FLOAT32_C( 784.36), SIMDE_FLOAT32_C( 295.73), SIMDE_FLOAT32_C( 481.76) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.355820), SIMDE_FLOAT32_C(   1.110820), SIMDE_FLOAT32_C(   0.7675),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.155195), SIMDE_FLOAT32_C(   0.00) } }
+  };
+
+  simde__m256 a, r;
+
+  a = simde_mm256_loadu_ps(test_vec[0].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[0].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[1].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[1].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[2].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[2].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[3].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[3].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[4].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[4].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[5].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[5].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[6].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[6].r), 4);
+
+  a = simde_mm256_loadu_ps(test_vec[7].a);
+  r = simde_mm256_maskz_getmant_ps(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm256_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( 467.52), SIMDE_FLOAT64_C(-647.56), SIMDE_FLOAT64_C(-261.64), SIMDE_FLOAT64_C( 439.48) },
+      { SIMDE_FLOAT64_C(   1.82625), SIMDE_FLOAT64_C(  -1.264766), SIMDE_FLOAT64_C(  -1.022031), SIMDE_FLOAT64_C(   1.716719) } },
+    { { SIMDE_FLOAT64_C(-969.45), SIMDE_FLOAT64_C( 239.92), SIMDE_FLOAT64_C(-960.22), SIMDE_FLOAT64_C(-783.42) },
+      { SIMDE_FLOAT64_C(  -0.946729), SIMDE_FLOAT64_C(   0.937187), SIMDE_FLOAT64_C(  -0.937715), SIMDE_FLOAT64_C(  -0.765059) } },
+    { { SIMDE_FLOAT64_C( -90.24), SIMDE_FLOAT64_C(-118.83), SIMDE_FLOAT64_C(-734.02), SIMDE_FLOAT64_C( 356.88) },
+      { SIMDE_FLOAT64_C(   0.705), SIMDE_FLOAT64_C(   0.928359), SIMDE_FLOAT64_C(   0.716816), SIMDE_FLOAT64_C(   0.697031) } },
+    { { SIMDE_FLOAT64_C( 458.97), SIMDE_FLOAT64_C(-714.72), SIMDE_FLOAT64_C( -16.67), SIMDE_FLOAT64_C( 394.74) },
+      { SIMDE_FLOAT64_C(   0.896426), SIMDE_FLOAT64_C(  -1.395938), SIMDE_FLOAT64_C(  -1.041875), SIMDE_FLOAT64_C(   0.770977) } },
+    { { SIMDE_FLOAT64_C( 994.16), SIMDE_FLOAT64_C( 604.60), SIMDE_FLOAT64_C( 449.48), SIMDE_FLOAT64_C( 283.60) },
+      { SIMDE_FLOAT64_C(   1.941719), SIMDE_FLOAT64_C(   1.180859), SIMDE_FLOAT64_C(   1.755781), SIMDE_FLOAT64_C(   1.107813) } },
+    { { SIMDE_FLOAT64_C(-812.23), SIMDE_FLOAT64_C( 336.00), SIMDE_FLOAT64_C(  83.07), SIMDE_FLOAT64_C(-278.40) },
+      { SIMDE_FLOAT64_C(   0.793193), SIMDE_FLOAT64_C(   1.3125), SIMDE_FLOAT64_C(   1.297969), SIMDE_FLOAT64_C(   1.0875) } },
+    { { SIMDE_FLOAT64_C( 717.40), SIMDE_FLOAT64_C(-978.11), SIMDE_FLOAT64_C( 458.16), SIMDE_FLOAT64_C( 125.06) },
+      { SIMDE_FLOAT64_C(   0.700586), SIMDE_FLOAT64_C(  -0.955186), SIMDE_FLOAT64_C(   0.894844), SIMDE_FLOAT64_C(   0.977031) } },
+    { { SIMDE_FLOAT64_C( 664.27), SIMDE_FLOAT64_C( 970.63), SIMDE_FLOAT64_C( 796.88), SIMDE_FLOAT64_C( 199.11) },
+      { SIMDE_FLOAT64_C(   1.297402), SIMDE_FLOAT64_C(   0.947881), SIMDE_FLOAT64_C(   0.778203), SIMDE_FLOAT64_C(   0.777773) } }
+  };
+
+  simde__m256d a, r;
+
+  a = simde_mm256_loadu_pd(test_vec[0].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[0].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[1].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[1].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[2].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[2].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[3].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[3].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[4].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[4].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[5].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[5].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[6].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[6].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[7].a);
+  r = simde_mm256_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(-667.52), SIMDE_FLOAT64_C(-330.20), SIMDE_FLOAT64_C(-796.29), SIMDE_FLOAT64_C(-595.37) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C(  -8.85), SIMDE_FLOAT64_C( 888.35), SIMDE_FLOAT64_C( 850.29), SIMDE_FLOAT64_C( 327.73) },
+      { SIMDE_FLOAT64_C(-667.52), SIMDE_FLOAT64_C(   1.735059), SIMDE_FLOAT64_C(-796.29), SIMDE_FLOAT64_C(-595.37) } },
+    { { SIMDE_FLOAT64_C( 684.40), SIMDE_FLOAT64_C( 821.09), SIMDE_FLOAT64_C(-562.30), SIMDE_FLOAT64_C(-157.23) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C( 977.71), SIMDE_FLOAT64_C(-730.75), SIMDE_FLOAT64_C( 817.56), SIMDE_FLOAT64_C( 783.29) },
+      { SIMDE_FLOAT64_C(   0.954795), SIMDE_FLOAT64_C( 821.09), SIMDE_FLOAT64_C(-562.30), SIMDE_FLOAT64_C(-157.23) } },
+    { { SIMDE_FLOAT64_C( 679.00), SIMDE_FLOAT64_C(-971.18), SIMDE_FLOAT64_C(-863.44), SIMDE_FLOAT64_C( 208.01) },
+      UINT8_C(   12),
+      { SIMDE_FLOAT64_C(-140.70), SIMDE_FLOAT64_C( 505.44), SIMDE_FLOAT64_C(-965.48), SIMDE_FLOAT64_C(-423.63) },
+      { SIMDE_FLOAT64_C( 679.00), SIMDE_FLOAT64_C(-971.18), SIMDE_FLOAT64_C(   0.942852), SIMDE_FLOAT64_C(   0.827402) } },
+    { { SIMDE_FLOAT64_C( 776.22), SIMDE_FLOAT64_C( 919.33), SIMDE_FLOAT64_C( -53.93), SIMDE_FLOAT64_C(-795.20) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT64_C( 504.46), SIMDE_FLOAT64_C(-798.80), SIMDE_FLOAT64_C( 273.56), SIMDE_FLOAT64_C(-470.64) },
+      { SIMDE_FLOAT64_C( 776.22), SIMDE_FLOAT64_C( 919.33), SIMDE_FLOAT64_C( -53.93), SIMDE_FLOAT64_C(  -0.919219) } },
+    { { SIMDE_FLOAT64_C( 341.27), SIMDE_FLOAT64_C( 562.56), SIMDE_FLOAT64_C( 230.65), SIMDE_FLOAT64_C(-889.01) },
+      UINT8_C(   14),
+      { SIMDE_FLOAT64_C( 272.17), SIMDE_FLOAT64_C( 812.71), SIMDE_FLOAT64_C( 575.28), SIMDE_FLOAT64_C( 307.92) },
+      { SIMDE_FLOAT64_C( 341.27), SIMDE_FLOAT64_C(   1.587324), SIMDE_FLOAT64_C(   1.123594), SIMDE_FLOAT64_C(   1.202813) } },
+    { { SIMDE_FLOAT64_C(-603.23), SIMDE_FLOAT64_C(-868.61), SIMDE_FLOAT64_C( 997.04), SIMDE_FLOAT64_C(  73.13) },
+      UINT8_C(    5),
+      { SIMDE_FLOAT64_C( 549.74), SIMDE_FLOAT64_C(-309.45), SIMDE_FLOAT64_C( 947.60), SIMDE_FLOAT64_C( -67.39) },
+      { SIMDE_FLOAT64_C(   0.536855), SIMDE_FLOAT64_C(-868.61), SIMDE_FLOAT64_C(   0.925391), SIMDE_FLOAT64_C(  73.13) } },
+    { { SIMDE_FLOAT64_C( 763.69), SIMDE_FLOAT64_C( 548.12), SIMDE_FLOAT64_C( 205.54), SIMDE_FLOAT64_C(-607.40) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT64_C(-193.32), SIMDE_FLOAT64_C(-737.45), SIMDE_FLOAT64_C(-615.23), SIMDE_FLOAT64_C( 991.99) },
+      { SIMDE_FLOAT64_C(  -0.755156), SIMDE_FLOAT64_C(  -0.720166), SIMDE_FLOAT64_C(  -0.600811), SIMDE_FLOAT64_C(   0.968740) } },
+    { { SIMDE_FLOAT64_C( 416.65), SIMDE_FLOAT64_C(-625.79), SIMDE_FLOAT64_C( 523.80), SIMDE_FLOAT64_C(-992.40) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT64_C( 352.13), SIMDE_FLOAT64_C( 846.06), SIMDE_FLOAT64_C( 251.58), SIMDE_FLOAT64_C( 176.37) },
+      { SIMDE_FLOAT64_C( 416.65), SIMDE_FLOAT64_C(-625.79), SIMDE_FLOAT64_C( 523.80), SIMDE_FLOAT64_C(   1.377891) } }
+  };
+
+  simde__m256d src, a, r;
+
+  src = simde_mm256_loadu_pd(test_vec[0].src);
+  a = simde_mm256_loadu_pd(test_vec[0].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[0].r), 4);
+
+  src = simde_mm256_loadu_pd(test_vec[1].src);
+  a = simde_mm256_loadu_pd(test_vec[1].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[1].r), 4);
+
+  src = simde_mm256_loadu_pd(test_vec[2].src);
+  a = simde_mm256_loadu_pd(test_vec[2].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[2].r), 4);
+
+  src = simde_mm256_loadu_pd(test_vec[3].src);
+  a = simde_mm256_loadu_pd(test_vec[3].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[3].r), 4);
+
+  src = simde_mm256_loadu_pd(test_vec[4].src);
+  a = simde_mm256_loadu_pd(test_vec[4].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[4].r), 4);
+
+  src = simde_mm256_loadu_pd(test_vec[5].src);
+  a = simde_mm256_loadu_pd(test_vec[5].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[5].r), 4);
+
+  src = simde_mm256_loadu_pd(test_vec[6].src);
+  a = simde_mm256_loadu_pd(test_vec[6].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[6].r), 4);
+
+  src = simde_mm256_loadu_pd(test_vec[7].src);
+  a = simde_mm256_loadu_pd(test_vec[7].a);
+  r = simde_mm256_mask_getmant_pd(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(    9),
+      { SIMDE_FLOAT64_C(  26.12), SIMDE_FLOAT64_C(-940.72), SIMDE_FLOAT64_C( 742.05), SIMDE_FLOAT64_C( 687.23) },
+      { SIMDE_FLOAT64_C(   1.6325), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   1.342246) } },
+    { UINT8_C(   14),
+      { SIMDE_FLOAT64_C(-999.23), SIMDE_FLOAT64_C( 700.44), SIMDE_FLOAT64_C(  24.45), SIMDE_FLOAT64_C(-343.42) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.684023), SIMDE_FLOAT64_C(   1.528125), SIMDE_FLOAT64_C(  -1.341484) } },
+    { UINT8_C(    6),
+      { SIMDE_FLOAT64_C( 689.93), SIMDE_FLOAT64_C(-784.52), SIMDE_FLOAT64_C(-765.29), SIMDE_FLOAT64_C(-484.80) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.766133), SIMDE_FLOAT64_C(   0.747354), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(   11),
+      { SIMDE_FLOAT64_C( 716.55), SIMDE_FLOAT64_C(-417.24), SIMDE_FLOAT64_C( 239.08), SIMDE_FLOAT64_C( -14.13) },
+      { SIMDE_FLOAT64_C(   1.399512), SIMDE_FLOAT64_C(  -0.814922), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.883125) } },
+    { UINT8_C(   15),
+      { SIMDE_FLOAT64_C( 608.12), SIMDE_FLOAT64_C(  17.03), SIMDE_FLOAT64_C( 276.90), SIMDE_FLOAT64_C( 279.07) },
+      { SIMDE_FLOAT64_C(   1.187734), SIMDE_FLOAT64_C(   1.064375), SIMDE_FLOAT64_C(   1.081641), SIMDE_FLOAT64_C(   1.090117) } },
+    { UINT8_C(   13),
+      { SIMDE_FLOAT64_C(   1.55), SIMDE_FLOAT64_C(-466.49), SIMDE_FLOAT64_C(-374.65), SIMDE_FLOAT64_C( 977.21) },
+      { SIMDE_FLOAT64_C(   1.55), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   1.463477), SIMDE_FLOAT64_C(   0.954307) } },
+    { UINT8_C(   13),
+      { SIMDE_FLOAT64_C( 581.40), SIMDE_FLOAT64_C(-489.53), SIMDE_FLOAT64_C(-199.71), SIMDE_FLOAT64_C( 191.02) },
+      { SIMDE_FLOAT64_C(   0.567773), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.780117), SIMDE_FLOAT64_C(   0.746172) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 289.67), SIMDE_FLOAT64_C( 160.25), SIMDE_FLOAT64_C( 902.14), SIMDE_FLOAT64_C( 780.63) },
+      { SIMDE_FLOAT64_C(   1.131523), SIMDE_FLOAT64_C(   1.251953), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } }
+  };
+
+  simde__m256d a, r;
+
+  a = simde_mm256_loadu_pd(test_vec[0].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[0].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[1].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[1].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[2].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[2].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[3].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[3].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[4].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[4].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[5].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[5].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[6].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[6].r), 4);
+
+  a = simde_mm256_loadu_pd(test_vec[7].a);
+  r = simde_mm256_maskz_getmant_pd(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm512_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( 774.89), SIMDE_FLOAT32_C( 699.33), SIMDE_FLOAT32_C(  80.14), SIMDE_FLOAT32_C(-905.47),
+        SIMDE_FLOAT32_C(-143.75), SIMDE_FLOAT32_C(-386.70), SIMDE_FLOAT32_C(-639.30), SIMDE_FLOAT32_C( 734.30),
+        SIMDE_FLOAT32_C(-695.34), SIMDE_FLOAT32_C(-205.36), SIMDE_FLOAT32_C( -22.23), SIMDE_FLOAT32_C( 453.21),
+        SIMDE_FLOAT32_C(-452.56), SIMDE_FLOAT32_C( 369.72), SIMDE_FLOAT32_C(-759.58), SIMDE_FLOAT32_C(-574.41) },
+      { SIMDE_FLOAT32_C(   1.513457), SIMDE_FLOAT32_C(   1.365879), SIMDE_FLOAT32_C(   1.252187), SIMDE_FLOAT32_C(  -1.768496),
+        SIMDE_FLOAT32_C(  -1.123047), SIMDE_FLOAT32_C(  -1.510547), SIMDE_FLOAT32_C(  -1.248633), SIMDE_FLOAT32_C(   1.434180),
+        SIMDE_FLOAT32_C(  -1.358086), SIMDE_FLOAT32_C(  -1.604375), SIMDE_FLOAT32_C(  -1.389375), SIMDE_FLOAT32_C(   1.770352),
+        SIMDE_FLOAT32_C(  -1.767812), SIMDE_FLOAT32_C(   1.444219), SIMDE_FLOAT32_C(  -1.483555), SIMDE_FLOAT32_C(  -1.121894) } },
+    { { SIMDE_FLOAT32_C( 107.24), SIMDE_FLOAT32_C( 776.57), SIMDE_FLOAT32_C(-925.36), SIMDE_FLOAT32_C(-956.49),
+        SIMDE_FLOAT32_C(-124.86), SIMDE_FLOAT32_C( 331.26), SIMDE_FLOAT32_C( 933.73), SIMDE_FLOAT32_C( 612.47),
+        SIMDE_FLOAT32_C( 658.99), SIMDE_FLOAT32_C( 806.23), SIMDE_FLOAT32_C(-994.93), SIMDE_FLOAT32_C(-889.01),
+        SIMDE_FLOAT32_C(-281.78), SIMDE_FLOAT32_C(-765.98), SIMDE_FLOAT32_C( 217.12), SIMDE_FLOAT32_C(-574.16) },
+      { SIMDE_FLOAT32_C(   1.675625), SIMDE_FLOAT32_C(   0.758369), SIMDE_FLOAT32_C(  -0.903672), SIMDE_FLOAT32_C(  -0.934072),
+        SIMDE_FLOAT32_C(  -1.950938), SIMDE_FLOAT32_C(   1.293984), SIMDE_FLOAT32_C(   0.911846), SIMDE_FLOAT32_C(   0.598115),
+        SIMDE_FLOAT32_C(   0.643545), SIMDE_FLOAT32_C(   0.787334), SIMDE_FLOAT32_C(  -0.971611), SIMDE_FLOAT32_C(  -0.868174),
+        SIMDE_FLOAT32_C(  -1.100703), SIMDE_FLOAT32_C(  -0.748027), SIMDE_FLOAT32_C(   0.848125), SIMDE_FLOAT32_C(  -0.560703) } },
+    { { SIMDE_FLOAT32_C(-274.74), SIMDE_FLOAT32_C(-990.64), SIMDE_FLOAT32_C(-671.85), SIMDE_FLOAT32_C( 771.50),
+        SIMDE_FLOAT32_C(-144.75), SIMDE_FLOAT32_C(-495.34), SIMDE_FLOAT32_C(-238.28), SIMDE_FLOAT32_C(-412.48),
+        SIMDE_FLOAT32_C(-202.30), SIMDE_FLOAT32_C(-422.53), SIMDE_FLOAT32_C(  29.99), SIMDE_FLOAT32_C( 716.72),
+        SIMDE_FLOAT32_C( 235.79), SIMDE_FLOAT32_C(-326.77), SIMDE_FLOAT32_C( 447.46), SIMDE_FLOAT32_C(-158.83) },
+      { SIMDE_FLOAT32_C(   0.536602), SIMDE_FLOAT32_C(   0.967422), SIMDE_FLOAT32_C(   0.656103), SIMDE_FLOAT32_C(   0.753418),
+        SIMDE_FLOAT32_C(   0.565430), SIMDE_FLOAT32_C(   0.967461), SIMDE_FLOAT32_C(   0.930781), SIMDE_FLOAT32_C(   0.805625),
+        SIMDE_FLOAT32_C(   0.790234), SIMDE_FLOAT32_C(   0.825254), SIMDE_FLOAT32_C(   0.937187), SIMDE_FLOAT32_C(   0.699922),
+        SIMDE_FLOAT32_C(   0.921055), SIMDE_FLOAT32_C(   0.638223), SIMDE_FLOAT32_C(   0.873945), SIMDE_FLOAT32_C(   0.620430) } },
+    { { SIMDE_FLOAT32_C( 937.35), SIMDE_FLOAT32_C(-278.85), SIMDE_FLOAT32_C(-420.77), SIMDE_FLOAT32_C( 910.13),
+        SIMDE_FLOAT32_C( -82.59), SIMDE_FLOAT32_C( 906.77), SIMDE_FLOAT32_C( 578.03), SIMDE_FLOAT32_C(-971.45),
+        SIMDE_FLOAT32_C(  88.32), SIMDE_FLOAT32_C( -15.90), SIMDE_FLOAT32_C( 300.48), SIMDE_FLOAT32_C( 808.38),
+        SIMDE_FLOAT32_C( 642.87), SIMDE_FLOAT32_C(-906.08), SIMDE_FLOAT32_C(-225.33), SIMDE_FLOAT32_C( 440.07) },
+      { SIMDE_FLOAT32_C(   0.915381), SIMDE_FLOAT32_C(  -1.089258), SIMDE_FLOAT32_C(  -0.821816), SIMDE_FLOAT32_C(   0.888799),
+        SIMDE_FLOAT32_C(  -1.290469), SIMDE_FLOAT32_C(   0.885518), SIMDE_FLOAT32_C(   1.128965), SIMDE_FLOAT32_C(  -0.948682),
+        SIMDE_FLOAT32_C(   1.38), SIMDE_FLOAT32_C(  -0.99375), SIMDE_FLOAT32_C(   1.17375), SIMDE_FLOAT32_C(   0.789434),
+        SIMDE_FLOAT32_C(   1.255605), SIMDE_FLOAT32_C(  -0.884844), SIMDE_FLOAT32_C(  -0.880195), SIMDE_FLOAT32_C(   0.859512) } },
+    { { SIMDE_FLOAT32_C( 837.65), SIMDE_FLOAT32_C( 224.11), SIMDE_FLOAT32_C( 307.02), SIMDE_FLOAT32_C( 137.03),
+        SIMDE_FLOAT32_C( 948.54), SIMDE_FLOAT32_C( 283.30), SIMDE_FLOAT32_C( 334.60), SIMDE_FLOAT32_C(  56.49),
+        SIMDE_FLOAT32_C( 227.15), SIMDE_FLOAT32_C(  17.89), SIMDE_FLOAT32_C( 851.02), SIMDE_FLOAT32_C( 564.76),
+        SIMDE_FLOAT32_C( 810.10), SIMDE_FLOAT32_C( 412.80), SIMDE_FLOAT32_C( 319.73), SIMDE_FLOAT32_C( 297.29) },
+      { SIMDE_FLOAT32_C(   1.636035), SIMDE_FLOAT32_C(   1.750859), SIMDE_FLOAT32_C(   1.199297), SIMDE_FLOAT32_C(   1.070547),
+        SIMDE_FLOAT32_C(   1.852617), SIMDE_FLOAT32_C(   1.106641), SIMDE_FLOAT32_C(   1.307031), SIMDE_FLOAT32_C(   1.765313),
+        SIMDE_FLOAT32_C(   1.774609), SIMDE_FLOAT32_C(   1.118125), SIMDE_FLOAT32_C(   1.662148), SIMDE_FLOAT32_C(   1.103047),
+        SIMDE_FLOAT32_C(   1.582227), SIMDE_FLOAT32_C(   1.6125), SIMDE_FLOAT32_C(   1.248945), SIMDE_FLOAT32_C(   1.161289) } },
+    { { SIMDE_FLOAT32_C( 767.32), SIMDE_FLOAT32_C( 988.63), SIMDE_FLOAT32_C(-432.96), SIMDE_FLOAT32_C(-144.50),
+        SIMDE_FLOAT32_C( 341.65), SIMDE_FLOAT32_C(-544.16), SIMDE_FLOAT32_C(-128.89), SIMDE_FLOAT32_C( 558.56),
+        SIMDE_FLOAT32_C( 945.44), SIMDE_FLOAT32_C( 735.91), SIMDE_FLOAT32_C( 274.85), SIMDE_FLOAT32_C( 184.47),
+        SIMDE_FLOAT32_C( -45.66), SIMDE_FLOAT32_C( 282.21), SIMDE_FLOAT32_C(  37.78), SIMDE_FLOAT32_C(-936.76) },
+      { SIMDE_FLOAT32_C(   0.749336), SIMDE_FLOAT32_C(   0.965459), SIMDE_FLOAT32_C(   1.69125), SIMDE_FLOAT32_C(   0.564453),
+        SIMDE_FLOAT32_C(   1.334570), SIMDE_FLOAT32_C(   0.531406), SIMDE_FLOAT32_C(   0.503477), SIMDE_FLOAT32_C(   0.545469),
+        SIMDE_FLOAT32_C(   0.923281), SIMDE_FLOAT32_C(   0.718662), SIMDE_FLOAT32_C(   1.073633), SIMDE_FLOAT32_C(   0.720586),
+        SIMDE_FLOAT32_C(   0.713437), SIMDE_FLOAT32_C(   1.102383), SIMDE_FLOAT32_C(   0.590312), SIMDE_FLOAT32_C(   0.914805) } },
+    { { SIMDE_FLOAT32_C(  58.40), SIMDE_FLOAT32_C( 294.08), SIMDE_FLOAT32_C( 773.95), SIMDE_FLOAT32_C( 989.42),
+        SIMDE_FLOAT32_C( 926.20), SIMDE_FLOAT32_C( 461.00), SIMDE_FLOAT32_C(-747.32), SIMDE_FLOAT32_C(-970.60),
+        SIMDE_FLOAT32_C(-760.64), SIMDE_FLOAT32_C( 706.54), SIMDE_FLOAT32_C(-990.84), SIMDE_FLOAT32_C( 104.05),
+        SIMDE_FLOAT32_C( 590.69), SIMDE_FLOAT32_C( 331.52), SIMDE_FLOAT32_C( 396.13), SIMDE_FLOAT32_C( 296.88) },
+      { SIMDE_FLOAT32_C(   0.9125), SIMDE_FLOAT32_C(   0.574375), SIMDE_FLOAT32_C(   0.755811), SIMDE_FLOAT32_C(   0.966230),
+        SIMDE_FLOAT32_C(   0.904492), SIMDE_FLOAT32_C(   0.900391), SIMDE_FLOAT32_C(  -0.729805), SIMDE_FLOAT32_C(  -0.947852),
+        SIMDE_FLOAT32_C(  -0.742813), SIMDE_FLOAT32_C(   0.689980), SIMDE_FLOAT32_C(  -0.967617), SIMDE_FLOAT32_C(   0.812891),
+        SIMDE_FLOAT32_C(   0.576846), SIMDE_FLOAT32_C(   0.6475), SIMDE_FLOAT32_C(   0.773691), SIMDE_FLOAT32_C(   0.579844) } },
+    { { SIMDE_FLOAT32_C( 333.88), SIMDE_FLOAT32_C( 656.37), SIMDE_FLOAT32_C(  13.34), SIMDE_FLOAT32_C( 642.70),
+        SIMDE_FLOAT32_C( 615.45), SIMDE_FLOAT32_C( 500.09), SIMDE_FLOAT32_C( 448.88), SIMDE_FLOAT32_C( 884.13),
+        SIMDE_FLOAT32_C( 536.94), SIMDE_FLOAT32_C( 133.08), SIMDE_FLOAT32_C( 354.76), SIMDE_FLOAT32_C( 920.79),
+        SIMDE_FLOAT32_C(  54.48), SIMDE_FLOAT32_C( 603.01), SIMDE_FLOAT32_C( 494.36), SIMDE_FLOAT32_C( 196.98) },
+      { SIMDE_FLOAT32_C(   1.304219), SIMDE_FLOAT32_C(   1.281973), SIMDE_FLOAT32_C(   0.83375), SIMDE_FLOAT32_C(   1.255273),
+        SIMDE_FLOAT32_C(   1.202051), SIMDE_FLOAT32_C(   0.976738), SIMDE_FLOAT32_C(   0.876719), SIMDE_FLOAT32_C(   0.863408),
+        SIMDE_FLOAT32_C(   1.048711), SIMDE_FLOAT32_C(   1.039688), SIMDE_FLOAT32_C(   1.385781), SIMDE_FLOAT32_C(   0.899209),
+        SIMDE_FLOAT32_C(   0.85125), SIMDE_FLOAT32_C(   1.177754), SIMDE_FLOAT32_C(   0.965547), SIMDE_FLOAT32_C(   0.769453) } }
+  };
+
+  simde__m512 a, r;
+
+  a = simde_mm512_loadu_ps(test_vec[0].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[0].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[1].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[1].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[2].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[2].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[3].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[3].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[4].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[4].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[5].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[5].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[6].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[6].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[7].a);
+  r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -89.31), SIMDE_FLOAT32_C( 837.75), SIMDE_FLOAT32_C(-994.27), SIMDE_FLOAT32_C(-938.46),
+        SIMDE_FLOAT32_C(-870.75), SIMDE_FLOAT32_C( 738.98), SIMDE_FLOAT32_C( 793.84), SIMDE_FLOAT32_C(-512.40),
+        SIMDE_FLOAT32_C( 292.89), SIMDE_FLOAT32_C(-958.81), SIMDE_FLOAT32_C(-469.18), SIMDE_FLOAT32_C(-751.37),
+        SIMDE_FLOAT32_C( 104.35), SIMDE_FLOAT32_C(-938.17), SIMDE_FLOAT32_C( 240.39), SIMDE_FLOAT32_C(-293.97) },
+      UINT16_C(10646),
+      { SIMDE_FLOAT32_C(-619.65), SIMDE_FLOAT32_C( 175.13), SIMDE_FLOAT32_C(-775.95), SIMDE_FLOAT32_C( 827.53),
+        SIMDE_FLOAT32_C(-694.15), SIMDE_FLOAT32_C( 422.73), SIMDE_FLOAT32_C( 442.66), SIMDE_FLOAT32_C( 723.47),
+        SIMDE_FLOAT32_C(-403.41), SIMDE_FLOAT32_C(  -6.98), SIMDE_FLOAT32_C(-301.99), SIMDE_FLOAT32_C(   1.62),
+        SIMDE_FLOAT32_C(-507.24), SIMDE_FLOAT32_C( 765.47), SIMDE_FLOAT32_C(-442.01), SIMDE_FLOAT32_C(-342.69) },
+      { SIMDE_FLOAT32_C( -89.31), SIMDE_FLOAT32_C(   1.368203), SIMDE_FLOAT32_C(  -1.515527), SIMDE_FLOAT32_C(-938.46),
+        SIMDE_FLOAT32_C(  -1.355762), SIMDE_FLOAT32_C( 738.98), SIMDE_FLOAT32_C( 793.84), SIMDE_FLOAT32_C(   1.413027),
+        SIMDE_FLOAT32_C(  -1.575820), SIMDE_FLOAT32_C(-958.81), SIMDE_FLOAT32_C(-469.18), SIMDE_FLOAT32_C(   1.62),
+        SIMDE_FLOAT32_C( 104.35), SIMDE_FLOAT32_C(   1.495059), SIMDE_FLOAT32_C( 240.39), SIMDE_FLOAT32_C(-293.97) } },
+    { { SIMDE_FLOAT32_C( 148.95), SIMDE_FLOAT32_C( 489.18), SIMDE_FLOAT32_C(-823.25), SIMDE_FLOAT32_C( 625.80),
+        SIMDE_FLOAT32_C(-721.88), SIMDE_FLOAT32_C(-351.51), SIMDE_FLOAT32_C( 131.42), SIMDE_FLOAT32_C( 490.19),
+        SIMDE_FLOAT32_C(-959.58), SIMDE_FLOAT32_C(-405.46), SIMDE_FLOAT32_C(-205.34), SIMDE_FLOAT32_C(-359.72),
+        SIMDE_FLOAT32_C( 832.81), SIMDE_FLOAT32_C( 499.10), SIMDE_FLOAT32_C( 190.54), SIMDE_FLOAT32_C(-928.29) },
+      UINT16_C(35034),
+      { SIMDE_FLOAT32_C(-174.73), SIMDE_FLOAT32_C(-963.02), SIMDE_FLOAT32_C(-915.99), SIMDE_FLOAT32_C( 599.26),
+        SIMDE_FLOAT32_C( 909.37), SIMDE_FLOAT32_C( -57.13), SIMDE_FLOAT32_C(-640.72), SIMDE_FLOAT32_C( 730.44),
+        SIMDE_FLOAT32_C(-809.30), SIMDE_FLOAT32_C(-245.96), SIMDE_FLOAT32_C(-910.18), SIMDE_FLOAT32_C(-806.68),
+        SIMDE_FLOAT32_C(-897.23), SIMDE_FLOAT32_C( 355.66), SIMDE_FLOAT32_C( 409.48), SIMDE_FLOAT32_C(-535.53) },
+      { SIMDE_FLOAT32_C( 148.95), SIMDE_FLOAT32_C(  -0.940449), SIMDE_FLOAT32_C(-823.25), SIMDE_FLOAT32_C(   0.585215),
+        SIMDE_FLOAT32_C(   0.888057), SIMDE_FLOAT32_C(-351.51), SIMDE_FLOAT32_C(  -0.625703), SIMDE_FLOAT32_C(   0.713320),
+        SIMDE_FLOAT32_C(-959.58), SIMDE_FLOAT32_C(-405.46), SIMDE_FLOAT32_C(-205.34), SIMDE_FLOAT32_C(  -0.787773),
+        SIMDE_FLOAT32_C( 832.81), SIMDE_FLOAT32_C( 499.10), SIMDE_FLOAT32_C( 190.54), SIMDE_FLOAT32_C(  -0.522979) } },
+    { { SIMDE_FLOAT32_C(-938.42), SIMDE_FLOAT32_C(  97.43), SIMDE_FLOAT32_C(-973.84), SIMDE_FLOAT32_C( 822.13),
+        SIMDE_FLOAT32_C(-157.42), SIMDE_FLOAT32_C(-583.99), SIMDE_FLOAT32_C( 204.82), SIMDE_FLOAT32_C( 241.07),
+        SIMDE_FLOAT32_C(-229.41), SIMDE_FLOAT32_C(-841.89), SIMDE_FLOAT32_C( 663.63), SIMDE_FLOAT32_C( 959.53),
+        SIMDE_FLOAT32_C( 994.70), SIMDE_FLOAT32_C(-198.44), SIMDE_FLOAT32_C(  18.88), SIMDE_FLOAT32_C( 904.93) },
+      UINT16_C(50160),
+      { SIMDE_FLOAT32_C( 131.33), SIMDE_FLOAT32_C(-672.71), SIMDE_FLOAT32_C(-975.62), SIMDE_FLOAT32_C( 863.80),
+        SIMDE_FLOAT32_C( 832.44), SIMDE_FLOAT32_C( 421.40), SIMDE_FLOAT32_C(-959.35), SIMDE_FLOAT32_C( -49.05),
+        SIMDE_FLOAT32_C( 278.91), SIMDE_FLOAT32_C( 623.88), SIMDE_FLOAT32_C( 670.09), SIMDE_FLOAT32_C(-360.66),
+        SIMDE_FLOAT32_C(-299.62), SIMDE_FLOAT32_C(-415.50), SIMDE_FLOAT32_C( 597.19), SIMDE_FLOAT32_C( 324.08) },
+      { SIMDE_FLOAT32_C(-938.42), SIMDE_FLOAT32_C(  97.43), SIMDE_FLOAT32_C(-973.84), SIMDE_FLOAT32_C( 822.13),
+        SIMDE_FLOAT32_C(   0.812930), SIMDE_FLOAT32_C(   0.823047), SIMDE_FLOAT32_C(   0.936865), SIMDE_FLOAT32_C(   0.766406),
+        SIMDE_FLOAT32_C(   0.544746), SIMDE_FLOAT32_C(   0.609258), SIMDE_FLOAT32_C( 663.63), SIMDE_FLOAT32_C( 959.53),
+        SIMDE_FLOAT32_C( 994.70), SIMDE_FLOAT32_C(-198.44), SIMDE_FLOAT32_C(   0.583193), SIMDE_FLOAT32_C(   0.632969) } },
+    { { SIMDE_FLOAT32_C( 779.66), SIMDE_FLOAT32_C(-280.54), SIMDE_FLOAT32_C(-362.86), SIMDE_FLOAT32_C( 352.65),
+        SIMDE_FLOAT32_C( 995.21), SIMDE_FLOAT32_C(-345.72), SIMDE_FLOAT32_C(-661.07), SIMDE_FLOAT32_C(-249.70),
+        SIMDE_FLOAT32_C( 281.30), SIMDE_FLOAT32_C( 136.48), SIMDE_FLOAT32_C( 303.73), SIMDE_FLOAT32_C( 270.34),
+        SIMDE_FLOAT32_C( 559.94), SIMDE_FLOAT32_C( 545.70), SIMDE_FLOAT32_C(-214.70), SIMDE_FLOAT32_C(-810.60) },
+      UINT16_C(53875),
+      { SIMDE_FLOAT32_C(-491.54), SIMDE_FLOAT32_C(-367.67), SIMDE_FLOAT32_C( 699.10), SIMDE_FLOAT32_C(-645.57),
+        SIMDE_FLOAT32_C(-729.85), SIMDE_FLOAT32_C(-889.54), SIMDE_FLOAT32_C(-922.90), SIMDE_FLOAT32_C( 845.76),
+        SIMDE_FLOAT32_C(-899.58), SIMDE_FLOAT32_C( 940.19), SIMDE_FLOAT32_C( 932.59), SIMDE_FLOAT32_C( 390.84),
+        SIMDE_FLOAT32_C(-338.56), SIMDE_FLOAT32_C( 629.33), SIMDE_FLOAT32_C( 752.98), SIMDE_FLOAT32_C(-905.28) },
+      { SIMDE_FLOAT32_C(  -0.960039), SIMDE_FLOAT32_C(  -1.436211), SIMDE_FLOAT32_C(-362.86), SIMDE_FLOAT32_C( 352.65),
+        SIMDE_FLOAT32_C(  -1.425488), SIMDE_FLOAT32_C(  -0.868691), SIMDE_FLOAT32_C(  -0.901270), SIMDE_FLOAT32_C(-249.70),
+        SIMDE_FLOAT32_C( 281.30), SIMDE_FLOAT32_C(   0.918154), SIMDE_FLOAT32_C( 303.73), SIMDE_FLOAT32_C( 270.34),
+        SIMDE_FLOAT32_C(  -1.3225), SIMDE_FLOAT32_C( 545.70), SIMDE_FLOAT32_C(   1.470664), SIMDE_FLOAT32_C(  -0.884063) } },
+    { { SIMDE_FLOAT32_C( 768.39), SIMDE_FLOAT32_C(  -5.11), SIMDE_FLOAT32_C( -36.24), SIMDE_FLOAT32_C(-661.42),
+        SIMDE_FLOAT32_C( -38.41), SIMDE_FLOAT32_C( 272.35), SIMDE_FLOAT32_C( 389.83), SIMDE_FLOAT32_C(-496.25),
+        SIMDE_FLOAT32_C( 969.64), SIMDE_FLOAT32_C(-607.48), SIMDE_FLOAT32_C(-145.52), SIMDE_FLOAT32_C( 146.13),
+        SIMDE_FLOAT32_C( 672.96), SIMDE_FLOAT32_C( 364.65), SIMDE_FLOAT32_C(-711.31), SIMDE_FLOAT32_C(-356.05) },
+      UINT16_C(15484),
+      { SIMDE_FLOAT32_C( 467.12), SIMDE_FLOAT32_C( 325.95), SIMDE_FLOAT32_C(  64.11), SIMDE_FLOAT32_C( 740.57),
+        SIMDE_FLOAT32_C( 495.60), SIMDE_FLOAT32_C(  95.51), SIMDE_FLOAT32_C( 299.57), SIMDE_FLOAT32_C( 411.62),
+        SIMDE_FLOAT32_C(  46.51), SIMDE_FLOAT32_C( 582.96), SIMDE_FLOAT32_C( 212.98), SIMDE_FLOAT32_C(  82.22),
+        SIMDE_FLOAT32_C( 359.72), SIMDE_FLOAT32_C( 525.87), SIMDE_FLOAT32_C( 870.51), SIMDE_FLOAT32_C( 956.78) },
+      { SIMDE_FLOAT32_C( 768.39), SIMDE_FLOAT32_C(  -5.11), SIMDE_FLOAT32_C(   1.001719), SIMDE_FLOAT32_C(   1.446426),
+        SIMDE_FLOAT32_C(   1.935938), SIMDE_FLOAT32_C(   1.492344), SIMDE_FLOAT32_C(   1.170195), SIMDE_FLOAT32_C(-496.25),
+        SIMDE_FLOAT32_C( 969.64), SIMDE_FLOAT32_C(-607.48), SIMDE_FLOAT32_C(   1.663906), SIMDE_FLOAT32_C(   1.284688),
+        SIMDE_FLOAT32_C(   1.405156), SIMDE_FLOAT32_C(   1.027090), SIMDE_FLOAT32_C(-711.31), SIMDE_FLOAT32_C(-356.05) } },
+    { { SIMDE_FLOAT32_C( 406.08), SIMDE_FLOAT32_C(-563.55), SIMDE_FLOAT32_C(-601.83), SIMDE_FLOAT32_C(-283.84),
+        SIMDE_FLOAT32_C( 467.94), SIMDE_FLOAT32_C( 518.59), SIMDE_FLOAT32_C( 206.56), SIMDE_FLOAT32_C(  95.37),
+        SIMDE_FLOAT32_C(-247.86), SIMDE_FLOAT32_C(-612.53), SIMDE_FLOAT32_C(-207.14), SIMDE_FLOAT32_C(-157.95),
+        SIMDE_FLOAT32_C(-746.22), SIMDE_FLOAT32_C(-348.66), SIMDE_FLOAT32_C( 341.77), SIMDE_FLOAT32_C( 282.58) },
+      UINT16_C(27288),
+      { SIMDE_FLOAT32_C( -84.94), SIMDE_FLOAT32_C( 472.39), SIMDE_FLOAT32_C(-283.51), SIMDE_FLOAT32_C(-690.34),
+        SIMDE_FLOAT32_C(-864.32), SIMDE_FLOAT32_C( 181.60), SIMDE_FLOAT32_C(  40.81), SIMDE_FLOAT32_C( 286.20),
+        SIMDE_FLOAT32_C(-541.09), SIMDE_FLOAT32_C(  45.43), SIMDE_FLOAT32_C(-878.67), SIMDE_FLOAT32_C( 741.70),
+        SIMDE_FLOAT32_C(-144.83), SIMDE_FLOAT32_C( 950.46), SIMDE_FLOAT32_C( -25.33), SIMDE_FLOAT32_C( 593.59) },
+      { SIMDE_FLOAT32_C( 406.08), SIMDE_FLOAT32_C(-563.55), SIMDE_FLOAT32_C(-601.83), SIMDE_FLOAT32_C(   0.674160),
+        SIMDE_FLOAT32_C(   0.844063), SIMDE_FLOAT32_C( 518.59), SIMDE_FLOAT32_C( 206.56), SIMDE_FLOAT32_C(   1.117969),
+        SIMDE_FLOAT32_C(-247.86), SIMDE_FLOAT32_C(   0.709844), SIMDE_FLOAT32_C(-207.14), SIMDE_FLOAT32_C(   0.724316),
+        SIMDE_FLOAT32_C(-746.22), SIMDE_FLOAT32_C(   0.928184), SIMDE_FLOAT32_C(   1.583125), SIMDE_FLOAT32_C( 282.58) } },
+    { { SIMDE_FLOAT32_C( 278.33), SIMDE_FLOAT32_C(-136.74), SIMDE_FLOAT32_C(-614.61), SIMDE_FLOAT32_C(-791.69),
+        SIMDE_FLOAT32_C(-365.46), SIMDE_FLOAT32_C( 422.38), SIMDE_FLOAT32_C(  40.17), SIMDE_FLOAT32_C( 215.97),
+        SIMDE_FLOAT32_C(  49.65), SIMDE_FLOAT32_C( 409.58), SIMDE_FLOAT32_C( 655.13), SIMDE_FLOAT32_C(-660.16),
+        SIMDE_FLOAT32_C( -28.67), SIMDE_FLOAT32_C(-991.59), SIMDE_FLOAT32_C(-759.05), SIMDE_FLOAT32_C(-678.17) },
+      UINT16_C(10410),
+      { SIMDE_FLOAT32_C( 669.92), SIMDE_FLOAT32_C(-611.03), SIMDE_FLOAT32_C( 619.12), SIMDE_FLOAT32_C( 920.53),
+        SIMDE_FLOAT32_C(-404.74), SIMDE_FLOAT32_C( 438.46), SIMDE_FLOAT32_C( 182.57), SIMDE_FLOAT32_C(-332.11),
+        SIMDE_FLOAT32_C(  74.04), SIMDE_FLOAT32_C(-309.82), SIMDE_FLOAT32_C(-486.63), SIMDE_FLOAT32_C(-113.76),
+        SIMDE_FLOAT32_C( 824.13), SIMDE_FLOAT32_C( 617.25), SIMDE_FLOAT32_C(-437.58), SIMDE_FLOAT32_C( 569.86) },
+      { SIMDE_FLOAT32_C( 278.33), SIMDE_FLOAT32_C(  -0.596709), SIMDE_FLOAT32_C(-614.61), SIMDE_FLOAT32_C(   0.898955),
+        SIMDE_FLOAT32_C(-365.46), SIMDE_FLOAT32_C(   0.856367), SIMDE_FLOAT32_C(  40.17), SIMDE_FLOAT32_C(  -0.648652),
+        SIMDE_FLOAT32_C(  49.65), SIMDE_FLOAT32_C( 409.58), SIMDE_FLOAT32_C( 655.13), SIMDE_FLOAT32_C(  -0.88875),
+        SIMDE_FLOAT32_C( -28.67), SIMDE_FLOAT32_C(   0.602783), SIMDE_FLOAT32_C(-759.05), SIMDE_FLOAT32_C(-678.17) } },
+    { { SIMDE_FLOAT32_C(-857.03), SIMDE_FLOAT32_C(-347.87), SIMDE_FLOAT32_C( 564.22), SIMDE_FLOAT32_C(-407.02),
+        SIMDE_FLOAT32_C( 498.39), SIMDE_FLOAT32_C(-117.91), SIMDE_FLOAT32_C(-829.18), SIMDE_FLOAT32_C(-373.19),
+        SIMDE_FLOAT32_C( 127.82), SIMDE_FLOAT32_C( 408.57), SIMDE_FLOAT32_C(-295.69), SIMDE_FLOAT32_C(-360.18),
+        SIMDE_FLOAT32_C( 506.19), SIMDE_FLOAT32_C(-510.87), SIMDE_FLOAT32_C( 850.55), SIMDE_FLOAT32_C(-487.94) },
+      UINT16_C( 8403),
+      { SIMDE_FLOAT32_C( 756.00), SIMDE_FLOAT32_C( 295.02), SIMDE_FLOAT32_C( 862.90), SIMDE_FLOAT32_C( 428.90),
+        SIMDE_FLOAT32_C( 873.95), SIMDE_FLOAT32_C(  93.43), SIMDE_FLOAT32_C( 531.81), SIMDE_FLOAT32_C( 734.45),
+        SIMDE_FLOAT32_C( 455.49), SIMDE_FLOAT32_C( 476.84), SIMDE_FLOAT32_C( 581.69), SIMDE_FLOAT32_C( 955.82),
+        SIMDE_FLOAT32_C( 575.61), SIMDE_FLOAT32_C( 479.31), SIMDE_FLOAT32_C( 946.91), SIMDE_FLOAT32_C( 771.88) },
+      { SIMDE_FLOAT32_C(   1.476562), SIMDE_FLOAT32_C(   1.152422), SIMDE_FLOAT32_C( 564.22), SIMDE_FLOAT32_C(-407.02),
+        SIMDE_FLOAT32_C(   0.853467), SIMDE_FLOAT32_C(-117.91), SIMDE_FLOAT32_C(   1.038691), SIMDE_FLOAT32_C(   1.434473),
+        SIMDE_FLOAT32_C( 127.82), SIMDE_FLOAT32_C( 408.57), SIMDE_FLOAT32_C(-295.69), SIMDE_FLOAT32_C(-360.18),
+        SIMDE_FLOAT32_C( 506.19), SIMDE_FLOAT32_C(   0.936152), SIMDE_FLOAT32_C( 850.55), SIMDE_FLOAT32_C(-487.94) } }
+  };
+
+  simde__m512 src, a, r;
+
+  src = simde_mm512_loadu_ps(test_vec[0].src);
+  a = simde_mm512_loadu_ps(test_vec[0].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[0].r), 4);
+
+  src = simde_mm512_loadu_ps(test_vec[1].src);
+  a = simde_mm512_loadu_ps(test_vec[1].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[1].r), 4);
+
+  src = simde_mm512_loadu_ps(test_vec[2].src);
+  a = simde_mm512_loadu_ps(test_vec[2].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[2].r), 4);
+
+  src = simde_mm512_loadu_ps(test_vec[3].src);
+  a = simde_mm512_loadu_ps(test_vec[3].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[3].r), 4);
+
+  src = simde_mm512_loadu_ps(test_vec[4].src);
+  a = simde_mm512_loadu_ps(test_vec[4].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[4].r), 4);
+
+  src = simde_mm512_loadu_ps(test_vec[5].src);
+  a = simde_mm512_loadu_ps(test_vec[5].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[5].r), 4);
+
+  src = simde_mm512_loadu_ps(test_vec[6].src);
+  a = simde_mm512_loadu_ps(test_vec[6].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[6].r), 4);
+
+  src = simde_mm512_loadu_ps(test_vec[7].src);
+  a = simde_mm512_loadu_ps(test_vec[7].a);
+  r = simde_mm512_mask_getmant_ps(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(39562),
+      { SIMDE_FLOAT32_C(-906.48), SIMDE_FLOAT32_C( 400.16), SIMDE_FLOAT32_C(-532.00), SIMDE_FLOAT32_C( 548.82),
+        SIMDE_FLOAT32_C(-812.54), SIMDE_FLOAT32_C( 430.57), SIMDE_FLOAT32_C( 744.87), SIMDE_FLOAT32_C(-161.70),
+        SIMDE_FLOAT32_C(-618.57), SIMDE_FLOAT32_C( 777.16), SIMDE_FLOAT32_C(-122.80), SIMDE_FLOAT32_C( 190.89),
+        SIMDE_FLOAT32_C(-130.87), SIMDE_FLOAT32_C( 984.21), SIMDE_FLOAT32_C( -75.60), SIMDE_FLOAT32_C(-869.86) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.563125), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.071914),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.263281),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.517891), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.491328),
+        SIMDE_FLOAT32_C(  -1.022422), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -1.698945) } },
+    { UINT16_C(13767),
+      { SIMDE_FLOAT32_C(-751.04), SIMDE_FLOAT32_C(-844.45), SIMDE_FLOAT32_C( 827.82), SIMDE_FLOAT32_C(-418.68),
+        SIMDE_FLOAT32_C( 864.78), SIMDE_FLOAT32_C(-421.98), SIMDE_FLOAT32_C( -41.44), SIMDE_FLOAT32_C(-845.14),
+        SIMDE_FLOAT32_C(-870.86), SIMDE_FLOAT32_C( 753.22), SIMDE_FLOAT32_C(  87.43), SIMDE_FLOAT32_C( 114.94),
+        SIMDE_FLOAT32_C(-988.47), SIMDE_FLOAT32_C( 650.29), SIMDE_FLOAT32_C(-159.85), SIMDE_FLOAT32_C( 734.63) },
+      { SIMDE_FLOAT32_C(  -0.733437), SIMDE_FLOAT32_C(  -0.824658), SIMDE_FLOAT32_C(   0.808418), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.6475), SIMDE_FLOAT32_C(  -0.825332),
+        SIMDE_FLOAT32_C(  -0.850449), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.366094), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -0.965303), SIMDE_FLOAT32_C(   0.635049), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(45637),
+      { SIMDE_FLOAT32_C(-297.45), SIMDE_FLOAT32_C(-679.43), SIMDE_FLOAT32_C( 513.09), SIMDE_FLOAT32_C( 447.09),
+        SIMDE_FLOAT32_C(-530.46), SIMDE_FLOAT32_C( 305.71), SIMDE_FLOAT32_C(-664.96), SIMDE_FLOAT32_C(-915.40),
+        SIMDE_FLOAT32_C( 201.79), SIMDE_FLOAT32_C( 233.65), SIMDE_FLOAT32_C( 332.96), SIMDE_FLOAT32_C(-244.09),
+        SIMDE_FLOAT32_C( 629.78), SIMDE_FLOAT32_C( 208.93), SIMDE_FLOAT32_C(-507.80), SIMDE_FLOAT32_C( 283.23) },
+      { SIMDE_FLOAT32_C(   0.580957), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.501064), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.649375), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.912695), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.615020), SIMDE_FLOAT32_C(   0.816133), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.553184) } },
+    { UINT16_C(19408),
+      { SIMDE_FLOAT32_C( 637.12), SIMDE_FLOAT32_C( 450.93), SIMDE_FLOAT32_C( 154.89), SIMDE_FLOAT32_C(-820.96),
+        SIMDE_FLOAT32_C( 117.70), SIMDE_FLOAT32_C( -25.28), SIMDE_FLOAT32_C( 693.98), SIMDE_FLOAT32_C(-325.97),
+        SIMDE_FLOAT32_C( 705.49), SIMDE_FLOAT32_C(-572.96), SIMDE_FLOAT32_C( -69.01), SIMDE_FLOAT32_C( 942.50),
+        SIMDE_FLOAT32_C( 508.72), SIMDE_FLOAT32_C( 345.67), SIMDE_FLOAT32_C(-988.48), SIMDE_FLOAT32_C(-681.08) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.919531), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.355430), SIMDE_FLOAT32_C(  -1.273320),
+        SIMDE_FLOAT32_C(   1.377910), SIMDE_FLOAT32_C(  -1.119063), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.920410),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.965312), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(44745),
+      { SIMDE_FLOAT32_C( 419.04), SIMDE_FLOAT32_C( 619.71), SIMDE_FLOAT32_C( 588.38), SIMDE_FLOAT32_C( 651.43),
+        SIMDE_FLOAT32_C( 883.78), SIMDE_FLOAT32_C( 603.99), SIMDE_FLOAT32_C( 437.55), SIMDE_FLOAT32_C( 637.44),
+        SIMDE_FLOAT32_C( 438.43), SIMDE_FLOAT32_C( 552.07), SIMDE_FLOAT32_C( 415.53), SIMDE_FLOAT32_C( 432.19),
+        SIMDE_FLOAT32_C( 743.30), SIMDE_FLOAT32_C( 797.45), SIMDE_FLOAT32_C( 156.39), SIMDE_FLOAT32_C( 586.72) },
+      { SIMDE_FLOAT32_C(   1.636875), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.272324),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.709180), SIMDE_FLOAT32_C(   1.245),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.078262), SIMDE_FLOAT32_C(   1.623164), SIMDE_FLOAT32_C(   1.688242),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.557520), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.145937) } },
+    { UINT16_C(41890),
+      { SIMDE_FLOAT32_C(-236.02), SIMDE_FLOAT32_C( 561.14), SIMDE_FLOAT32_C(-361.63), SIMDE_FLOAT32_C( 490.51),
+        SIMDE_FLOAT32_C(   2.41), SIMDE_FLOAT32_C(-668.71), SIMDE_FLOAT32_C(-474.03), SIMDE_FLOAT32_C( 962.08),
+        SIMDE_FLOAT32_C( 805.23), SIMDE_FLOAT32_C( 203.66), SIMDE_FLOAT32_C(-196.63), SIMDE_FLOAT32_C( 438.41),
+        SIMDE_FLOAT32_C( 699.70), SIMDE_FLOAT32_C( 660.73), SIMDE_FLOAT32_C(-443.99), SIMDE_FLOAT32_C(-325.45) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.547988), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.653037), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.939531),
+        SIMDE_FLOAT32_C(   0.786357), SIMDE_FLOAT32_C(   0.795547), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.645244), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.271289) } },
+    { UINT16_C(13829),
+      { SIMDE_FLOAT32_C( 446.08), SIMDE_FLOAT32_C(-507.08), SIMDE_FLOAT32_C(-474.32), SIMDE_FLOAT32_C( 445.89),
+        SIMDE_FLOAT32_C( 948.98), SIMDE_FLOAT32_C(  67.72), SIMDE_FLOAT32_C( 757.12), SIMDE_FLOAT32_C( 480.01),
+        SIMDE_FLOAT32_C( 278.81), SIMDE_FLOAT32_C( 284.19), SIMDE_FLOAT32_C(-420.81), SIMDE_FLOAT32_C(-539.94),
+        SIMDE_FLOAT32_C(-746.14), SIMDE_FLOAT32_C( 228.57), SIMDE_FLOAT32_C(-812.57), SIMDE_FLOAT32_C( 459.36) },
+      { SIMDE_FLOAT32_C(   0.87125), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.926406), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.555059), SIMDE_FLOAT32_C(  -0.821895), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -0.728652), SIMDE_FLOAT32_C(   0.892852), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(44463),
+      { SIMDE_FLOAT32_C(  37.76), SIMDE_FLOAT32_C( 840.22), SIMDE_FLOAT32_C( 468.83), SIMDE_FLOAT32_C( 588.27),
+        SIMDE_FLOAT32_C( 430.17), SIMDE_FLOAT32_C( 287.26), SIMDE_FLOAT32_C(   2.54), SIMDE_FLOAT32_C(  62.15),
+        SIMDE_FLOAT32_C( 953.69), SIMDE_FLOAT32_C( 424.21), SIMDE_FLOAT32_C( 749.57), SIMDE_FLOAT32_C(  39.90),
+        SIMDE_FLOAT32_C( 307.54), SIMDE_FLOAT32_C( 982.64), SIMDE_FLOAT32_C( 659.28), SIMDE_FLOAT32_C( 629.33) },
+      { SIMDE_FLOAT32_C(   1.18), SIMDE_FLOAT32_C(   0.820527), SIMDE_FLOAT32_C(   0.915684), SIMDE_FLOAT32_C(   1.148965),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.122109), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.971094),
+        SIMDE_FLOAT32_C(   0.931338), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.464004), SIMDE_FLOAT32_C(   1.246875),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.959609), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.229160) } }
+  };
+
+  simde__m512 a, r;
+
+  a = simde_mm512_loadu_ps(test_vec[0].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[0].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[1].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[1].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[2].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[2].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[3].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[3].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[4].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[4].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[5].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[5].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[6].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[6].r), 4);
+
+  a = simde_mm512_loadu_ps(test_vec[7].a);
+  r = simde_mm512_maskz_getmant_ps(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm512_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( 188.39), SIMDE_FLOAT64_C( 315.46), SIMDE_FLOAT64_C(-712.87), SIMDE_FLOAT64_C(  58.03),
+        SIMDE_FLOAT64_C(-841.44), SIMDE_FLOAT64_C( 117.88), SIMDE_FLOAT64_C( 317.66), SIMDE_FLOAT64_C( 834.00) },
+      { SIMDE_FLOAT64_C(   1.471797), SIMDE_FLOAT64_C(   1.232266), SIMDE_FLOAT64_C(  -1.392324), SIMDE_FLOAT64_C(   1.813438),
+        SIMDE_FLOAT64_C(  -1.643438), SIMDE_FLOAT64_C(   1.841875), SIMDE_FLOAT64_C(   1.240859), SIMDE_FLOAT64_C(   1.628906) } },
+    { { SIMDE_FLOAT64_C(-214.53), SIMDE_FLOAT64_C(-513.41), SIMDE_FLOAT64_C( 635.69), SIMDE_FLOAT64_C(-402.02),
+        SIMDE_FLOAT64_C(-990.61), SIMDE_FLOAT64_C( -35.36), SIMDE_FLOAT64_C( 824.51), SIMDE_FLOAT64_C( 839.09) },
+      { SIMDE_FLOAT64_C(  -0.838008), SIMDE_FLOAT64_C(  -0.501377), SIMDE_FLOAT64_C(   0.620791), SIMDE_FLOAT64_C(  -1.570391),
+        SIMDE_FLOAT64_C(  -0.967393), SIMDE_FLOAT64_C(  -0.5525), SIMDE_FLOAT64_C(   0.805186), SIMDE_FLOAT64_C(   0.819424) } },
+    { { SIMDE_FLOAT64_C(-303.66), SIMDE_FLOAT64_C( 286.31), SIMDE_FLOAT64_C(-339.18), SIMDE_FLOAT64_C( 146.58),
+        SIMDE_FLOAT64_C(  84.72), SIMDE_FLOAT64_C( 420.85), SIMDE_FLOAT64_C( 468.44), SIMDE_FLOAT64_C( 684.65) },
+      { SIMDE_FLOAT64_C(   0.593086), SIMDE_FLOAT64_C(   0.559199), SIMDE_FLOAT64_C(   0.662461), SIMDE_FLOAT64_C(   0.572578),
+        SIMDE_FLOAT64_C(   0.661875), SIMDE_FLOAT64_C(   0.821973), SIMDE_FLOAT64_C(   0.914922), SIMDE_FLOAT64_C(   0.668604) } },
+    { { SIMDE_FLOAT64_C(-987.92), SIMDE_FLOAT64_C(-429.75), SIMDE_FLOAT64_C(-369.92), SIMDE_FLOAT64_C( 235.61),
+        SIMDE_FLOAT64_C( 326.00), SIMDE_FLOAT64_C(-138.65), SIMDE_FLOAT64_C(  43.24), SIMDE_FLOAT64_C(-536.35) },
+      { SIMDE_FLOAT64_C(  -0.964766), SIMDE_FLOAT64_C(  -0.839355), SIMDE_FLOAT64_C(  -1.445), SIMDE_FLOAT64_C(   0.920352),
+        SIMDE_FLOAT64_C(   1.273438), SIMDE_FLOAT64_C(  -1.083203), SIMDE_FLOAT64_C(   1.35125), SIMDE_FLOAT64_C(  -1.047559) } },
+    { { SIMDE_FLOAT64_C( 472.46), SIMDE_FLOAT64_C( 873.74), SIMDE_FLOAT64_C( 585.73), SIMDE_FLOAT64_C( 664.41),
+        SIMDE_FLOAT64_C( 621.17), SIMDE_FLOAT64_C( 939.11), SIMDE_FLOAT64_C( 417.61), SIMDE_FLOAT64_C( 308.92) },
+      { SIMDE_FLOAT64_C(   1.845547), SIMDE_FLOAT64_C(   1.706523), SIMDE_FLOAT64_C(   1.144004), SIMDE_FLOAT64_C(   1.297676),
+        SIMDE_FLOAT64_C(   1.213223), SIMDE_FLOAT64_C(   1.834199), SIMDE_FLOAT64_C(   1.631289), SIMDE_FLOAT64_C(   1.206719) } },
+    { { SIMDE_FLOAT64_C(-404.34), SIMDE_FLOAT64_C( 587.04), SIMDE_FLOAT64_C(-643.59), SIMDE_FLOAT64_C( 984.53),
+        SIMDE_FLOAT64_C( 150.43), SIMDE_FLOAT64_C(-501.79), SIMDE_FLOAT64_C( 711.78), SIMDE_FLOAT64_C( 277.57) },
+      { SIMDE_FLOAT64_C(   1.579453), SIMDE_FLOAT64_C(   0.573281), SIMDE_FLOAT64_C(   0.628506), SIMDE_FLOAT64_C(   0.961455),
+        SIMDE_FLOAT64_C(   0.587617), SIMDE_FLOAT64_C(   1.960117), SIMDE_FLOAT64_C(   0.695098), SIMDE_FLOAT64_C(   1.084258) } },
+    { { SIMDE_FLOAT64_C( 272.38), SIMDE_FLOAT64_C(-417.05), SIMDE_FLOAT64_C( 589.94), SIMDE_FLOAT64_C(-407.38),
+        SIMDE_FLOAT64_C(-869.59), SIMDE_FLOAT64_C( -42.57), SIMDE_FLOAT64_C(-514.91), SIMDE_FLOAT64_C(-114.47) },
+      { SIMDE_FLOAT64_C(   0.531992), SIMDE_FLOAT64_C(  -0.814551), SIMDE_FLOAT64_C(   0.576113), SIMDE_FLOAT64_C(  -0.795664),
+        SIMDE_FLOAT64_C(  -0.849209), SIMDE_FLOAT64_C(  -0.665156), SIMDE_FLOAT64_C(  -0.502842), SIMDE_FLOAT64_C(  -0.894297) } },
+    { { SIMDE_FLOAT64_C( 101.26), SIMDE_FLOAT64_C( 974.38), SIMDE_FLOAT64_C(  84.89), SIMDE_FLOAT64_C( 625.12),
+        SIMDE_FLOAT64_C( 422.73), SIMDE_FLOAT64_C( 517.27), SIMDE_FLOAT64_C( 193.34), SIMDE_FLOAT64_C( 440.19) },
+      { SIMDE_FLOAT64_C(   0.791094), SIMDE_FLOAT64_C(   0.951543), SIMDE_FLOAT64_C(   1.326406), SIMDE_FLOAT64_C(   1.220938),
+        SIMDE_FLOAT64_C(   0.825645), SIMDE_FLOAT64_C(   1.010293), SIMDE_FLOAT64_C(   0.755234), SIMDE_FLOAT64_C(   0.859746) } }
+  };
+
+  simde__m512d a, r;
+
+  a = simde_mm512_loadu_pd(test_vec[0].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[0].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[1].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[1].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[2].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[2].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[3].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[3].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[4].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[4].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[5].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[5].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[6].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[6].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[7].a);
+  r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  68.84), SIMDE_FLOAT64_C(-431.44), SIMDE_FLOAT64_C(-181.59), SIMDE_FLOAT64_C(-277.67),
+        SIMDE_FLOAT64_C(-474.77), SIMDE_FLOAT64_C(-961.21), SIMDE_FLOAT64_C( 441.44), SIMDE_FLOAT64_C( 131.86) },
+      UINT8_C(  213),
+      { SIMDE_FLOAT64_C( 270.78), SIMDE_FLOAT64_C( 535.87), SIMDE_FLOAT64_C(-108.24), SIMDE_FLOAT64_C( 742.07),
+        SIMDE_FLOAT64_C( 370.75), SIMDE_FLOAT64_C(-657.60), SIMDE_FLOAT64_C(  69.38), SIMDE_FLOAT64_C( 360.93) },
+      { SIMDE_FLOAT64_C(   1.057734), SIMDE_FLOAT64_C(-431.44), SIMDE_FLOAT64_C(  -1.69125), SIMDE_FLOAT64_C(-277.67),
+        SIMDE_FLOAT64_C(   1.448242), SIMDE_FLOAT64_C(-961.21), SIMDE_FLOAT64_C(   1.084062), SIMDE_FLOAT64_C(   1.409883) } },
+    { { SIMDE_FLOAT64_C( 626.69), SIMDE_FLOAT64_C( 955.53), SIMDE_FLOAT64_C(-464.44), SIMDE_FLOAT64_C(-608.47),
+        SIMDE_FLOAT64_C(-379.56), SIMDE_FLOAT64_C( -16.61), SIMDE_FLOAT64_C( 922.63), SIMDE_FLOAT64_C(-153.35) },
+      UINT8_C(   49),
+      { SIMDE_FLOAT64_C(-674.99), SIMDE_FLOAT64_C(-912.76), SIMDE_FLOAT64_C(-464.97), SIMDE_FLOAT64_C( -65.95),
+        SIMDE_FLOAT64_C( 140.46), SIMDE_FLOAT64_C( -15.19), SIMDE_FLOAT64_C( 260.21), SIMDE_FLOAT64_C(-294.43) },
+      { SIMDE_FLOAT64_C(  -0.659170), SIMDE_FLOAT64_C( 955.53), SIMDE_FLOAT64_C(-464.44), SIMDE_FLOAT64_C(-608.47),
+        SIMDE_FLOAT64_C(   0.548672), SIMDE_FLOAT64_C(  -0.949375), SIMDE_FLOAT64_C( 922.63), SIMDE_FLOAT64_C(-153.35) } },
+    { { SIMDE_FLOAT64_C(-756.80), SIMDE_FLOAT64_C( 882.26), SIMDE_FLOAT64_C(-218.62), SIMDE_FLOAT64_C(-600.89),
+        SIMDE_FLOAT64_C(-270.20), SIMDE_FLOAT64_C( 742.18), SIMDE_FLOAT64_C( 944.38), SIMDE_FLOAT64_C(-799.32) },
+      UINT8_C(  229),
+      { SIMDE_FLOAT64_C( 418.37), SIMDE_FLOAT64_C( 864.44), SIMDE_FLOAT64_C(-841.57), SIMDE_FLOAT64_C( -59.98),
+        SIMDE_FLOAT64_C( 452.36), SIMDE_FLOAT64_C( 604.34), SIMDE_FLOAT64_C(-466.37), SIMDE_FLOAT64_C( 789.37) },
+      { SIMDE_FLOAT64_C(   0.817129), SIMDE_FLOAT64_C( 882.26), SIMDE_FLOAT64_C(   0.821846), SIMDE_FLOAT64_C(-600.89),
+        SIMDE_FLOAT64_C(-270.20), SIMDE_FLOAT64_C(   0.590176), SIMDE_FLOAT64_C(   0.910879), SIMDE_FLOAT64_C(   0.770869) } },
+    { { SIMDE_FLOAT64_C( 928.95), SIMDE_FLOAT64_C(-137.90), SIMDE_FLOAT64_C( 623.94), SIMDE_FLOAT64_C(-332.73),
+        SIMDE_FLOAT64_C( 698.31), SIMDE_FLOAT64_C(-255.12), SIMDE_FLOAT64_C( 764.01), SIMDE_FLOAT64_C(-418.86) },
+      UINT8_C(  143),
+      { SIMDE_FLOAT64_C(-307.33), SIMDE_FLOAT64_C(  51.48), SIMDE_FLOAT64_C( 506.82), SIMDE_FLOAT64_C( 822.80),
+        SIMDE_FLOAT64_C(-210.74), SIMDE_FLOAT64_C(-120.49), SIMDE_FLOAT64_C(-707.69), SIMDE_FLOAT64_C(-164.56) },
+      { SIMDE_FLOAT64_C(  -1.200508), SIMDE_FLOAT64_C(   0.804375), SIMDE_FLOAT64_C(   0.989883), SIMDE_FLOAT64_C(   0.803516),
+        SIMDE_FLOAT64_C( 698.31), SIMDE_FLOAT64_C(-255.12), SIMDE_FLOAT64_C( 764.01), SIMDE_FLOAT64_C(  -1.285625) } },
+    { { SIMDE_FLOAT64_C( 813.07), SIMDE_FLOAT64_C( 315.05), SIMDE_FLOAT64_C(-937.36), SIMDE_FLOAT64_C(-676.65),
+        SIMDE_FLOAT64_C(-997.81), SIMDE_FLOAT64_C(-689.54), SIMDE_FLOAT64_C( 790.81), SIMDE_FLOAT64_C( -23.85) },
+      UINT8_C(  222),
+      { SIMDE_FLOAT64_C( 648.11), SIMDE_FLOAT64_C(  41.35), SIMDE_FLOAT64_C( 832.52), SIMDE_FLOAT64_C( 999.32),
+        SIMDE_FLOAT64_C( 495.72), SIMDE_FLOAT64_C( 975.38), SIMDE_FLOAT64_C( 348.81), SIMDE_FLOAT64_C( 721.86) },
+      { SIMDE_FLOAT64_C( 813.07), SIMDE_FLOAT64_C(   1.292188), SIMDE_FLOAT64_C(   1.626016), SIMDE_FLOAT64_C(   1.951797),
+        SIMDE_FLOAT64_C(   1.936406), SIMDE_FLOAT64_C(-689.54), SIMDE_FLOAT64_C(   1.362539), SIMDE_FLOAT64_C(   1.409883) } },
+    { { SIMDE_FLOAT64_C(-458.63), SIMDE_FLOAT64_C(-174.33), SIMDE_FLOAT64_C( 103.63), SIMDE_FLOAT64_C( -62.02),
+        SIMDE_FLOAT64_C(-808.89), SIMDE_FLOAT64_C(-537.12), SIMDE_FLOAT64_C(-238.98), SIMDE_FLOAT64_C( 990.61) },
+      UINT8_C(  173),
+      { SIMDE_FLOAT64_C(-450.24), SIMDE_FLOAT64_C(-751.54), SIMDE_FLOAT64_C(-291.34), SIMDE_FLOAT64_C(  87.14),
+        SIMDE_FLOAT64_C(   6.46), SIMDE_FLOAT64_C( 939.81), SIMDE_FLOAT64_C(-402.34), SIMDE_FLOAT64_C( 719.50) },
+      { SIMDE_FLOAT64_C(   1.75875), SIMDE_FLOAT64_C(-174.33), SIMDE_FLOAT64_C(   1.138047), SIMDE_FLOAT64_C(   1.361563),
+        SIMDE_FLOAT64_C(-808.89), SIMDE_FLOAT64_C(   0.917783), SIMDE_FLOAT64_C(-238.98), SIMDE_FLOAT64_C(   0.702637) } },
+    { { SIMDE_FLOAT64_C( -94.51), SIMDE_FLOAT64_C( 807.79), SIMDE_FLOAT64_C(-532.05), SIMDE_FLOAT64_C(-483.47),
+        SIMDE_FLOAT64_C( 925.59), SIMDE_FLOAT64_C( 110.05), SIMDE_FLOAT64_C(-304.74), SIMDE_FLOAT64_C(-886.40) },
+      UINT8_C(  230),
+      { SIMDE_FLOAT64_C(-512.64), SIMDE_FLOAT64_C( 926.18), SIMDE_FLOAT64_C(-424.09), SIMDE_FLOAT64_C( 638.31),
+        SIMDE_FLOAT64_C(-218.68), SIMDE_FLOAT64_C(-741.68), SIMDE_FLOAT64_C( 825.13), SIMDE_FLOAT64_C( 940.05) },
+      { SIMDE_FLOAT64_C( -94.51), SIMDE_FLOAT64_C(   0.904473), SIMDE_FLOAT64_C(  -0.828301), SIMDE_FLOAT64_C(-483.47),
+        SIMDE_FLOAT64_C( 925.59), SIMDE_FLOAT64_C(  -0.724297), SIMDE_FLOAT64_C(   0.805791), SIMDE_FLOAT64_C(   0.918018) } },
+    { { SIMDE_FLOAT64_C(-119.48), SIMDE_FLOAT64_C(-398.60), SIMDE_FLOAT64_C( 537.14), SIMDE_FLOAT64_C(-207.57),
+        SIMDE_FLOAT64_C(-123.93), SIMDE_FLOAT64_C( 439.43), SIMDE_FLOAT64_C( 767.18), SIMDE_FLOAT64_C( 712.84) },
+      UINT8_C(   87),
+      { SIMDE_FLOAT64_C( 124.43), SIMDE_FLOAT64_C( 779.47), SIMDE_FLOAT64_C( 539.37), SIMDE_FLOAT64_C( 564.73),
+        SIMDE_FLOAT64_C( 715.68), SIMDE_FLOAT64_C( 548.69), SIMDE_FLOAT64_C( 192.09), SIMDE_FLOAT64_C( 755.43) },
+      { SIMDE_FLOAT64_C(   0.972109), SIMDE_FLOAT64_C(   0.761201), SIMDE_FLOAT64_C(   1.053457), SIMDE_FLOAT64_C(-207.57),
+        SIMDE_FLOAT64_C(   1.397812), SIMDE_FLOAT64_C( 439.43), SIMDE_FLOAT64_C(   0.750352), SIMDE_FLOAT64_C( 712.84) } }
+  };
+
+  simde__m512d src, a, r;
+
+  src = simde_mm512_loadu_pd(test_vec[0].src);
+  a = simde_mm512_loadu_pd(test_vec[0].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[0].r), 4);
+
+  src = simde_mm512_loadu_pd(test_vec[1].src);
+  a = simde_mm512_loadu_pd(test_vec[1].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[1].r), 4);
+
+  src = simde_mm512_loadu_pd(test_vec[2].src);
+  a = simde_mm512_loadu_pd(test_vec[2].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[2].r), 4);
+
+  src = simde_mm512_loadu_pd(test_vec[3].src);
+  a = simde_mm512_loadu_pd(test_vec[3].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[3].r), 4);
+
+  src = simde_mm512_loadu_pd(test_vec[4].src);
+  a = simde_mm512_loadu_pd(test_vec[4].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[4].r), 4);
+
+  src = simde_mm512_loadu_pd(test_vec[5].src);
+  a = simde_mm512_loadu_pd(test_vec[5].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[5].r), 4);
+
+  src = simde_mm512_loadu_pd(test_vec[6].src);
+  a = simde_mm512_loadu_pd(test_vec[6].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[6].r), 4);
+
+  src = simde_mm512_loadu_pd(test_vec[7].src);
+  a = simde_mm512_loadu_pd(test_vec[7].a);
+  r = simde_mm512_mask_getmant_pd(src, test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(   88),
+      { SIMDE_FLOAT64_C(-994.51), SIMDE_FLOAT64_C( 464.33), SIMDE_FLOAT64_C(-944.70), SIMDE_FLOAT64_C(-887.75),
+        SIMDE_FLOAT64_C(-105.27), SIMDE_FLOAT64_C( 810.13), SIMDE_FLOAT64_C( 297.27), SIMDE_FLOAT64_C(-485.00) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.733887),
+        SIMDE_FLOAT64_C(  -1.644844), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   1.161211), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  155),
+      { SIMDE_FLOAT64_C( 251.96), SIMDE_FLOAT64_C( 778.56), SIMDE_FLOAT64_C( 301.04), SIMDE_FLOAT64_C(-729.02),
+        SIMDE_FLOAT64_C(-489.64), SIMDE_FLOAT64_C( 769.77), SIMDE_FLOAT64_C(-156.60), SIMDE_FLOAT64_C(-104.28) },
+      { SIMDE_FLOAT64_C(   0.984219), SIMDE_FLOAT64_C(   0.760312), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.711934),
+        SIMDE_FLOAT64_C(  -1.912656), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -1.629375) } },
+    { UINT8_C(   79),
+      { SIMDE_FLOAT64_C(-117.40), SIMDE_FLOAT64_C( 861.34), SIMDE_FLOAT64_C( 590.08), SIMDE_FLOAT64_C( 335.29),
+        SIMDE_FLOAT64_C( 831.60), SIMDE_FLOAT64_C(-480.25), SIMDE_FLOAT64_C(  45.17), SIMDE_FLOAT64_C( 277.48) },
+      { SIMDE_FLOAT64_C(   0.917188), SIMDE_FLOAT64_C(   0.841152), SIMDE_FLOAT64_C(   0.57625), SIMDE_FLOAT64_C(   0.654863),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.705781), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(   86),
+      { SIMDE_FLOAT64_C(-416.38), SIMDE_FLOAT64_C(-798.72), SIMDE_FLOAT64_C( -21.28), SIMDE_FLOAT64_C(  81.26),
+        SIMDE_FLOAT64_C(-399.30), SIMDE_FLOAT64_C( 889.63), SIMDE_FLOAT64_C( 241.04), SIMDE_FLOAT64_C(-995.65) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.78), SIMDE_FLOAT64_C(  -1.33), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(  -0.779883), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.941562), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 813.30), SIMDE_FLOAT64_C( 642.75), SIMDE_FLOAT64_C(  95.33), SIMDE_FLOAT64_C( 939.48),
+        SIMDE_FLOAT64_C( 178.71), SIMDE_FLOAT64_C( 945.26), SIMDE_FLOAT64_C( 300.22), SIMDE_FLOAT64_C( 608.89) },
+      { SIMDE_FLOAT64_C(   1.588477), SIMDE_FLOAT64_C(   1.255371), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  112),
+      { SIMDE_FLOAT64_C( 936.60), SIMDE_FLOAT64_C(-609.01), SIMDE_FLOAT64_C(-622.79), SIMDE_FLOAT64_C( 325.82),
+        SIMDE_FLOAT64_C( 654.78), SIMDE_FLOAT64_C(-837.51), SIMDE_FLOAT64_C( 257.79), SIMDE_FLOAT64_C( 562.78) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.639434), SIMDE_FLOAT64_C(   0.817881), SIMDE_FLOAT64_C(   1.006992), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  249),
+      { SIMDE_FLOAT64_C(-362.87), SIMDE_FLOAT64_C(  71.74), SIMDE_FLOAT64_C( 856.04), SIMDE_FLOAT64_C( 359.24),
+        SIMDE_FLOAT64_C( 193.23), SIMDE_FLOAT64_C(-927.67), SIMDE_FLOAT64_C(-347.33), SIMDE_FLOAT64_C(-585.24) },
+      { SIMDE_FLOAT64_C(  -0.708730), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.701641),
+        SIMDE_FLOAT64_C(   0.754805), SIMDE_FLOAT64_C(  -0.905928), SIMDE_FLOAT64_C(  -0.678379), SIMDE_FLOAT64_C(  -0.571523) } },
+    { UINT8_C(   29),
+      { SIMDE_FLOAT64_C( 577.18), SIMDE_FLOAT64_C( 961.36), SIMDE_FLOAT64_C( 101.91), SIMDE_FLOAT64_C( 352.79),
+        SIMDE_FLOAT64_C( 834.00), SIMDE_FLOAT64_C( 458.44), SIMDE_FLOAT64_C( 156.98), SIMDE_FLOAT64_C( 167.61) },
+      { SIMDE_FLOAT64_C(   1.127305), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.796172), SIMDE_FLOAT64_C(   1.378086),
+        SIMDE_FLOAT64_C(   0.814453), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } }
+  };
+
+  simde__m512d a, r;
+
+  a = simde_mm512_loadu_pd(test_vec[0].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[0].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[0].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[1].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[1].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[1].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[2].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[2].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[2].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[3].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[3].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[3].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[4].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[4].k, a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[4].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[5].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[5].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[5].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[6].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[6].k, a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_src);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[6].r), 4);
+
+  a = simde_mm512_loadu_pd(test_vec[7].a);
+  r = simde_mm512_maskz_getmant_pd(test_vec[7].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+  simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[7].r), 4);
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getmant_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
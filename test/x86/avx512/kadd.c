@@ -0,0 +1,177 @@
+#define SIMDE_TEST_X86_AVX512_INSN kadd
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kadd.h>
+
+static int
+test_simde_kadd_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(255),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT8_C( 23),
+      UINT8_C(111),
+      UINT8_C(134) },
+    { UINT8_C(200),
+      UINT8_C( 92),
+      UINT8_C( 36) },
+    { UINT8_C(226),
+      UINT8_C( 78),
+      UINT8_C( 48) },
+    { UINT8_C(159),
+      UINT8_C( 11),
+      UINT8_C(170) },
+    { UINT8_C(140),
+      UINT8_C(199),
+      UINT8_C( 83) },
+    { UINT8_C(148),
+      UINT8_C(207),
+      UINT8_C( 99) },
+    { UINT8_C(100),
+      UINT8_C(240),
+      UINT8_C( 84) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kadd_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kadd_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(65535),
+      UINT16_C(    1),
+      UINT16_C(    0) },
+    { UINT16_C(39871),
+      UINT16_C(58311),
+      UINT16_C(32646) },
+    { UINT16_C(58097),
+      UINT16_C(37304),
+      UINT16_C(29865) },
+    { UINT16_C(43972),
+      UINT16_C(64024),
+      UINT16_C(42460) },
+    { UINT16_C(34414),
+      UINT16_C(31670),
+      UINT16_C(  548) },
+    { UINT16_C(49931),
+      UINT16_C(35437),
+      UINT16_C(19832) },
+    { UINT16_C( 5399),
+      UINT16_C(55233),
+      UINT16_C(60632) },
+    { UINT16_C(16981),
+      UINT16_C(37219),
+      UINT16_C(54200) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kadd_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kadd_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(4294967295),
+      UINT32_C(         1),
+      UINT32_C(         0) },
+    { UINT32_C(1969087257),
+      UINT32_C(1047913323),
+      UINT32_C(3017000580) },
+    { UINT32_C( 531619664),
+      UINT32_C(1624324939),
+      UINT32_C(2155944603) },
+    { UINT32_C( 557369276),
+      UINT32_C(3075859658),
+      UINT32_C(3633228934) },
+    { UINT32_C( 827003299),
+      UINT32_C( 851798095),
+      UINT32_C(1678801394) },
+    { UINT32_C(3674045989),
+      UINT32_C(3621746550),
+      UINT32_C(3000825243) },
+    { UINT32_C(2212274436),
+      UINT32_C( 725756489),
+      UINT32_C(2938030925) },
+    { UINT32_C( 784830045),
+      UINT32_C(4078162544),
+      UINT32_C( 568025293) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kadd_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kadd_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(18446744073709551615),
+      UINT64_C(                   1),
+      UINT64_C(                   0) },
+    { UINT64_C( 4845946518536131479),
+      UINT64_C(12811559370594985863),
+      UINT64_C(17657505889131117342) },
+    { UINT64_C(14970425951934236430),
+      UINT64_C( 8145419617890220222),
+      UINT64_C( 4669101496114905036) },
+    { UINT64_C(  312706652415286610),
+      UINT64_C(16600513475299624189),
+      UINT64_C(16913220127714910799) },
+    { UINT64_C( 4595780412493903306),
+      UINT64_C(16137781904022525660),
+      UINT64_C( 2286818242806877350) },
+    { UINT64_C(14626112594247923176),
+      UINT64_C(17572070662445249838),
+      UINT64_C(13751439182983621398) },
+    { UINT64_C( 1662991407368304063),
+      UINT64_C(14309853185689804067),
+      UINT64_C(15972844593058108130) },
+    { UINT64_C(16050073994309000167),
+      UINT64_C(11380681423256321982),
+      UINT64_C( 8984011343855770533) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kadd_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
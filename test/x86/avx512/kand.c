@@ -0,0 +1,177 @@
+#define SIMDE_TEST_X86_AVX512_INSN kand
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kand.h>
+
+static int
+test_simde_kand_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C( 16),
+      UINT8_C( 85),
+      UINT8_C( 16) },
+    { UINT8_C(161),
+      UINT8_C(187),
+      UINT8_C(161) },
+    { UINT8_C(219),
+      UINT8_C(136),
+      UINT8_C(136) },
+    { UINT8_C(138),
+      UINT8_C(162),
+      UINT8_C(130) },
+    { UINT8_C(198),
+      UINT8_C(158),
+      UINT8_C(134) },
+    { UINT8_C(158),
+      UINT8_C( 89),
+      UINT8_C( 24) },
+    { UINT8_C(212),
+      UINT8_C(111),
+      UINT8_C( 68) },
+    { UINT8_C(219),
+      UINT8_C(100),
+      UINT8_C( 64) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kand_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kand_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(  727),
+      UINT16_C( 3786),
+      UINT16_C(  706) },
+    { UINT16_C(24164),
+      UINT16_C( 9834),
+      UINT16_C( 1632) },
+    { UINT16_C(42300),
+      UINT16_C( 8494),
+      UINT16_C( 8492) },
+    { UINT16_C(22550),
+      UINT16_C(52901),
+      UINT16_C(18436) },
+    { UINT16_C(33036),
+      UINT16_C(47972),
+      UINT16_C(33028) },
+    { UINT16_C(43084),
+      UINT16_C( 7914),
+      UINT16_C( 2120) },
+    { UINT16_C(52317),
+      UINT16_C(23745),
+      UINT16_C(19521) },
+    { UINT16_C(16012),
+      UINT16_C( 3338),
+      UINT16_C( 3080) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kand_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kand_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(1917832920),
+      UINT32_C(3637532096),
+      UINT32_C(1346389184) },
+    { UINT32_C(1216750177),
+      UINT32_C( 683152870),
+      UINT32_C( 142606432) },
+    { UINT32_C(2708957247),
+      UINT32_C(2654899304),
+      UINT32_C(2151024680) },
+    { UINT32_C( 181541778),
+      UINT32_C(2235440273),
+      UINT32_C(   1185936) },
+    { UINT32_C(1434453924),
+      UINT32_C(2580101260),
+      UINT32_C( 293601412) },
+    { UINT32_C( 263323507),
+      UINT32_C(3108160204),
+      UINT32_C( 151044672) },
+    { UINT32_C(3529379665),
+      UINT32_C(2229869312),
+      UINT32_C(2152205056) },
+    { UINT32_C(2854758471),
+      UINT32_C(1934247391),
+      UINT32_C( 570949703) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kand_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kand_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(14519274437551976714),
+      UINT64_C( 9289534242945391297),
+      UINT64_C( 9253210772498042880) },
+    { UINT64_C(14786238567681695511),
+      UINT64_C(17562369845867929953),
+      UINT64_C(13921189408034849025) },
+    { UINT64_C(14094338983531416911),
+      UINT64_C(14650941487980663374),
+      UINT64_C(14055735125427388494) },
+    { UINT64_C( 2341551183623288395),
+      UINT64_C( 8066367509925965608),
+      UINT64_C( 2337469366108595720) },
+    { UINT64_C( 3017802401579222806),
+      UINT64_C( 5939079901094882328),
+      UINT64_C(   27374541338575888) },
+    { UINT64_C( 4951203179267283070),
+      UINT64_C( 7823044779268892550),
+      UINT64_C( 4940449920835567622) },
+    { UINT64_C(10707168961176187467),
+      UINT64_C(16548813322324449606),
+      UINT64_C( 9547912687156367426) },
+    { UINT64_C( 4176058606572694013),
+      UINT64_C(18018615056032835968),
+      UINT64_C( 4036441519481301376) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kand_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,177 @@
+#define SIMDE_TEST_X86_AVX512_INSN kandn
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kandn.h>
+
+static int
+test_simde_kandn_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(149),
+      UINT8_C( 37),
+      UINT8_C( 32) },
+    { UINT8_C( 42),
+      UINT8_C(156),
+      UINT8_C(148) },
+    { UINT8_C(175),
+      UINT8_C(195),
+      UINT8_C( 64) },
+    { UINT8_C( 88),
+      UINT8_C(174),
+      UINT8_C(166) },
+    { UINT8_C(157),
+      UINT8_C( 49),
+      UINT8_C( 32) },
+    { UINT8_C( 42),
+      UINT8_C( 40),
+      UINT8_C(  0) },
+    { UINT8_C(155),
+      UINT8_C( 29),
+      UINT8_C(  4) },
+    { UINT8_C(141),
+      UINT8_C(184),
+      UINT8_C( 48) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kandn_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kandn_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(32263),
+      UINT16_C(53718),
+      UINT16_C(33232) },
+    { UINT16_C(60971),
+      UINT16_C(34189),
+      UINT16_C(  388) },
+    { UINT16_C( 6226),
+      UINT16_C(52754),
+      UINT16_C(50688) },
+    { UINT16_C(25241),
+      UINT16_C(44433),
+      UINT16_C(36096) },
+    { UINT16_C(17642),
+      UINT16_C(63857),
+      UINT16_C(47377) },
+    { UINT16_C(22537),
+      UINT16_C(60952),
+      UINT16_C(42512) },
+    { UINT16_C(17390),
+      UINT16_C(44230),
+      UINT16_C(44032) },
+    { UINT16_C(60086),
+      UINT16_C(20995),
+      UINT16_C( 4097) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kandn_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kandn_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(3131489592),
+      UINT32_C(2307602578),
+      UINT32_C(  17367170) },
+    { UINT32_C( 757350240),
+      UINT32_C(3167049315),
+      UINT32_C(2428583939) },
+    { UINT32_C( 204289767),
+      UINT32_C(2382808149),
+      UINT32_C(2181218320) },
+    { UINT32_C( 997008069),
+      UINT32_C(2693598726),
+      UINT32_C(2155875330) },
+    { UINT32_C( 970715341),
+      UINT32_C(2334690544),
+      UINT32_C(2183138352) },
+    { UINT32_C(1835472313),
+      UINT32_C(2671850773),
+      UINT32_C(2449481732) },
+    { UINT32_C(3941022658),
+      UINT32_C(3997992239),
+      UINT32_C(  67666989) },
+    { UINT32_C(4112382649),
+      UINT32_C(4054885256),
+      UINT32_C(  10486016) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kandn_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kandn_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C( 6535821669898314368),
+      UINT64_C(15311417622520806941),
+      UINT64_C( 9533012173383539741) },
+    { UINT64_C(14329636932298748173),
+      UINT64_C( 3212351227900132850),
+      UINT64_C( 2882444636578827506) },
+    { UINT64_C( 5404576483401892405),
+      UINT64_C( 7171169604134065809),
+      UINT64_C( 2343301457507538048) },
+    { UINT64_C(14531721682474614840),
+      UINT64_C( 7117154737145103142),
+      UINT64_C( 2469155697237951238) },
+    { UINT64_C( 8505782596952509415),
+      UINT64_C( 1238230683241263056),
+      UINT64_C(   82472211806430224) },
+    { UINT64_C(13277454260736662517),
+      UINT64_C(    2638045600619144),
+      UINT64_C(    2534375414104072) },
+    { UINT64_C( 4571916975635234591),
+      UINT64_C(13998032049745388279),
+      UINT64_C(13835139109981192416) },
+    { UINT64_C(10154576050951226196),
+      UINT64_C( 8742743304352684181),
+      UINT64_C( 8147067397318957185) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kandn_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,177 @@
+#define SIMDE_TEST_X86_AVX512_INSN kor
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kor.h>
+
+static int
+test_simde_kor_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C( 45),
+      UINT8_C(154),
+      UINT8_C(191) },
+    { UINT8_C( 37),
+      UINT8_C(174),
+      UINT8_C(175) },
+    { UINT8_C(  1),
+      UINT8_C( 16),
+      UINT8_C( 17) },
+    { UINT8_C(212),
+      UINT8_C( 88),
+      UINT8_C(220) },
+    { UINT8_C(177),
+      UINT8_C(100),
+      UINT8_C(245) },
+    { UINT8_C(122),
+      UINT8_C(238),
+      UINT8_C(254) },
+    { UINT8_C( 31),
+      UINT8_C(103),
+      UINT8_C(127) },
+    { UINT8_C( 26),
+      UINT8_C(219),
+      UINT8_C(219) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kor_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(51251),
+      UINT16_C(25449),
+      UINT16_C(60283) },
+    { UINT16_C(52665),
+      UINT16_C(53977),
+      UINT16_C(57337) },
+    { UINT16_C(16595),
+      UINT16_C(19701),
+      UINT16_C(19703) },
+    { UINT16_C(50844),
+      UINT16_C( 1578),
+      UINT16_C(50878) },
+    { UINT16_C(65363),
+      UINT16_C(22945),
+      UINT16_C(65523) },
+    { UINT16_C(21728),
+      UINT16_C(41573),
+      UINT16_C(63205) },
+    { UINT16_C(32149),
+      UINT16_C( 6910),
+      UINT16_C(32767) },
+    { UINT16_C(28211),
+      UINT16_C( 5694),
+      UINT16_C(32319) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kor_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kor_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(2896391823),
+      UINT32_C(1227124519),
+      UINT32_C(3987173295) },
+    { UINT32_C(4218040517),
+      UINT32_C(2829511836),
+      UINT32_C(4226743517) },
+    { UINT32_C(3573189317),
+      UINT32_C(1382781618),
+      UINT32_C(3606813431) },
+    { UINT32_C( 708366739),
+      UINT32_C(1905666116),
+      UINT32_C(2076113367) },
+    { UINT32_C(1634310098),
+      UINT32_C(3440706051),
+      UINT32_C(3984431059) },
+    { UINT32_C(1157625907),
+      UINT32_C( 686689070),
+      UINT32_C(1828715327) },
+    { UINT32_C(2335999615),
+      UINT32_C(3925922363),
+      UINT32_C(3946632831) },
+    { UINT32_C(1920048488),
+      UINT32_C(1720812795),
+      UINT32_C(1995546107) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kor_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kor_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(14498766341702667499),
+      UINT64_C(16727360810048496013),
+      UINT64_C(16805172301006630383) },
+    { UINT64_C(11312156481556104590),
+      UINT64_C( 1258495322716954292),
+      UINT64_C(11385059136179331006) },
+    { UINT64_C( 2564214517675714282),
+      UINT64_C( 4455640870834146126),
+      UINT64_C( 4599863828316811246) },
+    { UINT64_C( 9886535694960602389),
+      UINT64_C(  367627966772029107),
+      UINT64_C(10177598551051906999) },
+    { UINT64_C( 7089631329511623700),
+      UINT64_C(12357690975643723422),
+      UINT64_C(16969420974804922014) },
+    { UINT64_C(13343361864447471843),
+      UINT64_C( 4037083648901609100),
+      UINT64_C(13344094208180614895) },
+    { UINT64_C(10764677068546148086),
+      UINT64_C(17862401744228941002),
+      UINT64_C(17862402021395398398) },
+    { UINT64_C(11020468797326859218),
+      UINT64_C(18090025831686909692),
+      UINT64_C(18157598901668397054) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kor_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,160 @@
+#define SIMDE_TEST_X86_AVX512_INSN kortest
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kortest.h>
+
+static int
+test_simde_kortest_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT8_C(  0), UINT8_C(  0), 1, 0 },
+    { UINT8_C( 62), UINT8_C(193), 0, 1 },
+    { UINT8_C(255), UINT8_C(  0), 0, 1 },
+    { UINT8_C(  2), UINT8_C(  0), 0, 0 },
+    { UINT8_C(238), UINT8_C(122), 0, 0 },
+    { UINT8_C(166), UINT8_C(243), 0, 0 },
+    { UINT8_C(120), UINT8_C(204), 0, 0 },
+    { UINT8_C(  3), UINT8_C( 68), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones = 0;
+    unsigned char z = simde_kortest_mask8_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(all_ones, test_vec[i].c);
+    simde_assert_equal_u8(simde_kortestz_mask8_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_kortestc_mask8_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortest_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT16_C(    0), UINT16_C(    0), 1, 0 },
+    { UINT16_C(52096), UINT16_C(13439), 0, 1 },
+    { UINT16_C(65535), UINT16_C(    0), 0, 1 },
+    { UINT16_C(33032), UINT16_C(    0), 0, 0 },
+    { UINT16_C(32647), UINT16_C(48322), 0, 0 },
+    { UINT16_C(63535), UINT16_C(19127), 0, 0 },
+    { UINT16_C(64829), UINT16_C(44685), 0, 0 },
+    { UINT16_C(13649), UINT16_C(15355), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones = 0;
+    unsigned char z = simde_kortest_mask16_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(all_ones, test_vec[i].c);
+    simde_assert_equal_u8(simde_kortestz_mask16_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_kortestc_mask16_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortest_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT32_C(         0), UINT32_C(         0), 1, 0 },
+    { UINT32_C( 286224007), UINT32_C(4008743288), 0, 1 },
+    { UINT32_C(4294967295), UINT32_C(         0), 0, 1 },
+    { UINT32_C(2181073992), UINT32_C(         0), 0, 0 },
+    { UINT32_C(2551793726), UINT32_C(3772347834), 0, 0 },
+    { UINT32_C(3055911713), UINT32_C( 960088996), 0, 0 },
+    { UINT32_C(1883310532), UINT32_C( 568935770), 0, 0 },
+    { UINT32_C(1771838338), UINT32_C(1465490986), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones = 0;
+    unsigned char z = simde_kortest_mask32_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(all_ones, test_vec[i].c);
+    simde_assert_equal_u8(simde_kortestz_mask32_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_kortestc_mask32_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortest_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT64_C(                   0), UINT64_C(                   0), 1, 0 },
+    { UINT64_C( 3162437824002153957), UINT64_C(15284306249707397658), 0, 1 },
+    { UINT64_C(18446744073709551615), UINT64_C(                   0), 0, 1 },
+    { UINT64_C(10736592592717499461), UINT64_C(                   0), 0, 0 },
+    { UINT64_C(  520846288139157255), UINT64_C(  504072992282407772), 0, 0 },
+    { UINT64_C(17914774261950057123), UINT64_C( 5169300284059116491), 0, 0 },
+    { UINT64_C(10931828663601574239), UINT64_C( 9621433767079279479), 0, 0 },
+    { UINT64_C( 2687501053348702472), UINT64_C(10632335552751728345), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones = 0;
+    unsigned char z = simde_kortest_mask64_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(all_ones, test_vec[i].c);
+    simde_assert_equal_u8(simde_kortestz_mask64_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_kortestc_mask64_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kortest (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const int z;
+    const int c;
+  } test_vec[] = {
+    { UINT16_C(    0), UINT16_C(    0), 1, 0 },
+    { UINT16_C(28281), UINT16_C(37254), 0, 1 },
+    { UINT16_C(65535), UINT16_C(    0), 0, 1 },
+    { UINT16_C(38056), UINT16_C(    0), 0, 0 },
+    { UINT16_C(47852), UINT16_C( 3306), 0, 0 },
+    { UINT16_C(42405), UINT16_C(20575), 0, 0 },
+    { UINT16_C(46346), UINT16_C(46514), 0, 0 },
+    { UINT16_C(13070), UINT16_C(60530), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_i(simde_mm512_kortestz(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_i(simde_mm512_kortestc(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask64_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kortest)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,133 @@
+#define SIMDE_TEST_X86_AVX512_INSN ktest
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/ktest.h>
+
+static int
+test_simde_ktest_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT8_C(247), UINT8_C(  8), 1, 0 },
+    { UINT8_C(255), UINT8_C(128), 0, 1 },
+    { UINT8_C(  0), UINT8_C(  0), 1, 1 },
+    { UINT8_C(128), UINT8_C(128), 0, 1 },
+    { UINT8_C(152), UINT8_C(127), 0, 0 },
+    { UINT8_C(190), UINT8_C(202), 0, 0 },
+    { UINT8_C(121), UINT8_C(128), 1, 0 },
+    { UINT8_C(188), UINT8_C( 59), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not = 0;
+    unsigned char z = simde_ktest_mask8_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(and_not, test_vec[i].c);
+    simde_assert_equal_u8(simde_ktestz_mask8_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_ktestc_mask8_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktest_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT16_C(  259), UINT16_C(65276), 1, 0 },
+    { UINT16_C(65535), UINT16_C(35880), 0, 1 },
+    { UINT16_C(    0), UINT16_C(    0), 1, 1 },
+    { UINT16_C( 8273), UINT16_C( 8256), 0, 1 },
+    { UINT16_C(34774), UINT16_C(49633), 0, 0 },
+    { UINT16_C(62077), UINT16_C(10991), 0, 0 },
+    { UINT16_C(59842), UINT16_C(58388), 0, 0 },
+    { UINT16_C(25331), UINT16_C(16262), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not = 0;
+    unsigned char z = simde_ktest_mask16_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(and_not, test_vec[i].c);
+    simde_assert_equal_u8(simde_ktestz_mask16_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_ktestc_mask16_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktest_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT32_C(4152614499), UINT32_C( 142352796), 1, 0 },
+    { UINT32_C(4294967295), UINT32_C(4082896222), 0, 1 },
+    { UINT32_C(         0), UINT32_C(         0), 1, 1 },
+    { UINT32_C(3031771528), UINT32_C( 278137224), 0, 1 },
+    { UINT32_C(2006901120), UINT32_C( 490368794), 0, 0 },
+    { UINT32_C(1187120682), UINT32_C(3738682774), 0, 0 },
+    { UINT32_C(1415586517), UINT32_C(2097840748), 0, 0 },
+    { UINT32_C(1214430095), UINT32_C(1931634334), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not = 0;
+    unsigned char z = simde_ktest_mask32_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(and_not, test_vec[i].c);
+    simde_assert_equal_u8(simde_ktestz_mask32_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_ktestc_mask32_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktest_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char z;
+    const unsigned char c;
+  } test_vec[] = {
+    { UINT64_C( 8949398535003903750), UINT64_C( 9497345538705647865), 1, 0 },
+    { UINT64_C(18446744073709551615), UINT64_C( 8856884316937004580), 0, 1 },
+    { UINT64_C(                   0), UINT64_C(                   0), 1, 1 },
+    { UINT64_C( 2791856790014788306), UINT64_C( 2786040282092667602), 0, 1 },
+    { UINT64_C(16696242036206055881), UINT64_C(17593929546606202337), 0, 0 },
+    { UINT64_C(14227494027652342915), UINT64_C(11394796368349785829), 0, 0 },
+    { UINT64_C(14535741798045961579), UINT64_C(10636481458681115832), 0, 0 },
+    { UINT64_C(10368639706340690716), UINT64_C( 4458095920593830331), 0, 0 }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not = 0;
+    unsigned char z = simde_ktest_mask64_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(z, test_vec[i].z);
+    simde_assert_equal_u8(and_not, test_vec[i].c);
+    simde_assert_equal_u8(simde_ktestz_mask64_u8(test_vec[i].a, test_vec[i].b), test_vec[i].z);
+    simde_assert_equal_u8(simde_ktestc_mask64_u8(test_vec[i].a, test_vec[i].b), test_vec[i].c);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask64_u8)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,135 @@
+#define SIMDE_TEST_X86_AVX512_INSN kunpack
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kunpack.h>
+
+static int
+test_simde_mm512_kunpackb (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(46095),
+      UINT16_C(38351),
+      UINT16_C( 4047) },
+    { UINT16_C(16168),
+      UINT16_C(60347),
+      UINT16_C(10427) },
+    { UINT16_C(58714),
+      UINT16_C(20277),
+      UINT16_C(23093) },
+    { UINT16_C( 5498),
+      UINT16_C(64778),
+      UINT16_C(31242) },
+    { UINT16_C(38018),
+      UINT16_C(63948),
+      UINT16_C(33484) },
+    { UINT16_C(41895),
+      UINT16_C( 8131),
+      UINT16_C(42947) },
+    { UINT16_C(29931),
+      UINT16_C(40716),
+      UINT16_C(60172) },
+    { UINT16_C(48222),
+      UINT16_C( 1667),
+      UINT16_C(24195) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kunpackb(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kunpackw (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(1937203181),
+      UINT32_C(1914506181),
+      UINT32_C(1609370565) },
+    { UINT32_C(3781357020),
+      UINT32_C( 550849698),
+      UINT32_C(3990637730) },
+    { UINT32_C(1114678024),
+      UINT32_C(2212804126),
+      UINT32_C(2735257118) },
+    { UINT32_C(2298699533),
+      UINT32_C(1157935422),
+      UINT32_C(1594732862) },
+    { UINT32_C( 699378284),
+      UINT32_C(3281107675),
+      UINT32_C(2859252443) },
+    { UINT32_C(3164941212),
+      UINT32_C(  77391283),
+      UINT32_C( 731702707) },
+    { UINT32_C( 138517136),
+      UINT32_C(  74899029),
+      UINT32_C(2593185365) },
+    { UINT32_C(3151367118),
+      UINT32_C(  97763502),
+      UINT32_C( 198099118) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_mm512_kunpackw(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kunpackd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(16581034738943069381),
+      UINT64_C( 1989113060983894241),
+      UINT64_C(13194716524755611873) },
+    { UINT64_C(15816152409948314467),
+      UINT64_C(12605988586360539588),
+      UINT64_C(13576201559425288644) },
+    { UINT64_C(  590194222759094764),
+      UINT64_C( 5385819605340252873),
+      UINT64_C(14126430751119633097) },
+    { UINT64_C(12952004201589015981),
+      UINT64_C( 5600932823087268104),
+      UINT64_C(15930504761115230472) },
+    { UINT64_C( 5334393857102950795),
+      UINT64_C(10932424348166025813),
+      UINT64_C( 4658324603066937941) },
+    { UINT64_C(10213481597528504871),
+      UINT64_C(16274033980364457638),
+      UINT64_C( 5525065890405713574) },
+    { UINT64_C(11721754264027568359),
+      UINT64_C( 3063162751312860218),
+      UINT64_C(  849096647684527162) },
+    { UINT64_C( 8576393828720839022),
+      UINT64_C(12871742039131820938),
+      UINT64_C( 6828030357039354762) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_mm512_kunpackd(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kunpackb)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kunpackw)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kunpackd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,177 @@
+#define SIMDE_TEST_X86_AVX512_INSN kxnor
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kxnor.h>
+
+static int
+test_simde_kxnor_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C( 21),
+      UINT8_C( 62),
+      UINT8_C(212) },
+    { UINT8_C( 39),
+      UINT8_C(158),
+      UINT8_C( 70) },
+    { UINT8_C(183),
+      UINT8_C( 56),
+      UINT8_C(112) },
+    { UINT8_C(101),
+      UINT8_C(  5),
+      UINT8_C(159) },
+    { UINT8_C(229),
+      UINT8_C( 54),
+      UINT8_C( 44) },
+    { UINT8_C(250),
+      UINT8_C(135),
+      UINT8_C(130) },
+    { UINT8_C(224),
+      UINT8_C(123),
+      UINT8_C(100) },
+    { UINT8_C(105),
+      UINT8_C(208),
+      UINT8_C( 70) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kxnor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxnor_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C( 5634),
+      UINT16_C(31425),
+      UINT16_C(37692) },
+    { UINT16_C(20373),
+      UINT16_C( 9213),
+      UINT16_C(37783) },
+    { UINT16_C(22509),
+      UINT16_C(25453),
+      UINT16_C(52095) },
+    { UINT16_C(33452),
+      UINT16_C( 1197),
+      UINT16_C(31230) },
+    { UINT16_C(23737),
+      UINT16_C(26261),
+      UINT16_C(50643) },
+    { UINT16_C(22011),
+      UINT16_C(37025),
+      UINT16_C(15013) },
+    { UINT16_C(57613),
+      UINT16_C(49261),
+      UINT16_C(56991) },
+    { UINT16_C(61412),
+      UINT16_C(12459),
+      UINT16_C( 8368) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kxnor_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxnor_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(2394129274),
+      UINT32_C(2305207392),
+      UINT32_C(4163555557) },
+    { UINT32_C(3083708124),
+      UINT32_C(1359224098),
+      UINT32_C( 422986753) },
+    { UINT32_C( 932016725),
+      UINT32_C(3798724098),
+      UINT32_C( 706306984) },
+    { UINT32_C(1116546844),
+      UINT32_C( 991112113),
+      UINT32_C(2254566226) },
+    { UINT32_C(1319037785),
+      UINT32_C(1781443680),
+      UINT32_C(3679434950) },
+    { UINT32_C(2010851409),
+      UINT32_C(1664453532),
+      UINT32_C(3943783474) },
+    { UINT32_C( 211174883),
+      UINT32_C(2431545623),
+      UINT32_C(1669843723) },
+    { UINT32_C(2777275102),
+      UINT32_C(2409401730),
+      UINT32_C(3588925603) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kxnor_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxnor_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(12285898290567161602),
+      UINT64_C( 3984853712067501323),
+      UINT64_C( 7075915668365002230) },
+    { UINT64_C( 7859210287984570810),
+      UINT64_C(11818470166083262730),
+      UINT64_C( 3958059469046568783) },
+    { UINT64_C(12502426726329078224),
+      UINT64_C( 6283421070804084702),
+      UINT64_C(  382039670222309873) },
+    { UINT64_C(11743566863343216388),
+      UINT64_C(10126273135528071629),
+      UINT64_C(15096567240735738166) },
+    { UINT64_C( 6945883835170589755),
+      UINT64_C( 1591086845860730462),
+      UINT64_C( 9912403527782901146) },
+    { UINT64_C(15304768412562508760),
+      UINT64_C( 2929873367356917835),
+      UINT64_C(  230680264491695212) },
+    { UINT64_C(  700110145717971448),
+      UINT64_C(  777684021443211032),
+      UINT64_C(18195201065019504927) },
+    { UINT64_C( 7170724225217319407),
+      UINT64_C(  457061011327565150),
+      UINT64_C(11109173971939889998) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kxnor_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
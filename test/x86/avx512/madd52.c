@@ -0,0 +1,1281 @@
+#define SIMDE_TEST_X86_AVX512_INSN madd52
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/madd52.h>
+
+static int
+test_simde_mm_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 6186480855544184806), UINT64_C(18446744006850912283) },
+      { UINT64_C(            43815223), UINT64_C(13232670495837486796) },
+      { UINT64_C( 6723874243664150527), UINT64_C(    4503599627370495) },
+      { UINT64_C( 6190984455127740079), UINT64_C(    3408742145761615) } },
+    { { UINT64_C(18446743663560458701), UINT64_C( 6289040531975882538) },
+      { UINT64_C( 2896948466462960238), UINT64_C(10425364780473991206) },
+      { UINT64_C( 8827055269646172159), UINT64_C( 5422611213324606989) },
+      { UINT64_C(    3369283414546271), UINT64_C( 6292974434118073624) } },
+    { { UINT64_C(18446743476150721090), UINT64_C(15037848648382893792) },
+      { UINT64_C( 4881834810049271739), UINT64_C(10233791124357406343) },
+      { UINT64_C(    4503599627370495), UINT64_C(12375891776014123007) },
+      { UINT64_C(      66588461515399), UINT64_C(15040739477038624857) } },
+    { { UINT64_C( 8748861106000184017), UINT64_C(18446743071866605552) },
+      { UINT64_C(10691063367702843319), UINT64_C(    4317146584575965) },
+      { UINT64_C( 1747396655419752447), UINT64_C(17509995351216488447) },
+      { UINT64_C( 8749343253674898202), UINT64_C(     185451199848467) } },
+    { { UINT64_C(18446743537299972170), UINT64_C(  200047497553973366) },
+      { UINT64_C(            36654404), UINT64_C( 7298927796059854219) },
+      { UINT64_C(    4503599627370495), UINT64_C( 9634108262658334842) },
+      { UINT64_C(    4503063181136646), UINT64_C(  201944239504782516) } },
+    { { UINT64_C(18446743699318468466), UINT64_C(16603263921063384130) },
+      { UINT64_C(11060840684821938175), UINT64_C( 8479782603988331527) },
+      { UINT64_C( 8330381197103318756), UINT64_C( 4317610394092238564) },
+      { UINT64_C(    1277739141015694), UINT64_C(16603366110535730302) } },
+    { { UINT64_C(18446743108747872142), UINT64_C(18446743076232736295) },
+      { UINT64_C(             8069374), UINT64_C( 1107883044842470573) },
+      { UINT64_C( 8562314560769715171), UINT64_C(    4503599627370495) },
+      { UINT64_C(    3737007978951368), UINT64_C(       1466013856122) } },
+    { { UINT64_C(12723065969410377428), UINT64_C(18446743059675435922) },
+      { UINT64_C(12478868619634952275), UINT64_C(15564975013136098565) },
+      { UINT64_C( 3857659485207271728), UINT64_C( 4761132361323388440) },
+      { UINT64_C(12724960531973452132), UINT64_C(    3311207311434250) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_madd52lo_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[2];
+    const simde__mmask8 k;
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C(14298367647400131654), UINT64_C(14004109473236641479) },
+      UINT8_C(  2),
+      { UINT64_C(11266291635102167581), UINT64_C(   26343072776031803) },
+      { UINT64_C( 7744201701459858682), UINT64_C(            14809368) },
+      { UINT64_C(14298367647400131654), UINT64_C(14008429935354158927) } },
+    { { UINT64_C(18446744024894942563), UINT64_C( 5967005316199685469) },
+      UINT8_C(  3),
+      { UINT64_C( 1508705875169116159), UINT64_C(14197670786312705440) },
+      { UINT64_C(11397657285586458267), UINT64_C(    4503599627370495) },
+      { UINT64_C(     953322473658056), UINT64_C( 5969184154986153917) } },
+    { { UINT64_C( 7890669958842037002), UINT64_C(15873825518593530709) },
+      UINT8_C(  1),
+      { UINT64_C( 5657890277885011231), UINT64_C( 7351575838975146728) },
+      { UINT64_C(  535928355657089023), UINT64_C( 2792231768969707519) },
+      { UINT64_C( 7893804412561739243), UINT64_C(15873825518593530709) } },
+    { { UINT64_C( 5298236018913317619), UINT64_C(18446743294394114761) },
+      UINT8_C(  2),
+      { UINT64_C(13916182713494233653), UINT64_C( 1128050710807514511) },
+      { UINT64_C( 9606178005181267967), UINT64_C(  832482198325619302) },
+      { UINT64_C( 5298236018913317619), UINT64_C(    4411674552057795) } },
+    { { UINT64_C( 4264293294225162134), UINT64_C(18446743683931767992) },
+      UINT8_C(  0),
+      { UINT64_C( 2806151228547661281), UINT64_C(            63531224) },
+      { UINT64_C( 3005814253200574935), UINT64_C( 6844212035143025946) },
+      { UINT64_C( 4264293294225162134), UINT64_C(18446743683931767992) } },
+    { { UINT64_C( 8721233042341954770), UINT64_C( 9294537533625688034) },
+      UINT8_C(  3),
+      { UINT64_C( 3861934003334551399), UINT64_C( 4281803359825545075) },
+      { UINT64_C(    4503599627370495), UINT64_C(    4181279689519594) },
+      { UINT64_C( 8723387519291288939), UINT64_C( 9296960614519616000) } },
+    { { UINT64_C(12833310836123859834), UINT64_C(10228223658238387023) },
+      UINT8_C(  2),
+      { UINT64_C( 5761798862178276468), UINT64_C(15836309398072174728) },
+      { UINT64_C(10979628715754126647), UINT64_C(15840168718295010082) },
+      { UINT64_C(12833310836123859834), UINT64_C(10230446809757375839) } },
+    { { UINT64_C(18092310672981735988), UINT64_C(16528314398295922350) },
+      UINT8_C(  1),
+      { UINT64_C( 6638305850744111103), UINT64_C( 2610219937719400176) },
+      { UINT64_C(            33097625), UINT64_C( 2540636943520707845) },
+      { UINT64_C(18096814272576008859), UINT64_C(16528314398295922350) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_mask_madd52lo_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { UINT64_C(  212059294300871166), UINT64_C( 5428392508197174534) },
+      { UINT64_C( 2480013976467361637), UINT64_C(11909584598551552003) },
+      { UINT64_C(16772724247132238864), UINT64_C(    4503599627370495) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  3),
+      { UINT64_C(14193498052380793903), UINT64_C(10407065233906475644) },
+      { UINT64_C(17167721779536330751), UINT64_C(     634484786886452) },
+      { UINT64_C( 5707246854885504354), UINT64_C(    4503599627370495) },
+      { UINT64_C(14196815525001078477), UINT64_C(10410934348746959688) } },
+    { UINT8_C(  2),
+      { UINT64_C( 1376650281814863020), UINT64_C( 4659446408489557253) },
+      { UINT64_C(    4503599627370495), UINT64_C( 4716181329184073309) },
+      { UINT64_C(     249183832648466), UINT64_C(17801674533095837003) },
+      { UINT64_C(                   0), UINT64_C( 4659645764846637892) } },
+    { UINT8_C(  2),
+      { UINT64_C( 6071529903517816635), UINT64_C(18446743620639856902) },
+      { UINT64_C(            17226617), UINT64_C(10297106333949832042) },
+      { UINT64_C( 4061034412182811468), UINT64_C(            23209489) },
+      { UINT64_C(                   0), UINT64_C(    3755439167289104) } },
+    { UINT8_C(  0),
+      { UINT64_C( 9792526056740835709), UINT64_C(18446743012032180880) },
+      { UINT64_C(17010468753885436086), UINT64_C(  414331165718085631) },
+      { UINT64_C( 2396479680814028514), UINT64_C(14954496354461365970) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  0),
+      { UINT64_C(14917649352516400356), UINT64_C(17921118282373733488) },
+      { UINT64_C(            16618071), UINT64_C( 9831126712227753086) },
+      { UINT64_C(15644087725337658726), UINT64_C( 3929875294431033957) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  1),
+      { UINT64_C( 1448288071334843217), UINT64_C( 2593478882490840380) },
+      { UINT64_C(13849277855164174326), UINT64_C(15869096411409740236) },
+      { UINT64_C(    4251021268782975), UINT64_C(    3688800785601193) },
+      { UINT64_C( 1451146801472940123), UINT64_C(                   0) } },
+    { UINT8_C(  0),
+      { UINT64_C(12766045959248497893), UINT64_C(17517818793055884021) },
+      { UINT64_C(13414816674550239770), UINT64_C(18294127427217864538) },
+      { UINT64_C(            44298649), UINT64_C(    4503599627370495) },
+      { UINT64_C(                   0), UINT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_maskz_madd52lo_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C(16034273004092736939), UINT64_C( 3016324917876708610), UINT64_C( 9831744612943341993), UINT64_C(18446743044385179878) },
+      { UINT64_C( 2263600631670028732), UINT64_C(    2289371698956526), UINT64_C(13302513035274983058), UINT64_C(  409827566090715135) },
+      { UINT64_C( 4706433505340079906), UINT64_C(    4503599627370495), UINT64_C(15421365114175113722), UINT64_C(13344165695898779647) },
+      { UINT64_C(16034558790014416035), UINT64_C( 3018539145805122580), UINT64_C( 9833521427781375549), UINT64_C(18446743044385179879) } },
+    { { UINT64_C(11657820674189669710), UINT64_C(18446743102976420452), UINT64_C( 5671527359639825576), UINT64_C(  314843851320901475) },
+      { UINT64_C(    4503599627370495), UINT64_C(    1634482319284534), UINT64_C( 7394910588142354431), UINT64_C(             9131590) },
+      { UINT64_C(10046490589652725586), UINT64_C(    2143446161589224), UINT64_C(    3283747643976016), UINT64_C( 2018186765370633512) },
+      { UINT64_C(11658860853200520700), UINT64_C(     487675215177044), UINT64_C( 5672747211623220056), UINT64_C(  316286794685450323) } },
+    { { UINT64_C(18446743343620779266), UINT64_C( 7312556429983070498), UINT64_C( 1576954436444798257), UINT64_C(18446743951266103953) },
+      { UINT64_C(16875935194566926856), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C( 7516549279143590023) },
+      { UINT64_C( 3626131370939278622), UINT64_C(    4460659307531349), UINT64_C( 8682940081570316287), UINT64_C( 1713676173956822422) },
+      { UINT64_C(      98131435426290), UINT64_C( 7312599370302909645), UINT64_C( 1576954436444798258), UINT64_C(    1075190306755755) } },
+    { { UINT64_C(18446743745036103123), UINT64_C(18446743231642165123), UINT64_C( 9317577179561894461), UINT64_C(10362540938546872967) },
+      { UINT64_C(    1415563552555792), UINT64_C( 9629367809225303720), UINT64_C(12633446278528378295), UINT64_C(    3148037662049016) },
+      { UINT64_C( 6251842805779532524), UINT64_C( 7114008584817210017), UINT64_C( 3692951694443806719), UINT64_C(    2894154740979397) },
+      { UINT64_C(    4105343980707987), UINT64_C(    3911594413063979), UINT64_C( 9321231455435127942), UINT64_C(10363257725636516703) } },
+    { { UINT64_C( 5144884030010802093), UINT64_C( 6512819094475099553), UINT64_C( 1578369279161207019), UINT64_C( 8305198766658933070) },
+      { UINT64_C(    4503599627370495), UINT64_C(17884088865499889306), UINT64_C(16614397036831221500), UINT64_C( 9192189532470599687) },
+      { UINT64_C( 3428638784926851999), UINT64_C(14861878770322636799), UINT64_C(    2234839497822677), UINT64_C(17194743377300553727) },
+      { UINT64_C( 5147988161140268046), UINT64_C( 6517027948890820359), UINT64_C( 1581635519856882839), UINT64_C( 8309359673278886215) } },
+    { { UINT64_C(18446743062073419028), UINT64_C(18446743526043002817), UINT64_C(13581573353955558450), UINT64_C(  938402665294996968) },
+      { UINT64_C( 3560051180605732582), UINT64_C( 3242348159933763533), UINT64_C( 9090538361529143786), UINT64_C(10444229238144171000) },
+      { UINT64_C(16856314205117471501), UINT64_C( 1195635158391149115), UINT64_C(17548391817957607056), UINT64_C(    4503599627370495) },
+      { UINT64_C(    1820208692523202), UINT64_C(    3920014810199552), UINT64_C(13584334948438119378), UINT64_C(  942524562650376688) } },
+    { { UINT64_C(13047435626674632056), UINT64_C(18446743559202403411), UINT64_C(15028616444165370233), UINT64_C(16068018287064231606) },
+      { UINT64_C(15244639724787912640), UINT64_C(            60827585), UINT64_C( 1900026552939660722), UINT64_C(11266382126585317567) },
+      { UINT64_C(    4503599627370495), UINT64_C(12329421065166418352), UINT64_C(    2153576111422978), UINT64_C(    4424061112833631) },
+      { UINT64_C(13047480640535848376), UINT64_C(    3956809263577603), UINT64_C(15032765747969251549), UINT64_C(16070105771243706263) } },
+    { { UINT64_C(18446743992098105537), UINT64_C(16832155223647114755), UINT64_C(18446743242536524680), UINT64_C(17376475125969394233) },
+      { UINT64_C(11295910917760665525), UINT64_C( 9984767130768887431), UINT64_C(     796152549276656), UINT64_C(11389347585446460453) },
+      { UINT64_C(            65510735), UINT64_C( 5507902344274116607), UINT64_C(    2510642542365847), UINT64_C( 2418563659336835681) },
+      { UINT64_C(    2482937979914908), UINT64_C(16836372066385987452), UINT64_C(    2198079496779288), UINT64_C(17377643908796616254) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_madd52lo_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[4];
+    const simde__mmask8 k;
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C(14580798697814892251), UINT64_C(11067026996082013717), UINT64_C(16644068311747765755), UINT64_C( 1992244499213003618) },
+      UINT8_C(  8),
+      { UINT64_C( 4316579229366562586), UINT64_C(10547430327301701631), UINT64_C(14283316537542954981), UINT64_C( 3470393359782199158) },
+      { UINT64_C(            15621976), UINT64_C(    4089237803059525), UINT64_C( 4581276228332995925), UINT64_C( 9529036574863013133) },
+      { UINT64_C(14580798697814892251), UINT64_C(11067026996082013717), UINT64_C(16644068311747765755), UINT64_C( 1994337409697895008) } },
+    { { UINT64_C(18446743205148357804), UINT64_C(12628358928300885615), UINT64_C( 4045416055255126318), UINT64_C( 6971525102929216859) },
+      UINT8_C(  2),
+      { UINT64_C(  497692050317034195), UINT64_C(    4503599627370495), UINT64_C(              627180), UINT64_C(15624000247859774879) },
+      { UINT64_C(10448762985684137020), UINT64_C(    3059244917413046), UINT64_C( 7514932148698819096), UINT64_C(    4503599627370495) },
+      { UINT64_C(18446743205148357804), UINT64_C(12629803283010843065), UINT64_C( 4045416055255126318), UINT64_C( 6971525102929216859) } },
+    { { UINT64_C( 8794170585183348670), UINT64_C(14216727754975417267), UINT64_C(15420459786950621429), UINT64_C(15105948477086962057) },
+      UINT8_C(  9),
+      { UINT64_C( 3294383841471833215), UINT64_C( 6173369387896621745), UINT64_C(            11132313), UINT64_C( 1395884985035416039) },
+      { UINT64_C(    1020602273338931), UINT64_C(    2096774153203487), UINT64_C( 1666331862127083519), UINT64_C( 7178737806028570623) },
+      { UINT64_C( 8798465407094920971), UINT64_C(14216727754975417267), UINT64_C(15420459786950621429), UINT64_C(15106179376536399778) } },
+    { { UINT64_C(17093400302768312666), UINT64_C( 1263314120198146113), UINT64_C(17104622000613128180), UINT64_C(15747652572010259524) },
+      UINT8_C( 11),
+      { UINT64_C(14177037383840444822), UINT64_C(            56051540), UINT64_C( 8480024393969869963), UINT64_C(17952434552105574367) },
+      { UINT64_C( 6335527630660877927), UINT64_C(13785518459381088255), UINT64_C(            32256057), UINT64_C(            10662898) },
+      { UINT64_C(17095463590234069172), UINT64_C( 1267817719769465069), UINT64_C(17104622000613128180), UINT64_C(15750115334505640466) } },
+    { { UINT64_C( 6351258127444008403), UINT64_C(18446743110404280794), UINT64_C(18446743999767460228), UINT64_C( 3009845904985979546) },
+      UINT8_C( 10),
+      { UINT64_C(11997753669040768251), UINT64_C(             6107853), UINT64_C(15736923530173924714), UINT64_C(13294566721825007293) },
+      { UINT64_C( 9712192303456896303), UINT64_C(  484660772018072857), UINT64_C( 4550964628931336541), UINT64_C(15397807125979725823) },
+      { UINT64_C( 6351258127444008403), UINT64_C(    3226625750864095), UINT64_C(18446743999767460228), UINT64_C( 3009905283158676445) } },
+    { { UINT64_C( 1980052956043399782), UINT64_C(12063294218049404181), UINT64_C(12674090535408554915), UINT64_C(14428898315272295491) },
+      UINT8_C(  5),
+      { UINT64_C(            55378696), UINT64_C(    4503599627370495), UINT64_C(16530989050204511284), UINT64_C(    3233147567374168) },
+      { UINT64_C( 7683886036910964292), UINT64_C( 1169653007097309947), UINT64_C(13654903022753561012), UINT64_C(  602297549045755484) },
+      { UINT64_C( 1983382043851526278), UINT64_C(12063294218049404181), UINT64_C(12674629362830621747), UINT64_C(14428898315272295491) } },
+    { { UINT64_C( 5593021899320582170), UINT64_C(17230123567023363001), UINT64_C( 2667241872831702505), UINT64_C(18446743340592415040) },
+      UINT8_C(  1),
+      { UINT64_C(  143768508765122938), UINT64_C(     297680405770133), UINT64_C(             6277856), UINT64_C( 3633162724796873401) },
+      { UINT64_C(13946539599652430952), UINT64_C(            48752336), UINT64_C(            41971821), UINT64_C( 8691671033796768551) },
+      { UINT64_C( 5595351079741563306), UINT64_C(17230123567023363001), UINT64_C( 2667241872831702505), UINT64_C(18446743340592415040) } },
+    { { UINT64_C(17293871393431735363), UINT64_C(18446743209783628549), UINT64_C( 7577601927643397655), UINT64_C( 2066826703088920099) },
+      UINT8_C(  7),
+      { UINT64_C( 6372474153856398641), UINT64_C(18299207491808329751), UINT64_C( 1372883891755786351), UINT64_C(11041617965399614521) },
+      { UINT64_C(             4023583), UINT64_C( 1257357717567996423), UINT64_C(    4503599627370495), UINT64_C(    2374084804582094) },
+      { UINT64_C(17297210479088357938), UINT64_C(    4312197048123814), UINT64_C( 7578315922235612584), UINT64_C( 2066826703088920099) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_mask_madd52lo_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { UINT64_C(15197332441237124959), UINT64_C(13744703848825708946), UINT64_C( 6391007462008808633), UINT64_C(17249527947484441873) },
+      { UINT64_C(17455952155688042495), UINT64_C(    4503599627370495), UINT64_C(  342715407460042621), UINT64_C(            25714970) },
+      { UINT64_C(14929919189653830215), UINT64_C(     217122698529723), UINT64_C(            11673084), UINT64_C(    4503599627370495) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  0),
+      { UINT64_C( 8559136444897061831), UINT64_C( 7056393338376915066), UINT64_C( 8012518466256812441), UINT64_C( 1691355670257367515) },
+      { UINT64_C( 4077449754750471941), UINT64_C(10455738014150062134), UINT64_C( 4621021912717314907), UINT64_C(     839067861621825) },
+      { UINT64_C(13785186496065641834), UINT64_C(10844667902708154367), UINT64_C(    4503599627370495), UINT64_C( 8696334734808877666) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C( 10),
+      { UINT64_C( 3331093786409517246), UINT64_C(18446743655827703853), UINT64_C(13070703560465069223), UINT64_C(18446743728290309433) },
+      { UINT64_C( 6497903701309473824), UINT64_C( 3421432235429813054), UINT64_C(    4247719162713278), UINT64_C(            26652588) },
+      { UINT64_C(    4503599627370495), UINT64_C(15357671908463955320), UINT64_C( 5719571526760529919), UINT64_C( 8502789871329061994) },
+      { UINT64_C(                   0), UINT64_C(    3763618449945405), UINT64_C(                   0), UINT64_C(     850369365734001) } },
+    { UINT8_C( 13),
+      { UINT64_C(18446743108666669557), UINT64_C(13446958402365848346), UINT64_C(18446743717834408368), UINT64_C(18446743680377100591) },
+      { UINT64_C(  178157064976720444), UINT64_C(    4503599627370495), UINT64_C(11352765250874753524), UINT64_C(            58284819) },
+      { UINT64_C( 7781484492026101616), UINT64_C( 1892135172989685310), UINT64_C( 1383214487878938111), UINT64_C(    3862810766276408) },
+      { UINT64_C(    2888085587228725), UINT64_C(                   0), UINT64_C(    2560072213485500), UINT64_C(    3354912209787479) } },
+    { UINT8_C( 15),
+      { UINT64_C(14061927505178756744), UINT64_C(11041997825880749690), UINT64_C( 2730595510269776391), UINT64_C(12877796232247860683) },
+      { UINT64_C(            27383346), UINT64_C(18269974030476171199), UINT64_C( 2182208019228948276), UINT64_C(    2138162641996951) },
+      { UINT64_C( 4130681724120936921), UINT64_C(  351280770934898687), UINT64_C(            56913694), UINT64_C(14991760904707991047) },
+      { UINT64_C(14065595550249625834), UINT64_C(11043127483646680763), UINT64_C( 2731086424872424991), UINT64_C(12879791149866508268) } },
+    { UINT8_C( 10),
+      { UINT64_C( 7040747914906310501), UINT64_C(18446743677357828286), UINT64_C(10963152940603778042), UINT64_C( 5901870851633132491) },
+      { UINT64_C(    4503599627370495), UINT64_C( 8424512284812003491), UINT64_C(17761108362470295750), UINT64_C(            27627187) },
+      { UINT64_C(            49209317), UINT64_C(            44989807), UINT64_C(    2880449565958533), UINT64_C(  808528415068768406) },
+      { UINT64_C(                   0), UINT64_C(    1460505956302443), UINT64_C(                   0), UINT64_C( 5905929260552530093) } },
+    { UINT8_C(  3),
+      { UINT64_C(18446743531640986933), UINT64_C( 4847648794032893949), UINT64_C(16481174727146197578), UINT64_C( 7074226350131096835) },
+      { UINT64_C(    3164868414427412), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C(12015603805824483327) },
+      { UINT64_C(    4503599627370495), UINT64_C(    2898251123719489), UINT64_C(    3758821075802567), UINT64_C(            12621401) },
+      { UINT64_C(    1338189144378401), UINT64_C( 4849254142536544956), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  1),
+      { UINT64_C( 3175187352482607665), UINT64_C(18446743633583903589), UINT64_C(18446743703878677576), UINT64_C(18446744059308082788) },
+      { UINT64_C(16780345111825855438), UINT64_C( 3974925908480120143), UINT64_C(            32373610), UINT64_C(11758283482490837789) },
+      { UINT64_C( 4570182898556384024), UINT64_C(15167772502252750166), UINT64_C( 8696475758481238620), UINT64_C(12011839091225828284) },
+      { UINT64_C( 3178243205341894529), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_maskz_madd52lo_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C( 7844188279242803881), UINT64_C(18446743579764071023), UINT64_C(18446743342203150733), UINT64_C( 3207087413253812072),
+        UINT64_C( 7667052016456532233), UINT64_C( 5193818217804677577), UINT64_C(18446743933320802957), UINT64_C(10270119770693433720) },
+      { UINT64_C(    2798726919230443), UINT64_C( 6194109565939130145), UINT64_C( 7643911945344982388), UINT64_C(17347152879454081093),
+        UINT64_C( 3126142452942213817), UINT64_C(18125446005612005975), UINT64_C(    2297041764827779), UINT64_C(    4503599627370495) },
+      { UINT64_C(             1193919), UINT64_C(15982555792029792939), UINT64_C( 1850554265409342185), UINT64_C(10123744386474278270),
+        UINT64_C( 3715469692580659199), UINT64_C( 5096018767027288740), UINT64_C(12892243764225573976), UINT64_C(16117666309115349314) },
+      { UINT64_C( 7847185832767202302), UINT64_C(    2607265151704954), UINT64_C(     601539118987297), UINT64_C( 3209702141450576478),
+        UINT64_C( 7670911304536813136), UINT64_C( 5197087355376113541), UINT64_C(      83680164944789), UINT64_C(10270836527937089590) } },
+    { { UINT64_C( 6202496528114192890), UINT64_C(18446743217279179106), UINT64_C(11169697478762964686), UINT64_C(18446743379207893074),
+        UINT64_C(18446743780635523207), UINT64_C(18446743296822130728), UINT64_C(18446743199150050241), UINT64_C( 8359614043317096502) },
+      { UINT64_C( 8434739883154855899), UINT64_C(12709158148439539711), UINT64_C(10603581831199067485), UINT64_C(    1540510272499963),
+        UINT64_C(             4424835), UINT64_C(12164416455771961025), UINT64_C( 4159015560149379032), UINT64_C( 9245141587667056727) },
+      { UINT64_C(    2164303661057894), UINT64_C(17432750907519013528), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495),
+        UINT64_C( 4300937644138823679), UINT64_C(12313464022681110668), UINT64_C(    4503599627370495), UINT64_C(11107222922856626221) },
+      { UINT64_C( 6203528384016404540), UINT64_C(     682393601803978), UINT64_C(11172092770021415281), UINT64_C(    2962394853211991),
+        UINT64_C(    4503306548917252), UINT64_C(    2258321275908532), UINT64_C(    2309620981457897), UINT64_C( 8363252072621031297) } },
+    { { UINT64_C(18446743878835066192), UINT64_C(18446743874793655864), UINT64_C(  930130251570820687), UINT64_C(14135011377960110807),
+        UINT64_C(18064171006702372148), UINT64_C(18446744017251011414), UINT64_C(  960832157390602075), UINT64_C(18446743452910529975) },
+      { UINT64_C(11367085459483131903), UINT64_C(    2767282670726492), UINT64_C(10601473522830147583), UINT64_C(14064100598804526340),
+        UINT64_C( 7307866041306524456), UINT64_C(16761691940954805658), UINT64_C(    3468863828956578), UINT64_C(16982635204542923023) },
+      { UINT64_C( 9358272184331733043), UINT64_C(  387309567953862655), UINT64_C(            18890448), UINT64_C(10617575904299649342),
+        UINT64_C( 8601875288277647359), UINT64_C(10688465998213829555), UINT64_C(    3491581807281439), UINT64_C(    4503599627370495) },
+      { UINT64_C(     207646469672221), UINT64_C(    1736118040748252), UINT64_C(  934633851179300735), UINT64_C(14137343106466235855),
+        UINT64_C(18065647160618162700), UINT64_C(    1228394300806148), UINT64_C(  964644201951905785), UINT64_C(     438369472195752) } },
+    { { UINT64_C( 7267885069662149035), UINT64_C(10072093047468488593), UINT64_C( 2791483712029529624), UINT64_C( 2755032956507227263),
+        UINT64_C(  102878298079355279), UINT64_C( 8416399107315885382), UINT64_C(18446743264679282603), UINT64_C(18446743073587707689) },
+      { UINT64_C(    3250149323508352), UINT64_C(17730714447050765129), UINT64_C( 5958619789214891332), UINT64_C(     634039693821653),
+        UINT64_C( 1899053070623050048), UINT64_C(11099934605695118969), UINT64_C(    3151501697327832), UINT64_C( 4559713730841499280) },
+      { UINT64_C(    4081771490284315), UINT64_C(    4503599627370495), UINT64_C(  376454072981396858), UINT64_C(12036117358579419781),
+        UINT64_C( 6302768063337195768), UINT64_C(14594988660440613348), UINT64_C(17479959567317129169), UINT64_C(    4503599627370495) },
+      { UINT64_C( 7272289104996562219), UINT64_C(10076553933002736712), UINT64_C( 2794717465404046464), UINT64_C( 2756346473409127208),
+        UINT64_C(  104750795462334351), UINT64_C( 8420049590948332042), UINT64_C(    3465138829992451), UINT64_C(    2431691562969241) } },
+    { { UINT64_C(15276945952940077903), UINT64_C( 1147250835376819460), UINT64_C( 9974966663543543950), UINT64_C(15630455560834367072),
+        UINT64_C( 2298085545646042890), UINT64_C( 9303467969920387771), UINT64_C( 8722259643711897614), UINT64_C( 1782578243920646168) },
+      { UINT64_C(18339683045280813866), UINT64_C(10461831010296092101), UINT64_C(            13540782), UINT64_C(    4503599627370495),
+        UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C(    3949901098885615), UINT64_C( 7893324831049307235) },
+      { UINT64_C(11211748378223530043), UINT64_C(            54134755), UINT64_C(            12552125), UINT64_C( 9916283576895941147),
+        UINT64_C( 7444450184043429887), UINT64_C(            65848848), UINT64_C(10412322338480586751), UINT64_C(12365947447164317082) },
+      { UINT64_C(15279916589114179069), UINT64_C( 1148501185505082803), UINT64_C( 9975136629131805700), UINT64_C(15631098363408258117),
+        UINT64_C( 2298085545646042891), UINT64_C( 9307971569481909419), UINT64_C( 8722813342240382495), UINT64_C( 1784088190695340710) } },
+    { { UINT64_C(18446743948654709924), UINT64_C(13328385558017808503), UINT64_C(11053305293717926525), UINT64_C(18446743462156597793),
+        UINT64_C( 5489561792425989265), UINT64_C(18446743016137141796), UINT64_C( 5116226757138042488), UINT64_C(11391952096635367770) },
+      { UINT64_C(     848026720518007), UINT64_C(            33782410), UINT64_C( 3190645509033305868), UINT64_C( 9771595001610690989),
+        UINT64_C( 3148197968733621310), UINT64_C(            59583792), UINT64_C(    1416264725421462), UINT64_C( 5140608344686989000) },
+      { UINT64_C(14743738142503217015), UINT64_C( 4366795871698865492), UINT64_C(    4503599627370495), UINT64_C(16384095444373864447),
+        UINT64_C(14875389569204748287), UINT64_C( 1584786666173834512), UINT64_C(   82129567983614700), UINT64_C(    4503599627370495) },
+      { UINT64_C(    2646800535891445), UINT64_C(13330681075007868863), UINT64_C(11055711920490302321), UINT64_C(    1215578230331508),
+        UINT64_C( 5493883562851715155), UINT64_C(     493514363269412), UINT64_C( 5120153711965638848), UINT64_C(11394454526405485202) } },
+    { { UINT64_C(18446743375542896559), UINT64_C( 6175443828120792481), UINT64_C( 4281346697391228434), UINT64_C(18446743765574617665),
+        UINT64_C( 4647814929892174822), UINT64_C(15720931065293710528), UINT64_C(18446743620310163233), UINT64_C(18446743898358753716) },
+      { UINT64_C(16104767310576296225), UINT64_C(10351788021449077177), UINT64_C( 5100542936818795946), UINT64_C(            19878048),
+        UINT64_C( 1940823386667502817), UINT64_C(17112274515603565952), UINT64_C( 6758233883597310355), UINT64_C(17365645810154493311) },
+      { UINT64_C( 6223974685026025471), UINT64_C( 6569872017012562612), UINT64_C( 2252705535504709790), UINT64_C(16409084983454361293),
+        UINT64_C(    4503599627370495), UINT64_C(    3153432367652627), UINT64_C( 9583660007044415487), UINT64_C( 1368788983894162795) },
+      { UINT64_C(     104258733942414), UINT64_C( 6176243505971752373), UINT64_C( 4284117996186793214), UINT64_C(    1464405296241249),
+        UINT64_C( 4648042982621355781), UINT64_C(15723754484108690752), UINT64_C(    1668703686415758), UINT64_C(     842779695884489) } },
+    { { UINT64_C( 5571033339699825638), UINT64_C(  722959289286229614), UINT64_C(18446743568398292674), UINT64_C(18446743872853406017),
+        UINT64_C(18446743242290926588), UINT64_C( 7293900886458943186), UINT64_C(10970955157654322116), UINT64_C( 4227396806563662566) },
+      { UINT64_C(            43254875), UINT64_C(12011100206197112831), UINT64_C( 4138537995435068690), UINT64_C(     693163733262884),
+        UINT64_C(17098176113893364748), UINT64_C(15658614535669389677), UINT64_C(    4503599627370495), UINT64_C(15284835704865548713) },
+      { UINT64_C(13490534525799868338), UINT64_C(    3203637207724609), UINT64_C(    4503599627370495), UINT64_C(15381021066752418343),
+        UINT64_C(14881126328600704143), UINT64_C(            13423502), UINT64_C(    4395931101542090), UINT64_C( 6190275583844047506) },
+      { UINT64_C( 5571579770771599404), UINT64_C(  724259251705875501), UINT64_C(     269556807158192), UINT64_C(    4293926260567229),
+        UINT64_C(    3915703779161776), UINT64_C( 7298214309580159048), UINT64_C(10971062826180150522), UINT64_C( 4228174382269052744) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_madd52lo_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const simde__mmask8 k;
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C(18446743866693608976), UINT64_C(15787930055083873013), UINT64_C( 4579980674461260498), UINT64_C(18446743510754322690),
+        UINT64_C(11713289039273762316), UINT64_C(18446744020404366954), UINT64_C( 5542591293541010905), UINT64_C( 6712288155440716455) },
+      UINT8_C(250),
+      { UINT64_C( 9700146661984036371), UINT64_C(    1544096912267728), UINT64_C(    4503599627370495), UINT64_C(11018464664935724216),
+        UINT64_C( 5749753106416448299), UINT64_C( 7286824197085462527), UINT64_C(  183285730412378182), UINT64_C( 1912557778127703242) },
+      { UINT64_C( 6283851621652018698), UINT64_C( 7097673012735901695), UINT64_C(14321868046758552120), UINT64_C(15131675939196346637),
+        UINT64_C(11753402098528560446), UINT64_C(  185094185201849300), UINT64_C(            32317040), UINT64_C(18252431863372927545) },
+      { UINT64_C(18446743866693608976), UINT64_C(15790889557798975781), UINT64_C( 4579980674461260498), UINT64_C(    2918046018571866),
+        UINT64_C(11715742596747245942), UINT64_C(    4056945842526870), UINT64_C( 5545486226769191033), UINT64_C( 6713629483954136993) } },
+    { { UINT64_C(11460455924925362242), UINT64_C( 1232310493046810171), UINT64_C(16188635919024412426), UINT64_C(18446743113482013913),
+        UINT64_C( 4761183261952136444), UINT64_C(18446743724991186471), UINT64_C( 2247366993514905945), UINT64_C(17429246934642309710) },
+      UINT8_C( 61),
+      { UINT64_C( 9214364837600034815), UINT64_C(            31335924), UINT64_C( 5038299349113081131), UINT64_C(10411147984571894257),
+        UINT64_C(             3343439), UINT64_C( 2612882998888510989), UINT64_C( 1780082927885321433), UINT64_C(             3033425) },
+      { UINT64_C( 7836263351624663039), UINT64_C(    1749961045276498), UINT64_C(18182600137986255543), UINT64_C(      15324254066196),
+        UINT64_C(    3601823719411051), UINT64_C( 3314389572524785295), UINT64_C(             6472213), UINT64_C(    1680491198583472) },
+      { UINT64_C(11460455924925362243), UINT64_C( 1232310493046810171), UINT64_C(16190899436298817223), UINT64_C(    2803865819564461),
+        UINT64_C( 4762293064914003201), UINT64_C(     423622302129514), UINT64_C( 2247366993514905945), UINT64_C(17429246934642309710) } },
+    { { UINT64_C(18446743037675250933), UINT64_C(18446743022584699971), UINT64_C( 2051282792832170861), UINT64_C( 4609444490042542197),
+        UINT64_C(14029307877499092725), UINT64_C(18446743768672209498), UINT64_C( 5772210058284801345), UINT64_C(12164044978944840270) },
+      UINT8_C(  7),
+      { UINT64_C( 2133030323598486093), UINT64_C(    2106629870420881), UINT64_C( 7362374549085753577), UINT64_C(            44152478),
+        UINT64_C(     236282720724198), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C(  454036768553485312) },
+      { UINT64_C(17212757775810035711), UINT64_C(15197757581144526938), UINT64_C( 4352809094514350324), UINT64_C(            14078919),
+        UINT64_C(    1104957268921846), UINT64_C(11731877029300142079), UINT64_C( 5994291104030130175), UINT64_C(11548374905576178568) },
+      { UINT64_C(    1674863740828328), UINT64_C(    3290081893510461), UINT64_C( 2053889486680355201), UINT64_C( 4609444490042542197),
+        UINT64_C(14029307877499092725), UINT64_C(18446743768672209498), UINT64_C( 5772210058284801345), UINT64_C(12164044978944840270) } },
+    { { UINT64_C(18446744039155996254), UINT64_C( 2847786505574440667), UINT64_C(13173140505927411718), UINT64_C( 9229248668908843168),
+        UINT64_C(18446743031085086854), UINT64_C(18446743793838806496), UINT64_C(18446743453649685571), UINT64_C( 9056368901537343031) },
+      UINT8_C( 82),
+      { UINT64_C( 2307737651328450668), UINT64_C(  264172161792518492), UINT64_C( 3339178427503110515), UINT64_C( 3796534485873328127),
+        UINT64_C( 4487538129664983675), UINT64_C(             6878610), UINT64_C(11286020666190462975), UINT64_C(    4503599627370495) },
+      { UINT64_C(16265535365048350710), UINT64_C(15811641317707597323), UINT64_C( 7754117055792705355), UINT64_C( 7476961277415309489),
+        UINT64_C(             5047758), UINT64_C(            24970573), UINT64_C(14815028978719660611), UINT64_C(17604567861329755398) },
+      { UINT64_C(18446744039155996254), UINT64_C( 2850274149777722831), UINT64_C(13173140505927411718), UINT64_C( 9229248668908843168),
+        UINT64_C(    3560636960153216), UINT64_C(18446743793838806496), UINT64_C(    1813175269405184), UINT64_C( 9056368901537343031) } },
+    { { UINT64_C( 2954526557651211594), UINT64_C(16074500342795128486), UINT64_C(18446743660466193637), UINT64_C( 1776260300566098984),
+        UINT64_C(10424071343505988370), UINT64_C(18446743093810183603), UINT64_C(11857545085560371152), UINT64_C( 8966159013130899346) },
+      UINT8_C( 78),
+      { UINT64_C(            42809009), UINT64_C(12624047798694535751), UINT64_C(    3257879085911842), UINT64_C( 9754796792884494335),
+        UINT64_C(            12469153), UINT64_C(            48267732), UINT64_C( 5336765558434037759), UINT64_C( 1945555039024054271) },
+      { UINT64_C(16499778480300980611), UINT64_C( 6040741403942382973), UINT64_C( 1525633952540682826), UINT64_C(18239738680365620392),
+        UINT64_C(16486242166598862069), UINT64_C( 4341470040785158143), UINT64_C(16465160237666533375), UINT64_C(    4503599627370495) },
+      { UINT64_C( 2954526557651211594), UINT64_C(16077297659370374737), UINT64_C(     820912464672953), UINT64_C( 1780603710678357888),
+        UINT64_C(10424071343505988370), UINT64_C(18446743093810183603), UINT64_C(11857545085560371153), UINT64_C( 8966159013130899346) } },
+    { { UINT64_C( 2603443397093339499), UINT64_C(18446743919740203110), UINT64_C(13209001649367780756), UINT64_C(   20214843035823226),
+        UINT64_C( 1324687288075828024), UINT64_C(11534764996929986529), UINT64_C(  215910854467296417), UINT64_C( 8547736259259154704) },
+      UINT8_C(232),
+      { UINT64_C( 5624995934585749503), UINT64_C(    4466012162262334), UINT64_C(    4503599627370495), UINT64_C(    1572697629704760),
+        UINT64_C( 1611957223248899109), UINT64_C(12862280535770136575), UINT64_C(            47723926), UINT64_C(            51750484) },
+      { UINT64_C( 1301540292310073343), UINT64_C(            19637819), UINT64_C(16366081045864382463), UINT64_C( 3288926570853894481),
+        UINT64_C( 9766507182475112768), UINT64_C( 7142709009009606655), UINT64_C( 8698796746929285256), UINT64_C( 8441437877556522686) },
+      { UINT64_C( 2603443397093339499), UINT64_C(18446743919740203110), UINT64_C(13209001649367780756), UINT64_C(   22230176580409394),
+        UINT64_C( 1324687288075828024), UINT64_C(11534764996929986530), UINT64_C(  217742193435771985), UINT64_C( 8549228059991788392) } },
+    { { UINT64_C(16324172838717066027), UINT64_C(18446743171549316017), UINT64_C( 2720778117818995839), UINT64_C( 2359580940909275445),
+        UINT64_C(10241633993430927913), UINT64_C( 6916957543820955518), UINT64_C(15239957583350709848), UINT64_C(18446743275311575638) },
+      UINT8_C( 68),
+      { UINT64_C(12087661399862411263), UINT64_C( 4344214273902087971), UINT64_C( 2805535160768173336), UINT64_C( 5420208889503510171),
+        UINT64_C(15644797404437480380), UINT64_C(            21225650), UINT64_C(            38261636), UINT64_C(    4503599627370495) },
+      { UINT64_C( 9714264396238159871), UINT64_C(13802653226586323839), UINT64_C(            24448827), UINT64_C(16385845215133614034),
+        UINT64_C(     854442693485086), UINT64_C(    4391751045571511), UINT64_C(18274705423120459149), UINT64_C( 8852299678209603570) },
+      { UINT64_C(16324172838717066027), UINT64_C(18446743171549316017), UINT64_C( 2724900725083904263), UINT64_C( 2359580940909275445),
+        UINT64_C(10241633993430927913), UINT64_C( 6916957543820955518), UINT64_C(15242748885519847948), UINT64_C(18446743275311575638) } },
+    { { UINT64_C(15530930220805986143), UINT64_C(18446743640481355554), UINT64_C(18446743195491666659), UINT64_C( 9428693887660094935),
+        UINT64_C(14983897401194547024), UINT64_C( 8103794767263494299), UINT64_C(13101696430369545247), UINT64_C(  455593449905535192) },
+      UINT8_C(106),
+      { UINT64_C(            47703183), UINT64_C(             9043682), UINT64_C( 6524690967879777885), UINT64_C(    1601036175938770),
+        UINT64_C(            22258554), UINT64_C(            47123907), UINT64_C(    2185259761646463), UINT64_C(13069097609262346365) },
+      { UINT64_C( 4396006893908826088), UINT64_C(17778400692022180112), UINT64_C(11241293469917424681), UINT64_C(10135853209978443086),
+        UINT64_C(     249740258033746), UINT64_C(    1128410416674286), UINT64_C(    1219792865804781), UINT64_C(13221396366519358226) },
+      { UINT64_C(15530930220805986143), UINT64_C(    3268770986661698), UINT64_C(18446743195491666659), UINT64_C( 9432083615301830611),
+        UINT64_C(14983897401194547024), UINT64_C( 8107145685414206181), UINT64_C(13105309892882788274), UINT64_C(  455593449905535192) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_mask_madd52lo_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_madd52lo_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(131),
+      { UINT64_C(18446743943687078944), UINT64_C(18446743020511078480), UINT64_C( 4882684440494227680), UINT64_C(15512075800931933181),
+        UINT64_C( 1256111406262790206), UINT64_C( 7684190632601839379), UINT64_C( 2095921589171197561), UINT64_C(18446743274308143106) },
+      { UINT64_C( 6022786487430667707), UINT64_C( 6904018228758970367), UINT64_C(  367380615806338009), UINT64_C(15240756701222487812),
+        UINT64_C(    3904104959536806), UINT64_C( 5377297955080372223), UINT64_C(11537611435399794377), UINT64_C(13109381088797920897) },
+      { UINT64_C( 1089871109823660031), UINT64_C(18354992722840987700), UINT64_C(18039513602583310347), UINT64_C(    4503599627370495),
+        UINT64_C(16640800623133982719), UINT64_C( 7984882139327889407), UINT64_C(            56595366), UINT64_C(15334756731196538879) },
+      { UINT64_C(    3029683968583269), UINT64_C(    1678305122680860), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(     596627076184449) } },
+    { UINT8_C(107),
+      { UINT64_C( 4078846348030452973), UINT64_C(13489609112164564172), UINT64_C(18446743375478809610), UINT64_C( 3051868443953430498),
+        UINT64_C(  895746852071274828), UINT64_C(15628433856295425002), UINT64_C( 5111561800424503806), UINT64_C( 3441313272790372511) },
+      { UINT64_C( 9876393982823497727), UINT64_C(    4503599627370495), UINT64_C(  726522964831052597), UINT64_C(    1859726651996979),
+        UINT64_C(    4503599627370495), UINT64_C( 9574652807789674495), UINT64_C(            21232776), UINT64_C(    1328868054892999) },
+      { UINT64_C(            55675559), UINT64_C(11844467019984404479), UINT64_C(14271907219137101823), UINT64_C(10605977122457518079),
+        UINT64_C( 8002023980768946335), UINT64_C(14794324775912079359), UINT64_C(11127698251517413409), UINT64_C( 7938943527966331702) },
+      { UINT64_C( 4083349947602147910), UINT64_C(13489609112164564173), UINT64_C(                   0), UINT64_C( 3054512316928804015),
+        UINT64_C(                   0), UINT64_C(15628433856295425003), UINT64_C( 5114385778251401094), UINT64_C(                   0) } },
+    { UINT8_C(151),
+      { UINT64_C( 4458289403656535323), UINT64_C( 1563259895368442832), UINT64_C( 6510670621066456483), UINT64_C( 5796653853963637147),
+        UINT64_C(18446743824128802839), UINT64_C( 8257063671506503074), UINT64_C( 3433846105326857675), UINT64_C(18446744032907156740) },
+      { UINT64_C( 1528194649901951401), UINT64_C(    1226430036993872), UINT64_C( 7282320597458092031), UINT64_C(    4503599627370495),
+        UINT64_C( 8434394394983365541), UINT64_C(    4503599627370495), UINT64_C(            40922583), UINT64_C( 6023555207722121412) },
+      { UINT64_C(15594921530966097274), UINT64_C( 8253908177790824203), UINT64_C(10741085111278632959), UINT64_C( 4922434392715952127),
+        UINT64_C( 6913025428013711359), UINT64_C(    4503599627370495), UINT64_C(     853128339031840), UINT64_C(10766690115043142263) },
+      { UINT64_C( 4460153826370493605), UINT64_C( 1565286459982414912), UINT64_C( 6510670621066456484), UINT64_C(                   0),
+        UINT64_C(     847457500824690), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(     114015367882784) } },
+    { UINT8_C( 55),
+      { UINT64_C( 9105072260836658483), UINT64_C( 6659236840114684048), UINT64_C(13619385512681798966), UINT64_C(18446743048220139728),
+        UINT64_C(18443864311409195871), UINT64_C(18446743806792064372), UINT64_C(13060979879164859247), UINT64_C(11396099816164084987) },
+      { UINT64_C(17809025488882095905), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C(13270832491558968039),
+        UINT64_C( 2754764137171079464), UINT64_C(    2002448231602537), UINT64_C(  936295091834347876), UINT64_C(    4503599627370495) },
+      { UINT64_C(    4503599627370495), UINT64_C( 6642809450371481599), UINT64_C(16368859491005033760), UINT64_C(18312105133760449904),
+        UINT64_C(15204914623814233127), UINT64_C( 5974886755715722371), UINT64_C(15270983710701989314), UINT64_C(15866800737282711497) },
+      { UINT64_C( 9107783298204874258), UINT64_C( 6659236840114684049), UINT64_C(13621110667168518166), UINT64_C(                   0),
+        UINT64_C(18443967767421974647), UINT64_C(     318984636328495), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(179),
+      { UINT64_C(18446743996397787355), UINT64_C( 6697432588857565067), UINT64_C( 4249846137528378037), UINT64_C(13112736506283436311),
+        UINT64_C(11518534142209249329), UINT64_C( 1920999416670208605), UINT64_C( 3212428252159242518), UINT64_C(18446743041889012392) },
+      { UINT64_C(            28830313), UINT64_C(13506295282484117503), UINT64_C(15100006960766064198), UINT64_C( 4234343950273853032),
+        UINT64_C(11038413413423838699), UINT64_C(    4503599627370495), UINT64_C(             4177895), UINT64_C(            36358604) },
+      { UINT64_C(    2812456017252215), UINT64_C(    4503599627370495), UINT64_C(17135870989416939325), UINT64_C(    3596146787633870),
+        UINT64_C( 4324293143377670968), UINT64_C(    4503599627370495), UINT64_C( 6898304145567618669), UINT64_C( 6052837899185946623) },
+      { UINT64_C(    4145356292945578), UINT64_C( 6697432588857565068), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C(11520777706056002713), UINT64_C( 1920999416670208606), UINT64_C(                   0), UINT64_C(    4502567770472668) } },
+    { UINT8_C(  4),
+      { UINT64_C(10898600639013596888), UINT64_C( 4203488729136213885), UINT64_C(18446743141974848230), UINT64_C( 3004746261988109596),
+        UINT64_C(10068321754150054664), UINT64_C(17915662578544903319), UINT64_C(18446743033847634313), UINT64_C( 7695583307601136538) },
+      { UINT64_C(12915123195553600760), UINT64_C( 5380996997642095729), UINT64_C(16661889057049785718), UINT64_C(    4503599627370495),
+        UINT64_C(17257739733912894315), UINT64_C(            46235222), UINT64_C(    3236737138228834), UINT64_C(15546425913682952191) },
+      { UINT64_C(    4503599627370495), UINT64_C( 2519534057629732371), UINT64_C( 8223879030756406756), UINT64_C(     674222068187807),
+        UINT64_C(             3369602), UINT64_C(14145806429570727935), UINT64_C(            31784256), UINT64_C( 5870391985761028428) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(    1918848760036862), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(239),
+      { UINT64_C(18446744047837643830), UINT64_C( 1998477674609330093), UINT64_C(18446743927271229553), UINT64_C( 3478066132885176609),
+        UINT64_C( 4300705815921909016), UINT64_C(16532789395473238703), UINT64_C(10781511577681550293), UINT64_C(16058622293799222440) },
+      { UINT64_C(    2962228516046726), UINT64_C( 5282626139836129863), UINT64_C(18446355734221748300), UINT64_C( 5940184584941376904),
+        UINT64_C( 8659696402394544194), UINT64_C(16757894213445615615), UINT64_C( 3213534700591883175), UINT64_C( 2504001392817995775) },
+      { UINT64_C( 8410325164665860387), UINT64_C(            12919473), UINT64_C( 8518942341313153488), UINT64_C( 2497330771586093778),
+        UINT64_C(            19834361), UINT64_C(            59206749), UINT64_C(    4503599627370495), UINT64_C(             5148167) },
+      { UINT64_C(    2280995740316040), UINT64_C( 2002756524728608964), UINT64_C(    2215371215729201), UINT64_C( 3481484909300562609),
+        UINT64_C(                   0), UINT64_C(16537292995041402450), UINT64_C(10783547011032201262), UINT64_C(16063125893421444769) } },
+    { UINT8_C( 86),
+      { UINT64_C(18446744009492546007), UINT64_C(18446743799334166206), UINT64_C(18446743480901408447), UINT64_C( 8623451680927091018),
+        UINT64_C( 9970370504788038223), UINT64_C(18446743183153370644), UINT64_C(18446743725680879914), UINT64_C(18446743415164078984) },
+      { UINT64_C(14663720386718334975), UINT64_C(            35398636), UINT64_C( 5322909424799272169), UINT64_C(    4503599627370495),
+        UINT64_C( 4989988387126509567), UINT64_C( 5472866520743190351), UINT64_C( 3255571667703537298), UINT64_C(            32661605) },
+      { UINT64_C(     386944468993930), UINT64_C(    4503599627370495), UINT64_C(15938239081264185343), UINT64_C( 2794035690063157741),
+        UINT64_C(            33332405), UINT64_C( 6174435089124950015), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495) },
+      { UINT64_C(                   0), UINT64_C(    4503325216586450), UINT64_C(     344741944510934), UINT64_C(                   0),
+        UINT64_C( 9974874104382076314), UINT64_C(                   0), UINT64_C(     530514856659608), UINT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_maskz_madd52lo_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 6356469457832088905), UINT64_C(18446743135787729213) },
+      { UINT64_C(10480261478775885365), UINT64_C( 2156865481645091013) },
+      { UINT64_C( 7215673032294000157), UINT64_C(            11038288) },
+      { UINT64_C( 6356546975267689433), UINT64_C(18446743135797888232) } },
+    { { UINT64_C( 2034547868807137421), UINT64_C( 1192833656436571008) },
+      { UINT64_C( 8969859648915768284), UINT64_C(10660260266452211039) },
+      { UINT64_C(15017144822435740124), UINT64_C(18249336082444079985) },
+      { UINT64_C( 2036067602754961983), UINT64_C( 1192873636786887125) } },
+    { { UINT64_C(18446743936464396467), UINT64_C(11364287495122659769) },
+      { UINT64_C(14357475612057141247), UINT64_C( 1747396655419752447) },
+      { UINT64_C(            48243247), UINT64_C( 5890708312600608767) },
+      { UINT64_C(18446743936512639713), UINT64_C(11368791094750030263) } },
+    { { UINT64_C( 1735825370483138920), UINT64_C(18446743859462098099) },
+      { UINT64_C(11632797837497991167), UINT64_C(    4503599627370495) },
+      { UINT64_C(    4503599627370495), UINT64_C( 2422936599525326847) },
+      { UINT64_C( 1740328970110509414), UINT64_C(    4503385379916977) } },
+    { { UINT64_C(18446743961385498804), UINT64_C(17020408840603205065) },
+      { UINT64_C(13380194492917743615), UINT64_C(18026154722657547124) },
+      { UINT64_C(10344768344070029311), UINT64_C(    4503599627370495) },
+      { UINT64_C(    4503487303317682), UINT64_C(17023157854524027196) } },
+    { { UINT64_C(15808062400454302715), UINT64_C( 3463745641234705829) },
+      { UINT64_C( 1298184871803374805), UINT64_C(    4503599627370495) },
+      { UINT64_C(14361979211684511743), UINT64_C(16788573164287301039) },
+      { UINT64_C(15809210579574974671), UINT64_C( 3467402994312168275) } },
+    { { UINT64_C( 5931107647902760906), UINT64_C( 5741397582852436042) },
+      { UINT64_C(  714973166895525198), UINT64_C( 2188749418902061055) },
+      { UINT64_C(  954569430164726262), UINT64_C( 4020730612321813617) },
+      { UINT64_C( 5934365656111256803), UINT64_C( 5744917327559767226) } },
+    { { UINT64_C(18446743530761591746), UINT64_C(13319747290995192448) },
+      { UINT64_C( 6372024104165808445), UINT64_C(    2093683603114815) },
+      { UINT64_C(11849807568892933430), UINT64_C(    2330100179068448) },
+      { UINT64_C(     730594838102070), UINT64_C(13320830533943540166) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_madd52hi_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[2];
+    const simde__mmask8 k;
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { { UINT64_C( 3504891273069967389), UINT64_C(12801546653558569468) },
+      UINT8_C(  3),
+      { UINT64_C(16176223793916177650), UINT64_C(15937914525535265067) },
+      { UINT64_C( 2509710403059294928), UINT64_C(    3481826621341408) },
+      { UINT64_C( 3505907701214765345), UINT64_C(12804777559389751009) } },
+    { { UINT64_C( 2344170333682588823), UINT64_C(  496924905485434031) },
+      UINT8_C(  3),
+      { UINT64_C(    3400109274988888), UINT64_C(17076360332438139765) },
+      { UINT64_C(18341231113143132728), UINT64_C( 9353675933422035088) },
+      { UINT64_C( 2346113211736405811), UINT64_C(  499924593910482159) } },
+    { { UINT64_C(18446743179237030256), UINT64_C(11466049022675751049) },
+      UINT8_C(  2),
+      { UINT64_C(     920176810042540), UINT64_C(     265195139401390) },
+      { UINT64_C(18413560970830209605), UINT64_C(12055757220682561765) },
+      { UINT64_C(18446743179237030256), UINT64_C(11466291901415720230) } },
+    { { UINT64_C(18446743673950754516), UINT64_C(18446743206630025248) },
+      UINT8_C(  1),
+      { UINT64_C( 9636232553247077925), UINT64_C( 9453479113893279276) },
+      { UINT64_C( 3155482000494482411), UINT64_C(            58113205) },
+      { UINT64_C(    1994535882278854), UINT64_C(18446743206630025248) } },
+    { { UINT64_C( 1371885659959147546), UINT64_C( 9795717352633464803) },
+      UINT8_C(  0),
+      { UINT64_C(    4503599627370495), UINT64_C(  499899558638125055) },
+      { UINT64_C( 2014987338663494717), UINT64_C(10463472273198281883) },
+      { UINT64_C( 1371885659959147546), UINT64_C( 9795717352633464803) } },
+    { { UINT64_C( 5242774252617019109), UINT64_C( 1572556090410748800) },
+      UINT8_C(  0),
+      { UINT64_C(            53746929), UINT64_C(            35506781) },
+      { UINT64_C(    4503599627370495), UINT64_C(    4052913243627156) },
+      { UINT64_C( 5242774252617019109), UINT64_C( 1572556090410748800) } },
+    { { UINT64_C(18446744066210845205), UINT64_C( 6159218245495297167) },
+      UINT8_C(  0),
+      { UINT64_C( 1405123083739594751), UINT64_C(    1140715706725249) },
+      { UINT64_C(    3474099683888277), UINT64_C( 8669328425604480795) },
+      { UINT64_C(18446744066210845205), UINT64_C( 6159218245495297167) } },
+    { { UINT64_C(18446743488944308896), UINT64_C(18446743569398660692) },
+      UINT8_C(  2),
+      { UINT64_C(            46902930), UINT64_C(     858326577111316) },
+      { UINT64_C( 4593671619917905919), UINT64_C( 4627464046243341634) },
+      { UINT64_C(18446743488944308896), UINT64_C(     431599564081809) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_mask_madd52hi_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[2];
+    const uint64_t b[2];
+    const uint64_t c[2];
+    const uint64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  2),
+      { UINT64_C( 5901927792263142158), UINT64_C( 9173219219645514805) },
+      { UINT64_C(    2545030710479109), UINT64_C(    1037904444775452) },
+      { UINT64_C( 2585020819540624674), UINT64_C( 8128997327403745279) },
+      { UINT64_C(                   0), UINT64_C( 9174257124090290256) } },
+    { UINT8_C(  3),
+      { UINT64_C(12022721192445986597), UINT64_C(14490779743372767644) },
+      { UINT64_C( 4858957885724998314), UINT64_C(    4503599627370495) },
+      { UINT64_C(    1993042671685948), UINT64_C(12542868466548364661) },
+      { UINT64_C(12024525661558014992), UINT64_C(14491123247694300944) } },
+    { UINT8_C(  0),
+      { UINT64_C(18225446395630348273), UINT64_C( 7713040658446841624) },
+      { UINT64_C( 4375614303913089335), UINT64_C(10120173246964016269) },
+      { UINT64_C(    2808062572068280), UINT64_C(11355874397430686856) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  0),
+      { UINT64_C(18446743748537853814), UINT64_C(18446743468706317206) },
+      { UINT64_C(    1779175989870355), UINT64_C( 8882071155254507638) },
+      { UINT64_C(14936870380514437211), UINT64_C(17057365336490386884) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  0),
+      { UINT64_C(14318449972784699232), UINT64_C( 5465607919902651271) },
+      { UINT64_C( 3638908498915360767), UINT64_C(13141454072483782208) },
+      { UINT64_C(14971699109525763077), UINT64_C(    4503599627370495) },
+      { UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  1),
+      { UINT64_C(18446743671153460709), UINT64_C( 6008835180229491911) },
+      { UINT64_C(            37736574), UINT64_C(17581183977207489696) },
+      { UINT64_C( 8764860172238816277), UINT64_C(13749489662362124287) },
+      { UINT64_C(18446743671160627419), UINT64_C(                   0) } },
+    { UINT8_C(  2),
+      { UINT64_C(18446744034822582690), UINT64_C( 6269519682784835833) },
+      { UINT64_C(14298678830011270478), UINT64_C(    1029479859303364) },
+      { UINT64_C(15694088520556145227), UINT64_C( 9084158365194416532) },
+      { UINT64_C(                   0), UINT64_C( 6269610642761953888) } },
+    { UINT8_C(  2),
+      { UINT64_C(18446743667102553918), UINT64_C(13453133951118959158) },
+      { UINT64_C(    4503599627370495), UINT64_C(11704855431535919103) },
+      { UINT64_C( 2322119649383862043), UINT64_C( 5245743227156648520) },
+      { UINT64_C(                   0), UINT64_C(13456687212016350333) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r = simde_mm_maskz_madd52hi_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C(13154672226913251298), UINT64_C( 5762758541448813494), UINT64_C(18446743082345567181), UINT64_C( 8727038597607871198) },
+      { UINT64_C(15555698646134418831), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C( 8957800619974792708) },
+      { UINT64_C(    3517837805781846), UINT64_C(  212987449285679953), UINT64_C(            55145798), UINT64_C(  317375518595697039) },
+      { UINT64_C(13154879639382258224), UINT64_C( 5764076808248080134), UINT64_C(18446743082400712978), UINT64_C( 8727105063833287934) } },
+    { { UINT64_C(  668324561549369388), UINT64_C( 2046542406321275972), UINT64_C(18446743048085185730), UINT64_C(13843881813861927912) },
+      { UINT64_C(    3658055339264719), UINT64_C(10978121600915569585), UINT64_C(17149064670695886719), UINT64_C(            38551170) },
+      { UINT64_C(            67002625), UINT64_C(13949954291996189046), UINT64_C( 5944751508129054719), UINT64_C(     250436666552072) },
+      { UINT64_C(  668324561603792367), UINT64_C( 2048001507516775184), UINT64_C(    3859863672042560), UINT64_C(13843881813864071669) } },
+    { { UINT64_C(18446743996332269327), UINT64_C(18446743121364138878), UINT64_C(18446743703319566637), UINT64_C(18446743818212166691) },
+      { UINT64_C(10779758335468303243), UINT64_C(14810995424499707288), UINT64_C(15319226174480352153), UINT64_C( 2388220104818314765) },
+      { UINT64_C( 8462263699829161983), UINT64_C( 4647714815446351871), UINT64_C(17752515196811835856), UINT64_C(  924730467446768514) },
+      { UINT64_C(    2644349793424025), UINT64_C(    3158897360103701), UINT64_C(    2111449780407261), UINT64_C(     434656326154675) } },
+    { { UINT64_C( 3258210558773822303), UINT64_C(18446743630033469669), UINT64_C(18446743702894108213), UINT64_C( 6085804982391133974) },
+      { UINT64_C(             4740721), UINT64_C(  544935554911830015), UINT64_C(  615229600504600272), UINT64_C( 4345248694379323330) },
+      { UINT64_C(             6012052), UINT64_C(    2442971844194267), UINT64_C( 1899534108314436488), UINT64_C(  816555744383301307) },
+      { UINT64_C( 3258210558773822303), UINT64_C(    2442528168112319), UINT64_C(    2140432878355179), UINT64_C( 6086983157742975984) } },
+    { { UINT64_C(14120807856356534790), UINT64_C(18273981262413388013), UINT64_C(11638550167172095039), UINT64_C( 5477254038905704668) },
+      { UINT64_C(     331887585396889), UINT64_C( 2829301524897920364), UINT64_C(     464724982563018), UINT64_C(  678547376612501463) },
+      { UINT64_C(    3032559407086908), UINT64_C( 1821514565377300430), UINT64_C( 1285613739884063489), UINT64_C(15409854528668805342) },
+      { UINT64_C(14121031337327861350), UINT64_C(18274457482412910483), UINT64_C(11638765611331215898), UINT64_C( 5479284238610965634) } },
+    { { UINT64_C(18446743387788421453), UINT64_C(18135958483546544885), UINT64_C(18446744067670483589), UINT64_C( 3200258782018654153) },
+      { UINT64_C( 5705553048003100904), UINT64_C( 4859383997932765183), UINT64_C( 8984681256604139519), UINT64_C( 1504202275541745663) },
+      { UINT64_C(17248072315662983145), UINT64_C(            63498257), UINT64_C( 8379771736232817735), UINT64_C(            21830677) },
+      { UINT64_C(    3361493144831383), UINT64_C(18135958483610043141), UINT64_C(    3076423284627147), UINT64_C( 3200258782040484829) } },
+    { { UINT64_C(18446744035201672140), UINT64_C(18446743111609746422), UINT64_C(14220279661843730889), UINT64_C(13672085600946555194) },
+      { UINT64_C(            40396839), UINT64_C( 1634088370119304357), UINT64_C(              585777), UINT64_C(    4503599627370495) },
+      { UINT64_C(    2650877431661069), UINT64_C(      50435955998529), UINT64_C( 6625644601196200158), UINT64_C(            27884068) },
+      { UINT64_C(18446744035225450245), UINT64_C(      41429651856042), UINT64_C(14220279661843841388), UINT64_C(13672085600974439261) } },
+    { { UINT64_C(11801078409044374698), UINT64_C(13541894687251687542), UINT64_C(  428458498149251316), UINT64_C(14041058486104217320) },
+      { UINT64_C(            40710158), UINT64_C(11531912132343302862), UINT64_C(18383390585468274532), UINT64_C(    2907384510268359) },
+      { UINT64_C( 2936346957045563391), UINT64_C(15369537681525702875), UINT64_C(    4503599627370495), UINT64_C( 3779476658541333425) },
+      { UINT64_C(11801078409085084855), UINT64_C(13543844471266412664), UINT64_C(  432659004318531671), UINT64_C(14041676018845692274) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_madd52hi_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[4];
+    const simde__mmask8 k;
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { { UINT64_C( 9369502846519088050), UINT64_C( 4688827110985476925), UINT64_C(10870653751042303385), UINT64_C(15006792212594586379) },
+      UINT8_C( 11),
+      { UINT64_C(13263100902606110719), UINT64_C(15555177440781789746), UINT64_C(            20202422), UINT64_C(            17344749) },
+      { UINT64_C(10022524793359139942), UINT64_C(12464461389671791951), UINT64_C( 3994359813274115796), UINT64_C(    1262283098647181) },
+      { UINT64_C( 9371518468978874391), UINT64_C( 4691657950552527152), UINT64_C(10870653751042303385), UINT64_C(15006792212599447819) } },
+    { { UINT64_C(13822360975983552981), UINT64_C( 2325039777281656633), UINT64_C(15923139742426072255), UINT64_C( 2678129855700686588) },
+      UINT8_C( 12),
+      { UINT64_C(    2065974134752539), UINT64_C(14181835226589691903), UINT64_C( 5871367371369844195), UINT64_C(18075451426157993250) },
+      { UINT64_C(16789419410837209087), UINT64_C(            50106023), UINT64_C(17257793772083740671), UINT64_C(    4503599627370495) },
+      { UINT64_C(13822360975983552981), UINT64_C( 2325039777281656633), UINT64_C(15926316799332160161), UINT64_C( 2680635977220879389) } },
+    { { UINT64_C(18446743150261310585), UINT64_C( 5382888350044673195), UINT64_C( 6954497061691499955), UINT64_C(18446743193674524114) },
+      UINT8_C(  8),
+      { UINT64_C( 4592753364365346818), UINT64_C(            44524605), UINT64_C( 9748022915644127891), UINT64_C(    1874957780920636) },
+      { UINT64_C( 6590189150039841290), UINT64_C( 8075226339141795053), UINT64_C(            67098615), UINT64_C(11673330234144325631) },
+      { UINT64_C(18446743150261310585), UINT64_C( 5382888350044673195), UINT64_C( 6954497061691499955), UINT64_C(    1874077745893133) } },
+    { { UINT64_C( 7982452742498012540), UINT64_C( 5902381226517719502), UINT64_C(18446743634997630524), UINT64_C( 7013803750327744112) },
+      UINT8_C(  9),
+      { UINT64_C(11988246862198655490), UINT64_C(    4503599627370495), UINT64_C( 5764607523034234879), UINT64_C( 4197354852709302271) },
+      { UINT64_C(10891547345518743011), UINT64_C(            62248811), UINT64_C(14334159299082798769), UINT64_C(            31867310) },
+      { UINT64_C( 7984158922799355054), UINT64_C( 5902381226517719502), UINT64_C(18446743634997630524), UINT64_C( 7013803750359611421) } },
+    { { UINT64_C( 6217071947942134268), UINT64_C( 1215459035515469762), UINT64_C( 8989320771230778589), UINT64_C(  104357423094692349) },
+      UINT8_C( 14),
+      { UINT64_C(11623790638243250175), UINT64_C(  934950930143735431), UINT64_C(14039722679726905254), UINT64_C( 8849573267783024639) },
+      { UINT64_C(     627278796386114), UINT64_C(14262900019882360831), UINT64_C(17994863890263086571), UINT64_C(11157946054836177274) },
+      { UINT64_C( 6217071947942134268), UINT64_C( 1218164842793512520), UINT64_C( 8990647407270756023), UINT64_C(  106887200934151030) } },
+    { { UINT64_C(17385306417196882741), UINT64_C(17540435186502050169), UINT64_C(10923538668857651145), UINT64_C(18446743245388576794) },
+      UINT8_C( 10),
+      { UINT64_C( 7540039329214454410), UINT64_C( 2247296214057877503), UINT64_C( 7776550755201956938), UINT64_C(10567470715076770213) },
+      { UINT64_C( 5812522667403252646), UINT64_C(            50633110), UINT64_C( 1033996350210042258), UINT64_C(             1584350) },
+      { UINT64_C(17385306417196882741), UINT64_C(17540435186552683278), UINT64_C(10923538668857651145), UINT64_C(18446743245389289529) } },
+    { { UINT64_C(13502111104487754181), UINT64_C(18446743180217511295), UINT64_C(18107316962041196094), UINT64_C( 5622439223456179196) },
+      UINT8_C( 12),
+      { UINT64_C(            20677015), UINT64_C(10394462978739509110), UINT64_C( 4444312423633881555), UINT64_C( 3754387827954295936) },
+      { UINT64_C( 2963368554809786367), UINT64_C(            66176448), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495) },
+      { UINT64_C(13502111104487754181), UINT64_C(18446743180217511295), UINT64_C(18111080153087768592), UINT64_C( 5625328561810851963) } },
+    { { UINT64_C( 1374298091767709912), UINT64_C(15018981166859516503), UINT64_C( 2206737495603427885), UINT64_C(12642024466140258756) },
+      UINT8_C(  7),
+      { UINT64_C(             1265071), UINT64_C(            47581730), UINT64_C( 7358881791123390463), UINT64_C(    4503599627370495) },
+      { UINT64_C(    1347187325159900), UINT64_C(15019142911841382651), UINT64_C(    2175146162560336), UINT64_C(11137298678633425415) },
+      { UINT64_C( 1374298091768088339), UINT64_C(15018981166903275239), UINT64_C( 2208912641765988220), UINT64_C(12642024466140258756) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_mask_madd52hi_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[4];
+    const uint64_t b[4];
+    const uint64_t c[4];
+    const uint64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  3),
+      { UINT64_C(18446743859914716233), UINT64_C(18446743210642360664), UINT64_C(13734393471526313004), UINT64_C( 2608966917132988904) },
+      { UINT64_C(17678226251302872428), UINT64_C(    3200812446734355), UINT64_C(15342127177181105401), UINT64_C(    4503599627370495) },
+      { UINT64_C(             1462492), UINT64_C( 6249611215145770894), UINT64_C(            57424625), UINT64_C(  305830753600561785) },
+      { UINT64_C(18446743859915235072), UINT64_C(    2215549760831898), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(  0),
+      { UINT64_C(15935025478738018245), UINT64_C(18446742982682546118), UINT64_C(14087456878677817972), UINT64_C(11100570713189363281) },
+      { UINT64_C(    4503599627370495), UINT64_C(14063011800408291595), UINT64_C(14946282264103045675), UINT64_C(12858706354807098186) },
+      { UINT64_C(    2471442464421250), UINT64_C( 6723874243664150527), UINT64_C(    4503599627370495), UINT64_C( 1029452630689624614) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C( 13),
+      { UINT64_C(18065816101365048008), UINT64_C(18446743916637274549), UINT64_C(18446743642081043194), UINT64_C( 4461089106606844494) },
+      { UINT64_C(11173233017060733528), UINT64_C(  587967934935083164), UINT64_C( 9555782255016548878), UINT64_C(18202384410795186575) },
+      { UINT64_C(14040878420881493459), UINT64_C( 6758806661065746878), UINT64_C( 9555772242280160356), UINT64_C(15743477763591154405) },
+      { UINT64_C(18068835865516026569), UINT64_C(                   0), UINT64_C(    2945508923538476), UINT64_C( 4463607199354299794) } },
+    { UINT8_C(  0),
+      { UINT64_C(18446743235515168211), UINT64_C(10077933309799125603), UINT64_C(  886645097119222283), UINT64_C(18011955495386336757) },
+      { UINT64_C(11295027865445203967), UINT64_C( 2679508447113726922), UINT64_C(            19398389), UINT64_C(13221582519215892456) },
+      { UINT64_C( 1774418253183975423), UINT64_C( 5898937605391066316), UINT64_C(             2457729), UINT64_C(14321446815038177279) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C( 14),
+      { UINT64_C( 9237724514571940318), UINT64_C(18446743740927404047), UINT64_C(18446743032946822204), UINT64_C( 9522401734082443694) },
+      { UINT64_C(    2034426758991951), UINT64_C(13470672590495082368), UINT64_C(17892350934616937273), UINT64_C(    4503599627370495) },
+      { UINT64_C( 7376896189632872447), UINT64_C(            61221255), UINT64_C( 6672383052108721692), UINT64_C( 2958940353892148154) },
+      { UINT64_C(                   0), UINT64_C(18446743740932924577), UINT64_C(    2295748667310956), UINT64_C( 9522477132792175975) } },
+    { UINT8_C( 12),
+      { UINT64_C( 6975151312113451037), UINT64_C(11358729228618415375), UINT64_C(16814581105378833622), UINT64_C(18446743860957462747) },
+      { UINT64_C(             6955353), UINT64_C(14160160865188757996), UINT64_C(  738590338888761343), UINT64_C(12195073176372459679) },
+      { UINT64_C(    1453903892084185), UINT64_C( 9161367059190136048), UINT64_C( 2024182990702664512), UINT64_C(     301365578759855) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(16816647863392145429), UINT64_C(     256009914296244) } },
+    { UINT8_C(  9),
+      { UINT64_C( 5147282797218404919), UINT64_C( 8102620230187735082), UINT64_C(14636696408170255242), UINT64_C( 3769386962841502189) },
+      { UINT64_C( 7953356941936295935), UINT64_C(    4218644439661518), UINT64_C(             9265675), UINT64_C(    1874065388718379) },
+      { UINT64_C( 3958664072458665983), UINT64_C(15659015904367214591), UINT64_C(11378715455785801137), UINT64_C(            19607562) },
+      { UINT64_C( 5151786396845775413), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 3769386962849661407) } },
+    { UINT8_C(  9),
+      { UINT64_C(17870230184573388916), UINT64_C(18446742981614133571), UINT64_C(18446743015712940510), UINT64_C(18446743610562042740) },
+      { UINT64_C(    4503599627370495), UINT64_C( 3162118150703677873), UINT64_C(    4503599627370495), UINT64_C(15409014503046315538) },
+      { UINT64_C(            59128837), UINT64_C(12979374126081769471), UINT64_C( 7835155888542570342), UINT64_C( 8252670008092229628) },
+      { UINT64_C(17870230184632517752), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(    1013492149039426) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r = simde_mm256_maskz_madd52hi_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C( 6600637820969240153), UINT64_C( 7489706056787693272), UINT64_C( 6604034809127797387), UINT64_C(18446743285832524998),
+        UINT64_C(18446743334870458708), UINT64_C(18446743847367814579), UINT64_C(18446743646988626950), UINT64_C( 4393993213072176340) },
+      { UINT64_C( 3191375411701504340), UINT64_C( 5787758241577107030), UINT64_C(    4503599627370495), UINT64_C( 6193871889341782631),
+        UINT64_C(    4503599627370495), UINT64_C( 6297781998132025304), UINT64_C(14654094015792808793), UINT64_C( 7187745005283311615) },
+      { UINT64_C(    2277058043570849), UINT64_C(            55873491), UINT64_C( 5726430719448858034), UINT64_C( 5814089193108934816),
+        UINT64_C(11899887053618856305), UINT64_C( 1924085706531240388), UINT64_C( 3534047324871032775), UINT64_C( 3128286512292163552) },
+      { UINT64_C( 6602067113131256538), UINT64_C( 7489706056795543059), UINT64_C( 6606390402188755004), UINT64_C(    1403318732812349),
+        UINT64_C(    1376099266912964), UINT64_C(     407196703210132), UINT64_C(    2781375429852345), UINT64_C( 4396781583969215667) } },
+    { { UINT64_C( 2926475218136968525), UINT64_C( 7296090612727966007), UINT64_C(18446743428964371806), UINT64_C(16111976574488890218),
+        UINT64_C(18446743823451294575), UINT64_C(17039788366780009863), UINT64_C(18446743152379597431), UINT64_C(18446743982313724789) },
+      { UINT64_C(     512250038647195), UINT64_C( 4317477042705907778), UINT64_C(12077313592652176551), UINT64_C(    4503599627370495),
+        UINT64_C( 3954160472831295487), UINT64_C( 8833421629226229183), UINT64_C(15676595238996407738), UINT64_C(    2006163479091475) },
+      { UINT64_C( 8295810488076511408), UINT64_C(    4503599627370495), UINT64_C(   76279578285403264), UINT64_C(    2358057131619059),
+        UINT64_C(             6876828), UINT64_C(10625609636870775949), UINT64_C(    4503599627370495), UINT64_C( 2386907802506362879) },
+      { UINT64_C( 2926495688856337051), UINT64_C( 7299119212412938616), UINT64_C(    2964561338504946), UINT64_C(16114334631620509276),
+        UINT64_C(18446743823458171402), UINT64_C(17040457645080425469), UINT64_C(    4067614417127472), UINT64_C(    2006072083264647) } },
+    { { UINT64_C(18446743540661042661), UINT64_C(16892046345449146437), UINT64_C( 1127809735206042123), UINT64_C(12849544484972614306),
+        UINT64_C( 5777305243440030936), UINT64_C(14769973713611499863), UINT64_C( 9275864034118407997), UINT64_C(18446743810060155600) },
+      { UINT64_C(17127403750483907968), UINT64_C(14497087200505626623), UINT64_C(    1345271462840258), UINT64_C( 6247748481081362344),
+        UINT64_C(    4503599627370495), UINT64_C(    3202140923089237), UINT64_C(14939827380625468827), UINT64_C(12870651019898999204) },
+      { UINT64_C(            20748428), UINT64_C(10871686699521620726), UINT64_C( 3291892481211969439), UINT64_C( 5837721633817187101),
+        UINT64_C(14767303178147856383), UINT64_C( 2710253538382524055), UINT64_C( 7587489966133980702), UINT64_C(    4503599627370495) },
+      { UINT64_C(18446743540662030268), UINT64_C(16896547144125760314), UINT64_C( 1129083660797370145), UINT64_C(12849839087432651380),
+        UINT64_C( 5781808843067401430), UINT64_C(14772526384070193333), UINT64_C( 9276920152177123075), UINT64_C(    3866620852096115) } },
+    { { UINT64_C(18446743267951223133), UINT64_C(10934469014345970709), UINT64_C( 2421165789570762744), UINT64_C(18446743066500152335),
+        UINT64_C( 6456172040804793099), UINT64_C( 2239235297988330358), UINT64_C(17388204801334839898), UINT64_C( 7297148405934006513) },
+      { UINT64_C(13726362748555554277), UINT64_C(    4503599627370495), UINT64_C(17118182183635255295), UINT64_C( 7318349394477055999),
+        UINT64_C(15896310424544584034), UINT64_C( 7502996979199246335), UINT64_C(11762927282385193717), UINT64_C( 2309676775008671554) },
+      { UINT64_C( 1403035150324913060), UINT64_C(             9535802), UINT64_C(            15619830), UINT64_C(14483113787459652349),
+        UINT64_C( 5682081122664623712), UINT64_C(  601781124100165902), UINT64_C( 6091137421637905693), UINT64_C(18266287343136348045) },
+      { UINT64_C(    2088246827168898), UINT64_C(10934469014355506510), UINT64_C( 2421165789586382573), UINT64_C(    4039978254108427),
+        UINT64_C( 6458270918271117379), UINT64_C( 2242037671648220291), UINT64_C(17390236058741066720), UINT64_C( 7300715941820296271) } },
+    { { UINT64_C( 2201951295864904204), UINT64_C(18446743850593191572), UINT64_C(18446743036968058597), UINT64_C(18446743292294899284),
+        UINT64_C(18446743896903735588), UINT64_C(13403477894220209276), UINT64_C(16961559119644954128), UINT64_C(18446743759988012232) },
+      { UINT64_C( 9540415097597937970), UINT64_C( 5737585925270011903), UINT64_C(            50699842), UINT64_C(12142150254912765600),
+        UINT64_C(15418973353755405313), UINT64_C( 1531223873305968639), UINT64_C( 6264128849506747853), UINT64_C(    4503599627370495) },
+      { UINT64_C( 4766436878482449646), UINT64_C(    1754202120105789), UINT64_C(    2950849623188144), UINT64_C(  410235415309088505),
+        UINT64_C(12026240663945821695), UINT64_C(            63472992), UINT64_C(            51264307), UINT64_C( 5109914770007105631) },
+      { UINT64_C( 2202598941367750826), UINT64_C(    1753979003745744), UINT64_C(18446743037001278159), UINT64_C(      39577831885999),
+        UINT64_C(    1140334548355755), UINT64_C(13403477894283682267), UINT64_C(16961559119691913032), UINT64_C(    2832478847423782) } },
+    { { UINT64_C(15657726606494569806), UINT64_C(18446743843546016705), UINT64_C( 6655983255387618965), UINT64_C(18446743827146766681),
+        UINT64_C( 9509605551507948048), UINT64_C( 4876474619642913610), UINT64_C(18446743391091311768), UINT64_C(18446743625557808921) },
+      { UINT64_C( 1822715697750535153), UINT64_C( 2267406301925414128), UINT64_C(15725743997407271789), UINT64_C(            58042532),
+        UINT64_C( 7599421010143365901), UINT64_C( 7826249456792097058), UINT64_C(            46227354), UINT64_C(    4503599627370495) },
+      { UINT64_C(10096192340002421738), UINT64_C( 6813306344396700671), UINT64_C( 1621295865853378559), UINT64_C( 5480267617464759736),
+        UINT64_C( 5780966763072563341), UINT64_C(     275743672867411), UINT64_C(    4086190674341334), UINT64_C(    2309260570422998) },
+      { UINT64_C(15660352200815822190), UINT64_C(    1797694167060820), UINT64_C( 6659660953644489217), UINT64_C(18446743827196907186),
+        UINT64_C( 9510774653892923340), UINT64_C( 4876688725968091009), UINT64_C(18446743391133254613), UINT64_C(    2308812418680302) } },
+    { { UINT64_C( 9009538614676942680), UINT64_C(18446743966142857835), UINT64_C(   91797578434156705), UINT64_C(12059544048688676165),
+        UINT64_C(18446743298541624610), UINT64_C(18446743937826682512), UINT64_C(18446743417906521965), UINT64_C(15968592487758312685) },
+      { UINT64_C(    4503599627370495), UINT64_C(              882605), UINT64_C(15174328316428210223), UINT64_C( 3247750851232099819),
+        UINT64_C(17842245199940190010), UINT64_C(     282777738991028), UINT64_C(    4503599627370495), UINT64_C(13086573195774103866) },
+      { UINT64_C(    3910405340573520), UINT64_C( 3284030026435109135), UINT64_C(    4503599627370495), UINT64_C(  856813192221010306),
+        UINT64_C(            47710865), UINT64_C(15997162281192839198), UINT64_C(10299732347796324351), UINT64_C(    1386095497959918) },
+      { UINT64_C( 9013449020017516199), UINT64_C(18446743966143035370), UINT64_C(   93498750251165903), UINT64_C(12059708418180040173),
+        UINT64_C(18446743298578566483), UINT64_C(      23498298544695), UINT64_C(    4502943824340843), UINT64_C(15969705487899131603) } },
+    { { UINT64_C(  695252660548148408), UINT64_C( 7306043404870953201), UINT64_C(16174811467097282216), UINT64_C( 9928264206376098083),
+        UINT64_C(18446743320806932446), UINT64_C(18446743842948170421), UINT64_C( 7520763108224664678), UINT64_C(11112783321648225085) },
+      { UINT64_C( 5183087980912359825), UINT64_C(    3057837783234092), UINT64_C(16208273764520900007), UINT64_C(    2713037882178674),
+        UINT64_C( 7978783765904337774), UINT64_C(10759712658573949582), UINT64_C(    4503599627370495), UINT64_C(     631016852309615) },
+      { UINT64_C(     707024596278930), UINT64_C( 4161326055690338303), UINT64_C(            27244702), UINT64_C(18327724204550868800),
+        UINT64_C(    4503599627370495), UINT64_C( 6294275523649510120), UINT64_C( 3141666799028445095), UINT64_C(    4503599627370495) },
+      { UINT64_C(  695872525282719936), UINT64_C( 7309101242654187292), UINT64_C(16174811467123430170), UINT64_C( 9929816824168550170),
+        UINT64_C(    2908072928570187), UINT64_C(     373742134388090), UINT64_C( 7523420966975874060), UINT64_C(11113414338500534699) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_madd52hi_epu64(a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const simde__mmask8 k;
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { { UINT64_C( 2173875772782331569), UINT64_C( 3231489769553692913), UINT64_C( 7082811979224781589), UINT64_C(18446743767928281644),
+        UINT64_C(18446743141796400650), UINT64_C( 8309675711753082802), UINT64_C( 4191853427582454607), UINT64_C( 8887748779870574302) },
+      UINT8_C(193),
+      { UINT64_C( 1233986297899515903), UINT64_C(15984938709753607758), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495),
+        UINT64_C(    2325253441777504), UINT64_C( 2958864955182415871), UINT64_C( 3251598930961498111), UINT64_C(     636656832793136) },
+      { UINT64_C(            54906101), UINT64_C( 3248979302686759321), UINT64_C( 3569133775480956999), UINT64_C( 2215771016666284031),
+        UINT64_C(13010899323473362943), UINT64_C(14587122133726948938), UINT64_C(            59287873), UINT64_C(12436852121558489183) },
+      { UINT64_C( 2173875772837237669), UINT64_C( 3231489769553692913), UINT64_C( 7082811979224781589), UINT64_C(18446743767928281644),
+        UINT64_C(18446743141796400650), UINT64_C( 8309675711753082802), UINT64_C( 4191853427641742479), UINT64_C( 8888089974353499038) } },
+    { { UINT64_C(12789028315246680426), UINT64_C(13508862112075444361), UINT64_C(11731603376521738619), UINT64_C(18446743233704087085),
+        UINT64_C( 5290513403960044433), UINT64_C(17452374936854114659), UINT64_C( 2832890511312386585), UINT64_C(16683959132638263153) },
+      UINT8_C( 20),
+      { UINT64_C(    4503599627370495), UINT64_C( 4003700068732370943), UINT64_C(17161856181725329802), UINT64_C( 4917930793088581631),
+        UINT64_C(16998900395009336120), UINT64_C(    3577979354257001), UINT64_C(            30824386), UINT64_C( 7979447431818987109) },
+      { UINT64_C(    1026577311984945), UINT64_C( 8595747679186527826), UINT64_C(            19071775), UINT64_C( 5687859497356050663),
+        UINT64_C(     194958167827046), UINT64_C(    4503599627370495), UINT64_C(10879062328811295554), UINT64_C( 9040959232794061835) },
+      { UINT64_C(12789028315246680426), UINT64_C(13508862112075444361), UINT64_C(11731603376535042624), UINT64_C(18446743233704087085),
+        UINT64_C( 5290613636315300843), UINT64_C(17452374936854114659), UINT64_C( 2832890511312386585), UINT64_C(16683959132638263153) } },
+    { { UINT64_C( 8564677812847868649), UINT64_C( 2249049632505957528), UINT64_C( 2201338530932524231), UINT64_C(18446743283754161140),
+        UINT64_C( 3133994159187327746), UINT64_C( 6387263850558159943), UINT64_C(14074188161336097962), UINT64_C(18446744061859824767) },
+      UINT8_C( 75),
+      { UINT64_C(            60253409), UINT64_C(16802930209719320575), UINT64_C(10210116954805082693), UINT64_C( 8228076519205896191),
+        UINT64_C(12650760352497439796), UINT64_C(15572076859038412316), UINT64_C( 9147218481721136516), UINT64_C(10642469183820216185) },
+      { UINT64_C(13062331898418485132), UINT64_C( 3691982322225058384), UINT64_C( 8930638061075693567), UINT64_C(    3220684695184566),
+        UINT64_C( 3071740473116480259), UINT64_C(16762397813072986111), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495) },
+      { UINT64_C( 8564677812873194710), UINT64_C( 2252583859914579687), UINT64_C( 2201338530932524231), UINT64_C(    3219894739794089),
+        UINT64_C( 3133994159187327746), UINT64_C( 6387263850558159943), UINT64_C(14074595799867757101), UINT64_C(18446744061859824767) } },
+    { { UINT64_C(18446743727467510286), UINT64_C(11470184169332885037), UINT64_C(17476948742289769843), UINT64_C(12003264536309823663),
+        UINT64_C( 7388464105460091869), UINT64_C(18446744005215744441), UINT64_C(13707003513895947360), UINT64_C( 3547978438083604690) },
+      UINT8_C(209),
+      { UINT64_C( 3882102878793367551), UINT64_C( 8845069668155654143), UINT64_C( 6182236813672842392), UINT64_C(13510798882111487999),
+        UINT64_C( 5390808753962483711), UINT64_C(            11136693), UINT64_C(            46901079), UINT64_C( 9070288713674041475) },
+      { UINT64_C( 9492198843505514863), UINT64_C(    4503599627370495), UINT64_C( 2712824009308830373), UINT64_C(    4503599627370495),
+        UINT64_C(    4503599627370495), UINT64_C(            28877225), UINT64_C(16721624732006156292), UINT64_C(10756659349115964951) },
+      { UINT64_C(    3114082393838460), UINT64_C(11470184169332885037), UINT64_C(17476948742289769843), UINT64_C(12003264536309823663),
+        UINT64_C( 7392967705087462363), UINT64_C(18446744005215744441), UINT64_C(13707003513940341919), UINT64_C( 3547996336319515589) } },
+    { { UINT64_C(18446744055825315614), UINT64_C(18446743411105553768), UINT64_C( 9038099638649262306), UINT64_C(15009729340940083828),
+        UINT64_C( 1342202456939899154), UINT64_C( 4351701327042905377), UINT64_C(10507230392654903173), UINT64_C(18446743629438356765) },
+      UINT8_C( 81),
+      { UINT64_C(12488481766698385407), UINT64_C( 3718131303738601911), UINT64_C(11870224207335071041), UINT64_C( 9043939881060476596),
+        UINT64_C( 8270600570063567659), UINT64_C(12551532161481572351), UINT64_C(            25830174), UINT64_C( 1140657086629645947) },
+      { UINT64_C(11395164054251689885), UINT64_C(    1113523263205016), UINT64_C(13707981179532601211), UINT64_C(14528612397897220095),
+        UINT64_C(    1967322236688268), UINT64_C(    4503599627370495), UINT64_C(             9936317), UINT64_C(            40711032) },
+      { UINT64_C(    1056979120099002), UINT64_C(18446743411105553768), UINT64_C( 9038099638649262306), UINT64_C(15009729340940083828),
+        UINT64_C( 1343072477799201170), UINT64_C( 4351701327042905377), UINT64_C(10507230392654903173), UINT64_C(18446743629438356765) } },
+    { { UINT64_C(18446744044472957566), UINT64_C( 6560911847933933352), UINT64_C(18251481733263883809), UINT64_C( 3913368025830868118),
+        UINT64_C(16110618054483389717), UINT64_C(18180379346813428028), UINT64_C(11946478679360084549), UINT64_C(18446743061139226689) },
+      UINT8_C(233),
+      { UINT64_C(    4404734860244283), UINT64_C( 3102270541353480255), UINT64_C(    1280084920125748), UINT64_C(15559924760218961001),
+        UINT64_C(14023564526696155071), UINT64_C( 4192532724030102290), UINT64_C( 4118844227836414366), UINT64_C(             8632247) },
+      { UINT64_C(    4503599627370495), UINT64_C( 8419083545365711142), UINT64_C( 2773492783239018697), UINT64_C( 5169660398558417520),
+        UINT64_C( 8390719751008116456), UINT64_C(    4503599627370495), UINT64_C(            21086952), UINT64_C(    4503599627370495) },
+      { UINT64_C(    4404705623650232), UINT64_C( 6560911847933933352), UINT64_C(18251481733263883809), UINT64_C( 3917388952045599663),
+        UINT64_C(16110618054483389717), UINT64_C(18184564417388969037), UINT64_C(11946478679372043788), UINT64_C(18446743061147858935) } },
+    { { UINT64_C(18446743036909551654), UINT64_C( 2273762760105464424), UINT64_C(10712500334501409033), UINT64_C(13333301991473452768),
+        UINT64_C(  100286050022846704), UINT64_C(18446743568702812488), UINT64_C(18446743681938617646), UINT64_C(18446743616742193944) },
+      UINT8_C( 17),
+      { UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C( 8402541813586843029), UINT64_C(14248533268448671283),
+        UINT64_C(            31442969), UINT64_C(    4503599627370495), UINT64_C(            59984093), UINT64_C(    4503599627370495) },
+      { UINT64_C(15012018078578985158), UINT64_C(    1971999432536420), UINT64_C(16720790790327461426), UINT64_C( 6764134009639994533),
+        UINT64_C(  409827566090715135), UINT64_C(15873919861178735165), UINT64_C(    3774920496699164), UINT64_C(     289798773824692) },
+      { UINT64_C(    1519483753122027), UINT64_C( 2273762760105464424), UINT64_C(10712500334501409033), UINT64_C(13333301991473452768),
+        UINT64_C(  100286050054289672), UINT64_C(18446743568702812488), UINT64_C(18446743681938617646), UINT64_C(18446743616742193944) } },
+    { { UINT64_C( 9644471044282777733), UINT64_C( 7602270369481069645), UINT64_C(18446743744805655098), UINT64_C(12493559550515200306),
+        UINT64_C( 2740486651341612223), UINT64_C(18446744028276257275), UINT64_C(12200305184599247778), UINT64_C( 1982110270165818256) },
+      UINT8_C(170),
+      { UINT64_C(10907718297491341311), UINT64_C( 7404805331517679566), UINT64_C(14879893168832118783), UINT64_C(            29305593),
+        UINT64_C( 1076030770198528037), UINT64_C(    2519903276340531), UINT64_C(            38388379), UINT64_C(    1677802021064103) },
+      { UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C(15019504757280604159), UINT64_C(            27044461),
+        UINT64_C( 7177548064395021793), UINT64_C(            28878460), UINT64_C(14711322152804205187), UINT64_C(15913963548932620880) },
+      { UINT64_C( 9644471044282777733), UINT64_C( 7603157913601653786), UINT64_C(18446743744805655098), UINT64_C(12493559550515200306),
+        UINT64_C( 2740486651341612223), UINT64_C(18446744028292415666), UINT64_C(12200305184599247778), UINT64_C( 1983133308294005242) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_mask_madd52hi_epu64(a, test_vec[i].k, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_madd52hi_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t b[8];
+    const uint64_t c[8];
+    const uint64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(242),
+      { UINT64_C(18446743734525672916), UINT64_C( 7758323351889350873), UINT64_C(12890377568141471685), UINT64_C(12888156924394873335),
+        UINT64_C(18446743869987394192), UINT64_C(14064237375915635337), UINT64_C( 5279932704290477085), UINT64_C(18446743241500328891) },
+      { UINT64_C( 6601016173892236908), UINT64_C(    4503599627370495), UINT64_C( 9262147906480621818), UINT64_C(14106313441057597505),
+        UINT64_C( 1806272964348096677), UINT64_C(    4503599627370495), UINT64_C( 2253684627738382454), UINT64_C(    4503599627370495) },
+      { UINT64_C(    1505642377601195), UINT64_C(    3506833886802920), UINT64_C( 4794727897997368521), UINT64_C(13692363756619092610),
+        UINT64_C( 9085764547459566803), UINT64_C(14080548077454206939), UINT64_C(11216547901338671561), UINT64_C( 1278983663702799084) },
+      { UINT64_C(                   0), UINT64_C( 7761830185776153792), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C(     146429703147752), UINT64_C(14066533018209671779), UINT64_C( 5281014488369455429), UINT64_C(    4464136947725990) } },
+    { UINT8_C(204),
+      { UINT64_C(18446743193387721201), UINT64_C(13964060486281677291), UINT64_C(11707854980090713675), UINT64_C(18446743718219496424),
+        UINT64_C(18081973023881885807), UINT64_C(18446744068043555740), UINT64_C( 1357256540468271641), UINT64_C(13296148483794713658) },
+      { UINT64_C(              904261), UINT64_C( 2515909160195738976), UINT64_C(17107125723254446992), UINT64_C( 5360235165543231332),
+        UINT64_C( 7973197591120261676), UINT64_C(    4363375521775562), UINT64_C(            38575055), UINT64_C(    4503599627370495) },
+      { UINT64_C(13707897662836316225), UINT64_C(    4249223244306560), UINT64_C( 7728176960567771135), UINT64_C(    4503599627370495),
+        UINT64_C(11425429340238225895), UINT64_C(  173050619276865752), UINT64_C(            16702912), UINT64_C(  507824748619363070) },
+      { UINT64_C(                   0), UINT64_C(                   0), UINT64_C(11710309318592016858), UINT64_C(     951253482285899),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 1357256540468271641), UINT64_C(13299570074148581175) } },
+    { UINT8_C( 87),
+      { UINT64_C( 8213445838514904593), UINT64_C(15527720408968375292), UINT64_C(18446743724118586397), UINT64_C(18446743617952798020),
+        UINT64_C(17676517444159984063), UINT64_C(15301749567032688307), UINT64_C(18446743895818832339), UINT64_C(11126195490995882872) },
+      { UINT64_C( 8920311112789588302), UINT64_C(    1126067379880093), UINT64_C( 8856477500579430433), UINT64_C(18356764128845339413),
+        UINT64_C( 8673932882315575295), UINT64_C( 5132856186639228799), UINT64_C( 7746476622861232775), UINT64_C(    4503599627370495) },
+      { UINT64_C(            18649258), UINT64_C(    1374184310591267), UINT64_C(    2843595694466986), UINT64_C(16623068762876107384),
+        UINT64_C(    4439381812883127), UINT64_C(    4503599627370495), UINT64_C(12470946922805473035), UINT64_C(13604599623044858677) },
+      { UINT64_C( 8213445838528088813), UINT64_C(15528064006147106592), UINT64_C(    1515422393288437), UINT64_C(                   0),
+        UINT64_C(17680956825972867189), UINT64_C(                   0), UINT64_C(      30197714544602), UINT64_C(                   0) } },
+    { UINT8_C( 26),
+      { UINT64_C( 9296501847799074240), UINT64_C(18446743050261170804), UINT64_C(18446743905273544735), UINT64_C( 6657177252402191803),
+        UINT64_C(18446743353861538788), UINT64_C(18446743429879685358), UINT64_C(   93702571966442698), UINT64_C( 3692636937322163685) },
+      { UINT64_C( 8227272330470434418), UINT64_C( 7981042267471876701), UINT64_C(14976835478393764649), UINT64_C(             5261965),
+        UINT64_C( 9118434045993545799), UINT64_C( 5207928525102610729), UINT64_C(             8531222), UINT64_C(            33268920) },
+      { UINT64_C(15535129912306440822), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495), UINT64_C(14875907676522341927),
+        UINT64_C(12827239758606541294), UINT64_C(            19512297), UINT64_C( 1463669878895411199), UINT64_C( 1933956835807150280) },
+      { UINT64_C(                   0), UINT64_C(     662704322976976), UINT64_C(                   0), UINT64_C( 6657177252402797154),
+        UINT64_C(     689990286843638), UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0) } },
+    { UINT8_C(133),
+      { UINT64_C(14890449631358543106), UINT64_C( 2966556729755684465), UINT64_C(12325049605495740551), UINT64_C(16391320111146744510),
+        UINT64_C(13671178359775990520), UINT64_C(11783994391549231584), UINT64_C(18446743777217540198), UINT64_C( 4045899321806223772) },
+      { UINT64_C( 3039544337386209076), UINT64_C(    3097749942665212), UINT64_C(    4503599627370495), UINT64_C( 2346729175616840884),
+        UINT64_C( 5381516894754555076), UINT64_C( 9740761170318765255), UINT64_C( 3758667293013672122), UINT64_C(      47443655805897) },
+      { UINT64_C(    1319563029304159), UINT64_C(            54100607), UINT64_C(    4503599627370495), UINT64_C(13979905907819710465),
+        UINT64_C( 6286471880231027635), UINT64_C(    4503599627370495), UINT64_C( 2550306553345235698), UINT64_C(    4503599627370495) },
+      { UINT64_C(14891656268225212065), UINT64_C(                   0), UINT64_C(12329553205123111045), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 4045946765462029668) } },
+    { UINT8_C(163),
+      { UINT64_C(10111777219562261267), UINT64_C(17590607913499373054), UINT64_C(13653959150756305422), UINT64_C(15986268597220952305),
+        UINT64_C(17562705807504779164), UINT64_C(13320735472351493738), UINT64_C(11382749597942502267), UINT64_C(18446743693004243595) },
+      { UINT64_C(13909565974418640577), UINT64_C(13257130363116912755), UINT64_C(    4503599627370495), UINT64_C(15226670340139646975),
+        UINT64_C( 6595758481646778105), UINT64_C(15162045326250479474), UINT64_C(    4503599627370495), UINT64_C(    4503599627370495) },
+      { UINT64_C(    4503599627370495), UINT64_C( 4664810548409213574), UINT64_C(             8347262), UINT64_C(11721035524660108383),
+        UINT64_C( 5858485621659477943), UINT64_C( 5786507923749610443), UINT64_C(            36273564), UINT64_C(    1086552893285989) },
+      { UINT64_C(10114227544660810195), UINT64_C(17593025141047527520), UINT64_C(                   0), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(13323262789544160399), UINT64_C(                   0), UINT64_C(    1086172187977967) } },
+    { UINT8_C(229),
+      { UINT64_C(18446743182530889385), UINT64_C(17456685060552949788), UINT64_C(18446743447040048543), UINT64_C( 5262225023777225157),
+        UINT64_C( 4250908530573543300), UINT64_C(  767096614065797742), UINT64_C( 6820830355988351799), UINT64_C(18446743569202321324) },
+      { UINT64_C(            34822740), UINT64_C(            32142618), UINT64_C(12468269400511728536), UINT64_C(            21959893),
+        UINT64_C(16541721431331831807), UINT64_C(11001704908244485899), UINT64_C(14487909363952195737), UINT64_C(10496174791385597594) },
+      { UINT64_C( 5197101191304538971), UINT64_C(    4503599627370495), UINT64_C( 5738261444815799213), UINT64_C(    4503599627370495),
+        UINT64_C(            43541978), UINT64_C(17140700181772107775), UINT64_C(    4503599627370495), UINT64_C(     204724180939975) },
+      { UINT64_C(18446743182565304029), UINT64_C(                   0), UINT64_C(     345207680043273), UINT64_C(                   0),
+        UINT64_C(                   0), UINT64_C(  771011232271532408), UINT64_C( 6825163318317032399), UINT64_C(     126216644314291) } },
+    { UINT8_C(169),
+      { UINT64_C(12491439771990054641), UINT64_C(11688671210056301436), UINT64_C( 6514050943604672224), UINT64_C( 8557754566303095779),
+        UINT64_C( 5190443794228312975), UINT64_C(18446743544486312985), UINT64_C(18446743545498906187), UINT64_C(10210123197825581359) },
+      { UINT64_C(    1253442164578341), UINT64_C( 1222164052083043109), UINT64_C( 6434562544983581141), UINT64_C( 3075958545494048767),
+        UINT64_C( 1382605085602742271), UINT64_C(            29749656), UINT64_C(    4503599627370495), UINT64_C(   37009331603497205) },
+      { UINT64_C(    4503599627370495), UINT64_C( 5065217527923037823), UINT64_C( 5003390661395302432), UINT64_C(15549257990430726765),
+        UINT64_C(11986079729967155109), UINT64_C(13359208455201198020), UINT64_C(    4503599627370495), UINT64_C(13492784483602006015) },
+      { UINT64_C(12492693214154632981), UINT64_C(                   0), UINT64_C(                   0), UINT64_C( 8560586643050870351),
+        UINT64_C(                   0), UINT64_C(18446743544496432733), UINT64_C(                   0), UINT64_C(10211103732410114595) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r = simde_mm512_maskz_madd52hi_epu64(test_vec[i].k, a, b, c);
+    simde_test_x86_assert_equal_u64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_madd52lo_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_madd52hi_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_madd52hi_epu64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -3841,6 +3841,122 @@ test_simde_mm512_maskz_max_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_max_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    15.01), SIMDE_FLOAT16_VALUE(     0.00), SIMDE_FLOAT16_VALUE(    -0.00), SIMDE_FLOAT16_VALUE(   -10.62),
+        SIMDE_FLOAT16_VALUE(   -88.38), SIMDE_FLOAT16_VALUE(    43.03), SIMDE_FLOAT16_VALUE(    25.77), SIMDE_FLOAT16_VALUE(    11.77),
+        SIMDE_FLOAT16_VALUE(   -43.19), SIMDE_FLOAT16_VALUE(    27.45), SIMDE_FLOAT16_VALUE(    -6.24), SIMDE_FLOAT16_VALUE(    48.62),
+        SIMDE_FLOAT16_VALUE(    24.05), SIMDE_FLOAT16_VALUE(   -73.12), SIMDE_FLOAT16_VALUE(   -94.25), SIMDE_FLOAT16_VALUE(   -96.06),
+        SIMDE_FLOAT16_VALUE(    73.50), SIMDE_FLOAT16_VALUE(   -74.19), SIMDE_FLOAT16_VALUE(   -92.31), SIMDE_FLOAT16_VALUE(   -93.12),
+        SIMDE_FLOAT16_VALUE(   -26.09), SIMDE_FLOAT16_VALUE(   -62.41), SIMDE_FLOAT16_VALUE(   -26.09), SIMDE_FLOAT16_VALUE(    95.81),
+        SIMDE_FLOAT16_VALUE(    91.00), SIMDE_FLOAT16_VALUE(    50.84), SIMDE_FLOAT16_VALUE(    35.28), SIMDE_FLOAT16_VALUE(    64.94),
+        SIMDE_FLOAT16_VALUE(   -47.25), SIMDE_FLOAT16_VALUE(   -45.84), SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(    59.09) },
+      { SIMDE_FLOAT16_VALUE(    15.01), SIMDE_FLOAT16_VALUE(    -0.00), SIMDE_FLOAT16_VALUE(     0.00), SIMDE_FLOAT16_VALUE(   -28.67),
+        SIMDE_FLOAT16_VALUE(   -25.30), SIMDE_FLOAT16_VALUE(    43.03), SIMDE_FLOAT16_VALUE(   -10.08), SIMDE_FLOAT16_VALUE(     1.65),
+        SIMDE_FLOAT16_VALUE(   -24.42), SIMDE_FLOAT16_VALUE(    80.50), SIMDE_FLOAT16_VALUE(    -6.24), SIMDE_FLOAT16_VALUE(    94.75),
+        SIMDE_FLOAT16_VALUE(    52.19), SIMDE_FLOAT16_VALUE(   -43.28), SIMDE_FLOAT16_VALUE(    32.88), SIMDE_FLOAT16_VALUE(   -96.06),
+        SIMDE_FLOAT16_VALUE(   -61.91), SIMDE_FLOAT16_VALUE(    74.62), SIMDE_FLOAT16_VALUE(    52.50), SIMDE_FLOAT16_VALUE(    77.38),
+        SIMDE_FLOAT16_VALUE(   -26.09), SIMDE_FLOAT16_VALUE(    39.88), SIMDE_FLOAT16_VALUE(   -54.62), SIMDE_FLOAT16_VALUE(   -47.09),
+        SIMDE_FLOAT16_VALUE(   -79.00), SIMDE_FLOAT16_VALUE(    50.84), SIMDE_FLOAT16_VALUE(   -41.25), SIMDE_FLOAT16_VALUE(   -41.00),
+        SIMDE_FLOAT16_VALUE(    24.58), SIMDE_FLOAT16_VALUE(   -62.53), SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(    59.72) },
+      { SIMDE_FLOAT16_VALUE(    15.01), SIMDE_FLOAT16_VALUE(    -0.00), SIMDE_FLOAT16_VALUE(     0.00), SIMDE_FLOAT16_VALUE(   -10.62),
+        SIMDE_FLOAT16_VALUE(   -25.30), SIMDE_FLOAT16_VALUE(    43.03), SIMDE_FLOAT16_VALUE(    25.77), SIMDE_FLOAT16_VALUE(    11.77),
+        SIMDE_FLOAT16_VALUE(   -24.42), SIMDE_FLOAT16_VALUE(    80.50), SIMDE_FLOAT16_VALUE(    -6.24), SIMDE_FLOAT16_VALUE(    94.75),
+        SIMDE_FLOAT16_VALUE(    52.19), SIMDE_FLOAT16_VALUE(   -43.28), SIMDE_FLOAT16_VALUE(    32.88), SIMDE_FLOAT16_VALUE(   -96.06),
+        SIMDE_FLOAT16_VALUE(    73.50), SIMDE_FLOAT16_VALUE(    74.62), SIMDE_FLOAT16_VALUE(    52.50), SIMDE_FLOAT16_VALUE(    77.38),
+        SIMDE_FLOAT16_VALUE(   -26.09), SIMDE_FLOAT16_VALUE(    39.88), SIMDE_FLOAT16_VALUE(   -26.09), SIMDE_FLOAT16_VALUE(    95.81),
+        SIMDE_FLOAT16_VALUE(    91.00), SIMDE_FLOAT16_VALUE(    50.84), SIMDE_FLOAT16_VALUE(    35.28), SIMDE_FLOAT16_VALUE(    64.94),
+        SIMDE_FLOAT16_VALUE(    24.58), SIMDE_FLOAT16_VALUE(   -45.84), SIMDE_FLOAT16_VALUE(   -64.06), SIMDE_FLOAT16_VALUE(    59.72) } },
+    { { SIMDE_FLOAT16_VALUE(   -31.84), SIMDE_FLOAT16_VALUE(    11.16), SIMDE_FLOAT16_VALUE(   -51.25), SIMDE_FLOAT16_VALUE(    89.75),
+        SIMDE_FLOAT16_VALUE(    49.69), SIMDE_FLOAT16_VALUE(    14.87), SIMDE_FLOAT16_VALUE(   -43.84), SIMDE_FLOAT16_VALUE(   -73.62),
+        SIMDE_FLOAT16_VALUE(    84.94), SIMDE_FLOAT16_VALUE(   -63.00), SIMDE_FLOAT16_VALUE(    39.56), SIMDE_FLOAT16_VALUE(   -28.88),
+        SIMDE_FLOAT16_VALUE(    48.38), SIMDE_FLOAT16_VALUE(    56.56), SIMDE_FLOAT16_VALUE(    86.62), SIMDE_FLOAT16_VALUE(    92.44),
+        SIMDE_FLOAT16_VALUE(   -38.66), SIMDE_FLOAT16_VALUE(   -46.59), SIMDE_FLOAT16_VALUE(   -34.84), SIMDE_FLOAT16_VALUE(    38.97),
+        SIMDE_FLOAT16_VALUE(   -47.12), SIMDE_FLOAT16_VALUE(   -77.19), SIMDE_FLOAT16_VALUE(    33.25), SIMDE_FLOAT16_VALUE(    93.19),
+        SIMDE_FLOAT16_VALUE(    81.75), SIMDE_FLOAT16_VALUE(   -99.88), SIMDE_FLOAT16_VALUE(   -77.00), SIMDE_FLOAT16_VALUE(    28.12),
+        SIMDE_FLOAT16_VALUE(    55.53), SIMDE_FLOAT16_VALUE(    99.19), SIMDE_FLOAT16_VALUE(     9.39), SIMDE_FLOAT16_VALUE(   -76.88) },
+      { SIMDE_FLOAT16_VALUE(    73.00), SIMDE_FLOAT16_VALUE(    53.84), SIMDE_FLOAT16_VALUE(   -35.62), SIMDE_FLOAT16_VALUE(    -7.20),
+        SIMDE_FLOAT16_VALUE(    91.25), SIMDE_FLOAT16_VALUE(   -11.06), SIMDE_FLOAT16_VALUE(    88.75), SIMDE_FLOAT16_VALUE(    41.00),
+        SIMDE_FLOAT16_VALUE(    82.44), SIMDE_FLOAT16_VALUE(   -31.22), SIMDE_FLOAT16_VALUE(   -65.81), SIMDE_FLOAT16_VALUE(    17.38),
+        SIMDE_FLOAT16_VALUE(   -52.66), SIMDE_FLOAT16_VALUE(     9.94), SIMDE_FLOAT16_VALUE(   -60.47), SIMDE_FLOAT16_VALUE(   -42.34),
+        SIMDE_FLOAT16_VALUE(    64.69), SIMDE_FLOAT16_VALUE(   -31.25), SIMDE_FLOAT16_VALUE(    62.88), SIMDE_FLOAT16_VALUE(   -12.84),
+        SIMDE_FLOAT16_VALUE(    17.23), SIMDE_FLOAT16_VALUE(   -71.19), SIMDE_FLOAT16_VALUE(    35.28), SIMDE_FLOAT16_VALUE(    64.81),
+        SIMDE_FLOAT16_VALUE(    66.38), SIMDE_FLOAT16_VALUE(   -32.19), SIMDE_FLOAT16_VALUE(    67.25), SIMDE_FLOAT16_VALUE(    -0.81),
+        SIMDE_FLOAT16_VALUE(   -42.59), SIMDE_FLOAT16_VALUE(    -7.02), SIMDE_FLOAT16_VALUE(    41.62), SIMDE_FLOAT16_VALUE(   -75.19) },
+      { SIMDE_FLOAT16_VALUE(    73.00), SIMDE_FLOAT16_VALUE(    53.84), SIMDE_FLOAT16_VALUE(   -35.62), SIMDE_FLOAT16_VALUE(    89.75),
+        SIMDE_FLOAT16_VALUE(    91.25), SIMDE_FLOAT16_VALUE(    14.87), SIMDE_FLOAT16_VALUE(    88.75), SIMDE_FLOAT16_VALUE(    41.00),
+        SIMDE_FLOAT16_VALUE(    84.94), SIMDE_FLOAT16_VALUE(   -31.22), SIMDE_FLOAT16_VALUE(    39.56), SIMDE_FLOAT16_VALUE(    17.38),
+        SIMDE_FLOAT16_VALUE(    48.38), SIMDE_FLOAT16_VALUE(    56.56), SIMDE_FLOAT16_VALUE(    86.62), SIMDE_FLOAT16_VALUE(    92.44),
+        SIMDE_FLOAT16_VALUE(    64.69), SIMDE_FLOAT16_VALUE(   -31.25), SIMDE_FLOAT16_VALUE(    62.88), SIMDE_FLOAT16_VALUE(    38.97),
+        SIMDE_FLOAT16_VALUE(    17.23), SIMDE_FLOAT16_VALUE(   -71.19), SIMDE_FLOAT16_VALUE(    35.28), SIMDE_FLOAT16_VALUE(    93.19),
+        SIMDE_FLOAT16_VALUE(    81.75), SIMDE_FLOAT16_VALUE(   -32.19), SIMDE_FLOAT16_VALUE(    67.25), SIMDE_FLOAT16_VALUE(    28.12),
+        SIMDE_FLOAT16_VALUE(    55.53), SIMDE_FLOAT16_VALUE(    99.19), SIMDE_FLOAT16_VALUE(    41.62), SIMDE_FLOAT16_VALUE(   -75.19) } },
+    { { SIMDE_FLOAT16_VALUE(    63.72), SIMDE_FLOAT16_VALUE(    98.06), SIMDE_FLOAT16_VALUE(    35.06), SIMDE_FLOAT16_VALUE(    80.88),
+        SIMDE_FLOAT16_VALUE(    26.25), SIMDE_FLOAT16_VALUE(    70.50), SIMDE_FLOAT16_VALUE(    76.12), SIMDE_FLOAT16_VALUE(   -86.38),
+        SIMDE_FLOAT16_VALUE(   -78.94), SIMDE_FLOAT16_VALUE(   -47.47), SIMDE_FLOAT16_VALUE(   -14.61), SIMDE_FLOAT16_VALUE(   -71.38),
+        SIMDE_FLOAT16_VALUE(   -36.50), SIMDE_FLOAT16_VALUE(   -39.19), SIMDE_FLOAT16_VALUE(    -9.50), SIMDE_FLOAT16_VALUE(   -13.27),
+        SIMDE_FLOAT16_VALUE(    10.23), SIMDE_FLOAT16_VALUE(    46.44), SIMDE_FLOAT16_VALUE(    83.06), SIMDE_FLOAT16_VALUE(    72.00),
+        SIMDE_FLOAT16_VALUE(   -18.16), SIMDE_FLOAT16_VALUE(    17.36), SIMDE_FLOAT16_VALUE(   -82.50), SIMDE_FLOAT16_VALUE(   -69.75),
+        SIMDE_FLOAT16_VALUE(   -50.06), SIMDE_FLOAT16_VALUE(    30.80), SIMDE_FLOAT16_VALUE(   -89.19), SIMDE_FLOAT16_VALUE(    28.80),
+        SIMDE_FLOAT16_VALUE(   -58.00), SIMDE_FLOAT16_VALUE(   -98.75), SIMDE_FLOAT16_VALUE(    15.51), SIMDE_FLOAT16_VALUE(   -16.84) },
+      { SIMDE_FLOAT16_VALUE(   -86.19), SIMDE_FLOAT16_VALUE(   -74.56), SIMDE_FLOAT16_VALUE(    45.62), SIMDE_FLOAT16_VALUE(   -31.28),
+        SIMDE_FLOAT16_VALUE(   -40.38), SIMDE_FLOAT16_VALUE(   -61.38), SIMDE_FLOAT16_VALUE(   -22.09), SIMDE_FLOAT16_VALUE(    71.44),
+        SIMDE_FLOAT16_VALUE(    37.62), SIMDE_FLOAT16_VALUE(    22.44), SIMDE_FLOAT16_VALUE(    75.62), SIMDE_FLOAT16_VALUE(    85.00),
+        SIMDE_FLOAT16_VALUE(     3.46), SIMDE_FLOAT16_VALUE(    18.05), SIMDE_FLOAT16_VALUE(   -42.09), SIMDE_FLOAT16_VALUE(     8.75),
+        SIMDE_FLOAT16_VALUE(   -97.75), SIMDE_FLOAT16_VALUE(   -21.45), SIMDE_FLOAT16_VALUE(    45.19), SIMDE_FLOAT16_VALUE(   -57.16),
+        SIMDE_FLOAT16_VALUE(    52.56), SIMDE_FLOAT16_VALUE(   -31.75), SIMDE_FLOAT16_VALUE(    56.78), SIMDE_FLOAT16_VALUE(    66.00),
+        SIMDE_FLOAT16_VALUE(    74.19), SIMDE_FLOAT16_VALUE(    13.60), SIMDE_FLOAT16_VALUE(   -97.69), SIMDE_FLOAT16_VALUE(     7.77),
+        SIMDE_FLOAT16_VALUE(    80.50), SIMDE_FLOAT16_VALUE(   -78.00), SIMDE_FLOAT16_VALUE(   -22.38), SIMDE_FLOAT16_VALUE(    73.50) },
+      { SIMDE_FLOAT16_VALUE(    63.72), SIMDE_FLOAT16_VALUE(    98.06), SIMDE_FLOAT16_VALUE(    45.62), SIMDE_FLOAT16_VALUE(    80.88),
+        SIMDE_FLOAT16_VALUE(    26.25), SIMDE_FLOAT16_VALUE(    70.50), SIMDE_FLOAT16_VALUE(    76.12), SIMDE_FLOAT16_VALUE(    71.44),
+        SIMDE_FLOAT16_VALUE(    37.62), SIMDE_FLOAT16_VALUE(    22.44), SIMDE_FLOAT16_VALUE(    75.62), SIMDE_FLOAT16_VALUE(    85.00),
+        SIMDE_FLOAT16_VALUE(     3.46), SIMDE_FLOAT16_VALUE(    18.05), SIMDE_FLOAT16_VALUE(    -9.50), SIMDE_FLOAT16_VALUE(     8.75),
+        SIMDE_FLOAT16_VALUE(    10.23), SIMDE_FLOAT16_VALUE(    46.44), SIMDE_FLOAT16_VALUE(    83.06), SIMDE_FLOAT16_VALUE(    72.00),
+        SIMDE_FLOAT16_VALUE(    52.56), SIMDE_FLOAT16_VALUE(    17.36), SIMDE_FLOAT16_VALUE(    56.78), SIMDE_FLOAT16_VALUE(    66.00),
+        SIMDE_FLOAT16_VALUE(    74.19), SIMDE_FLOAT16_VALUE(    30.80), SIMDE_FLOAT16_VALUE(   -89.19), SIMDE_FLOAT16_VALUE(    28.80),
+        SIMDE_FLOAT16_VALUE(    80.50), SIMDE_FLOAT16_VALUE(   -78.00), SIMDE_FLOAT16_VALUE(    15.51), SIMDE_FLOAT16_VALUE(    73.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -90.12), SIMDE_FLOAT16_VALUE(    42.88), SIMDE_FLOAT16_VALUE(    78.31), SIMDE_FLOAT16_VALUE(    47.75),
+        SIMDE_FLOAT16_VALUE(    32.47), SIMDE_FLOAT16_VALUE(    22.23), SIMDE_FLOAT16_VALUE(    21.81), SIMDE_FLOAT16_VALUE(    95.81),
+        SIMDE_FLOAT16_VALUE(   -51.03), SIMDE_FLOAT16_VALUE(    97.69), SIMDE_FLOAT16_VALUE(    56.50), SIMDE_FLOAT16_VALUE(   -46.00),
+        SIMDE_FLOAT16_VALUE(    29.27), SIMDE_FLOAT16_VALUE(   -80.38), SIMDE_FLOAT16_VALUE(    76.06), SIMDE_FLOAT16_VALUE(    14.59),
+        SIMDE_FLOAT16_VALUE(    51.50), SIMDE_FLOAT16_VALUE(   -39.47), SIMDE_FLOAT16_VALUE(    98.75), SIMDE_FLOAT16_VALUE(    64.50),
+        SIMDE_FLOAT16_VALUE(    25.42), SIMDE_FLOAT16_VALUE(   -40.22), SIMDE_FLOAT16_VALUE(   -38.56), SIMDE_FLOAT16_VALUE(    95.00),
+        SIMDE_FLOAT16_VALUE(    75.56), SIMDE_FLOAT16_VALUE(   -95.31), SIMDE_FLOAT16_VALUE(   -47.53), SIMDE_FLOAT16_VALUE(    52.88),
+        SIMDE_FLOAT16_VALUE(    89.62), SIMDE_FLOAT16_VALUE(   -64.81), SIMDE_FLOAT16_VALUE(    25.80), SIMDE_FLOAT16_VALUE(    26.44) },
+      { SIMDE_FLOAT16_VALUE(    55.12), SIMDE_FLOAT16_VALUE(    84.19), SIMDE_FLOAT16_VALUE(    67.75), SIMDE_FLOAT16_VALUE(   -51.53),
+        SIMDE_FLOAT16_VALUE(   -35.00), SIMDE_FLOAT16_VALUE(   -99.00), SIMDE_FLOAT16_VALUE(     0.09), SIMDE_FLOAT16_VALUE(    42.69),
+        SIMDE_FLOAT16_VALUE(    16.97), SIMDE_FLOAT16_VALUE(   -50.06), SIMDE_FLOAT16_VALUE(    17.38), SIMDE_FLOAT16_VALUE(    68.31),
+        SIMDE_FLOAT16_VALUE(   -54.25), SIMDE_FLOAT16_VALUE(    40.38), SIMDE_FLOAT16_VALUE(    64.69), SIMDE_FLOAT16_VALUE(   -28.03),
+        SIMDE_FLOAT16_VALUE(   -98.69), SIMDE_FLOAT16_VALUE(    64.25), SIMDE_FLOAT16_VALUE(    55.41), SIMDE_FLOAT16_VALUE(    91.12),
+        SIMDE_FLOAT16_VALUE(     7.34), SIMDE_FLOAT16_VALUE(   -67.44), SIMDE_FLOAT16_VALUE(     8.25), SIMDE_FLOAT16_VALUE(    80.69),
+        SIMDE_FLOAT16_VALUE(   -74.31), SIMDE_FLOAT16_VALUE(   -53.25), SIMDE_FLOAT16_VALUE(   -17.69), SIMDE_FLOAT16_VALUE(    67.12),
+        SIMDE_FLOAT16_VALUE(    58.91), SIMDE_FLOAT16_VALUE(   -45.06), SIMDE_FLOAT16_VALUE(    67.19), SIMDE_FLOAT16_VALUE(   -54.81) },
+      { SIMDE_FLOAT16_VALUE(    55.12), SIMDE_FLOAT16_VALUE(    84.19), SIMDE_FLOAT16_VALUE(    78.31), SIMDE_FLOAT16_VALUE(    47.75),
+        SIMDE_FLOAT16_VALUE(    32.47), SIMDE_FLOAT16_VALUE(    22.23), SIMDE_FLOAT16_VALUE(    21.81), SIMDE_FLOAT16_VALUE(    95.81),
+        SIMDE_FLOAT16_VALUE(    16.97), SIMDE_FLOAT16_VALUE(    97.69), SIMDE_FLOAT16_VALUE(    56.50), SIMDE_FLOAT16_VALUE(    68.31),
+        SIMDE_FLOAT16_VALUE(    29.27), SIMDE_FLOAT16_VALUE(    40.38), SIMDE_FLOAT16_VALUE(    76.06), SIMDE_FLOAT16_VALUE(    14.59),
+        SIMDE_FLOAT16_VALUE(    51.50), SIMDE_FLOAT16_VALUE(    64.25), SIMDE_FLOAT16_VALUE(    98.75), SIMDE_FLOAT16_VALUE(    91.12),
+        SIMDE_FLOAT16_VALUE(    25.42), SIMDE_FLOAT16_VALUE(   -40.22), SIMDE_FLOAT16_VALUE(     8.25), SIMDE_FLOAT16_VALUE(    95.00),
+        SIMDE_FLOAT16_VALUE(    75.56), SIMDE_FLOAT16_VALUE(   -53.25), SIMDE_FLOAT16_VALUE(   -17.69), SIMDE_FLOAT16_VALUE(    67.12),
+        SIMDE_FLOAT16_VALUE(    89.62), SIMDE_FLOAT16_VALUE(   -45.06), SIMDE_FLOAT16_VALUE(    67.19), SIMDE_FLOAT16_VALUE(    26.44) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde_float16 r[32];
+    simde_mm512_storeu_ph(r, simde_mm512_max_ph(a, b));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_max_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_max_epi8)
@@ -3877,6 +3993,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_max_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_max_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_max_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_max_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
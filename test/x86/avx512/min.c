@@ -3841,6 +3841,122 @@ test_simde_mm512_maskz_min_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_min_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    77.88), SIMDE_FLOAT16_VALUE(     0.00), SIMDE_FLOAT16_VALUE(    -0.00), SIMDE_FLOAT16_VALUE(   -83.50),
+        SIMDE_FLOAT16_VALUE(    -2.14), SIMDE_FLOAT16_VALUE(     2.97), SIMDE_FLOAT16_VALUE(   -58.00), SIMDE_FLOAT16_VALUE(     7.58),
+        SIMDE_FLOAT16_VALUE(     1.89), SIMDE_FLOAT16_VALUE(     6.18), SIMDE_FLOAT16_VALUE(    46.78), SIMDE_FLOAT16_VALUE(    19.66),
+        SIMDE_FLOAT16_VALUE(    -3.38), SIMDE_FLOAT16_VALUE(    28.05), SIMDE_FLOAT16_VALUE(    29.28), SIMDE_FLOAT16_VALUE(    50.59),
+        SIMDE_FLOAT16_VALUE(   -81.38), SIMDE_FLOAT16_VALUE(   -36.31), SIMDE_FLOAT16_VALUE(     2.42), SIMDE_FLOAT16_VALUE(   -88.56),
+        SIMDE_FLOAT16_VALUE(    99.69), SIMDE_FLOAT16_VALUE(   -90.75), SIMDE_FLOAT16_VALUE(    -8.32), SIMDE_FLOAT16_VALUE(   -97.19),
+        SIMDE_FLOAT16_VALUE(   -84.31), SIMDE_FLOAT16_VALUE(    69.00), SIMDE_FLOAT16_VALUE(   -76.81), SIMDE_FLOAT16_VALUE(   -81.38),
+        SIMDE_FLOAT16_VALUE(    -3.29), SIMDE_FLOAT16_VALUE(   -73.75), SIMDE_FLOAT16_VALUE(    67.62), SIMDE_FLOAT16_VALUE(    26.64) },
+      { SIMDE_FLOAT16_VALUE(    77.88), SIMDE_FLOAT16_VALUE(    -0.00), SIMDE_FLOAT16_VALUE(     0.00), SIMDE_FLOAT16_VALUE(   -13.59),
+        SIMDE_FLOAT16_VALUE(    48.66), SIMDE_FLOAT16_VALUE(     2.97), SIMDE_FLOAT16_VALUE(   -98.38), SIMDE_FLOAT16_VALUE(   -77.69),
+        SIMDE_FLOAT16_VALUE(    71.62), SIMDE_FLOAT16_VALUE(   -95.81), SIMDE_FLOAT16_VALUE(    46.78), SIMDE_FLOAT16_VALUE(    41.53),
+        SIMDE_FLOAT16_VALUE(   -35.12), SIMDE_FLOAT16_VALUE(   -33.25), SIMDE_FLOAT16_VALUE(    23.97), SIMDE_FLOAT16_VALUE(    50.59),
+        SIMDE_FLOAT16_VALUE(    25.27), SIMDE_FLOAT16_VALUE(    -9.70), SIMDE_FLOAT16_VALUE(    -7.27), SIMDE_FLOAT16_VALUE(   -29.00),
+        SIMDE_FLOAT16_VALUE(    99.69), SIMDE_FLOAT16_VALUE(    74.81), SIMDE_FLOAT16_VALUE(     5.58), SIMDE_FLOAT16_VALUE(   -99.50),
+        SIMDE_FLOAT16_VALUE(    10.47), SIMDE_FLOAT16_VALUE(    69.00), SIMDE_FLOAT16_VALUE(   -55.34), SIMDE_FLOAT16_VALUE(    37.38),
+        SIMDE_FLOAT16_VALUE(    19.62), SIMDE_FLOAT16_VALUE(     4.57), SIMDE_FLOAT16_VALUE(    67.62), SIMDE_FLOAT16_VALUE(   -36.12) },
+      { SIMDE_FLOAT16_VALUE(    77.88), SIMDE_FLOAT16_VALUE(    -0.00), SIMDE_FLOAT16_VALUE(     0.00), SIMDE_FLOAT16_VALUE(   -83.50),
+        SIMDE_FLOAT16_VALUE(    -2.14), SIMDE_FLOAT16_VALUE(     2.97), SIMDE_FLOAT16_VALUE(   -98.38), SIMDE_FLOAT16_VALUE(   -77.69),
+        SIMDE_FLOAT16_VALUE(     1.89), SIMDE_FLOAT16_VALUE(   -95.81), SIMDE_FLOAT16_VALUE(    46.78), SIMDE_FLOAT16_VALUE(    19.66),
+        SIMDE_FLOAT16_VALUE(   -35.12), SIMDE_FLOAT16_VALUE(   -33.25), SIMDE_FLOAT16_VALUE(    23.97), SIMDE_FLOAT16_VALUE(    50.59),
+        SIMDE_FLOAT16_VALUE(   -81.38), SIMDE_FLOAT16_VALUE(   -36.31), SIMDE_FLOAT16_VALUE(    -7.27), SIMDE_FLOAT16_VALUE(   -88.56),
+        SIMDE_FLOAT16_VALUE(    99.69), SIMDE_FLOAT16_VALUE(   -90.75), SIMDE_FLOAT16_VALUE(    -8.32), SIMDE_FLOAT16_VALUE(   -99.50),
+        SIMDE_FLOAT16_VALUE(   -84.31), SIMDE_FLOAT16_VALUE(    69.00), SIMDE_FLOAT16_VALUE(   -76.81), SIMDE_FLOAT16_VALUE(   -81.38),
+        SIMDE_FLOAT16_VALUE(    -3.29), SIMDE_FLOAT16_VALUE(   -73.75), SIMDE_FLOAT16_VALUE(    67.62), SIMDE_FLOAT16_VALUE(   -36.12) } },
+    { { SIMDE_FLOAT16_VALUE(   -39.19), SIMDE_FLOAT16_VALUE(   -96.56), SIMDE_FLOAT16_VALUE(    17.03), SIMDE_FLOAT16_VALUE(    -4.09),
+        SIMDE_FLOAT16_VALUE(   -76.50), SIMDE_FLOAT16_VALUE(   -22.27), SIMDE_FLOAT16_VALUE(   -23.05), SIMDE_FLOAT16_VALUE(    -4.94),
+        SIMDE_FLOAT16_VALUE(    73.44), SIMDE_FLOAT16_VALUE(    38.19), SIMDE_FLOAT16_VALUE(   -19.20), SIMDE_FLOAT16_VALUE(   -80.25),
+        SIMDE_FLOAT16_VALUE(    66.12), SIMDE_FLOAT16_VALUE(    60.00), SIMDE_FLOAT16_VALUE(    55.09), SIMDE_FLOAT16_VALUE(     3.74),
+        SIMDE_FLOAT16_VALUE(   -97.00), SIMDE_FLOAT16_VALUE(    76.00), SIMDE_FLOAT16_VALUE(   -27.16), SIMDE_FLOAT16_VALUE(    92.25),
+        SIMDE_FLOAT16_VALUE(   -51.31), SIMDE_FLOAT16_VALUE(    76.44), SIMDE_FLOAT16_VALUE(   -16.66), SIMDE_FLOAT16_VALUE(    -1.30),
+        SIMDE_FLOAT16_VALUE(    51.09), SIMDE_FLOAT16_VALUE(   -51.88), SIMDE_FLOAT16_VALUE(   -54.38), SIMDE_FLOAT16_VALUE(    32.41),
+        SIMDE_FLOAT16_VALUE(    49.72), SIMDE_FLOAT16_VALUE(    81.94), SIMDE_FLOAT16_VALUE(    58.94), SIMDE_FLOAT16_VALUE(   -69.50) },
+      { SIMDE_FLOAT16_VALUE(   -34.25), SIMDE_FLOAT16_VALUE(    90.62), SIMDE_FLOAT16_VALUE(    69.69), SIMDE_FLOAT16_VALUE(   -95.69),
+        SIMDE_FLOAT16_VALUE(    25.94), SIMDE_FLOAT16_VALUE(    30.23), SIMDE_FLOAT16_VALUE(    79.06), SIMDE_FLOAT16_VALUE(   -48.28),
+        SIMDE_FLOAT16_VALUE(   -66.31), SIMDE_FLOAT16_VALUE(    10.98), SIMDE_FLOAT16_VALUE(   -99.19), SIMDE_FLOAT16_VALUE(   -72.06),
+        SIMDE_FLOAT16_VALUE(   -59.56), SIMDE_FLOAT16_VALUE(   -84.50), SIMDE_FLOAT16_VALUE(   -63.75), SIMDE_FLOAT16_VALUE(    -7.40),
+        SIMDE_FLOAT16_VALUE(    56.59), SIMDE_FLOAT16_VALUE(    94.38), SIMDE_FLOAT16_VALUE(   -57.81), SIMDE_FLOAT16_VALUE(   -93.38),
+        SIMDE_FLOAT16_VALUE(   -15.53), SIMDE_FLOAT16_VALUE(    48.69), SIMDE_FLOAT16_VALUE(    -5.77), SIMDE_FLOAT16_VALUE(   -47.09),
+        SIMDE_FLOAT16_VALUE(   -43.72), SIMDE_FLOAT16_VALUE(    60.66), SIMDE_FLOAT16_VALUE(   -80.38), SIMDE_FLOAT16_VALUE(    17.38),
+        SIMDE_FLOAT16_VALUE(    73.00), SIMDE_FLOAT16_VALUE(    52.03), SIMDE_FLOAT16_VALUE(    17.31), SIMDE_FLOAT16_VALUE(    15.81) },
+      { SIMDE_FLOAT16_VALUE(   -39.19), SIMDE_FLOAT16_VALUE(   -96.56), SIMDE_FLOAT16_VALUE(    17.03), SIMDE_FLOAT16_VALUE(   -95.69),
+        SIMDE_FLOAT16_VALUE(   -76.50), SIMDE_FLOAT16_VALUE(   -22.27), SIMDE_FLOAT16_VALUE(   -23.05), SIMDE_FLOAT16_VALUE(   -48.28),
+        SIMDE_FLOAT16_VALUE(   -66.31), SIMDE_FLOAT16_VALUE(    10.98), SIMDE_FLOAT16_VALUE(   -99.19), SIMDE_FLOAT16_VALUE(   -80.25),
+        SIMDE_FLOAT16_VALUE(   -59.56), SIMDE_FLOAT16_VALUE(   -84.50), SIMDE_FLOAT16_VALUE(   -63.75), SIMDE_FLOAT16_VALUE(    -7.40),
+        SIMDE_FLOAT16_VALUE(   -97.00), SIMDE_FLOAT16_VALUE(    76.00), SIMDE_FLOAT16_VALUE(   -57.81), SIMDE_FLOAT16_VALUE(   -93.38),
+        SIMDE_FLOAT16_VALUE(   -51.31), SIMDE_FLOAT16_VALUE(    48.69), SIMDE_FLOAT16_VALUE(   -16.66), SIMDE_FLOAT16_VALUE(   -47.09),
+        SIMDE_FLOAT16_VALUE(   -43.72), SIMDE_FLOAT16_VALUE(   -51.88), SIMDE_FLOAT16_VALUE(   -80.38), SIMDE_FLOAT16_VALUE(    17.38),
+        SIMDE_FLOAT16_VALUE(    49.72), SIMDE_FLOAT16_VALUE(    52.03), SIMDE_FLOAT16_VALUE(    17.31), SIMDE_FLOAT16_VALUE(   -69.50) } },
+    { { SIMDE_FLOAT16_VALUE(   -84.31), SIMDE_FLOAT16_VALUE(    15.88), SIMDE_FLOAT16_VALUE(    -2.99), SIMDE_FLOAT16_VALUE(   -28.03),
+        SIMDE_FLOAT16_VALUE(    -5.68), SIMDE_FLOAT16_VALUE(     6.77), SIMDE_FLOAT16_VALUE(    19.69), SIMDE_FLOAT16_VALUE(   -46.56),
+        SIMDE_FLOAT16_VALUE(    64.75), SIMDE_FLOAT16_VALUE(    41.41), SIMDE_FLOAT16_VALUE(    32.66), SIMDE_FLOAT16_VALUE(   -81.31),
+        SIMDE_FLOAT16_VALUE(   -61.62), SIMDE_FLOAT16_VALUE(    19.28), SIMDE_FLOAT16_VALUE(   -48.50), SIMDE_FLOAT16_VALUE(   -65.56),
+        SIMDE_FLOAT16_VALUE(   -48.19), SIMDE_FLOAT16_VALUE(   -13.58), SIMDE_FLOAT16_VALUE(   -51.97), SIMDE_FLOAT16_VALUE(    46.47),
+        SIMDE_FLOAT16_VALUE(   -73.44), SIMDE_FLOAT16_VALUE(   -55.38), SIMDE_FLOAT16_VALUE(   -80.19), SIMDE_FLOAT16_VALUE(    65.75),
+        SIMDE_FLOAT16_VALUE(    24.22), SIMDE_FLOAT16_VALUE(   -48.28), SIMDE_FLOAT16_VALUE(   -73.19), SIMDE_FLOAT16_VALUE(    43.84),
+        SIMDE_FLOAT16_VALUE(   -11.66), SIMDE_FLOAT16_VALUE(   -86.88), SIMDE_FLOAT16_VALUE(    69.69), SIMDE_FLOAT16_VALUE(    23.72) },
+      { SIMDE_FLOAT16_VALUE(   -20.09), SIMDE_FLOAT16_VALUE(    -1.16), SIMDE_FLOAT16_VALUE(     5.95), SIMDE_FLOAT16_VALUE(     4.69),
+        SIMDE_FLOAT16_VALUE(   -23.94), SIMDE_FLOAT16_VALUE(   -87.12), SIMDE_FLOAT16_VALUE(   -46.41), SIMDE_FLOAT16_VALUE(    -1.74),
+        SIMDE_FLOAT16_VALUE(    21.27), SIMDE_FLOAT16_VALUE(     9.46), SIMDE_FLOAT16_VALUE(   -44.03), SIMDE_FLOAT16_VALUE(   -75.25),
+        SIMDE_FLOAT16_VALUE(    24.16), SIMDE_FLOAT16_VALUE(    57.53), SIMDE_FLOAT16_VALUE(    75.88), SIMDE_FLOAT16_VALUE(   -38.75),
+        SIMDE_FLOAT16_VALUE(    12.65), SIMDE_FLOAT16_VALUE(   -53.34), SIMDE_FLOAT16_VALUE(     2.04), SIMDE_FLOAT16_VALUE(    42.22),
+        SIMDE_FLOAT16_VALUE(   -62.31), SIMDE_FLOAT16_VALUE(    21.16), SIMDE_FLOAT16_VALUE(   -74.69), SIMDE_FLOAT16_VALUE(   -77.75),
+        SIMDE_FLOAT16_VALUE(   -72.12), SIMDE_FLOAT16_VALUE(    -4.69), SIMDE_FLOAT16_VALUE(    34.72), SIMDE_FLOAT16_VALUE(   -22.91),
+        SIMDE_FLOAT16_VALUE(     6.68), SIMDE_FLOAT16_VALUE(    13.81), SIMDE_FLOAT16_VALUE(    70.25), SIMDE_FLOAT16_VALUE(    -7.72) },
+      { SIMDE_FLOAT16_VALUE(   -84.31), SIMDE_FLOAT16_VALUE(    -1.16), SIMDE_FLOAT16_VALUE(    -2.99), SIMDE_FLOAT16_VALUE(   -28.03),
+        SIMDE_FLOAT16_VALUE(   -23.94), SIMDE_FLOAT16_VALUE(   -87.12), SIMDE_FLOAT16_VALUE(   -46.41), SIMDE_FLOAT16_VALUE(   -46.56),
+        SIMDE_FLOAT16_VALUE(    21.27), SIMDE_FLOAT16_VALUE(     9.46), SIMDE_FLOAT16_VALUE(   -44.03), SIMDE_FLOAT16_VALUE(   -81.31),
+        SIMDE_FLOAT16_VALUE(   -61.62), SIMDE_FLOAT16_VALUE(    19.28), SIMDE_FLOAT16_VALUE(   -48.50), SIMDE_FLOAT16_VALUE(   -65.56),
+        SIMDE_FLOAT16_VALUE(   -48.19), SIMDE_FLOAT16_VALUE(   -53.34), SIMDE_FLOAT16_VALUE(   -51.97), SIMDE_FLOAT16_VALUE(    42.22),
+        SIMDE_FLOAT16_VALUE(   -73.44), SIMDE_FLOAT16_VALUE(   -55.38), SIMDE_FLOAT16_VALUE(   -80.19), SIMDE_FLOAT16_VALUE(   -77.75),
+        SIMDE_FLOAT16_VALUE(   -72.12), SIMDE_FLOAT16_VALUE(   -48.28), SIMDE_FLOAT16_VALUE(   -73.19), SIMDE_FLOAT16_VALUE(   -22.91),
+        SIMDE_FLOAT16_VALUE(   -11.66), SIMDE_FLOAT16_VALUE(   -86.88), SIMDE_FLOAT16_VALUE(    69.69), SIMDE_FLOAT16_VALUE(    -7.72) } },
+    { { SIMDE_FLOAT16_VALUE(   -80.38), SIMDE_FLOAT16_VALUE(   -54.62), SIMDE_FLOAT16_VALUE(   -95.00), SIMDE_FLOAT16_VALUE(    48.94),
+        SIMDE_FLOAT16_VALUE(   -92.69), SIMDE_FLOAT16_VALUE(    33.62), SIMDE_FLOAT16_VALUE(   -68.56), SIMDE_FLOAT16_VALUE(   -41.19),
+        SIMDE_FLOAT16_VALUE(   -83.38), SIMDE_FLOAT16_VALUE(   -95.69), SIMDE_FLOAT16_VALUE(    83.00), SIMDE_FLOAT16_VALUE(   -86.44),
+        SIMDE_FLOAT16_VALUE(   -42.41), SIMDE_FLOAT16_VALUE(   -12.52), SIMDE_FLOAT16_VALUE(    39.38), SIMDE_FLOAT16_VALUE(    38.19),
+        SIMDE_FLOAT16_VALUE(    -3.64), SIMDE_FLOAT16_VALUE(    28.38), SIMDE_FLOAT16_VALUE(   -64.25), SIMDE_FLOAT16_VALUE(    37.03),
+        SIMDE_FLOAT16_VALUE(    86.31), SIMDE_FLOAT16_VALUE(    86.94), SIMDE_FLOAT16_VALUE(     4.62), SIMDE_FLOAT16_VALUE(   -79.50),
+        SIMDE_FLOAT16_VALUE(   -46.66), SIMDE_FLOAT16_VALUE(   -43.25), SIMDE_FLOAT16_VALUE(   -39.28), SIMDE_FLOAT16_VALUE(    88.44),
+        SIMDE_FLOAT16_VALUE(    77.50), SIMDE_FLOAT16_VALUE(    40.12), SIMDE_FLOAT16_VALUE(   -70.69), SIMDE_FLOAT16_VALUE(   -41.00) },
+      { SIMDE_FLOAT16_VALUE(   -40.22), SIMDE_FLOAT16_VALUE(    22.30), SIMDE_FLOAT16_VALUE(     2.63), SIMDE_FLOAT16_VALUE(    60.44),
+        SIMDE_FLOAT16_VALUE(   -66.94), SIMDE_FLOAT16_VALUE(    68.75), SIMDE_FLOAT16_VALUE(   -76.69), SIMDE_FLOAT16_VALUE(   -22.95),
+        SIMDE_FLOAT16_VALUE(   -88.81), SIMDE_FLOAT16_VALUE(   -10.98), SIMDE_FLOAT16_VALUE(   -38.31), SIMDE_FLOAT16_VALUE(   -58.06),
+        SIMDE_FLOAT16_VALUE(    97.81), SIMDE_FLOAT16_VALUE(   -70.12), SIMDE_FLOAT16_VALUE(   -15.71), SIMDE_FLOAT16_VALUE(   -54.00),
+        SIMDE_FLOAT16_VALUE(    26.70), SIMDE_FLOAT16_VALUE(     2.50), SIMDE_FLOAT16_VALUE(    22.97), SIMDE_FLOAT16_VALUE(    98.38),
+        SIMDE_FLOAT16_VALUE(    -1.47), SIMDE_FLOAT16_VALUE(   -58.97), SIMDE_FLOAT16_VALUE(    72.50), SIMDE_FLOAT16_VALUE(   -92.75),
+        SIMDE_FLOAT16_VALUE(    29.23), SIMDE_FLOAT16_VALUE(   -34.34), SIMDE_FLOAT16_VALUE(   -19.62), SIMDE_FLOAT16_VALUE(    48.59),
+        SIMDE_FLOAT16_VALUE(    23.30), SIMDE_FLOAT16_VALUE(    69.69), SIMDE_FLOAT16_VALUE(    51.22), SIMDE_FLOAT16_VALUE(    46.28) },
+      { SIMDE_FLOAT16_VALUE(   -80.38), SIMDE_FLOAT16_VALUE(   -54.62), SIMDE_FLOAT16_VALUE(   -95.00), SIMDE_FLOAT16_VALUE(    48.94),
+        SIMDE_FLOAT16_VALUE(   -92.69), SIMDE_FLOAT16_VALUE(    33.62), SIMDE_FLOAT16_VALUE(   -76.69), SIMDE_FLOAT16_VALUE(   -41.19),
+        SIMDE_FLOAT16_VALUE(   -88.81), SIMDE_FLOAT16_VALUE(   -95.69), SIMDE_FLOAT16_VALUE(   -38.31), SIMDE_FLOAT16_VALUE(   -86.44),
+        SIMDE_FLOAT16_VALUE(   -42.41), SIMDE_FLOAT16_VALUE(   -70.12), SIMDE_FLOAT16_VALUE(   -15.71), SIMDE_FLOAT16_VALUE(   -54.00),
+        SIMDE_FLOAT16_VALUE(    -3.64), SIMDE_FLOAT16_VALUE(     2.50), SIMDE_FLOAT16_VALUE(   -64.25), SIMDE_FLOAT16_VALUE(    37.03),
+        SIMDE_FLOAT16_VALUE(    -1.47), SIMDE_FLOAT16_VALUE(   -58.97), SIMDE_FLOAT16_VALUE(     4.62), SIMDE_FLOAT16_VALUE(   -92.75),
+        SIMDE_FLOAT16_VALUE(   -46.66), SIMDE_FLOAT16_VALUE(   -43.25), SIMDE_FLOAT16_VALUE(   -39.28), SIMDE_FLOAT16_VALUE(    48.59),
+        SIMDE_FLOAT16_VALUE(    23.30), SIMDE_FLOAT16_VALUE(    40.12), SIMDE_FLOAT16_VALUE(   -70.69), SIMDE_FLOAT16_VALUE(   -41.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde_float16 r[32];
+    simde_mm512_storeu_ph(r, simde_mm512_min_ph(a, b));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_min_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_min_epi8)
@@ -3877,6 +3993,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_min_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_min_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_min_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_min_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -1546,6 +1546,122 @@ test_simde_mm512_maskz_mul_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_mul_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    35.41), SIMDE_FLOAT16_VALUE(   -51.56), SIMDE_FLOAT16_VALUE(   -20.73), SIMDE_FLOAT16_VALUE(   -97.94),
+        SIMDE_FLOAT16_VALUE(    -1.84), SIMDE_FLOAT16_VALUE(   -51.06), SIMDE_FLOAT16_VALUE(   -20.23), SIMDE_FLOAT16_VALUE(    68.12),
+        SIMDE_FLOAT16_VALUE(    74.25), SIMDE_FLOAT16_VALUE(   -89.12), SIMDE_FLOAT16_VALUE(    14.14), SIMDE_FLOAT16_VALUE(   -90.06),
+        SIMDE_FLOAT16_VALUE(    98.19), SIMDE_FLOAT16_VALUE(    49.12), SIMDE_FLOAT16_VALUE(   -90.81), SIMDE_FLOAT16_VALUE(   -19.53),
+        SIMDE_FLOAT16_VALUE(    52.28), SIMDE_FLOAT16_VALUE(   -50.12), SIMDE_FLOAT16_VALUE(    94.88), SIMDE_FLOAT16_VALUE(   -79.94),
+        SIMDE_FLOAT16_VALUE(    83.62), SIMDE_FLOAT16_VALUE(   -66.94), SIMDE_FLOAT16_VALUE(    36.91), SIMDE_FLOAT16_VALUE(   -44.75),
+        SIMDE_FLOAT16_VALUE(   -26.70), SIMDE_FLOAT16_VALUE(   -86.75), SIMDE_FLOAT16_VALUE(    36.16), SIMDE_FLOAT16_VALUE(    60.50),
+        SIMDE_FLOAT16_VALUE(   -99.12), SIMDE_FLOAT16_VALUE(   -78.12), SIMDE_FLOAT16_VALUE(   -75.19), SIMDE_FLOAT16_VALUE(   -55.88) },
+      { SIMDE_FLOAT16_VALUE(    67.88), SIMDE_FLOAT16_VALUE(   -62.69), SIMDE_FLOAT16_VALUE(     1.86), SIMDE_FLOAT16_VALUE(   -33.16),
+        SIMDE_FLOAT16_VALUE(    78.25), SIMDE_FLOAT16_VALUE(    38.62), SIMDE_FLOAT16_VALUE(   -10.32), SIMDE_FLOAT16_VALUE(    84.62),
+        SIMDE_FLOAT16_VALUE(    -7.93), SIMDE_FLOAT16_VALUE(    24.45), SIMDE_FLOAT16_VALUE(   -90.31), SIMDE_FLOAT16_VALUE(   -94.06),
+        SIMDE_FLOAT16_VALUE(   -92.12), SIMDE_FLOAT16_VALUE(   -10.78), SIMDE_FLOAT16_VALUE(    21.70), SIMDE_FLOAT16_VALUE(   -75.44),
+        SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(    64.25), SIMDE_FLOAT16_VALUE(    78.50), SIMDE_FLOAT16_VALUE(   -94.62),
+        SIMDE_FLOAT16_VALUE(   -13.29), SIMDE_FLOAT16_VALUE(    27.34), SIMDE_FLOAT16_VALUE(   -75.00), SIMDE_FLOAT16_VALUE(    61.84),
+        SIMDE_FLOAT16_VALUE(   -21.16), SIMDE_FLOAT16_VALUE(    64.44), SIMDE_FLOAT16_VALUE(    -6.46), SIMDE_FLOAT16_VALUE(    59.62),
+        SIMDE_FLOAT16_VALUE(    78.81), SIMDE_FLOAT16_VALUE(   -88.75), SIMDE_FLOAT16_VALUE(    34.28), SIMDE_FLOAT16_VALUE(    91.00) },
+      { SIMDE_FLOAT16_VALUE(  2404.00), SIMDE_FLOAT16_VALUE(  3232.00), SIMDE_FLOAT16_VALUE(   -38.56), SIMDE_FLOAT16_VALUE(  3248.00),
+        SIMDE_FLOAT16_VALUE(  -144.00), SIMDE_FLOAT16_VALUE( -1972.00), SIMDE_FLOAT16_VALUE(   208.88), SIMDE_FLOAT16_VALUE(  5764.00),
+        SIMDE_FLOAT16_VALUE(  -589.00), SIMDE_FLOAT16_VALUE( -2180.00), SIMDE_FLOAT16_VALUE( -1277.00), SIMDE_FLOAT16_VALUE(  8472.00),
+        SIMDE_FLOAT16_VALUE( -9048.00), SIMDE_FLOAT16_VALUE(  -529.50), SIMDE_FLOAT16_VALUE( -1971.00), SIMDE_FLOAT16_VALUE(  1473.00),
+        SIMDE_FLOAT16_VALUE( -4640.00), SIMDE_FLOAT16_VALUE( -3220.00), SIMDE_FLOAT16_VALUE(  7448.00), SIMDE_FLOAT16_VALUE(  7564.00),
+        SIMDE_FLOAT16_VALUE( -1111.00), SIMDE_FLOAT16_VALUE( -1830.00), SIMDE_FLOAT16_VALUE( -2768.00), SIMDE_FLOAT16_VALUE( -2768.00),
+        SIMDE_FLOAT16_VALUE(   565.00), SIMDE_FLOAT16_VALUE( -5588.00), SIMDE_FLOAT16_VALUE(  -233.62), SIMDE_FLOAT16_VALUE(  3608.00),
+        SIMDE_FLOAT16_VALUE( -7812.00), SIMDE_FLOAT16_VALUE(  6932.00), SIMDE_FLOAT16_VALUE( -2578.00), SIMDE_FLOAT16_VALUE( -5084.00) } },
+    { { SIMDE_FLOAT16_VALUE(    32.16), SIMDE_FLOAT16_VALUE(   -99.75), SIMDE_FLOAT16_VALUE(    81.06), SIMDE_FLOAT16_VALUE(    27.86),
+        SIMDE_FLOAT16_VALUE(    30.92), SIMDE_FLOAT16_VALUE(    20.98), SIMDE_FLOAT16_VALUE(    27.39), SIMDE_FLOAT16_VALUE(     7.88),
+        SIMDE_FLOAT16_VALUE(    91.62), SIMDE_FLOAT16_VALUE(    28.09), SIMDE_FLOAT16_VALUE(    -6.99), SIMDE_FLOAT16_VALUE(   -74.62),
+        SIMDE_FLOAT16_VALUE(   -77.31), SIMDE_FLOAT16_VALUE(    22.73), SIMDE_FLOAT16_VALUE(    13.75), SIMDE_FLOAT16_VALUE(   -37.62),
+        SIMDE_FLOAT16_VALUE(    84.62), SIMDE_FLOAT16_VALUE(   -70.25), SIMDE_FLOAT16_VALUE(    41.81), SIMDE_FLOAT16_VALUE(    -8.98),
+        SIMDE_FLOAT16_VALUE(    57.31), SIMDE_FLOAT16_VALUE(    31.06), SIMDE_FLOAT16_VALUE(   -16.12), SIMDE_FLOAT16_VALUE(    47.06),
+        SIMDE_FLOAT16_VALUE(    30.69), SIMDE_FLOAT16_VALUE(    -6.66), SIMDE_FLOAT16_VALUE(     5.41), SIMDE_FLOAT16_VALUE(   -61.22),
+        SIMDE_FLOAT16_VALUE(    22.66), SIMDE_FLOAT16_VALUE(     8.22), SIMDE_FLOAT16_VALUE(    29.84), SIMDE_FLOAT16_VALUE(    56.59) },
+      { SIMDE_FLOAT16_VALUE(   -78.81), SIMDE_FLOAT16_VALUE(    31.03), SIMDE_FLOAT16_VALUE(   -66.62), SIMDE_FLOAT16_VALUE(    18.73),
+        SIMDE_FLOAT16_VALUE(    99.94), SIMDE_FLOAT16_VALUE(    51.69), SIMDE_FLOAT16_VALUE(    69.69), SIMDE_FLOAT16_VALUE(   -87.06),
+        SIMDE_FLOAT16_VALUE(    11.85), SIMDE_FLOAT16_VALUE(    -1.69), SIMDE_FLOAT16_VALUE(   -30.92), SIMDE_FLOAT16_VALUE(     6.57),
+        SIMDE_FLOAT16_VALUE(   -69.62), SIMDE_FLOAT16_VALUE(    62.16), SIMDE_FLOAT16_VALUE(    64.00), SIMDE_FLOAT16_VALUE(    43.78),
+        SIMDE_FLOAT16_VALUE(    18.56), SIMDE_FLOAT16_VALUE(   -55.19), SIMDE_FLOAT16_VALUE(    -1.92), SIMDE_FLOAT16_VALUE(   -50.66),
+        SIMDE_FLOAT16_VALUE(   -97.44), SIMDE_FLOAT16_VALUE(    23.95), SIMDE_FLOAT16_VALUE(   -26.38), SIMDE_FLOAT16_VALUE(    94.81),
+        SIMDE_FLOAT16_VALUE(     2.96), SIMDE_FLOAT16_VALUE(   -84.38), SIMDE_FLOAT16_VALUE(    63.88), SIMDE_FLOAT16_VALUE(   -51.19),
+        SIMDE_FLOAT16_VALUE(   -39.06), SIMDE_FLOAT16_VALUE(    57.78), SIMDE_FLOAT16_VALUE(   -51.38), SIMDE_FLOAT16_VALUE(   -77.50) },
+      { SIMDE_FLOAT16_VALUE( -2534.00), SIMDE_FLOAT16_VALUE( -3096.00), SIMDE_FLOAT16_VALUE( -5400.00), SIMDE_FLOAT16_VALUE(   522.00),
+        SIMDE_FLOAT16_VALUE(  3090.00), SIMDE_FLOAT16_VALUE(  1085.00), SIMDE_FLOAT16_VALUE(  1909.00), SIMDE_FLOAT16_VALUE(  -686.00),
+        SIMDE_FLOAT16_VALUE(  1086.00), SIMDE_FLOAT16_VALUE(   -47.50), SIMDE_FLOAT16_VALUE(   216.12), SIMDE_FLOAT16_VALUE(  -490.25),
+        SIMDE_FLOAT16_VALUE(  5384.00), SIMDE_FLOAT16_VALUE(  1413.00), SIMDE_FLOAT16_VALUE(   880.00), SIMDE_FLOAT16_VALUE( -1647.00),
+        SIMDE_FLOAT16_VALUE(  1571.00), SIMDE_FLOAT16_VALUE(  3876.00), SIMDE_FLOAT16_VALUE(   -80.25), SIMDE_FLOAT16_VALUE(   454.75),
+        SIMDE_FLOAT16_VALUE( -5584.00), SIMDE_FLOAT16_VALUE(   744.00), SIMDE_FLOAT16_VALUE(   425.25), SIMDE_FLOAT16_VALUE(  4464.00),
+        SIMDE_FLOAT16_VALUE(    90.88), SIMDE_FLOAT16_VALUE(   562.00), SIMDE_FLOAT16_VALUE(   345.50), SIMDE_FLOAT16_VALUE(  3134.00),
+        SIMDE_FLOAT16_VALUE(  -885.00), SIMDE_FLOAT16_VALUE(   475.00), SIMDE_FLOAT16_VALUE( -1533.00), SIMDE_FLOAT16_VALUE( -4388.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -61.25), SIMDE_FLOAT16_VALUE(    -3.92), SIMDE_FLOAT16_VALUE(   -27.62), SIMDE_FLOAT16_VALUE(    79.62),
+        SIMDE_FLOAT16_VALUE(     5.15), SIMDE_FLOAT16_VALUE(    92.44), SIMDE_FLOAT16_VALUE(    45.06), SIMDE_FLOAT16_VALUE(   -49.66),
+        SIMDE_FLOAT16_VALUE(   -28.30), SIMDE_FLOAT16_VALUE(   -85.62), SIMDE_FLOAT16_VALUE(    13.86), SIMDE_FLOAT16_VALUE(    92.38),
+        SIMDE_FLOAT16_VALUE(    99.12), SIMDE_FLOAT16_VALUE(   -99.31), SIMDE_FLOAT16_VALUE(   -22.02), SIMDE_FLOAT16_VALUE(     1.93),
+        SIMDE_FLOAT16_VALUE(     1.79), SIMDE_FLOAT16_VALUE(   -72.94), SIMDE_FLOAT16_VALUE(   -44.84), SIMDE_FLOAT16_VALUE(   -39.69),
+        SIMDE_FLOAT16_VALUE(   -37.53), SIMDE_FLOAT16_VALUE(    47.28), SIMDE_FLOAT16_VALUE(    28.42), SIMDE_FLOAT16_VALUE(    33.88),
+        SIMDE_FLOAT16_VALUE(   -27.73), SIMDE_FLOAT16_VALUE(   -77.06), SIMDE_FLOAT16_VALUE(    76.56), SIMDE_FLOAT16_VALUE(    53.00),
+        SIMDE_FLOAT16_VALUE(    74.75), SIMDE_FLOAT16_VALUE(   -52.62), SIMDE_FLOAT16_VALUE(   -58.97), SIMDE_FLOAT16_VALUE(   -25.45) },
+      { SIMDE_FLOAT16_VALUE(   -17.77), SIMDE_FLOAT16_VALUE(    74.12), SIMDE_FLOAT16_VALUE(    55.75), SIMDE_FLOAT16_VALUE(   -88.88),
+        SIMDE_FLOAT16_VALUE(    27.42), SIMDE_FLOAT16_VALUE(    43.94), SIMDE_FLOAT16_VALUE(    66.62), SIMDE_FLOAT16_VALUE(   -14.07),
+        SIMDE_FLOAT16_VALUE(   -70.06), SIMDE_FLOAT16_VALUE(   -41.53), SIMDE_FLOAT16_VALUE(    76.88), SIMDE_FLOAT16_VALUE(    35.53),
+        SIMDE_FLOAT16_VALUE(   -67.62), SIMDE_FLOAT16_VALUE(   -84.06), SIMDE_FLOAT16_VALUE(     4.58), SIMDE_FLOAT16_VALUE(    41.12),
+        SIMDE_FLOAT16_VALUE(    75.19), SIMDE_FLOAT16_VALUE(   -67.06), SIMDE_FLOAT16_VALUE(    47.78), SIMDE_FLOAT16_VALUE(   -37.38),
+        SIMDE_FLOAT16_VALUE(    77.12), SIMDE_FLOAT16_VALUE(   -98.88), SIMDE_FLOAT16_VALUE(    67.75), SIMDE_FLOAT16_VALUE(    13.18),
+        SIMDE_FLOAT16_VALUE(    -9.02), SIMDE_FLOAT16_VALUE(   -59.56), SIMDE_FLOAT16_VALUE(    86.12), SIMDE_FLOAT16_VALUE(    27.44),
+        SIMDE_FLOAT16_VALUE(   -47.00), SIMDE_FLOAT16_VALUE(   -92.06), SIMDE_FLOAT16_VALUE(    23.52), SIMDE_FLOAT16_VALUE(    46.69) },
+      { SIMDE_FLOAT16_VALUE(  1088.00), SIMDE_FLOAT16_VALUE(  -290.50), SIMDE_FLOAT16_VALUE( -1540.00), SIMDE_FLOAT16_VALUE( -7076.00),
+        SIMDE_FLOAT16_VALUE(   141.12), SIMDE_FLOAT16_VALUE(  4062.00), SIMDE_FLOAT16_VALUE(  3002.00), SIMDE_FLOAT16_VALUE(   698.50),
+        SIMDE_FLOAT16_VALUE(  1983.00), SIMDE_FLOAT16_VALUE(  3556.00), SIMDE_FLOAT16_VALUE(  1065.00), SIMDE_FLOAT16_VALUE(  3282.00),
+        SIMDE_FLOAT16_VALUE( -6704.00), SIMDE_FLOAT16_VALUE(  8352.00), SIMDE_FLOAT16_VALUE(  -100.81), SIMDE_FLOAT16_VALUE(    79.38),
+        SIMDE_FLOAT16_VALUE(   134.62), SIMDE_FLOAT16_VALUE(  4892.00), SIMDE_FLOAT16_VALUE( -2142.00), SIMDE_FLOAT16_VALUE(  1483.00),
+        SIMDE_FLOAT16_VALUE( -2894.00), SIMDE_FLOAT16_VALUE( -4676.00), SIMDE_FLOAT16_VALUE(  1926.00), SIMDE_FLOAT16_VALUE(   446.50),
+        SIMDE_FLOAT16_VALUE(   250.25), SIMDE_FLOAT16_VALUE(  4592.00), SIMDE_FLOAT16_VALUE(  6592.00), SIMDE_FLOAT16_VALUE(  1454.00),
+        SIMDE_FLOAT16_VALUE( -3514.00), SIMDE_FLOAT16_VALUE(  4844.00), SIMDE_FLOAT16_VALUE( -1387.00), SIMDE_FLOAT16_VALUE( -1188.00) } },
+    { { SIMDE_FLOAT16_VALUE(   -61.53), SIMDE_FLOAT16_VALUE(   -49.38), SIMDE_FLOAT16_VALUE(    52.72), SIMDE_FLOAT16_VALUE(    64.19),
+        SIMDE_FLOAT16_VALUE(   -40.78), SIMDE_FLOAT16_VALUE(   -27.95), SIMDE_FLOAT16_VALUE(    42.34), SIMDE_FLOAT16_VALUE(    71.50),
+        SIMDE_FLOAT16_VALUE(   -42.94), SIMDE_FLOAT16_VALUE(    25.80), SIMDE_FLOAT16_VALUE(    19.84), SIMDE_FLOAT16_VALUE(   -67.88),
+        SIMDE_FLOAT16_VALUE(    82.06), SIMDE_FLOAT16_VALUE(    18.73), SIMDE_FLOAT16_VALUE(    63.12), SIMDE_FLOAT16_VALUE(   -22.28),
+        SIMDE_FLOAT16_VALUE(   -78.69), SIMDE_FLOAT16_VALUE(   -91.12), SIMDE_FLOAT16_VALUE(   -74.62), SIMDE_FLOAT16_VALUE(    70.94),
+        SIMDE_FLOAT16_VALUE(   -86.25), SIMDE_FLOAT16_VALUE(    -8.80), SIMDE_FLOAT16_VALUE(   -26.33), SIMDE_FLOAT16_VALUE(   -27.42),
+        SIMDE_FLOAT16_VALUE(   -25.39), SIMDE_FLOAT16_VALUE(   -74.44), SIMDE_FLOAT16_VALUE(   -37.06), SIMDE_FLOAT16_VALUE(    45.78),
+        SIMDE_FLOAT16_VALUE(    12.07), SIMDE_FLOAT16_VALUE(    40.81), SIMDE_FLOAT16_VALUE(   -85.06), SIMDE_FLOAT16_VALUE(    85.19) },
+      { SIMDE_FLOAT16_VALUE(    24.28), SIMDE_FLOAT16_VALUE(   -74.12), SIMDE_FLOAT16_VALUE(     0.83), SIMDE_FLOAT16_VALUE(   -63.47),
+        SIMDE_FLOAT16_VALUE(    31.75), SIMDE_FLOAT16_VALUE(   -73.81), SIMDE_FLOAT16_VALUE(   -29.31), SIMDE_FLOAT16_VALUE(    55.78),
+        SIMDE_FLOAT16_VALUE(    34.84), SIMDE_FLOAT16_VALUE(     3.78), SIMDE_FLOAT16_VALUE(    47.62), SIMDE_FLOAT16_VALUE(   -89.44),
+        SIMDE_FLOAT16_VALUE(   -26.86), SIMDE_FLOAT16_VALUE(   -70.31), SIMDE_FLOAT16_VALUE(     5.79), SIMDE_FLOAT16_VALUE(   -26.98),
+        SIMDE_FLOAT16_VALUE(    95.12), SIMDE_FLOAT16_VALUE(     4.85), SIMDE_FLOAT16_VALUE(    75.06), SIMDE_FLOAT16_VALUE(    -9.33),
+        SIMDE_FLOAT16_VALUE(   -66.75), SIMDE_FLOAT16_VALUE(    62.38), SIMDE_FLOAT16_VALUE(   -82.25), SIMDE_FLOAT16_VALUE(   -78.06),
+        SIMDE_FLOAT16_VALUE(    58.16), SIMDE_FLOAT16_VALUE(    18.72), SIMDE_FLOAT16_VALUE(    -1.18), SIMDE_FLOAT16_VALUE(   -89.44),
+        SIMDE_FLOAT16_VALUE(    52.16), SIMDE_FLOAT16_VALUE(    75.81), SIMDE_FLOAT16_VALUE(   -27.39), SIMDE_FLOAT16_VALUE(    44.50) },
+      { SIMDE_FLOAT16_VALUE( -1494.00), SIMDE_FLOAT16_VALUE(  3660.00), SIMDE_FLOAT16_VALUE(    43.75), SIMDE_FLOAT16_VALUE( -4074.00),
+        SIMDE_FLOAT16_VALUE( -1295.00), SIMDE_FLOAT16_VALUE(  2064.00), SIMDE_FLOAT16_VALUE( -1241.00), SIMDE_FLOAT16_VALUE(  3988.00),
+        SIMDE_FLOAT16_VALUE( -1496.00), SIMDE_FLOAT16_VALUE(    97.50), SIMDE_FLOAT16_VALUE(   945.00), SIMDE_FLOAT16_VALUE(  6072.00),
+        SIMDE_FLOAT16_VALUE( -2204.00), SIMDE_FLOAT16_VALUE( -1317.00), SIMDE_FLOAT16_VALUE(   365.50), SIMDE_FLOAT16_VALUE(   601.00),
+        SIMDE_FLOAT16_VALUE( -7484.00), SIMDE_FLOAT16_VALUE(  -442.00), SIMDE_FLOAT16_VALUE( -5600.00), SIMDE_FLOAT16_VALUE(  -661.50),
+        SIMDE_FLOAT16_VALUE(  5756.00), SIMDE_FLOAT16_VALUE(  -548.50), SIMDE_FLOAT16_VALUE(  2166.00), SIMDE_FLOAT16_VALUE(  2140.00),
+        SIMDE_FLOAT16_VALUE( -1477.00), SIMDE_FLOAT16_VALUE( -1393.00), SIMDE_FLOAT16_VALUE(    43.72), SIMDE_FLOAT16_VALUE( -4094.00),
+        SIMDE_FLOAT16_VALUE(   629.50), SIMDE_FLOAT16_VALUE(  3094.00), SIMDE_FLOAT16_VALUE(  2330.00), SIMDE_FLOAT16_VALUE(  3790.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde_float16 r[32];
+    simde_mm512_storeu_ph(r, simde_mm512_mul_ph(a, b));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mul_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_mul_epi32)
@@ -1559,6 +1675,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mul_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_mul_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_mul_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mul_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
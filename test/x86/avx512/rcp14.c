@@ -0,0 +1,1188 @@
+#define SIMDE_TEST_X86_AVX512_INSN rcp14
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/rcp14.h>
+
+/* vrcp14ps has a maximum relative error of 2^-14.  Exact results
+ * just past FLT_MAX may also come back as infinity. */
+static int
+simde_test_rcp14_ps_within_bound(simde_float32 a, simde_float32 r) {
+  const simde_float64 e = SIMDE_FLOAT64_C(1.0) / HEDLEY_STATIC_CAST(simde_float64, a);
+  if (simde_math_isnan(e))
+    return simde_math_isnan(r);
+  if (simde_math_isinf(e))
+    return !((r < e) || (r > e));
+  if (simde_math_isinf(r))
+    return ((r > SIMDE_FLOAT32_C(0.0)) == (e > SIMDE_FLOAT64_C(0.0))) && (simde_math_fabs(e) * (SIMDE_FLOAT64_C(1.0) + SIMDE_FLOAT64_C(0.00006103515625)) > SIMDE_MATH_FLT_MAX);
+  return simde_math_fabs(HEDLEY_STATIC_CAST(simde_float64, r) - e) <= simde_math_fabs(e) * SIMDE_FLOAT64_C(0.00006103515625);
+}
+
+static const simde_float32 simde_test_rcp14_ps_bound_inputs[] = {
+  SIMDE_FLOAT32_C(1.0), SIMDE_FLOAT32_C(-1.5), SIMDE_FLOAT32_C(3.0), SIMDE_FLOAT32_C(-7.0),
+  SIMDE_FLOAT32_C(0.1), SIMDE_FLOAT32_C(1234.5), SIMDE_FLOAT32_C(-0.0003), SIMDE_FLOAT32_C(65504.0),
+  SIMDE_FLOAT32_C(1.0e-30), SIMDE_FLOAT32_C(-2.5e20), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(3.0e38),
+  SIMDE_FLOAT32_C(-3.0e38), SIMDE_FLOAT32_C(3.402823466e38), SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(1.99999988),
+  #if !defined(SIMDE_FAST_MATH)
+  SIMDE_FLOAT32_C(5.877471754e-39), SIMDE_FLOAT32_C(-5.877471754e-39), SIMDE_FLOAT32_C(2.938735877e-39), SIMDE_FLOAT32_C(1.0e-39),
+  SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(1.401298464e-45), SIMDE_FLOAT32_C(-1.401298464e-45), SIMDE_FLOAT32_C(1.0e-38),
+  SIMDE_FLOAT32_C(0.0), SIMDE_FLOAT32_C(-0.0), SIMDE_MATH_INFINITYF, -SIMDE_MATH_INFINITYF,
+  SIMDE_MATH_NANF, SIMDE_FLOAT32_C(3.000000646e-39), SIMDE_FLOAT32_C(4.253529587e37), SIMDE_FLOAT32_C(1.175494211e-38)
+  #endif
+};
+
+static int
+test_simde_mm_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF },
+      {       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00) } },
+    { { SIMDE_FLOAT32_C(5.877471754e-39), SIMDE_FLOAT32_C(-5.877471754e-39), SIMDE_FLOAT32_C(1.0e-39), SIMDE_FLOAT32_C(-1.401298464e-45) },
+      { SIMDE_FLOAT32_C(1.701411835e38), SIMDE_FLOAT32_C(-1.701411835e38), SIMDE_MATH_INFINITYF, -SIMDE_MATH_INFINITYF } },
+    #endif
+    { { SIMDE_FLOAT32_C( 905.80), SIMDE_FLOAT32_C( 143.02), SIMDE_FLOAT32_C( -42.60), SIMDE_FLOAT32_C(-880.88) },
+      { SIMDE_FLOAT32_C(   0.001104), SIMDE_FLOAT32_C(   0.006992), SIMDE_FLOAT32_C(  -0.023474), SIMDE_FLOAT32_C(  -0.001135) } },
+    { { SIMDE_FLOAT32_C(-778.96), SIMDE_FLOAT32_C(-126.37), SIMDE_FLOAT32_C(-795.35), SIMDE_FLOAT32_C( 714.53) },
+      { SIMDE_FLOAT32_C(  -0.001284), SIMDE_FLOAT32_C(  -0.007914), SIMDE_FLOAT32_C(  -0.001257), SIMDE_FLOAT32_C(   0.001400) } },
+    { { SIMDE_FLOAT32_C( 711.64), SIMDE_FLOAT32_C( 222.70), SIMDE_FLOAT32_C( 882.77), SIMDE_FLOAT32_C(-751.37) },
+      { SIMDE_FLOAT32_C(   0.001405), SIMDE_FLOAT32_C(   0.004490), SIMDE_FLOAT32_C(   0.001133), SIMDE_FLOAT32_C(  -0.001331) } },
+    { { SIMDE_FLOAT32_C(-973.18), SIMDE_FLOAT32_C(-860.05), SIMDE_FLOAT32_C( 547.85), SIMDE_FLOAT32_C(-589.70) },
+      { SIMDE_FLOAT32_C(  -0.001028), SIMDE_FLOAT32_C(  -0.001163), SIMDE_FLOAT32_C(   0.001825), SIMDE_FLOAT32_C(  -0.001696) } },
+    { { SIMDE_FLOAT32_C( 320.96), SIMDE_FLOAT32_C( 425.96), SIMDE_FLOAT32_C(  73.61), SIMDE_FLOAT32_C( -81.05) },
+      { SIMDE_FLOAT32_C(   0.003116), SIMDE_FLOAT32_C(   0.002348), SIMDE_FLOAT32_C(   0.013585), SIMDE_FLOAT32_C(  -0.012338) } },
+    { { SIMDE_FLOAT32_C(-792.88), SIMDE_FLOAT32_C( 517.08), SIMDE_FLOAT32_C( 939.85), SIMDE_FLOAT32_C( 478.74) },
+      { SIMDE_FLOAT32_C(  -0.001261), SIMDE_FLOAT32_C(   0.001934), SIMDE_FLOAT32_C(   0.001064), SIMDE_FLOAT32_C(   0.002089) } },
+    { { SIMDE_FLOAT32_C(  16.33), SIMDE_FLOAT32_C(-236.16), SIMDE_FLOAT32_C(-659.71), SIMDE_FLOAT32_C(-348.83) },
+      { SIMDE_FLOAT32_C(   0.061239), SIMDE_FLOAT32_C(  -0.004234), SIMDE_FLOAT32_C(  -0.001516), SIMDE_FLOAT32_C(  -0.002867) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_rcp14_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rcp14_ps_bound (SIMDE_MUNIT_TEST_ARGS) {
+  const simde_float32* inputs = simde_test_rcp14_ps_bound_inputs;
+  simde_float32 r[4];
+
+  for (size_t i = 0 ; i < (sizeof(simde_test_rcp14_ps_bound_inputs) / sizeof(simde_test_rcp14_ps_bound_inputs[0])) ; i += 4) {
+    simde_mm_storeu_ps(r, simde_mm_rcp14_ps(simde_mm_loadu_ps(&(inputs[i]))));
+    for (size_t j = 0 ; j < 4 ; j++) {
+      simde_assert_equal_i(simde_test_rcp14_ps_within_bound(inputs[i + j], r[j]), 1);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C( 700.92), SIMDE_FLOAT32_C(-679.47), SIMDE_FLOAT32_C(-434.05), SIMDE_FLOAT32_C(-638.00) },
+      UINT8_C(   11),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF },
+      {       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-434.05), SIMDE_FLOAT32_C(  -0.00) } },
+    #endif
+    { { SIMDE_FLOAT32_C( 864.35), SIMDE_FLOAT32_C( 446.93), SIMDE_FLOAT32_C(-367.70), SIMDE_FLOAT32_C( 216.27) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT32_C(-941.55), SIMDE_FLOAT32_C(  50.55), SIMDE_FLOAT32_C(-820.34), SIMDE_FLOAT32_C(-865.55) },
+      { SIMDE_FLOAT32_C( 864.35), SIMDE_FLOAT32_C( 446.93), SIMDE_FLOAT32_C(-367.70), SIMDE_FLOAT32_C( 216.27) } },
+    { { SIMDE_FLOAT32_C(-816.81), SIMDE_FLOAT32_C( 586.40), SIMDE_FLOAT32_C( 119.67), SIMDE_FLOAT32_C(-633.07) },
+      UINT8_C(   10),
+      { SIMDE_FLOAT32_C( 350.57), SIMDE_FLOAT32_C(-768.12), SIMDE_FLOAT32_C(-891.07), SIMDE_FLOAT32_C(-740.40) },
+      { SIMDE_FLOAT32_C(-816.81), SIMDE_FLOAT32_C(  -0.001302), SIMDE_FLOAT32_C( 119.67), SIMDE_FLOAT32_C(  -0.001351) } },
+    { { SIMDE_FLOAT32_C(-303.04), SIMDE_FLOAT32_C(-267.99), SIMDE_FLOAT32_C(-547.81), SIMDE_FLOAT32_C(-379.72) },
+      UINT8_C(   13),
+      { SIMDE_FLOAT32_C(-309.92), SIMDE_FLOAT32_C( 313.41), SIMDE_FLOAT32_C(  86.38), SIMDE_FLOAT32_C(  -6.64) },
+      { SIMDE_FLOAT32_C(  -0.003227), SIMDE_FLOAT32_C(-267.99), SIMDE_FLOAT32_C(   0.011577), SIMDE_FLOAT32_C(  -0.150602) } },
+    { { SIMDE_FLOAT32_C(-181.33), SIMDE_FLOAT32_C( 629.05), SIMDE_FLOAT32_C(-177.11), SIMDE_FLOAT32_C( 631.82) },
+      UINT8_C(    6),
+      { SIMDE_FLOAT32_C(-402.71), SIMDE_FLOAT32_C( 987.52), SIMDE_FLOAT32_C( 839.65), SIMDE_FLOAT32_C(-169.85) },
+      { SIMDE_FLOAT32_C(-181.33), SIMDE_FLOAT32_C(   0.001013), SIMDE_FLOAT32_C(   0.001191), SIMDE_FLOAT32_C( 631.82) } },
+    { { SIMDE_FLOAT32_C(-155.08), SIMDE_FLOAT32_C( 440.70), SIMDE_FLOAT32_C( 502.89), SIMDE_FLOAT32_C(-190.58) },
+      UINT8_C(    7),
+      { SIMDE_FLOAT32_C( 977.84), SIMDE_FLOAT32_C(-329.91), SIMDE_FLOAT32_C(  -1.96), SIMDE_FLOAT32_C(-476.20) },
+      { SIMDE_FLOAT32_C(   0.001023), SIMDE_FLOAT32_C(  -0.003031), SIMDE_FLOAT32_C(  -0.510223), SIMDE_FLOAT32_C(-190.58) } },
+    { { SIMDE_FLOAT32_C(-513.29), SIMDE_FLOAT32_C( 844.96), SIMDE_FLOAT32_C( 245.80), SIMDE_FLOAT32_C(-645.81) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT32_C( 480.22), SIMDE_FLOAT32_C(-448.49), SIMDE_FLOAT32_C( 920.10), SIMDE_FLOAT32_C(-716.73) },
+      { SIMDE_FLOAT32_C(-513.29), SIMDE_FLOAT32_C( 844.96), SIMDE_FLOAT32_C( 245.80), SIMDE_FLOAT32_C(  -0.001395) } },
+    { { SIMDE_FLOAT32_C( 655.39), SIMDE_FLOAT32_C( 532.89), SIMDE_FLOAT32_C(-236.67), SIMDE_FLOAT32_C( 788.14) },
+      UINT8_C(   14),
+      { SIMDE_FLOAT32_C(-586.80), SIMDE_FLOAT32_C( 995.50), SIMDE_FLOAT32_C(-182.86), SIMDE_FLOAT32_C( 967.23) },
+      { SIMDE_FLOAT32_C( 655.39), SIMDE_FLOAT32_C(   0.001005), SIMDE_FLOAT32_C(  -0.005469), SIMDE_FLOAT32_C(   0.001034) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_rcp14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(   14),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(   0.00),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00) } },
+    #endif
+    { UINT8_C(    1),
+      { SIMDE_FLOAT32_C( 470.29), SIMDE_FLOAT32_C(-943.26), SIMDE_FLOAT32_C(-232.39), SIMDE_FLOAT32_C(-498.22) },
+      { SIMDE_FLOAT32_C(   0.002126), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(   11),
+      { SIMDE_FLOAT32_C( 552.73), SIMDE_FLOAT32_C( 730.81), SIMDE_FLOAT32_C( 378.79), SIMDE_FLOAT32_C( 391.06) },
+      { SIMDE_FLOAT32_C(   0.001809), SIMDE_FLOAT32_C(   0.001368), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.002557) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT32_C(-513.14), SIMDE_FLOAT32_C(-836.67), SIMDE_FLOAT32_C( 253.83), SIMDE_FLOAT32_C(-876.23) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001141) } },
+    { UINT8_C(    9),
+      { SIMDE_FLOAT32_C( 491.86), SIMDE_FLOAT32_C(-644.47), SIMDE_FLOAT32_C(-894.88), SIMDE_FLOAT32_C( 104.43) },
+      { SIMDE_FLOAT32_C(   0.002033), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.009576) } },
+    { UINT8_C(    7),
+      { SIMDE_FLOAT32_C(-441.49), SIMDE_FLOAT32_C( -57.55), SIMDE_FLOAT32_C( 346.38), SIMDE_FLOAT32_C(-861.23) },
+      { SIMDE_FLOAT32_C(  -0.002265), SIMDE_FLOAT32_C(  -0.017376), SIMDE_FLOAT32_C(   0.002887), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    7),
+      { SIMDE_FLOAT32_C( 409.51), SIMDE_FLOAT32_C( 176.49), SIMDE_FLOAT32_C(-377.76), SIMDE_FLOAT32_C(-947.94) },
+      { SIMDE_FLOAT32_C(   0.002442), SIMDE_FLOAT32_C(   0.005666), SIMDE_FLOAT32_C(  -0.002647), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT32_C( 762.04), SIMDE_FLOAT32_C( 932.83), SIMDE_FLOAT32_C( -26.85), SIMDE_FLOAT32_C( 108.50) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.009217) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_rcp14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00) },
+      {        SIMDE_MATH_INFINITY,       -SIMDE_MATH_INFINITY } },
+    #endif
+    { { SIMDE_FLOAT64_C(-195.18), SIMDE_FLOAT64_C(-387.92) },
+      { SIMDE_FLOAT64_C(  -0.005124), SIMDE_FLOAT64_C(  -0.002578) } },
+    { { SIMDE_FLOAT64_C( 755.70), SIMDE_FLOAT64_C(-207.83) },
+      { SIMDE_FLOAT64_C(   0.001323), SIMDE_FLOAT64_C(  -0.004812) } },
+    { { SIMDE_FLOAT64_C( 121.58), SIMDE_FLOAT64_C( 925.52) },
+      { SIMDE_FLOAT64_C(   0.008225), SIMDE_FLOAT64_C(   0.001080) } },
+    { { SIMDE_FLOAT64_C(-500.39), SIMDE_FLOAT64_C(  63.50) },
+      { SIMDE_FLOAT64_C(  -0.001999), SIMDE_FLOAT64_C(   0.015748) } },
+    { { SIMDE_FLOAT64_C( 346.33), SIMDE_FLOAT64_C(-259.39) },
+      { SIMDE_FLOAT64_C(   0.002887), SIMDE_FLOAT64_C(  -0.003855) } },
+    { { SIMDE_FLOAT64_C( 896.63), SIMDE_FLOAT64_C( 237.57) },
+      { SIMDE_FLOAT64_C(   0.001115), SIMDE_FLOAT64_C(   0.004209) } },
+    { { SIMDE_FLOAT64_C(-360.06), SIMDE_FLOAT64_C( -49.67) },
+      { SIMDE_FLOAT64_C(  -0.002777), SIMDE_FLOAT64_C(  -0.020133) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_rcp14_pd(a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 610.68), SIMDE_FLOAT64_C( 390.87) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00) },
+      { SIMDE_FLOAT64_C( 610.68),       -SIMDE_MATH_INFINITY } },
+    #endif
+    { { SIMDE_FLOAT64_C( 961.91), SIMDE_FLOAT64_C( -18.60) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C(-438.08), SIMDE_FLOAT64_C( 433.15) },
+      { SIMDE_FLOAT64_C(  -0.002283), SIMDE_FLOAT64_C(   0.002309) } },
+    { { SIMDE_FLOAT64_C( 948.31), SIMDE_FLOAT64_C(-267.11) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C(-937.46), SIMDE_FLOAT64_C(-633.87) },
+      { SIMDE_FLOAT64_C(  -0.001067), SIMDE_FLOAT64_C(  -0.001578) } },
+    { { SIMDE_FLOAT64_C(-230.33), SIMDE_FLOAT64_C(-423.45) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C( 786.97), SIMDE_FLOAT64_C(-845.05) },
+      { SIMDE_FLOAT64_C(-230.33), SIMDE_FLOAT64_C(-423.45) } },
+    { { SIMDE_FLOAT64_C( 485.33), SIMDE_FLOAT64_C( 492.66) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C( 450.81), SIMDE_FLOAT64_C(-983.06) },
+      { SIMDE_FLOAT64_C( 485.33), SIMDE_FLOAT64_C( 492.66) } },
+    { { SIMDE_FLOAT64_C( 608.19), SIMDE_FLOAT64_C( 915.86) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 136.27), SIMDE_FLOAT64_C( 733.69) },
+      { SIMDE_FLOAT64_C(   0.007338), SIMDE_FLOAT64_C(   0.001363) } },
+    { { SIMDE_FLOAT64_C(-810.44), SIMDE_FLOAT64_C(-742.32) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C(-476.51), SIMDE_FLOAT64_C(-167.23) },
+      { SIMDE_FLOAT64_C(  -0.002099), SIMDE_FLOAT64_C(  -0.005980) } },
+    { { SIMDE_FLOAT64_C(-459.36), SIMDE_FLOAT64_C( 512.11) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C(-886.32), SIMDE_FLOAT64_C( 529.35) },
+      { SIMDE_FLOAT64_C(-459.36), SIMDE_FLOAT64_C(   0.001889) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_rcp14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00) },
+      {        SIMDE_MATH_INFINITY,       -SIMDE_MATH_INFINITY } },
+    #endif
+    { UINT8_C(    0),
+      { SIMDE_FLOAT64_C( 212.64), SIMDE_FLOAT64_C( 602.71) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C(-941.79), SIMDE_FLOAT64_C( -88.20) },
+      { SIMDE_FLOAT64_C(  -0.001062), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C( -95.50), SIMDE_FLOAT64_C(-487.88) },
+      { SIMDE_FLOAT64_C(  -0.010471), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 711.60), SIMDE_FLOAT64_C( 164.13) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.006093) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 931.26), SIMDE_FLOAT64_C( 940.55) },
+      { SIMDE_FLOAT64_C(   0.001074), SIMDE_FLOAT64_C(   0.001063) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(-396.76), SIMDE_FLOAT64_C( -32.74) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.030545) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(-370.20), SIMDE_FLOAT64_C( 849.05) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.001178) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_rcp14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   1.00) } },
+    { { SIMDE_FLOAT32_C(5.877471754e-39), SIMDE_FLOAT32_C(-5.877471754e-39), SIMDE_FLOAT32_C(1.0e-39), SIMDE_FLOAT32_C(-1.401298464e-45), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(-0.0), SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(-1.0e-39) },
+      { SIMDE_FLOAT32_C(1.701411835e38), SIMDE_FLOAT32_C(-1.701411835e38), SIMDE_MATH_INFINITYF, -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(8.507059173e37), -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.175494351e-38), -SIMDE_MATH_INFINITYF } },
+    #endif
+    { { SIMDE_FLOAT32_C(-153.08), SIMDE_FLOAT32_C( 118.41), SIMDE_FLOAT32_C( 517.26), SIMDE_FLOAT32_C( 279.61),
+        SIMDE_FLOAT32_C(-560.18), SIMDE_FLOAT32_C( 869.92), SIMDE_FLOAT32_C(-414.45), SIMDE_FLOAT32_C(-344.51) },
+      { SIMDE_FLOAT32_C(  -0.006533), SIMDE_FLOAT32_C(   0.008445), SIMDE_FLOAT32_C(   0.001933), SIMDE_FLOAT32_C(   0.003576),
+        SIMDE_FLOAT32_C(  -0.001785), SIMDE_FLOAT32_C(   0.001150), SIMDE_FLOAT32_C(  -0.002413), SIMDE_FLOAT32_C(  -0.002903) } },
+    { { SIMDE_FLOAT32_C(-346.25), SIMDE_FLOAT32_C(-805.98), SIMDE_FLOAT32_C(-287.23), SIMDE_FLOAT32_C(-951.85),
+        SIMDE_FLOAT32_C( 128.30), SIMDE_FLOAT32_C( 299.34), SIMDE_FLOAT32_C( 509.94), SIMDE_FLOAT32_C(-829.06) },
+      { SIMDE_FLOAT32_C(  -0.002888), SIMDE_FLOAT32_C(  -0.001241), SIMDE_FLOAT32_C(  -0.003482), SIMDE_FLOAT32_C(  -0.001051),
+        SIMDE_FLOAT32_C(   0.007794), SIMDE_FLOAT32_C(   0.003341), SIMDE_FLOAT32_C(   0.001961), SIMDE_FLOAT32_C(  -0.001206) } },
+    { { SIMDE_FLOAT32_C(-462.36), SIMDE_FLOAT32_C( 555.32), SIMDE_FLOAT32_C(-970.78), SIMDE_FLOAT32_C( 613.16),
+        SIMDE_FLOAT32_C( 920.47), SIMDE_FLOAT32_C( 681.42), SIMDE_FLOAT32_C(-485.01), SIMDE_FLOAT32_C(-204.03) },
+      { SIMDE_FLOAT32_C(  -0.002163), SIMDE_FLOAT32_C(   0.001801), SIMDE_FLOAT32_C(  -0.001030), SIMDE_FLOAT32_C(   0.001631),
+        SIMDE_FLOAT32_C(   0.001086), SIMDE_FLOAT32_C(   0.001468), SIMDE_FLOAT32_C(  -0.002062), SIMDE_FLOAT32_C(  -0.004901) } },
+    { { SIMDE_FLOAT32_C(-765.89), SIMDE_FLOAT32_C( 645.18), SIMDE_FLOAT32_C(-930.67), SIMDE_FLOAT32_C(-284.99),
+        SIMDE_FLOAT32_C(-665.29), SIMDE_FLOAT32_C( -21.93), SIMDE_FLOAT32_C(-645.88), SIMDE_FLOAT32_C(-111.81) },
+      { SIMDE_FLOAT32_C(  -0.001306), SIMDE_FLOAT32_C(   0.001550), SIMDE_FLOAT32_C(  -0.001075), SIMDE_FLOAT32_C(  -0.003509),
+        SIMDE_FLOAT32_C(  -0.001503), SIMDE_FLOAT32_C(  -0.045600), SIMDE_FLOAT32_C(  -0.001548), SIMDE_FLOAT32_C(  -0.008944) } },
+    { { SIMDE_FLOAT32_C( 746.55), SIMDE_FLOAT32_C( 882.72), SIMDE_FLOAT32_C(-368.02), SIMDE_FLOAT32_C( 651.85),
+        SIMDE_FLOAT32_C( 265.21), SIMDE_FLOAT32_C( 823.11), SIMDE_FLOAT32_C(-350.02), SIMDE_FLOAT32_C(-800.89) },
+      { SIMDE_FLOAT32_C(   0.001340), SIMDE_FLOAT32_C(   0.001133), SIMDE_FLOAT32_C(  -0.002717), SIMDE_FLOAT32_C(   0.001534),
+        SIMDE_FLOAT32_C(   0.003771), SIMDE_FLOAT32_C(   0.001215), SIMDE_FLOAT32_C(  -0.002857), SIMDE_FLOAT32_C(  -0.001249) } },
+    { { SIMDE_FLOAT32_C(-147.40), SIMDE_FLOAT32_C(  27.66), SIMDE_FLOAT32_C(-644.28), SIMDE_FLOAT32_C( 179.81),
+        SIMDE_FLOAT32_C( -34.99), SIMDE_FLOAT32_C( 716.65), SIMDE_FLOAT32_C( 611.07), SIMDE_FLOAT32_C(-877.62) },
+      { SIMDE_FLOAT32_C(  -0.006784), SIMDE_FLOAT32_C(   0.036154), SIMDE_FLOAT32_C(  -0.001552), SIMDE_FLOAT32_C(   0.005561),
+        SIMDE_FLOAT32_C(  -0.028579), SIMDE_FLOAT32_C(   0.001395), SIMDE_FLOAT32_C(   0.001637), SIMDE_FLOAT32_C(  -0.001139) } },
+    { { SIMDE_FLOAT32_C( 398.27), SIMDE_FLOAT32_C(-521.12), SIMDE_FLOAT32_C( -44.70), SIMDE_FLOAT32_C(-446.00),
+        SIMDE_FLOAT32_C(  87.05), SIMDE_FLOAT32_C(-895.79), SIMDE_FLOAT32_C(-303.10), SIMDE_FLOAT32_C( 878.17) },
+      { SIMDE_FLOAT32_C(   0.002511), SIMDE_FLOAT32_C(  -0.001919), SIMDE_FLOAT32_C(  -0.022372), SIMDE_FLOAT32_C(  -0.002242),
+        SIMDE_FLOAT32_C(   0.011487), SIMDE_FLOAT32_C(  -0.001116), SIMDE_FLOAT32_C(  -0.003299), SIMDE_FLOAT32_C(   0.001139) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_rcp14_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rcp14_ps_bound (SIMDE_MUNIT_TEST_ARGS) {
+  const simde_float32* inputs = simde_test_rcp14_ps_bound_inputs;
+  simde_float32 r[8];
+
+  for (size_t i = 0 ; i < (sizeof(simde_test_rcp14_ps_bound_inputs) / sizeof(simde_test_rcp14_ps_bound_inputs[0])) ; i += 8) {
+    simde_mm256_storeu_ps(r, simde_mm256_rcp14_ps(simde_mm256_loadu_ps(&(inputs[i]))));
+    for (size_t j = 0 ; j < 8 ; j++) {
+      simde_assert_equal_i(simde_test_rcp14_ps_within_bound(inputs[i + j], r[j]), 1);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(-373.01), SIMDE_FLOAT32_C(-991.11), SIMDE_FLOAT32_C( 548.53), SIMDE_FLOAT32_C( 752.17),
+        SIMDE_FLOAT32_C(  -6.06), SIMDE_FLOAT32_C(-279.53), SIMDE_FLOAT32_C( 114.80), SIMDE_FLOAT32_C(-767.64) },
+      UINT8_C(   57),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-991.11), SIMDE_FLOAT32_C( 548.53), SIMDE_FLOAT32_C(  -0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C( 114.80), SIMDE_FLOAT32_C(-767.64) } },
+    #endif
+    { { SIMDE_FLOAT32_C(-316.64), SIMDE_FLOAT32_C(  85.73), SIMDE_FLOAT32_C( -82.92), SIMDE_FLOAT32_C( -29.23),
+        SIMDE_FLOAT32_C(  40.83), SIMDE_FLOAT32_C( 547.51), SIMDE_FLOAT32_C( -94.89), SIMDE_FLOAT32_C(-504.80) },
+      UINT8_C(  252),
+      { SIMDE_FLOAT32_C( 246.53), SIMDE_FLOAT32_C(-482.12), SIMDE_FLOAT32_C(-971.56), SIMDE_FLOAT32_C( 479.05),
+        SIMDE_FLOAT32_C(-974.95), SIMDE_FLOAT32_C( 779.34), SIMDE_FLOAT32_C(-178.19), SIMDE_FLOAT32_C(-274.26) },
+      { SIMDE_FLOAT32_C(-316.64), SIMDE_FLOAT32_C(  85.73), SIMDE_FLOAT32_C(  -0.001029), SIMDE_FLOAT32_C(   0.002088),
+        SIMDE_FLOAT32_C(  -0.001026), SIMDE_FLOAT32_C(   0.001283), SIMDE_FLOAT32_C(  -0.005612), SIMDE_FLOAT32_C(  -0.003646) } },
+    { { SIMDE_FLOAT32_C( 855.98), SIMDE_FLOAT32_C( 763.90), SIMDE_FLOAT32_C( 543.67), SIMDE_FLOAT32_C( 229.87),
+        SIMDE_FLOAT32_C( 194.48), SIMDE_FLOAT32_C( 892.88), SIMDE_FLOAT32_C(-399.80), SIMDE_FLOAT32_C(-316.18) },
+      UINT8_C(   16),
+      { SIMDE_FLOAT32_C( 974.21), SIMDE_FLOAT32_C(-858.84), SIMDE_FLOAT32_C(-162.54), SIMDE_FLOAT32_C( 315.19),
+        SIMDE_FLOAT32_C( -44.78), SIMDE_FLOAT32_C(-754.10), SIMDE_FLOAT32_C(-380.76), SIMDE_FLOAT32_C( 567.20) },
+      { SIMDE_FLOAT32_C( 855.98), SIMDE_FLOAT32_C( 763.90), SIMDE_FLOAT32_C( 543.67), SIMDE_FLOAT32_C( 229.87),
+        SIMDE_FLOAT32_C(  -0.022332), SIMDE_FLOAT32_C( 892.88), SIMDE_FLOAT32_C(-399.80), SIMDE_FLOAT32_C(-316.18) } },
+    { { SIMDE_FLOAT32_C( 163.69), SIMDE_FLOAT32_C( 824.23), SIMDE_FLOAT32_C(-583.71), SIMDE_FLOAT32_C(-500.98),
+        SIMDE_FLOAT32_C( 919.48), SIMDE_FLOAT32_C(-744.90), SIMDE_FLOAT32_C( 673.48), SIMDE_FLOAT32_C( 429.16) },
+      UINT8_C(   69),
+      { SIMDE_FLOAT32_C(-820.00), SIMDE_FLOAT32_C(-935.16), SIMDE_FLOAT32_C(-790.69), SIMDE_FLOAT32_C(-288.06),
+        SIMDE_FLOAT32_C( 531.41), SIMDE_FLOAT32_C(-639.54), SIMDE_FLOAT32_C( 951.90), SIMDE_FLOAT32_C( 430.27) },
+      { SIMDE_FLOAT32_C(  -0.001220), SIMDE_FLOAT32_C( 824.23), SIMDE_FLOAT32_C(  -0.001265), SIMDE_FLOAT32_C(-500.98),
+        SIMDE_FLOAT32_C( 919.48), SIMDE_FLOAT32_C(-744.90), SIMDE_FLOAT32_C(   0.001051), SIMDE_FLOAT32_C( 429.16) } },
+    { { SIMDE_FLOAT32_C( 726.78), SIMDE_FLOAT32_C(-221.05), SIMDE_FLOAT32_C(-522.19), SIMDE_FLOAT32_C(-465.89),
+        SIMDE_FLOAT32_C(-584.47), SIMDE_FLOAT32_C( 786.19), SIMDE_FLOAT32_C( 357.37), SIMDE_FLOAT32_C( 461.27) },
+      UINT8_C(  124),
+      { SIMDE_FLOAT32_C(-363.26), SIMDE_FLOAT32_C(-211.53), SIMDE_FLOAT32_C(-145.51), SIMDE_FLOAT32_C( 212.25),
+        SIMDE_FLOAT32_C(-699.84), SIMDE_FLOAT32_C(-380.45), SIMDE_FLOAT32_C( 394.55), SIMDE_FLOAT32_C(-410.65) },
+      { SIMDE_FLOAT32_C( 726.78), SIMDE_FLOAT32_C(-221.05), SIMDE_FLOAT32_C(  -0.006872), SIMDE_FLOAT32_C(   0.004711),
+        SIMDE_FLOAT32_C(  -0.001429), SIMDE_FLOAT32_C(  -0.002628), SIMDE_FLOAT32_C(   0.002535), SIMDE_FLOAT32_C( 461.27) } },
+    { { SIMDE_FLOAT32_C(-918.84), SIMDE_FLOAT32_C(-169.65), SIMDE_FLOAT32_C(-640.09), SIMDE_FLOAT32_C(-370.98),
+        SIMDE_FLOAT32_C(-212.42), SIMDE_FLOAT32_C( 189.11), SIMDE_FLOAT32_C( 980.15), SIMDE_FLOAT32_C( 960.45) },
+      UINT8_C(   89),
+      { SIMDE_FLOAT32_C( 968.62), SIMDE_FLOAT32_C(-353.63), SIMDE_FLOAT32_C(-918.36), SIMDE_FLOAT32_C(-636.93),
+        SIMDE_FLOAT32_C(-884.42), SIMDE_FLOAT32_C( 792.27), SIMDE_FLOAT32_C( 428.56), SIMDE_FLOAT32_C( -13.71) },
+      { SIMDE_FLOAT32_C(   0.001032), SIMDE_FLOAT32_C(-169.65), SIMDE_FLOAT32_C(-640.09), SIMDE_FLOAT32_C(  -0.001570),
+        SIMDE_FLOAT32_C(  -0.001131), SIMDE_FLOAT32_C( 189.11), SIMDE_FLOAT32_C(   0.002333), SIMDE_FLOAT32_C( 960.45) } },
+    { { SIMDE_FLOAT32_C(-667.91), SIMDE_FLOAT32_C( 278.65), SIMDE_FLOAT32_C(-566.09), SIMDE_FLOAT32_C( 272.36),
+        SIMDE_FLOAT32_C(-179.33), SIMDE_FLOAT32_C( 547.04), SIMDE_FLOAT32_C(-950.85), SIMDE_FLOAT32_C( 693.63) },
+      UINT8_C(  255),
+      { SIMDE_FLOAT32_C(-174.62), SIMDE_FLOAT32_C( 251.40), SIMDE_FLOAT32_C( 479.15), SIMDE_FLOAT32_C( -64.00),
+        SIMDE_FLOAT32_C( 672.60), SIMDE_FLOAT32_C(-355.32), SIMDE_FLOAT32_C( 944.76), SIMDE_FLOAT32_C(-295.53) },
+      { SIMDE_FLOAT32_C(  -0.005727), SIMDE_FLOAT32_C(   0.003978), SIMDE_FLOAT32_C(   0.002087), SIMDE_FLOAT32_C(  -0.015625),
+        SIMDE_FLOAT32_C(   0.001487), SIMDE_FLOAT32_C(  -0.002814), SIMDE_FLOAT32_C(   0.001058), SIMDE_FLOAT32_C(  -0.003384) } },
+    { { SIMDE_FLOAT32_C( 640.02), SIMDE_FLOAT32_C( 808.95), SIMDE_FLOAT32_C(  23.04), SIMDE_FLOAT32_C( 953.72),
+        SIMDE_FLOAT32_C(-909.46), SIMDE_FLOAT32_C( -90.54), SIMDE_FLOAT32_C(-493.90), SIMDE_FLOAT32_C( 783.32) },
+      UINT8_C(   78),
+      { SIMDE_FLOAT32_C(-770.00), SIMDE_FLOAT32_C( 847.48), SIMDE_FLOAT32_C(-893.56), SIMDE_FLOAT32_C(-329.84),
+        SIMDE_FLOAT32_C( 250.77), SIMDE_FLOAT32_C(-531.16), SIMDE_FLOAT32_C(-874.05), SIMDE_FLOAT32_C(-910.89) },
+      { SIMDE_FLOAT32_C( 640.02), SIMDE_FLOAT32_C(   0.001180), SIMDE_FLOAT32_C(  -0.001119), SIMDE_FLOAT32_C(  -0.003032),
+        SIMDE_FLOAT32_C(-909.46), SIMDE_FLOAT32_C( -90.54), SIMDE_FLOAT32_C(  -0.001144), SIMDE_FLOAT32_C( 783.32) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_rcp14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    3),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    #endif
+    { UINT8_C(  179),
+      { SIMDE_FLOAT32_C( 880.35), SIMDE_FLOAT32_C( 856.20), SIMDE_FLOAT32_C(  47.48), SIMDE_FLOAT32_C(-402.56),
+        SIMDE_FLOAT32_C( 379.62), SIMDE_FLOAT32_C(-306.33), SIMDE_FLOAT32_C( -92.45), SIMDE_FLOAT32_C( 549.66) },
+      { SIMDE_FLOAT32_C(   0.001136), SIMDE_FLOAT32_C(   0.001168), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.002634), SIMDE_FLOAT32_C(  -0.003265), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.001819) } },
+    { UINT8_C(  217),
+      { SIMDE_FLOAT32_C( 372.99), SIMDE_FLOAT32_C( 292.49), SIMDE_FLOAT32_C( 972.35), SIMDE_FLOAT32_C( 396.42),
+        SIMDE_FLOAT32_C( 808.86), SIMDE_FLOAT32_C(-840.02), SIMDE_FLOAT32_C( 312.80), SIMDE_FLOAT32_C(-477.36) },
+      { SIMDE_FLOAT32_C(   0.002681), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.002523),
+        SIMDE_FLOAT32_C(   0.001236), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.003197), SIMDE_FLOAT32_C(  -0.002095) } },
+    { UINT8_C(   35),
+      { SIMDE_FLOAT32_C( 944.54), SIMDE_FLOAT32_C(-876.26), SIMDE_FLOAT32_C(-878.00), SIMDE_FLOAT32_C( 450.17),
+        SIMDE_FLOAT32_C( 136.42), SIMDE_FLOAT32_C(-526.37), SIMDE_FLOAT32_C( 605.99), SIMDE_FLOAT32_C(-862.87) },
+      { SIMDE_FLOAT32_C(   0.001059), SIMDE_FLOAT32_C(  -0.001141), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001900), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(   40),
+      { SIMDE_FLOAT32_C(-823.96), SIMDE_FLOAT32_C(-517.29), SIMDE_FLOAT32_C(-337.30), SIMDE_FLOAT32_C( -51.64),
+        SIMDE_FLOAT32_C(-172.98), SIMDE_FLOAT32_C( 973.90), SIMDE_FLOAT32_C(-768.20), SIMDE_FLOAT32_C(-519.45) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.019365),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.001027), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(  254),
+      { SIMDE_FLOAT32_C( 542.44), SIMDE_FLOAT32_C( 138.42), SIMDE_FLOAT32_C(-216.87), SIMDE_FLOAT32_C( 746.43),
+        SIMDE_FLOAT32_C( 735.02), SIMDE_FLOAT32_C(-939.38), SIMDE_FLOAT32_C(  63.98), SIMDE_FLOAT32_C(-166.88) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.007224), SIMDE_FLOAT32_C(  -0.004611), SIMDE_FLOAT32_C(   0.001340),
+        SIMDE_FLOAT32_C(   0.001361), SIMDE_FLOAT32_C(  -0.001065), SIMDE_FLOAT32_C(   0.015630), SIMDE_FLOAT32_C(  -0.005992) } },
+    { UINT8_C(  108),
+      { SIMDE_FLOAT32_C( 103.18), SIMDE_FLOAT32_C(-517.87), SIMDE_FLOAT32_C( 247.80), SIMDE_FLOAT32_C(-877.40),
+        SIMDE_FLOAT32_C(-460.41), SIMDE_FLOAT32_C( 499.32), SIMDE_FLOAT32_C( 647.58), SIMDE_FLOAT32_C(-512.20) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.004036), SIMDE_FLOAT32_C(  -0.001140),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.002003), SIMDE_FLOAT32_C(   0.001544), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(   66),
+      { SIMDE_FLOAT32_C(-611.50), SIMDE_FLOAT32_C(-729.95), SIMDE_FLOAT32_C(-482.24), SIMDE_FLOAT32_C( 431.53),
+        SIMDE_FLOAT32_C(-459.46), SIMDE_FLOAT32_C( 262.17), SIMDE_FLOAT32_C(-911.40), SIMDE_FLOAT32_C(-372.16) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001370), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001097), SIMDE_FLOAT32_C(   0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_rcp14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY },
+      {        SIMDE_MATH_INFINITY,       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C( 665.44), SIMDE_FLOAT64_C( 851.55), SIMDE_FLOAT64_C( 711.12), SIMDE_FLOAT64_C(-522.43) },
+      { SIMDE_FLOAT64_C(   0.001503), SIMDE_FLOAT64_C(   0.001174), SIMDE_FLOAT64_C(   0.001406), SIMDE_FLOAT64_C(  -0.001914) } },
+    { { SIMDE_FLOAT64_C(-725.22), SIMDE_FLOAT64_C( 119.45), SIMDE_FLOAT64_C(-111.85), SIMDE_FLOAT64_C(  40.24) },
+      { SIMDE_FLOAT64_C(  -0.001379), SIMDE_FLOAT64_C(   0.008372), SIMDE_FLOAT64_C(  -0.008941), SIMDE_FLOAT64_C(   0.024852) } },
+    { { SIMDE_FLOAT64_C( 571.08), SIMDE_FLOAT64_C(  19.76), SIMDE_FLOAT64_C(-455.22), SIMDE_FLOAT64_C( 214.36) },
+      { SIMDE_FLOAT64_C(   0.001751), SIMDE_FLOAT64_C(   0.050607), SIMDE_FLOAT64_C(  -0.002197), SIMDE_FLOAT64_C(   0.004665) } },
+    { { SIMDE_FLOAT64_C( 369.30), SIMDE_FLOAT64_C(-571.02), SIMDE_FLOAT64_C(-423.54), SIMDE_FLOAT64_C(-623.71) },
+      { SIMDE_FLOAT64_C(   0.002708), SIMDE_FLOAT64_C(  -0.001751), SIMDE_FLOAT64_C(  -0.002361), SIMDE_FLOAT64_C(  -0.001603) } },
+    { { SIMDE_FLOAT64_C( 929.95), SIMDE_FLOAT64_C( 603.82), SIMDE_FLOAT64_C( 934.60), SIMDE_FLOAT64_C(-667.39) },
+      { SIMDE_FLOAT64_C(   0.001075), SIMDE_FLOAT64_C(   0.001656), SIMDE_FLOAT64_C(   0.001070), SIMDE_FLOAT64_C(  -0.001498) } },
+    { { SIMDE_FLOAT64_C(-229.40), SIMDE_FLOAT64_C(-515.49), SIMDE_FLOAT64_C(-166.29), SIMDE_FLOAT64_C( 308.44) },
+      { SIMDE_FLOAT64_C(  -0.004359), SIMDE_FLOAT64_C(  -0.001940), SIMDE_FLOAT64_C(  -0.006014), SIMDE_FLOAT64_C(   0.003242) } },
+    { { SIMDE_FLOAT64_C( 955.16), SIMDE_FLOAT64_C(-516.50), SIMDE_FLOAT64_C( 841.36), SIMDE_FLOAT64_C(-388.87) },
+      { SIMDE_FLOAT64_C(   0.001047), SIMDE_FLOAT64_C(  -0.001936), SIMDE_FLOAT64_C(   0.001189), SIMDE_FLOAT64_C(  -0.002572) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_rcp14_pd(a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 362.20), SIMDE_FLOAT64_C(   9.27), SIMDE_FLOAT64_C(  84.72), SIMDE_FLOAT64_C( 961.70) },
+      UINT8_C(    5),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY },
+      {        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   9.27), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C( 961.70) } },
+    #endif
+    { { SIMDE_FLOAT64_C(-451.81), SIMDE_FLOAT64_C(-876.12), SIMDE_FLOAT64_C(  61.29), SIMDE_FLOAT64_C( 425.37) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT64_C( -36.64), SIMDE_FLOAT64_C( 411.26), SIMDE_FLOAT64_C(-982.93), SIMDE_FLOAT64_C(-384.87) },
+      { SIMDE_FLOAT64_C(  -0.027293), SIMDE_FLOAT64_C(   0.002432), SIMDE_FLOAT64_C(  -0.001017), SIMDE_FLOAT64_C(  -0.002598) } },
+    { { SIMDE_FLOAT64_C(-104.15), SIMDE_FLOAT64_C( 597.53), SIMDE_FLOAT64_C(-315.22), SIMDE_FLOAT64_C( 417.06) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 821.41), SIMDE_FLOAT64_C(-906.32), SIMDE_FLOAT64_C(-312.75), SIMDE_FLOAT64_C(-740.78) },
+      { SIMDE_FLOAT64_C(-104.15), SIMDE_FLOAT64_C(  -0.001103), SIMDE_FLOAT64_C(-315.22), SIMDE_FLOAT64_C( 417.06) } },
+    { { SIMDE_FLOAT64_C(  64.78), SIMDE_FLOAT64_C(-287.62), SIMDE_FLOAT64_C( 499.57), SIMDE_FLOAT64_C(-402.36) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT64_C( -69.03), SIMDE_FLOAT64_C( 511.18), SIMDE_FLOAT64_C(-476.25), SIMDE_FLOAT64_C( -35.78) },
+      { SIMDE_FLOAT64_C(  -0.014486), SIMDE_FLOAT64_C(   0.001956), SIMDE_FLOAT64_C(  -0.002100), SIMDE_FLOAT64_C(  -0.027949) } },
+    { { SIMDE_FLOAT64_C( 906.65), SIMDE_FLOAT64_C(-377.41), SIMDE_FLOAT64_C(-756.26), SIMDE_FLOAT64_C(-215.74) },
+      UINT8_C(    9),
+      { SIMDE_FLOAT64_C(-125.08), SIMDE_FLOAT64_C( 173.27), SIMDE_FLOAT64_C(-437.58), SIMDE_FLOAT64_C(-965.59) },
+      { SIMDE_FLOAT64_C(  -0.007995), SIMDE_FLOAT64_C(-377.41), SIMDE_FLOAT64_C(-756.26), SIMDE_FLOAT64_C(  -0.001036) } },
+    { { SIMDE_FLOAT64_C(  21.33), SIMDE_FLOAT64_C(-258.60), SIMDE_FLOAT64_C(-942.12), SIMDE_FLOAT64_C(-391.66) },
+      UINT8_C(    9),
+      { SIMDE_FLOAT64_C( 312.36), SIMDE_FLOAT64_C( 321.62), SIMDE_FLOAT64_C(-691.26), SIMDE_FLOAT64_C(-202.86) },
+      { SIMDE_FLOAT64_C(   0.003201), SIMDE_FLOAT64_C(-258.60), SIMDE_FLOAT64_C(-942.12), SIMDE_FLOAT64_C(  -0.004930) } },
+    { { SIMDE_FLOAT64_C(-932.90), SIMDE_FLOAT64_C(-455.64), SIMDE_FLOAT64_C( -14.46), SIMDE_FLOAT64_C(-569.40) },
+      UINT8_C(    6),
+      { SIMDE_FLOAT64_C(-964.91), SIMDE_FLOAT64_C(  24.84), SIMDE_FLOAT64_C(-875.90), SIMDE_FLOAT64_C( 623.43) },
+      { SIMDE_FLOAT64_C(-932.90), SIMDE_FLOAT64_C(   0.040258), SIMDE_FLOAT64_C(  -0.001142), SIMDE_FLOAT64_C(-569.40) } },
+    { { SIMDE_FLOAT64_C(-759.86), SIMDE_FLOAT64_C( 886.68), SIMDE_FLOAT64_C(-233.08), SIMDE_FLOAT64_C(-725.44) },
+      UINT8_C(   11),
+      { SIMDE_FLOAT64_C( 354.56), SIMDE_FLOAT64_C( 904.66), SIMDE_FLOAT64_C(-513.16), SIMDE_FLOAT64_C( 261.02) },
+      { SIMDE_FLOAT64_C(   0.002820), SIMDE_FLOAT64_C(   0.001105), SIMDE_FLOAT64_C(-233.08), SIMDE_FLOAT64_C(   0.003831) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_rcp14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    7),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY },
+      {        SIMDE_MATH_INFINITY,       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    #endif
+    { UINT8_C(   13),
+      { SIMDE_FLOAT64_C( 601.45), SIMDE_FLOAT64_C( 700.36), SIMDE_FLOAT64_C(-506.40), SIMDE_FLOAT64_C( 395.30) },
+      { SIMDE_FLOAT64_C(   0.001663), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.001975), SIMDE_FLOAT64_C(   0.002530) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT64_C(-897.62), SIMDE_FLOAT64_C( 754.48), SIMDE_FLOAT64_C( 369.63), SIMDE_FLOAT64_C(-859.63) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.001163) } },
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C(-233.45), SIMDE_FLOAT64_C(-464.95), SIMDE_FLOAT64_C( -39.15), SIMDE_FLOAT64_C(-580.62) },
+      { SIMDE_FLOAT64_C(  -0.004284), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C(-520.56), SIMDE_FLOAT64_C( 497.87), SIMDE_FLOAT64_C(-990.10), SIMDE_FLOAT64_C(-820.66) },
+      { SIMDE_FLOAT64_C(  -0.001921), SIMDE_FLOAT64_C(   0.002009), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    6),
+      { SIMDE_FLOAT64_C( 703.74), SIMDE_FLOAT64_C( 960.89), SIMDE_FLOAT64_C( 307.01), SIMDE_FLOAT64_C( 909.41) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.001041), SIMDE_FLOAT64_C(   0.003257), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    7),
+      { SIMDE_FLOAT64_C( 338.65), SIMDE_FLOAT64_C(-483.53), SIMDE_FLOAT64_C(-117.83), SIMDE_FLOAT64_C(-721.97) },
+      { SIMDE_FLOAT64_C(   0.002953), SIMDE_FLOAT64_C(  -0.002068), SIMDE_FLOAT64_C(  -0.008487), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 363.73), SIMDE_FLOAT64_C( 894.90), SIMDE_FLOAT64_C(-693.39), SIMDE_FLOAT64_C( 900.62) },
+      { SIMDE_FLOAT64_C(   0.002749), SIMDE_FLOAT64_C(   0.001117), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_rcp14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   1.00),
+              SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   1.00) } },
+    { { SIMDE_FLOAT32_C(5.877471754e-39), SIMDE_FLOAT32_C(-5.877471754e-39), SIMDE_FLOAT32_C(1.0e-39), SIMDE_FLOAT32_C(-1.401298464e-45), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(-0.0), SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(-1.0e-39),
+        SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(-0.0), SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(5.877471754e-39), SIMDE_FLOAT32_C(-5.877471754e-39), SIMDE_FLOAT32_C(1.0e-39), SIMDE_FLOAT32_C(-1.401298464e-45) },
+      { SIMDE_FLOAT32_C(1.701411835e38), SIMDE_FLOAT32_C(-1.701411835e38), SIMDE_MATH_INFINITYF, -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(8.507059173e37), -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.175494351e-38), -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(8.507059173e37), -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.175494351e-38), -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(1.701411835e38), SIMDE_FLOAT32_C(-1.701411835e38), SIMDE_MATH_INFINITYF, -SIMDE_MATH_INFINITYF } },
+    #endif
+    { { SIMDE_FLOAT32_C( 106.47), SIMDE_FLOAT32_C(-595.43), SIMDE_FLOAT32_C( 777.57), SIMDE_FLOAT32_C(-394.61),
+        SIMDE_FLOAT32_C( 604.03), SIMDE_FLOAT32_C( -15.60), SIMDE_FLOAT32_C(-867.73), SIMDE_FLOAT32_C( 926.34),
+        SIMDE_FLOAT32_C(-444.16), SIMDE_FLOAT32_C( 777.69), SIMDE_FLOAT32_C(-304.04), SIMDE_FLOAT32_C(-871.40),
+        SIMDE_FLOAT32_C(  41.43), SIMDE_FLOAT32_C( 819.22), SIMDE_FLOAT32_C( 158.53), SIMDE_FLOAT32_C(-921.52) },
+      { SIMDE_FLOAT32_C(   0.009392), SIMDE_FLOAT32_C(  -0.001679), SIMDE_FLOAT32_C(   0.001286), SIMDE_FLOAT32_C(  -0.002534),
+        SIMDE_FLOAT32_C(   0.001656), SIMDE_FLOAT32_C(  -0.064105), SIMDE_FLOAT32_C(  -0.001152), SIMDE_FLOAT32_C(   0.001080),
+        SIMDE_FLOAT32_C(  -0.002251), SIMDE_FLOAT32_C(   0.001286), SIMDE_FLOAT32_C(  -0.003289), SIMDE_FLOAT32_C(  -0.001148),
+        SIMDE_FLOAT32_C(   0.024137), SIMDE_FLOAT32_C(   0.001221), SIMDE_FLOAT32_C(   0.006308), SIMDE_FLOAT32_C(  -0.001085) } },
+    { { SIMDE_FLOAT32_C(  81.19), SIMDE_FLOAT32_C(-113.22), SIMDE_FLOAT32_C( 595.98), SIMDE_FLOAT32_C(-163.42),
+        SIMDE_FLOAT32_C( 120.68), SIMDE_FLOAT32_C( 889.24), SIMDE_FLOAT32_C(-822.51), SIMDE_FLOAT32_C(-563.70),
+        SIMDE_FLOAT32_C( 219.52), SIMDE_FLOAT32_C( 734.44), SIMDE_FLOAT32_C(-131.28), SIMDE_FLOAT32_C( 690.39),
+        SIMDE_FLOAT32_C(  -4.00), SIMDE_FLOAT32_C(-694.09), SIMDE_FLOAT32_C( 657.37), SIMDE_FLOAT32_C( 773.62) },
+      { SIMDE_FLOAT32_C(   0.012317), SIMDE_FLOAT32_C(  -0.008832), SIMDE_FLOAT32_C(   0.001678), SIMDE_FLOAT32_C(  -0.006119),
+        SIMDE_FLOAT32_C(   0.008286), SIMDE_FLOAT32_C(   0.001125), SIMDE_FLOAT32_C(  -0.001216), SIMDE_FLOAT32_C(  -0.001774),
+        SIMDE_FLOAT32_C(   0.004555), SIMDE_FLOAT32_C(   0.001362), SIMDE_FLOAT32_C(  -0.007618), SIMDE_FLOAT32_C(   0.001448),
+        SIMDE_FLOAT32_C(  -0.25), SIMDE_FLOAT32_C(  -0.001441), SIMDE_FLOAT32_C(   0.001521), SIMDE_FLOAT32_C(   0.001293) } },
+    { { SIMDE_FLOAT32_C(-352.06), SIMDE_FLOAT32_C( 599.14), SIMDE_FLOAT32_C( 837.01), SIMDE_FLOAT32_C(-963.55),
+        SIMDE_FLOAT32_C( 172.23), SIMDE_FLOAT32_C( 536.13), SIMDE_FLOAT32_C( 486.93), SIMDE_FLOAT32_C(-204.84),
+        SIMDE_FLOAT32_C( 513.11), SIMDE_FLOAT32_C( -81.01), SIMDE_FLOAT32_C(-994.16), SIMDE_FLOAT32_C(-605.80),
+        SIMDE_FLOAT32_C( 308.97), SIMDE_FLOAT32_C( 939.32), SIMDE_FLOAT32_C(-817.12), SIMDE_FLOAT32_C( 529.91) },
+      { SIMDE_FLOAT32_C(  -0.002840), SIMDE_FLOAT32_C(   0.001669), SIMDE_FLOAT32_C(   0.001195), SIMDE_FLOAT32_C(  -0.001038),
+        SIMDE_FLOAT32_C(   0.005806), SIMDE_FLOAT32_C(   0.001865), SIMDE_FLOAT32_C(   0.002054), SIMDE_FLOAT32_C(  -0.004882),
+        SIMDE_FLOAT32_C(   0.001949), SIMDE_FLOAT32_C(  -0.012344), SIMDE_FLOAT32_C(  -0.001006), SIMDE_FLOAT32_C(  -0.001651),
+        SIMDE_FLOAT32_C(   0.003237), SIMDE_FLOAT32_C(   0.001065), SIMDE_FLOAT32_C(  -0.001224), SIMDE_FLOAT32_C(   0.001887) } },
+    { { SIMDE_FLOAT32_C( 152.33), SIMDE_FLOAT32_C(-966.41), SIMDE_FLOAT32_C( 314.95), SIMDE_FLOAT32_C(-455.08),
+        SIMDE_FLOAT32_C( 817.60), SIMDE_FLOAT32_C( 403.70), SIMDE_FLOAT32_C(-175.52), SIMDE_FLOAT32_C(-113.56),
+        SIMDE_FLOAT32_C(-642.10), SIMDE_FLOAT32_C( -96.61), SIMDE_FLOAT32_C(-783.48), SIMDE_FLOAT32_C( 953.28),
+        SIMDE_FLOAT32_C( 110.98), SIMDE_FLOAT32_C( 296.60), SIMDE_FLOAT32_C(-913.70), SIMDE_FLOAT32_C(-376.60) },
+      { SIMDE_FLOAT32_C(   0.006565), SIMDE_FLOAT32_C(  -0.001035), SIMDE_FLOAT32_C(   0.003175), SIMDE_FLOAT32_C(  -0.002197),
+        SIMDE_FLOAT32_C(   0.001223), SIMDE_FLOAT32_C(   0.002477), SIMDE_FLOAT32_C(  -0.005697), SIMDE_FLOAT32_C(  -0.008806),
+        SIMDE_FLOAT32_C(  -0.001557), SIMDE_FLOAT32_C(  -0.010351), SIMDE_FLOAT32_C(  -0.001276), SIMDE_FLOAT32_C(   0.001049),
+        SIMDE_FLOAT32_C(   0.009011), SIMDE_FLOAT32_C(   0.003372), SIMDE_FLOAT32_C(  -0.001094), SIMDE_FLOAT32_C(  -0.002655) } },
+    { { SIMDE_FLOAT32_C( 890.36), SIMDE_FLOAT32_C(-941.85), SIMDE_FLOAT32_C( 196.63), SIMDE_FLOAT32_C( 678.60),
+        SIMDE_FLOAT32_C(-723.13), SIMDE_FLOAT32_C(-983.02), SIMDE_FLOAT32_C( 928.25), SIMDE_FLOAT32_C( 613.45),
+        SIMDE_FLOAT32_C( 832.53), SIMDE_FLOAT32_C(-972.48), SIMDE_FLOAT32_C( 491.45), SIMDE_FLOAT32_C(-152.90),
+        SIMDE_FLOAT32_C(-707.49), SIMDE_FLOAT32_C(-962.38), SIMDE_FLOAT32_C(-277.22), SIMDE_FLOAT32_C( 817.16) },
+      { SIMDE_FLOAT32_C(   0.001123), SIMDE_FLOAT32_C(  -0.001062), SIMDE_FLOAT32_C(   0.005086), SIMDE_FLOAT32_C(   0.001474),
+        SIMDE_FLOAT32_C(  -0.001383), SIMDE_FLOAT32_C(  -0.001017), SIMDE_FLOAT32_C(   0.001077), SIMDE_FLOAT32_C(   0.001630),
+        SIMDE_FLOAT32_C(   0.001201), SIMDE_FLOAT32_C(  -0.001028), SIMDE_FLOAT32_C(   0.002035), SIMDE_FLOAT32_C(  -0.006540),
+        SIMDE_FLOAT32_C(  -0.001413), SIMDE_FLOAT32_C(  -0.001039), SIMDE_FLOAT32_C(  -0.003607), SIMDE_FLOAT32_C(   0.001224) } },
+    { { SIMDE_FLOAT32_C( 881.51), SIMDE_FLOAT32_C(-746.48), SIMDE_FLOAT32_C(-293.41), SIMDE_FLOAT32_C(-841.93),
+        SIMDE_FLOAT32_C(-358.95), SIMDE_FLOAT32_C(-610.61), SIMDE_FLOAT32_C( 377.71), SIMDE_FLOAT32_C(  89.60),
+        SIMDE_FLOAT32_C( 586.89), SIMDE_FLOAT32_C(-471.84), SIMDE_FLOAT32_C(-825.25), SIMDE_FLOAT32_C( 513.49),
+        SIMDE_FLOAT32_C( 275.56), SIMDE_FLOAT32_C( 914.34), SIMDE_FLOAT32_C(-863.13), SIMDE_FLOAT32_C(-495.79) },
+      { SIMDE_FLOAT32_C(   0.001134), SIMDE_FLOAT32_C(  -0.001340), SIMDE_FLOAT32_C(  -0.003408), SIMDE_FLOAT32_C(  -0.001188),
+        SIMDE_FLOAT32_C(  -0.002786), SIMDE_FLOAT32_C(  -0.001638), SIMDE_FLOAT32_C(   0.002648), SIMDE_FLOAT32_C(   0.011161),
+        SIMDE_FLOAT32_C(   0.001704), SIMDE_FLOAT32_C(  -0.002119), SIMDE_FLOAT32_C(  -0.001212), SIMDE_FLOAT32_C(   0.001947),
+        SIMDE_FLOAT32_C(   0.003629), SIMDE_FLOAT32_C(   0.001094), SIMDE_FLOAT32_C(  -0.001159), SIMDE_FLOAT32_C(  -0.002017) } },
+    { { SIMDE_FLOAT32_C( 843.68), SIMDE_FLOAT32_C(-375.43), SIMDE_FLOAT32_C(-644.59), SIMDE_FLOAT32_C(-960.79),
+        SIMDE_FLOAT32_C( 268.38), SIMDE_FLOAT32_C( 335.03), SIMDE_FLOAT32_C( 240.37), SIMDE_FLOAT32_C( 899.18),
+        SIMDE_FLOAT32_C(-614.62), SIMDE_FLOAT32_C( 392.85), SIMDE_FLOAT32_C(-173.76), SIMDE_FLOAT32_C( 250.00),
+        SIMDE_FLOAT32_C(-709.28), SIMDE_FLOAT32_C( 655.64), SIMDE_FLOAT32_C( 141.46), SIMDE_FLOAT32_C(-108.65) },
+      { SIMDE_FLOAT32_C(   0.001185), SIMDE_FLOAT32_C(  -0.002664), SIMDE_FLOAT32_C(  -0.001551), SIMDE_FLOAT32_C(  -0.001041),
+        SIMDE_FLOAT32_C(   0.003726), SIMDE_FLOAT32_C(   0.002985), SIMDE_FLOAT32_C(   0.004160), SIMDE_FLOAT32_C(   0.001112),
+        SIMDE_FLOAT32_C(  -0.001627), SIMDE_FLOAT32_C(   0.002546), SIMDE_FLOAT32_C(  -0.005755), SIMDE_FLOAT32_C(   0.004000),
+        SIMDE_FLOAT32_C(  -0.001410), SIMDE_FLOAT32_C(   0.001525), SIMDE_FLOAT32_C(   0.007069), SIMDE_FLOAT32_C(  -0.009204) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_rcp14_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rcp14_ps_bound (SIMDE_MUNIT_TEST_ARGS) {
+  const simde_float32* inputs = simde_test_rcp14_ps_bound_inputs;
+  simde_float32 r[16];
+
+  for (size_t i = 0 ; i < (sizeof(simde_test_rcp14_ps_bound_inputs) / sizeof(simde_test_rcp14_ps_bound_inputs[0])) ; i += 16) {
+    simde_mm512_storeu_ps(r, simde_mm512_rcp14_ps(simde_mm512_loadu_ps(&(inputs[i]))));
+    for (size_t j = 0 ; j < 16 ; j++) {
+      simde_assert_equal_i(simde_test_rcp14_ps_within_bound(inputs[i + j], r[j]), 1);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(  -3.84), SIMDE_FLOAT32_C(-991.59), SIMDE_FLOAT32_C( -27.74), SIMDE_FLOAT32_C(-751.52),
+        SIMDE_FLOAT32_C( 795.72), SIMDE_FLOAT32_C( 696.74), SIMDE_FLOAT32_C( 383.70), SIMDE_FLOAT32_C( 365.41),
+        SIMDE_FLOAT32_C(-151.08), SIMDE_FLOAT32_C( 993.90), SIMDE_FLOAT32_C(-744.64), SIMDE_FLOAT32_C(  93.75),
+        SIMDE_FLOAT32_C(-785.69), SIMDE_FLOAT32_C(-449.00), SIMDE_FLOAT32_C( -33.45), SIMDE_FLOAT32_C(-543.33) },
+      UINT16_C(  281),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-991.59), SIMDE_FLOAT32_C( -27.74), SIMDE_FLOAT32_C(  -0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C( 696.74), SIMDE_FLOAT32_C( 383.70), SIMDE_FLOAT32_C( 365.41),
+              SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 993.90), SIMDE_FLOAT32_C(-744.64), SIMDE_FLOAT32_C(  93.75),
+        SIMDE_FLOAT32_C(-785.69), SIMDE_FLOAT32_C(-449.00), SIMDE_FLOAT32_C( -33.45), SIMDE_FLOAT32_C(-543.33) } },
+    #endif
+    { { SIMDE_FLOAT32_C(  83.69), SIMDE_FLOAT32_C(-550.91), SIMDE_FLOAT32_C( 122.79), SIMDE_FLOAT32_C(-826.43),
+        SIMDE_FLOAT32_C(-914.96), SIMDE_FLOAT32_C(-919.13), SIMDE_FLOAT32_C( 503.27), SIMDE_FLOAT32_C(-763.99),
+        SIMDE_FLOAT32_C( 909.40), SIMDE_FLOAT32_C( 725.26), SIMDE_FLOAT32_C(-158.58), SIMDE_FLOAT32_C( 711.61),
+        SIMDE_FLOAT32_C(-959.65), SIMDE_FLOAT32_C(-948.51), SIMDE_FLOAT32_C(-651.87), SIMDE_FLOAT32_C(-262.81) },
+      UINT16_C(21905),
+      { SIMDE_FLOAT32_C( 181.36), SIMDE_FLOAT32_C( 802.36), SIMDE_FLOAT32_C( 194.35), SIMDE_FLOAT32_C( -17.61),
+        SIMDE_FLOAT32_C(-729.11), SIMDE_FLOAT32_C(-896.26), SIMDE_FLOAT32_C(-261.17), SIMDE_FLOAT32_C(-898.96),
+        SIMDE_FLOAT32_C(-610.99), SIMDE_FLOAT32_C( 989.94), SIMDE_FLOAT32_C( 284.66), SIMDE_FLOAT32_C(-977.81),
+        SIMDE_FLOAT32_C(  15.72), SIMDE_FLOAT32_C( 250.36), SIMDE_FLOAT32_C(-880.17), SIMDE_FLOAT32_C(  45.15) },
+      { SIMDE_FLOAT32_C(   0.005514), SIMDE_FLOAT32_C(-550.91), SIMDE_FLOAT32_C( 122.79), SIMDE_FLOAT32_C(-826.43),
+        SIMDE_FLOAT32_C(  -0.001372), SIMDE_FLOAT32_C(-919.13), SIMDE_FLOAT32_C( 503.27), SIMDE_FLOAT32_C(  -0.001112),
+        SIMDE_FLOAT32_C(  -0.001637), SIMDE_FLOAT32_C( 725.26), SIMDE_FLOAT32_C(   0.003513), SIMDE_FLOAT32_C( 711.61),
+        SIMDE_FLOAT32_C(   0.063615), SIMDE_FLOAT32_C(-948.51), SIMDE_FLOAT32_C(  -0.001136), SIMDE_FLOAT32_C(-262.81) } },
+    { { SIMDE_FLOAT32_C(-201.89), SIMDE_FLOAT32_C(-581.51), SIMDE_FLOAT32_C( 668.17), SIMDE_FLOAT32_C( -55.06),
+        SIMDE_FLOAT32_C(-328.57), SIMDE_FLOAT32_C(-397.35), SIMDE_FLOAT32_C(-561.20), SIMDE_FLOAT32_C( 498.71),
+        SIMDE_FLOAT32_C( 973.39), SIMDE_FLOAT32_C(-603.28), SIMDE_FLOAT32_C(-514.50), SIMDE_FLOAT32_C(  29.09),
+        SIMDE_FLOAT32_C( 723.75), SIMDE_FLOAT32_C(-508.96), SIMDE_FLOAT32_C(-611.23), SIMDE_FLOAT32_C(-713.31) },
+      UINT16_C(56611),
+      { SIMDE_FLOAT32_C( 194.95), SIMDE_FLOAT32_C( 451.39), SIMDE_FLOAT32_C(-790.95), SIMDE_FLOAT32_C( 135.32),
+        SIMDE_FLOAT32_C( 296.61), SIMDE_FLOAT32_C(-994.94), SIMDE_FLOAT32_C(-185.08), SIMDE_FLOAT32_C(-401.20),
+        SIMDE_FLOAT32_C( 387.86), SIMDE_FLOAT32_C(  69.00), SIMDE_FLOAT32_C( 347.17), SIMDE_FLOAT32_C( 580.10),
+        SIMDE_FLOAT32_C( 483.76), SIMDE_FLOAT32_C( 406.13), SIMDE_FLOAT32_C( 954.67), SIMDE_FLOAT32_C( 958.93) },
+      { SIMDE_FLOAT32_C(   0.005130), SIMDE_FLOAT32_C(   0.002215), SIMDE_FLOAT32_C( 668.17), SIMDE_FLOAT32_C( -55.06),
+        SIMDE_FLOAT32_C(-328.57), SIMDE_FLOAT32_C(  -0.001005), SIMDE_FLOAT32_C(-561.20), SIMDE_FLOAT32_C( 498.71),
+        SIMDE_FLOAT32_C(   0.002578), SIMDE_FLOAT32_C(-603.28), SIMDE_FLOAT32_C(   0.002880), SIMDE_FLOAT32_C(   0.001724),
+        SIMDE_FLOAT32_C(   0.002067), SIMDE_FLOAT32_C(-508.96), SIMDE_FLOAT32_C(   0.001047), SIMDE_FLOAT32_C(   0.001043) } },
+    { { SIMDE_FLOAT32_C( 426.30), SIMDE_FLOAT32_C( 902.65), SIMDE_FLOAT32_C(-788.95), SIMDE_FLOAT32_C( 176.94),
+        SIMDE_FLOAT32_C(-357.22), SIMDE_FLOAT32_C(-687.58), SIMDE_FLOAT32_C(-820.75), SIMDE_FLOAT32_C(-162.73),
+        SIMDE_FLOAT32_C( 200.64), SIMDE_FLOAT32_C(-779.79), SIMDE_FLOAT32_C(-893.84), SIMDE_FLOAT32_C( 604.97),
+        SIMDE_FLOAT32_C( 457.00), SIMDE_FLOAT32_C( 980.44), SIMDE_FLOAT32_C(-146.64), SIMDE_FLOAT32_C( 500.91) },
+      UINT16_C(16429),
+      { SIMDE_FLOAT32_C(-113.34), SIMDE_FLOAT32_C(-515.61), SIMDE_FLOAT32_C( 167.97), SIMDE_FLOAT32_C(-858.29),
+        SIMDE_FLOAT32_C( -89.10), SIMDE_FLOAT32_C( 620.20), SIMDE_FLOAT32_C( 104.94), SIMDE_FLOAT32_C(-591.20),
+        SIMDE_FLOAT32_C( 297.56), SIMDE_FLOAT32_C(  79.57), SIMDE_FLOAT32_C(-605.31), SIMDE_FLOAT32_C(  41.93),
+        SIMDE_FLOAT32_C( 387.17), SIMDE_FLOAT32_C(-913.80), SIMDE_FLOAT32_C( 830.34), SIMDE_FLOAT32_C(-913.96) },
+      { SIMDE_FLOAT32_C(  -0.008823), SIMDE_FLOAT32_C( 902.65), SIMDE_FLOAT32_C(   0.005953), SIMDE_FLOAT32_C(  -0.001165),
+        SIMDE_FLOAT32_C(-357.22), SIMDE_FLOAT32_C(   0.001612), SIMDE_FLOAT32_C(-820.75), SIMDE_FLOAT32_C(-162.73),
+        SIMDE_FLOAT32_C( 200.64), SIMDE_FLOAT32_C(-779.79), SIMDE_FLOAT32_C(-893.84), SIMDE_FLOAT32_C( 604.97),
+        SIMDE_FLOAT32_C( 457.00), SIMDE_FLOAT32_C( 980.44), SIMDE_FLOAT32_C(   0.001204), SIMDE_FLOAT32_C( 500.91) } },
+    { { SIMDE_FLOAT32_C( -37.30), SIMDE_FLOAT32_C( 546.65), SIMDE_FLOAT32_C( 994.67), SIMDE_FLOAT32_C( 425.32),
+        SIMDE_FLOAT32_C(-574.22), SIMDE_FLOAT32_C(-559.06), SIMDE_FLOAT32_C(-506.03), SIMDE_FLOAT32_C( 465.56),
+        SIMDE_FLOAT32_C( 618.23), SIMDE_FLOAT32_C(-442.40), SIMDE_FLOAT32_C(-346.99), SIMDE_FLOAT32_C(-697.71),
+        SIMDE_FLOAT32_C(-237.93), SIMDE_FLOAT32_C( 322.75), SIMDE_FLOAT32_C(-570.66), SIMDE_FLOAT32_C( 208.41) },
+      UINT16_C(27287),
+      { SIMDE_FLOAT32_C(-406.50), SIMDE_FLOAT32_C(-720.57), SIMDE_FLOAT32_C(-731.41), SIMDE_FLOAT32_C(-813.44),
+        SIMDE_FLOAT32_C( 825.82), SIMDE_FLOAT32_C( -86.05), SIMDE_FLOAT32_C( 479.67), SIMDE_FLOAT32_C( -46.85),
+        SIMDE_FLOAT32_C(-480.39), SIMDE_FLOAT32_C(-776.84), SIMDE_FLOAT32_C( 112.50), SIMDE_FLOAT32_C(-837.86),
+        SIMDE_FLOAT32_C( 115.97), SIMDE_FLOAT32_C( 678.29), SIMDE_FLOAT32_C( 137.13), SIMDE_FLOAT32_C(-173.97) },
+      { SIMDE_FLOAT32_C(  -0.002460), SIMDE_FLOAT32_C(  -0.001388), SIMDE_FLOAT32_C(  -0.001367), SIMDE_FLOAT32_C( 425.32),
+        SIMDE_FLOAT32_C(   0.001211), SIMDE_FLOAT32_C(-559.06), SIMDE_FLOAT32_C(-506.03), SIMDE_FLOAT32_C(  -0.021345),
+        SIMDE_FLOAT32_C( 618.23), SIMDE_FLOAT32_C(  -0.001287), SIMDE_FLOAT32_C(-346.99), SIMDE_FLOAT32_C(  -0.001194),
+        SIMDE_FLOAT32_C(-237.93), SIMDE_FLOAT32_C(   0.001474), SIMDE_FLOAT32_C(   0.007293), SIMDE_FLOAT32_C( 208.41) } },
+    { { SIMDE_FLOAT32_C(-575.32), SIMDE_FLOAT32_C(  43.94), SIMDE_FLOAT32_C(-471.82), SIMDE_FLOAT32_C(-203.99),
+        SIMDE_FLOAT32_C(-858.95), SIMDE_FLOAT32_C( 335.23), SIMDE_FLOAT32_C(  15.24), SIMDE_FLOAT32_C( 515.15),
+        SIMDE_FLOAT32_C(-814.29), SIMDE_FLOAT32_C(   5.60), SIMDE_FLOAT32_C(-571.07), SIMDE_FLOAT32_C( 690.82),
+        SIMDE_FLOAT32_C( 354.51), SIMDE_FLOAT32_C(-483.24), SIMDE_FLOAT32_C( 856.67), SIMDE_FLOAT32_C( 332.30) },
+      UINT16_C(20452),
+      { SIMDE_FLOAT32_C( -15.79), SIMDE_FLOAT32_C(-597.04), SIMDE_FLOAT32_C(  25.14), SIMDE_FLOAT32_C( 514.70),
+        SIMDE_FLOAT32_C(  69.30), SIMDE_FLOAT32_C( 285.58), SIMDE_FLOAT32_C(-858.48), SIMDE_FLOAT32_C( 123.22),
+        SIMDE_FLOAT32_C(  80.25), SIMDE_FLOAT32_C( 202.41), SIMDE_FLOAT32_C( 503.37), SIMDE_FLOAT32_C(-853.15),
+        SIMDE_FLOAT32_C( 871.13), SIMDE_FLOAT32_C( 530.23), SIMDE_FLOAT32_C( 228.74), SIMDE_FLOAT32_C(  60.10) },
+      { SIMDE_FLOAT32_C(-575.32), SIMDE_FLOAT32_C(  43.94), SIMDE_FLOAT32_C(   0.039778), SIMDE_FLOAT32_C(-203.99),
+        SIMDE_FLOAT32_C(-858.95), SIMDE_FLOAT32_C(   0.003502), SIMDE_FLOAT32_C(  -0.001165), SIMDE_FLOAT32_C(   0.008116),
+        SIMDE_FLOAT32_C(   0.012461), SIMDE_FLOAT32_C(   0.004941), SIMDE_FLOAT32_C(   0.001987), SIMDE_FLOAT32_C(  -0.001172),
+        SIMDE_FLOAT32_C( 354.51), SIMDE_FLOAT32_C(-483.24), SIMDE_FLOAT32_C(   0.004372), SIMDE_FLOAT32_C( 332.30) } },
+    { { SIMDE_FLOAT32_C(-734.12), SIMDE_FLOAT32_C(-303.12), SIMDE_FLOAT32_C( 354.35), SIMDE_FLOAT32_C(  17.34),
+        SIMDE_FLOAT32_C( 635.81), SIMDE_FLOAT32_C( 282.26), SIMDE_FLOAT32_C( 841.36), SIMDE_FLOAT32_C( 414.86),
+        SIMDE_FLOAT32_C(-665.39), SIMDE_FLOAT32_C( 432.62), SIMDE_FLOAT32_C( -39.56), SIMDE_FLOAT32_C(-181.15),
+        SIMDE_FLOAT32_C( 294.25), SIMDE_FLOAT32_C(-789.90), SIMDE_FLOAT32_C( 573.76), SIMDE_FLOAT32_C(-353.70) },
+      UINT16_C(50446),
+      { SIMDE_FLOAT32_C(-214.60), SIMDE_FLOAT32_C( 213.41), SIMDE_FLOAT32_C( 901.78), SIMDE_FLOAT32_C( 904.13),
+        SIMDE_FLOAT32_C( 218.37), SIMDE_FLOAT32_C( 605.17), SIMDE_FLOAT32_C( 142.59), SIMDE_FLOAT32_C( 830.24),
+        SIMDE_FLOAT32_C( 530.36), SIMDE_FLOAT32_C( -30.42), SIMDE_FLOAT32_C(-272.88), SIMDE_FLOAT32_C( 451.75),
+        SIMDE_FLOAT32_C( 742.81), SIMDE_FLOAT32_C(-878.16), SIMDE_FLOAT32_C(-915.28), SIMDE_FLOAT32_C( 778.47) },
+      { SIMDE_FLOAT32_C(-734.12), SIMDE_FLOAT32_C(   0.004686), SIMDE_FLOAT32_C(   0.001109), SIMDE_FLOAT32_C(   0.001106),
+        SIMDE_FLOAT32_C( 635.81), SIMDE_FLOAT32_C( 282.26), SIMDE_FLOAT32_C( 841.36), SIMDE_FLOAT32_C( 414.86),
+        SIMDE_FLOAT32_C(   0.001886), SIMDE_FLOAT32_C( 432.62), SIMDE_FLOAT32_C(  -0.003665), SIMDE_FLOAT32_C(-181.15),
+        SIMDE_FLOAT32_C( 294.25), SIMDE_FLOAT32_C(-789.90), SIMDE_FLOAT32_C(  -0.001093), SIMDE_FLOAT32_C(   0.001285) } },
+    { { SIMDE_FLOAT32_C(  24.11), SIMDE_FLOAT32_C(-704.82), SIMDE_FLOAT32_C( 811.10), SIMDE_FLOAT32_C(-995.20),
+        SIMDE_FLOAT32_C( 744.85), SIMDE_FLOAT32_C( 792.95), SIMDE_FLOAT32_C(-237.53), SIMDE_FLOAT32_C( 290.00),
+        SIMDE_FLOAT32_C(-623.83), SIMDE_FLOAT32_C( 510.97), SIMDE_FLOAT32_C( 954.63), SIMDE_FLOAT32_C( 897.34),
+        SIMDE_FLOAT32_C( 637.43), SIMDE_FLOAT32_C(-283.44), SIMDE_FLOAT32_C( 788.02), SIMDE_FLOAT32_C(-177.87) },
+      UINT16_C(32116),
+      { SIMDE_FLOAT32_C(-990.57), SIMDE_FLOAT32_C(-600.14), SIMDE_FLOAT32_C( 956.70), SIMDE_FLOAT32_C( 241.20),
+        SIMDE_FLOAT32_C(-630.62), SIMDE_FLOAT32_C( 730.78), SIMDE_FLOAT32_C(-986.78), SIMDE_FLOAT32_C(-945.97),
+        SIMDE_FLOAT32_C(-388.72), SIMDE_FLOAT32_C( 187.68), SIMDE_FLOAT32_C( 800.99), SIMDE_FLOAT32_C(   9.09),
+        SIMDE_FLOAT32_C( 614.00), SIMDE_FLOAT32_C(-424.71), SIMDE_FLOAT32_C( 488.07), SIMDE_FLOAT32_C(-708.62) },
+      { SIMDE_FLOAT32_C(  24.11), SIMDE_FLOAT32_C(-704.82), SIMDE_FLOAT32_C(   0.001045), SIMDE_FLOAT32_C(-995.20),
+        SIMDE_FLOAT32_C(  -0.001586), SIMDE_FLOAT32_C(   0.001368), SIMDE_FLOAT32_C(  -0.001013), SIMDE_FLOAT32_C( 290.00),
+        SIMDE_FLOAT32_C(  -0.002573), SIMDE_FLOAT32_C( 510.97), SIMDE_FLOAT32_C(   0.001248), SIMDE_FLOAT32_C(   0.110013),
+        SIMDE_FLOAT32_C(   0.001629), SIMDE_FLOAT32_C(  -0.002355), SIMDE_FLOAT32_C(   0.002049), SIMDE_FLOAT32_C(-177.87) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_rcp14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(62714),
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),   SIMDE_MATH_INFINITYF,  -SIMDE_MATH_INFINITYF,
+               SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.50), SIMDE_FLOAT32_C(   1.00) },
+      { SIMDE_FLOAT32_C(   0.00),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+                   SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(  -2.00), SIMDE_FLOAT32_C(   1.00) } },
+    #endif
+    { UINT16_C(49844),
+      { SIMDE_FLOAT32_C( 997.87), SIMDE_FLOAT32_C( 739.22), SIMDE_FLOAT32_C(-638.47), SIMDE_FLOAT32_C( -18.69),
+        SIMDE_FLOAT32_C(-705.32), SIMDE_FLOAT32_C(-495.85), SIMDE_FLOAT32_C( 179.99), SIMDE_FLOAT32_C( 323.55),
+        SIMDE_FLOAT32_C( 165.23), SIMDE_FLOAT32_C( 286.98), SIMDE_FLOAT32_C( 315.91), SIMDE_FLOAT32_C(-105.88),
+        SIMDE_FLOAT32_C( 443.96), SIMDE_FLOAT32_C( -61.89), SIMDE_FLOAT32_C(-984.06), SIMDE_FLOAT32_C( 818.95) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001566), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -0.001418), SIMDE_FLOAT32_C(  -0.002017), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.003091),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.003485), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001016), SIMDE_FLOAT32_C(   0.001221) } },
+    { UINT16_C(44558),
+      { SIMDE_FLOAT32_C( -67.10), SIMDE_FLOAT32_C(-478.14), SIMDE_FLOAT32_C(-364.48), SIMDE_FLOAT32_C(-281.56),
+        SIMDE_FLOAT32_C(-722.56), SIMDE_FLOAT32_C(-476.80), SIMDE_FLOAT32_C( 392.32), SIMDE_FLOAT32_C( 407.42),
+        SIMDE_FLOAT32_C( 883.29), SIMDE_FLOAT32_C( 218.89), SIMDE_FLOAT32_C( 540.34), SIMDE_FLOAT32_C(-822.51),
+        SIMDE_FLOAT32_C(-712.23), SIMDE_FLOAT32_C( 280.12), SIMDE_FLOAT32_C(-722.17), SIMDE_FLOAT32_C(-448.31) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.002091), SIMDE_FLOAT32_C(  -0.002744), SIMDE_FLOAT32_C(  -0.003552),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.004569), SIMDE_FLOAT32_C(   0.001851), SIMDE_FLOAT32_C(  -0.001216),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.003570), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.002231) } },
+    { UINT16_C(56224),
+      { SIMDE_FLOAT32_C(-886.74), SIMDE_FLOAT32_C( 968.62), SIMDE_FLOAT32_C( -96.30), SIMDE_FLOAT32_C(-784.93),
+        SIMDE_FLOAT32_C( 627.38), SIMDE_FLOAT32_C( 361.75), SIMDE_FLOAT32_C( 688.62), SIMDE_FLOAT32_C(-564.54),
+        SIMDE_FLOAT32_C(  41.37), SIMDE_FLOAT32_C( -98.08), SIMDE_FLOAT32_C(-195.36), SIMDE_FLOAT32_C( 214.03),
+        SIMDE_FLOAT32_C(-753.93), SIMDE_FLOAT32_C( 135.24), SIMDE_FLOAT32_C( 774.93), SIMDE_FLOAT32_C(-598.63) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.002764), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001771),
+        SIMDE_FLOAT32_C(   0.024172), SIMDE_FLOAT32_C(  -0.010196), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.004672),
+        SIMDE_FLOAT32_C(  -0.001326), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.001290), SIMDE_FLOAT32_C(  -0.001670) } },
+    { UINT16_C(53365),
+      { SIMDE_FLOAT32_C( 794.06), SIMDE_FLOAT32_C(-123.34), SIMDE_FLOAT32_C(  75.88), SIMDE_FLOAT32_C(-879.58),
+        SIMDE_FLOAT32_C( 575.56), SIMDE_FLOAT32_C(-308.62), SIMDE_FLOAT32_C(-973.69), SIMDE_FLOAT32_C(-778.74),
+        SIMDE_FLOAT32_C(  93.15), SIMDE_FLOAT32_C( 999.66), SIMDE_FLOAT32_C( 336.68), SIMDE_FLOAT32_C( 464.73),
+        SIMDE_FLOAT32_C( 906.73), SIMDE_FLOAT32_C(-179.40), SIMDE_FLOAT32_C(-312.19), SIMDE_FLOAT32_C(-843.69) },
+      { SIMDE_FLOAT32_C(   0.001259), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.013179), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.001737), SIMDE_FLOAT32_C(  -0.003240), SIMDE_FLOAT32_C(  -0.001027), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.001103), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.003203), SIMDE_FLOAT32_C(  -0.001185) } },
+    { UINT16_C(47333),
+      { SIMDE_FLOAT32_C( 425.53), SIMDE_FLOAT32_C(-337.45), SIMDE_FLOAT32_C(-669.11), SIMDE_FLOAT32_C(-711.71),
+        SIMDE_FLOAT32_C(-948.18), SIMDE_FLOAT32_C( 567.75), SIMDE_FLOAT32_C( -68.77), SIMDE_FLOAT32_C(-588.99),
+        SIMDE_FLOAT32_C(-631.74), SIMDE_FLOAT32_C(-582.86), SIMDE_FLOAT32_C(-450.49), SIMDE_FLOAT32_C(   3.85),
+        SIMDE_FLOAT32_C( 133.31), SIMDE_FLOAT32_C( 743.63), SIMDE_FLOAT32_C(-173.04), SIMDE_FLOAT32_C( 953.67) },
+      { SIMDE_FLOAT32_C(   0.002350), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.001495), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.001761), SIMDE_FLOAT32_C(  -0.014542), SIMDE_FLOAT32_C(  -0.001698),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.259747),
+        SIMDE_FLOAT32_C(   0.007502), SIMDE_FLOAT32_C(   0.001345), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.001049) } },
+    { UINT16_C( 5228),
+      { SIMDE_FLOAT32_C( -70.73), SIMDE_FLOAT32_C(-376.26), SIMDE_FLOAT32_C( 892.96), SIMDE_FLOAT32_C( 870.11),
+        SIMDE_FLOAT32_C(-543.26), SIMDE_FLOAT32_C( 153.93), SIMDE_FLOAT32_C( 192.74), SIMDE_FLOAT32_C( 294.76),
+        SIMDE_FLOAT32_C(  66.50), SIMDE_FLOAT32_C( 424.95), SIMDE_FLOAT32_C(-130.29), SIMDE_FLOAT32_C(-362.68),
+        SIMDE_FLOAT32_C(-106.50), SIMDE_FLOAT32_C( 469.13), SIMDE_FLOAT32_C( 954.61), SIMDE_FLOAT32_C( 977.52) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.001120), SIMDE_FLOAT32_C(   0.001149),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.006496), SIMDE_FLOAT32_C(   0.005188), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(  -0.007675), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(  -0.009390), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(  135),
+      { SIMDE_FLOAT32_C(  35.59), SIMDE_FLOAT32_C( 759.07), SIMDE_FLOAT32_C(-881.57), SIMDE_FLOAT32_C(-350.13),
+        SIMDE_FLOAT32_C( 564.76), SIMDE_FLOAT32_C( 847.17), SIMDE_FLOAT32_C(-875.23), SIMDE_FLOAT32_C( 226.17),
+        SIMDE_FLOAT32_C( 946.78), SIMDE_FLOAT32_C(-990.24), SIMDE_FLOAT32_C(-161.25), SIMDE_FLOAT32_C( 516.79),
+        SIMDE_FLOAT32_C(-490.74), SIMDE_FLOAT32_C(-702.03), SIMDE_FLOAT32_C( 566.41), SIMDE_FLOAT32_C( 276.51) },
+      { SIMDE_FLOAT32_C(   0.028098), SIMDE_FLOAT32_C(   0.001317), SIMDE_FLOAT32_C(  -0.001134), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.004421),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_rcp14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,
+                SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   4.00), SIMDE_FLOAT64_C(  -0.50), SIMDE_FLOAT64_C(   1.00) },
+      {        SIMDE_MATH_INFINITY,       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),
+                    SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   0.25), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   1.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C(-237.63), SIMDE_FLOAT64_C(-453.73), SIMDE_FLOAT64_C( 982.44), SIMDE_FLOAT64_C( 115.20),
+        SIMDE_FLOAT64_C( 606.16), SIMDE_FLOAT64_C(-749.01), SIMDE_FLOAT64_C( 718.93), SIMDE_FLOAT64_C( 386.01) },
+      { SIMDE_FLOAT64_C(  -0.004208), SIMDE_FLOAT64_C(  -0.002204), SIMDE_FLOAT64_C(   0.001018), SIMDE_FLOAT64_C(   0.008681),
+        SIMDE_FLOAT64_C(   0.001650), SIMDE_FLOAT64_C(  -0.001335), SIMDE_FLOAT64_C(   0.001391), SIMDE_FLOAT64_C(   0.002591) } },
+    { { SIMDE_FLOAT64_C(-382.74), SIMDE_FLOAT64_C( -83.90), SIMDE_FLOAT64_C(-859.17), SIMDE_FLOAT64_C(  14.00),
+        SIMDE_FLOAT64_C(-800.44), SIMDE_FLOAT64_C( 737.20), SIMDE_FLOAT64_C(-921.76), SIMDE_FLOAT64_C(-557.77) },
+      { SIMDE_FLOAT64_C(  -0.002613), SIMDE_FLOAT64_C(  -0.011919), SIMDE_FLOAT64_C(  -0.001164), SIMDE_FLOAT64_C(   0.071427),
+        SIMDE_FLOAT64_C(  -0.001249), SIMDE_FLOAT64_C(   0.001356), SIMDE_FLOAT64_C(  -0.001085), SIMDE_FLOAT64_C(  -0.001793) } },
+    { { SIMDE_FLOAT64_C( 588.35), SIMDE_FLOAT64_C( -79.80), SIMDE_FLOAT64_C( 888.53), SIMDE_FLOAT64_C(-352.26),
+        SIMDE_FLOAT64_C(-437.49), SIMDE_FLOAT64_C( 580.65), SIMDE_FLOAT64_C( 245.03), SIMDE_FLOAT64_C(-522.32) },
+      { SIMDE_FLOAT64_C(   0.001700), SIMDE_FLOAT64_C(  -0.012531), SIMDE_FLOAT64_C(   0.001125), SIMDE_FLOAT64_C(  -0.002839),
+        SIMDE_FLOAT64_C(  -0.002286), SIMDE_FLOAT64_C(   0.001722), SIMDE_FLOAT64_C(   0.004081), SIMDE_FLOAT64_C(  -0.001915) } },
+    { { SIMDE_FLOAT64_C(-888.45), SIMDE_FLOAT64_C( 376.29), SIMDE_FLOAT64_C(-762.17), SIMDE_FLOAT64_C(-643.93),
+        SIMDE_FLOAT64_C(-869.84), SIMDE_FLOAT64_C( 738.95), SIMDE_FLOAT64_C(-259.41), SIMDE_FLOAT64_C( 896.87) },
+      { SIMDE_FLOAT64_C(  -0.001126), SIMDE_FLOAT64_C(   0.002658), SIMDE_FLOAT64_C(  -0.001312), SIMDE_FLOAT64_C(  -0.001553),
+        SIMDE_FLOAT64_C(  -0.001150), SIMDE_FLOAT64_C(   0.001353), SIMDE_FLOAT64_C(  -0.003855), SIMDE_FLOAT64_C(   0.001115) } },
+    { { SIMDE_FLOAT64_C(  42.01), SIMDE_FLOAT64_C( -47.91), SIMDE_FLOAT64_C( 283.57), SIMDE_FLOAT64_C( 880.69),
+        SIMDE_FLOAT64_C( 903.74), SIMDE_FLOAT64_C( -14.96), SIMDE_FLOAT64_C(-713.93), SIMDE_FLOAT64_C( 700.32) },
+      { SIMDE_FLOAT64_C(   0.023803), SIMDE_FLOAT64_C(  -0.020873), SIMDE_FLOAT64_C(   0.003527), SIMDE_FLOAT64_C(   0.001135),
+        SIMDE_FLOAT64_C(   0.001107), SIMDE_FLOAT64_C(  -0.066846), SIMDE_FLOAT64_C(  -0.001401), SIMDE_FLOAT64_C(   0.001428) } },
+    { { SIMDE_FLOAT64_C(-712.51), SIMDE_FLOAT64_C(-844.93), SIMDE_FLOAT64_C( -79.55), SIMDE_FLOAT64_C(-348.10),
+        SIMDE_FLOAT64_C( 633.69), SIMDE_FLOAT64_C(-157.56), SIMDE_FLOAT64_C( 525.55), SIMDE_FLOAT64_C(-313.08) },
+      { SIMDE_FLOAT64_C(  -0.001403), SIMDE_FLOAT64_C(  -0.001184), SIMDE_FLOAT64_C(  -0.012571), SIMDE_FLOAT64_C(  -0.002873),
+        SIMDE_FLOAT64_C(   0.001578), SIMDE_FLOAT64_C(  -0.006347), SIMDE_FLOAT64_C(   0.001903), SIMDE_FLOAT64_C(  -0.003194) } },
+    { { SIMDE_FLOAT64_C(-761.46), SIMDE_FLOAT64_C(-456.87), SIMDE_FLOAT64_C( 366.56), SIMDE_FLOAT64_C(-281.12),
+        SIMDE_FLOAT64_C( 330.71), SIMDE_FLOAT64_C(-987.35), SIMDE_FLOAT64_C(-552.44), SIMDE_FLOAT64_C( 624.16) },
+      { SIMDE_FLOAT64_C(  -0.001313), SIMDE_FLOAT64_C(  -0.002189), SIMDE_FLOAT64_C(   0.002728), SIMDE_FLOAT64_C(  -0.003557),
+        SIMDE_FLOAT64_C(   0.003024), SIMDE_FLOAT64_C(  -0.001013), SIMDE_FLOAT64_C(  -0.001810), SIMDE_FLOAT64_C(   0.001602) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_rcp14_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 300.45), SIMDE_FLOAT64_C( 357.82), SIMDE_FLOAT64_C( 598.05), SIMDE_FLOAT64_C( 334.75),
+        SIMDE_FLOAT64_C(-578.31), SIMDE_FLOAT64_C( 121.20), SIMDE_FLOAT64_C( 984.48), SIMDE_FLOAT64_C( 350.27) },
+      UINT8_C(  202),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,
+                SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   4.00), SIMDE_FLOAT64_C(  -0.50), SIMDE_FLOAT64_C(   1.00) },
+      { SIMDE_FLOAT64_C( 300.45),       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( 598.05), SIMDE_FLOAT64_C(  -0.00),
+        SIMDE_FLOAT64_C(-578.31), SIMDE_FLOAT64_C( 121.20), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   1.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C( 883.96), SIMDE_FLOAT64_C(-362.14), SIMDE_FLOAT64_C( 659.67), SIMDE_FLOAT64_C( 392.63),
+        SIMDE_FLOAT64_C( 915.55), SIMDE_FLOAT64_C( 262.44), SIMDE_FLOAT64_C( 799.08), SIMDE_FLOAT64_C( 538.86) },
+      UINT8_C(  101),
+      { SIMDE_FLOAT64_C( 697.51), SIMDE_FLOAT64_C( -10.76), SIMDE_FLOAT64_C( 448.56), SIMDE_FLOAT64_C( 245.64),
+        SIMDE_FLOAT64_C( 780.13), SIMDE_FLOAT64_C(-639.48), SIMDE_FLOAT64_C( 346.32), SIMDE_FLOAT64_C(-502.51) },
+      { SIMDE_FLOAT64_C(   0.001434), SIMDE_FLOAT64_C(-362.14), SIMDE_FLOAT64_C(   0.002229), SIMDE_FLOAT64_C( 392.63),
+        SIMDE_FLOAT64_C( 915.55), SIMDE_FLOAT64_C(  -0.001564), SIMDE_FLOAT64_C(   0.002888), SIMDE_FLOAT64_C( 538.86) } },
+    { { SIMDE_FLOAT64_C(   5.98), SIMDE_FLOAT64_C(-639.68), SIMDE_FLOAT64_C( 187.70), SIMDE_FLOAT64_C(-830.53),
+        SIMDE_FLOAT64_C(-289.11), SIMDE_FLOAT64_C( 965.09), SIMDE_FLOAT64_C( 640.40), SIMDE_FLOAT64_C(  63.35) },
+      UINT8_C(   81),
+      { SIMDE_FLOAT64_C(-521.69), SIMDE_FLOAT64_C( 994.32), SIMDE_FLOAT64_C( 523.76), SIMDE_FLOAT64_C(-667.30),
+        SIMDE_FLOAT64_C( -27.21), SIMDE_FLOAT64_C( 266.53), SIMDE_FLOAT64_C( 501.48), SIMDE_FLOAT64_C(-995.30) },
+      { SIMDE_FLOAT64_C(  -0.001917), SIMDE_FLOAT64_C(-639.68), SIMDE_FLOAT64_C( 187.70), SIMDE_FLOAT64_C(-830.53),
+        SIMDE_FLOAT64_C(  -0.036751), SIMDE_FLOAT64_C( 965.09), SIMDE_FLOAT64_C(   0.001994), SIMDE_FLOAT64_C(  63.35) } },
+    { { SIMDE_FLOAT64_C( 180.42), SIMDE_FLOAT64_C( 109.13), SIMDE_FLOAT64_C( 515.10), SIMDE_FLOAT64_C( 142.83),
+        SIMDE_FLOAT64_C( -29.29), SIMDE_FLOAT64_C(-468.92), SIMDE_FLOAT64_C( 857.97), SIMDE_FLOAT64_C(  -3.09) },
+      UINT8_C(  208),
+      { SIMDE_FLOAT64_C( 367.31), SIMDE_FLOAT64_C(-386.71), SIMDE_FLOAT64_C( 444.57), SIMDE_FLOAT64_C(-675.21),
+        SIMDE_FLOAT64_C( 542.75), SIMDE_FLOAT64_C( 512.40), SIMDE_FLOAT64_C(-387.10), SIMDE_FLOAT64_C( 607.72) },
+      { SIMDE_FLOAT64_C( 180.42), SIMDE_FLOAT64_C( 109.13), SIMDE_FLOAT64_C( 515.10), SIMDE_FLOAT64_C( 142.83),
+        SIMDE_FLOAT64_C(   0.001842), SIMDE_FLOAT64_C(-468.92), SIMDE_FLOAT64_C(  -0.002583), SIMDE_FLOAT64_C(   0.001645) } },
+    { { SIMDE_FLOAT64_C( 565.88), SIMDE_FLOAT64_C(-396.95), SIMDE_FLOAT64_C( 874.09), SIMDE_FLOAT64_C(-171.21),
+        SIMDE_FLOAT64_C( 742.33), SIMDE_FLOAT64_C( 585.30), SIMDE_FLOAT64_C(-339.39), SIMDE_FLOAT64_C( 959.41) },
+      UINT8_C(  230),
+      { SIMDE_FLOAT64_C( 144.35), SIMDE_FLOAT64_C( 254.59), SIMDE_FLOAT64_C( 411.30), SIMDE_FLOAT64_C(-848.33),
+        SIMDE_FLOAT64_C( 205.89), SIMDE_FLOAT64_C(-464.77), SIMDE_FLOAT64_C( 866.52), SIMDE_FLOAT64_C(-957.35) },
+      { SIMDE_FLOAT64_C( 565.88), SIMDE_FLOAT64_C(   0.003928), SIMDE_FLOAT64_C(   0.002431), SIMDE_FLOAT64_C(-171.21),
+        SIMDE_FLOAT64_C( 742.33), SIMDE_FLOAT64_C(  -0.002152), SIMDE_FLOAT64_C(   0.001154), SIMDE_FLOAT64_C(  -0.001045) } },
+    { { SIMDE_FLOAT64_C( 499.99), SIMDE_FLOAT64_C(-637.29), SIMDE_FLOAT64_C( 858.83), SIMDE_FLOAT64_C(-591.90),
+        SIMDE_FLOAT64_C(-299.70), SIMDE_FLOAT64_C( 650.20), SIMDE_FLOAT64_C( 953.51), SIMDE_FLOAT64_C(-414.12) },
+      UINT8_C(  203),
+      { SIMDE_FLOAT64_C( 502.49), SIMDE_FLOAT64_C(-230.73), SIMDE_FLOAT64_C(-794.84), SIMDE_FLOAT64_C(-447.24),
+        SIMDE_FLOAT64_C( 107.93), SIMDE_FLOAT64_C( 243.55), SIMDE_FLOAT64_C(-848.11), SIMDE_FLOAT64_C( 827.39) },
+      { SIMDE_FLOAT64_C(   0.001990), SIMDE_FLOAT64_C(  -0.004334), SIMDE_FLOAT64_C( 858.83), SIMDE_FLOAT64_C(  -0.002236),
+        SIMDE_FLOAT64_C(-299.70), SIMDE_FLOAT64_C( 650.20), SIMDE_FLOAT64_C(  -0.001179), SIMDE_FLOAT64_C(   0.001209) } },
+    { { SIMDE_FLOAT64_C(-870.08), SIMDE_FLOAT64_C( 969.22), SIMDE_FLOAT64_C( 682.06), SIMDE_FLOAT64_C(-725.19),
+        SIMDE_FLOAT64_C(-317.35), SIMDE_FLOAT64_C( 829.74), SIMDE_FLOAT64_C(-633.39), SIMDE_FLOAT64_C( 832.78) },
+      UINT8_C(  121),
+      { SIMDE_FLOAT64_C(-575.46), SIMDE_FLOAT64_C( 446.88), SIMDE_FLOAT64_C( 805.92), SIMDE_FLOAT64_C(-207.18),
+        SIMDE_FLOAT64_C(-210.66), SIMDE_FLOAT64_C(-517.47), SIMDE_FLOAT64_C( 919.73), SIMDE_FLOAT64_C(-826.38) },
+      { SIMDE_FLOAT64_C(  -0.001738), SIMDE_FLOAT64_C( 969.22), SIMDE_FLOAT64_C( 682.06), SIMDE_FLOAT64_C(  -0.004827),
+        SIMDE_FLOAT64_C(  -0.004747), SIMDE_FLOAT64_C(  -0.001933), SIMDE_FLOAT64_C(   0.001087), SIMDE_FLOAT64_C( 832.78) } },
+    { { SIMDE_FLOAT64_C( 899.88), SIMDE_FLOAT64_C(-884.64), SIMDE_FLOAT64_C(-537.66), SIMDE_FLOAT64_C(-706.15),
+        SIMDE_FLOAT64_C(-999.51), SIMDE_FLOAT64_C(-221.18), SIMDE_FLOAT64_C(-244.21), SIMDE_FLOAT64_C( 708.40) },
+      UINT8_C(  102),
+      { SIMDE_FLOAT64_C(-388.60), SIMDE_FLOAT64_C(  42.54), SIMDE_FLOAT64_C(-411.47), SIMDE_FLOAT64_C(  37.56),
+        SIMDE_FLOAT64_C(   1.47), SIMDE_FLOAT64_C(-888.07), SIMDE_FLOAT64_C(-881.55), SIMDE_FLOAT64_C( 535.67) },
+      { SIMDE_FLOAT64_C( 899.88), SIMDE_FLOAT64_C(   0.023507), SIMDE_FLOAT64_C(  -0.002430), SIMDE_FLOAT64_C(-706.15),
+        SIMDE_FLOAT64_C(-999.51), SIMDE_FLOAT64_C(  -0.001126), SIMDE_FLOAT64_C(  -0.001134), SIMDE_FLOAT64_C( 708.40) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_rcp14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(  194),
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.00),    SIMDE_MATH_INFINITY,   -SIMDE_MATH_INFINITY,
+                SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   4.00), SIMDE_FLOAT64_C(  -0.50), SIMDE_FLOAT64_C(   1.00) },
+      { SIMDE_FLOAT64_C(   0.00),       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -2.00), SIMDE_FLOAT64_C(   1.00) } },
+    #endif
+    { UINT8_C(   13),
+      { SIMDE_FLOAT64_C( 415.59), SIMDE_FLOAT64_C(-575.52), SIMDE_FLOAT64_C(-671.51), SIMDE_FLOAT64_C(  11.33),
+        SIMDE_FLOAT64_C( 732.38), SIMDE_FLOAT64_C(-909.45), SIMDE_FLOAT64_C(-167.31), SIMDE_FLOAT64_C(-886.97) },
+      { SIMDE_FLOAT64_C(   0.002406), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.001489), SIMDE_FLOAT64_C(   0.088263),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(   98),
+      { SIMDE_FLOAT64_C(-712.72), SIMDE_FLOAT64_C(-461.52), SIMDE_FLOAT64_C(-372.13), SIMDE_FLOAT64_C( -36.12),
+        SIMDE_FLOAT64_C(-946.52), SIMDE_FLOAT64_C(-998.57), SIMDE_FLOAT64_C( 721.22), SIMDE_FLOAT64_C( 714.99) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.002167), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.001001), SIMDE_FLOAT64_C(   0.001387), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(   66),
+      { SIMDE_FLOAT64_C(-856.53), SIMDE_FLOAT64_C(-111.59), SIMDE_FLOAT64_C(-797.55), SIMDE_FLOAT64_C( 753.27),
+        SIMDE_FLOAT64_C(-258.78), SIMDE_FLOAT64_C( 755.09), SIMDE_FLOAT64_C(-118.84), SIMDE_FLOAT64_C( 848.70) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.008961), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.008415), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(   40),
+      { SIMDE_FLOAT64_C(-750.27), SIMDE_FLOAT64_C(  49.05), SIMDE_FLOAT64_C(-390.49), SIMDE_FLOAT64_C(-308.12),
+        SIMDE_FLOAT64_C(-925.41), SIMDE_FLOAT64_C(-924.72), SIMDE_FLOAT64_C(-926.97), SIMDE_FLOAT64_C( 408.53) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.003245),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.001081), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  123),
+      { SIMDE_FLOAT64_C(-301.46), SIMDE_FLOAT64_C(-231.65), SIMDE_FLOAT64_C(-794.08), SIMDE_FLOAT64_C(-161.60),
+        SIMDE_FLOAT64_C(-202.28), SIMDE_FLOAT64_C( 865.20), SIMDE_FLOAT64_C(-978.57), SIMDE_FLOAT64_C(-526.11) },
+      { SIMDE_FLOAT64_C(  -0.003317), SIMDE_FLOAT64_C(  -0.004317), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.006188),
+        SIMDE_FLOAT64_C(  -0.004944), SIMDE_FLOAT64_C(   0.001156), SIMDE_FLOAT64_C(  -0.001022), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  211),
+      { SIMDE_FLOAT64_C(  70.74), SIMDE_FLOAT64_C(-966.54), SIMDE_FLOAT64_C( 938.01), SIMDE_FLOAT64_C(-626.23),
+        SIMDE_FLOAT64_C(-449.61), SIMDE_FLOAT64_C( 960.56), SIMDE_FLOAT64_C(-606.44), SIMDE_FLOAT64_C(-396.16) },
+      { SIMDE_FLOAT64_C(   0.014137), SIMDE_FLOAT64_C(  -0.001035), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(  -0.002224), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(  -0.001649), SIMDE_FLOAT64_C(  -0.002524) } },
+    { UINT8_C(  152),
+      { SIMDE_FLOAT64_C( 431.81), SIMDE_FLOAT64_C( 586.18), SIMDE_FLOAT64_C( 259.96), SIMDE_FLOAT64_C(  25.14),
+        SIMDE_FLOAT64_C( 410.20), SIMDE_FLOAT64_C( 495.36), SIMDE_FLOAT64_C(-148.05), SIMDE_FLOAT64_C( 276.48) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.039778),
+        SIMDE_FLOAT64_C(   0.002438), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.003617) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_rcp14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rcp14_ps_bound)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rcp14_ps_bound)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rcp14_ps_bound)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rcp14_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
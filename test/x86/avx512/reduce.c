@@ -0,0 +1,2679 @@
+#define SIMDE_TEST_X86_AVX512_INSN reduce
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/reduce.h>
+
+static int
+test_simde_mm512_reduce_add_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C(1809923392), -INT32_C(1389612901),  INT32_C( 654359577), -INT32_C( 472623770),
+        -INT32_C(1102473109), -INT32_C(1427392494),  INT32_C(  60726788), -INT32_C( 883405179),
+         INT32_C( 400707718),  INT32_C( 211509944),  INT32_C(2134869678), -INT32_C(  23234100),
+        -INT32_C(1212862254),  INT32_C(1704942939),  INT32_C(1303098839),  INT32_C(1579708498) },
+      -INT32_C( 271603218) },
+    { {  INT32_C(1887988140),  INT32_C( 477823150),  INT32_C(  31059063), -INT32_C( 876335635),
+        -INT32_C(1138896883), -INT32_C(1427917429), -INT32_C( 541880840),  INT32_C( 193051657),
+         INT32_C( 536052730), -INT32_C( 652392946),  INT32_C( 979700746), -INT32_C(1782087068),
+         INT32_C( 641436449), -INT32_C(1245869962),  INT32_C(1254889586), -INT32_C(1780088951) },
+      INT32_C( 851499103) },
+    { {  INT32_C(1261782203),  INT32_C(1669240309), -INT32_C( 879973163),  INT32_C( 172888891),
+        -INT32_C(1891334341), -INT32_C(2000818404),  INT32_C(1005158698), -INT32_C(1643122559),
+        -INT32_C( 381023696), -INT32_C(1348386040), -INT32_C(1286441272), -INT32_C( 935418675),
+        -INT32_C( 303258086), -INT32_C(1668109362), -INT32_C( 813783521),  INT32_C( 208255258) },
+      -INT32_C( 244409168) },
+    { {  INT32_C( 310511243), -INT32_C( 497308305),  INT32_C( 649931435), -INT32_C( 744138123),
+        -INT32_C(  16952179), -INT32_C( 614963523), -INT32_C( 327902709), -INT32_C(1536151605),
+        -INT32_C( 610770072), -INT32_C(1671405059),  INT32_C( 520174672), -INT32_C( 350339782),
+         INT32_C(1706831858),  INT32_C(1825962848),  INT32_C( 720213781),  INT32_C(  72945525) },
+      -INT32_C( 563359995) },
+    { { -INT32_C(1650627997), -INT32_C(1727791423),  INT32_C( 324235794),  INT32_C( 538540090),
+        -INT32_C(1872059903), -INT32_C(1414532281), -INT32_C(  17832623), -INT32_C(1140527136),
+         INT32_C( 953020347), -INT32_C(1404022253),  INT32_C( 971576350),  INT32_C(1817703945),
+         INT32_C(  45059936),  INT32_C(1794617374),  INT32_C( 423166952), -INT32_C( 787195046) },
+      INT32_C(1148299422) },
+    { {  INT32_C(1440681386),  INT32_C(1541336668), -INT32_C( 519860157), -INT32_C( 868955834),
+         INT32_C(1763650029), -INT32_C(1203274485), -INT32_C( 800678195), -INT32_C( 684349780),
+         INT32_C(1928120093), -INT32_C(2111374117), -INT32_C( 453492798), -INT32_C(1496401123),
+        -INT32_C(1779589659),  INT32_C( 972399774), -INT32_C( 747006628), -INT32_C(1376484645) },
+      -INT32_C( 100312175) },
+    { {  INT32_C(1548099755),  INT32_C( 505872912),  INT32_C( 918074887), -INT32_C(1878040714),
+        -INT32_C(1214848687),  INT32_C( 791065460),  INT32_C( 568534567),  INT32_C( 981419374),
+        -INT32_C( 301148023),  INT32_C( 254365600),  INT32_C(1652392192), -INT32_C(1059531689),
+         INT32_C( 641463976),  INT32_C( 712708707),  INT32_C( 325095680), -INT32_C(1797436447) },
+      -INT32_C(1646879746) },
+    { {  INT32_C(1911123096), -INT32_C( 104585203),  INT32_C(2023929048),  INT32_C( 794816977),
+         INT32_C( 665445767), -INT32_C(1909604401),  INT32_C( 743779664),  INT32_C( 943558934),
+        -INT32_C(1442049393), -INT32_C( 381530061), -INT32_C( 134783173),  INT32_C(1935694270),
+         INT32_C(1116242518),  INT32_C(1381513629), -INT32_C( 655790548),  INT32_C( 395549125) },
+      -INT32_C(1306624343) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_add_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(1762640955543315256), -INT64_C(8003914771028583266),  INT64_C(5784905427172074394), -INT64_C(4515810573831627613),
+         INT64_C(2154600115633911634), -INT64_C(7276486523781772561),  INT64_C(1438715608294166631), -INT64_C(2893447618490075665) },
+      INT64_C(3372664782134329914) },
+    { { -INT64_C(2426068428074679022), -INT64_C(4829818478234881711),  INT64_C(3877164791828053935), -INT64_C(9036830030885141921),
+        -INT64_C(5636390867617791680), -INT64_C(5930902408212454111),  INT64_C(2846445282051208697),  INT64_C(3080377711178950559) },
+      INT64_C( 390721645742816362) },
+    { {  INT64_C(4168012024958638005),  INT64_C(4260170294471998299),  INT64_C(8129615551844635117), -INT64_C(3215791149503384393),
+        -INT64_C(2454199016991674322),  INT64_C(3415069412146016568), -INT64_C(2743263015717122573),  INT64_C( 420941894603982871) },
+      -INT64_C(6466188077896462044) },
+    { {  INT64_C(5202862189163494743),  INT64_C(6138247570081215534), -INT64_C(5138310623831968935),  INT64_C( 744184563336388616),
+         INT64_C(6682240513528617479), -INT64_C(8357615447312787616),  INT64_C(4818625077777212091),  INT64_C(2664177798201342169) },
+      -INT64_C(5692332432766037535) },
+    { {  INT64_C( 845944518984785516),  INT64_C(6607229592605954330),  INT64_C(4631386534449511520), -INT64_C( 988952612502874742),
+         INT64_C( 248403582689048814),  INT64_C( 463244573185241940),  INT64_C(9002795112046400278), -INT64_C(1419462567424277987) },
+      INT64_C( 943844660324238053) },
+    { { -INT64_C(2358860066669815337), -INT64_C( 268225260703991424),  INT64_C(8019693118702745996), -INT64_C(5264608401918598456),
+         INT64_C(5799886332047106883),  INT64_C(7990267338839778758), -INT64_C(7840464270146479445),  INT64_C(9065474351586588734) },
+      -INT64_C(3303580931972215907) },
+    { { -INT64_C(5134114609519675726),  INT64_C(7232173677118860535),  INT64_C( 532662719943829600),  INT64_C(1472055158670877815),
+        -INT64_C(2160573299161805317),  INT64_C(5363868757904725546), -INT64_C(7922747896042945035), -INT64_C(8505093034987759260) },
+      -INT64_C(9121768526073891842) },
+    { {  INT64_C(6857433795686241621),  INT64_C(8887656432238816193),  INT64_C(7718041045878573433), -INT64_C(5761087737521340285),
+         INT64_C(4216643215661877537),  INT64_C(3988592345278527484), -INT64_C(8982762096187028569), -INT64_C(6289513817275375201) },
+      -INT64_C(7811740889949259403) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_add_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   483.27), SIMDE_FLOAT32_C(  -276.14), SIMDE_FLOAT32_C(  -751.45), SIMDE_FLOAT32_C(   302.01),
+        SIMDE_FLOAT32_C(   300.60), SIMDE_FLOAT32_C(  -352.29), SIMDE_FLOAT32_C(   998.58), SIMDE_FLOAT32_C(   394.74),
+        SIMDE_FLOAT32_C(  -406.44), SIMDE_FLOAT32_C(  -164.03), SIMDE_FLOAT32_C(   266.69), SIMDE_FLOAT32_C(  -538.79),
+        SIMDE_FLOAT32_C(   962.56), SIMDE_FLOAT32_C(   168.69), SIMDE_FLOAT32_C(  -275.26), SIMDE_FLOAT32_C(   887.23) },
+      SIMDE_FLOAT32_C(  1999.97) },
+    { { SIMDE_FLOAT32_C(  -187.91), SIMDE_FLOAT32_C(  -184.83), SIMDE_FLOAT32_C(  -570.88), SIMDE_FLOAT32_C(   812.67),
+        SIMDE_FLOAT32_C(   381.14), SIMDE_FLOAT32_C(  -106.44), SIMDE_FLOAT32_C(   504.85), SIMDE_FLOAT32_C(  -973.95),
+        SIMDE_FLOAT32_C(  -466.55), SIMDE_FLOAT32_C(    93.81), SIMDE_FLOAT32_C(   534.98), SIMDE_FLOAT32_C(  -315.26),
+        SIMDE_FLOAT32_C(  -921.31), SIMDE_FLOAT32_C(  -212.37), SIMDE_FLOAT32_C(  -465.96), SIMDE_FLOAT32_C(  -145.76) },
+      SIMDE_FLOAT32_C( -2223.77) },
+    { { SIMDE_FLOAT32_C(  -804.83), SIMDE_FLOAT32_C(  -576.52), SIMDE_FLOAT32_C(   205.63), SIMDE_FLOAT32_C(  -943.58),
+        SIMDE_FLOAT32_C(   825.11), SIMDE_FLOAT32_C(  -666.39), SIMDE_FLOAT32_C(   486.15), SIMDE_FLOAT32_C(    84.99),
+        SIMDE_FLOAT32_C(  -601.87), SIMDE_FLOAT32_C(  -769.38), SIMDE_FLOAT32_C(   247.50), SIMDE_FLOAT32_C(  -838.02),
+        SIMDE_FLOAT32_C(   340.00), SIMDE_FLOAT32_C(  -186.87), SIMDE_FLOAT32_C(  -224.92), SIMDE_FLOAT32_C(   933.49) },
+      SIMDE_FLOAT32_C( -2489.51) },
+    { { SIMDE_FLOAT32_C(   396.97), SIMDE_FLOAT32_C(  -573.17), SIMDE_FLOAT32_C(   256.50), SIMDE_FLOAT32_C(   434.92),
+        SIMDE_FLOAT32_C(   965.61), SIMDE_FLOAT32_C(  -268.36), SIMDE_FLOAT32_C(   481.46), SIMDE_FLOAT32_C(  -518.74),
+        SIMDE_FLOAT32_C(  -673.17), SIMDE_FLOAT32_C(   740.08), SIMDE_FLOAT32_C(   295.30), SIMDE_FLOAT32_C(  -333.03),
+        SIMDE_FLOAT32_C(  -912.86), SIMDE_FLOAT32_C(  -821.56), SIMDE_FLOAT32_C(   648.85), SIMDE_FLOAT32_C(   -83.64) },
+      SIMDE_FLOAT32_C(    35.16) },
+    { { SIMDE_FLOAT32_C(  -458.83), SIMDE_FLOAT32_C(  -389.86), SIMDE_FLOAT32_C(   250.69), SIMDE_FLOAT32_C(   647.16),
+        SIMDE_FLOAT32_C(   128.72), SIMDE_FLOAT32_C(   486.61), SIMDE_FLOAT32_C(  -307.36), SIMDE_FLOAT32_C(   623.22),
+        SIMDE_FLOAT32_C(   999.27), SIMDE_FLOAT32_C(   212.27), SIMDE_FLOAT32_C(  -204.94), SIMDE_FLOAT32_C(   369.59),
+        SIMDE_FLOAT32_C(   194.36), SIMDE_FLOAT32_C(   944.30), SIMDE_FLOAT32_C(   956.84), SIMDE_FLOAT32_C(  -825.73) },
+      SIMDE_FLOAT32_C(  3626.31) },
+    { { SIMDE_FLOAT32_C(  -192.27), SIMDE_FLOAT32_C(   171.74), SIMDE_FLOAT32_C(  -582.35), SIMDE_FLOAT32_C(   516.25),
+        SIMDE_FLOAT32_C(  -407.55), SIMDE_FLOAT32_C(   996.58), SIMDE_FLOAT32_C(   564.11), SIMDE_FLOAT32_C(   671.76),
+        SIMDE_FLOAT32_C(   807.21), SIMDE_FLOAT32_C(  -478.77), SIMDE_FLOAT32_C(   374.18), SIMDE_FLOAT32_C(   369.56),
+        SIMDE_FLOAT32_C(  -101.11), SIMDE_FLOAT32_C(   870.65), SIMDE_FLOAT32_C(  -622.14), SIMDE_FLOAT32_C(  -202.87) },
+      SIMDE_FLOAT32_C(  2754.98) },
+    { { SIMDE_FLOAT32_C(  -367.75), SIMDE_FLOAT32_C(  -527.85), SIMDE_FLOAT32_C(   811.34), SIMDE_FLOAT32_C(   508.73),
+        SIMDE_FLOAT32_C(   369.88), SIMDE_FLOAT32_C(  -308.58), SIMDE_FLOAT32_C(  -382.54), SIMDE_FLOAT32_C(  -101.17),
+        SIMDE_FLOAT32_C(  -380.61), SIMDE_FLOAT32_C(  -371.17), SIMDE_FLOAT32_C(   830.41), SIMDE_FLOAT32_C(   208.96),
+        SIMDE_FLOAT32_C(   962.38), SIMDE_FLOAT32_C(   534.06), SIMDE_FLOAT32_C(  -446.23), SIMDE_FLOAT32_C(  -926.79) },
+      SIMDE_FLOAT32_C(   413.07) },
+    { { SIMDE_FLOAT32_C(   700.31), SIMDE_FLOAT32_C(    19.38), SIMDE_FLOAT32_C(  -185.76), SIMDE_FLOAT32_C(  -306.69),
+        SIMDE_FLOAT32_C(   325.79), SIMDE_FLOAT32_C(   791.60), SIMDE_FLOAT32_C(   921.90), SIMDE_FLOAT32_C(   857.02),
+        SIMDE_FLOAT32_C(   934.88), SIMDE_FLOAT32_C(  -601.01), SIMDE_FLOAT32_C(    83.82), SIMDE_FLOAT32_C(   -33.84),
+        SIMDE_FLOAT32_C(   471.66), SIMDE_FLOAT32_C(  -190.90), SIMDE_FLOAT32_C(   216.92), SIMDE_FLOAT32_C(   424.09) },
+      SIMDE_FLOAT32_C(  4429.17) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_add_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   710.56), SIMDE_FLOAT64_C(  -837.22), SIMDE_FLOAT64_C(   977.86), SIMDE_FLOAT64_C(  -621.40),
+        SIMDE_FLOAT64_C(   833.51), SIMDE_FLOAT64_C(    69.40), SIMDE_FLOAT64_C(   857.85), SIMDE_FLOAT64_C(   194.02) },
+      SIMDE_FLOAT64_C(  2184.58) },
+    { { SIMDE_FLOAT64_C(  -245.72), SIMDE_FLOAT64_C(   721.71), SIMDE_FLOAT64_C(   823.15), SIMDE_FLOAT64_C(  -702.36),
+        SIMDE_FLOAT64_C(   539.39), SIMDE_FLOAT64_C(   479.39), SIMDE_FLOAT64_C(  -119.90), SIMDE_FLOAT64_C(   -65.21) },
+      SIMDE_FLOAT64_C(  1430.45) },
+    { { SIMDE_FLOAT64_C(   431.12), SIMDE_FLOAT64_C(   596.65), SIMDE_FLOAT64_C(   -38.98), SIMDE_FLOAT64_C(   -37.03),
+        SIMDE_FLOAT64_C(   821.74), SIMDE_FLOAT64_C(  -524.50), SIMDE_FLOAT64_C(   939.57), SIMDE_FLOAT64_C(    76.80) },
+      SIMDE_FLOAT64_C(  2265.37) },
+    { { SIMDE_FLOAT64_C(  -335.20), SIMDE_FLOAT64_C(   570.45), SIMDE_FLOAT64_C(     6.21), SIMDE_FLOAT64_C(   781.65),
+        SIMDE_FLOAT64_C(  -236.87), SIMDE_FLOAT64_C(   387.68), SIMDE_FLOAT64_C(   836.37), SIMDE_FLOAT64_C(  -580.36) },
+      SIMDE_FLOAT64_C(  1429.93) },
+    { { SIMDE_FLOAT64_C(   486.59), SIMDE_FLOAT64_C(   992.98), SIMDE_FLOAT64_C(   100.86), SIMDE_FLOAT64_C(  -831.04),
+        SIMDE_FLOAT64_C(   118.57), SIMDE_FLOAT64_C(  -276.28), SIMDE_FLOAT64_C(  -840.64), SIMDE_FLOAT64_C(   895.75) },
+      SIMDE_FLOAT64_C(   646.79) },
+    { { SIMDE_FLOAT64_C(  -153.68), SIMDE_FLOAT64_C(   320.09), SIMDE_FLOAT64_C(  -366.29), SIMDE_FLOAT64_C(   569.41),
+        SIMDE_FLOAT64_C(  -271.28), SIMDE_FLOAT64_C(  -394.82), SIMDE_FLOAT64_C(   202.40), SIMDE_FLOAT64_C(  -127.23) },
+      SIMDE_FLOAT64_C(  -221.40) },
+    { { SIMDE_FLOAT64_C(  -375.55), SIMDE_FLOAT64_C(    88.48), SIMDE_FLOAT64_C(   802.43), SIMDE_FLOAT64_C(    36.54),
+        SIMDE_FLOAT64_C(   794.76), SIMDE_FLOAT64_C(   820.72), SIMDE_FLOAT64_C(    -2.43), SIMDE_FLOAT64_C(  -716.87) },
+      SIMDE_FLOAT64_C(  1448.08) },
+    { { SIMDE_FLOAT64_C(  -470.69), SIMDE_FLOAT64_C(  -743.28), SIMDE_FLOAT64_C(   -39.96), SIMDE_FLOAT64_C(   892.26),
+        SIMDE_FLOAT64_C(   -47.31), SIMDE_FLOAT64_C(  -159.88), SIMDE_FLOAT64_C(   -60.83), SIMDE_FLOAT64_C(   -63.33) },
+      SIMDE_FLOAT64_C(  -693.02) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_add_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C( 967820813),  INT32_C( 449431745), -INT32_C( 135569228), -INT32_C( 552172686),
+         INT32_C(2123207984), -INT32_C(1862191942),  INT32_C( 590069051), -INT32_C(1205408800),
+         INT32_C(1221647334), -INT32_C(1257114708), -INT32_C(1869097797),  INT32_C( 497465865),
+        -INT32_C( 897986340),  INT32_C( 920128117),  INT32_C( 484241590),  INT32_C( 223343039) },
+      INT32_C(1933049856) },
+    { { -INT32_C(1417793173), -INT32_C( 974527741), -INT32_C(1737084213), -INT32_C(1188901359),
+        -INT32_C(2055202894), -INT32_C( 837185505), -INT32_C( 409981298), -INT32_C( 471606216),
+         INT32_C(1403728792),  INT32_C(1610160921),  INT32_C( 516293105),  INT32_C(1816542780),
+        -INT32_C( 274190039), -INT32_C(1121224207),  INT32_C(1896148521),  INT32_C(1463314451) },
+      -INT32_C(1724199936) },
+    { {  INT32_C( 947320402),  INT32_C( 493297748), -INT32_C(2115454478),  INT32_C(1252762178),
+        -INT32_C(1601563572),  INT32_C(1101453512), -INT32_C( 696472456),  INT32_C( 851374161),
+         INT32_C(1825967416), -INT32_C( 454010872), -INT32_C(1749330059),  INT32_C(1304897174),
+        -INT32_C(1947549161),  INT32_C(2133514184),  INT32_C(1820524437), -INT32_C( 518130510) },
+      INT32_C(1526726656) },
+    { { -INT32_C(  83629934),  INT32_C(1642332660), -INT32_C( 991756313), -INT32_C(1497388630),
+        -INT32_C(1132488156), -INT32_C( 757017525),  INT32_C(1744867159), -INT32_C(1662749126),
+         INT32_C(1801580748),  INT32_C(1497258636), -INT32_C( 947350982),  INT32_C( 103515797),
+        -INT32_C(1933156692), -INT32_C( 826597318),  INT32_C(1438678317), -INT32_C(1194044679) },
+      INT32_C(2100723712) },
+    { { -INT32_C( 844046569),  INT32_C(  24642969), -INT32_C( 398432684), -INT32_C( 985707367),
+         INT32_C(  97966248),  INT32_C(1660451294), -INT32_C(2070470016),  INT32_C(1877037745),
+         INT32_C(1203539760), -INT32_C(  41269007), -INT32_C(2090922839),  INT32_C(1414294505),
+        -INT32_C(1024959304),  INT32_C(1689790097), -INT32_C(2071439930),  INT32_C(1939597154) },
+      INT32_C(1388314624) },
+    { { -INT32_C( 429704100), -INT32_C(1092936601), -INT32_C(   1435385),  INT32_C(1275333358),
+         INT32_C( 991878599), -INT32_C( 656203104),  INT32_C( 921887010),  INT32_C(1271714183),
+        -INT32_C(2139534033), -INT32_C(2081526491), -INT32_C(2105224498),  INT32_C(2134684368),
+         INT32_C(1646429915),  INT32_C(1868401498),  INT32_C(1792188472),  INT32_C(1864857579) },
+      -INT32_C(1801715712) },
+    { { -INT32_C(2033414740),  INT32_C(1012900269),  INT32_C(1934926236),  INT32_C( 349108418),
+        -INT32_C(  23681835),  INT32_C(1044780805), -INT32_C( 288773892),  INT32_C(1927967008),
+         INT32_C(1733204749),  INT32_C(1468047154),  INT32_C(1751233784),  INT32_C( 467869613),
+        -INT32_C(2008213651), -INT32_C(1433848948), -INT32_C(1384335637), -INT32_C(1736354785) },
+      INT32_C( 896270336) },
+    { {  INT32_C(1169133320), -INT32_C( 958795842), -INT32_C( 759679248),  INT32_C(1590930586),
+        -INT32_C(  76327565), -INT32_C(1412402513), -INT32_C(2122042271),  INT32_C( 785906739),
+         INT32_C( 818164914), -INT32_C(  26233181),  INT32_C( 908000525), -INT32_C(1912375854),
+        -INT32_C(1080097294), -INT32_C(1457616589),  INT32_C( 504125693), -INT32_C(1811283484) },
+      -INT32_C(1831157760) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_mul_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { {  INT64_C(6162084306202547620), -INT64_C(4878958641043506844), -INT64_C(5730529997676823644), -INT64_C(5207491384827767799),
+        -INT64_C(8899050637366599165),  INT64_C(6568923244393081663), -INT64_C(7957578684232442288), -INT64_C(6897497145539673145) },
+      -INT64_C(3079230314596262912) },
+    { {  INT64_C(2243227041447504258),  INT64_C(2303378519941328097),  INT64_C( 996832030481966122), -INT64_C(7214337266109600893),
+         INT64_C(2081468960294419248), -INT64_C(8903965144436348607), -INT64_C(8716652922187739200), -INT64_C(2829354381640148008) },
+      -INT64_C( 250191114211917824) },
+    { { -INT64_C( 203837229984732081), -INT64_C( 323456334410601192), -INT64_C(4673110113198552254), -INT64_C(5559792323660983053),
+         INT64_C(8494512170892989021),  INT64_C(2922543562722048311),  INT64_C(3657977769505204984), -INT64_C(3419630910485763427) },
+      -INT64_C(8758615610253728896) },
+    { { -INT64_C(8094458948608068685), -INT64_C(6169919029943436293),  INT64_C(4717916158122528782),  INT64_C(6082510625662631494),
+        -INT64_C(4726102277266254769),  INT64_C(2513912809938305562), -INT64_C( 104588699820365312),  INT64_C(7121160858019491129) },
+      INT64_C(5584144866961862656) },
+    { {  INT64_C(6520725411146229116), -INT64_C(3252555226576004346), -INT64_C(7306367452917178462),  INT64_C(6240615289125501006),
+         INT64_C(1455756300066782639),  INT64_C(9037652038971711382),  INT64_C(1701565478609410843), -INT64_C(2225353611065106590) },
+      -INT64_C(2275117013289101696) },
+    { {  INT64_C(6295800939132292779),  INT64_C(7350996396251201539), -INT64_C(1774255513754687092), -INT64_C(4701923063305530385),
+         INT64_C(2641842182081038790), -INT64_C(7791581015335681768), -INT64_C(1044594719289136795),  INT64_C( 431727762745471783) },
+      INT64_C(6591453655425587136) },
+    { { -INT64_C( 586722066646488513),  INT64_C(7419262238211967451),  INT64_C(1115486014564016609), -INT64_C(2848538460329783642),
+        -INT64_C(5656421142526605292), -INT64_C(1411178465791032613), -INT64_C(2787722615290891319),  INT64_C(  69550013342007833) },
+      INT64_C(7633916552344020936) },
+    { {  INT64_C(7055402814456061957),  INT64_C(5405974885564244201),  INT64_C(8498159769215480935), -INT64_C(7877230387590822246),
+        -INT64_C(5092477063636671101),  INT64_C(2027299923277756955), -INT64_C(8510083803315888830),  INT64_C(1779718251230574899) },
+      INT64_C( 333002865128074484) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_mul_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    -1.34), SIMDE_FLOAT32_C(     1.70), SIMDE_FLOAT32_C(     1.44), SIMDE_FLOAT32_C(     1.70),
+        SIMDE_FLOAT32_C(    -0.80), SIMDE_FLOAT32_C(     0.80), SIMDE_FLOAT32_C(    -1.11), SIMDE_FLOAT32_C(    -0.64),
+        SIMDE_FLOAT32_C(    -1.73), SIMDE_FLOAT32_C(    -1.29), SIMDE_FLOAT32_C(     1.58), SIMDE_FLOAT32_C(    -0.66),
+        SIMDE_FLOAT32_C(     1.08), SIMDE_FLOAT32_C(     1.28), SIMDE_FLOAT32_C(    -0.72), SIMDE_FLOAT32_C(     1.34) },
+      SIMDE_FLOAT32_C(     7.87) },
+    { { SIMDE_FLOAT32_C(     1.55), SIMDE_FLOAT32_C(     0.66), SIMDE_FLOAT32_C(    -0.66), SIMDE_FLOAT32_C(     1.21),
+        SIMDE_FLOAT32_C(     0.61), SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(     1.23), SIMDE_FLOAT32_C(     1.62),
+        SIMDE_FLOAT32_C(    -1.02), SIMDE_FLOAT32_C(     0.58), SIMDE_FLOAT32_C(    -1.40), SIMDE_FLOAT32_C(    -0.53),
+        SIMDE_FLOAT32_C(     1.26), SIMDE_FLOAT32_C(    -1.26), SIMDE_FLOAT32_C(     1.45), SIMDE_FLOAT32_C(    -1.67) },
+      SIMDE_FLOAT32_C(     2.33) },
+    { { SIMDE_FLOAT32_C(    -1.63), SIMDE_FLOAT32_C(     1.02), SIMDE_FLOAT32_C(     1.10), SIMDE_FLOAT32_C(     1.47),
+        SIMDE_FLOAT32_C(    -1.29), SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(    -1.23), SIMDE_FLOAT32_C(     1.34),
+        SIMDE_FLOAT32_C(     0.70), SIMDE_FLOAT32_C(     0.51), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(    -0.87),
+        SIMDE_FLOAT32_C(    -1.16), SIMDE_FLOAT32_C(    -1.16), SIMDE_FLOAT32_C(     1.26), SIMDE_FLOAT32_C(    -1.09) },
+      SIMDE_FLOAT32_C(     3.15) },
+    { { SIMDE_FLOAT32_C(    -1.23), SIMDE_FLOAT32_C(     0.51), SIMDE_FLOAT32_C(    -0.71), SIMDE_FLOAT32_C(     1.24),
+        SIMDE_FLOAT32_C(     1.02), SIMDE_FLOAT32_C(     0.92), SIMDE_FLOAT32_C(    -0.59), SIMDE_FLOAT32_C(    -1.30),
+        SIMDE_FLOAT32_C(    -1.50), SIMDE_FLOAT32_C(    -0.62), SIMDE_FLOAT32_C(     0.96), SIMDE_FLOAT32_C(     1.47),
+        SIMDE_FLOAT32_C(     1.59), SIMDE_FLOAT32_C(     0.96), SIMDE_FLOAT32_C(    -0.53), SIMDE_FLOAT32_C(    -0.82) },
+      SIMDE_FLOAT32_C(     0.35) },
+    { { SIMDE_FLOAT32_C(    -1.27), SIMDE_FLOAT32_C(     0.80), SIMDE_FLOAT32_C(     0.80), SIMDE_FLOAT32_C(     0.55),
+        SIMDE_FLOAT32_C(    -1.55), SIMDE_FLOAT32_C(     1.17), SIMDE_FLOAT32_C(     1.66), SIMDE_FLOAT32_C(    -1.40),
+        SIMDE_FLOAT32_C(     0.52), SIMDE_FLOAT32_C(    -1.54), SIMDE_FLOAT32_C(     1.69), SIMDE_FLOAT32_C(    -1.62),
+        SIMDE_FLOAT32_C(     0.77), SIMDE_FLOAT32_C(    -1.59), SIMDE_FLOAT32_C(     0.76), SIMDE_FLOAT32_C(    -1.47) },
+      SIMDE_FLOAT32_C(    -5.65) },
+    { { SIMDE_FLOAT32_C(     1.35), SIMDE_FLOAT32_C(    -0.92), SIMDE_FLOAT32_C(    -1.70), SIMDE_FLOAT32_C(     1.10),
+        SIMDE_FLOAT32_C(     1.29), SIMDE_FLOAT32_C(    -1.11), SIMDE_FLOAT32_C(     1.08), SIMDE_FLOAT32_C(     0.88),
+        SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(     0.58), SIMDE_FLOAT32_C(    -1.55), SIMDE_FLOAT32_C(     0.61),
+        SIMDE_FLOAT32_C(     1.63), SIMDE_FLOAT32_C(    -0.98), SIMDE_FLOAT32_C(     1.74), SIMDE_FLOAT32_C(     1.06) },
+      SIMDE_FLOAT32_C(    -3.98) },
+    { { SIMDE_FLOAT32_C(     0.98), SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(    -0.89), SIMDE_FLOAT32_C(     1.62),
+        SIMDE_FLOAT32_C(     0.69), SIMDE_FLOAT32_C(     1.42), SIMDE_FLOAT32_C(    -1.02), SIMDE_FLOAT32_C(     1.50),
+        SIMDE_FLOAT32_C(    -0.70), SIMDE_FLOAT32_C(     1.37), SIMDE_FLOAT32_C(     1.58), SIMDE_FLOAT32_C(     0.96),
+        SIMDE_FLOAT32_C(    -1.57), SIMDE_FLOAT32_C(     0.59), SIMDE_FLOAT32_C(    -1.78), SIMDE_FLOAT32_C(    -1.02) },
+      SIMDE_FLOAT32_C(     4.35) },
+    { { SIMDE_FLOAT32_C(     1.20), SIMDE_FLOAT32_C(    -1.58), SIMDE_FLOAT32_C(    -1.09), SIMDE_FLOAT32_C(     1.28),
+        SIMDE_FLOAT32_C(     1.13), SIMDE_FLOAT32_C(     1.38), SIMDE_FLOAT32_C(     1.16), SIMDE_FLOAT32_C(    -1.52),
+        SIMDE_FLOAT32_C(    -1.43), SIMDE_FLOAT32_C(    -0.69), SIMDE_FLOAT32_C(     0.71), SIMDE_FLOAT32_C(     1.15),
+        SIMDE_FLOAT32_C(    -1.18), SIMDE_FLOAT32_C(    -1.03), SIMDE_FLOAT32_C(     1.71), SIMDE_FLOAT32_C(     1.74) },
+      SIMDE_FLOAT32_C(   -21.19) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_mul_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     0.51), SIMDE_FLOAT64_C(     0.79), SIMDE_FLOAT64_C(     0.58), SIMDE_FLOAT64_C(    -1.09),
+        SIMDE_FLOAT64_C(     0.78), SIMDE_FLOAT64_C(     0.58), SIMDE_FLOAT64_C(     0.57), SIMDE_FLOAT64_C(     1.35) },
+      SIMDE_FLOAT64_C(    -0.09) },
+    { { SIMDE_FLOAT64_C(     0.88), SIMDE_FLOAT64_C(    -1.18), SIMDE_FLOAT64_C(     0.93), SIMDE_FLOAT64_C(    -1.36),
+        SIMDE_FLOAT64_C(     1.18), SIMDE_FLOAT64_C(     1.50), SIMDE_FLOAT64_C(     0.57), SIMDE_FLOAT64_C(     1.73) },
+      SIMDE_FLOAT64_C(     2.29) },
+    { { SIMDE_FLOAT64_C(    -0.77), SIMDE_FLOAT64_C(    -0.70), SIMDE_FLOAT64_C(    -0.74), SIMDE_FLOAT64_C(     1.55),
+        SIMDE_FLOAT64_C(    -0.87), SIMDE_FLOAT64_C(    -1.39), SIMDE_FLOAT64_C(     1.58), SIMDE_FLOAT64_C(    -1.78) },
+      SIMDE_FLOAT64_C(     2.10) },
+    { { SIMDE_FLOAT64_C(    -1.32), SIMDE_FLOAT64_C(     1.34), SIMDE_FLOAT64_C(     1.09), SIMDE_FLOAT64_C(     0.95),
+        SIMDE_FLOAT64_C(     1.20), SIMDE_FLOAT64_C(    -1.53), SIMDE_FLOAT64_C(     0.81), SIMDE_FLOAT64_C(     0.50) },
+      SIMDE_FLOAT64_C(     1.36) },
+    { { SIMDE_FLOAT64_C(     1.29), SIMDE_FLOAT64_C(    -1.10), SIMDE_FLOAT64_C(     0.95), SIMDE_FLOAT64_C(     1.58),
+        SIMDE_FLOAT64_C(    -0.78), SIMDE_FLOAT64_C(    -0.57), SIMDE_FLOAT64_C(     0.58), SIMDE_FLOAT64_C(    -1.34) },
+      SIMDE_FLOAT64_C(     0.74) },
+    { { SIMDE_FLOAT64_C(    -0.93), SIMDE_FLOAT64_C(     1.28), SIMDE_FLOAT64_C(    -0.61), SIMDE_FLOAT64_C(    -0.85),
+        SIMDE_FLOAT64_C(    -1.63), SIMDE_FLOAT64_C(    -0.76), SIMDE_FLOAT64_C(     1.57), SIMDE_FLOAT64_C(     1.28) },
+      SIMDE_FLOAT64_C(    -1.54) },
+    { { SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(    -1.00), SIMDE_FLOAT64_C(     0.66), SIMDE_FLOAT64_C(     1.69),
+        SIMDE_FLOAT64_C(     0.82), SIMDE_FLOAT64_C(    -1.06), SIMDE_FLOAT64_C(    -0.66), SIMDE_FLOAT64_C(    -0.73) },
+      SIMDE_FLOAT64_C(    -0.47) },
+    { { SIMDE_FLOAT64_C(    -0.70), SIMDE_FLOAT64_C(    -0.61), SIMDE_FLOAT64_C(     1.14), SIMDE_FLOAT64_C(     1.63),
+        SIMDE_FLOAT64_C(    -1.27), SIMDE_FLOAT64_C(     1.62), SIMDE_FLOAT64_C(    -1.55), SIMDE_FLOAT64_C(    -1.51) },
+      SIMDE_FLOAT64_C(    -3.82) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_mul_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C(1318750803),  INT32_C( 789129705),  INT32_C( 303738266), -INT32_C(1211173095),
+        -INT32_C(1621386577), -INT32_C(1500845971), -INT32_C(2147174344), -INT32_C(1649837250),
+         INT32_C(1713869842), -INT32_C( 334136514), -INT32_C(1344079465), -INT32_C(1881357114),
+        -INT32_C(  79073202),  INT32_C( 367226493), -INT32_C(1162475628),  INT32_C(2103798322) },
+      INT32_C(2103798322) },
+    { { -INT32_C( 980966556),  INT32_C( 555849675),  INT32_C( 189830457),  INT32_C( 216110254),
+         INT32_C( 786233975),  INT32_C(1568877977),  INT32_C( 931522507), -INT32_C(1351217226),
+         INT32_C(1607081749), -INT32_C(1038330530),  INT32_C(1663416091), -INT32_C(1889652902),
+        -INT32_C( 790163450),  INT32_C(1149317615),  INT32_C(1020406882),  INT32_C( 271772878) },
+      INT32_C(1663416091) },
+    { {  INT32_C( 477094752),  INT32_C( 773450696), -INT32_C( 496050799),  INT32_C(1755410269),
+         INT32_C(2100563350),  INT32_C(1443738262),  INT32_C(1276706115), -INT32_C( 794355007),
+        -INT32_C( 806417317),  INT32_C(1421976741), -INT32_C(1078209558), -INT32_C( 258532020),
+         INT32_C(  88118759), -INT32_C( 233365343),  INT32_C( 428389131),  INT32_C( 288421988) },
+      INT32_C(2100563350) },
+    { { -INT32_C(1396533819),  INT32_C(1808851283),  INT32_C(1457662202), -INT32_C(1774140088),
+        -INT32_C( 644976785), -INT32_C(1027844079), -INT32_C( 116692893), -INT32_C( 262570880),
+        -INT32_C(2063143498),  INT32_C(1422026789),  INT32_C(1137823419), -INT32_C( 892686860),
+         INT32_C( 174936841), -INT32_C(1461328090),  INT32_C( 712352738),  INT32_C(2133551479) },
+      INT32_C(2133551479) },
+    { { -INT32_C(1298264087),  INT32_C( 267474791),  INT32_C( 910815472), -INT32_C(1474996902),
+        -INT32_C(1105105575),  INT32_C(1539225531), -INT32_C( 736563496), -INT32_C(1606329878),
+        -INT32_C(1907830054),  INT32_C(1248256188),  INT32_C(1800982639), -INT32_C( 297774070),
+        -INT32_C(1493945045),  INT32_C( 547235993), -INT32_C( 166095481),  INT32_C(  64186599) },
+      INT32_C(1800982639) },
+    { { -INT32_C(2081074607),  INT32_C(1071134681),  INT32_C( 863286065), -INT32_C( 479372588),
+         INT32_C( 870749614), -INT32_C(1786854123),  INT32_C( 466466493),  INT32_C(1538063202),
+        -INT32_C(1390842113),  INT32_C(1067111313), -INT32_C(1618005595),  INT32_C(1111632735),
+        -INT32_C(2049973446), -INT32_C(1312580883),  INT32_C( 454833846), -INT32_C(1357717130) },
+      INT32_C(1538063202) },
+    { { -INT32_C(2132487482),  INT32_C(1198122022), -INT32_C( 783253008),  INT32_C(1468754626),
+        -INT32_C(1759990191), -INT32_C( 316250070), -INT32_C( 523435734),  INT32_C( 610118929),
+        -INT32_C( 962779434),  INT32_C(1509317747),  INT32_C(1906995811),  INT32_C( 460746719),
+         INT32_C(1536590256),  INT32_C(1991421786),  INT32_C(1449915066), -INT32_C(1532663896) },
+      INT32_C(1991421786) },
+    { { -INT32_C(1290568057), -INT32_C( 879836613),  INT32_C( 837811495), -INT32_C(  35394974),
+        -INT32_C(1453115202), -INT32_C( 813135772), -INT32_C(1574996958), -INT32_C( 353957078),
+        -INT32_C(1642782099), -INT32_C(1939877855),  INT32_C(1293990019), -INT32_C(2083784505),
+         INT32_C( 542933434), -INT32_C(1327320242),  INT32_C(  60406643), -INT32_C( 997392184) },
+      INT32_C(1293990019) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_max_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { { UINT32_C(4039894604), UINT32_C(2078660586), UINT32_C(3863020258), UINT32_C(1194172071),
+        UINT32_C( 204274099), UINT32_C(3865612127), UINT32_C(2987819472), UINT32_C( 844719510),
+        UINT32_C(  83759797), UINT32_C(1991993063), UINT32_C(1505975563), UINT32_C(1817062241),
+        UINT32_C(  21138173), UINT32_C(3052276701), UINT32_C(1703236442), UINT32_C( 345975957) },
+      UINT32_C(4039894604) },
+    { { UINT32_C(3602425102), UINT32_C(2209266075), UINT32_C(2876209947), UINT32_C( 484659108),
+        UINT32_C(4269135985), UINT32_C( 231062152), UINT32_C(1769667254), UINT32_C(1367507453),
+        UINT32_C(1322660164), UINT32_C(2427196543), UINT32_C( 315041107), UINT32_C(1015313471),
+        UINT32_C(1427316550), UINT32_C( 383559032), UINT32_C( 182198713), UINT32_C(2751860959) },
+      UINT32_C(4269135985) },
+    { { UINT32_C( 937072011), UINT32_C(2539514968), UINT32_C(2965020871), UINT32_C( 860490896),
+        UINT32_C(1085785239), UINT32_C( 369404976), UINT32_C(1333202686), UINT32_C(2664684553),
+        UINT32_C(3484402737), UINT32_C(2908122853), UINT32_C(2075975822), UINT32_C(2999400730),
+        UINT32_C(1639616786), UINT32_C(1326655123), UINT32_C( 134107154), UINT32_C( 862092362) },
+      UINT32_C(3484402737) },
+    { { UINT32_C( 387909647), UINT32_C(1016121638), UINT32_C( 899646952), UINT32_C(1031039012),
+        UINT32_C(    539091), UINT32_C(3984768016), UINT32_C(  98036969), UINT32_C(2914618488),
+        UINT32_C( 957024014), UINT32_C(1139939356), UINT32_C(3667146907), UINT32_C(3459075356),
+        UINT32_C(3374481641), UINT32_C(1888487720), UINT32_C(2156392336), UINT32_C( 170819053) },
+      UINT32_C(3984768016) },
+    { { UINT32_C(1140287849), UINT32_C( 317230143), UINT32_C(3633932921), UINT32_C(1822166395),
+        UINT32_C(3864378132), UINT32_C(2944026942), UINT32_C( 240902815), UINT32_C(1295747939),
+        UINT32_C(3393607399), UINT32_C(2596862744), UINT32_C(3312754470), UINT32_C( 305600434),
+        UINT32_C(3764497406), UINT32_C(1119557557), UINT32_C(2199070517), UINT32_C(3357211353) },
+      UINT32_C(3864378132) },
+    { { UINT32_C(3220297728), UINT32_C( 968862719), UINT32_C( 328474573), UINT32_C(2973654790),
+        UINT32_C(3276836213), UINT32_C(3351384059), UINT32_C( 939739050), UINT32_C(2488629170),
+        UINT32_C(1153349165), UINT32_C(1481981793), UINT32_C(3409545385), UINT32_C(3557080723),
+        UINT32_C( 739217735), UINT32_C(1822688305), UINT32_C(  81057757), UINT32_C(3637783226) },
+      UINT32_C(3637783226) },
+    { { UINT32_C(1813351173), UINT32_C(2200077459), UINT32_C(1198909433), UINT32_C(1390027079),
+        UINT32_C(2354780094), UINT32_C(1348681339), UINT32_C(1334380003), UINT32_C(1573954554),
+        UINT32_C(3535856328), UINT32_C(1831035831), UINT32_C( 692782149), UINT32_C(3877351559),
+        UINT32_C(3357699789), UINT32_C( 531425867), UINT32_C(2946310325), UINT32_C(2317908916) },
+      UINT32_C(3877351559) },
+    { { UINT32_C(3787340901), UINT32_C(3373200660), UINT32_C(3865923379), UINT32_C(3320238923),
+        UINT32_C( 866759118), UINT32_C( 628492219), UINT32_C( 185684480), UINT32_C(2786512465),
+        UINT32_C(3240361677), UINT32_C(1082273729), UINT32_C(2607792208), UINT32_C(2855357387),
+        UINT32_C( 695093972), UINT32_C(2795619234), UINT32_C(3280162340), UINT32_C( 565531581) },
+      UINT32_C(3865923379) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_reduce_max_epu32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(2502811462159626105), -INT64_C(5307118700853816143), -INT64_C(2186823550724023767),  INT64_C(5000664611230506748),
+         INT64_C(3720952015683918571), -INT64_C(5448386698414459691),  INT64_C(4904104229832056655),  INT64_C(3202124872021347452) },
+      INT64_C(5000664611230506748) },
+    { { -INT64_C(1268224231432340963),  INT64_C(6665528484056265406), -INT64_C( 746262752424291671), -INT64_C(7798095849726192327),
+         INT64_C(4213071666748444405),  INT64_C(3427293331649768428), -INT64_C(4479081711025776782), -INT64_C(8286577668836951750) },
+      INT64_C(6665528484056265406) },
+    { {  INT64_C(7294315684715265877), -INT64_C(2348179832338643940),  INT64_C(7100297885190107775),  INT64_C(5132202881111772093),
+         INT64_C(1633429333242752020), -INT64_C(1809476228324793253), -INT64_C( 175865358855298535), -INT64_C(4090291102620686022) },
+      INT64_C(7294315684715265877) },
+    { { -INT64_C(8611998484869389495),  INT64_C(2520531926721944534),  INT64_C(2165699357824481908),  INT64_C(7293000186879636943),
+         INT64_C(4061548603390981879), -INT64_C(8462245786075179209), -INT64_C(6260664474142598566),  INT64_C(3922795772795723594) },
+      INT64_C(7293000186879636943) },
+    { {  INT64_C(7347578026030745981),  INT64_C( 822674245338404776), -INT64_C(6535311395726101055),  INT64_C(1850342320583701170),
+         INT64_C( 480186183551647905),  INT64_C(5168780917159916931), -INT64_C(5717820007101956984), -INT64_C(5556995199238258689) },
+      INT64_C(7347578026030745981) },
+    { { -INT64_C(7361026591337243264),  INT64_C(8759837740570423520), -INT64_C(3326315666433414419),  INT64_C(  41487295712229692),
+        -INT64_C(7639450948729793122),  INT64_C(6847122231634960046), -INT64_C(4465966679702381297), -INT64_C(2217993316785620942) },
+      INT64_C(8759837740570423520) },
+    { { -INT64_C(2397130343435375609),  INT64_C(3302370865041176699),  INT64_C(7156733634326609368), -INT64_C(7817942729704707027),
+        -INT64_C(5595262583301512625),  INT64_C(2394575872175444939), -INT64_C(1035822461133977727), -INT64_C(4130639941298981819) },
+      INT64_C(7156733634326609368) },
+    { {  INT64_C(3486665961615598136),  INT64_C(2883348800096664000), -INT64_C(4044579455196688501), -INT64_C(4274223795667960457),
+         INT64_C(2382910523441147899),  INT64_C(3122017543136992269), -INT64_C(3889014556615623319), -INT64_C(1713327591234509640) },
+      INT64_C(3486665961615598136) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_max_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { { UINT64_C( 4515360521776851200), UINT64_C( 9044769578878394037), UINT64_C(15585606986980402321), UINT64_C( 4390528715189580116),
+        UINT64_C(14934539362404720231), UINT64_C( 8234913677957491064), UINT64_C(13046114876396029896), UINT64_C( 5199600696675214603) },
+      UINT64_C(15585606986980402321) },
+    { { UINT64_C(11489838515877680376), UINT64_C( 7259091515245754068), UINT64_C( 1090728020487786905), UINT64_C(13008628072555101550),
+        UINT64_C( 1167799738267118058), UINT64_C(14981621586021401025), UINT64_C(14782520126693352258), UINT64_C( 9847953147084705429) },
+      UINT64_C(14981621586021401025) },
+    { { UINT64_C(11157842590762394601), UINT64_C(10262035811767846214), UINT64_C( 5559273099258760731), UINT64_C( 2044553872121390822),
+        UINT64_C( 3495020084577356262), UINT64_C( 3993292182776719111), UINT64_C( 9259255935285502175), UINT64_C( 4131210664017150510) },
+      UINT64_C(11157842590762394601) },
+    { { UINT64_C(12169309643631216032), UINT64_C(12254907693833241616), UINT64_C( 3632137968172667758), UINT64_C(11697122720253519399),
+        UINT64_C( 1141726595121251745), UINT64_C( 9443141001995026571), UINT64_C( 3482317429089200062), UINT64_C( 7042413603100028895) },
+      UINT64_C(12254907693833241616) },
+    { { UINT64_C( 9588256275954864738), UINT64_C(12010088516446941219), UINT64_C( 9258453986542152111), UINT64_C(11526833197812567152),
+        UINT64_C(12915926902540768886), UINT64_C( 7473814741320231170), UINT64_C(14264521109198333033), UINT64_C(16077897900275051495) },
+      UINT64_C(16077897900275051495) },
+    { { UINT64_C(13039768551237052883), UINT64_C( 5484221306499872158), UINT64_C(15573822647607765012), UINT64_C(15235256158775274250),
+        UINT64_C( 2427806982286996246), UINT64_C( 1522323725782112117), UINT64_C(10018333830549559064), UINT64_C( 7468661855067005097) },
+      UINT64_C(15573822647607765012) },
+    { { UINT64_C(15936532526347701037), UINT64_C( 1984383434352444200), UINT64_C( 9024730268042096411), UINT64_C(16716006476939420396),
+        UINT64_C(10006575345841062172), UINT64_C(13869790078542697400), UINT64_C( 2876507772213449336), UINT64_C( 1777491619497154260) },
+      UINT64_C(16716006476939420396) },
+    { { UINT64_C( 3475113435385086805), UINT64_C( 9381946895935449900), UINT64_C( 2047887829080953388), UINT64_C( 4491654846861076268),
+        UINT64_C( 3469690622650278614), UINT64_C( 2387516429523730521), UINT64_C( 3185907041011049243), UINT64_C(11817633719101889620) },
+      UINT64_C(11817633719101889620) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_reduce_max_epu64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   323.54), SIMDE_FLOAT32_C(  -156.63), SIMDE_FLOAT32_C(  -121.28), SIMDE_FLOAT32_C(   327.46),
+        SIMDE_FLOAT32_C(   514.34), SIMDE_FLOAT32_C(   766.58), SIMDE_FLOAT32_C(   828.00), SIMDE_FLOAT32_C(   698.02),
+        SIMDE_FLOAT32_C(   842.33), SIMDE_FLOAT32_C(  -786.34), SIMDE_FLOAT32_C(   879.68), SIMDE_FLOAT32_C(   449.95),
+        SIMDE_FLOAT32_C(  -465.11), SIMDE_FLOAT32_C(  -390.44), SIMDE_FLOAT32_C(   551.39), SIMDE_FLOAT32_C(    54.45) },
+      SIMDE_FLOAT32_C(   879.68) },
+    { { SIMDE_FLOAT32_C(  -761.80), SIMDE_FLOAT32_C(   864.26), SIMDE_FLOAT32_C(  -262.64), SIMDE_FLOAT32_C(  -564.88),
+        SIMDE_FLOAT32_C(   175.91), SIMDE_FLOAT32_C(  -891.17), SIMDE_FLOAT32_C(  -922.86), SIMDE_FLOAT32_C(  -605.07),
+        SIMDE_FLOAT32_C(   298.48), SIMDE_FLOAT32_C(   170.69), SIMDE_FLOAT32_C(  -555.96), SIMDE_FLOAT32_C(   263.33),
+        SIMDE_FLOAT32_C(  -517.57), SIMDE_FLOAT32_C(  -415.70), SIMDE_FLOAT32_C(  -250.29), SIMDE_FLOAT32_C(   185.82) },
+      SIMDE_FLOAT32_C(   864.26) },
+    { { SIMDE_FLOAT32_C(   -68.70), SIMDE_FLOAT32_C(  -847.11), SIMDE_FLOAT32_C(   233.81), SIMDE_FLOAT32_C(  -924.50),
+        SIMDE_FLOAT32_C(   838.40), SIMDE_FLOAT32_C(   232.45), SIMDE_FLOAT32_C(   407.50), SIMDE_FLOAT32_C(   -96.17),
+        SIMDE_FLOAT32_C(    67.58), SIMDE_FLOAT32_C(   117.51), SIMDE_FLOAT32_C(  -790.05), SIMDE_FLOAT32_C(   766.63),
+        SIMDE_FLOAT32_C(  -764.57), SIMDE_FLOAT32_C(   792.48), SIMDE_FLOAT32_C(  -935.78), SIMDE_FLOAT32_C(   287.11) },
+      SIMDE_FLOAT32_C(   838.40) },
+    { { SIMDE_FLOAT32_C(  -688.64), SIMDE_FLOAT32_C(  -365.11), SIMDE_FLOAT32_C(    -0.28), SIMDE_FLOAT32_C(  -842.85),
+        SIMDE_FLOAT32_C(  -959.30), SIMDE_FLOAT32_C(  -375.75), SIMDE_FLOAT32_C(   274.96), SIMDE_FLOAT32_C(   -99.44),
+        SIMDE_FLOAT32_C(   899.66), SIMDE_FLOAT32_C(   -36.13), SIMDE_FLOAT32_C(  -415.74), SIMDE_FLOAT32_C(   824.28),
+        SIMDE_FLOAT32_C(   281.07), SIMDE_FLOAT32_C(  -471.67), SIMDE_FLOAT32_C(   106.99), SIMDE_FLOAT32_C(    -3.94) },
+      SIMDE_FLOAT32_C(   899.66) },
+    { { SIMDE_FLOAT32_C(   528.83), SIMDE_FLOAT32_C(   -75.12), SIMDE_FLOAT32_C(   744.32), SIMDE_FLOAT32_C(  -393.42),
+        SIMDE_FLOAT32_C(    -4.23), SIMDE_FLOAT32_C(  -298.49), SIMDE_FLOAT32_C(   403.57), SIMDE_FLOAT32_C(   175.49),
+        SIMDE_FLOAT32_C(  -899.85), SIMDE_FLOAT32_C(    87.05), SIMDE_FLOAT32_C(  -478.87), SIMDE_FLOAT32_C(  -895.27),
+        SIMDE_FLOAT32_C(   831.67), SIMDE_FLOAT32_C(  -220.57), SIMDE_FLOAT32_C(  -977.63), SIMDE_FLOAT32_C(   351.93) },
+      SIMDE_FLOAT32_C(   831.67) },
+    { { SIMDE_FLOAT32_C(  -600.19), SIMDE_FLOAT32_C(  -926.94), SIMDE_FLOAT32_C(  -858.44), SIMDE_FLOAT32_C(   990.27),
+        SIMDE_FLOAT32_C(   708.22), SIMDE_FLOAT32_C(   960.06), SIMDE_FLOAT32_C(  -312.57), SIMDE_FLOAT32_C(  -517.69),
+        SIMDE_FLOAT32_C(    86.60), SIMDE_FLOAT32_C(   354.67), SIMDE_FLOAT32_C(  -470.76), SIMDE_FLOAT32_C(   914.14),
+        SIMDE_FLOAT32_C(   239.71), SIMDE_FLOAT32_C(  -603.21), SIMDE_FLOAT32_C(   116.46), SIMDE_FLOAT32_C(  -193.21) },
+      SIMDE_FLOAT32_C(   990.27) },
+    { { SIMDE_FLOAT32_C(  -676.52), SIMDE_FLOAT32_C(    38.10), SIMDE_FLOAT32_C(  -223.69), SIMDE_FLOAT32_C(   657.46),
+        SIMDE_FLOAT32_C(  -343.69), SIMDE_FLOAT32_C(   194.76), SIMDE_FLOAT32_C(   113.81), SIMDE_FLOAT32_C(   809.36),
+        SIMDE_FLOAT32_C(  -450.39), SIMDE_FLOAT32_C(  -757.98), SIMDE_FLOAT32_C(   648.40), SIMDE_FLOAT32_C(   421.89),
+        SIMDE_FLOAT32_C(  -926.86), SIMDE_FLOAT32_C(   -68.05), SIMDE_FLOAT32_C(   395.45), SIMDE_FLOAT32_C(   581.85) },
+      SIMDE_FLOAT32_C(   809.36) },
+    { { SIMDE_FLOAT32_C(  -836.40), SIMDE_FLOAT32_C(   655.98), SIMDE_FLOAT32_C(  -263.40), SIMDE_FLOAT32_C(  -468.18),
+        SIMDE_FLOAT32_C(  -601.54), SIMDE_FLOAT32_C(   263.73), SIMDE_FLOAT32_C(   225.32), SIMDE_FLOAT32_C(  -328.27),
+        SIMDE_FLOAT32_C(  -802.07), SIMDE_FLOAT32_C(   374.08), SIMDE_FLOAT32_C(   248.57), SIMDE_FLOAT32_C(   731.58),
+        SIMDE_FLOAT32_C(   184.86), SIMDE_FLOAT32_C(   622.16), SIMDE_FLOAT32_C(  -703.84), SIMDE_FLOAT32_C(  -665.06) },
+      SIMDE_FLOAT32_C(   731.58) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_max_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   323.29), SIMDE_FLOAT64_C(  -219.61), SIMDE_FLOAT64_C(  -230.12), SIMDE_FLOAT64_C(  -858.90),
+        SIMDE_FLOAT64_C(  -275.57), SIMDE_FLOAT64_C(   928.37), SIMDE_FLOAT64_C(  -143.99), SIMDE_FLOAT64_C(  -698.78) },
+      SIMDE_FLOAT64_C(   928.37) },
+    { { SIMDE_FLOAT64_C(  -625.53), SIMDE_FLOAT64_C(   815.02), SIMDE_FLOAT64_C(   573.60), SIMDE_FLOAT64_C(   131.71),
+        SIMDE_FLOAT64_C(   123.48), SIMDE_FLOAT64_C(  -109.14), SIMDE_FLOAT64_C(   545.91), SIMDE_FLOAT64_C(    -0.85) },
+      SIMDE_FLOAT64_C(   815.02) },
+    { { SIMDE_FLOAT64_C(  -878.58), SIMDE_FLOAT64_C(   281.54), SIMDE_FLOAT64_C(  -965.42), SIMDE_FLOAT64_C(   835.65),
+        SIMDE_FLOAT64_C(    65.78), SIMDE_FLOAT64_C(  -861.98), SIMDE_FLOAT64_C(  -536.45), SIMDE_FLOAT64_C(    97.54) },
+      SIMDE_FLOAT64_C(   835.65) },
+    { { SIMDE_FLOAT64_C(   763.05), SIMDE_FLOAT64_C(   631.14), SIMDE_FLOAT64_C(  -546.88), SIMDE_FLOAT64_C(   462.50),
+        SIMDE_FLOAT64_C(   730.54), SIMDE_FLOAT64_C(   305.64), SIMDE_FLOAT64_C(   801.90), SIMDE_FLOAT64_C(   673.25) },
+      SIMDE_FLOAT64_C(   801.90) },
+    { { SIMDE_FLOAT64_C(   238.52), SIMDE_FLOAT64_C(  -845.91), SIMDE_FLOAT64_C(    20.98), SIMDE_FLOAT64_C(   402.44),
+        SIMDE_FLOAT64_C(  -432.78), SIMDE_FLOAT64_C(  -635.27), SIMDE_FLOAT64_C(   759.94), SIMDE_FLOAT64_C(  -516.09) },
+      SIMDE_FLOAT64_C(   759.94) },
+    { { SIMDE_FLOAT64_C(   464.64), SIMDE_FLOAT64_C(   -86.49), SIMDE_FLOAT64_C(   764.64), SIMDE_FLOAT64_C(  -404.40),
+        SIMDE_FLOAT64_C(   111.54), SIMDE_FLOAT64_C(  -520.73), SIMDE_FLOAT64_C(  -456.73), SIMDE_FLOAT64_C(   259.37) },
+      SIMDE_FLOAT64_C(   764.64) },
+    { { SIMDE_FLOAT64_C(   938.79), SIMDE_FLOAT64_C(   428.10), SIMDE_FLOAT64_C(  -427.49), SIMDE_FLOAT64_C(  -253.98),
+        SIMDE_FLOAT64_C(  -759.12), SIMDE_FLOAT64_C(   491.55), SIMDE_FLOAT64_C(  -495.28), SIMDE_FLOAT64_C(   435.16) },
+      SIMDE_FLOAT64_C(   938.79) },
+    { { SIMDE_FLOAT64_C(   901.86), SIMDE_FLOAT64_C(   710.33), SIMDE_FLOAT64_C(  -463.31), SIMDE_FLOAT64_C(   596.46),
+        SIMDE_FLOAT64_C(   779.95), SIMDE_FLOAT64_C(   215.29), SIMDE_FLOAT64_C(   264.96), SIMDE_FLOAT64_C(  -424.95) },
+      SIMDE_FLOAT64_C(   901.86) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_max_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C( 725356664),  INT32_C( 142756748),  INT32_C(2100596636),  INT32_C(1290006042),
+        -INT32_C( 815752684), -INT32_C(  39471539), -INT32_C(1347987863),  INT32_C(1437638435),
+        -INT32_C(2064437517),  INT32_C(1605563724),  INT32_C(1452309990),  INT32_C( 329870416),
+         INT32_C( 465999042), -INT32_C( 238592532), -INT32_C(1702714511), -INT32_C(  80783340) },
+      -INT32_C(2064437517) },
+    { {  INT32_C(2016683306),  INT32_C(1049647790), -INT32_C( 643964625),  INT32_C(1544616511),
+        -INT32_C(1299141680),  INT32_C( 768063159), -INT32_C(1170889104),  INT32_C(1492431714),
+        -INT32_C( 864881288),  INT32_C(1282324483),  INT32_C(2055759103),  INT32_C( 505768062),
+         INT32_C(1437999760),  INT32_C(2096735959), -INT32_C(1428341984), -INT32_C(  98070899) },
+      -INT32_C(1428341984) },
+    { { -INT32_C(  88400841),  INT32_C(1124984044), -INT32_C(1669192927), -INT32_C( 756282322),
+         INT32_C(1806991131),  INT32_C(1682393287), -INT32_C(1121432135),  INT32_C(1024195248),
+         INT32_C(1069916063), -INT32_C( 436662338), -INT32_C(  48912907),  INT32_C( 404685445),
+        -INT32_C(1583290528),  INT32_C(1519271790),  INT32_C(1543810859),  INT32_C(1921519557) },
+      -INT32_C(1669192927) },
+    { { -INT32_C(2086399210),  INT32_C(1131763194),  INT32_C( 882440800),  INT32_C(1772174024),
+         INT32_C( 484403457),  INT32_C(1893018372), -INT32_C(1833406249), -INT32_C(1947345736),
+        -INT32_C( 443655128), -INT32_C(1219867901),  INT32_C( 728670350),  INT32_C(1729161772),
+         INT32_C( 889671619), -INT32_C(1186841396), -INT32_C(2068243175), -INT32_C(1365945701) },
+      -INT32_C(2086399210) },
+    { {  INT32_C(1159040511), -INT32_C(1329999043),  INT32_C(1725381348),  INT32_C( 511514153),
+        -INT32_C(2023477730), -INT32_C(1145828003),  INT32_C( 677241702),  INT32_C(1105672318),
+        -INT32_C(1117618307), -INT32_C(2142211228), -INT32_C( 348812851),  INT32_C( 296343657),
+        -INT32_C( 272479687), -INT32_C( 398187312), -INT32_C(1164531520), -INT32_C( 534421213) },
+      -INT32_C(2142211228) },
+    { { -INT32_C( 326825152),  INT32_C(1747133678),  INT32_C( 271179540),  INT32_C(1168067878),
+         INT32_C(1108944088), -INT32_C(1116585382), -INT32_C( 323393642), -INT32_C(  90143938),
+         INT32_C(1840142850), -INT32_C(1496861619), -INT32_C( 894789855), -INT32_C( 631509267),
+         INT32_C(1979173861),  INT32_C(  84456932),  INT32_C(1886380355), -INT32_C(1476526781) },
+      -INT32_C(1496861619) },
+    { { -INT32_C(1745561893),  INT32_C( 822615769),  INT32_C(1286647825), -INT32_C(1060523193),
+         INT32_C(1205149907),  INT32_C( 309299620),  INT32_C(1276997591),  INT32_C( 157170905),
+         INT32_C(1860036633),  INT32_C(2105114391), -INT32_C(1977040932), -INT32_C(1992876915),
+        -INT32_C(1262824858),  INT32_C(1393285103), -INT32_C(1368115820), -INT32_C(2020450455) },
+      -INT32_C(2020450455) },
+    { { -INT32_C( 351197998), -INT32_C( 442207062),  INT32_C(  94302742), -INT32_C(1243524894),
+         INT32_C(2023778909),  INT32_C(1688894233), -INT32_C(1402466880), -INT32_C(  37490927),
+        -INT32_C(1498576922),  INT32_C(1716312525),  INT32_C( 518860357), -INT32_C( 500861451),
+         INT32_C( 823463135), -INT32_C(1368384790), -INT32_C(1240317989), -INT32_C( 666227917) },
+      -INT32_C(1498576922) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_min_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { { UINT32_C(1091993349), UINT32_C(2007902286), UINT32_C( 443058595), UINT32_C(2178259480),
+        UINT32_C(1474935327), UINT32_C(1381342944), UINT32_C(3552391271), UINT32_C(1892719257),
+        UINT32_C(3270793356), UINT32_C(2190209242), UINT32_C(1858129778), UINT32_C(1075127115),
+        UINT32_C(1015276997), UINT32_C( 158306550), UINT32_C(2634108878), UINT32_C(3616810077) },
+      UINT32_C( 158306550) },
+    { { UINT32_C( 596342201), UINT32_C(3763455160), UINT32_C(3442221235), UINT32_C( 930688832),
+        UINT32_C(1479879813), UINT32_C(2922782815), UINT32_C(3937661654), UINT32_C(2983690657),
+        UINT32_C(1995680108), UINT32_C(2499366229), UINT32_C( 367291448), UINT32_C( 521593030),
+        UINT32_C(3684561788), UINT32_C(1173543669), UINT32_C( 874083972), UINT32_C(1278839253) },
+      UINT32_C( 367291448) },
+    { { UINT32_C( 609551411), UINT32_C(2062035205), UINT32_C(2226059749), UINT32_C(4235940107),
+        UINT32_C(1405611566), UINT32_C(2420697988), UINT32_C(2026805885), UINT32_C(1963911832),
+        UINT32_C(2153046616), UINT32_C(2795693334), UINT32_C(3116424301), UINT32_C(1232270148),
+        UINT32_C(4178023445), UINT32_C( 673776190), UINT32_C(3209374539), UINT32_C(2302450720) },
+      UINT32_C( 609551411) },
+    { { UINT32_C(3752210851), UINT32_C( 412202772), UINT32_C(2280698993), UINT32_C(2371432631),
+        UINT32_C(1464574270), UINT32_C(4239732092), UINT32_C( 633770855), UINT32_C(3083935122),
+        UINT32_C( 877346381), UINT32_C(3464799642), UINT32_C( 306283457), UINT32_C( 406845058),
+        UINT32_C(1406678669), UINT32_C(3953487545), UINT32_C(1049607812), UINT32_C( 479576086) },
+      UINT32_C( 306283457) },
+    { { UINT32_C(2337504601), UINT32_C(3768674321), UINT32_C(1258218839), UINT32_C(1379823045),
+        UINT32_C(3429475578), UINT32_C(2387562567), UINT32_C(1491529291), UINT32_C( 992095971),
+        UINT32_C(2334402192), UINT32_C(4190180161), UINT32_C(2196482537), UINT32_C(3896110976),
+        UINT32_C(2498036572), UINT32_C(3227694124), UINT32_C( 463254618), UINT32_C(3566053292) },
+      UINT32_C( 463254618) },
+    { { UINT32_C( 304849076), UINT32_C( 748814395), UINT32_C( 819303858), UINT32_C(3564505018),
+        UINT32_C( 970000847), UINT32_C(1411451865), UINT32_C(3952891225), UINT32_C(3824767209),
+        UINT32_C( 692054733), UINT32_C(3532476162), UINT32_C( 783431797), UINT32_C(2105764521),
+        UINT32_C(2184861559), UINT32_C(1415145542), UINT32_C(3400219822), UINT32_C(2479794475) },
+      UINT32_C( 304849076) },
+    { { UINT32_C(1906764826), UINT32_C(3916619403), UINT32_C(3052584239), UINT32_C( 276340616),
+        UINT32_C(4246996014), UINT32_C(3456700481), UINT32_C( 642355331), UINT32_C(1565260026),
+        UINT32_C(2096101144), UINT32_C(3973436782), UINT32_C(3369707737), UINT32_C(3543423486),
+        UINT32_C(1280098954), UINT32_C(2169039140), UINT32_C(1800748644), UINT32_C(2641711276) },
+      UINT32_C( 276340616) },
+    { { UINT32_C( 137336919), UINT32_C(2687645099), UINT32_C(2176762197), UINT32_C(  37325088),
+        UINT32_C(3335996379), UINT32_C(3810173452), UINT32_C(4168314221), UINT32_C(1172642578),
+        UINT32_C(3741285005), UINT32_C(3219902320), UINT32_C(2318141941), UINT32_C(2609971133),
+        UINT32_C(4088962428), UINT32_C(2483688939), UINT32_C(2402173398), UINT32_C(  29521467) },
+      UINT32_C(  29521467) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_reduce_min_epu32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(2229569768593572043), -INT64_C(6902815245051368751), -INT64_C(3688721411497947204), -INT64_C(2915148824385278743),
+         INT64_C(2024395398865994213), -INT64_C( 431171707569953453),  INT64_C(3339256313151881765), -INT64_C(2745626451760301244) },
+      -INT64_C(6902815245051368751) },
+    { {  INT64_C(6852564557788971623), -INT64_C(1899680116943551428),  INT64_C( 236868299639966802), -INT64_C(8929199283886810424),
+        -INT64_C( 421436332862623208),  INT64_C(6769140925556645606),  INT64_C(5046229248730284183), -INT64_C(2961775124914143733) },
+      -INT64_C(8929199283886810424) },
+    { {  INT64_C(4556493660390597823), -INT64_C(8027629514682374838),  INT64_C(2498440766348184588),  INT64_C(3403057003375879661),
+        -INT64_C(8631484568777029331),  INT64_C(8214945521936863776), -INT64_C(2729177700033862887), -INT64_C(7079816149756765431) },
+      -INT64_C(8631484568777029331) },
+    { { -INT64_C(4761925218889985132), -INT64_C(8788129905882713381),  INT64_C(8993818245647384850), -INT64_C(3935786262259510197),
+        -INT64_C(4824983012670101051), -INT64_C(3488607226183078516),  INT64_C(7565717126694075361),  INT64_C(2888744680950850502) },
+      -INT64_C(8788129905882713381) },
+    { { -INT64_C( 475859480343930053), -INT64_C(5239034394128061640),  INT64_C(7937153498422853223), -INT64_C(2113997747050051149),
+         INT64_C(  66975131866912671), -INT64_C(3202353089663881815), -INT64_C(2523916373927621635), -INT64_C(6744084144611333105) },
+      -INT64_C(6744084144611333105) },
+    { {  INT64_C(4653380964583041060), -INT64_C(2890672371977565643),  INT64_C( 822901069885838274),  INT64_C(1908523610751703387),
+         INT64_C(1135905007267718485), -INT64_C(8594617126778197743), -INT64_C(5426173069880651519), -INT64_C(7542157365247277379) },
+      -INT64_C(8594617126778197743) },
+    { {  INT64_C( 934123196777622078),  INT64_C( 516290317610758540),  INT64_C(2490214815555786587),  INT64_C(   8344395147764225),
+        -INT64_C(1337664433624981842), -INT64_C(8009559156807368156),  INT64_C(6991437371514476165), -INT64_C(8360802558156523128) },
+      -INT64_C(8360802558156523128) },
+    { { -INT64_C(2553293992029942243), -INT64_C(3033365574902006671), -INT64_C(3431963490159558103),  INT64_C(7770406250717465748),
+        -INT64_C(5819205575341608273),  INT64_C(5088028179330448295),  INT64_C(3743682045156212474), -INT64_C(8435081447997094781) },
+      -INT64_C(8435081447997094781) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_min_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { { UINT64_C( 8807312887504498033), UINT64_C( 7171817930608975207), UINT64_C( 4360668815195397303), UINT64_C(16910626218110782468),
+        UINT64_C(10636758874472746636), UINT64_C( 8954711214043631191), UINT64_C(12026242636992505891), UINT64_C( 3266267496526903550) },
+      UINT64_C( 3266267496526903550) },
+    { { UINT64_C(14205943206145154001), UINT64_C(  396534779647341865), UINT64_C( 3244627059274357465), UINT64_C(12079349091670185005),
+        UINT64_C(11576096425790851384), UINT64_C( 3019482755015735645), UINT64_C(15869323880880200766), UINT64_C( 3234116157317629535) },
+      UINT64_C(  396534779647341865) },
+    { { UINT64_C(14845479548885494017), UINT64_C( 8423775341075169486), UINT64_C( 7002735848987361604), UINT64_C(  858168820177599348),
+        UINT64_C(10747942826886499194), UINT64_C( 1060555492999562617), UINT64_C(11419052011604606413), UINT64_C( 4871981668163456823) },
+      UINT64_C(  858168820177599348) },
+    { { UINT64_C( 5036911634222834908), UINT64_C( 7599401502170095165), UINT64_C(12233427694638406077), UINT64_C( 5174598067765193599),
+        UINT64_C(15507546396303198137), UINT64_C(14151569092741596194), UINT64_C( 2961024681815356353), UINT64_C( 9945037294155807358) },
+      UINT64_C( 2961024681815356353) },
+    { { UINT64_C( 1413011284574814847), UINT64_C(12147255122569296585), UINT64_C(10434512287042380838), UINT64_C( 2272855729745714952),
+        UINT64_C( 5656402511164681108), UINT64_C( 8315724615343571866), UINT64_C(17596967027079611866), UINT64_C( 6130005075427194718) },
+      UINT64_C( 1413011284574814847) },
+    { { UINT64_C( 3058951192608962450), UINT64_C( 2710986141111550509), UINT64_C( 2403992366882294173), UINT64_C(11695582243172614106),
+        UINT64_C( 4249090080212704560), UINT64_C(18443230862043314704), UINT64_C( 6742451728225451950), UINT64_C(15885398738636410061) },
+      UINT64_C( 2403992366882294173) },
+    { { UINT64_C(17133054669559251060), UINT64_C( 1437102705038369769), UINT64_C( 7048026618276873952), UINT64_C(16538555741931349737),
+        UINT64_C( 4666435018084345049), UINT64_C(18093387710924921481), UINT64_C(17635717685685780542), UINT64_C( 3135785381007004542) },
+      UINT64_C( 1437102705038369769) },
+    { { UINT64_C(17667879958241484249), UINT64_C( 6278942434905780637), UINT64_C(  791349423385168373), UINT64_C(11032180213518800537),
+        UINT64_C( 4749759271210147245), UINT64_C(16285557260150291574), UINT64_C(10118258069106386216), UINT64_C( 7971113182011118270) },
+      UINT64_C(  791349423385168373) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_reduce_min_epu64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   463.86), SIMDE_FLOAT32_C(   833.59), SIMDE_FLOAT32_C(  -753.45), SIMDE_FLOAT32_C(  -338.81),
+        SIMDE_FLOAT32_C(   759.56), SIMDE_FLOAT32_C(  -713.22), SIMDE_FLOAT32_C(  -515.56), SIMDE_FLOAT32_C(   573.35),
+        SIMDE_FLOAT32_C(  -566.95), SIMDE_FLOAT32_C(   225.62), SIMDE_FLOAT32_C(   955.11), SIMDE_FLOAT32_C(  -945.24),
+        SIMDE_FLOAT32_C(   947.73), SIMDE_FLOAT32_C(  -504.58), SIMDE_FLOAT32_C(  -335.41), SIMDE_FLOAT32_C(   313.22) },
+      SIMDE_FLOAT32_C(  -945.24) },
+    { { SIMDE_FLOAT32_C(  -289.31), SIMDE_FLOAT32_C(  -397.93), SIMDE_FLOAT32_C(   921.22), SIMDE_FLOAT32_C(   707.90),
+        SIMDE_FLOAT32_C(   788.76), SIMDE_FLOAT32_C(  -410.38), SIMDE_FLOAT32_C(  -560.68), SIMDE_FLOAT32_C(  -351.74),
+        SIMDE_FLOAT32_C(  -285.10), SIMDE_FLOAT32_C(  -779.23), SIMDE_FLOAT32_C(  -436.32), SIMDE_FLOAT32_C(  -431.33),
+        SIMDE_FLOAT32_C(  -466.19), SIMDE_FLOAT32_C(   821.54), SIMDE_FLOAT32_C(  -432.92), SIMDE_FLOAT32_C(   386.07) },
+      SIMDE_FLOAT32_C(  -779.23) },
+    { { SIMDE_FLOAT32_C(  -829.00), SIMDE_FLOAT32_C(  -725.70), SIMDE_FLOAT32_C(   966.48), SIMDE_FLOAT32_C(  -117.53),
+        SIMDE_FLOAT32_C(  -398.94), SIMDE_FLOAT32_C(   -97.70), SIMDE_FLOAT32_C(  -981.62), SIMDE_FLOAT32_C(   645.79),
+        SIMDE_FLOAT32_C(  -335.29), SIMDE_FLOAT32_C(   796.06), SIMDE_FLOAT32_C(  -746.09), SIMDE_FLOAT32_C(   371.42),
+        SIMDE_FLOAT32_C(   211.57), SIMDE_FLOAT32_C(   603.12), SIMDE_FLOAT32_C(   490.71), SIMDE_FLOAT32_C(  -238.22) },
+      SIMDE_FLOAT32_C(  -981.62) },
+    { { SIMDE_FLOAT32_C(   458.45), SIMDE_FLOAT32_C(  -594.83), SIMDE_FLOAT32_C(   352.46), SIMDE_FLOAT32_C(  -875.66),
+        SIMDE_FLOAT32_C(   620.00), SIMDE_FLOAT32_C(  -311.36), SIMDE_FLOAT32_C(   895.56), SIMDE_FLOAT32_C(   717.76),
+        SIMDE_FLOAT32_C(  -627.59), SIMDE_FLOAT32_C(  -522.22), SIMDE_FLOAT32_C(     7.79), SIMDE_FLOAT32_C(   158.98),
+        SIMDE_FLOAT32_C(   195.39), SIMDE_FLOAT32_C(   688.38), SIMDE_FLOAT32_C(  -704.87), SIMDE_FLOAT32_C(  -820.49) },
+      SIMDE_FLOAT32_C(  -875.66) },
+    { { SIMDE_FLOAT32_C(  -537.38), SIMDE_FLOAT32_C(  -958.12), SIMDE_FLOAT32_C(  -119.11), SIMDE_FLOAT32_C(  -838.68),
+        SIMDE_FLOAT32_C(   913.57), SIMDE_FLOAT32_C(   592.24), SIMDE_FLOAT32_C(  -840.79), SIMDE_FLOAT32_C(  -942.79),
+        SIMDE_FLOAT32_C(  -294.75), SIMDE_FLOAT32_C(  -117.61), SIMDE_FLOAT32_C(   610.78), SIMDE_FLOAT32_C(   214.24),
+        SIMDE_FLOAT32_C(  -813.02), SIMDE_FLOAT32_C(   -58.95), SIMDE_FLOAT32_C(  -166.42), SIMDE_FLOAT32_C(  -872.41) },
+      SIMDE_FLOAT32_C(  -958.12) },
+    { { SIMDE_FLOAT32_C(  -779.59), SIMDE_FLOAT32_C(   328.60), SIMDE_FLOAT32_C(  -457.18), SIMDE_FLOAT32_C(   725.74),
+        SIMDE_FLOAT32_C(  -795.09), SIMDE_FLOAT32_C(  -221.65), SIMDE_FLOAT32_C(    37.37), SIMDE_FLOAT32_C(  -721.66),
+        SIMDE_FLOAT32_C(   523.40), SIMDE_FLOAT32_C(   728.84), SIMDE_FLOAT32_C(  -151.96), SIMDE_FLOAT32_C(    74.38),
+        SIMDE_FLOAT32_C(   -22.30), SIMDE_FLOAT32_C(    71.61), SIMDE_FLOAT32_C(  -864.64), SIMDE_FLOAT32_C(   905.87) },
+      SIMDE_FLOAT32_C(  -864.64) },
+    { { SIMDE_FLOAT32_C(   952.98), SIMDE_FLOAT32_C(  -951.13), SIMDE_FLOAT32_C(   463.36), SIMDE_FLOAT32_C(   297.92),
+        SIMDE_FLOAT32_C(  -377.92), SIMDE_FLOAT32_C(  -906.80), SIMDE_FLOAT32_C(  -750.59), SIMDE_FLOAT32_C(  -153.47),
+        SIMDE_FLOAT32_C(   486.89), SIMDE_FLOAT32_C(   382.12), SIMDE_FLOAT32_C(   439.07), SIMDE_FLOAT32_C(   221.31),
+        SIMDE_FLOAT32_C(   321.84), SIMDE_FLOAT32_C(   747.84), SIMDE_FLOAT32_C(  -446.25), SIMDE_FLOAT32_C(  -841.46) },
+      SIMDE_FLOAT32_C(  -951.13) },
+    { { SIMDE_FLOAT32_C(    76.02), SIMDE_FLOAT32_C(   611.70), SIMDE_FLOAT32_C(   763.39), SIMDE_FLOAT32_C(   409.14),
+        SIMDE_FLOAT32_C(  -560.10), SIMDE_FLOAT32_C(   362.17), SIMDE_FLOAT32_C(  -813.52), SIMDE_FLOAT32_C(   231.51),
+        SIMDE_FLOAT32_C(   255.91), SIMDE_FLOAT32_C(  -772.49), SIMDE_FLOAT32_C(  -567.89), SIMDE_FLOAT32_C(   -82.76),
+        SIMDE_FLOAT32_C(  -517.45), SIMDE_FLOAT32_C(   789.91), SIMDE_FLOAT32_C(  -977.59), SIMDE_FLOAT32_C(    55.89) },
+      SIMDE_FLOAT32_C(  -977.59) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_min_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   616.51), SIMDE_FLOAT64_C(   260.00), SIMDE_FLOAT64_C(  -697.24), SIMDE_FLOAT64_C(  -103.86),
+        SIMDE_FLOAT64_C(    68.14), SIMDE_FLOAT64_C(   781.27), SIMDE_FLOAT64_C(   -37.03), SIMDE_FLOAT64_C(  -329.47) },
+      SIMDE_FLOAT64_C(  -697.24) },
+    { { SIMDE_FLOAT64_C(  -937.69), SIMDE_FLOAT64_C(   384.37), SIMDE_FLOAT64_C(  -243.11), SIMDE_FLOAT64_C(  -357.09),
+        SIMDE_FLOAT64_C(   211.29), SIMDE_FLOAT64_C(  -367.05), SIMDE_FLOAT64_C(  -146.02), SIMDE_FLOAT64_C(  -681.07) },
+      SIMDE_FLOAT64_C(  -937.69) },
+    { { SIMDE_FLOAT64_C(  -390.34), SIMDE_FLOAT64_C(  -788.68), SIMDE_FLOAT64_C(  -817.68), SIMDE_FLOAT64_C(   146.85),
+        SIMDE_FLOAT64_C(  -222.88), SIMDE_FLOAT64_C(  -123.37), SIMDE_FLOAT64_C(   587.35), SIMDE_FLOAT64_C(  -829.12) },
+      SIMDE_FLOAT64_C(  -829.12) },
+    { { SIMDE_FLOAT64_C(  -169.79), SIMDE_FLOAT64_C(  -704.06), SIMDE_FLOAT64_C(   -77.01), SIMDE_FLOAT64_C(  -447.15),
+        SIMDE_FLOAT64_C(  -165.88), SIMDE_FLOAT64_C(  -890.93), SIMDE_FLOAT64_C(   162.70), SIMDE_FLOAT64_C(  -634.05) },
+      SIMDE_FLOAT64_C(  -890.93) },
+    { { SIMDE_FLOAT64_C(  -893.99), SIMDE_FLOAT64_C(   702.48), SIMDE_FLOAT64_C(  -356.99), SIMDE_FLOAT64_C(  -440.27),
+        SIMDE_FLOAT64_C(   947.31), SIMDE_FLOAT64_C(   196.59), SIMDE_FLOAT64_C(   -49.67), SIMDE_FLOAT64_C(     1.94) },
+      SIMDE_FLOAT64_C(  -893.99) },
+    { { SIMDE_FLOAT64_C(  -414.52), SIMDE_FLOAT64_C(  -633.91), SIMDE_FLOAT64_C(   679.81), SIMDE_FLOAT64_C(  -512.67),
+        SIMDE_FLOAT64_C(  -107.48), SIMDE_FLOAT64_C(  -748.11), SIMDE_FLOAT64_C(   255.14), SIMDE_FLOAT64_C(   613.19) },
+      SIMDE_FLOAT64_C(  -748.11) },
+    { { SIMDE_FLOAT64_C(   225.23), SIMDE_FLOAT64_C(  -784.80), SIMDE_FLOAT64_C(  -426.82), SIMDE_FLOAT64_C(   -62.39),
+        SIMDE_FLOAT64_C(  -671.26), SIMDE_FLOAT64_C(  -518.17), SIMDE_FLOAT64_C(  -621.63), SIMDE_FLOAT64_C(  -588.74) },
+      SIMDE_FLOAT64_C(  -784.80) },
+    { { SIMDE_FLOAT64_C(  -835.72), SIMDE_FLOAT64_C(   -43.19), SIMDE_FLOAT64_C(  -290.42), SIMDE_FLOAT64_C(  -345.91),
+        SIMDE_FLOAT64_C(   510.40), SIMDE_FLOAT64_C(  -253.25), SIMDE_FLOAT64_C(   511.16), SIMDE_FLOAT64_C(  -885.47) },
+      SIMDE_FLOAT64_C(  -885.47) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_min_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_and_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C( 277882364), -INT32_C( 735026799),  INT32_C( 956656304),  INT32_C( 697854676),
+        -INT32_C( 456218953), -INT32_C(2135185677), -INT32_C( 498458680),  INT32_C( 592547706),
+        -INT32_C( 175314612), -INT32_C( 878891344),  INT32_C(  59363171),  INT32_C(1956044115),
+        -INT32_C(1072740836),  INT32_C(1865037611),  INT32_C(  78178866), -INT32_C( 562598323) },
+      INT32_C(         0) },
+    { { -INT32_C(1929957940), -INT32_C( 153997290),  INT32_C( 860545737),  INT32_C( 674596534),
+         INT32_C( 989706722), -INT32_C( 541595794), -INT32_C(2147336329), -INT32_C(  29213934),
+         INT32_C(1709985007),  INT32_C(   3323238), -INT32_C( 954666240),  INT32_C( 472945553),
+        -INT32_C(1032017139),  INT32_C(1471149099), -INT32_C(1829830654), -INT32_C(1441438100) },
+      INT32_C(         0) },
+    { { -INT32_C(1950425682), -INT32_C(  84210430),  INT32_C(1994671645),  INT32_C( 842622157),
+        -INT32_C( 953547684),  INT32_C( 862816660),  INT32_C( 187637615),  INT32_C(  33248641),
+         INT32_C(1006058418),  INT32_C( 565160883), -INT32_C(1367615841),  INT32_C( 599117515),
+        -INT32_C( 155873222), -INT32_C(1915382016),  INT32_C(1785403130), -INT32_C(1693800830) },
+      INT32_C(         0) },
+    { {  INT32_C( 871450737),  INT32_C( 190223606), -INT32_C(1152308380), -INT32_C(1208281665),
+        -INT32_C( 447290384), -INT32_C(1321902839), -INT32_C(  56363156),  INT32_C(2097078681),
+        -INT32_C(1325602133),  INT32_C( 809314417),  INT32_C( 672142184),  INT32_C( 957243137),
+        -INT32_C(1842564198), -INT32_C( 221537380),  INT32_C( 767747559),  INT32_C( 381572529) },
+      INT32_C(         0) },
+    { { -INT32_C( 481995481), -INT32_C(1382602339), -INT32_C(1978607974),  INT32_C( 448051052),
+         INT32_C(2100039243), -INT32_C(1933982061),  INT32_C( 180408792),  INT32_C(1628935816),
+         INT32_C( 596972303),  INT32_C(1676366281),  INT32_C(1338241059), -INT32_C( 367063032),
+         INT32_C( 855254563), -INT32_C( 374903902), -INT32_C( 936969038), -INT32_C( 479709631) },
+      INT32_C(         0) },
+    { { -INT32_C( 638093767),  INT32_C(1175843580),  INT32_C(1472757392), -INT32_C(2129801970),
+        -INT32_C( 106401741),  INT32_C(1938460101), -INT32_C( 459050285), -INT32_C( 745615147),
+         INT32_C( 929042409),  INT32_C(1681052801), -INT32_C(1253296511), -INT32_C( 241616107),
+         INT32_C( 994719079), -INT32_C(1326139568),  INT32_C( 142964262), -INT32_C( 644011121) },
+      INT32_C(         0) },
+    { { -INT32_C(1038915779), -INT32_C(1923938231),  INT32_C(1647767957), -INT32_C(1320781251),
+        -INT32_C(1028640609), -INT32_C(2092523831),  INT32_C( 768432137),  INT32_C( 228412993),
+         INT32_C(1431731795),  INT32_C(1130213272), -INT32_C(1166901869), -INT32_C( 273221082),
+        -INT32_C(  52562403),  INT32_C(1300505962), -INT32_C(1344549384),  INT32_C( 493883147) },
+      INT32_C(         0) },
+    { {  INT32_C(1311163510),  INT32_C(1571615555),  INT32_C(2123384818),  INT32_C( 797633111),
+         INT32_C(1535148098), -INT32_C(1515897708), -INT32_C( 516513914), -INT32_C(1942806142),
+         INT32_C(1424476560),  INT32_C(1574052583), -INT32_C( 396237299), -INT32_C(1450846724),
+        -INT32_C( 634884739),  INT32_C(1785752717), -INT32_C( 369447454), -INT32_C( 723990076) },
+      INT32_C(         0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_and_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_and_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(6935762010149101689),  INT64_C( 744474588010140815), -INT64_C(9022046628416560340),  INT64_C(8117907397510376716),
+        -INT64_C(4814609566761585045),  INT64_C(5385785787857968500),  INT64_C(5750675845405525122),  INT64_C(1583518707346509832) },
+      INT64_C(                  0) },
+    { { -INT64_C(5326678300517895730),  INT64_C(3440358908059472736),  INT64_C(  14144636241539565),  INT64_C(3674663408962234324),
+         INT64_C(8815487527582477446),  INT64_C(3418039719336290542),  INT64_C(2697018517355330942), -INT64_C(4278846317703789656) },
+      INT64_C(                  0) },
+    { {  INT64_C(3017297402310188377),  INT64_C(4603735150164042192),  INT64_C(8965465708158874136),  INT64_C(4491276083506873729),
+        -INT64_C( 758439699995977557), -INT64_C(9209318424945657243), -INT64_C(2586468279029497894),  INT64_C(3484934463685260176) },
+      INT64_C(                  0) },
+    { { -INT64_C(2423328086442138305),  INT64_C(3169260049535222168),  INT64_C( 387581868547172019),  INT64_C(1967291907137629488),
+        -INT64_C(2863768477123370268), -INT64_C(7360077170936672444), -INT64_C(5459093886009285511),  INT64_C(2821726275570389685) },
+      INT64_C(                  0) },
+    { {  INT64_C(5081584900249155385),  INT64_C( 316385621483580395),  INT64_C(7456619774082077611),  INT64_C(5449529289392310030),
+         INT64_C(7173512399437983148), -INT64_C(6620603209873627725),  INT64_C(6394493094577561933), -INT64_C(6485872493964831182) },
+      INT64_C(              16384) },
+    { { -INT64_C(9187444511524279910), -INT64_C(7253300941842158253), -INT64_C(6537737985905099441),  INT64_C(4981287069067250155),
+        -INT64_C(4903109867056877831),  INT64_C(6190151243389782323), -INT64_C(4312575418526141882),  INT64_C(2228189430476685619) },
+      INT64_C(                  0) },
+    { {  INT64_C(4316813595439994247), -INT64_C( 428699996415751845),  INT64_C(7322022383447254743),  INT64_C(7933778855032129093),
+         INT64_C(2382836435787531736), -INT64_C(9120076536766784012),  INT64_C(3985170132594241273), -INT64_C(2592974861787297321) },
+      INT64_C(        68719476736) },
+    { {  INT64_C(5737211326132381571), -INT64_C(3261569524253897258),  INT64_C(8090705072554524479), -INT64_C(4328590427401288816),
+         INT64_C(4055780956194754388),  INT64_C(7795346679466256714), -INT64_C(8716142529530195644),  INT64_C(1777057256965499011) },
+      INT64_C(                  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_and_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_or_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C(1282297695), -INT32_C(1413384515),  INT32_C(1808006374),  INT32_C(2129837770),
+         INT32_C(1746129723),  INT32_C( 325497056), -INT32_C(1010197852), -INT32_C(1181151558),
+        -INT32_C(1873031336), -INT32_C( 274758033), -INT32_C(1058229760), -INT32_C( 274426471),
+        -INT32_C( 542104554),  INT32_C(1036301450), -INT32_C( 514805888),  INT32_C( 756188821) },
+      -INT32_C(         1) },
+    { { -INT32_C(2057133124),  INT32_C( 592105297),  INT32_C( 717040519),  INT32_C(1704376884),
+        -INT32_C( 816019973), -INT32_C(2114797977), -INT32_C(1318072971),  INT32_C(1590613540),
+        -INT32_C( 833940756), -INT32_C(1351023018),  INT32_C( 876049866), -INT32_C(2069227836),
+        -INT32_C(1367003876),  INT32_C(1518448060),  INT32_C(1128649257), -INT32_C( 316100831) },
+      -INT32_C(         1) },
+    { {  INT32_C( 929802013), -INT32_C( 932815542), -INT32_C( 339927075),  INT32_C(1014803406),
+        -INT32_C( 330715100),  INT32_C(1133167314), -INT32_C(1821546133),  INT32_C( 464123131),
+         INT32_C( 753257577), -INT32_C( 477198062), -INT32_C(2088089590), -INT32_C( 390089058),
+        -INT32_C(1221584215), -INT32_C( 800822039), -INT32_C(1055278817), -INT32_C( 571169164) },
+      -INT32_C(         1) },
+    { {  INT32_C( 123078733),  INT32_C(  18492476),  INT32_C(1341571783),  INT32_C(2082138353),
+        -INT32_C( 167663512),  INT32_C( 197221325),  INT32_C( 653858732), -INT32_C(2045921047),
+         INT32_C(1232138419),  INT32_C(1997780084),  INT32_C(2066237012), -INT32_C(2119232147),
+        -INT32_C(1836218639), -INT32_C( 185635202), -INT32_C( 636676073),  INT32_C( 797968698) },
+      -INT32_C(         1) },
+    { {  INT32_C( 245681592),  INT32_C(1955790247),  INT32_C( 855566182),  INT32_C( 201434261),
+         INT32_C( 490236151),  INT32_C(1665834171), -INT32_C(  72663176), -INT32_C(1935183203),
+        -INT32_C( 796150861),  INT32_C(1689368533), -INT32_C(1120084437),  INT32_C( 975988032),
+         INT32_C( 418637654),  INT32_C(1276540755),  INT32_C(2080387635),  INT32_C(1894349335) },
+      -INT32_C(         1) },
+    { { -INT32_C( 779152126),  INT32_C( 706600477), -INT32_C(2035284156), -INT32_C( 871849665),
+         INT32_C(1100483106), -INT32_C( 248600327),  INT32_C( 326081662),  INT32_C( 540810559),
+         INT32_C(1244148743), -INT32_C( 984058247), -INT32_C(1848138869), -INT32_C( 847858593),
+        -INT32_C(2136236952), -INT32_C(1249329582), -INT32_C(1366705730),  INT32_C( 358538218) },
+      -INT32_C(         1) },
+    { {  INT32_C( 683076138),  INT32_C(1739088345),  INT32_C(1741840439), -INT32_C(1845977650),
+        -INT32_C( 822975020), -INT32_C(2101315000), -INT32_C( 475210886), -INT32_C(1258721160),
+         INT32_C( 219119532), -INT32_C(1998605872), -INT32_C( 511158861), -INT32_C( 847227102),
+        -INT32_C(1706523861),  INT32_C( 354136735),  INT32_C(1361091391),  INT32_C( 775423684) },
+      -INT32_C(         1) },
+    { { -INT32_C(1845524732), -INT32_C(1843459760), -INT32_C( 274366262),  INT32_C(  42872663),
+        -INT32_C( 345536327),  INT32_C( 349423738), -INT32_C(1222968093),  INT32_C(1601170772),
+        -INT32_C(2044434054),  INT32_C( 917338891),  INT32_C(1009067461), -INT32_C( 575462297),
+        -INT32_C(2062694890), -INT32_C(1383072410),  INT32_C(1687183941),  INT32_C( 548926153) },
+      -INT32_C(         1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_or_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_or_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(5559434664996454984), -INT64_C(8567852510010753287), -INT64_C(7507536287078640702), -INT64_C(7385833716276387613),
+         INT64_C(8661818431126408068), -INT64_C(7472898631742483519),  INT64_C(8684407901939240335), -INT64_C(3876502930959824972) },
+      -INT64_C(              16385) },
+    { {  INT64_C(3813051085419731225), -INT64_C(5060620297969665555), -INT64_C(2104030877083264118),  INT64_C(1780192084855451411),
+         INT64_C(1161565350167924568),  INT64_C(9048610931633077360), -INT64_C(6885999428612994245), -INT64_C(7889361803604108459) },
+      -INT64_C(                  1) },
+    { {  INT64_C( 654546400538073959),  INT64_C(6232380842300957132),  INT64_C(6463938204935887358), -INT64_C(2745754412499698591),
+         INT64_C(1254962590133783332), -INT64_C(3653006859484170565),  INT64_C(9146622320948164156), -INT64_C(6703131274531476424) },
+      -INT64_C(                  1) },
+    { { -INT64_C(5083259993310916088),  INT64_C( 378334339173554702), -INT64_C(7451715286539715176),  INT64_C(4778538206197726214),
+         INT64_C( 380110208714071832), -INT64_C(5544190413783483744),  INT64_C(1992979280013757600),  INT64_C(9135183242742057831) },
+      -INT64_C(                  1) },
+    { {  INT64_C(1315486666029983116), -INT64_C(2343357808410952534),  INT64_C( 666774978536952855),  INT64_C(5483040198198361733),
+         INT64_C(6736680208366419144), -INT64_C(2072339071775920240),  INT64_C( 451342697467998156), -INT64_C(5960021881136340090) },
+      -INT64_C(  36028797018963969) },
+    { {  INT64_C(5484361734193071809),  INT64_C(3943569198925950452),  INT64_C( 703402552304804334),  INT64_C( 258295169559581334),
+         INT64_C(3776183079539323594),  INT64_C(3763771092723921625), -INT64_C(7031329673925410876),  INT64_C(3452811620337509429) },
+      -INT64_C(                  1) },
+    { { -INT64_C(1349330148211304557),  INT64_C(8951980560196046809),  INT64_C(8960795398215484112), -INT64_C(8857247964626979800),
+        -INT64_C(2010789142921298316),  INT64_C(2894088530201495530),  INT64_C(8010070534671741439), -INT64_C(2300278138224722508) },
+      -INT64_C(  36028797018963969) },
+    { { -INT64_C(9134516364331745450), -INT64_C(4646055061441436962), -INT64_C(5149799923333324983),  INT64_C(8587475413979813730),
+        -INT64_C(6089351897975641181),  INT64_C(6391227296673050514), -INT64_C(8160969048004627184),  INT64_C(  76335837426265439) },
+      -INT64_C(                  1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_or_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(42527),
+      {  INT32_C( 866628355),  INT32_C( 473860355), -INT32_C(1610551009), -INT32_C(1321795051),
+        -INT32_C( 157869805),  INT32_C(1914162045),  INT32_C(1007294590),  INT32_C(1728523365),
+        -INT32_C(1882552412), -INT32_C( 428519660),  INT32_C( 266769707),  INT32_C(  37015206),
+        -INT32_C(1513660790), -INT32_C( 137226738), -INT32_C( 241293736), -INT32_C( 286514439) },
+      INT32_C(1959749011) },
+    { UINT16_C(36563),
+      {  INT32_C(1751849974),  INT32_C(1332497030), -INT32_C(2015863758),  INT32_C(1165437917),
+        -INT32_C( 921245776),  INT32_C( 450543622),  INT32_C(1437253609), -INT32_C( 280632859),
+         INT32_C(1056724176), -INT32_C( 488212240),  INT32_C( 363538417),  INT32_C(2111770587),
+        -INT32_C(1851985249),  INT32_C(1607665395), -INT32_C( 115687891), -INT32_C( 848756795) },
+      INT32_C( 163094651) },
+    { UINT16_C(35793),
+      {  INT32_C( 127184281), -INT32_C( 346779629),  INT32_C(1399215364), -INT32_C( 823580153),
+         INT32_C(  27858399), -INT32_C(1089819245),  INT32_C(1117271498), -INT32_C(1557538759),
+        -INT32_C( 180767408),  INT32_C(1997911168),  INT32_C(1332722557),  INT32_C( 265844769),
+         INT32_C( 947111470), -INT32_C(1422846436), -INT32_C(1610870056), -INT32_C( 937385228) },
+      INT32_C( 860378720) },
+    { UINT16_C(45678),
+      {  INT32_C(1183556597), -INT32_C(1725146559), -INT32_C(1371515030),  INT32_C(1650995417),
+        -INT32_C(1284723887),  INT32_C(1673238974),  INT32_C( 786878477),  INT32_C( 459548869),
+         INT32_C( 744017841), -INT32_C( 405263827), -INT32_C( 985061878),  INT32_C( 326426401),
+        -INT32_C(1942056420),  INT32_C( 600867820),  INT32_C(  70797005), -INT32_C( 617402586) },
+      -INT32_C(1349403734) },
+    { UINT16_C(47979),
+      {  INT32_C( 215797256),  INT32_C( 282111173), -INT32_C(1263462259),  INT32_C(1358557282),
+        -INT32_C(  81216398),  INT32_C(1077521201), -INT32_C(1814509585),  INT32_C(1791755101),
+        -INT32_C(1910790897), -INT32_C( 291291601),  INT32_C( 415299979), -INT32_C(1346593459),
+        -INT32_C(1487629615),  INT32_C(1465028077), -INT32_C( 720454494), -INT32_C(1598977560) },
+      INT32_C( 244189568) },
+    { UINT16_C(10653),
+      {  INT32_C( 919277519), -INT32_C( 395988704), -INT32_C(1028104389), -INT32_C( 484745546),
+         INT32_C( 180651681), -INT32_C( 102416958),  INT32_C( 275024601),  INT32_C( 648223352),
+        -INT32_C( 768974650),  INT32_C(1306446068), -INT32_C( 644128318),  INT32_C(1964322601),
+         INT32_C(2100018909), -INT32_C(2138719842), -INT32_C(2097048996), -INT32_C( 992701212) },
+      -INT32_C( 708069274) },
+    { UINT16_C(48301),
+      { -INT32_C( 441630228),  INT32_C(1381944372),  INT32_C( 119413432), -INT32_C(1198991270),
+        -INT32_C(1244331452),  INT32_C(2124013166),  INT32_C(1844697566), -INT32_C( 777172771),
+         INT32_C( 974630978),  INT32_C(1109228176), -INT32_C(1206948318), -INT32_C( 654008606),
+         INT32_C(1243550563),  INT32_C( 879809570),  INT32_C(1702586821), -INT32_C( 754655736) },
+      -INT32_C( 666620198) },
+    { UINT16_C(44063),
+      { -INT32_C(1749721234), -INT32_C( 236058274), -INT32_C(2090489029), -INT32_C(1557343214),
+         INT32_C(1551270525),  INT32_C( 569825167), -INT32_C( 377976430), -INT32_C(1050103341),
+        -INT32_C(1325200956),  INT32_C( 815256196),  INT32_C( 735370811),  INT32_C( 671081431),
+         INT32_C( 162176275), -INT32_C(2142151307), -INT32_C( 814616855), -INT32_C(2125648830) },
+      INT32_C(1646245471) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_add_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  243),
+      { -INT64_C(8220588914797368659),  INT64_C( 405110661820202492),  INT64_C(4996191140466754114),  INT64_C(6525504390694721972),
+        -INT64_C(1603051823173083169), -INT64_C( 934523721269605152), -INT64_C(3638531476025055364),  INT64_C(1142234225608240915) },
+      INT64_C(5597393025872882679) },
+    { UINT8_C(   72),
+      {  INT64_C(5100260156776622653), -INT64_C(4707972507660941556),  INT64_C(8514547931303846047),  INT64_C(8843319836821069794),
+        -INT64_C(5445610307335172642), -INT64_C(8927118804401880129),  INT64_C(5567626409351795680), -INT64_C(5764833554548965185) },
+      -INT64_C(4035797827536686142) },
+    { UINT8_C(  126),
+      { -INT64_C(6155163124897669394), -INT64_C(6281159865356864107), -INT64_C(4028763098562929186), -INT64_C(1647155738982449037),
+        -INT64_C(4783663045575587422), -INT64_C(7893073817086063770), -INT64_C( 297396649621127400),  INT64_C(6693306756738896567) },
+      -INT64_C(6484468141475469306) },
+    { UINT8_C(   87),
+      {  INT64_C(4323130522231559348), -INT64_C(7801406983959414115), -INT64_C(3913864629590537236), -INT64_C(3066076788079056358),
+        -INT64_C(3205311043290445581), -INT64_C(2955304241037290057), -INT64_C(1678270694273044229), -INT64_C(6078045555118939611) },
+      INT64_C(6171021244827669803) },
+    { UINT8_C(  223),
+      {  INT64_C(1270714887377525970), -INT64_C(3044302295285481188), -INT64_C(4971179757584103258),  INT64_C(4036921980547967383),
+        -INT64_C(3985228841762535785), -INT64_C(2014069069033897140),  INT64_C( 132642958876342906), -INT64_C(3191438945837688123) },
+      INT64_C(8694874060041579521) },
+    { UINT8_C(   73),
+      {  INT64_C(5678107064160771945),  INT64_C(3366368740971394950),  INT64_C(5067710952634810021), -INT64_C(8375070044452959353),
+         INT64_C(4204965220250456768),  INT64_C( 212411266778626350),  INT64_C( 760716370744010000), -INT64_C(6338666225490600276) },
+      -INT64_C(1936246609548177408) },
+    { UINT8_C(   38),
+      {  INT64_C(3350032478115969975), -INT64_C(2805386008122464489),  INT64_C(8284620165842720053),  INT64_C(8290511111780989107),
+         INT64_C(9103450495975995901), -INT64_C(5038411439514400442),  INT64_C(7885353001021869525), -INT64_C(8620823337619676994) },
+      INT64_C( 440822718205855122) },
+    { UINT8_C(   56),
+      { -INT64_C(7499715806914301564), -INT64_C(7930105564668000990),  INT64_C(4426790565385032380), -INT64_C(3739761584970254107),
+        -INT64_C(8961750560950013089),  INT64_C( 400423213696917117),  INT64_C(8996726585228601791), -INT64_C(3621428652532877758) },
+      INT64_C(6145655141486201537) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_add_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(65273),
+      { SIMDE_FLOAT32_C(  -204.22), SIMDE_FLOAT32_C(    70.17), SIMDE_FLOAT32_C(   949.46), SIMDE_FLOAT32_C(   582.33),
+        SIMDE_FLOAT32_C(  -274.67), SIMDE_FLOAT32_C(   165.77), SIMDE_FLOAT32_C(   514.11), SIMDE_FLOAT32_C(  -448.40),
+        SIMDE_FLOAT32_C(  -659.31), SIMDE_FLOAT32_C(  -680.43), SIMDE_FLOAT32_C(   659.80), SIMDE_FLOAT32_C(    88.56),
+        SIMDE_FLOAT32_C(   865.39), SIMDE_FLOAT32_C(  -236.58), SIMDE_FLOAT32_C(   -96.25), SIMDE_FLOAT32_C(   681.10) },
+      SIMDE_FLOAT32_C(  1616.51) },
+    { UINT16_C(15118),
+      { SIMDE_FLOAT32_C(  -244.70), SIMDE_FLOAT32_C(   743.57), SIMDE_FLOAT32_C(  -175.94), SIMDE_FLOAT32_C(   552.47),
+        SIMDE_FLOAT32_C(  -393.06), SIMDE_FLOAT32_C(  -919.95), SIMDE_FLOAT32_C(  -911.68), SIMDE_FLOAT32_C(   818.23),
+        SIMDE_FLOAT32_C(  -161.17), SIMDE_FLOAT32_C(  -994.90), SIMDE_FLOAT32_C(   911.94), SIMDE_FLOAT32_C(  -827.51),
+        SIMDE_FLOAT32_C(  -691.19), SIMDE_FLOAT32_C(   785.86), SIMDE_FLOAT32_C(   946.49), SIMDE_FLOAT32_C(   915.60) },
+      SIMDE_FLOAT32_C(  -768.81) },
+    { UINT16_C(50130),
+      { SIMDE_FLOAT32_C(   440.95), SIMDE_FLOAT32_C(  -317.27), SIMDE_FLOAT32_C(   449.84), SIMDE_FLOAT32_C(   102.11),
+        SIMDE_FLOAT32_C(   291.11), SIMDE_FLOAT32_C(   673.53), SIMDE_FLOAT32_C(    10.43), SIMDE_FLOAT32_C(  -682.33),
+        SIMDE_FLOAT32_C(  -456.40), SIMDE_FLOAT32_C(   597.69), SIMDE_FLOAT32_C(    71.01), SIMDE_FLOAT32_C(  -376.48),
+        SIMDE_FLOAT32_C(  -740.35), SIMDE_FLOAT32_C(  -550.15), SIMDE_FLOAT32_C(  -939.20), SIMDE_FLOAT32_C(  -901.32) },
+      SIMDE_FLOAT32_C( -2397.29) },
+    { UINT16_C(35539),
+      { SIMDE_FLOAT32_C(   -21.33), SIMDE_FLOAT32_C(   176.86), SIMDE_FLOAT32_C(  -636.24), SIMDE_FLOAT32_C(  -694.99),
+        SIMDE_FLOAT32_C(  -726.16), SIMDE_FLOAT32_C(   919.31), SIMDE_FLOAT32_C(  -858.96), SIMDE_FLOAT32_C(   733.59),
+        SIMDE_FLOAT32_C(  -707.97), SIMDE_FLOAT32_C(  -564.03), SIMDE_FLOAT32_C(  -390.02), SIMDE_FLOAT32_C(  -786.76),
+        SIMDE_FLOAT32_C(   -58.76), SIMDE_FLOAT32_C(  -717.40), SIMDE_FLOAT32_C(  -374.82), SIMDE_FLOAT32_C(  -707.70) },
+      SIMDE_FLOAT32_C( -2754.49) },
+    { UINT16_C(39498),
+      { SIMDE_FLOAT32_C(   953.69), SIMDE_FLOAT32_C(   701.95), SIMDE_FLOAT32_C(   914.66), SIMDE_FLOAT32_C(  -959.82),
+        SIMDE_FLOAT32_C(   282.66), SIMDE_FLOAT32_C(   -64.92), SIMDE_FLOAT32_C(   749.72), SIMDE_FLOAT32_C(   755.06),
+        SIMDE_FLOAT32_C(  -410.21), SIMDE_FLOAT32_C(   701.84), SIMDE_FLOAT32_C(   319.37), SIMDE_FLOAT32_C(  -591.95),
+        SIMDE_FLOAT32_C(   171.49), SIMDE_FLOAT32_C(   -78.90), SIMDE_FLOAT32_C(   608.23), SIMDE_FLOAT32_C(   619.53) },
+      SIMDE_FLOAT32_C(  1392.76) },
+    { UINT16_C(45632),
+      { SIMDE_FLOAT32_C(   614.36), SIMDE_FLOAT32_C(  -483.68), SIMDE_FLOAT32_C(  -751.62), SIMDE_FLOAT32_C(   710.75),
+        SIMDE_FLOAT32_C(  -956.07), SIMDE_FLOAT32_C(   473.13), SIMDE_FLOAT32_C(  -337.34), SIMDE_FLOAT32_C(   804.45),
+        SIMDE_FLOAT32_C(  -436.21), SIMDE_FLOAT32_C(  -551.30), SIMDE_FLOAT32_C(  -406.75), SIMDE_FLOAT32_C(  -642.71),
+        SIMDE_FLOAT32_C(  -159.94), SIMDE_FLOAT32_C(  -314.01), SIMDE_FLOAT32_C(  -127.03), SIMDE_FLOAT32_C(   158.91) },
+      SIMDE_FLOAT32_C( -1203.68) },
+    { UINT16_C(25936),
+      { SIMDE_FLOAT32_C(  -507.47), SIMDE_FLOAT32_C(   797.10), SIMDE_FLOAT32_C(    65.04), SIMDE_FLOAT32_C(   -61.86),
+        SIMDE_FLOAT32_C(  -874.74), SIMDE_FLOAT32_C(   359.94), SIMDE_FLOAT32_C(  -886.91), SIMDE_FLOAT32_C(  -171.31),
+        SIMDE_FLOAT32_C(  -745.04), SIMDE_FLOAT32_C(   288.42), SIMDE_FLOAT32_C(   266.05), SIMDE_FLOAT32_C(  -307.97),
+        SIMDE_FLOAT32_C(   -87.12), SIMDE_FLOAT32_C(  -375.71), SIMDE_FLOAT32_C(  -246.38), SIMDE_FLOAT32_C(  -952.58) },
+      SIMDE_FLOAT32_C( -2862.73) },
+    { UINT16_C(50573),
+      { SIMDE_FLOAT32_C(   348.89), SIMDE_FLOAT32_C(  -923.62), SIMDE_FLOAT32_C(  -328.42), SIMDE_FLOAT32_C(  -628.08),
+        SIMDE_FLOAT32_C(   792.32), SIMDE_FLOAT32_C(  -760.53), SIMDE_FLOAT32_C(   311.85), SIMDE_FLOAT32_C(   142.81),
+        SIMDE_FLOAT32_C(   678.27), SIMDE_FLOAT32_C(  -381.15), SIMDE_FLOAT32_C(   969.08), SIMDE_FLOAT32_C(   876.89),
+        SIMDE_FLOAT32_C(  -142.55), SIMDE_FLOAT32_C(  -407.13), SIMDE_FLOAT32_C(   171.74), SIMDE_FLOAT32_C(   982.54) },
+      SIMDE_FLOAT32_C(  2336.83) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_add_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  227),
+      { SIMDE_FLOAT64_C( -1000.00), SIMDE_FLOAT64_C(   243.08), SIMDE_FLOAT64_C(   936.46), SIMDE_FLOAT64_C(   452.04),
+        SIMDE_FLOAT64_C(  -437.69), SIMDE_FLOAT64_C(   549.54), SIMDE_FLOAT64_C(  -438.45), SIMDE_FLOAT64_C(  -588.47) },
+      SIMDE_FLOAT64_C( -1234.30) },
+    { UINT8_C(   33),
+      { SIMDE_FLOAT64_C(  -500.57), SIMDE_FLOAT64_C(   554.03), SIMDE_FLOAT64_C(   225.81), SIMDE_FLOAT64_C(   -26.40),
+        SIMDE_FLOAT64_C(   259.46), SIMDE_FLOAT64_C(  -708.43), SIMDE_FLOAT64_C(  -555.25), SIMDE_FLOAT64_C(  -646.62) },
+      SIMDE_FLOAT64_C( -1209.00) },
+    { UINT8_C(  183),
+      { SIMDE_FLOAT64_C(  -325.80), SIMDE_FLOAT64_C(   277.33), SIMDE_FLOAT64_C(  -482.06), SIMDE_FLOAT64_C(  -204.13),
+        SIMDE_FLOAT64_C(   579.15), SIMDE_FLOAT64_C(  -444.93), SIMDE_FLOAT64_C(   924.04), SIMDE_FLOAT64_C(  -485.97) },
+      SIMDE_FLOAT64_C(  -882.28) },
+    { UINT8_C(   36),
+      { SIMDE_FLOAT64_C(  -386.13), SIMDE_FLOAT64_C(   438.82), SIMDE_FLOAT64_C(   910.41), SIMDE_FLOAT64_C(   334.98),
+        SIMDE_FLOAT64_C(  -766.43), SIMDE_FLOAT64_C(  -961.01), SIMDE_FLOAT64_C(  -296.05), SIMDE_FLOAT64_C(  -586.63) },
+      SIMDE_FLOAT64_C(   -50.60) },
+    { UINT8_C(  134),
+      { SIMDE_FLOAT64_C(  -335.16), SIMDE_FLOAT64_C(   842.96), SIMDE_FLOAT64_C(  -371.13), SIMDE_FLOAT64_C(   893.17),
+        SIMDE_FLOAT64_C(   784.56), SIMDE_FLOAT64_C(  -461.19), SIMDE_FLOAT64_C(   258.22), SIMDE_FLOAT64_C(  -501.20) },
+      SIMDE_FLOAT64_C(   -29.37) },
+    { UINT8_C(  111),
+      { SIMDE_FLOAT64_C(  -230.58), SIMDE_FLOAT64_C(   280.83), SIMDE_FLOAT64_C(  -658.62), SIMDE_FLOAT64_C(  -667.14),
+        SIMDE_FLOAT64_C(  -318.74), SIMDE_FLOAT64_C(  -764.15), SIMDE_FLOAT64_C(  -919.95), SIMDE_FLOAT64_C(   275.17) },
+      SIMDE_FLOAT64_C( -2959.61) },
+    { UINT8_C(  133),
+      { SIMDE_FLOAT64_C(    48.09), SIMDE_FLOAT64_C(  -727.22), SIMDE_FLOAT64_C(  -614.65), SIMDE_FLOAT64_C(   101.36),
+        SIMDE_FLOAT64_C(   950.89), SIMDE_FLOAT64_C(  -815.30), SIMDE_FLOAT64_C(  -219.65), SIMDE_FLOAT64_C(  -957.25) },
+      SIMDE_FLOAT64_C( -1523.81) },
+    { UINT8_C(  245),
+      { SIMDE_FLOAT64_C(   -96.99), SIMDE_FLOAT64_C(  -193.82), SIMDE_FLOAT64_C(   977.94), SIMDE_FLOAT64_C(   149.01),
+        SIMDE_FLOAT64_C(   342.56), SIMDE_FLOAT64_C(  -646.47), SIMDE_FLOAT64_C(   393.65), SIMDE_FLOAT64_C(  -571.32) },
+      SIMDE_FLOAT64_C(   399.37) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_add_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C( 6612),
+      {  INT32_C( 975077005), -INT32_C(1522134263),  INT32_C( 478524735), -INT32_C(1836149566),
+         INT32_C(1873099041), -INT32_C( 927399519), -INT32_C(1083786475), -INT32_C( 857262888),
+         INT32_C(1526067710), -INT32_C(1391091254),  INT32_C(1144178570),  INT32_C(1823337948),
+         INT32_C( 840289909), -INT32_C( 139114095),  INT32_C( 206793683), -INT32_C( 987956869) },
+      -INT32_C( 778581696) },
+    { UINT16_C(61823),
+      {  INT32_C(1153033513),  INT32_C( 259913918), -INT32_C( 320786619), -INT32_C( 345990166),
+         INT32_C( 467257972), -INT32_C( 180004878), -INT32_C(1635495785),  INT32_C( 502394603),
+        -INT32_C(1928987034),  INT32_C(1083373349),  INT32_C(1795781743),  INT32_C( 439246429),
+        -INT32_C(1936945852), -INT32_C( 954280953), -INT32_C(1604683823), -INT32_C(1055698329) },
+      INT32_C(1605969664) },
+    { UINT16_C(25403),
+      { -INT32_C(1422951625), -INT32_C(1261929180),  INT32_C( 501503550), -INT32_C(1101124530),
+         INT32_C( 286666734), -INT32_C(1887052871),  INT32_C( 980468975), -INT32_C(1225127300),
+         INT32_C( 754656841), -INT32_C(1221797760),  INT32_C(1271211296),  INT32_C(2082065139),
+         INT32_C(1487742141), -INT32_C( 248661914),  INT32_C( 338629122),  INT32_C(2013885849) },
+      -INT32_C( 157966336) },
+    { UINT16_C(57961),
+      {  INT32_C(1402455154), -INT32_C(1729113739),  INT32_C(1388405178),  INT32_C( 303111003),
+        -INT32_C( 704621924),  INT32_C(1122486363), -INT32_C( 319872044), -INT32_C(1434379084),
+        -INT32_C(1102915792), -INT32_C( 724148812),  INT32_C(1645855262), -INT32_C( 431095315),
+         INT32_C(1656168792),  INT32_C( 270752525),  INT32_C( 975907968),  INT32_C(1151740215) },
+      INT32_C(2071932928) },
+    { UINT16_C(48616),
+      { -INT32_C(1681239548), -INT32_C(1903353176),  INT32_C(1078821497), -INT32_C(    648682),
+         INT32_C(  94293649), -INT32_C( 163393329), -INT32_C( 725169332), -INT32_C( 743411916),
+         INT32_C(1661513934),  INT32_C( 338681808), -INT32_C(  54772777), -INT32_C(1581951848),
+         INT32_C( 621375216), -INT32_C(1060031288), -INT32_C(1649267070),  INT32_C(1105634833) },
+      -INT32_C(2021720064) },
+    { UINT16_C(17778),
+      { -INT32_C(1364698124), -INT32_C( 960717914),  INT32_C(1189742533), -INT32_C(1138887703),
+        -INT32_C(1882738851), -INT32_C( 106666622),  INT32_C( 277326925), -INT32_C(1250075629),
+         INT32_C(1324361052), -INT32_C( 684500483),  INT32_C(2117986439),  INT32_C( 430022594),
+         INT32_C( 229462785), -INT32_C(  49726862), -INT32_C( 295474666),  INT32_C( 617921598) },
+      INT32_C( 641778976) },
+    { UINT16_C(64870),
+      { -INT32_C(1524751787), -INT32_C(1831032328), -INT32_C(1465260762),  INT32_C( 599505288),
+         INT32_C(1568561256),  INT32_C( 193291727),  INT32_C( 195247472), -INT32_C(1797830724),
+         INT32_C( 593177271), -INT32_C(2101982477),  INT32_C( 761911874), -INT32_C(1347886091),
+         INT32_C(1852415129), -INT32_C( 692145424),  INT32_C( 513280043),  INT32_C(1279151041) },
+      INT32_C( 345137152) },
+    { UINT16_C(19790),
+      { -INT32_C(2123625994), -INT32_C(  65432461),  INT32_C(1167789785), -INT32_C( 437213351),
+        -INT32_C(1203195448),  INT32_C(1887573069), -INT32_C(1825177228), -INT32_C(1734409568),
+         INT32_C( 758725844), -INT32_C(1931571847), -INT32_C( 435546890),  INT32_C( 256417854),
+        -INT32_C(2085071960), -INT32_C(1970061300), -INT32_C(2029872523), -INT32_C(2124713555) },
+      INT32_C( 385769152) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_mul_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(   37),
+      { -INT64_C(2757802808114464664),  INT64_C(5639753409916174493),  INT64_C(7974769829095671448),  INT64_C(6581894366251044024),
+        -INT64_C(3882886710325080013), -INT64_C(3351645405688738957),  INT64_C(6755406616799507530), -INT64_C(2974674675828211572) },
+      INT64_C(2906845514254454080) },
+    { UINT8_C(  102),
+      { -INT64_C(8633503912208053174), -INT64_C(4339684414772386658), -INT64_C( 820358744338346081), -INT64_C(9085780874800271191),
+        -INT64_C(2881270169930289085), -INT64_C(5313108661452378242), -INT64_C(2287398187120510746), -INT64_C(2602626416702784877) },
+      -INT64_C(8447764717541008152) },
+    { UINT8_C(  142),
+      { -INT64_C(1998506239798356043), -INT64_C(1009416281485378186),  INT64_C(4936465384711492227), -INT64_C(8831953240366004099),
+         INT64_C(2077806193979579296),  INT64_C(4168464340789189569), -INT64_C( 245416818036767324),  INT64_C( 465850682849304746) },
+      -INT64_C(7956218622755035964) },
+    { UINT8_C(   41),
+      {  INT64_C(6219761611541899345), -INT64_C(7393739809249338595), -INT64_C(3359691620751355562), -INT64_C(7048068961777182561),
+        -INT64_C(6776911174130595809),  INT64_C(2045602446658826416),  INT64_C(7263062470574961732), -INT64_C(6557674542498653788) },
+      INT64_C(2107363471391303248) },
+    { UINT8_C(  205),
+      {  INT64_C(4562582095594134053), -INT64_C( 990240479747478872), -INT64_C(7651993032430092595), -INT64_C(2442417659879295564),
+         INT64_C(3549396625224444013),  INT64_C(8044820619240894105),  INT64_C(6283155955618863667),  INT64_C(7128046734419328681) },
+      -INT64_C(4113477962039241540) },
+    { UINT8_C(   48),
+      { -INT64_C(4341079687854599455), -INT64_C(9141098906264465924),  INT64_C(6553924694683684335),  INT64_C(3903124558791795701),
+         INT64_C(1054194922863156972),  INT64_C(5291345710908217148),  INT64_C(3063253236481209541), -INT64_C(1041609857538788273) },
+      -INT64_C(9157073650693213360) },
+    { UINT8_C(   56),
+      { -INT64_C(5820662543761609829),  INT64_C(3388568259470203282),  INT64_C(5124221343400574016), -INT64_C(2429247433670892827),
+        -INT64_C(1108115755726550125),  INT64_C( 914018924442346835), -INT64_C(6989951980380384108), -INT64_C(8640556122824700387) },
+      -INT64_C( 547521806089853907) },
+    { UINT8_C(  160),
+      { -INT64_C(1236270652429115907),  INT64_C(4050942809072255222),  INT64_C(7151904735179320890), -INT64_C(2175971484641600994),
+        -INT64_C(8066376977648399421), -INT64_C(1869414066488708502), -INT64_C(6818817928512063838),  INT64_C( 607046847232648919) },
+      INT64_C(7006386387715019526) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_mul_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(40445),
+      { SIMDE_FLOAT32_C(    -1.53), SIMDE_FLOAT32_C(     1.56), SIMDE_FLOAT32_C(     1.75), SIMDE_FLOAT32_C(    -1.31),
+        SIMDE_FLOAT32_C(     1.41), SIMDE_FLOAT32_C(     1.23), SIMDE_FLOAT32_C(    -1.57), SIMDE_FLOAT32_C(     1.34),
+        SIMDE_FLOAT32_C(     1.67), SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(     1.32), SIMDE_FLOAT32_C(    -1.26),
+        SIMDE_FLOAT32_C(    -0.66), SIMDE_FLOAT32_C(    -0.77), SIMDE_FLOAT32_C(     1.00), SIMDE_FLOAT32_C(    -0.60) },
+      SIMDE_FLOAT32_C(    14.08) },
+    { UINT16_C( 5438),
+      { SIMDE_FLOAT32_C(     0.82), SIMDE_FLOAT32_C(    -0.79), SIMDE_FLOAT32_C(    -1.14), SIMDE_FLOAT32_C(    -1.79),
+        SIMDE_FLOAT32_C(     1.24), SIMDE_FLOAT32_C(    -0.89), SIMDE_FLOAT32_C(    -1.20), SIMDE_FLOAT32_C(     1.39),
+        SIMDE_FLOAT32_C(    -1.44), SIMDE_FLOAT32_C(    -1.09), SIMDE_FLOAT32_C(     0.52), SIMDE_FLOAT32_C(     1.00),
+        SIMDE_FLOAT32_C(     0.93), SIMDE_FLOAT32_C(    -0.75), SIMDE_FLOAT32_C(    -0.61), SIMDE_FLOAT32_C(     1.56) },
+      SIMDE_FLOAT32_C(    -1.24) },
+    { UINT16_C(33807),
+      { SIMDE_FLOAT32_C(     0.94), SIMDE_FLOAT32_C(     0.61), SIMDE_FLOAT32_C(     0.99), SIMDE_FLOAT32_C(    -1.74),
+        SIMDE_FLOAT32_C(     1.55), SIMDE_FLOAT32_C(    -0.90), SIMDE_FLOAT32_C(    -0.88), SIMDE_FLOAT32_C(    -1.72),
+        SIMDE_FLOAT32_C(     1.64), SIMDE_FLOAT32_C(     1.28), SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(     0.78),
+        SIMDE_FLOAT32_C(    -0.76), SIMDE_FLOAT32_C(     1.80), SIMDE_FLOAT32_C(     1.07), SIMDE_FLOAT32_C(     0.55) },
+      SIMDE_FLOAT32_C(    -0.30) },
+    { UINT16_C(26831),
+      { SIMDE_FLOAT32_C(     0.57), SIMDE_FLOAT32_C(    -0.71), SIMDE_FLOAT32_C(    -0.71), SIMDE_FLOAT32_C(     1.68),
+        SIMDE_FLOAT32_C(     1.61), SIMDE_FLOAT32_C(     1.56), SIMDE_FLOAT32_C(    -1.67), SIMDE_FLOAT32_C(    -0.79),
+        SIMDE_FLOAT32_C(     1.20), SIMDE_FLOAT32_C(     0.65), SIMDE_FLOAT32_C(    -1.24), SIMDE_FLOAT32_C(     1.43),
+        SIMDE_FLOAT32_C(     1.15), SIMDE_FLOAT32_C(    -0.97), SIMDE_FLOAT32_C(     1.02), SIMDE_FLOAT32_C(    -0.62) },
+      SIMDE_FLOAT32_C(    -0.90) },
+    { UINT16_C(33625),
+      { SIMDE_FLOAT32_C(    -0.68), SIMDE_FLOAT32_C(     0.72), SIMDE_FLOAT32_C(    -0.98), SIMDE_FLOAT32_C(    -0.63),
+        SIMDE_FLOAT32_C(    -0.53), SIMDE_FLOAT32_C(    -0.69), SIMDE_FLOAT32_C(     1.42), SIMDE_FLOAT32_C(    -0.56),
+        SIMDE_FLOAT32_C(    -1.14), SIMDE_FLOAT32_C(     1.62), SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(     0.61),
+        SIMDE_FLOAT32_C(     1.36), SIMDE_FLOAT32_C(     1.50), SIMDE_FLOAT32_C(    -0.53), SIMDE_FLOAT32_C(    -1.55) },
+      SIMDE_FLOAT32_C(    -0.92) },
+    { UINT16_C(50670),
+      { SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(     0.77), SIMDE_FLOAT32_C(    -0.88), SIMDE_FLOAT32_C(     1.48),
+        SIMDE_FLOAT32_C(     1.73), SIMDE_FLOAT32_C(    -1.74), SIMDE_FLOAT32_C(    -0.96), SIMDE_FLOAT32_C(    -1.32),
+        SIMDE_FLOAT32_C(    -1.63), SIMDE_FLOAT32_C(    -0.73), SIMDE_FLOAT32_C(    -0.95), SIMDE_FLOAT32_C(     1.77),
+        SIMDE_FLOAT32_C(     1.48), SIMDE_FLOAT32_C(     1.54), SIMDE_FLOAT32_C(    -1.18), SIMDE_FLOAT32_C(     1.35) },
+      SIMDE_FLOAT32_C(    -5.45) },
+    { UINT16_C(21530),
+      { SIMDE_FLOAT32_C(     0.83), SIMDE_FLOAT32_C(     0.55), SIMDE_FLOAT32_C(    -1.29), SIMDE_FLOAT32_C(    -1.11),
+        SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(    -1.17), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(     1.14),
+        SIMDE_FLOAT32_C(    -0.55), SIMDE_FLOAT32_C(    -1.17), SIMDE_FLOAT32_C(    -1.20), SIMDE_FLOAT32_C(     0.92),
+        SIMDE_FLOAT32_C(    -1.16), SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(     0.76), SIMDE_FLOAT32_C(     1.02) },
+      SIMDE_FLOAT32_C(    -0.54) },
+    { UINT16_C(11171),
+      { SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(     1.48), SIMDE_FLOAT32_C(    -1.71), SIMDE_FLOAT32_C(     1.49),
+        SIMDE_FLOAT32_C(     1.03), SIMDE_FLOAT32_C(     1.71), SIMDE_FLOAT32_C(    -1.60), SIMDE_FLOAT32_C(    -1.53),
+        SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(     1.46), SIMDE_FLOAT32_C(     1.73), SIMDE_FLOAT32_C(    -1.22),
+        SIMDE_FLOAT32_C(    -0.79), SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(    -0.87), SIMDE_FLOAT32_C(    -0.76) },
+      SIMDE_FLOAT32_C(   -12.03) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_mul_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  189),
+      { SIMDE_FLOAT64_C(    -0.62), SIMDE_FLOAT64_C(     1.01), SIMDE_FLOAT64_C(    -0.56), SIMDE_FLOAT64_C(    -0.58),
+        SIMDE_FLOAT64_C(    -0.57), SIMDE_FLOAT64_C(     1.43), SIMDE_FLOAT64_C(     0.97), SIMDE_FLOAT64_C(     1.05) },
+      SIMDE_FLOAT64_C(     0.17) },
+    { UINT8_C(   74),
+      { SIMDE_FLOAT64_C(    -1.18), SIMDE_FLOAT64_C(     1.55), SIMDE_FLOAT64_C(     1.17), SIMDE_FLOAT64_C(    -1.42),
+        SIMDE_FLOAT64_C(    -0.69), SIMDE_FLOAT64_C(     0.90), SIMDE_FLOAT64_C(    -0.95), SIMDE_FLOAT64_C(    -1.67) },
+      SIMDE_FLOAT64_C(     2.09) },
+    { UINT8_C(   57),
+      { SIMDE_FLOAT64_C(     1.56), SIMDE_FLOAT64_C(     1.14), SIMDE_FLOAT64_C(     0.60), SIMDE_FLOAT64_C(     1.15),
+        SIMDE_FLOAT64_C(     1.74), SIMDE_FLOAT64_C(     1.06), SIMDE_FLOAT64_C(    -1.63), SIMDE_FLOAT64_C(    -0.67) },
+      SIMDE_FLOAT64_C(     3.31) },
+    { UINT8_C(   76),
+      { SIMDE_FLOAT64_C(    -0.86), SIMDE_FLOAT64_C(    -0.77), SIMDE_FLOAT64_C(    -0.83), SIMDE_FLOAT64_C(    -0.99),
+        SIMDE_FLOAT64_C(    -1.49), SIMDE_FLOAT64_C(    -0.94), SIMDE_FLOAT64_C(    -1.59), SIMDE_FLOAT64_C(     1.18) },
+      SIMDE_FLOAT64_C(    -1.31) },
+    { UINT8_C(  230),
+      { SIMDE_FLOAT64_C(     1.78), SIMDE_FLOAT64_C(     0.62), SIMDE_FLOAT64_C(     0.57), SIMDE_FLOAT64_C(     0.52),
+        SIMDE_FLOAT64_C(     0.51), SIMDE_FLOAT64_C(     0.81), SIMDE_FLOAT64_C(    -0.67), SIMDE_FLOAT64_C(     0.75) },
+      SIMDE_FLOAT64_C(    -0.14) },
+    { UINT8_C(  121),
+      { SIMDE_FLOAT64_C(     0.51), SIMDE_FLOAT64_C(    -1.22), SIMDE_FLOAT64_C(    -0.85), SIMDE_FLOAT64_C(     0.77),
+        SIMDE_FLOAT64_C(     0.93), SIMDE_FLOAT64_C(     1.11), SIMDE_FLOAT64_C(     1.51), SIMDE_FLOAT64_C(     0.62) },
+      SIMDE_FLOAT64_C(     0.61) },
+    { UINT8_C(  147),
+      { SIMDE_FLOAT64_C(     1.51), SIMDE_FLOAT64_C(    -0.56), SIMDE_FLOAT64_C(     0.70), SIMDE_FLOAT64_C(     0.59),
+        SIMDE_FLOAT64_C(    -1.25), SIMDE_FLOAT64_C(    -0.63), SIMDE_FLOAT64_C(     1.52), SIMDE_FLOAT64_C(     1.21) },
+      SIMDE_FLOAT64_C(     1.28) },
+    { UINT8_C(  187),
+      { SIMDE_FLOAT64_C(     1.57), SIMDE_FLOAT64_C(    -1.07), SIMDE_FLOAT64_C(    -0.81), SIMDE_FLOAT64_C(    -0.62),
+        SIMDE_FLOAT64_C(     1.09), SIMDE_FLOAT64_C(    -1.14), SIMDE_FLOAT64_C(    -0.64), SIMDE_FLOAT64_C(     1.04) },
+      SIMDE_FLOAT64_C(    -1.35) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_mul_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C( 4584),
+      { -INT32_C(1133393750), -INT32_C( 533957880), -INT32_C( 590527138),  INT32_C(  48624040),
+         INT32_C(1157552893),  INT32_C(2136251121), -INT32_C(2120240394), -INT32_C( 606597517),
+        -INT32_C(1283675021),  INT32_C(2099022036),  INT32_C(2102856496), -INT32_C( 124228091),
+        -INT32_C( 714513951), -INT32_C(  59844107), -INT32_C(2117797883),  INT32_C( 683077249) },
+      INT32_C(2136251121) },
+    { UINT16_C(12668),
+      {  INT32_C(1466465127), -INT32_C( 364727616),  INT32_C( 780592234), -INT32_C( 101341289),
+        -INT32_C(1266381971),  INT32_C( 850436291), -INT32_C( 920793672), -INT32_C(2109388806),
+        -INT32_C( 266670289), -INT32_C( 656538892),  INT32_C( 105154979),  INT32_C( 284421812),
+        -INT32_C(1089415955),  INT32_C( 732133265),  INT32_C(1336581040), -INT32_C(1724780075) },
+      INT32_C( 850436291) },
+    { UINT16_C(25066),
+      { -INT32_C( 531688862), -INT32_C(1715397555),  INT32_C(1989682425),  INT32_C(1073305316),
+         INT32_C(1477884903), -INT32_C( 299555589), -INT32_C( 229564947), -INT32_C( 971465355),
+         INT32_C(1297116092),  INT32_C( 696939816),  INT32_C(1896179931),  INT32_C( 488671734),
+        -INT32_C(1613826880),  INT32_C( 602767389),  INT32_C(1162932498),  INT32_C(  11462316) },
+      INT32_C(1297116092) },
+    { UINT16_C(  893),
+      { -INT32_C(1484790777), -INT32_C(1456162328), -INT32_C( 185476817), -INT32_C(1149979443),
+         INT32_C( 649843812),  INT32_C(1016755391), -INT32_C(  52197721), -INT32_C(  59915507),
+        -INT32_C(1550986733),  INT32_C( 866331890), -INT32_C(1061907135), -INT32_C(  47380099),
+         INT32_C(1665435484),  INT32_C(1080474899), -INT32_C(1471966154),  INT32_C(2063162377) },
+      INT32_C(1016755391) },
+    { UINT16_C(65453),
+      {  INT32_C(1723595283),  INT32_C(1800737497), -INT32_C(1890304842),  INT32_C(  93004434),
+        -INT32_C(1408987185),  INT32_C(2049710765), -INT32_C(1421359048), -INT32_C(1045131563),
+         INT32_C(1424782414),  INT32_C( 384244269), -INT32_C(1482676025), -INT32_C( 953475287),
+         INT32_C( 809408679),  INT32_C(1629441864),  INT32_C(1316018041), -INT32_C( 246125662) },
+      INT32_C(2049710765) },
+    { UINT16_C(31765),
+      {  INT32_C(1499737414),  INT32_C(1425798006),  INT32_C( 365348588),  INT32_C(2110440964),
+        -INT32_C( 747238070),  INT32_C(1379551865),  INT32_C(1707658879), -INT32_C( 295768666),
+         INT32_C(1485425295), -INT32_C(1253749259),  INT32_C( 856817309), -INT32_C(1049344931),
+         INT32_C(2065637206),  INT32_C(1474254895),  INT32_C(2089686129),  INT32_C( 571409687) },
+      INT32_C(2089686129) },
+    { UINT16_C( 9278),
+      { -INT32_C(1881637511), -INT32_C(  58227816),  INT32_C( 763905408), -INT32_C( 164123700),
+        -INT32_C( 749722663),  INT32_C(1573065355), -INT32_C(1185907523),  INT32_C( 957543109),
+        -INT32_C(1910848183), -INT32_C( 288296274),  INT32_C( 573862021), -INT32_C(  56690831),
+         INT32_C(1395005593),  INT32_C( 859109690),  INT32_C(1014508720),  INT32_C(1599004199) },
+      INT32_C(1573065355) },
+    { UINT16_C(61863),
+      { -INT32_C(1485407366), -INT32_C( 209889293), -INT32_C(1003766906),  INT32_C( 918944892),
+        -INT32_C( 879536123),  INT32_C(2039084362),  INT32_C( 896831343), -INT32_C( 717723008),
+         INT32_C( 694063746),  INT32_C( 147595245), -INT32_C(1552392847), -INT32_C(1343951531),
+        -INT32_C( 459334622), -INT32_C(2006935096),  INT32_C(1481674287),  INT32_C( 713956671) },
+      INT32_C(2039084362) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_max_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT16_C(29974),
+      { UINT32_C(1175570687), UINT32_C( 634844832), UINT32_C(4080245408), UINT32_C(2404371224),
+        UINT32_C(3195367307), UINT32_C( 489819738), UINT32_C(1315743469), UINT32_C(3308628558),
+        UINT32_C( 890235438), UINT32_C(4053934227), UINT32_C(1020366829), UINT32_C(3651645854),
+        UINT32_C( 228774561), UINT32_C( 405390708), UINT32_C( 302368159), UINT32_C(3459732091) },
+      UINT32_C(4080245408) },
+    { UINT16_C( 3640),
+      { UINT32_C(2693865052), UINT32_C( 420769532), UINT32_C(3454163709), UINT32_C(3507475910),
+        UINT32_C(2742712452), UINT32_C(2774308879), UINT32_C( 262122966), UINT32_C( 231542774),
+        UINT32_C( 801943469), UINT32_C(2772458072), UINT32_C( 198887772), UINT32_C(1216511612),
+        UINT32_C( 733423738), UINT32_C( 782363785), UINT32_C( 540425997), UINT32_C(4061757691) },
+      UINT32_C(3507475910) },
+    { UINT16_C(42953),
+      { UINT32_C(1793221223), UINT32_C( 812834893), UINT32_C(3455277569), UINT32_C( 784404783),
+        UINT32_C( 851616255), UINT32_C(1621833543), UINT32_C(2652372776), UINT32_C(3536800409),
+        UINT32_C(1982746637), UINT32_C(3680759908), UINT32_C(2925034743), UINT32_C(1502227234),
+        UINT32_C(  23507802), UINT32_C( 348649762), UINT32_C(1994125496), UINT32_C(1624267296) },
+      UINT32_C(3680759908) },
+    { UINT16_C(46129),
+      { UINT32_C(1518296593), UINT32_C( 689076576), UINT32_C(4092709710), UINT32_C( 820591580),
+        UINT32_C(2631434704), UINT32_C(3021333997), UINT32_C(4112981426), UINT32_C(3099553646),
+        UINT32_C(1120339600), UINT32_C(1836878027), UINT32_C(1137171514), UINT32_C(2410720355),
+        UINT32_C( 607345966), UINT32_C( 122532405), UINT32_C(1670526452), UINT32_C( 673845385) },
+      UINT32_C(3021333997) },
+    { UINT16_C(13707),
+      { UINT32_C(2228730618), UINT32_C(1789127831), UINT32_C(1653771243), UINT32_C(4270057660),
+        UINT32_C(1553122536), UINT32_C(1523094773), UINT32_C( 168142440), UINT32_C( 963200177),
+        UINT32_C(1189788995), UINT32_C( 154866740), UINT32_C( 909898958), UINT32_C( 728612967),
+        UINT32_C(2617944698), UINT32_C(2702235915), UINT32_C(2497246472), UINT32_C(3689788370) },
+      UINT32_C(4270057660) },
+    { UINT16_C(30619),
+      { UINT32_C(1621744104), UINT32_C(  70974492), UINT32_C(3672669787), UINT32_C(2191803594),
+        UINT32_C(1065140672), UINT32_C(2488428903), UINT32_C(2140485250), UINT32_C( 656742125),
+        UINT32_C(1062266464), UINT32_C(2398887381), UINT32_C( 370657668), UINT32_C(3892321057),
+        UINT32_C( 608452604), UINT32_C( 140421661), UINT32_C(2904142366), UINT32_C(2107974233) },
+      UINT32_C(2904142366) },
+    { UINT16_C(46454),
+      { UINT32_C(1299010369), UINT32_C(1013553838), UINT32_C(1772470065), UINT32_C( 943077497),
+        UINT32_C(4071325530), UINT32_C(1078208406), UINT32_C( 808643754), UINT32_C( 329972376),
+        UINT32_C(2312545445), UINT32_C(3244234029), UINT32_C(2815392950), UINT32_C(1123714531),
+        UINT32_C( 849836580), UINT32_C( 853538395), UINT32_C(3341064280), UINT32_C(  37704484) },
+      UINT32_C(4071325530) },
+    { UINT16_C( 3342),
+      { UINT32_C(1591688424), UINT32_C(2180069141), UINT32_C(2473555457), UINT32_C(2364065518),
+        UINT32_C(3027362451), UINT32_C( 620573108), UINT32_C(3253265554), UINT32_C(3865287904),
+        UINT32_C( 143260326), UINT32_C(2523613780), UINT32_C(2539464610), UINT32_C(2908239568),
+        UINT32_C(2856607894), UINT32_C(2097501963), UINT32_C( 962110519), UINT32_C(3846926504) },
+      UINT32_C(2908239568) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_mask_reduce_max_epu32(test_vec[i].k, a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(   61),
+      {  INT64_C(4902119868227372505),  INT64_C(6604421919683971650), -INT64_C(4535891058334845249), -INT64_C(1316514741741776484),
+         INT64_C(1549903090316821218),  INT64_C(4102254815708007053), -INT64_C(7667124381671820013), -INT64_C(4587700397553527966) },
+      INT64_C(4902119868227372505) },
+    { UINT8_C(  217),
+      { -INT64_C(6722256172948698698), -INT64_C(6242032316746639452),  INT64_C(1217091634149168605),  INT64_C( 818248861209849168),
+        -INT64_C(6535324059837107985),  INT64_C(1364572011889476004),  INT64_C(3814964835320808912),  INT64_C(8863605268171051230) },
+      INT64_C(8863605268171051230) },
+    { UINT8_C(  218),
+      { -INT64_C(4742624822452416884), -INT64_C(5211560844081771780), -INT64_C(2945152575117402410), -INT64_C(6023970349202940702),
+        -INT64_C(4449484356394292956),  INT64_C(5925346620108309534), -INT64_C(2712258249144138172), -INT64_C(7611382310119769282) },
+      -INT64_C(2712258249144138172) },
+    { UINT8_C(   63),
+      { -INT64_C( 553503617044724632),  INT64_C(2156516744074345986),  INT64_C(1653943896339610709), -INT64_C(6035527797580487763),
+        -INT64_C(4979451878920041886),  INT64_C(5469507237580543959), -INT64_C( 391293984656506206), -INT64_C(3620745953628479764) },
+      INT64_C(5469507237580543959) },
+    { UINT8_C(   11),
+      { -INT64_C(7380668741469849081), -INT64_C(5526196946097317168),  INT64_C(4178745359205690580),  INT64_C(7220757955125237292),
+        -INT64_C(1895093662556903053), -INT64_C(8460553122426301453),  INT64_C(1810325118765737260),  INT64_C(6707124460443799491) },
+      INT64_C(7220757955125237292) },
+    { UINT8_C(  197),
+      {  INT64_C( 635438683321900059),  INT64_C( 475571621685695358), -INT64_C(3003457512720883790), -INT64_C(2883681322060754028),
+        -INT64_C(2173696963900847589),  INT64_C(7375974052508557227),  INT64_C(3417195703528187728),  INT64_C( 250450227770532211) },
+      INT64_C(3417195703528187728) },
+    { UINT8_C(  169),
+      { -INT64_C(8178249704837872694), -INT64_C( 138609791231726991),  INT64_C(3834354394438449240), -INT64_C(2555306274020142882),
+         INT64_C(3797177478346507225),  INT64_C(3452956563331219394), -INT64_C(6911855593990821322), -INT64_C(5594137747417502909) },
+      INT64_C(3452956563331219394) },
+    { UINT8_C(    8),
+      { -INT64_C(5967788782783759909),  INT64_C(7118888882871804993), -INT64_C(1709877598839882595), -INT64_C(8643052412392396919),
+         INT64_C(9059915095741718833), -INT64_C( 673901106583748162),  INT64_C(6749325237480346674),  INT64_C( 493972135123696228) },
+      -INT64_C(8643052412392396919) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_max_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT8_C(    0),
+      { UINT64_C( 2737103955621288345), UINT64_C( 1283859183062012027), UINT64_C( 7820085672100030964), UINT64_C(10210201696397203965),
+        UINT64_C(  348044721144961945), UINT64_C(14042944617457324464), UINT64_C(17573402450762352548), UINT64_C(  505580527849112207) },
+      UINT64_C(                   0) },
+    { UINT8_C(   55),
+      { UINT64_C(18137190921100604285), UINT64_C(16961712821553131401), UINT64_C(17769280036200732383), UINT64_C( 3688844027794934063),
+        UINT64_C(14353629402909389735), UINT64_C( 4339199361983281540), UINT64_C( 3427553010218500184), UINT64_C(10101074542130240531) },
+      UINT64_C(18137190921100604285) },
+    { UINT8_C(   69),
+      { UINT64_C(   32090382357479411), UINT64_C(15074037675803861015), UINT64_C(  880056720871585486), UINT64_C(12279293454997822758),
+        UINT64_C( 5378501551544695938), UINT64_C(10934046221660327479), UINT64_C( 7444268328718417253), UINT64_C( 3578342849205010452) },
+      UINT64_C( 7444268328718417253) },
+    { UINT8_C(  245),
+      { UINT64_C( 2887114899218289597), UINT64_C( 2220138333456493882), UINT64_C(15531865396627609955), UINT64_C(12608875637660631459),
+        UINT64_C(14505829577665143749), UINT64_C(  212754461923601171), UINT64_C( 8771540807295820887), UINT64_C(11138904476598095948) },
+      UINT64_C(15531865396627609955) },
+    { UINT8_C(  182),
+      { UINT64_C( 6805844551112925739), UINT64_C( 3581181494609931489), UINT64_C(12036519042435893769), UINT64_C(15789703056781970739),
+        UINT64_C( 1721229572366845329), UINT64_C( 3122740243072472263), UINT64_C(12904328647779770829), UINT64_C( 2900963256893078467) },
+      UINT64_C(12036519042435893769) },
+    { UINT8_C(  198),
+      { UINT64_C( 4423411198921504799), UINT64_C( 5685220270617011740), UINT64_C(17357550009206710455), UINT64_C(17997958576890214364),
+        UINT64_C( 5248815942453073962), UINT64_C( 8359858002383740476), UINT64_C( 4382190173361322452), UINT64_C( 1171785312641643376) },
+      UINT64_C(17357550009206710455) },
+    { UINT8_C(   50),
+      { UINT64_C(13690027939920410843), UINT64_C( 5424122390293946185), UINT64_C(18237120607500873269), UINT64_C( 5447727075402006518),
+        UINT64_C( 8207834469805170970), UINT64_C(18279901382727179412), UINT64_C( 3289932219678736982), UINT64_C( 2578001420760607046) },
+      UINT64_C(18279901382727179412) },
+    { UINT8_C(   66),
+      { UINT64_C( 4333749922449330893), UINT64_C( 6572414604415411339), UINT64_C(  368463770403719811), UINT64_C( 8363262307356947079),
+        UINT64_C(10788013716123326495), UINT64_C(11080446989943479873), UINT64_C(13400943783270892872), UINT64_C( 1579410378423497772) },
+      UINT64_C(13400943783270892872) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_mask_reduce_max_epu64(test_vec[i].k, a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(36128),
+      { SIMDE_FLOAT32_C(   432.69), SIMDE_FLOAT32_C(   867.17), SIMDE_FLOAT32_C(  -479.85), SIMDE_FLOAT32_C(    -7.54),
+        SIMDE_FLOAT32_C(  -444.32), SIMDE_FLOAT32_C(   905.10), SIMDE_FLOAT32_C(  -330.23), SIMDE_FLOAT32_C(  -615.65),
+        SIMDE_FLOAT32_C(   135.87), SIMDE_FLOAT32_C(   552.05), SIMDE_FLOAT32_C(   848.87), SIMDE_FLOAT32_C(   348.31),
+        SIMDE_FLOAT32_C(   238.80), SIMDE_FLOAT32_C(   716.13), SIMDE_FLOAT32_C(  -279.98), SIMDE_FLOAT32_C(   532.49) },
+      SIMDE_FLOAT32_C(   905.10) },
+    { UINT16_C(29134),
+      { SIMDE_FLOAT32_C(   797.41), SIMDE_FLOAT32_C(   922.38), SIMDE_FLOAT32_C(  -567.37), SIMDE_FLOAT32_C(   835.18),
+        SIMDE_FLOAT32_C(   439.59), SIMDE_FLOAT32_C(  -324.60), SIMDE_FLOAT32_C(   866.93), SIMDE_FLOAT32_C(   733.21),
+        SIMDE_FLOAT32_C(   649.25), SIMDE_FLOAT32_C(   723.59), SIMDE_FLOAT32_C(  -739.69), SIMDE_FLOAT32_C(  -392.68),
+        SIMDE_FLOAT32_C(  -137.20), SIMDE_FLOAT32_C(  -450.51), SIMDE_FLOAT32_C(  -694.46), SIMDE_FLOAT32_C(  -756.79) },
+      SIMDE_FLOAT32_C(   922.38) },
+    { UINT16_C(52212),
+      { SIMDE_FLOAT32_C(   134.61), SIMDE_FLOAT32_C(   276.54), SIMDE_FLOAT32_C(  -987.47), SIMDE_FLOAT32_C(   549.14),
+        SIMDE_FLOAT32_C(  -829.58), SIMDE_FLOAT32_C(   561.19), SIMDE_FLOAT32_C(  -724.21), SIMDE_FLOAT32_C(   732.62),
+        SIMDE_FLOAT32_C(  -670.93), SIMDE_FLOAT32_C(  -235.07), SIMDE_FLOAT32_C(   831.39), SIMDE_FLOAT32_C(  -639.20),
+        SIMDE_FLOAT32_C(  -262.29), SIMDE_FLOAT32_C(  -831.57), SIMDE_FLOAT32_C(  -107.70), SIMDE_FLOAT32_C(  -932.32) },
+      SIMDE_FLOAT32_C(   732.62) },
+    { UINT16_C(56042),
+      { SIMDE_FLOAT32_C(  -970.87), SIMDE_FLOAT32_C(  -413.22), SIMDE_FLOAT32_C(   880.16), SIMDE_FLOAT32_C(  -589.47),
+        SIMDE_FLOAT32_C(   485.12), SIMDE_FLOAT32_C(  -695.45), SIMDE_FLOAT32_C(   700.69), SIMDE_FLOAT32_C(  -542.47),
+        SIMDE_FLOAT32_C(  -662.09), SIMDE_FLOAT32_C(  -385.55), SIMDE_FLOAT32_C(  -131.72), SIMDE_FLOAT32_C(  -723.13),
+        SIMDE_FLOAT32_C(   679.62), SIMDE_FLOAT32_C(  -970.83), SIMDE_FLOAT32_C(   105.80), SIMDE_FLOAT32_C(   525.50) },
+      SIMDE_FLOAT32_C(   700.69) },
+    { UINT16_C( 2091),
+      { SIMDE_FLOAT32_C(   172.79), SIMDE_FLOAT32_C(  -496.21), SIMDE_FLOAT32_C(   321.77), SIMDE_FLOAT32_C(   570.04),
+        SIMDE_FLOAT32_C(    16.21), SIMDE_FLOAT32_C(  -278.20), SIMDE_FLOAT32_C(  -408.41), SIMDE_FLOAT32_C(   410.97),
+        SIMDE_FLOAT32_C(   -76.82), SIMDE_FLOAT32_C(   738.65), SIMDE_FLOAT32_C(  -216.99), SIMDE_FLOAT32_C(  -563.54),
+        SIMDE_FLOAT32_C(  -244.69), SIMDE_FLOAT32_C(   361.14), SIMDE_FLOAT32_C(   369.24), SIMDE_FLOAT32_C(   969.64) },
+      SIMDE_FLOAT32_C(   570.04) },
+    { UINT16_C( 8022),
+      { SIMDE_FLOAT32_C(   219.21), SIMDE_FLOAT32_C(  -450.69), SIMDE_FLOAT32_C(   702.69), SIMDE_FLOAT32_C(   268.77),
+        SIMDE_FLOAT32_C(  -380.48), SIMDE_FLOAT32_C(  -757.37), SIMDE_FLOAT32_C(  -547.33), SIMDE_FLOAT32_C(  -965.18),
+        SIMDE_FLOAT32_C(  -120.97), SIMDE_FLOAT32_C(   380.56), SIMDE_FLOAT32_C(   650.03), SIMDE_FLOAT32_C(   290.53),
+        SIMDE_FLOAT32_C(   708.74), SIMDE_FLOAT32_C(  -269.41), SIMDE_FLOAT32_C(   241.00), SIMDE_FLOAT32_C(  -728.88) },
+      SIMDE_FLOAT32_C(   708.74) },
+    { UINT16_C( 3084),
+      { SIMDE_FLOAT32_C(   576.47), SIMDE_FLOAT32_C(  -362.27), SIMDE_FLOAT32_C(   -38.09), SIMDE_FLOAT32_C(   762.05),
+        SIMDE_FLOAT32_C(  -161.76), SIMDE_FLOAT32_C(  -182.43), SIMDE_FLOAT32_C(  -761.34), SIMDE_FLOAT32_C(   -10.99),
+        SIMDE_FLOAT32_C(  -968.15), SIMDE_FLOAT32_C(  -229.34), SIMDE_FLOAT32_C(    46.70), SIMDE_FLOAT32_C(   564.12),
+        SIMDE_FLOAT32_C(   989.48), SIMDE_FLOAT32_C(  -497.25), SIMDE_FLOAT32_C(   416.70), SIMDE_FLOAT32_C(    69.71) },
+      SIMDE_FLOAT32_C(   762.05) },
+    { UINT16_C(55521),
+      { SIMDE_FLOAT32_C(  -612.14), SIMDE_FLOAT32_C(   461.32), SIMDE_FLOAT32_C(  -559.94), SIMDE_FLOAT32_C(   446.41),
+        SIMDE_FLOAT32_C(  -354.53), SIMDE_FLOAT32_C(   922.15), SIMDE_FLOAT32_C(   381.90), SIMDE_FLOAT32_C(  -301.53),
+        SIMDE_FLOAT32_C(   206.42), SIMDE_FLOAT32_C(  -545.03), SIMDE_FLOAT32_C(  -362.18), SIMDE_FLOAT32_C(   125.36),
+        SIMDE_FLOAT32_C(   839.32), SIMDE_FLOAT32_C(    97.31), SIMDE_FLOAT32_C(  -450.96), SIMDE_FLOAT32_C(  -808.61) },
+      SIMDE_FLOAT32_C(   922.15) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_max_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  171),
+      { SIMDE_FLOAT64_C(    76.65), SIMDE_FLOAT64_C(  -327.29), SIMDE_FLOAT64_C(  -326.30), SIMDE_FLOAT64_C(   402.44),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(    66.08), SIMDE_FLOAT64_C(  -685.08), SIMDE_FLOAT64_C(   193.06) },
+      SIMDE_FLOAT64_C(   402.44) },
+    { UINT8_C(  120),
+      { SIMDE_FLOAT64_C(   690.90), SIMDE_FLOAT64_C(  -672.83), SIMDE_FLOAT64_C(  -983.39), SIMDE_FLOAT64_C(  -797.27),
+        SIMDE_FLOAT64_C(  -707.84), SIMDE_FLOAT64_C(   118.91), SIMDE_FLOAT64_C(  -477.50), SIMDE_FLOAT64_C(  -527.35) },
+      SIMDE_FLOAT64_C(   118.91) },
+    { UINT8_C(  114),
+      { SIMDE_FLOAT64_C(   360.72), SIMDE_FLOAT64_C(  -355.27), SIMDE_FLOAT64_C(   340.98), SIMDE_FLOAT64_C(  -181.89),
+        SIMDE_FLOAT64_C(   160.84), SIMDE_FLOAT64_C(   870.57), SIMDE_FLOAT64_C(  -883.75), SIMDE_FLOAT64_C(  -404.14) },
+      SIMDE_FLOAT64_C(   870.57) },
+    { UINT8_C(  138),
+      { SIMDE_FLOAT64_C(  -969.25), SIMDE_FLOAT64_C(   109.42), SIMDE_FLOAT64_C(  -472.58), SIMDE_FLOAT64_C(   613.86),
+        SIMDE_FLOAT64_C(   668.13), SIMDE_FLOAT64_C(   390.04), SIMDE_FLOAT64_C(    -1.34), SIMDE_FLOAT64_C(  -986.30) },
+      SIMDE_FLOAT64_C(   613.86) },
+    { UINT8_C(   60),
+      { SIMDE_FLOAT64_C(  -564.63), SIMDE_FLOAT64_C(   760.36), SIMDE_FLOAT64_C(    83.01), SIMDE_FLOAT64_C(   -50.87),
+        SIMDE_FLOAT64_C(   592.78), SIMDE_FLOAT64_C(  -500.95), SIMDE_FLOAT64_C(    68.57), SIMDE_FLOAT64_C(   127.85) },
+      SIMDE_FLOAT64_C(   592.78) },
+    { UINT8_C(  151),
+      { SIMDE_FLOAT64_C(   616.20), SIMDE_FLOAT64_C(    58.65), SIMDE_FLOAT64_C(   898.65), SIMDE_FLOAT64_C(  -903.76),
+        SIMDE_FLOAT64_C(  -203.52), SIMDE_FLOAT64_C(  -124.95), SIMDE_FLOAT64_C(  -294.54), SIMDE_FLOAT64_C(  -932.41) },
+      SIMDE_FLOAT64_C(   898.65) },
+    { UINT8_C(  189),
+      { SIMDE_FLOAT64_C(  -717.28), SIMDE_FLOAT64_C(  -339.72), SIMDE_FLOAT64_C(   865.76), SIMDE_FLOAT64_C(   912.09),
+        SIMDE_FLOAT64_C(   177.84), SIMDE_FLOAT64_C(   155.01), SIMDE_FLOAT64_C(    -5.96), SIMDE_FLOAT64_C(  -937.60) },
+      SIMDE_FLOAT64_C(   912.09) },
+    { UINT8_C(  121),
+      { SIMDE_FLOAT64_C(  -860.32), SIMDE_FLOAT64_C(    43.66), SIMDE_FLOAT64_C(  -466.96), SIMDE_FLOAT64_C(  -613.12),
+        SIMDE_FLOAT64_C(   -30.66), SIMDE_FLOAT64_C(   366.43), SIMDE_FLOAT64_C(  -214.74), SIMDE_FLOAT64_C(   687.72) },
+      SIMDE_FLOAT64_C(   366.43) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_max_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(18379),
+      { -INT32_C( 674975836), -INT32_C(1435589974), -INT32_C(   6837037),  INT32_C(1995089258),
+        -INT32_C(2062785928), -INT32_C( 818763447),  INT32_C( 419449402), -INT32_C( 916578991),
+        -INT32_C(1592079925),  INT32_C(2119326631), -INT32_C( 873200286), -INT32_C(1815406229),
+        -INT32_C( 843853501), -INT32_C(1671363846),  INT32_C( 157707864), -INT32_C( 894762003) },
+      -INT32_C(1592079925) },
+    { UINT16_C( 1351),
+      { -INT32_C( 123666944), -INT32_C( 896263474), -INT32_C(2049868291), -INT32_C( 848179792),
+        -INT32_C(1982930279),  INT32_C(1847902085),  INT32_C(1607160316), -INT32_C(1706266740),
+        -INT32_C( 911683445), -INT32_C( 498808660),  INT32_C( 173953321), -INT32_C( 320508811),
+        -INT32_C(1541441283),  INT32_C(1835736533),  INT32_C( 440794423),  INT32_C(1352736551) },
+      -INT32_C(2049868291) },
+    { UINT16_C(13753),
+      {  INT32_C( 906811000), -INT32_C(1316002996),  INT32_C( 750256188),  INT32_C( 609601814),
+         INT32_C( 957681336),  INT32_C(1352114397), -INT32_C( 921580222), -INT32_C(  92139744),
+        -INT32_C( 291117954),  INT32_C(1871274267), -INT32_C( 933055699),  INT32_C( 876880571),
+         INT32_C( 144093731),  INT32_C(1807634228),  INT32_C(1914156848), -INT32_C(  17248462) },
+      -INT32_C( 933055699) },
+    { UINT16_C(10890),
+      {  INT32_C(2051611862), -INT32_C( 213664804),  INT32_C( 380174976),  INT32_C( 834984313),
+         INT32_C( 438576331),  INT32_C(1680869318), -INT32_C(1666189605),  INT32_C(1349059590),
+        -INT32_C(1452565485),  INT32_C(1315296653),  INT32_C( 392841025),  INT32_C(   2426979),
+        -INT32_C( 641462266),  INT32_C(1123088783),  INT32_C(2024016772), -INT32_C( 385250674) },
+      -INT32_C( 213664804) },
+    { UINT16_C(49112),
+      { -INT32_C( 742608451),  INT32_C(1770968955),  INT32_C( 143952701),  INT32_C( 181272313),
+         INT32_C( 147615054), -INT32_C(1117410777), -INT32_C(1085146620), -INT32_C(2022405330),
+         INT32_C(1540668171),  INT32_C( 475553963), -INT32_C( 283393761), -INT32_C( 552983907),
+        -INT32_C( 534260032), -INT32_C(1752011863), -INT32_C(1690257627), -INT32_C(1473456382) },
+      -INT32_C(2022405330) },
+    { UINT16_C(37803),
+      { -INT32_C( 207911031), -INT32_C(1253565495), -INT32_C( 274318883), -INT32_C( 922879516),
+        -INT32_C(1514132913), -INT32_C(1718927696),  INT32_C(  21793842),  INT32_C(1386444160),
+        -INT32_C(  36685904),  INT32_C( 543674017), -INT32_C(2114041471),  INT32_C(  27616998),
+        -INT32_C(1385419942), -INT32_C(1959003062), -INT32_C( 304563264),  INT32_C(1971589168) },
+      -INT32_C(1718927696) },
+    { UINT16_C(25788),
+      { -INT32_C(1016497211), -INT32_C( 262572765),  INT32_C(1629156419), -INT32_C(1902148197),
+         INT32_C(1902872650), -INT32_C( 894456200),  INT32_C( 921535106), -INT32_C(1216534188),
+        -INT32_C(1553003619),  INT32_C(1241362760), -INT32_C(1351731690),  INT32_C( 686643544),
+         INT32_C( 505424384),  INT32_C( 325071882),  INT32_C(1482302770), -INT32_C( 116629345) },
+      -INT32_C(1902148197) },
+    { UINT16_C(41203),
+      { -INT32_C( 810883037), -INT32_C(1647804872), -INT32_C( 108965711),  INT32_C(1333977811),
+        -INT32_C( 810548462),  INT32_C( 403823754),  INT32_C(  48957850), -INT32_C( 913528037),
+         INT32_C(1900028602), -INT32_C(1161508008),  INT32_C( 302619337), -INT32_C( 956646708),
+        -INT32_C(  32235961),  INT32_C(1107755811),  INT32_C(1022790182),  INT32_C(2015806982) },
+      -INT32_C(1647804872) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_min_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT16_C(32523),
+      { UINT32_C(2199351286), UINT32_C(3510134558), UINT32_C(3551001406), UINT32_C(4171705835),
+        UINT32_C( 533057986), UINT32_C(2369756973), UINT32_C(2682258740), UINT32_C(3957645017),
+        UINT32_C(1398447751), UINT32_C(1474165117), UINT32_C(1098821079), UINT32_C(1655845260),
+        UINT32_C( 406626822), UINT32_C(1697245729), UINT32_C( 713686440), UINT32_C(3686016541) },
+      UINT32_C( 406626822) },
+    { UINT16_C(53420),
+      { UINT32_C(3908226150), UINT32_C(1326608451), UINT32_C(4178872149), UINT32_C(2467078925),
+        UINT32_C(3999843986), UINT32_C(1924767816), UINT32_C(3896790403), UINT32_C( 398634768),
+        UINT32_C( 187199857), UINT32_C(2423165457), UINT32_C(3658034146), UINT32_C(2775075368),
+        UINT32_C(3836148176), UINT32_C( 215904555), UINT32_C(2249204206), UINT32_C(4144432010) },
+      UINT32_C( 398634768) },
+    { UINT16_C(21509),
+      { UINT32_C(4273374569), UINT32_C( 652369661), UINT32_C(4144217807), UINT32_C(1509058982),
+        UINT32_C(2471197260), UINT32_C(1862047160), UINT32_C(2428924517), UINT32_C(3869073418),
+        UINT32_C(  23998794), UINT32_C(4036213970), UINT32_C(3173218799), UINT32_C( 342884951),
+        UINT32_C( 318779168), UINT32_C(2219430157), UINT32_C(2010689353), UINT32_C( 913186033) },
+      UINT32_C( 318779168) },
+    { UINT16_C(53032),
+      { UINT32_C(2658037001), UINT32_C(3555555745), UINT32_C(4009485258), UINT32_C(2589201260),
+        UINT32_C( 892877265), UINT32_C(2014328425), UINT32_C(1044818295), UINT32_C(2303332605),
+        UINT32_C(1191927731), UINT32_C( 919045029), UINT32_C(3429003971), UINT32_C(2010045537),
+        UINT32_C(2529487960), UINT32_C(1689632821), UINT32_C(3753317758), UINT32_C(1121374347) },
+      UINT32_C( 919045029) },
+    { UINT16_C(42882),
+      { UINT32_C(3043997422), UINT32_C(2080252042), UINT32_C(3647660078), UINT32_C( 741947550),
+        UINT32_C(1222699473), UINT32_C(1154055227), UINT32_C( 747972955), UINT32_C( 972048786),
+        UINT32_C( 694991829), UINT32_C(4287731893), UINT32_C( 559421333), UINT32_C(  72722963),
+        UINT32_C(1174500610), UINT32_C(1211171155), UINT32_C(1014687350), UINT32_C( 383592325) },
+      UINT32_C( 383592325) },
+    { UINT16_C( 5487),
+      { UINT32_C(2909191377), UINT32_C(3016815353), UINT32_C(1666415954), UINT32_C(2332143038),
+        UINT32_C( 517075592), UINT32_C(3945838003), UINT32_C(2355701009), UINT32_C(4292292903),
+        UINT32_C( 959375070), UINT32_C(3874382058), UINT32_C(2313190865), UINT32_C(2405746753),
+        UINT32_C(3236522749), UINT32_C( 756383125), UINT32_C(3150650105), UINT32_C(2446441370) },
+      UINT32_C( 959375070) },
+    { UINT16_C(61428),
+      { UINT32_C(3657182115), UINT32_C(2467631989), UINT32_C(2531445568), UINT32_C( 312851124),
+        UINT32_C(4092986291), UINT32_C(2685321720), UINT32_C(4069915829), UINT32_C(2559614620),
+        UINT32_C(3008362672), UINT32_C(1733102560), UINT32_C(3706988978), UINT32_C(2465487212),
+        UINT32_C( 505533945), UINT32_C(3375067621), UINT32_C( 435492081), UINT32_C(1132409309) },
+      UINT32_C( 435492081) },
+    { UINT16_C( 1368),
+      { UINT32_C(1480553633), UINT32_C(3438909927), UINT32_C(2239903409), UINT32_C( 633936990),
+        UINT32_C( 210232066), UINT32_C( 171113212), UINT32_C( 949490482), UINT32_C(  20729444),
+        UINT32_C(1016139068), UINT32_C( 343739058), UINT32_C(2132729956), UINT32_C(3663553020),
+        UINT32_C(1333279950), UINT32_C(3800272516), UINT32_C(3941472701), UINT32_C(1395559552) },
+      UINT32_C( 210232066) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    uint32_t r = simde_mm512_mask_reduce_min_epu32(test_vec[i].k, a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  234),
+      {  INT64_C(2343061171163438465), -INT64_C(5919601770374280500),  INT64_C(5259143164129666228), -INT64_C(7547459042877498795),
+        -INT64_C(1377769348073090964),  INT64_C(5607490330611960936),  INT64_C(4075317876301335900),  INT64_C(1330770335952989556) },
+      -INT64_C(7547459042877498795) },
+    { UINT8_C(  115),
+      { -INT64_C( 383259683879608477),  INT64_C(7767696436003740314), -INT64_C(5731873627672524109),  INT64_C( 922120331548363126),
+        -INT64_C(3472849332936297080), -INT64_C(6890160565134160668), -INT64_C( 860324107129428801),  INT64_C(6063033592319239860) },
+      -INT64_C(6890160565134160668) },
+    { UINT8_C(  243),
+      { -INT64_C(1137088107651736695), -INT64_C( 798006044929321884),  INT64_C(7726359856917955725), -INT64_C(5047996715808655438),
+         INT64_C(2262218321100401512), -INT64_C(5376623929299709298), -INT64_C( 421490052070354310), -INT64_C(2665168444162864062) },
+      -INT64_C(5376623929299709298) },
+    { UINT8_C(  239),
+      {  INT64_C(8891645210208167832),  INT64_C(4056798703108158940), -INT64_C(7319864793710011534), -INT64_C(1498393485439517918),
+         INT64_C(8280162961558510717),  INT64_C(2197224203130701241), -INT64_C(6552280552388614440),  INT64_C( 478146125189507545) },
+      -INT64_C(7319864793710011534) },
+    { UINT8_C(  145),
+      { -INT64_C(4084546133168976234), -INT64_C(6206705898635683794),  INT64_C(7197843582140323661), -INT64_C(3616512273215906322),
+        -INT64_C(8308782207698720408), -INT64_C(7493627088841209660), -INT64_C(1126619171737453730),  INT64_C(7422391465193262549) },
+      -INT64_C(8308782207698720408) },
+    { UINT8_C(  133),
+      { -INT64_C(2578509838289757434),  INT64_C(6784132247393389094),  INT64_C( 745515804289876996), -INT64_C(4315409962108635820),
+        -INT64_C(3153228352692896311),  INT64_C(1608534775787533999),  INT64_C(3143433891473731567),  INT64_C(8383299886073133558) },
+      -INT64_C(2578509838289757434) },
+    { UINT8_C(  193),
+      { -INT64_C(9000818343402661873), -INT64_C(2839446580177630116),  INT64_C(3004655940225918041),  INT64_C(5917841716544668572),
+        -INT64_C(3178023031834400416), -INT64_C(6277153708625790831),  INT64_C(1798502449459131897),  INT64_C(6082991632399779734) },
+      -INT64_C(9000818343402661873) },
+    { UINT8_C(  141),
+      {  INT64_C(7405675267849548084),  INT64_C(3924603855238916934), -INT64_C( 385151174858047957),  INT64_C(7507360944910936570),
+         INT64_C( 305918245835737682), -INT64_C(7021009963336014254), -INT64_C(6092488062572338105), -INT64_C(9083665285533682006) },
+      -INT64_C(9083665285533682006) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_min_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT8_C(  101),
+      { UINT64_C( 9242758054380690993), UINT64_C( 4918432202301276851), UINT64_C(14811697548230137333), UINT64_C( 4119661857008249168),
+        UINT64_C( 8218603258934252773), UINT64_C( 4523585512077833468), UINT64_C( 8442723008481984306), UINT64_C( 2747669376190461166) },
+      UINT64_C( 4523585512077833468) },
+    { UINT8_C(   25),
+      { UINT64_C( 6759582007639177158), UINT64_C( 2721176834634883878), UINT64_C( 4574075874009797112), UINT64_C(18434768100150297871),
+        UINT64_C(16033588364338392898), UINT64_C(16758968619454042784), UINT64_C(17995185447354365585), UINT64_C( 9325292188905615461) },
+      UINT64_C( 6759582007639177158) },
+    { UINT8_C(   80),
+      { UINT64_C(13704840343608653177), UINT64_C(15102613448989932550), UINT64_C(16389258360845044653), UINT64_C(17309401288591972868),
+        UINT64_C(13046391446480056065), UINT64_C( 6922136177223046064), UINT64_C( 1965206098901068993), UINT64_C(12247092405472102540) },
+      UINT64_C( 1965206098901068993) },
+    { UINT8_C(  147),
+      { UINT64_C(18433591514967274194), UINT64_C( 5743549720888947652), UINT64_C(16349423847970211265), UINT64_C(11999175819957498929),
+        UINT64_C(16923499801624725588), UINT64_C( 9937003414408020838), UINT64_C(15337677567575933232), UINT64_C( 9942657702752182407) },
+      UINT64_C( 5743549720888947652) },
+    { UINT8_C(  143),
+      { UINT64_C(14933565514846608747), UINT64_C(18319420655211777250), UINT64_C( 5831680541124255426), UINT64_C( 7208121717806675436),
+        UINT64_C( 5930193685821316317), UINT64_C( 8935266225241591339), UINT64_C(  645968211007947975), UINT64_C(11541240207848130908) },
+      UINT64_C( 5831680541124255426) },
+    { UINT8_C(  152),
+      { UINT64_C(16266938527278940500), UINT64_C( 8385110806363263419), UINT64_C( 7135007514108629345), UINT64_C(10541236673326843799),
+        UINT64_C( 7081340431179320023), UINT64_C( 3753155556708157691), UINT64_C( 9954499171871343495), UINT64_C(10395888269435295708) },
+      UINT64_C( 7081340431179320023) },
+    { UINT8_C(  128),
+      { UINT64_C( 4406989997104518528), UINT64_C( 9974099253725497483), UINT64_C( 2615267347779132686), UINT64_C(  400732138977700074),
+        UINT64_C(15299138099454581179), UINT64_C( 7990459948296084713), UINT64_C(12844835609972694019), UINT64_C(17658751688840158118) },
+      UINT64_C(17658751688840158118) },
+    { UINT8_C(   63),
+      { UINT64_C(  889927032640566703), UINT64_C(10040618495222391048), UINT64_C(17708152988858444580), UINT64_C( 8014108742746413613),
+        UINT64_C( 6980106857500475533), UINT64_C( 8302113937771205190), UINT64_C(17605440649011120627), UINT64_C( 4878747912698177943) },
+      UINT64_C(  889927032640566703) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    uint64_t r = simde_mm512_mask_reduce_min_epu64(test_vec[i].k, a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(43019),
+      { SIMDE_FLOAT32_C(   754.52), SIMDE_FLOAT32_C(   165.58), SIMDE_FLOAT32_C(  -739.71), SIMDE_FLOAT32_C(   230.63),
+        SIMDE_FLOAT32_C(  -926.31), SIMDE_FLOAT32_C(  -975.49), SIMDE_FLOAT32_C(   261.70), SIMDE_FLOAT32_C(   135.59),
+        SIMDE_FLOAT32_C(   -64.76), SIMDE_FLOAT32_C(   879.10), SIMDE_FLOAT32_C(   834.62), SIMDE_FLOAT32_C(   213.11),
+        SIMDE_FLOAT32_C(  -450.25), SIMDE_FLOAT32_C(   746.50), SIMDE_FLOAT32_C(  -316.79), SIMDE_FLOAT32_C(   114.30) },
+      SIMDE_FLOAT32_C(   114.30) },
+    { UINT16_C(23606),
+      { SIMDE_FLOAT32_C(  -321.80), SIMDE_FLOAT32_C(  -968.05), SIMDE_FLOAT32_C(  -210.55), SIMDE_FLOAT32_C(  -471.17),
+        SIMDE_FLOAT32_C(   -95.70), SIMDE_FLOAT32_C(  -253.15), SIMDE_FLOAT32_C(    23.15), SIMDE_FLOAT32_C(   931.95),
+        SIMDE_FLOAT32_C(  -584.67), SIMDE_FLOAT32_C(   -33.64), SIMDE_FLOAT32_C(   637.18), SIMDE_FLOAT32_C(  -412.60),
+        SIMDE_FLOAT32_C(   -20.04), SIMDE_FLOAT32_C(  -521.92), SIMDE_FLOAT32_C(    65.33), SIMDE_FLOAT32_C(   146.26) },
+      SIMDE_FLOAT32_C(  -968.05) },
+    { UINT16_C(44281),
+      { SIMDE_FLOAT32_C(   -95.15), SIMDE_FLOAT32_C(   -32.49), SIMDE_FLOAT32_C(   343.64), SIMDE_FLOAT32_C(   -59.73),
+        SIMDE_FLOAT32_C(  -379.42), SIMDE_FLOAT32_C(  -433.04), SIMDE_FLOAT32_C(   660.13), SIMDE_FLOAT32_C(   231.47),
+        SIMDE_FLOAT32_C(   126.10), SIMDE_FLOAT32_C(  -870.63), SIMDE_FLOAT32_C(   111.68), SIMDE_FLOAT32_C(   219.64),
+        SIMDE_FLOAT32_C(  -533.75), SIMDE_FLOAT32_C(  -139.04), SIMDE_FLOAT32_C(   570.34), SIMDE_FLOAT32_C(   195.56) },
+      SIMDE_FLOAT32_C(  -433.04) },
+    { UINT16_C(17261),
+      { SIMDE_FLOAT32_C(   231.27), SIMDE_FLOAT32_C(   559.21), SIMDE_FLOAT32_C(  -326.50), SIMDE_FLOAT32_C(   643.13),
+        SIMDE_FLOAT32_C(  -192.15), SIMDE_FLOAT32_C(  -876.35), SIMDE_FLOAT32_C(   -41.71), SIMDE_FLOAT32_C(   458.11),
+        SIMDE_FLOAT32_C(    -6.60), SIMDE_FLOAT32_C(  -427.96), SIMDE_FLOAT32_C(  -953.08), SIMDE_FLOAT32_C(   905.35),
+        SIMDE_FLOAT32_C(  -309.21), SIMDE_FLOAT32_C(  -150.23), SIMDE_FLOAT32_C(   390.80), SIMDE_FLOAT32_C(  -196.06) },
+      SIMDE_FLOAT32_C(  -876.35) },
+    { UINT16_C(53739),
+      { SIMDE_FLOAT32_C(  -214.99), SIMDE_FLOAT32_C(  -888.69), SIMDE_FLOAT32_C(  -748.64), SIMDE_FLOAT32_C(  -137.52),
+        SIMDE_FLOAT32_C(   357.27), SIMDE_FLOAT32_C(   -24.91), SIMDE_FLOAT32_C(  -528.36), SIMDE_FLOAT32_C(    56.74),
+        SIMDE_FLOAT32_C(   726.94), SIMDE_FLOAT32_C(   709.86), SIMDE_FLOAT32_C(  -675.28), SIMDE_FLOAT32_C(   500.36),
+        SIMDE_FLOAT32_C(  -240.76), SIMDE_FLOAT32_C(  -616.14), SIMDE_FLOAT32_C(  -862.50), SIMDE_FLOAT32_C(   805.31) },
+      SIMDE_FLOAT32_C(  -888.69) },
+    { UINT16_C(20962),
+      { SIMDE_FLOAT32_C(   627.59), SIMDE_FLOAT32_C(  -119.13), SIMDE_FLOAT32_C(  -697.13), SIMDE_FLOAT32_C(  -376.57),
+        SIMDE_FLOAT32_C(  -718.86), SIMDE_FLOAT32_C(   110.42), SIMDE_FLOAT32_C(  -701.77), SIMDE_FLOAT32_C(   644.18),
+        SIMDE_FLOAT32_C(   690.59), SIMDE_FLOAT32_C(  -716.77), SIMDE_FLOAT32_C(   182.49), SIMDE_FLOAT32_C(  -471.72),
+        SIMDE_FLOAT32_C(   495.00), SIMDE_FLOAT32_C(  -584.93), SIMDE_FLOAT32_C(   763.23), SIMDE_FLOAT32_C(  -688.24) },
+      SIMDE_FLOAT32_C(  -701.77) },
+    { UINT16_C(34084),
+      { SIMDE_FLOAT32_C(    38.65), SIMDE_FLOAT32_C(  -373.15), SIMDE_FLOAT32_C(   126.58), SIMDE_FLOAT32_C(  -615.73),
+        SIMDE_FLOAT32_C(   606.88), SIMDE_FLOAT32_C(  -971.39), SIMDE_FLOAT32_C(  -763.37), SIMDE_FLOAT32_C(   378.51),
+        SIMDE_FLOAT32_C(  -865.03), SIMDE_FLOAT32_C(   449.32), SIMDE_FLOAT32_C(  -480.94), SIMDE_FLOAT32_C(  -212.47),
+        SIMDE_FLOAT32_C(  -717.19), SIMDE_FLOAT32_C(   238.84), SIMDE_FLOAT32_C(   -43.31), SIMDE_FLOAT32_C(  -173.95) },
+      SIMDE_FLOAT32_C(  -971.39) },
+    { UINT16_C(17695),
+      { SIMDE_FLOAT32_C(   553.07), SIMDE_FLOAT32_C(   955.16), SIMDE_FLOAT32_C(  -966.23), SIMDE_FLOAT32_C(  -634.59),
+        SIMDE_FLOAT32_C(  -178.17), SIMDE_FLOAT32_C(   746.31), SIMDE_FLOAT32_C(  -965.37), SIMDE_FLOAT32_C(  -313.21),
+        SIMDE_FLOAT32_C(  -760.20), SIMDE_FLOAT32_C(   555.94), SIMDE_FLOAT32_C(   102.71), SIMDE_FLOAT32_C(  -543.17),
+        SIMDE_FLOAT32_C(   185.34), SIMDE_FLOAT32_C(  -632.15), SIMDE_FLOAT32_C(   324.78), SIMDE_FLOAT32_C(  -120.85) },
+      SIMDE_FLOAT32_C(  -966.23) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_min_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(  136),
+      { SIMDE_FLOAT64_C(   953.06), SIMDE_FLOAT64_C(  -657.12), SIMDE_FLOAT64_C(  -689.98), SIMDE_FLOAT64_C(   290.86),
+        SIMDE_FLOAT64_C(   204.45), SIMDE_FLOAT64_C(  -529.41), SIMDE_FLOAT64_C(  -433.22), SIMDE_FLOAT64_C(    54.45) },
+      SIMDE_FLOAT64_C(    54.45) },
+    { UINT8_C(   91),
+      { SIMDE_FLOAT64_C(  -896.39), SIMDE_FLOAT64_C(   720.83), SIMDE_FLOAT64_C(  -980.57), SIMDE_FLOAT64_C(  -222.44),
+        SIMDE_FLOAT64_C(    16.58), SIMDE_FLOAT64_C(  -589.19), SIMDE_FLOAT64_C(  -752.08), SIMDE_FLOAT64_C(   309.52) },
+      SIMDE_FLOAT64_C(  -896.39) },
+    { UINT8_C(  216),
+      { SIMDE_FLOAT64_C(  -544.45), SIMDE_FLOAT64_C(  -987.61), SIMDE_FLOAT64_C(  -553.89), SIMDE_FLOAT64_C(  -334.39),
+        SIMDE_FLOAT64_C(   753.18), SIMDE_FLOAT64_C(   277.20), SIMDE_FLOAT64_C(  -155.54), SIMDE_FLOAT64_C(    -5.42) },
+      SIMDE_FLOAT64_C(  -334.39) },
+    { UINT8_C(   92),
+      { SIMDE_FLOAT64_C(  -408.52), SIMDE_FLOAT64_C(  -200.86), SIMDE_FLOAT64_C(   426.40), SIMDE_FLOAT64_C(  -931.51),
+        SIMDE_FLOAT64_C(   159.65), SIMDE_FLOAT64_C(  -793.16), SIMDE_FLOAT64_C(   913.82), SIMDE_FLOAT64_C(  -713.55) },
+      SIMDE_FLOAT64_C(  -931.51) },
+    { UINT8_C(  224),
+      { SIMDE_FLOAT64_C(   976.22), SIMDE_FLOAT64_C(  -846.05), SIMDE_FLOAT64_C(   853.65), SIMDE_FLOAT64_C(   422.14),
+        SIMDE_FLOAT64_C(   166.45), SIMDE_FLOAT64_C(   -26.05), SIMDE_FLOAT64_C(   923.91), SIMDE_FLOAT64_C(   982.43) },
+      SIMDE_FLOAT64_C(   -26.05) },
+    { UINT8_C(    7),
+      { SIMDE_FLOAT64_C(   639.02), SIMDE_FLOAT64_C(  -545.08), SIMDE_FLOAT64_C(   163.42), SIMDE_FLOAT64_C(  -236.70),
+        SIMDE_FLOAT64_C(   982.26), SIMDE_FLOAT64_C(   478.31), SIMDE_FLOAT64_C(   200.86), SIMDE_FLOAT64_C(   519.28) },
+      SIMDE_FLOAT64_C(  -545.08) },
+    { UINT8_C(   91),
+      { SIMDE_FLOAT64_C(   937.54), SIMDE_FLOAT64_C(  -541.10), SIMDE_FLOAT64_C(  -269.04), SIMDE_FLOAT64_C(  -741.70),
+        SIMDE_FLOAT64_C(   794.14), SIMDE_FLOAT64_C(  -150.50), SIMDE_FLOAT64_C(  -289.35), SIMDE_FLOAT64_C(   875.52) },
+      SIMDE_FLOAT64_C(  -741.70) },
+    { UINT8_C(   59),
+      { SIMDE_FLOAT64_C(   297.98), SIMDE_FLOAT64_C(  -589.80), SIMDE_FLOAT64_C(   625.37), SIMDE_FLOAT64_C(  -791.68),
+        SIMDE_FLOAT64_C(   359.65), SIMDE_FLOAT64_C(   547.23), SIMDE_FLOAT64_C(  -662.36), SIMDE_FLOAT64_C(   949.35) },
+      SIMDE_FLOAT64_C(  -791.68) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_min_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_and_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C( 4429),
+      {  INT32_C( 955618266),  INT32_C( 184768646), -INT32_C(1366740048), -INT32_C(1409186415),
+        -INT32_C( 592976779), -INT32_C(1534292223), -INT32_C(1736868721), -INT32_C(1304075055),
+        -INT32_C( 327296529),  INT32_C( 945276948), -INT32_C(1815623951), -INT32_C(1333636566),
+         INT32_C( 447127142),  INT32_C(1049632776),  INT32_C( 152659506), -INT32_C(1574786160) },
+      INT32_C( 134217728) },
+    { UINT16_C(40503),
+      {  INT32_C(1651837808),  INT32_C(1684949351),  INT32_C(2122534745), -INT32_C( 355620618),
+         INT32_C(1844990601),  INT32_C( 689430386), -INT32_C( 973403782), -INT32_C( 356466767),
+         INT32_C(1321975843),  INT32_C(1217272426),  INT32_C(1669736601), -INT32_C( 184634595),
+         INT32_C( 115879877),  INT32_C(1958682833),  INT32_C( 188612386),  INT32_C(1069429397) },
+      INT32_C(         0) },
+    { UINT16_C( 1281),
+      {  INT32_C(2142078352),  INT32_C(1544095092), -INT32_C(1627447855), -INT32_C( 657777101),
+         INT32_C(1397670051),  INT32_C(1146737042),  INT32_C( 532139857), -INT32_C(1373572616),
+         INT32_C( 349066916), -INT32_C(1287694248), -INT32_C( 833650069), -INT32_C(  20504140),
+         INT32_C( 294098023),  INT32_C( 564909725), -INT32_C( 583080903),  INT32_C(1240816959) },
+      INT32_C(  67895296) },
+    { UINT16_C(37528),
+      {  INT32_C(  44967071), -INT32_C( 941096755),  INT32_C(1021574952), -INT32_C( 736018697),
+         INT32_C(1794183897), -INT32_C( 903211641),  INT32_C(1455620287), -INT32_C( 319240413),
+        -INT32_C(1303140991), -INT32_C(1838480922), -INT32_C(1761139625),  INT32_C( 109238542),
+         INT32_C(2077239175),  INT32_C(1946731459),  INT32_C(1342742565),  INT32_C(1896255458) },
+      INT32_C(         0) },
+    { UINT16_C( 6849),
+      {  INT32_C( 370377998), -INT32_C(1508822859),  INT32_C( 864782899),  INT32_C( 170052520),
+        -INT32_C( 968944760), -INT32_C( 535338524),  INT32_C( 173410525), -INT32_C( 949470626),
+         INT32_C(1323938718), -INT32_C(1756601064),  INT32_C( 251275671), -INT32_C(1345146505),
+        -INT32_C( 351520084),  INT32_C(1181100957),  INT32_C(1063891464),  INT32_C( 276593171) },
+      INT32_C(  33554432) },
+    { UINT16_C(65105),
+      {  INT32_C( 379339975),  INT32_C(  53157331), -INT32_C( 427354541), -INT32_C( 525217298),
+        -INT32_C( 472580047),  INT32_C( 677810940),  INT32_C(1512605489), -INT32_C(1998027273),
+         INT32_C(1127386684), -INT32_C(1936185257),  INT32_C(1196470532), -INT32_C(1123308940),
+        -INT32_C( 638784614), -INT32_C(1666925366),  INT32_C(  16748485), -INT32_C( 958510486) },
+      INT32_C(         0) },
+    { UINT16_C(33195),
+      {  INT32_C(1436474176),  INT32_C( 117283080),  INT32_C(1306842101),  INT32_C(1285037975),
+        -INT32_C(1320569221),  INT32_C(1283284851),  INT32_C( 332478367),  INT32_C( 904485189),
+        -INT32_C(1037856961),  INT32_C(1561718028),  INT32_C( 973656094), -INT32_C( 348125442),
+         INT32_C( 296980454), -INT32_C(1297454090),  INT32_C( 830588805), -INT32_C(1791993312) },
+      INT32_C(      2048) },
+    { UINT16_C(28118),
+      {  INT32_C(2111700505),  INT32_C(1741355055),  INT32_C(1196960594), -INT32_C(1851320310),
+        -INT32_C(1954406782),  INT32_C( 490815855), -INT32_C(1549197576),  INT32_C(1544228047),
+        -INT32_C(1607629436), -INT32_C( 859817184), -INT32_C(1852263874), -INT32_C( 682324262),
+         INT32_C(1122256989), -INT32_C(1257255914), -INT32_C( 631153905), -INT32_C(2137947368) },
+      INT32_C(         0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_and_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_and_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  191),
+      { -INT64_C(7779051368933492844), -INT64_C(6178155233592648109),  INT64_C(5517747330860683977),  INT64_C(2847788045185607587),
+        -INT64_C(5203972716016541418), -INT64_C(6059466885337461897), -INT64_C(6441990016382583288), -INT64_C( 372695732588934578) },
+      INT64_C(     70368744177664) },
+    { UINT8_C(  224),
+      { -INT64_C(3954865218798090743),  INT64_C(9159883246929375673), -INT64_C(2486003289103757864), -INT64_C(8989146766933282542),
+        -INT64_C(3516398807649025182), -INT64_C(5503732009278106947), -INT64_C( 419573020231900496), -INT64_C(6030268091297640209) },
+      -INT64_C(6917529008313728864) },
+    { UINT8_C(  224),
+      {  INT64_C(7252301987083947669),  INT64_C(6360258783683689786),  INT64_C(7288060267261349403), -INT64_C(9062741286657281905),
+        -INT64_C(1421781905079188842), -INT64_C(4467679890123963085),  INT64_C(6649312555032262536),  INT64_C(6286645132807867808) },
+      INT64_C(4613374868304430336) },
+    { UINT8_C(    6),
+      { -INT64_C(2958733996659877888), -INT64_C(3360881707067620648), -INT64_C(2016305312300305685), -INT64_C(6834124908241915767),
+        -INT64_C(2467035463206628575), -INT64_C(8883196975186849711),  INT64_C(3534186288764523862), -INT64_C(8573314882355141216) },
+      -INT64_C(4611504597867937080) },
+    { UINT8_C(  143),
+      {  INT64_C( 405457212538111063), -INT64_C(6403845580988640812), -INT64_C(7586552009191315007),  INT64_C(7104051500168364228),
+        -INT64_C(4448481277691386060), -INT64_C(2973076767218268642),  INT64_C(6032227807534100778),  INT64_C(4141992123801878033) },
+      INT64_C(                  0) },
+    { UINT8_C(  157),
+      { -INT64_C(6967152849355318023),  INT64_C(  80404954875526845), -INT64_C(8164801665644011688),  INT64_C( 958315198666682790),
+         INT64_C(2757181787916901026), -INT64_C(2950190178343664384),  INT64_C(7530842831859740191), -INT64_C(8879795130133859345) },
+      INT64_C( 288230376151715840) },
+    { UINT8_C(  104),
+      {  INT64_C(4630187238528038806),  INT64_C(7507227145057971487), -INT64_C(1191228905850567035),  INT64_C(8596913161604399532),
+         INT64_C(  59054500807445099),  INT64_C(9179884995528424594), -INT64_C(6013062881510316979),  INT64_C(1701902492893558986) },
+      INT64_C(2595199285276999680) },
+    { UINT8_C(   19),
+      { -INT64_C(3973408066810905128),  INT64_C(7617371353901964560),  INT64_C(5179213455506343708), -INT64_C(2888163649401456322),
+        -INT64_C(4716517177752553403),  INT64_C(4102677205863431350), -INT64_C(7066418335679920332),  INT64_C(5310633430619901076) },
+      INT64_C( 613070091495413760) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_and_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_or_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(52748),
+      {  INT32_C(1147602829),  INT32_C( 371330873),  INT32_C( 969265570),  INT32_C( 781744750),
+         INT32_C(1804945822), -INT32_C(1403384963), -INT32_C(1039507308),  INT32_C( 641502096),
+        -INT32_C(1972366627), -INT32_C(1800641444),  INT32_C( 161192052),  INT32_C( 320969937),
+         INT32_C(1057401013),  INT32_C( 330528133), -INT32_C( 190974365), -INT32_C(1913802796) },
+      -INT32_C(         1) },
+    { UINT16_C(45796),
+      { -INT32_C(1059494710),  INT32_C(1003963851),  INT32_C( 885994561), -INT32_C( 107356322),
+         INT32_C(1141155478), -INT32_C(1592483065),  INT32_C(1060367089),  INT32_C(2132656012),
+        -INT32_C(1512966240),  INT32_C(1392788495),  INT32_C( 353441326), -INT32_C( 532982121),
+        -INT32_C(2141225243),  INT32_C(1283665881), -INT32_C(1368577529),  INT32_C( 702563365) },
+      -INT32_C(         1) },
+    { UINT16_C(57293),
+      {  INT32_C(2013462631), -INT32_C( 425109334),  INT32_C(1261779592),  INT32_C( 187720025),
+         INT32_C( 812877607), -INT32_C( 922278281),  INT32_C(  65481190), -INT32_C(  16066921),
+        -INT32_C(1837810522),  INT32_C( 321934616),  INT32_C( 943160199),  INT32_C(1004855616),
+         INT32_C(1352455209), -INT32_C(1498631993), -INT32_C(1834843072), -INT32_C( 317741939) },
+      -INT32_C(         1) },
+    { UINT16_C(25162),
+      { -INT32_C(1623298841),  INT32_C( 976423490), -INT32_C(1809087705), -INT32_C( 746392669),
+        -INT32_C( 614106481), -INT32_C(1678795171),  INT32_C( 944931418),  INT32_C(  42264243),
+        -INT32_C( 574340555), -INT32_C( 541181946), -INT32_C( 621583735), -INT32_C(1894113864),
+         INT32_C( 273500882), -INT32_C( 863933967), -INT32_C( 190657920),  INT32_C( 656419711) },
+      -INT32_C(      1025) },
+    { UINT16_C(61107),
+      {  INT32_C(  48097507),  INT32_C(1666641641), -INT32_C( 289555730), -INT32_C(1758641412),
+         INT32_C( 116981017),  INT32_C( 530504507), -INT32_C(1357262288), -INT32_C(1821153736),
+         INT32_C(1399696592),  INT32_C( 872762633), -INT32_C( 408901106), -INT32_C(1266060450),
+         INT32_C(1291256835),  INT32_C(1312856114),  INT32_C(1050397974),  INT32_C(1524398605) },
+      -INT32_C(         1) },
+    { UINT16_C(56018),
+      { -INT32_C(1725332793),  INT32_C( 746551671),  INT32_C(1872167950), -INT32_C(1661632712),
+        -INT32_C(2097690038), -INT32_C(2104361919),  INT32_C( 992582473),  INT32_C( 489533535),
+         INT32_C(1498748049),  INT32_C(1981956131), -INT32_C( 176784508),  INT32_C(1650043255),
+        -INT32_C( 236541543),  INT32_C( 992571296),  INT32_C(2037691951),  INT32_C(1981430258) },
+      -INT32_C(         1) },
+    { UINT16_C(58515),
+      { -INT32_C( 810791515),  INT32_C( 494135193), -INT32_C( 286407954),  INT32_C(1496421233),
+        -INT32_C(1262265713), -INT32_C(1376793616),  INT32_C(1220202434), -INT32_C( 628219117),
+        -INT32_C(1725981238), -INT32_C( 252966832),  INT32_C(1784339607), -INT32_C( 543596726),
+         INT32_C( 193659282), -INT32_C(1038892336),  INT32_C( 847545141), -INT32_C(1511437642) },
+      -INT32_C(         1) },
+    { UINT16_C(11872),
+      {  INT32_C(1138690742),  INT32_C( 760402108),  INT32_C(1943913398),  INT32_C(1127006217),
+        -INT32_C(1577374515),  INT32_C( 771396287), -INT32_C( 760885516),  INT32_C(1047854456),
+        -INT32_C( 840843486),  INT32_C( 739708437), -INT32_C( 625516782),  INT32_C( 740618854),
+        -INT32_C(1065828684), -INT32_C(1027717632), -INT32_C(  86626868),  INT32_C(1097220141) },
+      -INT32_C(         1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_or_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_or_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(  132),
+      { -INT64_C(3855139676186699007), -INT64_C(6375051812172242919), -INT64_C(6483845495382037186),  INT64_C(1816785425188529483),
+         INT64_C(5632786156139262360), -INT64_C(4206889597411068323),  INT64_C(8165293133099660449), -INT64_C(4735151124734480173) },
+      -INT64_C(4733883541891514881) },
+    { UINT8_C(  244),
+      { -INT64_C(3342397489347301861),  INT64_C(5340050180789516027),  INT64_C(4956282094614470659),  INT64_C(8625745945991919379),
+        -INT64_C(5303113933938101763),  INT64_C(7353288796578356999),  INT64_C(6693873841231359778),  INT64_C(2336689535039608796) },
+      -INT64_C(  76561193665298433) },
+    { UINT8_C(  231),
+      {  INT64_C( 205287088766929342), -INT64_C(3471709890409803635),  INT64_C(4959205416401494213), -INT64_C(8040076059591149291),
+        -INT64_C(8294968192550034217),  INT64_C(1867022657568542715),  INT64_C( 874357091059420839),  INT64_C(6916007419910857690) },
+      -INT64_C(2306969183998443521) },
+    { UINT8_C(    5),
+      { -INT64_C(8978363195402239512),  INT64_C(8821214163210587041), -INT64_C(1224955410448542196), -INT64_C(5977772765494756986),
+        -INT64_C( 833964331534285759),  INT64_C( 869868715923851200), -INT64_C(8463638917289705153),  INT64_C( 630795770863589251) },
+      -INT64_C(1196136987327735828) },
+    { UINT8_C(  233),
+      {  INT64_C(1780332794190957135),  INT64_C( 291381241967336411), -INT64_C(1708070610692058529), -INT64_C(5941406764367696590),
+        -INT64_C(5880051907657464843), -INT64_C(6962971982845268765),  INT64_C(3000039759275179766), -INT64_C(4374598633824692739) },
+      -INT64_C(     17592186044417) },
+    { UINT8_C(   54),
+      { -INT64_C(2779675171337443087),  INT64_C(4558610062616349000), -INT64_C(2437803784896757361), -INT64_C(2046637576663626234),
+        -INT64_C(5280539065266892375),  INT64_C(8408916514919251317), -INT64_C(4700332571339905709), -INT64_C(8967629695774203437) },
+      -INT64_C(         1140982273) },
+    { UINT8_C(   46),
+      {  INT64_C(4343461611318273264),  INT64_C(8671064301835797575),  INT64_C(1700444542969713233),  INT64_C(8851444208100325603),
+         INT64_C(3567672551409610541),  INT64_C(9151951557340307307), -INT64_C(3639775994977770784),  INT64_C(3803940621531364829) },
+      INT64_C(9214364837599936511) },
+    { UINT8_C(  172),
+      { -INT64_C(3315354129422013003), -INT64_C( 812980972374402231), -INT64_C(2098457871491884023), -INT64_C( 498207744361030360),
+         INT64_C(6630142327909207181),  INT64_C( 567937171868453319), -INT64_C(2365505243974908512),  INT64_C(7373146122421221177) },
+      -INT64_C(   2251801961185281) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_or_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    68.50), SIMDE_FLOAT16_VALUE(   -77.25), SIMDE_FLOAT16_VALUE(   -18.69), SIMDE_FLOAT16_VALUE(    98.56),
+        SIMDE_FLOAT16_VALUE(   -39.59), SIMDE_FLOAT16_VALUE(   -17.03), SIMDE_FLOAT16_VALUE(    10.42), SIMDE_FLOAT16_VALUE(    12.79),
+        SIMDE_FLOAT16_VALUE(    35.59), SIMDE_FLOAT16_VALUE(   -78.25), SIMDE_FLOAT16_VALUE(    85.44), SIMDE_FLOAT16_VALUE(    49.78),
+        SIMDE_FLOAT16_VALUE(    56.03), SIMDE_FLOAT16_VALUE(   -67.56), SIMDE_FLOAT16_VALUE(   -66.81), SIMDE_FLOAT16_VALUE(   -71.81),
+        SIMDE_FLOAT16_VALUE(   -86.19), SIMDE_FLOAT16_VALUE(   -54.88), SIMDE_FLOAT16_VALUE(    58.84), SIMDE_FLOAT16_VALUE(   -22.83),
+        SIMDE_FLOAT16_VALUE(    99.12), SIMDE_FLOAT16_VALUE(   -47.78), SIMDE_FLOAT16_VALUE(   -88.62), SIMDE_FLOAT16_VALUE(   -55.62),
+        SIMDE_FLOAT16_VALUE(   -91.62), SIMDE_FLOAT16_VALUE(   -64.50), SIMDE_FLOAT16_VALUE(    59.34), SIMDE_FLOAT16_VALUE(   -24.73),
+        SIMDE_FLOAT16_VALUE(   -92.62), SIMDE_FLOAT16_VALUE(    69.38), SIMDE_FLOAT16_VALUE(   -10.63), SIMDE_FLOAT16_VALUE(   -76.88) },
+      SIMDE_FLOAT16_VALUE(  -450.25) },
+    { { SIMDE_FLOAT16_VALUE(    -1.60), SIMDE_FLOAT16_VALUE(     1.90), SIMDE_FLOAT16_VALUE(    -1.39), SIMDE_FLOAT16_VALUE(    -0.78),
+        SIMDE_FLOAT16_VALUE(     6.38), SIMDE_FLOAT16_VALUE(     4.68), SIMDE_FLOAT16_VALUE(     4.39), SIMDE_FLOAT16_VALUE(    -6.77),
+        SIMDE_FLOAT16_VALUE(    -3.89), SIMDE_FLOAT16_VALUE(    -2.10), SIMDE_FLOAT16_VALUE(    -6.19), SIMDE_FLOAT16_VALUE(     8.76),
+        SIMDE_FLOAT16_VALUE(     2.72), SIMDE_FLOAT16_VALUE(     7.03), SIMDE_FLOAT16_VALUE(    -9.08), SIMDE_FLOAT16_VALUE(     2.24),
+        SIMDE_FLOAT16_VALUE(    -9.43), SIMDE_FLOAT16_VALUE(    -4.87), SIMDE_FLOAT16_VALUE(    -7.99), SIMDE_FLOAT16_VALUE(     9.74),
+        SIMDE_FLOAT16_VALUE(    -2.95), SIMDE_FLOAT16_VALUE(    -8.99), SIMDE_FLOAT16_VALUE(     7.87), SIMDE_FLOAT16_VALUE(     8.34),
+        SIMDE_FLOAT16_VALUE(     8.86), SIMDE_FLOAT16_VALUE(     0.32), SIMDE_FLOAT16_VALUE(     1.84), SIMDE_FLOAT16_VALUE(     2.81),
+        SIMDE_FLOAT16_VALUE(    -1.04), SIMDE_FLOAT16_VALUE(    -2.59), SIMDE_FLOAT16_VALUE(    -3.19), SIMDE_FLOAT16_VALUE(     6.91) },
+      SIMDE_FLOAT16_VALUE(   11.945) },
+    { { SIMDE_FLOAT16_VALUE(   -93.19), SIMDE_FLOAT16_VALUE(    49.62), SIMDE_FLOAT16_VALUE(    43.84), SIMDE_FLOAT16_VALUE(    16.59),
+        SIMDE_FLOAT16_VALUE(   -95.31), SIMDE_FLOAT16_VALUE(   -38.72), SIMDE_FLOAT16_VALUE(   -19.31), SIMDE_FLOAT16_VALUE(    84.81),
+        SIMDE_FLOAT16_VALUE(   -68.00), SIMDE_FLOAT16_VALUE(   -24.12), SIMDE_FLOAT16_VALUE(   -84.56), SIMDE_FLOAT16_VALUE(    82.50),
+        SIMDE_FLOAT16_VALUE(   -79.31), SIMDE_FLOAT16_VALUE(    37.09), SIMDE_FLOAT16_VALUE(   -45.22), SIMDE_FLOAT16_VALUE(    43.66),
+        SIMDE_FLOAT16_VALUE(    93.25), SIMDE_FLOAT16_VALUE(    91.75), SIMDE_FLOAT16_VALUE(    23.41), SIMDE_FLOAT16_VALUE(    49.34),
+        SIMDE_FLOAT16_VALUE(   -94.19), SIMDE_FLOAT16_VALUE(    55.09), SIMDE_FLOAT16_VALUE(   -25.66), SIMDE_FLOAT16_VALUE(    18.06),
+        SIMDE_FLOAT16_VALUE(   -89.56), SIMDE_FLOAT16_VALUE(    39.09), SIMDE_FLOAT16_VALUE(    49.75), SIMDE_FLOAT16_VALUE(   -18.69),
+        SIMDE_FLOAT16_VALUE(    27.19), SIMDE_FLOAT16_VALUE(     4.52), SIMDE_FLOAT16_VALUE(   -29.84), SIMDE_FLOAT16_VALUE(   -69.25) },
+      SIMDE_FLOAT16_VALUE(   -65.00) },
+    { { SIMDE_FLOAT16_VALUE(    -1.59), SIMDE_FLOAT16_VALUE(    -9.60), SIMDE_FLOAT16_VALUE(     8.20), SIMDE_FLOAT16_VALUE(     8.41),
+        SIMDE_FLOAT16_VALUE(    -7.22), SIMDE_FLOAT16_VALUE(    -7.28), SIMDE_FLOAT16_VALUE(     9.20), SIMDE_FLOAT16_VALUE(     2.95),
+        SIMDE_FLOAT16_VALUE(    -4.32), SIMDE_FLOAT16_VALUE(     0.38), SIMDE_FLOAT16_VALUE(    -7.28), SIMDE_FLOAT16_VALUE(     7.98),
+        SIMDE_FLOAT16_VALUE(     1.50), SIMDE_FLOAT16_VALUE(    -4.05), SIMDE_FLOAT16_VALUE(    -9.74), SIMDE_FLOAT16_VALUE(    -8.32),
+        SIMDE_FLOAT16_VALUE(    -6.87), SIMDE_FLOAT16_VALUE(     4.01), SIMDE_FLOAT16_VALUE(     3.04), SIMDE_FLOAT16_VALUE(     0.51),
+        SIMDE_FLOAT16_VALUE(     4.96), SIMDE_FLOAT16_VALUE(     7.28), SIMDE_FLOAT16_VALUE(    -0.68), SIMDE_FLOAT16_VALUE(    -4.84),
+        SIMDE_FLOAT16_VALUE(     0.24), SIMDE_FLOAT16_VALUE(    -4.79), SIMDE_FLOAT16_VALUE(     5.23), SIMDE_FLOAT16_VALUE(     6.36),
+        SIMDE_FLOAT16_VALUE(    -0.46), SIMDE_FLOAT16_VALUE(     8.86), SIMDE_FLOAT16_VALUE(    -1.99), SIMDE_FLOAT16_VALUE(     7.24) },
+      SIMDE_FLOAT16_VALUE(    7.305) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde_float16 r = simde_mm512_reduce_add_ph(a);
+    simde_assert_equal_f16(r, test_vec[i].r, 2);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_and_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_and_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_or_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_or_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_and_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_and_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_or_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_or_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_ph)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
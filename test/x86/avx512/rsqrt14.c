@@ -0,0 +1,1185 @@
+#define SIMDE_TEST_X86_AVX512_INSN rsqrt14
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/rsqrt14.h>
+
+/* vrsqrt14ps has a maximum relative error of 2^-14. */
+static int
+simde_test_rsqrt14_ps_within_bound(simde_float32 a, simde_float32 r) {
+  const simde_float64 e = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(HEDLEY_STATIC_CAST(simde_float64, a));
+  if (simde_math_isnan(e))
+    return simde_math_isnan(r);
+  if (simde_math_isinf(e))
+    return !((r < e) || (r > e));
+  return simde_math_fabs(HEDLEY_STATIC_CAST(simde_float64, r) - e) <= simde_math_fabs(e) * SIMDE_FLOAT64_C(0.00006103515625);
+}
+
+static const simde_float32 simde_test_rsqrt14_ps_bound_inputs[] = {
+  SIMDE_FLOAT32_C(1.0), SIMDE_FLOAT32_C(1.5), SIMDE_FLOAT32_C(3.0), SIMDE_FLOAT32_C(7.0),
+  SIMDE_FLOAT32_C(0.1), SIMDE_FLOAT32_C(1234.5), SIMDE_FLOAT32_C(0.0003), SIMDE_FLOAT32_C(65504.0),
+  SIMDE_FLOAT32_C(1.0e-30), SIMDE_FLOAT32_C(2.5e20), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(3.0e38),
+  SIMDE_FLOAT32_C(2.0), SIMDE_FLOAT32_C(3.402823466e38), SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(1.99999988),
+  #if !defined(SIMDE_FAST_MATH)
+  SIMDE_FLOAT32_C(5.877471754e-39), SIMDE_FLOAT32_C(-5.877471754e-39), SIMDE_FLOAT32_C(2.938735877e-39), SIMDE_FLOAT32_C(1.0e-39),
+  SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(1.401298464e-45), SIMDE_FLOAT32_C(-1.401298464e-45), SIMDE_FLOAT32_C(1.0e-38),
+  SIMDE_FLOAT32_C(0.0), SIMDE_FLOAT32_C(-0.0), SIMDE_MATH_INFINITYF, -SIMDE_MATH_INFINITYF,
+  SIMDE_MATH_NANF, SIMDE_FLOAT32_C(3.000000646e-39), SIMDE_FLOAT32_C(-1.0), SIMDE_FLOAT32_C(1.175494211e-38)
+  #endif
+};
+
+static int
+test_simde_mm_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(2.938735877e-39), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(-0.0), SIMDE_FLOAT32_C(-1.0e-39) },
+      { SIMDE_FLOAT32_C(18446744073709551616.0), SIMDE_FLOAT32_C(9223372036854775808.0), -SIMDE_MATH_INFINITYF, SIMDE_MATH_NANF } },
+    #endif
+    { { SIMDE_FLOAT32_C(  80.20), SIMDE_FLOAT32_C( 972.59), SIMDE_FLOAT32_C( 482.45), SIMDE_FLOAT32_C( 170.43) },
+      { SIMDE_FLOAT32_C(   0.111663), SIMDE_FLOAT32_C(   0.032065), SIMDE_FLOAT32_C(   0.045528), SIMDE_FLOAT32_C(   0.076601) } },
+    { { SIMDE_FLOAT32_C(  26.26), SIMDE_FLOAT32_C( 582.86), SIMDE_FLOAT32_C( 982.41), SIMDE_FLOAT32_C( 733.14) },
+      { SIMDE_FLOAT32_C(   0.195147), SIMDE_FLOAT32_C(   0.041422), SIMDE_FLOAT32_C(   0.031905), SIMDE_FLOAT32_C(   0.036932) } },
+    { { SIMDE_FLOAT32_C( 527.57), SIMDE_FLOAT32_C( 630.49), SIMDE_FLOAT32_C( 670.75), SIMDE_FLOAT32_C( 842.18) },
+      { SIMDE_FLOAT32_C(   0.043536), SIMDE_FLOAT32_C(   0.039827), SIMDE_FLOAT32_C(   0.038611), SIMDE_FLOAT32_C(   0.034459) } },
+    { { SIMDE_FLOAT32_C( 615.70), SIMDE_FLOAT32_C( 350.74), SIMDE_FLOAT32_C( 767.91), SIMDE_FLOAT32_C( 110.12) },
+      { SIMDE_FLOAT32_C(   0.040302), SIMDE_FLOAT32_C(   0.053396), SIMDE_FLOAT32_C(   0.036086), SIMDE_FLOAT32_C(   0.095294) } },
+    { { SIMDE_FLOAT32_C(  17.38), SIMDE_FLOAT32_C( 216.63), SIMDE_FLOAT32_C( 777.09), SIMDE_FLOAT32_C( 378.57) },
+      { SIMDE_FLOAT32_C(   0.239872), SIMDE_FLOAT32_C(   0.067942), SIMDE_FLOAT32_C(   0.035873), SIMDE_FLOAT32_C(   0.051397) } },
+    { { SIMDE_FLOAT32_C( 800.65), SIMDE_FLOAT32_C( 831.22), SIMDE_FLOAT32_C(  18.01), SIMDE_FLOAT32_C( 320.51) },
+      { SIMDE_FLOAT32_C(   0.035340), SIMDE_FLOAT32_C(   0.034684), SIMDE_FLOAT32_C(   0.235630), SIMDE_FLOAT32_C(   0.055856) } },
+    { { SIMDE_FLOAT32_C( 878.08), SIMDE_FLOAT32_C( 386.71), SIMDE_FLOAT32_C( 111.64), SIMDE_FLOAT32_C( 448.23) },
+      { SIMDE_FLOAT32_C(   0.033747), SIMDE_FLOAT32_C(   0.050853), SIMDE_FLOAT32_C(   0.094643), SIMDE_FLOAT32_C(   0.047233) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_rsqrt14_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rsqrt14_ps_bound (SIMDE_MUNIT_TEST_ARGS) {
+  const simde_float32* inputs = simde_test_rsqrt14_ps_bound_inputs;
+  simde_float32 r[4];
+
+  for (size_t i = 0 ; i < (sizeof(simde_test_rsqrt14_ps_bound_inputs) / sizeof(simde_test_rsqrt14_ps_bound_inputs[0])) ; i += 4) {
+    simde_mm_storeu_ps(r, simde_mm_rsqrt14_ps(simde_mm_loadu_ps(&(inputs[i]))));
+    for (size_t j = 0 ; j < 4 ; j++) {
+      simde_assert_equal_i(simde_test_rsqrt14_ps_within_bound(inputs[i + j], r[j]), 1);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(-813.00), SIMDE_FLOAT32_C(-120.08), SIMDE_FLOAT32_C(-509.76), SIMDE_FLOAT32_C( 822.33) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(-813.00), SIMDE_FLOAT32_C(-120.08), SIMDE_FLOAT32_C(-509.76),            SIMDE_MATH_NANF } },
+    #endif
+    { { SIMDE_FLOAT32_C( 958.18), SIMDE_FLOAT32_C(-780.39), SIMDE_FLOAT32_C(-353.62), SIMDE_FLOAT32_C(-948.96) },
+      UINT8_C(   11),
+      { SIMDE_FLOAT32_C( 542.45), SIMDE_FLOAT32_C( 504.06), SIMDE_FLOAT32_C( 579.15), SIMDE_FLOAT32_C( 343.82) },
+      { SIMDE_FLOAT32_C(   0.042936), SIMDE_FLOAT32_C(   0.044541), SIMDE_FLOAT32_C(-353.62), SIMDE_FLOAT32_C(   0.053930) } },
+    { { SIMDE_FLOAT32_C(-121.17), SIMDE_FLOAT32_C( 778.80), SIMDE_FLOAT32_C( 196.24), SIMDE_FLOAT32_C( 921.69) },
+      UINT8_C(    4),
+      { SIMDE_FLOAT32_C( 936.51), SIMDE_FLOAT32_C( 463.98), SIMDE_FLOAT32_C( 331.54), SIMDE_FLOAT32_C( 134.01) },
+      { SIMDE_FLOAT32_C(-121.17), SIMDE_FLOAT32_C( 778.80), SIMDE_FLOAT32_C(   0.054922), SIMDE_FLOAT32_C( 921.69) } },
+    { { SIMDE_FLOAT32_C( 192.98), SIMDE_FLOAT32_C( 668.97), SIMDE_FLOAT32_C( -84.26), SIMDE_FLOAT32_C(-769.87) },
+      UINT8_C(   13),
+      { SIMDE_FLOAT32_C( 638.11), SIMDE_FLOAT32_C( 508.06), SIMDE_FLOAT32_C( 748.10), SIMDE_FLOAT32_C( 838.55) },
+      { SIMDE_FLOAT32_C(   0.039587), SIMDE_FLOAT32_C( 668.97), SIMDE_FLOAT32_C(   0.036561), SIMDE_FLOAT32_C(   0.034534) } },
+    { { SIMDE_FLOAT32_C(-694.00), SIMDE_FLOAT32_C(  98.47), SIMDE_FLOAT32_C( 560.08), SIMDE_FLOAT32_C(-386.00) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT32_C( 968.10), SIMDE_FLOAT32_C( 334.98), SIMDE_FLOAT32_C( 493.70), SIMDE_FLOAT32_C(  79.06) },
+      { SIMDE_FLOAT32_C(   0.032140), SIMDE_FLOAT32_C(   0.054637), SIMDE_FLOAT32_C( 560.08), SIMDE_FLOAT32_C(-386.00) } },
+    { { SIMDE_FLOAT32_C( 725.39), SIMDE_FLOAT32_C(-400.03), SIMDE_FLOAT32_C(-752.55), SIMDE_FLOAT32_C(-145.37) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT32_C( 828.13), SIMDE_FLOAT32_C( 182.20), SIMDE_FLOAT32_C(   4.47), SIMDE_FLOAT32_C( 130.68) },
+      { SIMDE_FLOAT32_C(   0.034750), SIMDE_FLOAT32_C(   0.074085), SIMDE_FLOAT32_C(   0.472988), SIMDE_FLOAT32_C(   0.087480) } },
+    { { SIMDE_FLOAT32_C(-981.33), SIMDE_FLOAT32_C(-692.83), SIMDE_FLOAT32_C( 278.95), SIMDE_FLOAT32_C(-891.88) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT32_C( 976.56), SIMDE_FLOAT32_C( 347.63), SIMDE_FLOAT32_C(  53.88), SIMDE_FLOAT32_C( 831.20) },
+      { SIMDE_FLOAT32_C(   0.032000), SIMDE_FLOAT32_C(-692.83), SIMDE_FLOAT32_C( 278.95), SIMDE_FLOAT32_C(-891.88) } },
+    { { SIMDE_FLOAT32_C( 329.46), SIMDE_FLOAT32_C( 295.81), SIMDE_FLOAT32_C( 638.13), SIMDE_FLOAT32_C( 708.57) },
+      UINT8_C(   12),
+      { SIMDE_FLOAT32_C(  53.65), SIMDE_FLOAT32_C( 120.40), SIMDE_FLOAT32_C( 962.53), SIMDE_FLOAT32_C( 267.56) },
+      { SIMDE_FLOAT32_C( 329.46), SIMDE_FLOAT32_C( 295.81), SIMDE_FLOAT32_C(   0.032233), SIMDE_FLOAT32_C(   0.061138) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_rsqrt14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(   12),
+      { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF } },
+    #endif
+    { UINT8_C(    3),
+      { SIMDE_FLOAT32_C( 656.41), SIMDE_FLOAT32_C( 764.94), SIMDE_FLOAT32_C( 909.40), SIMDE_FLOAT32_C( 360.70) },
+      { SIMDE_FLOAT32_C(   0.039031), SIMDE_FLOAT32_C(   0.036157), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT32_C( 710.88), SIMDE_FLOAT32_C( 981.57), SIMDE_FLOAT32_C( 218.41), SIMDE_FLOAT32_C( 985.79) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.031919), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    9),
+      { SIMDE_FLOAT32_C( 467.31), SIMDE_FLOAT32_C( 536.99), SIMDE_FLOAT32_C(  19.86), SIMDE_FLOAT32_C( 388.75) },
+      { SIMDE_FLOAT32_C(   0.046260), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.050719) } },
+    { UINT8_C(    4),
+      { SIMDE_FLOAT32_C( 434.72), SIMDE_FLOAT32_C( 592.59), SIMDE_FLOAT32_C( 493.56), SIMDE_FLOAT32_C( 661.57) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.045012), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(   10),
+      { SIMDE_FLOAT32_C(  56.85), SIMDE_FLOAT32_C( 986.78), SIMDE_FLOAT32_C( 998.80), SIMDE_FLOAT32_C( 392.62) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.031835), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.050467) } },
+    { UINT8_C(    4),
+      { SIMDE_FLOAT32_C( 528.91), SIMDE_FLOAT32_C( 179.17), SIMDE_FLOAT32_C(  94.47), SIMDE_FLOAT32_C( 287.25) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.102886), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT32_C( 582.37), SIMDE_FLOAT32_C( 618.30), SIMDE_FLOAT32_C(  15.91), SIMDE_FLOAT32_C( 863.10) },
+      { SIMDE_FLOAT32_C(   0.041440), SIMDE_FLOAT32_C(   0.040217), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_rsqrt14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY },
+      {        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C( 481.26), SIMDE_FLOAT64_C( 888.34) },
+      { SIMDE_FLOAT64_C(   0.045584), SIMDE_FLOAT64_C(   0.033552) } },
+    { { SIMDE_FLOAT64_C( 380.07), SIMDE_FLOAT64_C( 350.74) },
+      { SIMDE_FLOAT64_C(   0.051295), SIMDE_FLOAT64_C(   0.053396) } },
+    { { SIMDE_FLOAT64_C( 509.22), SIMDE_FLOAT64_C(  19.28) },
+      { SIMDE_FLOAT64_C(   0.044315), SIMDE_FLOAT64_C(   0.227751) } },
+    { { SIMDE_FLOAT64_C( 676.14), SIMDE_FLOAT64_C( 378.81) },
+      { SIMDE_FLOAT64_C(   0.038458), SIMDE_FLOAT64_C(   0.051381) } },
+    { { SIMDE_FLOAT64_C( 562.34), SIMDE_FLOAT64_C(  50.30) },
+      { SIMDE_FLOAT64_C(   0.042170), SIMDE_FLOAT64_C(   0.140999) } },
+    { { SIMDE_FLOAT64_C( 419.73), SIMDE_FLOAT64_C( 241.35) },
+      { SIMDE_FLOAT64_C(   0.048811), SIMDE_FLOAT64_C(   0.064370) } },
+    { { SIMDE_FLOAT64_C( 381.60), SIMDE_FLOAT64_C( 395.36) },
+      { SIMDE_FLOAT64_C(   0.051192), SIMDE_FLOAT64_C(   0.050293) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_rsqrt14_pd(a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 885.91), SIMDE_FLOAT64_C(-312.53) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C( 885.91), SIMDE_FLOAT64_C(-312.53) } },
+    #endif
+    { { SIMDE_FLOAT64_C( 702.15), SIMDE_FLOAT64_C( 835.45) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C( 642.57), SIMDE_FLOAT64_C( 121.71) },
+      { SIMDE_FLOAT64_C( 702.15), SIMDE_FLOAT64_C( 835.45) } },
+    { { SIMDE_FLOAT64_C(-990.18), SIMDE_FLOAT64_C( 332.11) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C( 705.16), SIMDE_FLOAT64_C( 262.09) },
+      { SIMDE_FLOAT64_C(-990.18), SIMDE_FLOAT64_C( 332.11) } },
+    { { SIMDE_FLOAT64_C( -15.31), SIMDE_FLOAT64_C(-128.24) },
+      UINT8_C(    0),
+      { SIMDE_FLOAT64_C( 380.62), SIMDE_FLOAT64_C( 303.41) },
+      { SIMDE_FLOAT64_C( -15.31), SIMDE_FLOAT64_C(-128.24) } },
+    { { SIMDE_FLOAT64_C(-430.35), SIMDE_FLOAT64_C( 124.10) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 610.91), SIMDE_FLOAT64_C( 735.35) },
+      { SIMDE_FLOAT64_C(   0.040459), SIMDE_FLOAT64_C(   0.036876) } },
+    { { SIMDE_FLOAT64_C(-565.78), SIMDE_FLOAT64_C(-570.09) },
+      UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 369.92), SIMDE_FLOAT64_C( 159.51) },
+      { SIMDE_FLOAT64_C(-565.78), SIMDE_FLOAT64_C(   0.079179) } },
+    { { SIMDE_FLOAT64_C(  62.33), SIMDE_FLOAT64_C(-153.78) },
+      UINT8_C(    1),
+      { SIMDE_FLOAT64_C(  80.09), SIMDE_FLOAT64_C( 557.46) },
+      { SIMDE_FLOAT64_C(   0.111737), SIMDE_FLOAT64_C(-153.78) } },
+    { { SIMDE_FLOAT64_C(  12.96), SIMDE_FLOAT64_C(-464.75) },
+      UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 678.28), SIMDE_FLOAT64_C( 549.46) },
+      { SIMDE_FLOAT64_C(   0.038398), SIMDE_FLOAT64_C(   0.042662) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_rsqrt14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY },
+      {        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00) } },
+    #endif
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 822.49), SIMDE_FLOAT64_C( 417.62) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.048934) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 377.54), SIMDE_FLOAT64_C( 358.34) },
+      { SIMDE_FLOAT64_C(   0.051466), SIMDE_FLOAT64_C(   0.052827) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 507.57), SIMDE_FLOAT64_C( 704.36) },
+      { SIMDE_FLOAT64_C(   0.044387), SIMDE_FLOAT64_C(   0.037678) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 394.01), SIMDE_FLOAT64_C( 608.80) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.040528) } },
+    { UINT8_C(    1),
+      { SIMDE_FLOAT64_C( 288.21), SIMDE_FLOAT64_C( 835.18) },
+      { SIMDE_FLOAT64_C(   0.058903), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C(  24.55), SIMDE_FLOAT64_C( 497.49) },
+      { SIMDE_FLOAT64_C(   0.201824), SIMDE_FLOAT64_C(   0.044834) } },
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C( 729.02), SIMDE_FLOAT64_C( 396.06) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.050249) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_rsqrt14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   0.50),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   2.00), SIMDE_FLOAT32_C(   1.00) } },
+    { { SIMDE_FLOAT32_C(2.938735877e-39), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(-0.0), SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(4.0), SIMDE_FLOAT32_C(0.0), SIMDE_FLOAT32_C(-1.401298464e-45) },
+      { SIMDE_FLOAT32_C(18446744073709551616.0), SIMDE_FLOAT32_C(9223372036854775808.0), -SIMDE_MATH_INFINITYF, SIMDE_MATH_NANF, SIMDE_FLOAT32_C(1.084202172e-19), SIMDE_FLOAT32_C(0.5), SIMDE_MATH_INFINITYF, SIMDE_MATH_NANF } },
+    #endif
+    { { SIMDE_FLOAT32_C( 303.46), SIMDE_FLOAT32_C( 291.63), SIMDE_FLOAT32_C( 108.62), SIMDE_FLOAT32_C( 281.31),
+        SIMDE_FLOAT32_C( 958.03), SIMDE_FLOAT32_C( 717.38), SIMDE_FLOAT32_C( 662.20), SIMDE_FLOAT32_C( 584.10) },
+      { SIMDE_FLOAT32_C(   0.057405), SIMDE_FLOAT32_C(   0.058560), SIMDE_FLOAT32_C(   0.095951), SIMDE_FLOAT32_C(   0.059623),
+        SIMDE_FLOAT32_C(   0.032309), SIMDE_FLOAT32_C(   0.037336), SIMDE_FLOAT32_C(   0.038861), SIMDE_FLOAT32_C(   0.041378) } },
+    { { SIMDE_FLOAT32_C( 171.06), SIMDE_FLOAT32_C( 218.90), SIMDE_FLOAT32_C( 781.53), SIMDE_FLOAT32_C( 966.81),
+        SIMDE_FLOAT32_C( 386.48), SIMDE_FLOAT32_C( 178.47), SIMDE_FLOAT32_C( 300.45), SIMDE_FLOAT32_C( 673.40) },
+      { SIMDE_FLOAT32_C(   0.076459), SIMDE_FLOAT32_C(   0.067591), SIMDE_FLOAT32_C(   0.035770), SIMDE_FLOAT32_C(   0.032162),
+        SIMDE_FLOAT32_C(   0.050868), SIMDE_FLOAT32_C(   0.074856), SIMDE_FLOAT32_C(   0.057693), SIMDE_FLOAT32_C(   0.038536) } },
+    { { SIMDE_FLOAT32_C(  68.60), SIMDE_FLOAT32_C( 703.55), SIMDE_FLOAT32_C( 994.62), SIMDE_FLOAT32_C( 292.14),
+        SIMDE_FLOAT32_C( 396.37), SIMDE_FLOAT32_C( 129.61), SIMDE_FLOAT32_C( 828.72), SIMDE_FLOAT32_C( 957.13) },
+      { SIMDE_FLOAT32_C(   0.120739), SIMDE_FLOAT32_C(   0.037700), SIMDE_FLOAT32_C(   0.031708), SIMDE_FLOAT32_C(   0.058509),
+        SIMDE_FLOAT32_C(   0.050229), SIMDE_FLOAT32_C(   0.087841), SIMDE_FLOAT32_C(   0.034737), SIMDE_FLOAT32_C(   0.032323) } },
+    { { SIMDE_FLOAT32_C( 932.59), SIMDE_FLOAT32_C( 476.16), SIMDE_FLOAT32_C( 614.83), SIMDE_FLOAT32_C( 485.54),
+        SIMDE_FLOAT32_C( 792.74), SIMDE_FLOAT32_C( 836.04), SIMDE_FLOAT32_C( 155.21), SIMDE_FLOAT32_C( 770.41) },
+      { SIMDE_FLOAT32_C(   0.032746), SIMDE_FLOAT32_C(   0.045828), SIMDE_FLOAT32_C(   0.040330), SIMDE_FLOAT32_C(   0.045383),
+        SIMDE_FLOAT32_C(   0.035517), SIMDE_FLOAT32_C(   0.034585), SIMDE_FLOAT32_C(   0.080268), SIMDE_FLOAT32_C(   0.036028) } },
+    { { SIMDE_FLOAT32_C( 171.93), SIMDE_FLOAT32_C( 525.98), SIMDE_FLOAT32_C( 796.27), SIMDE_FLOAT32_C( 635.86),
+        SIMDE_FLOAT32_C( 473.09), SIMDE_FLOAT32_C( 213.95), SIMDE_FLOAT32_C( 688.69), SIMDE_FLOAT32_C( 403.09) },
+      { SIMDE_FLOAT32_C(   0.076262), SIMDE_FLOAT32_C(   0.043603), SIMDE_FLOAT32_C(   0.035438), SIMDE_FLOAT32_C(   0.039658),
+        SIMDE_FLOAT32_C(   0.045976), SIMDE_FLOAT32_C(   0.068368), SIMDE_FLOAT32_C(   0.038105), SIMDE_FLOAT32_C(   0.049809) } },
+    { { SIMDE_FLOAT32_C(  86.56), SIMDE_FLOAT32_C( 721.66), SIMDE_FLOAT32_C( 670.71), SIMDE_FLOAT32_C( 364.13),
+        SIMDE_FLOAT32_C( 704.35), SIMDE_FLOAT32_C( 573.14), SIMDE_FLOAT32_C( 897.27), SIMDE_FLOAT32_C( 855.07) },
+      { SIMDE_FLOAT32_C(   0.107486), SIMDE_FLOAT32_C(   0.037225), SIMDE_FLOAT32_C(   0.038612), SIMDE_FLOAT32_C(   0.052406),
+        SIMDE_FLOAT32_C(   0.037679), SIMDE_FLOAT32_C(   0.041771), SIMDE_FLOAT32_C(   0.033384), SIMDE_FLOAT32_C(   0.034198) } },
+    { { SIMDE_FLOAT32_C( 365.82), SIMDE_FLOAT32_C( 132.95), SIMDE_FLOAT32_C( 627.25), SIMDE_FLOAT32_C(  44.96),
+        SIMDE_FLOAT32_C( 510.69), SIMDE_FLOAT32_C( 840.58), SIMDE_FLOAT32_C( 475.10), SIMDE_FLOAT32_C(  45.96) },
+      { SIMDE_FLOAT32_C(   0.052285), SIMDE_FLOAT32_C(   0.086728), SIMDE_FLOAT32_C(   0.039928), SIMDE_FLOAT32_C(   0.149136),
+        SIMDE_FLOAT32_C(   0.044250), SIMDE_FLOAT32_C(   0.034492), SIMDE_FLOAT32_C(   0.045879), SIMDE_FLOAT32_C(   0.147503) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_rsqrt14_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rsqrt14_ps_bound (SIMDE_MUNIT_TEST_ARGS) {
+  const simde_float32* inputs = simde_test_rsqrt14_ps_bound_inputs;
+  simde_float32 r[8];
+
+  for (size_t i = 0 ; i < (sizeof(simde_test_rsqrt14_ps_bound_inputs) / sizeof(simde_test_rsqrt14_ps_bound_inputs[0])) ; i += 8) {
+    simde_mm256_storeu_ps(r, simde_mm256_rsqrt14_ps(simde_mm256_loadu_ps(&(inputs[i]))));
+    for (size_t j = 0 ; j < 8 ; j++) {
+      simde_assert_equal_i(simde_test_rsqrt14_ps_within_bound(inputs[i + j], r[j]), 1);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(-827.78), SIMDE_FLOAT32_C( -88.87), SIMDE_FLOAT32_C(-133.30), SIMDE_FLOAT32_C( 113.88),
+        SIMDE_FLOAT32_C(-414.70), SIMDE_FLOAT32_C(-683.69), SIMDE_FLOAT32_C(-725.70), SIMDE_FLOAT32_C( 329.05) },
+      UINT8_C(   89),
+      { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -88.87), SIMDE_FLOAT32_C(-133.30),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   0.50), SIMDE_FLOAT32_C(-683.69), SIMDE_FLOAT32_C(   2.00), SIMDE_FLOAT32_C( 329.05) } },
+    #endif
+    { { SIMDE_FLOAT32_C( -84.13), SIMDE_FLOAT32_C( 207.64), SIMDE_FLOAT32_C( 530.77), SIMDE_FLOAT32_C(-738.61),
+        SIMDE_FLOAT32_C(-772.75), SIMDE_FLOAT32_C(-385.45), SIMDE_FLOAT32_C( 334.33), SIMDE_FLOAT32_C(-737.09) },
+      UINT8_C(   16),
+      { SIMDE_FLOAT32_C( 267.49), SIMDE_FLOAT32_C( 931.46), SIMDE_FLOAT32_C( 743.80), SIMDE_FLOAT32_C( 536.40),
+        SIMDE_FLOAT32_C( 107.51), SIMDE_FLOAT32_C( 368.31), SIMDE_FLOAT32_C( 506.67), SIMDE_FLOAT32_C( 866.26) },
+      { SIMDE_FLOAT32_C( -84.13), SIMDE_FLOAT32_C( 207.64), SIMDE_FLOAT32_C( 530.77), SIMDE_FLOAT32_C(-738.61),
+        SIMDE_FLOAT32_C(   0.096445), SIMDE_FLOAT32_C(-385.45), SIMDE_FLOAT32_C( 334.33), SIMDE_FLOAT32_C(-737.09) } },
+    { { SIMDE_FLOAT32_C( 239.19), SIMDE_FLOAT32_C( 621.03), SIMDE_FLOAT32_C(  92.00), SIMDE_FLOAT32_C( 798.31),
+        SIMDE_FLOAT32_C(-289.80), SIMDE_FLOAT32_C( 453.63), SIMDE_FLOAT32_C( -84.65), SIMDE_FLOAT32_C(-548.47) },
+      UINT8_C(  111),
+      { SIMDE_FLOAT32_C( 251.42), SIMDE_FLOAT32_C( 902.64), SIMDE_FLOAT32_C( 189.69), SIMDE_FLOAT32_C( 643.72),
+        SIMDE_FLOAT32_C( 975.15), SIMDE_FLOAT32_C(  17.66), SIMDE_FLOAT32_C( 186.98), SIMDE_FLOAT32_C( 895.06) },
+      { SIMDE_FLOAT32_C(   0.063067), SIMDE_FLOAT32_C(   0.033285), SIMDE_FLOAT32_C(   0.072609), SIMDE_FLOAT32_C(   0.039414),
+        SIMDE_FLOAT32_C(-289.80), SIMDE_FLOAT32_C(   0.237968), SIMDE_FLOAT32_C(   0.073133), SIMDE_FLOAT32_C(-548.47) } },
+    { { SIMDE_FLOAT32_C( 271.85), SIMDE_FLOAT32_C(-183.13), SIMDE_FLOAT32_C( 941.68), SIMDE_FLOAT32_C(-613.47),
+        SIMDE_FLOAT32_C( -20.64), SIMDE_FLOAT32_C( 759.66), SIMDE_FLOAT32_C(-720.58), SIMDE_FLOAT32_C( 489.34) },
+      UINT8_C(  233),
+      { SIMDE_FLOAT32_C( 590.64), SIMDE_FLOAT32_C( 474.49), SIMDE_FLOAT32_C( 811.85), SIMDE_FLOAT32_C( 645.30),
+        SIMDE_FLOAT32_C( 843.69), SIMDE_FLOAT32_C( 635.44), SIMDE_FLOAT32_C( 795.66), SIMDE_FLOAT32_C( 791.06) },
+      { SIMDE_FLOAT32_C(   0.041147), SIMDE_FLOAT32_C(-183.13), SIMDE_FLOAT32_C( 941.68), SIMDE_FLOAT32_C(   0.039367),
+        SIMDE_FLOAT32_C( -20.64), SIMDE_FLOAT32_C(   0.039671), SIMDE_FLOAT32_C(   0.035451), SIMDE_FLOAT32_C(   0.035555) } },
+    { { SIMDE_FLOAT32_C(  90.46), SIMDE_FLOAT32_C( -86.34), SIMDE_FLOAT32_C( 149.46), SIMDE_FLOAT32_C(-444.13),
+        SIMDE_FLOAT32_C( 684.82), SIMDE_FLOAT32_C(-812.58), SIMDE_FLOAT32_C( 524.47), SIMDE_FLOAT32_C( 784.11) },
+      UINT8_C(   88),
+      { SIMDE_FLOAT32_C( 982.55), SIMDE_FLOAT32_C( 743.01), SIMDE_FLOAT32_C( 543.31), SIMDE_FLOAT32_C( 322.19),
+        SIMDE_FLOAT32_C( 585.91), SIMDE_FLOAT32_C(   3.61), SIMDE_FLOAT32_C( 650.39), SIMDE_FLOAT32_C( 587.84) },
+      { SIMDE_FLOAT32_C(  90.46), SIMDE_FLOAT32_C( -86.34), SIMDE_FLOAT32_C( 149.46), SIMDE_FLOAT32_C(   0.055712),
+        SIMDE_FLOAT32_C(   0.041314), SIMDE_FLOAT32_C(-812.58), SIMDE_FLOAT32_C(   0.039213), SIMDE_FLOAT32_C( 784.11) } },
+    { { SIMDE_FLOAT32_C( 254.08), SIMDE_FLOAT32_C(-831.11), SIMDE_FLOAT32_C( 553.22), SIMDE_FLOAT32_C( 725.63),
+        SIMDE_FLOAT32_C(-456.14), SIMDE_FLOAT32_C( 706.81), SIMDE_FLOAT32_C( 377.79), SIMDE_FLOAT32_C(-929.50) },
+      UINT8_C(  181),
+      { SIMDE_FLOAT32_C( 763.24), SIMDE_FLOAT32_C( 586.84), SIMDE_FLOAT32_C(  60.86), SIMDE_FLOAT32_C( 326.33),
+        SIMDE_FLOAT32_C( 612.85), SIMDE_FLOAT32_C( 884.70), SIMDE_FLOAT32_C( 217.75), SIMDE_FLOAT32_C( 445.59) },
+      { SIMDE_FLOAT32_C(   0.036197), SIMDE_FLOAT32_C(-831.11), SIMDE_FLOAT32_C(   0.128183), SIMDE_FLOAT32_C( 725.63),
+        SIMDE_FLOAT32_C(   0.040395), SIMDE_FLOAT32_C(   0.033621), SIMDE_FLOAT32_C( 377.79), SIMDE_FLOAT32_C(   0.047373) } },
+    { { SIMDE_FLOAT32_C(-997.14), SIMDE_FLOAT32_C(  38.85), SIMDE_FLOAT32_C(-719.41), SIMDE_FLOAT32_C( 987.96),
+        SIMDE_FLOAT32_C(-847.02), SIMDE_FLOAT32_C(-396.52), SIMDE_FLOAT32_C(-753.20), SIMDE_FLOAT32_C(-179.73) },
+      UINT8_C(   20),
+      { SIMDE_FLOAT32_C( 174.88), SIMDE_FLOAT32_C( 278.05), SIMDE_FLOAT32_C( 191.98), SIMDE_FLOAT32_C( 266.09),
+        SIMDE_FLOAT32_C(  22.95), SIMDE_FLOAT32_C( 152.23), SIMDE_FLOAT32_C( 289.36), SIMDE_FLOAT32_C( 718.40) },
+      { SIMDE_FLOAT32_C(-997.14), SIMDE_FLOAT32_C(  38.85), SIMDE_FLOAT32_C(   0.072171), SIMDE_FLOAT32_C( 987.96),
+        SIMDE_FLOAT32_C(   0.208742), SIMDE_FLOAT32_C(-396.52), SIMDE_FLOAT32_C(-753.20), SIMDE_FLOAT32_C(-179.73) } },
+    { { SIMDE_FLOAT32_C(  74.41), SIMDE_FLOAT32_C(-908.72), SIMDE_FLOAT32_C( 939.47), SIMDE_FLOAT32_C(-242.00),
+        SIMDE_FLOAT32_C( 280.08), SIMDE_FLOAT32_C( 789.52), SIMDE_FLOAT32_C( 651.62), SIMDE_FLOAT32_C(-280.52) },
+      UINT8_C(  114),
+      { SIMDE_FLOAT32_C( 166.56), SIMDE_FLOAT32_C( 920.71), SIMDE_FLOAT32_C( 165.67), SIMDE_FLOAT32_C( 331.25),
+        SIMDE_FLOAT32_C( 677.48), SIMDE_FLOAT32_C( 702.17), SIMDE_FLOAT32_C( 169.83), SIMDE_FLOAT32_C( 873.66) },
+      { SIMDE_FLOAT32_C(  74.41), SIMDE_FLOAT32_C(   0.032957), SIMDE_FLOAT32_C( 939.47), SIMDE_FLOAT32_C(-242.00),
+        SIMDE_FLOAT32_C(   0.038420), SIMDE_FLOAT32_C(   0.037738), SIMDE_FLOAT32_C(   0.076736), SIMDE_FLOAT32_C(-280.52) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_rsqrt14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(  185),
+      { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   0.50),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00) } },
+    #endif
+    { UINT8_C(   48),
+      { SIMDE_FLOAT32_C( 420.11), SIMDE_FLOAT32_C( 146.50), SIMDE_FLOAT32_C( 516.83), SIMDE_FLOAT32_C( 262.73),
+        SIMDE_FLOAT32_C( 367.95), SIMDE_FLOAT32_C( 951.98), SIMDE_FLOAT32_C( 318.96), SIMDE_FLOAT32_C( 564.25) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.052132), SIMDE_FLOAT32_C(   0.032411), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(  248),
+      { SIMDE_FLOAT32_C(  57.15), SIMDE_FLOAT32_C( 773.35), SIMDE_FLOAT32_C( 603.60), SIMDE_FLOAT32_C( 128.36),
+        SIMDE_FLOAT32_C( 675.24), SIMDE_FLOAT32_C( 126.31), SIMDE_FLOAT32_C( 913.09), SIMDE_FLOAT32_C(  15.44) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.088263),
+        SIMDE_FLOAT32_C(   0.038484), SIMDE_FLOAT32_C(   0.088979), SIMDE_FLOAT32_C(   0.033093), SIMDE_FLOAT32_C(   0.254498) } },
+    { UINT8_C(   98),
+      { SIMDE_FLOAT32_C( 620.89), SIMDE_FLOAT32_C( 616.14), SIMDE_FLOAT32_C( 442.13), SIMDE_FLOAT32_C( 610.25),
+        SIMDE_FLOAT32_C( 973.88), SIMDE_FLOAT32_C( 589.05), SIMDE_FLOAT32_C( 318.91), SIMDE_FLOAT32_C( 152.45) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.040288), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.041203), SIMDE_FLOAT32_C(   0.055997), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(    4),
+      { SIMDE_FLOAT32_C( 205.86), SIMDE_FLOAT32_C( 863.73), SIMDE_FLOAT32_C(   7.09), SIMDE_FLOAT32_C( 849.14),
+        SIMDE_FLOAT32_C( 289.93), SIMDE_FLOAT32_C( 313.54), SIMDE_FLOAT32_C( 874.54), SIMDE_FLOAT32_C( 258.25) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.375557), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT8_C(  251),
+      { SIMDE_FLOAT32_C( 365.65), SIMDE_FLOAT32_C( 233.53), SIMDE_FLOAT32_C( 269.37), SIMDE_FLOAT32_C( 688.10),
+        SIMDE_FLOAT32_C( 781.69), SIMDE_FLOAT32_C( 766.65), SIMDE_FLOAT32_C( 993.61), SIMDE_FLOAT32_C( 685.29) },
+      { SIMDE_FLOAT32_C(   0.052297), SIMDE_FLOAT32_C(   0.065438), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.038121),
+        SIMDE_FLOAT32_C(   0.035767), SIMDE_FLOAT32_C(   0.036116), SIMDE_FLOAT32_C(   0.031724), SIMDE_FLOAT32_C(   0.038200) } },
+    { UINT8_C(  208),
+      { SIMDE_FLOAT32_C( 348.65), SIMDE_FLOAT32_C( 705.21), SIMDE_FLOAT32_C( 664.04), SIMDE_FLOAT32_C( 703.42),
+        SIMDE_FLOAT32_C( 920.25), SIMDE_FLOAT32_C( 336.73), SIMDE_FLOAT32_C( 541.83), SIMDE_FLOAT32_C( 725.94) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.032965), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.042961), SIMDE_FLOAT32_C(   0.037116) } },
+    { UINT8_C(  128),
+      { SIMDE_FLOAT32_C(  16.87), SIMDE_FLOAT32_C( 104.02), SIMDE_FLOAT32_C( 170.34), SIMDE_FLOAT32_C( 913.57),
+        SIMDE_FLOAT32_C( 518.33), SIMDE_FLOAT32_C( 309.30), SIMDE_FLOAT32_C( 861.64), SIMDE_FLOAT32_C( 598.47) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.040878) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_rsqrt14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  -1.00),         SIMDE_MATH_NAN },
+      {        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    #endif
+    { { SIMDE_FLOAT64_C( 303.95), SIMDE_FLOAT64_C( 429.24), SIMDE_FLOAT64_C( 558.68), SIMDE_FLOAT64_C( 334.71) },
+      { SIMDE_FLOAT64_C(   0.057357), SIMDE_FLOAT64_C(   0.048268), SIMDE_FLOAT64_C(   0.042307), SIMDE_FLOAT64_C(   0.054660) } },
+    { { SIMDE_FLOAT64_C( 884.01), SIMDE_FLOAT64_C( 555.11), SIMDE_FLOAT64_C( 627.82), SIMDE_FLOAT64_C( 325.26) },
+      { SIMDE_FLOAT64_C(   0.033634), SIMDE_FLOAT64_C(   0.042444), SIMDE_FLOAT64_C(   0.039911), SIMDE_FLOAT64_C(   0.055449) } },
+    { { SIMDE_FLOAT64_C( 194.18), SIMDE_FLOAT64_C( 833.56), SIMDE_FLOAT64_C( 798.16), SIMDE_FLOAT64_C( 404.33) },
+      { SIMDE_FLOAT64_C(   0.071763), SIMDE_FLOAT64_C(   0.034636), SIMDE_FLOAT64_C(   0.035395), SIMDE_FLOAT64_C(   0.049732) } },
+    { { SIMDE_FLOAT64_C( 173.26), SIMDE_FLOAT64_C( 903.00), SIMDE_FLOAT64_C( 242.01), SIMDE_FLOAT64_C(  90.11) },
+      { SIMDE_FLOAT64_C(   0.075973), SIMDE_FLOAT64_C(   0.033278), SIMDE_FLOAT64_C(   0.064282), SIMDE_FLOAT64_C(   0.105343) } },
+    { { SIMDE_FLOAT64_C( 561.81), SIMDE_FLOAT64_C( 766.49), SIMDE_FLOAT64_C( 621.91), SIMDE_FLOAT64_C( 690.02) },
+      { SIMDE_FLOAT64_C(   0.042189), SIMDE_FLOAT64_C(   0.036119), SIMDE_FLOAT64_C(   0.040099), SIMDE_FLOAT64_C(   0.038069) } },
+    { { SIMDE_FLOAT64_C( 396.19), SIMDE_FLOAT64_C( 990.59), SIMDE_FLOAT64_C( 100.01), SIMDE_FLOAT64_C( 672.09) },
+      { SIMDE_FLOAT64_C(   0.050241), SIMDE_FLOAT64_C(   0.031773), SIMDE_FLOAT64_C(   0.099993), SIMDE_FLOAT64_C(   0.038572) } },
+    { { SIMDE_FLOAT64_C( 623.90), SIMDE_FLOAT64_C( 249.06), SIMDE_FLOAT64_C( 381.66), SIMDE_FLOAT64_C( 200.87) },
+      { SIMDE_FLOAT64_C(   0.040034), SIMDE_FLOAT64_C(   0.063365), SIMDE_FLOAT64_C(   0.051188), SIMDE_FLOAT64_C(   0.070558) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_rsqrt14_pd(a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(-450.25), SIMDE_FLOAT64_C( 259.70), SIMDE_FLOAT64_C( 268.73), SIMDE_FLOAT64_C(-639.90) },
+      UINT8_C(   13),
+      { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  -1.00),         SIMDE_MATH_NAN },
+      {        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( 259.70),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN } },
+    #endif
+    { { SIMDE_FLOAT64_C( 310.17), SIMDE_FLOAT64_C(-297.58), SIMDE_FLOAT64_C(-447.78), SIMDE_FLOAT64_C( 642.52) },
+      UINT8_C(   10),
+      { SIMDE_FLOAT64_C( 585.50), SIMDE_FLOAT64_C( 283.38), SIMDE_FLOAT64_C( 609.98), SIMDE_FLOAT64_C( 912.40) },
+      { SIMDE_FLOAT64_C( 310.17), SIMDE_FLOAT64_C(   0.059406), SIMDE_FLOAT64_C(-447.78), SIMDE_FLOAT64_C(   0.033106) } },
+    { { SIMDE_FLOAT64_C(-412.54), SIMDE_FLOAT64_C( 849.16), SIMDE_FLOAT64_C(-199.77), SIMDE_FLOAT64_C(-115.83) },
+      UINT8_C(    8),
+      { SIMDE_FLOAT64_C( 964.92), SIMDE_FLOAT64_C(  24.20), SIMDE_FLOAT64_C( 891.66), SIMDE_FLOAT64_C( 787.65) },
+      { SIMDE_FLOAT64_C(-412.54), SIMDE_FLOAT64_C( 849.16), SIMDE_FLOAT64_C(-199.77), SIMDE_FLOAT64_C(   0.035632) } },
+    { { SIMDE_FLOAT64_C( 570.70), SIMDE_FLOAT64_C( 518.57), SIMDE_FLOAT64_C( 492.26), SIMDE_FLOAT64_C(-440.78) },
+      UINT8_C(    4),
+      { SIMDE_FLOAT64_C( 781.83), SIMDE_FLOAT64_C( 525.09), SIMDE_FLOAT64_C( 584.74), SIMDE_FLOAT64_C( 906.85) },
+      { SIMDE_FLOAT64_C( 570.70), SIMDE_FLOAT64_C( 518.57), SIMDE_FLOAT64_C(   0.041356), SIMDE_FLOAT64_C(-440.78) } },
+    { { SIMDE_FLOAT64_C(-877.21), SIMDE_FLOAT64_C(-924.37), SIMDE_FLOAT64_C(-297.18), SIMDE_FLOAT64_C(-554.01) },
+      UINT8_C(    5),
+      { SIMDE_FLOAT64_C( 674.13), SIMDE_FLOAT64_C( 751.87), SIMDE_FLOAT64_C( 524.79), SIMDE_FLOAT64_C( 639.13) },
+      { SIMDE_FLOAT64_C(   0.038515), SIMDE_FLOAT64_C(-924.37), SIMDE_FLOAT64_C(   0.043653), SIMDE_FLOAT64_C(-554.01) } },
+    { { SIMDE_FLOAT64_C( 646.20), SIMDE_FLOAT64_C(  -3.66), SIMDE_FLOAT64_C( 408.72), SIMDE_FLOAT64_C( 254.66) },
+      UINT8_C(    7),
+      { SIMDE_FLOAT64_C( 205.13), SIMDE_FLOAT64_C( 753.16), SIMDE_FLOAT64_C( 340.37), SIMDE_FLOAT64_C( 238.20) },
+      { SIMDE_FLOAT64_C(   0.069821), SIMDE_FLOAT64_C(   0.036438), SIMDE_FLOAT64_C(   0.054204), SIMDE_FLOAT64_C( 254.66) } },
+    { { SIMDE_FLOAT64_C( 712.39), SIMDE_FLOAT64_C(-473.28), SIMDE_FLOAT64_C(-802.74), SIMDE_FLOAT64_C(-425.99) },
+      UINT8_C(    5),
+      { SIMDE_FLOAT64_C( 750.19), SIMDE_FLOAT64_C( 575.89), SIMDE_FLOAT64_C( 598.77), SIMDE_FLOAT64_C( 953.54) },
+      { SIMDE_FLOAT64_C(   0.036510), SIMDE_FLOAT64_C(-473.28), SIMDE_FLOAT64_C(   0.040868), SIMDE_FLOAT64_C(-425.99) } },
+    { { SIMDE_FLOAT64_C(-681.68), SIMDE_FLOAT64_C( 557.65), SIMDE_FLOAT64_C(-283.05), SIMDE_FLOAT64_C( 690.49) },
+      UINT8_C(   15),
+      { SIMDE_FLOAT64_C( 188.79), SIMDE_FLOAT64_C( 441.52), SIMDE_FLOAT64_C( 615.20), SIMDE_FLOAT64_C( 948.20) },
+      { SIMDE_FLOAT64_C(   0.072781), SIMDE_FLOAT64_C(   0.047591), SIMDE_FLOAT64_C(   0.040319), SIMDE_FLOAT64_C(   0.032475) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_rsqrt14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    2),
+      { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  -1.00),         SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    #endif
+    { UINT8_C(   13),
+      { SIMDE_FLOAT64_C( 775.24), SIMDE_FLOAT64_C( 738.81), SIMDE_FLOAT64_C( 125.37), SIMDE_FLOAT64_C( 854.44) },
+      { SIMDE_FLOAT64_C(   0.035916), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.089312), SIMDE_FLOAT64_C(   0.034211) } },
+    { UINT8_C(    5),
+      { SIMDE_FLOAT64_C( 792.52), SIMDE_FLOAT64_C( 588.60), SIMDE_FLOAT64_C( 673.05), SIMDE_FLOAT64_C( 118.99) },
+      { SIMDE_FLOAT64_C(   0.035522), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.038545), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C(  28.34), SIMDE_FLOAT64_C( 462.37), SIMDE_FLOAT64_C( 656.65), SIMDE_FLOAT64_C(  41.84) },
+      { SIMDE_FLOAT64_C(   0.187845), SIMDE_FLOAT64_C(   0.046506), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT64_C( 766.28), SIMDE_FLOAT64_C( 640.86), SIMDE_FLOAT64_C( 563.26), SIMDE_FLOAT64_C(  25.54) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.197872) } },
+    { UINT8_C(    4),
+      { SIMDE_FLOAT64_C( 234.57), SIMDE_FLOAT64_C( 804.11), SIMDE_FLOAT64_C( 362.17), SIMDE_FLOAT64_C( 156.96) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.052547), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    3),
+      { SIMDE_FLOAT64_C( 275.92), SIMDE_FLOAT64_C( 966.23), SIMDE_FLOAT64_C( 340.24), SIMDE_FLOAT64_C( 499.88) },
+      { SIMDE_FLOAT64_C(   0.060204), SIMDE_FLOAT64_C(   0.032171), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(    9),
+      { SIMDE_FLOAT64_C( 865.74), SIMDE_FLOAT64_C( 993.21), SIMDE_FLOAT64_C( 858.85), SIMDE_FLOAT64_C( 863.21) },
+      { SIMDE_FLOAT64_C(   0.033986), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.034036) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_rsqrt14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   0.50),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   2.00), SIMDE_FLOAT32_C(   1.00),
+              SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   0.50),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   2.00), SIMDE_FLOAT32_C(   1.00) } },
+    { { SIMDE_FLOAT32_C(2.938735877e-39), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(-0.0), SIMDE_FLOAT32_C(-1.0e-39), SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(4.0), SIMDE_FLOAT32_C(0.0), SIMDE_FLOAT32_C(-1.401298464e-45),
+        SIMDE_FLOAT32_C(8.507059173e37), SIMDE_FLOAT32_C(4.0), SIMDE_FLOAT32_C(0.0), SIMDE_FLOAT32_C(-1.401298464e-45), SIMDE_FLOAT32_C(2.938735877e-39), SIMDE_FLOAT32_C(1.175494351e-38), SIMDE_FLOAT32_C(-0.0), SIMDE_FLOAT32_C(-1.0e-39) },
+      { SIMDE_FLOAT32_C(18446744073709551616.0), SIMDE_FLOAT32_C(9223372036854775808.0), -SIMDE_MATH_INFINITYF, SIMDE_MATH_NANF, SIMDE_FLOAT32_C(1.084202172e-19), SIMDE_FLOAT32_C(0.5), SIMDE_MATH_INFINITYF, SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(1.084202172e-19), SIMDE_FLOAT32_C(0.5), SIMDE_MATH_INFINITYF, SIMDE_MATH_NANF, SIMDE_FLOAT32_C(18446744073709551616.0), SIMDE_FLOAT32_C(9223372036854775808.0), -SIMDE_MATH_INFINITYF, SIMDE_MATH_NANF } },
+    #endif
+    { { SIMDE_FLOAT32_C( 835.56), SIMDE_FLOAT32_C( 484.15), SIMDE_FLOAT32_C( 318.85), SIMDE_FLOAT32_C( 269.01),
+        SIMDE_FLOAT32_C( 333.41), SIMDE_FLOAT32_C(  53.17), SIMDE_FLOAT32_C(  27.25), SIMDE_FLOAT32_C( 169.48),
+        SIMDE_FLOAT32_C( 190.41), SIMDE_FLOAT32_C( 961.62), SIMDE_FLOAT32_C( 917.00), SIMDE_FLOAT32_C( 592.98),
+        SIMDE_FLOAT32_C(  11.35), SIMDE_FLOAT32_C( 552.28), SIMDE_FLOAT32_C( 478.27), SIMDE_FLOAT32_C( 758.20) },
+      { SIMDE_FLOAT32_C(   0.034595), SIMDE_FLOAT32_C(   0.045448), SIMDE_FLOAT32_C(   0.056003), SIMDE_FLOAT32_C(   0.060972),
+        SIMDE_FLOAT32_C(   0.054767), SIMDE_FLOAT32_C(   0.137140), SIMDE_FLOAT32_C(   0.191568), SIMDE_FLOAT32_C(   0.076817),
+        SIMDE_FLOAT32_C(   0.072472), SIMDE_FLOAT32_C(   0.032248), SIMDE_FLOAT32_C(   0.033023), SIMDE_FLOAT32_C(   0.041065),
+        SIMDE_FLOAT32_C(   0.296833), SIMDE_FLOAT32_C(   0.042554), SIMDE_FLOAT32_C(   0.045727), SIMDE_FLOAT32_C(   0.036318) } },
+    { { SIMDE_FLOAT32_C( 619.64), SIMDE_FLOAT32_C( 745.28), SIMDE_FLOAT32_C( 548.26), SIMDE_FLOAT32_C( 228.55),
+        SIMDE_FLOAT32_C(  23.15), SIMDE_FLOAT32_C( 799.57), SIMDE_FLOAT32_C( 229.84), SIMDE_FLOAT32_C( 416.38),
+        SIMDE_FLOAT32_C( 681.98), SIMDE_FLOAT32_C( 944.60), SIMDE_FLOAT32_C( 224.80), SIMDE_FLOAT32_C( 236.87),
+        SIMDE_FLOAT32_C( 460.23), SIMDE_FLOAT32_C( 641.97), SIMDE_FLOAT32_C(  18.02), SIMDE_FLOAT32_C( 719.74) },
+      { SIMDE_FLOAT32_C(   0.040174), SIMDE_FLOAT32_C(   0.036631), SIMDE_FLOAT32_C(   0.042709), SIMDE_FLOAT32_C(   0.066147),
+        SIMDE_FLOAT32_C(   0.207840), SIMDE_FLOAT32_C(   0.035364), SIMDE_FLOAT32_C(   0.065962), SIMDE_FLOAT32_C(   0.049006),
+        SIMDE_FLOAT32_C(   0.038293), SIMDE_FLOAT32_C(   0.032537), SIMDE_FLOAT32_C(   0.066697), SIMDE_FLOAT32_C(   0.064975),
+        SIMDE_FLOAT32_C(   0.046614), SIMDE_FLOAT32_C(   0.039467), SIMDE_FLOAT32_C(   0.235567), SIMDE_FLOAT32_C(   0.037274) } },
+    { { SIMDE_FLOAT32_C( 487.84), SIMDE_FLOAT32_C( 712.80), SIMDE_FLOAT32_C( 121.92), SIMDE_FLOAT32_C( 939.40),
+        SIMDE_FLOAT32_C( 913.04), SIMDE_FLOAT32_C( 444.08), SIMDE_FLOAT32_C( 113.36), SIMDE_FLOAT32_C( 611.06),
+        SIMDE_FLOAT32_C( 241.49), SIMDE_FLOAT32_C( 103.05), SIMDE_FLOAT32_C( 287.34), SIMDE_FLOAT32_C( 690.57),
+        SIMDE_FLOAT32_C( 744.59), SIMDE_FLOAT32_C( 568.91), SIMDE_FLOAT32_C( 260.72), SIMDE_FLOAT32_C( 359.06) },
+      { SIMDE_FLOAT32_C(   0.045275), SIMDE_FLOAT32_C(   0.037457), SIMDE_FLOAT32_C(   0.090566), SIMDE_FLOAT32_C(   0.032627),
+        SIMDE_FLOAT32_C(   0.033094), SIMDE_FLOAT32_C(   0.047454), SIMDE_FLOAT32_C(   0.093923), SIMDE_FLOAT32_C(   0.040454),
+        SIMDE_FLOAT32_C(   0.064351), SIMDE_FLOAT32_C(   0.098511), SIMDE_FLOAT32_C(   0.058992), SIMDE_FLOAT32_C(   0.038054),
+        SIMDE_FLOAT32_C(   0.036648), SIMDE_FLOAT32_C(   0.041927), SIMDE_FLOAT32_C(   0.061934), SIMDE_FLOAT32_C(   0.052773) } },
+    { { SIMDE_FLOAT32_C( 900.82), SIMDE_FLOAT32_C(  61.25), SIMDE_FLOAT32_C( 261.26), SIMDE_FLOAT32_C( 858.77),
+        SIMDE_FLOAT32_C( 813.10), SIMDE_FLOAT32_C( 377.14), SIMDE_FLOAT32_C( 880.82), SIMDE_FLOAT32_C( 839.15),
+        SIMDE_FLOAT32_C( 797.48), SIMDE_FLOAT32_C(  62.75), SIMDE_FLOAT32_C( 166.10), SIMDE_FLOAT32_C( 487.20),
+        SIMDE_FLOAT32_C( 285.99), SIMDE_FLOAT32_C( 582.13), SIMDE_FLOAT32_C( 850.01), SIMDE_FLOAT32_C( 583.22) },
+      { SIMDE_FLOAT32_C(   0.033319), SIMDE_FLOAT32_C(   0.127775), SIMDE_FLOAT32_C(   0.061870), SIMDE_FLOAT32_C(   0.034124),
+        SIMDE_FLOAT32_C(   0.035069), SIMDE_FLOAT32_C(   0.051494), SIMDE_FLOAT32_C(   0.033694), SIMDE_FLOAT32_C(   0.034521),
+        SIMDE_FLOAT32_C(   0.035411), SIMDE_FLOAT32_C(   0.126240), SIMDE_FLOAT32_C(   0.077594), SIMDE_FLOAT32_C(   0.045305),
+        SIMDE_FLOAT32_C(   0.059134), SIMDE_FLOAT32_C(   0.041448), SIMDE_FLOAT32_C(   0.034299), SIMDE_FLOAT32_C(   0.041409) } },
+    { { SIMDE_FLOAT32_C(  25.55), SIMDE_FLOAT32_C(  41.03), SIMDE_FLOAT32_C( 642.23), SIMDE_FLOAT32_C( 954.95),
+        SIMDE_FLOAT32_C( 186.06), SIMDE_FLOAT32_C( 103.45), SIMDE_FLOAT32_C( 534.64), SIMDE_FLOAT32_C( 911.08),
+        SIMDE_FLOAT32_C( 272.80), SIMDE_FLOAT32_C( 496.96), SIMDE_FLOAT32_C( 822.36), SIMDE_FLOAT32_C( 896.11),
+        SIMDE_FLOAT32_C(  68.17), SIMDE_FLOAT32_C( 863.98), SIMDE_FLOAT32_C( 823.11), SIMDE_FLOAT32_C( 157.29) },
+      { SIMDE_FLOAT32_C(   0.197834), SIMDE_FLOAT32_C(   0.156115), SIMDE_FLOAT32_C(   0.039460), SIMDE_FLOAT32_C(   0.032361),
+        SIMDE_FLOAT32_C(   0.073314), SIMDE_FLOAT32_C(   0.098319), SIMDE_FLOAT32_C(   0.043251), SIMDE_FLOAT32_C(   0.033130),
+        SIMDE_FLOAT32_C(   0.060544), SIMDE_FLOAT32_C(   0.044858), SIMDE_FLOAT32_C(   0.034872), SIMDE_FLOAT32_C(   0.033405),
+        SIMDE_FLOAT32_C(   0.121114), SIMDE_FLOAT32_C(   0.034020), SIMDE_FLOAT32_C(   0.034856), SIMDE_FLOAT32_C(   0.079737) } },
+    { { SIMDE_FLOAT32_C( 566.36), SIMDE_FLOAT32_C(  96.46), SIMDE_FLOAT32_C( 500.58), SIMDE_FLOAT32_C(  73.27),
+        SIMDE_FLOAT32_C( 333.34), SIMDE_FLOAT32_C( 752.39), SIMDE_FLOAT32_C( 236.43), SIMDE_FLOAT32_C( 386.35),
+        SIMDE_FLOAT32_C( 767.28), SIMDE_FLOAT32_C( 322.07), SIMDE_FLOAT32_C( 669.96), SIMDE_FLOAT32_C( 752.38),
+        SIMDE_FLOAT32_C( 602.02), SIMDE_FLOAT32_C( 607.85), SIMDE_FLOAT32_C( 441.90), SIMDE_FLOAT32_C( 971.51) },
+      { SIMDE_FLOAT32_C(   0.042021), SIMDE_FLOAT32_C(   0.101819), SIMDE_FLOAT32_C(   0.044696), SIMDE_FLOAT32_C(   0.116828),
+        SIMDE_FLOAT32_C(   0.054773), SIMDE_FLOAT32_C(   0.036457), SIMDE_FLOAT32_C(   0.065035), SIMDE_FLOAT32_C(   0.050877),
+        SIMDE_FLOAT32_C(   0.036101), SIMDE_FLOAT32_C(   0.055723), SIMDE_FLOAT32_C(   0.038634), SIMDE_FLOAT32_C(   0.036457),
+        SIMDE_FLOAT32_C(   0.040757), SIMDE_FLOAT32_C(   0.040559), SIMDE_FLOAT32_C(   0.047571), SIMDE_FLOAT32_C(   0.032084) } },
+    { { SIMDE_FLOAT32_C( 515.23), SIMDE_FLOAT32_C( 566.31), SIMDE_FLOAT32_C( 531.69), SIMDE_FLOAT32_C(  29.38),
+        SIMDE_FLOAT32_C( 675.11), SIMDE_FLOAT32_C( 107.37), SIMDE_FLOAT32_C( 676.40), SIMDE_FLOAT32_C( 889.10),
+        SIMDE_FLOAT32_C( 302.19), SIMDE_FLOAT32_C( 516.68), SIMDE_FLOAT32_C( 932.27), SIMDE_FLOAT32_C( 390.40),
+        SIMDE_FLOAT32_C( 423.99), SIMDE_FLOAT32_C( 504.16), SIMDE_FLOAT32_C( 142.90), SIMDE_FLOAT32_C( 851.94) },
+      { SIMDE_FLOAT32_C(   0.044056), SIMDE_FLOAT32_C(   0.042023), SIMDE_FLOAT32_C(   0.043369), SIMDE_FLOAT32_C(   0.184490),
+        SIMDE_FLOAT32_C(   0.038487), SIMDE_FLOAT32_C(   0.096509), SIMDE_FLOAT32_C(   0.038451), SIMDE_FLOAT32_C(   0.033537),
+        SIMDE_FLOAT32_C(   0.057526), SIMDE_FLOAT32_C(   0.043995), SIMDE_FLOAT32_C(   0.032752), SIMDE_FLOAT32_C(   0.050611),
+        SIMDE_FLOAT32_C(   0.048564), SIMDE_FLOAT32_C(   0.044537), SIMDE_FLOAT32_C(   0.083655), SIMDE_FLOAT32_C(   0.034261) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_rsqrt14_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rsqrt14_ps_bound (SIMDE_MUNIT_TEST_ARGS) {
+  const simde_float32* inputs = simde_test_rsqrt14_ps_bound_inputs;
+  simde_float32 r[16];
+
+  for (size_t i = 0 ; i < (sizeof(simde_test_rsqrt14_ps_bound_inputs) / sizeof(simde_test_rsqrt14_ps_bound_inputs[0])) ; i += 16) {
+    simde_mm512_storeu_ps(r, simde_mm512_rsqrt14_ps(simde_mm512_loadu_ps(&(inputs[i]))));
+    for (size_t j = 0 ; j < 16 ; j++) {
+      simde_assert_equal_i(simde_test_rsqrt14_ps_within_bound(inputs[i + j], r[j]), 1);
+    }
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT32_C(-883.31), SIMDE_FLOAT32_C(-822.00), SIMDE_FLOAT32_C( 153.61), SIMDE_FLOAT32_C( 770.52),
+        SIMDE_FLOAT32_C( 711.76), SIMDE_FLOAT32_C( 482.18), SIMDE_FLOAT32_C( 539.43), SIMDE_FLOAT32_C( 187.93),
+        SIMDE_FLOAT32_C( 874.29), SIMDE_FLOAT32_C(-437.58), SIMDE_FLOAT32_C(-918.91), SIMDE_FLOAT32_C( 123.21),
+        SIMDE_FLOAT32_C(-945.32), SIMDE_FLOAT32_C(  -9.40), SIMDE_FLOAT32_C( 194.10), SIMDE_FLOAT32_C( 140.92) },
+      UINT16_C(29501),
+      { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-822.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   0.50),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 539.43), SIMDE_FLOAT32_C( 187.93),
+              SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(-918.91), SIMDE_FLOAT32_C( 123.21),
+        SIMDE_FLOAT32_C(   0.50),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   2.00), SIMDE_FLOAT32_C( 140.92) } },
+    #endif
+    { { SIMDE_FLOAT32_C( -41.98), SIMDE_FLOAT32_C( 817.37), SIMDE_FLOAT32_C( 403.97), SIMDE_FLOAT32_C(-378.65),
+        SIMDE_FLOAT32_C( -81.92), SIMDE_FLOAT32_C( 376.20), SIMDE_FLOAT32_C(-325.69), SIMDE_FLOAT32_C( 301.56),
+        SIMDE_FLOAT32_C( 244.53), SIMDE_FLOAT32_C(-233.55), SIMDE_FLOAT32_C(-912.48), SIMDE_FLOAT32_C( 484.58),
+        SIMDE_FLOAT32_C( 823.35), SIMDE_FLOAT32_C(  11.55), SIMDE_FLOAT32_C(-886.69), SIMDE_FLOAT32_C(-443.16) },
+      UINT16_C( 4700),
+      { SIMDE_FLOAT32_C( 176.03), SIMDE_FLOAT32_C( 218.19), SIMDE_FLOAT32_C( 390.22), SIMDE_FLOAT32_C( 265.14),
+        SIMDE_FLOAT32_C( 814.16), SIMDE_FLOAT32_C( 212.51), SIMDE_FLOAT32_C( 666.03), SIMDE_FLOAT32_C( 643.64),
+        SIMDE_FLOAT32_C( 800.11), SIMDE_FLOAT32_C( 749.82), SIMDE_FLOAT32_C( 448.96), SIMDE_FLOAT32_C( 184.41),
+        SIMDE_FLOAT32_C( 894.59), SIMDE_FLOAT32_C( 359.81), SIMDE_FLOAT32_C( 217.10), SIMDE_FLOAT32_C( 343.86) },
+      { SIMDE_FLOAT32_C( -41.98), SIMDE_FLOAT32_C( 817.37), SIMDE_FLOAT32_C(   0.050623), SIMDE_FLOAT32_C(   0.061413),
+        SIMDE_FLOAT32_C(   0.035046), SIMDE_FLOAT32_C( 376.20), SIMDE_FLOAT32_C(   0.038750), SIMDE_FLOAT32_C( 301.56),
+        SIMDE_FLOAT32_C( 244.53), SIMDE_FLOAT32_C(   0.036520), SIMDE_FLOAT32_C(-912.48), SIMDE_FLOAT32_C( 484.58),
+        SIMDE_FLOAT32_C(   0.033434), SIMDE_FLOAT32_C(  11.55), SIMDE_FLOAT32_C(-886.69), SIMDE_FLOAT32_C(-443.16) } },
+    { { SIMDE_FLOAT32_C(-347.79), SIMDE_FLOAT32_C(-694.56), SIMDE_FLOAT32_C(-304.28), SIMDE_FLOAT32_C( 846.70),
+        SIMDE_FLOAT32_C(-986.14), SIMDE_FLOAT32_C( 817.51), SIMDE_FLOAT32_C(-858.63), SIMDE_FLOAT32_C(  12.59),
+        SIMDE_FLOAT32_C(-280.05), SIMDE_FLOAT32_C( 644.57), SIMDE_FLOAT32_C(-179.01), SIMDE_FLOAT32_C(-744.10),
+        SIMDE_FLOAT32_C( 814.42), SIMDE_FLOAT32_C(-921.50), SIMDE_FLOAT32_C(-798.23), SIMDE_FLOAT32_C( 650.38) },
+      UINT16_C(26748),
+      { SIMDE_FLOAT32_C( 823.95), SIMDE_FLOAT32_C( 398.28), SIMDE_FLOAT32_C( 416.23), SIMDE_FLOAT32_C( 705.21),
+        SIMDE_FLOAT32_C( 727.99), SIMDE_FLOAT32_C( 990.12), SIMDE_FLOAT32_C( 312.69), SIMDE_FLOAT32_C( 833.21),
+        SIMDE_FLOAT32_C(  41.32), SIMDE_FLOAT32_C(  52.26), SIMDE_FLOAT32_C(  59.69), SIMDE_FLOAT32_C( 529.35),
+        SIMDE_FLOAT32_C( 601.47), SIMDE_FLOAT32_C( 724.70), SIMDE_FLOAT32_C( 533.24), SIMDE_FLOAT32_C(  12.11) },
+      { SIMDE_FLOAT32_C(-347.79), SIMDE_FLOAT32_C(-694.56), SIMDE_FLOAT32_C(   0.049015), SIMDE_FLOAT32_C(   0.037656),
+        SIMDE_FLOAT32_C(   0.037064), SIMDE_FLOAT32_C(   0.031781), SIMDE_FLOAT32_C(   0.056551), SIMDE_FLOAT32_C(  12.59),
+        SIMDE_FLOAT32_C(-280.05), SIMDE_FLOAT32_C( 644.57), SIMDE_FLOAT32_C(-179.01), SIMDE_FLOAT32_C(   0.043463),
+        SIMDE_FLOAT32_C( 814.42), SIMDE_FLOAT32_C(   0.037148), SIMDE_FLOAT32_C(   0.043306), SIMDE_FLOAT32_C( 650.38) } },
+    { { SIMDE_FLOAT32_C( 979.37), SIMDE_FLOAT32_C( 394.51), SIMDE_FLOAT32_C(-567.23), SIMDE_FLOAT32_C( 501.46),
+        SIMDE_FLOAT32_C( 551.32), SIMDE_FLOAT32_C( 761.28), SIMDE_FLOAT32_C(-768.76), SIMDE_FLOAT32_C(-838.40),
+        SIMDE_FLOAT32_C( 126.20), SIMDE_FLOAT32_C( 732.25), SIMDE_FLOAT32_C(   2.30), SIMDE_FLOAT32_C( 662.03),
+        SIMDE_FLOAT32_C( 413.94), SIMDE_FLOAT32_C( 645.35), SIMDE_FLOAT32_C(  51.24), SIMDE_FLOAT32_C( 901.16) },
+      UINT16_C(38697),
+      { SIMDE_FLOAT32_C( 597.71), SIMDE_FLOAT32_C( 874.85), SIMDE_FLOAT32_C( 723.00), SIMDE_FLOAT32_C( 584.34),
+        SIMDE_FLOAT32_C( 147.60), SIMDE_FLOAT32_C( 100.25), SIMDE_FLOAT32_C( 655.17), SIMDE_FLOAT32_C( 312.50),
+        SIMDE_FLOAT32_C( 624.65), SIMDE_FLOAT32_C( 496.82), SIMDE_FLOAT32_C( 353.97), SIMDE_FLOAT32_C( 648.91),
+        SIMDE_FLOAT32_C( 554.20), SIMDE_FLOAT32_C( 740.31), SIMDE_FLOAT32_C( 350.09), SIMDE_FLOAT32_C( 390.31) },
+      { SIMDE_FLOAT32_C(   0.040904), SIMDE_FLOAT32_C( 394.51), SIMDE_FLOAT32_C(-567.23), SIMDE_FLOAT32_C(   0.041370),
+        SIMDE_FLOAT32_C( 551.32), SIMDE_FLOAT32_C(   0.099874), SIMDE_FLOAT32_C(-768.76), SIMDE_FLOAT32_C(-838.40),
+        SIMDE_FLOAT32_C(   0.040010), SIMDE_FLOAT32_C(   0.044864), SIMDE_FLOAT32_C(   0.053152), SIMDE_FLOAT32_C( 662.03),
+        SIMDE_FLOAT32_C(   0.042480), SIMDE_FLOAT32_C( 645.35), SIMDE_FLOAT32_C(  51.24), SIMDE_FLOAT32_C(   0.050617) } },
+    { { SIMDE_FLOAT32_C( 229.14), SIMDE_FLOAT32_C( 679.32), SIMDE_FLOAT32_C(  54.47), SIMDE_FLOAT32_C(-910.88),
+        SIMDE_FLOAT32_C( 238.78), SIMDE_FLOAT32_C(  11.46), SIMDE_FLOAT32_C( 672.79), SIMDE_FLOAT32_C( 558.44),
+        SIMDE_FLOAT32_C(-163.17), SIMDE_FLOAT32_C(-515.06), SIMDE_FLOAT32_C( -46.97), SIMDE_FLOAT32_C(-835.89),
+        SIMDE_FLOAT32_C(-736.34), SIMDE_FLOAT32_C( 598.26), SIMDE_FLOAT32_C( 127.48), SIMDE_FLOAT32_C(-928.78) },
+      UINT16_C(36746),
+      { SIMDE_FLOAT32_C(  36.29), SIMDE_FLOAT32_C( 631.16), SIMDE_FLOAT32_C( 692.32), SIMDE_FLOAT32_C( 616.51),
+        SIMDE_FLOAT32_C( 669.45), SIMDE_FLOAT32_C( 365.15), SIMDE_FLOAT32_C( 884.93), SIMDE_FLOAT32_C( 967.20),
+        SIMDE_FLOAT32_C( 320.88), SIMDE_FLOAT32_C( 452.90), SIMDE_FLOAT32_C( 460.64), SIMDE_FLOAT32_C( 784.43),
+        SIMDE_FLOAT32_C( 164.87), SIMDE_FLOAT32_C( 373.96), SIMDE_FLOAT32_C( 202.46), SIMDE_FLOAT32_C( 724.83) },
+      { SIMDE_FLOAT32_C( 229.14), SIMDE_FLOAT32_C(   0.039805), SIMDE_FLOAT32_C(  54.47), SIMDE_FLOAT32_C(   0.040276),
+        SIMDE_FLOAT32_C( 238.78), SIMDE_FLOAT32_C(  11.46), SIMDE_FLOAT32_C( 672.79), SIMDE_FLOAT32_C(   0.032155),
+        SIMDE_FLOAT32_C(   0.055825), SIMDE_FLOAT32_C(   0.046989), SIMDE_FLOAT32_C(   0.046594), SIMDE_FLOAT32_C(   0.035704),
+        SIMDE_FLOAT32_C(-736.34), SIMDE_FLOAT32_C( 598.26), SIMDE_FLOAT32_C( 127.48), SIMDE_FLOAT32_C(   0.037144) } },
+    { { SIMDE_FLOAT32_C( 923.21), SIMDE_FLOAT32_C(-667.03), SIMDE_FLOAT32_C( 766.53), SIMDE_FLOAT32_C(-160.57),
+        SIMDE_FLOAT32_C(-871.04), SIMDE_FLOAT32_C(-485.05), SIMDE_FLOAT32_C(-226.64), SIMDE_FLOAT32_C(-887.97),
+        SIMDE_FLOAT32_C(-469.17), SIMDE_FLOAT32_C(  95.81), SIMDE_FLOAT32_C( -93.93), SIMDE_FLOAT32_C(-882.85),
+        SIMDE_FLOAT32_C( 434.61), SIMDE_FLOAT32_C( 315.45), SIMDE_FLOAT32_C(-651.74), SIMDE_FLOAT32_C( 408.44) },
+      UINT16_C(55088),
+      { SIMDE_FLOAT32_C( 376.62), SIMDE_FLOAT32_C(  97.65), SIMDE_FLOAT32_C( 573.40), SIMDE_FLOAT32_C( 395.94),
+        SIMDE_FLOAT32_C(  78.34), SIMDE_FLOAT32_C(   1.87), SIMDE_FLOAT32_C( 593.09), SIMDE_FLOAT32_C( 605.07),
+        SIMDE_FLOAT32_C( 529.52), SIMDE_FLOAT32_C(  21.10), SIMDE_FLOAT32_C( 577.52), SIMDE_FLOAT32_C(  51.42),
+        SIMDE_FLOAT32_C( 743.28), SIMDE_FLOAT32_C( 621.28), SIMDE_FLOAT32_C( 726.02), SIMDE_FLOAT32_C( 852.93) },
+      { SIMDE_FLOAT32_C( 923.21), SIMDE_FLOAT32_C(-667.03), SIMDE_FLOAT32_C( 766.53), SIMDE_FLOAT32_C(-160.57),
+        SIMDE_FLOAT32_C(   0.112982), SIMDE_FLOAT32_C(   0.731277), SIMDE_FLOAT32_C(-226.64), SIMDE_FLOAT32_C(-887.97),
+        SIMDE_FLOAT32_C(   0.043456), SIMDE_FLOAT32_C(   0.217703), SIMDE_FLOAT32_C(   0.041612), SIMDE_FLOAT32_C(-882.85),
+        SIMDE_FLOAT32_C(   0.036681), SIMDE_FLOAT32_C( 315.45), SIMDE_FLOAT32_C(   0.037114), SIMDE_FLOAT32_C(   0.034241) } },
+    { { SIMDE_FLOAT32_C(-827.12), SIMDE_FLOAT32_C( 540.15), SIMDE_FLOAT32_C( 582.59), SIMDE_FLOAT32_C(-997.92),
+        SIMDE_FLOAT32_C(-869.99), SIMDE_FLOAT32_C(-235.25), SIMDE_FLOAT32_C(-546.39), SIMDE_FLOAT32_C( 908.77),
+        SIMDE_FLOAT32_C( 587.49), SIMDE_FLOAT32_C(-347.05), SIMDE_FLOAT32_C( 313.01), SIMDE_FLOAT32_C(-803.16),
+        SIMDE_FLOAT32_C(-584.00), SIMDE_FLOAT32_C( 652.39), SIMDE_FLOAT32_C(-587.91), SIMDE_FLOAT32_C( 577.70) },
+      UINT16_C( 7845),
+      { SIMDE_FLOAT32_C( 935.73), SIMDE_FLOAT32_C( 105.12), SIMDE_FLOAT32_C( 953.37), SIMDE_FLOAT32_C( 583.19),
+        SIMDE_FLOAT32_C(  59.04), SIMDE_FLOAT32_C( 520.48), SIMDE_FLOAT32_C( 771.88), SIMDE_FLOAT32_C( 462.61),
+        SIMDE_FLOAT32_C( 707.01), SIMDE_FLOAT32_C( 639.51), SIMDE_FLOAT32_C( 916.60), SIMDE_FLOAT32_C( 708.05),
+        SIMDE_FLOAT32_C( 884.30), SIMDE_FLOAT32_C( 685.29), SIMDE_FLOAT32_C( 895.07), SIMDE_FLOAT32_C( 410.09) },
+      { SIMDE_FLOAT32_C(   0.032691), SIMDE_FLOAT32_C( 540.15), SIMDE_FLOAT32_C(   0.032388), SIMDE_FLOAT32_C(-997.92),
+        SIMDE_FLOAT32_C(-869.99), SIMDE_FLOAT32_C(   0.043835), SIMDE_FLOAT32_C(-546.39), SIMDE_FLOAT32_C(   0.046494),
+        SIMDE_FLOAT32_C( 587.49), SIMDE_FLOAT32_C(   0.039544), SIMDE_FLOAT32_C(   0.033031), SIMDE_FLOAT32_C(   0.037581),
+        SIMDE_FLOAT32_C(   0.033628), SIMDE_FLOAT32_C( 652.39), SIMDE_FLOAT32_C(-587.91), SIMDE_FLOAT32_C( 577.70) } },
+    { { SIMDE_FLOAT32_C(-498.70), SIMDE_FLOAT32_C( 428.42), SIMDE_FLOAT32_C(-901.01), SIMDE_FLOAT32_C( 178.73),
+        SIMDE_FLOAT32_C( 923.54), SIMDE_FLOAT32_C( -96.05), SIMDE_FLOAT32_C( 699.29), SIMDE_FLOAT32_C(-110.35),
+        SIMDE_FLOAT32_C(-707.42), SIMDE_FLOAT32_C(-398.60), SIMDE_FLOAT32_C(-569.30), SIMDE_FLOAT32_C(-435.43),
+        SIMDE_FLOAT32_C(  20.06), SIMDE_FLOAT32_C(-296.32), SIMDE_FLOAT32_C( 842.15), SIMDE_FLOAT32_C( 688.75) },
+      UINT16_C( 9584),
+      { SIMDE_FLOAT32_C( 450.77), SIMDE_FLOAT32_C( 620.33), SIMDE_FLOAT32_C( 665.17), SIMDE_FLOAT32_C( 758.00),
+        SIMDE_FLOAT32_C( 296.12), SIMDE_FLOAT32_C( 425.59), SIMDE_FLOAT32_C( 570.58), SIMDE_FLOAT32_C( 657.12),
+        SIMDE_FLOAT32_C( 316.85), SIMDE_FLOAT32_C( 910.85), SIMDE_FLOAT32_C( 128.67), SIMDE_FLOAT32_C( 485.91),
+        SIMDE_FLOAT32_C( 713.75), SIMDE_FLOAT32_C( 249.59), SIMDE_FLOAT32_C(  13.23), SIMDE_FLOAT32_C( 569.32) },
+      { SIMDE_FLOAT32_C(-498.70), SIMDE_FLOAT32_C( 428.42), SIMDE_FLOAT32_C(-901.01), SIMDE_FLOAT32_C( 178.73),
+        SIMDE_FLOAT32_C(   0.058110), SIMDE_FLOAT32_C(   0.048474), SIMDE_FLOAT32_C(   0.041865), SIMDE_FLOAT32_C(-110.35),
+        SIMDE_FLOAT32_C(   0.056180), SIMDE_FLOAT32_C(-398.60), SIMDE_FLOAT32_C(   0.088159), SIMDE_FLOAT32_C(-435.43),
+        SIMDE_FLOAT32_C(  20.06), SIMDE_FLOAT32_C(   0.063298), SIMDE_FLOAT32_C( 842.15), SIMDE_FLOAT32_C( 688.75) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_rsqrt14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT16_C(25772),
+      { SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00),   SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -1.00),        SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   4.00), SIMDE_FLOAT32_C(  -0.00), SIMDE_FLOAT32_C(   0.25), SIMDE_FLOAT32_C(   1.00) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   0.00),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   1.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00),      -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   2.00), SIMDE_FLOAT32_C(   0.00) } },
+    #endif
+    { UINT16_C(62936),
+      { SIMDE_FLOAT32_C(   5.62), SIMDE_FLOAT32_C( 121.52), SIMDE_FLOAT32_C( 326.13), SIMDE_FLOAT32_C( 348.81),
+        SIMDE_FLOAT32_C( 365.11), SIMDE_FLOAT32_C( 582.58), SIMDE_FLOAT32_C( 333.37), SIMDE_FLOAT32_C( 880.85),
+        SIMDE_FLOAT32_C( 757.65), SIMDE_FLOAT32_C( 693.09), SIMDE_FLOAT32_C( 116.72), SIMDE_FLOAT32_C( 777.80),
+        SIMDE_FLOAT32_C( 513.49), SIMDE_FLOAT32_C( 116.32), SIMDE_FLOAT32_C( 938.06), SIMDE_FLOAT32_C( 883.06) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.053545),
+        SIMDE_FLOAT32_C(   0.052336), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.054770), SIMDE_FLOAT32_C(   0.033693),
+        SIMDE_FLOAT32_C(   0.036331), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.092563), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.044129), SIMDE_FLOAT32_C(   0.092721), SIMDE_FLOAT32_C(   0.032650), SIMDE_FLOAT32_C(   0.033652) } },
+    { UINT16_C(37733),
+      { SIMDE_FLOAT32_C( 940.56), SIMDE_FLOAT32_C( 763.62), SIMDE_FLOAT32_C(  10.41), SIMDE_FLOAT32_C( 182.16),
+        SIMDE_FLOAT32_C( 604.55), SIMDE_FLOAT32_C( 188.12), SIMDE_FLOAT32_C( 205.75), SIMDE_FLOAT32_C( 495.85),
+        SIMDE_FLOAT32_C( 428.32), SIMDE_FLOAT32_C( 548.12), SIMDE_FLOAT32_C( 504.00), SIMDE_FLOAT32_C( 431.00),
+        SIMDE_FLOAT32_C( 214.08), SIMDE_FLOAT32_C( 680.81), SIMDE_FLOAT32_C( 965.42), SIMDE_FLOAT32_C( 909.36) },
+      { SIMDE_FLOAT32_C(   0.032607), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.309944), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.072909), SIMDE_FLOAT32_C(   0.069716), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.048320), SIMDE_FLOAT32_C(   0.042714), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.068347), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.033161) } },
+    { UINT16_C(31291),
+      { SIMDE_FLOAT32_C( 535.86), SIMDE_FLOAT32_C( 314.17), SIMDE_FLOAT32_C( 967.42), SIMDE_FLOAT32_C( 114.74),
+        SIMDE_FLOAT32_C( 573.47), SIMDE_FLOAT32_C( 244.41), SIMDE_FLOAT32_C( 549.09), SIMDE_FLOAT32_C( 962.79),
+        SIMDE_FLOAT32_C( 948.90), SIMDE_FLOAT32_C( 511.20), SIMDE_FLOAT32_C( 870.48), SIMDE_FLOAT32_C(  19.81),
+        SIMDE_FLOAT32_C(  74.85), SIMDE_FLOAT32_C( 740.62), SIMDE_FLOAT32_C( 707.14), SIMDE_FLOAT32_C( 111.96) },
+      { SIMDE_FLOAT32_C(   0.043201), SIMDE_FLOAT32_C(   0.056419), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.093357),
+        SIMDE_FLOAT32_C(   0.041759), SIMDE_FLOAT32_C(   0.063965), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.044229), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.224684),
+        SIMDE_FLOAT32_C(   0.115589), SIMDE_FLOAT32_C(   0.036746), SIMDE_FLOAT32_C(   0.037605), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C( 4826),
+      { SIMDE_FLOAT32_C( 336.42), SIMDE_FLOAT32_C( 696.15), SIMDE_FLOAT32_C( 494.35), SIMDE_FLOAT32_C( 630.71),
+        SIMDE_FLOAT32_C( 430.90), SIMDE_FLOAT32_C(  69.90), SIMDE_FLOAT32_C( 896.00), SIMDE_FLOAT32_C( 720.66),
+        SIMDE_FLOAT32_C( 999.88), SIMDE_FLOAT32_C( 612.14), SIMDE_FLOAT32_C( 254.88), SIMDE_FLOAT32_C( 662.74),
+        SIMDE_FLOAT32_C( 877.95), SIMDE_FLOAT32_C( 774.10), SIMDE_FLOAT32_C( 738.96), SIMDE_FLOAT32_C( 946.49) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.037902), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.039820),
+        SIMDE_FLOAT32_C(   0.048174), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.033407), SIMDE_FLOAT32_C(   0.037250),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.040419), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.033750), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(17800),
+      { SIMDE_FLOAT32_C( 208.92), SIMDE_FLOAT32_C( 918.07), SIMDE_FLOAT32_C( 545.73), SIMDE_FLOAT32_C( 668.61),
+        SIMDE_FLOAT32_C( 169.31), SIMDE_FLOAT32_C( 718.02), SIMDE_FLOAT32_C( 308.49), SIMDE_FLOAT32_C( 979.05),
+        SIMDE_FLOAT32_C( 677.31), SIMDE_FLOAT32_C( 462.89), SIMDE_FLOAT32_C( 920.76), SIMDE_FLOAT32_C( 976.50),
+        SIMDE_FLOAT32_C( 458.29), SIMDE_FLOAT32_C( 115.86), SIMDE_FLOAT32_C( 201.33), SIMDE_FLOAT32_C( 296.04) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.038673),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.031960),
+        SIMDE_FLOAT32_C(   0.038425), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.032956), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.070477), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(16126),
+      { SIMDE_FLOAT32_C( 945.01), SIMDE_FLOAT32_C( 845.55), SIMDE_FLOAT32_C( 372.39), SIMDE_FLOAT32_C( 277.83),
+        SIMDE_FLOAT32_C( 834.49), SIMDE_FLOAT32_C( 480.62), SIMDE_FLOAT32_C( 457.60), SIMDE_FLOAT32_C( 750.18),
+        SIMDE_FLOAT32_C( 952.32), SIMDE_FLOAT32_C( 798.42), SIMDE_FLOAT32_C( 496.87), SIMDE_FLOAT32_C( 595.95),
+        SIMDE_FLOAT32_C(  44.51), SIMDE_FLOAT32_C( 897.68), SIMDE_FLOAT32_C( 363.08), SIMDE_FLOAT32_C( 379.09) },
+      { SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.034389), SIMDE_FLOAT32_C(   0.051822), SIMDE_FLOAT32_C(   0.059996),
+        SIMDE_FLOAT32_C(   0.034617), SIMDE_FLOAT32_C(   0.045614), SIMDE_FLOAT32_C(   0.046748), SIMDE_FLOAT32_C(   0.036510),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.035389), SIMDE_FLOAT32_C(   0.044862), SIMDE_FLOAT32_C(   0.040964),
+        SIMDE_FLOAT32_C(   0.149893), SIMDE_FLOAT32_C(   0.033376), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00) } },
+    { UINT16_C(54787),
+      { SIMDE_FLOAT32_C( 108.65), SIMDE_FLOAT32_C( 557.75), SIMDE_FLOAT32_C( 725.72), SIMDE_FLOAT32_C( 257.85),
+        SIMDE_FLOAT32_C( 654.00), SIMDE_FLOAT32_C( 418.00), SIMDE_FLOAT32_C( 782.01), SIMDE_FLOAT32_C( 887.60),
+        SIMDE_FLOAT32_C( 674.82), SIMDE_FLOAT32_C(  62.65), SIMDE_FLOAT32_C( 259.18), SIMDE_FLOAT32_C( 904.67),
+        SIMDE_FLOAT32_C( 897.64), SIMDE_FLOAT32_C( 300.97), SIMDE_FLOAT32_C( 158.21), SIMDE_FLOAT32_C( 507.79) },
+      { SIMDE_FLOAT32_C(   0.095939), SIMDE_FLOAT32_C(   0.042342), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.126341), SIMDE_FLOAT32_C(   0.062118), SIMDE_FLOAT32_C(   0.00),
+        SIMDE_FLOAT32_C(   0.033377), SIMDE_FLOAT32_C(   0.00), SIMDE_FLOAT32_C(   0.079506), SIMDE_FLOAT32_C(   0.044377) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_rsqrt14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  -1.00),         SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   4.00), SIMDE_FLOAT64_C(  -0.00), SIMDE_FLOAT64_C(   0.25), SIMDE_FLOAT64_C(   1.00) },
+      {        SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   0.00),             SIMDE_MATH_NAN,             SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   0.50),       -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   2.00), SIMDE_FLOAT64_C(   1.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C( 936.91), SIMDE_FLOAT64_C( 801.11), SIMDE_FLOAT64_C( 382.69), SIMDE_FLOAT64_C( 904.02),
+        SIMDE_FLOAT64_C( 875.63), SIMDE_FLOAT64_C( 279.11), SIMDE_FLOAT64_C(  33.47), SIMDE_FLOAT64_C( 548.83) },
+      { SIMDE_FLOAT64_C(   0.032670), SIMDE_FLOAT64_C(   0.035330), SIMDE_FLOAT64_C(   0.051118), SIMDE_FLOAT64_C(   0.033259),
+        SIMDE_FLOAT64_C(   0.033794), SIMDE_FLOAT64_C(   0.059855), SIMDE_FLOAT64_C(   0.172859), SIMDE_FLOAT64_C(   0.042686) } },
+    { { SIMDE_FLOAT64_C( 850.97), SIMDE_FLOAT64_C( 189.94), SIMDE_FLOAT64_C( 956.48), SIMDE_FLOAT64_C(  17.57),
+        SIMDE_FLOAT64_C( 166.49), SIMDE_FLOAT64_C( 774.78), SIMDE_FLOAT64_C(  56.64), SIMDE_FLOAT64_C( 671.43) },
+      { SIMDE_FLOAT64_C(   0.034280), SIMDE_FLOAT64_C(   0.072561), SIMDE_FLOAT64_C(   0.032335), SIMDE_FLOAT64_C(   0.238569),
+        SIMDE_FLOAT64_C(   0.077502), SIMDE_FLOAT64_C(   0.035927), SIMDE_FLOAT64_C(   0.132875), SIMDE_FLOAT64_C(   0.038591) } },
+    { { SIMDE_FLOAT64_C( 708.73), SIMDE_FLOAT64_C( 993.50), SIMDE_FLOAT64_C(  85.50), SIMDE_FLOAT64_C( 856.18),
+        SIMDE_FLOAT64_C( 493.54), SIMDE_FLOAT64_C(  84.18), SIMDE_FLOAT64_C( 393.14), SIMDE_FLOAT64_C( 627.30) },
+      { SIMDE_FLOAT64_C(   0.037564), SIMDE_FLOAT64_C(   0.031726), SIMDE_FLOAT64_C(   0.108149), SIMDE_FLOAT64_C(   0.034176),
+        SIMDE_FLOAT64_C(   0.045013), SIMDE_FLOAT64_C(   0.108991), SIMDE_FLOAT64_C(   0.050435), SIMDE_FLOAT64_C(   0.039927) } },
+    { { SIMDE_FLOAT64_C( 819.20), SIMDE_FLOAT64_C( 523.44), SIMDE_FLOAT64_C(  81.41), SIMDE_FLOAT64_C( 318.84),
+        SIMDE_FLOAT64_C( 457.80), SIMDE_FLOAT64_C( 193.77), SIMDE_FLOAT64_C( 699.50), SIMDE_FLOAT64_C( 499.71) },
+      { SIMDE_FLOAT64_C(   0.034939), SIMDE_FLOAT64_C(   0.043710), SIMDE_FLOAT64_C(   0.110834), SIMDE_FLOAT64_C(   0.056003),
+        SIMDE_FLOAT64_C(   0.046737), SIMDE_FLOAT64_C(   0.071839), SIMDE_FLOAT64_C(   0.037810), SIMDE_FLOAT64_C(   0.044735) } },
+    { { SIMDE_FLOAT64_C( 343.20), SIMDE_FLOAT64_C(   3.34), SIMDE_FLOAT64_C( 514.45), SIMDE_FLOAT64_C( 956.41),
+        SIMDE_FLOAT64_C( 975.62), SIMDE_FLOAT64_C( 435.03), SIMDE_FLOAT64_C( 703.63), SIMDE_FLOAT64_C( 978.52) },
+      { SIMDE_FLOAT64_C(   0.053979), SIMDE_FLOAT64_C(   0.547188), SIMDE_FLOAT64_C(   0.044089), SIMDE_FLOAT64_C(   0.032336),
+        SIMDE_FLOAT64_C(   0.032015), SIMDE_FLOAT64_C(   0.047945), SIMDE_FLOAT64_C(   0.037698), SIMDE_FLOAT64_C(   0.031968) } },
+    { { SIMDE_FLOAT64_C( 418.85), SIMDE_FLOAT64_C( 229.66), SIMDE_FLOAT64_C( 782.01), SIMDE_FLOAT64_C( 231.16),
+        SIMDE_FLOAT64_C(  61.18), SIMDE_FLOAT64_C( 364.10), SIMDE_FLOAT64_C( 954.42), SIMDE_FLOAT64_C( 477.77) },
+      { SIMDE_FLOAT64_C(   0.048863), SIMDE_FLOAT64_C(   0.065988), SIMDE_FLOAT64_C(   0.035759), SIMDE_FLOAT64_C(   0.065773),
+        SIMDE_FLOAT64_C(   0.127848), SIMDE_FLOAT64_C(   0.052409), SIMDE_FLOAT64_C(   0.032370), SIMDE_FLOAT64_C(   0.045751) } },
+    { { SIMDE_FLOAT64_C( 668.11), SIMDE_FLOAT64_C( 684.09), SIMDE_FLOAT64_C( 138.56), SIMDE_FLOAT64_C(  26.13),
+        SIMDE_FLOAT64_C( 368.30), SIMDE_FLOAT64_C( 324.70), SIMDE_FLOAT64_C( 304.47), SIMDE_FLOAT64_C( 173.82) },
+      { SIMDE_FLOAT64_C(   0.038688), SIMDE_FLOAT64_C(   0.038234), SIMDE_FLOAT64_C(   0.084956), SIMDE_FLOAT64_C(   0.195629),
+        SIMDE_FLOAT64_C(   0.052107), SIMDE_FLOAT64_C(   0.055497), SIMDE_FLOAT64_C(   0.057308), SIMDE_FLOAT64_C(   0.075851) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_rsqrt14_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { { SIMDE_FLOAT64_C( 152.02), SIMDE_FLOAT64_C( 253.04), SIMDE_FLOAT64_C(-119.09), SIMDE_FLOAT64_C(-609.20),
+        SIMDE_FLOAT64_C(-320.21), SIMDE_FLOAT64_C( 728.66), SIMDE_FLOAT64_C( 362.72), SIMDE_FLOAT64_C( 895.72) },
+      UINT8_C(  202),
+      { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  -1.00),         SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   4.00), SIMDE_FLOAT64_C(  -0.00), SIMDE_FLOAT64_C(   0.25), SIMDE_FLOAT64_C(   1.00) },
+      { SIMDE_FLOAT64_C( 152.02), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(-119.09),             SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(-320.21), SIMDE_FLOAT64_C( 728.66), SIMDE_FLOAT64_C(   2.00), SIMDE_FLOAT64_C(   1.00) } },
+    #endif
+    { { SIMDE_FLOAT64_C( 850.38), SIMDE_FLOAT64_C( 388.70), SIMDE_FLOAT64_C( 481.69), SIMDE_FLOAT64_C( 819.62),
+        SIMDE_FLOAT64_C( 565.78), SIMDE_FLOAT64_C(-721.49), SIMDE_FLOAT64_C( 594.42), SIMDE_FLOAT64_C( 197.93) },
+      UINT8_C(   78),
+      { SIMDE_FLOAT64_C( 693.45), SIMDE_FLOAT64_C( 228.08), SIMDE_FLOAT64_C( 604.86), SIMDE_FLOAT64_C( 333.66),
+        SIMDE_FLOAT64_C( 826.15), SIMDE_FLOAT64_C( 707.28), SIMDE_FLOAT64_C( 458.92), SIMDE_FLOAT64_C( 341.97) },
+      { SIMDE_FLOAT64_C( 850.38), SIMDE_FLOAT64_C(   0.066215), SIMDE_FLOAT64_C(   0.040660), SIMDE_FLOAT64_C(   0.054747),
+        SIMDE_FLOAT64_C( 565.78), SIMDE_FLOAT64_C(-721.49), SIMDE_FLOAT64_C(   0.046681), SIMDE_FLOAT64_C( 197.93) } },
+    { { SIMDE_FLOAT64_C( 174.34), SIMDE_FLOAT64_C(-304.33), SIMDE_FLOAT64_C(-675.40), SIMDE_FLOAT64_C(-870.15),
+        SIMDE_FLOAT64_C(-191.51), SIMDE_FLOAT64_C(-672.20), SIMDE_FLOAT64_C( -52.62), SIMDE_FLOAT64_C(-675.27) },
+      UINT8_C(  115),
+      { SIMDE_FLOAT64_C( 705.15), SIMDE_FLOAT64_C( 699.93), SIMDE_FLOAT64_C( 673.24), SIMDE_FLOAT64_C( 928.69),
+        SIMDE_FLOAT64_C( 162.94), SIMDE_FLOAT64_C(   6.95), SIMDE_FLOAT64_C( 340.24), SIMDE_FLOAT64_C( 780.07) },
+      { SIMDE_FLOAT64_C(   0.037658), SIMDE_FLOAT64_C(   0.037799), SIMDE_FLOAT64_C(-675.40), SIMDE_FLOAT64_C(-870.15),
+        SIMDE_FLOAT64_C(   0.078341), SIMDE_FLOAT64_C(   0.379326), SIMDE_FLOAT64_C(   0.054215), SIMDE_FLOAT64_C(-675.27) } },
+    { { SIMDE_FLOAT64_C( 918.09), SIMDE_FLOAT64_C( 872.11), SIMDE_FLOAT64_C( 653.86), SIMDE_FLOAT64_C( 194.57),
+        SIMDE_FLOAT64_C( 791.52), SIMDE_FLOAT64_C(  59.33), SIMDE_FLOAT64_C(  74.14), SIMDE_FLOAT64_C(-471.55) },
+      UINT8_C(  118),
+      { SIMDE_FLOAT64_C( 452.65), SIMDE_FLOAT64_C( 857.66), SIMDE_FLOAT64_C( 177.86), SIMDE_FLOAT64_C( 362.47),
+        SIMDE_FLOAT64_C( 516.12), SIMDE_FLOAT64_C( 997.51), SIMDE_FLOAT64_C(  37.25), SIMDE_FLOAT64_C( 162.14) },
+      { SIMDE_FLOAT64_C( 918.09), SIMDE_FLOAT64_C(   0.034147), SIMDE_FLOAT64_C(   0.074985), SIMDE_FLOAT64_C( 194.57),
+        SIMDE_FLOAT64_C(   0.044019), SIMDE_FLOAT64_C(   0.031662), SIMDE_FLOAT64_C(   0.163849), SIMDE_FLOAT64_C(-471.55) } },
+    { { SIMDE_FLOAT64_C(-557.51), SIMDE_FLOAT64_C(  93.74), SIMDE_FLOAT64_C(-605.83), SIMDE_FLOAT64_C(-879.41),
+        SIMDE_FLOAT64_C(-645.94), SIMDE_FLOAT64_C(-410.09), SIMDE_FLOAT64_C(-215.83), SIMDE_FLOAT64_C( 501.68) },
+      UINT8_C(   25),
+      { SIMDE_FLOAT64_C( 263.56), SIMDE_FLOAT64_C( 445.44), SIMDE_FLOAT64_C( 404.80), SIMDE_FLOAT64_C( 782.78),
+        SIMDE_FLOAT64_C( 905.97), SIMDE_FLOAT64_C( 167.53), SIMDE_FLOAT64_C( 187.96), SIMDE_FLOAT64_C( 528.64) },
+      { SIMDE_FLOAT64_C(   0.061595), SIMDE_FLOAT64_C(  93.74), SIMDE_FLOAT64_C(-605.83), SIMDE_FLOAT64_C(   0.035741),
+        SIMDE_FLOAT64_C(   0.033224), SIMDE_FLOAT64_C(-410.09), SIMDE_FLOAT64_C(-215.83), SIMDE_FLOAT64_C( 501.68) } },
+    { { SIMDE_FLOAT64_C(-640.29), SIMDE_FLOAT64_C( 572.53), SIMDE_FLOAT64_C(-603.88), SIMDE_FLOAT64_C( 768.40),
+        SIMDE_FLOAT64_C(-713.30), SIMDE_FLOAT64_C( 251.33), SIMDE_FLOAT64_C(-505.52), SIMDE_FLOAT64_C( 476.52) },
+      UINT8_C(  197),
+      { SIMDE_FLOAT64_C( 152.75), SIMDE_FLOAT64_C( 762.52), SIMDE_FLOAT64_C( 537.83), SIMDE_FLOAT64_C( 628.49),
+        SIMDE_FLOAT64_C( 223.50), SIMDE_FLOAT64_C( 186.16), SIMDE_FLOAT64_C( 696.94), SIMDE_FLOAT64_C( 808.26) },
+      { SIMDE_FLOAT64_C(   0.080912), SIMDE_FLOAT64_C( 572.53), SIMDE_FLOAT64_C(   0.043122), SIMDE_FLOAT64_C( 768.40),
+        SIMDE_FLOAT64_C(-713.30), SIMDE_FLOAT64_C( 251.33), SIMDE_FLOAT64_C(   0.037880), SIMDE_FLOAT64_C(   0.035175) } },
+    { { SIMDE_FLOAT64_C(-534.64), SIMDE_FLOAT64_C(  25.34), SIMDE_FLOAT64_C(-190.49), SIMDE_FLOAT64_C( 154.32),
+        SIMDE_FLOAT64_C( 986.00), SIMDE_FLOAT64_C(-125.55), SIMDE_FLOAT64_C( -35.57), SIMDE_FLOAT64_C( 239.54) },
+      UINT8_C(  101),
+      { SIMDE_FLOAT64_C( 534.27), SIMDE_FLOAT64_C( 222.04), SIMDE_FLOAT64_C( 196.14), SIMDE_FLOAT64_C( 360.00),
+        SIMDE_FLOAT64_C( 994.49), SIMDE_FLOAT64_C(  88.83), SIMDE_FLOAT64_C( 902.00), SIMDE_FLOAT64_C( 280.11) },
+      { SIMDE_FLOAT64_C(   0.043265), SIMDE_FLOAT64_C(  25.34), SIMDE_FLOAT64_C(   0.071402), SIMDE_FLOAT64_C( 154.32),
+        SIMDE_FLOAT64_C( 986.00), SIMDE_FLOAT64_C(   0.106104), SIMDE_FLOAT64_C(   0.033297), SIMDE_FLOAT64_C( 239.54) } },
+    { { SIMDE_FLOAT64_C( 623.81), SIMDE_FLOAT64_C(-846.40), SIMDE_FLOAT64_C(  53.06), SIMDE_FLOAT64_C( 712.36),
+        SIMDE_FLOAT64_C(-450.32), SIMDE_FLOAT64_C(-536.07), SIMDE_FLOAT64_C( 364.21), SIMDE_FLOAT64_C( 454.18) },
+      UINT8_C(  159),
+      { SIMDE_FLOAT64_C( 915.32), SIMDE_FLOAT64_C( 334.97), SIMDE_FLOAT64_C( 709.59), SIMDE_FLOAT64_C( 777.79),
+        SIMDE_FLOAT64_C( 191.37), SIMDE_FLOAT64_C( 903.76), SIMDE_FLOAT64_C( 935.29), SIMDE_FLOAT64_C( 916.00) },
+      { SIMDE_FLOAT64_C(   0.033053), SIMDE_FLOAT64_C(   0.054638), SIMDE_FLOAT64_C(   0.037541), SIMDE_FLOAT64_C(   0.035857),
+        SIMDE_FLOAT64_C(   0.072288), SIMDE_FLOAT64_C(-536.07), SIMDE_FLOAT64_C( 364.21), SIMDE_FLOAT64_C(   0.033041) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_rsqrt14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_MATH)
+    { UINT8_C(    6),
+      { SIMDE_FLOAT64_C(   0.00),    SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  -1.00),         SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   4.00), SIMDE_FLOAT64_C(  -0.00), SIMDE_FLOAT64_C(   0.25), SIMDE_FLOAT64_C(   1.00) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),             SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    #endif
+    { UINT8_C(  114),
+      { SIMDE_FLOAT64_C( 262.09), SIMDE_FLOAT64_C( 411.38), SIMDE_FLOAT64_C( 771.50), SIMDE_FLOAT64_C( 485.30),
+        SIMDE_FLOAT64_C( 191.21), SIMDE_FLOAT64_C( 666.43), SIMDE_FLOAT64_C( 976.22), SIMDE_FLOAT64_C( 649.35) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.049304), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.072318), SIMDE_FLOAT64_C(   0.038738), SIMDE_FLOAT64_C(   0.032005), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  146),
+      { SIMDE_FLOAT64_C( 401.12), SIMDE_FLOAT64_C( 332.65), SIMDE_FLOAT64_C(  33.07), SIMDE_FLOAT64_C( 442.24),
+        SIMDE_FLOAT64_C( 844.87), SIMDE_FLOAT64_C( 767.75), SIMDE_FLOAT64_C( 954.62), SIMDE_FLOAT64_C( 109.56) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.054830), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.034404), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.095538) } },
+    { UINT8_C(    8),
+      { SIMDE_FLOAT64_C( 187.71), SIMDE_FLOAT64_C( 507.10), SIMDE_FLOAT64_C( 159.91), SIMDE_FLOAT64_C(  93.67),
+        SIMDE_FLOAT64_C(  98.07), SIMDE_FLOAT64_C( 194.13), SIMDE_FLOAT64_C( 477.73), SIMDE_FLOAT64_C(  81.15) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.103323),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(   90),
+      { SIMDE_FLOAT64_C( 922.00), SIMDE_FLOAT64_C(  37.10), SIMDE_FLOAT64_C(  36.17), SIMDE_FLOAT64_C( 733.99),
+        SIMDE_FLOAT64_C( 284.10), SIMDE_FLOAT64_C( 460.20), SIMDE_FLOAT64_C( 481.08), SIMDE_FLOAT64_C( 876.15) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.164175), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.036911),
+        SIMDE_FLOAT64_C(   0.059331), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.045592), SIMDE_FLOAT64_C(   0.00) } },
+    { UINT8_C(  153),
+      { SIMDE_FLOAT64_C( 511.11), SIMDE_FLOAT64_C( 379.27), SIMDE_FLOAT64_C( 188.57), SIMDE_FLOAT64_C( 414.00),
+        SIMDE_FLOAT64_C( 607.79), SIMDE_FLOAT64_C( 591.33), SIMDE_FLOAT64_C( 394.48), SIMDE_FLOAT64_C( 736.02) },
+      { SIMDE_FLOAT64_C(   0.044232), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.049148),
+        SIMDE_FLOAT64_C(   0.040561), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.036859) } },
+    { UINT8_C(  140),
+      { SIMDE_FLOAT64_C( 723.52), SIMDE_FLOAT64_C( 360.00), SIMDE_FLOAT64_C( 399.82), SIMDE_FLOAT64_C( 458.34),
+        SIMDE_FLOAT64_C( 470.11), SIMDE_FLOAT64_C( 873.08), SIMDE_FLOAT64_C( 328.01), SIMDE_FLOAT64_C( 672.21) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.050010), SIMDE_FLOAT64_C(   0.046710),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.038569) } },
+    { UINT8_C(  226),
+      { SIMDE_FLOAT64_C( 760.72), SIMDE_FLOAT64_C( 771.45), SIMDE_FLOAT64_C( 277.74), SIMDE_FLOAT64_C( 963.63),
+        SIMDE_FLOAT64_C(  49.58), SIMDE_FLOAT64_C( 654.72), SIMDE_FLOAT64_C( 269.36), SIMDE_FLOAT64_C(  82.74) },
+      { SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.036004), SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.00),
+        SIMDE_FLOAT64_C(   0.00), SIMDE_FLOAT64_C(   0.039081), SIMDE_FLOAT64_C(   0.060932), SIMDE_FLOAT64_C(   0.109940) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_rsqrt14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rsqrt14_ps_bound)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rsqrt14_ps_bound)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rsqrt14_ps_bound)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rsqrt14_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -3151,6 +3151,122 @@ test_simde_mm512_maskz_sub_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm512_sub_ph (SIMDE_MUNIT_TEST_ARGS) {
+  struct {
+    simde_float16 a[32];
+    simde_float16 b[32];
+    simde_float16 r[32];
+  } test_vec[] = {
+    { { SIMDE_FLOAT16_VALUE(    84.12), SIMDE_FLOAT16_VALUE(    -1.43), SIMDE_FLOAT16_VALUE(   -53.53), SIMDE_FLOAT16_VALUE(    80.50),
+        SIMDE_FLOAT16_VALUE(   -91.25), SIMDE_FLOAT16_VALUE(     8.31), SIMDE_FLOAT16_VALUE(   -93.56), SIMDE_FLOAT16_VALUE(    71.56),
+        SIMDE_FLOAT16_VALUE(    45.75), SIMDE_FLOAT16_VALUE(   -40.94), SIMDE_FLOAT16_VALUE(   -98.88), SIMDE_FLOAT16_VALUE(   -80.00),
+        SIMDE_FLOAT16_VALUE(   -38.72), SIMDE_FLOAT16_VALUE(   -41.31), SIMDE_FLOAT16_VALUE(    69.88), SIMDE_FLOAT16_VALUE(    59.75),
+        SIMDE_FLOAT16_VALUE(   -67.31), SIMDE_FLOAT16_VALUE(    99.25), SIMDE_FLOAT16_VALUE(    20.03), SIMDE_FLOAT16_VALUE(   -30.95),
+        SIMDE_FLOAT16_VALUE(    -0.91), SIMDE_FLOAT16_VALUE(   -94.62), SIMDE_FLOAT16_VALUE(   -90.19), SIMDE_FLOAT16_VALUE(     1.71),
+        SIMDE_FLOAT16_VALUE(    54.94), SIMDE_FLOAT16_VALUE(    95.12), SIMDE_FLOAT16_VALUE(   -98.88), SIMDE_FLOAT16_VALUE(   -11.12),
+        SIMDE_FLOAT16_VALUE(     7.48), SIMDE_FLOAT16_VALUE(   -46.31), SIMDE_FLOAT16_VALUE(   -54.38), SIMDE_FLOAT16_VALUE(   -99.62) },
+      { SIMDE_FLOAT16_VALUE(    74.94), SIMDE_FLOAT16_VALUE(   -49.34), SIMDE_FLOAT16_VALUE(    78.75), SIMDE_FLOAT16_VALUE(    33.38),
+        SIMDE_FLOAT16_VALUE(    98.62), SIMDE_FLOAT16_VALUE(    20.62), SIMDE_FLOAT16_VALUE(    55.25), SIMDE_FLOAT16_VALUE(    14.05),
+        SIMDE_FLOAT16_VALUE(   -83.06), SIMDE_FLOAT16_VALUE(    43.62), SIMDE_FLOAT16_VALUE(    66.31), SIMDE_FLOAT16_VALUE(    80.50),
+        SIMDE_FLOAT16_VALUE(   -26.22), SIMDE_FLOAT16_VALUE(    14.87), SIMDE_FLOAT16_VALUE(    72.38), SIMDE_FLOAT16_VALUE(   -75.00),
+        SIMDE_FLOAT16_VALUE(    23.11), SIMDE_FLOAT16_VALUE(   -91.38), SIMDE_FLOAT16_VALUE(     8.30), SIMDE_FLOAT16_VALUE(    58.19),
+        SIMDE_FLOAT16_VALUE(   -28.91), SIMDE_FLOAT16_VALUE(   -83.62), SIMDE_FLOAT16_VALUE(   -54.09), SIMDE_FLOAT16_VALUE(    61.62),
+        SIMDE_FLOAT16_VALUE(    94.50), SIMDE_FLOAT16_VALUE(     7.82), SIMDE_FLOAT16_VALUE(    47.25), SIMDE_FLOAT16_VALUE(    18.27),
+        SIMDE_FLOAT16_VALUE(    87.75), SIMDE_FLOAT16_VALUE(    47.06), SIMDE_FLOAT16_VALUE(    65.88), SIMDE_FLOAT16_VALUE(   -80.19) },
+      { SIMDE_FLOAT16_VALUE(     9.19), SIMDE_FLOAT16_VALUE(    47.91), SIMDE_FLOAT16_VALUE(  -132.25), SIMDE_FLOAT16_VALUE(    47.12),
+        SIMDE_FLOAT16_VALUE(  -189.88), SIMDE_FLOAT16_VALUE(   -12.31), SIMDE_FLOAT16_VALUE(  -148.75), SIMDE_FLOAT16_VALUE(    57.50),
+        SIMDE_FLOAT16_VALUE(   128.75), SIMDE_FLOAT16_VALUE(   -84.56), SIMDE_FLOAT16_VALUE(  -165.25), SIMDE_FLOAT16_VALUE(  -160.50),
+        SIMDE_FLOAT16_VALUE(   -12.50), SIMDE_FLOAT16_VALUE(   -56.19), SIMDE_FLOAT16_VALUE(    -2.50), SIMDE_FLOAT16_VALUE(   134.75),
+        SIMDE_FLOAT16_VALUE(   -90.44), SIMDE_FLOAT16_VALUE(   190.62), SIMDE_FLOAT16_VALUE(   11.734), SIMDE_FLOAT16_VALUE(   -89.12),
+        SIMDE_FLOAT16_VALUE(    28.00), SIMDE_FLOAT16_VALUE(   -11.00), SIMDE_FLOAT16_VALUE(   -36.09), SIMDE_FLOAT16_VALUE(   -59.91),
+        SIMDE_FLOAT16_VALUE(   -39.56), SIMDE_FLOAT16_VALUE(    87.31), SIMDE_FLOAT16_VALUE(  -146.12), SIMDE_FLOAT16_VALUE(   -29.38),
+        SIMDE_FLOAT16_VALUE(   -80.25), SIMDE_FLOAT16_VALUE(   -93.38), SIMDE_FLOAT16_VALUE(  -120.25), SIMDE_FLOAT16_VALUE(   -19.44) } },
+    { { SIMDE_FLOAT16_VALUE(    76.38), SIMDE_FLOAT16_VALUE(   -46.28), SIMDE_FLOAT16_VALUE(     7.42), SIMDE_FLOAT16_VALUE(   -58.59),
+        SIMDE_FLOAT16_VALUE(   -46.50), SIMDE_FLOAT16_VALUE(     5.80), SIMDE_FLOAT16_VALUE(    50.03), SIMDE_FLOAT16_VALUE(    38.16),
+        SIMDE_FLOAT16_VALUE(    54.75), SIMDE_FLOAT16_VALUE(    22.38), SIMDE_FLOAT16_VALUE(   -12.64), SIMDE_FLOAT16_VALUE(   -56.19),
+        SIMDE_FLOAT16_VALUE(   -46.91), SIMDE_FLOAT16_VALUE(   -50.34), SIMDE_FLOAT16_VALUE(     3.58), SIMDE_FLOAT16_VALUE(   -60.25),
+        SIMDE_FLOAT16_VALUE(    27.55), SIMDE_FLOAT16_VALUE(    40.44), SIMDE_FLOAT16_VALUE(    83.00), SIMDE_FLOAT16_VALUE(   -80.25),
+        SIMDE_FLOAT16_VALUE(    84.50), SIMDE_FLOAT16_VALUE(   -66.75), SIMDE_FLOAT16_VALUE(    -2.04), SIMDE_FLOAT16_VALUE(    53.66),
+        SIMDE_FLOAT16_VALUE(   -79.75), SIMDE_FLOAT16_VALUE(    76.12), SIMDE_FLOAT16_VALUE(   -33.69), SIMDE_FLOAT16_VALUE(     4.76),
+        SIMDE_FLOAT16_VALUE(    -9.06), SIMDE_FLOAT16_VALUE(   -88.88), SIMDE_FLOAT16_VALUE(   -22.08), SIMDE_FLOAT16_VALUE(   -49.81) },
+      { SIMDE_FLOAT16_VALUE(    -3.28), SIMDE_FLOAT16_VALUE(    92.94), SIMDE_FLOAT16_VALUE(   -87.94), SIMDE_FLOAT16_VALUE(   -28.09),
+        SIMDE_FLOAT16_VALUE(     8.46), SIMDE_FLOAT16_VALUE(    82.56), SIMDE_FLOAT16_VALUE(   -92.56), SIMDE_FLOAT16_VALUE(   -10.81),
+        SIMDE_FLOAT16_VALUE(    80.25), SIMDE_FLOAT16_VALUE(    62.72), SIMDE_FLOAT16_VALUE(   -99.31), SIMDE_FLOAT16_VALUE(   -37.84),
+        SIMDE_FLOAT16_VALUE(   -50.38), SIMDE_FLOAT16_VALUE(   -48.56), SIMDE_FLOAT16_VALUE(   -43.00), SIMDE_FLOAT16_VALUE(   -60.47),
+        SIMDE_FLOAT16_VALUE(    30.12), SIMDE_FLOAT16_VALUE(    61.97), SIMDE_FLOAT16_VALUE(   -56.03), SIMDE_FLOAT16_VALUE(   -68.94),
+        SIMDE_FLOAT16_VALUE(   -66.44), SIMDE_FLOAT16_VALUE(    51.97), SIMDE_FLOAT16_VALUE(    73.56), SIMDE_FLOAT16_VALUE(     8.16),
+        SIMDE_FLOAT16_VALUE(    45.91), SIMDE_FLOAT16_VALUE(   -81.00), SIMDE_FLOAT16_VALUE(    43.19), SIMDE_FLOAT16_VALUE(    95.12),
+        SIMDE_FLOAT16_VALUE(    -8.11), SIMDE_FLOAT16_VALUE(  -100.00), SIMDE_FLOAT16_VALUE(   -78.19), SIMDE_FLOAT16_VALUE(   -47.44) },
+      { SIMDE_FLOAT16_VALUE(    79.62), SIMDE_FLOAT16_VALUE(  -139.25), SIMDE_FLOAT16_VALUE(    95.38), SIMDE_FLOAT16_VALUE(   -30.50),
+        SIMDE_FLOAT16_VALUE(   -54.97), SIMDE_FLOAT16_VALUE(   -76.75), SIMDE_FLOAT16_VALUE(   142.62), SIMDE_FLOAT16_VALUE(    48.97),
+        SIMDE_FLOAT16_VALUE(   -25.50), SIMDE_FLOAT16_VALUE(   -40.34), SIMDE_FLOAT16_VALUE(    86.69), SIMDE_FLOAT16_VALUE(   -18.34),
+        SIMDE_FLOAT16_VALUE(    3.469), SIMDE_FLOAT16_VALUE(   -1.781), SIMDE_FLOAT16_VALUE(    46.59), SIMDE_FLOAT16_VALUE(   0.2188),
+        SIMDE_FLOAT16_VALUE(   -2.578), SIMDE_FLOAT16_VALUE(   -21.53), SIMDE_FLOAT16_VALUE(   139.00), SIMDE_FLOAT16_VALUE(   -11.31),
+        SIMDE_FLOAT16_VALUE(   151.00), SIMDE_FLOAT16_VALUE(  -118.75), SIMDE_FLOAT16_VALUE(   -75.62), SIMDE_FLOAT16_VALUE(    45.50),
+        SIMDE_FLOAT16_VALUE(  -125.62), SIMDE_FLOAT16_VALUE(   157.12), SIMDE_FLOAT16_VALUE(   -76.88), SIMDE_FLOAT16_VALUE(   -90.38),
+        SIMDE_FLOAT16_VALUE(   -0.953), SIMDE_FLOAT16_VALUE(   11.125), SIMDE_FLOAT16_VALUE(    56.12), SIMDE_FLOAT16_VALUE(   -2.375) } },
+    { { SIMDE_FLOAT16_VALUE(    -6.46), SIMDE_FLOAT16_VALUE(    22.88), SIMDE_FLOAT16_VALUE(    96.25), SIMDE_FLOAT16_VALUE(   -95.44),
+        SIMDE_FLOAT16_VALUE(   -22.47), SIMDE_FLOAT16_VALUE(    47.97), SIMDE_FLOAT16_VALUE(    30.41), SIMDE_FLOAT16_VALUE(    38.28),
+        SIMDE_FLOAT16_VALUE(   -86.00), SIMDE_FLOAT16_VALUE(   -26.62), SIMDE_FLOAT16_VALUE(   -61.66), SIMDE_FLOAT16_VALUE(    27.94),
+        SIMDE_FLOAT16_VALUE(   -54.22), SIMDE_FLOAT16_VALUE(    57.16), SIMDE_FLOAT16_VALUE(   -94.19), SIMDE_FLOAT16_VALUE(    73.81),
+        SIMDE_FLOAT16_VALUE(   -26.23), SIMDE_FLOAT16_VALUE(   -90.50), SIMDE_FLOAT16_VALUE(    48.78), SIMDE_FLOAT16_VALUE(    -8.80),
+        SIMDE_FLOAT16_VALUE(   -72.50), SIMDE_FLOAT16_VALUE(    58.69), SIMDE_FLOAT16_VALUE(     6.93), SIMDE_FLOAT16_VALUE(    61.03),
+        SIMDE_FLOAT16_VALUE(   -15.14), SIMDE_FLOAT16_VALUE(   -36.38), SIMDE_FLOAT16_VALUE(    56.03), SIMDE_FLOAT16_VALUE(   -36.81),
+        SIMDE_FLOAT16_VALUE(    40.72), SIMDE_FLOAT16_VALUE(    10.66), SIMDE_FLOAT16_VALUE(   -87.19), SIMDE_FLOAT16_VALUE(    -3.68) },
+      { SIMDE_FLOAT16_VALUE(   -64.56), SIMDE_FLOAT16_VALUE(   -73.81), SIMDE_FLOAT16_VALUE(    49.78), SIMDE_FLOAT16_VALUE(    53.59),
+        SIMDE_FLOAT16_VALUE(    72.38), SIMDE_FLOAT16_VALUE(   -42.97), SIMDE_FLOAT16_VALUE(   -52.44), SIMDE_FLOAT16_VALUE(    88.50),
+        SIMDE_FLOAT16_VALUE(   -32.47), SIMDE_FLOAT16_VALUE(   -81.94), SIMDE_FLOAT16_VALUE(   -52.09), SIMDE_FLOAT16_VALUE(   -72.31),
+        SIMDE_FLOAT16_VALUE(    42.19), SIMDE_FLOAT16_VALUE(    86.88), SIMDE_FLOAT16_VALUE(    70.62), SIMDE_FLOAT16_VALUE(    -9.16),
+        SIMDE_FLOAT16_VALUE(   -46.56), SIMDE_FLOAT16_VALUE(     6.86), SIMDE_FLOAT16_VALUE(   -30.80), SIMDE_FLOAT16_VALUE(   -58.34),
+        SIMDE_FLOAT16_VALUE(    27.12), SIMDE_FLOAT16_VALUE(    80.94), SIMDE_FLOAT16_VALUE(     8.47), SIMDE_FLOAT16_VALUE(   -38.72),
+        SIMDE_FLOAT16_VALUE(   -12.54), SIMDE_FLOAT16_VALUE(   -85.38), SIMDE_FLOAT16_VALUE(    42.62), SIMDE_FLOAT16_VALUE(    33.91),
+        SIMDE_FLOAT16_VALUE(    79.25), SIMDE_FLOAT16_VALUE(    46.44), SIMDE_FLOAT16_VALUE(   -63.12), SIMDE_FLOAT16_VALUE(   -16.55) },
+      { SIMDE_FLOAT16_VALUE(    58.09), SIMDE_FLOAT16_VALUE(    96.69), SIMDE_FLOAT16_VALUE(    46.47), SIMDE_FLOAT16_VALUE(  -149.00),
+        SIMDE_FLOAT16_VALUE(   -94.88), SIMDE_FLOAT16_VALUE(    90.94), SIMDE_FLOAT16_VALUE(    82.88), SIMDE_FLOAT16_VALUE(   -50.22),
+        SIMDE_FLOAT16_VALUE(   -53.53), SIMDE_FLOAT16_VALUE(    55.31), SIMDE_FLOAT16_VALUE(    -9.56), SIMDE_FLOAT16_VALUE(   100.25),
+        SIMDE_FLOAT16_VALUE(   -96.38), SIMDE_FLOAT16_VALUE(   -29.72), SIMDE_FLOAT16_VALUE(  -164.75), SIMDE_FLOAT16_VALUE(    83.00),
+        SIMDE_FLOAT16_VALUE(    20.33), SIMDE_FLOAT16_VALUE(   -97.38), SIMDE_FLOAT16_VALUE(    79.56), SIMDE_FLOAT16_VALUE(    49.56),
+        SIMDE_FLOAT16_VALUE(   -99.62), SIMDE_FLOAT16_VALUE(   -22.25), SIMDE_FLOAT16_VALUE(   -1.539), SIMDE_FLOAT16_VALUE(    99.75),
+        SIMDE_FLOAT16_VALUE(   -2.602), SIMDE_FLOAT16_VALUE(    49.00), SIMDE_FLOAT16_VALUE(    13.41), SIMDE_FLOAT16_VALUE(   -70.75),
+        SIMDE_FLOAT16_VALUE(   -38.53), SIMDE_FLOAT16_VALUE(   -35.78), SIMDE_FLOAT16_VALUE(   -24.06), SIMDE_FLOAT16_VALUE(    12.87) } },
+    { { SIMDE_FLOAT16_VALUE(   -29.95), SIMDE_FLOAT16_VALUE(   -38.53), SIMDE_FLOAT16_VALUE(    58.78), SIMDE_FLOAT16_VALUE(   -23.98),
+        SIMDE_FLOAT16_VALUE(    18.70), SIMDE_FLOAT16_VALUE(   -61.12), SIMDE_FLOAT16_VALUE(    30.23), SIMDE_FLOAT16_VALUE(    67.56),
+        SIMDE_FLOAT16_VALUE(    25.08), SIMDE_FLOAT16_VALUE(   -27.62), SIMDE_FLOAT16_VALUE(     4.97), SIMDE_FLOAT16_VALUE(   -46.97),
+        SIMDE_FLOAT16_VALUE(   -13.35), SIMDE_FLOAT16_VALUE(    94.88), SIMDE_FLOAT16_VALUE(   -15.78), SIMDE_FLOAT16_VALUE(    89.69),
+        SIMDE_FLOAT16_VALUE(   -92.19), SIMDE_FLOAT16_VALUE(    24.86), SIMDE_FLOAT16_VALUE(    25.56), SIMDE_FLOAT16_VALUE(   -85.94),
+        SIMDE_FLOAT16_VALUE(   -82.19), SIMDE_FLOAT16_VALUE(    98.75), SIMDE_FLOAT16_VALUE(   -40.00), SIMDE_FLOAT16_VALUE(   -71.56),
+        SIMDE_FLOAT16_VALUE(   -35.97), SIMDE_FLOAT16_VALUE(   -23.14), SIMDE_FLOAT16_VALUE(   -14.76), SIMDE_FLOAT16_VALUE(    98.12),
+        SIMDE_FLOAT16_VALUE(   -17.20), SIMDE_FLOAT16_VALUE(   -48.78), SIMDE_FLOAT16_VALUE(    20.55), SIMDE_FLOAT16_VALUE(   -24.70) },
+      { SIMDE_FLOAT16_VALUE(    46.47), SIMDE_FLOAT16_VALUE(   -24.80), SIMDE_FLOAT16_VALUE(   -37.31), SIMDE_FLOAT16_VALUE(   -40.47),
+        SIMDE_FLOAT16_VALUE(    -8.76), SIMDE_FLOAT16_VALUE(   -29.20), SIMDE_FLOAT16_VALUE(     1.53), SIMDE_FLOAT16_VALUE(    82.62),
+        SIMDE_FLOAT16_VALUE(    68.12), SIMDE_FLOAT16_VALUE(   -31.84), SIMDE_FLOAT16_VALUE(     5.99), SIMDE_FLOAT16_VALUE(    69.06),
+        SIMDE_FLOAT16_VALUE(   -46.66), SIMDE_FLOAT16_VALUE(    30.64), SIMDE_FLOAT16_VALUE(   -99.62), SIMDE_FLOAT16_VALUE(    49.69),
+        SIMDE_FLOAT16_VALUE(   -72.62), SIMDE_FLOAT16_VALUE(   -24.98), SIMDE_FLOAT16_VALUE(   -12.69), SIMDE_FLOAT16_VALUE(    54.53),
+        SIMDE_FLOAT16_VALUE(   -36.34), SIMDE_FLOAT16_VALUE(   -10.30), SIMDE_FLOAT16_VALUE(   -42.62), SIMDE_FLOAT16_VALUE(    38.53),
+        SIMDE_FLOAT16_VALUE(   -56.28), SIMDE_FLOAT16_VALUE(    93.75), SIMDE_FLOAT16_VALUE(   -19.77), SIMDE_FLOAT16_VALUE(    13.79),
+        SIMDE_FLOAT16_VALUE(     4.53), SIMDE_FLOAT16_VALUE(   -98.25), SIMDE_FLOAT16_VALUE(   -73.31), SIMDE_FLOAT16_VALUE(   -79.94) },
+      { SIMDE_FLOAT16_VALUE(   -76.44), SIMDE_FLOAT16_VALUE(  -13.734), SIMDE_FLOAT16_VALUE(    96.12), SIMDE_FLOAT16_VALUE(    16.48),
+        SIMDE_FLOAT16_VALUE(    27.47), SIMDE_FLOAT16_VALUE(   -31.92), SIMDE_FLOAT16_VALUE(    28.70), SIMDE_FLOAT16_VALUE(   -15.06),
+        SIMDE_FLOAT16_VALUE(   -43.06), SIMDE_FLOAT16_VALUE(     4.22), SIMDE_FLOAT16_VALUE(    -1.02), SIMDE_FLOAT16_VALUE(  -116.00),
+        SIMDE_FLOAT16_VALUE(    33.31), SIMDE_FLOAT16_VALUE(    64.25), SIMDE_FLOAT16_VALUE(    83.88), SIMDE_FLOAT16_VALUE(    40.00),
+        SIMDE_FLOAT16_VALUE(   -19.56), SIMDE_FLOAT16_VALUE(    49.84), SIMDE_FLOAT16_VALUE(    38.25), SIMDE_FLOAT16_VALUE(  -140.50),
+        SIMDE_FLOAT16_VALUE(   -45.84), SIMDE_FLOAT16_VALUE(   109.06), SIMDE_FLOAT16_VALUE(    2.625), SIMDE_FLOAT16_VALUE(  -110.12),
+        SIMDE_FLOAT16_VALUE(    20.31), SIMDE_FLOAT16_VALUE(  -116.88), SIMDE_FLOAT16_VALUE(    5.008), SIMDE_FLOAT16_VALUE(    84.31),
+        SIMDE_FLOAT16_VALUE(   -21.73), SIMDE_FLOAT16_VALUE(    49.47), SIMDE_FLOAT16_VALUE(    93.88), SIMDE_FLOAT16_VALUE(    55.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512h a = simde_mm512_loadu_ph(test_vec[i].a);
+    simde__m512h b = simde_mm512_loadu_ph(test_vec[i].b);
+    simde_float16 r[32];
+    simde_mm512_storeu_ph(r, simde_mm512_sub_ph(a, b));
+    simde_assert_equal_vf16(sizeof(r) / sizeof(r[0]), r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sub_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_sub_epi8)
@@ -3173,6 +3289,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sub_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_sub_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_sub_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sub_ph)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
@@ -2549,7 +2549,7 @@ test_simde_mm_minpos_epu16(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
     simde__m128i a;
     simde__m128i r;
-  } test_vec[8] = {
+  } test_vec[] = {
     { simde_x_mm_set_epu16(UINT16_C(40818), UINT16_C(13812), UINT16_C(10872), UINT16_C(54124),
                            UINT16_C(15100), UINT16_C(22810), UINT16_C(31798), UINT16_C(58017)),
       simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
@@ -2581,7 +2581,32 @@ test_simde_mm_minpos_epu16(SIMDE_MUNIT_TEST_ARGS) {
     { simde_x_mm_set_epu16(UINT16_C(13431), UINT16_C(48627), UINT16_C(23340), UINT16_C(23935),
                            UINT16_C(12927), UINT16_C(48412), UINT16_C(33835), UINT16_C(15901)),
       simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
-                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    3), UINT16_C(12927)) }
+                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    3), UINT16_C(12927)) },
+    /* Ties: the lowest index wins. */
+    { simde_x_mm_set_epu16(UINT16_C(    7), UINT16_C(    7), UINT16_C(    7), UINT16_C(    7),
+                           UINT16_C(    7), UINT16_C(    7), UINT16_C(    7), UINT16_C(    7)),
+      simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    7)) },
+    { simde_x_mm_set_epu16(UINT16_C(  300), UINT16_C(   42), UINT16_C( 1000), UINT16_C(   42),
+                           UINT16_C(   42), UINT16_C(65535), UINT16_C(   42), UINT16_C(  900)),
+      simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    1), UINT16_C(   42)) },
+    { simde_x_mm_set_epu16(UINT16_C(65535), UINT16_C(65535), UINT16_C(65535), UINT16_C(65535),
+                           UINT16_C(65535), UINT16_C(65535), UINT16_C(65535), UINT16_C(65535)),
+      simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(65535)) },
+    { simde_x_mm_set_epu16(UINT16_C(    5), UINT16_C(  500), UINT16_C(    5), UINT16_C(  400),
+                           UINT16_C(    5), UINT16_C(  300), UINT16_C(  200), UINT16_C(  100)),
+      simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    3), UINT16_C(    5)) },
+    { simde_x_mm_set_epu16(UINT16_C(    1), UINT16_C(    0), UINT16_C(    1), UINT16_C(    0),
+                           UINT16_C(    1), UINT16_C(    0), UINT16_C(    1), UINT16_C(    0)),
+      simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0)) },
+    { simde_x_mm_set_epu16(UINT16_C( 8000), UINT16_C( 9000), UINT16_C( 9000), UINT16_C( 8000),
+                           UINT16_C( 9000), UINT16_C( 8000), UINT16_C( 9000), UINT16_C( 9000)),
+      simde_x_mm_set_epu16(UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0),
+                           UINT16_C(    0), UINT16_C(    0), UINT16_C(    2), UINT16_C( 8000)) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
@@ -2686,6 +2711,110 @@ test_simde_mm_mpsadbw_epu8(SIMDE_MUNIT_TEST_ARGS) {
     simde_assert_m128i_u16(r, ==, test_vec[i].r);
   }
 
+  /* Every immediate, since each one selects a different pair of
+   * offsets into a and b. */
+  const struct {
+    simde__m128i a;
+    simde__m128i b;
+    int imm8;
+    simde__m128i r;
+  } imm_vec[] = {
+      { simde_x_mm_set_epu8(UINT8_C(255), UINT8_C(255), UINT8_C(255), UINT8_C(255),
+                            UINT8_C(255), UINT8_C(255), UINT8_C(255), UINT8_C(255),
+                            UINT8_C(255), UINT8_C(255), UINT8_C(255), UINT8_C(255),
+                            UINT8_C(255), UINT8_C(255), UINT8_C(255), UINT8_C(255)),
+        simde_x_mm_set_epu8(UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                            UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                            UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0),
+                            UINT8_C(  0), UINT8_C(  0), UINT8_C(  0), UINT8_C(  0)),
+        0,
+        simde_x_mm_set_epu16(UINT16_C( 1020), UINT16_C( 1020), UINT16_C( 1020), UINT16_C( 1020),
+                             UINT16_C( 1020), UINT16_C( 1020), UINT16_C( 1020), UINT16_C( 1020)) },
+      { simde_x_mm_set_epu8(UINT8_C( 40), UINT8_C(168), UINT8_C(147), UINT8_C(117),
+                            UINT8_C(148), UINT8_C( 16), UINT8_C( 42), UINT8_C(153),
+                            UINT8_C( 85), UINT8_C(252), UINT8_C(158), UINT8_C(239),
+                            UINT8_C( 83), UINT8_C(116), UINT8_C(180), UINT8_C( 19)),
+        simde_x_mm_set_epu8(UINT8_C(154), UINT8_C( 24), UINT8_C(133), UINT8_C( 67),
+                            UINT8_C( 31), UINT8_C( 46), UINT8_C( 83), UINT8_C(228),
+                            UINT8_C( 92), UINT8_C(  4), UINT8_C(244), UINT8_C( 35),
+                            UINT8_C(218), UINT8_C(148), UINT8_C(205), UINT8_C(124)),
+        1,
+        simde_x_mm_set_epu16(UINT16_C(  255), UINT16_C(  575), UINT16_C(  273), UINT16_C(  545),
+                             UINT16_C(  367), UINT16_C(  543), UINT16_C(  499), UINT16_C(  201)) },
+      { simde_x_mm_set_epu8(UINT8_C(196), UINT8_C(115), UINT8_C(119), UINT8_C(165),
+                            UINT8_C(127), UINT8_C(245), UINT8_C(251), UINT8_C(184),
+                            UINT8_C(167), UINT8_C(  3), UINT8_C(250), UINT8_C( 18),
+                            UINT8_C( 99), UINT8_C( 28), UINT8_C(196), UINT8_C( 74)),
+        simde_x_mm_set_epu8(UINT8_C(213), UINT8_C(161), UINT8_C( 85), UINT8_C(  0),
+                            UINT8_C( 55), UINT8_C( 14), UINT8_C(255), UINT8_C(  0),
+                            UINT8_C(126), UINT8_C( 70), UINT8_C(189), UINT8_C(179),
+                            UINT8_C( 65), UINT8_C( 99), UINT8_C(189), UINT8_C(192)),
+        2,
+        simde_x_mm_set_epu16(UINT16_C(  665), UINT16_C(  457), UINT16_C(  784), UINT16_C(  146),
+                             UINT16_C(  624), UINT16_C(  383), UINT16_C(  545), UINT16_C(  191)) },
+      { simde_x_mm_set_epu8(UINT8_C(193), UINT8_C(187), UINT8_C(247), UINT8_C(134),
+                            UINT8_C( 66), UINT8_C(107), UINT8_C( 42), UINT8_C(155),
+                            UINT8_C(187), UINT8_C( 85), UINT8_C(222), UINT8_C(163),
+                            UINT8_C( 42), UINT8_C(205), UINT8_C(233), UINT8_C(115)),
+        simde_x_mm_set_epu8(UINT8_C(226), UINT8_C(117), UINT8_C( 79), UINT8_C( 97),
+                            UINT8_C(162), UINT8_C(204), UINT8_C( 58), UINT8_C(112),
+                            UINT8_C(193), UINT8_C(164), UINT8_C(101), UINT8_C( 24),
+                            UINT8_C(  1), UINT8_C( 93), UINT8_C( 17), UINT8_C( 47)),
+        3,
+        simde_x_mm_set_epu16(UINT16_C(  360), UINT16_C(  342), UINT16_C(  272), UINT16_C(  280),
+                             UINT16_C(  385), UINT16_C(  195), UINT16_C(  400), UINT16_C(  444)) },
+      { simde_x_mm_set_epu8(UINT8_C(156), UINT8_C( 38), UINT8_C(173), UINT8_C(113),
+                            UINT8_C( 61), UINT8_C( 43), UINT8_C(178), UINT8_C( 66),
+                            UINT8_C( 35), UINT8_C(  8), UINT8_C(129), UINT8_C(237),
+                            UINT8_C(  2), UINT8_C( 13), UINT8_C(230), UINT8_C( 29)),
+        simde_x_mm_set_epu8(UINT8_C( 11), UINT8_C(  5), UINT8_C(186), UINT8_C(  4),
+                            UINT8_C( 94), UINT8_C(178), UINT8_C(186), UINT8_C(163),
+                            UINT8_C(126), UINT8_C(  8), UINT8_C(  9), UINT8_C( 94),
+                            UINT8_C( 51), UINT8_C( 33), UINT8_C(118), UINT8_C( 92)),
+        4,
+        simde_x_mm_set_epu16(UINT16_C(  189), UINT16_C(  308), UINT16_C(  251), UINT16_C(  106),
+                             UINT16_C(  262), UINT16_C(  327), UINT16_C(  164), UINT16_C(  197)) },
+      { simde_x_mm_set_epu8(UINT8_C(200), UINT8_C( 45), UINT8_C(155), UINT8_C(100),
+                            UINT8_C(105), UINT8_C(140), UINT8_C(229), UINT8_C( 65),
+                            UINT8_C( 27), UINT8_C(242), UINT8_C(192), UINT8_C(115),
+                            UINT8_C( 44), UINT8_C( 55), UINT8_C( 91), UINT8_C( 13)),
+        simde_x_mm_set_epu8(UINT8_C(153), UINT8_C(130), UINT8_C( 70), UINT8_C(227),
+                            UINT8_C(189), UINT8_C( 13), UINT8_C( 63), UINT8_C(154),
+                            UINT8_C(242), UINT8_C(109), UINT8_C( 78), UINT8_C(137),
+                            UINT8_C(228), UINT8_C(164), UINT8_C( 19), UINT8_C(112)),
+        5,
+        simde_x_mm_set_epu16(UINT16_C(  297), UINT16_C(  126), UINT16_C(  300), UINT16_C(  391),
+                             UINT16_C(  345), UINT16_C(  213), UINT16_C(  478), UINT16_C(  484)) },
+      { simde_x_mm_set_epu8(UINT8_C(154), UINT8_C( 67), UINT8_C(144), UINT8_C( 38),
+                            UINT8_C(  2), UINT8_C( 43), UINT8_C(124), UINT8_C(215),
+                            UINT8_C(118), UINT8_C( 24), UINT8_C( 76), UINT8_C( 78),
+                            UINT8_C(229), UINT8_C(  1), UINT8_C(121), UINT8_C(151)),
+        simde_x_mm_set_epu8(UINT8_C( 48), UINT8_C(101), UINT8_C(194), UINT8_C(178),
+                            UINT8_C( 53), UINT8_C(178), UINT8_C(177), UINT8_C( 75),
+                            UINT8_C(130), UINT8_C(201), UINT8_C(252), UINT8_C(  9),
+                            UINT8_C(241), UINT8_C(186), UINT8_C(250), UINT8_C(192)),
+        6,
+        simde_x_mm_set_epu16(UINT16_C(  260), UINT16_C(  438), UINT16_C(  374), UINT16_C(  379),
+                             UINT16_C(  145), UINT16_C(  218), UINT16_C(  376), UINT16_C(  323)) },
+      { simde_x_mm_set_epu8(UINT8_C( 40), UINT8_C( 31), UINT8_C(188), UINT8_C(203),
+                            UINT8_C( 62), UINT8_C(  8), UINT8_C(214), UINT8_C(144),
+                            UINT8_C(228), UINT8_C(117), UINT8_C( 37), UINT8_C(143),
+                            UINT8_C(141), UINT8_C(  7), UINT8_C(186), UINT8_C( 14)),
+        simde_x_mm_set_epu8(UINT8_C(228), UINT8_C(209), UINT8_C( 66), UINT8_C( 90),
+                            UINT8_C( 85), UINT8_C( 82), UINT8_C( 40), UINT8_C(206),
+                            UINT8_C( 83), UINT8_C( 39), UINT8_C( 62), UINT8_C( 88),
+                            UINT8_C(100), UINT8_C(213), UINT8_C(178), UINT8_C(  8)),
+        7,
+        simde_x_mm_set_epu16(UINT16_C(  383), UINT16_C(  132), UINT16_C(  354), UINT16_C(  569),
+                             UINT16_C(  441), UINT16_C(  268), UINT16_C(  207), UINT16_C(  174)) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(imm_vec) / sizeof(imm_vec[0])); i++) {
+    simde__m128i r = simde_mm_setzero_si128();
+    SIMDE_CONSTIFY_8_(simde_mm_mpsadbw_epu8, r, simde_mm_setzero_si128(), imm_vec[i].imm8, imm_vec[i].a, imm_vec[i].b);
+    simde_assert_m128i_u16(r, ==, imm_vec[i].r);
+  }
+
   return 0;
 }
 
@@ -3319,6 +3448,35 @@ test_simde_mm_stream_load_si128(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_x_mm_stream_roundtrip(SIMDE_MUNIT_TEST_ARGS) {
+  /* Write a buffer with each of the streaming stores and read it back
+   * with the streaming load, so the non-temporal paths (LDNP/STNP on
+   * AArch64) are checked against each other and not only against
+   * ordinary loads and stores. */
+  SIMDE_ALIGN_TO_16 int32_t src[12 * 4];
+  SIMDE_ALIGN_TO_16 int32_t dst[12 * 4];
+
+  for (size_t i = 0 ; i < (sizeof(src) / sizeof(src[0])) ; i++) {
+    src[i] = HEDLEY_STATIC_CAST(int32_t, (HEDLEY_STATIC_CAST(uint32_t, i) * UINT32_C(0x9e3779b9)) & UINT32_C(0x3fffffff));
+    dst[i] = 0;
+  }
+
+  for (size_t i = 0 ; i < 12 ; i += 3) {
+    simde_mm_stream_si128(SIMDE_ALIGN_CAST(simde__m128i*, &(dst[(i + 0) * 4])), simde_mm_load_si128(SIMDE_ALIGN_CAST(simde__m128i const*, &(src[(i + 0) * 4]))));
+    simde_mm_stream_ps(SIMDE_ALIGN_CAST(simde_float32*, &(dst[(i + 1) * 4])), simde_mm_castsi128_ps(simde_mm_load_si128(SIMDE_ALIGN_CAST(simde__m128i const*, &(src[(i + 1) * 4])))));
+    simde_mm_stream_pd(SIMDE_ALIGN_CAST(simde_float64*, &(dst[(i + 2) * 4])), simde_mm_castsi128_pd(simde_mm_load_si128(SIMDE_ALIGN_CAST(simde__m128i const*, &(src[(i + 2) * 4])))));
+  }
+  simde_mm_sfence();
+
+  for (size_t i = 0 ; i < 12 ; i++) {
+    simde__m128i r = simde_mm_stream_load_si128(SIMDE_ALIGN_CAST(simde__m128i const*, &(dst[i * 4])));
+    simde_test_x86_assert_equal_i32x4(r, simde_mm_load_si128(SIMDE_ALIGN_CAST(simde__m128i const*, &(src[i * 4]))));
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm_test_all_ones(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -3656,6 +3814,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_round_ps_zero)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_stream_load_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_mm_stream_roundtrip)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_test_all_ones)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_test_all_zeros)